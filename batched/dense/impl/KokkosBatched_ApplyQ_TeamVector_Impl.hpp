@@ -78,6 +78,57 @@ struct TeamVectorApplyQ<MemberType, Side::Right, Trans::NoTranspose,
   }
 };
 
+template <typename MemberType>
+struct TeamVectorApplyQ<MemberType, Side::Left, Trans::NoTranspose,
+                        Algo::ApplyQ::Blocked> {
+  template <typename AViewType, typename tViewType, typename BViewType,
+            typename wViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const AViewType &A,
+                                           const tViewType &t,
+                                           const BViewType &B,
+                                           const wViewType &w) {
+    return TeamVectorApplyQ_LeftForwardBlockedInternal::invoke(
+        member, B.extent(0), B.extent(1), A.extent(1), A.data(), A.stride_0(),
+        A.stride_1(), t.data(), t.stride_0(), B.data(), B.stride_0(),
+        B.stride_1(), w.data());
+  }
+};
+
+template <typename MemberType>
+struct TeamVectorApplyQ<MemberType, Side::Left, Trans::Transpose,
+                        Algo::ApplyQ::Blocked> {
+  template <typename AViewType, typename tViewType, typename BViewType,
+            typename wViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const AViewType &A,
+                                           const tViewType &t,
+                                           const BViewType &B,
+                                           const wViewType &w) {
+    return TeamVectorApplyQ_LeftBackwardBlockedInternal::invoke(
+        member, B.extent(0), B.extent(1), A.extent(1), A.data(), A.stride_0(),
+        A.stride_1(), t.data(), t.stride_0(), B.data(), B.stride_0(),
+        B.stride_1(), w.data());
+  }
+};
+
+template <typename MemberType>
+struct TeamVectorApplyQ<MemberType, Side::Right, Trans::NoTranspose,
+                        Algo::ApplyQ::Blocked> {
+  template <typename AViewType, typename tViewType, typename BViewType,
+            typename wViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const AViewType &A,
+                                           const tViewType &t,
+                                           const BViewType &B,
+                                           const wViewType &w) {
+    return TeamVectorApplyQ_RightForwardBlockedInternal::invoke(
+        member, B.extent(0), B.extent(1), A.extent(1), A.data(), A.stride_0(),
+        A.stride_1(), t.data(), t.stride_0(), B.data(), B.stride_0(),
+        B.stride_1(), w.data());
+  }
+};
+
 }  // namespace KokkosBatched
 
 #endif
@@ -20,6 +20,7 @@
 
 #include "KokkosBatched_Util.hpp"
 #include "KokkosBatched_ApplyHouseholder_TeamVector_Internal.hpp"
+#include "KokkosBatched_HouseholderWY_TeamVector_Internal.hpp"
 
 namespace KokkosBatched {
 
@@ -198,6 +199,88 @@ struct TeamVectorApplyQ_RightForwardInternal {
   }
 };
 
+///
+/// Blocked variants: nb reflectors at a time are formed into I - V T V^H
+/// and applied with GEMM-like updates; T is rebuilt for each block
+///  - w is nb * (nb + n) workspace for Left and nb * (nb + m) for Right,
+///    nb = max_block_size
+///
+
+struct TeamVectorApplyQ_LeftForwardBlockedInternal {
+  template <typename MemberType, typename ValueType>
+  KOKKOS_INLINE_FUNCTION static int invoke(
+      const MemberType &member, const int m, const int n, const int k,
+      /* */ ValueType *A, const int as0, const int as1,
+      /* */ ValueType *t, const int ts,
+      /* */ ValueType *B, const int bs0, const int bs1,
+      /* */ ValueType *w) {
+    constexpr int nb = TeamVectorHouseholderWY_Internal::max_block_size;
+
+    /// B = Q B = (Q0 Q1 ... ) B, with Qb = I - Vb Tb Vb^H
+    ValueType *T = w, *W = w + nb * nb;
+    for (int j0 = k > 0 ? ((k - 1) / nb) * nb : -1; j0 >= 0; j0 -= nb) {
+      const int kb = (k - j0) < nb ? (k - j0) : nb;
+      const ValueType *A11 = A + j0 * as0 + j0 * as1;
+      TeamVectorHouseholderWY_Internal::form_t(member, m - j0, kb, A11, as0,
+                                               as1, t + j0 * ts, ts, T, nb);
+      TeamVectorHouseholderWY_Internal::apply_left(
+          member, false, m - j0, n, kb, A11, as0, as1, T, nb, B + j0 * bs0,
+          bs0, bs1, W);
+    }
+    return 0;
+  }
+};
+
+struct TeamVectorApplyQ_LeftBackwardBlockedInternal {
+  template <typename MemberType, typename ValueType>
+  KOKKOS_INLINE_FUNCTION static int invoke(
+      const MemberType &member, const int m, const int n, const int k,
+      /* */ ValueType *A, const int as0, const int as1,
+      /* */ ValueType *t, const int ts,
+      /* */ ValueType *B, const int bs0, const int bs1,
+      /* */ ValueType *w) {
+    constexpr int nb = TeamVectorHouseholderWY_Internal::max_block_size;
+
+    /// B = Q^H B = ( ... Q1^H Q0^H) B, with Qb^H = I - Vb Tb^H Vb^H
+    ValueType *T = w, *W = w + nb * nb;
+    for (int j0 = 0; j0 < k; j0 += nb) {
+      const int kb = (k - j0) < nb ? (k - j0) : nb;
+      const ValueType *A11 = A + j0 * as0 + j0 * as1;
+      TeamVectorHouseholderWY_Internal::form_t(member, m - j0, kb, A11, as0,
+                                               as1, t + j0 * ts, ts, T, nb);
+      TeamVectorHouseholderWY_Internal::apply_left(
+          member, true, m - j0, n, kb, A11, as0, as1, T, nb, B + j0 * bs0,
+          bs0, bs1, W);
+    }
+    return 0;
+  }
+};
+
+struct TeamVectorApplyQ_RightForwardBlockedInternal {
+  template <typename MemberType, typename ValueType>
+  KOKKOS_INLINE_FUNCTION static int invoke(
+      const MemberType &member, const int m, const int n, const int k,
+      /* */ ValueType *A, const int as0, const int as1,
+      /* */ ValueType *t, const int ts,
+      /* */ ValueType *B, const int bs0, const int bs1,
+      /* */ ValueType *w) {
+    constexpr int nb = TeamVectorHouseholderWY_Internal::max_block_size;
+
+    /// B = B Q = B (Q0 Q1 ... ), with Qb = I - Vb Tb Vb^H
+    ValueType *T = w, *W = w + nb * nb;
+    for (int j0 = 0; j0 < k; j0 += nb) {
+      const int kb = (k - j0) < nb ? (k - j0) : nb;
+      const ValueType *A11 = A + j0 * as0 + j0 * as1;
+      TeamVectorHouseholderWY_Internal::form_t(member, n - j0, kb, A11, as0,
+                                               as1, t + j0 * ts, ts, T, nb);
+      TeamVectorHouseholderWY_Internal::apply_right(
+          member, false, m, n - j0, kb, A11, as0, as1, T, nb, B + j0 * bs1,
+          bs0, bs1, W);
+    }
+    return 0;
+  }
+};
+
 }  // end namespace KokkosBatched
 
 #endif
@@ -0,0 +1,69 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_BLOCKTRIDIAG_TEAM_IMPL_HPP__
+#define __KOKKOSBATCHED_BLOCKTRIDIAG_TEAM_IMPL_HPP__
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_BlockTridiag_Team_Internal.hpp"
+
+namespace KokkosBatched {
+
+///
+/// Team Impl
+/// =========
+
+template <typename MemberType, typename ArgAlgo>
+template <typename AViewType, typename BViewType, typename CViewType>
+KOKKOS_INLINE_FUNCTION int
+TeamBlockTridiagFactorize<MemberType, ArgAlgo>::invoke(
+    const MemberType &member, const AViewType &A, const BViewType &B,
+    const CViewType &C) {
+  static_assert(AViewType::rank == 3 && BViewType::rank == 3 &&
+                    CViewType::rank == 3,
+                "BlockTridiagFactorize: A, B and C must be rank 3 views");
+  return TeamBlockTridiagInternal<ArgAlgo>::factorize(
+      member, A.extent(0), A.extent(1), A.data(), A.stride_0(), A.stride_1(),
+      A.stride_2(), B.data(), B.stride_0(), B.stride_1(), B.stride_2(),
+      C.data(), C.stride_0(), C.stride_1(), C.stride_2());
+}
+
+template <typename MemberType, typename ArgAlgo>
+template <typename AViewType, typename BViewType, typename CViewType,
+          typename XViewType>
+KOKKOS_INLINE_FUNCTION int TeamBlockTridiagSolve<MemberType, ArgAlgo>::invoke(
+    const MemberType &member, const AViewType &A, const BViewType &B,
+    const CViewType &C, const XViewType &X) {
+  static_assert(AViewType::rank == 3 && BViewType::rank == 3 &&
+                    CViewType::rank == 3,
+                "BlockTridiagSolve: A, B and C must be rank 3 views");
+  static_assert(XViewType::rank == 2 || XViewType::rank == 3,
+                "BlockTridiagSolve: X must be a rank 2 or 3 view");
+  // one right hand side is a single column
+  int nrhs = 1, xs2 = 1;
+  if constexpr (XViewType::rank == 3) {
+    nrhs = X.extent(2);
+    xs2  = X.stride_2();
+  }
+  return TeamBlockTridiagInternal<ArgAlgo>::solve(
+      member, A.extent(0), A.extent(1), nrhs, A.data(), A.stride_0(),
+      A.stride_1(), A.stride_2(), B.data(), B.stride_0(), B.stride_1(),
+      B.stride_2(), C.data(), C.stride_0(), C.stride_1(), C.stride_2(),
+      X.data(), X.stride_0(), X.stride_1(), xs2);
+}
+
+}  // namespace KokkosBatched
+
+#endif
@@ -0,0 +1,120 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_BLOCKTRIDIAG_TEAM_INTERNAL_HPP__
+#define __KOKKOSBATCHED_BLOCKTRIDIAG_TEAM_INTERNAL_HPP__
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+#include "KokkosBatched_LU_Team_Internal.hpp"
+#include "KokkosBatched_Trsm_Team_Internal.hpp"
+#include "KokkosBatched_Gemm_Team_Internal.hpp"
+
+namespace KokkosBatched {
+
+///
+/// Team Internal Impl
+/// ==================
+///
+/// Block LU of the block tridiagonal matrix with diagonal blocks A(k),
+/// superdiagonal blocks B(k) and subdiagonal blocks C(k), each blk x blk at
+/// A + k * as0 with the strides as1, as2 (and likewise for B and C). For
+/// k < l - 1:
+///   A(k) = L(k) U(k), B(k) = inv(L(k)) B(k), C(k) = C(k) inv(U(k)),
+///   A(k + 1) -= C(k) B(k),
+/// then A(l - 1) = L(l - 1) U(l - 1). The solve runs the block forward
+/// substitution with L(k) and C(k), then the backward one with U(k) and
+/// B(k), on the blk x nrhs blocks of X.
+
+template <typename ArgAlgo>
+struct TeamBlockTridiagInternal {
+  template <typename MemberType, typename ValueType>
+  KOKKOS_INLINE_FUNCTION static int factorize(
+      const MemberType &member, const int l, const int blk,
+      /**/ ValueType *KOKKOS_RESTRICT A, const int as0, const int as1,
+      const int as2,
+      /**/ ValueType *KOKKOS_RESTRICT B, const int bs0, const int bs1,
+      const int bs2,
+      /**/ ValueType *KOKKOS_RESTRICT C, const int cs0, const int cs1,
+      const int cs2) {
+    typedef typename MagnitudeScalarType<ValueType>::type mag_type;
+    const mag_type one(1), minus_one(-1), tiny(0);
+    for (int k = 0; k + 1 < l; ++k) {
+      ValueType *KOKKOS_RESTRICT Ak = A + k * as0;
+      ValueType *KOKKOS_RESTRICT Bk = B + k * bs0;
+      ValueType *KOKKOS_RESTRICT Ck = C + k * cs0;
+      TeamLU_Internal<ArgAlgo>::invoke(member, blk, blk, Ak, as1, as2, tiny);
+      member.team_barrier();
+      TeamTrsmInternalLeftLower<ArgAlgo>::invoke(member, true, blk, blk, one,
+                                                 Ak, as1, as2, Bk, bs1, bs2);
+      // C(k) inv(U(k)) is the transpose of a lower solve with U(k)^T
+      TeamTrsmInternalLeftLower<ArgAlgo>::invoke(member, false, blk, blk, one,
+                                                 Ak, as2, as1, Ck, cs2, cs1);
+      member.team_barrier();
+      TeamGemmInternal<ArgAlgo>::invoke(member, blk, blk, blk, minus_one, Ck,
+                                        cs1, cs2, Bk, bs1, bs2, one, Ak + as0,
+                                        as1, as2);
+      member.team_barrier();
+    }
+    if (l > 0)
+      TeamLU_Internal<ArgAlgo>::invoke(member, blk, blk, A + (l - 1) * as0,
+                                       as1, as2, tiny);
+    return 0;
+  }
+
+  template <typename MemberType, typename ValueType>
+  KOKKOS_INLINE_FUNCTION static int solve(
+      const MemberType &member, const int l, const int blk, const int nrhs,
+      const ValueType *KOKKOS_RESTRICT A, const int as0, const int as1,
+      const int as2, const ValueType *KOKKOS_RESTRICT B, const int bs0,
+      const int bs1, const int bs2, const ValueType *KOKKOS_RESTRICT C,
+      const int cs0, const int cs1, const int cs2,
+      /**/ ValueType *KOKKOS_RESTRICT X, const int xs0, const int xs1,
+      const int xs2) {
+    typedef typename MagnitudeScalarType<ValueType>::type mag_type;
+    const mag_type one(1), minus_one(-1);
+    for (int k = 0; k < l; ++k) {
+      ValueType *KOKKOS_RESTRICT Xk = X + k * xs0;
+      TeamTrsmInternalLeftLower<ArgAlgo>::invoke(member, true, blk, nrhs, one,
+                                                 A + k * as0, as1, as2, Xk,
+                                                 xs1, xs2);
+      member.team_barrier();
+      if (k + 1 < l) {
+        TeamGemmInternal<ArgAlgo>::invoke(member, blk, nrhs, blk, minus_one,
+                                          C + k * cs0, cs1, cs2, Xk, xs1, xs2,
+                                          one, Xk + xs0, xs1, xs2);
+        member.team_barrier();
+      }
+    }
+    for (int k = l - 1; k >= 0; --k) {
+      ValueType *KOKKOS_RESTRICT Xk = X + k * xs0;
+      TeamTrsmInternalLeftUpper<ArgAlgo>::invoke(member, false, blk, nrhs,
+                                                 one, A + k * as0, as1, as2,
+                                                 Xk, xs1, xs2);
+      member.team_barrier();
+      if (k > 0) {
+        TeamGemmInternal<ArgAlgo>::invoke(member, blk, nrhs, blk, minus_one,
+                                          B + (k - 1) * bs0, bs1, bs2, Xk, xs1,
+                                          xs2, one, Xk - xs0, xs1, xs2);
+        member.team_barrier();
+      }
+    }
+    return 0;
+  }
+};
+
+}  // namespace KokkosBatched
+
+#endif
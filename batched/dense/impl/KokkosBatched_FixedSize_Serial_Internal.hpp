@@ -0,0 +1,239 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_FIXEDSIZE_SERIAL_INTERNAL_HPP__
+#define __KOKKOSBATCHED_FIXEDSIZE_SERIAL_INTERNAL_HPP__
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+
+namespace KokkosBatched {
+
+///
+/// Serial Internal Impl for compile-time extents
+/// =============================================
+///
+/// For views whose extents are all known at compile time (e.g.
+/// Kokkos::View<double[4][4]> or subviews of Kokkos::View<double*[4][4]>) and
+/// at most max_fixed_size, the serial kernels load the operands into local
+/// arrays, run loops with constant trip counts that the compiler unrolls
+/// completely, and store the results back. For the 2x2 to 8x8 blocks of
+/// block-sparse and block-tridiagonal solvers, the loop overhead of the
+/// runtime-extent kernels dominates otherwise.
+
+static constexpr int max_fixed_size = 8;
+
+template <typename ViewType>
+KOKKOS_INLINE_FUNCTION constexpr bool is_fixed_size_view() {
+  if constexpr (Kokkos::is_view_v<ViewType>) {
+    for (unsigned r = 0; r < ViewType::rank; ++r) {
+      const auto e = ViewType::static_extent(r);
+      if (e == 0 || e > max_fixed_size) return false;
+    }
+    return true;
+  } else {
+    return false;
+  }
+}
+
+/// true if all the views have static extents in [1, max_fixed_size]
+template <typename... ViewTypes>
+constexpr bool is_fixed_size_v = (is_fixed_size_view<ViewTypes>() && ...);
+
+///
+/// C = beta C + alpha A B; C (M x N), A (M x K), B (K x N)
+///
+template <int M, int N, int K>
+struct SerialGemmInternalFixed {
+  template <typename ScalarType, typename ValueType>
+  KOKKOS_INLINE_FUNCTION static int invoke(
+      const ScalarType alpha, const ValueType *KOKKOS_RESTRICT A,
+      const int as0, const int as1, const ValueType *KOKKOS_RESTRICT B,
+      const int bs0, const int bs1, const ScalarType beta,
+      /**/ ValueType *KOKKOS_RESTRICT C, const int cs0, const int cs1) {
+    const ScalarType zero(0.0);
+    ValueType a[M][K], b[K][N], c[M][N];
+
+    for (int i = 0; i < M; ++i)
+      for (int j = 0; j < N; ++j)
+        c[i][j] = beta == zero ? ValueType(0)
+                               : ValueType(beta * C[i * cs0 + j * cs1]);
+    if (alpha != zero) {
+      for (int i = 0; i < M; ++i)
+        for (int p = 0; p < K; ++p) a[i][p] = alpha * A[i * as0 + p * as1];
+      for (int p = 0; p < K; ++p)
+        for (int j = 0; j < N; ++j) b[p][j] = B[p * bs0 + j * bs1];
+      for (int i = 0; i < M; ++i)
+        for (int j = 0; j < N; ++j)
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+          for (int p = 0; p < K; ++p) c[i][j] += a[i][p] * b[p][j];
+    }
+    for (int i = 0; i < M; ++i)
+      for (int j = 0; j < N; ++j) C[i * cs0 + j * cs1] = c[i][j];
+    return 0;
+  }
+};
+
+///
+/// LU without pivoting of A (M x N), with the same tiny perturbation of the
+/// pivots as SerialLU_Internal<Algo::LU::Unblocked>
+///
+template <int M, int N>
+struct SerialLU_InternalFixed {
+  template <typename ValueType>
+  KOKKOS_INLINE_FUNCTION static void factorize(
+      ValueType (&a)[M][N],
+      const typename MagnitudeScalarType<ValueType>::type tiny) {
+    using mst           = typename MagnitudeScalarType<ValueType>::type;
+    const auto abs_tiny = tiny > 0 ? tiny : mst(-tiny);
+    constexpr int k     = M < N ? M : N;
+    for (int p = 0; p < k; ++p) {
+      if (tiny != 0) {
+        const auto alpha11_real =
+            Kokkos::ArithTraits<ValueType>::real(a[p][p]);
+        a[p][p] += -abs_tiny * ValueType(alpha11_real < 0);
+        a[p][p] += abs_tiny * ValueType(alpha11_real >= 0);
+      }
+      for (int i = p + 1; i < M; ++i) {
+        a[i][p] /= a[p][p];
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+        for (int j = p + 1; j < N; ++j) a[i][j] -= a[i][p] * a[p][j];
+      }
+    }
+  }
+
+  template <typename ValueType>
+  KOKKOS_INLINE_FUNCTION static int invoke(
+      ValueType *KOKKOS_RESTRICT A, const int as0, const int as1,
+      const typename MagnitudeScalarType<ValueType>::type tiny) {
+    ValueType a[M][N];
+    for (int i = 0; i < M; ++i)
+      for (int j = 0; j < N; ++j) a[i][j] = A[i * as0 + j * as1];
+    factorize(a, tiny);
+    for (int i = 0; i < M; ++i)
+      for (int j = 0; j < N; ++j) A[i * as0 + j * as1] = a[i][j];
+    return 0;
+  }
+};
+
+///
+/// b = alpha inv(L) b or b = alpha inv(U) b with A (M x M); the transposed
+/// variants swap the strides of A
+///
+template <int M>
+struct SerialTrsvInternalFixed {
+  template <typename ValueType>
+  KOKKOS_INLINE_FUNCTION static void solve_lower(const bool use_unit_diag,
+                                                 const ValueType (&a)[M][M],
+                                                 ValueType (&b)[M]) {
+    for (int p = 0; p < M; ++p) {
+      if (!use_unit_diag) b[p] /= a[p][p];
+      for (int i = p + 1; i < M; ++i) b[i] -= a[i][p] * b[p];
+    }
+  }
+
+  template <typename ValueType>
+  KOKKOS_INLINE_FUNCTION static void solve_upper(const bool use_unit_diag,
+                                                 const ValueType (&a)[M][M],
+                                                 ValueType (&b)[M]) {
+    for (int p = M - 1; p >= 0; --p) {
+      if (!use_unit_diag) b[p] /= a[p][p];
+      for (int i = 0; i < p; ++i) b[i] -= a[i][p] * b[p];
+    }
+  }
+
+  template <bool Lower, typename ScalarType, typename ValueType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const bool use_unit_diag,
+                                           const ScalarType alpha,
+                                           const ValueType *KOKKOS_RESTRICT A,
+                                           const int as0, const int as1,
+                                           /**/ ValueType *KOKKOS_RESTRICT b,
+                                           const int bs0) {
+    const ScalarType zero(0.0);
+    ValueType a[M][M], x[M];
+    if (alpha == zero) {
+      for (int i = 0; i < M; ++i) b[i * bs0] = ValueType(0);
+      return 0;
+    }
+    for (int i = 0; i < M; ++i) {
+      x[i] = alpha * b[i * bs0];
+      for (int j = 0; j < M; ++j) a[i][j] = A[i * as0 + j * as1];
+    }
+    if constexpr (Lower)
+      solve_lower(use_unit_diag, a, x);
+    else
+      solve_upper(use_unit_diag, a, x);
+    for (int i = 0; i < M; ++i) b[i * bs0] = x[i];
+    return 0;
+  }
+};
+
+///
+/// A = inv(L U) where A (M x M) holds the LU factors on entry
+///
+template <int M>
+struct SerialInverseLUInternalFixed {
+  template <typename ValueType>
+  KOKKOS_INLINE_FUNCTION static int invoke(ValueType *KOKKOS_RESTRICT A,
+                                           const int as0, const int as1) {
+    ValueType a[M][M], x[M];
+    for (int i = 0; i < M; ++i)
+      for (int j = 0; j < M; ++j) a[i][j] = A[i * as0 + j * as1];
+    // column j of the inverse solves L U x = e_j
+    for (int j = 0; j < M; ++j) {
+      for (int i = 0; i < M; ++i) x[i] = i == j ? ValueType(1) : ValueType(0);
+      SerialTrsvInternalFixed<M>::solve_lower(true, a, x);
+      SerialTrsvInternalFixed<M>::solve_upper(false, a, x);
+      for (int i = 0; i < M; ++i) A[i * as0 + j * as1] = x[i];
+    }
+    return 0;
+  }
+};
+
+///
+/// A x = y without pivoting; A (M x M) is overwritten by its LU factors
+///
+template <int M>
+struct SerialGesvInternalFixed {
+  template <typename ValueType>
+  KOKKOS_INLINE_FUNCTION static int invoke(ValueType *KOKKOS_RESTRICT A,
+                                           const int as0, const int as1,
+                                           /**/ ValueType *KOKKOS_RESTRICT x,
+                                           const int xs0,
+                                           const ValueType *KOKKOS_RESTRICT y,
+                                           const int ys0) {
+    ValueType a[M][M], b[M];
+    for (int i = 0; i < M; ++i) {
+      b[i] = y[i * ys0];
+      for (int j = 0; j < M; ++j) a[i][j] = A[i * as0 + j * as1];
+    }
+    SerialLU_InternalFixed<M, M>::factorize(a, 0);
+    SerialTrsvInternalFixed<M>::solve_lower(true, a, b);
+    SerialTrsvInternalFixed<M>::solve_upper(false, a, b);
+    for (int i = 0; i < M; ++i) {
+      x[i * xs0] = b[i];
+      for (int j = 0; j < M; ++j) A[i * as0 + j * as1] = a[i][j];
+    }
+    return 0;
+  }
+};
+
+}  // namespace KokkosBatched
+
+#endif
@@ -18,6 +18,7 @@
 
 #include "KokkosBatched_Util.hpp"
 #include "KokkosBatched_Gemm_Serial_Internal.hpp"
+#include "KokkosBatched_FixedSize_Serial_Internal.hpp"
 
 namespace KokkosBatched {
 ///
@@ -94,6 +95,12 @@ SerialGemm<Trans::NoTranspose, Trans::NoTranspose,
                                           const CViewType &C) {
   // C = beta C + alpha A B
   // C (m x n), A(m x k), B(k x n)
+  if constexpr (is_fixed_size_v<AViewType, BViewType, CViewType>)
+    return SerialGemmInternalFixed<CViewType::static_extent(0),
+                                   CViewType::static_extent(1),
+                                   AViewType::static_extent(1)>::invoke(
+        alpha, A.data(), A.stride_0(), A.stride_1(), B.data(), B.stride_0(),
+        B.stride_1(), beta, C.data(), C.stride_0(), C.stride_1());
   return SerialGemmInternal<Algo::Gemm::Unblocked>::invoke(
       C.extent(0), C.extent(1), A.extent(1), alpha, A.data(), A.stride_0(),
       A.stride_1(), B.data(), B.stride_0(), B.stride_1(), beta, C.data(),
@@ -174,6 +181,12 @@ SerialGemm<Trans::Transpose, Trans::NoTranspose, Algo::Gemm::Unblocked>::invoke(
     const ScalarType beta, const CViewType &C) {
   // C = beta C + alpha A B
   // C (m x n), A(m x k), B(k x n)
+  if constexpr (is_fixed_size_v<AViewType, BViewType, CViewType>)
+    return SerialGemmInternalFixed<CViewType::static_extent(0),
+                                   CViewType::static_extent(1),
+                                   AViewType::static_extent(0)>::invoke(
+        alpha, A.data(), A.stride_1(), A.stride_0(), B.data(), B.stride_0(),
+        B.stride_1(), beta, C.data(), C.stride_0(), C.stride_1());
   return SerialGemmInternal<Algo::Gemm::Unblocked>::invoke(
       C.extent(0), C.extent(1), A.extent(0), alpha, A.data(), A.stride_1(),
       A.stride_0(), B.data(), B.stride_0(), B.stride_1(), beta, C.data(),
@@ -254,6 +267,12 @@ SerialGemm<Trans::NoTranspose, Trans::Transpose, Algo::Gemm::Unblocked>::invoke(
     const ScalarType beta, const CViewType &C) {
   // C = beta C + alpha A B
   // C (m x n), A(m x k), B(k x n)
+  if constexpr (is_fixed_size_v<AViewType, BViewType, CViewType>)
+    return SerialGemmInternalFixed<CViewType::static_extent(0),
+                                   CViewType::static_extent(1),
+                                   AViewType::static_extent(1)>::invoke(
+        alpha, A.data(), A.stride_0(), A.stride_1(), B.data(), B.stride_1(),
+        B.stride_0(), beta, C.data(), C.stride_0(), C.stride_1());
   return SerialGemmInternal<Algo::Gemm::Unblocked>::invoke(
       C.extent(0), C.extent(1), A.extent(1), alpha, A.data(), A.stride_0(),
       A.stride_1(), B.data(), B.stride_1(), B.stride_0(), beta, C.data(),
@@ -331,6 +350,12 @@ SerialGemm<Trans::Transpose, Trans::Transpose, Algo::Gemm::Unblocked>::invoke(
     const ScalarType beta, const CViewType &C) {
   // C = beta C + alpha A B
   // C (m x n), A(m x k), B(k x n)
+  if constexpr (is_fixed_size_v<AViewType, BViewType, CViewType>)
+    return SerialGemmInternalFixed<CViewType::static_extent(0),
+                                   CViewType::static_extent(1),
+                                   AViewType::static_extent(0)>::invoke(
+        alpha, A.data(), A.stride_1(), A.stride_0(), B.data(), B.stride_1(),
+        B.stride_0(), beta, C.data(), C.stride_0(), C.stride_1());
   return SerialGemmInternal<Algo::Gemm::Unblocked>::invoke(
       C.extent(0), C.extent(1), A.extent(0), alpha, A.data(), A.stride_1(),
       A.stride_0(), B.data(), B.stride_1(), B.stride_0(), beta, C.data(),
@@ -0,0 +1,625 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_GESV_FACTORIZE_IMPL_HPP__
+#define __KOKKOSBATCHED_GESV_FACTORIZE_IMPL_HPP__
+
+/// \author Kim Liegeois (knliege@sandia.gov)
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Gesv_Impl.hpp"
+
+namespace KokkosBatched {
+
+/// The factors F are stored as [LU | D1 | D2] where LU holds the factors of
+/// P D1 A D2 in its first n columns, D1 the row scaling (indexed by the rows
+/// of A) in column n and D2 the column scaling in column n+1. The solution
+/// of A x = y is then x = D2 U^{-1} L^{-1} P D1 y. Without pivoting, F only
+/// holds the LU factors of A.
+
+template <typename ViewType>
+KOKKOS_INLINE_FUNCTION typename ViewType::reference_type GesvEntry(
+    const ViewType &V, const int i, const int r) {
+  if constexpr (ViewType::rank == 1) {
+    (void)r;
+    return V(i);
+  } else {
+    return V(i, r);
+  }
+}
+
+template <typename ViewType>
+KOKKOS_INLINE_FUNCTION int GesvNumRhs(const ViewType &V) {
+  if constexpr (ViewType::rank == 1) {
+    (void)V;
+    return 1;
+  } else {
+    return V.extent(1);
+  }
+}
+
+template <typename MatrixType, typename FactorType>
+KOKKOS_INLINE_FUNCTION int checkGesvFactorizeInput(
+    const MatrixType A, const FactorType F, const size_t num_extra_cols) {
+  static_assert(Kokkos::is_view<MatrixType>::value,
+                "KokkosBatched::gesv: MatrixType is not a Kokkos::View.");
+  static_assert(Kokkos::is_view<FactorType>::value,
+                "KokkosBatched::gesv: FactorType is not a Kokkos::View.");
+  static_assert(MatrixType::rank == 2,
+                "KokkosBatched::gesv: MatrixType must have rank 2.");
+  static_assert(FactorType::rank == 2,
+                "KokkosBatched::gesv: FactorType must have rank 2.");
+  if (A.extent(0) != A.extent(1) || A.extent(0) != F.extent(0) ||
+      A.extent(1) + num_extra_cols > F.extent(1)) {
+#if KOKKOS_VERSION < 40199
+    KOKKOS_IMPL_DO_NOT_USE_PRINTF(
+        "KokkosBatched::gesv: dimensions of A and F do not match: A: "
+        "%d x %d, F (note: its second dimension should be at least the "
+        "second dimension of A + %d): %d x %d\n",
+        (int)A.extent(0), (int)A.extent(1), (int)num_extra_cols,
+        (int)F.extent(0), (int)F.extent(1));
+#else
+    Kokkos::printf(
+        "KokkosBatched::gesv: dimensions of A and F do not match: A: "
+        "%d x %d, F (note: its second dimension should be at least the "
+        "second dimension of A + %d): %d x %d\n",
+        (int)A.extent(0), (int)A.extent(1), (int)num_extra_cols,
+        (int)F.extent(0), (int)F.extent(1));
+#endif
+    return 1;
+  }
+  return 0;
+}
+
+template <typename FactorType, typename XViewType, typename YViewType>
+KOKKOS_INLINE_FUNCTION int checkGesvSolveInput(const FactorType F,
+                                               const XViewType X,
+                                               const YViewType Y) {
+  static_assert(Kokkos::is_view<XViewType>::value,
+                "KokkosBatched::gesv: XViewType is not a Kokkos::View.");
+  static_assert(Kokkos::is_view<YViewType>::value,
+                "KokkosBatched::gesv: YViewType is not a Kokkos::View.");
+  static_assert(XViewType::rank == 1 || XViewType::rank == 2,
+                "KokkosBatched::gesv: XViewType must have rank 1 or 2.");
+  static_assert(XViewType::rank == YViewType::rank,
+                "KokkosBatched::gesv: X and Y must have the same rank.");
+  if (F.extent(0) != X.extent(0) || F.extent(0) != Y.extent(0) ||
+      GesvNumRhs(X) != GesvNumRhs(Y)) {
+#if KOKKOS_VERSION < 40199
+    KOKKOS_IMPL_DO_NOT_USE_PRINTF(
+        "KokkosBatched::gesv: dimensions of F and X and Y do not match: F: "
+        "%d x %d, X: %d x %d, Y: %d x %d\n",
+        (int)F.extent(0), (int)F.extent(1), (int)X.extent(0), GesvNumRhs(X),
+        (int)Y.extent(0), GesvNumRhs(Y));
+#else
+    Kokkos::printf(
+        "KokkosBatched::gesv: dimensions of F and X and Y do not match: F: "
+        "%d x %d, X: %d x %d, Y: %d x %d\n",
+        (int)F.extent(0), (int)F.extent(1), (int)X.extent(0), GesvNumRhs(X),
+        (int)Y.extent(0), GesvNumRhs(Y));
+#endif
+    return 1;
+  }
+  return 0;
+}
+
+///
+/// Serial Impl
+/// ===========
+template <>
+struct SerialGesvFactorize<Gesv::StaticPivoting> {
+  template <typename MatrixType, typename FactorType, typename PivotType,
+            typename TmpType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MatrixType A,
+                                           const FactorType F,
+                                           const PivotType piv,
+                                           const TmpType tmp) {
+    using value_type = typename FactorType::non_const_value_type;
+#if (KOKKOSKERNELS_DEBUG_LEVEL > 0)
+    if (checkGesvFactorizeInput(A, F, 2)) return 1;
+    if (A.extent(0) != tmp.extent(0) || tmp.extent(1) < 4 ||
+        A.extent(0) != piv.extent(0)) {
+#if KOKKOS_VERSION < 40199
+      KOKKOS_IMPL_DO_NOT_USE_PRINTF(
+          "KokkosBatched::gesv: dimensions of A, piv and tmp do not match: "
+          "A: %d x %d, piv: %d, tmp (note: its second dimension should be "
+          "4): %d x %d\n",
+          (int)A.extent(0), (int)A.extent(1), (int)piv.extent(0),
+          (int)tmp.extent(0), (int)tmp.extent(1));
+#else
+      Kokkos::printf(
+          "KokkosBatched::gesv: dimensions of A, piv and tmp do not match: "
+          "A: %d x %d, piv: %d, tmp (note: its second dimension should be "
+          "4): %d x %d\n",
+          (int)A.extent(0), (int)A.extent(1), (int)piv.extent(0),
+          (int)tmp.extent(0), (int)tmp.extent(1));
+#endif
+      return 1;
+    }
+#endif
+    const int n = A.extent(0);
+
+    auto PDAD    = Kokkos::subview(F, Kokkos::ALL, Kokkos::make_pair(0, n));
+    auto D1      = Kokkos::subview(F, Kokkos::ALL, n);
+    auto PDY     = Kokkos::subview(tmp, Kokkos::ALL, 0);
+    auto D2      = Kokkos::subview(tmp, Kokkos::ALL, 1);
+    auto tmp_v_1 = Kokkos::subview(tmp, Kokkos::ALL, 2);
+    auto tmp_v_2 = Kokkos::subview(tmp, Kokkos::ALL, 3);
+
+    // Pivoting a vector of ones leaves the row scaling in D1.
+    for (int i = 0; i < n; ++i) D1(i) = Kokkos::ArithTraits<value_type>::one();
+
+    if (SerialStaticPivoting::invoke(A, PDAD, D1, PDY, D2, tmp_v_1, tmp_v_2,
+                                     piv) == 1) {
+#if KOKKOS_VERSION < 40199
+      KOKKOS_IMPL_DO_NOT_USE_PRINTF(
+          "KokkosBatched::gesv: the currently implemented static pivoting "
+          "failed.\n");
+#else
+      Kokkos::printf(
+          "KokkosBatched::gesv: the currently implemented static pivoting "
+          "failed.\n");
+#endif
+      return 1;
+    }
+    for (int i = 0; i < n; ++i) F(i, n + 1) = D2(i);
+
+    return SerialLU<Algo::Level3::Unblocked>::invoke(PDAD);
+  }
+};
+
+template <>
+struct SerialGesvFactorize<Gesv::NoPivoting> {
+  template <typename MatrixType, typename FactorType, typename PivotType,
+            typename TmpType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MatrixType A,
+                                           const FactorType F,
+                                           const PivotType /*piv*/,
+                                           const TmpType /*tmp*/) {
+#if (KOKKOSKERNELS_DEBUG_LEVEL > 0)
+    if (checkGesvFactorizeInput(A, F, 0)) return 1;
+#endif
+    const int n = A.extent(0);
+
+    auto LU = Kokkos::subview(F, Kokkos::ALL, Kokkos::make_pair(0, n));
+    if (LU.data() != A.data())
+      SerialCopy<Trans::NoTranspose, 2>::invoke(A, LU);
+
+    return SerialLU<Algo::Level3::Unblocked>::invoke(LU);
+  }
+};
+
+template <>
+struct SerialGesvSolve<Gesv::StaticPivoting> {
+  template <typename FactorType, typename PivotType, typename XViewType,
+            typename YViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const FactorType F,
+                                           const PivotType piv,
+                                           const XViewType X,
+                                           const YViewType Y) {
+#if (KOKKOSKERNELS_DEBUG_LEVEL > 0)
+    if (checkGesvSolveInput(F, X, Y)) return 1;
+#endif
+    const int n    = F.extent(0);
+    const int nrhs = GesvNumRhs(X);
+
+    auto LU = Kokkos::subview(F, Kokkos::ALL, Kokkos::make_pair(0, n));
+
+    for (int i = 0; i < n; ++i) {
+      const int p = piv(i);
+      for (int r = 0; r < nrhs; ++r)
+        GesvEntry(X, i, r) = F(p, n) * GesvEntry(Y, p, r);
+    }
+
+    int r_val =
+        SerialTrsm<Side::Left, Uplo::Lower, Trans::NoTranspose, Diag::Unit,
+                   Algo::Level3::Unblocked>::invoke(1.0, LU, X);
+
+    if (r_val == 0)
+      r_val =
+          SerialTrsm<Side::Left, Uplo::Upper, Trans::NoTranspose, Diag::NonUnit,
+                     Algo::Level3::Unblocked>::invoke(1.0, LU, X);
+
+    if (r_val == 0)
+      for (int i = 0; i < n; ++i)
+        for (int r = 0; r < nrhs; ++r) GesvEntry(X, i, r) *= F(i, n + 1);
+
+    return r_val;
+  }
+};
+
+template <>
+struct SerialGesvSolve<Gesv::NoPivoting> {
+  template <typename FactorType, typename PivotType, typename XViewType,
+            typename YViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const FactorType F,
+                                           const PivotType /*piv*/,
+                                           const XViewType X,
+                                           const YViewType Y) {
+#if (KOKKOSKERNELS_DEBUG_LEVEL > 0)
+    if (checkGesvSolveInput(F, X, Y)) return 1;
+#endif
+    const int n = F.extent(0);
+
+    auto LU = Kokkos::subview(F, Kokkos::ALL, Kokkos::make_pair(0, n));
+
+    int r_val =
+        SerialCopy<Trans::NoTranspose, XViewType::rank>::invoke(Y, X);
+
+    if (r_val == 0)
+      r_val =
+          SerialTrsm<Side::Left, Uplo::Lower, Trans::NoTranspose, Diag::Unit,
+                     Algo::Level3::Unblocked>::invoke(1.0, LU, X);
+
+    if (r_val == 0)
+      r_val =
+          SerialTrsm<Side::Left, Uplo::Upper, Trans::NoTranspose, Diag::NonUnit,
+                     Algo::Level3::Unblocked>::invoke(1.0, LU, X);
+
+    return r_val;
+  }
+};
+
+///
+/// Team Impl
+/// =========
+template <typename MemberType>
+struct TeamGesvFactorize<MemberType, Gesv::StaticPivoting> {
+  template <typename MatrixType, typename FactorType, typename PivotType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const MatrixType A,
+                                           const FactorType F,
+                                           const PivotType piv) {
+    using value_type = typename FactorType::non_const_value_type;
+#if (KOKKOSKERNELS_DEBUG_LEVEL > 0)
+    if (checkGesvFactorizeInput(A, F, 2)) return 1;
+#endif
+    using ScratchPadMatrixViewType = Kokkos::View<
+        value_type **,
+        typename FactorType::execution_space::scratch_memory_space>;
+
+    const int n = A.extent(0);
+
+    ScratchPadMatrixViewType tmp(member.team_scratch(0), n, 4);
+    auto PDAD    = Kokkos::subview(F, Kokkos::ALL, Kokkos::make_pair(0, n));
+    auto D1      = Kokkos::subview(F, Kokkos::ALL, n);
+    auto PDY     = Kokkos::subview(tmp, Kokkos::ALL, 0);
+    auto D2      = Kokkos::subview(tmp, Kokkos::ALL, 1);
+    auto tmp_v_1 = Kokkos::subview(tmp, Kokkos::ALL, 2);
+    auto tmp_v_2 = Kokkos::subview(tmp, Kokkos::ALL, 3);
+
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(member, n), [&](const int &i) {
+      D1(i) = Kokkos::ArithTraits<value_type>::one();
+    });
+    member.team_barrier();
+
+    if (TeamStaticPivoting<MemberType>::invoke(member, A, PDAD, D1, PDY, D2,
+                                               tmp_v_1, tmp_v_2, piv) == 1) {
+#if KOKKOS_VERSION < 40199
+      KOKKOS_IMPL_DO_NOT_USE_PRINTF(
+          "KokkosBatched::gesv: the currently implemented static pivoting "
+          "failed.\n");
+#else
+      Kokkos::printf(
+          "KokkosBatched::gesv: the currently implemented static pivoting "
+          "failed.\n");
+#endif
+      return 1;
+    }
+    member.team_barrier();
+
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(member, n),
+                         [&](const int &i) { F(i, n + 1) = D2(i); });
+
+    int r_val =
+        TeamLU<MemberType, Algo::Level3::Unblocked>::invoke(member, PDAD);
+    member.team_barrier();
+
+    return r_val;
+  }
+};
+
+template <typename MemberType>
+struct TeamGesvFactorize<MemberType, Gesv::NoPivoting> {
+  template <typename MatrixType, typename FactorType, typename PivotType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const MatrixType A,
+                                           const FactorType F,
+                                           const PivotType /*piv*/) {
+#if (KOKKOSKERNELS_DEBUG_LEVEL > 0)
+    if (checkGesvFactorizeInput(A, F, 0)) return 1;
+#endif
+    const int n = A.extent(0);
+
+    auto LU = Kokkos::subview(F, Kokkos::ALL, Kokkos::make_pair(0, n));
+    if (LU.data() != A.data()) {
+      TeamCopy<MemberType, Trans::NoTranspose, 2>::invoke(member, A, LU);
+      member.team_barrier();
+    }
+
+    int r_val = TeamLU<MemberType, Algo::Level3::Unblocked>::invoke(member, LU);
+    member.team_barrier();
+
+    return r_val;
+  }
+};
+
+template <typename MemberType>
+struct TeamGesvSolve<MemberType, Gesv::StaticPivoting> {
+  template <typename FactorType, typename PivotType, typename XViewType,
+            typename YViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const FactorType F,
+                                           const PivotType piv,
+                                           const XViewType X,
+                                           const YViewType Y) {
+#if (KOKKOSKERNELS_DEBUG_LEVEL > 0)
+    if (checkGesvSolveInput(F, X, Y)) return 1;
+#endif
+    const int n    = F.extent(0);
+    const int nrhs = GesvNumRhs(X);
+
+    auto LU = Kokkos::subview(F, Kokkos::ALL, Kokkos::make_pair(0, n));
+
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(member, n), [&](const int &i) {
+      const int p = piv(i);
+      for (int r = 0; r < nrhs; ++r)
+        GesvEntry(X, i, r) = F(p, n) * GesvEntry(Y, p, r);
+    });
+    member.team_barrier();
+
+    int r_val = TeamTrsm<MemberType, Side::Left, Uplo::Lower,
+                         Trans::NoTranspose, Diag::Unit,
+                         Algo::Level3::Unblocked>::invoke(member, 1.0, LU, X);
+    member.team_barrier();
+
+    if (r_val == 0) {
+      r_val = TeamTrsm<MemberType, Side::Left, Uplo::Upper, Trans::NoTranspose,
+                       Diag::NonUnit,
+                       Algo::Level3::Unblocked>::invoke(member, 1.0, LU, X);
+      member.team_barrier();
+    }
+
+    if (r_val == 0) {
+      Kokkos::parallel_for(
+          Kokkos::TeamThreadRange(member, n), [&](const int &i) {
+            for (int r = 0; r < nrhs; ++r) GesvEntry(X, i, r) *= F(i, n + 1);
+          });
+      member.team_barrier();
+    }
+
+    return r_val;
+  }
+};
+
+template <typename MemberType>
+struct TeamGesvSolve<MemberType, Gesv::NoPivoting> {
+  template <typename FactorType, typename PivotType, typename XViewType,
+            typename YViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const FactorType F,
+                                           const PivotType /*piv*/,
+                                           const XViewType X,
+                                           const YViewType Y) {
+#if (KOKKOSKERNELS_DEBUG_LEVEL > 0)
+    if (checkGesvSolveInput(F, X, Y)) return 1;
+#endif
+    const int n = F.extent(0);
+
+    auto LU = Kokkos::subview(F, Kokkos::ALL, Kokkos::make_pair(0, n));
+
+    int r_val =
+        TeamCopy<MemberType, Trans::NoTranspose, XViewType::rank>::invoke(
+            member, Y, X);
+    member.team_barrier();
+
+    if (r_val == 0) {
+      r_val = TeamTrsm<MemberType, Side::Left, Uplo::Lower, Trans::NoTranspose,
+                       Diag::Unit,
+                       Algo::Level3::Unblocked>::invoke(member, 1.0, LU, X);
+      member.team_barrier();
+    }
+
+    if (r_val == 0) {
+      r_val = TeamTrsm<MemberType, Side::Left, Uplo::Upper, Trans::NoTranspose,
+                       Diag::NonUnit,
+                       Algo::Level3::Unblocked>::invoke(member, 1.0, LU, X);
+      member.team_barrier();
+    }
+
+    return r_val;
+  }
+};
+
+///
+/// TeamVector Impl
+/// ===============
+template <typename MemberType>
+struct TeamVectorGesvFactorize<MemberType, Gesv::StaticPivoting> {
+  template <typename MatrixType, typename FactorType, typename PivotType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const MatrixType A,
+                                           const FactorType F,
+                                           const PivotType piv) {
+    using value_type = typename FactorType::non_const_value_type;
+#if (KOKKOSKERNELS_DEBUG_LEVEL > 0)
+    if (checkGesvFactorizeInput(A, F, 2)) return 1;
+#endif
+    using ScratchPadMatrixViewType = Kokkos::View<
+        value_type **,
+        typename FactorType::execution_space::scratch_memory_space>;
+
+    const int n = A.extent(0);
+
+    ScratchPadMatrixViewType tmp(member.team_scratch(0), n, 4);
+    auto PDAD    = Kokkos::subview(F, Kokkos::ALL, Kokkos::make_pair(0, n));
+    auto D1      = Kokkos::subview(F, Kokkos::ALL, n);
+    auto PDY     = Kokkos::subview(tmp, Kokkos::ALL, 0);
+    auto D2      = Kokkos::subview(tmp, Kokkos::ALL, 1);
+    auto tmp_v_1 = Kokkos::subview(tmp, Kokkos::ALL, 2);
+    auto tmp_v_2 = Kokkos::subview(tmp, Kokkos::ALL, 3);
+
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(member, n), [&](const int &i) {
+      D1(i) = Kokkos::ArithTraits<value_type>::one();
+    });
+    member.team_barrier();
+
+    if (TeamVectorStaticPivoting<MemberType>::invoke(
+            member, A, PDAD, D1, PDY, D2, tmp_v_1, tmp_v_2, piv) == 1) {
+#if KOKKOS_VERSION < 40199
+      KOKKOS_IMPL_DO_NOT_USE_PRINTF(
+          "KokkosBatched::gesv: the currently implemented static pivoting "
+          "failed.\n");
+#else
+      Kokkos::printf(
+          "KokkosBatched::gesv: the currently implemented static pivoting "
+          "failed.\n");
+#endif
+      return 1;
+    }
+    member.team_barrier();
+
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(member, n),
+                         [&](const int &i) { F(i, n + 1) = D2(i); });
+
+    int r_val =
+        TeamLU<MemberType, Algo::Level3::Unblocked>::invoke(member, PDAD);
+    member.team_barrier();
+
+    return r_val;
+  }
+};
+
+template <typename MemberType>
+struct TeamVectorGesvFactorize<MemberType, Gesv::NoPivoting> {
+  template <typename MatrixType, typename FactorType, typename PivotType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const MatrixType A,
+                                           const FactorType F,
+                                           const PivotType /*piv*/) {
+#if (KOKKOSKERNELS_DEBUG_LEVEL > 0)
+    if (checkGesvFactorizeInput(A, F, 0)) return 1;
+#endif
+    const int n = A.extent(0);
+
+    auto LU = Kokkos::subview(F, Kokkos::ALL, Kokkos::make_pair(0, n));
+    if (LU.data() != A.data()) {
+      TeamVectorCopy<MemberType, Trans::NoTranspose, 2>::invoke(member, A, LU);
+      member.team_barrier();
+    }
+
+    int r_val = TeamLU<MemberType, Algo::Level3::Unblocked>::invoke(member, LU);
+    member.team_barrier();
+
+    return r_val;
+  }
+};
+
+template <typename MemberType>
+struct TeamVectorGesvSolve<MemberType, Gesv::StaticPivoting> {
+  template <typename FactorType, typename PivotType, typename XViewType,
+            typename YViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const FactorType F,
+                                           const PivotType piv,
+                                           const XViewType X,
+                                           const YViewType Y) {
+#if (KOKKOSKERNELS_DEBUG_LEVEL > 0)
+    if (checkGesvSolveInput(F, X, Y)) return 1;
+#endif
+    const int n    = F.extent(0);
+    const int nrhs = GesvNumRhs(X);
+
+    auto LU = Kokkos::subview(F, Kokkos::ALL, Kokkos::make_pair(0, n));
+
+    Kokkos::parallel_for(
+        Kokkos::TeamVectorRange(member, n * nrhs), [&](const int &k) {
+          const int i = k / nrhs, r = k % nrhs;
+          const int p = piv(i);
+          GesvEntry(X, i, r) = F(p, n) * GesvEntry(Y, p, r);
+        });
+    member.team_barrier();
+
+    int r_val =
+        TeamVectorTrsm<MemberType, Side::Left, Uplo::Lower, Trans::NoTranspose,
+                       Diag::Unit,
+                       Algo::Level3::Unblocked>::invoke(member, 1.0, LU, X);
+    member.team_barrier();
+
+    if (r_val == 0) {
+      r_val = TeamVectorTrsm<MemberType, Side::Left, Uplo::Upper,
+                             Trans::NoTranspose, Diag::NonUnit,
+                             Algo::Level3::Unblocked>::invoke(member, 1.0, LU,
+                                                              X);
+      member.team_barrier();
+    }
+
+    if (r_val == 0) {
+      Kokkos::parallel_for(
+          Kokkos::TeamVectorRange(member, n * nrhs), [&](const int &k) {
+            const int i = k / nrhs, r = k % nrhs;
+            GesvEntry(X, i, r) *= F(i, n + 1);
+          });
+      member.team_barrier();
+    }
+
+    return r_val;
+  }
+};
+
+template <typename MemberType>
+struct TeamVectorGesvSolve<MemberType, Gesv::NoPivoting> {
+  template <typename FactorType, typename PivotType, typename XViewType,
+            typename YViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const FactorType F,
+                                           const PivotType /*piv*/,
+                                           const XViewType X,
+                                           const YViewType Y) {
+#if (KOKKOSKERNELS_DEBUG_LEVEL > 0)
+    if (checkGesvSolveInput(F, X, Y)) return 1;
+#endif
+    const int n = F.extent(0);
+
+    auto LU = Kokkos::subview(F, Kokkos::ALL, Kokkos::make_pair(0, n));
+
+    int r_val =
+        TeamVectorCopy<MemberType, Trans::NoTranspose, XViewType::rank>::invoke(
+            member, Y, X);
+    member.team_barrier();
+
+    if (r_val == 0) {
+      r_val = TeamVectorTrsm<MemberType, Side::Left, Uplo::Lower,
+                             Trans::NoTranspose, Diag::Unit,
+                             Algo::Level3::Unblocked>::invoke(member, 1.0, LU,
+                                                              X);
+      member.team_barrier();
+    }
+
+    if (r_val == 0) {
+      r_val = TeamVectorTrsm<MemberType, Side::Left, Uplo::Upper,
+                             Trans::NoTranspose, Diag::NonUnit,
+                             Algo::Level3::Unblocked>::invoke(member, 1.0, LU,
+                                                              X);
+      member.team_barrier();
+    }
+
+    return r_val;
+  }
+};
+
+}  // namespace KokkosBatched
+
+#endif
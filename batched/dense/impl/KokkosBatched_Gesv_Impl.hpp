@@ -22,44 +22,80 @@
 #include <KokkosBatched_LU_Decl.hpp>
 #include "KokkosBatched_Trsm_Decl.hpp"
 #include "KokkosBatched_Copy_Decl.hpp"
+#include "KokkosBatched_FixedSize_Serial_Internal.hpp"
 
 namespace KokkosBatched {
 
+/// The static pivoting scales A to D1 A D2 and moves its rows to PDAD, and
+/// applies the same row scaling and permutation to Y in PDY. If piv is not
+/// empty, piv(i) is set to the row of A moved to row i of PDAD.
 struct SerialStaticPivoting {
+  template <class MatrixType1, class MatrixType2, class VectorType1,
+            class VectorType2, class PivotType>
+  KOKKOS_INLINE_FUNCTION static int invoke(
+      const MatrixType1 A, const MatrixType2 PDAD, const VectorType1 Y,
+      const VectorType2 PDY, const VectorType2 D2, const VectorType2 tmp_v_1,
+      const VectorType2 tmp_v_2, const PivotType piv);
+
   template <class MatrixType1, class MatrixType2, class VectorType1,
             class VectorType2>
   KOKKOS_INLINE_FUNCTION static int invoke(
       const MatrixType1 A, const MatrixType2 PDAD, const VectorType1 Y,
       const VectorType2 PDY, const VectorType2 D2, const VectorType2 tmp_v_1,
-      const VectorType2 tmp_v_2);
+      const VectorType2 tmp_v_2) {
+    return invoke(A, PDAD, Y, PDY, D2, tmp_v_1, tmp_v_2,
+                  Kokkos::View<int *, Kokkos::AnonymousSpace>());
+  }
 };
 
 template <typename MemberType>
 struct TeamStaticPivoting {
+  template <class MatrixType1, class MatrixType2, class VectorType1,
+            class VectorType2, class PivotType>
+  KOKKOS_INLINE_FUNCTION static int invoke(
+      const MemberType &member, const MatrixType1 A, const MatrixType2 PDAD,
+      const VectorType1 Y, const VectorType2 PDY, const VectorType2 D2,
+      const VectorType2 tmp_v_1, const VectorType2 tmp_v_2,
+      const PivotType piv);
+
   template <class MatrixType1, class MatrixType2, class VectorType1,
             class VectorType2>
   KOKKOS_INLINE_FUNCTION static int invoke(
       const MemberType &member, const MatrixType1 A, const MatrixType2 PDAD,
       const VectorType1 Y, const VectorType2 PDY, const VectorType2 D2,
-      const VectorType2 tmp_v_1, const VectorType2 tmp_v_2);
+      const VectorType2 tmp_v_1, const VectorType2 tmp_v_2) {
+    return invoke(member, A, PDAD, Y, PDY, D2, tmp_v_1, tmp_v_2,
+                  Kokkos::View<int *, Kokkos::AnonymousSpace>());
+  }
 };
 
 template <typename MemberType>
 struct TeamVectorStaticPivoting {
+  template <class MatrixType1, class MatrixType2, class VectorType1,
+            class VectorType2, class PivotType>
+  KOKKOS_INLINE_FUNCTION static int invoke(
+      const MemberType &member, const MatrixType1 A, const MatrixType2 PDAD,
+      const VectorType1 Y, const VectorType2 PDY, const VectorType2 D2,
+      const VectorType2 tmp_v_1, const VectorType2 tmp_v_2,
+      const PivotType piv);
+
   template <class MatrixType1, class MatrixType2, class VectorType1,
             class VectorType2>
   KOKKOS_INLINE_FUNCTION static int invoke(
       const MemberType &member, const MatrixType1 A, const MatrixType2 PDAD,
       const VectorType1 Y, const VectorType2 PDY, const VectorType2 D2,
-      const VectorType2 tmp_v_1, const VectorType2 tmp_v_2);
+      const VectorType2 tmp_v_1, const VectorType2 tmp_v_2) {
+    return invoke(member, A, PDAD, Y, PDY, D2, tmp_v_1, tmp_v_2,
+                  Kokkos::View<int *, Kokkos::AnonymousSpace>());
+  }
 };
 
 template <class MatrixType1, class MatrixType2, class VectorType1,
-          class VectorType2>
+          class VectorType2, class PivotType>
 KOKKOS_INLINE_FUNCTION int SerialStaticPivoting::invoke(
     const MatrixType1 A, const MatrixType2 PDAD, const VectorType1 Y,
     const VectorType2 PDY, const VectorType2 D2, const VectorType2 tmp_v_1,
-    const VectorType2 tmp_v_2) {
+    const VectorType2 tmp_v_2, const PivotType piv) {
   using value_type = typename MatrixType1::non_const_value_type;
   const size_t n   = A.extent(0);
 
@@ -133,6 +169,7 @@ KOKKOS_INLINE_FUNCTION int SerialStaticPivoting::invoke(
       PDAD(col_index, j) = A(row_index, j);
     }
     PDY(col_index) = Y(row_index);
+    if (piv.extent(0) > 0) piv(col_index) = row_index;
   }
 
   return 0;
@@ -140,11 +177,12 @@ KOKKOS_INLINE_FUNCTION int SerialStaticPivoting::invoke(
 
 template <typename MemberType>
 template <class MatrixType1, class MatrixType2, class VectorType1,
-          class VectorType2>
+          class VectorType2, class PivotType>
 KOKKOS_INLINE_FUNCTION int TeamStaticPivoting<MemberType>::invoke(
     const MemberType &member, const MatrixType1 A, const MatrixType2 PDAD,
     const VectorType1 Y, const VectorType2 PDY, const VectorType2 D2,
-    const VectorType2 tmp_v_1, const VectorType2 tmp_v_2) {
+    const VectorType2 tmp_v_1, const VectorType2 tmp_v_2,
+    const PivotType piv) {
   using value_type = typename MatrixType1::non_const_value_type;
   using reducer_value_type =
       typename Kokkos::MaxLoc<value_type, int>::value_type;
@@ -217,17 +255,19 @@ KOKKOS_INLINE_FUNCTION int TeamStaticPivoting<MemberType>::invoke(
       PDAD(col_index, j) = A(row_index, j);
     }
     PDY(col_index) = Y(row_index);
+    if (piv.extent(0) > 0) piv(col_index) = row_index;
   }
   return 0;
 }
 
 template <typename MemberType>
 template <class MatrixType1, class MatrixType2, class VectorType1,
-          class VectorType2>
+          class VectorType2, class PivotType>
 KOKKOS_INLINE_FUNCTION int TeamVectorStaticPivoting<MemberType>::invoke(
     const MemberType &member, const MatrixType1 A, const MatrixType2 PDAD,
     const VectorType1 Y, const VectorType2 PDY, const VectorType2 D2,
-    const VectorType2 tmp_v_1, const VectorType2 tmp_v_2) {
+    const VectorType2 tmp_v_1, const VectorType2 tmp_v_2,
+    const PivotType piv) {
   using value_type = typename MatrixType1::non_const_value_type;
   using reducer_value_type =
       typename Kokkos::MaxLoc<value_type, int>::value_type;
@@ -322,6 +362,7 @@ KOKKOS_INLINE_FUNCTION int TeamVectorStaticPivoting<MemberType>::invoke(
       PDAD(col_index, j) = A(row_index, j);
     });
     PDY(col_index) = Y(row_index);
+    if (piv.extent(0) > 0) piv(col_index) = row_index;
   }
   return 0;
 }
@@ -506,6 +547,11 @@ struct SerialGesv<Gesv::NoPivoting> {
     }
 #endif
 
+    if constexpr (is_fixed_size_v<MatrixType, XVectorType, YVectorType>)
+      return SerialGesvInternalFixed<MatrixType::static_extent(0)>::invoke(
+          A.data(), A.stride_0(), A.stride_1(), X.data(), X.stride_0(),
+          Y.data(), Y.stride_0());
+
     int r_val = SerialLU<Algo::Level3::Unblocked>::invoke(A);
 
     if (r_val == 0) r_val = SerialCopy<Trans::NoTranspose, 1>::invoke(Y, X);
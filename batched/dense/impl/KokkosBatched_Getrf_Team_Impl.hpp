@@ -0,0 +1,52 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_GETRF_TEAM_IMPL_HPP__
+#define __KOKKOSBATCHED_GETRF_TEAM_IMPL_HPP__
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Getrf_Team_Internal.hpp"
+
+namespace KokkosBatched {
+
+///
+/// Team Impl
+/// =========
+
+template <typename MemberType, typename ArgAlgo>
+template <typename AViewType, typename PivViewType>
+KOKKOS_INLINE_FUNCTION int TeamGetrf<MemberType, ArgAlgo>::invoke(
+    const MemberType &member, const AViewType &A, const PivViewType &piv) {
+  return TeamGetrfInternal<Mode::Team>::invoke(
+      member, A.extent(0), A.extent(1), A.data(), A.stride_0(), A.stride_1(),
+      piv.data(), piv.stride_0());
+}
+
+///
+/// TeamVector Impl
+/// ===============
+
+template <typename MemberType, typename ArgAlgo>
+template <typename AViewType, typename PivViewType>
+KOKKOS_INLINE_FUNCTION int TeamVectorGetrf<MemberType, ArgAlgo>::invoke(
+    const MemberType &member, const AViewType &A, const PivViewType &piv) {
+  return TeamGetrfInternal<Mode::TeamVector>::invoke(
+      member, A.extent(0), A.extent(1), A.data(), A.stride_0(), A.stride_1(),
+      piv.data(), piv.stride_0());
+}
+
+}  // namespace KokkosBatched
+
+#endif
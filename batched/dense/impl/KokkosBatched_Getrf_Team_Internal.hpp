@@ -0,0 +1,130 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_GETRF_TEAM_INTERNAL_HPP__
+#define __KOKKOSBATCHED_GETRF_TEAM_INTERNAL_HPP__
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+
+namespace KokkosBatched {
+
+///
+/// Team and TeamVector Internal Impl
+/// =================================
+///
+/// ArgMode is Mode::Team (TeamThreadRange) or Mode::TeamVector
+/// (TeamVectorRange).
+
+template <typename ArgMode>
+struct TeamGetrfRange {
+  template <typename MemberType>
+  KOKKOS_INLINE_FUNCTION static auto get(const MemberType &member,
+                                         const int n) {
+    if constexpr (std::is_same<ArgMode, Mode::TeamVector>::value)
+      return Kokkos::TeamVectorRange(member, n);
+    else
+      return Kokkos::TeamThreadRange(member, n);
+  }
+};
+
+///
+/// LU factorization with partial pivoting, P * A = L * U, of an m x n matrix.
+/// piv[p * ps0] is the offset of the row swapped with row p (the convention of
+/// ApplyPivot). Returns 0 on success, or p + 1 if U(p, p) is exactly zero
+/// (for the first such p), in which case the factorization is completed but U
+/// is singular.
+///
+template <typename ArgMode>
+struct TeamGetrfInternal {
+  template <typename MemberType, typename ValueType, typename IntType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const int m, const int n,
+                                           ValueType *KOKKOS_RESTRICT A,
+                                           const int as0, const int as1,
+                                           IntType *KOKKOS_RESTRICT piv,
+                                           const int ps0) {
+    static_assert(!is_vector<ValueType>::value,
+                  "KokkosBatched::Getrf: Vector<SIMD<T>> is not supported, "
+                  "as each lane would need its own pivots");
+    using ats            = Kokkos::ArithTraits<ValueType>;
+    using mag_type       = typename ats::mag_type;
+    using reducer_type   = Kokkos::MaxLoc<mag_type, int>;
+    using range          = TeamGetrfRange<ArgMode>;
+    const ValueType zero = ats::zero();
+
+    const int k = (m < n ? m : n);
+    int info    = 0;
+    for (int p = 0; p < k; ++p) {
+      // Made this non-const in order to WORKAROUND issue #349
+      int iend = m - p - 1;
+      int jend = n - p - 1;
+
+      ValueType *KOKKOS_RESTRICT Ap = A + p * as0 + p * as1;
+
+      // the pivot search; the reduction is broadcast to all threads
+      member.team_barrier();
+      typename reducer_type::value_type amax;
+      Kokkos::parallel_reduce(
+          range::get(member, m - p),
+          [&](const int &i, typename reducer_type::value_type &update) {
+            const mag_type val = ats::abs(Ap[i * as0]);
+            if (val > update.val || (val == update.val && i < update.loc)) {
+              update.val = val;
+              update.loc = i;
+            }
+          },
+          reducer_type(amax));
+      const int ip = amax.loc;
+
+      // swap the whole rows p and p + ip
+      if (ip != 0) {
+        Kokkos::parallel_for(range::get(member, n), [&](const int &j) {
+          ValueType *KOKKOS_RESTRICT a = A + p * as0 + j * as1;
+          const ValueType tmp          = a[0];
+          a[0]                         = a[ip * as0];
+          a[ip * as0]                  = tmp;
+        });
+      }
+      Kokkos::single(Kokkos::PerTeam(member), [&]() { piv[p * ps0] = ip; });
+      member.team_barrier();
+
+      const ValueType alpha11 = Ap[0];
+      if (alpha11 == zero) {
+        if (info == 0) info = p + 1;
+        continue;
+      }
+
+      ValueType *KOKKOS_RESTRICT a21 = Ap + as0;
+      const ValueType *KOKKOS_RESTRICT a12t = Ap + as1;
+      ValueType *KOKKOS_RESTRICT A22        = Ap + as0 + as1;
+      Kokkos::parallel_for(range::get(member, iend),
+                           [&](const int &i) { a21[i * as0] /= alpha11; });
+      member.team_barrier();
+      Kokkos::parallel_for(
+          range::get(member, iend * jend), [&](const int &ij) {
+            // assume layout right for batched computation
+            const int i = ij / jend, j = ij % jend;
+            A22[i * as0 + j * as1] -= a21[i * as0] * a12t[j * as1];
+          });
+    }
+    member.team_barrier();
+    return info;
+  }
+};
+
+}  // namespace KokkosBatched
+
+#endif
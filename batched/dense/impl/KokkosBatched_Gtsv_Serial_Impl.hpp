@@ -0,0 +1,42 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_GTSV_SERIAL_IMPL_HPP__
+#define __KOKKOSBATCHED_GTSV_SERIAL_IMPL_HPP__
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Gtsv_Serial_Internal.hpp"
+
+namespace KokkosBatched {
+
+///
+/// Serial Impl
+/// ===========
+
+template <typename ArgAlgo>
+template <typename DLViewType, typename DViewType, typename DUViewType,
+          typename BViewType>
+KOKKOS_INLINE_FUNCTION int SerialGtsv<ArgAlgo>::invoke(const DLViewType &dl,
+                                                       const DViewType &d,
+                                                       const DUViewType &du,
+                                                       const BViewType &b) {
+  return SerialGtsvInternal::invoke(d.extent(0), dl.data(), dl.stride_0(),
+                                    d.data(), d.stride_0(), du.data(),
+                                    du.stride_0(), b.data(), b.stride_0());
+}
+
+}  // namespace KokkosBatched
+
+#endif
@@ -0,0 +1,131 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_GTSV_SERIAL_INTERNAL_HPP__
+#define __KOKKOSBATCHED_GTSV_SERIAL_INTERNAL_HPP__
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+
+namespace KokkosBatched {
+
+///
+/// Serial Internal Impl
+/// ====================
+///
+/// The Thomas algorithm, Gaussian elimination without pivoting, for the
+/// tridiagonal system with subdiagonal dl (n - 1), diagonal d (n) and
+/// superdiagonal du (n - 1). On exit dl holds the multipliers, d the diagonal
+/// of U and b the solution. Returns 0 on success, or i + 1 if the i-th pivot
+/// is exactly zero; the pivots are not checked for vector types.
+///
+struct SerialGtsvInternal {
+  template <typename ValueType>
+  KOKKOS_INLINE_FUNCTION static int invoke(
+      const int n, ValueType *KOKKOS_RESTRICT dl, const int dls0,
+      ValueType *KOKKOS_RESTRICT d, const int ds0,
+      const ValueType *KOKKOS_RESTRICT du, const int dus0,
+      ValueType *KOKKOS_RESTRICT b, const int bs0) {
+    using ats = Kokkos::ArithTraits<ValueType>;
+    if (n <= 0) return 0;
+
+    auto is_zero = [](const ValueType &v) -> bool {
+      if constexpr (is_vector<ValueType>::value)
+        return false;
+      else
+        return v == ats::zero();
+    };
+
+    for (int i = 1; i < n; ++i) {
+      const ValueType piv = d[(i - 1) * ds0];
+      if (is_zero(piv)) return i;
+      const ValueType w = dl[(i - 1) * dls0] / piv;
+      dl[(i - 1) * dls0] = w;
+      d[i * ds0] -= w * du[(i - 1) * dus0];
+      b[i * bs0] -= w * b[(i - 1) * bs0];
+    }
+    if (is_zero(d[(n - 1) * ds0])) return n;
+
+    b[(n - 1) * bs0] /= d[(n - 1) * ds0];
+    for (int i = n - 2; i >= 0; --i)
+      b[i * bs0] = (b[i * bs0] - du[i * dus0] * b[(i + 1) * bs0]) / d[i * ds0];
+    return 0;
+  }
+};
+
+///
+/// Gaussian elimination without pivoting for the pentadiagonal system with
+/// second subdiagonal e (n - 2), subdiagonal dl (n - 1), diagonal d (n),
+/// superdiagonal du (n - 1) and second superdiagonal f (n - 2). There is no
+/// fill-in, so e, dl, d and du are overwritten in place and b by the
+/// solution. Returns as SerialGtsvInternal.
+///
+struct SerialGpsvInternal {
+  template <typename ValueType>
+  KOKKOS_INLINE_FUNCTION static int invoke(
+      const int n, ValueType *KOKKOS_RESTRICT e, const int es0,
+      ValueType *KOKKOS_RESTRICT dl, const int dls0,
+      ValueType *KOKKOS_RESTRICT d, const int ds0,
+      ValueType *KOKKOS_RESTRICT du, const int dus0,
+      const ValueType *KOKKOS_RESTRICT f, const int fs0,
+      ValueType *KOKKOS_RESTRICT b, const int bs0) {
+    using ats = Kokkos::ArithTraits<ValueType>;
+    if (n <= 0) return 0;
+
+    auto is_zero = [](const ValueType &v) -> bool {
+      if constexpr (is_vector<ValueType>::value)
+        return false;
+      else
+        return v == ats::zero();
+    };
+
+    for (int k = 0; k < n - 1; ++k) {
+      const ValueType piv = d[k * ds0];
+      if (is_zero(piv)) return k + 1;
+      // row k + 1
+      {
+        const ValueType w = dl[k * dls0] / piv;
+        dl[k * dls0]      = w;
+        d[(k + 1) * ds0] -= w * du[k * dus0];
+        if (k + 2 < n) du[(k + 1) * dus0] -= w * f[k * fs0];
+        b[(k + 1) * bs0] -= w * b[k * bs0];
+      }
+      // row k + 2
+      if (k + 2 < n) {
+        const ValueType w = e[k * es0] / piv;
+        e[k * es0]        = w;
+        dl[(k + 1) * dls0] -= w * du[k * dus0];
+        d[(k + 2) * ds0] -= w * f[k * fs0];
+        b[(k + 2) * bs0] -= w * b[k * bs0];
+      }
+    }
+    if (is_zero(d[(n - 1) * ds0])) return n;
+
+    b[(n - 1) * bs0] /= d[(n - 1) * ds0];
+    if (n >= 2)
+      b[(n - 2) * bs0] =
+          (b[(n - 2) * bs0] - du[(n - 2) * dus0] * b[(n - 1) * bs0]) /
+          d[(n - 2) * ds0];
+    for (int i = n - 3; i >= 0; --i)
+      b[i * bs0] = (b[i * bs0] - du[i * dus0] * b[(i + 1) * bs0] -
+                    f[i * fs0] * b[(i + 2) * bs0]) /
+                   d[i * ds0];
+    return 0;
+  }
+};
+
+}  // namespace KokkosBatched
+
+#endif
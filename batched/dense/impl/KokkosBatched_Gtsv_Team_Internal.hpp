@@ -0,0 +1,108 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_GTSV_TEAM_INTERNAL_HPP__
+#define __KOKKOSBATCHED_GTSV_TEAM_INTERNAL_HPP__
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+
+namespace KokkosBatched {
+
+///
+/// Team and TeamVector Internal Impl
+/// =================================
+///
+/// Cyclic reduction for the tridiagonal system with subdiagonal dl (n - 1),
+/// diagonal d (n) and superdiagonal du (n - 1); dl, d, du and b are
+/// overwritten, b by the solution. There is no pivoting, so the system should
+/// be diagonally dominant or symmetric positive definite.
+///
+/// At stride s the equations i = 2s - 1, 4s - 1, ... eliminate their
+/// neighbors i - s and i + s, which are not written at that level, so the
+/// reduction is done in place with a barrier per level; the back substitution
+/// then solves the equations i = s - 1, 3s - 1, ... for s going down. The
+/// ArgMode selects TeamThreadRange (Mode::Team) or TeamVectorRange
+/// (Mode::TeamVector) over the equations of a level.
+///
+template <typename ArgMode>
+struct TeamGtsvInternal {
+  template <typename MemberType>
+  KOKKOS_INLINE_FUNCTION static auto range(const MemberType &member,
+                                           const int n) {
+    if constexpr (std::is_same<ArgMode, Mode::TeamVector>::value)
+      return Kokkos::TeamVectorRange(member, n);
+    else
+      return Kokkos::TeamThreadRange(member, n);
+  }
+
+  template <typename MemberType, typename ValueType>
+  KOKKOS_INLINE_FUNCTION static int invoke(
+      const MemberType &member, const int n, ValueType *KOKKOS_RESTRICT dl,
+      const int dls0, ValueType *KOKKOS_RESTRICT d, const int ds0,
+      ValueType *KOKKOS_RESTRICT du, const int dus0,
+      ValueType *KOKKOS_RESTRICT b, const int bs0) {
+    const ValueType zero(0);
+    if (n <= 0) return 0;
+
+    // the coupling of equation i to x(i - s) and x(i + s); both vanish
+    // outside of the system
+    auto a_at = [&](const int i) -> ValueType & { return dl[(i - 1) * dls0]; };
+    auto c_at = [&](const int i) -> ValueType & { return du[i * dus0]; };
+
+    int s = 1;
+    for (; 2 * s <= n; s *= 2) {
+      const int cnt = n / (2 * s);
+      Kokkos::parallel_for(range(member, cnt), [&](const int &l) {
+        const int i       = 2 * s * l + 2 * s - 1;
+        const bool has_up = i + s < n;
+        const ValueType k1 = a_at(i) / d[(i - s) * ds0];
+        const ValueType k2 = has_up ? c_at(i) / d[(i + s) * ds0] : zero;
+        // the first equation, i - s = 0, has no coupling to the left
+        const ValueType am = i - s > 0 ? a_at(i - s) : zero;
+        const ValueType cm = c_at(i - s);
+        d[i * ds0] -= cm * k1 + (has_up ? a_at(i + s) * k2 : zero);
+        b[i * bs0] -= b[(i - s) * bs0] * k1 +
+                      (has_up ? b[(i + s) * bs0] * k2 : zero);
+        a_at(i) = -am * k1;
+        if (i < n - 1)
+          c_at(i) = (has_up && i + s < n - 1) ? -c_at(i + s) * k2 : zero;
+      });
+      member.team_barrier();
+    }
+
+    // the top equation s - 1 has no neighbors left
+    Kokkos::single(Kokkos::PerTeam(member),
+                   [&]() { b[(s - 1) * bs0] /= d[(s - 1) * ds0]; });
+    member.team_barrier();
+
+    for (s /= 2; s >= 1; s /= 2) {
+      const int cnt = (n + s) / (2 * s);
+      Kokkos::parallel_for(range(member, cnt), [&](const int &l) {
+        const int i   = 2 * s * l + s - 1;
+        ValueType rhs = b[i * bs0];
+        if (i - s >= 0) rhs -= a_at(i) * b[(i - s) * bs0];
+        if (i + s < n) rhs -= c_at(i) * b[(i + s) * bs0];
+        b[i * bs0] = rhs / d[i * ds0];
+      });
+      member.team_barrier();
+    }
+    return 0;
+  }
+};
+
+}  // namespace KokkosBatched
+
+#endif
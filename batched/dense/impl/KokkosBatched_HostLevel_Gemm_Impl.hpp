@@ -15,7 +15,9 @@
 //@HEADER
 #ifndef __KOKKOSBATCHED_HOSTLEVEL_GEMM_IMPL_HPP__
 #define __KOKKOSBATCHED_HOSTLEVEL_GEMM_IMPL_HPP__
+#include <vector>
 #include <Kokkos_Core.hpp>
+#include <Kokkos_Timer.hpp>
 #include <KokkosBatched_Util.hpp>  // Trans, BatchLayout
 #include <KokkosKernels_ExecSpaceUtils.hpp>
 #include <KokkosKernels_Error.hpp>
@@ -62,6 +64,14 @@ constexpr KOKKOS_INLINE_FUNCTION size_t kk_gemm_dbl_buf_alpha_in_fma_thresh() {
 #endif  // __CUDAACC_RDC__
 }
 
+template <typename ArgTransA, typename ArgTransB, typename ArgBatchSzDim,
+          typename BatchedGemmHandleType, typename ScalarType,
+          typename AViewType, typename BViewType, typename CViewType>
+int BatchedGemmAutotune(BatchedGemmHandleType *const handle,
+                        const ScalarType alpha, const AViewType &A,
+                        const BViewType &B, const ScalarType beta,
+                        const CViewType &C);
+
 template <typename ArgTransA, typename ArgTransB, typename ArgBatchSzDim,
           typename BatchedGemmHandleType, typename ScalarType,
           typename AViewType, typename BViewType, typename CViewType>
@@ -258,6 +268,14 @@ int BatchedGemmImpl(BatchedGemmHandleType *const handle, const ScalarType alpha,
       //    case BaseHeuristicAlgos::TALL:
       //
       //    case BaseHeuristicAlgos::WIDE:
+
+    case GemmHeuristicAlgos::AUTOTUNE:
+      ret = Impl::BatchedGemmAutotune<ArgTransA, ArgTransB, ArgBatchSzDim,
+                                      BatchedGemmHandleType, ScalarType,
+                                      AViewType, BViewType, CViewType>(
+          handle, alpha, A, B, beta, C);
+      break;
+
       ////////////// TPL ALGOS //////////////
 #if defined(KOKKOSKERNELS_ENABLE_TPL_ARMPL) && ARMPL_BUILD >= 1058
     case BaseTplAlgos::ARMPL:
@@ -325,6 +343,125 @@ int BatchedGemmImpl(BatchedGemmHandleType *const handle, const ScalarType alpha,
   }
   return ret;
 }
+
+template <typename ArgTransA, typename ArgTransB, typename ArgBatchSzDim,
+          typename ScalarType, typename AViewType, typename CViewType>
+std::string batched_gemm_autotune_key(const AViewType &A, const CViewType &C) {
+  using layout_type = typename CViewType::array_layout;
+  using exec_space  = typename CViewType::execution_space;
+  constexpr bool batch_left =
+      std::is_same<ArgBatchSzDim, BatchLayout::Left>::value;
+  constexpr bool a_trans = std::is_same<ArgTransA, Trans::Transpose>::value;
+  const size_t m = batch_left ? C.extent(1) : C.extent(0);
+  const size_t n = batch_left ? C.extent(2) : C.extent(1);
+  const size_t b = batch_left ? C.extent(0) : C.extent(2);
+  const size_t k = batch_left ? A.extent(a_trans ? 1 : 2)
+                              : A.extent(a_trans ? 0 : 1);
+  std::string scalar =
+      Kokkos::ArithTraits<typename CViewType::non_const_value_type>::name();
+  for (auto &c : scalar)
+    if (c == ' ') c = '_';
+
+  std::ostringstream os;
+  os << m << "x" << n << "x" << k << "x" << b << ","
+     << (a_trans ? "T" : "N")
+     << (std::is_same<ArgTransB, Trans::Transpose>::value ? "T" : "N") << ","
+     << (batch_left ? "BatchLeft" : "BatchRight") << ","
+     << (std::is_same<layout_type, Kokkos::LayoutLeft>::value
+             ? "LayoutLeft"
+             : std::is_same<layout_type, Kokkos::LayoutRight>::value
+                   ? "LayoutRight"
+                   : "LayoutStride")
+     << "," << scalar << "," << exec_space::name();
+  return os.str();
+}
+
+/// \brief GemmHeuristicAlgos::AUTOTUNE: on the first call for a problem key,
+/// times every candidate algorithm on a copy of C and records the fastest in
+/// BatchedGemmAutotuneDatabase; then invokes the recorded algorithm on C.
+template <typename ArgTransA, typename ArgTransB, typename ArgBatchSzDim,
+          typename BatchedGemmHandleType, typename ScalarType,
+          typename AViewType, typename BViewType, typename CViewType>
+int BatchedGemmAutotune(BatchedGemmHandleType *const handle,
+                        const ScalarType alpha, const AViewType &A,
+                        const BViewType &B, const ScalarType beta,
+                        const CViewType &C) {
+  using exec_space = typename CViewType::execution_space;
+  using work_view_type =
+      Kokkos::View<typename CViewType::non_const_data_type,
+                   typename CViewType::array_layout,
+                   typename CViewType::device_type>;
+  constexpr bool on_gpu =
+      KokkosKernels::Impl::kk_is_gpu_exec_space<exec_space>();
+  constexpr bool batch_left =
+      std::is_same<ArgBatchSzDim, BatchLayout::Left>::value;
+  constexpr int n_reps = 3;
+
+  auto invoke = [&](const int algo_type, const CViewType &C_) {
+    BatchedGemmHandleType trial(algo_type, handle->teamSz, handle->vecLen);
+    trial.enableDebug = handle->enableDebug;
+    return BatchedGemmImpl<ArgTransA, ArgTransB, ArgBatchSzDim,
+                           BatchedGemmHandleType, ScalarType, AViewType,
+                           BViewType, CViewType>(&trial, alpha, A, B, beta,
+                                                 C_);
+  };
+
+  auto &database = BatchedGemmAutotuneDatabase::instance();
+  const std::string key =
+      batched_gemm_autotune_key<ArgTransA, ArgTransB, ArgBatchSzDim,
+                                ScalarType>(A, C);
+  int best_algo_type = -1;
+  if (database.find(key, best_algo_type)) return invoke(best_algo_type, C);
+
+  std::vector<int> candidates = {BaseKokkosBatchedAlgos::KK_SERIAL,
+                                 GemmKokkosBatchedAlgos::KK_SERIAL_RANK0};
+  if ((batch_left ? C.extent(1) == C.extent(2) : C.extent(0) == C.extent(1)))
+    candidates.push_back(BaseHeuristicAlgos::SQUARE);
+  if (on_gpu) candidates.push_back(GemmKokkosBatchedAlgos::KK_DBLBUF);
+#if defined(KOKKOSKERNELS_ENABLE_TPL_ARMPL) && ARMPL_BUILD >= 1058
+  candidates.push_back(BaseTplAlgos::ARMPL);
+#endif  // KOKKOSKERNELS_ENABLE_TPL_ARMPL
+
+  // C is overwritten by every trial, so each one runs on a fresh copy of it
+  work_view_type C_work(Kokkos::view_alloc(Kokkos::WithoutInitializing,
+                                           "BatchedGemmAutotune::C"),
+                        C.layout());
+  const CViewType C_trial(C_work.data(), C.layout());
+  double best_time = 0;
+  for (const int algo_type : candidates) {
+    double time = 0;
+    try {
+      for (int rep = 0; rep <= n_reps; ++rep) {
+        Kokkos::deep_copy(C_trial, C);
+        Kokkos::fence();
+        Kokkos::Timer timer;
+        invoke(algo_type, C_trial);
+        Kokkos::fence();
+        // the first run is a warm-up, the others keep the best time
+        const double t = timer.seconds();
+        if (rep == 1 || (rep > 1 && t < time)) time = t;
+      }
+    } catch (const std::runtime_error &) {
+      // the candidate does not support this problem
+      continue;
+    }
+    if (handle->enableDebug)
+      std::cout << "BatchedGemmAutotune: " << key << ": algo_type "
+                << algo_type << ": " << time << " s" << std::endl;
+    if (best_algo_type < 0 || time < best_time) {
+      best_algo_type = algo_type;
+      best_time      = time;
+    }
+  }
+  if (best_algo_type < 0) {
+    std::ostringstream os;
+    os << "KokkosBatched::BatchedGemm: no algorithm supports " << key
+       << " for kernelAlgoType = GemmHeuristicAlgos::AUTOTUNE." << std::endl;
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+  database.insert(key, best_algo_type);
+  return invoke(best_algo_type, C);
+}
 }  // namespace Impl
 }  // namespace KokkosBatched
 #endif  // __KOKKOSBATCHED_HOSTLEVEL_GEMM_IMPL_HPP__
@@ -0,0 +1,109 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_HOSTLEVEL_VARSIZE_IMPL_HPP__
+#define __KOKKOSBATCHED_HOSTLEVEL_VARSIZE_IMPL_HPP__
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Gemm_TeamVector_Internal.hpp"
+#include "KokkosBatched_LU_Team_Internal.hpp"
+
+namespace KokkosBatched {
+namespace Impl {
+
+/// Matrices of a variable-size batch are stored column major, one after
+/// another in a flat 1D view; matrix b starts at offsets(b) and its leading
+/// dimension is its number of rows. One team handles one matrix and teams
+/// are handed out in the order given by order(), largest first.
+
+template <typename ArgTransA, typename ArgTransB, typename ScalarType,
+          typename SizeViewType, typename OffsetViewType, typename AViewType,
+          typename BViewType, typename CViewType, typename OrderViewType>
+struct BatchedVarSizeGemmFunctor {
+  ScalarType _alpha, _beta;
+  SizeViewType _m, _n, _k;
+  AViewType _A;
+  BViewType _B;
+  CViewType _C;
+  OffsetViewType _a_offsets, _b_offsets, _c_offsets;
+  OrderViewType _order;
+
+  BatchedVarSizeGemmFunctor(const ScalarType alpha, const SizeViewType &m,
+                            const SizeViewType &n, const SizeViewType &k,
+                            const AViewType &A, const OffsetViewType &a_offsets,
+                            const BViewType &B, const OffsetViewType &b_offsets,
+                            const ScalarType beta, const CViewType &C,
+                            const OffsetViewType &c_offsets,
+                            const OrderViewType &order)
+      : _alpha(alpha),
+        _beta(beta),
+        _m(m),
+        _n(n),
+        _k(k),
+        _A(A),
+        _B(B),
+        _C(C),
+        _a_offsets(a_offsets),
+        _b_offsets(b_offsets),
+        _c_offsets(c_offsets),
+        _order(order) {}
+
+  template <typename MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType &member) const {
+    const int b = _order.extent(0) > 0 ? int(_order(member.league_rank()))
+                                       : member.league_rank();
+    const int m = _m(b), n = _n(b), k = _k(b);
+
+    // op(A) is m x k and op(B) is k x n; transposes swap the strides
+    const bool trans_a = std::is_same<ArgTransA, Trans::Transpose>::value;
+    const bool trans_b = std::is_same<ArgTransB, Trans::Transpose>::value;
+    const int lda = trans_a ? k : m, ldb = trans_b ? n : k;
+
+    TeamVectorGemmInternal<Algo::Gemm::Unblocked>::invoke(
+        member, m, n, k, _alpha, _A.data() + _a_offsets(b),
+        trans_a ? lda : 1, trans_a ? 1 : lda, _B.data() + _b_offsets(b),
+        trans_b ? ldb : 1, trans_b ? 1 : ldb, _beta,
+        _C.data() + _c_offsets(b), 1, m);
+  }
+};
+
+template <typename SizeViewType, typename OffsetViewType, typename AViewType,
+          typename OrderViewType, typename MagnitudeType>
+struct BatchedVarSizeLUFunctor {
+  SizeViewType _n;
+  AViewType _A;
+  OffsetViewType _a_offsets;
+  OrderViewType _order;
+  MagnitudeType _tiny;
+
+  BatchedVarSizeLUFunctor(const SizeViewType &n, const AViewType &A,
+                          const OffsetViewType &a_offsets,
+                          const OrderViewType &order, const MagnitudeType tiny)
+      : _n(n), _A(A), _a_offsets(a_offsets), _order(order), _tiny(tiny) {}
+
+  template <typename MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType &member) const {
+    const int b = _order.extent(0) > 0 ? int(_order(member.league_rank()))
+                                       : member.league_rank();
+    const int n = _n(b);
+    TeamLU_Internal<Algo::LU::Unblocked>::invoke(
+        member, n, n, _A.data() + _a_offsets(b), 1, n, _tiny);
+  }
+};
+
+}  // namespace Impl
+}  // namespace KokkosBatched
+
+#endif
@@ -0,0 +1,211 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_HOUSEHOLDER_WY_TEAMVECTOR_INTERNAL_HPP__
+#define __KOKKOSBATCHED_HOUSEHOLDER_WY_TEAMVECTOR_INTERNAL_HPP__
+
+#include "KokkosBatched_Util.hpp"
+
+namespace KokkosBatched {
+
+///
+/// TeamVector Internal Impl
+/// ========================
+///
+/// Compact WY representation of kb Householder reflectors,
+///   H0 H1 ... H(kb-1) = I - V T V^H,
+/// where H(l) = I - inv(tau(l)) v(l) v(l)^H as computed by
+/// TeamVectorLeftHouseholderInternal. V (m x kb) is unit lower trapezoidal
+/// and stored below the diagonal of A, as left by QR; T (kb x kb) is upper
+/// triangular. Applying the reflectors through T turns the rank-1 updates of
+/// the unblocked ApplyQ into small GEMMs, W = V^H B and B -= V (T W).
+///
+struct TeamVectorHouseholderWY_Internal {
+  /// the number of reflectors accumulated in one T
+  static constexpr int max_block_size = 8;
+
+  /// T (kb x kb, column major with leading dimension ldt); the strictly
+  /// lower part holds V^H V on exit
+  template <typename MemberType, typename ValueType>
+  KOKKOS_INLINE_FUNCTION static int form_t(
+      const MemberType &member, const int m, const int kb,
+      const ValueType *KOKKOS_RESTRICT A, const int as0, const int as1,
+      const ValueType *KOKKOS_RESTRICT tau, const int ts,
+      /* */ ValueType *KOKKOS_RESTRICT T, const int ldt) {
+    using ats = Kokkos::ArithTraits<ValueType>;
+
+    // (V^H V)(p, l) for p < l, stored at T(l, p)
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(member, kb * kb), [&](const int &pl) {
+          const int p = pl / kb, l = pl % kb;
+          if (p < l) {
+            ValueType z(0);
+            Kokkos::parallel_reduce(
+                Kokkos::ThreadVectorRange(member, l + 1, m),
+                [&](const int &i, ValueType &update) {
+                  update +=
+                      ats::conj(A[i * as0 + p * as1]) * A[i * as0 + l * as1];
+                },
+                z);
+            Kokkos::single(Kokkos::PerThread(member), [&]() {
+              T[l + p * ldt] = z + ats::conj(A[l * as0 + p * as1]);
+            });
+          } else if (p == l) {
+            Kokkos::single(Kokkos::PerThread(member), [&]() {
+              T[l + l * ldt] = ValueType(1) / tau[l * ts];
+            });
+          }
+        });
+    member.team_barrier();
+
+    // T(0:l, l) = -T(l, l) T(0:l, 0:l) (V^H V)(0:l, l)
+    for (int l = 1; l < kb; ++l) {
+      Kokkos::parallel_for(Kokkos::TeamVectorRange(member, l),
+                           [&](const int &p) {
+                             ValueType s(0);
+                             for (int q = p; q < l; ++q)
+                               s += T[p + q * ldt] * T[l + q * ldt];
+                             T[p + l * ldt] = -T[l + l * ldt] * s;
+                           });
+      member.team_barrier();
+    }
+    return 0;
+  }
+
+  /// B = (I - V op(T) V^H) B with op(T) = T or T^H (trans); B is m x n and
+  /// W (kb x n) is workspace
+  template <typename MemberType, typename ValueType>
+  KOKKOS_INLINE_FUNCTION static int apply_left(
+      const MemberType &member, const bool trans, const int m, const int n,
+      const int kb, const ValueType *KOKKOS_RESTRICT A, const int as0,
+      const int as1, const ValueType *KOKKOS_RESTRICT T, const int ldt,
+      /* */ ValueType *KOKKOS_RESTRICT B, const int bs0, const int bs1,
+      /* */ ValueType *KOKKOS_RESTRICT W) {
+    using ats = Kokkos::ArithTraits<ValueType>;
+
+    // W = V^H B
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(member, kb), [&](const int &l) {
+          Kokkos::parallel_for(
+              Kokkos::ThreadVectorRange(member, n), [&](const int &j) {
+                ValueType s = B[l * bs0 + j * bs1];
+                for (int i = l + 1; i < m; ++i)
+                  s += ats::conj(A[i * as0 + l * as1]) * B[i * bs0 + j * bs1];
+                W[l + j * kb] = s;
+              });
+        });
+    member.team_barrier();
+
+    // W = op(T) W, in place column by column
+    Kokkos::parallel_for(
+        Kokkos::TeamVectorRange(member, n), [&](const int &j) {
+          ValueType *KOKKOS_RESTRICT w = W + j * kb;
+          if (trans) {
+            for (int l = kb - 1; l >= 0; --l) {
+              ValueType s(0);
+              for (int p = 0; p <= l; ++p)
+                s += ats::conj(T[p + l * ldt]) * w[p];
+              w[l] = s;
+            }
+          } else {
+            for (int l = 0; l < kb; ++l) {
+              ValueType s(0);
+              for (int p = l; p < kb; ++p) s += T[l + p * ldt] * w[p];
+              w[l] = s;
+            }
+          }
+        });
+    member.team_barrier();
+
+    // B -= V W
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(member, m), [&](const int &i) {
+          const int lend = i < kb ? i : kb;
+          Kokkos::parallel_for(
+              Kokkos::ThreadVectorRange(member, n), [&](const int &j) {
+                ValueType s = i < kb ? W[i + j * kb] : ValueType(0);
+                for (int l = 0; l < lend; ++l)
+                  s += A[i * as0 + l * as1] * W[l + j * kb];
+                B[i * bs0 + j * bs1] -= s;
+              });
+        });
+    member.team_barrier();
+    return 0;
+  }
+
+  /// B = B (I - V op(T) V^H) with op(T) = T or T^H (trans); B is m x n, V is
+  /// n x kb and W (m x kb) is workspace
+  template <typename MemberType, typename ValueType>
+  KOKKOS_INLINE_FUNCTION static int apply_right(
+      const MemberType &member, const bool trans, const int m, const int n,
+      const int kb, const ValueType *KOKKOS_RESTRICT A, const int as0,
+      const int as1, const ValueType *KOKKOS_RESTRICT T, const int ldt,
+      /* */ ValueType *KOKKOS_RESTRICT B, const int bs0, const int bs1,
+      /* */ ValueType *KOKKOS_RESTRICT W) {
+    using ats = Kokkos::ArithTraits<ValueType>;
+
+    // W = B V
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(member, m), [&](const int &i) {
+          Kokkos::parallel_for(
+              Kokkos::ThreadVectorRange(member, kb), [&](const int &l) {
+                ValueType s = B[i * bs0 + l * bs1];
+                for (int c = l + 1; c < n; ++c)
+                  s += B[i * bs0 + c * bs1] * A[c * as0 + l * as1];
+                W[i + l * m] = s;
+              });
+        });
+    member.team_barrier();
+
+    // W = W op(T), in place row by row
+    Kokkos::parallel_for(
+        Kokkos::TeamVectorRange(member, m), [&](const int &i) {
+          if (trans) {
+            for (int l = 0; l < kb; ++l) {
+              ValueType s(0);
+              for (int p = l; p < kb; ++p)
+                s += W[i + p * m] * ats::conj(T[l + p * ldt]);
+              W[i + l * m] = s;
+            }
+          } else {
+            for (int l = kb - 1; l >= 0; --l) {
+              ValueType s(0);
+              for (int p = 0; p <= l; ++p) s += W[i + p * m] * T[p + l * ldt];
+              W[i + l * m] = s;
+            }
+          }
+        });
+    member.team_barrier();
+
+    // B -= W V^H
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(member, m), [&](const int &i) {
+          Kokkos::parallel_for(
+              Kokkos::ThreadVectorRange(member, n), [&](const int &c) {
+                const int lend = c < kb ? c : kb;
+                ValueType s    = c < kb ? W[i + c * m] : ValueType(0);
+                for (int l = 0; l < lend; ++l)
+                  s += W[i + l * m] * ats::conj(A[c * as0 + l * as1]);
+                B[i * bs0 + c * bs1] -= s;
+              });
+        });
+    member.team_barrier();
+    return 0;
+  }
+};
+
+}  // namespace KokkosBatched
+
+#endif
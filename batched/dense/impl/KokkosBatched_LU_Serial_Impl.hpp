@@ -20,6 +20,7 @@
 
 #include "KokkosBatched_Util.hpp"
 #include "KokkosBatched_LU_Serial_Internal.hpp"
+#include "KokkosBatched_FixedSize_Serial_Internal.hpp"
 
 namespace KokkosBatched {
 
@@ -74,6 +75,10 @@ KOKKOS_INLINE_FUNCTION int SerialLU<Algo::LU::Unblocked>::invoke(
     const AViewType &A,
     const typename MagnitudeScalarType<
         typename AViewType::non_const_value_type>::type tiny) {
+  if constexpr (is_fixed_size_v<AViewType>)
+    return SerialLU_InternalFixed<AViewType::static_extent(0),
+                                  AViewType::static_extent(1)>::
+        invoke(A.data(), A.stride_0(), A.stride_1(), tiny);
   return SerialLU_Internal<Algo::LU::Unblocked>::invoke(
       A.extent(0), A.extent(1), A.data(), A.stride_0(), A.stride_1(), tiny);
 }
@@ -0,0 +1,115 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_POTRF_SERIAL_INTERNAL_HPP__
+#define __KOKKOSBATCHED_POTRF_SERIAL_INTERNAL_HPP__
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+
+namespace KokkosBatched {
+
+///
+/// Serial Internal Impl
+/// ====================
+///
+/// The factorizations work on the lower triangle; the upper one is the lower
+/// triangle of A^T = conj(A) and is handled by swapping the strides, which
+/// yields U = conj(L_{conj(A)})^T = L^H as expected.
+
+///
+/// Cholesky factorization A = L * L^H, without pivoting. Returns 0 on
+/// success, or p + 1 if the leading minor of order p + 1 is not positive
+/// definite; the diagonal of vector (SIMD) types is not checked.
+///
+struct SerialPotrfInternalLower {
+  template <typename ValueType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const int m,
+                                           ValueType *KOKKOS_RESTRICT A,
+                                           const int as0, const int as1) {
+    using ats = Kokkos::ArithTraits<ValueType>;
+    using Kokkos::sqrt;  // ADL finds sqrt of Vector<SIMD<T>>
+
+    for (int p = 0; p < m; ++p) {
+      const int iend = m - p - 1;
+
+      ValueType *KOKKOS_RESTRICT a21 = A + (p + 1) * as0 + p * as1,
+                                 *KOKKOS_RESTRICT A22 =
+                                     A + (p + 1) * as0 + (p + 1) * as1;
+
+      const auto alpha11_real = ats::real(A[p * as0 + p * as1]);
+      if constexpr (!is_vector<ValueType>::value) {
+        if (!(alpha11_real > 0)) return p + 1;
+      }
+      const ValueType alpha11(sqrt(alpha11_real));
+      A[p * as0 + p * as1] = alpha11;
+
+      for (int i = 0; i < iend; ++i) a21[i * as0] /= alpha11;
+
+      for (int j = 0; j < iend; ++j) {
+        const ValueType a21j = ats::conj(a21[j * as0]);
+        for (int i = j; i < iend; ++i)
+          A22[i * as0 + j * as1] -= a21[i * as0] * a21j;
+      }
+    }
+    return 0;
+  }
+};
+
+///
+/// Solves L * L^H * X = B, with L(i, j) = op(A[i * as0 + j * as1]) where op
+/// conjugates if conj_a; B is overwritten by X.
+///
+struct SerialPotrsInternalLower {
+  template <typename ValueType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const bool conj_a, const int m,
+                                           const int n,
+                                           const ValueType *KOKKOS_RESTRICT A,
+                                           const int as0, const int as1,
+                                           ValueType *KOKKOS_RESTRICT B,
+                                           const int bs0, const int bs1) {
+    using ats = Kokkos::ArithTraits<ValueType>;
+    auto op   = [&](const ValueType &v, const bool c) {
+      return c ? ats::conj(v) : v;
+    };
+
+    // L * Y = B
+    for (int p = 0; p < m; ++p) {
+      const ValueType alpha11 = op(A[p * as0 + p * as1], conj_a);
+      for (int j = 0; j < n; ++j) {
+        ValueType &beta1 = B[p * bs0 + j * bs1];
+        beta1 /= alpha11;
+        for (int i = p + 1; i < m; ++i)
+          B[i * bs0 + j * bs1] -= op(A[i * as0 + p * as1], conj_a) * beta1;
+      }
+    }
+
+    // L^H * X = Y
+    for (int p = m - 1; p >= 0; --p) {
+      const ValueType alpha11 = op(A[p * as0 + p * as1], !conj_a);
+      for (int j = 0; j < n; ++j) {
+        ValueType &beta1 = B[p * bs0 + j * bs1];
+        beta1 /= alpha11;
+        for (int i = 0; i < p; ++i)
+          B[i * bs0 + j * bs1] -= op(A[p * as0 + i * as1], !conj_a) * beta1;
+      }
+    }
+    return 0;
+  }
+};
+
+}  // namespace KokkosBatched
+
+#endif
@@ -0,0 +1,74 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_POTRF_TEAM_IMPL_HPP__
+#define __KOKKOSBATCHED_POTRF_TEAM_IMPL_HPP__
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Potrf_Team_Internal.hpp"
+
+namespace KokkosBatched {
+
+///
+/// Team Impl
+/// =========
+
+template <typename MemberType, typename ArgAlgo>
+struct TeamPotrf<MemberType, Uplo::Lower, ArgAlgo> {
+  template <typename AViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const AViewType &A) {
+    return TeamPotrfInternalLower<Mode::Team>::invoke(
+        member, A.extent(0), A.data(), A.stride_0(), A.stride_1());
+  }
+};
+
+template <typename MemberType, typename ArgAlgo>
+struct TeamPotrf<MemberType, Uplo::Upper, ArgAlgo> {
+  template <typename AViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const AViewType &A) {
+    return TeamPotrfInternalLower<Mode::Team>::invoke(
+        member, A.extent(0), A.data(), A.stride_1(), A.stride_0());
+  }
+};
+
+///
+/// TeamVector Impl
+/// ===============
+
+template <typename MemberType, typename ArgAlgo>
+struct TeamVectorPotrf<MemberType, Uplo::Lower, ArgAlgo> {
+  template <typename AViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const AViewType &A) {
+    return TeamPotrfInternalLower<Mode::TeamVector>::invoke(
+        member, A.extent(0), A.data(), A.stride_0(), A.stride_1());
+  }
+};
+
+template <typename MemberType, typename ArgAlgo>
+struct TeamVectorPotrf<MemberType, Uplo::Upper, ArgAlgo> {
+  template <typename AViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const AViewType &A) {
+    return TeamPotrfInternalLower<Mode::TeamVector>::invoke(
+        member, A.extent(0), A.data(), A.stride_1(), A.stride_0());
+  }
+};
+
+}  // namespace KokkosBatched
+
+#endif
@@ -0,0 +1,136 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_POTRF_TEAM_INTERNAL_HPP__
+#define __KOKKOSBATCHED_POTRF_TEAM_INTERNAL_HPP__
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+
+namespace KokkosBatched {
+
+///
+/// Team and TeamVector Internal Impl
+/// =================================
+///
+/// ArgMode is Mode::Team (TeamThreadRange) or Mode::TeamVector
+/// (TeamVectorRange); see the serial version for the conventions.
+
+template <typename ArgMode, typename MemberType, typename FunctorType>
+KOKKOS_INLINE_FUNCTION void potrf_team_parallel_for(const MemberType &member,
+                                                    const int n,
+                                                    const FunctorType &f) {
+  if constexpr (std::is_same<ArgMode, Mode::TeamVector>::value)
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(member, n), f);
+  else
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(member, n), f);
+}
+
+template <typename ArgMode>
+struct TeamPotrfInternalLower {
+  template <typename MemberType, typename ValueType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const int m,
+                                           ValueType *KOKKOS_RESTRICT A,
+                                           const int as0, const int as1) {
+    using ats = Kokkos::ArithTraits<ValueType>;
+    using Kokkos::sqrt;  // ADL finds sqrt of Vector<SIMD<T>>
+
+    for (int p = 0; p < m; ++p) {
+      // Made this non-const in order to WORKAROUND issue #349
+      int iend = m - p - 1;
+
+      ValueType *KOKKOS_RESTRICT a21 = A + (p + 1) * as0 + p * as1,
+                                 *KOKKOS_RESTRICT A22 =
+                                     A + (p + 1) * as0 + (p + 1) * as1;
+
+      // every thread reads the pivot, so that all return the same value
+      member.team_barrier();
+      const auto alpha11_real = ats::real(A[p * as0 + p * as1]);
+      if constexpr (!is_vector<ValueType>::value) {
+        if (!(alpha11_real > 0)) return p + 1;
+      }
+      const ValueType alpha11(sqrt(alpha11_real));
+
+      potrf_team_parallel_for<ArgMode>(
+          member, iend, [&](const int &i) { a21[i * as0] /= alpha11; });
+      member.team_barrier();
+
+      Kokkos::single(Kokkos::PerTeam(member),
+                     [&]() { A[p * as0 + p * as1] = alpha11; });
+      potrf_team_parallel_for<ArgMode>(
+          member, iend * iend, [&](const int &ij) {
+            const int i = ij / iend, j = ij % iend;
+            if (j <= i)
+              A22[i * as0 + j * as1] -=
+                  a21[i * as0] * ats::conj(a21[j * as0]);
+          });
+    }
+    member.team_barrier();
+    return 0;
+  }
+};
+
+template <typename ArgMode>
+struct TeamPotrsInternalLower {
+  template <typename MemberType, typename ValueType>
+  KOKKOS_INLINE_FUNCTION static int invoke(
+      const MemberType &member, const bool conj_a, const int m, const int n,
+      const ValueType *KOKKOS_RESTRICT A, const int as0, const int as1,
+      ValueType *KOKKOS_RESTRICT B, const int bs0, const int bs1) {
+    using ats = Kokkos::ArithTraits<ValueType>;
+    auto op   = [&](const ValueType &v, const bool c) {
+      return c ? ats::conj(v) : v;
+    };
+
+    // L * Y = B
+    for (int p = 0; p < m; ++p) {
+      // Made this non-const in order to WORKAROUND issue #349
+      int iend = m - p - 1;
+
+      const ValueType alpha11 = op(A[p * as0 + p * as1], conj_a);
+      member.team_barrier();
+      potrf_team_parallel_for<ArgMode>(
+          member, n, [&](const int &j) { B[p * bs0 + j * bs1] /= alpha11; });
+      member.team_barrier();
+      potrf_team_parallel_for<ArgMode>(
+          member, iend * n, [&](const int &ij) {
+            const int i = p + 1 + ij / n, j = ij % n;
+            B[i * bs0 + j * bs1] -=
+                op(A[i * as0 + p * as1], conj_a) * B[p * bs0 + j * bs1];
+          });
+    }
+
+    // L^H * X = Y
+    for (int p = m - 1; p >= 0; --p) {
+      const ValueType alpha11 = op(A[p * as0 + p * as1], !conj_a);
+      member.team_barrier();
+      potrf_team_parallel_for<ArgMode>(
+          member, n, [&](const int &j) { B[p * bs0 + j * bs1] /= alpha11; });
+      member.team_barrier();
+      potrf_team_parallel_for<ArgMode>(member, p * n, [&](const int &ij) {
+        const int i = ij / n, j = ij % n;
+        B[i * bs0 + j * bs1] -=
+            op(A[p * as0 + i * as1], !conj_a) * B[p * bs0 + j * bs1];
+      });
+    }
+    member.team_barrier();
+    return 0;
+  }
+};
+
+}  // namespace KokkosBatched
+
+#endif
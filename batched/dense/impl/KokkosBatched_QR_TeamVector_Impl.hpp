@@ -40,6 +40,19 @@ struct TeamVectorQR<MemberType, Algo::QR::Unblocked> {
   }
 };
 
+template <typename MemberType>
+struct TeamVectorQR<MemberType, Algo::QR::Blocked> {
+  template <typename AViewType, typename tViewType, typename wViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const AViewType &A,
+                                           const tViewType &t,
+                                           const wViewType &w) {
+    return TeamVectorQR_BlockedInternal::invoke(
+        member, A.extent(0), A.extent(1), A.data(), A.stride_0(),
+        A.stride_1(), t.data(), t.stride_0(), w.data());
+  }
+};
+
 }  // namespace KokkosBatched
 
 #endif
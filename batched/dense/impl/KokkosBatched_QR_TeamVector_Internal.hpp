@@ -21,6 +21,7 @@
 #include "KokkosBatched_Util.hpp"
 #include "KokkosBatched_Householder_TeamVector_Internal.hpp"
 #include "KokkosBatched_ApplyHouseholder_TeamVector_Internal.hpp"
+#include "KokkosBatched_HouseholderWY_TeamVector_Internal.hpp"
 
 namespace KokkosBatched {
 
@@ -55,7 +56,8 @@ struct TeamVectorQR_Internal {
     A_part2x2.partWithATL(A, m, n, 0, 0);
     t_part2x1.partWithAT(t, m, 0);
 
-    for (int m_atl = 0; m_atl < m; ++m_atl) {
+    const int k = m < n ? m : n;
+    for (int m_atl = 0; m_atl < k; ++m_atl) {
       // part 2x2 into 3x3
       A_part3x3.partWithABR(A_part2x2, 1, 1);
       const int m_A22 = m - m_atl - 1;
@@ -84,6 +86,44 @@ struct TeamVectorQR_Internal {
   }
 };
 
+///
+/// Blocked variant: panels of nb columns are factored with the unblocked
+/// algorithm and the trailing matrix is updated with the compact WY form of
+/// the panel, (I - V T^H V^H) A22
+///  - w is nb * (nb + n) workspace, nb = max_block_size
+///
+struct TeamVectorQR_BlockedInternal {
+  template <typename MemberType, typename ValueType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const int m,  // m = NumRows(A)
+                                           const int n,  // n = NumCols(A)
+                                           /* */ ValueType *A, const int as0,
+                                           const int as1,
+                                           /* */ ValueType *t, const int ts,
+                                           /* */ ValueType *w) {
+    constexpr int nb = TeamVectorHouseholderWY_Internal::max_block_size;
+
+    const int k = m < n ? m : n;
+    ValueType *T = w, *W = w + nb * nb;
+    for (int j0 = 0; j0 < k; j0 += nb) {
+      const int kb = (k - j0) < nb ? (k - j0) : nb;
+      const int n2 = n - j0 - kb;
+      ValueType *A11 = A + j0 * as0 + j0 * as1;
+
+      TeamVectorQR_Internal::invoke(member, m - j0, kb, A11, as0, as1,
+                                    t + j0 * ts, ts, W);
+      if (n2 > 0) {
+        TeamVectorHouseholderWY_Internal::form_t(member, m - j0, kb, A11, as0,
+                                                 as1, t + j0 * ts, ts, T, nb);
+        TeamVectorHouseholderWY_Internal::apply_left(
+            member, true, m - j0, n2, kb, A11, as0, as1, T, nb,
+            A11 + kb * as1, as0, as1, W);
+      }
+    }
+    return 0;
+  }
+};
+
 }  // end namespace KokkosBatched
 
 #endif
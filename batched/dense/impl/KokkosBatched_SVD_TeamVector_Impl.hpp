@@ -0,0 +1,80 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_SVD_TEAMVECTOR_IMPL_HPP__
+#define __KOKKOSBATCHED_SVD_TEAMVECTOR_IMPL_HPP__
+
+#include "KokkosBatched_SVD_TeamVector_Internal.hpp"
+
+namespace KokkosBatched {
+
+///
+/// TeamVector Impl
+/// ===============
+
+// Version which computes the full factorization
+template <typename MemberType>
+template <typename AViewType, typename UViewType, typename VViewType,
+          typename SViewType>
+KOKKOS_INLINE_FUNCTION int TeamVectorSVD<MemberType>::invoke(
+    const MemberType &member, SVD_USV_Tag, const AViewType &A,
+    const UViewType &U, const SViewType &sigma, const VViewType &Vt) {
+  static_assert(Kokkos::is_view_v<AViewType> && AViewType::rank == 2,
+                "SVD: A must be a rank-2 view");
+  static_assert(Kokkos::is_view_v<UViewType> && UViewType::rank == 2,
+                "SVD: U must be a rank-2 view");
+  static_assert(Kokkos::is_view_v<SViewType> && SViewType::rank == 1,
+                "SVD: s must be a rank-1 view");
+  static_assert(Kokkos::is_view_v<VViewType> && VViewType::rank == 2,
+                "SVD: V must be a rank-2 view");
+  using value_type = typename AViewType::non_const_value_type;
+  const int m = A.extent(0), n = A.extent(1);
+  // V is passed as the transpose of Vt; for m < n, A^T = Vt^T * diag(s) * U^T
+  // is factored instead, so the roles of U and Vt swap
+  if (m >= n)
+    return TeamVectorSVDInternal::invoke<value_type>(
+        member, m, n, A.data(), A.stride(0), A.stride(1), U.data(),
+        U.stride(0), U.stride(1), Vt.data(), Vt.stride(1), Vt.stride(0),
+        sigma.data(), sigma.stride(0));
+  return TeamVectorSVDInternal::invoke<value_type>(
+      member, n, m, A.data(), A.stride(1), A.stride(0), Vt.data(),
+      Vt.stride(1), Vt.stride(0), U.data(), U.stride(0), U.stride(1),
+      sigma.data(), sigma.stride(0));
+}
+
+// Version which computes only singular values
+template <typename MemberType>
+template <typename AViewType, typename SViewType>
+KOKKOS_INLINE_FUNCTION int TeamVectorSVD<MemberType>::invoke(
+    const MemberType &member, SVD_S_Tag, const AViewType &A,
+    const SViewType &sigma) {
+  static_assert(Kokkos::is_view_v<AViewType> && AViewType::rank == 2,
+                "SVD: A must be a rank-2 view");
+  static_assert(Kokkos::is_view_v<SViewType> && SViewType::rank == 1,
+                "SVD: s must be a rank-1 view");
+  using value_type = typename AViewType::non_const_value_type;
+  const int m = A.extent(0), n = A.extent(1);
+  if (m >= n)
+    return TeamVectorSVDInternal::invoke<value_type>(
+        member, m, n, A.data(), A.stride(0), A.stride(1), nullptr, 0, 0,
+        nullptr, 0, 0, sigma.data(), sigma.stride(0));
+  return TeamVectorSVDInternal::invoke<value_type>(
+      member, n, m, A.data(), A.stride(1), A.stride(0), nullptr, 0, 0,
+      nullptr, 0, 0, sigma.data(), sigma.stride(0));
+}
+
+}  // namespace KokkosBatched
+
+#endif
@@ -0,0 +1,272 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_SVD_TEAMVECTOR_INTERNAL_HPP__
+#define __KOKKOSBATCHED_SVD_TEAMVECTOR_INTERNAL_HPP__
+
+#include "KokkosBatched_Util.hpp"
+
+namespace KokkosBatched {
+
+///
+/// TeamVector Internal Impl
+/// ========================
+///
+/// One-sided (Hestenes) Jacobi SVD of an m x n matrix A with m >= n. Columns
+/// i and j of A are rotated until they are orthogonal, A * V = U * diag(s).
+/// A sweep visits every pair of columns in n - 1 (n even) or n (n odd) rounds
+/// of the round-robin ordering; the pairs of a round are disjoint, so they are
+/// rotated in parallel over the threads of the team and each column over the
+/// vector lanes.
+///
+/// On exit, s holds the singular values in descending order, U (if not null,
+/// m x m) the left singular vectors, completed to an orthonormal basis, and V
+/// (if not null, n x n) the right singular vectors in columns. A is
+/// overwritten.
+///
+struct TeamVectorSVDInternal {
+  static constexpr int max_sweeps = 30;
+
+  // the pair k of round r of the round-robin ordering of nn (even) columns;
+  // column nn - 1 is the fixed one
+  KOKKOS_INLINE_FUNCTION static void round_robin_pair(const int nn,
+                                                      const int r, const int k,
+                                                      int &i, int &j) {
+    const int np = nn - 1;
+    if (k == 0) {
+      i = r;
+      j = np;
+    } else {
+      i = (r + k) % np;
+      j = (r - k + np) % np;
+    }
+  }
+
+  template <typename MemberType, typename ValueType>
+  KOKKOS_INLINE_FUNCTION static ValueType dot(const MemberType &member,
+                                              const int m, const ValueType *x,
+                                              const int xs0, const ValueType *y,
+                                              const int ys0) {
+    ValueType r(0);
+    Kokkos::parallel_reduce(
+        Kokkos::TeamVectorRange(member, m),
+        [&](const int &l, ValueType &update) {
+          update += x[l * xs0] * y[l * ys0];
+        },
+        r);
+    return r;
+  }
+
+  template <typename ValueType, typename MemberType>
+  KOKKOS_INLINE_FUNCTION static int invoke(
+      const MemberType &member, const int m, const int n,
+      ValueType *KOKKOS_RESTRICT A, const int as0, const int as1,
+      ValueType *KOKKOS_RESTRICT U, const int us0, const int us1,
+      ValueType *KOKKOS_RESTRICT V, const int vs0, const int vs1,
+      ValueType *KOKKOS_RESTRICT sigma, const int ss0) {
+    using ats      = Kokkos::ArithTraits<ValueType>;
+    using mag_type = typename ats::mag_type;
+    static_assert(!ats::is_complex,
+                  "KokkosBatched::TeamVectorSVD: only real-valued matrices "
+                  "are supported");
+    const ValueType zero(0), one(1);
+    const mag_type tol = mag_type(m > 1 ? m : 1) * ats::epsilon();
+
+    if (V) {
+      Kokkos::parallel_for(Kokkos::TeamVectorRange(member, n * n),
+                           [&](const int &ij) {
+                             const int i = ij / n, j = ij % n;
+                             V[i * vs0 + j * vs1] = i == j ? one : zero;
+                           });
+      member.team_barrier();
+    }
+
+    // the sweeps; a column pair is rotated when it is not orthogonal to
+    // working precision
+    const int nn     = n + (n % 2);
+    const int npairs = nn / 2;
+    for (int sweep = 0; sweep < max_sweeps && n > 1; ++sweep) {
+      int nrot = 0;
+      for (int r = 0; r < nn - 1; ++r) {
+        int nrot_round = 0;
+        Kokkos::parallel_reduce(
+            Kokkos::TeamThreadRange(member, npairs),
+            [&](const int &k, int &update) {
+              int i, j;
+              round_robin_pair(nn, r, k, i, j);
+              if (i >= n || j >= n) return;
+              if (i > j) {
+                const int t = i;
+                i           = j;
+                j           = t;
+              }
+              ValueType *KOKKOS_RESTRICT ai = A + i * as1;
+              ValueType *KOKKOS_RESTRICT aj = A + j * as1;
+              ValueType alpha(0), beta(0), gamma(0);
+              Kokkos::parallel_reduce(
+                  Kokkos::ThreadVectorRange(member, m),
+                  [&](const int &l, ValueType &update) {
+                    update += ai[l * as0] * ai[l * as0];
+                  },
+                  alpha);
+              Kokkos::parallel_reduce(
+                  Kokkos::ThreadVectorRange(member, m),
+                  [&](const int &l, ValueType &update) {
+                    update += aj[l * as0] * aj[l * as0];
+                  },
+                  beta);
+              Kokkos::parallel_reduce(
+                  Kokkos::ThreadVectorRange(member, m),
+                  [&](const int &l, ValueType &update) {
+                    update += ai[l * as0] * aj[l * as0];
+                  },
+                  gamma);
+              if (ats::abs(gamma) <=
+                  tol * Kokkos::sqrt(ats::abs(alpha) * ats::abs(beta)))
+                return;
+
+              // the rotation that zeroes the off-diagonal of the 2 x 2 Gram
+              // matrix [alpha gamma; gamma beta]
+              const ValueType zeta = (beta - alpha) / (2 * gamma);
+              const ValueType t =
+                  (zeta >= zero ? one : -one) /
+                  (ats::abs(zeta) + Kokkos::sqrt(one + zeta * zeta));
+              const ValueType c = one / Kokkos::sqrt(one + t * t);
+              const ValueType s = c * t;
+              Kokkos::parallel_for(Kokkos::ThreadVectorRange(member, m),
+                                   [&](const int &l) {
+                                     const ValueType x = ai[l * as0];
+                                     const ValueType y = aj[l * as0];
+                                     ai[l * as0]       = c * x - s * y;
+                                     aj[l * as0]       = s * x + c * y;
+                                   });
+              if (V) {
+                ValueType *KOKKOS_RESTRICT vi = V + i * vs1;
+                ValueType *KOKKOS_RESTRICT vj = V + j * vs1;
+                Kokkos::parallel_for(Kokkos::ThreadVectorRange(member, n),
+                                     [&](const int &l) {
+                                       const ValueType x = vi[l * vs0];
+                                       const ValueType y = vj[l * vs0];
+                                       vi[l * vs0]       = c * x - s * y;
+                                       vj[l * vs0]       = s * x + c * y;
+                                     });
+              }
+              ++update;
+            },
+            nrot_round);
+        member.team_barrier();
+        nrot += nrot_round;
+      }
+      if (nrot == 0) break;
+    }
+
+    // the singular values are the column norms
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(member, n), [&](const int &j) {
+      ValueType nrm(0);
+      Kokkos::parallel_reduce(
+          Kokkos::ThreadVectorRange(member, m),
+          [&](const int &l, ValueType &update) {
+            update += A[l * as0 + j * as1] * A[l * as0 + j * as1];
+          },
+          nrm);
+      Kokkos::single(Kokkos::PerThread(member),
+                     [&]() { sigma[j * ss0] = Kokkos::sqrt(nrm); });
+    });
+    member.team_barrier();
+
+    // selection sort into descending order; every thread finds the same
+    // maximum, then the columns are swapped by the team
+    for (int j = 0; j < n - 1; ++j) {
+      int p = j;
+      for (int l = j + 1; l < n; ++l)
+        if (sigma[l * ss0] > sigma[p * ss0]) p = l;
+      if (p == j) continue;
+      Kokkos::parallel_for(Kokkos::TeamVectorRange(member, m),
+                           [&](const int &l) {
+                             const ValueType t    = A[l * as0 + j * as1];
+                             A[l * as0 + j * as1] = A[l * as0 + p * as1];
+                             A[l * as0 + p * as1] = t;
+                           });
+      if (V)
+        Kokkos::parallel_for(Kokkos::TeamVectorRange(member, n),
+                             [&](const int &l) {
+                               const ValueType t    = V[l * vs0 + j * vs1];
+                               V[l * vs0 + j * vs1] = V[l * vs0 + p * vs1];
+                               V[l * vs0 + p * vs1] = t;
+                             });
+      Kokkos::single(Kokkos::PerTeam(member), [&]() {
+        const ValueType t = sigma[j * ss0];
+        sigma[j * ss0]    = sigma[p * ss0];
+        sigma[p * ss0]    = t;
+      });
+      member.team_barrier();
+    }
+
+    if (!U) return 0;
+
+    // the columns of nonzero singular values are normalized; the others and
+    // the last m - n are completed with unit vectors orthogonalized (twice)
+    // against the previous columns. The rejected unit vectors leave at least
+    // 3/4 of the complement, so one of the remaining ones keeps a norm above
+    // 1/(2 sqrt(m))
+    const mag_type small = n > 0 ? tol * ats::abs(sigma[0]) : mag_type(0);
+    int rank             = 0;
+    while (rank < n && ats::abs(sigma[rank * ss0]) > small) ++rank;
+    Kokkos::parallel_for(
+        Kokkos::TeamVectorRange(member, m * rank), [&](const int &ij) {
+          const int i = ij / rank, j = ij % rank;
+          U[i * us0 + j * us1] = A[i * as0 + j * as1] / sigma[j * ss0];
+        });
+    member.team_barrier();
+
+    int trial = 0;
+    for (int c = rank; c < m; ++c) {
+      ValueType *KOKKOS_RESTRICT uc = U + c * us1;
+      for (; trial < m; ++trial) {
+        Kokkos::parallel_for(
+            Kokkos::TeamVectorRange(member, m),
+            [&](const int &l) { uc[l * us0] = l == trial ? one : zero; });
+        member.team_barrier();
+        for (int pass = 0; pass < 2; ++pass) {
+          for (int q = 0; q < c; ++q) {
+            const ValueType *KOKKOS_RESTRICT uq = U + q * us1;
+            const ValueType d = dot(member, m, uq, us0, uc, us0);
+            member.team_barrier();
+            Kokkos::parallel_for(
+                Kokkos::TeamVectorRange(member, m),
+                [&](const int &l) { uc[l * us0] -= d * uq[l * us0]; });
+            member.team_barrier();
+          }
+        }
+        const mag_type nrm =
+            Kokkos::sqrt(ats::abs(dot(member, m, uc, us0, uc, us0)));
+        member.team_barrier();
+        if (nrm > mag_type(0.5) / Kokkos::sqrt(mag_type(m))) {
+          Kokkos::parallel_for(
+              Kokkos::TeamVectorRange(member, m),
+              [&](const int &l) { uc[l * us0] /= nrm; });
+          member.team_barrier();
+          ++trial;
+          break;
+        }
+      }
+    }
+    return 0;
+  }
+};
+
+}  // namespace KokkosBatched
+
+#endif
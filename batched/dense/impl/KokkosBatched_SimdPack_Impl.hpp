@@ -0,0 +1,322 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_SIMDPACK_IMPL_HPP__
+#define __KOKKOSBATCHED_SIMDPACK_IMPL_HPP__
+
+/// \author Kyungjoo Kim (kyukim@sandia.gov)
+
+#include <cstdint>
+#include <sstream>
+#include <tuple>
+#include <utility>
+#include "KokkosKernels_Error.hpp"
+
+namespace KokkosBatched {
+namespace Impl {
+
+template <typename ViewType>
+KOKKOS_FORCEINLINE_FUNCTION typename ViewType::reference_type
+simd_pack_access(const ViewType &a, const int k, const int i, const int j) {
+  if constexpr (ViewType::rank == 2)
+    return a(k, i);
+  else
+    return a(k, i, j);
+}
+
+template <typename ViewType>
+KOKKOS_INLINE_FUNCTION auto simd_pack_subview(const ViewType &a, const int p) {
+  if constexpr (ViewType::rank == 2)
+    return Kokkos::subview(a, p, Kokkos::ALL());
+  else
+    return Kokkos::subview(a, p, Kokkos::ALL(), Kokkos::ALL());
+}
+
+template <typename AViewType, typename ApViewType>
+void simd_pack_check(const char *name, const AViewType &A,
+                     const ApViewType &Ap) {
+  static_assert(Kokkos::is_view<AViewType>::value &&
+                    Kokkos::is_view<ApViewType>::value,
+                "KokkosBatched::SimdPack: A and Ap must be Kokkos::View's");
+  static_assert(int(AViewType::rank) == int(ApViewType::rank) &&
+                    (AViewType::rank == 2 || AViewType::rank == 3),
+                "KokkosBatched::SimdPack: A and Ap must both be of rank 2 or "
+                "3");
+  static_assert(
+      is_vector<typename ApViewType::non_const_value_type>::value,
+      "KokkosBatched::SimdPack: the value type of Ap must be Vector<SIMD<T>>");
+  using vector_type = typename ApViewType::non_const_value_type;
+  const size_t vl   = vector_type::vector_length;
+  if (Ap.extent(0) != (A.extent(0) + vl - 1) / vl ||
+      Ap.extent(1) != A.extent(1) || Ap.extent(2) != A.extent(2)) {
+    std::ostringstream os;
+    os << "KokkosBatched::" << name << ": Dimensions of A and Ap do not match: "
+       << "A: " << A.extent(0) << " x " << A.extent(1) << " x " << A.extent(2)
+       << ", Ap: " << Ap.extent(0) << " x " << Ap.extent(1) << " x "
+       << Ap.extent(2) << " (with vector length " << vl << ")";
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+}
+
+/// Ap(p, i, j)[l] = A(p * vl + l, i, j), or the reverse if Unpack; one thread
+/// per entry of Ap.
+template <typename AViewType, typename ApViewType, bool Unpack>
+struct SimdPackFunctor {
+  using vector_type = typename ApViewType::non_const_value_type;
+
+  AViewType _a;
+  ApViewType _ap;
+  int _nbatch, _ncol, _mn;
+
+  SimdPackFunctor(const AViewType &a, const ApViewType &ap)
+      : _a(a),
+        _ap(ap),
+        _nbatch(a.extent(0)),
+        _ncol(a.extent(2)),
+        _mn(a.extent(1) * a.extent(2)) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const int idx) const {
+    constexpr int vl = vector_type::vector_length;
+    const int p = idx / _mn, ij = idx % _mn, i = ij / _ncol, j = ij % _ncol;
+    if constexpr (Unpack) {
+      const auto v = simd_pack_access(_ap, p, i, j);
+      for (int l = 0, k = p * vl; l < vl && k < _nbatch; ++l, ++k)
+        simd_pack_access(_a, k, i, j) = v[l];
+    } else {
+      // the lanes past the end of the batch replicate its last entry
+      vector_type v;
+      for (int l = 0, k = p * vl; l < vl; ++l, ++k)
+        v[l] = simd_pack_access(_a, k < _nbatch ? k : _nbatch - 1, i, j);
+      simd_pack_access(_ap, p, i, j) = v;
+    }
+  }
+};
+
+/// Transposes every block of vl x mn scalars of a contiguous batch to mn x
+/// vl (packing) or back (unpacking) through team scratch; one team per pack.
+template <typename ExecSpace, typename ValueType, int VectorLength,
+          bool Unpack>
+struct SimdPackInPlaceFunctor {
+  using member_type = typename Kokkos::TeamPolicy<ExecSpace>::member_type;
+  using scratch_view_type =
+      Kokkos::View<ValueType *, typename ExecSpace::scratch_memory_space,
+                   Kokkos::MemoryUnmanaged>;
+
+  ValueType *_data;
+  int _mn, _level;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const member_type &member) const {
+    constexpr int vl = VectorLength;
+    const int len    = vl * _mn;
+    scratch_view_type w(member.team_scratch(_level), len);
+    ValueType *block = _data + size_t(member.league_rank()) * len;
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(member, len),
+                         [&](const int q) { w(q) = block[q]; });
+    member.team_barrier();
+    // q indexes the destination; the scalar offset l * mn + ij of lane l is
+    // the packed offset ij * vl + l
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(member, len),
+                         [&](const int q) {
+                           if constexpr (Unpack)
+                             block[q] = w((q % _mn) * vl + q / _mn);
+                           else
+                             block[q] = w((q % vl) * _mn + q / vl);
+                         });
+  }
+};
+
+template <typename ExecSpace, typename ValueType, int VectorLength,
+          bool Unpack>
+void simd_pack_in_place(const ExecSpace &space, ValueType *data,
+                        const int npacks, const int mn) {
+  using functor_type =
+      SimdPackInPlaceFunctor<ExecSpace, ValueType, VectorLength, Unpack>;
+  using policy_type = Kokkos::TeamPolicy<ExecSpace>;
+  if (npacks == 0 || mn == 0) return;
+  const int bytes =
+      functor_type::scratch_view_type::shmem_size(VectorLength * mn);
+  const int level = bytes <= policy_type::scratch_size_max(0) ? 0 : 1;
+  Kokkos::parallel_for(
+      Unpack ? "KokkosBatched::SimdUnpackInPlace"
+             : "KokkosBatched::SimdPackInPlace",
+      policy_type(space, npacks, Kokkos::AUTO)
+          .set_scratch_size(level, Kokkos::PerTeam(bytes)),
+      functor_type{data, mn, level});
+}
+
+template <typename Functor, typename... PackedViewTypes>
+struct SimdPackedForFunctor {
+  Functor _functor;
+  std::tuple<PackedViewTypes...> _views;
+
+  template <size_t... I>
+  KOKKOS_INLINE_FUNCTION void invoke(const int p,
+                                     std::index_sequence<I...>) const {
+    _functor(p, simd_pack_subview(std::get<I>(_views), p)...);
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const int p) const {
+    invoke(p, std::index_sequence_for<PackedViewTypes...>());
+  }
+};
+
+template <int VectorLength, typename ViewType>
+typename SimdPackedViewType<ViewType, VectorLength>::type simd_pack_alloc(
+    const ViewType &a) {
+  using packed_view_type =
+      typename SimdPackedViewType<ViewType, VectorLength>::type;
+  const size_t npacks = (a.extent(0) + VectorLength - 1) / VectorLength;
+  const auto alloc =
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "SimdPacked");
+  if constexpr (ViewType::rank == 2)
+    return packed_view_type(alloc, npacks, a.extent(1));
+  else
+    return packed_view_type(alloc, npacks, a.extent(1), a.extent(2));
+}
+
+template <typename ExecSpace, typename ApViewType, typename AViewType>
+void simd_unpack_if_non_const(const ExecSpace &space, const ApViewType &Ap,
+                              const AViewType &A) {
+  if constexpr (!std::is_const<typename AViewType::value_type>::value)
+    SimdUnpack(space, Ap, A);
+}
+
+template <int VectorLength, typename ExecSpace, typename Functor,
+          size_t... I, typename... ViewTypes>
+void simd_packed_for(const std::string &label, const ExecSpace &space,
+                     const Functor &functor, std::index_sequence<I...>,
+                     const ViewTypes &...views) {
+  using functor_type = SimdPackedForFunctor<
+      Functor, typename SimdPackedViewType<ViewTypes, VectorLength>::type...>;
+  const size_t npacks =
+      (std::get<0>(std::tie(views...)).extent(0) + VectorLength - 1) /
+      VectorLength;
+
+  std::tuple<typename SimdPackedViewType<ViewTypes, VectorLength>::type...>
+      packed(simd_pack_alloc<VectorLength>(views)...);
+  (SimdPack(space, views, std::get<I>(packed)), ...);
+  Kokkos::parallel_for(label, Kokkos::RangePolicy<ExecSpace>(space, 0, npacks),
+                       functor_type{functor, packed});
+  (simd_unpack_if_non_const(space, std::get<I>(packed), views), ...);
+}
+
+}  // namespace Impl
+
+template <typename ExecSpace, typename AViewType, typename ApViewType>
+void SimdPack(const ExecSpace &space, const AViewType &A,
+              const ApViewType &Ap) {
+  static_assert(!std::is_const<typename ApViewType::value_type>::value,
+                "KokkosBatched::SimdPack: Ap must not be const");
+  Impl::simd_pack_check("SimdPack", A, Ap);
+  Kokkos::parallel_for(
+      "KokkosBatched::SimdPack",
+      Kokkos::RangePolicy<ExecSpace>(space, 0, Ap.extent(0) * Ap.extent(1) *
+                                                   Ap.extent(2)),
+      Impl::SimdPackFunctor<AViewType, ApViewType, false>(A, Ap));
+}
+
+template <typename ExecSpace, typename ApViewType, typename AViewType>
+void SimdUnpack(const ExecSpace &space, const ApViewType &Ap,
+                const AViewType &A) {
+  static_assert(!std::is_const<typename AViewType::value_type>::value,
+                "KokkosBatched::SimdUnpack: A must not be const");
+  Impl::simd_pack_check("SimdUnpack", A, Ap);
+  Kokkos::parallel_for(
+      "KokkosBatched::SimdUnpack",
+      Kokkos::RangePolicy<ExecSpace>(space, 0, Ap.extent(0) * Ap.extent(1) *
+                                                   Ap.extent(2)),
+      Impl::SimdPackFunctor<AViewType, ApViewType, true>(A, Ap));
+}
+
+template <int VectorLength, typename ExecSpace, typename AViewType>
+typename SimdPackedViewType<AViewType, VectorLength>::unmanaged_type
+SimdPackInPlace(const ExecSpace &space, const AViewType &A) {
+  using value_type     = typename AViewType::value_type;
+  using packed_type    = SimdPackedViewType<AViewType, VectorLength>;
+  using vector_type    = typename packed_type::vector_type;
+  using unmanaged_type = typename packed_type::unmanaged_type;
+  static_assert(AViewType::rank == 2 || AViewType::rank == 3,
+                "KokkosBatched::SimdPackInPlace: A must be of rank 2 or 3");
+  static_assert(!std::is_const<value_type>::value,
+                "KokkosBatched::SimdPackInPlace: A must not be const");
+  static_assert(
+      std::is_same<typename AViewType::array_layout,
+                   Kokkos::LayoutRight>::value,
+      "KokkosBatched::SimdPackInPlace: A must be LayoutRight");
+  static_assert(sizeof(vector_type) == VectorLength * sizeof(value_type),
+                "KokkosBatched::SimdPackInPlace: Vector<SIMD<T>> is padded");
+
+  const size_t nbatch = A.extent(0);
+  if (!A.span_is_contiguous() || nbatch % VectorLength != 0 ||
+      reinterpret_cast<std::uintptr_t>(A.data()) % alignof(vector_type) != 0) {
+    std::ostringstream os;
+    os << "KokkosBatched::SimdPackInPlace: A must be contiguous, its batch "
+          "size ("
+       << nbatch << ") a multiple of the vector length (" << VectorLength
+       << ") and its data aligned to " << alignof(vector_type) << " bytes";
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+  Impl::simd_pack_in_place<ExecSpace, value_type, VectorLength, false>(
+      space, A.data(), nbatch / VectorLength, A.extent(1) * A.extent(2));
+
+  vector_type *data = reinterpret_cast<vector_type *>(A.data());
+  if constexpr (AViewType::rank == 2)
+    return unmanaged_type(data, nbatch / VectorLength, A.extent(1));
+  else
+    return unmanaged_type(data, nbatch / VectorLength, A.extent(1),
+                          A.extent(2));
+}
+
+template <typename ExecSpace, typename ApViewType>
+void SimdUnpackInPlace(const ExecSpace &space, const ApViewType &Ap) {
+  using vector_type = typename ApViewType::value_type;
+  using value_type  = typename vector_type::value_type;
+  static_assert(is_vector<typename ApViewType::non_const_value_type>::value &&
+                    !std::is_const<vector_type>::value,
+                "KokkosBatched::SimdUnpackInPlace: the value type of Ap must "
+                "be a non-const Vector<SIMD<T>>");
+  if (!Ap.span_is_contiguous()) {
+    std::ostringstream os;
+    os << "KokkosBatched::SimdUnpackInPlace: Ap must be contiguous";
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+  Impl::simd_pack_in_place<ExecSpace, value_type, vector_type::vector_length,
+                           true>(space,
+                                 reinterpret_cast<value_type *>(Ap.data()),
+                                 Ap.extent(0), Ap.extent(1) * Ap.extent(2));
+}
+
+template <int VectorLength, typename ExecSpace, typename Functor,
+          typename... ViewTypes>
+void SimdPackedFor(const std::string &label, const ExecSpace &space,
+                   const Functor &functor, const ViewTypes &...views) {
+  static_assert(sizeof...(ViewTypes) > 0,
+                "KokkosBatched::SimdPackedFor: at least one view is needed");
+  const size_t nbatch = std::get<0>(std::tie(views...)).extent(0);
+  if (((views.extent(0) != nbatch) || ...)) {
+    std::ostringstream os;
+    os << "KokkosBatched::SimdPackedFor: all views must have the same batch "
+          "size ("
+       << nbatch << ")";
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+  Impl::simd_packed_for<VectorLength>(
+      label, space, functor, std::index_sequence_for<ViewTypes...>(),
+      views...);
+}
+
+}  // namespace KokkosBatched
+
+#endif
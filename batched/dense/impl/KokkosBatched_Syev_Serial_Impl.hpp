@@ -0,0 +1,50 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_SYEV_SERIAL_IMPL_HPP__
+#define __KOKKOSBATCHED_SYEV_SERIAL_IMPL_HPP__
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Syev_Serial_Internal.hpp"
+
+namespace KokkosBatched {
+
+///
+/// Serial Impl
+/// ===========
+
+template <typename ArgUplo>
+template <typename AViewType, typename EViewType, typename WViewType>
+KOKKOS_INLINE_FUNCTION int SerialSyev<ArgUplo>::invoke(const AViewType &A,
+                                                       const EViewType &e,
+                                                       const WViewType &W) {
+  static_assert(Kokkos::is_view_v<AViewType> && AViewType::rank == 2,
+                "Syev: A must be a rank-2 view");
+  static_assert(Kokkos::is_view_v<EViewType> && EViewType::rank == 1,
+                "Syev: e must be a rank-1 view");
+  static_assert(Kokkos::is_view_v<WViewType> && WViewType::rank == 1,
+                "Syev: W must be a rank-1 view");
+  assert(A.extent(0) == A.extent(1) && "Syev: A is not square");
+  assert(W.extent(0) >= A.extent(0) && "Syev: workspace size is too small");
+  assert(W.stride(0) == 1 && "Syev: Provided workspace is not contiguous");
+  using value_type = typename AViewType::non_const_value_type;
+  return SerialSyevInternal::invoke<value_type>(
+      std::is_same<ArgUplo, Uplo::Lower>::value, A.extent(0), A.data(),
+      A.stride(0), A.stride(1), e.data(), e.stride(0), W.data());
+}
+
+}  // namespace KokkosBatched
+
+#endif
@@ -0,0 +1,234 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_SYEV_SERIAL_INTERNAL_HPP__
+#define __KOKKOSBATCHED_SYEV_SERIAL_INTERNAL_HPP__
+
+#include "KokkosBatched_Util.hpp"
+
+namespace KokkosBatched {
+
+///
+/// Serial Internal Impl
+/// ====================
+///
+/// Eigendecomposition of a real symmetric m x m matrix A = V * diag(d) * V^T.
+/// A is reduced to tridiagonal form with Householder reflectors (tred2), then
+/// the tridiagonal matrix is diagonalized with the implicit QL method (tql2);
+/// both accumulate the transformations in place of A, which holds V on exit.
+/// The eigenvalues are sorted in ascending order. Only the lower (or upper)
+/// triangle of A is referenced on entry; e (length m) is workspace.
+///
+/// Returns 0 on success, or 1 if an eigenvalue did not converge within
+/// max_iterations QL steps.
+///
+struct SerialSyevInternal {
+  static constexpr int max_iterations = 30;
+
+  template <typename ValueType>
+  KOKKOS_INLINE_FUNCTION static void symmetrize(const bool lower, const int m,
+                                                ValueType *KOKKOS_RESTRICT A,
+                                                const int as0, const int as1) {
+    for (int i = 0; i < m; ++i)
+      for (int j = 0; j < i; ++j)
+        if (lower)
+          A[j * as0 + i * as1] = A[i * as0 + j * as1];
+        else
+          A[i * as0 + j * as1] = A[j * as0 + i * as1];
+  }
+
+  template <typename ValueType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const bool lower, const int m,
+                                           ValueType *KOKKOS_RESTRICT A,
+                                           const int as0, const int as1,
+                                           ValueType *KOKKOS_RESTRICT d,
+                                           const int ds0,
+                                           ValueType *KOKKOS_RESTRICT e) {
+    using ats = Kokkos::ArithTraits<ValueType>;
+    static_assert(!ats::is_complex,
+                  "KokkosBatched::SerialSyev: only real-valued matrices "
+                  "are supported");
+    const ValueType zero(0), one(1);
+    auto V = [&](const int i, const int j) -> ValueType & {
+      return A[i * as0 + j * as1];
+    };
+    auto D = [&](const int i) -> ValueType & { return d[i * ds0]; };
+
+    if (m == 0) return 0;
+    symmetrize(lower, m, A, as0, as1);
+
+    /// Householder tridiagonalization; D holds the diagonal and e the
+    /// subdiagonal in e[1:m]
+    for (int j = 0; j < m; ++j) D(j) = V(m - 1, j);
+    for (int i = m - 1; i > 0; --i) {
+      ValueType scale(0), h(0);
+      for (int k = 0; k < i; ++k) scale += ats::abs(D(k));
+      if (scale == zero) {
+        e[i] = D(i - 1);
+        for (int j = 0; j < i; ++j) {
+          D(j)    = V(i - 1, j);
+          V(i, j) = zero;
+          V(j, i) = zero;
+        }
+      } else {
+        for (int k = 0; k < i; ++k) {
+          D(k) /= scale;
+          h += D(k) * D(k);
+        }
+        ValueType f = D(i - 1);
+        ValueType g = Kokkos::sqrt(h);
+        if (f > zero) g = -g;
+        e[i]     = scale * g;
+        h        = h - f * g;
+        D(i - 1) = f - g;
+        for (int j = 0; j < i; ++j) e[j] = zero;
+
+        // e = A * u / h over the active block
+        for (int j = 0; j < i; ++j) {
+          f       = D(j);
+          V(j, i) = f;
+          g       = e[j] + V(j, j) * f;
+          for (int k = j + 1; k <= i - 1; ++k) {
+            g += V(k, j) * D(k);
+            e[k] += V(k, j) * f;
+          }
+          e[j] = g;
+        }
+        f = zero;
+        for (int j = 0; j < i; ++j) {
+          e[j] /= h;
+          f += e[j] * D(j);
+        }
+        const ValueType hh = f / (h + h);
+        for (int j = 0; j < i; ++j) e[j] -= hh * D(j);
+
+        // rank-2 update of the active block
+        for (int j = 0; j < i; ++j) {
+          f = D(j);
+          g = e[j];
+          for (int k = j; k <= i - 1; ++k) V(k, j) -= (f * e[k] + g * D(k));
+          D(j)    = V(i - 1, j);
+          V(i, j) = zero;
+        }
+      }
+      D(i) = h;
+    }
+
+    /// accumulate the reflectors
+    for (int i = 0; i < m - 1; ++i) {
+      V(m - 1, i)       = V(i, i);
+      V(i, i)           = one;
+      const ValueType h = D(i + 1);
+      if (h != zero) {
+        for (int k = 0; k <= i; ++k) D(k) = V(k, i + 1) / h;
+        for (int j = 0; j <= i; ++j) {
+          ValueType g(0);
+          for (int k = 0; k <= i; ++k) g += V(k, i + 1) * V(k, j);
+          for (int k = 0; k <= i; ++k) V(k, j) -= g * D(k);
+        }
+      }
+      for (int k = 0; k <= i; ++k) V(k, i + 1) = zero;
+    }
+    for (int j = 0; j < m; ++j) {
+      D(j)        = V(m - 1, j);
+      V(m - 1, j) = zero;
+    }
+    V(m - 1, m - 1) = one;
+    e[0]            = zero;
+
+    /// implicit QL on the tridiagonal matrix
+    for (int i = 1; i < m; ++i) e[i - 1] = e[i];
+    e[m - 1] = zero;
+
+    ValueType f(0), tst1(0);
+    const ValueType eps = ats::epsilon();
+    for (int l = 0; l < m; ++l) {
+      const ValueType t = ats::abs(D(l)) + ats::abs(e[l]);
+      if (t > tst1) tst1 = t;
+
+      // the first negligible subdiagonal below l; e[m - 1] is zero
+      int n = l;
+      while (n < m - 1 && !(ats::abs(e[n]) <= eps * tst1)) ++n;
+
+      if (n > l) {
+        int iter = 0;
+        do {
+          if (++iter > max_iterations) return 1;
+
+          // the Wilkinson shift
+          ValueType g = D(l);
+          ValueType p = (D(l + 1) - g) / (2 * e[l]);
+          ValueType r = Kokkos::sqrt(p * p + one);
+          if (p < zero) r = -r;
+          D(l)               = e[l] / (p + r);
+          D(l + 1)           = e[l] * (p + r);
+          const ValueType dl1 = D(l + 1);
+          ValueType h         = g - D(l);
+          for (int i = l + 2; i < m; ++i) D(i) -= h;
+          f += h;
+
+          // the implicit QL sweep from n up to l
+          p = D(n);
+          ValueType c(1), c2(1), c3(1), s(0), s2(0);
+          const ValueType el1 = e[l + 1];
+          for (int i = n - 1; i >= l; --i) {
+            c3       = c2;
+            c2       = c;
+            s2       = s;
+            g        = c * e[i];
+            h        = c * p;
+            r        = Kokkos::sqrt(p * p + e[i] * e[i]);
+            e[i + 1] = s * r;
+            s        = e[i] / r;
+            c        = p / r;
+            p        = c * D(i) - s * g;
+            D(i + 1) = h + s * (c * g + s * D(i));
+            for (int k = 0; k < m; ++k) {
+              h           = V(k, i + 1);
+              V(k, i + 1) = s * V(k, i) + c * h;
+              V(k, i)     = c * V(k, i) - s * h;
+            }
+          }
+          p    = -s * s2 * c3 * el1 * e[l] / dl1;
+          e[l] = s * p;
+          D(l) = c * p;
+        } while (ats::abs(e[l]) > eps * tst1);
+      }
+      D(l) = D(l) + f;
+      e[l] = zero;
+    }
+
+    /// selection sort into ascending order
+    for (int i = 0; i < m - 1; ++i) {
+      int k = i;
+      for (int j = i + 1; j < m; ++j)
+        if (D(j) < D(k)) k = j;
+      if (k == i) continue;
+      const ValueType t = D(k);
+      D(k)              = D(i);
+      D(i)              = t;
+      for (int j = 0; j < m; ++j) {
+        const ValueType v = V(j, i);
+        V(j, i)           = V(j, k);
+        V(j, k)           = v;
+      }
+    }
+    return 0;
+  }
+};
+
+}  // namespace KokkosBatched
+
+#endif
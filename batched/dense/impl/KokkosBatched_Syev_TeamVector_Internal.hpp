@@ -0,0 +1,203 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_SYEV_TEAMVECTOR_INTERNAL_HPP__
+#define __KOKKOSBATCHED_SYEV_TEAMVECTOR_INTERNAL_HPP__
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_SVD_TeamVector_Internal.hpp"
+
+namespace KokkosBatched {
+
+///
+/// TeamVector Internal Impl
+/// ========================
+///
+/// Eigendecomposition of a real symmetric m x m matrix A = V * diag(d) * V^T
+/// with the cyclic (two-sided) Jacobi method. A sweep visits every off-diagonal
+/// entry in the round-robin ordering used by TeamVectorSVDInternal; the
+/// rotations of a round act on disjoint row and column pairs, so they are
+/// computed in parallel over the threads of the team, then applied to the
+/// rows and, after a barrier, to the columns, each over the vector lanes.
+///
+/// Only the lower (or upper) triangle of A is referenced on entry; on exit A
+/// holds the eigenvectors in columns and d the eigenvalues in ascending
+/// order. w is workspace of length m * m + m + 1.
+///
+/// Returns 0 on success, or 1 if the sweeps did not converge within
+/// max_sweeps.
+///
+struct TeamVectorSyevInternal {
+  static constexpr int max_sweeps = 30;
+
+  template <typename MemberType, typename ValueType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const bool lower, const int m,
+                                           ValueType *KOKKOS_RESTRICT A,
+                                           const int as0, const int as1,
+                                           ValueType *KOKKOS_RESTRICT d,
+                                           const int ds0,
+                                           ValueType *KOKKOS_RESTRICT w) {
+    using ats = Kokkos::ArithTraits<ValueType>;
+    static_assert(!ats::is_complex,
+                  "KokkosBatched::TeamVectorSyev: only real-valued matrices "
+                  "are supported");
+    const ValueType zero(0), one(1);
+    const ValueType tol = ats::epsilon();
+
+    // V is m x m, column major; cs holds the rotation of each pair of a round
+    ValueType *KOKKOS_RESTRICT V  = w;
+    ValueType *KOKKOS_RESTRICT cs = w + m * m;
+
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(member, m * m),
+                         [&](const int &ij) {
+                           const int i = ij / m, j = ij % m;
+                           if (j < i) {
+                             if (lower)
+                               A[j * as0 + i * as1] = A[i * as0 + j * as1];
+                             else
+                               A[i * as0 + j * as1] = A[j * as0 + i * as1];
+                           }
+                           V[i + j * m] = i == j ? one : zero;
+                         });
+    member.team_barrier();
+
+    const int nn     = m + (m % 2);
+    const int npairs = nn / 2;
+    int converged    = m < 2;
+    for (int sweep = 0; sweep < max_sweeps && !converged; ++sweep) {
+      int nrot = 0;
+      for (int r = 0; r < nn - 1; ++r) {
+        // the rotations; a pair is skipped when its off-diagonal entry is
+        // negligible
+        int nrot_round = 0;
+        Kokkos::parallel_reduce(
+            Kokkos::TeamThreadRange(member, npairs),
+            [&](const int &k, int &update) {
+              int p, q;
+              TeamVectorSVDInternal::round_robin_pair(nn, r, k, p, q);
+              ValueType c(1), s(0);
+              if (p < m && q < m) {
+                const ValueType app = A[p * as0 + p * as1];
+                const ValueType aqq = A[q * as0 + q * as1];
+                const ValueType apq = A[p * as0 + q * as1];
+                if (ats::abs(apq) >
+                    tol * Kokkos::sqrt(ats::abs(app) * ats::abs(aqq))) {
+                  const ValueType tau = (aqq - app) / (2 * apq);
+                  const ValueType t =
+                      (tau >= zero ? one : -one) /
+                      (ats::abs(tau) + Kokkos::sqrt(one + tau * tau));
+                  c = one / Kokkos::sqrt(one + t * t);
+                  s = c * t;
+                  Kokkos::single(Kokkos::PerThread(member),
+                                 [&]() { ++update; });
+                }
+              }
+              Kokkos::single(Kokkos::PerThread(member), [&]() {
+                cs[2 * k]     = c;
+                cs[2 * k + 1] = s;
+              });
+            },
+            nrot_round);
+        member.team_barrier();
+        if (nrot_round == 0) continue;
+        nrot += nrot_round;
+
+        // J^T * A, rows p and q
+        Kokkos::parallel_for(
+            Kokkos::TeamThreadRange(member, npairs), [&](const int &k) {
+              int p, q;
+              TeamVectorSVDInternal::round_robin_pair(nn, r, k, p, q);
+              const ValueType c = cs[2 * k], s = cs[2 * k + 1];
+              if (p >= m || q >= m || s == zero) return;
+              ValueType *KOKKOS_RESTRICT ap = A + p * as0;
+              ValueType *KOKKOS_RESTRICT aq = A + q * as0;
+              Kokkos::parallel_for(Kokkos::ThreadVectorRange(member, m),
+                                   [&](const int &l) {
+                                     const ValueType x = ap[l * as1];
+                                     const ValueType y = aq[l * as1];
+                                     ap[l * as1]       = c * x - s * y;
+                                     aq[l * as1]       = s * x + c * y;
+                                   });
+            });
+        member.team_barrier();
+
+        // (J^T * A) * J and V * J, columns p and q
+        Kokkos::parallel_for(
+            Kokkos::TeamThreadRange(member, npairs), [&](const int &k) {
+              int p, q;
+              TeamVectorSVDInternal::round_robin_pair(nn, r, k, p, q);
+              const ValueType c = cs[2 * k], s = cs[2 * k + 1];
+              if (p >= m || q >= m || s == zero) return;
+              ValueType *KOKKOS_RESTRICT ap = A + p * as1;
+              ValueType *KOKKOS_RESTRICT aq = A + q * as1;
+              ValueType *KOKKOS_RESTRICT vp = V + p * m;
+              ValueType *KOKKOS_RESTRICT vq = V + q * m;
+              Kokkos::parallel_for(Kokkos::ThreadVectorRange(member, m),
+                                   [&](const int &l) {
+                                     const ValueType x = ap[l * as0];
+                                     const ValueType y = aq[l * as0];
+                                     ap[l * as0]       = c * x - s * y;
+                                     aq[l * as0]       = s * x + c * y;
+                                     const ValueType u = vp[l];
+                                     const ValueType v = vq[l];
+                                     vp[l]             = c * u - s * v;
+                                     vq[l]             = s * u + c * v;
+                                   });
+            });
+        member.team_barrier();
+      }
+      converged = nrot == 0;
+    }
+
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(member, m), [&](const int &i) {
+      d[i * ds0] = A[i * as0 + i * as1];
+    });
+    member.team_barrier();
+
+    // selection sort into ascending order; every thread finds the same
+    // minimum, then the columns of V are swapped by the team
+    for (int i = 0; i < m - 1; ++i) {
+      int k = i;
+      for (int j = i + 1; j < m; ++j)
+        if (d[j * ds0] < d[k * ds0]) k = j;
+      if (k == i) continue;
+      Kokkos::parallel_for(Kokkos::TeamVectorRange(member, m),
+                           [&](const int &l) {
+                             const ValueType t = V[l + i * m];
+                             V[l + i * m]      = V[l + k * m];
+                             V[l + k * m]      = t;
+                           });
+      Kokkos::single(Kokkos::PerTeam(member), [&]() {
+        const ValueType t = d[i * ds0];
+        d[i * ds0]        = d[k * ds0];
+        d[k * ds0]        = t;
+      });
+      member.team_barrier();
+    }
+
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(member, m * m),
+                         [&](const int &ij) {
+                           const int i = ij / m, j = ij % m;
+                           A[i * as0 + j * as1] = V[i + j * m];
+                         });
+    member.team_barrier();
+    return !converged;
+  }
+};
+
+}  // namespace KokkosBatched
+
+#endif
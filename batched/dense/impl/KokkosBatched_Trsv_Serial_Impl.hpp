@@ -20,6 +20,7 @@
 
 #include "KokkosBatched_Util.hpp"
 #include "KokkosBatched_Trsv_Serial_Internal.hpp"
+#include "KokkosBatched_FixedSize_Serial_Internal.hpp"
 
 namespace KokkosBatched {
 
@@ -90,6 +91,11 @@ struct SerialTrsv<Uplo::Lower, Trans::NoTranspose, ArgDiag,
   KOKKOS_INLINE_FUNCTION static int invoke(const ScalarType alpha,
                                            const AViewType &A,
                                            const bViewType &b) {
+    if constexpr (is_fixed_size_v<AViewType, bViewType>)
+      return SerialTrsvInternalFixed<AViewType::static_extent(0)>::
+          template invoke<true>(ArgDiag::use_unit_diag, alpha, A.data(),
+                                A.stride_0(), A.stride_1(), b.data(),
+                                b.stride_0());
     return SerialTrsvInternalLower<Algo::Trsv::Unblocked>::invoke(
         ArgDiag::use_unit_diag, A.extent(0), alpha, A.data(), A.stride_0(),
         A.stride_1(), b.data(), b.stride_0());
@@ -165,6 +171,11 @@ struct SerialTrsv<Uplo::Lower, Trans::Transpose, ArgDiag,
   KOKKOS_INLINE_FUNCTION static int invoke(const ScalarType alpha,
                                            const AViewType &A,
                                            const bViewType &b) {
+    if constexpr (is_fixed_size_v<AViewType, bViewType>)
+      return SerialTrsvInternalFixed<AViewType::static_extent(0)>::
+          template invoke<false>(ArgDiag::use_unit_diag, alpha, A.data(),
+                                 A.stride_1(), A.stride_0(), b.data(),
+                                 b.stride_0());
     return SerialTrsvInternalUpper<Algo::Trsv::Unblocked>::invoke(
         ArgDiag::use_unit_diag, A.extent(1), alpha, A.data(), A.stride_1(),
         A.stride_0(), b.data(), b.stride_0());
@@ -239,6 +250,11 @@ struct SerialTrsv<Uplo::Upper, Trans::NoTranspose, ArgDiag,
   KOKKOS_INLINE_FUNCTION static int invoke(const ScalarType alpha,
                                            const AViewType &A,
                                            const bViewType &b) {
+    if constexpr (is_fixed_size_v<AViewType, bViewType>)
+      return SerialTrsvInternalFixed<AViewType::static_extent(0)>::
+          template invoke<false>(ArgDiag::use_unit_diag, alpha, A.data(),
+                                 A.stride_0(), A.stride_1(), b.data(),
+                                 b.stride_0());
     return SerialTrsvInternalUpper<Algo::Trsv::Unblocked>::invoke(
         ArgDiag::use_unit_diag, A.extent(0), alpha, A.data(), A.stride_0(),
         A.stride_1(), b.data(), b.stride_0());
@@ -314,6 +330,11 @@ struct SerialTrsv<Uplo::Upper, Trans::Transpose, ArgDiag,
   KOKKOS_INLINE_FUNCTION static int invoke(const ScalarType alpha,
                                            const AViewType &A,
                                            const bViewType &b) {
+    if constexpr (is_fixed_size_v<AViewType, bViewType>)
+      return SerialTrsvInternalFixed<AViewType::static_extent(0)>::
+          template invoke<true>(ArgDiag::use_unit_diag, alpha, A.data(),
+                                A.stride_1(), A.stride_0(), b.data(),
+                                b.stride_0());
     return SerialTrsvInternalLower<Algo::Trsv::Unblocked>::invoke(
         ArgDiag::use_unit_diag, A.extent(1), alpha, A.data(), A.stride_1(),
         A.stride_0(), b.data(), b.stride_0());
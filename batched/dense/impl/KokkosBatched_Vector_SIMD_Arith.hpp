@@ -27,6 +27,28 @@ namespace KokkosBatched {
 #define KOKKOSKERNELS_SIMD_ARITH_RETURN_REFERENCE_TYPE(T, l) \
   Vector<SIMD<T>, l> &
 
+#if defined(__KOKKOSBATCHED_ENABLE_NEON__)
+// elementwise operator on a vector held in a pair of NEON registers
+#define KOKKOSBATCHED_NEON_X2_BINARY_OPERATOR(T, l, op, intrinsic)   \
+  KOKKOS_FORCEINLINE_FUNCTION static Vector<SIMD<T>, l> operator op( \
+      const Vector<SIMD<T>, l> &a, const Vector<SIMD<T>, l> &b) {    \
+    const Vector<SIMD<T>, l>::data_type x = a, y = b;                \
+    Vector<SIMD<T>, l>::data_type r;                                 \
+    r.val[0] = intrinsic(x.val[0], y.val[0]);                        \
+    r.val[1] = intrinsic(x.val[1], y.val[1]);                        \
+    return r;                                                        \
+  }
+#endif
+#if defined(__KOKKOSBATCHED_ENABLE_SVE__)
+// elementwise operator on a vector held in one fixed-length SVE register
+#define KOKKOSBATCHED_SVE_BINARY_OPERATOR(T, l, op, intrinsic, ptrue) \
+  KOKKOS_FORCEINLINE_FUNCTION static Vector<SIMD<T>, l> operator op(  \
+      const Vector<SIMD<T>, l> &a, const Vector<SIMD<T>, l> &b) {     \
+    using data_type = Vector<SIMD<T>, l>::data_type;                  \
+    return data_type(intrinsic(ptrue(), data_type(a), data_type(b))); \
+  }
+#endif
+
 /// simd, simd
 #if defined(__KOKKOSBATCHED_ENABLE_AVX__)
 #if defined(__AVX512F__)
@@ -65,6 +87,20 @@ operator+(const Vector<SIMD<Kokkos::complex<double> >, 2> &a,
 #endif
 #endif
 
+#if defined(__KOKKOSBATCHED_ENABLE_NEON__)
+#if !defined(__KOKKOSBATCHED_ENABLE_SVE__) || (__ARM_FEATURE_SVE_BITS != 256)
+KOKKOSBATCHED_NEON_X2_BINARY_OPERATOR(double, 4, +, vaddq_f64)
+KOKKOSBATCHED_NEON_X2_BINARY_OPERATOR(float, 8, +, vaddq_f32)
+#endif
+KOKKOSBATCHED_NEON_X2_BINARY_OPERATOR(Kokkos::complex<double>, 2, +, vaddq_f64)
+#endif
+#if defined(__KOKKOSBATCHED_ENABLE_SVE__)
+KOKKOSBATCHED_SVE_BINARY_OPERATOR(double, __ARM_FEATURE_SVE_BITS / 64, +,
+                                  svadd_f64_x, svptrue_b64)
+KOKKOSBATCHED_SVE_BINARY_OPERATOR(float, __ARM_FEATURE_SVE_BITS / 32, +,
+                                  svadd_f32_x, svptrue_b32)
+#endif
+
 template <typename T, int l>
 KOKKOS_FORCEINLINE_FUNCTION static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(T, l)
 operator+(const Vector<SIMD<T>, l> &a, const Vector<SIMD<T>, l> &b) {
@@ -256,6 +292,20 @@ operator-(const Vector<SIMD<Kokkos::complex<double> >, 2> &a,
 #endif
 #endif
 
+#if defined(__KOKKOSBATCHED_ENABLE_NEON__)
+#if !defined(__KOKKOSBATCHED_ENABLE_SVE__) || (__ARM_FEATURE_SVE_BITS != 256)
+KOKKOSBATCHED_NEON_X2_BINARY_OPERATOR(double, 4, -, vsubq_f64)
+KOKKOSBATCHED_NEON_X2_BINARY_OPERATOR(float, 8, -, vsubq_f32)
+#endif
+KOKKOSBATCHED_NEON_X2_BINARY_OPERATOR(Kokkos::complex<double>, 2, -, vsubq_f64)
+#endif
+#if defined(__KOKKOSBATCHED_ENABLE_SVE__)
+KOKKOSBATCHED_SVE_BINARY_OPERATOR(double, __ARM_FEATURE_SVE_BITS / 64, -,
+                                  svsub_f64_x, svptrue_b64)
+KOKKOSBATCHED_SVE_BINARY_OPERATOR(float, __ARM_FEATURE_SVE_BITS / 32, -,
+                                  svsub_f32_x, svptrue_b32)
+#endif
+
 template <typename T, int l>
 KOKKOS_FORCEINLINE_FUNCTION static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(T, l)
 operator-(const Vector<SIMD<T>, l> &a, const Vector<SIMD<T>, l> &b) {
@@ -485,6 +535,36 @@ static Vector<SIMD<Kokkos::complex<double> >, 2> operator*(
 #endif
 #endif
 
+#if defined(__KOKKOSBATCHED_ENABLE_NEON__)
+#if !defined(__KOKKOSBATCHED_ENABLE_SVE__) || (__ARM_FEATURE_SVE_BITS != 256)
+KOKKOSBATCHED_NEON_X2_BINARY_OPERATOR(double, 4, *, vmulq_f64)
+KOKKOSBATCHED_NEON_X2_BINARY_OPERATOR(float, 8, *, vmulq_f32)
+#endif
+
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<double>, 2)
+operator*(const Vector<SIMD<Kokkos::complex<double> >, 2> &a,
+          const Vector<SIMD<Kokkos::complex<double> >, 2> &b) {
+  const float64x2x2_t x = a, y = b;
+  const float64x2_t sign = {-1.0, 1.0};
+  float64x2x2_t r;
+  for (int k = 0; k < 2; ++k) {
+    // (ar * br - ai * bi, ai * br + ar * bi)
+    const float64x2_t xs = vextq_f64(x.val[k], x.val[k], 1),
+                      br = vdupq_laneq_f64(y.val[k], 0),
+                      bi = vmulq_f64(vdupq_laneq_f64(y.val[k], 1), sign);
+    r.val[k] = vfmaq_f64(vmulq_f64(x.val[k], br), xs, bi);
+  }
+  return r;
+}
+#endif
+#if defined(__KOKKOSBATCHED_ENABLE_SVE__)
+KOKKOSBATCHED_SVE_BINARY_OPERATOR(double, __ARM_FEATURE_SVE_BITS / 64, *,
+                                  svmul_f64_x, svptrue_b64)
+KOKKOSBATCHED_SVE_BINARY_OPERATOR(float, __ARM_FEATURE_SVE_BITS / 32, *,
+                                  svmul_f32_x, svptrue_b32)
+#endif
+
 template <typename T, int l>
 KOKKOS_FORCEINLINE_FUNCTION static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(T, l)
 operator*(const Vector<SIMD<T>, l> &a, const Vector<SIMD<T>, l> &b) {
@@ -750,6 +830,38 @@ operator/(Vector<SIMD<Kokkos::complex<double> >, 2> const &a,
 #endif
 #endif
 
+#if defined(__KOKKOSBATCHED_ENABLE_NEON__)
+#if !defined(__KOKKOSBATCHED_ENABLE_SVE__) || (__ARM_FEATURE_SVE_BITS != 256)
+KOKKOSBATCHED_NEON_X2_BINARY_OPERATOR(double, 4, /, vdivq_f64)
+KOKKOSBATCHED_NEON_X2_BINARY_OPERATOR(float, 8, /, vdivq_f32)
+#endif
+
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<double>, 2)
+operator/(const Vector<SIMD<Kokkos::complex<double> >, 2> &a,
+          const Vector<SIMD<Kokkos::complex<double> >, 2> &b) {
+  const float64x2x2_t x = a, y = b;
+  const float64x2_t sign = {1.0, -1.0};
+  float64x2x2_t r;
+  for (int k = 0; k < 2; ++k) {
+    // a * conj(b) / |b|^2
+    const float64x2_t xs = vextq_f64(x.val[k], x.val[k], 1),
+                      br = vdupq_laneq_f64(y.val[k], 0),
+                      bi = vmulq_f64(vdupq_laneq_f64(y.val[k], 1), sign),
+                      b2 = vmulq_f64(y.val[k], y.val[k]);
+    r.val[k] = vdivq_f64(vfmaq_f64(vmulq_f64(x.val[k], br), xs, bi),
+                         vaddq_f64(b2, vextq_f64(b2, b2, 1)));
+  }
+  return r;
+}
+#endif
+#if defined(__KOKKOSBATCHED_ENABLE_SVE__)
+KOKKOSBATCHED_SVE_BINARY_OPERATOR(double, __ARM_FEATURE_SVE_BITS / 64, /,
+                                  svdiv_f64_x, svptrue_b64)
+KOKKOSBATCHED_SVE_BINARY_OPERATOR(float, __ARM_FEATURE_SVE_BITS / 32, /,
+                                  svdiv_f32_x, svptrue_b32)
+#endif
+
 template <typename T, int l>
 KOKKOS_FORCEINLINE_FUNCTION static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(T, l)
 operator/(const Vector<SIMD<T>, l> &a, const Vector<SIMD<T>, l> &b) {
@@ -897,6 +1009,9 @@ operator/=(Vector<SIMD<Kokkos::complex<T> >, l> &a,
 }
 #undef KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE
 #undef KOKKOSKERNELS_SIMD_ARITH_RETURN_REFERENCE_TYPE
+#undef KOKKOSBATCHED_NEON_X2_BINARY_OPERATOR
+#undef KOKKOSBATCHED_SVE_BINARY_OPERATOR
+
 }  // namespace KokkosBatched
 
 #endif
@@ -29,6 +29,41 @@ namespace KokkosBatched {
 
 /// simd
 
+#if defined(__KOKKOSBATCHED_ENABLE_NEON__)
+#if !defined(__KOKKOSBATCHED_ENABLE_SVE__) || (__ARM_FEATURE_SVE_BITS != 256)
+KOKKOS_INLINE_FUNCTION static KOKKOSKERNELS_SIMD_MATH_RETURN_TYPE(double, 4)
+    sqrt(const Vector<SIMD<double>, 4> &a) {
+  float64x2x2_t r = a;
+  r.val[0]        = vsqrtq_f64(r.val[0]);
+  r.val[1]        = vsqrtq_f64(r.val[1]);
+  return r;
+}
+
+KOKKOS_INLINE_FUNCTION static KOKKOSKERNELS_SIMD_MATH_RETURN_TYPE(float, 8)
+    sqrt(const Vector<SIMD<float>, 8> &a) {
+  float32x4x2_t r = a;
+  r.val[0]        = vsqrtq_f32(r.val[0]);
+  r.val[1]        = vsqrtq_f32(r.val[1]);
+  return r;
+}
+#endif
+#endif
+#if defined(__KOKKOSBATCHED_ENABLE_SVE__)
+KOKKOS_INLINE_FUNCTION static KOKKOSKERNELS_SIMD_MATH_RETURN_TYPE(
+    double, __ARM_FEATURE_SVE_BITS / 64)
+    sqrt(const Vector<SIMD<double>, __ARM_FEATURE_SVE_BITS / 64> &a) {
+  return kokkosbatched_sve_f64_t(
+      svsqrt_f64_x(svptrue_b64(), kokkosbatched_sve_f64_t(a)));
+}
+
+KOKKOS_INLINE_FUNCTION static KOKKOSKERNELS_SIMD_MATH_RETURN_TYPE(
+    float, __ARM_FEATURE_SVE_BITS / 32)
+    sqrt(const Vector<SIMD<float>, __ARM_FEATURE_SVE_BITS / 32> &a) {
+  return kokkosbatched_sve_f32_t(
+      svsqrt_f32_x(svptrue_b32(), kokkosbatched_sve_f32_t(a)));
+}
+#endif
+
 template <typename T, int l>
 KOKKOS_INLINE_FUNCTION static KOKKOSKERNELS_SIMD_MATH_RETURN_TYPE(T, l)
     sqrt(const Vector<SIMD<T>, l> &a) {
@@ -55,6 +55,12 @@ struct TeamApplyQ {
 ///
 /// TeamVector ApplyQ
 ///
+/// Algo::ApplyQ::Unblocked applies one reflector at a time and needs w of
+/// size NumCols(B) (Left) or NumRows(B) (Right). Algo::ApplyQ::Blocked
+/// applies nb reflectors at a time in compact WY form and needs w of size
+/// nb * (nb + NumCols(B)) (Left) or nb * (nb + NumRows(B)) (Right), where
+/// nb = TeamVectorHouseholderWY_Internal::max_block_size.
+///
 
 template <typename MemberType, typename ArgSide, typename ArgTrans,
           typename ArgAlgo>
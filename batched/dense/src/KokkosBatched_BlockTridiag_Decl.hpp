@@ -0,0 +1,127 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_BLOCKTRIDIAG_DECL_HPP__
+#define __KOKKOSBATCHED_BLOCKTRIDIAG_DECL_HPP__
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+
+namespace KokkosBatched {
+
+///
+/// Direct solver for block tridiagonal systems of l block rows of blk x blk
+/// blocks: A (l x blk x blk) holds the diagonal blocks, B (l - 1 x blk x blk)
+/// the superdiagonal blocks (B(k) is in block row k) and C (l - 1 x blk x
+/// blk) the subdiagonal blocks (C(k) is in block row k + 1); B and C may
+/// have extra trailing blocks, which are ignored.
+///
+/// BlockTridiagFactorize computes the block LU factorization in place,
+/// without pivoting, so the system should be block diagonally dominant:
+/// A(k) is overwritten by the LU factors of the k-th Schur complement, B(k)
+/// by inv(L(k)) B(k) and C(k) by C(k) inv(U(k)). BlockTridiagSolve then
+/// solves with the factors, which can be reused for any number of solves.
+/// X is overwritten by the solution; it is either l x blk for one right hand
+/// side or l x blk x nrhs for several.
+///
+/// All views may have Vector<SIMD<T>> value types, to factorize and solve
+/// one system per lane of interleaved data.
+///
+
+template <typename ArgAlgo>
+struct SerialBlockTridiagFactorize {
+  template <typename AViewType, typename BViewType, typename CViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const AViewType &A,
+                                           const BViewType &B,
+                                           const CViewType &C);
+};
+
+template <typename MemberType, typename ArgAlgo>
+struct TeamBlockTridiagFactorize {
+  template <typename AViewType, typename BViewType, typename CViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const AViewType &A,
+                                           const BViewType &B,
+                                           const CViewType &C);
+};
+
+template <typename ArgAlgo>
+struct SerialBlockTridiagSolve {
+  template <typename AViewType, typename BViewType, typename CViewType,
+            typename XViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const AViewType &A,
+                                           const BViewType &B,
+                                           const CViewType &C,
+                                           const XViewType &X);
+};
+
+template <typename MemberType, typename ArgAlgo>
+struct TeamBlockTridiagSolve {
+  template <typename AViewType, typename BViewType, typename CViewType,
+            typename XViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const AViewType &A,
+                                           const BViewType &B,
+                                           const CViewType &C,
+                                           const XViewType &X);
+};
+
+///
+/// Selective Interface
+///
+template <typename MemberType, typename ArgMode, typename ArgAlgo>
+struct BlockTridiagFactorize {
+  template <typename AViewType, typename BViewType, typename CViewType>
+  KOKKOS_FORCEINLINE_FUNCTION static int invoke(const MemberType &member,
+                                                const AViewType &A,
+                                                const BViewType &B,
+                                                const CViewType &C) {
+    int r_val = 0;
+    if (std::is_same<ArgMode, Mode::Serial>::value) {
+      r_val = SerialBlockTridiagFactorize<ArgAlgo>::invoke(A, B, C);
+    } else if (std::is_same<ArgMode, Mode::Team>::value) {
+      r_val = TeamBlockTridiagFactorize<MemberType, ArgAlgo>::invoke(member, A,
+                                                                     B, C);
+    }
+    return r_val;
+  }
+};
+
+template <typename MemberType, typename ArgMode, typename ArgAlgo>
+struct BlockTridiagSolve {
+  template <typename AViewType, typename BViewType, typename CViewType,
+            typename XViewType>
+  KOKKOS_FORCEINLINE_FUNCTION static int invoke(const MemberType &member,
+                                                const AViewType &A,
+                                                const BViewType &B,
+                                                const CViewType &C,
+                                                const XViewType &X) {
+    int r_val = 0;
+    if (std::is_same<ArgMode, Mode::Serial>::value) {
+      r_val = SerialBlockTridiagSolve<ArgAlgo>::invoke(A, B, C, X);
+    } else if (std::is_same<ArgMode, Mode::Team>::value) {
+      r_val = TeamBlockTridiagSolve<MemberType, ArgAlgo>::invoke(member, A, B,
+                                                                 C, X);
+    }
+    return r_val;
+  }
+};
+
+}  // namespace KokkosBatched
+
+#include "KokkosBatched_BlockTridiag_Serial_Impl.hpp"
+#include "KokkosBatched_BlockTridiag_Team_Impl.hpp"
+
+#endif
@@ -154,8 +154,140 @@ struct TeamVectorGesv {
                                            const VectorType Y);
 };
 
+/// \brief Serial Batched GESV factorization:
+///
+/// Computes the factors of A_l used by SerialGesvSolve, so that the same
+/// matrix can be solved against several right-hand sides (possibly at
+/// different times) without being factored again.
+///
+/// \tparam MatrixType: Input type for the matrix, needs to be a 2D view
+/// \tparam PivotType: Input type for the pivots, needs to be a 1D view of
+/// integers
+///
+/// \param A [in/out]: matrix, a rank 2 view; with StaticPivoting A is
+/// overwritten by its scaled version
+/// \param F [out]: factors, a rank 2 view of dimension n x (n+2); the first
+/// n columns hold the LU factors and the last two the row and column scaling
+/// \param piv [out]: row permutation, a rank 1 view of dimension n
+/// \param tmp [in]: a rank 2 view used to store temporary variable; dimension
+/// must be n x 4 where n is the number of rows.
+///
+/// With NoPivoting, piv and tmp are not used and F may alias A.
+///
+/// No nested parallel_for is used inside of the function.
+///
+
+template <typename ArgAlgo>
+struct SerialGesvFactorize {
+  template <typename MatrixType, typename FactorType, typename PivotType,
+            typename TmpType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MatrixType A,
+                                           const FactorType F,
+                                           const PivotType piv,
+                                           const TmpType tmp);
+};
+
+/// \brief Serial Batched GESV solve:
+///
+/// Solve A_l X_l = Y_l using the factors computed by SerialGesvFactorize.
+///
+/// \tparam FactorType: Input type for the factors, needs to be a 2D view
+/// \tparam XViewType: Input type for the solution, needs to be a 1D view or
+/// a 2D view with one column per right-hand side
+/// \tparam YViewType: Input type for the right-hand side, same rank as X
+///
+/// \param F [in]: factors computed by SerialGesvFactorize
+/// \param piv [in]: row permutation computed by SerialGesvFactorize
+/// \param X [out]: solution, must not alias Y
+/// \param Y [in]: right-hand side
+///
+/// No nested parallel_for is used inside of the function.
+///
+
+template <typename ArgAlgo>
+struct SerialGesvSolve {
+  template <typename FactorType, typename PivotType, typename XViewType,
+            typename YViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const FactorType F,
+                                           const PivotType piv,
+                                           const XViewType X,
+                                           const YViewType Y);
+};
+
+/// \brief Team Batched GESV factorization:
+///
+/// Same as SerialGesvFactorize; the n x 4 temporary is allocated from the
+/// level 0 team scratch.
+///
+/// A nested parallel_for with TeamThreadRange is used.
+///
+
+template <typename MemberType, typename ArgAlgo>
+struct TeamGesvFactorize {
+  template <typename MatrixType, typename FactorType, typename PivotType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const MatrixType A,
+                                           const FactorType F,
+                                           const PivotType piv);
+};
+
+/// \brief Team Batched GESV solve:
+///
+/// Same as SerialGesvSolve.
+///
+/// A nested parallel_for with TeamThreadRange is used.
+///
+
+template <typename MemberType, typename ArgAlgo>
+struct TeamGesvSolve {
+  template <typename FactorType, typename PivotType, typename XViewType,
+            typename YViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const FactorType F,
+                                           const PivotType piv,
+                                           const XViewType X,
+                                           const YViewType Y);
+};
+
+/// \brief Team Vector Batched GESV factorization:
+///
+/// Same as SerialGesvFactorize; the n x 4 temporary is allocated from the
+/// level 0 team scratch.
+///
+///   Two nested parallel_for with both TeamVectorRange and ThreadVectorRange
+///   (or one with TeamVectorRange) are used inside.
+///
+
+template <typename MemberType, typename ArgAlgo>
+struct TeamVectorGesvFactorize {
+  template <typename MatrixType, typename FactorType, typename PivotType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const MatrixType A,
+                                           const FactorType F,
+                                           const PivotType piv);
+};
+
+/// \brief Team Vector Batched GESV solve:
+///
+/// Same as SerialGesvSolve.
+///
+///   One nested parallel_for with TeamVectorRange is used inside.
+///
+
+template <typename MemberType, typename ArgAlgo>
+struct TeamVectorGesvSolve {
+  template <typename FactorType, typename PivotType, typename XViewType,
+            typename YViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const FactorType F,
+                                           const PivotType piv,
+                                           const XViewType X,
+                                           const YViewType Y);
+};
+
 }  // namespace KokkosBatched
 
 #include "KokkosBatched_Gesv_Impl.hpp"
+#include "KokkosBatched_GesvFactorize_Impl.hpp"
 
 #endif
@@ -0,0 +1,74 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_GETRF_DECL_HPP__
+#define __KOKKOSBATCHED_GETRF_DECL_HPP__
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+
+namespace KokkosBatched {
+
+///
+/// LU factorization with partial pivoting, P * A = L * U, of an m x n matrix
+/// A, overwritten by the unit lower triangular L and the upper triangular U.
+/// The pivot search runs in parallel over the team.
+///
+/// piv (of length min(m, n)) receives the pivots in the convention of
+/// ApplyPivot: row p was swapped with row p + piv(p). Returns 0 on success, or
+/// p + 1 if U(p, p) is exactly zero (for the first such p); the factorization
+/// is completed in that case, but U is singular.
+///
+
+template <typename MemberType, typename ArgAlgo>
+struct TeamGetrf {
+  template <typename AViewType, typename PivViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const AViewType &A,
+                                           const PivViewType &piv);
+};
+
+template <typename MemberType, typename ArgAlgo>
+struct TeamVectorGetrf {
+  template <typename AViewType, typename PivViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const AViewType &A,
+                                           const PivViewType &piv);
+};
+
+///
+/// Selective Interface
+///
+template <typename MemberType, typename ArgMode, typename ArgAlgo>
+struct Getrf {
+  template <typename AViewType, typename PivViewType>
+  KOKKOS_FORCEINLINE_FUNCTION static int invoke(const MemberType &member,
+                                                const AViewType &A,
+                                                const PivViewType &piv) {
+    int r_val = 0;
+    if (std::is_same<ArgMode, Mode::Team>::value) {
+      r_val = TeamGetrf<MemberType, ArgAlgo>::invoke(member, A, piv);
+    } else if (std::is_same<ArgMode, Mode::TeamVector>::value) {
+      r_val = TeamVectorGetrf<MemberType, ArgAlgo>::invoke(member, A, piv);
+    }
+    return r_val;
+  }
+};
+
+}  // namespace KokkosBatched
+
+#include "KokkosBatched_Getrf_Team_Impl.hpp"
+
+#endif
@@ -0,0 +1,141 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_GETRS_DECL_HPP__
+#define __KOKKOSBATCHED_GETRS_DECL_HPP__
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+#include "KokkosBatched_ApplyPivot_Decl.hpp"
+#include "KokkosBatched_Trsm_Decl.hpp"
+
+namespace KokkosBatched {
+
+///
+/// Solves op(A) * X = B with the factors and pivots of a square A computed by
+/// Getrf; B is a matrix of right-hand sides, overwritten by X. op is
+/// Trans::NoTranspose or Trans::Transpose.
+///
+
+template <typename MemberType, typename ArgTrans, typename ArgAlgo>
+struct TeamGetrs {
+  template <typename AViewType, typename PivViewType, typename BViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const AViewType &A,
+                                           const PivViewType &piv,
+                                           const BViewType &B) {
+    static_assert(std::is_same<ArgTrans, Trans::NoTranspose>::value ||
+                      std::is_same<ArgTrans, Trans::Transpose>::value,
+                  "KokkosBatched::TeamGetrs: ArgTrans must be "
+                  "Trans::NoTranspose or Trans::Transpose");
+    int r_val[2] = {};
+    const typename AViewType::non_const_value_type one(1.0);
+    if constexpr (std::is_same<ArgTrans, Trans::NoTranspose>::value) {
+      // P * B, then L * Y = P * B and U * X = Y
+      TeamVectorApplyPivot<MemberType, Side::Left, Direct::Forward>::invoke(
+          member, piv, B);
+      member.team_barrier();
+      r_val[0] = TeamTrsm<MemberType, Side::Left, Uplo::Lower, ArgTrans,
+                          Diag::Unit, ArgAlgo>::invoke(member, one, A, B);
+      member.team_barrier();
+      r_val[1] = TeamTrsm<MemberType, Side::Left, Uplo::Upper, ArgTrans,
+                          Diag::NonUnit, ArgAlgo>::invoke(member, one, A, B);
+    } else {
+      // U' * Y = B, then L' * Z = Y and X = P' * Z
+      r_val[0] = TeamTrsm<MemberType, Side::Left, Uplo::Upper, ArgTrans,
+                          Diag::NonUnit, ArgAlgo>::invoke(member, one, A, B);
+      member.team_barrier();
+      r_val[1] = TeamTrsm<MemberType, Side::Left, Uplo::Lower, ArgTrans,
+                          Diag::Unit, ArgAlgo>::invoke(member, one, A, B);
+      member.team_barrier();
+      TeamVectorApplyPivot<MemberType, Side::Left, Direct::Backward>::invoke(
+          member, piv, B);
+    }
+    member.team_barrier();
+    return r_val[0] + r_val[1];
+  }
+};
+
+template <typename MemberType, typename ArgTrans, typename ArgAlgo>
+struct TeamVectorGetrs {
+  template <typename AViewType, typename PivViewType, typename BViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const AViewType &A,
+                                           const PivViewType &piv,
+                                           const BViewType &B) {
+    static_assert(std::is_same<ArgTrans, Trans::NoTranspose>::value ||
+                      std::is_same<ArgTrans, Trans::Transpose>::value,
+                  "KokkosBatched::TeamVectorGetrs: ArgTrans must be "
+                  "Trans::NoTranspose or Trans::Transpose");
+    // TeamVectorTrsm only has the unblocked algorithm
+    using trsm_algo_type = Algo::Trsm::Unblocked;
+    int r_val[2]         = {};
+    const typename AViewType::non_const_value_type one(1.0);
+    if constexpr (std::is_same<ArgTrans, Trans::NoTranspose>::value) {
+      TeamVectorApplyPivot<MemberType, Side::Left, Direct::Forward>::invoke(
+          member, piv, B);
+      member.team_barrier();
+      r_val[0] = TeamVectorTrsm<MemberType, Side::Left, Uplo::Lower, ArgTrans,
+                                Diag::Unit, trsm_algo_type>::invoke(member, one,
+                                                                    A, B);
+      member.team_barrier();
+      r_val[1] =
+          TeamVectorTrsm<MemberType, Side::Left, Uplo::Upper, ArgTrans,
+                         Diag::NonUnit, trsm_algo_type>::invoke(member, one, A,
+                                                                B);
+    } else {
+      r_val[0] =
+          TeamVectorTrsm<MemberType, Side::Left, Uplo::Upper, ArgTrans,
+                         Diag::NonUnit, trsm_algo_type>::invoke(member, one, A,
+                                                                B);
+      member.team_barrier();
+      r_val[1] = TeamVectorTrsm<MemberType, Side::Left, Uplo::Lower, ArgTrans,
+                                Diag::Unit, trsm_algo_type>::invoke(member, one,
+                                                                    A, B);
+      member.team_barrier();
+      TeamVectorApplyPivot<MemberType, Side::Left, Direct::Backward>::invoke(
+          member, piv, B);
+    }
+    member.team_barrier();
+    return r_val[0] + r_val[1];
+  }
+};
+
+///
+/// Selective Interface
+///
+template <typename MemberType, typename ArgTrans, typename ArgMode,
+          typename ArgAlgo>
+struct Getrs {
+  template <typename AViewType, typename PivViewType, typename BViewType>
+  KOKKOS_FORCEINLINE_FUNCTION static int invoke(const MemberType &member,
+                                                const AViewType &A,
+                                                const PivViewType &piv,
+                                                const BViewType &B) {
+    int r_val = 0;
+    if (std::is_same<ArgMode, Mode::Team>::value) {
+      r_val =
+          TeamGetrs<MemberType, ArgTrans, ArgAlgo>::invoke(member, A, piv, B);
+    } else if (std::is_same<ArgMode, Mode::TeamVector>::value) {
+      r_val = TeamVectorGetrs<MemberType, ArgTrans, ArgAlgo>::invoke(member, A,
+                                                                     piv, B);
+    }
+    return r_val;
+  }
+};
+
+}  // namespace KokkosBatched
+
+#endif
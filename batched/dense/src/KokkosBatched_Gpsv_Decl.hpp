@@ -0,0 +1,57 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_GPSV_DECL_HPP__
+#define __KOKKOSBATCHED_GPSV_DECL_HPP__
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+#include "KokkosBatched_Gtsv_Serial_Internal.hpp"
+
+namespace KokkosBatched {
+
+///
+/// Solves the pentadiagonal system A * x = b, where A has the second
+/// subdiagonal e (extent n - 2), the subdiagonal dl (extent n - 1), the
+/// diagonal d (extent n), the superdiagonal du (extent n - 1) and the second
+/// superdiagonal f (extent n - 2). There is no pivoting, so A should be
+/// diagonally dominant or symmetric positive definite. e, dl, d, du and b are
+/// overwritten, b by the solution.
+///
+/// Vector<SIMD<T>> value types solve one system per lane on interleaved data.
+/// Returns 0 on success or i + 1 if the i-th pivot is exactly zero (not
+/// checked for vector types).
+///
+
+template <typename ArgAlgo>
+struct SerialGpsv {
+  template <typename EViewType, typename DLViewType, typename DViewType,
+            typename DUViewType, typename FViewType, typename BViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const EViewType &e,
+                                           const DLViewType &dl,
+                                           const DViewType &d,
+                                           const DUViewType &du,
+                                           const FViewType &f,
+                                           const BViewType &b) {
+    return SerialGpsvInternal::invoke(
+        d.extent(0), e.data(), e.stride_0(), dl.data(), dl.stride_0(),
+        d.data(), d.stride_0(), du.data(), du.stride_0(), f.data(),
+        f.stride_0(), b.data(), b.stride_0());
+  }
+};
+
+}  // namespace KokkosBatched
+
+#endif
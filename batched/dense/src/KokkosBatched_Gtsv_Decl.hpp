@@ -0,0 +1,101 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_GTSV_DECL_HPP__
+#define __KOKKOSBATCHED_GTSV_DECL_HPP__
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+
+namespace KokkosBatched {
+
+///
+/// Solves the tridiagonal system A * x = b, where A has the subdiagonal dl
+/// (extent n - 1), the diagonal d (extent n) and the superdiagonal du (extent
+/// n - 1). There is no pivoting, so A should be diagonally dominant or
+/// symmetric positive definite. dl, d and b are overwritten, b by the
+/// solution; the team versions also overwrite du.
+///
+/// SerialGtsv is the Thomas algorithm. It works with Vector<SIMD<T>> value
+/// types, which solve one system per lane on interleaved data; it returns 0
+/// on success or i + 1 if the i-th pivot is exactly zero (not checked for
+/// vector types). TeamGtsv and TeamVectorGtsv use cyclic reduction, log2(n)
+/// levels of independent eliminations spread over the team, for long systems;
+/// they return 0.
+///
+
+template <typename ArgAlgo>
+struct SerialGtsv {
+  template <typename DLViewType, typename DViewType, typename DUViewType,
+            typename BViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const DLViewType &dl,
+                                           const DViewType &d,
+                                           const DUViewType &du,
+                                           const BViewType &b);
+};
+
+template <typename MemberType, typename ArgAlgo>
+struct TeamGtsv {
+  template <typename DLViewType, typename DViewType, typename DUViewType,
+            typename BViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const DLViewType &dl,
+                                           const DViewType &d,
+                                           const DUViewType &du,
+                                           const BViewType &b);
+};
+
+template <typename MemberType, typename ArgAlgo>
+struct TeamVectorGtsv {
+  template <typename DLViewType, typename DViewType, typename DUViewType,
+            typename BViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const DLViewType &dl,
+                                           const DViewType &d,
+                                           const DUViewType &du,
+                                           const BViewType &b);
+};
+
+///
+/// Selective Interface
+///
+template <typename MemberType, typename ArgMode, typename ArgAlgo>
+struct Gtsv {
+  template <typename DLViewType, typename DViewType, typename DUViewType,
+            typename BViewType>
+  KOKKOS_FORCEINLINE_FUNCTION static int invoke(const MemberType &member,
+                                                const DLViewType &dl,
+                                                const DViewType &d,
+                                                const DUViewType &du,
+                                                const BViewType &b) {
+    int r_val = 0;
+    if (std::is_same<ArgMode, Mode::Serial>::value) {
+      r_val = SerialGtsv<ArgAlgo>::invoke(dl, d, du, b);
+    } else if (std::is_same<ArgMode, Mode::Team>::value) {
+      r_val = TeamGtsv<MemberType, ArgAlgo>::invoke(member, dl, d, du, b);
+    } else if (std::is_same<ArgMode, Mode::TeamVector>::value) {
+      r_val =
+          TeamVectorGtsv<MemberType, ArgAlgo>::invoke(member, dl, d, du, b);
+    }
+    return r_val;
+  }
+};
+
+}  // namespace KokkosBatched
+
+#include "KokkosBatched_Gtsv_Serial_Impl.hpp"
+#include "KokkosBatched_Gtsv_Team_Impl.hpp"
+
+#endif
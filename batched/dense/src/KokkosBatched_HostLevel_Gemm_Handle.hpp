@@ -17,6 +17,12 @@
 #ifndef __KOKKOSBATCHED_HOSTLEVEL_GEMM_HANDLE_DECL_HPP__
 #define __KOKKOSBATCHED_HOSTLEVEL_GEMM_HANDLE_DECL_HPP__
 
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <string>
 #include "KokkosBatched_Kernel_Handle.hpp"
 
 namespace KokkosBatched {
@@ -40,6 +46,12 @@ enum GEMM_KOKKOS_BATCHED_ALGOS : int {
 };
 }
 
+/// \brief Gemm specific heuristic algorithm types. See BatchedGemmHandle for
+/// details.
+namespace GemmHeuristicAlgos {
+enum GEMM_HEURISTIC_ALGOS : int { AUTOTUNE = GemmKokkosBatchedAlgos::N, N };
+}
+
 #define GEMM_ALGO_STRS                           \
   "GemmTplAlgos::CUBLAS", "GemmTplAlgos::MAGMA", \
       "GemmKokkosBatchedAlgos::KK_TEAM",         \
@@ -48,7 +60,7 @@ enum GEMM_KOKKOS_BATCHED_ALGOS : int {
       "GemmKokkosBatchedAlgos::KK_TEAMSIMD",     \
       "GemmKokkosBatchedAlgos::KK_SERIAL_RANK0", \
       "GemmKokkosBatchedAlgos::KK_SERIAL_SHMEM", \
-      "GemmKokkosBatchedAlgos::KK_DBLBUF"
+      "GemmKokkosBatchedAlgos::KK_DBLBUF", "GemmHeuristicAlgos::AUTOTUNE"
 // clang-format off
 /// \brief Handle for selecting runtime behavior of the BatchedGemm interface.
 ///
@@ -59,6 +71,10 @@ enum GEMM_KOKKOS_BATCHED_ALGOS : int {
 ///                          SQUARE select invocations based on square matrix heuristics where M=N
 ///                          TALL   select invocations based on tall   matrix heuristics where M>N
 ///                          WIDE   select invocations based on wide   matrix heuristics where M<N
+///                          AUTOTUNE benchmark the supported algorithms on the first call for
+///                                 each (m, n, k, batch, trans, layout, scalar, space) key and
+///                                 invoke the fastest one. Winners are recorded in
+///                                 BatchedGemmAutotuneDatabase, which may persist them to a file.
 ///    
 ///                        Specifies which cmake-enabled TPL algorithm to invoke:
 ///                          ARMPL    Invoke the ArmPL TPL interface  (Currently UNSUPPORTED)
@@ -156,8 +172,101 @@ class BatchedGemmHandle : public BatchedKernelHandle {
   }
 
  private:
-  const char *gemm_algo_type_strs[GemmKokkosBatchedAlgos::N] = {BASE_ALGO_STRS,
-                                                                GEMM_ALGO_STRS};
+  const char *gemm_algo_type_strs[GemmHeuristicAlgos::N] = {BASE_ALGO_STRS,
+                                                            GEMM_ALGO_STRS};
+};
+
+/// \brief Process-wide record of the algorithms selected by
+/// GemmHeuristicAlgos::AUTOTUNE.
+///
+/// Each winner is stored under a key describing the problem (m, n, k, batch
+/// size, transposes, layout, scalar type and execution space). If a file is
+/// set, its entries are loaded and every new winner is appended to it, so that
+/// later runs skip the benchmarks. The file holds one "key algo_type" entry
+/// per line; later entries override earlier ones and lines starting with '#'
+/// are ignored.
+///
+/// The file is taken from the environment variable
+/// KOKKOSKERNELS_BATCHED_GEMM_AUTOTUNE_FILE at startup, or set with
+/// set_file(). Algorithm types are stored as integers, so a file should not be
+/// shared between builds of different Kokkos Kernels versions.
+class BatchedGemmAutotuneDatabase {
+ public:
+  static BatchedGemmAutotuneDatabase &instance() {
+    static BatchedGemmAutotuneDatabase database;
+    return database;
+  }
+
+  /// \brief Loads the entries of path and appends new winners to it. An
+  /// empty path keeps the winners in memory only.
+  void set_file(const std::string &path) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _file = path;
+    _load();
+  }
+
+  std::string get_file() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _file;
+  }
+
+  /// \brief Returns true and sets algo_type if key has a recorded winner.
+  bool find(const std::string &key, int &algo_type) const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    const auto it = _winners.find(key);
+    if (it == _winners.end()) return false;
+    algo_type = it->second;
+    return true;
+  }
+
+  void insert(const std::string &key, const int algo_type) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _winners[key] = algo_type;
+    if (_file.empty()) return;
+    std::ofstream out(_file, std::ios::app);
+    out << key << " " << algo_type << std::endl;
+    if (!out) {
+      std::ostringstream os;
+      os << "KokkosBatched::BatchedGemmAutotuneDatabase: could not write to "
+         << _file;
+      KokkosKernels::Impl::throw_runtime_exception(os.str());
+    }
+  }
+
+  /// \brief Forgets the winners in memory; the file is left untouched.
+  void clear() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _winners.clear();
+  }
+
+ private:
+  BatchedGemmAutotuneDatabase() {
+    const char *path = std::getenv("KOKKOSKERNELS_BATCHED_GEMM_AUTOTUNE_FILE");
+    if (path != nullptr) {
+      _file = path;
+      _load();
+    }
+  }
+
+  void _load() {
+    if (_file.empty()) return;
+    std::ifstream in(_file);
+    std::string key;
+    int algo_type;
+    while (in >> key) {
+      if (key[0] == '#') {
+        in.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+      } else if (in >> algo_type) {
+        _winners[key] = algo_type;
+      } else {
+        break;
+      }
+    }
+  }
+
+  std::map<std::string, int> _winners;
+  std::string _file;
+  mutable std::mutex _mutex;
 };
 
 }  // namespace KokkosBatched
@@ -0,0 +1,155 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_HOSTLEVEL_VARSIZE_HPP__
+#define __KOKKOSBATCHED_HOSTLEVEL_VARSIZE_HPP__
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "KokkosBatched_Vector.hpp"
+#include "KokkosBatched_HostLevel_VarSize_Impl.hpp"
+
+namespace KokkosBatched {
+
+// clang-format off
+/// \brief Team order for a variable-size batch, largest work first.
+///
+/// Handing the biggest matrices out first keeps a few large ones from
+/// finishing last on an otherwise idle device. The order depends only on the
+/// sizes, so compute it once and reuse it for every call on the same batch.
+///
+/// \param m [in], n [in], k [in] Rank-1 views of per-matrix sizes; the work
+///                               of matrix b is taken as m(b) * n(b) * k(b)
+/// \return A rank-1 int view of batch indices in the memory space of m
+// clang-format on
+template <typename SizeViewType>
+inline Kokkos::View<int *, typename SizeViewType::device_type>
+BatchedVarSizeOrder(const SizeViewType &m, const SizeViewType &n,
+                    const SizeViewType &k) {
+  const int N = m.extent(0);
+  auto m_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), m);
+  auto n_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), n);
+  auto k_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), k);
+
+  std::vector<double> work(N);
+  for (int b = 0; b < N; ++b)
+    work[b] = double(m_host(b)) * double(n_host(b)) * double(k_host(b));
+
+  Kokkos::View<int *, typename SizeViewType::device_type> order(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "BatchedVarSizeOrder"),
+      N);
+  auto order_host = Kokkos::create_mirror_view(order);
+  std::vector<int> idx(N);
+  std::iota(idx.begin(), idx.end(), 0);
+  std::stable_sort(idx.begin(), idx.end(),
+                   [&](const int a, const int b) { return work[a] > work[b]; });
+  for (int b = 0; b < N; ++b) order_host(b) = idx[b];
+  Kokkos::deep_copy(order, order_host);
+  return order;
+}
+
+// clang-format off
+/// \brief Non-blocking general matrix multiply on a batch of matrices with
+/// different sizes,
+///
+///        C_b = alpha * op(A_b) * op(B_b) + beta * C_b,  b = 0 .. N-1
+///
+/// Matrix b is stored column major in a flat rank-1 view starting at its
+/// offset, with leading dimension equal to its number of stored rows; no
+/// padding to the largest size is needed. One team computes one product.
+///
+/// \tparam ArgTransA, ArgTransB Trans::NoTranspose or Trans::Transpose
+///
+/// \param alpha [in]            Scalar multiplying op(A_b) * op(B_b)
+/// \param m [in], n [in], k [in] Rank-1 views of sizes; op(A_b) is m(b) x k(b),
+///                              op(B_b) is k(b) x n(b) and C_b is m(b) x n(b)
+/// \param A [in], a_offsets [in] Flat storage of A_b and offsets of each A_b
+/// \param B [in], b_offsets [in] Flat storage of B_b and offsets of each B_b
+/// \param beta [in]             Scalar multiplying C_b
+/// \param C [in/out], c_offsets [in] Flat storage of C_b and offsets of each C_b
+/// \param order [in]            Team order from BatchedVarSizeOrder; an empty
+///                              view runs the batch in index order
+/// \return 0 upon success
+// clang-format on
+template <typename ArgTransA, typename ArgTransB, typename ScalarType,
+          typename SizeViewType, typename OffsetViewType, typename AViewType,
+          typename BViewType, typename CViewType, typename OrderViewType>
+inline int BatchedVarSizeGemm(const ScalarType alpha, const SizeViewType &m,
+                              const SizeViewType &n, const SizeViewType &k,
+                              const AViewType &A,
+                              const OffsetViewType &a_offsets,
+                              const BViewType &B,
+                              const OffsetViewType &b_offsets,
+                              const ScalarType beta, const CViewType &C,
+                              const OffsetViewType &c_offsets,
+                              const OrderViewType &order) {
+  static_assert(!std::is_same<ArgTransA, Trans::ConjTranspose>::value &&
+                    !std::is_same<ArgTransB, Trans::ConjTranspose>::value,
+                "KokkosBatched::BatchedVarSizeGemm: ConjTranspose is not "
+                "supported");
+  using execution_space = typename CViewType::execution_space;
+  using functor_type =
+      Impl::BatchedVarSizeGemmFunctor<ArgTransA, ArgTransB, ScalarType,
+                                      SizeViewType, OffsetViewType, AViewType,
+                                      BViewType, CViewType, OrderViewType>;
+
+  const int N = m.extent(0);
+  Kokkos::TeamPolicy<execution_space> policy(N, Kokkos::AUTO, Kokkos::AUTO);
+  Kokkos::parallel_for("KokkosBatched::BatchedVarSizeGemm", policy,
+                       functor_type(alpha, m, n, k, A, a_offsets, B, b_offsets,
+                                    beta, C, c_offsets, order));
+  return 0;
+}
+
+// clang-format off
+/// \brief Non-blocking LU factorization without pivoting on a batch of square
+/// matrices with different sizes, A_b = L_b U_b in place.
+///
+/// Storage follows BatchedVarSizeGemm: A_b is n(b) x n(b), column major, at
+/// a_offsets(b) in the flat view A. One team factors one matrix.
+///
+/// \param n [in]                Rank-1 view of sizes
+/// \param A [in/out], a_offsets [in] Flat storage of A_b and offsets of each A_b
+/// \param order [in]            Team order from BatchedVarSizeOrder(n, n, n);
+///                              an empty view runs the batch in index order
+/// \param tiny [in]             Pivots are shifted away from zero by tiny
+/// \return 0 upon success
+// clang-format on
+template <typename SizeViewType, typename OffsetViewType, typename AViewType,
+          typename OrderViewType>
+inline int BatchedVarSizeLU(
+    const SizeViewType &n, const AViewType &A, const OffsetViewType &a_offsets,
+    const OrderViewType &order,
+    const typename MagnitudeScalarType<
+        typename AViewType::non_const_value_type>::type tiny = 0) {
+  using execution_space = typename AViewType::execution_space;
+  using mag_type        = typename MagnitudeScalarType<
+      typename AViewType::non_const_value_type>::type;
+  using functor_type =
+      Impl::BatchedVarSizeLUFunctor<SizeViewType, OffsetViewType, AViewType,
+                                    OrderViewType, mag_type>;
+
+  const int N = n.extent(0);
+  Kokkos::TeamPolicy<execution_space> policy(N, Kokkos::AUTO);
+  Kokkos::parallel_for("KokkosBatched::BatchedVarSizeLU", policy,
+                       functor_type(n, A, a_offsets, order, tiny));
+  return 0;
+}
+
+}  // namespace KokkosBatched
+
+#endif
@@ -24,6 +24,7 @@
 #include "KokkosBatched_SetIdentity_Decl.hpp"
 #include "KokkosBatched_SetIdentity_Impl.hpp"
 #include "KokkosBatched_SolveLU_Decl.hpp"
+#include "KokkosBatched_FixedSize_Serial_Internal.hpp"
 
 namespace KokkosBatched {
 
@@ -32,6 +33,11 @@ struct SerialInverseLU {
   template <typename AViewType, typename wViewType>
   KOKKOS_INLINE_FUNCTION static int invoke(const AViewType &A,
                                            const wViewType &w) {
+    // compile-time extents are inverted in registers, without workspace
+    if constexpr (is_fixed_size_v<AViewType>)
+      return SerialInverseLUInternalFixed<AViewType::static_extent(0)>::invoke(
+          A.data(), A.stride_0(), A.stride_1());
+
     typedef typename wViewType::value_type value_type;
     // workspace w is always 1D view; reinterpret it
     Kokkos::View<value_type **, Kokkos::LayoutRight, Kokkos::AnonymousSpace> W(
@@ -0,0 +1,80 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_POTRF_DECL_HPP__
+#define __KOKKOSBATCHED_POTRF_DECL_HPP__
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+
+namespace KokkosBatched {
+
+///
+/// Cholesky factorization of a Hermitian positive definite matrix, without
+/// pivoting: A = L * L^H (Uplo::Lower) or A = U^H * U (Uplo::Upper). Only the
+/// ArgUplo triangle of A is referenced and it is overwritten by the factor.
+///
+/// Returns 0 on success, or p + 1 if the leading minor of order p + 1 is not
+/// positive definite, in which case the factorization stopped at column p (as
+/// LAPACK's info). Vector (SIMD) value types are not checked.
+///
+
+template <typename ArgUplo, typename ArgAlgo>
+struct SerialPotrf {
+  template <typename AViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const AViewType &A);
+};
+
+template <typename MemberType, typename ArgUplo, typename ArgAlgo>
+struct TeamPotrf {
+  template <typename AViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const AViewType &A);
+};
+
+template <typename MemberType, typename ArgUplo, typename ArgAlgo>
+struct TeamVectorPotrf {
+  template <typename AViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const AViewType &A);
+};
+
+///
+/// Selective Interface
+///
+template <typename MemberType, typename ArgUplo, typename ArgMode,
+          typename ArgAlgo>
+struct Potrf {
+  template <typename AViewType>
+  KOKKOS_FORCEINLINE_FUNCTION static int invoke(const MemberType &member,
+                                                const AViewType &A) {
+    int r_val = 0;
+    if (std::is_same<ArgMode, Mode::Serial>::value) {
+      r_val = SerialPotrf<ArgUplo, ArgAlgo>::invoke(A);
+    } else if (std::is_same<ArgMode, Mode::Team>::value) {
+      r_val = TeamPotrf<MemberType, ArgUplo, ArgAlgo>::invoke(member, A);
+    } else if (std::is_same<ArgMode, Mode::TeamVector>::value) {
+      r_val = TeamVectorPotrf<MemberType, ArgUplo, ArgAlgo>::invoke(member, A);
+    }
+    return r_val;
+  }
+};
+
+}  // namespace KokkosBatched
+
+#include "KokkosBatched_Potrf_Serial_Impl.hpp"
+#include "KokkosBatched_Potrf_Team_Impl.hpp"
+
+#endif
@@ -0,0 +1,112 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_POTRS_DECL_HPP__
+#define __KOKKOSBATCHED_POTRS_DECL_HPP__
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+#include "KokkosBatched_Potrf_Serial_Internal.hpp"
+#include "KokkosBatched_Potrf_Team_Internal.hpp"
+
+namespace KokkosBatched {
+
+///
+/// Solves A * X = B with the Cholesky factor of A computed by Potrf with the
+/// same ArgUplo; B (a vector or a matrix of right-hand sides) is overwritten
+/// by X.
+///
+
+namespace Impl {
+template <typename BViewType>
+KOKKOS_INLINE_FUNCTION int potrs_b_stride_1(const BViewType &B) {
+  if constexpr (BViewType::rank == 1)
+    return 0;
+  else
+    return B.stride_1();
+}
+}  // namespace Impl
+
+template <typename ArgUplo, typename ArgAlgo>
+struct SerialPotrs {
+  template <typename AViewType, typename BViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const AViewType &A,
+                                           const BViewType &B) {
+    constexpr bool lower = std::is_same<ArgUplo, Uplo::Lower>::value;
+    // the upper factor U = L^H is conj(L) stored transposed
+    return SerialPotrsInternalLower::invoke(
+        !lower, A.extent(0), B.extent(1), A.data(),
+        lower ? A.stride_0() : A.stride_1(),
+        lower ? A.stride_1() : A.stride_0(), B.data(), B.stride_0(),
+        Impl::potrs_b_stride_1(B));
+  }
+};
+
+template <typename MemberType, typename ArgUplo, typename ArgAlgo>
+struct TeamPotrs {
+  template <typename AViewType, typename BViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const AViewType &A,
+                                           const BViewType &B) {
+    constexpr bool lower = std::is_same<ArgUplo, Uplo::Lower>::value;
+    return TeamPotrsInternalLower<Mode::Team>::invoke(
+        member, !lower, A.extent(0), B.extent(1), A.data(),
+        lower ? A.stride_0() : A.stride_1(),
+        lower ? A.stride_1() : A.stride_0(), B.data(), B.stride_0(),
+        Impl::potrs_b_stride_1(B));
+  }
+};
+
+template <typename MemberType, typename ArgUplo, typename ArgAlgo>
+struct TeamVectorPotrs {
+  template <typename AViewType, typename BViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const AViewType &A,
+                                           const BViewType &B) {
+    constexpr bool lower = std::is_same<ArgUplo, Uplo::Lower>::value;
+    return TeamPotrsInternalLower<Mode::TeamVector>::invoke(
+        member, !lower, A.extent(0), B.extent(1), A.data(),
+        lower ? A.stride_0() : A.stride_1(),
+        lower ? A.stride_1() : A.stride_0(), B.data(), B.stride_0(),
+        Impl::potrs_b_stride_1(B));
+  }
+};
+
+///
+/// Selective Interface
+///
+template <typename MemberType, typename ArgUplo, typename ArgMode,
+          typename ArgAlgo>
+struct Potrs {
+  template <typename AViewType, typename BViewType>
+  KOKKOS_FORCEINLINE_FUNCTION static int invoke(const MemberType &member,
+                                                const AViewType &A,
+                                                const BViewType &B) {
+    int r_val = 0;
+    if (std::is_same<ArgMode, Mode::Serial>::value) {
+      r_val = SerialPotrs<ArgUplo, ArgAlgo>::invoke(A, B);
+    } else if (std::is_same<ArgMode, Mode::Team>::value) {
+      r_val = TeamPotrs<MemberType, ArgUplo, ArgAlgo>::invoke(member, A, B);
+    } else if (std::is_same<ArgMode, Mode::TeamVector>::value) {
+      r_val =
+          TeamVectorPotrs<MemberType, ArgUplo, ArgAlgo>::invoke(member, A, B);
+    }
+    return r_val;
+  }
+};
+
+}  // namespace KokkosBatched
+
+#endif
@@ -53,6 +53,11 @@ struct TeamQR {
 ///
 /// TeamVector QR
 ///
+/// Algo::QR::Unblocked needs w of size NumCols(A). Algo::QR::Blocked factors
+/// panels of nb columns and updates the trailing matrix in compact WY form;
+/// it needs w of size nb * (nb + NumCols(A)), where
+/// nb = TeamVectorHouseholderWY_Internal::max_block_size.
+///
 
 template <typename MemberType, typename ArgAlgo>
 struct TeamVectorQR {
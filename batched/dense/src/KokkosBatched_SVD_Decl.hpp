@@ -71,8 +71,36 @@ struct SerialSVD {
                                            const WViewType &W);
 };
 
+/// Same factorization computed by a team with one-sided (Hestenes) Jacobi.
+/// Disjoint column pairs are rotated in parallel over the threads of the team
+/// and each column over the vector lanes, which suits small to medium
+/// matrices (up to about 64 x 64) where one thread per matrix leaves the
+/// device underutilized. No workspace is needed. When m < n, the
+/// factorization of A^T is computed through transposed strides.
+///
+/// Currently only supports real-valued matrices.
+
+template <typename MemberType>
+struct TeamVectorSVD {
+  // Version to compute full factorization: A == U * diag(s) * Vt
+  template <typename AViewType, typename UViewType, typename VtViewType,
+            typename SViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           SVD_USV_Tag, const AViewType &A,
+                                           const UViewType &U,
+                                           const SViewType &s,
+                                           const VtViewType &Vt);
+
+  // Version which computes only singular values
+  template <typename AViewType, typename SViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           SVD_S_Tag, const AViewType &A,
+                                           const SViewType &s);
+};
+
 }  // namespace KokkosBatched
 
 #include "KokkosBatched_SVD_Serial_Impl.hpp"
+#include "KokkosBatched_SVD_TeamVector_Impl.hpp"
 
 #endif
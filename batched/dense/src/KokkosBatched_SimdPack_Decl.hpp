@@ -0,0 +1,92 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_SIMDPACK_DECL_HPP__
+#define __KOKKOSBATCHED_SIMDPACK_DECL_HPP__
+
+#include <string>
+#include <type_traits>
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+
+namespace KokkosBatched {
+
+///
+/// Conversion of a batch of small vectors or matrices between the scalar
+/// layout A(k, i[, j]), with the batch index k first, and the interleaved
+/// SIMD layout Ap(k / l, i[, j])[k % l] of Vector<SIMD<T>, l>, in which serial
+/// kernels process l entries of the batch at once.
+///
+
+/// The SIMD-packed view type of a rank-2 or rank-3 scalar view
+template <typename ViewType, int VectorLength>
+struct SimdPackedViewType {
+  using vector_type =
+      Vector<SIMD<typename ViewType::non_const_value_type>, VectorLength>;
+  using data_type = std::conditional_t<ViewType::rank == 2, vector_type **,
+                                       vector_type ***>;
+  using type = Kokkos::View<data_type, Kokkos::LayoutRight,
+                            typename ViewType::device_type>;
+  using unmanaged_type =
+      Kokkos::View<data_type, Kokkos::LayoutRight,
+                   typename ViewType::device_type, Kokkos::MemoryUnmanaged>;
+};
+
+/// \brief Packs A(k, i[, j]) into Ap(k / l, i[, j])[k % l].
+///
+/// Ap must have ceil(N / l) entries for a batch of N. The lanes past the end
+/// of the batch replicate its last entry, so that they stay well defined
+/// (e.g. nonsingular) for whatever kernel runs on them.
+template <typename ExecSpace, typename AViewType, typename ApViewType>
+void SimdPack(const ExecSpace &space, const AViewType &A, const ApViewType &Ap);
+
+/// \brief Unpacks Ap(k / l, i[, j])[k % l] into A(k, i[, j]), the inverse of
+/// SimdPack.
+template <typename ExecSpace, typename ApViewType, typename AViewType>
+void SimdUnpack(const ExecSpace &space, const ApViewType &Ap,
+                const AViewType &A);
+
+/// \brief Packs A in place and returns the packed view, which aliases the
+/// memory of A.
+///
+/// A must be a contiguous LayoutRight view whose batch size is a multiple of
+/// VectorLength, and its data must be aligned for Vector<SIMD<T>,
+/// VectorLength>; otherwise this throws. A holds the packed layout until
+/// SimdUnpackInPlace is called on the returned view.
+template <int VectorLength, typename ExecSpace, typename AViewType>
+typename SimdPackedViewType<AViewType, VectorLength>::unmanaged_type
+SimdPackInPlace(const ExecSpace &space, const AViewType &A);
+
+/// \brief Restores the scalar layout of a view packed by SimdPackInPlace.
+template <typename ExecSpace, typename ApViewType>
+void SimdUnpackInPlace(const ExecSpace &space, const ApViewType &Ap);
+
+/// \brief Packed mode: runs functor(p, Ap_p, Bp_p, ...) for every pack p of
+/// the batch, where Ap_p = subview(Ap, p, ALL[, ALL]) and Ap is views[0]
+/// packed by SimdPack, and so on.
+///
+/// The functor typically calls serial-level kernels, which then process
+/// VectorLength entries of the batch at once. All views are packed before the
+/// launch, and those with a non-const value type are unpacked after it.
+template <int VectorLength, typename ExecSpace, typename Functor,
+          typename... ViewTypes>
+void SimdPackedFor(const std::string &label, const ExecSpace &space,
+                   const Functor &functor, const ViewTypes &...views);
+
+}  // namespace KokkosBatched
+
+#include "KokkosBatched_SimdPack_Impl.hpp"
+
+#endif
@@ -0,0 +1,70 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_SYEV_DECL_HPP__
+#define __KOKKOSBATCHED_SYEV_DECL_HPP__
+
+#include "KokkosBatched_Util.hpp"
+
+namespace KokkosBatched {
+
+///
+/// Eigendecomposition of a real symmetric matrix, A = V * diag(e) * V^T.
+/// Cheaper than the general Eigendecomposition interface, which goes through
+/// the Hessenberg form and complex eigenpairs.
+///
+/// Parameters:
+///   [in/out]A
+///     Real symmetric rank 2 view A(m x m). Only the ArgUplo triangle is
+///     referenced on entry. On exit, A holds the orthonormal eigenvectors in
+///     columns.
+///   [out]e
+///     Rank 1 view of length m, the eigenvalues in ascending order.
+///   [out]W
+///     1D contiguous workspace. The minimum size is m (Serial) or
+///     m * m + m + 1 (TeamVector).
+///
+/// SerialSyev reduces A to tridiagonal form with Householder reflectors and
+/// diagonalizes it with the implicit QL method. TeamVectorSyev uses the
+/// cyclic Jacobi method, where the rotations of disjoint row and column pairs
+/// are applied in parallel by the team.
+///
+/// Returns 0 on success, or 1 if the iteration did not converge. Currently
+/// only supports real-valued matrices.
+///
+
+template <typename ArgUplo>
+struct SerialSyev {
+  template <typename AViewType, typename EViewType, typename WViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const AViewType &A,
+                                           const EViewType &e,
+                                           const WViewType &W);
+};
+
+template <typename MemberType, typename ArgUplo>
+struct TeamVectorSyev {
+  template <typename AViewType, typename EViewType, typename WViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const AViewType &A,
+                                           const EViewType &e,
+                                           const WViewType &W);
+};
+
+}  // namespace KokkosBatched
+
+#include "KokkosBatched_Syev_Serial_Impl.hpp"
+#include "KokkosBatched_Syev_TeamVector_Impl.hpp"
+
+#endif
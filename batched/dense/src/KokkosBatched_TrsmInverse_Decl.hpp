@@ -0,0 +1,194 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_TRSM_INVERSE_DECL_HPP__
+#define __KOKKOSBATCHED_TRSM_INVERSE_DECL_HPP__
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+#include "KokkosBatched_Gemm_Decl.hpp"
+#include "KokkosBatched_Trtri_Decl.hpp"
+#include "KokkosBatched_Trtri_Serial_Impl.hpp"
+
+namespace KokkosBatched {
+
+///
+/// Trsm with a precomputed inverse
+/// ===============================
+///
+/// For many solves with the same triangular factor, tri(A) is inverted once
+/// and every later solve is a Gemm instead of a latency bound substitution,
+///   factorize: Ainv = inv(tri(A)), dense with the opposite triangle zeroed
+///   invoke:    X = alpha op(Ainv) B  (Side::Left)
+///              X = alpha B op(Ainv)  (Side::Right)
+/// X is what Trsm leaves in B. Only the ArgUplo triangle of A is read, so A
+/// may hold packed LU factors. ArgAlgo selects the Gemm algorithm;
+/// ConjTranspose is not supported.
+///
+
+struct TrsmInverseInternal {
+  template <typename ArgUplo, typename ArgDiag, typename AViewType,
+            typename AinvViewType>
+  KOKKOS_INLINE_FUNCTION static void copy(const int i, const int j,
+                                          const AViewType &A,
+                                          const AinvViewType &Ainv) {
+    using value_type = typename AinvViewType::non_const_value_type;
+    const bool in_triangle =
+        std::is_same<ArgUplo, Uplo::Lower>::value ? i >= j : i <= j;
+    if (i == j && ArgDiag::use_unit_diag)
+      Ainv(i, j) = value_type(1);
+    else
+      Ainv(i, j) = in_triangle ? value_type(A(i, j)) : value_type(0);
+  }
+};
+
+template <typename ArgSide, typename ArgUplo, typename ArgTrans,
+          typename ArgDiag, typename ArgAlgo>
+struct SerialTrsmInverse {
+  static_assert(!std::is_same<ArgTrans, Trans::ConjTranspose>::value,
+                "KokkosBatched::SerialTrsmInverse: ConjTranspose is not "
+                "supported");
+
+  /// returns i + 1 if A(i, i) is zero (non-unit diagonal)
+  template <typename AViewType, typename AinvViewType>
+  KOKKOS_INLINE_FUNCTION static int factorize(const AViewType &A,
+                                              const AinvViewType &Ainv) {
+    const int m = A.extent(0);
+    for (int i = 0; i < m; ++i)
+      for (int j = 0; j < m; ++j)
+        TrsmInverseInternal::copy<ArgUplo, ArgDiag>(i, j, A, Ainv);
+    return SerialTrtri<ArgUplo, ArgDiag, Algo::Trtri::Unblocked>::invoke(Ainv);
+  }
+
+  template <typename ScalarType, typename AinvViewType, typename BViewType,
+            typename XViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const ScalarType alpha,
+                                           const AinvViewType &Ainv,
+                                           const BViewType &B,
+                                           const XViewType &X) {
+    if constexpr (std::is_same<ArgSide, Side::Left>::value)
+      return SerialGemm<ArgTrans, Trans::NoTranspose, ArgAlgo>::invoke(
+          alpha, Ainv, B, ScalarType(0), X);
+    else
+      return SerialGemm<Trans::NoTranspose, ArgTrans, ArgAlgo>::invoke(
+          alpha, B, Ainv, ScalarType(0), X);
+  }
+};
+
+template <typename MemberType, typename ArgSide, typename ArgUplo,
+          typename ArgTrans, typename ArgDiag, typename ArgAlgo>
+struct TeamTrsmInverse {
+  static_assert(!std::is_same<ArgTrans, Trans::ConjTranspose>::value,
+                "KokkosBatched::TeamTrsmInverse: ConjTranspose is not "
+                "supported");
+
+  template <typename AViewType, typename AinvViewType>
+  KOKKOS_INLINE_FUNCTION static int factorize(const MemberType &member,
+                                              const AViewType &A,
+                                              const AinvViewType &Ainv) {
+    const int m = A.extent(0);
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(member, m * m),
+                         [&](const int &ij) {
+                           TrsmInverseInternal::copy<ArgUplo, ArgDiag>(
+                               ij / m, ij % m, A, Ainv);
+                         });
+    member.team_barrier();
+
+    // the inversion is done once; keep it serial
+    int r_val = 0;
+    Kokkos::single(
+        Kokkos::PerTeam(member),
+        [&](int &r) {
+          r = SerialTrtri<ArgUplo, ArgDiag, Algo::Trtri::Unblocked>::invoke(
+              Ainv);
+        },
+        r_val);
+    member.team_barrier();
+    return r_val;
+  }
+
+  template <typename ScalarType, typename AinvViewType, typename BViewType,
+            typename XViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const ScalarType alpha,
+                                           const AinvViewType &Ainv,
+                                           const BViewType &B,
+                                           const XViewType &X) {
+    if constexpr (std::is_same<ArgSide, Side::Left>::value)
+      return TeamGemm<MemberType, ArgTrans, Trans::NoTranspose,
+                      ArgAlgo>::invoke(member, alpha, Ainv, B, ScalarType(0),
+                                       X);
+    else
+      return TeamGemm<MemberType, Trans::NoTranspose, ArgTrans,
+                      ArgAlgo>::invoke(member, alpha, B, Ainv, ScalarType(0),
+                                       X);
+  }
+};
+
+template <typename MemberType, typename ArgSide, typename ArgUplo,
+          typename ArgTrans, typename ArgDiag, typename ArgAlgo>
+struct TeamVectorTrsmInverse {
+  static_assert(!std::is_same<ArgTrans, Trans::ConjTranspose>::value,
+                "KokkosBatched::TeamVectorTrsmInverse: ConjTranspose is not "
+                "supported");
+
+  template <typename AViewType, typename AinvViewType>
+  KOKKOS_INLINE_FUNCTION static int factorize(const MemberType &member,
+                                              const AViewType &A,
+                                              const AinvViewType &Ainv) {
+    const int m = A.extent(0);
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(member, m), [&](const int &i) {
+          Kokkos::parallel_for(
+              Kokkos::ThreadVectorRange(member, m), [&](const int &j) {
+                TrsmInverseInternal::copy<ArgUplo, ArgDiag>(i, j, A, Ainv);
+              });
+        });
+    member.team_barrier();
+
+    // the inversion is done once; keep it serial
+    int r_val = 0;
+    Kokkos::single(
+        Kokkos::PerTeam(member),
+        [&](int &r) {
+          r = SerialTrtri<ArgUplo, ArgDiag, Algo::Trtri::Unblocked>::invoke(
+              Ainv);
+        },
+        r_val);
+    member.team_barrier();
+    return r_val;
+  }
+
+  template <typename ScalarType, typename AinvViewType, typename BViewType,
+            typename XViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const ScalarType alpha,
+                                           const AinvViewType &Ainv,
+                                           const BViewType &B,
+                                           const XViewType &X) {
+    if constexpr (std::is_same<ArgSide, Side::Left>::value)
+      return TeamVectorGemm<MemberType, ArgTrans, Trans::NoTranspose,
+                            ArgAlgo>::invoke(member, alpha, Ainv, B,
+                                             ScalarType(0), X);
+    else
+      return TeamVectorGemm<MemberType, Trans::NoTranspose, ArgTrans,
+                            ArgAlgo>::invoke(member, alpha, B, Ainv,
+                                             ScalarType(0), X);
+  }
+};
+
+}  // namespace KokkosBatched
+
+#endif
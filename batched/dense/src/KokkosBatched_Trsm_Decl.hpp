@@ -23,6 +23,9 @@
 
 namespace KokkosBatched {
 
+/// Repeated solves with the same factor can invert it once and use Gemm
+/// instead; see SerialTrsmInverse in KokkosBatched_TrsmInverse_Decl.hpp
+
 template <typename ArgSide, typename ArgUplo, typename ArgTrans,
           typename ArgDiag, typename ArgAlgo>
 struct SerialTrsm {
@@ -24,9 +24,22 @@
 
 #if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
 #undef __KOKKOSBATCHED_ENABLE_AVX__
+#undef __KOKKOSBATCHED_ENABLE_NEON__
+#undef __KOKKOSBATCHED_ENABLE_SVE__
 #else
 // compiler bug with AVX in some architectures
 #define __KOKKOSBATCHED_ENABLE_AVX__
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#define __KOKKOSBATCHED_ENABLE_NEON__
+#endif
+// only fixed-length SVE, with a vector of at least 256 bits; 128-bit SVE is
+// no wider than NEON
+#if defined(__aarch64__) && defined(__ARM_FEATURE_SVE) && \
+    defined(__ARM_FEATURE_SVE_BITS)
+#if __ARM_FEATURE_SVE_BITS >= 256
+#define __KOKKOSBATCHED_ENABLE_SVE__
+#endif
+#endif
 #endif
 
 namespace KokkosBatched {
@@ -827,6 +840,366 @@ class Vector<SIMD<Kokkos::complex<double> >, 4> {
 #endif /* #if defined(__AVX512F__) */
 #endif /* #if defined(__KOKKOSBATCHED_ENABLE_AVX__) */
 
+#if defined(__KOKKOSBATCHED_ENABLE_NEON__)
+#include <arm_neon.h>
+
+namespace KokkosBatched {
+
+// 128-bit NEON registers hold two doubles or four floats, so the default
+// vector lengths are a pair of registers. With 256-bit SVE the same lengths
+// fill one SVE register instead, see below.
+#if !defined(__KOKKOSBATCHED_ENABLE_SVE__) || (__ARM_FEATURE_SVE_BITS != 256)
+template <>
+class Vector<SIMD<double>, 4> {
+ public:
+  using type       = Vector<SIMD<double>, 4>;
+  using value_type = double;
+  using mag_type   = double;
+
+  enum : int { vector_length = 4 };
+  typedef float64x2x2_t data_type __attribute__((aligned(32)));
+
+  inline static const char *label() { return "NEON128x2"; }
+
+  template <typename, int>
+  friend class Vector;
+
+ private:
+  mutable data_type _data;
+
+ public:
+  inline Vector() { _data.val[0] = _data.val[1] = vdupq_n_f64(0.0); }
+  inline Vector(const value_type &val) {
+    _data.val[0] = _data.val[1] = vdupq_n_f64(val);
+  }
+  inline Vector(const type &b) { _data = b._data; }
+  inline Vector(const float64x2x2_t &val) { _data = val; }
+
+  template <typename ArgValueType>
+  inline Vector(const ArgValueType &val) {
+    auto d = reinterpret_cast<value_type *>(&_data);
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) d[i] = val;
+  }
+
+  template <typename ArgValueType>
+  inline Vector(const Vector<SIMD<ArgValueType>, vector_length> &b) {
+    auto dd = reinterpret_cast<value_type *>(&_data);
+    auto bb = reinterpret_cast<ArgValueType *>(&b._data);
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) dd[i] = bb[i];
+  }
+
+  inline type &operator=(const float64x2x2_t &val) {
+    _data = val;
+    return *this;
+  }
+
+  inline operator float64x2x2_t() const { return _data; }
+
+  inline type &loadAligned(const value_type *p) {
+    _data.val[0] = vld1q_f64(p);
+    _data.val[1] = vld1q_f64(p + 2);
+    return *this;
+  }
+
+  inline type &loadUnaligned(const value_type *p) { return loadAligned(p); }
+
+  inline void storeAligned(value_type *p) const {
+    vst1q_f64(p, _data.val[0]);
+    vst1q_f64(p + 2, _data.val[1]);
+  }
+
+  inline void storeUnaligned(value_type *p) const { storeAligned(p); }
+
+  inline value_type &operator[](const int &i) const {
+    return reinterpret_cast<value_type *>(&_data)[i];
+  }
+};
+
+template <>
+class Vector<SIMD<float>, 8> {
+ public:
+  using type       = Vector<SIMD<float>, 8>;
+  using value_type = float;
+  using mag_type   = float;
+
+  enum : int { vector_length = 8 };
+  typedef float32x4x2_t data_type __attribute__((aligned(32)));
+
+  inline static const char *label() { return "NEON128x2"; }
+
+  template <typename, int>
+  friend class Vector;
+
+ private:
+  mutable data_type _data;
+
+ public:
+  inline Vector() { _data.val[0] = _data.val[1] = vdupq_n_f32(0.0f); }
+  inline Vector(const value_type &val) {
+    _data.val[0] = _data.val[1] = vdupq_n_f32(val);
+  }
+  inline Vector(const type &b) { _data = b._data; }
+  inline Vector(const float32x4x2_t &val) { _data = val; }
+
+  template <typename ArgValueType>
+  inline Vector(const ArgValueType &val) {
+    auto d = reinterpret_cast<value_type *>(&_data);
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) d[i] = val;
+  }
+
+  template <typename ArgValueType>
+  inline Vector(const Vector<SIMD<ArgValueType>, vector_length> &b) {
+    auto dd = reinterpret_cast<value_type *>(&_data);
+    auto bb = reinterpret_cast<ArgValueType *>(&b._data);
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) dd[i] = bb[i];
+  }
+
+  inline type &operator=(const float32x4x2_t &val) {
+    _data = val;
+    return *this;
+  }
+
+  inline operator float32x4x2_t() const { return _data; }
+
+  inline type &loadAligned(const value_type *p) {
+    _data.val[0] = vld1q_f32(p);
+    _data.val[1] = vld1q_f32(p + 4);
+    return *this;
+  }
+
+  inline type &loadUnaligned(const value_type *p) { return loadAligned(p); }
+
+  inline void storeAligned(value_type *p) const {
+    vst1q_f32(p, _data.val[0]);
+    vst1q_f32(p + 4, _data.val[1]);
+  }
+
+  inline void storeUnaligned(value_type *p) const { storeAligned(p); }
+
+  inline value_type &operator[](const int &i) const {
+    return reinterpret_cast<value_type *>(&_data)[i];
+  }
+};
+#endif
+
+// one complex number per register, as (real, imag)
+template <>
+class Vector<SIMD<Kokkos::complex<double> >, 2> {
+ public:
+  using type       = Vector<SIMD<Kokkos::complex<double> >, 2>;
+  using value_type = Kokkos::complex<double>;
+  using mag_type   = double;
+
+  static const int vector_length = 2;
+  typedef float64x2x2_t data_type __attribute__((aligned(32)));
+
+  inline static const char *label() { return "NEON128x2"; }
+
+  template <typename, int>
+  friend class Vector;
+
+ private:
+  mutable data_type _data;
+
+ public:
+  inline Vector() { _data.val[0] = _data.val[1] = vdupq_n_f64(0.0); }
+  inline Vector(const value_type &val) {
+    _data.val[0] = _data.val[1] =
+        vld1q_f64(reinterpret_cast<const mag_type *>(&val));
+  }
+  inline Vector(const mag_type &val) {
+    const value_type a(val);
+    _data.val[0] = _data.val[1] =
+        vld1q_f64(reinterpret_cast<const mag_type *>(&a));
+  }
+  inline Vector(const type &b) { _data = b._data; }
+  inline Vector(const float64x2x2_t &val) { _data = val; }
+
+  template <typename ArgValueType>
+  inline Vector(const Vector<SIMD<ArgValueType>, vector_length> &b) {
+    auto dd = reinterpret_cast<value_type *>(&_data);
+    auto bb = reinterpret_cast<ArgValueType *>(&b._data);
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) dd[i] = bb[i];
+  }
+
+  inline type &operator=(const float64x2x2_t &val) {
+    _data = val;
+    return *this;
+  }
+
+  inline operator float64x2x2_t() const { return _data; }
+
+  inline type &loadAligned(const value_type *p) {
+    _data.val[0] = vld1q_f64((const mag_type *)p);
+    _data.val[1] = vld1q_f64((const mag_type *)(p + 1));
+    return *this;
+  }
+
+  inline type &loadUnaligned(const value_type *p) { return loadAligned(p); }
+
+  inline void storeAligned(value_type *p) const {
+    vst1q_f64((mag_type *)p, _data.val[0]);
+    vst1q_f64((mag_type *)(p + 1), _data.val[1]);
+  }
+
+  inline void storeUnaligned(value_type *p) const { storeAligned(p); }
+
+  inline value_type &operator[](const int &i) const {
+    return reinterpret_cast<value_type *>(&_data)[i];
+  }
+};
+}  // namespace KokkosBatched
+
+#endif /* #if defined(__KOKKOSBATCHED_ENABLE_NEON__) */
+
+#if defined(__KOKKOSBATCHED_ENABLE_SVE__)
+#include <arm_sve.h>
+
+namespace KokkosBatched {
+
+// SVE registers are sizeless unless the vector length is fixed at compile
+// time (-msve-vector-bits), which is what lets them be class members here.
+typedef svfloat64_t kokkosbatched_sve_f64_t
+    __attribute__((arm_sve_vector_bits(__ARM_FEATURE_SVE_BITS)));
+typedef svfloat32_t kokkosbatched_sve_f32_t
+    __attribute__((arm_sve_vector_bits(__ARM_FEATURE_SVE_BITS)));
+
+template <>
+class Vector<SIMD<double>, __ARM_FEATURE_SVE_BITS / 64> {
+ public:
+  using type       = Vector<SIMD<double>, __ARM_FEATURE_SVE_BITS / 64>;
+  using value_type = double;
+  using mag_type   = double;
+
+  enum : int { vector_length = __ARM_FEATURE_SVE_BITS / 64 };
+  typedef kokkosbatched_sve_f64_t data_type;
+
+  inline static const char *label() { return "SVE"; }
+
+  template <typename, int>
+  friend class Vector;
+
+ private:
+  mutable data_type _data;
+
+ public:
+  inline Vector() { _data = svdup_n_f64(0.0); }
+  inline Vector(const value_type &val) { _data = svdup_n_f64(val); }
+  inline Vector(const type &b) { _data = b._data; }
+  inline Vector(const kokkosbatched_sve_f64_t &val) { _data = val; }
+
+  template <typename ArgValueType>
+  inline Vector(const ArgValueType &val) {
+    auto d = reinterpret_cast<value_type *>(&_data);
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) d[i] = val;
+  }
+
+  template <typename ArgValueType>
+  inline Vector(const Vector<SIMD<ArgValueType>, vector_length> &b) {
+    auto dd = reinterpret_cast<value_type *>(&_data);
+    auto bb = reinterpret_cast<ArgValueType *>(&b._data);
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) dd[i] = bb[i];
+  }
+
+  inline type &operator=(const kokkosbatched_sve_f64_t &val) {
+    _data = val;
+    return *this;
+  }
+
+  inline operator kokkosbatched_sve_f64_t() const { return _data; }
+
+  inline type &loadAligned(const value_type *p) {
+    _data = svld1_f64(svptrue_b64(), p);
+    return *this;
+  }
+
+  inline type &loadUnaligned(const value_type *p) { return loadAligned(p); }
+
+  inline void storeAligned(value_type *p) const {
+    svst1_f64(svptrue_b64(), p, _data);
+  }
+
+  inline void storeUnaligned(value_type *p) const { storeAligned(p); }
+
+  inline value_type &operator[](const int &i) const {
+    return reinterpret_cast<value_type *>(&_data)[i];
+  }
+};
+
+template <>
+class Vector<SIMD<float>, __ARM_FEATURE_SVE_BITS / 32> {
+ public:
+  using type       = Vector<SIMD<float>, __ARM_FEATURE_SVE_BITS / 32>;
+  using value_type = float;
+  using mag_type   = float;
+
+  enum : int { vector_length = __ARM_FEATURE_SVE_BITS / 32 };
+  typedef kokkosbatched_sve_f32_t data_type;
+
+  inline static const char *label() { return "SVE"; }
+
+  template <typename, int>
+  friend class Vector;
+
+ private:
+  mutable data_type _data;
+
+ public:
+  inline Vector() { _data = svdup_n_f32(0.0f); }
+  inline Vector(const value_type &val) { _data = svdup_n_f32(val); }
+  inline Vector(const type &b) { _data = b._data; }
+  inline Vector(const kokkosbatched_sve_f32_t &val) { _data = val; }
+
+  template <typename ArgValueType>
+  inline Vector(const ArgValueType &val) {
+    auto d = reinterpret_cast<value_type *>(&_data);
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) d[i] = val;
+  }
+
+  template <typename ArgValueType>
+  inline Vector(const Vector<SIMD<ArgValueType>, vector_length> &b) {
+    auto dd = reinterpret_cast<value_type *>(&_data);
+    auto bb = reinterpret_cast<ArgValueType *>(&b._data);
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) dd[i] = bb[i];
+  }
+
+  inline type &operator=(const kokkosbatched_sve_f32_t &val) {
+    _data = val;
+    return *this;
+  }
+
+  inline operator kokkosbatched_sve_f32_t() const { return _data; }
+
+  inline type &loadAligned(const value_type *p) {
+    _data = svld1_f32(svptrue_b32(), p);
+    return *this;
+  }
+
+  inline type &loadUnaligned(const value_type *p) { return loadAligned(p); }
+
+  inline void storeAligned(value_type *p) const {
+    svst1_f32(svptrue_b32(), p, _data);
+  }
+
+  inline void storeUnaligned(value_type *p) const { storeAligned(p); }
+
+  inline value_type &operator[](const int &i) const {
+    return reinterpret_cast<value_type *>(&_data)[i];
+  }
+};
+}  // namespace KokkosBatched
+
+#endif /* #if defined(__KOKKOSBATCHED_ENABLE_SVE__) */
+
 #include "KokkosBatched_Vector_SIMD_Arith.hpp"
 #include "KokkosBatched_Vector_SIMD_Logical.hpp"
 #include "KokkosBatched_Vector_SIMD_Relation.hpp"
@@ -13,6 +13,8 @@
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 //
 //@HEADER
+#include <cstdio>
+#include <fstream>
 #include "gtest/gtest.h"
 #include "Kokkos_Core.hpp"
 #include "Kokkos_Random.hpp"
@@ -242,7 +244,7 @@ void impl_test_batched_gemm(const int N, const int matAdim1, const int matAdim2,
   }
 
   for (int algo_type = BaseHeuristicAlgos::SQUARE;
-       algo_type < GemmKokkosBatchedAlgos::N; ++algo_type) {
+       algo_type < GemmHeuristicAlgos::N; ++algo_type) {
     {
       try {
         BatchedGemmHandle batchedGemmHandle(algo_type);
@@ -252,7 +254,8 @@ void impl_test_batched_gemm(const int N, const int matAdim1, const int matAdim2,
         if (algo_type == BaseTplAlgos::ARMPL ||
             algo_type == BaseKokkosBatchedAlgos::KK_SERIAL ||
             algo_type == GemmKokkosBatchedAlgos::KK_SERIAL_RANK0 ||
-            algo_type == GemmKokkosBatchedAlgos::KK_DBLBUF) {
+            algo_type == GemmKokkosBatchedAlgos::KK_DBLBUF ||
+            algo_type == GemmHeuristicAlgos::AUTOTUNE) {
           impl_test_batched_gemm_with_handle<DeviceType, ViewType, ScalarType,
                                              ParamTagType>(
               &batchedGemmHandle, N, matAdim1, matAdim2, matBdim1, matBdim2,
@@ -308,6 +311,49 @@ void impl_test_batched_gemm(const int N, const int matAdim1, const int matAdim2,
     }
   }
 }
+
+/// Checks that the winners of GemmHeuristicAlgos::AUTOTUNE are written to the
+/// database file and reloaded from it.
+template <typename DeviceType, typename ViewType, typename ScalarType,
+          typename ParamTagType>
+void impl_test_batched_gemm_autotune_file(const int N, const int dim) {
+  using transA      = typename ParamTagType::transA;
+  using transB      = typename ParamTagType::transB;
+  using batchLayout = typename ParamTagType::batchLayout;
+  constexpr bool batch_left =
+      std::is_same<batchLayout, BatchLayout::Left>::value;
+
+  auto& database              = BatchedGemmAutotuneDatabase::instance();
+  const std::string prev_file = database.get_file();
+  const std::string file =
+      std::string("Test_Batched_BatchedGemm_autotune_") +
+      DeviceType::execution_space::name() + ".txt";
+  std::remove(file.c_str());
+  database.clear();
+  database.set_file(file);
+
+  const int e0 = batch_left ? N : dim, e2 = batch_left ? dim : N;
+  ViewType a("a", e0, dim, e2), b("b", e0, dim, e2), c("c", e0, dim, e2);
+  BatchedGemmHandle handle(GemmHeuristicAlgos::AUTOTUNE);
+  ASSERT_EQ(0, BatchedGemm<transA, transB, batchLayout>(
+                   &handle, ScalarType(1.0), a, b, ScalarType(0.0), c));
+
+  std::string key;
+  int algo_type = -1, reloaded_algo_type = -2;
+  {
+    std::ifstream in(file);
+    ASSERT_TRUE(bool(in >> key >> algo_type)) << file;
+  }
+  database.clear();
+  ASSERT_FALSE(database.find(key, reloaded_algo_type));
+  database.set_file(file);
+  ASSERT_TRUE(database.find(key, reloaded_algo_type)) << key;
+  ASSERT_EQ(algo_type, reloaded_algo_type) << key;
+
+  database.clear();
+  database.set_file(prev_file);
+  std::remove(file.c_str());
+}
 }  // namespace Test
 
 template <typename ViewType, typename DeviceType, typename ValueType,
@@ -322,6 +368,8 @@ void test_batched_gemm_with_layout(int N) {
     i = 10;
     Test::impl_test_batched_gemm<DeviceType, ViewType, ScalarType,
                                  ParamTagType>(N, i, i, i, i, i, i);
+    Test::impl_test_batched_gemm_autotune_file<DeviceType, ViewType,
+                                               ScalarType, ParamTagType>(N, i);
 
     i = 25;
     Test::impl_test_batched_gemm<DeviceType, ViewType, ScalarType,
@@ -0,0 +1,234 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include "gtest/gtest.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_Random.hpp"
+
+#include "KokkosBatched_BlockTridiag_Decl.hpp"
+
+#include "KokkosKernels_TestUtils.hpp"
+
+using namespace KokkosBatched;
+
+namespace Test {
+namespace BlockTridiag {
+
+/// system p of the batch has the diagonal blocks A(p, k), the superdiagonal
+/// blocks B(p, k) and the subdiagonal blocks C(p, k); X(p) holds nrhs right
+/// hand sides, passed as a rank 2 view when there is only one
+template <typename DeviceType, typename AViewType, typename XViewType,
+          typename ModeType, typename AlgoTagType>
+struct Functor_TestBatchedBlockTridiag {
+  using execution_space = typename DeviceType::execution_space;
+  AViewType _A, _B, _C;
+  XViewType _X;
+  bool _factorize;
+
+  Functor_TestBatchedBlockTridiag(const AViewType &A, const AViewType &B,
+                                  const AViewType &C, const XViewType &X,
+                                  const bool factorize)
+      : _A(A), _B(B), _C(C), _X(X), _factorize(factorize) {}
+
+  template <typename MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType &member) const {
+    const int p = member.league_rank();
+    auto A      = Kokkos::subview(_A, p, Kokkos::ALL(), Kokkos::ALL(),
+                             Kokkos::ALL());
+    auto B      = Kokkos::subview(_B, p, Kokkos::ALL(), Kokkos::ALL(),
+                             Kokkos::ALL());
+    auto C      = Kokkos::subview(_C, p, Kokkos::ALL(), Kokkos::ALL(),
+                             Kokkos::ALL());
+    auto X      = Kokkos::subview(_X, p, Kokkos::ALL(), Kokkos::ALL(),
+                             Kokkos::ALL());
+    auto x      = Kokkos::subview(_X, p, Kokkos::ALL(), Kokkos::ALL(), 0);
+    auto solve  = [&]() {
+      if (_factorize)
+        BlockTridiagFactorize<MemberType, ModeType, AlgoTagType>::invoke(
+            member, A, B, C);
+      if (X.extent(2) == 1)
+        BlockTridiagSolve<MemberType, ModeType, AlgoTagType>::invoke(
+            member, A, B, C, x);
+      else
+        BlockTridiagSolve<MemberType, ModeType, AlgoTagType>::invoke(
+            member, A, B, C, X);
+    };
+    if (std::is_same<ModeType, Mode::Serial>::value) {
+      Kokkos::single(Kokkos::PerTeam(member), solve);
+    } else {
+      solve();
+      member.team_barrier();
+    }
+  }
+
+  inline void run() {
+    typedef typename AViewType::value_type value_type;
+    std::string name_region("KokkosBatched::Test::BlockTridiag");
+    const std::string name_value_type = Test::value_type_name<value_type>();
+    std::string name = name_region + ModeType::name() + name_value_type;
+    Kokkos::Profiling::pushRegion(name.c_str());
+    Kokkos::TeamPolicy<execution_space> policy(_A.extent(0), Kokkos::AUTO);
+    Kokkos::parallel_for(name.c_str(), policy, *this);
+    Kokkos::Profiling::popRegion();
+  }
+};
+
+/// The data of the N systems is stored as scalars with the lane of the
+/// system last, and viewed as Vector<SIMD<ValueType>, VectorLength> to solve
+/// VectorLength interleaved systems per lane (plain ValueType for 1).
+template <typename DeviceType, typename ValueType, int VectorLength,
+          typename ModeType, typename AlgoTagType>
+void impl_test_batched_block_tridiag(const int N, const int L, const int Blk,
+                                     const int nrhs) {
+  typedef ValueType value_type;
+  typedef Kokkos::ArithTraits<value_type> ats;
+  using packed_type =
+      std::conditional_t<VectorLength == 1, value_type,
+                         Vector<SIMD<value_type>, VectorLength>>;
+  using scalar_view_type =
+      Kokkos::View<value_type *****, Kokkos::LayoutRight, DeviceType>;
+  using a_view_type =
+      Kokkos::View<packed_type ****, Kokkos::LayoutRight, DeviceType,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+  const int Np = N / VectorLength;
+  scalar_view_type A("A", Np, L, Blk, Blk, VectorLength);
+  scalar_view_type B("B", Np, L, Blk, Blk, VectorLength);
+  scalar_view_type C("C", Np, L, Blk, Blk, VectorLength);
+  scalar_view_type b("b", Np, L, Blk, nrhs, VectorLength);
+  scalar_view_type b2("b2", Np, L, Blk, nrhs, VectorLength);
+  scalar_view_type x("x", Np, L, Blk, nrhs, VectorLength);
+  scalar_view_type x2("x2", Np, L, Blk, nrhs, VectorLength);
+
+  Kokkos::Random_XorShift64_Pool<typename DeviceType::execution_space> random(
+      13718);
+  Kokkos::fill_random(A, random, value_type(1.0));
+  Kokkos::fill_random(B, random, value_type(1.0));
+  Kokkos::fill_random(C, random, value_type(1.0));
+  Kokkos::fill_random(b, random, value_type(1.0));
+  Kokkos::fill_random(b2, random, value_type(1.0));
+  Kokkos::fence();
+
+  /// block diagonally dominant systems
+  auto A_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A);
+  for (int p = 0; p < Np; ++p)
+    for (int k = 0; k < L; ++k)
+      for (int i = 0; i < Blk; ++i)
+        for (int v = 0; v < VectorLength; ++v)
+          A_host(p, k, i, i, v) += value_type(4.0 * Blk);
+  Kokkos::deep_copy(A, A_host);
+  auto B_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), B);
+  auto C_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), C);
+  Kokkos::deep_copy(x, b);
+  Kokkos::deep_copy(x2, b2);
+
+  auto packed = [&](const scalar_view_type &s) {
+    return a_view_type(reinterpret_cast<packed_type *>(s.data()), Np,
+                       s.extent(1), s.extent(2), s.extent(3));
+  };
+  /// factorize and solve, then solve again with the factors
+  Functor_TestBatchedBlockTridiag<DeviceType, a_view_type, a_view_type,
+                                  ModeType, AlgoTagType>(
+      packed(A), packed(B), packed(C), packed(x), true)
+      .run();
+  Functor_TestBatchedBlockTridiag<DeviceType, a_view_type, a_view_type,
+                                  ModeType, AlgoTagType>(
+      packed(A), packed(B), packed(C), packed(x2), false)
+      .run();
+  Kokkos::fence();
+
+  /// check A0 * x = b
+  typedef typename ats::mag_type mag_type;
+  const mag_type eps = 1.0e3 * ats::epsilon();
+  for (auto xb : {std::make_pair(x, b), std::make_pair(x2, b2)}) {
+    auto x_host =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), xb.first);
+    auto b_host =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), xb.second);
+    mag_type sum(1), diff(0);
+    for (int p = 0; p < Np; ++p)
+      for (int v = 0; v < VectorLength; ++v)
+        for (int r = 0; r < nrhs; ++r)
+          for (int k = 0; k < L; ++k)
+            for (int i = 0; i < Blk; ++i) {
+              value_type ax(0);
+              for (int j = 0; j < Blk; ++j) {
+                ax += A_host(p, k, i, j, v) * x_host(p, k, j, r, v);
+                if (k > 0)
+                  ax += C_host(p, k - 1, i, j, v) * x_host(p, k - 1, j, r, v);
+                if (k + 1 < L)
+                  ax += B_host(p, k, i, j, v) * x_host(p, k + 1, j, r, v);
+              }
+              sum += ats::abs(b_host(p, k, i, r, v));
+              diff += ats::abs(ax - b_host(p, k, i, r, v));
+            }
+    EXPECT_NEAR_KK(diff / sum, 0.0, eps);
+  }
+}
+}  // namespace BlockTridiag
+}  // namespace Test
+
+template <typename DeviceType, typename ValueType, int VectorLength,
+          typename ModeType, typename AlgoTagType>
+int test_batched_block_tridiag() {
+  const int N = 4 * VectorLength;
+  for (const int L : {1, 2, 7, 32})
+    for (const int Blk : {1, 3, 5})
+      for (const int nrhs : {1, 3})
+        Test::BlockTridiag::impl_test_batched_block_tridiag<
+            DeviceType, ValueType, VectorLength, ModeType, AlgoTagType>(
+            N, L, Blk, nrhs);
+  Test::BlockTridiag::impl_test_batched_block_tridiag<
+      DeviceType, ValueType, VectorLength, ModeType, AlgoTagType>(0, 4, 3, 1);
+  return 0;
+}
+
+#if defined(KOKKOSKERNELS_INST_FLOAT)
+TEST_F(TestCategory, batched_scalar_block_tridiag_float) {
+  typedef Algo::Level3::Unblocked algo_tag_type;
+  test_batched_block_tridiag<TestDevice, float, 1, Mode::Serial,
+                             algo_tag_type>();
+  test_batched_block_tridiag<TestDevice, float, 1, Mode::Team,
+                             algo_tag_type>();
+  test_batched_block_tridiag<TestDevice, float, 8, Mode::Serial,
+                             algo_tag_type>();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+TEST_F(TestCategory, batched_scalar_block_tridiag_double) {
+  typedef Algo::Level3::Unblocked algo_tag_type;
+  test_batched_block_tridiag<TestDevice, double, 1, Mode::Serial,
+                             algo_tag_type>();
+  test_batched_block_tridiag<TestDevice, double, 1, Mode::Serial,
+                             Algo::Level3::Blocked>();
+  test_batched_block_tridiag<TestDevice, double, 1, Mode::Team,
+                             algo_tag_type>();
+  test_batched_block_tridiag<TestDevice, double, 4, Mode::Serial,
+                             algo_tag_type>();
+  test_batched_block_tridiag<TestDevice, double, 4, Mode::Team,
+                             algo_tag_type>();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE)
+TEST_F(TestCategory, batched_scalar_block_tridiag_dcomplex) {
+  typedef Algo::Level3::Unblocked algo_tag_type;
+  test_batched_block_tridiag<TestDevice, Kokkos::complex<double>, 1,
+                             Mode::Serial, algo_tag_type>();
+  test_batched_block_tridiag<TestDevice, Kokkos::complex<double>, 1,
+                             Mode::Team, algo_tag_type>();
+}
+#endif
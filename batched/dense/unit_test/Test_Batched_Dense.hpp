@@ -46,6 +46,14 @@
 #include "Test_Batched_SerialTrtri_Real.hpp"
 #include "Test_Batched_SerialTrtri_Complex.hpp"
 #include "Test_Batched_SerialSVD.hpp"
+#include "Test_Batched_Potrf.hpp"
+#include "Test_Batched_Getrf.hpp"
+#include "Test_Batched_Gtsv.hpp"
+#include "Test_Batched_BlockTridiag.hpp"
+#include "Test_Batched_Syev.hpp"
+#include "Test_Batched_SerialFixedSize.hpp"
+#include "Test_Batched_TrsmInverse.hpp"
+#include "Test_Batched_VarSize.hpp"
 
 // Team Kernels
 #include "Test_Batched_TeamAxpy.hpp"
@@ -77,10 +85,12 @@
 #include "Test_Batched_TeamVectorEigendecomposition_Real.hpp"
 #include "Test_Batched_TeamVectorGesv.hpp"
 #include "Test_Batched_TeamVectorGesv_Real.hpp"
+#include "Test_Batched_GesvFactorize.hpp"
 #include "Test_Batched_TeamVectorQR.hpp"
 #include "Test_Batched_TeamVectorQR_Real.hpp"
 #include "Test_Batched_TeamVectorQR_WithColumnPivoting.hpp"
 #include "Test_Batched_TeamVectorQR_WithColumnPivoting_Real.hpp"
+#include "Test_Batched_TeamVectorSVD.hpp"
 #include "Test_Batched_TeamVectorSolveUTV.hpp"
 #include "Test_Batched_TeamVectorSolveUTV_Real.hpp"
 #include "Test_Batched_TeamVectorSolveUTV2.hpp"
@@ -95,5 +105,6 @@
 #include "Test_Batched_VectorMisc.hpp"
 #include "Test_Batched_VectorRelation.hpp"
 #include "Test_Batched_VectorView.hpp"
+#include "Test_Batched_SimdPack.hpp"
 
 #endif  // TEST_BATCHED_DENSE_HPP
@@ -0,0 +1,206 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include "gtest/gtest.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_Random.hpp"
+
+#include "KokkosBatched_Gesv.hpp"
+
+#include "KokkosKernels_TestUtils.hpp"
+
+using namespace KokkosBatched;
+
+namespace Test {
+namespace GesvFactorize {
+
+/// factorizes A(l) into F(l) once, then solves the nrhs right-hand sides of
+/// Y(l) and the single right-hand side y(l) with the same factors
+template <typename DeviceType, typename MatrixType, typename PivotType,
+          typename VectorType, typename ModeType, typename AlgoTagType>
+struct Functor_TestBatchedGesvFactorize {
+  using execution_space = typename DeviceType::execution_space;
+  MatrixType _A, _F, _tmp, _X, _Y;
+  PivotType _piv;
+  VectorType _x, _y;
+
+  Functor_TestBatchedGesvFactorize(const MatrixType &A, const MatrixType &F,
+                                   const PivotType &piv, const MatrixType &tmp,
+                                   const MatrixType &X, const MatrixType &Y,
+                                   const VectorType &x, const VectorType &y)
+      : _A(A), _F(F), _tmp(tmp), _X(X), _Y(Y), _piv(piv), _x(x), _y(y) {}
+
+  template <typename MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType &member) const {
+    const int l = member.league_rank();
+    auto A   = Kokkos::subview(_A, l, Kokkos::ALL(), Kokkos::ALL());
+    auto F   = Kokkos::subview(_F, l, Kokkos::ALL(), Kokkos::ALL());
+    auto tmp = Kokkos::subview(_tmp, l, Kokkos::ALL(), Kokkos::ALL());
+    auto X   = Kokkos::subview(_X, l, Kokkos::ALL(), Kokkos::ALL());
+    auto Y   = Kokkos::subview(_Y, l, Kokkos::ALL(), Kokkos::ALL());
+    auto piv = Kokkos::subview(_piv, l, Kokkos::ALL());
+    auto x   = Kokkos::subview(_x, l, Kokkos::ALL());
+    auto y   = Kokkos::subview(_y, l, Kokkos::ALL());
+
+    if (std::is_same<ModeType, Mode::Serial>::value) {
+      Kokkos::single(Kokkos::PerTeam(member), [&]() {
+        SerialGesvFactorize<AlgoTagType>::invoke(A, F, piv, tmp);
+        SerialGesvSolve<AlgoTagType>::invoke(F, piv, X, Y);
+        SerialGesvSolve<AlgoTagType>::invoke(F, piv, x, y);
+      });
+    } else if (std::is_same<ModeType, Mode::Team>::value) {
+      TeamGesvFactorize<MemberType, AlgoTagType>::invoke(member, A, F, piv);
+      TeamGesvSolve<MemberType, AlgoTagType>::invoke(member, F, piv, X, Y);
+      TeamGesvSolve<MemberType, AlgoTagType>::invoke(member, F, piv, x, y);
+    } else {
+      TeamVectorGesvFactorize<MemberType, AlgoTagType>::invoke(member, A, F,
+                                                               piv);
+      TeamVectorGesvSolve<MemberType, AlgoTagType>::invoke(member, F, piv, X,
+                                                           Y);
+      TeamVectorGesvSolve<MemberType, AlgoTagType>::invoke(member, F, piv, x,
+                                                           y);
+    }
+  }
+
+  inline void run() {
+    typedef typename MatrixType::value_type value_type;
+    std::string name_region("KokkosBatched::Test::GesvFactorize");
+    const std::string name_value_type = Test::value_type_name<value_type>();
+    std::string name = name_region + ModeType::name() + name_value_type;
+    Kokkos::Profiling::pushRegion(name.c_str());
+    Kokkos::TeamPolicy<execution_space> policy(_A.extent(0), Kokkos::AUTO);
+
+    using ScratchViewType =
+        Kokkos::View<typename MatrixType::non_const_value_type **,
+                     typename execution_space::scratch_memory_space>;
+    const int n = _A.extent(1);
+    policy.set_scratch_size(0, Kokkos::PerTeam(ScratchViewType::shmem_size(
+                                   n, 4)));
+
+    Kokkos::parallel_for(name.c_str(), policy, *this);
+    Kokkos::Profiling::popRegion();
+  }
+};
+
+/// With pivoting, the rows of diagonally dominant matrices are shifted by
+/// one so that their diagonal is small and the factorization has to pivot.
+template <typename DeviceType, typename ValueType, typename ModeType,
+          typename AlgoTagType>
+void impl_test_batched_gesv_factorize(const int N, const int n,
+                                      const int nrhs) {
+  typedef ValueType value_type;
+  typedef Kokkos::ArithTraits<value_type> ats;
+  using MatrixType =
+      Kokkos::View<value_type ***, Kokkos::LayoutRight, DeviceType>;
+  using VectorType =
+      Kokkos::View<value_type **, Kokkos::LayoutRight, DeviceType>;
+  using PivotType = Kokkos::View<int **, Kokkos::LayoutRight, DeviceType>;
+
+  const bool pivoting = std::is_same<AlgoTagType, Gesv::StaticPivoting>::value;
+
+  MatrixType A("A", N, n, n), F("F", N, n, n + 2), tmp("tmp", N, n, 4);
+  MatrixType X("X", N, n, nrhs), Y("Y", N, n, nrhs);
+  VectorType x("x", N, n), y("y", N, n);
+  PivotType piv("piv", N, n);
+
+  Kokkos::Random_XorShift64_Pool<typename DeviceType::execution_space> random(
+      13718);
+  Kokkos::fill_random(A, random, value_type(1.0));
+  Kokkos::fill_random(Y, random, value_type(1.0));
+  Kokkos::fill_random(y, random, value_type(1.0));
+  Kokkos::fence();
+
+  auto A_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A);
+  for (int l = 0; l < N; ++l)
+    for (int i = 0; i < n; ++i)
+      A_host(l, i, pivoting ? (i + 1) % n : i) += value_type(2.0 * n);
+  Kokkos::deep_copy(A, A_host);
+
+  Functor_TestBatchedGesvFactorize<DeviceType, MatrixType, PivotType,
+                                   VectorType, ModeType, AlgoTagType>(
+      A, F, piv, tmp, X, Y, x, y)
+      .run();
+  Kokkos::fence();
+
+  auto X_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), X);
+  auto Y_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), Y);
+  auto x_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), x);
+  auto y_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y);
+
+  /// check A0 * X = Y and A0 * x = y
+  typedef typename ats::mag_type mag_type;
+  const mag_type eps = 1.0e3 * ats::epsilon();
+  mag_type sum(1), diff(0);
+  for (int l = 0; l < N; ++l)
+    for (int i = 0; i < n; ++i) {
+      for (int r = 0; r < nrhs; ++r) {
+        value_type ax(0);
+        for (int j = 0; j < n; ++j) ax += A_host(l, i, j) * X_host(l, j, r);
+        sum += ats::abs(Y_host(l, i, r));
+        diff += ats::abs(ax - Y_host(l, i, r));
+      }
+      value_type ax(0);
+      for (int j = 0; j < n; ++j) ax += A_host(l, i, j) * x_host(l, j);
+      sum += ats::abs(y_host(l, i));
+      diff += ats::abs(ax - y_host(l, i));
+    }
+  EXPECT_NEAR_KK(diff / sum, 0.0, eps);
+}
+}  // namespace GesvFactorize
+}  // namespace Test
+
+template <typename DeviceType, typename ValueType, typename ModeType,
+          typename AlgoTagType>
+int test_batched_gesv_factorize() {
+  for (const int n : {1, 2, 3, 5, 10})
+    for (const int nrhs : {1, 4})
+      Test::GesvFactorize::impl_test_batched_gesv_factorize<
+          DeviceType, ValueType, ModeType, AlgoTagType>(64, n, nrhs);
+  return 0;
+}
+
+#if defined(KOKKOSKERNELS_INST_FLOAT)
+TEST_F(TestCategory, batched_scalar_gesv_factorize_float) {
+  test_batched_gesv_factorize<TestDevice, float, Mode::Serial,
+                              Gesv::StaticPivoting>();
+  test_batched_gesv_factorize<TestDevice, float, Mode::Team,
+                              Gesv::StaticPivoting>();
+  test_batched_gesv_factorize<TestDevice, float, Mode::TeamVector,
+                              Gesv::StaticPivoting>();
+  test_batched_gesv_factorize<TestDevice, float, Mode::Serial,
+                              Gesv::NoPivoting>();
+  test_batched_gesv_factorize<TestDevice, float, Mode::Team,
+                              Gesv::NoPivoting>();
+  test_batched_gesv_factorize<TestDevice, float, Mode::TeamVector,
+                              Gesv::NoPivoting>();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+TEST_F(TestCategory, batched_scalar_gesv_factorize_double) {
+  test_batched_gesv_factorize<TestDevice, double, Mode::Serial,
+                              Gesv::StaticPivoting>();
+  test_batched_gesv_factorize<TestDevice, double, Mode::Team,
+                              Gesv::StaticPivoting>();
+  test_batched_gesv_factorize<TestDevice, double, Mode::TeamVector,
+                              Gesv::StaticPivoting>();
+  test_batched_gesv_factorize<TestDevice, double, Mode::Serial,
+                              Gesv::NoPivoting>();
+  test_batched_gesv_factorize<TestDevice, double, Mode::Team,
+                              Gesv::NoPivoting>();
+  test_batched_gesv_factorize<TestDevice, double, Mode::TeamVector,
+                              Gesv::NoPivoting>();
+}
+#endif
@@ -0,0 +1,211 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include "gtest/gtest.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_Random.hpp"
+
+#include "KokkosBatched_Getrf_Decl.hpp"
+#include "KokkosBatched_Getrs_Decl.hpp"
+
+#include "KokkosKernels_TestUtils.hpp"
+
+using namespace KokkosBatched;
+
+namespace Test {
+namespace Getrf {
+
+template <typename DeviceType, typename ViewType, typename PivViewType,
+          typename InfoViewType, typename TransType, typename ModeType,
+          typename AlgoTagType>
+struct Functor_TestBatchedGetrf {
+  using execution_space = typename DeviceType::execution_space;
+  ViewType _a, _b;
+  PivViewType _piv;
+  InfoViewType _info;
+
+  Functor_TestBatchedGetrf(const ViewType &a, const PivViewType &piv,
+                           const ViewType &b, const InfoViewType &info)
+      : _a(a), _b(b), _piv(piv), _info(info) {}
+
+  template <typename MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType &member) const {
+    const int k = member.league_rank();
+    auto aa     = Kokkos::subview(_a, k, Kokkos::ALL(), Kokkos::ALL());
+    auto bb     = Kokkos::subview(_b, k, Kokkos::ALL(), Kokkos::ALL());
+    auto pp     = Kokkos::subview(_piv, k, Kokkos::ALL());
+    const int info =
+        KokkosBatched::Getrf<MemberType, ModeType, AlgoTagType>::invoke(
+            member, aa, pp);
+    if (info == 0)
+      KokkosBatched::Getrs<MemberType, TransType, ModeType,
+                           AlgoTagType>::invoke(member, aa, pp, bb);
+    Kokkos::single(Kokkos::PerTeam(member), [&]() { _info(k) = info; });
+  }
+
+  inline void run() {
+    typedef typename ViewType::value_type value_type;
+    std::string name_region("KokkosBatched::Test::Getrf");
+    const std::string name_value_type = Test::value_type_name<value_type>();
+    std::string name = name_region + ModeType::name() + name_value_type;
+    Kokkos::Profiling::pushRegion(name.c_str());
+    Kokkos::TeamPolicy<execution_space> policy(_a.extent(0), Kokkos::AUTO);
+    Kokkos::parallel_for(name.c_str(), policy, *this);
+    Kokkos::Profiling::popRegion();
+  }
+};
+
+template <typename DeviceType, typename ViewType, typename TransType,
+          typename ModeType, typename AlgoTagType>
+void impl_test_batched_getrf(const int N, const int BlkSize, const int nrhs) {
+  typedef typename ViewType::value_type value_type;
+  typedef Kokkos::ArithTraits<value_type> ats;
+  using piv_view_type  = Kokkos::View<int **, DeviceType>;
+  using info_view_type = Kokkos::View<int *, DeviceType>;
+  const bool trans = std::is_same<TransType, Trans::Transpose>::value;
+
+  /// randomized matrices, not diagonally dominant, with a zero leading entry
+  /// so that the factorization has to pivot
+  ViewType a0("a0", N, BlkSize, BlkSize);
+  ViewType a("a", N, BlkSize, BlkSize);
+  ViewType b("b", N, BlkSize, nrhs);
+  ViewType x("x", N, BlkSize, nrhs);
+  piv_view_type piv("piv", N, BlkSize);
+  info_view_type info("info", N);
+
+  Kokkos::Random_XorShift64_Pool<typename DeviceType::execution_space> random(
+      13718);
+  Kokkos::fill_random(a0, random, value_type(1.0));
+  Kokkos::fill_random(b, random, value_type(1.0));
+  Kokkos::fence();
+
+  auto a0_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), a0);
+  if (BlkSize > 1)
+    for (int k = 0; k < N; ++k) a0_host(k, 0, 0) = value_type(0);
+  Kokkos::deep_copy(a, a0_host);
+  Kokkos::deep_copy(x, b);
+
+  Functor_TestBatchedGetrf<DeviceType, ViewType, piv_view_type, info_view_type,
+                           TransType, ModeType, AlgoTagType>(a, piv, x, info)
+      .run();
+  Kokkos::fence();
+
+  /// check op(A0) * x = b relative to |op(A0)| * |x|, as LU with partial
+  /// pivoting is backward stable
+  auto x_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), x);
+  auto b_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), b);
+  auto info_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), info);
+  typedef typename ats::mag_type mag_type;
+  mag_type sum(1), diff(0);
+  const mag_type eps = 1.0e3 * ats::epsilon();
+
+  for (int k = 0; k < N; ++k) {
+    EXPECT_EQ(info_host(k), 0);
+    for (int i = 0; i < BlkSize; ++i)
+      for (int j = 0; j < nrhs; ++j) {
+        value_type ax = 0;
+        for (int l = 0; l < BlkSize; ++l) {
+          const value_type aij = trans ? a0_host(k, l, i) : a0_host(k, i, l);
+          ax += aij * x_host(k, l, j);
+          sum += ats::abs(aij) * ats::abs(x_host(k, l, j));
+        }
+        diff += ats::abs(ax - b_host(k, i, j));
+      }
+  }
+  EXPECT_NEAR_KK(diff / sum, 0.0, eps);
+
+  /// a zero column makes U singular at that column
+  if (BlkSize >= 2 && N > 0) {
+    for (int k = 0; k < N; ++k)
+      for (int i = 0; i < BlkSize; ++i) a0_host(k, i, 1) = value_type(0);
+    Kokkos::deep_copy(a, a0_host);
+    Functor_TestBatchedGetrf<DeviceType, ViewType, piv_view_type,
+                             info_view_type, TransType, ModeType,
+                             AlgoTagType>(a, piv, x, info)
+        .run();
+    Kokkos::deep_copy(info_host, info);
+    for (int k = 0; k < N; ++k) EXPECT_EQ(info_host(k), 2);
+  }
+}
+}  // namespace Getrf
+}  // namespace Test
+
+template <typename DeviceType, typename ValueType, typename ModeType,
+          typename AlgoTagType>
+int test_batched_getrf() {
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT)
+  {
+    typedef Kokkos::View<ValueType ***, Kokkos::LayoutLeft, DeviceType>
+        ViewType;
+    Test::Getrf::impl_test_batched_getrf<DeviceType, ViewType,
+                                         Trans::NoTranspose, ModeType,
+                                         AlgoTagType>(0, 10, 1);
+    for (int i = 0; i < 10; ++i) {
+      Test::Getrf::impl_test_batched_getrf<DeviceType, ViewType,
+                                           Trans::NoTranspose, ModeType,
+                                           AlgoTagType>(256, i, 3);
+      Test::Getrf::impl_test_batched_getrf<DeviceType, ViewType,
+                                           Trans::Transpose, ModeType,
+                                           AlgoTagType>(256, i, 1);
+    }
+  }
+#endif
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT)
+  {
+    typedef Kokkos::View<ValueType ***, Kokkos::LayoutRight, DeviceType>
+        ViewType;
+    Test::Getrf::impl_test_batched_getrf<DeviceType, ViewType,
+                                         Trans::NoTranspose, ModeType,
+                                         AlgoTagType>(0, 10, 1);
+    for (int i = 0; i < 10; ++i) {
+      Test::Getrf::impl_test_batched_getrf<DeviceType, ViewType,
+                                           Trans::NoTranspose, ModeType,
+                                           AlgoTagType>(256, i, 1);
+      Test::Getrf::impl_test_batched_getrf<DeviceType, ViewType,
+                                           Trans::Transpose, ModeType,
+                                           AlgoTagType>(256, i, 3);
+    }
+  }
+#endif
+
+  return 0;
+}
+
+#if defined(KOKKOSKERNELS_INST_FLOAT)
+TEST_F(TestCategory, batched_scalar_getrf_float) {
+  typedef Algo::Getrf::Unblocked algo_tag_type;
+  test_batched_getrf<TestDevice, float, Mode::Team, algo_tag_type>();
+  test_batched_getrf<TestDevice, float, Mode::TeamVector, algo_tag_type>();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+TEST_F(TestCategory, batched_scalar_getrf_double) {
+  typedef Algo::Getrf::Unblocked algo_tag_type;
+  test_batched_getrf<TestDevice, double, Mode::Team, algo_tag_type>();
+  test_batched_getrf<TestDevice, double, Mode::TeamVector, algo_tag_type>();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE)
+TEST_F(TestCategory, batched_scalar_getrf_dcomplex) {
+  typedef Algo::Getrf::Unblocked algo_tag_type;
+  test_batched_getrf<TestDevice, Kokkos::complex<double>, Mode::Team,
+                     algo_tag_type>();
+  test_batched_getrf<TestDevice, Kokkos::complex<double>, Mode::TeamVector,
+                     algo_tag_type>();
+}
+#endif
@@ -0,0 +1,186 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include "gtest/gtest.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_Random.hpp"
+
+#include "KokkosBatched_Gtsv_Decl.hpp"
+#include "KokkosBatched_Gpsv_Decl.hpp"
+
+#include "KokkosKernels_TestUtils.hpp"
+
+using namespace KokkosBatched;
+
+namespace Test {
+namespace Gtsv {
+
+/// the bands are stored as rows of e, dl, d, du, f; band l of system k is
+/// diags(k, l, :) with the offsets -2, -1, 0, 1, 2
+template <typename DeviceType, typename ViewType, typename BViewType,
+          typename ModeType, typename AlgoTagType, bool Penta>
+struct Functor_TestBatchedGtsv {
+  using execution_space = typename DeviceType::execution_space;
+  ViewType _diags;
+  BViewType _b;
+
+  Functor_TestBatchedGtsv(const ViewType &diags, const BViewType &b)
+      : _diags(diags), _b(b) {}
+
+  template <typename MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType &member) const {
+    const int k = member.league_rank();
+    const int n = _b.extent(1);
+    auto band   = [&](const int l, const int len) {
+      return Kokkos::subview(_diags, k, l, Kokkos::make_pair(0, len));
+    };
+    auto bb = Kokkos::subview(_b, k, Kokkos::ALL());
+    if constexpr (Penta) {
+      Kokkos::single(Kokkos::PerTeam(member), [&]() {
+        SerialGpsv<AlgoTagType>::invoke(band(0, n > 2 ? n - 2 : 0),
+                                        band(1, n > 1 ? n - 1 : 0), band(2, n),
+                                        band(3, n > 1 ? n - 1 : 0),
+                                        band(4, n > 2 ? n - 2 : 0), bb);
+      });
+    } else if constexpr (std::is_same<ModeType, Mode::Serial>::value) {
+      Kokkos::single(Kokkos::PerTeam(member), [&]() {
+        Gtsv<MemberType, ModeType, AlgoTagType>::invoke(
+            member, band(1, n > 1 ? n - 1 : 0), band(2, n),
+            band(3, n > 1 ? n - 1 : 0), bb);
+      });
+    } else {
+      Gtsv<MemberType, ModeType, AlgoTagType>::invoke(
+          member, band(1, n > 1 ? n - 1 : 0), band(2, n),
+          band(3, n > 1 ? n - 1 : 0), bb);
+    }
+  }
+
+  inline void run() {
+    typedef typename ViewType::value_type value_type;
+    std::string name_region("KokkosBatched::Test::Gtsv");
+    const std::string name_value_type = Test::value_type_name<value_type>();
+    std::string name = name_region + ModeType::name() + name_value_type;
+    Kokkos::Profiling::pushRegion(name.c_str());
+    Kokkos::TeamPolicy<execution_space> policy(_b.extent(0), Kokkos::AUTO);
+    Kokkos::parallel_for(name.c_str(), policy, *this);
+    Kokkos::Profiling::popRegion();
+  }
+};
+
+template <typename DeviceType, typename ValueType, typename ModeType,
+          typename AlgoTagType, bool Penta>
+void impl_test_batched_gtsv(const int N, const int BlkSize) {
+  typedef ValueType value_type;
+  typedef Kokkos::ArithTraits<value_type> ats;
+  using view_type   = Kokkos::View<value_type ***, DeviceType>;
+  using b_view_type = Kokkos::View<value_type **, DeviceType>;
+
+  /// randomized diagonally dominant systems
+  view_type diags("diags", N, 5, BlkSize);
+  b_view_type b("b", N, BlkSize);
+  b_view_type x("x", N, BlkSize);
+
+  Kokkos::Random_XorShift64_Pool<typename DeviceType::execution_space> random(
+      13718);
+  Kokkos::fill_random(diags, random, value_type(1.0));
+  Kokkos::fill_random(b, random, value_type(1.0));
+  Kokkos::fence();
+
+  auto a0_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), diags);
+  for (int k = 0; k < N; ++k)
+    for (int i = 0; i < BlkSize; ++i) {
+      a0_host(k, 2, i) += value_type(4.0);
+      if (!Penta) a0_host(k, 0, i) = a0_host(k, 4, i) = value_type(0);
+    }
+  Kokkos::deep_copy(diags, a0_host);
+  Kokkos::deep_copy(x, b);
+
+  Functor_TestBatchedGtsv<DeviceType, view_type, b_view_type, ModeType,
+                          AlgoTagType, Penta>(diags, x)
+      .run();
+  Kokkos::fence();
+
+  /// check A0 * x = b
+  auto x_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), x);
+  auto b_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), b);
+  typedef typename ats::mag_type mag_type;
+  mag_type sum(1), diff(0);
+  const mag_type eps = 1.0e3 * ats::epsilon();
+
+  for (int k = 0; k < N; ++k)
+    for (int i = 0; i < BlkSize; ++i) {
+      value_type ax = a0_host(k, 2, i) * x_host(k, i);
+      if (i > 1) ax += a0_host(k, 0, i - 2) * x_host(k, i - 2);
+      if (i > 0) ax += a0_host(k, 1, i - 1) * x_host(k, i - 1);
+      if (i + 1 < BlkSize) ax += a0_host(k, 3, i) * x_host(k, i + 1);
+      if (i + 2 < BlkSize) ax += a0_host(k, 4, i) * x_host(k, i + 2);
+      sum += ats::abs(b_host(k, i));
+      diff += ats::abs(ax - b_host(k, i));
+    }
+  EXPECT_NEAR_KK(diff / sum, 0.0, eps);
+}
+}  // namespace Gtsv
+}  // namespace Test
+
+template <typename DeviceType, typename ValueType, typename ModeType,
+          typename AlgoTagType>
+int test_batched_gtsv() {
+  Test::Gtsv::impl_test_batched_gtsv<DeviceType, ValueType, ModeType,
+                                     AlgoTagType, false>(0, 10);
+  for (int i = 0; i < 10; ++i)
+    Test::Gtsv::impl_test_batched_gtsv<DeviceType, ValueType, ModeType,
+                                       AlgoTagType, false>(256, i);
+  // long systems, with several levels of cyclic reduction
+  for (const int n : {63, 64, 65, 1000})
+    Test::Gtsv::impl_test_batched_gtsv<DeviceType, ValueType, ModeType,
+                                       AlgoTagType, false>(16, n);
+  if constexpr (std::is_same<ModeType, Mode::Serial>::value) {
+    for (int i = 0; i < 10; ++i)
+      Test::Gtsv::impl_test_batched_gtsv<DeviceType, ValueType, ModeType,
+                                         AlgoTagType, true>(256, i);
+  }
+  return 0;
+}
+
+#if defined(KOKKOSKERNELS_INST_FLOAT)
+TEST_F(TestCategory, batched_scalar_gtsv_float) {
+  typedef Algo::Gtsv::Unblocked algo_tag_type;
+  test_batched_gtsv<TestDevice, float, Mode::Serial, algo_tag_type>();
+  test_batched_gtsv<TestDevice, float, Mode::Team, algo_tag_type>();
+  test_batched_gtsv<TestDevice, float, Mode::TeamVector, algo_tag_type>();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+TEST_F(TestCategory, batched_scalar_gtsv_double) {
+  typedef Algo::Gtsv::Unblocked algo_tag_type;
+  test_batched_gtsv<TestDevice, double, Mode::Serial, algo_tag_type>();
+  test_batched_gtsv<TestDevice, double, Mode::Team, algo_tag_type>();
+  test_batched_gtsv<TestDevice, double, Mode::TeamVector, algo_tag_type>();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE)
+TEST_F(TestCategory, batched_scalar_gtsv_dcomplex) {
+  typedef Algo::Gtsv::Unblocked algo_tag_type;
+  test_batched_gtsv<TestDevice, Kokkos::complex<double>, Mode::Serial,
+                    algo_tag_type>();
+  test_batched_gtsv<TestDevice, Kokkos::complex<double>, Mode::Team,
+                    algo_tag_type>();
+  test_batched_gtsv<TestDevice, Kokkos::complex<double>, Mode::TeamVector,
+                    algo_tag_type>();
+}
+#endif
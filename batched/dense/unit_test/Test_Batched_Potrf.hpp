@@ -0,0 +1,214 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include "gtest/gtest.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_Random.hpp"
+
+#include "KokkosBatched_Potrf_Decl.hpp"
+#include "KokkosBatched_Potrs_Decl.hpp"
+
+#include "KokkosKernels_TestUtils.hpp"
+
+using namespace KokkosBatched;
+
+namespace Test {
+namespace Potrf {
+
+template <typename DeviceType, typename ViewType, typename InfoViewType,
+          typename UploType, typename ModeType, typename AlgoTagType>
+struct Functor_TestBatchedPotrf {
+  using execution_space = typename DeviceType::execution_space;
+  ViewType _a, _b;
+  InfoViewType _info;
+
+  Functor_TestBatchedPotrf(const ViewType &a, const ViewType &b,
+                           const InfoViewType &info)
+      : _a(a), _b(b), _info(info) {}
+
+  template <typename MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType &member) const {
+    const int k = member.league_rank();
+    auto aa     = Kokkos::subview(_a, k, Kokkos::ALL(), Kokkos::ALL());
+    auto bb     = Kokkos::subview(_b, k, Kokkos::ALL(), Kokkos::ALL());
+    const int info =
+        KokkosBatched::Potrf<MemberType, UploType, ModeType,
+                             AlgoTagType>::invoke(member, aa);
+    if (info == 0)
+      KokkosBatched::Potrs<MemberType, UploType, ModeType,
+                           AlgoTagType>::invoke(member, aa, bb);
+    Kokkos::single(Kokkos::PerTeam(member), [&]() { _info(k) = info; });
+  }
+
+  inline void run() {
+    typedef typename ViewType::value_type value_type;
+    std::string name_region("KokkosBatched::Test::Potrf");
+    const std::string name_value_type = Test::value_type_name<value_type>();
+    std::string name = name_region + ModeType::name() + name_value_type;
+    Kokkos::Profiling::pushRegion(name.c_str());
+    if constexpr (std::is_same<ModeType, Mode::Serial>::value) {
+      // one thread per matrix
+      Kokkos::TeamPolicy<execution_space> policy(_a.extent(0), 1);
+      Kokkos::parallel_for(name.c_str(), policy, *this);
+    } else {
+      Kokkos::TeamPolicy<execution_space> policy(_a.extent(0), Kokkos::AUTO);
+      Kokkos::parallel_for(name.c_str(), policy, *this);
+    }
+    Kokkos::Profiling::popRegion();
+  }
+};
+
+template <typename DeviceType, typename ViewType, typename UploType,
+          typename ModeType, typename AlgoTagType>
+void impl_test_batched_potrf(const int N, const int BlkSize, const int nrhs) {
+  typedef typename ViewType::value_type value_type;
+  typedef Kokkos::ArithTraits<value_type> ats;
+  using info_view_type = Kokkos::View<int *, DeviceType>;
+
+  /// randomized Hermitian positive definite matrices A0 = M * M^H + BlkSize * I
+  ViewType m0("m0", N, BlkSize, BlkSize);
+  ViewType a("a", N, BlkSize, BlkSize);
+  ViewType b("b", N, BlkSize, nrhs);
+  ViewType x("x", N, BlkSize, nrhs);
+  info_view_type info("info", N);
+
+  Kokkos::Random_XorShift64_Pool<typename DeviceType::execution_space> random(
+      13718);
+  Kokkos::fill_random(m0, random, value_type(1.0));
+  Kokkos::fill_random(b, random, value_type(1.0));
+  Kokkos::fence();
+
+  auto m0_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), m0);
+  auto a0_host = Kokkos::create_mirror_view(a);
+  for (int k = 0; k < N; ++k)
+    for (int i = 0; i < BlkSize; ++i)
+      for (int j = 0; j < BlkSize; ++j) {
+        value_type sum = i == j ? value_type(BlkSize) : value_type(0);
+        for (int l = 0; l < BlkSize; ++l)
+          sum += m0_host(k, i, l) * ats::conj(m0_host(k, j, l));
+        a0_host(k, i, j) = sum;
+      }
+  Kokkos::deep_copy(a, a0_host);
+  Kokkos::deep_copy(x, b);
+
+  Functor_TestBatchedPotrf<DeviceType, ViewType, info_view_type, UploType,
+                           ModeType, AlgoTagType>(a, x, info)
+      .run();
+  Kokkos::fence();
+
+  /// check A0 * x = b ; this eps is about 10^-14
+  auto x_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), x);
+  auto b_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), b);
+  auto info_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), info);
+  typedef typename ats::mag_type mag_type;
+  mag_type sum(1), diff(0);
+  const mag_type eps = 1.0e3 * ats::epsilon();
+
+  for (int k = 0; k < N; ++k) {
+    EXPECT_EQ(info_host(k), 0);
+    for (int i = 0; i < BlkSize; ++i)
+      for (int j = 0; j < nrhs; ++j) {
+        value_type ax = 0;
+        for (int l = 0; l < BlkSize; ++l)
+          ax += a0_host(k, i, l) * x_host(k, l, j);
+        sum += ats::abs(b_host(k, i, j));
+        diff += ats::abs(ax - b_host(k, i, j));
+      }
+  }
+  EXPECT_NEAR_KK(diff / sum, 0.0, eps);
+
+  /// a matrix that is not positive definite reports the failing minor
+  if (BlkSize >= 2 && N > 0) {
+    for (int k = 0; k < N; ++k) {
+      for (int i = 0; i < BlkSize; ++i)
+        for (int j = 0; j < BlkSize; ++j)
+          a0_host(k, i, j) = value_type(i == j ? (i == 1 ? -1.0 : 1.0) : 0.0);
+    }
+    Kokkos::deep_copy(a, a0_host);
+    Functor_TestBatchedPotrf<DeviceType, ViewType, info_view_type, UploType,
+                             ModeType, AlgoTagType>(a, x, info)
+        .run();
+    Kokkos::deep_copy(info_host, info);
+    for (int k = 0; k < N; ++k) EXPECT_EQ(info_host(k), 2);
+  }
+}
+}  // namespace Potrf
+}  // namespace Test
+
+template <typename DeviceType, typename ValueType, typename ModeType,
+          typename AlgoTagType>
+int test_batched_potrf() {
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT)
+  {
+    typedef Kokkos::View<ValueType ***, Kokkos::LayoutLeft, DeviceType>
+        ViewType;
+    Test::Potrf::impl_test_batched_potrf<DeviceType, ViewType, Uplo::Lower,
+                                         ModeType, AlgoTagType>(0, 10, 1);
+    for (int i = 0; i < 10; ++i) {
+      Test::Potrf::impl_test_batched_potrf<DeviceType, ViewType, Uplo::Lower,
+                                           ModeType, AlgoTagType>(256, i, 3);
+      Test::Potrf::impl_test_batched_potrf<DeviceType, ViewType, Uplo::Upper,
+                                           ModeType, AlgoTagType>(256, i, 1);
+    }
+  }
+#endif
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT)
+  {
+    typedef Kokkos::View<ValueType ***, Kokkos::LayoutRight, DeviceType>
+        ViewType;
+    Test::Potrf::impl_test_batched_potrf<DeviceType, ViewType, Uplo::Lower,
+                                         ModeType, AlgoTagType>(0, 10, 1);
+    for (int i = 0; i < 10; ++i) {
+      Test::Potrf::impl_test_batched_potrf<DeviceType, ViewType, Uplo::Lower,
+                                           ModeType, AlgoTagType>(256, i, 1);
+      Test::Potrf::impl_test_batched_potrf<DeviceType, ViewType, Uplo::Upper,
+                                           ModeType, AlgoTagType>(256, i, 3);
+    }
+  }
+#endif
+
+  return 0;
+}
+
+#if defined(KOKKOSKERNELS_INST_FLOAT)
+TEST_F(TestCategory, batched_scalar_potrf_float) {
+  typedef Algo::Potrf::Unblocked algo_tag_type;
+  test_batched_potrf<TestDevice, float, Mode::Serial, algo_tag_type>();
+  test_batched_potrf<TestDevice, float, Mode::Team, algo_tag_type>();
+  test_batched_potrf<TestDevice, float, Mode::TeamVector, algo_tag_type>();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+TEST_F(TestCategory, batched_scalar_potrf_double) {
+  typedef Algo::Potrf::Unblocked algo_tag_type;
+  test_batched_potrf<TestDevice, double, Mode::Serial, algo_tag_type>();
+  test_batched_potrf<TestDevice, double, Mode::Team, algo_tag_type>();
+  test_batched_potrf<TestDevice, double, Mode::TeamVector, algo_tag_type>();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE)
+TEST_F(TestCategory, batched_scalar_potrf_dcomplex) {
+  typedef Algo::Potrf::Unblocked algo_tag_type;
+  test_batched_potrf<TestDevice, Kokkos::complex<double>, Mode::Serial,
+                     algo_tag_type>();
+  test_batched_potrf<TestDevice, Kokkos::complex<double>, Mode::Team,
+                     algo_tag_type>();
+  test_batched_potrf<TestDevice, Kokkos::complex<double>, Mode::TeamVector,
+                     algo_tag_type>();
+}
+#endif
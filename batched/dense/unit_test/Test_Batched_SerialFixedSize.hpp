@@ -0,0 +1,220 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include "gtest/gtest.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_Random.hpp"
+
+#include "KokkosBatched_Gemm_Decl.hpp"
+#include "KokkosBatched_Gemm_Serial_Impl.hpp"
+#include "KokkosBatched_LU_Decl.hpp"
+#include "KokkosBatched_LU_Serial_Impl.hpp"
+#include "KokkosBatched_Trsv_Decl.hpp"
+#include "KokkosBatched_Trsv_Serial_Impl.hpp"
+#include "KokkosBatched_InverseLU_Decl.hpp"
+#include "KokkosBatched_Gesv.hpp"
+
+#include "KokkosKernels_TestUtils.hpp"
+
+using namespace KokkosBatched;
+
+namespace Test {
+namespace FixedSize {
+
+/// Runs the same kernels on views with compile-time extents (FViewType, which
+/// takes the unrolled path) and with runtime extents (DViewType); the results
+/// must agree.
+template <typename DeviceType, typename FViewType, typename FVecType,
+          typename DViewType, typename DVecType>
+struct Functor_TestBatchedSerialFixedSize {
+  using execution_space = typename DeviceType::execution_space;
+  FViewType _fa, _fb, _fc;
+  FVecType _fx, _fy;
+  DViewType _da, _db, _dc;
+  DVecType _dx, _dy;
+
+  Functor_TestBatchedSerialFixedSize(const FViewType &fa, const FViewType &fb,
+                                     const FViewType &fc, const FVecType &fx,
+                                     const FVecType &fy, const DViewType &da,
+                                     const DViewType &db, const DViewType &dc,
+                                     const DVecType &dx, const DVecType &dy)
+      : _fa(fa),
+        _fb(fb),
+        _fc(fc),
+        _fx(fx),
+        _fy(fy),
+        _da(da),
+        _db(db),
+        _dc(dc),
+        _dx(dx),
+        _dy(dy) {}
+
+  template <typename AViewType, typename CViewType, typename XViewType,
+            typename YViewType>
+  KOKKOS_INLINE_FUNCTION void run_kernels(const AViewType &A,
+                                          const AViewType &B,
+                                          const CViewType &C,
+                                          const XViewType &x,
+                                          const YViewType &y) const {
+    using value_type = typename AViewType::non_const_value_type;
+    SerialGemm<Trans::NoTranspose, Trans::NoTranspose,
+               Algo::Gemm::Unblocked>::invoke(value_type(1.5), A, B,
+                                              value_type(0.5), C);
+    SerialGemm<Trans::Transpose, Trans::Transpose,
+               Algo::Gemm::Unblocked>::invoke(value_type(-1), B, A,
+                                              value_type(1), C);
+    SerialLU<Algo::LU::Unblocked>::invoke(A);
+    SerialTrsv<Uplo::Lower, Trans::NoTranspose, Diag::Unit,
+               Algo::Trsv::Unblocked>::invoke(value_type(2), A, x);
+    SerialTrsv<Uplo::Upper, Trans::NoTranspose, Diag::NonUnit,
+               Algo::Trsv::Unblocked>::invoke(value_type(1), A, x);
+    SerialTrsv<Uplo::Upper, Trans::Transpose, Diag::NonUnit,
+               Algo::Trsv::Unblocked>::invoke(value_type(1), A, y);
+    SerialGesv<Gesv::NoPivoting>::invoke(B, x, y, B);
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const int k) const {
+    auto all = Kokkos::ALL();
+    static_assert(
+        is_fixed_size_v<decltype(Kokkos::subview(_fa, k, all, all)),
+                        decltype(Kokkos::subview(_fx, k, all))>,
+        "subviews must keep the compile-time extents");
+    run_kernels(Kokkos::subview(_fa, k, all, all),
+                Kokkos::subview(_fb, k, all, all),
+                Kokkos::subview(_fc, k, all, all),
+                Kokkos::subview(_fx, k, all), Kokkos::subview(_fy, k, all));
+    run_kernels(Kokkos::subview(_da, k, all, all),
+                Kokkos::subview(_db, k, all, all),
+                Kokkos::subview(_dc, k, all, all),
+                Kokkos::subview(_dx, k, all), Kokkos::subview(_dy, k, all));
+    // A holds its LU factors; InverseLU needs no workspace for fixed extents
+    SerialInverseLU<Algo::InverseLU::Unblocked>::invoke(
+        Kokkos::subview(_fa, k, all, all), Kokkos::subview(_fy, k, all));
+  }
+
+  inline void run() {
+    Kokkos::RangePolicy<execution_space> policy(0, _fa.extent(0));
+    Kokkos::parallel_for("KokkosBatched::Test::SerialFixedSize", policy,
+                         *this);
+  }
+};
+
+template <typename DeviceType, typename ValueType, typename LayoutType, int N>
+void impl_test_batched_serial_fixed_size(const int nb) {
+  typedef Kokkos::ArithTraits<ValueType> ats;
+  using fview_type = Kokkos::View<ValueType * [N][N], LayoutType, DeviceType>;
+  using fvec_type  = Kokkos::View<ValueType * [N], LayoutType, DeviceType>;
+  using dview_type = Kokkos::View<ValueType ***, LayoutType, DeviceType>;
+  using dvec_type  = Kokkos::View<ValueType **, LayoutType, DeviceType>;
+
+  fview_type fa("fa", nb), fb("fb", nb), fc("fc", nb);
+  fvec_type fx("fx", nb), fy("fy", nb);
+  dview_type da("da", nb, N, N), db("db", nb, N, N), dc("dc", nb, N, N);
+  dvec_type dx("dx", nb, N), dy("dy", nb, N);
+
+  // diagonally dominant, so that LU without pivoting is stable
+  Kokkos::Random_XorShift64_Pool<typename DeviceType::execution_space> random(
+      13718);
+  Kokkos::fill_random(fa, random, ValueType(1.0));
+  Kokkos::fill_random(fb, random, ValueType(1.0));
+  Kokkos::fill_random(fc, random, ValueType(1.0));
+  Kokkos::fill_random(fx, random, ValueType(1.0));
+  Kokkos::fill_random(fy, random, ValueType(1.0));
+  Kokkos::fence();
+  auto fa_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), fa);
+  auto fb_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), fb);
+  for (int k = 0; k < nb; ++k)
+    for (int i = 0; i < N; ++i) {
+      fa_host(k, i, i) += ValueType(2 * N);
+      fb_host(k, i, i) += ValueType(2 * N);
+    }
+  Kokkos::deep_copy(fa, fa_host);
+  Kokkos::deep_copy(fb, fb_host);
+  auto a0 = Kokkos::create_mirror(fa);
+  Kokkos::deep_copy(a0, fa);
+  Kokkos::deep_copy(da, fa);
+  Kokkos::deep_copy(db, fb);
+  Kokkos::deep_copy(dc, fc);
+  Kokkos::deep_copy(dx, fx);
+  Kokkos::deep_copy(dy, fy);
+
+  Functor_TestBatchedSerialFixedSize<DeviceType, fview_type, fvec_type,
+                                     dview_type, dvec_type>(
+      fa, fb, fc, fx, fy, da, db, dc, dx, dy)
+      .run();
+  Kokkos::fence();
+
+  auto fa_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), fa);
+  auto fb_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), fb);
+  auto fc_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), fc);
+  auto fx_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), fx);
+  auto da_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), da);
+  auto db_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), db);
+  auto dc_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), dc);
+  auto dx_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), dx);
+
+  typedef typename ats::mag_type mag_type;
+  const mag_type eps = 1.0e3 * ats::epsilon();
+  for (int k = 0; k < nb; ++k) {
+    mag_type diff(0), sum(1);
+    for (int i = 0; i < N; ++i) {
+      for (int j = 0; j < N; ++j) {
+        diff += ats::abs(fb_h(k, i, j) - db_h(k, i, j)) +
+                ats::abs(fc_h(k, i, j) - dc_h(k, i, j));
+        sum += ats::abs(db_h(k, i, j)) + ats::abs(dc_h(k, i, j));
+        // fa holds inv(A)
+        ValueType a_inv(0);
+        for (int l = 0; l < N; ++l) a_inv += a0(k, i, l) * fa_h(k, l, j);
+        diff += ats::abs(a_inv - ValueType(i == j ? 1 : 0));
+      }
+      diff += ats::abs(fx_h(k, i) - dx_h(k, i));
+      sum += ats::abs(dx_h(k, i));
+    }
+    EXPECT_NEAR_KK(diff / sum, 0.0, eps);
+  }
+}
+}  // namespace FixedSize
+}  // namespace Test
+
+template <typename DeviceType, typename ValueType, typename LayoutType>
+int test_batched_serial_fixed_size() {
+  Test::FixedSize::impl_test_batched_serial_fixed_size<DeviceType, ValueType,
+                                                       LayoutType, 1>(64);
+  Test::FixedSize::impl_test_batched_serial_fixed_size<DeviceType, ValueType,
+                                                       LayoutType, 2>(64);
+  Test::FixedSize::impl_test_batched_serial_fixed_size<DeviceType, ValueType,
+                                                       LayoutType, 3>(64);
+  Test::FixedSize::impl_test_batched_serial_fixed_size<DeviceType, ValueType,
+                                                       LayoutType, 4>(64);
+  Test::FixedSize::impl_test_batched_serial_fixed_size<DeviceType, ValueType,
+                                                       LayoutType, 5>(64);
+  Test::FixedSize::impl_test_batched_serial_fixed_size<DeviceType, ValueType,
+                                                       LayoutType, 8>(64);
+  return 0;
+}
+
+#if defined(KOKKOSKERNELS_INST_FLOAT)
+TEST_F(TestCategory, batched_scalar_serial_fixed_size_float) {
+  test_batched_serial_fixed_size<TestDevice, float, Kokkos::LayoutLeft>();
+  test_batched_serial_fixed_size<TestDevice, float, Kokkos::LayoutRight>();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+TEST_F(TestCategory, batched_scalar_serial_fixed_size_double) {
+  test_batched_serial_fixed_size<TestDevice, double, Kokkos::LayoutLeft>();
+  test_batched_serial_fixed_size<TestDevice, double, Kokkos::LayoutRight>();
+}
+#endif
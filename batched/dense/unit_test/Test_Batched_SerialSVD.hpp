@@ -54,35 +54,39 @@ typename V::non_const_value_type simpleNorm2(const V& v) {
 
 // Check that all columns of X are unit length and pairwise orthogonal
 template <typename Mat>
-void verifyOrthogonal(const Mat& X) {
+void verifyOrthogonal(
+    const Mat& X,
+    double tol = Test::svdEpsilon<typename Mat::non_const_value_type>()) {
   using Scalar = typename Mat::non_const_value_type;
   int k        = X.extent(1);
   for (int i = 0; i < k; i++) {
     auto col1  = Kokkos::subview(X, Kokkos::ALL(), i);
     double len = simpleNorm2(col1);
-    Test::EXPECT_NEAR_KK(len, 1.0, Test::svdEpsilon<Scalar>());
+    Test::EXPECT_NEAR_KK(len, 1.0, tol);
     for (int j = 0; j < i; j++) {
       auto col2 = Kokkos::subview(X, Kokkos::ALL(), j);
       double d  = Kokkos::ArithTraits<Scalar>::abs(simpleDot(col1, col2));
-      Test::EXPECT_NEAR_KK(d, 0.0, Test::svdEpsilon<Scalar>());
+      Test::EXPECT_NEAR_KK(d, 0.0, tol);
     }
   }
 }
 
 template <typename AView, typename UView, typename VtView, typename SigmaView>
-void verifySVD(const AView& A, const UView& U, const VtView& Vt,
-               const SigmaView& sigma) {
+void verifySVD(
+    const AView& A, const UView& U, const VtView& Vt, const SigmaView& sigma,
+    double orth_tol = Test::svdEpsilon<typename AView::non_const_value_type>(),
+    double tol = Test::svdEpsilon<typename AView::non_const_value_type>()) {
   using Scalar = typename AView::non_const_value_type;
   using KAT    = Kokkos::ArithTraits<Scalar>;
-  // Check that U/V columns are unit length and orthogonal, and that U *
-  // diag(sigma) * V^T == A
+  // Check that U/V columns are unit length and orthogonal (up to orth_tol),
+  // and that U * diag(sigma) * V^T == A (up to tol)
   int m       = A.extent(0);
   int n       = A.extent(1);
   int maxrank = std::min(m, n);
-  verifyOrthogonal(U);
+  verifyOrthogonal(U, orth_tol);
   // NOTE: V^T being square and orthonormal implies that V is, so we don't have
   // to transpose it here.
-  verifyOrthogonal(Vt);
+  verifyOrthogonal(Vt, orth_tol);
   Kokkos::View<Scalar**, typename AView::device_type> usvt("USV^T", m, n);
   for (int i = 0; i < maxrank; i++) {
     auto Ucol =
@@ -93,7 +97,7 @@ void verifySVD(const AView& A, const UView& U, const VtView& Vt,
   }
   for (int i = 0; i < m; i++) {
     for (int j = 0; j < n; j++) {
-      Test::EXPECT_NEAR_KK(usvt(i, j), A(i, j), Test::svdEpsilon<Scalar>());
+      Test::EXPECT_NEAR_KK(usvt(i, j), A(i, j), tol);
     }
   }
   // Make sure all singular values are positive
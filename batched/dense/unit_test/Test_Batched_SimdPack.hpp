@@ -0,0 +1,160 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+// Note: Vector<SIMD<T>> is a host type, so as the other vector tests this
+//       test is not included in the device backends unit-test
+
+#if !defined(TEST_CUDA_BATCHED_DENSE_CPP) && \
+    !defined(TEST_HIP_BATCHED_DENSE_CPP) &&  \
+    !defined(TEST_SYCL_BATCHED_DENSE_CPP) && \
+    !defined(TEST_OPENMPTARGET_BATCHED_DENSE_CPP)
+
+#include "gtest/gtest.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_Random.hpp"
+
+#include "KokkosBatched_SimdPack_Decl.hpp"
+#include "KokkosBatched_LU_Decl.hpp"
+
+#include "KokkosKernels_TestUtils.hpp"
+
+using namespace KokkosBatched;
+
+namespace Test {
+
+struct SimdPackedLUFunctor {
+  template <typename AViewType, typename BViewType, typename CViewType>
+  KOKKOS_INLINE_FUNCTION void operator()(const int, const AViewType &A,
+                                         const BViewType &b,
+                                         const CViewType &c) const {
+    SerialLU<Algo::LU::Unblocked>::invoke(A);
+    for (int i = 0, iend = c.extent(0); i < iend; ++i) c(i) = b(i) * A(i, i);
+  }
+};
+
+template <typename DeviceType, typename ValueType, int VectorLength>
+void impl_test_batched_simd_pack(const int N, const int m) {
+  using execution_space = typename DeviceType::execution_space;
+  using view_type =
+      Kokkos::View<ValueType ***, Kokkos::LayoutRight, DeviceType>;
+  using vector_view_type =
+      Kokkos::View<ValueType **, Kokkos::LayoutRight, DeviceType>;
+  using packed_type = SimdPackedViewType<view_type, VectorLength>;
+  using ats         = Kokkos::ArithTraits<ValueType>;
+  const typename ats::mag_type eps = 1.0e3 * ats::epsilon();
+
+  view_type A("A", N, m, m), A0("A0", N, m, m);
+  Kokkos::Random_XorShift64_Pool<execution_space> random(13718);
+  Kokkos::fill_random(A0, random, ValueType(1.0));
+  // a dominant diagonal, so that the LU without pivoting is well defined
+  auto A0_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A0);
+  for (int k = 0; k < N; ++k)
+    for (int i = 0; i < m; ++i) A0_host(k, i, i) += ValueType(2 * m);
+  Kokkos::deep_copy(A0, A0_host);
+
+  /// pack and unpack
+  {
+    typename packed_type::type Ap("Ap", (N + VectorLength - 1) / VectorLength,
+                                  m, m);
+    SimdPack(execution_space(), A0, Ap);
+    SimdUnpack(execution_space(), Ap, A);
+    auto Ap_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), Ap);
+    auto A_host  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A);
+    for (int k = 0; k < int(Ap.extent(0)) * VectorLength; ++k)
+      for (int i = 0; i < m; ++i)
+        for (int j = 0; j < m; ++j) {
+          // the lanes past the end of the batch replicate its last entry
+          const int kk = k < N ? k : N - 1;
+          EXPECT_NEAR_KK(Ap_host(k / VectorLength, i, j)[k % VectorLength],
+                         A0_host(kk, i, j), eps);
+          if (k < N) EXPECT_NEAR_KK(A_host(k, i, j), A0_host(k, i, j), eps);
+        }
+  }
+
+  /// in place
+  if (N % VectorLength == 0) {
+    Kokkos::deep_copy(A, A0);
+    auto Ap      = SimdPackInPlace<VectorLength>(execution_space(), A);
+    auto Ap_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), Ap);
+    for (int k = 0; k < N; ++k)
+      for (int i = 0; i < m; ++i)
+        for (int j = 0; j < m; ++j)
+          EXPECT_NEAR_KK(Ap_host(k / VectorLength, i, j)[k % VectorLength],
+                         A0_host(k, i, j), eps);
+    SimdUnpackInPlace(execution_space(), Ap);
+    auto A_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A);
+    for (int k = 0; k < N; ++k)
+      for (int i = 0; i < m; ++i)
+        for (int j = 0; j < m; ++j)
+          EXPECT_NEAR_KK(A_host(k, i, j), A0_host(k, i, j), eps);
+  }
+
+  /// packed mode against the scalar kernels
+  {
+    vector_view_type b("b", N, m), c("c", N, m), c0("c0", N, m);
+    Kokkos::fill_random(b, random, ValueType(1.0));
+    Kokkos::deep_copy(A, A0);
+    Kokkos::deep_copy(c, ValueType(-1.0));
+    typename vector_view_type::const_type b_const = b;
+    SimdPackedFor<VectorLength>(
+        "Test::SimdPackedFor", execution_space(),
+        SimdPackedLUFunctor(), A, b_const, c);
+
+    auto A_host  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A);
+    auto c_host  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), c);
+    auto b_host  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), b);
+    auto A1_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A0);
+    for (int k = 0; k < N; ++k) {
+      auto A1 = Kokkos::subview(A1_host, k, Kokkos::ALL(), Kokkos::ALL());
+      SerialLU<Algo::LU::Unblocked>::invoke(A1);
+      for (int i = 0; i < m; ++i) {
+        for (int j = 0; j < m; ++j)
+          EXPECT_NEAR_KK(A_host(k, i, j), A1(i, j), eps);
+        EXPECT_NEAR_KK(c_host(k, i), b_host(k, i) * A1(i, i), eps);
+      }
+    }
+  }
+}
+}  // namespace Test
+
+template <typename DeviceType, typename ValueType, int VectorLength>
+int test_batched_simd_pack() {
+  Test::impl_test_batched_simd_pack<DeviceType, ValueType, VectorLength>(0, 3);
+  Test::impl_test_batched_simd_pack<DeviceType, ValueType, VectorLength>(
+      4 * VectorLength, 5);
+  Test::impl_test_batched_simd_pack<DeviceType, ValueType, VectorLength>(
+      4 * VectorLength + 1, 4);
+  Test::impl_test_batched_simd_pack<DeviceType, ValueType, VectorLength>(
+      2 * VectorLength, 40);
+  return 0;
+}
+
+#if defined(KOKKOSKERNELS_INST_FLOAT)
+TEST_F(TestCategory, batched_simd_pack_float8) {
+  test_batched_simd_pack<TestDevice, float, 8>();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+TEST_F(TestCategory, batched_simd_pack_double3) {
+  test_batched_simd_pack<TestDevice, double, 3>();
+}
+TEST_F(TestCategory, batched_simd_pack_double4) {
+  test_batched_simd_pack<TestDevice, double, 4>();
+}
+#endif
+
+#endif  // check to not include this in a device test
@@ -0,0 +1,193 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include "gtest/gtest.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_Random.hpp"
+
+#include "KokkosBatched_Syev_Decl.hpp"
+
+#include "KokkosKernels_TestUtils.hpp"
+
+using namespace KokkosBatched;
+
+namespace Test {
+namespace Syev {
+
+template <typename DeviceType, typename AViewType, typename EViewType,
+          typename WViewType, typename ModeType, typename ArgUplo>
+struct Functor_TestBatchedSyev {
+  using execution_space = typename DeviceType::execution_space;
+  AViewType _a;
+  EViewType _e;
+  WViewType _w;
+  Kokkos::View<int *, DeviceType> _info;
+
+  Functor_TestBatchedSyev(const AViewType &a, const EViewType &e,
+                          const WViewType &w,
+                          const Kokkos::View<int *, DeviceType> &info)
+      : _a(a), _e(e), _w(w), _info(info) {}
+
+  template <typename MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType &member) const {
+    const int k = member.league_rank();
+    auto aa     = Kokkos::subview(_a, k, Kokkos::ALL(), Kokkos::ALL());
+    auto ee     = Kokkos::subview(_e, k, Kokkos::ALL());
+    auto ww     = Kokkos::subview(_w, k, Kokkos::ALL());
+    if constexpr (std::is_same<ModeType, Mode::Serial>::value) {
+      Kokkos::single(Kokkos::PerTeam(member), [&]() {
+        _info(k) = SerialSyev<ArgUplo>::invoke(aa, ee, ww);
+      });
+    } else {
+      const int r =
+          TeamVectorSyev<MemberType, ArgUplo>::invoke(member, aa, ee, ww);
+      Kokkos::single(Kokkos::PerTeam(member), [&]() { _info(k) = r; });
+    }
+  }
+
+  inline void run() {
+    typedef typename AViewType::value_type value_type;
+    std::string name_region("KokkosBatched::Test::Syev");
+    const std::string name_value_type = Test::value_type_name<value_type>();
+    std::string name = name_region + ModeType::name() + name_value_type;
+    Kokkos::Profiling::pushRegion(name.c_str());
+    Kokkos::TeamPolicy<execution_space> policy(_a.extent(0), Kokkos::AUTO);
+    Kokkos::parallel_for(name.c_str(), policy, *this);
+    Kokkos::Profiling::popRegion();
+  }
+};
+
+/// Clustered selects matrices with repeated eigenvalues, diag(0, 1, 2, 0, 1,
+/// 2, ...) rotated by a random orthogonal similarity
+template <typename DeviceType, typename ValueType, typename ModeType,
+          typename ArgUplo>
+void impl_test_batched_syev(const int N, const int BlkSize,
+                            const bool clustered = false) {
+  typedef ValueType value_type;
+  typedef Kokkos::ArithTraits<value_type> ats;
+  using a_view_type = Kokkos::View<value_type ***, DeviceType>;
+  using e_view_type = Kokkos::View<value_type **, DeviceType>;
+  using w_view_type =
+      Kokkos::View<value_type **, Kokkos::LayoutRight, DeviceType>;
+
+  a_view_type a0("a0", N, BlkSize, BlkSize), a("a", N, BlkSize, BlkSize);
+  e_view_type e("e", N, BlkSize);
+  w_view_type w("w", N, BlkSize * BlkSize + BlkSize + 1);
+  Kokkos::View<int *, DeviceType> info("info", N);
+
+  Kokkos::Random_XorShift64_Pool<typename DeviceType::execution_space> random(
+      13718);
+  Kokkos::fill_random(a0, random, value_type(1.0));
+  Kokkos::fence();
+
+  auto a0_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), a0);
+  for (int k = 0; k < N; ++k) {
+    if (clustered) {
+      // Q = I - 2 v v^T / (v^T v) with v the first column
+      value_type vv(0);
+      std::vector<value_type> v(BlkSize);
+      for (int i = 0; i < BlkSize; ++i) {
+        v[i] = a0_host(k, i, 0) + value_type(2);
+        vv += v[i] * v[i];
+      }
+      for (int i = 0; i < BlkSize; ++i)
+        for (int j = 0; j < BlkSize; ++j) {
+          value_type aij(0);
+          for (int l = 0; l < BlkSize; ++l) {
+            const value_type qil = (i == l) - 2 * v[i] * v[l] / vv;
+            const value_type qjl = (j == l) - 2 * v[j] * v[l] / vv;
+            aij += qil * value_type(l % 3) * qjl;
+          }
+          a0_host(k, i, j) = aij;
+        }
+    }
+    for (int i = 0; i < BlkSize; ++i)
+      for (int j = 0; j < i; ++j) a0_host(k, j, i) = a0_host(k, i, j);
+  }
+
+  // the unreferenced triangle must not be read
+  auto a_host = Kokkos::create_mirror_view(a);
+  Kokkos::deep_copy(a_host, a0_host);
+  for (int k = 0; k < N; ++k)
+    for (int i = 0; i < BlkSize; ++i)
+      for (int j = 0; j < BlkSize; ++j)
+        if (std::is_same<ArgUplo, Uplo::Lower>::value ? j > i : j < i)
+          a_host(k, i, j) = value_type(-99);
+  Kokkos::deep_copy(a, a_host);
+
+  Functor_TestBatchedSyev<DeviceType, a_view_type, e_view_type, w_view_type,
+                          ModeType, ArgUplo>(a, e, w, info)
+      .run();
+  Kokkos::fence();
+
+  /// check A0 * V = V * diag(e), V^T * V = I and the ordering of e
+  Kokkos::deep_copy(a_host, a);
+  auto e_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), e);
+  auto info_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), info);
+  typedef typename ats::mag_type mag_type;
+  const mag_type eps = 1.0e3 * ats::epsilon();
+
+  for (int k = 0; k < N; ++k) {
+    EXPECT_EQ(info_host(k), 0);
+    mag_type sum(1), diff(0), orth(0);
+    for (int i = 0; i < BlkSize; ++i)
+      for (int j = 0; j < BlkSize; ++j) {
+        value_type av(0), vv(0);
+        for (int l = 0; l < BlkSize; ++l) {
+          av += a0_host(k, i, l) * a_host(k, l, j);
+          vv += a_host(k, l, i) * a_host(k, l, j);
+        }
+        sum += ats::abs(a0_host(k, i, j));
+        diff += ats::abs(av - a_host(k, i, j) * e_host(k, j));
+        orth += ats::abs(vv - value_type(i == j));
+      }
+    EXPECT_NEAR_KK(diff / sum, 0.0, eps);
+    EXPECT_NEAR_KK(orth / (BlkSize + 1), 0.0, eps);
+    for (int i = 0; i + 1 < BlkSize; ++i)
+      EXPECT_LE(e_host(k, i), e_host(k, i + 1));
+  }
+}
+}  // namespace Syev
+}  // namespace Test
+
+template <typename DeviceType, typename ValueType, typename ModeType>
+int test_batched_syev() {
+  for (int i = 0; i < 13; ++i) {
+    Test::Syev::impl_test_batched_syev<DeviceType, ValueType, ModeType,
+                                       Uplo::Lower>(256, i);
+    Test::Syev::impl_test_batched_syev<DeviceType, ValueType, ModeType,
+                                       Uplo::Upper>(256, i);
+  }
+  Test::Syev::impl_test_batched_syev<DeviceType, ValueType, ModeType,
+                                     Uplo::Lower>(16, 9, true);
+  Test::Syev::impl_test_batched_syev<DeviceType, ValueType, ModeType,
+                                     Uplo::Lower>(16, 33);
+  return 0;
+}
+
+#if defined(KOKKOSKERNELS_INST_FLOAT)
+TEST_F(TestCategory, batched_scalar_syev_float) {
+  test_batched_syev<TestDevice, float, Mode::Serial>();
+  test_batched_syev<TestDevice, float, Mode::TeamVector>();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+TEST_F(TestCategory, batched_scalar_syev_double) {
+  test_batched_syev<TestDevice, double, Mode::Serial>();
+  test_batched_syev<TestDevice, double, Mode::TeamVector>();
+}
+#endif
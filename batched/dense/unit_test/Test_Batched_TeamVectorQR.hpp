@@ -60,8 +60,12 @@ struct Functor_TestBatchedTeamVectorQR {
     auto tt     = Kokkos::subview(_t, k, Kokkos::ALL());
     auto ww     = Kokkos::subview(_w, k, Kokkos::ALL());
 
+    using ApplyQAlgoTagType =
+        std::conditional_t<std::is_same_v<AlgoTagType, Algo::QR::Blocked>,
+                           Algo::ApplyQ::Blocked, Algo::ApplyQ::Unblocked>;
+
     // make diagonal dominant
-    Kokkos::parallel_for(Kokkos::TeamVectorRange(member, aa.extent(0)),
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(member, aa.extent(1)),
                          [&](const int &i) { aa(i, i) += add_this; });
 
     /// xx = 1
@@ -78,18 +82,21 @@ struct Functor_TestBatchedTeamVectorQR {
     TeamVectorQR<MemberType, AlgoTagType>::invoke(member, aa, tt, ww);
     member.team_barrier();
 
-    /// xx = bb;
-    TeamVectorCopy<MemberType, Trans::NoTranspose, 1>::invoke(member, bb, xx);
+    /// bb = Q^{T}bb;
+    TeamVectorApplyQ<MemberType, Side::Left, Trans::Transpose,
+                     ApplyQAlgoTagType>::invoke(member, aa, tt, bb, ww);
     member.team_barrier();
 
-    /// xx = Q^{T}xx;
-    TeamVectorApplyQ<MemberType, Side::Left, Trans::Transpose,
-                     Algo::ApplyQ::Unblocked>::invoke(member, aa, tt, xx, ww);
+    /// xx = bb(0:n);
+    const int n = aa.extent(1);
+    auto rr     = Kokkos::subview(aa, Kokkos::make_pair(0, n), Kokkos::ALL());
+    auto b1     = Kokkos::subview(bb, Kokkos::make_pair(0, n));
+    TeamVectorCopy<MemberType, Trans::NoTranspose, 1>::invoke(member, b1, xx);
     member.team_barrier();
 
     /// xx = R^{-1} xx
     TeamVectorTrsv<MemberType, Uplo::Upper, Trans::NoTranspose, Diag::NonUnit,
-                   Algo::Trsv::Unblocked>::invoke(member, one, aa, xx);
+                   Algo::Trsv::Unblocked>::invoke(member, one, rr, xx);
   }
 
   inline void run() {
@@ -109,16 +116,21 @@ struct Functor_TestBatchedTeamVectorQR {
 
 template <typename DeviceType, typename MatrixViewType, typename VectorViewType,
           typename WorkViewType, typename AlgoTagType>
-void impl_test_batched_qr(const int N, const int BlkSize) {
+void impl_test_batched_qr(const int N, const int BlkSize,
+                          const int NumRows = -1) {
   typedef typename MatrixViewType::non_const_value_type value_type;
   typedef Kokkos::ArithTraits<value_type> ats;
   const value_type one(1);
+  /// least squares with a tall matrix when NumRows > BlkSize
+  const int m  = NumRows < 0 ? BlkSize : NumRows;
+  const int nb = TeamVectorHouseholderWY_Internal::max_block_size;
+
   /// randomized input testing views
-  MatrixViewType a("a", N, BlkSize, BlkSize);
+  MatrixViewType a("a", N, m, BlkSize);
   VectorViewType x("x", N, BlkSize);
-  VectorViewType b("b", N, BlkSize);
+  VectorViewType b("b", N, m);
   VectorViewType t("t", N, BlkSize);
-  WorkViewType w("w", N, BlkSize);
+  WorkViewType w("w", N, nb * (nb + BlkSize));
 
   Kokkos::fence();
 
@@ -170,6 +182,10 @@ int test_batched_qr() {
       Test::impl_test_batched_qr<DeviceType, MatrixViewType, VectorViewType,
                                  WorkViewType, AlgoTagType>(1024, i);
     }
+    Test::impl_test_batched_qr<DeviceType, MatrixViewType, VectorViewType,
+                               WorkViewType, AlgoTagType>(1024, 20);
+    Test::impl_test_batched_qr<DeviceType, MatrixViewType, VectorViewType,
+                               WorkViewType, AlgoTagType>(256, 16, 64);
   }
 #endif
 #if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT)
@@ -187,6 +203,10 @@ int test_batched_qr() {
       Test::impl_test_batched_qr<DeviceType, MatrixViewType, VectorViewType,
                                  WorkViewType, AlgoTagType>(1024, i);
     }
+    Test::impl_test_batched_qr<DeviceType, MatrixViewType, VectorViewType,
+                               WorkViewType, AlgoTagType>(1024, 20);
+    Test::impl_test_batched_qr<DeviceType, MatrixViewType, VectorViewType,
+                               WorkViewType, AlgoTagType>(256, 16, 64);
   }
 #endif
 
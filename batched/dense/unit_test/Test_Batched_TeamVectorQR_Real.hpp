@@ -30,3 +30,20 @@ TEST_F(TestCategory, batched_scalar_teamvector_qr_double) {
 }
 #endif
 #endif
+
+#if defined(KOKKOSKERNELS_INST_FLOAT)
+TEST_F(TestCategory, batched_scalar_teamvector_qr_blocked_float) {
+  typedef Algo::QR::Blocked algo_tag_type;
+  test_batched_qr<TestDevice, float, algo_tag_type>();
+}
+#endif
+
+// FIXME_SYCL timeout
+#ifndef KOKKOS_ENABLE_SYCL
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+TEST_F(TestCategory, batched_scalar_teamvector_qr_blocked_double) {
+  typedef Algo::QR::Blocked algo_tag_type;
+  test_batched_qr<TestDevice, double, algo_tag_type>();
+}
+#endif
+#endif
@@ -0,0 +1,155 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+// Reuses verifySVD and createRandomMatrix from Test_Batched_SerialSVD.hpp
+
+#include "KokkosBatched_SVD_Decl.hpp"
+
+template <typename Matrices, typename Vectors>
+struct TeamVectorSVDFunctor_Full {
+  TeamVectorSVDFunctor_Full(const Matrices& A_, const Matrices& U_,
+                            const Matrices& Vt_, const Vectors& sigma_)
+      : A(A_), U(U_), Vt(Vt_), sigma(sigma_) {}
+
+  template <typename MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType& member) const {
+    const int k = member.league_rank();
+    auto all    = Kokkos::ALL();
+    KokkosBatched::TeamVectorSVD<MemberType>::invoke(
+        member, KokkosBatched::SVD_USV_Tag(), Kokkos::subview(A, k, all, all),
+        Kokkos::subview(U, k, all, all), Kokkos::subview(sigma, k, all),
+        Kokkos::subview(Vt, k, all, all));
+  }
+
+  Matrices A;
+  Matrices U;
+  Matrices Vt;
+  Vectors sigma;
+};
+
+template <typename Matrices, typename Vectors>
+struct TeamVectorSVDFunctor_SingularValuesOnly {
+  TeamVectorSVDFunctor_SingularValuesOnly(const Matrices& A_,
+                                          const Vectors& sigma_)
+      : A(A_), sigma(sigma_) {}
+
+  template <typename MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType& member) const {
+    const int k = member.league_rank();
+    auto all    = Kokkos::ALL();
+    KokkosBatched::TeamVectorSVD<MemberType>::invoke(
+        member, KokkosBatched::SVD_S_Tag(), Kokkos::subview(A, k, all, all),
+        Kokkos::subview(sigma, k, all));
+  }
+
+  Matrices A;
+  Vectors sigma;
+};
+
+template <typename Scalar, typename Layout, typename Device>
+void testTeamVectorSVD(int nb, int m, int n, int deficiency,
+                       double maxval = 1.0) {
+  using Matrix    = Kokkos::View<Scalar**, Layout, Device>;
+  using Matrices  = Kokkos::View<Scalar***, Layout, Device>;
+  using Vectors   = Kokkos::View<Scalar**, Layout, Device>;
+  using ExecSpace = typename Device::execution_space;
+  using KAT       = Kokkos::ArithTraits<Scalar>;
+  const int maxrank = std::min(m, n);
+  Matrices A("A", nb, m, n), U("U", nb, m, m), Vt("Vt", nb, n, n);
+  Vectors sigma1("sigma1", nb, maxrank), sigma2("sigma2", nb, maxrank);
+  // every batch member gets a different rank deficiency pattern
+  for (int k = 0; k < nb; ++k) {
+    Matrix Ak = createRandomMatrix<Matrix>(m, n, k % (deficiency + 1), maxval);
+    Kokkos::deep_copy(
+        Kokkos::subview(A, k, Kokkos::ALL(), Kokkos::ALL()), Ak);
+  }
+  // Fill U, Vt, sigma with nonzeros as well to make sure they are properly
+  // overwritten
+  Kokkos::deep_copy(U, -5.0);
+  Kokkos::deep_copy(Vt, -5.0);
+  Kokkos::deep_copy(sigma1, -5.0);
+  Kokkos::deep_copy(sigma2, -7.0);
+  typename Matrices::HostMirror Acopy("Acopy", nb, m, n);
+  Kokkos::deep_copy(Acopy, A);
+
+  Kokkos::TeamPolicy<ExecSpace> policy(nb, Kokkos::AUTO, Kokkos::AUTO);
+  Kokkos::parallel_for(
+      policy, TeamVectorSVDFunctor_Full<Matrices, Vectors>(A, U, Vt, sigma1));
+  Kokkos::deep_copy(A, Acopy);
+  Kokkos::parallel_for(
+      policy,
+      TeamVectorSVDFunctor_SingularValuesOnly<Matrices, Vectors>(A, sigma2));
+
+  auto Uhost  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), U);
+  auto Vthost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), Vt);
+  auto sigma1Host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), sigma1);
+  auto sigma2Host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), sigma2);
+  for (int k = 0; k < nb; ++k) {
+    auto all = Kokkos::ALL();
+    // The errors of the Jacobi SVD grow like eps * max(m, n) for U and V,
+    // and like eps * max(m, n) * ||A|| for the reconstruction and sigma.
+    double normA = 0;
+    for (int i = 0; i < m; i++) {
+      for (int j = 0; j < n; j++) {
+        normA += Acopy(k, i, j) * Acopy(k, i, j);
+      }
+    }
+    normA = std::sqrt(normA);
+
+    const double scaledEps = 10 * KAT::eps() * std::max(m, n);
+    const double orthTol   =
+        std::max<double>(Test::svdEpsilon<Scalar>(), scaledEps);
+    const double tol       = orthTol * std::max(normA, 1.0);
+    verifySVD(Kokkos::subview(Acopy, k, all, all),
+              Kokkos::subview(Uhost, k, all, all),
+              Kokkos::subview(Vthost, k, all, all),
+              Kokkos::subview(sigma1Host, k, all), orthTol, tol);
+    for (int i = 0; i < maxrank; i++) {
+      Test::EXPECT_NEAR_KK(sigma1Host(k, i), sigma2Host(k, i), tol);
+    }
+  }
+}
+
+template <typename Scalar, typename Layout, typename Device>
+void testTeamVectorSVD() {
+  testTeamVectorSVD<Scalar, Layout, Device>(2, 0, 0, 0);
+  testTeamVectorSVD<Scalar, Layout, Device>(2, 1, 0, 0);
+  testTeamVectorSVD<Scalar, Layout, Device>(2, 0, 1, 0);
+  testTeamVectorSVD<Scalar, Layout, Device>(4, 2, 2, 1);
+  testTeamVectorSVD<Scalar, Layout, Device>(4, 10, 8, 3);
+  testTeamVectorSVD<Scalar, Layout, Device>(4, 8, 10, 4);
+  testTeamVectorSVD<Scalar, Layout, Device>(4, 9, 9, 2);
+  testTeamVectorSVD<Scalar, Layout, Device>(3, 10, 1, 0);
+  testTeamVectorSVD<Scalar, Layout, Device>(3, 1, 10, 0);
+  testTeamVectorSVD<Scalar, Layout, Device>(3, 32, 32, 2);
+  // Test with all-zero matrices
+  testTeamVectorSVD<Scalar, Layout, Device>(2, 8, 10, 0, 0.0);
+}
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+TEST_F(TestCategory, batched_scalar_teamvector_svd_double) {
+  testTeamVectorSVD<double, Kokkos::LayoutLeft, TestDevice>();
+  testTeamVectorSVD<double, Kokkos::LayoutRight, TestDevice>();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_FLOAT)
+TEST_F(TestCategory, batched_scalar_teamvector_svd_float) {
+  testTeamVectorSVD<float, Kokkos::LayoutLeft, TestDevice>();
+  testTeamVectorSVD<float, Kokkos::LayoutRight, TestDevice>();
+}
+#endif
@@ -0,0 +1,191 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include "gtest/gtest.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_Random.hpp"
+
+#include "KokkosBatched_Trsm_Decl.hpp"
+#include "KokkosBatched_TrsmInverse_Decl.hpp"
+
+#include "KokkosKernels_TestUtils.hpp"
+
+using namespace KokkosBatched;
+
+namespace Test {
+namespace TrsmInverse {
+
+template <typename DeviceType, typename ViewType, typename ModeType,
+          typename ArgSide, typename ArgUplo, typename ArgTrans,
+          typename ArgDiag>
+struct Functor_TestBatchedTrsmInverse {
+  using execution_space = typename DeviceType::execution_space;
+  ViewType _a, _ainv, _b, _x;
+
+  Functor_TestBatchedTrsmInverse(const ViewType &a, const ViewType &ainv,
+                                 const ViewType &b, const ViewType &x)
+      : _a(a), _ainv(ainv), _b(b), _x(x) {}
+
+  template <typename MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType &member) const {
+    using value_type = typename ViewType::non_const_value_type;
+    using algo_type  = Algo::Gemm::Unblocked;
+
+    const int k = member.league_rank();
+    auto aa     = Kokkos::subview(_a, k, Kokkos::ALL(), Kokkos::ALL());
+    auto ai     = Kokkos::subview(_ainv, k, Kokkos::ALL(), Kokkos::ALL());
+    auto bb     = Kokkos::subview(_b, k, Kokkos::ALL(), Kokkos::ALL());
+    auto xx     = Kokkos::subview(_x, k, Kokkos::ALL(), Kokkos::ALL());
+
+    const value_type alpha(1.5);
+    if constexpr (std::is_same<ModeType, Mode::Serial>::value) {
+      Kokkos::single(Kokkos::PerTeam(member), [&]() {
+        using trsm_type = SerialTrsmInverse<ArgSide, ArgUplo, ArgTrans,
+                                            ArgDiag, algo_type>;
+        trsm_type::factorize(aa, ai);
+        trsm_type::invoke(alpha, ai, bb, xx);
+      });
+    } else if constexpr (std::is_same<ModeType, Mode::Team>::value) {
+      using trsm_type = TeamTrsmInverse<MemberType, ArgSide, ArgUplo, ArgTrans,
+                                        ArgDiag, algo_type>;
+      trsm_type::factorize(member, aa, ai);
+      trsm_type::invoke(member, alpha, ai, bb, xx);
+    } else {
+      using trsm_type = TeamVectorTrsmInverse<MemberType, ArgSide, ArgUplo,
+                                              ArgTrans, ArgDiag, algo_type>;
+      trsm_type::factorize(member, aa, ai);
+      trsm_type::invoke(member, alpha, ai, bb, xx);
+    }
+  }
+
+  inline void run() {
+    typedef typename ViewType::value_type value_type;
+    std::string name_region("KokkosBatched::Test::TrsmInverse");
+    const std::string name_value_type = Test::value_type_name<value_type>();
+    std::string name = name_region + ModeType::name() + name_value_type;
+    Kokkos::Profiling::pushRegion(name.c_str());
+    Kokkos::TeamPolicy<execution_space> policy(_a.extent(0), Kokkos::AUTO);
+    Kokkos::parallel_for(name.c_str(), policy, *this);
+    Kokkos::Profiling::popRegion();
+  }
+};
+
+/// compares X = alpha op(inv(A)) B (or alpha B op(inv(A))) against
+/// SerialTrsm applied to B in place on host
+template <typename DeviceType, typename ValueType, typename ModeType,
+          typename ArgSide, typename ArgUplo, typename ArgTrans,
+          typename ArgDiag>
+void impl_test_batched_trsm_inverse(const int N, const int BlkSize,
+                                    const int NumRhs) {
+  typedef ValueType value_type;
+  typedef Kokkos::ArithTraits<value_type> ats;
+  using view_type = Kokkos::View<value_type ***, DeviceType>;
+
+  const bool left = std::is_same<ArgSide, Side::Left>::value;
+  const int bm = left ? BlkSize : NumRhs, bn = left ? NumRhs : BlkSize;
+
+  view_type a("a", N, BlkSize, BlkSize), ainv("ainv", N, BlkSize, BlkSize);
+  view_type b("b", N, bm, bn), x("x", N, bm, bn);
+
+  Kokkos::Random_XorShift64_Pool<typename DeviceType::execution_space> random(
+      13718);
+  Kokkos::fill_random(a, random, value_type(1.0));
+  Kokkos::fill_random(b, random, value_type(1.0));
+  Kokkos::fence();
+
+  // keep the triangular factors well conditioned
+  auto a_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), a);
+  for (int k = 0; k < N; ++k)
+    for (int i = 0; i < BlkSize; ++i) a_host(k, i, i) += value_type(BlkSize);
+  Kokkos::deep_copy(a, a_host);
+
+  Functor_TestBatchedTrsmInverse<DeviceType, view_type, ModeType, ArgSide,
+                                 ArgUplo, ArgTrans, ArgDiag>(a, ainv, b, x)
+      .run();
+  Kokkos::fence();
+
+  auto b_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), b);
+  auto x_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), x);
+
+  typedef typename ats::mag_type mag_type;
+  const mag_type eps = 1e3 * ats::epsilon();
+  for (int k = 0; k < N; ++k) {
+    auto aa = Kokkos::subview(a_host, k, Kokkos::ALL(), Kokkos::ALL());
+    auto bb = Kokkos::subview(b_host, k, Kokkos::ALL(), Kokkos::ALL());
+    SerialTrsm<ArgSide, ArgUplo, ArgTrans, ArgDiag,
+               Algo::Trsm::Unblocked>::invoke(value_type(1.5), aa, bb);
+    for (int i = 0; i < bm; ++i)
+      for (int j = 0; j < bn; ++j)
+        EXPECT_NEAR_KK(ats::abs(x_host(k, i, j) - b_host(k, i, j)),
+                       mag_type(0), eps * (1 + ats::abs(b_host(k, i, j))));
+  }
+}
+
+}  // namespace TrsmInverse
+}  // namespace Test
+
+template <typename DeviceType, typename ValueType, typename ModeType>
+int test_batched_trsm_inverse() {
+  using namespace Test::TrsmInverse;
+  for (int m : {0, 1, 2, 5, 8, 13}) {
+    impl_test_batched_trsm_inverse<DeviceType, ValueType, ModeType, Side::Left,
+                                   Uplo::Lower, Trans::NoTranspose,
+                                   Diag::Unit>(64, m, 3);
+    impl_test_batched_trsm_inverse<DeviceType, ValueType, ModeType, Side::Left,
+                                   Uplo::Lower, Trans::NoTranspose,
+                                   Diag::NonUnit>(64, m, 3);
+    impl_test_batched_trsm_inverse<DeviceType, ValueType, ModeType, Side::Left,
+                                   Uplo::Upper, Trans::NoTranspose,
+                                   Diag::NonUnit>(64, m, 3);
+    impl_test_batched_trsm_inverse<DeviceType, ValueType, ModeType, Side::Left,
+                                   Uplo::Lower, Trans::Transpose,
+                                   Diag::NonUnit>(64, m, 3);
+    impl_test_batched_trsm_inverse<DeviceType, ValueType, ModeType, Side::Left,
+                                   Uplo::Upper, Trans::Transpose, Diag::Unit>(
+        64, m, 3);
+    impl_test_batched_trsm_inverse<DeviceType, ValueType, ModeType,
+                                   Side::Right, Uplo::Upper,
+                                   Trans::NoTranspose, Diag::NonUnit>(64, m,
+                                                                      4);
+    impl_test_batched_trsm_inverse<DeviceType, ValueType, ModeType,
+                                   Side::Right, Uplo::Upper, Trans::Transpose,
+                                   Diag::Unit>(64, m, 4);
+  }
+  return 0;
+}
+
+#if defined(KOKKOSKERNELS_INST_FLOAT)
+TEST_F(TestCategory, batched_scalar_serial_trsm_inverse_float) {
+  test_batched_trsm_inverse<TestDevice, float, Mode::Serial>();
+}
+TEST_F(TestCategory, batched_scalar_team_trsm_inverse_float) {
+  test_batched_trsm_inverse<TestDevice, float, Mode::Team>();
+}
+TEST_F(TestCategory, batched_scalar_teamvector_trsm_inverse_float) {
+  test_batched_trsm_inverse<TestDevice, float, Mode::TeamVector>();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+TEST_F(TestCategory, batched_scalar_serial_trsm_inverse_double) {
+  test_batched_trsm_inverse<TestDevice, double, Mode::Serial>();
+}
+TEST_F(TestCategory, batched_scalar_team_trsm_inverse_double) {
+  test_batched_trsm_inverse<TestDevice, double, Mode::Team>();
+}
+TEST_F(TestCategory, batched_scalar_teamvector_trsm_inverse_double) {
+  test_batched_trsm_inverse<TestDevice, double, Mode::TeamVector>();
+}
+#endif
@@ -0,0 +1,205 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include "gtest/gtest.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_Random.hpp"
+
+#include "KokkosBatched_HostLevel_VarSize.hpp"
+
+#include "KokkosKernels_TestUtils.hpp"
+
+using namespace KokkosBatched;
+
+namespace Test {
+namespace VarSize {
+
+/// sizes cycle through small and large matrices so that the batch needs both
+/// the order and the per-matrix offsets
+inline int varsize_extent(const int b, const int seed) {
+  return 1 + (b * seed) % 23 + ((b % 7 == 0) ? 40 : 0);
+}
+
+template <typename DeviceType, typename ValueType, typename ArgTransA,
+          typename ArgTransB>
+void impl_test_batched_varsize_gemm(const int N, const bool ordered) {
+  typedef ValueType value_type;
+  typedef Kokkos::ArithTraits<value_type> ats;
+  using size_view_type   = Kokkos::View<int *, DeviceType>;
+  using offset_view_type = Kokkos::View<size_t *, DeviceType>;
+  using flat_view_type   = Kokkos::View<value_type *, DeviceType>;
+
+  size_view_type m("m", N), n("n", N), k("k", N);
+  offset_view_type ao("ao", N), bo("bo", N), co("co", N);
+  auto m_host  = Kokkos::create_mirror_view(m);
+  auto n_host  = Kokkos::create_mirror_view(n);
+  auto k_host  = Kokkos::create_mirror_view(k);
+  auto ao_host = Kokkos::create_mirror_view(ao);
+  auto bo_host = Kokkos::create_mirror_view(bo);
+  auto co_host = Kokkos::create_mirror_view(co);
+  size_t asize = 0, bsize = 0, csize = 0;
+  for (int b = 0; b < N; ++b) {
+    m_host(b)  = varsize_extent(b, 5);
+    n_host(b)  = varsize_extent(b, 3);
+    k_host(b)  = varsize_extent(b, 11);
+    ao_host(b) = asize;
+    bo_host(b) = bsize;
+    co_host(b) = csize;
+    asize += m_host(b) * k_host(b);
+    bsize += k_host(b) * n_host(b);
+    csize += m_host(b) * n_host(b);
+  }
+  Kokkos::deep_copy(m, m_host);
+  Kokkos::deep_copy(n, n_host);
+  Kokkos::deep_copy(k, k_host);
+  Kokkos::deep_copy(ao, ao_host);
+  Kokkos::deep_copy(bo, bo_host);
+  Kokkos::deep_copy(co, co_host);
+
+  flat_view_type A("A", asize), B("B", bsize), C("C", csize);
+  Kokkos::Random_XorShift64_Pool<typename DeviceType::execution_space> random(
+      13718);
+  Kokkos::fill_random(A, random, value_type(1.0));
+  Kokkos::fill_random(B, random, value_type(1.0));
+  Kokkos::fill_random(C, random, value_type(1.0));
+  Kokkos::fence();
+
+  auto A_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A);
+  auto B_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), B);
+  auto C_ref  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), C);
+
+  const value_type alpha(1.5), beta(0.5);
+  Kokkos::View<int *, typename size_view_type::device_type> order;
+  if (ordered) order = BatchedVarSizeOrder(m, n, k);
+  BatchedVarSizeGemm<ArgTransA, ArgTransB>(alpha, m, n, k, A, ao, B, bo, beta,
+                                           C, co, order);
+  Kokkos::fence();
+  auto C_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), C);
+
+  const bool trans_a = std::is_same<ArgTransA, Trans::Transpose>::value;
+  const bool trans_b = std::is_same<ArgTransB, Trans::Transpose>::value;
+
+  typedef typename ats::mag_type mag_type;
+  const mag_type eps = 1e3 * ats::epsilon();
+  for (int b = 0; b < N; ++b) {
+    const int mm = m_host(b), nn = n_host(b), kk = k_host(b);
+    const value_type *a  = &A_host(ao_host(b));
+    const value_type *bb = &B_host(bo_host(b));
+    const value_type *c  = &C_host(co_host(b));
+    const value_type *cr = &C_ref(co_host(b));
+    for (int i = 0; i < mm; ++i)
+      for (int j = 0; j < nn; ++j) {
+        value_type s(0);
+        for (int p = 0; p < kk; ++p)
+          s += (trans_a ? a[p + i * kk] : a[i + p * mm]) *
+               (trans_b ? bb[j + p * nn] : bb[p + j * kk]);
+        const value_type ref = alpha * s + beta * cr[i + j * mm];
+        EXPECT_NEAR_KK(ats::abs(c[i + j * mm] - ref), mag_type(0),
+                       eps * kk);
+      }
+  }
+}
+
+template <typename DeviceType, typename ValueType>
+void impl_test_batched_varsize_lu(const int N) {
+  typedef ValueType value_type;
+  typedef Kokkos::ArithTraits<value_type> ats;
+  using size_view_type   = Kokkos::View<int *, DeviceType>;
+  using offset_view_type = Kokkos::View<size_t *, DeviceType>;
+  using flat_view_type   = Kokkos::View<value_type *, DeviceType>;
+
+  size_view_type n("n", N);
+  offset_view_type ao("ao", N);
+  auto n_host  = Kokkos::create_mirror_view(n);
+  auto ao_host = Kokkos::create_mirror_view(ao);
+  size_t asize = 0;
+  for (int b = 0; b < N; ++b) {
+    n_host(b)  = varsize_extent(b, 7);
+    ao_host(b) = asize;
+    asize += n_host(b) * n_host(b);
+  }
+  Kokkos::deep_copy(n, n_host);
+  Kokkos::deep_copy(ao, ao_host);
+
+  flat_view_type A("A", asize);
+  Kokkos::Random_XorShift64_Pool<typename DeviceType::execution_space> random(
+      13718);
+  Kokkos::fill_random(A, random, value_type(1.0));
+  Kokkos::fence();
+
+  // diagonally dominant, so no pivoting is needed
+  auto A_ref = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A);
+  for (int b = 0; b < N; ++b)
+    for (int i = 0; i < n_host(b); ++i)
+      A_ref(ao_host(b) + i + i * n_host(b)) += value_type(2 * n_host(b));
+  Kokkos::deep_copy(A, A_ref);
+
+  auto order = BatchedVarSizeOrder(n, n, n);
+  BatchedVarSizeLU(n, A, ao, order);
+  Kokkos::fence();
+  auto A_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A);
+
+  typedef typename ats::mag_type mag_type;
+  const mag_type eps = 1e3 * ats::epsilon();
+  for (int b = 0; b < N; ++b) {
+    const int nn        = n_host(b);
+    const value_type *a = &A_host(ao_host(b));
+    const value_type *r = &A_ref(ao_host(b));
+    for (int i = 0; i < nn; ++i)
+      for (int j = 0; j < nn; ++j) {
+        // (L U)(i, j) with the unit diagonal of L implicit
+        value_type s(0);
+        for (int p = 0; p <= (i < j ? i : j); ++p)
+          s += (p == i ? value_type(1) : a[i + p * nn]) * a[p + j * nn];
+        EXPECT_NEAR_KK(ats::abs(s - r[i + j * nn]), mag_type(0),
+                       eps * (1 + ats::abs(r[i + j * nn])));
+      }
+  }
+}
+
+}  // namespace VarSize
+}  // namespace Test
+
+template <typename DeviceType, typename ValueType>
+int test_batched_varsize() {
+  using namespace Test::VarSize;
+  impl_test_batched_varsize_gemm<DeviceType, ValueType, Trans::NoTranspose,
+                                 Trans::NoTranspose>(0, true);
+  impl_test_batched_varsize_gemm<DeviceType, ValueType, Trans::NoTranspose,
+                                 Trans::NoTranspose>(97, false);
+  impl_test_batched_varsize_gemm<DeviceType, ValueType, Trans::NoTranspose,
+                                 Trans::NoTranspose>(97, true);
+  impl_test_batched_varsize_gemm<DeviceType, ValueType, Trans::Transpose,
+                                 Trans::NoTranspose>(97, true);
+  impl_test_batched_varsize_gemm<DeviceType, ValueType, Trans::NoTranspose,
+                                 Trans::Transpose>(97, true);
+  impl_test_batched_varsize_gemm<DeviceType, ValueType, Trans::Transpose,
+                                 Trans::Transpose>(97, true);
+  impl_test_batched_varsize_lu<DeviceType, ValueType>(0);
+  impl_test_batched_varsize_lu<DeviceType, ValueType>(97);
+  return 0;
+}
+
+#if defined(KOKKOSKERNELS_INST_FLOAT)
+TEST_F(TestCategory, batched_scalar_varsize_float) {
+  test_batched_varsize<TestDevice, float>();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+TEST_F(TestCategory, batched_scalar_varsize_double) {
+  test_batched_varsize<TestDevice, double>();
+}
+#endif
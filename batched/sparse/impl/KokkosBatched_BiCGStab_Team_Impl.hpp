@@ -0,0 +1,281 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_BICGSTAB_TEAM_IMPL_HPP__
+#define __KOKKOSBATCHED_BICGSTAB_TEAM_IMPL_HPP__
+
+#include "KokkosBatched_Util.hpp"
+
+#include "KokkosBatched_Axpy.hpp"
+#include "KokkosBatched_Copy_Decl.hpp"
+#include "KokkosBatched_Dot.hpp"
+#include "KokkosBatched_Spmv.hpp"
+#include "KokkosBatched_Xpay.hpp"
+
+namespace KokkosBatched {
+
+///
+/// Team BiCGStab
+///   A nested parallel_for with TeamThreadRange is used.
+///   Unlike GMRES, the work space does not grow with the number of
+///   iterations: six vectors and nine scalars per system.
+///
+
+template <typename MemberType>
+template <typename OperatorType, typename VectorViewType,
+          typename KrylovHandleType, typename TMPViewType,
+          typename TMPNormViewType>
+KOKKOS_INLINE_FUNCTION int TeamBiCGStab<MemberType>::invoke(
+    const MemberType& member, const OperatorType& A, const VectorViewType& _B,
+    const VectorViewType& _X, const KrylovHandleType& handle,
+    const TMPViewType& _TMPView, const TMPNormViewType& _TMPNormView) {
+  typedef int OrdinalType;
+  typedef typename Kokkos::ArithTraits<
+      typename VectorViewType::non_const_value_type>::mag_type MagnitudeType;
+
+  const size_t maximum_iteration = handle.get_max_iteration();
+  const MagnitudeType tolerance  = handle.get_tolerance();
+
+  using TeamCopy1D = TeamCopy<MemberType, Trans::NoTranspose, 1>;
+
+  const OrdinalType numMatrices = _X.extent(0);
+  const OrdinalType numRows     = _X.extent(1);
+
+  int offset_R    = 0;
+  int offset_Rhat = offset_R + numRows;
+  int offset_P    = offset_Rhat + numRows;
+  int offset_V    = offset_P + numRows;
+  int offset_T    = offset_V + numRows;
+  int offset_X    = offset_T + numRows;
+
+  // s shares the storage of r
+  auto R    = Kokkos::subview(_TMPView, Kokkos::ALL,
+                              Kokkos::make_pair(offset_R, offset_R + numRows));
+  auto Rhat = Kokkos::subview(
+      _TMPView, Kokkos::ALL,
+      Kokkos::make_pair(offset_Rhat, offset_Rhat + numRows));
+  auto P = Kokkos::subview(_TMPView, Kokkos::ALL,
+                           Kokkos::make_pair(offset_P, offset_P + numRows));
+  auto V = Kokkos::subview(_TMPView, Kokkos::ALL,
+                           Kokkos::make_pair(offset_V, offset_V + numRows));
+  auto T = Kokkos::subview(_TMPView, Kokkos::ALL,
+                           Kokkos::make_pair(offset_T, offset_T + numRows));
+  auto X = Kokkos::subview(_TMPView, Kokkos::ALL,
+                           Kokkos::make_pair(offset_X, offset_X + numRows));
+
+  auto sqr_norm_0 = Kokkos::subview(_TMPNormView, Kokkos::ALL, 0);
+  auto sqr_norm_j = Kokkos::subview(_TMPNormView, Kokkos::ALL, 1);
+  auto rho        = Kokkos::subview(_TMPNormView, Kokkos::ALL, 2);
+  auto alpha      = Kokkos::subview(_TMPNormView, Kokkos::ALL, 3);
+  auto omega      = Kokkos::subview(_TMPNormView, Kokkos::ALL, 4);
+  auto beta       = Kokkos::subview(_TMPNormView, Kokkos::ALL, 5);
+  auto mask       = Kokkos::subview(_TMPNormView, Kokkos::ALL, 6);
+  auto tmp        = Kokkos::subview(_TMPNormView, Kokkos::ALL, 7);
+  auto tmp2       = Kokkos::subview(_TMPNormView, Kokkos::ALL, 8);
+
+  TeamCopy<MemberType>::invoke(member, _X, X);
+  // Deep copy of b into r_0:
+  TeamCopy<MemberType>::invoke(member, _B, R);
+
+  // r_0 := b - A x_0
+  member.team_barrier();
+  A.template apply<Trans::NoTranspose, Mode::Team>(member, X, R, -1, 1);
+  member.team_barrier();
+
+  // Deep copy of r_0 into the shadow residual and p_0:
+  TeamCopy<MemberType>::invoke(member, R, Rhat);
+  TeamCopy<MemberType>::invoke(member, R, P);
+
+  TeamDot<MemberType>::invoke(member, R, R, sqr_norm_0);
+  member.team_barrier();
+
+  Kokkos::parallel_for(Kokkos::TeamThreadRange(member, 0, numMatrices),
+                       [&](const OrdinalType& i) {
+                         mask(i) =
+                             sqr_norm_0(i) > tolerance * tolerance ? 1. : 0;
+                       });
+
+  // rho_0 = (rhat, r_0) = (r_0, r_0)
+  TeamCopy1D::invoke(member, sqr_norm_0, rho);
+  member.team_barrier();
+
+  int status               = 1;
+  int number_not_converged = 0;
+
+  for (size_t j = 0; j < maximum_iteration; ++j) {
+    if (j > 0) {
+      // p_j := r_j + beta (p_{j-1} - omega v_{j-1})
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(member, 0, numMatrices),
+                           [&](const OrdinalType& i) { tmp(i) = -omega(i); });
+      member.team_barrier();
+
+      TeamAxpy<MemberType>::invoke(member, tmp, V, P);
+      member.team_barrier();
+
+      TeamXpay<MemberType>::invoke(member, beta, R, P);
+      member.team_barrier();
+    }
+
+    // v := A p_j
+    A.template apply<Trans::NoTranspose, Mode::Team>(member, P, V);
+    member.team_barrier();
+
+    TeamDot<MemberType>::invoke(member, Rhat, V, tmp);
+    member.team_barrier();
+
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(member, 0, numMatrices),
+        [&](const OrdinalType& i) {
+          alpha(i) = mask(i) != 0. && tmp(i) != 0. ? rho(i) / tmp(i) : 0.;
+          tmp(i)   = -alpha(i);
+        });
+    member.team_barrier();
+
+    // x := alpha p_j + x_j
+    TeamAxpy<MemberType>::invoke(member, alpha, P, X);
+
+    // s := - alpha v + r_j
+    TeamAxpy<MemberType>::invoke(member, tmp, V, R);
+    member.team_barrier();
+
+    // t := A s
+    A.template apply<Trans::NoTranspose, Mode::Team>(member, R, T);
+    member.team_barrier();
+
+    TeamDot<MemberType>::invoke(member, T, R, tmp);
+    TeamDot<MemberType>::invoke(member, T, T, tmp2);
+    TeamDot<MemberType>::invoke(member, R, R, sqr_norm_j);
+    member.team_barrier();
+
+    // a system whose s already satisfies the tolerance stops with omega = 0
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(member, 0, numMatrices),
+        [&](const OrdinalType& i) {
+          omega(i) = mask(i) != 0. &&
+                             sqr_norm_j(i) / sqr_norm_0(i) >
+                                 tolerance * tolerance &&
+                             tmp2(i) != 0.
+                         ? tmp(i) / tmp2(i)
+                         : 0.;
+          tmp(i) = -omega(i);
+        });
+    member.team_barrier();
+
+    // x_{j+1} := omega s + x
+    TeamAxpy<MemberType>::invoke(member, omega, R, X);
+
+    // r_{j+1} := - omega t + s
+    TeamAxpy<MemberType>::invoke(member, tmp, T, R);
+    member.team_barrier();
+
+    TeamDot<MemberType>::invoke(member, R, R, sqr_norm_j);
+    member.team_barrier();
+
+    // Relative convergence check:
+    number_not_converged = 0;
+    Kokkos::parallel_reduce(
+        Kokkos::TeamThreadRange(member, 0, numMatrices),
+        [&](const OrdinalType& i, int& lnumber_not_converged) {
+          if (sqr_norm_j(i) / sqr_norm_0(i) > tolerance * tolerance)
+            ++lnumber_not_converged;
+          else
+            mask(i) = 0.;
+        },
+        number_not_converged);
+
+    member.team_barrier();
+
+    if (number_not_converged == 0) {
+      status = 0;
+      break;
+    }
+
+    // beta := (rho_{j+1} / rho_j) (alpha / omega)
+    TeamDot<MemberType>::invoke(member, Rhat, R, tmp);
+    member.team_barrier();
+
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(member, 0, numMatrices),
+        [&](const OrdinalType& i) {
+          beta(i) = mask(i) != 0. && rho(i) != 0. && omega(i) != 0.
+                        ? (tmp(i) / rho(i)) * (alpha(i) / omega(i))
+                        : 0.;
+          rho(i) = tmp(i);
+        });
+    member.team_barrier();
+  }
+
+  TeamCopy<MemberType>::invoke(member, X, _X);
+  return status;
+}
+
+template <typename MemberType>
+template <typename OperatorType, typename VectorViewType,
+          typename KrylovHandleType>
+KOKKOS_INLINE_FUNCTION int TeamBiCGStab<MemberType>::invoke(
+    const MemberType& member, const OperatorType& A, const VectorViewType& _B,
+    const VectorViewType& _X, const KrylovHandleType& handle) {
+  const int strategy = handle.get_memory_strategy();
+  const OperatorType A_op = Impl::krylov_operator(member, A, handle);
+  if (strategy == 0) {
+    using ScratchPadVectorViewType = Kokkos::View<
+        typename VectorViewType::non_const_value_type**,
+        typename VectorViewType::array_layout,
+        typename VectorViewType::execution_space::scratch_memory_space>;
+    using ScratchPadNormViewType = Kokkos::View<
+        typename Kokkos::ArithTraits<
+            typename VectorViewType::non_const_value_type>::mag_type**,
+        typename VectorViewType::execution_space::scratch_memory_space>;
+
+    const int numMatrices = _X.extent(0);
+    const int numRows     = _X.extent(1);
+
+    ScratchPadVectorViewType _TMPView(
+        member.team_scratch(handle.get_scratch_pad_level()), numMatrices,
+        6 * numRows);
+
+    ScratchPadNormViewType _TMPNormView(
+        member.team_scratch(handle.get_scratch_pad_level()), numMatrices, 9);
+
+    return invoke<OperatorType, VectorViewType, KrylovHandleType>(
+        member, A_op, _B, _X, handle, _TMPView, _TMPNormView);
+  }
+  if (strategy == 1) {
+    const int first_matrix = handle.first_index(member.league_rank());
+    const int last_matrix  = handle.last_index(member.league_rank());
+
+    using ScratchPadNormViewType = Kokkos::View<
+        typename Kokkos::ArithTraits<
+            typename VectorViewType::non_const_value_type>::mag_type**,
+        typename VectorViewType::execution_space::scratch_memory_space>;
+
+    const int numMatrices = _X.extent(0);
+
+    auto _TMPView = Kokkos::subview(
+        handle.tmp_view, Kokkos::make_pair(first_matrix, last_matrix),
+        Kokkos::ALL);
+
+    ScratchPadNormViewType _TMPNormView(
+        member.team_scratch(handle.get_scratch_pad_level()), numMatrices, 9);
+
+    return invoke<OperatorType, VectorViewType, KrylovHandleType>(
+        member, A_op, _B, _X, handle, _TMPView, _TMPNormView);
+  }
+  return 0;
+}
+
+}  // namespace KokkosBatched
+
+#endif
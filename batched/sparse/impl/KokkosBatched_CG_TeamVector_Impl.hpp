@@ -25,6 +25,7 @@
 #include "KokkosBatched_Dot.hpp"
 #include "KokkosBatched_Spmv.hpp"
 #include "KokkosBatched_Xpay.hpp"
+#include "KokkosBatched_Krylov_Compaction_Impl.hpp"
 
 namespace KokkosBatched {
 
@@ -93,60 +94,97 @@ KOKKOS_INLINE_FUNCTION int TeamVectorCG<MemberType>::invoke(
                        [&](const OrdinalType& i) {
                          mask(i) =
                              sqr_norm_0(i) > tolerance * tolerance ? 1. : 0;
+                         if (mask(i) == 0.)
+                           handle.set_iteration(member.league_rank(), i, 0);
                        });
 
+  // Permutation of the systems used by the compaction of the active ones:
+  using ScratchPadIntViewType =
+      Kokkos::View<int*, typename VectorViewType::execution_space::
+                             scratch_memory_space>;
+  const bool compaction =
+      Impl::is_compactable_operator<OperatorType>::value &&
+      handle.get_compaction_period() > 0;
+  ScratchPadIntViewType perm, swaps;
+  if (compaction) {
+    perm  = ScratchPadIntViewType(
+        member.team_scratch(handle.get_scratch_pad_level()), numMatrices);
+    swaps = ScratchPadIntViewType(
+        member.team_scratch(handle.get_scratch_pad_level()), numMatrices);
+    Impl::TeamKrylovCompaction::initialize(member, perm);
+  }
+
   TeamVectorCopy1D::invoke(member, sqr_norm_0, sqr_norm_j);
 
   int status               = 1;
   int number_not_converged = 0;
+  int n_active             = numMatrices;
 
   for (size_t j = 0; j < maximum_iteration; ++j) {
+    // Restriction to the active systems:
+    auto P_a = Kokkos::subview(P, Kokkos::make_pair(0, n_active), Kokkos::ALL);
+    auto Q_a = Kokkos::subview(Q, Kokkos::make_pair(0, n_active), Kokkos::ALL);
+    auto R_a = Kokkos::subview(R, Kokkos::make_pair(0, n_active), Kokkos::ALL);
+    auto X_a = Kokkos::subview(X, Kokkos::make_pair(0, n_active), Kokkos::ALL);
+    auto sqr_norm_0_a =
+        Kokkos::subview(sqr_norm_0, Kokkos::make_pair(0, n_active));
+    auto sqr_norm_j_a =
+        Kokkos::subview(sqr_norm_j, Kokkos::make_pair(0, n_active));
+    auto alpha_a = Kokkos::subview(alpha, Kokkos::make_pair(0, n_active));
+    auto mask_a  = Kokkos::subview(mask, Kokkos::make_pair(0, n_active));
+    auto tmp_a   = Kokkos::subview(tmp, Kokkos::make_pair(0, n_active));
+    const OperatorType A_a = Impl::first_systems(A, n_active, 0);
+
     // q := A p_j
-    A.template apply<Trans::NoTranspose, Mode::TeamVector>(member, P, Q);
+    A_a.template apply<Trans::NoTranspose, Mode::TeamVector>(member, P_a, Q_a);
     member.team_barrier();
 
-    TeamVectorDot<MemberType>::invoke(member, P, Q, tmp);
+    TeamVectorDot<MemberType>::invoke(member, P_a, Q_a, tmp_a);
     member.team_barrier();
 
-    Kokkos::parallel_for(Kokkos::TeamVectorRange(member, 0, numMatrices),
-                         [&](const OrdinalType& i) {
-                           alpha(i) =
-                               mask(i) != 0. ? sqr_norm_j(i) / tmp(i) : 0.;
-                         });
+    Kokkos::parallel_for(
+        Kokkos::TeamVectorRange(member, 0, n_active),
+        [&](const OrdinalType& i) {
+          alpha_a(i) = mask_a(i) != 0. ? sqr_norm_j_a(i) / tmp_a(i) : 0.;
+        });
     member.team_barrier();
 
     // x_{j+1} := alpha p_j + x_j
-    TeamVectorAxpy<MemberType>::invoke(member, alpha, P, X);
+    TeamVectorAxpy<MemberType>::invoke(member, alpha_a, P_a, X_a);
     member.team_barrier();
 
     // r_{j+1} := - alpha q + r_j
-    Kokkos::parallel_for(Kokkos::TeamVectorRange(member, 0, numMatrices),
-                         [&](const OrdinalType& i) { alpha(i) = -alpha(i); });
+    Kokkos::parallel_for(
+        Kokkos::TeamVectorRange(member, 0, n_active),
+        [&](const OrdinalType& i) { alpha_a(i) = -alpha_a(i); });
     member.team_barrier();
 
-    TeamVectorAxpy<MemberType>::invoke(member, alpha, Q, R);
+    TeamVectorAxpy<MemberType>::invoke(member, alpha_a, Q_a, R_a);
     member.team_barrier();
 
-    TeamVectorDot<MemberType>::invoke(member, R, R, tmp);
+    TeamVectorDot<MemberType>::invoke(member, R_a, R_a, tmp_a);
     member.team_barrier();
 
-    Kokkos::parallel_for(Kokkos::TeamVectorRange(member, 0, numMatrices),
-                         [&](const OrdinalType& i) {
-                           alpha(i) =
-                               mask(i) != 0. ? tmp(i) / sqr_norm_j(i) : 0.;
-                         });
+    Kokkos::parallel_for(
+        Kokkos::TeamVectorRange(member, 0, n_active),
+        [&](const OrdinalType& i) {
+          alpha_a(i) = mask_a(i) != 0. ? tmp_a(i) / sqr_norm_j_a(i) : 0.;
+        });
 
-    TeamVectorCopy1D::invoke(member, tmp, sqr_norm_j);
+    TeamVectorCopy1D::invoke(member, tmp_a, sqr_norm_j_a);
 
     // Relative convergence check:
     number_not_converged = 0;
     Kokkos::parallel_reduce(
-        Kokkos::TeamVectorRange(member, 0, numMatrices),
+        Kokkos::TeamVectorRange(member, 0, n_active),
         [&](const OrdinalType& i, int& lnumber_not_converged) {
-          if (sqr_norm_j(i) / sqr_norm_0(i) > tolerance * tolerance)
+          if (sqr_norm_j_a(i) / sqr_norm_0_a(i) > tolerance * tolerance)
             ++lnumber_not_converged;
-          else
-            mask(i) = 0.;
+          else if (mask_a(i) != 0.) {
+            mask_a(i) = 0.;
+            handle.set_iteration(member.league_rank(),
+                                 compaction ? perm(i) : i, j + 1);
+          }
         },
         number_not_converged);
 
@@ -158,11 +196,31 @@ KOKKOS_INLINE_FUNCTION int TeamVectorCG<MemberType>::invoke(
     }
 
     // p_{j+1} := alpha p_j + r_{j+1}
-    TeamVectorXpay<MemberType>::invoke(member, alpha, R, P);
+    TeamVectorXpay<MemberType>::invoke(member, alpha_a, R_a, P_a);
     member.team_barrier();
+
+    // Move the converged systems behind the active ones:
+    if constexpr (Impl::is_compactable_operator<OperatorType>::value) {
+      if (compaction && (j + 1) % handle.get_compaction_period() == 0 &&
+          number_not_converged < n_active)
+        n_active = Impl::TeamKrylovCompaction::compact(
+            member, A, n_active, mask, perm, swaps, P, R, X, sqr_norm_0,
+            sqr_norm_j);
+    }
   }
 
-  TeamVectorCopy<MemberType>::invoke(member, X, _X);
+  if (compaction) {
+    Kokkos::parallel_for(
+        Kokkos::TeamVectorRange(member, 0, numMatrices * numRows),
+        [&](const OrdinalType& iTemp) {
+          const OrdinalType k = iTemp / numRows, i = iTemp % numRows;
+          _X(perm(k), i)      = X(k, i);
+        });
+    member.team_barrier();
+    if constexpr (Impl::is_compactable_operator<OperatorType>::value)
+      Impl::TeamKrylovCompaction::restore(member, A, perm);
+  } else
+    TeamVectorCopy<MemberType>::invoke(member, X, _X);
   return status;
 }
 
@@ -173,6 +231,7 @@ KOKKOS_INLINE_FUNCTION int TeamVectorCG<MemberType>::invoke(
     const MemberType& member, const OperatorType& A, const VectorViewType& _B,
     const VectorViewType& _X, const KrylovHandleType& handle) {
   const int strategy = handle.get_memory_strategy();
+  const OperatorType A_op = Impl::krylov_operator(member, A, handle);
   if (strategy == 0) {
     using ScratchPadVectorViewType = Kokkos::View<
         typename VectorViewType::non_const_value_type**,
@@ -194,7 +253,7 @@ KOKKOS_INLINE_FUNCTION int TeamVectorCG<MemberType>::invoke(
         member.team_scratch(handle.get_scratch_pad_level()), numMatrices, 5);
 
     return invoke<OperatorType, VectorViewType, KrylovHandleType>(
-        member, A, _B, _X, handle, _TMPView, _TMPNormView);
+        member, A_op, _B, _X, handle, _TMPView, _TMPNormView);
   }
   if (strategy == 1) {
     const int first_matrix = handle.first_index(member.league_rank());
@@ -215,7 +274,7 @@ KOKKOS_INLINE_FUNCTION int TeamVectorCG<MemberType>::invoke(
         member.team_scratch(handle.get_scratch_pad_level()), numMatrices, 5);
 
     return invoke<OperatorType, VectorViewType, KrylovHandleType>(
-        member, A, _B, _X, handle, _TMPView, _TMPNormView);
+        member, A_op, _B, _X, handle, _TMPView, _TMPNormView);
   }
   return 0;
 }
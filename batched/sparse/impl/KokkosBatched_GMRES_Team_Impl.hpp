@@ -327,6 +327,7 @@ KOKKOS_INLINE_FUNCTION int TeamGMRES<MemberType>::invoke(
     const VectorViewType& _X, const PrecOperatorType& P,
     const KrylovHandleType& handle) {
   const int strategy = handle.get_memory_strategy();
+  const OperatorType A_op = Impl::krylov_operator(member, A, handle);
   if (strategy == 0) {
     const int first_matrix = handle.first_index(member.league_rank());
     const int last_matrix  = handle.last_index(member.league_rank());
@@ -357,8 +358,8 @@ KOKKOS_INLINE_FUNCTION int TeamGMRES<MemberType>::invoke(
         n_G + n_W + n_mask + n_tmp);
 
     return invoke<OperatorType, VectorViewType, PrecOperatorType,
-                  KrylovHandleType>(member, A, _B, _X, P, handle, _ArnoldiView,
-                                    _TMPView);
+                  KrylovHandleType>(member, A_op, _B, _X, P, handle,
+                                    _ArnoldiView, _TMPView);
   }
   if (strategy == 1) {
     const int first_matrix = handle.first_index(member.league_rank());
@@ -373,8 +374,8 @@ KOKKOS_INLINE_FUNCTION int TeamGMRES<MemberType>::invoke(
         Kokkos::ALL);
 
     return invoke<OperatorType, VectorViewType, PrecOperatorType,
-                  KrylovHandleType>(member, A, _B, _X, P, handle, _ArnoldiView,
-                                    _TMPView);
+                  KrylovHandleType>(member, A_op, _B, _X, P, handle,
+                                    _ArnoldiView, _TMPView);
   }
   if (strategy == 2) {
     using ScratchPadArnoldiViewType = Kokkos::View<
@@ -408,8 +409,8 @@ KOKKOS_INLINE_FUNCTION int TeamGMRES<MemberType>::invoke(
         n_G + n_W + n_mask + n_tmp);
 
     return invoke<OperatorType, VectorViewType, PrecOperatorType,
-                  KrylovHandleType>(member, A, _B, _X, P, handle, _ArnoldiView,
-                                    _TMPView);
+                  KrylovHandleType>(member, A_op, _B, _X, P, handle,
+                                    _ArnoldiView, _TMPView);
   }
   return 0;
 }
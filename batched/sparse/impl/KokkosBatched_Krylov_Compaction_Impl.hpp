@@ -0,0 +1,161 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef __KOKKOSBATCHED_KRYLOV_COMPACTION_IMPL_HPP__
+#define __KOKKOSBATCHED_KRYLOV_COMPACTION_IMPL_HPP__
+
+#include <type_traits>
+#include <utility>
+
+#include "KokkosBatched_Util.hpp"
+
+namespace KokkosBatched {
+namespace Impl {
+
+/// \brief True if the operator can be restricted to its first systems and
+/// can swap two of its systems, i.e. if the Krylov solvers can compact it.
+template <typename OperatorType, typename = void>
+struct is_compactable_operator : std::false_type {};
+
+template <typename OperatorType>
+struct is_compactable_operator<
+    OperatorType, std::void_t<decltype(
+                      std::declval<const OperatorType &>().first_systems(0))>>
+    : std::true_type {};
+
+///
+/// Team compaction of the active systems of a batched Krylov solver
+///
+/// The systems of the team are stored in slots; perm(k) is the local index
+/// of the system stored in the slot k. A compaction moves the active
+/// systems (mask != 0) of the slots [0, n_active) in front by disjoint
+/// swaps, applied to the operator and to the given per-system views.
+///
+
+struct TeamKrylovCompaction {
+  template <typename MemberType, typename PermViewType>
+  KOKKOS_INLINE_FUNCTION static void initialize(const MemberType &member,
+                                                const PermViewType &perm) {
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(member, 0, perm.extent(0)),
+                         [&](const int &k) { perm(k) = k; });
+  }
+
+  template <typename MemberType, typename ViewType>
+  KOKKOS_INLINE_FUNCTION static void swap(const MemberType &member,
+                                          const ViewType &V, const int i,
+                                          const int j) {
+    if constexpr (ViewType::rank == 1) {
+      Kokkos::single(Kokkos::PerTeam(member), [&]() {
+        const auto tmp = V(i);
+        V(i)           = V(j);
+        V(j)           = tmp;
+      });
+    } else {
+      Kokkos::parallel_for(
+          Kokkos::TeamVectorRange(member, 0, int(V.extent(1))),
+          [&](const int &k) {
+            const auto tmp = V(i, k);
+            V(i, k)        = V(j, k);
+            V(j, k)        = tmp;
+          });
+    }
+  }
+
+  /// Returns the number of active systems after the compaction.
+  template <typename MemberType, typename OperatorType, typename MaskViewType,
+            typename PermViewType, typename... ViewTypes>
+  KOKKOS_INLINE_FUNCTION static int compact(
+      const MemberType &member, const OperatorType &A, const int n_active,
+      const MaskViewType &mask, const PermViewType &perm,
+      const PermViewType &swaps, const ViewTypes &... views) {
+    int n_swaps = 0, n_active_new = 0;
+    Kokkos::single(
+        Kokkos::PerTeam(member),
+        [&](int &l_n_swaps) {
+          l_n_swaps = 0;
+          int lo = 0, hi = n_active - 1;
+          while (true) {
+            while (lo < hi && mask(lo) != 0) ++lo;
+            while (lo < hi && mask(hi) == 0) --hi;
+            if (lo >= hi) break;
+            swaps(2 * l_n_swaps)     = lo;
+            swaps(2 * l_n_swaps + 1) = hi;
+            ++l_n_swaps;
+            ++lo;
+            --hi;
+          }
+        },
+        n_swaps);
+    Kokkos::parallel_reduce(
+        Kokkos::TeamVectorRange(member, 0, n_active),
+        [&](const int &k, int &l_n_active) {
+          if (mask(k) != 0) ++l_n_active;
+        },
+        n_active_new);
+    member.team_barrier();
+
+    // the swaps are disjoint, they do not need to be ordered
+    for (int s = 0; s < n_swaps; ++s) {
+      const int i = swaps(2 * s), j = swaps(2 * s + 1);
+      A.swap_systems(member, i, j);
+      swap(member, mask, i, j);
+      swap(member, perm, i, j);
+      (swap(member, views, i, j), ...);
+    }
+    member.team_barrier();
+    return n_active_new;
+  }
+
+  /// Undo the permutation of the operator values; perm is reset to the
+  /// identity.
+  template <typename MemberType, typename OperatorType, typename PermViewType>
+  KOKKOS_INLINE_FUNCTION static void restore(const MemberType &member,
+                                             const OperatorType &A,
+                                             const PermViewType &perm) {
+    const int n = perm.extent(0);
+    for (int k = 0; k < n; ++k) {
+      while (true) {
+        const int t = perm(k);
+        if (t == k) break;
+        // move the system stored in the slot k to its slot t
+        A.swap_systems(member, k, t);
+        member.team_barrier();
+        Kokkos::single(Kokkos::PerTeam(member), [&]() {
+          perm(k) = perm(t);
+          perm(t) = t;
+        });
+        member.team_barrier();
+      }
+    }
+  }
+};
+
+template <typename OperatorType>
+KOKKOS_INLINE_FUNCTION auto first_systems(const OperatorType &A, const int n,
+                                          int) -> decltype(A.first_systems(n)) {
+  return A.first_systems(n);
+}
+
+template <typename OperatorType>
+KOKKOS_INLINE_FUNCTION OperatorType first_systems(const OperatorType &A,
+                                                  const int, long) {
+  return A;
+}
+
+}  // namespace Impl
+}  // namespace KokkosBatched
+
+#endif
@@ -0,0 +1,269 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef __KOKKOSBATCHED_BLOCKJACOBIPREC_HPP__
+#define __KOKKOSBATCHED_BLOCKJACOBIPREC_HPP__
+
+#include "KokkosBatched_Util.hpp"
+
+namespace KokkosBatched {
+
+/// \brief Batched Block Jacobi Preconditioner:
+///
+/// The rows of every system are split into consecutive blocks of block_size
+/// rows (the last one can be smaller). blocks(l, i, c) stores the entry
+/// (i, b * block_size + c) of the diagonal block b = i / block_size of the
+/// system l; the blocks are inverted in place by a Gauss-Jordan elimination
+/// without pivoting and apply multiplies by these small dense inverses.
+///
+/// \tparam ValuesViewType: Input type for the values of the diagonal blocks,
+/// needs to be a 3D view of extents N x n_rows x block_size with block_size
+/// not larger than max_block_size
+
+template <class ValuesViewType>
+class BlockJacobiPrec {
+ public:
+  using ScalarType    = typename ValuesViewType::non_const_value_type;
+  using MagnitudeType = typename Kokkos::ArithTraits<ScalarType>::mag_type;
+
+  static constexpr int max_block_size = 16;
+
+ private:
+  ValuesViewType blocks;
+  int n_operators;
+  int n_rows;
+  int n_colums;
+  int block_size;
+  int n_blocks;
+  mutable bool computed_inverse = false;
+
+ public:
+  KOKKOS_INLINE_FUNCTION
+  BlockJacobiPrec(const ValuesViewType &_blocks) : blocks(_blocks) {
+    n_operators = _blocks.extent(0);
+    n_rows      = _blocks.extent(1);
+    n_colums    = n_rows;
+    block_size  = _blocks.extent(2);
+    n_blocks    = (n_rows + block_size - 1) / block_size;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  ~BlockJacobiPrec() {}
+
+  /// \brief computeDiagonalBlocks
+  ///   Copy the diagonal blocks of a batched crs matrix into _blocks on the
+  ///   host; the entries of the blocks that are not in the graph are zero.
+  ///
+  /// \param _values [in]: values of the batched crs matrix
+  /// \param _row_ptr [in]: row offsets of the shared graph
+  /// \param _colIndices [in]: column indices of the shared graph
+  /// \param _blocks [out]: N x n_rows x block_size view
+
+  template <typename CrsValuesViewType, typename IntViewType>
+  static void computeDiagonalBlocks(const CrsValuesViewType &_values,
+                                    const IntViewType &_row_ptr,
+                                    const IntViewType &_colIndices,
+                                    const ValuesViewType &_blocks) {
+    auto values_host     = Kokkos::create_mirror_view(_values);
+    auto row_ptr_host    = Kokkos::create_mirror_view(_row_ptr);
+    auto colIndices_host = Kokkos::create_mirror_view(_colIndices);
+    auto blocks_host     = Kokkos::create_mirror_view(_blocks);
+    Kokkos::deep_copy(values_host, _values);
+    Kokkos::deep_copy(row_ptr_host, _row_ptr);
+    Kokkos::deep_copy(colIndices_host, _colIndices);
+    Kokkos::deep_copy(blocks_host, Kokkos::ArithTraits<ScalarType>::zero());
+
+    const int numMatrices = _blocks.extent(0);
+    const int numRows     = _blocks.extent(1);
+    const int bs          = _blocks.extent(2);
+    for (int i = 0; i < numRows; ++i) {
+      const int first_col = (i / bs) * bs;
+      for (int p = row_ptr_host(i); p < row_ptr_host(i + 1); ++p) {
+        const int c = colIndices_host(p) - first_col;
+        if (c < 0 || c >= bs) continue;
+        for (int l = 0; l < numMatrices; ++l)
+          blocks_host(l, i, c) = values_host(l, p);
+      }
+    }
+    Kokkos::deep_copy(_blocks, blocks_host);
+  }
+
+  KOKKOS_INLINE_FUNCTION void setComputedInverse() { computed_inverse = true; }
+
+ private:
+  KOKKOS_INLINE_FUNCTION int blockRows(const int b) const {
+    return (b + 1) * block_size <= n_rows ? block_size
+                                          : n_rows - b * block_size;
+  }
+
+  /// Invert the block b of the system l in place; returns the number of
+  /// pivots with a too small magnitude, which are replaced by one.
+  KOKKOS_INLINE_FUNCTION int invert(const int l, const int b) const {
+    const auto one     = Kokkos::ArithTraits<ScalarType>::one();
+    const auto zero    = Kokkos::ArithTraits<ScalarType>::zero();
+    const auto epsilon = Kokkos::ArithTraits<MagnitudeType>::epsilon();
+    const int i0       = b * block_size;
+    const int nb       = blockRows(b);
+    int tooSmall       = 0;
+    for (int k = 0; k < nb; ++k) {
+      ScalarType pivot = blocks(l, i0 + k, k);
+      if (Kokkos::ArithTraits<ScalarType>::abs(pivot) <= epsilon) {
+        ++tooSmall;
+        pivot = one;
+      }
+      blocks(l, i0 + k, k) = one;
+      for (int j = 0; j < nb; ++j) blocks(l, i0 + k, j) /= pivot;
+      for (int i = 0; i < nb; ++i) {
+        if (i == k) continue;
+        const ScalarType f   = blocks(l, i0 + i, k);
+        blocks(l, i0 + i, k) = zero;
+        for (int j = 0; j < nb; ++j)
+          blocks(l, i0 + i, j) -= f * blocks(l, i0 + k, j);
+      }
+    }
+    return tooSmall;
+  }
+
+  /// Y_l <- inv(D_b) X_l on the rows of the block b; X and Y may alias.
+  template <typename XViewType, typename YViewType>
+  KOKKOS_INLINE_FUNCTION void multiply(const int l, const int b,
+                                       const XViewType &X,
+                                       const YViewType &Y) const {
+    const int i0 = b * block_size;
+    const int nb = blockRows(b);
+    ScalarType x[max_block_size];
+    for (int c = 0; c < nb; ++c) x[c] = X(l, i0 + c);
+    for (int i = 0; i < nb; ++i) {
+      ScalarType y = Kokkos::ArithTraits<ScalarType>::zero();
+      for (int c = 0; c < nb; ++c) y += blocks(l, i0 + i, c) * x[c];
+      Y(l, i0 + i) = y;
+    }
+  }
+
+ public:
+  template <typename MemberType, typename ArgMode>
+  KOKKOS_INLINE_FUNCTION void computeInverse(const MemberType &member) const {
+    int tooSmall = 0;
+    if (std::is_same<ArgMode, Mode::Serial>::value) {
+      for (int l = 0; l < n_operators; ++l)
+        for (int b = 0; b < n_blocks; ++b) tooSmall += invert(l, b);
+    } else if (std::is_same<ArgMode, Mode::Team>::value) {
+      Kokkos::parallel_reduce(
+          Kokkos::TeamThreadRange(member, 0, n_operators * n_blocks),
+          [&](const int &iTemp, int &ltooSmall) {
+            int b, l;
+            getIndices<int, typename ValuesViewType::array_layout>(
+                iTemp, n_blocks, n_operators, b, l);
+            ltooSmall += invert(l, b);
+          },
+          tooSmall);
+    } else if (std::is_same<ArgMode, Mode::TeamVector>::value) {
+      Kokkos::parallel_reduce(
+          Kokkos::TeamVectorRange(member, 0, n_operators * n_blocks),
+          [&](const int &iTemp, int &ltooSmall) {
+            int b, l;
+            getIndices<int, typename ValuesViewType::array_layout>(
+                iTemp, n_blocks, n_operators, b, l);
+            ltooSmall += invert(l, b);
+          },
+          tooSmall);
+    }
+
+    if (tooSmall > 0)
+#if KOKKOS_VERSION < 40199
+      KOKKOS_IMPL_DO_NOT_USE_PRINTF(
+          "KokkosBatched::BlockJacobiPrec: %d pivot(s) has/have a too small "
+          "magnitude and have been replaced by one, \n",
+          (int)tooSmall);
+#else
+      Kokkos::printf(
+          "KokkosBatched::BlockJacobiPrec: %d pivot(s) has/have a too small "
+          "magnitude and have been replaced by one, \n",
+          (int)tooSmall);
+#endif
+    computed_inverse = true;
+  }
+
+  KOKKOS_INLINE_FUNCTION void computeInverse() const {
+    int tooSmall = 0;
+    for (int l = 0; l < n_operators; ++l)
+      for (int b = 0; b < n_blocks; ++b) tooSmall += invert(l, b);
+
+    if (tooSmall > 0)
+#if KOKKOS_VERSION < 40199
+      KOKKOS_IMPL_DO_NOT_USE_PRINTF(
+          "KokkosBatched::BlockJacobiPrec: %d pivot(s) has/have a too small "
+          "magnitude and have been replaced by one, \n",
+          (int)tooSmall);
+#else
+      Kokkos::printf(
+          "KokkosBatched::BlockJacobiPrec: %d pivot(s) has/have a too small "
+          "magnitude and have been replaced by one, \n",
+          (int)tooSmall);
+#endif
+    computed_inverse = true;
+  }
+
+  template <typename ArgTrans, typename ArgMode, int sameXY,
+            typename MemberType, typename XViewType, typename YViewType>
+  KOKKOS_INLINE_FUNCTION void apply(const MemberType &member,
+                                    const XViewType &X,
+                                    const YViewType &Y) const {
+    if (!computed_inverse) {
+      this->computeInverse<MemberType, ArgMode>(member);
+      member.team_barrier();  // Finish writing to this->blocks
+    }
+
+    if (std::is_same<ArgMode, Mode::Serial>::value) {
+      for (int l = 0; l < n_operators; ++l)
+        for (int b = 0; b < n_blocks; ++b) multiply(l, b, X, Y);
+    } else if (std::is_same<ArgMode, Mode::Team>::value) {
+      Kokkos::parallel_for(
+          Kokkos::TeamThreadRange(member, 0, n_operators * n_blocks),
+          [&](const int &iTemp) {
+            int b, l;
+            getIndices<int, typename ValuesViewType::array_layout>(
+                iTemp, n_blocks, n_operators, b, l);
+            multiply(l, b, X, Y);
+          });
+    } else if (std::is_same<ArgMode, Mode::TeamVector>::value) {
+      Kokkos::parallel_for(
+          Kokkos::TeamVectorRange(member, 0, n_operators * n_blocks),
+          [&](const int &iTemp) {
+            int b, l;
+            getIndices<int, typename ValuesViewType::array_layout>(
+                iTemp, n_blocks, n_operators, b, l);
+            multiply(l, b, X, Y);
+          });
+    }
+  }
+
+  template <typename ArgTrans, int sameXY, typename XViewType,
+            typename YViewType>
+  KOKKOS_INLINE_FUNCTION void apply(const XViewType &X,
+                                    const YViewType &Y) const {
+    if (!computed_inverse) {
+      this->computeInverse();
+    }
+
+    for (int l = 0; l < n_operators; ++l)
+      for (int b = 0; b < n_blocks; ++b) multiply(l, b, X, Y);
+  }
+};
+
+}  // namespace KokkosBatched
+
+#endif
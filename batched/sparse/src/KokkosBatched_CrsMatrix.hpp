@@ -33,6 +33,11 @@ class CrsMatrix {
   using MagnitudeType = typename Kokkos::ArithTraits<ScalarType>::mag_type;
 
  private:
+  using ScratchIntViewType =
+      Kokkos::View<typename IntViewType::non_const_value_type *,
+                   typename IntViewType::execution_space::scratch_memory_space,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
   ValuesViewType values;
   IntViewType row_ptr;
   IntViewType colIndices;
@@ -53,6 +58,79 @@ class CrsMatrix {
   KOKKOS_INLINE_FUNCTION
   ~CrsMatrix() {}
 
+  /// \brief get_graph_scratch_size
+  ///   Number of bytes of team scratch required by stage_graph_in_scratch.
+
+  KOKKOS_INLINE_FUNCTION
+  size_t get_graph_scratch_size() const {
+    return ScratchIntViewType::shmem_size(row_ptr.extent(0)) +
+           ScratchIntViewType::shmem_size(colIndices.extent(0));
+  }
+
+  /// \brief stage_graph_in_scratch
+  ///
+  /// Returns a copy of this matrix whose row offsets and column indices have
+  /// been copied by the team into the team scratch pad of the given level.
+  /// The sparsity graph is shared by the N matrices, so staging it once per
+  /// team lets every subsequent apply read it from scratch instead of from
+  /// global memory. The values are not copied. All the threads of the team
+  /// have to call this function and the scratch size of the team policy has
+  /// to include get_graph_scratch_size() bytes.
+  ///
+  /// \tparam MemberType: Input type for the TeamPolicy member
+  ///
+  /// \param member [in]: TeamPolicy member
+  /// \param level [in]: level of the team scratch pad
+
+  template <typename MemberType>
+  KOKKOS_INLINE_FUNCTION CrsMatrix
+  stage_graph_in_scratch(const MemberType &member, const int level) const {
+    const int n_row_ptr = row_ptr.extent(0);
+    const int nnz       = colIndices.extent(0);
+
+    ScratchIntViewType row_ptr_scratch(member.team_scratch(level), n_row_ptr);
+    ScratchIntViewType colIndices_scratch(member.team_scratch(level), nnz);
+
+    Kokkos::parallel_for(
+        Kokkos::TeamVectorRange(member, 0, n_row_ptr),
+        [&](const int &i) { row_ptr_scratch(i) = row_ptr(i); });
+    Kokkos::parallel_for(
+        Kokkos::TeamVectorRange(member, 0, nnz),
+        [&](const int &i) { colIndices_scratch(i) = colIndices(i); });
+    member.team_barrier();
+
+    return CrsMatrix(values, IntViewType(row_ptr_scratch.data(), n_row_ptr),
+                     IntViewType(colIndices_scratch.data(), nnz));
+  }
+
+  /// \brief first_systems
+  ///   Returns the matrix restricted to its first n matrices; used by the
+  ///   Krylov solvers to apply the operator to the active systems only.
+
+  KOKKOS_INLINE_FUNCTION
+  CrsMatrix first_systems(const int n) const {
+    return CrsMatrix(
+        Kokkos::subview(values, Kokkos::make_pair(0, n), Kokkos::ALL), row_ptr,
+        colIndices);
+  }
+
+  /// \brief swap_systems
+  ///   Exchange the values of the matrices i and j; used by the Krylov
+  ///   solvers to compact the active systems. All the threads of the team
+  ///   have to call this function.
+
+  template <typename MemberType>
+  KOKKOS_INLINE_FUNCTION void swap_systems(const MemberType &member,
+                                           const int i, const int j) const {
+    Kokkos::parallel_for(
+        Kokkos::TeamVectorRange(member, 0, int(values.extent(1))),
+        [&](const int &p) {
+          const ScalarType tmp = values(i, p);
+          values(i, p)         = values(j, p);
+          values(j, p)         = tmp;
+        });
+  }
+
   /// \brief apply version that uses constant coefficients alpha and beta
   ///
   ///   y_l <- alpha * A_l * x_l + beta * y_l for all l = 1, ..., N
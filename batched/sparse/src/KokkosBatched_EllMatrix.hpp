@@ -0,0 +1,296 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef __KOKKOSBATCHED_ELLMATRIX_HPP__
+#define __KOKKOSBATCHED_ELLMATRIX_HPP__
+
+#include "KokkosBatched_Util.hpp"
+
+namespace KokkosBatched {
+
+/// \brief Batched EllMatrix:
+///
+/// ELLPACK storage of N sparse matrices which share the same sparsity
+/// pattern. Every row stores exactly row_length entries; the entry k of the
+/// row i is at the position e = k * n_rows + i of colIndices (shared by the
+/// batch) and of values(l, e) for the matrix l. Rows with fewer entries are
+/// padded with a zero value and a valid column index (e.g. the row itself),
+/// so the kernels have no data-dependent trip count and no row offsets to
+/// read.
+///
+/// The team kernels map consecutive threads to consecutive matrices of the
+/// same row for LayoutLeft values, so a LayoutLeft ValuesViewType interleaves
+/// the values of the batch and the threads load the same entry of different
+/// matrices with unit stride.
+///
+/// \tparam ValuesViewType: Input type for the values of the batched ell
+/// matrix, needs to be a 2D view
+/// \tparam IntViewType: Input type for the column-index array, needs to be a
+/// 1D view
+
+template <class ValuesViewType, class IntViewType>
+class EllMatrix {
+ public:
+  using ScalarType    = typename ValuesViewType::non_const_value_type;
+  using MagnitudeType = typename Kokkos::ArithTraits<ScalarType>::mag_type;
+
+ private:
+  using ScratchIntViewType =
+      Kokkos::View<typename IntViewType::non_const_value_type *,
+                   typename IntViewType::execution_space::scratch_memory_space,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+  ValuesViewType values;
+  IntViewType colIndices;
+  int n_operators;
+  int n_rows;
+  int n_colums;
+  int row_length;
+
+ public:
+  KOKKOS_INLINE_FUNCTION
+  EllMatrix(const ValuesViewType &_values, const IntViewType &_colIndices,
+            const int _row_length)
+      : values(_values), colIndices(_colIndices), row_length(_row_length) {
+    n_operators = _values.extent(0);
+    n_rows      = _row_length > 0 ? _colIndices.extent(0) / _row_length : 0;
+    n_colums    = n_rows;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  ~EllMatrix() {}
+
+  /// \brief getMaxRowLength
+  ///   Host function returning the row length required to store a batched
+  ///   crs graph in ELLPACK format.
+
+  template <typename CrsIntViewType>
+  static int getMaxRowLength(const CrsIntViewType &_row_ptr) {
+    auto row_ptr_host = Kokkos::create_mirror_view(_row_ptr);
+    Kokkos::deep_copy(row_ptr_host, _row_ptr);
+    int max_row_length = 0;
+    for (int i = 0; i + 1 < int(_row_ptr.extent(0)); ++i)
+      if (row_ptr_host(i + 1) - row_ptr_host(i) > max_row_length)
+        max_row_length = row_ptr_host(i + 1) - row_ptr_host(i);
+    return max_row_length;
+  }
+
+  /// \brief convertFromCrs
+  ///   Host function converting a batched crs matrix to the ELLPACK format;
+  ///   _colIndices has to be of length n_rows * row_length and _values of
+  ///   extents N x (n_rows * row_length), with row_length not smaller than
+  ///   getMaxRowLength(_crs_row_ptr).
+
+  template <typename CrsValuesViewType, typename CrsIntViewType>
+  static void convertFromCrs(const CrsValuesViewType &_crs_values,
+                             const CrsIntViewType &_crs_row_ptr,
+                             const CrsIntViewType &_crs_colIndices,
+                             const ValuesViewType &_values,
+                             const IntViewType &_colIndices) {
+    auto crs_values_host     = Kokkos::create_mirror_view(_crs_values);
+    auto crs_row_ptr_host    = Kokkos::create_mirror_view(_crs_row_ptr);
+    auto crs_colIndices_host = Kokkos::create_mirror_view(_crs_colIndices);
+    auto values_host         = Kokkos::create_mirror_view(_values);
+    auto colIndices_host     = Kokkos::create_mirror_view(_colIndices);
+    Kokkos::deep_copy(crs_values_host, _crs_values);
+    Kokkos::deep_copy(crs_row_ptr_host, _crs_row_ptr);
+    Kokkos::deep_copy(crs_colIndices_host, _crs_colIndices);
+
+    const int numMatrices = _values.extent(0);
+    const int numRows     = _crs_row_ptr.extent(0) - 1;
+    const int rowLength   = numRows > 0 ? _colIndices.extent(0) / numRows : 0;
+    for (int i = 0; i < numRows; ++i) {
+      const int crs_row_length = crs_row_ptr_host(i + 1) - crs_row_ptr_host(i);
+      for (int k = 0; k < rowLength; ++k) {
+        const int e = k * numRows + i;
+        if (k < crs_row_length) {
+          const int p        = crs_row_ptr_host(i) + k;
+          colIndices_host(e) = crs_colIndices_host(p);
+          for (int l = 0; l < numMatrices; ++l)
+            values_host(l, e) = crs_values_host(l, p);
+        } else {
+          colIndices_host(e) = i;
+          for (int l = 0; l < numMatrices; ++l)
+            values_host(l, e) = Kokkos::ArithTraits<ScalarType>::zero();
+        }
+      }
+    }
+    Kokkos::deep_copy(_values, values_host);
+    Kokkos::deep_copy(_colIndices, colIndices_host);
+  }
+
+  /// \brief get_graph_scratch_size
+  ///   Number of bytes of team scratch required by stage_graph_in_scratch.
+
+  KOKKOS_INLINE_FUNCTION
+  size_t get_graph_scratch_size() const {
+    return ScratchIntViewType::shmem_size(colIndices.extent(0));
+  }
+
+  /// \brief stage_graph_in_scratch
+  ///   Returns a copy of this matrix whose column indices have been copied
+  ///   by the team into the team scratch pad of the given level (see
+  ///   CrsMatrix::stage_graph_in_scratch).
+
+  template <typename MemberType>
+  KOKKOS_INLINE_FUNCTION EllMatrix
+  stage_graph_in_scratch(const MemberType &member, const int level) const {
+    const int n_entries = colIndices.extent(0);
+
+    ScratchIntViewType colIndices_scratch(member.team_scratch(level),
+                                          n_entries);
+
+    Kokkos::parallel_for(
+        Kokkos::TeamVectorRange(member, 0, n_entries),
+        [&](const int &e) { colIndices_scratch(e) = colIndices(e); });
+    member.team_barrier();
+
+    return EllMatrix(values, IntViewType(colIndices_scratch.data(), n_entries),
+                     row_length);
+  }
+
+  /// \brief first_systems
+  ///   Returns the matrix restricted to its first n matrices (see
+  ///   CrsMatrix::first_systems).
+
+  KOKKOS_INLINE_FUNCTION
+  EllMatrix first_systems(const int n) const {
+    return EllMatrix(
+        Kokkos::subview(values, Kokkos::make_pair(0, n), Kokkos::ALL),
+        colIndices, row_length);
+  }
+
+  /// \brief swap_systems
+  ///   Exchange the values of the matrices i and j (see
+  ///   CrsMatrix::swap_systems).
+
+  template <typename MemberType>
+  KOKKOS_INLINE_FUNCTION void swap_systems(const MemberType &member,
+                                           const int i, const int j) const {
+    Kokkos::parallel_for(
+        Kokkos::TeamVectorRange(member, 0, int(values.extent(1))),
+        [&](const int &e) {
+          const ScalarType tmp = values(i, e);
+          values(i, e)         = values(j, e);
+          values(j, e)         = tmp;
+        });
+  }
+
+ private:
+  template <int dobeta, typename XViewType, typename YViewType>
+  KOKKOS_INLINE_FUNCTION void apply_row(const int l, const int i,
+                                        const XViewType &X, const YViewType &Y,
+                                        const MagnitudeType alpha,
+                                        const MagnitudeType beta) const {
+    ScalarType sum = Kokkos::ArithTraits<ScalarType>::zero();
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+    for (int k = 0; k < row_length; ++k) {
+      const int e = k * n_rows + i;
+      sum += values(l, e) * X(l, colIndices(e));
+    }
+    if (dobeta == 0)
+      Y(l, i) = alpha * sum;
+    else
+      Y(l, i) = beta * Y(l, i) + alpha * sum;
+  }
+
+  template <typename ArgMode, int dobeta, typename MemberType,
+            typename XViewType, typename YViewType>
+  KOKKOS_INLINE_FUNCTION void apply_internal(const MemberType &member,
+                                             const XViewType &X,
+                                             const YViewType &Y,
+                                             const MagnitudeType alpha,
+                                             const MagnitudeType beta) const {
+    if (std::is_same<ArgMode, Mode::Serial>::value) {
+      for (int l = 0; l < n_operators; ++l)
+        for (int i = 0; i < n_rows; ++i)
+          apply_row<dobeta>(l, i, X, Y, alpha, beta);
+    } else if (std::is_same<ArgMode, Mode::Team>::value) {
+      Kokkos::parallel_for(
+          Kokkos::TeamThreadRange(member, 0, n_operators * n_rows),
+          [&](const int &iTemp) {
+            int iRow, iMatrix;
+            getIndices<int, typename ValuesViewType::array_layout>(
+                iTemp, n_rows, n_operators, iRow, iMatrix);
+            apply_row<dobeta>(iMatrix, iRow, X, Y, alpha, beta);
+          });
+    } else if (std::is_same<ArgMode, Mode::TeamVector>::value) {
+      Kokkos::parallel_for(
+          Kokkos::TeamVectorRange(member, 0, n_operators * n_rows),
+          [&](const int &iTemp) {
+            int iRow, iMatrix;
+            getIndices<int, typename ValuesViewType::array_layout>(
+                iTemp, n_rows, n_operators, iRow, iMatrix);
+            apply_row<dobeta>(iMatrix, iRow, X, Y, alpha, beta);
+          });
+    }
+  }
+
+ public:
+  /// \brief apply version that uses constant coefficients alpha and beta
+  ///
+  ///   y_l <- alpha * A_l * x_l + beta * y_l for all l = 1, ..., N
+  ///
+  /// See CrsMatrix::apply; only Trans::NoTranspose is supported.
+  ///
+  /// \tparam MemberType: Input type for the TeamPolicy member
+  /// \tparam XViewType: Input type for X, needs to be a 2D view
+  /// \tparam YViewType: Input type for Y, needs to be a 2D view
+  /// \tparam ArgTrans: Argument for transpose or notranspose
+  /// \tparam ArgMode: Argument for the parallelism used in the apply
+  ///
+  /// \param member [in]: TeamPolicy member
+  /// \param alpha [in]: input coefficient for X (default value 1.)
+  /// \param X [in]: Input vector X, a rank 2 view
+  /// \param beta [in]: input coefficient for Y (default value 0.)
+  /// \param Y [in/out]: Output vector Y, a rank 2 view
+
+  template <typename ArgTrans, typename ArgMode, typename MemberType,
+            typename XViewType, typename YViewType>
+  KOKKOS_INLINE_FUNCTION void apply(
+      const MemberType &member, const XViewType &X, const YViewType &Y,
+      MagnitudeType alpha = Kokkos::ArithTraits<MagnitudeType>::one(),
+      MagnitudeType beta  = Kokkos::ArithTraits<MagnitudeType>::zero()) const {
+    static_assert(std::is_same<ArgTrans, Trans::NoTranspose>::value,
+                  "KokkosBatched::EllMatrix: only NoTranspose is supported");
+    if (beta == Kokkos::ArithTraits<MagnitudeType>::zero())
+      apply_internal<ArgMode, 0>(member, X, Y, alpha, beta);
+    else
+      apply_internal<ArgMode, 1>(member, X, Y, alpha, beta);
+  }
+
+  template <typename ArgTrans, typename XViewType, typename YViewType>
+  KOKKOS_INLINE_FUNCTION void apply(
+      const XViewType &X, const YViewType &Y,
+      MagnitudeType alpha = Kokkos::ArithTraits<MagnitudeType>::one(),
+      MagnitudeType beta  = Kokkos::ArithTraits<MagnitudeType>::zero()) const {
+    static_assert(std::is_same<ArgTrans, Trans::NoTranspose>::value,
+                  "KokkosBatched::EllMatrix: only NoTranspose is supported");
+    if (beta == Kokkos::ArithTraits<MagnitudeType>::zero()) {
+      for (int l = 0; l < n_operators; ++l)
+        for (int i = 0; i < n_rows; ++i) apply_row<0>(l, i, X, Y, alpha, beta);
+    } else {
+      for (int l = 0; l < n_operators; ++l)
+        for (int i = 0; i < n_rows; ++i) apply_row<1>(l, i, X, Y, alpha, beta);
+    }
+  }
+};
+
+}  // namespace KokkosBatched
+
+#endif
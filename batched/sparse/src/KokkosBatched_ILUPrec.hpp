@@ -0,0 +1,249 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef __KOKKOSBATCHED_ILUPREC_HPP__
+#define __KOKKOSBATCHED_ILUPREC_HPP__
+
+#include "KokkosBatched_Util.hpp"
+
+namespace KokkosBatched {
+
+/// \brief Batched ILU(0) Preconditioner:
+///
+/// All the N matrices share the same sparsity graph, so the symbolic part of
+/// the factorization (the position of the diagonal entry of every row) is
+/// computed once by computeDiagonalIndices and shared by the whole batch.
+/// The numeric factorization overwrites the values given to the constructor
+/// with L (unit lower, diagonal omitted) and U; pass a copy of the values of
+/// the operator. The column indices of every row have to be sorted.
+///
+/// The factorization and the triangular solves of apply are sequential
+/// within one system and parallel over the systems handled by the team.
+///
+/// \tparam ValuesViewType: Input type for the values of the batched crs
+/// matrix, needs to be a 2D view
+/// \tparam IntViewType: Input type for row offset array, column-index array
+/// and diagonal-index array, needs to be a 1D view
+
+template <class ValuesViewType, class IntViewType>
+class ILUPrec {
+ public:
+  using ScalarType    = typename ValuesViewType::non_const_value_type;
+  using MagnitudeType = typename Kokkos::ArithTraits<ScalarType>::mag_type;
+
+ private:
+  ValuesViewType values;
+  IntViewType row_ptr;
+  IntViewType colIndices;
+  IntViewType diagIndices;
+  int n_operators;
+  int n_rows;
+  int n_colums;
+  mutable bool computed_factorization = false;
+
+ public:
+  KOKKOS_INLINE_FUNCTION
+  ILUPrec(const ValuesViewType &_values, const IntViewType &_row_ptr,
+          const IntViewType &_colIndices, const IntViewType &_diagIndices)
+      : values(_values),
+        row_ptr(_row_ptr),
+        colIndices(_colIndices),
+        diagIndices(_diagIndices) {
+    n_operators = _values.extent(0);
+    n_rows      = _row_ptr.extent(0) - 1;
+    n_colums    = n_rows;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  ~ILUPrec() {}
+
+  /// \brief computeDiagonalIndices
+  ///   Symbolic factorization: store in diagIndices(i) the position of the
+  ///   entry (i, i) in colIndices. Called once on the host for the batch.
+  ///
+  /// \param _row_ptr [in]: row offsets of the shared graph
+  /// \param _colIndices [in]: column indices of the shared graph
+  /// \param _diagIndices [out]: 1D view of length n_rows
+  ///
+  /// \return the number of rows without a diagonal entry (0 on success)
+
+  template <typename DiagViewType>
+  static int computeDiagonalIndices(const IntViewType &_row_ptr,
+                                    const IntViewType &_colIndices,
+                                    const DiagViewType &_diagIndices) {
+    auto row_ptr_host    = Kokkos::create_mirror_view(_row_ptr);
+    auto colIndices_host = Kokkos::create_mirror_view(_colIndices);
+    auto diag_host       = Kokkos::create_mirror_view(_diagIndices);
+    Kokkos::deep_copy(row_ptr_host, _row_ptr);
+    Kokkos::deep_copy(colIndices_host, _colIndices);
+
+    const int numRows = _row_ptr.extent(0) - 1;
+    int missing       = 0;
+    for (int i = 0; i < numRows; ++i) {
+      diag_host(i) = -1;
+      for (int p = row_ptr_host(i); p < row_ptr_host(i + 1); ++p)
+        if (colIndices_host(p) == i) {
+          diag_host(i) = p;
+          break;
+        }
+      if (diag_host(i) < 0) ++missing;
+    }
+    Kokkos::deep_copy(_diagIndices, diag_host);
+    return missing;
+  }
+
+  KOKKOS_INLINE_FUNCTION void setComputedFactorization() {
+    computed_factorization = true;
+  }
+
+ private:
+  /// Numeric ILU(0) of the system l (IKJ variant); returns the number of
+  /// pivots with a too small magnitude, which are replaced by one.
+  KOKKOS_INLINE_FUNCTION int factorize(const int l) const {
+    const auto one     = Kokkos::ArithTraits<ScalarType>::one();
+    const auto epsilon = Kokkos::ArithTraits<MagnitudeType>::epsilon();
+    int tooSmall       = 0;
+    for (int i = 0; i < n_rows; ++i) {
+      const int row_end = row_ptr(i + 1);
+      for (int p = row_ptr(i); p < diagIndices(i); ++p) {
+        const int k          = colIndices(p);
+        const ScalarType lik = values(l, p) / values(l, diagIndices(k));
+        values(l, p)         = lik;
+        // update the entries (i, j), j > k, that are in the pattern of row i
+        int q = p + 1;
+        for (int s = diagIndices(k) + 1; s < row_ptr(k + 1); ++s) {
+          const int j = colIndices(s);
+          while (q < row_end && colIndices(q) < j) ++q;
+          if (q == row_end) break;
+          if (colIndices(q) == j) values(l, q) -= lik * values(l, s);
+        }
+      }
+      if (Kokkos::ArithTraits<ScalarType>::abs(values(l, diagIndices(i))) <=
+          epsilon) {
+        ++tooSmall;
+        values(l, diagIndices(i)) = one;
+      }
+    }
+    return tooSmall;
+  }
+
+  /// Y_l <- U_l^{-1} L_l^{-1} X_l; X and Y may alias.
+  template <typename XViewType, typename YViewType>
+  KOKKOS_INLINE_FUNCTION void solve(const int l, const XViewType &X,
+                                    const YViewType &Y) const {
+    for (int i = 0; i < n_rows; ++i) {
+      ScalarType y = X(l, i);
+      for (int p = row_ptr(i); p < diagIndices(i); ++p)
+        y -= values(l, p) * Y(l, colIndices(p));
+      Y(l, i) = y;
+    }
+    for (int i = n_rows - 1; i >= 0; --i) {
+      ScalarType y = Y(l, i);
+      for (int p = diagIndices(i) + 1; p < row_ptr(i + 1); ++p)
+        y -= values(l, p) * Y(l, colIndices(p));
+      Y(l, i) = y / values(l, diagIndices(i));
+    }
+  }
+
+ public:
+  template <typename MemberType, typename ArgMode>
+  KOKKOS_INLINE_FUNCTION void computeFactorization(
+      const MemberType &member) const {
+    int tooSmall = 0;
+    if (std::is_same<ArgMode, Mode::Serial>::value) {
+      for (int l = 0; l < n_operators; ++l) tooSmall += factorize(l);
+    } else if (std::is_same<ArgMode, Mode::Team>::value) {
+      Kokkos::parallel_reduce(
+          Kokkos::TeamThreadRange(member, 0, n_operators),
+          [&](const int &l, int &ltooSmall) { ltooSmall += factorize(l); },
+          tooSmall);
+    } else if (std::is_same<ArgMode, Mode::TeamVector>::value) {
+      Kokkos::parallel_reduce(
+          Kokkos::TeamVectorRange(member, 0, n_operators),
+          [&](const int &l, int &ltooSmall) { ltooSmall += factorize(l); },
+          tooSmall);
+    }
+
+    if (tooSmall > 0)
+#if KOKKOS_VERSION < 40199
+      KOKKOS_IMPL_DO_NOT_USE_PRINTF(
+          "KokkosBatched::ILUPrec: %d pivot(s) has/have a too small "
+          "magnitude and have been replaced by one, \n",
+          (int)tooSmall);
+#else
+      Kokkos::printf(
+          "KokkosBatched::ILUPrec: %d pivot(s) has/have a too small "
+          "magnitude and have been replaced by one, \n",
+          (int)tooSmall);
+#endif
+    computed_factorization = true;
+  }
+
+  KOKKOS_INLINE_FUNCTION void computeFactorization() const {
+    int tooSmall = 0;
+    for (int l = 0; l < n_operators; ++l) tooSmall += factorize(l);
+
+    if (tooSmall > 0)
+#if KOKKOS_VERSION < 40199
+      KOKKOS_IMPL_DO_NOT_USE_PRINTF(
+          "KokkosBatched::ILUPrec: %d pivot(s) has/have a too small "
+          "magnitude and have been replaced by one, \n",
+          (int)tooSmall);
+#else
+      Kokkos::printf(
+          "KokkosBatched::ILUPrec: %d pivot(s) has/have a too small "
+          "magnitude and have been replaced by one, \n",
+          (int)tooSmall);
+#endif
+    computed_factorization = true;
+  }
+
+  template <typename ArgTrans, typename ArgMode, int sameXY,
+            typename MemberType, typename XViewType, typename YViewType>
+  KOKKOS_INLINE_FUNCTION void apply(const MemberType &member,
+                                    const XViewType &X,
+                                    const YViewType &Y) const {
+    if (!computed_factorization) {
+      this->computeFactorization<MemberType, ArgMode>(member);
+      member.team_barrier();  // Finish writing to this->values
+    }
+
+    if (std::is_same<ArgMode, Mode::Serial>::value) {
+      for (int l = 0; l < n_operators; ++l) solve(l, X, Y);
+    } else if (std::is_same<ArgMode, Mode::Team>::value) {
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(member, 0, n_operators),
+                           [&](const int &l) { solve(l, X, Y); });
+    } else if (std::is_same<ArgMode, Mode::TeamVector>::value) {
+      Kokkos::parallel_for(Kokkos::TeamVectorRange(member, 0, n_operators),
+                           [&](const int &l) { solve(l, X, Y); });
+    }
+  }
+
+  template <typename ArgTrans, int sameXY, typename XViewType,
+            typename YViewType>
+  KOKKOS_INLINE_FUNCTION void apply(const XViewType &X,
+                                    const YViewType &Y) const {
+    if (!computed_factorization) {
+      this->computeFactorization();
+    }
+
+    for (int l = 0; l < n_operators; ++l) solve(l, X, Y);
+  }
+};
+
+}  // namespace KokkosBatched
+
+#endif
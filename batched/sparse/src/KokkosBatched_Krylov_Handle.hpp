@@ -41,6 +41,14 @@ namespace KokkosBatched {
 ///  - iteration_numbers is a 1D view of length batched_size;
 ///  - first_index and last_index are 1D of length n_teams.
 ///
+/// In the case of the Batched BiCGStab, Arnoldi_view is not used and tmp_view
+/// is only used with memory strategy 1; its size should be batched_size x
+/// (6 * n_rows).
+///
+/// When set_graph_in_scratch(true) is used, the Team/TeamVector solvers also
+/// allocate the sparsity graph of the operator in the team scratch pad of
+/// level get_scratch_pad_level(), in addition to their temporary vectors.
+///
 /// \tparam NormViewType: type of the view used to store the convergence history
 /// \tparam IntViewType: type of the view used to store the number of iteration
 /// per system \tparam ViewType3D: type of the 3D temporary views
@@ -76,6 +84,8 @@ class KrylovHandle {
   int ortho_strategy;
   int scratch_pad_level;
   int memory_strategy;
+  bool graph_in_scratch;
+  int compaction_period;
   bool compute_last_residual;
   bool monitor_residual;
   bool host_synchronised;
@@ -120,6 +130,8 @@ class KrylovHandle {
     compute_last_residual = true;
     host_synchronised     = false;
     memory_strategy       = 0;
+    graph_in_scratch      = false;
+    compaction_period     = 0;
   }
 
   /// \brief get_number_of_systems_per_team
@@ -393,6 +405,50 @@ class KrylovHandle {
   KOKKOS_INLINE_FUNCTION
   int get_memory_strategy() const { return memory_strategy; }
 
+  /// \brief set_graph_in_scratch
+  ///   Select if the Team/TeamVector solvers copy the sparsity graph of the
+  ///   operator into the team scratch pad before iterating. Only operators
+  ///   that provide stage_graph_in_scratch (e.g. CrsMatrix) are affected; the
+  ///   scratch size of the team policy has to include the size returned by
+  ///   their get_graph_scratch_size.
+  ///
+  /// \param _graph_in_scratch [in]: boolean that specifies if the graph is
+  /// staged in scratch
+
+  KOKKOS_INLINE_FUNCTION
+  void set_graph_in_scratch(bool _graph_in_scratch) {
+    graph_in_scratch = _graph_in_scratch;
+  }
+
+  /// \brief get_graph_in_scratch
+  ///   Get if the sparsity graph of the operator is staged in scratch.
+
+  KOKKOS_INLINE_FUNCTION
+  bool get_graph_in_scratch() const { return graph_in_scratch; }
+
+  /// \brief set_compaction_period
+  ///   Select the period (in iterations) of the compaction of the active
+  ///   systems of the Team/TeamVector CG: every _compaction_period
+  ///   iterations, the systems of a team that have converged are moved behind
+  ///   the unconverged ones and are not updated nor applied to the operator
+  ///   anymore. Only operators that provide first_systems and swap_systems
+  ///   (e.g. CrsMatrix) are compacted; their values are permuted during the
+  ///   solve and restored before returning. The compaction requires
+  ///   2 x N_team additional ints of team scratch. 0 (default) disables it.
+  ///
+  /// \param _compaction_period [in]: compaction period
+
+  KOKKOS_INLINE_FUNCTION
+  void set_compaction_period(int _compaction_period) {
+    compaction_period = _compaction_period;
+  }
+
+  /// \brief get_compaction_period
+  ///   Get the period of the compaction of the active systems.
+
+  KOKKOS_INLINE_FUNCTION
+  int get_compaction_period() const { return compaction_period; }
+
  private:
   /// \brief set_norm
   ///   Store the norm of one of the system at one of the iteration
@@ -19,6 +19,39 @@
 
 namespace KokkosBatched {
 
+namespace Impl {
+
+/// \brief Operator used by the Team/TeamVector Krylov solvers when the handle
+/// requests the sparsity graph in team scratch: operators that provide
+/// stage_graph_in_scratch are staged, the others are returned unchanged.
+
+template <typename MemberType, typename OperatorType>
+KOKKOS_INLINE_FUNCTION auto stage_operator_graph(const MemberType& member,
+                                                 const OperatorType& A,
+                                                 const int level, int)
+    -> decltype(A.stage_graph_in_scratch(member, level)) {
+  return A.stage_graph_in_scratch(member, level);
+}
+
+template <typename MemberType, typename OperatorType>
+KOKKOS_INLINE_FUNCTION OperatorType stage_operator_graph(const MemberType&,
+                                                         const OperatorType& A,
+                                                         const int, long) {
+  return A;
+}
+
+template <typename MemberType, typename OperatorType,
+          typename KrylovHandleType>
+KOKKOS_INLINE_FUNCTION OperatorType
+krylov_operator(const MemberType& member, const OperatorType& A,
+                const KrylovHandleType& handle) {
+  if (handle.get_graph_in_scratch())
+    return stage_operator_graph(member, A, handle.get_scratch_pad_level(), 0);
+  return A;
+}
+
+}  // namespace Impl
+
 struct SerialGMRES {
   template <typename OperatorType, typename VectorViewType,
             typename PrecOperatorType, typename KrylovHandleType>
@@ -126,6 +159,42 @@ struct TeamVectorCG {
                                            const KrylovHandleType& handle);
 };
 
+template <typename MemberType>
+struct TeamBiCGStab {
+  template <typename OperatorType, typename VectorViewType,
+            typename KrylovHandleType, typename TMPViewType,
+            typename TMPNormViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(
+      const MemberType& member, const OperatorType& A, const VectorViewType& _B,
+      const VectorViewType& _X, const KrylovHandleType& handle,
+      const TMPViewType& _TMPView, const TMPNormViewType& _TMPNormView);
+  template <typename OperatorType, typename VectorViewType,
+            typename KrylovHandleType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType& member,
+                                           const OperatorType& A,
+                                           const VectorViewType& _B,
+                                           const VectorViewType& _X,
+                                           const KrylovHandleType& handle);
+};
+
+template <typename MemberType>
+struct TeamVectorBiCGStab {
+  template <typename OperatorType, typename VectorViewType,
+            typename KrylovHandleType, typename TMPViewType,
+            typename TMPNormViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(
+      const MemberType& member, const OperatorType& A, const VectorViewType& _B,
+      const VectorViewType& _X, const KrylovHandleType& handle,
+      const TMPViewType& _TMPView, const TMPNormViewType& _TMPNormView);
+  template <typename OperatorType, typename VectorViewType,
+            typename KrylovHandleType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType& member,
+                                           const OperatorType& A,
+                                           const VectorViewType& _B,
+                                           const VectorViewType& _X,
+                                           const KrylovHandleType& handle);
+};
+
 }  // namespace KokkosBatched
 
 #endif
@@ -23,6 +23,8 @@
 #include "Test_Batched_SerialSpmv_Real.hpp"
 
 // Team Kernels
+#include "Test_Batched_TeamBiCGStab.hpp"
+#include "Test_Batched_TeamBiCGStab_Real.hpp"
 #include "Test_Batched_TeamCG.hpp"
 #include "Test_Batched_TeamCG_Real.hpp"
 #include "Test_Batched_TeamGMRES.hpp"
@@ -31,10 +33,16 @@
 #include "Test_Batched_TeamSpmv_Real.hpp"
 
 // TeamVector Kernels
+#include "Test_Batched_TeamVectorBiCGStab.hpp"
+#include "Test_Batched_TeamVectorBiCGStab_Real.hpp"
 #include "Test_Batched_TeamVectorCG.hpp"
 #include "Test_Batched_TeamVectorCG_Real.hpp"
+#include "Test_Batched_TeamVectorEllMatrix.hpp"
+#include "Test_Batched_TeamVectorEllMatrix_Real.hpp"
 #include "Test_Batched_TeamVectorGMRES.hpp"
 #include "Test_Batched_TeamVectorGMRES_Real.hpp"
+#include "Test_Batched_TeamVectorPrec.hpp"
+#include "Test_Batched_TeamVectorPrec_Real.hpp"
 #include "Test_Batched_TeamVectorSpmv.hpp"
 #include "Test_Batched_TeamVectorSpmv_Real.hpp"
 
@@ -42,14 +42,19 @@ struct Functor_TestBatchedTeamVectorCG {
 
   Functor_TestBatchedTeamVectorCG(const ValuesViewType &D, const IntView &r,
                                   const IntView &c, const VectorViewType &X,
-                                  const VectorViewType &B, const int N_team)
+                                  const VectorViewType &B, const int N_team,
+                                  const bool graph_in_scratch = false,
+                                  const int compaction_period = 0)
       : _D(D),
         _r(r),
         _c(c),
         _X(X),
         _B(B),
         _N_team(N_team),
-        handle(KrylovHandleType(_D.extent(0), _N_team)) {}
+        handle(KrylovHandleType(_D.extent(0), _N_team)) {
+    handle.set_graph_in_scratch(graph_in_scratch);
+    handle.set_compaction_period(compaction_period);
+  }
 
   template <typename MemberType>
   KOKKOS_INLINE_FUNCTION void operator()(const MemberType &member) const {
@@ -87,7 +92,17 @@ struct Functor_TestBatchedTeamVectorCG {
 
     size_t bytes_0 = ValuesViewType::shmem_size(_N_team, _X.extent(1));
     size_t bytes_1 = ValuesViewType::shmem_size(_N_team, 1);
-    policy.set_scratch_size(0, Kokkos::PerTeam(4 * bytes_0 + 5 * bytes_1));
+    size_t bytes_graph =
+        handle.get_graph_in_scratch()
+            ? KokkosBatched::CrsMatrix<ValuesViewType, IntView>(_D, _r, _c)
+                  .get_graph_scratch_size()
+            : 0;
+    size_t bytes_perm = handle.get_compaction_period() > 0
+                            ? 2 * IntView::shmem_size(_N_team)
+                            : 0;
+    policy.set_scratch_size(
+        0, Kokkos::PerTeam(4 * bytes_0 + 5 * bytes_1 + bytes_graph +
+                           bytes_perm));
 
     Kokkos::parallel_for(name.c_str(), policy, *this);
     Kokkos::Profiling::popRegion();
@@ -96,7 +111,9 @@ struct Functor_TestBatchedTeamVectorCG {
 
 template <typename DeviceType, typename ValuesViewType, typename IntView,
           typename VectorViewType>
-void impl_test_batched_CG(const int N, const int BlkSize, const int N_team) {
+void impl_test_batched_CG(const int N, const int BlkSize, const int N_team,
+                          const bool graph_in_scratch = false,
+                          const int compaction_period = 0) {
   typedef typename ValuesViewType::value_type value_type;
   typedef Kokkos::ArithTraits<value_type> ats;
 
@@ -128,6 +145,15 @@ void impl_test_batched_CG(const int N, const int BlkSize, const int N_team) {
 
   create_tridiagonal_batched_matrices(nnz, BlkSize, N, r, c, D, X, B);
 
+  if (compaction_period > 0) {
+    // Different matrices, so that misplaced values would be detected
+    auto D_scaled_host = Kokkos::create_mirror_view(D);
+    Kokkos::deep_copy(D_scaled_host, D);
+    for (int l = 0; l < N; ++l)
+      for (int i = 0; i < nnz; ++i) D_scaled_host(l, i) *= 1 + l % 5;
+    Kokkos::deep_copy(D, D_scaled_host);
+  }
+
   // Compute initial norm
 
   Kokkos::deep_copy(R, B);
@@ -155,8 +181,8 @@ void impl_test_batched_CG(const int N, const int BlkSize, const int N_team) {
   KokkosBatched::SerialDot<Trans::NoTranspose>::invoke(R_host, R_host,
                                                        sqr_norm_0_host);
   Functor_TestBatchedTeamVectorCG<DeviceType, ValuesViewType, IntView,
-                                  VectorViewType, KrylovHandleType>(D, r, c, X,
-                                                                    B, N_team)
+                                  VectorViewType, KrylovHandleType>(
+      D, r, c, X, B, N_team, graph_in_scratch, compaction_period)
       .run();
 
   Kokkos::fence();
@@ -176,6 +202,14 @@ void impl_test_batched_CG(const int N, const int BlkSize, const int N_team) {
 
   for (int l = 0; l < N; ++l)
     EXPECT_NEAR_KK(sqr_norm_j_host(l) / sqr_norm_0_host(l), 0, eps);
+
+  // The compaction permutes the values of the operator during the solve
+  if (compaction_period > 0) {
+    auto D_after_host = Kokkos::create_mirror_view(D);
+    Kokkos::deep_copy(D_after_host, D);
+    for (int l = 0; l < N; ++l)
+      for (int i = 0; i < nnz; ++i) EXPECT_EQ(D_after_host(l, i), D_host(l, i));
+  }
 }
 }  // namespace TeamVectorCG
 }  // namespace Test
@@ -192,6 +226,12 @@ int test_batched_teamvector_CG() {
     for (int i = 3; i < 10; ++i) {
       Test::TeamVectorCG::impl_test_batched_CG<DeviceType, ViewType, IntView,
                                                VectorViewType>(1024, i, 2);
+      Test::TeamVectorCG::impl_test_batched_CG<DeviceType, ViewType, IntView,
+                                               VectorViewType>(1024, i, 2,
+                                                               true);
+      Test::TeamVectorCG::impl_test_batched_CG<DeviceType, ViewType, IntView,
+                                               VectorViewType>(1024, i, 8,
+                                                               false, 1);
     }
   }
 #endif
@@ -206,6 +246,12 @@ int test_batched_teamvector_CG() {
     for (int i = 3; i < 10; ++i) {
       Test::TeamVectorCG::impl_test_batched_CG<DeviceType, ViewType, IntView,
                                                VectorViewType>(1024, i, 2);
+      Test::TeamVectorCG::impl_test_batched_CG<DeviceType, ViewType, IntView,
+                                               VectorViewType>(1024, i, 2,
+                                                               true);
+      Test::TeamVectorCG::impl_test_batched_CG<DeviceType, ViewType, IntView,
+                                               VectorViewType>(1024, i, 8,
+                                                               false, 1);
     }
   }
 #endif
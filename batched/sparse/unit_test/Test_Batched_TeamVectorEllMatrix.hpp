@@ -0,0 +1,312 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include "gtest/gtest.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_Random.hpp"
+#include "KokkosBatched_CG.hpp"
+#include "KokkosBatched_Spmv.hpp"
+#include "KokkosKernels_TestUtils.hpp"
+#include "KokkosBatched_EllMatrix.hpp"
+#include "Test_Batched_SparseUtils.hpp"
+
+using namespace KokkosBatched;
+
+namespace Test {
+namespace TeamVectorEllMatrix {
+
+template <typename DeviceType, typename ValuesViewType, typename IntView,
+          typename VectorViewType, typename ArgMode>
+struct Functor_TestBatchedTeamVectorEllSpmv {
+  using execution_space = typename DeviceType::execution_space;
+  const ValuesViewType _E;
+  const IntView _c;
+  const int _row_length;
+  const VectorViewType _X;
+  const VectorViewType _Y;
+  const int _N_team;
+
+  Functor_TestBatchedTeamVectorEllSpmv(const ValuesViewType &E,
+                                       const IntView &c, const int row_length,
+                                       const VectorViewType &X,
+                                       const VectorViewType &Y,
+                                       const int N_team)
+      : _E(E), _c(c), _row_length(row_length), _X(X), _Y(Y), _N_team(N_team) {}
+
+  template <typename MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType &member) const {
+    const int first_matrix = static_cast<int>(member.league_rank()) * _N_team;
+    const int N            = _E.extent(0);
+    const int last_matrix =
+        (static_cast<int>(member.league_rank() + 1) * _N_team < N
+             ? static_cast<int>(member.league_rank() + 1) * _N_team
+             : N);
+
+    auto e = Kokkos::subview(_E, Kokkos::make_pair(first_matrix, last_matrix),
+                             Kokkos::ALL);
+    auto x = Kokkos::subview(_X, Kokkos::make_pair(first_matrix, last_matrix),
+                             Kokkos::ALL);
+    auto y = Kokkos::subview(_Y, Kokkos::make_pair(first_matrix, last_matrix),
+                             Kokkos::ALL);
+
+    KokkosBatched::EllMatrix<ValuesViewType, IntView> A(e, _c, _row_length);
+    A.template apply<Trans::NoTranspose, ArgMode>(member, x, y, 2, 0.5);
+  }
+
+  inline void run() {
+    typedef typename ValuesViewType::value_type value_type;
+    std::string name_region("KokkosBatched::Test::TeamVectorEllSpmv");
+    const std::string name_value_type = Test::value_type_name<value_type>();
+    std::string name                  = name_region + name_value_type;
+    Kokkos::Profiling::pushRegion(name.c_str());
+    Kokkos::TeamPolicy<execution_space> policy(_E.extent(0) / _N_team,
+                                               Kokkos::AUTO(), Kokkos::AUTO());
+    Kokkos::parallel_for(name.c_str(), policy, *this);
+    Kokkos::Profiling::popRegion();
+  }
+};
+
+template <typename DeviceType, typename ValuesViewType, typename IntView,
+          typename VectorViewType, typename KrylovHandleType>
+struct Functor_TestBatchedTeamVectorEllCG {
+  using execution_space = typename DeviceType::execution_space;
+  const ValuesViewType _E;
+  const IntView _c;
+  const int _row_length;
+  const VectorViewType _X;
+  const VectorViewType _B;
+  const int _N_team;
+  KrylovHandleType handle;
+
+  Functor_TestBatchedTeamVectorEllCG(const ValuesViewType &E, const IntView &c,
+                                     const int row_length,
+                                     const VectorViewType &X,
+                                     const VectorViewType &B, const int N_team)
+      : _E(E),
+        _c(c),
+        _row_length(row_length),
+        _X(X),
+        _B(B),
+        _N_team(N_team),
+        handle(KrylovHandleType(_E.extent(0), _N_team)) {
+    handle.set_graph_in_scratch(true);
+  }
+
+  template <typename MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType &member) const {
+    const int first_matrix = static_cast<int>(member.league_rank()) * _N_team;
+    const int N            = _E.extent(0);
+    const int last_matrix =
+        (static_cast<int>(member.league_rank() + 1) * _N_team < N
+             ? static_cast<int>(member.league_rank() + 1) * _N_team
+             : N);
+
+    auto e = Kokkos::subview(_E, Kokkos::make_pair(first_matrix, last_matrix),
+                             Kokkos::ALL);
+    auto x = Kokkos::subview(_X, Kokkos::make_pair(first_matrix, last_matrix),
+                             Kokkos::ALL);
+    auto b = Kokkos::subview(_B, Kokkos::make_pair(first_matrix, last_matrix),
+                             Kokkos::ALL);
+
+    using Operator = KokkosBatched::EllMatrix<ValuesViewType, IntView>;
+
+    Operator A(e, _c, _row_length);
+
+    KokkosBatched::TeamVectorCG<MemberType>::template invoke<Operator,
+                                                             VectorViewType>(
+        member, A, b, x, handle);
+  }
+
+  inline void run() {
+    typedef typename ValuesViewType::value_type value_type;
+    std::string name_region("KokkosBatched::Test::TeamVectorEllCG");
+    const std::string name_value_type = Test::value_type_name<value_type>();
+    std::string name                  = name_region + name_value_type;
+    Kokkos::Profiling::pushRegion(name.c_str());
+    Kokkos::TeamPolicy<execution_space> policy(_E.extent(0) / _N_team,
+                                               Kokkos::AUTO(), Kokkos::AUTO());
+
+    size_t bytes_0 = ValuesViewType::shmem_size(_N_team, _X.extent(1));
+    size_t bytes_1 = ValuesViewType::shmem_size(_N_team, 1);
+    size_t bytes_graph =
+        KokkosBatched::EllMatrix<ValuesViewType, IntView>(_E, _c, _row_length)
+            .get_graph_scratch_size();
+    policy.set_scratch_size(
+        0, Kokkos::PerTeam(4 * bytes_0 + 5 * bytes_1 + bytes_graph));
+
+    Kokkos::parallel_for(name.c_str(), policy, *this);
+    Kokkos::Profiling::popRegion();
+  }
+};
+
+template <typename DeviceType, typename ValuesViewType, typename IntView,
+          typename VectorViewType>
+void impl_test_batched_EllMatrix(const int N, const int BlkSize,
+                                 const int N_team) {
+  typedef typename ValuesViewType::value_type value_type;
+  typedef Kokkos::ArithTraits<value_type> ats;
+
+  using ScalarType = typename ValuesViewType::non_const_value_type;
+  using Layout     = typename ValuesViewType::array_layout;
+  using EXSP       = typename ValuesViewType::execution_space;
+
+  using MagnitudeType    = typename Kokkos::ArithTraits<ScalarType>::mag_type;
+  using Norm2DViewType   = Kokkos::View<MagnitudeType **, Layout, EXSP>;
+  using Scalar3DViewType = Kokkos::View<ScalarType ***, Layout, EXSP>;
+  using IntViewType      = Kokkos::View<int *, Layout, EXSP>;
+
+  using KrylovHandleType =
+      KrylovHandle<Norm2DViewType, IntViewType, Scalar3DViewType>;
+  using EllMatrixType = KokkosBatched::EllMatrix<ValuesViewType, IntView>;
+
+  const int nnz = (BlkSize - 2) * 3 + 2 * 2;
+
+  VectorViewType X("x0", N, BlkSize);
+  VectorViewType B("b", N, BlkSize);
+  VectorViewType Y("y", N, BlkSize);
+  ValuesViewType D("D", N, nnz);
+  IntView r("r", BlkSize + 1);
+  IntView c("c", nnz);
+
+  create_tridiagonal_batched_matrices(nnz, BlkSize, N, r, c, D, X, B);
+
+  const int row_length = EllMatrixType::getMaxRowLength(r);
+  EXPECT_EQ(row_length, 3);
+  ValuesViewType E("E", N, BlkSize * row_length);
+  IntView e_c("e_c", BlkSize * row_length);
+  EllMatrixType::convertFromCrs(D, r, c, E, e_c);
+
+  auto X_host = Kokkos::create_mirror_view(X);
+  auto B_host = Kokkos::create_mirror_view(B);
+  auto Y_host = Kokkos::create_mirror_view(Y);
+  auto D_host = Kokkos::create_mirror_view(D);
+  auto r_host = Kokkos::create_mirror_view(r);
+  auto c_host = Kokkos::create_mirror_view(c);
+
+  Kokkos::deep_copy(X_host, X);
+  Kokkos::deep_copy(B_host, B);
+  Kokkos::deep_copy(D_host, D);
+  Kokkos::deep_copy(r_host, r);
+  Kokkos::deep_copy(c_host, c);
+
+  const MagnitudeType eps = 1.0e3 * ats::epsilon();
+
+  // Y = 2 A X + 0.5 Y compared with the crs spmv, with both parallelisms
+  {
+    auto Ref_host = Kokkos::create_mirror_view(Y);
+    Kokkos::deep_copy(Ref_host, B_host);
+    KokkosBatched::SerialSpmv<Trans::NoTranspose>::template invoke<
+        typename ValuesViewType::HostMirror, typename IntView::HostMirror,
+        typename VectorViewType::HostMirror,
+        typename VectorViewType::HostMirror, 1>(2, D_host, r_host, c_host,
+                                                X_host, 0.5, Ref_host);
+
+    Kokkos::deep_copy(Y, B);
+    Functor_TestBatchedTeamVectorEllSpmv<DeviceType, ValuesViewType, IntView,
+                                         VectorViewType, Mode::TeamVector>(
+        E, e_c, row_length, X, Y, N_team)
+        .run();
+    Kokkos::fence();
+    Kokkos::deep_copy(Y_host, Y);
+    for (int l = 0; l < N; ++l)
+      for (int i = 0; i < BlkSize; ++i)
+        EXPECT_NEAR_KK(Y_host(l, i), Ref_host(l, i), eps);
+
+    Kokkos::deep_copy(Y, B);
+    Functor_TestBatchedTeamVectorEllSpmv<DeviceType, ValuesViewType, IntView,
+                                         VectorViewType, Mode::Team>(
+        E, e_c, row_length, X, Y, N_team)
+        .run();
+    Kokkos::fence();
+    Kokkos::deep_copy(Y_host, Y);
+    for (int l = 0; l < N; ++l)
+      for (int i = 0; i < BlkSize; ++i)
+        EXPECT_NEAR_KK(Y_host(l, i), Ref_host(l, i), eps);
+  }
+
+  // CG with the ell operator
+  {
+    using NormViewType = Kokkos::View<MagnitudeType *, Layout, EXSP>;
+    NormViewType sqr_norm_0("sqr_norm_0", N);
+    NormViewType sqr_norm_j("sqr_norm_j", N);
+    auto sqr_norm_0_host = Kokkos::create_mirror_view(sqr_norm_0);
+    auto sqr_norm_j_host = Kokkos::create_mirror_view(sqr_norm_j);
+    auto R_host          = Kokkos::create_mirror_view(Y);
+
+    Kokkos::deep_copy(R_host, B_host);
+    KokkosBatched::SerialSpmv<Trans::NoTranspose>::template invoke<
+        typename ValuesViewType::HostMirror, typename IntView::HostMirror,
+        typename VectorViewType::HostMirror,
+        typename VectorViewType::HostMirror, 1>(-1, D_host, r_host, c_host,
+                                                X_host, 1, R_host);
+    KokkosBatched::SerialDot<Trans::NoTranspose>::invoke(R_host, R_host,
+                                                         sqr_norm_0_host);
+
+    Functor_TestBatchedTeamVectorEllCG<DeviceType, ValuesViewType, IntView,
+                                       VectorViewType, KrylovHandleType>(
+        E, e_c, row_length, X, B, N_team)
+        .run();
+    Kokkos::fence();
+    Kokkos::deep_copy(X_host, X);
+
+    Kokkos::deep_copy(R_host, B_host);
+    KokkosBatched::SerialSpmv<Trans::NoTranspose>::template invoke<
+        typename ValuesViewType::HostMirror, typename IntView::HostMirror,
+        typename VectorViewType::HostMirror,
+        typename VectorViewType::HostMirror, 1>(-1, D_host, r_host, c_host,
+                                                X_host, 1, R_host);
+    KokkosBatched::SerialDot<Trans::NoTranspose>::invoke(R_host, R_host,
+                                                         sqr_norm_j_host);
+
+    for (int l = 0; l < N; ++l)
+      EXPECT_NEAR_KK(sqr_norm_j_host(l) / sqr_norm_0_host(l), 0, eps);
+  }
+}
+}  // namespace TeamVectorEllMatrix
+}  // namespace Test
+
+template <typename DeviceType, typename ValueType>
+int test_batched_teamvector_EllMatrix() {
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT)
+  {
+    typedef Kokkos::View<ValueType **, Kokkos::LayoutLeft, DeviceType> ViewType;
+    typedef Kokkos::View<int *, Kokkos::LayoutLeft, DeviceType> IntView;
+    typedef Kokkos::View<ValueType **, Kokkos::LayoutLeft, DeviceType>
+        VectorViewType;
+
+    for (int i = 3; i < 10; ++i) {
+      Test::TeamVectorEllMatrix::impl_test_batched_EllMatrix<
+          DeviceType, ViewType, IntView, VectorViewType>(1024, i, 2);
+    }
+  }
+#endif
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT)
+  {
+    typedef Kokkos::View<ValueType **, Kokkos::LayoutRight, DeviceType>
+        ViewType;
+    typedef Kokkos::View<int *, Kokkos::LayoutRight, DeviceType> IntView;
+    typedef Kokkos::View<ValueType **, Kokkos::LayoutRight, DeviceType>
+        VectorViewType;
+
+    for (int i = 3; i < 10; ++i) {
+      Test::TeamVectorEllMatrix::impl_test_batched_EllMatrix<
+          DeviceType, ViewType, IntView, VectorViewType>(1024, i, 2);
+    }
+  }
+#endif
+
+  return 0;
+}
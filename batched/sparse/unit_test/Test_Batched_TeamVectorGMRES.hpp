@@ -132,7 +132,8 @@ struct Functor_TestBatchedTeamVectorGMRES {
 
 template <typename DeviceType, typename ValuesViewType, typename IntView,
           typename VectorViewType>
-void impl_test_batched_GMRES(const int N, const int BlkSize, const int N_team) {
+void impl_test_batched_GMRES(const int N, const int BlkSize, const int N_team,
+                             const bool graph_in_scratch = false) {
   typedef typename ValuesViewType::value_type value_type;
   typedef Kokkos::ArithTraits<value_type> ats;
 
@@ -210,6 +211,7 @@ void impl_test_batched_GMRES(const int N, const int BlkSize, const int N_team) {
 
   const int n_iterations = 10;
   KrylovHandleType handle(N, N_team, n_iterations);
+  handle.set_graph_in_scratch(graph_in_scratch);
 
   KokkosBatched::SerialSpmv<Trans::NoTranspose>::template invoke<
       typename ValuesViewType::HostMirror, typename IntView::HostMirror,
@@ -257,6 +259,9 @@ int test_batched_teamvector_GMRES() {
       Test::TeamVectorGMRES::impl_test_batched_GMRES<DeviceType, ViewType,
                                                      IntView, VectorViewType>(
           1024, i, 2);
+      Test::TeamVectorGMRES::impl_test_batched_GMRES<DeviceType, ViewType,
+                                                     IntView, VectorViewType>(
+          1024, i, 2, true);
     }
   }
 #endif
@@ -272,6 +277,9 @@ int test_batched_teamvector_GMRES() {
       Test::TeamVectorGMRES::impl_test_batched_GMRES<DeviceType, ViewType,
                                                      IntView, VectorViewType>(
           1024, i, 2);
+      Test::TeamVectorGMRES::impl_test_batched_GMRES<DeviceType, ViewType,
+                                                     IntView, VectorViewType>(
+          1024, i, 2, true);
     }
   }
 #endif
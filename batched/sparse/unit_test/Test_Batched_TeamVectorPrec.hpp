@@ -0,0 +1,295 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_Random.hpp"
+#include "KokkosBatched_Spmv.hpp"
+#include "KokkosBatched_ILUPrec.hpp"
+#include "KokkosBatched_BlockJacobiPrec.hpp"
+#include "KokkosKernels_TestUtils.hpp"
+#include "Test_Batched_SparseUtils.hpp"
+
+using namespace KokkosBatched;
+
+namespace Test {
+namespace TeamVectorPrec {
+
+template <typename DeviceType, typename ValuesViewType, typename IntView,
+          typename VectorViewType>
+struct Functor_TestBatchedTeamVectorILUPrec {
+  using execution_space = typename DeviceType::execution_space;
+  const ValuesViewType _F;
+  const IntView _r;
+  const IntView _c;
+  const IntView _d;
+  const VectorViewType _X;
+  const VectorViewType _Y;
+  const int _N_team;
+
+  Functor_TestBatchedTeamVectorILUPrec(const ValuesViewType &F,
+                                       const IntView &r, const IntView &c,
+                                       const IntView &d,
+                                       const VectorViewType &X,
+                                       const VectorViewType &Y,
+                                       const int N_team)
+      : _F(F), _r(r), _c(c), _d(d), _X(X), _Y(Y), _N_team(N_team) {}
+
+  template <typename MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType &member) const {
+    const int first_matrix = static_cast<int>(member.league_rank()) * _N_team;
+    const int N            = _F.extent(0);
+    const int last_matrix =
+        (static_cast<int>(member.league_rank() + 1) * _N_team < N
+             ? static_cast<int>(member.league_rank() + 1) * _N_team
+             : N);
+
+    auto f = Kokkos::subview(_F, Kokkos::make_pair(first_matrix, last_matrix),
+                             Kokkos::ALL);
+    auto x = Kokkos::subview(_X, Kokkos::make_pair(first_matrix, last_matrix),
+                             Kokkos::ALL);
+    auto y = Kokkos::subview(_Y, Kokkos::make_pair(first_matrix, last_matrix),
+                             Kokkos::ALL);
+
+    KokkosBatched::ILUPrec<ValuesViewType, IntView> P(f, _r, _c, _d);
+    P.template apply<Trans::NoTranspose, Mode::TeamVector, 0>(member, x, y);
+  }
+
+  inline void run() {
+    typedef typename ValuesViewType::value_type value_type;
+    std::string name_region("KokkosBatched::Test::TeamVectorILUPrec");
+    const std::string name_value_type = Test::value_type_name<value_type>();
+    std::string name                  = name_region + name_value_type;
+    Kokkos::Profiling::pushRegion(name.c_str());
+    Kokkos::TeamPolicy<execution_space> policy(_F.extent(0) / _N_team,
+                                               Kokkos::AUTO(), Kokkos::AUTO());
+    Kokkos::parallel_for(name.c_str(), policy, *this);
+    Kokkos::Profiling::popRegion();
+  }
+};
+
+template <typename DeviceType, typename BlocksViewType,
+          typename VectorViewType>
+struct Functor_TestBatchedTeamVectorBlockJacobiPrec {
+  using execution_space = typename DeviceType::execution_space;
+  const BlocksViewType _Blocks;
+  const VectorViewType _X;
+  const VectorViewType _Y;
+  const int _N_team;
+
+  Functor_TestBatchedTeamVectorBlockJacobiPrec(const BlocksViewType &Blocks,
+                                               const VectorViewType &X,
+                                               const VectorViewType &Y,
+                                               const int N_team)
+      : _Blocks(Blocks), _X(X), _Y(Y), _N_team(N_team) {}
+
+  template <typename MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType &member) const {
+    const int first_matrix = static_cast<int>(member.league_rank()) * _N_team;
+    const int N            = _Blocks.extent(0);
+    const int last_matrix =
+        (static_cast<int>(member.league_rank() + 1) * _N_team < N
+             ? static_cast<int>(member.league_rank() + 1) * _N_team
+             : N);
+
+    auto blocks =
+        Kokkos::subview(_Blocks, Kokkos::make_pair(first_matrix, last_matrix),
+                        Kokkos::ALL, Kokkos::ALL);
+    auto x = Kokkos::subview(_X, Kokkos::make_pair(first_matrix, last_matrix),
+                             Kokkos::ALL);
+    auto y = Kokkos::subview(_Y, Kokkos::make_pair(first_matrix, last_matrix),
+                             Kokkos::ALL);
+
+    KokkosBatched::BlockJacobiPrec<decltype(blocks)> P(blocks);
+    P.template apply<Trans::NoTranspose, Mode::TeamVector, 0>(member, x, y);
+  }
+
+  inline void run() {
+    typedef typename BlocksViewType::value_type value_type;
+    std::string name_region("KokkosBatched::Test::TeamVectorBlockJacobiPrec");
+    const std::string name_value_type = Test::value_type_name<value_type>();
+    std::string name                  = name_region + name_value_type;
+    Kokkos::Profiling::pushRegion(name.c_str());
+    Kokkos::TeamPolicy<execution_space> policy(_Blocks.extent(0) / _N_team,
+                                               Kokkos::AUTO(), Kokkos::AUTO());
+    Kokkos::parallel_for(name.c_str(), policy, *this);
+    Kokkos::Profiling::popRegion();
+  }
+};
+
+/// The batched matrices are tridiagonal: ILU(0) is their exact LU
+/// factorization and a block Jacobi with a single block is their exact
+/// inverse, so both preconditioners have to recover X from B = A X.
+/// With smaller blocks, the block Jacobi is checked against the inverse of
+/// the diagonal blocks computed on the host.
+template <typename DeviceType, typename ValuesViewType, typename IntView,
+          typename VectorViewType, typename BlocksViewType>
+void impl_test_batched_Prec(const int N, const int BlkSize, const int N_team,
+                            const int block_size) {
+  typedef typename ValuesViewType::value_type value_type;
+  typedef Kokkos::ArithTraits<value_type> ats;
+
+  const int nnz = (BlkSize - 2) * 3 + 2 * 2;
+
+  VectorViewType X("x0", N, BlkSize);
+  VectorViewType B("b", N, BlkSize);
+  VectorViewType Y("y", N, BlkSize);
+  ValuesViewType D("D", N, nnz);
+  ValuesViewType F("F", N, nnz);
+  IntView r("r", BlkSize + 1);
+  IntView c("c", nnz);
+  IntView d("d", BlkSize);
+  BlocksViewType Blocks("Blocks", N, BlkSize, block_size);
+
+  create_tridiagonal_batched_matrices(nnz, BlkSize, N, r, c, D, X, B);
+
+  auto X_host = Kokkos::create_mirror_view(X);
+  auto B_host = Kokkos::create_mirror_view(B);
+  auto Y_host = Kokkos::create_mirror_view(Y);
+  auto D_host = Kokkos::create_mirror_view(D);
+  auto r_host = Kokkos::create_mirror_view(r);
+  auto c_host = Kokkos::create_mirror_view(c);
+
+  Kokkos::deep_copy(X_host, X);
+  Kokkos::deep_copy(D_host, D);
+  Kokkos::deep_copy(r_host, r);
+  Kokkos::deep_copy(c_host, c);
+
+  KokkosBatched::SerialSpmv<Trans::NoTranspose>::template invoke<
+      typename ValuesViewType::HostMirror, typename IntView::HostMirror,
+      typename VectorViewType::HostMirror, typename VectorViewType::HostMirror,
+      0>(1, D_host, r_host, c_host, X_host, 0, B_host);
+  Kokkos::deep_copy(B, B_host);
+
+  const typename ats::mag_type eps = 1.0e3 * ats::epsilon();
+
+  // ILU(0)
+  {
+    const int missing =
+        KokkosBatched::ILUPrec<ValuesViewType, IntView>::computeDiagonalIndices(
+            r, c, d);
+    EXPECT_EQ(missing, 0);
+    Kokkos::deep_copy(F, D);
+
+    Functor_TestBatchedTeamVectorILUPrec<DeviceType, ValuesViewType, IntView,
+                                         VectorViewType>(F, r, c, d, B, Y,
+                                                         N_team)
+        .run();
+    Kokkos::fence();
+    Kokkos::deep_copy(Y_host, Y);
+
+    for (int l = 0; l < N; ++l)
+      for (int i = 0; i < BlkSize; ++i)
+        EXPECT_NEAR_KK(Y_host(l, i), X_host(l, i), eps);
+  }
+
+  // Block Jacobi
+  {
+    KokkosBatched::BlockJacobiPrec<BlocksViewType>::computeDiagonalBlocks(
+        D, r, c, Blocks);
+
+    // reference: solve every tridiagonal diagonal block on the host
+    auto Ref_host = Kokkos::create_mirror_view(Y);
+    for (int l = 0; l < N; ++l)
+      for (int i0 = 0; i0 < BlkSize; i0 += block_size) {
+        const int nb = i0 + block_size <= BlkSize ? block_size : BlkSize - i0;
+        // Thomas algorithm on rows i0 .. i0 + nb - 1
+        std::vector<value_type> lower(nb), diag(nb), upper(nb), rhs(nb);
+        for (int i = 0; i < nb; ++i) {
+          lower[i] = upper[i] = 0;
+          for (int p = r_host(i0 + i); p < r_host(i0 + i + 1); ++p) {
+            const int j = c_host(p) - i0;
+            if (j == i - 1) lower[i] = D_host(l, p);
+            if (j == i) diag[i] = D_host(l, p);
+            if (j == i + 1 && j < nb) upper[i] = D_host(l, p);
+          }
+          rhs[i] = B_host(l, i0 + i);
+        }
+        for (int i = 1; i < nb; ++i) {
+          const value_type m = lower[i] / diag[i - 1];
+          diag[i] -= m * upper[i - 1];
+          rhs[i] -= m * rhs[i - 1];
+        }
+        Ref_host(l, i0 + nb - 1) = rhs[nb - 1] / diag[nb - 1];
+        for (int i = nb - 2; i >= 0; --i)
+          Ref_host(l, i0 + i) =
+              (rhs[i] - upper[i] * Ref_host(l, i0 + i + 1)) / diag[i];
+      }
+
+    Functor_TestBatchedTeamVectorBlockJacobiPrec<DeviceType, BlocksViewType,
+                                                 VectorViewType>(Blocks, B, Y,
+                                                                 N_team)
+        .run();
+    Kokkos::fence();
+    Kokkos::deep_copy(Y_host, Y);
+
+    for (int l = 0; l < N; ++l)
+      for (int i = 0; i < BlkSize; ++i) {
+        EXPECT_NEAR_KK(Y_host(l, i), Ref_host(l, i), eps);
+        if (block_size >= BlkSize)
+          EXPECT_NEAR_KK(Y_host(l, i), X_host(l, i), eps);
+      }
+  }
+}
+}  // namespace TeamVectorPrec
+}  // namespace Test
+
+template <typename DeviceType, typename ValueType>
+int test_batched_teamvector_Prec() {
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT)
+  {
+    typedef Kokkos::View<ValueType **, Kokkos::LayoutLeft, DeviceType> ViewType;
+    typedef Kokkos::View<int *, Kokkos::LayoutLeft, DeviceType> IntView;
+    typedef Kokkos::View<ValueType **, Kokkos::LayoutLeft, DeviceType>
+        VectorViewType;
+    typedef Kokkos::View<ValueType ***, Kokkos::LayoutLeft, DeviceType>
+        BlocksViewType;
+
+    for (int i = 3; i < 10; ++i) {
+      Test::TeamVectorPrec::impl_test_batched_Prec<
+          DeviceType, ViewType, IntView, VectorViewType, BlocksViewType>(
+          1024, i, 2, i);
+      Test::TeamVectorPrec::impl_test_batched_Prec<
+          DeviceType, ViewType, IntView, VectorViewType, BlocksViewType>(
+          1024, i, 2, 2);
+    }
+  }
+#endif
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT)
+  {
+    typedef Kokkos::View<ValueType **, Kokkos::LayoutRight, DeviceType>
+        ViewType;
+    typedef Kokkos::View<int *, Kokkos::LayoutRight, DeviceType> IntView;
+    typedef Kokkos::View<ValueType **, Kokkos::LayoutRight, DeviceType>
+        VectorViewType;
+    typedef Kokkos::View<ValueType ***, Kokkos::LayoutRight, DeviceType>
+        BlocksViewType;
+
+    for (int i = 3; i < 10; ++i) {
+      Test::TeamVectorPrec::impl_test_batched_Prec<
+          DeviceType, ViewType, IntView, VectorViewType, BlocksViewType>(
+          1024, i, 2, i);
+      Test::TeamVectorPrec::impl_test_batched_Prec<
+          DeviceType, ViewType, IntView, VectorViewType, BlocksViewType>(
+          1024, i, 2, 3);
+    }
+  }
+#endif
+
+  return 0;
+}
@@ -19,6 +19,7 @@
 #include <KokkosKernels_config.h>
 #include <Kokkos_Core.hpp>
 #include <Kokkos_InnerProductSpaceTraits.hpp>
+#include <KokkosBlas_util.hpp>
 
 namespace KokkosBlas {
 namespace Impl {
@@ -36,7 +37,9 @@ struct DotFunctor {
   typedef SizeType size_type;
   typedef typename AV::non_const_value_type avalue_type;
   typedef Kokkos::Details::InnerProductSpaceTraits<avalue_type> IPT;
-  typedef typename IPT::dot_type value_type;
+  typedef typename IPT::dot_type dot_type;
+  // half_t and bhalf_t products are summed in float
+  typedef KokkosKernels::Impl::accumulation_scalar_t<dot_type> value_type;
 
   XVector m_x;
   YVector m_y;
@@ -46,14 +49,19 @@ struct DotFunctor {
   void run(const char* label, const execution_space& space, AV result) {
     Kokkos::RangePolicy<execution_space, size_type> policy(space, 0,
                                                            m_x.extent(0));
-    Kokkos::parallel_reduce(label, policy, *this, result);
+    reduce_with_accumulator(label, space, policy, *this, result);
   }
 
   // Prefer const size_type& to const size_type or size_type,
   // since the compiler has an easier time inlining the former.
   KOKKOS_FORCEINLINE_FUNCTION void operator()(const size_type& i,
                                               value_type& sum) const {
-    Kokkos::Details::updateDot(sum, m_x(i), m_y(i));  // sum += m_x(i) * m_y(i)
+    if constexpr (std::is_same_v<value_type, dot_type>) {
+      // sum += m_x(i) * m_y(i)
+      Kokkos::Details::updateDot(sum, m_x(i), m_y(i));
+    } else {
+      sum += static_cast<value_type>(m_x(i)) * static_cast<value_type>(m_y(i));
+    }
   }
 
   KOKKOS_INLINE_FUNCTION void init(value_type& update) const {
@@ -0,0 +1,276 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef KOKKOSBLAS1_FUSED_IMPL_HPP_
+#define KOKKOSBLAS1_FUSED_IMPL_HPP_
+
+#include "Kokkos_Core.hpp"
+#include "Kokkos_ArithTraits.hpp"
+#include "Kokkos_InnerProductSpaceTraits.hpp"
+
+namespace KokkosBlas {
+namespace Impl {
+
+// Each operation below acts on entry i of its vectors only, so applying all
+// of them, in order, to one entry at a time gives the same result as
+// applying them one after the other to the whole vectors. Reductions add
+// into result slot Slot of the accumulator.
+
+/// y(i) := alpha*x(i) + beta*y(i), as axpby
+template <class XVector, class YVector>
+struct FusedAxpbyOp {
+  using scalar_type = typename YVector::non_const_value_type;
+  static constexpr int num_results = 0;
+
+  scalar_type alpha;
+  XVector x;
+  scalar_type beta;
+  YVector y;
+
+  size_t extent() const { return y.extent(0); }
+  bool extents_match(const size_t n) const { return x.extent(0) == n; }
+
+  template <class Accum>
+  KOKKOS_INLINE_FUNCTION void apply(const size_t i, Accum) const {
+    // y is not read when beta is zero, as in axpby
+    if (beta == Kokkos::ArithTraits<scalar_type>::zero())
+      y(i) = alpha * x(i);
+    else
+      y(i) = alpha * x(i) + beta * y(i);
+  }
+
+  template <class Accum>
+  void finalize(const Accum) const {}
+};
+
+/// z(i) := alpha*x(i) + beta*y(i) + gamma*z(i), as update
+template <class XVector, class YVector, class ZVector>
+struct FusedUpdateOp {
+  using scalar_type = typename ZVector::non_const_value_type;
+  static constexpr int num_results = 0;
+
+  scalar_type alpha;
+  XVector x;
+  scalar_type beta;
+  YVector y;
+  scalar_type gamma;
+  ZVector z;
+
+  size_t extent() const { return z.extent(0); }
+  bool extents_match(const size_t n) const {
+    return x.extent(0) == n && y.extent(0) == n;
+  }
+
+  template <class Accum>
+  KOKKOS_INLINE_FUNCTION void apply(const size_t i, Accum) const {
+    // z is not read when gamma is zero, as in update
+    scalar_type val = alpha * x(i) + beta * y(i);
+    if (gamma != Kokkos::ArithTraits<scalar_type>::zero()) val += gamma * z(i);
+    z(i) = val;
+  }
+
+  template <class Accum>
+  void finalize(const Accum) const {}
+};
+
+/// r(i) := alpha*x(i), as scal
+template <class RVector, class XVector>
+struct FusedScalOp {
+  using scalar_type = typename RVector::non_const_value_type;
+  static constexpr int num_results = 0;
+
+  RVector r;
+  scalar_type alpha;
+  XVector x;
+
+  size_t extent() const { return r.extent(0); }
+  bool extents_match(const size_t n) const { return x.extent(0) == n; }
+
+  template <class Accum>
+  KOKKOS_INLINE_FUNCTION void apply(const size_t i, Accum) const {
+    r(i) = alpha * x(i);
+  }
+
+  template <class Accum>
+  void finalize(const Accum) const {}
+};
+
+/// result := dot(x, y), as dot. result points to host memory and is only
+/// written by finalize.
+template <class XVector, class YVector, int Slot>
+struct FusedDotOp {
+  using scalar_type = typename XVector::non_const_value_type;
+  using IPT         = Kokkos::Details::InnerProductSpaceTraits<scalar_type>;
+  using dot_type    = typename IPT::dot_type;
+  static constexpr int num_results = 1;
+
+  XVector x;
+  YVector y;
+  dot_type* result;
+
+  size_t extent() const { return x.extent(0); }
+  bool extents_match(const size_t n) const { return y.extent(0) == n; }
+
+  template <class Accum>
+  KOKKOS_INLINE_FUNCTION void apply(const size_t i, Accum sums) const {
+    sums[Slot] += IPT::dot(x(i), y(i));
+  }
+
+  template <class Accum>
+  void finalize(const Accum sums) const {
+    *result = sums[Slot];
+  }
+};
+
+/// result := nrm2(x), as nrm2. result points to host memory and is only
+/// written by finalize.
+template <class XVector, int Slot>
+struct FusedNrm2Op {
+  using scalar_type = typename XVector::non_const_value_type;
+  using IPT         = Kokkos::Details::InnerProductSpaceTraits<scalar_type>;
+  using mag_type    = typename Kokkos::ArithTraits<scalar_type>::mag_type;
+  static constexpr int num_results = 1;
+
+  XVector x;
+  mag_type* result;
+
+  size_t extent() const { return x.extent(0); }
+  bool extents_match(const size_t) const { return true; }
+
+  template <class Accum>
+  KOKKOS_INLINE_FUNCTION void apply(const size_t i, Accum sums) const {
+    sums[Slot] += IPT::dot(x(i), x(i));
+  }
+
+  template <class Accum>
+  void finalize(const Accum sums) const {
+    using dot_type = typename IPT::dot_type;
+    *result        = Kokkos::ArithTraits<mag_type>::sqrt(
+        Kokkos::ArithTraits<dot_type>::real(sums[Slot]));
+  }
+};
+
+/// The empty sequence of operations
+struct FusedEmptyChain {
+  using scalar_type = void;
+  static constexpr int num_results = 0;
+
+  bool extents_match(const size_t) const { return true; }
+
+  template <class Accum>
+  KOKKOS_INLINE_FUNCTION void apply(const size_t, Accum) const {}
+
+  template <class Accum>
+  void finalize(const Accum) const {}
+};
+
+/// The operations of Prev followed by Op. All of them must work on the same
+/// scalar type, so that the reductions share one accumulator array.
+template <class Prev, class Op>
+struct FusedChain {
+  using scalar_type =
+      typename std::conditional<std::is_void<typename Prev::scalar_type>::value,
+                                typename Op::scalar_type,
+                                typename Prev::scalar_type>::type;
+  static_assert(std::is_same<scalar_type, typename Op::scalar_type>::value,
+                "KokkosBlas::fused_blas1: all the vectors must have the same "
+                "scalar type.");
+  static constexpr int num_results = Prev::num_results + Op::num_results;
+
+  Prev prev;
+  Op op;
+
+  bool extents_match(const size_t n) const {
+    return prev.extents_match(n) && op.extent() == n && op.extents_match(n);
+  }
+
+  template <class Accum>
+  KOKKOS_INLINE_FUNCTION void apply(const size_t i, Accum sums) const {
+    prev.apply(i, sums);
+    op.apply(i, sums);
+  }
+
+  template <class Accum>
+  void finalize(const Accum sums) const {
+    prev.finalize(sums);
+    op.finalize(sums);
+  }
+};
+
+/// Runs the whole chain over the entries with a single parallel_for: chains
+/// without reductions
+template <class Chain>
+struct FusedBlas1ForFunctor {
+  Chain chain;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const size_t i) const {
+    chain.apply(i, static_cast<int*>(nullptr));
+  }
+};
+
+/// Runs the whole chain over the entries with a single parallel_reduce, with
+/// an array result holding the sum of each reduction
+template <class Chain>
+struct FusedBlas1ReduceFunctor {
+  using dot_type = typename Kokkos::Details::InnerProductSpaceTraits<
+      typename Chain::scalar_type>::dot_type;
+
+  typedef dot_type value_type[];
+  int value_count;  // Kokkos needs this for reductions w/ array results
+
+  Chain chain;
+
+  FusedBlas1ReduceFunctor(const Chain& chain_)
+      : value_count(Chain::num_results), chain(chain_) {}
+
+  KOKKOS_INLINE_FUNCTION void init(value_type sums) const {
+    for (int j = 0; j < value_count; ++j)
+      sums[j] = Kokkos::ArithTraits<dot_type>::zero();
+  }
+
+  KOKKOS_INLINE_FUNCTION void join(value_type dst, const value_type src) const {
+    for (int j = 0; j < value_count; ++j) dst[j] += src[j];
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const size_t i,
+                                         value_type sums) const {
+    chain.apply(i, sums);
+  }
+};
+
+template <class ExecSpace, class Chain>
+void impl_fused_blas1(const ExecSpace& space, const Chain& chain,
+                      const size_t n) {
+  if constexpr (Chain::num_results == 0) {
+    Kokkos::parallel_for("KokkosBlas::fused_blas1",
+                         Kokkos::RangePolicy<ExecSpace, size_t>(space, 0, n),
+                         FusedBlas1ForFunctor<Chain>{chain});
+  } else {
+    using functor_type = FusedBlas1ReduceFunctor<Chain>;
+    typename functor_type::dot_type sums[Chain::num_results];
+    Kokkos::View<typename functor_type::dot_type*, Kokkos::HostSpace,
+                 Kokkos::MemoryTraits<Kokkos::Unmanaged> >
+        sums_view(sums, Chain::num_results);
+    Kokkos::parallel_reduce("KokkosBlas::fused_blas1",
+                            Kokkos::RangePolicy<ExecSpace, size_t>(space, 0, n),
+                            functor_type(chain), sums_view);
+    chain.finalize(static_cast<const typename functor_type::dot_type*>(sums));
+  }
+}
+
+}  // namespace Impl
+}  // namespace KokkosBlas
+
+#endif  // KOKKOSBLAS1_FUSED_IMPL_HPP_
@@ -0,0 +1,115 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef KOKKOSBLAS1_MULTI_DOT_IMPL_HPP_
+#define KOKKOSBLAS1_MULTI_DOT_IMPL_HPP_
+
+#include "Kokkos_Core.hpp"
+#include "Kokkos_ArithTraits.hpp"
+#include "Kokkos_InnerProductSpaceTraits.hpp"
+#include "KokkosKernels_ExecSpaceUtils.hpp"
+#include "KokkosBlas2_gemv.hpp"
+
+namespace KokkosBlas {
+namespace Impl {
+
+/// r(j) += sum_i op(X(i, j)) * y(i), op being conj or the identity.
+///
+/// Each team takes a block of rows_per_team rows, copies that block of y to
+/// scratch and then reduces it against every column of X, adding the sums to
+/// r with atomics. y is read from global memory once in all, instead of once
+/// per column, and the threads of a team read X down a column.
+template <class ExecSpace, class RV, class XMV, class YV>
+struct MultiDotFunctor {
+  using scalar_type   = typename XMV::non_const_value_type;
+  using dot_type      = typename RV::non_const_value_type;
+  using y_scalar_type = typename YV::non_const_value_type;
+  using AT            = Kokkos::ArithTraits<scalar_type>;
+  using team_member   = typename Kokkos::TeamPolicy<ExecSpace>::member_type;
+  using y_scratch_type =
+      Kokkos::View<y_scalar_type*, typename ExecSpace::scratch_memory_space,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >;
+
+  MultiDotFunctor(const bool conj_, const int rows_per_team_, const RV& r_,
+                  const XMV& X_, const YV& y_)
+      : conj(conj_), rows_per_team(rows_per_team_), r(r_), X(X_), y(y_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const team_member& t) const {
+    const int row0  = t.league_rank() * rows_per_team;
+    const int nrows = Kokkos::min(rows_per_team, int(X.extent(0)) - row0);
+    const int ncols = X.extent(1);
+    y_scratch_type y_s(t.team_scratch(0), rows_per_team);
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(t, nrows),
+                         [&](const int i) { y_s(i) = y(row0 + i); });
+    t.team_barrier();
+    for (int j = 0; j < ncols; j++) {
+      dot_type sum = Kokkos::ArithTraits<dot_type>::zero();
+      Kokkos::parallel_reduce(
+          Kokkos::TeamThreadRange(t, nrows),
+          [&](const int i, dot_type& update) {
+            const scalar_type x = X(row0 + i, j);
+            update += (conj ? AT::conj(x) : x) * y_s(i);
+          },
+          sum);
+      Kokkos::single(Kokkos::PerTeam(t),
+                     [&]() { Kokkos::atomic_add(&r(j), sum); });
+    }
+  }
+
+  bool conj;
+  int rows_per_team;
+  RV r;
+  XMV X;
+  YV y;
+};
+
+/// \brief r := op(X)^T * y, see KokkosBlas::multi_dot.
+///
+/// GPUs with a column-major X get MultiDotFunctor. Elsewhere gemv is the
+/// better kernel: on the host it is usually a TPL BLAS call, and for a
+/// LayoutRight X the threads of a team would not read X contiguously.
+template <class ExecSpace, class RV, class XMV, class YV>
+void impl_multi_dot(const ExecSpace& space, const bool conj, const RV& r,
+                    const XMV& X, const YV& y) {
+  using dot_type = typename RV::non_const_value_type;
+  constexpr bool use_tiled =
+      KokkosKernels::Impl::kk_is_gpu_exec_space<ExecSpace>() &&
+      std::is_same<typename XMV::array_layout, Kokkos::LayoutLeft>::value;
+  if constexpr (!use_tiled) {
+    KokkosBlas::gemv(space, conj ? "C" : "T",
+                     Kokkos::ArithTraits<dot_type>::one(), X, y,
+                     Kokkos::ArithTraits<dot_type>::zero(), r);
+  } else {
+    using functor_type = MultiDotFunctor<ExecSpace, RV, XMV, YV>;
+    // 1024 entries of y keep the scratch well below the 48 kB a team can
+    // have on all the GPUs we run on
+    constexpr int rows_per_team = 1024;
+    Kokkos::deep_copy(space, r, Kokkos::ArithTraits<dot_type>::zero());
+    const int nrows = X.extent(0);
+    if (nrows == 0 || X.extent(1) == 0) return;
+    const int league_size = (nrows + rows_per_team - 1) / rows_per_team;
+    Kokkos::TeamPolicy<ExecSpace> policy(space, league_size, Kokkos::AUTO);
+    policy.set_scratch_size(
+        0, Kokkos::PerTeam(
+               functor_type::y_scratch_type::shmem_size(rows_per_team)));
+    Kokkos::parallel_for("KokkosBlas::multi_dot[tiled]", policy,
+                         functor_type(conj, rows_per_team, r, X, y));
+  }
+}
+
+}  // namespace Impl
+}  // namespace KokkosBlas
+
+#endif  // KOKKOSBLAS1_MULTI_DOT_IMPL_HPP_
@@ -56,6 +56,19 @@ struct nrm1_eti_spec_avail {
                    Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                  \
       1> {                                                                     \
     enum : bool { value = true };                                              \
+  };                                                                           \
+  template <>                                                                  \
+  struct nrm1_eti_spec_avail<                                                  \
+      EXEC_SPACE,                                                              \
+      Kokkos::View<                                                            \
+          typename Kokkos::Details::InnerProductSpaceTraits<SCALAR>::mag_type, \
+          LAYOUT, Kokkos::Device<EXEC_SPACE, MEM_SPACE>,                       \
+          Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                           \
+      Kokkos::View<const SCALAR*, LAYOUT,                                      \
+                   Kokkos::Device<EXEC_SPACE, MEM_SPACE>,                      \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                  \
+      1> {                                                                     \
+    enum : bool { value = true };                                              \
   };
 
 //
@@ -222,6 +235,16 @@ struct Nrm1<execution_space, RV, XMV, 2, false,
       Kokkos::View<const SCALAR*, LAYOUT,                                      \
                    Kokkos::Device<EXEC_SPACE, MEM_SPACE>,                      \
                    Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                  \
+      1, false, true>;                                                         \
+  extern template struct Nrm1<                                                 \
+      EXEC_SPACE,                                                              \
+      Kokkos::View<                                                            \
+          typename Kokkos::Details::InnerProductSpaceTraits<SCALAR>::mag_type, \
+          LAYOUT, Kokkos::Device<EXEC_SPACE, MEM_SPACE>,                       \
+          Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                           \
+      Kokkos::View<const SCALAR*, LAYOUT,                                      \
+                   Kokkos::Device<EXEC_SPACE, MEM_SPACE>,                      \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                  \
       1, false, true>;
 
 //
@@ -239,6 +262,16 @@ struct Nrm1<execution_space, RV, XMV, 2, false,
       Kokkos::View<const SCALAR*, LAYOUT,                                      \
                    Kokkos::Device<EXEC_SPACE, MEM_SPACE>,                      \
                    Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                  \
+      1, false, true>;                                                         \
+  template struct Nrm1<                                                        \
+      EXEC_SPACE,                                                              \
+      Kokkos::View<                                                            \
+          typename Kokkos::Details::InnerProductSpaceTraits<SCALAR>::mag_type, \
+          LAYOUT, Kokkos::Device<EXEC_SPACE, MEM_SPACE>,                       \
+          Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                           \
+      Kokkos::View<const SCALAR*, LAYOUT,                                      \
+                   Kokkos::Device<EXEC_SPACE, MEM_SPACE>,                      \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                  \
       1, false, true>;
 
 //
@@ -38,8 +38,10 @@ struct V_Nrm2_Functor {
   typedef SizeType size_type;
   typedef typename XV::non_const_value_type xvalue_type;
   typedef Kokkos::Details::InnerProductSpaceTraits<xvalue_type> IPT;
-  typedef Kokkos::ArithTraits<typename IPT::mag_type> AT;
-  typedef typename IPT::mag_type value_type;
+  // half_t and bhalf_t squares are summed in float
+  typedef KokkosKernels::Impl::accumulation_scalar_t<typename IPT::mag_type>
+      value_type;
+  typedef Kokkos::ArithTraits<value_type> AT;
 
   typename XV::const_type m_x;
   bool m_take_sqrt;
@@ -63,7 +65,7 @@ struct V_Nrm2_Functor {
 
   KOKKOS_INLINE_FUNCTION
   void operator()(const size_type& i, value_type& sum) const {
-    const typename IPT::mag_type tmp = IPT::norm(m_x(i));
+    const value_type tmp = static_cast<value_type>(IPT::norm(m_x(i)));
     sum += tmp * tmp;
   }
 
@@ -77,9 +79,7 @@ struct V_Nrm2_Functor {
   }
 
   KOKKOS_INLINE_FUNCTION void final(value_type& update) const {
-    if (m_take_sqrt)
-      update =
-          Kokkos::ArithTraits<typename RV::non_const_value_type>::sqrt(update);
+    if (m_take_sqrt) update = AT::sqrt(update);
   }
 };
 
@@ -143,7 +143,7 @@ void V_Nrm2_Invoke(const execution_space& space, const RV& r, const XV& X,
 
   using functor_type = V_Nrm2_Functor<RV, XV, SizeType>;
   functor_type op(X, take_sqrt);
-  Kokkos::parallel_reduce("KokkosBlas::Nrm2::S0", policy, op, r);
+  reduce_with_accumulator("KokkosBlas::Nrm2::S0", space, policy, op, r);
 }
 
 /// \brief Compute the 2-norms (or their square) of the columns of the
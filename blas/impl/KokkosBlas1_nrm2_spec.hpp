@@ -56,6 +56,19 @@ struct nrm2_eti_spec_avail {
                    Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                  \
       1> {                                                                     \
     enum : bool { value = true };                                              \
+  };                                                                           \
+  template <>                                                                  \
+  struct nrm2_eti_spec_avail<                                                  \
+      EXEC_SPACE,                                                              \
+      Kokkos::View<                                                            \
+          typename Kokkos::Details::InnerProductSpaceTraits<SCALAR>::mag_type, \
+          LAYOUT, Kokkos::Device<EXEC_SPACE, MEM_SPACE>,                       \
+          Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                           \
+      Kokkos::View<const SCALAR*, LAYOUT,                                      \
+                   Kokkos::Device<EXEC_SPACE, MEM_SPACE>,                      \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                  \
+      1> {                                                                     \
+    enum : bool { value = true };                                              \
   };
 
 //
@@ -227,6 +240,16 @@ struct Nrm2<execution_space, RV, XMV, 2, false,
       Kokkos::View<const SCALAR*, LAYOUT,                                      \
                    Kokkos::Device<EXEC_SPACE, MEM_SPACE>,                      \
                    Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                  \
+      1, false, true>;                                                         \
+  extern template struct Nrm2<                                                 \
+      EXEC_SPACE,                                                              \
+      Kokkos::View<                                                            \
+          typename Kokkos::Details::InnerProductSpaceTraits<SCALAR>::mag_type, \
+          LAYOUT, Kokkos::Device<EXEC_SPACE, MEM_SPACE>,                       \
+          Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                           \
+      Kokkos::View<const SCALAR*, LAYOUT,                                      \
+                   Kokkos::Device<EXEC_SPACE, MEM_SPACE>,                      \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                  \
       1, false, true>;
 
 //
@@ -244,6 +267,16 @@ struct Nrm2<execution_space, RV, XMV, 2, false,
       Kokkos::View<const SCALAR*, LAYOUT,                                      \
                    Kokkos::Device<EXEC_SPACE, MEM_SPACE>,                      \
                    Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                  \
+      1, false, true>;                                                         \
+  template struct Nrm2<                                                        \
+      EXEC_SPACE,                                                              \
+      Kokkos::View<                                                            \
+          typename Kokkos::Details::InnerProductSpaceTraits<SCALAR>::mag_type, \
+          LAYOUT, Kokkos::Device<EXEC_SPACE, MEM_SPACE>,                       \
+          Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                           \
+      Kokkos::View<const SCALAR*, LAYOUT,                                      \
+                   Kokkos::Device<EXEC_SPACE, MEM_SPACE>,                      \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                  \
       1, false, true>;
 
 //
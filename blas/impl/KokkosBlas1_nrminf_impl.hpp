@@ -60,6 +60,16 @@ struct V_NrmInf_Functor {
                   "RV must have rank 0 and XV must have rank 1.");
   }
 
+  // Norms are nonnegative, so zero is the identity of the max reduction.
+  // Reducing with the functor's own init and join, rather than Kokkos::Max,
+  // lets the result go straight to r wherever it lives.
+  KOKKOS_INLINE_FUNCTION void init(value_type& max) const { max = AT::zero(); }
+
+  KOKKOS_INLINE_FUNCTION void join(value_type& max,
+                                   const value_type& src) const {
+    if (src > max) max = src;
+  }
+
   KOKKOS_INLINE_FUNCTION
   void operator()(const size_type& i, value_type& max) const {
     value_type val = IPT::norm(m_x(i));
@@ -71,22 +81,12 @@ struct V_NrmInf_Functor {
 ///   View) X, and store the result in the 0-D View r.
 template <class execution_space, class RV, class XV, class SizeType>
 void V_NrmInf_Invoke(const execution_space& space, const RV& r, const XV& X) {
-  typedef Kokkos::ArithTraits<typename RV::non_const_value_type> AT;
-
   const SizeType numRows = static_cast<SizeType>(X.extent(0));
-
-  // Avoid Max Reduction if this is a zero length view
-  if (numRows == 0) {
-    Kokkos::deep_copy(r, AT::zero());
-    return;
-  }
-
   Kokkos::RangePolicy<execution_space, SizeType> policy(space, 0, numRows);
 
   typedef V_NrmInf_Functor<RV, XV, SizeType> functor_type;
   functor_type op(X);
-  Kokkos::parallel_reduce("KokkosBlas::NrmInf::S0", policy, op,
-                          Kokkos::Max<typename RV::non_const_value_type>(r()));
+  Kokkos::parallel_reduce("KokkosBlas::NrmInf::S0", policy, op, r);
 }
 
 /// \brief Compute the 2-norms (or their square) of the columns of the
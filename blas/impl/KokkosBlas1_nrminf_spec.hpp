@@ -57,6 +57,19 @@ struct nrminf_eti_spec_avail {
                    Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                  \
       1> {                                                                     \
     enum : bool { value = true };                                              \
+  };                                                                           \
+  template <>                                                                  \
+  struct nrminf_eti_spec_avail<                                                \
+      EXEC_SPACE,                                                              \
+      Kokkos::View<                                                            \
+          typename Kokkos::Details::InnerProductSpaceTraits<SCALAR>::mag_type, \
+          LAYOUT, Kokkos::Device<EXEC_SPACE, MEM_SPACE>,                       \
+          Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                           \
+      Kokkos::View<const SCALAR*, LAYOUT,                                      \
+                   Kokkos::Device<EXEC_SPACE, MEM_SPACE>,                      \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                  \
+      1> {                                                                     \
+    enum : bool { value = true };                                              \
   };
 
 //
@@ -212,6 +225,16 @@ struct NrmInf<execution_space, RV, XMV, 2, false,
       Kokkos::View<const SCALAR*, LAYOUT,                                      \
                    Kokkos::Device<EXEC_SPACE, MEM_SPACE>,                      \
                    Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                  \
+      1, false, true>;                                                         \
+  extern template struct NrmInf<                                               \
+      EXEC_SPACE,                                                              \
+      Kokkos::View<                                                            \
+          typename Kokkos::Details::InnerProductSpaceTraits<SCALAR>::mag_type, \
+          LAYOUT, Kokkos::Device<EXEC_SPACE, MEM_SPACE>,                       \
+          Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                           \
+      Kokkos::View<const SCALAR*, LAYOUT,                                      \
+                   Kokkos::Device<EXEC_SPACE, MEM_SPACE>,                      \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                  \
       1, false, true>;
 
 //
@@ -230,6 +253,16 @@ struct NrmInf<execution_space, RV, XMV, 2, false,
       Kokkos::View<const SCALAR*, LAYOUT,                                      \
                    Kokkos::Device<EXEC_SPACE, MEM_SPACE>,                      \
                    Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                  \
+      1, false, true>;                                                         \
+  template struct NrmInf<                                                      \
+      EXEC_SPACE,                                                              \
+      Kokkos::View<                                                            \
+          typename Kokkos::Details::InnerProductSpaceTraits<SCALAR>::mag_type, \
+          LAYOUT, Kokkos::Device<EXEC_SPACE, MEM_SPACE>,                       \
+          Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                           \
+      Kokkos::View<const SCALAR*, LAYOUT,                                      \
+                   Kokkos::Device<EXEC_SPACE, MEM_SPACE>,                      \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                  \
       1, false, true>;
 
 //
@@ -54,6 +54,17 @@ struct sum_eti_spec_avail {
                    Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                 \
       1> {                                                                    \
     enum : bool { value = true };                                             \
+  };                                                                          \
+  template <>                                                                 \
+  struct sum_eti_spec_avail<                                                  \
+      EXEC_SPACE,                                                             \
+      Kokkos::View<SCALAR, LAYOUT, Kokkos::Device<EXEC_SPACE, MEM_SPACE>,     \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                 \
+      Kokkos::View<const SCALAR*, LAYOUT,                                     \
+                   Kokkos::Device<EXEC_SPACE, MEM_SPACE>,                     \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                 \
+      1> {                                                                    \
+    enum : bool { value = true };                                             \
   };
 
 //
@@ -217,6 +228,14 @@ struct Sum<execution_space, RV, XMV, 2, false,
       Kokkos::View<const SCALAR*, LAYOUT,                                    \
                    Kokkos::Device<EXEC_SPACE, MEM_SPACE>,                    \
                    Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                \
+      1, false, true>;                                                       \
+  extern template struct Sum<                                                \
+      EXEC_SPACE,                                                            \
+      Kokkos::View<SCALAR, LAYOUT, Kokkos::Device<EXEC_SPACE, MEM_SPACE>,    \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                \
+      Kokkos::View<const SCALAR*, LAYOUT,                                    \
+                   Kokkos::Device<EXEC_SPACE, MEM_SPACE>,                    \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                \
       1, false, true>;
 
 //
@@ -231,7 +250,15 @@ struct Sum<execution_space, RV, XMV, 2, false,
                       Kokkos::View<const SCALAR*, LAYOUT,                     \
                                    Kokkos::Device<EXEC_SPACE, MEM_SPACE>,     \
                                    Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
-                      1, false, true>;
+                      1, false, true>;                                        \
+  template struct Sum<                                                        \
+      EXEC_SPACE,                                                             \
+      Kokkos::View<SCALAR, LAYOUT, Kokkos::Device<EXEC_SPACE, MEM_SPACE>,     \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                 \
+      Kokkos::View<const SCALAR*, LAYOUT,                                     \
+                   Kokkos::Device<EXEC_SPACE, MEM_SPACE>,                     \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                 \
+      1, false, true>;
 
 //
 // Macro for declaration of full specialization of
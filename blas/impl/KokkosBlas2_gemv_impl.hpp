@@ -20,6 +20,7 @@
 #include "Kokkos_Core.hpp"
 #include "KokkosKernels_ExecSpaceUtils.hpp"
 #include "Kokkos_ArithTraits.hpp"
+#include "KokkosBlas_util.hpp"
 
 namespace KokkosBlas {
 namespace Impl {
@@ -633,6 +634,116 @@ struct TwoLevelTransposeGEMV {
   YViewType y_;
 };
 
+// Functor for the (conjugate) transpose GEMV of a tall and skinny A, such as
+// a Krylov basis. TwoLevelTransposeGEMV would launch only A.extent(1) teams,
+// so instead the rows are split in blocks and the reduction is done in two
+// levels: each team writes the partial sums of its block for all the columns
+// to partials (TallSkinnyGEMV_PartialTag), then one thread per column adds
+// them up and updates y (TallSkinnyGEMV_FinalTag).
+struct TallSkinnyGEMV_PartialTag {};
+struct TallSkinnyGEMV_FinalTag {};
+
+template <class ExecutionSpace, class AViewType, class XViewType,
+          class YViewType, const bool conj,
+          class IndexType = typename AViewType::size_type>
+struct TallSkinnyTransposeGEMV {
+  using y_value_type   = typename YViewType::non_const_value_type;
+  using AlphaCoeffType = typename AViewType::non_const_value_type;
+  using BetaCoeffType  = typename YViewType::non_const_value_type;
+  using AccumScalar    = typename std::conditional<
+      std::is_same<y_value_type, Kokkos::Experimental::half_t>::value ||
+          std::is_same<y_value_type, Kokkos::Experimental::bhalf_t>::value,
+      float, y_value_type>::type;
+  using partials_type =
+      Kokkos::View<AccumScalar**, Kokkos::LayoutRight,
+                   typename ExecutionSpace::memory_space>;
+
+  using member_type =
+      typename Kokkos::TeamPolicy<ExecutionSpace,
+                                  TallSkinnyGEMV_PartialTag>::member_type;
+
+  TallSkinnyTransposeGEMV(const AlphaCoeffType& alpha, const AViewType& A,
+                          const XViewType& x, const BetaCoeffType& beta,
+                          const YViewType& y, const partials_type& partials)
+      : alpha_(alpha),
+        A_(A),
+        x_(x),
+        beta_(beta),
+        y_(y),
+        partials_(partials),
+        rowsPerTeam_((A.extent(0) + partials.extent(0) - 1) /
+                     partials.extent(0)) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(TallSkinnyGEMV_PartialTag,
+                                         const member_type& team) const {
+    using KAT_A = Kokkos::ArithTraits<typename AViewType::non_const_value_type>;
+    const IndexType begin = team.league_rank() * rowsPerTeam_;
+    const IndexType end =
+        Kokkos::min(begin + rowsPerTeam_, static_cast<IndexType>(A_.extent(0)));
+    for (IndexType j = 0; j < static_cast<IndexType>(A_.extent(1)); j++) {
+      AccumScalar val;
+      Kokkos::parallel_reduce(
+          Kokkos::TeamThreadRange(team, begin, end),
+          [&](const IndexType i, AccumScalar& update) {
+            const auto A_ij = conj ? KAT_A::conj(A_(i, j)) : A_(i, j);
+            update += AccumScalar(A_ij) * x_(i);
+          },
+          val);
+      Kokkos::single(Kokkos::PerTeam(team),
+                     [&]() { partials_(team.league_rank(), j) = val; });
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(TallSkinnyGEMV_FinalTag,
+                                         const IndexType j) const {
+    using KAT_Y = Kokkos::ArithTraits<typename YViewType::non_const_value_type>;
+    AccumScalar val = Kokkos::ArithTraits<AccumScalar>::zero();
+    for (IndexType t = 0; t < static_cast<IndexType>(partials_.extent(0)); t++)
+      val += partials_(t, j);
+    if (beta_ == KAT_Y::zero())
+      y_(j) = y_value_type(alpha_ * val);
+    else
+      y_(j) = y_value_type(beta_ * AccumScalar(y_(j)) + alpha_ * val);
+  }
+
+ private:
+  AlphaCoeffType alpha_;
+  typename AViewType::const_type A_;
+  typename XViewType::const_type x_;
+  BetaCoeffType beta_;
+  YViewType y_;
+  partials_type partials_;
+  IndexType rowsPerTeam_;
+};
+
+// Transpose GEMV of a tall and skinny A with TallSkinnyTransposeGEMV.
+template <class ExecutionSpace, class AViewType, class XViewType,
+          class YViewType, const bool conj, class IndexType>
+void tallSkinnyTransposeGemv(const ExecutionSpace& space,
+                             typename AViewType::const_value_type& alpha,
+                             const AViewType& A, const XViewType& x,
+                             typename YViewType::const_value_type& beta,
+                             const YViewType& y, const IndexType numTeams) {
+  using functor_type =
+      TallSkinnyTransposeGEMV<ExecutionSpace, AViewType, XViewType, YViewType,
+                              conj, IndexType>;
+  typename functor_type::partials_type partials(
+      Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                         "KokkosBlas::gemv::partials"),
+      numTeams, A.extent(1));
+  functor_type functor(alpha, A, x, beta, y, partials);
+  Kokkos::parallel_for(
+      "KokkosBlas::gemv[tallSkinnyTranspose]",
+      Kokkos::TeamPolicy<ExecutionSpace, TallSkinnyGEMV_PartialTag>(
+          space, numTeams, Kokkos::AUTO),
+      functor);
+  Kokkos::parallel_for(
+      "KokkosBlas::gemv[tallSkinnyTranspose]",
+      Kokkos::RangePolicy<ExecutionSpace, TallSkinnyGEMV_FinalTag, IndexType>(
+          space, 0, A.extent(1)),
+      functor);
+}
+
 // Two-level parallel version of GEMV.
 template <class ExecutionSpace, class AViewType, class XViewType,
           class YViewType, class IndexType = typename AViewType::size_type>
@@ -739,8 +850,25 @@ void twoLevelGemv(const ExecutionSpace& space, const char trans[],
     if (alpha == KAT::zero() && beta == KAT::zero()) {
       // Fill y with zeros
       Kokkos::deep_copy(y, Kokkos::ArithTraits<y_value_type>::zero());
+      return;
     } else if (alpha == KAT::zero() && beta == KAT::one()) {
       // Do nothing (y := 1 * y)
+      return;
+    }
+    // A with a few columns (a Krylov basis, say) and enough rows to keep
+    // more teams busy than there are columns: split the rows over the teams
+    constexpr IndexType tallSkinnyMaxCols = 64;
+    IndexType numTeams                    = 1;
+    multipleReductionWorkDistribution<ExecutionSpace, IndexType>(
+        A.extent(0) * A.extent(1), 1, numTeams);
+    const bool tallSkinny =
+        A.extent(1) <= tallSkinnyMaxCols && numTeams > A.extent(1);
+    if (tallSkinny && tr == 'T') {
+      tallSkinnyTransposeGemv<ExecutionSpace, AViewType, XViewType, YViewType,
+                              false>(space, alpha, A, x, beta, y, numTeams);
+    } else if (tallSkinny) {
+      tallSkinnyTransposeGemv<ExecutionSpace, AViewType, XViewType, YViewType,
+                              true>(space, alpha, A, x, beta, y, numTeams);
     } else if (tr == 'T') {
       // transpose, and not conj transpose
       team_policy_type team(space, A.extent(1), Kokkos::AUTO);
@@ -0,0 +1,140 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef KOKKOSBLAS2_SYMV_IMPL_HPP_
+#define KOKKOSBLAS2_SYMV_IMPL_HPP_
+
+#include "KokkosKernels_config.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_ArithTraits.hpp"
+
+namespace KokkosBlas {
+namespace Impl {
+
+struct SymvScaleTag {};
+struct SymvTileTag {};
+
+/// \brief Native symmetric (symv) and Hermitian (hemv) matrix-vector
+/// multiply, y := beta*y + alpha*A*x, with only the uplo triangle of the
+/// N-by-N matrix A referenced.
+///
+/// y is scaled by beta first (SymvScaleTag). A is then cut into TILE x TILE
+/// tiles and only those of the lower triangle of tiles are visited, one team
+/// per tile (SymvTileTag): an off-diagonal tile (I, J) adds A_IJ*x_J to y_I
+/// and op(A_IJ)^T*x_I to y_J, so each stored entry is read from memory once.
+/// Tiles add to y with atomics.
+template <class ExecSpace, class AViewType, class XViewType, class YViewType>
+struct SymvFunctor {
+  using ScalarY     = typename YViewType::non_const_value_type;
+  using AT          = Kokkos::ArithTraits<ScalarY>;
+  using team_member = typename Kokkos::TeamPolicy<ExecSpace>::member_type;
+
+  static constexpr int TILE = 32;
+
+  SymvFunctor(const char uplo[], const bool hermitian_, const ScalarY& alpha_,
+              const AViewType& A_, const XViewType& x_, const ScalarY& beta_,
+              const YViewType& y_)
+      : lower(uplo[0] == 'L' || uplo[0] == 'l'),
+        hermitian(hermitian_),
+        N(A_.extent(0)),
+        alpha(alpha_),
+        beta(beta_),
+        A(A_),
+        x(x_),
+        y(y_) {}
+
+  static int num_tiles(const int n) {
+    const int nt = (n + TILE - 1) / TILE;
+    return nt * (nt + 1) / 2;
+  }
+
+  // A(i, j), read from the stored triangle
+  KOKKOS_INLINE_FUNCTION ScalarY entry(const int i, const int j) const {
+    if (i == j)
+      return hermitian ? ScalarY(AT::real(A(i, i))) : ScalarY(A(i, i));
+    if (lower == (i > j)) return A(i, j);
+    return hermitian ? AT::conj(ScalarY(A(j, i))) : ScalarY(A(j, i));
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(SymvScaleTag, const int i) const {
+    // y is not read when beta is zero, so that NaNs in y don't propagate
+    y(i) = beta == AT::zero() ? AT::zero() : ScalarY(beta * y(i));
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(SymvTileTag,
+                                         const team_member& t) const {
+    // (ti, tj), ti >= tj, is the t-th tile of the packed lower triangle; the
+    // floating point guess is corrected for rounding
+    const int p = t.league_rank();
+    int ti      = static_cast<int>((Kokkos::sqrt(8.0 * p + 1.0) - 1.0) / 2.0);
+    while (ti * (ti + 1) / 2 > p) --ti;
+    while ((ti + 1) * (ti + 2) / 2 <= p) ++ti;
+    const int tj   = p - ti * (ti + 1) / 2;
+    const int r0   = ti * TILE;
+    const int c0   = tj * TILE;
+    const int rend = Kokkos::min(r0 + TILE, N);
+    const int cend = Kokkos::min(c0 + TILE, N);
+
+    // y_I += A_IJ * x_J, consecutive threads taking consecutive rows
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(t, r0, rend), [&](const int i) {
+          ScalarY sum = AT::zero();
+          for (int j = c0; j < cend; j++) sum += entry(i, j) * x(j);
+          Kokkos::atomic_add(&y(i), alpha * sum);
+        });
+    if (ti == tj) return;
+    // y_J += A_JI * x_I, A_JI being A_IJ^T or A_IJ^H
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(t, c0, cend), [&](const int j) {
+          ScalarY sum = AT::zero();
+          for (int i = r0; i < rend; i++) sum += entry(j, i) * x(i);
+          Kokkos::atomic_add(&y(j), alpha * sum);
+        });
+  }
+
+  bool lower, hermitian;
+  int N;
+  ScalarY alpha, beta;
+  AViewType A;
+  XViewType x;
+  YViewType y;
+};
+
+template <class ExecSpace, class AViewType, class XViewType, class YViewType>
+void impl_symv(const ExecSpace& space, const char uplo[], const bool hermitian,
+               typename YViewType::const_value_type& alpha, const AViewType& A,
+               const XViewType& x, typename YViewType::const_value_type& beta,
+               const YViewType& y) {
+  using functor_t = SymvFunctor<ExecSpace, AViewType, XViewType, YViewType>;
+  using AT        = typename functor_t::AT;
+  functor_t functor(uplo, hermitian, alpha, A, x, beta, y);
+  if (beta != AT::one())
+    Kokkos::parallel_for(
+        hermitian ? "KokkosBlas::hemv[native,scale]"
+                  : "KokkosBlas::symv[native,scale]",
+        Kokkos::RangePolicy<ExecSpace, SymvScaleTag>(space, 0, y.extent(0)),
+        functor);
+  if (alpha == AT::zero()) return;
+  Kokkos::parallel_for(
+      hermitian ? "KokkosBlas::hemv[native]" : "KokkosBlas::symv[native]",
+      Kokkos::TeamPolicy<ExecSpace, SymvTileTag>(
+          space, functor_t::num_tiles(A.extent(0)), Kokkos::AUTO),
+      functor);
+}
+
+}  // namespace Impl
+}  // namespace KokkosBlas
+
+#endif  // KOKKOSBLAS2_SYMV_IMPL_HPP_
@@ -0,0 +1,146 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef KOKKOSBLAS2_SYMV_SPEC_HPP_
+#define KOKKOSBLAS2_SYMV_SPEC_HPP_
+
+#include "KokkosKernels_config.h"
+#include "Kokkos_Core.hpp"
+
+#if !defined(KOKKOSKERNELS_ETI_ONLY) || KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+#include <KokkosBlas2_symv_impl.hpp>
+#endif
+
+namespace KokkosBlas {
+namespace Impl {
+// Specialization struct which defines whether a specialization exists
+template <class execution_space, class AVIT, class XVIT, class YVIT>
+struct symv_eti_spec_avail {
+  enum : bool { value = false };
+};
+}  // namespace Impl
+}  // namespace KokkosBlas
+
+//
+// Macro for declaration of full specialization availability
+// KokkosBlas::Impl::SYMV. This is NOT for users!!! All the declarations of
+// full specializations go in this header file. We may spread out definitions
+// (see _INST macro below) across one or more .cpp files.
+//
+#define KOKKOSBLAS2_SYMV_ETI_SPEC_AVAIL(SCALAR, LAYOUT, EXEC_SPACE, MEM_SPACE) \
+  template <>                                                                  \
+  struct symv_eti_spec_avail<                                                  \
+      EXEC_SPACE,                                                              \
+      Kokkos::View<const SCALAR**, LAYOUT,                                     \
+                   Kokkos::Device<EXEC_SPACE, MEM_SPACE>,                      \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                  \
+      Kokkos::View<const SCALAR*, LAYOUT,                                      \
+                   Kokkos::Device<EXEC_SPACE, MEM_SPACE>,                      \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                  \
+      Kokkos::View<SCALAR*, LAYOUT, Kokkos::Device<EXEC_SPACE, MEM_SPACE>,     \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> > > {               \
+    enum : bool { value = true };                                              \
+  };
+
+// Include the actual specialization declarations
+#include <KokkosBlas2_symv_tpl_spec_avail.hpp>
+#include <generated_specializations_hpp/KokkosBlas2_symv_eti_spec_avail.hpp>
+
+namespace KokkosBlas {
+namespace Impl {
+
+//
+// symv, hemv
+//
+
+// Unification layer
+template <class execution_space, class AVIT, class XVIT, class YVIT,
+          bool tpl_spec_avail =
+              symv_tpl_spec_avail<execution_space, AVIT, XVIT, YVIT>::value,
+          bool eti_spec_avail =
+              symv_eti_spec_avail<execution_space, AVIT, XVIT, YVIT>::value>
+struct SYMV {
+  static void symv(const execution_space& space, const char uplo[],
+                   const bool hermitian,
+                   typename YVIT::const_value_type& alpha, const AVIT& A,
+                   const XVIT& x, typename YVIT::const_value_type& beta,
+                   const YVIT& y);
+};
+
+#if !defined(KOKKOSKERNELS_ETI_ONLY) || KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+template <class execution_space, class AVIT, class XVIT, class YVIT>
+struct SYMV<execution_space, AVIT, XVIT, YVIT, false,
+            KOKKOSKERNELS_IMPL_COMPILE_LIBRARY> {
+  static void symv(const execution_space& space, const char uplo[],
+                   const bool hermitian,
+                   typename YVIT::const_value_type& alpha, const AVIT& A,
+                   const XVIT& x, typename YVIT::const_value_type& beta,
+                   const YVIT& y) {
+    static_assert(Kokkos::is_view<AVIT>::value, "AVIT must be a Kokkos::View.");
+    static_assert(Kokkos::is_view<XVIT>::value, "XVIT must be a Kokkos::View.");
+    static_assert(Kokkos::is_view<YVIT>::value, "YVIT must be a Kokkos::View.");
+    static_assert(static_cast<int>(AVIT::rank) == 2, "AVIT must have rank 2.");
+    static_assert(static_cast<int>(XVIT::rank) == 1, "XVIT must have rank 1.");
+    static_assert(static_cast<int>(YVIT::rank) == 1, "YVIT must have rank 1.");
+
+    Kokkos::Profiling::pushRegion(KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+                                      ? "KokkosBlas::symv[ETI]"
+                                      : "KokkosBlas::symv[noETI]");
+    impl_symv(space, uplo, hermitian, alpha, A, x, beta, y);
+    Kokkos::Profiling::popRegion();
+  }
+};
+#endif  //! defined(KOKKOSKERNELS_ETI_ONLY) ||
+        //! KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+
+}  // namespace Impl
+}  // namespace KokkosBlas
+
+//
+// Macro for declaration of full specialization of KokkosBlas::Impl::SYMV.
+// This is NOT for users!!!
+// All the declarations of full specializations go in this header file.
+// We may spread out definitions (see _DEF macro below) across one or more .cpp
+// files.
+//
+#define KOKKOSBLAS2_SYMV_ETI_SPEC_DECL(SCALAR, LAYOUT, EXEC_SPACE, MEM_SPACE) \
+  extern template struct SYMV<                                                \
+      EXEC_SPACE,                                                             \
+      Kokkos::View<const SCALAR**, LAYOUT,                                    \
+                   Kokkos::Device<EXEC_SPACE, MEM_SPACE>,                     \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                 \
+      Kokkos::View<const SCALAR*, LAYOUT,                                     \
+                   Kokkos::Device<EXEC_SPACE, MEM_SPACE>,                     \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                 \
+      Kokkos::View<SCALAR*, LAYOUT, Kokkos::Device<EXEC_SPACE, MEM_SPACE>,    \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                 \
+      false, true>;
+
+#define KOKKOSBLAS2_SYMV_ETI_SPEC_INST(SCALAR, LAYOUT, EXEC_SPACE, MEM_SPACE) \
+  template struct SYMV<                                                       \
+      EXEC_SPACE,                                                             \
+      Kokkos::View<const SCALAR**, LAYOUT,                                    \
+                   Kokkos::Device<EXEC_SPACE, MEM_SPACE>,                     \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                 \
+      Kokkos::View<const SCALAR*, LAYOUT,                                     \
+                   Kokkos::Device<EXEC_SPACE, MEM_SPACE>,                     \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                 \
+      Kokkos::View<SCALAR*, LAYOUT, Kokkos::Device<EXEC_SPACE, MEM_SPACE>,    \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                 \
+      false, true>;
+
+#include <KokkosBlas2_symv_tpl_spec_decl.hpp>
+
+#endif  // KOKKOSBLAS2_SYMV_SPEC_HPP_
@@ -0,0 +1,164 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef KOKKOSBLAS3_BATCHED_IMPL_HPP_
+#define KOKKOSBLAS3_BATCHED_IMPL_HPP_
+
+#include "KokkosKernels_config.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_ArithTraits.hpp"
+#include "KokkosBlas3_trsm_impl.hpp"
+#include "KokkosBatched_Trsm_Serial_Internal.hpp"
+
+namespace KokkosBlas {
+namespace Impl {
+
+/// \brief Native strided-batched GEMM, C(b) := beta*C(b) +
+/// alpha*op(A(b))*op(B(b)), with one team per batch entry and the entries of
+/// C(b) spread over the threads of the team.
+template <class ExecSpace, class AViewType, class BViewType, class CViewType>
+struct GemmStridedBatchedFunctor {
+  using ScalarC     = typename CViewType::non_const_value_type;
+  using AT          = Kokkos::ArithTraits<ScalarC>;
+  using team_member = typename Kokkos::TeamPolicy<ExecSpace>::member_type;
+
+  GemmStridedBatchedFunctor(const char transA[], const char transB[],
+                            const ScalarC& alpha_, const AViewType& A_,
+                            const BViewType& B_, const ScalarC& beta_,
+                            const CViewType& C_)
+      : A_t(transA[0] != 'N' && transA[0] != 'n'),
+        A_c(transA[0] == 'C' || transA[0] == 'c'),
+        B_t(transB[0] != 'N' && transB[0] != 'n'),
+        B_c(transB[0] == 'C' || transB[0] == 'c'),
+        M(C_.extent(1)),
+        N(C_.extent(2)),
+        K(A_t ? A_.extent(1) : A_.extent(2)),
+        alpha(alpha_),
+        beta(beta_),
+        A(A_),
+        B(B_),
+        C(C_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const team_member& t) const {
+    const int b = t.league_rank();
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(t, M * N), [&](const int ij) {
+      const int i = ij / N, j = ij % N;
+      ScalarC sum = AT::zero();
+      for (int k = 0; k < K; k++) {
+        ScalarC a = A_t ? ScalarC(A(b, k, i)) : ScalarC(A(b, i, k));
+        ScalarC c = B_t ? ScalarC(B(b, j, k)) : ScalarC(B(b, k, j));
+        if (A_c) a = AT::conj(a);
+        if (B_c) c = AT::conj(c);
+        sum += a * c;
+      }
+      // C is not read when beta is zero, so that NaNs in C don't propagate
+      C(b, i, j) =
+          beta == AT::zero() ? alpha * sum : beta * C(b, i, j) + alpha * sum;
+    });
+  }
+
+  bool A_t, A_c, B_t, B_c;
+  int M, N, K;
+  ScalarC alpha, beta;
+  AViewType A;
+  BViewType B;
+  CViewType C;
+};
+
+template <class ExecSpace, class AViewType, class BViewType, class CViewType>
+void impl_gemm_strided_batched(const ExecSpace& space, const char transA[],
+                               const char transB[],
+                               typename CViewType::const_value_type& alpha,
+                               const AViewType& A, const BViewType& B,
+                               typename CViewType::const_value_type& beta,
+                               const CViewType& C) {
+  using functor_t =
+      GemmStridedBatchedFunctor<ExecSpace, AViewType, BViewType, CViewType>;
+  Kokkos::parallel_for(
+      "KokkosBlas::gemm_strided_batched[native]",
+      Kokkos::TeamPolicy<ExecSpace>(space, C.extent(0), Kokkos::AUTO),
+      functor_t(transA, transB, alpha, A, B, beta, C));
+}
+
+/// \brief Native batched TRSM, op(A(b))*X(b) = alpha*B(b) or X(b)*op(A(b)) =
+/// alpha*B(b), with one thread per batch entry.
+///
+/// Every case reduces to a left, lower or upper, non-transposed solve with the
+/// strides of A (and for side == R, of B) swapped: a transpose swaps lower
+/// and upper and so does moving A to the right.
+template <class ExecSpace, class AViewType, class BViewType>
+struct TrsmBatchedFunctor {
+  using ScalarB = typename BViewType::non_const_value_type;
+
+  TrsmBatchedFunctor(const char side[], const char uplo[], const char trans[],
+                     const char diag[], const ScalarB& alpha_,
+                     const AViewType& A_, const BViewType& B_)
+      : alpha(alpha_), A(A_), B(B_) {
+    const bool right = side[0] == 'R' || side[0] == 'r';
+    const bool lower = uplo[0] == 'L' || uplo[0] == 'l';
+    const bool notr  = trans[0] == 'N' || trans[0] == 'n';
+    unit_diag        = diag[0] == 'U' || diag[0] == 'u';
+    conj             = trans[0] == 'C' || trans[0] == 'c';
+    solve_lower      = lower != !notr != right;
+    swap_A           = !notr != right;
+    swap_B           = right;
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const int b) const {
+    using KokkosBatched::Algo;
+    const int m   = swap_B ? B.extent(2) : B.extent(1);
+    const int n   = swap_B ? B.extent(1) : B.extent(2);
+    const int as0 = swap_A ? A.stride(2) : A.stride(1);
+    const int as1 = swap_A ? A.stride(1) : A.stride(2);
+    const int bs0 = swap_B ? B.stride(2) : B.stride(1);
+    const int bs1 = swap_B ? B.stride(1) : B.stride(2);
+    const auto* a = &A(b, 0, 0);
+    ScalarB* x    = &B(b, 0, 0);
+    if (solve_lower && conj)
+      SerialTrsmInternalLeftLowerConj(unit_diag, m, n, alpha, a, as0, as1, x,
+                                      bs0, bs1);
+    else if (solve_lower)
+      KokkosBatched::SerialTrsmInternalLeftLower<Algo::Trsm::Unblocked>::invoke(
+          unit_diag, m, n, alpha, a, as0, as1, x, bs0, bs1);
+    else if (conj)
+      SerialTrsmInternalLeftUpperConj(unit_diag, m, n, alpha, a, as0, as1, x,
+                                      bs0, bs1);
+    else
+      KokkosBatched::SerialTrsmInternalLeftUpper<Algo::Trsm::Unblocked>::invoke(
+          unit_diag, m, n, alpha, a, as0, as1, x, bs0, bs1);
+  }
+
+  bool unit_diag, conj, solve_lower, swap_A, swap_B;
+  ScalarB alpha;
+  AViewType A;
+  BViewType B;
+};
+
+template <class ExecSpace, class AViewType, class BViewType>
+void impl_trsm_batched(const ExecSpace& space, const char side[],
+                       const char uplo[], const char trans[], const char diag[],
+                       typename BViewType::const_value_type& alpha,
+                       const AViewType& A, const BViewType& B) {
+  Kokkos::parallel_for(
+      "KokkosBlas::trsm_batched[native]",
+      Kokkos::RangePolicy<ExecSpace>(space, 0, B.extent(0)),
+      TrsmBatchedFunctor<ExecSpace, AViewType, BViewType>(side, uplo, trans,
+                                                          diag, alpha, A, B));
+}
+
+}  // namespace Impl
+}  // namespace KokkosBlas
+
+#endif  // KOKKOSBLAS3_BATCHED_IMPL_HPP_
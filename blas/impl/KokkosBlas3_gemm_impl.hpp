@@ -19,6 +19,7 @@
 
 #include <Kokkos_Core.hpp>
 #include "KokkosKernels_Macros.hpp"
+#include "KokkosKernels_ExecSpaceUtils.hpp"
 
 #ifdef KOKKOS_ENABLE_CXX14
 #ifdef KOKKOS_COMPILER_GNU
@@ -351,63 +352,54 @@ struct impl_deep_copy_matrix_block<TeamHandle, ViewTypeScratch, ViewType,
   }
 };
 
+/// \brief The epilogue of the native GEMM kernels when none is given: C(i, j)
+/// is written as computed.
+struct GemmIdentityEpilogue {
+  template <class Scalar>
+  KOKKOS_INLINE_FUNCTION Scalar operator()(const int /*i*/, const int /*j*/,
+                                           const Scalar& c) const {
+    return c;
+  }
+};
+
+// Write back a block of C, applying the epilogue to each beta * C(i, j) +
+// alpha * A_scr(i, j) before it is stored
 template <class TeamHandle, class ViewType, class ViewTypeScratch, class Layout,
           int blockDim_i, int blockDim_j>
 struct impl_update_matrix_block {
   typedef typename ViewType::non_const_value_type value_type;
   typedef Kokkos::ArithTraits<value_type> ATV;
 
-  KOKKOS_INLINE_FUNCTION
-  static void update(const TeamHandle& team, const value_type& beta,
-                     const ViewType& A, const value_type& alpha,
-                     const ViewTypeScratch& A_scr, const int& offset_i,
-                     const int& offset_j) {
-    if (offset_i + blockDim_i <= A.extent_int(0) &&
-        offset_j + blockDim_j <= A.extent_int(1)) {
-      Kokkos::parallel_for(
-          Kokkos::TeamThreadRange(team, blockDim_j), [&](const int j) {
-            const int idx_j = offset_j + j;
-            if (beta == ATV::zero()) {
-              Kokkos::parallel_for(Kokkos::ThreadVectorRange(team, blockDim_i),
-                                   [&](const int i) {
-                                     const int idx_i = offset_i + i;
-                                     A(idx_i, idx_j) = alpha * A_scr(i, j);
-                                   });
-            } else {
-              Kokkos::parallel_for(Kokkos::ThreadVectorRange(team, blockDim_i),
-                                   [&](const int i) {
-                                     const int idx_i = offset_i + i;
-                                     A(idx_i, idx_j) = beta * A(idx_i, idx_j) +
-                                                       alpha * A_scr(i, j);
-                                   });
-            }
-          });
-    } else {
-      const int range_i = offset_i + blockDim_i <= A.extent_int(0)
-                              ? blockDim_i
-                              : A.extent_int(0) % blockDim_i;
-      const int range_j = offset_j + blockDim_j <= A.extent_int(1)
-                              ? blockDim_j
-                              : A.extent_int(1) % blockDim_j;
-      Kokkos::parallel_for(
-          Kokkos::TeamThreadRange(team, range_j), [&](const int j) {
-            const int idx_j = offset_j + j;
-            if (beta == ATV::zero()) {
-              Kokkos::parallel_for(Kokkos::ThreadVectorRange(team, range_i),
-                                   [&](const int i) {
-                                     const int idx_i = offset_i + i;
-                                     A(idx_i, idx_j) = alpha * A_scr(i, j);
-                                   });
-            } else {
-              Kokkos::parallel_for(
-                  Kokkos::ThreadVectorRange(team, range_i), [&](const int i) {
-                    const int idx_i = offset_i + i;
-                    A(idx_i, idx_j) =
-                        beta * A(idx_i, idx_j) + alpha * A_scr(i, j);
-                  });
-            }
-          });
-    }
+  template <class Epilogue>
+  KOKKOS_INLINE_FUNCTION static void update(
+      const TeamHandle& team, const value_type& beta, const ViewType& A,
+      const value_type& alpha, const ViewTypeScratch& A_scr,
+      const int& offset_i, const int& offset_j, const Epilogue& epilogue) {
+    const int range_i = offset_i + blockDim_i <= A.extent_int(0)
+                            ? blockDim_i
+                            : A.extent_int(0) % blockDim_i;
+    const int range_j = offset_j + blockDim_j <= A.extent_int(1)
+                            ? blockDim_j
+                            : A.extent_int(1) % blockDim_j;
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(team, range_j), [&](const int j) {
+          const int idx_j = offset_j + j;
+          if (beta == ATV::zero()) {
+            Kokkos::parallel_for(
+                Kokkos::ThreadVectorRange(team, range_i), [&](const int i) {
+                  const int idx_i = offset_i + i;
+                  A(idx_i, idx_j) = epilogue(idx_i, idx_j, alpha * A_scr(i, j));
+                });
+          } else {
+            Kokkos::parallel_for(
+                Kokkos::ThreadVectorRange(team, range_i), [&](const int i) {
+                  const int idx_i = offset_i + i;
+                  A(idx_i, idx_j) = epilogue(
+                      idx_i, idx_j,
+                      value_type(beta * A(idx_i, idx_j) + alpha * A_scr(i, j)));
+                });
+          }
+        });
   }
 };
 
@@ -418,57 +410,36 @@ struct impl_update_matrix_block<TeamHandle, ViewType, ViewTypeScratch,
   typedef typename ViewType::non_const_value_type value_type;
   typedef Kokkos::ArithTraits<value_type> ATV;
 
-  KOKKOS_INLINE_FUNCTION
-  static void update(const TeamHandle& team, const value_type& beta,
-                     const ViewType& A, const value_type& alpha,
-                     const ViewTypeScratch& A_scr, const int& offset_i,
-                     const int& offset_j) {
-    if (offset_i + blockDim_i <= A.extent_int(0) &&
-        offset_j + blockDim_j <= A.extent_int(1)) {
-      Kokkos::parallel_for(
-          Kokkos::TeamThreadRange(team, blockDim_i), [&](const int i) {
-            const int idx_i = offset_i + i;
-            if (beta == ATV::zero()) {
-              Kokkos::parallel_for(Kokkos::ThreadVectorRange(team, blockDim_j),
-                                   [&](const int j) {
-                                     const int idx_j = offset_j + j;
-                                     A(idx_i, idx_j) = alpha * A_scr(i, j);
-                                   });
-            } else {
-              Kokkos::parallel_for(Kokkos::ThreadVectorRange(team, blockDim_j),
-                                   [&](const int j) {
-                                     const int idx_j = offset_j + j;
-                                     A(idx_i, idx_j) = beta * A(idx_i, idx_j) +
-                                                       alpha * A_scr(i, j);
-                                   });
-            }
-          });
-    } else {
-      const int range_i = offset_i + blockDim_i <= A.extent_int(0)
-                              ? blockDim_i
-                              : A.extent_int(0) % blockDim_i;
-      const int range_j = offset_j + blockDim_j <= A.extent_int(1)
-                              ? blockDim_j
-                              : A.extent_int(1) % blockDim_j;
-      Kokkos::parallel_for(
-          Kokkos::TeamThreadRange(team, range_i), [&](const int i) {
-            const int idx_i = offset_i + i;
-            if (beta == ATV::zero()) {
-              Kokkos::parallel_for(Kokkos::ThreadVectorRange(team, range_j),
-                                   [&](const int j) {
-                                     const int idx_j = offset_j + j;
-                                     A(idx_i, idx_j) = alpha * A_scr(i, j);
-                                   });
-            } else {
-              Kokkos::parallel_for(
-                  Kokkos::ThreadVectorRange(team, range_j), [&](const int j) {
-                    const int idx_j = offset_j + j;
-                    A(idx_i, idx_j) =
-                        beta * A(idx_i, idx_j) + alpha * A_scr(i, j);
-                  });
-            }
-          });
-    }
+  template <class Epilogue>
+  KOKKOS_INLINE_FUNCTION static void update(
+      const TeamHandle& team, const value_type& beta, const ViewType& A,
+      const value_type& alpha, const ViewTypeScratch& A_scr,
+      const int& offset_i, const int& offset_j, const Epilogue& epilogue) {
+    const int range_i = offset_i + blockDim_i <= A.extent_int(0)
+                            ? blockDim_i
+                            : A.extent_int(0) % blockDim_i;
+    const int range_j = offset_j + blockDim_j <= A.extent_int(1)
+                            ? blockDim_j
+                            : A.extent_int(1) % blockDim_j;
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(team, range_i), [&](const int i) {
+          const int idx_i = offset_i + i;
+          if (beta == ATV::zero()) {
+            Kokkos::parallel_for(
+                Kokkos::ThreadVectorRange(team, range_j), [&](const int j) {
+                  const int idx_j = offset_j + j;
+                  A(idx_i, idx_j) = epilogue(idx_i, idx_j, alpha * A_scr(i, j));
+                });
+          } else {
+            Kokkos::parallel_for(
+                Kokkos::ThreadVectorRange(team, range_j), [&](const int j) {
+                  const int idx_j = offset_j + j;
+                  A(idx_i, idx_j) = epilogue(
+                      idx_i, idx_j,
+                      value_type(beta * A(idx_i, idx_j) + alpha * A_scr(i, j)));
+                });
+          }
+        });
   }
 };
 
@@ -566,11 +537,13 @@ struct impl_gemm_label<2, 2> {
 };
 
 template <class ExecSpace, class ViewTypeA, class ViewTypeB, class ViewTypeC,
-          int blockA0, int blockA1, int blockB1, int TransposeA, int TransposeB>
+          int blockA0, int blockA1, int blockB1, int TransposeA, int TransposeB,
+          class Epilogue = GemmIdentityEpilogue>
 struct GEMMImpl {
   ViewTypeA A;
   ViewTypeB B;
   ViewTypeC C;
+  Epilogue epilogue;
   typedef typename ViewTypeA::non_const_value_type ScalarA;
   typedef typename ViewTypeB::non_const_value_type ScalarB;
   typedef typename ViewTypeC::non_const_value_type ScalarC;
@@ -591,10 +564,12 @@ struct GEMMImpl {
       ViewTypeCScratch;
 
   GEMMImpl(const ScalarA& alpha_, const ViewTypeA& A_, const ViewTypeB& B_,
-           const ScalarC& beta_, const ViewTypeC& C_)
+           const ScalarC& beta_, const ViewTypeC& C_,
+           const Epilogue& epilogue_ = Epilogue())
       : A(A_),
         B(B_),
         C(C_),
+        epilogue(epilogue_),
         num_blocks_0((C.extent_int(0) + blockA0 - 1) / blockA0),
         num_blocks_1((C.extent_int(1) + blockB1 - 1) / blockB1) {
     scratch_level = 0;
@@ -685,10 +660,153 @@ struct GEMMImpl {
     impl_update_matrix_block<
         typename Kokkos::TeamPolicy<ExecSpace>::member_type, ViewTypeC,
         ViewTypeCScratch, typename ViewTypeC::array_layout, blockA0,
-        blockB1>::update(team, beta, C, alpha, C_scr, i_offset, j_offset);
+        blockB1>::update(team, beta, C, alpha, C_scr, i_offset, j_offset,
+                         epilogue);
   }
 };
 
+/// \brief Tiled GEMM on device, C = epilogue(beta * C + alpha * op(A) * op(B)),
+/// with a block of C per team, accumulated in scratch.
+template <class execution_space, class AViewType, class BViewType,
+          class CViewType, class Epilogue>
+void impl_gemm_tiled(const execution_space& space, const char transA[],
+                     const char transB[],
+                     typename AViewType::const_value_type& alpha,
+                     const AViewType& A, const BViewType& B,
+                     typename CViewType::const_value_type& beta,
+                     const CViewType& C, const Epilogue& epilogue) {
+  typedef typename AViewType::non_const_value_type ScalarA;
+  typedef typename BViewType::non_const_value_type ScalarB;
+  typedef typename CViewType::non_const_value_type ScalarC;
+
+  // Define Blocking sizes (this will be used for scratch spaces)
+  static constexpr int blockA0 = 24;
+  static constexpr int blockB1 = 64;
+  static constexpr int blockA1 =
+      (sizeof(ScalarA) * blockA0 * 16 + sizeof(ScalarB) * 16 * blockB1 +
+           sizeof(ScalarC) * blockA0 * blockB1 <
+       24000)
+          ? 16
+          : (sizeof(ScalarA) * blockA0 * 8 + sizeof(ScalarB) * 8 * blockB1 +
+                 sizeof(ScalarC) * blockA0 * blockB1 <
+             24000)
+                ? 8
+                : (sizeof(ScalarA) * blockA0 * 4 +
+                       sizeof(ScalarB) * 4 * blockB1 +
+                       sizeof(ScalarC) * blockA0 * blockB1 <
+                   24000)
+                      ? 4
+                      : 16;
+  int vector_length = blockB1 / 4;
+  int max_vector_length =
+      KokkosKernels::Impl::kk_get_max_vector_size<execution_space>();
+  if (vector_length > max_vector_length) vector_length = max_vector_length;
+
+  // Compute scratch space size
+  typedef KokkosBlas::Impl::GEMMImpl<execution_space, AViewType, BViewType,
+                                     CViewType, blockA0, blockA1, blockB1,
+                                     0, 0>
+      gemm_dummy_type;
+  const int scratch_memory_size =
+      gemm_dummy_type::ViewTypeAScratch::required_allocation_size() +
+      gemm_dummy_type::ViewTypeBScratch::required_allocation_size() +
+      gemm_dummy_type::ViewTypeCScratch::required_allocation_size();
+  const int scratch_level = scratch_memory_size < 24000 ? 0 : 1;
+
+  // Figure out Team Sizes
+  int team_size = 1;
+#if defined(KOKKOS_ENABLE_CUDA)
+  if (std::is_same<execution_space, Kokkos::Cuda>::value)
+    team_size = blockA0;
+#endif
+#if defined(KOKKOS_ENABLE_HIP)
+  if (std::is_same<execution_space, Kokkos::HIP>::value)
+    team_size = blockA0;
+#endif
+#if defined(KOKKOS_ENABLE_ROCM)
+  if (std::is_same<execution_space, Kokkos::ROCm>::value)
+    team_size = blockA0;
+#endif
+#if defined(KOKKOS_ENABLE_SYCL)
+  if (std::is_same<execution_space, Kokkos::Experimental::SYCL>::value)
+    team_size = blockA0;
+#endif
+
+  // Call the correct kernel
+  if ((transA[0] == 'N' || transA[0] == 'n') &&
+      (transB[0] == 'N' || transB[0] == 'n')) {
+    KokkosBlas::Impl::GEMMImpl<execution_space, AViewType, BViewType,
+                               CViewType, blockA0, blockA1, blockB1, 0, 0,
+                               Epilogue>
+        gemm(alpha, A, B, beta, C, epilogue);
+    gemm.run(space, team_size, vector_length, scratch_level);
+  }
+  if ((transA[0] == 'T' || transA[0] == 't') &&
+      (transB[0] == 'N' || transB[0] == 'n')) {
+    KokkosBlas::Impl::GEMMImpl<execution_space, AViewType, BViewType,
+                               CViewType, blockA0, blockA1, blockB1, 1, 0,
+                               Epilogue>
+        gemm(alpha, A, B, beta, C, epilogue);
+    gemm.run(space, team_size, vector_length, scratch_level);
+  }
+  if ((transA[0] == 'C' || transA[0] == 'c') &&
+      (transB[0] == 'N' || transB[0] == 'n')) {
+    KokkosBlas::Impl::GEMMImpl<execution_space, AViewType, BViewType,
+                               CViewType, blockA0, blockA1, blockB1, 2, 0,
+                               Epilogue>
+        gemm(alpha, A, B, beta, C, epilogue);
+    gemm.run(space, team_size, vector_length, scratch_level);
+  }
+  if ((transA[0] == 'N' || transA[0] == 'n') &&
+      (transB[0] == 'T' || transB[0] == 't')) {
+    KokkosBlas::Impl::GEMMImpl<execution_space, AViewType, BViewType,
+                               CViewType, blockA0, blockA1, blockB1, 0, 1,
+                               Epilogue>
+        gemm(alpha, A, B, beta, C, epilogue);
+    gemm.run(space, team_size, vector_length, scratch_level);
+  }
+  if ((transA[0] == 'T' || transA[0] == 't') &&
+      (transB[0] == 'T' || transB[0] == 't')) {
+    KokkosBlas::Impl::GEMMImpl<execution_space, AViewType, BViewType,
+                               CViewType, blockA0, blockA1, blockB1, 1, 1,
+                               Epilogue>
+        gemm(alpha, A, B, beta, C, epilogue);
+    gemm.run(space, team_size, vector_length, scratch_level);
+  }
+  if ((transA[0] == 'C' || transA[0] == 'c') &&
+      (transB[0] == 'T' || transB[0] == 't')) {
+    KokkosBlas::Impl::GEMMImpl<execution_space, AViewType, BViewType,
+                               CViewType, blockA0, blockA1, blockB1, 2, 1,
+                               Epilogue>
+        gemm(alpha, A, B, beta, C, epilogue);
+    gemm.run(space, team_size, vector_length, scratch_level);
+  }
+  if ((transA[0] == 'N' || transA[0] == 'n') &&
+      (transB[0] == 'C' || transB[0] == 'c')) {
+    KokkosBlas::Impl::GEMMImpl<execution_space, AViewType, BViewType,
+                               CViewType, blockA0, blockA1, blockB1, 0, 2,
+                               Epilogue>
+        gemm(alpha, A, B, beta, C, epilogue);
+    gemm.run(space, team_size, vector_length, scratch_level);
+  }
+  if ((transA[0] == 'T' || transA[0] == 't') &&
+      (transB[0] == 'C' || transB[0] == 'c')) {
+    KokkosBlas::Impl::GEMMImpl<execution_space, AViewType, BViewType,
+                               CViewType, blockA0, blockA1, blockB1, 1, 2,
+                               Epilogue>
+        gemm(alpha, A, B, beta, C, epilogue);
+    gemm.run(space, team_size, vector_length, scratch_level);
+  }
+  if ((transA[0] == 'C' || transA[0] == 'c') &&
+      (transB[0] == 'C' || transB[0] == 'c')) {
+    KokkosBlas::Impl::GEMMImpl<execution_space, AViewType, BViewType,
+                               CViewType, blockA0, blockA1, blockB1, 2, 2,
+                               Epilogue>
+        gemm(alpha, A, B, beta, C, epilogue);
+    gemm.run(space, team_size, vector_length, scratch_level);
+  }
+}
+
 }  // namespace Impl
 }  // namespace KokkosBlas
 #endif
@@ -0,0 +1,331 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSBLAS3_GEMM_PACKED_IMPL_HPP_
+#define KOKKOSBLAS3_GEMM_PACKED_IMPL_HPP_
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ArithTraits.hpp>
+#include "KokkosKernels_Macros.hpp"
+#include "KokkosBlas3_gemm_impl.hpp"
+
+namespace KokkosBlas {
+namespace Impl {
+
+// Packed GEMM for host execution spaces, in the style of BLIS/GotoBLAS:
+// C is computed in NC-column panels, the inner dimension in KC-deep slices.
+// For each slice, the KC x NC panel of op(B) is packed once (sized for the
+// L3 cache) in NR-column slivers, and each team packs an MC x KC block of
+// op(A) (sized for the L2 cache) in MR-row slivers into its scratch. The
+// microkernel then multiplies one A sliver by one B sliver into an MR x NR
+// tile of accumulators held in registers.
+
+// Shape of the register tile: MR rows, and NR columns made of NR_VECTORS SIMD
+// vectors, chosen from the vector width and register count of the target.
+struct impl_gemm_packed_arch {
+#if defined(__AVX512F__) || \
+    (defined(__ARM_FEATURE_SVE_BITS) && __ARM_FEATURE_SVE_BITS == 512)
+  // 32 512-bit registers: 24 accumulators
+  static constexpr int vector_bytes = 64;
+  static constexpr int MR           = 12;
+  static constexpr int NR_VECTORS   = 2;
+#elif defined(__AVX2__)
+  // 16 256-bit registers: 12 accumulators
+  static constexpr int vector_bytes = 32;
+  static constexpr int MR           = 6;
+  static constexpr int NR_VECTORS   = 2;
+#elif defined(__ARM_NEON)
+  // 32 128-bit registers: 24 accumulators
+  static constexpr int vector_bytes = 16;
+  static constexpr int MR           = 6;
+  static constexpr int NR_VECTORS   = 4;
+#else
+  static constexpr int vector_bytes = 16;
+  static constexpr int MR           = 4;
+  static constexpr int NR_VECTORS   = 2;
+#endif
+};
+
+template <class ScalarA, class ScalarB, class ScalarC>
+struct impl_gemm_packed_blocking {
+  using arch = impl_gemm_packed_arch;
+  static constexpr int lanes =
+      arch::vector_bytes >= int(sizeof(ScalarC))
+          ? arch::vector_bytes / int(sizeof(ScalarC))
+          : 1;
+  static constexpr int MR = arch::MR;
+  static constexpr int NR = arch::NR_VECTORS * lanes;
+  // A B sliver (KC x NR) stays in L1
+  static constexpr int KC = sizeof(ScalarB) <= 8 ? 256 : 128;
+  // An A block (MC x KC) fills about 256 KB of L2
+  static constexpr int MC =
+      (262144 / (KC * int(sizeof(ScalarA))) / MR > 0
+           ? 262144 / (KC * int(sizeof(ScalarA))) / MR
+           : 1) *
+      MR;
+  // The B panel (KC x NC) fills about 4 MB of L3
+  static constexpr int NC =
+      (4194304 / (KC * int(sizeof(ScalarB))) / NR > 0
+           ? 4194304 / (KC * int(sizeof(ScalarB))) / NR
+           : 1) *
+      NR;
+};
+
+// op(X)(i, j), for Transpose 0 (X), 1 (X^T) or 2 (X^H)
+template <int Transpose, class ViewType>
+KOKKOS_INLINE_FUNCTION typename ViewType::non_const_value_type
+impl_gemm_packed_op(const ViewType& X, int i, int j) {
+  using KAT = Kokkos::ArithTraits<typename ViewType::non_const_value_type>;
+  if constexpr (Transpose == 0)
+    return X(i, j);
+  else if constexpr (Transpose == 1)
+    return X(j, i);
+  else
+    return KAT::conj(X(j, i));
+}
+
+// acc = a * b, for an MR x kc sliver a (stored by columns of MR) and a
+// kc x NR sliver b (stored by rows of NR). The accumulators have compile-time
+// extents so that the compiler keeps them in vector registers and turns the
+// inner loop into NR / lanes FMAs per element of a.
+template <int MR, int NR, class ScalarA, class ScalarB, class ScalarC>
+KOKKOS_FORCEINLINE_FUNCTION void impl_gemm_packed_microkernel(
+    int kc, const ScalarA* KOKKOS_RESTRICT a, const ScalarB* KOKKOS_RESTRICT b,
+    ScalarC (&acc)[MR][NR]) {
+  for (int i = 0; i < MR; i++)
+    for (int j = 0; j < NR; j++) acc[i][j] = ScalarC(0);
+  for (int p = 0; p < kc; p++, a += MR, b += NR) {
+    for (int i = 0; i < MR; i++) {
+      const ScalarC a_ip = a[i];
+#if defined(KOKKOSKERNELS_ENABLE_OMP_SIMD)
+#pragma omp simd
+#endif
+      for (int j = 0; j < NR; j++) acc[i][j] += a_ip * b[j];
+    }
+  }
+}
+
+template <class ExecSpace, class ViewTypeA, class ViewTypeB, class ViewTypeC,
+          int TransposeA, int TransposeB, class Epilogue = GemmIdentityEpilogue>
+struct PackedGEMM {
+  using ScalarA       = typename ViewTypeA::non_const_value_type;
+  using ScalarB       = typename ViewTypeB::non_const_value_type;
+  using ScalarC       = typename ViewTypeC::non_const_value_type;
+  using blocking      = impl_gemm_packed_blocking<ScalarA, ScalarB, ScalarC>;
+  using member_t      = typename Kokkos::TeamPolicy<ExecSpace>::member_type;
+  using scratch_space = typename ExecSpace::scratch_memory_space;
+  using APackType =
+      Kokkos::View<ScalarA*, scratch_space, Kokkos::MemoryUnmanaged>;
+  using BPackType = Kokkos::View<ScalarB*, typename ExecSpace::memory_space>;
+
+  static constexpr int MR = blocking::MR;
+  static constexpr int NR = blocking::NR;
+  static constexpr int KC = blocking::KC;
+  static constexpr int MC = blocking::MC;
+  static constexpr int NC = blocking::NC;
+
+  ViewTypeA A;
+  ViewTypeB B;
+  ViewTypeC C;
+  ScalarC alpha, beta;
+  Epilogue epilogue;
+  int M, N, K;
+
+  // State of the current panel
+  BPackType B_pack;
+  int jc, nc, pc, kc, num_col_chunks, chunk_slivers;
+
+  PackedGEMM(const ScalarC& alpha_, const ViewTypeA& A_, const ViewTypeB& B_,
+             const ScalarC& beta_, const ViewTypeC& C_,
+             const Epilogue& epilogue_ = Epilogue())
+      : A(A_),
+        B(B_),
+        C(C_),
+        alpha(alpha_),
+        beta(beta_),
+        epilogue(epilogue_),
+        M(C_.extent_int(0)),
+        N(C_.extent_int(1)),
+        K(TransposeA > 0 ? A_.extent_int(0) : A_.extent_int(1)) {}
+
+  // Pack the NR-column sliver s of the current panel of op(B), zero-padded
+  struct PackBTag {};
+  KOKKOS_INLINE_FUNCTION void operator()(PackBTag, const int s) const {
+    ScalarB* dst = B_pack.data() + size_t(s) * NR * kc;
+    for (int p = 0; p < kc; p++) {
+      for (int j = 0; j < NR; j++) {
+        const int col = jc + s * NR + j;
+        dst[p * NR + j] =
+            col < N ? impl_gemm_packed_op<TransposeB>(B, pc + p, col)
+                    : ScalarB(0);
+      }
+    }
+  }
+
+  // One team per (MC-row block, chunk of columns of the panel): pack the A
+  // block in scratch, then run the microkernel over its tiles
+  KOKKOS_INLINE_FUNCTION void operator()(const member_t& team) const {
+    const int ic          = (team.league_rank() / num_col_chunks) * MC;
+    const int chunk       = team.league_rank() % num_col_chunks;
+    const int mc          = M - ic < MC ? M - ic : MC;
+    const int num_slivers = (nc + NR - 1) / NR;
+    const int s_begin     = chunk * chunk_slivers;
+    const int s_end       = s_begin + chunk_slivers < num_slivers
+                                ? s_begin + chunk_slivers
+                                : num_slivers;
+    if (s_begin >= s_end) return;
+    APackType A_pack(team.team_scratch(1), size_t(MC) * KC);
+    const int num_row_slivers = (mc + MR - 1) / MR;
+    for (int r = 0; r < num_row_slivers; r++) {
+      ScalarA* dst = A_pack.data() + size_t(r) * MR * kc;
+      for (int p = 0; p < kc; p++) {
+        for (int i = 0; i < MR; i++) {
+          const int row = ic + r * MR + i;
+          dst[p * MR + i] =
+              row < M ? impl_gemm_packed_op<TransposeA>(A, row, pc + p)
+                      : ScalarA(0);
+        }
+      }
+    }
+    // the first slice of the inner dimension applies beta, the last one the
+    // epilogue
+    const bool first = pc == 0;
+    const bool last  = pc + kc == K;
+    ScalarC acc[MR][NR];
+    for (int s = s_begin; s < s_end; s++) {
+      const ScalarB* b = B_pack.data() + size_t(s) * NR * kc;
+      const int j0     = jc + s * NR;
+      const int nr     = N - j0 < NR ? N - j0 : NR;
+      for (int r = 0; r < num_row_slivers; r++) {
+        const ScalarA* a = A_pack.data() + size_t(r) * MR * kc;
+        impl_gemm_packed_microkernel<MR, NR>(kc, a, b, acc);
+        const int i0 = ic + r * MR;
+        const int mr = M - i0 < MR ? M - i0 : MR;
+        for (int i = 0; i < mr; i++) {
+          for (int j = 0; j < nr; j++) {
+            ScalarC& c_ij = C(i0 + i, j0 + j);
+            ScalarC c     = alpha * acc[i][j];
+            if (!first)
+              c += c_ij;
+            else if (beta != ScalarC(0))
+              c += beta * c_ij;
+            c_ij = last ? epilogue(i0 + i, j0 + j, c) : c;
+          }
+        }
+      }
+    }
+  }
+
+  // C = beta * C, for an empty inner dimension
+  struct ScaleTag {};
+  KOKKOS_INLINE_FUNCTION void operator()(ScaleTag, const int i) const {
+    for (int j = 0; j < N; j++)
+      C(i, j) = epilogue(i, j,
+                         beta == ScalarC(0) ? ScalarC(0) : beta * C(i, j));
+  }
+
+  void run(const ExecSpace& space) {
+    if (M == 0 || N == 0) return;
+    if (K == 0) {
+      Kokkos::parallel_for(
+          "KokkosBlas::gemm[packed,scale]",
+          Kokkos::RangePolicy<ExecSpace, ScaleTag>(space, 0, M), *this);
+      return;
+    }
+    const int concurrency     = space.concurrency();
+    const int num_row_blocks  = (M + MC - 1) / MC;
+    const size_t a_pack_bytes = APackType::shmem_size(size_t(MC) * KC);
+    B_pack = BPackType(
+        Kokkos::view_alloc(space, Kokkos::WithoutInitializing, "B_pack"),
+        size_t(NC) * KC);
+    for (jc = 0; jc < N; jc += NC) {
+      nc = N - jc < NC ? N - jc : NC;
+      const int num_slivers = (nc + NR - 1) / NR;
+      // split the columns of the panel in chunks until there is at least one
+      // team per thread
+      num_col_chunks = 1;
+      while (num_row_blocks * num_col_chunks < concurrency &&
+             num_col_chunks < num_slivers)
+        num_col_chunks++;
+      chunk_slivers  = (num_slivers + num_col_chunks - 1) / num_col_chunks;
+      num_col_chunks = (num_slivers + chunk_slivers - 1) / chunk_slivers;
+      for (pc = 0; pc < K; pc += KC) {
+        kc = K - pc < KC ? K - pc : KC;
+        Kokkos::parallel_for(
+            "KokkosBlas::gemm[packed,pack B]",
+            Kokkos::RangePolicy<ExecSpace, PackBTag>(space, 0, num_slivers),
+            *this);
+        Kokkos::parallel_for(
+            "KokkosBlas::gemm[packed]",
+            Kokkos::TeamPolicy<ExecSpace>(space,
+                                          num_row_blocks * num_col_chunks, 1)
+                .set_scratch_size(1, Kokkos::PerTeam(a_pack_bytes)),
+            *this);
+      }
+    }
+  }
+};
+
+template <class ExecSpace, class ViewTypeA, class ViewTypeB, class ViewTypeC,
+          int TransposeA, class Epilogue>
+void impl_gemm_packed_run(const ExecSpace& space, const char transB[],
+                          typename ViewTypeC::const_value_type& alpha,
+                          const ViewTypeA& A, const ViewTypeB& B,
+                          typename ViewTypeC::const_value_type& beta,
+                          const ViewTypeC& C, const Epilogue& epilogue) {
+  if (transB[0] == 'T' || transB[0] == 't') {
+    PackedGEMM<ExecSpace, ViewTypeA, ViewTypeB, ViewTypeC, TransposeA, 1,
+               Epilogue>
+        gemm(alpha, A, B, beta, C, epilogue);
+    gemm.run(space);
+  } else if (transB[0] == 'C' || transB[0] == 'c') {
+    PackedGEMM<ExecSpace, ViewTypeA, ViewTypeB, ViewTypeC, TransposeA, 2,
+               Epilogue>
+        gemm(alpha, A, B, beta, C, epilogue);
+    gemm.run(space);
+  } else {
+    PackedGEMM<ExecSpace, ViewTypeA, ViewTypeB, ViewTypeC, TransposeA, 0,
+               Epilogue>
+        gemm(alpha, A, B, beta, C, epilogue);
+    gemm.run(space);
+  }
+}
+
+// C = epilogue(beta * C + alpha * op(A) * op(B)) with PackedGEMM
+template <class ExecSpace, class ViewTypeA, class ViewTypeB, class ViewTypeC,
+          class Epilogue = GemmIdentityEpilogue>
+void impl_gemm_packed(const ExecSpace& space, const char transA[],
+                      const char transB[],
+                      typename ViewTypeC::const_value_type& alpha,
+                      const ViewTypeA& A, const ViewTypeB& B,
+                      typename ViewTypeC::const_value_type& beta,
+                      const ViewTypeC& C,
+                      const Epilogue& epilogue = Epilogue()) {
+  if (transA[0] == 'T' || transA[0] == 't')
+    impl_gemm_packed_run<ExecSpace, ViewTypeA, ViewTypeB, ViewTypeC, 1>(
+        space, transB, alpha, A, B, beta, C, epilogue);
+  else if (transA[0] == 'C' || transA[0] == 'c')
+    impl_gemm_packed_run<ExecSpace, ViewTypeA, ViewTypeB, ViewTypeC, 2>(
+        space, transB, alpha, A, B, beta, C, epilogue);
+  else
+    impl_gemm_packed_run<ExecSpace, ViewTypeA, ViewTypeB, ViewTypeC, 0>(
+        space, transB, alpha, A, B, beta, C, epilogue);
+}
+
+}  // namespace Impl
+}  // namespace KokkosBlas
+
+#endif  // KOKKOSBLAS3_GEMM_PACKED_IMPL_HPP_
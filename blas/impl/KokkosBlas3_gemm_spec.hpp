@@ -23,6 +23,8 @@
 #if !defined(KOKKOSKERNELS_ETI_ONLY) || KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
 #include "KokkosBlas3_gemm_impl.hpp"
 #include "KokkosBlas3_gemm_dotbased_impl.hpp"
+#include "KokkosBlas3_gemm_packed_impl.hpp"
+#include "KokkosBlas3_gemm_tensorcore_impl.hpp"
 #include "KokkosKernels_ExecSpaceUtils.hpp"
 #endif
 
@@ -116,11 +118,6 @@ struct GEMM {
     Kokkos::Profiling::pushRegion(KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
                                       ? "KokkosBlas::gemm[ETI]"
                                       : "KokkosBlas::gemm[noETI]");
-    // Figure out Scalar Types
-    typedef typename AViewType::non_const_value_type ScalarA;
-    typedef typename BViewType::non_const_value_type ScalarB;
-    typedef typename CViewType::non_const_value_type ScalarC;
-
     // Figure out whether to use DotBased implementation
     const int M = static_cast<int>(C.extent(0));
     const int N = static_cast<int>(C.extent(1));
@@ -134,6 +131,14 @@ struct GEMM {
     const bool B_is_tr = ((transB[0] == 'T') || (transB[0] == 't') ||
                           (transB[0] == 'C') || (transB[0] == 'c'));
 
+    // half_t or bhalf_t A and B, float C: tensor cores, when available
+    if constexpr (GemmTensorCoreAvailable<execution_space, AViewType,
+                                          BViewType, CViewType>::value) {
+      impl_gemm_tensor_core(space, transA, transB, alpha, A, B, beta, C);
+      Kokkos::Profiling::popRegion();
+      return;
+    }
+
     // NOTE: these thresholds were copied from TPL CUBLAS, and may need to be
     // retuned
     constexpr int numDotsLayoutLeftThreshold  = 1600;
@@ -150,124 +155,12 @@ struct GEMM {
           dotBasedGemm(alpha, A, B, beta, C);
       dotBasedGemm.run(space, A_is_conj);
 
+    } else if (!is_device_space) {
+      // packed, register-blocked GEMM for host execution spaces
+      impl_gemm_packed(space, transA, transB, alpha, A, B, beta, C);
     } else {
-      // Define Blocking sizes (this will be used for scratch spaces)
-      static constexpr int blockA0 = 24;
-      static constexpr int blockB1 = 64;
-      static constexpr int blockA1 =
-          (sizeof(ScalarA) * blockA0 * 16 + sizeof(ScalarB) * 16 * blockB1 +
-               sizeof(ScalarC) * blockA0 * blockB1 <
-           24000)
-              ? 16
-              : (sizeof(ScalarA) * blockA0 * 8 + sizeof(ScalarB) * 8 * blockB1 +
-                     sizeof(ScalarC) * blockA0 * blockB1 <
-                 24000)
-                    ? 8
-                    : (sizeof(ScalarA) * blockA0 * 4 +
-                           sizeof(ScalarB) * 4 * blockB1 +
-                           sizeof(ScalarC) * blockA0 * blockB1 <
-                       24000)
-                          ? 4
-                          : 16;
-      int vector_length = blockB1 / 4;
-      int max_vector_length =
-          KokkosKernels::Impl::kk_get_max_vector_size<execution_space>();
-      if (vector_length > max_vector_length) vector_length = max_vector_length;
-
-      // Compute scratch space size
-      typedef KokkosBlas::Impl::GEMMImpl<execution_space, AViewType, BViewType,
-                                         CViewType, blockA0, blockA1, blockB1,
-                                         0, 0>
-          gemm_dummy_type;
-      const int scratch_memory_size =
-          gemm_dummy_type::ViewTypeAScratch::required_allocation_size() +
-          gemm_dummy_type::ViewTypeBScratch::required_allocation_size() +
-          gemm_dummy_type::ViewTypeCScratch::required_allocation_size();
-      const int scratch_level = scratch_memory_size < 24000 ? 0 : 1;
-
-      // Figure out Team Sizes
-      int team_size = 1;
-#if defined(KOKKOS_ENABLE_CUDA)
-      if (std::is_same<execution_space, Kokkos::Cuda>::value)
-        team_size = blockA0;
-#endif
-#if defined(KOKKOS_ENABLE_HIP)
-      if (std::is_same<execution_space, Kokkos::HIP>::value)
-        team_size = blockA0;
-#endif
-#if defined(KOKKOS_ENABLE_ROCM)
-      if (std::is_same<execution_space, Kokkos::ROCm>::value)
-        team_size = blockA0;
-#endif
-#if defined(KOKKOS_ENABLE_SYCL)
-      if (std::is_same<execution_space, Kokkos::Experimental::SYCL>::value)
-        team_size = blockA0;
-#endif
-
-      // Call the correct kernel
-      if ((transA[0] == 'N' || transA[0] == 'n') &&
-          (transB[0] == 'N' || transB[0] == 'n')) {
-        KokkosBlas::Impl::GEMMImpl<execution_space, AViewType, BViewType,
-                                   CViewType, blockA0, blockA1, blockB1, 0, 0>
-            gemm(alpha, A, B, beta, C);
-        gemm.run(space, team_size, vector_length, scratch_level);
-      }
-      if ((transA[0] == 'T' || transA[0] == 't') &&
-          (transB[0] == 'N' || transB[0] == 'n')) {
-        KokkosBlas::Impl::GEMMImpl<execution_space, AViewType, BViewType,
-                                   CViewType, blockA0, blockA1, blockB1, 1, 0>
-            gemm(alpha, A, B, beta, C);
-        gemm.run(space, team_size, vector_length, scratch_level);
-      }
-      if ((transA[0] == 'C' || transA[0] == 'c') &&
-          (transB[0] == 'N' || transB[0] == 'n')) {
-        KokkosBlas::Impl::GEMMImpl<execution_space, AViewType, BViewType,
-                                   CViewType, blockA0, blockA1, blockB1, 2, 0>
-            gemm(alpha, A, B, beta, C);
-        gemm.run(space, team_size, vector_length, scratch_level);
-      }
-      if ((transA[0] == 'N' || transA[0] == 'n') &&
-          (transB[0] == 'T' || transB[0] == 't')) {
-        KokkosBlas::Impl::GEMMImpl<execution_space, AViewType, BViewType,
-                                   CViewType, blockA0, blockA1, blockB1, 0, 1>
-            gemm(alpha, A, B, beta, C);
-        gemm.run(space, team_size, vector_length, scratch_level);
-      }
-      if ((transA[0] == 'T' || transA[0] == 't') &&
-          (transB[0] == 'T' || transB[0] == 't')) {
-        KokkosBlas::Impl::GEMMImpl<execution_space, AViewType, BViewType,
-                                   CViewType, blockA0, blockA1, blockB1, 1, 1>
-            gemm(alpha, A, B, beta, C);
-        gemm.run(space, team_size, vector_length, scratch_level);
-      }
-      if ((transA[0] == 'C' || transA[0] == 'c') &&
-          (transB[0] == 'T' || transB[0] == 't')) {
-        KokkosBlas::Impl::GEMMImpl<execution_space, AViewType, BViewType,
-                                   CViewType, blockA0, blockA1, blockB1, 2, 1>
-            gemm(alpha, A, B, beta, C);
-        gemm.run(space, team_size, vector_length, scratch_level);
-      }
-      if ((transA[0] == 'N' || transA[0] == 'n') &&
-          (transB[0] == 'C' || transB[0] == 'c')) {
-        KokkosBlas::Impl::GEMMImpl<execution_space, AViewType, BViewType,
-                                   CViewType, blockA0, blockA1, blockB1, 0, 2>
-            gemm(alpha, A, B, beta, C);
-        gemm.run(space, team_size, vector_length, scratch_level);
-      }
-      if ((transA[0] == 'T' || transA[0] == 't') &&
-          (transB[0] == 'C' || transB[0] == 'c')) {
-        KokkosBlas::Impl::GEMMImpl<execution_space, AViewType, BViewType,
-                                   CViewType, blockA0, blockA1, blockB1, 1, 2>
-            gemm(alpha, A, B, beta, C);
-        gemm.run(space, team_size, vector_length, scratch_level);
-      }
-      if ((transA[0] == 'C' || transA[0] == 'c') &&
-          (transB[0] == 'C' || transB[0] == 'c')) {
-        KokkosBlas::Impl::GEMMImpl<execution_space, AViewType, BViewType,
-                                   CViewType, blockA0, blockA1, blockB1, 2, 2>
-            gemm(alpha, A, B, beta, C);
-        gemm.run(space, team_size, vector_length, scratch_level);
-      }
+      impl_gemm_tiled(space, transA, transB, alpha, A, B, beta, C,
+                      GemmIdentityEpilogue());
     }
     Kokkos::Profiling::popRegion();
   }
@@ -0,0 +1,285 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSBLAS3_GEMM_TENSORCORE_IMPL_HPP_
+#define KOKKOSBLAS3_GEMM_TENSORCORE_IMPL_HPP_
+
+#include "Kokkos_Core.hpp"
+#include "Kokkos_ArithTraits.hpp"
+#include <type_traits>
+
+// fp16 fragments need sm_70 or later, bf16 fragments sm_80 or later
+#if defined(KOKKOS_ENABLE_CUDA) &&                                 \
+    (defined(KOKKOS_ARCH_VOLTA) || defined(KOKKOS_ARCH_TURING75) || \
+     defined(KOKKOS_ARCH_AMPERE) || defined(KOKKOS_ARCH_ADA89) ||   \
+     defined(KOKKOS_ARCH_HOPPER))
+#define KOKKOSBLAS_IMPL_GEMM_TENSOR_CORES
+#include <mma.h>
+#if defined(KOKKOS_ARCH_AMPERE) || defined(KOKKOS_ARCH_ADA89) || \
+    defined(KOKKOS_ARCH_HOPPER)
+#define KOKKOSBLAS_IMPL_GEMM_TENSOR_CORES_BF16
+#include <cuda_bf16.h>
+#endif
+#endif
+
+namespace KokkosBlas {
+namespace Impl {
+
+// The fragment scalar type of A and B for a scalar type of A and B, if
+// tensor cores support it
+template <class Scalar>
+struct GemmTensorCoreFragScalar {
+  static constexpr bool available = false;
+};
+
+#if defined(KOKKOSBLAS_IMPL_GEMM_TENSOR_CORES) && \
+    defined(KOKKOS_HALF_T_IS_FLOAT) && !KOKKOS_HALF_T_IS_FLOAT
+template <>
+struct GemmTensorCoreFragScalar<Kokkos::Experimental::half_t> {
+  static constexpr bool available = true;
+  using type                      = __half;
+};
+#endif
+
+#if defined(KOKKOSBLAS_IMPL_GEMM_TENSOR_CORES_BF16) && \
+    defined(KOKKOS_BHALF_T_IS_FLOAT) && !KOKKOS_BHALF_T_IS_FLOAT
+template <>
+struct GemmTensorCoreFragScalar<Kokkos::Experimental::bhalf_t> {
+  static constexpr bool available = true;
+  using type                      = __nv_bfloat16;
+};
+#endif
+
+/// \brief Whether C := beta*C + alpha*op(A)*op(B) can run on tensor cores:
+/// A and B are half_t, or both bhalf_t, C is float and the execution space
+/// is Cuda, on an architecture with the matching fragments.
+template <class ExecSpace, class AViewType, class BViewType, class CViewType>
+struct GemmTensorCoreAvailable {
+  using ScalarA = typename AViewType::non_const_value_type;
+  using ScalarB = typename BViewType::non_const_value_type;
+  using ScalarC = typename CViewType::non_const_value_type;
+#ifdef KOKKOSBLAS_IMPL_GEMM_TENSOR_CORES
+  static constexpr bool value =
+      std::is_same_v<ExecSpace, Kokkos::Cuda> &&
+      std::is_same_v<ScalarA, ScalarB> &&
+      GemmTensorCoreFragScalar<ScalarA>::available &&
+      std::is_same_v<ScalarC, float>;
+#else
+  static constexpr bool value = false;
+#endif
+};
+
+#ifdef KOKKOSBLAS_IMPL_GEMM_TENSOR_CORES
+
+/// \brief GEMM with tensor cores, C := beta*C + alpha*op(A)*op(B), for A and
+/// B in 16-bit floating point and C in float.
+///
+/// Each team of 2x2 warps computes a TEAM_M x TEAM_N tile of C, each warp a
+/// 2x2 block of FRAG_M x FRAG_N fragments accumulated in float. The panels of
+/// op(A) and op(B) for TEAM_K consecutive k are staged through shared memory,
+/// where they are converted to the fragment type, transposed (and
+/// conjugated, a no-op for real types) as needed and padded with zeros past
+/// the edges of the matrices. alpha and beta are applied in float when the
+/// accumulators are written back.
+template <class AViewType, class BViewType, class CViewType, bool A_T,
+          bool B_T>
+struct GemmTensorCoreFunctor {
+  using ScalarA     = typename AViewType::non_const_value_type;
+  using ScalarC     = typename CViewType::non_const_value_type;
+  using FragScalar  = typename GemmTensorCoreFragScalar<ScalarA>::type;
+  using team_member = typename Kokkos::TeamPolicy<Kokkos::Cuda>::member_type;
+
+  static constexpr int FRAG_M           = 16;
+  static constexpr int FRAG_N           = 16;
+  static constexpr int FRAG_K           = 16;
+  static constexpr int WARPS_M          = 2;
+  static constexpr int WARPS_N          = 2;
+  static constexpr int WARP_FRAGS_M     = 2;
+  static constexpr int WARP_FRAGS_N     = 2;
+  static constexpr int TEAM_M           = WARPS_M * WARP_FRAGS_M * FRAG_M;
+  static constexpr int TEAM_N           = WARPS_N * WARP_FRAGS_N * FRAG_N;
+  static constexpr int TEAM_K           = 2 * FRAG_K;
+  static constexpr int THREADS_PER_WARP = 32;
+  static constexpr int TEAM_SIZE = WARPS_M * WARPS_N * THREADS_PER_WARP;
+  // wmma loads and stores need 256-bit aligned pointers
+  static constexpr size_t SCRATCH_ALIGN = 32;
+
+  using FragA = nvcuda::wmma::fragment<nvcuda::wmma::matrix_a, FRAG_M, FRAG_N,
+                                       FRAG_K, FragScalar,
+                                       nvcuda::wmma::row_major>;
+  using FragB = nvcuda::wmma::fragment<nvcuda::wmma::matrix_b, FRAG_M, FRAG_N,
+                                       FRAG_K, FragScalar,
+                                       nvcuda::wmma::row_major>;
+  using FragC = nvcuda::wmma::fragment<nvcuda::wmma::accumulator, FRAG_M,
+                                       FRAG_N, FRAG_K, float>;
+
+  AViewType A;
+  BViewType B;
+  CViewType C;
+  float alpha;
+  float beta;
+  int M, N, K;
+  int teamsN;
+
+  GemmTensorCoreFunctor(float alpha_, const AViewType& A_,
+                        const BViewType& B_, float beta_, const CViewType& C_)
+      : A(A_),
+        B(B_),
+        C(C_),
+        alpha(alpha_),
+        beta(beta_),
+        M(C_.extent(0)),
+        N(C_.extent(1)),
+        K(A_T ? A_.extent(0) : A_.extent(1)),
+        teamsN((N + TEAM_N - 1) / TEAM_N) {}
+
+  static size_t team_scratch_size() {
+    return (TEAM_M * TEAM_K + TEAM_K * TEAM_N) * sizeof(FragScalar) +
+           TEAM_M * TEAM_N * sizeof(float) + 3 * SCRATCH_ALIGN;
+  }
+
+  int league_size() const {
+    return ((M + TEAM_M - 1) / TEAM_M) * teamsN;
+  }
+
+  KOKKOS_INLINE_FUNCTION FragScalar opA(int i, int k) const {
+    if (i >= M || k >= K) return FragScalar(0.0f);
+    return FragScalar(float(A_T ? A(k, i) : A(i, k)));
+  }
+
+  KOKKOS_INLINE_FUNCTION FragScalar opB(int k, int j) const {
+    if (k >= K || j >= N) return FragScalar(0.0f);
+    return FragScalar(float(B_T ? B(j, k) : B(k, j)));
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const team_member& mbr) const {
+    using nvcuda::wmma::fill_fragment;
+    using nvcuda::wmma::load_matrix_sync;
+    using nvcuda::wmma::mma_sync;
+    using nvcuda::wmma::store_matrix_sync;
+
+    const int i0   = (mbr.league_rank() / teamsN) * TEAM_M;
+    const int j0   = (mbr.league_rank() % teamsN) * TEAM_N;
+    const int rank = mbr.team_rank();
+    const int warp = rank / THREADS_PER_WARP;
+    const int wi   = (warp / WARPS_N) * WARP_FRAGS_M * FRAG_M;
+    const int wj   = (warp % WARPS_N) * WARP_FRAGS_N * FRAG_N;
+
+    FragScalar* sa = (FragScalar*)mbr.team_shmem().get_shmem_aligned(
+        TEAM_M * TEAM_K * sizeof(FragScalar), SCRATCH_ALIGN);
+    FragScalar* sb = (FragScalar*)mbr.team_shmem().get_shmem_aligned(
+        TEAM_K * TEAM_N * sizeof(FragScalar), SCRATCH_ALIGN);
+    float* sc = (float*)mbr.team_shmem().get_shmem_aligned(
+        TEAM_M * TEAM_N * sizeof(float), SCRATCH_ALIGN);
+
+    FragA fa[WARP_FRAGS_M];
+    FragB fb[WARP_FRAGS_N];
+    FragC fc[WARP_FRAGS_M][WARP_FRAGS_N];
+    for (int fi = 0; fi < WARP_FRAGS_M; fi++)
+      for (int fj = 0; fj < WARP_FRAGS_N; fj++) fill_fragment(fc[fi][fj], 0.0f);
+
+    for (int k0 = 0; k0 < K; k0 += TEAM_K) {
+      // The previous fragments are loaded before sa and sb change
+      mbr.team_barrier();
+      for (int q = rank; q < TEAM_M * TEAM_K; q += TEAM_SIZE)
+        sa[q] = opA(i0 + q / TEAM_K, k0 + q % TEAM_K);
+      for (int q = rank; q < TEAM_K * TEAM_N; q += TEAM_SIZE)
+        sb[q] = opB(k0 + q / TEAM_N, j0 + q % TEAM_N);
+      mbr.team_barrier();
+      for (int kk = 0; kk < TEAM_K; kk += FRAG_K) {
+        for (int fi = 0; fi < WARP_FRAGS_M; fi++)
+          load_matrix_sync(fa[fi], sa + (wi + fi * FRAG_M) * TEAM_K + kk,
+                           TEAM_K);
+        for (int fj = 0; fj < WARP_FRAGS_N; fj++)
+          load_matrix_sync(fb[fj], sb + kk * TEAM_N + wj + fj * FRAG_N,
+                           TEAM_N);
+        for (int fi = 0; fi < WARP_FRAGS_M; fi++)
+          for (int fj = 0; fj < WARP_FRAGS_N; fj++)
+            mma_sync(fc[fi][fj], fa[fi], fb[fj], fc[fi][fj]);
+      }
+    }
+
+    for (int fi = 0; fi < WARP_FRAGS_M; fi++)
+      for (int fj = 0; fj < WARP_FRAGS_N; fj++)
+        store_matrix_sync(sc + (wi + fi * FRAG_M) * TEAM_N + wj + fj * FRAG_N,
+                          fc[fi][fj], TEAM_N, nvcuda::wmma::mem_row_major);
+    mbr.team_barrier();
+    for (int q = rank; q < TEAM_M * TEAM_N; q += TEAM_SIZE) {
+      const int i = i0 + q / TEAM_N, j = j0 + q % TEAM_N;
+      if (i >= M || j >= N) continue;
+      // C is not read when beta is zero, so that NaNs in C don't propagate
+      C(i, j) = (beta == 0.0f) ? alpha * sc[q] : beta * C(i, j) + alpha * sc[q];
+    }
+  }
+
+  void run(const Kokkos::Cuda& space) const {
+    Kokkos::TeamPolicy<Kokkos::Cuda> policy(space, league_size(), TEAM_SIZE);
+    policy.set_scratch_size(0, Kokkos::PerTeam(team_scratch_size()));
+    Kokkos::parallel_for("KokkosBlas::gemm[TensorCores]", policy, *this);
+  }
+};
+
+#endif  // KOKKOSBLAS_IMPL_GEMM_TENSOR_CORES
+
+/// \brief C := beta*C + alpha*op(A)*op(B) on tensor cores. Only call it when
+/// GemmTensorCoreAvailable is true; otherwise it does nothing.
+template <class ExecSpace, class AViewType, class BViewType, class CViewType>
+void impl_gemm_tensor_core(const ExecSpace& space, const char transA[],
+                           const char transB[],
+                           typename AViewType::const_value_type& alpha,
+                           const AViewType& A, const BViewType& B,
+                           typename CViewType::const_value_type& beta,
+                           const CViewType& C) {
+#ifdef KOKKOSBLAS_IMPL_GEMM_TENSOR_CORES
+  if constexpr (GemmTensorCoreAvailable<ExecSpace, AViewType, BViewType,
+                                        CViewType>::value) {
+    const bool A_t   = !(transA[0] == 'N' || transA[0] == 'n');
+    const bool B_t   = !(transB[0] == 'N' || transB[0] == 'n');
+    const float a    = float(alpha);
+    const float b    = float(beta);
+    using functor_nn = GemmTensorCoreFunctor<AViewType, BViewType, CViewType,
+                                             false, false>;
+    using functor_nt = GemmTensorCoreFunctor<AViewType, BViewType, CViewType,
+                                             false, true>;
+    using functor_tn = GemmTensorCoreFunctor<AViewType, BViewType, CViewType,
+                                             true, false>;
+    using functor_tt = GemmTensorCoreFunctor<AViewType, BViewType, CViewType,
+                                             true, true>;
+    if (!A_t && !B_t)
+      functor_nn(a, A, B, b, C).run(space);
+    else if (!A_t)
+      functor_nt(a, A, B, b, C).run(space);
+    else if (!B_t)
+      functor_tn(a, A, B, b, C).run(space);
+    else
+      functor_tt(a, A, B, b, C).run(space);
+    return;
+  }
+#endif
+  (void)space;
+  (void)transA;
+  (void)transB;
+  (void)alpha;
+  (void)A;
+  (void)B;
+  (void)beta;
+  (void)C;
+}
+
+}  // namespace Impl
+}  // namespace KokkosBlas
+
+#endif  // KOKKOSBLAS3_GEMM_TENSORCORE_IMPL_HPP_
@@ -0,0 +1,163 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef KOKKOSBLAS3_SYR2K_SPEC_HPP_
+#define KOKKOSBLAS3_SYR2K_SPEC_HPP_
+
+#include "KokkosKernels_config.h"
+#include "Kokkos_Core.hpp"
+
+#if !defined(KOKKOSKERNELS_ETI_ONLY) || KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+#include <KokkosBlas3_syrk_impl.hpp>
+#endif
+
+namespace KokkosBlas {
+namespace Impl {
+// Specialization struct which defines whether a specialization exists
+template <class execution_space, class AVIT, class BVIT, class CVIT>
+struct syr2k_eti_spec_avail {
+  enum : bool { value = false };
+};
+}  // namespace Impl
+}  // namespace KokkosBlas
+
+//
+// This Macro is for readability of the template arguments.
+//
+#define KOKKOSBLAS3_SYR2K_ETI_SPEC_AVAIL_LAYOUT(SCALAR, LAYOUTA, LAYOUTC,    \
+                                                EXEC_SPACE, MEM_SPACE)       \
+  template <>                                                                \
+  struct syr2k_eti_spec_avail<                                               \
+      EXEC_SPACE,                                                            \
+      Kokkos::View<const SCALAR**, LAYOUTA,                                  \
+                   Kokkos::Device<EXEC_SPACE, MEM_SPACE>,                    \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                \
+      Kokkos::View<const SCALAR**, LAYOUTA,                                  \
+                   Kokkos::Device<EXEC_SPACE, MEM_SPACE>,                    \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                \
+      Kokkos::View<SCALAR**, LAYOUTC, Kokkos::Device<EXEC_SPACE, MEM_SPACE>, \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> > > {             \
+    enum : bool { value = true };                                            \
+  };
+
+//
+// This Macros provides the ETI specialization of syr2k
+//
+#define KOKKOSBLAS3_SYR2K_ETI_SPEC_AVAIL(SCALAR, LAYOUT, EXEC_SPACE,          \
+                                         MEM_SPACE)                           \
+  KOKKOSBLAS3_SYR2K_ETI_SPEC_AVAIL_LAYOUT(SCALAR, LAYOUT, LAYOUT, EXEC_SPACE, \
+                                          MEM_SPACE)
+
+// Include the actual specialization declarations
+#include <KokkosBlas3_syr2k_tpl_spec_avail.hpp>
+#include <generated_specializations_hpp/KokkosBlas3_syr2k_eti_spec_avail.hpp>
+
+namespace KokkosBlas {
+namespace Impl {
+
+//
+// syr2k
+//
+
+// Unification layer
+template <class execution_space, class AVIT, class BVIT, class CVIT,
+          bool tpl_spec_avail =
+              syr2k_tpl_spec_avail<execution_space, AVIT, BVIT, CVIT>::value,
+          bool eti_spec_avail =
+              syr2k_eti_spec_avail<execution_space, AVIT, BVIT, CVIT>::value>
+struct SYR2K {
+  static void syr2k(const execution_space& space, const char uplo[],
+                    const char trans[], typename CVIT::const_value_type& alpha,
+                    const AVIT& A, const BVIT& B,
+                    typename CVIT::const_value_type& beta, const CVIT& C);
+};
+
+#if !defined(KOKKOSKERNELS_ETI_ONLY) || KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+template <class execution_space, class AVIT, class BVIT, class CVIT>
+struct SYR2K<execution_space, AVIT, BVIT, CVIT, false,
+             KOKKOSKERNELS_IMPL_COMPILE_LIBRARY> {
+  static void syr2k(const execution_space& space, const char uplo[],
+                    const char trans[], typename CVIT::const_value_type& alpha,
+                    const AVIT& A, const BVIT& B,
+                    typename CVIT::const_value_type& beta, const CVIT& C) {
+    static_assert(Kokkos::is_view<AVIT>::value, "AVIT must be a Kokkos::View.");
+    static_assert(Kokkos::is_view<BVIT>::value, "BVIT must be a Kokkos::View.");
+    static_assert(Kokkos::is_view<CVIT>::value, "CVIT must be a Kokkos::View.");
+    static_assert(static_cast<int>(AVIT::rank) == 2, "AVIT must have rank 2.");
+    static_assert(static_cast<int>(BVIT::rank) == 2, "BVIT must have rank 2.");
+    static_assert(static_cast<int>(CVIT::rank) == 2, "CVIT must have rank 2.");
+
+    Kokkos::Profiling::pushRegion(KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+                                      ? "KokkosBlas::syr2k[ETI]"
+                                      : "KokkosBlas::syr2k[noETI]");
+    impl_syrk(space, uplo, trans, false, true, alpha, A, B, beta, C);
+    Kokkos::Profiling::popRegion();
+  }
+};
+#endif  //! defined(KOKKOSKERNELS_ETI_ONLY) ||
+        //! KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+
+}  // namespace Impl
+}  // namespace KokkosBlas
+
+//
+// These Macros are for readability.
+//
+#define KOKKOSBLAS3_SYR2K_ETI_SPEC_DECL_LAYOUTS(SCALAR, LAYOUTA, LAYOUTC,    \
+                                                EXEC_SPACE, MEM_SPACE)       \
+  extern template struct SYR2K<                                              \
+      EXEC_SPACE,                                                            \
+      Kokkos::View<const SCALAR**, LAYOUTA,                                  \
+                   Kokkos::Device<EXEC_SPACE, MEM_SPACE>,                    \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                \
+      Kokkos::View<const SCALAR**, LAYOUTA,                                  \
+                   Kokkos::Device<EXEC_SPACE, MEM_SPACE>,                    \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                \
+      Kokkos::View<SCALAR**, LAYOUTC, Kokkos::Device<EXEC_SPACE, MEM_SPACE>, \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                \
+      false, true>;
+
+#define KOKKOSBLAS3_SYR2K_ETI_SPEC_INST_LAYOUTS(SCALAR, LAYOUTA, LAYOUTC,    \
+                                                EXEC_SPACE, MEM_SPACE)       \
+  template struct SYR2K<                                                     \
+      EXEC_SPACE,                                                            \
+      Kokkos::View<const SCALAR**, LAYOUTA,                                  \
+                   Kokkos::Device<EXEC_SPACE, MEM_SPACE>,                    \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                \
+      Kokkos::View<const SCALAR**, LAYOUTA,                                  \
+                   Kokkos::Device<EXEC_SPACE, MEM_SPACE>,                    \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                \
+      Kokkos::View<SCALAR**, LAYOUTC, Kokkos::Device<EXEC_SPACE, MEM_SPACE>, \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                \
+      false, true>;
+
+//
+// These Macros are only included when we are not compiling libkokkoskernels but
+// are auto generating files. These macros provide the explicit instantiation
+// declaration and definition of SYR2K, potentially reducing user code size.
+// The "extern template" skips the implicit instatiation step ensuring that the
+// callers code uses this explicit instantiation definition of SYR2K.
+//
+#define KOKKOSBLAS3_SYR2K_ETI_SPEC_DECL(SCALAR, LAYOUT, EXEC_SPACE, MEM_SPACE) \
+  KOKKOSBLAS3_SYR2K_ETI_SPEC_DECL_LAYOUTS(SCALAR, LAYOUT, LAYOUT, EXEC_SPACE,  \
+                                          MEM_SPACE)
+
+#define KOKKOSBLAS3_SYR2K_ETI_SPEC_INST(SCALAR, LAYOUT, EXEC_SPACE, MEM_SPACE) \
+  KOKKOSBLAS3_SYR2K_ETI_SPEC_INST_LAYOUTS(SCALAR, LAYOUT, LAYOUT, EXEC_SPACE,  \
+                                          MEM_SPACE)
+
+#include <KokkosBlas3_syr2k_tpl_spec_decl.hpp>
+
+#endif  // KOKKOSBLAS3_SYR2K_SPEC_HPP_
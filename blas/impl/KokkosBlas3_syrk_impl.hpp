@@ -0,0 +1,137 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef KOKKOSBLAS3_SYRK_IMPL_HPP_
+#define KOKKOSBLAS3_SYRK_IMPL_HPP_
+
+#include "KokkosKernels_config.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_ArithTraits.hpp"
+
+namespace KokkosBlas {
+namespace Impl {
+
+/// \brief Native rank-k (syrk, herk) and rank-2k (syr2k) update of one
+/// triangle of the N-by-N matrix C:
+///
+///   syrk:  C := beta*C + alpha*op(A)*op(A)^T
+///   herk:  C := beta*C + alpha*op(A)*op(A)^H
+///   syr2k: C := beta*C + alpha*op(A)*op(B)^T + alpha*op(B)*op(A)^T
+///
+/// C is cut into TILE x TILE tiles and only the tiles that intersect the
+/// requested triangle are visited, one team per tile, so about half of the
+/// flops of the equivalent GEMM are done. The other triangle is not touched.
+template <class ExecSpace, class AViewType, class BViewType, class CViewType>
+struct SyrkFunctor {
+  using ScalarC     = typename CViewType::non_const_value_type;
+  using AT          = Kokkos::ArithTraits<ScalarC>;
+  using team_member = typename Kokkos::TeamPolicy<ExecSpace>::member_type;
+
+  static constexpr int TILE = 32;
+
+  SyrkFunctor(const char uplo[], const char trans[], const bool hermitian_,
+              const bool rank2k_, const ScalarC& alpha_, const AViewType& A_,
+              const BViewType& B_, const ScalarC& beta_, const CViewType& C_)
+      : lower(uplo[0] == 'L' || uplo[0] == 'l'),
+        notr(trans[0] == 'N' || trans[0] == 'n'),
+        hermitian(hermitian_),
+        rank2k(rank2k_),
+        N(C_.extent(0)),
+        K(notr ? A_.extent(1) : A_.extent(0)),
+        alpha(alpha_),
+        beta(beta_),
+        A(A_),
+        B(B_),
+        C(C_) {}
+
+  static int num_tiles(const int n) {
+    const int nt = (n + TILE - 1) / TILE;
+    return nt * (nt + 1) / 2;
+  }
+
+  // op(X)(i, k), without the conjugation of a Hermitian update
+  template <class XViewType>
+  KOKKOS_INLINE_FUNCTION ScalarC op(const XViewType& X, const int i,
+                                    const int k) const {
+    return notr ? ScalarC(X(i, k)) : ScalarC(X(k, i));
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const team_member& t) const {
+    // (ti, tj), ti >= tj, is the t-th tile of the packed lower triangle; the
+    // floating point guess is corrected for rounding
+    const int p = t.league_rank();
+    int ti      = static_cast<int>((Kokkos::sqrt(8.0 * p + 1.0) - 1.0) / 2.0);
+    while (ti * (ti + 1) / 2 > p) --ti;
+    while ((ti + 1) * (ti + 2) / 2 <= p) ++ti;
+    const int tj = p - ti * (ti + 1) / 2;
+    const int r0 = (lower ? ti : tj) * TILE;
+    const int c0 = (lower ? tj : ti) * TILE;
+
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(t, TILE * TILE), [&](const int rc) {
+          // consecutive threads take consecutive rows
+          const int i = r0 + rc % TILE, j = c0 + rc / TILE;
+          if (i >= N || j >= N || (lower ? j > i : j < i)) return;
+          ScalarC sum = AT::zero();
+          if (rank2k) {
+            for (int k = 0; k < K; k++)
+              sum += op(A, i, k) * op(B, j, k) + op(B, i, k) * op(A, j, k);
+          } else if (hermitian && notr) {
+            for (int k = 0; k < K; k++)
+              sum += A(i, k) * AT::conj(ScalarC(A(j, k)));
+          } else if (hermitian) {
+            for (int k = 0; k < K; k++)
+              sum += AT::conj(ScalarC(A(k, i))) * A(k, j);
+          } else {
+            for (int k = 0; k < K; k++) sum += op(A, i, k) * op(A, j, k);
+          }
+          // C is not read when beta is zero, so that NaNs in C don't propagate
+          ScalarC c = beta == AT::zero() ? alpha * sum
+                                         : beta * C(i, j) + alpha * sum;
+          // the diagonal of a Hermitian matrix is real, as in the BLAS
+          if (hermitian && i == j) c = ScalarC(AT::real(c));
+          C(i, j) = c;
+        });
+  }
+
+  bool lower, notr, hermitian, rank2k;
+  int N, K;
+  ScalarC alpha, beta;
+  AViewType A;
+  BViewType B;
+  CViewType C;
+};
+
+template <class ExecSpace, class AViewType, class BViewType, class CViewType>
+void impl_syrk(const ExecSpace& space, const char uplo[], const char trans[],
+               const bool hermitian, const bool rank2k,
+               typename CViewType::const_value_type& alpha, const AViewType& A,
+               const BViewType& B, typename CViewType::const_value_type& beta,
+               const CViewType& C) {
+  using functor_t = SyrkFunctor<ExecSpace, AViewType, BViewType, CViewType>;
+  const char* label = rank2k      ? "KokkosBlas::syr2k[native]"
+                      : hermitian ? "KokkosBlas::herk[native]"
+                                  : "KokkosBlas::syrk[native]";
+  Kokkos::parallel_for(
+      label,
+      Kokkos::TeamPolicy<ExecSpace>(space, functor_t::num_tiles(C.extent(0)),
+                                    Kokkos::AUTO),
+      functor_t(uplo, trans, hermitian, rank2k, alpha, A, B, beta, C));
+}
+
+}  // namespace Impl
+}  // namespace KokkosBlas
+
+#endif  // KOKKOSBLAS3_SYRK_IMPL_HPP_
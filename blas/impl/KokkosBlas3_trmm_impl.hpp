@@ -27,6 +27,7 @@
 #include "Kokkos_ArithTraits.hpp"
 #include "KokkosBatched_Trmm_Decl.hpp"
 #include "KokkosBatched_Trmm_Serial_Impl.hpp"
+#include "KokkosBlas3_gemm_spec.hpp"
 
 namespace KokkosBlas {
 namespace Impl {
@@ -127,6 +128,172 @@ void SerialTrmm_Invoke(const char side[], const char uplo[], const char trans[],
         B.extent(0), B.extent(1), alpha, A.data(), A.stride(1), A.stride(0),
         B.data(), B.stride(0), B.stride(1));
 }
+
+/// \brief Multiplies one block of a recursive TRMM: each right-hand side (a
+/// column of B for side == L, a row for side == R) is handed to one thread,
+/// which runs the serial batched TRMM on it. A transpose swaps the strides
+/// of A, as in SerialTrmm_Invoke.
+template <class AViewType, class BViewType>
+struct TrmmBlockLeafFunctor {
+  using ScalarB = typename BViewType::non_const_value_type;
+
+  TrmmBlockLeafFunctor(const bool right_, const bool lower, const bool notr,
+                       const bool conj_, const ScalarB& alpha_,
+                       const AViewType& A_, const BViewType& B_)
+      : right(right_),
+        conj(conj_),
+        mult_lower(lower == notr),
+        swap_A(!notr),
+        alpha(alpha_),
+        A(A_),
+        B(B_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const int r) const {
+    using KokkosBatched::Algo;
+    using KokkosBatched::Diag;
+    const int m   = A.extent(0);
+    const int as0 = swap_A ? A.stride(1) : A.stride(0);
+    const int as1 = swap_A ? A.stride(0) : A.stride(1);
+    const int bs0 = B.stride(0), bs1 = B.stride(1);
+    const auto* a = A.data();
+    // Ignoring diag, see "ech-note" in KokkosBatched_Trmm_Serial_Internal.hpp
+    if (right) {
+      ScalarB* x = &B(r, 0);
+      if (mult_lower)
+        KokkosBatched::SerialTrmmInternalRightLower<Algo::Trmm::Unblocked>::
+            invoke(Diag::Unit::use_unit_diag, conj, m, m, 1, m, alpha, a, as0,
+                   as1, x, bs0, bs1);
+      else
+        KokkosBatched::SerialTrmmInternalRightUpper<Algo::Trmm::Unblocked>::
+            invoke(Diag::Unit::use_unit_diag, conj, m, m, 1, m, alpha, a, as0,
+                   as1, x, bs0, bs1);
+    } else {
+      ScalarB* x = &B(0, r);
+      if (mult_lower)
+        KokkosBatched::SerialTrmmInternalLeftLower<Algo::Trmm::Unblocked>::
+            invoke(Diag::Unit::use_unit_diag, conj, m, m, m, 1, alpha, a, as0,
+                   as1, x, bs0, bs1);
+      else
+        KokkosBatched::SerialTrmmInternalLeftUpper<Algo::Trmm::Unblocked>::
+            invoke(Diag::Unit::use_unit_diag, conj, m, m, m, 1, alpha, a, as0,
+                   as1, x, bs0, bs1);
+    }
+  }
+
+  bool right, conj, mult_lower, swap_A;
+  ScalarB alpha;
+  AViewType A;
+  BViewType B;
+};
+
+// Order of the diagonal blocks that impl_trmm_recursive stops splitting at
+constexpr int trmm_recursive_block = 64;
+
+/// \brief Recursive blocked TRMM, B := alpha*op(A)*B or B := alpha*B*op(A).
+///
+/// A is split in two at a multiple of the block size; the two triangular
+/// halves are applied recursively and the coupling block with GEMM, so that
+/// for large A nearly all of the flops run in GEMM. The halves are ordered so
+/// that the GEMM reads the part of B that has not been overwritten yet.
+///
+/// As in impl_trsm_recursive, A and B are LayoutStride views and the GEMMs
+/// call the native specialization directly.
+template <class ExecSpace, class AViewType, class BViewType>
+void impl_trmm_recursive(const ExecSpace& space, const char side[],
+                         const char uplo[], const char trans[],
+                         const char diag[],
+                         typename BViewType::const_value_type& alpha,
+                         const AViewType& A, const BViewType& B) {
+  using ScalarB    = typename BViewType::non_const_value_type;
+  using CBViewType = Kokkos::View<typename BViewType::const_data_type,
+                                  typename BViewType::array_layout,
+                                  typename BViewType::device_type,
+                                  Kokkos::MemoryTraits<Kokkos::Unmanaged> >;
+  using pair_t     = Kokkos::pair<int, int>;
+  const bool right = side[0] == 'R' || side[0] == 'r';
+  const bool lower = uplo[0] == 'L' || uplo[0] == 'l';
+  const bool notr  = trans[0] == 'N' || trans[0] == 'n';
+  const int K      = A.extent(0);
+  const int nrhs   = right ? B.extent(0) : B.extent(1);
+  if (K == 0 || nrhs == 0) return;
+
+  if (K <= trmm_recursive_block) {
+    Kokkos::parallel_for(
+        "KokkosBlas::trmm[recursive leaf]",
+        Kokkos::RangePolicy<ExecSpace>(space, 0, nrhs),
+        TrmmBlockLeafFunctor<AViewType, BViewType>(
+            right, lower, notr, trans[0] == 'C' || trans[0] == 'c', alpha, A,
+            B));
+    return;
+  }
+
+  // Split at k, a multiple of the block size close to K / 2
+  const int k = ((K / 2 + trmm_recursive_block - 1) / trmm_recursive_block) *
+                trmm_recursive_block;
+  const pair_t p1(0, k), p2(k, K);
+  AViewType A11 = Kokkos::subview(A, p1, p1);
+  AViewType A22 = Kokkos::subview(A, p2, p2);
+  // The blocks below and above the diagonal of op(A), as GEMM sees them
+  const char* trans_off = notr ? "N" : trans;
+  AViewType Off21       = notr ? Kokkos::subview(A, p2, p1)
+                               : Kokkos::subview(A, p1, p2);
+  AViewType Off12       = notr ? Kokkos::subview(A, p1, p2)
+                               : Kokkos::subview(A, p2, p1);
+  BViewType B1 = right ? Kokkos::subview(B, Kokkos::ALL(), p1)
+                       : Kokkos::subview(B, p1, Kokkos::ALL());
+  BViewType B2 = right ? Kokkos::subview(B, Kokkos::ALL(), p2)
+                       : Kokkos::subview(B, p2, Kokkos::ALL());
+  const ScalarB one(1);
+  // op(A) is lower triangular
+  const bool lower_eff = lower == notr;
+
+  if (!right) {
+    using gemm_t = GEMM<ExecSpace, AViewType, CBViewType, BViewType, false,
+                        KOKKOSKERNELS_IMPL_COMPILE_LIBRARY>;
+    if (lower_eff) {
+      impl_trmm_recursive(space, side, uplo, trans, diag, alpha, A22, B2);
+      gemm_t::gemm(space, trans_off, "N", alpha, Off21, B1, one, B2);
+      impl_trmm_recursive(space, side, uplo, trans, diag, alpha, A11, B1);
+    } else {
+      impl_trmm_recursive(space, side, uplo, trans, diag, alpha, A11, B1);
+      gemm_t::gemm(space, trans_off, "N", alpha, Off12, B2, one, B1);
+      impl_trmm_recursive(space, side, uplo, trans, diag, alpha, A22, B2);
+    }
+  } else {
+    using gemm_t = GEMM<ExecSpace, CBViewType, AViewType, BViewType, false,
+                        KOKKOSKERNELS_IMPL_COMPILE_LIBRARY>;
+    if (lower_eff) {
+      impl_trmm_recursive(space, side, uplo, trans, diag, alpha, A11, B1);
+      gemm_t::gemm(space, "N", trans_off, alpha, B2, Off21, one, B1);
+      impl_trmm_recursive(space, side, uplo, trans, diag, alpha, A22, B2);
+    } else {
+      impl_trmm_recursive(space, side, uplo, trans, diag, alpha, A22, B2);
+      gemm_t::gemm(space, "N", trans_off, alpha, B1, Off12, one, B2);
+      impl_trmm_recursive(space, side, uplo, trans, diag, alpha, A11, B1);
+    }
+  }
+}
+
+/// \brief Native TRMM: runs impl_trmm_recursive on LayoutStride views of A
+/// and B, on the execution space of the call.
+template <class ExecSpace, class AViewType, class BViewType>
+void impl_trmm_blocked(const ExecSpace& space, const char side[],
+                       const char uplo[], const char trans[], const char diag[],
+                       typename BViewType::const_value_type& alpha,
+                       const AViewType& A, const BViewType& B) {
+  using AStrideType = Kokkos::View<typename AViewType::const_value_type**,
+                                   Kokkos::LayoutStride,
+                                   typename AViewType::device_type,
+                                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >;
+  using BStrideType = Kokkos::View<typename BViewType::non_const_value_type**,
+                                   Kokkos::LayoutStride,
+                                   typename BViewType::device_type,
+                                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >;
+  AStrideType A_s(A);
+  BStrideType B_s(B);
+  impl_trmm_recursive(space, side, uplo, trans, diag, alpha, A_s, B_s);
+}
+
 }  // namespace Impl
 }  // namespace KokkosBlas
 #endif  // KOKKOSBLAS3_TRMM_IMPL_HPP_
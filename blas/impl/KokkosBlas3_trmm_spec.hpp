@@ -84,7 +84,7 @@ struct TRMM {
 template <class execution_space, class AVIT, class BVIT>
 struct TRMM<execution_space, AVIT, BVIT, false,
             KOKKOSKERNELS_IMPL_COMPILE_LIBRARY> {
-  static void trmm(const execution_space& /*space*/, const char side[],
+  static void trmm(const execution_space& space, const char side[],
                    const char uplo[], const char trans[], const char diag[],
                    typename BVIT::const_value_type& alpha, const AVIT& A,
                    const BVIT& B) {
@@ -97,20 +97,7 @@ struct TRMM<execution_space, AVIT, BVIT, false,
                                       ? "KokkosBlas::trmm[ETI]"
                                       : "KokkosBlas::trmm[noETI]");
 
-    typename AVIT::HostMirror host_A = Kokkos::create_mirror_view(A);
-    typename BVIT::HostMirror host_B = Kokkos::create_mirror_view(B);
-
-    // Copy A to host_A and B to host_B
-    // no-op if A and B MemorySpace is HostSpace
-    Kokkos::deep_copy(host_A, A);
-    Kokkos::deep_copy(host_B, B);
-
-    SerialTrmm_Invoke<typename AVIT::HostMirror, typename BVIT::HostMirror>(
-        side, uplo, trans, diag, alpha, host_A, host_B);
-
-    // Copy host_B to B
-    // no-op if B's MemorySpace is HostSpace
-    Kokkos::deep_copy(B, host_B);
+    impl_trmm_blocked(space, side, uplo, trans, diag, alpha, A, B);
 
     Kokkos::Profiling::popRegion();
   }
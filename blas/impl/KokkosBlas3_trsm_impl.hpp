@@ -29,17 +29,16 @@
 #include "KokkosBlas1_set_impl.hpp"
 #include "KokkosBatched_Trsm_Decl.hpp"
 #include "KokkosBatched_Trsm_Serial_Impl.hpp"
+#include "KokkosBlas3_gemm_spec.hpp"
 
 namespace KokkosBlas {
 namespace Impl {
 
 template <typename ScalarType, typename ValueType>
-int SerialTrsmInternalLeftLowerConj(const bool use_unit_diag, const int m,
-                                    const int n, const ScalarType alpha,
-                                    const ValueType* KOKKOS_RESTRICT A,
-                                    const int as0, const int as1,
-                                    /**/ ValueType* KOKKOS_RESTRICT B,
-                                    const int bs0, const int bs1) {
+KOKKOS_INLINE_FUNCTION int SerialTrsmInternalLeftLowerConj(
+    const bool use_unit_diag, const int m, const int n, const ScalarType alpha,
+    const ValueType* KOKKOS_RESTRICT A, const int as0, const int as1,
+    /**/ ValueType* KOKKOS_RESTRICT B, const int bs0, const int bs1) {
   typedef Kokkos::ArithTraits<ValueType> AT;
 
   const ScalarType one(1.0), zero(0.0);
@@ -73,12 +72,10 @@ int SerialTrsmInternalLeftLowerConj(const bool use_unit_diag, const int m,
 }
 
 template <typename ScalarType, typename ValueType>
-int SerialTrsmInternalLeftUpperConj(const bool use_unit_diag, const int m,
-                                    const int n, const ScalarType alpha,
-                                    const ValueType* KOKKOS_RESTRICT A,
-                                    const int as0, const int as1,
-                                    /**/ ValueType* KOKKOS_RESTRICT B,
-                                    const int bs0, const int bs1) {
+KOKKOS_INLINE_FUNCTION int SerialTrsmInternalLeftUpperConj(
+    const bool use_unit_diag, const int m, const int n, const ScalarType alpha,
+    const ValueType* KOKKOS_RESTRICT A, const int as0, const int as1,
+    /**/ ValueType* KOKKOS_RESTRICT B, const int bs0, const int bs1) {
   typedef Kokkos::ArithTraits<ValueType> AT;
 
   const ScalarType one(1.0), zero(0.0);
@@ -314,6 +311,169 @@ void SerialTrsm_Invoke(const char side[], const char uplo[], const char trans[],
         A.stride(0), A.stride(1), B.data(), B.stride(1), B.stride(0));
 }
 
+/// \brief Solves one block of a recursive TRSM: each right-hand side (a
+/// column of B for side == L, a row for side == R) is handed to one thread,
+/// which runs the serial batched solve on it.
+///
+/// As in TrsmBatchedFunctor, every case reduces to a left, lower or upper,
+/// non-transposed solve with the strides of A (and for side == R, of B)
+/// swapped.
+template <class AViewType, class BViewType>
+struct TrsmBlockLeafFunctor {
+  using ScalarB = typename BViewType::non_const_value_type;
+
+  TrsmBlockLeafFunctor(const bool right, const bool lower, const bool notr,
+                       const bool conj_, const bool unit_diag_,
+                       const ScalarB& alpha_, const AViewType& A_,
+                       const BViewType& B_)
+      : unit_diag(unit_diag_),
+        conj(conj_),
+        solve_lower(lower != !notr != right),
+        swap_A(!notr != right),
+        swap_B(right),
+        alpha(alpha_),
+        A(A_),
+        B(B_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const int r) const {
+    using KokkosBatched::Algo;
+    const int m   = A.extent(0);
+    const int as0 = swap_A ? A.stride(1) : A.stride(0);
+    const int as1 = swap_A ? A.stride(0) : A.stride(1);
+    const int bs0 = swap_B ? B.stride(1) : B.stride(0);
+    const int bs1 = swap_B ? B.stride(0) : B.stride(1);
+    const auto* a = A.data();
+    ScalarB* x    = swap_B ? &B(r, 0) : &B(0, r);
+    if (solve_lower && conj)
+      SerialTrsmInternalLeftLowerConj(unit_diag, m, 1, alpha, a, as0, as1, x,
+                                      bs0, bs1);
+    else if (solve_lower)
+      KokkosBatched::SerialTrsmInternalLeftLower<Algo::Trsm::Unblocked>::invoke(
+          unit_diag, m, 1, alpha, a, as0, as1, x, bs0, bs1);
+    else if (conj)
+      SerialTrsmInternalLeftUpperConj(unit_diag, m, 1, alpha, a, as0, as1, x,
+                                      bs0, bs1);
+    else
+      KokkosBatched::SerialTrsmInternalLeftUpper<Algo::Trsm::Unblocked>::invoke(
+          unit_diag, m, 1, alpha, a, as0, as1, x, bs0, bs1);
+  }
+
+  bool unit_diag, conj, solve_lower, swap_A, swap_B;
+  ScalarB alpha;
+  AViewType A;
+  BViewType B;
+};
+
+// Order of the diagonal blocks that impl_trsm_recursive stops splitting at
+constexpr int trsm_recursive_block = 64;
+
+/// \brief Recursive blocked TRSM, op(A)*X = alpha*B or X*op(A) = alpha*B.
+///
+/// A is split in two at a multiple of the block size; the two triangular
+/// halves are solved recursively and the coupling block is applied with
+/// GEMM, so that for large A nearly all of the flops run in GEMM. Blocks of
+/// at most trsm_recursive_block rows go to TrsmBlockLeafFunctor.
+///
+/// A and B are LayoutStride views (the sub-blocks are), so that the recursion
+/// and the GEMMs it calls are instantiated once per scalar and device. The
+/// GEMMs call the native specialization directly, since the generic GEMM is
+/// the only one defined for LayoutStride in a library build.
+template <class ExecSpace, class AViewType, class BViewType>
+void impl_trsm_recursive(const ExecSpace& space, const char side[],
+                         const char uplo[], const char trans[],
+                         const char diag[],
+                         typename BViewType::const_value_type& alpha,
+                         const AViewType& A, const BViewType& B) {
+  using ScalarB    = typename BViewType::non_const_value_type;
+  using CBViewType = Kokkos::View<typename BViewType::const_data_type,
+                                  typename BViewType::array_layout,
+                                  typename BViewType::device_type,
+                                  Kokkos::MemoryTraits<Kokkos::Unmanaged> >;
+  using pair_t     = Kokkos::pair<int, int>;
+  const bool right = side[0] == 'R' || side[0] == 'r';
+  const bool lower = uplo[0] == 'L' || uplo[0] == 'l';
+  const bool notr  = trans[0] == 'N' || trans[0] == 'n';
+  const int K      = A.extent(0);
+  const int nrhs   = right ? B.extent(0) : B.extent(1);
+  if (K == 0 || nrhs == 0) return;
+
+  if (K <= trsm_recursive_block) {
+    Kokkos::parallel_for(
+        "KokkosBlas::trsm[recursive leaf]",
+        Kokkos::RangePolicy<ExecSpace>(space, 0, nrhs),
+        TrsmBlockLeafFunctor<AViewType, BViewType>(
+            right, lower, notr, trans[0] == 'C' || trans[0] == 'c',
+            diag[0] == 'U' || diag[0] == 'u', alpha, A, B));
+    return;
+  }
+
+  // Split at k, a multiple of the block size close to K / 2
+  const int k = ((K / 2 + trsm_recursive_block - 1) / trsm_recursive_block) *
+                trsm_recursive_block;
+  const pair_t p1(0, k), p2(k, K);
+  AViewType A11 = Kokkos::subview(A, p1, p1);
+  AViewType A22 = Kokkos::subview(A, p2, p2);
+  // The blocks below and above the diagonal of op(A), as GEMM sees them
+  const char* trans_off = notr ? "N" : trans;
+  AViewType Off21       = notr ? Kokkos::subview(A, p2, p1)
+                               : Kokkos::subview(A, p1, p2);
+  AViewType Off12       = notr ? Kokkos::subview(A, p1, p2)
+                               : Kokkos::subview(A, p2, p1);
+  BViewType B1 = right ? Kokkos::subview(B, Kokkos::ALL(), p1)
+                       : Kokkos::subview(B, p1, Kokkos::ALL());
+  BViewType B2 = right ? Kokkos::subview(B, Kokkos::ALL(), p2)
+                       : Kokkos::subview(B, p2, Kokkos::ALL());
+  const ScalarB one(1), minus_one(-1);
+  // op(A) is lower triangular
+  const bool lower_eff = lower == notr;
+
+  if (!right) {
+    using gemm_t = GEMM<ExecSpace, AViewType, CBViewType, BViewType, false,
+                        KOKKOSKERNELS_IMPL_COMPILE_LIBRARY>;
+    if (lower_eff) {
+      impl_trsm_recursive(space, side, uplo, trans, diag, alpha, A11, B1);
+      gemm_t::gemm(space, trans_off, "N", minus_one, Off21, B1, alpha, B2);
+      impl_trsm_recursive(space, side, uplo, trans, diag, one, A22, B2);
+    } else {
+      impl_trsm_recursive(space, side, uplo, trans, diag, alpha, A22, B2);
+      gemm_t::gemm(space, trans_off, "N", minus_one, Off12, B2, alpha, B1);
+      impl_trsm_recursive(space, side, uplo, trans, diag, one, A11, B1);
+    }
+  } else {
+    using gemm_t = GEMM<ExecSpace, CBViewType, AViewType, BViewType, false,
+                        KOKKOSKERNELS_IMPL_COMPILE_LIBRARY>;
+    if (lower_eff) {
+      impl_trsm_recursive(space, side, uplo, trans, diag, alpha, A22, B2);
+      gemm_t::gemm(space, "N", trans_off, minus_one, B2, Off21, alpha, B1);
+      impl_trsm_recursive(space, side, uplo, trans, diag, one, A11, B1);
+    } else {
+      impl_trsm_recursive(space, side, uplo, trans, diag, alpha, A11, B1);
+      gemm_t::gemm(space, "N", trans_off, minus_one, B1, Off12, alpha, B2);
+      impl_trsm_recursive(space, side, uplo, trans, diag, one, A22, B2);
+    }
+  }
+}
+
+/// \brief Native TRSM: runs impl_trsm_recursive on LayoutStride views of A
+/// and B, on the execution space of the call.
+template <class ExecSpace, class AViewType, class BViewType>
+void impl_trsm_blocked(const ExecSpace& space, const char side[],
+                       const char uplo[], const char trans[], const char diag[],
+                       typename BViewType::const_value_type& alpha,
+                       const AViewType& A, const BViewType& B) {
+  using AStrideType = Kokkos::View<typename AViewType::const_value_type**,
+                                   Kokkos::LayoutStride,
+                                   typename AViewType::device_type,
+                                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >;
+  using BStrideType = Kokkos::View<typename BViewType::non_const_value_type**,
+                                   Kokkos::LayoutStride,
+                                   typename BViewType::device_type,
+                                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >;
+  AStrideType A_s(A);
+  BStrideType B_s(B);
+  impl_trsm_recursive(space, side, uplo, trans, diag, alpha, A_s, B_s);
+}
+
 }  // namespace Impl
 }  // namespace KokkosBlas
 #endif  // KOKKOSBLAS3_TRSM_IMPL_HPP_
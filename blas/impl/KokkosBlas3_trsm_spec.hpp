@@ -88,7 +88,7 @@ struct TRSM {
 template <class execution_space, class AViewType, class BViewType>
 struct TRSM<execution_space, AViewType, BViewType, false,
             KOKKOSKERNELS_IMPL_COMPILE_LIBRARY> {
-  static void trsm(const execution_space& /*space*/, const char side[],
+  static void trsm(const execution_space& space, const char side[],
                    const char uplo[], const char trans[], const char diag[],
                    typename BViewType::const_value_type& alpha,
                    const AViewType& A, const BViewType& B) {
@@ -105,17 +105,7 @@ struct TRSM<execution_space, AViewType, BViewType, false,
                                       ? "KokkosBlas::trsm[ETI]"
                                       : "KokkosBlas::trsm[noETI]");
 
-    typename AViewType::HostMirror h_A = Kokkos::create_mirror_view(A);
-    typename BViewType::HostMirror h_B = Kokkos::create_mirror_view(B);
-
-    Kokkos::deep_copy(h_A, A);
-    Kokkos::deep_copy(h_B, B);
-
-    SerialTrsm_Invoke<typename AViewType::HostMirror,
-                      typename BViewType::HostMirror>(side, uplo, trans, diag,
-                                                      alpha, h_A, h_B);
-
-    Kokkos::deep_copy(B, h_B);
+    impl_trsm_blocked(space, side, uplo, trans, diag, alpha, A, B);
 
     Kokkos::Profiling::popRegion();
   }
@@ -83,6 +83,10 @@ struct Algo {
   using LU        = Level3;
   using InverseLU = Level3;
   using SolveLU   = Level3;
+  using Potrf     = Level3;
+  using Potrs     = Level3;
+  using Getrf     = Level3;
+  using Getrs     = Level3;
   using QR        = Level3;
   using UTV       = Level3;
 
@@ -116,6 +120,8 @@ struct Algo {
   using Gemv   = Level2;
   using Trsv   = Level2;
   using ApplyQ = Level2;
+  using Gtsv   = Level2;
+  using Gpsv   = Level2;
 };
 
 namespace Impl {
@@ -172,6 +178,45 @@ struct TakeSqrtFunctor {
   RV r;
 };
 
+// Functor to round a 0-D accumulator view into the 0-D result view r.
+
+template <class RV, class AccumView>
+struct RoundAccumulatorFunctor {
+  RV r;
+  AccumView accum;
+
+  KOKKOS_INLINE_FUNCTION void operator()(int) const {
+    r() = static_cast<typename RV::non_const_value_type>(accum());
+  }
+};
+
+// parallel_reduce of f into the 0-D view r, where the value_type of f may be
+// wider than the value type of r (float sums of half_t or bhalf_t entries).
+// In that case the sum is kept in value_type and rounded into r once.
+template <class execution_space, class Policy, class Functor, class RV>
+void reduce_with_accumulator(const char *label, const execution_space &space,
+                             const Policy &policy, const Functor &f,
+                             const RV &r) {
+  using value_type  = typename Functor::value_type;
+  using rvalue_type = typename RV::non_const_value_type;
+  if constexpr (std::is_same_v<value_type, rvalue_type>) {
+    Kokkos::parallel_reduce(label, policy, f, r);
+  } else if constexpr (Kokkos::SpaceAccessibility<
+                           Kokkos::HostSpace,
+                           typename RV::memory_space>::accessible) {
+    value_type sum;
+    Kokkos::parallel_reduce(label, policy, f, sum);
+    r() = static_cast<rvalue_type>(sum);
+  } else {
+    Kokkos::View<value_type, typename RV::memory_space> sum(
+        Kokkos::view_alloc(space, Kokkos::WithoutInitializing, label));
+    Kokkos::parallel_reduce(label, policy, f, sum);
+    Kokkos::parallel_for(
+        label, Kokkos::RangePolicy<execution_space>(space, 0, 1),
+        RoundAccumulatorFunctor<RV, decltype(sum)>{r, sum});
+  }
+}
+
 }  // namespace Impl
 }  // namespace KokkosBlas
 
@@ -21,7 +21,9 @@
 #include <KokkosBlas1_axpby.hpp>
 #include <KokkosBlas1_dot.hpp>
 #include <KokkosBlas1_fill.hpp>
+#include <KokkosBlas1_fused.hpp>
 #include <KokkosBlas1_mult.hpp>
+#include <KokkosBlas1_multi_dot.hpp>
 #include <KokkosBlas1_nrm1.hpp>
 #include <KokkosBlas1_nrm2.hpp>
 #include <KokkosBlas1_nrm2_squared.hpp>
@@ -150,7 +150,10 @@ dot(const XVector& x, const YVector& y) {
 
 /// \brief Compute the column-wise dot products of two multivectors.
 ///
-/// This function is non-blocking and thread-safe.
+/// This function is thread-safe. If R is accessible from execution_space,
+/// for instance a View in the memory space of X, it is also non-blocking: it
+/// neither fences nor copies R to the host, and R holds the result once the
+/// kernel on space has completed. Otherwise it blocks until R is written.
 ///
 /// \tparam execution_space the Kokkos execution space where the kernel
 ///         will be executed.
@@ -285,7 +288,8 @@ void dot(const execution_space& space, const RV& R, const XMV& X, const YMV& Y,
 
 /// \brief Compute the column-wise dot products of two multivectors.
 ///
-/// This function is non-blocking and thread-safe.
+/// This function is thread-safe, and non-blocking under the same conditions
+/// as the overload taking an execution space instance.
 /// The kernel is executed in the default stream/queue associated
 /// with the execution space of XVM.
 ///
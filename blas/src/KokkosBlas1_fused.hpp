@@ -0,0 +1,188 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file
+/// \brief Fused sequences of BLAS1 vector operations
+///
+
+#ifndef KOKKOSBLAS1_FUSED_HPP_
+#define KOKKOSBLAS1_FUSED_HPP_
+
+#include <sstream>
+#include <type_traits>
+#include "Kokkos_Core.hpp"
+#include "KokkosKernels_Error.hpp"
+#include "KokkosBlas1_fused_impl.hpp"
+
+namespace KokkosBlas {
+
+// clang-format off
+/// \brief A short sequence of axpby, update, scal, dot and nrm2 operations on
+///   rank-1 Views of the same length, run as a single parallel pass.
+///
+///   Operations are appended with the member functions below, each of which
+///   returns a new FusedBlas1 with the operation added at the end, and run
+///   with execute(). The result is the same as running the corresponding
+///   KokkosBlas functions one after the other, but each vector is read from
+///   memory once instead of once per operation. For example, in
+///
+///   \code
+///   KokkosBlas::fused_blas1(space)
+///       .update(a, x, b, y, 0, w)
+///       .dot(w, z, r)
+///       .nrm2(w, n)
+///       .execute();
+///   \endcode
+///
+///   w := a*x + b*y, r := dot(w, z) and n := nrm2(w) take one pass over
+///   x, y, w and z instead of three.
+///
+///   dot and nrm2 results are written to host scalars by execute(), which
+///   then blocks until the kernel is done; sequences without reductions are
+///   non-blocking. All the vectors must have the same scalar type.
+///
+/// \tparam execution_space a Kokkos execution space
+/// \tparam Chain the operations so far (an implementation detail)
+// clang-format on
+template <class execution_space, class Chain = Impl::FusedEmptyChain>
+class FusedBlas1 {
+ public:
+  FusedBlas1(const execution_space& space, const Chain& chain = Chain())
+      : space_(space), chain_(chain) {}
+
+  /// \brief Append y := a*x + b*y.
+  template <class XVector, class YVector>
+  FusedBlas1<execution_space,
+             Impl::FusedChain<Chain, Impl::FusedAxpbyOp<XVector, YVector> > >
+  axpby(const typename YVector::non_const_value_type& a, const XVector& x,
+        const typename YVector::non_const_value_type& b,
+        const YVector& y) const {
+    check_vector<XVector>();
+    check_vector<YVector>();
+    return append(Impl::FusedAxpbyOp<XVector, YVector>{a, x, b, y});
+  }
+
+  /// \brief Append z := a*x + b*y + c*z.
+  template <class XVector, class YVector, class ZVector>
+  FusedBlas1<execution_space,
+             Impl::FusedChain<
+                 Chain, Impl::FusedUpdateOp<XVector, YVector, ZVector> > >
+  update(const typename ZVector::non_const_value_type& a, const XVector& x,
+         const typename ZVector::non_const_value_type& b, const YVector& y,
+         const typename ZVector::non_const_value_type& c,
+         const ZVector& z) const {
+    check_vector<XVector>();
+    check_vector<YVector>();
+    check_vector<ZVector>();
+    return append(
+        Impl::FusedUpdateOp<XVector, YVector, ZVector>{a, x, b, y, c, z});
+  }
+
+  /// \brief Append r := a*x.
+  template <class RVector, class XVector>
+  FusedBlas1<execution_space,
+             Impl::FusedChain<Chain, Impl::FusedScalOp<RVector, XVector> > >
+  scal(const RVector& r, const typename RVector::non_const_value_type& a,
+       const XVector& x) const {
+    check_vector<RVector>();
+    check_vector<XVector>();
+    return append(Impl::FusedScalOp<RVector, XVector>{r, a, x});
+  }
+
+  /// \brief Append result := dot(x, y), i.e. \f$\sum_i \overline{x_i} y_i\f$.
+  ///   result must stay alive until execute() returns.
+  template <class XVector, class YVector>
+  FusedBlas1<execution_space,
+             Impl::FusedChain<Chain, Impl::FusedDotOp<XVector, YVector,
+                                                      Chain::num_results> > >
+  dot(const XVector& x, const YVector& y,
+      typename Impl::FusedDotOp<XVector, YVector, 0>::dot_type& result) const {
+    check_vector<XVector>();
+    check_vector<YVector>();
+    return append(
+        Impl::FusedDotOp<XVector, YVector, Chain::num_results>{x, y, &result});
+  }
+
+  /// \brief Append result := nrm2(x). result must stay alive until execute()
+  ///   returns.
+  template <class XVector>
+  FusedBlas1<execution_space,
+             Impl::FusedChain<Chain,
+                              Impl::FusedNrm2Op<XVector, Chain::num_results> > >
+  nrm2(const XVector& x,
+       typename Impl::FusedNrm2Op<XVector, 0>::mag_type& result) const {
+    check_vector<XVector>();
+    return append(Impl::FusedNrm2Op<XVector, Chain::num_results>{x, &result});
+  }
+
+  /// \brief Run the operations, in order, in one pass over the vectors.
+  void execute() const {
+    static_assert(!std::is_void<typename Chain::scalar_type>::value,
+                  "KokkosBlas::FusedBlas1::execute: no operations to run.");
+    const size_t n = chain_.op.extent();
+    if (!chain_.extents_match(n)) {
+      std::ostringstream os;
+      os << "KokkosBlas::FusedBlas1::execute: Dimensions do not match: "
+         << "all the vectors must have length " << n;
+      KokkosKernels::Impl::throw_runtime_exception(os.str());
+    }
+    Kokkos::Profiling::pushRegion("KokkosBlas::fused_blas1");
+    Impl::impl_fused_blas1(space_, chain_, n);
+    Kokkos::Profiling::popRegion();
+  }
+
+ private:
+  template <class Vector>
+  static void check_vector() {
+    static_assert(Kokkos::is_view<Vector>::value,
+                  "KokkosBlas::fused_blas1: vectors must be Kokkos::View.");
+    static_assert(static_cast<int>(Vector::rank) == 1,
+                  "KokkosBlas::fused_blas1: vectors must have rank 1.");
+    static_assert(
+        Kokkos::SpaceAccessibility<execution_space,
+                                   typename Vector::memory_space>::accessible,
+        "KokkosBlas::fused_blas1: vectors must be accessible from "
+        "execution_space.");
+  }
+
+  template <class Op>
+  FusedBlas1<execution_space, Impl::FusedChain<Chain, Op> > append(
+      const Op& op) const {
+    return FusedBlas1<execution_space, Impl::FusedChain<Chain, Op> >(
+        space_, Impl::FusedChain<Chain, Op>{chain_, op});
+  }
+
+  execution_space space_;
+  Chain chain_;
+};
+
+/// \brief Start an empty sequence of fused BLAS1 operations, run on space.
+///   See FusedBlas1.
+template <class execution_space>
+FusedBlas1<execution_space> fused_blas1(const execution_space& space) {
+  return FusedBlas1<execution_space>(space);
+}
+
+/// \brief Start an empty sequence of fused BLAS1 operations, run on the
+///   default instance of execution_space. See FusedBlas1.
+template <class execution_space = Kokkos::DefaultExecutionSpace>
+FusedBlas1<execution_space> fused_blas1() {
+  return FusedBlas1<execution_space>(execution_space());
+}
+
+}  // namespace KokkosBlas
+
+#endif  // KOKKOSBLAS1_FUSED_HPP_
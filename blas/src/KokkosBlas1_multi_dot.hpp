@@ -0,0 +1,129 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file
+/// \brief Dot products of the columns of a multivector with one vector
+///
+
+#ifndef KOKKOSBLAS1_MULTI_DOT_HPP_
+#define KOKKOSBLAS1_MULTI_DOT_HPP_
+
+#include <sstream>
+#include "Kokkos_Core.hpp"
+#include "KokkosKernels_Error.hpp"
+#include "KokkosBlas1_multi_dot_impl.hpp"
+
+namespace KokkosBlas {
+
+/// \brief Compute R(j) := dot(X(:, j), y) for all the columns j of X, or,
+///   with trans == "T", the same products without conjugating X.
+///
+/// This is the same as gemv(space, trans, 1, X, y, 0, R). It exists for the
+/// case where X is tall and skinny, such as the Krylov basis in a classical
+/// Gram-Schmidt step: on GPUs a column-major X is then read in blocks of
+/// rows, with the matching block of y held in team scratch, so that y is
+/// read once instead of once per column. Elsewhere it calls gemv.
+///
+/// This function is non-blocking and thread-safe.
+///
+/// \tparam execution_space a Kokkos execution space
+/// \tparam RV 1-D output View
+/// \tparam XMV 2-D input View
+/// \tparam YV 1-D input View
+///
+/// \param space [in] execution space instance on which the kernel runs
+/// \param trans [in] "C" to conjugate X, as dot does, or "T" not to
+/// \param R [out] Output View with X.extent(1) entries
+/// \param X [in] Input multivector
+/// \param y [in] Input vector with X.extent(0) entries
+template <class execution_space, class RV, class XMV, class YV>
+void multi_dot(const execution_space& space, const char trans[], const RV& R,
+               const XMV& X, const YV& y) {
+  static_assert(Kokkos::is_execution_space_v<execution_space>,
+                "KokkosBlas::multi_dot: execution_space must be a valid Kokkos "
+                "execution space.");
+  static_assert(Kokkos::is_view<RV>::value && Kokkos::is_view<XMV>::value &&
+                    Kokkos::is_view<YV>::value,
+                "KokkosBlas::multi_dot: R, X and y must be Kokkos::Views.");
+  static_assert(
+      Kokkos::SpaceAccessibility<execution_space,
+                                 typename RV::memory_space>::accessible &&
+          Kokkos::SpaceAccessibility<execution_space,
+                                     typename XMV::memory_space>::accessible &&
+          Kokkos::SpaceAccessibility<execution_space,
+                                     typename YV::memory_space>::accessible,
+      "KokkosBlas::multi_dot: R, X and y must be accessible from "
+      "execution_space.");
+  static_assert(std::is_same<typename RV::value_type,
+                             typename RV::non_const_value_type>::value,
+                "KokkosBlas::multi_dot: R is const.  "
+                "It must be nonconst, because it is an output argument.");
+  static_assert(RV::rank == 1 && XMV::rank == 2 && YV::rank == 1,
+                "KokkosBlas::multi_dot: R and y must have rank 1 and X rank "
+                "2.");
+
+  const char t = trans[0];
+  if (t != 'T' && t != 't' && t != 'C' && t != 'c') {
+    std::ostringstream os;
+    os << "KokkosBlas::multi_dot: trans is '" << trans
+       << "', but must be \"T\" or \"C\".";
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+  if (X.extent(0) != y.extent(0) || X.extent(1) != R.extent(0)) {
+    std::ostringstream os;
+    os << "KokkosBlas::multi_dot: Dimensions of R, X, and y do not match: "
+       << "R: " << R.extent(0) << ", X: " << X.extent(0) << " x "
+       << X.extent(1) << ", y: " << y.extent(0);
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  Impl::impl_multi_dot(space, t == 'C' || t == 'c', R, X, y);
+}
+
+/// \brief Compute R(j) := dot(X(:, j), y) for all the columns j of X.
+///
+/// The same as multi_dot(space, "C", R, X, y).
+template <class execution_space, class RV, class XMV, class YV>
+void multi_dot(const execution_space& space, const RV& R, const XMV& X,
+               const YV& y,
+               typename std::enable_if<
+                   Kokkos::is_execution_space_v<execution_space>, int>::type =
+                   0) {
+  multi_dot(space, "C", R, X, y);
+}
+
+/// \brief Compute R(j) := dot(X(:, j), y), or with trans == "T" the
+///   products without conjugating X, for all the columns j of X.
+///
+/// The kernel is executed in the default stream/queue associated with the
+/// execution space of XMV.
+template <class RV, class XMV, class YV>
+void multi_dot(const char trans[], const RV& R, const XMV& X, const YV& y) {
+  multi_dot(typename XMV::execution_space{}, trans, R, X, y);
+}
+
+/// \brief Compute R(j) := dot(X(:, j), y) for all the columns j of X.
+///
+/// The kernel is executed in the default stream/queue associated with the
+/// execution space of XMV.
+template <class RV, class XMV, class YV>
+void multi_dot(const RV& R, const XMV& X, const YV& y) {
+  multi_dot(typename XMV::execution_space{}, "C", R, X, y);
+}
+
+}  // namespace KokkosBlas
+
+#endif  // KOKKOSBLAS1_MULTI_DOT_HPP_
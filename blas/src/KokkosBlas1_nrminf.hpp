@@ -88,6 +88,10 @@ nrminf(const XVector& x) {
 ///
 /// Replace each entry in R with the nrminfolute value (magnitude) of the
 /// corresponding entry in X.
+/// This function is thread-safe. If R is accessible from execution_space,
+/// for instance a View in the memory space of X, it is also non-blocking: it
+/// neither fences nor copies R to the host, and R holds the result once the
+/// kernel on space has completed. Otherwise it blocks until R is written.
 ///
 /// \tparam execution_space, the execution space in which the kernel will run.
 /// \tparam RMV 1-D or 2-D Kokkos::View specialization.
@@ -168,6 +172,8 @@ void nrminf(
 ///
 /// Replace each entry in R with the nrminfolute value (magnitude) of the
 /// corresponding entry in X.
+/// This function is thread-safe, and non-blocking under the same conditions
+/// as the overload taking an execution space instance.
 ///
 /// \tparam RMV 1-D or 2-D Kokkos::View specialization.
 /// \tparam XMV 1-D or 2-D Kokkos::View specialization.  It must have
@@ -90,7 +90,10 @@ typename XVector::non_const_value_type sum(const XVector& x) {
 ///
 /// Replace each entry in R with the sumolute value (magnitude) of the
 /// corresponding entry in X.
-/// This function is non-blocking and thread-safe.
+/// This function is thread-safe. If R is accessible from execution_space,
+/// for instance a View in the memory space of X, it is also non-blocking: it
+/// neither fences nor copies R to the host, and R holds the result once the
+/// kernel on space has completed. Otherwise it blocks until R is written.
 ///
 /// \tparam execution_space a Kokkos execution space where the kernel will run.
 /// \tparam RMV 1-D or 2-D Kokkos::View specialization.
@@ -164,7 +167,8 @@ void sum(const execution_space& space, const RV& R, const XMV& X,
 ///
 /// Replace each entry in R with the sumolute value (magnitude) of the
 /// corresponding entry in X.
-/// This function is non-blocking and thread-safe.
+/// This function is thread-safe, and non-blocking under the same conditions
+/// as the overload taking an execution space instance.
 /// The kernel is executed in the default stream/queue associated
 /// with the execution space of XVM.
 ///
@@ -0,0 +1,206 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef KOKKOSBLAS2_SYMV_HPP_
+#define KOKKOSBLAS2_SYMV_HPP_
+
+/// \file KokkosBlas2_symv.hpp
+/// \brief Symmetric and Hermitian matrix-vector products, which only read one
+/// triangle of A.
+
+#include "KokkosBlas2_symv_spec.hpp"
+#include "KokkosKernels_helpers.hpp"
+#include "KokkosKernels_Error.hpp"
+#include <sstream>
+#include <type_traits>
+
+namespace KokkosBlas {
+
+namespace Impl {
+
+// Checks the arguments and calls Impl::SYMV, for both symv and hemv
+template <class execution_space, class AViewType, class XViewType,
+          class YViewType>
+void symv_dispatch(const char name[], const execution_space& space,
+                   const char uplo[], const bool hermitian,
+                   typename YViewType::const_value_type& alpha,
+                   const AViewType& A, const XViewType& x,
+                   typename YViewType::const_value_type& beta,
+                   const YViewType& y) {
+  static_assert(Kokkos::is_execution_space_v<execution_space>,
+                "execution_space must be a Kokkos execution space.");
+  static_assert(Kokkos::is_view<AViewType>::value,
+                "AViewType must be a Kokkos::View.");
+  static_assert(Kokkos::is_view<XViewType>::value,
+                "XViewType must be a Kokkos::View.");
+  static_assert(Kokkos::is_view<YViewType>::value,
+                "YViewType must be a Kokkos::View.");
+  static_assert(static_cast<int>(AViewType::rank) == 2,
+                "AViewType must have rank 2.");
+  static_assert(static_cast<int>(XViewType::rank) == 1,
+                "XViewType must have rank 1.");
+  static_assert(static_cast<int>(YViewType::rank) == 1,
+                "YViewType must have rank 1.");
+  static_assert(std::is_same<typename YViewType::value_type,
+                             typename YViewType::non_const_value_type>::value,
+                "YViewType must have non-const value type.");
+  static_assert(
+      Kokkos::SpaceAccessibility<execution_space,
+                                 typename AViewType::memory_space>::accessible,
+      "AViewType memory space must be accessible from execution_space");
+  static_assert(
+      Kokkos::SpaceAccessibility<execution_space,
+                                 typename XViewType::memory_space>::accessible,
+      "XViewType memory space must be accessible from execution_space");
+  static_assert(
+      Kokkos::SpaceAccessibility<execution_space,
+                                 typename YViewType::memory_space>::accessible,
+      "YViewType memory space must be accessible from execution_space");
+
+  if ((uplo[0] != 'U') && (uplo[0] != 'u') && (uplo[0] != 'L') &&
+      (uplo[0] != 'l')) {
+    std::ostringstream os;
+    os << "KokkosBlas::" << name << ": uplo = '" << uplo[0] << "'. "
+       << "Valid values include 'U' or 'u' (A is stored in its upper "
+          "triangle), 'L' or 'l' (A is stored in its lower triangle).";
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+  if (A.extent(0) != A.extent(1) || x.extent(0) != A.extent(1) ||
+      y.extent(0) != A.extent(0)) {
+    std::ostringstream os;
+    os << "KokkosBlas::" << name << ": Dimensions of A, x and y do not match: "
+       << "A: " << A.extent(0) << " x " << A.extent(1)
+       << ", x: " << x.extent(0) << ", y: " << y.extent(0);
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  // Return if degenerated matrices are provided
+  if (A.extent(0) == 0) return;
+
+  using ALayout = typename AViewType::array_layout;
+
+  // Minimize the number of Impl::SYMV instantiations, by standardizing
+  // on particular View specializations for its template parameters.
+  using AVT = Kokkos::View<typename AViewType::const_value_type**, ALayout,
+                           typename AViewType::device_type,
+                           Kokkos::MemoryTraits<Kokkos::Unmanaged> >;
+  using XVT =
+      Kokkos::View<typename XViewType::const_value_type*,
+                   typename KokkosKernels::Impl::GetUnifiedLayoutPreferring<
+                       XViewType, ALayout>::array_layout,
+                   typename XViewType::device_type,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >;
+  using YVT =
+      Kokkos::View<typename YViewType::non_const_value_type*,
+                   typename KokkosKernels::Impl::GetUnifiedLayoutPreferring<
+                       YViewType, ALayout>::array_layout,
+                   typename YViewType::device_type,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >;
+
+  using scalar_type = typename YViewType::non_const_value_type;
+  // for real scalars hemv is symv, which saves an instantiation
+  const bool herm = hermitian && Kokkos::ArithTraits<scalar_type>::is_complex;
+  Impl::SYMV<execution_space, AVT, XVT, YVT>::symv(space, uplo, herm, alpha,
+                                                   A, x, beta, y);
+}
+
+}  // namespace Impl
+
+/// \brief Symmetric matrix-vector multiply, y = beta * y + alpha * A * x.
+///
+/// Only the triangle of A given by uplo is read; the other one is neither read
+/// nor needs to be allocated with meaningful values, so a symmetric matrix
+/// costs half the memory traffic of the equivalent gemv on a materialized
+/// matrix.
+///
+/// If beta is zero, y is not read, so NaNs in y don't propagate.
+///
+/// \tparam execution_space a Kokkos execution space to run the kernels on.
+/// \tparam AViewType Input N-by-N matrix, as a 2-D Kokkos::View
+/// \tparam XViewType Input vector, as a 1-D Kokkos::View
+/// \tparam YViewType Input/Output vector, as a 1-D Kokkos::View
+///
+/// \param space [in] an execution space instance that may contain a stream
+///                   or a queue to execute the kernel on
+/// \param uplo  [in] "U" or "u" if A is stored in its upper triangle,
+///                   "L" or "l" if A is stored in its lower triangle
+/// \param alpha [in] Input coefficient of A * x
+/// \param A [in]     Input matrix, as a 2-D Kokkos::View
+/// \param x [in]     Input vector, as a 1-D Kokkos::View
+/// \param beta [in]  Input coefficient of y
+/// \param y [in,out] Input/Output vector, as a 1-D Kokkos::View
+template <class execution_space, class AViewType, class XViewType,
+          class YViewType>
+void symv(const execution_space& space, const char uplo[],
+          typename YViewType::const_value_type& alpha, const AViewType& A,
+          const XViewType& x, typename YViewType::const_value_type& beta,
+          const YViewType& y) {
+  Impl::symv_dispatch("symv", space, uplo, false, alpha, A, x, beta, y);
+}
+
+/// \brief Symmetric matrix-vector multiply, y = beta * y + alpha * A * x.
+///
+/// See the version taking an execution space instance.
+template <class AViewType, class XViewType, class YViewType>
+void symv(const char uplo[], typename YViewType::const_value_type& alpha,
+          const AViewType& A, const XViewType& x,
+          typename YViewType::const_value_type& beta, const YViewType& y) {
+  symv(typename AViewType::execution_space{}, uplo, alpha, A, x, beta, y);
+}
+
+/// \brief Hermitian matrix-vector multiply, y = beta * y + alpha * A * x.
+///
+/// Only the triangle of A given by uplo is read, the other one being taken as
+/// its conjugate transpose, and the imaginary parts of the diagonal of A are
+/// assumed to be zero. For real scalars this is symv.
+///
+/// If beta is zero, y is not read, so NaNs in y don't propagate.
+///
+/// \tparam execution_space a Kokkos execution space to run the kernels on.
+/// \tparam AViewType Input N-by-N matrix, as a 2-D Kokkos::View
+/// \tparam XViewType Input vector, as a 1-D Kokkos::View
+/// \tparam YViewType Input/Output vector, as a 1-D Kokkos::View
+///
+/// \param space [in] an execution space instance that may contain a stream
+///                   or a queue to execute the kernel on
+/// \param uplo  [in] "U" or "u" if A is stored in its upper triangle,
+///                   "L" or "l" if A is stored in its lower triangle
+/// \param alpha [in] Input coefficient of A * x
+/// \param A [in]     Input matrix, as a 2-D Kokkos::View
+/// \param x [in]     Input vector, as a 1-D Kokkos::View
+/// \param beta [in]  Input coefficient of y
+/// \param y [in,out] Input/Output vector, as a 1-D Kokkos::View
+template <class execution_space, class AViewType, class XViewType,
+          class YViewType>
+void hemv(const execution_space& space, const char uplo[],
+          typename YViewType::const_value_type& alpha, const AViewType& A,
+          const XViewType& x, typename YViewType::const_value_type& beta,
+          const YViewType& y) {
+  Impl::symv_dispatch("hemv", space, uplo, true, alpha, A, x, beta, y);
+}
+
+/// \brief Hermitian matrix-vector multiply, y = beta * y + alpha * A * x.
+///
+/// See the version taking an execution space instance.
+template <class AViewType, class XViewType, class YViewType>
+void hemv(const char uplo[], typename YViewType::const_value_type& alpha,
+          const AViewType& A, const XViewType& x,
+          typename YViewType::const_value_type& beta, const YViewType& y) {
+  hemv(typename AViewType::execution_space{}, uplo, alpha, A, x, beta, y);
+}
+
+}  // namespace KokkosBlas
+
+#endif  // KOKKOSBLAS2_SYMV_HPP_
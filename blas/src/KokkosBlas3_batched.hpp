@@ -0,0 +1,323 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef KOKKOSBLAS3_BATCHED_HPP_
+#define KOKKOSBLAS3_BATCHED_HPP_
+
+/// \file KokkosBlas3_batched.hpp
+/// \brief Batched BLAS 3: many small GEMMs or TRSMs in a single call, on the
+/// matrices stacked in rank-3 Views, A(b, :, :) being matrix b of A.
+
+#include "KokkosKernels_config.h"
+#include "Kokkos_Core.hpp"
+#include "KokkosKernels_Error.hpp"
+#include "KokkosBlas3_batched_impl.hpp"
+#include "KokkosBlas3_batched_tpl.hpp"
+#include <algorithm>
+#include <cctype>
+#include <sstream>
+#include <type_traits>
+
+namespace KokkosBlas {
+
+namespace Impl {
+
+// Whether the matrices of a rank-3 View are column-major (ld is the leading
+// dimension) or row-major (ld is the row stride), with a constant stride
+// between matrices as the strided-batched TPLs need
+template <class ViewType>
+bool batched_is_col_major(const ViewType& V, int64_t& ld) {
+  ld = V.stride(2);
+  return V.stride(1) == 1 &&
+         ld >= std::max<int64_t>(1, static_cast<int64_t>(V.extent(1)));
+}
+
+template <class ViewType>
+bool batched_is_row_major(const ViewType& V, int64_t& ld) {
+  ld = V.stride(1);
+  return V.stride(2) == 1 &&
+         ld >= std::max<int64_t>(1, static_cast<int64_t>(V.extent(2)));
+}
+
+// Calls the strided-batched GEMM of a TPL and returns true, or returns false
+// if there is none for these types or the matrices are not laid out for it.
+// Row-major matrices are seen as their column-major transposes:
+// C^T = op(B)^T op(A)^T.
+template <class ExecSpace, class AViewType, class BViewType, class CViewType>
+bool gemm_strided_batched_tpl(const ExecSpace& space, const char transA[],
+                              const char transB[],
+                              typename CViewType::const_value_type& alpha,
+                              const AViewType& A, const BViewType& B,
+                              typename CViewType::const_value_type& beta,
+                              const CViewType& C) {
+  using Scalar = typename CViewType::non_const_value_type;
+  using tpl    = Blas3BatchedTpl<ExecSpace, Scalar>;
+  if constexpr (!tpl::available ||
+                !std::is_same_v<typename AViewType::non_const_value_type,
+                                Scalar> ||
+                !std::is_same_v<typename BViewType::non_const_value_type,
+                                Scalar>) {
+    return false;
+  } else {
+    const bool A_t = transA[0] != 'N';
+    const int M    = C.extent(1);
+    const int N    = C.extent(2);
+    const int K    = A_t ? A.extent(1) : A.extent(2);
+    const int nb   = C.extent(0);
+    int64_t lda, ldb, ldc;
+    if (batched_is_col_major(A, lda) && batched_is_col_major(B, ldb) &&
+        batched_is_col_major(C, ldc)) {
+      tpl::gemm(space, transA, transB, M, N, K, alpha, A.data(), lda,
+                A.stride(0), B.data(), ldb, B.stride(0), beta, C.data(), ldc,
+                C.stride(0), nb);
+      return true;
+    }
+    if (batched_is_row_major(A, lda) && batched_is_row_major(B, ldb) &&
+        batched_is_row_major(C, ldc)) {
+      tpl::gemm(space, transB, transA, N, M, K, alpha, B.data(), ldb,
+                B.stride(0), A.data(), lda, A.stride(0), beta, C.data(), ldc,
+                C.stride(0), nb);
+      return true;
+    }
+    return false;
+  }
+}
+
+// Calls the batched TRSM of a TPL and returns true, or returns false if there
+// is none for these types or the matrices are not laid out for it. Row-major
+// matrices are seen as their column-major transposes, which moves A to the
+// other side and swaps its upper and lower parts.
+template <class ExecSpace, class AViewType, class BViewType>
+bool trsm_batched_tpl(const ExecSpace& space, const char side[],
+                      const char uplo[], const char trans[], const char diag[],
+                      typename BViewType::const_value_type& alpha,
+                      const AViewType& A, const BViewType& B) {
+  using Scalar = typename BViewType::non_const_value_type;
+  using tpl    = Blas3BatchedTpl<ExecSpace, Scalar>;
+  if constexpr (!tpl::available ||
+                !std::is_same_v<typename AViewType::non_const_value_type,
+                                Scalar>) {
+    return false;
+  } else {
+    const int M  = B.extent(1);
+    const int N  = B.extent(2);
+    const int nb = B.extent(0);
+    int64_t lda, ldb;
+    if (batched_is_col_major(A, lda) && batched_is_col_major(B, ldb)) {
+      tpl::trsm(space, side[0], uplo[0], trans, diag[0], M, N, alpha, A.data(),
+                lda, A.stride(0), B.data(), ldb, B.stride(0), nb);
+      return true;
+    }
+    if (batched_is_row_major(A, lda) && batched_is_row_major(B, ldb)) {
+      tpl::trsm(space, side[0] == 'L' ? 'R' : 'L', uplo[0] == 'L' ? 'U' : 'L',
+                trans, diag[0], N, M, alpha, A.data(), lda, A.stride(0),
+                B.data(), ldb, B.stride(0), nb);
+      return true;
+    }
+    return false;
+  }
+}
+
+}  // namespace Impl
+
+/// \brief Strided-batched dense matrix-matrix multiply:
+///   C(b, :, :) = beta*C(b, :, :) + alpha*op(A(b, :, :))*op(B(b, :, :))
+/// for every b in [0, C.extent(0)).
+///
+/// Calls the strided-batched GEMM of cuBLAS, rocBLAS or MKL when one is
+/// enabled for this execution space and scalar type and the matrices are
+/// either all column-major or all row-major (LayoutRight Views are); otherwise
+/// runs a native kernel with one team per matrix. Either way this is a single
+/// launch for the whole batch.
+///
+/// \tparam execution_space a Kokkos execution space
+/// \tparam AViewType rank-3 View of the matrices A
+/// \tparam BViewType rank-3 View of the matrices B
+/// \tparam CViewType rank-3 View of the matrices C, nonconst
+///
+/// \param space [in] execution space instance the kernels run on
+/// \param transA [in] "N" for non-transpose, "T" for transpose, "C" for
+///   conjugate transpose. All characters after the first are ignored. This
+///   works just like the BLAS routine.
+/// \param transB [in] "N", "T" or "C" for B, as for transA.
+/// \param alpha [in] Input coefficient of op(A)*op(B)
+/// \param A [in] Input batch of matrices
+/// \param B [in] Input batch of matrices
+/// \param beta [in] Input coefficient of C
+/// \param C [in/out] Output batch of matrices
+template <class execution_space, class AViewType, class BViewType,
+          class CViewType>
+void gemm_strided_batched(const execution_space& space, const char transA[],
+                          const char transB[],
+                          typename CViewType::const_value_type& alpha,
+                          const AViewType& A, const BViewType& B,
+                          typename CViewType::const_value_type& beta,
+                          const CViewType& C) {
+  static_assert(Kokkos::is_execution_space_v<execution_space>,
+                "KokkosBlas::gemm_strided_batched: execution_space must be a "
+                "valid Kokkos execution space");
+  static_assert(Kokkos::is_view_v<AViewType> && Kokkos::is_view_v<BViewType> &&
+                    Kokkos::is_view_v<CViewType>,
+                "KokkosBlas::gemm_strided_batched: A, B and C must be "
+                "Kokkos::Views.");
+  static_assert(AViewType::rank == 3 && BViewType::rank == 3 &&
+                    CViewType::rank == 3,
+                "KokkosBlas::gemm_strided_batched: A, B and C must have "
+                "rank 3.");
+  static_assert(std::is_same_v<typename CViewType::value_type,
+                               typename CViewType::non_const_value_type>,
+                "KokkosBlas::gemm_strided_batched: C must be nonconst.");
+  using a_mem = typename AViewType::memory_space;
+  using b_mem = typename BViewType::memory_space;
+  using c_mem = typename CViewType::memory_space;
+  static_assert(
+      Kokkos::SpaceAccessibility<execution_space, a_mem>::accessible &&
+          Kokkos::SpaceAccessibility<execution_space, b_mem>::accessible &&
+          Kokkos::SpaceAccessibility<execution_space, c_mem>::accessible,
+      "KokkosBlas::gemm_strided_batched: A, B and C must be accessible from "
+      "execution_space");
+
+  const char tA = std::toupper(transA[0]);
+  const char tB = std::toupper(transB[0]);
+  if ((tA != 'N' && tA != 'T' && tA != 'C') ||
+      (tB != 'N' && tB != 'T' && tB != 'C')) {
+    std::ostringstream os;
+    os << "KokkosBlas::gemm_strided_batched: transA[0] = '" << transA[0]
+       << "' transB[0] = '" << transB[0] << "'. "
+       << "Valid values include 'N' or 'n' (No transpose), 'T' or 't' "
+          "(Transpose), and 'C' or 'c' (Conjugate transpose).";
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+  const bool A_t = tA != 'N', B_t = tB != 'N';
+  if (A.extent(0) != C.extent(0) || B.extent(0) != C.extent(0) ||
+      (A_t ? A.extent(2) : A.extent(1)) != C.extent(1) ||
+      (B_t ? B.extent(1) : B.extent(2)) != C.extent(2) ||
+      (A_t ? A.extent(1) : A.extent(2)) != (B_t ? B.extent(2) : B.extent(1))) {
+    std::ostringstream os;
+    os << "KokkosBlas::gemm_strided_batched: Dimensions of A, B, and C do not "
+       << "match: transA: " << transA[0] << " transB: " << transB[0]
+       << " A: " << A.extent(0) << " x " << A.extent(1) << " x "
+       << A.extent(2) << " B: " << B.extent(0) << " x " << B.extent(1)
+       << " x " << B.extent(2) << " C: " << C.extent(0) << " x "
+       << C.extent(1) << " x " << C.extent(2);
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+  if (C.extent(0) == 0 || C.extent(1) == 0 || C.extent(2) == 0) return;
+
+  const char tAs[2] = {tA, '\0'}, tBs[2] = {tB, '\0'};
+  if (Impl::gemm_strided_batched_tpl(space, tAs, tBs, alpha, A, B, beta, C))
+    return;
+  Impl::impl_gemm_strided_batched(space, tAs, tBs, alpha, A, B, beta, C);
+}
+
+/// \brief Strided-batched dense matrix-matrix multiply, on the default
+/// execution space instance of C.
+template <class AViewType, class BViewType, class CViewType>
+void gemm_strided_batched(const char transA[], const char transB[],
+                          typename CViewType::const_value_type& alpha,
+                          const AViewType& A, const BViewType& B,
+                          typename CViewType::const_value_type& beta,
+                          const CViewType& C) {
+  gemm_strided_batched(typename CViewType::execution_space{}, transA, transB,
+                       alpha, A, B, beta, C);
+}
+
+/// \brief Batched triangular solve with multiple right-hand sides:
+///   op(A(b, :, :))*X = alpha*B(b, :, :) if side == "L" or "l"
+///   X*op(A(b, :, :)) = alpha*B(b, :, :) if side == "R" or "r"
+/// for every b in [0, B.extent(0)), overwriting B(b, :, :) with X.
+///
+/// Calls the batched TRSM of cuBLAS, rocBLAS or MKL when one is enabled for
+/// this execution space and scalar type and the matrices are either all
+/// column-major or all row-major (LayoutRight Views are); otherwise runs a
+/// native kernel with one thread per matrix, as KokkosBatched::SerialTrsm.
+///
+/// \param side [in] "L" or "l" if A is on the left of X, "R" or "r" if on the
+///   right
+/// \param uplo [in] "U" or "u" if the upper part of A is stored, "L" or "l"
+///   if the lower part is; the other part is not referenced
+/// \param trans [in] "N", "T" or "C" for op(A), as in KokkosBlas::trsm
+/// \param diag [in] "U" or "u" if the diagonal of A is assumed to be unit,
+///   "N" or "n" otherwise
+/// \param alpha [in] Input coefficient of B
+/// \param A [in] Input batch of triangular matrices, M x M if side is "L" and
+///   N x N if side is "R"
+/// \param B [in/out] Input batch of M x N right-hand sides, overwritten with
+///   the solutions
+template <class execution_space, class AViewType, class BViewType>
+void trsm_batched(const execution_space& space, const char side[],
+                  const char uplo[], const char trans[], const char diag[],
+                  typename BViewType::const_value_type& alpha,
+                  const AViewType& A, const BViewType& B) {
+  static_assert(Kokkos::is_execution_space_v<execution_space>,
+                "KokkosBlas::trsm_batched: execution_space must be a valid "
+                "Kokkos execution space");
+  static_assert(Kokkos::is_view_v<AViewType> && Kokkos::is_view_v<BViewType>,
+                "KokkosBlas::trsm_batched: A and B must be Kokkos::Views.");
+  static_assert(AViewType::rank == 3 && BViewType::rank == 3,
+                "KokkosBlas::trsm_batched: A and B must have rank 3.");
+  static_assert(std::is_same_v<typename BViewType::value_type,
+                               typename BViewType::non_const_value_type>,
+                "KokkosBlas::trsm_batched: B must be nonconst.");
+  using a_mem = typename AViewType::memory_space;
+  using b_mem = typename BViewType::memory_space;
+  static_assert(
+      Kokkos::SpaceAccessibility<execution_space, a_mem>::accessible &&
+          Kokkos::SpaceAccessibility<execution_space, b_mem>::accessible,
+      "KokkosBlas::trsm_batched: A and B must be accessible from "
+      "execution_space");
+
+  const char s = std::toupper(side[0]), u = std::toupper(uplo[0]),
+             t = std::toupper(trans[0]), d = std::toupper(diag[0]);
+  if ((s != 'L' && s != 'R') || (u != 'L' && u != 'U') ||
+      (t != 'N' && t != 'T' && t != 'C') || (d != 'U' && d != 'N')) {
+    std::ostringstream os;
+    os << "KokkosBlas::trsm_batched: side = '" << side[0] << "' uplo = '"
+       << uplo[0] << "' trans = '" << trans[0] << "' diag = '" << diag[0]
+       << "'. Valid values are 'L' or 'R' for side, 'L' or 'U' for uplo, "
+          "'N', 'T' or 'C' for trans and 'U' or 'N' for diag, in either case.";
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+  if (A.extent(0) != B.extent(0) || A.extent(1) != A.extent(2) ||
+      A.extent(1) != (s == 'L' ? B.extent(1) : B.extent(2))) {
+    std::ostringstream os;
+    os << "KokkosBlas::trsm_batched: Dimensions of A and B do not match: "
+       << "side: " << side[0] << " A: " << A.extent(0) << " x " << A.extent(1)
+       << " x " << A.extent(2) << " B: " << B.extent(0) << " x "
+       << B.extent(1) << " x " << B.extent(2);
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+  if (B.extent(0) == 0 || B.extent(1) == 0 || B.extent(2) == 0) return;
+
+  const char ss[2] = {s, '\0'}, us[2] = {u, '\0'}, ts[2] = {t, '\0'},
+             ds[2] = {d, '\0'};
+  if (Impl::trsm_batched_tpl(space, ss, us, ts, ds, alpha, A, B)) return;
+  Impl::impl_trsm_batched(space, ss, us, ts, ds, alpha, A, B);
+}
+
+/// \brief Batched triangular solve, on the default execution space instance
+/// of B.
+template <class AViewType, class BViewType>
+void trsm_batched(const char side[], const char uplo[], const char trans[],
+                  const char diag[],
+                  typename BViewType::const_value_type& alpha,
+                  const AViewType& A, const BViewType& B) {
+  trsm_batched(typename BViewType::execution_space{}, side, uplo, trans, diag,
+               alpha, A, B);
+}
+
+}  // namespace KokkosBlas
+
+#endif  // KOKKOSBLAS3_BATCHED_HPP_
@@ -20,6 +20,8 @@
 
 #include <KokkosKernels_Macros.hpp>
 #include <KokkosBlas3_gemm_spec.hpp>
+#include <KokkosBlas3_gemm_impl.hpp>
+#include <KokkosBlas3_gemm_packed_impl.hpp>
 #include <KokkosBlas2_gemv.hpp>
 #include <KokkosBlas1_scal.hpp>
 #include <KokkosKernels_helpers.hpp>
@@ -88,33 +90,13 @@ bool gemv_based_gemm(
         nullptr) {
   return false;
 }
-}  // namespace Impl
 
-/// \brief Dense matrix-matrix multiply: C = beta*C + alpha*op(A)*op(B).
-///
-/// \tparam AViewType Input matrix, as a 2-D Kokkos::View
-/// \tparam BViewType Input matrix, as a 2-D Kokkos::View
-/// \tparam CViewType Output matrix, as a nonconst 2-D Kokkos::View
-///
-/// \param space [in] an execution space instance
-/// \param transA [in] "N" for non-transpose, "T" for transpose, "C"
-///   for conjugate transpose.  All characters after the first are
-///   ignored.  This works just like the BLAS routines.
-/// \param transB [in] "N" for non-transpose, "T" for transpose, "C"
-///   for conjugate transpose.  All characters after the first are
-///   ignored.  This works just like the BLAS routines.
-/// \param alpha [in] Input coefficient of A*x
-/// \param A [in] Input matrix, as a 2-D Kokkos::View
-/// \param B [in] Input matrix, as a 2-D Kokkos::View
-/// \param beta [in] Input coefficient of C
-/// \param C [in/out] Output vector, as a nonconst 2-D Kokkos::View
+// Checks the types, transposes and dimensions of the arguments of gemm
 template <class execution_space, class AViewType, class BViewType,
           class CViewType>
-void gemm(const execution_space& space, const char transA[],
-          const char transB[], typename AViewType::const_value_type& alpha,
-          const AViewType& A, const BViewType& B,
-          typename CViewType::const_value_type& beta, const CViewType& C) {
-#if (KOKKOSKERNELS_DEBUG_LEVEL > 0)
+void gemm_check_args(const execution_space& /*space*/, const char transA[],
+                     const char transB[], const AViewType& A,
+                     const BViewType& B, const CViewType& C) {
   static_assert(Kokkos::is_execution_space_v<execution_space>,
                 "KokkosBlas::gemm: execution_space must be a valid Kokkos "
                 "execution space");
@@ -181,6 +163,35 @@ void gemm(const execution_space& space, const char transA[],
        << " x " << B.extent(1) << " C: " << C.extent(0) << " x " << C.extent(1);
     KokkosKernels::Impl::throw_runtime_exception(os.str());
   }
+}
+}  // namespace Impl
+
+/// \brief Dense matrix-matrix multiply: C = beta*C + alpha*op(A)*op(B).
+///
+/// \tparam AViewType Input matrix, as a 2-D Kokkos::View
+/// \tparam BViewType Input matrix, as a 2-D Kokkos::View
+/// \tparam CViewType Output matrix, as a nonconst 2-D Kokkos::View
+///
+/// \param space [in] an execution space instance
+/// \param transA [in] "N" for non-transpose, "T" for transpose, "C"
+///   for conjugate transpose.  All characters after the first are
+///   ignored.  This works just like the BLAS routines.
+/// \param transB [in] "N" for non-transpose, "T" for transpose, "C"
+///   for conjugate transpose.  All characters after the first are
+///   ignored.  This works just like the BLAS routines.
+/// \param alpha [in] Input coefficient of A*x
+/// \param A [in] Input matrix, as a 2-D Kokkos::View
+/// \param B [in] Input matrix, as a 2-D Kokkos::View
+/// \param beta [in] Input coefficient of C
+/// \param C [in/out] Output vector, as a nonconst 2-D Kokkos::View
+template <class execution_space, class AViewType, class BViewType,
+          class CViewType>
+void gemm(const execution_space& space, const char transA[],
+          const char transB[], typename AViewType::const_value_type& alpha,
+          const AViewType& A, const BViewType& B,
+          typename CViewType::const_value_type& beta, const CViewType& C) {
+#if (KOKKOSKERNELS_DEBUG_LEVEL > 0)
+  Impl::gemm_check_args(space, transA, transB, A, B, C);
 #endif  // KOKKOSKERNELS_DEBUG_LEVEL > 0
 
   // Return if C matrix is degenerated
@@ -244,6 +255,92 @@ void gemm(const char transA[], const char transB[],
        C);
 }
 
+/// \brief Dense matrix-matrix multiply with a fused epilogue:
+///   C(i, j) = epilogue(i, j, (beta*C + alpha*op(A)*op(B))(i, j)).
+///
+/// The epilogue is applied to each entry of C by the kernel that computes it,
+/// just before the entry is written back, so that a bias, a clamp, an
+/// activation or a scaling of the output costs no extra pass over C. It is a
+/// functor callable from \c execution_space as
+/// \code
+/// KOKKOS_INLINE_FUNCTION ScalarC operator()(const int i, const int j,
+///                                           const ScalarC& c) const;
+/// \endcode
+/// where \c ScalarC is the value type of C, and is called exactly once for
+/// every entry of C. For example, a bias per row followed by a ReLU is
+/// \code
+/// struct BiasRelu {
+///   Kokkos::View<const double*> bias;
+///   KOKKOS_INLINE_FUNCTION double operator()(int i, int, double c) const {
+///     return Kokkos::max(c + bias(i), 0.0);
+///   }
+/// };
+/// \endcode
+///
+/// A user functor can be neither forwarded to a TPL nor instantiated in the
+/// library, so this always runs the native kernels: the packed GEMM on host
+/// execution spaces and the tiled GEMM on devices.
+///
+/// \tparam AViewType Input matrix, as a 2-D Kokkos::View
+/// \tparam BViewType Input matrix, as a 2-D Kokkos::View
+/// \tparam CViewType Output matrix, as a nonconst 2-D Kokkos::View
+/// \tparam Epilogue Elementwise functor applied to the entries of C
+///
+/// \param space [in] an execution space instance
+/// \param transA [in] "N" for non-transpose, "T" for transpose, "C"
+///   for conjugate transpose.  All characters after the first are
+///   ignored.  This works just like the BLAS routines.
+/// \param transB [in] "N" for non-transpose, "T" for transpose, "C"
+///   for conjugate transpose.  All characters after the first are
+///   ignored.  This works just like the BLAS routines.
+/// \param alpha [in] Input coefficient of A*x
+/// \param A [in] Input matrix, as a 2-D Kokkos::View
+/// \param B [in] Input matrix, as a 2-D Kokkos::View
+/// \param beta [in] Input coefficient of C
+/// \param C [in/out] Output vector, as a nonconst 2-D Kokkos::View
+/// \param epilogue [in] Functor applied to each entry of C before it is
+///   stored
+template <class execution_space, class AViewType, class BViewType,
+          class CViewType, class Epilogue>
+void gemm(const execution_space& space, const char transA[],
+          const char transB[], typename AViewType::const_value_type& alpha,
+          const AViewType& A, const BViewType& B,
+          typename CViewType::const_value_type& beta, const CViewType& C,
+          const Epilogue& epilogue) {
+#if (KOKKOSKERNELS_DEBUG_LEVEL > 0)
+  Impl::gemm_check_args(space, transA, transB, A, B, C);
+#endif  // KOKKOSKERNELS_DEBUG_LEVEL > 0
+
+  // Return if C matrix is degenerated
+  if ((C.extent(0) == 0) || (C.extent(1) == 0)) {
+    return;
+  }
+
+  // An empty inner dimension is handled by the kernels, which then write
+  // epilogue(beta * C)
+  Kokkos::Profiling::pushRegion("KokkosBlas::gemm[epilogue]");
+  if constexpr (KokkosKernels::Impl::kk_is_gpu_exec_space<execution_space>())
+    Impl::impl_gemm_tiled(space, transA, transB, alpha, A, B, beta, C,
+                          epilogue);
+  else
+    Impl::impl_gemm_packed(space, transA, transB, alpha, A, B, beta, C,
+                           epilogue);
+  Kokkos::Profiling::popRegion();
+}
+
+/// \brief Dense matrix-matrix multiply with a fused epilogue:
+///   C(i, j) = epilogue(i, j, (beta*C + alpha*op(A)*op(B))(i, j)).
+///
+/// See the version taking an execution space instance.
+template <class AViewType, class BViewType, class CViewType, class Epilogue>
+void gemm(const char transA[], const char transB[],
+          typename AViewType::const_value_type& alpha, const AViewType& A,
+          const BViewType& B, typename CViewType::const_value_type& beta,
+          const CViewType& C, const Epilogue& epilogue) {
+  gemm(typename CViewType::execution_space{}, transA, transB, alpha, A, B, beta,
+       C, epilogue);
+}
+
 }  // namespace KokkosBlas
 
 #endif  // KOKKOS_BLAS3_MV_HPP_
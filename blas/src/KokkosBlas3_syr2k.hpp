@@ -0,0 +1,119 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef KOKKOSBLAS3_SYR2K_HPP_
+#define KOKKOSBLAS3_SYR2K_HPP_
+
+/// \file KokkosBlas3_syr2k.hpp
+/// \brief Symmetric rank-2k update, which only computes and writes one
+/// triangle of C.
+
+#include "KokkosKernels_Macros.hpp"
+#include "KokkosBlas3_syrk.hpp"
+#include "KokkosBlas3_syr2k_spec.hpp"
+#include "KokkosKernels_helpers.hpp"
+#include "KokkosKernels_Error.hpp"
+#include <sstream>
+#include <type_traits>
+
+namespace KokkosBlas {
+
+/// \brief Symmetric rank-2k update:
+///
+///        C = beta * C + alpha * (A * B^T + B * A^T) if trans == "N" or "n"
+///        C = beta * C + alpha * (A^T * B + B^T * A) if trans == "T" or "t"
+///
+/// Only the triangle of C given by uplo is read and written.
+///
+/// \tparam execution_space a Kokkos execution space to run the kernels on.
+/// \tparam AViewType Input matrix, as a 2-D Kokkos::View
+/// \tparam BViewType Input matrix, as a 2-D Kokkos::View
+/// \tparam CViewType Input/Output N-by-N matrix, as a 2-D Kokkos::View
+///
+/// \param space [in] an execution space instance that may contain a stream
+///                   or a queue to execute the kernel on
+/// \param uplo  [in] "U" or "u" to update the upper triangle of C,
+///                   "L" or "l" to update the lower triangle of C
+/// \param trans [in] "N" or "n": A and B are N-by-K; "T" or "t": A and B are
+///                   K-by-N. "C" or "c" is accepted as "T" for real scalars.
+/// \param alpha [in] Input coefficient of the rank-2k term
+/// \param A [in]     Input matrix, as a 2-D Kokkos::View
+/// \param B [in]     Input matrix, as a 2-D Kokkos::View, of the extents of A
+/// \param beta [in]  Input coefficient of C
+/// \param C [in,out] Input/Output matrix, as a 2-D Kokkos::View
+template <class execution_space, class AViewType, class BViewType,
+          class CViewType>
+void syr2k(const execution_space& space, const char uplo[], const char trans[],
+           typename CViewType::const_value_type& alpha, const AViewType& A,
+           const BViewType& B, typename CViewType::const_value_type& beta,
+           const CViewType& C) {
+  static_assert(Kokkos::is_view<BViewType>::value,
+                "BViewType must be a Kokkos::View.");
+  static_assert(static_cast<int>(BViewType::rank) == 2,
+                "BViewType must have rank 2.");
+
+  using scalar_type = typename CViewType::non_const_value_type;
+  const char* validTrans =
+      Kokkos::ArithTraits<scalar_type>::is_complex ? "NT" : "NTC";
+  Impl::syrk_check_args("syr2k", uplo, trans, validTrans, A, C);
+  if (A.extent(0) != B.extent(0) || A.extent(1) != B.extent(1)) {
+    std::ostringstream os;
+    os << "KokkosBlas::syr2k: Dimensions of A and B do not match: "
+       << "A: " << A.extent(0) << " x " << A.extent(1) << " B: " << B.extent(0)
+       << " x " << B.extent(1);
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  // Return if degenerated matrices are provided
+  if (C.extent(0) == 0) return;
+
+  using AViewInternalType =
+      Kokkos::View<typename AViewType::const_value_type**,
+                   typename AViewType::array_layout,
+                   typename AViewType::device_type,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >;
+  using BViewInternalType =
+      Kokkos::View<typename BViewType::const_value_type**,
+                   typename BViewType::array_layout,
+                   typename BViewType::device_type,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >;
+  using CViewInternalType =
+      Kokkos::View<typename CViewType::non_const_value_type**,
+                   typename CViewType::array_layout,
+                   typename CViewType::device_type,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >;
+
+  KokkosBlas::Impl::SYR2K<execution_space, AViewInternalType,
+                          BViewInternalType,
+                          CViewInternalType>::syr2k(space, uplo, trans, alpha,
+                                                    A, B, beta, C);
+}
+
+/// \brief Symmetric rank-2k update,
+/// C = beta * C + alpha * (op(A) * op(B)^T + op(B) * op(A)^T).
+///
+/// See the version taking an execution space instance.
+template <class AViewType, class BViewType, class CViewType>
+void syr2k(const char uplo[], const char trans[],
+           typename CViewType::const_value_type& alpha, const AViewType& A,
+           const BViewType& B, typename CViewType::const_value_type& beta,
+           const CViewType& C) {
+  syr2k(typename CViewType::execution_space{}, uplo, trans, alpha, A, B, beta,
+        C);
+}
+
+}  // namespace KokkosBlas
+
+#endif  // KOKKOSBLAS3_SYR2K_HPP_
@@ -0,0 +1,216 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef KOKKOSBLAS3_SYRK_HPP_
+#define KOKKOSBLAS3_SYRK_HPP_
+
+/// \file KokkosBlas3_syrk.hpp
+/// \brief Symmetric and Hermitian rank-k updates, which only compute and
+/// write one triangle of C.
+
+#include "KokkosKernels_Macros.hpp"
+#include "KokkosBlas3_syrk_spec.hpp"
+#include "KokkosKernels_helpers.hpp"
+#include "KokkosKernels_Error.hpp"
+#include <sstream>
+#include <type_traits>
+
+namespace KokkosBlas {
+
+namespace Impl {
+
+// Checks the arguments shared by syrk, herk and syr2k. validTrans holds the
+// accepted values of trans[0], in upper case.
+template <class AViewType, class CViewType>
+void syrk_check_args(const char name[], const char uplo[], const char trans[],
+                     const char validTrans[], const AViewType& A,
+                     const CViewType& C) {
+  static_assert(Kokkos::is_view<AViewType>::value,
+                "AViewType must be a Kokkos::View.");
+  static_assert(Kokkos::is_view<CViewType>::value,
+                "CViewType must be a Kokkos::View.");
+  static_assert(static_cast<int>(AViewType::rank) == 2,
+                "AViewType must have rank 2.");
+  static_assert(static_cast<int>(CViewType::rank) == 2,
+                "CViewType must have rank 2.");
+  static_assert(std::is_same<typename CViewType::value_type,
+                             typename CViewType::non_const_value_type>::value,
+                "CViewType must have non-const value type.");
+
+  bool valid_uplo = (uplo[0] == 'U') || (uplo[0] == 'u') || (uplo[0] == 'L') ||
+                    (uplo[0] == 'l');
+  bool valid_trans = false;
+  for (const char* t = validTrans; *t; t++)
+    valid_trans = valid_trans || trans[0] == *t || trans[0] == *t + 'a' - 'A';
+  if (!valid_uplo) {
+    std::ostringstream os;
+    os << "KokkosBlas::" << name << ": uplo = '" << uplo[0] << "'. "
+       << "Valid values include 'U' or 'u' (update the upper triangle of C), "
+          "'L' or 'l' (update the lower triangle of C).";
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+  if (!valid_trans) {
+    std::ostringstream os;
+    os << "KokkosBlas::" << name << ": trans = '" << trans[0] << "'. "
+       << "Valid values include '" << validTrans << "', in upper or lower "
+       << "case.";
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  const bool A_t = (trans[0] != 'N') && (trans[0] != 'n');
+  if (C.extent(0) != C.extent(1) || A.extent(A_t ? 1 : 0) != C.extent(0)) {
+    std::ostringstream os;
+    os << "KokkosBlas::" << name << ": Dimensions of A and C do not match: "
+       << "trans: " << trans[0] << " A: " << A.extent(0) << " x "
+       << A.extent(1) << " C: " << C.extent(0) << " x " << C.extent(1);
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+}
+
+}  // namespace Impl
+
+/// \brief Symmetric rank-k update:
+///
+///        C = beta * C + alpha * A * A^T if trans == "N" or "n"
+///        C = beta * C + alpha * A^T * A if trans == "T" or "t"
+///
+/// Only the triangle of C given by uplo is read and written, which halves the
+/// work of the equivalent gemm (A^T A Gram matrices, CholQR) and leaves C
+/// exactly symmetric.
+///
+/// \tparam execution_space a Kokkos execution space to run the kernels on.
+/// \tparam AViewType Input matrix, as a 2-D Kokkos::View
+/// \tparam CViewType Input/Output N-by-N matrix, as a 2-D Kokkos::View
+///
+/// \param space [in] an execution space instance that may contain a stream
+///                   or a queue to execute the kernel on
+/// \param uplo  [in] "U" or "u" to update the upper triangle of C,
+///                   "L" or "l" to update the lower triangle of C
+/// \param trans [in] "N" or "n": A is N-by-K; "T" or "t": A is K-by-N.
+///                   "C" or "c" is accepted as "T" for real scalars.
+/// \param alpha [in] Input coefficient of op(A) * op(A)^T
+/// \param A [in]     Input matrix, as a 2-D Kokkos::View
+/// \param beta [in]  Input coefficient of C
+/// \param C [in,out] Input/Output matrix, as a 2-D Kokkos::View
+template <class execution_space, class AViewType, class CViewType>
+void syrk(const execution_space& space, const char uplo[], const char trans[],
+          typename CViewType::const_value_type& alpha, const AViewType& A,
+          typename CViewType::const_value_type& beta, const CViewType& C) {
+  using scalar_type = typename CViewType::non_const_value_type;
+  const char* validTrans =
+      Kokkos::ArithTraits<scalar_type>::is_complex ? "NT" : "NTC";
+  Impl::syrk_check_args("syrk", uplo, trans, validTrans, A, C);
+
+  // Return if degenerated matrices are provided
+  if (C.extent(0) == 0) return;
+
+  using AViewInternalType =
+      Kokkos::View<typename AViewType::const_value_type**,
+                   typename AViewType::array_layout,
+                   typename AViewType::device_type,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >;
+  using CViewInternalType =
+      Kokkos::View<typename CViewType::non_const_value_type**,
+                   typename CViewType::array_layout,
+                   typename CViewType::device_type,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >;
+
+  KokkosBlas::Impl::SYRK<execution_space, AViewInternalType,
+                         CViewInternalType>::syrk(space, uplo, trans, false,
+                                                  alpha, A, beta, C);
+}
+
+/// \brief Symmetric rank-k update, C = beta * C + alpha * op(A) * op(A)^T.
+///
+/// See the version taking an execution space instance.
+template <class AViewType, class CViewType>
+void syrk(const char uplo[], const char trans[],
+          typename CViewType::const_value_type& alpha, const AViewType& A,
+          typename CViewType::const_value_type& beta, const CViewType& C) {
+  syrk(typename CViewType::execution_space{}, uplo, trans, alpha, A, beta, C);
+}
+
+/// \brief Hermitian rank-k update:
+///
+///        C = beta * C + alpha * A * A^H if trans == "N" or "n"
+///        C = beta * C + alpha * A^H * A if trans == "C" or "c"
+///
+/// alpha and beta are real. Only the triangle of C given by uplo is read and
+/// written, and the imaginary parts of its diagonal are set to zero.
+///
+/// \tparam execution_space a Kokkos execution space to run the kernels on.
+/// \tparam AViewType Input matrix, as a 2-D Kokkos::View
+/// \tparam CViewType Input/Output N-by-N matrix, as a 2-D Kokkos::View
+///
+/// \param space [in] an execution space instance that may contain a stream
+///                   or a queue to execute the kernel on
+/// \param uplo  [in] "U" or "u" to update the upper triangle of C,
+///                   "L" or "l" to update the lower triangle of C
+/// \param trans [in] "N" or "n": A is N-by-K; "C" or "c": A is K-by-N.
+///                   "T" or "t" is accepted as "C" for real scalars.
+/// \param alpha [in] Real coefficient of op(A) * op(A)^H
+/// \param A [in]     Input matrix, as a 2-D Kokkos::View
+/// \param beta [in]  Real coefficient of C
+/// \param C [in,out] Input/Output matrix, as a 2-D Kokkos::View
+template <class execution_space, class AViewType, class CViewType>
+void herk(const execution_space& space, const char uplo[], const char trans[],
+          const typename Kokkos::ArithTraits<
+              typename CViewType::non_const_value_type>::mag_type& alpha,
+          const AViewType& A,
+          const typename Kokkos::ArithTraits<
+              typename CViewType::non_const_value_type>::mag_type& beta,
+          const CViewType& C) {
+  using scalar_type = typename CViewType::non_const_value_type;
+  const char* validTrans =
+      Kokkos::ArithTraits<scalar_type>::is_complex ? "NC" : "NTC";
+  Impl::syrk_check_args("herk", uplo, trans, validTrans, A, C);
+
+  // Return if degenerated matrices are provided
+  if (C.extent(0) == 0) return;
+
+  using AViewInternalType =
+      Kokkos::View<typename AViewType::const_value_type**,
+                   typename AViewType::array_layout,
+                   typename AViewType::device_type,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >;
+  using CViewInternalType =
+      Kokkos::View<typename CViewType::non_const_value_type**,
+                   typename CViewType::array_layout,
+                   typename CViewType::device_type,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >;
+
+  KokkosBlas::Impl::SYRK<execution_space, AViewInternalType,
+                         CViewInternalType>::syrk(space, uplo, trans, true,
+                                                  scalar_type(alpha), A,
+                                                  scalar_type(beta), C);
+}
+
+/// \brief Hermitian rank-k update, C = beta * C + alpha * op(A) * op(A)^H.
+///
+/// See the version taking an execution space instance.
+template <class AViewType, class CViewType>
+void herk(const char uplo[], const char trans[],
+          const typename Kokkos::ArithTraits<
+              typename CViewType::non_const_value_type>::mag_type& alpha,
+          const AViewType& A,
+          const typename Kokkos::ArithTraits<
+              typename CViewType::non_const_value_type>::mag_type& beta,
+          const CViewType& C) {
+  herk(typename CViewType::execution_space{}, uplo, trans, alpha, A, beta, C);
+}
+
+}  // namespace KokkosBlas
+
+#endif  // KOKKOSBLAS3_SYRK_HPP_
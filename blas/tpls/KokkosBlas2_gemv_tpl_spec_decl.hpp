@@ -319,14 +319,12 @@ namespace Impl {
                      const YViewType& Y) {                                     \
       Kokkos::Profiling::pushRegion("KokkosBlas::gemv[TPL_CUBLAS,double]");    \
       KOKKOSBLAS2_GEMV_CUBLAS_DETERMINE_ARGS(LAYOUTA);                         \
-      KokkosBlas::Impl::CudaBlasSingleton& s =                                 \
-          KokkosBlas::Impl::CudaBlasSingleton::singleton();                    \
-      KOKKOS_CUBLAS_SAFE_CALL_IMPL(                                            \
-          cublasSetStream(s.handle, space.cuda_stream()));                     \
-      KOKKOS_CUBLAS_SAFE_CALL_IMPL(cublasDgemv(s.handle, transa, M, N, &alpha, \
+      cublasHandle_t handle =                                                  \
+          KokkosBlas::Impl::CudaBlasSingleton::stream_handle(                  \
+              space.cuda_stream());                                            \
+      KOKKOS_CUBLAS_SAFE_CALL_IMPL(cublasDgemv(handle, transa, M, N, &alpha,   \
                                                A.data(), LDA, X.data(), one,   \
                                                &beta, Y.data(), one));         \
-      KOKKOS_CUBLAS_SAFE_CALL_IMPL(cublasSetStream(s.handle, NULL));           \
       Kokkos::Profiling::popRegion();                                          \
     }                                                                          \
   };
@@ -366,14 +364,12 @@ namespace Impl {
                      const YViewType& Y) {                                     \
       Kokkos::Profiling::pushRegion("KokkosBlas::gemv[TPL_CUBLAS,float]");     \
       KOKKOSBLAS2_GEMV_CUBLAS_DETERMINE_ARGS(LAYOUTA);                         \
-      KokkosBlas::Impl::CudaBlasSingleton& s =                                 \
-          KokkosBlas::Impl::CudaBlasSingleton::singleton();                    \
-      KOKKOS_CUBLAS_SAFE_CALL_IMPL(                                            \
-          cublasSetStream(s.handle, space.cuda_stream()));                     \
-      KOKKOS_CUBLAS_SAFE_CALL_IMPL(cublasSgemv(s.handle, transa, M, N, &alpha, \
+      cublasHandle_t handle =                                                  \
+          KokkosBlas::Impl::CudaBlasSingleton::stream_handle(                  \
+              space.cuda_stream());                                            \
+      KOKKOS_CUBLAS_SAFE_CALL_IMPL(cublasSgemv(handle, transa, M, N, &alpha,   \
                                                A.data(), LDA, X.data(), one,   \
                                                &beta, Y.data(), one));         \
-      KOKKOS_CUBLAS_SAFE_CALL_IMPL(cublasSetStream(s.handle, NULL));           \
       Kokkos::Profiling::popRegion();                                          \
     }                                                                          \
   };
@@ -414,18 +410,16 @@ namespace Impl {
       Kokkos::Profiling::pushRegion(                                           \
           "KokkosBlas::gemv[TPL_CUBLAS,complex<double>]");                     \
       KOKKOSBLAS2_GEMV_CUBLAS_DETERMINE_ARGS(LAYOUTA);                         \
-      KokkosBlas::Impl::CudaBlasSingleton& s =                                 \
-          KokkosBlas::Impl::CudaBlasSingleton::singleton();                    \
-      KOKKOS_CUBLAS_SAFE_CALL_IMPL(                                            \
-          cublasSetStream(s.handle, space.cuda_stream()));                     \
+      cublasHandle_t handle =                                                  \
+          KokkosBlas::Impl::CudaBlasSingleton::stream_handle(                  \
+              space.cuda_stream());                                            \
       KOKKOS_CUBLAS_SAFE_CALL_IMPL(                                            \
-          cublasZgemv(s.handle, transa, M, N,                                  \
+          cublasZgemv(handle, transa, M, N,                                    \
                       reinterpret_cast<const cuDoubleComplex*>(&alpha),        \
                       reinterpret_cast<const cuDoubleComplex*>(A.data()), LDA, \
                       reinterpret_cast<const cuDoubleComplex*>(X.data()), one, \
                       reinterpret_cast<const cuDoubleComplex*>(&beta),         \
                       reinterpret_cast<cuDoubleComplex*>(Y.data()), one));     \
-      KOKKOS_CUBLAS_SAFE_CALL_IMPL(cublasSetStream(s.handle, NULL));           \
       Kokkos::Profiling::popRegion();                                          \
     }                                                                          \
   };
@@ -466,17 +460,15 @@ namespace Impl {
       Kokkos::Profiling::pushRegion(                                          \
           "KokkosBlas::gemv[TPL_CUBLAS,complex<float>]");                     \
       KOKKOSBLAS2_GEMV_CUBLAS_DETERMINE_ARGS(LAYOUTA);                        \
-      KokkosBlas::Impl::CudaBlasSingleton& s =                                \
-          KokkosBlas::Impl::CudaBlasSingleton::singleton();                   \
-      KOKKOS_CUBLAS_SAFE_CALL_IMPL(                                           \
-          cublasSetStream(s.handle, space.cuda_stream()));                    \
+      cublasHandle_t handle =                                                 \
+          KokkosBlas::Impl::CudaBlasSingleton::stream_handle(                 \
+              space.cuda_stream());                                           \
       KOKKOS_CUBLAS_SAFE_CALL_IMPL(cublasCgemv(                               \
-          s.handle, transa, M, N, reinterpret_cast<const cuComplex*>(&alpha), \
+          handle, transa, M, N, reinterpret_cast<const cuComplex*>(&alpha),   \
           reinterpret_cast<const cuComplex*>(A.data()), LDA,                  \
           reinterpret_cast<const cuComplex*>(X.data()), one,                  \
           reinterpret_cast<const cuComplex*>(&beta),                          \
           reinterpret_cast<cuComplex*>(Y.data()), one));                      \
-      KOKKOS_CUBLAS_SAFE_CALL_IMPL(cublasSetStream(s.handle, NULL));          \
       Kokkos::Profiling::popRegion();                                         \
     }                                                                         \
   };
@@ -582,14 +574,12 @@ namespace Impl {
                      const YViewType& Y) {                                   \
       Kokkos::Profiling::pushRegion("KokkosBlas::gemv[TPL_ROCBLAS,double]"); \
       KOKKOSBLAS2_GEMV_ROCBLAS_DETERMINE_ARGS(LAYOUT);                       \
-      KokkosBlas::Impl::RocBlasSingleton& s =                                \
-          KokkosBlas::Impl::RocBlasSingleton::singleton();                   \
+      rocblas_handle handle =                                                \
+          KokkosBlas::Impl::RocBlasSingleton::stream_handle(                 \
+              space.hip_stream());                                           \
       KOKKOS_ROCBLAS_SAFE_CALL_IMPL(                                         \
-          rocblas_set_stream(s.handle, space.hip_stream()));                 \
-      KOKKOS_ROCBLAS_SAFE_CALL_IMPL(                                         \
-          rocblas_dgemv(s.handle, transa, M, N, &alpha, A.data(), LDA,       \
+          rocblas_dgemv(handle, transa, M, N, &alpha, A.data(), LDA,         \
                         X.data(), one, &beta, Y.data(), one));               \
-      KOKKOS_ROCBLAS_SAFE_CALL_IMPL(rocblas_set_stream(s.handle, NULL));     \
       Kokkos::Profiling::popRegion();                                        \
     }                                                                        \
   };
@@ -628,14 +618,12 @@ namespace Impl {
                      const YViewType& Y) {                                  \
       Kokkos::Profiling::pushRegion("KokkosBlas::gemv[TPL_ROCBLAS,float]"); \
       KOKKOSBLAS2_GEMV_ROCBLAS_DETERMINE_ARGS(LAYOUT);                      \
-      KokkosBlas::Impl::RocBlasSingleton& s =                               \
-          KokkosBlas::Impl::RocBlasSingleton::singleton();                  \
-      KOKKOS_ROCBLAS_SAFE_CALL_IMPL(                                        \
-          rocblas_set_stream(s.handle, space.hip_stream()));                \
+      rocblas_handle handle =                                               \
+          KokkosBlas::Impl::RocBlasSingleton::stream_handle(                \
+              space.hip_stream());                                          \
       KOKKOS_ROCBLAS_SAFE_CALL_IMPL(                                        \
-          rocblas_sgemv(s.handle, transa, M, N, &alpha, A.data(), LDA,      \
+          rocblas_sgemv(handle, transa, M, N, &alpha, A.data(), LDA,        \
                         X.data(), one, &beta, Y.data(), one));              \
-      KOKKOS_ROCBLAS_SAFE_CALL_IMPL(rocblas_set_stream(s.handle, NULL));    \
       Kokkos::Profiling::popRegion();                                       \
     }                                                                       \
   };
@@ -675,18 +663,16 @@ namespace Impl {
       Kokkos::Profiling::pushRegion(                                      \
           "KokkosBlas::gemv[TPL_ROCBLAS,complex<double>]");               \
       KOKKOSBLAS2_GEMV_ROCBLAS_DETERMINE_ARGS(LAYOUT);                    \
-      KokkosBlas::Impl::RocBlasSingleton& s =                             \
-          KokkosBlas::Impl::RocBlasSingleton::singleton();                \
-      KOKKOS_ROCBLAS_SAFE_CALL_IMPL(                                      \
-          rocblas_set_stream(s.handle, space.hip_stream()));              \
+      rocblas_handle handle =                                             \
+          KokkosBlas::Impl::RocBlasSingleton::stream_handle(              \
+              space.hip_stream());                                        \
       KOKKOS_ROCBLAS_SAFE_CALL_IMPL(rocblas_zgemv(                        \
-          s.handle, transa, M, N,                                         \
+          handle, transa, M, N,                                           \
           reinterpret_cast<const rocblas_double_complex*>(&alpha),        \
           reinterpret_cast<const rocblas_double_complex*>(A.data()), LDA, \
           reinterpret_cast<const rocblas_double_complex*>(X.data()), one, \
           reinterpret_cast<const rocblas_double_complex*>(&beta),         \
           reinterpret_cast<rocblas_double_complex*>(Y.data()), one));     \
-      KOKKOS_ROCBLAS_SAFE_CALL_IMPL(rocblas_set_stream(s.handle, NULL));  \
       Kokkos::Profiling::popRegion();                                     \
     }                                                                     \
   };
@@ -726,18 +712,16 @@ namespace Impl {
       Kokkos::Profiling::pushRegion(                                     \
           "KokkosBlas::gemv[TPL_ROCBLAS,complex<float>]");               \
       KOKKOSBLAS2_GEMV_ROCBLAS_DETERMINE_ARGS(LAYOUT);                   \
-      KokkosBlas::Impl::RocBlasSingleton& s =                            \
-          KokkosBlas::Impl::RocBlasSingleton::singleton();               \
-      KOKKOS_ROCBLAS_SAFE_CALL_IMPL(                                     \
-          rocblas_set_stream(s.handle, space.hip_stream()));             \
+      rocblas_handle handle =                                            \
+          KokkosBlas::Impl::RocBlasSingleton::stream_handle(             \
+              space.hip_stream());                                       \
       KOKKOS_ROCBLAS_SAFE_CALL_IMPL(rocblas_cgemv(                       \
-          s.handle, transa, M, N,                                        \
+          handle, transa, M, N,                                          \
           reinterpret_cast<const rocblas_float_complex*>(&alpha),        \
           reinterpret_cast<const rocblas_float_complex*>(A.data()), LDA, \
           reinterpret_cast<const rocblas_float_complex*>(X.data()), one, \
           reinterpret_cast<const rocblas_float_complex*>(&beta),         \
           reinterpret_cast<rocblas_float_complex*>(Y.data()), one));     \
-      KOKKOS_ROCBLAS_SAFE_CALL_IMPL(rocblas_set_stream(s.handle, NULL)); \
       Kokkos::Profiling::popRegion();                                    \
     }                                                                    \
   };
@@ -0,0 +1,444 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef KOKKOSBLAS2_SYMV_TPL_SPEC_DECL_HPP_
+#define KOKKOSBLAS2_SYMV_TPL_SPEC_DECL_HPP_
+
+#define KOKKOSBLAS2_SYMV_DETERMINE_ARGS(LAYOUT)                           \
+  const bool lower = (uplo[0] == 'L') || (uplo[0] == 'l');                \
+  const bool is_lr = std::is_same<Kokkos::LayoutRight, LAYOUT>::value;    \
+  const int N      = static_cast<int>(A.extent(0));                       \
+  const int AST    = is_lr ? A.stride(0) : A.stride(1),                   \
+            LDA    = AST == 0 ? 1 : AST;                                  \
+  constexpr int one = 1;                                                  \
+  /* row-major: A is its own transpose, with the other triangle stored */ \
+  const bool lower_ = lower != is_lr;
+
+// Generic Host side BLAS (could be MKL or anything)
+#if defined(KOKKOSKERNELS_ENABLE_TPL_BLAS)
+#include "KokkosBlas_Host_tpl.hpp"
+
+namespace KokkosBlas {
+namespace Impl {
+
+#define KOKKOSBLAS2_SYMV_BLAS_REAL(SCALAR_TYPE, LAYOUT, MEM_SPACE,            \
+                                   ETI_SPEC_AVAIL)                            \
+  template <class ExecSpace>                                                  \
+  struct SYMV<ExecSpace,                                                      \
+              Kokkos::View<const SCALAR_TYPE**, LAYOUT,                       \
+                           Kokkos::Device<ExecSpace, MEM_SPACE>,              \
+                           Kokkos::MemoryTraits<Kokkos::Unmanaged> >,         \
+              Kokkos::View<const SCALAR_TYPE*, LAYOUT,                        \
+                           Kokkos::Device<ExecSpace, MEM_SPACE>,              \
+                           Kokkos::MemoryTraits<Kokkos::Unmanaged> >,         \
+              Kokkos::View<SCALAR_TYPE*, LAYOUT,                              \
+                           Kokkos::Device<ExecSpace, MEM_SPACE>,              \
+                           Kokkos::MemoryTraits<Kokkos::Unmanaged> >,         \
+              true, ETI_SPEC_AVAIL> {                                         \
+    typedef SCALAR_TYPE SCALAR;                                               \
+    typedef Kokkos::View<const SCALAR**, LAYOUT,                              \
+                         Kokkos::Device<ExecSpace, MEM_SPACE>,                \
+                         Kokkos::MemoryTraits<Kokkos::Unmanaged> >            \
+        AViewType;                                                            \
+    typedef Kokkos::View<const SCALAR*, LAYOUT,                               \
+                         Kokkos::Device<ExecSpace, MEM_SPACE>,                \
+                         Kokkos::MemoryTraits<Kokkos::Unmanaged> >            \
+        XViewType;                                                            \
+    typedef Kokkos::View<SCALAR*, LAYOUT,                                     \
+                         Kokkos::Device<ExecSpace, MEM_SPACE>,                \
+                         Kokkos::MemoryTraits<Kokkos::Unmanaged> >            \
+        YViewType;                                                            \
+    typedef SYMV<ExecSpace, AViewType, XViewType, YViewType, false,           \
+                 ETI_SPEC_AVAIL>                                              \
+        native_type;                                                          \
+                                                                              \
+    static void symv(const ExecSpace& /*space*/, const char uplo[],           \
+                     const bool /*hermitian*/,                                \
+                     typename YViewType::const_value_type& alpha,             \
+                     const AViewType& A, const XViewType& x,                  \
+                     typename YViewType::const_value_type& beta,              \
+                     const YViewType& y) {                                    \
+      Kokkos::Profiling::pushRegion("KokkosBlas::symv[TPL_BLAS," #SCALAR_TYPE \
+                                    "]");                                     \
+      KOKKOSBLAS2_SYMV_DETERMINE_ARGS(LAYOUT);                                \
+      HostBlas<SCALAR>::symv(lower_ ? 'L' : 'U', N, alpha, A.data(), LDA,     \
+                             x.data(), one, beta, y.data(), one);             \
+      Kokkos::Profiling::popRegion();                                         \
+    }                                                                         \
+  };
+
+#define KOKKOSBLAS2_SYMV_BLAS_COMPLEX(SCALAR_TYPE, BASE_SCALAR_TYPE, LAYOUT,  \
+                                      MEM_SPACE, ETI_SPEC_AVAIL)              \
+  template <class ExecSpace>                                                  \
+  struct SYMV<ExecSpace,                                                      \
+              Kokkos::View<const SCALAR_TYPE**, LAYOUT,                       \
+                           Kokkos::Device<ExecSpace, MEM_SPACE>,              \
+                           Kokkos::MemoryTraits<Kokkos::Unmanaged> >,         \
+              Kokkos::View<const SCALAR_TYPE*, LAYOUT,                        \
+                           Kokkos::Device<ExecSpace, MEM_SPACE>,              \
+                           Kokkos::MemoryTraits<Kokkos::Unmanaged> >,         \
+              Kokkos::View<SCALAR_TYPE*, LAYOUT,                              \
+                           Kokkos::Device<ExecSpace, MEM_SPACE>,              \
+                           Kokkos::MemoryTraits<Kokkos::Unmanaged> >,         \
+              true, ETI_SPEC_AVAIL> {                                         \
+    typedef SCALAR_TYPE SCALAR;                                               \
+    typedef Kokkos::View<const SCALAR**, LAYOUT,                              \
+                         Kokkos::Device<ExecSpace, MEM_SPACE>,                \
+                         Kokkos::MemoryTraits<Kokkos::Unmanaged> >            \
+        AViewType;                                                            \
+    typedef Kokkos::View<const SCALAR*, LAYOUT,                               \
+                         Kokkos::Device<ExecSpace, MEM_SPACE>,                \
+                         Kokkos::MemoryTraits<Kokkos::Unmanaged> >            \
+        XViewType;                                                            \
+    typedef Kokkos::View<SCALAR*, LAYOUT,                                     \
+                         Kokkos::Device<ExecSpace, MEM_SPACE>,                \
+                         Kokkos::MemoryTraits<Kokkos::Unmanaged> >            \
+        YViewType;                                                            \
+    typedef SYMV<ExecSpace, AViewType, XViewType, YViewType, false,           \
+                 ETI_SPEC_AVAIL>                                              \
+        native_type;                                                          \
+                                                                              \
+    static void symv(const ExecSpace& space, const char uplo[],               \
+                     const bool hermitian,                                    \
+                     typename YViewType::const_value_type& alpha,             \
+                     const AViewType& A, const XViewType& x,                  \
+                     typename YViewType::const_value_type& beta,              \
+                     const YViewType& y) {                                    \
+      Kokkos::Profiling::pushRegion("KokkosBlas::symv[TPL_BLAS," #SCALAR_TYPE \
+                                    "]");                                     \
+      KOKKOSBLAS2_SYMV_DETERMINE_ARGS(LAYOUT);                                \
+      if (hermitian && !is_lr) {                                              \
+        HostBlas<BASE_SCALAR_TYPE>::hemv(                                     \
+            lower_ ? 'L' : 'U', N, alpha,                                     \
+            reinterpret_cast<const BASE_SCALAR_TYPE*>(A.data()), LDA,         \
+            reinterpret_cast<const BASE_SCALAR_TYPE*>(x.data()), one, beta,   \
+            reinterpret_cast<BASE_SCALAR_TYPE*>(y.data()), one);              \
+      } else {                                                                \
+        /* No blasZsymv(), and the transpose of a Hermitian A is conj(A) =>   \
+         * call kokkos-kernels' implementation */                             \
+        native_type::symv(space, uplo, hermitian, alpha, A, x, beta, y);      \
+      }                                                                       \
+      Kokkos::Profiling::popRegion();                                         \
+    }                                                                         \
+  };
+
+#define KOKKOSBLAS2_DSYMV_BLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL) \
+  KOKKOSBLAS2_SYMV_BLAS_REAL(double, LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)
+
+#define KOKKOSBLAS2_SSYMV_BLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL) \
+  KOKKOSBLAS2_SYMV_BLAS_REAL(float, LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)
+
+#define KOKKOSBLAS2_ZSYMV_BLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)              \
+  KOKKOSBLAS2_SYMV_BLAS_COMPLEX(Kokkos::complex<double>, std::complex<double>, \
+                                LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)
+
+#define KOKKOSBLAS2_CSYMV_BLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)            \
+  KOKKOSBLAS2_SYMV_BLAS_COMPLEX(Kokkos::complex<float>, std::complex<float>, \
+                                LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)
+
+// Explicitly define the SYMV class for all permutations listed below
+
+KOKKOSBLAS2_DSYMV_BLAS(Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS2_DSYMV_BLAS(Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS2_DSYMV_BLAS(Kokkos::LayoutRight, Kokkos::HostSpace, true)
+KOKKOSBLAS2_DSYMV_BLAS(Kokkos::LayoutRight, Kokkos::HostSpace, false)
+
+KOKKOSBLAS2_SSYMV_BLAS(Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS2_SSYMV_BLAS(Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS2_SSYMV_BLAS(Kokkos::LayoutRight, Kokkos::HostSpace, true)
+KOKKOSBLAS2_SSYMV_BLAS(Kokkos::LayoutRight, Kokkos::HostSpace, false)
+
+KOKKOSBLAS2_ZSYMV_BLAS(Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS2_ZSYMV_BLAS(Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS2_ZSYMV_BLAS(Kokkos::LayoutRight, Kokkos::HostSpace, true)
+KOKKOSBLAS2_ZSYMV_BLAS(Kokkos::LayoutRight, Kokkos::HostSpace, false)
+
+KOKKOSBLAS2_CSYMV_BLAS(Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS2_CSYMV_BLAS(Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS2_CSYMV_BLAS(Kokkos::LayoutRight, Kokkos::HostSpace, true)
+KOKKOSBLAS2_CSYMV_BLAS(Kokkos::LayoutRight, Kokkos::HostSpace, false)
+
+}  // namespace Impl
+}  // namespace KokkosBlas
+#endif  // KOKKOSKERNELS_ENABLE_TPL_BLAS
+
+// cuBLAS
+#if defined(KOKKOSKERNELS_ENABLE_TPL_CUBLAS)
+#include <KokkosBlas_tpl_spec.hpp>
+
+namespace KokkosBlas {
+namespace Impl {
+
+#define KOKKOSBLAS2_SYMV_CUBLAS(SCALAR_TYPE, CUDA_SCALAR_TYPE, SYMV_FN,       \
+                                HEMV_FN, LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)   \
+  template <class ExecSpace>                                                  \
+  struct SYMV<ExecSpace,                                                      \
+              Kokkos::View<const SCALAR_TYPE**, LAYOUT,                       \
+                           Kokkos::Device<ExecSpace, MEM_SPACE>,              \
+                           Kokkos::MemoryTraits<Kokkos::Unmanaged> >,         \
+              Kokkos::View<const SCALAR_TYPE*, LAYOUT,                        \
+                           Kokkos::Device<ExecSpace, MEM_SPACE>,              \
+                           Kokkos::MemoryTraits<Kokkos::Unmanaged> >,         \
+              Kokkos::View<SCALAR_TYPE*, LAYOUT,                              \
+                           Kokkos::Device<ExecSpace, MEM_SPACE>,              \
+                           Kokkos::MemoryTraits<Kokkos::Unmanaged> >,         \
+              true, ETI_SPEC_AVAIL> {                                         \
+    typedef SCALAR_TYPE SCALAR;                                               \
+    typedef Kokkos::View<const SCALAR**, LAYOUT,                              \
+                         Kokkos::Device<ExecSpace, MEM_SPACE>,                \
+                         Kokkos::MemoryTraits<Kokkos::Unmanaged> >            \
+        AViewType;                                                            \
+    typedef Kokkos::View<const SCALAR*, LAYOUT,                               \
+                         Kokkos::Device<ExecSpace, MEM_SPACE>,                \
+                         Kokkos::MemoryTraits<Kokkos::Unmanaged> >            \
+        XViewType;                                                            \
+    typedef Kokkos::View<SCALAR*, LAYOUT,                                     \
+                         Kokkos::Device<ExecSpace, MEM_SPACE>,                \
+                         Kokkos::MemoryTraits<Kokkos::Unmanaged> >            \
+        YViewType;                                                            \
+    typedef SYMV<ExecSpace, AViewType, XViewType, YViewType, false,           \
+                 ETI_SPEC_AVAIL>                                              \
+        native_type;                                                          \
+                                                                              \
+    static void symv(const ExecSpace& space, const char uplo[],               \
+                     const bool hermitian,                                    \
+                     typename YViewType::const_value_type& alpha,             \
+                     const AViewType& A, const XViewType& x,                  \
+                     typename YViewType::const_value_type& beta,              \
+                     const YViewType& y) {                                    \
+      Kokkos::Profiling::pushRegion(                                          \
+          "KokkosBlas::symv[TPL_CUBLAS," #SCALAR_TYPE "]");                   \
+      KOKKOSBLAS2_SYMV_DETERMINE_ARGS(LAYOUT);                                \
+      const bool herm = hermitian && Kokkos::ArithTraits<SCALAR>::is_complex; \
+      if (herm && is_lr) {                                                    \
+        /* the transpose of a Hermitian A is conj(A) => call kokkos-kernels'  \
+         * implementation */                                                  \
+        native_type::symv(space, uplo, hermitian, alpha, A, x, beta, y);      \
+        Kokkos::Profiling::popRegion();                                       \
+        return;                                                               \
+      }                                                                       \
+      cublasFillMode_t uplo_ =                                                \
+          lower_ ? CUBLAS_FILL_MODE_LOWER : CUBLAS_FILL_MODE_UPPER;           \
+      KokkosBlas::Impl::CudaBlasSingleton& s =                                \
+          KokkosBlas::Impl::CudaBlasSingleton::singleton();                   \
+      KOKKOS_CUBLAS_SAFE_CALL_IMPL(                                           \
+          cublasSetStream(s.handle, space.cuda_stream()));                    \
+      if (herm)                                                               \
+        KOKKOS_CUBLAS_SAFE_CALL_IMPL(HEMV_FN(                                 \
+            s.handle, uplo_, N,                                               \
+            reinterpret_cast<const CUDA_SCALAR_TYPE*>(&alpha),                \
+            reinterpret_cast<const CUDA_SCALAR_TYPE*>(A.data()), LDA,         \
+            reinterpret_cast<const CUDA_SCALAR_TYPE*>(x.data()), one,         \
+            reinterpret_cast<const CUDA_SCALAR_TYPE*>(&beta),                 \
+            reinterpret_cast<CUDA_SCALAR_TYPE*>(y.data()), one));             \
+      else                                                                    \
+        KOKKOS_CUBLAS_SAFE_CALL_IMPL(SYMV_FN(                                 \
+            s.handle, uplo_, N,                                               \
+            reinterpret_cast<const CUDA_SCALAR_TYPE*>(&alpha),                \
+            reinterpret_cast<const CUDA_SCALAR_TYPE*>(A.data()), LDA,         \
+            reinterpret_cast<const CUDA_SCALAR_TYPE*>(x.data()), one,         \
+            reinterpret_cast<const CUDA_SCALAR_TYPE*>(&beta),                 \
+            reinterpret_cast<CUDA_SCALAR_TYPE*>(y.data()), one));             \
+      KOKKOS_CUBLAS_SAFE_CALL_IMPL(cublasSetStream(s.handle, NULL));          \
+      Kokkos::Profiling::popRegion();                                         \
+    }                                                                         \
+  };
+
+#define KOKKOSBLAS2_DSYMV_CUBLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)         \
+  KOKKOSBLAS2_SYMV_CUBLAS(double, double, cublasDsymv, cublasDsymv, LAYOUT, \
+                          MEM_SPACE, ETI_SPEC_AVAIL)
+
+#define KOKKOSBLAS2_SSYMV_CUBLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)       \
+  KOKKOSBLAS2_SYMV_CUBLAS(float, float, cublasSsymv, cublasSsymv, LAYOUT, \
+                          MEM_SPACE, ETI_SPEC_AVAIL)
+
+#define KOKKOSBLAS2_ZSYMV_CUBLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)    \
+  KOKKOSBLAS2_SYMV_CUBLAS(Kokkos::complex<double>, cuDoubleComplex,    \
+                          cublasZsymv, cublasZhemv, LAYOUT, MEM_SPACE, \
+                          ETI_SPEC_AVAIL)
+
+#define KOKKOSBLAS2_CSYMV_CUBLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)       \
+  KOKKOSBLAS2_SYMV_CUBLAS(Kokkos::complex<float>, cuComplex, cublasCsymv, \
+                          cublasChemv, LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)
+
+// Explicitly define the SYMV class for all permutations listed below
+
+KOKKOSBLAS2_DSYMV_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaSpace, true)
+KOKKOSBLAS2_DSYMV_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaSpace, false)
+KOKKOSBLAS2_DSYMV_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaUVMSpace, true)
+KOKKOSBLAS2_DSYMV_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaUVMSpace, false)
+KOKKOSBLAS2_DSYMV_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaSpace, true)
+KOKKOSBLAS2_DSYMV_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaSpace, false)
+KOKKOSBLAS2_DSYMV_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaUVMSpace, true)
+KOKKOSBLAS2_DSYMV_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaUVMSpace, false)
+
+KOKKOSBLAS2_SSYMV_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaSpace, true)
+KOKKOSBLAS2_SSYMV_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaSpace, false)
+KOKKOSBLAS2_SSYMV_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaUVMSpace, true)
+KOKKOSBLAS2_SSYMV_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaUVMSpace, false)
+KOKKOSBLAS2_SSYMV_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaSpace, true)
+KOKKOSBLAS2_SSYMV_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaSpace, false)
+KOKKOSBLAS2_SSYMV_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaUVMSpace, true)
+KOKKOSBLAS2_SSYMV_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaUVMSpace, false)
+
+KOKKOSBLAS2_ZSYMV_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaSpace, true)
+KOKKOSBLAS2_ZSYMV_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaSpace, false)
+KOKKOSBLAS2_ZSYMV_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaUVMSpace, true)
+KOKKOSBLAS2_ZSYMV_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaUVMSpace, false)
+KOKKOSBLAS2_ZSYMV_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaSpace, true)
+KOKKOSBLAS2_ZSYMV_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaSpace, false)
+KOKKOSBLAS2_ZSYMV_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaUVMSpace, true)
+KOKKOSBLAS2_ZSYMV_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaUVMSpace, false)
+
+KOKKOSBLAS2_CSYMV_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaSpace, true)
+KOKKOSBLAS2_CSYMV_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaSpace, false)
+KOKKOSBLAS2_CSYMV_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaUVMSpace, true)
+KOKKOSBLAS2_CSYMV_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaUVMSpace, false)
+KOKKOSBLAS2_CSYMV_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaSpace, true)
+KOKKOSBLAS2_CSYMV_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaSpace, false)
+KOKKOSBLAS2_CSYMV_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaUVMSpace, true)
+KOKKOSBLAS2_CSYMV_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaUVMSpace, false)
+
+}  // namespace Impl
+}  // namespace KokkosBlas
+#endif  // KOKKOSKERNELS_ENABLE_TPL_CUBLAS
+
+// rocBLAS
+#if defined(KOKKOSKERNELS_ENABLE_TPL_ROCBLAS)
+#include <KokkosBlas_tpl_spec.hpp>
+
+namespace KokkosBlas {
+namespace Impl {
+
+#define KOKKOSBLAS2_SYMV_ROCBLAS(SCALAR_TYPE, ROCBLAS_SCALAR_TYPE, SYMV_FN,   \
+                                HEMV_FN, LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)   \
+  template <class ExecSpace>                                                  \
+  struct SYMV<ExecSpace,                                                      \
+              Kokkos::View<const SCALAR_TYPE**, LAYOUT,                       \
+                           Kokkos::Device<ExecSpace, MEM_SPACE>,              \
+                           Kokkos::MemoryTraits<Kokkos::Unmanaged> >,         \
+              Kokkos::View<const SCALAR_TYPE*, LAYOUT,                        \
+                           Kokkos::Device<ExecSpace, MEM_SPACE>,              \
+                           Kokkos::MemoryTraits<Kokkos::Unmanaged> >,         \
+              Kokkos::View<SCALAR_TYPE*, LAYOUT,                              \
+                           Kokkos::Device<ExecSpace, MEM_SPACE>,              \
+                           Kokkos::MemoryTraits<Kokkos::Unmanaged> >,         \
+              true, ETI_SPEC_AVAIL> {                                         \
+    typedef SCALAR_TYPE SCALAR;                                               \
+    typedef Kokkos::View<const SCALAR**, LAYOUT,                              \
+                         Kokkos::Device<ExecSpace, MEM_SPACE>,                \
+                         Kokkos::MemoryTraits<Kokkos::Unmanaged> >            \
+        AViewType;                                                            \
+    typedef Kokkos::View<const SCALAR*, LAYOUT,                               \
+                         Kokkos::Device<ExecSpace, MEM_SPACE>,                \
+                         Kokkos::MemoryTraits<Kokkos::Unmanaged> >            \
+        XViewType;                                                            \
+    typedef Kokkos::View<SCALAR*, LAYOUT,                                     \
+                         Kokkos::Device<ExecSpace, MEM_SPACE>,                \
+                         Kokkos::MemoryTraits<Kokkos::Unmanaged> >            \
+        YViewType;                                                            \
+    typedef SYMV<ExecSpace, AViewType, XViewType, YViewType, false,           \
+                 ETI_SPEC_AVAIL>                                              \
+        native_type;                                                          \
+                                                                              \
+    static void symv(const ExecSpace& space, const char uplo[],               \
+                     const bool hermitian,                                    \
+                     typename YViewType::const_value_type& alpha,             \
+                     const AViewType& A, const XViewType& x,                  \
+                     typename YViewType::const_value_type& beta,              \
+                     const YViewType& y) {                                    \
+      Kokkos::Profiling::pushRegion(                                          \
+          "KokkosBlas::symv[TPL_ROCBLAS," #SCALAR_TYPE "]");                  \
+      KOKKOSBLAS2_SYMV_DETERMINE_ARGS(LAYOUT);                                \
+      const bool herm = hermitian && Kokkos::ArithTraits<SCALAR>::is_complex; \
+      if (herm && is_lr) {                                                    \
+        /* the transpose of a Hermitian A is conj(A) => call kokkos-kernels'  \
+         * implementation */                                                  \
+        native_type::symv(space, uplo, hermitian, alpha, A, x, beta, y);      \
+        Kokkos::Profiling::popRegion();                                       \
+        return;                                                               \
+      }                                                                       \
+      rocblas_fill uplo_ =                                                    \
+          lower_ ? rocblas_fill_lower : rocblas_fill_upper;                   \
+      KokkosBlas::Impl::RocBlasSingleton& s =                                 \
+          KokkosBlas::Impl::RocBlasSingleton::singleton();                    \
+      KOKKOS_ROCBLAS_SAFE_CALL_IMPL(                                          \
+          rocblas_set_stream(s.handle, space.hip_stream()));                  \
+      if (herm)                                                               \
+        KOKKOS_ROCBLAS_SAFE_CALL_IMPL(HEMV_FN(                                \
+            s.handle, uplo_, N,                                               \
+            reinterpret_cast<const ROCBLAS_SCALAR_TYPE*>(&alpha),             \
+            reinterpret_cast<const ROCBLAS_SCALAR_TYPE*>(A.data()), LDA,      \
+            reinterpret_cast<const ROCBLAS_SCALAR_TYPE*>(x.data()), one,      \
+            reinterpret_cast<const ROCBLAS_SCALAR_TYPE*>(&beta),              \
+            reinterpret_cast<ROCBLAS_SCALAR_TYPE*>(y.data()), one));          \
+      else                                                                    \
+        KOKKOS_ROCBLAS_SAFE_CALL_IMPL(SYMV_FN(                                \
+            s.handle, uplo_, N,                                               \
+            reinterpret_cast<const ROCBLAS_SCALAR_TYPE*>(&alpha),             \
+            reinterpret_cast<const ROCBLAS_SCALAR_TYPE*>(A.data()), LDA,      \
+            reinterpret_cast<const ROCBLAS_SCALAR_TYPE*>(x.data()), one,      \
+            reinterpret_cast<const ROCBLAS_SCALAR_TYPE*>(&beta),              \
+            reinterpret_cast<ROCBLAS_SCALAR_TYPE*>(y.data()), one));          \
+      KOKKOS_ROCBLAS_SAFE_CALL_IMPL(rocblas_set_stream(s.handle, NULL));      \
+      Kokkos::Profiling::popRegion();                                         \
+    }                                                                         \
+  };
+
+#define KOKKOSBLAS2_DSYMV_ROCBLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)     \
+  KOKKOSBLAS2_SYMV_ROCBLAS(double, double, rocblas_dsymv, rocblas_dsymv, \
+                           LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)
+
+#define KOKKOSBLAS2_SSYMV_ROCBLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)           \
+  KOKKOSBLAS2_SYMV_ROCBLAS(float, float, rocblas_ssymv, rocblas_ssymv, LAYOUT, \
+                           MEM_SPACE, ETI_SPEC_AVAIL)
+
+#define KOKKOSBLAS2_ZSYMV_ROCBLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)        \
+  KOKKOSBLAS2_SYMV_ROCBLAS(Kokkos::complex<double>, rocblas_double_complex, \
+                           rocblas_zsymv, rocblas_zhemv, LAYOUT, MEM_SPACE, \
+                           ETI_SPEC_AVAIL)
+
+#define KOKKOSBLAS2_CSYMV_ROCBLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)        \
+  KOKKOSBLAS2_SYMV_ROCBLAS(Kokkos::complex<float>, rocblas_float_complex,   \
+                           rocblas_csymv, rocblas_chemv, LAYOUT, MEM_SPACE, \
+                           ETI_SPEC_AVAIL)
+
+// Explicitly define the SYMV class for all permutations listed below
+
+KOKKOSBLAS2_DSYMV_ROCBLAS(Kokkos::LayoutLeft, Kokkos::HIPSpace, true)
+KOKKOSBLAS2_DSYMV_ROCBLAS(Kokkos::LayoutLeft, Kokkos::HIPSpace, false)
+KOKKOSBLAS2_DSYMV_ROCBLAS(Kokkos::LayoutRight, Kokkos::HIPSpace, true)
+KOKKOSBLAS2_DSYMV_ROCBLAS(Kokkos::LayoutRight, Kokkos::HIPSpace, false)
+
+KOKKOSBLAS2_SSYMV_ROCBLAS(Kokkos::LayoutLeft, Kokkos::HIPSpace, true)
+KOKKOSBLAS2_SSYMV_ROCBLAS(Kokkos::LayoutLeft, Kokkos::HIPSpace, false)
+KOKKOSBLAS2_SSYMV_ROCBLAS(Kokkos::LayoutRight, Kokkos::HIPSpace, true)
+KOKKOSBLAS2_SSYMV_ROCBLAS(Kokkos::LayoutRight, Kokkos::HIPSpace, false)
+
+KOKKOSBLAS2_ZSYMV_ROCBLAS(Kokkos::LayoutLeft, Kokkos::HIPSpace, true)
+KOKKOSBLAS2_ZSYMV_ROCBLAS(Kokkos::LayoutLeft, Kokkos::HIPSpace, false)
+KOKKOSBLAS2_ZSYMV_ROCBLAS(Kokkos::LayoutRight, Kokkos::HIPSpace, true)
+KOKKOSBLAS2_ZSYMV_ROCBLAS(Kokkos::LayoutRight, Kokkos::HIPSpace, false)
+
+KOKKOSBLAS2_CSYMV_ROCBLAS(Kokkos::LayoutLeft, Kokkos::HIPSpace, true)
+KOKKOSBLAS2_CSYMV_ROCBLAS(Kokkos::LayoutLeft, Kokkos::HIPSpace, false)
+KOKKOSBLAS2_CSYMV_ROCBLAS(Kokkos::LayoutRight, Kokkos::HIPSpace, true)
+KOKKOSBLAS2_CSYMV_ROCBLAS(Kokkos::LayoutRight, Kokkos::HIPSpace, false)
+
+}  // namespace Impl
+}  // namespace KokkosBlas
+#endif  // KOKKOSKERNELS_ENABLE_TPL_ROCBLAS
+
+#endif  // KOKKOSBLAS2_SYMV_TPL_SPEC_DECL_HPP_
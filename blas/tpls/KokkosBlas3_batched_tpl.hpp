@@ -0,0 +1,299 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef KOKKOSBLAS3_BATCHED_TPL_HPP_
+#define KOKKOSBLAS3_BATCHED_TPL_HPP_
+
+#include "KokkosKernels_config.h"
+#include "Kokkos_Core.hpp"
+#include <cstdint>
+#include <type_traits>
+
+namespace KokkosBlas {
+namespace Impl {
+
+/// \brief The strided-batched GEMM and batched TRSM of a TPL, for execution
+/// space ExecSpace and scalar type Scalar, if available. The matrices are
+/// column-major, matrix b of A starting at A + b*strideA:
+///
+///   static void gemm(space, transA, transB, m, n, k, alpha, A, lda, strideA,
+///                    B, ldb, strideB, beta, C, ldc, strideC, batchCount);
+///   static void trsm(space, side, uplo, trans, diag, m, n, alpha, A, lda,
+///                    strideA, B, ldb, strideB, batchCount);
+///
+/// with side, uplo, diag and the trans modes as for KokkosBlas::gemm and
+/// KokkosBlas::trsm, already in upper case.
+template <class ExecSpace, class Scalar, class Enable = void>
+struct Blas3BatchedTpl {
+  static constexpr bool available = false;
+};
+
+}  // namespace Impl
+}  // namespace KokkosBlas
+
+// cuBLAS
+#if defined(KOKKOSKERNELS_ENABLE_TPL_CUBLAS)
+#include <KokkosBlas_tpl_spec.hpp>
+
+namespace KokkosBlas {
+namespace Impl {
+
+// cuBLAS has no strided-batched TRSM: the arrays of pointers to the matrices
+// of cublas<t>trsmBatched are built on the device
+#define KOKKOSBLAS3_BATCHED_CUBLAS(SCALAR, CUDA_SCALAR, GEMM_FN, TRSM_FN)      \
+  template <>                                                                  \
+  struct Blas3BatchedTpl<Kokkos::Cuda, SCALAR> {                               \
+    static constexpr bool available = true;                                    \
+                                                                               \
+    static void gemm(const Kokkos::Cuda& space, const char transA[],           \
+                     const char transB[], int m, int n, int k,                 \
+                     const SCALAR& alpha, const SCALAR* A, int lda,            \
+                     int64_t strideA, const SCALAR* B, int ldb,                \
+                     int64_t strideB, const SCALAR& beta, SCALAR* C, int ldc,  \
+                     int64_t strideC, int batchCount) {                        \
+      Kokkos::Profiling::pushRegion(                                           \
+          "KokkosBlas::gemm_strided_batched[TPL_CUBLAS," #SCALAR "]");         \
+      KokkosBlas::Impl::CudaBlasSingleton& s =                                 \
+          KokkosBlas::Impl::CudaBlasSingleton::singleton();                    \
+      KOKKOS_CUBLAS_SAFE_CALL_IMPL(                                            \
+          cublasSetStream(s.handle, space.cuda_stream()));                     \
+      KOKKOS_CUBLAS_SAFE_CALL_IMPL(GEMM_FN(                                    \
+          s.handle, trans_mode_kk_to_cublas(transA),                           \
+          trans_mode_kk_to_cublas(transB), m, n, k,                            \
+          reinterpret_cast<const CUDA_SCALAR*>(&alpha),                        \
+          reinterpret_cast<const CUDA_SCALAR*>(A), lda, strideA,               \
+          reinterpret_cast<const CUDA_SCALAR*>(B), ldb, strideB,               \
+          reinterpret_cast<const CUDA_SCALAR*>(&beta),                         \
+          reinterpret_cast<CUDA_SCALAR*>(C), ldc, strideC, batchCount));       \
+      KOKKOS_CUBLAS_SAFE_CALL_IMPL(cublasSetStream(s.handle, NULL));           \
+      Kokkos::Profiling::popRegion();                                          \
+    }                                                                          \
+                                                                               \
+    static void trsm(const Kokkos::Cuda& space, char side, char uplo,          \
+                     const char trans[], char diag, int m, int n,              \
+                     const SCALAR& alpha, const SCALAR* A, int lda,            \
+                     int64_t strideA, SCALAR* B, int ldb, int64_t strideB,     \
+                     int batchCount) {                                         \
+      Kokkos::Profiling::pushRegion(                                           \
+          "KokkosBlas::trsm_batched[TPL_CUBLAS," #SCALAR "]");                 \
+      using a_ptr_t = const CUDA_SCALAR*;                                      \
+      using b_ptr_t = CUDA_SCALAR*;                                            \
+      Kokkos::View<a_ptr_t*, Kokkos::CudaSpace> Aptrs(                         \
+          Kokkos::view_alloc(space, Kokkos::WithoutInitializing,               \
+                             "trsm_batched A pointers"),                       \
+          batchCount);                                                         \
+      Kokkos::View<b_ptr_t*, Kokkos::CudaSpace> Bptrs(                         \
+          Kokkos::view_alloc(space, Kokkos::WithoutInitializing,               \
+                             "trsm_batched B pointers"),                       \
+          batchCount);                                                         \
+      a_ptr_t A0 = reinterpret_cast<a_ptr_t>(A);                               \
+      b_ptr_t B0 = reinterpret_cast<b_ptr_t>(B);                               \
+      Kokkos::parallel_for(                                                    \
+          "KokkosBlas::trsm_batched[TPL_CUBLAS] pointers",                     \
+          Kokkos::RangePolicy<Kokkos::Cuda>(space, 0, batchCount),             \
+          KOKKOS_LAMBDA(const int b) {                                         \
+            Aptrs(b) = A0 + b * strideA;                                       \
+            Bptrs(b) = B0 + b * strideB;                                       \
+          });                                                                  \
+      KokkosBlas::Impl::CudaBlasSingleton& s =                                 \
+          KokkosBlas::Impl::CudaBlasSingleton::singleton();                    \
+      KOKKOS_CUBLAS_SAFE_CALL_IMPL(                                            \
+          cublasSetStream(s.handle, space.cuda_stream()));                     \
+      KOKKOS_CUBLAS_SAFE_CALL_IMPL(TRSM_FN(                                    \
+          s.handle, side == 'L' ? CUBLAS_SIDE_LEFT : CUBLAS_SIDE_RIGHT,        \
+          uplo == 'L' ? CUBLAS_FILL_MODE_LOWER : CUBLAS_FILL_MODE_UPPER,       \
+          trans_mode_kk_to_cublas(trans),                                      \
+          diag == 'U' ? CUBLAS_DIAG_UNIT : CUBLAS_DIAG_NON_UNIT, m, n,         \
+          reinterpret_cast<const CUDA_SCALAR*>(&alpha), Aptrs.data(), lda,     \
+          Bptrs.data(), ldb, batchCount));                                     \
+      KOKKOS_CUBLAS_SAFE_CALL_IMPL(cublasSetStream(s.handle, NULL));           \
+      Kokkos::Profiling::popRegion();                                          \
+    }                                                                          \
+  };
+
+KOKKOSBLAS3_BATCHED_CUBLAS(float, float, cublasSgemmStridedBatched,
+                           cublasStrsmBatched)
+KOKKOSBLAS3_BATCHED_CUBLAS(double, double, cublasDgemmStridedBatched,
+                           cublasDtrsmBatched)
+KOKKOSBLAS3_BATCHED_CUBLAS(Kokkos::complex<float>, cuComplex,
+                           cublasCgemmStridedBatched, cublasCtrsmBatched)
+KOKKOSBLAS3_BATCHED_CUBLAS(Kokkos::complex<double>, cuDoubleComplex,
+                           cublasZgemmStridedBatched, cublasZtrsmBatched)
+
+#undef KOKKOSBLAS3_BATCHED_CUBLAS
+
+}  // namespace Impl
+}  // namespace KokkosBlas
+#endif  // KOKKOSKERNELS_ENABLE_TPL_CUBLAS
+
+// rocBLAS
+#if defined(KOKKOSKERNELS_ENABLE_TPL_ROCBLAS)
+#include <KokkosBlas_tpl_spec.hpp>
+
+namespace KokkosBlas {
+namespace Impl {
+
+#define KOKKOSBLAS3_BATCHED_ROCBLAS(SCALAR, ROCBLAS_SCALAR, GEMM_FN, TRSM_FN) \
+  template <>                                                                 \
+  struct Blas3BatchedTpl<Kokkos::HIP, SCALAR> {                               \
+    static constexpr bool available = true;                                   \
+                                                                              \
+    static void gemm(const Kokkos::HIP& space, const char transA[],           \
+                     const char transB[], int m, int n, int k,                \
+                     const SCALAR& alpha, const SCALAR* A, int lda,           \
+                     int64_t strideA, const SCALAR* B, int ldb,               \
+                     int64_t strideB, const SCALAR& beta, SCALAR* C, int ldc, \
+                     int64_t strideC, int batchCount) {                       \
+      Kokkos::Profiling::pushRegion(                                          \
+          "KokkosBlas::gemm_strided_batched[TPL_ROCBLAS," #SCALAR "]");       \
+      KokkosBlas::Impl::RocBlasSingleton& s =                                 \
+          KokkosBlas::Impl::RocBlasSingleton::singleton();                    \
+      KOKKOS_ROCBLAS_SAFE_CALL_IMPL(                                          \
+          rocblas_set_stream(s.handle, space.hip_stream()));                  \
+      KOKKOS_ROCBLAS_SAFE_CALL_IMPL(GEMM_FN(                                  \
+          s.handle, trans_mode_kk_to_rocblas(transA),                         \
+          trans_mode_kk_to_rocblas(transB), m, n, k,                          \
+          reinterpret_cast<const ROCBLAS_SCALAR*>(&alpha),                    \
+          reinterpret_cast<const ROCBLAS_SCALAR*>(A), lda, strideA,           \
+          reinterpret_cast<const ROCBLAS_SCALAR*>(B), ldb, strideB,           \
+          reinterpret_cast<const ROCBLAS_SCALAR*>(&beta),                     \
+          reinterpret_cast<ROCBLAS_SCALAR*>(C), ldc, strideC, batchCount));   \
+      KOKKOS_ROCBLAS_SAFE_CALL_IMPL(rocblas_set_stream(s.handle, NULL));      \
+      Kokkos::Profiling::popRegion();                                         \
+    }                                                                         \
+                                                                              \
+    static void trsm(const Kokkos::HIP& space, char side, char uplo,          \
+                     const char trans[], char diag, int m, int n,             \
+                     const SCALAR& alpha, const SCALAR* A, int lda,           \
+                     int64_t strideA, SCALAR* B, int ldb, int64_t strideB,    \
+                     int batchCount) {                                        \
+      Kokkos::Profiling::pushRegion(                                          \
+          "KokkosBlas::trsm_batched[TPL_ROCBLAS," #SCALAR "]");               \
+      KokkosBlas::Impl::RocBlasSingleton& s =                                 \
+          KokkosBlas::Impl::RocBlasSingleton::singleton();                    \
+      KOKKOS_ROCBLAS_SAFE_CALL_IMPL(                                          \
+          rocblas_set_stream(s.handle, space.hip_stream()));                  \
+      KOKKOS_ROCBLAS_SAFE_CALL_IMPL(TRSM_FN(                                  \
+          s.handle, side == 'L' ? rocblas_side_left : rocblas_side_right,     \
+          uplo == 'L' ? rocblas_fill_lower : rocblas_fill_upper,              \
+          trans_mode_kk_to_rocblas(trans),                                    \
+          diag == 'U' ? rocblas_diagonal_unit : rocblas_diagonal_non_unit, m, \
+          n, reinterpret_cast<const ROCBLAS_SCALAR*>(&alpha),                 \
+          reinterpret_cast<const ROCBLAS_SCALAR*>(A), lda, strideA,           \
+          reinterpret_cast<ROCBLAS_SCALAR*>(B), ldb, strideB, batchCount));   \
+      KOKKOS_ROCBLAS_SAFE_CALL_IMPL(rocblas_set_stream(s.handle, NULL));      \
+      Kokkos::Profiling::popRegion();                                         \
+    }                                                                         \
+  };
+
+KOKKOSBLAS3_BATCHED_ROCBLAS(float, float, rocblas_sgemm_strided_batched,
+                            rocblas_strsm_strided_batched)
+KOKKOSBLAS3_BATCHED_ROCBLAS(double, double, rocblas_dgemm_strided_batched,
+                            rocblas_dtrsm_strided_batched)
+KOKKOSBLAS3_BATCHED_ROCBLAS(Kokkos::complex<float>, rocblas_float_complex,
+                            rocblas_cgemm_strided_batched,
+                            rocblas_ctrsm_strided_batched)
+KOKKOSBLAS3_BATCHED_ROCBLAS(Kokkos::complex<double>, rocblas_double_complex,
+                            rocblas_zgemm_strided_batched,
+                            rocblas_ztrsm_strided_batched)
+
+#undef KOKKOSBLAS3_BATCHED_ROCBLAS
+
+}  // namespace Impl
+}  // namespace KokkosBlas
+#endif  // KOKKOSKERNELS_ENABLE_TPL_ROCBLAS
+
+// MKL: cblas_<t>gemm_batch_strided and cblas_<t>trsm_batch_strided, for host
+// execution spaces
+#if defined(KOKKOSKERNELS_ENABLE_TPL_MKL)
+#include <mkl.h>
+
+#if defined(INTEL_MKL_VERSION) && (INTEL_MKL_VERSION >= 20210000)
+namespace KokkosBlas {
+namespace Impl {
+
+// MKL takes real scalars by value and complex scalars by pointer
+inline float mkl_batched_scalar(const float& x) { return x; }
+inline double mkl_batched_scalar(const double& x) { return x; }
+inline const void* mkl_batched_scalar(const Kokkos::complex<float>& x) {
+  return &x;
+}
+inline const void* mkl_batched_scalar(const Kokkos::complex<double>& x) {
+  return &x;
+}
+
+inline CBLAS_TRANSPOSE mkl_batched_trans(const char trans[]) {
+  return trans[0] == 'N' ? CblasNoTrans
+                         : (trans[0] == 'T' ? CblasTrans : CblasConjTrans);
+}
+
+#define KOKKOSBLAS3_BATCHED_MKL(SCALAR, GEMM_FN, TRSM_FN)                      \
+  template <class ExecSpace>                                                   \
+  struct Blas3BatchedTpl<                                                      \
+      ExecSpace, SCALAR,                                                       \
+      std::enable_if_t<Kokkos::SpaceAccessibility<                             \
+          ExecSpace, Kokkos::HostSpace>::accessible>> {                        \
+    static constexpr bool available = true;                                    \
+                                                                               \
+    static void gemm(const ExecSpace& space, const char transA[],              \
+                     const char transB[], int m, int n, int k,                 \
+                     const SCALAR& alpha, const SCALAR* A, int lda,            \
+                     int64_t strideA, const SCALAR* B, int ldb,                \
+                     int64_t strideB, const SCALAR& beta, SCALAR* C, int ldc,  \
+                     int64_t strideC, int batchCount) {                        \
+      Kokkos::Profiling::pushRegion(                                           \
+          "KokkosBlas::gemm_strided_batched[TPL_MKL," #SCALAR "]");            \
+      space.fence();                                                           \
+      GEMM_FN(CblasColMajor, mkl_batched_trans(transA),                        \
+              mkl_batched_trans(transB), m, n, k, mkl_batched_scalar(alpha),   \
+              A, lda, strideA, B, ldb, strideB, mkl_batched_scalar(beta), C,   \
+              ldc, strideC, batchCount);                                       \
+      Kokkos::Profiling::popRegion();                                          \
+    }                                                                          \
+                                                                               \
+    static void trsm(const ExecSpace& space, char side, char uplo,             \
+                     const char trans[], char diag, int m, int n,              \
+                     const SCALAR& alpha, const SCALAR* A, int lda,            \
+                     int64_t strideA, SCALAR* B, int ldb, int64_t strideB,     \
+                     int batchCount) {                                         \
+      Kokkos::Profiling::pushRegion(                                           \
+          "KokkosBlas::trsm_batched[TPL_MKL," #SCALAR "]");                    \
+      space.fence();                                                           \
+      TRSM_FN(CblasColMajor, side == 'L' ? CblasLeft : CblasRight,             \
+              uplo == 'L' ? CblasLower : CblasUpper, mkl_batched_trans(trans), \
+              diag == 'U' ? CblasUnit : CblasNonUnit, m, n,                    \
+              mkl_batched_scalar(alpha), A, lda, strideA, B, ldb, strideB,     \
+              batchCount);                                                     \
+      Kokkos::Profiling::popRegion();                                          \
+    }                                                                          \
+  };
+
+KOKKOSBLAS3_BATCHED_MKL(float, cblas_sgemm_batch_strided,
+                        cblas_strsm_batch_strided)
+KOKKOSBLAS3_BATCHED_MKL(double, cblas_dgemm_batch_strided,
+                        cblas_dtrsm_batch_strided)
+KOKKOSBLAS3_BATCHED_MKL(Kokkos::complex<float>, cblas_cgemm_batch_strided,
+                        cblas_ctrsm_batch_strided)
+KOKKOSBLAS3_BATCHED_MKL(Kokkos::complex<double>, cblas_zgemm_batch_strided,
+                        cblas_ztrsm_batch_strided)
+
+#undef KOKKOSBLAS3_BATCHED_MKL
+
+}  // namespace Impl
+}  // namespace KokkosBlas
+#endif  // INTEL_MKL_VERSION >= 20210000
+#endif  // KOKKOSKERNELS_ENABLE_TPL_MKL
+
+#endif  // KOKKOSBLAS3_BATCHED_TPL_HPP_
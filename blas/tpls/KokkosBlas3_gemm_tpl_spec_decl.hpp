@@ -230,13 +230,12 @@ namespace Impl {
                          : (transa == CUBLAS_OP_C ? true : false);         \
         gemm.run(space, conjT);                                            \
       } else {                                                             \
-        KokkosBlas::Impl::CudaBlasSingleton& s =                           \
-            KokkosBlas::Impl::CudaBlasSingleton::singleton();              \
-        KOKKOS_CUBLAS_SAFE_CALL_IMPL(                                      \
-            cublasSetStream(s.handle, space.cuda_stream()));               \
+        cublasHandle_t handle =                                            \
+            KokkosBlas::Impl::CudaBlasSingleton::stream_handle(            \
+                space.cuda_stream());                                      \
         if (!A_is_lr && !B_is_lr && !C_is_lr)                              \
           KOKKOS_CUBLAS_SAFE_CALL_IMPL(CUBLAS_FN(                          \
-              s.handle, transa, transb, M, N, K,                           \
+              handle, transa, transb, M, N, K,                             \
               reinterpret_cast<const CUDA_SCALAR_TYPE*>(&alpha),           \
               reinterpret_cast<const CUDA_SCALAR_TYPE*>(A.data()), LDA,    \
               reinterpret_cast<const CUDA_SCALAR_TYPE*>(B.data()), LDB,    \
@@ -244,13 +243,12 @@ namespace Impl {
               reinterpret_cast<CUDA_SCALAR_TYPE*>(C.data()), LDC));        \
         if (A_is_lr && B_is_lr && C_is_lr)                                 \
           KOKKOS_CUBLAS_SAFE_CALL_IMPL(CUBLAS_FN(                          \
-              s.handle, transb, transa, N, M, K,                           \
+              handle, transb, transa, N, M, K,                             \
               reinterpret_cast<const CUDA_SCALAR_TYPE*>(&alpha),           \
               reinterpret_cast<const CUDA_SCALAR_TYPE*>(B.data()), LDB,    \
               reinterpret_cast<const CUDA_SCALAR_TYPE*>(A.data()), LDA,    \
               reinterpret_cast<const CUDA_SCALAR_TYPE*>(&beta),            \
               reinterpret_cast<CUDA_SCALAR_TYPE*>(C.data()), LDC));        \
-        KOKKOS_CUBLAS_SAFE_CALL_IMPL(cublasSetStream(s.handle, NULL));     \
       }                                                                    \
       Kokkos::Profiling::popRegion();                                      \
     }                                                                      \
@@ -435,13 +433,12 @@ namespace Impl {
                                                                    : false); \
         gemm.run(space, conjT);                                              \
       } else {                                                               \
-        KokkosBlas::Impl::RocBlasSingleton& s =                              \
-            KokkosBlas::Impl::RocBlasSingleton::singleton();                 \
-        KOKKOS_ROCBLAS_SAFE_CALL_IMPL(                                       \
-            rocblas_set_stream(s.handle, space.hip_stream()));               \
+        rocblas_handle handle =                                              \
+            KokkosBlas::Impl::RocBlasSingleton::stream_handle(               \
+                space.hip_stream());                                         \
         if (!is_lr)                                                          \
           KOKKOS_ROCBLAS_SAFE_CALL_IMPL(ROCBLAS_FN(                          \
-              s.handle, transa, transb, M, N, K,                             \
+              handle, transa, transb, M, N, K,                               \
               reinterpret_cast<const ROCBLAS_SCALAR_TYPE*>(&alpha),          \
               reinterpret_cast<const ROCBLAS_SCALAR_TYPE*>(A.data()), LDA,   \
               reinterpret_cast<const ROCBLAS_SCALAR_TYPE*>(B.data()), LDB,   \
@@ -449,13 +446,12 @@ namespace Impl {
               reinterpret_cast<ROCBLAS_SCALAR_TYPE*>(C.data()), LDC));       \
         else                                                                 \
           KOKKOS_ROCBLAS_SAFE_CALL_IMPL(ROCBLAS_FN(                          \
-              s.handle, transb, transa, N, M, K,                             \
+              handle, transb, transa, N, M, K,                               \
               reinterpret_cast<const ROCBLAS_SCALAR_TYPE*>(&alpha),          \
               reinterpret_cast<const ROCBLAS_SCALAR_TYPE*>(B.data()), LDB,   \
               reinterpret_cast<const ROCBLAS_SCALAR_TYPE*>(A.data()), LDA,   \
               reinterpret_cast<const ROCBLAS_SCALAR_TYPE*>(&beta),           \
               reinterpret_cast<ROCBLAS_SCALAR_TYPE*>(C.data()), LDC));       \
-        KOKKOS_ROCBLAS_SAFE_CALL_IMPL(rocblas_set_stream(s.handle, NULL));   \
       }                                                                      \
       Kokkos::Profiling::popRegion();                                        \
     }                                                                        \
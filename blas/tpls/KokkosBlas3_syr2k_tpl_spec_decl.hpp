@@ -0,0 +1,399 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef KOKKOSBLAS3_SYR2K_TPL_SPEC_DECL_HPP_
+#define KOKKOSBLAS3_SYR2K_TPL_SPEC_DECL_HPP_
+
+// Generic Host side BLAS (could be MKL or anything)
+#if defined(KOKKOSKERNELS_ENABLE_TPL_BLAS)
+#include "KokkosBlas_Host_tpl.hpp"
+
+namespace KokkosBlas {
+namespace Impl {
+
+#define KOKKOSBLAS3_SYR2K_BLAS(SCALAR_TYPE, BASE_SCALAR_TYPE, LAYOUT,          \
+                               MEM_SPACE, ETI_SPEC_AVAIL)                      \
+  template <class ExecSpace>                                                   \
+  struct SYR2K<ExecSpace,                                                      \
+               Kokkos::View<const SCALAR_TYPE**, LAYOUT,                       \
+                            Kokkos::Device<ExecSpace, MEM_SPACE>,              \
+                            Kokkos::MemoryTraits<Kokkos::Unmanaged> >,         \
+               Kokkos::View<const SCALAR_TYPE**, LAYOUT,                       \
+                            Kokkos::Device<ExecSpace, MEM_SPACE>,              \
+                            Kokkos::MemoryTraits<Kokkos::Unmanaged> >,         \
+               Kokkos::View<SCALAR_TYPE**, LAYOUT,                             \
+                            Kokkos::Device<ExecSpace, MEM_SPACE>,              \
+                            Kokkos::MemoryTraits<Kokkos::Unmanaged> >,         \
+               true, ETI_SPEC_AVAIL> {                                         \
+    typedef SCALAR_TYPE SCALAR;                                                \
+    typedef Kokkos::View<const SCALAR**, LAYOUT,                               \
+                         Kokkos::Device<ExecSpace, MEM_SPACE>,                 \
+                         Kokkos::MemoryTraits<Kokkos::Unmanaged> >             \
+        AViewType;                                                             \
+    typedef Kokkos::View<const SCALAR**, LAYOUT,                               \
+                         Kokkos::Device<ExecSpace, MEM_SPACE>,                 \
+                         Kokkos::MemoryTraits<Kokkos::Unmanaged> >             \
+        BViewType;                                                             \
+    typedef Kokkos::View<SCALAR**, LAYOUT,                                     \
+                         Kokkos::Device<ExecSpace, MEM_SPACE>,                 \
+                         Kokkos::MemoryTraits<Kokkos::Unmanaged> >             \
+        CViewType;                                                             \
+                                                                               \
+    static void syr2k(const ExecSpace& /*space*/, const char uplo[],           \
+                      const char trans[],                                      \
+                      typename CViewType::const_value_type& alpha,             \
+                      const AViewType& A, const BViewType& B,                  \
+                      typename CViewType::const_value_type& beta,              \
+                      const CViewType& C) {                                    \
+      Kokkos::Profiling::pushRegion("KokkosBlas::syr2k[TPL_BLAS," #SCALAR_TYPE \
+                                    "]");                                      \
+      const bool A_t   = (trans[0] != 'N') && (trans[0] != 'n');               \
+      const bool lower = (uplo[0] == 'L') || (uplo[0] == 'l');                 \
+      const int N      = static_cast<int>(C.extent(0));                        \
+      const int K      = static_cast<int>(A.extent(A_t ? 0 : 1));              \
+                                                                               \
+      bool is_lr = std::is_same<Kokkos::LayoutRight, LAYOUT>::value;           \
+                                                                               \
+      const int AST = is_lr ? A.stride(0) : A.stride(1),                       \
+                LDA = AST == 0 ? 1 : AST;                                      \
+      const int BST = is_lr ? B.stride(0) : B.stride(1),                       \
+                LDB = BST == 0 ? 1 : BST;                                      \
+      const int CST = is_lr ? C.stride(0) : C.stride(1),                       \
+                LDC = CST == 0 ? 1 : CST;                                      \
+                                                                               \
+      /* row-major: flip the triangle and op(A), C being symmetric */          \
+      const char uplo_  = lower != is_lr ? 'L' : 'U';                          \
+      const char trans_ = A_t != is_lr ? 'T' : 'N';                            \
+                                                                               \
+      HostBlas<BASE_SCALAR_TYPE>::syr2k(                                       \
+          uplo_, trans_, N, K, alpha,                                          \
+          reinterpret_cast<const BASE_SCALAR_TYPE*>(A.data()), LDA,            \
+          reinterpret_cast<const BASE_SCALAR_TYPE*>(B.data()), LDB, beta,      \
+          reinterpret_cast<BASE_SCALAR_TYPE*>(C.data()), LDC);                 \
+      Kokkos::Profiling::popRegion();                                          \
+    }                                                                          \
+  };
+
+#define KOKKOSBLAS3_DSYR2K_BLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL) \
+  KOKKOSBLAS3_SYR2K_BLAS(double, double, LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)
+
+#define KOKKOSBLAS3_SSYR2K_BLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL) \
+  KOKKOSBLAS3_SYR2K_BLAS(float, float, LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)
+
+#define KOKKOSBLAS3_ZSYR2K_BLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)      \
+  KOKKOSBLAS3_SYR2K_BLAS(Kokkos::complex<double>, std::complex<double>, \
+                         LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)
+
+#define KOKKOSBLAS3_CSYR2K_BLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)            \
+  KOKKOSBLAS3_SYR2K_BLAS(Kokkos::complex<float>, std::complex<float>, LAYOUT, \
+                         MEM_SPACE, ETI_SPEC_AVAIL)
+
+// Explicitly define the SYR2K class for all permutations listed below
+
+KOKKOSBLAS3_DSYR2K_BLAS(Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS3_DSYR2K_BLAS(Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS3_DSYR2K_BLAS(Kokkos::LayoutRight, Kokkos::HostSpace, true)
+KOKKOSBLAS3_DSYR2K_BLAS(Kokkos::LayoutRight, Kokkos::HostSpace, false)
+
+KOKKOSBLAS3_SSYR2K_BLAS(Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS3_SSYR2K_BLAS(Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS3_SSYR2K_BLAS(Kokkos::LayoutRight, Kokkos::HostSpace, true)
+KOKKOSBLAS3_SSYR2K_BLAS(Kokkos::LayoutRight, Kokkos::HostSpace, false)
+
+KOKKOSBLAS3_ZSYR2K_BLAS(Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS3_ZSYR2K_BLAS(Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS3_ZSYR2K_BLAS(Kokkos::LayoutRight, Kokkos::HostSpace, true)
+KOKKOSBLAS3_ZSYR2K_BLAS(Kokkos::LayoutRight, Kokkos::HostSpace, false)
+
+KOKKOSBLAS3_CSYR2K_BLAS(Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS3_CSYR2K_BLAS(Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS3_CSYR2K_BLAS(Kokkos::LayoutRight, Kokkos::HostSpace, true)
+KOKKOSBLAS3_CSYR2K_BLAS(Kokkos::LayoutRight, Kokkos::HostSpace, false)
+
+}  // namespace Impl
+}  // namespace KokkosBlas
+#endif  // KOKKOSKERNELS_ENABLE_TPL_BLAS
+
+// cuBLAS
+#if defined(KOKKOSKERNELS_ENABLE_TPL_CUBLAS)
+#include <KokkosBlas_tpl_spec.hpp>
+
+namespace KokkosBlas {
+namespace Impl {
+
+#define KOKKOSBLAS3_SYR2K_CUBLAS(SCALAR_TYPE, CUDA_SCALAR_TYPE, SYR2K_FN, \
+                                 LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)       \
+  template <class ExecSpace>                                              \
+  struct SYR2K<ExecSpace,                                                 \
+               Kokkos::View<const SCALAR_TYPE**, LAYOUT,                  \
+                            Kokkos::Device<ExecSpace, MEM_SPACE>,         \
+                            Kokkos::MemoryTraits<Kokkos::Unmanaged> >,    \
+               Kokkos::View<const SCALAR_TYPE**, LAYOUT,                  \
+                            Kokkos::Device<ExecSpace, MEM_SPACE>,         \
+                            Kokkos::MemoryTraits<Kokkos::Unmanaged> >,    \
+               Kokkos::View<SCALAR_TYPE**, LAYOUT,                        \
+                            Kokkos::Device<ExecSpace, MEM_SPACE>,         \
+                            Kokkos::MemoryTraits<Kokkos::Unmanaged> >,    \
+               true, ETI_SPEC_AVAIL> {                                    \
+    typedef SCALAR_TYPE SCALAR;                                           \
+    typedef Kokkos::View<const SCALAR**, LAYOUT,                          \
+                         Kokkos::Device<ExecSpace, MEM_SPACE>,            \
+                         Kokkos::MemoryTraits<Kokkos::Unmanaged> >        \
+        AViewType;                                                        \
+    typedef Kokkos::View<const SCALAR**, LAYOUT,                          \
+                         Kokkos::Device<ExecSpace, MEM_SPACE>,            \
+                         Kokkos::MemoryTraits<Kokkos::Unmanaged> >        \
+        BViewType;                                                        \
+    typedef Kokkos::View<SCALAR**, LAYOUT,                                \
+                         Kokkos::Device<ExecSpace, MEM_SPACE>,            \
+                         Kokkos::MemoryTraits<Kokkos::Unmanaged> >        \
+        CViewType;                                                        \
+                                                                          \
+    static void syr2k(const ExecSpace& space, const char uplo[],          \
+                      const char trans[],                                 \
+                      typename CViewType::const_value_type& alpha,        \
+                      const AViewType& A, const BViewType& B,             \
+                      typename CViewType::const_value_type& beta,         \
+                      const CViewType& C) {                               \
+      Kokkos::Profiling::pushRegion(                                      \
+          "KokkosBlas::syr2k[TPL_CUBLAS," #SCALAR_TYPE "]");              \
+      const bool A_t   = (trans[0] != 'N') && (trans[0] != 'n');          \
+      const bool lower = (uplo[0] == 'L') || (uplo[0] == 'l');            \
+      const int N      = static_cast<int>(C.extent(0));                   \
+      const int K      = static_cast<int>(A.extent(A_t ? 0 : 1));         \
+                                                                          \
+      bool is_lr = std::is_same<Kokkos::LayoutRight, LAYOUT>::value;      \
+                                                                          \
+      const int AST = is_lr ? A.stride(0) : A.stride(1),                  \
+                LDA = AST == 0 ? 1 : AST;                                 \
+      const int BST = is_lr ? B.stride(0) : B.stride(1),                  \
+                LDB = BST == 0 ? 1 : BST;                                 \
+      const int CST = is_lr ? C.stride(0) : C.stride(1),                  \
+                LDC = CST == 0 ? 1 : CST;                                 \
+                                                                          \
+      /* row-major: flip the triangle and op(A), C being symmetric */     \
+      cublasFillMode_t uplo_;                                             \
+      cublasOperation_t trans_;                                           \
+      if (lower != is_lr)                                                 \
+        uplo_ = CUBLAS_FILL_MODE_LOWER;                                   \
+      else                                                                \
+        uplo_ = CUBLAS_FILL_MODE_UPPER;                                   \
+      if (A_t != is_lr)                                                   \
+        trans_ = CUBLAS_OP_T;                                             \
+      else                                                                \
+        trans_ = CUBLAS_OP_N;                                             \
+                                                                          \
+      KokkosBlas::Impl::CudaBlasSingleton& s =                            \
+          KokkosBlas::Impl::CudaBlasSingleton::singleton();               \
+      KOKKOS_CUBLAS_SAFE_CALL_IMPL(                                       \
+          cublasSetStream(s.handle, space.cuda_stream()));                \
+      KOKKOS_CUBLAS_SAFE_CALL_IMPL(SYR2K_FN(                              \
+          s.handle, uplo_, trans_, N, K,                                  \
+          reinterpret_cast<const CUDA_SCALAR_TYPE*>(&alpha),              \
+          reinterpret_cast<const CUDA_SCALAR_TYPE*>(A.data()), LDA,       \
+          reinterpret_cast<const CUDA_SCALAR_TYPE*>(B.data()), LDB,       \
+          reinterpret_cast<const CUDA_SCALAR_TYPE*>(&beta),               \
+          reinterpret_cast<CUDA_SCALAR_TYPE*>(C.data()), LDC));           \
+      KOKKOS_CUBLAS_SAFE_CALL_IMPL(cublasSetStream(s.handle, NULL));      \
+      Kokkos::Profiling::popRegion();                                     \
+    }                                                                     \
+  };
+
+#define KOKKOSBLAS3_DSYR2K_CUBLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)        \
+  KOKKOSBLAS3_SYR2K_CUBLAS(double, double, cublasDsyr2k, LAYOUT, MEM_SPACE, \
+                           ETI_SPEC_AVAIL)
+
+#define KOKKOSBLAS3_SSYR2K_CUBLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)      \
+  KOKKOSBLAS3_SYR2K_CUBLAS(float, float, cublasSsyr2k, LAYOUT, MEM_SPACE, \
+                           ETI_SPEC_AVAIL)
+
+#define KOKKOSBLAS3_ZSYR2K_CUBLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL) \
+  KOKKOSBLAS3_SYR2K_CUBLAS(Kokkos::complex<double>, cuDoubleComplex, \
+                           cublasZsyr2k, LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)
+
+#define KOKKOSBLAS3_CSYR2K_CUBLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)        \
+  KOKKOSBLAS3_SYR2K_CUBLAS(Kokkos::complex<float>, cuComplex, cublasCsyr2k, \
+                           LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)
+
+// Explicitly define the SYR2K class for all permutations listed below
+
+KOKKOSBLAS3_DSYR2K_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaSpace, true)
+KOKKOSBLAS3_DSYR2K_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaSpace, false)
+KOKKOSBLAS3_DSYR2K_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaUVMSpace, true)
+KOKKOSBLAS3_DSYR2K_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaUVMSpace, false)
+KOKKOSBLAS3_DSYR2K_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaSpace, true)
+KOKKOSBLAS3_DSYR2K_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaSpace, false)
+KOKKOSBLAS3_DSYR2K_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaUVMSpace, true)
+KOKKOSBLAS3_DSYR2K_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaUVMSpace, false)
+
+KOKKOSBLAS3_SSYR2K_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaSpace, true)
+KOKKOSBLAS3_SSYR2K_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaSpace, false)
+KOKKOSBLAS3_SSYR2K_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaUVMSpace, true)
+KOKKOSBLAS3_SSYR2K_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaUVMSpace, false)
+KOKKOSBLAS3_SSYR2K_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaSpace, true)
+KOKKOSBLAS3_SSYR2K_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaSpace, false)
+KOKKOSBLAS3_SSYR2K_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaUVMSpace, true)
+KOKKOSBLAS3_SSYR2K_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaUVMSpace, false)
+
+KOKKOSBLAS3_ZSYR2K_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaSpace, true)
+KOKKOSBLAS3_ZSYR2K_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaSpace, false)
+KOKKOSBLAS3_ZSYR2K_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaUVMSpace, true)
+KOKKOSBLAS3_ZSYR2K_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaUVMSpace, false)
+KOKKOSBLAS3_ZSYR2K_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaSpace, true)
+KOKKOSBLAS3_ZSYR2K_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaSpace, false)
+KOKKOSBLAS3_ZSYR2K_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaUVMSpace, true)
+KOKKOSBLAS3_ZSYR2K_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaUVMSpace, false)
+
+KOKKOSBLAS3_CSYR2K_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaSpace, true)
+KOKKOSBLAS3_CSYR2K_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaSpace, false)
+KOKKOSBLAS3_CSYR2K_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaUVMSpace, true)
+KOKKOSBLAS3_CSYR2K_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaUVMSpace, false)
+KOKKOSBLAS3_CSYR2K_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaSpace, true)
+KOKKOSBLAS3_CSYR2K_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaSpace, false)
+KOKKOSBLAS3_CSYR2K_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaUVMSpace, true)
+KOKKOSBLAS3_CSYR2K_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaUVMSpace, false)
+
+}  // namespace Impl
+}  // namespace KokkosBlas
+#endif  // KOKKOSKERNELS_ENABLE_TPL_CUBLAS
+
+// rocBLAS
+#if defined(KOKKOSKERNELS_ENABLE_TPL_ROCBLAS)
+#include <KokkosBlas_tpl_spec.hpp>
+
+namespace KokkosBlas {
+namespace Impl {
+
+#define KOKKOSBLAS3_SYR2K_ROCBLAS(SCALAR_TYPE, ROCBLAS_SCALAR_TYPE, SYR2K_FN, \
+                                  LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)          \
+  template <class ExecSpace>                                                  \
+  struct SYR2K<ExecSpace,                                                     \
+               Kokkos::View<const SCALAR_TYPE**, LAYOUT,                      \
+                            Kokkos::Device<ExecSpace, MEM_SPACE>,             \
+                            Kokkos::MemoryTraits<Kokkos::Unmanaged> >,        \
+               Kokkos::View<const SCALAR_TYPE**, LAYOUT,                      \
+                            Kokkos::Device<ExecSpace, MEM_SPACE>,             \
+                            Kokkos::MemoryTraits<Kokkos::Unmanaged> >,        \
+               Kokkos::View<SCALAR_TYPE**, LAYOUT,                            \
+                            Kokkos::Device<ExecSpace, MEM_SPACE>,             \
+                            Kokkos::MemoryTraits<Kokkos::Unmanaged> >,        \
+               true, ETI_SPEC_AVAIL> {                                        \
+    typedef SCALAR_TYPE SCALAR;                                               \
+    typedef Kokkos::View<const SCALAR**, LAYOUT,                              \
+                         Kokkos::Device<ExecSpace, MEM_SPACE>,                \
+                         Kokkos::MemoryTraits<Kokkos::Unmanaged> >            \
+        AViewType;                                                            \
+    typedef Kokkos::View<const SCALAR**, LAYOUT,                              \
+                         Kokkos::Device<ExecSpace, MEM_SPACE>,                \
+                         Kokkos::MemoryTraits<Kokkos::Unmanaged> >            \
+        BViewType;                                                            \
+    typedef Kokkos::View<SCALAR**, LAYOUT,                                    \
+                         Kokkos::Device<ExecSpace, MEM_SPACE>,                \
+                         Kokkos::MemoryTraits<Kokkos::Unmanaged> >            \
+        CViewType;                                                            \
+                                                                              \
+    static void syr2k(const ExecSpace& space, const char uplo[],              \
+                      const char trans[],                                     \
+                      typename CViewType::const_value_type& alpha,            \
+                      const AViewType& A, const BViewType& B,                 \
+                      typename CViewType::const_value_type& beta,             \
+                      const CViewType& C) {                                   \
+      Kokkos::Profiling::pushRegion(                                          \
+          "KokkosBlas::syr2k[TPL_ROCBLAS," #SCALAR_TYPE "]");                 \
+      const bool A_t   = (trans[0] != 'N') && (trans[0] != 'n');              \
+      const bool lower = (uplo[0] == 'L') || (uplo[0] == 'l');                \
+      const int N      = static_cast<int>(C.extent(0));                       \
+      const int K      = static_cast<int>(A.extent(A_t ? 0 : 1));             \
+                                                                              \
+      bool is_lr = std::is_same<Kokkos::LayoutRight, LAYOUT>::value;          \
+                                                                              \
+      const int AST = is_lr ? A.stride(0) : A.stride(1),                      \
+                LDA = AST == 0 ? 1 : AST;                                     \
+      const int BST = is_lr ? B.stride(0) : B.stride(1),                      \
+                LDB = BST == 0 ? 1 : BST;                                     \
+      const int CST = is_lr ? C.stride(0) : C.stride(1),                      \
+                LDC = CST == 0 ? 1 : CST;                                     \
+                                                                              \
+      /* row-major: flip the triangle and op(A), C being symmetric */         \
+      rocblas_fill uplo_;                                                     \
+      rocblas_operation trans_;                                               \
+      if (lower != is_lr)                                                     \
+        uplo_ = rocblas_fill_lower;                                           \
+      else                                                                    \
+        uplo_ = rocblas_fill_upper;                                           \
+      if (A_t != is_lr)                                                       \
+        trans_ = rocblas_operation_transpose;                                 \
+      else                                                                    \
+        trans_ = rocblas_operation_none;                                      \
+                                                                              \
+      KokkosBlas::Impl::RocBlasSingleton& s =                                 \
+          KokkosBlas::Impl::RocBlasSingleton::singleton();                    \
+      KOKKOS_ROCBLAS_SAFE_CALL_IMPL(                                          \
+          rocblas_set_stream(s.handle, space.hip_stream()));                  \
+      KOKKOS_ROCBLAS_SAFE_CALL_IMPL(SYR2K_FN(                                 \
+          s.handle, uplo_, trans_, N, K,                                      \
+          reinterpret_cast<const ROCBLAS_SCALAR_TYPE*>(&alpha),               \
+          reinterpret_cast<const ROCBLAS_SCALAR_TYPE*>(A.data()), LDA,        \
+          reinterpret_cast<const ROCBLAS_SCALAR_TYPE*>(B.data()), LDB,        \
+          reinterpret_cast<const ROCBLAS_SCALAR_TYPE*>(&beta),                \
+          reinterpret_cast<ROCBLAS_SCALAR_TYPE*>(C.data()), LDC));            \
+      KOKKOS_ROCBLAS_SAFE_CALL_IMPL(rocblas_set_stream(s.handle, NULL));      \
+      Kokkos::Profiling::popRegion();                                         \
+    }                                                                         \
+  };
+
+#define KOKKOSBLAS3_DSYR2K_ROCBLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)          \
+  KOKKOSBLAS3_SYR2K_ROCBLAS(double, double, rocblas_dsyr2k, LAYOUT, MEM_SPACE, \
+                            ETI_SPEC_AVAIL)
+
+#define KOKKOSBLAS3_SSYR2K_ROCBLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)        \
+  KOKKOSBLAS3_SYR2K_ROCBLAS(float, float, rocblas_ssyr2k, LAYOUT, MEM_SPACE, \
+                            ETI_SPEC_AVAIL)
+
+#define KOKKOSBLAS3_ZSYR2K_ROCBLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)        \
+  KOKKOSBLAS3_SYR2K_ROCBLAS(Kokkos::complex<double>, rocblas_double_complex, \
+                            rocblas_zsyr2k, LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)
+
+#define KOKKOSBLAS3_CSYR2K_ROCBLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)      \
+  KOKKOSBLAS3_SYR2K_ROCBLAS(Kokkos::complex<float>, rocblas_float_complex, \
+                            rocblas_csyr2k, LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)
+
+// Explicitly define the SYR2K class for all permutations listed below
+
+KOKKOSBLAS3_DSYR2K_ROCBLAS(Kokkos::LayoutLeft, Kokkos::HIPSpace, true)
+KOKKOSBLAS3_DSYR2K_ROCBLAS(Kokkos::LayoutLeft, Kokkos::HIPSpace, false)
+KOKKOSBLAS3_DSYR2K_ROCBLAS(Kokkos::LayoutRight, Kokkos::HIPSpace, true)
+KOKKOSBLAS3_DSYR2K_ROCBLAS(Kokkos::LayoutRight, Kokkos::HIPSpace, false)
+
+KOKKOSBLAS3_SSYR2K_ROCBLAS(Kokkos::LayoutLeft, Kokkos::HIPSpace, true)
+KOKKOSBLAS3_SSYR2K_ROCBLAS(Kokkos::LayoutLeft, Kokkos::HIPSpace, false)
+KOKKOSBLAS3_SSYR2K_ROCBLAS(Kokkos::LayoutRight, Kokkos::HIPSpace, true)
+KOKKOSBLAS3_SSYR2K_ROCBLAS(Kokkos::LayoutRight, Kokkos::HIPSpace, false)
+
+KOKKOSBLAS3_ZSYR2K_ROCBLAS(Kokkos::LayoutLeft, Kokkos::HIPSpace, true)
+KOKKOSBLAS3_ZSYR2K_ROCBLAS(Kokkos::LayoutLeft, Kokkos::HIPSpace, false)
+KOKKOSBLAS3_ZSYR2K_ROCBLAS(Kokkos::LayoutRight, Kokkos::HIPSpace, true)
+KOKKOSBLAS3_ZSYR2K_ROCBLAS(Kokkos::LayoutRight, Kokkos::HIPSpace, false)
+
+KOKKOSBLAS3_CSYR2K_ROCBLAS(Kokkos::LayoutLeft, Kokkos::HIPSpace, true)
+KOKKOSBLAS3_CSYR2K_ROCBLAS(Kokkos::LayoutLeft, Kokkos::HIPSpace, false)
+KOKKOSBLAS3_CSYR2K_ROCBLAS(Kokkos::LayoutRight, Kokkos::HIPSpace, true)
+KOKKOSBLAS3_CSYR2K_ROCBLAS(Kokkos::LayoutRight, Kokkos::HIPSpace, false)
+
+}  // namespace Impl
+}  // namespace KokkosBlas
+#endif  // KOKKOSKERNELS_ENABLE_TPL_ROCBLAS
+
+#endif  // KOKKOSBLAS3_SYR2K_TPL_SPEC_DECL_HPP_
@@ -0,0 +1,405 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef KOKKOSBLAS3_SYRK_TPL_SPEC_DECL_HPP_
+#define KOKKOSBLAS3_SYRK_TPL_SPEC_DECL_HPP_
+
+// Generic Host side BLAS (could be MKL or anything)
+#if defined(KOKKOSKERNELS_ENABLE_TPL_BLAS)
+#include "KokkosBlas_Host_tpl.hpp"
+
+namespace KokkosBlas {
+namespace Impl {
+
+#define KOKKOSBLAS3_SYRK_BLAS(SCALAR_TYPE, BASE_SCALAR_TYPE, LAYOUT,          \
+                              MEM_SPACE, ETI_SPEC_AVAIL)                      \
+  template <class ExecSpace>                                                  \
+  struct SYRK<ExecSpace,                                                      \
+              Kokkos::View<const SCALAR_TYPE**, LAYOUT,                       \
+                           Kokkos::Device<ExecSpace, MEM_SPACE>,              \
+                           Kokkos::MemoryTraits<Kokkos::Unmanaged> >,         \
+              Kokkos::View<SCALAR_TYPE**, LAYOUT,                             \
+                           Kokkos::Device<ExecSpace, MEM_SPACE>,              \
+                           Kokkos::MemoryTraits<Kokkos::Unmanaged> >,         \
+              true, ETI_SPEC_AVAIL> {                                         \
+    typedef SCALAR_TYPE SCALAR;                                               \
+    typedef Kokkos::View<const SCALAR**, LAYOUT,                              \
+                         Kokkos::Device<ExecSpace, MEM_SPACE>,                \
+                         Kokkos::MemoryTraits<Kokkos::Unmanaged> >            \
+        AViewType;                                                            \
+    typedef Kokkos::View<SCALAR**, LAYOUT,                                    \
+                         Kokkos::Device<ExecSpace, MEM_SPACE>,                \
+                         Kokkos::MemoryTraits<Kokkos::Unmanaged> >            \
+        CViewType;                                                            \
+                                                                              \
+    static void syrk(const ExecSpace& /*space*/, const char uplo[],           \
+                     const char trans[], const bool hermitian,                \
+                     typename CViewType::const_value_type& alpha,             \
+                     const AViewType& A,                                      \
+                     typename CViewType::const_value_type& beta,              \
+                     const CViewType& C) {                                    \
+      Kokkos::Profiling::pushRegion("KokkosBlas::syrk[TPL_BLAS," #SCALAR_TYPE \
+                                    "]");                                     \
+      const bool A_t   = (trans[0] != 'N') && (trans[0] != 'n');              \
+      const bool lower = (uplo[0] == 'L') || (uplo[0] == 'l');                \
+      const int N      = static_cast<int>(C.extent(0));                       \
+      const int K      = static_cast<int>(A.extent(A_t ? 0 : 1));             \
+                                                                              \
+      bool is_lr = std::is_same<Kokkos::LayoutRight, LAYOUT>::value;          \
+                                                                              \
+      const int AST = is_lr ? A.stride(0) : A.stride(1),                      \
+                LDA = AST == 0 ? 1 : AST;                                     \
+      const int CST = is_lr ? C.stride(0) : C.stride(1),                      \
+                LDC = CST == 0 ? 1 : CST;                                     \
+                                                                              \
+      /* row-major: flip the triangle and op(A), C being symmetric */         \
+      const char transT =                                                     \
+          hermitian && Kokkos::ArithTraits<SCALAR>::is_complex ? 'C' : 'T';   \
+      const char uplo_  = lower != is_lr ? 'L' : 'U';                         \
+      const char trans_ = A_t != is_lr ? transT : 'N';                        \
+                                                                              \
+      if (hermitian)                                                          \
+        HostBlas<BASE_SCALAR_TYPE>::herk(                                     \
+            uplo_, trans_, N, K, alpha,                                       \
+            reinterpret_cast<const BASE_SCALAR_TYPE*>(A.data()), LDA, beta,   \
+            reinterpret_cast<BASE_SCALAR_TYPE*>(C.data()), LDC);              \
+      else                                                                    \
+        HostBlas<BASE_SCALAR_TYPE>::syrk(                                     \
+            uplo_, trans_, N, K, alpha,                                       \
+            reinterpret_cast<const BASE_SCALAR_TYPE*>(A.data()), LDA, beta,   \
+            reinterpret_cast<BASE_SCALAR_TYPE*>(C.data()), LDC);              \
+      Kokkos::Profiling::popRegion();                                         \
+    }                                                                         \
+  };
+
+#define KOKKOSBLAS3_DSYRK_BLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL) \
+  KOKKOSBLAS3_SYRK_BLAS(double, double, LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)
+
+#define KOKKOSBLAS3_SSYRK_BLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL) \
+  KOKKOSBLAS3_SYRK_BLAS(float, float, LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)
+
+#define KOKKOSBLAS3_ZSYRK_BLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)              \
+  KOKKOSBLAS3_SYRK_BLAS(Kokkos::complex<double>, std::complex<double>, LAYOUT, \
+                        MEM_SPACE, ETI_SPEC_AVAIL)
+
+#define KOKKOSBLAS3_CSYRK_BLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)            \
+  KOKKOSBLAS3_SYRK_BLAS(Kokkos::complex<float>, std::complex<float>, LAYOUT, \
+                        MEM_SPACE, ETI_SPEC_AVAIL)
+
+// Explicitly define the SYRK class for all permutations listed below
+
+KOKKOSBLAS3_DSYRK_BLAS(Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS3_DSYRK_BLAS(Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS3_DSYRK_BLAS(Kokkos::LayoutRight, Kokkos::HostSpace, true)
+KOKKOSBLAS3_DSYRK_BLAS(Kokkos::LayoutRight, Kokkos::HostSpace, false)
+
+KOKKOSBLAS3_SSYRK_BLAS(Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS3_SSYRK_BLAS(Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS3_SSYRK_BLAS(Kokkos::LayoutRight, Kokkos::HostSpace, true)
+KOKKOSBLAS3_SSYRK_BLAS(Kokkos::LayoutRight, Kokkos::HostSpace, false)
+
+KOKKOSBLAS3_ZSYRK_BLAS(Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS3_ZSYRK_BLAS(Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS3_ZSYRK_BLAS(Kokkos::LayoutRight, Kokkos::HostSpace, true)
+KOKKOSBLAS3_ZSYRK_BLAS(Kokkos::LayoutRight, Kokkos::HostSpace, false)
+
+KOKKOSBLAS3_CSYRK_BLAS(Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS3_CSYRK_BLAS(Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS3_CSYRK_BLAS(Kokkos::LayoutRight, Kokkos::HostSpace, true)
+KOKKOSBLAS3_CSYRK_BLAS(Kokkos::LayoutRight, Kokkos::HostSpace, false)
+
+}  // namespace Impl
+}  // namespace KokkosBlas
+#endif  // KOKKOSKERNELS_ENABLE_TPL_BLAS
+
+// cuBLAS
+#if defined(KOKKOSKERNELS_ENABLE_TPL_CUBLAS)
+#include <KokkosBlas_tpl_spec.hpp>
+
+namespace KokkosBlas {
+namespace Impl {
+
+#define KOKKOSBLAS3_SYRK_CUBLAS(SCALAR_TYPE, CUDA_SCALAR_TYPE, MAG_TYPE,      \
+                                SYRK_FN, HERK_FN, LAYOUT, MEM_SPACE,          \
+                                ETI_SPEC_AVAIL)                               \
+  template <class ExecSpace>                                                  \
+  struct SYRK<ExecSpace,                                                      \
+              Kokkos::View<const SCALAR_TYPE**, LAYOUT,                       \
+                           Kokkos::Device<ExecSpace, MEM_SPACE>,              \
+                           Kokkos::MemoryTraits<Kokkos::Unmanaged> >,         \
+              Kokkos::View<SCALAR_TYPE**, LAYOUT,                             \
+                           Kokkos::Device<ExecSpace, MEM_SPACE>,              \
+                           Kokkos::MemoryTraits<Kokkos::Unmanaged> >,         \
+              true, ETI_SPEC_AVAIL> {                                         \
+    typedef SCALAR_TYPE SCALAR;                                               \
+    typedef Kokkos::View<const SCALAR**, LAYOUT,                              \
+                         Kokkos::Device<ExecSpace, MEM_SPACE>,                \
+                         Kokkos::MemoryTraits<Kokkos::Unmanaged> >            \
+        AViewType;                                                            \
+    typedef Kokkos::View<SCALAR**, LAYOUT,                                    \
+                         Kokkos::Device<ExecSpace, MEM_SPACE>,                \
+                         Kokkos::MemoryTraits<Kokkos::Unmanaged> >            \
+        CViewType;                                                            \
+                                                                              \
+    static void syrk(const ExecSpace& space, const char uplo[],               \
+                     const char trans[], const bool hermitian,                \
+                     typename CViewType::const_value_type& alpha,             \
+                     const AViewType& A,                                      \
+                     typename CViewType::const_value_type& beta,              \
+                     const CViewType& C) {                                    \
+      Kokkos::Profiling::pushRegion(                                          \
+          "KokkosBlas::syrk[TPL_CUBLAS," #SCALAR_TYPE "]");                   \
+      const bool A_t   = (trans[0] != 'N') && (trans[0] != 'n');              \
+      const bool lower = (uplo[0] == 'L') || (uplo[0] == 'l');                \
+      const int N      = static_cast<int>(C.extent(0));                       \
+      const int K      = static_cast<int>(A.extent(A_t ? 0 : 1));             \
+                                                                              \
+      bool is_lr = std::is_same<Kokkos::LayoutRight, LAYOUT>::value;          \
+                                                                              \
+      const int AST = is_lr ? A.stride(0) : A.stride(1),                      \
+                LDA = AST == 0 ? 1 : AST;                                     \
+      const int CST = is_lr ? C.stride(0) : C.stride(1),                      \
+                LDC = CST == 0 ? 1 : CST;                                     \
+                                                                              \
+      /* row-major: flip the triangle and op(A), C being symmetric */         \
+      cublasFillMode_t uplo_;                                                 \
+      cublasOperation_t trans_;                                               \
+      if (lower != is_lr)                                                     \
+        uplo_ = CUBLAS_FILL_MODE_LOWER;                                       \
+      else                                                                    \
+        uplo_ = CUBLAS_FILL_MODE_UPPER;                                       \
+      if (A_t == is_lr)                                                       \
+        trans_ = CUBLAS_OP_N;                                                 \
+      else if (hermitian && Kokkos::ArithTraits<SCALAR>::is_complex)          \
+        trans_ = CUBLAS_OP_C;                                                 \
+      else                                                                    \
+        trans_ = CUBLAS_OP_T;                                                 \
+                                                                              \
+      KokkosBlas::Impl::CudaBlasSingleton& s =                                \
+          KokkosBlas::Impl::CudaBlasSingleton::singleton();                   \
+      KOKKOS_CUBLAS_SAFE_CALL_IMPL(                                           \
+          cublasSetStream(s.handle, space.cuda_stream()));                    \
+      if (hermitian) {                                                        \
+        const MAG_TYPE alpha_ = Kokkos::ArithTraits<SCALAR>::real(alpha);     \
+        const MAG_TYPE beta_  = Kokkos::ArithTraits<SCALAR>::real(beta);      \
+        KOKKOS_CUBLAS_SAFE_CALL_IMPL(HERK_FN(                                 \
+            s.handle, uplo_, trans_, N, K, &alpha_,                           \
+            reinterpret_cast<const CUDA_SCALAR_TYPE*>(A.data()), LDA, &beta_, \
+            reinterpret_cast<CUDA_SCALAR_TYPE*>(C.data()), LDC));             \
+      } else {                                                                \
+        KOKKOS_CUBLAS_SAFE_CALL_IMPL(SYRK_FN(                                 \
+            s.handle, uplo_, trans_, N, K,                                    \
+            reinterpret_cast<const CUDA_SCALAR_TYPE*>(&alpha),                \
+            reinterpret_cast<const CUDA_SCALAR_TYPE*>(A.data()), LDA,         \
+            reinterpret_cast<const CUDA_SCALAR_TYPE*>(&beta),                 \
+            reinterpret_cast<CUDA_SCALAR_TYPE*>(C.data()), LDC));             \
+      }                                                                       \
+      KOKKOS_CUBLAS_SAFE_CALL_IMPL(cublasSetStream(s.handle, NULL));          \
+      Kokkos::Profiling::popRegion();                                         \
+    }                                                                         \
+  };
+
+#define KOKKOSBLAS3_DSYRK_CUBLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)         \
+  KOKKOSBLAS3_SYRK_CUBLAS(double, double, double, cublasDsyrk, cublasDsyrk, \
+                          LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)
+
+#define KOKKOSBLAS3_SSYRK_CUBLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)      \
+  KOKKOSBLAS3_SYRK_CUBLAS(float, float, float, cublasSsyrk, cublasSsyrk, \
+                          LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)
+
+#define KOKKOSBLAS3_ZSYRK_CUBLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)         \
+  KOKKOSBLAS3_SYRK_CUBLAS(Kokkos::complex<double>, cuDoubleComplex, double, \
+                          cublasZsyrk, cublasZherk, LAYOUT, MEM_SPACE,      \
+                          ETI_SPEC_AVAIL)
+
+#define KOKKOSBLAS3_CSYRK_CUBLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)    \
+  KOKKOSBLAS3_SYRK_CUBLAS(Kokkos::complex<float>, cuComplex, float,    \
+                          cublasCsyrk, cublasCherk, LAYOUT, MEM_SPACE, \
+                          ETI_SPEC_AVAIL)
+
+// Explicitly define the SYRK class for all permutations listed below
+
+KOKKOSBLAS3_DSYRK_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaSpace, true)
+KOKKOSBLAS3_DSYRK_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaSpace, false)
+KOKKOSBLAS3_DSYRK_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaUVMSpace, true)
+KOKKOSBLAS3_DSYRK_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaUVMSpace, false)
+KOKKOSBLAS3_DSYRK_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaSpace, true)
+KOKKOSBLAS3_DSYRK_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaSpace, false)
+KOKKOSBLAS3_DSYRK_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaUVMSpace, true)
+KOKKOSBLAS3_DSYRK_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaUVMSpace, false)
+
+KOKKOSBLAS3_SSYRK_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaSpace, true)
+KOKKOSBLAS3_SSYRK_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaSpace, false)
+KOKKOSBLAS3_SSYRK_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaUVMSpace, true)
+KOKKOSBLAS3_SSYRK_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaUVMSpace, false)
+KOKKOSBLAS3_SSYRK_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaSpace, true)
+KOKKOSBLAS3_SSYRK_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaSpace, false)
+KOKKOSBLAS3_SSYRK_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaUVMSpace, true)
+KOKKOSBLAS3_SSYRK_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaUVMSpace, false)
+
+KOKKOSBLAS3_ZSYRK_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaSpace, true)
+KOKKOSBLAS3_ZSYRK_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaSpace, false)
+KOKKOSBLAS3_ZSYRK_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaUVMSpace, true)
+KOKKOSBLAS3_ZSYRK_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaUVMSpace, false)
+KOKKOSBLAS3_ZSYRK_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaSpace, true)
+KOKKOSBLAS3_ZSYRK_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaSpace, false)
+KOKKOSBLAS3_ZSYRK_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaUVMSpace, true)
+KOKKOSBLAS3_ZSYRK_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaUVMSpace, false)
+
+KOKKOSBLAS3_CSYRK_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaSpace, true)
+KOKKOSBLAS3_CSYRK_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaSpace, false)
+KOKKOSBLAS3_CSYRK_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaUVMSpace, true)
+KOKKOSBLAS3_CSYRK_CUBLAS(Kokkos::LayoutLeft, Kokkos::CudaUVMSpace, false)
+KOKKOSBLAS3_CSYRK_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaSpace, true)
+KOKKOSBLAS3_CSYRK_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaSpace, false)
+KOKKOSBLAS3_CSYRK_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaUVMSpace, true)
+KOKKOSBLAS3_CSYRK_CUBLAS(Kokkos::LayoutRight, Kokkos::CudaUVMSpace, false)
+
+}  // namespace Impl
+}  // namespace KokkosBlas
+#endif  // KOKKOSKERNELS_ENABLE_TPL_CUBLAS
+
+// rocBLAS
+#if defined(KOKKOSKERNELS_ENABLE_TPL_ROCBLAS)
+#include <KokkosBlas_tpl_spec.hpp>
+
+namespace KokkosBlas {
+namespace Impl {
+
+#define KOKKOSBLAS3_SYRK_ROCBLAS(SCALAR_TYPE, ROCBLAS_SCALAR_TYPE, MAG_TYPE, \
+                                 SYRK_FN, HERK_FN, LAYOUT, MEM_SPACE,        \
+                                 ETI_SPEC_AVAIL)                             \
+  template <class ExecSpace>                                                 \
+  struct SYRK<ExecSpace,                                                     \
+              Kokkos::View<const SCALAR_TYPE**, LAYOUT,                      \
+                           Kokkos::Device<ExecSpace, MEM_SPACE>,             \
+                           Kokkos::MemoryTraits<Kokkos::Unmanaged> >,        \
+              Kokkos::View<SCALAR_TYPE**, LAYOUT,                            \
+                           Kokkos::Device<ExecSpace, MEM_SPACE>,             \
+                           Kokkos::MemoryTraits<Kokkos::Unmanaged> >,        \
+              true, ETI_SPEC_AVAIL> {                                        \
+    typedef SCALAR_TYPE SCALAR;                                              \
+    typedef Kokkos::View<const SCALAR**, LAYOUT,                             \
+                         Kokkos::Device<ExecSpace, MEM_SPACE>,               \
+                         Kokkos::MemoryTraits<Kokkos::Unmanaged> >           \
+        AViewType;                                                           \
+    typedef Kokkos::View<SCALAR**, LAYOUT,                                   \
+                         Kokkos::Device<ExecSpace, MEM_SPACE>,               \
+                         Kokkos::MemoryTraits<Kokkos::Unmanaged> >           \
+        CViewType;                                                           \
+                                                                             \
+    static void syrk(const ExecSpace& space, const char uplo[],              \
+                     const char trans[], const bool hermitian,               \
+                     typename CViewType::const_value_type& alpha,            \
+                     const AViewType& A,                                     \
+                     typename CViewType::const_value_type& beta,             \
+                     const CViewType& C) {                                   \
+      Kokkos::Profiling::pushRegion(                                         \
+          "KokkosBlas::syrk[TPL_ROCBLAS," #SCALAR_TYPE "]");                 \
+      const bool A_t   = (trans[0] != 'N') && (trans[0] != 'n');             \
+      const bool lower = (uplo[0] == 'L') || (uplo[0] == 'l');               \
+      const int N      = static_cast<int>(C.extent(0));                      \
+      const int K      = static_cast<int>(A.extent(A_t ? 0 : 1));            \
+                                                                             \
+      bool is_lr = std::is_same<Kokkos::LayoutRight, LAYOUT>::value;         \
+                                                                             \
+      const int AST = is_lr ? A.stride(0) : A.stride(1),                     \
+                LDA = AST == 0 ? 1 : AST;                                    \
+      const int CST = is_lr ? C.stride(0) : C.stride(1),                     \
+                LDC = CST == 0 ? 1 : CST;                                    \
+                                                                             \
+      /* row-major: flip the triangle and op(A), C being symmetric */        \
+      rocblas_fill uplo_;                                                    \
+      rocblas_operation trans_;                                              \
+      if (lower != is_lr)                                                    \
+        uplo_ = rocblas_fill_lower;                                          \
+      else                                                                   \
+        uplo_ = rocblas_fill_upper;                                          \
+      if (A_t == is_lr)                                                      \
+        trans_ = rocblas_operation_none;                                     \
+      else if (hermitian && Kokkos::ArithTraits<SCALAR>::is_complex)         \
+        trans_ = rocblas_operation_conjugate_transpose;                      \
+      else                                                                   \
+        trans_ = rocblas_operation_transpose;                                \
+                                                                             \
+      KokkosBlas::Impl::RocBlasSingleton& s =                                \
+          KokkosBlas::Impl::RocBlasSingleton::singleton();                   \
+      KOKKOS_ROCBLAS_SAFE_CALL_IMPL(                                         \
+          rocblas_set_stream(s.handle, space.hip_stream()));                 \
+      if (hermitian) {                                                       \
+        const MAG_TYPE alpha_ = Kokkos::ArithTraits<SCALAR>::real(alpha);    \
+        const MAG_TYPE beta_  = Kokkos::ArithTraits<SCALAR>::real(beta);     \
+        KOKKOS_ROCBLAS_SAFE_CALL_IMPL(HERK_FN(                               \
+            s.handle, uplo_, trans_, N, K, &alpha_,                          \
+            reinterpret_cast<const ROCBLAS_SCALAR_TYPE*>(A.data()), LDA,     \
+            &beta_, reinterpret_cast<ROCBLAS_SCALAR_TYPE*>(C.data()), LDC)); \
+      } else {                                                               \
+        KOKKOS_ROCBLAS_SAFE_CALL_IMPL(SYRK_FN(                               \
+            s.handle, uplo_, trans_, N, K,                                   \
+            reinterpret_cast<const ROCBLAS_SCALAR_TYPE*>(&alpha),            \
+            reinterpret_cast<const ROCBLAS_SCALAR_TYPE*>(A.data()), LDA,     \
+            reinterpret_cast<const ROCBLAS_SCALAR_TYPE*>(&beta),             \
+            reinterpret_cast<ROCBLAS_SCALAR_TYPE*>(C.data()), LDC));         \
+      }                                                                      \
+      KOKKOS_ROCBLAS_SAFE_CALL_IMPL(rocblas_set_stream(s.handle, NULL));     \
+      Kokkos::Profiling::popRegion();                                        \
+    }                                                                        \
+  };
+
+#define KOKKOSBLAS3_DSYRK_ROCBLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL) \
+  KOKKOSBLAS3_SYRK_ROCBLAS(double, double, double, rocblas_dsyrk,    \
+                           rocblas_dsyrk, LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)
+
+#define KOKKOSBLAS3_SSYRK_ROCBLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)          \
+  KOKKOSBLAS3_SYRK_ROCBLAS(float, float, float, rocblas_ssyrk, rocblas_ssyrk, \
+                           LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)
+
+#define KOKKOSBLAS3_ZSYRK_ROCBLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)        \
+  KOKKOSBLAS3_SYRK_ROCBLAS(Kokkos::complex<double>, rocblas_double_complex, \
+                           double, rocblas_zsyrk, rocblas_zherk, LAYOUT,    \
+                           MEM_SPACE, ETI_SPEC_AVAIL)
+
+#define KOKKOSBLAS3_CSYRK_ROCBLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)      \
+  KOKKOSBLAS3_SYRK_ROCBLAS(Kokkos::complex<float>, rocblas_float_complex, \
+                           float, rocblas_csyrk, rocblas_cherk, LAYOUT,   \
+                           MEM_SPACE, ETI_SPEC_AVAIL)
+
+// Explicitly define the SYRK class for all permutations listed below
+
+KOKKOSBLAS3_DSYRK_ROCBLAS(Kokkos::LayoutLeft, Kokkos::HIPSpace, true)
+KOKKOSBLAS3_DSYRK_ROCBLAS(Kokkos::LayoutLeft, Kokkos::HIPSpace, false)
+KOKKOSBLAS3_DSYRK_ROCBLAS(Kokkos::LayoutRight, Kokkos::HIPSpace, true)
+KOKKOSBLAS3_DSYRK_ROCBLAS(Kokkos::LayoutRight, Kokkos::HIPSpace, false)
+
+KOKKOSBLAS3_SSYRK_ROCBLAS(Kokkos::LayoutLeft, Kokkos::HIPSpace, true)
+KOKKOSBLAS3_SSYRK_ROCBLAS(Kokkos::LayoutLeft, Kokkos::HIPSpace, false)
+KOKKOSBLAS3_SSYRK_ROCBLAS(Kokkos::LayoutRight, Kokkos::HIPSpace, true)
+KOKKOSBLAS3_SSYRK_ROCBLAS(Kokkos::LayoutRight, Kokkos::HIPSpace, false)
+
+KOKKOSBLAS3_ZSYRK_ROCBLAS(Kokkos::LayoutLeft, Kokkos::HIPSpace, true)
+KOKKOSBLAS3_ZSYRK_ROCBLAS(Kokkos::LayoutLeft, Kokkos::HIPSpace, false)
+KOKKOSBLAS3_ZSYRK_ROCBLAS(Kokkos::LayoutRight, Kokkos::HIPSpace, true)
+KOKKOSBLAS3_ZSYRK_ROCBLAS(Kokkos::LayoutRight, Kokkos::HIPSpace, false)
+
+KOKKOSBLAS3_CSYRK_ROCBLAS(Kokkos::LayoutLeft, Kokkos::HIPSpace, true)
+KOKKOSBLAS3_CSYRK_ROCBLAS(Kokkos::LayoutLeft, Kokkos::HIPSpace, false)
+KOKKOSBLAS3_CSYRK_ROCBLAS(Kokkos::LayoutRight, Kokkos::HIPSpace, true)
+KOKKOSBLAS3_CSYRK_ROCBLAS(Kokkos::LayoutRight, Kokkos::HIPSpace, false)
+
+}  // namespace Impl
+}  // namespace KokkosBlas
+#endif  // KOKKOSKERNELS_ENABLE_TPL_ROCBLAS
+
+#endif  // KOKKOSBLAS3_SYRK_TPL_SPEC_DECL_HPP_
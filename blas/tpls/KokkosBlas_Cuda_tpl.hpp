@@ -18,6 +18,7 @@
 
 #if defined(KOKKOSKERNELS_ENABLE_TPL_CUBLAS)
 #include <KokkosBlas_tpl_spec.hpp>
+#include <KokkosKernels_TplHandleCache.hpp>
 
 namespace KokkosBlas {
 namespace Impl {
@@ -35,6 +36,20 @@ CudaBlasSingleton& CudaBlasSingleton::singleton() {
   return s;
 }
 
+cublasHandle_t CudaBlasSingleton::stream_handle(cudaStream_t stream) {
+  static KokkosKernels::Impl::TplHandleCache<cudaStream_t, cublasHandle_t>
+      cache(
+          [](cublasHandle_t* h) {
+            if (cublasCreate(h) != CUBLAS_STATUS_SUCCESS)
+              Kokkos::abort("CUBLAS initialization failed\n");
+          },
+          [](cublasHandle_t h, cudaStream_t st) {
+            KOKKOS_CUBLAS_SAFE_CALL_IMPL(cublasSetStream(h, st));
+          },
+          [](cublasHandle_t h) { cublasDestroy(h); });
+  return cache.get(stream);
+}
+
 }  // namespace Impl
 }  // namespace KokkosBlas
 #endif  // defined (KOKKOSKERNELS_ENABLE_TPL_CUBLAS)
@@ -249,6 +249,30 @@ void F77_BLAS_MANGLE(zgemv, ZGEMV)(const char*, KK_INT*, KK_INT*,
                                    const std::complex<double>*,
                                    /* */ std::complex<double>*, KK_INT*);
 
+///
+/// Symv, Hemv
+///
+void F77_BLAS_MANGLE(ssymv, SSYMV)(const char*, KK_INT*, const float*,
+                                   const float*, KK_INT*, const float*, KK_INT*,
+                                   const float*,
+                                   /* */ float*, KK_INT*);
+void F77_BLAS_MANGLE(dsymv, DSYMV)(const char*, KK_INT*, const double*,
+                                   const double*, KK_INT*, const double*,
+                                   KK_INT*, const double*,
+                                   /* */ double*, KK_INT*);
+void F77_BLAS_MANGLE(chemv, CHEMV)(const char*, KK_INT*,
+                                   const std::complex<float>*,
+                                   const std::complex<float>*, KK_INT*,
+                                   const std::complex<float>*, KK_INT*,
+                                   const std::complex<float>*,
+                                   /* */ std::complex<float>*, KK_INT*);
+void F77_BLAS_MANGLE(zhemv, ZHEMV)(const char*, KK_INT*,
+                                   const std::complex<double>*,
+                                   const std::complex<double>*, KK_INT*,
+                                   const std::complex<double>*, KK_INT*,
+                                   const std::complex<double>*,
+                                   /* */ std::complex<double>*, KK_INT*);
+
 ///
 /// Ger
 ///
@@ -396,6 +420,46 @@ void F77_BLAS_MANGLE(zherk, ZHERK)(const char*, const char*, KK_INT*, KK_INT*,
                                    const std::complex<double>*,
                                    /* */ std::complex<double>*, KK_INT*);
 
+///
+/// Syrk
+///
+
+void F77_BLAS_MANGLE(csyrk, CSYRK)(const char*, const char*, KK_INT*, KK_INT*,
+                                   const std::complex<float>*,
+                                   const std::complex<float>*, KK_INT*,
+                                   const std::complex<float>*,
+                                   /* */ std::complex<float>*, KK_INT*);
+void F77_BLAS_MANGLE(zsyrk, ZSYRK)(const char*, const char*, KK_INT*, KK_INT*,
+                                   const std::complex<double>*,
+                                   const std::complex<double>*, KK_INT*,
+                                   const std::complex<double>*,
+                                   /* */ std::complex<double>*, KK_INT*);
+
+///
+/// Syr2k
+///
+
+void F77_BLAS_MANGLE(ssyr2k, SSYR2K)(const char*, const char*, KK_INT*, KK_INT*,
+                                     const float*, const float*, KK_INT*,
+                                     const float*, KK_INT*, const float*,
+                                     /* */ float*, KK_INT*);
+void F77_BLAS_MANGLE(dsyr2k, DSYR2K)(const char*, const char*, KK_INT*, KK_INT*,
+                                     const double*, const double*, KK_INT*,
+                                     const double*, KK_INT*, const double*,
+                                     /* */ double*, KK_INT*);
+void F77_BLAS_MANGLE(csyr2k, CSYR2K)(const char*, const char*, KK_INT*, KK_INT*,
+                                     const std::complex<float>*,
+                                     const std::complex<float>*, KK_INT*,
+                                     const std::complex<float>*, KK_INT*,
+                                     const std::complex<float>*,
+                                     /* */ std::complex<float>*, KK_INT*);
+void F77_BLAS_MANGLE(zsyr2k, ZSYR2K)(const char*, const char*, KK_INT*, KK_INT*,
+                                     const std::complex<double>*,
+                                     const std::complex<double>*, KK_INT*,
+                                     const std::complex<double>*, KK_INT*,
+                                     const std::complex<double>*,
+                                     /* */ std::complex<double>*, KK_INT*);
+
 ///
 /// Trmm
 ///
@@ -512,6 +576,11 @@ void F77_BLAS_MANGLE(zscal,
 #define F77_FUNC_CGEMV F77_BLAS_MANGLE(cgemv, CGEMV)
 #define F77_FUNC_ZGEMV F77_BLAS_MANGLE(zgemv, ZGEMV)
 
+#define F77_FUNC_SSYMV F77_BLAS_MANGLE(ssymv, SSYMV)
+#define F77_FUNC_DSYMV F77_BLAS_MANGLE(dsymv, DSYMV)
+#define F77_FUNC_CHEMV F77_BLAS_MANGLE(chemv, CHEMV)
+#define F77_FUNC_ZHEMV F77_BLAS_MANGLE(zhemv, ZHEMV)
+
 #define F77_FUNC_SGER F77_BLAS_MANGLE(sger, SGER)
 #define F77_FUNC_DGER F77_BLAS_MANGLE(dger, DGER)
 #define F77_FUNC_CGERU F77_BLAS_MANGLE(cgeru, CGERU)
@@ -545,6 +614,13 @@ void F77_BLAS_MANGLE(zscal,
 #define F77_FUNC_DSYRK F77_BLAS_MANGLE(dsyrk, DSYRK)
 #define F77_FUNC_CHERK F77_BLAS_MANGLE(cherk, CHERK)
 #define F77_FUNC_ZHERK F77_BLAS_MANGLE(zherk, ZHERK)
+#define F77_FUNC_CSYRK F77_BLAS_MANGLE(csyrk, CSYRK)
+#define F77_FUNC_ZSYRK F77_BLAS_MANGLE(zsyrk, ZSYRK)
+
+#define F77_FUNC_SSYR2K F77_BLAS_MANGLE(ssyr2k, SSYR2K)
+#define F77_FUNC_DSYR2K F77_BLAS_MANGLE(dsyr2k, DSYR2K)
+#define F77_FUNC_CSYR2K F77_BLAS_MANGLE(csyr2k, CSYR2K)
+#define F77_FUNC_ZSYR2K F77_BLAS_MANGLE(zsyr2k, ZSYR2K)
 
 #define F77_FUNC_STRMM F77_BLAS_MANGLE(strmm, STRMM)
 #define F77_FUNC_DTRMM F77_BLAS_MANGLE(dtrmm, DTRMM)
@@ -623,6 +699,13 @@ void HostBlas<float>::gemv(const char trans, KK_INT m, KK_INT n,
   F77_FUNC_SGEMV(&trans, &m, &n, &alpha, a, &lda, b, &ldb, &beta, c, &ldc);
 }
 template <>
+void HostBlas<float>::symv(const char uplo, KK_INT n, const float alpha,
+                           const float* a, KK_INT lda, const float* x,
+                           KK_INT incx, const float beta,
+                           /* */ float* y, KK_INT incy) {
+  F77_FUNC_SSYMV(&uplo, &n, &alpha, a, &lda, x, &incx, &beta, y, &incy);
+}
+template <>
 void HostBlas<float>::ger(KK_INT m, KK_INT n, const float alpha, const float* x,
                           KK_INT incx, const float* y, KK_INT incy, float* a,
                           KK_INT lda) {
@@ -662,6 +745,22 @@ void HostBlas<float>::herk(const char transa, const char transb, KK_INT n,
   F77_FUNC_SSYRK(&transa, &transb, &n, &k, &alpha, a, &lda, &beta, c, &ldc);
 }
 template <>
+void HostBlas<float>::syrk(const char uplo, const char trans, KK_INT n,
+                           KK_INT k, const float alpha, const float* a,
+                           KK_INT lda, const float beta,
+                           /* */ float* c, KK_INT ldc) {
+  F77_FUNC_SSYRK(&uplo, &trans, &n, &k, &alpha, a, &lda, &beta, c, &ldc);
+}
+template <>
+void HostBlas<float>::syr2k(const char uplo, const char trans, KK_INT n,
+                            KK_INT k, const float alpha, const float* a,
+                            KK_INT lda, const float* b, KK_INT ldb,
+                            const float beta,
+                            /* */ float* c, KK_INT ldc) {
+  F77_FUNC_SSYR2K(&uplo, &trans, &n, &k, &alpha, a, &lda, b, &ldb, &beta,
+                  c, &ldc);
+}
+template <>
 void HostBlas<float>::trmm(const char side, const char uplo, const char transa,
                            const char diag, KK_INT m, KK_INT n,
                            const float alpha, const float* a, KK_INT lda,
@@ -742,6 +841,13 @@ void HostBlas<double>::gemv(const char trans, KK_INT m, KK_INT n,
   F77_FUNC_DGEMV(&trans, &m, &n, &alpha, a, &lda, b, &ldb, &beta, c, &ldc);
 }
 template <>
+void HostBlas<double>::symv(const char uplo, KK_INT n, const double alpha,
+                            const double* a, KK_INT lda, const double* x,
+                            KK_INT incx, const double beta,
+                            /* */ double* y, KK_INT incy) {
+  F77_FUNC_DSYMV(&uplo, &n, &alpha, a, &lda, x, &incx, &beta, y, &incy);
+}
+template <>
 void HostBlas<double>::ger(KK_INT m, KK_INT n, const double alpha,
                            const double* x, KK_INT incx, const double* y,
                            KK_INT incy, double* a, KK_INT lda) {
@@ -782,6 +888,22 @@ void HostBlas<double>::herk(const char transa, const char transb, KK_INT n,
   F77_FUNC_DSYRK(&transa, &transb, &n, &k, &alpha, a, &lda, &beta, c, &ldc);
 }
 template <>
+void HostBlas<double>::syrk(const char uplo, const char trans, KK_INT n,
+                            KK_INT k, const double alpha, const double* a,
+                            KK_INT lda, const double beta,
+                            /* */ double* c, KK_INT ldc) {
+  F77_FUNC_DSYRK(&uplo, &trans, &n, &k, &alpha, a, &lda, &beta, c, &ldc);
+}
+template <>
+void HostBlas<double>::syr2k(const char uplo, const char trans, KK_INT n,
+                             KK_INT k, const double alpha, const double* a,
+                             KK_INT lda, const double* b, KK_INT ldb,
+                             const double beta,
+                             /* */ double* c, KK_INT ldc) {
+  F77_FUNC_DSYR2K(&uplo, &trans, &n, &k, &alpha, a, &lda, b, &ldb, &beta,
+                  c, &ldc);
+}
+template <>
 void HostBlas<double>::trmm(const char side, const char uplo, const char transa,
                             const char diag, KK_INT m, KK_INT n,
                             const double alpha, const double* a, KK_INT lda,
@@ -882,6 +1004,14 @@ void HostBlas<std::complex<float> >::gemv(
                  (std::complex<float>*)c, &ldc);
 }
 template <>
+void HostBlas<std::complex<float> >::hemv(
+    const char uplo, KK_INT n, const std::complex<float> alpha,
+    const std::complex<float>* a, KK_INT lda, const std::complex<float>* x,
+    KK_INT incx, const std::complex<float> beta,
+    /* */ std::complex<float>* y, KK_INT incy) {
+  F77_FUNC_CHEMV(&uplo, &n, &alpha, a, &lda, x, &incx, &beta, y, &incy);
+}
+template <>
 void HostBlas<std::complex<float> >::geru(
     KK_INT m, KK_INT n, const std::complex<float> alpha,
     const std::complex<float>* x, KK_INT incx, const std::complex<float>* y,
@@ -948,6 +1078,23 @@ void HostBlas<std::complex<float> >::herk(
                  (std::complex<float>*)c, &ldc);
 }
 template <>
+void HostBlas<std::complex<float> >::syrk(
+    const char uplo, const char trans, KK_INT n, KK_INT k,
+    const std::complex<float> alpha, const std::complex<float>* a, KK_INT lda,
+    const std::complex<float> beta,
+    /* */ std::complex<float>* c, KK_INT ldc) {
+  F77_FUNC_CSYRK(&uplo, &trans, &n, &k, &alpha, a, &lda, &beta, c, &ldc);
+}
+template <>
+void HostBlas<std::complex<float> >::syr2k(
+    const char uplo, const char trans, KK_INT n, KK_INT k,
+    const std::complex<float> alpha, const std::complex<float>* a, KK_INT lda,
+    const std::complex<float>* b, KK_INT ldb, const std::complex<float> beta,
+    /* */ std::complex<float>* c, KK_INT ldc) {
+  F77_FUNC_CSYR2K(&uplo, &trans, &n, &k, &alpha, a, &lda, b, &ldb, &beta,
+                  c, &ldc);
+}
+template <>
 void HostBlas<std::complex<float> >::trmm(
     const char side, const char uplo, const char transa, const char diag,
     KK_INT m, KK_INT n, const std::complex<float> alpha,
@@ -1050,6 +1197,14 @@ void HostBlas<std::complex<double> >::gemv(
                  (std::complex<double>*)c, &ldc);
 }
 template <>
+void HostBlas<std::complex<double> >::hemv(
+    const char uplo, KK_INT n, const std::complex<double> alpha,
+    const std::complex<double>* a, KK_INT lda, const std::complex<double>* x,
+    KK_INT incx, const std::complex<double> beta,
+    /* */ std::complex<double>* y, KK_INT incy) {
+  F77_FUNC_ZHEMV(&uplo, &n, &alpha, a, &lda, x, &incx, &beta, y, &incy);
+}
+template <>
 void HostBlas<std::complex<double> >::geru(
     KK_INT m, KK_INT n, const std::complex<double> alpha,
     const std::complex<double>* x, KK_INT incx, const std::complex<double>* y,
@@ -1118,6 +1273,23 @@ void HostBlas<std::complex<double> >::herk(
                  (std::complex<double>*)c, &ldc);
 }
 template <>
+void HostBlas<std::complex<double> >::syrk(
+    const char uplo, const char trans, KK_INT n, KK_INT k,
+    const std::complex<double> alpha, const std::complex<double>* a, KK_INT lda,
+    const std::complex<double> beta,
+    /* */ std::complex<double>* c, KK_INT ldc) {
+  F77_FUNC_ZSYRK(&uplo, &trans, &n, &k, &alpha, a, &lda, &beta, c, &ldc);
+}
+template <>
+void HostBlas<std::complex<double> >::syr2k(
+    const char uplo, const char trans, KK_INT n, KK_INT k,
+    const std::complex<double> alpha, const std::complex<double>* a, KK_INT lda,
+    const std::complex<double>* b, KK_INT ldb, const std::complex<double> beta,
+    /* */ std::complex<double>* c, KK_INT ldc) {
+  F77_FUNC_ZSYR2K(&uplo, &trans, &n, &k, &alpha, a, &lda, b, &ldb, &beta,
+                  c, &ldc);
+}
+template <>
 void HostBlas<std::complex<double> >::trmm(
     const char side, const char uplo, const char transa, const char diag,
     KK_INT m, KK_INT n, const std::complex<double> alpha,
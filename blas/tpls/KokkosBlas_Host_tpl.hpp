@@ -74,6 +74,14 @@ struct HostBlas {
                    const T *a, KK_INT lda, const T *b, KK_INT ldb, const T beta,
                    /* */ T *c, KK_INT ldc);
 
+  static void symv(const char uplo, KK_INT n, const T alpha, const T *a,
+                   KK_INT lda, const T *x, KK_INT incx, const T beta,
+                   /* */ T *y, KK_INT incy);
+
+  static void hemv(const char uplo, KK_INT n, const T alpha, const T *a,
+                   KK_INT lda, const T *x, KK_INT incx, const T beta,
+                   /* */ T *y, KK_INT incy);
+
   static void ger(KK_INT m, KK_INT n, const T alpha, const T *x, KK_INT incx,
                   const T *y, KK_INT incy, T *a, KK_INT lda);
 
@@ -116,6 +124,15 @@ struct HostBlas {
                    const T alpha, const T *a, KK_INT lda, const T beta,
                    /* */ T *c, KK_INT ldc);
 
+  static void syrk(const char uplo, const char trans, KK_INT n, KK_INT k,
+                   const T alpha, const T *a, KK_INT lda, const T beta,
+                   /* */ T *c, KK_INT ldc);
+
+  static void syr2k(const char uplo, const char trans, KK_INT n, KK_INT k,
+                    const T alpha, const T *a, KK_INT lda, const T *b,
+                    KK_INT ldb, const T beta,
+                    /* */ T *c, KK_INT ldc);
+
   static void trmm(const char side, const char uplo, const char transa,
                    const char diag, KK_INT m, KK_INT n, const T alpha,
                    const T *a, KK_INT lda,
@@ -18,6 +18,7 @@
 
 #if defined(KOKKOSKERNELS_ENABLE_TPL_ROCBLAS)
 #include <KokkosBlas_tpl_spec.hpp>
+#include <KokkosKernels_TplHandleCache.hpp>
 
 namespace KokkosBlas {
 namespace Impl {
@@ -34,6 +35,20 @@ RocBlasSingleton& RocBlasSingleton::singleton() {
   return s;
 }
 
+rocblas_handle RocBlasSingleton::stream_handle(hipStream_t stream) {
+  static KokkosKernels::Impl::TplHandleCache<hipStream_t, rocblas_handle> cache(
+      [](rocblas_handle* h) {
+        KOKKOS_ROCBLAS_SAFE_CALL_IMPL(rocblas_create_handle(h));
+      },
+      [](rocblas_handle h, hipStream_t st) {
+        KOKKOS_ROCBLAS_SAFE_CALL_IMPL(rocblas_set_stream(h, st));
+      },
+      [](rocblas_handle h) {
+        KOKKOS_ROCBLAS_SAFE_CALL_IMPL(rocblas_destroy_handle(h));
+      });
+  return cache.get(stream);
+}
+
 }  // namespace Impl
 }  // namespace KokkosBlas
 #endif  // defined (KOKKOSKERNELS_ENABLE_TPL_ROCBLAS)
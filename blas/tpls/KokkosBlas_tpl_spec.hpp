@@ -30,6 +30,10 @@ struct CudaBlasSingleton {
   CudaBlasSingleton();
 
   static CudaBlasSingleton& singleton();
+
+  /// A cuBLAS handle bound to stream, shared by every call on that stream.
+  /// Unlike handle, its stream never needs to be set or reset.
+  static cublasHandle_t stream_handle(cudaStream_t stream);
 };
 
 inline void cublas_internal_error_throw(cublasStatus_t cublasState,
@@ -120,6 +124,10 @@ struct RocBlasSingleton {
   RocBlasSingleton();
 
   static RocBlasSingleton& singleton();
+
+  /// A rocBLAS handle bound to stream, shared by every call on that stream.
+  /// Unlike handle, its stream never needs to be set or reset.
+  static rocblas_handle stream_handle(hipStream_t stream);
 };
 
 inline void rocblas_internal_error_throw(rocblas_status rocblasState,
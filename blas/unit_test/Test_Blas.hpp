@@ -22,9 +22,12 @@
 #include "Test_Blas1_axpby.hpp"
 #include "Test_Blas1_axpy.hpp"
 #include "Test_Blas1_axpby_unification.hpp"
+#include "Test_Blas1_device_result.hpp"
 #include "Test_Blas1_dot.hpp"
+#include "Test_Blas1_fused.hpp"
 #include "Test_Blas1_iamax.hpp"
 #include "Test_Blas1_mult.hpp"
+#include "Test_Blas1_multi_dot.hpp"
 #include "Test_Blas1_nrm1.hpp"
 #include "Test_Blas1_nrm2_squared.hpp"
 #include "Test_Blas1_nrm2.hpp"
@@ -60,6 +63,7 @@
 // Blas 2
 #include "Test_Blas2_gemv.hpp"
 #include "Test_Blas2_ger.hpp"
+#include "Test_Blas2_symv.hpp"
 #include "Test_Blas2_syr.hpp"
 #include "Test_Blas2_syr2.hpp"
 
@@ -72,6 +76,8 @@
 
 // Blas 3
 #include "Test_Blas3_gemm.hpp"
+#include "Test_Blas3_batched.hpp"
+#include "Test_Blas3_syrk.hpp"
 #include "Test_Blas3_trmm.hpp"
 #include "Test_Blas3_trsm.hpp"
 
@@ -0,0 +1,109 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+#include <KokkosBlas1_dot.hpp>
+#include <KokkosBlas1_iamax.hpp>
+#include <KokkosBlas1_nrm1.hpp>
+#include <KokkosBlas1_nrm2.hpp>
+#include <KokkosBlas1_nrminf.hpp>
+#include <KokkosBlas1_sum.hpp>
+#include <KokkosKernels_TestUtils.hpp>
+
+namespace Test {
+// Reductions of rank-1 Views write to rank-0 Views in device memory; the
+// results are only read back after fencing the execution space instance.
+template <class Scalar, class Device>
+void impl_test_device_result(int N) {
+  using execution_space = typename Device::execution_space;
+  using AT              = Kokkos::ArithTraits<Scalar>;
+  using mag_type        = typename AT::mag_type;
+  using dot_type =
+      typename Kokkos::Details::InnerProductSpaceTraits<Scalar>::dot_type;
+
+  Kokkos::View<Scalar*, Device> x("x", N), y("y", N);
+  Kokkos::Random_XorShift64_Pool<execution_space> rand_pool(13718);
+  Scalar randStart, randEnd;
+  Test::getRandomBounds(1.0, randStart, randEnd);
+  Kokkos::fill_random(x, rand_pool, randStart, randEnd);
+  Kokkos::fill_random(y, rand_pool, randStart, randEnd);
+
+  Kokkos::View<dot_type, Device> r_dot("r_dot");
+  Kokkos::View<Scalar, Device> r_sum("r_sum");
+  Kokkos::View<mag_type, Device> r_nrm1("r_nrm1"), r_nrm2("r_nrm2"),
+      r_nrminf("r_nrminf");
+  Kokkos::View<typename Kokkos::View<Scalar*, Device>::size_type, Device>
+      r_iamax("r_iamax");
+
+  execution_space space;
+  KokkosBlas::dot(space, r_dot, x, y);
+  KokkosBlas::sum(space, r_sum, x);
+  KokkosBlas::nrm1(space, r_nrm1, x);
+  KokkosBlas::nrm2(space, r_nrm2, x);
+  KokkosBlas::nrminf(space, r_nrminf, x);
+  KokkosBlas::iamax(space, r_iamax, x);
+  space.fence();
+
+  auto to_host = [](const auto& r) {
+    return Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), r);
+  };
+  auto h_dot    = to_host(r_dot);
+  auto h_sum    = to_host(r_sum);
+  auto h_nrm1   = to_host(r_nrm1);
+  auto h_nrm2   = to_host(r_nrm2);
+  auto h_nrminf = to_host(r_nrminf);
+  auto h_iamax  = to_host(r_iamax);
+
+  const mag_type eps = 10 * AT::epsilon();
+  EXPECT_NEAR_KK_REL(h_dot(), KokkosBlas::dot(x, y), N * eps);
+  EXPECT_NEAR_KK_REL(h_sum(), KokkosBlas::sum(x), N * eps);
+  EXPECT_NEAR_KK_REL(h_nrm1(), KokkosBlas::nrm1(x), N * eps);
+  EXPECT_NEAR_KK_REL(h_nrm2(), KokkosBlas::nrm2(x), N * eps);
+  EXPECT_EQ(h_nrminf(), KokkosBlas::nrminf(x));
+  EXPECT_EQ(h_iamax(), KokkosBlas::iamax(x));
+}
+}  // namespace Test
+
+template <class Scalar, class Device>
+int test_device_result() {
+  Test::impl_test_device_result<Scalar, Device>(0);
+  Test::impl_test_device_result<Scalar, Device>(13);
+  Test::impl_test_device_result<Scalar, Device>(1024);
+  Test::impl_test_device_result<Scalar, Device>(132231);
+  return 1;
+}
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&  \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F(TestCategory, blas1_device_result_double) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::device_result_double");
+  test_device_result<double, TestDevice>();
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&          \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F(TestCategory, blas1_device_result_complex_double) {
+  Kokkos::Profiling::pushRegion(
+      "KokkosBlas::Test::device_result_complex_double");
+  test_device_result<Kokkos::complex<double>, TestDevice>();
+  Kokkos::Profiling::popRegion();
+}
+#endif
@@ -230,6 +230,21 @@ int test_dot_mv() {
   return 1;
 }
 
+// 16-bit dot products accumulate in float: a running sum of ones kept in
+// half_t stops growing at 2048 (256 for bhalf_t), while 4096 is exact.
+template <class Scalar, class Device>
+void test_dot_16bit_accumulation() {
+  using view_type = Kokkos::View<Scalar*, Kokkos::LayoutLeft, Device>;
+  const int N     = 4096;
+
+  view_type a("a", N), b("b", N);
+  Kokkos::deep_copy(a, Scalar(1));
+  Kokkos::deep_copy(b, Scalar(1));
+
+  const Scalar r = KokkosBlas::dot(a, b);
+  EXPECT_EQ(static_cast<float>(r), static_cast<float>(N));
+}
+
 #if defined(KOKKOSKERNELS_INST_FLOAT) || \
     (!defined(KOKKOSKERNELS_ETI_ONLY) && \
      !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
@@ -290,6 +305,26 @@ TEST_F(TestCategory, dot_mv_int) {
 }
 #endif
 
+#if defined(KOKKOSKERNELS_INST_HALF) ||   \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) && \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F(TestCategory, dot_half) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::dot_half");
+  test_dot_16bit_accumulation<Kokkos::Experimental::half_t, TestDevice>();
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_BHALF) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) && \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F(TestCategory, dot_bhalf) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::dot_bhalf");
+  test_dot_16bit_accumulation<Kokkos::Experimental::bhalf_t, TestDevice>();
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
 /*#if !defined(KOKKOSKERNELS_ETI_ONLY) &&
 !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS) TEST_F( TestCategory,
 dot_double_int ) { test_dot<double,int,TestDevice> ();
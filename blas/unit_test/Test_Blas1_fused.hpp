@@ -0,0 +1,122 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+#include <KokkosBlas1_axpby.hpp>
+#include <KokkosBlas1_dot.hpp>
+#include <KokkosBlas1_fused.hpp>
+#include <KokkosBlas1_nrm2.hpp>
+#include <KokkosBlas1_scal.hpp>
+#include <KokkosBlas1_update.hpp>
+#include <KokkosKernels_TestUtils.hpp>
+
+namespace Test {
+template <class Scalar, class Device>
+void impl_test_fused_blas1(int N) {
+  using execution_space = typename Device::execution_space;
+  using view_type       = Kokkos::View<Scalar*, Device>;
+  using AT              = Kokkos::ArithTraits<Scalar>;
+  using mag_type        = typename AT::mag_type;
+
+  view_type x("x", N), y("y", N), z("z", N), w("w", N), v("v", N);
+  Kokkos::Random_XorShift64_Pool<execution_space> rand_pool(13718);
+  Scalar randStart, randEnd;
+  Test::getRandomBounds(1.0, randStart, randEnd);
+  Kokkos::fill_random(x, rand_pool, randStart, randEnd);
+  Kokkos::fill_random(y, rand_pool, randStart, randEnd);
+  Kokkos::fill_random(z, rand_pool, randStart, randEnd);
+  // w and v are overwritten without being read; NaNs would show if they were
+  Kokkos::deep_copy(w, AT::nan());
+  Kokkos::deep_copy(v, AT::nan());
+
+  view_type y_ref("y_ref", N), w_ref("w_ref", N), v_ref("v_ref", N);
+  Kokkos::deep_copy(y_ref, y);
+
+  const Scalar a(1.5), b(-0.5), c(0.25), d(2.0);
+  // Unfused reference, one kernel per operation
+  KokkosBlas::update(a, x, b, y_ref, Scalar(0), w_ref);
+  const auto r1_ref = KokkosBlas::dot(w_ref, z);
+  const auto n_ref  = KokkosBlas::nrm2(w_ref);
+  KokkosBlas::axpby(c, w_ref, d, y_ref);
+  KokkosBlas::scal(v_ref, a, y_ref);
+  const auto r2_ref = KokkosBlas::dot(v_ref, x);
+
+  typename Kokkos::Details::InnerProductSpaceTraits<Scalar>::dot_type r1, r2;
+  mag_type n;
+  KokkosBlas::fused_blas1(execution_space())
+      .update(a, x, b, y, Scalar(0), w)
+      .dot(w, z, r1)
+      .nrm2(w, n)
+      .axpby(c, w, d, y)
+      .scal(v, a, y)
+      .dot(v, x, r2)
+      .execute();
+
+  const mag_type eps = 10 * N * AT::epsilon();
+  EXPECT_NEAR_KK_REL(r1, r1_ref, eps);
+  EXPECT_NEAR_KK_REL(r2, r2_ref, eps);
+  EXPECT_NEAR_KK_REL(n, n_ref, eps);
+  EXPECT_NEAR_KK_1DVIEW(w, w_ref, eps);
+  EXPECT_NEAR_KK_1DVIEW(y, y_ref, eps);
+  EXPECT_NEAR_KK_1DVIEW(v, v_ref, eps);
+
+  // A sequence without reductions
+  KokkosBlas::fused_blas1(execution_space())
+      .scal(w, b, x)
+      .axpby(a, w, a, v)
+      .execute();
+  KokkosBlas::scal(w_ref, b, x);
+  KokkosBlas::axpby(a, w_ref, a, v_ref);
+  EXPECT_NEAR_KK_1DVIEW(w, w_ref, eps);
+  EXPECT_NEAR_KK_1DVIEW(v, v_ref, eps);
+
+  // Vectors of different lengths
+  view_type short_x("short_x", N + 1);
+  auto mismatched =
+      KokkosBlas::fused_blas1(execution_space()).axpby(a, short_x, b, y);
+  EXPECT_THROW(mismatched.execute(), std::runtime_error);
+}
+}  // namespace Test
+
+template <class Scalar, class Device>
+int test_fused_blas1() {
+  Test::impl_test_fused_blas1<Scalar, Device>(0);
+  Test::impl_test_fused_blas1<Scalar, Device>(13);
+  Test::impl_test_fused_blas1<Scalar, Device>(1024);
+  Test::impl_test_fused_blas1<Scalar, Device>(132231);
+  return 1;
+}
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&  \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F(TestCategory, fused_blas1_double) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::fused_blas1_double");
+  test_fused_blas1<double, TestDevice>();
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&          \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F(TestCategory, fused_blas1_complex_double) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::fused_blas1_complex_double");
+  test_fused_blas1<Kokkos::complex<double>, TestDevice>();
+  Kokkos::Profiling::popRegion();
+}
+#endif
@@ -0,0 +1,94 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+#include <KokkosBlas1_multi_dot.hpp>
+#include <KokkosKernels_TestUtils.hpp>
+
+namespace Test {
+template <class Scalar, class Layout, class Device>
+void impl_test_multi_dot(const char* trans, int N, int K) {
+  using execution_space = typename Device::execution_space;
+  using AT              = Kokkos::ArithTraits<Scalar>;
+
+  Kokkos::View<Scalar**, Layout, Device> X("X", N, K);
+  Kokkos::View<Scalar*, Device> y("y", N), r("r", K);
+  Kokkos::Random_XorShift64_Pool<execution_space> rand_pool(13718);
+  Kokkos::fill_random(X, rand_pool, Scalar(1));
+  Kokkos::fill_random(y, rand_pool, Scalar(1));
+  // r must be overwritten, not accumulated into
+  Kokkos::deep_copy(r, Scalar(3));
+
+  KokkosBlas::multi_dot(execution_space(), trans, r, X, y);
+  auto Xh = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), X);
+  auto yh = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y);
+  auto rh = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), r);
+
+  const double tol = 10 * N * AT::epsilon();
+  for (int j = 0; j < K; j++) {
+    Scalar expected = AT::zero();
+    for (int i = 0; i < N; i++)
+      expected += (trans[0] == 'C' ? AT::conj(Xh(i, j)) : Xh(i, j)) * yh(i);
+    EXPECT_LE(AT::abs(rh(j) - expected), tol) << trans << " r(" << j << ")";
+  }
+}
+}  // namespace Test
+
+template <class Scalar, class Layout, class Device>
+int test_multi_dot() {
+  for (const char* trans : {"T", "C"}) {
+    Test::impl_test_multi_dot<Scalar, Layout, Device>(trans, 0, 4);
+    Test::impl_test_multi_dot<Scalar, Layout, Device>(trans, 13, 1);
+    Test::impl_test_multi_dot<Scalar, Layout, Device>(trans, 1024, 5);
+    Test::impl_test_multi_dot<Scalar, Layout, Device>(trans, 132231, 12);
+  }
+  return 1;
+}
+
+template <class Scalar>
+void test_multi_dot_enabled_layouts() {
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&      \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  test_multi_dot<Scalar, Kokkos::LayoutLeft, TestDevice>();
+#endif
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&       \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  test_multi_dot<Scalar, Kokkos::LayoutRight, TestDevice>();
+#endif
+}
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&  \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F(TestCategory, blas1_multi_dot_double) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::multi_dot_double");
+  test_multi_dot_enabled_layouts<double>();
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&          \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F(TestCategory, blas1_multi_dot_complex_double) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::multi_dot_complex_double");
+  test_multi_dot_enabled_layouts<Kokkos::complex<double>>();
+  Kokkos::Profiling::popRegion();
+}
+#endif
@@ -172,6 +172,20 @@ int test_nrm2_mv() {
   return 1;
 }
 
+// The sum of squares is accumulated in float for 16-bit scalars; in half_t
+// it would saturate at 2048 and give a norm of about 45 instead of 64.
+template <class Scalar, class Device>
+void test_nrm2_16bit_accumulation() {
+  using view_type = Kokkos::View<Scalar*, Kokkos::LayoutLeft, Device>;
+  const int N     = 4096;
+
+  view_type a("a", N);
+  Kokkos::deep_copy(a, Scalar(1));
+
+  const auto r = KokkosBlas::nrm2(a);
+  EXPECT_EQ(static_cast<float>(r), 64.0f);
+}
+
 #if defined(KOKKOSKERNELS_INST_FLOAT) || \
     (!defined(KOKKOSKERNELS_ETI_ONLY) && \
      !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
@@ -231,3 +245,23 @@ TEST_F(TestCategory, nrm2_mv_int) {
   Kokkos::Profiling::popRegion();
 }
 #endif
+
+#if defined(KOKKOSKERNELS_INST_HALF) ||   \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) && \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F(TestCategory, nrm2_half) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::nrm2_half");
+  test_nrm2_16bit_accumulation<Kokkos::Experimental::half_t, TestDevice>();
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_BHALF) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) && \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F(TestCategory, nrm2_bhalf) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::nrm2_bhalf");
+  test_nrm2_16bit_accumulation<Kokkos::Experimental::bhalf_t, TestDevice>();
+  Kokkos::Profiling::popRegion();
+}
+#endif
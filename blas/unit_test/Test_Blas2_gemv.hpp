@@ -186,6 +186,9 @@ int test_gemv(const char* mode) {
       mode, 1024, 1024);
   Test::impl_test_gemv<view_type_a_ll, view_type_b_ll, view_type_c_ll, Device>(
       mode, 2131, 2131);
+  // tall and skinny, as a Krylov basis
+  Test::impl_test_gemv<view_type_a_ll, view_type_b_ll, view_type_c_ll, Device>(
+      mode, 100000, 30);
   // Test::impl_test_gemv<view_type_a_ll, view_type_b_ll, view_type_c_ll,
   // Device>(mode,132231,1024);
 #endif
@@ -210,6 +213,9 @@ int test_gemv(const char* mode) {
       mode, 1024, 1024);
   Test::impl_test_gemv<view_type_a_lr, view_type_b_lr, view_type_c_lr, Device>(
       mode, 2131, 2131);
+  // tall and skinny, as a Krylov basis
+  Test::impl_test_gemv<view_type_a_lr, view_type_b_lr, view_type_c_lr, Device>(
+      mode, 100000, 30);
   // Test::impl_test_gemv<view_type_a_lr, view_type_b_lr, view_type_c_lr,
   // Device>(mode,132231,1024);
 #endif
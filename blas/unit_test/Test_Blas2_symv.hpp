@@ -0,0 +1,131 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+#include <KokkosBlas2_symv.hpp>
+#include <KokkosKernels_TestUtils.hpp>
+
+namespace Test {
+
+template <class Scalar, class Layout, class Device>
+void impl_test_symv(const char* uplo, const bool hermitian, int N,
+                    const bool zero_beta) {
+  using execution_space = typename Device::execution_space;
+  using AT              = Kokkos::ArithTraits<Scalar>;
+  const bool lower      = uplo[0] == 'L';
+
+  Kokkos::View<Scalar**, Layout, Device> A("A", N, N);
+  Kokkos::View<Scalar*, Layout, Device> x("x", N), y("y", N);
+  Kokkos::Random_XorShift64_Pool<execution_space> rand_pool(13718);
+  // the unreferenced triangle is left random, so that reading it would show
+  Kokkos::fill_random(A, rand_pool, Scalar(1));
+  Kokkos::fill_random(x, rand_pool, Scalar(1));
+  Kokkos::fill_random(y, rand_pool, Scalar(1));
+  auto Ah = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A);
+  auto xh = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), x);
+  auto yh = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y);
+  if (zero_beta) {
+    // y must not be read when beta is zero
+    Kokkos::deep_copy(y, AT::nan());
+  }
+
+  const Scalar alpha(1.5), beta(zero_beta ? 0.0 : -0.5);
+  if (hermitian)
+    KokkosBlas::hemv(execution_space(), uplo, alpha, A, x, beta, y);
+  else
+    KokkosBlas::symv(execution_space(), uplo, alpha, A, x, beta, y);
+  auto yres = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y);
+
+  // A(i, j) as given by the stored triangle
+  auto entry = [&](int i, int j) {
+    if (i == j) return hermitian ? Scalar(AT::real(Ah(i, i))) : Ah(i, i);
+    if (lower == (i > j)) return Ah(i, j);
+    return hermitian ? AT::conj(Ah(j, i)) : Ah(j, i);
+  };
+  const double tol = 10 * N * AT::epsilon();
+  for (int i = 0; i < N; i++) {
+    Scalar sum = AT::zero();
+    for (int j = 0; j < N; j++) sum += entry(i, j) * xh(j);
+    const Scalar expected =
+        zero_beta ? alpha * sum : beta * yh(i) + alpha * sum;
+    ASSERT_LE(AT::abs(yres(i) - expected), tol)
+        << (hermitian ? "hemv " : "symv ") << uplo << " N=" << N << " y(" << i
+        << ")";
+  }
+}
+
+}  // namespace Test
+
+template <class Scalar, class Layout>
+void test_symv() {
+  const bool is_complex = Kokkos::ArithTraits<Scalar>::is_complex;
+  for (const char* uplo : {"L", "U"}) {
+    for (const bool hermitian : {false, true}) {
+      if (hermitian && !is_complex) continue;
+      for (const int N : {0, 1, 13, 32, 100}) {
+        Test::impl_test_symv<Scalar, Layout, TestDevice>(uplo, hermitian, N,
+                                                         false);
+      }
+      Test::impl_test_symv<Scalar, Layout, TestDevice>(uplo, hermitian, 45,
+                                                       true);
+    }
+  }
+}
+
+template <class Scalar>
+void test_symv_enabled_layouts() {
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&      \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  test_symv<Scalar, Kokkos::LayoutLeft>();
+#endif
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&       \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  test_symv<Scalar, Kokkos::LayoutRight>();
+#endif
+}
+
+#if defined(KOKKOSKERNELS_INST_FLOAT) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) && \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F(TestCategory, blas2_symv_float) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::blas2_symv_float");
+  test_symv_enabled_layouts<float>();
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&  \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F(TestCategory, blas2_symv_double) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::blas2_symv_double");
+  test_symv_enabled_layouts<double>();
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&          \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F(TestCategory, blas2_symv_complex_double) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::blas2_symv_complex_double");
+  test_symv_enabled_layouts<Kokkos::complex<double>>();
+  Kokkos::Profiling::popRegion();
+}
+#endif
@@ -0,0 +1,190 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+#include <KokkosBlas3_batched.hpp>
+#include <KokkosKernels_TestUtils.hpp>
+
+namespace Test {
+
+// op(X)(i, j) of matrix b of a host mirror
+template <class Scalar, class ViewType>
+Scalar batched_op(const ViewType& X, char trans, int b, int i, int j) {
+  using AT = Kokkos::ArithTraits<Scalar>;
+  if (trans == 'N') return X(b, i, j);
+  if (trans == 'T') return X(b, j, i);
+  return AT::conj(X(b, j, i));
+}
+
+template <class Scalar, class Layout, class Device>
+void impl_test_gemm_strided_batched(const char* TA, const char* TB, int nb,
+                                    int M, int N, int K) {
+  using execution_space = typename Device::execution_space;
+  using view_t          = Kokkos::View<Scalar***, Layout, Device>;
+  using AT              = Kokkos::ArithTraits<Scalar>;
+  const bool A_t        = TA[0] != 'N';
+  const bool B_t        = TB[0] != 'N';
+
+  view_t A("A", nb, A_t ? K : M, A_t ? M : K);
+  view_t B("B", nb, B_t ? N : K, B_t ? K : N);
+  view_t C("C", nb, M, N);
+  Kokkos::Random_XorShift64_Pool<execution_space> rand_pool(13718);
+  Kokkos::fill_random(A, rand_pool, Scalar(1));
+  Kokkos::fill_random(B, rand_pool, Scalar(1));
+  Kokkos::fill_random(C, rand_pool, Scalar(1));
+  auto Ah = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A);
+  auto Bh = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), B);
+  auto Ch = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), C);
+
+  const Scalar alpha(1.5), beta(-0.5);
+  KokkosBlas::gemm_strided_batched(execution_space(), TA, TB, alpha, A, B,
+                                   beta, C);
+  auto Cres = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), C);
+
+  const double tol = 10 * K * AT::epsilon();
+  for (int b = 0; b < nb; b++) {
+    for (int i = 0; i < M; i++) {
+      for (int j = 0; j < N; j++) {
+        Scalar sum = AT::zero();
+        for (int k = 0; k < K; k++)
+          sum += batched_op<Scalar>(Ah, TA[0], b, i, k) *
+                 batched_op<Scalar>(Bh, TB[0], b, k, j);
+        const Scalar expected = beta * Ch(b, i, j) + alpha * sum;
+        ASSERT_LE(AT::abs(Cres(b, i, j) - expected), tol)
+            << TA << TB << " C(" << b << ", " << i << ", " << j << ")";
+      }
+    }
+  }
+}
+
+template <class Scalar, class Layout, class Device>
+void impl_test_trsm_batched(const char* side, const char* uplo,
+                            const char* trans, const char* diag, int nb, int M,
+                            int N) {
+  using execution_space = typename Device::execution_space;
+  using view_t          = Kokkos::View<Scalar***, Layout, Device>;
+  using AT              = Kokkos::ArithTraits<Scalar>;
+  const bool left       = side[0] == 'L';
+  const bool lower      = uplo[0] == 'L';
+  const bool unit       = diag[0] == 'U';
+  const int K           = left ? M : N;
+
+  view_t A("A", nb, K, K);
+  view_t B("B", nb, M, N);
+  Kokkos::Random_XorShift64_Pool<execution_space> rand_pool(13718);
+  Kokkos::fill_random(A, rand_pool, Scalar(1));
+  Kokkos::fill_random(B, rand_pool, Scalar(1));
+  // a dominant diagonal keeps the triangular matrices well conditioned; the
+  // unreferenced part is left random, so that reading it would show
+  auto Ah = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A);
+  for (int b = 0; b < nb; b++)
+    for (int i = 0; i < K; i++) Ah(b, i, i) += Scalar(K);
+  Kokkos::deep_copy(A, Ah);
+  auto Bh = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), B);
+
+  const Scalar alpha(2.0);
+  KokkosBlas::trsm_batched(execution_space(), side, uplo, trans, diag, alpha,
+                           A, B);
+  auto X = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), B);
+
+  // the triangular part of A that is referenced, as op(A) sees it
+  auto opA = [&](int b, int i, int j) {
+    const int r = trans[0] == 'N' ? i : j, c = trans[0] == 'N' ? j : i;
+    if (r == c && unit) return AT::one();
+    if (r != c && lower != (r > c)) return AT::zero();
+    return batched_op<Scalar>(Ah, trans[0], b, i, j);
+  };
+  const double tol = 100 * K * AT::epsilon();
+  for (int b = 0; b < nb; b++) {
+    for (int i = 0; i < M; i++) {
+      for (int j = 0; j < N; j++) {
+        Scalar sum = AT::zero();
+        for (int k = 0; k < K; k++)
+          sum += left ? opA(b, i, k) * X(b, k, j) : X(b, i, k) * opA(b, k, j);
+        ASSERT_LE(AT::abs(sum - alpha * Bh(b, i, j)), tol)
+            << side << uplo << trans << diag << " B(" << b << ", " << i << ", "
+            << j << ")";
+      }
+    }
+  }
+}
+
+}  // namespace Test
+
+template <class Scalar, class Layout>
+void test_blas3_batched() {
+  const bool is_complex = Kokkos::ArithTraits<Scalar>::is_complex;
+  for (const char* TA : {"N", "T", "C"}) {
+    for (const char* TB : {"N", "T", "C"}) {
+      if (!is_complex && (TA[0] == 'C' || TB[0] == 'C')) continue;
+      Test::impl_test_gemm_strided_batched<Scalar, Layout, TestDevice>(
+          TA, TB, 1, 1, 1, 1);
+      Test::impl_test_gemm_strided_batched<Scalar, Layout, TestDevice>(
+          TA, TB, 50, 7, 5, 9);
+      Test::impl_test_gemm_strided_batched<Scalar, Layout, TestDevice>(
+          TA, TB, 3, 40, 33, 20);
+    }
+  }
+  for (const char* side : {"L", "R"}) {
+    for (const char* uplo : {"L", "U"}) {
+      for (const char* trans : {"N", "T", "C"}) {
+        if (!is_complex && trans[0] == 'C') continue;
+        for (const char* diag : {"U", "N"}) {
+          Test::impl_test_trsm_batched<Scalar, Layout, TestDevice>(
+              side, uplo, trans, diag, 1, 1, 1);
+          Test::impl_test_trsm_batched<Scalar, Layout, TestDevice>(
+              side, uplo, trans, diag, 40, 6, 9);
+        }
+      }
+    }
+  }
+}
+
+template <class Scalar>
+void test_blas3_batched_enabled_layouts() {
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&      \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  test_blas3_batched<Scalar, Kokkos::LayoutLeft>();
+#endif
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&       \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  test_blas3_batched<Scalar, Kokkos::LayoutRight>();
+#endif
+}
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&  \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F(TestCategory, blas3_batched_double) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::blas3_batched_double");
+  test_blas3_batched_enabled_layouts<double>();
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&          \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F(TestCategory, blas3_batched_complex_double) {
+  Kokkos::Profiling::pushRegion(
+      "KokkosBlas::Test::blas3_batched_complex_double");
+  test_blas3_batched_enabled_layouts<Kokkos::complex<double>>();
+  Kokkos::Profiling::popRegion();
+}
+#endif
@@ -415,6 +415,139 @@ void test_gemm_mixed_scalars() {
   KokkosBlas::gemm(TestDevice(), "N", "T", 1.0, C, D, 0.0, B);
 }
 
+// Bias per row and clamp, through the epilogue of gemm
+template <class Scalar, class Device>
+struct gemm_BiasClampEpilogue {
+  Kokkos::View<const Scalar*, Device> bias;
+  Scalar lo, hi;
+
+  KOKKOS_INLINE_FUNCTION Scalar operator()(const int i, const int /*j*/,
+                                           const Scalar& c) const {
+    const Scalar v = c + bias(i);
+    return v < lo ? lo : (v > hi ? hi : v);
+  }
+};
+
+template <class Scalar, class Layout>
+void test_gemm_epilogue(const char* TA, const char* TB, int M, int N, int K,
+                        const Scalar beta) {
+  using execution_space = typename TestDevice::execution_space;
+  using Matrix          = Kokkos::View<Scalar**, Layout, TestDevice>;
+  const bool A_t        = (TA[0] != 'N') && (TA[0] != 'n');
+  const bool B_t        = (TB[0] != 'N') && (TB[0] != 'n');
+
+  Matrix A("A", A_t ? K : M, A_t ? M : K);
+  Matrix B("B", B_t ? N : K, B_t ? K : N);
+  Matrix C("C", M, N), D("D", M, N);
+  Kokkos::View<Scalar*, TestDevice> bias("bias", M);
+  Kokkos::Random_XorShift64_Pool<execution_space> rand_pool(13718);
+  Kokkos::fill_random(A, rand_pool, Scalar(1));
+  Kokkos::fill_random(B, rand_pool, Scalar(1));
+  Kokkos::fill_random(C, rand_pool, Scalar(1));
+  Kokkos::fill_random(bias, rand_pool, Scalar(1));
+  Kokkos::deep_copy(D, C);
+
+  const Scalar alpha(1.5), lo(-0.5), hi(2.0);
+  KokkosBlas::gemm(TA, TB, alpha, A, B, beta, C,
+                   gemm_BiasClampEpilogue<Scalar, TestDevice>{bias, lo, hi});
+  KokkosBlas::gemm(TA, TB, alpha, A, B, beta, D);
+
+  auto Ch    = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), C);
+  auto Dh    = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), D);
+  auto biash = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), bias);
+  const double tol = 10 * (K + 1) * Kokkos::ArithTraits<Scalar>::epsilon();
+  for (int i = 0; i < M; i++) {
+    for (int j = 0; j < N; j++) {
+      const Scalar v        = Dh(i, j) + biash(i);
+      const Scalar expected = v < lo ? lo : (v > hi ? hi : v);
+      ASSERT_NEAR(Ch(i, j), expected, tol)
+          << TA << TB << " C(" << i << ", " << j << ")";
+    }
+  }
+}
+
+template <class Scalar, class Layout>
+void test_gemm_epilogue() {
+  for (const char* TA : {"N", "T"}) {
+    for (const char* TB : {"N", "T"}) {
+      test_gemm_epilogue<Scalar, Layout>(TA, TB, 1, 1, 1, Scalar(0));
+      test_gemm_epilogue<Scalar, Layout>(TA, TB, 50, 70, 0, Scalar(-0.5));
+      test_gemm_epilogue<Scalar, Layout>(TA, TB, 100, 37, 75, Scalar(0));
+      test_gemm_epilogue<Scalar, Layout>(TA, TB, 259, 130, 300, Scalar(-0.5));
+    }
+  }
+}
+
+// 16-bit A and B with a float C, which runs on tensor cores when they are
+// available. The entries are small integers, so that every product and
+// partial sum is exact in fp16/bf16 inputs with fp32 accumulation.
+template <class ScalarAB>
+void test_gemm_16bit_float(const char* TA, const char* TB, int M, int N,
+                           int K) {
+  using MatrixAB = Kokkos::View<ScalarAB**, TestDevice>;
+  using MatrixC  = Kokkos::View<float**, TestDevice>;
+  const bool A_t = (TA[0] != 'N') && (TA[0] != 'n');
+  const bool B_t = (TB[0] != 'N') && (TB[0] != 'n');
+
+  MatrixAB A("A", A_t ? K : M, A_t ? M : K);
+  MatrixAB B("B", B_t ? N : K, B_t ? K : N);
+  MatrixC C("C", M, N);
+  auto Ah = Kokkos::create_mirror_view(A);
+  auto Bh = Kokkos::create_mirror_view(B);
+  auto Ch = Kokkos::create_mirror_view(C);
+  for (size_t i = 0; i < A.extent(0); i++)
+    for (size_t j = 0; j < A.extent(1); j++)
+      Ah(i, j) = ScalarAB(float(int((i * 7 + j * 3) % 9) - 4));
+  for (size_t i = 0; i < B.extent(0); i++)
+    for (size_t j = 0; j < B.extent(1); j++)
+      Bh(i, j) = ScalarAB(float(int((i * 5 + j * 11) % 7) - 3));
+  for (int i = 0; i < M; i++)
+    for (int j = 0; j < N; j++) Ch(i, j) = float((i + 2 * j) % 5);
+  Kokkos::deep_copy(A, Ah);
+  Kokkos::deep_copy(B, Bh);
+  Kokkos::deep_copy(C, Ch);
+
+  const float alpha = 2.0f, beta = -1.0f;
+  KokkosBlas::gemm(TA, TB, ScalarAB(alpha), A, B, beta, C);
+
+  auto Cres = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), C);
+  for (int i = 0; i < M; i++) {
+    for (int j = 0; j < N; j++) {
+      float sum = 0.0f;
+      for (int k = 0; k < K; k++)
+        sum += float(A_t ? Ah(k, i) : Ah(i, k)) *
+               float(B_t ? Bh(j, k) : Bh(k, j));
+      ASSERT_EQ(Cres(i, j), beta * Ch(i, j) + alpha * sum)
+          << TA << TB << " C(" << i << ", " << j << ")";
+    }
+  }
+}
+
+template <class ScalarAB>
+void test_gemm_16bit_float() {
+  for (const char* TA : {"N", "T"}) {
+    for (const char* TB : {"N", "T"}) {
+      test_gemm_16bit_float<ScalarAB>(TA, TB, 1, 1, 1);
+      test_gemm_16bit_float<ScalarAB>(TA, TB, 64, 64, 32);
+      test_gemm_16bit_float<ScalarAB>(TA, TB, 100, 37, 75);
+    }
+  }
+}
+
+#if !defined(KOKKOSKERNELS_ETI_ONLY)
+TEST_F(TestCategory, gemm_half_float) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::gemm_half_float");
+  test_gemm_16bit_float<Kokkos::Experimental::half_t>();
+  Kokkos::Profiling::popRegion();
+}
+
+TEST_F(TestCategory, gemm_bhalf_float) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::gemm_bhalf_float");
+  test_gemm_16bit_float<Kokkos::Experimental::bhalf_t>();
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
 #if defined(KOKKOSKERNELS_INST_FLOAT) || \
     (!defined(KOKKOSKERNELS_ETI_ONLY) && \
      !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
@@ -433,6 +566,21 @@ TEST_F(TestCategory, gemm_double) {
   test_gemm_enabled_layouts<double>();
   Kokkos::Profiling::popRegion();
 }
+
+TEST_F(TestCategory, gemm_epilogue_double) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::gemm_epilogue_double");
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&      \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  test_gemm_epilogue<double, Kokkos::LayoutLeft>();
+#endif
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&       \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  test_gemm_epilogue<double, Kokkos::LayoutRight>();
+#endif
+  Kokkos::Profiling::popRegion();
+}
 #endif
 
 #if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE) || \
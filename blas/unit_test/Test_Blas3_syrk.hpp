@@ -0,0 +1,145 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+#include <KokkosBlas3_syrk.hpp>
+#include <KokkosBlas3_syr2k.hpp>
+#include <KokkosKernels_TestUtils.hpp>
+
+namespace Test {
+
+enum class SyrkKind { syrk, herk, syr2k };
+
+// Runs syrk, herk or syr2k on a random C and checks the updated triangle
+// against a host reference, and that the other triangle is untouched.
+template <class Scalar, class Layout, class Device>
+void impl_test_syrk(SyrkKind kind, const char* uplo, const char* trans, int N,
+                    int K) {
+  using execution_space = typename Device::execution_space;
+  using view_t          = Kokkos::View<Scalar**, Layout, Device>;
+  using AT              = Kokkos::ArithTraits<Scalar>;
+  using mag_t           = typename AT::mag_type;
+  const bool A_t        = trans[0] != 'N';
+  const bool lower      = uplo[0] == 'L';
+  const bool herm       = kind == SyrkKind::herk;
+
+  view_t A("A", A_t ? K : N, A_t ? N : K);
+  view_t B("B", A_t ? K : N, A_t ? N : K);
+  view_t C("C", N, N);
+  Kokkos::Random_XorShift64_Pool<execution_space> rand_pool(13718);
+  Kokkos::fill_random(A, rand_pool, Scalar(1));
+  Kokkos::fill_random(B, rand_pool, Scalar(1));
+  Kokkos::fill_random(C, rand_pool, Scalar(1));
+  auto Ah = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A);
+  auto Bh = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), B);
+  auto Ch = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), C);
+
+  const mag_t alpha(1.5), beta(-0.5);
+  if (kind == SyrkKind::syrk)
+    KokkosBlas::syrk(execution_space(), uplo, trans, Scalar(alpha), A,
+                     Scalar(beta), C);
+  else if (herm)
+    KokkosBlas::herk(execution_space(), uplo, trans, alpha, A, beta, C);
+  else
+    KokkosBlas::syr2k(execution_space(), uplo, trans, Scalar(alpha), A, B,
+                      Scalar(beta), C);
+  auto Cres = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), C);
+
+  // op(X)(i, k), conjugated for the second factor of herk
+  auto op = [&](const decltype(Ah)& X, int i, int k, bool second) {
+    Scalar x = A_t ? X(k, i) : X(i, k);
+    return herm && (A_t != second) ? AT::conj(x) : x;
+  };
+  const double tol = 10 * K * AT::epsilon();
+  for (int i = 0; i < N; i++) {
+    for (int j = 0; j < N; j++) {
+      if (lower ? j > i : j < i) {
+        ASSERT_EQ(Cres(i, j), Ch(i, j)) << "C(" << i << ", " << j << ")";
+        continue;
+      }
+      Scalar sum = AT::zero();
+      for (int k = 0; k < K; k++) {
+        if (kind == SyrkKind::syr2k)
+          sum += op(Ah, i, k, false) * op(Bh, j, k, true) +
+                 op(Bh, i, k, false) * op(Ah, j, k, true);
+        else
+          sum += op(Ah, i, k, false) * op(Ah, j, k, true);
+      }
+      Scalar expected = Scalar(beta) * Ch(i, j) + Scalar(alpha) * sum;
+      if (herm && i == j) expected = Scalar(AT::real(expected));
+      ASSERT_LE(AT::abs(Cres(i, j) - expected), tol)
+          << uplo << trans << " C(" << i << ", " << j << ")";
+    }
+  }
+}
+
+}  // namespace Test
+
+template <class Scalar, class Layout>
+void test_syrk() {
+  using Test::SyrkKind;
+  const bool is_complex = Kokkos::ArithTraits<Scalar>::is_complex;
+  for (SyrkKind kind : {SyrkKind::syrk, SyrkKind::herk, SyrkKind::syr2k}) {
+    const char* transT = kind == SyrkKind::herk && is_complex ? "C" : "T";
+    for (const char* uplo : {"L", "U"}) {
+      for (const char* trans : {"N", transT}) {
+        Test::impl_test_syrk<Scalar, Layout, TestDevice>(kind, uplo, trans, 1,
+                                                         1);
+        Test::impl_test_syrk<Scalar, Layout, TestDevice>(kind, uplo, trans, 13,
+                                                         0);
+        Test::impl_test_syrk<Scalar, Layout, TestDevice>(kind, uplo, trans, 45,
+                                                         17);
+        Test::impl_test_syrk<Scalar, Layout, TestDevice>(kind, uplo, trans, 70,
+                                                         130);
+      }
+    }
+  }
+}
+
+template <class Scalar>
+void test_syrk_enabled_layouts() {
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&      \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  test_syrk<Scalar, Kokkos::LayoutLeft>();
+#endif
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&       \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  test_syrk<Scalar, Kokkos::LayoutRight>();
+#endif
+}
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&  \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F(TestCategory, syrk_double) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::syrk_double");
+  test_syrk_enabled_layouts<double>();
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&          \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F(TestCategory, syrk_complex_double) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::syrk_complex_double");
+  test_syrk_enabled_layouts<Kokkos::complex<double>>();
+  Kokkos::Profiling::popRegion();
+}
+#endif
@@ -46,6 +46,26 @@ ELSE()
     TARGET_COMPILE_OPTIONS(benchmark_main PRIVATE -w)
 ENDIF()
 
+# GPU energy counters for the benchmarks (perf_test/Benchmark_Energy.hpp),
+# used when found. The host counters (RAPL) need no library.
+IF(KOKKOS_ENABLE_CUDA)
+    FIND_PACKAGE(CUDAToolkit QUIET)
+    IF(TARGET CUDA::nvml)
+        MESSAGE(STATUS "Benchmarks measure GPU energy with NVML")
+        SET(KOKKOSKERNELS_BENCHMARK_ENERGY_LIBRARY CUDA::nvml)
+        SET(KOKKOSKERNELS_BENCHMARK_ENERGY_DEFINE
+            KOKKOSKERNELS_BENCHMARK_ENABLE_NVML)
+    ENDIF()
+ELSEIF(KOKKOS_ENABLE_HIP)
+    FIND_PACKAGE(rocm_smi QUIET)
+    IF(TARGET rocm_smi64)
+        MESSAGE(STATUS "Benchmarks measure GPU energy with ROCm SMI")
+        SET(KOKKOSKERNELS_BENCHMARK_ENERGY_LIBRARY rocm_smi64)
+        SET(KOKKOSKERNELS_BENCHMARK_ENERGY_DEFINE
+            KOKKOSKERNELS_BENCHMARK_ENABLE_ROCM_SMI)
+    ENDIF()
+ENDIF()
+
 FUNCTION(KOKKOSKERNELS_ADD_BENCHMARK NAME)
     CMAKE_PARSE_ARGUMENTS(
         BENCHMARK
@@ -77,6 +97,16 @@ FUNCTION(KOKKOSKERNELS_ADD_BENCHMARK NAME)
         ${BENCHMARK_NAME}
         SYSTEM PRIVATE ${benchmark_SOURCE_DIR}/include
     )
+    IF(KOKKOSKERNELS_BENCHMARK_ENERGY_LIBRARY)
+        TARGET_LINK_LIBRARIES(
+            ${BENCHMARK_NAME}
+            PRIVATE ${KOKKOSKERNELS_BENCHMARK_ENERGY_LIBRARY}
+        )
+        TARGET_COMPILE_DEFINITIONS(
+            ${BENCHMARK_NAME}
+            PRIVATE ${KOKKOSKERNELS_BENCHMARK_ENERGY_DEFINE}
+        )
+    ENDIF()
 
     FOREACH(SOURCE_FILE ${BENCHMARK_SOURCES})
         SET_SOURCE_FILES_PROPERTIES(
@@ -40,6 +40,12 @@ SET(FLOATS
   DOUBLE
   COMPLEX_FLOAT
   COMPLEX_DOUBLE)
+# Kernels that accumulate 16-bit scalars in float (BLAS1 reductions and
+# updates, SpMV) are also instantiated for HALF and BHALF when enabled.
+SET(FLOATS_AND_16BIT
+  ${FLOATS}
+  HALF
+  BHALF)
 SET(DOUBLE_CPP_TYPE "double")
 SET(FLOAT_CPP_TYPE "float")
 SET(HALF_CPP_TYPE "Kokkos::Experimental::half_t")
@@ -14,12 +14,13 @@
 //
 //@HEADER
 
-#if KOKKOS_VERSION < 40199
 #ifndef KOKKOSKERNELS_HALF_HPP
 #define KOKKOSKERNELS_HALF_HPP
 
+#include <type_traits>
 #include "Kokkos_Core.hpp"
 
+#if KOKKOS_VERSION < 40199
 namespace KokkosKernels {
 namespace Experimental {
 ////////////// BEGIN FP16/binary16 limits //////////////
@@ -61,5 +62,21 @@ namespace Experimental {
 
 }  // namespace Experimental
 }  // namespace KokkosKernels
-#endif  // KOKKOSKERNELS_HALF_HPP
 #endif  // KOKKOS_VERSION < 40199
+
+namespace KokkosKernels {
+namespace Impl {
+
+/// \brief The type in which to accumulate sums of T: float for half_t and
+///   bhalf_t, whose partial sums lose too many digits to be usable in
+///   reductions and inner products, and T itself otherwise.
+template <class T>
+using accumulation_scalar_t = std::conditional_t<
+    std::is_same_v<std::remove_cv_t<T>, Kokkos::Experimental::half_t> ||
+        std::is_same_v<std::remove_cv_t<T>, Kokkos::Experimental::bhalf_t>,
+    float, std::remove_cv_t<T>>;
+
+}  // namespace Impl
+}  // namespace KokkosKernels
+
+#endif  // KOKKOSKERNELS_HALF_HPP
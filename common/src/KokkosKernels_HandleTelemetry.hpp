@@ -0,0 +1,105 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSKERNELS_HANDLETELEMETRY_HPP
+#define KOKKOSKERNELS_HANDLETELEMETRY_HPP
+
+#include <map>
+#include <string>
+#include <Kokkos_Core.hpp>
+
+namespace KokkosKernels {
+namespace Experimental {
+
+/// \brief Per-handle call counts and cumulative times, by phase.
+///
+/// Owned by the sparse handles (SPMVHandle, SPGEMMHandle, SPTRSVHandle,
+/// GMRESHandle). Recording is off by default because timing a phase fences
+/// the execution space; call enable() to turn it on. The phase names are
+/// chosen by the kernel, e.g. "symbolic", "numeric", "solve" or "spmv".
+class HandleTelemetry {
+ public:
+  struct PhaseStats {
+    size_t calls   = 0;
+    double seconds = 0.0;
+  };
+
+  void enable(bool enable_ = true) { enabled = enable_; }
+  bool is_enabled() const { return enabled; }
+
+  void record(const std::string &phase, double seconds_) {
+    PhaseStats &s = phases[phase];
+    s.calls++;
+    s.seconds += seconds_;
+  }
+
+  size_t get_call_count(const std::string &phase) const {
+    auto it = phases.find(phase);
+    return it == phases.end() ? 0 : it->second.calls;
+  }
+
+  double get_total_seconds(const std::string &phase) const {
+    auto it = phases.find(phase);
+    return it == phases.end() ? 0.0 : it->second.seconds;
+  }
+
+  const std::map<std::string, PhaseStats> &get_phases() const {
+    return phases;
+  }
+
+  void reset() { phases.clear(); }
+
+  /// \brief Times one phase of a kernel call, from construction to
+  /// destruction. Does nothing if telemetry is null or not enabled.
+  template <class ExecSpace>
+  class Scope {
+   public:
+    Scope(HandleTelemetry *telemetry_, const char *phase_,
+          const ExecSpace &space_)
+        : telemetry(telemetry_ && telemetry_->is_enabled() ? telemetry_
+                                                             : nullptr),
+          phase(phase_),
+          space(space_) {
+      if (telemetry) {
+        space.fence();
+        timer.reset();
+      }
+    }
+    ~Scope() {
+      if (telemetry) {
+        space.fence();
+        telemetry->record(phase, timer.seconds());
+      }
+    }
+    Scope(const Scope &)            = delete;
+    Scope &operator=(const Scope &) = delete;
+
+   private:
+    HandleTelemetry *telemetry;
+    const char *phase;
+    ExecSpace space;
+    Kokkos::Timer timer;
+  };
+
+ private:
+  bool enabled = false;
+  std::map<std::string, PhaseStats> phases;
+};
+
+}  // namespace Experimental
+}  // namespace KokkosKernels
+
+#endif  // KOKKOSKERNELS_HANDLETELEMETRY_HPP
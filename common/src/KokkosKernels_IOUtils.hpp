@@ -97,6 +97,19 @@ inline size_t kk_get_file_size(const char *file) {
   return retval == 0 ? size_t(stat_buf.st_size) : size_t(0);
 }
 
+// Last modification time of file, or -1 if it doesn't exist
+inline int64_t kk_get_file_mtime(const char *file) {
+#ifdef _WIN32
+  struct _stat stat_buf;
+  int retval = _stat(file, &stat_buf);
+#else
+  struct stat stat_buf;
+  int retval = stat(file, &stat_buf);
+#endif
+
+  return retval == 0 ? int64_t(stat_buf.st_mtime) : int64_t(-1);
+}
+
 template <typename lno_t>
 void buildEdgeListFromBinSrcTarg_undirected(const char *fnameSrc,
                                             const char *fnameTarg,
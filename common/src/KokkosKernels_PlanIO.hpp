@@ -0,0 +1,131 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSKERNELS_PLANIO_HPP
+#define KOKKOSKERNELS_PLANIO_HPP
+
+/// \file KokkosKernels_PlanIO.hpp
+/// \brief Binary reading and writing of the symbolic data ("plans") kept by
+/// the sparse handles, used by their save() and load() methods.
+///
+/// A plan starts with a magic number, a format version and the name of the
+/// handle kind, so that loading a plan into the wrong kind of handle fails.
+/// Views are written with their extent and the size of their value type, so
+/// that loading into views of another ordinal or offset type fails too. The
+/// data is written in the byte order of the machine that saves it.
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <Kokkos_Core.hpp>
+#include "KokkosKernels_Error.hpp"
+
+namespace KokkosKernels {
+namespace Impl {
+
+constexpr uint32_t plan_magic   = 0x4b4b504cU;  // "KKPL"
+constexpr uint32_t plan_version = 1U;
+
+template <class T>
+void write_plan_value(std::ostream &os, const T &value) {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "write_plan_value: T must be trivially copyable");
+  os.write(reinterpret_cast<const char *>(&value), sizeof(T));
+  if (!os) throw_runtime_exception("KokkosKernels: failed to write a plan");
+}
+
+template <class T>
+T read_plan_value(std::istream &is) {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "read_plan_value: T must be trivially copyable");
+  T value;
+  is.read(reinterpret_cast<char *>(&value), sizeof(T));
+  if (!is)
+    throw_runtime_exception("KokkosKernels: plan is truncated or unreadable");
+  return value;
+}
+
+inline void write_plan_header(std::ostream &os, const std::string &kind) {
+  write_plan_value(os, plan_magic);
+  write_plan_value(os, plan_version);
+  write_plan_value(os, static_cast<uint32_t>(kind.size()));
+  os.write(kind.data(), kind.size());
+}
+
+/// Throws unless the stream holds a plan of the given kind.
+inline void read_plan_header(std::istream &is, const std::string &kind) {
+  if (read_plan_value<uint32_t>(is) != plan_magic)
+    throw_runtime_exception("KokkosKernels: not a Kokkos Kernels plan");
+  if (read_plan_value<uint32_t>(is) != plan_version)
+    throw_runtime_exception("KokkosKernels: unsupported plan version");
+  std::string saved(read_plan_value<uint32_t>(is), '\0');
+  is.read(&saved[0], saved.size());
+  if (!is || saved != kind)
+    throw_runtime_exception("KokkosKernels: expected a plan for " + kind +
+                            ", got one for " + saved);
+}
+
+/// Write a rank-1 view, which may live in any memory space. An
+/// unallocated view is written as such.
+template <class View>
+void write_plan_view(std::ostream &os, const View &v) {
+  static_assert(View::rank() == 1, "write_plan_view: View must be rank 1");
+  using value_type = typename View::non_const_value_type;
+  write_plan_value(os, static_cast<uint8_t>(v.is_allocated()));
+  write_plan_value(os, static_cast<uint32_t>(sizeof(value_type)));
+  write_plan_value(os, static_cast<uint64_t>(v.extent(0)));
+  if (!v.is_allocated()) return;
+  auto h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), v);
+  os.write(reinterpret_cast<const char *>(h.data()),
+           sizeof(value_type) * h.extent(0));
+  if (!os) throw_runtime_exception("KokkosKernels: failed to write a plan");
+}
+
+/// Read a rank-1 view written by write_plan_view. The view keeps its
+/// allocation if the extent matches, and is reallocated otherwise (so it
+/// must then be a managed view).
+template <class View>
+void read_plan_view(std::istream &is, View &v) {
+  static_assert(View::rank() == 1, "read_plan_view: View must be rank 1");
+  using value_type      = typename View::non_const_value_type;
+  const bool allocated  = read_plan_value<uint8_t>(is) != 0;
+  const uint32_t nbytes = read_plan_value<uint32_t>(is);
+  const uint64_t n      = read_plan_value<uint64_t>(is);
+  if (nbytes != sizeof(value_type))
+    throw_runtime_exception(
+        "KokkosKernels: plan was saved with different ordinal, offset or "
+        "scalar types");
+  if (!allocated) {
+    v = View();
+    return;
+  }
+  if (!v.is_allocated() || v.extent(0) != n)
+    v = View(Kokkos::view_alloc(Kokkos::WithoutInitializing,
+                                v.is_allocated() ? v.label() : "plan"),
+             n);
+  auto h = Kokkos::create_mirror_view(Kokkos::HostSpace(), v);
+  is.read(reinterpret_cast<char *>(h.data()), sizeof(value_type) * n);
+  if (!is)
+    throw_runtime_exception("KokkosKernels: plan is truncated or unreadable");
+  Kokkos::deep_copy(v, h);
+}
+
+}  // namespace Impl
+}  // namespace KokkosKernels
+
+#endif  // KOKKOSKERNELS_PLANIO_HPP
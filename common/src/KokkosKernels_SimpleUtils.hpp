@@ -258,14 +258,21 @@ inline void kk_reduce_view(size_t num_elements, view_t arr,
 }
 
 template <typename view_t, typename MyExecSpace>
-inline void kk_reduce_view2(size_t num_elements, view_t arr,
-                            size_t &reduction) {
+inline void kk_reduce_view2(const MyExecSpace &exec, size_t num_elements,
+                            view_t arr, size_t &reduction) {
   typedef Kokkos::RangePolicy<MyExecSpace> my_exec_space;
   Kokkos::parallel_reduce("KokkosKernels::Common::ReduceView2",
-                          my_exec_space(0, num_elements),
+                          my_exec_space(exec, 0, num_elements),
                           ReductionFunctor2<view_t>(arr), reduction);
 }
 
+template <typename view_t, typename MyExecSpace>
+inline void kk_reduce_view2(size_t num_elements, view_t arr,
+                            size_t &reduction) {
+  kk_reduce_view2<view_t, MyExecSpace>(MyExecSpace(), num_elements, arr,
+                                       reduction);
+}
+
 template <typename view_type1, typename view_type2,
           typename eps_type = typename Kokkos::ArithTraits<
               typename view_type2::non_const_value_type>::mag_type>
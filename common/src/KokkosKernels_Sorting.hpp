@@ -19,6 +19,8 @@
 #include "Kokkos_Core.hpp"
 #include "KokkosKernels_SimpleUtils.hpp"  //for kk_exclusive_parallel_prefix_sum
 #include "KokkosKernels_ExecSpaceUtils.hpp"  //for kk_is_gpu_exec_space
+#include <algorithm>
+#include <stdexcept>
 #include <type_traits>
 
 namespace KokkosKernels {
@@ -44,6 +46,19 @@ template <
     typename Comparator = Impl::DefaultComparator<typename View::value_type>>
 void bitonicSort(View v, const Comparator& comp = Comparator());
 
+// Radix sort: stable parallel least significant digit radix sort of keys on
+// exec, 8 bits per pass. Passes over digits that are the same for all keys are
+// skipped. Key must be an integer type. Not in-place: allocates an auxiliary
+// array the size of keys.
+template <typename ExecSpace, typename KeyView>
+void radixSort(const ExecSpace& exec, const KeyView& keys);
+
+// Same as radixSort, but also permutes values along with keys. values must
+// have the same size as keys.
+template <typename ExecSpace, typename KeyView, typename ValueView>
+void radixSort(const ExecSpace& exec, const KeyView& keys,
+               const ValueView& values);
+
 // --------------------------------------------------------
 // Serial sorting (callable inside any kernel or host code)
 // --------------------------------------------------------
@@ -268,6 +283,221 @@ void bitonicSort(View v, const Comparator& comp) {
   }
 }
 
+namespace Impl {
+
+// Maps integer keys to unsigned integers with the same order
+template <typename Key>
+struct RadixKeyTraits {
+  static_assert(std::is_integral_v<Key> && !std::is_same_v<Key, bool>,
+                "radixSort can only be run on integers.");
+  using bits_t                 = std::make_unsigned_t<Key>;
+  static constexpr int numBits = 8 * sizeof(Key);
+
+  KOKKOS_INLINE_FUNCTION static bits_t bits(const Key k) {
+    bits_t b = static_cast<bits_t>(k);
+    // flip the sign bit, so that negative keys come first
+    if constexpr (std::is_signed_v<Key>) b ^= bits_t(1) << (numBits - 1);
+    return b;
+  }
+};
+
+// Device-wide LSD radix sort. The keys are split into contiguous chunks, each
+// counted and scattered by one thread: each pass counts the keys of every
+// chunk in every bucket, prefix sums the counts (bucket-major, so that each
+// chunk gets its first output position in each bucket), and scatters the
+// chunks in order, which keeps the sort stable. Keys and values ping-pong
+// between the input views and auxiliary arrays.
+template <typename ExecSpace, typename KeyView, typename ValueView>
+struct DeviceRadixSort {
+  using key_t        = typename KeyView::non_const_value_type;
+  using value_t      = typename ValueView::non_const_value_type;
+  using traits       = RadixKeyTraits<key_t>;
+  using bits_t       = typename traits::bits_t;
+  using size_type    = size_t;
+  using mem_space    = typename KeyView::memory_space;
+  using device_t     = Kokkos::Device<ExecSpace, mem_space>;
+  using key_buf_t    = Kokkos::View<key_t*, device_t>;
+  using value_buf_t  = Kokkos::View<value_t*, device_t>;
+  using counts_t     = Kokkos::View<size_type*, device_t>;
+  using range_policy = Kokkos::RangePolicy<ExecSpace>;
+
+  static constexpr int radixBits  = 8;
+  static constexpr int numBuckets = 1 << radixBits;
+  // Chunking: on GPUs, at least minGpuChunk keys per thread and at most
+  // maxGpuChunks threads, to bound the size of the counts. On the host, one
+  // chunk per thread, of at least minHostChunk keys.
+  static constexpr size_type minGpuChunk  = 1024;
+  static constexpr size_type maxGpuChunks = 65536;
+  static constexpr size_type minHostChunk = 16384;
+
+  KOKKOS_INLINE_FUNCTION static int digit(const key_t k, const int shift) {
+    return (traits::bits(k) >> shift) & (numBuckets - 1);
+  }
+
+  // The bits where the keys differ from the first key
+  struct DiffFunctor {
+    DiffFunctor(const KeyView& keys_) : keys(keys_) {}
+
+    KOKKOS_INLINE_FUNCTION void operator()(size_type i, bits_t& ldiff) const {
+      ldiff |= traits::bits(keys(i)) ^ traits::bits(keys(0));
+    }
+
+    KeyView keys;
+  };
+
+  template <typename SrcKeys>
+  struct CountFunctor {
+    CountFunctor(const SrcKeys& keys_, const counts_t& counts_,
+                 size_type chunkSize_, size_type numChunks_, int shift_)
+        : keys(keys_),
+          counts(counts_),
+          chunkSize(chunkSize_),
+          numChunks(numChunks_),
+          shift(shift_) {}
+
+    KOKKOS_INLINE_FUNCTION void operator()(size_type chunk) const {
+      size_type local[numBuckets] = {0};
+      size_type begin             = chunk * chunkSize;
+      size_type end               = begin + chunkSize;
+      if (end > keys.extent(0)) end = keys.extent(0);
+      for (size_type i = begin; i < end; i++) local[digit(keys(i), shift)]++;
+      for (int b = 0; b < numBuckets; b++)
+        counts(b * numChunks + chunk) = local[b];
+    }
+
+    SrcKeys keys;
+    counts_t counts;
+    size_type chunkSize;
+    size_type numChunks;
+    int shift;
+  };
+
+  // values may be empty to sort only keys
+  template <typename SrcKeys, typename SrcValues, typename DstKeys,
+            typename DstValues>
+  struct ScatterFunctor {
+    ScatterFunctor(const SrcKeys& srcKeys_, const SrcValues& srcValues_,
+                   const DstKeys& dstKeys_, const DstValues& dstValues_,
+                   const counts_t& offsets_, size_type chunkSize_,
+                   size_type numChunks_, int shift_)
+        : srcKeys(srcKeys_),
+          srcValues(srcValues_),
+          dstKeys(dstKeys_),
+          dstValues(dstValues_),
+          offsets(offsets_),
+          chunkSize(chunkSize_),
+          numChunks(numChunks_),
+          shift(shift_) {}
+
+    KOKKOS_INLINE_FUNCTION void operator()(size_type chunk) const {
+      size_type local[numBuckets];
+      for (int b = 0; b < numBuckets; b++)
+        local[b] = offsets(b * numChunks + chunk);
+      size_type begin = chunk * chunkSize;
+      size_type end   = begin + chunkSize;
+      if (end > srcKeys.extent(0)) end = srcKeys.extent(0);
+      for (size_type i = begin; i < end; i++) {
+        size_type pos = local[digit(srcKeys(i), shift)]++;
+        dstKeys(pos)  = srcKeys(i);
+        if (srcValues.extent(0)) dstValues(pos) = srcValues(i);
+      }
+    }
+
+    SrcKeys srcKeys;
+    SrcValues srcValues;
+    DstKeys dstKeys;
+    DstValues dstValues;
+    counts_t offsets;
+    size_type chunkSize;
+    size_type numChunks;
+    int shift;
+  };
+
+  template <typename SrcKeys, typename SrcValues, typename DstKeys,
+            typename DstValues>
+  static void pass(const ExecSpace& exec, const SrcKeys& srcKeys,
+                   const SrcValues& srcValues, const DstKeys& dstKeys,
+                   const DstValues& dstValues, const counts_t& counts,
+                   size_type chunkSize, size_type numChunks, int shift) {
+    Kokkos::parallel_for(
+        "KokkosKernels::RadixSort::Count", range_policy(exec, 0, numChunks),
+        CountFunctor<SrcKeys>(srcKeys, counts, chunkSize, numChunks, shift));
+    kk_exclusive_parallel_prefix_sum<ExecSpace>(exec, counts.extent(0),
+                                                counts);
+    Kokkos::parallel_for(
+        "KokkosKernels::RadixSort::Scatter", range_policy(exec, 0, numChunks),
+        ScatterFunctor<SrcKeys, SrcValues, DstKeys, DstValues>(
+            srcKeys, srcValues, dstKeys, dstValues, counts, chunkSize,
+            numChunks, shift));
+  }
+
+  static void sort(const ExecSpace& exec, const KeyView& keys,
+                   const ValueView& values) {
+    const size_type n = keys.extent(0);
+    if (n <= 1) return;
+    bits_t diff = 0;
+    Kokkos::parallel_reduce("KokkosKernels::RadixSort::Diff",
+                            range_policy(exec, 0, n), DiffFunctor(keys),
+                            Kokkos::BOr<bits_t>(diff));
+    if (!diff) return;
+    size_type numChunks;
+    if constexpr (kk_is_gpu_exec_space<ExecSpace>()) {
+      numChunks = std::min((n + minGpuChunk - 1) / minGpuChunk, maxGpuChunks);
+    } else {
+      numChunks = std::min<size_type>(exec.concurrency(),
+                                      (n + minHostChunk - 1) / minHostChunk);
+      if (!numChunks) numChunks = 1;
+    }
+    const size_type chunkSize = (n + numChunks - 1) / numChunks;
+    numChunks                 = (n + chunkSize - 1) / chunkSize;
+    key_buf_t auxKeys(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "Radix sort keys"), n);
+    value_buf_t auxValues(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "Radix sort values"),
+        values.extent(0));
+    counts_t counts(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "Radix sort counts"),
+        numBuckets * numChunks);
+    // Is the data currently held in keys (false) or auxKeys (true)?
+    bool inAux = false;
+    for (int shift = 0; shift < traits::numBits; shift += radixBits) {
+      if (!((diff >> shift) & (numBuckets - 1))) continue;
+      if (inAux)
+        pass(exec, auxKeys, auxValues, keys, values, counts, chunkSize,
+             numChunks, shift);
+      else
+        pass(exec, keys, values, auxKeys, auxValues, counts, chunkSize,
+             numChunks, shift);
+      inAux = !inAux;
+    }
+    if (inAux) {
+      Kokkos::deep_copy(exec, keys, auxKeys);
+      if (values.extent(0)) Kokkos::deep_copy(exec, values, auxValues);
+    }
+  }
+};
+
+}  // namespace Impl
+
+template <typename ExecSpace, typename KeyView>
+void radixSort(const ExecSpace& exec, const KeyView& keys) {
+  using no_values_t =
+      Kokkos::View<typename KeyView::non_const_value_type*,
+                   Kokkos::Device<ExecSpace, typename KeyView::memory_space>>;
+  Impl::DeviceRadixSort<ExecSpace, KeyView, no_values_t>::sort(exec, keys,
+                                                               no_values_t());
+}
+
+template <typename ExecSpace, typename KeyView, typename ValueView>
+void radixSort(const ExecSpace& exec, const KeyView& keys,
+               const ValueView& values) {
+  if (values.extent(0) != keys.extent(0))
+    throw std::invalid_argument(
+        "radixSort: keys and values must have the same size");
+  Impl::DeviceRadixSort<ExecSpace, KeyView, ValueView>::sort(exec, keys,
+                                                             values);
+}
+
 // Radix sort for integers, on a single thread within a team.
 // Pros: few diverging branches, so OK for sorting on a single GPU vector lane.
 // Better on CPU cores. Con: requires auxiliary storage, and this version only
@@ -0,0 +1,88 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSKERNELS_TPLHANDLECACHE_HPP
+#define KOKKOSKERNELS_TPLHANDLECACHE_HPP
+
+#include <map>
+#include <mutex>
+#include <Kokkos_Core.hpp>
+
+namespace KokkosKernels {
+namespace Impl {
+
+/// \brief Process-wide map from a device stream to a TPL library handle
+/// (cuBLAS, cuSPARSE, rocBLAS, rocSPARSE) that is bound to that stream.
+///
+/// The first lookup for a stream creates a handle and binds it to the
+/// stream; later lookups return the same handle, so callers do not need to
+/// set and reset the stream of a shared handle around every call. All the
+/// handles are destroyed by a Kokkos finalize hook. Lookups are guarded by a
+/// mutex, so host threads driving different execution space instances can
+/// share one cache.
+template <typename Stream, typename Handle>
+class TplHandleCache {
+ public:
+  using create_type  = void (*)(Handle *);
+  using bind_type    = void (*)(Handle, Stream);
+  using destroy_type = void (*)(Handle);
+
+  TplHandleCache(create_type create_, bind_type bind_, destroy_type destroy_)
+      : create(create_), bind(bind_), destroy(destroy_) {}
+
+  TplHandleCache(const TplHandleCache &) = delete;
+  TplHandleCache &operator=(const TplHandleCache &) = delete;
+
+  /// The handle bound to stream, created on first use
+  Handle get(Stream stream) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = handles.find(stream);
+    if (it != handles.end()) return it->second;
+    // Register the cleanup with the first handle, so the cache is emptied
+    // at every finalize if Kokkos is initialized more than once
+    if (handles.empty()) Kokkos::push_finalize_hook([this]() { clear(); });
+    Handle h;
+    create(&h);
+    bind(h, stream);
+    handles.emplace(stream, h);
+    return h;
+  }
+
+  /// Number of streams that currently have a handle
+  size_t size() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return handles.size();
+  }
+
+  /// Destroy all the handles. Called at Kokkos::finalize.
+  void clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto &entry : handles) destroy(entry.second);
+    handles.clear();
+  }
+
+ private:
+  create_type create;
+  bind_type bind;
+  destroy_type destroy;
+  mutable std::mutex mutex;
+  std::map<Stream, Handle> handles;
+};
+
+}  // namespace Impl
+}  // namespace KokkosKernels
+
+#endif  // KOKKOSKERNELS_TPLHANDLECACHE_HPP
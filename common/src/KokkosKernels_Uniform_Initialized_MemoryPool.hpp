@@ -18,13 +18,18 @@
 
 #include <Kokkos_Core.hpp>
 #include "KokkosKernels_Utils.hpp"
+#include <algorithm>
 #include <iostream>
 
 namespace KokkosKernels {
 
 namespace Impl {
 
-enum PoolType { OneThread2OneChunk, ManyThread2OneChunk };
+enum PoolType {
+  OneThread2OneChunk,
+  ManyThread2OneChunk,
+  CachedManyThread2OneChunk
+};
 
 /*! \brief Class for simple memory pool allocations.
  *  At the constructor, we set the number of chunks and the size of a chunk,
@@ -142,6 +147,18 @@ enum PoolType { OneThread2OneChunk, ManyThread2OneChunk };
  *  This is not guaranteed by ManyThread2OneChunk, but as long as threads reset
  the memory they use, it will guarantee a memory
  *  that is has been initialized.
+ *
+ *  CachedManyThread2OneChunk: Same contract as ManyThread2OneChunk, without its
+ *  linear probing over the locks of all the chunks, which contends badly when
+ *  the pool is nearly exhausted. Half of the chunks are held in small caches
+ *  of CACHE_SIZE slots, one cache per CACHE_SIZE consecutive thread indices
+ *  (i.e. per team, when thread indices are numbered by team), and the others
+ *  in a lock-free global stack. A thread takes a chunk from its cache, else
+ *  from the stack, else from the other caches, and a released chunk goes back
+ *  to the cache of the thread that allocated it, or to the stack if that
+ *  cache is full. With track_stats, the pool also counts the chunks in use
+ *  (see get_high_water_mark) and the failed atomic operations (see
+ *  get_contention_count).
  */
 template <typename MyExecSpace, typename data_type>
 class UniformMemoryPool {
@@ -149,6 +166,18 @@ class UniformMemoryPool {
   typedef int lock_type;
   typedef typename Kokkos::View<lock_type *, MyExecSpace> lock_view_t;
   typedef typename Kokkos::View<data_type *, MyExecSpace> data_view_t;
+  // the head of the global stack of CachedManyThread2OneChunk: a chunk index
+  // in the low 32 bits, and a tag incremented by each update in the high 32
+  // bits, so that a stale head never compares equal (no ABA problem)
+  typedef unsigned long long stack_head_type;
+  typedef typename Kokkos::View<stack_head_type *, MyExecSpace> counter_view_t;
+
+  static constexpr size_t CACHE_SIZE          = 8;
+  static constexpr lock_type EMPTY_SLOT       = -1;
+  static constexpr stack_head_type INDEX_MASK = 0xFFFFFFFFull;
+  static constexpr int STAT_IN_USE            = 0;
+  static constexpr int STAT_HIGH_WATER        = 1;
+  static constexpr int STAT_CONTENTION        = 2;
 
   size_t num_chunks;
   size_t num_set_chunks;
@@ -165,6 +194,15 @@ class UniformMemoryPool {
   data_type *data;
   PoolType pool_type;
 
+  // CachedManyThread2OneChunk
+  size_t num_caches;
+  lock_view_t cache_slots;
+  lock_view_t chunk_owners;
+  lock_view_t stack_nexts;
+  counter_view_t stack_head;
+  counter_view_t stats;
+  bool track_stats;
+
  public:
   using execution_space = typename MyExecSpace::execution_space;
   using memory_space    = typename MyExecSpace::memory_space;
@@ -174,12 +212,15 @@ class UniformMemoryPool {
    * \param num_chunks_: number of chunks. This will be rounded to minimum pow2
    * number. \param chunk_size_: chunk size, the size of each allocation. \param
    * initialized_value: the value to initialize \param pool_type_: whether
-   * ManyThread2OneChunk or OneThread2OneChunk
+   * ManyThread2OneChunk, CachedManyThread2OneChunk or OneThread2OneChunk
+   * \param track_stats_: for CachedManyThread2OneChunk, whether to count the
+   * chunks in use and the contention
    */
   UniformMemoryPool(const size_t num_chunks_, const size_t set_chunk_size_,
                     const data_type initialized_value = 0,
                     const PoolType pool_type_         = OneThread2OneChunk,
-                    bool initialize                   = true)
+                    bool initialize                   = true,
+                    bool track_stats_                 = false)
       : num_chunks(1),
         num_set_chunks(num_chunks_),
         modular_num_chunks(0),
@@ -192,7 +233,14 @@ class UniformMemoryPool {
         pchunk_locks(),
         data_view(),
         data(),
-        pool_type(pool_type_) {
+        pool_type(pool_type_),
+        num_caches(1),
+        cache_slots(),
+        chunk_owners(),
+        stack_nexts(),
+        stack_head(),
+        stats(),
+        track_stats(track_stats_) {
     num_chunks = 1;
     while (num_set_chunks > num_chunks) {
       num_chunks *= 2;
@@ -229,7 +277,14 @@ class UniformMemoryPool {
         pchunk_locks(),
         data_view(),
         data(),
-        pool_type() {}
+        pool_type(),
+        num_caches(1),
+        cache_slots(),
+        chunk_owners(),
+        stack_nexts(),
+        stack_head(),
+        stats(),
+        track_stats(false) {}
 
   ~UniformMemoryPool() = default;
 
@@ -240,17 +295,77 @@ class UniformMemoryPool {
 
   /**
    * \brief To set the pool type
-   * \param pool_type_: whether ManyThread2OneChunk or OneThread2OneChunk
+   * \param pool_type_: whether ManyThread2OneChunk, CachedManyThread2OneChunk
+   * or OneThread2OneChunk
    */
   void set_pool_type(PoolType pool_type_) {
+    pool_type = pool_type_;
     if (pool_type_ == ManyThread2OneChunk) {
       if (num_set_chunks) {
         chunk_locks = lock_view_t("locks", num_chunks);
       }
       pchunk_locks = chunk_locks.data();
+    } else if (pool_type_ == CachedManyThread2OneChunk) {
+      this->init_caches();
     }
   }
 
+  /**
+   * \brief Sets up the caches and the global stack of
+   * CachedManyThread2OneChunk: the first half of the chunks fill the caches,
+   * and the others are pushed on the stack.
+   */
+  void init_caches() {
+    num_caches = num_chunks / (2 * CACHE_SIZE);
+    if (num_caches == 0) num_caches = 1;
+    const size_t num_cached =
+        num_set_chunks ? std::min(num_caches * CACHE_SIZE, num_chunks / 2) : 0;
+    const size_t num_stacked = num_set_chunks ? num_chunks - num_cached : 0;
+    cache_slots  = lock_view_t("cache slots", num_caches * CACHE_SIZE);
+    chunk_owners = lock_view_t("chunk owners", num_chunks);
+    stack_nexts  = lock_view_t("stack nexts", num_chunks);
+    stack_head   = counter_view_t("stack head", 1);
+    auto slots_h = Kokkos::create_mirror_view(cache_slots);
+    auto nexts_h = Kokkos::create_mirror_view(stack_nexts);
+    for (size_t i = 0; i < slots_h.extent(0); i++)
+      slots_h(i) = i < num_cached ? lock_type(i) : EMPTY_SLOT;
+    for (size_t i = 0; i < nexts_h.extent(0); i++)
+      nexts_h(i) = i + 1 < num_chunks ? lock_type(i + 1) : EMPTY_SLOT;
+    Kokkos::deep_copy(cache_slots, slots_h);
+    Kokkos::deep_copy(stack_nexts, nexts_h);
+    Kokkos::deep_copy(stack_head,
+                      num_stacked ? stack_head_type(num_cached) : INDEX_MASK);
+    if (track_stats) stats = counter_view_t("pool stats", 3);
+  }
+
+  /**
+   * \brief The largest number of chunks in use at the same time, for
+   * CachedManyThread2OneChunk with track_stats (0 otherwise).
+   */
+  size_t get_high_water_mark() const {
+    return this->get_stat(STAT_HIGH_WATER);
+  }
+
+  /**
+   * \brief The number of failed atomic operations (retries) on the caches and
+   * on the global stack, for CachedManyThread2OneChunk with track_stats (0
+   * otherwise).
+   */
+  size_t get_contention_count() const {
+    return this->get_stat(STAT_CONTENTION);
+  }
+
+  /**
+   * \brief Resets the high-water mark to the number of chunks in use, and the
+   * contention count to 0.
+   */
+  void reset_stats() {
+    if (!stats.extent(0)) return;
+    Kokkos::deep_copy(Kokkos::subview(stats, STAT_HIGH_WATER),
+                      Kokkos::subview(stats, STAT_IN_USE));
+    Kokkos::deep_copy(Kokkos::subview(stats, STAT_CONTENTION), 0);
+  }
+
   /**
    * \brief Print the content of memory pool
    */
@@ -264,6 +379,13 @@ class UniformMemoryPool {
     // print_1Dview(free_chunks, print_all);
     std::cout << "Printing chunk_locks view" << std::endl;
     print_1Dview(chunk_locks, print_all);
+    if (pool_type == CachedManyThread2OneChunk) {
+      std::cout << "num_caches:" << num_caches << std::endl;
+      std::cout << "high_water_mark:" << get_high_water_mark() << std::endl;
+      std::cout << "contention_count:" << get_contention_count() << std::endl;
+      std::cout << "Printing cache_slots view" << std::endl;
+      print_1Dview(cache_slots, print_all);
+    }
     std::cout << "Printing data view" << std::endl;
     print_1Dview(data_view, print_all);
   }
@@ -310,6 +432,30 @@ class UniformMemoryPool {
     return data + chunk_index * chunk_size;
   }
 
+  /**
+   * \brief Returns a free chunk, or NULL if there is none, for mode:
+   * CachedManyThread2OneChunk. The chunk is taken from the cache of
+   * thread_index, else from the global stack, else from the other caches.
+   */
+  KOKKOS_INLINE_FUNCTION
+  data_type *get_cached_free_chunk(const size_t &thread_index) const {
+    const size_t cache    = (thread_index / CACHE_SIZE) & (num_caches - 1);
+    lock_type chunk_index = this->take_from_cache(cache, thread_index);
+    if (chunk_index == EMPTY_SLOT) chunk_index = this->pop_free_chunk();
+    for (size_t c = 1; chunk_index == EMPTY_SLOT && c < num_caches; c++) {
+      chunk_index =
+          this->take_from_cache((cache + c) & (num_caches - 1), thread_index);
+    }
+    if (chunk_index == EMPTY_SLOT) return NULL;
+    chunk_owners(chunk_index) = cache;
+    if (stats.extent(0)) {
+      stack_head_type in_use =
+          Kokkos::atomic_fetch_add(&stats(STAT_IN_USE), 1ull) + 1;
+      Kokkos::atomic_max(&stats(STAT_HIGH_WATER), in_use);
+    }
+    return data + chunk_index * chunk_size;
+  }
+
   /**
    * \brief Returns the unique memory location for thread.
    */
@@ -323,6 +469,8 @@ class UniformMemoryPool {
       case ManyThread2OneChunk:
         // printf("ManyThread2OneChunk alloc for :%ld\n", thread_index);
         return this->get_arbitrary_free_chunk(thread_index, num_chunks);
+      case CachedManyThread2OneChunk:
+        return this->get_cached_free_chunk(thread_index);
     }
   }
 
@@ -340,6 +488,29 @@ class UniformMemoryPool {
     chunk_locks(alloc_index) = 0;
   }
 
+  /**
+   * \brief Releases the memory that has been allocated, for mode:
+   * CachedManyThread2OneChunk. The chunk goes back to the cache it was
+   * allocated for, or to the global stack if that cache is full.
+   */
+  KOKKOS_INLINE_FUNCTION
+  void release_cached_chunk(const data_type *chunk_ptr) const {
+    const lock_type chunk_index = this->get_chunk_index(chunk_ptr);
+    lock_type *slots =
+        cache_slots.data() + chunk_owners(chunk_index) * CACHE_SIZE;
+    if (stats.extent(0)) Kokkos::atomic_fetch_sub(&stats(STAT_IN_USE), 1ull);
+    // make the reset of the chunk visible before it can be taken again
+    Kokkos::memory_fence();
+    for (size_t s = 0; s < CACHE_SIZE; s++) {
+      lock_type *slot = slots + ((chunk_index + s) & (CACHE_SIZE - 1));
+      if (Kokkos::atomic_load(slot) != EMPTY_SLOT) continue;
+      if (Kokkos::atomic_compare_exchange_strong(slot, EMPTY_SLOT, chunk_index))
+        return;
+      this->count_contention();
+    }
+    this->push_free_chunk(chunk_index);
+  }
+
   /**
    * \brief Returns the chunk index of the pointer.
    */
@@ -357,6 +528,75 @@ class UniformMemoryPool {
       default:
       case OneThread2OneChunk: break;
       case ManyThread2OneChunk: return this->release_arbitrary_chunk(chunk_ptr);
+      case CachedManyThread2OneChunk:
+        return this->release_cached_chunk(chunk_ptr);
+    }
+  }
+
+ private:
+  size_t get_stat(int stat) const {
+    if (!stats.extent(0)) return 0;
+    stack_head_type value;
+    Kokkos::deep_copy(value, Kokkos::subview(stats, stat));
+    return value;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void count_contention() const {
+    if (stats.extent(0)) Kokkos::atomic_inc(&stats(STAT_CONTENTION));
+  }
+
+  // Takes a chunk from a cache, scanning its slots from the one of
+  // thread_index, so that the threads of a cache start on different slots.
+  // Returns EMPTY_SLOT if the cache is empty.
+  KOKKOS_INLINE_FUNCTION
+  lock_type take_from_cache(const size_t cache,
+                            const size_t &thread_index) const {
+    lock_type *slots = cache_slots.data() + cache * CACHE_SIZE;
+    for (size_t s = 0; s < CACHE_SIZE; s++) {
+      lock_type *slot       = slots + ((thread_index + s) & (CACHE_SIZE - 1));
+      lock_type chunk_index = Kokkos::atomic_load(slot);
+      if (chunk_index == EMPTY_SLOT) continue;
+      if (Kokkos::atomic_compare_exchange_strong(slot, chunk_index, EMPTY_SLOT))
+        return chunk_index;
+      this->count_contention();
+    }
+    return EMPTY_SLOT;
+  }
+
+  // Pops a chunk from the global stack, or returns EMPTY_SLOT if it is empty
+  KOKKOS_INLINE_FUNCTION
+  lock_type pop_free_chunk() const {
+    stack_head_type *head = stack_head.data();
+    stack_head_type old   = Kokkos::atomic_load(head);
+    while ((old & INDEX_MASK) != INDEX_MASK) {
+      const lock_type chunk_index = lock_type(old & INDEX_MASK);
+      const stack_head_type next =
+          stack_head_type(stack_nexts(chunk_index)) & INDEX_MASK;
+      const stack_head_type desired = ((((old >> 32) + 1) << 32) | next);
+      const stack_head_type prev =
+          Kokkos::atomic_compare_exchange(head, old, desired);
+      if (prev == old) return chunk_index;
+      this->count_contention();
+      old = prev;
+    }
+    return EMPTY_SLOT;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void push_free_chunk(const lock_type chunk_index) const {
+    stack_head_type *head = stack_head.data();
+    stack_head_type old   = Kokkos::atomic_load(head);
+    while (true) {
+      stack_nexts(chunk_index) = lock_type(old & INDEX_MASK);
+      Kokkos::memory_fence();
+      const stack_head_type desired =
+          ((((old >> 32) + 1) << 32) | stack_head_type(chunk_index));
+      const stack_head_type prev =
+          Kokkos::atomic_compare_exchange(head, old, desired);
+      if (prev == old) return;
+      this->count_contention();
+      old = prev;
     }
   }
 };
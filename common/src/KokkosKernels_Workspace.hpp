@@ -0,0 +1,182 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSKERNELS_WORKSPACE_HPP
+#define KOKKOSKERNELS_WORKSPACE_HPP
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <Kokkos_Core.hpp>
+#include "KokkosKernels_Error.hpp"
+
+namespace KokkosKernels {
+namespace Experimental {
+
+/// \brief Arena of scratch memory in MemorySpace that kernel handles draw
+/// their temporaries from, so that repeated calls (and several handles)
+/// reuse one buffer instead of allocating and freeing views at every call.
+///
+/// A handle is given a pointer to the workspace (e.g.
+/// GMRESHandle::set_workspace) and a kernel call draws its views through a
+/// Scope, which returns them when it ends. Scopes nest in LIFO order, e.g.
+/// a solver calling another kernel. A view that does not fit in the buffer
+/// gets its own allocation, and the most memory drawn at once is recorded:
+/// when the last active scope ends, the buffer grows to this high-water
+/// mark. So only the first calls allocate, and the steady state of a loop
+/// of solves does no allocation at all.
+///
+/// Copies of a Workspace share the same arena. It is meant for the host
+/// thread driving the kernels and is not thread safe.
+template <class MemorySpace>
+class Workspace {
+ public:
+  using memory_space = MemorySpace;
+  using buffer_type  = Kokkos::View<char *, memory_space>;
+
+  //! Each view starts on a multiple of this many bytes
+  static constexpr size_t alignment = 128;
+
+  explicit Workspace(const size_t bytes = 0)
+      : state(std::make_shared<State>()) {
+    reserve(bytes);
+  }
+
+  //! Grows the buffer to at least bytes; no scope may be active
+  void reserve(const size_t bytes) {
+    if (bytes <= state->buffer.extent(0)) return;
+    KK_REQUIRE_MSG(state->active_scopes == 0,
+                   "Workspace::reserve called while a scope is active");
+    state->buffer = buffer_type();
+    state->buffer = buffer_type(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing,
+                           "KokkosKernels::Workspace"),
+        bytes);
+    state->num_allocations++;
+  }
+
+  //! Frees the buffer; no scope may be active
+  void release() {
+    KK_REQUIRE_MSG(state->active_scopes == 0,
+                   "Workspace::release called while a scope is active");
+    state->buffer = buffer_type();
+  }
+
+  //! Size of the buffer, in bytes
+  size_t capacity() const { return state->buffer.extent(0); }
+
+  //! Most memory drawn at once, in bytes
+  size_t high_water_mark() const { return state->high_water; }
+
+  //! Memory drawn by the active scopes, in bytes
+  size_t bytes_in_use() const { return state->in_use; }
+
+  //! Number of device allocations done by the workspace: the buffer, and the
+  //! views which did not fit in it
+  size_t num_allocations() const { return state->num_allocations; }
+
+  /// \brief The temporaries of one kernel call. With a null workspace, the
+  /// views are allocated as usual.
+  ///
+  /// The memory of a scope is reused once it ends, so the destructor fences
+  /// to wait for the kernels still using it.
+  class Scope {
+   public:
+    explicit Scope(Workspace *workspace_)
+        : workspace(workspace_),
+          start(workspace_ ? workspace_->state->top : 0),
+          drawn(0) {
+      if (workspace) workspace->state->active_scopes++;
+    }
+
+    ~Scope() {
+      if (!workspace) return;
+      Kokkos::fence("KokkosKernels::Workspace::Scope");
+      State &s = *workspace->state;
+      s.top    = start;
+      s.in_use -= drawn;
+      overflow.clear();
+      if (--s.active_scopes == 0 && s.high_water > s.buffer.extent(0))
+        workspace->reserve(s.high_water);
+    }
+
+    Scope(const Scope &)            = delete;
+    Scope &operator=(const Scope &) = delete;
+
+    //! A view of type ViewType (in the memory space of the workspace) with
+    //! the given extents, zero-initialized if initialize is true
+    template <class ViewType, class... Extents>
+    ViewType view(const std::string &label, const bool initialize,
+                  const Extents... extents) {
+      static_assert(
+          std::is_same<typename ViewType::memory_space, memory_space>::value,
+          "Workspace::Scope::view: the view must be in the memory space of "
+          "the workspace");
+      if (!workspace) {
+        if (initialize) return ViewType(label, extents...);
+        return ViewType(Kokkos::view_alloc(Kokkos::WithoutInitializing, label),
+                        extents...);
+      }
+      State &s = *workspace->state;
+      const size_t bytes =
+          (ViewType::required_allocation_size(extents...) + alignment - 1) /
+          alignment * alignment;
+      char *ptr = nullptr;
+      if (s.top + bytes <= s.buffer.extent(0)) {
+        ptr = s.buffer.data() + s.top;
+        s.top += bytes;
+      } else {
+        overflow.emplace_back(
+            Kokkos::view_alloc(Kokkos::WithoutInitializing, label), bytes);
+        ptr = overflow.back().data();
+        s.num_allocations++;
+      }
+      drawn += bytes;
+      s.in_use += bytes;
+      s.high_water = std::max(s.high_water, s.in_use);
+      ViewType v(reinterpret_cast<typename ViewType::pointer_type>(ptr),
+                 extents...);
+      if (initialize)
+        Kokkos::deep_copy(v, typename ViewType::non_const_value_type());
+      return v;
+    }
+
+   private:
+    Workspace *workspace;
+    size_t start;
+    size_t drawn;
+    std::vector<buffer_type> overflow;
+  };
+
+ private:
+  struct State {
+    buffer_type buffer;
+    size_t top             = 0;
+    size_t in_use          = 0;
+    size_t high_water      = 0;
+    size_t num_allocations = 0;
+    int active_scopes      = 0;
+  };
+
+  std::shared_ptr<State> state;
+};
+
+}  // namespace Experimental
+}  // namespace KokkosKernels
+
+#endif  // KOKKOSKERNELS_WORKSPACE_HPP
@@ -18,6 +18,7 @@
 
 #include "KokkosKernels_config.h"  // KOKKOSKERNELS_INST_LAYOUTLEFT, KOKKOSKERNELS_INST_LAYOUTRIGHT
 #include "KokkosKernels_default_types.hpp"  // default_layout
+#include "Kokkos_ArithTraits.hpp"
 
 #include <type_traits>
 
@@ -76,6 +77,21 @@ struct are_integral : std::bool_constant<((std::is_integral_v<Ts> ||
 template <class... Ts>
 inline constexpr bool are_integral_v = are_integral<Ts...>::value;
 
+// Whether values of the scalar type T are those of the working precision W,
+// or a lower precision of it (e.g. float for double): the storage types
+// accepted for factors and triangular matrices
+template <class T, class W, class TT = std::remove_const_t<T>,
+          class WW = std::remove_const_t<W>>
+struct is_same_or_lower_precision
+    : std::bool_constant<std::is_same_v<TT, WW> ||
+                         (sizeof(TT) < sizeof(WW) &&
+                          Kokkos::ArithTraits<TT>::is_complex ==
+                              Kokkos::ArithTraits<WW>::is_complex)> {};
+
+template <class T, class W>
+inline constexpr bool is_same_or_lower_precision_v =
+    is_same_or_lower_precision<T, W>::value;
+
 }  // namespace Impl
 }  // namespace KokkosKernels
 #endif
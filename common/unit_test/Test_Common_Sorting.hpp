@@ -27,7 +27,9 @@
 #include <KokkosKernels_default_types.hpp>
 #include <Kokkos_ArithTraits.hpp>
 #include <Kokkos_Complex.hpp>
+#include <algorithm>
 #include <cstdlib>
+#include <vector>
 
 // Generate n randomized counts with mean <avg>.
 // Then prefix-sum into randomOffsets.
@@ -503,6 +505,49 @@ void testBitonicSortLexicographic() {
   ASSERT_TRUE(ordered);
 }
 
+// Sort random keys, each multiplied by 2^shift (to test skipping the passes
+// over constant digits), with the device-level radix sort, with or without
+// values. Compare with std::stable_sort: values hold the original positions of
+// the keys, to check stability.
+template <typename Device, typename Key>
+void testRadixSort(size_t n, bool doValues, int shift = 0) {
+  typedef typename Device::execution_space exec_space;
+  typedef typename Device::memory_space mem_space;
+  typedef Kokkos::View<Key*, mem_space> KeyView;
+  typedef Kokkos::View<size_t*, mem_space> ValView;
+  KeyView keys("Radix sort testing keys", n);
+  ValView values("Radix sort testing values", doValues ? n : 0);
+  auto keysHost   = Kokkos::create_mirror_view(keys);
+  auto valuesHost = Kokkos::create_mirror_view(values);
+  std::vector<std::pair<Key, size_t>> expected(n);
+  srand(34567);
+  for (size_t i = 0; i < n; i++) {
+    Key k = getRandom<Key>();
+    if (shift) k %= 1000;
+    if (std::is_signed<Key>::value && rand() % 2) k = -k;
+    keysHost(i) = k * (Key(1) << shift);
+    if (doValues) valuesHost(i) = i;
+    expected[i] = std::make_pair(keysHost(i), i);
+  }
+  Kokkos::deep_copy(keys, keysHost);
+  Kokkos::deep_copy(values, valuesHost);
+  if (doValues)
+    KokkosKernels::radixSort(exec_space(), keys, values);
+  else
+    KokkosKernels::radixSort(exec_space(), keys);
+  std::stable_sort(
+      expected.begin(), expected.end(),
+      [](const std::pair<Key, size_t>& a, const std::pair<Key, size_t>& b) {
+        return a.first < b.first;
+      });
+  Kokkos::deep_copy(keysHost, keys);
+  Kokkos::deep_copy(valuesHost, values);
+  for (size_t i = 0; i < n; i++) {
+    ASSERT_EQ(keysHost(i), expected[i].first);
+    if (doValues) ASSERT_EQ(valuesHost(i), expected[i].second);
+  }
+}
+
 TEST_F(TestCategory, common_serial_radix) {
   // Test serial radix over some contiguous small arrays
   // 1st arg is #arrays, 2nd arg is max subarray size
@@ -563,4 +608,21 @@ TEST_F(TestCategory, common_device_bitonic) {
   testBitonicSortLexicographic<TestDevice>();
 }
 
+TEST_F(TestCategory, common_device_radix) {
+  // Test device-level radix sort of keys, and of keys with values
+  for (bool doValues : {false, true}) {
+    testRadixSort<TestDevice, char>(243743, doValues);
+    testRadixSort<TestDevice, char>(5, doValues);
+    testRadixSort<TestDevice, int>(0, doValues);
+    testRadixSort<TestDevice, int>(1, doValues);
+    testRadixSort<TestDevice, int>(123, doValues);
+    testRadixSort<TestDevice, int>(192314, doValues);
+    testRadixSort<TestDevice, int>(92314, doValues, 16);
+    testRadixSort<TestDevice, unsigned>(102314, doValues);
+    testRadixSort<TestDevice, int64_t>(82314, doValues);
+    testRadixSort<TestDevice, int64_t>(82314, doValues, 32);
+    testRadixSort<TestDevice, uint64_t>(3000, doValues);
+  }
+}
+
 #endif
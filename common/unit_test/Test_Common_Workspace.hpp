@@ -0,0 +1,96 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef TEST_COMMON_WORKSPACE_HPP
+#define TEST_COMMON_WORKSPACE_HPP
+
+#include <KokkosKernels_Workspace.hpp>
+
+template <typename Device>
+void test_workspace() {
+  using memory_space = typename Device::memory_space;
+  using workspace_t  = KokkosKernels::Experimental::Workspace<memory_space>;
+  using view_t       = Kokkos::View<double *, Device>;
+  using view2d_t     = Kokkos::View<int **, Kokkos::LayoutLeft, Device>;
+
+  // Without a workspace the views are allocated as usual
+  {
+    typename workspace_t::Scope scope(nullptr);
+    view_t a = scope.template view<view_t>("a", true, 10);
+    EXPECT_EQ(a.extent(0), size_t(10));
+    EXPECT_EQ(a.use_count(), 1);
+  }
+
+  workspace_t ws;
+  EXPECT_EQ(ws.capacity(), size_t(0));
+  EXPECT_EQ(ws.num_allocations(), size_t(0));
+
+  // The first call does not fit, and grows the buffer when it ends
+  // The views are rounded up to the alignment
+  auto aligned = [](const size_t bytes) {
+    return (bytes + workspace_t::alignment - 1) / workspace_t::alignment *
+           workspace_t::alignment;
+  };
+  const size_t bytes_a = aligned(1000 * sizeof(double));
+  const size_t bytes_b = aligned(3 * 7 * sizeof(int));
+  {
+    typename workspace_t::Scope scope(&ws);
+    view_t a   = scope.template view<view_t>("a", false, 1000);
+    view2d_t b = scope.template view<view2d_t>("b", true, 3, 7);
+    EXPECT_EQ(b.extent(0), size_t(3));
+    EXPECT_EQ(b.extent(1), size_t(7));
+    EXPECT_EQ(ws.num_allocations(), size_t(2));
+    EXPECT_EQ(ws.bytes_in_use(), bytes_a + bytes_b);
+    Kokkos::deep_copy(a, 1.0);
+    Kokkos::deep_copy(b, 5);
+  }
+  EXPECT_EQ(ws.bytes_in_use(), size_t(0));
+  EXPECT_EQ(ws.high_water_mark(), bytes_a + bytes_b);
+  EXPECT_EQ(ws.capacity(), bytes_a + bytes_b);
+  EXPECT_EQ(ws.num_allocations(), size_t(3));
+
+  // The next calls, with a nested scope, come from the buffer
+  for (int call = 0; call < 3; call++) {
+    typename workspace_t::Scope scope(&ws);
+    view_t a = scope.template view<view_t>("a", false, 1000);
+    EXPECT_EQ(a.use_count(), 0);
+    const int *b_data = nullptr;
+    for (int inner = 0; inner < 2; inner++) {
+      typename workspace_t::Scope nested(&ws);
+      view2d_t b = nested.template view<view2d_t>("b", true, 3, 7);
+      // The nested scope reuses the same memory each time
+      if (b_data) EXPECT_EQ(b.data(), b_data);
+      b_data = b.data();
+      int sum = 0;
+      Kokkos::parallel_reduce(
+          Kokkos::RangePolicy<typename Device::execution_space>(0, 3),
+          KOKKOS_LAMBDA(const int i, int &lsum) {
+            for (int j = 0; j < 7; j++) lsum += b(i, j);
+          },
+          sum);
+      EXPECT_EQ(sum, 0);
+      Kokkos::deep_copy(b, 5);
+    }
+  }
+  EXPECT_EQ(ws.num_allocations(), size_t(3));
+  EXPECT_EQ(ws.high_water_mark(), bytes_a + bytes_b);
+
+  ws.release();
+  EXPECT_EQ(ws.capacity(), size_t(0));
+}
+
+TEST_F(TestCategory, common_workspace) { test_workspace<TestDevice>(); }
+
+#endif  // TEST_COMMON_WORKSPACE_HPP
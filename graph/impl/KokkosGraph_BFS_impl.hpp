@@ -19,6 +19,7 @@
 
 #include "Kokkos_Core.hpp"
 #include "KokkosKernels_Utils.hpp"
+#include "KokkosKernels_Sorting.hpp"
 #include <vector>
 #include <algorithm>
 
@@ -117,6 +118,458 @@ struct SerialRCM {
   }
 };
 
+// Order of the vertices within a level of the Cuthill-McKee BFS: by the
+// queue position of the parent (the first vertex of the previous level to
+// reach them), then by degree, then by index
+template <typename rowmap_t, typename lno_view_t>
+struct RCMLevelComparator {
+  using lno_t = typename lno_view_t::non_const_value_type;
+
+  rowmap_t rowmap;
+  lno_view_t parent;
+
+  KOKKOS_INLINE_FUNCTION bool operator()(const lno_t v1,
+                                         const lno_t v2) const {
+    if (parent(v1) != parent(v2)) return parent(v1) < parent(v2);
+    const auto deg1 = rowmap(v1 + 1) - rowmap(v1);
+    const auto deg2 = rowmap(v2 + 1) - rowmap(v2);
+    if (deg1 != deg2) return deg1 < deg2;
+    return v1 < v2;
+  }
+};
+
+// Order in which the vertices are tried as the start of a connected
+// component: by degree, then by index
+template <typename rowmap_t, typename lno_t>
+struct RCMStartComparator {
+  rowmap_t rowmap;
+
+  KOKKOS_INLINE_FUNCTION bool operator()(const lno_t v1,
+                                         const lno_t v2) const {
+    const auto deg1 = rowmap(v1 + 1) - rowmap(v1);
+    const auto deg2 = rowmap(v2 + 1) - rowmap(v2);
+    if (deg1 != deg2) return deg1 < deg2;
+    return v1 < v2;
+  }
+};
+
+// Level-synchronous reverse Cuthill-McKee, entirely on the device of
+// execution space exec_space. Each level of the BFS is expanded in parallel:
+// an unlabeled neighbor records the smallest queue position of the vertices
+// reaching it (its parent), and the first visit appends it to the next
+// level. The next level is then sorted by (parent, degree, index), which is
+// the order of the serial algorithm. Each connected component starts from
+// one of its vertices of minimum degree: the vertices are sorted once by
+// degree, and the next start is the first unlabeled vertex in that order.
+// The vertices without neighbors passed on the way are components of their
+// own, and are labeled together.
+template <typename exec_space, typename rowmap_t, typename entries_t,
+          typename lno_view_t>
+struct ParallelRCM {
+  using size_type    = typename rowmap_t::non_const_value_type;
+  using lno_t        = typename entries_t::non_const_value_type;
+  using mem_space    = typename lno_view_t::memory_space;
+  using range_policy = Kokkos::RangePolicy<exec_space>;
+  using work_view_t  = Kokkos::View<lno_t*, mem_space>;
+  using count_view_t = Kokkos::View<lno_t, mem_space>;
+
+  lno_t numVerts;
+  rowmap_t rowmap;
+  entries_t entries;
+
+  ParallelRCM(const rowmap_t& rowmap_, const entries_t& entries_)
+      : numVerts(rowmap_.extent(0) - 1), rowmap(rowmap_), entries(entries_) {}
+
+  // Expand the level q(levelStart:levelEnd) into q(levelEnd:)
+  struct ExpandFunctor {
+    rowmap_t rowmap;
+    entries_t entries;
+    work_view_t q;
+    work_view_t label;
+    work_view_t parent;
+    count_view_t count;
+    lno_t levelEnd;
+    lno_t numVerts;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const lno_t p) const {
+      const lno_t v = q(p);
+      for (size_type j = rowmap(v); j < rowmap(v + 1); j++) {
+        const lno_t nei = entries(j);
+        if (nei == v || nei >= numVerts || label(nei) != -1) continue;
+        // parent is numVerts until the first visit
+        if (Kokkos::atomic_fetch_min(&parent(nei), p) == numVerts) {
+          q(levelEnd + Kokkos::atomic_fetch_add(&count(), lno_t(1))) = nei;
+        }
+      }
+    }
+  };
+
+  // The vertex at queue position i gets label i
+  struct LabelFunctor {
+    work_view_t q;
+    work_view_t label;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const lno_t i) const {
+      label(q(i)) = i;
+    }
+  };
+
+  struct ReverseFunctor {
+    work_view_t label;
+    lno_view_t labelOut;
+    lno_t numVerts;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const lno_t i) const {
+      labelOut(i) = numVerts - label(i) - 1;
+    }
+  };
+
+  // Position in order(begin:end) of the first unlabeled vertex with a
+  // neighbor, or end if there is none
+  struct NextStartFunctor {
+    using value_type = lno_t;
+
+    rowmap_t rowmap;
+    entries_t entries;
+    work_view_t order;
+    work_view_t label;
+    lno_t end;
+    lno_t numVerts;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const lno_t k,
+                                           value_type& first) const {
+      if (k >= first) return;
+      const lno_t v = order(k);
+      if (label(v) != -1) return;
+      for (size_type j = rowmap(v); j < rowmap(v + 1); j++) {
+        const lno_t nei = entries(j);
+        if (nei != v && nei < numVerts) {
+          first = k;
+          return;
+        }
+      }
+    }
+
+    KOKKOS_INLINE_FUNCTION void join(value_type& dst,
+                                     const value_type& src) const {
+      if (src < dst) dst = src;
+    }
+
+    KOKKOS_INLINE_FUNCTION void init(value_type& first) const { first = end; }
+  };
+
+  // Labels the unlabeled vertices of order(begin:end), which have no
+  // neighbors, in that order from qtail
+  struct IsolatedFunctor {
+    work_view_t order;
+    work_view_t q;
+    work_view_t label;
+    lno_t qtail;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const lno_t k, lno_t& offset,
+                                           const bool final) const {
+      const lno_t v = order(k);
+      if (label(v) != -1) return;
+      if (final) {
+        q(qtail + offset) = v;
+        label(v)          = qtail + offset;
+      }
+      offset++;
+    }
+  };
+
+  lno_view_t rcm() {
+    using comparator_t = RCMLevelComparator<rowmap_t, work_view_t>;
+    using start_comp_t = RCMStartComparator<rowmap_t, lno_t>;
+
+    work_view_t q(Kokkos::view_alloc(Kokkos::WithoutInitializing, "Queue"),
+                  numVerts);
+    work_view_t label(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "Permutation"),
+        numVerts);
+    work_view_t parent(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "Parent"), numVerts);
+    count_view_t count("Count");
+    Kokkos::deep_copy(exec_space(), label, lno_t(-1));
+    Kokkos::deep_copy(exec_space(), parent, numVerts);
+
+    const auto labelRange = [&](const lno_t begin, const lno_t end) {
+      Kokkos::parallel_for("KokkosGraph::RCM::label",
+                           range_policy(begin, end), LabelFunctor{q, label});
+    };
+
+    // Candidate starts of the components
+    work_view_t order(Kokkos::view_alloc(Kokkos::WithoutInitializing, "Order"),
+                      numVerts);
+    KokkosKernels::Impl::sequential_fill(order);
+    KokkosKernels::bitonicSort<work_view_t, exec_space, lno_t, start_comp_t>(
+        order, start_comp_t{rowmap});
+
+    // Chunk of order searched for the next start; it doubles while no start
+    // is found, so the search costs O(n) over all the components
+    constexpr lno_t minChunk = 256;
+    lno_t cursor             = 0;
+    lno_t chunk              = minChunk;
+    lno_t qtail              = 0;
+    while (qtail < numVerts) {
+      const lno_t end = std::min(numVerts, cursor + chunk);
+      lno_t next;
+      Kokkos::parallel_reduce(
+          "KokkosGraph::RCM::start", range_policy(cursor, end),
+          NextStartFunctor{rowmap, entries, order, label, end, numVerts}, next);
+      if (next > cursor) {
+        lno_t numIsolated;
+        Kokkos::parallel_scan("KokkosGraph::RCM::isolated",
+                              range_policy(cursor, next),
+                              IsolatedFunctor{order, q, label, qtail},
+                              numIsolated);
+        qtail += numIsolated;
+      }
+      if (next == end) {
+        cursor = end;
+        chunk *= 2;
+        continue;
+      }
+      cursor = next + 1;
+      chunk  = minChunk;
+
+      // Start a new connected component
+      Kokkos::deep_copy(exec_space(), Kokkos::subview(q, qtail),
+                        Kokkos::subview(order, next));
+      labelRange(qtail, qtail + 1);
+      lno_t levelStart = qtail;
+      lno_t levelEnd   = qtail + 1;
+      while (levelStart < levelEnd) {
+        Kokkos::parallel_for(
+            "KokkosGraph::RCM::expand", range_policy(levelStart, levelEnd),
+            ExpandFunctor{rowmap, entries, q, label, parent, count, levelEnd,
+                          numVerts});
+        lno_t levelSize;
+        Kokkos::deep_copy(levelSize, count);
+        Kokkos::deep_copy(exec_space(), count, lno_t(0));
+        if (levelSize > 1) {
+          auto level = Kokkos::subview(
+              q, Kokkos::make_pair(levelEnd, levelEnd + levelSize));
+          KokkosKernels::bitonicSort<decltype(level), exec_space, lno_t,
+                                     comparator_t>(
+              level, comparator_t{rowmap, parent});
+        }
+        labelRange(levelEnd, levelEnd + levelSize);
+        levelStart = levelEnd;
+        levelEnd += levelSize;
+      }
+      qtail = levelEnd;
+    }
+
+    // reverse the labels
+    lno_view_t labelOut(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "RCM Permutation"),
+        numVerts);
+    Kokkos::parallel_for("KokkosGraph::RCM::reverse",
+                         range_policy(0, numVerts),
+                         ReverseFunctor{label, labelOut, numVerts});
+    return labelOut;
+  }
+};
+
+// Direction-optimizing BFS (Beamer, Asanovic and Patterson), on the device
+// of execution space exec_space. A level is expanded either top-down, from
+// a queue of the frontier vertices whose unvisited neighbors are claimed
+// with an atomic compare-and-swap, or bottom-up, where every unvisited
+// vertex looks for a parent in a bitmap of the frontier and stops at the
+// first one. Top-down is used while the edges out of the frontier (m_f) are
+// few compared to the edges out of the unvisited vertices (m_u):
+// bottom-up starts when m_f > m_u / alpha, and top-down resumes when the
+// frontier has less than n / beta vertices. The graph must be symmetric.
+template <typename exec_space, typename rowmap_t, typename entries_t,
+          typename lno_view_t>
+struct DirectionOptimizingBFS {
+  using size_type     = typename rowmap_t::non_const_value_type;
+  using lno_t         = typename entries_t::non_const_value_type;
+  using mem_space     = typename lno_view_t::memory_space;
+  using range_policy  = Kokkos::RangePolicy<exec_space>;
+  using work_view_t   = Kokkos::View<lno_t*, mem_space>;
+  using count_view_t  = Kokkos::View<lno_t, mem_space>;
+  using bitmap_view_t = Kokkos::View<uint32_t*, mem_space>;
+
+  lno_t numVerts;
+  rowmap_t rowmap;
+  entries_t entries;
+  double alpha;
+  double beta;
+
+  DirectionOptimizingBFS(const rowmap_t& rowmap_, const entries_t& entries_,
+                         const double alpha_, const double beta_)
+      : numVerts(rowmap_.extent(0) - 1),
+        rowmap(rowmap_),
+        entries(entries_),
+        alpha(alpha_),
+        beta(beta_) {}
+
+  // Top-down step: the neighbors of q(0:frontierSize) not visited yet get
+  // distance level and go to nextQ; reduces their total degree
+  struct TopDownFunctor {
+    rowmap_t rowmap;
+    entries_t entries;
+    work_view_t q;
+    work_view_t nextQ;
+    lno_view_t dist;
+    count_view_t count;
+    lno_t level;
+    lno_t numVerts;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const lno_t i,
+                                           size_type& mf) const {
+      const lno_t v = q(i);
+      for (size_type j = rowmap(v); j < rowmap(v + 1); j++) {
+        const lno_t nei = entries(j);
+        if (nei >= numVerts || dist(nei) != -1) continue;
+        if (Kokkos::atomic_compare_exchange(&dist(nei), lno_t(-1), level) ==
+            lno_t(-1)) {
+          nextQ(Kokkos::atomic_fetch_add(&count(), lno_t(1))) = nei;
+          mf += rowmap(nei + 1) - rowmap(nei);
+        }
+      }
+    }
+  };
+
+  // Bottom-up step: each vertex not visited yet and with a neighbor in the
+  // frontier bitmap gets distance level and goes to the next bitmap;
+  // reduces their number and their total degree
+  struct BottomUpFunctor {
+    using value_type = size_type[];
+
+    rowmap_t rowmap;
+    entries_t entries;
+    bitmap_view_t frontier;
+    bitmap_view_t nextFrontier;
+    lno_view_t dist;
+    lno_t level;
+    lno_t numVerts;
+    const int value_count = 2;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const lno_t v,
+                                           value_type sums) const {
+      if (dist(v) != -1) return;
+      for (size_type j = rowmap(v); j < rowmap(v + 1); j++) {
+        const lno_t nei = entries(j);
+        if (nei >= numVerts) continue;
+        if (frontier(nei >> 5) & (uint32_t(1) << (nei & 31))) {
+          dist(v) = level;
+          Kokkos::atomic_fetch_or(&nextFrontier(v >> 5),
+                                  uint32_t(1) << (v & 31));
+          sums[0] += 1;
+          sums[1] += rowmap(v + 1) - rowmap(v);
+          break;
+        }
+      }
+    }
+
+    KOKKOS_INLINE_FUNCTION void init(value_type sums) const {
+      sums[0] = 0;
+      sums[1] = 0;
+    }
+
+    KOKKOS_INLINE_FUNCTION void join(value_type dst,
+                                     const value_type src) const {
+      dst[0] += src[0];
+      dst[1] += src[1];
+    }
+  };
+
+  struct QueueToBitmapFunctor {
+    work_view_t q;
+    bitmap_view_t bitmap;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const lno_t i) const {
+      const lno_t v = q(i);
+      Kokkos::atomic_fetch_or(&bitmap(v >> 5), uint32_t(1) << (v & 31));
+    }
+  };
+
+  // Compacts the vertices at distance level into q
+  struct LevelToQueueFunctor {
+    lno_view_t dist;
+    work_view_t q;
+    lno_t level;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const lno_t v, lno_t& offset,
+                                           const bool final) const {
+      if (dist(v) != level) return;
+      if (final) q(offset) = v;
+      offset++;
+    }
+  };
+
+  lno_view_t bfs(const lno_t source) {
+    lno_view_t dist(Kokkos::view_alloc(Kokkos::WithoutInitializing, "Dist"),
+                    numVerts);
+    Kokkos::deep_copy(exec_space(), dist, lno_t(-1));
+    Kokkos::deep_copy(exec_space(), Kokkos::subview(dist, source), lno_t(0));
+
+    const lno_t numWords = (numVerts + 31) / 32;
+    work_view_t q(Kokkos::view_alloc(Kokkos::WithoutInitializing, "Queue"),
+                  numVerts);
+    work_view_t nextQ(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "NextQueue"),
+        numVerts);
+    bitmap_view_t frontier("Frontier", numWords);
+    bitmap_view_t nextFrontier("NextFrontier", numWords);
+    count_view_t count("Count");
+    Kokkos::deep_copy(exec_space(), Kokkos::subview(q, 0), source);
+
+    size_type nnz, sourceBegin, sourceEnd;
+    Kokkos::deep_copy(nnz, Kokkos::subview(rowmap, numVerts));
+    Kokkos::deep_copy(sourceBegin, Kokkos::subview(rowmap, source));
+    Kokkos::deep_copy(sourceEnd, Kokkos::subview(rowmap, source + 1));
+
+    lno_t frontierSize = 1;
+    double mf          = sourceEnd - sourceBegin;
+    double mu          = double(nnz) - mf;
+    bool topDown       = true;
+    for (lno_t level = 1; frontierSize > 0; level++) {
+      if (topDown && mf > mu / alpha) {
+        Kokkos::deep_copy(exec_space(), frontier, uint32_t(0));
+        Kokkos::parallel_for("KokkosGraph::BFS::queue_to_bitmap",
+                             range_policy(0, frontierSize),
+                             QueueToBitmapFunctor{q, frontier});
+        topDown = false;
+      } else if (!topDown && frontierSize < numVerts / beta) {
+        Kokkos::parallel_scan("KokkosGraph::BFS::bitmap_to_queue",
+                              range_policy(0, numVerts),
+                              LevelToQueueFunctor{dist, q, level - 1});
+        topDown = true;
+      }
+
+      size_type nextMf = 0;
+      if (topDown) {
+        Kokkos::parallel_reduce(
+            "KokkosGraph::BFS::top_down", range_policy(0, frontierSize),
+            TopDownFunctor{rowmap, entries, q, nextQ, dist, count, level,
+                           numVerts},
+            nextMf);
+        Kokkos::deep_copy(frontierSize, count);
+        Kokkos::deep_copy(exec_space(), count, lno_t(0));
+        std::swap(q, nextQ);
+      } else {
+        size_type sums[2];
+        Kokkos::deep_copy(exec_space(), nextFrontier, uint32_t(0));
+        Kokkos::parallel_reduce(
+            "KokkosGraph::BFS::bottom_up", range_policy(0, numVerts),
+            BottomUpFunctor{rowmap, entries, frontier, nextFrontier, dist,
+                            level, numVerts},
+            sums);
+        frontierSize = sums[0];
+        nextMf       = sums[1];
+        std::swap(frontier, nextFrontier);
+      }
+      mf = nextMf;
+      mu -= mf;
+    }
+    return dist;
+  }
+};
+
 }  // namespace Impl
 }  // namespace Experimental
 }  // namespace KokkosGraph
@@ -0,0 +1,183 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef _KOKKOSGRAPH_CONNECTED_COMPONENTS_IMPL_HPP
+#define _KOKKOSGRAPH_CONNECTED_COMPONENTS_IMPL_HPP
+
+#include "Kokkos_Core.hpp"
+#include "Kokkos_ArithTraits.hpp"
+#include <algorithm>
+#include <unordered_map>
+
+namespace KokkosGraph {
+namespace Impl {
+
+// Connected components in the style of Afforest (Sutton, Ben-Nun and
+// Barak): the components are first approximated from a few neighbors of
+// every vertex, then only the vertices outside of the largest intermediate
+// component process their other edges.
+//
+// comp(v) is a tree of labels whose root is the smallest vertex of the
+// component. Linking (u, v) writes the smaller of comp(u) and comp(v) into
+// the label of the other one, if that lowers it. These writes are plain
+// stores: concurrent writes to the same label may lose one another, but any
+// stored value is a smaller vertex of the same component, so the passes are
+// simply repeated, with pointer jumping in between, until a pass finds all
+// its edges within a single tree. Nothing needs atomics.
+template <typename device_t, typename rowmap_t, typename entries_t,
+          typename labels_t>
+struct AfforestConnectedComponents {
+  using exec_space   = typename device_t::execution_space;
+  using mem_space    = typename device_t::memory_space;
+  using size_type    = typename rowmap_t::non_const_value_type;
+  using lno_t        = typename entries_t::non_const_value_type;
+  using range_policy = Kokkos::RangePolicy<exec_space>;
+
+  // Number of neighbors of each vertex in the sampling phase
+  static constexpr int neighborRounds = 2;
+  // Number of vertices sampled to find the largest component
+  static constexpr lno_t numSamples = 1024;
+
+  rowmap_t rowmap;
+  entries_t entries;
+  lno_t numVerts;
+  labels_t comp;
+  lno_t numComponents;
+
+  AfforestConnectedComponents(const rowmap_t& rowmap_,
+                              const entries_t& entries_)
+      : rowmap(rowmap_),
+        entries(entries_),
+        numVerts(rowmap_.extent(0) - 1),
+        comp(Kokkos::view_alloc(Kokkos::WithoutInitializing, "Components"),
+             numVerts),
+        numComponents(0) {}
+
+  // Links v with its neighbors of index first to last (excluded, relative
+  // to the start of the row); counts the edges across two trees. The
+  // vertices labeled skip are not processed.
+  struct LinkFunctor {
+    rowmap_t rowmap;
+    entries_t entries;
+    labels_t comp;
+    lno_t numVerts;
+    size_type first;
+    size_type last;
+    lno_t skip;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const lno_t v,
+                                           lno_t& numCross) const {
+      if (comp(v) == skip) return;
+      const size_type rowEnd = rowmap(v + 1);
+      const size_type begin  = rowmap(v) + first;
+      const size_type end    = rowEnd - rowmap(v) > last ? rowmap(v) + last
+                                                         : rowEnd;
+      for (size_type j = begin; j < end; j++) {
+        const lno_t u = entries(j);
+        if (u == v || u >= numVerts) continue;
+        const lno_t cv = comp(v);
+        const lno_t cu = comp(u);
+        if (cv == cu) continue;
+        numCross++;
+        const lno_t hi = cv < cu ? cu : cv;
+        const lno_t lo = cv < cu ? cv : cu;
+        if (lo < comp(hi)) comp(hi) = lo;
+      }
+    }
+  };
+
+  // Pointer jumping: comp(v) becomes the root of its tree
+  struct CompressFunctor {
+    labels_t comp;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const lno_t v) const {
+      lno_t c = comp(v);
+      while (comp(c) != c) c = comp(c);
+      comp(v) = c;
+    }
+  };
+
+  struct InitFunctor {
+    labels_t comp;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const lno_t v) const {
+      comp(v) = v;
+    }
+  };
+
+  struct CountFunctor {
+    labels_t comp;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const lno_t v,
+                                           lno_t& count) const {
+      if (comp(v) == v) count++;
+    }
+  };
+
+  // Links the neighbors first to last of all vertices but the ones labeled
+  // skip, until no edge joins two trees
+  void link(const size_type first, const size_type last, const lno_t skip) {
+    while (true) {
+      lno_t numCross = 0;
+      Kokkos::parallel_reduce(
+          "KokkosGraph::ConnectedComponents::link",
+          range_policy(0, numVerts),
+          LinkFunctor{rowmap, entries, comp, numVerts, first, last, skip},
+          numCross);
+      Kokkos::parallel_for("KokkosGraph::ConnectedComponents::compress",
+                           range_policy(0, numVerts), CompressFunctor{comp});
+      if (numCross == 0) break;
+    }
+  }
+
+  // The most frequent label among evenly spaced vertices
+  lno_t largestComponent() {
+    const lno_t n = std::min(numSamples, numVerts);
+    auto comp_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                      comp);
+    std::unordered_map<lno_t, lno_t> counts;
+    lno_t best = comp_h(0), bestCount = 0;
+    for (lno_t k = 0; k < n; k++) {
+      const lno_t c = comp_h(static_cast<lno_t>(
+          static_cast<double>(k) * numVerts / n));
+      if (++counts[c] > bestCount) {
+        best      = c;
+        bestCount = counts[c];
+      }
+    }
+    return best;
+  }
+
+  void compute() {
+    const lno_t none = -1;  // no vertex is skipped
+    Kokkos::parallel_for("KokkosGraph::ConnectedComponents::init",
+                         range_policy(0, numVerts), InitFunctor{comp});
+    // Sampling phase
+    link(0, neighborRounds, none);
+    // The vertices of the largest component skip their other edges: an edge
+    // to another component is processed by its other end
+    link(neighborRounds, Kokkos::ArithTraits<size_type>::max(),
+         largestComponent());
+    Kokkos::parallel_reduce("KokkosGraph::ConnectedComponents::count",
+                            range_policy(0, numVerts), CountFunctor{comp},
+                            numComponents);
+  }
+};
+
+}  // namespace Impl
+}  // namespace KokkosGraph
+
+#endif
@@ -0,0 +1,187 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef _KOKKOSGRAPH_DISTANCE1COLORUPDATE_IMPL_HPP
+#define _KOKKOSGRAPH_DISTANCE1COLORUPDATE_IMPL_HPP
+
+#include <cstdint>
+#include <utility>
+#include "Kokkos_Core.hpp"
+
+namespace KokkosGraph {
+namespace Impl {
+
+// Repairs a distance-1 coloring after local changes to the graph. Only the
+// modified vertices can be in conflict (an edge that was added has a
+// modified endpoint), so they are checked first: a modified vertex loses its
+// color if a neighbor has the same color and is either unmodified or
+// modified with a smaller index. The uncolored vertices are then recolored
+// with speculative first fit: each takes the smallest color none of its
+// neighbors has, and of two neighbors recolored in the same round with the
+// same color, the larger index is uncolored again for the next round.
+//
+// First fit never gives a vertex a color above its degree + 1, so the number
+// of colors is at most max(previous number of colors, max degree + 1).
+template <typename exec_space, typename rowmap_t, typename entries_t,
+          typename color_view_t, typename lno_view_t>
+struct D1ColorUpdate {
+  using size_type    = typename rowmap_t::non_const_value_type;
+  using lno_t        = typename entries_t::non_const_value_type;
+  using color_t      = typename color_view_t::non_const_value_type;
+  using mem_space    = typename color_view_t::memory_space;
+  using range_policy = Kokkos::RangePolicy<exec_space>;
+  using work_view_t  = Kokkos::View<lno_t*, mem_space>;
+  using count_view_t = Kokkos::View<lno_t, mem_space>;
+
+  lno_t numVerts;
+  rowmap_t rowmap;
+  entries_t entries;
+  color_view_t colors;
+
+  D1ColorUpdate(const lno_t numVerts_, const rowmap_t& rowmap_,
+                const entries_t& entries_, const color_view_t& colors_)
+      : numVerts(numVerts_),
+        rowmap(rowmap_),
+        entries(entries_),
+        colors(colors_) {}
+
+  // Appends each vertex of list (or of [first, first + n) if list is
+  // empty) to q once, stamping it with round 1
+  struct GatherFunctor {
+    lno_view_t list;
+    lno_t first;
+    work_view_t stamp;
+    work_view_t q;
+    count_view_t count;
+    lno_t numVerts;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const lno_t i) const {
+      const lno_t v = list.extent(0) ? lno_t(list(i)) : first + i;
+      if (v < 0 || v >= numVerts) return;
+      if (Kokkos::atomic_exchange(&stamp(v), lno_t(1)) != lno_t(1))
+        q(Kokkos::atomic_fetch_add(&count(), lno_t(1))) = v;
+    }
+  };
+
+  // A vertex of q in conflict (or uncolored) is uncolored and goes to nextQ.
+  // Its neighbors u in conflict win if they are not stamped with round, or
+  // if u < v.
+  struct ConflictFunctor {
+    rowmap_t rowmap;
+    entries_t entries;
+    color_view_t colors;
+    work_view_t q;
+    work_view_t nextQ;
+    work_view_t stamp;
+    count_view_t count;
+    lno_t round;
+    lno_t numVerts;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const lno_t i) const {
+      const lno_t v   = q(i);
+      const color_t c = colors(v);
+      bool lose       = c == 0;
+      for (size_type j = rowmap(v); !lose && j < rowmap(v + 1); j++) {
+        const lno_t u = entries(j);
+        if (u == v || u >= numVerts || colors(u) != c) continue;
+        lose = stamp(u) != round || u < v;
+      }
+      if (!lose) return;
+      colors(v) = 0;
+      nextQ(Kokkos::atomic_fetch_add(&count(), lno_t(1))) = v;
+    }
+  };
+
+  // First fit: the smallest color no neighbor has, looked up 64 colors at a
+  // time; stamps the vertex with round
+  struct FirstFitFunctor {
+    rowmap_t rowmap;
+    entries_t entries;
+    color_view_t colors;
+    work_view_t q;
+    work_view_t stamp;
+    lno_t round;
+    lno_t numVerts;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const lno_t i) const {
+      const lno_t v = q(i);
+      stamp(v)      = round;
+      for (color_t offset = 1;; offset += 64) {
+        uint64_t used = 0;
+        for (size_type j = rowmap(v); j < rowmap(v + 1); j++) {
+          const lno_t u = entries(j);
+          if (u == v || u >= numVerts) continue;
+          const color_t c = colors(u);
+          if (c >= offset && c < offset + 64)
+            used |= uint64_t(1) << (c - offset);
+        }
+        if (~used) {
+          color_t c = offset;
+          while (used & 1) {
+            used >>= 1;
+            c++;
+          }
+          colors(v) = c;
+          return;
+        }
+      }
+    }
+  };
+
+  void update(const lno_view_t& modified, const lno_t firstNew) {
+    work_view_t q(Kokkos::view_alloc(Kokkos::WithoutInitializing, "Queue"),
+                  numVerts);
+    work_view_t nextQ(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "NextQueue"),
+        numVerts);
+    work_view_t stamp("Stamp", numVerts);
+    count_view_t count("Count");
+    const lno_view_t none;
+    Kokkos::parallel_for(
+        "KokkosGraph::ColorUpdate::gather_modified",
+        range_policy(0, modified.extent(0)),
+        GatherFunctor{modified, 0, stamp, q, count, numVerts});
+    Kokkos::parallel_for(
+        "KokkosGraph::ColorUpdate::gather_new",
+        range_policy(0, numVerts - firstNew),
+        GatherFunctor{none, firstNew, stamp, q, count, numVerts});
+    lno_t qSize;
+    Kokkos::deep_copy(qSize, count);
+    Kokkos::deep_copy(exec_space(), count, lno_t(0));
+
+    // uncolor the modified vertices that lose a conflict, then recolor
+    // until no conflict is left
+    for (lno_t round = 1; qSize > 0; round++) {
+      if (round > 1) {
+        Kokkos::parallel_for(
+            "KokkosGraph::ColorUpdate::first_fit", range_policy(0, qSize),
+            FirstFitFunctor{rowmap, entries, colors, q, stamp, round,
+                            numVerts});
+      }
+      Kokkos::parallel_for(
+          "KokkosGraph::ColorUpdate::conflicts", range_policy(0, qSize),
+          ConflictFunctor{rowmap, entries, colors, q, nextQ, stamp, count,
+                          round, numVerts});
+      Kokkos::deep_copy(qSize, count);
+      Kokkos::deep_copy(exec_space(), count, lno_t(0));
+      std::swap(q, nextQ);
+    }
+  }
+};
+
+}  // namespace Impl
+}  // namespace KokkosGraph
+
+#endif
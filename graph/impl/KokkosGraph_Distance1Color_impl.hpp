@@ -3095,6 +3095,226 @@ class GraphColor_EB : public GraphColor<HandleType, in_row_index_view_type_,
   };
 };
 
+/*! \brief Balancing post-pass of a distance-1 coloring.
+ *  The target size of the color classes is ceil(nv / num_colors). Each
+ *  iteration, the vertices of the classes larger than that move (in
+ *  parallel) to the smallest color not used by their neighbors and whose
+ *  class is smaller than the target. The slots are reserved with atomics, so
+ *  that no class falls below or grows above the target, and two neighbors
+ *  moving to the same color are resolved by keeping the larger index on its
+ *  old color. So the coloring stays valid and the number of colors does not
+ *  change.
+ */
+template <typename HandleType, typename lno_row_view_t_,
+          typename lno_nnz_view_t_>
+class GraphColorBalance {
+ public:
+  typedef typename HandleType::color_t color_t;
+  typedef typename HandleType::color_view_t color_view_type;
+  typedef typename HandleType::size_type size_type;
+  typedef typename HandleType::nnz_lno_t nnz_lno_t;
+
+  typedef typename HandleType::HandleExecSpace MyExecSpace;
+  typedef typename HandleType::HandleTempMemorySpace MyTempMemorySpace;
+  typedef typename HandleType::nnz_lno_temp_work_view_t
+      nnz_lno_temp_work_view_t;
+
+  typedef typename lno_row_view_t_::const_type const_lno_row_view_t;
+  typedef typename lno_nnz_view_t_::const_type const_lno_nnz_view_t;
+
+  typedef Kokkos::RangePolicy<MyExecSpace> my_exec_space;
+
+ private:
+  nnz_lno_t nv;               //# vertices
+  const_lno_row_view_t xadj;  // rowmap
+  const_lno_nnz_view_t adj;   // entries
+  HandleType *cp;
+
+ public:
+  GraphColorBalance(nnz_lno_t nv_, const_lno_row_view_t row_map,
+                    const_lno_nnz_view_t entries, HandleType *coloring_handle)
+      : nv(nv_), xadj(row_map), adj(entries), cp(coloring_handle) {}
+
+  /** \brief Balances the colors (1 to num_colors) in place.
+   *  \return the number of vertices that changed color.
+   */
+  nnz_lno_t balance(color_view_type colors, nnz_lno_t num_colors) {
+    nnz_lno_t total_moved = 0;
+    if (nv == 0 || num_colors < 2) return total_moved;
+    const nnz_lno_t target = (nv + num_colors - 1) / num_colors;
+
+    nnz_lno_temp_work_view_t sizes("Color class sizes", num_colors + 1);
+    nnz_lno_temp_work_view_t fill("Color class fill", num_colors + 1);
+    nnz_lno_temp_work_view_t excess("Color class excess", num_colors + 1);
+    color_view_type new_colors("New colors", nv);
+
+    const int max_iterations = cp->get_max_number_of_iterations();
+    for (int iter = 0; iter < max_iterations; iter++) {
+      Kokkos::deep_copy(sizes, 0);
+      Kokkos::parallel_for("KokkosGraph::ColorBalance::Count",
+                           my_exec_space(0, nv),
+                           functorCountClasses(colors, sizes, num_colors));
+      nnz_lno_t num_overfull = 0;
+      Kokkos::parallel_reduce(
+          "KokkosGraph::ColorBalance::InitClasses",
+          my_exec_space(1, num_colors + 1),
+          functorInitClasses(sizes, fill, excess, target), num_overfull);
+      if (num_overfull == 0) break;
+
+      Kokkos::parallel_for(
+          "KokkosGraph::ColorBalance::Pick", my_exec_space(0, nv),
+          functorPickColor(nv, xadj, adj, colors, new_colors, fill, excess,
+                           num_colors, target));
+      nnz_lno_t num_moved = 0;
+      Kokkos::parallel_reduce(
+          "KokkosGraph::ColorBalance::Commit", my_exec_space(0, nv),
+          functorCommitColor(nv, xadj, adj, colors, new_colors), num_moved);
+      if (cp->get_tictoc()) {
+        std::cout << "\tBalancing iteration " << iter << ": " << num_overfull
+                  << " oversized colors, " << num_moved << " vertices moved"
+                  << std::endl;
+      }
+      total_moved += num_moved;
+      if (num_moved == 0) break;
+    }
+    return total_moved;
+  }
+
+  struct functorCountClasses {
+    color_view_type _colors;
+    nnz_lno_temp_work_view_t _sizes;
+    nnz_lno_t _num_colors;
+
+    functorCountClasses(color_view_type colors, nnz_lno_temp_work_view_t sizes,
+                        nnz_lno_t num_colors)
+        : _colors(colors), _sizes(sizes), _num_colors(num_colors) {}
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const nnz_lno_t i) const {
+      const color_t c = _colors(i);
+      if (c > 0 && c <= _num_colors) Kokkos::atomic_inc(&_sizes(c));
+    }
+  };
+
+  struct functorInitClasses {
+    nnz_lno_temp_work_view_t _sizes, _fill, _excess;
+    nnz_lno_t _target;
+
+    functorInitClasses(nnz_lno_temp_work_view_t sizes,
+                       nnz_lno_temp_work_view_t fill,
+                       nnz_lno_temp_work_view_t excess, nnz_lno_t target)
+        : _sizes(sizes), _fill(fill), _excess(excess), _target(target) {}
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const nnz_lno_t c, nnz_lno_t &num_overfull) const {
+      _fill(c)   = _sizes(c);
+      _excess(c) = _sizes(c) - _target;
+      if (_excess(c) > 0) num_overfull++;
+    }
+  };
+
+  /** \brief Functor picking the new colors: a vertex of an oversized class
+   * takes one of the excess tickets of its class, then a free slot in the
+   * smallest color (below the target size) that none of its neighbors has.
+   * new_colors is 0 for the vertices that do not move.
+   */
+  struct functorPickColor {
+    nnz_lno_t nv;
+    const_lno_row_view_t _xadj;
+    const_lno_nnz_view_t _adj;
+    color_view_type _colors;
+    color_view_type _new_colors;
+    nnz_lno_temp_work_view_t _fill, _excess;
+    nnz_lno_t _num_colors;
+    nnz_lno_t _target;
+
+    functorPickColor(nnz_lno_t nv_, const_lno_row_view_t xadj,
+                     const_lno_nnz_view_t adj, color_view_type colors,
+                     color_view_type new_colors, nnz_lno_temp_work_view_t fill,
+                     nnz_lno_temp_work_view_t excess, nnz_lno_t num_colors,
+                     nnz_lno_t target)
+        : nv(nv_),
+          _xadj(xadj),
+          _adj(adj),
+          _colors(colors),
+          _new_colors(new_colors),
+          _fill(fill),
+          _excess(excess),
+          _num_colors(num_colors),
+          _target(target) {}
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const nnz_lno_t i) const {
+      _new_colors(i)     = 0;
+      const color_t my_c = _colors(i);
+      if (my_c <= 0 || my_c > _num_colors || _excess(my_c) <= 0) return;
+      if (Kokkos::atomic_fetch_sub(&_excess(my_c), nnz_lno_t(1)) <= 0) return;
+
+      const size_type my_xadj_end = _xadj(i + 1);
+      // Colors offset to offset + 63 at a time, with a bit mask of the
+      // colors of the neighbors
+      for (nnz_lno_t offset = 1; offset <= _num_colors;
+           offset += VBBIT_COLORING_FORBIDDEN_SIZE) {
+        uint64_t forbidden = 0;
+        for (size_type j = _xadj(i); j < my_xadj_end; j++) {
+          const nnz_lno_t n = _adj(j);
+          // Skip self-loops and remote edges (distributed graph)
+          if (n == i || n >= nv) continue;
+          const nnz_lno_t c = nnz_lno_t(_colors(n)) - offset;
+          if (c >= 0 && c < VBBIT_COLORING_FORBIDDEN_SIZE)
+            forbidden |= uint64_t(1) << c;
+        }
+        for (nnz_lno_t b = 0; b < VBBIT_COLORING_FORBIDDEN_SIZE; b++) {
+          const nnz_lno_t c = offset + b;
+          if (c > _num_colors) break;
+          if ((forbidden & (uint64_t(1) << b)) || _fill(c) >= _target)
+            continue;
+          if (Kokkos::atomic_fetch_add(&_fill(c), nnz_lno_t(1)) < _target) {
+            _new_colors(i) = color_t(c);
+            return;
+          }
+        }
+      }
+      // No free color: the vertex stays, and its excess ticket is lost for
+      // this iteration
+    }
+  };
+
+  /** \brief Functor committing the new colors: when two neighbors picked
+   * the same color, the one with the larger index keeps its old color (which
+   * the other one avoided).
+   */
+  struct functorCommitColor {
+    nnz_lno_t nv;
+    const_lno_row_view_t _xadj;
+    const_lno_nnz_view_t _adj;
+    color_view_type _colors;
+    color_view_type _new_colors;
+
+    functorCommitColor(nnz_lno_t nv_, const_lno_row_view_t xadj,
+                       const_lno_nnz_view_t adj, color_view_type colors,
+                       color_view_type new_colors)
+        : nv(nv_),
+          _xadj(xadj),
+          _adj(adj),
+          _colors(colors),
+          _new_colors(new_colors) {}
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const nnz_lno_t i, nnz_lno_t &num_moved) const {
+      const color_t my_c = _new_colors(i);
+      if (my_c == 0) return;
+      const size_type my_xadj_end = _xadj(i + 1);
+      for (size_type j = _xadj(i); j < my_xadj_end; j++) {
+        const nnz_lno_t n = _adj(j);
+        if (n < i && n < nv && _new_colors(n) == my_c) return;
+      }
+      _colors(i) = my_c;
+      num_moved++;
+    }
+  };
+};  // class GraphColorBalance
+
 template <class KernelHandle, typename lno_row_view_t_,
           typename lno_nnz_view_t_>
 void graph_color_impl(KernelHandle *handle,
@@ -3170,11 +3390,19 @@ void graph_color_impl(KernelHandle *handle,
   gc->color_graph(colors_out, num_phases);
 
   delete gc;
+  gch->set_vertex_colors(colors_out);
+
+  if (gch->get_balance_colors()) {
+    Impl::GraphColorBalance<typename KernelHandle::GraphColoringHandleType,
+                            lno_row_view_t_, lno_nnz_view_t_>
+        balancer(num_rows, row_map, entries, gch);
+    balancer.balance(colors_out, gch->get_num_colors());
+  }
+
   double coloring_time = timer.seconds();
   gch->add_to_overall_coloring_time(coloring_time);
   gch->set_coloring_time(coloring_time);
   gch->set_num_phases(num_phases);
-  gch->set_vertex_colors(colors_out);
 }
 
 }  // namespace Impl
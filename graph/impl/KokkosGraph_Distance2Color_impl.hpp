@@ -39,6 +39,8 @@ namespace Impl {
 
 #define VB_D2_COLORING_FORBIDDEN_SIZE 64
 #define VBBIT_D2_COLORING_FORBIDDEN_SIZE 64
+// Number of 64-bit words of forbidden colors per hub in VB_HYBRID
+#define HUB_D2_COLORING_FORBIDDEN_WORDS 64
 
 /*!
  * \brief Distance-2 Graph Coloring class
@@ -88,6 +90,8 @@ class GraphColorDistance2 {
   rowmap_t t_xadj;        // transpose rowmap (aliases xadj if !doing_bipartite)
   entries_t t_adj;        // transpose entries (aliases adj if !doing_bipartite)
   HandleType* gc_handle;  // pointer to the graph coloring handle
+  size_type hub_degree;   // VB_HYBRID: vertices of higher degree are hubs
+  lno_view_t hub_list;    // VB_HYBRID: the hubs of the current phase
 
  private:
   int _chunkSize;  // the size of the minimum work unit assigned to threads.
@@ -120,6 +124,7 @@ class GraphColorDistance2 {
         t_xadj(t_row_map),
         t_adj(t_entries),
         gc_handle(handle),
+        hub_degree(Kokkos::ArithTraits<size_type>::max()),
         _chunkSize(handle->get_vb_chunk_size()),
         _max_num_iterations(handle->get_max_number_of_iterations()),
         _ticToc(handle->get_verbose()),
@@ -157,6 +162,13 @@ class GraphColorDistance2 {
       colors_out = color_view_type("Graph Colors", this->nr);
     }
     switch (this->gc_handle->get_coloring_algo_type()) {
+      case COLORING_D2_VB_HYBRID:
+        hub_degree = gc_handle->get_hub_degree();
+        hub_list   = lno_view_t(
+            Kokkos::view_alloc(Kokkos::WithoutInitializing, "hubList"),
+            this->nr);
+        compute_d2_coloring_vb(colors_out);
+        break;
       case COLORING_D2_VB_BIT_EF: using_edge_filtering = true;
       case COLORING_D2_VB_BIT:
       case COLORING_D2_VB: compute_d2_coloring_vb(colors_out); break;
@@ -937,6 +949,38 @@ class GraphColorDistance2 {
                              gc);
       } break;
 
+      // Hybrid vertex/edge based: VB_BIT for the vertices of degree at most
+      // hub_degree, and a team per hub
+      // 1. [P] loop over non-hub vertices, as in VB_BIT
+      // 2. [P] loop over hubs
+      // 3. [S] loop over blocks of HUB_D2_COLORING_FORBIDDEN_WORDS * 64
+      //        colors, in team scratch
+      // 4. [P] loop over hub neighbors
+      // 5. [P] loop over hub neighbors of neighbors
+      case COLORING_D2_VB_HYBRID: {
+        functorGreedyColorVB_BIT gc(this->nr, this->nc, xadj_, adj_, t_xadj_,
+                                    t_adj_, vertex_colors_, current_vertexList_,
+                                    current_vertexListLength_, hub_degree);
+        Kokkos::parallel_for("LoopOverChunks", range_policy_type(0, this->nr),
+                             gc);
+        // The uncolored hubs
+        lno_t numHubs = 0;
+        Kokkos::parallel_scan(
+            "FindHubs", range_policy_type(0, this->nr),
+            functorFindHubs(xadj_, vertex_colors_, lno_view_t(), hub_list,
+                            hub_degree),
+            numHubs);
+        if (numHubs) {
+          functorGreedyColorHub gcHub(this->nr, this->nc, xadj_, adj_, t_xadj_,
+                                      t_adj_, vertex_colors_, hub_list);
+          Kokkos::parallel_for(
+              "ColorHubs",
+              team_policy_type(numHubs, Kokkos::AUTO, hubVectorSize())
+                  .set_scratch_size(0, Kokkos::PerTeam(gcHub.scratchBytes())),
+              gcHub);
+        }
+      } break;
+
       default:
         throw std::invalid_argument(
             "Unknown Distance-2 Algorithm Type or invalid for non Edge "
@@ -990,13 +1034,35 @@ class GraphColorDistance2 {
     swap_work_arrays          = true;
     lno_t output_numUncolored = 0;
 
+    // The hubs of the current list are found before any vertex is uncolored
+    lno_t numHubs = 0;
+    if (hub_list.extent(0)) {
+      Kokkos::parallel_scan(
+          "FindHubs", range_policy_type(0, current_vertexListLength_),
+          functorFindHubs(xadj_, vertex_colors_, current_vertexList_, hub_list,
+                          hub_degree),
+          numHubs);
+    }
+
     functorFindConflicts_Atomic conf(
         this->nr, this->nc, xadj_, adj_, t_xadj_, t_adj_, vertex_colors_,
         current_vertexList_, next_iteration_recolorList_,
-        next_iteration_recolorListLength_);
+        next_iteration_recolorListLength_, hub_degree);
     Kokkos::parallel_reduce("FindConflicts",
                             range_policy_type(0, current_vertexListLength_),
                             conf, output_numUncolored);
+    if (numHubs) {
+      lno_t numHubConflicts = 0;
+      Kokkos::parallel_reduce(
+          "FindHubConflicts",
+          team_policy_type(numHubs, Kokkos::AUTO, hubVectorSize()),
+          functorFindConflictsHub(this->nr, this->nc, xadj_, adj_, t_xadj_,
+                                  t_adj_, vertex_colors_, hub_list,
+                                  next_iteration_recolorList_,
+                                  next_iteration_recolorListLength_),
+          numHubConflicts);
+      output_numUncolored += numHubConflicts;
+    }
     return output_numUncolored;
   }  // findConflicts (end)
 
@@ -1239,11 +1305,13 @@ class GraphColorDistance2 {
     color_view_type _colors;  // vertex colors
     lno_view_t _vertexList;   //
     lno_t _vertexListLength;  //
+    size_type _hubDegree;     // vertices of higher degree are skipped
 
-    functorGreedyColorVB_BIT(lno_t nr_, lno_t nc_, rowmap_t xadj_,
-                             entries_t adj_, rowmap_t t_xadj_, entries_t t_adj_,
-                             color_view_type colors, lno_view_t vertexList,
-                             lno_t vertexListLength)
+    functorGreedyColorVB_BIT(
+        lno_t nr_, lno_t nc_, rowmap_t xadj_, entries_t adj_, rowmap_t t_xadj_,
+        entries_t t_adj_, color_view_type colors, lno_view_t vertexList,
+        lno_t vertexListLength,
+        size_type hubDegree = Kokkos::ArithTraits<size_type>::max())
         : nr(nr_),
           nc(nc_),
           _idx(xadj_),
@@ -1252,7 +1320,8 @@ class GraphColorDistance2 {
           _t_adj(t_adj_),
           _colors(colors),
           _vertexList(vertexList),
-          _vertexListLength(vertexListLength) {}
+          _vertexListLength(vertexListLength),
+          _hubDegree(hubDegree) {}
 
     // Color vertex i with smallest available color.
     //
@@ -1269,6 +1338,7 @@ class GraphColorDistance2 {
       if (_colors(vid) == 0) {
         const size_type vid_adj_begin = _idx(vid);
         const size_type vid_adj_end   = _idx(vid + 1);
+        if (vid_adj_end - vid_adj_begin > _hubDegree) return;
 
         for (color_type offset = 1;
              offset <= (nr + VBBIT_D2_COLORING_FORBIDDEN_SIZE);
@@ -1542,12 +1612,13 @@ class GraphColorDistance2 {
     lno_view_t _vertexList;
     lno_view_t _recolorList;
     single_lno_view_t _recolorListLength;
+    size_type _hubDegree;  // vertices of higher degree are skipped
 
-    functorFindConflicts_Atomic(lno_t nr_, lno_t nc_, rowmap_t xadj_,
-                                entries_t adj_, rowmap_t t_xadj_,
-                                entries_t t_adj_, color_view_type colors,
-                                lno_view_t vertexList, lno_view_t recolorList,
-                                single_lno_view_t recolorListLength)
+    functorFindConflicts_Atomic(
+        lno_t nr_, lno_t nc_, rowmap_t xadj_, entries_t adj_, rowmap_t t_xadj_,
+        entries_t t_adj_, color_view_type colors, lno_view_t vertexList,
+        lno_view_t recolorList, single_lno_view_t recolorListLength,
+        size_type hubDegree = Kokkos::ArithTraits<size_type>::max())
         : nr(nr_),
           nc(nc_),
           _idx(xadj_),
@@ -1557,7 +1628,8 @@ class GraphColorDistance2 {
           _colors(colors),
           _vertexList(vertexList),
           _recolorList(recolorList),
-          _recolorListLength(recolorListLength) {}
+          _recolorListLength(recolorListLength),
+          _hubDegree(hubDegree) {}
 
     KOKKOS_INLINE_FUNCTION
     void operator()(const lno_t i, lno_t& numConflicts) const {
@@ -1565,6 +1637,7 @@ class GraphColorDistance2 {
       const color_type my_color        = _colors(vid);
       const size_type vid_d1_adj_begin = _idx(vid);
       const size_type vid_d1_adj_end   = _idx(vid + 1);
+      if (vid_d1_adj_end - vid_d1_adj_begin > _hubDegree) return;
       // If vid is a valid column (vid < nc), check for column->vert conflicts
       for (size_type vid_d1_adj = vid_d1_adj_begin; vid_d1_adj < vid_d1_adj_end;
            vid_d1_adj++) {
@@ -1605,7 +1678,218 @@ class GraphColorDistance2 {
       }  // for vid_d1_adj ...
     }    // operator() (end)
   };     // struct functorFindConflicts_Atomic (end)
-};       // end class GraphColorDistance2
+
+  int hubVectorSize() const {
+    return KokkosKernels::Impl::kk_get_suggested_vector_size(
+        this->nr, this->ne,
+        KokkosKernels::Impl::kk_get_exec_space_type<execution_space>());
+  }
+
+  /**
+   * Functor to list the hubs (vertices of degree > hubDegree): the uncolored
+   * ones among all vertices if vertexList is empty, else all the ones in
+   * vertexList.
+   */
+  struct functorFindHubs {
+    rowmap_t _idx;
+    color_view_type _colors;
+    lno_view_t _vertexList;
+    lno_view_t _hubs;
+    size_type _hubDegree;
+
+    functorFindHubs(rowmap_t xadj_, color_view_type colors,
+                    lno_view_t vertexList, lno_view_t hubs, size_type hubDegree)
+        : _idx(xadj_),
+          _colors(colors),
+          _vertexList(vertexList),
+          _hubs(hubs),
+          _hubDegree(hubDegree) {}
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const lno_t i, lno_t& lnum, const bool final) const {
+      lno_t vid = i;
+      if (_vertexList.extent(0)) {
+        vid = _vertexList(i);
+      } else if (_colors(vid)) {
+        return;
+      }
+      if (_idx(vid + 1) - _idx(vid) <= _hubDegree) return;
+      if (final) _hubs(lnum) = vid;
+      lnum++;
+    }
+  };  // struct functorFindHubs (end)
+
+  /**
+   * Functor for VB_HYBRID coloring of the hubs: a team per hub scans its
+   * distance-2 neighborhood in parallel, marking the colors of a block of
+   * HUB_D2_COLORING_FORBIDDEN_WORDS * 64 in a bitset in team scratch, and
+   * moves to the next block if they are all taken. The memory per hub does
+   * not depend on its degree.
+   */
+  struct functorGreedyColorHub {
+    static constexpr int numWords   = HUB_D2_COLORING_FORBIDDEN_WORDS;
+    static constexpr int windowSize = 64 * HUB_D2_COLORING_FORBIDDEN_WORDS;
+
+    lno_t nr;                 // num vertices
+    lno_t nc;                 // num columns
+    rowmap_t _idx;            // vertex degree list
+    entries_t _adj;           // vertex adjacency list
+    rowmap_t _t_idx;          // transpose vertex degree list
+    entries_t _t_adj;         // transpose vertex adjacency list
+    color_view_type _colors;  // vertex colors
+    lno_view_t _hubs;         // the hubs to color
+
+    functorGreedyColorHub(lno_t nr_, lno_t nc_, rowmap_t xadj_, entries_t adj_,
+                          rowmap_t t_xadj_, entries_t t_adj_,
+                          color_view_type colors, lno_view_t hubs)
+        : nr(nr_),
+          nc(nc_),
+          _idx(xadj_),
+          _adj(adj_),
+          _t_idx(t_xadj_),
+          _t_adj(t_adj_),
+          _colors(colors),
+          _hubs(hubs) {}
+
+    size_t scratchBytes() const {
+      return numWords * sizeof(bit_64_forbidden_type);
+    }
+
+    // Marks color as forbidden, if it is in the block of offset
+    KOKKOS_INLINE_FUNCTION
+    static void ban(bit_64_forbidden_type* forbidden, const color_type offset,
+                    const color_type color) {
+      if (color < offset || color - offset >= color_type(windowSize)) return;
+      const color_type bit = color - offset;
+      Kokkos::atomic_fetch_or(&forbidden[bit / 64],
+                              bit_64_forbidden_type(1) << (bit % 64));
+    }
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const team_member_type& t) const {
+      const lno_t vid = _hubs(t.league_rank());
+      bit_64_forbidden_type* forbidden =
+          (bit_64_forbidden_type*)t.team_shmem().get_shmem(scratchBytes());
+      for (color_type offset = 1; offset <= nr + windowSize;
+           offset += windowSize) {
+        Kokkos::parallel_for(Kokkos::TeamVectorRange(t, numWords),
+                             [&](const int i) { forbidden[i] = 0; });
+        t.team_barrier();
+        Kokkos::parallel_for(
+            Kokkos::TeamThreadRange(t, _idx(vid), _idx(vid + 1)),
+            [&](const size_type vid_adj) {
+              const lno_t vid_d1 = _adj(vid_adj);
+              if (vid_d1 >= nc) return;
+              if (!doing_bipartite && vid_d1 != vid) {
+                Kokkos::single(Kokkos::PerThread(t), [&]() {
+                  ban(forbidden, offset, _colors(vid_d1));
+                });
+              }
+              Kokkos::parallel_for(
+                  Kokkos::ThreadVectorRange(t, _t_idx(vid_d1),
+                                            _t_idx(vid_d1 + 1)),
+                  [&](const size_type vid_d1_adj) {
+                    const lno_t vid_d2 = _t_adj(vid_d1_adj);
+                    if (vid_d2 != vid && vid_d2 < nr)
+                      ban(forbidden, offset, _colors(vid_d2));
+                  });
+            });
+        t.team_barrier();
+        // The first free color of the block
+        int firstFree = windowSize;
+        Kokkos::parallel_reduce(
+            Kokkos::TeamThreadRange(t, numWords),
+            [&](const int i, int& lmin) {
+              const bit_64_forbidden_type avail = ~forbidden[i];
+              if (avail) {
+                const int c =
+                    64 * i + KokkosKernels::Impl::least_set_bit(avail) - 1;
+                if (c < lmin) lmin = c;
+              }
+            },
+            Kokkos::Min<int>(firstFree));
+        if (firstFree < windowSize) {
+          Kokkos::single(Kokkos::PerTeam(t),
+                         [&]() { _colors(vid) = offset + firstFree; });
+          return;
+        }
+        t.team_barrier();
+      }
+    }  // operator() (end)
+  };   // struct functorGreedyColorHub (end)
+
+  /**
+   * Functor for VB_HYBRID conflict detection of the hubs, with a team per hub
+   */
+  struct functorFindConflictsHub {
+    lno_t nr;  // num verts
+    lno_t nc;  // num columns
+    rowmap_t _idx;
+    entries_t _adj;
+    rowmap_t _t_idx;
+    entries_t _t_adj;
+    color_view_type _colors;
+    lno_view_t _hubs;
+    lno_view_t _recolorList;
+    single_lno_view_t _recolorListLength;
+
+    functorFindConflictsHub(lno_t nr_, lno_t nc_, rowmap_t xadj_,
+                            entries_t adj_, rowmap_t t_xadj_, entries_t t_adj_,
+                            color_view_type colors, lno_view_t hubs,
+                            lno_view_t recolorList,
+                            single_lno_view_t recolorListLength)
+        : nr(nr_),
+          nc(nc_),
+          _idx(xadj_),
+          _adj(adj_),
+          _t_idx(t_xadj_),
+          _t_adj(t_adj_),
+          _colors(colors),
+          _hubs(hubs),
+          _recolorList(recolorList),
+          _recolorListLength(recolorListLength) {}
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const team_member_type& t, lno_t& numConflicts) const {
+      const lno_t vid           = _hubs(t.league_rank());
+      const color_type my_color = _colors(vid);
+      lno_t numSame             = 0;
+      Kokkos::parallel_reduce(
+          Kokkos::TeamThreadRange(t, _idx(vid), _idx(vid + 1)),
+          [&](const size_type vid_adj, lno_t& lsame) {
+            const lno_t vid_d1 = _adj(vid_adj);
+            if (vid_d1 >= nc) return;
+            lno_t same = 0;
+            Kokkos::parallel_reduce(
+                Kokkos::ThreadVectorRange(t, _t_idx(vid_d1),
+                                          _t_idx(vid_d1 + 1)),
+                [&](const size_type vid_d1_adj, lno_t& lsame2) {
+                  const lno_t vid_d2 = _t_adj(vid_d1_adj);
+                  if (vid_d2 != vid && vid_d2 < nr &&
+                      _colors(vid_d2) == my_color)
+                    lsame2++;
+                },
+                same);
+            // check for dist-1 conflict
+            if (!doing_bipartite && vid_d1 != vid &&
+                _colors(vid_d1) == my_color)
+              same++;
+            lsame += same;
+          },
+          numSame);
+      if (numSame) {
+        Kokkos::single(Kokkos::PerTeam(t), [&]() {
+          _colors(vid) = 0;  // uncolor vertex
+          // Atomically add vertex to recolorList
+          const lno_t k =
+              Kokkos::atomic_fetch_add(&_recolorListLength(), lno_t(1));
+          _recolorList(k) = vid;
+          numConflicts++;
+        });
+      }
+    }  // operator() (end)
+  };   // struct functorFindConflictsHub (end)
+};     // end class GraphColorDistance2
 
 /**
  * Prints out a histogram of graph colors for Distance-2 Graph Coloring
@@ -21,11 +21,82 @@
 #include "Kokkos_Bitset.hpp"
 #include "KokkosKernels_Utils.hpp"
 #include "KokkosSparse_Utils.hpp"
+#include <algorithm>
 #include <cstdint>
 
 namespace KokkosGraph {
 namespace Impl {
 
+// Whether entry j is an edge of the graph that the MIS/aggregation works on:
+// every entry, unless a subset of strong edges was given.
+template <typename bitset_t, typename size_type>
+KOKKOS_INLINE_FUNCTION bool d2_mis_strong_edge(const bitset_t& strongEdges,
+                                               size_type j) {
+  return strongEdges.size() == 0 || strongEdges.test(j);
+}
+
+// Normalize user-provided vertex priorities (higher = more preferred in the
+// independent set) to scores in [0, 1] (lower = more preferred), which the
+// MIS algorithms quantize into the high bits of the row statuses.
+template <typename device_t, typename priorities_t>
+struct D2_MIS_PriorityScores {
+  using exec_space     = typename device_t::execution_space;
+  using mem_space      = typename device_t::memory_space;
+  using range_pol      = Kokkos::RangePolicy<exec_space>;
+  using priority_t     = typename priorities_t::non_const_value_type;
+  using score_view_t   = Kokkos::View<float*, mem_space>;
+  using minmax_t       = Kokkos::MinMax<priority_t>;
+  using minmax_value_t = typename minmax_t::value_type;
+
+  struct MinMaxFunctor {
+    MinMaxFunctor(const priorities_t& priorities_) : priorities(priorities_) {}
+
+    KOKKOS_INLINE_FUNCTION void operator()(size_t i,
+                                           minmax_value_t& lminmax) const {
+      priority_t p = priorities(i);
+      if (p < lminmax.min_val) lminmax.min_val = p;
+      if (p > lminmax.max_val) lminmax.max_val = p;
+    }
+
+    priorities_t priorities;
+  };
+
+  struct ScoreFunctor {
+    ScoreFunctor(const priorities_t& priorities_, const score_view_t& scores_,
+                 priority_t maxPriority_, double invRange_)
+        : priorities(priorities_),
+          scores(scores_),
+          maxPriority(maxPriority_),
+          invRange(invRange_) {}
+
+    KOKKOS_INLINE_FUNCTION void operator()(size_t i) const {
+      scores(i) = (float)((double)(maxPriority - priorities(i)) * invRange);
+    }
+
+    priorities_t priorities;
+    score_view_t scores;
+    priority_t maxPriority;
+    double invRange;
+  };
+
+  static score_view_t compute(const priorities_t& priorities) {
+    size_t n = priorities.extent(0);
+    score_view_t scores(Kokkos::view_alloc(Kokkos::WithoutInitializing,
+                                           "MIS2 priority scores"),
+                        n);
+    minmax_value_t minmax;
+    Kokkos::parallel_reduce(range_pol(0, n), MinMaxFunctor(priorities),
+                            minmax_t(minmax));
+    // If all priorities are equal, every score is 0
+    double range    = (double)(minmax.max_val - minmax.min_val);
+    double invRange = range > 0 ? 1.0 / range : 0.0;
+    Kokkos::parallel_for(
+        range_pol(0, n),
+        ScoreFunctor(priorities, scores, minmax.max_val, invRange));
+    return scores;
+  }
+};
+
 template <typename device_t, typename rowmap_t, typename entries_t,
           typename lno_view_t>
 struct D2_MIS_RandomPriority {
@@ -43,6 +114,7 @@ struct D2_MIS_RandomPriority {
   using team_mem        = typename team_pol::member_type;
   using all_worklists_t = Kokkos::View<lno_t**, Kokkos::LayoutLeft, mem_space>;
   using worklist_t      = Kokkos::View<lno_t*, Kokkos::LayoutLeft, mem_space>;
+  using score_view_t    = Kokkos::View<float*, mem_space>;
 
   // Priority values 0 and max are special, they mean the vertex is
   // in the independent set or eliminated from consideration, respectively.
@@ -53,14 +125,29 @@ struct D2_MIS_RandomPriority {
   static constexpr status_t IN_SET  = 0;
   static constexpr status_t OUT_SET = ~IN_SET;
 
-  D2_MIS_RandomPriority(const rowmap_t& rowmap_, const entries_t& entries_)
-      : rowmap(rowmap_), entries(entries_), numVerts(rowmap.extent(0) - 1) {
+  // Optionally, scores (from D2_MIS_PriorityScores) take precedence over the
+  // random priorities, and the MIS is computed on the subgraph of the entries
+  // set in strongEdges (which must be symmetric).
+  D2_MIS_RandomPriority(const rowmap_t& rowmap_, const entries_t& entries_,
+                        const score_view_t& scores_        = score_view_t(),
+                        const const_bitset_t& strongEdges_ = const_bitset_t())
+      : rowmap(rowmap_),
+        entries(entries_),
+        numVerts(rowmap.extent(0) - 1),
+        scores(scores_),
+        strongEdges(strongEdges_) {
     status_t i = numVerts + 1;
     nvBits     = 0;
     while (i) {
       i >>= 1;
       nvBits++;
     }
+    // Split the bits above the vertex ID between the random priorities and the
+    // user scores (most significant, at most 16 bits so that the float scores
+    // are quantized exactly)
+    scoreBits = 0;
+    if (scores.extent(0))
+      scoreBits = std::min<int>(16, (sizeof(status_t) * 8 - nvBits) / 2);
     // Each value in rowStatus represents the status and priority of each row.
     // Each value in colStatus represents the lowest nonzero priority of any row
     // adjacent to the column.
@@ -76,8 +163,13 @@ struct D2_MIS_RandomPriority {
 
   struct RefreshRowStatus {
     RefreshRowStatus(const status_view_t& rowStatus_,
-                     const worklist_t& worklist_, lno_t nvBits_, int round)
-        : rowStatus(rowStatus_), worklist(worklist_), nvBits(nvBits_) {
+                     const worklist_t& worklist_, lno_t nvBits_, int round,
+                     const score_view_t& scores_, int scoreBits_)
+        : rowStatus(rowStatus_),
+          worklist(worklist_),
+          nvBits(nvBits_),
+          scores(scores_),
+          scoreBits(scoreBits_) {
       hashedRound = KokkosKernels::Impl::xorshiftHash<status_t>(round);
     }
 
@@ -89,6 +181,14 @@ struct D2_MIS_RandomPriority {
           KokkosKernels::Impl::xorshiftHash<status_t>(i) ^ hashedRound);
       // Generate unique status per row, with IN_SET < status < OUT_SET,
       status_t newStatus = (status_t)(i + 1) | (priority << nvBits);
+      if (scoreBits) {
+        // The user score replaces the most significant random bits, so that
+        // the random priority only breaks ties between similar scores
+        int scoreShift    = sizeof(status_t) * 8 - scoreBits;
+        status_t maxScore = (((status_t)1) << scoreBits) - 1;
+        status_t score    = ((status_t)(scores(i) * maxScore)) << scoreShift;
+        newStatus         = (newStatus & (OUT_SET >> scoreBits)) | score;
+      }
       if (newStatus == OUT_SET) newStatus--;
       rowStatus(i) = newStatus;
     }
@@ -97,20 +197,24 @@ struct D2_MIS_RandomPriority {
     worklist_t worklist;
     int nvBits;
     uint32_t hashedRound;
+    score_view_t scores;
+    int scoreBits;
   };
 
   struct RefreshColStatus {
     RefreshColStatus(const status_view_t& colStatus_,
                      const worklist_t& worklist_,
                      const status_view_t& rowStatus_, const rowmap_t& rowmap_,
-                     const entries_t& entries_, lno_t nv_, lno_t worklistLen_)
+                     const entries_t& entries_, lno_t nv_, lno_t worklistLen_,
+                     const const_bitset_t& strongEdges_)
         : colStatus(colStatus_),
           worklist(worklist_),
           rowStatus(rowStatus_),
           rowmap(rowmap_),
           entries(entries_),
           nv(nv_),
-          worklistLen(worklistLen_) {}
+          worklistLen(worklistLen_),
+          strongEdges(strongEdges_) {}
 
     KOKKOS_INLINE_FUNCTION void operator()(lno_t w) const {
       lno_t i = worklist(w);
@@ -121,7 +225,7 @@ struct D2_MIS_RandomPriority {
       size_type rowEnd   = rowmap(i + 1);
       for (size_type j = rowBegin; j < rowEnd; j++) {
         lno_t nei = entries(j);
-        if (nei < nv && nei != i) {
+        if (nei < nv && nei != i && d2_mis_strong_edge(strongEdges, j)) {
           status_t neiStat = rowStatus(nei);
           if (neiStat < s) s = neiStat;
         }
@@ -145,7 +249,8 @@ struct D2_MIS_RandomPriority {
           Kokkos::ThreadVectorRange(t, rowLen + 1),
           [&](lno_t j, status_t& ls) {
             lno_t nei = (j == rowLen) ? i : entries(rowBegin + j);
-            if (nei < nv) {
+            if (nei < nv && (j == rowLen ||
+                             d2_mis_strong_edge(strongEdges, rowBegin + j))) {
               status_t neiStat = rowStatus(nei);
               if (neiStat < ls) ls = neiStat;
             }
@@ -164,20 +269,23 @@ struct D2_MIS_RandomPriority {
     entries_t entries;
     lno_t nv;
     lno_t worklistLen;
+    const_bitset_t strongEdges;
   };
 
   struct DecideSetFunctor {
     DecideSetFunctor(const status_view_t& rowStatus_,
                      const status_view_t& colStatus_, const rowmap_t& rowmap_,
                      const entries_t& entries_, lno_t nv_,
-                     const worklist_t& worklist_, lno_t worklistLen_)
+                     const worklist_t& worklist_, lno_t worklistLen_,
+                     const const_bitset_t& strongEdges_)
         : rowStatus(rowStatus_),
           colStatus(colStatus_),
           rowmap(rowmap_),
           entries(entries_),
           nv(nv_),
           worklist(worklist_),
-          worklistLen(worklistLen_) {}
+          worklistLen(worklistLen_),
+          strongEdges(strongEdges_) {}
 
     // Enum values to be used as flags, so that the team policy version can
     // express the neighbor checking as an OR-reduction
@@ -197,6 +305,7 @@ struct D2_MIS_RandomPriority {
       for (size_type j = rowBegin; j <= rowEnd; j++) {
         lno_t nei = (j == rowEnd) ? i : entries(j);
         if (nei >= nv) continue;
+        if (j != rowEnd && !d2_mis_strong_edge(strongEdges, j)) continue;
         status_t neiStat = colStatus(nei);
         if (neiStat == OUT_SET) {
           neiOut = true;
@@ -235,6 +344,8 @@ struct D2_MIS_RandomPriority {
           [&](lno_t j, int& lflags) {
             lno_t nei = (j == rowLen) ? i : entries(rowBegin + j);
             if (nei >= nv) return;
+            if (j != rowLen && !d2_mis_strong_edge(strongEdges, rowBegin + j))
+              return;
             status_t neiStat = colStatus(nei);
             if (neiStat == OUT_SET)
               lflags |= NEI_OUT_SET;
@@ -262,6 +373,7 @@ struct D2_MIS_RandomPriority {
     lno_t nv;
     worklist_t worklist;
     lno_t worklistLen;
+    const_bitset_t strongEdges;
   };
 
   struct CountInSet {
@@ -346,13 +458,15 @@ struct D2_MIS_RandomPriority {
       // DecideSetFunctor (will be constant)
       {
         RefreshColStatus refreshCol(colStatus, colWorklist, rowStatus, rowmap,
-                                    entries, numVerts, colWorkLen);
+                                    entries, numVerts, colWorkLen,
+                                    strongEdges);
         refreshColTeamSize =
             dummyPolicy.team_size_max(refreshCol, Kokkos::ParallelForTag());
       }
       {
         DecideSetFunctor decideSet(rowStatus, colStatus, rowmap, entries,
-                                   numVerts, rowWorklist, rowWorkLen);
+                                   numVerts, rowWorklist, rowWorkLen,
+                                   strongEdges);
         decideSetTeamSize =
             dummyPolicy.team_size_max(decideSet, Kokkos::ParallelForTag());
       }
@@ -361,11 +475,13 @@ struct D2_MIS_RandomPriority {
       // Compute new row statuses
       Kokkos::parallel_for(
           range_pol(0, rowWorkLen),
-          RefreshRowStatus(rowStatus, rowWorklist, nvBits, round));
+          RefreshRowStatus(rowStatus, rowWorklist, nvBits, round, scores,
+                           scoreBits));
       // Compute new col statuses
       {
         RefreshColStatus refreshCol(colStatus, colWorklist, rowStatus, rowmap,
-                                    entries, numVerts, colWorkLen);
+                                    entries, numVerts, colWorkLen,
+                                    strongEdges);
         if (useTeams)
           Kokkos::parallel_for(team_pol((colWorkLen + refreshColTeamSize - 1) /
                                             refreshColTeamSize,
@@ -377,7 +493,8 @@ struct D2_MIS_RandomPriority {
       // Decide row statuses where enough information is available
       {
         DecideSetFunctor decideSet(rowStatus, colStatus, rowmap, entries,
-                                   numVerts, rowWorklist, rowWorkLen);
+                                   numVerts, rowWorklist, rowWorkLen,
+                                   strongEdges);
         if (useTeams)
           Kokkos::parallel_for(
               team_pol((rowWorkLen + decideSetTeamSize - 1) / decideSetTeamSize,
@@ -444,13 +561,15 @@ struct D2_MIS_RandomPriority {
       // DecideSetFunctor (will be constant)
       {
         RefreshColStatus refreshCol(colStatus, colWorklist, rowStatus, rowmap,
-                                    entries, numVerts, colWorkLen);
+                                    entries, numVerts, colWorkLen,
+                                    strongEdges);
         refreshColTeamSize =
             dummyPolicy.team_size_max(refreshCol, Kokkos::ParallelForTag());
       }
       {
         DecideSetFunctor decideSet(rowStatus, colStatus, rowmap, entries,
-                                   numVerts, rowWorklist, rowWorkLen);
+                                   numVerts, rowWorklist, rowWorkLen,
+                                   strongEdges);
         decideSetTeamSize =
             dummyPolicy.team_size_max(decideSet, Kokkos::ParallelForTag());
       }
@@ -459,11 +578,13 @@ struct D2_MIS_RandomPriority {
       // Compute new row statuses
       Kokkos::parallel_for(
           range_pol(0, rowWorkLen),
-          RefreshRowStatus(rowStatus, rowWorklist, nvBits, round));
+          RefreshRowStatus(rowStatus, rowWorklist, nvBits, round, scores,
+                           scoreBits));
       // Compute new col statuses
       {
         RefreshColStatus refreshCol(colStatus, colWorklist, rowStatus, rowmap,
-                                    entries, numVerts, colWorkLen);
+                                    entries, numVerts, colWorkLen,
+                                    strongEdges);
         if (useTeams)
           Kokkos::parallel_for(team_pol((colWorkLen + refreshColTeamSize - 1) /
                                             refreshColTeamSize,
@@ -475,7 +596,8 @@ struct D2_MIS_RandomPriority {
       // Decide row statuses where enough information is available
       {
         DecideSetFunctor decideSet(rowStatus, colStatus, rowmap, entries,
-                                   numVerts, rowWorklist, rowWorkLen);
+                                   numVerts, rowWorklist, rowWorkLen,
+                                   strongEdges);
         if (useTeams)
           Kokkos::parallel_for(
               team_pol((rowWorkLen + decideSetTeamSize - 1) / decideSetTeamSize,
@@ -521,6 +643,11 @@ struct D2_MIS_RandomPriority {
   // tiebreak scheme:
   //  ceil(log_2(numVerts + 1))
   int nvBits;
+  // Optional user priority scores, and the number of status bits they get
+  score_view_t scores;
+  int scoreBits;
+  // Optional subset of the entries to use as edges (empty = all entries)
+  const_bitset_t strongEdges;
 };
 
 template <typename device_t, typename rowmap_t, typename entries_t,
@@ -536,6 +663,7 @@ struct D2_MIS_FixedPriority {
   using status_t      = typename std::make_unsigned<lno_t>::type;
   using status_view_t = Kokkos::View<status_t*, mem_space>;
   using range_pol     = Kokkos::RangePolicy<exec_space>;
+  using score_view_t  = Kokkos::View<float*, mem_space>;
 
   // Priority values 0 and max are special, they mean the vertex is
   // in the independent set or eliminated from consideration, respectively.
@@ -546,7 +674,10 @@ struct D2_MIS_FixedPriority {
   static constexpr status_t IN_SET  = 0;
   static constexpr status_t OUT_SET = ~IN_SET;
 
-  D2_MIS_FixedPriority(const rowmap_t& rowmap_, const entries_t& entries_)
+  // If scores (from D2_MIS_PriorityScores) are given, they replace the
+  // normalized degrees in the priorities.
+  D2_MIS_FixedPriority(const rowmap_t& rowmap_, const entries_t& entries_,
+                       const score_view_t& scores_ = score_view_t())
       : rowmap(rowmap_),
         entries(entries_),
         numVerts(rowmap.extent(0) - 1),
@@ -575,7 +706,7 @@ struct D2_MIS_FixedPriority {
     // Compute row statuses
     Kokkos::parallel_for(range_pol(0, numVerts),
                          InitRowStatus(rowStatus, rowmap, numVerts, nvBits,
-                                       minDegree, maxDegree));
+                                       minDegree, maxDegree, scores_));
     // Compute col statuses
     Kokkos::parallel_for(
         range_pol(0, numVerts),
@@ -584,14 +715,16 @@ struct D2_MIS_FixedPriority {
 
   struct InitRowStatus {
     InitRowStatus(const status_view_t& rowStatus_, const rowmap_t& rowmap_,
-                  lno_t nv_, lno_t nvBits_, lno_t minDeg_, lno_t maxDeg_)
+                  lno_t nv_, lno_t nvBits_, lno_t minDeg_, lno_t maxDeg_,
+                  const score_view_t& scores_)
         : rowStatus(rowStatus_),
           rowmap(rowmap_),
           nv(nv_),
           nvBits(nvBits_),
           minDeg(minDeg_),
           maxDeg(maxDeg_),
-          invDegRange(1.f / (maxDeg - minDeg)) {}
+          invDegRange(1.f / (maxDeg - minDeg)),
+          scores(scores_) {}
 
     KOKKOS_INLINE_FUNCTION void operator()(lno_t i) const {
       // Generate unique status per row, with IN_SET < status < OUT_SET,
@@ -604,7 +737,9 @@ struct D2_MIS_FixedPriority {
       }
       status_t maxDegRange = (((status_t)1) << degBits) - 2;
       lno_t deg            = rowmap(i + 1) - rowmap(i);
-      float degScore       = (float)(deg - minDeg) * invDegRange;
+      float degScore       = scores.extent(0)
+                                 ? scores(i)
+                                 : (float)(deg - minDeg) * invDegRange;
       rowStatus(i) =
           (status_t)(i + 1) + (((status_t)(degScore * maxDegRange)) << nvBits);
     }
@@ -616,6 +751,7 @@ struct D2_MIS_FixedPriority {
     lno_t minDeg;
     lno_t maxDeg;
     float invDegRange;
+    score_view_t scores;
   };
 
   struct InitColStatus {
@@ -899,27 +1035,65 @@ struct D2_MIS_Aggregation {
   using status_view_t = Kokkos::View<status_t*, mem_space>;
   using range_pol     = Kokkos::RangePolicy<exec_space>;
   using mis2_view     = Kokkos::View<lno_t*, mem_space>;
+  using score_view_t  = Kokkos::View<float*, mem_space>;
 
-  D2_MIS_Aggregation(const rowmap_t& rowmap_, const entries_t& entries_)
+  // If strongEdges is given (a symmetric subset of the entries), aggregates
+  // are formed only through the strong edges: roots are an MIS-2 of the
+  // strong subgraph, and take only their strong neighbors.
+  D2_MIS_Aggregation(const rowmap_t& rowmap_, const entries_t& entries_,
+                     const const_bitset_t& strongEdges_ = const_bitset_t())
       : rowmap(rowmap_),
         entries(entries_),
         numVerts(rowmap.extent(0) - 1),
         labels(Kokkos::ViewAllocateWithoutInitializing("AggregateLabels"),
                numVerts),
-        roots("Root Status", numVerts) {
+        roots("Root Status", numVerts),
+        strongEdges(strongEdges_) {
     Kokkos::deep_copy(labels, (lno_t)-1);
   }
 
+  // Mark the entries with weight >= threshold in strongEdges
+  template <typename weights_t>
+  struct StrongEdgesFunctor {
+    using weight_t = typename weights_t::non_const_value_type;
+
+    StrongEdgesFunctor(const weights_t& weights_, weight_t threshold_,
+                       const bitset_t& strongEdges_)
+        : weights(weights_), threshold(threshold_), strongEdges(strongEdges_) {}
+
+    KOKKOS_INLINE_FUNCTION void operator()(size_type j) const {
+      if (weights(j) >= threshold) strongEdges.set(j);
+    }
+
+    weights_t weights;
+    weight_t threshold;
+    bitset_t strongEdges;
+  };
+
+  template <typename weights_t>
+  static bitset_t findStrongEdges(
+      const weights_t& weights,
+      typename weights_t::non_const_value_type threshold) {
+    size_type nnz = weights.extent(0);
+    bitset_t strong(nnz);
+    Kokkos::parallel_for(
+        range_pol(0, nnz),
+        StrongEdgesFunctor<weights_t>(weights, threshold, strong));
+    return strong;
+  }
+
   struct Phase1Functor {
     Phase1Functor(lno_t numVerts__, const mis2_view& m1__,
                   const rowmap_t& rowmap__, const entries_t& entries__,
-                  const labels_t& labels__, const char_view_t& roots__)
+                  const labels_t& labels__, const char_view_t& roots__,
+                  const const_bitset_t& strongEdges__)
         : numVerts_(numVerts__),
           m1_(m1__),
           rowmap_(rowmap__),
           entries_(entries__),
           labels_(labels__),
-          roots_(roots__) {}
+          roots_(roots__),
+          strongEdges_(strongEdges__) {}
 
     KOKKOS_INLINE_FUNCTION void operator()(lno_t agg) const {
       lno_t root         = m1_(agg);
@@ -929,7 +1103,8 @@ struct D2_MIS_Aggregation {
       labels_(root)      = agg;
       for (size_type j = rowBegin; j < rowEnd; j++) {
         lno_t nei = entries_(j);
-        if (nei < numVerts_) labels_(nei) = agg;
+        if (nei < numVerts_ && d2_mis_strong_edge(strongEdges_, j))
+          labels_(nei) = agg;
       }
     }
 
@@ -939,17 +1114,18 @@ struct D2_MIS_Aggregation {
     entries_t entries_;
     labels_t labels_;
     char_view_t roots_;
+    const_bitset_t strongEdges_;
   };
 
   void createPrimaryAggregates() {
     // Compute an MIS-2
     D2_MIS_RandomPriority<device_t, rowmap_t, entries_t, mis2_view> d2mis(
-        rowmap, entries);
+        rowmap, entries, score_view_t(), strongEdges);
     mis2_view m1 = d2mis.compute();
     // Construct initial aggregates using roots and all direct neighbors
-    Kokkos::parallel_for(
-        range_pol(0, m1.extent(0)),
-        Phase1Functor(numVerts, m1, rowmap, entries, labels, roots));
+    Kokkos::parallel_for(range_pol(0, m1.extent(0)),
+                         Phase1Functor(numVerts, m1, rowmap, entries, labels,
+                                       roots, strongEdges));
     numAggs = m1.extent(0);
   }
 
@@ -957,13 +1133,15 @@ struct D2_MIS_Aggregation {
     CandAggSizesFunctor(lno_t numVerts__, const labels_t& m2__,
                         const rowmap_t& rowmap__, const entries_t& entries__,
                         const labels_t& labels__,
-                        const labels_t& candAggSizes__)
+                        const labels_t& candAggSizes__,
+                        const const_bitset_t& strongEdges__)
         : numVerts_(numVerts__),
           m2_(m2__),
           rowmap_(rowmap__),
           entries_(entries__),
           labels_(labels__),
-          candAggSizes_(candAggSizes__) {}
+          candAggSizes_(candAggSizes__),
+          strongEdges_(strongEdges__) {}
 
     KOKKOS_INLINE_FUNCTION void operator()(lno_t i) const {
       lno_t candRoot = m2_(i);
@@ -974,6 +1152,7 @@ struct D2_MIS_Aggregation {
       for (size_type j = rowBegin; j < rowEnd; j++) {
         lno_t nei = entries_(j);
         if (nei == candRoot || nei >= numVerts_) continue;
+        if (!d2_mis_strong_edge(strongEdges_, j)) continue;
         if (labels_(nei) == -1) aggSize++;
       }
       candAggSizes_(i) = aggSize;
@@ -985,6 +1164,7 @@ struct D2_MIS_Aggregation {
     entries_t entries_;
     labels_t labels_;
     labels_t candAggSizes_;
+    const_bitset_t strongEdges_;
   };
 
   struct ChoosePhase2AggsFunctor {
@@ -993,7 +1173,8 @@ struct D2_MIS_Aggregation {
                             const entries_t& entries__,
                             const labels_t& labels__,
                             const labels_t& candAggSizes__,
-                            const char_view_t& roots__)
+                            const char_view_t& roots__,
+                            const const_bitset_t& strongEdges__)
         : numVerts_(numVerts__),
           numAggs_(numAggs__),
           m2_(m2__),
@@ -1001,7 +1182,8 @@ struct D2_MIS_Aggregation {
           entries_(entries__),
           labels_(labels__),
           candAggSizes_(candAggSizes__),
-          roots_(roots__) {}
+          roots_(roots__),
+          strongEdges_(strongEdges__) {}
 
     KOKKOS_INLINE_FUNCTION void operator()(lno_t i, lno_t& lid,
                                            bool finalPass) const {
@@ -1018,6 +1200,7 @@ struct D2_MIS_Aggregation {
         for (size_type j = rowBegin; j < rowEnd; j++) {
           lno_t nei = entries_(j);
           if (nei == root || nei >= numVerts_) continue;
+          if (!d2_mis_strong_edge(strongEdges_, j)) continue;
           if (labels_(nei) == -1) labels_(nei) = aggID;
         }
       }
@@ -1032,6 +1215,7 @@ struct D2_MIS_Aggregation {
     labels_t labels_;
     labels_t candAggSizes_;
     char_view_t roots_;
+    const_bitset_t strongEdges_;
   };
 
   void createSecondaryAggregates() {
@@ -1040,13 +1224,14 @@ struct D2_MIS_Aggregation {
         numVerts);
     // Compute a new MIS-2 from only unaggregated nodes
     D2_MIS_RandomPriority<device_t, rowmap_t, entries_t, labels_t> d2mis(
-        rowmap, entries);
+        rowmap, entries, score_view_t(), strongEdges);
     labels_t m2        = d2mis.compute(labels);
     lno_t numCandRoots = m2.extent(0);
     // Compute the sizes of would-be aggregates.
     Kokkos::parallel_for(range_pol(0, numCandRoots),
                          CandAggSizesFunctor(numVerts, m2, rowmap, entries,
-                                             labels, candAggSizes));
+                                             labels, candAggSizes,
+                                             strongEdges));
     // Now, filter out the candidate aggs which are big enough, and create those
     // aggregates. Using a scan for this assigns IDs deterministically (unlike
     // an atomic counter).
@@ -1054,7 +1239,7 @@ struct D2_MIS_Aggregation {
     Kokkos::parallel_scan(
         range_pol(0, numCandRoots),
         ChoosePhase2AggsFunctor(numVerts, numAggs, m2, rowmap, entries, labels,
-                                candAggSizes, roots),
+                                candAggSizes, roots, strongEdges),
         numNewAggs);
     numAggs += numNewAggs;
   }
@@ -1064,13 +1249,15 @@ struct D2_MIS_Aggregation {
                                const entries_t& entries__,
                                const labels_t& labels__,
                                const labels_t& connectivities__,
-                               const labels_t& aggSizes__)
+                               const labels_t& aggSizes__,
+                               const const_bitset_t& strongEdges__)
         : numVerts_(numVerts__),
           rowmap_(rowmap__),
           entries_(entries__),
           labels_(labels__),
           connectivities_(connectivities__),
-          aggSizes_(aggSizes__) {}
+          aggSizes_(aggSizes__),
+          strongEdges_(strongEdges__) {}
 
     KOKKOS_INLINE_FUNCTION void operator()(lno_t i) const {
       lno_t agg = labels_(i);
@@ -1083,6 +1270,7 @@ struct D2_MIS_Aggregation {
         for (size_type j = rowBegin; j < rowEnd; j++) {
           lno_t nei = entries_(j);
           if (nei == i || nei >= numVerts_) continue;
+          if (!d2_mis_strong_edge(strongEdges_, j)) continue;
           lno_t neiAgg = labels_(nei);
           if (neiAgg == agg) connect++;
         }
@@ -1097,6 +1285,7 @@ struct D2_MIS_Aggregation {
     labels_t labels_;
     labels_t connectivities_;
     labels_t aggSizes_;
+    const_bitset_t strongEdges_;
   };
 
   struct AssignLeftoverFunctor {
@@ -1105,7 +1294,8 @@ struct D2_MIS_Aggregation {
                           const labels_t& labelsOld__,
                           const labels_t& connectivities__,
                           const labels_t& aggSizes__,
-                          const char_view_t& roots__)
+                          const char_view_t& roots__,
+                          const const_bitset_t& strongEdges__)
         : numVerts_(numVerts__),
           rowmap_(rowmap__),
           entries_(entries__),
@@ -1113,7 +1303,8 @@ struct D2_MIS_Aggregation {
           labelsOld_(labelsOld__),
           connectivities_(connectivities__),
           aggSizes_(aggSizes__),
-          roots_(roots__) {}
+          roots_(roots__),
+          strongEdges_(strongEdges__) {}
 
     KOKKOS_INLINE_FUNCTION void operator()(lno_t i) const {
       lno_t agg               = labelsOld_(i);
@@ -1131,6 +1322,7 @@ struct D2_MIS_Aggregation {
       for (size_type j = rowBegin; j < rowEnd; j++) {
         lno_t nei = entries_(j);
         if (nei == i || nei >= numVerts_) continue;
+        if (!d2_mis_strong_edge(strongEdges_, j)) continue;
         lno_t neiAgg = labelsOld_(nei);
         if (neiAgg == -1 || neiAgg == agg) continue;
         // Try to find neiAgg in tracked
@@ -1186,6 +1378,7 @@ struct D2_MIS_Aggregation {
     labels_t connectivities_;
     labels_t aggSizes_;
     char_view_t roots_;
+    const_bitset_t strongEdges_;
   };
 
   void aggregateLeftovers() {
@@ -1201,12 +1394,12 @@ struct D2_MIS_Aggregation {
     Kokkos::parallel_for(
         range_pol(0, numVerts),
         SizeAndConnectivityFunctor(numVerts, rowmap, entries, labels,
-                                   connectivities, aggSizes));
+                                   connectivities, aggSizes, strongEdges));
     // Now, join vertices to aggregates
     Kokkos::parallel_for(
         range_pol(0, numVerts),
         AssignLeftoverFunctor(numVerts, rowmap, entries, labels, labelsOld,
-                              connectivities, aggSizes, roots));
+                              connectivities, aggSizes, roots, strongEdges));
   }
 
   // phase 2 creates new aggregates in between the initial MIS-2 neighborhoods.
@@ -1237,6 +1430,7 @@ struct D2_MIS_Aggregation {
   lno_t numAggs;
   labels_t labels;
   char_view_t roots;
+  const_bitset_t strongEdges;
 };
 
 }  // namespace Impl
@@ -17,6 +17,10 @@
 #ifndef KOKKOSGRAPH_EXPLICIT_COARSEN_IMPL_HPP
 #define KOKKOSGRAPH_EXPLICIT_COARSEN_IMPL_HPP
 
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Bitset.hpp>
+#include "KokkosKernels_Utils.hpp"
+
 namespace KokkosGraph {
 namespace Impl {
 
@@ -305,6 +309,100 @@ struct ExplicitGraphCoarsening {
   ordinal_view_t clusterVerts;
 };
 
+// For each fine entry (i, j), the index of the coarse entry
+// (labels(i), labels(j)) in the coarse graph, or invalid if the entry is
+// dropped by the coarsening: an edge inside a cluster, a remote column or a
+// missing coarse entry. With sorted coarse rows the search is a binary search.
+template <typename size_type, typename fine_rowmap_t, typename fine_entries_t,
+          typename labels_t, typename coarse_rowmap_t,
+          typename coarse_entries_t, typename entry_map_t>
+struct CoarseEntryMapFunctor {
+  using lno_t = typename fine_entries_t::non_const_value_type;
+
+  CoarseEntryMapFunctor(const fine_rowmap_t& fineRowmap_,
+                        const fine_entries_t& fineEntries_,
+                        const labels_t& labels_,
+                        const coarse_rowmap_t& coarseRowmap_,
+                        const coarse_entries_t& coarseEntries_,
+                        const entry_map_t& entryMap_, bool sorted_,
+                        size_type invalid_)
+      : numRows(fineRowmap_.extent(0) - 1),
+        fineRowmap(fineRowmap_),
+        fineEntries(fineEntries_),
+        labels(labels_),
+        coarseRowmap(coarseRowmap_),
+        coarseEntries(coarseEntries_),
+        entryMap(entryMap_),
+        sorted(sorted_),
+        invalid(invalid_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const lno_t i) const {
+    const lno_t cluster       = labels(i);
+    const size_type rowBegin  = coarseRowmap(cluster);
+    const size_type rowEnd    = coarseRowmap(cluster + 1);
+    const size_type fineBegin = fineRowmap(i);
+    const size_type fineEnd   = fineRowmap(i + 1);
+    for (size_type j = fineBegin; j < fineEnd; j++) {
+      entryMap(j)     = invalid;
+      const lno_t nei = fineEntries(j);
+      if (nei >= numRows) continue;
+      const lno_t neiCluster = labels(nei);
+      if (neiCluster == cluster) continue;
+      if (sorted) {
+        size_type lo = rowBegin, hi = rowEnd;
+        while (lo < hi) {
+          const size_type mid = lo + (hi - lo) / 2;
+          if (coarseEntries(mid) < neiCluster)
+            lo = mid + 1;
+          else
+            hi = mid;
+        }
+        if (lo < rowEnd && coarseEntries(lo) == neiCluster) entryMap(j) = lo;
+      } else {
+        for (size_type k = rowBegin; k < rowEnd; k++) {
+          if (coarseEntries(k) == neiCluster) {
+            entryMap(j) = k;
+            break;
+          }
+        }
+      }
+    }
+  }
+
+  lno_t numRows;
+  fine_rowmap_t fineRowmap;
+  fine_entries_t fineEntries;
+  labels_t labels;
+  coarse_rowmap_t coarseRowmap;
+  coarse_entries_t coarseEntries;
+  entry_map_t entryMap;
+  bool sorted;
+  size_type invalid;
+};
+
+// Sums the fine values into the coarse entries given by the entry map
+template <typename size_type, typename entry_map_t, typename fine_values_t,
+          typename coarse_values_t>
+struct CoarseValuesFunctor {
+  CoarseValuesFunctor(const entry_map_t& entryMap_,
+                      const fine_values_t& fineValues_,
+                      const coarse_values_t& coarseValues_, size_type invalid_)
+      : entryMap(entryMap_),
+        fineValues(fineValues_),
+        coarseValues(coarseValues_),
+        invalid(invalid_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const size_type j) const {
+    const size_type k = entryMap(j);
+    if (k != invalid) Kokkos::atomic_add(&coarseValues(k), fineValues(j));
+  }
+
+  entry_map_t entryMap;
+  fine_values_t fineValues;
+  coarse_values_t coarseValues;
+  size_type invalid;
+};
+
 }  // namespace Impl
 }  // namespace KokkosGraph
 
@@ -0,0 +1,473 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef _KOKKOSGRAPH_KCORE_IMPL_HPP
+#define _KOKKOSGRAPH_KCORE_IMPL_HPP
+
+#include <utility>
+#include "Kokkos_Core.hpp"
+#include "Kokkos_ArithTraits.hpp"
+#include "KokkosKernels_SimpleUtils.hpp"
+
+namespace KokkosGraph {
+namespace Impl {
+
+// Core numbers by peeling: at level k, the remaining vertices of degree at
+// most k get core number k and are removed, which lowers the degrees of
+// their neighbors. The vertices whose degree drops to k are pushed to the
+// frontier of the next round of the same level, so a level only scans all
+// the vertices once, to find its first frontier (and the next level is the
+// smallest remaining degree).
+template <typename device_t, typename rowmap_t, typename entries_t,
+          typename cores_t>
+struct KCoreDecomposition {
+  using exec_space   = typename device_t::execution_space;
+  using size_type    = typename rowmap_t::non_const_value_type;
+  using lno_t        = typename entries_t::non_const_value_type;
+  using lno_view_t   = Kokkos::View<lno_t*, device_t>;
+  using range_policy = Kokkos::RangePolicy<exec_space>;
+
+  rowmap_t rowmap;
+  entries_t entries;
+  lno_t numVerts;
+  cores_t cores;
+  lno_view_t degrees;
+  lno_view_t frontier;
+  lno_view_t nextFrontier;
+  Kokkos::View<lno_t, device_t> nextSize;
+
+  static KOKKOS_INLINE_FUNCTION lno_t unassigned() {
+    return Kokkos::ArithTraits<lno_t>::max();
+  }
+
+  KCoreDecomposition(const rowmap_t& rowmap_, const entries_t& entries_)
+      : rowmap(rowmap_),
+        entries(entries_),
+        numVerts(rowmap_.extent(0) - 1),
+        cores(Kokkos::view_alloc(Kokkos::WithoutInitializing, "Cores"),
+              numVerts),
+        degrees(Kokkos::view_alloc(Kokkos::WithoutInitializing, "Degrees"),
+                numVerts),
+        frontier(Kokkos::view_alloc(Kokkos::WithoutInitializing, "Frontier"),
+                 numVerts),
+        nextFrontier(
+            Kokkos::view_alloc(Kokkos::WithoutInitializing, "Next frontier"),
+            numVerts),
+        nextSize("Next frontier size") {}
+
+  // Degrees, without self loops and column indices >= numVerts
+  struct DegreeFunctor {
+    rowmap_t rowmap;
+    entries_t entries;
+    lno_t numVerts;
+    cores_t cores;
+    lno_view_t degrees;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const lno_t v) const {
+      lno_t degree = 0;
+      for (size_type j = rowmap(v); j < rowmap(v + 1); j++) {
+        const lno_t w = entries(j);
+        if (w != v && w < numVerts) degree++;
+      }
+      degrees(v) = degree;
+      cores(v)   = unassigned();
+    }
+  };
+
+  struct MinDegreeFunctor {
+    cores_t cores;
+    lno_view_t degrees;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const lno_t v,
+                                           lno_t& lmin) const {
+      if (cores(v) == unassigned() && degrees(v) < lmin) lmin = degrees(v);
+    }
+  };
+
+  // The remaining vertices of degree at most level
+  struct GatherFunctor {
+    cores_t cores;
+    lno_view_t degrees;
+    lno_view_t frontier;
+    lno_t level;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const lno_t v, lno_t& lpos,
+                                           const bool final) const {
+      if (cores(v) != unassigned() || degrees(v) > level) return;
+      if (final) frontier(lpos) = v;
+      lpos++;
+    }
+  };
+
+  struct AssignFunctor {
+    cores_t cores;
+    lno_view_t frontier;
+    lno_t level;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const lno_t i) const {
+      cores(frontier(i)) = level;
+    }
+  };
+
+  // Removes the (already assigned) frontier: decrements the degrees of the
+  // remaining neighbors, and pushes the ones that drop to level
+  struct PeelFunctor {
+    rowmap_t rowmap;
+    entries_t entries;
+    lno_t numVerts;
+    cores_t cores;
+    lno_view_t degrees;
+    lno_view_t frontier;
+    lno_view_t nextFrontier;
+    Kokkos::View<lno_t, device_t> nextSize;
+    lno_t level;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const lno_t i) const {
+      const lno_t v = frontier(i);
+      for (size_type j = rowmap(v); j < rowmap(v + 1); j++) {
+        const lno_t w = entries(j);
+        if (w == v || w >= numVerts || cores(w) != unassigned()) continue;
+        if (Kokkos::atomic_fetch_sub(&degrees(w), lno_t(1)) == level + 1)
+          nextFrontier(Kokkos::atomic_fetch_add(&nextSize(), lno_t(1))) = w;
+      }
+    }
+  };
+
+  void compute() {
+    Kokkos::parallel_for("KokkosGraph::KCore::Degrees",
+                         range_policy(0, numVerts),
+                         DegreeFunctor{rowmap, entries, numVerts, cores,
+                                       degrees});
+    lno_t numRemoved = 0;
+    lno_t level      = 0;
+    while (numRemoved < numVerts) {
+      lno_t minDegree = 0;
+      Kokkos::parallel_reduce("KokkosGraph::KCore::MinDegree",
+                              range_policy(0, numVerts),
+                              MinDegreeFunctor{cores, degrees},
+                              Kokkos::Min<lno_t>(minDegree));
+      if (minDegree > level) level = minDegree;
+      lno_t frontierSize = 0;
+      Kokkos::parallel_scan("KokkosGraph::KCore::Gather",
+                            range_policy(0, numVerts),
+                            GatherFunctor{cores, degrees, frontier, level},
+                            frontierSize);
+      while (frontierSize) {
+        numRemoved += frontierSize;
+        Kokkos::parallel_for("KokkosGraph::KCore::Assign",
+                             range_policy(0, frontierSize),
+                             AssignFunctor{cores, frontier, level});
+        Kokkos::deep_copy(nextSize, lno_t(0));
+        Kokkos::parallel_for(
+            "KokkosGraph::KCore::Peel", range_policy(0, frontierSize),
+            PeelFunctor{rowmap, entries, numVerts, cores, degrees, frontier,
+                        nextFrontier, nextSize, level});
+        Kokkos::deep_copy(frontierSize, nextSize);
+        std::swap(frontier, nextFrontier);
+      }
+    }
+  }
+};
+
+// Binary search for y in the (sorted) row x; returns the end of the row if
+// y is not there
+template <typename rowmap_t, typename entries_t, typename lno_t>
+KOKKOS_INLINE_FUNCTION typename rowmap_t::non_const_value_type
+ktruss_find_entry(const rowmap_t& rowmap, const entries_t& entries,
+                  const lno_t x, const lno_t y) {
+  using size_type = typename rowmap_t::non_const_value_type;
+  size_type lo = rowmap(x), hi = rowmap(x + 1);
+  while (lo < hi) {
+    const size_type mid = lo + (hi - lo) / 2;
+    if (entries(mid) < y)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  return (lo < rowmap(x + 1) && entries(lo) == y) ? lo : rowmap(x + 1);
+}
+
+// k-truss by peeling edges: an edge is removed while it is in fewer than
+// k - 2 triangles of the remaining graph. The support of an edge is the
+// intersection of the rows of its endpoints. Removing the frontier (the
+// edges of too low support) decrements the support of the other edges of
+// their remaining triangles, and pushes the edges that drop below k - 2 to
+// the next frontier. A triangle with two frontier edges decrements its third
+// edge once, from the frontier edge of smallest index; a triangle with three
+// frontier edges decrements nothing.
+//
+// Each edge is represented by its entry (u, v) with u < v; canon maps every
+// entry to the entry of its edge.
+template <typename device_t, typename rowmap_t, typename entries_t>
+struct KTruss {
+  using exec_space    = typename device_t::execution_space;
+  using size_type     = typename rowmap_t::non_const_value_type;
+  using lno_t         = typename entries_t::non_const_value_type;
+  using rowmap_out_t  = typename rowmap_t::non_const_type;
+  using entries_out_t = typename entries_t::non_const_type;
+  using lno_view_t    = Kokkos::View<lno_t*, device_t>;
+  using offset_view_t = Kokkos::View<size_type*, device_t>;
+  using state_view_t  = Kokkos::View<char*, device_t>;
+  using range_policy  = Kokkos::RangePolicy<exec_space>;
+
+  enum : char { Alive = 0, Frontier = 1, Removed = 2 };
+
+  rowmap_t rowmap;
+  entries_t entries;
+  lno_t numVerts;
+  size_type numEntries;
+  lno_t minSupport;
+  offset_view_t canon;
+  lno_view_t rows;
+  lno_view_t support;
+  state_view_t state;
+  offset_view_t frontier;
+  offset_view_t nextFrontier;
+  Kokkos::View<size_type, device_t> nextSize;
+
+  KTruss(const rowmap_t& rowmap_, const entries_t& entries_, const lno_t k)
+      : rowmap(rowmap_),
+        entries(entries_),
+        numVerts(rowmap_.extent(0) - 1),
+        numEntries(entries_.extent(0)),
+        minSupport(k > 2 ? k - 2 : 0),
+        canon(Kokkos::view_alloc(Kokkos::WithoutInitializing, "Canon"),
+              numEntries),
+        rows(Kokkos::view_alloc(Kokkos::WithoutInitializing, "Rows"),
+             numEntries),
+        support("Support", numEntries),
+        state(Kokkos::view_alloc(Kokkos::WithoutInitializing, "State"),
+              numEntries),
+        frontier(Kokkos::view_alloc(Kokkos::WithoutInitializing, "Frontier"),
+                 numEntries),
+        nextFrontier(
+            Kokkos::view_alloc(Kokkos::WithoutInitializing, "Next frontier"),
+            numEntries),
+        nextSize("Next frontier size") {}
+
+  // Entries (u, v) with u < v are the edges; the others point to the entry
+  // (v, u), if it exists. Self loops, column indices >= numVerts and entries
+  // without their transpose are removed.
+  struct InitFunctor {
+    rowmap_t rowmap;
+    entries_t entries;
+    lno_t numVerts;
+    offset_view_t canon;
+    lno_view_t rows;
+    state_view_t state;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const lno_t u) const {
+      for (size_type j = rowmap(u); j < rowmap(u + 1); j++) {
+        const lno_t v = entries(j);
+        rows(j)       = u;
+        canon(j)      = j;
+        state(j)      = Removed;
+        if (v == u || v >= numVerts) continue;
+        if (u < v) {
+          if (ktruss_find_entry(rowmap, entries, v, u) != rowmap(v + 1))
+            state(j) = Alive;
+        } else {
+          const size_type t = ktruss_find_entry(rowmap, entries, v, u);
+          if (t != rowmap(v + 1)) canon(j) = t;
+        }
+      }
+    }
+  };
+
+  // Support of the alive edges
+  struct SupportFunctor {
+    rowmap_t rowmap;
+    entries_t entries;
+    offset_view_t canon;
+    lno_view_t rows;
+    lno_view_t support;
+    state_view_t state;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const size_type e) const {
+      if (state(e) != Alive) return;
+      const lno_t u        = rows(e);
+      const lno_t v        = entries(e);
+      size_type i          = rowmap(u);
+      size_type j          = rowmap(v);
+      const size_type iEnd = rowmap(u + 1);
+      const size_type jEnd = rowmap(v + 1);
+      lno_t count          = 0;
+      while (i < iEnd && j < jEnd) {
+        if (entries(i) < entries(j)) {
+          i++;
+        } else if (entries(j) < entries(i)) {
+          j++;
+        } else {
+          if (state(canon(i)) == Alive && state(canon(j)) == Alive) count++;
+          i++;
+          j++;
+        }
+      }
+      support(e) = count;
+    }
+  };
+
+  struct GatherFunctor {
+    lno_view_t support;
+    state_view_t state;
+    offset_view_t frontier;
+    lno_t minSupport;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const size_type e,
+                                           size_type& lpos,
+                                           const bool final) const {
+      if (state(e) != Alive || support(e) >= minSupport) return;
+      if (final) frontier(lpos) = e;
+      lpos++;
+    }
+  };
+
+  struct MarkFunctor {
+    offset_view_t frontier;
+    state_view_t state;
+    char value;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const size_type i) const {
+      state(frontier(i)) = value;
+    }
+  };
+
+  struct PeelFunctor {
+    rowmap_t rowmap;
+    entries_t entries;
+    offset_view_t canon;
+    lno_view_t rows;
+    lno_view_t support;
+    state_view_t state;
+    offset_view_t frontier;
+    offset_view_t nextFrontier;
+    Kokkos::View<size_type, device_t> nextSize;
+    lno_t minSupport;
+
+    KOKKOS_INLINE_FUNCTION void decrement(const size_type e) const {
+      if (Kokkos::atomic_fetch_sub(&support(e), lno_t(1)) == minSupport)
+        nextFrontier(Kokkos::atomic_fetch_add(&nextSize(), size_type(1))) = e;
+    }
+
+    KOKKOS_INLINE_FUNCTION void operator()(const size_type k) const {
+      const size_type e    = frontier(k);
+      const lno_t u        = rows(e);
+      const lno_t v        = entries(e);
+      size_type i          = rowmap(u);
+      size_type j          = rowmap(v);
+      const size_type iEnd = rowmap(u + 1);
+      const size_type jEnd = rowmap(v + 1);
+      while (i < iEnd && j < jEnd) {
+        if (entries(i) < entries(j)) {
+          i++;
+        } else if (entries(j) < entries(i)) {
+          j++;
+        } else {
+          const size_type e1 = canon(i);
+          const size_type e2 = canon(j);
+          const char s1      = state(e1);
+          const char s2      = state(e2);
+          i++;
+          j++;
+          if (s1 == Removed || s2 == Removed) continue;
+          if (s1 == Alive && s2 == Alive) {
+            decrement(e1);
+            decrement(e2);
+          } else if (s1 == Alive) {
+            if (e < e2) decrement(e1);
+          } else if (s2 == Alive) {
+            if (e < e1) decrement(e2);
+          }
+        }
+      }
+    }
+  };
+
+  // Counts the remaining entries of each row, or writes them
+  struct OutputFunctor {
+    rowmap_t rowmap;
+    entries_t entries;
+    offset_view_t canon;
+    state_view_t state;
+    rowmap_out_t outRowmap;
+    entries_out_t outEntries;
+    bool fill;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const lno_t u) const {
+      size_type out = fill ? outRowmap(u) : 0;
+      for (size_type j = rowmap(u); j < rowmap(u + 1); j++) {
+        if (state(canon(j)) != Alive) continue;
+        if (fill) outEntries(out) = entries(j);
+        out++;
+      }
+      if (!fill) outRowmap(u) = out;
+    }
+  };
+
+  void compute(rowmap_out_t& outRowmap, entries_out_t& outEntries) {
+    Kokkos::parallel_for(
+        "KokkosGraph::KTruss::Init", range_policy(0, numVerts),
+        InitFunctor{rowmap, entries, numVerts, canon, rows, state});
+    Kokkos::parallel_for(
+        "KokkosGraph::KTruss::Support", range_policy(0, numEntries),
+        SupportFunctor{rowmap, entries, canon, rows, support, state});
+    size_type frontierSize = 0;
+    Kokkos::parallel_scan(
+        "KokkosGraph::KTruss::Gather", range_policy(0, numEntries),
+        GatherFunctor{support, state, frontier, minSupport}, frontierSize);
+    while (frontierSize) {
+      Kokkos::parallel_for("KokkosGraph::KTruss::Mark",
+                           range_policy(0, frontierSize),
+                           MarkFunctor{frontier, state, Frontier});
+      Kokkos::deep_copy(nextSize, size_type(0));
+      Kokkos::parallel_for(
+          "KokkosGraph::KTruss::Peel", range_policy(0, frontierSize),
+          PeelFunctor{rowmap, entries, canon, rows, support, state, frontier,
+                      nextFrontier, nextSize, minSupport});
+      Kokkos::parallel_for("KokkosGraph::KTruss::Remove",
+                           range_policy(0, frontierSize),
+                           MarkFunctor{frontier, state, Removed});
+      Kokkos::deep_copy(frontierSize, nextSize);
+      std::swap(frontier, nextFrontier);
+    }
+
+    outRowmap = rowmap_out_t(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "Truss rowmap"),
+        numVerts + 1);
+    OutputFunctor output{rowmap,    entries,         canon, state,
+                         outRowmap, entries_out_t(), false};
+    Kokkos::parallel_for("KokkosGraph::KTruss::CountOutput",
+                         range_policy(0, numVerts), output);
+    Kokkos::deep_copy(Kokkos::subview(outRowmap, numVerts), size_type(0));
+    KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum<rowmap_out_t,
+                                                          exec_space>(
+        numVerts + 1, outRowmap);
+    size_type outNnz = 0;
+    Kokkos::deep_copy(outNnz, Kokkos::subview(outRowmap, numVerts));
+    outEntries = entries_out_t(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "Truss entries"),
+        outNnz);
+    output.outEntries = outEntries;
+    output.fill       = true;
+    Kokkos::parallel_for("KokkosGraph::KTruss::FillOutput",
+                         range_policy(0, numVerts), output);
+  }
+};
+
+}  // namespace Impl
+}  // namespace KokkosGraph
+
+#endif
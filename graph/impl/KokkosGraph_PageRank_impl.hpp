@@ -0,0 +1,317 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef _KOKKOSGRAPH_PAGERANK_IMPL_HPP
+#define _KOKKOSGRAPH_PAGERANK_IMPL_HPP
+
+#include "Kokkos_Core.hpp"
+#include "Kokkos_ArithTraits.hpp"
+#include "KokkosSparse_Utils.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace KokkosGraph {
+namespace Impl {
+
+// Power iteration for (personalized) PageRank on the directed graph with an
+// edge u -> v for each entry v of row u, for up to maxBatch rank vectors at a
+// time:
+//
+//   next(v) = damping * sum_{u -> v} ranks(u) / outdeg(u)
+//           + (damping * danglingMass + 1 - damping) * teleport(v)
+//
+// where danglingMass is the rank of the vertices with no out edges, which is
+// redistributed like the teleportation. The division by the out degrees is
+// done in the sweep, so the stochastic matrix is never formed. The sweep pulls
+// along the in edges, so that each rank is written by one thread: if the graph
+// isn't symmetric, it is transposed once.
+template <typename device_t, typename rowmap_t, typename entries_t,
+          typename scalar_t>
+struct PageRank {
+  using exec_space   = typename device_t::execution_space;
+  using mem_space    = typename device_t::memory_space;
+  using size_type    = typename rowmap_t::non_const_value_type;
+  using lno_t        = typename entries_t::non_const_value_type;
+  using t_rowmap_t   = Kokkos::View<size_type*, mem_space>;
+  using t_entries_t  = Kokkos::View<lno_t*, mem_space>;
+  using in_rowmap_t  = Kokkos::View<const size_type*, mem_space>;
+  using in_entries_t = Kokkos::View<const lno_t*, mem_space>;
+  using vector_t     = Kokkos::View<scalar_t*, mem_space>;
+  using ranks_t      = Kokkos::View<scalar_t**, Kokkos::LayoutRight, mem_space>;
+  using host_sums_t  = Kokkos::View<scalar_t*, Kokkos::HostSpace>;
+  using range_pol    = Kokkos::RangePolicy<exec_space>;
+  using team_pol     = Kokkos::TeamPolicy<exec_space>;
+  using team_mem     = typename team_pol::member_type;
+  using KAT          = Kokkos::ArithTraits<scalar_t>;
+
+  // The number of rank vectors computed in the same sweeps
+  static constexpr int maxBatch = 64;
+
+  PageRank(const rowmap_t& rowmap, const entries_t& entries, bool isSymmetric,
+           scalar_t damping_, scalar_t tol_, int maxIters_)
+      : numVerts(rowmap.extent(0) - 1),
+        damping(damping_),
+        tol(tol_),
+        maxIters(maxIters_),
+        invOutDeg(Kokkos::view_alloc(Kokkos::WithoutInitializing,
+                                     "PageRank inverse out degrees"),
+                  numVerts) {
+    if (isSymmetric) {
+      inRowmap  = rowmap;
+      inEntries = entries;
+    } else {
+      t_rowmap_t tRowmap("PageRank in rowmap", numVerts + 1);
+      t_entries_t tEntries(Kokkos::view_alloc(Kokkos::WithoutInitializing,
+                                              "PageRank in entries"),
+                           entries.extent(0));
+      KokkosSparse::Impl::transpose_graph<rowmap_t, entries_t, t_rowmap_t,
+                                          t_entries_t, t_rowmap_t, exec_space>(
+          numVerts, numVerts, rowmap, entries, tRowmap, tEntries);
+      inRowmap  = tRowmap;
+      inEntries = tEntries;
+    }
+    Kokkos::parallel_for(range_pol(0, numVerts),
+                         InvDegreeFunctor(rowmap, invOutDeg));
+  }
+
+  struct InvDegreeFunctor {
+    InvDegreeFunctor(const rowmap_t& rowmap_, const vector_t& invOutDeg_)
+        : rowmap(rowmap_), invOutDeg(invOutDeg_) {}
+
+    KOKKOS_INLINE_FUNCTION void operator()(lno_t v) const {
+      size_type deg = rowmap(v + 1) - rowmap(v);
+      // Dangling vertices are marked by 0
+      invOutDeg(v) = deg ? KAT::one() / scalar_t(deg) : KAT::zero();
+    }
+
+    rowmap_t rowmap;
+    vector_t invOutDeg;
+  };
+
+  // One thread per vertex, one vector lane per rank vector
+  struct SweepFunctor {
+    SweepFunctor(const in_rowmap_t& inRowmap_, const in_entries_t& inEntries_,
+                 const vector_t& invOutDeg_, const ranks_t& ranks_,
+                 const ranks_t& next_, const ranks_t& teleport_,
+                 const vector_t& beta_, scalar_t damping_, lno_t numVerts_,
+                 int numVecs_)
+        : inRowmap(inRowmap_),
+          inEntries(inEntries_),
+          invOutDeg(invOutDeg_),
+          ranks(ranks_),
+          next(next_),
+          teleport(teleport_),
+          beta(beta_),
+          damping(damping_),
+          invN(KAT::one() / scalar_t(numVerts_)),
+          numVerts(numVerts_),
+          numVecs(numVecs_) {}
+
+    KOKKOS_INLINE_FUNCTION void operator()(const team_mem& t) const {
+      lno_t v = t.league_rank() * t.team_size() + t.team_rank();
+      if (v >= numVerts) return;
+      size_type rowBegin = inRowmap(v);
+      size_type rowEnd   = inRowmap(v + 1);
+      Kokkos::parallel_for(Kokkos::ThreadVectorRange(t, numVecs), [&](int c) {
+        scalar_t sum = KAT::zero();
+        for (size_type j = rowBegin; j < rowEnd; j++) {
+          lno_t u = inEntries(j);
+          sum += ranks(u, c) * invOutDeg(u);
+        }
+        // An empty teleport means the uniform distribution
+        scalar_t tele = teleport.extent(0) ? teleport(v, c) : invN;
+        next(v, c)    = damping * sum + beta(c) * tele;
+      });
+    }
+
+    in_rowmap_t inRowmap;
+    in_entries_t inEntries;
+    vector_t invOutDeg;
+    ranks_t ranks;
+    ranks_t next;
+    ranks_t teleport;
+    vector_t beta;
+    scalar_t damping;
+    scalar_t invN;
+    lno_t numVerts;
+    int numVecs;
+  };
+
+  // For each rank vector c: the L1 distance between ranks and next in
+  // sums[c], and the dangling mass of next in sums[numVecs + c]
+  struct SumsFunctor {
+    using value_type = scalar_t[];
+    using size_type  = int;
+
+    SumsFunctor(const ranks_t& ranks_, const ranks_t& next_,
+                const vector_t& invOutDeg_, int numVecs_)
+        : ranks(ranks_),
+          next(next_),
+          invOutDeg(invOutDeg_),
+          numVecs(numVecs_),
+          value_count(2 * numVecs_) {}
+
+    KOKKOS_INLINE_FUNCTION void operator()(lno_t v, value_type sums) const {
+      bool dangling = invOutDeg(v) == KAT::zero();
+      for (int c = 0; c < numVecs; c++) {
+        scalar_t x = next(v, c);
+        sums[c] += KAT::abs(x - ranks(v, c));
+        if (dangling) sums[numVecs + c] += x;
+      }
+    }
+
+    KOKKOS_INLINE_FUNCTION void init(value_type sums) const {
+      for (size_type k = 0; k < value_count; k++) sums[k] = KAT::zero();
+    }
+
+    KOKKOS_INLINE_FUNCTION void join(value_type dst,
+                                     const value_type src) const {
+      for (size_type k = 0; k < value_count; k++) dst[k] += src[k];
+    }
+
+    ranks_t ranks;
+    ranks_t next;
+    vector_t invOutDeg;
+    int numVecs;
+    size_type value_count;
+  };
+
+  // The sum of each column of the teleportation vectors
+  struct ColumnSumsFunctor {
+    using value_type = scalar_t[];
+    using size_type  = int;
+
+    ColumnSumsFunctor(const ranks_t& teleport_)
+        : teleport(teleport_), value_count(teleport_.extent(1)) {}
+
+    KOKKOS_INLINE_FUNCTION void operator()(lno_t v, value_type sums) const {
+      for (size_type c = 0; c < value_count; c++) sums[c] += teleport(v, c);
+    }
+
+    KOKKOS_INLINE_FUNCTION void init(value_type sums) const {
+      for (size_type k = 0; k < value_count; k++) sums[k] = KAT::zero();
+    }
+
+    KOKKOS_INLINE_FUNCTION void join(value_type dst,
+                                     const value_type src) const {
+      for (size_type k = 0; k < value_count; k++) dst[k] += src[k];
+    }
+
+    ranks_t teleport;
+    size_type value_count;
+  };
+
+  struct ScaleColumnsFunctor {
+    ScaleColumnsFunctor(const ranks_t& teleport_, const vector_t& scales_)
+        : teleport(teleport_), scales(scales_) {}
+
+    KOKKOS_INLINE_FUNCTION void operator()(lno_t v) const {
+      for (size_t c = 0; c < teleport.extent(1); c++)
+        teleport(v, c) *= scales(c);
+    }
+
+    ranks_t teleport;
+    vector_t scales;
+  };
+
+  // Scale each teleportation vector to sum to 1
+  void normalizeTeleport(const ranks_t& teleport) {
+    int numVecs = teleport.extent(1);
+    host_sums_t sums("PageRank teleport sums", numVecs);
+    Kokkos::parallel_reduce(range_pol(0, numVerts), ColumnSumsFunctor(teleport),
+                            sums);
+    vector_t scales("PageRank teleport scales", numVecs);
+    auto scalesHost = Kokkos::create_mirror_view(scales);
+    for (int c = 0; c < numVecs; c++) {
+      if (!(sums(c) > KAT::zero()))
+        throw std::invalid_argument(
+            "personalized_pagerank: each seed vector must have a positive sum");
+      scalesHost(c) = KAT::one() / sums(c);
+    }
+    Kokkos::deep_copy(scales, scalesHost);
+    Kokkos::parallel_for(range_pol(0, numVerts),
+                         ScaleColumnsFunctor(teleport, scales));
+  }
+
+  // Iterate until the L1 change of every rank vector is below tol, or
+  // maxIters sweeps. The ranks start from the teleportation vectors (uniform
+  // if teleport is empty). Returns the number of sweeps.
+  int compute(const ranks_t& teleport, ranks_t& ranks) {
+    int numVecs = ranks.extent(1);
+    if (teleport.extent(0))
+      Kokkos::deep_copy(ranks, teleport);
+    else
+      Kokkos::deep_copy(ranks, KAT::one() / scalar_t(numVerts));
+    ranks_t next(Kokkos::view_alloc(Kokkos::WithoutInitializing,
+                                    "PageRank next ranks"),
+                 numVerts, numVecs);
+    vector_t beta(Kokkos::view_alloc(Kokkos::WithoutInitializing,
+                                     "PageRank teleport scales"),
+                  numVecs);
+    auto betaHost = Kokkos::create_mirror_view(beta);
+    host_sums_t sums("PageRank sums", 2 * numVecs);
+    Kokkos::parallel_reduce(range_pol(0, numVerts),
+                            SumsFunctor(ranks, ranks, invOutDeg, numVecs),
+                            sums);
+    int vectorLength = 1;
+    while (vectorLength < numVecs &&
+           vectorLength < (int)team_pol::vector_length_max())
+      vectorLength *= 2;
+    int teamSize = 0;
+    {
+      SweepFunctor sweep(inRowmap, inEntries, invOutDeg, ranks, next, teleport,
+                         beta, damping, numVerts, numVecs);
+      teamSize = team_pol(1, 1, vectorLength)
+                     .team_size_recommended(sweep, Kokkos::ParallelForTag());
+    }
+    int iter = 0;
+    while (iter < maxIters) {
+      for (int c = 0; c < numVecs; c++)
+        betaHost(c) = damping * sums(numVecs + c) + KAT::one() - damping;
+      Kokkos::deep_copy(beta, betaHost);
+      Kokkos::parallel_for(
+          team_pol((numVerts + teamSize - 1) / teamSize, teamSize,
+                   vectorLength),
+          SweepFunctor(inRowmap, inEntries, invOutDeg, ranks, next, teleport,
+                       beta, damping, numVerts, numVecs));
+      Kokkos::parallel_reduce(range_pol(0, numVerts),
+                              SumsFunctor(ranks, next, invOutDeg, numVecs),
+                              sums);
+      std::swap(ranks, next);
+      iter++;
+      bool converged = true;
+      for (int c = 0; c < numVecs; c++) {
+        if (sums(c) >= tol) converged = false;
+      }
+      if (converged) break;
+    }
+    return iter;
+  }
+
+  lno_t numVerts;
+  scalar_t damping;
+  scalar_t tol;
+  int maxIters;
+  // The in edges of each vertex
+  in_rowmap_t inRowmap;
+  in_entries_t inEntries;
+  vector_t invOutDeg;
+};
+
+}  // namespace Impl
+}  // namespace KokkosGraph
+
+#endif
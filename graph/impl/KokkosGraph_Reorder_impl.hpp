@@ -0,0 +1,152 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef _KOKKOSGRAPH_REORDER_IMPL_HPP
+#define _KOKKOSGRAPH_REORDER_IMPL_HPP
+
+#include <cstdint>
+#include "Kokkos_Core.hpp"
+#include "Kokkos_Sort.hpp"
+
+namespace KokkosGraph {
+namespace Experimental {
+namespace Impl {
+
+// Orderings computed by sorting one 64-bit key per vertex, key = rank * n + v:
+// the vertices are sorted by rank, and by ID within a rank, and the label
+// (new index) of a vertex is the position of its key.
+template <typename device_t, typename rowmap_t, typename labels_t>
+struct KeyOrder {
+  using exec_space   = typename device_t::execution_space;
+  using lno_t        = typename labels_t::non_const_value_type;
+  using size_type    = typename rowmap_t::non_const_value_type;
+  using range_policy = Kokkos::RangePolicy<exec_space>;
+  using key_view_t   = Kokkos::View<uint64_t*, device_t>;
+
+  struct MaxDegreeFunctor {
+    MaxDegreeFunctor(const rowmap_t& rowmap_) : rowmap(rowmap_) {}
+
+    KOKKOS_INLINE_FUNCTION void operator()(lno_t v, size_type& lmax) const {
+      size_type deg = rowmap(v + 1) - rowmap(v);
+      if (deg > lmax) lmax = deg;
+    }
+
+    rowmap_t rowmap;
+  };
+
+  // Rank of a vertex: maxDeg - degree for the vertices of degree > threshold
+  // (all vertices if threshold < 0), and maxDeg + 1 for the others
+  struct DegreeKeyFunctor {
+    DegreeKeyFunctor(const rowmap_t& rowmap_, const key_view_t& keys_,
+                     size_type maxDeg_, double threshold_)
+        : rowmap(rowmap_),
+          keys(keys_),
+          maxDeg(maxDeg_),
+          threshold(threshold_) {}
+
+    KOKKOS_INLINE_FUNCTION void operator()(lno_t v) const {
+      const uint64_t n = keys.extent(0);
+      size_type deg    = rowmap(v + 1) - rowmap(v);
+      uint64_t rank    = maxDeg + 1;
+      if (threshold < 0 || deg > threshold) rank = maxDeg - deg;
+      keys(v) = rank * n + v;
+    }
+
+    rowmap_t rowmap;
+    key_view_t keys;
+    size_type maxDeg;
+    double threshold;
+  };
+
+  // Rank of a vertex: the label of the coarse vertex it is mapped to
+  template <typename vcmap_t, typename coarse_labels_t>
+  struct NestedKeyFunctor {
+    NestedKeyFunctor(const vcmap_t& vcmap_, const coarse_labels_t& coarse_,
+                     const key_view_t& keys_)
+        : vcmap(vcmap_), coarse(coarse_), keys(keys_) {}
+
+    KOKKOS_INLINE_FUNCTION void operator()(lno_t v) const {
+      const uint64_t n = keys.extent(0);
+      keys(v)          = uint64_t(coarse(vcmap(v))) * n + v;
+    }
+
+    vcmap_t vcmap;
+    coarse_labels_t coarse;
+    key_view_t keys;
+  };
+
+  struct LabelsFromKeysFunctor {
+    LabelsFromKeysFunctor(const key_view_t& keys_, const labels_t& labels_)
+        : keys(keys_), labels(labels_) {}
+
+    KOKKOS_INLINE_FUNCTION void operator()(lno_t i) const {
+      const uint64_t n    = keys.extent(0);
+      labels(keys(i) % n) = i;
+    }
+
+    key_view_t keys;
+    labels_t labels;
+  };
+
+  static labels_t labels_from_keys(const key_view_t& keys) {
+    const lno_t n = keys.extent(0);
+    Kokkos::sort(keys);
+    labels_t labels(Kokkos::view_alloc(Kokkos::WithoutInitializing, "Labels"),
+                    n);
+    Kokkos::parallel_for("KokkosGraph::Reorder::Labels", range_policy(0, n),
+                         LabelsFromKeysFunctor(keys, labels));
+    return labels;
+  }
+
+  // Sort by decreasing degree the vertices of degree > average (all of them
+  // if sortAll), and put the others after them, in their original order
+  static labels_t degree_order(const rowmap_t& rowmap, bool sortAll) {
+    const lno_t n    = rowmap.extent(0) - 1;
+    size_type maxDeg = 0;
+    Kokkos::parallel_reduce("KokkosGraph::Reorder::MaxDegree",
+                            range_policy(0, n), MaxDegreeFunctor(rowmap),
+                            Kokkos::Max<size_type>(maxDeg));
+    size_type nnz = 0;
+    Kokkos::deep_copy(nnz, Kokkos::subview(rowmap, n));
+    const double threshold = sortAll ? -1.0 : double(nnz) / n;
+    key_view_t keys(Kokkos::view_alloc(Kokkos::WithoutInitializing, "Keys"),
+                    n);
+    Kokkos::parallel_for("KokkosGraph::Reorder::DegreeKeys", range_policy(0, n),
+                         DegreeKeyFunctor(rowmap, keys, maxDeg, threshold));
+    return labels_from_keys(keys);
+  }
+
+  // Extend the labels of the coarse vertices to the fine vertices: the
+  // vertices mapped to the same coarse vertex get consecutive labels, in the
+  // order of the coarse labels
+  template <typename vcmap_t, typename coarse_labels_t>
+  static labels_t nested_order(const vcmap_t& vcmap,
+                               const coarse_labels_t& coarseLabels) {
+    const lno_t n = vcmap.extent(0);
+    key_view_t keys(Kokkos::view_alloc(Kokkos::WithoutInitializing, "Keys"),
+                    n);
+    Kokkos::parallel_for(
+        "KokkosGraph::Reorder::NestedKeys", range_policy(0, n),
+        NestedKeyFunctor<vcmap_t, coarse_labels_t>(vcmap, coarseLabels, keys));
+    return labels_from_keys(keys);
+  }
+};
+
+}  // namespace Impl
+}  // namespace Experimental
+}  // namespace KokkosGraph
+
+#endif
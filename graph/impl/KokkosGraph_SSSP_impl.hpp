@@ -0,0 +1,231 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef _KOKKOSGRAPH_SSSP_IMPL_HPP
+#define _KOKKOSGRAPH_SSSP_IMPL_HPP
+
+#include <type_traits>
+#include <utility>
+#include "Kokkos_Core.hpp"
+#include "Kokkos_ArithTraits.hpp"
+
+namespace KokkosGraph {
+namespace Experimental {
+namespace Impl {
+
+// Delta-stepping single-source shortest paths (Meyer and Sanders), on the
+// device of execution space exec_space, with the near/far frontier of
+// Davidson et al. The vertices with a tentative distance in the current
+// bucket [lower, lower + delta) form a queue, expanded like the top-down
+// BFS step: every edge out of the queue is relaxed with an atomic min, and
+// an improved neighbor goes to the next queue if it is still in the bucket,
+// or to the far pile otherwise. When the bucket is settled, the next one
+// starts at the smallest distance in the far pile, and the far pile is split
+// into its new queue and the rest.
+template <typename exec_space, typename rowmap_t, typename entries_t,
+          typename weights_t, typename dist_view_t>
+struct DeltaSteppingSSSP {
+  using size_type    = typename rowmap_t::non_const_value_type;
+  using lno_t        = typename entries_t::non_const_value_type;
+  using weight_t     = typename dist_view_t::non_const_value_type;
+  using mem_space    = typename dist_view_t::memory_space;
+  using range_policy = Kokkos::RangePolicy<exec_space>;
+  using work_view_t  = Kokkos::View<lno_t*, mem_space>;
+  using count_view_t = Kokkos::View<lno_t, mem_space>;
+  using WAT          = Kokkos::ArithTraits<weight_t>;
+
+  static_assert(std::is_arithmetic<weight_t>::value,
+                "graph_sssp: the edge weights must be real numbers");
+
+  lno_t numVerts;
+  rowmap_t rowmap;
+  entries_t entries;
+  weights_t weights;
+  weight_t delta;
+
+  DeltaSteppingSSSP(const rowmap_t& rowmap_, const entries_t& entries_,
+                    const weights_t& weights_, const weight_t delta_)
+      : numVerts(rowmap_.extent(0) - 1),
+        rowmap(rowmap_),
+        entries(entries_),
+        weights(weights_),
+        delta(delta_) {}
+
+  // a + b, or the largest weight if that overflows
+  KOKKOS_INLINE_FUNCTION static weight_t saturating_add(const weight_t a,
+                                                        const weight_t b) {
+    return a > WAT::max() - b ? WAT::max() : a + b;
+  }
+
+  // Relax the edges out of q(0:qSize). An improved neighbor is appended to
+  // nextQ once per round if its distance is below upper, and to far once
+  // (until it leaves the far pile) otherwise.
+  struct RelaxFunctor {
+    rowmap_t rowmap;
+    entries_t entries;
+    weights_t weights;
+    work_view_t q;
+    work_view_t nextQ;
+    work_view_t far;
+    dist_view_t dist;
+    work_view_t queued;
+    work_view_t inFar;
+    count_view_t nextCount;
+    count_view_t farCount;
+    lno_t round;
+    weight_t upper;
+    lno_t numVerts;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const lno_t i) const {
+      const lno_t v       = q(i);
+      const weight_t distV = dist(v);
+      for (size_type j = rowmap(v); j < rowmap(v + 1); j++) {
+        const lno_t nei = entries(j);
+        if (nei >= numVerts) continue;
+        const weight_t d = saturating_add(distV, weights(j));
+        if (!(d < dist(nei))) continue;
+        if (!(d < Kokkos::atomic_fetch_min(&dist(nei), d))) continue;
+        if (d < upper) {
+          if (Kokkos::atomic_exchange(&queued(nei), round) != round)
+            nextQ(Kokkos::atomic_fetch_add(&nextCount(), lno_t(1))) = nei;
+        } else if (Kokkos::atomic_exchange(&inFar(nei), lno_t(1)) == 0) {
+          far(Kokkos::atomic_fetch_add(&farCount(), lno_t(1))) = nei;
+        }
+      }
+    }
+  };
+
+  // Smallest distance of the far pile not below upper, i.e. not settled
+  struct FarMinFunctor {
+    work_view_t far;
+    dist_view_t dist;
+    weight_t upper;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const lno_t i, weight_t& m) const {
+      const weight_t d = dist(far(i));
+      if (d >= upper && d < m) m = d;
+    }
+  };
+
+  // Split the far pile: the settled vertices (below oldUpper) are dropped,
+  // the vertices below upper go to q and the others to nextFar
+  struct FarSplitFunctor {
+    work_view_t far;
+    work_view_t q;
+    work_view_t nextFar;
+    dist_view_t dist;
+    work_view_t inFar;
+    count_view_t qCount;
+    count_view_t farCount;
+    weight_t oldUpper;
+    weight_t upper;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const lno_t i) const {
+      const lno_t v    = far(i);
+      const weight_t d = dist(v);
+      if (d >= upper) {
+        nextFar(Kokkos::atomic_fetch_add(&farCount(), lno_t(1))) = v;
+        return;
+      }
+      inFar(v) = 0;
+      if (d >= oldUpper)
+        q(Kokkos::atomic_fetch_add(&qCount(), lno_t(1))) = v;
+    }
+  };
+
+  dist_view_t sssp(const lno_t source) {
+    dist_view_t dist(Kokkos::view_alloc(Kokkos::WithoutInitializing, "Dist"),
+                     numVerts);
+    Kokkos::deep_copy(exec_space(), dist, WAT::max());
+    Kokkos::deep_copy(exec_space(), Kokkos::subview(dist, source),
+                      WAT::zero());
+
+    work_view_t q(Kokkos::view_alloc(Kokkos::WithoutInitializing, "Queue"),
+                  numVerts);
+    work_view_t nextQ(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "NextQueue"),
+        numVerts);
+    work_view_t far(Kokkos::view_alloc(Kokkos::WithoutInitializing, "Far"),
+                    numVerts);
+    work_view_t nextFar(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "NextFar"), numVerts);
+    work_view_t queued("Queued", numVerts);
+    work_view_t inFar("InFar", numVerts);
+    count_view_t nextCount("NextCount");
+    count_view_t farCount("FarCount");
+    Kokkos::deep_copy(exec_space(), Kokkos::subview(q, 0), source);
+
+    lno_t qSize    = 1;
+    lno_t round    = 0;
+    weight_t upper = saturating_add(WAT::zero(), delta);
+    while (true) {
+      // Settle the bucket below upper
+      while (qSize > 0) {
+        round++;
+        Kokkos::parallel_for(
+            "KokkosGraph::SSSP::relax", range_policy(0, qSize),
+            RelaxFunctor{rowmap, entries, weights, q, nextQ, far, dist,
+                         queued, inFar, nextCount, farCount, round, upper,
+                         numVerts});
+        Kokkos::deep_copy(qSize, nextCount);
+        Kokkos::deep_copy(exec_space(), nextCount, lno_t(0));
+        std::swap(q, nextQ);
+      }
+
+      // Start the next bucket at the nearest vertex of the far pile
+      lno_t farSize;
+      Kokkos::deep_copy(farSize, farCount);
+      if (farSize == 0) break;
+      weight_t farMin = WAT::max();
+      Kokkos::parallel_reduce("KokkosGraph::SSSP::far_min",
+                              range_policy(0, farSize),
+                              FarMinFunctor{far, dist, upper},
+                              Kokkos::Min<weight_t>(farMin));
+      const weight_t oldUpper = upper;
+      upper                   = saturating_add(farMin, delta);
+      // if delta is lost to rounding, the far pile is settled all at once
+      if (!(farMin < upper)) upper = WAT::max();
+      Kokkos::deep_copy(exec_space(), farCount, lno_t(0));
+      Kokkos::parallel_for(
+          "KokkosGraph::SSSP::far_split", range_policy(0, farSize),
+          FarSplitFunctor{far, q, nextFar, dist, inFar, nextCount, farCount,
+                          oldUpper, upper});
+      Kokkos::deep_copy(qSize, nextCount);
+      Kokkos::deep_copy(exec_space(), nextCount, lno_t(0));
+      std::swap(far, nextFar);
+    }
+    return dist;
+  }
+};
+
+// Reduces the smallest and largest edge weights
+template <typename weights_t>
+struct WeightRangeFunctor {
+  using weight_t = typename weights_t::non_const_value_type;
+
+  weights_t weights;
+
+  KOKKOS_INLINE_FUNCTION void operator()(
+      const size_t i, Kokkos::MinMaxScalar<weight_t>& range) const {
+    const weight_t w = weights(i);
+    if (w < range.min_val) range.min_val = w;
+    if (w > range.max_val) range.max_val = w;
+  }
+};
+
+}  // namespace Impl
+}  // namespace Experimental
+}  // namespace KokkosGraph
+#endif
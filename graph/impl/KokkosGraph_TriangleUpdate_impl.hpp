@@ -0,0 +1,380 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef _KOKKOSGRAPH_TRIANGLE_UPDATE_IMPL_HPP
+#define _KOKKOSGRAPH_TRIANGLE_UPDATE_IMPL_HPP
+
+#include <cstdint>
+#include <stdexcept>
+#include "Kokkos_Core.hpp"
+#include "Kokkos_Sort.hpp"
+#include "KokkosKernels_SimpleUtils.hpp"
+
+namespace KokkosGraph {
+namespace Impl {
+
+// True if y is in the (sorted) row x of the graph
+template <typename rowmap_t, typename entries_t, typename lno_t>
+KOKKOS_INLINE_FUNCTION bool triangle_has_edge(const rowmap_t& rowmap,
+                                              const entries_t& entries,
+                                              const lno_t x, const lno_t y) {
+  using size_type = typename rowmap_t::non_const_value_type;
+  size_type lo = rowmap(x), hi = rowmap(x + 1);
+  while (lo < hi) {
+    const size_type mid = lo + (hi - lo) / 2;
+    if (entries(mid) < y)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  return lo < rowmap(x + 1) && entries(lo) == y;
+}
+
+// Per-vertex triangle counts of a symmetric graph with sorted rows, and
+// their update for a batch of edge deletions and insertions.
+//
+// A batch is stored as a symmetric "delta" graph with sorted rows. The
+// deletions are applied first: the triangles destroyed are the triangles of
+// the old graph with at least one deleted edge, found by intersecting the
+// two rows of each deleted edge. Then the insertions: the triangles created
+// are those of the new graph with at least one inserted edge. A triangle with
+// several changed edges is counted from the first of them only (with the
+// edges (a, b) < (a, c) < (b, c) for a < b < c), so that only the rows of the
+// changed edges are read, and each triangle is counted once.
+template <typename device_t, typename rowmap_t, typename entries_t,
+          typename counts_t>
+struct TriangleUpdate {
+  using exec_space    = typename device_t::execution_space;
+  using size_type     = typename rowmap_t::non_const_value_type;
+  using lno_t         = typename entries_t::non_const_value_type;
+  using count_t       = typename counts_t::non_const_value_type;
+  using range_policy  = Kokkos::RangePolicy<exec_space>;
+  using key_view_t    = Kokkos::View<uint64_t*, device_t>;
+  using rowmap_out_t  = typename rowmap_t::non_const_type;
+  using entries_out_t = typename entries_t::non_const_type;
+  using c_rowmap_t    = typename rowmap_t::const_type;
+  using c_entries_t   = typename entries_t::const_type;
+
+  enum Mode { Count, Delete, Insert };
+
+  // The symmetric delta graph of a list of undirected edges (self loops and
+  // duplicates are dropped): rowmap, entries, and the row of each entry
+  struct DeltaGraph {
+    rowmap_out_t rowmap;
+    entries_out_t entries;
+    entries_out_t rows;
+  };
+
+  template <typename edges_t>
+  static DeltaGraph build_delta(const lno_t numVerts, const edges_t& src,
+                                const edges_t& dst) {
+    const size_type numEdges = src.extent(0);
+    if (dst.extent(0) != src.extent(0)) {
+      throw std::invalid_argument(
+          "triangle_count_update: the source and destination lists of an edge "
+          "batch must have the same length");
+    }
+    const uint64_t n        = numVerts;
+    const uint64_t invalid  = ~uint64_t(0);
+    key_view_t keys(Kokkos::view_alloc(Kokkos::WithoutInitializing, "Keys"),
+                    2 * numEdges);
+    lno_t numOutOfRange = 0;
+    Kokkos::parallel_reduce(
+        "KokkosGraph::TriangleUpdate::Keys", range_policy(0, numEdges),
+        KOKKOS_LAMBDA(const size_type i, lno_t& lerrors) {
+          const lno_t u = src(i);
+          const lno_t v = dst(i);
+          if (u < 0 || v < 0 || u >= numVerts || v >= numVerts) {
+            lerrors++;
+            keys(2 * i) = keys(2 * i + 1) = invalid;
+          } else if (u == v) {
+            keys(2 * i) = keys(2 * i + 1) = invalid;
+          } else {
+            keys(2 * i)     = uint64_t(u) * n + uint64_t(v);
+            keys(2 * i + 1) = uint64_t(v) * n + uint64_t(u);
+          }
+        },
+        numOutOfRange);
+    if (numOutOfRange) {
+      throw std::invalid_argument(
+          "triangle_count_update: edge batch has a vertex out of range");
+    }
+    Kokkos::sort(keys);
+
+    DeltaGraph delta;
+    delta.rowmap = rowmap_out_t("Delta rowmap", numVerts + 1);
+    size_type numEntries = 0;
+    auto rowCounts       = delta.rowmap;
+    Kokkos::parallel_reduce(
+        "KokkosGraph::TriangleUpdate::CountDelta",
+        range_policy(0, 2 * numEdges),
+        KOKKOS_LAMBDA(const size_type i, size_type& lcount) {
+          if (keys(i) == invalid || (i > 0 && keys(i) == keys(i - 1))) return;
+          Kokkos::atomic_inc(&rowCounts(keys(i) / n));
+          lcount++;
+        },
+        numEntries);
+    KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum<rowmap_out_t,
+                                                          exec_space>(
+        numVerts + 1, delta.rowmap);
+    delta.entries = entries_out_t(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "Delta entries"),
+        numEntries);
+    delta.rows = entries_out_t(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "Delta rows"),
+        numEntries);
+    auto entries = delta.entries;
+    auto rows    = delta.rows;
+    // the keys are sorted, so the unique ones are in CRS order
+    Kokkos::parallel_scan(
+        "KokkosGraph::TriangleUpdate::FillDelta",
+        range_policy(0, 2 * numEdges),
+        KOKKOS_LAMBDA(const size_type i, size_type& lpos, const bool final) {
+          if (keys(i) == invalid || (i > 0 && keys(i) == keys(i - 1))) return;
+          if (final) {
+            rows(lpos)    = keys(i) / n;
+            entries(lpos) = keys(i) % n;
+          }
+          lpos++;
+        });
+    return delta;
+  }
+
+  // Visits the triangles with a changed edge (all the edges in Count mode),
+  // in the graph (rowmap, entries), from the entries of the delta graph; a
+  // triangle is counted from its first changed edge. In Insert mode, an edge
+  // of the insertion batch is changed only if it is not in the old graph, or
+  // it is deleted.
+  struct TriangleFunctor {
+    c_rowmap_t rowmap;
+    c_entries_t entries;
+    c_rowmap_t deltaRowmap;
+    c_entries_t deltaEntries;
+    c_entries_t deltaRows;
+    c_rowmap_t oldRowmap;
+    c_entries_t oldEntries;
+    c_rowmap_t delRowmap;
+    c_entries_t delEntries;
+    counts_t counts;
+    Mode mode;
+
+    KOKKOS_INLINE_FUNCTION bool changed(const lno_t x, const lno_t y) const {
+      switch (mode) {
+        case Delete: return triangle_has_edge(deltaRowmap, deltaEntries, x, y);
+        case Insert:
+          return triangle_has_edge(deltaRowmap, deltaEntries, x, y) &&
+                 (!triangle_has_edge(oldRowmap, oldEntries, x, y) ||
+                  triangle_has_edge(delRowmap, delEntries, x, y));
+        default: return true;
+      }
+    }
+
+    KOKKOS_INLINE_FUNCTION void operator()(const size_type k,
+                                           count_t& lcount) const {
+      const lno_t u = deltaRows(k);
+      const lno_t v = deltaEntries(k);
+      if (v < u) return;
+      // a deleted edge must be in the graph, an inserted edge must be new
+      if (mode == Delete && !triangle_has_edge(rowmap, entries, u, v)) return;
+      if (mode == Insert && !changed(u, v)) return;
+      size_type i          = rowmap(u);
+      size_type j          = rowmap(v);
+      const size_type iEnd = rowmap(u + 1);
+      const size_type jEnd = rowmap(v + 1);
+      while (i < iEnd && j < jEnd) {
+        const lno_t a = entries(i);
+        const lno_t b = entries(j);
+        if (a < b) {
+          i++;
+        } else if (b < a) {
+          j++;
+        } else {
+          i++;
+          j++;
+          const lno_t w = a;
+          if (w == u || w == v) continue;
+          // the edges of the triangle before (u, v), for u < v
+          bool first = true;
+          if (w < u) {
+            // (w, u) < (w, v) < (u, v)
+            first = !changed(w, u) && !changed(w, v);
+          } else if (w < v) {
+            // (u, w) < (u, v) < (w, v)
+            first = !changed(u, w);
+          }
+          if (!first) continue;
+          if (mode == Delete) {
+            Kokkos::atomic_sub(&counts(u), count_t(1));
+            Kokkos::atomic_sub(&counts(v), count_t(1));
+            Kokkos::atomic_sub(&counts(w), count_t(1));
+          } else {
+            Kokkos::atomic_add(&counts(u), count_t(1));
+            Kokkos::atomic_add(&counts(v), count_t(1));
+            Kokkos::atomic_add(&counts(w), count_t(1));
+          }
+          lcount++;
+        }
+      }
+    }
+  };
+
+  // Row i of the new graph: the old row without the deleted entries, merged
+  // with the inserted entries. Counts the entries, and writes them if
+  // newEntries is allocated.
+  struct MergeRowsFunctor {
+    rowmap_t oldRowmap;
+    entries_t oldEntries;
+    rowmap_out_t delRowmap;
+    entries_out_t delEntries;
+    rowmap_out_t insRowmap;
+    entries_out_t insEntries;
+    rowmap_out_t newRowmap;
+    entries_out_t newEntries;
+    bool fill;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const lno_t r) const {
+      size_type i          = oldRowmap(r);
+      const size_type iEnd = oldRowmap(r + 1);
+      size_type d          = delRowmap(r);
+      const size_type dEnd = delRowmap(r + 1);
+      size_type s          = insRowmap(r);
+      const size_type sEnd = insRowmap(r + 1);
+      size_type out        = fill ? newRowmap(r) : 0;
+      if (d == dEnd && s == sEnd) {
+        // untouched row
+        if (fill) {
+          for (; i < iEnd; i++) newEntries(out++) = oldEntries(i);
+        } else {
+          newRowmap(r) = iEnd - i;
+        }
+        return;
+      }
+      while (i < iEnd || s < sEnd) {
+        // next old entry, skipping the deleted ones
+        if (i < iEnd) {
+          while (d < dEnd && delEntries(d) < oldEntries(i)) d++;
+          if (d < dEnd && delEntries(d) == oldEntries(i)) {
+            i++;
+            continue;
+          }
+        }
+        lno_t next;
+        if (s == sEnd || (i < iEnd && oldEntries(i) < insEntries(s))) {
+          next = oldEntries(i++);
+        } else if (i == iEnd || insEntries(s) < oldEntries(i)) {
+          next = insEntries(s++);
+        } else {
+          // inserted edge already in the graph
+          next = oldEntries(i++);
+          s++;
+        }
+        if (fill) newEntries(out) = next;
+        out++;
+      }
+      if (!fill) newRowmap(r) = out;
+    }
+  };
+
+  static count_t count(const rowmap_t& rowmap, const entries_t& entries,
+                       const counts_t& counts) {
+    const lno_t numVerts = rowmap.extent(0) - 1;
+    Kokkos::deep_copy(counts, count_t(0));
+    if (numVerts <= 0) return 0;
+    // the delta graph is the graph itself
+    entries_out_t rows(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "Entry rows"),
+        entries.extent(0));
+    Kokkos::parallel_for(
+        "KokkosGraph::TriangleUpdate::EntryRows", range_policy(0, numVerts),
+        KOKKOS_LAMBDA(const lno_t r) {
+          for (size_type j = rowmap(r); j < rowmap(r + 1); j++) rows(j) = r;
+        });
+    TriangleFunctor visit{rowmap,       entries,       rowmap,
+                          entries,      rows,          c_rowmap_t(),
+                          c_entries_t(), c_rowmap_t(), c_entries_t(),
+                          counts,       Count};
+    count_t numTriangles = 0;
+    Kokkos::parallel_reduce("KokkosGraph::TriangleUpdate::Count",
+                            range_policy(0, entries.extent(0)), visit,
+                            numTriangles);
+    return numTriangles;
+  }
+
+  template <typename edges_t>
+  static void update(const rowmap_t& rowmap, const entries_t& entries,
+                     const edges_t& insertSrc, const edges_t& insertDst,
+                     const edges_t& deleteSrc, const edges_t& deleteDst,
+                     rowmap_out_t& newRowmap, entries_out_t& newEntries,
+                     const counts_t& counts, count_t& numTriangles) {
+    const lno_t numVerts = rowmap.extent(0) - 1;
+    if (numVerts <= 0) {
+      newRowmap  = rowmap_out_t("New rowmap", rowmap.extent(0));
+      newEntries = entries_out_t();
+      return;
+    }
+    DeltaGraph del = build_delta(numVerts, deleteSrc, deleteDst);
+    DeltaGraph ins = build_delta(numVerts, insertSrc, insertDst);
+
+    // triangles destroyed, in the old graph
+    count_t numDestroyed = 0;
+    Kokkos::parallel_reduce(
+        "KokkosGraph::TriangleUpdate::Delete",
+        range_policy(0, del.entries.extent(0)),
+        TriangleFunctor{rowmap, entries, del.rowmap, del.entries, del.rows,
+                        rowmap, entries, del.rowmap, del.entries, counts,
+                        Delete},
+        numDestroyed);
+
+    // the new graph
+    newRowmap = rowmap_out_t(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "New rowmap"),
+        numVerts + 1);
+    MergeRowsFunctor merge{rowmap,     entries,     del.rowmap,
+                           del.entries, ins.rowmap, ins.entries,
+                           newRowmap,   entries_out_t(), false};
+    Kokkos::parallel_for("KokkosGraph::TriangleUpdate::CountRows",
+                         range_policy(0, numVerts), merge);
+    Kokkos::deep_copy(Kokkos::subview(newRowmap, numVerts), size_type(0));
+    KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum<rowmap_out_t,
+                                                          exec_space>(
+        numVerts + 1, newRowmap);
+    size_type newNnz = 0;
+    Kokkos::deep_copy(newNnz, Kokkos::subview(newRowmap, numVerts));
+    newEntries = entries_out_t(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "New entries"),
+        newNnz);
+    merge.newEntries = newEntries;
+    merge.fill       = true;
+    Kokkos::parallel_for("KokkosGraph::TriangleUpdate::FillRows",
+                         range_policy(0, numVerts), merge);
+
+    // triangles created, in the new graph
+    count_t numCreated = 0;
+    Kokkos::parallel_reduce(
+        "KokkosGraph::TriangleUpdate::Insert",
+        range_policy(0, ins.entries.extent(0)),
+        TriangleFunctor{newRowmap, newEntries, ins.rowmap, ins.entries,
+                        ins.rows, rowmap, entries, del.rowmap, del.entries,
+                        counts, Insert},
+        numCreated);
+    numTriangles = numTriangles - numDestroyed + numCreated;
+  }
+};
+
+}  // namespace Impl
+}  // namespace KokkosGraph
+
+#endif
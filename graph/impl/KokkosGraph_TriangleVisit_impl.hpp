@@ -0,0 +1,162 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef _KOKKOSGRAPH_TRIANGLE_VISIT_IMPL_HPP
+#define _KOKKOSGRAPH_TRIANGLE_VISIT_IMPL_HPP
+
+#include <cstdint>
+#include "Kokkos_Core.hpp"
+
+namespace KokkosGraph {
+namespace Impl {
+
+// Streams the triangles of a symmetric graph with sorted rows to a visitor,
+// without storing them. A team handles the row of a vertex u, and each of
+// its threads an entry v > u of the row, intersecting the two rows by
+// merging. Self loops are skipped.
+template <typename device_t, typename rowmap_t, typename entries_t,
+          typename visitor_t>
+struct TriangleVisit {
+  using exec_space  = typename device_t::execution_space;
+  using size_type   = typename rowmap_t::non_const_value_type;
+  using lno_t       = typename entries_t::non_const_value_type;
+  using team_policy = Kokkos::TeamPolicy<exec_space>;
+  using member_t    = typename team_policy::member_type;
+
+  // The first position of the (sorted) row x with an entry above y
+  KOKKOS_INLINE_FUNCTION static size_type first_above(
+      const rowmap_t& rowmap, const entries_t& entries, const lno_t x,
+      const lno_t y) {
+    size_type lo = rowmap(x), hi = rowmap(x + 1);
+    while (lo < hi) {
+      const size_type mid = lo + (hi - lo) / 2;
+      if (entries(mid) <= y)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+    return lo;
+  }
+
+  // visitor(u, v, w) once per triangle, with u < v < w
+  struct TriangleFunctor {
+    rowmap_t rowmap;
+    entries_t entries;
+    visitor_t visitor;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const member_t& t,
+                                           int64_t& lcount) const {
+      const lno_t u      = t.league_rank();
+      const size_type k0 = first_above(rowmap, entries, u, u);
+      int64_t found      = 0;
+      Kokkos::parallel_reduce(
+          Kokkos::TeamThreadRange(t, k0, rowmap(u + 1)),
+          [&](const size_type k, int64_t& c) {
+            const lno_t v        = entries(k);
+            size_type i          = k + 1;
+            size_type j          = first_above(rowmap, entries, v, v);
+            const size_type iEnd = rowmap(u + 1);
+            const size_type jEnd = rowmap(v + 1);
+            while (i < iEnd && j < jEnd) {
+              const lno_t a = entries(i);
+              const lno_t b = entries(j);
+              if (a < b) {
+                i++;
+              } else if (b < a) {
+                j++;
+              } else {
+                visitor(u, v, a);
+                c++;
+                i++;
+                j++;
+              }
+            }
+          },
+          found);
+      Kokkos::single(Kokkos::PerTeam(t), [&]() { lcount += found; });
+    }
+  };
+
+  // visitor(u, v, c) once per edge, with u < v and c the number of
+  // triangles through the edge
+  struct EdgeFunctor {
+    rowmap_t rowmap;
+    entries_t entries;
+    visitor_t visitor;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const member_t& t,
+                                           int64_t& lcount) const {
+      const lno_t u      = t.league_rank();
+      const size_type k0 = first_above(rowmap, entries, u, u);
+      int64_t found      = 0;
+      Kokkos::parallel_reduce(
+          Kokkos::TeamThreadRange(t, k0, rowmap(u + 1)),
+          [&](const size_type k, int64_t& c) {
+            const lno_t v        = entries(k);
+            size_type i          = rowmap(u);
+            size_type j          = rowmap(v);
+            const size_type iEnd = rowmap(u + 1);
+            const size_type jEnd = rowmap(v + 1);
+            lno_t edgeCount      = 0;
+            while (i < iEnd && j < jEnd) {
+              const lno_t a = entries(i);
+              const lno_t b = entries(j);
+              if (a < b) {
+                i++;
+              } else if (b < a) {
+                j++;
+              } else {
+                if (a != u && a != v) edgeCount++;
+                i++;
+                j++;
+              }
+            }
+            visitor(u, v, edgeCount);
+            c += edgeCount;
+          },
+          found);
+      Kokkos::single(Kokkos::PerTeam(t), [&]() { lcount += found; });
+    }
+  };
+
+  static int64_t triangles(const rowmap_t& rowmap, const entries_t& entries,
+                           const visitor_t& visitor) {
+    const lno_t numVerts = rowmap.extent(0) ? rowmap.extent(0) - 1 : 0;
+    int64_t numTriangles = 0;
+    if (numVerts <= 0) return 0;
+    Kokkos::parallel_reduce("KokkosGraph::TriangleVisit::Triangles",
+                            team_policy(numVerts, Kokkos::AUTO),
+                            TriangleFunctor{rowmap, entries, visitor},
+                            numTriangles);
+    return numTriangles;
+  }
+
+  static int64_t edges(const rowmap_t& rowmap, const entries_t& entries,
+                       const visitor_t& visitor) {
+    const lno_t numVerts = rowmap.extent(0) ? rowmap.extent(0) - 1 : 0;
+    int64_t incidences   = 0;
+    if (numVerts <= 0) return 0;
+    Kokkos::parallel_reduce("KokkosGraph::TriangleVisit::Edges",
+                            team_policy(numVerts, Kokkos::AUTO),
+                            EdgeFunctor{rowmap, entries, visitor}, incidences);
+    // each triangle is counted from its three edges
+    return incidences / 3;
+  }
+};
+
+}  // namespace Impl
+}  // namespace KokkosGraph
+
+#endif
@@ -81,7 +81,11 @@ struct COLOR_D1<KernelHandle, size_view_t, lno_view_t, false,
   static void color_d1(KernelHandle *handle,
                        typename lno_view_t::non_const_value_type num_rows,
                        size_view_t rowmap, lno_view_t entries) {
+    Kokkos::Profiling::pushRegion(KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+                                      ? "KokkosGraph::color_d1[ETI]"
+                                      : "KokkosGraph::color_d1[noETI]");
     KokkosGraph::Impl::graph_color_impl(handle, num_rows, rowmap, entries);
+    Kokkos::Profiling::popRegion();
   }
 };
 
@@ -0,0 +1,56 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef _KOKKOSGRAPH_BFS_HPP
+#define _KOKKOSGRAPH_BFS_HPP
+
+#include <stdexcept>
+#include "KokkosGraph_BFS_impl.hpp"
+
+namespace KokkosGraph {
+namespace Experimental {
+
+// Breadth-first search of a graph from the vertex source, on device_t's
+// execution space. The graph must be symmetric. This function returns the
+// distance (number of edges) from source to each vertex, or -1 for the
+// vertices not connected to source.
+//
+// The search is direction-optimizing: a level is expanded top-down from a
+// queue of the frontier while the frontier is small, and bottom-up from a
+// bitmap of the frontier (each unvisited vertex looks for a parent) when the
+// edges out of the frontier exceed 1/alpha of the edges out of the unvisited
+// vertices, until the frontier has less than numVerts / beta vertices.
+template <typename device_t, typename rowmap_t, typename colinds_t,
+          typename distances_t = typename colinds_t::non_const_type>
+distances_t graph_bfs(const rowmap_t& rowmap, const colinds_t& colinds,
+                      const typename colinds_t::non_const_value_type source,
+                      const double alpha = 14, const double beta = 24) {
+  using lno_t    = typename colinds_t::non_const_value_type;
+  lno_t numVerts = rowmap.extent(0);
+  if (numVerts) numVerts--;
+  if (source < 0 || source >= numVerts) {
+    throw std::invalid_argument("graph_bfs: source is not a vertex");
+  }
+  Impl::DirectionOptimizingBFS<typename device_t::execution_space, rowmap_t,
+                               colinds_t, distances_t>
+      algo(rowmap, colinds, alpha, beta);
+  return algo.bfs(source);
+}
+
+}  // namespace Experimental
+}  // namespace KokkosGraph
+
+#endif
@@ -17,8 +17,10 @@
 #pragma once
 // exclude from Cuda builds without lambdas enabled
 #if !defined(KOKKOS_ENABLE_CUDA) || defined(KOKKOS_ENABLE_CUDA_LAMBDA)
+#include <iterator>
 #include <list>
 #include <limits>
+#include <stdexcept>
 #include <Kokkos_Core.hpp>
 #include "KokkosSparse_CrsMatrix.hpp"
 #include "KokkosSparse_spgemm.hpp"
@@ -26,6 +28,7 @@
 #include "KokkosKernels_HashmapAccumulator.hpp"
 #include "KokkosKernels_Uniform_Initialized_MemoryPool.hpp"
 #include "KokkosGraph_CoarsenHeuristics.hpp"
+#include "KokkosGraph_ExplicitCoarsening_impl.hpp"
 
 namespace KokkosSparse {
 
@@ -196,12 +199,15 @@ class coarse_builder {
   static constexpr bool scal_eq_ord = std::is_same<ordinal_t, scalar_t>::value;
   // contains matrix and vertex weights corresponding to current level
   // interp matrix maps previous level to this level
+  // fine_entry_map maps the entries of the previous level to the entries of
+  // mtx, it is computed by rebuild_coarse_graphs_numeric
   struct coarse_level_triple {
     matrix_t mtx;
     vtx_view_t vtx_wgts;
     matrix_t interp_mtx;
     int level;
     bool uniform_weights;
+    edge_view_t fine_entry_map;
   };
 
   // define behavior-controlling enums
@@ -264,8 +270,7 @@ class coarse_builder {
     ordinal_t nc = interp_mtx.numCols();
 
     matrix_t interp_transpose =
-        KokkosSparse::Impl::transpose_matrix(interp_mtx);
-    KokkosSparse::sort_crs_matrix(interp_transpose);
+        KokkosSparse::Impl::sorted_transpose_matrix(interp_mtx);
 
     spgemm_kernel_handle kh;
     kh.set_team_work_size(64);
@@ -1081,7 +1086,7 @@ class coarse_builder {
                                mem_chunk_size, mem_chunk_count);
         // Create Uniform Initialized Memory Pool
         KokkosKernels::Impl::PoolType pool_type =
-            KokkosKernels::Impl::ManyThread2OneChunk;
+            KokkosKernels::Impl::CachedManyThread2OneChunk;
 
         if (is_host_space) {
           pool_type = KokkosKernels::Impl::OneThread2OneChunk;
@@ -1214,7 +1219,7 @@ class coarse_builder {
                                mem_chunk_size, mem_chunk_count);
         // Create Uniform Initialized Memory Pool
         KokkosKernels::Impl::PoolType pool_type =
-            KokkosKernels::Impl::ManyThread2OneChunk;
+            KokkosKernels::Impl::CachedManyThread2OneChunk;
 
         if (is_host_space) {
           pool_type = KokkosKernels::Impl::OneThread2OneChunk;
@@ -1935,6 +1940,62 @@ class coarse_builder {
       if (levels.size() > handle.max_levels) break;
     }
   }
+
+  // recompute the edge weights of all the coarse graphs in handle.results
+  // from new edge weights of the finest graph (same pattern), through the
+  // existing aggregation: no heuristic runs, and the coarse patterns, vertex
+  // weights and interpolation matrices don't change. Each coarse edge weight
+  // is the sum of the weights of the fine edges between the two aggregates,
+  // like in build_coarse_graph. The aggregation itself was chosen for the
+  // weights passed to generate_coarse_graphs.
+  static void rebuild_coarse_graphs_numeric(coarsen_handle& handle,
+                                            const wgt_view_t fine_values) {
+    std::list<coarse_level_triple>& levels = handle.results;
+    if (levels.empty()) {
+      throw std::runtime_error(
+          "rebuild_coarse_graphs_numeric: generate_coarse_graphs must be "
+          "called first");
+    }
+    auto fine = levels.begin();
+    if (fine_values.extent(0) != static_cast<size_t>(fine->mtx.nnz())) {
+      throw std::invalid_argument(
+          "rebuild_coarse_graphs_numeric: the number of fine edge weights "
+          "does not match the finest graph");
+    }
+    fine->mtx.values = fine_values;
+    const edge_offset_t null_entry =
+        std::numeric_limits<edge_offset_t>::max();
+    for (auto coarse = std::next(fine); coarse != levels.end();
+         fine++, coarse++) {
+      const graph_type& fg = fine->mtx.graph;
+      const graph_type& cg = coarse->mtx.graph;
+      auto vcmap           = coarse->interp_mtx.graph.entries;
+      if (coarse->fine_entry_map.extent(0) !=
+          static_cast<size_t>(fine->mtx.nnz())) {
+        coarse->fine_entry_map = edge_view_t("fine entry map", fine->mtx.nnz());
+        const bool sorted =
+            KokkosSparse::Impl::isCrsGraphSorted(cg.row_map, cg.entries);
+        KokkosGraph::Impl::CoarseEntryMapFunctor<
+            edge_offset_t, typename graph_type::row_map_type,
+            typename graph_type::entries_type,
+            typename graph_type::entries_type,
+            typename graph_type::row_map_type,
+            typename graph_type::entries_type, edge_view_t>
+            map_entries(fg.row_map, fg.entries, vcmap, cg.row_map, cg.entries,
+                        coarse->fine_entry_map, sorted, null_entry);
+        Kokkos::parallel_for("map fine entries to coarse entries",
+                             policy_t(0, fine->mtx.numRows()), map_entries);
+      }
+      Kokkos::deep_copy(coarse->mtx.values, static_cast<scalar_t>(0));
+      KokkosGraph::Impl::CoarseValuesFunctor<edge_offset_t, edge_view_t,
+                                             typename matrix_t::values_type,
+                                             typename matrix_t::values_type>
+          sum_values(coarse->fine_entry_map, fine->mtx.values,
+                     coarse->mtx.values, null_entry);
+      Kokkos::parallel_for("sum coarse edge weights",
+                           policy_t(0, fine->mtx.nnz()), sum_values);
+    }
+  }
 };
 
 }  // end namespace Experimental
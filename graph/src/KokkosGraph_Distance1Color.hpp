@@ -16,7 +16,9 @@
 #ifndef _KOKKOSGRAPH_DISTANCE1_COLOR_HPP
 #define _KOKKOSGRAPH_DISTANCE1_COLOR_HPP
 
+#include <stdexcept>
 #include "KokkosGraph_color_d1_spec.hpp"
+#include "KokkosGraph_Distance1ColorUpdate_impl.hpp"
 #include "KokkosKernels_helpers.hpp"
 #include "KokkosKernels_Utils.hpp"
 
@@ -73,6 +75,58 @@ void graph_color(KernelHandle *handle,
                        is_symmetric);
 }
 
+/// \brief Repairs the coloring stored in the handle after local changes to
+/// the graph, recoloring only the vertices around the changes.
+///
+/// The graph (row_map, entries) is the modified graph. modified_vertices
+/// lists every vertex whose adjacency changed (both endpoints of an added
+/// edge); removing edges never invalidates a coloring. If num_rows is
+/// larger than the colored graph, the new vertices are colored as well.
+/// Vertices that are not in conflict keep their colors, and the number of
+/// colors grows to at most max(previous number of colors, max degree + 1).
+///
+/// \throws std::runtime_error if the handle holds no coloring yet
+template <class KernelHandle, typename lno_row_view_t_,
+          typename lno_nnz_view_t_, typename lno_view_t_>
+void graph_color_update(KernelHandle *handle,
+                        typename KernelHandle::nnz_lno_t num_rows,
+                        typename KernelHandle::nnz_lno_t /* num_cols */,
+                        lno_row_view_t_ row_map, lno_nnz_view_t_ entries,
+                        lno_view_t_ modified_vertices) {
+  typedef typename KernelHandle::HandleExecSpace ExecSpace;
+  typedef typename KernelHandle::nnz_lno_t lno_t;
+  typedef typename KernelHandle::GraphColoringHandleType::color_view_t
+      color_view_t;
+
+  auto *gch = handle->get_graph_coloring_handle();
+  if (!gch || !gch->is_coloring_called())
+    throw std::runtime_error(
+        "graph_color_update: the handle holds no coloring to update, call "
+        "graph_color first");
+  if (row_map.extent(0) != size_t(num_rows) + 1)
+    throw std::invalid_argument(
+        "graph_color_update: row_map must have num_rows + 1 entries");
+
+  color_view_t colors = gch->get_vertex_colors();
+  const lno_t numOld  = colors.extent(0) < size_t(num_rows)
+                            ? lno_t(colors.extent(0))
+                            : num_rows;
+  if (colors.extent(0) < size_t(num_rows)) {
+    color_view_t grown("Vertex Colors", num_rows);
+    Kokkos::deep_copy(
+        Kokkos::subview(grown, Kokkos::make_pair(lno_t(0), numOld)), colors);
+    colors = grown;
+  }
+
+  KokkosGraph::Impl::D1ColorUpdate<ExecSpace, lno_row_view_t_,
+                                   lno_nnz_view_t_, color_view_t,
+                                   lno_view_t_>(num_rows, row_map, entries,
+                                                colors)
+      .update(modified_vertices, numOld);
+  // resets the cached number of colors, so it is recounted on request
+  gch->set_vertex_colors(colors);
+}
+
 }  // end namespace Experimental
 }  // end namespace KokkosGraph
 
@@ -123,6 +123,9 @@ class GraphColoringHandle {
   int eb_num_initial_colors;  // the number of colors to assign at the beginning
                               // of the edge-based algorithm
 
+  bool balance_colors;  // whether to recolor the vertices after the coloring
+                        // to even out the sizes of the color classes.
+
   // STATISTICS
   double overall_coloring_time;  // the overall time that it took to color the
                                  // graph. In the case of the iterative calls.
@@ -164,6 +167,7 @@ class GraphColoringHandle {
         vb_chunk_size(8),
         max_number_of_iterations(200),
         eb_num_initial_colors(1),
+        balance_colors(false),
         overall_coloring_time(0),
         overall_coloring_time_phase1(0),
         overall_coloring_time_phase2(0),
@@ -616,6 +620,7 @@ class GraphColoringHandle {
     return this->max_number_of_iterations;
   }
   int get_eb_num_initial_colors() const { return this->eb_num_initial_colors; }
+  bool get_balance_colors() const { return this->balance_colors; }
 
   double get_overall_coloring_time() const {
     return this->overall_coloring_time;
@@ -678,6 +683,16 @@ class GraphColoringHandle {
   void set_eb_num_initial_colors(const int &num_initial_colors) {
     this->eb_num_initial_colors = num_initial_colors;
   }
+  /** \brief Whether to balance the coloring: after any algorithm, vertices of
+   * the color classes larger than ceil(num_rows / num_colors) are moved to
+   * smaller classes when no neighbor has that color. The number of colors
+   * does not change, but the tail of tiny colors left by the greedy
+   * algorithms gets filled, so that each color (e.g. a kernel launch of
+   * multicolor Gauss-Seidel) has enough work.
+   */
+  void set_balance_colors(const bool use_balance_colors) {
+    this->balance_colors = use_balance_colors;
+  }
   void add_to_overall_coloring_time(const double &coloring_time_) {
     this->overall_coloring_time += coloring_time_;
   }
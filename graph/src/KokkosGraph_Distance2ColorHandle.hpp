@@ -33,7 +33,9 @@ enum GraphColoringAlgorithmDistance2 {
   COLORING_D2_VB_BIT,     // Distance-2 Graph Coloring Vertex Based BIT
   COLORING_D2_VB_BIT_EF,  // Distance-2 Graph Coloring Vertex Based BIT + Edge
                           // Filtering
-  COLORING_D2_NB_BIT      // Distance-2 Graph Coloring Net Based BIT
+  COLORING_D2_NB_BIT,     // Distance-2 Graph Coloring Net Based BIT
+  COLORING_D2_VB_HYBRID   // Distance-2 Graph Coloring VB_BIT, with a team
+                          // per high-degree vertex
 };
 
 template <class size_type_, class color_t_, class lno_t_, class ExecutionSpace,
@@ -86,6 +88,9 @@ class GraphColorDistance2Handle {
                       // thread will be assigned to.
   int max_number_of_iterations;  // maximum allowed number of phases that
 
+  size_type hub_degree;  // in COLORING_D2_VB_HYBRID, vertices of higher
+                         // degree are colored by a team
+
   // STATISTICS
   double overall_coloring_time;  // The overall time taken to color the graph.
                                  // In the case of the iterative calls.
@@ -118,6 +123,7 @@ class GraphColorDistance2Handle {
         vb_edge_filtering(false),
         vb_chunk_size(8),
         max_number_of_iterations(200),
+        hub_degree(512),
         overall_coloring_time(0),
         overall_coloring_time_phase1(0),
         overall_coloring_time_phase2(0),
@@ -153,6 +159,7 @@ class GraphColorDistance2Handle {
    *                     - COLORING_D2_VB_BIT
    *                     - COLORING_D2_VB_BIT_EF
    *                     - COLORING_D2_NB_BIT
+   *                     - COLORING_D2_VB_HYBRID
    *
    *  @param[in] set_default_parameters Whether or not to reset the default
    * parameters for the given algorithm. Default = true.
@@ -214,6 +221,7 @@ class GraphColorDistance2Handle {
       case COLORING_D2_VB_BIT:
       case COLORING_D2_VB_BIT_EF:
       case COLORING_D2_NB_BIT:
+      case COLORING_D2_VB_HYBRID:
         this->tictoc                   = false;
         this->vb_edge_filtering        = false;
         this->vb_chunk_size            = 8;
@@ -265,6 +273,8 @@ class GraphColorDistance2Handle {
 
   int get_vb_chunk_size() const { return this->vb_chunk_size; }
 
+  size_type get_hub_degree() const { return this->hub_degree; }
+
   bool get_vb_edge_filtering() const { return this->vb_edge_filtering; }
 
   color_view_type get_vertex_colors() const { return this->vertex_colors; }
@@ -326,6 +336,16 @@ class GraphColorDistance2Handle {
     this->vb_chunk_size = chunksize;
   }
 
+  /**
+   * Sets the degree above which COLORING_D2_VB_HYBRID colors a vertex with a
+   * whole team, instead of a single thread. A hub then uses a fixed-size
+   * block of forbidden colors in team scratch, and its distance-2
+   * neighborhood is scanned in parallel.
+   */
+  void set_hub_degree(const size_type& hub_degree_) {
+    this->hub_degree = hub_degree_;
+  }
+
   void set_vb_edge_filtering(const bool& use_vb_edge_filtering) {
     this->vb_edge_filtering = use_vb_edge_filtering;
   }
@@ -432,6 +452,7 @@ class GraphColorDistance2Handle {
       case COLORING_D2_VB_BIT: return "COLORING_D2_VB_BIT";
       case COLORING_D2_VB_BIT_EF: return "COLORING_D2_VB_BIT_EF";
       case COLORING_D2_NB_BIT: return "COLORING_D2_NB_BIT";
+      case COLORING_D2_VB_HYBRID: return "COLORING_D2_VB_HYBRID";
     }
     return "ERROR: unregistered algorithm";
   }
@@ -19,6 +19,8 @@
 
 #include "KokkosGraph_ExplicitCoarsening_impl.hpp"
 #include "KokkosSparse_SortCrs.hpp"
+#include "KokkosSparse_Utils.hpp"
+#include "Kokkos_ArithTraits.hpp"
 
 namespace KokkosGraph {
 namespace Experimental {
@@ -105,6 +107,71 @@ void graph_explicit_coarsen_with_inverse_map(
   }
 }
 
+// Numeric-only coarsening with a fixed coarse graph: for each entry of the
+// fine graph, compute in entryMap (of length fineEntries.extent(0)) the index
+// of the entry of the coarse graph it contributes to, or the maximum value of
+// the entry map type if it is dropped (inside a cluster, or a remote column).
+// The coarse graph is the output of graph_explicit_coarsen for the same
+// labels; if it was not compressed, every fine entry maps to the first
+// matching coarse entry.
+//
+// graph_explicit_coarsen_values then coarsens any set of fine edge values
+// through entryMap, so that changing weights on a fixed topology does not
+// require recomputing the labels or the coarse graph.
+template <typename device_t, typename fine_rowmap_t, typename fine_entries_t,
+          typename labels_t, typename coarse_rowmap_t,
+          typename coarse_entries_t, typename entry_map_t>
+void graph_explicit_coarsen_entry_map(const fine_rowmap_t& fineRowmap,
+                                      const fine_entries_t& fineEntries,
+                                      const labels_t& labels,
+                                      const coarse_rowmap_t& coarseRowmap,
+                                      const coarse_entries_t& coarseEntries,
+                                      entry_map_t& entryMap) {
+  using size_type  = typename entry_map_t::non_const_value_type;
+  using lno_t      = typename fine_entries_t::non_const_value_type;
+  using exec_space = typename device_t::execution_space;
+  entryMap         = entry_map_t(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "Coarse entry map"),
+      fineEntries.extent(0));
+
+  lno_t numFineVerts = fineRowmap.extent(0);
+  if (numFineVerts <= 1) return;
+  numFineVerts--;
+  const bool sorted =
+      KokkosSparse::Impl::isCrsGraphSorted(coarseRowmap, coarseEntries);
+  KokkosGraph::Impl::CoarseEntryMapFunctor<size_type, fine_rowmap_t,
+                                           fine_entries_t, labels_t,
+                                           coarse_rowmap_t, coarse_entries_t,
+                                           entry_map_t>
+      mapEntries(fineRowmap, fineEntries, labels, coarseRowmap, coarseEntries,
+                 entryMap, sorted, Kokkos::ArithTraits<size_type>::max());
+  Kokkos::parallel_for("KokkosGraph::CoarseEntryMap",
+                       Kokkos::RangePolicy<exec_space>(0, numFineVerts),
+                       mapEntries);
+}
+
+// Coarse edge values from fine edge values, through an entry map computed by
+// graph_explicit_coarsen_entry_map: each coarse value is the sum of the fine
+// values mapped to it. coarseValues must have one value per coarse entry.
+template <typename device_t, typename entry_map_t, typename fine_values_t,
+          typename coarse_values_t>
+void graph_explicit_coarsen_values(const entry_map_t& entryMap,
+                                   const fine_values_t& fineValues,
+                                   const coarse_values_t& coarseValues) {
+  using size_type  = typename entry_map_t::non_const_value_type;
+  using exec_space = typename device_t::execution_space;
+  using value_type = typename coarse_values_t::non_const_value_type;
+  Kokkos::deep_copy(exec_space(), coarseValues,
+                    Kokkos::ArithTraits<value_type>::zero());
+  KokkosGraph::Impl::CoarseValuesFunctor<size_type, entry_map_t, fine_values_t,
+                                         coarse_values_t>
+      sumValues(entryMap, fineValues, coarseValues,
+                Kokkos::ArithTraits<size_type>::max());
+  Kokkos::parallel_for("KokkosGraph::CoarseValues",
+                       Kokkos::RangePolicy<exec_space>(0, entryMap.extent(0)),
+                       sumValues);
+}
+
 }  // namespace Experimental
 }  // namespace KokkosGraph
 
@@ -0,0 +1,67 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef _KOKKOSGRAPH_KCORE_HPP
+#define _KOKKOSGRAPH_KCORE_HPP
+
+#include "KokkosGraph_KCore_impl.hpp"
+
+namespace KokkosGraph {
+
+// Compute the core number of every vertex of a symmetric CRS graph, on
+// device_t's execution space: the largest k such that the vertex is in the
+// k-core, the maximal subgraph whose vertices all have degree at least k.
+//
+// Self loops and column indices >= num_verts are ignored.
+template <typename device_t, typename rowmap_t, typename entries_t,
+          typename cores_t = typename entries_t::non_const_type>
+cores_t kcore(const rowmap_t& rowmap, const entries_t& entries) {
+  if (rowmap.extent(0) <= 1) {
+    // there are no vertices
+    return cores_t();
+  }
+  Impl::KCoreDecomposition<device_t, rowmap_t, entries_t, cores_t> kc(
+      rowmap, entries);
+  kc.compute();
+  return kc.cores;
+}
+
+// Compute the k-truss of a symmetric CRS graph with sorted rows and no
+// duplicate entries, on device_t's execution space: the maximal subgraph
+// whose edges are all in at least k - 2 triangles of the subgraph. The
+// subgraph is returned in (trussRowmap, trussEntries), with the same
+// vertices, and sorted rows.
+//
+// Self loops, column indices >= num_verts and entries whose transpose is
+// missing are dropped.
+template <typename device_t, typename rowmap_t, typename entries_t>
+void ktruss(const rowmap_t& rowmap, const entries_t& entries,
+            const typename entries_t::non_const_value_type k,
+            typename rowmap_t::non_const_type& trussRowmap,
+            typename entries_t::non_const_type& trussEntries) {
+  if (rowmap.extent(0) <= 1) {
+    trussRowmap  = typename rowmap_t::non_const_type("Truss rowmap",
+                                                    rowmap.extent(0));
+    trussEntries = typename entries_t::non_const_type();
+    return;
+  }
+  Impl::KTruss<device_t, rowmap_t, entries_t> kt(rowmap, entries, k);
+  kt.compute(trussRowmap, trussEntries);
+}
+
+}  // namespace KokkosGraph
+
+#endif
@@ -0,0 +1,359 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#pragma once
+// exclude from Cuda builds without lambdas enabled
+#if !defined(KOKKOS_ENABLE_CUDA) || defined(KOKKOS_ENABLE_CUDA_LAMBDA)
+#include <stdexcept>
+#include <Kokkos_Core.hpp>
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosGraph_CoarsenConstruct.hpp"
+
+namespace KokkosGraph {
+
+namespace Experimental {
+
+// Parallel Louvain community detection (Blondel, Guillaume, Lambiotte and
+// Lefebvre), maximizing the modularity
+//   Q = sum_C [ in(C) / 2m - (tot(C) / 2m)^2 ]
+// where in(C) is the weight of the edges inside community C (both
+// directions), tot(C) the total strength of its vertices and 2m the total
+// strength of the graph. Each level runs local moves, then aggregates every
+// community into one vertex with coarse_builder::build_coarse_graph, until a
+// level moves no vertex.
+//
+// The local moves are synchronous, as in Lu, Halappanavar and Kalyanaraman:
+// every vertex picks the adjacent community with the best modularity gain
+// for the current labels, and all moves are applied at once. Two singleton
+// communities only merge into the one with the smaller label, so that they
+// don't swap forever. An iteration that lowers the modularity is undone and
+// ends the level.
+//
+// The input matrix is the symmetric adjacency of the graph; its values are
+// the edge weights, and a diagonal entry is a self loop of that weight.
+//
+// this class is not meant to be instantiated
+// think of it like a templated namespace
+template <class crsMat>
+class louvain {
+ public:
+  // define internal types
+  using matrix_t    = crsMat;
+  using exec_space  = typename matrix_t::execution_space;
+  using Device      = typename matrix_t::device_type;
+  using ordinal_t   = typename matrix_t::ordinal_type;
+  using edge_t      = typename matrix_t::size_type;
+  using scalar_t    = typename matrix_t::value_type;
+  using vtx_view_t  = Kokkos::View<ordinal_t*, Device>;
+  using wgt_view_t  = Kokkos::View<scalar_t*, Device>;
+  using real_view_t = Kokkos::View<double*, Device>;
+  using edge_view_t = Kokkos::View<edge_t*, Device>;
+  using policy_t    = Kokkos::RangePolicy<exec_space>;
+  using coarsener_t = coarse_builder<crsMat>;
+
+  using coarse_level_triple = typename coarsener_t::coarse_level_triple;
+
+  static_assert(std::is_signed<ordinal_t>::value,
+                "KokkosGraph::louvain: the ordinal type must be signed");
+
+  // number of distinct adjacent communities a vertex considers as
+  // destinations
+  static constexpr int max_local_comms = 64;
+
+  struct louvain_handle {
+    // builder of the aggregated graphs
+    typename coarsener_t::Builder builder = coarsener_t::Hybrid;
+    // maximum number of aggregation levels
+    int max_levels = 20;
+    // maximum number of local move iterations per level
+    int max_local_iters = 50;
+    // a level ends when an iteration improves the modularity by less
+    // than tol
+    double tol = 1e-6;
+    // results: the modularity of the final communities, their number and
+    // the number of levels run
+    double modularity         = 0;
+    ordinal_t num_communities = 0;
+    int num_levels            = 0;
+  };
+
+  // strength of each vertex: its edge weights plus its self loop weight
+  static real_view_t strengths(const matrix_t g, const real_view_t self) {
+    auto row_map = g.graph.row_map;
+    auto entries = g.graph.entries;
+    auto values  = g.values;
+    real_view_t k("vertex strengths", g.numRows());
+    Kokkos::parallel_for(
+        "louvain strengths", policy_t(0, g.numRows()),
+        KOKKOS_LAMBDA(const ordinal_t i) {
+          double s = self(i);
+          for (edge_t j = row_map(i); j < row_map(i + 1); j++) {
+            if (entries(j) != i) s += values(j);
+          }
+          k(i) = s;
+        });
+    return k;
+  }
+
+  // total strength of each community (communities are labeled < n)
+  static real_view_t community_strengths(const real_view_t k,
+                                         const vtx_view_t comm) {
+    real_view_t tot("community strengths", comm.extent(0));
+    Kokkos::parallel_for(
+        "louvain community strengths", policy_t(0, comm.extent(0)),
+        KOKKOS_LAMBDA(const ordinal_t i) {
+          Kokkos::atomic_add(&tot(comm(i)), k(i));
+        });
+    return tot;
+  }
+
+  // modularity of the communities comm of g, with self loop weights self
+  // and total strength m2
+  static double modularity(const matrix_t g, const real_view_t self,
+                           const real_view_t k, const vtx_view_t comm,
+                           const double m2) {
+    auto row_map    = g.graph.row_map;
+    auto entries    = g.graph.entries;
+    auto values     = g.values;
+    real_view_t tot = community_strengths(k, comm);
+    double inside   = 0;
+    Kokkos::parallel_reduce(
+        "louvain inside weight", policy_t(0, g.numRows()),
+        KOKKOS_LAMBDA(const ordinal_t i, double& update) {
+          double s = self(i);
+          for (edge_t j = row_map(i); j < row_map(i + 1); j++) {
+            const ordinal_t u = entries(j);
+            if (u != i && comm(u) == comm(i)) s += values(j);
+          }
+          update += s;
+        },
+        inside);
+    double squares = 0;
+    Kokkos::parallel_reduce(
+        "louvain community squares", policy_t(0, tot.extent(0)),
+        KOKKOS_LAMBDA(const ordinal_t c, double& update) {
+          update += tot(c) * tot(c);
+        },
+        squares);
+    return inside / m2 - squares / (m2 * m2);
+  }
+
+  // synchronous local moves from the communities comm (updated in place);
+  // returns the modularity reached
+  static double local_moves(const louvain_handle& handle, const matrix_t g,
+                            const real_view_t self, const real_view_t k,
+                            const double m2, vtx_view_t comm) {
+    const ordinal_t n = g.numRows();
+    auto row_map      = g.graph.row_map;
+    auto entries      = g.graph.entries;
+    auto values       = g.values;
+    vtx_view_t new_comm("moved communities", n);
+    vtx_view_t sizes("community sizes", n);
+    double q = modularity(g, self, k, comm, m2);
+    for (int iter = 0; iter < handle.max_local_iters; iter++) {
+      real_view_t tot = community_strengths(k, comm);
+      Kokkos::deep_copy(sizes, ordinal_t(0));
+      Kokkos::parallel_for(
+          "louvain community sizes", policy_t(0, n),
+          KOKKOS_LAMBDA(const ordinal_t i) {
+            Kokkos::atomic_inc(&sizes(comm(i)));
+          });
+      ordinal_t moved = 0;
+      Kokkos::parallel_reduce(
+          "louvain local moves", policy_t(0, n),
+          KOKKOS_LAMBDA(const ordinal_t i, ordinal_t& l_moved) {
+            const ordinal_t c = comm(i);
+            const double ki   = k(i);
+            // connections to the adjacent communities
+            ordinal_t local_c[max_local_comms];
+            double local_w[max_local_comms];
+            int nl     = 0;
+            double own = 0;
+            for (edge_t j = row_map(i); j < row_map(i + 1); j++) {
+              if (entries(j) == i) continue;
+              const ordinal_t d = comm(entries(j));
+              if (d == c) {
+                own += values(j);
+                continue;
+              }
+              int l = 0;
+              while (l < nl && local_c[l] != d) l++;
+              if (l < nl) {
+                local_w[l] += values(j);
+              } else if (nl < max_local_comms) {
+                local_c[nl] = d;
+                local_w[nl] = values(j);
+                nl++;
+              }
+            }
+            // gain of joining each community, i taken out of c
+            ordinal_t best_c = c;
+            double best_gain = own - ki * (tot(c) - ki) / m2;
+            for (int l = 0; l < nl; l++) {
+              const double gain = local_w[l] - ki * tot(local_c[l]) / m2;
+              if (gain > best_gain ||
+                  (gain == best_gain && best_c != c && local_c[l] < best_c)) {
+                best_c    = local_c[l];
+                best_gain = gain;
+              }
+            }
+            if (best_c != c && sizes(c) == 1 && sizes(best_c) == 1 &&
+                best_c > c)
+              best_c = c;
+            new_comm(i) = best_c;
+            if (best_c != c) l_moved++;
+          },
+          moved);
+      if (moved == 0) break;
+      const double new_q = modularity(g, self, k, new_comm, m2);
+      if (new_q < q) break;
+      Kokkos::deep_copy(comm, new_comm);
+      const bool converged = new_q - q < handle.tol;
+      q                    = new_q;
+      if (converged) break;
+    }
+    return q;
+  }
+
+  // relabel the communities to [0, nc); returns nc
+  static ordinal_t relabel(vtx_view_t comm) {
+    const ordinal_t n = comm.extent(0);
+    vtx_view_t ids("community ids", n + 1);
+    Kokkos::parallel_for(
+        "louvain used communities", policy_t(0, n),
+        KOKKOS_LAMBDA(const ordinal_t i) { ids(comm(i)) = 1; });
+    ordinal_t nc = 0;
+    Kokkos::parallel_scan(
+        "louvain community ids", policy_t(0, n),
+        KOKKOS_LAMBDA(const ordinal_t c, ordinal_t& offset, const bool final) {
+          const ordinal_t used = ids(c);
+          if (final) ids(c) = offset;
+          offset += used;
+        },
+        nc);
+    Kokkos::parallel_for(
+        "louvain relabel", policy_t(0, n),
+        KOKKOS_LAMBDA(const ordinal_t i) { comm(i) = ids(comm(i)); });
+    return nc;
+  }
+
+  // aggregate each community of level into a vertex; self receives the
+  // self loop weights of the aggregated graph
+  static coarse_level_triple aggregate(const louvain_handle& handle,
+                                       const coarse_level_triple level,
+                                       const real_view_t fine_self,
+                                       const vtx_view_t comm,
+                                       const ordinal_t nc,
+                                       real_view_t& self) {
+    const matrix_t g  = level.mtx;
+    const ordinal_t n = g.numRows();
+    auto row_map      = g.graph.row_map;
+    auto entries      = g.graph.entries;
+    auto values       = g.values;
+    edge_view_t interp_row_map("interpolate row map", n + 1);
+    vtx_view_t interp_entries("interpolate entries", n);
+    wgt_view_t interp_values("interpolate values", n);
+    self = real_view_t("self loop weights", nc);
+    Kokkos::parallel_for(
+        "louvain interpolation", policy_t(0, n + 1),
+        KOKKOS_LAMBDA(const ordinal_t i) {
+          interp_row_map(i) = i;
+          if (i == n) return;
+          interp_entries(i) = comm(i);
+          interp_values(i)  = 1;
+          // the edges inside a community become its self loop
+          double s = fine_self(i);
+          for (edge_t j = row_map(i); j < row_map(i + 1); j++) {
+            const ordinal_t u = entries(j);
+            if (u != i && comm(u) == comm(i)) s += values(j);
+          }
+          Kokkos::atomic_add(&self(comm(i)), s);
+        });
+    matrix_t vcmap("interpolate", n, nc, n, interp_values, interp_row_map,
+                   interp_entries);
+    typename coarsener_t::coarsen_handle ch;
+    ch.b = handle.builder;
+    return coarsener_t::build_coarse_graph(ch, level, vcmap);
+  }
+
+  // communities of the graph g, labeled in [0, handle.num_communities);
+  // sets the results in handle
+  static vtx_view_t detect(louvain_handle& handle, const matrix_t g) {
+    if (g.numRows() != g.numCols()) {
+      throw std::invalid_argument(
+          "KokkosGraph::louvain: the adjacency matrix must be square");
+    }
+    const ordinal_t n = g.numRows();
+    auto row_map      = g.graph.row_map;
+    auto entries      = g.graph.entries;
+    auto values       = g.values;
+    vtx_view_t result("communities", n);
+    real_view_t self("self loop weights", n);
+    Kokkos::parallel_for(
+        "louvain init", policy_t(0, n), KOKKOS_LAMBDA(const ordinal_t i) {
+          result(i) = i;
+          for (edge_t j = row_map(i); j < row_map(i + 1); j++) {
+            if (entries(j) == i) self(i) += values(j);
+          }
+        });
+    handle.num_levels      = 0;
+    handle.num_communities = n;
+    handle.modularity      = 0;
+    if (n == 0) return result;
+    const real_view_t k0 = strengths(g, self);
+    double m2            = 0;
+    Kokkos::parallel_reduce(
+        "louvain total strength", policy_t(0, n),
+        KOKKOS_LAMBDA(const ordinal_t i, double& update) { update += k0(i); },
+        m2);
+    if (m2 <= 0) return result;
+
+    coarse_level_triple level;
+    level.mtx   = g;
+    level.level = 1;
+    vtx_view_t vtx_wgts("vertex weights", n);
+    Kokkos::deep_copy(vtx_wgts, ordinal_t(1));
+    level.vtx_wgts        = vtx_wgts;
+    level.uniform_weights = false;
+    real_view_t level_self = self;
+    for (int lvl = 0; lvl < handle.max_levels; lvl++) {
+      const ordinal_t nl = level.mtx.numRows();
+      real_view_t k      = lvl == 0 ? k0 : strengths(level.mtx, level_self);
+      vtx_view_t comm("level communities", nl);
+      Kokkos::parallel_for(
+          "louvain singletons", policy_t(0, nl),
+          KOKKOS_LAMBDA(const ordinal_t i) { comm(i) = i; });
+      local_moves(handle, level.mtx, level_self, k, m2, comm);
+      const ordinal_t nc = relabel(comm);
+      handle.num_levels++;
+      // project the communities to the input vertices
+      Kokkos::parallel_for(
+          "louvain project", policy_t(0, n),
+          KOKKOS_LAMBDA(const ordinal_t i) { result(i) = comm(result(i)); });
+      handle.num_communities = nc;
+      if (nc == nl || nc == 1) break;
+      real_view_t coarse_self;
+      level      = aggregate(handle, level, level_self, comm, nc, coarse_self);
+      level_self = coarse_self;
+    }
+    handle.modularity = modularity(g, self, k0, result, m2);
+    return result;
+  }
+};
+
+}  // end namespace Experimental
+}  // end namespace KokkosGraph
+// exclude from Cuda builds without lambdas enabled
+#endif
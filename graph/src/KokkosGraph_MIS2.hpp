@@ -18,6 +18,8 @@
 #define _KOKKOSGRAPH_DISTANCE2_MIS_HPP
 
 #include "KokkosGraph_Distance2MIS_impl.hpp"
+#include <stdexcept>
+#include <type_traits>
 
 namespace KokkosGraph {
 
@@ -51,6 +53,42 @@ lno_view_t graph_d2_mis(const rowmap_t& rowmap, const colinds_t& colinds,
   throw std::invalid_argument("graph_d2_mis: invalid algorithm");
 }
 
+// Compute a distance-2 maximal independent set as above, preferring the
+// vertices with higher user-provided priorities (one per vertex, of any
+// arithmetic type). With MIS2_QUALITY, the priorities replace the vertex
+// degrees. With MIS2_FAST, they take precedence over the random priorities
+// of each round, which then only break ties.
+template <typename device_t, typename rowmap_t, typename colinds_t,
+          typename priorities_t,
+          typename lno_view_t = typename colinds_t::non_const_type,
+          typename = std::enable_if_t<Kokkos::is_view<priorities_t>::value>>
+lno_view_t graph_d2_mis(const rowmap_t& rowmap, const colinds_t& colinds,
+                        const priorities_t& priorities,
+                        MIS2_Algorithm algo = MIS2_FAST) {
+  if (rowmap.extent(0) <= 1) {
+    // zero vertices means the MIS is empty.
+    return lno_view_t();
+  }
+  if (priorities.extent(0) != rowmap.extent(0) - 1)
+    throw std::invalid_argument(
+        "graph_d2_mis: priorities must have one entry per vertex");
+  auto scores =
+      Impl::D2_MIS_PriorityScores<device_t, priorities_t>::compute(priorities);
+  switch (algo) {
+    case MIS2_QUALITY: {
+      Impl::D2_MIS_FixedPriority<device_t, rowmap_t, colinds_t, lno_view_t> mis(
+          rowmap, colinds, scores);
+      return mis.compute();
+    }
+    case MIS2_FAST: {
+      Impl::D2_MIS_RandomPriority<device_t, rowmap_t, colinds_t, lno_view_t>
+          mis(rowmap, colinds, scores);
+      return mis.compute();
+    }
+  }
+  throw std::invalid_argument("graph_d2_mis: invalid algorithm");
+}
+
 template <typename device_t, typename rowmap_t, typename colinds_t,
           typename labels_t = typename colinds_t::non_const_type>
 labels_t graph_mis2_coarsen(
@@ -85,6 +123,35 @@ labels_t graph_mis2_aggregate(
   return aggregation.labels;
 }
 
+// Aggregate as above, following strong couplings: only the entries with
+// weights(j) >= threshold are used as edges, where weights has one
+// strength-of-connection value per entry of colinds and must be symmetric.
+// The strong subgraph is not built explicitly, so this needs only one extra
+// bit per entry. Vertices with no strong edges become singleton aggregates.
+template <typename device_t, typename rowmap_t, typename colinds_t,
+          typename weights_t,
+          typename labels_t = typename colinds_t::non_const_type>
+labels_t graph_mis2_aggregate(
+    const rowmap_t& rowmap, const colinds_t& colinds, const weights_t& weights,
+    typename weights_t::non_const_value_type threshold,
+    typename colinds_t::non_const_value_type& numAggregates) {
+  if (rowmap.extent(0) <= 1) {
+    // there are no vertices to label
+    numAggregates = 0;
+    return labels_t();
+  }
+  if (weights.extent(0) != colinds.extent(0))
+    throw std::invalid_argument(
+        "graph_mis2_aggregate: weights must have one entry per column index");
+  using aggregation_t =
+      Impl::D2_MIS_Aggregation<device_t, rowmap_t, colinds_t, labels_t>;
+  aggregation_t aggregation(
+      rowmap, colinds, aggregation_t::findStrongEdges(weights, threshold));
+  aggregation.compute(true);
+  numAggregates = aggregation.numAggs;
+  return aggregation.labels;
+}
+
 inline const char* mis2_algorithm_name(MIS2_Algorithm algo) {
   switch (algo) {
     case MIS2_QUALITY: return "MIS2_QUALITY";
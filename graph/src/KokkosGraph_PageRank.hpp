@@ -0,0 +1,109 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef _KOKKOSGRAPH_PAGERANK_HPP
+#define _KOKKOSGRAPH_PAGERANK_HPP
+
+#include "KokkosGraph_PageRank_impl.hpp"
+
+namespace KokkosGraph {
+
+// Compute the PageRank of every vertex of a directed CRS graph, with an edge
+// u -> v for each entry v in row u, on device_t's execution space. The rank
+// of the vertices with no out edges is redistributed uniformly. Iterates
+// until the L1 change of the ranks is below tol, or maxIters sweeps, and
+// returns the number of sweeps. If isSymmetric, the graph is not transposed.
+//
+// All column indices must be < num_verts. scores must have one entry per
+// vertex, and sums to 1 on return.
+template <typename device_t, typename rowmap_t, typename entries_t,
+          typename scores_t>
+int pagerank(const rowmap_t& rowmap, const entries_t& entries,
+             const scores_t& scores,
+             typename scores_t::non_const_value_type damping = 0.85,
+             typename scores_t::non_const_value_type tol     = 1e-8,
+             int maxIters = 100, bool isSymmetric = false) {
+  using scalar_t = typename scores_t::non_const_value_type;
+  using pr_t     = Impl::PageRank<device_t, rowmap_t, entries_t, scalar_t>;
+  if (rowmap.extent(0) <= 1) {
+    // there are no vertices
+    return 0;
+  }
+  if (scores.extent(0) != rowmap.extent(0) - 1)
+    throw std::invalid_argument(
+        "pagerank: scores must have one entry per vertex");
+  if (!(damping >= 0 && damping < 1))
+    throw std::invalid_argument("pagerank: damping must be in [0, 1)");
+  pr_t pr(rowmap, entries, isSymmetric, damping, tol, maxIters);
+  typename pr_t::ranks_t ranks("PageRank ranks", scores.extent(0), 1);
+  int iters = pr.compute(typename pr_t::ranks_t(), ranks);
+  Kokkos::deep_copy(scores, Kokkos::subview(ranks, Kokkos::ALL(), 0));
+  return iters;
+}
+
+// Compute a batch of personalized PageRanks: column c of scores is the
+// PageRank with teleportation (and redistribution of the rank of dangling
+// vertices) to the distribution of column c of seeds, a nonnegative vector
+// with a positive sum that doesn't need to be normalized. Up to 64 columns
+// are computed in the same sweeps. Returns the largest number of sweeps.
+//
+// Otherwise, this is the same as pagerank above. seeds and scores must be
+// num_verts x num_queries.
+template <typename device_t, typename rowmap_t, typename entries_t,
+          typename seeds_t, typename scores_t>
+int personalized_pagerank(
+    const rowmap_t& rowmap, const entries_t& entries, const seeds_t& seeds,
+    const scores_t& scores,
+    typename scores_t::non_const_value_type damping = 0.85,
+    typename scores_t::non_const_value_type tol     = 1e-8,
+    int maxIters = 100, bool isSymmetric = false) {
+  using scalar_t = typename scores_t::non_const_value_type;
+  using pr_t     = Impl::PageRank<device_t, rowmap_t, entries_t, scalar_t>;
+  if (rowmap.extent(0) <= 1 || seeds.extent(1) == 0) {
+    // there are no vertices or no queries
+    return 0;
+  }
+  size_t numVerts = rowmap.extent(0) - 1;
+  if (seeds.extent(0) != numVerts || scores.extent(0) != numVerts ||
+      scores.extent(1) != seeds.extent(1))
+    throw std::invalid_argument(
+        "personalized_pagerank: seeds and scores must be num_verts x "
+        "num_queries");
+  if (!(damping >= 0 && damping < 1))
+    throw std::invalid_argument(
+        "personalized_pagerank: damping must be in [0, 1)");
+  pr_t pr(rowmap, entries, isSymmetric, damping, tol, maxIters);
+  int maxSweeps = 0;
+  for (size_t begin = 0; begin < seeds.extent(1); begin += pr_t::maxBatch) {
+    size_t end = std::min<size_t>(begin + pr_t::maxBatch, seeds.extent(1));
+    auto batch = Kokkos::make_pair(begin, end);
+    typename pr_t::ranks_t teleport(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "PageRank teleport"),
+        numVerts, end - begin);
+    typename pr_t::ranks_t ranks(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "PageRank ranks"),
+        numVerts, end - begin);
+    Kokkos::deep_copy(teleport, Kokkos::subview(seeds, Kokkos::ALL(), batch));
+    pr.normalizeTeleport(teleport);
+    maxSweeps = std::max(maxSweeps, pr.compute(teleport, ranks));
+    Kokkos::deep_copy(Kokkos::subview(scores, Kokkos::ALL(), batch), ranks);
+  }
+  return maxSweeps;
+}
+
+}  // namespace KokkosGraph
+
+#endif
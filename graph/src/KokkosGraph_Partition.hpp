@@ -0,0 +1,442 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#pragma once
+// exclude from Cuda builds without lambdas enabled
+#if !defined(KOKKOS_ENABLE_CUDA) || defined(KOKKOS_ENABLE_CUDA_LAMBDA)
+#include <algorithm>
+#include <list>
+#include <queue>
+#include <stdexcept>
+#include <vector>
+#include <Kokkos_Core.hpp>
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosGraph_CoarsenConstruct.hpp"
+
+namespace KokkosGraph {
+
+namespace Experimental {
+
+// Multilevel k-way graph partitioner:
+// the graph is coarsened with coarse_builder, the coarsest graph is split
+// into k parts of equal weight along a BFS order (host), and on the way back
+// up each level is rebalanced and refined in parallel. The refinement is a
+// label propagation with the Jet afterburner (Gilbert, Madduri, Boman and
+// Rajamanickam): each vertex picks the adjacent part it has the most
+// connections to, then a move is kept only if its gain is still positive
+// assuming all neighbors with a better gain moved first.
+//
+// The input matrix is the symmetric adjacency of the graph (self loops are
+// ignored); its values are the edge weights. Vertices have unit weight.
+//
+// this class is not meant to be instantiated
+// think of it like a templated namespace
+template <class crsMat>
+class partitioner {
+ public:
+  // define internal types
+  using matrix_t    = crsMat;
+  using exec_space  = typename matrix_t::execution_space;
+  using Device      = typename matrix_t::device_type;
+  using ordinal_t   = typename matrix_t::ordinal_type;
+  using edge_t      = typename matrix_t::size_type;
+  using scalar_t    = typename matrix_t::value_type;
+  using vtx_view_t  = Kokkos::View<ordinal_t*, Device>;
+  using wgt_view_t  = Kokkos::View<scalar_t*, Device>;
+  using policy_t    = Kokkos::RangePolicy<exec_space>;
+  using coarsener_t = coarse_builder<crsMat>;
+
+  using coarse_level_triple = typename coarsener_t::coarse_level_triple;
+
+  static_assert(std::is_signed<ordinal_t>::value,
+                "KokkosGraph::partitioner: the ordinal type must be signed");
+
+  // number of distinct adjacent parts a vertex considers as destinations
+  static constexpr int max_local_parts = 64;
+
+  struct partition_handle {
+    // coarsening parameters (coarse_vtx_cutoff is raised to 8 vertices per
+    // part)
+    typename coarsener_t::coarsen_handle coarsen;
+    ordinal_t num_parts = 2;
+    // allowed imbalance: a part weighs at most (1 + imbalance) * total / k
+    double imbalance = 0.03;
+    // maximum number of refinement iterations per level
+    int max_refine_iters = 50;
+    // stop refining a level after this many iterations without improvement
+    int max_stagnant_iters = 4;
+    // results: the edge cut and heaviest part of the final partition
+    scalar_t edge_cut         = 0;
+    ordinal_t max_part_weight = 0;
+  };
+
+  // sum of the weights of the edges between parts
+  static scalar_t edge_cut(const matrix_t g, const vtx_view_t parts) {
+    auto row_map = g.graph.row_map;
+    auto entries = g.graph.entries;
+    auto values  = g.values;
+    scalar_t cut = 0;
+    Kokkos::parallel_reduce(
+        "partition edge cut", policy_t(0, g.numRows()),
+        KOKKOS_LAMBDA(const ordinal_t i, scalar_t& update) {
+          for (edge_t j = row_map(i); j < row_map(i + 1); j++) {
+            if (parts(entries(j)) != parts(i)) update += values(j);
+          }
+        },
+        cut);
+    // each cut edge is seen from both ends
+    return cut / 2;
+  }
+
+  static vtx_view_t part_weights(const vtx_view_t parts,
+                                 const vtx_view_t vtx_wgts,
+                                 const ordinal_t num_parts) {
+    vtx_view_t weights("part weights", num_parts);
+    Kokkos::parallel_for(
+        "compute part weights", policy_t(0, parts.extent(0)),
+        KOKKOS_LAMBDA(const ordinal_t i) {
+          Kokkos::atomic_add(&weights(parts(i)), vtx_wgts(i));
+        });
+    return weights;
+  }
+
+  static ordinal_t max_weight(const vtx_view_t weights) {
+    ordinal_t max_w = 0;
+    Kokkos::parallel_reduce(
+        "find max part weight", policy_t(0, weights.extent(0)),
+        KOKKOS_LAMBDA(const ordinal_t p, ordinal_t& l_max) {
+          if (l_max < weights(p)) l_max = weights(p);
+        },
+        Kokkos::Max<ordinal_t, Kokkos::HostSpace>(max_w));
+    return max_w;
+  }
+
+  // initial partition of the coarsest graph, on host: the vertices (in BFS
+  // order from a pseudo-peripheral vertex of each connected component) are
+  // split in k consecutive ranges of equal weight
+  static vtx_view_t initial_partition(const coarse_level_triple level,
+                                      const ordinal_t num_parts) {
+    const matrix_t g  = level.mtx;
+    const ordinal_t n = g.numRows();
+    auto row_map      = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                       g.graph.row_map);
+    auto entries      = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                       g.graph.entries);
+    auto vtx_wgts     = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                        level.vtx_wgts);
+
+    std::vector<ordinal_t> order;
+    order.reserve(n);
+    std::vector<char> visited(n, 0);
+    std::vector<char> scratch(n, 0);
+    auto bfs = [&](ordinal_t root, std::vector<char>& mark,
+                   std::vector<ordinal_t>& out) {
+      std::queue<ordinal_t> q;
+      q.push(root);
+      mark[root] = 1;
+      while (!q.empty()) {
+        ordinal_t v = q.front();
+        q.pop();
+        out.push_back(v);
+        for (edge_t j = row_map(v); j < row_map(v + 1); j++) {
+          ordinal_t u = entries(j);
+          if (!mark[u]) {
+            mark[u] = 1;
+            q.push(u);
+          }
+        }
+      }
+    };
+    for (ordinal_t v = 0; v < n; v++) {
+      if (visited[v]) continue;
+      // the last vertex reached from v is the start of the real BFS
+      std::vector<ordinal_t> component;
+      bfs(v, scratch, component);
+      bfs(component.back(), visited, order);
+    }
+
+    double total = 0;
+    for (ordinal_t i = 0; i < n; i++) total += vtx_wgts(i);
+    vtx_view_t parts("parts", n);
+    auto h_parts  = Kokkos::create_mirror_view(parts);
+    double before = 0;
+    for (ordinal_t v : order) {
+      // the part of the middle of the vertex in the weight range
+      ordinal_t p = static_cast<ordinal_t>((before + 0.5 * vtx_wgts(v)) *
+                                           num_parts / total);
+      h_parts(v) = std::min(p, num_parts - 1);
+      before += vtx_wgts(v);
+    }
+    Kokkos::deep_copy(parts, h_parts);
+    return parts;
+  }
+
+  // move vertices out of the parts heavier than cap, preferably to the
+  // adjacent part with the most connections having room
+  static void rebalance(const coarse_level_triple level, vtx_view_t parts,
+                        const ordinal_t num_parts, const ordinal_t cap) {
+    const matrix_t g  = level.mtx;
+    const ordinal_t n = g.numRows();
+    auto row_map      = g.graph.row_map;
+    auto entries      = g.graph.entries;
+    auto values       = g.values;
+    auto vtx_wgts     = level.vtx_wgts;
+    vtx_view_t new_parts("rebalanced parts", n);
+    vtx_view_t excess("part excess weights", num_parts);
+    for (int iter = 0; iter < 20; iter++) {
+      vtx_view_t weights = part_weights(parts, vtx_wgts, num_parts);
+      if (max_weight(weights) <= cap) return;
+      Kokkos::parallel_for(
+          "init part excess", policy_t(0, num_parts),
+          KOKKOS_LAMBDA(const ordinal_t p) {
+            excess(p) = weights(p) > cap ? weights(p) - cap : 0;
+          });
+      ordinal_t moved = 0;
+      Kokkos::parallel_reduce(
+          "rebalance parts", policy_t(0, n),
+          KOKKOS_LAMBDA(const ordinal_t i, ordinal_t& l_moved) {
+            const ordinal_t p = parts(i);
+            const ordinal_t w = vtx_wgts(i);
+            new_parts(i)      = p;
+            if (excess(p) <= 0) return;
+            if (Kokkos::atomic_fetch_sub(&excess(p), w) <= 0) {
+              Kokkos::atomic_add(&excess(p), w);
+              return;
+            }
+            // connections to the adjacent parts
+            ordinal_t local_p[max_local_parts];
+            scalar_t local_c[max_local_parts];
+            int nl = 0;
+            for (edge_t j = row_map(i); j < row_map(i + 1); j++) {
+              if (entries(j) == i) continue;
+              const ordinal_t q = parts(entries(j));
+              if (q == p) continue;
+              int l = 0;
+              while (l < nl && local_p[l] != q) l++;
+              if (l < nl) {
+                local_c[l] += values(j);
+              } else if (nl < max_local_parts) {
+                local_p[nl] = q;
+                local_c[nl] = values(j);
+                nl++;
+              }
+            }
+            // most connected first
+            for (int a = 0; a < nl; a++) {
+              int best = a;
+              for (int b = a + 1; b < nl; b++)
+                if (local_c[b] > local_c[best]) best = b;
+              const ordinal_t q = local_p[best];
+              local_p[best]     = local_p[a];
+              local_c[best]     = local_c[a];
+              if (Kokkos::atomic_fetch_add(&weights(q), w) + w <= cap) {
+                new_parts(i) = q;
+                l_moved++;
+                return;
+              }
+              Kokkos::atomic_sub(&weights(q), w);
+            }
+            // then any part with room
+            for (ordinal_t k = 1; k < num_parts; k++) {
+              const ordinal_t q = (p + k) % num_parts;
+              if (weights(q) + w > cap) continue;
+              if (Kokkos::atomic_fetch_add(&weights(q), w) + w <= cap) {
+                new_parts(i) = q;
+                l_moved++;
+                return;
+              }
+              Kokkos::atomic_sub(&weights(q), w);
+            }
+            Kokkos::atomic_add(&excess(p), w);
+          },
+          moved);
+      Kokkos::deep_copy(parts, new_parts);
+      if (moved == 0) return;
+    }
+  }
+
+  // label propagation refinement with the Jet afterburner, keeping the parts
+  // at most cap heavy; parts is kept at the best partition found
+  static void refine(const partition_handle& handle,
+                     const coarse_level_triple level, vtx_view_t parts,
+                     const ordinal_t cap) {
+    const matrix_t g          = level.mtx;
+    const ordinal_t n         = g.numRows();
+    const ordinal_t num_parts = handle.num_parts;
+    auto row_map              = g.graph.row_map;
+    auto entries              = g.graph.entries;
+    auto values               = g.values;
+    auto vtx_wgts             = level.vtx_wgts;
+    vtx_view_t dest("destination parts", n);
+    wgt_view_t gain("move gains", n);
+    vtx_view_t new_parts("refined parts", n);
+    vtx_view_t best_parts("best parts", n);
+    Kokkos::deep_copy(best_parts, parts);
+    vtx_view_t weights  = part_weights(parts, vtx_wgts, num_parts);
+    const bool balanced = max_weight(weights) <= cap;
+    scalar_t best_cut   = edge_cut(g, parts);
+    int stagnant        = 0;
+    for (int iter = 0; iter < handle.max_refine_iters; iter++) {
+      // each vertex picks its most connected adjacent part
+      Kokkos::parallel_for(
+          "pick destination parts", policy_t(0, n),
+          KOKKOS_LAMBDA(const ordinal_t i) {
+            const ordinal_t p = parts(i);
+            ordinal_t local_p[max_local_parts];
+            scalar_t local_c[max_local_parts];
+            int nl       = 0;
+            scalar_t own = 0;
+            for (edge_t j = row_map(i); j < row_map(i + 1); j++) {
+              if (entries(j) == i) continue;
+              const ordinal_t q = parts(entries(j));
+              if (q == p) {
+                own += values(j);
+                continue;
+              }
+              int l = 0;
+              while (l < nl && local_p[l] != q) l++;
+              if (l < nl) {
+                local_c[l] += values(j);
+              } else if (nl < max_local_parts) {
+                local_p[nl] = q;
+                local_c[nl] = values(j);
+                nl++;
+              }
+            }
+            ordinal_t best_p = p;
+            scalar_t best_c  = own;
+            for (int l = 0; l < nl; l++) {
+              if (local_c[l] > best_c) {
+                best_p = local_p[l];
+                best_c = local_c[l];
+              }
+            }
+            dest(i) = best_p;
+            gain(i) = best_c - own;
+          });
+      // afterburner: recompute the gain assuming the neighbors with a better
+      // gain (ties broken by index) moved, then move if there is room
+      ordinal_t moved = 0;
+      Kokkos::parallel_reduce(
+          "afterburner", policy_t(0, n),
+          KOKKOS_LAMBDA(const ordinal_t i, ordinal_t& l_moved) {
+            const ordinal_t p = parts(i);
+            const ordinal_t d = dest(i);
+            new_parts(i)      = p;
+            if (d == p) return;
+            const scalar_t my_gain = gain(i);
+            scalar_t own = 0, to = 0;
+            for (edge_t j = row_map(i); j < row_map(i + 1); j++) {
+              const ordinal_t u = entries(j);
+              if (u == i) continue;
+              ordinal_t q = parts(u);
+              if (dest(u) != q &&
+                  (gain(u) > my_gain || (gain(u) == my_gain && u < i)))
+                q = dest(u);
+              if (q == p)
+                own += values(j);
+              else if (q == d)
+                to += values(j);
+            }
+            if (to <= own) return;
+            const ordinal_t w = vtx_wgts(i);
+            if (Kokkos::atomic_fetch_add(&weights(d), w) + w > cap) {
+              Kokkos::atomic_sub(&weights(d), w);
+              return;
+            }
+            Kokkos::atomic_sub(&weights(p), w);
+            new_parts(i) = d;
+            l_moved++;
+          },
+          moved);
+      Kokkos::deep_copy(parts, new_parts);
+      if (moved == 0) break;
+      const scalar_t cut = edge_cut(g, parts);
+      if (cut < best_cut) {
+        best_cut = cut;
+        Kokkos::deep_copy(best_parts, parts);
+        stagnant = 0;
+      } else if (++stagnant >= handle.max_stagnant_iters) {
+        break;
+      }
+    }
+    // an unbalanced input keeps its last state, which is not heavier
+    if (balanced) Kokkos::deep_copy(parts, best_parts);
+  }
+
+  // partition the graph g into handle.num_parts parts; returns the part of
+  // each vertex, and sets handle.edge_cut and handle.max_part_weight
+  static vtx_view_t partition(partition_handle& handle, const matrix_t g) {
+    const ordinal_t num_parts = handle.num_parts;
+    if (num_parts < 1) {
+      throw std::invalid_argument(
+          "KokkosGraph::partitioner: num_parts must be at least 1");
+    }
+    if (g.numRows() != g.numCols()) {
+      throw std::invalid_argument(
+          "KokkosGraph::partitioner: the adjacency matrix must be square");
+    }
+    const ordinal_t n = g.numRows();
+    if (num_parts == 1 || n == 0) {
+      vtx_view_t parts("parts", n);
+      handle.edge_cut        = 0;
+      handle.max_part_weight = n;
+      return parts;
+    }
+
+    typename coarsener_t::coarsen_handle& ch = handle.coarsen;
+    ch.coarse_vtx_cutoff =
+        std::max<ordinal_t>(ch.coarse_vtx_cutoff, 8 * num_parts);
+    ch.min_allowed_vtx = std::max<ordinal_t>(ch.min_allowed_vtx, num_parts);
+    coarsener_t::generate_coarse_graphs(ch, g, false);
+    std::list<coarse_level_triple>& levels = ch.results;
+
+    // unit vertex weights, so the total weight is n at every level
+    const ordinal_t cap = std::max<ordinal_t>(
+        (n + num_parts - 1) / num_parts,
+        static_cast<ordinal_t>((1 + handle.imbalance) * n / num_parts));
+
+    auto level       = levels.rbegin();
+    vtx_view_t parts = initial_partition(*level, num_parts);
+    while (true) {
+      rebalance(*level, parts, num_parts, cap);
+      refine(handle, *level, parts, cap);
+      auto coarse = level;
+      level++;
+      if (level == levels.rend()) break;
+      // project the partition to the finer level
+      vtx_view_t fine_parts("parts", level->mtx.numRows());
+      vtx_view_t coarse_parts = parts;
+      auto vcmap              = coarse->interp_mtx.graph.entries;
+      Kokkos::parallel_for(
+          "project partition", policy_t(0, fine_parts.extent(0)),
+          KOKKOS_LAMBDA(const ordinal_t i) {
+            fine_parts(i) = coarse_parts(vcmap(i));
+          });
+      parts = fine_parts;
+    }
+
+    handle.edge_cut = edge_cut(g, parts);
+    handle.max_part_weight =
+        max_weight(part_weights(parts, levels.begin()->vtx_wgts, num_parts));
+    return parts;
+  }
+};
+
+}  // end namespace Experimental
+}  // end namespace KokkosGraph
+// exclude from Cuda builds without lambdas enabled
+#endif
@@ -0,0 +1,101 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef _KOKKOSGRAPH_REORDER_HPP
+#define _KOKKOSGRAPH_REORDER_HPP
+
+#include <list>
+#include "KokkosGraph_Reorder_impl.hpp"
+#include "KokkosGraph_RCM.hpp"
+// exclude the community ordering from Cuda builds without lambdas enabled
+#if !defined(KOKKOS_ENABLE_CUDA) || defined(KOKKOS_ENABLE_CUDA_LAMBDA)
+#include "KokkosGraph_CoarsenConstruct.hpp"
+#endif
+
+namespace KokkosGraph {
+namespace Experimental {
+
+// Vertex orderings for locality, alongside graph_rcm. Each returns the labels
+// of the vertices: labels(v) is the new index of vertex v, so that the
+// reordered matrix is KokkosSparse::permute_crs_matrix(A, labels).
+
+// Order the vertices by decreasing degree, and by ID for equal degrees.
+// It runs on device_t's execution space.
+template <typename device_t, typename rowmap_t, typename colinds_t,
+          typename labels_t = typename colinds_t::non_const_type>
+labels_t graph_degree_order(const rowmap_t& rowmap,
+                            const colinds_t& /* colinds */) {
+  if (rowmap.extent(0) <= 1) return labels_t("Degree order labels", 0);
+  return Impl::KeyOrder<device_t, rowmap_t, labels_t>::degree_order(rowmap,
+                                                                    true);
+}
+
+// Hub clustering: the hubs (the vertices of degree greater than the average)
+// come first, by decreasing degree, followed by the other vertices in their
+// original order, so that the rest of the graph keeps its locality.
+// It runs on device_t's execution space.
+template <typename device_t, typename rowmap_t, typename colinds_t,
+          typename labels_t = typename colinds_t::non_const_type>
+labels_t graph_hub_cluster_order(const rowmap_t& rowmap,
+                                 const colinds_t& /* colinds */) {
+  if (rowmap.extent(0) <= 1) return labels_t("Hub cluster labels", 0);
+  return Impl::KeyOrder<device_t, rowmap_t, labels_t>::degree_order(rowmap,
+                                                                    false);
+}
+
+#if !defined(KOKKOS_ENABLE_CUDA) || defined(KOKKOS_ENABLE_CUDA_LAMBDA)
+// Community ordering, in the spirit of Rabbit order (Arai et al.): the
+// communities are the aggregates of the multilevel coarsening of
+// coarse_builder (heavy edge coarsening by default), which form a dendrogram,
+// and the vertices are numbered so that every aggregate, at every level, gets
+// consecutive labels. The coarsest graph is ordered by reverse Cuthill-McKee,
+// so that neighboring communities also get nearby labels.
+//
+// The input matrix is the symmetric adjacency of the graph; its values are
+// the edge weights.
+template <typename crsMat,
+          typename labels_t = Kokkos::View<typename crsMat::ordinal_type*,
+                                           typename crsMat::device_type>>
+labels_t graph_community_order(
+    const crsMat& A,
+    typename coarse_builder<crsMat>::coarsen_handle handle = {}) {
+  using coarsener_t = coarse_builder<crsMat>;
+  using device_t    = typename crsMat::device_type;
+  using rowmap_t    = typename crsMat::row_map_type;
+  using entries_t   = typename crsMat::index_type;
+  using order_t     = Impl::KeyOrder<device_t, rowmap_t, labels_t>;
+  using level_t     = typename coarsener_t::coarse_level_triple;
+  if (A.numRows() != A.numCols())
+    throw std::invalid_argument(
+        "graph_community_order: the matrix must be square");
+  if (A.numRows() <= 1) return labels_t("Community order labels", A.numRows());
+  coarsener_t::generate_coarse_graphs(handle, A, false);
+  std::list<level_t>& levels = handle.results;
+  auto level                 = levels.rbegin();
+  labels_t labels = graph_rcm<device_t, rowmap_t, entries_t, labels_t>(
+      level->mtx.graph.row_map, level->mtx.graph.entries);
+  // descend the dendrogram: each level is ordered by its parents' labels
+  for (auto coarse = level++; level != levels.rend(); coarse = level++) {
+    labels = order_t::nested_order(coarse->interp_mtx.graph.entries, labels);
+  }
+  return labels;
+}
+#endif
+
+}  // namespace Experimental
+}  // namespace KokkosGraph
+
+#endif
@@ -0,0 +1,97 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef _KOKKOSGRAPH_SSSP_HPP
+#define _KOKKOSGRAPH_SSSP_HPP
+
+#include <algorithm>
+#include <stdexcept>
+#include "KokkosGraph_SSSP_impl.hpp"
+
+namespace KokkosGraph {
+namespace Experimental {
+
+// Single-source shortest paths in a graph with nonnegative edge weights, on
+// device_t's execution space. weights(j) is the length of the edge
+// colinds(j). This function returns the distance from source to each vertex
+// (the length of a shortest path), or the largest value of the weight type
+// for the vertices not reachable from source.
+//
+// The algorithm is delta-stepping: the vertices are settled in buckets of
+// distances of width delta, each by a sequence of parallel relaxations of
+// the edges out of the bucket's frontier. A small delta does less redundant
+// work but needs more steps; delta = 0 picks the largest weight divided by
+// the average degree. A delta larger than any distance is the parallel
+// Bellman-Ford algorithm.
+template <typename device_t, typename rowmap_t, typename colinds_t,
+          typename weights_t,
+          typename distances_t = Kokkos::View<
+              typename weights_t::non_const_value_type*, device_t>>
+distances_t graph_sssp(
+    const rowmap_t& rowmap, const colinds_t& colinds, const weights_t& weights,
+    const typename colinds_t::non_const_value_type source,
+    typename weights_t::non_const_value_type delta = 0) {
+  using exec_space = typename device_t::execution_space;
+  using lno_t      = typename colinds_t::non_const_value_type;
+  using weight_t   = typename weights_t::non_const_value_type;
+  lno_t numVerts   = rowmap.extent(0);
+  if (numVerts) numVerts--;
+  if (source < 0 || source >= numVerts) {
+    throw std::invalid_argument("graph_sssp: source is not a vertex");
+  }
+  if (weights.extent(0) != colinds.extent(0)) {
+    throw std::invalid_argument(
+        "graph_sssp: weights and colinds have different lengths");
+  }
+  if (delta < 0) {
+    throw std::invalid_argument("graph_sssp: delta is negative");
+  }
+  Kokkos::MinMaxScalar<weight_t> range;
+  Kokkos::parallel_reduce(
+      "KokkosGraph::SSSP::weight_range",
+      Kokkos::RangePolicy<exec_space>(0, weights.extent(0)),
+      Impl::WeightRangeFunctor<weights_t>{weights},
+      Kokkos::MinMax<weight_t>(range));
+  if (weights.extent(0) && range.min_val < 0) {
+    throw std::invalid_argument("graph_sssp: an edge weight is negative");
+  }
+  if (delta == 0) {
+    if (weights.extent(0)) {
+      const double avgDegree = double(weights.extent(0)) / numVerts;
+      delta = static_cast<weight_t>(range.max_val / std::max(avgDegree, 1.0));
+    }
+    if (delta <= 0) delta = 1;
+  }
+  Impl::DeltaSteppingSSSP<exec_space, rowmap_t, colinds_t, weights_t,
+                          distances_t>
+      algo(rowmap, colinds, weights, delta);
+  return algo.sssp(source);
+}
+
+// graph_sssp on the graph of a CrsMatrix, with its values as the weights
+template <typename crsMat_t>
+Kokkos::View<typename crsMat_t::non_const_value_type*,
+             typename crsMat_t::device_type>
+graph_sssp(const crsMat_t& A,
+           const typename crsMat_t::non_const_ordinal_type source,
+           typename crsMat_t::non_const_value_type delta = 0) {
+  return graph_sssp<typename crsMat_t::device_type>(
+      A.graph.row_map, A.graph.entries, A.values, source, delta);
+}
+
+}  // namespace Experimental
+}  // namespace KokkosGraph
+
+#endif
@@ -18,6 +18,8 @@
 #include "KokkosSparse_spgemm_impl.hpp"
 #include "KokkosKernels_IOUtils.hpp"
 #include "KokkosKernels_Handle.hpp"
+#include "KokkosGraph_TriangleUpdate_impl.hpp"
+#include "KokkosGraph_TriangleVisit_impl.hpp"
 namespace KokkosGraph {
 
 namespace Experimental {
@@ -459,6 +461,75 @@ void triangle_generic(KernelHandle *handle, typename KernelHandle::nnz_lno_t m,
   }
 }
 
+// Per-vertex triangle counts of a symmetric graph without self loops, with
+// sorted rows: counts(i) is the number of triangles through vertex i, and
+// numTriangles the total number of triangles. These are the counts that
+// triangle_count_update keeps up to date.
+template <typename device_t, typename rowmap_t, typename entries_t,
+          typename counts_t>
+void triangle_count_vertices(const rowmap_t& rowmap, const entries_t& entries,
+                             const counts_t& counts,
+                             typename counts_t::non_const_value_type&
+                                 numTriangles) {
+  using Updater =
+      KokkosGraph::Impl::TriangleUpdate<device_t, rowmap_t, entries_t,
+                                        counts_t>;
+  numTriangles = Updater::count(rowmap, entries, counts);
+}
+
+// Applies a batch of edge updates to a symmetric graph without self loops,
+// with sorted rows, and updates the triangle counts of
+// triangle_count_vertices. The undirected edges (deleteSrc(i), deleteDst(i))
+// are deleted first, then the edges (insertSrc(i), insertDst(i)) inserted;
+// self loops, duplicates, deletions of missing edges and insertions of
+// existing edges are ignored. The graph after the updates is returned in
+// (newRowmap, newEntries), again with sorted rows.
+//
+// Only the rows of the endpoints of the updated edges are intersected, so the
+// cost is proportional to the batch and the degrees of its endpoints, plus a
+// copy of the graph.
+template <typename device_t, typename rowmap_t, typename entries_t,
+          typename edges_t, typename counts_t>
+void triangle_count_update(
+    const rowmap_t& rowmap, const entries_t& entries,
+    const edges_t& insertSrc, const edges_t& insertDst,
+    const edges_t& deleteSrc, const edges_t& deleteDst,
+    typename rowmap_t::non_const_type& newRowmap,
+    typename entries_t::non_const_type& newEntries, const counts_t& counts,
+    typename counts_t::non_const_value_type& numTriangles) {
+  using Updater =
+      KokkosGraph::Impl::TriangleUpdate<device_t, rowmap_t, entries_t,
+                                        counts_t>;
+  Updater::update(rowmap, entries, insertSrc, insertDst, deleteSrc, deleteDst,
+                  newRowmap, newEntries, counts, numTriangles);
+}
+
+// Streams the triangles of a symmetric graph with sorted rows to a device
+// functor instead of materializing them like triangle_enumerate: visitor(u,
+// v, w) is called once per triangle, with u < v < w, from a parallel kernel,
+// so it must be thread safe (atomic updates of per-vertex aggregates, for
+// instance). Self loops are ignored. Returns the number of triangles.
+template <typename device_t, typename rowmap_t, typename entries_t,
+          typename visitor_t>
+int64_t triangle_visit(const rowmap_t& rowmap, const entries_t& entries,
+                       const visitor_t& visitor) {
+  return KokkosGraph::Impl::TriangleVisit<device_t, rowmap_t, entries_t,
+                                          visitor_t>::triangles(rowmap,
+                                                                entries,
+                                                                visitor);
+}
+
+// Like triangle_visit, but visitor(u, v, c) is called once per edge, with
+// u < v and c the number of triangles through the edge (possibly 0).
+template <typename device_t, typename rowmap_t, typename entries_t,
+          typename visitor_t>
+int64_t triangle_visit_edges(const rowmap_t& rowmap, const entries_t& entries,
+                             const visitor_t& visitor) {
+  return KokkosGraph::Impl::TriangleVisit<device_t, rowmap_t, entries_t,
+                                          visitor_t>::edges(rowmap, entries,
+                                                            visitor);
+}
+
 }  // namespace Experimental
 }  // namespace KokkosGraph
 #endif
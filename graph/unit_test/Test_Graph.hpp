@@ -19,10 +19,21 @@
 #include "Test_Graph_graph_color_deterministic.hpp"
 #include "Test_Graph_graph_color_distance2.hpp"
 #include "Test_Graph_graph_color.hpp"
+#include "Test_Graph_graph_color_update.hpp"
 #include "Test_Graph_mis2.hpp"
 #if !defined(KOKKOS_ENABLE_CUDA) || defined(KOKKOS_ENABLE_CUDA_LAMBDA)
 #include "Test_Graph_coarsen.hpp"
+#include "Test_Graph_partition.hpp"
+#include "Test_Graph_louvain.hpp"
+#include "Test_Graph_triangle_update.hpp"
+#include "Test_Graph_triangle_visit.hpp"
 #endif
 #include "Test_Graph_rcm.hpp"
+#include "Test_Graph_bfs.hpp"
+#include "Test_Graph_sssp.hpp"
+#include "Test_Graph_connected_components.hpp"
+#include "Test_Graph_kcore.hpp"
+#include "Test_Graph_pagerank.hpp"
+#include "Test_Graph_reorder.hpp"
 
 #endif  // TEST_GRAPH_HPP
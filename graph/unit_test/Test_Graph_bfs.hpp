@@ -0,0 +1,157 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+
+#include "KokkosGraph_BFS.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+
+#include <queue>
+#include <vector>
+
+// Graph of the 3D 7-pt stencil on a gridX x gridY x gridZ grid, followed by
+// numIsolated vertices without edges
+template <typename rowmap_t, typename entries_t>
+void bfs_grid_graph(rowmap_t& rowmapView, entries_t& entriesView, int gridX,
+                    int gridY, int gridZ, int numIsolated) {
+  using size_type  = typename rowmap_t::non_const_value_type;
+  using lno_t      = typename entries_t::non_const_value_type;
+  auto getVertexID = [=](lno_t x, lno_t y, lno_t z) -> lno_t {
+    return x + y * gridX + z * gridX * gridY;
+  };
+  lno_t numGrid     = gridX * gridY * gridZ;
+  lno_t numVertices = numGrid + numIsolated;
+  std::vector<size_type> rowmap(numVertices + 1, 0);
+  std::vector<lno_t> entries;
+  for (lno_t k = 0; k < gridZ; k++) {
+    for (lno_t j = 0; j < gridY; j++) {
+      for (lno_t i = 0; i < gridX; i++) {
+        lno_t v = getVertexID(i, j, k);
+        if (i != 0) entries.push_back(getVertexID(i - 1, j, k));
+        if (i != gridX - 1) entries.push_back(getVertexID(i + 1, j, k));
+        if (j != 0) entries.push_back(getVertexID(i, j - 1, k));
+        if (j != gridY - 1) entries.push_back(getVertexID(i, j + 1, k));
+        if (k != 0) entries.push_back(getVertexID(i, j, k - 1));
+        if (k != gridZ - 1) entries.push_back(getVertexID(i, j, k + 1));
+        rowmap[v + 1] = entries.size();
+      }
+    }
+  }
+  for (lno_t v = numGrid; v < numVertices; v++) rowmap[v + 1] = rowmap[v];
+  rowmapView =
+      rowmap_t(Kokkos::view_alloc(Kokkos::WithoutInitializing, "Rowmap"),
+               numVertices + 1);
+  entriesView = entries_t(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "Colinds"),
+      entries.size());
+  auto rowmapHost  = Kokkos::create_mirror_view(rowmapView);
+  auto entriesHost = Kokkos::create_mirror_view(entriesView);
+  for (lno_t v = 0; v <= numVertices; v++) rowmapHost(v) = rowmap[v];
+  for (size_t e = 0; e < entries.size(); e++) entriesHost(e) = entries[e];
+  Kokkos::deep_copy(rowmapView, rowmapHost);
+  Kokkos::deep_copy(entriesView, entriesHost);
+}
+
+template <typename lno_t, typename size_type, typename device>
+void test_bfs(lno_t gridX, lno_t gridY, lno_t gridZ, lno_t source) {
+  typedef
+      typename KokkosSparse::CrsMatrix<double, lno_t, device, void, size_type>
+          crsMat_t;
+  typedef typename crsMat_t::StaticCrsGraphType graph_t;
+  typedef typename graph_t::row_map_type rowmap_t;
+  typedef typename graph_t::entries_type entries_t;
+  const lno_t numIsolated = 3;
+  typename rowmap_t::non_const_type rowmap;
+  typename entries_t::non_const_type entries;
+  bfs_grid_graph(rowmap, entries, gridX, gridY, gridZ, numIsolated);
+  const lno_t numVerts = gridX * gridY * gridZ + numIsolated;
+
+  // Reference distances from a serial BFS
+  auto rowmapHost =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), rowmap);
+  auto entriesHost =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), entries);
+  std::vector<lno_t> refDist(numVerts, -1);
+  std::queue<lno_t> q;
+  refDist[source] = 0;
+  q.push(source);
+  while (!q.empty()) {
+    lno_t v = q.front();
+    q.pop();
+    for (size_type j = rowmapHost(v); j < rowmapHost(v + 1); j++) {
+      lno_t nei = entriesHost(j);
+      if (refDist[nei] == -1) {
+        refDist[nei] = refDist[v] + 1;
+        q.push(nei);
+      }
+    }
+  }
+
+  // Default switching, top-down only and bottom-up after the first level
+  const double params[3][2] = {{14, 24}, {1e-30, 24}, {1e30, 1e30}};
+  for (int p = 0; p < 3; p++) {
+    auto dist =
+        KokkosGraph::Experimental::graph_bfs<device, rowmap_t, entries_t>(
+            rowmap, entries, source, params[p][0], params[p][1]);
+    auto distHost =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), dist);
+    for (lno_t i = 0; i < numVerts; i++) ASSERT_EQ(distHost(i), refDist[i]);
+  }
+
+  EXPECT_THROW(
+      (KokkosGraph::Experimental::graph_bfs<device, rowmap_t, entries_t>(
+          rowmap, entries, numVerts)),
+      std::invalid_argument);
+}
+
+#define EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)                  \
+  TEST_F(TestCategory,                                                 \
+         graph##_##bfs##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    test_bfs<ORDINAL, OFFSET, DEVICE>(6, 3, 3, 0);                     \
+    test_bfs<ORDINAL, OFFSET, DEVICE>(30, 30, 30, 4321);               \
+    test_bfs<ORDINAL, OFFSET, DEVICE>(200, 100, 1, 150);               \
+  }
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT) && \
+     defined(KOKKOSKERNELS_INST_OFFSET_INT)) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&        \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int, int, TestDevice)
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT64_T) && \
+     defined(KOKKOSKERNELS_INST_OFFSET_INT)) ||     \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&            \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int64_t, int, TestDevice)
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT) &&    \
+     defined(KOKKOSKERNELS_INST_OFFSET_SIZE_T)) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&           \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int, size_t, TestDevice)
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT64_T) && \
+     defined(KOKKOSKERNELS_INST_OFFSET_SIZE_T)) ||  \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&            \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int64_t, size_t, TestDevice)
+#endif
+
+#undef EXECUTE_TEST
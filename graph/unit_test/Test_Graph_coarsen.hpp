@@ -275,6 +275,68 @@ void test_multilevel_coarsen_grid() {
   }
 }
 
+template <typename scalar, typename lno_t, typename size_type, typename device>
+void test_multilevel_coarsen_numeric_rebuild() {
+  using crsMat =
+      KokkosSparse::CrsMatrix<scalar, lno_t, device, void, size_type>;
+  using svt         = typename crsMat::values_type::non_const_type;
+  crsMat A          = gen_grid<crsMat>();
+  using coarsener_t = coarse_builder<crsMat>;
+  typename coarsener_t::coarsen_handle handle;
+  using clt = typename coarsener_t::coarse_level_triple;
+  handle.h  = coarsener_t::HECv1;
+  handle.b  = coarsener_t::Hybrid;
+  coarsener_t::generate_coarse_graphs(handle, A, true);
+  std::vector<svt> built_values;
+  for (const clt& l : handle.results) {
+    svt copy("built values", l.mtx.nnz());
+    Kokkos::deep_copy(copy, l.mtx.values);
+    built_values.push_back(copy);
+  }
+  // new symmetric edge weights on the same grid
+  auto rowmap =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.row_map);
+  auto entries =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.entries);
+  svt new_values("new values", A.nnz());
+  auto h_values = Kokkos::create_mirror_view(new_values);
+  for (lno_t i = 0; i < A.numRows(); i++) {
+    for (size_type j = rowmap(i); j < rowmap(i + 1); j++) {
+      h_values(j) = static_cast<scalar>(1 + (i + entries(j)) % 4);
+    }
+  }
+  Kokkos::deep_copy(new_values, h_values);
+  coarsener_t::rebuild_coarse_graphs_numeric(handle, new_values);
+  auto fine   = handle.results.begin();
+  auto coarse = fine;
+  coarse++;
+  while (coarse != handle.results.end()) {
+    EXPECT_TRUE(verify_coarsening<coarsener_t>(*fine, *coarse))
+        << "Numeric rebuild produced invalid coarsening on level "
+        << coarse->level;
+    fine++;
+    coarse++;
+  }
+  // rebuilding with the original weights (reusing the entry maps) gives the
+  // coarse graphs of generate_coarse_graphs back
+  svt ones("unit values", A.nnz());
+  Kokkos::deep_copy(ones, static_cast<scalar>(1));
+  coarsener_t::rebuild_coarse_graphs_numeric(handle, ones);
+  size_t l = 0;
+  for (const clt& level : handle.results) {
+    auto built = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                     built_values[l]);
+    auto rebuilt = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                       level.mtx.values);
+    for (size_t k = 0; k < built.extent(0); k++) {
+      EXPECT_EQ(built(k), rebuilt(k))
+          << "Numeric rebuild changed entry " << k << " on level "
+          << level.level;
+    }
+    l++;
+  }
+}
+
 template <typename scalar, typename lno_t, typename size_type, typename device>
 void test_coarsen_grid() {
   using crsMat =
@@ -413,6 +475,7 @@ void test_coarsen_random(lno_t numVerts, size_type nnz, lno_t bandwidth,
       TestCategory,                                                                           \
       graph##_##grid_graph_multilevel_coarsen##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
     test_multilevel_coarsen_grid<SCALAR, ORDINAL, OFFSET, DEVICE>();                          \
+    test_multilevel_coarsen_numeric_rebuild<SCALAR, ORDINAL, OFFSET, DEVICE>();               \
   }
 
 // FIXME_SYCL
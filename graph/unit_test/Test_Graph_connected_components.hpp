@@ -0,0 +1,140 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+
+#include "KokkosGraph_ConnectedComponents.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+// Random symmetric graph whose vertices are split into numGroups connected
+// groups (a random path through each group, plus random edges within it);
+// group[v] gets the smallest vertex of v's group
+template <typename rowmap_t, typename entries_t, typename lno_t>
+void cc_random_graph(rowmap_t& rowmapView, entries_t& entriesView,
+                     lno_t numVerts, lno_t numGroups, lno_t extraEdges,
+                     std::vector<lno_t>& group) {
+  using size_type = typename rowmap_t::non_const_value_type;
+  std::mt19937 gen(12345);
+  std::vector<lno_t> order(numVerts);
+  for (lno_t i = 0; i < numVerts; i++) order[i] = i;
+  std::shuffle(order.begin(), order.end(), gen);
+  std::vector<std::vector<lno_t>> adj(numVerts);
+  auto addEdge = [&](lno_t u, lno_t v) {
+    adj[u].push_back(v);
+    adj[v].push_back(u);
+  };
+  group.assign(numVerts, 0);
+  // The groups are consecutive ranges of order
+  for (lno_t g = 0; g < numGroups; g++) {
+    lno_t begin = (g * numVerts) / numGroups;
+    lno_t end   = ((g + 1) * numVerts) / numGroups;
+    if (begin == end) continue;
+    lno_t smallest = *std::min_element(order.begin() + begin,
+                                       order.begin() + end);
+    for (lno_t i = begin; i < end; i++) group[order[i]] = smallest;
+    for (lno_t i = begin + 1; i < end; i++) addEdge(order[i - 1], order[i]);
+    std::uniform_int_distribution<lno_t> dist(begin, end - 1);
+    for (lno_t e = 0; e < extraEdges * (end - begin); e++)
+      addEdge(order[dist(gen)], order[dist(gen)]);
+  }
+  std::vector<size_type> rowmap(numVerts + 1, 0);
+  std::vector<lno_t> entries;
+  for (lno_t v = 0; v < numVerts; v++) {
+    entries.insert(entries.end(), adj[v].begin(), adj[v].end());
+    rowmap[v + 1] = entries.size();
+  }
+  rowmapView =
+      rowmap_t(Kokkos::view_alloc(Kokkos::WithoutInitializing, "Rowmap"),
+               numVerts + 1);
+  entriesView = entries_t(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "Colinds"),
+      entries.size());
+  auto rowmapHost  = Kokkos::create_mirror_view(rowmapView);
+  auto entriesHost = Kokkos::create_mirror_view(entriesView);
+  for (lno_t v = 0; v <= numVerts; v++) rowmapHost(v) = rowmap[v];
+  for (size_t e = 0; e < entries.size(); e++) entriesHost(e) = entries[e];
+  Kokkos::deep_copy(rowmapView, rowmapHost);
+  Kokkos::deep_copy(entriesView, entriesHost);
+}
+
+template <typename lno_t, typename size_type, typename device>
+void test_connected_components(lno_t numVerts, lno_t numGroups,
+                               lno_t extraEdges) {
+  typedef
+      typename KokkosSparse::CrsMatrix<double, lno_t, device, void, size_type>
+          crsMat_t;
+  typedef typename crsMat_t::StaticCrsGraphType graph_t;
+  typedef typename graph_t::row_map_type rowmap_t;
+  typedef typename graph_t::entries_type entries_t;
+  typename rowmap_t::non_const_type rowmap;
+  typename entries_t::non_const_type entries;
+  std::vector<lno_t> group;
+  cc_random_graph(rowmap, entries, numVerts, numGroups, extraEdges, group);
+  lno_t numComponents = -1;
+  auto labels =
+      KokkosGraph::graph_connected_components<device, rowmap_t, entries_t>(
+          rowmap, entries, numComponents);
+  EXPECT_EQ(numComponents, std::min(numGroups, numVerts));
+  auto labelsHost =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), labels);
+  for (lno_t v = 0; v < numVerts; v++) ASSERT_EQ(labelsHost(v), group[v]);
+}
+
+#define EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)                     \
+  TEST_F(TestCategory,                                                    \
+         graph##_##connected_components##_##SCALAR##_##ORDINAL##_##OFFSET \
+             ##_##DEVICE) {                                               \
+    test_connected_components<ORDINAL, OFFSET, DEVICE>(1, 1, 0);          \
+    test_connected_components<ORDINAL, OFFSET, DEVICE>(100, 7, 0);        \
+    test_connected_components<ORDINAL, OFFSET, DEVICE>(5000, 1, 2);       \
+    test_connected_components<ORDINAL, OFFSET, DEVICE>(20000, 30, 3);     \
+    test_connected_components<ORDINAL, OFFSET, DEVICE>(2000, 2000, 0);    \
+  }
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT) && \
+     defined(KOKKOSKERNELS_INST_OFFSET_INT)) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&        \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int, int, TestDevice)
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT64_T) && \
+     defined(KOKKOSKERNELS_INST_OFFSET_INT)) ||     \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&            \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int64_t, int, TestDevice)
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT) &&    \
+     defined(KOKKOSKERNELS_INST_OFFSET_SIZE_T)) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&           \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int, size_t, TestDevice)
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT64_T) && \
+     defined(KOKKOSKERNELS_INST_OFFSET_SIZE_T)) ||  \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&            \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int64_t, size_t, TestDevice)
+#endif
+
+#undef EXECUTE_TEST
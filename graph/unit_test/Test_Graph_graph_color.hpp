@@ -15,6 +15,7 @@
 //@HEADER
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <Kokkos_Core.hpp>
 
 #include "KokkosGraph_Distance1Color.hpp"
@@ -36,7 +37,8 @@ int run_graphcolor(
     crsMat_t input_mat, ColoringAlgorithm coloring_algorithm,
     size_t &num_colors,
     typename crsMat_t::StaticCrsGraphType::entries_type::non_const_type
-        &vertex_colors) {
+        &vertex_colors,
+    bool balance_colors = false) {
   typedef typename crsMat_t::StaticCrsGraphType graph_t;
   typedef typename graph_t::row_map_type lno_view_t;
   typedef typename graph_t::entries_type lno_nnz_view_t;
@@ -56,6 +58,7 @@ int run_graphcolor(
   kh.set_dynamic_scheduling(true);
 
   kh.create_graph_coloring_handle(coloring_algorithm);
+  kh.get_graph_coloring_handle()->set_balance_colors(balance_colors);
 
   const size_t num_rows_1 = input_mat.numRows();
   const size_t num_cols_1 = input_mat.numCols();
@@ -189,6 +192,49 @@ void test_coloring(lno_t numRows, size_type nnz, lno_t bandwidth,
         << ": D1 coloring produced invalid coloring (" << num_conflict
         << " conflicts)";
   }
+
+  // Balancing: the coloring stays valid with the same number of colors, and
+  // the class sizes get closer to numRows / num_colors
+  for (ColoringAlgorithm coloring_algorithm :
+       {COLORING_SERIAL, COLORING_VBBIT}) {
+    color_view_t colors, balanced_colors;
+    size_t num_colors, num_balanced_colors;
+    run_graphcolor<crsMat_t, device>(input_mat, coloring_algorithm, num_colors,
+                                     colors);
+    run_graphcolor<crsMat_t, device>(input_mat, coloring_algorithm,
+                                     num_balanced_colors, balanced_colors,
+                                     true);
+
+    const lno_t num_conflict = KokkosSparse::Impl::kk_is_d1_coloring_valid<
+        lno_view_t, lno_nnz_view_t, color_view_t,
+        typename device::execution_space>(
+        input_mat.numRows(), input_mat.numCols(), input_mat.graph.row_map,
+        input_mat.graph.entries, balanced_colors);
+    EXPECT_EQ(num_conflict, 0)
+        << "Coloring algo " << (int)coloring_algorithm
+        << ": balanced D1 coloring produced invalid coloring";
+
+    auto class_size_range = [](const color_view_t &c, size_t nc) {
+      auto hc = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), c);
+      std::vector<lno_t> sizes(nc + 1, 0);
+      for (size_t i = 0; i < hc.extent(0); i++) sizes[hc(i)]++;
+      return std::make_pair(*std::min_element(sizes.begin() + 1, sizes.end()),
+                            *std::max_element(sizes.begin() + 1, sizes.end()));
+    };
+    const auto range = class_size_range(colors, num_colors);
+    const auto balanced_range =
+        class_size_range(balanced_colors, num_balanced_colors);
+    const lno_t target =
+        (numRows + num_balanced_colors - 1) / num_balanced_colors;
+    EXPECT_LE(balanced_range.second, std::max(range.second, target));
+    EXPECT_GT(balanced_range.first, 0);
+    if (coloring_algorithm == COLORING_SERIAL) {
+      // Deterministic: the balancing starts from the same coloring
+      EXPECT_EQ(num_balanced_colors, num_colors);
+      EXPECT_GE(balanced_range.first, range.first);
+      EXPECT_LE(balanced_range.second, range.second);
+    }
+  }
   // device::execution_space::finalize();
 }
 
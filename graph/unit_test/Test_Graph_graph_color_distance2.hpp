@@ -145,11 +145,14 @@ void test_dist2_coloring(lno_t numVerts, size_type nnz, lno_t bandwidth,
   auto entriesHost =
       Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), symEntries);
   std::vector<GraphColoringAlgorithmDistance2> algos = {
-      COLORING_D2_DEFAULT, COLORING_D2_SERIAL,    COLORING_D2_VB,
-      COLORING_D2_VB_BIT,  COLORING_D2_VB_BIT_EF, COLORING_D2_NB_BIT};
+      COLORING_D2_DEFAULT,   COLORING_D2_SERIAL,    COLORING_D2_VB,
+      COLORING_D2_VB_BIT,    COLORING_D2_VB_BIT_EF, COLORING_D2_NB_BIT,
+      COLORING_D2_VB_HYBRID};
   for (auto algo : algos) {
     KernelHandle kh;
     kh.create_distance2_graph_coloring_handle(algo);
+    // For COLORING_D2_VB_HYBRID: about half of the vertices are hubs
+    kh.get_distance2_graph_coloring_handle()->set_hub_degree(nnz / numVerts);
     // Compute the Distance-2 graph coloring.
     graph_color_distance2<KernelHandle, c_rowmap_t, c_entries_t>(
         &kh, numVerts, symRowmap, symEntries);
@@ -202,11 +205,14 @@ void test_bipartite_symmetric(lno_t numVerts, size_type nnz, lno_t bandwidth,
   auto entriesHost =
       Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), symEntries);
   std::vector<GraphColoringAlgorithmDistance2> algos = {
-      COLORING_D2_DEFAULT, COLORING_D2_SERIAL,    COLORING_D2_VB,
-      COLORING_D2_VB_BIT,  COLORING_D2_VB_BIT_EF, COLORING_D2_NB_BIT};
+      COLORING_D2_DEFAULT,   COLORING_D2_SERIAL,    COLORING_D2_VB,
+      COLORING_D2_VB_BIT,    COLORING_D2_VB_BIT_EF, COLORING_D2_NB_BIT,
+      COLORING_D2_VB_HYBRID};
   for (auto algo : algos) {
     KernelHandle kh;
     kh.create_distance2_graph_coloring_handle(algo);
+    // For COLORING_D2_VB_HYBRID: about half of the vertices are hubs
+    kh.get_distance2_graph_coloring_handle()->set_hub_degree(nnz / numVerts);
     // Compute the Distance-2 graph coloring.
     bipartite_color_rows<KernelHandle, c_rowmap_t, c_entries_t>(
         &kh, numVerts, numVerts, symRowmap, symEntries, true);
@@ -264,11 +270,14 @@ void test_bipartite(lno_t numRows, lno_t numCols, size_type nnz,
   auto t_entriesHost =
       Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), t_entries);
   std::vector<GraphColoringAlgorithmDistance2> algos = {
-      COLORING_D2_DEFAULT, COLORING_D2_SERIAL,    COLORING_D2_VB,
-      COLORING_D2_VB_BIT,  COLORING_D2_VB_BIT_EF, COLORING_D2_NB_BIT};
+      COLORING_D2_DEFAULT,   COLORING_D2_SERIAL,    COLORING_D2_VB,
+      COLORING_D2_VB_BIT,    COLORING_D2_VB_BIT_EF, COLORING_D2_NB_BIT,
+      COLORING_D2_VB_HYBRID};
   for (auto algo : algos) {
     KernelHandle kh;
     kh.create_distance2_graph_coloring_handle(algo);
+    // For COLORING_D2_VB_HYBRID: about half of the vertices are hubs
+    kh.get_distance2_graph_coloring_handle()->set_hub_degree(nnz / numRows);
     // Compute the one-sided bipartite coloring.
     if (colorRows) {
       bipartite_color_rows<KernelHandle, c_rowmap_t, c_entries_t>(
@@ -0,0 +1,189 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+
+#include "KokkosGraph_Distance1Color.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosKernels_Handle.hpp"
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+template <typename rowmap_t, typename entries_t, typename lno_t>
+void color_update_to_device(const std::vector<std::set<lno_t>>& adj,
+                            rowmap_t& rowmapView, entries_t& entriesView) {
+  lno_t numVerts = adj.size();
+  size_t nnz     = 0;
+  for (const auto& row : adj) nnz += row.size();
+  rowmapView  = rowmap_t("Rowmap", numVerts + 1);
+  entriesView = entries_t("Entries", nnz);
+  auto rowmapHost  = Kokkos::create_mirror_view(rowmapView);
+  auto entriesHost = Kokkos::create_mirror_view(entriesView);
+  size_t pos       = 0;
+  for (lno_t v = 0; v < numVerts; v++) {
+    rowmapHost(v) = pos;
+    for (lno_t w : adj[v]) entriesHost(pos++) = w;
+  }
+  rowmapHost(numVerts) = pos;
+  Kokkos::deep_copy(rowmapView, rowmapHost);
+  Kokkos::deep_copy(entriesView, entriesHost);
+}
+
+template <typename lno_t, typename size_type, typename device>
+void test_graph_color_update(lno_t numVerts, lno_t avgDegree, lno_t numEdits,
+                             lno_t numNewVerts) {
+  using namespace KokkosGraph;
+  using namespace KokkosGraph::Experimental;
+  typedef
+      typename KokkosSparse::CrsMatrix<double, lno_t, device, void, size_type>
+          crsMat_t;
+  typedef typename crsMat_t::StaticCrsGraphType graph_t;
+  typedef typename graph_t::row_map_type::non_const_type rowmap_t;
+  typedef typename graph_t::entries_type::non_const_type entries_t;
+  typedef KokkosKernels::Experimental::KokkosKernelsHandle<
+      size_type, lno_t, double, typename device::execution_space,
+      typename device::memory_space, typename device::memory_space>
+      KernelHandle;
+
+  std::mt19937 gen(2468);
+  std::uniform_int_distribution<lno_t> vertDist(0, numVerts - 1);
+  std::vector<std::set<lno_t>> adj(numVerts);
+  for (lno_t e = 0; e < numVerts * avgDegree / 2; e++) {
+    lno_t u = vertDist(gen);
+    lno_t v = vertDist(gen);
+    if (u == v) continue;
+    adj[u].insert(v);
+    adj[v].insert(u);
+  }
+  rowmap_t rowmap;
+  entries_t entries;
+  color_update_to_device(adj, rowmap, entries);
+
+  KernelHandle kh;
+  kh.create_graph_coloring_handle(COLORING_DEFAULT);
+  // there is nothing to update before the first coloring
+  EXPECT_THROW((graph_color_update(&kh, numVerts, numVerts, rowmap, entries,
+                                   entries_t())),
+               std::runtime_error);
+  graph_color(&kh, numVerts, numVerts, rowmap, entries);
+  auto* gch              = kh.get_graph_coloring_handle();
+  const size_t oldColors = gch->get_num_colors();
+  auto oldColorsHost     = Kokkos::create_mirror_view_and_copy(
+      Kokkos::HostSpace(), gch->get_vertex_colors());
+
+  // edits: edges between vertices of the same color, so that each one is a
+  // conflict, and new vertices attached to existing ones
+  std::set<lno_t> modified;
+  for (lno_t i = 0; i < numEdits; i++) {
+    const lno_t u = vertDist(gen);
+    for (int tries = 0; tries < 100; tries++) {
+      const lno_t v = vertDist(gen);
+      if (v == u || oldColorsHost(v) != oldColorsHost(u)) continue;
+      adj[u].insert(v);
+      adj[v].insert(u);
+      modified.insert(u);
+      modified.insert(v);
+      break;
+    }
+  }
+  const lno_t newNumVerts = numVerts + numNewVerts;
+  adj.resize(newNumVerts);
+  for (lno_t v = numVerts; v < newNumVerts; v++) {
+    for (int i = 0; i < avgDegree; i++) {
+      const lno_t u = std::uniform_int_distribution<lno_t>(0, v - 1)(gen);
+      adj[u].insert(v);
+      adj[v].insert(u);
+      if (u < numVerts) modified.insert(u);
+    }
+  }
+  color_update_to_device(adj, rowmap, entries);
+  entries_t modifiedView("Modified", modified.size());
+  auto modifiedHost = Kokkos::create_mirror_view(modifiedView);
+  size_t pos        = 0;
+  for (lno_t v : modified) modifiedHost(pos++) = v;
+  Kokkos::deep_copy(modifiedView, modifiedHost);
+
+  graph_color_update(&kh, newNumVerts, newNumVerts, rowmap, entries,
+                     modifiedView);
+  auto colorsHost = Kokkos::create_mirror_view_and_copy(
+      Kokkos::HostSpace(), gch->get_vertex_colors());
+  ASSERT_EQ(colorsHost.extent(0), size_t(newNumVerts));
+  size_t maxDegree = 0;
+  for (lno_t v = 0; v < newNumVerts; v++) {
+    maxDegree = std::max(maxDegree, adj[v].size());
+    ASSERT_GT(colorsHost(v), 0);
+    for (lno_t w : adj[v])
+      ASSERT_NE(colorsHost(v), colorsHost(w))
+          << "vertices " << v << " and " << w << " share a color";
+    // only the modified vertices may be recolored
+    if (v < numVerts && !modified.count(v))
+      ASSERT_EQ(colorsHost(v), oldColorsHost(v));
+  }
+  const size_t numColors = gch->get_num_colors();
+  EXPECT_LE(numColors, std::max(oldColors, maxDegree + 1));
+
+  // an empty list with no new vertices leaves the coloring as is
+  graph_color_update(&kh, newNumVerts, newNumVerts, rowmap, entries,
+                     entries_t());
+  auto sameColorsHost = Kokkos::create_mirror_view_and_copy(
+      Kokkos::HostSpace(), gch->get_vertex_colors());
+  for (lno_t v = 0; v < newNumVerts; v++)
+    ASSERT_EQ(sameColorsHost(v), colorsHost(v));
+  kh.destroy_graph_coloring_handle();
+}
+
+#define EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)                        \
+  TEST_F(TestCategory,                                                       \
+         graph##_##graph_color_update##_##SCALAR##_##ORDINAL##_##OFFSET##_## \
+             DEVICE) {                                                       \
+    test_graph_color_update<ORDINAL, OFFSET, DEVICE>(10, 3, 2, 1);           \
+    test_graph_color_update<ORDINAL, OFFSET, DEVICE>(500, 8, 50, 20);        \
+    test_graph_color_update<ORDINAL, OFFSET, DEVICE>(20000, 16, 2000, 500);  \
+  }
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT) && \
+     defined(KOKKOSKERNELS_INST_OFFSET_INT)) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&        \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int, int, TestDevice)
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT64_T) && \
+     defined(KOKKOSKERNELS_INST_OFFSET_INT)) ||     \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&            \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int64_t, int, TestDevice)
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT) &&    \
+     defined(KOKKOSKERNELS_INST_OFFSET_SIZE_T)) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&           \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int, size_t, TestDevice)
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT64_T) && \
+     defined(KOKKOSKERNELS_INST_OFFSET_SIZE_T)) ||  \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&            \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int64_t, size_t, TestDevice)
+#endif
+
+#undef EXECUTE_TEST
@@ -0,0 +1,191 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+
+#include "KokkosGraph_KCore.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <vector>
+
+// Random symmetric graph: a few random cliques (which have large cores and
+// trusses) on top of random sparse edges
+template <typename lno_t>
+std::vector<std::set<lno_t>> kcore_random_graph(lno_t numVerts,
+                                                lno_t avgDegree) {
+  std::mt19937 gen(777);
+  std::uniform_int_distribution<lno_t> vertDist(0, numVerts - 1);
+  std::vector<std::set<lno_t>> adj(numVerts);
+  auto addEdge = [&](lno_t u, lno_t v) {
+    if (u == v) return;
+    adj[u].insert(v);
+    adj[v].insert(u);
+  };
+  for (lno_t e = 0; e < numVerts * avgDegree / 2; e++)
+    addEdge(vertDist(gen), vertDist(gen));
+  for (int c = 0; c < 3; c++) {
+    std::vector<lno_t> clique;
+    lno_t size = std::min<lno_t>(numVerts, 4 + 3 * c);
+    for (lno_t i = 0; i < size; i++) clique.push_back(vertDist(gen));
+    for (lno_t u : clique)
+      for (lno_t v : clique) addEdge(u, v);
+  }
+  return adj;
+}
+
+template <typename rowmap_t, typename entries_t, typename lno_t>
+void kcore_to_device(const std::vector<std::set<lno_t>>& adj,
+                     rowmap_t& rowmapView, entries_t& entriesView) {
+  lno_t numVerts = adj.size();
+  size_t nnz     = 0;
+  for (const auto& row : adj) nnz += row.size();
+  rowmapView  = rowmap_t("Rowmap", numVerts + 1);
+  entriesView = entries_t("Entries", nnz);
+  auto rowmapHost  = Kokkos::create_mirror_view(rowmapView);
+  auto entriesHost = Kokkos::create_mirror_view(entriesView);
+  size_t pos       = 0;
+  for (lno_t v = 0; v < numVerts; v++) {
+    rowmapHost(v) = pos;
+    for (lno_t w : adj[v]) entriesHost(pos++) = w;
+  }
+  rowmapHost(numVerts) = pos;
+  Kokkos::deep_copy(rowmapView, rowmapHost);
+  Kokkos::deep_copy(entriesView, entriesHost);
+}
+
+template <typename lno_t, typename size_type, typename device>
+void test_kcore(lno_t numVerts, lno_t avgDegree) {
+  typedef
+      typename KokkosSparse::CrsMatrix<double, lno_t, device, void, size_type>
+          crsMat_t;
+  typedef typename crsMat_t::StaticCrsGraphType graph_t;
+  typedef typename graph_t::row_map_type::non_const_type rowmap_t;
+  typedef typename graph_t::entries_type::non_const_type entries_t;
+  auto adj = kcore_random_graph(numVerts, avgDegree);
+  rowmap_t rowmap;
+  entries_t entries;
+  kcore_to_device(adj, rowmap, entries);
+  auto cores = KokkosGraph::kcore<device>(rowmap, entries);
+  auto coresHost =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), cores);
+  // Sequential peeling, removing a vertex of minimum degree at a time
+  std::vector<lno_t> degree(numVerts);
+  std::vector<bool> removed(numVerts, false);
+  for (lno_t v = 0; v < numVerts; v++) degree[v] = adj[v].size();
+  lno_t level = 0;
+  for (lno_t step = 0; step < numVerts; step++) {
+    lno_t best = -1;
+    for (lno_t v = 0; v < numVerts; v++) {
+      if (!removed[v] && (best < 0 || degree[v] < degree[best])) best = v;
+    }
+    level         = std::max(level, degree[best]);
+    removed[best] = true;
+    ASSERT_EQ(coresHost(best), level) << "vertex " << best;
+    for (lno_t w : adj[best]) degree[w]--;
+  }
+}
+
+template <typename lno_t, typename size_type, typename device>
+void test_ktruss(lno_t numVerts, lno_t avgDegree, lno_t k) {
+  typedef
+      typename KokkosSparse::CrsMatrix<double, lno_t, device, void, size_type>
+          crsMat_t;
+  typedef typename crsMat_t::StaticCrsGraphType graph_t;
+  typedef typename graph_t::row_map_type::non_const_type rowmap_t;
+  typedef typename graph_t::entries_type::non_const_type entries_t;
+  auto adj = kcore_random_graph(numVerts, avgDegree);
+  rowmap_t rowmap, trussRowmap;
+  entries_t entries, trussEntries;
+  kcore_to_device(adj, rowmap, entries);
+  KokkosGraph::ktruss<device>(rowmap, entries, k, trussRowmap, trussEntries);
+  // Sequential peeling, to a fixed point
+  bool changed = true;
+  while (changed) {
+    changed = false;
+    for (lno_t u = 0; u < numVerts; u++) {
+      std::vector<lno_t> weak;
+      for (lno_t v : adj[u]) {
+        lno_t support = 0;
+        for (lno_t w : adj[u]) support += adj[v].count(w);
+        if (support < k - 2) weak.push_back(v);
+      }
+      for (lno_t v : weak) {
+        adj[u].erase(v);
+        adj[v].erase(u);
+        changed = true;
+      }
+    }
+  }
+  auto rowmapHost =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), trussRowmap);
+  auto entriesHost =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), trussEntries);
+  ASSERT_EQ(rowmapHost.extent(0), size_t(numVerts + 1));
+  for (lno_t v = 0; v < numVerts; v++) {
+    ASSERT_EQ(size_t(rowmapHost(v + 1) - rowmapHost(v)), adj[v].size());
+    size_type pos = rowmapHost(v);
+    for (lno_t w : adj[v]) ASSERT_EQ(entriesHost(pos++), w);
+  }
+}
+
+#define EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)                     \
+  TEST_F(TestCategory,                                                    \
+         graph##_##kcore##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) {  \
+    test_kcore<ORDINAL, OFFSET, DEVICE>(1, 0);                            \
+    test_kcore<ORDINAL, OFFSET, DEVICE>(50, 3);                           \
+    test_kcore<ORDINAL, OFFSET, DEVICE>(1000, 8);                         \
+  }                                                                       \
+  TEST_F(TestCategory,                                                    \
+         graph##_##ktruss##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    test_ktruss<ORDINAL, OFFSET, DEVICE>(50, 4, 2);                       \
+    test_ktruss<ORDINAL, OFFSET, DEVICE>(50, 4, 3);                       \
+    test_ktruss<ORDINAL, OFFSET, DEVICE>(300, 10, 4);                     \
+    test_ktruss<ORDINAL, OFFSET, DEVICE>(300, 10, 6);                     \
+  }
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT) && \
+     defined(KOKKOSKERNELS_INST_OFFSET_INT)) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&        \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int, int, TestDevice)
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT64_T) && \
+     defined(KOKKOSKERNELS_INST_OFFSET_INT)) ||     \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&            \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int64_t, int, TestDevice)
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT) &&    \
+     defined(KOKKOSKERNELS_INST_OFFSET_SIZE_T)) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&           \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int, size_t, TestDevice)
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT64_T) && \
+     defined(KOKKOSKERNELS_INST_OFFSET_SIZE_T)) ||  \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&            \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int64_t, size_t, TestDevice)
+#endif
+
+#undef EXECUTE_TEST
@@ -0,0 +1,209 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <set>
+#include <vector>
+#include <Kokkos_Core.hpp>
+
+#include "KokkosGraph_Louvain.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+
+using namespace KokkosGraph::Experimental;
+
+// Symmetric adjacency matrix from an undirected edge list (u, v, w); a self
+// loop (u, u, w) is a single diagonal entry
+template <class crsMat>
+crsMat louvain_graph(typename crsMat::ordinal_type n,
+                     const std::vector<std::vector<double>>& edges) {
+  using ordinal_t = typename crsMat::ordinal_type;
+  using scalar_t  = typename crsMat::value_type;
+  std::vector<std::vector<std::pair<ordinal_t, scalar_t>>> rows(n);
+  for (const auto& e : edges) {
+    const ordinal_t u = static_cast<ordinal_t>(e[0]);
+    const ordinal_t v = static_cast<ordinal_t>(e[1]);
+    rows[u].push_back(std::make_pair(v, scalar_t(e[2])));
+    if (u != v) rows[v].push_back(std::make_pair(u, scalar_t(e[2])));
+  }
+  size_t nnz = 0;
+  for (const auto& r : rows) nnz += r.size();
+  typename crsMat::row_map_type::non_const_type rowmap("rowmap", n + 1);
+  typename crsMat::index_type::non_const_type entries("entries", nnz);
+  typename crsMat::values_type::non_const_type values("values", nnz);
+  auto hrowmap  = Kokkos::create_mirror_view(rowmap);
+  auto hentries = Kokkos::create_mirror_view(entries);
+  auto hvalues  = Kokkos::create_mirror_view(values);
+  size_t pos    = 0;
+  for (ordinal_t i = 0; i < n; i++) {
+    hrowmap(i) = pos;
+    for (const auto& e : rows[i]) {
+      hentries(pos) = e.first;
+      hvalues(pos)  = e.second;
+      pos++;
+    }
+  }
+  hrowmap(n) = pos;
+  Kokkos::deep_copy(rowmap, hrowmap);
+  Kokkos::deep_copy(entries, hentries);
+  Kokkos::deep_copy(values, hvalues);
+  return crsMat("graph", n, n, nnz, values, rowmap, entries);
+}
+
+// Checks that the communities are labeled in [0, num_communities), and
+// returns their modularity computed on host
+template <class crsMat, class comm_view_t>
+double verify_communities(crsMat A, comm_view_t comm,
+                          typename crsMat::ordinal_type num_communities) {
+  using ordinal_t = typename crsMat::ordinal_type;
+  using edge_t    = typename crsMat::size_type;
+  auto rowmap =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.row_map);
+  auto entries =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.entries);
+  auto values =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.values);
+  auto hcomm = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), comm);
+  std::set<ordinal_t> labels;
+  for (ordinal_t i = 0; i < A.numRows(); i++) {
+    EXPECT_TRUE(hcomm(i) >= 0 && hcomm(i) < num_communities)
+        << "vertex " << i << " has invalid community " << hcomm(i);
+    labels.insert(hcomm(i));
+  }
+  EXPECT_EQ(static_cast<ordinal_t>(labels.size()), num_communities);
+  std::vector<double> tot(A.numRows(), 0);
+  double inside = 0, m2 = 0;
+  for (ordinal_t i = 0; i < A.numRows(); i++) {
+    for (edge_t j = rowmap(i); j < rowmap(i + 1); j++) {
+      if (hcomm(entries(j)) == hcomm(i)) inside += values(j);
+      tot[hcomm(i)] += values(j);
+      m2 += values(j);
+    }
+  }
+  double squares = 0;
+  for (double t : tot) squares += t * t;
+  return inside / m2 - squares / (m2 * m2);
+}
+
+// A ring of cliques joined by single edges: each clique is a community
+template <typename scalar, typename lno_t, typename size_type, typename device>
+void test_louvain_ring_of_cliques(lno_t num_cliques, lno_t clique_size) {
+  using crsMat =
+      KokkosSparse::CrsMatrix<scalar, lno_t, device, void, size_type>;
+  using louvain_t = louvain<crsMat>;
+  std::vector<std::vector<double>> edges;
+  for (lno_t c = 0; c < num_cliques; c++) {
+    const lno_t base = c * clique_size;
+    for (lno_t a = 0; a < clique_size; a++)
+      for (lno_t b = a + 1; b < clique_size; b++)
+        edges.push_back({double(base + a), double(base + b), 1.0});
+    const lno_t next = ((c + 1) % num_cliques) * clique_size;
+    edges.push_back({double(base), double(next + 1), 1.0});
+  }
+  crsMat A = louvain_graph<crsMat>(num_cliques * clique_size, edges);
+  typename louvain_t::louvain_handle handle;
+  auto comm = louvain_t::detect(handle, A);
+
+  EXPECT_EQ(handle.num_communities, num_cliques);
+  const double q = verify_communities(A, comm, handle.num_communities);
+  EXPECT_NEAR(q, handle.modularity, 1e-10);
+  auto hcomm = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), comm);
+  for (lno_t i = 0; i < A.numRows(); i++) {
+    EXPECT_EQ(hcomm(i), hcomm(i - i % clique_size))
+        << "vertex " << i << " is not with its clique";
+  }
+  // the expected partition has a known modularity
+  const double inner = clique_size * (clique_size - 1) / 2;
+  const double m     = num_cliques * (inner + 1);
+  const double tot   = (2 * inner + 2) / (2 * m);
+  const double ref   = num_cliques * (inner / m - tot * tot);
+  EXPECT_NEAR(handle.modularity, ref, 1e-10);
+}
+
+// Weighted triangles, a self loop and an isolated vertex
+template <typename scalar, typename lno_t, typename size_type, typename device>
+void test_louvain_small() {
+  using crsMat =
+      KokkosSparse::CrsMatrix<scalar, lno_t, device, void, size_type>;
+  using louvain_t = louvain<crsMat>;
+  crsMat A        = louvain_graph<crsMat>(
+      7, {{0, 1, 2}, {1, 2, 2}, {0, 2, 2}, {2, 3, 0.5}, {3, 4, 3}, {4, 5, 3},
+          {3, 5, 3}, {5, 5, 1}});
+  typename louvain_t::louvain_handle handle;
+  auto comm = louvain_t::detect(handle, A);
+  EXPECT_EQ(handle.num_communities, 3);
+  const double q = verify_communities(A, comm, handle.num_communities);
+  EXPECT_NEAR(q, handle.modularity, 1e-10);
+  auto hcomm = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), comm);
+  EXPECT_EQ(hcomm(0), hcomm(1));
+  EXPECT_EQ(hcomm(0), hcomm(2));
+  EXPECT_EQ(hcomm(3), hcomm(4));
+  EXPECT_EQ(hcomm(3), hcomm(5));
+  EXPECT_NE(hcomm(0), hcomm(3));
+  EXPECT_NE(hcomm(6), hcomm(0));
+  EXPECT_NE(hcomm(6), hcomm(3));
+
+  // no edges: every vertex is its own community
+  crsMat empty = louvain_graph<crsMat>(4, {});
+  comm         = louvain_t::detect(handle, empty);
+  EXPECT_EQ(handle.num_communities, 4);
+  EXPECT_EQ(handle.modularity, 0);
+}
+
+#define EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)                     \
+  TEST_F(TestCategory,                                                    \
+         graph##_##louvain##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    test_louvain_ring_of_cliques<SCALAR, ORDINAL, OFFSET, DEVICE>(8, 6);  \
+    test_louvain_ring_of_cliques<SCALAR, ORDINAL, OFFSET, DEVICE>(12, 5); \
+    test_louvain_small<SCALAR, ORDINAL, OFFSET, DEVICE>();                \
+  }
+
+// FIXME_SYCL
+#ifndef KOKKOS_ENABLE_SYCL
+#if (defined(KOKKOSKERNELS_INST_DOUBLE) &&      \
+     defined(KOKKOSKERNELS_INST_ORDINAL_INT) && \
+     defined(KOKKOSKERNELS_INST_OFFSET_INT)) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&        \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int, int, TestDevice)
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_DOUBLE) &&          \
+     defined(KOKKOSKERNELS_INST_ORDINAL_INT64_T) && \
+     defined(KOKKOSKERNELS_INST_OFFSET_INT)) ||     \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&            \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int64_t, int, TestDevice)
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_DOUBLE) &&         \
+     defined(KOKKOSKERNELS_INST_ORDINAL_INT) &&    \
+     defined(KOKKOSKERNELS_INST_OFFSET_SIZE_T)) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&           \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int, size_t, TestDevice)
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_DOUBLE) &&          \
+     defined(KOKKOSKERNELS_INST_ORDINAL_INT64_T) && \
+     defined(KOKKOSKERNELS_INST_OFFSET_SIZE_T)) ||  \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&            \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int64_t, size_t, TestDevice)
+#endif
+
+#endif
+
+#undef EXECUTE_TEST
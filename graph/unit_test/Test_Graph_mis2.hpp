@@ -15,6 +15,7 @@
 //@HEADER
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <random>
 #include <Kokkos_Core.hpp>
 
@@ -123,6 +124,118 @@ void test_mis2(lno_t numVerts, size_type nnz, lno_t bandwidth,
   }
 }
 
+template <typename scalar_unused, typename lno_t, typename size_type,
+          typename device>
+void test_mis2_priorities(lno_t numVerts, size_type nnz, lno_t bandwidth,
+                          lno_t row_size_variance) {
+  using execution_space = typename device::execution_space;
+  using crsMat =
+      KokkosSparse::CrsMatrix<double, lno_t, device, void, size_type>;
+  using graph_type   = typename crsMat::StaticCrsGraphType;
+  using c_rowmap_t   = typename graph_type::row_map_type;
+  using c_entries_t  = typename graph_type::entries_type;
+  using rowmap_t     = typename c_rowmap_t::non_const_type;
+  using entries_t    = typename c_entries_t::non_const_type;
+  using priorities_t = Kokkos::View<double*, device>;
+  crsMat A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat>(
+      numVerts, numVerts, nnz, row_size_variance, bandwidth);
+  auto G = A.graph;
+  rowmap_t symRowmap;
+  entries_t symEntries;
+  KokkosKernels::Impl::symmetrize_graph_symbolic_hashmap<
+      c_rowmap_t, c_entries_t, rowmap_t, entries_t, execution_space>(
+      numVerts, G.row_map, G.entries, symRowmap, symEntries);
+  auto rowmapHost =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), symRowmap);
+  auto entriesHost =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), symEntries);
+  // Random priorities, with a unique maximum which must always be in the set
+  std::mt19937 gen(61);
+  std::uniform_real_distribution<double> priorityDist(0.0, 1.0);
+  priorities_t priorities("priorities", numVerts);
+  auto prioritiesHost = Kokkos::create_mirror_view(priorities);
+  for (lno_t i = 0; i < numVerts; i++) prioritiesHost(i) = priorityDist(gen);
+  lno_t best           = numVerts / 3;
+  prioritiesHost(best) = 2.0;
+  Kokkos::deep_copy(priorities, prioritiesHost);
+  std::vector<MIS2_Algorithm> algos = {MIS2_FAST, MIS2_QUALITY};
+  for (auto algo : algos) {
+    auto mis =
+        KokkosGraph::graph_d2_mis<device, rowmap_t, entries_t, priorities_t>(
+            symRowmap, symEntries, priorities, algo);
+    auto misHost =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), mis);
+    bool success = Test::verifyD2MIS<lno_t, size_type, decltype(rowmapHost),
+                                     decltype(entriesHost), decltype(misHost)>(
+        numVerts, rowmapHost, entriesHost, misHost);
+    EXPECT_TRUE(success) << "Dist-2 MIS (algo " << (int)algo
+                         << ") with priorities produced invalid set.";
+    bool hasBest = false;
+    for (size_t i = 0; i < misHost.extent(0); i++)
+      if (misHost(i) == best) hasBest = true;
+    EXPECT_TRUE(hasBest) << "Dist-2 MIS (algo " << (int)algo
+                         << ") doesn't contain the highest priority vertex.";
+  }
+}
+
+template <typename scalar_unused, typename lno_t, typename size_type,
+          typename device>
+void test_mis2_weighted_aggregation(lno_t numVerts, size_type nnz,
+                                    lno_t bandwidth, lno_t row_size_variance) {
+  using execution_space = typename device::execution_space;
+  using crsMat =
+      KokkosSparse::CrsMatrix<double, lno_t, device, void, size_type>;
+  using graph_type  = typename crsMat::StaticCrsGraphType;
+  using c_rowmap_t  = typename graph_type::row_map_type;
+  using c_entries_t = typename graph_type::entries_type;
+  using rowmap_t    = typename c_rowmap_t::non_const_type;
+  using entries_t   = typename c_entries_t::non_const_type;
+  using labels_t    = entries_t;
+  using weights_t   = Kokkos::View<double*, device>;
+  crsMat A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat>(
+      numVerts, numVerts, nnz, row_size_variance, bandwidth);
+  auto G = A.graph;
+  rowmap_t symRowmap;
+  entries_t symEntries;
+  KokkosKernels::Impl::symmetrize_graph_symbolic_hashmap<
+      c_rowmap_t, c_entries_t, rowmap_t, entries_t, execution_space>(
+      numVerts, G.row_map, G.entries, symRowmap, symEntries);
+  auto rowmapHost =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), symRowmap);
+  auto entriesHost =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), symEntries);
+  // Symmetric weights: edges within a block of consecutive vertices are
+  // strong, and edges between blocks are weak.
+  const lno_t blockSize = 10;
+  weights_t weights("weights", symEntries.extent(0));
+  auto weightsHost = Kokkos::create_mirror_view(weights);
+  for (lno_t i = 0; i < numVerts; i++) {
+    for (size_type j = rowmapHost(i); j < rowmapHost(i + 1); j++) {
+      lno_t nei      = entriesHost(j);
+      weightsHost(j) = (nei / blockSize == i / blockSize) ? 1.0 : 0.01;
+    }
+  }
+  Kokkos::deep_copy(weights, weightsHost);
+  lno_t numAggs = 0;
+  labels_t labels =
+      KokkosGraph::graph_mis2_aggregate<device, rowmap_t, entries_t,
+                                        weights_t>(
+          symRowmap, symEntries, weights, 0.5, numAggs);
+  auto labelsHost =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), labels);
+  EXPECT_TRUE(numAggs >= (numVerts + blockSize - 1) / blockSize &&
+              numAggs <= numVerts);
+  // Aggregates only grow through strong edges, so each is within a block
+  std::vector<lno_t> aggBlock(numAggs, -1);
+  for (lno_t i = 0; i < numVerts; i++) {
+    lno_t agg = labelsHost(i);
+    ASSERT_TRUE(0 <= agg && agg < numAggs);
+    if (aggBlock[agg] == -1) aggBlock[agg] = i / blockSize;
+    EXPECT_EQ(aggBlock[agg], i / blockSize)
+        << "aggregate " << agg << " contains a weak edge";
+  }
+}
+
 template <typename scalar_unused, typename lno_t, typename size_type,
           typename device>
 void test_mis2_coarsening(lno_t numVerts, size_type nnz, lno_t bandwidth,
@@ -212,6 +325,45 @@ void test_mis2_coarsening(lno_t numVerts, size_type nnz, lno_t bandwidth,
         it++;
       }
     }
+    // Coarsen edge values through the entry map of the compressed graph: each
+    // coarse value is the sum of the fine values between the two clusters
+    using entry_map_t = Kokkos::View<size_type*, device>;
+    using values_t    = Kokkos::View<double*, device>;
+    entry_map_t entryMap;
+    KokkosGraph::Experimental::graph_explicit_coarsen_entry_map<
+        device, rowmap_t, entries_t, labels_t, rowmap_t, entries_t,
+        entry_map_t>(symRowmap, symEntries, labels, coarseRowmapC,
+                     coarseEntriesC, entryMap);
+    EXPECT_EQ(entryMap.extent(0), symEntries.extent(0));
+    values_t fineValues("fine values", symEntries.extent(0));
+    auto fineValuesHost = Kokkos::create_mirror_view(fineValues);
+    for (size_t j = 0; j < fineValuesHost.extent(0); j++)
+      fineValuesHost(j) = 1 + j % 3;
+    Kokkos::deep_copy(fineValues, fineValuesHost);
+    values_t coarseValues("coarse values", coarseEntriesC.extent(0));
+    KokkosGraph::Experimental::graph_explicit_coarsen_values<device>(
+        entryMap, fineValues, coarseValues);
+    auto coarseValuesHost =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), coarseValues);
+    std::vector<double> expectedValues(coarseEntriesC.extent(0), 0);
+    for (lno_t i = 0; i < numVerts; i++) {
+      const lno_t cluster = labelsHost(i);
+      for (size_type j = rowmapHost(i); j < rowmapHost(i + 1); j++) {
+        const lno_t nei = entriesHost(j);
+        if (nei >= numVerts) continue;
+        const lno_t neiCluster = labelsHost(nei);
+        if (neiCluster == cluster) continue;
+        const lno_t* rowBegin = hostEntriesC.data() + hostRowmapC(cluster);
+        const lno_t* rowEnd   = hostEntriesC.data() + hostRowmapC(cluster + 1);
+        const lno_t* pos      = std::lower_bound(rowBegin, rowEnd, neiCluster);
+        ASSERT_TRUE(pos != rowEnd && *pos == neiCluster);
+        expectedValues[pos - hostEntriesC.data()] += fineValuesHost(j);
+      }
+    }
+    for (size_t k = 0; k < expectedValues.size(); k++) {
+      EXPECT_EQ(coarseValuesHost(k), expectedValues[k])
+          << "coarse entry " << k << " has the wrong coarsened value";
+    }
   }
 }
 
@@ -255,6 +407,9 @@ void test_mis2_coarsening_zero_rows() {
     test_mis2<SCALAR, ORDINAL, OFFSET, DEVICE>(5000, 5000 * 20, 1000, 10);            \
     test_mis2<SCALAR, ORDINAL, OFFSET, DEVICE>(50, 50 * 10, 40, 10);                  \
     test_mis2<SCALAR, ORDINAL, OFFSET, DEVICE>(5, 5 * 3, 5, 0);                       \
+    test_mis2_priorities<SCALAR, ORDINAL, OFFSET, DEVICE>(5000, 5000 * 20, 1000,      \
+                                                          10);                        \
+    test_mis2_priorities<SCALAR, ORDINAL, OFFSET, DEVICE>(50, 50 * 10, 40, 10);       \
   }                                                                                   \
   TEST_F(                                                                             \
       TestCategory,                                                                   \
@@ -267,6 +422,10 @@ void test_mis2_coarsening_zero_rows() {
                                                           10);                        \
     test_mis2_coarsening<SCALAR, ORDINAL, OFFSET, DEVICE>(5, 5 * 3, 5, 0);            \
     test_mis2_coarsening_zero_rows<SCALAR, ORDINAL, OFFSET, DEVICE>();                \
+    test_mis2_weighted_aggregation<SCALAR, ORDINAL, OFFSET, DEVICE>(5000, 5000 * 20,  \
+                                                                    1000, 10);        \
+    test_mis2_weighted_aggregation<SCALAR, ORDINAL, OFFSET, DEVICE>(50, 50 * 10, 40,  \
+                                                                    10);              \
   }
 
 #if defined(KOKKOSKERNELS_INST_DOUBLE)
@@ -0,0 +1,204 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+
+#include "KokkosGraph_PageRank.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+// Sequential power iteration, teleporting to the normalized seed (uniform if
+// seed is empty), to a tight tolerance
+template <typename lno_t>
+std::vector<double> pagerank_reference(
+    const std::vector<std::vector<lno_t>>& adj, std::vector<double> seed,
+    double damping) {
+  lno_t numVerts = adj.size();
+  if (seed.empty()) seed.assign(numVerts, 1.0);
+  double seedSum = 0;
+  for (double s : seed) seedSum += s;
+  for (double& s : seed) s /= seedSum;
+  std::vector<double> ranks(seed), next(numVerts);
+  for (int iter = 0; iter < 1000; iter++) {
+    double dangling = 0;
+    for (lno_t u = 0; u < numVerts; u++)
+      if (adj[u].empty()) dangling += ranks[u];
+    for (lno_t v = 0; v < numVerts; v++)
+      next[v] = (damping * dangling + 1 - damping) * seed[v];
+    for (lno_t u = 0; u < numVerts; u++) {
+      for (lno_t v : adj[u]) next[v] += damping * ranks[u] / adj[u].size();
+    }
+    double diff = 0;
+    for (lno_t v = 0; v < numVerts; v++) diff += std::fabs(next[v] - ranks[v]);
+    ranks.swap(next);
+    if (diff < 1e-13) break;
+  }
+  return ranks;
+}
+
+// Random directed graph, where every tenth vertex is dangling. If symmetric,
+// also add the reverse of each edge (so that only isolated vertices are
+// dangling).
+template <typename rowmap_t, typename entries_t, typename lno_t>
+std::vector<std::vector<lno_t>> pagerank_random_graph(lno_t numVerts,
+                                                      lno_t avgDegree,
+                                                      bool symmetric,
+                                                      rowmap_t& rowmapView,
+                                                      entries_t& entriesView) {
+  std::mt19937 gen(1234);
+  std::uniform_int_distribution<lno_t> vertDist(0, numVerts - 1);
+  std::vector<std::vector<lno_t>> adj(numVerts);
+  for (lno_t u = 0; u < numVerts; u++) {
+    if (u % 10 == 3) continue;
+    for (lno_t e = 0; e < avgDegree; e++) {
+      lno_t v = vertDist(gen);
+      adj[u].push_back(v);
+      if (symmetric && v != u) adj[v].push_back(u);
+    }
+  }
+  size_t nnz = 0;
+  for (const auto& row : adj) nnz += row.size();
+  rowmapView  = rowmap_t("Rowmap", numVerts + 1);
+  entriesView = entries_t("Entries", nnz);
+  auto rowmapHost  = Kokkos::create_mirror_view(rowmapView);
+  auto entriesHost = Kokkos::create_mirror_view(entriesView);
+  size_t pos       = 0;
+  for (lno_t u = 0; u < numVerts; u++) {
+    rowmapHost(u) = pos;
+    for (lno_t v : adj[u]) entriesHost(pos++) = v;
+  }
+  rowmapHost(numVerts) = pos;
+  Kokkos::deep_copy(rowmapView, rowmapHost);
+  Kokkos::deep_copy(entriesView, entriesHost);
+  return adj;
+}
+
+template <typename lno_t, typename size_type, typename device>
+void test_pagerank(lno_t numVerts, lno_t avgDegree, bool symmetric) {
+  typedef
+      typename KokkosSparse::CrsMatrix<double, lno_t, device, void, size_type>
+          crsMat_t;
+  typedef typename crsMat_t::StaticCrsGraphType graph_t;
+  typedef typename graph_t::row_map_type::non_const_type rowmap_t;
+  typedef typename graph_t::entries_type::non_const_type entries_t;
+  typedef Kokkos::View<double*, device> scores_t;
+  rowmap_t rowmap;
+  entries_t entries;
+  auto adj = pagerank_random_graph(numVerts, avgDegree, symmetric, rowmap,
+                                   entries);
+  scores_t scores("Scores", numVerts);
+  int iters = KokkosGraph::pagerank<device>(rowmap, entries, scores, 0.85,
+                                            1e-12, 500, symmetric);
+  EXPECT_LT(iters, 500);
+  auto reference  = pagerank_reference(adj, std::vector<double>(), 0.85);
+  auto scoresHost = Kokkos::create_mirror_view(scores);
+  Kokkos::deep_copy(scoresHost, scores);
+  double sum = 0;
+  for (lno_t v = 0; v < numVerts; v++) {
+    sum += scoresHost(v);
+    ASSERT_NEAR(scoresHost(v), reference[v], 1e-9) << "vertex " << v;
+  }
+  EXPECT_NEAR(sum, 1.0, 1e-9);
+}
+
+template <typename lno_t, typename size_type, typename device>
+void test_personalized_pagerank(lno_t numVerts, lno_t avgDegree,
+                                lno_t numQueries) {
+  typedef
+      typename KokkosSparse::CrsMatrix<double, lno_t, device, void, size_type>
+          crsMat_t;
+  typedef typename crsMat_t::StaticCrsGraphType graph_t;
+  typedef typename graph_t::row_map_type::non_const_type rowmap_t;
+  typedef typename graph_t::entries_type::non_const_type entries_t;
+  typedef Kokkos::View<double**, Kokkos::LayoutLeft, device> multivector_t;
+  rowmap_t rowmap;
+  entries_t entries;
+  auto adj =
+      pagerank_random_graph(numVerts, avgDegree, false, rowmap, entries);
+  // Each query seeds a few vertices, with unnormalized weights
+  std::mt19937 gen(99);
+  std::uniform_int_distribution<lno_t> vertDist(0, numVerts - 1);
+  multivector_t seeds("Seeds", numVerts, numQueries);
+  multivector_t scores("Scores", numVerts, numQueries);
+  auto seedsHost = Kokkos::create_mirror_view(seeds);
+  for (lno_t q = 0; q < numQueries; q++) {
+    for (lno_t k = 0; k <= q % 3; k++) seedsHost(vertDist(gen), q) += k + 1;
+  }
+  Kokkos::deep_copy(seeds, seedsHost);
+  int iters = KokkosGraph::personalized_pagerank<device>(
+      rowmap, entries, seeds, scores, 0.85, 1e-12, 500);
+  EXPECT_LT(iters, 500);
+  auto scoresHost = Kokkos::create_mirror_view(scores);
+  Kokkos::deep_copy(scoresHost, scores);
+  for (lno_t q = 0; q < numQueries; q++) {
+    std::vector<double> seed(numVerts);
+    for (lno_t v = 0; v < numVerts; v++) seed[v] = seedsHost(v, q);
+    auto reference = pagerank_reference(adj, seed, 0.85);
+    for (lno_t v = 0; v < numVerts; v++)
+      ASSERT_NEAR(scoresHost(v, q), reference[v], 1e-9)
+          << "query " << q << ", vertex " << v;
+  }
+}
+
+#define EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)                       \
+  TEST_F(TestCategory,                                                      \
+         graph##_##pagerank##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    test_pagerank<ORDINAL, OFFSET, DEVICE>(1, 0, false);                    \
+    test_pagerank<ORDINAL, OFFSET, DEVICE>(100, 3, false);                  \
+    test_pagerank<ORDINAL, OFFSET, DEVICE>(100, 3, true);                   \
+    test_pagerank<ORDINAL, OFFSET, DEVICE>(5000, 8, false);                 \
+    test_pagerank<ORDINAL, OFFSET, DEVICE>(5000, 8, true);                  \
+  }                                                                         \
+  TEST_F(TestCategory,                                                      \
+         graph##_##personalized_pagerank##_##SCALAR##_##ORDINAL##_##OFFSET  \
+             ##_##DEVICE) {                                                 \
+    test_personalized_pagerank<ORDINAL, OFFSET, DEVICE>(50, 3, 5);          \
+    test_personalized_pagerank<ORDINAL, OFFSET, DEVICE>(500, 6, 70);        \
+  }
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT) && \
+     defined(KOKKOSKERNELS_INST_OFFSET_INT)) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&        \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int, int, TestDevice)
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT64_T) && \
+     defined(KOKKOSKERNELS_INST_OFFSET_INT)) ||     \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&            \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int64_t, int, TestDevice)
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT) &&    \
+     defined(KOKKOSKERNELS_INST_OFFSET_SIZE_T)) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&           \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int, size_t, TestDevice)
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT64_T) && \
+     defined(KOKKOSKERNELS_INST_OFFSET_SIZE_T)) ||  \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&            \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int64_t, size_t, TestDevice)
+#endif
+
+#undef EXECUTE_TEST
@@ -0,0 +1,177 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <vector>
+#include <Kokkos_Core.hpp>
+
+#include "KokkosGraph_Partition.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosKernels_IOUtils.hpp"
+#include "KokkosKernels_Utils.hpp"
+#include "KokkosSparse_IOUtils.hpp"
+
+using namespace KokkosGraph;
+using namespace KokkosGraph::Experimental;
+
+// Checks that parts is a partition of A into num_parts parts no heavier than
+// cap, that the handle reports its edge cut, and returns the cut on host
+template <class crsMat, class part_view_t>
+double verify_partition(crsMat A, part_view_t parts,
+                        typename crsMat::ordinal_type num_parts,
+                        typename crsMat::ordinal_type cap,
+                        double reported_cut) {
+  using ordinal_t = typename crsMat::ordinal_type;
+  using edge_t    = typename crsMat::size_type;
+  auto rowmap =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.row_map);
+  auto entries =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.entries);
+  auto values =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.values);
+  auto hparts = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), parts);
+  EXPECT_EQ(static_cast<ordinal_t>(hparts.extent(0)), A.numRows());
+  std::vector<ordinal_t> weights(num_parts, 0);
+  for (ordinal_t i = 0; i < A.numRows(); i++) {
+    EXPECT_TRUE(hparts(i) >= 0 && hparts(i) < num_parts)
+        << "vertex " << i << " has invalid part " << hparts(i);
+    if (hparts(i) >= 0 && hparts(i) < num_parts) weights[hparts(i)]++;
+  }
+  for (ordinal_t p = 0; p < num_parts; p++) {
+    EXPECT_LE(weights[p], cap) << "part " << p << " is too heavy";
+  }
+  double cut = 0;
+  for (ordinal_t i = 0; i < A.numRows(); i++) {
+    for (edge_t j = rowmap(i); j < rowmap(i + 1); j++) {
+      if (hparts(entries(j)) != hparts(i)) cut += values(j);
+    }
+  }
+  cut /= 2;
+  EXPECT_NEAR(cut, reported_cut, 1e-8 * (1 + cut));
+  return cut;
+}
+
+template <typename scalar, typename lno_t, typename size_type, typename device>
+void test_partition_grid(lno_t num_parts) {
+  using crsMat =
+      KokkosSparse::CrsMatrix<scalar, lno_t, device, void, size_type>;
+  using partitioner_t = partitioner<crsMat>;
+  // 200 x 300 grid, from Test_Graph_coarsen.hpp
+  crsMat A = gen_grid<crsMat>();
+  typename partitioner_t::partition_handle handle;
+  handle.num_parts = num_parts;
+  auto parts       = partitioner_t::partition(handle, A);
+
+  const lno_t n   = A.numRows();
+  const lno_t cap = std::max<lno_t>(
+      (n + num_parts - 1) / num_parts,
+      static_cast<lno_t>((1 + handle.imbalance) * n / num_parts));
+  double cut = verify_partition(A, parts, num_parts, cap,
+                                static_cast<double>(handle.edge_cut));
+  EXPECT_LE(handle.max_part_weight, cap);
+  // a random partition cuts about (1 - 1/k) of the edges; splitting the grid
+  // in strips cuts (k - 1) * 200, about 0.17% of the edges per strip
+  EXPECT_LT(cut, 0.01 * num_parts * A.nnz() / 2)
+      << "edge cut " << cut << " for " << num_parts << " parts";
+}
+
+template <typename scalar, typename lno_t, typename size_type, typename device>
+void test_partition_random(lno_t numVerts, size_type nnz, lno_t bandwidth,
+                           lno_t row_size_variance, lno_t num_parts) {
+  using execution_space = typename device::execution_space;
+  using crsMat =
+      KokkosSparse::CrsMatrix<scalar, lno_t, device, void, size_type>;
+  using graph_type    = typename crsMat::StaticCrsGraphType;
+  using c_rowmap_t    = typename graph_type::row_map_type;
+  using c_entries_t   = typename graph_type::entries_type;
+  using rowmap_t      = typename c_rowmap_t::non_const_type;
+  using entries_t     = typename c_entries_t::non_const_type;
+  using svt           = typename crsMat::values_type;
+  using partitioner_t = partitioner<crsMat>;
+  crsMat A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat>(
+      numVerts, numVerts, nnz, row_size_variance, bandwidth);
+  // Symmetrize the graph
+  rowmap_t symRowmap;
+  entries_t symEntries;
+  KokkosKernels::Impl::symmetrize_graph_symbolic_hashmap<
+      c_rowmap_t, c_entries_t, rowmap_t, entries_t, execution_space>(
+      numVerts, A.graph.row_map, A.graph.entries, symRowmap, symEntries);
+  graph_type GS(symEntries, symRowmap);
+  svt symValues("sym values", symEntries.extent(0));
+  Kokkos::deep_copy(symValues, static_cast<scalar>(1));
+  crsMat AS("A symmetric", numVerts, symValues, GS);
+
+  typename partitioner_t::partition_handle handle;
+  handle.num_parts = num_parts;
+  auto parts       = partitioner_t::partition(handle, AS);
+  const lno_t cap  = std::max<lno_t>(
+      (numVerts + num_parts - 1) / num_parts,
+      static_cast<lno_t>((1 + handle.imbalance) * numVerts / num_parts));
+  verify_partition(AS, parts, num_parts, cap,
+                   static_cast<double>(handle.edge_cut));
+}
+
+#define EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)                                  \
+  TEST_F(                                                                              \
+      TestCategory,                                                                    \
+      graph##_##grid_graph_partition##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) {   \
+    test_partition_grid<SCALAR, ORDINAL, OFFSET, DEVICE>(2);                           \
+    test_partition_grid<SCALAR, ORDINAL, OFFSET, DEVICE>(4);                           \
+    test_partition_grid<SCALAR, ORDINAL, OFFSET, DEVICE>(7);                           \
+  }                                                                                    \
+  TEST_F(                                                                              \
+      TestCategory,                                                                    \
+      graph##_##random_graph_partition##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    test_partition_random<SCALAR, ORDINAL, OFFSET, DEVICE>(5000, 5000 * 20,            \
+                                                           1000, 10, 8);               \
+    test_partition_random<SCALAR, ORDINAL, OFFSET, DEVICE>(50, 50 * 10, 40,            \
+                                                           10, 3);                     \
+  }
+
+// FIXME_SYCL
+#ifndef KOKKOS_ENABLE_SYCL
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT) && \
+     defined(KOKKOSKERNELS_INST_OFFSET_INT)) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&        \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int, int, TestDevice)
+#endif
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT64_T) && \
+     defined(KOKKOSKERNELS_INST_OFFSET_INT)) ||     \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&            \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int64_t, int, TestDevice)
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT) &&    \
+     defined(KOKKOSKERNELS_INST_OFFSET_SIZE_T)) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&           \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int, size_t, TestDevice)
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT64_T) && \
+     defined(KOKKOSKERNELS_INST_OFFSET_SIZE_T)) ||  \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&            \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int64_t, size_t, TestDevice)
+#endif
+#endif
+
+#undef EXECUTE_TEST
@@ -139,12 +139,83 @@ void test_rcm(lno_t gridX, lno_t gridY, lno_t gridZ) {
   EXPECT_LE(rcmBW, origBW);
 }
 
+// On paths, the Cuthill-McKee order has no ties, so the parallel RCM must
+// give the same labels as the serial one
+template <typename lno_t, typename size_type, typename device>
+void test_rcm_vs_serial(lno_t gridX) {
+  typedef
+      typename KokkosSparse::CrsMatrix<double, lno_t, device, void, size_type>
+          crsMat_t;
+  typedef typename crsMat_t::StaticCrsGraphType graph_t;
+  typedef typename graph_t::row_map_type rowmap_t;
+  typedef typename graph_t::entries_type entries_t;
+  typename rowmap_t::non_const_type rowmap;
+  typename entries_t::non_const_type entries;
+  generate7pt(rowmap, entries, gridX, 1, 1);
+  auto rcm = KokkosGraph::Experimental::graph_rcm<device, rowmap_t, entries_t>(
+      rowmap, entries);
+  KokkosGraph::Experimental::Impl::SerialRCM<rowmap_t, entries_t,
+                                             decltype(rcm)>
+      serial(rowmap, entries);
+  auto serialRcm = serial.rcm();
+  auto rcmHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), rcm);
+  auto serialRcmHost =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), serialRcm);
+  for (lno_t i = 0; i < gridX; i++) EXPECT_EQ(rcmHost(i), serialRcmHost(i));
+}
+
+// Mostly singleton components (empty rows and rows with only a diagonal),
+// with pairs of connected vertices in between
+template <typename lno_t, typename size_type, typename device>
+void test_rcm_isolated(lno_t numVerts) {
+  typedef
+      typename KokkosSparse::CrsMatrix<double, lno_t, device, void, size_type>
+          crsMat_t;
+  typedef typename crsMat_t::StaticCrsGraphType graph_t;
+  typedef typename graph_t::row_map_type rowmap_t;
+  typedef typename graph_t::entries_type entries_t;
+  typename rowmap_t::non_const_type rowmap("Rowmap", numVerts + 1);
+  auto rowmapHost = Kokkos::create_mirror_view(rowmap);
+  std::vector<lno_t> entriesVec;
+  for (lno_t i = 0; i < numVerts; i++) {
+    rowmapHost(i) = entriesVec.size();
+    // every 16th pair of vertices is connected
+    const lno_t pair = i ^ 1;
+    if ((i / 2) % 16 == 0 && pair < numVerts) entriesVec.push_back(pair);
+    if (i % 3 == 0) entriesVec.push_back(i);
+  }
+  rowmapHost(numVerts) = entriesVec.size();
+  typename entries_t::non_const_type entries("Entries", entriesVec.size());
+  auto entriesHost = Kokkos::create_mirror_view(entries);
+  for (size_t j = 0; j < entriesVec.size(); j++) entriesHost(j) = entriesVec[j];
+  Kokkos::deep_copy(rowmap, rowmapHost);
+  Kokkos::deep_copy(entries, entriesHost);
+  auto rcm = KokkosGraph::Experimental::graph_rcm<device, rowmap_t, entries_t>(
+      rowmap, entries);
+  auto rcmHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), rcm);
+  decltype(rcmHost) rcmPermHost(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "RCMPerm"), numVerts);
+  std::vector<int> counts(numVerts);
+  for (lno_t i = 0; i < numVerts; i++) {
+    lno_t orig = rcmHost(i);
+    ASSERT_GE(orig, 0);
+    ASSERT_LT(orig, numVerts);
+    counts[orig]++;
+    rcmPermHost(orig) = i;
+  }
+  for (lno_t i = 0; i < numVerts; i++) ASSERT_EQ(counts[i], 1);
+  // the pairs end up next to each other
+  EXPECT_LE(maxBandwidth(rowmapHost, entriesHost, rcmHost, rcmPermHost), 1);
+}
+
 #define EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)                  \
   TEST_F(TestCategory,                                                 \
          graph##_##rcm##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
     test_rcm<ORDINAL, OFFSET, DEVICE>(6, 3, 3);                        \
     test_rcm<ORDINAL, OFFSET, DEVICE>(20, 20, 20);                     \
     test_rcm<ORDINAL, OFFSET, DEVICE>(100, 100, 1);                    \
+    test_rcm_vs_serial<ORDINAL, OFFSET, DEVICE>(50);                   \
+    test_rcm_isolated<ORDINAL, OFFSET, DEVICE>(10000);                 \
   }
 
 #if (defined(KOKKOSKERNELS_INST_ORDINAL_INT) && \
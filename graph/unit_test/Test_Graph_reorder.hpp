@@ -0,0 +1,235 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+
+#include "KokkosGraph_Reorder.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_PermuteCrs.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <set>
+#include <vector>
+
+// Symmetric 2D 5-point stencil on a gridX x gridY grid, with a few hubs
+// connected to random vertices, and the vertex IDs shuffled
+template <typename lno_t>
+std::vector<std::set<lno_t>> reorder_test_graph(lno_t gridX, lno_t gridY,
+                                                lno_t numHubs) {
+  lno_t numVerts = gridX * gridY;
+  std::mt19937 gen(numVerts);
+  std::vector<lno_t> shuffle(numVerts);
+  std::iota(shuffle.begin(), shuffle.end(), 0);
+  std::shuffle(shuffle.begin(), shuffle.end(), gen);
+  std::vector<std::set<lno_t>> adj(numVerts);
+  auto addEdge = [&](lno_t u, lno_t v) {
+    if (u == v) return;
+    adj[shuffle[u]].insert(shuffle[v]);
+    adj[shuffle[v]].insert(shuffle[u]);
+  };
+  for (lno_t j = 0; j < gridY; j++) {
+    for (lno_t i = 0; i < gridX; i++) {
+      if (i + 1 < gridX) addEdge(j * gridX + i, j * gridX + i + 1);
+      if (j + 1 < gridY) addEdge(j * gridX + i, (j + 1) * gridX + i);
+    }
+  }
+  std::uniform_int_distribution<lno_t> vertDist(0, numVerts - 1);
+  for (lno_t h = 0; h < numHubs; h++) {
+    lno_t hub = vertDist(gen);
+    for (lno_t k = 0; k < 10 * (h + 1); k++) addEdge(hub, vertDist(gen));
+  }
+  return adj;
+}
+
+template <typename crsMat_t, typename lno_t>
+crsMat_t reorder_to_device(const std::vector<std::set<lno_t>>& adj) {
+  using rowmap_t  = typename crsMat_t::row_map_type::non_const_type;
+  using entries_t = typename crsMat_t::index_type::non_const_type;
+  using values_t  = typename crsMat_t::values_type::non_const_type;
+  lno_t numVerts  = adj.size();
+  size_t nnz      = 0;
+  for (const auto& row : adj) nnz += row.size();
+  rowmap_t rowmap("Rowmap", numVerts + 1);
+  entries_t entries("Entries", nnz);
+  values_t values("Values", nnz);
+  auto rowmapHost  = Kokkos::create_mirror_view(rowmap);
+  auto entriesHost = Kokkos::create_mirror_view(entries);
+  size_t pos       = 0;
+  for (lno_t v = 0; v < numVerts; v++) {
+    rowmapHost(v) = pos;
+    for (lno_t w : adj[v]) entriesHost(pos++) = w;
+  }
+  rowmapHost(numVerts) = pos;
+  Kokkos::deep_copy(rowmap, rowmapHost);
+  Kokkos::deep_copy(entries, entriesHost);
+  Kokkos::deep_copy(values, 1.0);
+  return crsMat_t("Graph", numVerts, numVerts, nnz, values, rowmap, entries);
+}
+
+// Check that labels is a permutation, and return the vertices in new order
+template <typename labels_t, typename lno_t>
+std::vector<lno_t> reorder_check_permutation(const labels_t& labels,
+                                             lno_t numVerts) {
+  auto labelsHost =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), labels);
+  EXPECT_EQ(labelsHost.extent(0), size_t(numVerts));
+  std::vector<lno_t> order(numVerts, -1);
+  for (lno_t v = 0; v < numVerts; v++) {
+    lno_t label = labelsHost(v);
+    EXPECT_TRUE(label >= 0 && label < numVerts);
+    if (label < 0 || label >= numVerts) continue;
+    EXPECT_EQ(order[label], -1) << "label " << label << " is repeated";
+    order[label] = v;
+  }
+  return order;
+}
+
+// Average |labels(u) - labels(v)| over the edges (u, v)
+template <typename lno_t>
+double reorder_edge_distance(const std::vector<std::set<lno_t>>& adj,
+                             const std::vector<lno_t>& order) {
+  std::vector<lno_t> label(order.size());
+  for (size_t i = 0; i < order.size(); i++) label[order[i]] = i;
+  double sum = 0, count = 0;
+  for (size_t u = 0; u < adj.size(); u++) {
+    for (lno_t v : adj[u]) {
+      sum += std::abs(double(label[u]) - double(label[v]));
+      count++;
+    }
+  }
+  return count ? sum / count : 0;
+}
+
+template <typename lno_t, typename size_type, typename device>
+void test_degree_orders(lno_t gridX, lno_t gridY, lno_t numHubs) {
+  typedef
+      typename KokkosSparse::CrsMatrix<double, lno_t, device, void, size_type>
+          crsMat_t;
+  auto adj          = reorder_test_graph(gridX, gridY, numHubs);
+  lno_t numVerts    = adj.size();
+  crsMat_t A        = reorder_to_device<crsMat_t>(adj);
+  auto degreeLabels = KokkosGraph::Experimental::graph_degree_order<device>(
+      A.graph.row_map, A.graph.entries);
+  auto order = reorder_check_permutation(degreeLabels, numVerts);
+  for (lno_t i = 1; i < numVerts; i++) {
+    size_t prev = adj[order[i - 1]].size(), cur = adj[order[i]].size();
+    ASSERT_TRUE(prev > cur || (prev == cur && order[i - 1] < order[i]));
+  }
+  auto hubLabels = KokkosGraph::Experimental::graph_hub_cluster_order<device>(
+      A.graph.row_map, A.graph.entries);
+  order = reorder_check_permutation(hubLabels, numVerts);
+  size_t nnz = 0;
+  for (const auto& row : adj) nnz += row.size();
+  auto isHub = [&](lno_t v) { return adj[v].size() * numVerts > nnz; };
+  for (lno_t i = 1; i < numVerts; i++) {
+    lno_t prev = order[i - 1], cur = order[i];
+    ASSERT_FALSE(isHub(cur) && !isHub(prev));
+    if (isHub(cur))
+      ASSERT_TRUE(adj[prev].size() > adj[cur].size() ||
+                  (adj[prev].size() == adj[cur].size() && prev < cur));
+    else if (!isHub(prev))
+      ASSERT_LT(prev, cur);
+  }
+}
+
+template <typename lno_t, typename size_type, typename device>
+void test_community_order(lno_t gridX, lno_t gridY) {
+  typedef
+      typename KokkosSparse::CrsMatrix<double, lno_t, device, void, size_type>
+          crsMat_t;
+  auto adj       = reorder_test_graph(gridX, gridY, lno_t(0));
+  lno_t numVerts = adj.size();
+  crsMat_t A     = reorder_to_device<crsMat_t>(adj);
+  auto labels    = KokkosGraph::Experimental::graph_community_order(A);
+  auto order     = reorder_check_permutation(labels, numVerts);
+  std::vector<lno_t> identity(numVerts);
+  std::iota(identity.begin(), identity.end(), 0);
+  // the vertex IDs are shuffled, so the original numbering has no locality
+  if (numVerts > 100) {
+    EXPECT_LT(reorder_edge_distance(adj, order),
+              0.5 * reorder_edge_distance(adj, identity));
+  }
+  // the reordered matrix has the same entries, relabeled
+  crsMat_t B = KokkosSparse::permute_crs_matrix(A, labels);
+  ASSERT_EQ(B.nnz(), A.nnz());
+  auto rowmapHost =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), B.graph.row_map);
+  auto entriesHost =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), B.graph.entries);
+  for (lno_t i = 0; i < numVerts; i++) {
+    ASSERT_EQ(size_t(rowmapHost(i + 1) - rowmapHost(i)),
+              adj[order[i]].size());
+    for (size_type j = rowmapHost(i); j < rowmapHost(i + 1); j++)
+      ASSERT_EQ(adj[order[i]].count(order[entriesHost(j)]), 1u);
+  }
+}
+
+#if !defined(KOKKOS_ENABLE_CUDA) || defined(KOKKOS_ENABLE_CUDA_LAMBDA)
+#define EXECUTE_COMMUNITY_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)                 \
+  TEST_F(                                                                       \
+      TestCategory,                                                             \
+      graph##_##community_order##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    test_community_order<ORDINAL, OFFSET, DEVICE>(1, 1);                        \
+    test_community_order<ORDINAL, OFFSET, DEVICE>(5, 4);                        \
+    test_community_order<ORDINAL, OFFSET, DEVICE>(60, 50);                      \
+  }
+#else
+#define EXECUTE_COMMUNITY_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)
+#endif
+
+#define EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)                           \
+  TEST_F(TestCategory,                                                          \
+         graph##_##degree_order##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    test_degree_orders<ORDINAL, OFFSET, DEVICE>(1, 1, 0);                       \
+    test_degree_orders<ORDINAL, OFFSET, DEVICE>(10, 10, 3);                     \
+    test_degree_orders<ORDINAL, OFFSET, DEVICE>(100, 80, 20);                   \
+  }                                                                             \
+  EXECUTE_COMMUNITY_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT) && \
+     defined(KOKKOSKERNELS_INST_OFFSET_INT)) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&        \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int, int, TestDevice)
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT64_T) && \
+     defined(KOKKOSKERNELS_INST_OFFSET_INT)) ||     \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&            \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int64_t, int, TestDevice)
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT) &&    \
+     defined(KOKKOSKERNELS_INST_OFFSET_SIZE_T)) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&           \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int, size_t, TestDevice)
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT64_T) && \
+     defined(KOKKOSKERNELS_INST_OFFSET_SIZE_T)) ||  \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&            \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int64_t, size_t, TestDevice)
+#endif
+
+#undef EXECUTE_TEST
+#undef EXECUTE_COMMUNITY_TEST
@@ -0,0 +1,172 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+
+#include "KokkosGraph_SSSP.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+
+#include <cmath>
+#include <functional>
+#include <queue>
+#include <random>
+#include <utility>
+#include <vector>
+
+// Random directed graph with weights in [0, maxWeight]; the last numIsolated
+// vertices have no in-edges
+template <typename crsMat_t>
+crsMat_t sssp_random_graph(int numVerts, int numIsolated, int maxDegree,
+                           double maxWeight) {
+  using size_type = typename crsMat_t::non_const_size_type;
+  using lno_t     = typename crsMat_t::non_const_ordinal_type;
+  using weight_t  = typename crsMat_t::non_const_value_type;
+  std::mt19937 gen(numVerts);
+  std::uniform_int_distribution<int> degreeDist(0, maxDegree);
+  std::uniform_int_distribution<lno_t> neighborDist(0,
+                                                    numVerts - numIsolated - 1);
+  std::uniform_real_distribution<double> weightDist(0, maxWeight);
+  std::vector<size_type> rowmap(numVerts + 1, 0);
+  std::vector<lno_t> entries;
+  std::vector<weight_t> weights;
+  for (int v = 0; v < numVerts; v++) {
+    const int degree = degreeDist(gen);
+    for (int k = 0; k < degree; k++) {
+      entries.push_back(neighborDist(gen));
+      weights.push_back(static_cast<weight_t>(weightDist(gen)));
+    }
+    rowmap[v + 1] = entries.size();
+  }
+  typename crsMat_t::row_map_type::non_const_type rowmapView("Rowmap",
+                                                             numVerts + 1);
+  typename crsMat_t::index_type::non_const_type entriesView("Entries",
+                                                            entries.size());
+  typename crsMat_t::values_type::non_const_type weightsView("Weights",
+                                                             weights.size());
+  auto rowmapHost  = Kokkos::create_mirror_view(rowmapView);
+  auto entriesHost = Kokkos::create_mirror_view(entriesView);
+  auto weightsHost = Kokkos::create_mirror_view(weightsView);
+  for (int v = 0; v <= numVerts; v++) rowmapHost(v) = rowmap[v];
+  for (size_t e = 0; e < entries.size(); e++) {
+    entriesHost(e) = entries[e];
+    weightsHost(e) = weights[e];
+  }
+  Kokkos::deep_copy(rowmapView, rowmapHost);
+  Kokkos::deep_copy(entriesView, entriesHost);
+  Kokkos::deep_copy(weightsView, weightsHost);
+  return crsMat_t("Graph", numVerts, numVerts, entries.size(), weightsView,
+                  rowmapView, entriesView);
+}
+
+template <typename weight_t, typename lno_t, typename size_type,
+          typename device>
+void test_sssp(int numVerts, int maxDegree, double maxWeight, lno_t source) {
+  using crsMat_t =
+      KokkosSparse::CrsMatrix<weight_t, lno_t, device, void, size_type>;
+  using WAT = Kokkos::ArithTraits<weight_t>;
+
+  const int numIsolated = 3;
+
+  crsMat_t G = sssp_random_graph<crsMat_t>(numVerts, numIsolated, maxDegree,
+                                           maxWeight);
+
+  // Reference distances from a serial Dijkstra
+  auto rowmapHost =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), G.graph.row_map);
+  auto entriesHost =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), G.graph.entries);
+  auto weightsHost =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), G.values);
+  using item_t = std::pair<weight_t, lno_t>;
+  std::vector<weight_t> refDist(numVerts, WAT::max());
+  std::priority_queue<item_t, std::vector<item_t>, std::greater<item_t>> pq;
+  refDist[source] = 0;
+  pq.push(item_t(0, source));
+  while (!pq.empty()) {
+    const item_t top = pq.top();
+    pq.pop();
+    const lno_t v = top.second;
+    if (top.first > refDist[v]) continue;
+    for (size_type j = rowmapHost(v); j < rowmapHost(v + 1); j++) {
+      const lno_t nei  = entriesHost(j);
+      const weight_t d = refDist[v] + weightsHost(j);
+      if (d < refDist[nei]) {
+        refDist[nei] = d;
+        pq.push(item_t(d, nei));
+      }
+    }
+  }
+
+  // Automatic delta, many small buckets and a single bucket (Bellman-Ford)
+  const weight_t deltas[3] = {0, static_cast<weight_t>(maxWeight / 50),
+                              static_cast<weight_t>(1e6)};
+  for (int p = 0; p < 3; p++) {
+    auto dist = KokkosGraph::Experimental::graph_sssp(G, source, deltas[p]);
+    auto distHost =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), dist);
+    for (int i = 0; i < numVerts; i++) {
+      if (refDist[i] == WAT::max())
+        ASSERT_EQ(distHost(i), WAT::max());
+      else
+        ASSERT_NEAR(distHost(i), refDist[i], 1e-12 * std::abs(refDist[i]));
+    }
+  }
+
+  EXPECT_THROW(KokkosGraph::Experimental::graph_sssp(G, lno_t(numVerts)),
+               std::invalid_argument);
+  Kokkos::deep_copy(Kokkos::subview(G.values, 0), weight_t(-1));
+  EXPECT_THROW(KokkosGraph::Experimental::graph_sssp(G, source),
+               std::invalid_argument);
+}
+
+#define EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)                   \
+  TEST_F(TestCategory,                                                  \
+         graph##_##sssp##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    test_sssp<double, ORDINAL, OFFSET, DEVICE>(10, 3, 1.0, 0);          \
+    test_sssp<double, ORDINAL, OFFSET, DEVICE>(5000, 8, 10.0, 17);      \
+    test_sssp<int, ORDINAL, OFFSET, DEVICE>(5000, 8, 100.0, 4321);      \
+  }
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT) && \
+     defined(KOKKOSKERNELS_INST_OFFSET_INT)) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&        \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int, int, TestDevice)
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT64_T) && \
+     defined(KOKKOSKERNELS_INST_OFFSET_INT)) ||     \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&            \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int64_t, int, TestDevice)
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT) &&    \
+     defined(KOKKOSKERNELS_INST_OFFSET_SIZE_T)) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&           \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int, size_t, TestDevice)
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT64_T) && \
+     defined(KOKKOSKERNELS_INST_OFFSET_SIZE_T)) ||  \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&            \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int64_t, size_t, TestDevice)
+#endif
+
+#undef EXECUTE_TEST
@@ -0,0 +1,213 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+
+#include "KokkosGraph_Triangle.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+
+#include <iterator>
+#include <random>
+#include <set>
+#include <vector>
+
+// Brute force per-vertex triangle counts of the graph adj
+template <typename lno_t>
+int64_t tri_update_reference(const std::vector<std::set<lno_t>>& adj,
+                             std::vector<int64_t>& counts) {
+  lno_t numVerts = adj.size();
+  counts.assign(numVerts, 0);
+  int64_t total = 0;
+  for (lno_t u = 0; u < numVerts; u++) {
+    for (lno_t v : adj[u]) {
+      if (v <= u) continue;
+      for (lno_t w : adj[v]) {
+        if (w <= v || !adj[u].count(w)) continue;
+        counts[u]++;
+        counts[v]++;
+        counts[w]++;
+        total++;
+      }
+    }
+  }
+  return total;
+}
+
+template <typename rowmap_t, typename entries_t, typename lno_t>
+void tri_update_to_device(const std::vector<std::set<lno_t>>& adj,
+                          rowmap_t& rowmapView, entries_t& entriesView) {
+  lno_t numVerts = adj.size();
+  size_t nnz     = 0;
+  for (const auto& row : adj) nnz += row.size();
+  rowmapView  = rowmap_t("Rowmap", numVerts + 1);
+  entriesView = entries_t("Entries", nnz);
+  auto rowmapHost  = Kokkos::create_mirror_view(rowmapView);
+  auto entriesHost = Kokkos::create_mirror_view(entriesView);
+  size_t pos       = 0;
+  for (lno_t v = 0; v < numVerts; v++) {
+    rowmapHost(v) = pos;
+    for (lno_t w : adj[v]) entriesHost(pos++) = w;
+  }
+  rowmapHost(numVerts) = pos;
+  Kokkos::deep_copy(rowmapView, rowmapHost);
+  Kokkos::deep_copy(entriesView, entriesHost);
+}
+
+template <typename lno_t, typename size_type, typename device>
+void test_triangle_count_update(lno_t numVerts, lno_t avgDegree,
+                                lno_t batchSize) {
+  typedef
+      typename KokkosSparse::CrsMatrix<double, lno_t, device, void, size_type>
+          crsMat_t;
+  typedef typename crsMat_t::StaticCrsGraphType graph_t;
+  typedef typename graph_t::row_map_type::non_const_type rowmap_t;
+  typedef typename graph_t::entries_type::non_const_type entries_t;
+  typedef Kokkos::View<int64_t*, device> counts_t;
+  std::mt19937 gen(4321);
+  std::uniform_int_distribution<lno_t> vertDist(0, numVerts - 1);
+  std::vector<std::set<lno_t>> adj(numVerts);
+  for (lno_t e = 0; e < numVerts * avgDegree / 2; e++) {
+    lno_t u = vertDist(gen);
+    lno_t v = vertDist(gen);
+    if (u == v) continue;
+    adj[u].insert(v);
+    adj[v].insert(u);
+  }
+  rowmap_t rowmap;
+  entries_t entries;
+  tri_update_to_device(adj, rowmap, entries);
+  counts_t counts("Counts", numVerts);
+  int64_t total = -1;
+  KokkosGraph::Experimental::triangle_count_vertices<device>(rowmap, entries,
+                                                            counts, total);
+  std::vector<int64_t> refCounts;
+  EXPECT_EQ(total, tri_update_reference(adj, refCounts));
+  auto countsHost = Kokkos::create_mirror_view(counts);
+  Kokkos::deep_copy(countsHost, counts);
+  for (lno_t v = 0; v < numVerts; v++) ASSERT_EQ(countsHost(v), refCounts[v]);
+
+  for (int batch = 0; batch < 4; batch++) {
+    // deletions: mostly existing edges, some missing ones and duplicates;
+    // insertions: new edges, with duplicates, self loops and existing edges
+    entries_t insSrc("Insert src", batchSize), insDst("Insert dst", batchSize);
+    entries_t delSrc("Delete src", batchSize), delDst("Delete dst", batchSize);
+    auto insSrcHost = Kokkos::create_mirror_view(insSrc);
+    auto insDstHost = Kokkos::create_mirror_view(insDst);
+    auto delSrcHost = Kokkos::create_mirror_view(delSrc);
+    auto delDstHost = Kokkos::create_mirror_view(delDst);
+    for (lno_t i = 0; i < batchSize; i++) {
+      lno_t u = vertDist(gen);
+      lno_t v = vertDist(gen);
+      if (i % 5 != 0 && !adj[u].empty()) {
+        auto it = adj[u].begin();
+        std::advance(it, gen() % adj[u].size());
+        v = *it;
+      }
+      if (i % 7 == 1 && i > 0) {
+        u = delDstHost(i - 1);
+        v = delSrcHost(i - 1);
+      }
+      delSrcHost(i) = u;
+      delDstHost(i) = v;
+      u             = vertDist(gen);
+      v             = i % 11 == 3 ? u : vertDist(gen);
+      if (i % 6 == 2 && i > 0) {
+        u = insSrcHost(i - 1);
+        v = insDstHost(i - 1);
+      }
+      insSrcHost(i) = u;
+      insDstHost(i) = v;
+    }
+    Kokkos::deep_copy(insSrc, insSrcHost);
+    Kokkos::deep_copy(insDst, insDstHost);
+    Kokkos::deep_copy(delSrc, delSrcHost);
+    Kokkos::deep_copy(delDst, delDstHost);
+    for (lno_t i = 0; i < batchSize; i++) {
+      adj[delSrcHost(i)].erase(delDstHost(i));
+      adj[delDstHost(i)].erase(delSrcHost(i));
+    }
+    for (lno_t i = 0; i < batchSize; i++) {
+      if (insSrcHost(i) == insDstHost(i)) continue;
+      adj[insSrcHost(i)].insert(insDstHost(i));
+      adj[insDstHost(i)].insert(insSrcHost(i));
+    }
+
+    rowmap_t newRowmap;
+    entries_t newEntries;
+    KokkosGraph::Experimental::triangle_count_update<device>(
+        rowmap, entries, insSrc, insDst, delSrc, delDst, newRowmap,
+        newEntries, counts, total);
+    EXPECT_EQ(total, tri_update_reference(adj, refCounts));
+    Kokkos::deep_copy(countsHost, counts);
+    for (lno_t v = 0; v < numVerts; v++)
+      ASSERT_EQ(countsHost(v), refCounts[v]);
+
+    // the updated graph
+    auto newRowmapHost =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), newRowmap);
+    auto newEntriesHost =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), newEntries);
+    ASSERT_EQ(newRowmapHost.extent(0), size_t(numVerts + 1));
+    for (lno_t v = 0; v < numVerts; v++) {
+      ASSERT_EQ(size_t(newRowmapHost(v + 1) - newRowmapHost(v)),
+                adj[v].size());
+      size_type pos = newRowmapHost(v);
+      for (lno_t w : adj[v]) ASSERT_EQ(newEntriesHost(pos++), w);
+    }
+    rowmap  = newRowmap;
+    entries = newEntries;
+  }
+}
+
+#define EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)                      \
+  TEST_F(TestCategory,                                                     \
+         graph##_##triangle_count_update##_##SCALAR##_##ORDINAL##_##OFFSET \
+             ##_##DEVICE) {                                                \
+    test_triangle_count_update<ORDINAL, OFFSET, DEVICE>(10, 6, 5);         \
+    test_triangle_count_update<ORDINAL, OFFSET, DEVICE>(200, 12, 40);      \
+    test_triangle_count_update<ORDINAL, OFFSET, DEVICE>(3000, 16, 500);    \
+  }
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT) && \
+     defined(KOKKOSKERNELS_INST_OFFSET_INT)) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&        \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int, int, TestDevice)
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT64_T) && \
+     defined(KOKKOSKERNELS_INST_OFFSET_INT)) ||     \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&            \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int64_t, int, TestDevice)
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT) &&    \
+     defined(KOKKOSKERNELS_INST_OFFSET_SIZE_T)) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&           \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int, size_t, TestDevice)
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT64_T) && \
+     defined(KOKKOSKERNELS_INST_OFFSET_SIZE_T)) ||  \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&            \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int64_t, size_t, TestDevice)
+#endif
+
+#undef EXECUTE_TEST
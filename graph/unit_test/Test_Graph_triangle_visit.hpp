@@ -0,0 +1,174 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+
+#include "KokkosGraph_Triangle.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+
+#include <random>
+#include <set>
+#include <vector>
+
+// Adds 1 to the counts of the three vertices of each triangle, and counts
+// the triangles not visited as u < v < w
+template <typename counts_t>
+struct TriVisitCounter {
+  counts_t counts;
+  counts_t errors;
+
+  template <typename lno_t>
+  KOKKOS_INLINE_FUNCTION void operator()(const lno_t u, const lno_t v,
+                                         const lno_t w) const {
+    if (!(u < v && v < w)) Kokkos::atomic_inc(&errors(0));
+    Kokkos::atomic_inc(&counts(u));
+    Kokkos::atomic_inc(&counts(v));
+    Kokkos::atomic_inc(&counts(w));
+  }
+};
+
+// Adds the triangle count of each edge to the counts of its endpoints, and
+// counts the edges visited (and the ones not visited as u < v)
+template <typename counts_t>
+struct TriVisitEdgeCounter {
+  counts_t counts;
+  counts_t edges;
+
+  template <typename lno_t>
+  KOKKOS_INLINE_FUNCTION void operator()(const lno_t u, const lno_t v,
+                                         const lno_t c) const {
+    Kokkos::atomic_inc(&edges(u < v ? 0 : 1));
+    Kokkos::atomic_add(&counts(u), int64_t(c));
+    Kokkos::atomic_add(&counts(v), int64_t(c));
+  }
+};
+
+template <typename lno_t, typename size_type, typename device>
+void test_triangle_visit(lno_t numVerts, lno_t avgDegree) {
+  typedef
+      typename KokkosSparse::CrsMatrix<double, lno_t, device, void, size_type>
+          crsMat_t;
+  typedef typename crsMat_t::StaticCrsGraphType graph_t;
+  typedef typename graph_t::row_map_type::non_const_type rowmap_t;
+  typedef typename graph_t::entries_type::non_const_type entries_t;
+  typedef Kokkos::View<int64_t*, device> counts_t;
+
+  std::mt19937 gen(1357);
+  std::uniform_int_distribution<lno_t> vertDist(0, numVerts - 1);
+  std::vector<std::set<lno_t>> adj(numVerts);
+  for (lno_t e = 0; e < numVerts * avgDegree / 2; e++) {
+    lno_t u = vertDist(gen);
+    lno_t v = e % 13 == 0 ? u : vertDist(gen);
+    adj[u].insert(v);
+    adj[v].insert(u);
+  }
+  // reference: per-vertex triangle counts, skipping the self loops
+  std::vector<int64_t> refCounts(numVerts, 0);
+  int64_t refTotal = 0, refEdges = 0;
+  for (lno_t u = 0; u < numVerts; u++) {
+    for (lno_t v : adj[u]) {
+      if (v <= u) continue;
+      refEdges++;
+      for (lno_t w : adj[v]) {
+        if (w <= v || !adj[u].count(w)) continue;
+        refCounts[u]++;
+        refCounts[v]++;
+        refCounts[w]++;
+        refTotal++;
+      }
+    }
+  }
+
+  size_t nnz = 0;
+  for (const auto& row : adj) nnz += row.size();
+  rowmap_t rowmap("Rowmap", numVerts + 1);
+  entries_t entries("Entries", nnz);
+  auto rowmapHost  = Kokkos::create_mirror_view(rowmap);
+  auto entriesHost = Kokkos::create_mirror_view(entries);
+  size_t pos       = 0;
+  for (lno_t v = 0; v < numVerts; v++) {
+    rowmapHost(v) = pos;
+    for (lno_t w : adj[v]) entriesHost(pos++) = w;
+  }
+  rowmapHost(numVerts) = pos;
+  Kokkos::deep_copy(rowmap, rowmapHost);
+  Kokkos::deep_copy(entries, entriesHost);
+
+  counts_t counts("Counts", numVerts), errors("Errors", 1);
+  int64_t total = KokkosGraph::Experimental::triangle_visit<device>(
+      rowmap, entries, TriVisitCounter<counts_t>{counts, errors});
+  EXPECT_EQ(total, refTotal);
+  auto countsHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                        counts);
+  auto errorsHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                        errors);
+  EXPECT_EQ(errorsHost(0), 0);
+  for (lno_t v = 0; v < numVerts; v++) ASSERT_EQ(countsHost(v), refCounts[v]);
+
+  counts_t edgeCounts("Edge counts", numVerts), edges("Edges", 2);
+  total = KokkosGraph::Experimental::triangle_visit_edges<device>(
+      rowmap, entries, TriVisitEdgeCounter<counts_t>{edgeCounts, edges});
+  EXPECT_EQ(total, refTotal);
+  auto edgeCountsHost =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), edgeCounts);
+  auto edgesHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                       edges);
+  EXPECT_EQ(edgesHost(0), refEdges);
+  EXPECT_EQ(edgesHost(1), 0);
+  // a triangle through v has two edges at v
+  for (lno_t v = 0; v < numVerts; v++)
+    ASSERT_EQ(edgeCountsHost(v), 2 * refCounts[v]);
+}
+
+#define EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)                     \
+  TEST_F(TestCategory,                                                    \
+         graph##_##triangle_visit##_##SCALAR##_##ORDINAL##_##OFFSET##_##  \
+             DEVICE) {                                                    \
+    test_triangle_visit<ORDINAL, OFFSET, DEVICE>(1, 0);                   \
+    test_triangle_visit<ORDINAL, OFFSET, DEVICE>(10, 6);                  \
+    test_triangle_visit<ORDINAL, OFFSET, DEVICE>(300, 20);                \
+    test_triangle_visit<ORDINAL, OFFSET, DEVICE>(5000, 16);               \
+  }
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT) && \
+     defined(KOKKOSKERNELS_INST_OFFSET_INT)) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&        \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int, int, TestDevice)
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT64_T) && \
+     defined(KOKKOSKERNELS_INST_OFFSET_INT)) ||     \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&            \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int64_t, int, TestDevice)
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT) &&    \
+     defined(KOKKOSKERNELS_INST_OFFSET_SIZE_T)) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&           \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int, size_t, TestDevice)
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT64_T) && \
+     defined(KOKKOSKERNELS_INST_OFFSET_SIZE_T)) ||  \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&            \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int64_t, size_t, TestDevice)
+#endif
+
+#undef EXECUTE_TEST
@@ -0,0 +1,92 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSLAPACK_IMPL_GEQRF_HPP_
+#define KOKKOSLAPACK_IMPL_GEQRF_HPP_
+
+/// \file KokkosLapack_geqrf_impl.hpp
+/// \brief Implementation(s) of QR factorization.
+
+#include <KokkosKernels_config.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ArithTraits.hpp>
+#include <KokkosKernels_Error.hpp>
+#include <KokkosBatched_QR_Decl.hpp>
+
+namespace KokkosLapack {
+namespace Impl {
+
+// Native QR factorization used when no TPL provides geqrf. A single team
+// factors A with the blocked KokkosBatched::TeamVectorQR, which applies
+// max_block_size reflectors at a time through their compact WY form.
+// KokkosBatched represents the reflectors as H(i) = I - v v^H / tau(i), the
+// scalar factors are inverted on exit to match LAPACK's H(i) = I - tau(i) v
+// v^H so that the output can be passed to any ormqr implementation.
+template <class AMatrix, class TauArray, class WorkArray>
+struct GeqrfFunctor {
+  AMatrix A;
+  TauArray Tau;
+  WorkArray W;
+
+  GeqrfFunctor(const AMatrix &A_, const TauArray &Tau_, const WorkArray &W_)
+      : A(A_), Tau(Tau_), W(W_) {}
+
+  template <class MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType &member) const {
+    using scalar_type = typename AMatrix::non_const_value_type;
+    const int k       = Kokkos::min(A.extent_int(0), A.extent_int(1));
+
+    KokkosBatched::TeamVectorQR<
+        MemberType, KokkosBatched::Algo::QR::Blocked>::invoke(member, A, Tau,
+                                                              W);
+    member.team_barrier();
+    Kokkos::parallel_for(
+        Kokkos::TeamVectorRange(member, k),
+        [&](const int &i) { Tau(i) = scalar_type(1) / Tau(i); });
+  }
+};
+
+template <class ExecutionSpace, class AMatrix, class TauArray>
+int geqrf_native(const ExecutionSpace &space, const AMatrix &A,
+                 const TauArray &Tau) {
+  using scalar_type = typename AMatrix::non_const_value_type;
+
+  if constexpr (Kokkos::ArithTraits<scalar_type>::is_complex) {
+    KokkosKernels::Impl::throw_runtime_exception(
+        "KokkosLapack::geqrf: the native implementation only supports real "
+        "scalars, enable the LAPACK or CUSOLVER TPL for complex matrices.");
+    return -1;
+  } else {
+    using work_array =
+        Kokkos::View<scalar_type *, typename AMatrix::memory_space>;
+    constexpr int nb =
+        KokkosBatched::TeamVectorHouseholderWY_Internal::max_block_size;
+
+    work_array W(Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                                    "geqrf workspace"),
+                 nb * (nb + A.extent(1)));
+    Kokkos::parallel_for(
+        "KokkosLapack::geqrf[native]",
+        Kokkos::TeamPolicy<ExecutionSpace>(space, 1, Kokkos::AUTO),
+        GeqrfFunctor<AMatrix, TauArray, work_array>(A, Tau, W));
+    return 0;
+  }
+}
+
+}  // namespace Impl
+}  // namespace KokkosLapack
+
+#endif  // KOKKOSLAPACK_IMPL_GEQRF_HPP_
@@ -21,12 +21,217 @@
 /// \brief Implementation(s) of dense linear solve.
 
 #include <KokkosKernels_config.h>
+#include <Kokkos_Core.hpp>
 #include <Kokkos_ArithTraits.hpp>
+#include <KokkosKernels_ExecSpaceUtils.hpp>
+#include <KokkosBlas3_gemm.hpp>
+#include <KokkosBlas3_trsm.hpp>
+#include <KokkosBatched_Getrf_Decl.hpp>
+#include <KokkosBatched_LU_Decl.hpp>
+#include <KokkosBatched_LU_Team_Impl.hpp>
 
 namespace KokkosLapack {
 namespace Impl {
 
-// NOTE: Might add the implementation of KokkosLapack::gesv later
+// Native right-looking blocked LU factorization with partial pivoting
+// followed by the triangular solves, used when no TPL provides gesv.
+//
+// For each panel of nb columns:
+//   1. the panel A(k:n, k:k+nb) is factored by a single team with
+//      KokkosBatched::TeamVectorGetrf (TeamLU without pivoting),
+//   2. its row interchanges are applied to the other columns of A and to B,
+//   3. U12 = L11^{-1} A12 with KokkosBlas::trsm,
+//   4. A22 = A22 - L21 U12 with KokkosBlas::gemm.
+// On GPUs the update of the next panel is done first and the update of
+// the rest of the trailing matrix runs on a second execution space instance
+// so it overlaps with the factorization of the next panel (look-ahead).
+
+// Factor the panel A(k:n, k:k+kb) with one team. The pivots are stored in
+// piv(k:k+kb) relative to their row, as in KokkosBatched::Getrf.
+template <class AMatrix, class PivView, bool pivoting>
+struct GesvPanelFunctor {
+  AMatrix A;
+  PivView piv;
+  int k, kb;
+
+  GesvPanelFunctor(const AMatrix &A_, const PivView &piv_, const int k_,
+                   const int kb_)
+      : A(A_), piv(piv_), k(k_), kb(kb_) {}
+
+  template <class MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType &member) const {
+    auto panel = Kokkos::subview(A, Kokkos::make_pair(k, A.extent_int(0)),
+                                 Kokkos::make_pair(k, k + kb));
+    if constexpr (pivoting) {
+      auto panel_piv = Kokkos::subview(piv, Kokkos::make_pair(k, k + kb));
+      KokkosBatched::TeamVectorGetrf<
+          MemberType, KokkosBatched::Algo::Getrf::Unblocked>::invoke(member,
+                                                                     panel,
+                                                                     panel_piv);
+    } else {
+      KokkosBatched::TeamLU<MemberType, KokkosBatched::Algo::LU::Unblocked>::
+          invoke(member, panel);
+    }
+  }
+};
+
+// Apply the row interchanges of the panel A(k:n, k:k+kb) to the columns
+// of A outside of the panel and to the columns of B, one column per index.
+template <class AMatrix, class BXMV, class PivView>
+struct GesvSwapFunctor {
+  AMatrix A;
+  BXMV B;
+  PivView piv;
+  int k, kb;
+
+  GesvSwapFunctor(const AMatrix &A_, const BXMV &B_, const PivView &piv_,
+                  const int k_, const int kb_)
+      : A(A_), B(B_), piv(piv_), k(k_), kb(kb_) {}
+
+  template <class MatrixType>
+  KOKKOS_INLINE_FUNCTION void swap_rows(const MatrixType &M,
+                                        const int j) const {
+    for (int p = k; p < k + kb; ++p) {
+      const int ip = p + piv(p);
+      if (ip != p) {
+        const auto tmp = M(p, j);
+        M(p, j)        = M(ip, j);
+        M(ip, j)       = tmp;
+      }
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const int idx) const {
+    const int num_A_cols = A.extent_int(1) - kb;
+    if (idx < num_A_cols) {
+      swap_rows(A, idx < k ? idx : idx + kb);
+    } else {
+      swap_rows(B, idx - num_A_cols);
+    }
+  }
+};
+
+// Convert the relative pivots to the 1-based row indices of LAPACK
+template <class PivView>
+struct GesvPivotFunctor {
+  PivView piv;
+
+  GesvPivotFunctor(const PivView &piv_) : piv(piv_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const int i) const {
+    piv(i) += i + 1;
+  }
+};
+
+// Update the block columns cols of the trailing matrix with the factors of
+// the panel A(k:n, k:k+kb)
+template <class ExecutionSpace, class AMatrix>
+void gesv_update(const ExecutionSpace &space, const AMatrix &A, const int k,
+                 const int kb, const Kokkos::pair<int, int> cols) {
+  using scalar_type = typename AMatrix::non_const_value_type;
+  const int n       = A.extent_int(0);
+  const scalar_type one(1), minus_one(-1);
+
+  if (cols.second <= cols.first) return;
+  auto L11 = Kokkos::subview(A, Kokkos::make_pair(k, k + kb),
+                             Kokkos::make_pair(k, k + kb));
+  auto L21 = Kokkos::subview(A, Kokkos::make_pair(k + kb, n),
+                             Kokkos::make_pair(k, k + kb));
+  auto A12 = Kokkos::subview(A, Kokkos::make_pair(k, k + kb), cols);
+  auto A22 = Kokkos::subview(A, Kokkos::make_pair(k + kb, n), cols);
+
+  KokkosBlas::trsm(space, "L", "L", "N", "U", one, L11, A12);
+  if (k + kb < n) {
+    KokkosBlas::gemm(space, "N", "N", minus_one, L21, A12, one, A22);
+  }
+}
+
+template <class ExecutionSpace, class AMatrix, class BXMV, class PivView,
+          bool pivoting>
+void gesv_factor(const ExecutionSpace &space, const AMatrix &A, const BXMV &B,
+                 const PivView &piv) {
+  using team_policy = Kokkos::TeamPolicy<ExecutionSpace>;
+  using panel_functor = GesvPanelFunctor<AMatrix, PivView, pivoting>;
+  using swap_functor  = GesvSwapFunctor<AMatrix, BXMV, PivView>;
+
+  const int n  = A.extent_int(0);
+  const int nb = KokkosKernels::Impl::kk_is_gpu_exec_space<ExecutionSpace>()
+                     ? 64
+                     : 32;
+  constexpr bool look_ahead =
+      KokkosKernels::Impl::kk_is_gpu_exec_space<ExecutionSpace>();
+
+  // The update of the trailing matrix beyond the next panel runs on side
+  ExecutionSpace side = space;
+  if constexpr (look_ahead) {
+    space.fence();
+    side = Kokkos::Experimental::partition_space(space, 1, 1)[1];
+  }
+
+  for (int k = 0; k < n; k += nb) {
+    const int kb = Kokkos::min(nb, n - k);
+
+    // The panel only overlaps with the update of the next panel from the
+    // previous step which has been done on space
+    Kokkos::parallel_for("KokkosLapack::gesv[panel]",
+                         team_policy(space, 1, Kokkos::AUTO),
+                         panel_functor(A, piv, k, kb));
+    if constexpr (look_ahead) side.fence();
+
+    if constexpr (pivoting) {
+      Kokkos::parallel_for(
+          "KokkosLapack::gesv[swap]",
+          Kokkos::RangePolicy<ExecutionSpace>(
+              space, 0, n - kb + B.extent_int(1)),
+          swap_functor(A, B, piv, k, kb));
+    }
+
+    const int next = Kokkos::min(k + kb + nb, n);
+    if (look_ahead && (next < n)) {
+      space.fence();
+      gesv_update(space, A, k, kb, Kokkos::make_pair(k + kb, next));
+      gesv_update(side, A, k, kb, Kokkos::make_pair(next, n));
+    } else {
+      gesv_update(space, A, k, kb, Kokkos::make_pair(k + kb, n));
+    }
+  }
+  if constexpr (look_ahead) side.fence();
+}
+
+template <class ExecutionSpace, class AMatrix, class BXMV, class IPIVV>
+void gesv_native(const ExecutionSpace &space, const AMatrix &A_in,
+                 const BXMV &B_in, const IPIVV &IPIV) {
+  using scalar_type = typename AMatrix::non_const_value_type;
+  using piv_view    = Kokkos::View<int *, typename AMatrix::device_type>;
+
+  const int n = A_in.extent_int(1);
+  if (n == 0) return;
+  const scalar_type one(1);
+  const bool pivoting = !((IPIV.extent(0) == 0) && (IPIV.data() == nullptr));
+
+  // gesv solves with the leading n x n block of A, as LAPACK
+  auto A = Kokkos::subview(A_in, Kokkos::make_pair(0, n), Kokkos::ALL());
+  auto B = Kokkos::subview(B_in, Kokkos::make_pair(0, n), Kokkos::ALL());
+
+  if (pivoting) {
+    // IPIV may not be accessible from space (MAGMA convention)
+    piv_view piv(Kokkos::view_alloc(space, "KokkosLapack::gesv::piv"), n);
+    gesv_factor<ExecutionSpace, decltype(A), decltype(B), piv_view, true>(
+        space, A, B, piv);
+    Kokkos::parallel_for("KokkosLapack::gesv[pivots]",
+                         Kokkos::RangePolicy<ExecutionSpace>(space, 0, n),
+                         GesvPivotFunctor<piv_view>(piv));
+    Kokkos::deep_copy(space, IPIV, piv);
+  } else {
+    piv_view piv;
+    gesv_factor<ExecutionSpace, decltype(A), decltype(B), piv_view, false>(
+        space, A, B, piv);
+  }
+
+  // B = U^{-1} L^{-1} P B, P B has been applied during the factorization
+  KokkosBlas::trsm(space, "L", "L", "N", "U", one, A, B);
+  KokkosBlas::trsm(space, "L", "U", "N", "N", one, A, B);
+}
 
 }  // namespace Impl
 }  // namespace KokkosLapack
@@ -85,12 +85,13 @@ struct GESV {
 template <class ExecutionSpace, class AMatrix, class BXMV, class IPIVV>
 struct GESV<ExecutionSpace, AMatrix, BXMV, IPIVV, false,
             KOKKOSKERNELS_IMPL_COMPILE_LIBRARY> {
-  static void gesv(const ExecutionSpace & /* space */, const AMatrix & /* A */,
-                   const BXMV & /* B */, const IPIVV & /* IPIV */) {
-    // NOTE: Might add the implementation of KokkosLapack::gesv later
-    throw std::runtime_error(
-        "No fallback implementation of GESV (general LU factorization & solve) "
-        "exists. Enable LAPACK, CUSOLVER, ROCSOLVER or MAGMA TPL.");
+  static void gesv(const ExecutionSpace &space, const AMatrix &A,
+                   const BXMV &B, const IPIVV &IPIV) {
+    Kokkos::Profiling::pushRegion(KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+                                      ? "KokkosLapack::gesv[ETI]"
+                                      : "KokkosLapack::gesv[noETI]");
+    gesv_native(space, A, B, IPIV);
+    Kokkos::Profiling::popRegion();
   }
 };
 
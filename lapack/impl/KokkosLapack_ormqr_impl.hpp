@@ -0,0 +1,124 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSLAPACK_IMPL_ORMQR_HPP_
+#define KOKKOSLAPACK_IMPL_ORMQR_HPP_
+
+/// \file KokkosLapack_ormqr_impl.hpp
+/// \brief Implementation(s) of the multiplication by the Q factor of a QR
+/// factorization.
+
+#include <KokkosKernels_config.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ArithTraits.hpp>
+#include <KokkosKernels_Error.hpp>
+#include <KokkosBatched_ApplyQ_Decl.hpp>
+
+namespace KokkosLapack {
+namespace Impl {
+
+// Native application of Q used when no TPL provides ormqr. A single team
+// applies the reflectors with the blocked KokkosBatched::TeamVectorApplyQ
+// internals. The LAPACK scalar factors are first inverted into t to get
+// KokkosBatched's H(i) = I - v v^H / t(i). C Q^T is computed as (Q C^T)^T
+// by swapping the strides of C.
+template <class AMatrix, class TauArray, class CMatrix, class WorkArray>
+struct OrmqrFunctor {
+  AMatrix A;
+  TauArray Tau;
+  CMatrix C;
+  WorkArray t, W;
+  bool left, trans;
+
+  OrmqrFunctor(const AMatrix &A_, const TauArray &Tau_, const CMatrix &C_,
+               const WorkArray &t_, const WorkArray &W_, const bool left_,
+               const bool trans_)
+      : A(A_), Tau(Tau_), C(C_), t(t_), W(W_), left(left_), trans(trans_) {}
+
+  template <class MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType &member) const {
+    using scalar_type = typename CMatrix::non_const_value_type;
+    const int m       = C.extent_int(0);
+    const int n       = C.extent_int(1);
+    const int k       = t.extent_int(0);
+
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(member, k),
+                         [&](const int &i) { t(i) = scalar_type(1) / Tau(i); });
+    member.team_barrier();
+
+    const int as0 = A.stride(0), as1 = A.stride(1);
+    const int cs0 = C.stride(0), cs1 = C.stride(1);
+    if (left && !trans) {
+      KokkosBatched::TeamVectorApplyQ_LeftForwardBlockedInternal::invoke(
+          member, m, n, k, A.data(), as0, as1, t.data(), t.stride(0), C.data(),
+          cs0, cs1, W.data());
+    } else if (left) {
+      KokkosBatched::TeamVectorApplyQ_LeftBackwardBlockedInternal::invoke(
+          member, m, n, k, A.data(), as0, as1, t.data(), t.stride(0), C.data(),
+          cs0, cs1, W.data());
+    } else if (!trans) {
+      KokkosBatched::TeamVectorApplyQ_RightForwardBlockedInternal::invoke(
+          member, m, n, k, A.data(), as0, as1, t.data(), t.stride(0), C.data(),
+          cs0, cs1, W.data());
+    } else {
+      KokkosBatched::TeamVectorApplyQ_LeftForwardBlockedInternal::invoke(
+          member, n, m, k, A.data(), as0, as1, t.data(), t.stride(0), C.data(),
+          cs1, cs0, W.data());
+    }
+  }
+};
+
+template <class ExecutionSpace, class AMatrix, class TauArray, class CMatrix>
+int ormqr_native(const ExecutionSpace &space, const char side[],
+                 const char trans[], const AMatrix &A, const TauArray &Tau,
+                 const CMatrix &C) {
+  using scalar_type = typename CMatrix::non_const_value_type;
+
+  if constexpr (Kokkos::ArithTraits<scalar_type>::is_complex) {
+    KokkosKernels::Impl::throw_runtime_exception(
+        "KokkosLapack::ormqr: the native implementation only supports real "
+        "scalars, enable the LAPACK or CUSOLVER TPL for complex matrices.");
+    return -1;
+  } else {
+    using work_array =
+        Kokkos::View<scalar_type *, typename CMatrix::memory_space>;
+    using functor_type = OrmqrFunctor<AMatrix, TauArray, CMatrix, work_array>;
+    constexpr int nb =
+        KokkosBatched::TeamVectorHouseholderWY_Internal::max_block_size;
+
+    const bool is_left  = (side[0] == 'L') || (side[0] == 'l');
+    const bool is_trans = !((trans[0] == 'N') || (trans[0] == 'n'));
+    const int k         = Kokkos::min(A.extent_int(0), A.extent_int(1));
+    const int mn        = Kokkos::max(C.extent_int(0), C.extent_int(1));
+
+    work_array t(Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                                    "ormqr tau"),
+                 k);
+    work_array W(Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                                    "ormqr workspace"),
+                 nb * (nb + mn));
+    Kokkos::parallel_for(
+        "KokkosLapack::ormqr[native]",
+        Kokkos::TeamPolicy<ExecutionSpace>(space, 1, Kokkos::AUTO),
+        functor_type(A, Tau, C, t, W, is_left, is_trans));
+    return 0;
+  }
+}
+
+}  // namespace Impl
+}  // namespace KokkosLapack
+
+#endif  // KOKKOSLAPACK_IMPL_ORMQR_HPP_
@@ -0,0 +1,145 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSLAPACK_IMPL_ORMQR_SPEC_HPP_
+#define KOKKOSLAPACK_IMPL_ORMQR_SPEC_HPP_
+
+#include <KokkosKernels_config.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ArithTraits.hpp>
+
+// Include the actual functors
+#if !defined(KOKKOSKERNELS_ETI_ONLY) || KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+#include <KokkosLapack_ormqr_impl.hpp>
+#endif
+
+namespace KokkosLapack {
+namespace Impl {
+// Specialization struct which defines whether a specialization exists
+template <class ExecutionSpace, class AMatrix, class TauArray, class CMatrix>
+struct ormqr_eti_spec_avail {
+  enum : bool { value = false };
+};
+}  // namespace Impl
+}  // namespace KokkosLapack
+
+//
+// Macro for declaration of full specialization availability
+// KokkosLapack::Impl::ORMQR.  This is NOT for users!!!  All
+// the declarations of full specializations go in this header file.
+// We may spread out definitions (see _INST macro below) across one or
+// more .cpp files.
+//
+#define KOKKOSLAPACK_ORMQR_ETI_SPEC_AVAIL(SCALAR_TYPE, LAYOUT_TYPE,        \
+                                          EXEC_SPACE_TYPE, MEM_SPACE_TYPE) \
+  template <>                                                              \
+  struct ormqr_eti_spec_avail<                                             \
+      EXEC_SPACE_TYPE,                                                     \
+      Kokkos::View<SCALAR_TYPE **, LAYOUT_TYPE,                            \
+                   Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>,        \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,               \
+      Kokkos::View<SCALAR_TYPE *, LAYOUT_TYPE,                             \
+                   Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>,        \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,               \
+      Kokkos::View<SCALAR_TYPE **, LAYOUT_TYPE,                            \
+                   Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>,        \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>> {             \
+    enum : bool { value = true };                                          \
+  };
+
+// Include the actual specialization declarations
+#include <KokkosLapack_ormqr_tpl_spec_avail.hpp>
+#include <generated_specializations_hpp/KokkosLapack_ormqr_eti_spec_avail.hpp>
+
+namespace KokkosLapack {
+namespace Impl {
+
+// Unification layer
+/// \brief Implementation of KokkosLapack::ormqr.
+
+template <class ExecutionSpace, class AMatrix, class TauArray, class CMatrix,
+          bool tpl_spec_avail = ormqr_tpl_spec_avail<
+              ExecutionSpace, AMatrix, TauArray, CMatrix>::value,
+          bool eti_spec_avail = ormqr_eti_spec_avail<
+              ExecutionSpace, AMatrix, TauArray, CMatrix>::value>
+struct ORMQR {
+  static int ormqr(const ExecutionSpace &space, const char side[],
+                   const char trans[], const AMatrix &A, const TauArray &Tau,
+                   const CMatrix &C);
+};
+
+#if !defined(KOKKOSKERNELS_ETI_ONLY) || KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+//! Full specialization of ormqr, native implementation.
+// Unification layer
+template <class ExecutionSpace, class AMatrix, class TauArray, class CMatrix>
+struct ORMQR<ExecutionSpace, AMatrix, TauArray, CMatrix, false,
+             KOKKOSKERNELS_IMPL_COMPILE_LIBRARY> {
+  static int ormqr(const ExecutionSpace &space, const char side[],
+                   const char trans[], const AMatrix &A, const TauArray &Tau,
+                   const CMatrix &C) {
+    Kokkos::Profiling::pushRegion(KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+                                      ? "KokkosLapack::ormqr[ETI]"
+                                      : "KokkosLapack::ormqr[noETI]");
+    const int info = ormqr_native(space, side, trans, A, Tau, C);
+    Kokkos::Profiling::popRegion();
+    return info;
+  }
+};
+
+#endif
+}  // namespace Impl
+}  // namespace KokkosLapack
+
+//
+// Macro for declaration of full specialization of
+// KokkosLapack::Impl::ORMQR.  This is NOT for users!!!  All
+// the declarations of full specializations go in this header file.
+// We may spread out definitions (see _DEF macro below) across one or
+// more .cpp files.
+//
+#define KOKKOSLAPACK_ORMQR_ETI_SPEC_DECL(SCALAR_TYPE, LAYOUT_TYPE,        \
+                                         EXEC_SPACE_TYPE, MEM_SPACE_TYPE) \
+  extern template struct ORMQR<                                           \
+      EXEC_SPACE_TYPE,                                                    \
+      Kokkos::View<SCALAR_TYPE **, LAYOUT_TYPE,                           \
+                   Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>,       \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,              \
+      Kokkos::View<SCALAR_TYPE *, LAYOUT_TYPE,                            \
+                   Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>,       \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,              \
+      Kokkos::View<SCALAR_TYPE **, LAYOUT_TYPE,                           \
+                   Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>,       \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,              \
+      false, true>;
+
+#define KOKKOSLAPACK_ORMQR_ETI_SPEC_INST(SCALAR_TYPE, LAYOUT_TYPE,        \
+                                         EXEC_SPACE_TYPE, MEM_SPACE_TYPE) \
+  template struct ORMQR<                                                  \
+      EXEC_SPACE_TYPE,                                                    \
+      Kokkos::View<SCALAR_TYPE **, LAYOUT_TYPE,                           \
+                   Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>,       \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,              \
+      Kokkos::View<SCALAR_TYPE *, LAYOUT_TYPE,                            \
+                   Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>,       \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,              \
+      Kokkos::View<SCALAR_TYPE **, LAYOUT_TYPE,                           \
+                   Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>,       \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,              \
+      false, true>;
+
+#include <KokkosLapack_ormqr_tpl_spec_decl.hpp>
+
+#endif  // KOKKOSLAPACK_IMPL_ORMQR_SPEC_HPP_
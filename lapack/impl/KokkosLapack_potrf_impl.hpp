@@ -0,0 +1,127 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSLAPACK_IMPL_POTRF_HPP_
+#define KOKKOSLAPACK_IMPL_POTRF_HPP_
+
+/// \file KokkosLapack_potrf_impl.hpp
+/// \brief Implementation(s) of the Cholesky factorization.
+
+#include <KokkosKernels_config.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ArithTraits.hpp>
+#include <KokkosKernels_ExecSpaceUtils.hpp>
+#include <KokkosBlas3_syrk.hpp>
+#include <KokkosBlas3_trsm.hpp>
+#include <KokkosBatched_Potrf_Decl.hpp>
+
+namespace KokkosLapack {
+namespace Impl {
+
+// Native right-looking blocked Cholesky factorization. For each diagonal
+// block of nb columns, with uplo = "L":
+//   1. A11 = L11 * L11^H is factored by a single team with
+//      KokkosBatched::TeamVectorPotrf,
+//   2. L21 = A21 * L11^{-H} with KokkosBlas::trsm,
+//   3. A22 = A22 - L21 * L21^H with KokkosBlas::herk, which only updates the
+//      lower triangle of A22.
+// uplo = "U" is the conjugate transpose of the same steps.
+
+// Factor the diagonal block A(k:k+kb, k:k+kb) with one team. The first
+// failure is recorded in info (1-based, as LAPACK) and the following
+// blocks are skipped.
+template <class AMatrix, class InfoView, class ArgUplo>
+struct PotrfDiagFunctor {
+  AMatrix A;
+  InfoView info;
+  int k, kb;
+
+  PotrfDiagFunctor(const AMatrix &A_, const InfoView &info_, const int k_,
+                   const int kb_)
+      : A(A_), info(info_), k(k_), kb(kb_) {}
+
+  template <class MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType &member) const {
+    if (info() != 0) return;
+    auto A11 = Kokkos::subview(A, Kokkos::make_pair(k, k + kb),
+                               Kokkos::make_pair(k, k + kb));
+    const int r =
+        KokkosBatched::TeamVectorPotrf<MemberType, ArgUplo,
+                                       KokkosBatched::Algo::Potrf::Unblocked>::
+            invoke(member, A11);
+    member.team_barrier();
+    if (r != 0) {
+      Kokkos::single(Kokkos::PerTeam(member), [&]() { info() = k + r; });
+    }
+  }
+};
+
+template <class ExecutionSpace, class AMatrix>
+int potrf_native(const ExecutionSpace &space, const char uplo[],
+                 const AMatrix &A) {
+  using scalar_type = typename AMatrix::non_const_value_type;
+  using mag_type    = typename Kokkos::ArithTraits<scalar_type>::mag_type;
+  using team_policy = Kokkos::TeamPolicy<ExecutionSpace>;
+  using info_view   = Kokkos::View<int, typename AMatrix::device_type>;
+
+  const int n = A.extent_int(0);
+  const int nb =
+      KokkosKernels::Impl::kk_is_gpu_exec_space<ExecutionSpace>() ? 64 : 32;
+  const bool lower = (uplo[0] == 'L') || (uplo[0] == 'l');
+  const scalar_type one(1);
+
+  info_view info(Kokkos::view_alloc(space, "KokkosLapack::potrf::info"));
+  for (int k = 0; k < n; k += nb) {
+    const int kb   = Kokkos::min(nb, n - k);
+    const auto d   = Kokkos::make_pair(k, k + kb);
+    const auto rem = Kokkos::make_pair(k + kb, n);
+    auto A11       = Kokkos::subview(A, d, d);
+
+    if (lower) {
+      Kokkos::parallel_for(
+          "KokkosLapack::potrf[diag]", team_policy(space, 1, Kokkos::AUTO),
+          PotrfDiagFunctor<AMatrix, info_view, KokkosBatched::Uplo::Lower>(
+              A, info, k, kb));
+    } else {
+      Kokkos::parallel_for(
+          "KokkosLapack::potrf[diag]", team_policy(space, 1, Kokkos::AUTO),
+          PotrfDiagFunctor<AMatrix, info_view, KokkosBatched::Uplo::Upper>(
+              A, info, k, kb));
+    }
+    if (k + kb == n) break;
+
+    if (lower) {
+      auto A21 = Kokkos::subview(A, rem, d);
+      auto A22 = Kokkos::subview(A, rem, rem);
+      KokkosBlas::trsm(space, "R", "L", "C", "N", one, A11, A21);
+      KokkosBlas::herk(space, "L", "N", mag_type(-1), A21, mag_type(1), A22);
+    } else {
+      auto A12 = Kokkos::subview(A, d, rem);
+      auto A22 = Kokkos::subview(A, rem, rem);
+      KokkosBlas::trsm(space, "L", "U", "C", "N", one, A11, A12);
+      KokkosBlas::herk(space, "U", "C", mag_type(-1), A12, mag_type(1), A22);
+    }
+  }
+
+  int h_info = 0;
+  Kokkos::deep_copy(h_info, info);
+  return h_info;
+}
+
+}  // namespace Impl
+}  // namespace KokkosLapack
+
+#endif  // KOKKOSLAPACK_IMPL_POTRF_HPP_
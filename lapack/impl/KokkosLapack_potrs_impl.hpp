@@ -0,0 +1,51 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSLAPACK_IMPL_POTRS_HPP_
+#define KOKKOSLAPACK_IMPL_POTRS_HPP_
+
+/// \file KokkosLapack_potrs_impl.hpp
+/// \brief Implementation(s) of the Cholesky solve.
+
+#include <KokkosKernels_config.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ArithTraits.hpp>
+#include <KokkosBlas3_trsm.hpp>
+
+namespace KokkosLapack {
+namespace Impl {
+
+// Native solve with the factor from potrf: two triangular solves with
+// KokkosBlas::trsm, L then L^H (uplo = "L") or U^H then U (uplo = "U").
+template <class ExecutionSpace, class AMatrix, class BXMV>
+void potrs_native(const ExecutionSpace &space, const char uplo[],
+                  const AMatrix &A, const BXMV &B) {
+  using scalar_type = typename BXMV::non_const_value_type;
+  const scalar_type one(1);
+
+  if ((uplo[0] == 'L') || (uplo[0] == 'l')) {
+    KokkosBlas::trsm(space, "L", "L", "N", "N", one, A, B);
+    KokkosBlas::trsm(space, "L", "L", "C", "N", one, A, B);
+  } else {
+    KokkosBlas::trsm(space, "L", "U", "C", "N", one, A, B);
+    KokkosBlas::trsm(space, "L", "U", "N", "N", one, A, B);
+  }
+}
+
+}  // namespace Impl
+}  // namespace KokkosLapack
+
+#endif  // KOKKOSLAPACK_IMPL_POTRS_HPP_
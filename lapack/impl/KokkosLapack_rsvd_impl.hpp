@@ -0,0 +1,171 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSLAPACK_IMPL_RSVD_HPP_
+#define KOKKOSLAPACK_IMPL_RSVD_HPP_
+
+/// \file KokkosLapack_rsvd_impl.hpp
+/// \brief Native randomized truncated singular value decomposition.
+
+#include <KokkosKernels_config.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+#include <KokkosBlas3_gemm.hpp>
+#include <KokkosBatched_SVD_Decl.hpp>
+#include "KokkosLapack_tsqr_impl.hpp"
+
+namespace KokkosLapack {
+namespace Impl {
+
+// Randomized truncated SVD (Halko, Martinsson and Tropp, 2011).
+//
+// With l = k + oversample columns:
+//   1. Y = A * Omega for a random n-by-l Omega, Y = Q * R with TSQR,
+//   2. power iterations Z = A^T Q, Z = Qz * Rz, Y = A * Qz, Y = Q * R,
+//      which sharpen the range estimate when the spectrum decays slowly,
+//   3. B^T = A^T Q is n-by-l, B^T = Qb * Rb with TSQR,
+//   4. the small l-by-l Rb^T = Ub * S * Vb^T is decomposed by one team,
+//   5. A ~ Q * B = (Q * Ub) * S * (Qb * Vb)^T.
+// A is only accessed through the operator, which applies A or A^T to a
+// LayoutLeft multivector, so the same driver serves dense and sparse A.
+
+// Operator applying a dense matrix with KokkosBlas::gemm
+template <class AMatrix>
+struct RsvdDenseOperator {
+  AMatrix A;
+
+  RsvdDenseOperator(const AMatrix &A_) : A(A_) {}
+
+  int num_rows() const { return A.extent_int(0); }
+  int num_cols() const { return A.extent_int(1); }
+
+  // Y = op(A) * X with op = identity for 'N' and transpose for 'T'
+  template <class ExecutionSpace, class XMatrix, class YMatrix>
+  void apply(const ExecutionSpace &space, const char trans[],
+             const XMatrix &X, const YMatrix &Y) const {
+    using scalar_type = typename YMatrix::non_const_value_type;
+    KokkosBlas::gemm(space, trans, "N", scalar_type(1), A, X, scalar_type(0),
+                     Y);
+  }
+};
+
+// Decompose the small l-by-l matrix Rb^T = Ub * S * Vb^T with a single team
+template <class RMatrix, class UMatrix, class SVector, class VMatrix>
+struct RsvdSmallSVDFunctor {
+  RMatrix Rb;
+  UMatrix Ub;
+  SVector S;
+  VMatrix Vb;
+
+  RsvdSmallSVDFunctor(const RMatrix &Rb_, const UMatrix &Ub_,
+                      const SVector &S_, const VMatrix &Vb_)
+      : Rb(Rb_), Ub(Ub_), S(S_), Vb(Vb_) {}
+
+  template <class MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType &member) const {
+    using strided_matrix =
+        Kokkos::View<typename RMatrix::non_const_value_type **,
+                     Kokkos::LayoutStride, typename RMatrix::memory_space,
+                     Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+    // Transposes are strided views, Vb is stored so that its leading
+    // columns are the leading right singular vectors
+    const int l = Rb.extent_int(0);
+    strided_matrix M(Rb.data(),
+                     Kokkos::LayoutStride(l, Rb.stride(1), l, Rb.stride(0)));
+    strided_matrix Vbt(Vb.data(),
+                       Kokkos::LayoutStride(l, Vb.stride(1), l, Vb.stride(0)));
+    KokkosBatched::TeamVectorSVD<MemberType>::invoke(
+        member, KokkosBatched::SVD_USV_Tag(), M, Ub, S, Vbt);
+  }
+};
+
+template <class ExecutionSpace, class Operator, class SVector, class UMatrix,
+          class VMatrix>
+void rsvd_native(const ExecutionSpace &space, const Operator &A, const int k,
+                 const int oversample, const int power_iters,
+                 const SVector &S, const UMatrix &U, const VMatrix &Vt,
+                 const uint64_t seed) {
+  using scalar_type  = typename UMatrix::non_const_value_type;
+  using memory_space = typename UMatrix::memory_space;
+  using matrix_type =
+      Kokkos::View<scalar_type **, Kokkos::LayoutLeft, memory_space>;
+  using vector_type =
+      Kokkos::View<scalar_type *, Kokkos::LayoutLeft, memory_space>;
+  using team_policy = Kokkos::TeamPolicy<ExecutionSpace>;
+
+  const int m = A.num_rows();
+  const int n = A.num_cols();
+  const int l = Kokkos::min(k + oversample, Kokkos::min(m, n));
+
+  matrix_type Omega(Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                                       "rsvd Omega"),
+                    n, l);
+  matrix_type Y(Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                                   "rsvd range basis"),
+                m, l);
+  matrix_type R(Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                                   "rsvd R"),
+                l, l);
+
+  // Range finder
+  Kokkos::Random_XorShift64_Pool<ExecutionSpace> rand_pool(seed);
+  Kokkos::fill_random(space, Omega, rand_pool, scalar_type(-1),
+                      scalar_type(1));
+  A.apply(space, "N", Omega, Y);
+  tsqr_native(space, Y, R);
+
+  // Power iterations, re-orthonormalized after every product, Omega is
+  // reused as the n-by-l basis
+  for (int iter = 0; iter < power_iters; ++iter) {
+    A.apply(space, "T", Y, Omega);
+    tsqr_native(space, Omega, R);
+    A.apply(space, "N", Omega, Y);
+    tsqr_native(space, Y, R);
+  }
+
+  // B^T = A^T Q = Qb Rb
+  A.apply(space, "T", Y, Omega);
+  tsqr_native(space, Omega, R);
+
+  // Rb^T = Ub S Vb^T
+  matrix_type Ub(Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                                    "rsvd small U"),
+                 l, l);
+  matrix_type Vb(Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                                    "rsvd small V"),
+                 l, l);
+  vector_type Sb(Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                                    "rsvd small S"),
+                 l);
+  Kokkos::parallel_for(
+      "KokkosLapack::rsvd[small SVD]", team_policy(space, 1, Kokkos::AUTO),
+      RsvdSmallSVDFunctor<matrix_type, matrix_type, vector_type, matrix_type>(
+          R, Ub, Sb, Vb));
+
+  // Keep the k leading triplets
+  const auto kk = Kokkos::make_pair(0, k);
+  Kokkos::deep_copy(space, S, Kokkos::subview(Sb, kk));
+  KokkosBlas::gemm(space, "N", "N", scalar_type(1), Y,
+                   Kokkos::subview(Ub, Kokkos::ALL, kk), scalar_type(0), U);
+  KokkosBlas::gemm(space, "T", "T", scalar_type(1),
+                   Kokkos::subview(Vb, Kokkos::ALL, kk), Omega,
+                   scalar_type(0), Vt);
+}
+
+}  // namespace Impl
+}  // namespace KokkosLapack
+
+#endif  // KOKKOSLAPACK_IMPL_RSVD_HPP_
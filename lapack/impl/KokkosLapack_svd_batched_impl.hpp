@@ -0,0 +1,78 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSLAPACK_IMPL_SVD_BATCHED_HPP_
+#define KOKKOSLAPACK_IMPL_SVD_BATCHED_HPP_
+
+/// \file KokkosLapack_svd_batched_impl.hpp
+/// \brief Native singular value decomposition of a batch of small dense
+/// matrices.
+
+#include <KokkosKernels_config.h>
+#include <Kokkos_Core.hpp>
+#include <KokkosBatched_SVD_Decl.hpp>
+
+namespace KokkosLapack {
+namespace Impl {
+
+// Decompose A(b, :, :) with team b. The batched kernel overwrites A.
+template <class AMatrix, class SVector, class UMatrix, class VMatrix>
+struct SvdBatchedFunctor {
+  AMatrix A;
+  SVector S;
+  UMatrix U;
+  VMatrix Vt;
+  bool vectors;
+
+  SvdBatchedFunctor(const AMatrix &A_, const SVector &S_, const UMatrix &U_,
+                    const VMatrix &Vt_, const bool vectors_)
+      : A(A_), S(S_), U(U_), Vt(Vt_), vectors(vectors_) {}
+
+  template <class MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType &member) const {
+    const int b = member.league_rank();
+    auto A_b    = Kokkos::subview(A, b, Kokkos::ALL, Kokkos::ALL);
+    auto S_b    = Kokkos::subview(S, b, Kokkos::ALL);
+    if (vectors) {
+      KokkosBatched::TeamVectorSVD<MemberType>::invoke(
+          member, KokkosBatched::SVD_USV_Tag(), A_b,
+          Kokkos::subview(U, b, Kokkos::ALL, Kokkos::ALL), S_b,
+          Kokkos::subview(Vt, b, Kokkos::ALL, Kokkos::ALL));
+    } else {
+      KokkosBatched::TeamVectorSVD<MemberType>::invoke(
+          member, KokkosBatched::SVD_S_Tag(), A_b, S_b);
+    }
+  }
+};
+
+// One team per matrix, so the whole batch is a single kernel launch
+template <class ExecutionSpace, class AMatrix, class SVector, class UMatrix,
+          class VMatrix>
+void svd_batched_native(const ExecutionSpace &space, const char jobu[],
+                        const AMatrix &A, const SVector &S, const UMatrix &U,
+                        const VMatrix &Vt) {
+  const bool vectors = (jobu[0] == 'A') || (jobu[0] == 'a');
+  Kokkos::parallel_for(
+      "KokkosLapack::svd[batched]",
+      Kokkos::TeamPolicy<ExecutionSpace>(space, A.extent_int(0), Kokkos::AUTO),
+      SvdBatchedFunctor<AMatrix, SVector, UMatrix, VMatrix>(A, S, U, Vt,
+                                                            vectors));
+}
+
+}  // namespace Impl
+}  // namespace KokkosLapack
+
+#endif  // KOKKOSLAPACK_IMPL_SVD_BATCHED_HPP_
@@ -0,0 +1,56 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef KOKKOSLAPACK_IMPL_SVD_BATCHED_SPEC_HPP_
+#define KOKKOSLAPACK_IMPL_SVD_BATCHED_SPEC_HPP_
+
+#include <KokkosKernels_config.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ArithTraits.hpp>
+
+#include <KokkosLapack_svd_batched_impl.hpp>
+
+// Include the actual specialization declarations
+#include <KokkosLapack_svd_batched_tpl_spec_avail.hpp>
+
+namespace KokkosLapack {
+namespace Impl {
+
+// Unification layer
+/// \brief Implementation of the batched KokkosLapack::svd.
+///
+/// The native implementation is a single team-parallel kernel templated on
+/// the views, it is not explicitly instantiated.
+
+template <class ExecutionSpace, class AMatrix, class SVector, class UMatrix,
+          class VMatrix,
+          bool tpl_spec_avail = svd_batched_tpl_spec_avail<
+              ExecutionSpace, AMatrix, SVector, UMatrix, VMatrix>::value>
+struct SVD_BATCHED {
+  static void svd(const ExecutionSpace &space, const char jobu[],
+                  const char /* jobvt */[], const AMatrix &A,
+                  const SVector &S, const UMatrix &U, const VMatrix &Vt) {
+    Kokkos::Profiling::pushRegion("KokkosLapack::svd[batched,native]");
+    svd_batched_native(space, jobu, A, S, U, Vt);
+    Kokkos::Profiling::popRegion();
+  }
+};
+
+}  // namespace Impl
+}  // namespace KokkosLapack
+
+#include <KokkosLapack_svd_batched_tpl_spec_decl.hpp>
+
+#endif  // KOKKOSLAPACK_IMPL_SVD_BATCHED_SPEC_HPP_
@@ -0,0 +1,133 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSLAPACK_IMPL_SYEV_SPEC_HPP_
+#define KOKKOSLAPACK_IMPL_SYEV_SPEC_HPP_
+
+#include <KokkosKernels_config.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ArithTraits.hpp>
+
+// Include the actual functors
+#if !defined(KOKKOSKERNELS_ETI_ONLY) || KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+#include <KokkosLapack_syev_impl.hpp>
+#endif
+
+namespace KokkosLapack {
+namespace Impl {
+// Specialization struct which defines whether a specialization exists
+template <class ExecutionSpace, class AMatrix, class WVector>
+struct syev_eti_spec_avail {
+  enum : bool { value = false };
+};
+}  // namespace Impl
+}  // namespace KokkosLapack
+
+//
+// Macro for declaration of full specialization availability
+// KokkosLapack::Impl::SYEV.  This is NOT for users!!!  All
+// the declarations of full specializations go in this header file.
+// We may spread out definitions (see _INST macro below) across one or
+// more .cpp files.
+//
+#define KOKKOSLAPACK_SYEV_ETI_SPEC_AVAIL(SCALAR_TYPE, LAYOUT_TYPE,            \
+                                         EXEC_SPACE_TYPE, MEM_SPACE_TYPE)     \
+  template <>                                                                 \
+  struct syev_eti_spec_avail<                                                 \
+      EXEC_SPACE_TYPE,                                                        \
+      Kokkos::View<SCALAR_TYPE **, LAYOUT_TYPE,                               \
+                   Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>,           \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,                  \
+      Kokkos::View<Kokkos::ArithTraits<SCALAR_TYPE>::mag_type *, LAYOUT_TYPE, \
+                   Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>,           \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>> {                \
+    enum : bool { value = true };                                             \
+  };
+
+// Include the actual specialization declarations
+#include <KokkosLapack_syev_tpl_spec_avail.hpp>
+#include <generated_specializations_hpp/KokkosLapack_syev_eti_spec_avail.hpp>
+
+namespace KokkosLapack {
+namespace Impl {
+
+// Unification layer
+/// \brief Implementation of KokkosLapack::syev.
+
+template <class ExecutionSpace, class AMatrix, class WVector,
+          bool tpl_spec_avail =
+              syev_tpl_spec_avail<ExecutionSpace, AMatrix, WVector>::value,
+          bool eti_spec_avail =
+              syev_eti_spec_avail<ExecutionSpace, AMatrix, WVector>::value>
+struct SYEV {
+  static void syev(const ExecutionSpace &space, const char jobz[],
+                   const char uplo[], const AMatrix &A, const WVector &W);
+};
+
+#if !defined(KOKKOSKERNELS_ETI_ONLY) || KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+//! Full specialization of syev
+// Unification layer
+template <class ExecutionSpace, class AMatrix, class WVector>
+struct SYEV<ExecutionSpace, AMatrix, WVector, false,
+            KOKKOSKERNELS_IMPL_COMPILE_LIBRARY> {
+  static void syev(const ExecutionSpace & /* space */, const char * /* jobz */,
+                   const char * /* uplo */, const AMatrix & /* A */,
+                   const WVector & /* W */) {
+    throw std::runtime_error(
+        "No fallback implementation of SYEV (symmetric eigenvalue "
+        "decomposition) exists. Enable LAPACK, CUSOLVER or ROCSOLVER TPL to "
+        "use this function.");
+  }
+};
+
+#endif
+}  // namespace Impl
+}  // namespace KokkosLapack
+
+//
+// Macro for declaration of full specialization of
+// KokkosLapack::Impl::SYEV.  This is NOT for users!!!  All
+// the declarations of full specializations go in this header file.
+// We may spread out definitions (see _DEF macro below) across one or
+// more .cpp files.
+//
+#define KOKKOSLAPACK_SYEV_ETI_SPEC_DECL(SCALAR_TYPE, LAYOUT_TYPE,             \
+                                        EXEC_SPACE_TYPE, MEM_SPACE_TYPE)      \
+  extern template struct SYEV<                                                \
+      EXEC_SPACE_TYPE,                                                        \
+      Kokkos::View<SCALAR_TYPE **, LAYOUT_TYPE,                               \
+                   Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>,           \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,                  \
+      Kokkos::View<Kokkos::ArithTraits<SCALAR_TYPE>::mag_type *, LAYOUT_TYPE, \
+                   Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>,           \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,                  \
+      false, true>;
+
+#define KOKKOSLAPACK_SYEV_ETI_SPEC_INST(SCALAR_TYPE, LAYOUT_TYPE,             \
+                                        EXEC_SPACE_TYPE, MEM_SPACE_TYPE)      \
+  template struct SYEV<                                                       \
+      EXEC_SPACE_TYPE,                                                        \
+      Kokkos::View<SCALAR_TYPE **, LAYOUT_TYPE,                               \
+                   Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>,           \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,                  \
+      Kokkos::View<Kokkos::ArithTraits<SCALAR_TYPE>::mag_type *, LAYOUT_TYPE, \
+                   Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>,           \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,                  \
+      false, true>;
+
+#include <KokkosLapack_syev_tpl_spec_decl.hpp>
+
+#endif  // KOKKOSLAPACK_IMPL_SYEV_SPEC_HPP_
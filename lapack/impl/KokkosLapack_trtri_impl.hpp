@@ -24,46 +24,137 @@
 
 #include "KokkosKernels_config.h"
 #include "Kokkos_Core.hpp"
+#include "KokkosKernels_ExecSpaceUtils.hpp"
+#include "KokkosBlas3_trmm.hpp"
 #include "KokkosBatched_Trtri_Decl.hpp"
 #include "KokkosBatched_Trtri_Serial_Impl.hpp"
 
 namespace KokkosLapack {
 namespace Impl {
 
-template <class RViewType, class AViewType>
-void SerialTrtri_Invoke(const RViewType &R, const char uplo[],
-                        const char diag[], const AViewType &A) {
-  using KokkosBatched::Algo;
-  using KokkosBatched::Diag;
-  using KokkosBatched::SerialTrtriInternalLower;
-  using KokkosBatched::SerialTrtriInternalUpper;
-
-  char __uplo = tolower(uplo[0]), __diag = tolower(diag[0]);
-
-  //// Lower ////
-  if (__uplo == 'l') {
-    if (__diag == 'u') {
-      R() = SerialTrtriInternalLower<Algo::Trtri::Unblocked>::invoke(
-          Diag::Unit::use_unit_diag, A.extent(0), A.extent(1), A.data(),
-          A.stride(0), A.stride(1));
+// Native recursive blocked triangular inversion. With uplo = "L",
+//   [A11   0 ]^{-1}   [ X11     0 ]
+//   [A21  A22]      = [ X21    X22]
+// with X11 = A11^{-1}, X22 = A22^{-1} and X21 = -X22 * A21 * X11. The
+// diagonal blocks of nb columns are all inverted by a single kernel, one
+// thread per block, then the off-diagonal blocks are formed bottom-up by
+// two KokkosBlas::trmm per level of the recursion, which for large A hold
+// nearly all of the flops in the GEMMs of the recursive TRMM.
+// uplo = "U" is the transpose of the same steps, X12 = -X11 * A12 * X22.
+
+// Invert the diagonal block A(b*nb:(b+1)*nb, b*nb:(b+1)*nb) with thread b
+template <class AMatrix>
+struct TrtriDiagFunctor {
+  AMatrix A;
+  int nb;
+  bool lower;
+
+  TrtriDiagFunctor(const AMatrix &A_, const int nb_, const bool lower_)
+      : A(A_), nb(nb_), lower(lower_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const int b) const {
+    using KokkosBatched::Algo;
+    using KokkosBatched::Diag;
+    const int k  = b * nb;
+    const int kb = Kokkos::min(nb, A.extent_int(0) - k);
+    auto *a      = &A(k, k);
+    if (lower) {
+      KokkosBatched::SerialTrtriInternalLower<Algo::Trtri::Unblocked>::invoke(
+          Diag::NonUnit::use_unit_diag, kb, kb, a, A.stride(0), A.stride(1));
     } else {
-      R() = SerialTrtriInternalLower<Algo::Trtri::Unblocked>::invoke(
-          Diag::NonUnit::use_unit_diag, A.extent(0), A.extent(1), A.data(),
-          A.stride(0), A.stride(1));
+      KokkosBatched::SerialTrtriInternalUpper<Algo::Trtri::Unblocked>::invoke(
+          Diag::NonUnit::use_unit_diag, kb, kb, a, A.stride(0), A.stride(1));
     }
+  }
+};
+
+// Form the off-diagonal blocks of the inverse of A, whose diagonal blocks
+// of nb columns are already inverted
+template <class ExecutionSpace, class AMatrix>
+void trtri_native_recursive(const ExecutionSpace &space, const bool lower,
+                            const int nb, const AMatrix &A) {
+  using scalar_type = typename AMatrix::non_const_value_type;
+
+  const int n = A.extent_int(0);
+  if (n <= nb) return;
+
+  // Split at k, a multiple of the block size close to n / 2, so that the
+  // halves are made of whole diagonal blocks
+  const int k    = ((n / 2 + nb - 1) / nb) * nb;
+  const auto p1  = Kokkos::make_pair(0, k);
+  const auto p2  = Kokkos::make_pair(k, n);
+  const auto X11 = Kokkos::subview(A, p1, p1);
+  const auto X22 = Kokkos::subview(A, p2, p2);
+  const scalar_type one(1);
+
+  trtri_native_recursive(space, lower, nb, X11);
+  trtri_native_recursive(space, lower, nb, X22);
+  if (lower) {
+    auto A21 = Kokkos::subview(A, p2, p1);
+    KokkosBlas::trmm(space, "L", "L", "N", "N", -one, X22, A21);
+    KokkosBlas::trmm(space, "R", "L", "N", "N", one, X11, A21);
   } else {
-    //// Upper ////
-    if (__diag == 'u') {
-      R() = SerialTrtriInternalUpper<Algo::Trtri::Unblocked>::invoke(
-          Diag::Unit::use_unit_diag, A.extent(0), A.extent(1), A.data(),
-          A.stride(0), A.stride(1));
-    } else {
-      R() = SerialTrtriInternalUpper<Algo::Trtri::Unblocked>::invoke(
-          Diag::NonUnit::use_unit_diag, A.extent(0), A.extent(1), A.data(),
-          A.stride(0), A.stride(1));
-    }
+    auto A12 = Kokkos::subview(A, p1, p2);
+    KokkosBlas::trmm(space, "L", "U", "N", "N", -one, X11, A12);
+    KokkosBlas::trmm(space, "R", "U", "N", "N", one, X22, A12);
   }
 }
+
+// Returns 0 on success, or i if A(i-1, i-1) is zero, in which case A is not
+// modified, as in LAPACK.
+template <class ExecutionSpace, class AMatrix>
+int trtri_native(const ExecutionSpace &space, const char uplo[],
+                 const char diag[], const AMatrix &A) {
+  using scalar_type = typename AMatrix::non_const_value_type;
+  using range_type  = Kokkos::RangePolicy<ExecutionSpace>;
+  using diag_type =
+      Kokkos::View<scalar_type *, typename AMatrix::device_type>;
+
+  const int n = A.extent_int(0);
+  const int nb =
+      KokkosKernels::Impl::kk_is_gpu_exec_space<ExecutionSpace>() ? 64 : 32;
+  const bool lower = (uplo[0] == 'L') || (uplo[0] == 'l');
+  const bool unit  = (diag[0] == 'U') || (diag[0] == 'u');
+
+  if (!unit) {
+    int first_zero = n;
+    Kokkos::parallel_reduce(
+        "KokkosLapack::trtri[check diag]", range_type(space, 0, n),
+        KOKKOS_LAMBDA(const int i, int &update) {
+          if ((A(i, i) == scalar_type(0)) && (i < update)) update = i;
+        },
+        Kokkos::Min<int>(first_zero));
+    if (first_zero < n) return first_zero + 1;
+  }
+
+  // The diagonal of a unit triangular A is not referenced: it is set to one
+  // during the inversion, which the TRMM kernels then read, and restored.
+  diag_type D;
+  if (unit) {
+    D = diag_type(Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                                     "KokkosLapack::trtri::diag"),
+                  n);
+    Kokkos::parallel_for(
+        "KokkosLapack::trtri[unit diag]", range_type(space, 0, n),
+        KOKKOS_LAMBDA(const int i) {
+          D(i)    = A(i, i);
+          A(i, i) = scalar_type(1);
+        });
+  }
+
+  Kokkos::parallel_for("KokkosLapack::trtri[diag blocks]",
+                       range_type(space, 0, (n + nb - 1) / nb),
+                       TrtriDiagFunctor<AMatrix>(A, nb, lower));
+  trtri_native_recursive(space, lower, nb, A);
+
+  if (unit) {
+    Kokkos::parallel_for(
+        "KokkosLapack::trtri[unit diag]", range_type(space, 0, n),
+        KOKKOS_LAMBDA(const int i) { A(i, i) = D(i); });
+  }
+  return 0;
+}
+
 }  // namespace Impl
 }  // namespace KokkosLapack
 #endif  // KOKKOSLAPACK_TRTRI_IMPL_HPP_
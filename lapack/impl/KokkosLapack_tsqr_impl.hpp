@@ -0,0 +1,354 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSLAPACK_IMPL_TSQR_HPP_
+#define KOKKOSLAPACK_IMPL_TSQR_HPP_
+
+/// \file KokkosLapack_tsqr_impl.hpp
+/// \brief Native communication-avoiding QR of tall-skinny matrices.
+
+#include <vector>
+
+#include <KokkosKernels_config.h>
+#include <Kokkos_Core.hpp>
+#include <KokkosBatched_QR_Decl.hpp>
+#include <KokkosBatched_ApplyQ_Decl.hpp>
+
+namespace KokkosLapack {
+namespace Impl {
+
+// Tall-skinny QR (TSQR) of the M-by-N matrix A, M >= N.
+//
+// The rows of A are split into p leaf blocks of at least mb >= 2N rows, each
+// leaf is factored by one team with KokkosBatched::TeamVectorQR. The N-by-N
+// R factors are then reduced in a binary tree: at every level the R factors
+// of two siblings are stacked into a 2N-by-N matrix which is factored again
+// by one team. The root holds R. The explicit Q is built top-down: starting
+// from E = I at the root, each node computes Q_node [E; 0] and hands the two
+// N-by-N halves to its children, and finally each leaf computes its block
+// of Q as Q_leaf [E_leaf; 0]. Only the small R factors move between teams,
+// the leaves are read once for the factorization and written once for Q.
+//
+// The reflectors are kept in the KokkosBatched convention throughout, they
+// never leave this implementation.
+
+template <class ViewType>
+KOKKOS_INLINE_FUNCTION auto tsqr_leaf_rows(const ViewType &V, const int i,
+                                           const int mb, const int p) {
+  const int begin = i * mb;
+  const int end   = (i == p - 1) ? V.extent_int(0) : begin + mb;
+  return Kokkos::subview(V, Kokkos::make_pair(begin, end), Kokkos::ALL);
+}
+
+// Factor the leaf blocks of V, one team per block
+template <class VMatrix, class TauArray, class WorkArray>
+struct TsqrLeafQRFunctor {
+  VMatrix V;
+  TauArray T;
+  WorkArray W;
+  int mb, p;
+
+  TsqrLeafQRFunctor(const VMatrix &V_, const TauArray &T_,
+                    const WorkArray &W_, const int mb_, const int p_)
+      : V(V_), T(T_), W(W_), mb(mb_), p(p_) {}
+
+  template <class MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType &member) const {
+    const int i = member.league_rank();
+    KokkosBatched::TeamVectorQR<MemberType, KokkosBatched::Algo::QR::Blocked>::
+        invoke(member, tsqr_leaf_rows(V, i, mb, p),
+               Kokkos::subview(T, i, Kokkos::ALL),
+               Kokkos::subview(W, i, Kokkos::ALL));
+  }
+};
+
+// Copy the R factor of leaf i into R(i, :, :) with zeros below the diagonal
+template <class VMatrix, class RArray>
+struct TsqrLeafRFunctor {
+  VMatrix V;
+  RArray R;
+  int mb, n;
+
+  TsqrLeafRFunctor(const VMatrix &V_, const RArray &R_, const int mb_)
+      : V(V_), R(R_), mb(mb_), n(V_.extent_int(1)) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const int idx) const {
+    const int i = idx / (n * n), r = (idx / n) % n, c = idx % n;
+    R(i, r, c)  = (r <= c) ? V(i * mb + r, c) : typename RArray::value_type(0);
+  }
+};
+
+// Stack the upper triangles of the R factors of the children 2j and 2j + 1
+// into S(j, :, :). A last child without sibling is stacked over zeros.
+template <class RArray>
+struct TsqrStackFunctor {
+  RArray R, S;
+  int n;
+
+  TsqrStackFunctor(const RArray &R_, const RArray &S_)
+      : R(R_), S(S_), n(R_.extent_int(2)) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const int idx) const {
+    const int j = idx / (2 * n * n), r = (idx / n) % (2 * n), c = idx % n;
+    const int child = 2 * j + r / n, rc = r % n;
+    S(j, r, c) = ((child < R.extent_int(0)) && (rc <= c))
+                     ? R(child, rc, c)
+                     : typename RArray::value_type(0);
+  }
+};
+
+// Factor the stacked 2N-by-N matrices of one tree level, one team per node
+template <class RArray, class TauArray, class WorkArray>
+struct TsqrNodeQRFunctor {
+  RArray S;
+  TauArray T;
+  WorkArray W;
+
+  TsqrNodeQRFunctor(const RArray &S_, const TauArray &T_, const WorkArray &W_)
+      : S(S_), T(T_), W(W_) {}
+
+  template <class MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType &member) const {
+    const int j = member.league_rank();
+    KokkosBatched::TeamVectorQR<MemberType, KokkosBatched::Algo::QR::Blocked>::
+        invoke(member, Kokkos::subview(S, j, Kokkos::ALL, Kokkos::ALL),
+               Kokkos::subview(T, j, Kokkos::ALL),
+               Kokkos::subview(W, j, Kokkos::ALL));
+  }
+};
+
+// F(j, :, :) = [E_j; 0] where E_j is the half j % 2 of the parent's
+// F(j / 2, :, :), or the identity at the root
+template <class RArray>
+struct TsqrInitNodeQFunctor {
+  RArray F, F_parent;
+  int n;
+  bool root;
+
+  TsqrInitNodeQFunctor(const RArray &F_, const RArray &F_parent_,
+                       const bool root_)
+      : F(F_), F_parent(F_parent_), n(F_.extent_int(2)), root(root_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const int idx) const {
+    using value_type = typename RArray::value_type;
+    const int j = idx / (2 * n * n), r = (idx / n) % (2 * n), c = idx % n;
+    if (r >= n) {
+      F(j, r, c) = value_type(0);
+    } else if (root) {
+      F(j, r, c) = (r == c) ? value_type(1) : value_type(0);
+    } else {
+      F(j, r, c) = F_parent(j / 2, (j % 2) * n + r, c);
+    }
+  }
+};
+
+// Q(i * mb:, :) = [E_i; 0] for the leaf blocks, E_i as above
+template <class AMatrix, class RArray>
+struct TsqrInitLeafQFunctor {
+  AMatrix Q;
+  RArray F_parent;
+  int mb, p, n;
+
+  TsqrInitLeafQFunctor(const AMatrix &Q_, const RArray &F_parent_,
+                       const int mb_, const int p_)
+      : Q(Q_), F_parent(F_parent_), mb(mb_), p(p_), n(Q_.extent_int(1)) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const int idx) const {
+    using value_type = typename AMatrix::non_const_value_type;
+    const int row = idx / n, c = idx % n;
+    const int i   = Kokkos::min(row / mb, p - 1), r = row - i * mb;
+    if (r >= n) {
+      Q(row, c) = value_type(0);
+    } else if (p == 1) {
+      Q(row, c) = (r == c) ? value_type(1) : value_type(0);
+    } else {
+      Q(row, c) = F_parent(i / 2, (i % 2) * n + r, c);
+    }
+  }
+};
+
+// Apply the Q factors of one tree level to F, one team per node
+template <class RArray, class TauArray, class WorkArray>
+struct TsqrNodeApplyQFunctor {
+  RArray S, F;
+  TauArray T;
+  WorkArray W;
+
+  TsqrNodeApplyQFunctor(const RArray &S_, const RArray &F_, const TauArray &T_,
+                        const WorkArray &W_)
+      : S(S_), F(F_), T(T_), W(W_) {}
+
+  template <class MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType &member) const {
+    const int j = member.league_rank();
+    using apply_q = KokkosBatched::TeamVectorApplyQ<
+        MemberType, KokkosBatched::Side::Left,
+        KokkosBatched::Trans::NoTranspose,
+        KokkosBatched::Algo::ApplyQ::Blocked>;
+
+    apply_q::invoke(member, Kokkos::subview(S, j, Kokkos::ALL, Kokkos::ALL),
+                    Kokkos::subview(T, j, Kokkos::ALL),
+                    Kokkos::subview(F, j, Kokkos::ALL, Kokkos::ALL),
+                    Kokkos::subview(W, j, Kokkos::ALL));
+  }
+};
+
+// Apply the Q factors of the leaves to the blocks of Q, one team per leaf
+template <class AMatrix, class VMatrix, class TauArray, class WorkArray>
+struct TsqrLeafApplyQFunctor {
+  AMatrix Q;
+  VMatrix V;
+  TauArray T;
+  WorkArray W;
+  int mb, p;
+
+  TsqrLeafApplyQFunctor(const AMatrix &Q_, const VMatrix &V_,
+                        const TauArray &T_, const WorkArray &W_, const int mb_,
+                        const int p_)
+      : Q(Q_), V(V_), T(T_), W(W_), mb(mb_), p(p_) {}
+
+  template <class MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType &member) const {
+    const int i = member.league_rank();
+    using apply_q = KokkosBatched::TeamVectorApplyQ<
+        MemberType, KokkosBatched::Side::Left,
+        KokkosBatched::Trans::NoTranspose,
+        KokkosBatched::Algo::ApplyQ::Blocked>;
+
+    apply_q::invoke(member, tsqr_leaf_rows(V, i, mb, p),
+                    Kokkos::subview(T, i, Kokkos::ALL),
+                    tsqr_leaf_rows(Q, i, mb, p),
+                    Kokkos::subview(W, i, Kokkos::ALL));
+  }
+};
+
+// Copy the upper triangle of the root into R
+template <class RArray, class RMatrix>
+struct TsqrRootRFunctor {
+  RArray S;
+  RMatrix R;
+  int n;
+
+  TsqrRootRFunctor(const RArray &S_, const RMatrix &R_)
+      : S(S_), R(R_), n(R_.extent_int(1)) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const int idx) const {
+    const int r = idx / n, c = idx % n;
+    R(r, c) = (r <= c) ? S(0, r, c) : typename RMatrix::non_const_value_type(0);
+  }
+};
+
+template <class ExecutionSpace, class AMatrix, class RMatrix>
+void tsqr_native(const ExecutionSpace &space, const AMatrix &A,
+                 const RMatrix &R) {
+  using scalar_type  = typename AMatrix::non_const_value_type;
+  using memory_space = typename AMatrix::memory_space;
+  using team_policy  = Kokkos::TeamPolicy<ExecutionSpace>;
+  using range_policy = Kokkos::RangePolicy<ExecutionSpace>;
+  using v_matrix =
+      Kokkos::View<scalar_type **, Kokkos::LayoutLeft, memory_space>;
+  using r_array = Kokkos::View<scalar_type ***, memory_space>;
+  using t_array = Kokkos::View<scalar_type **, memory_space>;
+  constexpr int nb =
+      KokkosBatched::TeamVectorHouseholderWY_Internal::max_block_size;
+
+  const int m  = A.extent_int(0);
+  const int n  = A.extent_int(1);
+  const int mb = Kokkos::max(2 * n, 512);
+  const int p  = Kokkos::max(m / mb, 1);
+
+  // The leaves are factored in a copy of A which is overwritten by Q
+  v_matrix V(Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                                "tsqr leaf factors"),
+             m, n);
+  t_array T_leaf(Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                                    "tsqr leaf tau"),
+                 p, n);
+  t_array W(Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                               "tsqr workspace"),
+            p, nb * (nb + n));
+  Kokkos::deep_copy(space, V, A);
+
+  Kokkos::parallel_for("KokkosLapack::tsqr[leaf QR]",
+                       team_policy(space, p, Kokkos::AUTO),
+                       TsqrLeafQRFunctor<v_matrix, t_array, t_array>(
+                           V, T_leaf, W, mb, p));
+
+  // Reduction tree, level l factors the (p_l + 1) / 2 stacked pairs of the
+  // R factors of level l - 1, the leaves being level -1
+  r_array R_leaf(Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                                    "tsqr leaf R"),
+                 p, n, n);
+  Kokkos::parallel_for(
+      "KokkosLapack::tsqr[leaf R]", range_policy(space, 0, p * n * n),
+      TsqrLeafRFunctor<v_matrix, r_array>(V, R_leaf, mb));
+
+  std::vector<r_array> S;
+  std::vector<t_array> T;
+  for (int nodes = p; nodes > 1;) {
+    const r_array children = S.empty() ? R_leaf : S.back();
+    nodes                  = (nodes + 1) / 2;
+    S.emplace_back(Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                                      "tsqr node factors"),
+                   nodes, 2 * n, n);
+    T.emplace_back(Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                                      "tsqr node tau"),
+                   nodes, n);
+    Kokkos::parallel_for(
+        "KokkosLapack::tsqr[stack]",
+        range_policy(space, 0, nodes * 2 * n * n),
+        TsqrStackFunctor<r_array>(children, S.back()));
+    Kokkos::parallel_for("KokkosLapack::tsqr[node QR]",
+                         team_policy(space, nodes, Kokkos::AUTO),
+                         TsqrNodeQRFunctor<r_array, t_array, t_array>(
+                             S.back(), T.back(), W));
+  }
+
+  Kokkos::parallel_for(
+      "KokkosLapack::tsqr[R]", range_policy(space, 0, n * n),
+      TsqrRootRFunctor<r_array, RMatrix>(S.empty() ? R_leaf : S.back(), R));
+
+  // Explicit Q, from the root down to the leaves
+  r_array F_parent;
+  for (int l = static_cast<int>(S.size()) - 1; l >= 0; --l) {
+    const int nodes = S[l].extent_int(0);
+    r_array F(Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                                 "tsqr node Q"),
+              nodes, 2 * n, n);
+    Kokkos::parallel_for(
+        "KokkosLapack::tsqr[init node Q]",
+        range_policy(space, 0, nodes * 2 * n * n),
+        TsqrInitNodeQFunctor<r_array>(F, F_parent, F_parent.size() == 0));
+    Kokkos::parallel_for("KokkosLapack::tsqr[node Q]",
+                         team_policy(space, nodes, Kokkos::AUTO),
+                         TsqrNodeApplyQFunctor<r_array, t_array, t_array>(
+                             S[l], F, T[l], W));
+    F_parent = F;
+  }
+
+  Kokkos::parallel_for(
+      "KokkosLapack::tsqr[init leaf Q]", range_policy(space, 0, m * n),
+      TsqrInitLeafQFunctor<AMatrix, r_array>(A, F_parent, mb, p));
+  Kokkos::parallel_for(
+      "KokkosLapack::tsqr[leaf Q]", team_policy(space, p, Kokkos::AUTO),
+      TsqrLeafApplyQFunctor<AMatrix, v_matrix, t_array, t_array>(
+          A, V, T_leaf, W, mb, p));
+}
+
+}  // namespace Impl
+}  // namespace KokkosLapack
+
+#endif  // KOKKOSLAPACK_IMPL_TSQR_HPP_
@@ -0,0 +1,133 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file KokkosLapack_geqrf.hpp
+/// \brief QR factorization
+///
+/// This file provides KokkosLapack::geqrf. This function computes the QR
+/// factorization of a general M-by-N matrix, A = Q * R, with Q stored as a
+/// product of elementary reflectors.
+
+#ifndef KOKKOSLAPACK_GEQRF_HPP_
+#define KOKKOSLAPACK_GEQRF_HPP_
+
+#include <sstream>
+#include <type_traits>
+
+#include "KokkosLapack_geqrf_spec.hpp"
+#include "KokkosKernels_Error.hpp"
+
+namespace KokkosLapack {
+
+/// \brief Compute the QR factorization of the matrix A.
+///
+/// On exit, the elements on and above the diagonal of A contain the
+/// min(M,N)-by-N upper trapezoidal matrix R, the elements below the diagonal
+/// together with Tau represent Q as a product of min(M,N) elementary
+/// reflectors, Q = H(1) H(2) ... H(k) with H(i) = I - Tau(i) v v^H and
+/// v(i) = 1, exactly as LAPACK's xGEQRF. Q can be applied with
+/// KokkosLapack::ormqr.
+///
+/// \tparam ExecutionSpace the space where the kernel will run.
+/// \tparam AMatrix Input matrix/Output factors, as a 2-D Kokkos::View.
+/// \tparam TauArray Output scalar factors of the reflectors, as a 1-D
+///   Kokkos::View.
+///
+/// \param space [in] execution space instance used to specified how to execute
+///   the geqrf kernels.
+/// \param A [in,out] On entry, the M-by-N matrix to be factored.
+///   On exit, R and the reflectors as described above.
+/// \param Tau [out] One-dimensional array of size at least min(M,N), the
+///   scalar factors of the elementary reflectors.
+/// \return 0 upon success.
+///
+template <class ExecutionSpace, class AMatrix, class TauArray>
+int geqrf(const ExecutionSpace& space, const AMatrix& A, const TauArray& Tau) {
+  // NOTE: KokkosLapack::geqrf calls the LAPACK or cuSOLVER TPL when one is
+  //       enabled for the views' memory space, otherwise a native blocked
+  //       factorization built on KokkosBatched::TeamVectorQR is used, for
+  //       real scalars only.
+
+  static_assert(
+      Kokkos::SpaceAccessibility<ExecutionSpace,
+                                 typename AMatrix::memory_space>::accessible);
+  static_assert(
+      Kokkos::SpaceAccessibility<ExecutionSpace,
+                                 typename TauArray::memory_space>::accessible);
+  static_assert(Kokkos::is_view<AMatrix>::value,
+                "KokkosLapack::geqrf: A must be a Kokkos::View.");
+  static_assert(Kokkos::is_view<TauArray>::value,
+                "KokkosLapack::geqrf: Tau must be Kokkos::View.");
+  static_assert(static_cast<int>(AMatrix::rank) == 2,
+                "KokkosLapack::geqrf: A must have rank 2.");
+  static_assert(static_cast<int>(TauArray::rank) == 1,
+                "KokkosLapack::geqrf: Tau must have rank 1.");
+  static_assert(
+      std::is_same_v<typename AMatrix::non_const_value_type,
+                     typename TauArray::non_const_value_type>,
+      "KokkosLapack::geqrf: A and Tau must have the same value type.");
+
+  const int64_t m = A.extent(0);
+  const int64_t n = A.extent(1);
+  const int64_t k = Kokkos::min(m, n);
+
+  if (static_cast<int64_t>(Tau.extent(0)) < k) {
+    std::ostringstream os;
+    os << "KokkosLapack::geqrf: Tau must have at least min(M,N) = " << k
+       << " entries, Tau: " << Tau.extent(0);
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  // Return if degenerated matrices are provided
+  if (k == 0) return 0;
+
+  typedef Kokkos::View<
+      typename AMatrix::non_const_value_type**, typename AMatrix::array_layout,
+      typename AMatrix::device_type, Kokkos::MemoryTraits<Kokkos::Unmanaged> >
+      AMatrix_Internal;
+  typedef Kokkos::View<typename TauArray::non_const_value_type*,
+                       typename TauArray::array_layout,
+                       typename TauArray::device_type,
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged> >
+      TauArray_Internal;
+  AMatrix_Internal A_i    = A;
+  TauArray_Internal Tau_i = Tau;
+
+  return KokkosLapack::Impl::GEQRF<ExecutionSpace, AMatrix_Internal,
+                                   TauArray_Internal>::geqrf(space, A_i,
+                                                             Tau_i);
+}
+
+/// \brief Compute the QR factorization of the matrix A.
+///
+/// \tparam AMatrix Input matrix/Output factors, as a 2-D Kokkos::View.
+/// \tparam TauArray Output scalar factors of the reflectors, as a 1-D
+///   Kokkos::View.
+///
+/// \param A [in,out] On entry, the M-by-N matrix to be factored.
+///   On exit, R and the reflectors representing Q.
+/// \param Tau [out] One-dimensional array of size at least min(M,N).
+/// \return 0 upon success.
+///
+template <class AMatrix, class TauArray>
+int geqrf(const AMatrix& A, const TauArray& Tau) {
+  typename AMatrix::execution_space space{};
+  return geqrf(space, A, Tau);
+}
+
+}  // namespace KokkosLapack
+
+#endif  // KOKKOSLAPACK_GEQRF_HPP_
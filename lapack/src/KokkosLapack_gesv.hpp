@@ -55,11 +55,12 @@ namespace KokkosLapack {
 template <class ExecutionSpace, class AMatrix, class BXMV, class IPIVV>
 void gesv(const ExecutionSpace& space, const AMatrix& A, const BXMV& B,
           const IPIVV& IPIV) {
-  // NOTE: Currently, KokkosLapack::gesv only supports LAPACK, MAGMA and
-  // rocSOLVER TPLs.
+  // NOTE: KokkosLapack::gesv calls the LAPACK, MAGMA, cuSOLVER or rocSOLVER
+  //       TPL when one is enabled for the views' memory space.
   //       MAGMA/rocSOLVER TPL should be enabled to call the MAGMA/rocSOLVER GPU
   //       interface for device views LAPACK TPL should be enabled to call the
-  //       LAPACK interface for host views
+  //       LAPACK interface for host views. Otherwise a native blocked LU
+  //       factorization built on KokkosBlas::trsm/gemm is used.
 
   static_assert(
       Kokkos::SpaceAccessibility<ExecutionSpace,
@@ -0,0 +1,168 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file KokkosLapack_ormqr.hpp
+/// \brief Multiply by the orthogonal factor of a QR factorization
+///
+/// This file provides KokkosLapack::ormqr. This function overwrites a general
+/// M-by-N matrix C with Q * C, Q^H * C, C * Q or C * Q^H where Q is the
+/// orthogonal (unitary) matrix returned by KokkosLapack::geqrf.
+
+#ifndef KOKKOSLAPACK_ORMQR_HPP_
+#define KOKKOSLAPACK_ORMQR_HPP_
+
+#include <sstream>
+#include <type_traits>
+
+#include "KokkosLapack_ormqr_spec.hpp"
+#include "KokkosKernels_Error.hpp"
+
+namespace KokkosLapack {
+
+/// \brief Apply the orthogonal (unitary) factor Q of a QR factorization,
+/// computed by KokkosLapack::geqrf, to the matrix C.
+///
+/// \tparam ExecutionSpace the space where the kernel will run.
+/// \tparam AMatrix Input reflectors, as a 2-D Kokkos::View.
+/// \tparam TauArray Input scalar factors of the reflectors, as a 1-D
+///   Kokkos::View.
+/// \tparam CMatrix Input/Output matrix, as a 2-D Kokkos::View.
+///
+/// \param space [in] execution space instance used to specified how to execute
+///   the ormqr kernels.
+/// \param side [in] "L" or "l": apply Q from the left, "R" or "r": apply Q
+///   from the right.
+/// \param trans [in] "N" or "n": apply Q, "T" or "t": apply Q^T (real
+///   scalars only), "C" or "c": apply Q^H.
+/// \param A [in] The M-by-K (side = "L") or N-by-K (side = "R") matrix
+///   returned by geqrf, the first K = min(A.extent(0), A.extent(1)) columns
+///   hold the reflectors.
+/// \param Tau [in] One-dimensional array of size at least K returned by
+///   geqrf.
+/// \param C [in,out] On entry, the M-by-N matrix C. On exit, C is overwritten
+///   by Q * C, Q^H * C, C * Q or C * Q^H.
+/// \return 0 upon success.
+///
+template <class ExecutionSpace, class AMatrix, class TauArray, class CMatrix>
+int ormqr(const ExecutionSpace& space, const char side[], const char trans[],
+          const AMatrix& A, const TauArray& Tau, const CMatrix& C) {
+  // NOTE: KokkosLapack::ormqr calls the LAPACK or cuSOLVER TPL when one is
+  //       enabled for the views' memory space, otherwise a native blocked
+  //       implementation built on KokkosBatched::TeamVectorApplyQ is used,
+  //       for real scalars only.
+
+  static_assert(
+      Kokkos::SpaceAccessibility<ExecutionSpace,
+                                 typename AMatrix::memory_space>::accessible);
+  static_assert(
+      Kokkos::SpaceAccessibility<ExecutionSpace,
+                                 typename TauArray::memory_space>::accessible);
+  static_assert(
+      Kokkos::SpaceAccessibility<ExecutionSpace,
+                                 typename CMatrix::memory_space>::accessible);
+  static_assert(Kokkos::is_view<AMatrix>::value,
+                "KokkosLapack::ormqr: A must be a Kokkos::View.");
+  static_assert(Kokkos::is_view<TauArray>::value,
+                "KokkosLapack::ormqr: Tau must be Kokkos::View.");
+  static_assert(Kokkos::is_view<CMatrix>::value,
+                "KokkosLapack::ormqr: C must be a Kokkos::View.");
+  static_assert(static_cast<int>(AMatrix::rank) == 2,
+                "KokkosLapack::ormqr: A must have rank 2.");
+  static_assert(static_cast<int>(TauArray::rank) == 1,
+                "KokkosLapack::ormqr: Tau must have rank 1.");
+  static_assert(static_cast<int>(CMatrix::rank) == 2,
+                "KokkosLapack::ormqr: C must have rank 2.");
+
+  using scalar_type = typename CMatrix::non_const_value_type;
+
+  const bool is_left  = (side[0] == 'L') || (side[0] == 'l');
+  const bool is_right = (side[0] == 'R') || (side[0] == 'r');
+  if (!(is_left || is_right)) {
+    std::ostringstream os;
+    os << "KokkosLapack::ormqr: side = '" << side[0] << "'. "
+       << "Valid values include 'L' or 'l' (Q * C), 'R' or 'r' (C * Q).";
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  const bool is_notrans = (trans[0] == 'N') || (trans[0] == 'n');
+  const bool is_trans   = (trans[0] == 'T') || (trans[0] == 't');
+  const bool is_conj    = (trans[0] == 'C') || (trans[0] == 'c');
+  if (!(is_notrans || is_trans || is_conj) ||
+      (is_trans && Kokkos::ArithTraits<scalar_type>::is_complex)) {
+    std::ostringstream os;
+    os << "KokkosLapack::ormqr: trans = '" << trans[0] << "'. "
+       << "Valid values include 'N' or 'n' (Q), 'C' or 'c' (Q^H) and, "
+          "for real scalars only, 'T' or 't' (Q^T).";
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  const int64_t nq = is_left ? C.extent(0) : C.extent(1);
+  const int64_t k  = Kokkos::min<int64_t>(A.extent(0), A.extent(1));
+  if ((static_cast<int64_t>(A.extent(0)) != nq) ||
+      (static_cast<int64_t>(Tau.extent(0)) < k)) {
+    std::ostringstream os;
+    os << "KokkosLapack::ormqr: Dimensions of A, Tau and C do not match: "
+       << "side: " << side[0] << " A: " << A.extent(0) << " x "
+       << A.extent(1) << ", Tau: " << Tau.extent(0) << ", C: " << C.extent(0)
+       << " x " << C.extent(1);
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  // Return if degenerated matrices are provided
+  if ((k == 0) || (C.extent(0) == 0) || (C.extent(1) == 0)) return 0;
+
+  typedef Kokkos::View<
+      typename AMatrix::non_const_value_type**, typename AMatrix::array_layout,
+      typename AMatrix::device_type, Kokkos::MemoryTraits<Kokkos::Unmanaged> >
+      AMatrix_Internal;
+  typedef Kokkos::View<typename TauArray::non_const_value_type*,
+                       typename TauArray::array_layout,
+                       typename TauArray::device_type,
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged> >
+      TauArray_Internal;
+  typedef Kokkos::View<
+      typename CMatrix::non_const_value_type**, typename CMatrix::array_layout,
+      typename CMatrix::device_type, Kokkos::MemoryTraits<Kokkos::Unmanaged> >
+      CMatrix_Internal;
+  AMatrix_Internal A_i    = A;
+  TauArray_Internal Tau_i = Tau;
+  CMatrix_Internal C_i    = C;
+
+  return KokkosLapack::Impl::ORMQR<
+      ExecutionSpace, AMatrix_Internal, TauArray_Internal,
+      CMatrix_Internal>::ormqr(space, side, trans, A_i, Tau_i, C_i);
+}
+
+/// \brief Apply the orthogonal (unitary) factor Q of a QR factorization,
+/// computed by KokkosLapack::geqrf, to the matrix C.
+///
+/// \param side [in] "L" or "l": Q from the left, "R" or "r": from the right.
+/// \param trans [in] "N" or "n": Q, "T" or "t": Q^T, "C" or "c": Q^H.
+/// \param A [in] The reflectors returned by geqrf.
+/// \param Tau [in] The scalar factors returned by geqrf.
+/// \param C [in,out] The M-by-N matrix C, overwritten by the product.
+/// \return 0 upon success.
+///
+template <class AMatrix, class TauArray, class CMatrix>
+int ormqr(const char side[], const char trans[], const AMatrix& A,
+          const TauArray& Tau, const CMatrix& C) {
+  typename CMatrix::execution_space space{};
+  return ormqr(space, side, trans, A, Tau, C);
+}
+
+}  // namespace KokkosLapack
+
+#endif  // KOKKOSLAPACK_ORMQR_HPP_
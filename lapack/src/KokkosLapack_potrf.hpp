@@ -0,0 +1,115 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file KokkosLapack_potrf.hpp
+/// \brief Cholesky factorization
+///
+/// This file provides KokkosLapack::potrf. This function computes the
+/// Cholesky factorization of a Hermitian positive definite N-by-N matrix,
+/// A = L * L^H or A = U^H * U.
+
+#ifndef KOKKOSLAPACK_POTRF_HPP_
+#define KOKKOSLAPACK_POTRF_HPP_
+
+#include <sstream>
+#include <type_traits>
+
+#include "KokkosLapack_potrf_spec.hpp"
+#include "KokkosKernels_Error.hpp"
+
+namespace KokkosLapack {
+
+/// \brief Compute the Cholesky factorization of the Hermitian positive
+/// definite matrix A.
+///
+/// \tparam ExecutionSpace the space where the kernel will run.
+/// \tparam AMatrix Input matrix/Output factor, as a 2-D Kokkos::View.
+///
+/// \param space [in] execution space instance used to specified how to execute
+///   the potrf kernels.
+/// \param uplo [in] "U" or "u": A = U^H * U and the upper triangle of A is
+///   referenced, "L" or "l": A = L * L^H and the lower triangle of A is
+///   referenced.
+/// \param A [in,out] On entry, the N-by-N Hermitian positive definite matrix.
+///   On exit, the factor U or L in the triangle given by uplo, the other
+///   triangle is not referenced.
+/// \return 0 upon success, i if the leading minor of order i is not positive
+///   definite and the factorization could not be completed.
+///
+template <class ExecutionSpace, class AMatrix>
+int potrf(const ExecutionSpace& space, const char uplo[], const AMatrix& A) {
+  // NOTE: KokkosLapack::potrf calls the LAPACK, MAGMA or cuSOLVER TPL when
+  //       one is enabled for the views' memory space, otherwise a native
+  //       blocked factorization built on KokkosBlas::trsm/herk is used.
+
+  static_assert(
+      Kokkos::SpaceAccessibility<ExecutionSpace,
+                                 typename AMatrix::memory_space>::accessible);
+  static_assert(Kokkos::is_view<AMatrix>::value,
+                "KokkosLapack::potrf: A must be a Kokkos::View.");
+  static_assert(static_cast<int>(AMatrix::rank) == 2,
+                "KokkosLapack::potrf: A must have rank 2.");
+
+  const bool valid_uplo = (uplo[0] == 'U') || (uplo[0] == 'u') ||
+                          (uplo[0] == 'L') || (uplo[0] == 'l');
+  if (!valid_uplo) {
+    std::ostringstream os;
+    os << "KokkosLapack::potrf: uplo = '" << uplo[0] << "'. "
+       << "Valid values include 'U' or 'u' (A = U^H * U), "
+          "'L' or 'l' (A = L * L^H).";
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  if (A.extent(0) != A.extent(1)) {
+    std::ostringstream os;
+    os << "KokkosLapack::potrf: A must be square,"
+       << " A: " << A.extent(0) << " x " << A.extent(1);
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  // Return if degenerated matrices are provided
+  if (A.extent(0) == 0) return 0;
+
+  typedef Kokkos::View<
+      typename AMatrix::non_const_value_type**, typename AMatrix::array_layout,
+      typename AMatrix::device_type, Kokkos::MemoryTraits<Kokkos::Unmanaged> >
+      AMatrix_Internal;
+  AMatrix_Internal A_i = A;
+
+  return KokkosLapack::Impl::POTRF<ExecutionSpace, AMatrix_Internal>::potrf(
+      space, uplo, A_i);
+}
+
+/// \brief Compute the Cholesky factorization of the Hermitian positive
+/// definite matrix A.
+///
+/// \tparam AMatrix Input matrix/Output factor, as a 2-D Kokkos::View.
+///
+/// \param uplo [in] "U" or "u": A = U^H * U, "L" or "l": A = L * L^H.
+/// \param A [in,out] On entry, the N-by-N Hermitian positive definite matrix.
+///   On exit, the factor U or L in the triangle given by uplo.
+/// \return 0 upon success, i if the leading minor of order i is not positive
+///   definite.
+///
+template <class AMatrix>
+int potrf(const char uplo[], const AMatrix& A) {
+  typename AMatrix::execution_space space{};
+  return potrf(space, uplo, A);
+}
+
+}  // namespace KokkosLapack
+
+#endif  // KOKKOSLAPACK_POTRF_HPP_
@@ -0,0 +1,135 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file KokkosLapack_potrs.hpp
+/// \brief Dense Hermitian positive definite linear solve
+///
+/// This file provides KokkosLapack::potrs. This function solves A * X = B
+/// for a Hermitian positive definite N-by-N matrix A given its Cholesky
+/// factor computed by KokkosLapack::potrf, X and B are N-by-NRHS matrices.
+
+#ifndef KOKKOSLAPACK_POTRS_HPP_
+#define KOKKOSLAPACK_POTRS_HPP_
+
+#include <sstream>
+#include <type_traits>
+
+#include "KokkosLapack_potrs_spec.hpp"
+#include "KokkosKernels_Error.hpp"
+
+namespace KokkosLapack {
+
+/// \brief Solve A*X = B with the Cholesky factorization of A.
+///
+/// \tparam ExecutionSpace the space where the kernel will run.
+/// \tparam AMatrix Input Cholesky factor, as a 2-D Kokkos::View.
+/// \tparam BXMV Input (right-hand side)/Output (solution) (multi)vector, as a
+/// 1-D or 2-D Kokkos::View.
+///
+/// \param space [in] execution space instance used to specified how to execute
+///   the potrs kernels.
+/// \param uplo [in] "U" or "u": A = U^H * U, "L" or "l": A = L * L^H, as
+///   passed to KokkosLapack::potrf.
+/// \param A [in] The factor U or L computed by KokkosLapack::potrf.
+/// \param B [in,out] On entry, the right hand side (multi)vector B. On exit,
+/// the solution (multi)vector X.
+///
+template <class ExecutionSpace, class AMatrix, class BXMV>
+void potrs(const ExecutionSpace& space, const char uplo[], const AMatrix& A,
+           const BXMV& B) {
+  // NOTE: KokkosLapack::potrs calls the LAPACK, MAGMA or cuSOLVER TPL when
+  //       one is enabled for the views' memory space, otherwise two
+  //       KokkosBlas::trsm are used.
+
+  static_assert(
+      Kokkos::SpaceAccessibility<ExecutionSpace,
+                                 typename AMatrix::memory_space>::accessible);
+  static_assert(
+      Kokkos::SpaceAccessibility<ExecutionSpace,
+                                 typename BXMV::memory_space>::accessible);
+  static_assert(Kokkos::is_view<AMatrix>::value,
+                "KokkosLapack::potrs: A must be a Kokkos::View.");
+  static_assert(Kokkos::is_view<BXMV>::value,
+                "KokkosLapack::potrs: B must be a Kokkos::View.");
+  static_assert(static_cast<int>(AMatrix::rank) == 2,
+                "KokkosLapack::potrs: A must have rank 2.");
+  static_assert(
+      static_cast<int>(BXMV::rank) == 1 || static_cast<int>(BXMV::rank) == 2,
+      "KokkosLapack::potrs: B must have either rank 1 or rank 2.");
+
+  const bool valid_uplo = (uplo[0] == 'U') || (uplo[0] == 'u') ||
+                          (uplo[0] == 'L') || (uplo[0] == 'l');
+  if (!valid_uplo) {
+    std::ostringstream os;
+    os << "KokkosLapack::potrs: uplo = '" << uplo[0] << "'. "
+       << "Valid values include 'U' or 'u' (A = U^H * U), "
+          "'L' or 'l' (A = L * L^H).";
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  // Check compatibility of dimensions at run time.
+  if ((A.extent(0) != A.extent(1)) || (A.extent(0) != B.extent(0))) {
+    std::ostringstream os;
+    os << "KokkosLapack::potrs: Dimensions of A, and B do not match: "
+       << " A: " << A.extent(0) << " x " << A.extent(1) << " B: " << B.extent(0)
+       << " x " << B.extent(1);
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  // Return if degenerated matrices are provided
+  if (A.extent(0) == 0 || B.extent(1) == 0) return;
+
+  typedef Kokkos::View<
+      typename AMatrix::non_const_value_type**, typename AMatrix::array_layout,
+      typename AMatrix::device_type, Kokkos::MemoryTraits<Kokkos::Unmanaged> >
+      AMatrix_Internal;
+  typedef Kokkos::View<typename BXMV::non_const_value_type**,
+                       typename BXMV::array_layout, typename BXMV::device_type,
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged> >
+      BXMV_Internal;
+  AMatrix_Internal A_i = A;
+
+  if constexpr (BXMV::rank == 1) {
+    auto B_i = BXMV_Internal(B.data(), B.extent(0), 1);
+    KokkosLapack::Impl::POTRS<ExecutionSpace, AMatrix_Internal,
+                              BXMV_Internal>::potrs(space, uplo, A_i, B_i);
+  } else {  // BXMV::rank == 2
+    auto B_i = BXMV_Internal(B.data(), B.extent(0), B.extent(1));
+    KokkosLapack::Impl::POTRS<ExecutionSpace, AMatrix_Internal,
+                              BXMV_Internal>::potrs(space, uplo, A_i, B_i);
+  }
+}
+
+/// \brief Solve A*X = B with the Cholesky factorization of A.
+///
+/// \tparam AMatrix Input Cholesky factor, as a 2-D Kokkos::View.
+/// \tparam BXMV Input (right-hand side)/Output (solution) (multi)vector, as a
+/// 1-D or 2-D Kokkos::View.
+///
+/// \param uplo [in] "U" or "u": A = U^H * U, "L" or "l": A = L * L^H.
+/// \param A [in] The factor U or L computed by KokkosLapack::potrf.
+/// \param B [in,out] On entry, the right hand side (multi)vector B. On exit,
+/// the solution (multi)vector X.
+///
+template <class AMatrix, class BXMV>
+void potrs(const char uplo[], const AMatrix& A, const BXMV& B) {
+  typename AMatrix::execution_space space{};
+  potrs(space, uplo, A, B);
+}
+
+}  // namespace KokkosLapack
+
+#endif  // KOKKOSLAPACK_POTRS_HPP_
@@ -0,0 +1,180 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file KokkosLapack_rsvd.hpp
+/// \brief Randomized truncated singular value decomposition
+///
+/// This file provides KokkosLapack::Experimental::rsvd. This function
+/// estimates the k leading singular triplets of an M-by-N matrix A from a
+/// random sample of its range, at a cost of O(M N (k + oversample)) instead
+/// of the O(M N min(M, N)) of a full SVD.
+
+#ifndef KOKKOSLAPACK_RSVD_HPP_
+#define KOKKOSLAPACK_RSVD_HPP_
+
+#include <sstream>
+#include <type_traits>
+
+#include <Kokkos_ArithTraits.hpp>
+#include "KokkosLapack_rsvd_impl.hpp"
+#include "KokkosKernels_Error.hpp"
+
+namespace KokkosLapack {
+namespace Experimental {
+
+namespace Impl {
+template <class Operator, class SVector, class UMatrix, class VMatrix>
+void rsvd_check_args(const Operator& A, const int k, const int oversample,
+                     const int power_iters, const SVector& S,
+                     const UMatrix& U, const VMatrix& Vt) {
+  const int m = A.num_rows();
+  const int n = A.num_cols();
+  std::ostringstream os;
+  if ((k < 0) || (k > Kokkos::min(m, n)) || (oversample < 0) ||
+      (power_iters < 0)) {
+    os << "KokkosLapack::rsvd: k must be in [0, min(M, N)] and oversample,"
+       << " power_iters must be non-negative, k = " << k
+       << ", oversample = " << oversample << ", power_iters = " << power_iters
+       << ", A: " << m << " x " << n;
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+  if ((S.extent_int(0) != k) || (U.extent_int(0) != m) ||
+      (U.extent_int(1) != k) || (Vt.extent_int(0) != k) ||
+      (Vt.extent_int(1) != n)) {
+    os << "KokkosLapack::rsvd: expected S of extent k, U M-by-k and Vt k-by-N,"
+       << " S: " << S.extent(0) << ", U: " << U.extent(0) << " x "
+       << U.extent(1) << ", Vt: " << Vt.extent(0) << " x " << Vt.extent(1)
+       << ", k = " << k << ", A: " << m << " x " << n;
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+}
+
+/// \brief rsvd of a linear operator providing num_rows(), num_cols() and
+/// apply(space, trans, X, Y) computing Y = op(A) * X for LayoutLeft
+/// multivectors X and Y, trans being "N" or "T".
+template <class ExecutionSpace, class Operator, class SVector, class UMatrix,
+          class VMatrix>
+void rsvd_operator(const ExecutionSpace& space, const Operator& A,
+                   const int k, const int oversample, const int power_iters,
+                   const SVector& S, const UMatrix& U, const VMatrix& Vt,
+                   const uint64_t seed) {
+  static_assert(
+      Kokkos::SpaceAccessibility<ExecutionSpace,
+                                 typename SVector::memory_space>::accessible);
+  static_assert(
+      Kokkos::SpaceAccessibility<ExecutionSpace,
+                                 typename UMatrix::memory_space>::accessible);
+  static_assert(
+      Kokkos::SpaceAccessibility<ExecutionSpace,
+                                 typename VMatrix::memory_space>::accessible);
+  static_assert(Kokkos::is_view<SVector>::value && SVector::rank() == 1,
+                "KokkosLapack::rsvd: S must be a rank-1 Kokkos::View.");
+  static_assert(Kokkos::is_view<UMatrix>::value && UMatrix::rank() == 2,
+                "KokkosLapack::rsvd: U must be a rank-2 Kokkos::View.");
+  static_assert(Kokkos::is_view<VMatrix>::value && VMatrix::rank() == 2,
+                "KokkosLapack::rsvd: Vt must be a rank-2 Kokkos::View.");
+  static_assert(
+      !Kokkos::ArithTraits<typename UMatrix::non_const_value_type>::is_complex,
+      "KokkosLapack::rsvd: only real scalar types are supported.");
+
+  rsvd_check_args(A, k, oversample, power_iters, S, U, Vt);
+
+  // Return if degenerated matrices are provided
+  if (k == 0) return;
+
+  KokkosLapack::Impl::rsvd_native(space, A, k, oversample, power_iters, S, U,
+                                  Vt, seed);
+}
+}  // namespace Impl
+
+// clang-format off
+/// \brief Estimate the k leading singular triplets A ~ U * diag(S) * Vt of
+/// the dense matrix A.
+///
+/// The range of A is sampled with k + oversample random vectors and
+/// orthonormalized with KokkosLapack::Experimental::tsqr, then refined by
+/// power_iters power iterations. The singular triplets are those of the
+/// projection of A onto that range. Larger oversample or power_iters give
+/// more accurate triplets when the singular values of A decay slowly, one or
+/// two power iterations are usually enough.
+///
+/// \tparam ExecutionSpace the space where the kernel will run.
+/// \tparam AMatrix (MxN) matrix as a rank-2 Kokkos::View.
+/// \tparam SVector k vector as a rank-1 Kokkos::View.
+/// \tparam UMatrix (Mxk) matrix as a rank-2 Kokkos::View.
+/// \tparam VMatrix (kxN) matrix as a rank-2 Kokkos::View.
+///
+/// \param space [in] execution space instance used to specified how to execute
+///   the rsvd kernels.
+/// \param A [in] the M-by-N matrix, it is not modified.
+/// \param k [in] number of singular triplets, 0 <= k <= min(M, N).
+/// \param oversample [in] number of extra random samples, the sample size is
+///   min(k + oversample, M, N).
+/// \param power_iters [in] number of power iterations.
+/// \param S [out] the k leading singular values in descending order.
+/// \param U [out] the k leading left singular vectors.
+/// \param Vt [out] the k leading right singular vectors, as rows.
+/// \param seed [in] seed of the random sample.
+///
+/// \note Only real scalar types are supported.
+///
+// clang-format on
+template <class ExecutionSpace, class AMatrix, class SVector, class UMatrix,
+          class VMatrix>
+void rsvd(const ExecutionSpace& space, const AMatrix& A, const int k,
+          const int oversample, const int power_iters, const SVector& S,
+          const UMatrix& U, const VMatrix& Vt, const uint64_t seed = 12371) {
+  static_assert(
+      Kokkos::SpaceAccessibility<ExecutionSpace,
+                                 typename AMatrix::memory_space>::accessible);
+  static_assert(Kokkos::is_view<AMatrix>::value && AMatrix::rank() == 2,
+                "KokkosLapack::rsvd: A must be a rank-2 Kokkos::View.");
+
+  Impl::rsvd_operator(space, KokkosLapack::Impl::RsvdDenseOperator<AMatrix>(A),
+                      k, oversample, power_iters, S, U, Vt, seed);
+}
+
+// clang-format off
+/// \brief Estimate the k leading singular triplets A ~ U * diag(S) * Vt of
+/// the dense matrix A.
+///
+/// \tparam AMatrix (MxN) matrix as a rank-2 Kokkos::View.
+/// \tparam SVector k vector as a rank-1 Kokkos::View.
+/// \tparam UMatrix (Mxk) matrix as a rank-2 Kokkos::View.
+/// \tparam VMatrix (kxN) matrix as a rank-2 Kokkos::View.
+///
+/// \param A [in] the M-by-N matrix, it is not modified.
+/// \param k [in] number of singular triplets, 0 <= k <= min(M, N).
+/// \param oversample [in] number of extra random samples.
+/// \param power_iters [in] number of power iterations.
+/// \param S [out] the k leading singular values in descending order.
+/// \param U [out] the k leading left singular vectors.
+/// \param Vt [out] the k leading right singular vectors, as rows.
+/// \param seed [in] seed of the random sample.
+///
+// clang-format on
+template <class AMatrix, class SVector, class UMatrix, class VMatrix>
+void rsvd(const AMatrix& A, const int k, const int oversample,
+          const int power_iters, const SVector& S, const UMatrix& U,
+          const VMatrix& Vt, const uint64_t seed = 12371) {
+  typename AMatrix::execution_space space{};
+  rsvd(space, A, k, oversample, power_iters, S, U, Vt, seed);
+}
+
+}  // namespace Experimental
+}  // namespace KokkosLapack
+
+#endif  // KOKKOSLAPACK_RSVD_HPP_
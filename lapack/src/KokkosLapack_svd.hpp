@@ -27,6 +27,7 @@
 #include <type_traits>
 
 #include "KokkosLapack_svd_spec.hpp"
+#include "KokkosLapack_svd_batched_spec.hpp"
 #include "KokkosKernels_Error.hpp"
 
 namespace KokkosLapack {
@@ -59,7 +60,8 @@ namespace KokkosLapack {
 ///
 // clang-format on
 template <class ExecutionSpace, class AMatrix, class SVector, class UMatrix,
-          class VMatrix>
+          class VMatrix,
+          typename std::enable_if_t<AMatrix::rank() != 3, int> = 0>
 void svd(const ExecutionSpace& space, const char jobu[], const char jobvt[],
          const AMatrix& A, const SVector& S, const UMatrix& U,
          const VMatrix& Vt) {
@@ -210,6 +212,147 @@ void svd(const ExecutionSpace& space, const char jobu[], const char jobvt[],
                                                                    Vt_i);
 }
 
+// clang-format off
+/// \brief Compute the Singular Value Decomposition A(b) = U(b)*S(b)*Vt(b) of
+/// each matrix of a batch
+///
+/// The whole batch is decomposed by a single call: cuSOLVER gesvdjBatched
+/// for batches of matrices of at most 32 rows and columns, rocSOLVER
+/// gesvd_strided_batched, or otherwise one KokkosBatched::TeamVectorSVD per
+/// matrix. The TPLs are used for contiguous LayoutRight views.
+///
+/// \tparam ExecutionSpace the space where the kernel will run.
+/// \tparam AMatrix (batch x m x n) matrices as a rank-3 Kokkos::View.
+/// \tparam SVector (batch x min(m,n)) vectors as a rank-2 Kokkos::View
+/// \tparam UMatrix (batch x m x m) matrices as a rank-3 Kokkos::View
+/// \tparam VMatrix (batch x n x n) matrices as a rank-3 Kokkos::View
+///
+/// \param space [in] execution space instance used to specified how to execute
+///   the svd kernels.
+/// \param jobu [in] 'A' computes all the left singular vectors, 'N' none.
+/// \param jobvt [in] 'A' computes all the right singular vectors, 'N' none,
+///   jobu and jobvt must be the same.
+/// \param A [in/out] The matrices to be decomposed, overwritten on exit.
+/// \param S [out] The min(m, n) singular values of each matrix, in
+///   descending order.
+/// \param U [out] The left singular vectors of each matrix, as columns.
+/// \param Vt [out] The right singular vectors of each matrix, as rows.
+///
+/// \note Only real scalar types are supported.
+///
+// clang-format on
+template <class ExecutionSpace, class AMatrix, class SVector, class UMatrix,
+          class VMatrix,
+          typename std::enable_if_t<AMatrix::rank() == 3, int> = 0>
+void svd(const ExecutionSpace& space, const char jobu[], const char jobvt[],
+         const AMatrix& A, const SVector& S, const UMatrix& U,
+         const VMatrix& Vt) {
+  static_assert(
+      Kokkos::SpaceAccessibility<ExecutionSpace,
+                                 typename AMatrix::memory_space>::accessible);
+  static_assert(
+      Kokkos::SpaceAccessibility<ExecutionSpace,
+                                 typename SVector::memory_space>::accessible);
+  static_assert(
+      Kokkos::SpaceAccessibility<ExecutionSpace,
+                                 typename UMatrix::memory_space>::accessible);
+  static_assert(
+      Kokkos::SpaceAccessibility<ExecutionSpace,
+                                 typename VMatrix::memory_space>::accessible);
+  static_assert(Kokkos::is_view<SVector>::value,
+                "KokkosLapack::svd: S must be a Kokkos::View.");
+  static_assert(Kokkos::is_view<UMatrix>::value,
+                "KokkosLapack::svd: U must be a Kokkos::View.");
+  static_assert(Kokkos::is_view<VMatrix>::value,
+                "KokkosLapack::svd: Vt must be a Kokkos::View.");
+  static_assert(SVector::rank() == 2,
+                "KokkosLapack::svd: batched S must have rank 2.");
+  static_assert(UMatrix::rank() == 3,
+                "KokkosLapack::svd: batched U must have rank 3.");
+  static_assert(VMatrix::rank() == 3,
+                "KokkosLapack::svd: batched Vt must have rank 3.");
+  static_assert(
+      !Kokkos::ArithTraits<typename AMatrix::non_const_value_type>::is_complex,
+      "KokkosLapack::svd: batched svd only supports real scalar types.");
+
+  const int64_t batch = A.extent(0);
+  const int64_t m     = A.extent(1);
+  const int64_t n     = A.extent(2);
+  const int64_t rankA = Kokkos::min(m, n);
+
+  // The batched solvers compute both sets of singular vectors or none
+  const bool is_jobu_all = (jobu[0] == 'A') || (jobu[0] == 'a');
+  const bool is_job_valid =
+      (is_jobu_all && ((jobvt[0] == 'A') || (jobvt[0] == 'a'))) ||
+      (((jobu[0] == 'N') || (jobu[0] == 'n')) &&
+       ((jobvt[0] == 'N') || (jobvt[0] == 'n')));
+  if (!is_job_valid) {
+    std::ostringstream oss;
+    oss << "KokkosLapack::svd: batched svd requires jobu and jobvt to be both"
+        << " A or both N, submitted values are " << jobu[0] << " and "
+        << jobvt[0] << "\n";
+    KokkosKernels::Impl::throw_runtime_exception(oss.str());
+  }
+
+  bool is_extent_invalid = false;
+  std::ostringstream os;
+  if (S.extent_int(0) != batch || S.extent_int(1) != rankA) {
+    is_extent_invalid = true;
+    os << "KokkosLapack::svd: S has extents (" << S.extent(0) << ", "
+       << S.extent(1) << ") instead of (" << batch << ", " << rankA << ").\n";
+  }
+  if (is_jobu_all) {
+    if (U.extent_int(0) != batch || U.extent_int(1) != m ||
+        U.extent_int(2) != m) {
+      is_extent_invalid = true;
+      os << "KokkosLapack::svd: U has extents (" << U.extent(0) << ", "
+         << U.extent(1) << ", " << U.extent(2) << ") instead of (" << batch
+         << ", " << m << ", " << m << ").\n";
+    }
+    if (Vt.extent_int(0) != batch || Vt.extent_int(1) != n ||
+        Vt.extent_int(2) != n) {
+      is_extent_invalid = true;
+      os << "KokkosLapack::svd: V has extents (" << Vt.extent(0) << ", "
+         << Vt.extent(1) << ", " << Vt.extent(2) << ") instead of (" << batch
+         << ", " << n << ", " << n << ").\n";
+    }
+  }
+  if (is_extent_invalid) {
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  // No work to do since the matrices are empty
+  if ((batch == 0) || (m == 0) || (n == 0)) {
+    return;
+  }
+
+  using AMatrix_Internal = Kokkos::View<
+      typename AMatrix::non_const_value_type***, typename AMatrix::array_layout,
+      typename AMatrix::device_type, Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+  using SVector_Internal = Kokkos::View<
+      typename SVector::non_const_value_type**, typename SVector::array_layout,
+      typename SVector::device_type, Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+  using UMatrix_Internal = Kokkos::View<
+      typename UMatrix::non_const_value_type***, typename UMatrix::array_layout,
+      typename UMatrix::device_type, Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+  using VMatrix_Internal = Kokkos::View<
+      typename VMatrix::non_const_value_type***, typename VMatrix::array_layout,
+      typename VMatrix::device_type, Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+  AMatrix_Internal A_i  = A;
+  SVector_Internal S_i  = S;
+  UMatrix_Internal U_i  = U;
+  VMatrix_Internal Vt_i = Vt;
+
+  KokkosLapack::Impl::SVD_BATCHED<ExecutionSpace, AMatrix_Internal,
+                                  SVector_Internal, UMatrix_Internal,
+                                  VMatrix_Internal>::svd(space, jobu, jobvt,
+                                                         A_i, S_i, U_i, Vt_i);
+}
+
 // clang-format off
 /// \brief Compute the Singular Value Decomposition of A = U*S*Vt
 ///
@@ -233,6 +376,8 @@ void svd(const ExecutionSpace& space, const char jobu[], const char jobvt[],
 /// \param Vt [out] the first min(m, n) columns of Vt are the right singular
 /// vectors of A.
 ///
+/// \note A rank-3 A is decomposed as a batch, see the batched overload.
+///
 // clang-format on
 template <class AMatrix, class SVector, class UMatrix, class VMatrix>
 void svd(const char jobu[], const char jobvt[], const AMatrix& A,
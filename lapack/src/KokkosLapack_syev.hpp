@@ -0,0 +1,175 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file KokkosLapack_syev.hpp
+/// \brief Symmetric/Hermitian eigenvalue decomposition
+///
+/// This file provides KokkosLapack::syev and KokkosLapack::heev. These
+/// functions compute all the eigenvalues and, optionally, the eigenvectors
+/// of a real symmetric or complex Hermitian matrix A using the
+/// divide-and-conquer algorithm of the available LAPACK TPL.
+
+#ifndef KOKKOSLAPACK_SYEV_HPP_
+#define KOKKOSLAPACK_SYEV_HPP_
+
+#include <sstream>
+#include <type_traits>
+
+#include "KokkosLapack_syev_spec.hpp"
+#include "KokkosKernels_Error.hpp"
+
+namespace KokkosLapack {
+
+// clang-format off
+/// \brief Compute the eigenvalue decomposition A = V*diag(W)*V^H of the
+/// symmetric (Hermitian) matrix A.
+///
+/// \tparam ExecutionSpace the space where the kernel will run.
+/// \tparam AMatrix (nxn) matrix as a rank-2 Kokkos::View.
+/// \tparam WVector n vector of real values as a rank-1 Kokkos::View.
+///
+/// \param space [in] execution space instance used to specified how to execute
+///   the syev kernels.
+/// \param jobz [in] 'N' or 'n': only the eigenvalues are computed, 'V' or 'v':
+///   the eigenvalues and the eigenvectors are computed.
+/// \param uplo [in] 'U' or 'u': the upper triangle of A is referenced, 'L' or
+///   'l': the lower triangle of A is referenced.
+/// \param A [in,out] On entry, the n-by-n symmetric (Hermitian) matrix. On
+///   exit, if jobz = 'V' the columns of A are the orthonormal eigenvectors,
+///   otherwise the referenced triangle of A is destroyed.
+/// \param W [out] the n eigenvalues of A in ascending order.
+///
+// clang-format on
+template <class ExecutionSpace, class AMatrix, class WVector>
+void syev(const ExecutionSpace& space, const char jobz[], const char uplo[],
+          const AMatrix& A, const WVector& W) {
+  static_assert(
+      Kokkos::SpaceAccessibility<ExecutionSpace,
+                                 typename AMatrix::memory_space>::accessible);
+  static_assert(
+      Kokkos::SpaceAccessibility<ExecutionSpace,
+                                 typename WVector::memory_space>::accessible);
+  static_assert(Kokkos::is_view<AMatrix>::value,
+                "KokkosLapack::syev: A must be a Kokkos::View.");
+  static_assert(Kokkos::is_view<WVector>::value,
+                "KokkosLapack::syev: W must be a Kokkos::View.");
+  static_assert(AMatrix::rank() == 2,
+                "KokkosLapack::syev: A must have rank 2.");
+  static_assert(WVector::rank() == 1,
+                "KokkosLapack::syev: W must have rank 1.");
+  static_assert(
+      std::is_same_v<typename WVector::non_const_value_type,
+                     typename Kokkos::ArithTraits<
+                         typename AMatrix::non_const_value_type>::mag_type>,
+      "KokkosLapack::syev: W must store the magnitude type of A.");
+
+  const bool is_jobz_invalid = !((jobz[0] == 'N') || (jobz[0] == 'n') ||
+                                 (jobz[0] == 'V') || (jobz[0] == 'v'));
+  if (is_jobz_invalid) {
+    std::ostringstream oss;
+    oss << "KokkosLapack::syev: jobz is invalid!\n"
+        << "Possible values are N or V, submitted value is " << jobz[0]
+        << "\n";
+    KokkosKernels::Impl::throw_runtime_exception(oss.str());
+  }
+
+  const bool is_uplo_invalid = !((uplo[0] == 'U') || (uplo[0] == 'u') ||
+                                 (uplo[0] == 'L') || (uplo[0] == 'l'));
+  if (is_uplo_invalid) {
+    std::ostringstream oss;
+    oss << "KokkosLapack::syev: uplo is invalid!\n"
+        << "Possible values are U or L, submitted value is " << uplo[0]
+        << "\n";
+    KokkosKernels::Impl::throw_runtime_exception(oss.str());
+  }
+
+  if (A.extent(0) != A.extent(1)) {
+    std::ostringstream os;
+    os << "KokkosLapack::syev: A must be square,"
+       << " A: " << A.extent(0) << " x " << A.extent(1);
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+  if (W.extent(0) != A.extent(0)) {
+    std::ostringstream os;
+    os << "KokkosLapack::syev: W has extent " << W.extent(0)
+       << ", instead of " << A.extent(0) << ".";
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  // No work to do since the matrix is empty...
+  // Also do not send a matrix with size zero
+  // to Lapack TPLs or they will complain!
+  if (A.extent(0) == 0) {
+    return;
+  }
+
+  using AMatrix_Internal = Kokkos::View<
+      typename AMatrix::non_const_value_type**, typename AMatrix::array_layout,
+      typename AMatrix::device_type, Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+  using WVector_Internal = Kokkos::View<
+      typename WVector::non_const_value_type*, typename WVector::array_layout,
+      typename WVector::device_type, Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+  AMatrix_Internal A_i = A;
+  WVector_Internal W_i = W;
+
+  KokkosLapack::Impl::SYEV<ExecutionSpace, AMatrix_Internal,
+                           WVector_Internal>::syev(space, jobz, uplo, A_i,
+                                                   W_i);
+}
+
+// clang-format off
+/// \brief Compute the eigenvalue decomposition A = V*diag(W)*V^H of the
+/// symmetric (Hermitian) matrix A.
+///
+/// \tparam AMatrix (nxn) matrix as a rank-2 Kokkos::View.
+/// \tparam WVector n vector of real values as a rank-1 Kokkos::View.
+///
+/// \param jobz [in] 'N': eigenvalues only, 'V': eigenvalues and eigenvectors.
+/// \param uplo [in] 'U' or 'L': triangle of A that is referenced.
+/// \param A [in,out] On entry, the n-by-n symmetric (Hermitian) matrix. On
+///   exit, the eigenvectors if jobz = 'V'.
+/// \param W [out] the n eigenvalues of A in ascending order.
+///
+// clang-format on
+template <class AMatrix, class WVector>
+void syev(const char jobz[], const char uplo[], const AMatrix& A,
+          const WVector& W) {
+  typename AMatrix::execution_space space{};
+  syev(space, jobz, uplo, A, W);
+}
+
+/// \brief Hermitian spelling of KokkosLapack::syev, both names accept real
+/// and complex matrices.
+template <class ExecutionSpace, class AMatrix, class WVector>
+void heev(const ExecutionSpace& space, const char jobz[], const char uplo[],
+          const AMatrix& A, const WVector& W) {
+  syev(space, jobz, uplo, A, W);
+}
+
+/// \brief Hermitian spelling of KokkosLapack::syev, both names accept real
+/// and complex matrices.
+template <class AMatrix, class WVector>
+void heev(const char jobz[], const char uplo[], const AMatrix& A,
+          const WVector& W) {
+  typename AMatrix::execution_space space{};
+  syev(space, jobz, uplo, A, W);
+}
+
+}  // namespace KokkosLapack
+
+#endif  // KOKKOSLAPACK_SYEV_HPP_
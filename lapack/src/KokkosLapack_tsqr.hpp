@@ -0,0 +1,112 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file KokkosLapack_tsqr.hpp
+/// \brief QR factorization of tall-skinny matrices
+///
+/// This file provides KokkosLapack::Experimental::tsqr. This function
+/// computes the thin QR factorization A = Q * R of an M-by-N matrix with
+/// M >= N using a communication-avoiding reduction tree.
+
+#ifndef KOKKOSLAPACK_TSQR_HPP_
+#define KOKKOSLAPACK_TSQR_HPP_
+
+#include <sstream>
+#include <type_traits>
+
+#include <Kokkos_ArithTraits.hpp>
+#include "KokkosLapack_tsqr_impl.hpp"
+#include "KokkosKernels_Error.hpp"
+
+namespace KokkosLapack {
+namespace Experimental {
+
+/// \brief Compute the thin QR factorization of the tall-skinny matrix A.
+///
+/// The rows of A are split into blocks factored independently by one team
+/// each, their R factors are then combined pairwise in a binary tree. This
+/// exposes parallelism across the rows of A that a column-by-column
+/// Householder QR lacks when N is small, e.g. to orthogonalize a Krylov
+/// basis or the sample matrix of a randomized SVD.
+///
+/// \tparam ExecutionSpace the space where the kernel will run.
+/// \tparam AMatrix Input matrix/Output orthonormal factor, as a 2-D
+///   Kokkos::View.
+/// \tparam RMatrix Output triangular factor, as a 2-D Kokkos::View.
+///
+/// \param space [in] execution space instance used to specified how to execute
+///   the tsqr kernels.
+/// \param A [in,out] On entry, the M-by-N matrix to be factored, M >= N.
+///   On exit, the M-by-N matrix Q with orthonormal columns.
+/// \param R [out] The N-by-N upper triangular factor, the strictly lower
+///   triangle is set to zero.
+///
+/// \note Only real scalar types are supported.
+///
+template <class ExecutionSpace, class AMatrix, class RMatrix>
+void tsqr(const ExecutionSpace& space, const AMatrix& A, const RMatrix& R) {
+  static_assert(
+      Kokkos::SpaceAccessibility<ExecutionSpace,
+                                 typename AMatrix::memory_space>::accessible);
+  static_assert(
+      Kokkos::SpaceAccessibility<ExecutionSpace,
+                                 typename RMatrix::memory_space>::accessible);
+  static_assert(Kokkos::is_view<AMatrix>::value,
+                "KokkosLapack::tsqr: A must be a Kokkos::View.");
+  static_assert(Kokkos::is_view<RMatrix>::value,
+                "KokkosLapack::tsqr: R must be a Kokkos::View.");
+  static_assert(static_cast<int>(AMatrix::rank) == 2,
+                "KokkosLapack::tsqr: A must have rank 2.");
+  static_assert(static_cast<int>(RMatrix::rank) == 2,
+                "KokkosLapack::tsqr: R must have rank 2.");
+  static_assert(
+      !Kokkos::ArithTraits<typename AMatrix::non_const_value_type>::is_complex,
+      "KokkosLapack::tsqr: only real scalar types are supported.");
+
+  const int64_t m = A.extent(0);
+  const int64_t n = A.extent(1);
+
+  if ((m < n) || (static_cast<int64_t>(R.extent(0)) != n) ||
+      (static_cast<int64_t>(R.extent(1)) != n)) {
+    std::ostringstream os;
+    os << "KokkosLapack::tsqr: A must be M-by-N with M >= N and R N-by-N,"
+       << " A: " << A.extent(0) << " x " << A.extent(1) << ", R: "
+       << R.extent(0) << " x " << R.extent(1);
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  // Return if degenerated matrices are provided
+  if (n == 0) return;
+
+  KokkosLapack::Impl::tsqr_native(space, A, R);
+}
+
+/// \brief Compute the thin QR factorization of the tall-skinny matrix A.
+///
+/// \param A [in,out] On entry, the M-by-N matrix to be factored, M >= N.
+///   On exit, the M-by-N matrix Q with orthonormal columns.
+/// \param R [out] The N-by-N upper triangular factor.
+///
+template <class AMatrix, class RMatrix>
+void tsqr(const AMatrix& A, const RMatrix& R) {
+  typename AMatrix::execution_space space{};
+  tsqr(space, A, R);
+}
+
+}  // namespace Experimental
+}  // namespace KokkosLapack
+
+#endif  // KOKKOSLAPACK_TSQR_HPP_
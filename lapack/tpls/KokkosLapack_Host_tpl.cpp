@@ -82,6 +82,96 @@ void F77_BLAS_MANGLE(ctrtri, CTRTRI)(const char*, const char*, int*,
                                      const std::complex<float>*, int*, int*);
 void F77_BLAS_MANGLE(ztrtri, ZTRTRI)(const char*, const char*, int*,
                                      const std::complex<double>*, int*, int*);
+
+///
+/// Potrf
+///
+
+void F77_BLAS_MANGLE(spotrf, SPOTRF)(const char*, int*, float*, int*, int*);
+void F77_BLAS_MANGLE(dpotrf, DPOTRF)(const char*, int*, double*, int*, int*);
+void F77_BLAS_MANGLE(cpotrf, CPOTRF)(const char*, int*, std::complex<float>*,
+                                     int*, int*);
+void F77_BLAS_MANGLE(zpotrf, ZPOTRF)(const char*, int*, std::complex<double>*,
+                                     int*, int*);
+
+///
+/// Potrs
+///
+
+void F77_BLAS_MANGLE(spotrs, SPOTRS)(const char*, int*, int*, const float*,
+                                     int*, float*, int*, int*);
+void F77_BLAS_MANGLE(dpotrs, DPOTRS)(const char*, int*, int*, const double*,
+                                     int*, double*, int*, int*);
+void F77_BLAS_MANGLE(cpotrs, CPOTRS)(const char*, int*, int*,
+                                     const std::complex<float>*, int*,
+                                     std::complex<float>*, int*, int*);
+void F77_BLAS_MANGLE(zpotrs, ZPOTRS)(const char*, int*, int*,
+                                     const std::complex<double>*, int*,
+                                     std::complex<double>*, int*, int*);
+
+///
+/// Geqrf
+///
+
+void F77_BLAS_MANGLE(sgeqrf, SGEQRF)(const int*, const int*, float*,
+                                     const int*, float*, float*, const int*,
+                                     int*);
+void F77_BLAS_MANGLE(dgeqrf, DGEQRF)(const int*, const int*, double*,
+                                     const int*, double*, double*, const int*,
+                                     int*);
+void F77_BLAS_MANGLE(cgeqrf, CGEQRF)(const int*, const int*,
+                                     std::complex<float>*, const int*,
+                                     std::complex<float>*, std::complex<float>*,
+                                     const int*, int*);
+void F77_BLAS_MANGLE(zgeqrf, ZGEQRF)(const int*, const int*,
+                                     std::complex<double>*, const int*,
+                                     std::complex<double>*,
+                                     std::complex<double>*, const int*, int*);
+
+///
+/// Ormqr / Unmqr
+///
+
+void F77_BLAS_MANGLE(sormqr, SORMQR)(const char*, const char*, const int*,
+                                     const int*, const int*, const float*,
+                                     const int*, const float*, float*,
+                                     const int*, float*, const int*, int*);
+void F77_BLAS_MANGLE(dormqr, DORMQR)(const char*, const char*, const int*,
+                                     const int*, const int*, const double*,
+                                     const int*, const double*, double*,
+                                     const int*, double*, const int*, int*);
+void F77_BLAS_MANGLE(cunmqr, CUNMQR)(const char*, const char*, const int*,
+                                     const int*, const int*,
+                                     const std::complex<float>*, const int*,
+                                     const std::complex<float>*,
+                                     std::complex<float>*, const int*,
+                                     std::complex<float>*, const int*, int*);
+void F77_BLAS_MANGLE(zunmqr, ZUNMQR)(const char*, const char*, const int*,
+                                     const int*, const int*,
+                                     const std::complex<double>*, const int*,
+                                     const std::complex<double>*,
+                                     std::complex<double>*, const int*,
+                                     std::complex<double>*, const int*, int*);
+
+///
+/// Syevd / Heevd
+///
+
+void F77_BLAS_MANGLE(ssyevd, SSYEVD)(const char*, const char*, const int*,
+                                     float*, const int*, float*, float*,
+                                     const int*, int*, const int*, int*);
+void F77_BLAS_MANGLE(dsyevd, DSYEVD)(const char*, const char*, const int*,
+                                     double*, const int*, double*, double*,
+                                     const int*, int*, const int*, int*);
+void F77_BLAS_MANGLE(cheevd, CHEEVD)(const char*, const char*, const int*,
+                                     std::complex<float>*, const int*, float*,
+                                     std::complex<float>*, const int*, float*,
+                                     const int*, int*, const int*, int*);
+void F77_BLAS_MANGLE(zheevd, ZHEEVD)(const char*, const char*, const int*,
+                                     std::complex<double>*, const int*,
+                                     double*, std::complex<double>*,
+                                     const int*, double*, const int*, int*,
+                                     const int*, int*);
 }
 
 #define F77_FUNC_SGESV F77_BLAS_MANGLE(sgesv, SGESV)
@@ -99,6 +189,31 @@ void F77_BLAS_MANGLE(ztrtri, ZTRTRI)(const char*, const char*, int*,
 #define F77_FUNC_CTRTRI F77_BLAS_MANGLE(ctrtri, CTRTRI)
 #define F77_FUNC_ZTRTRI F77_BLAS_MANGLE(ztrtri, ZTRTRI)
 
+#define F77_FUNC_SPOTRF F77_BLAS_MANGLE(spotrf, SPOTRF)
+#define F77_FUNC_DPOTRF F77_BLAS_MANGLE(dpotrf, DPOTRF)
+#define F77_FUNC_CPOTRF F77_BLAS_MANGLE(cpotrf, CPOTRF)
+#define F77_FUNC_ZPOTRF F77_BLAS_MANGLE(zpotrf, ZPOTRF)
+
+#define F77_FUNC_SPOTRS F77_BLAS_MANGLE(spotrs, SPOTRS)
+#define F77_FUNC_DPOTRS F77_BLAS_MANGLE(dpotrs, DPOTRS)
+#define F77_FUNC_CPOTRS F77_BLAS_MANGLE(cpotrs, CPOTRS)
+#define F77_FUNC_ZPOTRS F77_BLAS_MANGLE(zpotrs, ZPOTRS)
+
+#define F77_FUNC_SGEQRF F77_BLAS_MANGLE(sgeqrf, SGEQRF)
+#define F77_FUNC_DGEQRF F77_BLAS_MANGLE(dgeqrf, DGEQRF)
+#define F77_FUNC_CGEQRF F77_BLAS_MANGLE(cgeqrf, CGEQRF)
+#define F77_FUNC_ZGEQRF F77_BLAS_MANGLE(zgeqrf, ZGEQRF)
+
+#define F77_FUNC_SORMQR F77_BLAS_MANGLE(sormqr, SORMQR)
+#define F77_FUNC_DORMQR F77_BLAS_MANGLE(dormqr, DORMQR)
+#define F77_FUNC_CUNMQR F77_BLAS_MANGLE(cunmqr, CUNMQR)
+#define F77_FUNC_ZUNMQR F77_BLAS_MANGLE(zunmqr, ZUNMQR)
+
+#define F77_FUNC_SSYEVD F77_BLAS_MANGLE(ssyevd, SSYEVD)
+#define F77_FUNC_DSYEVD F77_BLAS_MANGLE(dsyevd, DSYEVD)
+#define F77_FUNC_CHEEVD F77_BLAS_MANGLE(cheevd, CHEEVD)
+#define F77_FUNC_ZHEEVD F77_BLAS_MANGLE(zheevd, ZHEEVD)
+
 namespace KokkosLapack {
 namespace Impl {
 
@@ -127,6 +242,46 @@ int HostLapack<float>::trtri(const char uplo, const char diag, int n,
   F77_FUNC_STRTRI(&uplo, &diag, &n, a, &lda, &info);
   return info;
 }
+template <>
+int HostLapack<float>::potrf(const char uplo, int n, float* a, int lda) {
+  int info = 0;
+  F77_FUNC_SPOTRF(&uplo, &n, a, &lda, &info);
+  return info;
+}
+template <>
+int HostLapack<float>::potrs(const char uplo, int n, int nrhs, const float* a,
+                             int lda, float* b, int ldb) {
+  int info = 0;
+  F77_FUNC_SPOTRS(&uplo, &n, &nrhs, a, &lda, b, &ldb, &info);
+  return info;
+}
+template <>
+int HostLapack<float>::geqrf(const int m, const int n, float* a, const int lda,
+                             float* tau, float* work, int lwork) {
+  int info = 0;
+  F77_FUNC_SGEQRF(&m, &n, a, &lda, tau, work, &lwork, &info);
+  return info;
+}
+template <>
+int HostLapack<float>::ormqr(const char side, const char trans, const int m,
+                             const int n, const int k, const float* a,
+                             const int lda, const float* tau, float* c,
+                             const int ldc, float* work, int lwork) {
+  int info = 0;
+  F77_FUNC_SORMQR(&side, &trans, &m, &n, &k, a, &lda, tau, c, &ldc, work,
+                  &lwork, &info);
+  return info;
+}
+template <>
+int HostLapack<float>::syevd(const char jobz, const char uplo, const int n,
+                             float* a, const int lda, float* w, float* work,
+                             int lwork, float* /*rwork*/, int /*lrwork*/,
+                             int* iwork, int liwork) {
+  int info = 0;
+  F77_FUNC_SSYEVD(&jobz, &uplo, &n, a, &lda, w, work, &lwork, iwork, &liwork,
+                  &info);
+  return info;
+}
 
 ///
 /// double
@@ -153,6 +308,47 @@ int HostLapack<double>::trtri(const char uplo, const char diag, int n,
   F77_FUNC_DTRTRI(&uplo, &diag, &n, a, &lda, &info);
   return info;
 }
+template <>
+int HostLapack<double>::potrf(const char uplo, int n, double* a, int lda) {
+  int info = 0;
+  F77_FUNC_DPOTRF(&uplo, &n, a, &lda, &info);
+  return info;
+}
+template <>
+int HostLapack<double>::potrs(const char uplo, int n, int nrhs,
+                              const double* a, int lda, double* b, int ldb) {
+  int info = 0;
+  F77_FUNC_DPOTRS(&uplo, &n, &nrhs, a, &lda, b, &ldb, &info);
+  return info;
+}
+template <>
+int HostLapack<double>::geqrf(const int m, const int n, double* a,
+                              const int lda, double* tau, double* work,
+                              int lwork) {
+  int info = 0;
+  F77_FUNC_DGEQRF(&m, &n, a, &lda, tau, work, &lwork, &info);
+  return info;
+}
+template <>
+int HostLapack<double>::ormqr(const char side, const char trans, const int m,
+                              const int n, const int k, const double* a,
+                              const int lda, const double* tau, double* c,
+                              const int ldc, double* work, int lwork) {
+  int info = 0;
+  F77_FUNC_DORMQR(&side, &trans, &m, &n, &k, a, &lda, tau, c, &ldc, work,
+                  &lwork, &info);
+  return info;
+}
+template <>
+int HostLapack<double>::syevd(const char jobz, const char uplo, const int n,
+                              double* a, const int lda, double* w, double* work,
+                              int lwork, double* /*rwork*/, int /*lrwork*/,
+                              int* iwork, int liwork) {
+  int info = 0;
+  F77_FUNC_DSYEVD(&jobz, &uplo, &n, a, &lda, w, work, &lwork, iwork, &liwork,
+                  &info);
+  return info;
+}
 
 ///
 /// std::complex<float>
@@ -182,6 +378,54 @@ int HostLapack<std::complex<float> >::trtri(const char uplo, const char diag,
   F77_FUNC_CTRTRI(&uplo, &diag, &n, a, &lda, &info);
   return info;
 }
+template <>
+int HostLapack<std::complex<float> >::potrf(const char uplo, int n,
+                                            std::complex<float>* a, int lda) {
+  int info = 0;
+  F77_FUNC_CPOTRF(&uplo, &n, a, &lda, &info);
+  return info;
+}
+template <>
+int HostLapack<std::complex<float> >::potrs(const char uplo, int n, int nrhs,
+                                            const std::complex<float>* a,
+                                            int lda, std::complex<float>* b,
+                                            int ldb) {
+  int info = 0;
+  F77_FUNC_CPOTRS(&uplo, &n, &nrhs, a, &lda, b, &ldb, &info);
+  return info;
+}
+template <>
+int HostLapack<std::complex<float> >::geqrf(const int m, const int n,
+                                            std::complex<float>* a,
+                                            const int lda,
+                                            std::complex<float>* tau,
+                                            std::complex<float>* work,
+                                            int lwork) {
+  int info = 0;
+  F77_FUNC_CGEQRF(&m, &n, a, &lda, tau, work, &lwork, &info);
+  return info;
+}
+template <>
+int HostLapack<std::complex<float> >::ormqr(
+    const char side, const char trans, const int m, const int n, const int k,
+    const std::complex<float>* a, const int lda, const std::complex<float>* tau,
+    std::complex<float>* c, const int ldc, std::complex<float>* work,
+    int lwork) {
+  int info = 0;
+  F77_FUNC_CUNMQR(&side, &trans, &m, &n, &k, a, &lda, tau, c, &ldc, work,
+                  &lwork, &info);
+  return info;
+}
+template <>
+int HostLapack<std::complex<float> >::syevd(
+    const char jobz, const char uplo, const int n, std::complex<float>* a,
+    const int lda, float* w, std::complex<float>* work, int lwork, float* rwork,
+    int lrwork, int* iwork, int liwork) {
+  int info = 0;
+  F77_FUNC_CHEEVD(&jobz, &uplo, &n, a, &lda, w, work, &lwork, rwork, &lrwork,
+                  iwork, &liwork, &info);
+  return info;
+}
 
 ///
 /// std::complex<double>
@@ -212,6 +456,55 @@ int HostLapack<std::complex<double> >::trtri(const char uplo, const char diag,
   F77_FUNC_ZTRTRI(&uplo, &diag, &n, a, &lda, &info);
   return info;
 }
+template <>
+int HostLapack<std::complex<double> >::potrf(const char uplo, int n,
+                                             std::complex<double>* a,
+                                             int lda) {
+  int info = 0;
+  F77_FUNC_ZPOTRF(&uplo, &n, a, &lda, &info);
+  return info;
+}
+template <>
+int HostLapack<std::complex<double> >::potrs(const char uplo, int n, int nrhs,
+                                             const std::complex<double>* a,
+                                             int lda, std::complex<double>* b,
+                                             int ldb) {
+  int info = 0;
+  F77_FUNC_ZPOTRS(&uplo, &n, &nrhs, a, &lda, b, &ldb, &info);
+  return info;
+}
+template <>
+int HostLapack<std::complex<double> >::geqrf(const int m, const int n,
+                                             std::complex<double>* a,
+                                             const int lda,
+                                             std::complex<double>* tau,
+                                             std::complex<double>* work,
+                                             int lwork) {
+  int info = 0;
+  F77_FUNC_ZGEQRF(&m, &n, a, &lda, tau, work, &lwork, &info);
+  return info;
+}
+template <>
+int HostLapack<std::complex<double> >::ormqr(
+    const char side, const char trans, const int m, const int n, const int k,
+    const std::complex<double>* a, const int lda,
+    const std::complex<double>* tau, std::complex<double>* c, const int ldc,
+    std::complex<double>* work, int lwork) {
+  int info = 0;
+  F77_FUNC_ZUNMQR(&side, &trans, &m, &n, &k, a, &lda, tau, c, &ldc, work,
+                  &lwork, &info);
+  return info;
+}
+template <>
+int HostLapack<std::complex<double> >::syevd(
+    const char jobz, const char uplo, const int n, std::complex<double>* a,
+    const int lda, double* w, std::complex<double>* work, int lwork,
+    double* rwork, int lrwork, int* iwork, int liwork) {
+  int info = 0;
+  F77_FUNC_ZHEEVD(&jobz, &uplo, &n, a, &lda, w, work, &lwork, rwork, &lrwork,
+                  iwork, &liwork, &info);
+  return info;
+}
 
 }  // namespace Impl
 }  // namespace KokkosLapack
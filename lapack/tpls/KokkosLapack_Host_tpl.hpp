@@ -41,6 +41,24 @@ struct HostLapack {
 
   static int trtri(const char uplo, const char diag, int n, const T *a,
                    int lda);
+
+  static int potrf(const char uplo, int n, T *a, int lda);
+
+  static int potrs(const char uplo, int n, int nrhs, const T *a, int lda,
+                   T *b, int ldb);
+
+  static int geqrf(const int m, const int n, T *a, const int lda, T *tau,
+                   T *work, int lwork);
+
+  static int ormqr(const char side, const char trans, const int m,
+                   const int n, const int k, const T *a, const int lda,
+                   const T *tau, T *c, const int ldc, T *work, int lwork);
+
+  static int syevd(const char jobz, const char uplo, const int n, T *a,
+                   const int lda, typename Kokkos::ArithTraits<T>::mag_type *w,
+                   T *work, int lwork,
+                   typename Kokkos::ArithTraits<T>::mag_type *rwork,
+                   int lrwork, int *iwork, int liwork);
 };
 }  // namespace Impl
 }  // namespace KokkosLapack
@@ -0,0 +1,279 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSLAPACK_GEQRF_TPL_SPEC_DECL_HPP_
+#define KOKKOSLAPACK_GEQRF_TPL_SPEC_DECL_HPP_
+
+namespace KokkosLapack {
+namespace Impl {
+template <class AViewType, class TauViewType>
+inline void geqrf_print_specialization() {
+#ifdef KOKKOSKERNELS_ENABLE_CHECK_SPECIALIZATION
+#ifdef KOKKOSKERNELS_ENABLE_TPL_LAPACK
+  printf("KokkosLapack::geqrf<> TPL Lapack specialization for < %s , %s >\n",
+         typeid(AViewType).name(), typeid(TauViewType).name());
+#endif
+#ifdef KOKKOSKERNELS_ENABLE_TPL_CUSOLVER
+  printf("KokkosLapack::geqrf<> TPL CUSOLVER specialization for < %s , %s >\n",
+         typeid(AViewType).name(), typeid(TauViewType).name());
+#endif
+#endif
+}
+}  // namespace Impl
+}  // namespace KokkosLapack
+
+// Generic Host side LAPACK (could be MKL or whatever)
+#ifdef KOKKOSKERNELS_ENABLE_TPL_LAPACK
+#include <KokkosLapack_Host_tpl.hpp>
+
+namespace KokkosLapack {
+namespace Impl {
+
+template <class AViewType, class TauViewType>
+int lapackGeqrfWrapper(const AViewType& A, const TauViewType& Tau) {
+  using memory_space = typename AViewType::memory_space;
+  using Scalar       = typename AViewType::non_const_value_type;
+
+  const int M   = static_cast<int>(A.extent(0));
+  const int N   = static_cast<int>(A.extent(1));
+  const int AST = static_cast<int>(A.stride(1));
+  const int LDA = (AST == 0) ? 1 : AST;
+
+  // Workspace query first, then the factorization
+  int lwork = -1, info = 0;
+  Kokkos::View<Scalar*, memory_space> work("geqrf work buffer", 1);
+  if constexpr (Kokkos::ArithTraits<Scalar>::is_complex) {
+    using MagType     = typename Kokkos::ArithTraits<Scalar>::mag_type;
+    using lapack_type = std::complex<MagType>;
+
+    info = HostLapack<lapack_type>::geqrf(
+        M, N, reinterpret_cast<lapack_type*>(A.data()), LDA,
+        reinterpret_cast<lapack_type*>(Tau.data()),
+        reinterpret_cast<lapack_type*>(work.data()), lwork);
+    lwork = static_cast<int>(work(0).real());
+
+    work = Kokkos::View<Scalar*, memory_space>("geqrf work buffer", lwork);
+    info = HostLapack<lapack_type>::geqrf(
+        M, N, reinterpret_cast<lapack_type*>(A.data()), LDA,
+        reinterpret_cast<lapack_type*>(Tau.data()),
+        reinterpret_cast<lapack_type*>(work.data()), lwork);
+  } else {
+    info  = HostLapack<Scalar>::geqrf(M, N, A.data(), LDA, Tau.data(),
+                                      work.data(), lwork);
+    lwork = static_cast<int>(work(0));
+
+    work = Kokkos::View<Scalar*, memory_space>("geqrf work buffer", lwork);
+    info = HostLapack<Scalar>::geqrf(M, N, A.data(), LDA, Tau.data(),
+                                     work.data(), lwork);
+  }
+  return info;
+}
+
+#define KOKKOSLAPACK_GEQRF_LAPACK(SCALAR, LAYOUT, EXECSPACE, MEM_SPACE)        \
+  template <>                                                                  \
+  struct GEQRF<                                                                \
+      EXECSPACE,                                                               \
+      Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<EXECSPACE, MEM_SPACE>,     \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,                   \
+      Kokkos::View<SCALAR*, LAYOUT, Kokkos::Device<EXECSPACE, MEM_SPACE>,      \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,                   \
+      true,                                                                    \
+      geqrf_eti_spec_avail<                                                    \
+          EXECSPACE,                                                           \
+          Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<EXECSPACE, MEM_SPACE>, \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged>>,               \
+          Kokkos::View<SCALAR*, LAYOUT, Kokkos::Device<EXECSPACE, MEM_SPACE>,  \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged>>>::value> {     \
+    using AViewType =                                                          \
+        Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<EXECSPACE, MEM_SPACE>,   \
+                     Kokkos::MemoryTraits<Kokkos::Unmanaged>>;                 \
+    using TauViewType =                                                        \
+        Kokkos::View<SCALAR*, LAYOUT, Kokkos::Device<EXECSPACE, MEM_SPACE>,    \
+                     Kokkos::MemoryTraits<Kokkos::Unmanaged>>;                 \
+                                                                               \
+    static int geqrf(const EXECSPACE& /* space */, const AViewType& A,         \
+                     const TauViewType& Tau) {                                 \
+      Kokkos::Profiling::pushRegion("KokkosLapack::geqrf[TPL_LAPACK," #SCALAR  \
+                                    "]");                                      \
+      geqrf_print_specialization<AViewType, TauViewType>();                    \
+      const int info = lapackGeqrfWrapper(A, Tau);                             \
+      Kokkos::Profiling::popRegion();                                          \
+      return info;                                                             \
+    }                                                                          \
+  };
+
+#if defined(KOKKOS_ENABLE_SERIAL)
+KOKKOSLAPACK_GEQRF_LAPACK(float, Kokkos::LayoutLeft, Kokkos::Serial,
+                          Kokkos::HostSpace)
+KOKKOSLAPACK_GEQRF_LAPACK(double, Kokkos::LayoutLeft, Kokkos::Serial,
+                          Kokkos::HostSpace)
+KOKKOSLAPACK_GEQRF_LAPACK(Kokkos::complex<float>, Kokkos::LayoutLeft,
+                          Kokkos::Serial, Kokkos::HostSpace)
+KOKKOSLAPACK_GEQRF_LAPACK(Kokkos::complex<double>, Kokkos::LayoutLeft,
+                          Kokkos::Serial, Kokkos::HostSpace)
+#endif
+
+#if defined(KOKKOS_ENABLE_OPENMP)
+KOKKOSLAPACK_GEQRF_LAPACK(float, Kokkos::LayoutLeft, Kokkos::OpenMP,
+                          Kokkos::HostSpace)
+KOKKOSLAPACK_GEQRF_LAPACK(double, Kokkos::LayoutLeft, Kokkos::OpenMP,
+                          Kokkos::HostSpace)
+KOKKOSLAPACK_GEQRF_LAPACK(Kokkos::complex<float>, Kokkos::LayoutLeft,
+                          Kokkos::OpenMP, Kokkos::HostSpace)
+KOKKOSLAPACK_GEQRF_LAPACK(Kokkos::complex<double>, Kokkos::LayoutLeft,
+                          Kokkos::OpenMP, Kokkos::HostSpace)
+#endif
+
+#if defined(KOKKOS_ENABLE_THREADS)
+KOKKOSLAPACK_GEQRF_LAPACK(float, Kokkos::LayoutLeft, Kokkos::Threads,
+                          Kokkos::HostSpace)
+KOKKOSLAPACK_GEQRF_LAPACK(double, Kokkos::LayoutLeft, Kokkos::Threads,
+                          Kokkos::HostSpace)
+KOKKOSLAPACK_GEQRF_LAPACK(Kokkos::complex<float>, Kokkos::LayoutLeft,
+                          Kokkos::Threads, Kokkos::HostSpace)
+KOKKOSLAPACK_GEQRF_LAPACK(Kokkos::complex<double>, Kokkos::LayoutLeft,
+                          Kokkos::Threads, Kokkos::HostSpace)
+#endif
+
+}  // namespace Impl
+}  // namespace KokkosLapack
+#endif  // KOKKOSKERNELS_ENABLE_TPL_LAPACK
+
+// CUSOLVER
+#ifdef KOKKOSKERNELS_ENABLE_TPL_CUSOLVER
+#include "KokkosLapack_cusolver.hpp"
+
+namespace KokkosLapack {
+namespace Impl {
+
+template <class ExecutionSpace, class AViewType, class TauViewType>
+int cusolverGeqrfWrapper(const ExecutionSpace& space, const AViewType& A,
+                         const TauViewType& Tau) {
+  using memory_space = typename AViewType::memory_space;
+  using Scalar       = typename AViewType::non_const_value_type;
+
+  const int m   = A.extent_int(0);
+  const int n   = A.extent_int(1);
+  const int lda = A.stride(1);
+  int lwork     = 0;
+  Kokkos::View<int, memory_space> info("geqrf info");
+
+  CudaLapackSingleton& s = CudaLapackSingleton::singleton();
+  KOKKOS_CUSOLVER_SAFE_CALL_IMPL(
+      cusolverDnSetStream(s.handle, space.cuda_stream()));
+  if constexpr (std::is_same_v<Scalar, float>) {
+    KOKKOS_CUSOLVER_SAFE_CALL_IMPL(
+        cusolverDnSgeqrf_bufferSize(s.handle, m, n, A.data(), lda, &lwork));
+    Kokkos::View<float*, memory_space> Workspace("geqrf workspace", lwork);
+
+    KOKKOS_CUSOLVER_SAFE_CALL_IMPL(
+        cusolverDnSgeqrf(s.handle, m, n, A.data(), lda, Tau.data(),
+                         Workspace.data(), lwork, info.data()));
+  }
+  if constexpr (std::is_same_v<Scalar, double>) {
+    KOKKOS_CUSOLVER_SAFE_CALL_IMPL(
+        cusolverDnDgeqrf_bufferSize(s.handle, m, n, A.data(), lda, &lwork));
+    Kokkos::View<double*, memory_space> Workspace("geqrf workspace", lwork);
+
+    KOKKOS_CUSOLVER_SAFE_CALL_IMPL(
+        cusolverDnDgeqrf(s.handle, m, n, A.data(), lda, Tau.data(),
+                         Workspace.data(), lwork, info.data()));
+  }
+  if constexpr (std::is_same_v<Scalar, Kokkos::complex<float>>) {
+    KOKKOS_CUSOLVER_SAFE_CALL_IMPL(cusolverDnCgeqrf_bufferSize(
+        s.handle, m, n, reinterpret_cast<cuComplex*>(A.data()), lda, &lwork));
+    Kokkos::View<cuComplex*, memory_space> Workspace("geqrf workspace", lwork);
+
+    KOKKOS_CUSOLVER_SAFE_CALL_IMPL(cusolverDnCgeqrf(
+        s.handle, m, n, reinterpret_cast<cuComplex*>(A.data()), lda,
+        reinterpret_cast<cuComplex*>(Tau.data()), Workspace.data(), lwork,
+        info.data()));
+  }
+  if constexpr (std::is_same_v<Scalar, Kokkos::complex<double>>) {
+    KOKKOS_CUSOLVER_SAFE_CALL_IMPL(cusolverDnZgeqrf_bufferSize(
+        s.handle, m, n, reinterpret_cast<cuDoubleComplex*>(A.data()), lda,
+        &lwork));
+    Kokkos::View<cuDoubleComplex*, memory_space> Workspace("geqrf workspace",
+                                                           lwork);
+
+    KOKKOS_CUSOLVER_SAFE_CALL_IMPL(cusolverDnZgeqrf(
+        s.handle, m, n, reinterpret_cast<cuDoubleComplex*>(A.data()), lda,
+        reinterpret_cast<cuDoubleComplex*>(Tau.data()), Workspace.data(),
+        lwork, info.data()));
+  }
+  KOKKOS_CUSOLVER_SAFE_CALL_IMPL(cusolverDnSetStream(s.handle, NULL));
+
+  int h_info = 0;
+  Kokkos::deep_copy(h_info, info);
+  return h_info;
+}
+
+#define KOKKOSLAPACK_GEQRF_CUSOLVER(SCALAR, LAYOUT, MEM_SPACE)                \
+  template <>                                                                 \
+  struct GEQRF<                                                               \
+      Kokkos::Cuda,                                                           \
+      Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<Kokkos::Cuda, MEM_SPACE>, \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,                  \
+      Kokkos::View<SCALAR*, LAYOUT, Kokkos::Device<Kokkos::Cuda, MEM_SPACE>,  \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,                  \
+      true,                                                                   \
+      geqrf_eti_spec_avail<                                                   \
+          Kokkos::Cuda,                                                       \
+          Kokkos::View<SCALAR**, LAYOUT,                                      \
+                       Kokkos::Device<Kokkos::Cuda, MEM_SPACE>,               \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged>>,              \
+          Kokkos::View<SCALAR*, LAYOUT,                                       \
+                       Kokkos::Device<Kokkos::Cuda, MEM_SPACE>,               \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged>>>::value> {    \
+    using AViewType = Kokkos::View<SCALAR**, LAYOUT,                          \
+                      Kokkos::Device<Kokkos::Cuda, MEM_SPACE>,                \
+                      Kokkos::MemoryTraits<Kokkos::Unmanaged>>;               \
+    using TauViewType = Kokkos::View<SCALAR*, LAYOUT,                         \
+                        Kokkos::Device<Kokkos::Cuda, MEM_SPACE>,              \
+                        Kokkos::MemoryTraits<Kokkos::Unmanaged>>;             \
+                                                                              \
+    static int geqrf(const Kokkos::Cuda& space, const AViewType& A,           \
+                     const TauViewType& Tau) {                                \
+      Kokkos::Profiling::pushRegion(                                          \
+          "KokkosLapack::geqrf[TPL_CUSOLVER," #SCALAR "]");                   \
+      geqrf_print_specialization<AViewType, TauViewType>();                   \
+      const int info = cusolverGeqrfWrapper(space, A, Tau);                   \
+      Kokkos::Profiling::popRegion();                                         \
+      return info;                                                            \
+    }                                                                         \
+  };
+
+KOKKOSLAPACK_GEQRF_CUSOLVER(float, Kokkos::LayoutLeft, Kokkos::CudaSpace)
+KOKKOSLAPACK_GEQRF_CUSOLVER(double, Kokkos::LayoutLeft, Kokkos::CudaSpace)
+KOKKOSLAPACK_GEQRF_CUSOLVER(Kokkos::complex<float>, Kokkos::LayoutLeft,
+                            Kokkos::CudaSpace)
+KOKKOSLAPACK_GEQRF_CUSOLVER(Kokkos::complex<double>, Kokkos::LayoutLeft,
+                            Kokkos::CudaSpace)
+
+#if defined(KOKKOSKERNELS_INST_MEMSPACE_CUDAUVMSPACE)
+KOKKOSLAPACK_GEQRF_CUSOLVER(float, Kokkos::LayoutLeft, Kokkos::CudaUVMSpace)
+KOKKOSLAPACK_GEQRF_CUSOLVER(double, Kokkos::LayoutLeft, Kokkos::CudaUVMSpace)
+KOKKOSLAPACK_GEQRF_CUSOLVER(Kokkos::complex<float>, Kokkos::LayoutLeft,
+                            Kokkos::CudaUVMSpace)
+KOKKOSLAPACK_GEQRF_CUSOLVER(Kokkos::complex<double>, Kokkos::LayoutLeft,
+                            Kokkos::CudaUVMSpace)
+#endif
+
+}  // namespace Impl
+}  // namespace KokkosLapack
+#endif  // KOKKOSKERNELS_ENABLE_TPL_CUSOLVER
+
+#endif
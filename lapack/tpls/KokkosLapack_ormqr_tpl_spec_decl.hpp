@@ -0,0 +1,344 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSLAPACK_ORMQR_TPL_SPEC_DECL_HPP_
+#define KOKKOSLAPACK_ORMQR_TPL_SPEC_DECL_HPP_
+
+namespace KokkosLapack {
+namespace Impl {
+template <class AViewType, class TauViewType, class CViewType>
+inline void ormqr_print_specialization() {
+#ifdef KOKKOSKERNELS_ENABLE_CHECK_SPECIALIZATION
+#ifdef KOKKOSKERNELS_ENABLE_TPL_LAPACK
+  printf(
+      "KokkosLapack::ormqr<> TPL Lapack specialization for < %s , %s , %s "
+      ">\n",
+      typeid(AViewType).name(), typeid(TauViewType).name(),
+      typeid(CViewType).name());
+#endif
+#ifdef KOKKOSKERNELS_ENABLE_TPL_CUSOLVER
+  printf(
+      "KokkosLapack::ormqr<> TPL CUSOLVER specialization for < %s , %s , %s "
+      ">\n",
+      typeid(AViewType).name(), typeid(TauViewType).name(),
+      typeid(CViewType).name());
+#endif
+#endif
+}
+}  // namespace Impl
+}  // namespace KokkosLapack
+
+// Generic Host side LAPACK (could be MKL or whatever)
+#ifdef KOKKOSKERNELS_ENABLE_TPL_LAPACK
+#include <KokkosLapack_Host_tpl.hpp>
+
+namespace KokkosLapack {
+namespace Impl {
+
+template <class AViewType, class TauViewType, class CViewType>
+int lapackOrmqrWrapper(const char side[], const char trans[],
+                       const AViewType& A, const TauViewType& Tau,
+                       const CViewType& C) {
+  using memory_space = typename CViewType::memory_space;
+  using Scalar       = typename CViewType::non_const_value_type;
+
+  // Q^H is spelled 'T' by xORMQR and 'C' by xUNMQR
+  const char lapack_side  = ((side[0] == 'L') || (side[0] == 'l')) ? 'L' : 'R';
+  const char lapack_trans = ((trans[0] == 'N') || (trans[0] == 'n'))
+                                ? 'N'
+                                : (Kokkos::ArithTraits<Scalar>::is_complex
+                                       ? 'C'
+                                       : 'T');
+
+  const int M   = static_cast<int>(C.extent(0));
+  const int N   = static_cast<int>(C.extent(1));
+  const int K   = static_cast<int>(Kokkos::min(A.extent(0), A.extent(1)));
+  const int AST = static_cast<int>(A.stride(1));
+  const int LDA = (AST == 0) ? 1 : AST;
+  const int CST = static_cast<int>(C.stride(1));
+  const int LDC = (CST == 0) ? 1 : CST;
+
+  // Workspace query first, then the multiplication
+  int lwork = -1, info = 0;
+  Kokkos::View<Scalar*, memory_space> work("ormqr work buffer", 1);
+  if constexpr (Kokkos::ArithTraits<Scalar>::is_complex) {
+    using MagType     = typename Kokkos::ArithTraits<Scalar>::mag_type;
+    using lapack_type = std::complex<MagType>;
+
+    info = HostLapack<lapack_type>::ormqr(
+        lapack_side, lapack_trans, M, N, K,
+        reinterpret_cast<const lapack_type*>(A.data()), LDA,
+        reinterpret_cast<const lapack_type*>(Tau.data()),
+        reinterpret_cast<lapack_type*>(C.data()), LDC,
+        reinterpret_cast<lapack_type*>(work.data()), lwork);
+    lwork = static_cast<int>(work(0).real());
+
+    work = Kokkos::View<Scalar*, memory_space>("ormqr work buffer", lwork);
+    info = HostLapack<lapack_type>::ormqr(
+        lapack_side, lapack_trans, M, N, K,
+        reinterpret_cast<const lapack_type*>(A.data()), LDA,
+        reinterpret_cast<const lapack_type*>(Tau.data()),
+        reinterpret_cast<lapack_type*>(C.data()), LDC,
+        reinterpret_cast<lapack_type*>(work.data()), lwork);
+  } else {
+    info  = HostLapack<Scalar>::ormqr(lapack_side, lapack_trans, M, N, K,
+                                      A.data(), LDA, Tau.data(), C.data(), LDC,
+                                      work.data(), lwork);
+    lwork = static_cast<int>(work(0));
+
+    work = Kokkos::View<Scalar*, memory_space>("ormqr work buffer", lwork);
+    info = HostLapack<Scalar>::ormqr(lapack_side, lapack_trans, M, N, K,
+                                     A.data(), LDA, Tau.data(), C.data(), LDC,
+                                     work.data(), lwork);
+  }
+  return info;
+}
+
+#define KOKKOSLAPACK_ORMQR_LAPACK(SCALAR, LAYOUT, EXECSPACE, MEM_SPACE)        \
+  template <>                                                                  \
+  struct ORMQR<                                                                \
+      EXECSPACE,                                                               \
+      Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<EXECSPACE, MEM_SPACE>,     \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,                   \
+      Kokkos::View<SCALAR*, LAYOUT, Kokkos::Device<EXECSPACE, MEM_SPACE>,      \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,                   \
+      Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<EXECSPACE, MEM_SPACE>,     \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,                   \
+      true,                                                                    \
+      ormqr_eti_spec_avail<                                                    \
+          EXECSPACE,                                                           \
+          Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<EXECSPACE, MEM_SPACE>, \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged>>,               \
+          Kokkos::View<SCALAR*, LAYOUT, Kokkos::Device<EXECSPACE, MEM_SPACE>,  \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged>>,               \
+          Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<EXECSPACE, MEM_SPACE>, \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged>>>::value> {     \
+    using AViewType =                                                          \
+        Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<EXECSPACE, MEM_SPACE>,   \
+                     Kokkos::MemoryTraits<Kokkos::Unmanaged>>;                 \
+    using TauViewType =                                                        \
+        Kokkos::View<SCALAR*, LAYOUT, Kokkos::Device<EXECSPACE, MEM_SPACE>,    \
+                     Kokkos::MemoryTraits<Kokkos::Unmanaged>>;                 \
+    using CViewType =                                                          \
+        Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<EXECSPACE, MEM_SPACE>,   \
+                     Kokkos::MemoryTraits<Kokkos::Unmanaged>>;                 \
+                                                                               \
+    static int ormqr(const EXECSPACE& /* space */, const char side[],          \
+                     const char trans[], const AViewType& A,                   \
+                     const TauViewType& Tau, const CViewType& C) {             \
+      Kokkos::Profiling::pushRegion("KokkosLapack::ormqr[TPL_LAPACK," #SCALAR  \
+                                    "]");                                      \
+      ormqr_print_specialization<AViewType, TauViewType, CViewType>();         \
+      const int info = lapackOrmqrWrapper(side, trans, A, Tau, C);             \
+      Kokkos::Profiling::popRegion();                                          \
+      return info;                                                             \
+    }                                                                          \
+  };
+
+#if defined(KOKKOS_ENABLE_SERIAL)
+KOKKOSLAPACK_ORMQR_LAPACK(float, Kokkos::LayoutLeft, Kokkos::Serial,
+                          Kokkos::HostSpace)
+KOKKOSLAPACK_ORMQR_LAPACK(double, Kokkos::LayoutLeft, Kokkos::Serial,
+                          Kokkos::HostSpace)
+KOKKOSLAPACK_ORMQR_LAPACK(Kokkos::complex<float>, Kokkos::LayoutLeft,
+                          Kokkos::Serial, Kokkos::HostSpace)
+KOKKOSLAPACK_ORMQR_LAPACK(Kokkos::complex<double>, Kokkos::LayoutLeft,
+                          Kokkos::Serial, Kokkos::HostSpace)
+#endif
+
+#if defined(KOKKOS_ENABLE_OPENMP)
+KOKKOSLAPACK_ORMQR_LAPACK(float, Kokkos::LayoutLeft, Kokkos::OpenMP,
+                          Kokkos::HostSpace)
+KOKKOSLAPACK_ORMQR_LAPACK(double, Kokkos::LayoutLeft, Kokkos::OpenMP,
+                          Kokkos::HostSpace)
+KOKKOSLAPACK_ORMQR_LAPACK(Kokkos::complex<float>, Kokkos::LayoutLeft,
+                          Kokkos::OpenMP, Kokkos::HostSpace)
+KOKKOSLAPACK_ORMQR_LAPACK(Kokkos::complex<double>, Kokkos::LayoutLeft,
+                          Kokkos::OpenMP, Kokkos::HostSpace)
+#endif
+
+#if defined(KOKKOS_ENABLE_THREADS)
+KOKKOSLAPACK_ORMQR_LAPACK(float, Kokkos::LayoutLeft, Kokkos::Threads,
+                          Kokkos::HostSpace)
+KOKKOSLAPACK_ORMQR_LAPACK(double, Kokkos::LayoutLeft, Kokkos::Threads,
+                          Kokkos::HostSpace)
+KOKKOSLAPACK_ORMQR_LAPACK(Kokkos::complex<float>, Kokkos::LayoutLeft,
+                          Kokkos::Threads, Kokkos::HostSpace)
+KOKKOSLAPACK_ORMQR_LAPACK(Kokkos::complex<double>, Kokkos::LayoutLeft,
+                          Kokkos::Threads, Kokkos::HostSpace)
+#endif
+
+}  // namespace Impl
+}  // namespace KokkosLapack
+#endif  // KOKKOSKERNELS_ENABLE_TPL_LAPACK
+
+// CUSOLVER
+#ifdef KOKKOSKERNELS_ENABLE_TPL_CUSOLVER
+#include "KokkosLapack_cusolver.hpp"
+
+namespace KokkosLapack {
+namespace Impl {
+
+template <class ExecutionSpace, class AViewType, class TauViewType,
+          class CViewType>
+int cusolverOrmqrWrapper(const ExecutionSpace& space, const char side[],
+                         const char trans[], const AViewType& A,
+                         const TauViewType& Tau, const CViewType& C) {
+  using memory_space = typename CViewType::memory_space;
+  using Scalar       = typename CViewType::non_const_value_type;
+
+  const cublasSideMode_t cu_side = ((side[0] == 'L') || (side[0] == 'l'))
+                                       ? CUBLAS_SIDE_LEFT
+                                       : CUBLAS_SIDE_RIGHT;
+  const cublasOperation_t cu_trans =
+      ((trans[0] == 'N') || (trans[0] == 'n'))
+          ? CUBLAS_OP_N
+          : (Kokkos::ArithTraits<Scalar>::is_complex ? CUBLAS_OP_C
+                                                     : CUBLAS_OP_T);
+  const int m   = C.extent_int(0);
+  const int n   = C.extent_int(1);
+  const int k   = Kokkos::min(A.extent_int(0), A.extent_int(1));
+  const int lda = A.stride(1);
+  const int ldc = C.stride(1);
+  int lwork     = 0;
+  Kokkos::View<int, memory_space> info("ormqr info");
+
+  CudaLapackSingleton& s = CudaLapackSingleton::singleton();
+  KOKKOS_CUSOLVER_SAFE_CALL_IMPL(
+      cusolverDnSetStream(s.handle, space.cuda_stream()));
+  if constexpr (std::is_same_v<Scalar, float>) {
+    KOKKOS_CUSOLVER_SAFE_CALL_IMPL(cusolverDnSormqr_bufferSize(
+        s.handle, cu_side, cu_trans, m, n, k, A.data(), lda, Tau.data(),
+        C.data(), ldc, &lwork));
+    Kokkos::View<float*, memory_space> Workspace("ormqr workspace", lwork);
+
+    KOKKOS_CUSOLVER_SAFE_CALL_IMPL(cusolverDnSormqr(
+        s.handle, cu_side, cu_trans, m, n, k, A.data(), lda, Tau.data(),
+        C.data(), ldc, Workspace.data(), lwork, info.data()));
+  }
+  if constexpr (std::is_same_v<Scalar, double>) {
+    KOKKOS_CUSOLVER_SAFE_CALL_IMPL(cusolverDnDormqr_bufferSize(
+        s.handle, cu_side, cu_trans, m, n, k, A.data(), lda, Tau.data(),
+        C.data(), ldc, &lwork));
+    Kokkos::View<double*, memory_space> Workspace("ormqr workspace", lwork);
+
+    KOKKOS_CUSOLVER_SAFE_CALL_IMPL(cusolverDnDormqr(
+        s.handle, cu_side, cu_trans, m, n, k, A.data(), lda, Tau.data(),
+        C.data(), ldc, Workspace.data(), lwork, info.data()));
+  }
+  if constexpr (std::is_same_v<Scalar, Kokkos::complex<float>>) {
+    KOKKOS_CUSOLVER_SAFE_CALL_IMPL(cusolverDnCunmqr_bufferSize(
+        s.handle, cu_side, cu_trans, m, n, k,
+        reinterpret_cast<const cuComplex*>(A.data()), lda,
+        reinterpret_cast<const cuComplex*>(Tau.data()),
+        reinterpret_cast<const cuComplex*>(C.data()), ldc, &lwork));
+    Kokkos::View<cuComplex*, memory_space> Workspace("ormqr workspace", lwork);
+
+    KOKKOS_CUSOLVER_SAFE_CALL_IMPL(cusolverDnCunmqr(
+        s.handle, cu_side, cu_trans, m, n, k,
+        reinterpret_cast<const cuComplex*>(A.data()), lda,
+        reinterpret_cast<const cuComplex*>(Tau.data()),
+        reinterpret_cast<cuComplex*>(C.data()), ldc, Workspace.data(), lwork,
+        info.data()));
+  }
+  if constexpr (std::is_same_v<Scalar, Kokkos::complex<double>>) {
+    KOKKOS_CUSOLVER_SAFE_CALL_IMPL(cusolverDnZunmqr_bufferSize(
+        s.handle, cu_side, cu_trans, m, n, k,
+        reinterpret_cast<const cuDoubleComplex*>(A.data()), lda,
+        reinterpret_cast<const cuDoubleComplex*>(Tau.data()),
+        reinterpret_cast<const cuDoubleComplex*>(C.data()), ldc, &lwork));
+    Kokkos::View<cuDoubleComplex*, memory_space> Workspace("ormqr workspace",
+                                                           lwork);
+
+    KOKKOS_CUSOLVER_SAFE_CALL_IMPL(cusolverDnZunmqr(
+        s.handle, cu_side, cu_trans, m, n, k,
+        reinterpret_cast<const cuDoubleComplex*>(A.data()), lda,
+        reinterpret_cast<const cuDoubleComplex*>(Tau.data()),
+        reinterpret_cast<cuDoubleComplex*>(C.data()), ldc, Workspace.data(),
+        lwork, info.data()));
+  }
+  KOKKOS_CUSOLVER_SAFE_CALL_IMPL(cusolverDnSetStream(s.handle, NULL));
+
+  int h_info = 0;
+  Kokkos::deep_copy(h_info, info);
+  return h_info;
+}
+
+#define KOKKOSLAPACK_ORMQR_CUSOLVER(SCALAR, LAYOUT, MEM_SPACE)                \
+  template <>                                                                 \
+  struct ORMQR<                                                               \
+      Kokkos::Cuda,                                                           \
+      Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<Kokkos::Cuda, MEM_SPACE>, \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,                  \
+      Kokkos::View<SCALAR*, LAYOUT, Kokkos::Device<Kokkos::Cuda, MEM_SPACE>,  \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,                  \
+      Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<Kokkos::Cuda, MEM_SPACE>, \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,                  \
+      true,                                                                   \
+      ormqr_eti_spec_avail<                                                   \
+          Kokkos::Cuda,                                                       \
+          Kokkos::View<SCALAR**, LAYOUT,                                      \
+                       Kokkos::Device<Kokkos::Cuda, MEM_SPACE>,               \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged>>,              \
+          Kokkos::View<SCALAR*, LAYOUT,                                       \
+                       Kokkos::Device<Kokkos::Cuda, MEM_SPACE>,               \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged>>,              \
+          Kokkos::View<SCALAR**, LAYOUT,                                      \
+                       Kokkos::Device<Kokkos::Cuda, MEM_SPACE>,               \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged>>>::value> {    \
+    using AViewType = Kokkos::View<SCALAR**, LAYOUT,                          \
+                      Kokkos::Device<Kokkos::Cuda, MEM_SPACE>,                \
+                      Kokkos::MemoryTraits<Kokkos::Unmanaged>>;               \
+    using TauViewType = Kokkos::View<SCALAR*, LAYOUT,                         \
+                        Kokkos::Device<Kokkos::Cuda, MEM_SPACE>,              \
+                        Kokkos::MemoryTraits<Kokkos::Unmanaged>>;             \
+    using CViewType = Kokkos::View<SCALAR**, LAYOUT,                          \
+                      Kokkos::Device<Kokkos::Cuda, MEM_SPACE>,                \
+                      Kokkos::MemoryTraits<Kokkos::Unmanaged>>;               \
+                                                                              \
+    static int ormqr(const Kokkos::Cuda& space, const char side[],            \
+                     const char trans[], const AViewType& A,                  \
+                     const TauViewType& Tau, const CViewType& C) {            \
+      Kokkos::Profiling::pushRegion(                                          \
+          "KokkosLapack::ormqr[TPL_CUSOLVER," #SCALAR "]");                   \
+      ormqr_print_specialization<AViewType, TauViewType, CViewType>();        \
+      const int info = cusolverOrmqrWrapper(space, side, trans, A, Tau, C);   \
+      Kokkos::Profiling::popRegion();                                         \
+      return info;                                                            \
+    }                                                                         \
+  };
+
+KOKKOSLAPACK_ORMQR_CUSOLVER(float, Kokkos::LayoutLeft, Kokkos::CudaSpace)
+KOKKOSLAPACK_ORMQR_CUSOLVER(double, Kokkos::LayoutLeft, Kokkos::CudaSpace)
+KOKKOSLAPACK_ORMQR_CUSOLVER(Kokkos::complex<float>, Kokkos::LayoutLeft,
+                            Kokkos::CudaSpace)
+KOKKOSLAPACK_ORMQR_CUSOLVER(Kokkos::complex<double>, Kokkos::LayoutLeft,
+                            Kokkos::CudaSpace)
+
+#if defined(KOKKOSKERNELS_INST_MEMSPACE_CUDAUVMSPACE)
+KOKKOSLAPACK_ORMQR_CUSOLVER(float, Kokkos::LayoutLeft, Kokkos::CudaUVMSpace)
+KOKKOSLAPACK_ORMQR_CUSOLVER(double, Kokkos::LayoutLeft, Kokkos::CudaUVMSpace)
+KOKKOSLAPACK_ORMQR_CUSOLVER(Kokkos::complex<float>, Kokkos::LayoutLeft,
+                            Kokkos::CudaUVMSpace)
+KOKKOSLAPACK_ORMQR_CUSOLVER(Kokkos::complex<double>, Kokkos::LayoutLeft,
+                            Kokkos::CudaUVMSpace)
+#endif
+
+}  // namespace Impl
+}  // namespace KokkosLapack
+#endif  // KOKKOSKERNELS_ENABLE_TPL_CUSOLVER
+
+#endif
@@ -0,0 +1,329 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSLAPACK_POTRF_TPL_SPEC_DECL_HPP_
+#define KOKKOSLAPACK_POTRF_TPL_SPEC_DECL_HPP_
+
+namespace KokkosLapack {
+namespace Impl {
+template <class AViewType>
+inline void potrf_print_specialization() {
+#ifdef KOKKOSKERNELS_ENABLE_CHECK_SPECIALIZATION
+#ifdef KOKKOSKERNELS_ENABLE_TPL_MAGMA
+  printf("KokkosLapack::potrf<> TPL MAGMA specialization for < %s >\n",
+         typeid(AViewType).name());
+#else
+#ifdef KOKKOSKERNELS_ENABLE_TPL_LAPACK
+  printf("KokkosLapack::potrf<> TPL Lapack specialization for < %s >\n",
+         typeid(AViewType).name());
+#endif
+#endif
+#endif
+}
+}  // namespace Impl
+}  // namespace KokkosLapack
+
+// Generic Host side LAPACK (could be MKL or whatever)
+#ifdef KOKKOSKERNELS_ENABLE_TPL_LAPACK
+#include <KokkosLapack_Host_tpl.hpp>
+
+namespace KokkosLapack {
+namespace Impl {
+
+template <class AViewType>
+int lapackPotrfWrapper(const char uplo[], const AViewType& A) {
+  using Scalar = typename AViewType::non_const_value_type;
+
+  const int N   = static_cast<int>(A.extent(1));
+  const int AST = static_cast<int>(A.stride(1));
+  const int LDA = (AST == 0) ? 1 : AST;
+
+  if constexpr (Kokkos::ArithTraits<Scalar>::is_complex) {
+    using MagType = typename Kokkos::ArithTraits<Scalar>::mag_type;
+
+    return HostLapack<std::complex<MagType>>::potrf(
+        uplo[0], N, reinterpret_cast<std::complex<MagType>*>(A.data()), LDA);
+  } else {
+    return HostLapack<Scalar>::potrf(uplo[0], N, A.data(), LDA);
+  }
+}
+
+#define KOKKOSLAPACK_POTRF_LAPACK(SCALAR, LAYOUT, EXECSPACE, MEM_SPACE)        \
+  template <>                                                                  \
+  struct POTRF<                                                                \
+      EXECSPACE,                                                               \
+      Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<EXECSPACE, MEM_SPACE>,     \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,                   \
+      true,                                                                    \
+      potrf_eti_spec_avail<                                                    \
+          EXECSPACE,                                                           \
+          Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<EXECSPACE, MEM_SPACE>, \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged>>>::value> {     \
+    using AViewType =                                                          \
+        Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<EXECSPACE, MEM_SPACE>,   \
+                     Kokkos::MemoryTraits<Kokkos::Unmanaged>>;                 \
+                                                                               \
+    static int potrf(const EXECSPACE& /* space */, const char uplo[],          \
+                     const AViewType& A) {                                     \
+      Kokkos::Profiling::pushRegion("KokkosLapack::potrf[TPL_LAPACK," #SCALAR  \
+                                    "]");                                      \
+      potrf_print_specialization<AViewType>();                                 \
+      const int info = lapackPotrfWrapper(uplo, A);                            \
+      Kokkos::Profiling::popRegion();                                          \
+      return info;                                                             \
+    }                                                                          \
+  };
+
+#if defined(KOKKOS_ENABLE_SERIAL)
+KOKKOSLAPACK_POTRF_LAPACK(float, Kokkos::LayoutLeft, Kokkos::Serial,
+                          Kokkos::HostSpace)
+KOKKOSLAPACK_POTRF_LAPACK(double, Kokkos::LayoutLeft, Kokkos::Serial,
+                          Kokkos::HostSpace)
+KOKKOSLAPACK_POTRF_LAPACK(Kokkos::complex<float>, Kokkos::LayoutLeft,
+                          Kokkos::Serial, Kokkos::HostSpace)
+KOKKOSLAPACK_POTRF_LAPACK(Kokkos::complex<double>, Kokkos::LayoutLeft,
+                          Kokkos::Serial, Kokkos::HostSpace)
+#endif
+
+#if defined(KOKKOS_ENABLE_OPENMP)
+KOKKOSLAPACK_POTRF_LAPACK(float, Kokkos::LayoutLeft, Kokkos::OpenMP,
+                          Kokkos::HostSpace)
+KOKKOSLAPACK_POTRF_LAPACK(double, Kokkos::LayoutLeft, Kokkos::OpenMP,
+                          Kokkos::HostSpace)
+KOKKOSLAPACK_POTRF_LAPACK(Kokkos::complex<float>, Kokkos::LayoutLeft,
+                          Kokkos::OpenMP, Kokkos::HostSpace)
+KOKKOSLAPACK_POTRF_LAPACK(Kokkos::complex<double>, Kokkos::LayoutLeft,
+                          Kokkos::OpenMP, Kokkos::HostSpace)
+#endif
+
+#if defined(KOKKOS_ENABLE_THREADS)
+KOKKOSLAPACK_POTRF_LAPACK(float, Kokkos::LayoutLeft, Kokkos::Threads,
+                          Kokkos::HostSpace)
+KOKKOSLAPACK_POTRF_LAPACK(double, Kokkos::LayoutLeft, Kokkos::Threads,
+                          Kokkos::HostSpace)
+KOKKOSLAPACK_POTRF_LAPACK(Kokkos::complex<float>, Kokkos::LayoutLeft,
+                          Kokkos::Threads, Kokkos::HostSpace)
+KOKKOSLAPACK_POTRF_LAPACK(Kokkos::complex<double>, Kokkos::LayoutLeft,
+                          Kokkos::Threads, Kokkos::HostSpace)
+#endif
+
+}  // namespace Impl
+}  // namespace KokkosLapack
+#endif  // KOKKOSKERNELS_ENABLE_TPL_LAPACK
+
+// MAGMA
+#ifdef KOKKOSKERNELS_ENABLE_TPL_MAGMA
+#include <KokkosLapack_magma.hpp>
+
+namespace KokkosLapack {
+namespace Impl {
+
+template <class ExecSpace, class AViewType>
+int magmaPotrfWrapper(const ExecSpace& space, const char uplo[],
+                      const AViewType& A) {
+  using scalar_type = typename AViewType::non_const_value_type;
+
+  const magma_uplo_t magma_uplo =
+      ((uplo[0] == 'L') || (uplo[0] == 'l')) ? MagmaLower : MagmaUpper;
+  magma_int_t N   = static_cast<magma_int_t>(A.extent(1));
+  magma_int_t AST = static_cast<magma_int_t>(A.stride(1));
+  magma_int_t LDA = (AST == 0) ? 1 : AST;
+
+  KokkosLapack::Impl::MagmaSingleton& s =
+      KokkosLapack::Impl::MagmaSingleton::singleton();
+  (void)s;
+  magma_int_t info = 0;
+
+  space.fence();
+  if constexpr (std::is_same_v<scalar_type, float>) {
+    magma_spotrf_gpu(magma_uplo, N, reinterpret_cast<magmaFloat_ptr>(A.data()),
+                     LDA, &info);
+  }
+  if constexpr (std::is_same_v<scalar_type, double>) {
+    magma_dpotrf_gpu(magma_uplo, N,
+                     reinterpret_cast<magmaDouble_ptr>(A.data()), LDA, &info);
+  }
+  if constexpr (std::is_same_v<scalar_type, Kokkos::complex<float>>) {
+    magma_cpotrf_gpu(magma_uplo, N,
+                     reinterpret_cast<magmaFloatComplex_ptr>(A.data()), LDA,
+                     &info);
+  }
+  if constexpr (std::is_same_v<scalar_type, Kokkos::complex<double>>) {
+    magma_zpotrf_gpu(magma_uplo, N,
+                     reinterpret_cast<magmaDoubleComplex_ptr>(A.data()), LDA,
+                     &info);
+  }
+  ExecSpace().fence();
+  return static_cast<int>(info);
+}
+
+#define KOKKOSLAPACK_POTRF_MAGMA(SCALAR, LAYOUT, MEM_SPACE)                   \
+  template <>                                                                 \
+  struct POTRF<                                                               \
+      Kokkos::Cuda,                                                           \
+      Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<Kokkos::Cuda, MEM_SPACE>, \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,                  \
+      true,                                                                   \
+      potrf_eti_spec_avail<                                                   \
+          Kokkos::Cuda,                                                       \
+          Kokkos::View<SCALAR**, LAYOUT,                                      \
+                       Kokkos::Device<Kokkos::Cuda, MEM_SPACE>,               \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged>>>::value> {    \
+    using AViewType = Kokkos::View<SCALAR**, LAYOUT,                          \
+                                   Kokkos::Device<Kokkos::Cuda, MEM_SPACE>,   \
+                                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>;  \
+                                                                              \
+    static int potrf(const Kokkos::Cuda& space, const char uplo[],            \
+                     const AViewType& A) {                                    \
+      Kokkos::Profiling::pushRegion("KokkosLapack::potrf[TPL_MAGMA," #SCALAR  \
+                                    "]");                                     \
+      potrf_print_specialization<AViewType>();                                \
+      const int info = magmaPotrfWrapper(space, uplo, A);                     \
+      Kokkos::Profiling::popRegion();                                         \
+      return info;                                                            \
+    }                                                                         \
+  };
+
+KOKKOSLAPACK_POTRF_MAGMA(float, Kokkos::LayoutLeft, Kokkos::CudaSpace)
+KOKKOSLAPACK_POTRF_MAGMA(double, Kokkos::LayoutLeft, Kokkos::CudaSpace)
+KOKKOSLAPACK_POTRF_MAGMA(Kokkos::complex<float>, Kokkos::LayoutLeft,
+                         Kokkos::CudaSpace)
+KOKKOSLAPACK_POTRF_MAGMA(Kokkos::complex<double>, Kokkos::LayoutLeft,
+                         Kokkos::CudaSpace)
+
+}  // namespace Impl
+}  // namespace KokkosLapack
+#endif  // KOKKOSKERNELS_ENABLE_TPL_MAGMA
+
+// CUSOLVER
+#if defined(KOKKOSKERNELS_ENABLE_TPL_CUSOLVER) && \
+    !defined(KOKKOSKERNELS_ENABLE_TPL_MAGMA)
+#include "KokkosLapack_cusolver.hpp"
+
+namespace KokkosLapack {
+namespace Impl {
+
+template <class ExecutionSpace, class AViewType>
+int cusolverPotrfWrapper(const ExecutionSpace& space, const char uplo[],
+                         const AViewType& A) {
+  using memory_space = typename AViewType::memory_space;
+  using Scalar       = typename AViewType::non_const_value_type;
+
+  const cublasFillMode_t fill = ((uplo[0] == 'L') || (uplo[0] == 'l'))
+                                    ? CUBLAS_FILL_MODE_LOWER
+                                    : CUBLAS_FILL_MODE_UPPER;
+  const int n   = A.extent_int(1);
+  const int lda = A.stride(1);
+  int lwork     = 0;
+  Kokkos::View<int, memory_space> info("potrf info");
+
+  CudaLapackSingleton& s = CudaLapackSingleton::singleton();
+  KOKKOS_CUSOLVER_SAFE_CALL_IMPL(
+      cusolverDnSetStream(s.handle, space.cuda_stream()));
+  if constexpr (std::is_same_v<Scalar, float>) {
+    KOKKOS_CUSOLVER_SAFE_CALL_IMPL(cusolverDnSpotrf_bufferSize(
+        s.handle, fill, n, A.data(), lda, &lwork));
+    Kokkos::View<float*, memory_space> Workspace("potrf workspace", lwork);
+
+    KOKKOS_CUSOLVER_SAFE_CALL_IMPL(
+        cusolverDnSpotrf(s.handle, fill, n, A.data(), lda, Workspace.data(),
+                         lwork, info.data()));
+  }
+  if constexpr (std::is_same_v<Scalar, double>) {
+    KOKKOS_CUSOLVER_SAFE_CALL_IMPL(cusolverDnDpotrf_bufferSize(
+        s.handle, fill, n, A.data(), lda, &lwork));
+    Kokkos::View<double*, memory_space> Workspace("potrf workspace", lwork);
+
+    KOKKOS_CUSOLVER_SAFE_CALL_IMPL(
+        cusolverDnDpotrf(s.handle, fill, n, A.data(), lda, Workspace.data(),
+                         lwork, info.data()));
+  }
+  if constexpr (std::is_same_v<Scalar, Kokkos::complex<float>>) {
+    KOKKOS_CUSOLVER_SAFE_CALL_IMPL(cusolverDnCpotrf_bufferSize(
+        s.handle, fill, n, reinterpret_cast<cuComplex*>(A.data()), lda,
+        &lwork));
+    Kokkos::View<cuComplex*, memory_space> Workspace("potrf workspace", lwork);
+
+    KOKKOS_CUSOLVER_SAFE_CALL_IMPL(cusolverDnCpotrf(
+        s.handle, fill, n, reinterpret_cast<cuComplex*>(A.data()), lda,
+        Workspace.data(), lwork, info.data()));
+  }
+  if constexpr (std::is_same_v<Scalar, Kokkos::complex<double>>) {
+    KOKKOS_CUSOLVER_SAFE_CALL_IMPL(cusolverDnZpotrf_bufferSize(
+        s.handle, fill, n, reinterpret_cast<cuDoubleComplex*>(A.data()), lda,
+        &lwork));
+    Kokkos::View<cuDoubleComplex*, memory_space> Workspace("potrf workspace",
+                                                           lwork);
+
+    KOKKOS_CUSOLVER_SAFE_CALL_IMPL(cusolverDnZpotrf(
+        s.handle, fill, n, reinterpret_cast<cuDoubleComplex*>(A.data()), lda,
+        Workspace.data(), lwork, info.data()));
+  }
+  KOKKOS_CUSOLVER_SAFE_CALL_IMPL(cusolverDnSetStream(s.handle, NULL));
+
+  int h_info = 0;
+  Kokkos::deep_copy(h_info, info);
+  return h_info;
+}
+
+#define KOKKOSLAPACK_POTRF_CUSOLVER(SCALAR, LAYOUT, MEM_SPACE)                \
+  template <>                                                                 \
+  struct POTRF<                                                               \
+      Kokkos::Cuda,                                                           \
+      Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<Kokkos::Cuda, MEM_SPACE>, \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,                  \
+      true,                                                                   \
+      potrf_eti_spec_avail<                                                   \
+          Kokkos::Cuda,                                                       \
+          Kokkos::View<SCALAR**, LAYOUT,                                      \
+                       Kokkos::Device<Kokkos::Cuda, MEM_SPACE>,               \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged>>>::value> {    \
+    using AViewType = Kokkos::View<SCALAR**, LAYOUT,                          \
+                                   Kokkos::Device<Kokkos::Cuda, MEM_SPACE>,   \
+                                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>;  \
+                                                                              \
+    static int potrf(const Kokkos::Cuda& space, const char uplo[],            \
+                     const AViewType& A) {                                    \
+      Kokkos::Profiling::pushRegion(                                          \
+          "KokkosLapack::potrf[TPL_CUSOLVER," #SCALAR "]");                   \
+      potrf_print_specialization<AViewType>();                                \
+      const int info = cusolverPotrfWrapper(space, uplo, A);                  \
+      Kokkos::Profiling::popRegion();                                         \
+      return info;                                                            \
+    }                                                                         \
+  };
+
+KOKKOSLAPACK_POTRF_CUSOLVER(float, Kokkos::LayoutLeft, Kokkos::CudaSpace)
+KOKKOSLAPACK_POTRF_CUSOLVER(double, Kokkos::LayoutLeft, Kokkos::CudaSpace)
+KOKKOSLAPACK_POTRF_CUSOLVER(Kokkos::complex<float>, Kokkos::LayoutLeft,
+                            Kokkos::CudaSpace)
+KOKKOSLAPACK_POTRF_CUSOLVER(Kokkos::complex<double>, Kokkos::LayoutLeft,
+                            Kokkos::CudaSpace)
+
+#if defined(KOKKOSKERNELS_INST_MEMSPACE_CUDAUVMSPACE)
+KOKKOSLAPACK_POTRF_CUSOLVER(float, Kokkos::LayoutLeft, Kokkos::CudaUVMSpace)
+KOKKOSLAPACK_POTRF_CUSOLVER(double, Kokkos::LayoutLeft, Kokkos::CudaUVMSpace)
+KOKKOSLAPACK_POTRF_CUSOLVER(Kokkos::complex<float>, Kokkos::LayoutLeft,
+                            Kokkos::CudaUVMSpace)
+KOKKOSLAPACK_POTRF_CUSOLVER(Kokkos::complex<double>, Kokkos::LayoutLeft,
+                            Kokkos::CudaUVMSpace)
+#endif
+
+}  // namespace Impl
+}  // namespace KokkosLapack
+#endif  // KOKKOSKERNELS_ENABLE_TPL_CUSOLVER
+
+#endif
@@ -0,0 +1,338 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSLAPACK_POTRS_TPL_SPEC_DECL_HPP_
+#define KOKKOSLAPACK_POTRS_TPL_SPEC_DECL_HPP_
+
+namespace KokkosLapack {
+namespace Impl {
+template <class AViewType, class BViewType>
+inline void potrs_print_specialization() {
+#ifdef KOKKOSKERNELS_ENABLE_CHECK_SPECIALIZATION
+#ifdef KOKKOSKERNELS_ENABLE_TPL_MAGMA
+  printf("KokkosLapack::potrs<> TPL MAGMA specialization for < %s , %s >\n",
+         typeid(AViewType).name(), typeid(BViewType).name());
+#else
+#ifdef KOKKOSKERNELS_ENABLE_TPL_LAPACK
+  printf("KokkosLapack::potrs<> TPL Lapack specialization for < %s , %s >\n",
+         typeid(AViewType).name(), typeid(BViewType).name());
+#endif
+#endif
+#endif
+}
+}  // namespace Impl
+}  // namespace KokkosLapack
+
+// Generic Host side LAPACK (could be MKL or whatever)
+#ifdef KOKKOSKERNELS_ENABLE_TPL_LAPACK
+#include <KokkosLapack_Host_tpl.hpp>
+
+namespace KokkosLapack {
+namespace Impl {
+
+template <class AViewType, class BViewType>
+void lapackPotrsWrapper(const char uplo[], const AViewType& A,
+                        const BViewType& B) {
+  using Scalar = typename AViewType::non_const_value_type;
+
+  const int N    = static_cast<int>(A.extent(1));
+  const int AST  = static_cast<int>(A.stride(1));
+  const int LDA  = (AST == 0) ? 1 : AST;
+  const int BST  = static_cast<int>(B.stride(1));
+  const int LDB  = (BST == 0) ? 1 : BST;
+  const int NRHS = static_cast<int>(B.extent(1));
+
+  if constexpr (Kokkos::ArithTraits<Scalar>::is_complex) {
+    using MagType = typename Kokkos::ArithTraits<Scalar>::mag_type;
+
+    HostLapack<std::complex<MagType>>::potrs(
+        uplo[0], N, NRHS, reinterpret_cast<std::complex<MagType>*>(A.data()),
+        LDA, reinterpret_cast<std::complex<MagType>*>(B.data()), LDB);
+  } else {
+    HostLapack<Scalar>::potrs(uplo[0], N, NRHS, A.data(), LDA, B.data(), LDB);
+  }
+}
+
+#define KOKKOSLAPACK_POTRS_LAPACK(SCALAR, LAYOUT, EXECSPACE, MEM_SPACE)        \
+  template <>                                                                  \
+  struct POTRS<                                                                \
+      EXECSPACE,                                                               \
+      Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<EXECSPACE, MEM_SPACE>,     \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,                   \
+      Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<EXECSPACE, MEM_SPACE>,     \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,                   \
+      true,                                                                    \
+      potrs_eti_spec_avail<                                                    \
+          EXECSPACE,                                                           \
+          Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<EXECSPACE, MEM_SPACE>, \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged>>,               \
+          Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<EXECSPACE, MEM_SPACE>, \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged>>>::value> {     \
+    using AViewType =                                                          \
+        Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<EXECSPACE, MEM_SPACE>,   \
+                     Kokkos::MemoryTraits<Kokkos::Unmanaged>>;                 \
+    using BViewType =                                                          \
+        Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<EXECSPACE, MEM_SPACE>,   \
+                     Kokkos::MemoryTraits<Kokkos::Unmanaged>>;                 \
+                                                                               \
+    static void potrs(const EXECSPACE& /* space */, const char uplo[],         \
+                      const AViewType& A, const BViewType& B) {                \
+      Kokkos::Profiling::pushRegion("KokkosLapack::potrs[TPL_LAPACK," #SCALAR  \
+                                    "]");                                      \
+      potrs_print_specialization<AViewType, BViewType>();                      \
+      lapackPotrsWrapper(uplo, A, B);                                          \
+      Kokkos::Profiling::popRegion();                                          \
+    }                                                                          \
+  };
+
+#if defined(KOKKOS_ENABLE_SERIAL)
+KOKKOSLAPACK_POTRS_LAPACK(float, Kokkos::LayoutLeft, Kokkos::Serial,
+                          Kokkos::HostSpace)
+KOKKOSLAPACK_POTRS_LAPACK(double, Kokkos::LayoutLeft, Kokkos::Serial,
+                          Kokkos::HostSpace)
+KOKKOSLAPACK_POTRS_LAPACK(Kokkos::complex<float>, Kokkos::LayoutLeft,
+                          Kokkos::Serial, Kokkos::HostSpace)
+KOKKOSLAPACK_POTRS_LAPACK(Kokkos::complex<double>, Kokkos::LayoutLeft,
+                          Kokkos::Serial, Kokkos::HostSpace)
+#endif
+
+#if defined(KOKKOS_ENABLE_OPENMP)
+KOKKOSLAPACK_POTRS_LAPACK(float, Kokkos::LayoutLeft, Kokkos::OpenMP,
+                          Kokkos::HostSpace)
+KOKKOSLAPACK_POTRS_LAPACK(double, Kokkos::LayoutLeft, Kokkos::OpenMP,
+                          Kokkos::HostSpace)
+KOKKOSLAPACK_POTRS_LAPACK(Kokkos::complex<float>, Kokkos::LayoutLeft,
+                          Kokkos::OpenMP, Kokkos::HostSpace)
+KOKKOSLAPACK_POTRS_LAPACK(Kokkos::complex<double>, Kokkos::LayoutLeft,
+                          Kokkos::OpenMP, Kokkos::HostSpace)
+#endif
+
+#if defined(KOKKOS_ENABLE_THREADS)
+KOKKOSLAPACK_POTRS_LAPACK(float, Kokkos::LayoutLeft, Kokkos::Threads,
+                          Kokkos::HostSpace)
+KOKKOSLAPACK_POTRS_LAPACK(double, Kokkos::LayoutLeft, Kokkos::Threads,
+                          Kokkos::HostSpace)
+KOKKOSLAPACK_POTRS_LAPACK(Kokkos::complex<float>, Kokkos::LayoutLeft,
+                          Kokkos::Threads, Kokkos::HostSpace)
+KOKKOSLAPACK_POTRS_LAPACK(Kokkos::complex<double>, Kokkos::LayoutLeft,
+                          Kokkos::Threads, Kokkos::HostSpace)
+#endif
+
+}  // namespace Impl
+}  // namespace KokkosLapack
+#endif  // KOKKOSKERNELS_ENABLE_TPL_LAPACK
+
+// MAGMA
+#ifdef KOKKOSKERNELS_ENABLE_TPL_MAGMA
+#include <KokkosLapack_magma.hpp>
+
+namespace KokkosLapack {
+namespace Impl {
+
+template <class ExecSpace, class AViewType, class BViewType>
+void magmaPotrsWrapper(const ExecSpace& space, const char uplo[],
+                       const AViewType& A, const BViewType& B) {
+  using scalar_type = typename AViewType::non_const_value_type;
+
+  const magma_uplo_t magma_uplo =
+      ((uplo[0] == 'L') || (uplo[0] == 'l')) ? MagmaLower : MagmaUpper;
+  magma_int_t N    = static_cast<magma_int_t>(A.extent(1));
+  magma_int_t AST  = static_cast<magma_int_t>(A.stride(1));
+  magma_int_t LDA  = (AST == 0) ? 1 : AST;
+  magma_int_t BST  = static_cast<magma_int_t>(B.stride(1));
+  magma_int_t LDB  = (BST == 0) ? 1 : BST;
+  magma_int_t NRHS = static_cast<magma_int_t>(B.extent(1));
+
+  KokkosLapack::Impl::MagmaSingleton& s =
+      KokkosLapack::Impl::MagmaSingleton::singleton();
+  (void)s;
+  magma_int_t info = 0;
+
+  space.fence();
+  if constexpr (std::is_same_v<scalar_type, float>) {
+    magma_spotrs_gpu(magma_uplo, N, NRHS,
+                     reinterpret_cast<magmaFloat_ptr>(A.data()), LDA,
+                     reinterpret_cast<magmaFloat_ptr>(B.data()), LDB, &info);
+  }
+  if constexpr (std::is_same_v<scalar_type, double>) {
+    magma_dpotrs_gpu(magma_uplo, N, NRHS,
+                     reinterpret_cast<magmaDouble_ptr>(A.data()), LDA,
+                     reinterpret_cast<magmaDouble_ptr>(B.data()), LDB, &info);
+  }
+  if constexpr (std::is_same_v<scalar_type, Kokkos::complex<float>>) {
+    magma_cpotrs_gpu(magma_uplo, N, NRHS,
+                     reinterpret_cast<magmaFloatComplex_ptr>(A.data()), LDA,
+                     reinterpret_cast<magmaFloatComplex_ptr>(B.data()), LDB,
+                     &info);
+  }
+  if constexpr (std::is_same_v<scalar_type, Kokkos::complex<double>>) {
+    magma_zpotrs_gpu(magma_uplo, N, NRHS,
+                     reinterpret_cast<magmaDoubleComplex_ptr>(A.data()), LDA,
+                     reinterpret_cast<magmaDoubleComplex_ptr>(B.data()), LDB,
+                     &info);
+  }
+  ExecSpace().fence();
+}
+
+#define KOKKOSLAPACK_POTRS_MAGMA(SCALAR, LAYOUT, MEM_SPACE)                   \
+  template <>                                                                 \
+  struct POTRS<                                                               \
+      Kokkos::Cuda,                                                           \
+      Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<Kokkos::Cuda, MEM_SPACE>, \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,                  \
+      Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<Kokkos::Cuda, MEM_SPACE>, \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,                  \
+      true,                                                                   \
+      potrs_eti_spec_avail<                                                   \
+          Kokkos::Cuda,                                                       \
+          Kokkos::View<SCALAR**, LAYOUT,                                      \
+                       Kokkos::Device<Kokkos::Cuda, MEM_SPACE>,               \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged>>,              \
+          Kokkos::View<SCALAR**, LAYOUT,                                      \
+                       Kokkos::Device<Kokkos::Cuda, MEM_SPACE>,               \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged>>>::value> {    \
+    using AViewType = Kokkos::View<SCALAR**, LAYOUT,                          \
+                                   Kokkos::Device<Kokkos::Cuda, MEM_SPACE>,   \
+                                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>;  \
+    using BViewType = Kokkos::View<SCALAR**, LAYOUT,                          \
+                                   Kokkos::Device<Kokkos::Cuda, MEM_SPACE>,   \
+                                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>;  \
+                                                                              \
+    static void potrs(const Kokkos::Cuda& space, const char uplo[],           \
+                      const AViewType& A, const BViewType& B) {               \
+      Kokkos::Profiling::pushRegion("KokkosLapack::potrs[TPL_MAGMA," #SCALAR  \
+                                    "]");                                     \
+      potrs_print_specialization<AViewType, BViewType>();                     \
+      magmaPotrsWrapper(space, uplo, A, B);                                   \
+      Kokkos::Profiling::popRegion();                                         \
+    }                                                                         \
+  };
+
+KOKKOSLAPACK_POTRS_MAGMA(float, Kokkos::LayoutLeft, Kokkos::CudaSpace)
+KOKKOSLAPACK_POTRS_MAGMA(double, Kokkos::LayoutLeft, Kokkos::CudaSpace)
+KOKKOSLAPACK_POTRS_MAGMA(Kokkos::complex<float>, Kokkos::LayoutLeft,
+                         Kokkos::CudaSpace)
+KOKKOSLAPACK_POTRS_MAGMA(Kokkos::complex<double>, Kokkos::LayoutLeft,
+                         Kokkos::CudaSpace)
+
+}  // namespace Impl
+}  // namespace KokkosLapack
+#endif  // KOKKOSKERNELS_ENABLE_TPL_MAGMA
+
+// CUSOLVER
+#if defined(KOKKOSKERNELS_ENABLE_TPL_CUSOLVER) && \
+    !defined(KOKKOSKERNELS_ENABLE_TPL_MAGMA)
+#include "KokkosLapack_cusolver.hpp"
+
+namespace KokkosLapack {
+namespace Impl {
+
+template <class ExecutionSpace, class AViewType, class BViewType>
+void cusolverPotrsWrapper(const ExecutionSpace& space, const char uplo[],
+                          const AViewType& A, const BViewType& B) {
+  using memory_space = typename AViewType::memory_space;
+  using Scalar       = typename BViewType::non_const_value_type;
+
+  const cublasFillMode_t fill = ((uplo[0] == 'L') || (uplo[0] == 'l'))
+                                    ? CUBLAS_FILL_MODE_LOWER
+                                    : CUBLAS_FILL_MODE_UPPER;
+  const int n    = A.extent_int(1);
+  const int lda  = A.stride(1);
+  const int nrhs = B.extent_int(1);
+  const int ldb  = B.stride(1);
+  Kokkos::View<int, memory_space> info("potrs info");
+
+  CudaLapackSingleton& s = CudaLapackSingleton::singleton();
+  KOKKOS_CUSOLVER_SAFE_CALL_IMPL(
+      cusolverDnSetStream(s.handle, space.cuda_stream()));
+  if constexpr (std::is_same_v<Scalar, float>) {
+    KOKKOS_CUSOLVER_SAFE_CALL_IMPL(
+        cusolverDnSpotrs(s.handle, fill, n, nrhs, A.data(), lda, B.data(), ldb,
+                         info.data()));
+  }
+  if constexpr (std::is_same_v<Scalar, double>) {
+    KOKKOS_CUSOLVER_SAFE_CALL_IMPL(
+        cusolverDnDpotrs(s.handle, fill, n, nrhs, A.data(), lda, B.data(), ldb,
+                         info.data()));
+  }
+  if constexpr (std::is_same_v<Scalar, Kokkos::complex<float>>) {
+    KOKKOS_CUSOLVER_SAFE_CALL_IMPL(cusolverDnCpotrs(
+        s.handle, fill, n, nrhs, reinterpret_cast<cuComplex*>(A.data()), lda,
+        reinterpret_cast<cuComplex*>(B.data()), ldb, info.data()));
+  }
+  if constexpr (std::is_same_v<Scalar, Kokkos::complex<double>>) {
+    KOKKOS_CUSOLVER_SAFE_CALL_IMPL(cusolverDnZpotrs(
+        s.handle, fill, n, nrhs, reinterpret_cast<cuDoubleComplex*>(A.data()),
+        lda, reinterpret_cast<cuDoubleComplex*>(B.data()), ldb, info.data()));
+  }
+  KOKKOS_CUSOLVER_SAFE_CALL_IMPL(cusolverDnSetStream(s.handle, NULL));
+}
+
+#define KOKKOSLAPACK_POTRS_CUSOLVER(SCALAR, LAYOUT, MEM_SPACE)                \
+  template <>                                                                 \
+  struct POTRS<                                                               \
+      Kokkos::Cuda,                                                           \
+      Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<Kokkos::Cuda, MEM_SPACE>, \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,                  \
+      Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<Kokkos::Cuda, MEM_SPACE>, \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,                  \
+      true,                                                                   \
+      potrs_eti_spec_avail<                                                   \
+          Kokkos::Cuda,                                                       \
+          Kokkos::View<SCALAR**, LAYOUT,                                      \
+                       Kokkos::Device<Kokkos::Cuda, MEM_SPACE>,               \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged>>,              \
+          Kokkos::View<SCALAR**, LAYOUT,                                      \
+                       Kokkos::Device<Kokkos::Cuda, MEM_SPACE>,               \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged>>>::value> {    \
+    using AViewType = Kokkos::View<SCALAR**, LAYOUT,                          \
+                                   Kokkos::Device<Kokkos::Cuda, MEM_SPACE>,   \
+                                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>;  \
+    using BViewType = Kokkos::View<SCALAR**, LAYOUT,                          \
+                                   Kokkos::Device<Kokkos::Cuda, MEM_SPACE>,   \
+                                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>;  \
+                                                                              \
+    static void potrs(const Kokkos::Cuda& space, const char uplo[],           \
+                      const AViewType& A, const BViewType& B) {               \
+      Kokkos::Profiling::pushRegion(                                          \
+          "KokkosLapack::potrs[TPL_CUSOLVER," #SCALAR "]");                   \
+      potrs_print_specialization<AViewType, BViewType>();                     \
+      cusolverPotrsWrapper(space, uplo, A, B);                                \
+      Kokkos::Profiling::popRegion();                                         \
+    }                                                                         \
+  };
+
+KOKKOSLAPACK_POTRS_CUSOLVER(float, Kokkos::LayoutLeft, Kokkos::CudaSpace)
+KOKKOSLAPACK_POTRS_CUSOLVER(double, Kokkos::LayoutLeft, Kokkos::CudaSpace)
+KOKKOSLAPACK_POTRS_CUSOLVER(Kokkos::complex<float>, Kokkos::LayoutLeft,
+                            Kokkos::CudaSpace)
+KOKKOSLAPACK_POTRS_CUSOLVER(Kokkos::complex<double>, Kokkos::LayoutLeft,
+                            Kokkos::CudaSpace)
+
+#if defined(KOKKOSKERNELS_INST_MEMSPACE_CUDAUVMSPACE)
+KOKKOSLAPACK_POTRS_CUSOLVER(float, Kokkos::LayoutLeft, Kokkos::CudaUVMSpace)
+KOKKOSLAPACK_POTRS_CUSOLVER(double, Kokkos::LayoutLeft, Kokkos::CudaUVMSpace)
+KOKKOSLAPACK_POTRS_CUSOLVER(Kokkos::complex<float>, Kokkos::LayoutLeft,
+                            Kokkos::CudaUVMSpace)
+KOKKOSLAPACK_POTRS_CUSOLVER(Kokkos::complex<double>, Kokkos::LayoutLeft,
+                            Kokkos::CudaUVMSpace)
+#endif
+
+}  // namespace Impl
+}  // namespace KokkosLapack
+#endif  // KOKKOSKERNELS_ENABLE_TPL_CUSOLVER
+
+#endif
@@ -0,0 +1,97 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSLAPACK_SVD_BATCHED_TPL_SPEC_AVAIL_HPP_
+#define KOKKOSLAPACK_SVD_BATCHED_TPL_SPEC_AVAIL_HPP_
+
+namespace KokkosLapack {
+namespace Impl {
+// Specialization struct which defines whether a specialization exists
+template <class ExecutionSpace, class AMatrix, class SVector, class UMatrix,
+          class VMatrix>
+struct svd_batched_tpl_spec_avail {
+  enum : bool { value = false };
+};
+
+// The batched solvers take column-major matrices stored one after the
+// other, which is the storage of the transposes in a LayoutRight batch.
+
+// CUSOLVER
+#ifdef KOKKOSKERNELS_ENABLE_TPL_CUSOLVER
+#define KOKKOSLAPACK_SVD_BATCHED_TPL_SPEC_AVAIL_CUSOLVER(SCALAR, MEMSPACE) \
+  template <>                                                              \
+  struct svd_batched_tpl_spec_avail<                                       \
+      Kokkos::Cuda,                                                        \
+      Kokkos::View<SCALAR***, Kokkos::LayoutRight,                         \
+                   Kokkos::Device<Kokkos::Cuda, MEMSPACE>,                 \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,               \
+      Kokkos::View<SCALAR**, Kokkos::LayoutRight,                          \
+                   Kokkos::Device<Kokkos::Cuda, MEMSPACE>,                 \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,               \
+      Kokkos::View<SCALAR***, Kokkos::LayoutRight,                         \
+                   Kokkos::Device<Kokkos::Cuda, MEMSPACE>,                 \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,               \
+      Kokkos::View<SCALAR***, Kokkos::LayoutRight,                         \
+                   Kokkos::Device<Kokkos::Cuda, MEMSPACE>,                 \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>> {             \
+    enum : bool { value = true };                                          \
+  };
+
+KOKKOSLAPACK_SVD_BATCHED_TPL_SPEC_AVAIL_CUSOLVER(float, Kokkos::CudaSpace)
+KOKKOSLAPACK_SVD_BATCHED_TPL_SPEC_AVAIL_CUSOLVER(double, Kokkos::CudaSpace)
+
+#if defined(KOKKOSKERNELS_INST_MEMSPACE_CUDAUVMSPACE)
+KOKKOSLAPACK_SVD_BATCHED_TPL_SPEC_AVAIL_CUSOLVER(float, Kokkos::CudaUVMSpace)
+KOKKOSLAPACK_SVD_BATCHED_TPL_SPEC_AVAIL_CUSOLVER(double, Kokkos::CudaUVMSpace)
+#endif  // CUDAUVMSPACE
+#endif  // CUSOLVER
+
+// ROCSOLVER
+#ifdef KOKKOSKERNELS_ENABLE_TPL_ROCSOLVER
+#define KOKKOSLAPACK_SVD_BATCHED_TPL_SPEC_AVAIL_ROCSOLVER(SCALAR, MEMSPACE) \
+  template <>                                                               \
+  struct svd_batched_tpl_spec_avail<                                        \
+      Kokkos::HIP,                                                          \
+      Kokkos::View<SCALAR***, Kokkos::LayoutRight,                          \
+                   Kokkos::Device<Kokkos::HIP, MEMSPACE>,                   \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,                \
+      Kokkos::View<SCALAR**, Kokkos::LayoutRight,                           \
+                   Kokkos::Device<Kokkos::HIP, MEMSPACE>,                   \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,                \
+      Kokkos::View<SCALAR***, Kokkos::LayoutRight,                          \
+                   Kokkos::Device<Kokkos::HIP, MEMSPACE>,                   \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,                \
+      Kokkos::View<SCALAR***, Kokkos::LayoutRight,                          \
+                   Kokkos::Device<Kokkos::HIP, MEMSPACE>,                   \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>> {              \
+    enum : bool { value = true };                                           \
+  };
+
+KOKKOSLAPACK_SVD_BATCHED_TPL_SPEC_AVAIL_ROCSOLVER(float, Kokkos::HIPSpace)
+KOKKOSLAPACK_SVD_BATCHED_TPL_SPEC_AVAIL_ROCSOLVER(double, Kokkos::HIPSpace)
+
+#if defined(KOKKOSKERNELS_INST_MEMSPACE_HIPMANAGEDSPACE)
+KOKKOSLAPACK_SVD_BATCHED_TPL_SPEC_AVAIL_ROCSOLVER(float,
+                                                  Kokkos::HIPManagedSpace)
+KOKKOSLAPACK_SVD_BATCHED_TPL_SPEC_AVAIL_ROCSOLVER(double,
+                                                  Kokkos::HIPManagedSpace)
+#endif  // HIPMANAGEDSPACE
+#endif  // ROCSOLVER
+
+}  // namespace Impl
+}  // namespace KokkosLapack
+
+#endif  // KOKKOSLAPACK_SVD_BATCHED_TPL_SPEC_AVAIL_HPP_
@@ -0,0 +1,221 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSLAPACK_SVD_BATCHED_TPL_SPEC_DECL_HPP_
+#define KOKKOSLAPACK_SVD_BATCHED_TPL_SPEC_DECL_HPP_
+
+#include <sstream>
+
+#include "KokkosKernels_Error.hpp"
+
+namespace KokkosLapack {
+namespace Impl {
+// Throw if the solver did not converge for some matrices of the batch
+template <class ExecutionSpace, class InfoVector>
+void svd_batched_check_info(const ExecutionSpace& space,
+                            const InfoVector& info, const char tpl_name[]) {
+  int num_failed = 0;
+  Kokkos::parallel_reduce(
+      "KokkosLapack::svd[batched info]",
+      Kokkos::RangePolicy<ExecutionSpace>(space, 0, info.extent(0)),
+      KOKKOS_LAMBDA(const int b, int& update) { update += (info(b) != 0); },
+      num_failed);
+  if (num_failed != 0) {
+    std::ostringstream os;
+    os << "KokkosLapack::svd: " << tpl_name << " failed for " << num_failed
+       << " of the " << info.extent(0) << " matrices of the batch.\n";
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+}
+}  // namespace Impl
+}  // namespace KokkosLapack
+
+// Both solvers read the column-major matrices At(b) which a LayoutRight batch
+// stores contiguously, and At(b) = V(b) * S(b) * U(b)^T. The left singular
+// vectors of At(b) in column-major are the rows of Vt(b) in row-major.
+
+// CUSOLVER
+#ifdef KOKKOSKERNELS_ENABLE_TPL_CUSOLVER
+#include "KokkosLapack_cusolver.hpp"
+
+namespace KokkosLapack {
+namespace Impl {
+
+template <class AMatrix, class SVector, class UMatrix, class VMatrix>
+void cusolverSvdBatchedWrapper(const Kokkos::Cuda& space, const char jobu[],
+                               const AMatrix& A, const SVector& S,
+                               const UMatrix& U, const VMatrix& Vt) {
+  using memory_space = typename AMatrix::memory_space;
+  using Scalar       = typename AMatrix::non_const_value_type;
+
+  const int batch = A.extent_int(0);
+  const int m     = A.extent_int(1);
+  const int n     = A.extent_int(2);
+
+  const bool vectors = (jobu[0] == 'A') || (jobu[0] == 'a');
+  const cusolverEigMode_t jobz =
+      vectors ? CUSOLVER_EIG_MODE_VECTOR : CUSOLVER_EIG_MODE_NOVECTOR;
+
+  // gesvdj returns the right singular vectors of At(b) not transposed, which
+  // are U(b) in column-major, they are transposed into U after the solve.
+  Kokkos::View<Scalar***, Kokkos::LayoutRight, memory_space> Ucm(
+      Kokkos::view_alloc(space, Kokkos::WithoutInitializing, "svd batched U"),
+      vectors ? batch : 0, m, m);
+  Kokkos::View<int*, memory_space> info("svd batched info", batch);
+
+  int lwork = 0;
+  gesvdjInfo_t params;
+  KOKKOS_CUSOLVER_SAFE_CALL_IMPL(cusolverDnCreateGesvdjInfo(&params));
+  KOKKOS_CUSOLVER_SAFE_CALL_IMPL(cusolverDnXgesvdjSetSortEig(params, 1));
+
+  CudaLapackSingleton& s = CudaLapackSingleton::singleton();
+  KOKKOS_CUSOLVER_SAFE_CALL_IMPL(
+      cusolverDnSetStream(s.handle, space.cuda_stream()));
+  if constexpr (std::is_same_v<Scalar, float>) {
+    KOKKOS_CUSOLVER_SAFE_CALL_IMPL(cusolverDnSgesvdjBatched_bufferSize(
+        s.handle, jobz, n, m, A.data(), n, S.data(), Vt.data(), n, Ucm.data(),
+        m, &lwork, params, batch));
+    Kokkos::View<Scalar*, memory_space> work("svd work buffer", lwork);
+
+    KOKKOS_CUSOLVER_SAFE_CALL_IMPL(cusolverDnSgesvdjBatched(
+        s.handle, jobz, n, m, A.data(), n, S.data(), Vt.data(), n, Ucm.data(),
+        m, work.data(), lwork, info.data(), params, batch));
+  }
+  if constexpr (std::is_same_v<Scalar, double>) {
+    KOKKOS_CUSOLVER_SAFE_CALL_IMPL(cusolverDnDgesvdjBatched_bufferSize(
+        s.handle, jobz, n, m, A.data(), n, S.data(), Vt.data(), n, Ucm.data(),
+        m, &lwork, params, batch));
+    Kokkos::View<Scalar*, memory_space> work("svd work buffer", lwork);
+
+    KOKKOS_CUSOLVER_SAFE_CALL_IMPL(cusolverDnDgesvdjBatched(
+        s.handle, jobz, n, m, A.data(), n, S.data(), Vt.data(), n, Ucm.data(),
+        m, work.data(), lwork, info.data(), params, batch));
+  }
+  KOKKOS_CUSOLVER_SAFE_CALL_IMPL(cusolverDnSetStream(s.handle, NULL));
+  KOKKOS_CUSOLVER_SAFE_CALL_IMPL(cusolverDnDestroyGesvdjInfo(params));
+
+  if (vectors) {
+    Kokkos::parallel_for(
+        "KokkosLapack::svd[batched transpose U]",
+        Kokkos::MDRangePolicy<Kokkos::Cuda, Kokkos::Rank<3>>(
+            space, {0, 0, 0}, {batch, m, m}),
+        KOKKOS_LAMBDA(const int b, const int i, const int j) {
+          U(b, i, j) = Ucm(b, j, i);
+        });
+  }
+  svd_batched_check_info(space, info, "cuSOLVER gesvdjBatched");
+}
+
+// gesvdjBatched is limited to matrices of at most 32 rows and columns, larger
+// batches go to the native implementation.
+template <class AMatrix, class SVector, class UMatrix, class VMatrix>
+struct SVD_BATCHED<Kokkos::Cuda, AMatrix, SVector, UMatrix, VMatrix, true> {
+  static void svd(const Kokkos::Cuda& space, const char jobu[],
+                  const char /* jobvt */[], const AMatrix& A,
+                  const SVector& S, const UMatrix& U, const VMatrix& Vt) {
+    const bool use_tpl = (A.extent(1) <= 32) && (A.extent(2) <= 32) &&
+                         A.span_is_contiguous() && S.span_is_contiguous() &&
+                         U.span_is_contiguous() && Vt.span_is_contiguous();
+    if (use_tpl) {
+      Kokkos::Profiling::pushRegion("KokkosLapack::svd[batched,TPL_CUSOLVER]");
+      cusolverSvdBatchedWrapper(space, jobu, A, S, U, Vt);
+    } else {
+      Kokkos::Profiling::pushRegion("KokkosLapack::svd[batched,native]");
+      svd_batched_native(space, jobu, A, S, U, Vt);
+    }
+    Kokkos::Profiling::popRegion();
+  }
+};
+
+}  // namespace Impl
+}  // namespace KokkosLapack
+#endif  // KOKKOSKERNELS_ENABLE_TPL_CUSOLVER
+
+// ROCSOLVER
+#ifdef KOKKOSKERNELS_ENABLE_TPL_ROCSOLVER
+#include <KokkosBlas_tpl_spec.hpp>
+#include <rocsolver/rocsolver.h>
+
+namespace KokkosLapack {
+namespace Impl {
+
+template <class AMatrix, class SVector, class UMatrix, class VMatrix>
+void rocsolverSvdBatchedWrapper(const Kokkos::HIP& space, const char jobu[],
+                                const AMatrix& A, const SVector& S,
+                                const UMatrix& U, const VMatrix& Vt) {
+  using memory_space = typename AMatrix::memory_space;
+  using Scalar       = typename AMatrix::non_const_value_type;
+  using Magnitude    = typename SVector::non_const_value_type;
+
+  const rocblas_int batch = A.extent_int(0);
+  const rocblas_int m     = A.extent_int(1);
+  const rocblas_int n     = A.extent_int(2);
+  const rocblas_int r     = Kokkos::min(m, n);
+
+  const bool vectors = (jobu[0] == 'A') || (jobu[0] == 'a');
+  const rocblas_svect VecMode =
+      vectors ? rocblas_svect_all : rocblas_svect_none;
+
+  // gesvd returns the transposed right singular vectors of At(b), which are
+  // U(b) in row-major, so both outputs are written in place.
+  Kokkos::View<rocblas_int*, memory_space> info("svd batched info", batch);
+  Kokkos::View<Magnitude*, memory_space> E("svd batched E", batch * r);
+
+  KokkosBlas::Impl::RocBlasSingleton& s =
+      KokkosBlas::Impl::RocBlasSingleton::singleton();
+  KOKKOS_ROCBLAS_SAFE_CALL_IMPL(
+      rocblas_set_stream(s.handle, space.hip_stream()));
+  if constexpr (std::is_same_v<Scalar, float>) {
+    KOKKOS_ROCBLAS_SAFE_CALL_IMPL(rocsolver_sgesvd_strided_batched(
+        s.handle, VecMode, VecMode, n, m, A.data(), n, m * n, S.data(), r,
+        Vt.data(), n, n * n, U.data(), m, m * m, E.data(), r,
+        rocblas_outofplace, info.data(), batch));
+  }
+  if constexpr (std::is_same_v<Scalar, double>) {
+    KOKKOS_ROCBLAS_SAFE_CALL_IMPL(rocsolver_dgesvd_strided_batched(
+        s.handle, VecMode, VecMode, n, m, A.data(), n, m * n, S.data(), r,
+        Vt.data(), n, n * n, U.data(), m, m * m, E.data(), r,
+        rocblas_outofplace, info.data(), batch));
+  }
+  KOKKOS_ROCBLAS_SAFE_CALL_IMPL(rocblas_set_stream(s.handle, NULL));
+
+  svd_batched_check_info(space, info, "rocSOLVER gesvd_strided_batched");
+}
+
+template <class AMatrix, class SVector, class UMatrix, class VMatrix>
+struct SVD_BATCHED<Kokkos::HIP, AMatrix, SVector, UMatrix, VMatrix, true> {
+  static void svd(const Kokkos::HIP& space, const char jobu[],
+                  const char /* jobvt */[], const AMatrix& A,
+                  const SVector& S, const UMatrix& U, const VMatrix& Vt) {
+    const bool use_tpl = A.span_is_contiguous() && S.span_is_contiguous() &&
+                         U.span_is_contiguous() && Vt.span_is_contiguous();
+    if (use_tpl) {
+      Kokkos::Profiling::pushRegion(
+          "KokkosLapack::svd[batched,TPL_ROCSOLVER]");
+      rocsolverSvdBatchedWrapper(space, jobu, A, S, U, Vt);
+    } else {
+      Kokkos::Profiling::pushRegion("KokkosLapack::svd[batched,native]");
+      svd_batched_native(space, jobu, A, S, U, Vt);
+    }
+    Kokkos::Profiling::popRegion();
+  }
+};
+
+}  // namespace Impl
+}  // namespace KokkosLapack
+#endif  // KOKKOSKERNELS_ENABLE_TPL_ROCSOLVER
+
+#endif  // KOKKOSLAPACK_SVD_BATCHED_TPL_SPEC_DECL_HPP_
@@ -0,0 +1,542 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSLAPACK_SYEV_TPL_SPEC_DECL_HPP_
+#define KOKKOSLAPACK_SYEV_TPL_SPEC_DECL_HPP_
+
+#include "KokkosKernels_Error.hpp"
+#include "Kokkos_ArithTraits.hpp"
+
+namespace KokkosLapack {
+namespace Impl {
+template <class ExecutionSpace, class AMatrix, class WVector>
+inline void syev_print_specialization() {
+#ifdef KOKKOSKERNELS_ENABLE_CHECK_SPECIALIZATION
+#ifdef KOKKOSKERNELS_ENABLE_TPL_CUSOLVER
+  if constexpr (std::is_same_v<ExecutionSpace, Kokkos::Cuda>) {
+    printf("KokkosLapack::syev<> TPL Cusolver specialization for < %s , %s >\n",
+           typeid(AMatrix).name(), typeid(WVector).name());
+  }
+#endif
+#endif
+}
+
+inline void syev_check_info(const int info, const char tpl_name[]) {
+  if (info != 0) {
+    std::ostringstream os;
+    os << "KokkosLapack::syev: " << tpl_name << " failed with info = " << info
+       << (info > 0 ? ", the algorithm failed to converge.\n"
+                    : ", an argument had an illegal value.\n");
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+}
+}  // namespace Impl
+}  // namespace KokkosLapack
+
+// LAPACK
+#if defined(KOKKOSKERNELS_ENABLE_TPL_LAPACK) && \
+    !defined(KOKKOSKERNELS_ENABLE_TPL_MKL)
+#include "KokkosLapack_Host_tpl.hpp"
+
+namespace KokkosLapack {
+namespace Impl {
+
+template <class ExecutionSpace, class AMatrix, class WVector>
+void lapackSyevWrapper(const ExecutionSpace& /* space */, const char jobz[],
+                       const char uplo[], const AMatrix& A, const WVector& W) {
+  using memory_space = typename AMatrix::memory_space;
+  using Scalar       = typename AMatrix::non_const_value_type;
+  using Magnitude    = typename WVector::non_const_value_type;
+  using ALayout_t    = typename AMatrix::array_layout;
+  using HostScalar =
+      std::conditional_t<Kokkos::ArithTraits<Scalar>::is_complex,
+                         std::complex<Magnitude>, Scalar>;
+
+  static_assert(std::is_same_v<ALayout_t, Kokkos::LayoutLeft>,
+                "KokkosLapack - syev: A needs to have a Kokkos::LayoutLeft");
+
+  const int n   = A.extent_int(0);
+  const int lda = A.stride(1);
+
+  // Workspace query, the divide and conquer algorithm needs three buffers
+  Scalar work_query     = 0;
+  Magnitude rwork_query = 0;
+  int iwork_query       = 0;
+
+  int info = HostLapack<HostScalar>::syevd(
+      jobz[0], uplo[0], n, reinterpret_cast<HostScalar*>(A.data()), lda,
+      W.data(), reinterpret_cast<HostScalar*>(&work_query), -1, &rwork_query,
+      -1, &iwork_query, -1);
+  syev_check_info(info, "LAPACK");
+
+  const int lwork =
+      static_cast<int>(Kokkos::ArithTraits<Scalar>::real(work_query));
+  const int lrwork = static_cast<int>(rwork_query);
+  const int liwork = iwork_query;
+  Kokkos::View<Scalar*, memory_space> work("syev work buffer", lwork);
+  Kokkos::View<Magnitude*, memory_space> rwork("syev rwork buffer", lrwork);
+  Kokkos::View<int*, memory_space> iwork("syev iwork buffer", liwork);
+
+  info = HostLapack<HostScalar>::syevd(
+      jobz[0], uplo[0], n, reinterpret_cast<HostScalar*>(A.data()), lda,
+      W.data(), reinterpret_cast<HostScalar*>(work.data()), lwork, rwork.data(),
+      lrwork, iwork.data(), liwork);
+  syev_check_info(info, "LAPACK");
+}
+
+#define KOKKOSLAPACK_SYEV_LAPACK(SCALAR, LAYOUT, EXEC_SPACE)                  \
+  template <>                                                                 \
+  struct SYEV<                                                                \
+      EXEC_SPACE,                                                             \
+      Kokkos::View<SCALAR**, LAYOUT,                                          \
+                   Kokkos::Device<EXEC_SPACE, Kokkos::HostSpace>,             \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,                  \
+      Kokkos::View<Kokkos::ArithTraits<SCALAR>::mag_type*, LAYOUT,            \
+                   Kokkos::Device<EXEC_SPACE, Kokkos::HostSpace>,             \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,                  \
+      true,                                                                   \
+      syev_eti_spec_avail<                                                    \
+          EXEC_SPACE,                                                         \
+          Kokkos::View<SCALAR**, LAYOUT,                                      \
+                       Kokkos::Device<EXEC_SPACE, Kokkos::HostSpace>,         \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged>>,              \
+          Kokkos::View<Kokkos::ArithTraits<SCALAR>::mag_type*, LAYOUT,        \
+                       Kokkos::Device<EXEC_SPACE, Kokkos::HostSpace>,         \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged>>>::value> {    \
+    using AMatrix =                                                           \
+        Kokkos::View<SCALAR**, LAYOUT,                                        \
+                     Kokkos::Device<EXEC_SPACE, Kokkos::HostSpace>,           \
+                     Kokkos::MemoryTraits<Kokkos::Unmanaged>>;                \
+    using WVector =                                                           \
+        Kokkos::View<Kokkos::ArithTraits<SCALAR>::mag_type*, LAYOUT,          \
+                     Kokkos::Device<EXEC_SPACE, Kokkos::HostSpace>,           \
+                     Kokkos::MemoryTraits<Kokkos::Unmanaged>>;                \
+                                                                              \
+    static void syev(const EXEC_SPACE& space, const char jobz[],              \
+                     const char uplo[], const AMatrix& A, const WVector& W) { \
+      Kokkos::Profiling::pushRegion("KokkosLapack::syev[TPL_LAPACK," #SCALAR  \
+                                    "]");                                     \
+      syev_print_specialization<EXEC_SPACE, AMatrix, WVector>();              \
+                                                                              \
+      lapackSyevWrapper(space, jobz, uplo, A, W);                             \
+      Kokkos::Profiling::popRegion();                                         \
+    }                                                                         \
+  };
+
+#if defined(KOKKOS_ENABLE_SERIAL)
+KOKKOSLAPACK_SYEV_LAPACK(float, Kokkos::LayoutLeft, Kokkos::Serial)
+KOKKOSLAPACK_SYEV_LAPACK(double, Kokkos::LayoutLeft, Kokkos::Serial)
+KOKKOSLAPACK_SYEV_LAPACK(Kokkos::complex<float>, Kokkos::LayoutLeft,
+                         Kokkos::Serial)
+KOKKOSLAPACK_SYEV_LAPACK(Kokkos::complex<double>, Kokkos::LayoutLeft,
+                         Kokkos::Serial)
+#endif
+
+#if defined(KOKKOS_ENABLE_OPENMP)
+KOKKOSLAPACK_SYEV_LAPACK(float, Kokkos::LayoutLeft, Kokkos::OpenMP)
+KOKKOSLAPACK_SYEV_LAPACK(double, Kokkos::LayoutLeft, Kokkos::OpenMP)
+KOKKOSLAPACK_SYEV_LAPACK(Kokkos::complex<float>, Kokkos::LayoutLeft,
+                         Kokkos::OpenMP)
+KOKKOSLAPACK_SYEV_LAPACK(Kokkos::complex<double>, Kokkos::LayoutLeft,
+                         Kokkos::OpenMP)
+#endif
+
+#if defined(KOKKOS_ENABLE_THREADS)
+KOKKOSLAPACK_SYEV_LAPACK(float, Kokkos::LayoutLeft, Kokkos::Threads)
+KOKKOSLAPACK_SYEV_LAPACK(double, Kokkos::LayoutLeft, Kokkos::Threads)
+KOKKOSLAPACK_SYEV_LAPACK(Kokkos::complex<float>, Kokkos::LayoutLeft,
+                         Kokkos::Threads)
+KOKKOSLAPACK_SYEV_LAPACK(Kokkos::complex<double>, Kokkos::LayoutLeft,
+                         Kokkos::Threads)
+#endif
+
+}  // namespace Impl
+}  // namespace KokkosLapack
+#endif  // KOKKOSKERNELS_ENABLE_TPL_LAPACK
+
+#ifdef KOKKOSKERNELS_ENABLE_TPL_MKL
+#include "mkl.h"
+
+namespace KokkosLapack {
+namespace Impl {
+
+template <class ExecutionSpace, class AMatrix, class WVector>
+void mklSyevWrapper(const ExecutionSpace& /* space */, const char jobz[],
+                    const char uplo[], const AMatrix& A, const WVector& W) {
+  using Scalar    = typename AMatrix::non_const_value_type;
+  using ALayout_t = typename AMatrix::array_layout;
+
+  static_assert(std::is_same_v<ALayout_t, Kokkos::LayoutLeft>,
+                "KokkosLapack - syev: A needs to have a Kokkos::LayoutLeft");
+
+  const lapack_int n   = A.extent_int(0);
+  const lapack_int lda = A.stride(1);
+
+  lapack_int ret = 0;
+  if constexpr (std::is_same_v<Scalar, float>) {
+    ret = LAPACKE_ssyevd(LAPACK_COL_MAJOR, jobz[0], uplo[0], n, A.data(), lda,
+                         W.data());
+  }
+  if constexpr (std::is_same_v<Scalar, double>) {
+    ret = LAPACKE_dsyevd(LAPACK_COL_MAJOR, jobz[0], uplo[0], n, A.data(), lda,
+                         W.data());
+  }
+  if constexpr (std::is_same_v<Scalar, Kokkos::complex<float>>) {
+    ret = LAPACKE_cheevd(LAPACK_COL_MAJOR, jobz[0], uplo[0], n,
+                         reinterpret_cast<lapack_complex_float*>(A.data()),
+                         lda, W.data());
+  }
+  if constexpr (std::is_same_v<Scalar, Kokkos::complex<double>>) {
+    ret = LAPACKE_zheevd(LAPACK_COL_MAJOR, jobz[0], uplo[0], n,
+                         reinterpret_cast<lapack_complex_double*>(A.data()),
+                         lda, W.data());
+  }
+  syev_check_info(ret, "MKL");
+}
+
+#define KOKKOSLAPACK_SYEV_MKL(SCALAR, LAYOUT, EXEC_SPACE)                     \
+  template <>                                                                 \
+  struct SYEV<                                                                \
+      EXEC_SPACE,                                                             \
+      Kokkos::View<SCALAR**, LAYOUT,                                          \
+                   Kokkos::Device<EXEC_SPACE, Kokkos::HostSpace>,             \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,                  \
+      Kokkos::View<Kokkos::ArithTraits<SCALAR>::mag_type*, LAYOUT,            \
+                   Kokkos::Device<EXEC_SPACE, Kokkos::HostSpace>,             \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,                  \
+      true,                                                                   \
+      syev_eti_spec_avail<                                                    \
+          EXEC_SPACE,                                                         \
+          Kokkos::View<SCALAR**, LAYOUT,                                      \
+                       Kokkos::Device<EXEC_SPACE, Kokkos::HostSpace>,         \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged>>,              \
+          Kokkos::View<Kokkos::ArithTraits<SCALAR>::mag_type*, LAYOUT,        \
+                       Kokkos::Device<EXEC_SPACE, Kokkos::HostSpace>,         \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged>>>::value> {    \
+    using AMatrix =                                                           \
+        Kokkos::View<SCALAR**, LAYOUT,                                        \
+                     Kokkos::Device<EXEC_SPACE, Kokkos::HostSpace>,           \
+                     Kokkos::MemoryTraits<Kokkos::Unmanaged>>;                \
+    using WVector =                                                           \
+        Kokkos::View<Kokkos::ArithTraits<SCALAR>::mag_type*, LAYOUT,          \
+                     Kokkos::Device<EXEC_SPACE, Kokkos::HostSpace>,           \
+                     Kokkos::MemoryTraits<Kokkos::Unmanaged>>;                \
+                                                                              \
+    static void syev(const EXEC_SPACE& space, const char jobz[],              \
+                     const char uplo[], const AMatrix& A, const WVector& W) { \
+      Kokkos::Profiling::pushRegion("KokkosLapack::syev[TPL_LAPACK," #SCALAR  \
+                                    "]");                                     \
+      syev_print_specialization<EXEC_SPACE, AMatrix, WVector>();              \
+                                                                              \
+      mklSyevWrapper(space, jobz, uplo, A, W);                                \
+      Kokkos::Profiling::popRegion();                                         \
+    }                                                                         \
+  };
+
+#if defined(KOKKOS_ENABLE_SERIAL)
+KOKKOSLAPACK_SYEV_MKL(float, Kokkos::LayoutLeft, Kokkos::Serial)
+KOKKOSLAPACK_SYEV_MKL(double, Kokkos::LayoutLeft, Kokkos::Serial)
+KOKKOSLAPACK_SYEV_MKL(Kokkos::complex<float>, Kokkos::LayoutLeft,
+                      Kokkos::Serial)
+KOKKOSLAPACK_SYEV_MKL(Kokkos::complex<double>, Kokkos::LayoutLeft,
+                      Kokkos::Serial)
+#endif
+
+#if defined(KOKKOS_ENABLE_OPENMP)
+KOKKOSLAPACK_SYEV_MKL(float, Kokkos::LayoutLeft, Kokkos::OpenMP)
+KOKKOSLAPACK_SYEV_MKL(double, Kokkos::LayoutLeft, Kokkos::OpenMP)
+KOKKOSLAPACK_SYEV_MKL(Kokkos::complex<float>, Kokkos::LayoutLeft,
+                      Kokkos::OpenMP)
+KOKKOSLAPACK_SYEV_MKL(Kokkos::complex<double>, Kokkos::LayoutLeft,
+                      Kokkos::OpenMP)
+#endif
+
+#if defined(KOKKOS_ENABLE_THREADS)
+KOKKOSLAPACK_SYEV_MKL(float, Kokkos::LayoutLeft, Kokkos::Threads)
+KOKKOSLAPACK_SYEV_MKL(double, Kokkos::LayoutLeft, Kokkos::Threads)
+KOKKOSLAPACK_SYEV_MKL(Kokkos::complex<float>, Kokkos::LayoutLeft,
+                      Kokkos::Threads)
+KOKKOSLAPACK_SYEV_MKL(Kokkos::complex<double>, Kokkos::LayoutLeft,
+                      Kokkos::Threads)
+#endif
+
+}  // namespace Impl
+}  // namespace KokkosLapack
+#endif  // KOKKOSKERNELS_ENABLE_TPL_MKL
+
+// CUSOLVER
+#ifdef KOKKOSKERNELS_ENABLE_TPL_CUSOLVER
+#include "KokkosLapack_cusolver.hpp"
+
+namespace KokkosLapack {
+namespace Impl {
+
+template <class ExecutionSpace, class AMatrix, class WVector>
+void cusolverSyevWrapper(const ExecutionSpace& space, const char jobz[],
+                         const char uplo[], const AMatrix& A,
+                         const WVector& W) {
+  using memory_space = typename AMatrix::memory_space;
+  using Scalar       = typename AMatrix::non_const_value_type;
+  using ALayout_t    = typename AMatrix::array_layout;
+
+  static_assert(std::is_same_v<ALayout_t, Kokkos::LayoutLeft>,
+                "KokkosLapack - syev: A needs to have a Kokkos::LayoutLeft");
+
+  const int n   = A.extent_int(0);
+  const int lda = A.stride(1);
+
+  const cusolverEigMode_t eigMode = ((jobz[0] == 'V') || (jobz[0] == 'v'))
+                                        ? CUSOLVER_EIG_MODE_VECTOR
+                                        : CUSOLVER_EIG_MODE_NOVECTOR;
+  const cublasFillMode_t fillMode = ((uplo[0] == 'L') || (uplo[0] == 'l'))
+                                        ? CUBLAS_FILL_MODE_LOWER
+                                        : CUBLAS_FILL_MODE_UPPER;
+
+  int lwork = 0;
+  Kokkos::View<int, memory_space> info("syev info");
+
+  CudaLapackSingleton& s = CudaLapackSingleton::singleton();
+  KOKKOS_CUSOLVER_SAFE_CALL_IMPL(
+      cusolverDnSetStream(s.handle, space.cuda_stream()));
+  if constexpr (std::is_same_v<Scalar, float>) {
+    KOKKOS_CUSOLVER_SAFE_CALL_IMPL(cusolverDnSsyevd_bufferSize(
+        s.handle, eigMode, fillMode, n, A.data(), lda, W.data(), &lwork));
+    Kokkos::View<Scalar*, memory_space> work("syev work buffer", lwork);
+
+    KOKKOS_CUSOLVER_SAFE_CALL_IMPL(
+        cusolverDnSsyevd(s.handle, eigMode, fillMode, n, A.data(), lda,
+                         W.data(), work.data(), lwork, info.data()));
+  }
+  if constexpr (std::is_same_v<Scalar, double>) {
+    KOKKOS_CUSOLVER_SAFE_CALL_IMPL(cusolverDnDsyevd_bufferSize(
+        s.handle, eigMode, fillMode, n, A.data(), lda, W.data(), &lwork));
+    Kokkos::View<Scalar*, memory_space> work("syev work buffer", lwork);
+
+    KOKKOS_CUSOLVER_SAFE_CALL_IMPL(
+        cusolverDnDsyevd(s.handle, eigMode, fillMode, n, A.data(), lda,
+                         W.data(), work.data(), lwork, info.data()));
+  }
+  if constexpr (std::is_same_v<Scalar, Kokkos::complex<float>>) {
+    KOKKOS_CUSOLVER_SAFE_CALL_IMPL(cusolverDnCheevd_bufferSize(
+        s.handle, eigMode, fillMode, n, reinterpret_cast<cuComplex*>(A.data()),
+        lda, W.data(), &lwork));
+    Kokkos::View<Scalar*, memory_space> work("syev work buffer", lwork);
+
+    KOKKOS_CUSOLVER_SAFE_CALL_IMPL(cusolverDnCheevd(
+        s.handle, eigMode, fillMode, n, reinterpret_cast<cuComplex*>(A.data()),
+        lda, W.data(), reinterpret_cast<cuComplex*>(work.data()), lwork,
+        info.data()));
+  }
+  if constexpr (std::is_same_v<Scalar, Kokkos::complex<double>>) {
+    KOKKOS_CUSOLVER_SAFE_CALL_IMPL(cusolverDnZheevd_bufferSize(
+        s.handle, eigMode, fillMode, n,
+        reinterpret_cast<cuDoubleComplex*>(A.data()), lda, W.data(), &lwork));
+    Kokkos::View<Scalar*, memory_space> work("syev work buffer", lwork);
+
+    KOKKOS_CUSOLVER_SAFE_CALL_IMPL(cusolverDnZheevd(
+        s.handle, eigMode, fillMode, n,
+        reinterpret_cast<cuDoubleComplex*>(A.data()), lda, W.data(),
+        reinterpret_cast<cuDoubleComplex*>(work.data()), lwork, info.data()));
+  }
+  KOKKOS_CUSOLVER_SAFE_CALL_IMPL(cusolverDnSetStream(s.handle, NULL));
+
+  int info_h = 0;
+  Kokkos::deep_copy(info_h, info);
+  syev_check_info(info_h, "CUSOLVER");
+}
+
+#define KOKKOSLAPACK_SYEV_CUSOLVER(SCALAR, LAYOUT, MEM_SPACE)                 \
+  template <>                                                                 \
+  struct SYEV<                                                                \
+      Kokkos::Cuda,                                                           \
+      Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<Kokkos::Cuda, MEM_SPACE>, \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,                  \
+      Kokkos::View<Kokkos::ArithTraits<SCALAR>::mag_type*, LAYOUT,            \
+                   Kokkos::Device<Kokkos::Cuda, MEM_SPACE>,                   \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,                  \
+      true,                                                                   \
+      syev_eti_spec_avail<                                                    \
+          Kokkos::Cuda,                                                       \
+          Kokkos::View<SCALAR**, LAYOUT,                                      \
+                       Kokkos::Device<Kokkos::Cuda, MEM_SPACE>,               \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged>>,              \
+          Kokkos::View<Kokkos::ArithTraits<SCALAR>::mag_type*, LAYOUT,        \
+                       Kokkos::Device<Kokkos::Cuda, MEM_SPACE>,               \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged>>>::value> {    \
+    using AMatrix = Kokkos::View<SCALAR**, LAYOUT,                            \
+                                 Kokkos::Device<Kokkos::Cuda, MEM_SPACE>,     \
+                                 Kokkos::MemoryTraits<Kokkos::Unmanaged>>;    \
+    using WVector =                                                           \
+        Kokkos::View<Kokkos::ArithTraits<SCALAR>::mag_type*, LAYOUT,          \
+                     Kokkos::Device<Kokkos::Cuda, MEM_SPACE>,                 \
+                     Kokkos::MemoryTraits<Kokkos::Unmanaged>>;                \
+                                                                              \
+    static void syev(const Kokkos::Cuda& space, const char jobz[],            \
+                     const char uplo[], const AMatrix& A, const WVector& W) { \
+      Kokkos::Profiling::pushRegion(                                          \
+          "KokkosLapack::syev[TPL_CUSOLVER," #SCALAR "]");                    \
+      syev_print_specialization<Kokkos::Cuda, AMatrix, WVector>();            \
+                                                                              \
+      cusolverSyevWrapper(space, jobz, uplo, A, W);                           \
+      Kokkos::Profiling::popRegion();                                         \
+    }                                                                         \
+  };
+
+KOKKOSLAPACK_SYEV_CUSOLVER(float, Kokkos::LayoutLeft, Kokkos::CudaSpace)
+KOKKOSLAPACK_SYEV_CUSOLVER(double, Kokkos::LayoutLeft, Kokkos::CudaSpace)
+KOKKOSLAPACK_SYEV_CUSOLVER(Kokkos::complex<float>, Kokkos::LayoutLeft,
+                           Kokkos::CudaSpace)
+KOKKOSLAPACK_SYEV_CUSOLVER(Kokkos::complex<double>, Kokkos::LayoutLeft,
+                           Kokkos::CudaSpace)
+
+#if defined(KOKKOSKERNELS_INST_MEMSPACE_CUDAUVMSPACE)
+KOKKOSLAPACK_SYEV_CUSOLVER(float, Kokkos::LayoutLeft, Kokkos::CudaUVMSpace)
+KOKKOSLAPACK_SYEV_CUSOLVER(double, Kokkos::LayoutLeft, Kokkos::CudaUVMSpace)
+KOKKOSLAPACK_SYEV_CUSOLVER(Kokkos::complex<float>, Kokkos::LayoutLeft,
+                           Kokkos::CudaUVMSpace)
+KOKKOSLAPACK_SYEV_CUSOLVER(Kokkos::complex<double>, Kokkos::LayoutLeft,
+                           Kokkos::CudaUVMSpace)
+#endif
+
+}  // namespace Impl
+}  // namespace KokkosLapack
+#endif  // KOKKOSKERNELS_ENABLE_TPL_CUSOLVER
+
+// ROCSOLVER
+#ifdef KOKKOSKERNELS_ENABLE_TPL_ROCSOLVER
+#include <KokkosBlas_tpl_spec.hpp>
+#include <rocsolver/rocsolver.h>
+
+namespace KokkosLapack {
+namespace Impl {
+
+template <class ExecutionSpace, class AMatrix, class WVector>
+void rocsolverSyevWrapper(const ExecutionSpace& space, const char jobz[],
+                          const char uplo[], const AMatrix& A,
+                          const WVector& W) {
+  using memory_space = typename AMatrix::memory_space;
+  using Scalar       = typename AMatrix::non_const_value_type;
+  using Magnitude    = typename WVector::non_const_value_type;
+  using ALayout_t    = typename AMatrix::array_layout;
+
+  static_assert(std::is_same_v<ALayout_t, Kokkos::LayoutLeft>,
+                "KokkosLapack - syev: A needs to have a Kokkos::LayoutLeft");
+
+  const rocblas_int n   = A.extent_int(0);
+  const rocblas_int lda = A.stride(1);
+
+  const rocblas_evect EigMode = ((jobz[0] == 'V') || (jobz[0] == 'v'))
+                                    ? rocblas_evect_original
+                                    : rocblas_evect_none;
+  const rocblas_fill FillMode = ((uplo[0] == 'L') || (uplo[0] == 'l'))
+                                    ? rocblas_fill_lower
+                                    : rocblas_fill_upper;
+
+  Kokkos::View<rocblas_int, memory_space> info("syev info");
+  // Off-diagonal of the intermediate tridiagonal matrix
+  Kokkos::View<Magnitude*, memory_space> E("syev E buffer", n);
+
+  KokkosBlas::Impl::RocBlasSingleton& s =
+      KokkosBlas::Impl::RocBlasSingleton::singleton();
+  KOKKOS_ROCBLAS_SAFE_CALL_IMPL(
+      rocblas_set_stream(s.handle, space.hip_stream()));
+  if constexpr (std::is_same_v<Scalar, float>) {
+    KOKKOS_ROCBLAS_SAFE_CALL_IMPL(
+        rocsolver_ssyevd(s.handle, EigMode, FillMode, n, A.data(), lda,
+                         W.data(), E.data(), info.data()));
+  }
+  if constexpr (std::is_same_v<Scalar, double>) {
+    KOKKOS_ROCBLAS_SAFE_CALL_IMPL(
+        rocsolver_dsyevd(s.handle, EigMode, FillMode, n, A.data(), lda,
+                         W.data(), E.data(), info.data()));
+  }
+  if constexpr (std::is_same_v<Scalar, Kokkos::complex<float>>) {
+    KOKKOS_ROCBLAS_SAFE_CALL_IMPL(rocsolver_cheevd(
+        s.handle, EigMode, FillMode, n,
+        reinterpret_cast<rocblas_float_complex*>(A.data()), lda, W.data(),
+        E.data(), info.data()));
+  }
+  if constexpr (std::is_same_v<Scalar, Kokkos::complex<double>>) {
+    KOKKOS_ROCBLAS_SAFE_CALL_IMPL(rocsolver_zheevd(
+        s.handle, EigMode, FillMode, n,
+        reinterpret_cast<rocblas_double_complex*>(A.data()), lda, W.data(),
+        E.data(), info.data()));
+  }
+  KOKKOS_ROCBLAS_SAFE_CALL_IMPL(rocblas_set_stream(s.handle, NULL));
+
+  rocblas_int info_h = 0;
+  Kokkos::deep_copy(info_h, info);
+  syev_check_info(info_h, "ROCSOLVER");
+}
+
+#define KOKKOSLAPACK_SYEV_ROCSOLVER(SCALAR, LAYOUT, MEM_SPACE)                 \
+  template <>                                                                  \
+  struct SYEV<                                                                 \
+      Kokkos::HIP,                                                             \
+      Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<Kokkos::HIP, MEM_SPACE>,   \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,                   \
+      Kokkos::View<Kokkos::ArithTraits<SCALAR>::mag_type*, LAYOUT,             \
+                   Kokkos::Device<Kokkos::HIP, MEM_SPACE>,                     \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,                   \
+      true,                                                                    \
+      syev_eti_spec_avail<                                                     \
+          Kokkos::HIP,                                                         \
+          Kokkos::View<SCALAR**, LAYOUT,                                       \
+                       Kokkos::Device<Kokkos::HIP, MEM_SPACE>,                 \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged>>,               \
+          Kokkos::View<Kokkos::ArithTraits<SCALAR>::mag_type*, LAYOUT,         \
+                       Kokkos::Device<Kokkos::HIP, MEM_SPACE>,                 \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged>>>::value> {     \
+    using AMatrix =                                                            \
+        Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<Kokkos::HIP, MEM_SPACE>, \
+                     Kokkos::MemoryTraits<Kokkos::Unmanaged>>;                 \
+    using WVector =                                                            \
+        Kokkos::View<Kokkos::ArithTraits<SCALAR>::mag_type*, LAYOUT,           \
+                     Kokkos::Device<Kokkos::HIP, MEM_SPACE>,                   \
+                     Kokkos::MemoryTraits<Kokkos::Unmanaged>>;                 \
+                                                                               \
+    static void syev(const Kokkos::HIP& space, const char jobz[],              \
+                     const char uplo[], const AMatrix& A, const WVector& W) {  \
+      Kokkos::Profiling::pushRegion(                                           \
+          "KokkosLapack::syev[TPL_ROCSOLVER," #SCALAR "]");                    \
+      syev_print_specialization<Kokkos::HIP, AMatrix, WVector>();              \
+                                                                               \
+      rocsolverSyevWrapper(space, jobz, uplo, A, W);                           \
+      Kokkos::Profiling::popRegion();                                          \
+    }                                                                          \
+  };
+
+KOKKOSLAPACK_SYEV_ROCSOLVER(float, Kokkos::LayoutLeft, Kokkos::HIPSpace)
+KOKKOSLAPACK_SYEV_ROCSOLVER(double, Kokkos::LayoutLeft, Kokkos::HIPSpace)
+KOKKOSLAPACK_SYEV_ROCSOLVER(Kokkos::complex<float>, Kokkos::LayoutLeft,
+                            Kokkos::HIPSpace)
+KOKKOSLAPACK_SYEV_ROCSOLVER(Kokkos::complex<double>, Kokkos::LayoutLeft,
+                            Kokkos::HIPSpace)
+
+#if defined(KOKKOSKERNELS_INST_MEMSPACE_HIPMANAGEDSPACE)
+KOKKOSLAPACK_SYEV_ROCSOLVER(float, Kokkos::LayoutLeft, Kokkos::HIPManagedSpace)
+KOKKOSLAPACK_SYEV_ROCSOLVER(double, Kokkos::LayoutLeft, Kokkos::HIPManagedSpace)
+KOKKOSLAPACK_SYEV_ROCSOLVER(Kokkos::complex<float>, Kokkos::LayoutLeft,
+                            Kokkos::HIPManagedSpace)
+KOKKOSLAPACK_SYEV_ROCSOLVER(Kokkos::complex<double>, Kokkos::LayoutLeft,
+                            Kokkos::HIPManagedSpace)
+#endif
+
+}  // namespace Impl
+}  // namespace KokkosLapack
+#endif  // KOKKOSKERNELS_ENABLE_TPL_ROCSOLVER
+
+#endif  // KOKKOSLAPACK_SYEV_TPL_SPEC_DECL_HPP_
@@ -19,5 +19,9 @@
 #include "Test_Lapack_gesv.hpp"
 #include "Test_Lapack_trtri.hpp"
 #include "Test_Lapack_svd.hpp"
+#include "Test_Lapack_potrf.hpp"
+#include "Test_Lapack_geqrf.hpp"
+#include "Test_Lapack_syev.hpp"
+#include "Test_Lapack_rsvd.hpp"
 
 #endif  // TEST_LAPACK_HPP
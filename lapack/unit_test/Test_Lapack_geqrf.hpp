@@ -0,0 +1,330 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+
+#include <KokkosLapack_geqrf.hpp>
+#include <KokkosLapack_ormqr.hpp>
+#include <KokkosLapack_tsqr.hpp>
+#include <KokkosKernels_TestUtils.hpp>
+
+namespace Test {
+
+// Frobenius norm of a host matrix
+template <class HostViewType>
+double qr_frobenius_norm(const HostViewType& h_A) {
+  using ats = Kokkos::ArithTraits<typename HostViewType::value_type>;
+  double sum = 0;
+  for (int i = 0; i < h_A.extent_int(0); i++)
+    for (int j = 0; j < h_A.extent_int(1); j++)
+      sum += ats::abs(h_A(i, j)) * ats::abs(h_A(i, j));
+  return Kokkos::sqrt(sum);
+}
+
+// Check that the columns of the host matrix Q are orthonormal
+template <class HostViewType>
+bool qr_check_orthonormal(const HostViewType& h_Q, const double tol) {
+  using ScalarA = typename HostViewType::value_type;
+  using ats     = Kokkos::ArithTraits<ScalarA>;
+
+  const int m = h_Q.extent_int(0), n = h_Q.extent_int(1);
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) {
+      ScalarA sum(0);
+      for (int k = 0; k < m; k++) sum += ats::conj(h_Q(k, i)) * h_Q(k, j);
+      const ScalarA ref = (i == j) ? ScalarA(1) : ScalarA(0);
+      if (ats::abs(sum - ref) > tol) {
+        printf("    Error %d x %d: Q^H Q differs from I at (%d, %d): %e\n", m,
+               n, i, j, static_cast<double>(ats::abs(sum - ref)));
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+template <class ViewTypeA, class Device>
+void impl_test_geqrf(int m, int n) {
+  using ScalarA   = typename ViewTypeA::value_type;
+  using ats       = Kokkos::ArithTraits<ScalarA>;
+  using ViewTypeT = Kokkos::View<ScalarA*, typename ViewTypeA::array_layout,
+                                 typename ViewTypeA::device_type>;
+
+  typename Device::execution_space space{};
+  const int k           = Kokkos::min(m, n);
+  const char* conj_char = ats::is_complex ? "C" : "T";
+
+  ViewTypeA A("A", m, n), Q("Q", m, m), X("X", 7, m), Y("Y", 7, m);
+  ViewTypeT Tau("Tau", k);
+  auto h_A0 = Kokkos::create_mirror(A);
+  auto h_A  = Kokkos::create_mirror(A);
+  auto h_Q  = Kokkos::create_mirror(Q);
+  auto h_X  = Kokkos::create_mirror(X);
+  auto h_Y  = Kokkos::create_mirror(Y);
+
+  Kokkos::Random_XorShift64_Pool<Kokkos::DefaultHostExecutionSpace> rand_pool(
+      13718);
+  Kokkos::fill_random(h_A0, rand_pool, ScalarA(1));
+  Kokkos::fill_random(h_X, rand_pool, ScalarA(1));
+  Kokkos::deep_copy(A, h_A0);
+
+  const double orth_tol = 10 * Kokkos::max(m, n) * ats::epsilon();
+  const double tol      = orth_tol * Kokkos::max(qr_frobenius_norm(h_A0), 1.0);
+
+  EXPECT_EQ(KokkosLapack::geqrf(space, A, Tau), 0);
+  Kokkos::deep_copy(h_A, A);
+
+  // Q = Q * I
+  for (int i = 0; i < m; i++) h_Q(i, i) = ScalarA(1);
+  Kokkos::deep_copy(Q, h_Q);
+  EXPECT_EQ(KokkosLapack::ormqr(space, "L", "N", A, Tau, Q), 0);
+  Kokkos::deep_copy(h_Q, Q);
+  ASSERT_TRUE(qr_check_orthonormal(h_Q, orth_tol));
+
+  // A0 = Q(:, 0:k) * R
+  bool test_flag = true;
+  for (int i = 0; i < m && test_flag; i++) {
+    for (int j = 0; j < n; j++) {
+      ScalarA sum(0);
+      for (int l = 0; l <= Kokkos::min(j, k - 1); l++)
+        sum += h_Q(i, l) * h_A(l, j);
+      if (ats::abs(sum - h_A0(i, j)) > tol) {
+        test_flag = false;
+        printf("    Error %d x %d: Q R differs from A at (%d, %d)\n", m, n, i,
+               j);
+        break;
+      }
+    }
+  }
+  ASSERT_TRUE(test_flag);
+
+  // Q^H A0 = [R; 0]
+  auto C = Kokkos::create_mirror(A);
+  Kokkos::deep_copy(C, h_A0);
+  ViewTypeA C_d("C", m, n);
+  Kokkos::deep_copy(C_d, C);
+  EXPECT_EQ(KokkosLapack::ormqr(space, "L", conj_char, A, Tau, C_d), 0);
+  Kokkos::deep_copy(C, C_d);
+  for (int i = 0; i < m && test_flag; i++) {
+    for (int j = 0; j < n; j++) {
+      const ScalarA ref = (i <= j) ? h_A(i, j) : ScalarA(0);
+      if (ats::abs(C(i, j) - ref) > tol) {
+        test_flag = false;
+        printf("    Error %d x %d: Q^H A differs from R at (%d, %d)\n", m, n,
+               i, j);
+        break;
+      }
+    }
+  }
+  ASSERT_TRUE(test_flag);
+
+  // X * Q and X * Q^H against the explicit Q
+  const double x_tol = orth_tol * Kokkos::max(qr_frobenius_norm(h_X), 1.0);
+  for (const bool conj : {false, true}) {
+    Kokkos::deep_copy(Y, h_X);
+    EXPECT_EQ(KokkosLapack::ormqr(space, "R", conj ? conj_char : "N", A, Tau,
+                                  Y),
+              0);
+    Kokkos::deep_copy(h_Y, Y);
+    for (int i = 0; i < 7 && test_flag; i++) {
+      for (int j = 0; j < m; j++) {
+        ScalarA sum(0);
+        for (int l = 0; l < m; l++)
+          sum += h_X(i, l) * (conj ? ats::conj(h_Q(j, l)) : h_Q(l, j));
+        if (ats::abs(h_Y(i, j) - sum) > x_tol) {
+          test_flag = false;
+          printf("    Error %d x %d: X Q%s mismatch at (%d, %d)\n", m, n,
+                 conj ? "^H" : "", i, j);
+          break;
+        }
+      }
+    }
+    ASSERT_TRUE(test_flag);
+  }
+}
+
+template <class ViewTypeA, class Device>
+void impl_test_tsqr(int m, int n) {
+  using ScalarA = typename ViewTypeA::value_type;
+  using ats     = Kokkos::ArithTraits<ScalarA>;
+
+  typename Device::execution_space space{};
+
+  ViewTypeA A("A", m, n), R("R", n, n);
+  auto h_A0 = Kokkos::create_mirror(A);
+  auto h_Q  = Kokkos::create_mirror(A);
+  auto h_R  = Kokkos::create_mirror(R);
+
+  Kokkos::Random_XorShift64_Pool<Kokkos::DefaultHostExecutionSpace> rand_pool(
+      13718);
+  Kokkos::fill_random(h_A0, rand_pool, ScalarA(1));
+  Kokkos::deep_copy(A, h_A0);
+
+  KokkosLapack::Experimental::tsqr(space, A, R);
+  Kokkos::deep_copy(h_Q, A);
+  Kokkos::deep_copy(h_R, R);
+
+  // The reduction tree accumulates one more QR per level
+  const double orth_tol = 10 * (m + n) * ats::epsilon();
+  const double tol      = orth_tol * Kokkos::max(qr_frobenius_norm(h_A0), 1.0);
+  ASSERT_TRUE(qr_check_orthonormal(h_Q, orth_tol));
+
+  bool test_flag = true;
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < i; j++) test_flag = test_flag && (h_R(i, j) == 0);
+  }
+  for (int i = 0; i < m && test_flag; i++) {
+    for (int j = 0; j < n; j++) {
+      ScalarA sum(0);
+      for (int l = 0; l <= j; l++) sum += h_Q(i, l) * h_R(l, j);
+      if (ats::abs(sum - h_A0(i, j)) > tol) {
+        test_flag = false;
+        printf("    Error %d x %d: Q R differs from A at (%d, %d)\n", m, n, i,
+               j);
+        break;
+      }
+    }
+  }
+  ASSERT_TRUE(test_flag);
+}
+
+}  // namespace Test
+
+template <class Scalar, class Device>
+int test_geqrf() {
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&      \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  using view_type_a_ll = Kokkos::View<Scalar**, Kokkos::LayoutLeft, Device>;
+
+  Test::impl_test_geqrf<view_type_a_ll, Device>(1, 1);
+  Test::impl_test_geqrf<view_type_a_ll, Device>(13, 13);
+  Test::impl_test_geqrf<view_type_a_ll, Device>(50, 20);
+  Test::impl_test_geqrf<view_type_a_ll, Device>(20, 50);
+  Test::impl_test_geqrf<view_type_a_ll, Device>(100, 100);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&       \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  using view_type_a_lr = Kokkos::View<Scalar**, Kokkos::LayoutRight, Device>;
+
+  Test::impl_test_geqrf<view_type_a_lr, Device>(13, 13);
+  Test::impl_test_geqrf<view_type_a_lr, Device>(50, 20);
+#endif
+
+  return 1;
+}
+
+// The native geqrf/ormqr only handle real scalars, complex ones need a TPL
+template <class Scalar, class Device>
+int test_geqrf_complex() {
+#if defined(KOKKOSKERNELS_ENABLE_TPL_LAPACK)
+  if constexpr (std::is_same_v<typename Device::memory_space,
+                               Kokkos::HostSpace>) {
+    using view_type_a_ll = Kokkos::View<Scalar**, Kokkos::LayoutLeft, Device>;
+    Test::impl_test_geqrf<view_type_a_ll, Device>(13, 13);
+    Test::impl_test_geqrf<view_type_a_ll, Device>(50, 20);
+    Test::impl_test_geqrf<view_type_a_ll, Device>(20, 50);
+    return 1;
+  }
+#endif
+
+#if defined(KOKKOSKERNELS_ENABLE_TPL_CUSOLVER)
+  if constexpr (std::is_same_v<typename Device::execution_space,
+                               Kokkos::Cuda>) {
+    using view_type_a_ll = Kokkos::View<Scalar**, Kokkos::LayoutLeft, Device>;
+    Test::impl_test_geqrf<view_type_a_ll, Device>(13, 13);
+    Test::impl_test_geqrf<view_type_a_ll, Device>(50, 20);
+    Test::impl_test_geqrf<view_type_a_ll, Device>(20, 50);
+    return 1;
+  }
+#endif
+
+  std::cout << "No TPL support enabled, complex geqrf is not tested"
+            << std::endl;
+  return 0;
+}
+
+template <class Scalar, class Device>
+int test_tsqr() {
+  using view_type_a_ll = Kokkos::View<Scalar**, Kokkos::LayoutLeft, Device>;
+  using view_type_a_lr = Kokkos::View<Scalar**, Kokkos::LayoutRight, Device>;
+
+  Test::impl_test_tsqr<view_type_a_ll, Device>(1, 1);
+  Test::impl_test_tsqr<view_type_a_ll, Device>(40, 3);
+  // a single leaf, then 4 and 9 leaves (the last level has an odd count)
+  Test::impl_test_tsqr<view_type_a_ll, Device>(1000, 8);
+  Test::impl_test_tsqr<view_type_a_ll, Device>(2100, 5);
+  Test::impl_test_tsqr<view_type_a_ll, Device>(5000, 16);
+  Test::impl_test_tsqr<view_type_a_lr, Device>(2100, 5);
+
+  return 1;
+}
+
+#if defined(KOKKOSKERNELS_INST_FLOAT) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) && \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F(TestCategory, geqrf_float) {
+  Kokkos::Profiling::pushRegion("KokkosLapack::Test::geqrf_float");
+  test_geqrf<float, TestDevice>();
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&  \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F(TestCategory, geqrf_double) {
+  Kokkos::Profiling::pushRegion("KokkosLapack::Test::geqrf_double");
+  test_geqrf<double, TestDevice>();
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_FLOAT) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&         \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F(TestCategory, geqrf_complex_float) {
+  Kokkos::Profiling::pushRegion("KokkosLapack::Test::geqrf_complex_float");
+  test_geqrf_complex<Kokkos::complex<float>, TestDevice>();
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&          \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F(TestCategory, geqrf_complex_double) {
+  Kokkos::Profiling::pushRegion("KokkosLapack::Test::geqrf_complex_double");
+  test_geqrf_complex<Kokkos::complex<double>, TestDevice>();
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+TEST_F(TestCategory, tsqr_float) {
+  Kokkos::Profiling::pushRegion("KokkosLapack::Test::tsqr_float");
+  test_tsqr<float, TestDevice>();
+  Kokkos::Profiling::popRegion();
+}
+
+TEST_F(TestCategory, tsqr_double) {
+  Kokkos::Profiling::pushRegion("KokkosLapack::Test::tsqr_double");
+  test_tsqr<double, TestDevice>();
+  Kokkos::Profiling::popRegion();
+}
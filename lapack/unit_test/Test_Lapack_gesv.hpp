@@ -14,17 +14,6 @@
 //
 //@HEADER
 
-// only enable this test where KokkosLapack supports gesv:
-// CUDA+(MAGMA or CUSOLVER), HIP+ROCSOLVER and HOST+LAPACK
-#if (defined(TEST_CUDA_LAPACK_CPP) &&                                       \
-     (defined(KOKKOSKERNELS_ENABLE_TPL_MAGMA) ||                            \
-      defined(KOKKOSKERNELS_ENABLE_TPL_CUSOLVER))) ||                       \
-    (defined(TEST_HIP_LAPACK_CPP) &&                                        \
-     defined(KOKKOSKERNELS_ENABLE_TPL_ROCSOLVER)) ||                        \
-    (defined(KOKKOSKERNELS_ENABLE_TPL_LAPACK) &&                            \
-     (defined(TEST_OPENMP_LAPACK_CPP) || defined(TEST_SERIAL_LAPACK_CPP) || \
-      defined(TEST_THREADS_LAPACK_CPP)))
-
 #include <gtest/gtest.h>
 #include <Kokkos_Core.hpp>
 #include <Kokkos_Random.hpp>
@@ -99,28 +88,20 @@ void impl_test_gesv(const char* mode, const char* padding, int N) {
     KokkosLapack::gesv(space, A, B, ipiv);
   } catch (const std::runtime_error& error) {
     // Check for expected runtime errors due to:
-    // no-pivoting case (note: only MAGMA supports no-pivoting interface)
-    // and no-tpl case
+    // no-pivoting case (note: the LAPACK TPL does not support no-pivoting)
     bool nopivot_runtime_err = false;
-    bool notpl_runtime_err   = false;
 #ifdef KOKKOSKERNELS_ENABLE_TPL_MAGMA   // have MAGMA TPL
 #ifdef KOKKOSKERNELS_ENABLE_TPL_LAPACK  // and have LAPACK TPL
     nopivot_runtime_err = (!std::is_same<typename Device::memory_space,
                                          Kokkos::CudaSpace>::value) &&
                           (ipiv.extent(0) == 0) && (ipiv.data() == nullptr);
-    notpl_runtime_err = false;
-#else
-    notpl_runtime_err = true;
 #endif
 #else                                   // not have MAGMA TPL
 #ifdef KOKKOSKERNELS_ENABLE_TPL_LAPACK  // but have LAPACK TPL
     nopivot_runtime_err = (ipiv.extent(0) == 0) && (ipiv.data() == nullptr);
-    notpl_runtime_err   = false;
-#else
-    notpl_runtime_err = true;
 #endif
 #endif
-    if (!nopivot_runtime_err && !notpl_runtime_err) FAIL();
+    if (!nopivot_runtime_err) FAIL();
     return;
   }
   Kokkos::fence();
@@ -210,28 +191,20 @@ void impl_test_gesv_mrhs(const char* mode, const char* padding, int N,
     KokkosLapack::gesv(space, A, B, ipiv);
   } catch (const std::runtime_error& error) {
     // Check for expected runtime errors due to:
-    // no-pivoting case (note: only MAGMA supports no-pivoting interface)
-    // and no-tpl case
+    // no-pivoting case (note: the LAPACK TPL does not support no-pivoting)
     bool nopivot_runtime_err = false;
-    bool notpl_runtime_err   = false;
 #ifdef KOKKOSKERNELS_ENABLE_TPL_MAGMA   // have MAGMA TPL
 #ifdef KOKKOSKERNELS_ENABLE_TPL_LAPACK  // and have LAPACK TPL
     nopivot_runtime_err = (!std::is_same<typename Device::memory_space,
                                          Kokkos::CudaSpace>::value) &&
                           (ipiv.extent(0) == 0) && (ipiv.data() == nullptr);
-    notpl_runtime_err = false;
-#else
-    notpl_runtime_err = true;
 #endif
 #else                                   // not have MAGMA TPL
 #ifdef KOKKOSKERNELS_ENABLE_TPL_LAPACK  // but have LAPACK TPL
     nopivot_runtime_err = (ipiv.extent(0) == 0) && (ipiv.data() == nullptr);
-    notpl_runtime_err   = false;
-#else
-    notpl_runtime_err = true;
 #endif
 #endif
-    if (!nopivot_runtime_err && !notpl_runtime_err) FAIL();
+    if (!nopivot_runtime_err) FAIL();
     return;
   }
   Kokkos::fence();
@@ -307,6 +280,20 @@ int test_gesv(const char* mode) {
         &mode[0], "Y",
         179);  // padding
   }
+#else  // native implementation
+  Test::impl_test_gesv<view_type_a_ll, view_type_b_ll, Device, false>(
+      &mode[0], "N", 2);  // no padding
+  Test::impl_test_gesv<view_type_a_ll, view_type_b_ll, Device, false>(
+      &mode[0], "N", 13);  // no padding
+  Test::impl_test_gesv<view_type_a_ll, view_type_b_ll, Device, false>(
+      &mode[0], "N", 179);  // no padding
+  Test::impl_test_gesv<view_type_a_ll, view_type_b_ll, Device, false>(
+      &mode[0], "N", 64);  // no padding
+
+  Test::impl_test_gesv<view_type_a_ll, view_type_b_ll, Device, false>(
+      &mode[0], "Y", 13);  // padding
+  Test::impl_test_gesv<view_type_a_ll, view_type_b_ll, Device, false>(
+      &mode[0], "Y", 179);  // padding
 #endif
 #endif
 
@@ -361,6 +348,20 @@ int test_gesv_mrhs(const char* mode) {
     Test::impl_test_gesv_mrhs<view_type_a_ll, view_type_b_ll, Device, true>(
         &mode[0], "Y", 179, 5);  // padding
   }
+#else  // native implementation
+  Test::impl_test_gesv_mrhs<view_type_a_ll, view_type_b_ll, Device, false>(
+      &mode[0], "N", 2, 5);  // no padding
+  Test::impl_test_gesv_mrhs<view_type_a_ll, view_type_b_ll, Device, false>(
+      &mode[0], "N", 13, 5);  // no padding
+  Test::impl_test_gesv_mrhs<view_type_a_ll, view_type_b_ll, Device, false>(
+      &mode[0], "N", 179, 5);  // no padding
+  Test::impl_test_gesv_mrhs<view_type_a_ll, view_type_b_ll, Device, false>(
+      &mode[0], "N", 64, 5);  // no padding
+
+  Test::impl_test_gesv_mrhs<view_type_a_ll, view_type_b_ll, Device, false>(
+      &mode[0], "Y", 13, 5);  // padding
+  Test::impl_test_gesv_mrhs<view_type_a_ll, view_type_b_ll, Device, false>(
+      &mode[0], "Y", 179, 5);  // padding
 #endif
 #endif
 
@@ -440,5 +441,3 @@ TEST_F(TestCategory, gesv_mrhs_complex_float) {
   Kokkos::Profiling::popRegion();
 }
 #endif
-
-#endif  // CUDA+(MAGMA or CUSOLVER) or HIP+ROCSOLVER or LAPACK+HOST
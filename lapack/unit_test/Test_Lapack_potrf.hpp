@@ -0,0 +1,287 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+
+#include <KokkosLapack_potrf.hpp>
+#include <KokkosLapack_potrs.hpp>
+#include <KokkosKernels_TestUtils.hpp>
+
+namespace Test {
+
+// A = M * M^H + N * I is Hermitian positive definite
+template <class HostViewType>
+void make_hpd_matrix(const HostViewType& h_A, int N) {
+  using ScalarA = typename HostViewType::value_type;
+  using ats     = Kokkos::ArithTraits<ScalarA>;
+
+  HostViewType h_M("M", N, N);
+  Kokkos::Random_XorShift64_Pool<Kokkos::DefaultHostExecutionSpace> rand_pool(
+      13718);
+  Kokkos::fill_random(h_M, rand_pool, ScalarA(1));
+  for (int i = 0; i < N; i++) {
+    for (int j = 0; j < N; j++) {
+      ScalarA sum = (i == j) ? ScalarA(N) : ScalarA(0);
+      for (int k = 0; k < N; k++) sum += h_M(i, k) * ats::conj(h_M(j, k));
+      h_A(i, j) = sum;
+    }
+  }
+}
+
+template <class ViewTypeA, class Device>
+void impl_test_potrf(const char* uplo, int N) {
+  using ScalarA  = typename ViewTypeA::value_type;
+  using ats      = Kokkos::ArithTraits<ScalarA>;
+  using mag_type = typename ats::mag_type;
+
+  typename Device::execution_space space{};
+  const bool lower = (uplo[0] == 'L');
+
+  ViewTypeA A("A", N, N);
+  typename ViewTypeA::HostMirror h_A0 = Kokkos::create_mirror(A);
+  typename ViewTypeA::HostMirror h_A  = Kokkos::create_mirror(A);
+  make_hpd_matrix(h_A0, N);
+  Kokkos::deep_copy(A, h_A0);
+
+  const int info = KokkosLapack::potrf(space, uplo, A);
+  EXPECT_EQ(info, 0);
+  Kokkos::deep_copy(h_A, A);
+
+  // Check A0 = L * L^H (or U^H * U) on the referenced triangle
+  auto factor = [&](int i, int j) -> ScalarA {
+    if (lower) return (j <= i) ? h_A(i, j) : ScalarA(0);
+    return (j <= i) ? ats::conj(h_A(j, i)) : ScalarA(0);
+  };
+  const mag_type eps = 1.0e3 * N * ats::epsilon();
+  bool test_flag     = true;
+  for (int i = 0; i < N && test_flag; i++) {
+    for (int j = 0; j <= i; j++) {
+      ScalarA sum(0);
+      for (int k = 0; k <= j; k++)
+        sum += factor(i, k) * ats::conj(factor(j, k));
+      const ScalarA ref = lower ? h_A0(i, j) : h_A0(j, i);
+      const ScalarA val = lower ? sum : ats::conj(sum);
+      if (ats::abs(val - ref) > eps * ats::abs(h_A0(i, i))) {
+        test_flag = false;
+        printf("    Error %d, uplo %c: factor mismatch at (%d, %d)\n", N,
+               uplo[0], i, j);
+        break;
+      }
+    }
+  }
+  ASSERT_EQ(test_flag, true);
+
+  // A matrix which is not positive definite from its third leading minor
+  if (N >= 3) {
+    make_hpd_matrix(h_A0, N);
+    h_A0(2, 2) = -h_A0(2, 2);
+    Kokkos::deep_copy(A, h_A0);
+    EXPECT_EQ(KokkosLapack::potrf(space, uplo, A), 3);
+  }
+}
+
+template <class ViewTypeA, class ViewTypeB, class Device>
+void impl_test_potrs(const char* uplo, int N, int nrhs) {
+  using ScalarA  = typename ViewTypeA::value_type;
+  using ats      = Kokkos::ArithTraits<ScalarA>;
+  using mag_type = typename ats::mag_type;
+
+  typename Device::execution_space space{};
+
+  ViewTypeA A("A", N, N);
+  ViewTypeB B("B", N, nrhs);
+  typename ViewTypeA::HostMirror h_A  = Kokkos::create_mirror(A);
+  typename ViewTypeB::HostMirror h_X0 = Kokkos::create_mirror(B);
+  typename ViewTypeB::HostMirror h_B  = Kokkos::create_mirror(B);
+  make_hpd_matrix(h_A, N);
+
+  Kokkos::Random_XorShift64_Pool<Kokkos::DefaultHostExecutionSpace> rand_pool(
+      13718);
+  Kokkos::fill_random(h_X0, rand_pool, ScalarA(1));
+  for (int j = 0; j < nrhs; j++) {
+    for (int i = 0; i < N; i++) {
+      ScalarA sum(0);
+      for (int k = 0; k < N; k++) sum += h_A(i, k) * h_X0(k, j);
+      h_B(i, j) = sum;
+    }
+  }
+  Kokkos::deep_copy(A, h_A);
+  Kokkos::deep_copy(B, h_B);
+
+  ASSERT_EQ(KokkosLapack::potrf(space, uplo, A), 0);
+
+  // Single right-hand side, as a rank-1 view
+  using ViewTypeX = Kokkos::View<ScalarA*, typename ViewTypeB::array_layout,
+                                 typename ViewTypeB::device_type>;
+  ViewTypeX x("x", N);
+  Kokkos::deep_copy(x, Kokkos::subview(B, Kokkos::ALL(), 0));
+  KokkosLapack::potrs(space, uplo, A, x);
+  typename ViewTypeX::HostMirror h_x = Kokkos::create_mirror_view(x);
+  Kokkos::deep_copy(h_x, x);
+
+  KokkosLapack::potrs(space, uplo, A, B);
+  Kokkos::deep_copy(h_B, B);
+
+  const mag_type eps = 1.0e3 * N * ats::epsilon();
+  bool test_flag     = true;
+  for (int i = 0; i < N; i++) {
+    if (ats::abs(h_x(i) - h_X0(i, 0)) > eps) {
+      test_flag = false;
+      printf("    Error %d, uplo %c: result( %.15lf ) != solution( %.15lf )"
+             " at (%d)\n",
+             N, uplo[0], ats::abs(h_x(i)), ats::abs(h_X0(i, 0)), i);
+      break;
+    }
+  }
+  for (int j = 0; j < nrhs && test_flag; j++) {
+    for (int i = 0; i < N; i++) {
+      if (ats::abs(h_B(i, j) - h_X0(i, j)) > eps) {
+        test_flag = false;
+        printf("    Error %d, uplo %c: result( %.15lf ) != solution( %.15lf )"
+               " at (%d, %d)\n",
+               N, uplo[0], ats::abs(h_B(i, j)), ats::abs(h_X0(i, j)), i, j);
+        break;
+      }
+    }
+  }
+  ASSERT_EQ(test_flag, true);
+}
+
+}  // namespace Test
+
+template <class Scalar, class Device>
+int test_potrf(const char* uplo) {
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&      \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  using view_type_a_ll = Kokkos::View<Scalar**, Kokkos::LayoutLeft, Device>;
+
+  Test::impl_test_potrf<view_type_a_ll, Device>(uplo, 1);
+  Test::impl_test_potrf<view_type_a_ll, Device>(uplo, 13);
+  Test::impl_test_potrf<view_type_a_ll, Device>(uplo, 64);
+  Test::impl_test_potrf<view_type_a_ll, Device>(uplo, 179);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&       \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  using view_type_a_lr = Kokkos::View<Scalar**, Kokkos::LayoutRight, Device>;
+
+  Test::impl_test_potrf<view_type_a_lr, Device>(uplo, 13);
+  Test::impl_test_potrf<view_type_a_lr, Device>(uplo, 179);
+#endif
+
+  return 1;
+}
+
+template <class Scalar, class Device>
+int test_potrs(const char* uplo) {
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&      \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  using view_type_a_ll = Kokkos::View<Scalar**, Kokkos::LayoutLeft, Device>;
+
+  Test::impl_test_potrs<view_type_a_ll, view_type_a_ll, Device>(uplo, 1, 1);
+  Test::impl_test_potrs<view_type_a_ll, view_type_a_ll, Device>(uplo, 13, 5);
+  Test::impl_test_potrs<view_type_a_ll, view_type_a_ll, Device>(uplo, 64, 5);
+  Test::impl_test_potrs<view_type_a_ll, view_type_a_ll, Device>(uplo, 179, 5);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&       \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  using view_type_a_lr = Kokkos::View<Scalar**, Kokkos::LayoutRight, Device>;
+
+  Test::impl_test_potrs<view_type_a_lr, view_type_a_lr, Device>(uplo, 13, 5);
+  Test::impl_test_potrs<view_type_a_lr, view_type_a_lr, Device>(uplo, 179, 5);
+#endif
+
+  return 1;
+}
+
+#if defined(KOKKOSKERNELS_INST_FLOAT) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) && \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F(TestCategory, potrf_float) {
+  Kokkos::Profiling::pushRegion("KokkosLapack::Test::potrf_float");
+  test_potrf<float, TestDevice>("L");
+  test_potrf<float, TestDevice>("U");
+  Kokkos::Profiling::popRegion();
+}
+
+TEST_F(TestCategory, potrs_float) {
+  Kokkos::Profiling::pushRegion("KokkosLapack::Test::potrs_float");
+  test_potrs<float, TestDevice>("L");
+  test_potrs<float, TestDevice>("U");
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&  \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F(TestCategory, potrf_double) {
+  Kokkos::Profiling::pushRegion("KokkosLapack::Test::potrf_double");
+  test_potrf<double, TestDevice>("L");
+  test_potrf<double, TestDevice>("U");
+  Kokkos::Profiling::popRegion();
+}
+
+TEST_F(TestCategory, potrs_double) {
+  Kokkos::Profiling::pushRegion("KokkosLapack::Test::potrs_double");
+  test_potrs<double, TestDevice>("L");
+  test_potrs<double, TestDevice>("U");
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_FLOAT) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&         \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F(TestCategory, potrf_complex_float) {
+  Kokkos::Profiling::pushRegion("KokkosLapack::Test::potrf_complex_float");
+  test_potrf<Kokkos::complex<float>, TestDevice>("L");
+  test_potrf<Kokkos::complex<float>, TestDevice>("U");
+  Kokkos::Profiling::popRegion();
+}
+
+TEST_F(TestCategory, potrs_complex_float) {
+  Kokkos::Profiling::pushRegion("KokkosLapack::Test::potrs_complex_float");
+  test_potrs<Kokkos::complex<float>, TestDevice>("L");
+  test_potrs<Kokkos::complex<float>, TestDevice>("U");
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&          \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F(TestCategory, potrf_complex_double) {
+  Kokkos::Profiling::pushRegion("KokkosLapack::Test::potrf_complex_double");
+  test_potrf<Kokkos::complex<double>, TestDevice>("L");
+  test_potrf<Kokkos::complex<double>, TestDevice>("U");
+  Kokkos::Profiling::popRegion();
+}
+
+TEST_F(TestCategory, potrs_complex_double) {
+  Kokkos::Profiling::pushRegion("KokkosLapack::Test::potrs_complex_double");
+  test_potrs<Kokkos::complex<double>, TestDevice>("L");
+  test_potrs<Kokkos::complex<double>, TestDevice>("U");
+  Kokkos::Profiling::popRegion();
+}
+#endif
@@ -0,0 +1,164 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+
+#include <KokkosLapack_rsvd.hpp>
+#include <KokkosLapack_tsqr.hpp>
+#include <KokkosKernels_TestUtils.hpp>
+
+namespace Test {
+
+// Check that the columns of the host matrix Q (or its rows if trans) are
+// orthonormal
+template <class HostViewType>
+bool rsvd_check_orthonormal(const HostViewType& h_Q, const bool trans,
+                            const double tol) {
+  const int m = trans ? h_Q.extent_int(1) : h_Q.extent_int(0);
+  const int n = trans ? h_Q.extent_int(0) : h_Q.extent_int(1);
+  auto Q      = [&](int r, int c) { return trans ? h_Q(c, r) : h_Q(r, c); };
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) {
+      double sum = 0;
+      for (int l = 0; l < m; l++) sum += Q(l, i) * Q(l, j);
+      const double ref = (i == j) ? 1 : 0;
+      if (Kokkos::abs(sum - ref) > tol) {
+        printf("    Error %d x %d: vectors not orthonormal at (%d, %d): %e\n",
+               m, n, i, j, Kokkos::abs(sum - ref));
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Build A = Q1 * diag(sigma) * Q2^T with sigma_i = 2^-i for i < rank and
+// compare the k leading triplets estimated by rsvd with it.
+template <class ViewTypeA, class Device>
+void impl_test_rsvd(const int m, const int n, const int rank, const int k,
+                    const int oversample, const int power_iters) {
+  using ScalarA    = typename ViewTypeA::value_type;
+  using ats        = Kokkos::ArithTraits<ScalarA>;
+  using LL_matrix  = Kokkos::View<ScalarA**, Kokkos::LayoutLeft, Device>;
+  using vector_t   = Kokkos::View<ScalarA*, Device>;
+  using exec_space = typename Device::execution_space;
+
+  exec_space space{};
+
+  // Orthonormal factors from the QR of random matrices
+  LL_matrix Q1("Q1", m, rank), Q2("Q2", n, rank), R("R", rank, rank);
+  Kokkos::Random_XorShift64_Pool<exec_space> rand_pool(13718);
+  Kokkos::fill_random(Q1, rand_pool, ScalarA(-1), ScalarA(1));
+  Kokkos::fill_random(Q2, rand_pool, ScalarA(-1), ScalarA(1));
+  KokkosLapack::Experimental::tsqr(space, Q1, R);
+  KokkosLapack::Experimental::tsqr(space, Q2, R);
+  auto h_Q1 = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), Q1);
+  auto h_Q2 = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), Q2);
+
+  std::vector<double> sigma(rank);
+  for (int i = 0; i < rank; i++) sigma[i] = Kokkos::pow(0.5, i);
+
+  ViewTypeA A("A", m, n);
+  auto h_A = Kokkos::create_mirror_view(A);
+  for (int i = 0; i < m; i++) {
+    for (int j = 0; j < n; j++) {
+      double sum = 0;
+      for (int l = 0; l < rank; l++)
+        sum += h_Q1(i, l) * sigma[l] * h_Q2(j, l);
+      h_A(i, j) = ScalarA(sum);
+    }
+  }
+  Kokkos::deep_copy(A, h_A);
+
+  vector_t S("S", k);
+  LL_matrix U("U", m, k), Vt("Vt", k, n);
+  KokkosLapack::Experimental::rsvd(space, A, k, oversample, power_iters, S, U,
+                                   Vt);
+
+  // rsvd must not modify A
+  auto h_A1 = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A);
+  for (int i = 0; i < m; i++)
+    for (int j = 0; j < n; j++) ASSERT_EQ(h_A1(i, j), h_A(i, j));
+
+  auto h_S  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), S);
+  auto h_U  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), U);
+  auto h_Vt = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), Vt);
+
+  const int l        = Kokkos::min(k + oversample, Kokkos::min(m, n));
+  const double tol   = 100 * (l + rank) * ats::epsilon();
+  const double ortho = 10 * (m + n) * ats::epsilon();
+  ASSERT_TRUE(rsvd_check_orthonormal(h_U, false, ortho));
+  ASSERT_TRUE(rsvd_check_orthonormal(h_Vt, true, ortho));
+
+  // The spectrum halves at each index so the sample of size l captures the
+  // k leading triplets up to (sigma_l / sigma_k)^(2 power_iters + 1)
+  for (int i = 0; i < k; i++) {
+    const double ref = (i < rank) ? sigma[i] : 0;
+    EXPECT_NEAR(h_S(i), ref, tol) << "S(" << i << ") for " << m << " x " << n;
+  }
+
+  // The reconstruction error is close to the optimal rank-k error
+  double err = 0, opt = 0;
+  for (int i = k; i < rank; i++) opt += sigma[i] * sigma[i];
+  for (int i = 0; i < m; i++) {
+    for (int j = 0; j < n; j++) {
+      double sum = 0;
+      for (int p = 0; p < k; p++) sum += h_U(i, p) * h_S(p) * h_Vt(p, j);
+      err += (sum - h_A(i, j)) * (sum - h_A(i, j));
+    }
+  }
+  EXPECT_LE(Kokkos::sqrt(err), 1.01 * Kokkos::sqrt(opt) + tol)
+      << "reconstruction for " << m << " x " << n;
+}
+
+}  // namespace Test
+
+template <class Scalar, class Device>
+int test_rsvd() {
+  using view_type_a_ll = Kokkos::View<Scalar**, Kokkos::LayoutLeft, Device>;
+  using view_type_a_lr = Kokkos::View<Scalar**, Kokkos::LayoutRight, Device>;
+
+  Test::impl_test_rsvd<view_type_a_ll, Device>(1, 1, 1, 1, 0, 0);
+  Test::impl_test_rsvd<view_type_a_ll, Device>(10, 10, 10, 0, 5, 0);
+  Test::impl_test_rsvd<view_type_a_ll, Device>(200, 120, 30, 5, 5, 2);
+  Test::impl_test_rsvd<view_type_a_ll, Device>(120, 200, 30, 5, 5, 2);
+  Test::impl_test_rsvd<view_type_a_ll, Device>(50, 8, 8, 8, 5, 1);
+  Test::impl_test_rsvd<view_type_a_ll, Device>(3000, 40, 20, 8, 10, 1);
+  Test::impl_test_rsvd<view_type_a_lr, Device>(200, 120, 30, 5, 5, 2);
+
+  return 1;
+}
+
+#if defined(KOKKOSKERNELS_INST_FLOAT) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) && \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F(TestCategory, rsvd_float) {
+  Kokkos::Profiling::pushRegion("KokkosLapack::Test::rsvd_float");
+  test_rsvd<float, TestDevice>();
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&  \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F(TestCategory, rsvd_double) {
+  Kokkos::Profiling::pushRegion("KokkosLapack::Test::rsvd_double");
+  test_rsvd<double, TestDevice>();
+  Kokkos::Profiling::popRegion();
+}
+#endif
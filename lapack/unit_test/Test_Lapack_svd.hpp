@@ -516,8 +516,108 @@ int impl_test_svd(const int m, const int n) {
   return 0;
 }
 
+template <class ScalarA, class Layout, class Device>
+int impl_test_svd_batched(const int batch, const int m, const int n) {
+  using execution_space = typename Device::execution_space;
+  using KAT_S           = Kokkos::ArithTraits<ScalarA>;
+  using matrices_type   = Kokkos::View<ScalarA***, Layout, Device>;
+  using vectors_type    = Kokkos::View<ScalarA**, Layout, Device>;
+
+  const int rank   = Kokkos::min(m, n);
+  const double tol = 100 * Kokkos::max(Kokkos::max(m, n), 1) * KAT_S::eps();
+
+  matrices_type A("A", batch, m, n), U("U", batch, m, m),
+      Vt("Vt", batch, n, n), Aref("A ref", batch, m, n);
+  vectors_type S("S", batch, rank), Sref("S ref", batch, rank);
+
+  Kokkos::Random_XorShift64_Pool<execution_space> rand_pool(13718);
+  Kokkos::fill_random(A, rand_pool, ScalarA(-1), ScalarA(1));
+  Kokkos::deep_copy(Aref, A);
+
+  // The singular values alone, then the full decomposition
+  KokkosLapack::svd("N", "N", A, Sref, U, Vt);
+  Kokkos::deep_copy(A, Aref);
+  KokkosLapack::svd("A", "A", A, S, U, Vt);
+
+  auto A_h    = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), Aref);
+  auto S_h    = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), S);
+  auto Sref_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), Sref);
+  auto U_h    = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), U);
+  auto Vt_h   = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), Vt);
+
+  for (int b = 0; b < batch; ++b) {
+    double normA = 0;
+    for (int i = 0; i < m; ++i)
+      for (int j = 0; j < n; ++j) normA += A_h(b, i, j) * A_h(b, i, j);
+    normA = Kokkos::sqrt(normA);
+
+    for (int k = 0; k < rank; ++k) {
+      EXPECT_GE(S_h(b, k), 0) << "batch entry " << b;
+      if (k > 0) EXPECT_GE(S_h(b, k - 1), S_h(b, k)) << "batch entry " << b;
+      EXPECT_NEAR(Sref_h(b, k), S_h(b, k), tol * normA) << "batch entry " << b;
+    }
+    for (int i = 0; i < m; ++i) {
+      for (int j = 0; j < m; ++j) {
+        double sum = 0;
+        for (int k = 0; k < m; ++k) sum += U_h(b, k, i) * U_h(b, k, j);
+        EXPECT_NEAR(sum, (i == j) ? 1 : 0, tol) << "U of batch entry " << b;
+      }
+    }
+    for (int i = 0; i < n; ++i) {
+      for (int j = 0; j < n; ++j) {
+        double sum = 0;
+        for (int k = 0; k < n; ++k) sum += Vt_h(b, i, k) * Vt_h(b, j, k);
+        EXPECT_NEAR(sum, (i == j) ? 1 : 0, tol) << "Vt of batch entry " << b;
+      }
+    }
+    for (int i = 0; i < m; ++i) {
+      for (int j = 0; j < n; ++j) {
+        double sum = 0;
+        for (int k = 0; k < rank; ++k)
+          sum += U_h(b, i, k) * S_h(b, k) * Vt_h(b, k, j);
+        EXPECT_NEAR(sum, A_h(b, i, j), tol * normA)
+            << "U*S*Vt of batch entry " << b;
+      }
+    }
+  }
+
+  return 0;
+}
+
 }  // namespace Test
 
+template <class ScalarA, class Device>
+int test_svd_batched() {
+  using Kokkos::LayoutLeft;
+  using Kokkos::LayoutRight;
+  int ret;
+
+  // Contiguous LayoutRight batches go to the TPLs when they are enabled
+  ret = Test::impl_test_svd_batched<ScalarA, LayoutRight, Device>(0, 4, 4);
+  EXPECT_EQ(ret, 0);
+
+  ret = Test::impl_test_svd_batched<ScalarA, LayoutRight, Device>(1, 1, 1);
+  EXPECT_EQ(ret, 0);
+
+  ret = Test::impl_test_svd_batched<ScalarA, LayoutRight, Device>(100, 5, 5);
+  EXPECT_EQ(ret, 0);
+
+  ret = Test::impl_test_svd_batched<ScalarA, LayoutRight, Device>(50, 8, 3);
+  EXPECT_EQ(ret, 0);
+
+  ret = Test::impl_test_svd_batched<ScalarA, LayoutRight, Device>(50, 3, 8);
+  EXPECT_EQ(ret, 0);
+
+  // Larger than what cuSOLVER gesvdjBatched supports
+  ret = Test::impl_test_svd_batched<ScalarA, LayoutRight, Device>(10, 40, 33);
+  EXPECT_EQ(ret, 0);
+
+  ret = Test::impl_test_svd_batched<ScalarA, LayoutLeft, Device>(50, 6, 4);
+  EXPECT_EQ(ret, 0);
+
+  return 1;
+}
+
 template <class ScalarA, class Device>
 int test_svd() {
   int ret;
@@ -656,3 +756,23 @@ TEST_F(TestCategory, svd_complex_double) {
   Kokkos::Profiling::popRegion();
 }
 #endif
+
+#if defined(KOKKOSKERNELS_INST_FLOAT) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) && \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F(TestCategory, svd_batched_float) {
+  Kokkos::Profiling::pushRegion("KokkosLapack::Test::svd_batched_float");
+  test_svd_batched<float, TestDevice>();
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&  \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F(TestCategory, svd_batched_double) {
+  Kokkos::Profiling::pushRegion("KokkosLapack::Test::svd_batched_double");
+  test_svd_batched<double, TestDevice>();
+  Kokkos::Profiling::popRegion();
+}
+#endif
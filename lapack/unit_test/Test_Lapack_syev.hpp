@@ -0,0 +1,213 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+
+#include <KokkosLapack_syev.hpp>
+#include <KokkosKernels_TestUtils.hpp>
+
+namespace Test {
+
+template <class ViewTypeA, class Device>
+void impl_test_syev(const int n) {
+  using ScalarA   = typename ViewTypeA::value_type;
+  using ats       = Kokkos::ArithTraits<ScalarA>;
+  using mag_type  = typename ats::mag_type;
+  using ViewTypeW = Kokkos::View<mag_type*, typename ViewTypeA::array_layout,
+                                 typename ViewTypeA::device_type>;
+
+  typename Device::execution_space space{};
+
+  ViewTypeA A("A", n, n), B("B", n, n);
+  ViewTypeW W("W", n), W_novec("W no vectors", n);
+  auto h_A0 = Kokkos::create_mirror(A);
+  auto h_V  = Kokkos::create_mirror(A);
+  auto h_W  = Kokkos::create_mirror(W);
+  auto h_Wn = Kokkos::create_mirror(W);
+
+  // A0 = (B + B^H) / 2 is Hermitian with a random spectrum
+  Kokkos::Random_XorShift64_Pool<Kokkos::DefaultHostExecutionSpace> rand_pool(
+      13718);
+  auto h_B = Kokkos::create_mirror(B);
+  Kokkos::fill_random(h_B, rand_pool, ScalarA(1));
+  double normA = 0;
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) {
+      h_A0(i, j) = (h_B(i, j) + ats::conj(h_B(j, i))) / mag_type(2);
+      normA += ats::abs(h_A0(i, j)) * ats::abs(h_A0(i, j));
+    }
+  }
+  normA = Kokkos::sqrt(normA);
+
+  // LAPACK testing threshold: residuals are O(n * eps * ||A||)
+  const double orth_tol = 30 * Kokkos::max(n, 1) * ats::epsilon();
+  const double tol      = orth_tol * Kokkos::max(normA, 1.0);
+
+  // Only the lower triangle is referenced, poison the strict upper one
+  Kokkos::deep_copy(h_V, h_A0);
+  for (int j = 1; j < n; j++)
+    for (int i = 0; i < j; i++) h_V(i, j) = ScalarA(1e4);
+  Kokkos::deep_copy(A, h_V);
+  KokkosLapack::syev(space, "V", "L", A, W);
+  Kokkos::deep_copy(h_V, A);
+  Kokkos::deep_copy(h_W, W);
+
+  // Eigenvalues are returned in ascending order
+  for (int i = 1; i < n; i++) EXPECT_LE(h_W(i - 1), h_W(i));
+
+  // V^H V = I
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) {
+      ScalarA sum(0);
+      for (int k = 0; k < n; k++) sum += ats::conj(h_V(k, i)) * h_V(k, j);
+      const ScalarA ref = (i == j) ? ScalarA(1) : ScalarA(0);
+      EXPECT_LE(ats::abs(sum - ref), orth_tol)
+          << "V^H V differs from I at (" << i << ", " << j << ")";
+    }
+  }
+
+  // A0 V = V diag(W)
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) {
+      ScalarA sum(0);
+      for (int k = 0; k < n; k++) sum += h_A0(i, k) * h_V(k, j);
+      EXPECT_LE(ats::abs(sum - h_V(i, j) * h_W(j)), tol)
+          << "A V differs from V W at (" << i << ", " << j << ")";
+    }
+  }
+
+  // Eigenvalues only, from the upper triangle through the heev spelling
+  Kokkos::deep_copy(h_V, h_A0);
+  for (int j = 0; j < n; j++)
+    for (int i = j + 1; i < n; i++) h_V(i, j) = ScalarA(1e4);
+  Kokkos::deep_copy(A, h_V);
+  KokkosLapack::heev(space, "N", "U", A, W_novec);
+  Kokkos::deep_copy(h_Wn, W_novec);
+  for (int i = 0; i < n; i++) EXPECT_NEAR(h_Wn(i), h_W(i), tol);
+}
+
+template <class ViewTypeA, class Device>
+void impl_test_syev_analytic() {
+  using ScalarA   = typename ViewTypeA::value_type;
+  using mag_type  = typename Kokkos::ArithTraits<ScalarA>::mag_type;
+  using ViewTypeW = Kokkos::View<mag_type*, typename ViewTypeA::array_layout,
+                                 typename ViewTypeA::device_type>;
+
+  // [2 1; 1 2] has eigenvalues 1 and 3
+  ViewTypeA A("A", 2, 2);
+  ViewTypeW W("W", 2);
+  auto h_A = Kokkos::create_mirror_view(A);
+  h_A(0, 0) = 2;
+  h_A(0, 1) = 1;
+  h_A(1, 0) = 1;
+  h_A(1, 1) = 2;
+  Kokkos::deep_copy(A, h_A);
+
+  KokkosLapack::syev("V", "U", A, W);
+  auto h_W = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), W);
+  const mag_type tol = 10 * Kokkos::ArithTraits<mag_type>::epsilon();
+  EXPECT_NEAR(h_W(0), 1, tol);
+  EXPECT_NEAR(h_W(1), 3, tol);
+}
+
+}  // namespace Test
+
+template <class ScalarA, class Device>
+void test_syev() {
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&      \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  using view_type_a_layout_left =
+      Kokkos::View<ScalarA**, Kokkos::LayoutLeft, Device>;
+
+  Test::impl_test_syev_analytic<view_type_a_layout_left, Device>();
+  Test::impl_test_syev<view_type_a_layout_left, Device>(0);
+  Test::impl_test_syev<view_type_a_layout_left, Device>(1);
+  Test::impl_test_syev<view_type_a_layout_left, Device>(15);
+  Test::impl_test_syev<view_type_a_layout_left, Device>(100);
+#endif
+}
+
+template <class Scalar, class Device>
+void test_syev_wrapper() {
+#if defined(KOKKOSKERNELS_ENABLE_TPL_LAPACK) || \
+    defined(KOKKOSKERNELS_ENABLE_TPL_MKL)
+  if constexpr (std::is_same_v<typename Device::memory_space,
+                               Kokkos::HostSpace>) {
+    // Using a host side space with LAPACK/MKL
+    return test_syev<Scalar, Device>();
+  }
+#endif
+
+#if defined(KOKKOSKERNELS_ENABLE_TPL_CUSOLVER)
+  if constexpr (std::is_same_v<typename Device::execution_space,
+                               Kokkos::Cuda>) {
+    // Using a Cuda device with CUSOLVER
+    return test_syev<Scalar, Device>();
+  }
+#endif
+
+#if defined(KOKKOSKERNELS_ENABLE_TPL_ROCSOLVER)
+  if constexpr (std::is_same_v<typename Device::execution_space, Kokkos::HIP>) {
+    // Using a HIP device with ROCSOLVER
+    return test_syev<Scalar, Device>();
+  }
+#endif
+
+  std::cout << "No TPL support enabled, syev is not tested" << std::endl;
+}
+
+#if defined(KOKKOSKERNELS_INST_FLOAT) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) && \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F(TestCategory, syev_float) {
+  Kokkos::Profiling::pushRegion("KokkosLapack::Test::syev_float");
+  test_syev_wrapper<float, TestDevice>();
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&  \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F(TestCategory, syev_double) {
+  Kokkos::Profiling::pushRegion("KokkosLapack::Test::syev_double");
+  test_syev_wrapper<double, TestDevice>();
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_FLOAT) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&         \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F(TestCategory, syev_complex_float) {
+  Kokkos::Profiling::pushRegion("KokkosLapack::Test::syev_complex_float");
+  test_syev_wrapper<Kokkos::complex<float>, TestDevice>();
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&          \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F(TestCategory, syev_complex_double) {
+  Kokkos::Profiling::pushRegion("KokkosLapack::Test::syev_complex_double");
+  test_syev_wrapper<Kokkos::complex<double>, TestDevice>();
+  Kokkos::Profiling::popRegion();
+}
+#endif
@@ -20,6 +20,8 @@
 #include "Kokkos_Core.hpp"
 
 #include "KokkosODE_Newton.hpp"
+#include "KokkosODE_RungeKutta_impl.hpp"
+#include "KokkosODE_DenseOutput_impl.hpp"
 #include "KokkosBlas2_serial_gemv.hpp"
 #include "KokkosBatched_Gemm_Decl.hpp"
 
@@ -166,13 +168,13 @@ struct BDF_system_wrapper2 {
 };
 
 template <class ode_type, class table_type, class vec_type, class mv_type,
-          class mat_type, class scalar_type>
+          class linear_solver_type, class scalar_type>
 KOKKOS_FUNCTION void BDFStep(ode_type& ode, const table_type& table,
                              scalar_type t, scalar_type dt,
                              const vec_type& y_old, const vec_type& y_new,
                              const vec_type& rhs, const vec_type& update,
                              const vec_type& scale, const mv_type& y_vecs,
-                             const mat_type& temp, const mat_type& jac) {
+                             const linear_solver_type& linear_solver) {
   using newton_params = KokkosODE::Experimental::Newton_params;
 
   BDF_system_wrapper sys(ode, table, t, dt, y_vecs);
@@ -185,12 +187,78 @@ KOKKOS_FUNCTION void BDFStep(ode_type& ode, const table_type& table,
 
   // solver the nonlinear problem
   {
-    KokkosODE::Experimental::Newton::Solve(sys, param, jac, temp, y_new, rhs,
-                                           update, scale);
+    int jacobian_age = 0, num_jacobian_evals = 0;
+    NewtonIterate(sys, param, linear_solver, y_new, rhs, update, scale,
+                  jacobian_age, num_jacobian_evals);
   }
 
 }  // BDFStep
 
+template <class ode_type, class table_type, class vec_type, class mv_type,
+          class mat_type, class scalar_type>
+KOKKOS_FUNCTION void BDFStep(ode_type& ode, const table_type& table,
+                             scalar_type t, scalar_type dt,
+                             const vec_type& y_old, const vec_type& y_new,
+                             const vec_type& rhs, const vec_type& update,
+                             const vec_type& scale, const mv_type& y_vecs,
+                             const mat_type& temp, const mat_type& jac) {
+  const NewtonDenseLinearSolver<mat_type> linear_solver(jac, temp);
+  BDFStep(ode, table, t, dt, y_old, y_new, rhs, update, scale, y_vecs,
+          linear_solver);
+}  // BDFStep
+
+// Fixed time step BDF integration, the first order - 1 steps are taken
+// with RKF45 to fill the history in y_vecs.
+template <class ode_type, class table_type, class vec_type, class mv_type,
+          class linear_solver_type, class scalar_type>
+KOKKOS_FUNCTION void BDFFixedSolve(
+    const ode_type& ode, const table_type& table, const scalar_type t_start,
+    const scalar_type t_end, const int num_steps, const vec_type& y0,
+    const vec_type& y, const vec_type& rhs, const vec_type& update,
+    const vec_type& scale, const mv_type& y_vecs, const mv_type& kstack,
+    const linear_solver_type& linear_solver) {
+  const double dt = (t_end - t_start) / num_steps;
+  double t        = t_start;
+
+  // Load y0 into y_vecs(:, 0)
+  for (int eqIdx = 0; eqIdx < ode.neqs; ++eqIdx) {
+    y_vecs(eqIdx, 0) = y0(eqIdx);
+  }
+
+  // Compute initial start-up history vectors
+  // Using a non adaptive explicit method.
+  const int init_steps = table.order - 1;
+  if (num_steps < init_steps) {
+    return;
+  }
+  KokkosODE::Experimental::ODE_params params(table.order - 1);
+  const ButcherTableau<4, 5> rk_table;  // RKF45
+  for (int stepIdx = 0; stepIdx < init_steps; ++stepIdx) {
+    RKSolve(ode, rk_table, params, t, t + dt, y0, y, update, kstack);
+
+    for (int eqIdx = 0; eqIdx < ode.neqs; ++eqIdx) {
+      y_vecs(eqIdx, stepIdx + 1) = y(eqIdx);
+      y0(eqIdx)                  = y(eqIdx);
+    }
+    t += dt;
+  }
+
+  for (int stepIdx = init_steps; stepIdx < num_steps; ++stepIdx) {
+    BDFStep(ode, table, t, dt, y0, y, rhs, update, scale, y_vecs,
+            linear_solver);
+
+    // Update history
+    for (int eqIdx = 0; eqIdx < ode.neqs; ++eqIdx) {
+      y0(eqIdx) = y(eqIdx);
+      for (int orderIdx = 0; orderIdx < table.order - 1; ++orderIdx) {
+        y_vecs(eqIdx, orderIdx) = y_vecs(eqIdx, orderIdx + 1);
+      }
+      y_vecs(eqIdx, table.order - 1) = y(eqIdx);
+    }
+    t += dt;
+  }
+}  // BDFFixedSolve
+
 template <class mat_type, class scalar_type>
 KOKKOS_FUNCTION void compute_coeffs(const int order, const scalar_type factor,
                                     const mat_type& coeffs) {
@@ -290,16 +358,55 @@ KOKKOS_FUNCTION void initial_step_size(
   }
 }  // initial_step_size
 
+// Interpolating polynomial of the adaptive BDF method over its last step,
+// as in the BdfDenseOutput of scipy. With t the current time, dt the step
+// size and D(:, 0:order) the differences stored by BDFStep:
+//   y(t_out) = D(:, 0) + sum_{j=1}^{order} D(:, j)
+//              * prod_{m=0}^{j-1} (t_out - t + m*dt) / ((m + 1)*dt)
+// Only D is read, the interpolant can be evaluated in any other vector.
+template <class mat_type, class scalar_type>
+struct BDFInterpolant {
+  scalar_type t, dt;
+  int order;
+  mat_type D;
+
+  KOKKOS_FUNCTION
+  BDFInterpolant(const scalar_type t_, const scalar_type dt_,
+                 const int order_, const mat_type& D_)
+      : t(t_), dt(dt_), order(order_), D(D_) {}
+
+  template <class out_type>
+  KOKKOS_FUNCTION void operator()(const scalar_type t_out,
+                                  const out_type& y) const {
+    for (int eqIdx = 0; eqIdx < D.extent_int(0); ++eqIdx) {
+      y(eqIdx) = D(eqIdx, 0);
+    }
+    scalar_type prod = 1;
+    for (int orderIdx = 1; orderIdx < order + 1; ++orderIdx) {
+      prod *= (t_out - t + (orderIdx - 1) * dt) / (orderIdx * dt);
+      for (int eqIdx = 0; eqIdx < D.extent_int(0); ++eqIdx) {
+        y(eqIdx) += D(eqIdx, orderIdx) * prod;
+      }
+    }
+  }
+};
+
+// BDFStep with Jacobian lagging: the LU factors of the Newton matrix
+// I - dt * df/dy stored in temp are reused across Newton iterations and
+// time steps for up to max_jacobian_age Newton iterations. They are
+// refreshed when the Newton iterations converge slowly or, as in CVODE,
+// when dt changed by more than 30% since they were computed. jacobian_age
+// and jacobian_dt carry the state of the factors from one step to the next.
 template <class ode_type, class vec_type, class res_type, class mat_type,
           class scalar_type>
-KOKKOS_FUNCTION void BDFStep(ode_type& ode, scalar_type& t, scalar_type& dt,
-                             scalar_type t_end, int& order,
-                             int& num_equal_steps, const int max_newton_iters,
-                             const scalar_type atol, const scalar_type rtol,
-                             const scalar_type min_factor,
-                             const vec_type& y_old, const vec_type& y_new,
-                             const res_type& rhs, const res_type& update,
-                             const mat_type& temp, const mat_type& temp2) {
+KOKKOS_FUNCTION void BDFStep(
+    ode_type& ode, scalar_type& t, scalar_type& dt, scalar_type t_end,
+    int& order, int& num_equal_steps, const int max_newton_iters,
+    const scalar_type atol, const scalar_type rtol,
+    const scalar_type min_factor, const vec_type& y_old,
+    const vec_type& y_new, const res_type& rhs, const res_type& update,
+    const mat_type& temp, const mat_type& temp2, const int max_jacobian_age,
+    int& jacobian_age, scalar_type& jacobian_dt) {
   using newton_params = KokkosODE::Experimental::Newton_params;
 
   constexpr int max_order = 5;
@@ -339,12 +446,14 @@ KOKKOS_FUNCTION void BDFStep(ode_type& ode, scalar_type& t, scalar_type& dt,
   ++offset;  // Error estimate
   auto jac = Kokkos::subview(
       temp, Kokkos::ALL(),
-      Kokkos::pair<int, int>(offset, offset + ode.neqs));  // Jacobian matrix
+      Kokkos::pair<int, int>(offset + 1,
+                             offset + 1 + ode.neqs));  // Jacobian matrix
   offset += ode.neqs;
   auto tmp_gesv = Kokkos::subview(
       temp, Kokkos::ALL(),
       Kokkos::pair<int, int>(
-          offset, offset + ode.neqs + 4));  // Buffer space for gesv calculation
+          offset + 1,
+          offset + 1 + ode.neqs + 4));  // Buffer space for gesv calculation
   offset += ode.neqs + 4;
 
   auto coeffs =
@@ -361,7 +470,9 @@ KOKKOS_FUNCTION void BDFStep(ode_type& ode, scalar_type& t, scalar_type& dt,
   const newton_params param(
       max_newton_iters, atol,
       Kokkos::max(10 * Kokkos::ArithTraits<scalar_type>::eps() / rtol,
-                  Kokkos::min(0.03, Kokkos::sqrt(rtol))));
+                  Kokkos::min(0.03, Kokkos::sqrt(rtol))),
+      max_jacobian_age);
+  int num_jacobian_evals = 0;
 
   scalar_type max_step = Kokkos::ArithTraits<scalar_type>::max();
   scalar_type min_step = Kokkos::ArithTraits<scalar_type>::min();
@@ -415,13 +526,21 @@ KOKKOS_FUNCTION void BDFStep(ode_type& ode, scalar_type& t, scalar_type& dt,
 
     sys.compute_jac = true;
     sys.c           = dt / alpha[order];
-    sys.jacobian(y_new, jac);
+    if (max_jacobian_age > 1) {
+      // jac holds lagged factors, only request new ones if dt changed a lot
+      if (Kokkos::abs(dt / jacobian_dt - 1) > 0.3) jacobian_age = 0;
+    } else {
+      sys.jacobian(y_new, jac);
+    }
     sys.compute_jac = true;
     Kokkos::Experimental::local_deep_copy(y_new, y_predict);
     Kokkos::Experimental::local_deep_copy(update, 0);
+    const int prev_jacobian_evals = num_jacobian_evals;
     KokkosODE::Experimental::newton_solver_status newton_status =
         KokkosODE::Experimental::Newton::Solve(sys, param, jac, tmp_gesv, y_new,
-                                               rhs, update, scale);
+                                               rhs, update, scale, jacobian_age,
+                                               num_jacobian_evals);
+    if (num_jacobian_evals != prev_jacobian_evals) jacobian_dt = dt;
 
     for (int eqIdx = 0; eqIdx < sys.neqs; ++eqIdx) {
       update(eqIdx) = y_new(eqIdx) - y_predict(eqIdx);
@@ -526,6 +645,23 @@ KOKKOS_FUNCTION void BDFStep(ode_type& ode, scalar_type& t, scalar_type& dt,
 
 }  // BDFStep
 
+template <class ode_type, class vec_type, class res_type, class mat_type,
+          class scalar_type>
+KOKKOS_FUNCTION void BDFStep(ode_type& ode, scalar_type& t, scalar_type& dt,
+                             scalar_type t_end, int& order,
+                             int& num_equal_steps, const int max_newton_iters,
+                             const scalar_type atol, const scalar_type rtol,
+                             const scalar_type min_factor,
+                             const vec_type& y_old, const vec_type& y_new,
+                             const res_type& rhs, const res_type& update,
+                             const mat_type& temp, const mat_type& temp2) {
+  int jacobian_age        = 0;
+  scalar_type jacobian_dt = dt;
+  BDFStep(ode, t, dt, t_end, order, num_equal_steps, max_newton_iters, atol,
+          rtol, min_factor, y_old, y_new, rhs, update, temp, temp2, 1,
+          jacobian_age, jacobian_dt);
+}  // BDFStep
+
 }  // namespace Impl
 }  // namespace KokkosODE
 
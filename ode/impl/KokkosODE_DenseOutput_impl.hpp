@@ -0,0 +1,131 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSODE_DENSEOUTPUT_IMPL_HPP
+#define KOKKOSODE_DENSEOUTPUT_IMPL_HPP
+
+#include "Kokkos_Core.hpp"
+#include "Kokkos_ArithTraits.hpp"
+
+namespace KokkosODE {
+namespace Impl {
+
+// Event type used when the integration is not monitoring any event
+struct NoEvent {};
+
+// Cubic Hermite interpolant of the solution over the step [t0, t0 + dt]
+// built from the solution and its derivative at both ends of the step:
+//   y(t0 + theta*dt) = (1 - theta)*y0 + theta*y1
+//       + theta*(theta - 1)*((1 - 2*theta)*(y1 - y0)
+//                            + (theta - 1)*dt*f0 + theta*dt*f1)
+// It is third order accurate and does not require any evaluation of the
+// right hand side on top of the ones done by the integrator.
+template <class vec_type, class f_type, class scalar_type>
+struct HermiteInterpolant {
+  scalar_type t0, dt;
+  vec_type y0, y1;
+  f_type f0, f1;
+
+  KOKKOS_FUNCTION
+  HermiteInterpolant(const scalar_type t0_, const scalar_type dt_,
+                     const vec_type& y0_, const vec_type& y1_,
+                     const f_type& f0_, const f_type& f1_)
+      : t0(t0_), dt(dt_), y0(y0_), y1(y1_), f0(f0_), f1(f1_) {}
+
+  template <class out_type>
+  KOKKOS_FUNCTION void operator()(const scalar_type t,
+                                  const out_type& y) const {
+    const scalar_type theta = (t - t0) / dt;
+    for (int eqIdx = 0; eqIdx < y0.extent_int(0); ++eqIdx) {
+      const scalar_type dy = y1(eqIdx) - y0(eqIdx);
+      y(eqIdx) = y0(eqIdx) + theta * dy +
+                 theta * (theta - 1) *
+                     ((1 - 2 * theta) * dy + (theta - 1) * dt * f0(eqIdx) +
+                      theta * dt * f1(eqIdx));
+    }
+  }
+};
+
+// Interpolate the solution at the output times t_out(next_out), ... that
+// are not past t_new and store it in the matching rows of y_out.
+// next_out is advanced past the times that have been processed.
+template <class interpolant_type, class times_type, class out_type,
+          class scalar_type>
+KOKKOS_FUNCTION void dense_output(const interpolant_type& interp,
+                                  const scalar_type t_new,
+                                  const times_type& t_out,
+                                  const out_type& y_out, int& next_out) {
+  while ((next_out < t_out.extent_int(0)) && (t_out(next_out) <= t_new)) {
+    auto y = Kokkos::subview(y_out, next_out, Kokkos::ALL());
+    interp(t_out(next_out), y);
+    ++next_out;
+  }
+}
+
+// An event occurs when its function changes sign or reaches zero
+// over a step, a step starting at zero does not trigger the event again.
+template <class scalar_type>
+KOKKOS_FUNCTION bool event_crossed(const scalar_type g_old,
+                                   const scalar_type g_new) {
+  return ((g_old < 0) && (0 <= g_new)) || ((0 < g_old) && (g_new <= 0));
+}
+
+// Locate the root of event(t, y(t)) in [t_a, t_b] with the Illinois
+// variant of the regula falsi, y(t) being given by the interpolant so no
+// right hand side evaluation is needed. g_a and g_b are the values of the
+// event at t_a and t_b and must bracket the root. The returned time is the
+// end of the final bracket that is past the root (within round-off of the
+// root) and y_event holds the interpolated solution at that time.
+template <class interpolant_type, class event_type, class vec_type,
+          class scalar_type>
+KOKKOS_FUNCTION scalar_type locate_event(const interpolant_type& interp,
+                                         const event_type& event,
+                                         scalar_type t_a, scalar_type g_a,
+                                         scalar_type t_b, scalar_type g_b,
+                                         const vec_type& y_event) {
+  using KAT               = Kokkos::ArithTraits<scalar_type>;
+  constexpr int max_iters = 100;
+  const scalar_type t_tol = 4 * KAT::eps() * (KAT::abs(t_a) + KAT::abs(t_b));
+  int retained_side       = 0;
+
+  for (int iter = 0; (iter < max_iters) && (t_tol < t_b - t_a) && (g_b != 0);
+       ++iter) {
+    const scalar_type t_c = (t_a * g_b - t_b * g_a) / (g_b - g_a);
+    interp(t_c, y_event);
+    const scalar_type g_c = event(t_c, y_event);
+
+    if ((g_c == 0) || ((g_c < 0) == (g_b < 0))) {
+      t_b = t_c;
+      g_b = g_c;
+      // t_a was kept twice in a row, halve its weight
+      if (retained_side == -1) g_a = g_a / 2;
+      retained_side = -1;
+    } else {
+      t_a = t_c;
+      g_a = g_c;
+      if (retained_side == 1) g_b = g_b / 2;
+      retained_side = 1;
+    }
+  }
+
+  interp(t_b, y_event);
+  return t_b;
+}
+
+}  // namespace Impl
+}  // namespace KokkosODE
+
+#endif  // KOKKOSODE_DENSEOUTPUT_IMPL_HPP
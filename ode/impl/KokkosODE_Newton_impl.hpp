@@ -21,21 +21,346 @@
 #include "KokkosBatched_LU_Decl.hpp"
 #include "KokkosBatched_LU_Serial_Impl.hpp"
 #include "KokkosBatched_Gesv.hpp"
+#include "KokkosBatched_Trsm_Decl.hpp"
+#include "KokkosBatched_Vector.hpp"
 #include "KokkosBlas1_nrm2.hpp"
 #include "KokkosBlas1_scal.hpp"
 #include "KokkosBlas1_axpby.hpp"
 
 #include "KokkosODE_Types.hpp"
+#include "KokkosODE_SparseJacobian_impl.hpp"
 
 namespace KokkosODE {
 namespace Impl {
 
-template <class system_type, class mat_type, class ini_vec_type,
-          class rhs_vec_type, class update_type, class scale_type>
-KOKKOS_FUNCTION KokkosODE::Experimental::newton_solver_status NewtonSolve(
+// LU factorization with partial pivoting, P*A = L*U, of the square
+// matrix A in place. The row exchanged with row k is stored in piv(k);
+// piv has the value type of A so that it can be a column of the work
+// matrix of the solver. Returns 1 if a pivot is exactly zero.
+template <class mat_type, class piv_type>
+KOKKOS_FUNCTION int DenseLUFactor(const mat_type& A, const piv_type& piv) {
+  using value_type = typename mat_type::non_const_value_type;
+  using KAT        = Kokkos::ArithTraits<value_type>;
+
+  const int n = A.extent_int(0);
+  int stat    = 0;
+  for (int k = 0; k < n; ++k) {
+    int pivIdx = k;
+    for (int rowIdx = k + 1; rowIdx < n; ++rowIdx) {
+      if (KAT::abs(A(rowIdx, k)) > KAT::abs(A(pivIdx, k))) pivIdx = rowIdx;
+    }
+    piv(k) = pivIdx;
+    if (pivIdx != k) {
+      for (int colIdx = 0; colIdx < n; ++colIdx) {
+        const value_type tmp = A(k, colIdx);
+        A(k, colIdx)         = A(pivIdx, colIdx);
+        A(pivIdx, colIdx)    = tmp;
+      }
+    }
+    if (A(k, k) == KAT::zero()) {
+      stat = 1;
+      continue;
+    }
+    for (int rowIdx = k + 1; rowIdx < n; ++rowIdx) {
+      A(rowIdx, k) /= A(k, k);
+      for (int colIdx = k + 1; colIdx < n; ++colIdx) {
+        A(rowIdx, colIdx) -= A(rowIdx, k) * A(k, colIdx);
+      }
+    }
+  }
+  return stat;
+}  // DenseLUFactor
+
+// Solve A*x = b in place with the factors and pivots computed by
+// DenseLUFactor.
+template <class mat_type, class piv_type, class vec_type>
+KOKKOS_FUNCTION void DenseLUSolve(const mat_type& A, const piv_type& piv,
+                                  const vec_type& x) {
+  using value_type = typename vec_type::non_const_value_type;
+
+  for (int k = 0; k < A.extent_int(0); ++k) {
+    const int pivIdx = static_cast<int>(piv(k));
+    if (pivIdx != k) {
+      const value_type tmp = x(k);
+      x(k)                 = x(pivIdx);
+      x(pivIdx)            = tmp;
+    }
+  }
+  KokkosBatched::SerialTrsm<
+      KokkosBatched::Side::Left, KokkosBatched::Uplo::Lower,
+      KokkosBatched::Trans::NoTranspose, KokkosBatched::Diag::Unit,
+      KokkosBatched::Algo::Level3::Unblocked>::invoke(1.0, A, x);
+  KokkosBatched::SerialTrsm<
+      KokkosBatched::Side::Left, KokkosBatched::Uplo::Upper,
+      KokkosBatched::Trans::NoTranspose, KokkosBatched::Diag::NonUnit,
+      KokkosBatched::Algo::Level3::Unblocked>::invoke(1.0, A, x);
+}  // DenseLUSolve
+
+// Linear solver of the Newton iterations using the dense Jacobian
+// computed by sys.jacobian
+template <class mat_type>
+struct NewtonDenseLinearSolver {
+  const mat_type J, tmp;
+
+  KOKKOS_FUNCTION
+  NewtonDenseLinearSolver(const mat_type& J_, const mat_type& tmp_)
+      : J(J_), tmp(tmp_) {}
+
+  // Solve J*update = rhs where J is the Jacobian of sys at y0.
+  template <class system_type, class vec_type, class rhs_vec_type,
+            class update_type>
+  KOKKOS_FUNCTION int solve(
+      const system_type& sys,
+      const KokkosODE::Experimental::Newton_params& params, const vec_type& y0,
+      const rhs_vec_type& rhs, const update_type& update, int& jacobian_age,
+      int& num_jacobian_evals) const {
+    // With lagging, J stores the LU factors of the Jacobian between
+    // iterations and between calls, jacobian_age counts the iterations
+    // since they were computed (0 requests new ones). The pivots of the
+    // factors are kept in the first column of tmp.
+    const bool lag_jacobian = params.max_jacobian_age > 1;
+
+    int linSolverStat = 0;
+    if constexpr (KokkosBatched::is_vector<
+                      typename mat_type::non_const_value_type>::value) {
+      // The lanes of SIMD systems cannot exchange rows independently, their
+      // Jacobian is factored without pivoting.
+      if (!lag_jacobian || (jacobian_age == 0) ||
+          (params.max_jacobian_age <= jacobian_age)) {
+        sys.jacobian(y0, J);
+        linSolverStat =
+            KokkosBatched::SerialLU<KokkosBatched::Algo::Level3::Unblocked>::
+                invoke(J);
+        if (lag_jacobian) {
+          jacobian_age = 0;
+          ++num_jacobian_evals;
+        }
+      }
+      if (lag_jacobian) ++jacobian_age;
+
+      for (int idx = 0; idx < sys.neqs; ++idx) {
+        update(idx) = rhs(idx);
+      }
+      KokkosBatched::SerialTrsm<
+          KokkosBatched::Side::Left, KokkosBatched::Uplo::Lower,
+          KokkosBatched::Trans::NoTranspose, KokkosBatched::Diag::Unit,
+          KokkosBatched::Algo::Level3::Unblocked>::invoke(1.0, J, update);
+      KokkosBatched::SerialTrsm<
+          KokkosBatched::Side::Left, KokkosBatched::Uplo::Upper,
+          KokkosBatched::Trans::NoTranspose, KokkosBatched::Diag::NonUnit,
+          KokkosBatched::Algo::Level3::Unblocked>::invoke(1.0, J, update);
+    } else if (lag_jacobian) {
+      auto piv = Kokkos::subview(tmp, Kokkos::ALL(), 0);
+
+      // compute and factor LHS only if the factors are missing or too old
+      if ((jacobian_age == 0) || (params.max_jacobian_age <= jacobian_age)) {
+        sys.jacobian(y0, J);
+        linSolverStat = DenseLUFactor(J, piv);
+        jacobian_age  = 0;
+        ++num_jacobian_evals;
+      }
+      ++jacobian_age;
+
+      // solve linear problem with the factors
+      for (int idx = 0; idx < sys.neqs; ++idx) {
+        update(idx) = rhs(idx);
+      }
+      DenseLUSolve(J, piv, update);
+    } else {
+      // compute LHS
+      sys.jacobian(y0, J);
+
+      // solve linear problem
+      linSolverStat = KokkosBatched::SerialGesv<
+          KokkosBatched::Gesv::StaticPivoting>::invoke(J, update, rhs, tmp);
+    }
+    return linSolverStat;
+  }
+};
+
+// Linear solver of the Newton iterations using a sparse Jacobian computed
+// by colored finite differences of sys.residual and factored by a sparse
+// LU, see KokkosODE::Experimental::SparseJacobian. r_pert and y_save are
+// work vectors used by the finite differences.
+template <class jac_type, class values_type, class work_type>
+struct NewtonSparseLinearSolver {
+  const jac_type jac;
+  const values_type values;
+  const work_type r_pert, y_save;
+
+  KOKKOS_FUNCTION
+  NewtonSparseLinearSolver(const jac_type& jac_, const values_type& values_,
+                           const work_type& r_pert_, const work_type& y_save_)
+      : jac(jac_), values(values_), r_pert(r_pert_), y_save(y_save_) {}
+
+  // Solve J*update = rhs where J is the Jacobian of sys at y0 and rhs the
+  // residual at y0.
+  template <class system_type, class vec_type, class rhs_vec_type,
+            class update_type>
+  KOKKOS_FUNCTION int solve(
+      const system_type& sys,
+      const KokkosODE::Experimental::Newton_params& params, const vec_type& y0,
+      const rhs_vec_type& rhs, const update_type& update, int& jacobian_age,
+      int& num_jacobian_evals) const {
+    const bool lag_jacobian = params.max_jacobian_age > 1;
+
+    int linSolverStat = 0;
+    if (!lag_jacobian || (jacobian_age == 0) ||
+        (params.max_jacobian_age <= jacobian_age)) {
+      SparseJacobianFD(sys, jac, y0, rhs, r_pert, y_save, values);
+      linSolverStat = SparseLUFactor(jac, values) > 0 ? 1 : 0;
+      if (lag_jacobian) {
+        jacobian_age = 0;
+        ++num_jacobian_evals;
+      }
+    }
+    if (lag_jacobian) ++jacobian_age;
+
+    for (int idx = 0; idx < sys.neqs; ++idx) {
+      update(idx) = rhs(idx);
+    }
+    SparseLUSolve(jac, values, update);
+    return linSolverStat;
+  }
+};
+
+// Newton iterations on vector_length independent systems stored in the
+// lanes of KokkosBatched::Vector<SIMD<T>, vector_length> entries. The
+// residuals and linear solves are computed for all the lanes at once, each
+// lane tests its own convergence as NewtonIterate does for one system and
+// stops moving, i.e. its update is zeroed, once it has converged or failed.
+// Returns NLS_SUCCESS if all the lanes converged, the status of the first
+// lane that did not otherwise.
+template <class system_type, class linear_solver_type, class ini_vec_type,
+          class rhs_vec_type, class update_type, class scale_type,
+          class entry_type = typename ini_vec_type::non_const_value_type,
+          std::enable_if_t<KokkosBatched::is_vector<entry_type>::value,
+                           bool> = true>
+KOKKOS_FUNCTION KokkosODE::Experimental::newton_solver_status NewtonIterate(
     system_type& sys, const KokkosODE::Experimental::Newton_params& params,
-    mat_type& J, mat_type& tmp, ini_vec_type& y0, rhs_vec_type& rhs,
-    update_type& update, const scale_type& scale) {
+    const linear_solver_type& linear_solver, ini_vec_type& y0,
+    rhs_vec_type& rhs, update_type& update, const scale_type& scale,
+    int& jacobian_age, int& num_jacobian_evals) {
+  using newton_solver_status = KokkosODE::Experimental::newton_solver_status;
+  using simd_type            = typename ini_vec_type::non_const_value_type;
+  using norm_type            = typename simd_type::mag_type;
+  using KAT                  = Kokkos::ArithTraits<norm_type>;
+  constexpr int nlanes       = simd_type::vector_length;
+
+  // rms norm of the scaled update and 2-norms of rhs and update of a lane
+  auto lane_norms = [&](const int lane, norm_type& norm, norm_type& norm_new,
+                        norm_type& norm_update) {
+    norm = norm_new = norm_update = KAT::zero();
+    for (int idx = 0; idx < sys.neqs; ++idx) {
+      const norm_type r = Kokkos::abs(rhs(idx)[lane]);
+      const norm_type u = Kokkos::abs(update(idx)[lane]);
+      const norm_type s = Kokkos::abs(scale(idx)[lane]);
+      norm += r * r;
+      norm_update += u * u;
+      norm_new += (u * u) / (s * s);
+    }
+    norm        = Kokkos::sqrt(norm);
+    norm_update = Kokkos::sqrt(norm_update);
+    norm_new    = Kokkos::sqrt(norm_new / sys.neqs);
+  };
+
+  const norm_type tol =
+      Kokkos::max(10 * KAT::eps() / params.rel_tol,
+                  Kokkos::min(0.03, Kokkos::sqrt(params.rel_tol)));
+  const bool lag_jacobian = params.max_jacobian_age > 1;
+
+  norm_type norm0[nlanes], norm_old[nlanes];
+  newton_solver_status lane_status[nlanes];
+  bool done[nlanes];
+  sys.residual(y0, rhs);
+  for (int lane = 0; lane < nlanes; ++lane) {
+    norm0[lane] = KAT::zero();
+    for (int idx = 0; idx < sys.neqs; ++idx) {
+      const norm_type r = Kokkos::abs(rhs(idx)[lane]);
+      norm0[lane] += r * r;
+    }
+    norm0[lane]       = Kokkos::sqrt(norm0[lane]);
+    norm_old[lane]    = KAT::zero();
+    lane_status[lane] = newton_solver_status::MAX_ITER;
+    done[lane]        = false;
+  }
+
+  int num_active = nlanes;
+  for (int it = 0; (it < params.max_iters) && (0 < num_active); ++it) {
+    sys.residual(y0, rhs);
+
+    const int linSolverStat =
+        linear_solver.solve(sys, params, y0, rhs, update, jacobian_age,
+                            num_jacobian_evals);
+
+    // x = x - update on the lanes that are still iterating
+    for (int idx = 0; idx < sys.neqs; ++idx) {
+      for (int lane = 0; lane < nlanes; ++lane) {
+        update(idx)[lane] = done[lane] ? 0 : -update(idx)[lane];
+      }
+      y0(idx) += update(idx);
+    }
+
+    num_active = 0;
+    for (int lane = 0; lane < nlanes; ++lane) {
+      if (done[lane]) continue;
+      norm_type norm, norm_new, norm_update;
+      lane_norms(lane, norm, norm_new, norm_update);
+
+      done[lane] = true;
+      if ((it > 0) && norm_old[lane] > KAT::zero()) {
+        const norm_type rate = norm_new / norm_old[lane];
+        if (lag_jacobian && (jacobian_age > 1) &&
+            (rate > params.jacobian_rate_threshold)) {
+          // slow convergence with lagged factors: refresh them
+          // at the next iteration instead of giving up.
+          jacobian_age = 0;
+        } else if ((rate >= 1) ||
+                   Kokkos::pow(rate, params.max_iters - it) / (1 - rate) *
+                           norm_new >
+                       tol) {
+          lane_status[lane] = newton_solver_status::NLS_DIVERGENCE;
+          continue;
+        } else if ((norm_new == 0) || ((rate / (1 - rate)) * norm_new < tol)) {
+          lane_status[lane] = newton_solver_status::NLS_SUCCESS;
+          continue;
+        }
+      }
+
+      if (linSolverStat == 1) {
+        lane_status[lane] = newton_solver_status::LIN_SOLVE_FAIL;
+        continue;
+      }
+
+      if ((norm < (params.rel_tol * norm0[lane])) ||
+          (it > 0 ? norm_update < params.abs_tol : false)) {
+        lane_status[lane] = newton_solver_status::NLS_SUCCESS;
+        continue;
+      }
+
+      norm_old[lane] = norm_new;
+      done[lane]     = false;
+      ++num_active;
+    }
+  }
+
+  for (int lane = 0; lane < nlanes; ++lane) {
+    if (lane_status[lane] != newton_solver_status::NLS_SUCCESS)
+      return lane_status[lane];
+  }
+  return newton_solver_status::NLS_SUCCESS;
+}
+
+template <class system_type, class linear_solver_type, class ini_vec_type,
+          class rhs_vec_type, class update_type, class scale_type,
+          class entry_type = typename ini_vec_type::non_const_value_type,
+          std::enable_if_t<!KokkosBatched::is_vector<entry_type>::value,
+                           bool> = true>
+KOKKOS_FUNCTION KokkosODE::Experimental::newton_solver_status NewtonIterate(
+    system_type& sys, const KokkosODE::Experimental::Newton_params& params,
+    const linear_solver_type& linear_solver, ini_vec_type& y0,
+    rhs_vec_type& rhs, update_type& update, const scale_type& scale,
+    int& jacobian_age, int& num_jacobian_evals) {
   using newton_solver_status = KokkosODE::Experimental::newton_solver_status;
   using value_type           = typename ini_vec_type::non_const_value_type;
 
@@ -60,6 +385,8 @@ KOKKOS_FUNCTION KokkosODE::Experimental::newton_solver_status NewtonSolve(
   // improve convergence for difficult problems.
   const value_type alpha = Kokkos::ArithTraits<value_type>::one();
 
+  const bool lag_jacobian = params.max_jacobian_age > 1;
+
   // Iterate until maxIts or the tolerance is reached
   for (int it = 0; it < params.max_iters; ++it) {  // handle.maxIters; ++it) {
     // compute initial rhs
@@ -69,13 +396,9 @@ KOKKOS_FUNCTION KokkosODE::Experimental::newton_solver_status NewtonSolve(
     // problem at each iteration: J*update=-rhs
     // with J=du/dx, rhs=f(u_n+update)-f(u_n)
 
-    // compute LHS
-    sys.jacobian(y0, J);
-
-    // solve linear problem
-    int linSolverStat =
-        KokkosBatched::SerialGesv<KokkosBatched::Gesv::StaticPivoting>::invoke(
-            J, update, rhs, tmp);
+    const int linSolverStat =
+        linear_solver.solve(sys, params, y0, rhs, update, jacobian_age,
+                            num_jacobian_evals);
     KokkosBlas::SerialScale::invoke(-1, update);
 
     // update solution // x = x + alpha*update
@@ -83,13 +406,19 @@ KOKKOS_FUNCTION KokkosODE::Experimental::newton_solver_status NewtonSolve(
     norm = KokkosBlas::serial_nrm2(rhs);
 
     // Compute rms norm of the scaled update
+    norm_new = Kokkos::ArithTraits<norm_type>::zero();
     for (int idx = 0; idx < sys.neqs; ++idx) {
-      norm_new = (update(idx) * update(idx)) / (scale(idx) * scale(idx));
+      norm_new += (update(idx) * update(idx)) / (scale(idx) * scale(idx));
     }
     norm_new = Kokkos::sqrt(norm_new / sys.neqs);
     if ((it > 0) && norm_old > Kokkos::ArithTraits<norm_type>::zero()) {
       rate = norm_new / norm_old;
-      if ((rate >= 1) ||
+      if (lag_jacobian && (jacobian_age > 1) &&
+          (rate > params.jacobian_rate_threshold)) {
+        // slow convergence with lagged factors: refresh them
+        // at the next iteration instead of giving up.
+        jacobian_age = 0;
+      } else if ((rate >= 1) ||
           Kokkos::pow(rate, params.max_iters - it) / (1 - rate) * norm_new >
               tol) {
         return newton_solver_status::NLS_DIVERGENCE;
@@ -118,6 +447,213 @@ KOKKOS_FUNCTION KokkosODE::Experimental::newton_solver_status NewtonSolve(
   return newton_solver_status::MAX_ITER;
 }
 
+template <class system_type, class mat_type, class ini_vec_type,
+          class rhs_vec_type, class update_type, class scale_type>
+KOKKOS_FUNCTION KokkosODE::Experimental::newton_solver_status NewtonSolve(
+    system_type& sys, const KokkosODE::Experimental::Newton_params& params,
+    mat_type& J, mat_type& tmp, ini_vec_type& y0, rhs_vec_type& rhs,
+    update_type& update, const scale_type& scale, int& jacobian_age,
+    int& num_jacobian_evals) {
+  NewtonDenseLinearSolver<mat_type> linear_solver(J, tmp);
+  return NewtonIterate(sys, params, linear_solver, y0, rhs, update, scale,
+                       jacobian_age, num_jacobian_evals);
+}
+
+template <class system_type, class jac_type, class values_type,
+          class work_type, class ini_vec_type, class rhs_vec_type,
+          class update_type, class scale_type>
+KOKKOS_FUNCTION KokkosODE::Experimental::newton_solver_status NewtonSolve(
+    system_type& sys, const KokkosODE::Experimental::Newton_params& params,
+    const jac_type& jac, const values_type& values, const work_type& r_pert,
+    const work_type& y_save, ini_vec_type& y0, rhs_vec_type& rhs,
+    update_type& update, const scale_type& scale, int& jacobian_age,
+    int& num_jacobian_evals) {
+  NewtonSparseLinearSolver<jac_type, values_type, work_type> linear_solver(
+      jac, values, r_pert, y_save);
+  return NewtonIterate(sys, params, linear_solver, y0, rhs, update, scale,
+                       jacobian_age, num_jacobian_evals);
+}
+
+// Loop over the equations of a system solved by a team: over the threads
+// of the team with Mode::Team, over the threads and their vector lanes
+// with Mode::TeamVector.
+template <class ArgMode, class MemberType, class functor_type>
+KOKKOS_INLINE_FUNCTION void TeamNewtonFor(const MemberType& member,
+                                          const int n, const functor_type& f) {
+  if constexpr (std::is_same_v<ArgMode, KokkosBatched::Mode::TeamVector>) {
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(member, n), f);
+  } else {
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(member, n), f);
+  }
+}
+
+// Same as TeamNewtonFor for a sum, returned to all the threads of the team.
+template <class ArgMode, class MemberType, class functor_type,
+          class value_type>
+KOKKOS_INLINE_FUNCTION void TeamNewtonSum(const MemberType& member,
+                                          const int n, const functor_type& f,
+                                          value_type& sum) {
+  if constexpr (std::is_same_v<ArgMode, KokkosBatched::Mode::TeamVector>) {
+    Kokkos::parallel_reduce(Kokkos::TeamVectorRange(member, n), f, sum);
+  } else {
+    Kokkos::parallel_reduce(Kokkos::TeamThreadRange(member, n), f, sum);
+  }
+}
+
+// Newton iterations on one system solved by all the threads of a team,
+// see KokkosODE::Experimental::TeamNewton. The Jacobian J is overwritten
+// by its factorization, the factors are stored in F and piv where they
+// stay between iterations and solves when they are lagged. The residual
+// at the end of an accepted step is kept in rhs for the next iteration,
+// so the line search only costs additional residual evaluations when it
+// shortens a step.
+template <class ArgMode, class MemberType, class system_type, class mat_type,
+          class factor_type, class piv_type, class ini_vec_type,
+          class rhs_vec_type, class update_type, class scale_type>
+KOKKOS_FUNCTION KokkosODE::Experimental::newton_solver_status TeamNewtonSolve(
+    const MemberType& member, const system_type& sys,
+    const KokkosODE::Experimental::Newton_params& params, const mat_type& J,
+    const factor_type& F, const piv_type& piv, const ini_vec_type& y0,
+    const rhs_vec_type& rhs, const update_type& update,
+    const scale_type& scale, int& jacobian_age, int& num_jacobian_evals) {
+  using newton_solver_status = KokkosODE::Experimental::newton_solver_status;
+  using value_type           = typename ini_vec_type::non_const_value_type;
+  using norm_type = typename Kokkos::ArithTraits<value_type>::mag_type;
+  using KAT       = Kokkos::ArithTraits<norm_type>;
+  using VKAT      = Kokkos::ArithTraits<value_type>;
+  using pivoting  = KokkosBatched::Gesv::StaticPivoting;
+  constexpr bool team_vector =
+      std::is_same_v<ArgMode, KokkosBatched::Mode::TeamVector>;
+  using factorize_type = std::conditional_t<
+      team_vector, KokkosBatched::TeamVectorGesvFactorize<MemberType, pivoting>,
+      KokkosBatched::TeamGesvFactorize<MemberType, pivoting>>;
+  using solve_type = std::conditional_t<
+      team_vector, KokkosBatched::TeamVectorGesvSolve<MemberType, pivoting>,
+      KokkosBatched::TeamGesvSolve<MemberType, pivoting>>;
+
+  const int neqs = sys.neqs;
+
+  auto residual_norm = [&]() {
+    norm_type sum = KAT::zero();
+    TeamNewtonSum<ArgMode>(
+        member, neqs,
+        [&](const int idx, norm_type& lsum) {
+          const norm_type r = VKAT::abs(rhs(idx));
+          lsum += r * r;
+        },
+        sum);
+    return Kokkos::sqrt(sum);
+  };
+
+  const norm_type tol =
+      Kokkos::max(10 * KAT::eps() / params.rel_tol,
+                  Kokkos::min(0.03, Kokkos::sqrt(params.rel_tol)));
+  const bool lag_jacobian = params.max_jacobian_age > 1;
+
+  sys.residual(member, y0, rhs);
+  member.team_barrier();
+  const norm_type norm0 = residual_norm();
+  norm_type norm = norm0, norm_old = KAT::zero();
+
+  for (int it = 0; it < params.max_iters; ++it) {
+    // compute and factor the Jacobian unless lagged factors are reused
+    int linSolverStat = 0;
+    if (!lag_jacobian || (jacobian_age == 0) ||
+        (params.max_jacobian_age <= jacobian_age)) {
+      sys.jacobian(member, y0, J);
+      member.team_barrier();
+      linSolverStat = factorize_type::invoke(member, J, F, piv);
+      if (lag_jacobian) {
+        jacobian_age = 0;
+        ++num_jacobian_evals;
+      }
+    }
+    if (lag_jacobian) ++jacobian_age;
+    if (linSolverStat == 1) {
+      Kokkos::single(Kokkos::PerTeam(member), [&]() {
+#if KOKKOS_VERSION < 40199
+        KOKKOS_IMPL_DO_NOT_USE_PRINTF(
+            "TeamNewton: Linear solve gesv returned failure! \n");
+#else
+        Kokkos::printf("TeamNewton: Linear solve gesv returned failure! \n");
+#endif
+      });
+      return newton_solver_status::LIN_SOLVE_FAIL;
+    }
+    solve_type::invoke(member, F, piv, update, rhs);
+
+    // y0 = y0 - alpha*update, alpha is shortened until the residual norm
+    // decreases enough
+    const norm_type norm_prev = norm;
+    norm_type alpha           = KAT::one();
+    TeamNewtonFor<ArgMode>(member, neqs,
+                           [&](const int idx) { y0(idx) -= update(idx); });
+    member.team_barrier();
+    sys.residual(member, y0, rhs);
+    member.team_barrier();
+    norm = residual_norm();
+    for (int lsIdx = 0;
+         (lsIdx < params.max_line_search_iters) &&
+         !(norm <= (1 - params.line_search_decrease * alpha) * norm_prev);
+         ++lsIdx) {
+      const norm_type alpha_new = params.line_search_reduction * alpha;
+      TeamNewtonFor<ArgMode>(member, neqs, [&](const int idx) {
+        y0(idx) += (alpha - alpha_new) * update(idx);
+      });
+      member.team_barrier();
+      sys.residual(member, y0, rhs);
+      member.team_barrier();
+      norm  = residual_norm();
+      alpha = alpha_new;
+    }
+
+    // rms norm of the scaled step and 2-norm of the step
+    norm_type norm_new = KAT::zero(), norm_update = KAT::zero();
+    TeamNewtonSum<ArgMode>(
+        member, neqs,
+        [&](const int idx, norm_type& lsum) {
+          const norm_type u = VKAT::abs(update(idx));
+          const norm_type d = VKAT::abs(scale(idx));
+          lsum += (u * u) / (d * d);
+        },
+        norm_new);
+    TeamNewtonSum<ArgMode>(
+        member, neqs,
+        [&](const int idx, norm_type& lsum) {
+          const norm_type u = VKAT::abs(update(idx));
+          lsum += u * u;
+        },
+        norm_update);
+    norm_new    = alpha * Kokkos::sqrt(norm_new / neqs);
+    norm_update = alpha * Kokkos::sqrt(norm_update);
+
+    if ((it > 0) && norm_old > KAT::zero()) {
+      const norm_type rate = norm_new / norm_old;
+      if (lag_jacobian && (jacobian_age > 1) &&
+          (rate > params.jacobian_rate_threshold)) {
+        // slow convergence with lagged factors: refresh them
+        // at the next iteration instead of giving up.
+        jacobian_age = 0;
+      } else if ((rate >= 1) ||
+                 Kokkos::pow(rate, params.max_iters - it) / (1 - rate) *
+                         norm_new >
+                     tol) {
+        return newton_solver_status::NLS_DIVERGENCE;
+      } else if ((norm_new == 0) || ((rate / (1 - rate)) * norm_new < tol)) {
+        return newton_solver_status::NLS_SUCCESS;
+      }
+    }
+
+    if ((norm < (params.rel_tol * norm0)) ||
+        (it > 0 ? norm_update < params.abs_tol : false)) {
+      return newton_solver_status::NLS_SUCCESS;
+    }
+
+    norm_old = norm_new;
+  }
+  return newton_solver_status::MAX_ITER;
+}  // TeamNewtonSolve
+
 }  // namespace Impl
 }  // namespace KokkosODE
 
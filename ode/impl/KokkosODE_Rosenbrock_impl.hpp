@@ -0,0 +1,258 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSODE_ROSENBROCK_IMPL_HPP
+#define KOKKOSODE_ROSENBROCK_IMPL_HPP
+
+#include "Kokkos_Core.hpp"
+#include "KokkosBatched_LU_Decl.hpp"
+#include "KokkosBatched_LU_Serial_Impl.hpp"
+#include "KokkosBatched_Trsm_Decl.hpp"
+
+#include "KokkosODE_Types.hpp"
+
+namespace KokkosODE {
+namespace Impl {
+//=====================================================================
+// Rosenbrock (linearly implicit Runge-Kutta) ODE solver with embedded
+// error estimation
+//=====================================================================
+
+// Methods supported:
+// ROS2, L-stable order 2 method
+// ROS3, L-stable order 3 method
+// RODAS3, stiffly accurate order 3 method
+
+// The coefficients use the formulation of
+// Sandu, A., Verwer, J.G., Blom, J.G., Spee, E.J., Carmichael, G.R.,
+// Potra, F.A., "Benchmarking stiff ODE solvers for atmospheric chemistry
+// problems II: Rosenbrock solvers." Atmospheric Environment 31(20),
+// 3459-3472 (1997). https://doi.org/10.1016/S1352-2310(97)83212-8
+// where with W = I / (gamma*dt) - J each stage solves
+//
+//   W*k_i = f(t + alpha_i*dt, y_old + sum(a_{ij}*k_j))
+//           + sum(c_{ij}/dt*k_j)                   j in [1, i-1]
+//
+// and y_new = y_old + sum(m_i*k_i), err = sum(e_i*k_i).
+// The strictly lower triangular arrays a and c are ordered by rows as:
+// {a10,a20,a21,a30,a31,a32...}
+// 'order' refers to the order of the error estimator that is used to
+// control the time step.
+
+template <int variant>
+struct RosenbrockTableau {};
+
+template <>
+struct RosenbrockTableau<0>  // ROS2
+{
+  static constexpr int order   = 2;
+  static constexpr int nstages = 2;
+
+  static constexpr double g = 1.0 + 0.70710678118654752440084436210485;
+
+  double gamma = g;
+  Kokkos::Array<double, 1> a{{1.0 / g}};
+  Kokkos::Array<double, 1> c{{-2.0 / g}};
+  Kokkos::Array<double, nstages> m{{3.0 / (2.0 * g), 1.0 / (2.0 * g)}};
+  Kokkos::Array<double, nstages> e{{1.0 / (2.0 * g), 1.0 / (2.0 * g)}};
+  Kokkos::Array<double, nstages> alpha{{0.0, 1.0}};
+};
+
+template <>
+struct RosenbrockTableau<1>  // ROS3
+{
+  static constexpr int order   = 3;
+  static constexpr int nstages = 3;
+
+  double gamma = 0.43586652150845899941601945119356;
+  Kokkos::Array<double, 3> a{{1.0, 1.0, 0.0}};
+  Kokkos::Array<double, 3> c{{-0.10156171083877702091975600115545e+01,
+                              0.40759956452537699824805835358067e+01,
+                              0.92076794298330791242156818474003e+01}};
+  Kokkos::Array<double, nstages> m{{0.1e+01,
+                                    0.61697947043828245592553615689730e+01,
+                                    -0.42772256543218573326238373806514e+00}};
+  Kokkos::Array<double, nstages> e{{0.5e+00,
+                                    -0.29079558716805469821718236208017e+01,
+                                    0.22354069897811569627360909276199e+00}};
+  Kokkos::Array<double, nstages> alpha{
+      {0.0, 0.43586652150845899941601945119356,
+       0.43586652150845899941601945119356}};
+};
+
+template <>
+struct RosenbrockTableau<2>  // RODAS3
+{
+  static constexpr int order   = 3;
+  static constexpr int nstages = 4;
+
+  double gamma = 0.5;
+  Kokkos::Array<double, 6> a{{0.0, 2.0, 0.0, 2.0, 0.0, 1.0}};
+  Kokkos::Array<double, 6> c{{4.0, 1.0, -1.0, 1.0, -1.0, -8.0 / 3.0}};
+  Kokkos::Array<double, nstages> m{{2.0, 0.0, 1.0, 1.0}};
+  Kokkos::Array<double, nstages> e{{0.0, 0.0, 0.0, 1.0}};
+  Kokkos::Array<double, nstages> alpha{{0.0, 0.0, 1.0, 1.0}};
+};
+
+// Take one step of a Rosenbrock method: the Jacobian is evaluated and
+// W = I / (gamma*dt) - J is factored once, then each stage costs one
+// function evaluation and two triangular solves. The time derivative of
+// f is not included in the stages so the formal order of the method is
+// only obtained for autonomous systems.
+// On output y_new holds the new solution and temp the error estimate.
+template <class ode_type, class table_type, class vec_type, class mv_type,
+          class mat_type, class scalar_type>
+KOKKOS_FUNCTION int RosenbrockStep(const ode_type& ode, const table_type& table,
+                                   const scalar_type t, const scalar_type dt,
+                                   const vec_type& y_old, const vec_type& y_new,
+                                   const vec_type& temp, const mv_type& k_vecs,
+                                   const mat_type& jac) {
+  const int neqs    = ode.neqs;
+  const int nstages = table.nstages;
+
+  // Assemble and factor W = I / (gamma*dt) - J, the factorization does
+  // not pivot but W is dominated by its diagonal for the dt that stiff
+  // problems use and it is reused by all the stages.
+  ode.evaluate_jacobian(t, dt, y_old, jac);
+  for (int rowIdx = 0; rowIdx < neqs; ++rowIdx) {
+    for (int colIdx = 0; colIdx < neqs; ++colIdx) {
+      jac(rowIdx, colIdx) = -jac(rowIdx, colIdx);
+    }
+    jac(rowIdx, rowIdx) += 1 / (table.gamma * dt);
+  }
+  const int linSolverStat = KokkosBatched::SerialLU<
+      KokkosBatched::Algo::Level3::Unblocked>::invoke(jac);
+  if (linSolverStat != 0) return linSolverStat;
+
+  for (int stageIdx = 0; stageIdx < nstages; ++stageIdx) {
+    const int offset = stageIdx * (stageIdx - 1) / 2;
+
+    // Stage value: temp = y_old + sum(a_{ij}*k_j)
+    for (int eqIdx = 0; eqIdx < neqs; ++eqIdx) {
+      temp(eqIdx) = y_old(eqIdx);
+      for (int idx = 0; idx < stageIdx; ++idx) {
+        temp(eqIdx) += table.a[offset + idx] * k_vecs(idx, eqIdx);
+      }
+    }
+
+    // Right hand side: k_i = f(temp) + sum(c_{ij}/dt*k_j)
+    auto k = Kokkos::subview(k_vecs, stageIdx, Kokkos::ALL);
+    ode.evaluate_function(t + table.alpha[stageIdx] * dt, dt, temp, k);
+    for (int eqIdx = 0; eqIdx < neqs; ++eqIdx) {
+      for (int idx = 0; idx < stageIdx; ++idx) {
+        k(eqIdx) += table.c[offset + idx] / dt * k_vecs(idx, eqIdx);
+      }
+    }
+
+    KokkosBatched::SerialTrsm<
+        KokkosBatched::Side::Left, KokkosBatched::Uplo::Lower,
+        KokkosBatched::Trans::NoTranspose, KokkosBatched::Diag::Unit,
+        KokkosBatched::Algo::Level3::Unblocked>::invoke(1.0, jac, k);
+    KokkosBatched::SerialTrsm<
+        KokkosBatched::Side::Left, KokkosBatched::Uplo::Upper,
+        KokkosBatched::Trans::NoTranspose, KokkosBatched::Diag::NonUnit,
+        KokkosBatched::Algo::Level3::Unblocked>::invoke(1.0, jac, k);
+  }
+
+  for (int eqIdx = 0; eqIdx < neqs; ++eqIdx) {
+    y_new(eqIdx) = y_old(eqIdx);
+    temp(eqIdx)  = 0;
+    for (int stageIdx = 0; stageIdx < nstages; ++stageIdx) {
+      y_new(eqIdx) += table.m[stageIdx] * k_vecs(stageIdx, eqIdx);
+      temp(eqIdx) += table.e[stageIdx] * k_vecs(stageIdx, eqIdx);
+    }
+  }
+
+  return 0;
+}  // RosenbrockStep
+
+// Integrate the ode from t_start to t_end. Every attempted step, accepted
+// or rejected, counts towards params.max_steps so the amount of work done
+// per system is bounded.
+template <class ode_type, class table_type, class vec_type, class mv_type,
+          class mat_type, class scalar_type>
+KOKKOS_FUNCTION Experimental::ode_solver_status RosenbrockSolve(
+    const ode_type& ode, const table_type& table,
+    const KokkosODE::Experimental::ODE_params& params,
+    const scalar_type t_start, const scalar_type t_end, const vec_type& y0,
+    const vec_type& y, const vec_type& temp, const mv_type& k_vecs,
+    const mat_type& jac) {
+  scalar_type t_now = t_start;
+  scalar_type dt    = (t_end - t_start) / params.num_steps;
+  bool rejected     = false;
+
+  for (int stepIdx = 0; stepIdx < params.max_steps; ++stepIdx) {
+    // Land exactly on t_end, this also absorbs the round-off accumulated
+    // in t_now by fixed time steps.
+    const bool last_step = (t_end - t_now) < 1.0001 * dt;
+    if (last_step) {
+      dt = t_end - t_now;
+    }
+
+    if (RosenbrockStep(ode, table, t_now, dt, y0, y, temp, k_vecs, jac) != 0) {
+      // W is singular, retry with a smaller time step.
+      if (!params.adaptivity) return Experimental::ode_solver_status::MIN_SIZE;
+      dt       = 0.5 * dt;
+      rejected = true;
+      if (dt < params.min_step_size)
+        return Experimental::ode_solver_status::MIN_SIZE;
+      continue;
+    }
+
+    scalar_type error = 0;
+    if (params.adaptivity) {
+      for (int eqIdx = 0; eqIdx < ode.neqs; ++eqIdx) {
+        const scalar_type tol =
+            params.abs_tol +
+            params.rel_tol * Kokkos::max(Kokkos::abs(y(eqIdx)),
+                                         Kokkos::abs(y0(eqIdx)));
+        error = Kokkos::max(error, Kokkos::abs(temp(eqIdx)) / tol);
+      }
+    }
+
+    scalar_type factor = Kokkos::min(
+        6.0, Kokkos::max(0.2, 0.9 * Kokkos::pow(Kokkos::max(error, 1.0e-10),
+                                                -1.0 / table.order)));
+    if (error > 1) {
+      // Reject the step and try again with a smaller one.
+      dt       = dt * factor;
+      rejected = true;
+      if (dt < params.min_step_size)
+        return Experimental::ode_solver_status::MIN_SIZE;
+      continue;
+    }
+
+    t_now = last_step ? t_end : t_now + dt;
+    for (int eqIdx = 0; eqIdx < ode.neqs; ++eqIdx) {
+      y0(eqIdx) = y(eqIdx);
+    }
+    if (last_step) return Experimental::ode_solver_status::SUCCESS;
+
+    // Do not grow the time step right after a rejection.
+    if (params.adaptivity) {
+      if (rejected) factor = Kokkos::min(factor, 1.0);
+      dt       = dt * factor;
+      rejected = false;
+    }
+  }
+
+  return Experimental::ode_solver_status::MAX_STEP;
+}  // RosenbrockSolve
+
+}  // namespace Impl
+}  // namespace KokkosODE
+
+#endif  // KOKKOSODE_ROSENBROCK_IMPL_HPP
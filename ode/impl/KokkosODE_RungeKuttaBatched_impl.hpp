@@ -0,0 +1,208 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSODE_RUNGEKUTTABATCHED_IMPL_HPP
+#define KOKKOSODE_RUNGEKUTTABATCHED_IMPL_HPP
+
+#include <type_traits>
+#include <utility>
+
+#include "Kokkos_Core.hpp"
+#include "KokkosODE_RungeKutta_impl.hpp"
+#include "KokkosODE_Types.hpp"
+
+namespace KokkosODE {
+namespace Impl {
+
+// Detects odes that take the index of the system as first argument of
+// evaluate_function, i.e. batches of systems with different parameters.
+template <class ode_type, class vec_type1, class vec_type2, class = void>
+struct has_system_index : std::false_type {};
+
+template <class ode_type, class vec_type1, class vec_type2>
+struct has_system_index<
+    ode_type, vec_type1, vec_type2,
+    std::void_t<decltype(std::declval<const ode_type&>().evaluate_function(
+        0, 0.0, 0.0, std::declval<const vec_type1&>(),
+        std::declval<const vec_type2&>()))>> : std::true_type {};
+
+// View of the system sysIdx of a batch of odes with the interface
+// expected by RKStep and RKAdvance.
+template <class ode_type>
+struct BatchedODESystem {
+  const ode_type& ode;
+  const int sysIdx;
+  const int neqs;
+
+  KOKKOS_FUNCTION
+  BatchedODESystem(const ode_type& ode_, const int sysIdx_)
+      : ode(ode_), sysIdx(sysIdx_), neqs(ode_.neqs) {}
+
+  template <class vec_type1, class vec_type2>
+  KOKKOS_FUNCTION void evaluate_function(const double t, const double dt,
+                                         const vec_type1& y,
+                                         const vec_type2& f) const {
+    if constexpr (has_system_index<ode_type, vec_type1, vec_type2>::value) {
+      ode.evaluate_function(sysIdx, t, dt, y, f);
+    } else {
+      ode.evaluate_function(t, dt, y, f);
+    }
+  }
+};
+
+// One pass of the batched integration: every active system is advanced by
+// at most steps_per_pass time steps.
+template <class ode_type, class table_type, class mv_type, class kv_type,
+          class status_type, class scalar_view_type, class int_view_type>
+struct RKBatchedPass {
+  using scalar_type = typename scalar_view_type::non_const_value_type;
+
+  ode_type ode;
+  KokkosODE::Experimental::ODE_params params;
+  scalar_type t_end;
+  int steps_per_pass;
+  mv_type y0, y, temp;
+  kv_type k_vecs;
+  status_type status;
+  scalar_view_type t_now, dt;
+  int_view_type num_steps, active;
+
+  RKBatchedPass(const ode_type& ode_,
+                const KokkosODE::Experimental::ODE_params& params_,
+                const scalar_type t_end_, const int steps_per_pass_,
+                const mv_type& y0_, const mv_type& y_, const mv_type& temp_,
+                const kv_type& k_vecs_, const status_type& status_,
+                const scalar_view_type& t_now_, const scalar_view_type& dt_,
+                const int_view_type& num_steps_, const int_view_type& active_)
+      : ode(ode_),
+        params(params_),
+        t_end(t_end_),
+        steps_per_pass(steps_per_pass_),
+        y0(y0_),
+        y(y_),
+        temp(temp_),
+        k_vecs(k_vecs_),
+        status(status_),
+        t_now(t_now_),
+        dt(dt_),
+        num_steps(num_steps_),
+        active(active_) {}
+
+  KOKKOS_FUNCTION
+  void operator()(const int activeIdx) const {
+    const int sysIdx = active(activeIdx);
+    table_type table;
+    const BatchedODESystem<ode_type> system(ode, sysIdx);
+
+    auto y0_s     = Kokkos::subview(y0, sysIdx, Kokkos::ALL);
+    auto y_s      = Kokkos::subview(y, sysIdx, Kokkos::ALL);
+    auto temp_s   = Kokkos::subview(temp, sysIdx, Kokkos::ALL);
+    auto k_vecs_s = Kokkos::subview(k_vecs, sysIdx, Kokkos::ALL, Kokkos::ALL);
+
+    scalar_type t_s  = t_now(sysIdx);
+    scalar_type dt_s = dt(sysIdx);
+    int steps_s      = num_steps(sysIdx);
+    status(sysIdx)   = RKAdvance(system, table, params, t_end, t_s, dt_s,
+                                 steps_s, steps_per_pass, y0_s, y_s, temp_s,
+                                 k_vecs_s);
+    t_now(sysIdx)     = t_s;
+    dt(sysIdx)        = dt_s;
+    num_steps(sysIdx) = steps_s;
+  }
+};
+
+// Integrate a batch of odes, each system with its own adaptive time step.
+// The systems are advanced by passes of at most steps_per_pass steps; after
+// each pass the systems that are not done are regrouped at the front of the
+// list of active systems so that the next pass only launches threads for
+// them and the systems that need many steps end up next to each other
+// instead of idling the threads of the systems that are done.
+template <class table_type, class execution_space, class ode_type,
+          class mv_type, class kv_type, class status_type, class scalar_type>
+void RKSolveBatched(const execution_space& space, const ode_type& ode,
+                    const KokkosODE::Experimental::ODE_params& params,
+                    const scalar_type t_start, const scalar_type t_end,
+                    const mv_type& y0, const mv_type& y, const mv_type& temp,
+                    const kv_type& k_vecs, const status_type& status,
+                    const int steps_per_pass) {
+  using memory_space     = typename mv_type::memory_space;
+  using scalar_view_type = Kokkos::View<scalar_type*, memory_space>;
+  using int_view_type    = Kokkos::View<int*, memory_space>;
+  using policy_type      = Kokkos::RangePolicy<execution_space>;
+
+  const int num_systems = y0.extent_int(0);
+  const int max_steps   = params.max_steps;
+
+  scalar_view_type t_now(
+      Kokkos::view_alloc(space, Kokkos::WithoutInitializing, "t_now"),
+      num_systems);
+  scalar_view_type dt(
+      Kokkos::view_alloc(space, Kokkos::WithoutInitializing, "dt"),
+      num_systems);
+  int_view_type num_steps(
+      Kokkos::view_alloc(space, Kokkos::WithoutInitializing, "num_steps"),
+      num_systems);
+  int_view_type active(
+      Kokkos::view_alloc(space, Kokkos::WithoutInitializing, "active"),
+      num_systems);
+  int_view_type active_next(
+      Kokkos::view_alloc(space, Kokkos::WithoutInitializing, "active_next"),
+      num_systems);
+
+  Kokkos::parallel_for(
+      "KokkosODE::RKSolveBatched::init", policy_type(space, 0, num_systems),
+      KOKKOS_LAMBDA(const int sysIdx) {
+        t_now(sysIdx)     = t_start;
+        dt(sysIdx)        = (t_end - t_start) / max_steps;
+        num_steps(sysIdx) = 0;
+        active(sysIdx)    = sysIdx;
+      });
+
+  int num_active = num_systems;
+  while (num_active > 0) {
+    Kokkos::parallel_for(
+        "KokkosODE::RKSolveBatched::pass", policy_type(space, 0, num_active),
+        RKBatchedPass<ode_type, table_type, mv_type, kv_type, status_type,
+                      scalar_view_type, int_view_type>(
+            ode, params, t_end, steps_per_pass, y0, y, temp, k_vecs, status,
+            t_now, dt, num_steps, active));
+
+    // Regroup the systems that ran out of steps in this pass
+    // but can still take more steps.
+    int num_active_next = 0;
+    Kokkos::parallel_scan(
+        "KokkosODE::RKSolveBatched::regroup",
+        policy_type(space, 0, num_active),
+        KOKKOS_LAMBDA(const int activeIdx, int& offset, const bool final) {
+          const int sysIdx = active(activeIdx);
+          if ((status(sysIdx) ==
+               KokkosODE::Experimental::ode_solver_status::MAX_STEP) &&
+              (num_steps(sysIdx) < max_steps)) {
+            if (final) active_next(offset) = sysIdx;
+            ++offset;
+          }
+        },
+        num_active_next);
+
+    std::swap(active, active_next);
+    num_active = num_active_next;
+  }
+}  // RKSolveBatched
+
+}  // namespace Impl
+}  // namespace KokkosODE
+
+#endif  // KOKKOSODE_RUNGEKUTTABATCHED_IMPL_HPP
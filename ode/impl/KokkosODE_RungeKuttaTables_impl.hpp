@@ -56,6 +56,9 @@ namespace Impl {
 // The array of aij coefficients is ordered by rows as: a =
 // {a00,a10,a11,a20,a21,a22....}
 // e contains coefficient for error estimation
+// fsal is true when the last stage is evaluated at the new solution
+// (First Same As Last), it then provides f(t+dt, y_new) for free which is
+// used by the dense output interpolant.
 
 template <int order, int nstages, int variant = 0>
 struct ButcherTableau {};
@@ -65,6 +68,7 @@ struct ButcherTableau<0, 0>  // Forward Euler
 {
   static constexpr int order   = 1;
   static constexpr int nstages = 1;
+  static constexpr bool fsal    = false;
 
   Kokkos::Array<double, 1> a{{1}};
   Kokkos::Array<double, nstages> b{{1}};
@@ -82,6 +86,7 @@ struct ButcherTableau<1, 1>  // Euler-Heun Method
 {
   static constexpr int order   = 2;
   static constexpr int nstages = 2;  // total dimensions, nstagesxnstages system
+  static constexpr bool fsal    = false;
   Kokkos::Array<double, (nstages * nstages + nstages) / 2> a{
       {0.0, 1.0,
        0.0}};  //(nstages*nstages+nstages)/2 size of lower triangular matrix
@@ -100,6 +105,7 @@ struct ButcherTableau<1, 2>  // Known as Fehlberg 1-2 method
 {
   static constexpr int order   = 2;
   static constexpr int nstages = 3;
+  static constexpr bool fsal    = false;
   Kokkos::Array<double, (nstages * nstages + nstages) / 2> a{
       {0.0, 0.5, 0.0, 1.0 / 256.0, 255.0 / 256.0, 0.0}};
   Kokkos::Array<double, nstages> b{{1.0 / 512.0, 255.0 / 256.0, 1. / 512}};
@@ -118,6 +124,7 @@ struct ButcherTableau<2, 3>  // Bogacki-Shampine method
 {
   static constexpr int order   = 3;
   static constexpr int nstages = 4;
+  static constexpr bool fsal    = true;
   Kokkos::Array<double, (nstages * nstages + nstages) / 2> a{
       {0.0, 0.5, 0.0, 0.0, 3.0 / 4.0, 0.0, 2.0 / 9.0, 1.0 / 3.0, 4.0 / 9.0,
        0.0}};
@@ -136,6 +143,7 @@ struct ButcherTableau<3, 3>  // RK4
 {
   static constexpr int order   = 4;
   static constexpr int nstages = 4;
+  static constexpr bool fsal    = false;
   Kokkos::Array<double, (nstages * nstages + nstages) / 2> a{
       {0.0, 0.5, 0.0, 0.0, 0.5, 0.0, 0.0, 0.0, 1.0, 0.0}};
   Kokkos::Array<double, nstages> b{
@@ -154,6 +162,7 @@ struct ButcherTableau<4, 5>  // Fehlberg Method
 {
   static constexpr int order   = 5;
   static constexpr int nstages = 6;
+  static constexpr bool fsal    = false;
   Kokkos::Array<double, (nstages * nstages + nstages) / 2> a{{0.0,
                                                               0.25,
                                                               0.0,
@@ -195,6 +204,7 @@ struct ButcherTableau<4, 5, 1>  // Cash-Karp
 {
   static constexpr int order   = 5;
   static constexpr int nstages = 6;
+  static constexpr bool fsal    = false;
   Kokkos::Array<double, (nstages * nstages + nstages) / 2> a{
       {0.0,
        0.2,
@@ -236,6 +246,7 @@ struct ButcherTableau<4, 6>  // Referred to as DOPRI5 or RKDP
 {
   static constexpr int order   = 5;
   static constexpr int nstages = 7;
+  static constexpr bool fsal    = true;
   Kokkos::Array<double, (nstages * nstages + nstages) / 2> a{{0.0,
                                                               0.2,
                                                               0.0,
@@ -18,9 +18,9 @@
 #define KOKKOSBLAS_RUNGEKUTTA_IMPL_HPP
 
 #include "Kokkos_Core.hpp"
-#include "KokkosBlas1_scal.hpp"
-#include "KokkosBlas1_axpby.hpp"
+#include "KokkosBatched_Vector.hpp"
 #include "KokkosODE_RungeKuttaTables_impl.hpp"
+#include "KokkosODE_DenseOutput_impl.hpp"
 #include "KokkosODE_Types.hpp"
 
 namespace KokkosODE {
@@ -30,13 +30,16 @@ namespace Impl {
 // k_i = f(t+c_i*dt, y_old+sum(a_{ij}*k_i))  j in [1, i-1]
 // we need to compute the k_i and store them as we go
 // to use them for k_{i+1} computation.
+// k0 = f(t, y_old) does not depend on dt, when k0_computed is true it is
+// already stored in k_vecs(0, :) and is not evaluated again.
 template <class ode_type, class table_type, class vec_type, class mv_type,
           class scalar_type>
 KOKKOS_FUNCTION void RKStep(ode_type& ode, const table_type& table,
                             const bool adaptivity, scalar_type t,
                             scalar_type dt, const vec_type& y_old,
                             const vec_type& y_new, const vec_type& temp,
-                            const mv_type& k_vecs) {
+                            const mv_type& k_vecs,
+                            const bool k0_computed = false) {
   const int neqs    = ode.neqs;
   const int nstages = table.nstages;
 
@@ -49,7 +52,9 @@ KOKKOS_FUNCTION void RKStep(ode_type& ode, const table_type& table,
   {
     // we always start with y_new += dt*b_0*k0
     auto k0 = Kokkos::subview(k_vecs, 0, Kokkos::ALL);
-    ode.evaluate_function(t + table.c[0] * dt, dt, y_old, k0);
+    if (!k0_computed) {
+      ode.evaluate_function(t + table.c[0] * dt, dt, y_old, k0);
+    }
     for (int eqIdx = 0; eqIdx < neqs; ++eqIdx) {
       y_new(eqIdx) += dt * table.b[0] * k0(eqIdx);
     }
@@ -68,8 +73,9 @@ KOKKOS_FUNCTION void RKStep(ode_type& ode, const table_type& table,
             table.a[stageIdx * (stageIdx + 1) / 2 + idx] * k_vecs(idx, eqIdx);
       }
     }
-    KokkosBlas::SerialScale::invoke(dt, temp);
-    KokkosBlas::serial_axpy(1, y_old, temp);
+    for (int eqIdx = 0; eqIdx < neqs; ++eqIdx) {
+      temp(eqIdx) = y_old(eqIdx) + dt * temp(eqIdx);
+    }
     auto k = Kokkos::subview(k_vecs, stageIdx, Kokkos::ALL);
     ode.evaluate_function(t + table.c[stageIdx] * dt, dt, temp, k);
     for (int eqIdx = 0; eqIdx < neqs; ++eqIdx) {
@@ -88,26 +94,52 @@ KOKKOS_FUNCTION void RKStep(ode_type& ode, const table_type& table,
   }
 }  // RKStep
 
+// Observer of the accepted time steps used when the integration does not
+// produce dense output or monitor events.
+struct RKNoObserver {
+  // true if the observer stores f(t_now + dt, y) in k_vecs(0, :), i.e. the
+  // first stage of the next step
+  static constexpr bool updates_first_stage = false;
+
+  template <class ode_type, class table_type, class vec_type, class mv_type,
+            class scalar_type>
+  KOKKOS_FUNCTION bool operator()(const ode_type&, const table_type&,
+                                  scalar_type&, const scalar_type,
+                                  const vec_type&, const vec_type&,
+                                  const vec_type&, const mv_type&) const {
+    return false;
+  }
+};
+
+// Advance the solution of the ode from t_now towards t_end with at most
+// max_steps time steps, num_steps counts the steps taken since the start of
+// the integration and is bounded by params.max_steps. On return t_now, dt and
+// num_steps describe the state of the integration so that a later call can
+// resume it where it stopped.
+//
+// The observer is called after each accepted step from t_now to t_now + dt
+// with y0 = y(t_now), y = y(t_now + dt) and k_vecs(0, :) = f(t_now, y0).
+// When it returns true the integration stops with status EVENT, the
+// observer having set t_now and y to the final time and solution.
 template <class ode_type, class table_type, class vec_type, class mv_type,
-          class scalar_type>
-KOKKOS_FUNCTION Experimental::ode_solver_status RKSolve(
+          class scalar_type, class observer_type>
+KOKKOS_FUNCTION Experimental::ode_solver_status RKAdvance(
     const ode_type& ode, const table_type& table,
-    const KokkosODE::Experimental::ODE_params& params,
-    const scalar_type t_start, const scalar_type t_end, const vec_type& y0,
-    const vec_type& y, const vec_type& temp, const mv_type& k_vecs) {
+    const KokkosODE::Experimental::ODE_params& params, const scalar_type t_end,
+    scalar_type& t_now, scalar_type& dt, int& num_steps, const int max_steps,
+    const vec_type& y0, const vec_type& y, const vec_type& temp,
+    const mv_type& k_vecs, observer_type& observer) {
   constexpr scalar_type error_threshold = 1;
   bool adapt                            = params.adaptivity;
   bool dt_was_reduced;
+  bool k0_computed = false;
   if (std::is_same_v<table_type, ButcherTableau<0, 0>>) {
     adapt = false;
   }
 
-  // Set current time and initial time step
-  scalar_type t_now = t_start;
-  scalar_type dt    = (t_end - t_start) / params.max_steps;
-
   // Loop over time steps to integrate ODE
-  for (int stepIdx = 0; (stepIdx < params.max_steps) && (t_now <= t_end);
+  for (int stepIdx = 0; (stepIdx < max_steps) &&
+                        (num_steps < params.max_steps) && (t_now <= t_end);
        ++stepIdx) {
     // Check that the step attempted is not putting
     // the solution past t_end, otherwise shrink dt
@@ -127,8 +159,10 @@ KOKKOS_FUNCTION Experimental::ode_solver_status RKSolve(
     // solvers, for fix time steps we simply do not
     // compute and check what error of the current step
     while (error_threshold < error) {
-      // Take a step of Runge-Kutta integrator
-      RKStep(ode, table, adapt, t_now, dt, y0, y, temp, k_vecs);
+      // Take a step of Runge-Kutta integrator, retrying a step
+      // reuses its first stage
+      RKStep(ode, table, adapt, t_now, dt, y0, y, temp, k_vecs, k0_computed);
+      k0_computed = true;
 
       // Compute the largest error and decide on
       // the size of the next time step to take.
@@ -157,8 +191,18 @@ KOKKOS_FUNCTION Experimental::ode_solver_status RKSolve(
       }
     }
 
+    if (observer(ode, table, t_now, dt, y0, y, temp, k_vecs)) {
+      ++num_steps;
+      for (int eqIdx = 0; eqIdx < ode.neqs; ++eqIdx) {
+        y0(eqIdx) = y(eqIdx);
+      }
+      return Experimental::ode_solver_status::EVENT;
+    }
+    k0_computed = observer_type::updates_first_stage;
+
     // Update time and initial condition for next time step
     t_now += dt;
+    ++num_steps;
     for (int eqIdx = 0; eqIdx < ode.neqs; ++eqIdx) {
       y0(eqIdx) = y(eqIdx);
     }
@@ -179,6 +223,283 @@ KOKKOS_FUNCTION Experimental::ode_solver_status RKSolve(
   if (t_now < t_end) return Experimental::ode_solver_status::MAX_STEP;
 
   return Experimental::ode_solver_status::SUCCESS;
+}  // RKAdvance
+
+template <class ode_type, class table_type, class vec_type, class mv_type,
+          class scalar_type>
+KOKKOS_FUNCTION Experimental::ode_solver_status RKAdvance(
+    const ode_type& ode, const table_type& table,
+    const KokkosODE::Experimental::ODE_params& params, const scalar_type t_end,
+    scalar_type& t_now, scalar_type& dt, int& num_steps, const int max_steps,
+    const vec_type& y0, const vec_type& y, const vec_type& temp,
+    const mv_type& k_vecs) {
+  RKNoObserver observer;
+  return RKAdvance(ode, table, params, t_end, t_now, dt, num_steps, max_steps,
+                   y0, y, temp, k_vecs, observer);
+}  // RKAdvance
+
+// Observer producing the dense output of the integration: the solution at
+// the times t_out is interpolated with the cubic Hermite interpolant of the
+// step that contains them and stored in the rows of y_out, so the time
+// steps are not shortened to hit the output times. The first stage of the
+// next step, f(t_now + dt, y), is the last stage of FSAL methods and is
+// evaluated here for the other methods; the interpolation therefore costs
+// no evaluation of the right hand side except, for non-FSAL methods, one
+// on the last step when it contains output times or an event.
+//
+// When event_type is not NoEvent, event(t, y) is evaluated at the end of
+// each step and the integration stops at the first time where it changes
+// sign. The time of the event is located on the interpolant and the
+// integration stops there.
+template <class times_type, class out_type, class event_type,
+          class scalar_type>
+struct RKDenseOutput {
+  static constexpr bool updates_first_stage = true;
+
+  times_type t_out;
+  out_type y_out;
+  event_type event;
+  scalar_type t_end, g_old = 0;
+  int next_out = 0;
+
+  KOKKOS_FUNCTION
+  RKDenseOutput(const times_type& t_out_, const out_type& y_out_,
+                const event_type& event_, const scalar_type t_end_)
+      : t_out(t_out_), y_out(y_out_), event(event_), t_end(t_end_) {}
+
+  template <class ode_type, class table_type, class vec_type, class mv_type>
+  KOKKOS_FUNCTION bool operator()(const ode_type& ode, const table_type& table,
+                                  scalar_type& t_now, const scalar_type dt,
+                                  const vec_type& y0, const vec_type& y,
+                                  const vec_type& temp,
+                                  const mv_type& k_vecs) {
+    static_assert(1 < table_type::nstages,
+                  "Dense output requires methods with at least two stages");
+    const scalar_type t_new = t_now + dt;
+    const bool last_step    = !(t_new < t_end);
+
+    // f1 = f(t_new, y) once the first stage of the next step is available
+    auto f0 = Kokkos::subview(k_vecs, 0, Kokkos::ALL);
+    auto f1 = Kokkos::subview(k_vecs, table.nstages - 1, Kokkos::ALL);
+    HermiteInterpolant interp(t_now, dt, y0, y, f0, f1);
+
+    if constexpr (!std::is_same_v<event_type, NoEvent>) {
+      const scalar_type g_new = event(t_new, y);
+      if (event_crossed(g_old, g_new)) {
+        if (!table_type::fsal) {
+          ode.evaluate_function(t_new, dt, y, f1);
+        }
+        const scalar_type t_event =
+            locate_event(interp, event, t_now, g_old, t_new, g_new, temp);
+        dense_output(interp, t_event, t_out, y_out, next_out);
+        for (int eqIdx = 0; eqIdx < ode.neqs; ++eqIdx) {
+          y(eqIdx) = temp(eqIdx);
+        }
+        t_now = t_event;
+        return true;
+      }
+      g_old = g_new;
+    }
+
+    const bool has_output =
+        (next_out < t_out.extent_int(0)) && (t_out(next_out) <= t_new);
+    if (!table_type::fsal && (!last_step || has_output)) {
+      ode.evaluate_function(t_new, dt, y, f1);
+    }
+    dense_output(interp, t_new, t_out, y_out, next_out);
+    if (!last_step) {
+      for (int eqIdx = 0; eqIdx < ode.neqs; ++eqIdx) {
+        f0(eqIdx) = f1(eqIdx);
+      }
+    }
+    return false;
+  }
+};
+
+// Integrate vector_length independent systems stored in the lanes of
+// KokkosBatched::Vector<SIMD<T>, vector_length> entries. The stages are
+// computed for all the lanes at once, the ode receives the time and time
+// step of each lane as SIMD vectors. Each lane keeps its own time step and
+// accepts or rejects its steps exactly as RKAdvance does for one system;
+// the lanes that are done take steps of size zero until all of them are.
+// The status of each lane is stored in lane_status, the one returned is
+// SUCCESS if all the lanes succeeded and the status of the first lane that
+// failed otherwise.
+template <class ode_type, class table_type, class vec_type, class mv_type,
+          class scalar_type, class lane_status_type>
+KOKKOS_FUNCTION Experimental::ode_solver_status RKSolveSIMD(
+    const ode_type& ode, const table_type& table,
+    const KokkosODE::Experimental::ODE_params& params,
+    const scalar_type t_start, const scalar_type t_end, const vec_type& y0,
+    const vec_type& y, const vec_type& temp, const mv_type& k_vecs,
+    lane_status_type& lane_status) {
+  using simd_type      = typename vec_type::non_const_value_type;
+  using ode_status     = Experimental::ode_solver_status;
+  constexpr int nlanes = simd_type::vector_length;
+
+  constexpr scalar_type error_threshold = 1;
+  bool adapt                            = params.adaptivity;
+  if (std::is_same_v<table_type, ButcherTableau<0, 0>>) {
+    adapt = false;
+  }
+
+  simd_type t_now(t_start), dt((t_end - t_start) / params.max_steps);
+  scalar_type dt_next[nlanes], error[nlanes];
+  int num_steps[nlanes];
+  bool done[nlanes], dt_was_reduced[nlanes];
+  for (int lane = 0; lane < nlanes; ++lane) {
+    dt_next[lane]        = dt[lane];
+    num_steps[lane]      = 0;
+    done[lane]           = !(0 < params.max_steps) || !(t_start <= t_end);
+    dt_was_reduced[lane] = false;
+    lane_status[lane]    = t_start < t_end ? ode_status::MAX_STEP
+                                           : ode_status::SUCCESS;
+  }
+
+  bool k0_computed = false;
+  for (int num_active = nlanes; 0 < num_active;) {
+    // Lanes that are done do not move, the others do not step past t_end
+    for (int lane = 0; lane < nlanes; ++lane) {
+      dt[lane] = done[lane] ? 0 : dt_next[lane];
+      if (!done[lane] && (t_end < t_now[lane] + dt[lane])) {
+        dt[lane] = t_end - t_now[lane];
+      }
+    }
+
+    // A step retried by all the lanes reuses its first stage
+    RKStep(ode, table, adapt, t_now, dt, y0, y, temp, k_vecs, k0_computed);
+
+    for (int lane = 0; lane < nlanes; ++lane) {
+      error[lane] = 0;
+      if (done[lane] || !adapt) continue;
+      scalar_type tol = 0;
+      for (int eqIdx = 0; eqIdx < ode.neqs; ++eqIdx) {
+        const scalar_type y_max = Kokkos::max(Kokkos::abs(y(eqIdx)[lane]),
+                                              Kokkos::abs(y0(eqIdx)[lane]));
+        error[lane] = Kokkos::max(error[lane], Kokkos::abs(temp(eqIdx)[lane]));
+        tol = Kokkos::max(tol, params.abs_tol + params.rel_tol * y_max);
+      }
+      error[lane] = error[lane] / tol;
+    }
+
+    k0_computed = true;
+    num_active  = 0;
+    for (int lane = 0; lane < nlanes; ++lane) {
+      if (done[lane]) continue;
+      const bool accepted = !(error_threshold < error[lane]);
+      scalar_type dt_lane = dt[lane];
+
+      // Reject the step and reduce the time step of the lane
+      if (adapt) {
+        if (!accepted) {
+          dt_lane = dt_lane *
+                    Kokkos::max(0.2, 0.8 / Kokkos::pow(error[lane],
+                                                       1 / table.order));
+          dt_was_reduced[lane] = true;
+        }
+        if (dt_lane < params.min_step_size) {
+          lane_status[lane] = ode_status::MIN_SIZE;
+          done[lane]        = true;
+          continue;
+        }
+      }
+
+      if (accepted) {
+        k0_computed = false;
+        t_now[lane] += dt_lane;
+        ++num_steps[lane];
+        for (int eqIdx = 0; eqIdx < ode.neqs; ++eqIdx) {
+          y0(eqIdx)[lane] = y(eqIdx)[lane];
+        }
+
+        if (t_now[lane] < t_end) {
+          if (adapt && !dt_was_reduced[lane] && error[lane] < 0.5) {
+            dt_lane = dt_lane *
+                      Kokkos::min(10.0,
+                                  Kokkos::max(2.0, 0.9 * Kokkos::pow(
+                                                       error[lane],
+                                                       1 / table.order)));
+          }
+          dt_was_reduced[lane] = false;
+        } else {
+          lane_status[lane] = ode_status::SUCCESS;
+          done[lane]        = true;
+          continue;
+        }
+        if (!(num_steps[lane] < params.max_steps)) {
+          lane_status[lane] = ode_status::MAX_STEP;
+          done[lane]        = true;
+          continue;
+        }
+      }
+      dt_next[lane] = dt_lane;
+      ++num_active;
+    }
+  }
+
+  for (int lane = 0; lane < nlanes; ++lane) {
+    if (lane_status[lane] != ode_status::SUCCESS) return lane_status[lane];
+  }
+  return ode_status::SUCCESS;
+}  // RKSolveSIMD
+
+template <class ode_type, class table_type, class vec_type, class mv_type,
+          class scalar_type>
+KOKKOS_FUNCTION Experimental::ode_solver_status RKSolve(
+    const ode_type& ode, const table_type& table,
+    const KokkosODE::Experimental::ODE_params& params,
+    const scalar_type t_start, const scalar_type t_end, const vec_type& y0,
+    const vec_type& y, const vec_type& temp, const mv_type& k_vecs) {
+  if constexpr (KokkosBatched::is_vector<
+                    typename vec_type::non_const_value_type>::value) {
+    Experimental::ode_solver_status
+        lane_status[vec_type::non_const_value_type::vector_length];
+    return RKSolveSIMD(ode, table, params, t_start, t_end, y0, y, temp, k_vecs,
+                       lane_status);
+  } else {
+    // Set current time and initial time step
+    scalar_type t_now = t_start;
+    scalar_type dt    = (t_end - t_start) / params.max_steps;
+    int num_steps     = 0;
+
+    return RKAdvance(ode, table, params, t_end, t_now, dt, num_steps,
+                     params.max_steps, y0, y, temp, k_vecs);
+  }
+}  // RKSolve
+
+// RKSolve with dense output at the times t_out and, unless event_type is
+// NoEvent, detection of the first sign change of event(t, y). t_event is
+// set to the time at which the integration stopped.
+template <class ode_type, class table_type, class vec_type, class mv_type,
+          class times_type, class out_type, class event_type,
+          class scalar_type>
+KOKKOS_FUNCTION Experimental::ode_solver_status RKSolve(
+    const ode_type& ode, const table_type& table,
+    const KokkosODE::Experimental::ODE_params& params,
+    const scalar_type t_start, const scalar_type t_end, const vec_type& y0,
+    const vec_type& y, const vec_type& temp, const mv_type& k_vecs,
+    const times_type& t_out, const out_type& y_out, const event_type& event,
+    scalar_type& t_event) {
+  static_assert(!KokkosBatched::is_vector<
+                    typename vec_type::non_const_value_type>::value,
+                "Dense output and events are not available for SIMD systems");
+
+  // Set current time and initial time step
+  scalar_type t_now = t_start;
+  scalar_type dt    = (t_end - t_start) / params.max_steps;
+  int num_steps     = 0;
+
+  RKDenseOutput<times_type, out_type, event_type, scalar_type> observer(
+      t_out, y_out, event, t_end);
+  if constexpr (!std::is_same_v<event_type, NoEvent>) {
+    observer.g_old = event(t_start, y0);
+  }
+
+  const Experimental::ode_solver_status status =
+      RKAdvance(ode, table, params, t_end, t_now, dt, num_steps,
+                params.max_steps, y0, y, temp, k_vecs, observer);
+  t_event = t_now;
+  return status;
 }  // RKSolve
 
 }  // namespace Impl
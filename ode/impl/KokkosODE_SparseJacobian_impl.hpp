@@ -0,0 +1,139 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSODE_SPARSEJACOBIAN_IMPL_HPP
+#define KOKKOSODE_SPARSEJACOBIAN_IMPL_HPP
+
+#include "Kokkos_Core.hpp"
+
+namespace KokkosODE {
+namespace Impl {
+
+// Approximate the Jacobian of sys.residual at y with forward differences.
+// The columns that share a color do not appear together in any row of the
+// Jacobian, so they are perturbed together and one residual evaluation per
+// color is enough. The values are stored in the pattern of the LU factors
+// described by jac, the fill-in entries are set to zero.
+// r0 holds the residual at y, r_pert and y_save are work vectors and y is
+// restored on output.
+template <class system_type, class jac_type, class vec_type,
+          class rhs_vec_type, class values_type>
+KOKKOS_FUNCTION void SparseJacobianFD(const system_type& sys,
+                                      const jac_type& jac, const vec_type& y,
+                                      const rhs_vec_type& r0,
+                                      const rhs_vec_type& r_pert,
+                                      const rhs_vec_type& y_save,
+                                      const values_type& values) {
+  using value_type = typename values_type::non_const_value_type;
+  using KAT        = Kokkos::ArithTraits<value_type>;
+
+  const int neqs            = jac.neqs();
+  const value_type sqrt_eps = KAT::sqrt(KAT::eps());
+
+  for (int entryIdx = 0; entryIdx < jac.nnz(); ++entryIdx) {
+    values(entryIdx) = KAT::zero();
+  }
+
+  for (int colorIdx = 0; colorIdx < jac.num_colors; ++colorIdx) {
+    for (int colIdx = 0; colIdx < neqs; ++colIdx) {
+      y_save(colIdx) = y(colIdx);
+      if (jac.colors(colIdx) == colorIdx) {
+        y(colIdx) += sqrt_eps * Kokkos::max(KAT::abs(y(colIdx)), KAT::one());
+      }
+    }
+
+    sys.residual(y, r_pert);
+
+    for (int rowIdx = 0; rowIdx < neqs; ++rowIdx) {
+      for (int entryIdx = jac.row_ptr(rowIdx);
+           entryIdx < jac.row_ptr(rowIdx + 1); ++entryIdx) {
+        const int colIdx = jac.col_idx(entryIdx);
+        if ((jac.colors(colIdx) == colorIdx) && jac.in_jacobian(entryIdx)) {
+          // use the step actually represented in floating point
+          values(entryIdx) = (r_pert(rowIdx) - r0(rowIdx)) /
+                             (y(colIdx) - y_save(colIdx));
+        }
+      }
+    }
+
+    for (int colIdx = 0; colIdx < neqs; ++colIdx) {
+      y(colIdx) = y_save(colIdx);
+    }
+  }
+}  // SparseJacobianFD
+
+// Numeric LU factorization without pivoting (IKJ variant) of the matrix
+// stored in the pattern of jac. The pattern contains the fill-in of the
+// factors so the factorization is exact. On output values holds L (unit
+// lower, diagonal omitted) and U. Returns the number of zero pivots.
+template <class jac_type, class values_type>
+KOKKOS_FUNCTION int SparseLUFactor(const jac_type& jac,
+                                   const values_type& values) {
+  using value_type = typename values_type::non_const_value_type;
+  using KAT        = Kokkos::ArithTraits<value_type>;
+
+  int zero_pivots = 0;
+  for (int rowIdx = 0; rowIdx < jac.neqs(); ++rowIdx) {
+    const int row_end = jac.row_ptr(rowIdx + 1);
+    for (int entryIdx = jac.row_ptr(rowIdx); entryIdx < jac.diag_idx(rowIdx);
+         ++entryIdx) {
+      const int k          = jac.col_idx(entryIdx);
+      const value_type lik = values(entryIdx) / values(jac.diag_idx(k));
+      values(entryIdx)     = lik;
+      // row k of U is contained in the pattern of row rowIdx
+      int pos = entryIdx + 1;
+      for (int ukIdx = jac.diag_idx(k) + 1; ukIdx < jac.row_ptr(k + 1);
+           ++ukIdx) {
+        const int colIdx = jac.col_idx(ukIdx);
+        while ((pos < row_end) && (jac.col_idx(pos) < colIdx)) ++pos;
+        values(pos) -= lik * values(ukIdx);
+      }
+    }
+    if (values(jac.diag_idx(rowIdx)) == KAT::zero()) ++zero_pivots;
+  }
+  return zero_pivots;
+}  // SparseLUFactor
+
+// Solve L*U*x = b in place with the factors computed by SparseLUFactor.
+template <class jac_type, class values_type, class vec_type>
+KOKKOS_FUNCTION void SparseLUSolve(const jac_type& jac,
+                                   const values_type& values,
+                                   const vec_type& x) {
+  using value_type = typename values_type::non_const_value_type;
+
+  const int neqs = jac.neqs();
+  for (int rowIdx = 0; rowIdx < neqs; ++rowIdx) {
+    value_type tmp = x(rowIdx);
+    for (int entryIdx = jac.row_ptr(rowIdx); entryIdx < jac.diag_idx(rowIdx);
+         ++entryIdx) {
+      tmp -= values(entryIdx) * x(jac.col_idx(entryIdx));
+    }
+    x(rowIdx) = tmp;
+  }
+  for (int rowIdx = neqs - 1; rowIdx >= 0; --rowIdx) {
+    value_type tmp = x(rowIdx);
+    for (int entryIdx = jac.diag_idx(rowIdx) + 1;
+         entryIdx < jac.row_ptr(rowIdx + 1); ++entryIdx) {
+      tmp -= values(entryIdx) * x(jac.col_idx(entryIdx));
+    }
+    x(rowIdx) = tmp / values(jac.diag_idx(rowIdx));
+  }
+}  // SparseLUSolve
+
+}  // namespace Impl
+}  // namespace KokkosODE
+
+#endif  // KOKKOSODE_SPARSEJACOBIAN_IMPL_HPP
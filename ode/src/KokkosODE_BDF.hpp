@@ -87,6 +87,15 @@ struct BDF_coeff_helper<BDF_type::BDF6> {
   BDF_coeff_helper() = default;
 };
 
+/// \brief Fixed time step BDF solvers
+///
+/// The entries of the views passed to the dense Jacobian Solve can be
+/// KokkosBatched::Vector<SIMD<T>, N>, in which case N independent systems,
+/// one per lane, are integrated by the calling thread. The Newton
+/// iterations of each lane stop once that lane has converged and the
+/// Jacobian of the lanes is factored without pivoting. The first order - 1
+/// steps are taken with a Runge-Kutta method that passes the time to the
+/// ode as a SIMD vector, the BDF steps pass it as a scalar.
 template <BDF_type T>
 struct BDF {
   using table_type = typename BDF_coeff_helper<T>::table_type;
@@ -100,85 +109,85 @@ struct BDF {
       const mv_type& y_vecs, const mv_type& kstack, const mat_type& temp,
       const mat_type& jac) {
     const table_type table{};
+    const KokkosODE::Impl::NewtonDenseLinearSolver<mat_type> linear_solver(
+        jac, temp);
+    KokkosODE::Impl::BDFFixedSolve(ode, table, t_start, t_end, num_steps, y0,
+                                   y, rhs, update, scale, y_vecs, kstack,
+                                   linear_solver);
+  }  // Solve()
 
-    const double dt = (t_end - t_start) / num_steps;
-    double t        = t_start;
-
-    // Load y0 into y_vecs(:, 0)
-    for (int eqIdx = 0; eqIdx < ode.neqs; ++eqIdx) {
-      y_vecs(eqIdx, 0) = y0(eqIdx);
-    }
-
-    // Compute initial start-up history vectors
-    // Using a non adaptive explicit method.
-    const int init_steps = table.order - 1;
-    if (num_steps < init_steps) {
-      return;
-    }
-    KokkosODE::Experimental::ODE_params params(table.order - 1);
-    for (int stepIdx = 0; stepIdx < init_steps; ++stepIdx) {
-      KokkosODE::Experimental::RungeKutta<RK_type::RKF45>::Solve(
-          ode, params, t, t + dt, y0, y, update, kstack);
-
-      for (int eqIdx = 0; eqIdx < ode.neqs; ++eqIdx) {
-        y_vecs(eqIdx, stepIdx + 1) = y(eqIdx);
-        y0(eqIdx)                  = y(eqIdx);
-      }
-      t += dt;
-    }
-
-    for (int stepIdx = init_steps; stepIdx < num_steps; ++stepIdx) {
-      KokkosODE::Impl::BDFStep(ode, table, t, dt, y0, y, rhs, update, scale,
-                               y_vecs, temp, jac);
-
-      // Update history
-      for (int eqIdx = 0; eqIdx < ode.neqs; ++eqIdx) {
-        y0(eqIdx) = y(eqIdx);
-        for (int orderIdx = 0; orderIdx < table.order - 1; ++orderIdx) {
-          y_vecs(eqIdx, orderIdx) = y_vecs(eqIdx, orderIdx + 1);
-        }
-        y_vecs(eqIdx, table.order - 1) = y(eqIdx);
-      }
-      t += dt;
-    }
+  /// \brief Solve with a sparse Jacobian
+  ///
+  /// Same as Solve but the Newton matrix of each step is approximated by
+  /// colored finite differences and factored with a sparse LU, so no
+  /// neqs x neqs storage is needed and ode.evaluate_jacobian is not used.
+  ///
+  /// \param jac [in]: sparsity of the Jacobian of the ode, see
+  /// create_sparse_jacobian
+  /// \param values [in]: vector of length jac.nnz() for the LU factors
+  /// \param r_pert [in]: vector of length neqs for temporary storage
+  /// \param y_save [in]: vector of length neqs for temporary storage
+  template <class ode_type, class vec_type, class mv_type, class IntViewType,
+            class values_type, class scalar_type>
+  KOKKOS_FUNCTION static void Solve(
+      const ode_type& ode, const scalar_type t_start, const scalar_type t_end,
+      const int num_steps, const vec_type& y0, const vec_type& y,
+      const vec_type& rhs, const vec_type& update, const vec_type& scale,
+      const mv_type& y_vecs, const mv_type& kstack,
+      const SparseJacobian<IntViewType>& jac, const values_type& values,
+      const vec_type& r_pert, const vec_type& y_save) {
+    const table_type table{};
+    const KokkosODE::Impl::NewtonSparseLinearSolver<
+        SparseJacobian<IntViewType>, values_type, vec_type>
+        linear_solver(jac, values, r_pert, y_save);
+    KokkosODE::Impl::BDFFixedSolve(ode, table, t_start, t_end, num_steps, y0,
+                                   y, rhs, update, scale, y_vecs, kstack,
+                                   linear_solver);
   }  // Solve()
 };
 
 /// \brief BDF Solve integrates an ordinary differential equation
-/// using an order and time adaptive BDF method.
+/// using an order and time adaptive BDF method, interpolates its solution
+/// at given output times and stops at the first sign change of an event
+/// function.
 ///
-/// The integration starts with a BDF1 method and adaptively increases
-/// or decreases both dt and the order of integration based on error
-/// estimators. This function is marked as KOKKOS_FUNCTION so it can
-/// be called on host and device.
+/// The solution at the output times and the time of the event are computed
+/// from the interpolating polynomial of the BDF method, the time steps are
+/// not shortened to hit them and no additional evaluation of the ode is
+/// needed. The event function is evaluated at the end of each step, when
+/// it changes sign its root is located on the interpolating polynomial
+/// with the Illinois method.
 ///
-/// \tparam ode_type the type of the ode object to integrated
-/// \tparam mv_type a rank-2 view
-/// \tparam vec_type a rank-1 view
+/// \tparam times_type a rank-1 view
+/// \tparam out_type a rank-2 view
+/// \tparam event_type a type providing
+/// KOKKOS_FUNCTION scalar_type operator()(scalar_type t, vec_type y) const
+/// or KokkosODE::Impl::NoEvent
 ///
-/// \param ode [in]: the ode to integrate
-/// \param t_start [in]: time at which the integration starts
-/// \param t_end [in]: time at which the integration stops
-/// \param initial_step [in]: initial value for dt
-/// \param max_step [in]: maximum value for dt
-/// \param y0 [in/out]: vector of initial conditions, set to the solution
-/// at the end of the integration
-/// \param y_new [out]: vector of solution at t_end
-/// \param temp [in]: vectors for temporary storage
-/// \param temp2 [in]: vectors for temporary storage
-template <class ode_type, class mat_type, class vec_type, class scalar_type>
-KOKKOS_FUNCTION void BDFSolve(const ode_type& ode, const scalar_type t_start,
-                              const scalar_type t_end,
-                              const scalar_type initial_step,
-                              const scalar_type max_step, const vec_type& y0,
-                              const vec_type& y_new, mat_type& temp,
-                              mat_type& temp2) {
+/// \param t_out [in]: output times, sorted in increasing order and in
+/// [t_start, t_end]
+/// \param y_out [out]: (num_outputs x neqs) solution at the output times
+/// \param event [in]: function whose sign change defines the event
+/// \param t_event [out]: time at which the integration stopped, i.e. the
+/// time of the event when the status is EVENT
+///
+/// y0 and y_new are set to the solution at t_event, see the BDFSolve
+/// overload below for the other parameters.
+///
+/// \return ode_solver_status SUCCESS or EVENT
+template <class ode_type, class mat_type, class vec_type, class times_type,
+          class out_type, class event_type, class scalar_type>
+KOKKOS_FUNCTION ode_solver_status BDFSolve(
+    const ode_type& ode, const scalar_type t_start, const scalar_type t_end,
+    const scalar_type initial_step, const scalar_type max_step,
+    const vec_type& y0, const vec_type& y_new, mat_type& temp, mat_type& temp2,
+    const times_type& t_out, const out_type& y_out, const event_type& event,
+    scalar_type& t_event, const int max_jacobian_age = 1) {
   using KAT = Kokkos::ArithTraits<scalar_type>;
 
   // This needs to go away and be pulled out of temp instead...
   auto rhs    = Kokkos::subview(temp, Kokkos::ALL(), 0);
   auto update = Kokkos::subview(temp, Kokkos::ALL(), 1);
-  // vec_type rhs("rhs", ode.neqs), update("update", ode.neqs);
   (void)max_step;
 
   int order = 1, num_equal_steps = 0;
@@ -207,18 +216,92 @@ KOKKOS_FUNCTION void BDFSolve(const ode_type& ode, const scalar_type t_start,
     rhs(eqIdx)  = 0;
   }
 
+  // State of the lagged Jacobian factors, if any
+  int jacobian_age        = 0;
+  scalar_type jacobian_dt = dt;
+
+  // Dense output and event state
+  int next_out      = 0;
+  scalar_type g_old = 0;
+  if constexpr (!std::is_same_v<event_type, KokkosODE::Impl::NoEvent>) {
+    g_old = event(t_start, y0);
+  }
+
   // Now we loop over the time interval [t_start, t_end]
   // and solve our ODE.
   while (t < t_end) {
+    const scalar_type t_old = t;
     KokkosODE::Impl::BDFStep(ode, t, dt, t_end, order, num_equal_steps,
                              max_newton_iters, atol, rtol, min_factor, y0,
-                             y_new, rhs, update, temp, temp2);
+                             y_new, rhs, update, temp, temp2, max_jacobian_age,
+                             jacobian_age, jacobian_dt);
+
+    // y_new = D(:, 0) is the solution at t, the interpolant only reads D
+    // so y_new also holds the solution at the event.
+    KokkosODE::Impl::BDFInterpolant interp(t, dt, order, D);
+    if constexpr (!std::is_same_v<event_type, KokkosODE::Impl::NoEvent>) {
+      const scalar_type g_new = event(t, y_new);
+      if (KokkosODE::Impl::event_crossed(g_old, g_new)) {
+        t_event = KokkosODE::Impl::locate_event(interp, event, t_old, g_old, t,
+                                                g_new, y_new);
+        KokkosODE::Impl::dense_output(interp, t_event, t_out, y_out,
+                                      next_out);
+        for (int eqIdx = 0; eqIdx < ode.neqs; ++eqIdx) {
+          y0(eqIdx) = y_new(eqIdx);
+        }
+        return ode_solver_status::EVENT;
+      }
+      g_old = g_new;
+    }
+    KokkosODE::Impl::dense_output(interp, t, t_out, y_out, next_out);
 
     for (int eqIdx = 0; eqIdx < ode.neqs; ++eqIdx) {
       y0(eqIdx) = y_new(eqIdx);
     }
-    // printf("t=%f, dt=%f, y={%f, %f, %f}\n", t, dt, y0(0), y0(1), y0(2));
   }
+
+  t_event = t;
+  return ode_solver_status::SUCCESS;
+}  // BDFSolve
+
+/// \brief BDF Solve integrates an ordinary differential equation
+/// using an order and time adaptive BDF method.
+///
+/// The integration starts with a BDF1 method and adaptively increases
+/// or decreases both dt and the order of integration based on error
+/// estimators. This function is marked as KOKKOS_FUNCTION so it can
+/// be called on host and device.
+///
+/// \tparam ode_type the type of the ode object to integrated
+/// \tparam mv_type a rank-2 view
+/// \tparam vec_type a rank-1 view
+///
+/// \param ode [in]: the ode to integrate
+/// \param t_start [in]: time at which the integration starts
+/// \param t_end [in]: time at which the integration stops
+/// \param initial_step [in]: initial value for dt
+/// \param max_step [in]: maximum value for dt
+/// \param y0 [in/out]: vector of initial conditions, set to the solution
+/// at the end of the integration
+/// \param y_new [out]: vector of solution at t_end
+/// \param temp [in]: vectors for temporary storage
+/// \param temp2 [in]: vectors for temporary storage
+/// \param max_jacobian_age [in]: number of Newton iterations, across time
+/// steps, over which the factors of the Newton matrix are reused (see
+/// Newton_params); 1 (default) recomputes them at every iteration
+template <class ode_type, class mat_type, class vec_type, class scalar_type>
+KOKKOS_FUNCTION void BDFSolve(const ode_type& ode, const scalar_type t_start,
+                              const scalar_type t_end,
+                              const scalar_type initial_step,
+                              const scalar_type max_step, const vec_type& y0,
+                              const vec_type& y_new, mat_type& temp,
+                              mat_type& temp2,
+                              const int max_jacobian_age = 1) {
+  // No output times and no event
+  scalar_type t_stop;
+  BDFSolve(ode, t_start, t_end, initial_step, max_step, y0, y_new, temp, temp2,
+           vec_type(), mat_type(), KokkosODE::Impl::NoEvent(), t_stop,
+           max_jacobian_age);
 }  // BDFSolve
 
 }  // namespace Experimental
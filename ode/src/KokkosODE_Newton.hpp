@@ -23,6 +23,7 @@
 #include "Kokkos_Core.hpp"
 
 #include "KokkosODE_Types.hpp"
+#include "KokkosODE_SparseJacobian.hpp"
 #include "KokkosODE_Newton_impl.hpp"
 
 namespace KokkosODE {
@@ -36,8 +37,169 @@ struct Newton {
       const system_type& sys, const Newton_params& params, const mat_type& J,
       const mat_type& tmp, const ini_vec_type& y0, const rhs_vec_type& rhs,
       const update_type& update, const scale_type& scale) {
+    int jacobian_age = 0, num_jacobian_evals = 0;
     return KokkosODE::Impl::NewtonSolve(sys, params, J, tmp, y0, rhs, update,
-                                        scale);
+                                        scale, jacobian_age,
+                                        num_jacobian_evals);
+  }
+
+  /// \brief Solve with lagged Jacobian factors carried between solves
+  ///
+  /// With params.max_jacobian_age > 1 the LU factors of the Jacobian stay
+  /// in J after the solve and can be reused by the next one. The state of
+  /// these factors belongs to the system being solved: each system of a
+  /// batch passes its own jacobian_age and num_jacobian_evals.
+  ///
+  /// \param jacobian_age [in/out]: iterations since the factors in J were
+  /// computed, 0 requests new factors
+  /// \param num_jacobian_evals [in/out]: incremented for each evaluation
+  /// and factorization of the Jacobian
+  template <class system_type, class mat_type, class ini_vec_type,
+            class rhs_vec_type, class update_type, class scale_type>
+  KOKKOS_FUNCTION static newton_solver_status Solve(
+      const system_type& sys, const Newton_params& params, const mat_type& J,
+      const mat_type& tmp, const ini_vec_type& y0, const rhs_vec_type& rhs,
+      const update_type& update, const scale_type& scale, int& jacobian_age,
+      int& num_jacobian_evals) {
+    return KokkosODE::Impl::NewtonSolve(sys, params, J, tmp, y0, rhs, update,
+                                        scale, jacobian_age,
+                                        num_jacobian_evals);
+  }
+
+  /// \brief Solve with a sparse Jacobian
+  ///
+  /// The Jacobian is not computed by sys.jacobian but approximated by
+  /// finite differences of sys.residual, one residual evaluation per color
+  /// of jac, and factored with a sparse LU in values. Jacobian lagging
+  /// applies as for the dense solver.
+  ///
+  /// \param jac [in]: sparsity of the Jacobian, see create_sparse_jacobian
+  /// \param values [in]: vector of length jac.nnz() for the LU factors
+  /// \param r_pert [in]: vector of length neqs for temporary storage
+  /// \param y_save [in]: vector of length neqs for temporary storage
+  template <class system_type, class IntViewType, class values_type,
+            class work_type, class ini_vec_type, class rhs_vec_type,
+            class update_type, class scale_type>
+  KOKKOS_FUNCTION static newton_solver_status Solve(
+      const system_type& sys, const Newton_params& params,
+      const SparseJacobian<IntViewType>& jac, const values_type& values,
+      const work_type& r_pert, const work_type& y_save, const ini_vec_type& y0,
+      const rhs_vec_type& rhs, const update_type& update,
+      const scale_type& scale) {
+    int jacobian_age = 0, num_jacobian_evals = 0;
+    return KokkosODE::Impl::NewtonSolve(sys, params, jac, values, r_pert,
+                                        y_save, y0, rhs, update, scale,
+                                        jacobian_age, num_jacobian_evals);
+  }
+
+  /// \brief Solve with a sparse Jacobian and lagged factors carried between
+  /// solves, see the dense overload for jacobian_age and num_jacobian_evals
+  template <class system_type, class IntViewType, class values_type,
+            class work_type, class ini_vec_type, class rhs_vec_type,
+            class update_type, class scale_type>
+  KOKKOS_FUNCTION static newton_solver_status Solve(
+      const system_type& sys, const Newton_params& params,
+      const SparseJacobian<IntViewType>& jac, const values_type& values,
+      const work_type& r_pert, const work_type& y_save, const ini_vec_type& y0,
+      const rhs_vec_type& rhs, const update_type& update,
+      const scale_type& scale, int& jacobian_age, int& num_jacobian_evals) {
+    return KokkosODE::Impl::NewtonSolve(sys, params, jac, values, r_pert,
+                                        y_save, y0, rhs, update, scale,
+                                        jacobian_age, num_jacobian_evals);
+  }
+};
+
+/// \brief Newton solver run by a team of threads on one non-linear system
+///
+/// Meant for batches of independent systems with one team per system. All
+/// the threads of the team call Solve with the same arguments; the vector
+/// operations of the iterations are split over the threads of the team and
+/// the linear systems are solved with KokkosBatched::TeamGesvFactorize and
+/// TeamGesvSolve using static pivoting. The system provides team level
+/// residual and Jacobian, called by all the threads of the team:
+///
+///   sys.residual(member, y, f) and sys.jacobian(member, y, J)
+///
+/// The steps are damped by a backtracking line search on the residual norm
+/// when params.max_line_search_iters > 0, see Newton_params.
+///
+/// The factorization uses neqs x 4 values of level 0 team scratch that the
+/// team policy must provide.
+///
+/// \param J [in]: neqs x neqs matrix for the Jacobian, overwritten
+/// \param F [in]: neqs x (neqs + 2) matrix for the factors of the Jacobian
+/// \param piv [in]: integer vector of length neqs for the row permutation
+/// \param y0 [in/out]: initial guess on input, solution on output
+/// \param rhs [in]: vector of length neqs for the residual
+/// \param update [in]: vector of length neqs for the Newton step
+/// \param scale [in]: scaling factors of the step in the convergence test
+template <class MemberType>
+struct TeamNewton {
+  template <class system_type, class mat_type, class factor_type,
+            class piv_type, class ini_vec_type, class rhs_vec_type,
+            class update_type, class scale_type>
+  KOKKOS_FUNCTION static newton_solver_status Solve(
+      const MemberType& member, const system_type& sys,
+      const Newton_params& params, const mat_type& J, const factor_type& F,
+      const piv_type& piv, const ini_vec_type& y0, const rhs_vec_type& rhs,
+      const update_type& update, const scale_type& scale) {
+    int jacobian_age = 0, num_jacobian_evals = 0;
+    return KokkosODE::Impl::TeamNewtonSolve<KokkosBatched::Mode::Team>(
+        member, sys, params, J, F, piv, y0, rhs, update, scale, jacobian_age,
+        num_jacobian_evals);
+  }
+
+  /// \brief Solve with lagged Jacobian factors carried between solves in F
+  /// and piv, see Newton::Solve for jacobian_age and num_jacobian_evals
+  template <class system_type, class mat_type, class factor_type,
+            class piv_type, class ini_vec_type, class rhs_vec_type,
+            class update_type, class scale_type>
+  KOKKOS_FUNCTION static newton_solver_status Solve(
+      const MemberType& member, const system_type& sys,
+      const Newton_params& params, const mat_type& J, const factor_type& F,
+      const piv_type& piv, const ini_vec_type& y0, const rhs_vec_type& rhs,
+      const update_type& update, const scale_type& scale, int& jacobian_age,
+      int& num_jacobian_evals) {
+    return KokkosODE::Impl::TeamNewtonSolve<KokkosBatched::Mode::Team>(
+        member, sys, params, J, F, piv, y0, rhs, update, scale, jacobian_age,
+        num_jacobian_evals);
+  }
+};
+
+/// \brief Same as TeamNewton with the vector operations split over the
+/// threads of the team and their vector lanes, the linear systems are
+/// solved with KokkosBatched::TeamVectorGesvFactorize and
+/// TeamVectorGesvSolve.
+template <class MemberType>
+struct TeamVectorNewton {
+  template <class system_type, class mat_type, class factor_type,
+            class piv_type, class ini_vec_type, class rhs_vec_type,
+            class update_type, class scale_type>
+  KOKKOS_FUNCTION static newton_solver_status Solve(
+      const MemberType& member, const system_type& sys,
+      const Newton_params& params, const mat_type& J, const factor_type& F,
+      const piv_type& piv, const ini_vec_type& y0, const rhs_vec_type& rhs,
+      const update_type& update, const scale_type& scale) {
+    int jacobian_age = 0, num_jacobian_evals = 0;
+    return KokkosODE::Impl::TeamNewtonSolve<KokkosBatched::Mode::TeamVector>(
+        member, sys, params, J, F, piv, y0, rhs, update, scale, jacobian_age,
+        num_jacobian_evals);
+  }
+
+  /// \brief Solve with lagged Jacobian factors carried between solves in F
+  /// and piv, see Newton::Solve for jacobian_age and num_jacobian_evals
+  template <class system_type, class mat_type, class factor_type,
+            class piv_type, class ini_vec_type, class rhs_vec_type,
+            class update_type, class scale_type>
+  KOKKOS_FUNCTION static newton_solver_status Solve(
+      const MemberType& member, const system_type& sys,
+      const Newton_params& params, const mat_type& J, const factor_type& F,
+      const piv_type& piv, const ini_vec_type& y0, const rhs_vec_type& rhs,
+      const update_type& update, const scale_type& scale, int& jacobian_age,
+      int& num_jacobian_evals) {
+    return KokkosODE::Impl::TeamNewtonSolve<KokkosBatched::Mode::TeamVector>(
+        member, sys, params, J, F, piv, y0, rhs, update, scale, jacobian_age,
+        num_jacobian_evals);
   }
 };
 
@@ -0,0 +1,110 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSODE_ROSENBROCK_HPP
+#define KOKKOSODE_ROSENBROCK_HPP
+
+/// \file KokkosODE_Rosenbrock.hpp
+
+#include "Kokkos_Core.hpp"
+#include "KokkosODE_Types.hpp"
+
+#include "KokkosODE_Rosenbrock_impl.hpp"
+
+namespace KokkosODE {
+namespace Experimental {
+
+/// \brief Rosenbrock_type is an enum type that conveniently
+/// describes the Rosenbrock methods implemented.
+enum Rosenbrock_type : int {
+  ROS2   = 0,  ///< L-stable order 2 method
+  ROS3   = 1,  ///< L-stable order 3 method
+  RODAS3 = 2   ///< Stiffly accurate order 3 method
+};
+
+template <Rosenbrock_type T>
+struct Rosenbrock_Tableau_helper {
+  using table_type = KokkosODE::Impl::RosenbrockTableau<static_cast<int>(T)>;
+};
+
+/// \brief Rosenbrock solvers for stiff ordinary differential equations
+///
+/// Rosenbrock methods are linearly implicit Runge-Kutta methods: each time
+/// step evaluates and factors the Jacobian once and every stage then costs
+/// a function evaluation and a pair of triangular solves. Unlike BDF there
+/// is no Newton iteration so the work per step does not depend on the
+/// solution which avoids thread divergence when many systems are
+/// integrated concurrently.
+///
+/// \tparam Rosenbrock_type a Rosenbrock_type enum value used to specify
+///         which Rosenbrock method is to be used.
+template <Rosenbrock_type T>
+struct Rosenbrock {
+  using table_type = typename Rosenbrock_Tableau_helper<T>::table_type;
+
+  /// \brief order returns the convergence order of the method
+  KOKKOS_FUNCTION
+  static int order() { return table_type::order; }
+
+  /// \brief num_stages returns the number of stages used by the method
+  KOKKOS_FUNCTION
+  static int num_stages() { return table_type::nstages; }
+
+  /// \brief Solve integrates an ordinary differential equation
+  ///
+  /// The integration is carried with the method specified as template
+  /// parameter to the Rosenbrock struct. This method is static and
+  /// marked as KOKKOS_FUNCTION so it can be used on host and device.
+  /// The ode must provide evaluate_function(t, dt, y, f) and
+  /// evaluate_jacobian(t, dt, y, jac), the time derivative of f is not
+  /// used so the methods reach their nominal order on autonomous systems.
+  ///
+  /// \tparam ode_type the type of the ode object to integrated
+  /// \tparam vec_type a rank-1 view
+  /// \tparam mv_type a rank-2 view
+  /// \tparam mat_type a rank-2 view
+  /// \tparam scalar_type a floating point type
+  ///
+  /// \param ode [in]: the ode to integrate
+  /// \param params [in]: standard input parameters of ODE integrators,
+  /// the initial time step is (t_end - t_start) / num_steps
+  /// \param t_start [in]: time at which the integration starts
+  /// \param t_end [in]: time at which the integration stops
+  /// \param y0 [in/out]: vector of initial conditions, set to the solution
+  /// at the end of the integration
+  /// \param y [out]: vector of solution at t_end
+  /// \param temp [in]: vector for temporary storage
+  /// \param k_vecs [in]: (num_stages x neqs) temporary storage
+  /// \param jac [in]: (neqs x neqs) temporary storage
+  ///
+  /// \return ode_solver_status an enum that describes success of failure
+  /// of the integration method once it at terminated.
+  template <class ode_type, class vec_type, class mv_type, class mat_type,
+            class scalar_type>
+  KOKKOS_FUNCTION static ode_solver_status Solve(
+      const ode_type& ode, const KokkosODE::Experimental::ODE_params& params,
+      const scalar_type t_start, const scalar_type t_end, const vec_type& y0,
+      const vec_type& y, const vec_type& temp, const mv_type& k_vecs,
+      const mat_type& jac) {
+    table_type table;
+    return KokkosODE::Impl::RosenbrockSolve(ode, table, params, t_start, t_end,
+                                            y0, y, temp, k_vecs, jac);
+  }
+};
+
+}  // namespace Experimental
+}  // namespace KokkosODE
+#endif  // KOKKOSODE_ROSENBROCK_HPP
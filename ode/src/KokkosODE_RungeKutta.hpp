@@ -24,6 +24,7 @@
 #include "KokkosODE_Types.hpp"
 
 #include "KokkosODE_RungeKutta_impl.hpp"
+#include "KokkosODE_RungeKuttaBatched_impl.hpp"
 
 namespace KokkosODE {
 namespace Experimental {
@@ -125,6 +126,13 @@ struct RungeKutta {
   ///
   /// \return ode_solver_status an enum that describes success of failure
   /// of the integration method once it at terminated.
+  ///
+  /// The entries of the views can be KokkosBatched::Vector<SIMD<T>, N>, in
+  /// which case N independent systems, one per lane, are integrated by the
+  /// calling thread. Each lane keeps its own adaptive time step and the ode
+  /// receives the time and time step of the lanes as SIMD vectors. The
+  /// status returned is SUCCESS if all the lanes succeeded and the status
+  /// of the first lane that failed otherwise.
   template <class ode_type, class vec_type, class mv_type, class scalar_type>
   KOKKOS_FUNCTION static ode_solver_status Solve(
       const ode_type& ode, const KokkosODE::Experimental::ODE_params& params,
@@ -134,6 +142,141 @@ struct RungeKutta {
     return KokkosODE::Impl::RKSolve(ode, table, params, t_start, t_end, y0, y,
                                     temp, k_vecs);
   }
+
+  /// \brief Solve integrates N systems stored in the lanes of
+  /// KokkosBatched::Vector<SIMD<T>, N> entries and reports the status of
+  /// each lane
+  ///
+  /// \param lane_status [out]: array of N ode_solver_status
+  ///
+  /// See the Solve overload above for the other parameters.
+  template <class ode_type, class vec_type, class mv_type, class scalar_type,
+            int N>
+  KOKKOS_FUNCTION static ode_solver_status Solve(
+      const ode_type& ode, const KokkosODE::Experimental::ODE_params& params,
+      const scalar_type t_start, const scalar_type t_end, const vec_type& y0,
+      const vec_type& y, const vec_type& temp, const mv_type& k_vecs,
+      ode_solver_status (&lane_status)[N]) {
+    static_assert(N == vec_type::non_const_value_type::vector_length,
+                  "lane_status needs one entry per SIMD lane");
+    table_type table;
+    return KokkosODE::Impl::RKSolveSIMD(ode, table, params, t_start, t_end, y0,
+                                        y, temp, k_vecs, lane_status);
+  }
+
+  /// \brief Solve integrates an ordinary differential equation and
+  /// interpolates its solution at given output times
+  ///
+  /// The time steps are not shortened to hit the output times, the solution
+  /// at these times is obtained from the cubic Hermite interpolant of the
+  /// step that contains them. The interpolant uses the solution and its
+  /// derivative at both ends of the step which the integrator computes
+  /// anyway (last stage of FSAL methods, first stage of the next step
+  /// otherwise). Methods with a single stage (RKFE) are not supported.
+  ///
+  /// \tparam times_type a rank-1 view
+  /// \tparam out_type a rank-2 view
+  ///
+  /// \param t_out [in]: output times, sorted in increasing order and in
+  /// [t_start, t_end]
+  /// \param y_out [out]: (num_outputs x neqs) solution at the output times
+  ///
+  /// See the Solve overload above for the other parameters.
+  template <class ode_type, class vec_type, class mv_type, class times_type,
+            class out_type, class scalar_type>
+  KOKKOS_FUNCTION static ode_solver_status Solve(
+      const ode_type& ode, const KokkosODE::Experimental::ODE_params& params,
+      const scalar_type t_start, const scalar_type t_end, const vec_type& y0,
+      const vec_type& y, const vec_type& temp, const mv_type& k_vecs,
+      const times_type& t_out, const out_type& y_out) {
+    table_type table;
+    scalar_type t_stop;
+    return KokkosODE::Impl::RKSolve(ode, table, params, t_start, t_end, y0, y,
+                                    temp, k_vecs, t_out, y_out,
+                                    KokkosODE::Impl::NoEvent(), t_stop);
+  }
+
+  /// \brief Solve integrates an ordinary differential equation until
+  /// t_end or until an event occurs
+  ///
+  /// The event is the first sign change of event(t, y) which is evaluated
+  /// at the end of each time step. Once a sign change is detected its time
+  /// is located by root finding (Illinois method) on the dense output
+  /// interpolant, so no additional evaluation of the ode is needed, and the
+  /// integration stops there with the status EVENT.
+  ///
+  /// \tparam event_type a type providing
+  /// KOKKOS_FUNCTION scalar_type operator()(scalar_type t, vec_type y) const
+  ///
+  /// \param event [in]: function whose sign change defines the event
+  /// \param t_event [out]: time at which the integration stopped, i.e. the
+  /// time of the event when the status is EVENT
+  ///
+  /// y0 and y are set to the solution at t_event, see the Solve overloads
+  /// above for the other parameters.
+  template <class ode_type, class vec_type, class mv_type, class times_type,
+            class out_type, class event_type, class scalar_type>
+  KOKKOS_FUNCTION static ode_solver_status Solve(
+      const ode_type& ode, const KokkosODE::Experimental::ODE_params& params,
+      const scalar_type t_start, const scalar_type t_end, const vec_type& y0,
+      const vec_type& y, const vec_type& temp, const mv_type& k_vecs,
+      const times_type& t_out, const out_type& y_out, const event_type& event,
+      scalar_type& t_event) {
+    table_type table;
+    return KokkosODE::Impl::RKSolve(ode, table, params, t_start, t_end, y0, y,
+                                    temp, k_vecs, t_out, y_out, event,
+                                    t_event);
+  }
+
+  /// \brief SolveBatched integrates a batch of ordinary differential
+  /// equations, each system with its own adaptive time step
+  ///
+  /// Each system of the batch is integrated exactly as Solve would, but
+  /// the systems are advanced by passes of at most steps_per_pass time
+  /// steps. Between passes the systems that still need to be integrated are
+  /// regrouped at the front of the work list, so systems whose number of
+  /// steps diverge (e.g. stiff cells next to non-stiff ones) do not keep
+  /// the threads of the finished systems idle. This function is called from
+  /// host and launches its own kernels on the execution space instance.
+  ///
+  /// The ode either provides evaluate_function(t, dt, y, f), shared by all
+  /// the systems, or evaluate_function(sysIdx, t, dt, y, f) when the
+  /// systems have different parameters.
+  ///
+  /// \tparam execution_space the execution space of the kernels
+  /// \tparam ode_type the type of the ode object to integrated
+  /// \tparam mv_type a rank-2 view, one row per system
+  /// \tparam kv_type a rank-3 view
+  /// \tparam status_type a rank-1 view of integers
+  /// \tparam scalar_type a floating point type
+  ///
+  /// \param space [in]: execution space instance used for the integration
+  /// \param ode [in]: the odes to integrate
+  /// \param params [in]: standard input parameters of ODE integrators,
+  /// applied to each system
+  /// \param t_start [in]: time at which the integration starts
+  /// \param t_end [in]: time at which the integration stops
+  /// \param y0 [in/out]: initial conditions of the systems, set to the
+  /// solutions at the end of the integration
+  /// \param y [out]: solutions at t_end
+  /// \param temp [in]: (num_systems x neqs) temporary storage
+  /// \param k_vecs [in]: (num_systems x num_stages x neqs) temporary storage
+  /// \param status [out]: ode_solver_status of each system
+  /// \param steps_per_pass [in]: maximum number of time steps taken by a
+  /// system before the systems are regrouped
+  template <class execution_space, class ode_type, class mv_type,
+            class kv_type, class status_type, class scalar_type>
+  static void SolveBatched(const execution_space& space, const ode_type& ode,
+                           const KokkosODE::Experimental::ODE_params& params,
+                           const scalar_type t_start, const scalar_type t_end,
+                           const mv_type& y0, const mv_type& y,
+                           const mv_type& temp, const kv_type& k_vecs,
+                           const status_type& status,
+                           const int steps_per_pass = 32) {
+    KokkosODE::Impl::RKSolveBatched<table_type>(space, ode, params, t_start,
+                                                t_end, y0, y, temp, k_vecs,
+                                                status, steps_per_pass);
+  }
 };
 
 }  // namespace Experimental
@@ -0,0 +1,201 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSODE_SPARSEJACOBIAN_HPP
+#define KOKKOSODE_SPARSEJACOBIAN_HPP
+
+/// \file KokkosODE_SparseJacobian.hpp
+
+#include <set>
+#include <vector>
+
+#include "Kokkos_Core.hpp"
+
+#include "KokkosODE_SparseJacobian_impl.hpp"
+
+namespace KokkosODE {
+namespace Experimental {
+
+/// \brief SparseJacobian describes the sparsity of the Jacobian of a system
+/// of equations so that implicit solvers can compute it by colored finite
+/// differences and factor it without forming dense matrices.
+///
+/// The pattern stored is the pattern of the LU factors of the Jacobian: it
+/// contains the diagonal and the fill-in created by the factorization, so a
+/// system needs jac.nnz() values instead of neqs*neqs. The pattern and the
+/// column coloring are shared by all the systems of a batch, only the
+/// values are per system. Use create_sparse_jacobian to build it.
+///
+/// \tparam IntViewType a rank-1 view of integers
+template <class IntViewType>
+struct SparseJacobian {
+  /// row offsets of the LU pattern
+  IntViewType row_ptr;
+  /// sorted column indices of the LU pattern
+  IntViewType col_idx;
+  /// position of the diagonal entry of each row in col_idx
+  IntViewType diag_idx;
+  /// 1 for the entries of the Jacobian pattern, 0 for the fill-in
+  IntViewType in_jacobian;
+  /// color of each column, in [0, num_colors)
+  IntViewType colors;
+  int num_colors;
+
+  KOKKOS_FUNCTION
+  int neqs() const { return static_cast<int>(row_ptr.extent(0)) - 1; }
+
+  KOKKOS_FUNCTION
+  int nnz() const { return static_cast<int>(col_idx.extent(0)); }
+};
+
+/// \brief create_sparse_jacobian builds the SparseJacobian of a Jacobian
+/// pattern, this is a host function called once for a batch of systems.
+///
+/// The columns of the Jacobian are colored so that no two columns of the
+/// same color have an entry in the same row. Such a coloring is obtained
+/// with KokkosGraph::Experimental::bipartite_color_columns (distance-2
+/// coloring of the columns) on the Jacobian pattern; when colors is empty a
+/// greedy coloring is computed on the host instead.
+///
+/// \tparam IntViewType a rank-1 view of integers
+///
+/// \param row_ptr [in]: row offsets of the Jacobian pattern
+/// \param col_idx [in]: column indices of the Jacobian pattern
+/// \param colors [in]: color of each column (any integer labels) or an
+/// empty view
+///
+/// \return the SparseJacobian with views allocated in the memory space of
+/// IntViewType
+template <class IntViewType>
+SparseJacobian<IntViewType> create_sparse_jacobian(
+    const IntViewType& row_ptr, const IntViewType& col_idx,
+    const IntViewType& colors = IntViewType()) {
+  const int neqs = static_cast<int>(row_ptr.extent(0)) - 1;
+
+  auto row_ptr_h = Kokkos::create_mirror_view(row_ptr);
+  auto col_idx_h = Kokkos::create_mirror_view(col_idx);
+  Kokkos::deep_copy(row_ptr_h, row_ptr);
+  Kokkos::deep_copy(col_idx_h, col_idx);
+
+  // Symbolic LU factorization without pivoting: row i of the factors is
+  // the union of row i of the Jacobian, the diagonal and the rows of U
+  // of the columns k < i it contains.
+  std::vector<std::vector<int>> lu_rows(neqs);
+  std::vector<int> lu_row_ptr(neqs + 1, 0), lu_col_idx, lu_diag_idx(neqs),
+      lu_in_jacobian;
+  for (int rowIdx = 0; rowIdx < neqs; ++rowIdx) {
+    std::set<int> row_pattern{rowIdx};
+    for (int entryIdx = row_ptr_h(rowIdx); entryIdx < row_ptr_h(rowIdx + 1);
+         ++entryIdx) {
+      row_pattern.insert(col_idx_h(entryIdx));
+    }
+    for (auto colIt = row_pattern.begin(); *colIt < rowIdx; ++colIt) {
+      for (const int colIdx : lu_rows[*colIt]) {
+        if (colIdx > *colIt) row_pattern.insert(colIdx);
+      }
+    }
+    lu_rows[rowIdx].assign(row_pattern.begin(), row_pattern.end());
+
+    std::set<int> jac_pattern;
+    for (int entryIdx = row_ptr_h(rowIdx); entryIdx < row_ptr_h(rowIdx + 1);
+         ++entryIdx) {
+      jac_pattern.insert(col_idx_h(entryIdx));
+    }
+    for (const int colIdx : lu_rows[rowIdx]) {
+      if (colIdx == rowIdx) lu_diag_idx[rowIdx] = lu_col_idx.size();
+      lu_col_idx.push_back(colIdx);
+      lu_in_jacobian.push_back(jac_pattern.count(colIdx) > 0 ? 1 : 0);
+    }
+    lu_row_ptr[rowIdx + 1] = lu_col_idx.size();
+  }
+
+  // Column coloring, the labels are renumbered to [0, num_colors)
+  std::vector<int> lu_colors(neqs, -1);
+  int num_colors = 0;
+  if (static_cast<int>(colors.extent(0)) == neqs) {
+    auto colors_h = Kokkos::create_mirror_view(colors);
+    Kokkos::deep_copy(colors_h, colors);
+    std::vector<int> labels;
+    for (int colIdx = 0; colIdx < neqs; ++colIdx) {
+      int color = 0;
+      while ((color < num_colors) && (labels[color] != colors_h(colIdx)))
+        ++color;
+      if (color == num_colors) {
+        labels.push_back(colors_h(colIdx));
+        ++num_colors;
+      }
+      lu_colors[colIdx] = color;
+    }
+  } else {
+    std::vector<std::vector<int>> col_rows(neqs);
+    for (int rowIdx = 0; rowIdx < neqs; ++rowIdx) {
+      for (int entryIdx = row_ptr_h(rowIdx);
+           entryIdx < row_ptr_h(rowIdx + 1); ++entryIdx) {
+        col_rows[col_idx_h(entryIdx)].push_back(rowIdx);
+      }
+    }
+    std::vector<int> forbidden(neqs, -1);
+    for (int colIdx = 0; colIdx < neqs; ++colIdx) {
+      for (const int rowIdx : col_rows[colIdx]) {
+        for (int entryIdx = row_ptr_h(rowIdx);
+             entryIdx < row_ptr_h(rowIdx + 1); ++entryIdx) {
+          const int color = lu_colors[col_idx_h(entryIdx)];
+          if (color >= 0) forbidden[color] = colIdx;
+        }
+      }
+      int color = 0;
+      while (forbidden[color] == colIdx) ++color;
+      lu_colors[colIdx] = color;
+      num_colors        = Kokkos::max(num_colors, color + 1);
+    }
+  }
+
+  SparseJacobian<IntViewType> jac;
+  jac.row_ptr     = IntViewType("LU row offsets", neqs + 1);
+  jac.col_idx     = IntViewType("LU column indices", lu_col_idx.size());
+  jac.diag_idx    = IntViewType("LU diagonal indices", neqs);
+  jac.in_jacobian = IntViewType("LU Jacobian entries", lu_col_idx.size());
+  jac.colors      = IntViewType("column colors", neqs);
+  jac.num_colors  = num_colors;
+
+  auto lu_row_ptr_h     = Kokkos::create_mirror_view(jac.row_ptr);
+  auto lu_col_idx_h     = Kokkos::create_mirror_view(jac.col_idx);
+  auto lu_diag_idx_h    = Kokkos::create_mirror_view(jac.diag_idx);
+  auto lu_in_jacobian_h = Kokkos::create_mirror_view(jac.in_jacobian);
+  auto lu_colors_h      = Kokkos::create_mirror_view(jac.colors);
+  for (int rowIdx = 0; rowIdx < neqs + 1; ++rowIdx) {
+    lu_row_ptr_h(rowIdx) = lu_row_ptr[rowIdx];
+  }
+  for (int rowIdx = 0; rowIdx < neqs; ++rowIdx) {
+    lu_diag_idx_h(rowIdx) = lu_diag_idx[rowIdx];
+    lu_colors_h(rowIdx)   = lu_colors[rowIdx];
+  }
+  for (size_t entryIdx = 0; entryIdx < lu_col_idx.size(); ++entryIdx) {
+    lu_col_idx_h(entryIdx)     = lu_col_idx[entryIdx];
+    lu_in_jacobian_h(entryIdx) = lu_in_jacobian[entryIdx];
+  }
+  Kokkos::deep_copy(jac.row_ptr, lu_row_ptr_h);
+  Kokkos::deep_copy(jac.col_idx, lu_col_idx_h);
+  Kokkos::deep_copy(jac.diag_idx, lu_diag_idx_h);
+  Kokkos::deep_copy(jac.in_jacobian, lu_in_jacobian_h);
+  Kokkos::deep_copy(jac.colors, lu_colors_h);
+
+  return jac;
+}
+
+}  // namespace Experimental
+}  // namespace KokkosODE
+#endif  // KOKKOSODE_SPARSEJACOBIAN_HPP
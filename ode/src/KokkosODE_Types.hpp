@@ -20,7 +20,8 @@
 namespace KokkosODE {
 namespace Experimental {
 
-enum ode_solver_status { SUCCESS = 0, MAX_STEP = 1, MIN_SIZE = 2 };
+// EVENT: the integration stopped at an event before reaching t_end
+enum ode_solver_status { SUCCESS = 0, MAX_STEP = 1, MIN_SIZE = 2, EVENT = 3 };
 
 struct ODE_params {
   bool adaptivity;
@@ -62,6 +63,26 @@ struct Newton_params {
   int max_iters, iters = 0;
   double abs_tol, rel_tol;
 
+  // Jacobian lagging (modified Newton): the LU factors of the Jacobian
+  // are kept for up to max_jacobian_age iterations, possibly spanning
+  // several solves, and refreshed earlier when the convergence rate of
+  // the iterations exceeds jacobian_rate_threshold. The default value
+  // max_jacobian_age = 1 evaluates and factors the Jacobian at every
+  // iteration. The state of the lagged factors is owned by the caller,
+  // see KokkosODE::Experimental::Newton::Solve.
+  int max_jacobian_age           = 1;
+  double jacobian_rate_threshold = 0.3;
+
+  // Backtracking line search of TeamNewton and TeamVectorNewton: a step
+  // is accepted once the residual norm decreased by a fraction
+  // line_search_decrease of the step length, otherwise the step is
+  // shortened by line_search_reduction, up to max_line_search_iters
+  // times. The default value max_line_search_iters = 0 takes full
+  // Newton steps.
+  int max_line_search_iters    = 0;
+  double line_search_reduction = 0.5;
+  double line_search_decrease  = 1e-4;
+
   // Constructor that sets basic solver parameters
   // used while solving the nonlinear system
   // int max_iters_  [in]: maximum number of iterations allowed
@@ -71,6 +92,21 @@ struct Newton_params {
   Newton_params(const int max_iters_, const double abs_tol_,
                 const double rel_tol_)
       : max_iters(max_iters_), abs_tol(abs_tol_), rel_tol(rel_tol_) {}
+
+  // Constructor that also enables Jacobian lagging
+  // int max_jacobian_age_           [in]: maximum number of iterations
+  //                                       that reuse the same factors
+  // double jacobian_rate_threshold_ [in]: convergence rate above which
+  //                                       lagged factors are refreshed
+  KOKKOS_FUNCTION
+  Newton_params(const int max_iters_, const double abs_tol_,
+                const double rel_tol_, const int max_jacobian_age_,
+                const double jacobian_rate_threshold_ = 0.3)
+      : max_iters(max_iters_),
+        abs_tol(abs_tol_),
+        rel_tol(rel_tol_),
+        max_jacobian_age(max_jacobian_age_),
+        jacobian_rate_threshold(jacobian_rate_threshold_) {}
 };
 
 }  // namespace Experimental
@@ -23,5 +23,6 @@
 // Implicit integrators
 #include "Test_ODE_Newton.hpp"
 #include "Test_ODE_BDF.hpp"
+#include "Test_ODE_Rosenbrock.hpp"
 
 #endif  // TEST_ODE_HPP
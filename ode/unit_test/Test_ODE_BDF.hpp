@@ -176,18 +176,101 @@ struct BDFSolve_wrapper {
   }
 };
 
+// Reaction-diffusion on a 1D grid with zero Dirichlet boundary
+// conditions, the Jacobian is tridiagonal.
+//
+// Equations: y_i' = k*(y_{i-1} - 2*y_i + y_{i+1}) - y_i**2
+// Jacobian:  df_i/dy_{i-1} = df_i/dy_{i+1} = k
+//            df_i/dy_i     = -2*k - 2*y_i
+struct ReactionDiffusion {
+  const int neqs;
+  const double k;
+
+  ReactionDiffusion(const int neqs_, const double k_) : neqs(neqs_), k(k_) {}
+
+  template <class vec_type1, class vec_type2>
+  KOKKOS_FUNCTION void evaluate_function(const double /*t*/,
+                                         const double /*dt*/,
+                                         const vec_type1& y,
+                                         const vec_type2& f) const {
+    for (int eqIdx = 0; eqIdx < neqs; ++eqIdx) {
+      const double y_left  = (eqIdx > 0) ? y(eqIdx - 1) : 0.0;
+      const double y_right = (eqIdx < neqs - 1) ? y(eqIdx + 1) : 0.0;
+      f(eqIdx) = k * (y_left - 2 * y(eqIdx) + y_right) - y(eqIdx) * y(eqIdx);
+    }
+  }
+
+  template <class vec_type, class mat_type>
+  KOKKOS_FUNCTION void evaluate_jacobian(const double /*t*/,
+                                         const double /*dt*/, const vec_type& y,
+                                         const mat_type& jac) const {
+    for (int rowIdx = 0; rowIdx < neqs; ++rowIdx) {
+      for (int colIdx = 0; colIdx < neqs; ++colIdx) {
+        jac(rowIdx, colIdx) = 0.0;
+      }
+      if (rowIdx > 0) jac(rowIdx, rowIdx - 1) = k;
+      jac(rowIdx, rowIdx) = -2 * k - 2 * y(rowIdx);
+      if (rowIdx < neqs - 1) jac(rowIdx, rowIdx + 1) = k;
+    }
+  }
+};
+
+template <class ode_type, KokkosODE::Experimental::BDF_type bdf_type,
+          class vec_type, class mv_type, class jac_type, class scalar_type>
+struct BDFSparseSolve_wrapper {
+  ode_type my_ode;
+  scalar_type tstart, tend;
+  int num_steps;
+  vec_type y_old, y_new, rhs, update, scale;
+  mv_type y_vecs, kstack;
+  jac_type jac;
+  vec_type values, r_pert, y_save;
+
+  BDFSparseSolve_wrapper(const ode_type& my_ode_, const scalar_type tstart_,
+                         const scalar_type tend_, const int num_steps_,
+                         const vec_type& y_old_, const vec_type& y_new_,
+                         const vec_type& rhs_, const vec_type& update_,
+                         const vec_type& scale_, const mv_type& y_vecs_,
+                         const mv_type& kstack_, const jac_type& jac_,
+                         const vec_type& values_, const vec_type& r_pert_,
+                         const vec_type& y_save_)
+      : my_ode(my_ode_),
+        tstart(tstart_),
+        tend(tend_),
+        num_steps(num_steps_),
+        y_old(y_old_),
+        y_new(y_new_),
+        rhs(rhs_),
+        update(update_),
+        scale(scale_),
+        y_vecs(y_vecs_),
+        kstack(kstack_),
+        jac(jac_),
+        values(values_),
+        r_pert(r_pert_),
+        y_save(y_save_) {}
+
+  KOKKOS_FUNCTION
+  void operator()(const int /*idx*/) const {
+    KokkosODE::Experimental::BDF<bdf_type>::Solve(
+        my_ode, tstart, tend, num_steps, y_old, y_new, rhs, update, scale,
+        y_vecs, kstack, jac, values, r_pert, y_save);
+  }
+};
+
 template <class ode_type, class mat_type, class vec_type, class scalar_type>
 struct BDF_Solve_wrapper {
   const ode_type my_ode;
   const scalar_type t_start, t_end, dt, max_step;
   const vec_type y0, y_new;
   const mat_type temp, temp2;
+  const int max_jacobian_age;
 
   BDF_Solve_wrapper(const ode_type& my_ode_, const scalar_type& t_start_,
                     const scalar_type& t_end_, const scalar_type& dt_,
                     const scalar_type& max_step_, const vec_type& y0_,
                     const vec_type& y_new_, const mat_type& temp_,
-                    const mat_type& temp2_)
+                    const mat_type& temp2_, const int max_jacobian_age_ = 1)
       : my_ode(my_ode_),
         t_start(t_start_),
         t_end(t_end_),
@@ -196,11 +279,73 @@ struct BDF_Solve_wrapper {
         y0(y0_),
         y_new(y_new_),
         temp(temp_),
-        temp2(temp2_) {}
+        temp2(temp2_),
+        max_jacobian_age(max_jacobian_age_) {}
 
   KOKKOS_FUNCTION void operator()(const int) const {
     KokkosODE::Experimental::BDFSolve(my_ode, t_start, t_end, dt, max_step, y0,
-                                      y_new, temp, temp2);
+                                      y_new, temp, temp2, max_jacobian_age);
+  }
+};
+
+template <class ode_type, class mat_type, class vec_type, class event_type,
+          class scalar_type>
+struct BDF_Solve_dense_wrapper {
+  using status_type = Kokkos::View<int*, typename vec_type::memory_space>;
+
+  const ode_type my_ode;
+  const scalar_type t_start, t_end, dt, max_step;
+  const vec_type y0, y_new;
+  const mat_type temp, temp2;
+  const vec_type t_out;
+  const mat_type y_out;
+  const event_type event;
+  const vec_type t_event;
+  const status_type status;
+
+  BDF_Solve_dense_wrapper(const ode_type& my_ode_, const scalar_type& t_start_,
+                          const scalar_type& t_end_, const scalar_type& dt_,
+                          const scalar_type& max_step_, const vec_type& y0_,
+                          const vec_type& y_new_, const mat_type& temp_,
+                          const mat_type& temp2_, const vec_type& t_out_,
+                          const mat_type& y_out_, const event_type& event_,
+                          const vec_type& t_event_,
+                          const status_type& status_)
+      : my_ode(my_ode_),
+        t_start(t_start_),
+        t_end(t_end_),
+        dt(dt_),
+        max_step(max_step_),
+        y0(y0_),
+        y_new(y_new_),
+        temp(temp_),
+        temp2(temp2_),
+        t_out(t_out_),
+        y_out(y_out_),
+        event(event_),
+        t_event(t_event_),
+        status(status_) {}
+
+  KOKKOS_FUNCTION void operator()(const int) const {
+    scalar_type t_stop;
+    status(0)  = KokkosODE::Experimental::BDFSolve(
+        my_ode, t_start, t_end, dt, max_step, y0, y_new, temp, temp2, t_out,
+        y_out, event, t_stop);
+    t_event(0) = t_stop;
+  }
+};
+
+// y reaches a given value
+struct threshold_event {
+  const double value;
+
+  KOKKOS_FUNCTION
+  threshold_event(const double value_) : value(value_){};
+
+  template <class vec_type>
+  KOKKOS_FUNCTION double operator()(const double /*t*/,
+                                    const vec_type& y) const {
+    return y(0) - value;
   }
 };
 
@@ -804,6 +949,306 @@ void test_BDF_adaptive_stiff() {
             << y_new_h(1) << ", " << y_new_h(2) << "}" << std::endl;
 }
 
+template <class Device, class scalar_type>
+void test_BDF_adaptive_stiff_lagging() {
+  using execution_space = typename Device::execution_space;
+  using vec_type        = Kokkos::View<scalar_type*, execution_space>;
+  using mat_type        = Kokkos::View<scalar_type**, execution_space>;
+  using KAT             = Kokkos::ArithTraits<scalar_type>;
+
+  StiffChemistry mySys{};
+
+  const scalar_type t_start = KAT::zero(), t_end = 350 * KAT::one();
+  scalar_type dt = KAT::zero();
+  vec_type y0("initial conditions", mySys.neqs), y_new("solution", mySys.neqs);
+  auto y0_h    = Kokkos::create_mirror_view(y0);
+  auto y_new_h = Kokkos::create_mirror_view(y_new);
+  Kokkos::View<scalar_type*, Kokkos::HostSpace> y_ref("reference", mySys.neqs);
+
+  mat_type temp("buffer1", mySys.neqs, 23 + 2 * mySys.neqs + 4),
+      temp2("buffer2", 6, 7);
+
+  Kokkos::RangePolicy<execution_space> policy(0, 1);
+
+  // Reference: Jacobian recomputed at every Newton iteration,
+  // then factors reused for up to 10 and 50 Newton iterations.
+  for (const int max_jacobian_age : {1, 10, 50}) {
+    y0_h(0) = KAT::one();
+    y0_h(1) = KAT::zero();
+    y0_h(2) = KAT::zero();
+    Kokkos::deep_copy(y0, y0_h);
+    Kokkos::deep_copy(temp, KAT::zero());
+    Kokkos::deep_copy(temp2, KAT::zero());
+
+    BDF_Solve_wrapper bdf_wrapper(mySys, t_start, t_end, dt,
+                                  (t_end - t_start) / 10, y0, y_new, temp,
+                                  temp2, max_jacobian_age);
+    Kokkos::parallel_for(policy, bdf_wrapper);
+    Kokkos::deep_copy(y_new_h, y_new);
+
+    // The Newton updates conserve the total mass
+    // whichever Jacobian factors are used.
+    EXPECT_NEAR_KK(y_new_h(0) + y_new_h(1) + y_new_h(2), KAT::one(), 1e-8);
+    if (max_jacobian_age == 1) {
+      Kokkos::deep_copy(y_ref, y_new_h);
+    } else {
+      EXPECT_NEAR_KK_REL(y_new_h(0), y_ref(0), 1e-2);
+      EXPECT_NEAR_KK(y_new_h(1), y_ref(1), 1e-5);
+      EXPECT_NEAR_KK_REL(y_new_h(2), y_ref(2), 1e-2);
+    }
+  }
+}
+
+template <class Device, class scalar_type>
+void test_BDF_sparse_jacobian() {
+  using execution_space = typename Device::execution_space;
+  using vec_type        = Kokkos::View<scalar_type*, execution_space>;
+  using mv_type         = Kokkos::View<scalar_type**, execution_space>;
+  using int_view        = Kokkos::View<int*, execution_space>;
+  using jac_type        = KokkosODE::Experimental::SparseJacobian<int_view>;
+
+  constexpr int neqs = 20;
+  ReactionDiffusion mySys(neqs, 100.0);
+  const scalar_type t_start = 0.0, t_end = 1.0;
+  constexpr int num_steps = 200;
+
+  // Tridiagonal Jacobian pattern
+  int_view row_ptr("row offsets", neqs + 1),
+      col_idx("column indices", 3 * neqs - 2);
+  auto row_ptr_h = Kokkos::create_mirror_view(row_ptr);
+  auto col_idx_h = Kokkos::create_mirror_view(col_idx);
+  int nnz        = 0;
+  for (int rowIdx = 0; rowIdx < neqs; ++rowIdx) {
+    row_ptr_h(rowIdx) = nnz;
+    for (int colIdx = Kokkos::max(rowIdx - 1, 0);
+         colIdx < Kokkos::min(rowIdx + 2, neqs); ++colIdx) {
+      col_idx_h(nnz) = colIdx;
+      ++nnz;
+    }
+  }
+  row_ptr_h(neqs) = nnz;
+  Kokkos::deep_copy(row_ptr, row_ptr_h);
+  Kokkos::deep_copy(col_idx, col_idx_h);
+  const auto jac =
+      KokkosODE::Experimental::create_sparse_jacobian(row_ptr, col_idx);
+  // no fill-in for a tridiagonal matrix and three colors
+  EXPECT_EQ(jac.nnz(), 3 * neqs - 2);
+  EXPECT_EQ(jac.num_colors, 3);
+
+  vec_type y0("initial conditions", neqs), y_new("solution", neqs);
+  vec_type rhs("rhs", neqs), update("update", neqs);
+  vec_type scale("scaling factors", neqs);
+  vec_type values("LU values", jac.nnz()), r_pert("perturbed residual", neqs),
+      y_save("saved solution", neqs);
+  mv_type dense_jac("jacobian", neqs, neqs),
+      temp("temp storage", neqs, neqs + 4);
+  mv_type kstack("Startup RK vectors", 6, neqs);
+  mv_type y_vecs("history vectors", neqs, 3);
+  Kokkos::deep_copy(scale, 1);
+
+  auto y0_h    = Kokkos::create_mirror_view(y0);
+  auto y_new_h = Kokkos::create_mirror_view(y_new);
+  Kokkos::View<scalar_type*, Kokkos::HostSpace> y_ref("reference", neqs);
+  auto set_initial_conditions = [&]() {
+    for (int eqIdx = 0; eqIdx < neqs; ++eqIdx) {
+      y0_h(eqIdx) = Kokkos::sin(3.14159265358979 * (eqIdx + 1) / (neqs + 1));
+    }
+    Kokkos::deep_copy(y0, y0_h);
+    Kokkos::deep_copy(y_vecs, 0.0);
+  };
+
+  Kokkos::RangePolicy<execution_space> myPolicy(0, 1);
+
+  // Reference with the dense analytical Jacobian
+  set_initial_conditions();
+  BDFSolve_wrapper<ReactionDiffusion, KokkosODE::Experimental::BDF_type::BDF3,
+                   vec_type, mv_type, mv_type, scalar_type>
+      dense_wrapper(mySys, t_start, t_end, num_steps, y0, y_new, rhs, update,
+                    scale, y_vecs, kstack, temp, dense_jac);
+  Kokkos::parallel_for(myPolicy, dense_wrapper);
+  Kokkos::deep_copy(y_new_h, y_new);
+  Kokkos::deep_copy(y_ref, y_new_h);
+
+  // Sparse Jacobian computed by colored finite differences
+  set_initial_conditions();
+  BDFSparseSolve_wrapper<ReactionDiffusion,
+                         KokkosODE::Experimental::BDF_type::BDF3, vec_type,
+                         mv_type, jac_type, scalar_type>
+      sparse_wrapper(mySys, t_start, t_end, num_steps, y0, y_new, rhs, update,
+                     scale, y_vecs, kstack, jac, values, r_pert, y_save);
+  Kokkos::parallel_for(myPolicy, sparse_wrapper);
+  Kokkos::deep_copy(y_new_h, y_new);
+
+  for (int eqIdx = 0; eqIdx < neqs; ++eqIdx) {
+    EXPECT_NEAR_KK_REL(y_new_h(eqIdx), y_ref(eqIdx), 1e-8);
+  }
+}
+
+// The solution of the adaptive BDF is interpolated at the output times
+// and the integration stops when the logistic population reaches 90% of
+// its capacity, at t = ln(9) when starting from 50%. The solution is
+// y = 1 / (1 + exp(-t)).
+template <class Device, class scalar_type>
+void test_BDF_adaptive_dense_output() {
+  using execution_space = typename Device::execution_space;
+  using vec_type        = Kokkos::View<scalar_type*, execution_space>;
+  using mat_type        = Kokkos::View<scalar_type**, execution_space>;
+  using status_type     = Kokkos::View<int*, execution_space>;
+  using KAT             = Kokkos::ArithTraits<scalar_type>;
+  using no_event        = KokkosODE::Impl::NoEvent;
+
+  constexpr int num_out = 12;
+  Logistic mySys(1, 1);
+  const scalar_type t_start = KAT::zero(), t_end = 6 * KAT::one();
+  const scalar_type dt = KAT::zero(), t_threshold = Kokkos::log(9.0);
+
+  vec_type y0("initial conditions", mySys.neqs), y_new("solution", mySys.neqs);
+  mat_type temp("buffer1", mySys.neqs, 23 + 2 * mySys.neqs + 4),
+      temp2("buffer2", 6, 7);
+  vec_type t_out("output times", num_out), t_event("t event", 1);
+  mat_type y_out("output solution", num_out, mySys.neqs);
+  status_type status("status", 1);
+
+  auto t_out_h = Kokkos::create_mirror_view(t_out);
+  for (int outIdx = 0; outIdx < num_out; ++outIdx) {
+    t_out_h(outIdx) = 0.5 * (outIdx + 1);
+  }
+  Kokkos::deep_copy(t_out, t_out_h);
+  auto y_out_h   = Kokkos::create_mirror_view(y_out);
+  auto y_new_h   = Kokkos::create_mirror_view(y_new);
+  auto t_event_h = Kokkos::create_mirror_view(t_event);
+  auto status_h  = Kokkos::create_mirror_view(status);
+  Kokkos::RangePolicy<execution_space> policy(0, 1);
+
+  // Dense output only, the last output time is t_end
+  Kokkos::deep_copy(y0, 0.5);
+  Kokkos::parallel_for(
+      policy, BDF_Solve_dense_wrapper(mySys, t_start, t_end, dt,
+                                      (t_end - t_start) / 10, y0, y_new, temp,
+                                      temp2, t_out, y_out, no_event(), t_event,
+                                      status));
+  Kokkos::deep_copy(y_out_h, y_out);
+  Kokkos::deep_copy(y_new_h, y_new);
+  Kokkos::deep_copy(status_h, status);
+  EXPECT_EQ(status_h(0), KokkosODE::Experimental::ode_solver_status::SUCCESS);
+  EXPECT_NEAR_KK_REL(y_out_h(num_out - 1, 0), y_new_h(0), 1e-14);
+  for (int outIdx = 0; outIdx < num_out; ++outIdx) {
+    EXPECT_NEAR_KK_REL(y_out_h(outIdx, 0),
+                       1 / (1 + Kokkos::exp(-t_out_h(outIdx))), 1e-2);
+  }
+
+  // Stop at the event, the output times after it are not filled
+  Kokkos::deep_copy(y0, 0.5);
+  Kokkos::deep_copy(y_out, KAT::zero());
+  Kokkos::deep_copy(temp, KAT::zero());
+  Kokkos::deep_copy(temp2, KAT::zero());
+  Kokkos::parallel_for(
+      policy, BDF_Solve_dense_wrapper(mySys, t_start, t_end, dt,
+                                      (t_end - t_start) / 10, y0, y_new, temp,
+                                      temp2, t_out, y_out, threshold_event(0.9),
+                                      t_event, status));
+  Kokkos::deep_copy(y_out_h, y_out);
+  Kokkos::deep_copy(y_new_h, y_new);
+  Kokkos::deep_copy(t_event_h, t_event);
+  Kokkos::deep_copy(status_h, status);
+  EXPECT_EQ(status_h(0), KokkosODE::Experimental::ode_solver_status::EVENT);
+  EXPECT_NEAR_KK_REL(t_event_h(0), t_threshold, 1e-2);
+  EXPECT_NEAR_KK(y_new_h(0), 0.9, 1e-12);
+  for (int outIdx = 0; outIdx < num_out; ++outIdx) {
+    if (t_out_h(outIdx) < t_event_h(0)) {
+      EXPECT_NEAR_KK_REL(y_out_h(outIdx, 0),
+                         1 / (1 + Kokkos::exp(-t_out_h(outIdx))), 1e-2);
+    } else {
+      EXPECT_EQ(y_out_h(outIdx, 0), KAT::zero());
+    }
+  }
+}
+
+// Logistic equations with one growth rate per SIMD lane, the time
+// arguments are templated since the RK start-up steps pass one time per lane.
+template <class rate_type>
+struct simd_logistic {
+  static constexpr int neqs = 1;
+
+  const rate_type r;
+
+  simd_logistic(const rate_type& r_) : r(r_){};
+
+  template <class time_type, class vec_type1, class vec_type2>
+  KOKKOS_FUNCTION void evaluate_function(const time_type& /*t*/,
+                                         const time_type& /*dt*/,
+                                         const vec_type1& y,
+                                         const vec_type2& f) const {
+    f(0) = r * y(0) * (1.0 - y(0));
+  }
+
+  template <class time_type, class vec_type, class mat_type>
+  KOKKOS_FUNCTION void evaluate_jacobian(const time_type& /*t*/,
+                                         const time_type& /*dt*/,
+                                         const vec_type& y,
+                                         const mat_type& jac) const {
+    jac(0, 0) = r - 2 * r * y(0);
+  }
+};  // simd_logistic
+
+// Each lane of a SIMD integration must match the integration of its
+// system on its own.
+template <KokkosODE::Experimental::BDF_type bdf_type>
+void test_BDF_simd_method() {
+  using simd_type     = KokkosBatched::Vector<KokkosBatched::SIMD<double>, 4>;
+  using solver_type   = KokkosODE::Experimental::BDF<bdf_type>;
+  using vec_type      = Kokkos::View<double*, Kokkos::HostSpace>;
+  using mat_type      = Kokkos::View<double**, Kokkos::HostSpace>;
+  using simd_vec_type = Kokkos::View<simd_type*, Kokkos::HostSpace>;
+  using simd_mat_type = Kokkos::View<simd_type**, Kokkos::HostSpace>;
+  constexpr int nlanes = simd_type::vector_length;
+
+  const int order            = solver_type::table_type::order;
+  constexpr int num_steps    = 128;
+  constexpr double t_start   = 0, t_end = 6;
+  const double rates[nlanes] = {0.5, 1, 2, 4};
+  constexpr int neqs         = 1;
+
+  simd_type r;
+  for (int lane = 0; lane < nlanes; ++lane) r[lane] = rates[lane];
+  simd_vec_type y0("initial conditions", neqs), y_new("solution", neqs);
+  simd_vec_type rhs("rhs", neqs), update("update", neqs);
+  simd_vec_type scale("scaling factors", neqs);
+  simd_mat_type jac("jacobian", neqs, neqs),
+      temp("temp storage", neqs, neqs + 4);
+  simd_mat_type y_vecs("history vectors", neqs, order),
+      kstack("Startup RK vectors", 6, neqs);
+  Kokkos::deep_copy(y0, simd_type(0.5));
+  Kokkos::deep_copy(scale, simd_type(1));
+  solver_type::Solve(simd_logistic<simd_type>(r), t_start, t_end, num_steps,
+                     y0, y_new, rhs, update, scale, y_vecs, kstack, temp, jac);
+
+  for (int lane = 0; lane < nlanes; ++lane) {
+    vec_type y0_ref("initial conditions", neqs), y_ref("solution", neqs);
+    vec_type rhs_ref("rhs", neqs), update_ref("update", neqs);
+    vec_type scale_ref("scaling factors", neqs);
+    mat_type jac_ref("jacobian", neqs, neqs),
+        temp_ref("temp storage", neqs, neqs + 4);
+    mat_type y_vecs_ref("history vectors", neqs, order),
+        kstack_ref("Startup RK vectors", 6, neqs);
+    Kokkos::deep_copy(y0_ref, 0.5);
+    Kokkos::deep_copy(scale_ref, 1);
+    solver_type::Solve(Logistic(rates[lane], 1), t_start, t_end, num_steps,
+                       y0_ref, y_ref, rhs_ref, update_ref, scale_ref,
+                       y_vecs_ref, kstack_ref, temp_ref, jac_ref);
+
+    EXPECT_NEAR_KK_REL(y_new(0)[lane], y_ref(0), 1e-12);
+    EXPECT_NEAR_KK_REL(y_new(0)[lane],
+                       1 / (1 + Kokkos::exp(-rates[lane] * t_end)), 1e-2);
+  }
+}  // test_BDF_simd_method
+
+void test_BDF_simd() {
+  test_BDF_simd_method<KokkosODE::Experimental::BDF_type::BDF1>();
+  test_BDF_simd_method<KokkosODE::Experimental::BDF_type::BDF2>();
+  test_BDF_simd_method<KokkosODE::Experimental::BDF_type::BDF3>();
+}  // test_BDF_simd
+
 }  // namespace Test
 
 TEST_F(TestCategory, BDF_Logistic_serial) {
@@ -815,6 +1260,9 @@ TEST_F(TestCategory, BDF_LotkaVolterra_serial) {
 TEST_F(TestCategory, BDF_StiffChemistry_serial) {
   ::Test::test_BDF_StiffChemistry<TestDevice, double>();
 }
+TEST_F(TestCategory, BDF_sparse_jacobian) {
+  ::Test::test_BDF_sparse_jacobian<TestDevice, double>();
+}
 // TEST_F(TestCategory, BDF_parallel_serial) {
 //   ::Test::test_BDF_parallel<TestDevice, double>();
 // }
@@ -828,3 +1276,10 @@ TEST_F(TestCategory, BDF_Nordsieck) {
 TEST_F(TestCategory, BDF_StiffChemistry_adaptive) {
   ::Test::test_BDF_adaptive_stiff<TestDevice, double>();
 }
+TEST_F(TestCategory, BDF_StiffChemistry_adaptive_lagging) {
+  ::Test::test_BDF_adaptive_stiff_lagging<TestDevice, double>();
+}
+TEST_F(TestCategory, BDF_adaptive_dense_output) {
+  ::Test::test_BDF_adaptive_dense_output<TestDevice, double>();
+}
+TEST_F(TestCategory, BDF_simd) { ::Test::test_BDF_simd(); }
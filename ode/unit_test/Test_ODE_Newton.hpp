@@ -462,6 +462,322 @@ void test_simple_systems() {
   }
 }
 
+// Line crossing a parabola
+// Equations:  f0 = y - 2 = 0
+//             f1 = x**2 + y - 6 = 0
+//
+// Jacobian:   J00 = 0         J01 = 1
+//             J10 = 2*x       J11 = 1
+//
+// Solution:   x = +/- 2       y = 2
+//
+// The first diagonal entry of the Jacobian is zero,
+// its LU factorization needs pivoting.
+template <typename Device, typename scalar_type>
+struct LineParabolaIntersection {
+  using vec_type = Kokkos::View<scalar_type*, Device>;
+  using mat_type = Kokkos::View<scalar_type**, Device>;
+
+  static constexpr int neqs = 2;
+
+  LineParabolaIntersection() {}
+
+  KOKKOS_FUNCTION void residual(const vec_type& y, const vec_type& f) const {
+    f(0) = y(1) - 2;
+    f(1) = y(0) * y(0) + y(1) - 6;
+  }
+
+  KOKKOS_FUNCTION void jacobian(const vec_type& y, const mat_type& jac) const {
+    jac(0, 0) = 0;
+    jac(0, 1) = 1;
+    jac(1, 0) = 2 * y(0);
+    jac(1, 1) = 1;
+  }
+};
+
+// Solve one system per idx with Jacobian lagging, each system carries
+// the state of its lagged factors in jacobian_age(idx) and
+// num_jacobian_evals(idx) from one solve to the next.
+template <class system_type, class mat_type, class vec_type, class int_view,
+          class status_view>
+struct NewtonLaggingSolve_wrapper {
+  using newton_params = KokkosODE::Experimental::Newton_params;
+
+  system_type my_nls;
+  newton_params params;
+
+  vec_type x, rhs, update, scale;
+  mat_type J, tmp;
+  int_view jacobian_age, num_jacobian_evals;
+  status_view status;
+
+  NewtonLaggingSolve_wrapper(
+      const system_type& my_nls_, const newton_params& params_,
+      const vec_type& x_, const vec_type& rhs_, const vec_type& update_,
+      const vec_type& scale_, const mat_type& J_, const mat_type& tmp_,
+      const int_view& jacobian_age_, const int_view& num_jacobian_evals_,
+      const status_view& status_)
+      : my_nls(my_nls_),
+        params(params_),
+        x(x_),
+        rhs(rhs_),
+        update(update_),
+        scale(scale_),
+        J(J_),
+        tmp(tmp_),
+        jacobian_age(jacobian_age_),
+        num_jacobian_evals(num_jacobian_evals_),
+        status(status_) {}
+
+  KOKKOS_FUNCTION
+  void operator()(const int idx) const {
+    const Kokkos::pair<int, int> rows(my_nls.neqs * idx,
+                                      my_nls.neqs * (idx + 1));
+    auto local_x      = Kokkos::subview(x, rows);
+    auto local_rhs    = Kokkos::subview(rhs, rows);
+    auto local_update = Kokkos::subview(update, rows);
+    auto local_J      = Kokkos::subview(J, rows, Kokkos::ALL());
+    auto local_tmp    = Kokkos::subview(tmp, rows, Kokkos::ALL());
+
+    status(idx) = KokkosODE::Experimental::Newton::Solve(
+        my_nls, params, local_J, local_tmp, local_x, local_rhs, local_update,
+        scale, jacobian_age(idx), num_jacobian_evals(idx));
+  }
+};
+
+template <typename Device, typename scalar_type>
+void test_jacobian_lagging() {
+  using execution_space      = typename Device::execution_space;
+  using vec_type             = Kokkos::View<scalar_type*, Device>;
+  using mat_type             = Kokkos::View<scalar_type**, Device>;
+  using int_view             = Kokkos::View<int*, Device>;
+  using newton_params        = KokkosODE::Experimental::Newton_params;
+  using newton_solver_status = KokkosODE::Experimental::newton_solver_status;
+  using status_view          = Kokkos::View<newton_solver_status*, Device>;
+  using system_type          = CirclesIntersections<Device, scalar_type>;
+
+  system_type mySys{};
+  const scalar_type solution[2] = {10.75 / 6, 0.8887803753};
+
+  // Several systems are solved in the same parallel_for so that shared
+  // lagging state would show up as differences between systems.
+  constexpr int num_systems = 16;
+  const int neqs            = mySys.neqs;
+
+  vec_type scale("scaling factors", neqs);
+  Kokkos::deep_copy(scale, 1);
+  vec_type x("solution vector", num_systems * neqs),
+      rhs("rhs", num_systems * neqs), update("update", num_systems * neqs);
+  mat_type J("jacobian", num_systems * neqs, neqs),
+      tmp("temp mem", num_systems * neqs, neqs + 4);
+  int_view jacobian_age("jacobian age", num_systems),
+      num_jacobian_evals("jacobian evaluations", num_systems);
+  status_view status("Newton status", num_systems);
+  auto x_h         = Kokkos::create_mirror_view(x);
+  auto age_h       = Kokkos::create_mirror_view(jacobian_age);
+  auto num_evals_h = Kokkos::create_mirror_view(num_jacobian_evals);
+  auto status_h    = Kokkos::create_mirror_view(status);
+
+  // Factors reused for up to 1, 3 and 10 iterations
+  for (const int max_jacobian_age : {1, 3, 10}) {
+    const newton_params params(100, 1e-14, 1e-10, max_jacobian_age);
+    Kokkos::deep_copy(jacobian_age, 0);
+    Kokkos::deep_copy(num_jacobian_evals, 0);
+
+    // Newton converges quadratically and lands well below its tolerance,
+    // the lagged iterations converge linearly and stop once the estimated
+    // error is below the Newton tolerance, sqrt(rel_tol) with unit scales.
+    const double tol = (max_jacobian_age == 1) ? 1e-8 : Kokkos::sqrt(1e-10);
+
+    // The second solve starts from the factors left by the first one
+    int first_num_evals = 0;
+    for (int solveIdx = 0; solveIdx < 2; ++solveIdx) {
+      Kokkos::deep_copy(x, 1.5);
+
+      Kokkos::RangePolicy<execution_space> my_policy(0, num_systems);
+      NewtonLaggingSolve_wrapper solve_wrapper(
+          mySys, params, x, rhs, update, scale, J, tmp, jacobian_age,
+          num_jacobian_evals, status);
+      Kokkos::parallel_for(my_policy, solve_wrapper);
+
+      Kokkos::deep_copy(status_h, status);
+      Kokkos::deep_copy(x_h, x);
+      Kokkos::deep_copy(age_h, jacobian_age);
+      Kokkos::deep_copy(num_evals_h, num_jacobian_evals);
+      if (solveIdx == 0) first_num_evals = num_evals_h(0);
+      for (int sysIdx = 0; sysIdx < num_systems; ++sysIdx) {
+        EXPECT_TRUE(status_h(sysIdx) == newton_solver_status::NLS_SUCCESS)
+            << "Newton with max_jacobian_age=" << max_jacobian_age
+            << " did not converge for system " << sysIdx << "!";
+        EXPECT_NEAR_KK_REL(x_h(sysIdx * neqs), solution[0], tol);
+        EXPECT_NEAR_KK_REL(x_h(sysIdx * neqs + 1), solution[1], tol);
+        // identical systems go through identical iterations
+        EXPECT_EQ(age_h(sysIdx), age_h(0));
+        EXPECT_EQ(num_evals_h(sysIdx), num_evals_h(0));
+      }
+    }
+
+    if (max_jacobian_age == 1) {
+      // without lagging the state is left untouched
+      EXPECT_EQ(num_evals_h(0), 0);
+    } else {
+      EXPECT_GT(first_num_evals, 0);
+      EXPECT_LE(age_h(0), max_jacobian_age);
+    }
+  }
+
+  {
+    // The lagged factors are computed with partial pivoting
+    using pivot_system_type = LineParabolaIntersection<Device, scalar_type>;
+    pivot_system_type pivotSys{};
+    const newton_params params(100, 1e-14, 1e-10, 3);
+    Kokkos::deep_copy(x, 1);
+    Kokkos::deep_copy(jacobian_age, 0);
+    Kokkos::deep_copy(num_jacobian_evals, 0);
+
+    Kokkos::RangePolicy<execution_space> my_policy(0, num_systems);
+    NewtonLaggingSolve_wrapper solve_wrapper(
+        pivotSys, params, x, rhs, update, scale, J, tmp, jacobian_age,
+        num_jacobian_evals, status);
+    Kokkos::parallel_for(my_policy, solve_wrapper);
+
+    Kokkos::deep_copy(status_h, status);
+    Kokkos::deep_copy(x_h, x);
+    for (int sysIdx = 0; sysIdx < num_systems; ++sysIdx) {
+      EXPECT_TRUE(status_h(sysIdx) == newton_solver_status::NLS_SUCCESS)
+          << "Lagged Newton did not converge with a zero diagonal entry in "
+             "the Jacobian for system "
+          << sysIdx << "!";
+      EXPECT_NEAR_KK_REL(x_h(sysIdx * neqs), 2.0, Kokkos::sqrt(1e-10));
+      EXPECT_NEAR_KK_REL(x_h(sysIdx * neqs + 1), 2.0, Kokkos::sqrt(1e-10));
+    }
+  }
+}
+
+// Periodic chain of cubic equations
+// Equations:  f_i = x_i**3 + 4*x_i - x_{i-1} - x_{i+1} - 1 = 0
+//             with x_{-1} = x_{n-1} and x_{n} = x_0
+//
+// Jacobian:   tridiagonal with the corners (0, n-1) and (n-1, 0),
+//             the corners create fill-in in the LU factors.
+//
+// Solution:   x_i = x with x**3 + 2*x - 1 = 0, x ~ 0.4533976515
+template <typename Device, typename scalar_type>
+struct PeriodicChain {
+  using vec_type = Kokkos::View<scalar_type*, Device>;
+
+  const int neqs;
+
+  PeriodicChain(const int neqs_) : neqs(neqs_) {}
+
+  KOKKOS_FUNCTION void residual(const vec_type& y, const vec_type& f) const {
+    for (int eqIdx = 0; eqIdx < neqs; ++eqIdx) {
+      f(eqIdx) = y(eqIdx) * y(eqIdx) * y(eqIdx) + 4 * y(eqIdx) -
+                 y((eqIdx + neqs - 1) % neqs) - y((eqIdx + 1) % neqs) - 1;
+    }
+  }
+};
+
+template <class system_type, class jac_type, class vec_type, class status_view>
+struct NewtonSparseSolve_wrapper {
+  using newton_params = KokkosODE::Experimental::Newton_params;
+
+  system_type my_nls;
+  newton_params params;
+  jac_type jac;
+  vec_type x, rhs, update, scale, values, r_pert, y_save;
+  status_view status;
+
+  NewtonSparseSolve_wrapper(const system_type& my_nls_,
+                            const newton_params& params_, const jac_type& jac_,
+                            const vec_type& x_, const vec_type& rhs_,
+                            const vec_type& update_, const vec_type& scale_,
+                            const vec_type& values_, const vec_type& r_pert_,
+                            const vec_type& y_save_, const status_view& status_)
+      : my_nls(my_nls_),
+        params(params_),
+        jac(jac_),
+        x(x_),
+        rhs(rhs_),
+        update(update_),
+        scale(scale_),
+        values(values_),
+        r_pert(r_pert_),
+        y_save(y_save_),
+        status(status_) {}
+
+  KOKKOS_FUNCTION
+  void operator()(const int idx) const {
+    status(idx) = KokkosODE::Experimental::Newton::Solve(
+        my_nls, params, jac, values, r_pert, y_save, x, rhs, update, scale);
+  }
+};
+
+template <typename Device, typename scalar_type>
+void test_sparse_jacobian() {
+  using execution_space      = typename Device::execution_space;
+  using vec_type             = Kokkos::View<scalar_type*, Device>;
+  using int_view             = Kokkos::View<int*, Device>;
+  using newton_params        = KokkosODE::Experimental::Newton_params;
+  using newton_solver_status = KokkosODE::Experimental::newton_solver_status;
+  using system_type          = PeriodicChain<Device, scalar_type>;
+
+  constexpr int neqs = 10;
+  system_type mySys(neqs);
+  const scalar_type solution = 0.4533976515;
+
+  // Jacobian pattern, three entries per row
+  int_view row_ptr("row offsets", neqs + 1),
+      col_idx("column indices", 3 * neqs);
+  auto row_ptr_h = Kokkos::create_mirror_view(row_ptr);
+  auto col_idx_h = Kokkos::create_mirror_view(col_idx);
+  for (int rowIdx = 0; rowIdx < neqs; ++rowIdx) {
+    row_ptr_h(rowIdx)         = 3 * rowIdx;
+    col_idx_h(3 * rowIdx)     = (rowIdx + neqs - 1) % neqs;
+    col_idx_h(3 * rowIdx + 1) = rowIdx;
+    col_idx_h(3 * rowIdx + 2) = (rowIdx + 1) % neqs;
+  }
+  row_ptr_h(neqs) = 3 * neqs;
+  Kokkos::deep_copy(row_ptr, row_ptr_h);
+  Kokkos::deep_copy(col_idx, col_idx_h);
+
+  const auto jac =
+      KokkosODE::Experimental::create_sparse_jacobian(row_ptr, col_idx);
+  // The corners fill the last row and column of the factors,
+  // one residual evaluation per color instead of one per column.
+  EXPECT_EQ(jac.nnz(), 5 * neqs - 6);
+  EXPECT_TRUE(jac.num_colors < neqs);
+
+  vec_type x("solution vector", neqs), rhs("rhs", neqs),
+      update("update", neqs), scale("scaling factors", neqs),
+      values("LU values", jac.nnz()), r_pert("perturbed residual", neqs),
+      y_save("saved solution", neqs);
+  Kokkos::deep_copy(scale, 1);
+  Kokkos::View<newton_solver_status*, Device> status("Newton status", 1);
+  auto x_h      = Kokkos::create_mirror_view(x);
+  auto status_h = Kokkos::create_mirror_view(status);
+
+  for (const int max_jacobian_age : {1, 3}) {
+    const newton_params params(100, 1e-14, 1e-10, max_jacobian_age);
+    Kokkos::deep_copy(x, 0);
+
+    Kokkos::RangePolicy<execution_space> my_policy(0, 1);
+    NewtonSparseSolve_wrapper solve_wrapper(mySys, params, jac, x, rhs,
+                                            update, scale, values, r_pert,
+                                            y_save, status);
+    Kokkos::parallel_for(my_policy, solve_wrapper);
+
+    Kokkos::deep_copy(status_h, status);
+    Kokkos::deep_copy(x_h, x);
+    EXPECT_TRUE(status_h(0) == newton_solver_status::NLS_SUCCESS)
+        << "Sparse Newton with max_jacobian_age=" << max_jacobian_age
+        << " did not converge!";
+    for (int eqIdx = 0; eqIdx < neqs; ++eqIdx) {
+      EXPECT_NEAR_KK_REL(x_h(eqIdx), solution, 1e-5);
+    }
+  }
+}
+
 ////////////////////////////////////////////
 // Finally, solving systems of equations  //
 // within a parallel_for loop as it would //
@@ -532,6 +848,243 @@ void test_newton_on_device() {
   }
 }
 
+//////////////////////////////////////////
+// Batches of systems solved by teams,  //
+// one team per system, with team level //
+// residual and jacobian.               //
+//////////////////////////////////////////
+
+// Coupled cubics, one solution per system of the batch
+// Equations:  fi = yi**3 + yi + 0.1*sum_j(yj) - ci = 0
+//             with ci computed from the solution
+//
+// Jacobian:   Jij = (3*yi**2 + 1)*delta_ij + 0.1
+//
+// Solution:   yi = 1 + 0.05*i + 0.01*(sysIdx % 5)
+template <typename Device, typename scalar_type>
+struct CoupledCubics {
+  static constexpr int neqs = 10;
+
+  const scalar_type shift;
+
+  KOKKOS_FUNCTION CoupledCubics(const int sysIdx)
+      : shift(0.01 * (sysIdx % 5)) {}
+
+  KOKKOS_FUNCTION scalar_type solution(const int idx) const {
+    return 1 + 0.05 * idx + shift;
+  }
+
+  template <class MemberType, class vec_type, class res_type>
+  KOKKOS_FUNCTION void residual(const MemberType& member, const vec_type& y,
+                                const res_type& f) const {
+    scalar_type sum = 0, sum_sol = 0;
+    Kokkos::parallel_reduce(
+        Kokkos::TeamThreadRange(member, neqs),
+        [&](const int idx, scalar_type& lsum) { lsum += y(idx); }, sum);
+    for (int idx = 0; idx < neqs; ++idx) sum_sol += solution(idx);
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(member, neqs),
+                         [&](const int idx) {
+                           const scalar_type ys = solution(idx);
+                           f(idx) = y(idx) * y(idx) * y(idx) + y(idx) +
+                                    0.1 * (sum - sum_sol) - ys * ys * ys - ys;
+                         });
+  }
+
+  template <class MemberType, class vec_type, class mat_type>
+  KOKKOS_FUNCTION void jacobian(const MemberType& member, const vec_type& y,
+                                const mat_type& jac) const {
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(member, neqs),
+                         [&](const int rowIdx) {
+                           for (int colIdx = 0; colIdx < neqs; ++colIdx) {
+                             jac(rowIdx, colIdx) = 0.1;
+                           }
+                           jac(rowIdx, rowIdx) += 3 * y(rowIdx) * y(rowIdx) + 1;
+                         });
+  }
+};
+
+// Arctangent, full Newton steps diverge from |y0| > 1.3917
+// Equation:   f0 = atan(y) = 0
+//
+// Jacobian:   J00 = 1 / (1 + y**2)
+//
+// Solution:   y = 0
+template <typename Device, typename scalar_type>
+struct Arctangent {
+  static constexpr int neqs = 1;
+
+  KOKKOS_FUNCTION Arctangent(const int /*sysIdx*/) {}
+
+  KOKKOS_FUNCTION scalar_type solution(const int /*idx*/) const { return 0; }
+
+  template <class MemberType, class vec_type, class res_type>
+  KOKKOS_FUNCTION void residual(const MemberType& member, const vec_type& y,
+                                const res_type& f) const {
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(member, neqs),
+                         [&](const int idx) { f(idx) = Kokkos::atan(y(idx)); });
+  }
+
+  template <class MemberType, class vec_type, class mat_type>
+  KOKKOS_FUNCTION void jacobian(const MemberType& member, const vec_type& y,
+                                const mat_type& jac) const {
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(member, neqs),
+                         [&](const int idx) {
+                           jac(idx, idx) = 1 / (1 + y(idx) * y(idx));
+                         });
+  }
+};
+
+template <template <class> class solver_type, class system_type,
+          class vec_type, class mat_type, class fac_type, class piv_type,
+          class status_view, class scale_type>
+struct TeamNewtonSolve_wrapper {
+  using newton_params = KokkosODE::Experimental::Newton_params;
+
+  newton_params params;
+
+  vec_type x, rhs, update;
+  mat_type J;
+  fac_type F;
+  piv_type piv;
+  status_view status;
+
+  scale_type scale;
+
+  TeamNewtonSolve_wrapper(const newton_params& params_, const vec_type& x_,
+                          const vec_type& rhs_, const vec_type& update_,
+                          const mat_type& J_, const fac_type& F_,
+                          const piv_type& piv_, const status_view& status_,
+                          const scale_type& scale_)
+      : params(params_),
+        x(x_),
+        rhs(rhs_),
+        update(update_),
+        J(J_),
+        F(F_),
+        piv(piv_),
+        status(status_),
+        scale(scale_) {}
+
+  template <class MemberType>
+  KOKKOS_FUNCTION void operator()(const MemberType& member) const {
+    const int idx = member.league_rank();
+    const system_type my_nls(idx);
+
+    auto local_x      = Kokkos::subview(x, idx, Kokkos::ALL());
+    auto local_rhs    = Kokkos::subview(rhs, idx, Kokkos::ALL());
+    auto local_update = Kokkos::subview(update, idx, Kokkos::ALL());
+    auto local_J = Kokkos::subview(J, idx, Kokkos::ALL(), Kokkos::ALL());
+    auto local_F = Kokkos::subview(F, idx, Kokkos::ALL(), Kokkos::ALL());
+    auto local_piv = Kokkos::subview(piv, idx, Kokkos::ALL());
+
+    const auto local_status = solver_type<MemberType>::Solve(
+        member, my_nls, params, local_J, local_F, local_piv, local_x,
+        local_rhs, local_update, scale);
+    Kokkos::single(Kokkos::PerTeam(member),
+                   [&]() { status(idx) = local_status; });
+  }
+};
+
+template <template <class> class solver_type, class system_type, class Device,
+          class scalar_type>
+void run_team_newton_test(
+    const int num_systems,
+    const KokkosODE::Experimental::Newton_params& params,
+    const scalar_type initial_val,
+    const KokkosODE::Experimental::newton_solver_status expected_status,
+    const double tol) {
+  using execution_space      = typename Device::execution_space;
+  using newton_solver_status = KokkosODE::Experimental::newton_solver_status;
+  using vec_type             = Kokkos::View<scalar_type*, Device>;
+  using mv_type              = Kokkos::View<scalar_type**, Device>;
+  using mat_type             = Kokkos::View<scalar_type***, Device>;
+  using piv_type             = Kokkos::View<int**, Device>;
+  using status_view          = Kokkos::View<newton_solver_status*, Device>;
+  using scratch_type         = Kokkos::View<
+      scalar_type**, typename execution_space::scratch_memory_space>;
+  constexpr int neqs = system_type::neqs;
+
+  vec_type scale("scaling factors", neqs);
+  Kokkos::deep_copy(scale, 1);
+
+  mv_type x("solution vectors", num_systems, neqs);
+  mv_type rhs("right hand side vectors", num_systems, neqs);
+  mv_type update("updates", num_systems, neqs);
+  mat_type J("jacobians", num_systems, neqs, neqs);
+  mat_type F("factors", num_systems, neqs, neqs + 2);
+  piv_type piv("pivots", num_systems, neqs);
+  status_view status("solver status", num_systems);
+  Kokkos::deep_copy(x, initial_val);
+
+  Kokkos::TeamPolicy<execution_space> policy(num_systems, Kokkos::AUTO);
+  policy.set_scratch_size(
+      0, Kokkos::PerTeam(scratch_type::shmem_size(neqs, 4)));
+  TeamNewtonSolve_wrapper<solver_type, system_type, mv_type, mat_type,
+                          mat_type, piv_type, status_view, vec_type>
+      solve_wrapper(params, x, rhs, update, J, F, piv, status, scale);
+  Kokkos::parallel_for(policy, solve_wrapper);
+  Kokkos::fence();
+
+  auto status_h = Kokkos::create_mirror_view(status);
+  auto x_h      = Kokkos::create_mirror_view(x);
+  Kokkos::deep_copy(status_h, status);
+  Kokkos::deep_copy(x_h, x);
+  for (int sysIdx = 0; sysIdx < num_systems; ++sysIdx) {
+    EXPECT_EQ(status_h(sysIdx), expected_status) << "System " << sysIdx;
+    if (expected_status != newton_solver_status::NLS_SUCCESS) continue;
+
+    const system_type my_nls(sysIdx);
+    for (int eqIdx = 0; eqIdx < neqs; ++eqIdx) {
+      EXPECT_NEAR(x_h(sysIdx, eqIdx), my_nls.solution(eqIdx), tol)
+          << "System " << sysIdx << ", equation " << eqIdx;
+    }
+  }
+}
+
+template <template <class> class solver_type, class Device, class scalar_type>
+void test_team_newton() {
+  using newton_params        = KokkosODE::Experimental::Newton_params;
+  using newton_solver_status = KokkosODE::Experimental::newton_solver_status;
+  using cubics_type          = CoupledCubics<Device, scalar_type>;
+  using atan_type            = Arctangent<Device, scalar_type>;
+
+  // The iterations stop once the error estimated from the convergence
+  // rate is below the Newton tolerance, about sqrt(rel_tol). Lagged
+  // factors converge linearly so their last iterate is not as accurate
+  // as the one of full Newton iterations.
+  double abs_tol, rel_tol, tol, lagged_tol, atan_tol;
+  if (std::is_same_v<scalar_type, float>) {
+    rel_tol    = 10e-5;
+    abs_tol    = 10e-7;
+    tol        = 1e-3;
+    lagged_tol = 2e-2;
+    atan_tol   = 1e-2;
+  } else {
+    rel_tol    = 10e-8;
+    abs_tol    = 10e-15;
+    tol        = 1e-6;
+    lagged_tol = 1e-3;
+    atan_tol   = 1e-6;
+  }
+
+  // Batch of coupled systems, then with Jacobian factors lagged over
+  // up to 4 iterations
+  newton_params params(50, abs_tol, rel_tol);
+  run_team_newton_test<solver_type, cubics_type, Device, scalar_type>(
+      1000, params, 1, newton_solver_status::NLS_SUCCESS, tol);
+  newton_params lagged_params(50, abs_tol, rel_tol, 4);
+  run_team_newton_test<solver_type, cubics_type, Device, scalar_type>(
+      1000, lagged_params, 1, newton_solver_status::NLS_SUCCESS, lagged_tol);
+
+  // Full Newton steps diverge on atan(y) = 0 from y = 3, the line search
+  // shortens the first step and converges
+  run_team_newton_test<solver_type, atan_type, Device, scalar_type>(
+      10, params, 3, newton_solver_status::NLS_DIVERGENCE, atan_tol);
+  params.max_line_search_iters = 10;
+  run_team_newton_test<solver_type, atan_type, Device, scalar_type>(
+      10, params, 3, newton_solver_status::NLS_SUCCESS, atan_tol);
+}
+
 }  // namespace Test
 
 // No ETI is performed for these device routines
@@ -557,9 +1110,30 @@ TEST_F(TestCategory, Newton_system_double) {
   ::Test::test_simple_systems<TestDevice, double>();
 }
 
+TEST_F(TestCategory, Newton_lagging_double) {
+  ::Test::test_jacobian_lagging<TestDevice, double>();
+}
+
+TEST_F(TestCategory, Newton_sparse_double) {
+  ::Test::test_sparse_jacobian<TestDevice, double>();
+}
+
 TEST_F(TestCategory, Newton_parallel_float) {
   ::Test::test_newton_on_device<TestDevice, float>();
 }
 TEST_F(TestCategory, Newton_parallel_double) {
   ::Test::test_newton_on_device<TestDevice, double>();
 }
+
+TEST_F(TestCategory, Newton_team_float) {
+  ::Test::test_team_newton<KokkosODE::Experimental::TeamNewton, TestDevice,
+                           float>();
+  ::Test::test_team_newton<KokkosODE::Experimental::TeamVectorNewton,
+                           TestDevice, float>();
+}
+TEST_F(TestCategory, Newton_team_double) {
+  ::Test::test_team_newton<KokkosODE::Experimental::TeamNewton, TestDevice,
+                           double>();
+  ::Test::test_team_newton<KokkosODE::Experimental::TeamVectorNewton,
+                           TestDevice, double>();
+}
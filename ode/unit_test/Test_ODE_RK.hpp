@@ -559,6 +559,518 @@ void test_adaptivity() {
 
 }  // test_adaptivity
 
+// exponential decay y' = -lambda * y
+struct decay {
+  constexpr static int neqs = 1;
+  const double lambda;
+
+  KOKKOS_FUNCTION
+  decay(const double lambda_) : lambda(lambda_){};
+
+  template <class vec_type1, class vec_type2>
+  KOKKOS_FUNCTION void evaluate_function(const double /*t*/,
+                                         const double /*dt*/,
+                                         const vec_type1& y,
+                                         const vec_type2& f) const {
+    f(0) = -lambda * y(0);
+  }
+};  // decay
+
+// batch of exponential decays with one rate per system
+template <class vec_type>
+struct batched_decay {
+  constexpr static int neqs = 1;
+  vec_type lambda;
+
+  batched_decay(const vec_type& lambda_) : lambda(lambda_){};
+
+  template <class vec_type1, class vec_type2>
+  KOKKOS_FUNCTION void evaluate_function(const int sysIdx, const double /*t*/,
+                                         const double /*dt*/,
+                                         const vec_type1& y,
+                                         const vec_type2& f) const {
+    f(0) = -lambda(sysIdx) * y(0);
+  }
+};  // batched_decay
+
+template <KokkosODE::Experimental::RK_type rk_type, class vec_type,
+          class mv_type, class int_vec_type>
+struct RKSolve_systems_wrapper {
+  using ode_params  = KokkosODE::Experimental::ODE_params;
+  using solver_type = KokkosODE::Experimental::RungeKutta<rk_type>;
+
+  vec_type lambda;
+  ode_params params;
+  double tstart, tend;
+  mv_type y_old, y_new, tmp, kstack;
+  int_vec_type status;
+
+  RKSolve_systems_wrapper(const vec_type& lambda_, const ode_params& params_,
+                          const double tstart_, const double tend_,
+                          const mv_type& y_old_, const mv_type& y_new_,
+                          const mv_type& tmp_, const mv_type& kstack_,
+                          const int_vec_type& status_)
+      : lambda(lambda_),
+        params(params_),
+        tstart(tstart_),
+        tend(tend_),
+        y_old(y_old_),
+        y_new(y_new_),
+        tmp(tmp_),
+        kstack(kstack_),
+        status(status_) {}
+
+  KOKKOS_FUNCTION
+  void operator()(const int sysIdx) const {
+    const int num_stages = solver_type::num_stages();
+    auto y_old_s = Kokkos::subview(y_old, sysIdx, Kokkos::ALL);
+    auto y_new_s = Kokkos::subview(y_new, sysIdx, Kokkos::ALL);
+    auto tmp_s   = Kokkos::subview(tmp, sysIdx, Kokkos::ALL);
+    auto kstack_s =
+        Kokkos::subview(kstack, Kokkos::make_pair(sysIdx * num_stages,
+                                                  (sysIdx + 1) * num_stages),
+                        Kokkos::ALL);
+    status(sysIdx) = solver_type::Solve(decay(lambda(sysIdx)), params, tstart,
+                                        tend, y_old_s, y_new_s, tmp_s,
+                                        kstack_s);
+  }
+};
+
+template <class Device>
+void test_batched() {
+  using execution_space = typename Device::execution_space;
+  using RK_type         = KokkosODE::Experimental::RK_type;
+  using solver_type     = KokkosODE::Experimental::RungeKutta<RK_type::RKF45>;
+  using vec_type        = Kokkos::View<double*, Device>;
+  using mv_type         = Kokkos::View<double**, Device>;
+  using kv_type         = Kokkos::View<double***, Device>;
+  using int_vec_type    = Kokkos::View<int*, Device>;
+
+  constexpr int num_systems = 1000, num_stages = 6;
+  constexpr double tstart = 0, tend = 0.1;
+  constexpr int maxSteps = 4096, numSteps = 128;
+  constexpr double absTol = 1e-12, relTol = 1e-8, minStepSize = 1e-10;
+  KokkosODE::Experimental::ODE_params params(numSteps, maxSteps, absTol, relTol,
+                                             minStepSize);
+
+  // Decay rates spanning two orders of magnitude so that
+  // the number of time steps varies a lot between systems.
+  vec_type lambda("decay rates", num_systems);
+  auto lambda_h = Kokkos::create_mirror_view(lambda);
+  for (int sysIdx = 0; sysIdx < num_systems; ++sysIdx) {
+    lambda_h(sysIdx) =
+        Kokkos::pow(100.0, static_cast<double>((37 * sysIdx) % num_systems) /
+                               num_systems);
+  }
+  Kokkos::deep_copy(lambda, lambda_h);
+
+  // Reference: each system integrated by its own call to Solve
+  mv_type y_old_ref("y old ref", num_systems, 1);
+  mv_type y_new_ref("y new ref", num_systems, 1);
+  mv_type tmp_ref("tmp ref", num_systems, 1);
+  mv_type kstack_ref("k stack ref", num_systems * num_stages, 1);
+  int_vec_type status_ref("status ref", num_systems);
+  Kokkos::deep_copy(y_old_ref, 1);
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<execution_space>(0, num_systems),
+      RKSolve_systems_wrapper<RK_type::RKF45, vec_type, mv_type, int_vec_type>(
+          lambda, params, tstart, tend, y_old_ref, y_new_ref, tmp_ref,
+          kstack_ref, status_ref));
+
+  mv_type y_old("y old", num_systems, 1), y_new("y new", num_systems, 1);
+  mv_type tmp("tmp", num_systems, 1);
+  kv_type kstack("k stack", num_systems, num_stages, 1);
+  int_vec_type status("status", num_systems);
+  Kokkos::deep_copy(y_old, 1);
+  solver_type::SolveBatched(execution_space(),
+                            batched_decay<vec_type>(lambda), params, tstart,
+                            tend, y_old, y_new, tmp, kstack, status, 4);
+
+  auto y_new_h = Kokkos::create_mirror_view(y_new);
+  Kokkos::deep_copy(y_new_h, y_new);
+  auto y_new_ref_h = Kokkos::create_mirror_view(y_new_ref);
+  Kokkos::deep_copy(y_new_ref_h, y_new_ref);
+  auto status_h = Kokkos::create_mirror_view(status);
+  Kokkos::deep_copy(status_h, status);
+  auto status_ref_h = Kokkos::create_mirror_view(status_ref);
+  Kokkos::deep_copy(status_ref_h, status_ref);
+
+  for (int sysIdx = 0; sysIdx < num_systems; ++sysIdx) {
+    EXPECT_EQ(status_h(sysIdx),
+              KokkosODE::Experimental::ode_solver_status::SUCCESS);
+    EXPECT_EQ(status_h(sysIdx), status_ref_h(sysIdx));
+    EXPECT_NEAR_KK_REL(y_new_h(sysIdx, 0), y_new_ref_h(sysIdx, 0), 1e-12);
+    EXPECT_NEAR_KK_REL(y_new_h(sysIdx, 0),
+                       Kokkos::exp(-lambda_h(sysIdx) * tend), 1e-6);
+  }
+
+  // Systems sharing the same ode, with different initial conditions
+  Kokkos::deep_copy(y_old, 2);
+  solver_type::SolveBatched(execution_space(), decay(3), params, tstart, tend,
+                            y_old, y_new, tmp, kstack, status);
+  Kokkos::deep_copy(y_new_h, y_new);
+  Kokkos::deep_copy(status_h, status);
+  for (int sysIdx = 0; sysIdx < num_systems; ++sysIdx) {
+    EXPECT_EQ(status_h(sysIdx),
+              KokkosODE::Experimental::ode_solver_status::SUCCESS);
+    EXPECT_NEAR_KK_REL(y_new_h(sysIdx, 0), 2 * Kokkos::exp(-3 * tend), 1e-6);
+  }
+}  // test_batched
+
+// duho whose evaluations of the right hand side are counted
+template <class count_type>
+struct counted_duho {
+  constexpr static int neqs = 2;
+  duho ode;
+  count_type num_evals;
+
+  counted_duho(const duho& ode_, const count_type& num_evals_)
+      : ode(ode_), num_evals(num_evals_) {}
+
+  template <class vec_type1, class vec_type2>
+  KOKKOS_FUNCTION void evaluate_function(const double t, const double dt,
+                                         const vec_type1& y,
+                                         const vec_type2& f) const {
+    ode.evaluate_function(t, dt, y, f);
+    ++num_evals(0);
+  }
+};  // counted_duho
+
+// ball thrown upward: y0'' = -g with y1 = y0'
+struct ballistic {
+  constexpr static int neqs = 2;
+  const double g;
+
+  KOKKOS_FUNCTION
+  ballistic(const double g_) : g(g_){};
+
+  template <class vec_type1, class vec_type2>
+  KOKKOS_FUNCTION void evaluate_function(const double /*t*/,
+                                         const double /*dt*/,
+                                         const vec_type1& y,
+                                         const vec_type2& f) const {
+    f(0) = y(1);
+    f(1) = -g;
+  }
+};  // ballistic
+
+// the ball hits the ground
+struct ground_event {
+  template <class vec_type>
+  KOKKOS_FUNCTION double operator()(const double /*t*/,
+                                    const vec_type& y) const {
+    return y(0);
+  }
+};
+
+template <class ode_type, KokkosODE::Experimental::RK_type rk_type,
+          class vec_type, class mv_type, class event_type>
+struct RKSolve_dense_wrapper {
+  using ode_params  = KokkosODE::Experimental::ODE_params;
+  using solver_type = KokkosODE::Experimental::RungeKutta<rk_type>;
+  using status_type = Kokkos::View<int*, typename vec_type::memory_space>;
+
+  ode_type my_ode;
+  ode_params params;
+  double tstart, tend;
+  vec_type y_old, y_new, tmp;
+  mv_type kstack;
+  vec_type t_out;
+  mv_type y_out;
+  event_type event;
+  vec_type t_event;
+  status_type status;
+
+  RKSolve_dense_wrapper(const ode_type& my_ode_, const ode_params& params_,
+                        const double tstart_, const double tend_,
+                        const vec_type& y_old_, const vec_type& y_new_,
+                        const vec_type& tmp_, const mv_type& kstack_,
+                        const vec_type& t_out_, const mv_type& y_out_,
+                        const event_type& event_, const vec_type& t_event_,
+                        const status_type& status_)
+      : my_ode(my_ode_),
+        params(params_),
+        tstart(tstart_),
+        tend(tend_),
+        y_old(y_old_),
+        y_new(y_new_),
+        tmp(tmp_),
+        kstack(kstack_),
+        t_out(t_out_),
+        y_out(y_out_),
+        event(event_),
+        t_event(t_event_),
+        status(status_) {}
+
+  KOKKOS_FUNCTION
+  void operator()(const int /*idx*/) const {
+    if constexpr (std::is_same_v<event_type, KokkosODE::Impl::NoEvent>) {
+      status(0)  = solver_type::Solve(my_ode, params, tstart, tend, y_old,
+                                      y_new, tmp, kstack, t_out, y_out);
+      t_event(0) = tend;
+    } else {
+      double t_stop;
+      status(0)  = solver_type::Solve(my_ode, params, tstart, tend, y_old,
+                                      y_new, tmp, kstack, t_out, y_out, event,
+                                      t_stop);
+      t_event(0) = t_stop;
+    }
+  }
+};
+
+// The solution interpolated at the output times matches the analytical
+// solution and the integration does not evaluate the ode more often than
+// without dense output.
+template <class Device, KokkosODE::Experimental::RK_type rk_type>
+void test_dense_output_method() {
+  using execution_space = typename Device::execution_space;
+  using solver_type     = KokkosODE::Experimental::RungeKutta<rk_type>;
+  using vec_type        = Kokkos::View<double*, Device>;
+  using mv_type         = Kokkos::View<double**, Device>;
+  using count_type      = Kokkos::View<int*, Device>;
+  using status_type     = Kokkos::View<int*, Device>;
+  using ode_type        = counted_duho<count_type>;
+  using no_event        = KokkosODE::Impl::NoEvent;
+
+  constexpr int num_out   = 21;
+  constexpr double tstart = 0, tend = 10;
+  KokkosODE::Experimental::ODE_params params(16, 10000, 1e-12, 1e-10, 1e-12);
+  Kokkos::RangePolicy<execution_space> my_policy(0, 1);
+
+  count_type num_evals("number of evaluations", 1);
+  ode_type my_ode(duho(1, 1, 4), num_evals);
+  vec_type y_old("y old", 2), y_new("y new", 2), tmp("tmp", 2);
+  mv_type kstack("k stack", solver_type::num_stages(), 2);
+  auto y_old_h = Kokkos::create_mirror_view(y_old);
+  auto y_new_h = Kokkos::create_mirror_view(y_new);
+  auto evals_h = Kokkos::create_mirror_view(num_evals);
+
+  // Reference integration without dense output
+  y_old_h(0) = 1;
+  y_old_h(1) = 0;
+  Kokkos::deep_copy(y_old, y_old_h);
+  Kokkos::parallel_for(
+      my_policy,
+      RKSolve_wrapper<ode_type, rk_type, vec_type, mv_type, double>(
+          my_ode, params, tstart, tend, y_old, y_new, tmp, kstack));
+  Kokkos::deep_copy(y_new_h, y_new);
+  Kokkos::deep_copy(evals_h, num_evals);
+  const double y_end    = y_new_h(0);
+  const int plain_evals = evals_h(0);
+
+  vec_type t_out("output times", num_out), t_event("t event", 1);
+  mv_type y_out("output solution", num_out, 2);
+  status_type status("status", 1);
+  auto t_out_h = Kokkos::create_mirror_view(t_out);
+  for (int outIdx = 0; outIdx < num_out; ++outIdx) {
+    t_out_h(outIdx) = tstart + (tend - tstart) * outIdx / (num_out - 1);
+  }
+  Kokkos::deep_copy(t_out, t_out_h);
+  y_old_h(0) = 1;
+  y_old_h(1) = 0;
+  Kokkos::deep_copy(y_old, y_old_h);
+  Kokkos::deep_copy(num_evals, 0);
+  Kokkos::parallel_for(
+      my_policy,
+      RKSolve_dense_wrapper<ode_type, rk_type, vec_type, mv_type, no_event>(
+          my_ode, params, tstart, tend, y_old, y_new, tmp, kstack, t_out,
+          y_out, no_event(), t_event, status));
+
+  auto status_h = Kokkos::create_mirror_view(status);
+  Kokkos::deep_copy(status_h, status);
+  Kokkos::deep_copy(y_new_h, y_new);
+  Kokkos::deep_copy(evals_h, num_evals);
+  auto y_out_h = Kokkos::create_mirror_view(y_out);
+  Kokkos::deep_copy(y_out_h, y_out);
+
+  EXPECT_EQ(status_h(0), KokkosODE::Experimental::ode_solver_status::SUCCESS);
+  EXPECT_NEAR_KK_REL(y_new_h(0), y_end, 1e-8);
+  // At most one evaluation on the last step to interpolate it
+  EXPECT_TRUE(evals_h(0) <= plain_evals + 1);
+
+  Kokkos::View<double*, Kokkos::HostSpace> y0("y0", 2), y_ref("y ref", 2);
+  y0(0) = 1;
+  y0(1) = 0;
+  for (int outIdx = 0; outIdx < num_out; ++outIdx) {
+    my_ode.ode.solution(t_out_h(outIdx), y0, y_ref);
+    EXPECT_NEAR_KK(y_out_h(outIdx, 0), y_ref(0), 1e-6);
+    EXPECT_NEAR_KK(y_out_h(outIdx, 1), y_ref(1), 1e-6);
+  }
+}  // test_dense_output_method
+
+// The integration stops when the ball reaches the ground, the solution is
+// quadratic in time so the interpolant is exact and the time of the event
+// is located to round-off. Output times past the event are not filled.
+template <class Device, KokkosODE::Experimental::RK_type rk_type>
+void test_event_method() {
+  using execution_space = typename Device::execution_space;
+  using solver_type     = KokkosODE::Experimental::RungeKutta<rk_type>;
+  using vec_type        = Kokkos::View<double*, Device>;
+  using mv_type         = Kokkos::View<double**, Device>;
+  using status_type     = Kokkos::View<int*, Device>;
+
+  constexpr int num_out   = 6;
+  constexpr double tstart = 0, tend = 10, g = 9.81, h0 = 10, v0 = 5;
+  const double t_ground = (v0 + Kokkos::sqrt(v0 * v0 + 2 * g * h0)) / g;
+  KokkosODE::Experimental::ODE_params params(10);
+
+  vec_type y_old("y old", 2), y_new("y new", 2), tmp("tmp", 2);
+  mv_type kstack("k stack", solver_type::num_stages(), 2);
+  auto y_old_h = Kokkos::create_mirror_view(y_old);
+  y_old_h(0)   = h0;
+  y_old_h(1)   = v0;
+  Kokkos::deep_copy(y_old, y_old_h);
+
+  vec_type t_out("output times", num_out), t_event("t event", 1);
+  mv_type y_out("output solution", num_out, 2);
+  status_type status("status", 1);
+  auto t_out_h = Kokkos::create_mirror_view(t_out);
+  for (int outIdx = 0; outIdx < num_out; ++outIdx) {
+    t_out_h(outIdx) = 0.5 * (outIdx + 1);
+  }
+  Kokkos::deep_copy(t_out, t_out_h);
+
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<execution_space>(0, 1),
+      RKSolve_dense_wrapper<ballistic, rk_type, vec_type, mv_type,
+                            ground_event>(ballistic(g), params, tstart, tend,
+                                          y_old, y_new, tmp, kstack, t_out,
+                                          y_out, ground_event(), t_event,
+                                          status));
+
+  auto status_h = Kokkos::create_mirror_view(status);
+  Kokkos::deep_copy(status_h, status);
+  auto t_event_h = Kokkos::create_mirror_view(t_event);
+  Kokkos::deep_copy(t_event_h, t_event);
+  auto y_new_h = Kokkos::create_mirror_view(y_new);
+  Kokkos::deep_copy(y_new_h, y_new);
+  Kokkos::deep_copy(y_old_h, y_old);
+  auto y_out_h = Kokkos::create_mirror_view(y_out);
+  Kokkos::deep_copy(y_out_h, y_out);
+
+  EXPECT_EQ(status_h(0), KokkosODE::Experimental::ode_solver_status::EVENT);
+  EXPECT_NEAR_KK_REL(t_event_h(0), t_ground, 1e-12);
+  EXPECT_NEAR_KK(y_new_h(0), 0.0, 1e-10);
+  EXPECT_NEAR_KK_REL(y_new_h(1), v0 - g * t_ground, 1e-12);
+  EXPECT_NEAR_KK(y_old_h(0), y_new_h(0), 1e-14);
+  for (int outIdx = 0; outIdx < num_out; ++outIdx) {
+    const double t = t_out_h(outIdx);
+    if (t < t_ground) {
+      EXPECT_NEAR_KK(y_out_h(outIdx, 0), h0 + v0 * t - 0.5 * g * t * t, 1e-10);
+      EXPECT_NEAR_KK(y_out_h(outIdx, 1), v0 - g * t, 1e-10);
+    } else {
+      EXPECT_EQ(y_out_h(outIdx, 0), 0.0);
+      EXPECT_EQ(y_out_h(outIdx, 1), 0.0);
+    }
+  }
+}  // test_event_method
+
+template <class Device>
+void test_dense_output() {
+  using RK_type = KokkosODE::Experimental::RK_type;
+
+  // FSAL and non-FSAL methods
+  test_dense_output_method<Device, RK_type::RKDP>();
+  test_dense_output_method<Device, RK_type::RKF45>();
+  test_event_method<Device, RK_type::RKBS>();
+  test_event_method<Device, RK_type::RK4>();
+}  // test_dense_output
+
+// exponential decays with one rate per SIMD lane
+template <class lambda_type>
+struct simd_decay {
+  constexpr static int neqs = 1;
+  const lambda_type lambda;
+
+  KOKKOS_FUNCTION
+  simd_decay(const lambda_type& lambda_) : lambda(lambda_){};
+
+  template <class time_type, class vec_type1, class vec_type2>
+  KOKKOS_FUNCTION void evaluate_function(const time_type& /*t*/,
+                                         const time_type& /*dt*/,
+                                         const vec_type1& y,
+                                         const vec_type2& f) const {
+    f(0) = -lambda * y(0);
+  }
+};  // simd_decay
+
+// The lanes of a SIMD integration must follow the same steps as the
+// integration of each system on its own, including the lanes that stop
+// early because they run out of steps.
+template <KokkosODE::Experimental::RK_type rk_type>
+void test_simd_method(const KokkosODE::Experimental::ODE_params& params) {
+  using simd_type     = KokkosBatched::Vector<KokkosBatched::SIMD<double>, 4>;
+  using solver_type   = KokkosODE::Experimental::RungeKutta<rk_type>;
+  using ode_status    = KokkosODE::Experimental::ode_solver_status;
+  using vec_type      = Kokkos::View<double*, Kokkos::HostSpace>;
+  using mv_type       = Kokkos::View<double**, Kokkos::HostSpace>;
+  using simd_vec_type = Kokkos::View<simd_type*, Kokkos::HostSpace>;
+  using simd_mv_type  = Kokkos::View<simd_type**, Kokkos::HostSpace>;
+  constexpr int nlanes = simd_type::vector_length;
+
+  const int num_stages        = solver_type::num_stages();
+  constexpr double tstart     = 0, tend = 0.1;
+  const double lambda[nlanes] = {0.5, 5, 50, 100};
+
+  simd_type lambda_simd;
+  for (int lane = 0; lane < nlanes; ++lane) lambda_simd[lane] = lambda[lane];
+  simd_vec_type y_old("y old", 1), y_new("y new", 1), tmp("tmp", 1);
+  simd_mv_type kstack("k stack", num_stages, 1);
+  for (int lane = 0; lane < nlanes; ++lane) y_old(0)[lane] = lane + 1;
+  ode_status lane_status[nlanes];
+  const ode_status status = solver_type::Solve(
+      simd_decay<simd_type>(lambda_simd), params, tstart, tend, y_old, y_new,
+      tmp, kstack, lane_status);
+
+  bool all_success = true;
+  for (int lane = 0; lane < nlanes; ++lane) {
+    vec_type y_old_ref("y old ref", 1), y_new_ref("y new ref", 1),
+        tmp_ref("tmp ref", 1);
+    mv_type kstack_ref("k stack ref", num_stages, 1);
+    y_old_ref(0)                = lane + 1;
+    const ode_status status_ref = solver_type::Solve(
+        decay(lambda[lane]), params, tstart, tend, y_old_ref, y_new_ref,
+        tmp_ref, kstack_ref);
+
+    EXPECT_EQ(lane_status[lane], status_ref);
+    EXPECT_NEAR_KK_REL(y_old(0)[lane], y_old_ref(0), 1e-12);
+    if (status_ref == ode_status::SUCCESS) {
+      EXPECT_NEAR_KK_REL(y_new(0)[lane], y_new_ref(0), 1e-12);
+      if (params.adaptivity) {
+        EXPECT_NEAR_KK_REL(y_new(0)[lane],
+                           (lane + 1) * Kokkos::exp(-lambda[lane] * tend),
+                           1e-6);
+      }
+    } else if (all_success) {
+      EXPECT_EQ(status, status_ref);
+    }
+    all_success = all_success && (status_ref == ode_status::SUCCESS);
+  }
+  if (all_success) {
+    EXPECT_EQ(status, ode_status::SUCCESS);
+  }
+
+  // Same integration through the overload that only returns the status
+  for (int lane = 0; lane < nlanes; ++lane) y_old(0)[lane] = lane + 1;
+  EXPECT_EQ(solver_type::Solve(simd_decay<simd_type>(lambda_simd), params,
+                               tstart, tend, y_old, y_new, tmp, kstack),
+            status);
+}  // test_simd_method
+
+void test_simd() {
+  using RK_type    = KokkosODE::Experimental::RK_type;
+  using ode_params = KokkosODE::Experimental::ODE_params;
+
+  const ode_params params(16, 4096, 1e-12, 1e-8, 1e-10);
+  test_simd_method<RK_type::RKF45>(params);
+  test_simd_method<RK_type::RKDP>(params);
+  test_simd_method<RK_type::RKBS>(params);
+  // the stiffest lanes run out of steps
+  test_simd_method<RK_type::RKF45>(ode_params(16, 8, 1e-12, 1e-8, 1e-10));
+  // fixed time step
+  test_simd_method<RK_type::RK4>(ode_params(64));
+}  // test_simd
+
 }  // namespace Test
 
 void test_RK() { Test::test_RK<TestDevice>(); }
@@ -567,8 +1079,17 @@ void test_RK_conv_rate() { Test::test_convergence_rate<TestDevice>(); }
 
 void test_RK_adaptivity() { Test::test_adaptivity<TestDevice>(); }
 
+void test_RK_batched() { Test::test_batched<TestDevice>(); }
+
+void test_RK_dense_output() { Test::test_dense_output<TestDevice>(); }
+
+void test_RK_simd() { Test::test_simd(); }
+
 #if defined(KOKKOSKERNELS_INST_DOUBLE)
 TEST_F(TestCategory, RKSolve_serial) { test_RK(); }
 TEST_F(TestCategory, RK_conv_rate) { test_RK_conv_rate(); }
 TEST_F(TestCategory, RK_adaptivity) { test_RK_adaptivity(); }
+TEST_F(TestCategory, RK_batched) { test_RK_batched(); }
+TEST_F(TestCategory, RK_dense_output) { test_RK_dense_output(); }
+TEST_F(TestCategory, RK_simd) { test_RK_simd(); }
 #endif
@@ -0,0 +1,155 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include "KokkosKernels_TestUtils.hpp"
+
+#include "KokkosODE_Rosenbrock.hpp"
+
+namespace Test {
+
+// The Logistic and StiffChemistry systems are defined in Test_ODE_BDF.hpp
+
+template <class ode_type, KokkosODE::Experimental::Rosenbrock_type ros_type,
+          class vec_type, class mv_type, class mat_type, class scalar_type>
+struct RosenbrockSolve_wrapper {
+  using ros_solver = KokkosODE::Experimental::Rosenbrock<ros_type>;
+
+  ode_type my_ode;
+  KokkosODE::Experimental::ODE_params params;
+  scalar_type tstart, tend;
+  vec_type y_old, y_new, tmp;
+  mv_type kstack;
+  mat_type jac;
+
+  RosenbrockSolve_wrapper(const ode_type& my_ode_,
+                          const KokkosODE::Experimental::ODE_params& params_,
+                          const scalar_type tstart_, const scalar_type tend_,
+                          const vec_type& y_old_, const vec_type& y_new_,
+                          const vec_type& tmp_, const mv_type& kstack_,
+                          const mat_type& jac_)
+      : my_ode(my_ode_),
+        params(params_),
+        tstart(tstart_),
+        tend(tend_),
+        y_old(y_old_),
+        y_new(y_new_),
+        tmp(tmp_),
+        kstack(kstack_),
+        jac(jac_) {}
+
+  KOKKOS_FUNCTION
+  void operator()(const int /*idx*/) const {
+    ros_solver::Solve(my_ode, params, tstart, tend, y_old, y_new, tmp, kstack,
+                      jac);
+  }
+};
+
+template <class Device, KokkosODE::Experimental::Rosenbrock_type ros_type>
+void test_Rosenbrock_convergence() {
+  using execution_space = typename Device::execution_space;
+  using vec_type        = Kokkos::View<double*, Device>;
+  using mv_type         = Kokkos::View<double**, Device>;
+  using ros_solver      = KokkosODE::Experimental::Rosenbrock<ros_type>;
+
+  Logistic mySys(1, 1);
+  const double t_start = 0.0, t_end = 6.0;
+  const double y_exact = 1 / (1 + Kokkos::exp(-t_end));
+
+  vec_type y_old("y_old", mySys.neqs), y_new("y_new", mySys.neqs),
+      tmp("tmp", mySys.neqs);
+  mv_type kstack("k stack", ros_solver::num_stages(), mySys.neqs),
+      jac("jacobian", mySys.neqs, mySys.neqs);
+  auto y_new_h = Kokkos::create_mirror_view(y_new);
+
+  Kokkos::RangePolicy<execution_space> policy(0, 1);
+  double error[2];
+  for (int refIdx = 0; refIdx < 2; ++refIdx) {
+    const KokkosODE::Experimental::ODE_params params(80 << refIdx);
+    Kokkos::deep_copy(y_old, 0.5);
+    RosenbrockSolve_wrapper<Logistic, ros_type, vec_type, mv_type, mv_type,
+                            double>
+        solve_wrapper(mySys, params, t_start, t_end, y_old, y_new, tmp, kstack,
+                      jac);
+    Kokkos::parallel_for(policy, solve_wrapper);
+    Kokkos::deep_copy(y_new_h, y_new);
+    error[refIdx] = Kokkos::abs(y_new_h(0) - y_exact);
+  }
+
+  // Halving the time step reduces the error by 2^order
+  const double rate = Kokkos::log2(error[0] / error[1]);
+  EXPECT_NEAR_KK(rate, ros_solver::order(), 0.25);
+}  // test_Rosenbrock_convergence
+
+template <class Device, KokkosODE::Experimental::Rosenbrock_type ros_type>
+void test_Rosenbrock_StiffChemistry() {
+  using execution_space = typename Device::execution_space;
+  using vec_type        = Kokkos::View<double*, Device>;
+  using mv_type         = Kokkos::View<double**, Device>;
+  using ros_solver      = KokkosODE::Experimental::Rosenbrock<ros_type>;
+
+  StiffChemistry mySys{};
+  const double t_start = 0.0, t_end = 40.0;
+  const KokkosODE::Experimental::ODE_params params(1000, 10000, 1e-10, 1e-6,
+                                                   1e-14);
+
+  vec_type y_old("y_old", mySys.neqs), y_new("y_new", mySys.neqs),
+      tmp("tmp", mySys.neqs);
+  mv_type kstack("k stack", ros_solver::num_stages(), mySys.neqs),
+      jac("jacobian", mySys.neqs, mySys.neqs);
+
+  auto y_old_h = Kokkos::create_mirror_view(y_old);
+  y_old_h(0)   = 1.0;
+  y_old_h(1)   = 0.0;
+  y_old_h(2)   = 0.0;
+  Kokkos::deep_copy(y_old, y_old_h);
+
+  Kokkos::RangePolicy<execution_space> policy(0, 1);
+  RosenbrockSolve_wrapper<StiffChemistry, ros_type, vec_type, mv_type,
+                          mv_type, double>
+      solve_wrapper(mySys, params, t_start, t_end, y_old, y_new, tmp, kstack,
+                    jac);
+  Kokkos::parallel_for(policy, solve_wrapper);
+
+  auto y_new_h = Kokkos::create_mirror_view(y_new);
+  Kokkos::deep_copy(y_new_h, y_new);
+
+  // Reference solution at t=40 from
+  // Hairer, E., Wanner, G. "Solving Ordinary Differential Equations II"
+  EXPECT_NEAR_KK(y_new_h(0) + y_new_h(1) + y_new_h(2), 1.0, 1e-10);
+  EXPECT_NEAR_KK_REL(y_new_h(0), 0.7158270687, 1e-5);
+  EXPECT_NEAR_KK_REL(y_new_h(1), 9.185534764e-6, 1e-4);
+  EXPECT_NEAR_KK_REL(y_new_h(2), 0.2841637457, 1e-5);
+}  // test_Rosenbrock_StiffChemistry
+
+}  // namespace Test
+
+TEST_F(TestCategory, Rosenbrock_convergence) {
+  ::Test::test_Rosenbrock_convergence<
+      TestDevice, KokkosODE::Experimental::Rosenbrock_type::ROS2>();
+  ::Test::test_Rosenbrock_convergence<
+      TestDevice, KokkosODE::Experimental::Rosenbrock_type::ROS3>();
+  ::Test::test_Rosenbrock_convergence<
+      TestDevice, KokkosODE::Experimental::Rosenbrock_type::RODAS3>();
+}
+TEST_F(TestCategory, Rosenbrock_StiffChemistry) {
+  ::Test::test_Rosenbrock_StiffChemistry<
+      TestDevice, KokkosODE::Experimental::Rosenbrock_type::ROS2>();
+  ::Test::test_Rosenbrock_StiffChemistry<
+      TestDevice, KokkosODE::Experimental::Rosenbrock_type::ROS3>();
+  ::Test::test_Rosenbrock_StiffChemistry<
+      TestDevice, KokkosODE::Experimental::Rosenbrock_type::RODAS3>();
+}
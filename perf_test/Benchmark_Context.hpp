@@ -30,6 +30,9 @@
 #include <KokkosKernels_PrintConfiguration.hpp>
 #include <KokkosKernels_Version_Info.hpp>
 
+#include "Benchmark_NUMA.hpp"
+#include "Benchmark_Utils.hpp"
+
 namespace KokkosKernelsBenchmark {
 
 /// \brief Remove unwanted spaces and colon signs from input string. In case of
@@ -109,11 +112,43 @@ inline void add_env_info() {
   }
 }
 
+/// \brief Calibrate the roofline used by set_rates and add the sustained
+/// bandwidth (and configured peak, if any) to benchmark context
+inline void add_roofline_info() {
+  benchmark::AddCustomContext("STREAM_TRIAD_GB/s",
+                              std::to_string(stream_triad_bandwidth() * 1e-9));
+  const double peak = peak_flop_rate();
+  if (peak > 0) {
+    benchmark::AddCustomContext("PEAK_GFLOP/s", std::to_string(peak * 1e-9));
+  }
+}
+
+/// \brief Add the number of NUMA nodes of the host to benchmark context
+inline void add_numa_info() {
+  const int num_nodes = num_numa_nodes();
+  if (num_nodes > 0) {
+    benchmark::AddCustomContext("NUMA_NODES", std::to_string(num_nodes));
+  }
+}
+
+/// \brief Add the energy counters used by set_energy to benchmark context
+inline void add_energy_info() {
+  const std::string host   = host_energy_source();
+  const std::string device = device_energy_source();
+  benchmark::AddCustomContext("ENERGY_HOST",
+                              host.empty() ? "unavailable" : host);
+  benchmark::AddCustomContext("ENERGY_DEVICE",
+                              device.empty() ? "unavailable" : device);
+}
+
 /// \brief Gather all context information and add it to benchmark context
 inline void add_benchmark_context(bool verbose = false) {
   add_kokkos_configuration(verbose);
   add_version_info();
   add_env_info();
+  add_numa_info();
+  add_roofline_info();
+  add_energy_info();
 }
 
 template <class FuncType, class... ArgsToCallOp>
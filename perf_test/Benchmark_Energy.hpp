@@ -0,0 +1,252 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSKERNELS_PERFTEST_BENCHMARK_ENERGY_HPP
+#define KOKKOSKERNELS_PERFTEST_BENCHMARK_ENERGY_HPP
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Kokkos_Core.hpp>
+
+#if defined(KOKKOS_ENABLE_CUDA) && defined(KOKKOSKERNELS_BENCHMARK_ENABLE_NVML)
+#include <nvml.h>
+#define KOKKOSKERNELS_BENCHMARK_DEVICE_ENERGY "NVML"
+#elif defined(KOKKOS_ENABLE_HIP) && \
+    defined(KOKKOSKERNELS_BENCHMARK_ENABLE_ROCM_SMI)
+#include <rocm_smi/rocm_smi.h>
+#define KOKKOSKERNELS_BENCHMARK_DEVICE_ENERGY "ROCm SMI"
+#endif
+
+namespace KokkosKernelsBenchmark {
+
+// Energy counters. The host is measured with RAPL through the Linux
+// powercap interface (the packages and their DRAM domains, on Intel and
+// AMD CPUs), the GPU of the default execution space with NVML on CUDA and
+// ROCm SMI on HIP when the benchmarks are built with them. All of them are
+// cumulative counters updated about every millisecond, so runs much
+// shorter than that give no usable energy; google benchmark repeats
+// kernels for at least --benchmark_min_time anyway.
+
+/// A RAPL domain: its energy counter in microjoules, and the value at which
+/// the counter wraps around
+struct RaplDomain {
+  std::string energy_path;
+  double max_uj;
+};
+
+inline bool read_sysfs_number(const std::string &path, double &value) {
+  std::ifstream file(path);
+  return static_cast<bool>(file >> value);
+}
+
+/// The readable RAPL domains of the host; empty without powercap or without
+/// permission to read the counters (often reserved to root)
+inline const std::vector<RaplDomain> &rapl_domains() {
+  static const std::vector<RaplDomain> domains = [] {
+    std::vector<RaplDomain> found;
+    const std::string root = "/sys/class/powercap/intel-rapl:";
+    const auto add = [&](const std::string &zone) {
+      RaplDomain domain{zone + "/energy_uj", 0};
+      double uj;
+      if (read_sysfs_number(zone + "/max_energy_range_uj", domain.max_uj) &&
+          read_sysfs_number(domain.energy_path, uj))
+        found.push_back(domain);
+    };
+    for (int package = 0;; ++package) {
+      const std::string zone = root + std::to_string(package);
+      std::ifstream name(zone + "/name");
+      if (!name) break;
+      add(zone);
+      // DRAM is a subzone but not part of the package energy
+      for (int sub = 0;; ++sub) {
+        const std::string subzone = zone + "/intel-rapl:" +
+                                    std::to_string(package) + ":" +
+                                    std::to_string(sub);
+        std::ifstream subname(subzone + "/name");
+        std::string s;
+        if (!(subname >> s)) break;
+        if (s == "dram") add(subzone);
+      }
+    }
+    return found;
+  }();
+  return domains;
+}
+
+#ifdef KOKKOSKERNELS_BENCHMARK_DEVICE_ENERGY
+/// Cumulative energy of the GPU of the default execution space in joules,
+/// or -1 if it cannot be read
+inline double device_energy_joules() {
+#if defined(KOKKOS_ENABLE_CUDA)
+  // NVML numbers the devices of the node, CUDA only the visible ones: match
+  // them by PCI bus id
+  static const nvmlDevice_t *device = []() -> nvmlDevice_t * {
+    static nvmlDevice_t handle;
+    char bus_id[32];
+    if (nvmlInit_v2() != NVML_SUCCESS ||
+        cudaDeviceGetPCIBusId(bus_id, sizeof(bus_id),
+                              Kokkos::Cuda().cuda_device()) != cudaSuccess ||
+        nvmlDeviceGetHandleByPciBusId_v2(bus_id, &handle) != NVML_SUCCESS)
+      return nullptr;
+    return &handle;
+  }();
+  unsigned long long mj;
+  if (!device || nvmlDeviceGetTotalEnergyConsumption(*device, &mj) !=
+                     NVML_SUCCESS)
+    return -1;
+  return 1.0e-3 * mj;
+#else
+  // Same for ROCm SMI and HIP, by PCI domain, bus and device
+  static const int index = [] {
+    hipDeviceProp_t prop;
+    uint32_t count;
+    if (rsmi_init(0) != RSMI_STATUS_SUCCESS ||
+        hipGetDeviceProperties(&prop, Kokkos::HIP().hip_device()) !=
+            hipSuccess ||
+        rsmi_num_monitor_devices(&count) != RSMI_STATUS_SUCCESS)
+      return -1;
+    const uint64_t bdf = (uint64_t(prop.pciDomainID) << 32) |
+                         (uint64_t(prop.pciBusID) << 8) |
+                         (uint64_t(prop.pciDeviceID) << 3);
+    for (uint32_t i = 0; i < count; ++i) {
+      uint64_t id;
+      if (rsmi_dev_pci_id_get(i, &id) == RSMI_STATUS_SUCCESS &&
+          (id & ~uint64_t(7)) == bdf)
+        return int(i);
+    }
+    return -1;
+  }();
+  uint64_t counter, timestamp;
+  float resolution;
+  if (index < 0 || rsmi_dev_energy_count_get(index, &counter, &resolution,
+                                              &timestamp) !=
+                       RSMI_STATUS_SUCCESS)
+    return -1;
+  return 1.0e-6 * resolution * counter;
+#endif
+}
+#endif
+
+/// Where the host and device energy come from, for the benchmark context
+inline std::string host_energy_source() {
+  const size_t n = rapl_domains().size();
+  return n ? "RAPL (" + std::to_string(n) + " domains)" : "";
+}
+
+inline std::string device_energy_source() {
+#ifdef KOKKOSKERNELS_BENCHMARK_DEVICE_ENERGY
+  if (device_energy_joules() >= 0) return KOKKOSKERNELS_BENCHMARK_DEVICE_ENERGY;
+#endif
+  return "";
+}
+
+/// Energy used by the host and by the device between construction (or
+/// restart()) and a call of the getters. Construct it right before the
+/// benchmark loop: it measures everything in between, including the parts
+/// where timing is paused.
+class EnergyMeter {
+ public:
+  EnergyMeter() { restart(); }
+
+  void restart() {
+    Kokkos::fence();
+    host_start = read_host();
+#ifdef KOKKOSKERNELS_BENCHMARK_DEVICE_ENERGY
+    device_start = device_energy_joules();
+#endif
+    timer.reset();
+  }
+
+  /// Joules used by the host since the start, -1 if not measured
+  double host_joules() const {
+    if (host_start.empty()) return -1;
+    Kokkos::fence();
+    const std::vector<double> now = read_host();
+    const auto &domains           = rapl_domains();
+    if (now.size() != domains.size()) return -1;
+    double uj = 0;
+    for (size_t d = 0; d < domains.size(); ++d) {
+      double delta = now[d] - host_start[d];
+      // one wrap around at most, the counters take minutes to wrap
+      if (delta < 0) delta += domains[d].max_uj;
+      uj += delta;
+    }
+    return 1.0e-6 * uj;
+  }
+
+  /// Joules used by the device since the start, -1 if not measured
+  double device_joules() const {
+#ifdef KOKKOSKERNELS_BENCHMARK_DEVICE_ENERGY
+    if (device_start < 0) return -1;
+    Kokkos::fence();
+    const double now = device_energy_joules();
+    return now < 0 ? -1 : now - device_start;
+#else
+    return -1;
+#endif
+  }
+
+  /// Wall time since the start
+  double seconds() const { return timer.seconds(); }
+
+ private:
+  static std::vector<double> read_host() {
+    std::vector<double> uj;
+    for (const auto &domain : rapl_domains()) {
+      double value;
+      if (!read_sysfs_number(domain.energy_path, value)) return {};
+      uj.push_back(value);
+    }
+    return uj;
+  }
+
+  std::vector<double> host_start;
+  double device_start = -1;
+  Kokkos::Timer timer;
+};
+
+/// Report the energy measured by \c meter over the iterations of \c state:
+/// "J/iter" (and "J_host/iter", "J_device/iter" when both are measured),
+/// the average power "W" over the wall time of the meter and, given the
+/// flops of one iteration, "GFLOP/J". Nothing is reported when no counter
+/// is available.
+inline void set_energy(benchmark::State &state, const EnergyMeter &meter,
+                       const double flops) {
+  using benchmark::Counter;
+  const double seconds = meter.seconds();
+  const double host    = meter.host_joules();
+  const double device  = meter.device_joules();
+  if (host < 0 && device < 0) return;
+  const double joules = (host > 0 ? host : 0) + (device > 0 ? device : 0);
+  if (host >= 0 && device >= 0) {
+    state.counters["J_host/iter"]   = Counter(host, Counter::kAvgIterations);
+    state.counters["J_device/iter"] = Counter(device, Counter::kAvgIterations);
+  }
+  state.counters["J/iter"] = Counter(joules, Counter::kAvgIterations);
+  if (seconds > 0) state.counters["W"] = joules / seconds;
+  if (flops > 0 && joules > 0) {
+    state.counters["GFLOP/J"] = flops * state.iterations() * 1.0e-9 / joules;
+  }
+}
+
+}  // namespace KokkosKernelsBenchmark
+
+#endif  // KOKKOSKERNELS_PERFTEST_BENCHMARK_ENERGY_HPP
@@ -0,0 +1,151 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSKERNELS_PERFTEST_BENCHMARK_MEMORY_HPP
+#define KOKKOSKERNELS_PERFTEST_BENCHMARK_MEMORY_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include <Kokkos_Core.hpp>
+
+namespace KokkosKernelsBenchmark {
+
+// Memory high-water marks. The allocations of Kokkos (Views, and so all
+// the temporaries of Kokkos Kernels) are counted per memory space through
+// the Kokkos Tools allocation callbacks, which gives exact peaks on any
+// device. The callbacks are global to the process, so they are only
+// installed if no Kokkos Tools library is loaded, and there is a single set
+// of peaks. The resident set high-water mark of the process (VmHWM in
+// /proc/self/status, Linux only) also covers the host memory allocated
+// outside of Kokkos, e.g. by the matrix market reader.
+
+/// Bytes currently allocated in a memory space, and their peak
+struct SpaceAllocation {
+  int64_t current = 0;
+  int64_t peak    = 0;
+};
+
+struct AllocationTracker {
+  std::mutex mutex;
+  std::map<std::string, SpaceAllocation> spaces;
+  bool installed = false;
+};
+
+inline AllocationTracker &allocation_tracker() {
+  static AllocationTracker tracker;
+  return tracker;
+}
+
+inline void track_allocate(const Kokkos_Profiling_SpaceHandle space,
+                           const char * /* label */, const void * /* ptr */,
+                           const uint64_t size) {
+  AllocationTracker &tracker = allocation_tracker();
+  std::lock_guard<std::mutex> lock(tracker.mutex);
+  SpaceAllocation &s = tracker.spaces[space.name];
+  s.current += int64_t(size);
+  s.peak = std::max(s.peak, s.current);
+}
+
+inline void track_deallocate(const Kokkos_Profiling_SpaceHandle space,
+                             const char * /* label */, const void * /* ptr */,
+                             const uint64_t size) {
+  AllocationTracker &tracker = allocation_tracker();
+  std::lock_guard<std::mutex> lock(tracker.mutex);
+  // memory allocated before the tracking was installed is not counted
+  int64_t &current = tracker.spaces[space.name].current;
+  current          = std::max<int64_t>(0, current - int64_t(size));
+}
+
+/// Install the allocation callbacks, once; false if a tool already owns them
+inline bool install_allocation_tracking() {
+  static const bool installed = [] {
+    if (Kokkos::Tools::profileLibraryLoaded()) return false;
+    Kokkos::Tools::Experimental::set_allocate_data_callback(&track_allocate);
+    Kokkos::Tools::Experimental::set_deallocate_data_callback(
+        &track_deallocate);
+    return true;
+  }();
+  return installed;
+}
+
+/// Value in kB of a field of /proc/self/status, or -1
+inline double proc_status_kb(const std::string &field) {
+  std::ifstream status("/proc/self/status");
+  std::string line;
+  while (std::getline(status, line)) {
+    if (line.compare(0, field.size() + 1, field + ":") == 0)
+      return std::atof(line.c_str() + field.size() + 1);
+  }
+  return -1;
+}
+
+/// Memory high-water marks since construction or the last restart(). Only
+/// one of them should be live at a time, since restart() resets the peaks
+/// of the whole process. The tracking is installed by the first
+/// construction, so it only counts the allocations made after it.
+class MemoryHighWater {
+ public:
+  MemoryHighWater() : tracked(install_allocation_tracking()) { restart(); }
+
+  void restart() {
+    Kokkos::fence();
+    if (tracked) {
+      AllocationTracker &tracker = allocation_tracker();
+      std::lock_guard<std::mutex> lock(tracker.mutex);
+      for (auto &space : tracker.spaces)
+        space.second.peak = space.second.current;
+    }
+    // writing 5 to clear_refs resets VmHWM to the current resident set
+    std::ofstream clear_refs("/proc/self/clear_refs");
+    clear_refs << "5" << std::flush;
+  }
+
+  /// Peak bytes allocated by Kokkos in the memory space named \c space
+  /// (MemorySpace::name()), -1 if not tracked
+  double peak_bytes(const std::string &space) const {
+    if (!tracked) return -1;
+    AllocationTracker &tracker = allocation_tracker();
+    std::lock_guard<std::mutex> lock(tracker.mutex);
+    auto it = tracker.spaces.find(space);
+    return it == tracker.spaces.end() ? 0.0 : double(it->second.peak);
+  }
+
+  template <typename MemorySpace>
+  double peak_bytes() const {
+    return peak_bytes(MemorySpace::name());
+  }
+
+  /// Peak resident set of the process in bytes, -1 if unknown. Where it
+  /// cannot be reset (Linux before 4.0) it is the peak since the start of
+  /// the process.
+  double host_rss_peak_bytes() const {
+    const double kb = proc_status_kb("VmHWM");
+    return kb < 0 ? -1 : 1024.0 * kb;
+  }
+
+ private:
+  bool tracked;
+};
+
+}  // namespace KokkosKernelsBenchmark
+
+#endif  // KOKKOSKERNELS_PERFTEST_BENCHMARK_MEMORY_HPP
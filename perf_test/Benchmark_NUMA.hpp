@@ -0,0 +1,156 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSKERNELS_PERFTEST_BENCHMARK_NUMA_HPP
+#define KOKKOSKERNELS_PERFTEST_BENCHMARK_NUMA_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <benchmark/benchmark.h>
+
+#include <Kokkos_Core.hpp>
+
+namespace KokkosKernelsBenchmark {
+
+/// Expand a sysfs cpu or node list such as "0-3,8,10-11"
+inline std::vector<int> parse_sysfs_list(const std::string &list) {
+  std::vector<int> ids;
+  std::stringstream ss{list};
+  for (std::string range; std::getline(ss, range, ',');) {
+    if (range.empty() || range == "\n") continue;
+    const auto dash = range.find('-');
+    const int first = std::stoi(range.substr(0, dash));
+    const int last =
+        dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+    for (int id = first; id <= last; ++id) ids.push_back(id);
+  }
+  return ids;
+}
+
+/// NUMA node of each cpu, -1 for unknown cpus; empty when the topology is
+/// not available. Read once from /sys/devices/system/node.
+inline const std::vector<int> &cpu_numa_nodes() {
+  static const std::vector<int> cpu_nodes = [] {
+    std::vector<int> nodes;
+    std::ifstream online("/sys/devices/system/node/online");
+    std::string line;
+    if (!online || !std::getline(online, line)) return nodes;
+    for (const int node : parse_sysfs_list(line)) {
+      std::ifstream cpulist("/sys/devices/system/node/node" +
+                            std::to_string(node) + "/cpulist");
+      if (!cpulist || !std::getline(cpulist, line)) continue;
+      for (const int cpu : parse_sysfs_list(line)) {
+        if (cpu >= static_cast<int>(nodes.size())) nodes.resize(cpu + 1, -1);
+        nodes[cpu] = node;
+      }
+    }
+    return nodes;
+  }();
+  return cpu_nodes;
+}
+
+inline int num_numa_nodes() {
+  std::vector<int> nodes = cpu_numa_nodes();
+  std::sort(nodes.begin(), nodes.end());
+  nodes.erase(std::unique(nodes.begin(), nodes.end()), nodes.end());
+  return std::count_if(nodes.begin(), nodes.end(),
+                       [](const int node) { return node >= 0; });
+}
+
+/// Fraction of the touched memory pages of \c view that reside on the NUMA
+/// node of the host thread that a static partition of the view gives them
+/// to. That is the placement parallel first touch produces and the one the
+/// host kernels, which split their rows statically, expect: a low value on
+/// a multi-socket node shows an array initialized by a single thread or
+/// from the other socket. Returns -1 when it cannot be measured, i.e. with
+/// a single NUMA node, memory that is not accessible from the host or no
+/// topology information.
+template <class ViewType>
+double numa_locality(const ViewType &view) {
+#if defined(__linux__) && defined(SYS_move_pages)
+  using memory_space = typename ViewType::memory_space;
+  using value_type   = typename ViewType::value_type;
+  using host_exec    = Kokkos::DefaultHostExecutionSpace;
+  if constexpr (Kokkos::SpaceAccessibility<Kokkos::HostSpace,
+                                           memory_space>::accessible) {
+    const std::vector<int> &cpu_nodes = cpu_numa_nodes();
+    if (num_numa_nodes() < 2 || view.span() == 0) return -1;
+
+    const std::uintptr_t page_size = sysconf(_SC_PAGESIZE);
+    const auto begin = reinterpret_cast<std::uintptr_t>(view.data());
+    const auto end   = begin + view.span() * sizeof(value_type);
+    const int num_pages =
+        static_cast<int>((end - 1) / page_size - begin / page_size + 1);
+
+    std::vector<void *> pages(num_pages);
+    std::vector<int> page_nodes(num_pages, -1), owners(num_pages, -1);
+    for (int p = 0; p < num_pages; ++p) {
+      pages[p] = reinterpret_cast<void *>((begin / page_size + p) * page_size);
+    }
+    // with a null node list move_pages only reports where the pages are,
+    // -ENOENT for pages that were never touched
+    if (syscall(SYS_move_pages, 0, num_pages, pages.data(), nullptr,
+                page_nodes.data(), 0) != 0) {
+      return -1;
+    }
+    Kokkos::parallel_for(
+        "KokkosKernelsBenchmark::numa_owners",
+        Kokkos::RangePolicy<host_exec, Kokkos::Schedule<Kokkos::Static>>(
+            0, num_pages),
+        [&](const int p) {
+          const int cpu = sched_getcpu();
+          owners[p]     = (0 <= cpu && cpu < static_cast<int>(cpu_nodes.size()))
+                              ? cpu_nodes[cpu]
+                              : -1;
+        });
+    host_exec().fence();
+
+    int touched = 0, local = 0;
+    for (int p = 0; p < num_pages; ++p) {
+      if (page_nodes[p] < 0 || owners[p] < 0) continue;
+      ++touched;
+      if (page_nodes[p] == owners[p]) ++local;
+    }
+    return touched > 0 ? static_cast<double>(local) / touched : -1;
+  }
+#endif
+  (void)view;
+  return -1;
+}
+
+/// Report the NUMA locality of \c view as the "%NUMA_<name>" counter, when
+/// it can be measured
+template <class ViewType>
+void set_numa_locality(benchmark::State &state, const std::string &name,
+                       const ViewType &view) {
+  const double locality = numa_locality(view);
+  if (locality >= 0) state.counters["%NUMA_" + name] = 100.0 * locality;
+}
+
+}  // namespace KokkosKernelsBenchmark
+
+#endif  // KOKKOSKERNELS_PERFTEST_BENCHMARK_NUMA_HPP
@@ -19,6 +19,16 @@
 #ifndef KOKKOSKERNELS_PERFTEST_BENCHMARK_UTILS_HPP
 #define KOKKOSKERNELS_PERFTEST_BENCHMARK_UTILS_HPP
 
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <Kokkos_Core.hpp>
+
+#include "Benchmark_Energy.hpp"
+
 namespace KokkosKernelsBenchmark {
 
 class WrappedBool {
@@ -40,6 +50,136 @@ class SkipOnError : public WrappedBool {
   SkipOnError(const bool &val) : WrappedBool(val) {}
 };
 
+/// Work of one kernel call: flops and compulsory bytes moved to and from
+/// memory, each operand counted once.
+struct KernelWork {
+  double flops;
+  double bytes;
+};
+
+/// Analytic work models. Sizes are in elements; \c s, \c o and \c z are the
+/// sizes in bytes of the scalar, ordinal and offset types.
+namespace Model {
+
+inline KernelWork dot(double n, double s) { return {2 * n, 2 * n * s}; }
+
+// y = beta * y + A * x with an m x n A
+inline KernelWork gemv(double m, double n, double s) {
+  return {2 * m * n, (m * n + n + 2 * m) * s};
+}
+
+// C = beta * C + A * B with an m x k A and a k x n B
+inline KernelWork gemm(double m, double n, double k, double s) {
+  return {2 * m * n * k, (m * k + k * n + 2 * m * n) * s};
+}
+
+// Y = beta * Y + A * X for an nrows x ncols CRS A and \c nv vectors
+inline KernelWork spmv(double nrows, double ncols, double nnz, double nv,
+                       double s, double o, double z) {
+  return {2 * nnz * nv,
+          nnz * (s + o) + (nrows + 1) * z + nv * (ncols + 2 * nrows) * s};
+}
+
+// C = A * B given the number of scalar products sum_{A(i,j)} nnz(B(j,:))
+inline KernelWork spgemm(double products, double nrows, double nnzA,
+                         double nnzC, double s, double o, double z) {
+  return {2 * products, (nnzA + nnzC + products) * (s + o) +
+                            2 * (nrows + 1) * z};
+}
+
+}  // namespace Model
+
+/// Best of ten STREAM triads a(i) = b(i) + q * c(i) on three arrays of 2^24
+/// doubles in the default execution space, in bytes/s
+inline double measure_stream_triad() {
+  using exec_t = Kokkos::DefaultExecutionSpace;
+  const int n  = 1 << 24;
+  Kokkos::View<double *, exec_t> a("stream_a", n), b("stream_b", n),
+      c("stream_c", n);
+  Kokkos::deep_copy(b, 1.0);
+  Kokkos::deep_copy(c, 2.0);
+  const double q = 3.0;
+  double best    = 0;
+  for (int rep = 0; rep < 11; ++rep) {
+    Kokkos::fence();
+    Kokkos::Timer timer;
+    Kokkos::parallel_for(
+        "KokkosKernelsBenchmark::stream_triad",
+        Kokkos::RangePolicy<exec_t>(0, n),
+        KOKKOS_LAMBDA(const int i) { a(i) = b(i) + q * c(i); });
+    Kokkos::fence();
+    const double t = timer.seconds();
+    // the first launch only warms up
+    if (rep > 0 && t > 0) best = std::max(best, 3.0 * sizeof(double) * n / t);
+  }
+  return best;
+}
+
+/// Sustained memory bandwidth in bytes/s, calibrated once.
+/// add_benchmark_context calls this so the triad runs at startup, before
+/// any benchmark.
+inline double stream_triad_bandwidth() {
+  static const double bandwidth = measure_stream_triad();
+  return bandwidth;
+}
+
+/// Peak flop rate in flops/s from KOKKOSKERNELS_BENCHMARK_PEAK_GFLOPS, or 0
+/// if unset; there is no portable way to measure it.
+inline double peak_flop_rate() {
+  const char *peak = std::getenv("KOKKOSKERNELS_BENCHMARK_PEAK_GFLOPS");
+  return peak ? std::atof(peak) * 1.0e9 : 0.0;
+}
+
+/// Report the work done by one iteration of \c state as GFLOP/s and GB/s,
+/// and place it on the roofline: "%STREAM" is the achieved fraction of the
+/// calibrated triad bandwidth, "flops/byte" the arithmetic intensity and,
+/// when a peak is configured, "%roofline" the fraction of
+/// min(peak, intensity * bandwidth). \c flops and \c bytes come from the
+/// analytic model of the kernel, not from hardware counters, so the rates are
+/// comparable across implementations of the same operation.
+inline void set_rates(benchmark::State &state, const double flops,
+                      const double bytes) {
+  using benchmark::Counter;
+  state.counters["GFLOP/s"] =
+      Counter(flops * 1.0e-9, Counter::kIsIterationInvariantRate);
+  state.counters["GB/s"] =
+      Counter(bytes * 1.0e-9, Counter::kIsIterationInvariantRate);
+
+  const double bandwidth = stream_triad_bandwidth();
+  if (bandwidth > 0 && bytes > 0) {
+    state.counters["%STREAM"] =
+        Counter(100.0 * bytes / bandwidth, Counter::kIsIterationInvariantRate);
+  }
+  if (flops > 0 && bytes > 0) {
+    const double intensity       = flops / bytes;
+    state.counters["flops/byte"] = intensity;
+    const double peak            = peak_flop_rate();
+    if (peak > 0 && bandwidth > 0) {
+      const double roof = std::min(peak, intensity * bandwidth);
+      state.counters["%roofline"] =
+          Counter(100.0 * flops / roof, Counter::kIsIterationInvariantRate);
+    }
+  }
+}
+
+/// \c calls invocations of a kernel with work \c work per iteration
+inline void set_rates(benchmark::State &state, const KernelWork &work,
+                      const double calls = 1) {
+  set_rates(state, calls * work.flops, calls * work.bytes);
+}
+
+/// As above, and the energy measured by \c energy (see set_energy)
+inline void set_rates(benchmark::State &state, const double flops,
+                      const double bytes, const EnergyMeter &energy) {
+  set_rates(state, flops, bytes);
+  set_energy(state, energy, flops);
+}
+
+inline void set_rates(benchmark::State &state, const KernelWork &work,
+                      const double calls, const EnergyMeter &energy) {
+  set_rates(state, calls * work.flops, calls * work.bytes, energy);
+}
+
 }  // namespace KokkosKernelsBenchmark
 
 #endif  // KOKKOSKERNELS_PERFTEST_BENCHMARK_UTILS_HPP
\ No newline at end of file
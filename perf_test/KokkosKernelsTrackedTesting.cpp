@@ -26,14 +26,22 @@
 #include "blas/blas2/tracked_testing.hpp"
 #include "blas/blas3/tracked_testing.hpp"
 int main(int argc, char* argv[]) {
+  bool archive_passed = true;
   {
     // argument parsing for setting input data at runtime
 
     std::string inputDataPath;
+    // optional regression archive: --archive FILE.yaml [--archive-tolerance
+    // T] [--archive-host NAME]
+    std::string archivePath;
+    std::string archiveHost;
+    double archiveTolerance = 0.1;
     if (argc == 1) {
       //    print_help();
       std::cout << "Please provide input data directory: --input-data "
-                   "/PATH/TO/KOKKOS-KERNELS/INPUT/DATA"
+                   "/PATH/TO/KOKKOS-KERNELS/INPUT/DATA\n"
+                   "Optionally check timings against an archive: --archive "
+                   "FILE.yaml [--archive-tolerance 0.1] [--archive-host NAME]"
                 << std::endl;
       return 0;
     }
@@ -50,6 +58,18 @@ int main(int argc, char* argv[]) {
         inputDataPath = std::string(argv[i]);
         continue;
       }
+      if ((strcmp(argv[i], "--archive") == 0) && i + 1 < argc) {
+        archivePath = std::string(argv[++i]);
+        continue;
+      }
+      if ((strcmp(argv[i], "--archive-tolerance") == 0) && i + 1 < argc) {
+        archiveTolerance = atof(argv[++i]);
+        continue;
+      }
+      if ((strcmp(argv[i], "--archive-host") == 0) && i + 1 < argc) {
+        archiveHost = std::string(argv[++i]);
+        continue;
+      }
     }
 
     test::set_input_data_path(inputDataPath);
@@ -84,7 +104,13 @@ int main(int argc, char* argv[]) {
 
     // STEP 5: Generate suite execution reports
     exec.outputRunData();
+
+    // STEP 6: Compare against (and extend) the regression archive
+    if (!archivePath.empty()) {
+      archive_passed = test::archive_tracked_results(
+          archivePath, archiveTolerance, archiveHost);
+    }
   }
   Kokkos::finalize();
-  return 0;
+  return archive_passed ? 0 : 1;
 }
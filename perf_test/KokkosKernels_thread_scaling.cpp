@@ -0,0 +1,312 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+// Thread scaling driver for the Google benchmark executables on host
+// backends. It runs a benchmark binary once per thread count and thread
+// placement policy, reads its CSV output and reports, for each benchmark,
+// the speedup and parallel efficiency over the smallest thread count along
+// with the %NUMA_* locality counters (see Benchmark_NUMA.hpp) so that
+// remote first touch shows next to the scaling curve.
+//
+// Example, on a two socket node:
+//   thread_scaling --bench ./sparse/KokkosKernels_sparse_spmv_benchmark
+//                  --threads 1,10,20,40,80
+//                  --policies close:cores,spread:cores
+//                  --filter "KokkosSparse_spmv/n:1000000/nv:1"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "KokkosKernels_perf_test_utilities.hpp"
+
+namespace {
+
+struct scaling_parameters {
+  std::string bench;
+  std::string filter;
+  std::string threads;
+  std::string policies = "close:cores,spread:cores";
+  std::string extra_args;
+  double efficiency    = 0.7;
+  double numa          = 90;
+};
+
+// One benchmark of one run of the binary
+struct scaling_sample {
+  int threads;
+  double seconds;
+  std::map<std::string, double> numa;
+};
+
+void print_options() {
+  std::cerr << "Options\n" << std::endl;
+  std::cerr << "  --bench [path]      : Google benchmark executable to run"
+            << std::endl;
+  std::cerr << "  --filter [regex]    : forwarded as --benchmark_filter"
+            << std::endl;
+  std::cerr << "  --threads [list]    : comma separated thread counts "
+            << "(default: powers of 2 up to the number of hardware threads)"
+            << std::endl;
+  std::cerr << "  --policies [list]   : comma separated OMP_PROC_BIND:"
+            << "OMP_PLACES pairs (default: close:cores,spread:cores)"
+            << std::endl;
+  std::cerr << "  --args [string]     : additional arguments of the "
+            << "benchmark executable" << std::endl;
+  std::cerr << "  --efficiency [e]    : efficiency that defines the "
+            << "scaling limit (default: 0.7)" << std::endl;
+  std::cerr << "  --numa [percent]    : flag %NUMA_* counters below this "
+            << "value (default: 90)" << std::endl;
+}
+
+void parse_inputs(int argc, char** argv, scaling_parameters& params) {
+  for (int i = 1; i < argc; ++i) {
+    if (perf_test::check_arg_str(i, argc, argv, "--bench", params.bench)) {
+      ++i;
+    } else if (perf_test::check_arg_str(i, argc, argv, "--filter",
+                                        params.filter)) {
+      ++i;
+    } else if (perf_test::check_arg_str(i, argc, argv, "--threads",
+                                        params.threads)) {
+      ++i;
+    } else if (perf_test::check_arg_str(i, argc, argv, "--policies",
+                                        params.policies)) {
+      ++i;
+    } else if (perf_test::check_arg_str(i, argc, argv, "--args",
+                                        params.extra_args)) {
+      ++i;
+    } else if (perf_test::check_arg_double(i, argc, argv, "--efficiency",
+                                           params.efficiency)) {
+      ++i;
+    } else if (perf_test::check_arg_double(i, argc, argv, "--numa",
+                                           params.numa)) {
+      ++i;
+    } else {
+      print_options();
+      throw std::invalid_argument("Unrecognized command line argument " +
+                                  std::string(argv[i]));
+    }
+  }
+  if (params.bench.empty()) {
+    print_options();
+    throw std::invalid_argument("--bench is required");
+  }
+}
+
+std::vector<std::string> split(const std::string& str, const char sep) {
+  std::vector<std::string> tokens;
+  std::stringstream ss{str};
+  for (std::string token; std::getline(ss, token, sep);) {
+    if (!token.empty()) tokens.push_back(token);
+  }
+  return tokens;
+}
+
+// Split one line of Google benchmark CSV output, fields may be quoted
+std::vector<std::string> split_csv(const std::string& line) {
+  std::vector<std::string> fields(1);
+  bool quoted = false;
+  for (std::size_t idx = 0; idx < line.size(); ++idx) {
+    const char c = line[idx];
+    if (c == '"') {
+      if (quoted && idx + 1 < line.size() && line[idx + 1] == '"') {
+        fields.back() += '"';
+        ++idx;
+      } else {
+        quoted = !quoted;
+      }
+    } else if (c == ',' && !quoted) {
+      fields.emplace_back();
+    } else if (c != '\r' && c != '\n') {
+      fields.back() += c;
+    }
+  }
+  return fields;
+}
+
+double to_seconds(const double time, const std::string& unit) {
+  if (unit == "ns") return time * 1e-9;
+  if (unit == "us") return time * 1e-6;
+  if (unit == "ms") return time * 1e-3;
+  return time;
+}
+
+std::vector<int> default_thread_counts() {
+  const int max_threads =
+      std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+  std::vector<int> counts;
+  for (int threads = 1; threads < max_threads; threads *= 2) {
+    counts.push_back(threads);
+  }
+  counts.push_back(max_threads);
+  return counts;
+}
+
+// Run the benchmark executable with the given number of threads and
+// placement, append its results to samples[benchmark name]. Returns false
+// if the executable could not be run or failed.
+bool run_benchmark(const scaling_parameters& params, const int threads,
+                   const std::string& bind, const std::string& places,
+                   std::map<std::string, std::vector<scaling_sample>>& samples,
+                   std::vector<std::string>& names) {
+  // The OpenMP runtime of the child process reads its placement from the
+  // environment; the Kokkos thread count is also passed on the command line
+  setenv("OMP_NUM_THREADS", std::to_string(threads).c_str(), 1);
+  setenv("OMP_PROC_BIND", bind.c_str(), 1);
+  setenv("OMP_PLACES", places.c_str(), 1);
+
+  std::string command = params.bench +
+                        " --kokkos-num-threads=" + std::to_string(threads) +
+                        " --benchmark_format=csv";
+  if (!params.filter.empty()) {
+    command += " '--benchmark_filter=" + params.filter + "'";
+  }
+  if (!params.extra_args.empty()) command += " " + params.extra_args;
+
+  FILE* pipe = popen(command.c_str(), "r");
+  if (pipe == nullptr) return false;
+
+  std::vector<std::string> header;
+  std::string line;
+  char buffer[4096];
+  while (fgets(buffer, sizeof(buffer), pipe) != nullptr) {
+    line += buffer;
+    if (line.empty() || line.back() != '\n') continue;
+
+    const std::vector<std::string> fields = split_csv(line);
+    line.clear();
+    if (fields[0] == "name") {
+      header = fields;
+      continue;
+    }
+    if (header.empty() || fields.size() != header.size()) continue;
+
+    scaling_sample sample{threads, 0, {}};
+    std::string unit;
+    bool failed = false;
+    for (std::size_t col = 1; col < header.size(); ++col) {
+      if (header[col] == "time_unit") unit = fields[col];
+      if (header[col] == "error_occurred") failed = fields[col] == "true";
+    }
+    if (failed) continue;
+    for (std::size_t col = 1; col < header.size(); ++col) {
+      if (fields[col].empty()) continue;
+      if (header[col] == "real_time") {
+        sample.seconds = to_seconds(std::atof(fields[col].c_str()), unit);
+      } else if (header[col].rfind("%NUMA_", 0) == 0) {
+        sample.numa[header[col].substr(6)] = std::atof(fields[col].c_str());
+      }
+    }
+    if (sample.seconds <= 0) continue;
+    if (samples.find(fields[0]) == samples.end()) names.push_back(fields[0]);
+    samples[fields[0]].push_back(sample);
+  }
+  return pclose(pipe) == 0;
+}
+
+// Print the scaling table of one benchmark and placement policy
+void report(const std::string& name, const std::string& policy,
+            const std::vector<scaling_sample>& samples,
+            const scaling_parameters& params) {
+  if (samples.empty()) return;
+
+  const scaling_sample& base = samples.front();
+  int scaling_limit          = base.threads;
+  std::map<std::string, double> worst_numa;
+
+  std::cout << name << "  [" << policy << "]\n";
+  std::cout << std::setw(10) << "threads" << std::setw(14) << "time[s]"
+            << std::setw(10) << "speedup" << std::setw(12) << "efficiency";
+  for (const auto& counter : base.numa) {
+    std::cout << std::setw(16) << ("%NUMA_" + counter.first);
+  }
+  std::cout << "\n";
+  for (const scaling_sample& sample : samples) {
+    const double speedup    = base.seconds / sample.seconds;
+    const double efficiency = speedup * base.threads / sample.threads;
+    if (efficiency >= params.efficiency) {
+      scaling_limit = std::max(scaling_limit, sample.threads);
+    }
+    std::cout << std::setw(10) << sample.threads << std::setw(14)
+              << std::setprecision(4) << std::scientific << sample.seconds
+              << std::fixed << std::setprecision(2) << std::setw(10) << speedup
+              << std::setw(12) << efficiency;
+    for (const auto& counter : sample.numa) {
+      std::cout << std::setw(16) << std::setprecision(1) << counter.second;
+      auto worst = worst_numa.find(counter.first);
+      if (worst == worst_numa.end() || counter.second < worst->second) {
+        worst_numa[counter.first] = counter.second;
+      }
+    }
+    std::cout << "\n";
+  }
+  std::cout << "  efficiency >= " << std::setprecision(2) << params.efficiency
+            << " up to " << scaling_limit << " threads\n";
+  for (const auto& counter : worst_numa) {
+    if (counter.second < params.numa) {
+      std::cout << "  " << counter.first << ": only " << std::setprecision(1)
+                << counter.second << "% of its pages are local to the "
+                << "threads that use them, check where it is first touched\n";
+    }
+  }
+  std::cout << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  scaling_parameters params;
+  parse_inputs(argc, argv, params);
+
+  std::vector<int> thread_counts;
+  if (params.threads.empty()) {
+    thread_counts = default_thread_counts();
+  } else {
+    for (const std::string& count : split(params.threads, ',')) {
+      thread_counts.push_back(std::atoi(count.c_str()));
+    }
+  }
+
+  int status = 0;
+  for (const std::string& policy : split(params.policies, ',')) {
+    const auto colon         = policy.find(':');
+    const std::string bind   = policy.substr(0, colon);
+    const std::string places = colon == std::string::npos
+                                   ? std::string("cores")
+                                   : policy.substr(colon + 1);
+
+    std::map<std::string, std::vector<scaling_sample>> samples;
+    std::vector<std::string> names;
+    for (const int threads : thread_counts) {
+      if (!run_benchmark(params, threads, bind, places, samples, names)) {
+        std::cerr << "thread_scaling: " << params.bench << " failed with "
+                  << threads << " threads and policy " << policy << std::endl;
+        status = 1;
+      }
+    }
+    for (const std::string& name : names) {
+      report(name, bind + ":" + places, samples[name], params);
+    }
+  }
+  return status;
+}
@@ -0,0 +1,102 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSKERNELS_TRACKED_ARCHIVE_HPP
+#define KOKKOSKERNELS_TRACKED_ARCHIVE_HPP
+
+#include <iostream>
+#include <string>
+
+#include <common/RAJAPerfSuite.hpp>
+#include <common/Executor.hpp>
+
+#include <Kokkos_Core.hpp>
+#include "PerfTestUtilities.hpp"
+
+#ifdef KOKKOSKERNELS_TRACKED_TESTING_ARCHIVE
+#include "Kokkos_Performance.hpp"
+#endif
+
+namespace test {
+
+// Every kernel handed to the executor, so that its timings can be archived
+// once the suite has run.
+inline test_list& tracked_kernels() {
+  static test_list kernels;
+  return kernels;
+}
+
+inline void register_tracked_kernel(rajaperf::Executor& exec,
+                                    const std::string& group,
+                                    rajaperf::KernelBase* kernel) {
+  exec.registerKernel(group, kernel);
+  tracked_kernels().push_back(kernel);
+}
+
+/// Compare the minimum time of every kernel variant that ran against the
+/// YAML archive and record it if it is new. Entries are keyed by host name
+/// plus a machine fingerprint (compiler, CPU, execution space and its
+/// concurrency), so a result is only ever compared with the same machine.
+/// A time outside (1 +- tolerance) of the archived one is a failure;
+/// re-baseline by deleting the entry from the archive.
+///
+/// \return false if any kernel regressed (or sped up) past the tolerance,
+///   or if the archiver is not available in this build
+inline bool archive_tracked_results(const std::string& archive_name,
+                                    const double tolerance,
+                                    const std::string& host_name = "") {
+#ifdef KOKKOSKERNELS_TRACKED_TESTING_ARCHIVE
+  using KokkosKernels::Performance;
+  using exec_space = Kokkos::DefaultExecutionSpace;
+
+  bool passed = true;
+  for (auto* kernel : tracked_kernels()) {
+    for (size_t v = 0; v < rajaperf::NumVariants; ++v) {
+      const auto vid = static_cast<rajaperf::VariantID>(v);
+      if (!kernel->wasVariantRun(vid)) continue;
+
+      Performance archiver;
+      archiver.set_machine_config("Execution_Space", exec_space::name());
+      archiver.set_machine_config("Concurrency", exec_space().concurrency());
+      archiver.set_config("Variant", rajaperf::getVariantName(vid));
+      archiver.set_result("Min_Time", kernel->getMinTime(vid), tolerance);
+
+      const Performance::Result result =
+          archiver.run(archive_name, kernel->getName(), host_name);
+      if (result == Performance::Failed) {
+        std::cerr << "tracked_testing: " << kernel->getName() << " ("
+                  << rajaperf::getVariantName(vid) << ") min time "
+                  << kernel->getMinTime(vid)
+                  << " s is outside the archived band of +-"
+                  << 100 * tolerance << "%\n";
+        passed = false;
+      }
+    }
+  }
+  return passed;
+#else
+  (void)archive_name;
+  (void)tolerance;
+  (void)host_name;
+  std::cerr << "tracked_testing: --archive needs yaml-cpp "
+               "(KokkosKernels_ENABLE_yamlcpp)\n";
+  return false;
+#endif
+}
+
+}  // namespace test
+
+#endif  // KOKKOSKERNELS_TRACKED_ARCHIVE_HPP
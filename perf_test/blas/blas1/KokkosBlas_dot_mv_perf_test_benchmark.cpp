@@ -49,6 +49,7 @@
 
 #include "KokkosBlas_dot_perf_test.hpp"
 #include <benchmark/benchmark.h>
+#include "Benchmark_Utils.hpp"
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 // The Level 1 BLAS perform scalar, vector and vector-vector operations;
@@ -107,6 +108,7 @@ static void run(benchmark::State& state) {
   Kokkos::fill_random(x, pool, 10.0);
   Kokkos::fill_random(y, pool, 10.0);
 
+  KokkosKernelsBenchmark::EnergyMeter energy;
   for (auto _ : state) {
     // do a warm up run of dot:
     KokkosBlas::dot(result, x, y);
@@ -135,6 +137,10 @@ static void run(benchmark::State& state) {
     state.counters["Avg DOT FLOP/s:"] =
         benchmark::Counter(flopsPerRun / avg, benchmark::Counter::kDefaults);
   }
+
+  KokkosKernelsBenchmark::set_rates(
+      state, KokkosKernelsBenchmark::Model::dot(m * n, sizeof(Scalar)),
+      repeat, energy);
 }
 
 BENCHMARK(run<Kokkos::DefaultExecutionSpace>)
@@ -48,6 +48,7 @@
 #include "KokkosKernels_TestUtils.hpp"
 
 #include <benchmark/benchmark.h>
+#include "Benchmark_Utils.hpp"
 
 // Functor to handle the case of a "without Cuda" build
 template <class Vector, class ExecSpace>
@@ -105,6 +106,7 @@ static void run(benchmark::State& state) {
 
   std::cout << "Each test input vector has a length of " << m << std::endl;
 
+  KokkosKernelsBenchmark::EnergyMeter energy;
   for (auto _ : state) {
     // Warm up run of dot:
     teamDotFunctor<Kokkos::View<Scalar*, MemSpace>, ExecSpace>
@@ -137,6 +139,9 @@ static void run(benchmark::State& state) {
     state.counters["Avg DOT FLOP/s:"] =
         benchmark::Counter(flopsPerRun / avg, benchmark::Counter::kDefaults);
   }
+
+  KokkosKernelsBenchmark::set_rates(
+      state, KokkosKernelsBenchmark::Model::dot(m, sizeof(Scalar)), 1, energy);
 }
 
 BENCHMARK(run<Kokkos::DefaultExecutionSpace>)
@@ -21,6 +21,7 @@
 
 #include <common/RAJAPerfSuite.hpp>
 #include <common/Executor.hpp>
+#include "KokkosKernels_tracked_archive.hpp"
 
 #include "KokkosBlas_dot_perf_test.hpp"
 #include "KokkosBlas_team_dot_perf_test.hpp"
@@ -33,7 +34,7 @@ namespace blas {
 void build_dot_executor(rajaperf::Executor& exec, int, char*[],
                         const rajaperf::RunParams& params) {
   for (auto* kernel : construct_dot_kernel_base(params)) {
-    exec.registerKernel("BLAS", kernel);
+    register_tracked_kernel(exec, "BLAS", kernel);
   }
 }
 // Team Dot build_executor
@@ -41,7 +42,7 @@ void build_dot_executor(rajaperf::Executor& exec, int, char*[],
 void build_team_dot_executor(rajaperf::Executor& exec, int, char*[],
                              const rajaperf::RunParams& params) {
   for (auto* kernel : construct_team_dot_kernel_base(params)) {
-    exec.registerKernel("BLAS", kernel);
+    register_tracked_kernel(exec, "BLAS", kernel);
   }
 }
 
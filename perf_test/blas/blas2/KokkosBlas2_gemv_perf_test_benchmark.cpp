@@ -112,6 +112,7 @@ static void KokkosBlas2_GEMV(benchmark::State& state) {
   Kokkos::fence();
   double total_time = 0.0;
 
+  KokkosKernelsBenchmark::EnergyMeter energy;
   for (auto _ : state) {
     // Start timing
     Kokkos::Timer timer;
@@ -129,6 +130,9 @@ static void KokkosBlas2_GEMV(benchmark::State& state) {
   size_t flopsPerRun                 = (size_t)2 * m * n;
   state.counters["Avg GEMV FLOP/s:"] = benchmark::Counter(
       flopsPerRun, benchmark::Counter::kIsIterationInvariantRate);
+  KokkosKernelsBenchmark::set_rates(
+      state, KokkosKernelsBenchmark::Model::gemv(m, n, sizeof(Scalar)), 1,
+      energy);
 }
 
 template <typename ExecSpace>
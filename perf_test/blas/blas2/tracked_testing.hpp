@@ -21,6 +21,7 @@
 
 #include <common/RAJAPerfSuite.hpp>
 #include <common/Executor.hpp>
+#include "KokkosKernels_tracked_archive.hpp"
 
 #include "KokkosBlas2_gemv_perf_test.hpp"
 
@@ -31,7 +32,7 @@ namespace blas2 {
 void build_gemv_executor(rajaperf::Executor& exec, int argc, char* argv[],
                          const rajaperf::RunParams& params) {
   for (auto* kernel : construct_gemv_kernel_base(params)) {
-    exec.registerKernel("BLAS2", kernel);
+    register_tracked_kernel(exec, "BLAS2", kernel);
   }
 }
 
@@ -87,6 +87,7 @@ static void KokkosBlas3_GEMM(benchmark::State& state) {
   Kokkos::fence();
   double total_time = 0.0;
 
+  KokkosKernelsBenchmark::EnergyMeter energy;
   for (auto _ : state) {
     Kokkos::Timer timer;
     KokkosBlas::gemm("N", "N", 1.0, A, B, 0.0, C);
@@ -103,6 +104,10 @@ static void KokkosBlas3_GEMM(benchmark::State& state) {
   size_t flopsPerRun                   = (size_t)2 * m * n * k;
   state.counters["Avg GEMM (FLOP/s):"] = benchmark::Counter(
       flopsPerRun, benchmark::Counter::kIsIterationInvariantRate);
+  // C is m x k and A is m x n here
+  KokkosKernelsBenchmark::set_rates(
+      state, KokkosKernelsBenchmark::Model::gemm(m, k, n, sizeof(Scalar)), 1,
+      energy);
   if constexpr (std::is_same_v<ALayout, Kokkos::LayoutLeft>) {
     state.counters["Memory Layout in A: LayoutLeft"] = 1;
   } else {
@@ -21,6 +21,7 @@
 
 #include <common/RAJAPerfSuite.hpp>
 #include <common/Executor.hpp>
+#include "KokkosKernels_tracked_archive.hpp"
 
 #include "KokkosBlas3_gemm_tracked_perf_test.hpp"
 
@@ -57,7 +58,7 @@ void build_gemm_executor(rajaperf::Executor& exec, int argc, char* argv[],
                          const rajaperf::RunParams& params) {
   for (auto* kernel : construct_gemm_kernel_base(
            params, create_m_n_k_vect<Kokkos::DefaultExecutionSpace>())) {
-    exec.registerKernel("BLAS3", kernel);
+    register_tracked_kernel(exec, "BLAS3", kernel);
   }
 }
 
@@ -218,6 +218,10 @@ void print_options(std::ostream& os, const char* app_name,
         "algorithm)"
      << std::endl
      << spaces
+     << "          COLORING_D2_VB_HYBRID       - VB_BIT, with a team per "
+        "high-degree vertex"
+     << std::endl
+     << spaces
      << "      --repeat <N>        Set number of test repetitions (Default: 1) "
      << std::endl
      << spaces
@@ -277,6 +281,9 @@ int parse_inputs(D2Parameters& params, int argc, char** argv) {
       } else if (0 ==
                  Test::string_compare_no_case(argv[i], "COLORING_D2_NB_BIT")) {
         params.algorithm = COLORING_D2_NB_BIT;
+      } else if (0 == Test::string_compare_no_case(argv[i],
+                                                   "COLORING_D2_VB_HYBRID")) {
+        params.algorithm = COLORING_D2_VB_HYBRID;
       } else {
         std::cerr << "2-Unrecognized command line argument #" << i << ": "
                   << argv[i] << std::endl;
@@ -23,11 +23,15 @@
 #include "Benchmark_Context.hpp"
 
 struct svd_parameters {
-  int numRows, numCols;
+  int numRows, numCols, batchSize;
   bool verbose;
 
-  svd_parameters(const int numRows_, const int numCols_, const bool verbose_)
-      : numRows(numRows_), numCols(numCols_), verbose(verbose_){};
+  svd_parameters(const int numRows_, const int numCols_, const int batchSize_,
+                 const bool verbose_)
+      : numRows(numRows_),
+        numCols(numCols_),
+        batchSize(batchSize_),
+        verbose(verbose_){};
 };
 
 void print_options() {
@@ -40,6 +44,8 @@ void print_options() {
   std::cerr << "\t[Optional] --m           :: number of rows of A" << std::endl;
   std::cerr << "\t[Optional] --n           :: number of columns of A"
             << std::endl;
+  std::cerr << "\t[Optional] --batch       :: number of m x n matrices of the"
+            << " batched case, 0 to skip it" << std::endl;
 }  // print_options
 
 int parse_inputs(svd_parameters& params, int argc, char** argv) {
@@ -48,6 +54,9 @@ int parse_inputs(svd_parameters& params, int argc, char** argv) {
       ++i;
     } else if (perf_test::check_arg_int(i, argc, argv, "--n", params.numCols)) {
       ++i;
+    } else if (perf_test::check_arg_int(i, argc, argv, "--batch",
+                                        params.batchSize)) {
+      ++i;
     } else if (perf_test::check_arg_bool(i, argc, argv, "--verbose",
                                          params.verbose)) {
     } else {
@@ -88,6 +97,47 @@ void run_svd_benchmark(benchmark::State& state,
   }
 }
 
+// Decompose batchSize m x n matrices with a single call
+template <class ExecutionSpace>
+void run_svd_batched_benchmark(benchmark::State& state,
+                               const svd_parameters& svd_params) {
+  using mats_type =
+      Kokkos::View<double***, Kokkos::LayoutRight, ExecutionSpace>;
+  using vecs_type = Kokkos::View<double**, Kokkos::LayoutRight, ExecutionSpace>;
+
+  const int m     = svd_params.numRows;
+  const int n     = svd_params.numCols;
+  const int batch = svd_params.batchSize;
+
+  mats_type A("A", batch, m, n), A0("A0", batch, m, n), U("U", batch, m, m),
+      Vt("Vt", batch, n, n);
+  vecs_type S("S", batch, Kokkos::min(m, n));
+
+  const uint64_t seed =
+      std::chrono::high_resolution_clock::now().time_since_epoch().count();
+  Kokkos::Random_XorShift64_Pool<ExecutionSpace> rand_pool(seed);
+
+  // Initialize A with random numbers
+  double randStart = 0, randEnd = 0;
+  Test::getRandomBounds(10.0, randStart, randEnd);
+  Kokkos::fill_random(A0, rand_pool, randStart, randEnd);
+
+  for (auto _ : state) {
+    (void)_;
+    // The decomposition overwrites A
+    state.PauseTiming();
+    Kokkos::deep_copy(A, A0);
+    Kokkos::fence();
+    state.ResumeTiming();
+
+    KokkosLapack::svd("A", "A", A, S, U, Vt);
+    Kokkos::fence();
+  }
+  state.counters["matrices/s"] =
+      benchmark::Counter(static_cast<double>(batch),
+                         benchmark::Counter::kIsIterationInvariantRate);
+}
+
 int main(int argc, char** argv) {
   Kokkos::initialize(argc, argv);
 
@@ -97,7 +147,7 @@ int main(int argc, char** argv) {
 
   perf_test::CommonInputParams common_params;
   perf_test::parse_common_options(argc, argv, common_params);
-  svd_parameters svd_params(0, 0, false);
+  svd_parameters svd_params(0, 0, 0, false);
   parse_inputs(svd_params, argc, argv);
 
   std::string bench_name = "KokkosLapack_SVD";
@@ -115,6 +165,16 @@ int main(int argc, char** argv) {
         ->UseRealTime();
   }
 
+  if (0 < svd_params.batchSize) {
+    auto* batched_bench = benchmark::RegisterBenchmark(
+        (bench_name + "_batched").c_str(),
+        run_svd_batched_benchmark<Kokkos::DefaultExecutionSpace>, svd_params);
+    batched_bench->UseRealTime();
+    if (0 < common_params.repeat) {
+      batched_bench->Iterations(common_params.repeat);
+    }
+  }
+
   benchmark::RunSpecifiedBenchmarks();
 
   benchmark::Shutdown();
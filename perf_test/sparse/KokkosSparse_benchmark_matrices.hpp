@@ -0,0 +1,159 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/*! \file KokkosSparse_benchmark_matrices.hpp
+
+    Shared input handling for the sparse_kernels_benchmark suite. Every kernel
+   registers one benchmark per entry of the matrix list, so a nightly run of
+   the single binary covers the same inputs for every kernel and the JSON
+   output can be diffed run to run.
+
+    The list is read from the file named by the environment variable
+   KOKKOSKERNELS_SPARSE_BENCHMARK_MATRICES: one entry per line, '#' starts a
+   comment. An entry is either a matrix market path (e.g. a SuiteSparse
+   matrix) or "laplace2d:<n>" for the generated 5-point Laplacian on an n x n
+   grid. Without the variable the suite runs on laplace2d:512.
+*/
+
+#ifndef KOKKOSSPARSE_BENCHMARK_MATRICES_HPP
+#define KOKKOSSPARSE_BENCHMARK_MATRICES_HPP
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include "KokkosKernels_default_types.hpp"
+#include "KokkosKernels_Handle.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_IOUtils.hpp"
+#include <KokkosKernels_Test_Structured_Matrix.hpp>
+
+namespace KokkosKernelsBenchmark {
+
+using sparse_scalar_t  = default_scalar;
+using sparse_lno_t     = default_lno_t;
+using sparse_size_type = default_size_type;
+using sparse_exec      = Kokkos::DefaultExecutionSpace;
+using sparse_mem       = typename sparse_exec::memory_space;
+using sparse_device    = Kokkos::Device<sparse_exec, sparse_mem>;
+
+using sparse_crs_t =
+    KokkosSparse::CrsMatrix<sparse_scalar_t, sparse_lno_t, sparse_device,
+                            void, sparse_size_type>;
+using sparse_handle_t = KokkosKernels::Experimental::KokkosKernelsHandle<
+    sparse_size_type, sparse_lno_t, sparse_scalar_t, sparse_exec, sparse_mem,
+    sparse_mem>;
+
+/// Bytes moved by one pass over the values, entries and row map of a CRS
+/// matrix with \c nrows rows and \c nnz entries.
+inline double crs_bytes(const double nrows, const double nnz) {
+  return nnz * (sizeof(sparse_scalar_t) + sizeof(sparse_lno_t)) +
+         (nrows + 1) * sizeof(sparse_size_type);
+}
+
+inline const std::vector<std::string> &sparse_benchmark_matrices() {
+  static const std::vector<std::string> list = [] {
+    std::vector<std::string> entries;
+    const char *path = std::getenv("KOKKOSKERNELS_SPARSE_BENCHMARK_MATRICES");
+    if (path) {
+      std::ifstream in(path);
+      if (!in) {
+        std::cerr << "KOKKOSKERNELS_SPARSE_BENCHMARK_MATRICES: cannot open "
+                  << path << "\n";
+      }
+      std::string line;
+      while (std::getline(in, line)) {
+        line = line.substr(0, line.find('#'));
+        const size_t first = line.find_first_not_of(" \t\r");
+        if (first == std::string::npos) continue;
+        const size_t last = line.find_last_not_of(" \t\r");
+        entries.push_back(line.substr(first, last - first + 1));
+      }
+    }
+    if (entries.empty()) entries.push_back("laplace2d:512");
+    return entries;
+  }();
+  return list;
+}
+
+/// Short name of a matrix list entry for use in benchmark names
+inline std::string sparse_benchmark_label(const std::string &entry) {
+  const size_t slash = entry.find_last_of('/');
+  std::string label =
+      slash == std::string::npos ? entry : entry.substr(slash + 1);
+  const size_t dot = label.rfind(".mtx");
+  if (dot != std::string::npos) label = label.substr(0, dot);
+  return label;
+}
+
+inline sparse_crs_t load_sparse_benchmark_matrix(const std::string &entry) {
+  const std::string laplace = "laplace2d:";
+  if (entry.compare(0, laplace.size(), laplace) == 0) {
+    const int n = std::stoi(entry.substr(laplace.size()));
+    Kokkos::View<int * [3], Kokkos::HostSpace> structure("laplace2d", 2);
+    structure(0, 0) = n;
+    structure(1, 0) = n;
+    return Test::generate_structured_matrix2D<sparse_crs_t>("FD", structure);
+  }
+  return KokkosSparse::Impl::read_kokkos_crst_matrix<sparse_crs_t>(
+      entry.c_str());
+}
+
+/// Flops of the row-by-row ILU update sum_i sum_{k in L(i,:)} 2 nnz(U(k,:)),
+/// which is also the work of C = L * U restricted to the pattern of L + U.
+template <typename RowMap, typename Entries>
+double ilu_flops(const RowMap &L_row_map, const Entries &L_entries,
+                 const RowMap &U_row_map) {
+  auto Lr = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                L_row_map);
+  auto Le = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                L_entries);
+  auto Ur = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                U_row_map);
+  double flops = 0;
+  for (size_t i = 0; i + 1 < Lr.extent(0); ++i) {
+    for (auto k = Lr(i); k < Lr(i + 1); ++k) {
+      const auto col = Le(k);
+      if (static_cast<size_t>(col) == i) continue;
+      flops += 2.0 * (Ur(col + 1) - Ur(col));
+    }
+  }
+  return flops;
+}
+
+/// Register \c fn once per matrix of the list as "KokkosSparse_<kernel>/<m>".
+/// Called from a namespace-scope initializer so BenchmarkMain.cpp sees it.
+template <typename Fn>
+bool register_sparse_benchmark(const std::string &kernel, Fn fn) {
+  for (const auto &entry : sparse_benchmark_matrices()) {
+    const std::string name =
+        "KokkosSparse_" + kernel + "/" + sparse_benchmark_label(entry);
+    benchmark::RegisterBenchmark(name.c_str(), fn, entry)
+        ->UseRealTime()
+        ->Unit(benchmark::kMillisecond);
+  }
+  return true;
+}
+
+}  // namespace KokkosKernelsBenchmark
+
+#endif  // KOKKOSSPARSE_BENCHMARK_MATRICES_HPP
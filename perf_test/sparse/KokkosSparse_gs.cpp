@@ -398,7 +398,7 @@ int main(int argc, char** argv) {
     cout << "Options for cluster:\n";
     cout << "  --cluster-size N (default: 10)\n";
     cout << "  --coarse-algo ALGO\n";
-    cout << "     ALGO may be: \"balloon\" or \"mis2\"\n";
+    cout << "     ALGO may be: \"balloon\", \"mis2\", \"hec\" or \"match\"\n";
     cout << "     Default is chosen by the library. If using mis2, "
             "--cluster-size option has no effect.\n";
     return 0;
@@ -458,9 +458,13 @@ int main(int argc, char** argv) {
         params.coarse_algo = CLUSTER_BALLOON;
       else if (!strcmp(algo, "mis2"))
         params.coarse_algo = CLUSTER_MIS2;
+      else if (!strcmp(algo, "hec"))
+        params.coarse_algo = CLUSTER_HEC;
+      else if (!strcmp(algo, "match"))
+        params.coarse_algo = CLUSTER_MATCH;
       else {
-        std::cout << "Error: invalid coarsening algorithm. Options are balloon "
-                     "and mis2.\n";
+        std::cout << "Error: invalid coarsening algorithm. Options are "
+                     "balloon, mis2, hec and match.\n";
         Kokkos::finalize();
         exit(1);
       }
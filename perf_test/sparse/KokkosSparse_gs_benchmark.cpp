@@ -0,0 +1,68 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <Kokkos_Core.hpp>
+
+#include "Benchmark_Utils.hpp"
+#include "KokkosSparse_benchmark_matrices.hpp"
+#include "KokkosSparse_gauss_seidel.hpp"
+
+namespace {
+
+using namespace KokkosKernelsBenchmark;
+
+// One symmetric (forward + backward) point Gauss-Seidel sweep with the
+// default algorithm; symbolic and numeric setup run once outside the loop.
+void run_gs_apply(benchmark::State &state, const std::string &entry) {
+  using vector_t = Kokkos::View<sparse_scalar_t *, sparse_device>;
+
+  const sparse_crs_t A     = load_sparse_benchmark_matrix(entry);
+  const sparse_lno_t nrows = A.numRows();
+  if (A.numCols() != nrows) {
+    state.SkipWithError("Gauss-Seidel needs a square matrix");
+    return;
+  }
+
+  sparse_handle_t kh;
+  kh.create_gs_handle(KokkosSparse::GS_DEFAULT);
+  KokkosSparse::Experimental::gauss_seidel_symbolic(
+      &kh, nrows, nrows, A.graph.row_map, A.graph.entries, false);
+  KokkosSparse::Experimental::gauss_seidel_numeric(
+      &kh, nrows, nrows, A.graph.row_map, A.graph.entries, A.values, false);
+
+  vector_t x("x", nrows), b("b", nrows);
+  Kokkos::deep_copy(b, Kokkos::ArithTraits<sparse_scalar_t>::one());
+  Kokkos::fence();
+
+  EnergyMeter energy;
+  for (auto _ : state) {
+    KokkosSparse::Experimental::symmetric_gauss_seidel_apply(
+        &kh, nrows, nrows, A.graph.row_map, A.graph.entries, A.values, x, b,
+        true, true, Kokkos::ArithTraits<sparse_scalar_t>::one(), 1);
+    Kokkos::fence();
+  }
+
+  // each half sweep is one pass over A plus x and b
+  const double flops = 2.0 * 2.0 * A.nnz();
+  const double bytes =
+      2.0 * (crs_bytes(nrows, A.nnz()) + 3.0 * nrows * sizeof(sparse_scalar_t));
+  set_rates(state, flops, bytes, energy);
+}
+
+[[maybe_unused]] const bool registered =
+    register_sparse_benchmark("gs_apply", run_gs_apply);
+
+}  // namespace
@@ -0,0 +1,80 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <Kokkos_Core.hpp>
+
+#include "Benchmark_Utils.hpp"
+#include "KokkosSparse_benchmark_matrices.hpp"
+#include "KokkosSparse_par_ilut.hpp"
+
+namespace {
+
+using namespace KokkosKernelsBenchmark;
+
+// Full par_ilut (symbolic + numeric) with the handle defaults, matching
+// KokkosSparse_par_ilut.cpp. The model charges one ILU update over the
+// final L, U pattern per fixed-point iteration.
+void run_par_ilut(benchmark::State &state, const std::string &entry) {
+  using row_map_t = Kokkos::View<sparse_size_type *, sparse_device>;
+  using entries_t = Kokkos::View<sparse_lno_t *, sparse_device>;
+  using values_t  = Kokkos::View<sparse_scalar_t *, sparse_device>;
+  using KokkosSparse::Experimental::par_ilut_numeric;
+  using KokkosSparse::Experimental::par_ilut_symbolic;
+
+  const sparse_crs_t A = load_sparse_benchmark_matrix(entry);
+  if (A.numCols() != A.numRows()) {
+    state.SkipWithError("par_ilut needs a square matrix");
+    return;
+  }
+  const sparse_lno_t nrows = A.numRows();
+
+  sparse_handle_t kh;
+  kh.create_par_ilut_handle();
+  auto handle = kh.get_par_ilut_handle();
+
+  row_map_t L_row_map("L_row_map", nrows + 1);
+  row_map_t U_row_map("U_row_map", nrows + 1);
+  entries_t L_entries("L_entries", 0), U_entries("U_entries", 0);
+  values_t L_values("L_values", 0), U_values("U_values", 0);
+
+  EnergyMeter energy;
+  for (auto _ : state) {
+    par_ilut_symbolic(&kh, A.graph.row_map, A.graph.entries, L_row_map,
+                      U_row_map);
+    Kokkos::resize(L_entries, handle->get_nnzL());
+    Kokkos::resize(L_values, handle->get_nnzL());
+    Kokkos::resize(U_entries, handle->get_nnzU());
+    Kokkos::resize(U_values, handle->get_nnzU());
+    par_ilut_numeric(&kh, A.graph.row_map, A.graph.entries, A.values,
+                     L_row_map, L_entries, L_values, U_row_map, U_entries,
+                     U_values);
+    Kokkos::fence();
+  }
+
+  const double iters = handle->get_num_iters();
+  const double flops = iters * ilu_flops(L_row_map, L_entries, U_row_map);
+  const double bytes =
+      crs_bytes(nrows, A.nnz()) +
+      iters * (crs_bytes(nrows, L_entries.extent(0)) +
+               crs_bytes(nrows, U_entries.extent(0)));
+  set_rates(state, flops, bytes, energy);
+  state.counters["iterations"] = iters;
+}
+
+[[maybe_unused]] const bool registered =
+    register_sparse_benchmark("par_ilut", run_par_ilut);
+
+}  // namespace
@@ -0,0 +1,381 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+
+#include <Kokkos_Core.hpp>
+
+#include "Benchmark_Memory.hpp"
+#include "Benchmark_Utils.hpp"
+#include "KokkosSparse_benchmark_matrices.hpp"
+#include "KokkosGraph_RCM.hpp"
+#include "KokkosKernels_HandleTelemetry.hpp"
+#include "KokkosSparse_AMGPrec.hpp"
+#include "KokkosSparse_LUPrec.hpp"
+#include "KokkosSparse_PermuteCrs.hpp"
+#include "KokkosSparse_cg.hpp"
+#include "KokkosSparse_gauss_seidel.hpp"
+#include "KokkosSparse_gmres.hpp"
+#include "KokkosSparse_spiluk.hpp"
+
+// End-to-end solves, the way an application sees them: every iteration
+// reorders the matrix (RCM), sets up a preconditioner and solves A x = 1
+// from x = 0, so the setup phases are measured together with the solve
+// instead of one kernel at a time. The counters give, per iteration, the
+// seconds of each phase ("t_<phase>") and the high-water mark of the
+// Kokkos allocations in the memory space of the benchmarks during it
+// ("mem_<phase>"), and the peak resident set of the process ("host_rss"),
+// or -1 for the memory that cannot be measured (see Benchmark_Memory.hpp).
+// The matrix is read once, before the loop; "t_read" and "mem_read" are
+// for that read.
+//
+// The phases are
+//   - reorder: RCM of the graph of A and the symmetric permutation of A,
+//     so the graph of A must be symmetric
+//   - symbolic and numeric: Preconditioner::initialize() and compute()
+//   - solve: the Krylov solve, of which
+//     - apply is in the preconditioner,
+//     - for GMRES, spmv is in the products with A and ortho is the rest,
+//       mostly the orthogonalization,
+//     - for CG, spmv_vec is the rest: CG fuses its SpMVs with its dot
+//       products and vector updates, so they are not timed apart.
+// Every phase, and every SpMV and preconditioner application in the solve,
+// is fenced to be timed on its own, which GMRES does through its
+// matrix-free interface. The iterations and the final residual of the last
+// solve are reported as "iters" and "rel_res".
+
+namespace {
+
+using namespace KokkosKernelsBenchmark;
+
+using vector_t       = Kokkos::View<sparse_scalar_t *, sparse_device>;
+using const_vector_t = Kokkos::View<const sparse_scalar_t *, sparse_device>;
+using prec_t         = KokkosSparse::Experimental::Preconditioner<sparse_crs_t>;
+using telemetry_t    = KokkosKernels::Experimental::HandleTelemetry;
+using phase_scope_t  = telemetry_t::Scope<sparse_exec>;
+using karith         = Kokkos::ArithTraits<sparse_scalar_t>;
+
+/// Times and memory high-water marks of the phases of the pipeline
+class PipelinePhases {
+ public:
+  PipelinePhases() { times.enable(); }
+
+  telemetry_t *telemetry() { return &times; }
+
+  /// Run \c f as the phase \c phase
+  template <typename F>
+  void run(const char *phase, F &&f) {
+    memory.restart();
+    {
+      phase_scope_t scope(&times, phase, sparse_exec());
+      f();
+    }
+    // -1 if the allocations are not tracked
+    const double bytes = memory.peak_bytes<sparse_mem>();
+    auto it            = peaks.emplace(phase, bytes).first;
+    it->second         = std::max(it->second, bytes);
+    host_rss           = std::max(host_rss, memory.host_rss_peak_bytes());
+  }
+
+  double seconds(const std::string &phase) const {
+    return times.get_total_seconds(phase);
+  }
+
+  double peak_bytes(const std::string &phase) const {
+    auto it = peaks.find(phase);
+    return it == peaks.end() ? 0.0 : it->second;
+  }
+
+  double host_rss_peak_bytes() const { return host_rss; }
+
+ private:
+  telemetry_t times;
+  MemoryHighWater memory;
+  std::map<std::string, double> peaks;
+  double host_rss = -1;
+};
+
+/// Preconditioner whose applications are timed as the phase "apply"
+class TimedPrec : public prec_t {
+ public:
+  TimedPrec(prec_t &prec_, telemetry_t *times_)
+      : prec(prec_), times(times_) {}
+
+  void apply(const const_vector_t &X, const vector_t &Y,
+             const char transM[] = "N", ScalarType alpha = karith::one(),
+             ScalarType beta = karith::zero()) const override {
+    phase_scope_t scope(times, "apply", sparse_exec());
+    prec.apply(X, Y, transM, alpha, beta);
+  }
+
+  void setParameters() override { prec.setParameters(); }
+  void initialize() override { prec.initialize(); }
+  bool isInitialized() const override { return prec.isInitialized(); }
+  void compute() override { prec.compute(); }
+  bool isComputed() const override { return prec.isComputed(); }
+
+ private:
+  prec_t &prec;
+  telemetry_t *times;
+};
+
+/// A as a matrix-free operator for GMRES, with the SpMVs timed as "spmv"
+struct TimedOperator {
+  sparse_crs_t A;
+  telemetry_t *times;
+
+  void apply(const const_vector_t &x, const vector_t &y) const {
+    phase_scope_t scope(times, "spmv", sparse_exec());
+    KokkosSparse::spmv("N", karith::one(), A, x, karith::zero(), y);
+  }
+};
+
+/// One symmetric Gauss-Seidel sweep from a zero initial guess, with the
+/// default algorithm; symmetric, so it can precondition CG
+class GaussSeidelPrec : public prec_t {
+ public:
+  explicit GaussSeidelPrec(const sparse_crs_t &A_)
+      : A(A_), x("GaussSeidelPrec::x", A_.numRows()) {
+    kh.create_gs_handle(KokkosSparse::GS_DEFAULT);
+  }
+
+  void apply(const const_vector_t &X, const vector_t &Y,
+             const char[] = "N", ScalarType alpha = karith::one(),
+             ScalarType beta = karith::zero()) const override {
+    const sparse_lno_t n = A.numRows();
+    KokkosSparse::Experimental::symmetric_gauss_seidel_apply(
+        &kh, n, n, A.graph.row_map, A.graph.entries, A.values, x, X, true,
+        true, karith::one(), 1);
+    KokkosBlas::axpby(alpha, x, beta, Y);
+  }
+
+  void setParameters() override {}
+
+  void initialize() override {
+    const sparse_lno_t n = A.numRows();
+    KokkosSparse::Experimental::gauss_seidel_symbolic(
+        &kh, n, n, A.graph.row_map, A.graph.entries, false);
+    initialized = true;
+  }
+  bool isInitialized() const override { return initialized; }
+
+  void compute() override {
+    const sparse_lno_t n = A.numRows();
+    KokkosSparse::Experimental::gauss_seidel_numeric(
+        &kh, n, n, A.graph.row_map, A.graph.entries, A.values, false);
+    computed = true;
+  }
+  bool isComputed() const override { return computed; }
+
+ private:
+  sparse_crs_t A;
+  vector_t x;
+  mutable sparse_handle_t kh;
+  bool initialized = false;
+  bool computed    = false;
+};
+
+/// ILU(k) with the default spiluk algorithm, applied by LUPrec: the
+/// symbolic factorization and the level schedules of the triangular solves
+/// are the symbolic phase, the numeric factorization the numeric one
+class ILUPrec : public prec_t {
+ public:
+  using lu_t =
+      KokkosSparse::Experimental::LUPrec<sparse_crs_t, sparse_handle_t>;
+
+  ILUPrec(const sparse_crs_t &A_, const int fill_lev_)
+      : A(A_), fill_lev(fill_lev_) {}
+
+  void apply(const const_vector_t &X, const vector_t &Y,
+             const char transM[] = "N", ScalarType alpha = karith::one(),
+             ScalarType beta = karith::zero()) const override {
+    lu->apply(X, Y, transM, alpha, beta);
+  }
+
+  void setParameters() override {}
+
+  void initialize() override {
+    using row_map_t = sparse_crs_t::row_map_type::non_const_type;
+    using entries_t = sparse_crs_t::index_type::non_const_type;
+    using KokkosSparse::Experimental::SPILUKAlgorithm;
+
+    const sparse_lno_t n = A.numRows();
+    const sparse_size_type guess =
+        static_cast<sparse_size_type>(2 * A.nnz() * (fill_lev + 1));
+    kh.create_spiluk_handle(SPILUKAlgorithm::SEQLVLSCHD_TP1, n, guess, guess);
+    auto handle = kh.get_spiluk_handle();
+
+    row_map_t L_row_map("L_row_map", n + 1), U_row_map("U_row_map", n + 1);
+    entries_t L_entries("L_entries", handle->get_nnzL());
+    entries_t U_entries("U_entries", handle->get_nnzU());
+    KokkosSparse::Experimental::spiluk_symbolic(
+        &kh, fill_lev, A.graph.row_map, A.graph.entries, L_row_map, L_entries,
+        U_row_map, U_entries);
+    Kokkos::resize(L_entries, handle->get_nnzL());
+    Kokkos::resize(U_entries, handle->get_nnzU());
+    vector_t L_values("L_values", handle->get_nnzL());
+    vector_t U_values("U_values", handle->get_nnzU());
+
+    L = sparse_crs_t("L", n, n, handle->get_nnzL(), L_values, L_row_map,
+                     L_entries);
+    U = sparse_crs_t("U", n, n, handle->get_nnzU(), U_values, U_row_map,
+                     U_entries);
+    lu = std::make_unique<lu_t>(L, U);
+    lu->initialize();
+  }
+  bool isInitialized() const override { return lu != nullptr; }
+
+  void compute() override {
+    KokkosSparse::Experimental::spiluk_numeric(
+        &kh, fill_lev, A.graph.row_map, A.graph.entries, A.values,
+        L.graph.row_map, L.graph.entries, L.values, U.graph.row_map,
+        U.graph.entries, U.values);
+    computed = true;
+  }
+  bool isComputed() const override { return computed; }
+
+ private:
+  sparse_crs_t A, L, U;
+  int fill_lev;
+  sparse_handle_t kh;
+  std::unique_ptr<lu_t> lu;
+  bool computed = false;
+};
+
+enum class Solver { CG, GMRES };
+
+/// Report the phases, averaged over the iterations of \c state
+void set_phase_counters(benchmark::State &state, const PipelinePhases &phases,
+                        const Solver solver) {
+  const auto per_iter = benchmark::Counter::kAvgIterations;
+  const auto bytes    = [](const double b) {
+    return benchmark::Counter(b, benchmark::Counter::kDefaults,
+                              benchmark::Counter::kIs1024);
+  };
+  for (const char *phase : {"reorder", "symbolic", "numeric", "solve"}) {
+    state.counters[std::string("t_") + phase] =
+        benchmark::Counter(phases.seconds(phase), per_iter);
+    state.counters[std::string("mem_") + phase] =
+        bytes(phases.peak_bytes(phase));
+  }
+  const double apply = phases.seconds("apply");
+  const double spmv  = phases.seconds("spmv");
+  state.counters["t_apply"] = benchmark::Counter(apply, per_iter);
+  const double rest  = phases.seconds("solve") - apply - spmv;
+  if (solver == Solver::GMRES) {
+    state.counters["t_spmv"]  = benchmark::Counter(spmv, per_iter);
+    state.counters["t_ortho"] = benchmark::Counter(rest, per_iter);
+  } else {
+    state.counters["t_spmv_vec"] = benchmark::Counter(rest, per_iter);
+  }
+  state.counters["host_rss"] = bytes(phases.host_rss_peak_bytes());
+}
+
+/// Read, reorder, set up the preconditioner made by \c make_prec from the
+/// reordered matrix, and solve with \c solver
+template <typename MakePrec>
+void run_pipeline(benchmark::State &state, const std::string &entry,
+                  const Solver solver, MakePrec make_prec) {
+  PipelinePhases phases;
+
+  sparse_crs_t A_in;
+  phases.run("read", [&] { A_in = load_sparse_benchmark_matrix(entry); });
+  state.counters["t_read"]   = phases.seconds("read");
+  state.counters["mem_read"] =
+      benchmark::Counter(phases.peak_bytes("read"),
+                         benchmark::Counter::kDefaults,
+                         benchmark::Counter::kIs1024);
+  if (A_in.numCols() != A_in.numRows()) {
+    state.SkipWithError("the solvers need a square matrix");
+    return;
+  }
+  const sparse_lno_t n = A_in.numRows();
+
+  vector_t x("x", n), b("b", n);
+  Kokkos::deep_copy(b, karith::one());
+  int iters      = 0;
+  double rel_res = 0;
+
+  EnergyMeter energy;
+  for (auto _ : state) {
+    sparse_crs_t A;
+    phases.run("reorder", [&] {
+      auto perm = KokkosGraph::Experimental::graph_rcm<sparse_device>(
+          A_in.graph.row_map, A_in.graph.entries);
+      A = KokkosSparse::permute_crs_matrix(A_in, perm);
+    });
+
+    auto prec = make_prec(A);
+    TimedPrec timed_prec(*prec, phases.telemetry());
+    phases.run("symbolic", [&] { timed_prec.initialize(); });
+    phases.run("numeric", [&] { timed_prec.compute(); });
+
+    Kokkos::deep_copy(x, karith::zero());
+    sparse_handle_t kh;
+    if (solver == Solver::CG) {
+      kh.create_cg_handle(1e-8, 1000);
+      phases.run("solve", [&] {
+        KokkosSparse::Experimental::cg(&kh, A, b, x, &timed_prec);
+      });
+      iters   = kh.get_cg_handle()->get_num_iters();
+      rel_res = kh.get_cg_handle()->get_end_rel_res();
+    } else {
+      kh.create_gmres_handle(50, 1e-8, 50);
+      const TimedOperator op{A, phases.telemetry()};
+      phases.run("solve", [&] {
+        KokkosSparse::Experimental::gmres(&kh, op, b, x, &timed_prec);
+      });
+      iters   = kh.get_gmres_handle()->get_num_iters();
+      rel_res = kh.get_gmres_handle()->get_end_rel_res();
+    }
+  }
+
+  set_phase_counters(state, phases, solver);
+  state.counters["iters"]   = iters;
+  state.counters["rel_res"] = rel_res;
+  set_energy(state, energy, 0.0);
+}
+
+void run_cg_gs(benchmark::State &state, const std::string &entry) {
+  run_pipeline(state, entry, Solver::CG, [](const sparse_crs_t &A) {
+    return std::make_unique<GaussSeidelPrec>(A);
+  });
+}
+
+void run_cg_amg(benchmark::State &state, const std::string &entry) {
+  run_pipeline(state, entry, Solver::CG, [](const sparse_crs_t &A) {
+    return std::make_unique<KokkosSparse::Experimental::AMGPrec<sparse_crs_t>>(
+        A);
+  });
+}
+
+void run_gmres_ilu0(benchmark::State &state, const std::string &entry) {
+  run_pipeline(state, entry, Solver::GMRES, [](const sparse_crs_t &A) {
+    return std::make_unique<ILUPrec>(A, 0);
+  });
+}
+
+[[maybe_unused]] const bool registered_cg_gs =
+    register_sparse_benchmark("pipeline_cg_gs", run_cg_gs);
+[[maybe_unused]] const bool registered_cg_amg =
+    register_sparse_benchmark("pipeline_cg_amg", run_cg_amg);
+[[maybe_unused]] const bool registered_gmres_ilu0 =
+    register_sparse_benchmark("pipeline_gmres_ilu0", run_gmres_ilu0);
+
+}  // namespace
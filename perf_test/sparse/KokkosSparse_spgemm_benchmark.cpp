@@ -0,0 +1,89 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <Kokkos_Core.hpp>
+
+#include "Benchmark_NUMA.hpp"
+#include "Benchmark_Utils.hpp"
+#include "KokkosSparse_benchmark_matrices.hpp"
+#include "KokkosSparse_spgemm.hpp"
+
+namespace {
+
+using namespace KokkosKernelsBenchmark;
+
+// C = A * A. Symbolic is timed on its own; numeric reuses one symbolic pass,
+// which is how applications call it.
+void run_spgemm(benchmark::State &state, const std::string &entry,
+                const bool numeric) {
+  const sparse_crs_t A = load_sparse_benchmark_matrix(entry);
+
+  // flops = 2 * sum over entries A(i,j) of nnz(A(j,:))
+  auto rowmap = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                    A.graph.row_map);
+  auto entries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                     A.graph.entries);
+  double products = 0;
+  for (sparse_size_type k = 0; k < A.nnz(); ++k)
+    products += rowmap(entries(k) + 1) - rowmap(entries(k));
+
+  sparse_handle_t kh;
+  kh.create_spgemm_handle();
+  sparse_crs_t C;
+  KokkosSparse::spgemm_symbolic(kh, A, false, A, false, C);
+  KokkosSparse::spgemm_numeric(kh, A, false, A, false, C);
+  Kokkos::fence();
+
+  EnergyMeter energy;
+  for (auto _ : state) {
+    if (numeric) {
+      KokkosSparse::spgemm_numeric(kh, A, false, A, false, C);
+    } else {
+      state.PauseTiming();
+      kh.destroy_spgemm_handle();
+      kh.create_spgemm_handle();
+      sparse_crs_t Csym;
+      state.ResumeTiming();
+      KokkosSparse::spgemm_symbolic(kh, A, false, A, false, Csym);
+    }
+    Kokkos::fence();
+  }
+
+  const KernelWork work =
+      Model::spgemm(products, A.numRows(), A.nnz(), C.nnz(),
+                    sizeof(sparse_scalar_t), sizeof(sparse_lno_t),
+                    sizeof(sparse_size_type));
+  set_rates(state, numeric ? work.flops : 0.0, work.bytes, energy);
+  state.counters["nnz(C)"] = C.nnz();
+  set_numa_locality(state, "A_values", A.values);
+  set_numa_locality(state, "C_values", C.values);
+  set_numa_locality(state, "C_entries", C.graph.entries);
+}
+
+void run_spgemm_symbolic(benchmark::State &state, const std::string &entry) {
+  run_spgemm(state, entry, false);
+}
+
+void run_spgemm_numeric(benchmark::State &state, const std::string &entry) {
+  run_spgemm(state, entry, true);
+}
+
+[[maybe_unused]] const bool registered_symbolic =
+    register_sparse_benchmark("spgemm_symbolic", run_spgemm_symbolic);
+[[maybe_unused]] const bool registered_numeric =
+    register_sparse_benchmark("spgemm_numeric", run_spgemm_numeric);
+
+}  // namespace
@@ -0,0 +1,94 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <Kokkos_Core.hpp>
+
+#include "Benchmark_Utils.hpp"
+#include "KokkosSparse_benchmark_matrices.hpp"
+#include "KokkosSparse_spiluk.hpp"
+
+namespace {
+
+using namespace KokkosKernelsBenchmark;
+
+// ILU(k) numeric factorization; the symbolic phase for the fill level runs
+// once outside the loop.
+void run_spiluk_numeric(benchmark::State &state, const std::string &entry,
+                        const int fill_lev) {
+  using row_map_t = Kokkos::View<sparse_size_type *, sparse_device>;
+  using entries_t = Kokkos::View<sparse_lno_t *, sparse_device>;
+  using values_t  = Kokkos::View<sparse_scalar_t *, sparse_device>;
+  using KokkosSparse::Experimental::SPILUKAlgorithm;
+
+  const sparse_crs_t A = load_sparse_benchmark_matrix(entry);
+  if (A.numCols() != A.numRows()) {
+    state.SkipWithError("spiluk needs a square matrix");
+    return;
+  }
+  const sparse_lno_t nrows = A.numRows();
+  const sparse_size_type guess =
+      static_cast<sparse_size_type>(2 * A.nnz() * (fill_lev + 1));
+
+  sparse_handle_t kh;
+  kh.create_spiluk_handle(SPILUKAlgorithm::SEQLVLSCHD_TP1, nrows, guess,
+                          guess);
+  auto handle = kh.get_spiluk_handle();
+
+  row_map_t L_row_map("L_row_map", nrows + 1);
+  row_map_t U_row_map("U_row_map", nrows + 1);
+  entries_t L_entries("L_entries", handle->get_nnzL());
+  entries_t U_entries("U_entries", handle->get_nnzU());
+  KokkosSparse::Experimental::spiluk_symbolic(
+      &kh, fill_lev, A.graph.row_map, A.graph.entries, L_row_map, L_entries,
+      U_row_map, U_entries);
+  Kokkos::resize(L_entries, handle->get_nnzL());
+  Kokkos::resize(U_entries, handle->get_nnzU());
+  values_t L_values("L_values", handle->get_nnzL());
+  values_t U_values("U_values", handle->get_nnzU());
+  Kokkos::fence();
+
+  EnergyMeter energy;
+  for (auto _ : state) {
+    KokkosSparse::Experimental::spiluk_numeric(
+        &kh, fill_lev, A.graph.row_map, A.graph.entries, A.values, L_row_map,
+        L_entries, L_values, U_row_map, U_entries, U_values);
+    Kokkos::fence();
+  }
+
+  // each update reads a row of U, plus A once and L, U written once
+  const double flops = ilu_flops(L_row_map, L_entries, U_row_map);
+  const double bytes =
+      crs_bytes(nrows, A.nnz()) + crs_bytes(nrows, handle->get_nnzL()) +
+      crs_bytes(nrows, handle->get_nnzU()) +
+      0.5 * flops * (sizeof(sparse_scalar_t) + sizeof(sparse_lno_t));
+  set_rates(state, flops, bytes, energy);
+  state.counters["levels"] = handle->get_num_levels();
+}
+
+void run_spiluk0_numeric(benchmark::State &state, const std::string &entry) {
+  run_spiluk_numeric(state, entry, 0);
+}
+
+void run_spiluk1_numeric(benchmark::State &state, const std::string &entry) {
+  run_spiluk_numeric(state, entry, 1);
+}
+
+[[maybe_unused]] const bool registered_ilu0 =
+    register_sparse_benchmark("spiluk0_numeric", run_spiluk0_numeric);
+[[maybe_unused]] const bool registered_ilu1 =
+    register_sparse_benchmark("spiluk1_numeric", run_spiluk1_numeric);
+
+}  // namespace
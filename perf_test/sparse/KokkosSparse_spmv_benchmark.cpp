@@ -66,7 +66,7 @@ void print_options() {
                "NxN matrix with average of 10 entries per row."
             << std::endl;
   std::cerr << "\t[Optional] --alg           :: the algorithm to run (default, "
-               "native, merge)"
+               "native, merge, tiled, autotune)"
             << std::endl;
   std::cerr << "\t[Optional] --TPL       :: when available and compatible with "
                "alg, a TPL can be used (cusparse, rocsparse, MKL)"
@@ -94,10 +94,11 @@ void parse_inputs(int argc, char** argv, spmv_parameters& params) {
       ++i;
     } else if (perf_test::check_arg_str(i, argc, argv, "--alg", params.alg)) {
       if ((params.alg != "") && (params.alg != "default") &&
-          (params.alg != "native") && (params.alg != "merge")) {
+          (params.alg != "native") && (params.alg != "merge") &&
+          (params.alg != "autotune")) {
         throw std::runtime_error(
-            "--alg can only be an empty string, `default`, `native` or "
-            "`merge`!");
+            "--alg can only be an empty string, `default`, `native`, "
+            "`merge` or `autotune`!");
       }
       ++i;
     } else if (perf_test::check_arg_str(i, argc, argv, "--TPL", params.tpl)) {
@@ -133,6 +134,10 @@ void run_spmv(benchmark::State& state, const spmv_parameters& inputs) {
     spmv_alg = KokkosSparse::SPMVAlgorithm::SPMV_NATIVE;
   } else if (inputs.alg == "merge") {
     spmv_alg = KokkosSparse::SPMVAlgorithm::SPMV_MERGE_PATH;
+  } else if (inputs.alg == "tiled") {
+    spmv_alg = KokkosSparse::SPMVAlgorithm::SPMV_MV_TILED;
+  } else if (inputs.alg == "autotune") {
+    spmv_alg = KokkosSparse::SPMVAlgorithm::SPMV_AUTOTUNE;
   } else {
     throw std::runtime_error("invalid spmv algorithm");
   }
@@ -160,10 +165,23 @@ void run_spmv(benchmark::State& state, const spmv_parameters& inputs) {
   Kokkos::fence();
 
   // Run the actual experiments
+  KokkosKernelsBenchmark::EnergyMeter energy;
   for (auto _ : state) {
     KokkosSparse::spmv(&handle, KokkosSparse::NoTranspose, 1.0, A, x, 0.0, y);
     Kokkos::fence();
   }
+  KokkosKernelsBenchmark::set_rates(
+      state, KokkosKernelsBenchmark::Model::spmv(
+                 A.numRows(), A.numCols(), A.nnz(), inputs.numvecs,
+                 sizeof(double), sizeof(int), sizeof(int)),
+      1, energy);
+  // placement of the arrays streamed by spmv on multi-socket hosts
+  KokkosKernelsBenchmark::set_numa_locality(state, "values", A.values);
+  KokkosKernelsBenchmark::set_numa_locality(state, "entries", A.graph.entries);
+  KokkosKernelsBenchmark::set_numa_locality(state, "x", x);
+  KokkosKernelsBenchmark::set_numa_locality(state, "y", y);
+  if (spmv_alg == KokkosSparse::SPMVAlgorithm::SPMV_AUTOTUNE)
+    state.SetLabel(handle.get_autotuned_description());
 }
 
 }  // namespace
@@ -274,6 +274,7 @@ void run(benchmark::State &state, const Bsr &bsr, const size_t k) {
                     SkipOnError(true));
 
   Kokkos::fence();
+  EnergyMeter energy;
   for (auto _ : state) {
     Spmv::spmv(mode, alpha, bsr, x, beta, y_exp);
     Kokkos::fence();
@@ -290,6 +291,8 @@ void run(benchmark::State &state, const Bsr &bsr, const size_t k) {
       ;
 
   state.SetBytesProcessed(bytesPerSpmv * state.iterations());
+  set_rates(state, 2.0 * bsr.nnz() * bsr.blockDim() * bsr.blockDim() * k,
+            bytesPerSpmv, energy);
 }
 
 template <typename Bsr, typename Spmv>
@@ -0,0 +1,118 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <Kokkos_Core.hpp>
+
+#include "Benchmark_Utils.hpp"
+#include "KokkosSparse_benchmark_matrices.hpp"
+#include "KokkosSparse_sptrsv.hpp"
+
+namespace {
+
+using namespace KokkosKernelsBenchmark;
+
+// The lower triangle (with diagonal) of A; empty if a diagonal is missing.
+sparse_crs_t lower_triangle(const sparse_crs_t &A) {
+  using row_map_t = typename sparse_crs_t::row_map_type::non_const_type;
+  using entries_t = typename sparse_crs_t::index_type::non_const_type;
+  using values_t  = typename sparse_crs_t::values_type::non_const_type;
+
+  auto rowmap = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                    A.graph.row_map);
+  auto entries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                     A.graph.entries);
+  auto values =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.values);
+
+  const sparse_lno_t nrows = A.numRows();
+  row_map_t L_row_map("L_row_map", nrows + 1);
+  auto h_row_map = Kokkos::create_mirror_view(L_row_map);
+  h_row_map(0) = 0;
+  for (sparse_lno_t i = 0; i < nrows; ++i) {
+    sparse_size_type count = 0;
+    bool diag              = false;
+    for (auto k = rowmap(i); k < rowmap(i + 1); ++k) {
+      if (entries(k) <= i) ++count;
+      if (entries(k) == i) diag = true;
+    }
+    if (!diag) return sparse_crs_t();
+    h_row_map(i + 1) = h_row_map(i) + count;
+  }
+
+  entries_t L_entries("L_entries", h_row_map(nrows));
+  values_t L_values("L_values", h_row_map(nrows));
+  auto h_entries = Kokkos::create_mirror_view(L_entries);
+  auto h_values  = Kokkos::create_mirror_view(L_values);
+  for (sparse_lno_t i = 0; i < nrows; ++i) {
+    sparse_size_type pos = h_row_map(i);
+    for (auto k = rowmap(i); k < rowmap(i + 1); ++k) {
+      if (entries(k) > i) continue;
+      h_entries(pos)  = entries(k);
+      h_values(pos++) = values(k);
+    }
+  }
+  Kokkos::deep_copy(L_row_map, h_row_map);
+  Kokkos::deep_copy(L_entries, h_entries);
+  Kokkos::deep_copy(L_values, h_values);
+  return sparse_crs_t("L", nrows, nrows, h_row_map(nrows), L_values,
+                      L_row_map, L_entries);
+}
+
+// Lower triangular solve with the level-scheduled team algorithm; the
+// symbolic level analysis runs once outside the loop.
+void run_sptrsv_solve(benchmark::State &state, const std::string &entry) {
+  using vector_t = Kokkos::View<sparse_scalar_t *, sparse_device>;
+  using KokkosSparse::Experimental::SPTRSVAlgorithm;
+
+  const sparse_crs_t A = load_sparse_benchmark_matrix(entry);
+  if (A.numCols() != A.numRows()) {
+    state.SkipWithError("sptrsv needs a square matrix");
+    return;
+  }
+  const sparse_crs_t L = lower_triangle(A);
+  if (L.numRows() != A.numRows()) {
+    state.SkipWithError("lower triangle has a zero diagonal");
+    return;
+  }
+  const sparse_lno_t nrows = L.numRows();
+
+  sparse_handle_t kh;
+  kh.create_sptrsv_handle(SPTRSVAlgorithm::SEQLVLSCHD_TP1, nrows, true);
+  KokkosSparse::Experimental::sptrsv_symbolic(&kh, L.graph.row_map,
+                                              L.graph.entries);
+
+  vector_t x("x", nrows), b("b", nrows);
+  Kokkos::deep_copy(b, Kokkos::ArithTraits<sparse_scalar_t>::one());
+  Kokkos::fence();
+
+  EnergyMeter energy;
+  for (auto _ : state) {
+    KokkosSparse::Experimental::sptrsv_solve(&kh, L.graph.row_map,
+                                             L.graph.entries, L.values, b, x);
+    Kokkos::fence();
+  }
+
+  const double flops = 2.0 * L.nnz() - nrows;
+  const double bytes =
+      crs_bytes(nrows, L.nnz()) + 2.0 * nrows * sizeof(sparse_scalar_t);
+  set_rates(state, flops, bytes, energy);
+  state.counters["levels"] = kh.get_sptrsv_handle()->get_num_levels();
+}
+
+[[maybe_unused]] const bool registered =
+    register_sparse_benchmark("sptrsv_solve", run_sptrsv_solve);
+
+}  // namespace
@@ -20,6 +20,7 @@
 #define KOKKOSKERNELS_TRACKED_TESTING_HPP
 #include <common/RAJAPerfSuite.hpp>
 #include <common/Executor.hpp>
+#include "KokkosKernels_tracked_archive.hpp"
 #include "KokkosSparse_spmv_test.hpp"
 
 namespace test {
@@ -28,7 +29,7 @@ void build_executor(rajaperf::Executor& exec, int, char*[],
                     const rajaperf::RunParams& params) {
   exec.registerGroup("Sparse");
   for (auto* kernel : make_spmv_kernel_base(params)) {
-    exec.registerKernel("Sparse", kernel);
+    register_tracked_kernel(exec, "Sparse", kernel);
   }
 }
 }  // namespace sparse
@@ -0,0 +1,126 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_AMG_IMPL_HPP_
+#define KOKKOSSPARSE_AMG_IMPL_HPP_
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ArithTraits.hpp>
+#include "KokkosBatched_LU_Decl.hpp"
+#include "KokkosBatched_SolveLU_Decl.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+
+// Tentative prolongator of an aggregation: row i has a single one in the
+// column of its aggregate, so only the rowmap and the values are filled here
+// and the labels are used as the entries
+template <class RowMapType, class ValuesType>
+struct AMGTentativeProlongatorFunctor {
+  using size_type = typename RowMapType::non_const_value_type;
+  using scalar_t  = typename ValuesType::non_const_value_type;
+
+  RowMapType row_map;
+  ValuesType values;
+  size_type nrows;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const size_type i) const {
+    row_map(i) = i;
+    if (i < nrows) values(i) = Kokkos::ArithTraits<scalar_t>::one();
+  }
+};
+
+// Smoothed prolongator P = (I - omega D^{-1} A) P0, computed in place in the
+// values of A P0. Row i of P0 is the single one in column labels(i), which is
+// in the pattern of row i of A P0 as long as A has its diagonal.
+template <class RowMapType, class EntriesType, class ValuesType,
+          class LabelsType, class DiagType>
+struct AMGSmoothProlongatorFunctor {
+  using lno_t    = typename EntriesType::non_const_value_type;
+  using scalar_t = typename ValuesType::non_const_value_type;
+  using KAT      = Kokkos::ArithTraits<scalar_t>;
+
+  RowMapType row_map;
+  EntriesType entries;
+  ValuesType values;
+  LabelsType labels;
+  DiagType inv_diag;
+  scalar_t omega;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const lno_t i) const {
+    const scalar_t s = -omega * inv_diag(i);
+    for (auto k = row_map(i); k < row_map(i + 1); k++) {
+      values(k) = s * values(k) +
+                  (entries(k) == labels(i) ? KAT::one() : KAT::zero());
+    }
+  }
+};
+
+// Scatters a (small) CRS matrix into a zero-initialized dense matrix, one
+// thread per row
+template <class RowMapType, class EntriesType, class ValuesType,
+          class DenseType>
+struct AMGDenseFillFunctor {
+  using lno_t = typename EntriesType::non_const_value_type;
+
+  RowMapType row_map;
+  EntriesType entries;
+  ValuesType values;
+  DenseType dense;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const lno_t i) const {
+    for (auto k = row_map(i); k < row_map(i + 1); k++) {
+      dense(i, entries(k)) += values(k);
+    }
+  }
+};
+
+// LU factorization (without pivoting) of the dense coarsest matrix, in place,
+// by a single thread
+template <class DenseType>
+struct AMGDenseLUFunctor {
+  DenseType dense;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const int) const {
+    KokkosBatched::SerialLU<KokkosBatched::Algo::LU::Unblocked>::invoke(dense);
+  }
+};
+
+// Solves with the LU factors of the dense coarsest matrix in place of x, by a
+// single thread
+template <class DenseType, class XType>
+struct AMGDenseSolveFunctor {
+  using scalar_t = typename XType::non_const_value_type;
+  using rhs_t =
+      Kokkos::View<scalar_t **, Kokkos::LayoutLeft,
+                   typename XType::device_type,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+  DenseType dense;
+  XType x;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const int) const {
+    rhs_t b(x.data(), x.extent(0), 1);
+    KokkosBatched::SerialSolveLU<
+        KokkosBatched::Trans::NoTranspose,
+        KokkosBatched::Algo::SolveLU::Unblocked>::invoke(dense, b);
+  }
+};
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_AMG_IMPL_HPP_
@@ -0,0 +1,296 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+*/
+
+#ifndef KOKKOSSPARSE_IMPL_BICGSTAB_HPP_
+#define KOKKOSSPARSE_IMPL_BICGSTAB_HPP_
+
+/// \file KokkosSparse_bicgstab_impl.hpp
+/// \brief Implementation of the (right preconditioned) BiCGStab solver.
+
+#include <iostream>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ArithTraits.hpp>
+#include <KokkosSparse_bicgstab_handle.hpp>
+#include <KokkosBlas.hpp>
+#include <KokkosSparse_spmv.hpp>
+#include <KokkosSparse_spmv_dot.hpp>
+#include <KokkosSparse_Preconditioner.hpp>
+#include "KokkosKernels_Error.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+
+// p = r + beta (p - omega v)
+template <class PType, class RType, class VType>
+struct BiCGStabDirectionFunctor {
+  using scalar_t = typename PType::non_const_value_type;
+
+  PType p;
+  RType r;
+  VType v;
+  scalar_t beta;
+  scalar_t omega;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const int i) const {
+    p(i) = r(i) + beta * (p(i) - omega * v(i));
+  }
+};
+
+// s = r - alpha v, fused with ss = (s, s)
+template <class SType, class RType, class VType>
+struct BiCGStabHalfStepFunctor {
+  using scalar_t   = typename SType::non_const_value_type;
+  using KAT        = Kokkos::ArithTraits<scalar_t>;
+  using value_type = typename KAT::mag_type;
+
+  SType s;
+  RType r;
+  VType v;
+  scalar_t alpha;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const int i, value_type &ss) const {
+    const scalar_t si = r(i) - alpha * v(i);
+    s(i)              = si;
+    ss += KAT::real(KAT::conj(si) * si);
+  }
+};
+
+// Inner products of the stabilization step in a single reduction: (t, s) and
+// (t, t)
+template <class TType, class SType>
+struct BiCGStabOmegaDotsFunctor {
+  using scalar_t   = typename TType::non_const_value_type;
+  using KAT        = Kokkos::ArithTraits<scalar_t>;
+  using value_type = scalar_t[];
+  using size_type  = int;
+
+  TType t;
+  SType s;
+  const size_type value_count = 2;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const int i, value_type dots) const {
+    const scalar_t ti = t(i);
+    dots[0] += KAT::conj(ti) * s(i);
+    dots[1] += KAT::conj(ti) * ti;
+  }
+
+  KOKKOS_INLINE_FUNCTION void init(value_type dots) const {
+    for (size_type k = 0; k < value_count; k++) dots[k] = KAT::zero();
+  }
+
+  KOKKOS_INLINE_FUNCTION void join(value_type dst,
+                                   const value_type src) const {
+    for (size_type k = 0; k < value_count; k++) dst[k] += src[k];
+  }
+};
+
+// End of an iteration, fused with the inner products of the next one:
+// x += alpha phat + omega shat, r = s - omega t, then (r, r) and (rhat, r)
+template <class XType, class RType, class PType, class SType, class TType,
+          class RHatType>
+struct BiCGStabUpdateFunctor {
+  using scalar_t   = typename XType::non_const_value_type;
+  using KAT        = Kokkos::ArithTraits<scalar_t>;
+  using value_type = scalar_t[];
+  using size_type  = int;
+
+  XType x;
+  RType r;
+  PType phat;
+  SType s;
+  SType shat;
+  TType t;
+  RHatType rhat;
+  scalar_t alpha;
+  scalar_t omega;
+  const size_type value_count = 2;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const int i, value_type dots) const {
+    x(i) += alpha * phat(i) + omega * shat(i);
+    const scalar_t ri = s(i) - omega * t(i);
+    r(i)              = ri;
+    dots[0] += KAT::conj(ri) * ri;
+    dots[1] += KAT::conj(rhat(i)) * ri;
+  }
+
+  KOKKOS_INLINE_FUNCTION void init(value_type dots) const {
+    for (size_type k = 0; k < value_count; k++) dots[k] = KAT::zero();
+  }
+
+  KOKKOS_INLINE_FUNCTION void join(value_type dst,
+                                   const value_type src) const {
+    for (size_type k = 0; k < value_count; k++) dst[k] += src[k];
+  }
+};
+
+template <class BiCGStabHandle>
+struct BiCGStabWrap {
+  //
+  // Useful types
+  //
+  using execution_space       = typename BiCGStabHandle::execution_space;
+  using scalar_t              = typename BiCGStabHandle::nnz_scalar_t;
+  using float_t               = typename BiCGStabHandle::float_t;
+  using HandleDeviceValueType = typename BiCGStabHandle::nnz_value_view_t;
+  using karith                = typename Kokkos::ArithTraits<scalar_t>;
+  using range_policy          = Kokkos::RangePolicy<execution_space>;
+  using Flag                  = typename BiCGStabHandle::Flag;
+
+  /**
+   * Right preconditioned BiCGStab (van der Vorst), with the shadow residual
+   * rhat = r0. The convergence test is on the relative residual.
+   */
+  template <class AMatrix, class BType, class XType>
+  static void bicgstab(
+      BiCGStabHandle &thandle, const AMatrix &A, const BType &B, XType &X,
+      KokkosSparse::Experimental::Preconditioner<AMatrix> *precond = nullptr) {
+    using direction_t = BiCGStabDirectionFunctor<
+        HandleDeviceValueType, HandleDeviceValueType, HandleDeviceValueType>;
+    using half_step_t = BiCGStabHalfStepFunctor<
+        HandleDeviceValueType, HandleDeviceValueType, HandleDeviceValueType>;
+    using omega_t =
+        BiCGStabOmegaDotsFunctor<HandleDeviceValueType, HandleDeviceValueType>;
+    using update_t = BiCGStabUpdateFunctor<
+        XType, HandleDeviceValueType, HandleDeviceValueType,
+        HandleDeviceValueType, HandleDeviceValueType, HandleDeviceValueType>;
+
+    const scalar_t one  = karith::one();
+    const scalar_t zero = karith::zero();
+    const auto n        = X.extent(0);
+    const float_t tol   = thandle.get_tol();
+    const int max_iters = thandle.get_max_iters();
+    const bool verbose  = thandle.get_verbose();
+
+    if (verbose) {
+      std::cout << "Convergence tolerance is: " << tol << std::endl;
+      std::cout << "  precond:    " << (precond ? "ON" : "OFF") << std::endl;
+    }
+
+    const float_t nrmB = KokkosBlas::nrm2(B);
+    if (nrmB == float_t(0)) {
+      Kokkos::deep_copy(X, zero);
+      thandle.set_stats(0, 0, Flag::Conv);
+      return;
+    }
+
+    HandleDeviceValueType R(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "R"), n);
+    HandleDeviceValueType RHat(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "RHat"), n);
+    HandleDeviceValueType P("P", n);
+    HandleDeviceValueType V("V", n);
+    HandleDeviceValueType S(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "S"), n);
+    HandleDeviceValueType T(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "T"), n);
+    // M*P and M*S; without a preconditioner, these are P and S
+    HandleDeviceValueType PHat = P, SHat = S;
+    if (precond) {
+      PHat = HandleDeviceValueType(
+          Kokkos::view_alloc(Kokkos::WithoutInitializing, "PHat"), n);
+      SHat = HandleDeviceValueType(
+          Kokkos::view_alloc(Kokkos::WithoutInitializing, "SHat"), n);
+    }
+
+    // r = b - A x, rhat = r
+    Kokkos::deep_copy(R, B);
+    KokkosSparse::spmv("N", -one, A, X, one, R);
+    Kokkos::deep_copy(RHat, R);
+
+    scalar_t dots[2];
+    dots[0]        = KokkosBlas::dot(R, R);
+    dots[1]        = dots[0];  // (rhat, r)
+    float_t res    = Kokkos::sqrt(karith::real(dots[0])) / nrmB;
+    int num_iters  = 0;
+    Flag conv_flag = res <= tol ? Flag::Conv : Flag::NoConv;
+
+    scalar_t rho = one, alpha = one, omega = one;
+    while (conv_flag != Flag::Conv && num_iters < max_iters) {
+      const scalar_t rho_new = dots[1];
+      if (rho_new == zero) {
+        conv_flag = Flag::LOA;
+        break;
+      }
+      const scalar_t beta = (rho_new / rho) * (alpha / omega);
+      Kokkos::parallel_for("KokkosSparse::bicgstab::direction",
+                           range_policy(0, n),
+                           direction_t{P, R, V, beta, omega});
+      if (precond) precond->apply(P, PHat);
+
+      // v = A phat, fused with (rhat, v)
+      const scalar_t rhat_v =
+          karith::conj(KokkosSparse::spmv_dot(one, A, PHat, zero, V, RHat));
+      if (rhat_v == zero) {
+        conv_flag = Flag::LOA;
+        break;
+      }
+      alpha = rho_new / rhat_v;
+      rho   = rho_new;
+
+      float_t ss = 0;
+      Kokkos::parallel_reduce("KokkosSparse::bicgstab::half_step",
+                              range_policy(0, n),
+                              half_step_t{S, R, V, alpha}, ss);
+      num_iters++;
+      if (Kokkos::sqrt(ss) / nrmB <= tol) {
+        // Converged at the half step: x += alpha phat
+        KokkosBlas::axpy(alpha, PHat, X);
+        res       = Kokkos::sqrt(ss) / nrmB;
+        conv_flag = Flag::Conv;
+        break;
+      }
+
+      if (precond) precond->apply(S, SHat);
+      KokkosSparse::spmv("N", one, A, SHat, zero, T);
+      scalar_t omega_dots[2];
+      Kokkos::parallel_reduce("KokkosSparse::bicgstab::omega",
+                              range_policy(0, n), omega_t{T, S}, omega_dots);
+      if (omega_dots[1] == zero) {
+        conv_flag = Flag::LOA;
+        break;
+      }
+      omega = omega_dots[0] / omega_dots[1];
+
+      Kokkos::parallel_reduce(
+          "KokkosSparse::bicgstab::update", range_policy(0, n),
+          update_t{X, R, PHat, S, SHat, T, RHat, alpha, omega}, dots);
+      res = Kokkos::sqrt(karith::real(dots[0])) / nrmB;
+      if (verbose) {
+        std::cout << "Iteration " << num_iters << ", relative residual "
+                  << res << std::endl;
+      }
+      if (res <= tol) {
+        conv_flag = Flag::Conv;
+      } else if (omega == zero) {
+        conv_flag = Flag::LOA;
+        break;
+      }
+    }
+
+    if (verbose) {
+      std::cout << "Ending relative residual is: " << res << std::endl;
+      std::cout << "Number of iterations is: " << num_iters << std::endl;
+    }
+    thandle.set_stats(num_iters, res, conv_flag);
+  }  // bicgstab
+};
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_IMPL_BICGSTAB_HPP_
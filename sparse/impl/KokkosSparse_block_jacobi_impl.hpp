@@ -0,0 +1,104 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_BLOCK_JACOBI_IMPL_HPP_
+#define KOKKOSSPARSE_BLOCK_JACOBI_IMPL_HPP_
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ArithTraits.hpp>
+#include "KokkosBatched_LU_Decl.hpp"
+#include "KokkosBatched_InverseLU_Decl.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+
+// Extracts the diagonal blocks of A into the zero-initialized dense blocks,
+// one thread per (padded) row. The rows past the end of A, which pad the
+// last block to the full block size, get a one on the diagonal.
+template <class RowMapType, class EntriesType, class ValuesType,
+          class BlocksType>
+struct BlockJacobiExtractFunctor {
+  using lno_t    = typename EntriesType::non_const_value_type;
+  using scalar_t = typename BlocksType::non_const_value_type;
+
+  RowMapType row_map;
+  EntriesType entries;
+  ValuesType values;
+  BlocksType blocks;
+  lno_t block_size;
+  lno_t nrows;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const lno_t i) const {
+    const lno_t b  = i / block_size;
+    const lno_t li = i % block_size;
+    if (i >= nrows) {
+      blocks(b, li, li) = Kokkos::ArithTraits<scalar_t>::one();
+      return;
+    }
+    for (auto k = row_map(i); k < row_map(i + 1); k++) {
+      const lno_t j = entries(k);
+      if (j / block_size == b) blocks(b, li, j % block_size) += values(k);
+    }
+  }
+};
+
+// Replaces each dense block by its inverse: LU factorization (without
+// pivoting) then the solve with the identity, one thread per block
+template <class BlocksType, class WorkType>
+struct BlockJacobiInvertFunctor {
+  BlocksType blocks;
+  WorkType work;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const int b) const {
+    auto A = Kokkos::subview(blocks, b, Kokkos::ALL, Kokkos::ALL);
+    auto w = Kokkos::subview(work, b, Kokkos::ALL);
+    KokkosBatched::SerialLU<KokkosBatched::Algo::LU::Unblocked>::invoke(A);
+    KokkosBatched::SerialInverseLU<
+        KokkosBatched::Algo::InverseLU::Unblocked>::invoke(A, w);
+  }
+};
+
+// y = beta y + alpha D^{-1} x with the inverted blocks of D, which is a
+// batched gemv; one thread per row, so that small and large blocks both
+// keep the device busy
+template <class BlocksType, class XType, class YType>
+struct BlockJacobiApplyFunctor {
+  using lno_t    = typename YType::size_type;
+  using scalar_t = typename YType::non_const_value_type;
+  using KAT      = Kokkos::ArithTraits<scalar_t>;
+
+  BlocksType blocks;
+  XType x;
+  YType y;
+  scalar_t alpha;
+  scalar_t beta;
+  int block_size;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const lno_t i) const {
+    const lno_t b     = i / block_size;
+    const lno_t li    = i % block_size;
+    const lno_t first = b * block_size;
+    const lno_t last  = Kokkos::min(first + block_size, lno_t(x.extent(0)));
+    scalar_t sum      = KAT::zero();
+    for (lno_t j = first; j < last; j++) sum += blocks(b, li, j - first) * x(j);
+    y(i) = beta == KAT::zero() ? alpha * sum : beta * y(i) + alpha * sum;
+  }
+};
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_BLOCK_JACOBI_IMPL_HPP_
@@ -18,6 +18,7 @@
 #define _KOKKOSBSPGEMMIMPL_HPP
 
 #include "KokkosSparse_spgemm_impl.hpp"
+#include "KokkosSparse_bspgemm_tc_impl.hpp"
 
 namespace KokkosSparse {
 
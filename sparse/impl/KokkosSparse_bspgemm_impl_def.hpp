@@ -39,6 +39,18 @@ void KokkosBSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
     std::cout << "Numeric PHASE" << std::endl;
   }
 
+#if defined(KOKKOSSPARSE_IMPL_BSPGEMM_TENSOR_CORES)
+  const SPGEMMTensorCores tc =
+      this->handle->get_spgemm_handle()->get_tensor_cores();
+  if (tc != SPGEMM_TC_NONE && !this->transposeA && !this->transposeB &&
+      bspgemm_numeric_tensor_cores<MyExecSpace, MyTempMemorySpace>(
+          tc, block_dim, this->a_row_cnt, this->b_col_cnt, this->row_mapA,
+          this->entriesA, this->valsA, this->row_mapB, this->entriesB,
+          this->valsB, rowmapC_, entriesC_, valuesC_)) {
+    return;
+  }
+#endif
+
   if (Base::spgemm_algorithm == SPGEMM_KK_SPEED ||
       Base::spgemm_algorithm == SPGEMM_KK_DENSE) {
     this->KokkosBSPGEMM_numeric_speed(rowmapC_, entriesC_, valuesC_,
@@ -183,6 +183,9 @@ struct BSPGEMM_NUMERIC<
       bool transposeA, b_size_view_t_ row_mapB, b_lno_view_t entriesB,
       b_scalar_view_t valuesB, bool transposeB, c_size_view_t_ row_mapC,
       c_lno_view_t &entriesC, c_scalar_view_t &valuesC) {
+    Kokkos::Profiling::pushRegion(KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+                                      ? "KokkosSparse::bspgemm_numeric[ETI]"
+                                      : "KokkosSparse::bspgemm_numeric[noETI]");
     typedef typename KernelHandle::SPGEMMHandleType spgemmHandleType;
     spgemmHandleType *sh = handle->get_spgemm_handle();
     if (!sh->is_symbolic_called()) {
@@ -230,6 +233,7 @@ struct BSPGEMM_NUMERIC<
     // TODO: remove this call when impl sorts
     KokkosSparse::sort_bsr_matrix<typename KernelHandle::HandleExecSpace>(
         blockDim, row_mapC, entriesC, valuesC);
+    Kokkos::Profiling::popRegion();
   }
 };
 
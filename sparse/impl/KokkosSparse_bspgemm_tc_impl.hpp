@@ -0,0 +1,318 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_BSPGEMM_TC_IMPL_HPP_
+#define KOKKOSSPARSE_BSPGEMM_TC_IMPL_HPP_
+
+#include "KokkosKernels_ExecSpaceUtils.hpp"
+#include "KokkosKernels_Uniform_Initialized_MemoryPool.hpp"
+#include "KokkosSparse_spgemm_handle.hpp"
+
+// fp64 and bf16 fragments need sm_80 or later
+#if defined(KOKKOS_ENABLE_CUDA) && \
+    (defined(KOKKOS_ARCH_AMPERE) || defined(KOKKOS_ARCH_HOPPER))
+#define KOKKOSSPARSE_IMPL_BSPGEMM_TENSOR_CORES
+
+#include <type_traits>
+#include <mma.h>
+#include <cuda_bf16.h>
+
+namespace KokkosSparse {
+namespace Impl {
+
+/// \brief Numeric phase of block SpGEMM with tensor cores, one warp per
+/// block row of C.
+///
+/// The warp first lists the block columns of row i of C (in any order) and
+/// zeroes its blocks; a chunk of a memory pool maps each block column to its
+/// position in the row, plus one. Then for each pair of blocks A(i,k) and
+/// B(k,j) the warp accumulates A(i,k)*B(k,j) into C(i,j), one FRAG_M x
+/// FRAG_N tile at a time, with mma_sync. The tiles are staged through shared
+/// memory to convert them to the fragment types and to pad blocks that are
+/// not a multiple of the fragment size with zeros.
+///
+/// \tparam AFragScalar The scalar type of the A and B fragments
+/// \tparam CFragScalar The scalar type of the accumulator fragment
+/// \tparam FRAG_M (with FRAG_N and FRAG_K) the m-n-k size of the fragments
+template <typename AFragScalar, typename CFragScalar, unsigned FRAG_M,
+          unsigned FRAG_N, unsigned FRAG_K, typename a_row_view_t,
+          typename a_lno_view_t, typename a_scalar_view_t,
+          typename b_row_view_t, typename b_lno_view_t,
+          typename b_scalar_view_t, typename c_row_view_t,
+          typename c_lno_view_t, typename c_scalar_view_t, typename pool_t>
+struct BSpgemmTensorCoreFunctor {
+  using size_type   = typename c_row_view_t::non_const_value_type;
+  using lno_t       = typename c_lno_view_t::non_const_value_type;
+  using scalar_t    = typename c_scalar_view_t::non_const_value_type;
+  using team_member = typename Kokkos::TeamPolicy<Kokkos::Cuda>::member_type;
+  using FragA = nvcuda::wmma::fragment<nvcuda::wmma::matrix_a, FRAG_M, FRAG_N,
+                                       FRAG_K, AFragScalar,
+                                       nvcuda::wmma::row_major>;
+  using FragB = nvcuda::wmma::fragment<nvcuda::wmma::matrix_b, FRAG_M, FRAG_N,
+                                       FRAG_K, AFragScalar,
+                                       nvcuda::wmma::row_major>;
+  using FragC = nvcuda::wmma::fragment<nvcuda::wmma::accumulator, FRAG_M,
+                                       FRAG_N, FRAG_K, CFragScalar>;
+
+  static constexpr int THREADS_PER_WARP = 32;
+  // wmma loads and stores need 256-bit aligned pointers
+  static constexpr size_t SCRATCH_ALIGN = 32;
+
+  lno_t block_dim;
+  lno_t numColsB;
+  a_row_view_t row_mapA;
+  a_lno_view_t entriesA;
+  a_scalar_view_t valuesA;
+  b_row_view_t row_mapB;
+  b_lno_view_t entriesB;
+  b_scalar_view_t valuesB;
+  c_row_view_t row_mapC;
+  c_lno_view_t entriesC;
+  c_scalar_view_t valuesC;
+  pool_t pool;
+
+  static size_t team_scratch_size() {
+    return FRAG_M * FRAG_N * sizeof(CFragScalar) +
+           (FRAG_M * FRAG_K + FRAG_K * FRAG_N) * sizeof(AFragScalar) +
+           3 * SCRATCH_ALIGN;
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const team_member &mbr) const {
+    using nvcuda::wmma::load_matrix_sync;
+    using nvcuda::wmma::mma_sync;
+    using nvcuda::wmma::store_matrix_sync;
+
+    const lno_t i        = mbr.league_rank();
+    const size_type cBeg = row_mapC(i);
+    const lno_t cLen     = row_mapC(i + 1) - cBeg;
+    const lno_t bd       = block_dim;
+    const size_type bs   = size_type(bd) * bd;
+    const unsigned lane  = mbr.team_rank();
+    const scalar_t zero  = Kokkos::ArithTraits<scalar_t>::zero();
+    if (!cLen) return;
+
+    lno_t *slots = nullptr;
+    Kokkos::single(
+        Kokkos::PerTeam(mbr),
+        [&](lno_t *&chunk) {
+          chunk = nullptr;
+          while (chunk == nullptr) chunk = pool.allocate_chunk(i);
+        },
+        slots);
+    lno_t *count = slots + numColsB;
+
+    // The block columns of row i of C
+    for (size_type ka = row_mapA(i); ka < row_mapA(i + 1); ka++) {
+      const lno_t k = entriesA(ka);
+      Kokkos::parallel_for(
+          Kokkos::TeamThreadRange(mbr, row_mapB(k), row_mapB(k + 1)),
+          [&](const size_type kb) {
+            const lno_t j = entriesB(kb);
+            if (Kokkos::atomic_compare_exchange(&slots[j], lno_t(0),
+                                                lno_t(-1)) == lno_t(0)) {
+              entriesC(cBeg + Kokkos::atomic_fetch_add(count, lno_t(1))) = j;
+            }
+          });
+    }
+    mbr.team_barrier();
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(mbr, cLen),
+                         [&](const lno_t t) {
+                           slots[entriesC(cBeg + t)] = t + 1;
+                         });
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(mbr, cLen * bs),
+                         [&](const size_type q) {
+                           valuesC(cBeg * bs + q) = zero;
+                         });
+    mbr.team_barrier();
+
+    CFragScalar *sc = (CFragScalar *)mbr.team_shmem().get_shmem_aligned(
+        FRAG_M * FRAG_N * sizeof(CFragScalar), SCRATCH_ALIGN);
+    AFragScalar *sa = (AFragScalar *)mbr.team_shmem().get_shmem_aligned(
+        FRAG_M * FRAG_K * sizeof(AFragScalar), SCRATCH_ALIGN);
+    AFragScalar *sb = (AFragScalar *)mbr.team_shmem().get_shmem_aligned(
+        FRAG_K * FRAG_N * sizeof(AFragScalar), SCRATCH_ALIGN);
+    FragA fa;
+    FragB fb;
+    FragC fc;
+
+    for (size_type ka = row_mapA(i); ka < row_mapA(i + 1); ka++) {
+      const lno_t k     = entriesA(ka);
+      const scalar_t *a = valuesA.data() + ka * bs;
+      for (size_type kb = row_mapB(k); kb < row_mapB(k + 1); kb++) {
+        const scalar_t *b = valuesB.data() + kb * bs;
+        scalar_t *c = valuesC.data() + (cBeg + slots[entriesB(kb)] - 1) * bs;
+        for (lno_t ti = 0; ti < bd; ti += FRAG_M) {
+          for (lno_t tj = 0; tj < bd; tj += FRAG_N) {
+            for (unsigned q = lane; q < FRAG_M * FRAG_N;
+                 q += THREADS_PER_WARP) {
+              const lno_t r = ti + q / FRAG_N, col = tj + q % FRAG_N;
+              sc[q] = (r < bd && col < bd) ? CFragScalar(c[r * bd + col])
+                                           : CFragScalar(0);
+            }
+            mbr.team_barrier();
+            load_matrix_sync(fc, sc, FRAG_N, nvcuda::wmma::mem_row_major);
+            for (lno_t tk = 0; tk < bd; tk += FRAG_K) {
+              // The previous fragments are loaded before sa and sb change
+              mbr.team_barrier();
+              for (unsigned q = lane; q < FRAG_M * FRAG_K;
+                   q += THREADS_PER_WARP) {
+                const lno_t r = ti + q / FRAG_K, col = tk + q % FRAG_K;
+                sa[q] = (r < bd && col < bd) ? AFragScalar(a[r * bd + col])
+                                             : AFragScalar(0.0f);
+              }
+              for (unsigned q = lane; q < FRAG_K * FRAG_N;
+                   q += THREADS_PER_WARP) {
+                const lno_t r = tk + q / FRAG_N, col = tj + q % FRAG_N;
+                sb[q] = (r < bd && col < bd) ? AFragScalar(b[r * bd + col])
+                                             : AFragScalar(0.0f);
+              }
+              mbr.team_barrier();
+              load_matrix_sync(fa, sa, FRAG_K);
+              load_matrix_sync(fb, sb, FRAG_N);
+              mma_sync(fc, fa, fb, fc);
+            }
+            store_matrix_sync(sc, fc, FRAG_N, nvcuda::wmma::mem_row_major);
+            mbr.team_barrier();
+            for (unsigned q = lane; q < FRAG_M * FRAG_N;
+                 q += THREADS_PER_WARP) {
+              const lno_t r = ti + q / FRAG_N, col = tj + q % FRAG_N;
+              if (r < bd && col < bd) c[r * bd + col] = scalar_t(sc[q]);
+            }
+            mbr.team_barrier();
+          }
+        }
+      }
+    }
+
+    // Leave the chunk zeroed, as it was allocated
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(mbr, cLen),
+                         [&](const lno_t t) { slots[entriesC(cBeg + t)] = 0; });
+    Kokkos::single(Kokkos::PerTeam(mbr), [&]() { *count = 0; });
+    mbr.team_barrier();
+    Kokkos::single(Kokkos::PerTeam(mbr), [&]() { pool.release_chunk(slots); });
+  }
+};
+
+template <typename AFragScalar, typename CFragScalar, unsigned FRAG_M,
+          unsigned FRAG_N, unsigned FRAG_K, typename MemorySpace,
+          typename a_row_view_t, typename a_lno_view_t,
+          typename a_scalar_view_t, typename b_row_view_t,
+          typename b_lno_view_t, typename b_scalar_view_t,
+          typename c_row_view_t, typename c_lno_view_t,
+          typename c_scalar_view_t>
+void bspgemm_numeric_tensor_cores_launch(
+    const typename c_lno_view_t::non_const_value_type block_dim,
+    const typename c_lno_view_t::non_const_value_type m,
+    const typename c_lno_view_t::non_const_value_type numColsB,
+    const a_row_view_t &row_mapA, const a_lno_view_t &entriesA,
+    const a_scalar_view_t &valuesA, const b_row_view_t &row_mapB,
+    const b_lno_view_t &entriesB, const b_scalar_view_t &valuesB,
+    const c_row_view_t &row_mapC, const c_lno_view_t &entriesC,
+    const c_scalar_view_t &valuesC) {
+  using lno_t = typename c_lno_view_t::non_const_value_type;
+  using pool_t =
+      KokkosKernels::Impl::UniformMemoryPool<Kokkos::Device<Kokkos::Cuda,
+                                                            MemorySpace>,
+                                             lno_t>;
+  using functor_t =
+      BSpgemmTensorCoreFunctor<AFragScalar, CFragScalar, FRAG_M, FRAG_N,
+                               FRAG_K, a_row_view_t, a_lno_view_t,
+                               a_scalar_view_t, b_row_view_t, b_lno_view_t,
+                               b_scalar_view_t, c_row_view_t, c_lno_view_t,
+                               c_scalar_view_t, pool_t>;
+
+  // One chunk per resident warp, within half the free memory
+  const size_t chunkSize   = size_t(numColsB) + 1;
+  const size_t chunk_bytes = chunkSize * sizeof(lno_t);
+  size_t num_chunks =
+      Kokkos::Cuda().concurrency() / functor_t::THREADS_PER_WARP;
+  size_t free_byte, total_byte;
+  KokkosKernels::Impl::kk_get_free_total_memory<MemorySpace>(free_byte,
+                                                             total_byte);
+  if (num_chunks * chunk_bytes > free_byte / 2)
+    num_chunks = (free_byte / 2) / chunk_bytes;
+  if (num_chunks < 1) num_chunks = 1;
+  pool_t pool(num_chunks, chunkSize, lno_t(0),
+              KokkosKernels::Impl::ManyThread2OneChunk);
+
+  Kokkos::TeamPolicy<Kokkos::Cuda> policy(m, functor_t::THREADS_PER_WARP);
+  policy.set_scratch_size(0, Kokkos::PerTeam(functor_t::team_scratch_size()));
+  Kokkos::parallel_for(
+      "KokkosSparse::bspgemm_numeric::tensor_cores", policy,
+      functor_t{block_dim, numColsB, row_mapA, entriesA, valuesA, row_mapB,
+                entriesB, valuesB, row_mapC, entriesC, valuesC, pool});
+}
+
+/// \brief Numeric phase of block SpGEMM with tensor cores, in the precision
+/// tc. Writes the (unsorted) entries and values of C and returns true, or
+/// returns false without doing anything if tensor cores can't be used for
+/// this execution space and these scalar types.
+template <typename ExecutionSpace, typename MemorySpace,
+          typename a_row_view_t, typename a_lno_view_t,
+          typename a_scalar_view_t, typename b_row_view_t,
+          typename b_lno_view_t, typename b_scalar_view_t,
+          typename c_row_view_t, typename c_lno_view_t,
+          typename c_scalar_view_t>
+bool bspgemm_numeric_tensor_cores(
+    const SPGEMMTensorCores tc,
+    const typename c_lno_view_t::non_const_value_type block_dim,
+    const typename c_lno_view_t::non_const_value_type m,
+    const typename c_lno_view_t::non_const_value_type numColsB,
+    const a_row_view_t &row_mapA, const a_lno_view_t &entriesA,
+    const a_scalar_view_t &valuesA, const b_row_view_t &row_mapB,
+    const b_lno_view_t &entriesB, const b_scalar_view_t &valuesB,
+    const c_row_view_t &row_mapC, const c_lno_view_t &entriesC,
+    const c_scalar_view_t &valuesC) {
+  using a_scalar_t = typename a_scalar_view_t::non_const_value_type;
+  using b_scalar_t = typename b_scalar_view_t::non_const_value_type;
+  using c_scalar_t = typename c_scalar_view_t::non_const_value_type;
+  constexpr bool available = std::is_same_v<ExecutionSpace, Kokkos::Cuda> &&
+                             std::is_floating_point_v<a_scalar_t> &&
+                             std::is_floating_point_v<b_scalar_t> &&
+                             std::is_floating_point_v<c_scalar_t>;
+  if constexpr (!available) {
+    return false;
+  } else {
+    switch (tc) {
+      case SPGEMM_TC_DOUBLE:
+        bspgemm_numeric_tensor_cores_launch<double, double, 8, 8, 4,
+                                            MemorySpace>(
+            block_dim, m, numColsB, row_mapA, entriesA, valuesA, row_mapB,
+            entriesB, valuesB, row_mapC, entriesC, valuesC);
+        return true;
+      case SPGEMM_TC_HALF:
+        bspgemm_numeric_tensor_cores_launch<half, float, 16, 16, 16,
+                                            MemorySpace>(
+            block_dim, m, numColsB, row_mapA, entriesA, valuesA, row_mapB,
+            entriesB, valuesB, row_mapC, entriesC, valuesC);
+        return true;
+      case SPGEMM_TC_BF16:
+        bspgemm_numeric_tensor_cores_launch<__nv_bfloat16, float, 16, 16, 16,
+                                            MemorySpace>(
+            block_dim, m, numColsB, row_mapA, entriesA, valuesA, row_mapB,
+            entriesB, valuesB, row_mapC, entriesC, valuesC);
+        return true;
+      default: return false;
+    }
+  }
+}
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // CUDA && (AMPERE || HOPPER)
+
+#endif  // KOKKOSSPARSE_BSPGEMM_TC_IMPL_HPP_
@@ -0,0 +1,464 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+*/
+
+#ifndef KOKKOSSPARSE_IMPL_CG_HPP_
+#define KOKKOSSPARSE_IMPL_CG_HPP_
+
+/// \file KokkosSparse_cg_impl.hpp
+/// \brief Implementation of the (preconditioned) conjugate gradient solver.
+
+#include <iostream>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Graph.hpp>
+#include <Kokkos_ArithTraits.hpp>
+#include <KokkosSparse_cg_handle.hpp>
+#include <KokkosBlas.hpp>
+#include <KokkosSparse_spmv.hpp>
+#include <KokkosSparse_spmv_dot.hpp>
+#include <KokkosSparse_Preconditioner.hpp>
+#include "KokkosKernels_Error.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+
+// Standard CG update, fused with the norm of the new residual:
+// x += alpha p, r -= alpha q and rr = (r, r)
+template <class XType, class RType, class PType, class QType>
+struct CGUpdateFunctor {
+  using scalar_t   = typename XType::non_const_value_type;
+  using KAT        = Kokkos::ArithTraits<scalar_t>;
+  using value_type = typename KAT::mag_type;
+
+  XType x;
+  RType r;
+  PType p;
+  QType q;
+  scalar_t alpha;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const int i, value_type &rr) const {
+    x(i) += alpha * p(i);
+    const scalar_t ri = r(i) - alpha * q(i);
+    r(i)              = ri;
+    rr += KAT::real(KAT::conj(ri) * ri);
+  }
+};
+
+// The three inner products of an iteration of the single-reduction CG, in a
+// single reduction: (r, u), (u, w) and (r, r)
+template <class RType, class UType, class WType>
+struct CGSingleReductionDotsFunctor {
+  using scalar_t   = typename WType::non_const_value_type;
+  using KAT        = Kokkos::ArithTraits<scalar_t>;
+  using value_type = scalar_t[];
+  using size_type  = int;
+
+  RType r;
+  UType u;
+  WType w;
+  const size_type value_count = 3;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const int i, value_type dots) const {
+    const scalar_t ri = r(i);
+    const scalar_t ui = u(i);
+    dots[0] += KAT::conj(ri) * ui;
+    dots[1] += KAT::conj(ui) * w(i);
+    dots[2] += KAT::conj(ri) * ri;
+  }
+
+  KOKKOS_INLINE_FUNCTION void init(value_type dots) const {
+    for (size_type k = 0; k < value_count; k++) dots[k] = KAT::zero();
+  }
+
+  KOKKOS_INLINE_FUNCTION void join(value_type dst,
+                                   const value_type src) const {
+    for (size_type k = 0; k < value_count; k++) dst[k] += src[k];
+  }
+};
+
+// Single-reduction CG update of the directions and iterates, in one pass:
+// p = u + beta p, s = w + beta s (s = A p), x += alpha p and r -= alpha s
+template <class XType, class RType, class UType, class WType, class PType,
+          class SType>
+struct CGSingleReductionUpdateFunctor {
+  using scalar_t = typename XType::non_const_value_type;
+
+  XType x;
+  RType r;
+  UType u;
+  WType w;
+  PType p;
+  SType s;
+  scalar_t alpha;
+  scalar_t beta;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const int i) const {
+    const scalar_t pi = u(i) + beta * p(i);
+    const scalar_t si = w(i) + beta * s(i);
+    p(i)              = pi;
+    s(i)              = si;
+    x(i) += alpha * pi;
+    r(i) -= alpha * si;
+  }
+};
+
+// Kernels of the graph-replayed single-reduction CG. The iteration scalars
+// live in a device view, so that no kernel of the graph needs the host
+struct CGGraphState {
+  enum : int { alpha, beta, gamma, breakdown, rr, size };
+};
+
+// The single-reduction update without a preconditioner (u = r), with alpha
+// and beta read from the device state
+template <class XType, class RType, class WType, class PType, class SType,
+          class StateType>
+struct CGGraphUpdateFunctor {
+  using scalar_t = typename XType::non_const_value_type;
+
+  XType x;
+  RType r;
+  WType w;
+  PType p;
+  SType s;
+  StateType state;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const int i) const {
+    const scalar_t alpha = state(CGGraphState::alpha);
+    const scalar_t beta  = state(CGGraphState::beta);
+    const scalar_t pi    = r(i) + beta * p(i);
+    const scalar_t si    = w(i) + beta * s(i);
+    p(i)                 = pi;
+    s(i)                 = si;
+    x(i) += alpha * pi;
+    r(i) -= alpha * si;
+  }
+};
+
+// w = A u for a CrsMatrix, one row per thread, as a graph node
+template <class AMatrix, class UType, class WType>
+struct CGGraphSpmvFunctor {
+  using scalar_t = typename WType::non_const_value_type;
+  using offset_t = typename AMatrix::non_const_size_type;
+
+  AMatrix A;
+  UType u;
+  WType w;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const int i) const {
+    scalar_t sum = Kokkos::ArithTraits<scalar_t>::zero();
+    for (offset_t k = A.graph.row_map(i); k < A.graph.row_map(i + 1); k++)
+      sum += A.values(k) * u(A.graph.entries(k));
+    w(i) = sum;
+  }
+};
+
+// The scalar recurrences of the single-reduction CG, from the inner products
+// (r, u), (u, w) and (r, r) of the iteration. On a breakdown the scalars are
+// left unchanged and the flag is raised for the host.
+template <class DotsType, class StateType>
+struct CGGraphScalarsFunctor {
+  using scalar_t = typename StateType::non_const_value_type;
+  using KAT      = Kokkos::ArithTraits<scalar_t>;
+
+  DotsType dots;
+  StateType state;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const int) const {
+    const scalar_t ru    = dots(0);
+    const scalar_t uw    = dots(1);
+    const scalar_t beta  = ru / state(CGGraphState::gamma);
+    const scalar_t denom = uw - beta * ru / state(CGGraphState::alpha);
+
+    state(CGGraphState::rr) = dots(2);
+    if (uw == KAT::zero() || ru == KAT::zero() || denom == KAT::zero()) {
+      state(CGGraphState::breakdown) = KAT::one();
+      return;
+    }
+    state(CGGraphState::alpha) = ru / denom;
+    state(CGGraphState::beta)  = beta;
+    state(CGGraphState::gamma) = ru;
+  }
+};
+
+template <class CgHandle>
+struct CgWrap {
+  //
+  // Useful types
+  //
+  using execution_space       = typename CgHandle::execution_space;
+  using scalar_t              = typename CgHandle::nnz_scalar_t;
+  using float_t               = typename CgHandle::float_t;
+  using HandleDeviceValueType = typename CgHandle::nnz_value_view_t;
+  using karith                = typename Kokkos::ArithTraits<scalar_t>;
+  using range_policy          = Kokkos::RangePolicy<execution_space>;
+  using Flag                  = typename CgHandle::Flag;
+
+  /**
+   * Unpreconditioned single-reduction CG on a CrsMatrix. The first iteration
+   * is launched kernel by kernel; the kernels of the following iterations are
+   * recorded once into a Kokkos::Experimental::Graph and the graph is
+   * replayed. The host only reads (r, r) and the breakdown flag back after
+   * each replay.
+   */
+  template <class AMatrix, class XType>
+  static void cg_graph(CgHandle &thandle, const AMatrix &A, XType &X,
+                       const HandleDeviceValueType &R,
+                       const HandleDeviceValueType &P,
+                       const HandleDeviceValueType &Q,
+                       const HandleDeviceValueType &S, const float_t nrmB,
+                       int &num_iters, float_t &res, Flag &conv_flag) {
+    using state_t   = Kokkos::View<scalar_t *,
+                                   typename HandleDeviceValueType::device_type>;
+    using dots_t    = CGSingleReductionDotsFunctor<HandleDeviceValueType,
+                                                   HandleDeviceValueType,
+                                                   HandleDeviceValueType>;
+    using update_t  = CGGraphUpdateFunctor<XType, HandleDeviceValueType,
+                                           HandleDeviceValueType,
+                                           HandleDeviceValueType,
+                                           HandleDeviceValueType, state_t>;
+    using spmv_t    = CGGraphSpmvFunctor<AMatrix, HandleDeviceValueType,
+                                         HandleDeviceValueType>;
+    using scalars_t = CGGraphScalarsFunctor<state_t, state_t>;
+
+    const scalar_t one  = karith::one();
+    const scalar_t zero = karith::zero();
+    const auto n        = X.extent(0);
+    const float_t tol   = thandle.get_tol();
+    const int max_iters = thandle.get_max_iters();
+    const bool verbose  = thandle.get_verbose();
+
+    scalar_t dots[3];
+    KokkosSparse::spmv("N", one, A, R, zero, Q);
+    Kokkos::parallel_reduce("KokkosSparse::cg::dots", range_policy(0, n),
+                            dots_t{R, R, Q}, dots);
+    if (dots[1] == zero || dots[0] == zero) {
+      conv_flag = Flag::LOA;
+      return;
+    }
+
+    state_t state("CG graph state", CGGraphState::size);
+    state_t dots_d("CG graph dots", 3);
+    auto h_state                     = Kokkos::create_mirror_view(state);
+    h_state(CGGraphState::alpha)     = dots[0] / dots[1];
+    h_state(CGGraphState::beta)      = zero;
+    h_state(CGGraphState::gamma)     = dots[0];
+    h_state(CGGraphState::breakdown) = zero;
+    h_state(CGGraphState::rr)        = dots[2];
+    Kokkos::deep_copy(state, h_state);
+
+    execution_space exec;
+    auto graph = Kokkos::Experimental::create_graph(
+        exec, [&](const auto &root) {
+          root.then_parallel_for("KokkosSparse::cg::update",
+                                 range_policy(exec, 0, n),
+                                 update_t{X, R, Q, P, S, state})
+              .then_parallel_for("KokkosSparse::cg::spmv",
+                                 range_policy(exec, 0, n), spmv_t{A, R, Q})
+              .then_parallel_reduce("KokkosSparse::cg::dots",
+                                    range_policy(exec, 0, n), dots_t{R, R, Q},
+                                    dots_d)
+              .then_parallel_for("KokkosSparse::cg::scalars",
+                                 range_policy(exec, 0, 1),
+                                 scalars_t{dots_d, state});
+        });
+
+    while (num_iters < max_iters) {
+      graph.submit();
+      Kokkos::deep_copy(h_state, state);
+      num_iters++;
+
+      res = Kokkos::sqrt(karith::real(h_state(CGGraphState::rr))) / nrmB;
+      if (verbose) {
+        std::cout << "Iteration " << num_iters << ", relative residual "
+                  << res << std::endl;
+      }
+      if (res <= tol) {
+        conv_flag = Flag::Conv;
+        break;
+      }
+      if (h_state(CGGraphState::breakdown) != zero) {
+        conv_flag = Flag::LOA;
+        break;
+      }
+    }
+  }
+
+  /**
+   * Preconditioned CG for a Hermitian positive definite A (and M). The
+   * convergence test is on the unpreconditioned relative residual.
+   */
+  template <class AMatrix, class BType, class XType>
+  static void cg(
+      CgHandle &thandle, const AMatrix &A, const BType &B, XType &X,
+      KokkosSparse::Experimental::Preconditioner<AMatrix> *precond = nullptr) {
+    const scalar_t one  = karith::one();
+    const scalar_t zero = karith::zero();
+    const auto n        = X.extent(0);
+    const float_t tol   = thandle.get_tol();
+    const int max_iters = thandle.get_max_iters();
+    const bool verbose  = thandle.get_verbose();
+    const bool single_redn =
+        thandle.get_variant() == CgHandle::Variant::SingleReduction;
+    const bool graph_replay = thandle.get_graph_replay() && single_redn &&
+                              !precond && is_crs_matrix_v<AMatrix>;
+
+    if (verbose) {
+      std::cout << "Convergence tolerance is: " << tol << std::endl;
+      std::cout << "CG variant: "
+                << (single_redn ? "SingleReduction" : "Standard")
+                << std::endl;
+      std::cout << "  precond:    " << (precond ? "ON" : "OFF") << std::endl;
+      std::cout << "  graph replay: " << (graph_replay ? "ON" : "OFF")
+                << std::endl;
+    }
+
+    const float_t nrmB = KokkosBlas::nrm2(B);
+    if (nrmB == float_t(0)) {
+      Kokkos::deep_copy(X, zero);
+      thandle.set_stats(0, 0, CgHandle::Flag::Conv);
+      return;
+    }
+
+    HandleDeviceValueType R(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "R"), n);
+    HandleDeviceValueType P("P", n);
+    HandleDeviceValueType Q("Q", n);  // A*P, or A*U (single reduction)
+    HandleDeviceValueType Z = R;      // M*R
+    if (precond) {
+      Z = HandleDeviceValueType(
+          Kokkos::view_alloc(Kokkos::WithoutInitializing, "Z"), n);
+    }
+    // Only the single-reduction variant keeps S = A*P
+    HandleDeviceValueType S("S", single_redn ? n : 0);
+
+    // r = b - A x
+    Kokkos::deep_copy(R, B);
+    KokkosSparse::spmv("N", -one, A, X, one, R);
+
+    float_t res   = KokkosBlas::nrm2(R) / nrmB;
+    int num_iters = 0;
+    auto conv_flag =
+        res <= tol ? CgHandle::Flag::Conv : CgHandle::Flag::NoConv;
+    // z = M r; without a preconditioner, Z is R
+    const auto prec = [&]() {
+      if (precond) precond->apply(R, Z);
+    };
+
+    if (graph_replay && conv_flag != CgHandle::Flag::Conv) {
+      if constexpr (is_crs_matrix_v<AMatrix>) {
+        cg_graph(thandle, A, X, R, P, Q, S, nrmB, num_iters, res, conv_flag);
+      }
+    } else if (single_redn && conv_flag != CgHandle::Flag::Conv) {
+      using dots_t   = CGSingleReductionDotsFunctor<HandleDeviceValueType,
+                                                  HandleDeviceValueType,
+                                                  HandleDeviceValueType>;
+      using update_t = CGSingleReductionUpdateFunctor<
+          XType, HandleDeviceValueType, HandleDeviceValueType,
+          HandleDeviceValueType, HandleDeviceValueType, HandleDeviceValueType>;
+
+      // Chronopoulos and Gear: the two inner products that CG needs are
+      // computed together, right after w = A u
+      scalar_t dots[3];
+      prec();
+      KokkosSparse::spmv("N", one, A, Z, zero, Q);
+      Kokkos::parallel_reduce("KokkosSparse::cg::dots", range_policy(0, n),
+                              dots_t{R, Z, Q}, dots);
+      scalar_t gamma = dots[0];
+      scalar_t alpha = gamma / dots[1];
+      update_t update{X, R, Z, Q, P, S, alpha, zero};
+      while (num_iters < max_iters) {
+        if (dots[1] == zero || gamma == zero) {
+          conv_flag = CgHandle::Flag::LOA;
+          break;
+        }
+        Kokkos::parallel_for("KokkosSparse::cg::update", range_policy(0, n),
+                             update);
+        num_iters++;
+
+        prec();
+        KokkosSparse::spmv("N", one, A, Z, zero, Q);
+        Kokkos::parallel_reduce("KokkosSparse::cg::dots", range_policy(0, n),
+                                dots_t{R, Z, Q}, dots);
+        res = Kokkos::sqrt(karith::real(dots[2])) / nrmB;
+        if (verbose) {
+          std::cout << "Iteration " << num_iters << ", relative residual "
+                    << res << std::endl;
+        }
+        if (res <= tol) {
+          conv_flag = CgHandle::Flag::Conv;
+          break;
+        }
+        const scalar_t beta  = dots[0] / gamma;
+        const scalar_t denom = dots[1] - beta * dots[0] / update.alpha;
+        if (denom == zero) {
+          conv_flag = CgHandle::Flag::LOA;
+          break;
+        }
+        update.beta  = beta;
+        update.alpha = dots[0] / denom;
+        gamma        = dots[0];
+      }
+    } else if (conv_flag != CgHandle::Flag::Conv) {
+      using update_t =
+          CGUpdateFunctor<XType, HandleDeviceValueType, HandleDeviceValueType,
+                          HandleDeviceValueType>;
+
+      prec();
+      Kokkos::deep_copy(P, Z);
+      scalar_t gamma = KokkosBlas::dot(R, Z);
+      while (num_iters < max_iters) {
+        // q = A p, fused with (p, A p)
+        const scalar_t pq =
+            karith::conj(KokkosSparse::spmv_dot(one, A, P, zero, Q, P));
+        if (pq == zero || gamma == zero) {
+          conv_flag = CgHandle::Flag::LOA;
+          break;
+        }
+        float_t rr = 0;
+        Kokkos::parallel_reduce("KokkosSparse::cg::update", range_policy(0, n),
+                                update_t{X, R, P, Q, gamma / pq}, rr);
+        num_iters++;
+
+        res = Kokkos::sqrt(rr) / nrmB;
+        if (verbose) {
+          std::cout << "Iteration " << num_iters << ", relative residual "
+                    << res << std::endl;
+        }
+        if (res <= tol) {
+          conv_flag = CgHandle::Flag::Conv;
+          break;
+        }
+        prec();
+        const scalar_t gamma_new =
+            precond ? KokkosBlas::dot(R, Z) : scalar_t(rr);
+        KokkosBlas::axpby(one, Z, gamma_new / gamma, P);  // p = z + beta p
+        gamma = gamma_new;
+      }
+    }
+
+    if (verbose) {
+      std::cout << "Ending relative residual is: " << res << std::endl;
+      std::cout << "Number of iterations is: " << num_iters << std::endl;
+    }
+    thandle.set_stats(num_iters, res, conv_flag);
+  }  // cg
+};
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_IMPL_CG_HPP_
@@ -0,0 +1,87 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_CHEBYSHEV_IMPL_HPP_
+#define KOKKOSSPARSE_CHEBYSHEV_IMPL_HPP_
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ArithTraits.hpp>
+
+namespace KokkosSparse {
+namespace Impl {
+
+// Inverse of the diagonal of A, one thread per row. Rows without a (nonzero)
+// diagonal get one, so that they are left unscaled.
+template <class RowMapType, class EntriesType, class ValuesType,
+          class DiagType>
+struct ChebyshevInvDiagFunctor {
+  using lno_t    = typename EntriesType::non_const_value_type;
+  using scalar_t = typename DiagType::non_const_value_type;
+  using KAT      = Kokkos::ArithTraits<scalar_t>;
+
+  RowMapType row_map;
+  EntriesType entries;
+  ValuesType values;
+  DiagType inv_diag;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const lno_t i) const {
+    scalar_t d = KAT::zero();
+    for (auto k = row_map(i); k < row_map(i + 1); k++) {
+      if (entries(k) == i) d += values(k);
+    }
+    inv_diag(i) = d == KAT::zero() ? KAT::one() : KAT::one() / d;
+  }
+};
+
+// One step of the Chebyshev iteration for A x = b, one thread per row:
+// r = b - A x_old, d = c_d d + c_r D^{-1} r and x_new = x_old + d. With
+// first, x_old is taken as zero, so the SpMV is skipped.
+template <class RowMapType, class EntriesType, class ValuesType, class DiagType,
+          class BType, class XOldType, class XNewType, class DType>
+struct ChebyshevStepFunctor {
+  using lno_t    = typename EntriesType::non_const_value_type;
+  using scalar_t = typename XNewType::non_const_value_type;
+
+  RowMapType row_map;
+  EntriesType entries;
+  ValuesType values;
+  DiagType inv_diag;
+  BType b;
+  XOldType x_old;
+  XNewType x_new;
+  DType d;
+  scalar_t c_d;
+  scalar_t c_r;
+  bool first;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const lno_t i) const {
+    scalar_t r = b(i);
+    if (!first) {
+      for (auto k = row_map(i); k < row_map(i + 1); k++) {
+        r -= values(k) * x_old(entries(k));
+      }
+    }
+    const scalar_t di = first ? c_r * inv_diag(i) * r
+                              : c_d * d(i) + c_r * inv_diag(i) * r;
+    d(i)     = di;
+    x_new(i) = first ? di : x_old(i) + di;
+  }
+};
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_CHEBYSHEV_IMPL_HPP_
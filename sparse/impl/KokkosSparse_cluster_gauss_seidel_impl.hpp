@@ -18,6 +18,8 @@
 #define _KOKKOSCGSIMP_HPP
 
 #include "KokkosKernels_Utils.hpp"
+#include <sstream>
+#include <stdexcept>
 #include <Kokkos_Core.hpp>
 #include <Kokkos_Bitset.hpp>
 #include <Kokkos_Sort.hpp>
@@ -27,6 +29,7 @@
 #include "KokkosSparse_partitioning_impl.hpp"
 #include "KokkosGraph_MIS2.hpp"
 #include "KokkosGraph_ExplicitCoarsening.hpp"
+#include "KokkosGraph_CoarsenConstruct.hpp"
 
 namespace KokkosSparse {
 namespace Impl {
@@ -508,6 +511,147 @@ class ClusterGaussSeidel {
     nnz_lno_t clusterSize;
   };
 
+  // Count the off-diagonal entries in each row of the graph
+  template <typename InRowmap, typename InEntries, typename OutRowmap>
+  struct CountOffDiagonalFunctor {
+    CountOffDiagonalFunctor(const InRowmap& xadj_, const InEntries& adj_,
+                            const OutRowmap& counts_)
+        : xadj(xadj_), adj(adj_), counts(counts_) {}
+    KOKKOS_INLINE_FUNCTION void operator()(const nnz_lno_t i) const {
+      size_type count = 0;
+      for (size_type j = xadj(i); j < xadj(i + 1); j++) {
+        if (adj(j) != i) count++;
+      }
+      counts(i) = count;
+    }
+    InRowmap xadj;
+    InEntries adj;
+    OutRowmap counts;
+  };
+
+  // Copy the off-diagonal entries of the graph, with unit edge weights
+  template <typename InRowmap, typename InEntries, typename OutRowmap,
+            typename OutEntries, typename OutValues>
+  struct FillOffDiagonalFunctor {
+    FillOffDiagonalFunctor(const InRowmap& xadj_, const InEntries& adj_,
+                           const OutRowmap& rowmap_, const OutEntries& entries_,
+                           const OutValues& values_)
+        : xadj(xadj_),
+          adj(adj_),
+          rowmap(rowmap_),
+          entries(entries_),
+          values(values_) {}
+    KOKKOS_INLINE_FUNCTION void operator()(const nnz_lno_t i) const {
+      size_type k = rowmap(i);
+      for (size_type j = xadj(i); j < xadj(i + 1); j++) {
+        if (adj(j) != i) {
+          entries(k) = adj(j);
+          values(k)  = 1;
+          k++;
+        }
+      }
+    }
+    InRowmap xadj;
+    InEntries adj;
+    OutRowmap rowmap;
+    OutEntries entries;
+    OutValues values;
+  };
+
+  // Map the cluster of each vertex through one more level of coarsening
+  template <typename View, typename MapView>
+  struct CoarsenClustersFunctor {
+    CoarsenClustersFunctor(const View& vertClusters_, const MapView& vcmap_)
+        : vertClusters(vertClusters_), vcmap(vcmap_) {}
+    KOKKOS_INLINE_FUNCTION void operator()(const nnz_lno_t i) const {
+      vertClusters(i) = vcmap(vertClusters(i));
+    }
+    View vertClusters;
+    MapView vcmap;
+  };
+
+#if !defined(KOKKOS_ENABLE_CUDA) || defined(KOKKOS_ENABLE_CUDA_LAMBDA)
+  // Cluster the vertices by multilevel coarsening of the (symmetric) graph
+  // with the heavy edge coarsening or the matching heuristic, stopping at
+  // the first level with at most numClusters vertices, which is then set to
+  // the actual number of clusters. Only the graph is known here, so all the
+  // edges of the finest level have unit weight, and an edge of a coarse level
+  // weighs the number of fine edges between its two clusters: the clusters
+  // grow along the most strongly connected parts of the graph.
+  template <typename raw_rowmap_t, typename raw_colinds_t,
+            typename nnz_view_t>
+  nnz_view_t coarsening_clusters(raw_rowmap_t xadj, raw_colinds_t adj,
+                                 bool matching, nnz_lno_t& numClusters) {
+    using device_t = Kokkos::Device<MyExecSpace, MyTempMemorySpace>;
+    using graph_mat_t =
+        KokkosSparse::CrsMatrix<double, nnz_lno_t, device_t, void, size_type>;
+    using out_rowmap_t  = typename graph_mat_t::row_map_type::non_const_type;
+    using out_entries_t = typename graph_mat_t::index_type::non_const_type;
+    using out_values_t  = typename graph_mat_t::values_type::non_const_type;
+    using coarsener_t =
+        KokkosGraph::Experimental::coarse_builder<graph_mat_t>;
+    using level_t        = typename coarsener_t::coarse_level_triple;
+    using vtx_view_t     = typename coarsener_t::vtx_view_t;
+    using range_policy_t = Kokkos::RangePolicy<MyExecSpace>;
+
+    // the coarsening heuristics expect a graph without self loops
+    out_rowmap_t rowmap("coarsening rowmap", num_rows + 1);
+    Kokkos::parallel_for(
+        "KokkosSparse::ClusterGaussSeidel::CountOffDiagonal",
+        range_policy_t(0, num_rows),
+        CountOffDiagonalFunctor<raw_rowmap_t, raw_colinds_t, out_rowmap_t>(
+            xadj, adj, rowmap));
+    size_type nnz = 0;
+    KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum<MyExecSpace>(
+        num_rows + 1, rowmap, nnz);
+    out_entries_t entries("coarsening entries", nnz);
+    out_values_t values("coarsening weights", nnz);
+    Kokkos::parallel_for(
+        "KokkosSparse::ClusterGaussSeidel::FillOffDiagonal",
+        range_policy_t(0, num_rows),
+        FillOffDiagonalFunctor<raw_rowmap_t, raw_colinds_t, out_rowmap_t,
+                               out_entries_t, out_values_t>(
+            xadj, adj, rowmap, entries, values));
+
+    // start with every vertex in its own cluster
+    nnz_view_t vertClusters(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "vertClusters"),
+        num_rows);
+    Kokkos::parallel_for("KokkosSparse::ClusterGaussSeidel::SingleClusters",
+                         range_policy_t(0, num_rows),
+                         NopVertClusteringFunctor<nnz_view_t>(vertClusters, 1));
+
+    typename coarsener_t::coarsen_handle handle;
+    handle.h = matching ? coarsener_t::Match : coarsener_t::HECv1;
+    level_t level;
+    level.mtx = graph_mat_t("coarsening graph", num_rows, num_rows, nnz, values,
+                            rowmap, entries);
+
+    level.vtx_wgts = vtx_view_t("vertex weights", num_rows);
+    Kokkos::deep_copy(level.vtx_wgts, static_cast<nnz_lno_t>(1));
+    level.level           = 1;
+    level.uniform_weights = true;
+
+    nnz_lno_t n = num_rows;
+    for (unsigned l = 0; n > numClusters && l < handle.max_levels; l++) {
+      graph_mat_t vcmap = coarsener_t::generate_coarse_mapping(
+          handle, level.mtx, level.uniform_weights);
+      // stop once the heuristic can't shrink the graph anymore
+      if (vcmap.numCols() >= n) break;
+      Kokkos::parallel_for(
+          "KokkosSparse::ClusterGaussSeidel::CoarsenClusters",
+          range_policy_t(0, num_rows),
+          CoarsenClustersFunctor<nnz_view_t, out_entries_t>(
+              vertClusters, vcmap.graph.entries));
+      n = vcmap.numCols();
+      if (n > numClusters)
+        level = coarsener_t::build_coarse_graph(handle, level, vcmap);
+    }
+    numClusters = n;
+    return vertClusters;
+  }
+#endif
+
   void initialize_symbolic() {
     using nnz_view_t    = nnz_lno_persistent_work_view_t;
     using in_rowmap_t   = const_lno_row_view_t;
@@ -570,6 +714,19 @@ class ClusterGaussSeidel {
         vertClusters = balloon.run(clusterSize);
         break;
       }
+      case CLUSTER_HEC:
+      case CLUSTER_MATCH: {
+#if !defined(KOKKOS_ENABLE_CUDA) || defined(KOKKOS_ENABLE_CUDA_LAMBDA)
+        vertClusters =
+            coarsening_clusters<raw_rowmap_t, raw_colinds_t, nnz_view_t>(
+                raw_sym_xadj, raw_sym_adj, clusterAlgo == CLUSTER_MATCH,
+                numClusters);
+#else
+        throw std::runtime_error(
+            "Clustering by graph coarsening requires Cuda lambda support");
+#endif
+        break;
+      }
       case CLUSTER_DEFAULT: {
         throw std::logic_error(
             "Logic to choose default clustering algorithm is incorrect");
@@ -630,17 +787,30 @@ class ClusterGaussSeidel {
     }
     Kokkos::deep_copy(colors, h_colors);
 #else
-    // Create a handle that uses nnz_lno_t as the size_type, since the cluster
-    // graph should never be larger than 2^31 entries.
-    HandleType kh;
-    kh.create_graph_coloring_handle(gsHandle->get_coloring_algorithm());
-    KokkosGraph::Experimental::graph_color_symbolic(
-        &kh, numClusters, numClusters, clusterRowmap, clusterEntries);
-    // retrieve colors
-    auto coloringHandle = kh.get_graph_coloring_handle();
-    colors              = coloringHandle->get_vertex_colors();
-    numColors           = coloringHandle->get_num_colors();
-    kh.destroy_graph_coloring_handle();
+    if (gsHandle->has_given_vertex_colors()) {
+      colors    = gsHandle->get_vertex_colors();
+      numColors = gsHandle->get_num_colors();
+      if (colors.extent(0) != size_t(numClusters)) {
+        std::ostringstream os;
+        os << "ClusterGaussSeidel: the given colors are for "
+           << colors.extent(0) << " clusters, but there are " << numClusters
+           << " clusters.";
+        throw std::invalid_argument(os.str());
+      }
+    } else {
+      // Create a handle that uses nnz_lno_t as the size_type, since the
+      // cluster graph should never be larger than 2^31 entries.
+      HandleType kh;
+      kh.create_graph_coloring_handle(gsHandle->get_coloring_algorithm());
+      KokkosGraph::Experimental::graph_color_symbolic(
+          &kh, numClusters, numClusters, clusterRowmap, clusterEntries);
+      // retrieve colors
+      auto coloringHandle = kh.get_graph_coloring_handle();
+      colors              = coloringHandle->get_vertex_colors();
+      numColors           = coloringHandle->get_num_colors();
+      kh.destroy_graph_coloring_handle();
+      gsHandle->set_computed_vertex_colors(colors);
+    }
 #endif
 #ifdef KOKKOSSPARSE_IMPL_TIME_REVERSE
     MyExecSpace().fence();
@@ -17,6 +17,7 @@
 #define KOKKOSSPARSE_CRS_DETECT_BLOCK_SIZE_HPP
 
 #include <map>
+#include <vector>
 
 #include <Kokkos_Core.hpp>
 #include "KokkosSparse_CrsMatrix.hpp"
@@ -153,6 +154,71 @@ size_t detect_block_size(const Crs &crs) {
   return largestBlockSize;
 }
 
+/**
+ * @brief Picks the block size with which a CrsMatrix is cheapest to store and
+ apply as a BsrMatrix, allowing blocks that are only partially populated
+ *
+ * @tparam Crs The type of the CRS matrix.
+ * @param crs The CRS matrix.
+ * @param maxBlockSize The largest block size tried.
+ * @param maxRatio A block size is only returned if the BsrMatrix would move at
+    most this fraction of the bytes of the CrsMatrix.
+ * @return The profitable block size, or 1 if none is
+    Unlike detect_block_size, the blocks may be partially populated: the
+ missing entries are stored as explicit zeros. SpMV is limited by the memory
+ traffic of the matrix, so a trial size is rated by the bytes of values and
+ indices that each format reads: nnz * (sizeof(scalar) + sizeof(ordinal)) for
+ CRS, and nblocks * (bs * bs * sizeof(scalar) + sizeof(ordinal)) for BSR. The
+ matrix dimensions must divide evenly into a trial block size.
+*/
+template <typename Crs>
+size_t detect_profitable_block_size(const Crs &crs, size_t maxBlockSize = 8,
+                                    double maxRatio = 0.9) {
+  using ordinal_type = typename Crs::ordinal_type;
+  using size_type    = typename Crs::size_type;
+  const size_t scalarBytes  = sizeof(typename Crs::value_type);
+  const size_t ordinalBytes = sizeof(ordinal_type);
+  const size_t offsetBytes  = sizeof(size_type);
+
+  const size_t nrows = crs.numRows();
+  const size_t ncols = crs.numCols();
+  if (crs.nnz() == 0) return 1;
+
+  auto rs = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                crs.graph.row_map);
+  auto cs = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                crs.graph.entries);
+
+  const double crsBytes = double(crs.nnz()) * (scalarBytes + ordinalBytes) +
+                          double(nrows + 1) * offsetBytes;
+  double bestBytes = maxRatio * crsBytes;
+  size_t bestSize  = 1;
+  for (size_t bs = 2; bs <= maxBlockSize; ++bs) {
+    if (nrows % bs || ncols % bs) continue;
+    // Count the distinct blocks of each block row: lastSeen(bc) is the last
+    // block row in which block column bc was found
+    std::vector<size_t> lastSeen(ncols / bs, nrows);
+    size_t nblocks = 0;
+    for (size_t br = 0; br < nrows / bs; ++br) {
+      for (size_t ci = rs(br * bs); ci < rs((br + 1) * bs); ++ci) {
+        size_t bc = size_t(cs(ci)) / bs;
+        if (lastSeen[bc] != br) {
+          lastSeen[bc] = br;
+          ++nblocks;
+        }
+      }
+    }
+    const double bsrBytes =
+        double(nblocks) * (bs * bs * scalarBytes + ordinalBytes) +
+        double(nrows / bs + 1) * offsetBytes;
+    if (bsrBytes < bestBytes) {
+      bestBytes = bsrBytes;
+      bestSize  = bs;
+    }
+  }
+  return bestSize;
+}
+
 }  // namespace KokkosSparse::Impl
 
 #endif  // KOKKOSSPARSE_CRS_DETECT_BLOCK_SIZE_HPP
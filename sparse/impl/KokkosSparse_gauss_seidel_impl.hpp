@@ -19,6 +19,8 @@
 
 #include "KokkosKernels_Utils.hpp"
 #include "KokkosSparse_Utils.hpp"
+#include <sstream>
+#include <stdexcept>
 #include <Kokkos_Core.hpp>
 #include <Kokkos_Bitset.hpp>
 #include "KokkosGraph_Distance1Color.hpp"
@@ -26,6 +28,10 @@
 #include "KokkosKernels_BitUtils.hpp"
 #include "KokkosKernels_SimpleUtils.hpp"
 #include "KokkosSparse_SortCrs.hpp"
+#include "KokkosBatched_SetIdentity_Decl.hpp"
+#include "KokkosBatched_SetIdentity_Impl.hpp"
+#include "KokkosBatched_LU_Decl.hpp"
+#include "KokkosBatched_SolveLU_Decl.hpp"
 
 // FOR DEBUGGING
 #include "KokkosBlas1_nrm2.hpp"
@@ -843,7 +849,16 @@ class PointGaussSeidel {
     // TODO: Pass my_exec_space into KokkosGraph kernels
     typename HandleType::GraphColoringHandleType::color_view_t colors;
     color_t numColors;
-    {
+    if (gsHandle->has_given_vertex_colors()) {
+      colors    = gsHandle->get_vertex_colors();
+      numColors = gsHandle->get_num_colors();
+      if (colors.extent(0) != size_t(num_rows)) {
+        std::ostringstream os;
+        os << "PointGaussSeidel: the given colors are for " << colors.extent(0)
+           << " rows, but the matrix has " << num_rows << " rows.";
+        throw std::invalid_argument(os.str());
+      }
+    } else {
       HandleType coloringHandle;
       coloringHandle.create_graph_coloring_handle(
           gsHandle->get_coloring_algorithm());
@@ -873,6 +888,7 @@ class PointGaussSeidel {
       }
       colors    = gchandle->get_vertex_colors();
       numColors = gchandle->get_num_colors();
+      gsHandle->set_computed_vertex_colors(colors);
     }
     // Wait for coloring to finish on its stream
     using ColoringExecSpace = typename HandleType::HandleExecSpace;
@@ -923,14 +939,14 @@ class PointGaussSeidel {
     if (longRowThreshold > 0) {
       // Count long rows per color set, and sort color sets so that long rows
       // come after regular rows
-      nnz_lno_persistent_work_view_t long_rows_per_color(
-          Kokkos::view_alloc(my_exec_space, Kokkos::WithoutInitializing,
-                             "long_rows_per_color"),
-          numColors);
-      nnz_lno_persistent_work_view_t max_row_length_per_color(
-          Kokkos::view_alloc(my_exec_space, Kokkos::WithoutInitializing,
-                             "max_row_length_per_color"),
-          numColors);
+      typename HandleType::GaussSeidelHandleType::workspace_t::Scope work(
+          gsHandle->get_workspace());
+      auto long_rows_per_color =
+          work.template view<nnz_lno_persistent_work_view_t>(
+              "long_rows_per_color", false, numColors);
+      auto max_row_length_per_color =
+          work.template view<nnz_lno_persistent_work_view_t>(
+              "max_row_length_per_color", false, numColors);
       nnz_lno_t mostLongRowsInColor = 0;
       SortIntoLongRowsFunctor sortIntoLongRowsFunctor(
           xadj, longRowThreshold, color_xadj, color_adj, long_rows_per_color,
@@ -944,14 +960,15 @@ class PointGaussSeidel {
       Kokkos::parallel_reduce(
           team_policy_t(my_exec_space, numColors, sortLongRowsTeamSize),
           sortIntoLongRowsFunctor, Kokkos::Max<nnz_lno_t>(mostLongRowsInColor));
+      // The handle keeps the host copies, which must not alias the workspace
       auto host_long_rows_per_color =
-          Kokkos::create_mirror_view(long_rows_per_color);
+          Kokkos::create_mirror(long_rows_per_color);
       Kokkos::deep_copy(my_exec_space, host_long_rows_per_color,
                         long_rows_per_color);
       my_exec_space.fence();
       gsHandle->set_long_rows_per_color(host_long_rows_per_color);
       auto host_max_row_length_per_color =
-          Kokkos::create_mirror_view(max_row_length_per_color);
+          Kokkos::create_mirror(max_row_length_per_color);
       Kokkos::deep_copy(my_exec_space, host_max_row_length_per_color,
                         max_row_length_per_color);
       my_exec_space.fence();
@@ -1344,6 +1361,90 @@ class PointGaussSeidel {
     }
   };
 
+  // Inverts the dense diagonal block of each block row by LU without
+  // pivoting; the factors are formed in the block of the row in _work
+  struct Get_Matrix_Block_Inverse_Diagonals {
+    using block_t =
+        Kokkos::View<nnz_scalar_t**, Kokkos::LayoutRight,
+                     typename scalar_persistent_work_view_t::device_type,
+                     Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+    row_lno_persistent_work_view_t _xadj;
+    nnz_lno_persistent_work_view_t _adj;
+    scalar_persistent_work_view_t _adj_vals;
+    scalar_persistent_work_view_t _inverse_blocks;
+    scalar_persistent_work_view_t _work;
+    nnz_lno_t block_size;
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const nnz_lno_t& row_id) const {
+      const size_type offset = size_type(row_id) * block_size * block_size;
+      block_t D(_work.data() + offset, block_size, block_size);
+      block_t Dinv(_inverse_blocks.data() + offset, block_size, block_size);
+      for (nnz_lno_t r = 0; r < block_size; ++r)
+        for (nnz_lno_t c = 0; c < block_size; ++c)
+          D(r, c) = Kokkos::ArithTraits<nnz_scalar_t>::zero();
+
+      RowIndex row(block_size, _xadj[row_id], _xadj[row_id + 1]);
+      for (nnz_lno_t col_ind = 0; col_ind < row.size(); ++col_ind) {
+        if (_adj[row.begin() + col_ind] != row_id) continue;
+        for (nnz_lno_t r = 0; r < block_size; ++r)
+          for (nnz_lno_t c = 0; c < block_size; ++c)
+            D(r, c) += _adj_vals[row.value(col_ind, r, c)];
+      }
+
+      KokkosBatched::SerialSetIdentity::invoke(Dinv);
+      KokkosBatched::SerialLU<KokkosBatched::Algo::LU::Unblocked>::invoke(D);
+      KokkosBatched::SerialSolveLU<
+          KokkosBatched::Trans::NoTranspose,
+          KokkosBatched::Algo::SolveLU::Unblocked>::invoke(D, Dinv);
+    }
+  };
+
+  // Block Gauss-Seidel update of the block rows of a color, one thread per
+  // block row: x_i += omega * D_i^{-1} (y_i - sum_j A_ij x_j), where D_i is
+  // the diagonal block. _residual holds y_i - sum_j A_ij x_j of the row.
+  struct BlockInverse_PSGS {
+    row_lno_persistent_work_view_t _xadj;
+    nnz_lno_persistent_work_view_t _adj;
+    scalar_persistent_work_view_t _adj_vals;
+
+    scalar_persistent_work_view2d_t _Xvector;
+    scalar_persistent_work_view2d_t _Yvector;
+
+    scalar_persistent_work_view_t _inverse_blocks;
+    scalar_persistent_work_view_t _residual;
+
+    nnz_scalar_t omega;
+    nnz_lno_t block_size;
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const nnz_lno_t& ii) const {
+      const nnz_lno_t bs     = block_size;
+      const size_type offset = size_type(ii) * bs * bs;
+      RowIndex row(bs, _xadj(ii), _xadj(ii + 1));
+      for (nnz_lno_t vec = 0; vec < (nnz_lno_t)_Xvector.extent(1); vec++) {
+        for (nnz_lno_t p = 0; p < bs; ++p) {
+          nnz_scalar_t sum = _Yvector(ii * bs + p, vec);
+          for (nnz_lno_t k = 0; k < row.size(); ++k) {
+            const nnz_lno_t col = _adj(row.begin() + k);
+            for (nnz_lno_t q = 0; q < bs; ++q)
+              sum -=
+                  _adj_vals(row.value(k, p, q)) * _Xvector(col * bs + q, vec);
+          }
+          _residual(ii * bs + p) = sum;
+        }
+        for (nnz_lno_t p = 0; p < bs; ++p) {
+          nnz_scalar_t update = Kokkos::ArithTraits<nnz_scalar_t>::zero();
+          for (nnz_lno_t q = 0; q < bs; ++q)
+            update += _inverse_blocks(offset + p * bs + q) *
+                      _residual(ii * bs + q);
+          _Xvector(ii * bs + p, vec) += omega * update;
+        }
+      }
+    }
+  };
+
   void initialize_numeric() {
     auto gsHandle = this->get_gs_handle();
     if (gsHandle->is_symbolic_called() == false) {
@@ -1471,6 +1572,29 @@ class PointGaussSeidel {
               permuted_inverse_diagonal);
       }
       gsHandle->set_permuted_inverse_diagonal(permuted_inverse_diagonal);
+
+      if (block_size > 1 && gsHandle->get_block_inverse_diagonal()) {
+        if (have_diagonal_given)
+          throw std::runtime_error(
+              "PointGaussSeidel: a given inverse diagonal can't be used with "
+              "the inverses of the diagonal blocks.");
+        scalar_persistent_work_view_t permuted_inverse_block_diagonal(
+            Kokkos::view_alloc(my_exec_space, Kokkos::WithoutInitializing,
+                               "permuted_inverse_block_diagonal"),
+            num_rows * block_matrix_size);
+        scalar_persistent_work_view_t block_lu(
+            Kokkos::view_alloc(my_exec_space, Kokkos::WithoutInitializing,
+                               "block_lu"),
+            num_rows * block_matrix_size);
+        Kokkos::parallel_for(
+            "KokkosSparse::GaussSeidel::get_matrix_block_inverse_diagonals",
+            range_policy_t(my_exec_space, 0, num_rows),
+            Get_Matrix_Block_Inverse_Diagonals{
+                newxadj_, newadj_, permuted_adj_vals,
+                permuted_inverse_block_diagonal, block_lu, block_size});
+        gsHandle->set_permuted_inverse_block_diagonal(
+            permuted_inverse_block_diagonal);
+      }
       gsHandle->set_call_numeric(true);
     }
 #ifdef KOKKOSSPARSE_IMPL_TIME_REVERSE
@@ -1608,14 +1732,32 @@ class PointGaussSeidel {
               << " num_chunks:" << num_chunks << std::endl;
 #endif
 
-    Team_PSGS gs(newxadj, newadj, newadj_vals, Permuted_Xvector,
-                 Permuted_Yvector, 0, 0, permuted_inverse_diagonal, m_space,
-                 num_values_in_l1, num_values_in_l2, omega, block_size,
-                 team_row_chunk_size, l1_shmem_size, suggested_team_size,
-                 suggested_vector_size);
+    if (gsHandle->get_block_inverse_diagonal()) {
+      typename HandleType::GaussSeidelHandleType::workspace_t::Scope work(
+          gsHandle->get_workspace());
+      auto residual = work.template view<scalar_persistent_work_view_t>(
+          "block_residual", false, num_rows * block_size);
+      BlockInverse_PSGS gs{newxadj,
+                           newadj,
+                           newadj_vals,
+                           Permuted_Xvector,
+                           Permuted_Yvector,
+                           gsHandle->get_permuted_inverse_block_diagonal(),
+                           residual,
+                           omega,
+                           block_size};
+      this->IterativeBlockInversePSGS(gs, numColors, h_color_xadj, numIter,
+                                      apply_forward, apply_backward);
+    } else {
+      Team_PSGS gs(newxadj, newadj, newadj_vals, Permuted_Xvector,
+                   Permuted_Yvector, 0, 0, permuted_inverse_diagonal, m_space,
+                   num_values_in_l1, num_values_in_l2, omega, block_size,
+                   team_row_chunk_size, l1_shmem_size, suggested_team_size,
+                   suggested_vector_size);
 
-    this->IterativePSGS(gs, numColors, h_color_xadj, numIter, apply_forward,
-                        apply_backward);
+      this->IterativePSGS(gs, numColors, h_color_xadj, numIter, apply_forward,
+                          apply_backward);
+    }
 
     KokkosKernels::Impl::permute_block_vector<
         scalar_persistent_work_view2d_t, x_value_array_type,
@@ -1968,6 +2110,33 @@ class PointGaussSeidel {
       }
     }
   }
+
+  void IterativeBlockInversePSGS(
+      BlockInverse_PSGS& gs, color_t numColors,
+      nnz_lno_persistent_work_host_view_t h_color_xadj, int num_iteration,
+      bool apply_forward, bool apply_backward) {
+    MyExecSpace my_exec_space = this->get_gs_handle()->get_execution_space();
+    for (int iter = 0; iter < num_iteration; ++iter) {
+      for (int doingBackward = 0; doingBackward < 2; doingBackward++) {
+        if (!doingBackward && !apply_forward) continue;
+        if (doingBackward && !apply_backward) continue;
+        const char* label =
+            doingBackward
+                ? "KokkosSparse::GaussSeidel::BlockInverse_PSGS::backward"
+                : "KokkosSparse::GaussSeidel::BlockInverse_PSGS::forward";
+        for (color_t colorIter = 0; colorIter < numColors; ++colorIter) {
+          color_t i = doingBackward ? (numColors - colorIter - 1) : colorIter;
+          Kokkos::parallel_for(
+              label,
+              Kokkos::Experimental::require(
+                  range_policy_t(my_exec_space, h_color_xadj(i),
+                                 h_color_xadj(i + 1)),
+                  Kokkos::Experimental::WorkItemProperty::HintLightWeight),
+              gs);
+        }
+      }
+    }
+  }
 };
 }  // namespace Impl
 }  // namespace KokkosSparse
@@ -0,0 +1,381 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+*/
+
+#ifndef KOKKOSSPARSE_IMPL_GMRES_ASYNC_HPP_
+#define KOKKOSSPARSE_IMPL_GMRES_ASYNC_HPP_
+
+/// \file KokkosSparse_gmres_async_impl.hpp
+/// \brief Implementation of GMRES on an execution space instance, with the
+///        Hessenberg matrix and the Givens rotations kept on the device.
+
+#include <iostream>
+#include <stdexcept>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ArithTraits.hpp>
+#include <KokkosSparse_gmres_handle.hpp>
+#include <KokkosBlas.hpp>
+#include <KokkosSparse_spmv.hpp>
+#include <KokkosSparse_Preconditioner.hpp>
+#include "KokkosKernels_Error.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+namespace Experimental {
+
+// Arnoldi step j on the device, by a single thread: H(j+1, j) = nrm, the
+// previous Givens rotations are applied to H(:, j) and the new one updates
+// G. state holds H(j+1, j), |G(j+1)| and the column of a (lucky) breakdown,
+// or -1; after a breakdown, the following steps leave everything unchanged.
+template <class HType, class VecType, class StateType, class NrmType>
+struct GmresAsyncGivensFunctor {
+  using scalar_t = typename HType::non_const_value_type;
+  using KAT      = Kokkos::ArithTraits<scalar_t>;
+  using MT       = typename KAT::mag_type;
+
+  HType H;
+  VecType cs;
+  VecType sn;
+  VecType g;
+  StateType state;
+  NrmType nrm;
+  int j;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const int) const {
+    if (state(2) >= MT(0)) return;
+    const scalar_t one = KAT::one();
+    const MT h         = nrm();
+    state(0)           = h;
+    H(j + 1, j)        = h;
+
+    // Givens for real and complex (See Alg 3 in "On computing Givens
+    // rotations reliably and efficiently" by Demmel, et. al. 2001)
+    for (int i = 0; i < j; i++) {
+      const scalar_t tmp = cs(i) * H(i, j) + sn(i) * H(i + 1, j);
+      H(i + 1, j)        = -KAT::conj(sn(i)) * H(i, j) + cs(i) * H(i + 1, j);
+      H(i, j)            = tmp;
+    }
+    const scalar_t f = H(j, j);
+    const scalar_t v = H(j + 1, j);
+    const MT f2 = KAT::real(f) * KAT::real(f) + KAT::imag(f) * KAT::imag(f);
+    const MT v2 = KAT::real(v) * KAT::real(v) + KAT::imag(v) * KAT::imag(v);
+    scalar_t fv2      = f2 + v2;
+    const scalar_t D1 = one / KAT::sqrt(f2 * fv2);
+    cs(j)             = f2 * D1;
+    fv2               = fv2 * D1;
+    H(j, j)           = f * fv2;
+    sn(j)             = f * D1 * KAT::conj(v);
+    H(j + 1, j)       = KAT::zero();
+
+    g(j + 1) = g(j) * (-KAT::conj(sn(j)));
+    g(j)     = g(j) * cs(j);
+    state(1) = KAT::abs(g(j + 1));
+    if (h <= MT(1e-14)) state(2) = j;
+  }
+};
+
+// V(:, j+1) = W / H(j+1, j), with H(j+1, j) read from state on the device;
+// zero after a breakdown
+template <class VType, class WType, class StateType>
+struct GmresAsyncScaleFunctor {
+  using scalar_t = typename VType::non_const_value_type;
+  using MT       = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+
+  VType v;
+  WType w;
+  StateType state;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const int i) const {
+    v(i) = state(2) < MT(0) ? w(i) / state(0) : scalar_t(0);
+  }
+};
+
+// Least squares solution of the rotated Hessenberg system, by a single
+// thread: y(0:k) = H(0:k, 0:k)^-1 g(0:k), with k = j, or the column of the
+// breakdown; y(k+1:j) = 0
+template <class HType, class VecType, class StateType>
+struct GmresAsyncLsSolveFunctor {
+  using scalar_t = typename HType::non_const_value_type;
+  using MT       = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+
+  HType H;
+  VecType g;
+  VecType y;
+  StateType state;
+  int j;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const int) const {
+    const int k = state(2) >= MT(0) ? static_cast<int>(state(2)) : j;
+    for (int r = k; r >= 0; r--) {
+      scalar_t x = g(r);
+      for (int c = r + 1; c <= k; c++) x -= H(r, c) * y(c);
+      y(r) = x / H(r, r);
+    }
+    for (int r = k + 1; r <= j; r++) y(r) = scalar_t(0);
+  }
+};
+
+template <class GmresHandle>
+struct GmresAsyncWrap {
+  //
+  // Useful types
+  //
+  using scalar_t                = typename GmresHandle::nnz_scalar_t;
+  using size_type               = typename GmresHandle::size_type;
+  using HandleDeviceValueType   = typename GmresHandle::nnz_value_view_t;
+  using HandleDevice2dValueType = typename GmresHandle::nnz_value_view2d_t;
+  using karith                  = typename Kokkos::ArithTraits<scalar_t>;
+  using device_t                = typename HandleDeviceValueType::device_type;
+  using MT                      = typename karith::mag_type;
+  using StateType               = Kokkos::View<MT *, device_t>;
+  using NrmType                 = Kokkos::View<MT, device_t>;
+
+  /**
+   * GMRES with CGS2 orthogonalization, with all the kernels enqueued on the
+   * execution space instance space. The Hessenberg matrix, the Givens
+   * rotations and the shortcut residual stay on the device, and the host
+   * only reads the shortcut residual back every get_check_interval()
+   * iterations (and at the end of a cycle), then the true residual when it
+   * has to decide on convergence or restart.
+   *
+   * The Preconditioner interface has no execution space argument, so the
+   * instance is fenced around each application of the preconditioner.
+   */
+  template <class ExecutionSpace, class AMatrix, class BType, class XType>
+  static void gmres(
+      const ExecutionSpace &space, GmresHandle &thandle, const AMatrix &A,
+      const BType &B, XType &X,
+      KokkosSparse::Experimental::Preconditioner<AMatrix> *precond = nullptr) {
+    using range_policy = Kokkos::RangePolicy<ExecutionSpace>;
+    using givens_t =
+        GmresAsyncGivensFunctor<HandleDevice2dValueType, HandleDeviceValueType,
+                                StateType, NrmType>;
+    using ls_solve_t =
+        GmresAsyncLsSolveFunctor<HandleDevice2dValueType,
+                                 HandleDeviceValueType, StateType>;
+
+    const scalar_t one  = karith::one();
+    const scalar_t zero = karith::zero();
+
+    Kokkos::Profiling::pushRegion("GMRES::Async::TotalTime:");
+
+    const auto n          = A.numPointRows();
+    const int m           = thandle.get_m();
+    const auto maxRestart = thandle.get_max_restart();
+    const auto tol        = thandle.get_tol();
+    const int interval    = thandle.get_check_interval();
+    const auto verbose    = thandle.get_verbose();
+
+    if (thandle.get_ortho() != GmresHandle::Ortho::CGS2 ||
+        thandle.get_flexible()) {
+      throw std::invalid_argument(
+          "gmres: the execution space instance version only supports the "
+          "CGS2 orthogonalization, without flexible GMRES");
+    }
+    if (interval <= 0) {
+      throw std::invalid_argument(
+          "gmres: the check interval must be positive");
+    }
+    if (verbose) {
+      std::cout << "Starting GMRES on an execution space instance with..."
+                << std::endl;
+      std::cout << "  n:          " << n << std::endl;
+      std::cout << "  m:          " << m << std::endl;
+      std::cout << "  maxRestart: " << maxRestart << std::endl;
+      std::cout << "  tol:        " << tol << std::endl;
+      std::cout << "  interval:   " << interval << std::endl;
+      std::cout << "  precond:    " << (precond ? "ON" : "OFF") << std::endl;
+    }
+
+    // Make tmp work views, from the workspace of the handle if it has one
+    typename GmresHandle::workspace_t::Scope work(thandle.get_workspace());
+    using DV  = HandleDeviceValueType;
+    using DV2 = HandleDevice2dValueType;
+    DV Xiter    = work.template view<DV>("Xiter", true, n);
+    DV Res      = work.template view<DV>("Res", false, n);
+    DV Wj       = work.template view<DV>("W_j", false, n);
+    DV Wj2      = work.template view<DV>("W_j2", false, n);
+    DV orthoTmp = work.template view<DV>("orthoTmp", false, m);
+    DV G        = work.template view<DV>("GVec", true, m + 1);
+    DV CosVal   = work.template view<DV>("CosVal", true, m);
+    DV SinVal   = work.template view<DV>("SinVal", true, m);
+    DV LsSoln   = work.template view<DV>("LsSoln", true, m);
+    DV2 V       = work.template view<DV2>("V", false, n, m + 1);
+    DV2 H       = work.template view<DV2>("H", true, m + 1, m);
+
+    StateType state = work.template view<StateType>("state", true, 3);
+    NrmType nrm     = work.template view<NrmType>("nrm", true);
+    auto state_h    = Kokkos::create_mirror_view(state);
+
+    // The host needs the norm of b, once
+    const MT nrmB = KokkosBlas::nrm2(space, B);
+    Kokkos::deep_copy(space, Res, B);
+    KokkosSparse::spmv(space, "N", -one, A, X, one, Res);  // res = b-Ax
+    MT trueRes = KokkosBlas::nrm2(space, Res);
+    MT relRes;
+    if (nrmB != 0) {
+      relRes = trueRes / nrmB;
+    } else if (trueRes == 0) {
+      relRes = trueRes;
+    } else {  // B is zero, but X has wrong initial guess.
+      Kokkos::deep_copy(space, X, zero);
+      relRes = 0;
+    }
+    MT shortRelRes = relRes;
+    if (verbose) {
+      std::cout << "Initial relative residual is: " << relRes << std::endl;
+    }
+    bool converged = relRes < tol;
+
+    size_type cycle    = 0;
+    size_type numIters = 0;
+    while (!converged && cycle <= maxRestart && shortRelRes >= 1e-14) {
+      Kokkos::deep_copy(space, G, zero);
+      Kokkos::deep_copy(space, Kokkos::subview(G, 0), scalar_t(trueRes));
+      Kokkos::deep_copy(space, state, MT(0));
+      Kokkos::deep_copy(space, Kokkos::subview(state, 2), MT(-1));
+
+      auto V0 = Kokkos::subview(V, Kokkos::ALL, 0);
+      KokkosBlas::scal(space, V0, one / trueRes, Res);  // V0 = res/norm(res)
+
+      for (int j = 0; j < m; j++) {
+        auto Vj = Kokkos::subview(V, Kokkos::ALL, j);
+        if (precond) {  // wj = A*M*Vj
+          space.fence();
+          precond->apply(Vj, Wj2);
+          typename AMatrix::execution_space().fence();
+          KokkosSparse::spmv(space, "N", one, A, Wj2, zero, Wj);
+        } else {  // wj = A*Vj
+          KokkosSparse::spmv(space, "N", one, A, Vj, zero, Wj);
+        }
+
+        // CGS2
+        auto V0j =
+            Kokkos::subview(V, Kokkos::ALL, Kokkos::make_pair(0, j + 1));
+        auto Hj = Kokkos::subview(H, Kokkos::make_pair(0, j + 1), j);
+        auto orthoTmpSub =
+            Kokkos::subview(orthoTmp, Kokkos::make_pair(0, j + 1));
+        KokkosBlas::gemv(space, "C", one, V0j, Wj, zero, Hj);
+        KokkosBlas::gemv(space, "N", -one, V0j, Hj, one, Wj);
+        KokkosBlas::gemv(space, "C", one, V0j, Wj, zero, orthoTmpSub);
+        KokkosBlas::gemv(space, "N", -one, V0j, orthoTmpSub, one, Wj);
+        KokkosBlas::axpy(space, one, orthoTmpSub, Hj);
+
+        KokkosBlas::nrm2(space, nrm, Wj);
+        Kokkos::parallel_for(
+            "KokkosSparse::gmres::async::givens", range_policy(space, 0, 1),
+            givens_t{H, CosVal, SinVal, G, state, nrm, j});
+        Kokkos::parallel_for(
+            "KokkosSparse::gmres::async::scale", range_policy(space, 0, n),
+            GmresAsyncScaleFunctor<decltype(V0), HandleDeviceValueType,
+                                   StateType>{
+                Kokkos::subview(V, Kokkos::ALL, j + 1), Wj, state});
+
+        if ((j + 1) % interval != 0 && j != m - 1) continue;
+
+        // Check the shortcut residual
+        Kokkos::deep_copy(space, state_h, state);
+        space.fence();
+        shortRelRes          = state_h(1) / nrmB;
+        const bool breakdown = state_h(2) >= MT(0);
+        if (verbose) {
+          std::cout << "Shortcut relative residual for iteration "
+                    << j + (cycle * m) << " is: " << shortRelRes << std::endl;
+        }
+        if (karith::isNan(scalar_t(shortRelRes))) {
+          throw std::runtime_error(
+              "gmres: Relative residual is nan. Terminating solver.");
+        }
+        if (breakdown && shortRelRes >= tol) {
+          throw std::runtime_error(
+              "GMRES has experienced lucky breakdown, but the residual has "
+              "not converged.\nSolver terminated without convergence.");
+        }
+        if (shortRelRes >= tol && j != m - 1) continue;
+
+        // Update the solution and check the true residual
+        Kokkos::parallel_for("KokkosSparse::gmres::async::ls_solve",
+                             range_policy(space, 0, 1),
+                             ls_solve_t{H, G, LsSoln, state, j});
+        auto VSub =
+            Kokkos::subview(V, Kokkos::ALL, Kokkos::make_pair(0, j + 1));
+        auto LsSolnSub = Kokkos::subview(LsSoln, Kokkos::make_pair(0, j + 1));
+        Kokkos::deep_copy(space, Xiter, X);
+        if (precond) {  // x_iter = x + M*V(1:j+1)*lsSoln
+          KokkosBlas::gemv(space, "N", one, VSub, LsSolnSub, zero, Wj);
+          space.fence();
+          precond->apply(Wj, Xiter, "N", one, one);
+          typename AMatrix::execution_space().fence();
+        } else {  // x_iter = x + V(1:j+1)*lsSoln
+          KokkosBlas::gemv(space, "N", one, VSub, LsSolnSub, one, Xiter);
+        }
+        Kokkos::deep_copy(space, Res, B);
+        KokkosSparse::spmv(space, "N", -one, A, Xiter, one, Res);  // r = b-Ax
+        trueRes = KokkosBlas::nrm2(space, Res);
+        relRes  = trueRes / nrmB;
+        if (verbose) {
+          std::cout << "True relative residual for iteration "
+                    << j + (cycle * m) << " is : " << relRes << std::endl;
+        }
+        numIters = breakdown ? static_cast<int>(state_h(2)) + 1 : j + 1;
+
+        if (relRes < tol) {
+          converged = true;
+          break;
+        } else if (breakdown || shortRelRes < 1e-30) {
+          if (verbose) {
+            std::cout
+                << "Short residual has converged to machine zero, but true "
+                   "residual is not converged.\n"
+                << "You may have given GMRES a singular matrix. Ending the "
+                   "GMRES iteration."
+                << std::endl;
+          }
+          break;
+        }
+      }  // end Arnoldi iter.
+
+      cycle++;
+      Kokkos::deep_copy(space, X, Xiter);
+    }
+    space.fence();
+
+    typename GmresHandle::Flag conv_flag_val;
+    if (converged) {
+      conv_flag_val = GmresHandle::Flag::Conv;
+    } else if (shortRelRes < tol) {
+      conv_flag_val = GmresHandle::Flag::LOA;
+    } else {
+      conv_flag_val = GmresHandle::Flag::NoConv;
+    }
+    const int num_iters = cycle > 0 ? (cycle - 1) * m + numIters : 0;
+    if (verbose) {
+      std::cout << "Ending relative residual is: " << relRes << std::endl;
+      std::cout << "The solver completed " << num_iters << " iterations."
+                << std::endl;
+    }
+    thandle.set_stats(num_iters, relRes, conv_flag_val);
+
+    Kokkos::Profiling::popRegion();
+  }  // end gmres
+};
+
+}  // namespace Experimental
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_IMPL_GMRES_ASYNC_HPP_
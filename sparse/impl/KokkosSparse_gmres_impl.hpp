@@ -22,12 +22,15 @@
 /// \file KokkosSparse_gmres_impl.hpp
 /// \brief Implementation(s) of the numeric phase of GMRES.
 
+#include <vector>
 #include <KokkosKernels_config.h>
 #include <Kokkos_ArithTraits.hpp>
 #include <KokkosSparse_gmres_handle.hpp>
 #include <KokkosBlas.hpp>
 #include <KokkosBlas3_trsm_impl.hpp>
 #include <KokkosSparse_spmv.hpp>
+#include <KokkosSparse_spmv_dot.hpp>
+#include <KokkosSparse_matrix_powers.hpp>
 #include <KokkosSparse_Preconditioner.hpp>
 #include "KokkosKernels_Error.hpp"
 
@@ -35,6 +38,72 @@ namespace KokkosSparse {
 namespace Impl {
 namespace Experimental {
 
+// Persistent handle of the matrix powers kernel for s-step GMRES; only
+// CrsMatrix has that kernel, so other matrices get a placeholder
+template <class ExecutionSpace, class AMatrix,
+          bool = KokkosSparse::is_crs_matrix_v<AMatrix>>
+struct GmresPowersHandle {
+  using type = int;
+};
+
+template <class ExecutionSpace, class AMatrix>
+struct GmresPowersHandle<ExecutionSpace, AMatrix, true> {
+  using type =
+      KokkosSparse::Experimental::MatrixPowersHandle<ExecutionSpace, AMatrix>;
+};
+
+// y := A*x, with spmv for a CrsMatrix or BsrMatrix, or with A.apply(x, y)
+// for a matrix-free operator
+template <class AMatrix, class XView, class YView>
+void gmres_apply(const AMatrix& A, const XView& x, const YView& y) {
+  using scalar_t = typename YView::non_const_value_type;
+  using device_t = typename YView::device_type;
+  if constexpr (KokkosSparse::is_crs_matrix_v<AMatrix> ||
+                KokkosSparse::Experimental::is_bsr_matrix_v<AMatrix>) {
+    KokkosSparse::spmv("N", Kokkos::ArithTraits<scalar_t>::one(), A, x,
+                       Kokkos::ArithTraits<scalar_t>::zero(), y);
+  } else {
+    A.apply(Kokkos::View<const scalar_t*, device_t>(x),
+            Kokkos::View<scalar_t*, device_t>(y));
+  }
+}
+
+// y := A*x on the instance space. An operator has no instance argument, so
+// it runs on the default instance, and the caller's fence of space no
+// longer covers it; it is fenced here.
+template <class ExecutionSpace, class AMatrix, class XView, class YView>
+void gmres_apply(const ExecutionSpace& space, const AMatrix& A,
+                 const XView& x, const YView& y) {
+  using scalar_t = typename YView::non_const_value_type;
+  if constexpr (KokkosSparse::is_crs_matrix_v<AMatrix> ||
+                KokkosSparse::Experimental::is_bsr_matrix_v<AMatrix>) {
+    KokkosSparse::spmv(space, "N", Kokkos::ArithTraits<scalar_t>::one(), A,
+                       x, Kokkos::ArithTraits<scalar_t>::zero(), y);
+  } else {
+    gmres_apply(A, x, y);
+    ExecutionSpace().fence();
+  }
+}
+
+// y := A*x and returns z^* y, fused in a single pass over y for a
+// CrsMatrix
+template <class AMatrix, class XView, class YView, class ZView>
+typename YView::non_const_value_type gmres_apply_dot(const AMatrix& A,
+                                                     const XView& x,
+                                                     const YView& y,
+                                                     const ZView& z) {
+  using scalar_t = typename YView::non_const_value_type;
+  using karith   = Kokkos::ArithTraits<scalar_t>;
+  if constexpr (KokkosSparse::is_crs_matrix_v<AMatrix> ||
+                KokkosSparse::Experimental::is_bsr_matrix_v<AMatrix>) {
+    return karith::conj(
+        KokkosSparse::spmv_dot(karith::one(), A, x, karith::zero(), y, z));
+  } else {
+    gmres_apply(A, x, y);
+    return KokkosBlas::dot(z, y);
+  }
+}
+
 template <class GmresHandle>
 struct GmresWrap {
   //
@@ -54,11 +123,15 @@ struct GmresWrap {
   /**
    * The main gmres numeric function. Copied with slight modifications from
    * example/gmres/gmres.hpp
+   *
+   * A is a CrsMatrix, a BsrMatrix or a matrix-free operator (see
+   * gmres_apply), and precond any Preconditioner on the device of X.
    */
-  template <class AMatrix, class BType, class XType>
-  static void gmres(
-      GmresHandle& thandle, const AMatrix& A, const BType& B, XType& X,
-      KokkosSparse::Experimental::Preconditioner<AMatrix>* precond = nullptr) {
+  template <class AMatrix, class BType, class XType,
+            class Precond =
+                KokkosSparse::Experimental::Preconditioner<AMatrix>>
+  static void gmres(GmresHandle& thandle, const AMatrix& A, const BType& B,
+                    XType& X, Precond* precond = nullptr) {
     using ST = typename karith::val_type;  // So this code will run with
                                            // scalar_t = std::complex<T>.
     using MT                  = typename karith::mag_type;
@@ -70,7 +143,7 @@ struct GmresWrap {
     Kokkos::Profiling::pushRegion("GMRES::TotalTime:");
 
     // Store solver options:
-    const auto n          = A.numPointRows();
+    const auto n          = B.extent(0);
     const int m           = thandle.get_m();
     const auto maxRestart = thandle.get_max_restart();
     const auto tol        = thandle.get_tol();
@@ -90,46 +163,87 @@ struct GmresWrap {
       std::cout << "  maxRestart: " << maxRestart << std::endl;
       std::cout << "  tol:        " << tol << std::endl;
       std::cout << "  ortho:      "
-                << ((ortho == GmresHandle::Ortho::CGS2) ? "CGS2" : "MGS")
+                << ((ortho == GmresHandle::Ortho::CGS2)        ? "CGS2"
+                    : (ortho == GmresHandle::Ortho::MGS)       ? "MGS"
+                    : (ortho == GmresHandle::Ortho::PIPELINED) ? "PIPELINED"
+                                                               : "SSTEP")
                 << std::endl;
       std::cout << "  precond:    " << (precond ? "ON" : "OFF") << std::endl;
+      std::cout << "  flexible:   "
+                << (thandle.get_flexible() ? "ON" : "OFF") << std::endl;
     }
 
-    // Make tmp work views
+    // Make tmp work views, from the workspace of the handle if it has one
 
-    HandleDeviceValueType Xiter(
-        "Xiter", n),  // Intermediate solution at iterations before restart.
-        Res(Kokkos::view_alloc(Kokkos::WithoutInitializing, "Res"),
-            n),  // Residual vector
-        Wj(Kokkos::view_alloc(Kokkos::WithoutInitializing, "W_j"),
-           n),  // Tmp work vector 1
-        Wj2(Kokkos::view_alloc(Kokkos::WithoutInitializing, "W_j2"),
-            n),  // Tmp work vector 2
-        orthoTmp(Kokkos::view_alloc(Kokkos::WithoutInitializing, "orthoTmp"),
-                 m);
+    typename GmresHandle::workspace_t::Scope work(thandle.get_workspace());
+    using DV  = HandleDeviceValueType;
+    using DV2 = HandleDevice2dValueType;
+    // Intermediate solution at iterations before restart, residual vector
+    // and tmp work vectors
+    DV Xiter    = work.template view<DV>("Xiter", true, n);
+    DV Res      = work.template view<DV>("Res", false, n);
+    DV Wj       = work.template view<DV>("W_j", false, n);
+    DV Wj2      = work.template view<DV>("W_j2", false, n);
+    DV orthoTmp = work.template view<DV>("orthoTmp", false, m);
 
     HandleHostValueType GVec_h(
         Kokkos::view_alloc(Kokkos::WithoutInitializing, "GVec"), m + 1);
-    HandleDevice2dValueType GLsSoln(
-        "GLsSoln", m,
-        1);  // LS solution vec for Givens Rotation. Must be 2-D for trsm.
+    // LS solution vec for Givens Rotation. Must be 2-D for trsm.
+    DV2 GLsSoln    = work.template view<DV2>("GLsSoln", true, m, 1);
     auto GLsSoln_h = Kokkos::create_mirror_view(
         GLsSoln);  // This one is needed for triangular solve.
     HandleHostValueType CosVal_h("CosVal", m), SinVal_h("SinVal", m);
-    HandleDevice2dValueType V(
-        Kokkos::view_alloc(Kokkos::WithoutInitializing, "V"), n, m + 1),
-        VSub,              // Subview of 1st m cols for updating soln.
-        H("H", m + 1, m);  // H matrix on device. Also used in Arn Rec debug.
+    DV2 V = work.template view<DV2>("V", false, n, m + 1);
+    DV2 VSub;  // Subview of 1st m cols for updating soln.
+    // H matrix on device. Also used in Arn Rec debug.
+    DV2 H = work.template view<DV2>("H", true, m + 1, m);
 
     auto H_h = Kokkos::create_mirror_view(H);  // Make H into a host view of H.
 
+    // Pipelined GMRES keeps Z = A*M*V, so that A*M*Zj (in Qj) gives the next
+    // column of Z while the reductions for Zj run on another instance.
+    const bool pipelined = ortho == GmresHandle::Ortho::PIPELINED;
+    DV2 Z = work.template view<DV2>("Z", false, pipelined ? n : 0, m + 1);
+    DV Qj = work.template view<DV>("Q_j", false, pipelined ? n : 0);
+    std::vector<execution_space> instances;
+    if (pipelined) {
+      instances =
+          Kokkos::Experimental::partition_space(execution_space(), 1, 1);
+    }
+    const MT sqrtEps = Kokkos::sqrt(Kokkos::ArithTraits<MT>::epsilon());
+
+    // s-step GMRES builds s columns of V and of the (unrotated) Hessenberg
+    // matrix Hraw at a time
+    const bool sstep = ortho == GmresHandle::Ortho::SSTEP;
+    const int s      = thandle.get_s_step();
+    if (sstep && (s <= 0 || m % s != 0)) {
+      throw std::invalid_argument(
+          "gmres: with the SSTEP orthogonalization, m must be a positive "
+          "multiple of s");
+    }
+    // Flexible GMRES keeps the preconditioned basis ZF = M*V
+    const bool flexible = thandle.get_flexible() && precond;
+    if (flexible && (pipelined || sstep)) {
+      throw std::invalid_argument(
+          "gmres: flexible GMRES needs the CGS2 or MGS orthogonalization");
+    }
+    DV2 ZF = work.template view<DV2>("ZF", false, flexible ? n : 0,
+                                     flexible ? m : 0);
+
+    typename HandleDevice2dValueType::HostMirror Hraw_h(
+        "Hraw", sstep ? m + 1 : 0, sstep ? m : 0);
+    DV2 WTmp = work.template view<DV2>("WTmp", false, sstep ? n : 0,
+                                       sstep ? s : 0);
+    typename GmresPowersHandle<execution_space, AMatrix>::type powers(
+        sstep ? s : 0);
+
     // Compute initial residuals:
     nrmB = KokkosBlas::nrm2(B);
     Kokkos::deep_copy(Res, B);
 
     // This is initial true residual, so don't need prec here.
-    KokkosSparse::spmv("N", one, A, X, zero, Wj);  // wj = Ax
-    KokkosBlas::axpy(-one, Wj, Res);               // res = res-Wj = b-Ax.
+    gmres_apply(A, X, Wj);            // wj = Ax
+    KokkosBlas::axpy(-one, Wj, Res);  // res = res-Wj = b-Ax.
     trueRes = KokkosBlas::nrm2(Res);
     if (nrmB != 0) {
       relRes = trueRes / nrmB;
@@ -155,18 +269,45 @@ struct GmresWrap {
       Kokkos::deep_copy(Vj, Res);
       KokkosBlas::scal(Vj, one / trueRes, Vj);  // V0 = V0/norm(V0)
 
-      for (int j = 0; j < m; j++) {
-        if (precond) {                                     // Apply Right prec
-          precond->apply(Vj, Wj2);                         // wj2 = M*Vj
-          KokkosSparse::spmv("N", one, A, Wj2, zero, Wj);  // wj = A*MVj = A*Wj2
+      auto V0 = Kokkos::subview(V, Kokkos::ALL, 0);
+      if (pipelined) {  // Z0 = A*M*V0
+        auto Z0 = Kokkos::subview(Z, Kokkos::ALL, 0);
+        if (precond) {
+          precond->apply(V0, Wj2);
+          gmres_apply(A, Wj2, Z0);
         } else {
-          KokkosSparse::spmv("N", one, A, Vj, zero, Wj);  // wj = A*Vj
+          gmres_apply(A, V0, Z0);
+        }
+      }
+      for (int j = 0; j < m; j++) {
+        // With MGS, the first projection V0^* Wj is fused with the spmv
+        // producing Wj, which saves reading Wj back from memory.
+        const bool fuseDot = ortho == GmresHandle::Ortho::MGS;
+        MT pipeNrm         = 0;
+        if (pipelined || sstep) {
+          // The spmv is done along with the orthogonalization
+        } else if (precond) {                       // Apply Right prec
+          precond->apply(Vj, Wj2);                  // wj2 = M*Vj
+          // M may change, so keep M*Vj for the solution update
+          if (flexible) {
+            Kokkos::deep_copy(Kokkos::subview(ZF, Kokkos::ALL, j), Wj2);
+          }
+          if (fuseDot)                              // wj = A*MVj = A*Wj2
+            H_h(0, j) = gmres_apply_dot(A, Wj2, Wj, V0);
+          else
+            gmres_apply(A, Wj2, Wj);
+        } else {                                    // wj = A*Vj
+          if (fuseDot)
+            H_h(0, j) = gmres_apply_dot(A, Vj, Wj, V0);
+          else
+            gmres_apply(A, Vj, Wj);
         }
         Kokkos::Profiling::pushRegion("GMRES::Orthog:");
         if (ortho == GmresHandle::Ortho::MGS) {
           for (int i = 0; i <= j; i++) {
-            auto Vi   = Kokkos::subview(V, Kokkos::ALL, i);
-            H_h(i, j) = KokkosBlas::dot(Vi, Wj);   // Vi^* Wj
+            auto Vi = Kokkos::subview(V, Kokkos::ALL, i);
+            // H(0, j) was computed along with Wj
+            if (i > 0) H_h(i, j) = KokkosBlas::dot(Vi, Wj);  // Vi^* Wj
             KokkosBlas::axpy(-H_h(i, j), Vi, Wj);  // wj = wj-Hij*Vi
           }
           auto Hj_h = Kokkos::subview(H_h, Kokkos::make_pair(0, j + 1), j);
@@ -175,29 +316,89 @@ struct GmresWrap {
               Kokkos::subview(V, Kokkos::ALL, Kokkos::make_pair(0, j + 1));
           auto Hj   = Kokkos::subview(H, Kokkos::make_pair(0, j + 1), j);
           auto Hj_h = Kokkos::subview(H_h, Kokkos::make_pair(0, j + 1), j);
-          KokkosBlas::gemv("C", one, V0j, Wj, zero, Hj);  // Hj = Vj^T * wj
+          KokkosBlas::multi_dot(Hj, V0j, Wj);  // Hj = Vj^T * wj
           KokkosBlas::gemv("N", -one, V0j, Hj, one, Wj);  // wj = wj - Vj * Hj
 
           // Re-orthog CGS:
           auto orthoTmpSub =
               Kokkos::subview(orthoTmp, Kokkos::make_pair(0, j + 1));
-          KokkosBlas::gemv("C", one, V0j, Wj, zero,
-                           orthoTmpSub);  // tmp (Hj) = Vj^T * wj
+          KokkosBlas::multi_dot(orthoTmpSub, V0j, Wj);  // tmp (Hj) = Vj^T * wj
           KokkosBlas::gemv("N", -one, V0j, orthoTmpSub, one,
                            Wj);                    // wj = wj - Vj * tmp
           KokkosBlas::axpy(one, orthoTmpSub, Hj);  // Hj = Hj + tmp
           Kokkos::deep_copy(Hj_h, Hj);
+        } else if (pipelined) {
+          // Zj = A*M*Vj is orthogonalized with a single pass of CGS, whose
+          // reductions (Hj = Vj^T * Zj and Zj^T * Zj) run on instances[1]
+          // while instances[0] computes Qj = A*M*Zj. The norm of Wj comes
+          // from Pythagoras, unless there is too much cancellation.
+          execution_space().fence();  // V and Z are complete
+          auto Zj = Kokkos::subview(Z, Kokkos::ALL, j);
+          auto V0j =
+              Kokkos::subview(V, Kokkos::ALL, Kokkos::make_pair(0, j + 1));
+          auto Hj    = Kokkos::subview(H, Kokkos::make_pair(0, j + 1), j);
+          auto Hj2   = Kokkos::subview(H, Kokkos::make_pair(0, j + 2), j);
+          auto Hj2_h = Kokkos::subview(H_h, Kokkos::make_pair(0, j + 2), j);
+          KokkosBlas::multi_dot(instances[1], Hj, V0j, Zj);
+          KokkosBlas::dot(instances[1], Kokkos::subview(H, j + 1, j), Zj, Zj);
+          Kokkos::deep_copy(instances[1], Hj2_h, Hj2);
+          if (j < m - 1) {
+            if (precond) {  // The preconditioner runs on the default instance
+              precond->apply(Zj, Wj2);
+              execution_space().fence();
+              gmres_apply(instances[0], A, Wj2, Qj);
+            } else {
+              gmres_apply(instances[0], A, Zj, Qj);
+            }
+          }
+          instances[1].fence();
+
+          MT hNrm2 = 0;
+          for (int i = 0; i <= j; i++) {
+            hNrm2 += karith::real(H_h(i, j)) * karith::real(H_h(i, j)) +
+                     karith::imag(H_h(i, j)) * karith::imag(H_h(i, j));
+          }
+          const MT zNrm2 = karith::real(H_h(j + 1, j));
+          Kokkos::deep_copy(instances[1], Wj, Zj);
+          KokkosBlas::gemv(instances[1], "N", -one, V0j, Hj, one,
+                           Wj);  // wj = zj - Vj * Hj
+          if (zNrm2 - hNrm2 > sqrtEps * zNrm2) {
+            pipeNrm = Kokkos::sqrt(zNrm2 - hNrm2);
+          } else {
+            pipeNrm = KokkosBlas::nrm2(instances[1], Wj);
+          }
+          instances[1].fence();
+        } else if (sstep) {
+          // V(:, j+1:j+s) and the columns j to j+s-1 of H come in one block
+          if (j % s == 0) {
+            sstep_block(A, precond, powers, V, Wj, WTmp, Hraw_h, j, s);
+          }
+          for (int i = 0; i <= j + 1; i++) H_h(i, j) = Hraw_h(i, j);
+          pipeNrm = karith::abs(H_h(j + 1, j));
         } else {
           throw std::invalid_argument(
-              "Invalid argument for 'ortho'.  Please use 'CGS2' or 'MGS'.");
+              "Invalid argument for 'ortho'.  Please use 'CGS2', 'MGS', "
+              "'PIPELINED' or 'SSTEP'.");
         }
 
-        MT tmpNrm     = KokkosBlas::nrm2(Wj);
-        H_h(j + 1, j) = tmpNrm;
-        if (tmpNrm > 1e-14) {
+        MT tmpNrm     = (pipelined || sstep) ? pipeNrm : KokkosBlas::nrm2(Wj);
+        if (!sstep) H_h(j + 1, j) = tmpNrm;
+        if (tmpNrm > 1e-14 && !sstep) {
           Vj = Kokkos::subview(V, Kokkos::ALL, j + 1);
           KokkosBlas::scal(Vj, one / H_h(j + 1, j), Wj);  // Vj = Wj/H(j+1,j)
+          if (pipelined && j < m - 1) {
+            // Zj+1 = A*M*Vj+1 = (Qj - Z(0:j) * Hj) / H(j+1,j)
+            auto Zj1 = Kokkos::subview(Z, Kokkos::ALL, j + 1);
+            auto Z0j =
+                Kokkos::subview(Z, Kokkos::ALL, Kokkos::make_pair(0, j + 1));
+            auto Hj = Kokkos::subview(H, Kokkos::make_pair(0, j + 1), j);
+            instances[0].fence();
+            Kokkos::deep_copy(Zj1, Qj);
+            KokkosBlas::gemv("N", -one, Z0j, Hj, one, Zj1);
+            KokkosBlas::scal(Zj1, one / H_h(j + 1, j), Zj1);
+          }
         }
+        if (pipelined) instances[0].fence();
         Kokkos::Profiling::popRegion();
 
         // Givens for real and complex (See Alg 3 in "On computing Givens
@@ -268,7 +469,11 @@ struct GmresWrap {
               X);  // Can't overwrite X with intermediate solution.
           auto GLsSolnSub3 =
               Kokkos::subview(GLsSoln, Kokkos::make_pair(0, j + 1), 0);
-          if (precond) {  // Apply right prec to correct soln.
+          if (flexible) {  // x_iter = x + ZF(1:j+1)*lsSoln
+            auto ZSub =
+                Kokkos::subview(ZF, Kokkos::ALL, Kokkos::make_pair(0, j + 1));
+            KokkosBlas::gemv("N", one, ZSub, GLsSolnSub3, one, Xiter);
+          } else if (precond) {  // Apply right prec to correct soln.
             KokkosBlas::gemv("N", one, VSub, GLsSolnSub3, zero,
                              Wj);                      // wj = V(1:j+1)*lsSoln
             precond->apply(Wj, Xiter, "N", one, one);  // Xiter = M*wj + X
@@ -276,9 +481,9 @@ struct GmresWrap {
             KokkosBlas::gemv("N", one, VSub, GLsSolnSub3, one,
                              Xiter);  // x_iter = x + V(1:j+1)*lsSoln
           }
-          KokkosSparse::spmv("N", one, A, Xiter, zero, Wj);  // wj = Ax
-          Kokkos::deep_copy(Res, B);                         // Reset r=b.
-          KokkosBlas::axpy(-one, Wj, Res);                   // r = b-Ax.
+          gmres_apply(A, Xiter, Wj);        // wj = Ax
+          Kokkos::deep_copy(Res, B);        // Reset r=b.
+          KokkosBlas::axpy(-one, Wj, Res);  // r = b-Ax.
           trueRes = KokkosBlas::nrm2(Res);
           relRes  = trueRes / nrmB;
           if (verbose) {
@@ -355,6 +560,139 @@ struct GmresWrap {
     Kokkos::Profiling::popRegion();
   }  // end gmres
 
+  /**
+   * One block of s-step GMRES: V(:, j+1:j+s) gets the basis
+   * [A*q, A^2*q, ..., A^s*q] of q = V(:, j) (with A*M in place of A with a
+   * preconditioner), which is orthogonalized against V(:, 0:j) by two passes
+   * of block Classical Gram-Schmidt and then within itself by CholQR2, with
+   * gemm. This gives V(:, j:j+s) = V(:, 0:j+s) * Rb, from which the columns
+   * j to j+s-1 of the Arnoldi Hessenberg matrix Hraw follow, as
+   *   A * V(:, 0:j+s-1) * Rb(0:j+s-1, 0:s-1) = V(:, 0:j+s) * Rb(:, 1:s)
+   * and the columns 0 to j-1 of Hraw are known.
+   */
+  template <class AMatrix, class Precond, class PowersHandle,
+            class HostMatrix>
+  static void sstep_block(
+      const AMatrix& A, Precond* precond, PowersHandle& powers,
+      const HandleDevice2dValueType& V, const HandleDeviceValueType& tmp, const HandleDevice2dValueType& WTmp,
+      const HostMatrix& Hraw_h, const int j, const int s) {
+    using ST = typename karith::val_type;
+    using MT = typename karith::mag_type;
+
+    const ST one  = karith::one();
+    const ST zero = karith::zero();
+
+    auto Q  = Kokkos::subview(V, Kokkos::ALL, Kokkos::make_pair(0, j + 1));
+    auto Wn =
+        Kokkos::subview(V, Kokkos::ALL, Kokkos::make_pair(j + 1, j + s + 1));
+
+    // Basis
+    bool have_basis = false;
+    if constexpr (!std::is_same_v<PowersHandle, int>) {
+      if (!precond) {
+        Kokkos::deep_copy(tmp, Kokkos::subview(V, Kokkos::ALL, j));
+        KokkosSparse::Experimental::matrix_powers(
+            &powers, A, tmp,
+            Kokkos::subview(V, Kokkos::ALL, Kokkos::make_pair(j, j + s + 1)));
+        have_basis = true;
+      }
+    }
+    for (int k = 1; k <= s && !have_basis; k++) {
+      auto Vprev = Kokkos::subview(V, Kokkos::ALL, j + k - 1);
+      auto Vk    = Kokkos::subview(V, Kokkos::ALL, j + k);
+      if (precond) {
+        precond->apply(Vprev, tmp);
+        gmres_apply(A, tmp, Vk);
+      } else {
+        gmres_apply(A, Vprev, Vk);
+      }
+    }
+
+    // Block CGS2: Wn = Wn - Q * C
+    HandleDevice2dValueType C("C", j + 1, s), Ctmp("Ctmp", j + 1, s),
+        G("G", s, s);
+    KokkosBlas::gemm("C", "N", one, Q, Wn, zero, C);
+    KokkosBlas::gemm("N", "N", -one, Q, C, one, Wn);
+    KokkosBlas::gemm("C", "N", one, Q, Wn, zero, Ctmp);
+    KokkosBlas::gemm("N", "N", -one, Q, Ctmp, one, Wn);
+    KokkosBlas::axpy(one, Ctmp, C);
+
+    // CholQR2: Wn = Wn * R^{-1}, with R upper triangular
+    HostMatrix R_h("R", s, s), U_h("U", s, s), Uinv_h("Uinv", s, s);
+    for (int c = 0; c < s; c++) R_h(c, c) = one;
+    for (int pass = 0; pass < 2; pass++) {
+      KokkosBlas::gemm("C", "N", one, Wn, Wn, zero, G);
+      auto G_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), G);
+      // Cholesky factorization G = U^* U
+      for (int c = 0; c < s; c++) {
+        MT d = karith::real(G_h(c, c));
+        for (int k = 0; k < c; k++) {
+          const MT u = karith::abs(U_h(k, c));
+          d -= u * u;
+        }
+        if (!(d > MT(0))) {
+          throw std::runtime_error(
+              "gmres: the s-step basis is numerically rank deficient. Try a "
+              "smaller s.");
+        }
+        U_h(c, c) = Kokkos::sqrt(d);
+        for (int c2 = c + 1; c2 < s; c2++) {
+          ST g = G_h(c, c2);
+          for (int k = 0; k < c; k++) {
+            g -= karith::conj(U_h(k, c)) * U_h(k, c2);
+          }
+          U_h(c, c2) = g / U_h(c, c);
+        }
+      }
+      // U^{-1}, and R = U * R
+      for (int c = 0; c < s; c++) {
+        for (int r = c; r >= 0; r--) {
+          ST x = r == c ? one : zero;
+          for (int k = r + 1; k <= c; k++) x -= U_h(r, k) * Uinv_h(k, c);
+          Uinv_h(r, c) = x / U_h(r, r);
+        }
+      }
+      for (int c = s - 1; c >= 0; c--) {
+        for (int r = 0; r <= c; r++) {
+          ST x = zero;
+          for (int k = r; k <= c; k++) x += U_h(r, k) * R_h(k, c);
+          R_h(r, c) = x;
+        }
+      }
+      Kokkos::deep_copy(G, Uinv_h);
+      KokkosBlas::gemm("N", "N", one, Wn, G, zero, WTmp);
+      Kokkos::deep_copy(Wn, WTmp);
+    }
+
+    // Rb(:, 0) = e_j, Rb(0:j, c) = C(:, c-1) and Rb(j+1:j+s, c) = R(:, c-1).
+    // With T = Rb(0:j+s-1, 0:s-1) and its lower s x s block Tl (upper
+    // triangular): Hraw(:, j:j+s-1) = (Rb(:, 1:s) - Hraw(:, 0:j-1) *
+    // T(0:j-1, :)) * Tl^{-1}
+    auto C_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), C);
+    const int rows = j + s + 1;
+    auto Rb        = [&](const int r, const int c) -> ST {
+      if (c == 0) return r == j ? one : zero;
+      if (r <= j) return C_h(r, c - 1);
+      return R_h(r - j - 1, c - 1);
+    };
+    HostMatrix X_h("X", rows, s);
+    for (int c = 0; c < s; c++) {
+      for (int r = 0; r < rows; r++) {
+        ST x = Rb(r, c + 1);
+        if (r <= j) {
+          for (int i = 0; i < j; i++) x -= Hraw_h(r, i) * Rb(i, c);
+        }
+        for (int k = 0; k < c; k++) x -= X_h(r, k) * Rb(j + k, c);
+        X_h(r, c) = x / Rb(j + c, c);
+      }
+    }
+    for (int c = 0; c < s; c++) {
+      for (int r = 0; r < rows; r++) {
+        Hraw_h(r, j + c) = r <= j + c + 1 ? X_h(r, c) : zero;
+      }
+    }
+  }
+
 };  // struct GmresWrap
 
 }  // namespace Experimental
@@ -104,22 +104,30 @@ struct GMRES<KernelHandle, AT, AO, AD, AM, AS, BType, XType, false,
   static void gmres(
       KernelHandle *handle, const AMatrix &A, const BType &B, XType &X,
       KokkosSparse::Experimental::Preconditioner<AMatrix> *precond = nullptr) {
+    Kokkos::Profiling::pushRegion(KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+                                      ? "KokkosSparse::gmres[ETI]"
+                                      : "KokkosSparse::gmres[noETI]");
     auto gmres_handle = handle->get_gmres_handle();
     using Gmres       = Experimental::GmresWrap<
         typename std::remove_pointer<decltype(gmres_handle)>::type>;
 
     Gmres::gmres(*gmres_handle, A, B, X, precond);
+    Kokkos::Profiling::popRegion();
   }
 
   using BAMatrix = KokkosSparse::Experimental::BsrMatrix<AT, AO, AD, AM, AS>;
   static void gmres(
       KernelHandle *handle, const BAMatrix &A, const BType &B, XType &X,
       KokkosSparse::Experimental::Preconditioner<BAMatrix> *precond = nullptr) {
+    Kokkos::Profiling::pushRegion(KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+                                      ? "KokkosSparse::gmres[ETI]"
+                                      : "KokkosSparse::gmres[noETI]");
     auto gmres_handle = handle->get_gmres_handle();
     using Gmres       = Experimental::GmresWrap<
         typename std::remove_pointer<decltype(gmres_handle)>::type>;
 
     Gmres::gmres(*gmres_handle, A, B, X, precond);
+    Kokkos::Profiling::popRegion();
   }
 };
 
@@ -0,0 +1,77 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_KRON_IMPL_HPP_
+#define KOKKOSSPARSE_KRON_IMPL_HPP_
+
+#include <cstdint>
+#include "Kokkos_Core.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+
+/// Builds the Kronecker product C = A (x) B one row at a time. Row
+/// i * B.numRows() + k of C is row i of A times row k of B, so it has
+/// len_A(i) * len_B(k) entries. CountTag writes that length to rowmap(row),
+/// FillTag fills the row at rowmap(row). The columns of C are sorted if the
+/// columns of A and B are.
+template <typename AMatrix, typename BMatrix, typename rowmap_t,
+          typename entries_t, typename values_t>
+struct KronFunctor {
+  struct CountTag {};
+  struct FillTag {};
+  using size_type = typename rowmap_t::non_const_value_type;
+  using lno_t     = typename entries_t::non_const_value_type;
+  using scalar_t  = typename values_t::non_const_value_type;
+
+  AMatrix A;
+  BMatrix B;
+  rowmap_t rowmap;
+  entries_t entries;
+  values_t values;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const CountTag&,
+                                         const int64_t row) const {
+    const int64_t i = row / B.numRows();
+    const int64_t k = row % B.numRows();
+
+    rowmap(row) = size_type(A.graph.row_map(i + 1) - A.graph.row_map(i)) *
+                  size_type(B.graph.row_map(k + 1) - B.graph.row_map(k));
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const FillTag&,
+                                         const int64_t row) const {
+    const int64_t i = row / B.numRows();
+    const int64_t k = row % B.numRows();
+    const lno_t ncB = B.numCols();
+    const auto bBeg = B.graph.row_map(k);
+    const auto bEnd = B.graph.row_map(k + 1);
+    size_type pos   = rowmap(row);
+    for (auto a = A.graph.row_map(i); a < A.graph.row_map(i + 1); a++) {
+      const lno_t colA    = A.graph.entries(a);
+      const scalar_t valA = A.values(a);
+      for (auto b = bBeg; b < bEnd; b++, pos++) {
+        entries(pos) = colA * ncB + lno_t(B.graph.entries(b));
+        values(pos)  = valA * scalar_t(B.values(b));
+      }
+    }
+  }
+};
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_KRON_IMPL_HPP_
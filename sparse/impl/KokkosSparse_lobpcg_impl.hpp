@@ -0,0 +1,250 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_IMPL_LOBPCG_HPP_
+#define KOKKOSSPARSE_IMPL_LOBPCG_HPP_
+
+/// \file KokkosSparse_lobpcg_impl.hpp
+/// \brief Native LOBPCG eigensolver for sparse symmetric matrices.
+
+#include <sstream>
+#include <KokkosKernels_config.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ArithTraits.hpp>
+#include <KokkosBlas1_nrm2.hpp>
+#include <KokkosBlas3_gemm.hpp>
+#include <KokkosBatched_Syev_Decl.hpp>
+#include <KokkosSparse_spmv.hpp>
+#include <KokkosSparse_Preconditioner.hpp>
+#include "KokkosLapack_tsqr_impl.hpp"
+#include "KokkosKernels_Error.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+
+// Locally optimal block preconditioned conjugate gradient (Knyazev, 2001)
+// for the k smallest or largest eigenpairs of a symmetric A.
+//
+// The Rayleigh-Ritz basis is V = [X, W, P], with X the current Ritz vectors,
+// W = M (A X - X Lambda) the preconditioned residuals and P the previous
+// search directions. V is orthonormalized by TSQR: its Householder Q is
+// orthonormal even when W or P are (nearly) dependent on the rest, and its
+// first k columns span X, which is orthonormal already and kept as is. Only
+// the other 2k columns are multiplied by A, A X comes with the Ritz vectors.
+// The projected G = V^T A V is diagonalized by one team with
+// KokkosBatched::TeamVectorSyev, and the k extremal eigenvectors
+// C = [Cx; Cw; Cp] of G give X = V C and P = [W, P] [Cw; Cp].
+
+// Diagonalize the small m-by-m G with a single team, G is overwritten by its
+// eigenvectors and e holds the eigenvalues in ascending order
+template <class GMatrix, class EVector, class WVector, class InfoView>
+struct LobpcgSmallEigFunctor {
+  GMatrix G;
+  EVector e;
+  WVector W;
+  InfoView info;
+
+  LobpcgSmallEigFunctor(const GMatrix &G_, const EVector &e_,
+                        const WVector &W_, const InfoView &info_)
+      : G(G_), e(e_), W(W_), info(info_) {}
+
+  template <class MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType &member) const {
+    const int r =
+        KokkosBatched::TeamVectorSyev<MemberType, KokkosBatched::Uplo::Lower>::
+            invoke(member, G, e, W);
+    Kokkos::single(Kokkos::PerTeam(member), [&]() { info() = r; });
+  }
+};
+
+// Residuals R = A X - X Lambda, one row per index
+template <class XMatrix, class LVector>
+struct LobpcgResidualFunctor {
+  XMatrix X;
+  XMatrix AX;
+  LVector lambda;
+  XMatrix R;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const int i) const {
+    for (int j = 0; j < X.extent_int(1); ++j)
+      R(i, j) = AX(i, j) - lambda(j) * X(i, j);
+  }
+};
+
+template <class ExecutionSpace, class AMatrix, class XMatrix, class EVector>
+int lobpcg_native(
+    const ExecutionSpace &space, const AMatrix &A, const XMatrix &X,
+    const EVector &lambda, const bool largest,
+    const typename EVector::non_const_value_type tol, const int max_iters,
+    KokkosSparse::Experimental::Preconditioner<AMatrix> *precond) {
+  using scalar_type  = typename XMatrix::non_const_value_type;
+  using mag_type     = typename EVector::non_const_value_type;
+  using memory_space = typename XMatrix::memory_space;
+  using matrix_type =
+      Kokkos::View<scalar_type **, Kokkos::LayoutLeft, memory_space>;
+  using vector_type =
+      Kokkos::View<scalar_type *, Kokkos::LayoutLeft, memory_space>;
+  using mag_vector_type = Kokkos::View<mag_type *, memory_space>;
+  using info_type       = Kokkos::View<int, memory_space>;
+  using team_policy     = Kokkos::TeamPolicy<ExecutionSpace>;
+  using range_policy    = Kokkos::RangePolicy<ExecutionSpace>;
+
+  const scalar_type one  = Kokkos::ArithTraits<scalar_type>::one();
+  const scalar_type zero = Kokkos::ArithTraits<scalar_type>::zero();
+
+  const int n = X.extent_int(0);
+  const int k = X.extent_int(1);
+
+  matrix_type V(Kokkos::view_alloc(space, "lobpcg basis"), n, 3 * k);
+  matrix_type AV(Kokkos::view_alloc(space, "lobpcg A basis"), n, 3 * k);
+  matrix_type Xr(Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                                    "lobpcg Ritz vectors"),
+                 n, k);
+  matrix_type AXr(Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                                     "lobpcg A Ritz vectors"),
+                  n, k);
+  matrix_type P(Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                                   "lobpcg directions"),
+                n, k);
+  matrix_type R(Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                                   "lobpcg residuals"),
+                n, k);
+  matrix_type G(Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                                   "lobpcg projected A"),
+                3 * k, 3 * k);
+  matrix_type Rqr(Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                                     "lobpcg R"),
+                  3 * k, 3 * k);
+  vector_type e(Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                                   "lobpcg small eigenvalues"),
+                3 * k);
+  vector_type work(Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                                      "lobpcg small workspace"),
+                   9 * k * k + 3 * k + 1);
+  mag_vector_type norms(Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                                           "lobpcg residual norms"),
+                        k);
+  info_type info(Kokkos::view_alloc(space, "lobpcg small info"));
+  auto lambda_h = Kokkos::create_mirror_view(lambda);
+  auto norms_h  = Kokkos::create_mirror_view(norms);
+  auto info_h   = Kokkos::create_mirror_view(info);
+
+  const auto xcols = Kokkos::make_pair(0, k);
+  auto Xb          = Kokkos::subview(V, Kokkos::ALL, xcols);
+  auto AXb         = Kokkos::subview(AV, Kokkos::ALL, xcols);
+
+  // Orthonormal initial block
+  Kokkos::deep_copy(space, Xb, X);
+  KokkosLapack::Impl::tsqr_native(space, Xb,
+                                  Kokkos::subview(Rqr, xcols, xcols));
+  KokkosSparse::spmv(space, "N", one, A, Xb, zero, AXb);
+
+  // Columns of W and P in the basis
+  int nwp = 0;
+  for (int iter = 0;; ++iter) {
+    // Rayleigh-Ritz on the first m columns of V
+    const int m     = k + nwp;
+    const auto cols = Kokkos::make_pair(0, m);
+    const auto sel =
+        largest ? Kokkos::make_pair(m - k, m) : Kokkos::make_pair(0, k);
+    auto Vm  = Kokkos::subview(V, Kokkos::ALL, cols);
+    auto AVm = Kokkos::subview(AV, Kokkos::ALL, cols);
+    auto Gm  = Kokkos::subview(G, cols, cols);
+    auto em  = Kokkos::subview(e, cols);
+    KokkosBlas::gemm(space, "T", "N", one, Vm, AVm, zero, Gm);
+    Kokkos::parallel_for("KokkosSparse::lobpcg[small eig]",
+                         team_policy(space, 1, Kokkos::AUTO),
+                         LobpcgSmallEigFunctor<decltype(Gm), decltype(em),
+                                               vector_type, info_type>(
+                             Gm, em, work, info));
+
+    auto C = Kokkos::subview(Gm, Kokkos::ALL, sel);
+    KokkosBlas::gemm(space, "N", "N", one, Vm, C, zero, Xr);
+    KokkosBlas::gemm(space, "N", "N", one, AVm, C, zero, AXr);
+    if (nwp > 0) {
+      const auto wpcols = Kokkos::make_pair(k, m);
+      KokkosBlas::gemm(space, "N", "N", one,
+                       Kokkos::subview(V, Kokkos::ALL, wpcols),
+                       Kokkos::subview(Gm, wpcols, sel), zero, P);
+    }
+    Kokkos::deep_copy(space, Xb, Xr);
+    Kokkos::deep_copy(space, AXb, AXr);
+    Kokkos::deep_copy(space, lambda, Kokkos::subview(em, sel));
+
+    // Convergence check on the host
+    Kokkos::parallel_for("KokkosSparse::lobpcg[residuals]",
+                         range_policy(space, 0, n),
+                         LobpcgResidualFunctor<matrix_type, EVector>{
+                             Xr, AXr, lambda, R});
+    KokkosBlas::nrm2(space, norms, R);
+    Kokkos::deep_copy(space, info_h, info);
+    Kokkos::deep_copy(space, lambda_h, lambda);
+    Kokkos::deep_copy(space, norms_h, norms);
+    space.fence();
+    if (info_h() != 0) {
+      std::ostringstream os;
+      os << "KokkosSparse::lobpcg: the projected " << m << " x " << m
+         << " eigenproblem did not converge at iteration " << iter;
+      KokkosKernels::Impl::throw_runtime_exception(os.str());
+    }
+    mag_type scale = 0;
+    for (int j = 0; j < k; ++j)
+      scale = Kokkos::max(scale, Kokkos::abs(lambda_h(j)));
+    bool converged = true;
+    for (int j = 0; j < k; ++j) converged &= (norms_h(j) <= tol * scale);
+    if (converged) {
+      Kokkos::deep_copy(space, X, Xr);
+      return iter;
+    }
+    if (iter == max_iters) {
+      Kokkos::deep_copy(space, X, Xr);
+      return -1;
+    }
+
+    // New basis [X, W, P], P only after the first iteration
+    const auto wcols = Kokkos::make_pair(k, 2 * k);
+    auto Wb          = Kokkos::subview(V, Kokkos::ALL, wcols);
+    if (precond) {
+      // The preconditioner runs on the default instance
+      space.fence();
+      for (int j = 0; j < k; ++j)
+        precond->apply(Kokkos::subview(R, Kokkos::ALL, j),
+                       Kokkos::subview(Wb, Kokkos::ALL, j));
+      typename AMatrix::execution_space().fence();
+    } else {
+      Kokkos::deep_copy(space, Wb, R);
+    }
+    nwp = (iter == 0) ? k : 2 * k;
+    if (nwp == 2 * k) {
+      const auto pcols = Kokkos::make_pair(2 * k, 3 * k);
+      Kokkos::deep_copy(space, Kokkos::subview(V, Kokkos::ALL, pcols), P);
+    }
+    const auto vcols = Kokkos::make_pair(0, k + nwp);
+    KokkosLapack::Impl::tsqr_native(space,
+                                    Kokkos::subview(V, Kokkos::ALL, vcols),
+                                    Kokkos::subview(Rqr, vcols, vcols));
+    Kokkos::deep_copy(space, Xb, Xr);
+    const auto wpcols = Kokkos::make_pair(k, k + nwp);
+    KokkosSparse::spmv(space, "N", one, A,
+                       Kokkos::subview(V, Kokkos::ALL, wpcols), zero,
+                       Kokkos::subview(AV, Kokkos::ALL, wpcols));
+  }
+}
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_IMPL_LOBPCG_HPP_
@@ -0,0 +1,225 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_MATRIX_POWERS_IMPL_HPP_
+#define KOKKOSSPARSE_MATRIX_POWERS_IMPL_HPP_
+
+#include <algorithm>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "KokkosSparse_CrsMatrix.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+namespace Impl {
+
+/// Build the ghost zones of each row block of A (on host).
+///
+/// The rows of block b are its owned rows. Computing A^k x on the owned rows
+/// needs A^(k-1) x on the owned rows and their neighbors, and so on down to x
+/// itself. For each block, local_rows lists the owned rows first, followed by
+/// the rows added at each level, so the rows needed for A^k x are a prefix of
+/// length level_counts(b, k). Column indices of the rows which are computed
+/// are stored as positions in the block's local_rows.
+template <class Handle, class AMatrix>
+void matrix_powers_setup(Handle* handle, const AMatrix& A) {
+  using ordinal_type = typename AMatrix::non_const_ordinal_type;
+  using size_type    = typename AMatrix::non_const_size_type;
+
+  const int s              = handle->s;
+  const ordinal_type nrows = A.numRows();
+  const ordinal_type rpb   = handle->rows_per_block;
+  const ordinal_type nblocks =
+      nrows == 0 ? ordinal_type(0) : (nrows + rpb - 1) / rpb;
+
+  auto rowmap = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                    A.graph.row_map);
+  auto entries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                     A.graph.entries);
+
+  handle->level_counts =
+      typename Handle::level_counts_t("level counts", nblocks, s + 1);
+  auto level_counts_h = Kokkos::create_mirror_view(handle->level_counts);
+  handle->block_offsets =
+      typename Handle::offsets_t("block offsets", nblocks + 1);
+  auto block_offsets_h = Kokkos::create_mirror_view(handle->block_offsets);
+
+  std::vector<ordinal_type> local_rows;
+  std::vector<size_type> local_rowmap(1, 0);
+  std::vector<ordinal_type> local_entries;
+  std::vector<size_type> value_index;
+  // position of each row in the current block's local_rows, or -1
+  std::vector<ordinal_type> position(nrows, -1);
+
+  for (ordinal_type b = 0; b < nblocks; b++) {
+    const size_type base  = local_rows.size();
+    const ordinal_type r0 = b * rpb;
+    const ordinal_type r1 = std::min(nrows, r0 + rpb);
+    block_offsets_h(b)    = base;
+    for (ordinal_type i = r0; i < r1; i++) {
+      position[i] = local_rows.size() - base;
+      local_rows.push_back(i);
+    }
+    level_counts_h(b, s) = r1 - r0;
+    // Expand only the rows added at the previous level: the neighbors of the
+    // older ones are already in the list
+    ordinal_type expand_begin = 0;
+    for (int k = s; k > 0; k--) {
+      const ordinal_type expand_end = level_counts_h(b, k);
+      for (ordinal_type p = expand_begin; p < expand_end; p++) {
+        const ordinal_type i = local_rows[base + p];
+        for (size_type e = rowmap(i); e < rowmap(i + 1); e++) {
+          const ordinal_type j = entries(e);
+          if (position[j] < 0) {
+            position[j] = local_rows.size() - base;
+            local_rows.push_back(j);
+          }
+        }
+      }
+      level_counts_h(b, k - 1) = local_rows.size() - base;
+      expand_begin             = expand_end;
+    }
+    // Local rows of the rows that are computed (the first level_counts(b, 1))
+    const ordinal_type ncomputed = s > 0 ? level_counts_h(b, 1) : 0;
+    for (ordinal_type p = 0; p < ordinal_type(local_rows.size() - base); p++) {
+      if (p < ncomputed) {
+        const ordinal_type i = local_rows[base + p];
+        for (size_type e = rowmap(i); e < rowmap(i + 1); e++) {
+          local_entries.push_back(position[entries(e)]);
+          value_index.push_back(e);
+        }
+      }
+      local_rowmap.push_back(local_entries.size());
+    }
+    for (size_type p = base; p < local_rows.size(); p++)
+      position[local_rows[p]] = -1;
+  }
+  block_offsets_h(nblocks) = local_rows.size();
+
+  auto to_device = [](auto& d, const auto& h, const char* label) {
+    using view_t = std::remove_reference_t<decltype(d)>;
+    d            = view_t(Kokkos::view_alloc(Kokkos::WithoutInitializing,
+                                             std::string(label)),
+                          h.size());
+    Kokkos::deep_copy(
+        d, Kokkos::View<const typename view_t::value_type*, Kokkos::HostSpace,
+                        Kokkos::MemoryTraits<Kokkos::Unmanaged>>(h.data(),
+                                                                 h.size()));
+  };
+  to_device(handle->local_rows, local_rows, "local rows");
+  to_device(handle->local_rowmap, local_rowmap, "local rowmap");
+  to_device(handle->local_entries, local_entries, "local entries");
+  to_device(handle->value_index, value_index, "value index");
+  Kokkos::deep_copy(handle->level_counts, level_counts_h);
+  Kokkos::deep_copy(handle->block_offsets, block_offsets_h);
+  handle->num_blocks = nblocks;
+  handle->is_set_up  = true;
+}
+
+/// Compute V(:, k) = A^k x for k = 0..s on the owned rows of one block per
+/// work item, using two work vectors over the block's local rows.
+template <class Handle, class AMatrix, class XVector, class VMultiVector,
+          class WorkView>
+struct MatrixPowersFunctor {
+  using ordinal_type = typename AMatrix::non_const_ordinal_type;
+  using size_type    = typename AMatrix::non_const_size_type;
+  using v_value_type = typename VMultiVector::non_const_value_type;
+
+  int s;
+  AMatrix A;
+  XVector x;
+  VMultiVector V;
+  typename Handle::level_counts_t level_counts;
+  typename Handle::offsets_t block_offsets;
+  typename Handle::ordinals_t local_rows;
+  typename Handle::offsets_t local_rowmap;
+  typename Handle::ordinals_t local_entries;
+  typename Handle::offsets_t value_index;
+  WorkView work;
+
+  MatrixPowersFunctor(const Handle& handle, const AMatrix& A_,
+                      const XVector& x_, const VMultiVector& V_,
+                      const WorkView& work_)
+      : s(handle.s),
+        A(A_),
+        x(x_),
+        V(V_),
+        level_counts(handle.level_counts),
+        block_offsets(handle.block_offsets),
+        local_rows(handle.local_rows),
+        local_rowmap(handle.local_rowmap),
+        local_entries(handle.local_entries),
+        value_index(handle.value_index),
+        work(work_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type b) const {
+    const size_type base      = block_offsets(b);
+    const size_type total     = block_offsets(block_offsets.extent(0) - 1);
+    const ordinal_type nowned = level_counts(b, s);
+    v_value_type* in          = &work(base);
+    v_value_type* out         = &work(total + base);
+
+    for (ordinal_type p = 0; p < level_counts(b, 0); p++) {
+      in[p] = x(local_rows(base + p));
+      if (p < nowned) V(local_rows(base + p), 0) = in[p];
+    }
+    for (int k = 1; k <= s; k++) {
+      for (ordinal_type p = 0; p < level_counts(b, k); p++) {
+        v_value_type sum = 0;
+        for (size_type e = local_rowmap(base + p);
+             e < local_rowmap(base + p + 1); e++) {
+          sum += static_cast<v_value_type>(A.values(value_index(e))) *
+                 in[local_entries(e)];
+        }
+        out[p] = sum;
+        if (p < nowned) V(local_rows(base + p), k) = sum;
+      }
+      v_value_type* tmp = in;
+      in                = out;
+      out               = tmp;
+    }
+  }
+};
+
+template <class ExecutionSpace, class Handle, class AMatrix, class XVector,
+          class VMultiVector>
+void matrix_powers_blocked(const ExecutionSpace& space, Handle* handle,
+                           const AMatrix& A, const XVector& x,
+                           const VMultiVector& V) {
+  using v_value_type = typename VMultiVector::non_const_value_type;
+  using work_t = Kokkos::View<v_value_type*, typename AMatrix::memory_space>;
+  using ordinal_type = typename AMatrix::non_const_ordinal_type;
+
+  if (handle->num_blocks == 0) return;
+  const size_t total = handle->local_rows.extent(0);
+  work_t work(Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                                 "matrix powers work"),
+              2 * total);
+  MatrixPowersFunctor<Handle, AMatrix, XVector, VMultiVector, work_t> func(
+      *handle, A, x, V, work);
+  Kokkos::parallel_for(
+      "KokkosSparse::matrix_powers",
+      Kokkos::RangePolicy<ExecutionSpace, Kokkos::Schedule<Kokkos::Dynamic>>(
+          space, 0, ordinal_type(handle->num_blocks)),
+      func);
+}
+
+}  // namespace Impl
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_MATRIX_POWERS_IMPL_HPP_
@@ -20,6 +20,9 @@
 #include <Kokkos_Core.hpp>
 #include <Kokkos_UnorderedMap.hpp>
 #include "KokkosKernels_Sorting.hpp"
+#include "KokkosKernels_SimpleUtils.hpp"
+#include "KokkosSparse_SortCrs.hpp"
+#include "KokkosSparse_Utils.hpp"
 #include "KokkosSparse_findRelOffset.hpp"
 #include <type_traits>
 #include "Kokkos_ArithTraits.hpp"
@@ -731,6 +734,280 @@ struct MDF_compute_list_length {
   }
 };
 
+// The functors below implement the independent set variant of mdf_numeric.
+// Rows are identified by their index in A throughout, and permutation_inv(r)
+// is the step at which row r was eliminated, or -1 if it has not been yet.
+
+/// Select the rows whose (discarded fill, deficiency, degree, index) is
+/// smaller than that of all their remaining neighbors (in A and A^T). These
+/// local minima form an independent set, which always contains the row the
+/// sequential MDF would pick next.
+template <class crs_matrix_type>
+struct MDF_select_independent_set {
+  using col_ind_type = typename crs_matrix_type::StaticCrsGraphType::
+      entries_type::non_const_type;
+  using ordinal_type    = typename crs_matrix_type::ordinal_type;
+  using size_type       = typename crs_matrix_type::size_type;
+  using values_mag_type = typename MDF_types<crs_matrix_type>::values_mag_type;
+
+  crs_matrix_type A, At;
+  values_mag_type discarded_fill;
+  col_ind_type deficiency;
+  col_ind_type permutation_inv;
+  col_ind_type selected;
+
+  KOKKOS_INLINE_FUNCTION
+  bool is_before(const ordinal_type r, const ordinal_type s) const {
+    if (discarded_fill(r) != discarded_fill(s))
+      return discarded_fill(r) < discarded_fill(s);
+    if (deficiency(r) != deficiency(s)) return deficiency(r) < deficiency(s);
+    const ordinal_type degree_r = A.graph.row_map(r + 1) - A.graph.row_map(r);
+    const ordinal_type degree_s = A.graph.row_map(s + 1) - A.graph.row_map(s);
+    if (degree_r != degree_s) return degree_r < degree_s;
+    return r < s;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const ordinal_type r) const {
+    selected(r) = 0;
+    if (permutation_inv(r) >= 0) return;
+    for (size_type k = A.graph.row_map(r); k < A.graph.row_map(r + 1); k++) {
+      const ordinal_type s = A.graph.entries(k);
+      if (s != r && permutation_inv(s) < 0 && !is_before(r, s)) return;
+    }
+    for (size_type k = At.graph.row_map(r); k < At.graph.row_map(r + 1); k++) {
+      const ordinal_type s = At.graph.entries(k);
+      if (s != r && permutation_inv(s) < 0 && !is_before(r, s)) return;
+    }
+    selected(r) = 1;
+  }
+};  // MDF_select_independent_set
+
+/// Give the selected rows the next elimination steps, in increasing order of
+/// row index.
+template <class col_ind_type>
+struct MDF_number_independent_set {
+  using ordinal_type = typename col_ind_type::non_const_value_type;
+  // type used to perform the scan
+  using value_type = ordinal_type;
+
+  ordinal_type first_step;
+  col_ind_type selected;
+  col_ind_type permutation, permutation_inv;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const ordinal_type r, ordinal_type& update,
+                  const bool is_final) const {
+    if (!selected(r)) return;
+    if (is_final) {
+      permutation(first_step + update) = r;
+      permutation_inv(r)               = first_step + update;
+    }
+    ++update;
+  }
+};  // MDF_number_independent_set
+
+/// Eliminate the pivots of steps first_step to first_step + league_size - 1,
+/// one team each. The pivots are not neighbors of each other, so they neither
+/// read nor write each other's row and column, and the result is the same as
+/// eliminating them one after the other. Updates of the same entry by two
+/// pivots are combined with atomics.
+template <class crs_matrix_type>
+struct MDF_factorize_independent_set {
+  using execution_space = typename crs_matrix_type::execution_space;
+  using team_policy_t   = Kokkos::TeamPolicy<execution_space>;
+  using team_member_t   = typename team_policy_t::member_type;
+  using col_ind_type    = typename crs_matrix_type::StaticCrsGraphType::
+      entries_type::non_const_type;
+  using ordinal_type = typename crs_matrix_type::ordinal_type;
+  using size_type    = typename crs_matrix_type::size_type;
+  using value_type   = typename crs_matrix_type::value_type;
+
+  crs_matrix_type A, At;
+  col_ind_type permutation, permutation_inv;
+  ordinal_type first_step;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const team_member_t team) const {
+    const ordinal_type pivot = permutation(first_step + team.league_rank());
+    const auto rowView       = A.rowConst(pivot);
+    const auto colView       = At.rowConst(pivot);
+
+    value_type diag = Kokkos::ArithTraits<value_type>::zero();
+    Kokkos::parallel_reduce(
+        Kokkos::TeamVectorRange(team, rowView.length),
+        [&](const ordinal_type ind, value_type& running_diag) {
+          if (rowView.colidx(ind) == pivot) running_diag = rowView.value(ind);
+        },
+        Kokkos::Sum<value_type, execution_space>(diag));
+
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(team, colView.length),
+        [&](const ordinal_type alpha) {
+          const ordinal_type rowInd = colView.colidx(alpha);
+          if (rowInd == pivot || permutation_inv(rowInd) >= 0) return;
+          auto fillRowView = A.row(rowInd);
+          Kokkos::parallel_for(
+              Kokkos::ThreadVectorRange(team, rowView.length),
+              [&](const ordinal_type beta) {
+                const ordinal_type colInd = rowView.colidx(beta);
+                if (colInd == pivot || permutation_inv(colInd) >= 0) return;
+                const value_type subVal =
+                    colView.value(alpha) * rowView.value(beta) / diag;
+                for (ordinal_type gamma = 0; gamma < fillRowView.length;
+                     ++gamma) {
+                  if (fillRowView.colidx(gamma) == colInd)
+                    Kokkos::atomic_sub(&fillRowView.value(gamma), subVal);
+                }
+                auto fillColView = At.row(colInd);
+                for (ordinal_type delt = 0; delt < fillColView.length;
+                     ++delt) {
+                  if (fillColView.colidx(delt) == rowInd)
+                    Kokkos::atomic_sub(&fillColView.value(delt), subVal);
+                }
+              });
+        });
+  }
+};  // MDF_factorize_independent_set
+
+/// After the pivots of steps first_step to first_step + league_size - 1 have
+/// been eliminated: add them to permutation_set and flag their remaining
+/// neighbors, whose discarded fill has to be computed again.
+template <class crs_matrix_type>
+struct MDF_flag_neighbors {
+  using device_type  = typename crs_matrix_type::device_type;
+  using col_ind_type = typename crs_matrix_type::StaticCrsGraphType::
+      entries_type::non_const_type;
+  using ordinal_type = typename crs_matrix_type::ordinal_type;
+  using size_type    = typename crs_matrix_type::size_type;
+  using permutation_set_type =
+      Kokkos::UnorderedMap<ordinal_type, void, device_type>;
+
+  crs_matrix_type A, At;
+  col_ind_type permutation, permutation_inv;
+  permutation_set_type permutation_set;
+  col_ind_type flagged;
+  ordinal_type first_step;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const ordinal_type k) const {
+    const ordinal_type pivot = permutation(first_step + k);
+    permutation_set.insert(pivot);
+    for (size_type e = A.graph.row_map(pivot); e < A.graph.row_map(pivot + 1);
+         e++) {
+      const ordinal_type s = A.graph.entries(e);
+      if (permutation_inv(s) < 0) flagged(s) = 1;
+    }
+    for (size_type e = At.graph.row_map(pivot);
+         e < At.graph.row_map(pivot + 1); e++) {
+      const ordinal_type s = At.graph.entries(e);
+      if (permutation_inv(s) < 0) flagged(s) = 1;
+    }
+  }
+};  // MDF_flag_neighbors
+
+/// Gather the flagged rows into update_list, and clear the flags.
+template <class col_ind_type>
+struct MDF_gather_flagged {
+  using ordinal_type = typename col_ind_type::non_const_value_type;
+  // type used to perform the scan
+  using value_type = ordinal_type;
+
+  col_ind_type flagged;
+  col_ind_type update_list;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const ordinal_type r, ordinal_type& update,
+                  const bool is_final) const {
+    if (!flagged(r)) return;
+    if (is_final) {
+      update_list(update) = r;
+      flagged(r)          = 0;
+    }
+    ++update;
+  }
+};  // MDF_gather_flagged
+
+/// Count the entries of row k of U and of column k of L (with its unit
+/// diagonal), once every row has been eliminated.
+template <class crs_matrix_type>
+struct MDF_count_factors {
+  using row_map_type = typename crs_matrix_type::StaticCrsGraphType::
+      row_map_type::non_const_type;
+  using col_ind_type = typename crs_matrix_type::StaticCrsGraphType::
+      entries_type::non_const_type;
+  using ordinal_type = typename crs_matrix_type::ordinal_type;
+  using size_type    = typename crs_matrix_type::size_type;
+
+  crs_matrix_type A, At;
+  col_ind_type permutation, permutation_inv;
+  row_map_type row_mapL, row_mapU;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const ordinal_type k) const {
+    const ordinal_type pivot = permutation(k);
+    size_type nU = 0, nL = 1;
+    for (size_type e = A.graph.row_map(pivot); e < A.graph.row_map(pivot + 1);
+         e++)
+      if (permutation_inv(A.graph.entries(e)) >= k) ++nU;
+    for (size_type e = At.graph.row_map(pivot);
+         e < At.graph.row_map(pivot + 1); e++)
+      if (permutation_inv(At.graph.entries(e)) > k) ++nL;
+    row_mapU(k) = nU;
+    row_mapL(k) = nL;
+  }
+};  // MDF_count_factors
+
+/// Fill row k of U and column k of L (stored as row k of L^T), in the
+/// numbering of the elimination steps.
+template <class crs_matrix_type>
+struct MDF_fill_factors {
+  using row_map_type = typename crs_matrix_type::StaticCrsGraphType::
+      row_map_type::non_const_type;
+  using col_ind_type = typename crs_matrix_type::StaticCrsGraphType::
+      entries_type::non_const_type;
+  using values_type  = typename crs_matrix_type::values_type::non_const_type;
+  using ordinal_type = typename crs_matrix_type::ordinal_type;
+  using size_type    = typename crs_matrix_type::size_type;
+  using value_type   = typename crs_matrix_type::value_type;
+
+  crs_matrix_type A, At;
+  col_ind_type permutation, permutation_inv;
+  row_map_type row_mapL;
+  col_ind_type entriesL;
+  values_type valuesL;
+  row_map_type row_mapU;
+  col_ind_type entriesU;
+  values_type valuesU;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const ordinal_type k) const {
+    const ordinal_type pivot = permutation(k);
+    value_type diag          = Kokkos::ArithTraits<value_type>::zero();
+    size_type idxU           = row_mapU(k);
+    for (size_type e = A.graph.row_map(pivot); e < A.graph.row_map(pivot + 1);
+         e++) {
+      const ordinal_type col = permutation_inv(A.graph.entries(e));
+      if (col < k) continue;
+      if (col == k) diag = A.values(e);
+      entriesU(idxU) = col;
+      valuesU(idxU)  = A.values(e);
+      ++idxU;
+    }
+    size_type idxL  = row_mapL(k);
+    entriesL(idxL)  = k;
+    valuesL(idxL++) = Kokkos::ArithTraits<value_type>::one();
+    for (size_type e = At.graph.row_map(pivot);
+         e < At.graph.row_map(pivot + 1); e++) {
+      const ordinal_type row = permutation_inv(At.graph.entries(e));
+      if (row <= k) continue;
+      entriesL(idxL) = row;
+      valuesL(idxL)  = At.values(e) / diag;
+      ++idxL;
+    }
+  }
+};  // MDF_fill_factors
+
 template <class col_ind_type>
 struct MDF_reindex_matrix {
   col_ind_type permutation_inv;
@@ -745,6 +1022,135 @@ struct MDF_reindex_matrix {
   }
 };
 
+/// Numeric phase of MDF eliminating, at each step, the independent set of
+/// rows selected by MDF_select_independent_set instead of a single row (see
+/// MDF_handle::set_independent_set_elimination). The factors are those of
+/// the incomplete LU(0) of A in the resulting order, like for the sequential
+/// MDF.
+template <class crs_matrix_type, class MDF_handle>
+void mdf_numeric_independent_set(const crs_matrix_type& A,
+                                 MDF_handle& handle) {
+  using col_ind_type = typename crs_matrix_type::StaticCrsGraphType::
+      entries_type::non_const_type;
+  using values_mag_type = typename MDF_types<crs_matrix_type>::values_mag_type;
+  using ordinal_type    = typename crs_matrix_type::ordinal_type;
+  using size_type       = typename crs_matrix_type::non_const_size_type;
+  using value_mag_type  = typename values_mag_type::value_type;
+
+  using device_type       = typename crs_matrix_type::device_type;
+  using execution_space   = typename crs_matrix_type::execution_space;
+  using range_policy_type = Kokkos::RangePolicy<ordinal_type, execution_space>;
+  using team_range_policy_type = Kokkos::TeamPolicy<execution_space>;
+
+  using permutation_set_type =
+      Kokkos::UnorderedMap<ordinal_type, void, device_type>;
+
+  const int verbosity_level  = handle.verbosity;
+  const ordinal_type numRows = A.numRows();
+  crs_matrix_type Atmp       = crs_matrix_type("A fill", A);
+  crs_matrix_type At =
+      KokkosSparse::Impl::sorted_transpose_matrix<crs_matrix_type>(A);
+  values_mag_type discarded_fill("discarded fill", numRows);
+  col_ind_type deficiency("deficiency", numRows);
+  col_ind_type selected("selected rows", numRows);
+  col_ind_type flagged("flagged rows", numRows);
+  col_ind_type update_list("update list", numRows);
+  permutation_set_type permutation_set(numRows);
+  Kokkos::deep_copy(discarded_fill, Kokkos::ArithTraits<value_mag_type>::max());
+  Kokkos::deep_copy(deficiency, Kokkos::ArithTraits<ordinal_type>::max());
+  Kokkos::deep_copy(handle.permutation_inv, ordinal_type(-1));
+
+  // MDF_discarded_fill_norm reads the rows to update through a permutation:
+  // here the rows are not renumbered, so it is the identity
+  col_ind_type identity("identity", numRows);
+  Kokkos::parallel_for(
+      "MDF: identity", range_policy_type(0, numRows),
+      KOKKOS_LAMBDA(const ordinal_type r) { identity(r) = r; });
+  MDF_discarded_fill_norm<crs_matrix_type, true> MDF_df_norm(
+      Atmp, At, 0, identity, permutation_set, discarded_fill, deficiency,
+      verbosity_level);
+  Kokkos::parallel_for(
+      "MDF: initial fill computation",
+      team_range_policy_type(numRows, Kokkos::AUTO, Kokkos::AUTO), MDF_df_norm);
+
+  ordinal_type numEliminated = 0;
+  handle.num_steps           = 0;
+  while (numEliminated < numRows) {
+    Kokkos::parallel_for(
+        "MDF: select independent set", range_policy_type(0, numRows),
+        MDF_select_independent_set<crs_matrix_type>{
+            Atmp, At, discarded_fill, deficiency, handle.permutation_inv,
+            selected});
+    ordinal_type numSelected = 0;
+    Kokkos::parallel_scan(
+        "MDF: number independent set", range_policy_type(0, numRows),
+        MDF_number_independent_set<col_ind_type>{numEliminated, selected,
+                                                 handle.permutation,
+                                                 handle.permutation_inv},
+        numSelected);
+    if (verbosity_level > 0) {
+      printf("MDF step %d: eliminating %d rows\n",
+             static_cast<int>(handle.num_steps),
+             static_cast<int>(numSelected));
+    }
+
+    Kokkos::parallel_for(
+        "MDF: factorize independent set",
+        team_range_policy_type(numSelected, Kokkos::AUTO, Kokkos::AUTO),
+        MDF_factorize_independent_set<crs_matrix_type>{
+            Atmp, At, handle.permutation, handle.permutation_inv,
+            numEliminated});
+    Kokkos::parallel_for(
+        "MDF: flag neighbors", range_policy_type(0, numSelected),
+        MDF_flag_neighbors<crs_matrix_type>{
+            Atmp, At, handle.permutation, handle.permutation_inv,
+            permutation_set, flagged, numEliminated});
+    numEliminated += numSelected;
+    ++handle.num_steps;
+
+    ordinal_type update_list_len = 0;
+    Kokkos::parallel_scan(
+        "MDF: gather update list", range_policy_type(0, numRows),
+        MDF_gather_flagged<col_ind_type>{flagged, update_list},
+        update_list_len);
+    if (update_list_len > 0) {
+      MDF_discarded_fill_norm<crs_matrix_type, false> MDF_update_df_norm(
+          Atmp, At, 0, identity, permutation_set, discarded_fill, deficiency,
+          verbosity_level, update_list);
+      Kokkos::parallel_for(
+          "MDF: updating fill norms",
+          team_range_policy_type(update_list_len, Kokkos::AUTO, Kokkos::AUTO),
+          MDF_update_df_norm);
+    }
+  }
+
+  // Build U by rows and L by columns, in the order of elimination. The
+  // number of entries of each depends on the order, so they are counted
+  // again rather than taken from mdf_symbolic.
+  typename MDF_handle::row_map_type countsL("MDF counts L", numRows + 1);
+  typename MDF_handle::row_map_type countsU("MDF counts U", numRows + 1);
+  Kokkos::parallel_for("MDF: count factors", range_policy_type(0, numRows),
+                       MDF_count_factors<crs_matrix_type>{
+                           Atmp, At, handle.permutation,
+                           handle.permutation_inv, countsL, countsU});
+  size_type nnzL = 0, nnzU = 0;
+  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum<execution_space>(
+      numRows + 1, countsL, nnzL);
+  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum<execution_space>(
+      numRows + 1, countsU, nnzU);
+  handle.allocate_data(nnzL, nnzU);
+  Kokkos::deep_copy(handle.row_mapL, countsL);
+  Kokkos::deep_copy(handle.row_mapU, countsU);
+  Kokkos::parallel_for(
+      "MDF: fill factors", range_policy_type(0, numRows),
+      MDF_fill_factors<crs_matrix_type>{
+          Atmp, At, handle.permutation, handle.permutation_inv,
+          handle.row_mapL, handle.entriesL, handle.valuesL, handle.row_mapU,
+          handle.entriesU, handle.valuesU});
+
+  handle.L = KokkosSparse::Impl::transpose_matrix<crs_matrix_type>(handle.L);
+}
+
 }  // namespace Impl
 }  // namespace KokkosSparse
 #endif  // KOKKOSSPARSE_MDF_IMPL_HPP_
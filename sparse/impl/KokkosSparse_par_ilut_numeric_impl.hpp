@@ -28,7 +28,9 @@
 #include <KokkosSparse_Utils.hpp>
 #include <KokkosSparse_SortCrs.hpp>
 #include <KokkosKernels_Utils.hpp>
+#include <KokkosKernels_Error.hpp>
 
+#include <algorithm>
 #include <limits>
 
 namespace KokkosSparse {
@@ -57,11 +59,11 @@ struct IlutWrap {
    * return the total sum.
    */
   template <class RowMapType>
-  static size_type prefix_sum(RowMapType& row_map) {
+  static size_type prefix_sum(const execution_space& exec,
+                              RowMapType& row_map) {
     size_type result = 0;
-    KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum<
-        typename IlutHandle::HandleExecSpace>(row_map.extent(0), row_map,
-                                              result);
+    KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum(
+        exec, row_map.extent(0), row_map, result);
     return result;
   }
 
@@ -73,7 +75,8 @@ struct IlutWrap {
             class UValuesType, class LURowMapType, class LUEntriesType,
             class LUValuesType>
   static void multiply_matrices(
-      KHandle& kh, IlutHandle& ih, const LRowMapType& L_row_map,
+      const execution_space& exec, KHandle& kh, IlutHandle& ih,
+      const LRowMapType& L_row_map,
       const LEntriesType& L_entries, const LValuesType& L_values,
       const URowMapType& U_row_map, const UEntriesType& U_entries,
       const UValuesType& U_values, LURowMapType& LU_row_map,
@@ -86,49 +89,45 @@ struct IlutWrap {
     const size_type nrows = ih.get_nrows();
 
     KokkosSparse::Experimental::spgemm_symbolic(
-        &kh, nrows, nrows, nrows, L_row_map, L_entries, false, U_row_map,
+        exec, &kh, nrows, nrows, nrows, L_row_map, L_entries, false, U_row_map,
         U_entries, false, LU_row_map);
 
     const size_type lu_nnz_size = kh.get_spgemm_handle()->get_c_nnz();
-    Kokkos::resize(LU_entries, lu_nnz_size);
-    Kokkos::resize(LU_values, lu_nnz_size);
+    Kokkos::resize(exec, LU_entries, lu_nnz_size);
+    Kokkos::resize(exec, LU_values, lu_nnz_size);
 
     KokkosSparse::Experimental::spgemm_numeric(
-        &kh, nrows, nrows, nrows, L_row_map, L_entries, L_values, false,
+        exec, &kh, nrows, nrows, nrows, L_row_map, L_entries, L_values, false,
         U_row_map, U_entries, U_values, false, LU_row_map, LU_entries,
         LU_values);
 
     // Need to sort LU CRS if on CUDA!
-    sort_crs_matrix<execution_space>(LU_row_map, LU_entries, LU_values);
+    sort_crs_matrix(exec, LU_row_map, LU_entries, LU_values);
 
     kh.destroy_spgemm_handle();
   }
 
   /**
-   * Just a convenience wrapper around transpose_matrix
+   * Just a convenience wrapper around sorted_transpose_matrix
    */
   template <class RowMapType, class EntriesType, class ValuesType,
             class TRowMapType, class TEntriesType, class TValuesType>
-  static void transpose_wrap(IlutHandle& ih, const RowMapType& row_map,
+  static void transpose_wrap(const execution_space& exec, IlutHandle& ih,
+                             const RowMapType& row_map,
                              const EntriesType& entries,
                              const ValuesType& values, TRowMapType& t_row_map,
                              TEntriesType& t_entries, TValuesType& t_values) {
     const size_type nrows = ih.get_nrows();
 
-    // Need to reset t_row_map
-    Kokkos::deep_copy(t_row_map, 0);
+    Kokkos::resize(exec, t_entries, entries.extent(0));
+    Kokkos::resize(exec, t_values, values.extent(0));
 
-    Kokkos::resize(t_entries, entries.extent(0));
-    Kokkos::resize(t_values, values.extent(0));
-
-    KokkosSparse::Impl::transpose_matrix<
+    // The rows of the transpose come out sorted
+    KokkosSparse::Impl::sorted_transpose_matrix<
         HandleDeviceRowMapType, HandleDeviceEntriesType, HandleDeviceValueType,
         HandleDeviceRowMapType, HandleDeviceEntriesType, HandleDeviceValueType,
-        HandleDeviceRowMapType, execution_space>(
-        nrows, nrows, row_map, entries, values, t_row_map, t_entries, t_values);
-
-    // Need to ensure output is sorted
-    sort_crs_matrix<execution_space>(t_row_map, t_entries, t_values);
+        execution_space>(exec, nrows, nrows, row_map, entries, values,
+                         t_row_map, t_entries, t_values);
   }
 
   /**
@@ -143,7 +142,7 @@ struct IlutWrap {
             class LNewRowMapType, class LNewEntriesType, class LNewValuesType,
             class UNewRowMapType, class UNewEntriesType, class UNewValuesType>
   static void add_candidates(
-      IlutHandle& ih, const ARowMapType& A_row_map,
+      const execution_space& exec, IlutHandle& ih, const ARowMapType& A_row_map,
       const AEntriesType& A_entries, const AValuesType& A_values,
       const LRowMapType& L_row_map, const LEntriesType& L_entries,
       const LValuesType& L_values, const URowMapType& U_row_map,
@@ -155,7 +154,7 @@ struct IlutWrap {
       UNewValuesType& U_new_values) {
     const size_type nrows = ih.get_nrows();
 
-    const policy_type policy = ih.get_default_team_policy();
+    const policy_type policy = ih.get_default_team_policy(exec);
 
     // Sizing run for add_candidates. Count nnz's and remove dupes
     Kokkos::parallel_for(
@@ -254,20 +253,20 @@ struct IlutWrap {
         });
 
     // prefix sum
-    const size_type l_new_nnz_tot = prefix_sum(L_new_row_map);
-    const size_type u_new_nnz_tot = prefix_sum(U_new_row_map);
+    const size_type l_new_nnz_tot = prefix_sum(exec, L_new_row_map);
+    const size_type u_new_nnz_tot = prefix_sum(exec, U_new_row_map);
 
-    Kokkos::resize(L_new_entries, l_new_nnz_tot);
-    Kokkos::resize(U_new_entries, u_new_nnz_tot);
-    Kokkos::resize(L_new_values, l_new_nnz_tot);
-    Kokkos::resize(U_new_values, u_new_nnz_tot);
+    Kokkos::resize(exec, L_new_entries, l_new_nnz_tot);
+    Kokkos::resize(exec, U_new_entries, u_new_nnz_tot);
+    Kokkos::resize(exec, L_new_values, l_new_nnz_tot);
+    Kokkos::resize(exec, U_new_values, u_new_nnz_tot);
 
     constexpr auto sentinel = std::numeric_limits<size_type>::max();
 
     // Now compute the actual candidate values
     Kokkos::parallel_for(
         "add_candidates",
-        range_policy(0, nrows),  // No team level parallelism in this alg
+        range_policy(exec, 0, nrows),  // No team level parallelism in this alg
         KOKKOS_LAMBDA(const size_type row_idx) {
           auto a_row_nnz_begin     = A_row_map(row_idx);
           const auto a_row_nnz_end = A_row_map(row_idx + 1);
@@ -447,7 +446,7 @@ struct IlutWrap {
             class UValuesType, class UtRowMapType, class UtEntriesType,
             class UtValuesType>
   static void compute_l_u_factors_impl(
-      IlutHandle& ih, const ARowMapType& A_row_map,
+      const execution_space& exec, IlutHandle& ih, const ARowMapType& A_row_map,
       const AEntriesType& A_entries, const AValuesType& A_values,
       LRowMapType& L_row_map, LEntriesType& L_entries, LValuesType& L_values,
       URowMapType& U_row_map, UEntriesType& U_entries, UValuesType& U_values,
@@ -469,7 +468,7 @@ struct IlutWrap {
 
     const size_type nrows = ih.get_nrows();
     Kokkos::parallel_for(
-        "compute_l_u_factors", range_policy(0, nrows),
+        "compute_l_u_factors", range_policy(exec, 0, nrows),
         KOKKOS_LAMBDA(const size_type row_idx) {
           const auto l_row_nnz_begin = L_row_map(row_idx);
           const auto l_row_nnz_end =
@@ -516,20 +515,22 @@ struct IlutWrap {
             class URowMapType, class UEntriesType, class UValuesType,
             class UtRowMapType, class UtEntriesType, class UtValuesType>
   static void compute_l_u_factors(
-      IlutHandle& ih, const ARowMapType& A_row_map,
+      const execution_space& exec, IlutHandle& ih, const ARowMapType& A_row_map,
       const AEntriesType& A_entries, const AValuesType& A_values,
       LRowMapType& L_row_map, LEntriesType& L_entries, LValuesType& L_values,
       URowMapType& U_row_map, UEntriesType& U_entries, UValuesType& U_values,
       UtRowMapType& Ut_row_map, UtEntriesType& Ut_entries,
       UtValuesType& Ut_values, const bool async_update) {
     if (async_update) {
-      compute_l_u_factors_impl<true>(
-          ih, A_row_map, A_entries, A_values, L_row_map, L_entries, L_values,
-          U_row_map, U_entries, U_values, Ut_row_map, Ut_entries, Ut_values);
+      compute_l_u_factors_impl<true>(exec, ih, A_row_map, A_entries, A_values,
+                                     L_row_map, L_entries, L_values, U_row_map,
+                                     U_entries, U_values, Ut_row_map,
+                                     Ut_entries, Ut_values);
     } else {
-      compute_l_u_factors_impl<false>(
-          ih, A_row_map, A_entries, A_values, L_row_map, L_entries, L_values,
-          U_row_map, U_entries, U_values, Ut_row_map, Ut_entries, Ut_values);
+      compute_l_u_factors_impl<false>(exec, ih, A_row_map, A_entries, A_values,
+                                      L_row_map, L_entries, L_values, U_row_map,
+                                      U_entries, U_values, Ut_row_map,
+                                      Ut_entries, Ut_values);
     }
   }
 
@@ -538,12 +539,13 @@ struct IlutWrap {
    */
   template <class ValuesType, class ValuesCopyType>
   static typename IlutHandle::float_t threshold_select(
-      ValuesType& values, const typename IlutHandle::nnz_lno_t rank,
-      ValuesCopyType& values_copy) {
+      const execution_space& exec, ValuesType& values,
+      const typename IlutHandle::nnz_lno_t rank, ValuesCopyType& values_copy) {
     const index_t size = values.extent(0);
 
     Kokkos::resize(values_copy, size);
-    Kokkos::deep_copy(values_copy, values);
+    Kokkos::deep_copy(exec, values_copy, values);
+    exec.fence();
 
     auto begin  = values_copy.data();
     auto target = begin + rank;
@@ -647,14 +649,14 @@ struct IlutWrap {
    */
   template <class IRowMapType, class IEntriesType, class IValuesType,
             class ORowMapType, class OEntriesType, class OValuesType>
-  static void threshold_filter(IlutHandle& ih,
+  static void threshold_filter(const execution_space& exec, IlutHandle& ih,
                                const typename IlutHandle::float_t threshold,
                                const IRowMapType& I_row_map,
                                const IEntriesType& I_entries,
                                const IValuesType& I_values,
                                ORowMapType& O_row_map, OEntriesType& O_entries,
                                OValuesType& O_values) {
-    const auto policy     = ih.get_default_team_policy();
+    const auto policy     = ih.get_default_team_policy(exec);
     const size_type nrows = ih.get_nrows();
 
     Kokkos::parallel_for(
@@ -663,13 +665,13 @@ struct IlutWrap {
                                     ORowMapType>(
             threshold, I_row_map, I_entries, I_values, O_row_map));
 
-    const auto new_nnz = prefix_sum(O_row_map);
+    const auto new_nnz = prefix_sum(exec, O_row_map);
 
-    Kokkos::resize(O_entries, new_nnz);
-    Kokkos::resize(O_values, new_nnz);
+    Kokkos::resize(exec, O_entries, new_nnz);
+    Kokkos::resize(exec, O_values, new_nnz);
 
     Kokkos::parallel_for(
-        "threshold_filter assign", range_policy(0, nrows),
+        "threshold_filter assign", range_policy(exec, 0, nrows),
         ThresholdFilterAssignFunctor<IRowMapType, IEntriesType, IValuesType,
                                      ORowMapType, OEntriesType, OValuesType>(
             threshold, I_row_map, I_entries, I_values, O_row_map, O_entries,
@@ -686,7 +688,8 @@ struct IlutWrap {
             class RValuesType, class LURowMapType, class LUEntriesType,
             class LUValuesType>
   static typename IlutHandle::nnz_scalar_t compute_residual_norm(
-      KHandle& kh, IlutHandle& ih, const ARowMapType& A_row_map,
+      const execution_space& exec, KHandle& kh, IlutHandle& ih,
+      const ARowMapType& A_row_map,
       const AEntriesType& A_entries, const AValuesType& A_values,
       const LRowMapType& L_row_map, const LEntriesType& L_entries,
       const LValuesType& L_values, const URowMapType& U_row_map,
@@ -696,15 +699,12 @@ struct IlutWrap {
       LUValuesType& LU_values) {
     scalar_t result;
 
-    multiply_matrices(kh, ih, L_row_map, L_entries, L_values, U_row_map,
+    multiply_matrices(exec, kh, ih, L_row_map, L_entries, L_values, U_row_map,
                       U_entries, U_values, LU_row_map, LU_entries, LU_values);
 
     auto addHandle                      = kh.get_spadd_handle();
     typename KHandle::const_nnz_lno_t m = A_row_map.extent(0) - 1,
                                       n = m;  // square matrix
-    // TODO: let compute_residual_norm also take an execution space argument and
-    // use that for exec!
-    typename KHandle::HandleExecSpace exec{};
     KokkosSparse::Experimental::spadd_symbolic(exec, &kh, m, n, A_row_map,
                                                A_entries, LU_row_map,
                                                LU_entries, R_row_map);
@@ -716,8 +716,7 @@ struct IlutWrap {
     KokkosSparse::Experimental::spadd_numeric(
         exec, &kh, m, n, A_row_map, A_entries, A_values, 1., LU_row_map,
         LU_entries, LU_values, -1., R_row_map, R_entries, R_values);
-    // TODO: how to make this policy use exec?
-    auto policy = ih.get_default_team_policy();
+    auto policy = ih.get_default_team_policy(exec);
 
     Kokkos::parallel_reduce(
         "compute_residual_norm", policy,
@@ -761,7 +760,7 @@ struct IlutWrap {
             class LRowMapType, class LEntriesType, class LValuesType,
             class URowMapType, class UEntriesType, class UValuesType>
   static void initialize_LU(
-      IlutHandle& ih, const ARowMapType& A_row_map,
+      const execution_space& exec, IlutHandle& ih, const ARowMapType& A_row_map,
       const AEntriesType& A_entries, const AValuesType& A_values,
       const LRowMapType& L_row_map, const LEntriesType& L_entries,
       const LValuesType& L_values, const URowMapType& U_row_map,
@@ -770,7 +769,7 @@ struct IlutWrap {
 
     Kokkos::parallel_for(
         "approx LU values",
-        range_policy(0, nrows),  // No team level parallelism in this alg
+        range_policy(exec, 0, nrows),  // No team level parallelism in this alg
         KOKKOS_LAMBDA(const index_t& row_idx) {
           const auto row_nnz_begin = A_row_map(row_idx);
           const auto row_nnz_end   = A_row_map(row_idx + 1);
@@ -818,8 +817,8 @@ struct IlutWrap {
             class AValuesType, class LRowMapType, class LEntriesType,
             class LValuesType, class URowMapType, class UEntriesType,
             class UValuesType>
-  static void ilut_numeric(KHandle& kh, IlutHandle& thandle,
-                           const ARowMapType& A_row_map,
+  static void ilut_numeric(const execution_space& exec, KHandle& kh,
+                           IlutHandle& thandle, const ARowMapType& A_row_map,
                            const AEntriesType& A_entries,
                            const AValuesType& A_values, LRowMapType& L_row_map,
                            LEntriesType& L_entries, LValuesType& L_values,
@@ -835,7 +834,28 @@ struct IlutWrap {
 
     const auto residual_norm_delta_stop =
         thandle.get_residual_norm_delta_stop();
-    const size_type max_iter = thandle.get_max_iter();
+
+    // A warm start continues the iterations from the L and U of the previous
+    // call, which the caller passes back in
+    const bool warm_start =
+        thandle.get_warm_start() && thandle.is_numeric_complete();
+    if (warm_start && nrows > 0) {
+      size_type l_nnz = 0, u_nnz = 0;
+      Kokkos::deep_copy(exec, l_nnz, Kokkos::subview(L_row_map, nrows));
+      Kokkos::deep_copy(exec, u_nnz, Kokkos::subview(U_row_map, nrows));
+      exec.fence();
+      const size_t l_size = l_nnz, u_size = u_nnz;
+      KK_REQUIRE_MSG(l_size == L_entries.extent(0) &&
+                         l_size == L_values.extent(0) &&
+                         u_size == U_entries.extent(0) &&
+                         u_size == U_values.extent(0),
+                     "par_ilut_numeric: a warm start needs the L and U of the "
+                     "previous par_ilut_numeric call");
+    }
+    const size_type max_iter =
+        warm_start ? std::min<size_type>(thandle.get_max_iter(),
+                                         thandle.get_warm_start_max_iter())
+                   : thandle.get_max_iter();
 
     const auto verbose      = thandle.get_verbose();
     const auto async_update = false;  // thandle.get_async_update();
@@ -848,6 +868,7 @@ struct IlutWrap {
       std::cout << "  res_norm_delta_stop: " << residual_norm_delta_stop
                 << std::endl;
       std::cout << "  async_update:        " << async_update << std::endl;
+      std::cout << "  warm_start:          " << warm_start << std::endl;
     }
 
     kh.create_spadd_handle(true /*we expect inputs to be sorted*/);
@@ -856,17 +877,18 @@ struct IlutWrap {
     // temporary workspaces and scalars
     //
     HandleDeviceRowMapType LU_row_map(
-        Kokkos::view_alloc(Kokkos::WithoutInitializing, "LU_row_map"),
+        Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "LU_row_map"),
         nrows + 1),
-        L_new_row_map(
-            Kokkos::view_alloc(Kokkos::WithoutInitializing, "L_new_row_map"),
-            nrows + 1),
-        U_new_row_map(
-            Kokkos::view_alloc(Kokkos::WithoutInitializing, "U_new_row_map"),
-            nrows + 1),
-        R_row_map(Kokkos::view_alloc(Kokkos::WithoutInitializing, "R_row_map"),
+        L_new_row_map(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing,
+                                         "L_new_row_map"),
+                      nrows + 1),
+        U_new_row_map(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing,
+                                         "U_new_row_map"),
+                      nrows + 1),
+        R_row_map(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing,
+                                     "R_row_map"),
                   nrows + 1),
-        Ut_new_row_map("Ut_new_row_map", nrows + 1);
+        Ut_new_row_map(Kokkos::view_alloc(exec, "Ut_new_row_map"), nrows + 1);
 
     HandleDeviceEntriesType LU_entries, L_new_entries, U_new_entries,
         Ut_new_entries, R_entries;
@@ -878,9 +900,12 @@ struct IlutWrap {
     scalar_t curr_residual = std::numeric_limits<scalar_t>::max();
     scalar_t prev_residual = std::numeric_limits<scalar_t>::max();
 
-    // Set the initial L/U values for the initial approximation
-    initialize_LU(thandle, A_row_map, A_entries, A_values, L_row_map, L_entries,
-                  L_values, U_row_map, U_entries, U_values);
+    // Set the initial L/U values for the initial approximation, unless
+    // warm-starting from the previous factors
+    if (!warm_start) {
+      initialize_LU(exec, thandle, A_row_map, A_entries, A_values, L_row_map,
+                    L_entries, L_values, U_row_map, U_entries, U_values);
+    }
 
     //
     // main loop
@@ -889,27 +914,29 @@ struct IlutWrap {
     while (!stop && itr < max_iter) {
       // LU = L*U
       if (prev_residual == std::numeric_limits<scalar_t>::max()) {
-        multiply_matrices(kh, thandle, L_row_map, L_entries, L_values,
+        multiply_matrices(exec, kh, thandle, L_row_map, L_entries, L_values,
                           U_row_map, U_entries, U_values, LU_row_map,
                           LU_entries, LU_values);
       }
 
       // Identify candidate locations and add them
-      add_candidates(thandle, A_row_map, A_entries, A_values, L_row_map,
+      add_candidates(exec, thandle, A_row_map, A_entries, A_values, L_row_map,
                      L_entries, L_values, U_row_map, U_entries, U_values,
                      LU_row_map, LU_entries, LU_values, L_new_row_map,
                      L_new_entries, L_new_values, U_new_row_map, U_new_entries,
                      U_new_values);
 
       // Get transpose of U_new, needed for compute_l_u_factors
-      transpose_wrap(thandle, U_new_row_map, U_new_entries, U_new_values,
-                     Ut_new_row_map, Ut_new_entries, Ut_new_values);
+      transpose_wrap(exec, thandle, U_new_row_map, U_new_entries,
+                     U_new_values, Ut_new_row_map, Ut_new_entries,
+                     Ut_new_values);
 
       // Do one sweep of the fixed-point ILU algorithm
-      compute_l_u_factors(
-          thandle, A_row_map, A_entries, A_values, L_new_row_map, L_new_entries,
-          L_new_values, U_new_row_map, U_new_entries, U_new_values,
-          Ut_new_row_map, Ut_new_entries, Ut_new_values, async_update);
+      compute_l_u_factors(exec, thandle, A_row_map, A_entries, A_values,
+                          L_new_row_map, L_new_entries, L_new_values,
+                          U_new_row_map, U_new_entries, U_new_values,
+                          Ut_new_row_map, Ut_new_entries, Ut_new_values,
+                          async_update);
 
       // Filter smallest elements from L_new and U_new. Store result back
       // in L and U.
@@ -923,34 +950,36 @@ struct IlutWrap {
             std::max(static_cast<index_t>(0), u_nnz - u_nnz_limit - 1);
 
         const auto l_threshold =
-            threshold_select(L_new_values, l_filter_rank, V_copy);
+            threshold_select(exec, L_new_values, l_filter_rank, V_copy);
         const auto u_threshold =
-            threshold_select(U_new_values, u_filter_rank, V_copy);
+            threshold_select(exec, U_new_values, u_filter_rank, V_copy);
 
-        threshold_filter(thandle, l_threshold, L_new_row_map, L_new_entries,
-                         L_new_values, L_row_map, L_entries, L_values);
+        threshold_filter(exec, thandle, l_threshold, L_new_row_map,
+                         L_new_entries, L_new_values, L_row_map, L_entries,
+                         L_values);
 
-        threshold_filter(thandle, u_threshold, U_new_row_map, U_new_entries,
-                         U_new_values, U_row_map, U_entries, U_values);
+        threshold_filter(exec, thandle, u_threshold, U_new_row_map,
+                         U_new_entries, U_new_values, U_row_map, U_entries,
+                         U_values);
       }
 
       // Get transpose of U, needed for compute_l_u_factors. Store in Ut_new*
       // since we aren't using those temporaries anymore
-      transpose_wrap(thandle, U_row_map, U_entries, U_values, Ut_new_row_map,
-                     Ut_new_entries, Ut_new_values);
+      transpose_wrap(exec, thandle, U_row_map, U_entries, U_values,
+                     Ut_new_row_map, Ut_new_entries, Ut_new_values);
 
       // Do one sweep of the fixed-point ILU algorithm
-      compute_l_u_factors(thandle, A_row_map, A_entries, A_values, L_row_map,
-                          L_entries, L_values, U_row_map, U_entries, U_values,
-                          Ut_new_row_map, Ut_new_entries, Ut_new_values,
-                          async_update);
+      compute_l_u_factors(exec, thandle, A_row_map, A_entries, A_values,
+                          L_row_map, L_entries, L_values, U_row_map, U_entries,
+                          U_values, Ut_new_row_map, Ut_new_entries,
+                          Ut_new_values, async_update);
 
       // Compute residual and check stop conditions
       {
         curr_residual = compute_residual_norm(
-            kh, thandle, A_row_map, A_entries, A_values, L_row_map, L_entries,
-            L_values, U_row_map, U_entries, U_values, R_row_map, R_entries,
-            R_values, LU_row_map, LU_entries, LU_values);
+            exec, kh, thandle, A_row_map, A_entries, A_values, L_row_map,
+            L_entries, L_values, U_row_map, U_entries, U_values, R_row_map,
+            R_entries, R_values, LU_row_map, LU_entries, LU_values);
 
         if (verbose) {
           std::cout << "Completed itr " << itr
@@ -979,6 +1008,7 @@ struct IlutWrap {
                 << curr_residual << std::endl;
     }
     thandle.set_stats(itr, curr_residual);
+    thandle.set_numeric_complete();
 
     kh.destroy_spadd_handle();
   }  // end ilut_numeric
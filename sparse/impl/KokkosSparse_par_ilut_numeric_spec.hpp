@@ -108,13 +108,12 @@ template <class KernelHandle, class ARowMapType, class AEntriesType,
               LEntriesType, LValuesType, URowMapType, UEntriesType,
               UValuesType>::value>
 struct PAR_ILUT_NUMERIC {
-  static void par_ilut_numeric(KernelHandle *handle,
-                               const ARowMapType &A_row_map,
-                               const AEntriesType &A_entries,
-                               const AValuesType &A_values,
-                               LRowMapType &L_row_map, LEntriesType &L_entries,
-                               LValuesType &L_values, URowMapType &U_row_map,
-                               UEntriesType &U_entries, UValuesType &U_values);
+  static void par_ilut_numeric(
+      const typename KernelHandle::HandleExecSpace &space,
+      KernelHandle *handle, const ARowMapType &A_row_map,
+      const AEntriesType &A_entries, const AValuesType &A_values,
+      LRowMapType &L_row_map, LEntriesType &L_entries, LValuesType &L_values,
+      URowMapType &U_row_map, UEntriesType &U_entries, UValuesType &U_values);
 };
 
 #if !defined(KOKKOSKERNELS_ETI_ONLY) || KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
@@ -128,20 +127,24 @@ struct PAR_ILUT_NUMERIC<KernelHandle, ARowMapType, AEntriesType, AValuesType,
                         LRowMapType, LEntriesType, LValuesType, URowMapType,
                         UEntriesType, UValuesType, false,
                         KOKKOSKERNELS_IMPL_COMPILE_LIBRARY> {
-  static void par_ilut_numeric(KernelHandle *handle,
-                               const ARowMapType &A_row_map,
-                               const AEntriesType &A_entries,
-                               const AValuesType &A_values,
-                               LRowMapType &L_row_map, LEntriesType &L_entries,
-                               LValuesType &L_values, URowMapType &U_row_map,
-                               UEntriesType &U_entries, UValuesType &U_values) {
+  static void par_ilut_numeric(
+      const typename KernelHandle::HandleExecSpace &space,
+      KernelHandle *handle, const ARowMapType &A_row_map,
+      const AEntriesType &A_entries, const AValuesType &A_values,
+      LRowMapType &L_row_map, LEntriesType &L_entries, LValuesType &L_values,
+      URowMapType &U_row_map, UEntriesType &U_entries, UValuesType &U_values) {
+    Kokkos::Profiling::pushRegion(
+        KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+            ? "KokkosSparse::par_ilut_numeric[ETI]"
+            : "KokkosSparse::par_ilut_numeric[noETI]");
     auto par_ilut_handle = handle->get_par_ilut_handle();
     using Ilut           = Experimental::IlutWrap<
         typename std::remove_pointer<decltype(par_ilut_handle)>::type>;
 
-    Ilut::ilut_numeric(*handle, *par_ilut_handle, A_row_map, A_entries,
+    Ilut::ilut_numeric(space, *handle, *par_ilut_handle, A_row_map, A_entries,
                        A_values, L_row_map, L_entries, L_values, U_row_map,
                        U_entries, U_values);
+    Kokkos::Profiling::popRegion();
   }
 };
 
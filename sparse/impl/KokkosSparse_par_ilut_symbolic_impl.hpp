@@ -33,9 +33,10 @@ namespace KokkosSparse {
 namespace Impl {
 namespace Experimental {
 
-template <class IlutHandle, class ARowMapType, class AEntriesType,
-          class LRowMapType, class URowMapType>
-void ilut_symbolic(IlutHandle& thandle, const ARowMapType& A_row_map_d,
+template <class ExecutionSpace, class IlutHandle, class ARowMapType,
+          class AEntriesType, class LRowMapType, class URowMapType>
+void ilut_symbolic(const ExecutionSpace& exec, IlutHandle& thandle,
+                   const ARowMapType& A_row_map_d,
                    const AEntriesType& A_entries_d, LRowMapType& L_row_map_d,
                    URowMapType& U_row_map_d) {
   using execution_space = typename ARowMapType::execution_space;
@@ -48,7 +49,7 @@ void ilut_symbolic(IlutHandle& thandle, const ARowMapType& A_row_map_d,
   const size_type nrows   = a_nrows > 0 ? (a_nrows - 1) : 0;
   thandle.set_nrows(nrows);
 
-  const auto policy = thandle.get_default_team_policy();
+  const auto policy = thandle.get_default_team_policy(exec);
 
   // Sizing for the initial L/U approximation
   Kokkos::parallel_for(
@@ -84,13 +85,14 @@ void ilut_symbolic(IlutHandle& thandle, const ARowMapType& A_row_map_d,
         });
       });
 
-  const size_type nnzsL = Ilut::prefix_sum(L_row_map_d);
-  const size_type nnzsU = Ilut::prefix_sum(U_row_map_d);
+  const size_type nnzsL = Ilut::prefix_sum(exec, L_row_map_d);
+  const size_type nnzsU = Ilut::prefix_sum(exec, U_row_map_d);
 
   // Set symbolic info on handle
   thandle.set_nnzL(nnzsL);
   thandle.set_nnzU(nnzsU);
   thandle.set_symbolic_complete();
+  thandle.reset_numeric_complete();
 
 }  // end ilut_symbolic
 
@@ -85,10 +85,11 @@ template <class KernelHandle, class ARowMapType, class AEntriesType,
               KernelHandle, ARowMapType, AEntriesType, LRowMapType,
               URowMapType>::value>
 struct PAR_ILUT_SYMBOLIC {
-  static void par_ilut_symbolic(KernelHandle *handle,
-                                const ARowMapType &A_row_map,
-                                const AEntriesType &A_entries,
-                                LRowMapType &L_row_map, URowMapType &U_row_map);
+  static void par_ilut_symbolic(
+      const typename KernelHandle::HandleExecSpace &space,
+      KernelHandle *handle, const ARowMapType &A_row_map,
+      const AEntriesType &A_entries, LRowMapType &L_row_map,
+      URowMapType &U_row_map);
 };
 
 #if !defined(KOKKOSKERNELS_ETI_ONLY) || KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
@@ -99,15 +100,20 @@ template <class KernelHandle, class ARowMapType, class AEntriesType,
 struct PAR_ILUT_SYMBOLIC<KernelHandle, ARowMapType, AEntriesType, LRowMapType,
                          URowMapType, false,
                          KOKKOSKERNELS_IMPL_COMPILE_LIBRARY> {
-  static void par_ilut_symbolic(KernelHandle *handle,
-                                const ARowMapType &A_row_map,
-                                const AEntriesType &A_entries,
-                                LRowMapType &L_row_map,
-                                URowMapType &U_row_map) {
+  static void par_ilut_symbolic(
+      const typename KernelHandle::HandleExecSpace &space,
+      KernelHandle *handle, const ARowMapType &A_row_map,
+      const AEntriesType &A_entries, LRowMapType &L_row_map,
+      URowMapType &U_row_map) {
+    Kokkos::Profiling::pushRegion(
+        KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+            ? "KokkosSparse::par_ilut_symbolic[ETI]"
+            : "KokkosSparse::par_ilut_symbolic[noETI]");
     auto par_ilut_handle = handle->get_par_ilut_handle();
 
-    Experimental::ilut_symbolic(*par_ilut_handle, A_row_map, A_entries,
+    Experimental::ilut_symbolic(space, *par_ilut_handle, A_row_map, A_entries,
                                 L_row_map, U_row_map);
+    Kokkos::Profiling::popRegion();
   }
 };
 #endif
@@ -0,0 +1,135 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_POLYNOMIAL_IMPL_HPP_
+#define KOKKOSSPARSE_POLYNOMIAL_IMPL_HPP_
+
+#include <cmath>
+#include <utility>
+#include <vector>
+#include <Kokkos_Core.hpp>
+#include "KokkosBatched_Eigenvalue_Serial_Internal.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+
+// Harmonic Ritz values of the (d+1) x d Arnoldi Hessenberg matrix H (host,
+// real): the eigenvalues of H_d + h_{d+1,d}^2 f e_d^T with H_d^T f = e_d,
+// which are the roots of the GMRES residual polynomial. Returns false if
+// H_d is singular or the eigenvalue solver did not converge.
+template <class HostMatrix, class RealType>
+bool polynomial_harmonic_ritz(const HostMatrix &H, const int d,
+                              std::vector<RealType> &re,
+                              std::vector<RealType> &im) {
+  // Scaled copy of H_d, since the eigenvalue solver uses an absolute
+  // tolerance
+  RealType scale = 0;
+  for (int i = 0; i <= d; i++)
+    for (int j = 0; j < d; j++) scale = std::max(scale, std::abs(H(i, j)));
+  if (scale == RealType(0)) return false;
+  std::vector<RealType> Hd(d * d), LU(d * d), f(d, RealType(0));
+  for (int i = 0; i < d; i++)
+    for (int j = 0; j < d; j++) {
+      Hd[i * d + j] = H(i, j) / scale;
+      LU[i * d + j] = H(j, i) / scale;  // H_d^T
+    }
+  const RealType h = H(d, d - 1) / scale;
+
+  // f = H_d^{-T} e_d, by Gaussian elimination with partial pivoting
+  f[d - 1] = 1;
+  for (int k = 0; k < d; k++) {
+    int p = k;
+    for (int i = k + 1; i < d; i++)
+      if (std::abs(LU[i * d + k]) > std::abs(LU[p * d + k])) p = i;
+    if (LU[p * d + k] == RealType(0)) return false;
+    if (p != k) {
+      for (int j = 0; j < d; j++) std::swap(LU[k * d + j], LU[p * d + j]);
+      std::swap(f[k], f[p]);
+    }
+    for (int i = k + 1; i < d; i++) {
+      const RealType l = LU[i * d + k] / LU[k * d + k];
+      for (int j = k; j < d; j++) LU[i * d + j] -= l * LU[k * d + j];
+      f[i] -= l * f[k];
+    }
+  }
+  for (int k = d - 1; k >= 0; k--) {
+    for (int j = k + 1; j < d; j++) f[k] -= LU[k * d + j] * f[j];
+    f[k] /= LU[k * d + k];
+  }
+  for (int i = 0; i < d; i++) Hd[i * d + d - 1] += h * h * f[i];
+
+  re.assign(d, RealType(0));
+  im.assign(d, RealType(0));
+  const int r_val = KokkosBatched::SerialEigenvalueInternal::invoke(
+      d, Hd.data(), d, 1, re.data(), 1, im.data(), 1);
+  if (r_val != 0) return false;
+  for (int i = 0; i < d; i++) {
+    if (!std::isfinite(re[i]) || !std::isfinite(im[i])) return false;
+    re[i] *= scale;
+    im[i] *= scale;
+  }
+  return true;
+}
+
+// Modified Leja ordering of the roots, for the stability of the product
+// form of the polynomial: each root maximizes the product of its distances
+// to the previous ones, and complex conjugate pairs stay together (a + bi,
+// then a - bi)
+template <class RealType>
+void polynomial_leja_order(std::vector<RealType> &re,
+                           std::vector<RealType> &im) {
+  const int d = re.size();
+  std::vector<RealType> log_prod(d, RealType(0));
+  for (int k = 0; k < d; k++) {
+    // Pick the next root among the remaining k..d-1
+    int best = k;
+    for (int i = k + 1; i < d; i++) {
+      const bool larger =
+          k == 0 ? std::hypot(re[i], im[i]) > std::hypot(re[best], im[best])
+                 : log_prod[i] > log_prod[best];
+      if (larger) best = i;
+    }
+    std::swap(re[k], re[best]);
+    std::swap(im[k], im[best]);
+    std::swap(log_prod[k], log_prod[best]);
+    int last = k;
+    if (im[k] != RealType(0)) {
+      // Put its conjugate right after it
+      if (im[k] < RealType(0)) im[k] = -im[k];
+      for (int i = k + 1; i < d; i++) {
+        if (re[i] == re[k] && std::abs(im[i]) == im[k]) {
+          std::swap(re[k + 1], re[i]);
+          std::swap(im[k + 1], im[i]);
+          std::swap(log_prod[k + 1], log_prod[i]);
+          im[k + 1] = -im[k];
+          last      = k + 1;
+          break;
+        }
+      }
+    }
+    for (int i = last + 1; i < d; i++) {
+      for (int j = k; j <= last; j++) {
+        log_prod[i] += std::log(std::hypot(re[i] - re[j], im[i] - im[j]));
+      }
+    }
+    k = last;
+  }
+}
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_POLYNOMIAL_IMPL_HPP_
@@ -0,0 +1,183 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_SCHWARZ_IMPL_HPP_
+#define KOKKOSSPARSE_SCHWARZ_IMPL_HPP_
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ArithTraits.hpp>
+
+namespace KokkosSparse {
+namespace Impl {
+
+// Counts, in the zero-initialized counts, the subdomains each global row
+// belongs to; one thread per (padded) subdomain row
+template <class OffsetsType, class RowsType, class CountsType>
+struct SchwarzCountFunctor {
+  using lno_t = typename RowsType::non_const_value_type;
+
+  OffsetsType sub_ptr;
+  RowsType sub_rows;
+  CountsType counts;
+  lno_t max_size;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const lno_t i) const {
+    const lno_t b  = i / max_size;
+    const lno_t li = i % max_size;
+    if (sub_ptr(b) + li < sub_ptr(b + 1))
+      Kokkos::atomic_inc(&counts(sub_rows(sub_ptr(b) + li)));
+  }
+};
+
+// Records that global row sub_rows(sub_ptr(b) + li) is the local row li of
+// subdomain b, at the position of the row in the membership graph given by
+// the zero-initialized cursor; one thread per (padded) subdomain row
+template <class OffsetsType, class RowsType, class CursorType>
+struct SchwarzMembershipFunctor {
+  using lno_t = typename RowsType::non_const_value_type;
+
+  OffsetsType sub_ptr;
+  RowsType sub_rows;
+  OffsetsType mem_ptr;
+  CursorType cursor;
+  RowsType mem_sub;
+  RowsType mem_local;
+  lno_t max_size;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const lno_t i) const {
+    const lno_t b  = i / max_size;
+    const lno_t li = i % max_size;
+    if (sub_ptr(b) + li >= sub_ptr(b + 1)) return;
+    const lno_t r = sub_rows(sub_ptr(b) + li);
+    const auto k  = mem_ptr(r) + Kokkos::atomic_fetch_inc(&cursor(r));
+    mem_sub(k)    = b;
+    mem_local(k)  = li;
+  }
+};
+
+// Sorts the memberships of each global row by subdomain (insertion sort,
+// a row belongs to a few subdomains), so that apply sums them in the same
+// order on every run
+template <class OffsetsType, class RowsType>
+struct SchwarzSortMembershipFunctor {
+  using lno_t = typename RowsType::non_const_value_type;
+
+  OffsetsType mem_ptr;
+  RowsType mem_sub;
+  RowsType mem_local;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const lno_t r) const {
+    for (auto k = mem_ptr(r) + 1; k < mem_ptr(r + 1); k++) {
+      const lno_t b  = mem_sub(k);
+      const lno_t li = mem_local(k);
+      auto m         = k;
+      for (; m > mem_ptr(r) && mem_sub(m - 1) > b; m--) {
+        mem_sub(m)   = mem_sub(m - 1);
+        mem_local(m) = mem_local(m - 1);
+      }
+      mem_sub(m)   = b;
+      mem_local(m) = li;
+    }
+  }
+};
+
+// Extracts the subdomain matrices A(rows_b, rows_b) into the
+// zero-initialized dense blocks, one thread per (padded) subdomain row. The
+// rows of a subdomain are sorted, so the local column of an entry is found
+// by binary search. The padding rows get a one on the diagonal.
+template <class RowMapType, class EntriesType, class ValuesType,
+          class OffsetsType, class RowsType, class BlocksType>
+struct SchwarzExtractFunctor {
+  using lno_t    = typename RowsType::non_const_value_type;
+  using scalar_t = typename BlocksType::non_const_value_type;
+
+  RowMapType row_map;
+  EntriesType entries;
+  ValuesType values;
+  OffsetsType sub_ptr;
+  RowsType sub_rows;
+  BlocksType blocks;
+  lno_t max_size;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const lno_t i) const {
+    const lno_t b    = i / max_size;
+    const lno_t li   = i % max_size;
+    const auto first = sub_ptr(b);
+    const lno_t size = sub_ptr(b + 1) - first;
+    if (li >= size) {
+      blocks(b, li, li) = Kokkos::ArithTraits<scalar_t>::one();
+      return;
+    }
+    const lno_t r = sub_rows(first + li);
+    for (auto k = row_map(r); k < row_map(r + 1); k++) {
+      const lno_t j = entries(k);
+      lno_t lo = 0, hi = size;
+      while (lo < hi) {
+        const lno_t mid = (lo + hi) / 2;
+        if (sub_rows(first + mid) < j)
+          lo = mid + 1;
+        else
+          hi = mid;
+      }
+      if (lo < size && sub_rows(first + lo) == j)
+        blocks(b, li, lo) += values(k);
+    }
+  }
+};
+
+// y = beta y + alpha sum_b W R_b^T A_b^{-1} R_b x with the inverted
+// subdomain blocks, where W scales each row by one over the number of
+// subdomains holding it. One thread per global row gathers the rows of the
+// inverted blocks it belongs to, so no atomics are needed and the result
+// does not depend on the scheduling.
+template <class OffsetsType, class RowsType, class BlocksType, class XType,
+          class YType>
+struct SchwarzApplyFunctor {
+  using lno_t    = typename RowsType::non_const_value_type;
+  using scalar_t = typename YType::non_const_value_type;
+  using KAT      = Kokkos::ArithTraits<scalar_t>;
+
+  OffsetsType sub_ptr;
+  RowsType sub_rows;
+  OffsetsType mem_ptr;
+  RowsType mem_sub;
+  RowsType mem_local;
+  BlocksType blocks;
+  XType x;
+  YType y;
+  scalar_t alpha;
+  scalar_t beta;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const lno_t r) const {
+    scalar_t sum = KAT::zero();
+    for (auto k = mem_ptr(r); k < mem_ptr(r + 1); k++) {
+      const lno_t b    = mem_sub(k);
+      const lno_t li   = mem_local(k);
+      const auto first = sub_ptr(b);
+      const lno_t size = sub_ptr(b + 1) - first;
+      for (lno_t lj = 0; lj < size; lj++)
+        sum += blocks(b, li, lj) * x(sub_rows(first + lj));
+    }
+    const lno_t count = mem_ptr(r + 1) - mem_ptr(r);
+    if (count > 1) sum /= scalar_t(count);
+    y(r) = beta == KAT::zero() ? alpha * sum : beta * y(r) + alpha * sum;
+  }
+};
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SCHWARZ_IMPL_HPP_
@@ -0,0 +1,130 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_SDDMM_IMPL_HPP_
+#define KOKKOSSPARSE_SDDMM_IMPL_HPP_
+
+#include "Kokkos_ArithTraits.hpp"
+#include "KokkosKernels_ExecSpaceUtils.hpp"
+#include "KokkosKernels_SimpleUtils.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+
+// C(i, j) := S(i, j) * (A(i, :) . B(j, :)) for the entries (i, j) of S,
+// where C has the pattern of S. Each thread takes one row of S and walks
+// its entries; the vector lanes split the dot product of the dense rows
+// A(i, :) and B(j, :). A(i, :) is read once per entry, but it stays in
+// cache while the thread walks row i.
+//
+// The value of C at entry k is written after S(k) is read, so C may share
+// the values of S.
+template <class execution_space, class SMatrix, class AView, class BView,
+          class CValues>
+struct SDDMM_Functor {
+  using ordinal_type = typename SMatrix::non_const_ordinal_type;
+  using size_type    = typename SMatrix::non_const_size_type;
+  using value_type   = typename CValues::non_const_value_type;
+  using team_policy  = Kokkos::TeamPolicy<execution_space>;
+  using team_member  = typename team_policy::member_type;
+
+  SMatrix S;
+  AView A;
+  BView B;
+  CValues Cvalues;
+  ordinal_type rows_per_team;
+
+  SDDMM_Functor(const SMatrix& S_, const AView& A_, const BView& B_,
+                const CValues& Cvalues_, const ordinal_type rows_per_team_)
+      : S(S_), A(A_), B(B_), Cvalues(Cvalues_), rows_per_team(rows_per_team_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type i) const {
+    const ordinal_type K = A.extent(1);
+    for (size_type k = S.graph.row_map(i); k < S.graph.row_map(i + 1); k++) {
+      const ordinal_type j = S.graph.entries(k);
+      value_type dot       = Kokkos::ArithTraits<value_type>::zero();
+      for (ordinal_type l = 0; l < K; l++) dot += A(i, l) * B(j, l);
+      Cvalues(k) = value_type(S.values(k)) * dot;
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const team_member& dev) const {
+    const ordinal_type K     = A.extent(1);
+    const ordinal_type begin = dev.league_rank() * rows_per_team;
+    const ordinal_type end =
+        KOKKOSKERNELS_MACRO_MIN(begin + rows_per_team, S.numRows());
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(dev, begin, end), [&](const ordinal_type i) {
+          for (size_type k = S.graph.row_map(i); k < S.graph.row_map(i + 1);
+               k++) {
+            const ordinal_type j = S.graph.entries(k);
+            value_type dot       = Kokkos::ArithTraits<value_type>::zero();
+            Kokkos::parallel_reduce(
+                Kokkos::ThreadVectorRange(dev, K),
+                [&](const ordinal_type l, value_type& ldot) {
+                  ldot += A(i, l) * B(j, l);
+                },
+                dot);
+            Kokkos::single(Kokkos::PerThread(dev), [&]() {
+              Cvalues(k) = value_type(S.values(k)) * dot;
+            });
+          }
+        });
+  }
+};
+
+/// Native C := S .* (A * B^T), sampled at the entries of S. On GPUs, the
+/// vector lanes cover the inner dimension (up to 32) and each team takes
+/// one row of S per thread; on CPUs, one row per range iteration.
+template <class execution_space, class SMatrix, class AView, class BView,
+          class CValues>
+void sddmm_native(const execution_space& exec, const SMatrix& S,
+                  const AView& A, const BView& B, const CValues& Cvalues) {
+  using ordinal_type = typename SMatrix::non_const_ordinal_type;
+  using functor_type =
+      SDDMM_Functor<execution_space, SMatrix, AView, BView, CValues>;
+
+  const ordinal_type numRows = S.numRows();
+  if (numRows <= 0) return;
+
+  if constexpr (KokkosKernels::Impl::kk_is_gpu_exec_space<execution_space>()) {
+    const int max_vector_length =
+        KokkosKernels::Impl::kk_get_max_vector_size<execution_space>();
+    int vector_length = 1;
+    while (vector_length < max_vector_length &&
+           size_t(vector_length) < A.extent(1))
+      vector_length *= 2;
+    const int team_size = 256 / vector_length;
+    const ordinal_type rows_per_team = team_size;
+    const ordinal_type numTeams =
+        (numRows + rows_per_team - 1) / rows_per_team;
+    Kokkos::parallel_for(
+        "KokkosSparse::sddmm",
+        Kokkos::TeamPolicy<execution_space>(exec, numTeams, team_size,
+                                            vector_length),
+        functor_type(S, A, B, Cvalues, rows_per_team));
+  } else {
+    Kokkos::parallel_for(
+        "KokkosSparse::sddmm",
+        Kokkos::RangePolicy<execution_space>(exec, 0, numRows),
+        functor_type(S, A, B, Cvalues, 1));
+  }
+}
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SDDMM_IMPL_HPP_
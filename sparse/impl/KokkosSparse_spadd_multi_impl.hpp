@@ -0,0 +1,127 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_SPADD_MULTI_IMPL_HPP_
+#define KOKKOSSPARSE_SPADD_MULTI_IMPL_HPP_
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ArithTraits.hpp>
+
+namespace KokkosSparse {
+namespace Impl {
+
+// Maximum number of matrices added by spadd_multi
+constexpr int spadd_multi_max_terms = 16;
+
+// Symbolic phase of C = sum_j A_j, one thread per row: a k-way merge of the
+// sorted rows i of the A_j. CountTag writes the length of row i of C to
+// c_rowmap(i); FillTag, given the final c_rowmap, writes the entries of
+// row i of C and, for each entry of the A_j, its position in the row.
+template <class rowmap_t, class entries_t, class c_rowmap_t, class c_entries_t,
+          class pos_t>
+struct SpaddMultiSymbolicFunctor {
+  using size_type    = typename rowmap_t::non_const_value_type;
+  using ordinal_type = typename entries_t::non_const_value_type;
+
+  struct CountTag {};
+  struct FillTag {};
+
+  int k;
+  Kokkos::Array<rowmap_t, spadd_multi_max_terms> rowmaps;
+  Kokkos::Array<entries_t, spadd_multi_max_terms> entries;
+  c_rowmap_t c_rowmap;
+  c_entries_t c_entries;
+  Kokkos::Array<pos_t, spadd_multi_max_terms> pos;
+
+  // Repeatedly take the smallest column among the heads of the rows, and
+  // advance every row past it (this also merges duplicates within a row)
+  template <bool fill>
+  KOKKOS_INLINE_FUNCTION ordinal_type merge_row(const ordinal_type i) const {
+    size_type cursor[spadd_multi_max_terms];
+    size_type end[spadd_multi_max_terms];
+    for (int j = 0; j < k; j++) {
+      cursor[j] = rowmaps[j](i);
+      end[j]    = rowmaps[j](i + 1);
+    }
+    const auto cBegin = fill ? c_rowmap(i) : 0;
+    ordinal_type len  = 0;
+    while (true) {
+      bool found       = false;
+      ordinal_type col = 0;
+      for (int j = 0; j < k; j++) {
+        if (cursor[j] < end[j] && (!found || entries[j](cursor[j]) < col)) {
+          col   = entries[j](cursor[j]);
+          found = true;
+        }
+      }
+      if (!found) break;
+      for (int j = 0; j < k; j++) {
+        while (cursor[j] < end[j] && entries[j](cursor[j]) == col) {
+          if (fill) pos[j](cursor[j]) = len;
+          cursor[j]++;
+        }
+      }
+      if (fill) c_entries(cBegin + len) = col;
+      len++;
+    }
+    return len;
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const CountTag &,
+                                         const ordinal_type i) const {
+    c_rowmap(i) = merge_row<false>(i);
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const FillTag &,
+                                         const ordinal_type i) const {
+    merge_row<true>(i);
+  }
+};
+
+// Numeric phase of C = sum_j alpha_j A_j, one thread per row: each entry of
+// each A_j is added at its position in the row of C found by the symbolic
+// phase.
+template <class rowmap_t, class values_t, class c_rowmap_t, class c_values_t,
+          class pos_t>
+struct SpaddMultiNumericFunctor {
+  using ordinal_type = typename pos_t::non_const_value_type;
+  using scalar_t     = typename c_values_t::non_const_value_type;
+
+  int k;
+  Kokkos::Array<rowmap_t, spadd_multi_max_terms> rowmaps;
+  Kokkos::Array<values_t, spadd_multi_max_terms> values;
+  Kokkos::Array<scalar_t, spadd_multi_max_terms> alphas;
+  Kokkos::Array<pos_t, spadd_multi_max_terms> pos;
+  c_rowmap_t c_rowmap;
+  c_values_t c_values;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type i) const {
+    const auto cBegin = c_rowmap(i);
+    for (auto q = cBegin; q < c_rowmap(i + 1); q++) {
+      c_values(q) = Kokkos::ArithTraits<scalar_t>::zero();
+    }
+    for (int j = 0; j < k; j++) {
+      for (auto q = rowmaps[j](i); q < rowmaps[j](i + 1); q++) {
+        c_values(cBegin + pos[j](q)) += alphas[j] * values[j](q);
+      }
+    }
+  }
+};
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPADD_MULTI_IMPL_HPP_
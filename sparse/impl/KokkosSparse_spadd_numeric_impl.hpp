@@ -169,6 +169,75 @@ struct UnsortedNumericSumFunctor {
   const CcolindsT Bpos;
 };
 
+// Numeric for the case where symbolic found that C has exactly A's pattern.
+// If identical, B's rows have the same columns as A's and this is a direct
+// axpby on the values; otherwise B's entries are scattered into C's row at
+// the offsets Bpos.
+template <typename size_type, typename ordinal_type, typename ArowptrsT,
+          typename BrowptrsT, typename CrowptrsT, typename AcolindsT,
+          typename CcolindsT, typename AvaluesT, typename BvaluesT,
+          typename CvaluesT, typename AscalarT, typename BscalarT,
+          typename BposT>
+struct PatternReuseNumericFunctor {
+  using CscalarT = typename CvaluesT::non_const_value_type;
+
+  PatternReuseNumericFunctor(
+      const ArowptrsT Arowptrs_, const BrowptrsT Browptrs_,
+      const CrowptrsT Crowptrs_, const AcolindsT Acolinds_,
+      CcolindsT Ccolinds_, const AvaluesT Avalues_, const BvaluesT Bvalues_,
+      CvaluesT Cvalues_, const AscalarT alpha_, const BscalarT beta_,
+      const BposT Bpos_, const bool identical_)
+      : Arowptrs(Arowptrs_),
+        Browptrs(Browptrs_),
+        Crowptrs(Crowptrs_),
+        Acolinds(Acolinds_),
+        Ccolinds(Ccolinds_),
+        Avalues(Avalues_),
+        Bvalues(Bvalues_),
+        Cvalues(Cvalues_),
+        alpha(alpha_),
+        beta(beta_),
+        Bpos(Bpos_),
+        identical(identical_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type i) const {
+    size_type CrowStart = Crowptrs(i);
+    size_type ArowStart = Arowptrs(i);
+    size_type ArowLen   = Arowptrs(i + 1) - ArowStart;
+    size_type BrowStart = Browptrs(i);
+    size_type BrowEnd   = Browptrs(i + 1);
+    if (identical) {
+      for (size_type j = 0; j < ArowLen; j++) {
+        Ccolinds(CrowStart + j) = Acolinds(ArowStart + j);
+        Cvalues(CrowStart + j) =
+            static_cast<CscalarT>(alpha * Avalues(ArowStart + j)) +
+            static_cast<CscalarT>(beta * Bvalues(BrowStart + j));
+      }
+      return;
+    }
+    for (size_type j = 0; j < ArowLen; j++) {
+      Ccolinds(CrowStart + j) = Acolinds(ArowStart + j);
+      Cvalues(CrowStart + j) =
+          static_cast<CscalarT>(alpha * Avalues(ArowStart + j));
+    }
+    for (size_type j = BrowStart; j < BrowEnd; j++)
+      Cvalues(CrowStart + Bpos(j)) += static_cast<CscalarT>(beta * Bvalues(j));
+  }
+
+  const ArowptrsT Arowptrs;
+  const BrowptrsT Browptrs;
+  const CrowptrsT Crowptrs;
+  const AcolindsT Acolinds;
+  CcolindsT Ccolinds;
+  const AvaluesT Avalues;
+  const BvaluesT Bvalues;
+  CvaluesT Cvalues;
+  const AscalarT alpha;
+  const BscalarT beta;
+  const BposT Bpos;
+  const bool identical;
+};
+
 // Helper macro to check that two types are the same (ignoring const)
 #define SAME_TYPE(A, B)                             \
   std::is_same<typename std::remove_const<A>::type, \
@@ -242,6 +311,25 @@ void spadd_numeric_impl(
     return;
   }
   ordinal_type nrows = a_rowmap.extent(0) - 1;
+  using spadd_handle_t = typename KernelHandle::SPADDHandleType;
+  const auto pattern   = addHandle->get_pattern_kind();
+  if (pattern != spadd_handle_t::GENERAL_PATTERN) {
+    // symbolic found that C has A's pattern: no merge needed
+    using bpos_t = typename spadd_handle_t::nnz_lno_view_t;
+    PatternReuseNumericFunctor<size_type, ordinal_type, alno_row_view_t,
+                               blno_row_view_t, clno_row_view_t,
+                               alno_nnz_view_t, clno_nnz_view_t,
+                               ascalar_nnz_view_t, bscalar_nnz_view_t,
+                               cscalar_nnz_view_t, ascalar_t, bscalar_t, bpos_t>
+        reuseNumeric(a_rowmap, b_rowmap, c_rowmap, a_entries, c_entries,
+                     a_values, b_values, c_values, alpha, beta,
+                     addHandle->get_b_pos(),
+                     pattern == spadd_handle_t::IDENTICAL_PATTERN);
+    Kokkos::parallel_for("KokkosSparse::SpAdd:Numeric::PatternReuse",
+                         range_type(exec, 0, nrows), reuseNumeric);
+    addHandle->set_call_numeric();
+    return;
+  }
   if (addHandle->is_input_sorted()) {
     SortedNumericSumFunctor<size_type, ordinal_type, alno_row_view_t,
                             blno_row_view_t, clno_row_view_t, alno_nnz_view_t,
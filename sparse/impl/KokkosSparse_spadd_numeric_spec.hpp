@@ -133,9 +133,13 @@ struct SPADD_NUMERIC<
                             b_size_view_t row_mapB, b_lno_view_t entriesB,
                             b_scalar_view_t valuesB, c_size_view_t row_mapC,
                             c_lno_view_t entriesC, c_scalar_view_t valuesC) {
+    Kokkos::Profiling::pushRegion(KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+                                      ? "KokkosSparse::spadd_numeric[ETI]"
+                                      : "KokkosSparse::spadd_numeric[noETI]");
     spadd_numeric_impl(exec, handle, row_mapA, entriesA, valuesA, alpha,
                        row_mapB, entriesB, valuesB, beta, row_mapC, entriesC,
                        valuesC);
+    Kokkos::Profiling::popRegion();
   }
 };
 
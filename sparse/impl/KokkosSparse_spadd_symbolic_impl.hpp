@@ -370,6 +370,75 @@ struct MergeEntriesFunctor {
   CcolindsT Bpos;
 };
 
+// Detect whether B's pattern is identical to, or contained in, A's pattern.
+// The reduced bitmask holds the properties that are true in every row:
+//   A_STRICT:  A's column indices are strictly increasing
+//   IDENTICAL: B's row has exactly the columns of A's row, in order
+//   B_SUBSET:  every column of B's row appears in A's row
+// Bpos gets the offset in A's row (and so in C's row) of each B entry, which
+// is only meaningful if B_SUBSET holds everywhere.
+template <typename size_type, typename ordinal_type, typename ARowPtrsT,
+          typename BRowPtrsT, typename AColIndsT, typename BColIndsT,
+          typename BPosT>
+struct DetectPatternFunctor {
+  enum : int { A_STRICT = 1, IDENTICAL = 2, B_SUBSET = 4 };
+
+  DetectPatternFunctor(const ARowPtrsT& Arowptrs_, const AColIndsT& Acolinds_,
+                       const BRowPtrsT& Browptrs_, const BColIndsT& Bcolinds_,
+                       const BPosT& Bpos_)
+      : Arowptrs(Arowptrs_),
+        Acolinds(Acolinds_),
+        Browptrs(Browptrs_),
+        Bcolinds(Bcolinds_),
+        Bpos(Bpos_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type i,
+                                         int& flags) const {
+    const size_type Arowstart = Arowptrs(i);
+    const size_type Arowlen   = Arowptrs(i + 1) - Arowstart;
+    const size_type Browstart = Browptrs(i);
+    const size_type Browlen   = Browptrs(i + 1) - Browstart;
+    for (size_type j = 1; j < Arowlen; j++) {
+      if (!(Acolinds(Arowstart + j - 1) < Acolinds(Arowstart + j))) {
+        flags = 0;
+        return;
+      }
+    }
+    bool identical = Arowlen == Browlen;
+    for (size_type j = 0; identical && j < Arowlen; j++)
+      identical = Acolinds(Arowstart + j) == Bcolinds(Browstart + j);
+    if (identical) {
+      for (size_type j = 0; j < Browlen; j++) Bpos(Browstart + j) = j;
+      return;
+    }
+    flags &= ~IDENTICAL;
+    for (size_type j = 0; j < Browlen; j++) {
+      const ordinal_type col = Bcolinds(Browstart + j);
+      // binary search for col in A's (strictly sorted) row
+      size_type lo = 0;
+      size_type hi = Arowlen;
+      while (lo < hi) {
+        const size_type mid = lo + (hi - lo) / 2;
+        if (Acolinds(Arowstart + mid) < col)
+          lo = mid + 1;
+        else
+          hi = mid;
+      }
+      if (lo == Arowlen || Acolinds(Arowstart + lo) != col) {
+        flags &= ~B_SUBSET;
+        return;
+      }
+      Bpos(Browstart + j) = lo;
+    }
+  }
+
+  ARowPtrsT Arowptrs;
+  AColIndsT Acolinds;
+  BRowPtrsT Browptrs;
+  BColIndsT Bcolinds;
+  BPosT Bpos;
+};
+
 // Run SortedCountEntries: non-GPU, always uses the RangePolicy version.
 template <typename execution_space, typename KernelHandle,
           typename alno_row_view_t_, typename alno_nnz_view_t_,
@@ -476,6 +545,7 @@ void spadd_symbolic_impl(
   typedef typename KernelHandle::nnz_lno_t ordinal_type;
   typedef typename KernelHandle::SPADDHandleType::nnz_lno_view_t ordinal_view_t;
   typedef typename KernelHandle::SPADDHandleType::nnz_row_view_t offset_view_t;
+  typedef typename KernelHandle::SPADDHandleType spadd_handle_t;
   // Check that A/B/C data types match KernelHandle types, and that C data types
   // are nonconst (doesn't matter if A/B types are const)
   static_assert(
@@ -506,6 +576,7 @@ void spadd_symbolic_impl(
   // symbolic just needs to compute c_rowmap
   // easy for sorted, but for unsorted is easiest to just compute the whole sum
   auto addHandle = handle->get_spadd_handle();
+  addHandle->set_pattern_kind(spadd_handle_t::GENERAL_PATTERN);
   if (a_rowmap.extent(0) == 0 || a_rowmap.extent(0) == 1) {
     // Have 0 rows, so nothing to do except set #nnz to 0
     addHandle->set_c_nnz(0);
@@ -516,6 +587,42 @@ void spadd_symbolic_impl(
   }
   ordinal_type nrows = a_rowmap.extent(0) - 1;
   typedef Kokkos::RangePolicy<execution_space, ordinal_type> range_type;
+  // If B's pattern is contained in A's (e.g. A + shift*I, or M + dt*K with a
+  // shared graph) and A's rows are strictly sorted, then C has exactly A's
+  // pattern and numeric can skip the merge. Checking costs one pass over A and
+  // a binary search per entry of B, much less than the general symbolic.
+  {
+    ordinal_view_t b_pos(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing,
+                                            "B entry positions"),
+                         b_entries.extent(0));
+    using detect_t =
+        DetectPatternFunctor<size_type, ordinal_type, alno_row_view_t_,
+                             blno_row_view_t_, alno_nnz_view_t_,
+                             blno_nnz_view_t_, ordinal_view_t>;
+    int flags = 0;
+    Kokkos::parallel_reduce(
+        "KokkosSparse::SpAdd:Symbolic::DetectPattern",
+        range_type(exec, 0, nrows),
+        detect_t(a_rowmap, a_entries, b_rowmap, b_entries, b_pos),
+        Kokkos::BAnd<int>(flags));
+    if ((flags & detect_t::A_STRICT) &&
+        (flags & (detect_t::IDENTICAL | detect_t::B_SUBSET))) {
+      Kokkos::deep_copy(exec, c_rowmap, a_rowmap);
+      if (flags & detect_t::IDENTICAL) {
+        addHandle->set_pattern_kind(spadd_handle_t::IDENTICAL_PATTERN);
+      } else {
+        addHandle->set_pattern_kind(spadd_handle_t::B_SUBSET_OF_A_PATTERN);
+        addHandle->set_a_b_pos(ordinal_view_t(), b_pos);
+      }
+      size_type cmax;
+      Kokkos::deep_copy(exec, cmax, Kokkos::subview(c_rowmap, nrows));
+      exec.fence();
+      addHandle->set_c_nnz(cmax);
+      addHandle->set_call_symbolic();
+      addHandle->set_call_numeric(false);
+      return;
+    }
+  }
   if (addHandle->is_input_sorted()) {
     runSortedCountEntries<execution_space, KernelHandle, alno_row_view_t_,
                           alno_nnz_view_t_, blno_row_view_t_, blno_nnz_view_t_,
@@ -526,11 +633,13 @@ void spadd_symbolic_impl(
   } else {
     // note: scoping individual parts of the process to free views sooner,
     // minimizing peak memory usage run the unsorted c_rowmap upper bound
-    // functor (just adds together A and B entry counts row by row)
-    offset_view_t c_rowmap_upperbound(
-        Kokkos::view_alloc(exec, Kokkos::WithoutInitializing,
-                           "C row counts upper bound"),
-        nrows + 1);
+    // functor (just adds together A and B entry counts row by row). The
+    // unmerged sum comes from the workspace of the handle if it has one; a_pos
+    // and b_pos are kept by the handle, so they do not.
+    typename spadd_handle_t::workspace_t::Scope work(
+        addHandle->get_workspace());
+    auto c_rowmap_upperbound = work.template view<offset_view_t>(
+        "C row counts upper bound", false, nrows + 1);
     size_type c_nnz_upperbound = 0;
     {
       UnsortedEntriesUpperBound<size_type, ordinal_type, alno_row_view_t_,
@@ -544,13 +653,10 @@ void spadd_symbolic_impl(
       Kokkos::deep_copy(exec, c_nnz_upperbound,
                         Kokkos::subview(c_rowmap_upperbound, nrows));
     }
-    ordinal_view_t c_entries_uncompressed(
-        Kokkos::view_alloc(exec, Kokkos::WithoutInitializing,
-                           "C entries uncompressed"),
-        c_nnz_upperbound);
-    ordinal_view_t ab_perm(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing,
-                                              "A and B permuted entry indices"),
-                           c_nnz_upperbound);
+    auto c_entries_uncompressed = work.template view<ordinal_view_t>(
+        "C entries uncompressed", false, c_nnz_upperbound);
+    auto ab_perm = work.template view<ordinal_view_t>(
+        "A and B permuted entry indices", false, c_nnz_upperbound);
     // compute the unmerged sum
     UnmergedSumFunctor<size_type, ordinal_type, alno_row_view_t_,
                        blno_row_view_t_, offset_view_t, alno_nnz_view_t_,
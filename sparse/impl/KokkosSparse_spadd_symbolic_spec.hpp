@@ -107,8 +107,12 @@ struct SPADD_SYMBOLIC<ExecSpace, KernelHandle, a_size_view_t, a_lno_view_t,
                              a_size_view_t row_mapA, a_lno_view_t entriesA,
                              b_size_view_t row_mapB, b_lno_view_t entriesB,
                              c_size_view_t row_mapC) {
+    Kokkos::Profiling::pushRegion(KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+                                      ? "KokkosSparse::spadd_symbolic[ETI]"
+                                      : "KokkosSparse::spadd_symbolic[noETI]");
     spadd_symbolic_impl(exec, handle, row_mapA, entriesA, row_mapB, entriesB,
                         row_mapC);
+    Kokkos::Profiling::popRegion();
   }
 };
 
@@ -0,0 +1,318 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_SPGEMM_ADAPTIVE_IMPL_HPP_
+#define KOKKOSSPARSE_SPGEMM_ADAPTIVE_IMPL_HPP_
+
+#include "Kokkos_ArithTraits.hpp"
+#include "KokkosKernels_ExecSpaceUtils.hpp"
+#include "KokkosKernels_SimpleUtils.hpp"
+#include "KokkosKernels_Uniform_Initialized_MemoryPool.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+
+// Numeric phase of C = A*B with the accumulator chosen per row
+// (SPGEMM_ACC_ADAPTIVE). The symbolic phase already gives the exact length
+// of every row of C, and the number of multiplications of a row is a cheap
+// pass over A, so the rows are split into two bins:
+//  - small rows, with at most spgemm_adaptive_small_len entries and
+//    spgemm_adaptive_small_flops multiplications, are computed by a single
+//    thread in a list held in registers (a linear search per term);
+//  - the other rows are computed by a team thread and its vector lanes
+//    with a dense accumulator from a memory pool.
+// Power-law matrices, with many tiny rows and a few huge ones, then get the
+// cheap accumulator for the former and the dense one for the latter,
+// instead of one choice for the whole matrix.
+constexpr int spgemm_adaptive_small_len   = 16;
+constexpr int spgemm_adaptive_small_flops = 256;
+
+// One small row per thread: the entries found so far are kept in a local
+// list, written to C at the end.
+template <typename rows_view_t, typename a_row_view_t, typename a_lno_view_t,
+          typename a_scalar_view_t, typename b_row_view_t,
+          typename b_lno_view_t, typename b_scalar_view_t,
+          typename c_row_view_t, typename c_lno_view_t,
+          typename c_scalar_view_t>
+struct SpgemmAdaptiveSmallRowFunctor {
+  using size_type = typename c_row_view_t::non_const_value_type;
+  using lno_t     = typename c_lno_view_t::non_const_value_type;
+  using scalar_t  = typename c_scalar_view_t::non_const_value_type;
+
+  rows_view_t rows;
+  a_row_view_t row_mapA;
+  a_lno_view_t entriesA;
+  a_scalar_view_t valuesA;
+  b_row_view_t row_mapB;
+  b_lno_view_t entriesB;
+  b_scalar_view_t valuesB;
+  c_row_view_t row_mapC;
+  c_lno_view_t entriesC;
+  c_scalar_view_t valuesC;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const lno_t r) const {
+    const lno_t i = rows(r);
+    lno_t cols[spgemm_adaptive_small_len];
+    scalar_t vals[spgemm_adaptive_small_len];
+    int len = 0;
+    for (size_type ka = row_mapA(i); ka < row_mapA(i + 1); ka++) {
+      const lno_t k    = entriesA(ka);
+      const scalar_t a = valuesA(ka);
+      for (size_type kb = row_mapB(k); kb < row_mapB(k + 1); kb++) {
+        const lno_t col = entriesB(kb);
+        int q           = 0;
+        while (q < len && cols[q] != col) q++;
+        if (q == len) {
+          cols[len]   = col;
+          vals[len++] = a * valuesB(kb);
+        } else {
+          vals[q] += a * valuesB(kb);
+        }
+      }
+    }
+    const size_type offset = row_mapC(i);
+    for (int q = 0; q < len; q++) {
+      entriesC(offset + q) = cols[q];
+      valuesC(offset + q)  = vals[q];
+    }
+  }
+};
+
+// One large row per team thread, with a dense accumulator. The vector lanes
+// split one row of B at a time; its columns are distinct, so the lanes
+// never update the same entry of the accumulator at the same time, and only
+// the list of occupied columns (the entries of the row of C) needs an atomic
+// counter. The chunks hold
+//  - ordinals: the markers of the occupied columns, and the list length
+//    (numColsB + 1);
+//  - values: the dense row (numColsB).
+// Every thread leaves its chunks zeroed, as it got them.
+template <typename ExecutionSpace, typename rows_view_t, typename a_row_view_t,
+          typename a_lno_view_t, typename a_scalar_view_t,
+          typename b_row_view_t, typename b_lno_view_t,
+          typename b_scalar_view_t, typename c_row_view_t,
+          typename c_lno_view_t, typename c_scalar_view_t, typename lno_pool_t,
+          typename scalar_pool_t>
+struct SpgemmAdaptiveLargeRowFunctor {
+  using size_type   = typename c_row_view_t::non_const_value_type;
+  using lno_t       = typename c_lno_view_t::non_const_value_type;
+  using scalar_t    = typename c_scalar_view_t::non_const_value_type;
+  using team_member = typename Kokkos::TeamPolicy<ExecutionSpace>::member_type;
+
+  lno_t first_row;
+  lno_t end_row;
+  lno_t numColsB;
+  lno_t rows_per_team;
+  rows_view_t rows;
+  a_row_view_t row_mapA;
+  a_lno_view_t entriesA;
+  a_scalar_view_t valuesA;
+  b_row_view_t row_mapB;
+  b_lno_view_t entriesB;
+  b_scalar_view_t valuesB;
+  c_row_view_t row_mapC;
+  c_lno_view_t entriesC;
+  c_scalar_view_t valuesC;
+  lno_pool_t lno_pool;
+  scalar_pool_t scalar_pool;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const team_member& dev) const {
+    const lno_t begin = first_row + dev.league_rank() * rows_per_team;
+    const lno_t end   = KOKKOSKERNELS_MACRO_MIN(begin + rows_per_team, end_row);
+    const size_t tid  = dev.league_rank() * dev.team_size() + dev.team_rank();
+
+    lno_t* lnoChunk    = nullptr;
+    scalar_t* accChunk = nullptr;
+    Kokkos::single(
+        Kokkos::PerThread(dev),
+        [&](lno_t*& chunk) {
+          chunk = nullptr;
+          while (chunk == nullptr) chunk = lno_pool.allocate_chunk(tid);
+        },
+        lnoChunk);
+    Kokkos::single(
+        Kokkos::PerThread(dev),
+        [&](scalar_t*& chunk) {
+          chunk = nullptr;
+          while (chunk == nullptr) chunk = scalar_pool.allocate_chunk(tid);
+        },
+        accChunk);
+    lno_t* cMark   = lnoChunk;
+    lno_t* count   = cMark + numColsB;
+    scalar_t* cAcc = accChunk;
+
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(dev, begin, end), [&](const lno_t r) {
+          const lno_t i          = rows(r);
+          const size_type offset = row_mapC(i);
+          lno_t* cList           = &entriesC(offset);
+          for (size_type ka = row_mapA(i); ka < row_mapA(i + 1); ka++) {
+            const lno_t k        = entriesA(ka);
+            const size_type bBeg = row_mapB(k);
+            const size_type bLen = row_mapB(k + 1) - bBeg;
+            const scalar_t a     = valuesA(ka);
+            Kokkos::parallel_for(
+                Kokkos::ThreadVectorRange(dev, bLen), [&](const size_type l) {
+                  const lno_t col = entriesB(bBeg + l);
+                  if (!cMark[col]) {
+                    cMark[col] = 1;
+                    cList[Kokkos::atomic_fetch_add(count, lno_t(1))] = col;
+                  }
+                  cAcc[col] += a * valuesB(bBeg + l);
+                });
+          }
+          const lno_t cLen = *count;
+
+          // Write the row and zero the accumulator again
+          Kokkos::parallel_for(
+              Kokkos::ThreadVectorRange(dev, cLen), [&](const lno_t t) {
+                const lno_t j       = cList[t];
+                cMark[j]            = 0;
+                valuesC(offset + t) = cAcc[j];
+                cAcc[j]             = Kokkos::ArithTraits<scalar_t>::zero();
+              });
+          Kokkos::single(Kokkos::PerThread(dev), [&]() { *count = 0; });
+        });
+
+    Kokkos::single(Kokkos::PerThread(dev), [&]() {
+      lno_pool.release_chunk(lnoChunk);
+      scalar_pool.release_chunk(accChunk);
+    });
+  }
+};
+
+/// Numeric phase of C = A*B (A is m x k, B is k x numColsB) with the
+/// accumulator chosen per row. row_mapC must come from the symbolic phase;
+/// the (unsorted) entries and values of C are written.
+template <typename ExecutionSpace, typename MemorySpace,
+          typename a_row_view_t, typename a_lno_view_t,
+          typename a_scalar_view_t, typename b_row_view_t,
+          typename b_lno_view_t, typename b_scalar_view_t,
+          typename c_row_view_t, typename c_lno_view_t,
+          typename c_scalar_view_t>
+void spgemm_numeric_adaptive(
+    const typename c_lno_view_t::non_const_value_type m,
+    const typename c_lno_view_t::non_const_value_type numColsB,
+    const a_row_view_t& row_mapA, const a_lno_view_t& entriesA,
+    const a_scalar_view_t& valuesA, const b_row_view_t& row_mapB,
+    const b_lno_view_t& entriesB, const b_scalar_view_t& valuesB,
+    const c_row_view_t& row_mapC, const c_lno_view_t& entriesC,
+    const c_scalar_view_t& valuesC) {
+  using size_type     = typename c_row_view_t::non_const_value_type;
+  using lno_t         = typename c_lno_view_t::non_const_value_type;
+  using scalar_t      = typename c_scalar_view_t::non_const_value_type;
+  using rows_view_t   = Kokkos::View<lno_t*, MemorySpace>;
+  using pool_device_t = Kokkos::Device<ExecutionSpace, MemorySpace>;
+  using lno_pool_t =
+      KokkosKernels::Impl::UniformMemoryPool<pool_device_t, lno_t>;
+  using scalar_pool_t =
+      KokkosKernels::Impl::UniformMemoryPool<pool_device_t, scalar_t>;
+  using small_functor_t =
+      SpgemmAdaptiveSmallRowFunctor<rows_view_t, a_row_view_t, a_lno_view_t,
+                                    a_scalar_view_t, b_row_view_t,
+                                    b_lno_view_t, b_scalar_view_t,
+                                    c_row_view_t, c_lno_view_t,
+                                    c_scalar_view_t>;
+  using large_functor_t = SpgemmAdaptiveLargeRowFunctor<
+      ExecutionSpace, rows_view_t, a_row_view_t, a_lno_view_t,
+      a_scalar_view_t, b_row_view_t, b_lno_view_t, b_scalar_view_t,
+      c_row_view_t, c_lno_view_t, c_scalar_view_t, lno_pool_t,
+      scalar_pool_t>;
+  using range_policy_t =
+      Kokkos::RangePolicy<ExecutionSpace, Kokkos::IndexType<lno_t>>;
+
+  // Bin the rows: the small rows go to the front of rows, the large rows
+  // to the back
+  rows_view_t rows(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "SpGEMM row bins"), m);
+  lno_t num_small = 0;
+  Kokkos::parallel_scan(
+      "KokkosSparse::spgemm_adaptive::bin_rows", range_policy_t(0, m),
+      KOKKOS_LAMBDA(const lno_t i, lno_t& small_before, const bool final) {
+        size_type flops = 0;
+        for (size_type ka = row_mapA(i); ka < row_mapA(i + 1); ka++) {
+          const lno_t k = entriesA(ka);
+          flops += row_mapB(k + 1) - row_mapB(k);
+        }
+        const size_type len = row_mapC(i + 1) - row_mapC(i);
+        const bool small    = len <= size_type(spgemm_adaptive_small_len) &&
+                           flops <= size_type(spgemm_adaptive_small_flops);
+        if (final) {
+          if (small)
+            rows(small_before) = i;
+          else
+            rows(m - 1 - (i - small_before)) = i;
+        }
+        if (small) small_before++;
+      },
+      num_small);
+  const lno_t num_large = m - num_small;
+
+  if (num_small) {
+    Kokkos::parallel_for(
+        "KokkosSparse::spgemm_adaptive::small_rows",
+        range_policy_t(0, num_small),
+        small_functor_t{rows, row_mapA, entriesA, valuesA, row_mapB, entriesB,
+                        valuesB, row_mapC, entriesC, valuesC});
+  }
+  if (!num_large) return;
+
+  // Team policy as for the masked kernels: on GPUs, vector lanes for an
+  // average row of B and 128 threads per team, with as many chunks as fit
+  // in half the free memory; on CPUs one thread (and one chunk) per team of
+  // 16 rows.
+  const size_t lnoChunkSize   = size_t(numColsB) + 1;
+  const size_t valueChunkSize = numColsB;
+  const size_t chunk_bytes =
+      lnoChunkSize * sizeof(lno_t) + valueChunkSize * sizeof(scalar_t);
+  int team_size       = 1;
+  int vector_size     = 1;
+  lno_t rows_per_team = 16;
+  size_t num_chunks   = ExecutionSpace().concurrency();
+  if constexpr (KokkosKernels::Impl::kk_is_gpu_exec_space<ExecutionSpace>()) {
+    vector_size = KokkosKernels::Impl::kk_get_suggested_vector_size(
+        row_mapB.extent(0) - 1, entriesB.extent(0),
+        KokkosKernels::Impl::kk_get_exec_space_type<ExecutionSpace>());
+    if (vector_size > 32) vector_size = 32;
+    team_size     = 128 / vector_size;
+    rows_per_team = team_size;
+    num_chunks /= vector_size;
+    size_t free_byte, total_byte;
+    KokkosKernels::Impl::kk_get_free_total_memory<MemorySpace>(free_byte,
+                                                               total_byte);
+    if (num_chunks * chunk_bytes > free_byte / 2)
+      num_chunks = (free_byte / 2) / chunk_bytes;
+    if (num_chunks < 1) num_chunks = 1;
+  }
+
+  lno_pool_t lno_pool(num_chunks, lnoChunkSize, lno_t(0),
+                      KokkosKernels::Impl::ManyThread2OneChunk);
+  scalar_pool_t scalar_pool(num_chunks, valueChunkSize,
+                            Kokkos::ArithTraits<scalar_t>::zero(),
+                            KokkosKernels::Impl::ManyThread2OneChunk);
+  const lno_t numTeams = (num_large + rows_per_team - 1) / rows_per_team;
+  Kokkos::parallel_for(
+      "KokkosSparse::spgemm_adaptive::large_rows",
+      Kokkos::TeamPolicy<ExecutionSpace>(numTeams, team_size, vector_size),
+      large_functor_t{num_small, m, numColsB, rows_per_team, rows, row_mapA,
+                      entriesA, valuesA, row_mapB, entriesB, valuesB,
+                      row_mapC, entriesC, valuesC, lno_pool, scalar_pool});
+}
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPGEMM_ADAPTIVE_IMPL_HPP_
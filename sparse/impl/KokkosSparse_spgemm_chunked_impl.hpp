@@ -0,0 +1,140 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_SPGEMM_CHUNKED_IMPL_HPP_
+#define KOKKOSSPARSE_SPGEMM_CHUNKED_IMPL_HPP_
+
+#include <limits>
+#include <vector>
+#include <Kokkos_Core.hpp>
+#include "KokkosKernels_ExecSpaceUtils.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+
+// Number of multiplications of row i of A*B: the sum of the lengths of the
+// rows of B selected by row i of A. This bounds the number of entries of
+// row i of A*B, and the work memory SpGEMM needs for it.
+template <class a_row_view_t, class a_entries_view_t, class b_row_view_t,
+          class flops_view_t>
+struct SpgemmRowFlopsFunctor {
+  using ordinal_type = typename a_entries_view_t::non_const_value_type;
+  using size_type    = typename flops_view_t::non_const_value_type;
+
+  a_row_view_t rowmapA;
+  a_entries_view_t entriesA;
+  b_row_view_t rowmapB;
+  flops_view_t flops;
+
+  SpgemmRowFlopsFunctor(const a_row_view_t& rowmapA_,
+                        const a_entries_view_t& entriesA_,
+                        const b_row_view_t& rowmapB_,
+                        const flops_view_t& flops_)
+      : rowmapA(rowmapA_),
+        entriesA(entriesA_),
+        rowmapB(rowmapB_),
+        flops(flops_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type i) const {
+    size_type f = 0;
+    for (auto q = rowmapA(i); q < rowmapA(i + 1); q++) {
+      const ordinal_type col = entriesA(q);
+      f += rowmapB(col + 1) - rowmapB(col);
+    }
+    flops(i) = f;
+  }
+};
+
+// Memory that SpGEMM may use on MemSpace for one chunk of rows: the given
+// bound if nonzero, otherwise half of the free device memory, so the
+// kernels' own work memory still fits. Host spaces have no bound.
+template <class ExecSpace, class MemSpace>
+size_t spgemm_chunk_budget(const size_t max_chunk_bytes) {
+  if (max_chunk_bytes) return max_chunk_bytes;
+  if constexpr (KokkosKernels::Impl::kk_is_gpu_exec_space<ExecSpace>()) {
+    size_t free_mem = 0, total_mem = 0;
+    KokkosKernels::Impl::kk_get_free_total_memory<MemSpace>(free_mem,
+                                                            total_mem);
+    return free_mem / 2;
+  }
+  return std::numeric_limits<size_t>::max();
+}
+
+// Split the rows of A into consecutive chunks [first[c], first[c+1]) such
+// that the estimated memory of each chunk's product, bytes_per_flop bytes
+// per multiplication, stays within budget. A chunk has at least one row,
+// so a single row over the budget gets a chunk of its own.
+template <class ExecSpace, class AMatrix, class BMatrix>
+std::vector<typename AMatrix::non_const_ordinal_type> spgemm_chunk_rows(
+    const AMatrix& A, const BMatrix& B, const size_t bytes_per_flop,
+    const size_t budget) {
+  using ordinal_type = typename AMatrix::non_const_ordinal_type;
+  using size_type    = typename AMatrix::non_const_size_type;
+  using flops_view_t = Kokkos::View<size_type*, ExecSpace>;
+  using functor_t =
+      SpgemmRowFlopsFunctor<typename AMatrix::row_map_type,
+                            typename AMatrix::index_type,
+                            typename BMatrix::row_map_type, flops_view_t>;
+
+  const ordinal_type numRows = A.numRows();
+  flops_view_t flops(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "SpGEMM row flops"),
+      numRows);
+  Kokkos::parallel_for(
+      "KokkosSparse::spgemm_chunked::row_flops",
+      Kokkos::RangePolicy<ExecSpace, Kokkos::IndexType<ordinal_type>>(
+          0, numRows),
+      functor_t(A.graph.row_map, A.graph.entries, B.graph.row_map, flops));
+  auto flops_h =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), flops);
+
+  std::vector<ordinal_type> first(1, 0);
+  size_t chunk_bytes = 0;
+  for (ordinal_type i = 0; i < numRows; i++) {
+    const size_t row_bytes = size_t(flops_h(i)) * bytes_per_flop;
+    if (i != first.back() && chunk_bytes + row_bytes > budget) {
+      first.push_back(i);
+      chunk_bytes = 0;
+    }
+    chunk_bytes += row_bytes;
+  }
+  first.push_back(numRows);
+  return first;
+}
+
+// Row map of rows [first, last) of A, shifted to start at 0
+template <class ExecSpace, class row_view_t, class row_view_host_t>
+typename row_view_t::non_const_type spgemm_chunk_rowmap(
+    const row_view_t& rowmap, const row_view_host_t& rowmap_h,
+    const size_t first, const size_t last) {
+  using size_type = typename row_view_t::non_const_value_type;
+  typename row_view_t::non_const_type chunk_rowmap(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "SpGEMM chunk rowmap"),
+      last - first + 1);
+  const size_type offset = rowmap_h(first);
+  Kokkos::parallel_for(
+      "KokkosSparse::spgemm_chunked::rowmap",
+      Kokkos::RangePolicy<ExecSpace>(0, last - first + 1),
+      KOKKOS_LAMBDA(const size_t i) {
+        chunk_rowmap(i) = rowmap(first + i) - offset;
+      });
+  return chunk_rowmap;
+}
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPGEMM_CHUNKED_IMPL_HPP_
@@ -533,13 +533,15 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
 
   // step-1 tranpose the first matrix.
   Kokkos::Timer timer1, timer_all;
-  row_lno_temp_work_view_t transpose_col_xadj("transpose_col_xadj",
-                                              b_row_cnt + 1);
+  row_lno_temp_work_view_t transpose_col_xadj(
+      Kokkos::view_alloc(space, "transpose_col_xadj"), b_row_cnt + 1);
   nnz_lno_temp_work_view_t transpose_col_adj(
-      Kokkos::view_alloc(Kokkos::WithoutInitializing, "transpose_col_adj"),
+      Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                         "transpose_col_adj"),
       entriesA.extent(0));
   scalar_temp_work_view_t tranpose_vals(
-      Kokkos::view_alloc(Kokkos::WithoutInitializing, "transpose_col_values"),
+      Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                         "transpose_col_values"),
       entriesA.extent(0));
 
   KokkosSparse::Impl::transpose_matrix<
@@ -549,7 +551,7 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
       a_row_cnt, b_row_cnt, row_mapA, entriesA, valsA, transpose_col_xadj,
       transpose_col_adj, tranpose_vals);
 
-  MyExecSpace().fence();
+  space.fence();
   if (KOKKOSKERNELS_VERBOSE) {
     std::cout
         << "\t\tTranspose FlopsPerRowOuterCal BlockPartition FastAllocation";
@@ -576,17 +578,17 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
   FlopsPerRowOuter<row_lno_temp_work_view_t, const_b_lno_row_view_t,
                    size_t_view_t>
       fpr(b_row_cnt, transpose_col_xadj, row_mapB, flop_per_row);
-  Kokkos::parallel_for(Kokkos::RangePolicy<MyExecSpace>(0, b_row_cnt), fpr);
-  MyExecSpace().fence();
+  Kokkos::parallel_for(Kokkos::RangePolicy<MyExecSpace>(space, 0, b_row_cnt),
+                       fpr);
+  space.fence();
 
-  KokkosKernels::Impl::exclusive_parallel_prefix_sum<size_t_view_t,
-                                                     MyExecSpace>(b_row_cnt + 1,
-                                                                  flop_per_row);
+  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum(space, b_row_cnt + 1,
+                                                        flop_per_row);
 
   auto num_flops   = Kokkos::subview(flop_per_row, b_row_cnt);
   auto h_num_flops = Kokkos::create_mirror_view(num_flops);
-  Kokkos::deep_copy(h_num_flops, num_flops);
-  MyExecSpace().fence();
+  Kokkos::deep_copy(space, h_num_flops, num_flops);
+  space.fence();
   size_t num_required_flops = h_num_flops();
 
   if (KOKKOSKERNELS_VERBOSE) {
@@ -645,7 +647,7 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
       ,
       block_size);
 
-  MyExecSpace().fence();
+  space.fence();
   if (KOKKOSKERNELS_VERBOSE) {
     std::cout << timer1.seconds() << " ";
     // std::cout << "\t\tAllocation WITH FIRST TOUCH TIME:" << timer1.seconds()
@@ -678,16 +680,16 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
 
     if (this->use_dynamic_schedule)
       Kokkos::parallel_for(
-          dynamic_team_policy_t(b_row_cnt / team_row_chunk_size + 1,
+          dynamic_team_policy_t(space, b_row_cnt / team_row_chunk_size + 1,
                                 suggested_team_size, suggested_vector_size),
           outer_product);
     else
       Kokkos::parallel_for(
-          team_policy_t(b_row_cnt / team_row_chunk_size + 1,
+          team_policy_t(space, b_row_cnt / team_row_chunk_size + 1,
                         suggested_team_size, suggested_vector_size),
           outer_product);
 
-    MyExecSpace().fence();
+    space.fence();
     if (KOKKOSKERNELS_VERBOSE) {
       outerproducttime += timer1.seconds();
       // std::cout << "\t\tOuter Product TIME:" << timer1.seconds() <<
@@ -718,7 +720,7 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
 
     timer1.reset();
     this->sort_triplets(fast_memory_triplets, num_block_flops);
-    MyExecSpace().fence();
+    space.fence();
     if (KOKKOSKERNELS_VERBOSE) {
       sorttime += timer1.seconds();
       // std::cout << "\t\tTriplet Sort Time:" << timer1.seconds() << std::endl;
@@ -731,7 +733,7 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
     size_type outsize = this->collapse_triplets_omp(
         fast_memory_triplets, num_block_flops, collapsed_fast_memory_triplets);
     overall_size += outsize;
-    MyExecSpace().fence();
+    space.fence();
     if (KOKKOSKERNELS_VERBOSE) {
       // std::cout << "\t\toutsize:" << outsize << std::endl;
       collapse_time += timer1.seconds();
@@ -749,7 +751,7 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
     KokkosKernels::Impl::kk_copy_vector<fast_triplet_view_t,
                                         slow_triplet_view_t, MyExecSpace>(
         outsize, collapsed_fast_memory_triplets, host_triplet_arrays[bi]);
-    MyExecSpace().fence();
+    space.fence();
     if (KOKKOSKERNELS_VERBOSE) {
       copy_to_slow_mem_time += timer1.seconds();
       // std::cout << "\t\tTriplet Copy To Slow Memory Time:" <<
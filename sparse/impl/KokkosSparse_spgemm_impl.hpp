@@ -29,6 +29,7 @@
 #include "KokkosKernels_HashmapAccumulator.hpp"
 #include "KokkosKernels_Uniform_Initialized_MemoryPool.hpp"
 #include "KokkosSparse_spgemm_handle.hpp"
+#include "KokkosSparse_spgemm_adaptive_impl.hpp"
 #include "KokkosGraph_Distance1Color.hpp"
 
 namespace KokkosSparse {
@@ -247,6 +248,8 @@ class KokkosSPGEMM {
       dynamic_team_policy_t;
 
  protected:
+  // Instance on which every kernel and temporary of the product is launched
+  MyExecSpace space;
   HandleType *handle;
   nnz_lno_t a_row_cnt;
   nnz_lno_t b_row_cnt;
@@ -584,7 +587,16 @@ class KokkosSPGEMM {
                const_a_lno_nnz_view_t entriesA_, bool transposeA_,
                const_b_lno_row_view_t row_mapB_,
                const_b_lno_nnz_view_t entriesB_, bool transposeB_)
-      : handle(handle_),
+      : KokkosSPGEMM(MyExecSpace(), handle_, m_, n_, k_, row_mapA_, entriesA_,
+                     transposeA_, row_mapB_, entriesB_, transposeB_) {}
+
+  KokkosSPGEMM(const MyExecSpace &space_, HandleType *handle_, nnz_lno_t m_,
+               nnz_lno_t n_, nnz_lno_t k_, const_a_lno_row_view_t row_mapA_,
+               const_a_lno_nnz_view_t entriesA_, bool transposeA_,
+               const_b_lno_row_view_t row_mapB_,
+               const_b_lno_nnz_view_t entriesB_, bool transposeB_)
+      : space(space_),
+        handle(handle_),
         a_row_cnt(m_),
         b_row_cnt(n_),
         b_col_cnt(k_),
@@ -597,7 +609,7 @@ class KokkosSPGEMM {
         valsB(),
         transposeB(transposeB_),
         shmem_size(handle_->get_shmem_size()),
-        concurrency(MyExecSpace().concurrency()),
+        concurrency(space_.concurrency()),
         use_dynamic_schedule(handle_->is_dynamic_scheduling()),
         KOKKOSKERNELS_VERBOSE(handle_->get_verbose()),
         MyEnumExecSpace(this->handle->get_handle_exec_space()),
@@ -615,7 +627,19 @@ class KokkosSPGEMM {
                const_b_lno_row_view_t row_mapB_,
                const_b_lno_nnz_view_t entriesB_,
                const_b_scalar_nnz_view_t valsB_, bool transposeB_)
-      : handle(handle_),
+      : KokkosSPGEMM(MyExecSpace(), handle_, m_, n_, k_, row_mapA_, entriesA_,
+                     valsA_, transposeA_, row_mapB_, entriesB_, valsB_,
+                     transposeB_) {}
+
+  KokkosSPGEMM(const MyExecSpace &space_, HandleType *handle_, nnz_lno_t m_,
+               nnz_lno_t n_, nnz_lno_t k_, const_a_lno_row_view_t row_mapA_,
+               const_a_lno_nnz_view_t entriesA_,
+               const_a_scalar_nnz_view_t valsA_, bool transposeA_,
+               const_b_lno_row_view_t row_mapB_,
+               const_b_lno_nnz_view_t entriesB_,
+               const_b_scalar_nnz_view_t valsB_, bool transposeB_)
+      : space(space_),
+        handle(handle_),
         a_row_cnt(m_),
         b_row_cnt(n_),
         b_col_cnt(k_),
@@ -628,7 +652,7 @@ class KokkosSPGEMM {
         valsB(valsB_),
         transposeB(transposeB_),
         shmem_size(handle_->get_shmem_size()),
-        concurrency(MyExecSpace().concurrency()),
+        concurrency(space_.concurrency()),
         use_dynamic_schedule(handle_->is_dynamic_scheduling()),
         KOKKOSKERNELS_VERBOSE(handle_->get_verbose()),
         MyEnumExecSpace(this->handle->get_handle_exec_space()),
@@ -813,7 +837,8 @@ class KokkosSPGEMM {
     auto new_row_mapB_end =
         Kokkos::subview(row_mapB, std::make_pair(nnz_lno_t(1), b_row_cnt + 1));
     row_lno_persistent_work_view_t flops_per_row(
-        Kokkos::view_alloc(Kokkos::WithoutInitializing, "original row flops"),
+        Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                           "original row flops"),
         a_row_cnt);
 
     // get maximum row flops.
@@ -822,9 +847,8 @@ class KokkosSPGEMM {
         flops_per_row.data());
 
     // calculate overal flops.
-    KokkosKernels::Impl::kk_reduce_view2<row_lno_persistent_work_view_t,
-                                         MyExecSpace>(a_row_cnt, flops_per_row,
-                                                      overall_flops);
+    KokkosKernels::Impl::kk_reduce_view2(space, a_row_cnt, flops_per_row,
+                                         overall_flops);
     if (KOKKOSKERNELS_VERBOSE) {
       std::cout << "\tOriginal Max Row Flops:" << maxNumRoughZeros << std::endl;
       std::cout << "\tOriginal overall_flops Flops:" << overall_flops
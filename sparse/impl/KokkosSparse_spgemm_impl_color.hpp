@@ -376,21 +376,21 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
         case SPGEMM_KK_COLOR:
           Kokkos::parallel_for(
               dynamic_team_numeric1_policy_t(
-                  (color_end - color_begin) / team_row_chunk_size + 1,
+                  space, (color_end - color_begin) / team_row_chunk_size + 1,
                   suggested_team_size, suggested_vector_size),
               sc);
           break;
         case SPGEMM_KK_MULTICOLOR2:
           Kokkos::parallel_for(
               dynamic_team_numeric2_policy_t(
-                  (color_end - color_begin) / team_row_chunk_size + 1,
+                  space, (color_end - color_begin) / team_row_chunk_size + 1,
                   suggested_team_size, suggested_vector_size),
               sc);
           break;
         case SPGEMM_KK_MULTICOLOR:
           Kokkos::parallel_for(
               dynamic_team_numeric3_policy_t(
-                  (color_end - color_begin) / team_row_chunk_size + 1,
+                  space, (color_end - color_begin) / team_row_chunk_size + 1,
                   suggested_team_size, suggested_vector_size),
               sc);
           break;
@@ -401,27 +401,27 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
         case SPGEMM_KK_COLOR:
           Kokkos::parallel_for(
               team_numeric1_policy_t(
-                  (color_end - color_begin) / team_row_chunk_size + 1,
+                  space, (color_end - color_begin) / team_row_chunk_size + 1,
                   suggested_team_size, suggested_vector_size),
               sc);
           break;
         case SPGEMM_KK_MULTICOLOR2:
           Kokkos::parallel_for(
               team_numeric2_policy_t(
-                  (color_end - color_begin) / team_row_chunk_size + 1,
+                  space, (color_end - color_begin) / team_row_chunk_size + 1,
                   suggested_team_size, suggested_vector_size),
               sc);
           break;
         case SPGEMM_KK_MULTICOLOR:
           Kokkos::parallel_for(
               team_numeric3_policy_t(
-                  (color_end - color_begin) / team_row_chunk_size + 1,
+                  space, (color_end - color_begin) / team_row_chunk_size + 1,
                   suggested_team_size, suggested_vector_size),
               sc);
           break;
       }
     }
-    MyExecSpace().fence();
+    space.fence();
   }
 
   if (KOKKOSKERNELS_VERBOSE) {
@@ -474,7 +474,7 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
     transpose_col_xadj =
         row_lno_temp_work_view_t("transpose_col_xadj", b_col_cnt + 1);
     transpose_col_adj = nnz_lno_temp_work_view_t(
-        Kokkos::view_alloc(Kokkos::WithoutInitializing, "tmp_row_view"),
+        Kokkos::view_alloc(space, Kokkos::WithoutInitializing, "tmp_row_view"),
         c_nnz_size);
 
     KokkosKernels::Impl::transpose_graph<
@@ -484,7 +484,7 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
         transpose_col_adj, suggested_vector_size, suggested_team_size,
         team_row_chunk_size, use_dynamic_schedule);
 
-    MyExecSpace().fence();
+    space.fence();
   }
   if (KOKKOSKERNELS_VERBOSE) {
     std::cout << "\t\tTranspose Time:" << timer1.seconds() << std::endl;
@@ -536,7 +536,7 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
       KokkosKernels::Impl::view_reduce_max<
           typename HandleType::GraphColoringHandleType::color_view_t,
           MyExecSpace>(a_row_cnt, vertex_color_view, original_num_colors);
-      MyExecSpace().fence();
+      space.fence();
 
       // KokkosKernels::Impl::kk_print_1Dview(vertex_color_view);
     }
@@ -544,14 +544,14 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
     num_colors_in_one_step = 1;
 
     vertex_colors_to_store = nnz_lno_persistent_work_view_t(
-        Kokkos::view_alloc(Kokkos::WithoutInitializing,
+        Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
                            "persistent_color_view"),
         a_row_cnt);
 
     if (KOKKOSKERNELS_VERBOSE) {
       // create histogram and print it.
       nnz_lno_temp_work_view_t histogram("histogram", original_num_colors + 1);
-      MyExecSpace().fence();
+      space.fence();
       timer1.reset();
       KokkosKernels::Impl::kk_get_histogram<
           typename HandleType::GraphColoringHandleType::color_view_t,
@@ -576,7 +576,7 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
         // a_row_cnt);
         tmp_color_view =
             typename HandleType::GraphColoringHandleType::color_view_t(
-                Kokkos::view_alloc(Kokkos::WithoutInitializing,
+                Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
                                    "tmp_color_view"),
                 a_row_cnt);
 
@@ -644,10 +644,12 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
 
       // allocate color xadj and adj arrays.
       color_xadj = nnz_lno_persistent_work_view_t(
-          Kokkos::view_alloc(Kokkos::WithoutInitializing, "Reverse xadj"),
+          Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                             "Reverse xadj"),
           num_multi_color_steps + 1);
       color_adj = nnz_lno_persistent_work_view_t(
-          Kokkos::view_alloc(Kokkos::WithoutInitializing, "Reverse xadj"),
+          Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                             "Reverse xadj"),
           a_row_cnt);
 
       // create reverse map from colors.
@@ -658,15 +660,15 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
           nnz_lno_persistent_work_view_t, MyExecSpace>(
           a_row_cnt, num_multi_color_steps, tmp_color_view, color_xadj,
           color_adj);
-      MyExecSpace().fence();
+      space.fence();
 
       if (KOKKOSKERNELS_VERBOSE) {
         std::cout << "\t\tReverse Map Create Time:" << timer1.seconds()
                   << std::endl;
       }
       h_color_xadj = Kokkos::create_mirror_view(color_xadj);
-      Kokkos::deep_copy(h_color_xadj, color_xadj);
-      MyExecSpace().fence();
+      Kokkos::deep_copy(space, h_color_xadj, color_xadj);
+      space.fence();
     }
     this->handle->destroy_graph_coloring_handle();
   }
@@ -760,12 +760,14 @@ bool KokkosSPGEMM<
 #ifdef KOKKOSKERNELSMOREMEM
   if (exec_gpu) {
     set_nexts_ = out_nnz_view_t(
-        Kokkos::view_alloc(Kokkos::WithoutInitializing, "set_nexts_"), nnz);
+        Kokkos::view_alloc(space, Kokkos::WithoutInitializing, "set_nexts_"),
+        nnz);
     set_begins_ = out_nnz_view_t(
-        Kokkos::view_alloc(Kokkos::WithoutInitializing, "set_begins_"), nnz);
-    Kokkos::deep_copy(set_begins_, -1);
+        Kokkos::view_alloc(space, Kokkos::WithoutInitializing, "set_begins_"),
+        nnz);
+    Kokkos::deep_copy(space, set_begins_, -1);
   }
-  MyExecSpace().fence();
+  space.fence();
 #endif
 
   if (KOKKOSKERNELS_VERBOSE) {
@@ -778,9 +780,11 @@ bool KokkosSPGEMM<
 
   if (compress_in_single_step || exec_gpu) {
     out_nnz_indices = out_nnz_view_t(
-        Kokkos::view_alloc(Kokkos::WithoutInitializing, "set_entries_"), nnz);
+        Kokkos::view_alloc(space, Kokkos::WithoutInitializing, "set_entries_"),
+        nnz);
     out_nnz_sets = out_nnz_view_t(
-        Kokkos::view_alloc(Kokkos::WithoutInitializing, "set_indices_"), nnz);
+        Kokkos::view_alloc(space, Kokkos::WithoutInitializing, "set_indices_"),
+        nnz);
   }
   typedef KokkosKernels::Impl::UniformMemoryPool<MyTempMemorySpace, nnz_lno_t>
       pool_memory_space;
@@ -816,7 +820,7 @@ bool KokkosSPGEMM<
     size_type max_row_nnz = 0;
     KokkosKernels::Impl::view_reduce_maxsizerow<in_row_view_t, MyExecSpace>(
         n, in_row_map, max_row_nnz);
-    MyExecSpace().fence();
+    space.fence();
     KokkosKernels::Impl::PoolType my_pool_type =
         KokkosKernels::Impl::ManyThread2OneChunk;
 
@@ -847,13 +851,13 @@ bool KokkosSPGEMM<
     nnz_lno_t pool_init_val = -1;
     pool_memory_space m_space(num_chunks, chunksize, pool_init_val,
                               my_pool_type);
-    MyExecSpace().fence();
+    space.fence();
     sszm_compressMatrix.memory_space = m_space;
 #endif
     Kokkos::parallel_for(
         "KokkosSparse::SingleStepZipMatrix::GPUEXEC",
-        gpu_team_policy_t(n / suggested_team_size + 1, suggested_team_size,
-                          suggested_vector_size),
+        gpu_team_policy_t(space, n / suggested_team_size + 1,
+                          suggested_team_size, suggested_vector_size),
         sszm_compressMatrix);
   } else {
     if (!compress_in_single_step) {
@@ -864,7 +868,7 @@ bool KokkosSPGEMM<
           KokkosKernels::Impl::view_reduce_maxsizerow<in_row_view_t,
                                                       MyExecSpace>(
               n, in_row_map, max_row_nnz);
-        MyExecSpace().fence();
+        space.fence();
         KokkosKernels::Impl::PoolType my_pool_type =
             KokkosKernels::Impl::OneThread2OneChunk;
 
@@ -895,7 +899,7 @@ bool KokkosSPGEMM<
         nnz_lno_t pool_init_val = -1;
         pool_memory_space m_space(num_chunks, chunksize, pool_init_val,
                                   my_pool_type);
-        MyExecSpace().fence();
+        space.fence();
         sszm_compressMatrix.memory_space = m_space;
       }
 
@@ -904,24 +908,23 @@ bool KokkosSPGEMM<
       if (use_unordered_compress)
         Kokkos::parallel_for(
             "KokkosSparse::TwoStepZipMatrix::use_unordered_compress",
-            team_count2_policy_t(n / team_row_chunk_size + 1,
+            team_count2_policy_t(space, n / team_row_chunk_size + 1,
                                  suggested_team_size, suggested_vector_size),
             sszm_compressMatrix);
       else
         Kokkos::parallel_for(
             "KokkosSparse::TwoStepZipMatrix::use_ordered_compress",
-            team_count_policy_t(n / team_row_chunk_size + 1,
+            team_count_policy_t(space, n / team_row_chunk_size + 1,
                                 suggested_team_size, suggested_vector_size),
             sszm_compressMatrix);
 
-      MyExecSpace().fence();
+      space.fence();
       if (KOKKOSKERNELS_VERBOSE) {
         std::cout << "\t\tCompression Count Kernel:" << timer_count.seconds()
                   << std::endl;
       }
-      KokkosKernels::Impl::exclusive_parallel_prefix_sum<out_rowmap_view_t,
-                                                         MyExecSpace>(
-          n + 1, out_row_map);
+      KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum(space, n + 1,
+                                                            out_row_map);
 
       {
         nnz_lno_t compressed_maxNumRoughZeros = 0;
@@ -932,16 +935,16 @@ bool KokkosSPGEMM<
         auto new_row_mapB_end = Kokkos::subview(
             out_row_map, std::make_pair(nnz_lno_t(1), b_row_cnt + 1));
         row_lno_persistent_work_view_t compressed_flops_per_row(
-            Kokkos::view_alloc(Kokkos::WithoutInitializing,
+            Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
                                "origianal row flops"),
             a_row_cnt);
 
         compressed_maxNumRoughZeros = this->getMaxRoughRowNNZ(
             a_row_cnt, row_mapA, entriesA, new_row_mapB_begin, new_row_mapB_end,
             compressed_flops_per_row.data());
-        KokkosKernels::Impl::kk_reduce_view2<row_lno_persistent_work_view_t,
-                                             MyExecSpace>(
-            a_row_cnt, compressed_flops_per_row, compressedoverall_flops);
+        KokkosKernels::Impl::kk_reduce_view2(space, a_row_cnt,
+                                             compressed_flops_per_row,
+                                             compressedoverall_flops);
         double ratio = 0;
         if (OriginaltotalFlops)
           ratio = compressedoverall_flops / ((double)OriginaltotalFlops);
@@ -967,16 +970,19 @@ bool KokkosSPGEMM<
 
       auto d_c_nnz_size = Kokkos::subview(out_row_map, n);
       auto h_c_nnz_size = Kokkos::create_mirror_view(d_c_nnz_size);
-      Kokkos::deep_copy(h_c_nnz_size, d_c_nnz_size);
+      Kokkos::deep_copy(space, h_c_nnz_size, d_c_nnz_size);
+      space.fence();
       typename out_rowmap_view_t::non_const_value_type compressed_b_size =
           h_c_nnz_size();
 
       // std::cout << "\tcompressed_b_size:" <<compressed_b_size << std::endl;
       out_nnz_indices = out_nnz_view_t(
-          Kokkos::view_alloc(Kokkos::WithoutInitializing, "set_entries_"),
+          Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                             "set_entries_"),
           compressed_b_size);
       out_nnz_sets = out_nnz_view_t(
-          Kokkos::view_alloc(Kokkos::WithoutInitializing, "set_indices_"),
+          Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                             "set_indices_"),
           compressed_b_size);
 
       sszm_compressMatrix.set_index_entries = out_nnz_indices;
@@ -987,26 +993,26 @@ bool KokkosSPGEMM<
       if (use_unordered_compress)
         Kokkos::parallel_for(
             "KokkosSparse::TwoStepZipMatrix::fill::use_unordered_compress",
-            team_fill2_policy_t(n / team_row_chunk_size + 1,
+            team_fill2_policy_t(space, n / team_row_chunk_size + 1,
                                 suggested_team_size, suggested_vector_size),
             sszm_compressMatrix);
       else
         Kokkos::parallel_for(
             "KokkosSparse::TwoStepZipMatrix::fill::use_unordered_compress",
-            team_fill_policy_t(n / team_row_chunk_size + 1, suggested_team_size,
-                               suggested_vector_size),
+            team_fill_policy_t(space, n / team_row_chunk_size + 1,
+                               suggested_team_size, suggested_vector_size),
             sszm_compressMatrix);
       return true;
     } else {
       // USING DYNAMIC SCHEDULE HERE SLOWS DOWN SIGNIFICANTLY WITH HYPERTHREADS
       Kokkos::parallel_for(
           "KokkosSparse::SingleStepZipMatrix::fill::use_unordered_compress",
-          multicore_team_policy_t(n / team_row_chunk_size + 1,
+          multicore_team_policy_t(space, n / team_row_chunk_size + 1,
                                   suggested_team_size, suggested_vector_size),
           sszm_compressMatrix);
     }
   }
-  MyExecSpace().fence();
+  space.fence();
   if (KOKKOSKERNELS_VERBOSE) {
     std::cout << "\t\tCompression Kernel time:" << timer1.seconds()
               << std::endl;
@@ -1018,15 +1024,16 @@ bool KokkosSPGEMM<
     auto new_row_mapB_begin = in_row_map;
     auto new_row_mapB_end   = out_row_map;
     row_lno_persistent_work_view_t compressed_flops_per_row(
-        Kokkos::view_alloc(Kokkos::WithoutInitializing, "origianal row flops"),
+        Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                           "origianal row flops"),
         a_row_cnt);
 
     compressed_maxNumRoughZeros = this->getMaxRoughRowNNZ(
         a_row_cnt, row_mapA, entriesA, new_row_mapB_begin, new_row_mapB_end,
         compressed_flops_per_row.data());
-    KokkosKernels::Impl::kk_reduce_view2<row_lno_persistent_work_view_t,
-                                         MyExecSpace>(
-        a_row_cnt, compressed_flops_per_row, compressedoverall_flops);
+    KokkosKernels::Impl::kk_reduce_view2(space, a_row_cnt,
+                                         compressed_flops_per_row,
+                                         compressedoverall_flops);
     double ratio = 0;
     if (OriginaltotalFlops)
       ratio = compressedoverall_flops / ((double)OriginaltotalFlops);
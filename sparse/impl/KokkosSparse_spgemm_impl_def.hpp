@@ -40,8 +40,14 @@ void KokkosSPGEMM<
     std::cout << "Numeric PHASE" << std::endl;
   }
 
-  if (spgemm_algorithm == SPGEMM_KK_SPEED ||
-      spgemm_algorithm == SPGEMM_KK_DENSE) {
+  if (spgemm_accumulator == SPGEMM_ACC_ADAPTIVE && !transposeA &&
+      !transposeB) {
+    KokkosSparse::Impl::spgemm_numeric_adaptive<MyExecSpace,
+                                                MyTempMemorySpace>(
+        a_row_cnt, b_col_cnt, row_mapA, entriesA, valsA, row_mapB, entriesB,
+        valsB, rowmapC_, entriesC_, valuesC_);
+  } else if (spgemm_algorithm == SPGEMM_KK_SPEED ||
+             spgemm_algorithm == SPGEMM_KK_DENSE) {
     this->KokkosSPGEMM_numeric_speed(rowmapC_, entriesC_, valuesC_,
                                      my_exec_space_);
   } else {
@@ -78,7 +84,8 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
 
     // compressed B fields.
     row_lno_temp_work_view_t new_row_mapB(
-        Kokkos::view_alloc(Kokkos::WithoutInitializing, "new row map"), n + 1);
+        Kokkos::view_alloc(space, Kokkos::WithoutInitializing, "new row map"),
+        n + 1);
     row_lno_temp_work_view_t new_row_mapB_begins;
 
     nnz_lno_temp_work_view_t
@@ -180,11 +187,12 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
 
   nnz_lno_persistent_work_host_view_t h_color_adj =
       Kokkos::create_mirror_view(color_adj);
-  Kokkos::deep_copy(h_color_adj, color_adj);
+  Kokkos::deep_copy(space, h_color_adj, color_adj);
   auto h_rowmapC = Kokkos::create_mirror_view(rowmapC);
-  Kokkos::deep_copy(h_rowmapC, rowmapC);
+  Kokkos::deep_copy(space, h_rowmapC, rowmapC);
   auto h_entryIndicesC = Kokkos::create_mirror_view(entryIndicesC_);
-  Kokkos::deep_copy(h_entryIndicesC, entryIndicesC_);
+  Kokkos::deep_copy(space, h_entryIndicesC, entryIndicesC_);
+  space.fence();
 
   for (nnz_lno_t i = 0; i < num_colors; ++i) {
     nnz_lno_t color_begin = h_color_xadj(i);
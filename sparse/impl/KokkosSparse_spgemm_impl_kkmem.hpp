@@ -1570,12 +1570,12 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
       KokkosKernels::Impl::OneThread2OneChunk;
 
   if (KokkosKernels::Impl::kk_is_gpu_exec_space<MyExecSpace>()) {
-    my_pool_type = KokkosKernels::Impl::ManyThread2OneChunk;
+    my_pool_type = KokkosKernels::Impl::CachedManyThread2OneChunk;
   }
 
   Kokkos::Timer timer1;
   pool_memory_space m_space(num_chunks, chunksize, -1, my_pool_type);
-  MyExecSpace().fence();
+  space.fence();
 
   if (KOKKOSKERNELS_VERBOSE) {
     m_space.print_memory_pool();
@@ -1622,10 +1622,10 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
       }
       Kokkos::parallel_for(
           "KOKKOSPARSE::SPGEMM::SPGEMM_KK_MEMORY_SPREADTEAM",
-          gpu_team_policy4_t(a_row_cnt / team_row_chunk_size + 1,
+          gpu_team_policy4_t(space, a_row_cnt / team_row_chunk_size + 1,
                              suggested_team_size, suggested_vector_size),
           sc);
-      MyExecSpace().fence();
+      space.fence();
 
     } else if (algorithm_to_run == SPGEMM_KK_MEMORY_BIGSPREADTEAM) {
       if (thread_shmem_key_size <= 0) {
@@ -1641,7 +1641,7 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
       }
       Kokkos::parallel_for(
           "KOKKOSPARSE::SPGEMM::SPGEMM_KK_MEMORY_BIGSPREADTEAM",
-          gpu_team_policy6_t(a_row_cnt / team_row_chunk_size + 1,
+          gpu_team_policy6_t(space, a_row_cnt / team_row_chunk_size + 1,
                              suggested_team_size, suggested_vector_size),
           sc);
     } else {
@@ -1658,23 +1658,23 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
       }
       Kokkos::parallel_for(
           "KOKKOSPARSE::SPGEMM::SPGEMM_KK_MEMORY",
-          gpu_team_policy_t(a_row_cnt / team_row_chunk_size + 1,
+          gpu_team_policy_t(space, a_row_cnt / team_row_chunk_size + 1,
                             suggested_team_size, suggested_vector_size),
           sc);
     }
-    MyExecSpace().fence();
+    space.fence();
   } else {
     if (algorithm_to_run == SPGEMM_KK_LP) {
       if (use_dynamic_schedule) {
         Kokkos::parallel_for("KOKKOSPARSE::SPGEMM::SPGEMM_KK_LP::DYNAMIC",
                              dynamic_multicore_team_policy4_t(
-                                 a_row_cnt / team_row_chunk_size + 1,
+                                 space, a_row_cnt / team_row_chunk_size + 1,
                                  suggested_team_size, suggested_vector_size),
                              sc);
       } else {
         Kokkos::parallel_for("KOKKOSPARSE::SPGEMM::SPGEMM_KK_LP::STATIC",
                              multicore_team_policy4_t(
-                                 a_row_cnt / team_row_chunk_size + 1,
+                                 space, a_row_cnt / team_row_chunk_size + 1,
                                  suggested_team_size, suggested_vector_size),
                              sc);
       }
@@ -1682,18 +1682,18 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
       if (use_dynamic_schedule) {
         Kokkos::parallel_for("KOKKOSPARSE::SPGEMM::KKMEM::DYNAMIC",
                              dynamic_multicore_team_policy_t(
-                                 a_row_cnt / team_row_chunk_size + 1,
+                                 space, a_row_cnt / team_row_chunk_size + 1,
                                  suggested_team_size, suggested_vector_size),
                              sc);
       } else {
         Kokkos::parallel_for(
             "KOKKOSPARSE::SPGEMM::KKMEM::STATIC",
-            multicore_team_policy_t(a_row_cnt / team_row_chunk_size + 1,
+            multicore_team_policy_t(space, a_row_cnt / team_row_chunk_size + 1,
                                     suggested_team_size, suggested_vector_size),
             sc);
       }
     }
-    MyExecSpace().fence();
+    space.fence();
   }
 
   if (KOKKOSKERNELS_VERBOSE) {
@@ -1759,12 +1759,12 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
   KokkosKernels::Impl::PoolType my_pool_type =
       KokkosKernels::Impl::OneThread2OneChunk;
   if (KokkosKernels::Impl::kk_is_gpu_exec_space<my_exec_space>()) {
-    my_pool_type = KokkosKernels::Impl::ManyThread2OneChunk;
+    my_pool_type = KokkosKernels::Impl::CachedManyThread2OneChunk;
   }
 
   Kokkos::Timer timer1;
   pool_memory_space m_space(num_chunks, chunksize, -1, my_pool_type);
-  MyExecSpace().fence();
+  space.fence();
 
   if (KOKKOSKERNELS_VERBOSE) {
     std::cout << "\t\tPool Alloc Time:" << timer1.seconds() << std::endl;
@@ -1798,25 +1798,25 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
   if (KokkosKernels::Impl::kk_is_gpu_exec_space<my_exec_space>()) {
     Kokkos::parallel_for(
         "KOKKOSPARSE::SPGEMM::SPGEMM_KK_MEMORY2",
-        gpu_team_policy_t(a_row_cnt / team_row_chunk_size + 1,
+        gpu_team_policy_t(space, a_row_cnt / team_row_chunk_size + 1,
                           suggested_team_size, suggested_vector_size),
         sc);
-    MyExecSpace().fence();
+    space.fence();
   } else {
     if (use_dynamic_schedule) {
       Kokkos::parallel_for("KOKKOSPARSE::SPGEMM::SPGEMM_KK_MEMORY_DYNAMIC",
                            dynamic_multicore_team_policy2_t(
-                               a_row_cnt / team_row_chunk_size + 1,
+                               space, a_row_cnt / team_row_chunk_size + 1,
                                suggested_team_size, suggested_vector_size),
                            sc);
     } else {
       Kokkos::parallel_for(
           "KOKKOSPARSE::SPGEMM::SPGEMM_KK_MEMORY_STATIC",
-          multicore_team_policy2_t(a_row_cnt / team_row_chunk_size + 1,
+          multicore_team_policy2_t(space, a_row_cnt / team_row_chunk_size + 1,
                                    suggested_team_size, suggested_vector_size),
           sc);
     }
-    MyExecSpace().fence();
+    space.fence();
   }
 
   if (KOKKOSKERNELS_VERBOSE) {
@@ -229,16 +229,15 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
 
   // calculate how many flops per row is performed
   Kokkos::parallel_reduce(
-      team_count_policy_t(a_row_cnt / team_row_chunk_size + 1,
+      team_count_policy_t(space, a_row_cnt / team_row_chunk_size + 1,
                           suggested_team_size, suggested_vector_size),
       pcnnnz, overall_flops);
-  MyExecSpace().fence();
+  space.fence();
 
   // do a parallel prefix sum
-  KokkosKernels::Impl::exclusive_parallel_prefix_sum<row_lno_temp_work_view_t,
-                                                     MyExecSpace>(
-      a_row_cnt + 1, c_flop_rowmap);
-  MyExecSpace().fence();
+  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum(space, a_row_cnt + 1,
+                                                        c_flop_rowmap);
+  space.fence();
 
   std::cout << "overall_flops:" << overall_flops << std::endl;
 
@@ -258,10 +257,10 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
   // fill the hypergraph values.
   // indices of nnzs for a and b nets, for c nets, the row and column index.
   Kokkos::parallel_for(
-      team_fill_policy_t(a_row_cnt / team_row_chunk_size + 1,
+      team_fill_policy_t(space, a_row_cnt / team_row_chunk_size + 1,
                          suggested_team_size, suggested_vector_size),
       pcnnnz);
-  MyExecSpace().fence();
+  space.fence();
 }
 
 template <typename HandleType, typename a_row_view_t_,
@@ -315,11 +314,12 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
   typename nnz_lno_temp_work_view_t::HostMirror h_c_comp_col_index =
       Kokkos::create_mirror_view(c_comp_col_index);
 
-  Kokkos::deep_copy(h_c_flop_rowmap, c_flop_rowmap);
-  Kokkos::deep_copy(h_c_comp_a_net_index, c_comp_a_net_index);
-  Kokkos::deep_copy(h_c_comp_b_net_index, c_comp_b_net_index);
-  Kokkos::deep_copy(h_c_comp_row_index, c_comp_row_index);
-  Kokkos::deep_copy(h_c_comp_col_index, c_comp_col_index);
+  Kokkos::deep_copy(space, h_c_flop_rowmap, c_flop_rowmap);
+  Kokkos::deep_copy(space, h_c_comp_a_net_index, c_comp_a_net_index);
+  Kokkos::deep_copy(space, h_c_comp_b_net_index, c_comp_b_net_index);
+  Kokkos::deep_copy(space, h_c_comp_row_index, c_comp_row_index);
+  Kokkos::deep_copy(space, h_c_comp_col_index, c_comp_col_index);
+  space.fence();
 
   // nnz_lno_t num_parallel_colors = 1;
   bool isGPU = false;
@@ -349,8 +349,9 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
     KokkosKernels::Impl::print_1Dview(color_xadj);
     h_color_adj     = Kokkos::create_mirror_view(color_adj);
     h_vertex_colors = Kokkos::create_mirror_view(vertex_colors);
-    Kokkos::deep_copy(h_color_adj, color_adj);
-    Kokkos::deep_copy(h_vertex_colors, vertex_colors);
+    Kokkos::deep_copy(space, h_color_adj, color_adj);
+    Kokkos::deep_copy(space, h_vertex_colors, vertex_colors);
+    space.fence();
   } else if (write_type == 4) {
     // num_used_colors_steps  = num_colors / num_multi_colors;
     // if (num_colors % num_multi_colors) num_used_colors_steps++;
@@ -360,8 +361,9 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
     KokkosKernels::Impl::print_1Dview(color_xadj);
     h_color_adj     = Kokkos::create_mirror_view(color_adj);
     h_vertex_colors = Kokkos::create_mirror_view(vertex_colors);
-    Kokkos::deep_copy(h_color_adj, color_adj);
-    Kokkos::deep_copy(h_vertex_colors, vertex_colors);
+    Kokkos::deep_copy(space, h_color_adj, color_adj);
+    Kokkos::deep_copy(space, h_vertex_colors, vertex_colors);
+    space.fence();
   } else {
     num_used_colors_steps = 1;
     num_multi_colors      = 1;
@@ -382,7 +384,8 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
 
   typename c_row_view_t::HostMirror h_c_rowmap =
       Kokkos::create_mirror_view(rowmapC);
-  Kokkos::deep_copy(h_c_rowmap, rowmapC);
+  Kokkos::deep_copy(space, h_c_rowmap, rowmapC);
+  space.fence();
 
   /*
   isGPU = true;
@@ -456,7 +459,8 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
   typename nnz_lno_temp_work_view_t::HostMirror tester("t", overall_flops);
   typename c_row_view_t::HostMirror h_rowmapC =
       Kokkos::create_mirror_view(rowmapC);
-  Kokkos::deep_copy(h_rowmapC, rowmapC);
+  Kokkos::deep_copy(space, h_rowmapC, rowmapC);
+  space.fence();
 
   size_t overall_a_l1_missread = 0;
   size_t overall_b_l1_missread = 0;
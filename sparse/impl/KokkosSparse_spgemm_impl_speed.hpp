@@ -487,14 +487,15 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
 
   if (KokkosKernels::Impl::kk_is_gpu_exec_space<
           typename HandleType::HandleExecSpace>()) {
-    // allocate memory for begins and next to be used by the hashmap
-    nnz_lno_temp_work_view_t beginsC(
-        Kokkos::view_alloc(Kokkos::WithoutInitializing, "C keys"),
-        valuesC_.extent(0));
-    nnz_lno_temp_work_view_t nextsC(
-        Kokkos::view_alloc(Kokkos::WithoutInitializing, "C nexts"),
-        valuesC_.extent(0));
-    Kokkos::deep_copy(beginsC, -1);
+    // allocate memory for begins and next to be used by the hashmap, from
+    // the workspace of the handle if it has one
+    typename HandleType::SPGEMMHandleType::workspace_t::Scope work(
+        this->handle->get_spgemm_handle()->get_workspace());
+    auto beginsC = work.template view<nnz_lno_temp_work_view_t>(
+        "C keys", false, valuesC_.extent(0));
+    auto nextsC = work.template view<nnz_lno_temp_work_view_t>(
+        "C nexts", false, valuesC_.extent(0));
+    Kokkos::deep_copy(space, beginsC, -1);
 
     // create the functor.
     NumericCMEM<const_a_lno_row_view_t, const_a_lno_nnz_view_t,
@@ -511,7 +512,7 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
            team_row_chunk_size, suggested_team_size, KOKKOSKERNELS_VERBOSE);
 
     Kokkos::Timer timer1;
-    MyExecSpace().fence();
+    space.fence();
 
     if (KOKKOSKERNELS_VERBOSE) {
       std::cout << "\t\tGPU vector_size:" << suggested_vector_size
@@ -524,10 +525,10 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
     // only executed for to check the effect of memory pools.
     Kokkos::parallel_for(
         "KokkosSparse::NumericCMEM::KKSPEED::GPU",
-        gpu_team_policy_t(a_row_cnt / team_row_chunk_size + 1,
+        gpu_team_policy_t(space, a_row_cnt / team_row_chunk_size + 1,
                           suggested_team_size, suggested_vector_size),
         sc);
-    MyExecSpace().fence();
+    space.fence();
 
     if (KOKKOSKERNELS_VERBOSE) {
       std::cout << "\t\tNumeric TIME:" << timer1.seconds() << std::endl;
@@ -545,7 +546,7 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
     pool_memory_space m_space(
         num_chunks, this->b_col_cnt + (this->b_col_cnt) / sizeof(scalar_t) + 1,
         0, my_pool_type);
-    MyExecSpace().fence();
+    space.fence();
 
     if (KOKKOSKERNELS_VERBOSE) {
       std::cout << "\t\tPool Alloc Time:" << timer1.seconds() << std::endl;
@@ -570,7 +571,7 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
            rowmapC_, entriesC_, valuesC_, m_space, my_exec_space_,
            team_row_chunk_size);
 
-    MyExecSpace().fence();
+    space.fence();
     if (KOKKOSKERNELS_VERBOSE) {
       std::cout << "\t\tCPU vector_size:" << suggested_vector_size
                 << " team_size:" << suggested_team_size
@@ -581,18 +582,18 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
     if (use_dynamic_schedule) {
       Kokkos::parallel_for("KokkosSparse::NumericCMEM_CPU::DENSE::DYNAMIC",
                            dynamic_multicore_team_policy_t(
-                               a_row_cnt / team_row_chunk_size + 1,
+                               space, a_row_cnt / team_row_chunk_size + 1,
                                suggested_team_size, suggested_vector_size),
                            sc);
     } else {
       Kokkos::parallel_for(
           "KokkosSparse::NumericCMEM_CPU::DENSE::STATIC",
-          multicore_team_policy_t(a_row_cnt / team_row_chunk_size + 1,
+          multicore_team_policy_t(space, a_row_cnt / team_row_chunk_size + 1,
                                   suggested_team_size, suggested_vector_size),
           sc);
     }
 
-    MyExecSpace().fence();
+    space.fence();
 
     if (KOKKOSKERNELS_VERBOSE) {
       std::cout << "\t\tNumeric TIME:" << timer1.seconds() << std::endl;
@@ -1592,7 +1592,7 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
   }
   Kokkos::Timer timer1;
   pool_memory_space m_space(num_chunks, chunksize, pool_init_val, my_pool_type);
-  MyExecSpace().fence();
+  space.fence();
 
   if (KOKKOSKERNELS_VERBOSE) {
     std::cout << "\tPool Alloc Time:" << timer1.seconds() << std::endl;
@@ -1618,21 +1618,21 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
   if (exec_gpu) {
     Kokkos::parallel_for(
         "StructureC_NC::GPU_EXEC",
-        gpu_team_policy_t(m / suggested_team_size + 1, suggested_team_size,
-                          suggested_vector_size),
+        gpu_team_policy_t(space, m / suggested_team_size + 1,
+                          suggested_team_size, suggested_vector_size),
         sc);
   } else {
     if (current_spgemm_algorithm == SPGEMM_KK_DENSE) {
       if (use_dynamic_schedule) {
         Kokkos::parallel_for("KokkosSparse::StructureC_NC::DENSE_DYNAMIC",
                              dynamic_multicore_dense_team_count_policy_t(
-                                 m / team_row_chunk_size + 1,
+                                 space, m / team_row_chunk_size + 1,
                                  suggested_team_size, suggested_vector_size),
                              sc);
       } else {
         Kokkos::parallel_for("KokkosSparse::StructureC_NC::DENSE_STATIC",
                              multicore_dense_team_count_policy_t(
-                                 m / team_row_chunk_size + 1,
+                                 space, m / team_row_chunk_size + 1,
                                  suggested_team_size, suggested_vector_size),
                              sc);
       }
@@ -1640,13 +1640,13 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
       if (use_dynamic_schedule) {
         Kokkos::parallel_for("KokkosSparse::StructureC_NC::LP_DYNAMIC",
                              dynamic_multicore_team_policy4_t(
-                                 m / team_row_chunk_size + 1,
+                                 space, m / team_row_chunk_size + 1,
                                  suggested_team_size, suggested_vector_size),
                              sc);
       } else {
         Kokkos::parallel_for("KokkosSparse::StructureC_NC::LP_STATIC",
                              multicore_team_policy4_t(
-                                 m / team_row_chunk_size + 1,
+                                 space, m / team_row_chunk_size + 1,
                                  suggested_team_size, suggested_vector_size),
                              sc);
       }
@@ -1654,26 +1654,26 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
       if (use_dynamic_schedule) {
         Kokkos::parallel_for("KokkosSparse::StructureC_NC::KKMEM_DYNAMIC",
                              dynamic_multicore_team_policy_t(
-                                 m / team_row_chunk_size + 1,
+                                 space, m / team_row_chunk_size + 1,
                                  suggested_team_size, suggested_vector_size),
                              sc);
       } else {
         Kokkos::parallel_for(
             "KokkosSparse::StructureC_NC::KKMEM_STATIC",
-            multicore_team_policy_t(m / team_row_chunk_size + 1,
+            multicore_team_policy_t(space, m / team_row_chunk_size + 1,
                                     suggested_team_size, suggested_vector_size),
             sc);
       }
     }
   }
-  MyExecSpace().fence();
+  space.fence();
   if (KOKKOSKERNELS_VERBOSE) {
     std::cout << "\tStructureC Kernel time:" << timer1.seconds() << std::endl
               << std::endl;
   }
   typename c_row_view_t::non_const_value_type c_nnz_size = 0;
-  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum<MyExecSpace>(
-      m + 1, rowmapC, c_nnz_size);
+  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum(space, m + 1, rowmapC,
+                                                        c_nnz_size);
   this->handle->get_spgemm_handle()->set_c_nnz(c_nnz_size);
   nnz_lno_t c_max_nnz =
       KokkosSparse::Impl::graph_max_degree<MyExecSpace, size_type,
@@ -1929,7 +1929,7 @@ void KokkosSPGEMM<
   }
   Kokkos::Timer timer1;
   pool_memory_space m_space(num_chunks, chunksize, pool_init_val, my_pool_type);
-  MyExecSpace().fence();
+  space.fence();
 
   if (KOKKOSKERNELS_VERBOSE) {
     std::cout << "\tPool Alloc Time:" << timer1.seconds() << std::endl;
@@ -1956,8 +1956,8 @@ void KokkosSPGEMM<
   if (exec_gpu) {
     Kokkos::parallel_for(
         "KokkosSparse::StructureC::GPU_EXEC",
-        gpu_team_policy_t(m / suggested_team_size + 1, suggested_team_size,
-                          suggested_vector_size),
+        gpu_team_policy_t(space, m / suggested_team_size + 1,
+                          suggested_team_size, suggested_vector_size),
         sc);
   } else {
     if (current_spgemm_algorithm == SPGEMM_KK_DENSE) {
@@ -1965,28 +1965,28 @@ void KokkosSPGEMM<
         Kokkos::parallel_for(
             "KokkosSparse::StructureC::SPGEMM_KK_DENSE::DYNAMIC",
             dynamic_multicore_dense_team_count_policy_t(
-                m / team_row_chunk_size + 1, suggested_team_size,
+                space, m / team_row_chunk_size + 1, suggested_team_size,
                 suggested_vector_size),
             sc);
       } else {
         Kokkos::parallel_for(
             "KokkosSparse::StructureC::SPGEMM_KK_DENSE::STATIC",
-            multicore_dense_team_count_policy_t(m / team_row_chunk_size + 1,
-                                                suggested_team_size,
-                                                suggested_vector_size),
+            multicore_dense_team_count_policy_t(
+                space, m / team_row_chunk_size + 1, suggested_team_size,
+                suggested_vector_size),
             sc);
       }
     } else if (current_spgemm_algorithm == SPGEMM_KK_LP) {
       if (use_dynamic_schedule) {
         Kokkos::parallel_for("KokkosSparse::StructureC::SPGEMM_KK_LP::DYNAMIC",
                              dynamic_multicore_team_policy4_t(
-                                 m / team_row_chunk_size + 1,
+                                 space, m / team_row_chunk_size + 1,
                                  suggested_team_size, suggested_vector_size),
                              sc);
       } else {
         Kokkos::parallel_for("KokkosSparse::StructureC::SPGEMM_KK_LP::STATIC",
                              multicore_team_policy4_t(
-                                 m / team_row_chunk_size + 1,
+                                 space, m / team_row_chunk_size + 1,
                                  suggested_team_size, suggested_vector_size),
                              sc);
       }
@@ -1994,19 +1994,19 @@ void KokkosSPGEMM<
       if (use_dynamic_schedule) {
         Kokkos::parallel_for("KokkosSparse::StructureC::SPGEMM_KK_MEM::DYNAMIC",
                              dynamic_multicore_team_policy_t(
-                                 m / team_row_chunk_size + 1,
+                                 space, m / team_row_chunk_size + 1,
                                  suggested_team_size, suggested_vector_size),
                              sc);
       } else {
         Kokkos::parallel_for(
             "KokkosSparse::StructureC::SPGEMM_KK_MEM::STATIC",
-            multicore_team_policy_t(m / team_row_chunk_size + 1,
+            multicore_team_policy_t(space, m / team_row_chunk_size + 1,
                                     suggested_team_size, suggested_vector_size),
             sc);
       }
     }
   }
-  MyExecSpace().fence();
+  space.fence();
 
   if (KOKKOSKERNELS_VERBOSE) {
     std::cout << "\tStructureC Kernel time:" << timer1.seconds() << std::endl
@@ -2044,7 +2044,7 @@ void KokkosSPGEMM<
 	  typename c_row_view_t::HostMirror h_rowmapC = Kokkos::create_mirror_view (rowmapC);
 	  Kokkos::deep_copy(h_rowmapC, rowmapC);
 
-	  MyExecSpace().fence();
+	  space.fence();
 
 
 	  std::unordered_map <size_t, nnz_lno_t> flop_to_row_count;
@@ -2187,8 +2187,8 @@ void KokkosSPGEMM<
   }
 #endif
   typename c_row_view_t::non_const_value_type c_nnz_size = 0;
-  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum<MyExecSpace>(
-      m + 1, rowmapC, c_nnz_size);
+  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum(space, m + 1, rowmapC,
+                                                        c_nnz_size);
   this->handle->get_spgemm_handle()->set_c_nnz(c_nnz_size);
   nnz_lno_t c_max_nnz =
       KokkosSparse::Impl::graph_max_degree<MyExecSpace, size_type,
@@ -2228,10 +2228,10 @@ KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_, a_scalar_nnz_view_t_,
   typename b_oldrow_view_t::non_const_value_type rough_size = 0;
   Kokkos::parallel_reduce(
       "KokkosSparse::PredicMaxRowNNZ::STATIC",
-      team_policy_t(m / team_row_chunk_size + 1, suggested_team_size,
+      team_policy_t(space, m / team_row_chunk_size + 1, suggested_team_size,
                     suggested_vector_size),
       pcnnnz, rough_size);
-  MyExecSpace().fence();
+  space.fence();
 
   return rough_size;
 }
@@ -2347,10 +2347,10 @@ KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_, a_scalar_nnz_view_t_,
   size_type rough_size = 0;
   Kokkos::parallel_reduce(
       "KokkosSparse::PredicMaxRowNNZ_P::STATIC",
-      team_policy_t(m / team_row_chunk_size + 1, suggested_team_size,
+      team_policy_t(space, m / team_row_chunk_size + 1, suggested_team_size,
                     suggested_vector_size),
       pcnnnz, rough_size);
-  MyExecSpace().fence();
+  space.fence();
   return rough_size;
 }
 
@@ -2384,10 +2384,10 @@ KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_, a_scalar_nnz_view_t_,
   nnz_lno_t rough_size = 0;
   Kokkos::parallel_reduce(
       "KokkosSparse::PredicMaxRowNNZIntersection::STATIC",
-      team_policy_t(m / team_row_chunk_size + 1, suggested_team_size,
+      team_policy_t(space, m / team_row_chunk_size + 1, suggested_team_size,
                     suggested_vector_size),
       pcnnnz, rough_size);
-  MyExecSpace().fence();
+  space.fence();
   return rough_size;
 }
 
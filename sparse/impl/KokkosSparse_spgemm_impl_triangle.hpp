@@ -1370,7 +1370,7 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
   Kokkos::Timer timer1;
   pool_memory_space m_space(num_chunks, accumulator_chunksize, pool_init_val,
                             my_pool_type);
-  MyExecSpace().fence();
+  space.fence();
   if (KOKKOSKERNELS_VERBOSE) {
     std::cout << "\tPool Alloc Time:" << timer1.seconds() << std::endl;
   }
@@ -1398,8 +1398,8 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
 
   if (exec_gpu) {
     Kokkos::parallel_for(
-        gpu_team_policy_t(m / suggested_team_size + 1, suggested_team_size,
-                          suggested_vector_size),
+        gpu_team_policy_t(space, m / suggested_team_size + 1,
+                          suggested_team_size, suggested_vector_size),
         sc);
   } else {
     if (!apply_compression) {
@@ -1407,26 +1407,26 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
           spgemm_algorithm == SPGEMM_KK_TRIANGLE_IA_UNION) {
         if (use_dynamic_schedule) {
           Kokkos::parallel_for(nc_dynamic_multicore_dense_team_count_policy_t(
-                                   m / team_row_chunk_size + 1,
+                                   space, m / team_row_chunk_size + 1,
                                    suggested_team_size, suggested_vector_size),
                                sc);
 
         } else {
           Kokkos::parallel_for(nc_multicore_dense_team_count_policy_t(
-                                   m / team_row_chunk_size + 1,
+                                   space, m / team_row_chunk_size + 1,
                                    suggested_team_size, suggested_vector_size),
                                sc);
         }
       } else if (spgemm_algorithm == SPGEMM_KK_TRIANGLE_IA) {
         if (use_dynamic_schedule) {
           Kokkos::parallel_for(nc_dynamic_multicore_dense_team2_count_policy_t(
-                                   m / team_row_chunk_size + 1,
+                                   space, m / team_row_chunk_size + 1,
                                    suggested_team_size, suggested_vector_size),
                                sc);
 
         } else {
           Kokkos::parallel_for(nc_multicore_dense_team2_count_policy_t(
-                                   m / team_row_chunk_size + 1,
+                                   space, m / team_row_chunk_size + 1,
                                    suggested_team_size, suggested_vector_size),
                                sc);
         }
@@ -1434,13 +1434,13 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
                  spgemm_algorithm == SPGEMM_KK_TRIANGLE_LU) {
         if (use_dynamic_schedule) {
           Kokkos::parallel_for(nc_dynamic_multicore_dense_team3_count_policy_t(
-                                   m / team_row_chunk_size + 1,
+                                   space, m / team_row_chunk_size + 1,
                                    suggested_team_size, suggested_vector_size),
                                sc);
 
         } else {
           Kokkos::parallel_for(nc_multicore_dense_team3_count_policy_t(
-                                   m / team_row_chunk_size + 1,
+                                   space, m / team_row_chunk_size + 1,
                                    suggested_team_size, suggested_vector_size),
                                sc);
         }
@@ -1451,26 +1451,26 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
           spgemm_algorithm == SPGEMM_KK_TRIANGLE_IA_UNION) {
         if (use_dynamic_schedule) {
           Kokkos::parallel_for(dynamic_multicore_dense_team_count_policy_t(
-                                   m / team_row_chunk_size + 1,
+                                   space, m / team_row_chunk_size + 1,
                                    suggested_team_size, suggested_vector_size),
                                sc);
 
         } else {
           Kokkos::parallel_for(multicore_dense_team_count_policy_t(
-                                   m / team_row_chunk_size + 1,
+                                   space, m / team_row_chunk_size + 1,
                                    suggested_team_size, suggested_vector_size),
                                sc);
         }
       } else if (spgemm_algorithm == SPGEMM_KK_TRIANGLE_IA) {
         if (use_dynamic_schedule) {
           Kokkos::parallel_for(dynamic_multicore_dense_team2_count_policy_t(
-                                   m / team_row_chunk_size + 1,
+                                   space, m / team_row_chunk_size + 1,
                                    suggested_team_size, suggested_vector_size),
                                sc);
 
         } else {
           Kokkos::parallel_for(multicore_dense_team2_count_policy_t(
-                                   m / team_row_chunk_size + 1,
+                                   space, m / team_row_chunk_size + 1,
                                    suggested_team_size, suggested_vector_size),
                                sc);
         }
@@ -1478,13 +1478,13 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
                  spgemm_algorithm == SPGEMM_KK_TRIANGLE_LU) {
         if (use_dynamic_schedule) {
           Kokkos::parallel_for(dynamic_multicore_dense_team3_count_policy_t(
-                                   m / team_row_chunk_size + 1,
+                                   space, m / team_row_chunk_size + 1,
                                    suggested_team_size, suggested_vector_size),
                                sc);
 
         } else {
           Kokkos::parallel_for(multicore_dense_team3_count_policy_t(
-                                   m / team_row_chunk_size + 1,
+                                   space, m / team_row_chunk_size + 1,
                                    suggested_team_size, suggested_vector_size),
                                sc);
         }
@@ -1495,24 +1495,24 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
           spgemm_algorithm == SPGEMM_KK_TRIANGLE_IA_UNION) {
         if (use_dynamic_schedule) {
           Kokkos::parallel_for(dynamic_multicore_team_policy_t(
-                                   m / team_row_chunk_size + 1,
+                                   space, m / team_row_chunk_size + 1,
                                    suggested_team_size, suggested_vector_size),
                                sc);
         } else {
           Kokkos::parallel_for(multicore_team_policy_t(
-                                   m / team_row_chunk_size + 1,
+                                   space, m / team_row_chunk_size + 1,
                                    suggested_team_size, suggested_vector_size),
                                sc);
         }
       } else if (spgemm_algorithm == SPGEMM_KK_TRIANGLE_IA) {
         if (use_dynamic_schedule) {
           Kokkos::parallel_for(dynamic_multicore_team_policy2_t(
-                                   m / team_row_chunk_size + 1,
+                                   space, m / team_row_chunk_size + 1,
                                    suggested_team_size, suggested_vector_size),
                                sc);
         } else {
           Kokkos::parallel_for(multicore_team_policy2_t(
-                                   m / team_row_chunk_size + 1,
+                                   space, m / team_row_chunk_size + 1,
                                    suggested_team_size, suggested_vector_size),
                                sc);
         }
@@ -1520,19 +1520,19 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
                  spgemm_algorithm == SPGEMM_KK_TRIANGLE_LU) {
         if (use_dynamic_schedule) {
           Kokkos::parallel_for(dynamic_multicore_team_policy3_t(
-                                   m / team_row_chunk_size + 1,
+                                   space, m / team_row_chunk_size + 1,
                                    suggested_team_size, suggested_vector_size),
                                sc);
         } else {
           Kokkos::parallel_for(multicore_team_policy3_t(
-                                   m / team_row_chunk_size + 1,
+                                   space, m / team_row_chunk_size + 1,
                                    suggested_team_size, suggested_vector_size),
                                sc);
         }
       }
     }
   }
-  MyExecSpace().fence();
+  space.fence();
 
   if (KOKKOSKERNELS_VERBOSE) {
     std::cout << "\tKernel time:" << timer1.seconds() << std::endl << std::endl;
@@ -1635,7 +1635,8 @@ void KokkosSPGEMM<
   if (apply_compression) {
     // compressed b
     row_lno_temp_work_view_t new_row_mapB(
-        Kokkos::view_alloc(Kokkos::WithoutInitializing, "new row map"), n + 1);
+        Kokkos::view_alloc(space, Kokkos::WithoutInitializing, "new row map"),
+        n + 1);
     nnz_lno_temp_work_view_t
         set_index_entries;                 // will be output of compress matrix.
     nnz_lno_temp_work_view_t set_entries;  // will be output of compress matrix
@@ -1744,7 +1745,7 @@ void KokkosSPGEMM<
     maxNumRoughZeros = max_row_size;
   } else if (spgemm_algorithm == SPGEMM_KK_TRIANGLE_IA) {
     min_result_row_for_each_row = nnz_lno_persistent_work_view_t(
-        Kokkos::view_alloc(Kokkos::WithoutInitializing,
+        Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
                            "Min B Row for Each A Row"),
         this->a_row_cnt);
     maxNumRoughZeros = this->getMaxRoughRowNNZIntersection_p(
@@ -1818,13 +1819,14 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
                           p_entriesA, bnnz, p_rowmapB_begins, p_rowmapB_ends,
                           p_set_index_b, p_set_b, p_rowmapC, NULL, dummy);
 
-  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum<MyExecSpace>(
-      this->a_row_cnt + 1, rowmapC_);
-  MyExecSpace().fence();
+  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum(
+      space, this->a_row_cnt + 1, rowmapC_);
+  space.fence();
 
   auto d_c_nnz_size = Kokkos::subview(rowmapC_, this->a_row_cnt);
   auto h_c_nnz_size = Kokkos::create_mirror_view(d_c_nnz_size);
-  Kokkos::deep_copy(h_c_nnz_size, d_c_nnz_size);
+  Kokkos::deep_copy(space, h_c_nnz_size, d_c_nnz_size);
+  space.fence();
   typename c_row_view_t::non_const_value_type c_nnz_size = h_c_nnz_size();
   this->handle->get_spgemm_handle()->set_c_nnz(c_nnz_size);
 
@@ -928,7 +928,7 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
   Kokkos::Timer timer1;
   pool_memory_space m_space(num_chunks, accumulator_chunksize, pool_init_val,
                             my_pool_type);
-  MyExecSpace().fence();
+  space.fence();
   if (KOKKOSKERNELS_VERBOSE) {
     std::cout << "\tPool Alloc Time:" << timer1.seconds() << std::endl;
   }
@@ -956,8 +956,8 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
 
   if (exec_gpu) {
     Kokkos::parallel_for(
-        gpu_team_policy_t(m / suggested_team_size + 1, suggested_team_size,
-                          suggested_vector_size),
+        gpu_team_policy_t(space, m / suggested_team_size + 1,
+                          suggested_team_size, suggested_vector_size),
         sc);
   } else {
     if (use_dense_accumulator) {
@@ -966,25 +966,25 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
           spgemm_algorithm == SPGEMM_KK_TRIANGLE_MEM) {
         if (use_dynamic_schedule) {
           Kokkos::parallel_for(dynamic_multicore_dense_team_count_policy_t(
-                                   m / team_row_chunk_size + 1,
+                                   space, m / team_row_chunk_size + 1,
                                    suggested_team_size, suggested_vector_size),
                                sc);
         } else {
           Kokkos::parallel_for(multicore_dense_team_count_policy_t(
-                                   m / team_row_chunk_size + 1,
+                                   space, m / team_row_chunk_size + 1,
                                    suggested_team_size, suggested_vector_size),
                                sc);
         }
       } else {
         if (use_dynamic_schedule) {
           Kokkos::parallel_for(dynamic_multicore_dense_team2_count_policy_t(
-                                   m / team_row_chunk_size + 1,
+                                   space, m / team_row_chunk_size + 1,
                                    suggested_team_size, suggested_vector_size),
                                sc);
 
         } else {
           Kokkos::parallel_for(multicore_dense_team2_count_policy_t(
-                                   m / team_row_chunk_size + 1,
+                                   space, m / team_row_chunk_size + 1,
                                    suggested_team_size, suggested_vector_size),
                                sc);
         }
@@ -995,31 +995,31 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
           spgemm_algorithm == SPGEMM_KK_TRIANGLE_MEM) {
         if (use_dynamic_schedule) {
           Kokkos::parallel_for(dynamic_multicore_team_policy_t(
-                                   m / team_row_chunk_size + 1,
+                                   space, m / team_row_chunk_size + 1,
                                    suggested_team_size, suggested_vector_size),
                                sc);
         } else {
           Kokkos::parallel_for(multicore_team_policy_t(
-                                   m / team_row_chunk_size + 1,
+                                   space, m / team_row_chunk_size + 1,
                                    suggested_team_size, suggested_vector_size),
                                sc);
         }
       } else {
         if (use_dynamic_schedule) {
           Kokkos::parallel_for(dynamic_multicore_team_policy2_t(
-                                   m / team_row_chunk_size + 1,
+                                   space, m / team_row_chunk_size + 1,
                                    suggested_team_size, suggested_vector_size),
                                sc);
         } else {
           Kokkos::parallel_for(multicore_team_policy2_t(
-                                   m / team_row_chunk_size + 1,
+                                   space, m / team_row_chunk_size + 1,
                                    suggested_team_size, suggested_vector_size),
                                sc);
         }
       }
     }
   }
-  MyExecSpace().fence();
+  space.fence();
 
   if (KOKKOSKERNELS_VERBOSE) {
     std::cout << "\tKernel time:" << timer1.seconds() << std::endl << std::endl;
@@ -1057,7 +1057,7 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
         KOKKOSKERNELS_MACRO_MIN(dense_col_size, s_maxNumRoughZeros);
   } else {
     min_result_row_for_each_row = nnz_lno_persistent_work_view_t(
-        Kokkos::view_alloc(Kokkos::WithoutInitializing,
+        Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
                            "Min B Row for Each A Row"),
         this->a_row_cnt);
     maxNumRoughZeros = this->getMaxRoughRowNNZIntersection_p(
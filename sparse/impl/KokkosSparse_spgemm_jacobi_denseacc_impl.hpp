@@ -221,7 +221,7 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
   pool_memory_space m_space(
       num_chunks, this->b_col_cnt + (this->b_col_cnt) / sizeof(scalar_t) + 1, 0,
       my_pool_type);
-  MyExecSpace().fence();
+  space.fence();
 
   if (KOKKOSKERNELS_VERBOSE) {
     std::cout << "\t\tPool Alloc Time:" << timer.seconds() << std::endl;
@@ -242,7 +242,7 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
       jacobi(a_row_cnt, b_col_cnt, row_mapA, entriesA, valsA, row_mapB,
              entriesB, valsB, row_mapC_, entriesC_, valuesC_, omega, dinv,
              m_space, my_exec_space_, team_row_chunk_size);
-  MyExecSpace().fence();
+  space.fence();
 
   if (KOKKOSKERNELS_VERBOSE) {
     std::cout << "\t\tCPU vector_size:" << suggested_vector_size
@@ -254,18 +254,18 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
   if (use_dynamic_schedule) {
     Kokkos::parallel_for("KokkosSparse::Jacobi::DenseAcc::Dynamic",
                          dynamic_multicore_team_policy_t(
-                             a_row_cnt / team_row_chunk_size + 1,
+                             space, a_row_cnt / team_row_chunk_size + 1,
                              suggested_team_size, suggested_vector_size),
                          jacobi);
   } else {
     Kokkos::parallel_for(
         "KokkosSparse::Jacobi::DenseAcc::Static",
-        multicore_team_policy_t(a_row_cnt / team_row_chunk_size + 1,
+        multicore_team_policy_t(space, a_row_cnt / team_row_chunk_size + 1,
                                 suggested_team_size, suggested_vector_size),
         jacobi);
   }
 
-  MyExecSpace().fence();
+  space.fence();
 
   if (KOKKOSKERNELS_VERBOSE) {
     std::cout << "\t\tJacobi COMP TIME:" << timer.seconds() << std::endl;
@@ -20,13 +20,13 @@ namespace KokkosSparse {
 
 namespace Impl {
 
-template <typename KernelHandle, typename alno_row_view_t_,
+template <typename ExecSpace, typename KernelHandle, typename alno_row_view_t_,
           typename alno_nnz_view_t_, typename ascalar_nnz_view_t_,
           typename blno_row_view_t_, typename blno_nnz_view_t_,
           typename bscalar_nnz_view_t_, typename clno_row_view_t_,
           typename clno_nnz_view_t_, typename cscalar_nnz_view_t_,
           typename dinv_scalar_view_t>
-void spgemm_jacobi_seq(KernelHandle* /* handle */,
+void spgemm_jacobi_seq(const ExecSpace& space, KernelHandle* /* handle */,
                        typename KernelHandle::nnz_lno_t m,
                        typename KernelHandle::nnz_lno_t /* n */,
                        typename KernelHandle::nnz_lno_t k,
@@ -44,27 +44,27 @@ void spgemm_jacobi_seq(KernelHandle* /* handle */,
 ) {
   typename alno_row_view_t_::HostMirror h_rma =
       Kokkos::create_mirror_view(row_mapA);
-  Kokkos::deep_copy(h_rma, row_mapA);
+  Kokkos::deep_copy(space, h_rma, row_mapA);
   typename alno_nnz_view_t_::HostMirror h_enta =
       Kokkos::create_mirror_view(entriesA);
-  Kokkos::deep_copy(h_enta, entriesA);
+  Kokkos::deep_copy(space, h_enta, entriesA);
   typename ascalar_nnz_view_t_::HostMirror h_vala =
       Kokkos::create_mirror_view(valuesA);
-  Kokkos::deep_copy(h_vala, valuesA);
+  Kokkos::deep_copy(space, h_vala, valuesA);
 
   typename blno_row_view_t_::HostMirror h_rmb =
       Kokkos::create_mirror_view(row_mapB);
-  Kokkos::deep_copy(h_rmb, row_mapB);
+  Kokkos::deep_copy(space, h_rmb, row_mapB);
   typename blno_nnz_view_t_::HostMirror h_entb =
       Kokkos::create_mirror_view(entriesB);
-  Kokkos::deep_copy(h_entb, entriesB);
+  Kokkos::deep_copy(space, h_entb, entriesB);
   typename bscalar_nnz_view_t_::HostMirror h_valb =
       Kokkos::create_mirror_view(valuesB);
-  Kokkos::deep_copy(h_valb, valuesB);
+  Kokkos::deep_copy(space, h_valb, valuesB);
 
   typename clno_row_view_t_::HostMirror h_rmc =
       Kokkos::create_mirror_view(row_mapC);
-  Kokkos::deep_copy(h_rmc, row_mapC);
+  Kokkos::deep_copy(space, h_rmc, row_mapC);
   typename clno_nnz_view_t_::HostMirror h_entc =
       Kokkos::create_mirror_view(entriesC);
   typename cscalar_nnz_view_t_::HostMirror h_valc =
@@ -72,9 +72,9 @@ void spgemm_jacobi_seq(KernelHandle* /* handle */,
 
   typename dinv_scalar_view_t::HostMirror h_dinv =
       Kokkos::create_mirror_view(dinv);
-  Kokkos::deep_copy(h_dinv, dinv);
+  Kokkos::deep_copy(space, h_dinv, dinv);
 
-  Kokkos::fence();
+  space.fence();
 
   typedef typename KernelHandle::nnz_lno_t lno_t;
   typedef typename KernelHandle::size_type size_type;
@@ -140,9 +140,9 @@ void spgemm_jacobi_seq(KernelHandle* /* handle */,
     }
   }
 
-  Kokkos::deep_copy(entriesC, h_entc);
-  Kokkos::deep_copy(valuesC, h_valc);
-  Kokkos::fence();
+  Kokkos::deep_copy(space, entriesC, h_entc);
+  Kokkos::deep_copy(space, valuesC, h_valc);
+  space.fence();
 }
 
 }  // namespace Impl
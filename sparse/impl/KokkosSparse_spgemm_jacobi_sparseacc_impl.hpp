@@ -1549,7 +1549,7 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
 
   Kokkos::Timer timer;
   pool_memory_space m_space(num_chunks, chunksize, -1, my_pool_type);
-  MyExecSpace().fence();
+  space.fence();
 
   if (KOKKOSKERNELS_VERBOSE) {
     m_space.print_memory_pool();
@@ -1593,10 +1593,10 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
       }
       Kokkos::parallel_for(
           "KokkosSparse::Jacobi::SparseAcc::GPU::SPGEMM_KK_MEMORY_SPREADTEAM",
-          gpu_team_policy4_t(a_row_cnt / team_row_chunk_size + 1,
+          gpu_team_policy4_t(space, a_row_cnt / team_row_chunk_size + 1,
                              suggested_team_size, suggested_vector_size),
           jacobi);
-      MyExecSpace().fence();
+      space.fence();
 
     } else if (algorithm_to_run == SPGEMM_KK_MEMORY_BIGSPREADTEAM) {
       if (thread_shmem_key_size <= 0) {
@@ -1613,7 +1613,7 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
       Kokkos::parallel_for(
           "KokkosSparse::Jacobi::SparseAcc::GPU::SPGEMM_KK_MEMORY_"
           "BIGSPREADTEAM",
-          gpu_team_policy6_t(a_row_cnt / team_row_chunk_size + 1,
+          gpu_team_policy6_t(space, a_row_cnt / team_row_chunk_size + 1,
                              suggested_team_size, suggested_vector_size),
           jacobi);
     } else {
@@ -1630,24 +1630,24 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
       }
       Kokkos::parallel_for(
           "KokkosSparse::Jacobi::SparseAcc::GPU::SPGEMM_KK_MEMORY",
-          gpu_team_policy_t(a_row_cnt / team_row_chunk_size + 1,
+          gpu_team_policy_t(space, a_row_cnt / team_row_chunk_size + 1,
                             suggested_team_size, suggested_vector_size),
           jacobi);
     }
-    MyExecSpace().fence();
+    space.fence();
   } else {
     if (algorithm_to_run == SPGEMM_KK_LP) {
       if (use_dynamic_schedule) {
         Kokkos::parallel_for(
             "KokkosSparse::Jacobi::SparseAcc::CPU::LP::Dynamic",
             dynamic_multicore_team_policy4_t(
-                a_row_cnt / team_row_chunk_size + 1, suggested_team_size,
+                space, a_row_cnt / team_row_chunk_size + 1, suggested_team_size,
                 suggested_vector_size),
             jacobi);
       } else {
         Kokkos::parallel_for("KokkosSparse::Jacobi::SparseAcc::CPU::LP::Static",
                              multicore_team_policy4_t(
-                                 a_row_cnt / team_row_chunk_size + 1,
+                                 space, a_row_cnt / team_row_chunk_size + 1,
                                  suggested_team_size, suggested_vector_size),
                              jacobi);
       }
@@ -1655,18 +1655,18 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
       if (use_dynamic_schedule) {
         Kokkos::parallel_for("KokkosSparse::Jacobi::SparseAcc::CPU::Dynamic",
                              dynamic_multicore_team_policy_t(
-                                 a_row_cnt / team_row_chunk_size + 1,
+                                 space, a_row_cnt / team_row_chunk_size + 1,
                                  suggested_team_size, suggested_vector_size),
                              jacobi);
       } else {
         Kokkos::parallel_for(
             "KokkosSparse::Jacobi::SparseAcc::CPU::Static",
-            multicore_team_policy_t(a_row_cnt / team_row_chunk_size + 1,
+            multicore_team_policy_t(space, a_row_cnt / team_row_chunk_size + 1,
                                     suggested_team_size, suggested_vector_size),
             jacobi);
       }
     }
-    MyExecSpace().fence();
+    space.fence();
   }
 
   if (KOKKOSKERNELS_VERBOSE) {
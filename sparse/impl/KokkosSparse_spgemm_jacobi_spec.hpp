@@ -157,6 +157,9 @@ struct SPGEMM_JACOBI<KernelHandle, a_size_view_t_, a_lno_view_t,
 
                             typename c_scalar_view_t::const_value_type omega,
                             dinv_scalar_view_t dinv) {
+    Kokkos::Profiling::pushRegion(KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+                                      ? "KokkosSparse::spgemm_jacobi[ETI]"
+                                      : "KokkosSparse::spgemm_jacobi[noETI]");
     typedef typename KernelHandle::SPGEMMHandleType spgemmHandleType;
     spgemmHandleType *sh = handle->get_spgemm_handle();
     if (!sh->is_symbolic_called()) {
@@ -185,9 +188,10 @@ struct SPGEMM_JACOBI<KernelHandle, a_size_view_t_, a_lno_view_t,
     }
 
     if (sh->get_algorithm_type() == SPGEMM_SERIAL) {
-      spgemm_jacobi_seq(handle, m, n, k, row_mapA, entriesA, valuesA,
-                        transposeA, row_mapB, entriesB, valuesB, transposeB,
-                        row_mapC, entriesC, valuesC, omega, dinv);
+      spgemm_jacobi_seq(typename KernelHandle::HandleExecSpace(), handle, m, n,
+                        k, row_mapA, entriesA, valuesA, transposeA, row_mapB,
+                        entriesB, valuesB, transposeB, row_mapC, entriesC,
+                        valuesC, omega, dinv);
     } else {
       KokkosSPGEMM<KernelHandle, a_size_view_t_, a_lno_view_t, a_scalar_view_t,
                    b_size_view_t_, b_lno_view_t, b_scalar_view_t>
@@ -204,6 +208,7 @@ struct SPGEMM_JACOBI<KernelHandle, a_size_view_t_, a_lno_view_t,
     // TODO: remove this call when impl sorts
     KokkosSparse::sort_crs_matrix<typename KernelHandle::HandleExecSpace>(
         row_mapC, entriesC, valuesC);
+    Kokkos::Profiling::popRegion();
   }
 };
 
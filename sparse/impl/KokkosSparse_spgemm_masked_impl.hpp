@@ -0,0 +1,286 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_SPGEMM_MASKED_IMPL_HPP_
+#define KOKKOSSPARSE_SPGEMM_MASKED_IMPL_HPP_
+
+#include "Kokkos_ArithTraits.hpp"
+#include "KokkosKernels_ExecSpaceUtils.hpp"
+#include "KokkosKernels_SimpleUtils.hpp"
+#include "KokkosKernels_Uniform_Initialized_MemoryPool.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+
+// Masked product C<M> = A*B: row i of C holds the entries (i, j) of A*B
+// for which (i, j) is in the mask M (or, with the complement, is not in M).
+// The values of M are not used.
+//
+// Each thread computes one row i of C at a time with a dense accumulator:
+// it marks the columns of row i of M, then walks the rows of B selected by
+// row i of A and accumulates only the terms whose column passes the mask.
+// Terms outside the mask are discarded before they reach the accumulator,
+// so C is never formed in full.
+//
+// The vector lanes of a thread split one row of M (or B) at a time. The
+// columns of a row are distinct, so the lanes never update the same entry
+// of the accumulator at the same time; only the list of occupied columns
+// needs an atomic counter.
+//
+// The accumulator comes from two memory pools, whose chunks hold
+//  - ordinals: the mask markers, the markers and list of the occupied
+//    columns, and the list length (3 * numColsB + 1);
+//  - values: the dense row (numColsB), numeric only.
+// Every thread leaves its chunks zeroed, as it got them.
+//
+// In the symbolic phase (numeric == false), the number of entries of row i
+// of C is written to row_mapC(i). In the numeric phase, the list of occupied
+// columns of row i of C is its (unsorted) entries.
+//
+// The values are combined with the operations of Semiring (see
+// KokkosSparse_Semiring.hpp): the accumulator starts at Semiring::zero()
+// and C(i, j) = add over k of multiply(A(i, k), B(k, j)).
+template <typename ExecutionSpace, typename MMatrix, typename AMatrix,
+          typename BMatrix, typename c_row_view_t, typename c_lno_view_t,
+          typename c_scalar_view_t, typename lno_pool_t,
+          typename scalar_pool_t, bool numeric, bool complement,
+          typename Semiring>
+struct SpgemmMaskedFunctor {
+  using size_type   = typename c_row_view_t::non_const_value_type;
+  using lno_t       = typename c_lno_view_t::non_const_value_type;
+  using scalar_t    = typename c_scalar_view_t::non_const_value_type;
+  using team_member = typename Kokkos::TeamPolicy<ExecutionSpace>::member_type;
+
+  lno_t m;
+  lno_t numColsB;
+  lno_t rows_per_team;
+  MMatrix M;
+  AMatrix A;
+  BMatrix B;
+  c_row_view_t row_mapC;
+  c_lno_view_t entriesC;
+  c_scalar_view_t valuesC;
+  lno_pool_t lno_pool;
+  scalar_pool_t scalar_pool;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const team_member& dev) const {
+    const lno_t begin = dev.league_rank() * rows_per_team;
+    const lno_t end   = KOKKOSKERNELS_MACRO_MIN(begin + rows_per_team, m);
+    const size_t tid  = dev.league_rank() * dev.team_size() + dev.team_rank();
+
+    lno_t* lnoChunk    = nullptr;
+    scalar_t* accChunk = nullptr;
+    Kokkos::single(
+        Kokkos::PerThread(dev),
+        [&](lno_t*& chunk) {
+          chunk = nullptr;
+          while (chunk == nullptr) chunk = lno_pool.allocate_chunk(tid);
+        },
+        lnoChunk);
+    if constexpr (numeric) {
+      Kokkos::single(
+          Kokkos::PerThread(dev),
+          [&](scalar_t*& chunk) {
+            chunk = nullptr;
+            while (chunk == nullptr) chunk = scalar_pool.allocate_chunk(tid);
+          },
+          accChunk);
+    }
+    lno_t* maskMark = lnoChunk;
+    lno_t* cMark    = maskMark + numColsB;
+    lno_t* cScratch = cMark + numColsB;
+    lno_t* count    = cScratch + numColsB;
+    scalar_t* cAcc  = accChunk;
+
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(dev, begin, end), [&](const lno_t i) {
+          lno_t* cList = cScratch;
+          if constexpr (numeric) cList = &entriesC(row_mapC(i));
+          const size_type mBeg = M.graph.row_map(i);
+          const size_type mLen = M.graph.row_map(i + 1) - mBeg;
+          Kokkos::parallel_for(Kokkos::ThreadVectorRange(dev, 1),
+                               [&](const int) { *count = 0; });
+          Kokkos::parallel_for(Kokkos::ThreadVectorRange(dev, mLen),
+                               [&](const size_type q) {
+                                 maskMark[M.graph.entries(mBeg + q)] = 1;
+                               });
+          // Without the complement, an empty row of the mask is an empty row
+          // of C
+          if (complement || mLen) {
+            for (size_type ka = A.graph.row_map(i); ka < A.graph.row_map(i + 1);
+                 ka++) {
+              const lno_t k        = A.graph.entries(ka);
+              const size_type bBeg = B.graph.row_map(k);
+              const size_type bLen = B.graph.row_map(k + 1) - bBeg;
+              scalar_t a           = Kokkos::ArithTraits<scalar_t>::zero();
+              if constexpr (numeric) a = A.values(ka);
+              Kokkos::parallel_for(
+                  Kokkos::ThreadVectorRange(dev, bLen), [&](const size_type l) {
+                    const lno_t col = B.graph.entries(bBeg + l);
+                    if (bool(maskMark[col]) == complement) return;
+                    if (!cMark[col]) {
+                      cMark[col] = 1;
+                      cList[Kokkos::atomic_fetch_add(count, lno_t(1))] = col;
+                    }
+                    if constexpr (numeric)
+                      cAcc[col] = Semiring::add(
+                          cAcc[col],
+                          Semiring::multiply(a, B.values(bBeg + l)));
+                  });
+            }
+          }
+          const lno_t cLen = *count;
+
+          // Write the row and zero the accumulator again
+          Kokkos::parallel_for(Kokkos::ThreadVectorRange(dev, mLen),
+                               [&](const size_type q) {
+                                 maskMark[M.graph.entries(mBeg + q)] = 0;
+                               });
+          Kokkos::parallel_for(
+              Kokkos::ThreadVectorRange(dev, cLen), [&](const lno_t t) {
+                const lno_t j = cList[t];
+                cMark[j]      = 0;
+                if constexpr (numeric) {
+                  valuesC(row_mapC(i) + t) = cAcc[j];
+                  cAcc[j] = Semiring::zero();
+                }
+              });
+          if constexpr (!numeric) {
+            Kokkos::single(Kokkos::PerThread(dev),
+                           [&]() { row_mapC(i) = cLen; });
+          }
+        });
+
+    Kokkos::single(Kokkos::PerThread(dev), [&]() {
+      lno_pool.release_chunk(lnoChunk);
+      if constexpr (numeric) scalar_pool.release_chunk(accChunk);
+    });
+  }
+};
+
+/// Team policy parameters and number of accumulator chunks for the masked
+/// kernels: on GPUs, vector lanes for an average row of B and 128 threads
+/// per team, with as many chunks as fit in half the free memory; on CPUs
+/// one thread (and one chunk) per team of 16 rows.
+template <typename ExecutionSpace, typename MemorySpace, typename BMatrix>
+void spgemm_masked_policy(
+    const BMatrix& B, const size_t chunk_bytes, int& team_size,
+    int& vector_size, typename BMatrix::non_const_ordinal_type& rows_per_team,
+    size_t& num_chunks) {
+  team_size     = 1;
+  vector_size   = 1;
+  rows_per_team = 16;
+  num_chunks    = ExecutionSpace().concurrency();
+  if constexpr (KokkosKernels::Impl::kk_is_gpu_exec_space<ExecutionSpace>()) {
+    vector_size = KokkosKernels::Impl::kk_get_suggested_vector_size(
+        B.numRows(), B.nnz(),
+        KokkosKernels::Impl::kk_get_exec_space_type<ExecutionSpace>());
+    if (vector_size > 32) vector_size = 32;
+    team_size     = 128 / vector_size;
+    rows_per_team = team_size;
+    num_chunks /= vector_size;
+    size_t free_byte, total_byte;
+    KokkosKernels::Impl::kk_get_free_total_memory<MemorySpace>(free_byte,
+                                                               total_byte);
+    if (num_chunks * chunk_bytes > free_byte / 2)
+      num_chunks = (free_byte / 2) / chunk_bytes;
+    if (num_chunks < 1) num_chunks = 1;
+  }
+}
+
+template <bool numeric, bool complement, typename ExecutionSpace,
+          typename MemorySpace, typename Semiring, typename MMatrix,
+          typename AMatrix, typename BMatrix, typename c_row_view_t,
+          typename c_lno_view_t, typename c_scalar_view_t>
+typename c_row_view_t::non_const_value_type spgemm_masked_launch(
+    const MMatrix& M, const AMatrix& A, const BMatrix& B,
+    const c_row_view_t& row_mapC, const c_lno_view_t& entriesC,
+    const c_scalar_view_t& valuesC) {
+  using size_type     = typename c_row_view_t::non_const_value_type;
+  using lno_t         = typename c_lno_view_t::non_const_value_type;
+  using scalar_t      = typename c_scalar_view_t::non_const_value_type;
+  using pool_device_t = Kokkos::Device<ExecutionSpace, MemorySpace>;
+  using lno_pool_t =
+      KokkosKernels::Impl::UniformMemoryPool<pool_device_t, lno_t>;
+  using scalar_pool_t =
+      KokkosKernels::Impl::UniformMemoryPool<pool_device_t, scalar_t>;
+  using functor_t =
+      SpgemmMaskedFunctor<ExecutionSpace, MMatrix, AMatrix, BMatrix,
+                          c_row_view_t, c_lno_view_t, c_scalar_view_t,
+                          lno_pool_t, scalar_pool_t, numeric, complement,
+                          Semiring>;
+
+  const lno_t m               = A.numRows();
+  const lno_t numColsB        = B.numCols();
+  const size_t lnoChunkSize   = 3 * size_t(numColsB) + 1;
+  const size_t valueChunkSize = numeric ? size_t(numColsB) : 0;
+
+  int team_size, vector_size;
+  lno_t rows_per_team;
+  size_t num_chunks;
+  spgemm_masked_policy<ExecutionSpace, MemorySpace>(
+      B, lnoChunkSize * sizeof(lno_t) + valueChunkSize * sizeof(scalar_t),
+      team_size, vector_size, rows_per_team, num_chunks);
+
+  lno_pool_t lno_pool(num_chunks, lnoChunkSize, lno_t(0),
+                      KokkosKernels::Impl::ManyThread2OneChunk);
+  scalar_pool_t scalar_pool;
+  if constexpr (numeric)
+    scalar_pool = scalar_pool_t(num_chunks, valueChunkSize, Semiring::zero(),
+                                KokkosKernels::Impl::ManyThread2OneChunk);
+
+  const lno_t numTeams = (m + rows_per_team - 1) / rows_per_team;
+  Kokkos::parallel_for(
+      numeric ? "KokkosSparse::spgemm_masked::numeric"
+              : "KokkosSparse::spgemm_masked::symbolic",
+      Kokkos::TeamPolicy<ExecutionSpace>(numTeams, team_size, vector_size),
+      functor_t{m, numColsB, rows_per_team, M, A, B, row_mapC, entriesC,
+                valuesC, lno_pool, scalar_pool});
+
+  size_type c_nnz = 0;
+  if constexpr (!numeric) {
+    KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum(
+        ExecutionSpace(), m + 1, row_mapC, c_nnz);
+  }
+  return c_nnz;
+}
+
+/// Run the symbolic (numeric == false) or numeric phase of C<M> = A*B, or
+/// of C<!M> = A*B with the complement. The symbolic phase writes the row map
+/// of C and returns its number of entries; the numeric phase writes the
+/// (unsorted) entries and values of C, over the operations of Semiring.
+template <bool numeric, typename ExecutionSpace, typename MemorySpace,
+          typename Semiring, typename MMatrix, typename AMatrix,
+          typename BMatrix, typename c_row_view_t, typename c_lno_view_t,
+          typename c_scalar_view_t>
+typename c_row_view_t::non_const_value_type spgemm_masked_impl(
+    const MMatrix& M, const bool complement, const AMatrix& A,
+    const BMatrix& B, const c_row_view_t& row_mapC,
+    const c_lno_view_t& entriesC, const c_scalar_view_t& valuesC) {
+  if (complement)
+    return spgemm_masked_launch<numeric, true, ExecutionSpace, MemorySpace,
+                                Semiring>(M, A, B, row_mapC, entriesC,
+                                          valuesC);
+  else
+    return spgemm_masked_launch<numeric, false, ExecutionSpace, MemorySpace,
+                                Semiring>(M, A, B, row_mapC, entriesC,
+                                          valuesC);
+}
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPGEMM_MASKED_IMPL_HPP_
@@ -0,0 +1,96 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_SPGEMM_MEMORY_ESTIMATE_IMPL_HPP_
+#define KOKKOSSPARSE_SPGEMM_MEMORY_ESTIMATE_IMPL_HPP_
+
+#include <type_traits>
+#include <Kokkos_Core.hpp>
+#include "KokkosKernels_config.h"
+#include "KokkosKernels_ExecSpaceUtils.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+
+// Sizes of the product A*B that bound its memory, known before the
+// symbolic phase
+struct SpgemmProductBounds {
+  // Number of multiplications
+  size_t flops = 0;
+  // Sum over the rows of min(multiplications of the row, n): a bound on the
+  // number of entries of C
+  size_t c_nnz = 0;
+  // Maximum number of multiplications of a row
+  size_t max_row_flops = 0;
+};
+
+template <class ExecSpace, class a_row_view_t, class a_entries_view_t,
+          class b_row_view_t>
+SpgemmProductBounds spgemm_product_bounds(const ExecSpace &space,
+                                          const size_t m, const size_t n,
+                                          const a_row_view_t &rowmapA,
+                                          const a_entries_view_t &entriesA,
+                                          const b_row_view_t &rowmapB) {
+  SpgemmProductBounds bounds;
+  if (!m) return bounds;
+  Kokkos::parallel_reduce(
+      "KokkosSparse::spgemm_memory_estimate::product_bounds",
+      Kokkos::RangePolicy<ExecSpace>(space, 0, m),
+      KOKKOS_LAMBDA(const size_t i, size_t &flops, size_t &c_nnz,
+                    size_t &max_row_flops) {
+        size_t f = 0;
+        for (auto q = rowmapA(i); q < rowmapA(i + 1); q++) {
+          const auto col = entriesA(q);
+          f += rowmapB(col + 1) - rowmapB(col);
+        }
+        flops += f;
+        c_nnz += f < n ? f : n;
+        if (f > max_row_flops) max_row_flops = f;
+      },
+      bounds.flops, bounds.c_nnz, Kokkos::Max<size_t>(bounds.max_row_flops));
+  return bounds;
+}
+
+// Whether spgemm may hand the product to a TPL in ExecSpace
+template <class ExecSpace>
+constexpr bool spgemm_tpl_may_be_used() {
+#ifdef KOKKOSKERNELS_ENABLE_TPL_CUSPARSE
+  if (std::is_same_v<ExecSpace, Kokkos::Cuda>) return true;
+#endif
+#ifdef KOKKOSKERNELS_ENABLE_TPL_ROCSPARSE
+  if (std::is_same_v<ExecSpace, Kokkos::HIP>) return true;
+#endif
+#ifdef KOKKOSKERNELS_ENABLE_TPL_MKL
+  if (!KokkosKernels::Impl::kk_is_gpu_exec_space<ExecSpace>()) return true;
+#endif
+  return false;
+}
+
+// Number of accumulators the native kernels keep at once: one per thread on
+// CPUs, about one per warp on GPUs
+template <class ExecSpace>
+size_t spgemm_concurrent_accumulators() {
+  const size_t concurrency = ExecSpace().concurrency();
+  if (KokkosKernels::Impl::kk_is_gpu_exec_space<ExecSpace>()) {
+    return concurrency / 32 ? concurrency / 32 : 1;
+  }
+  return concurrency;
+}
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPGEMM_MEMORY_ESTIMATE_IMPL_HPP_
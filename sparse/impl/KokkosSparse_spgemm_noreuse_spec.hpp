@@ -85,6 +85,9 @@ struct SPGEMM_NOREUSE<CMatrix, AMatrix, BMatrix, false,
                       KOKKOSKERNELS_IMPL_COMPILE_LIBRARY> {
   static CMatrix spgemm_noreuse(const AMatrix& A, bool transA, const BMatrix& B,
                                 bool transB) {
+    Kokkos::Profiling::pushRegion(KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+                                      ? "KokkosSparse::spgemm_noreuse[ETI]"
+                                      : "KokkosSparse::spgemm_noreuse[noETI]");
     using device_t    = typename CMatrix::device_type;
     using scalar_t    = typename CMatrix::value_type;
     using ordinal_t   = typename CMatrix::ordinal_type;
@@ -116,6 +119,7 @@ struct SPGEMM_NOREUSE<CMatrix, AMatrix, BMatrix, false,
         B.graph.row_map, B.graph.entries, B.values, transB, row_mapC, entriesC,
         valuesC);
     kh.destroy_spgemm_handle();
+    Kokkos::Profiling::popRegion();
     return CMatrix("C", m, k, c_nnz, valuesC, row_mapC, entriesC);
   }
 };
@@ -0,0 +1,276 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_SPGEMM_NUMERIC_REUSE_IMPL_HPP_
+#define KOKKOSSPARSE_SPGEMM_NUMERIC_REUSE_IMPL_HPP_
+
+#include "Kokkos_ArithTraits.hpp"
+#include "KokkosKernels_ExecSpaceUtils.hpp"
+#include "KokkosKernels_SimpleUtils.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+
+// Numeric reuse for SpGEMM (SPGEMMHandle::set_numeric_reuse).
+//
+// The product terms of row i of C = A*B are enumerated in a fixed order: for
+// each entry (i, k) of A in storage order, each entry (k, j) of B in storage
+// order. The setup stores, for every term, the position of (i, j) in the
+// (sorted) entries of C. Later numeric calls with the same sparsity then
+// only scatter-add a_ik * b_kj at that position, with no accumulator.
+//
+// Each thread handles one row of C, and its vector lanes one row of B at a
+// time. The columns of a row of B are distinct, so the lanes never write the
+// same entry of C at the same time and no atomics are needed.
+
+/// Count the product terms (the flops) of each row of C.
+template <typename a_row_view_t, typename a_lno_view_t, typename b_row_view_t,
+          typename term_row_view_t>
+struct SpgemmReuseCountTerms {
+  using size_type = typename term_row_view_t::non_const_value_type;
+  using lno_t     = typename a_lno_view_t::non_const_value_type;
+
+  a_row_view_t row_mapA;
+  a_lno_view_t entriesA;
+  b_row_view_t row_mapB;
+  term_row_view_t term_offsets;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const lno_t i) const {
+    size_type terms = 0;
+    for (size_type ka = row_mapA(i); ka < row_mapA(i + 1); ka++) {
+      const lno_t k = entriesA(ka);
+      terms += row_mapB(k + 1) - row_mapB(k);
+    }
+    term_offsets(i) = terms;
+  }
+};
+
+/// Store the position in C of each product term.
+template <typename ExecutionSpace, typename a_row_view_t,
+          typename a_lno_view_t, typename b_row_view_t, typename b_lno_view_t,
+          typename c_row_view_t, typename c_lno_view_t,
+          typename term_row_view_t>
+struct SpgemmReuseFillPositions {
+  using size_type   = typename term_row_view_t::non_const_value_type;
+  using lno_t       = typename a_lno_view_t::non_const_value_type;
+  using team_member = typename Kokkos::TeamPolicy<ExecutionSpace>::member_type;
+
+  lno_t m;
+  lno_t rows_per_team;
+  a_row_view_t row_mapA;
+  a_lno_view_t entriesA;
+  b_row_view_t row_mapB;
+  b_lno_view_t entriesB;
+  c_row_view_t row_mapC;
+  c_lno_view_t entriesC;
+  term_row_view_t term_offsets;
+  term_row_view_t positions;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const team_member& dev) const {
+    const lno_t begin = dev.league_rank() * rows_per_team;
+    const lno_t end   = KOKKOSKERNELS_MACRO_MIN(begin + rows_per_team, m);
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(dev, begin, end), [&](const lno_t i) {
+          const size_type cBeg = row_mapC(i);
+          const size_type cEnd = row_mapC(i + 1);
+          size_type t          = term_offsets(i);
+          for (size_type ka = row_mapA(i); ka < row_mapA(i + 1); ka++) {
+            const lno_t k        = entriesA(ka);
+            const size_type bBeg = row_mapB(k);
+            const size_type bLen = row_mapB(k + 1) - bBeg;
+            Kokkos::parallel_for(
+                Kokkos::ThreadVectorRange(dev, bLen), [&](const size_type l) {
+                  // Binary search for the column in the sorted row of C
+                  const lno_t j = entriesB(bBeg + l);
+                  size_type lo  = cBeg, hi = cEnd;
+                  while (lo < hi) {
+                    const size_type mid = lo + (hi - lo) / 2;
+                    if (entriesC(mid) < j)
+                      lo = mid + 1;
+                    else
+                      hi = mid;
+                  }
+                  positions(t + l) = lo;
+                });
+            t += bLen;
+          }
+        });
+  }
+};
+
+/// valuesC := A*B, scattering each product term at its stored position.
+template <typename ExecutionSpace, typename a_row_view_t,
+          typename a_lno_view_t, typename a_scalar_view_t,
+          typename b_row_view_t, typename b_scalar_view_t,
+          typename c_row_view_t, typename c_scalar_view_t,
+          typename term_row_view_t>
+struct SpgemmReuseNumeric {
+  using size_type   = typename term_row_view_t::non_const_value_type;
+  using lno_t       = typename a_lno_view_t::non_const_value_type;
+  using scalar_t    = typename c_scalar_view_t::non_const_value_type;
+  using team_member = typename Kokkos::TeamPolicy<ExecutionSpace>::member_type;
+
+  lno_t m;
+  lno_t rows_per_team;
+  a_row_view_t row_mapA;
+  a_lno_view_t entriesA;
+  a_scalar_view_t valuesA;
+  b_row_view_t row_mapB;
+  b_scalar_view_t valuesB;
+  c_row_view_t row_mapC;
+  c_scalar_view_t valuesC;
+  term_row_view_t term_offsets;
+  term_row_view_t positions;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const team_member& dev) const {
+    const lno_t begin = dev.league_rank() * rows_per_team;
+    const lno_t end   = KOKKOSKERNELS_MACRO_MIN(begin + rows_per_team, m);
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(dev, begin, end), [&](const lno_t i) {
+          Kokkos::parallel_for(
+              Kokkos::ThreadVectorRange(dev, row_mapC(i), row_mapC(i + 1)),
+              [&](const size_type kc) {
+                valuesC(kc) = Kokkos::ArithTraits<scalar_t>::zero();
+              });
+          size_type t = term_offsets(i);
+          for (size_type ka = row_mapA(i); ka < row_mapA(i + 1); ka++) {
+            const lno_t k        = entriesA(ka);
+            const scalar_t a     = valuesA(ka);
+            const size_type bBeg = row_mapB(k);
+            const size_type bLen = row_mapB(k + 1) - bBeg;
+            Kokkos::parallel_for(
+                Kokkos::ThreadVectorRange(dev, bLen), [&](const size_type l) {
+                  valuesC(positions(t + l)) += a * valuesB(bBeg + l);
+                });
+            t += bLen;
+          }
+        });
+  }
+};
+
+/// Team policy parameters for the reuse kernels: on GPUs, vector lanes for
+/// an average row of B and 128 threads per team; on CPUs one thread walks a
+/// chunk of rows.
+template <typename ExecutionSpace, typename size_type, typename lno_t>
+void spgemm_numeric_reuse_policy(const lno_t n, const size_type nnzB,
+                                 int& team_size, int& vector_size,
+                                 lno_t& rows_per_team) {
+  team_size     = 1;
+  vector_size   = 1;
+  rows_per_team = 64;
+  if constexpr (KokkosKernels::Impl::kk_is_gpu_exec_space<ExecutionSpace>()) {
+    vector_size = KokkosKernels::Impl::kk_get_suggested_vector_size(
+        n, nnzB, KokkosKernels::Impl::kk_get_exec_space_type<ExecutionSpace>());
+    if (vector_size > 32) vector_size = 32;
+    team_size     = 128 / vector_size;
+    rows_per_team = team_size;
+  }
+}
+
+/// Build the term positions of C = A*B from the final (sorted) C, and store
+/// them in the SpGEMM handle sh.
+template <typename ExecutionSpace, typename spgemm_handle_t,
+          typename a_row_view_t, typename a_lno_view_t, typename b_row_view_t,
+          typename b_lno_view_t, typename c_row_view_t, typename c_lno_view_t>
+void spgemm_numeric_reuse_setup(const ExecutionSpace& space,
+                                spgemm_handle_t* sh,
+                                const typename spgemm_handle_t::nnz_lno_t m,
+                                const typename spgemm_handle_t::nnz_lno_t n,
+                                const a_row_view_t& row_mapA,
+                                const a_lno_view_t& entriesA,
+                                const b_row_view_t& row_mapB,
+                                const b_lno_view_t& entriesB,
+                                const c_row_view_t& row_mapC,
+                                const c_lno_view_t& entriesC) {
+  using size_type = typename spgemm_handle_t::size_type;
+  using lno_t     = typename spgemm_handle_t::nnz_lno_t;
+  using term_view_t =
+      typename spgemm_handle_t::row_lno_persistent_work_view_t;
+
+  term_view_t term_offsets(
+      Kokkos::view_alloc(space, "SpGEMM reuse term offsets"), m + 1);
+  Kokkos::parallel_for(
+      "KokkosSparse::spgemm_numeric_reuse::count_terms",
+      Kokkos::RangePolicy<ExecutionSpace>(space, 0, m),
+      SpgemmReuseCountTerms<a_row_view_t, a_lno_view_t, b_row_view_t,
+                            term_view_t>{row_mapA, entriesA, row_mapB,
+                                         term_offsets});
+  size_type numTerms = 0;
+  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum(space, m + 1,
+                                                        term_offsets, numTerms);
+  term_view_t positions(Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                                           "SpGEMM reuse positions"),
+                        numTerms);
+
+  int team_size, vector_size;
+  lno_t rows_per_team;
+  spgemm_numeric_reuse_policy<ExecutionSpace>(
+      n, size_type(entriesB.extent(0)), team_size, vector_size, rows_per_team);
+  const lno_t numTeams = (m + rows_per_team - 1) / rows_per_team;
+  Kokkos::parallel_for(
+      "KokkosSparse::spgemm_numeric_reuse::fill_positions",
+      Kokkos::TeamPolicy<ExecutionSpace>(space, numTeams, team_size,
+                                         vector_size),
+      SpgemmReuseFillPositions<ExecutionSpace, a_row_view_t, a_lno_view_t,
+                               b_row_view_t, b_lno_view_t, c_row_view_t,
+                               c_lno_view_t, term_view_t>{
+          m, rows_per_team, row_mapA, entriesA, row_mapB, entriesB, row_mapC,
+          entriesC, term_offsets, positions});
+  sh->set_numeric_reuse_data(term_offsets, positions);
+}
+
+/// Numeric phase of C = A*B from the term positions stored in sh.
+template <typename ExecutionSpace, typename spgemm_handle_t,
+          typename a_row_view_t, typename a_lno_view_t,
+          typename a_scalar_view_t, typename b_row_view_t,
+          typename b_scalar_view_t, typename c_row_view_t,
+          typename c_scalar_view_t>
+void spgemm_numeric_reuse(const ExecutionSpace& space, spgemm_handle_t* sh,
+                          const typename spgemm_handle_t::nnz_lno_t m,
+                          const typename spgemm_handle_t::nnz_lno_t n,
+                          const a_row_view_t& row_mapA,
+                          const a_lno_view_t& entriesA,
+                          const a_scalar_view_t& valuesA,
+                          const b_row_view_t& row_mapB,
+                          const b_scalar_view_t& valuesB,
+                          const c_row_view_t& row_mapC,
+                          const c_scalar_view_t& valuesC) {
+  using size_type = typename spgemm_handle_t::size_type;
+  using lno_t     = typename spgemm_handle_t::nnz_lno_t;
+  using term_view_t =
+      typename spgemm_handle_t::row_lno_persistent_work_view_t;
+
+  int team_size, vector_size;
+  lno_t rows_per_team;
+  spgemm_numeric_reuse_policy<ExecutionSpace>(
+      n, size_type(valuesB.extent(0)), team_size, vector_size, rows_per_team);
+  const lno_t numTeams = (m + rows_per_team - 1) / rows_per_team;
+  Kokkos::parallel_for(
+      "KokkosSparse::spgemm_numeric_reuse::scatter",
+      Kokkos::TeamPolicy<ExecutionSpace>(space, numTeams, team_size,
+                                         vector_size),
+      SpgemmReuseNumeric<ExecutionSpace, a_row_view_t, a_lno_view_t,
+                         a_scalar_view_t, b_row_view_t, b_scalar_view_t,
+                         c_row_view_t, c_scalar_view_t, term_view_t>{
+          m, rows_per_team, row_mapA, entriesA, valuesA, row_mapB, valuesB,
+          row_mapC, valuesC, sh->get_numeric_reuse_term_offsets(),
+          sh->get_numeric_reuse_positions()});
+}
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPGEMM_NUMERIC_REUSE_IMPL_HPP_
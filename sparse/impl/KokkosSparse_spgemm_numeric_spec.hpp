@@ -26,6 +26,7 @@
 #include "KokkosSparse_spgemm_symbolic.hpp"
 #include "KokkosSparse_spgemm_impl.hpp"
 #include "KokkosSparse_spgemm_impl_seq.hpp"
+#include "KokkosSparse_spgemm_numeric_reuse_impl.hpp"
 #include "KokkosSparse_SortCrs.hpp"
 #endif
 
@@ -107,13 +108,13 @@ template <class KernelHandle, class a_size_view_t_, class a_lno_view_t,
               c_lno_view_t, c_scalar_view_t>::value>
 struct SPGEMM_NUMERIC {
   static void spgemm_numeric(
-      KernelHandle *handle, typename KernelHandle::nnz_lno_t m,
-      typename KernelHandle::nnz_lno_t n, typename KernelHandle::nnz_lno_t k,
-      a_size_view_t_ row_mapA, a_lno_view_t entriesA, a_scalar_view_t valuesA,
-
-      bool transposeA, b_size_view_t_ row_mapB, b_lno_view_t entriesB,
-      b_scalar_view_t valuesB, bool transposeB, c_size_view_t_ row_mapC,
-      c_lno_view_t entriesC, c_scalar_view_t valuesC);
+      const typename KernelHandle::HandleExecSpace &space, KernelHandle *handle,
+      typename KernelHandle::nnz_lno_t m, typename KernelHandle::nnz_lno_t n,
+      typename KernelHandle::nnz_lno_t k, a_size_view_t_ row_mapA,
+      a_lno_view_t entriesA, a_scalar_view_t valuesA, bool transposeA,
+      b_size_view_t_ row_mapB, b_lno_view_t entriesB, b_scalar_view_t valuesB,
+      bool transposeB, c_size_view_t_ row_mapC, c_lno_view_t entriesC,
+      c_scalar_view_t valuesC);
 };
 
 #if !defined(KOKKOSKERNELS_ETI_ONLY) || KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
@@ -129,12 +130,13 @@ struct SPGEMM_NUMERIC<
     b_lno_view_t, b_scalar_view_t, c_size_view_t_, c_lno_view_t,
     c_scalar_view_t, false, KOKKOSKERNELS_IMPL_COMPILE_LIBRARY> {
   static void spgemm_numeric(
-      KernelHandle *handle, typename KernelHandle::nnz_lno_t m,
-      typename KernelHandle::nnz_lno_t n, typename KernelHandle::nnz_lno_t k,
-      a_size_view_t_ row_mapA, a_lno_view_t entriesA, a_scalar_view_t valuesA,
-      bool transposeA, b_size_view_t_ row_mapB, b_lno_view_t entriesB,
-      b_scalar_view_t valuesB, bool transposeB, c_size_view_t_ row_mapC,
-      c_lno_view_t entriesC, c_scalar_view_t valuesC) {
+      const typename KernelHandle::HandleExecSpace &space, KernelHandle *handle,
+      typename KernelHandle::nnz_lno_t m, typename KernelHandle::nnz_lno_t n,
+      typename KernelHandle::nnz_lno_t k, a_size_view_t_ row_mapA,
+      a_lno_view_t entriesA, a_scalar_view_t valuesA, bool transposeA,
+      b_size_view_t_ row_mapB, b_lno_view_t entriesB, b_scalar_view_t valuesB,
+      bool transposeB, c_size_view_t_ row_mapC, c_lno_view_t entriesC,
+      c_scalar_view_t valuesC) {
     typedef typename KernelHandle::SPGEMMHandleType spgemmHandleType;
     spgemmHandleType *sh = handle->get_spgemm_handle();
     if (!sh->is_symbolic_called()) {
@@ -147,29 +149,44 @@ struct SPGEMM_NUMERIC<
       sh->set_computed_entries();
       return;
     }
+    Kokkos::Profiling::pushRegion(KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+                                      ? "KokkosSparse::spgemm_numeric[ETI]"
+                                      : "KokkosSparse::spgemm_numeric[noETI]");
+    const bool reuse = sh->get_numeric_reuse() && !transposeA && !transposeB;
+    if (reuse && sh->is_numeric_reuse_ready()) {
+      // Same sparsity as the call which stored the term positions: C is a
+      // scatter-add of the product terms
+      spgemm_numeric_reuse(space, sh, m, n, row_mapA, entriesA, valuesA,
+                           row_mapB, valuesB, row_mapC, valuesC);
+      sh->set_call_numeric();
+      Kokkos::Profiling::popRegion();
+      return;
+    }
     switch (sh->get_algorithm_type()) {
       case SPGEMM_SERIAL:
       case SPGEMM_DEBUG:
-        spgemm_debug_numeric(handle, m, n, k, row_mapA, entriesA, valuesA,
-
-                             transposeA, row_mapB, entriesB, valuesB,
+        spgemm_debug_numeric(space, handle, m, n, k, row_mapA, entriesA,
+                             valuesA, transposeA, row_mapB, entriesB, valuesB,
                              transposeB, row_mapC, entriesC, valuesC);
         break;
       default: {
         KokkosSPGEMM<KernelHandle, a_size_view_t_, a_lno_view_t,
                      a_scalar_view_t, b_size_view_t_, b_lno_view_t,
                      b_scalar_view_t>
-            kspgemm(handle, m, n, k, row_mapA, entriesA, valuesA, transposeA,
-                    row_mapB, entriesB, valuesB, transposeB);
+            kspgemm(space, handle, m, n, k, row_mapA, entriesA, valuesA,
+                    transposeA, row_mapB, entriesB, valuesB, transposeB);
         kspgemm.KokkosSPGEMM_numeric(row_mapC, entriesC, valuesC);
       } break;
     }
     // Current implementation does not produce sorted matrix
     // TODO: remove this call when impl sorts
-    KokkosSparse::sort_crs_matrix<typename KernelHandle::HandleExecSpace>(
-        row_mapC, entriesC, valuesC);
+    KokkosSparse::sort_crs_matrix(space, row_mapC, entriesC, valuesC);
+    if (reuse)
+      spgemm_numeric_reuse_setup(space, sh, m, n, row_mapA, entriesA, row_mapB,
+                                 entriesB, row_mapC, entriesC);
     sh->set_call_numeric();
     sh->set_computed_entries();
+    Kokkos::Profiling::popRegion();
   }
 };
 
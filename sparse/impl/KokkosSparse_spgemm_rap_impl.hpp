@@ -0,0 +1,278 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_SPGEMM_RAP_IMPL_HPP_
+#define KOKKOSSPARSE_SPGEMM_RAP_IMPL_HPP_
+
+#include "Kokkos_ArithTraits.hpp"
+#include "KokkosKernels_ExecSpaceUtils.hpp"
+#include "KokkosKernels_SimpleUtils.hpp"
+#include "KokkosKernels_Uniform_Initialized_MemoryPool.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+
+// Fused triple product C = R*A*P.
+//
+// Each thread computes one row i of C at a time, in two steps with a dense
+// accumulator each (as in the dense-accumulator SpGEMM and Jacobi kernels):
+//  1. row i of R*A, from the rows of A selected by row i of R;
+//  2. row i of C, from the rows of P selected by the entries of that row.
+// Only one row of R*A per thread exists at any time, so neither R*A nor A*P
+// is ever formed.
+//
+// The vector lanes of a thread split one row of A (or P) at a time. The
+// columns of a row are distinct, so the lanes never update the same entry
+// of an accumulator at the same time; only the list of occupied columns
+// needs an atomic counter.
+//
+// The accumulators come from two memory pools, whose chunks hold
+//  - ordinals: the markers and lists of the occupied columns of both rows,
+//    and the two list lengths (2 * numColsA + 2 * numColsP + 2);
+//  - values: the two dense rows (numColsA + numColsP), numeric only.
+// Every thread leaves its chunks zeroed, as it got them.
+//
+// In the symbolic phase (numeric == false), the number of entries of row i
+// of C is written to row_mapC(i). In the numeric phase, the list of occupied
+// columns of row i of C is its (unsorted) entries.
+template <typename ExecutionSpace, typename RMatrix, typename AMatrix,
+          typename PMatrix, typename c_row_view_t, typename c_lno_view_t,
+          typename c_scalar_view_t, typename lno_pool_t,
+          typename scalar_pool_t, bool numeric>
+struct SpgemmRapFunctor {
+  using size_type   = typename c_row_view_t::non_const_value_type;
+  using lno_t       = typename c_lno_view_t::non_const_value_type;
+  using scalar_t    = typename c_scalar_view_t::non_const_value_type;
+  using team_member = typename Kokkos::TeamPolicy<ExecutionSpace>::member_type;
+
+  lno_t m;
+  lno_t numColsA;
+  lno_t numColsP;
+  lno_t rows_per_team;
+  RMatrix R;
+  AMatrix A;
+  PMatrix P;
+  c_row_view_t row_mapC;
+  c_lno_view_t entriesC;
+  c_scalar_view_t valuesC;
+  lno_pool_t lno_pool;
+  scalar_pool_t scalar_pool;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const team_member& dev) const {
+    const lno_t begin = dev.league_rank() * rows_per_team;
+    const lno_t end   = KOKKOSKERNELS_MACRO_MIN(begin + rows_per_team, m);
+    const size_t tid  = dev.league_rank() * dev.team_size() + dev.team_rank();
+
+    lno_t* lnoChunk    = nullptr;
+    scalar_t* accChunk = nullptr;
+    Kokkos::single(
+        Kokkos::PerThread(dev),
+        [&](lno_t*& chunk) {
+          chunk = nullptr;
+          while (chunk == nullptr) chunk = lno_pool.allocate_chunk(tid);
+        },
+        lnoChunk);
+    if constexpr (numeric) {
+      Kokkos::single(
+          Kokkos::PerThread(dev),
+          [&](scalar_t*& chunk) {
+            chunk = nullptr;
+            while (chunk == nullptr) chunk = scalar_pool.allocate_chunk(tid);
+          },
+          accChunk);
+    }
+    lno_t* raMark   = lnoChunk;
+    lno_t* raList   = raMark + numColsA;
+    lno_t* cMark    = raList + numColsA;
+    lno_t* cScratch = cMark + numColsP;
+    lno_t* counts   = cScratch + numColsP;
+    scalar_t* raAcc = accChunk;
+    scalar_t* cAcc  = accChunk + numColsA;
+
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(dev, begin, end), [&](const lno_t i) {
+          lno_t* cList = cScratch;
+          if constexpr (numeric) cList = &entriesC(row_mapC(i));
+          Kokkos::parallel_for(Kokkos::ThreadVectorRange(dev, 2),
+                               [&](const int c) { counts[c] = 0; });
+
+          // Row i of R*A
+          for (size_type kr = R.graph.row_map(i); kr < R.graph.row_map(i + 1);
+               kr++) {
+            const lno_t k        = R.graph.entries(kr);
+            const size_type aBeg = A.graph.row_map(k);
+            const size_type aLen = A.graph.row_map(k + 1) - aBeg;
+            scalar_t r           = Kokkos::ArithTraits<scalar_t>::zero();
+            if constexpr (numeric) r = R.values(kr);
+            Kokkos::parallel_for(
+                Kokkos::ThreadVectorRange(dev, aLen), [&](const size_type l) {
+                  const lno_t col = A.graph.entries(aBeg + l);
+                  if (!raMark[col]) {
+                    raMark[col] = 1;
+                    raList[Kokkos::atomic_fetch_add(&counts[0], lno_t(1))] =
+                        col;
+                  }
+                  if constexpr (numeric) raAcc[col] += r * A.values(aBeg + l);
+                });
+          }
+          const lno_t raLen = counts[0];
+
+          // Row i of (R*A)*P
+          for (lno_t t = 0; t < raLen; t++) {
+            const lno_t l        = raList[t];
+            const size_type pBeg = P.graph.row_map(l);
+            const size_type pLen = P.graph.row_map(l + 1) - pBeg;
+            scalar_t ra          = Kokkos::ArithTraits<scalar_t>::zero();
+            if constexpr (numeric) ra = raAcc[l];
+            Kokkos::parallel_for(
+                Kokkos::ThreadVectorRange(dev, pLen), [&](const size_type q) {
+                  const lno_t col = P.graph.entries(pBeg + q);
+                  if (!cMark[col]) {
+                    cMark[col] = 1;
+                    cList[Kokkos::atomic_fetch_add(&counts[1], lno_t(1))] =
+                        col;
+                  }
+                  if constexpr (numeric) cAcc[col] += ra * P.values(pBeg + q);
+                });
+          }
+          const lno_t cLen = counts[1];
+
+          // Write the row and zero the accumulators again
+          Kokkos::parallel_for(Kokkos::ThreadVectorRange(dev, raLen),
+                               [&](const lno_t t) {
+                                 const lno_t l = raList[t];
+                                 raMark[l]     = 0;
+                                 if constexpr (numeric)
+                                   raAcc[l] =
+                                       Kokkos::ArithTraits<scalar_t>::zero();
+                               });
+          Kokkos::parallel_for(
+              Kokkos::ThreadVectorRange(dev, cLen), [&](const lno_t t) {
+                const lno_t j = cList[t];
+                cMark[j]      = 0;
+                if constexpr (numeric) {
+                  valuesC(row_mapC(i) + t) = cAcc[j];
+                  cAcc[j] = Kokkos::ArithTraits<scalar_t>::zero();
+                }
+              });
+          if constexpr (!numeric) {
+            Kokkos::single(Kokkos::PerThread(dev),
+                           [&]() { row_mapC(i) = cLen; });
+          }
+        });
+
+    Kokkos::single(Kokkos::PerThread(dev), [&]() {
+      lno_pool.release_chunk(lnoChunk);
+      if constexpr (numeric) scalar_pool.release_chunk(accChunk);
+    });
+  }
+};
+
+/// Team policy parameters and number of accumulator chunks for the RAP
+/// kernels: on GPUs, vector lanes for an average row of A and 128 threads
+/// per team, with as many chunks as fit in half the free memory; on CPUs
+/// one thread (and one chunk) per team of 16 rows.
+template <typename ExecutionSpace, typename MemorySpace, typename AMatrix>
+void spgemm_rap_policy(const AMatrix& A, const size_t chunk_bytes,
+                       int& team_size, int& vector_size,
+                       typename AMatrix::non_const_ordinal_type& rows_per_team,
+                       size_t& num_chunks) {
+  team_size     = 1;
+  vector_size   = 1;
+  rows_per_team = 16;
+  num_chunks    = ExecutionSpace().concurrency();
+  if constexpr (KokkosKernels::Impl::kk_is_gpu_exec_space<ExecutionSpace>()) {
+    vector_size = KokkosKernels::Impl::kk_get_suggested_vector_size(
+        A.numRows(), A.nnz(),
+        KokkosKernels::Impl::kk_get_exec_space_type<ExecutionSpace>());
+    if (vector_size > 32) vector_size = 32;
+    team_size     = 128 / vector_size;
+    rows_per_team = team_size;
+    num_chunks /= vector_size;
+    size_t free_byte, total_byte;
+    KokkosKernels::Impl::kk_get_free_total_memory<MemorySpace>(free_byte,
+                                                               total_byte);
+    if (num_chunks * chunk_bytes > free_byte / 2)
+      num_chunks = (free_byte / 2) / chunk_bytes;
+    if (num_chunks < 1) num_chunks = 1;
+  }
+}
+
+/// Run the symbolic (numeric == false) or numeric phase of C = R*A*P. The
+/// symbolic phase writes the row map of C and returns its number of entries;
+/// the numeric phase writes the (unsorted) entries and values of C.
+template <bool numeric, typename ExecutionSpace, typename MemorySpace,
+          typename RMatrix, typename AMatrix, typename PMatrix,
+          typename c_row_view_t, typename c_lno_view_t,
+          typename c_scalar_view_t>
+typename c_row_view_t::non_const_value_type spgemm_rap_impl(
+    const RMatrix& R, const AMatrix& A, const PMatrix& P,
+    const c_row_view_t& row_mapC, const c_lno_view_t& entriesC,
+    const c_scalar_view_t& valuesC) {
+  using size_type     = typename c_row_view_t::non_const_value_type;
+  using lno_t         = typename c_lno_view_t::non_const_value_type;
+  using scalar_t      = typename c_scalar_view_t::non_const_value_type;
+  using pool_device_t = Kokkos::Device<ExecutionSpace, MemorySpace>;
+  using lno_pool_t =
+      KokkosKernels::Impl::UniformMemoryPool<pool_device_t, lno_t>;
+  using scalar_pool_t =
+      KokkosKernels::Impl::UniformMemoryPool<pool_device_t, scalar_t>;
+  using functor_t =
+      SpgemmRapFunctor<ExecutionSpace, RMatrix, AMatrix, PMatrix, c_row_view_t,
+                       c_lno_view_t, c_scalar_view_t, lno_pool_t,
+                       scalar_pool_t, numeric>;
+
+  const lno_t m               = R.numRows();
+  const lno_t numColsA        = A.numCols();
+  const lno_t numColsP        = P.numCols();
+  const size_t lnoChunkSize   = 2 * size_t(numColsA) + 2 * size_t(numColsP) + 2;
+  const size_t valueChunkSize = numeric ? size_t(numColsA) + numColsP : 0;
+
+  int team_size, vector_size;
+  lno_t rows_per_team;
+  size_t num_chunks;
+  spgemm_rap_policy<ExecutionSpace, MemorySpace>(
+      A, lnoChunkSize * sizeof(lno_t) + valueChunkSize * sizeof(scalar_t),
+      team_size, vector_size, rows_per_team, num_chunks);
+
+  lno_pool_t lno_pool(num_chunks, lnoChunkSize, lno_t(0),
+                      KokkosKernels::Impl::ManyThread2OneChunk);
+  scalar_pool_t scalar_pool;
+  if constexpr (numeric)
+    scalar_pool = scalar_pool_t(num_chunks, valueChunkSize,
+                                Kokkos::ArithTraits<scalar_t>::zero(),
+                                KokkosKernels::Impl::ManyThread2OneChunk);
+
+  const lno_t numTeams = (m + rows_per_team - 1) / rows_per_team;
+  Kokkos::parallel_for(
+      numeric ? "KokkosSparse::spgemm_rap::numeric"
+              : "KokkosSparse::spgemm_rap::symbolic",
+      Kokkos::TeamPolicy<ExecutionSpace>(numTeams, team_size, vector_size),
+      functor_t{m, numColsA, numColsP, rows_per_team, R, A, P, row_mapC,
+                entriesC, valuesC, lno_pool, scalar_pool});
+
+  size_type c_nnz = 0;
+  if constexpr (!numeric) {
+    KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum(
+        ExecutionSpace(), m + 1, row_mapC, c_nnz);
+  }
+  return c_nnz;
+}
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPGEMM_RAP_IMPL_HPP_
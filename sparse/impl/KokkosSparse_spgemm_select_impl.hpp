@@ -0,0 +1,254 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_SPGEMM_SELECT_IMPL_HPP_
+#define KOKKOSSPARSE_SPGEMM_SELECT_IMPL_HPP_
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <Kokkos_Core.hpp>
+#include "KokkosKernels_ExecSpaceUtils.hpp"
+#include "KokkosSparse_spgemm_handle.hpp"
+#include "KokkosSparse_spgemm_adaptive_impl.hpp"
+#include "KokkosSparse_spgemm_memory_estimate_impl.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+
+// Algorithm selection of SpGEMM (SPGEMMHandle::set_algorithm_selection).
+//
+// The statistics take two passes over the rows, one of A (multiplications
+// per row, as for the memory estimate) and one of B (number of sets of the
+// compressed B, see KokkosSparse_spgemm_impl_compression.hpp). The cost
+// model then compares, on CPUs, SPGEMM_SERIAL (only if no algorithm was
+// requested), SPGEMM_KK_DENSE and SPGEMM_KK_MEMORY. The parallel ones take
+// the time of the longest row or of an even share of the multiplications,
+// whichever is larger. On GPUs only the hash map algorithms are run by
+// SPGEMM_KK, so the choice is between a thread per row of C
+// (SPGEMM_KK_MEMORY, if a row fits in the shared memory of a thread for
+// some vector size) and a team per row (SPGEMM_KK_LP).
+
+// Number of entries of the compressed B: consecutive entries of a row
+// whose columns fall in the same bitset of lno_t are merged. Unsorted rows
+// are overcounted, which only makes the estimate conservative.
+template <class ExecSpace, class lno_t, class b_row_view_t,
+          class b_entries_view_t>
+size_t spgemm_compressed_nnz(const ExecSpace &space, const size_t k,
+                             const b_row_view_t &rowmapB,
+                             const b_entries_view_t &entriesB) {
+  constexpr int shift = sizeof(lno_t) == 8 ? 6 : (sizeof(lno_t) == 4 ? 5 : 4);
+  size_t sets         = 0;
+  if (!k) return sets;
+  Kokkos::parallel_reduce(
+      "KokkosSparse::spgemm_select::compressed_nnz",
+      Kokkos::RangePolicy<ExecSpace>(space, 0, k),
+      KOKKOS_LAMBDA(const size_t i, size_t &lsets) {
+        lno_t prev = 0;
+        for (auto q = rowmapB(i); q < rowmapB(i + 1); q++) {
+          const lno_t set = lno_t(entriesB(q)) >> shift;
+          if (q == rowmapB(i) || set != prev) lsets++;
+          prev = set;
+        }
+      },
+      sets);
+  return sets;
+}
+
+// Fill the statistics of the selection
+template <class ExecSpace, class lno_t, class a_row_view_t,
+          class a_entries_view_t, class b_row_view_t, class b_entries_view_t>
+void spgemm_selection_stats(const ExecSpace &space, SPGEMMSelection &sel,
+                            const size_t m, const size_t k, const size_t n,
+                            const a_row_view_t &rowmapA,
+                            const a_entries_view_t &entriesA,
+                            const b_row_view_t &rowmapB,
+                            const b_entries_view_t &entriesB,
+                            const size_t shmem_bytes) {
+  const auto bounds =
+      spgemm_product_bounds(space, m, n, rowmapA, entriesA, rowmapB);
+  sel.flops         = bounds.flops;
+  sel.max_row_flops = bounds.max_row_flops;
+  sel.avg_row_flops = m ? double(bounds.flops) / m : 0.0;
+  const size_t b_nnz = entriesB.extent(0);
+  sel.compression =
+      b_nnz ? double(spgemm_compressed_nnz<ExecSpace, lno_t>(
+                  space, k, rowmapB, entriesB)) /
+                  b_nnz
+            : 1.0;
+  sel.shmem_bytes = shmem_bytes;
+  sel.concurrency = space.concurrency();
+}
+
+// Choose the algorithm, accumulator, and team and vector sizes from the
+// statistics in sel, for a product with n columns and nnzA entries in A
+template <class ExecSpace, class lno_t, class scalar_t>
+void spgemm_select_algorithm(SPGEMMSelection &sel,
+                             const SPGEMMCostModel &model, const size_t n,
+                             const size_t nnzA, const size_t max_dense_cols,
+                             const double compression_cut_off,
+                             const bool allow_serial) {
+  constexpr bool exec_gpu =
+      KokkosKernels::Impl::kk_is_gpu_exec_space<ExecSpace>();
+  const auto exec_type =
+      KokkosKernels::Impl::kk_get_exec_space_type<ExecSpace>();
+  const double flops = double(sel.flops);
+  const double threads =
+      exec_gpu ? double(spgemm_concurrent_accumulators<ExecSpace>())
+               : double(sel.concurrency);
+  // Time of the parallel algorithms in multiplications of one thread, and
+  // the symbolic phase works on the compressed B if that pays off
+  const double parallel_flops =
+      std::max(flops / std::max(threads, 1.0), double(sel.max_row_flops));
+  const double phases =
+      1.0 + (sel.compression < compression_cut_off ? sel.compression : 1.0);
+  // Entries of an average row of C
+  const double c_row = std::min(sel.avg_row_flops, double(n));
+  const auto miss    = [&](double entries) {
+    return entries > double(model.cache_entries) ? model.cache_miss : 1.0;
+  };
+
+  sel.serial_cost = 0;
+  sel.dense_cost  = 0;
+  sel.hash_cost   = model.hash_flop * miss(c_row) * parallel_flops * phases +
+                  model.launch;
+  sel.algorithm   = SPGEMM_KK_MEMORY;
+  sel.accumulator = SPGEMM_ACC_DEFAULT;
+  sel.team_size   = -1;
+  sel.vector_size = -1;
+
+  if (exec_gpu) {
+    // A thread per row with vector lanes over the rows of B, as long as an
+    // average row of C fits in the shared memory of a thread
+    const int max_vector =
+        KokkosKernels::Impl::kk_get_max_vector_size<ExecSpace>();
+    const double b_row = nnzA ? flops / nnzA : 0.0;
+    int vector         = 4;
+    while (vector < max_vector && vector < b_row) vector *= 2;
+    vector = std::min(vector, max_vector);
+    // Keys, hash begins and nexts, and values of the hash map of a thread
+    const auto fits = [&](int v) {
+      const int team =
+          KokkosKernels::Impl::kk_get_suggested_team_size(v, exec_type);
+      const size_t unit         = 3 * sizeof(lno_t) + sizeof(scalar_t);
+      const size_t thread_bytes = sel.shmem_bytes / team;
+      return thread_bytes > 4 * sizeof(lno_t) &&
+             c_row <= double((thread_bytes - 4 * sizeof(lno_t)) / unit);
+    };
+    while (!fits(vector) && vector < max_vector) vector *= 2;
+    if (fits(vector)) {
+      sel.vector_size = vector;
+      sel.team_size =
+          KokkosKernels::Impl::kk_get_suggested_team_size(vector, exec_type);
+    } else {
+      // The rows of C spill to global memory: a team per row
+      sel.algorithm = SPGEMM_KK_LP;
+      sel.hash_cost = model.hash_flop * model.cache_miss * parallel_flops *
+                          phases +
+                      model.launch;
+    }
+    return;
+  }
+
+  double best = sel.hash_cost;
+  if (n < max_dense_cols) {
+    sel.dense_cost = model.dense_flop * miss(double(n)) * parallel_flops *
+                         phases +
+                     model.dense_column * n + model.launch;
+    if (sel.dense_cost < best) {
+      best          = sel.dense_cost;
+      sel.algorithm = SPGEMM_KK_DENSE;
+    }
+    // Skewed rows: the small ones with a list in registers, the others
+    // with a dense accumulator
+    if (double(sel.max_row_flops) > model.skew * sel.avg_row_flops &&
+        sel.avg_row_flops <= spgemm_adaptive_small_flops)
+      sel.accumulator = SPGEMM_ACC_ADAPTIVE;
+  }
+  if (allow_serial) {
+    sel.serial_cost = model.serial_flop * flops * 2.0;
+    if (sel.serial_cost < best) {
+      sel.algorithm   = SPGEMM_SERIAL;
+      sel.accumulator = SPGEMM_ACC_DEFAULT;
+      return;
+    }
+  }
+  sel.vector_size = 1;
+  sel.team_size =
+      KokkosKernels::Impl::kk_get_suggested_team_size(1, exec_type);
+}
+
+// Run the selection for C = A*B (A is m x k, B is k x n) if the handle
+// asks for it
+template <class KernelHandle, class a_row_view_t, class a_entries_view_t,
+          class b_row_view_t, class b_entries_view_t>
+void spgemm_select(const typename KernelHandle::HandleExecSpace &space,
+                   KernelHandle &handle, const size_t m, const size_t k,
+                   const size_t n, const a_row_view_t &rowmapA,
+                   const a_entries_view_t &entriesA,
+                   const b_row_view_t &rowmapB,
+                   const b_entries_view_t &entriesB) {
+  using exec_space = typename KernelHandle::HandleExecSpace;
+  using lno_t      = typename KernelHandle::nnz_lno_t;
+  using scalar_t   = typename KernelHandle::nnz_scalar_t;
+  auto sh          = handle.get_spgemm_handle();
+  if (!sh->is_algorithm_selection_pending()) return;
+  SPGEMMSelection sel;
+  spgemm_selection_stats<exec_space, lno_t>(space, sel, m, k, n, rowmapA,
+                                            entriesA, rowmapB, entriesB,
+                                            handle.get_shmem_size());
+  spgemm_select_algorithm<exec_space, lno_t, scalar_t>(
+      sel, sh->get_cost_model(), n, entriesA.extent(0), sh->MaxColDenseAcc,
+      sh->get_compression_cut_off(),
+      sh->get_requested_algorithm() == SPGEMM_DEFAULT);
+  // An accumulator set by the caller is kept
+  if (sh->get_accumulator_type() != SPGEMM_ACC_DEFAULT)
+    sel.accumulator = sh->get_accumulator_type();
+  sel.done = true;
+  sh->set_algorithm_selection_result(sel);
+}
+
+// Use the team and vector sizes of the selection, unless set in the handle
+template <class KernelHandle>
+void spgemm_apply_selected_launch(KernelHandle &handle) {
+  const auto &sel =
+      handle.get_spgemm_handle()->get_algorithm_selection_result();
+  if (!sel.done) return;
+  if (handle.get_set_suggested_vector_size() == -1 && sel.vector_size > 0)
+    handle.set_suggested_vector_size(sel.vector_size);
+  if (handle.get_set_suggested_team_size() == -1 && sel.team_size > 0)
+    handle.set_suggested_team_size(sel.team_size);
+}
+
+// The selection as a JSON object, for the dispatch trace
+inline std::string spgemm_selection_json(const SPGEMMSelection &sel) {
+  std::ostringstream os;
+  os << "{\"flops\":" << sel.flops << ",\"max_row_flops\":"
+     << sel.max_row_flops << ",\"avg_row_flops\":" << sel.avg_row_flops
+     << ",\"compression\":" << sel.compression
+     << ",\"shmem_bytes\":" << sel.shmem_bytes
+     << ",\"concurrency\":" << sel.concurrency
+     << ",\"serial_cost\":" << sel.serial_cost
+     << ",\"dense_cost\":" << sel.dense_cost
+     << ",\"hash_cost\":" << sel.hash_cost << ",\"accumulator\":"
+     << static_cast<int>(sel.accumulator) << "}";
+  return os.str();
+}
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPGEMM_SELECT_IMPL_HPP_
@@ -85,14 +85,13 @@ template <class KernelHandle, class a_size_view_t_, class a_lno_view_t,
               KernelHandle, a_size_view_t_, a_lno_view_t, b_size_view_t_,
               b_lno_view_t, c_size_view_t_>::value>
 struct SPGEMM_SYMBOLIC {
-  static void spgemm_symbolic(KernelHandle *handle,
-                              typename KernelHandle::nnz_lno_t m,
-                              typename KernelHandle::nnz_lno_t n,
-                              typename KernelHandle::nnz_lno_t k,
-                              a_size_view_t_ row_mapA, a_lno_view_t entriesA,
-                              bool transposeA, b_size_view_t_ row_mapB,
-                              b_lno_view_t entriesB, bool transposeB,
-                              c_size_view_t_ row_mapC, bool computeRowptrs);
+  static void spgemm_symbolic(
+      const typename KernelHandle::HandleExecSpace &space, KernelHandle *handle,
+      typename KernelHandle::nnz_lno_t m, typename KernelHandle::nnz_lno_t n,
+      typename KernelHandle::nnz_lno_t k, a_size_view_t_ row_mapA,
+      a_lno_view_t entriesA, bool transposeA, b_size_view_t_ row_mapB,
+      b_lno_view_t entriesB, bool transposeB, c_size_view_t_ row_mapC,
+      bool computeRowptrs);
 };
 
 #if !defined(KOKKOSKERNELS_ETI_ONLY) || KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
@@ -104,11 +103,12 @@ struct SPGEMM_SYMBOLIC<KernelHandle, a_size_view_t_, a_lno_view_t,
                        b_size_view_t_, b_lno_view_t, c_size_view_t_, false,
                        KOKKOSKERNELS_IMPL_COMPILE_LIBRARY> {
   static void spgemm_symbolic(
-      KernelHandle *handle, typename KernelHandle::nnz_lno_t m,
-      typename KernelHandle::nnz_lno_t n, typename KernelHandle::nnz_lno_t k,
-      a_size_view_t_ row_mapA, a_lno_view_t entriesA, bool transposeA,
-      b_size_view_t_ row_mapB, b_lno_view_t entriesB, bool transposeB,
-      c_size_view_t_ row_mapC, bool /* computeRowptrs */) {
+      const typename KernelHandle::HandleExecSpace &space, KernelHandle *handle,
+      typename KernelHandle::nnz_lno_t m, typename KernelHandle::nnz_lno_t n,
+      typename KernelHandle::nnz_lno_t k, a_size_view_t_ row_mapA,
+      a_lno_view_t entriesA, bool transposeA, b_size_view_t_ row_mapB,
+      b_lno_view_t entriesB, bool transposeB, c_size_view_t_ row_mapC,
+      bool /* computeRowptrs */) {
     typedef typename KernelHandle::SPGEMMHandleType spgemmHandleType;
     spgemmHandleType *sh = handle->get_spgemm_handle();
     if (sh->is_symbolic_called() && sh->are_rowptrs_computed()) return;
@@ -117,15 +117,17 @@ struct SPGEMM_SYMBOLIC<KernelHandle, a_size_view_t_, a_lno_view_t,
       sh->set_computed_rowptrs();
       sh->set_call_symbolic();
       sh->set_c_nnz(0);
-      Kokkos::deep_copy(typename spgemmHandleType::HandleExecSpace(), row_mapC,
+      Kokkos::deep_copy(space, row_mapC,
                         typename c_size_view_t_::non_const_value_type(0));
       return;
     }
+    Kokkos::Profiling::pushRegion(KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+                                      ? "KokkosSparse::spgemm_symbolic[ETI]"
+                                      : "KokkosSparse::spgemm_symbolic[noETI]");
     switch (sh->get_algorithm_type()) {
       case SPGEMM_SERIAL:
       case SPGEMM_DEBUG:
-        spgemm_debug_symbolic(handle, m, n, k, row_mapA, entriesA,
-
+        spgemm_debug_symbolic(space, handle, m, n, k, row_mapA, entriesA,
                               transposeA, row_mapB, entriesB, transposeB,
                               row_mapC);
         break;
@@ -134,14 +136,15 @@ struct SPGEMM_SYMBOLIC<KernelHandle, a_size_view_t_, a_lno_view_t,
                      typename KernelHandle::in_scalar_nnz_view_t,
                      b_size_view_t_, b_lno_view_t,
                      typename KernelHandle::in_scalar_nnz_view_t>
-            kspgemm(handle, m, n, k, row_mapA, entriesA, transposeA, row_mapB,
-                    entriesB, transposeB);
+            kspgemm(space, handle, m, n, k, row_mapA, entriesA, transposeA,
+                    row_mapB, entriesB, transposeB);
         kspgemm.KokkosSPGEMM_symbolic(row_mapC);
       } break;
     }
     sh->set_call_symbolic();
     // The KokkosKernels implementation of symbolic always populates rowptrs.
     sh->set_computed_rowptrs();
+    Kokkos::Profiling::popRegion();
   }
 };
 
@@ -0,0 +1,407 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_SPGEMM_TRANSPOSE_IMPL_HPP_
+#define KOKKOSSPARSE_SPGEMM_TRANSPOSE_IMPL_HPP_
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include "Kokkos_Core.hpp"
+#include "KokkosKernels_SimpleUtils.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_SortCrs.hpp"
+#include "KokkosSparse_Utils.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+
+// SpGEMM with one transposed operand, computed from the CRS arrays of A and
+// B without transposing the values of either.
+//
+// Row i of C is the sum, over the entries (k, val) of row i of a left
+// operand L, of val times row k of a right operand R:
+// - C = A^T B: L = A^T, whose row i is column i of A, and R = B.
+// - C = A B^T: L = A, and R = B^T, whose row k is column k of B.
+// The transposed operand is indexed by columns: the rows of its entries and
+// their positions in its values, which are read in place. Only the entries
+// that can contribute to C are indexed: for A^T B, those in the rows of A
+// whose row of B is not empty; for A B^T, those in the columns of B that
+// appear in A.
+//
+// A symbolic pass counts the columns of each row of C, then a numeric pass
+// accumulates each row in place in C and the rows are sorted. Each pass
+// runs a bounded number of slots, which take the rows of C one at a time.
+// A slot keeps the offset in the current row of C of each column of C, in
+// a dense array of numCols(C) ordinals.
+//
+// Peak memory, besides A, B and C: the column index (numCols + 1 offsets
+// twice, and one ordinal and one offset per indexed entry) and the slot
+// arrays, at most spgemm_transpose_workspace_bytes. Unlike an expansion of
+// the scalar products, it does not grow with the flop count.
+
+// Workspace budget of the slot arrays, which bounds the number of slots
+constexpr size_t spgemm_transpose_workspace_bytes = size_t(1) << 28;
+
+// The number of entries of op(A) * op(B), checked against the offset type of
+// C before C is allocated.
+template <typename size_type>
+void spgemm_transpose_check_nnz(int64_t nnz) {
+  if (uint64_t(nnz) > uint64_t(std::numeric_limits<size_type>::max())) {
+    std::ostringstream os;
+    os << "KokkosSparse::spgemm: the " << nnz << " entries of the "
+       << "transposed product do not fit in the offset type of C";
+    throw std::invalid_argument(os.str());
+  }
+}
+
+// Index of the entries of a CRS pattern by column. The entry in row r and
+// column c is indexed if rowKeep is empty or rowKeep(r) is set, and colKeep
+// is empty or colKeep(c) is set. CountTag counts the entries of each column
+// into cursor; FillTag, given the column offsets in cursor, writes their
+// rows and positions.
+template <typename rowmap_t, typename entries_t, typename keep_t,
+          typename colmap_t, typename colrows_t, typename colpos_t>
+struct SpgemmColumnIndexFunctor {
+  struct CountTag {};
+  struct FillTag {};
+  using size_type = typename colmap_t::non_const_value_type;
+
+  rowmap_t rowmap;
+  entries_t entries;
+  keep_t rowKeep;
+  keep_t colKeep;
+  colmap_t cursor;
+  colrows_t colrows;
+  colpos_t colpos;
+
+  KOKKOS_INLINE_FUNCTION bool keep(const int64_t r, const int64_t c) const {
+    return (!rowKeep.extent(0) || rowKeep(r)) &&
+           (!colKeep.extent(0) || colKeep(c));
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const CountTag&,
+                                         const int64_t r) const {
+    for (auto e = rowmap(r); e < rowmap(r + 1); e++) {
+      const auto c = entries(e);
+      if (keep(r, c)) Kokkos::atomic_add(&cursor(c), size_type(1));
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const FillTag&,
+                                         const int64_t r) const {
+    for (auto e = rowmap(r); e < rowmap(r + 1); e++) {
+      const auto c = entries(e);
+      if (!keep(r, c)) continue;
+      const size_type p = Kokkos::atomic_fetch_add(&cursor(c), size_type(1));
+      colrows(p)        = typename colrows_t::non_const_value_type(r);
+      colpos(p)         = e;
+    }
+  }
+};
+
+template <typename exec_space, typename rowmap_t, typename entries_t,
+          typename keep_t, typename colmap_t, typename colrows_t,
+          typename colpos_t>
+void spgemm_transpose_column_index(const exec_space& exec,
+                                   const int64_t numRows,
+                                   const int64_t numCols,
+                                   const rowmap_t& rowmap,
+                                   const entries_t& entries,
+                                   const keep_t& rowKeep, const keep_t& colKeep,
+                                   colmap_t& colmap, colrows_t& colrows,
+                                   colpos_t& colpos) {
+  using size_type = typename colmap_t::non_const_value_type;
+  using functor_t = SpgemmColumnIndexFunctor<rowmap_t, entries_t, keep_t,
+                                             colmap_t, colrows_t, colpos_t>;
+  using count_pol =
+      Kokkos::RangePolicy<exec_space, typename functor_t::CountTag, int64_t>;
+  using fill_pol =
+      Kokkos::RangePolicy<exec_space, typename functor_t::FillTag, int64_t>;
+
+  colmap = colmap_t("column map", numCols + 1);
+  functor_t f{rowmap, entries, rowKeep, colKeep, colmap, colrows, colpos};
+  Kokkos::parallel_for("KokkosSparse::spgemm_transpose::column_count",
+                       count_pol(exec, 0, numRows), f);
+  size_type nnz = 0;
+  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum(exec, numCols + 1,
+                                                        colmap, nnz);
+  f.cursor = colmap_t(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "column cursor"),
+      numCols + 1);
+  Kokkos::deep_copy(exec, f.cursor, colmap);
+  colrows = colrows_t(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "column rows"), nnz);
+  colpos = colpos_t(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "column positions"),
+      nnz);
+  f.colrows = colrows;
+  f.colpos  = colpos;
+  Kokkos::parallel_for("KokkosSparse::spgemm_transpose::column_fill",
+                       fill_pol(exec, 0, numRows), f);
+}
+
+// The rows of C, taken one at a time by each slot through nextRow. CountTag
+// writes the length of each row to rowmap(i); FillTag, given the final
+// rowmap, writes the unsorted row.
+template <bool transA, typename AMatrix, typename BMatrix, typename colmap_t,
+          typename colrows_t, typename colpos_t, typename rowmap_t,
+          typename entries_t, typename values_t, typename work_t,
+          typename counter_t>
+struct SpgemmTransposeRowFunctor {
+  struct CountTag {};
+  struct FillTag {};
+  using size_type = typename rowmap_t::non_const_value_type;
+  using lno_t     = typename entries_t::non_const_value_type;
+  using scalar_t  = typename values_t::non_const_value_type;
+
+  AMatrix A;
+  BMatrix B;
+  // Column index of A (transA) or of B
+  colmap_t colmap;
+  colrows_t colrows;
+  colpos_t colpos;
+  rowmap_t rowmap;
+  entries_t entries;
+  values_t values;
+  // Per slot and column of C: the row of C that last counted the column
+  // (CountTag), then a hint of its offset in the current row (FillTag)
+  work_t mark;
+  counter_t nextRow;
+  int64_t numRows;
+
+  // Entries [lBegin(i), lEnd(i)) of row i of L, in row lRow and with value
+  // lVal; entries [rBegin(k), rEnd(k)) of row k of R, in column rCol and
+  // with value rVal
+  KOKKOS_INLINE_FUNCTION size_type lBegin(const int64_t i) const {
+    if constexpr (transA) return colmap(i);
+    else return A.graph.row_map(i);
+  }
+  KOKKOS_INLINE_FUNCTION size_type lEnd(const int64_t i) const {
+    if constexpr (transA) return colmap(i + 1);
+    else return A.graph.row_map(i + 1);
+  }
+  KOKKOS_INLINE_FUNCTION int64_t lRow(const size_type p) const {
+    if constexpr (transA) return colrows(p);
+    else return A.graph.entries(p);
+  }
+  KOKKOS_INLINE_FUNCTION scalar_t lVal(const size_type p) const {
+    if constexpr (transA) return A.values(colpos(p));
+    else return A.values(p);
+  }
+  KOKKOS_INLINE_FUNCTION size_type rBegin(const int64_t k) const {
+    if constexpr (transA) return B.graph.row_map(k);
+    else return colmap(k);
+  }
+  KOKKOS_INLINE_FUNCTION size_type rEnd(const int64_t k) const {
+    if constexpr (transA) return B.graph.row_map(k + 1);
+    else return colmap(k + 1);
+  }
+  KOKKOS_INLINE_FUNCTION lno_t rCol(const size_type q) const {
+    if constexpr (transA) return B.graph.entries(q);
+    else return colrows(q);
+  }
+  KOKKOS_INLINE_FUNCTION scalar_t rVal(const size_type q) const {
+    if constexpr (transA) return B.values(q);
+    else return B.values(colpos(q));
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const CountTag&,
+                                         const int64_t slot) const {
+    for (int64_t i = Kokkos::atomic_fetch_add(&nextRow(), int64_t(1));
+         i < numRows;
+         i = Kokkos::atomic_fetch_add(&nextRow(), int64_t(1))) {
+      size_type len = 0;
+      for (size_type p = lBegin(i); p < lEnd(i); p++) {
+        const int64_t k = lRow(p);
+        for (size_type q = rBegin(k); q < rEnd(k); q++) {
+          const lno_t j = rCol(q);
+          if (mark(slot, j) != lno_t(i)) {
+            mark(slot, j) = i;
+            len++;
+          }
+        }
+      }
+      rowmap(i) = len;
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const FillTag&,
+                                         const int64_t slot) const {
+    for (int64_t i = Kokkos::atomic_fetch_add(&nextRow(), int64_t(1));
+         i < numRows;
+         i = Kokkos::atomic_fetch_add(&nextRow(), int64_t(1))) {
+      const size_type beg = rowmap(i);
+      lno_t len           = 0;
+      for (size_type p = lBegin(i); p < lEnd(i); p++) {
+        const int64_t k      = lRow(p);
+        const scalar_t valL = lVal(p);
+        for (size_type q = rBegin(k); q < rEnd(k); q++) {
+          const lno_t j     = rCol(q);
+          const scalar_t v  = valL * rVal(q);
+          const lno_t off   = mark(slot, j);
+          // The hint may be left over from another row: it holds only if
+          // it points to column j among the entries written so far
+          if (off >= 0 && off < len && entries(beg + off) == j) {
+            values(beg + off) += v;
+          } else {
+            mark(slot, j)       = len;
+            entries(beg + len)  = j;
+            values(beg + len++) = v;
+          }
+        }
+      }
+    }
+  }
+};
+
+// Symbolic pass, allocation of the entries and values of C (returned in
+// functor), then numeric pass
+template <typename exec_space, typename functor_t>
+void spgemm_transpose_rows(const exec_space& exec, const size_t nslots,
+                           functor_t& functor) {
+  using size_type = typename functor_t::size_type;
+  using rowmap_t  = decltype(functor.rowmap);
+  using entries_t = decltype(functor.entries);
+  using values_t  = decltype(functor.values);
+  using count_pol =
+      Kokkos::RangePolicy<exec_space, typename functor_t::CountTag, int64_t>;
+  using fill_pol =
+      Kokkos::RangePolicy<exec_space, typename functor_t::FillTag, int64_t>;
+
+  const int64_t numRows = functor.numRows;
+  rowmap_t rowmap       = functor.rowmap;
+  Kokkos::deep_copy(exec, functor.nextRow, int64_t(0));
+  Kokkos::parallel_for("KokkosSparse::spgemm_transpose::symbolic",
+                       count_pol(exec, 0, nslots), functor);
+  int64_t nnz = 0;
+  Kokkos::parallel_reduce(
+      "KokkosSparse::spgemm_transpose::nnz",
+      Kokkos::RangePolicy<exec_space, int64_t>(exec, 0, numRows),
+      KOKKOS_LAMBDA(const int64_t i, int64_t& lnnz) { lnnz += rowmap(i); },
+      nnz);
+  spgemm_transpose_check_nnz<size_type>(nnz);
+  size_type nnzC = 0;
+  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum(exec, numRows + 1,
+                                                        rowmap, nnzC);
+  functor.entries = entries_t(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "C entries"), nnzC);
+  functor.values = values_t(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "C values"), nnzC);
+  Kokkos::deep_copy(exec, functor.nextRow, int64_t(0));
+  Kokkos::parallel_for("KokkosSparse::spgemm_transpose::numeric",
+                       fill_pol(exec, 0, nslots), functor);
+}
+
+/// C = A^T B (transA) or C = A B^T (transB), sorted and without duplicate
+/// entries. The caller checks that exactly one of transA and transB is set
+/// and that the dimensions of op(A) and op(B) match.
+template <typename CMatrix, typename AMatrix, typename BMatrix>
+CMatrix spgemm_transpose(const AMatrix& A, const bool transA, const BMatrix& B,
+                         const bool transB) {
+  using exec_space = typename CMatrix::execution_space;
+  using mem_space  = typename CMatrix::memory_space;
+  using size_type  = typename CMatrix::non_const_size_type;
+  using lno_t      = typename CMatrix::non_const_ordinal_type;
+  using rowmap_t   = typename CMatrix::row_map_type::non_const_type;
+  using entries_t  = typename CMatrix::index_type::non_const_type;
+  using values_t   = typename CMatrix::values_type::non_const_type;
+  using keep_t     = Kokkos::View<char*, mem_space>;
+  using colmap_t   = Kokkos::View<size_type*, mem_space>;
+  using colrows_t  = Kokkos::View<lno_t*, mem_space>;
+  using colpos_t   = Kokkos::View<size_type*, mem_space>;
+  using work_t     = Kokkos::View<lno_t**, Kokkos::LayoutRight, mem_space>;
+  using counter_t  = Kokkos::View<int64_t, mem_space>;
+
+  exec_space exec;
+  const lno_t numRowsC = transA ? A.numCols() : A.numRows();
+  const lno_t numColsC = transB ? B.numRows() : B.numCols();
+
+  // Column index of the transposed operand, restricted to the entries that
+  // meet an entry of the other one
+  colmap_t colmap;
+  colrows_t colrows;
+  colpos_t colpos;
+  if (transA) {
+    keep_t rowKeep(Kokkos::view_alloc(Kokkos::WithoutInitializing, "rows"),
+                   A.numRows());
+    Kokkos::parallel_for(
+        "KokkosSparse::spgemm_transpose::keep",
+        Kokkos::RangePolicy<exec_space, int64_t>(exec, 0, A.numRows()),
+        KOKKOS_LAMBDA(const int64_t k) {
+          rowKeep(k) = B.graph.row_map(k + 1) > B.graph.row_map(k);
+        });
+    spgemm_transpose_column_index(exec, A.numRows(), A.numCols(),
+                                  A.graph.row_map, A.graph.entries, rowKeep,
+                                  keep_t(), colmap, colrows, colpos);
+  } else {
+    keep_t colKeep("columns", B.numCols());
+    Kokkos::parallel_for(
+        "KokkosSparse::spgemm_transpose::keep",
+        Kokkos::RangePolicy<exec_space, int64_t>(exec, 0, A.nnz()),
+        KOKKOS_LAMBDA(const int64_t a) { colKeep(A.graph.entries(a)) = 1; });
+    spgemm_transpose_column_index(exec, B.numRows(), B.numCols(),
+                                  B.graph.row_map, B.graph.entries, keep_t(),
+                                  colKeep, colmap, colrows, colpos);
+  }
+
+  // Slots, each with a dense array of the columns of C
+  const size_t numCols1  = std::max(size_t(numColsC), size_t(1));
+  const size_t slotBytes = sizeof(lno_t) * numCols1;
+  size_t nslots =
+      std::max(size_t(1), spgemm_transpose_workspace_bytes / slotBytes);
+  nslots = std::min(nslots, size_t(exec.concurrency()));
+  nslots = std::min(nslots, std::max(size_t(numRowsC), size_t(1)));
+  work_t mark(Kokkos::view_alloc(Kokkos::WithoutInitializing, "spgemm mark"),
+              nslots, numColsC);
+  Kokkos::deep_copy(exec, mark, lno_t(-1));
+  counter_t nextRow("spgemm next row");
+
+  rowmap_t rowmapC("C rowmap", numRowsC + 1);
+  entries_t entriesC;
+  values_t valuesC;
+  if (transA) {
+    using functor_t =
+        SpgemmTransposeRowFunctor<true, AMatrix, BMatrix, colmap_t, colrows_t,
+                                  colpos_t, rowmap_t, entries_t, values_t,
+                                  work_t, counter_t>;
+    functor_t f{A,           B,          colmap, colrows, colpos,  rowmapC,
+                entries_t(), values_t(), mark,   nextRow, numRowsC};
+    spgemm_transpose_rows(exec, nslots, f);
+    entriesC = f.entries;
+    valuesC  = f.values;
+  } else {
+    using functor_t =
+        SpgemmTransposeRowFunctor<false, AMatrix, BMatrix, colmap_t, colrows_t,
+                                  colpos_t, rowmap_t, entries_t, values_t,
+                                  work_t, counter_t>;
+    functor_t f{A,           B,          colmap, colrows, colpos,  rowmapC,
+                entries_t(), values_t(), mark,   nextRow, numRowsC};
+    spgemm_transpose_rows(exec, nslots, f);
+    entriesC = f.entries;
+    valuesC  = f.values;
+  }
+  KokkosSparse::sort_crs_matrix(exec, rowmapC, entriesC, valuesC);
+  return CMatrix("C", numRowsC, numColsC, entriesC.extent(0), valuesC,
+                 rowmapC, entriesC);
+}
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPGEMM_TRANSPOSE_IMPL_HPP_
@@ -560,11 +560,13 @@ struct IlukWrap {
                             tpolicy, "parfor_tp1", level_idx, iw,
                             lev_start + lvl_rowid_start, TPF, TPB,
                             block_enabled, block_size);
-          Kokkos::fence();
+          // No fence: the levels run in order on the default instance
           lvl_rowid_start += lvl_nrows_chunk;
         }
       }  // end if
     }    // end for lvl
+    // Only the default instance, not the instances of other factorizations
+    execution_space().fence();
 
 // Output check
 #ifdef NUMERIC_OUTPUT_INFO
@@ -154,12 +154,16 @@ struct SPILUK_NUMERIC<ExecutionSpace, KernelHandle, ARowMapType, AEntriesType,
       const AValuesType &A_values, LRowMapType &L_row_map,
       LEntriesType &L_entries, LValuesType &L_values, URowMapType &U_row_map,
       UEntriesType &U_entries, UValuesType &U_values) {
+    Kokkos::Profiling::pushRegion(KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+                                      ? "KokkosSparse::spiluk_numeric[ETI]"
+                                      : "KokkosSparse::spiluk_numeric[noETI]");
     // Call specific algorithm type
     auto spiluk_handle = handle->get_spiluk_handle();
 
     Iluk::iluk_numeric(*spiluk_handle, A_row_map, A_entries, A_values,
                        L_row_map, L_entries, L_values, U_row_map, U_entries,
                        U_values);
+    Kokkos::Profiling::popRegion();
   }
 
   static void spiluk_numeric_streams(
@@ -174,6 +178,10 @@ struct SPILUK_NUMERIC<ExecutionSpace, KernelHandle, ARowMapType, AEntriesType,
       const std::vector<URowMapType> &U_row_map_v,
       const std::vector<UEntriesType> &U_entries_v,
       std::vector<UValuesType> &U_values_v) {
+    Kokkos::Profiling::pushRegion(
+        KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+            ? "KokkosSparse::spiluk_numeric_streams[ETI]"
+            : "KokkosSparse::spiluk_numeric_streams[noETI]");
     std::vector<typename KernelHandle::SPILUKHandleType *> spiluk_handle_v(
         execspace_v.size());
     for (int i = 0; i < static_cast<int>(execspace_v.size()); i++) {
@@ -184,6 +192,7 @@ struct SPILUK_NUMERIC<ExecutionSpace, KernelHandle, ARowMapType, AEntriesType,
                                A_entries_v, A_values_v, L_row_map_v,
                                L_entries_v, L_values_v, U_row_map_v,
                                U_entries_v, U_values_v);
+    Kokkos::Profiling::popRegion();
   }
 };
 
@@ -25,6 +25,7 @@
 #include <KokkosSparse_spiluk_handle.hpp>
 #include <KokkosSparse_SortCrs.hpp>
 #include <KokkosKernels_Error.hpp>
+#include <KokkosKernels_SimpleUtils.hpp>
 
 //#define SYMBOLIC_OUTPUT_INFO
 
@@ -91,54 +92,16 @@ void level_sched(IlukHandle& thandle, const RowMapType row_map,
   thandle.set_level_maxrows(maxrows);
 }
 
-// SEQLVLSCHD_TP1 algorithm (chunks)
-template <class IlukHandle, class RowMapType, class EntriesType,
-          class LevelType1, class LevelType2, class LevelType3, class size_type>
-void level_sched_tp(IlukHandle& thandle, const RowMapType row_map,
-                    const EntriesType entries, LevelType1& level_list,
-                    LevelType2& level_ptr, LevelType3& level_idx,
-                    size_type& nlevels, int nstreams = 1) {
-  // Scheduling currently compute on host
-
+// SEQLVLSCHD_TP1 chunks of the levels, given the host level_ptr: on CUDA the
+// rows of a level are split so the iw workspace of a chunk fits in memory
+template <class IlukHandle, class LevelType2, class size_type>
+void level_sched_tp_chunks(IlukHandle& thandle, const LevelType2& level_ptr,
+                           const size_type nlevels, int nstreams = 1) {
   using nnz_lno_t           = typename IlukHandle::nnz_lno_t;
   using nnz_lno_view_host_t = typename IlukHandle::nnz_lno_view_host_t;
 
   size_type nrows = thandle.get_nrows();
 
-  nlevels      = 0;
-  level_ptr(0) = 0;
-
-  for (size_type i = 0; i < nrows; ++i) {
-    size_type l        = 0;
-    size_type rowstart = row_map(i);
-    size_type rowend   = row_map(i + 1);
-    for (size_type j = rowstart; j < rowend; ++j) {
-      nnz_lno_t col = entries(j);
-      l             = std::max(l, level_list(col));
-    }
-    level_list(i) = l + 1;
-    level_ptr(l + 1) += 1;
-    nlevels = std::max(nlevels, l + 1);
-  }
-
-  for (size_type i = 1; i <= nlevels; ++i) {
-    level_ptr(i) += level_ptr(i - 1);
-  }
-
-  for (size_type i = 0; i < nrows; i++) {
-    level_idx(level_ptr(level_list(i) - 1)) = i;
-    level_ptr(level_list(i) - 1) += 1;
-  }
-
-  if (nlevels > 0) {  // note: to avoid wrapping around to the max of size_t
-                      // when nlevels = 0.
-    for (size_type i = nlevels - 1; i > 0; --i) {
-      level_ptr(i) = level_ptr(i - 1);
-    }
-  }
-
-  level_ptr(0) = 0;
-
   // Find max rows, number of chunks, max rows of chunks across levels
   thandle.alloc_level_nchunks(nlevels);
   thandle.alloc_level_nrowsperchunk(nlevels);
@@ -189,6 +152,56 @@ void level_sched_tp(IlukHandle& thandle, const RowMapType row_map,
   thandle.set_level_maxrowsperchunk(maxrowsperchunk);
 }
 
+// SEQLVLSCHD_TP1 algorithm (chunks)
+template <class IlukHandle, class RowMapType, class EntriesType,
+          class LevelType1, class LevelType2, class LevelType3, class size_type>
+void level_sched_tp(IlukHandle& thandle, const RowMapType row_map,
+                    const EntriesType entries, LevelType1& level_list,
+                    LevelType2& level_ptr, LevelType3& level_idx,
+                    size_type& nlevels, int nstreams = 1) {
+  // Scheduling currently compute on host
+
+  using nnz_lno_t = typename IlukHandle::nnz_lno_t;
+
+  size_type nrows = thandle.get_nrows();
+
+  nlevels      = 0;
+  level_ptr(0) = 0;
+
+  for (size_type i = 0; i < nrows; ++i) {
+    size_type l        = 0;
+    size_type rowstart = row_map(i);
+    size_type rowend   = row_map(i + 1);
+    for (size_type j = rowstart; j < rowend; ++j) {
+      nnz_lno_t col = entries(j);
+      l             = std::max(l, level_list(col));
+    }
+    level_list(i) = l + 1;
+    level_ptr(l + 1) += 1;
+    nlevels = std::max(nlevels, l + 1);
+  }
+
+  for (size_type i = 1; i <= nlevels; ++i) {
+    level_ptr(i) += level_ptr(i - 1);
+  }
+
+  for (size_type i = 0; i < nrows; i++) {
+    level_idx(level_ptr(level_list(i) - 1)) = i;
+    level_ptr(level_list(i) - 1) += 1;
+  }
+
+  if (nlevels > 0) {  // note: to avoid wrapping around to the max of size_t
+                      // when nlevels = 0.
+    for (size_type i = nlevels - 1; i > 0; --i) {
+      level_ptr(i) = level_ptr(i - 1);
+    }
+  }
+
+  level_ptr(0) = 0;
+
+  level_sched_tp_chunks(thandle, level_ptr, nlevels, nstreams);
+}
+
 // Linear Search for the smallest row index
 template <class size_type, class nnz_lno_t, class ViewType>
 size_type search_col_index(nnz_lno_t j, size_type lenl, ViewType h_iL,
@@ -219,6 +232,332 @@ size_type search_col_index(nnz_lno_t j, size_type lenl, ViewType h_iL,
   return ((size_type)irow);
 }
 
+// Workspace budget of the device symbolic phase, which bounds the number of
+// rows searched at once
+constexpr size_t iluk_symbolic_device_workspace_bytes = size_t(1) << 28;
+
+// Fill pattern of row i of ILU(k) from the graph of A alone, one thread per
+// row (Hysom and Pothen): (i, w) has level l if the shortest path
+// i -> h_1 -> ... -> h_l -> w in A whose interior vertices are all smaller
+// than min(i, w) has l of them. The paths are searched by length, keeping
+// for each vertex h < i the smallest maximum interior vertex of the paths
+// that reach it. A longer path to h is only extended if its maximum is
+// smaller than that of every shorter path to h. CountTag writes the lengths
+// of the rows of L and U (with the diagonal) to L_row_map(i) and
+// U_row_map(i); FillTag, given the final row maps, writes the unsorted
+// entries.
+template <class ARowMapType, class AEntriesType, class LRowMapType,
+          class LEntriesType, class URowMapType, class UEntriesType,
+          class WorkViewType>
+struct IlukSymbolicRowFunctor {
+  using nnz_lno_t = typename AEntriesType::non_const_value_type;
+  using size_type = typename LRowMapType::non_const_value_type;
+
+  struct CountTag {};
+  struct FillTag {};
+
+  nnz_lno_t nrows;
+  nnz_lno_t fill_lev;
+  nnz_lno_t first_row;  // of the batch, row first_row + s uses slot s
+  ARowMapType A_row_map;
+  AEntriesType A_entries;
+  LRowMapType L_row_map;
+  LEntriesType L_entries;
+  URowMapType U_row_map;
+  UEntriesType U_entries;
+  // Per slot: the level of each found column (-1 if not found) and the found
+  // columns
+  WorkViewType lev;
+  WorkViewType found;
+  // Per slot: the smallest maximum interior vertex of the paths extended
+  // from each vertex so far, valid if best_row is the current row; the
+  // smallest maximum of the paths of the next length (nrows if none); the
+  // vertices extended at the current length and reached at the next one
+  WorkViewType best;
+  WorkViewType best_row;
+  WorkViewType next_max;
+  WorkViewType frontier;
+  WorkViewType next_frontier;
+
+  // Finds the off-diagonal columns of row i of L and U into found(slot, :)
+  // and returns their number
+  KOKKOS_INLINE_FUNCTION nnz_lno_t search_row(const nnz_lno_t slot,
+                                              const nnz_lno_t i) const {
+    nnz_lno_t nfound = 0;
+    nnz_lno_t ncur   = 0;
+    for (size_type k = A_row_map(i); k < A_row_map(i + 1); ++k) {
+      const nnz_lno_t w = A_entries(k);
+      if (w < nrows && w != i && lev(slot, w) == -1) {
+        lev(slot, w)          = 0;
+        found(slot, nfound++) = w;
+        if (w < i) {
+          best(slot, w)          = -1;
+          best_row(slot, w)      = i;
+          frontier(slot, ncur++) = w;
+        }
+      }
+    }
+    for (nnz_lno_t l = 1; l <= fill_lev && ncur > 0; ++l) {
+      // Extend the paths with l - 1 interior vertices by one edge
+      nnz_lno_t nnext = 0;
+      for (nnz_lno_t q = 0; q < ncur; ++q) {
+        const nnz_lno_t h = frontier(slot, q);
+        const nnz_lno_t m = best(slot, h) > h ? best(slot, h) : h;
+        for (size_type k = A_row_map(h); k < A_row_map(h + 1); ++k) {
+          const nnz_lno_t w = A_entries(k);
+          if (w >= nrows || w == i) continue;
+          if (m < w && lev(slot, w) == -1) {
+            lev(slot, w)          = l;
+            found(slot, nfound++) = w;
+          }
+          if (l < fill_lev && w < i && m < next_max(slot, w)) {
+            if (next_max(slot, w) == nrows) next_frontier(slot, nnext++) = w;
+            next_max(slot, w) = m;
+          }
+        }
+      }
+      // Keep the paths that lower the maximum of the shorter ones
+      ncur = 0;
+      for (nnz_lno_t q = 0; q < nnext; ++q) {
+        const nnz_lno_t h = next_frontier(slot, q);
+        const nnz_lno_t m = next_max(slot, h);
+        next_max(slot, h) = nrows;
+        if (best_row(slot, h) != i || m < best(slot, h)) {
+          best(slot, h)          = m;
+          best_row(slot, h)      = i;
+          frontier(slot, ncur++) = h;
+        }
+      }
+    }
+    return nfound;
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const CountTag&,
+                                         const nnz_lno_t slot) const {
+    const nnz_lno_t i      = first_row + slot;
+    const nnz_lno_t nfound = search_row(slot, i);
+    nnz_lno_t lenl         = 0;
+    for (nnz_lno_t q = 0; q < nfound; ++q) {
+      const nnz_lno_t w = found(slot, q);
+      if (w < i) lenl++;
+      lev(slot, w) = -1;
+    }
+    L_row_map(i) = lenl + 1;
+    U_row_map(i) = nfound - lenl + 1;
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const FillTag&,
+                                         const nnz_lno_t slot) const {
+    const nnz_lno_t i      = first_row + slot;
+    const nnz_lno_t nfound = search_row(slot, i);
+    size_type posL         = L_row_map(i);
+    size_type posU         = U_row_map(i);
+    U_entries(posU++)      = i;
+    for (nnz_lno_t q = 0; q < nfound; ++q) {
+      const nnz_lno_t w = found(slot, q);
+      if (w < i) {
+        L_entries(posL++) = w;
+      } else {
+        U_entries(posU++) = w;
+      }
+      lev(slot, w) = -1;
+    }
+    L_entries(posL) = i;
+  }
+};
+
+// Level of each row of L, 1 + the largest level of the rows it depends on,
+// by relaxation from 0: levels only grow towards their final values, so
+// reading levels that other threads are updating is safe. Counts the rows
+// whose level changed.
+template <class LRowMapType, class LEntriesType, class LevelListType>
+struct IlukLevelRelaxFunctor {
+  using nnz_lno_t = typename LEntriesType::non_const_value_type;
+  using size_type = typename LRowMapType::non_const_value_type;
+  using level_t   = typename LevelListType::non_const_value_type;
+
+  LRowMapType L_row_map;
+  LEntriesType L_entries;
+  LevelListType level_list;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const nnz_lno_t i,
+                                         nnz_lno_t& changed) const {
+    level_t l = 0;
+    for (size_type k = L_row_map(i); k < L_row_map(i + 1); ++k) {
+      const nnz_lno_t j = L_entries(k);
+      if (j < i) {
+        const level_t lj = Kokkos::atomic_load(&level_list(j));
+        if (lj > l) l = lj;
+      }
+    }
+    if (Kokkos::atomic_load(&level_list(i)) != l + 1) {
+      Kokkos::atomic_store(&level_list(i), l + 1);
+      changed++;
+    }
+  }
+};
+
+// SEQLVLSCHD_TP1_DEVICE_SYMBOLIC: the symbolic phase of SEQLVLSCHD_TP1 on the
+// device. A count pass and a fill pass search the rows of the fill pattern
+// in parallel, in batches that fit the workspace, then the level sets of L
+// are found by relaxation and a counting sort. Only level_ptr (one entry per
+// level) is copied to the host, for the chunks of the numeric phase.
+template <class IlukHandle, class ARowMapType, class AEntriesType,
+          class LRowMapType, class LEntriesType, class URowMapType,
+          class UEntriesType>
+void iluk_symbolic_device(IlukHandle& thandle,
+                          const typename IlukHandle::const_nnz_lno_t& fill_lev,
+                          const ARowMapType& A_row_map,
+                          const AEntriesType& A_entries,
+                          LRowMapType& L_row_map, LEntriesType& L_entries,
+                          URowMapType& U_row_map, UEntriesType& U_entries,
+                          int nstreams = 1) {
+  using execution_space = typename IlukHandle::execution_space;
+  using memory_space    = typename IlukHandle::memory_space;
+  using size_type       = typename IlukHandle::size_type;
+  using nnz_lno_t       = typename IlukHandle::nnz_lno_t;
+  using work_view_t =
+      Kokkos::View<nnz_lno_t**, Kokkos::LayoutRight, memory_space>;
+  using row_functor_t =
+      IlukSymbolicRowFunctor<ARowMapType, AEntriesType, LRowMapType,
+                             LEntriesType, URowMapType, UEntriesType,
+                             work_view_t>;
+  using count_policy_t =
+      Kokkos::RangePolicy<execution_space, typename row_functor_t::CountTag>;
+  using fill_policy_t =
+      Kokkos::RangePolicy<execution_space, typename row_functor_t::FillTag>;
+  using range_policy_t = Kokkos::RangePolicy<execution_space>;
+
+  execution_space space;
+  const nnz_lno_t nrows = thandle.get_nrows();
+  const size_t nrows1   = std::max(nrows, nnz_lno_t(1));
+
+  // Rows searched at once, each with seven dense arrays of nrows
+  const size_t slot_bytes = 7 * sizeof(nnz_lno_t) * nrows1;
+  size_t nslots = std::max(size_t(1),
+                           iluk_symbolic_device_workspace_bytes / slot_bytes);
+  nslots        = std::min(nslots, size_t(space.concurrency()));
+  nslots        = std::min(nslots, nrows1);
+
+  auto work = [&](const char* label) {
+    return work_view_t(Kokkos::view_alloc(Kokkos::WithoutInitializing, label),
+                       nslots, nrows);
+  };
+  work_view_t lev           = work("iluk lev");
+  work_view_t found         = work("iluk found");
+  work_view_t best          = work("iluk best");
+  work_view_t best_row      = work("iluk best_row");
+  work_view_t next_max      = work("iluk next_max");
+  work_view_t frontier      = work("iluk frontier");
+  work_view_t next_frontier = work("iluk next_frontier");
+  Kokkos::deep_copy(space, lev, nnz_lno_t(-1));
+  Kokkos::deep_copy(space, best_row, nnz_lno_t(-1));
+  Kokkos::deep_copy(space, next_max, nrows);
+
+  row_functor_t functor{nrows,     fill_lev,  0,         A_row_map,
+                        A_entries, L_row_map, L_entries, U_row_map,
+                        U_entries, lev,       found,     best,
+                        best_row,  next_max,  frontier,  next_frontier};
+
+  // Count pass, then the row maps
+  Kokkos::deep_copy(space, L_row_map, size_type(0));
+  Kokkos::deep_copy(space, U_row_map, size_type(0));
+  for (nnz_lno_t first = 0; first < nrows; first += nnz_lno_t(nslots)) {
+    functor.first_row = first;
+    const nnz_lno_t n = std::min(nnz_lno_t(nslots), nrows - first);
+    Kokkos::parallel_for("KokkosSparse::spiluk_symbolic_device::count",
+                         count_policy_t(space, 0, n), functor);
+  }
+  size_type cntL = 0, cntU = 0;
+  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum(space, nrows + 1,
+                                                        L_row_map, cntL);
+  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum(space, nrows + 1,
+                                                        U_row_map, cntU);
+  if (cntU > static_cast<size_type>(U_entries.extent(0))) {
+    std::ostringstream os;
+    os << "KokkosSparse::Experimental::spiluk_symbolic: U_entries's extent "
+          "must be larger than "
+       << U_entries.extent(0) << ", must be at least " << cntU;
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+  if (cntL > static_cast<size_type>(L_entries.extent(0))) {
+    std::ostringstream os;
+    os << "KokkosSparse::Experimental::spiluk_symbolic: L_entries's extent "
+          "must be larger than "
+       << L_entries.extent(0) << ", must be at least " << cntL;
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  // Fill pass
+  for (nnz_lno_t first = 0; first < nrows; first += nnz_lno_t(nslots)) {
+    functor.first_row = first;
+    const nnz_lno_t n = std::min(nnz_lno_t(nslots), nrows - first);
+    Kokkos::parallel_for("KokkosSparse::spiluk_symbolic_device::fill",
+                         fill_policy_t(space, 0, n), functor);
+  }
+  thandle.set_nnzL(cntL);
+  thandle.set_nnzU(cntU);
+  KokkosSparse::sort_crs_graph(space, L_row_map, L_entries);
+  KokkosSparse::sort_crs_graph(space, U_row_map, U_entries);
+
+  // Levels of the rows of L
+  auto level_list = thandle.get_level_list();
+  auto level_ptr  = thandle.get_level_ptr();
+  auto level_idx  = thandle.get_level_idx();
+  using level_functor_t =
+      IlukLevelRelaxFunctor<LRowMapType, LEntriesType, decltype(level_list)>;
+  Kokkos::deep_copy(space, level_list, size_type(0));
+  for (nnz_lno_t changed = 1; changed;) {
+    changed = 0;
+    Kokkos::parallel_reduce(
+        "KokkosSparse::spiluk_symbolic_device::levels",
+        range_policy_t(space, 0, nrows),
+        level_functor_t{L_row_map, L_entries, level_list}, changed);
+  }
+  size_type nlevels = 0;
+  Kokkos::parallel_reduce(
+      "KokkosSparse::spiluk_symbolic_device::num_levels",
+      range_policy_t(space, 0, nrows),
+      KOKKOS_LAMBDA(const nnz_lno_t i, size_type& lmax) {
+        if (level_list(i) > lmax) lmax = level_list(i);
+      },
+      Kokkos::Max<size_type>(nlevels));
+
+  // Rows grouped by level: level_ptr(l) is the first row of level l (from 0)
+  Kokkos::deep_copy(space, level_ptr, nnz_lno_t(0));
+  Kokkos::parallel_for(
+      "KokkosSparse::spiluk_symbolic_device::level_count",
+      range_policy_t(space, 0, nrows), KOKKOS_LAMBDA(const nnz_lno_t i) {
+        Kokkos::atomic_inc(&level_ptr(level_list(i)));
+      });
+  const auto lvl_range = Kokkos::make_pair(size_type(0), nlevels + 1);
+  auto level_ptr_used  = Kokkos::subview(level_ptr, lvl_range);
+  KokkosKernels::Impl::kk_inclusive_parallel_prefix_sum(space, nlevels + 1,
+                                                        level_ptr_used);
+  typename IlukHandle::nnz_lno_view_t cursor(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "iluk level cursor"),
+      nlevels);
+  Kokkos::deep_copy(space, cursor,
+                    Kokkos::subview(level_ptr, Kokkos::make_pair(
+                                                   size_type(0), nlevels)));
+  Kokkos::parallel_for(
+      "KokkosSparse::spiluk_symbolic_device::level_idx",
+      range_policy_t(space, 0, nrows), KOKKOS_LAMBDA(const nnz_lno_t i) {
+        level_idx(Kokkos::atomic_fetch_add(&cursor(level_list(i) - 1),
+                                           nnz_lno_t(1))) = i;
+      });
+  KokkosSparse::sort_crs_graph(space, level_ptr_used, level_idx);
+
+  auto hlevel_ptr = thandle.get_host_level_ptr();
+  Kokkos::deep_copy(space, Kokkos::subview(hlevel_ptr, lvl_range),
+                    level_ptr_used);
+  space.fence();
+
+  level_sched_tp_chunks(thandle, hlevel_ptr, nlevels, nstreams);
+  thandle.alloc_iw(thandle.get_level_maxrowsperchunk(), nrows);
+  thandle.set_symbolic_complete();
+}
+
 template <class IlukHandle, class ARowMapType, class AEntriesType,
           class LRowMapType, class LEntriesType, class URowMapType,
           class UEntriesType>
@@ -228,6 +567,13 @@ void iluk_symbolic(IlukHandle& thandle,
                    const AEntriesType& A_entries_d, LRowMapType& L_row_map_d,
                    LEntriesType& L_entries_d, URowMapType& U_row_map_d,
                    UEntriesType& U_entries_d, int nstreams = 1) {
+  if (thandle.get_algorithm() == KokkosSparse::Experimental::SPILUKAlgorithm::
+                                     SEQLVLSCHD_TP1_DEVICE_SYMBOLIC) {
+    iluk_symbolic_device(thandle, fill_lev, A_row_map_d, A_entries_d,
+                         L_row_map_d, L_entries_d, U_row_map_d, U_entries_d,
+                         nstreams);
+    return;
+  }
   if (thandle.get_algorithm() ==
       KokkosSparse::Experimental::SPILUKAlgorithm::SEQLVLSCHD_TP1)
   /*   || thandle.get_algorithm() ==
@@ -118,12 +118,16 @@ struct SPILUK_SYMBOLIC<KernelHandle, ARowMapType, AEntriesType, LRowMapType,
       const ARowMapType &A_row_map, const AEntriesType &A_entries,
       LRowMapType &L_row_map, LEntriesType &L_entries, URowMapType &U_row_map,
       UEntriesType &U_entries, int nstreams = 1) {
+    Kokkos::Profiling::pushRegion(KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+                                      ? "KokkosSparse::spiluk_symbolic[ETI]"
+                                      : "KokkosSparse::spiluk_symbolic[noETI]");
     auto spiluk_handle = handle->get_spiluk_handle();
 
     Experimental::iluk_symbolic(*spiluk_handle, fill_lev, A_row_map, A_entries,
                                 L_row_map, L_entries, U_row_map, U_entries,
                                 nstreams);
     spiluk_handle->set_symbolic_complete();
+    Kokkos::Profiling::popRegion();
   }
 };
 #endif
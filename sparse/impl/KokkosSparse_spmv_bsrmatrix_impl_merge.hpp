@@ -0,0 +1,177 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_SPMV_BSRMATRIX_IMPL_MERGE_HPP
+#define KOKKOSSPARSE_SPMV_BSRMATRIX_IMPL_MERGE_HPP
+
+#include <sstream>
+
+#include "KokkosKernels_Iota.hpp"
+#include "KokkosKernels_ExecSpaceUtils.hpp"
+#include "KokkosBlas1_scal.hpp"
+
+#include "KokkosSparse_merge_matrix.hpp"
+
+namespace KokkosSparse::Impl {
+
+/*! \brief Merge-based SpMV for BsrMatrix
+
+  The merge path of the block row ends and the nonzero blocks has length
+  A.numRows() + A.nnz(). It is split into equal chunks, one per thread, so
+  each thread does the same amount of work no matter how uneven the block
+  rows are. Each thread finds its start and end on the path with a diagonal
+  search.
+
+  A block row that is entirely inside one thread's chunk is updated without
+  atomics. Only the first and last block rows of a chunk may be shared with
+  other threads, and are accumulated atomically.
+*/
+template <class ExecutionSpace, class AMatrix, class XVector, class YVector>
+struct BsrSpmvMergePath {
+  using exec_space     = ExecutionSpace;
+  using y_value_type   = typename YVector::non_const_value_type;
+  using A_value_type   = typename AMatrix::non_const_value_type;
+  using A_ordinal_type = typename AMatrix::non_const_ordinal_type;
+  using A_size_type    = typename AMatrix::non_const_size_type;
+
+  using um_row_map_type =
+      Kokkos::View<typename AMatrix::row_map_type::data_type,
+                   typename AMatrix::row_map_type::device_type::memory_space,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+  using iota_type = KokkosKernels::Impl::Iota<A_size_type, A_size_type>;
+
+  using DSR = typename KokkosSparse::Impl::MergeMatrixDiagonal<
+      um_row_map_type, iota_type>::position_type;
+
+  using KAT = Kokkos::ArithTraits<A_value_type>;
+
+  template <bool CONJ>
+  struct BsrSpmvMergeFunctor {
+    BsrSpmvMergeFunctor(const y_value_type& _alpha, const AMatrix& _A,
+                        const XVector& _x, const YVector& _y,
+                        const A_size_type pathLengthThreadChunk)
+        : alpha(_alpha),
+          A(_A),
+          x(_x),
+          y(_y),
+          pathLengthThreadChunk_(pathLengthThreadChunk) {}
+
+    y_value_type alpha;
+    AMatrix A;
+    XVector x;
+    YVector y;
+    A_size_type pathLengthThreadChunk_;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const A_size_type chunk) const {
+      const A_size_type pathLength = A.numRows() + A.nnz();
+      const A_size_type d          = chunk * pathLengthThreadChunk_;
+      const A_size_type dEnd =
+          KOKKOSKERNELS_MACRO_MIN(d + pathLengthThreadChunk_, pathLength);
+
+      // iota(i) -> i
+      iota_type iota(A.nnz());
+
+      // remove leading 0 from row_map
+      um_row_map_type rowEnds(&A.graph.row_map(1), A.graph.row_map.size() - 1);
+
+      const DSR lb = diagonal_search(rowEnds, iota, d);
+      const DSR ub = diagonal_search(rowEnds, iota, dEnd);
+
+      const A_ordinal_type blockDim = A.blockDim();
+      const A_size_type blockSize   = A_size_type(blockDim) * blockDim;
+
+      A_ordinal_type curRow = lb.ai;
+      A_size_type curNnz    = lb.bi;
+      for (A_size_type i = d; i < dEnd && curRow < A.numRows(); ++i) {
+        if (curNnz < rowEnds(curRow)) {
+          // the first and last block rows may be shared with other threads
+          const bool shared = (curRow == lb.ai || curRow == ub.ai);
+          const A_value_type* block = &A.values(curNnz * blockSize);
+          const A_ordinal_type xBeg = A.graph.entries(curNnz) * blockDim;
+          const A_ordinal_type yBeg = curRow * blockDim;
+          for (A_ordinal_type ii = 0; ii < blockDim; ++ii) {
+            y_value_type acc = 0;
+            for (A_ordinal_type jj = 0; jj < blockDim; ++jj) {
+              const A_value_type aij = block[ii * blockDim + jj];
+              const A_value_type val = CONJ ? KAT::conj(aij) : aij;
+              acc += static_cast<y_value_type>(val) * x(xBeg + jj);
+            }
+            if (shared) {
+              Kokkos::atomic_add(&y(yBeg + ii), alpha * acc);
+            } else {
+              y(yBeg + ii) += alpha * acc;
+            }
+          }
+          ++curNnz;
+        } else {
+          ++curRow;
+        }
+      }
+    }
+  };  // struct BsrSpmvMergeFunctor
+
+  static void spmv(const ExecutionSpace& space, const char mode[],
+                   const y_value_type& alpha, const AMatrix& A,
+                   const XVector& x, const y_value_type& beta,
+                   const YVector& y) {
+    static_assert(XVector::rank == 1, "");
+    static_assert(YVector::rank == 1, "");
+
+    // if y contains NaN but beta = 0, the result y should be filled with 0
+    if (beta == Kokkos::ArithTraits<y_value_type>::zero())
+      Kokkos::deep_copy(space, y, Kokkos::ArithTraits<y_value_type>::zero());
+    else if (beta != Kokkos::ArithTraits<y_value_type>::one())
+      KokkosBlas::scal(space, y, beta, y);
+
+    /* determine launch parameters for different architectures
+       On GPUs, each thread handles a few steps of the path; each nonzero block
+       is already blockDim^2 multiply-adds.
+       On other architectures, have each thread do the maximal amount of work
+       to amortize the cost of the diagonal search
+    */
+    const A_size_type pathLength = A.numRows() + A.nnz();
+    if (pathLength == 0) return;
+    A_size_type pathLengthThreadChunk;
+    if constexpr (KokkosKernels::Impl::kk_is_gpu_exec_space<ExecutionSpace>()) {
+      pathLengthThreadChunk = 4;
+    } else {
+      pathLengthThreadChunk =
+          (pathLength + space.concurrency() - 1) / space.concurrency();
+    }
+    const A_size_type numChunks =
+        (pathLength + pathLengthThreadChunk - 1) / pathLengthThreadChunk;
+
+    Kokkos::RangePolicy<exec_space> policy(space, 0, numChunks);
+
+    if (KokkosSparse::NoTranspose[0] == mode[0]) {
+      BsrSpmvMergeFunctor<false> op(alpha, A, x, y, pathLengthThreadChunk);
+      Kokkos::parallel_for("BsrSpmvMergePath::spmv", policy, op);
+    } else if (KokkosSparse::Conjugate[0] == mode[0]) {
+      BsrSpmvMergeFunctor<true> op(alpha, A, x, y, pathLengthThreadChunk);
+      Kokkos::parallel_for("BsrSpmvMergePath::spmv", policy, op);
+    } else {
+      std::stringstream ss;
+      ss << __FILE__ << ":" << __LINE__
+         << "BsrSpmvMergePath::spmv() called with unsupported mode " << mode;
+      throw std::logic_error(ss.str());
+    }
+  }
+};
+
+}  // namespace KokkosSparse::Impl
+
+#endif  // KOKKOSSPARSE_SPMV_BSRMATRIX_IMPL_MERGE_HPP
@@ -26,6 +26,8 @@
 #if !defined(KOKKOSKERNELS_ETI_ONLY) || KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
 #include <KokkosSparse_spmv_bsrmatrix_impl.hpp>
 #include "KokkosSparse_spmv_bsrmatrix_impl_v42.hpp"
+#include "KokkosSparse_spmv_bsrmatrix_impl_merge.hpp"
+#include "KokkosSparse_spmv_mv_tiled_impl.hpp"
 #endif
 
 namespace KokkosSparse {
@@ -155,6 +157,15 @@ struct SPMV_BSRMATRIX<ExecutionSpace, Handle, AMatrix, XVector, YVector, false,
     const bool modeIsConjugateTrans = (mode[0] == ConjugateTranspose[0]);
     const bool modeIsTrans          = (mode[0] == Transpose[0]);
 
+    // use merge path if requested (transposed modes fall back to V41)
+    if (handle->algo == SPMV_MERGE_PATH) {
+      if (modeIsNoTrans || modeIsConjugate) {
+        BsrSpmvMergePath<ExecutionSpace, AMatrix, XVector, YVector>::spmv(
+            space, mode, alpha, A, X, beta, Y);
+        return;
+      }
+    }
+
     // use V41 if requested
     if (handle->algo == SPMV_BSR_V41) {
       if (modeIsNoTrans || modeIsConjugate) {
@@ -298,6 +309,31 @@ struct SPMV_MV_BSRMATRIX<ExecutionSpace, Handle, AMatrix, XVector, YVector,
     const bool modeIsConjugateTrans = (mode[0] == ConjugateTranspose[0]);
     const bool modeIsTrans          = (mode[0] == Transpose[0]);
 
+    // use the column-tiled kernel if requested (transposed modes fall back
+    // to V41)
+    if (handle->algo == SPMV_MV_TILED) {
+      if (modeIsNoTrans || modeIsConjugate) {
+        SpmvMvTiled<ExecutionSpace, AMatrix, XVector, YVector>::spmv(
+            space, mode, alpha, A, X, beta, Y);
+        return;
+      }
+    }
+
+    // use merge path if requested, one column at a time (transposed modes
+    // fall back to V41)
+    if (handle->algo == SPMV_MERGE_PATH) {
+      if (modeIsNoTrans || modeIsConjugate) {
+        for (size_t j = 0; j < X.extent(1); ++j) {
+          auto x_j = Kokkos::subview(X, Kokkos::ALL(), j);
+          auto y_j = Kokkos::subview(Y, Kokkos::ALL(), j);
+          BsrSpmvMergePath<ExecutionSpace, AMatrix, decltype(x_j),
+                           decltype(y_j)>::spmv(space, mode, alpha, A, x_j,
+                                                beta, y_j);
+        }
+        return;
+      }
+    }
+
     // use V41 if requested
     if (handle->algo == SPMV_BSR_V41) {
       if (modeIsNoTrans || modeIsConjugate) {
@@ -0,0 +1,203 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_SPMV_CCS_IMPL_HPP_
+#define KOKKOSSPARSE_SPMV_CCS_IMPL_HPP_
+
+#include <sstream>
+
+#include "Kokkos_ArithTraits.hpp"
+#include "KokkosBlas1_scal.hpp"
+#include "KokkosKernels_Error.hpp"
+#include "KokkosSparse_CcsMatrix.hpp"
+#include "KokkosSparse_spmv_impl.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+
+/// y := beta * y + alpha * op(A) * x for a CcsMatrix, op(A) = A^T or A^H.
+/// Column j of A is row j of op(A), so this is the row-parallel gather of the
+/// CRS kernel: each thread of a team owns one column and its vector lanes
+/// reduce over the entries of that column.
+template <class ExecutionSpace, class AMatrix, class XVector, class YVector,
+          bool conjugate>
+struct CcsSpmvGatherFunctor {
+  using ordinal_type = typename AMatrix::non_const_ordinal_type;
+  using size_type    = typename AMatrix::non_const_size_type;
+  using value_type   = typename AMatrix::non_const_value_type;
+  using y_value_type = typename YVector::non_const_value_type;
+  using ATV          = Kokkos::ArithTraits<value_type>;
+  using team_member  = typename Kokkos::TeamPolicy<ExecutionSpace>::member_type;
+
+  y_value_type alpha;
+  AMatrix A;
+  XVector x;
+  y_value_type beta;
+  YVector y;
+  // Index of the column of x/y (0 for single vectors)
+  int col;
+  int64_t cols_per_team;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const team_member& t) const {
+    const int64_t first = static_cast<int64_t>(t.league_rank()) * cols_per_team;
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(t, cols_per_team), [&](int64_t c) {
+          const int64_t j = first + c;
+          if (j >= static_cast<int64_t>(A.numCols())) return;
+          const size_type kbegin = A.graph.col_map(j);
+          const size_type kend   = A.graph.col_map(j + 1);
+          y_value_type sum       = Kokkos::ArithTraits<y_value_type>::zero();
+          Kokkos::parallel_reduce(
+              Kokkos::ThreadVectorRange(t, kbegin, kend),
+              [&](size_type k, y_value_type& lsum) {
+                const value_type val =
+                    conjugate ? ATV::conj(A.values(k)) : A.values(k);
+                const ordinal_type i = A.graph.entries(k);
+                if constexpr (XVector::rank == 1)
+                  lsum += static_cast<y_value_type>(val) * x(i);
+                else
+                  lsum += static_cast<y_value_type>(val) * x(i, col);
+              },
+              sum);
+          Kokkos::single(Kokkos::PerThread(t), [&]() {
+            y_value_type* yp;
+            if constexpr (YVector::rank == 1)
+              yp = &y(j);
+            else
+              yp = &y(j, col);
+            if (beta == Kokkos::ArithTraits<y_value_type>::zero())
+              *yp = alpha * sum;
+            else
+              *yp = beta * *yp + alpha * sum;
+          });
+        });
+  }
+};
+
+/// y := y + alpha * op(A) * x for a CcsMatrix, op(A) = A or conj(A). Same
+/// decomposition as CcsSpmvGatherFunctor, but each column scatters
+/// alpha * x(j) times its entries into y with atomics (y must have been
+/// scaled by beta already).
+template <class ExecutionSpace, class AMatrix, class XVector, class YVector,
+          bool conjugate>
+struct CcsSpmvScatterFunctor {
+  using ordinal_type = typename AMatrix::non_const_ordinal_type;
+  using size_type    = typename AMatrix::non_const_size_type;
+  using value_type   = typename AMatrix::non_const_value_type;
+  using y_value_type = typename YVector::non_const_value_type;
+  using ATV          = Kokkos::ArithTraits<value_type>;
+  using team_member  = typename Kokkos::TeamPolicy<ExecutionSpace>::member_type;
+
+  y_value_type alpha;
+  AMatrix A;
+  XVector x;
+  YVector y;
+  int col;
+  int64_t cols_per_team;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const team_member& t) const {
+    const int64_t first = static_cast<int64_t>(t.league_rank()) * cols_per_team;
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(t, cols_per_team), [&](int64_t c) {
+          const int64_t j = first + c;
+          if (j >= static_cast<int64_t>(A.numCols())) return;
+          y_value_type xval;
+          if constexpr (XVector::rank == 1)
+            xval = alpha * x(j);
+          else
+            xval = alpha * x(j, col);
+          const size_type kbegin = A.graph.col_map(j);
+          const size_type kend   = A.graph.col_map(j + 1);
+          Kokkos::parallel_for(
+              Kokkos::ThreadVectorRange(t, kbegin, kend), [&](size_type k) {
+                const value_type val =
+                    conjugate ? ATV::conj(A.values(k)) : A.values(k);
+                const ordinal_type i = A.graph.entries(k);
+                if constexpr (YVector::rank == 1)
+                  Kokkos::atomic_add(&y(i),
+                                     static_cast<y_value_type>(val) * xval);
+                else
+                  Kokkos::atomic_add(&y(i, col),
+                                     static_cast<y_value_type>(val) * xval);
+              });
+        });
+  }
+};
+
+/// Native SpMV for CcsMatrix, for single vectors and multivectors (which are
+/// applied one column at a time). The transposed modes gather, the others
+/// scatter; both use the CRS launch parameters with the columns of A in the
+/// place of rows.
+template <class ExecutionSpace, class AMatrix, class XVector, class YVector>
+void spmv_ccs(const ExecutionSpace& space, const char mode[],
+              typename YVector::const_value_type& alpha, const AMatrix& A,
+              const XVector& x, typename YVector::const_value_type& beta,
+              const YVector& y) {
+  using policy_type = Kokkos::TeamPolicy<ExecutionSpace>;
+  const bool transpose =
+      mode[0] == KokkosSparse::Transpose[0] ||
+      mode[0] == KokkosSparse::ConjugateTranspose[0];
+  const bool conjugate =
+      mode[0] == KokkosSparse::Conjugate[0] ||
+      mode[0] == KokkosSparse::ConjugateTranspose[0];
+  if (!transpose && !conjugate && mode[0] != KokkosSparse::NoTranspose[0]) {
+    std::stringstream ss;
+    ss << __FILE__ << ":" << __LINE__ << " Invalid transpose mode " << mode
+       << " for KokkosSparse::spmv() with a CcsMatrix";
+    KokkosKernels::Impl::throw_runtime_exception(ss.str());
+  }
+  int numVecs = 1;
+  if constexpr (XVector::rank == 2) numVecs = x.extent(1);
+  if (!transpose) {
+    // The scatter functor adds into y, so scale it first
+    KokkosBlas::scal(space, y, beta, y);
+  }
+  int team_size = -1, vector_length = -1;
+  const int64_t cols_per_team = spmv_launch_parameters<ExecutionSpace>(
+      A.numCols(), A.nnz(), -1, team_size, vector_length);
+  const int64_t worksets = (A.numCols() + cols_per_team - 1) / cols_per_team;
+  const policy_type policy(space, worksets, team_size, vector_length);
+  for (int col = 0; col < numVecs; col++) {
+    if (transpose) {
+      if (conjugate)
+        Kokkos::parallel_for("KokkosSparse::spmv<Ccs,Transpose>", policy,
+                             CcsSpmvGatherFunctor<ExecutionSpace, AMatrix,
+                                                  XVector, YVector, true>{
+                                 alpha, A, x, beta, y, col, cols_per_team});
+      else
+        Kokkos::parallel_for("KokkosSparse::spmv<Ccs,Transpose>", policy,
+                             CcsSpmvGatherFunctor<ExecutionSpace, AMatrix,
+                                                  XVector, YVector, false>{
+                                 alpha, A, x, beta, y, col, cols_per_team});
+    } else {
+      if (conjugate)
+        Kokkos::parallel_for("KokkosSparse::spmv<Ccs,NoTranspose>", policy,
+                             CcsSpmvScatterFunctor<ExecutionSpace, AMatrix,
+                                                   XVector, YVector, true>{
+                                 alpha, A, x, y, col, cols_per_team});
+      else
+        Kokkos::parallel_for("KokkosSparse::spmv<Ccs,NoTranspose>", policy,
+                             CcsSpmvScatterFunctor<ExecutionSpace, AMatrix,
+                                                   XVector, YVector, false>{
+                                 alpha, A, x, y, col, cols_per_team});
+    }
+  }
+}
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPMV_CCS_IMPL_HPP_
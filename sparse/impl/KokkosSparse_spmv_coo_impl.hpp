@@ -0,0 +1,123 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef KOKKOSSPARSE_SPMV_COO_IMPL_HPP
+#define KOKKOSSPARSE_SPMV_COO_IMPL_HPP
+
+#include <type_traits>
+#include "Kokkos_Core.hpp"
+#include "Kokkos_ArithTraits.hpp"
+#include "KokkosKernels_ExecSpaceUtils.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+
+// y(out(k)) += alpha * op(val(k)) * x(in(k)) over all COO tuples k, as a
+// segmented reduction: each thread walks a contiguous chunk of tuples and
+// accumulates runs of equal out(k) in a register, flushing each run to y with
+// one atomic add. For tuples grouped by out index (e.g. sorted by row for the
+// non-transposed product), the only contended atomics are at chunk ends.
+// Tuples with a negative index are skipped, as in coo2crs.
+template <class OutView, class InView, class ValView, class XVector,
+          class YVector, bool conjugate>
+struct SpmvCooFunctor {
+  using ordinal_type = typename OutView::non_const_value_type;
+  using y_value_type = typename YVector::non_const_value_type;
+  using a_value_type = typename ValView::non_const_value_type;
+  using size_type    = std::size_t;
+
+  SpmvCooFunctor(const y_value_type& alpha_, const OutView& out_,
+                 const InView& in_, const ValView& vals_, const XVector& x_,
+                 const YVector& y_, size_type chunkSize_)
+      : alpha(alpha_),
+        out(out_),
+        in(in_),
+        vals(vals_),
+        x(x_),
+        y(y_),
+        chunkSize(chunkSize_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const size_type chunk) const {
+    const size_type begin = chunk * chunkSize;
+    size_type end         = begin + chunkSize;
+    if (end > vals.extent(0)) end = vals.extent(0);
+    bool haveRun     = false;
+    ordinal_type cur = 0;
+    y_value_type sum = Kokkos::ArithTraits<y_value_type>::zero();
+    for (size_type k = begin; k < end; k++) {
+      const ordinal_type i = out(k);
+      const auto j         = in(k);
+      if constexpr (std::is_signed_v<ordinal_type>) {
+        if (i < 0 || j < 0) continue;
+      }
+      if (!haveRun || i != cur) {
+        if (haveRun) Kokkos::atomic_add(&y(cur), alpha * sum);
+        haveRun = true;
+        cur     = i;
+        sum     = Kokkos::ArithTraits<y_value_type>::zero();
+      }
+      a_value_type a = vals(k);
+      if constexpr (conjugate) a = Kokkos::ArithTraits<a_value_type>::conj(a);
+      sum += a * x(j);
+    }
+    if (haveRun) Kokkos::atomic_add(&y(cur), alpha * sum);
+  }
+
+  y_value_type alpha;
+  OutView out;
+  InView in;
+  ValView vals;
+  XVector x;
+  YVector y;
+  size_type chunkSize;
+};
+
+// Chunking: on GPUs a few tuples per thread, so that there are enough threads
+// and neighbouring threads read neighbouring tuples. On the host, a few
+// chunks per thread for load balance, of at least minHostChunk tuples.
+template <class ExecSpace>
+std::size_t spmv_coo_chunk_size(const ExecSpace& exec, std::size_t n) {
+  constexpr std::size_t gpuChunk     = 16;
+  constexpr std::size_t minHostChunk = 4096;
+  if constexpr (KokkosKernels::Impl::kk_is_gpu_exec_space<ExecSpace>()) {
+    return gpuChunk;
+  } else {
+    const std::size_t numChunks = 4 * exec.concurrency();
+    const std::size_t chunk     = (n + numChunks - 1) / numChunks;
+    return chunk < minHostChunk ? minHostChunk : chunk;
+  }
+}
+
+template <bool conjugate, class ExecSpace, class OutView, class InView,
+          class ValView, class XVector, class YVector>
+void spmv_coo_apply(const ExecSpace& exec,
+                    const typename YVector::non_const_value_type& alpha,
+                    const OutView& out, const InView& in, const ValView& vals,
+                    const XVector& x, const YVector& y) {
+  const std::size_t n = vals.extent(0);
+  if (n == 0) return;
+  const std::size_t chunkSize = spmv_coo_chunk_size(exec, n);
+  const std::size_t numChunks = (n + chunkSize - 1) / chunkSize;
+  Kokkos::parallel_for(
+      "KokkosSparse::spmv_coo",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, numChunks),
+      SpmvCooFunctor<OutView, InView, ValView, XVector, YVector, conjugate>(
+          alpha, out, in, vals, x, y, chunkSize));
+}
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPMV_COO_IMPL_HPP
@@ -0,0 +1,189 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_SPMV_DELTA_IMPL_HPP_
+#define KOKKOSSPARSE_SPMV_DELTA_IMPL_HPP_
+
+#include <sstream>
+
+#include "Kokkos_ArithTraits.hpp"
+#include "KokkosBlas1_scal.hpp"
+#include "KokkosKernels_Error.hpp"
+#include "KokkosSparse_DeltaCrsMatrix.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+namespace Impl {
+
+/// Call f(k, column) for each entry k of row i of a DeltaCrsMatrix, decoding
+/// the deltas (or reading the full column indices of a wide row).
+template <class AMatrix, class F>
+KOKKOS_INLINE_FUNCTION void delta_crs_for_each_entry(
+    const AMatrix& A, const typename AMatrix::non_const_ordinal_type i,
+    const F& f) {
+  using ordinal_type = typename AMatrix::non_const_ordinal_type;
+  using size_type    = typename AMatrix::non_const_size_type;
+
+  const size_type start   = A.row_map(i);
+  const size_type end     = A.row_map(i + 1);
+  const ordinal_type base = A.row_base(i);
+  if (base >= 0) {
+    ordinal_type c = base;
+    for (size_type k = start; k < end; k++) {
+      c += A.deltas(k);
+      f(k, c);
+    }
+  } else {
+    const size_type wstart = A.wide_row_map(-1 - base);
+    for (size_type k = start; k < end; k++) {
+      f(k, A.wide_entries(wstart + (k - start)));
+    }
+  }
+}
+
+/// y := beta * y + alpha * op(A) * x for a DeltaCrsMatrix, op(A) = A or
+/// conj(A). One thread per row.
+template <class AMatrix, class XVector, class YVector, bool conjugate>
+struct DeltaCrsSpmvFunctor {
+  using ordinal_type = typename AMatrix::non_const_ordinal_type;
+  using size_type    = typename AMatrix::non_const_size_type;
+  using value_type   = typename AMatrix::non_const_value_type;
+  using y_value_type = typename YVector::non_const_value_type;
+  using ATV          = Kokkos::ArithTraits<value_type>;
+
+  y_value_type alpha;
+  AMatrix A;
+  XVector x;
+  y_value_type beta;
+  YVector y;
+  // Index of the column of x/y (0 for single vectors)
+  int col;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type i) const {
+    y_value_type sum = Kokkos::ArithTraits<y_value_type>::zero();
+    delta_crs_for_each_entry(A, i, [&](size_type k, ordinal_type c) {
+      const value_type val = conjugate ? ATV::conj(A.values(k)) : A.values(k);
+      if constexpr (XVector::rank == 1)
+        sum += static_cast<y_value_type>(val) * x(c);
+      else
+        sum += static_cast<y_value_type>(val) * x(c, col);
+    });
+    y_value_type* yp;
+    if constexpr (YVector::rank == 1)
+      yp = &y(i);
+    else
+      yp = &y(i, col);
+    if (beta == Kokkos::ArithTraits<y_value_type>::zero())
+      *yp = alpha * sum;
+    else
+      *yp = beta * *yp + alpha * sum;
+  }
+};
+
+/// y := y + alpha * op(A) * x for a DeltaCrsMatrix, op(A) = A^T or A^H. One
+/// thread per row, scattering into y with atomics (y must have been scaled by
+/// beta already).
+template <class AMatrix, class XVector, class YVector, bool conjugate>
+struct DeltaCrsSpmvTransposeFunctor {
+  using ordinal_type = typename AMatrix::non_const_ordinal_type;
+  using size_type    = typename AMatrix::non_const_size_type;
+  using value_type   = typename AMatrix::non_const_value_type;
+  using y_value_type = typename YVector::non_const_value_type;
+  using ATV          = Kokkos::ArithTraits<value_type>;
+
+  y_value_type alpha;
+  AMatrix A;
+  XVector x;
+  YVector y;
+  int col;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type i) const {
+    y_value_type xval;
+    if constexpr (XVector::rank == 1)
+      xval = alpha * x(i);
+    else
+      xval = alpha * x(i, col);
+    delta_crs_for_each_entry(A, i, [&](size_type k, ordinal_type c) {
+      const value_type val = conjugate ? ATV::conj(A.values(k)) : A.values(k);
+      if constexpr (YVector::rank == 1)
+        Kokkos::atomic_add(&y(c), static_cast<y_value_type>(val * xval));
+      else
+        Kokkos::atomic_add(&y(c, col), static_cast<y_value_type>(val * xval));
+    });
+  }
+};
+
+/// Native SpMV for DeltaCrsMatrix, for single vectors and multivectors (which
+/// are applied one column at a time).
+template <class ExecutionSpace, class AMatrix, class XVector, class YVector>
+void spmv_delta_crs(const ExecutionSpace& space, const char mode[],
+                    typename YVector::const_value_type& alpha,
+                    const AMatrix& A, const XVector& x,
+                    typename YVector::const_value_type& beta,
+                    const YVector& y) {
+  using ordinal_type = typename AMatrix::non_const_ordinal_type;
+  using policy_type  = Kokkos::RangePolicy<ExecutionSpace>;
+  const bool transpose =
+      mode[0] == KokkosSparse::Transpose[0] ||
+      mode[0] == KokkosSparse::ConjugateTranspose[0];
+  const bool conjugate =
+      mode[0] == KokkosSparse::Conjugate[0] ||
+      mode[0] == KokkosSparse::ConjugateTranspose[0];
+  if (!transpose && !conjugate && mode[0] != KokkosSparse::NoTranspose[0]) {
+    std::stringstream ss;
+    ss << __FILE__ << ":" << __LINE__ << " Invalid transpose mode " << mode
+       << " for KokkosSparse::spmv() with a DeltaCrsMatrix";
+    KokkosKernels::Impl::throw_runtime_exception(ss.str());
+  }
+  int numVecs = 1;
+  if constexpr (XVector::rank == 2) numVecs = x.extent(1);
+  if (transpose) {
+    // The transpose functor adds into y, so scale it first
+    KokkosBlas::scal(space, y, beta, y);
+  }
+  const policy_type policy(space, 0, ordinal_type(A.numRows()));
+  for (int col = 0; col < numVecs; col++) {
+    if (transpose) {
+      if (conjugate)
+        Kokkos::parallel_for(
+            "KokkosSparse::spmv<DeltaCrs,Transpose>", policy,
+            DeltaCrsSpmvTransposeFunctor<AMatrix, XVector, YVector, true>{
+                alpha, A, x, y, col});
+      else
+        Kokkos::parallel_for(
+            "KokkosSparse::spmv<DeltaCrs,Transpose>", policy,
+            DeltaCrsSpmvTransposeFunctor<AMatrix, XVector, YVector, false>{
+                alpha, A, x, y, col});
+    } else {
+      if (conjugate)
+        Kokkos::parallel_for(
+            "KokkosSparse::spmv<DeltaCrs,NoTranspose>", policy,
+            DeltaCrsSpmvFunctor<AMatrix, XVector, YVector, true>{
+                alpha, A, x, beta, y, col});
+      else
+        Kokkos::parallel_for(
+            "KokkosSparse::spmv<DeltaCrs,NoTranspose>", policy,
+            DeltaCrsSpmvFunctor<AMatrix, XVector, YVector, false>{
+                alpha, A, x, beta, y, col});
+    }
+  }
+}
+
+}  // namespace Impl
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPMV_DELTA_IMPL_HPP_
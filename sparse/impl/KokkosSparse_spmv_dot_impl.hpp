@@ -0,0 +1,200 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_SPMV_DOT_IMPL_HPP_
+#define KOKKOSSPARSE_SPMV_DOT_IMPL_HPP_
+
+#include "Kokkos_InnerProductSpaceTraits.hpp"
+#include "KokkosKernels_ExecSpaceUtils.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_spmv_impl.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+
+/// y := beta * y + alpha * A * x, also reducing dot(y, z) over the rows of
+/// the new y. This is SPMV_Functor, with each row's final value of y
+/// multiplied by z(iRow) while it is still in a register.
+template <class execution_space, class AMatrix, class XVector, class YVector,
+          class ZVector>
+struct SPMV_Dot_Functor {
+  typedef typename AMatrix::non_const_ordinal_type ordinal_type;
+  typedef typename AMatrix::non_const_value_type value_type;
+  typedef typename YVector::non_const_value_type y_value_type;
+  typedef typename Kokkos::TeamPolicy<execution_space> team_policy;
+  typedef typename team_policy::member_type team_member;
+  typedef Kokkos::Details::InnerProductSpaceTraits<y_value_type> IPT;
+  typedef typename IPT::dot_type dot_type;
+
+  const y_value_type alpha;
+  AMatrix m_A;
+  XVector m_x;
+  const y_value_type beta;
+  YVector m_y;
+  ZVector m_z;
+
+  const ordinal_type rows_per_team;
+
+  SPMV_Dot_Functor(const y_value_type alpha_, const AMatrix m_A_,
+                   const XVector m_x_, const y_value_type beta_,
+                   const YVector m_y_, const ZVector m_z_,
+                   const int rows_per_team_)
+      : alpha(alpha_),
+        m_A(m_A_),
+        m_x(m_x_),
+        beta(beta_),
+        m_y(m_y_),
+        m_z(m_z_),
+        rows_per_team(rows_per_team_) {}
+
+  // Compute the new value of y(iRow) from the row sum, store it and return
+  // its contribution to dot(y, z)
+  KOKKOS_INLINE_FUNCTION
+  dot_type finish_row(const ordinal_type iRow, y_value_type sum) const {
+    sum *= alpha;
+    if (beta != Kokkos::ArithTraits<y_value_type>::zero())
+      sum += beta * m_y(iRow);
+    m_y(iRow) = sum;
+    return IPT::dot(sum, m_z(iRow));
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const ordinal_type iRow, dot_type& update) const {
+    const KokkosSparse::SparseRowViewConst<AMatrix> row = m_A.rowConst(iRow);
+    const ordinal_type row_length = static_cast<ordinal_type>(row.length);
+    y_value_type sum              = 0;
+
+    for (ordinal_type iEntry = 0; iEntry < row_length; iEntry++) {
+      sum += static_cast<y_value_type>(row.value(iEntry)) *
+             m_x(row.colidx(iEntry));
+    }
+    update += finish_row(iRow, sum);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const team_member& dev, dot_type& update) const {
+    dot_type team_sum = Kokkos::ArithTraits<dot_type>::zero();
+    Kokkos::parallel_reduce(
+        Kokkos::TeamThreadRange(dev, 0, rows_per_team),
+        [&](const ordinal_type& loop, dot_type& tsum) {
+          const ordinal_type iRow =
+              static_cast<ordinal_type>(dev.league_rank()) * rows_per_team +
+              loop;
+          if (iRow >= m_A.numRows()) {
+            return;
+          }
+          const KokkosSparse::SparseRowViewConst<AMatrix> row =
+              m_A.rowConst(iRow);
+          const ordinal_type row_length = static_cast<ordinal_type>(row.length);
+          y_value_type sum              = 0;
+
+          Kokkos::parallel_reduce(
+              Kokkos::ThreadVectorRange(dev, row_length),
+              [&](const ordinal_type& iEntry, y_value_type& lsum) {
+                lsum += static_cast<y_value_type>(row.value(iEntry)) *
+                        m_x(row.colidx(iEntry));
+              },
+              sum);
+
+          // Every vector lane must add the same contribution to tsum
+          dot_type contrib;
+          Kokkos::single(
+              Kokkos::PerThread(dev),
+              [&](dot_type& c) { c = finish_row(iRow, sum); }, contrib);
+          tsum += contrib;
+        },
+        team_sum);
+    Kokkos::single(Kokkos::PerTeam(dev), [&]() { update += team_sum; });
+  }
+};
+
+/// Native fused y := beta * y + alpha * A * x; return dot(y, z), for a
+/// CrsMatrix and rank-1 x, y and z. Uses the same launch parameters and
+/// schedule heuristics as the native no-transpose SpMV.
+template <class execution_space, class Handle, class AMatrix, class XVector,
+          class YVector, class ZVector>
+typename Kokkos::Details::InnerProductSpaceTraits<
+    typename YVector::non_const_value_type>::dot_type
+spmv_dot_native(const execution_space& exec, Handle* handle,
+                typename YVector::const_value_type& alpha, const AMatrix& A,
+                const XVector& x, typename YVector::const_value_type& beta,
+                const YVector& y, const ZVector& z) {
+  using functor_type =
+      SPMV_Dot_Functor<execution_space, AMatrix, XVector, YVector, ZVector>;
+  using dot_type = typename functor_type::dot_type;
+
+  dot_type result = Kokkos::ArithTraits<dot_type>::zero();
+  if (A.numRows() <= 0) return result;
+
+  bool use_dynamic_schedule =
+      (A.nnz() > 10000000 || handle->force_dynamic_schedule) &&
+      !handle->force_static_schedule;
+
+  if constexpr (KokkosKernels::Impl::kk_is_gpu_exec_space<execution_space>()) {
+    int team_size           = handle->team_size;
+    int vector_length       = handle->vector_length;
+    int64_t rows_per_thread = handle->rows_per_thread;
+
+    int64_t rows_per_team = spmv_launch_parameters<execution_space>(
+        A.numRows(), A.nnz(), rows_per_thread, team_size, vector_length);
+    int64_t worksets = (y.extent(0) + rows_per_team - 1) / rows_per_team;
+
+    functor_type func(alpha, A, x, beta, y, z, rows_per_team);
+    if (use_dynamic_schedule) {
+      using policy_type = Kokkos::TeamPolicy<execution_space,
+                                             Kokkos::Schedule<Kokkos::Dynamic>>;
+      policy_type policy(1, 1);
+      if (team_size < 0)
+        policy = policy_type(exec, worksets, Kokkos::AUTO, vector_length);
+      else
+        policy = policy_type(exec, worksets, team_size, vector_length);
+      Kokkos::parallel_reduce("KokkosSparse::spmv_dot<Dynamic>", policy, func,
+                              result);
+    } else {
+      using policy_type =
+          Kokkos::TeamPolicy<execution_space, Kokkos::Schedule<Kokkos::Static>>;
+      policy_type policy(1, 1);
+      if (team_size < 0)
+        policy = policy_type(exec, worksets, Kokkos::AUTO, vector_length);
+      else
+        policy = policy_type(exec, worksets, team_size, vector_length);
+      Kokkos::parallel_reduce("KokkosSparse::spmv_dot<Static>", policy, func,
+                              result);
+    }
+  } else {
+    functor_type func(alpha, A, x, beta, y, z, 1);
+    if (use_dynamic_schedule)
+      Kokkos::parallel_reduce(
+          "KokkosSparse::spmv_dot<Dynamic>",
+          Kokkos::RangePolicy<execution_space,
+                              Kokkos::Schedule<Kokkos::Dynamic>>(
+              exec, 0, A.numRows()),
+          func, result);
+    else
+      Kokkos::parallel_reduce(
+          "KokkosSparse::spmv_dot<Static>",
+          Kokkos::RangePolicy<execution_space,
+                              Kokkos::Schedule<Kokkos::Static>>(exec, 0,
+                                                                A.numRows()),
+          func, result);
+  }
+  return result;
+}
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPMV_DOT_IMPL_HPP_
@@ -0,0 +1,126 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_SPMV_ENSEMBLE_IMPL_HPP_
+#define KOKKOSSPARSE_SPMV_ENSEMBLE_IMPL_HPP_
+
+#include <sstream>
+
+#include "Kokkos_ArithTraits.hpp"
+#include "KokkosKernels_Error.hpp"
+#include "KokkosKernels_ExecSpaceUtils.hpp"
+#include "KokkosSparse_EnsembleCrsMatrix.hpp"
+#include "KokkosSparse_spmv_impl.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+namespace Impl {
+
+/// y(i, s) := beta * y(i, s) + alpha * (op(A_s) * x(:, s))(i) for all samples
+/// s of an EnsembleCrsMatrix, op = identity or conj. Each thread of a team
+/// owns a row and its vector lanes own the samples, so a column index is
+/// loaded once for all of them and the k values of an entry are adjacent.
+template <class ExecutionSpace, class AMatrix, class XVector, class YVector,
+          bool conjugate>
+struct EnsembleSpmvFunctor {
+  using size_type    = typename AMatrix::non_const_size_type;
+  using value_type   = typename AMatrix::non_const_value_type;
+  using y_value_type = typename YVector::non_const_value_type;
+  using ATV          = Kokkos::ArithTraits<value_type>;
+  using team_member  = typename Kokkos::TeamPolicy<ExecutionSpace>::member_type;
+
+  y_value_type alpha;
+  AMatrix A;
+  XVector x;
+  y_value_type beta;
+  YVector y;
+  int64_t rows_per_team;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const team_member& t) const {
+    const int64_t first = static_cast<int64_t>(t.league_rank()) * rows_per_team;
+    const int k         = A.ensembleSize();
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(t, rows_per_team), [&](int64_t r) {
+          const int64_t i = first + r;
+          if (i >= static_cast<int64_t>(A.numRows())) return;
+          const size_type kbegin = A.graph.row_map(i);
+          const size_type kend   = A.graph.row_map(i + 1);
+          Kokkos::parallel_for(Kokkos::ThreadVectorRange(t, k), [&](int s) {
+            y_value_type sum = Kokkos::ArithTraits<y_value_type>::zero();
+            for (size_type e = kbegin; e < kend; e++) {
+              const value_type val =
+                  conjugate ? ATV::conj(A.values(e, s)) : A.values(e, s);
+              sum += static_cast<y_value_type>(val) * x(A.graph.entries(e), s);
+            }
+            if (beta == Kokkos::ArithTraits<y_value_type>::zero())
+              y(i, s) = alpha * sum;
+            else
+              y(i, s) = beta * y(i, s) + alpha * sum;
+          });
+        });
+  }
+};
+
+/// Native SpMV for EnsembleCrsMatrix: one pass over the shared graph for all
+/// samples. The vector length is the number of samples, rounded up to a power
+/// of two and capped at the execution space's maximum; the team size and rows
+/// per team follow the CRS SpMV.
+template <class ExecutionSpace, class AMatrix, class XVector, class YVector>
+void spmv_ensemble(const ExecutionSpace& space, const char mode[],
+                   typename YVector::const_value_type& alpha, const AMatrix& A,
+                   const XVector& x, typename YVector::const_value_type& beta,
+                   const YVector& y) {
+  using policy_type = Kokkos::TeamPolicy<ExecutionSpace>;
+
+  const bool conjugate = mode[0] == KokkosSparse::Conjugate[0];
+  if (!conjugate && mode[0] != KokkosSparse::NoTranspose[0]) {
+    std::stringstream ss;
+    ss << __FILE__ << ":" << __LINE__ << " Invalid transpose mode " << mode
+       << " for KokkosSparse::Experimental::spmv_ensemble() (only \"N\" and "
+          "\"C\" are supported)";
+    KokkosKernels::Impl::throw_runtime_exception(ss.str());
+  }
+  int vector_length = 1;
+  if (KokkosKernels::Impl::kk_is_gpu_exec_space<ExecutionSpace>()) {
+    const int max_vector_length =
+        KokkosKernels::Impl::kk_get_max_vector_size<ExecutionSpace>();
+    while (vector_length < A.ensembleSize() &&
+           vector_length < max_vector_length)
+      vector_length *= 2;
+  }
+  int team_size = -1;
+  const int64_t rows_per_team =
+      KokkosSparse::Impl::spmv_launch_parameters<ExecutionSpace>(
+          A.numRows(), A.nnz(), -1, team_size, vector_length);
+  const int64_t worksets = (A.numRows() + rows_per_team - 1) / rows_per_team;
+  const policy_type policy(space, worksets, team_size, vector_length);
+  if (conjugate)
+    Kokkos::parallel_for(
+        "KokkosSparse::spmv_ensemble<Conjugate>", policy,
+        EnsembleSpmvFunctor<ExecutionSpace, AMatrix, XVector, YVector, true>{
+            alpha, A, x, beta, y, rows_per_team});
+  else
+    Kokkos::parallel_for(
+        "KokkosSparse::spmv_ensemble<NoTranspose>", policy,
+        EnsembleSpmvFunctor<ExecutionSpace, AMatrix, XVector, YVector, false>{
+            alpha, A, x, beta, y, rows_per_team});
+}
+
+}  // namespace Impl
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPMV_ENSEMBLE_IMPL_HPP_
@@ -60,8 +60,8 @@ struct SPMV_Transpose_Functor {
     const auto row                = m_A.rowConst(iRow);
     const ordinal_type row_length = row.length;
     for (ordinal_type iEntry = 0; iEntry < row_length; iEntry++) {
-      const value_type val =
-          conjugate ? ATV::conj(row.value(iEntry)) : row.value(iEntry);
+      const y_value_type val = static_cast<y_value_type>(
+          conjugate ? ATV::conj(row.value(iEntry)) : row.value(iEntry));
       const ordinal_type ind = row.colidx(iEntry);
       Kokkos::atomic_add(&m_y(ind),
                          static_cast<y_value_type>(alpha * val * m_x(iRow)));
@@ -84,8 +84,9 @@ struct SPMV_Transpose_Functor {
           Kokkos::parallel_for(
               Kokkos::ThreadVectorRange(dev, row_length),
               [&](ordinal_type iEntry) {
-                const value_type val = conjugate ? ATV::conj(row.value(iEntry))
-                                                 : row.value(iEntry);
+                const y_value_type val = static_cast<y_value_type>(
+                    conjugate ? ATV::conj(row.value(iEntry))
+                              : row.value(iEntry));
                 const ordinal_type ind = row.colidx(iEntry);
                 Kokkos::atomic_add(&m_y(ind), static_cast<y_value_type>(
                                                   alpha * val * m_x(iRow)));
@@ -102,18 +103,24 @@ struct SPMV_Functor {
   typedef typename Kokkos::TeamPolicy<execution_space> team_policy;
   typedef typename team_policy::member_type team_member;
   typedef Kokkos::ArithTraits<value_type> ATV;
+  // alpha, beta and the row sums have the type of y, which may be more precise
+  // than the type of A's values (mixed precision SpMV)
+  typedef typename YVector::non_const_value_type coefficient_type;
+  // ... except that half_t and bhalf_t row sums are accumulated in float
+  typedef KokkosKernels::Impl::accumulation_scalar_t<coefficient_type>
+      accum_type;
 
-  const value_type alpha;
+  const coefficient_type alpha;
   AMatrix m_A;
   XVector m_x;
-  const value_type beta;
+  const coefficient_type beta;
   YVector m_y;
 
   const ordinal_type rows_per_team;
 
-  SPMV_Functor(const value_type alpha_, const AMatrix m_A_, const XVector m_x_,
-               const value_type beta_, const YVector m_y_,
-               const int rows_per_team_)
+  SPMV_Functor(const coefficient_type alpha_, const AMatrix m_A_,
+               const XVector m_x_, const coefficient_type beta_,
+               const YVector m_y_, const int rows_per_team_)
       : alpha(alpha_),
         m_A(m_A_),
         m_x(m_x_),
@@ -134,20 +141,23 @@ struct SPMV_Functor {
     }
     const KokkosSparse::SparseRowViewConst<AMatrix> row = m_A.rowConst(iRow);
     const ordinal_type row_length = static_cast<ordinal_type>(row.length);
-    y_value_type sum              = 0;
+    accum_type sum                = 0;
 
     for (ordinal_type iEntry = 0; iEntry < row_length; iEntry++) {
       const value_type val =
           conjugate ? ATV::conj(row.value(iEntry)) : row.value(iEntry);
-      sum += val * m_x(row.colidx(iEntry));
+      sum += static_cast<accum_type>(val) *
+             static_cast<accum_type>(m_x(row.colidx(iEntry)));
     }
 
-    sum *= alpha;
+    sum *= static_cast<accum_type>(alpha);
 
     if (dobeta == 0) {
-      m_y(iRow) = sum;
+      m_y(iRow) = static_cast<y_value_type>(sum);
     } else {
-      m_y(iRow) = beta * m_y(iRow) + sum;
+      m_y(iRow) = static_cast<y_value_type>(
+          static_cast<accum_type>(beta) * static_cast<accum_type>(m_y(iRow)) +
+          sum);
     }
   }
 
@@ -167,30 +177,61 @@ struct SPMV_Functor {
           const KokkosSparse::SparseRowViewConst<AMatrix> row =
               m_A.rowConst(iRow);
           const ordinal_type row_length = static_cast<ordinal_type>(row.length);
-          y_value_type sum              = 0;
+          accum_type sum                = 0;
 
           Kokkos::parallel_reduce(
               Kokkos::ThreadVectorRange(dev, row_length),
-              [&](const ordinal_type& iEntry, y_value_type& lsum) {
+              [&](const ordinal_type& iEntry, accum_type& lsum) {
                 const value_type val = conjugate ? ATV::conj(row.value(iEntry))
                                                  : row.value(iEntry);
-                lsum += val * m_x(row.colidx(iEntry));
+                lsum += static_cast<accum_type>(val) *
+                        static_cast<accum_type>(m_x(row.colidx(iEntry)));
               },
               sum);
 
           Kokkos::single(Kokkos::PerThread(dev), [&]() {
-            sum *= alpha;
+            sum *= static_cast<accum_type>(alpha);
 
             if (dobeta == 0) {
-              m_y(iRow) = sum;
+              m_y(iRow) = static_cast<y_value_type>(sum);
             } else {
-              m_y(iRow) = beta * m_y(iRow) + sum;
+              m_y(iRow) = static_cast<y_value_type>(
+                  static_cast<accum_type>(beta) *
+                      static_cast<accum_type>(m_y(iRow)) +
+                  sum);
             }
           });
         });
   }
 };
 
+// Applies SPMV_Functor to the rows of one of the contiguous, nnz-balanced row
+// ranges kept in the handle by SPMV_NNZ_BALANCED (one range per thread)
+template <class execution_space, class AMatrix, class XVector, class YVector,
+          int dobeta, bool conjugate>
+struct SPMV_NnzBalanced_Functor {
+  typedef typename AMatrix::non_const_ordinal_type ordinal_type;
+  typedef SPMV_Functor<execution_space, AMatrix, XVector, YVector, dobeta,
+                       conjugate>
+      row_functor_type;
+
+  row_functor_type m_rows;
+  Kokkos::View<const ordinal_type*,
+               Kokkos::Device<execution_space, typename AMatrix::memory_space>>
+      m_starts;
+
+  template <class RowStarts>
+  SPMV_NnzBalanced_Functor(const row_functor_type& rows_,
+                           const RowStarts& starts_)
+      : m_rows(rows_), m_starts(starts_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int part) const {
+    const ordinal_type end = m_starts(part + 1);
+    for (ordinal_type iRow = m_starts(part); iRow < end; iRow++) m_rows(iRow);
+  }
+};
+
 template <class execution_space>
 int64_t spmv_launch_parameters(int64_t numRows, int64_t nnz,
                                int64_t rows_per_thread, int& team_size,
@@ -264,12 +305,35 @@ static void spmv_beta_no_transpose(const execution_space& exec, Handle* handle,
   if (A.numRows() <= static_cast<ordinal_type>(0)) {
     return;
   }
+  // SPMV_NNZ_BALANCED: one contiguous range of rows per thread, with about
+  // the same number of entries in each range. The ranges are computed by the
+  // first call. With a single thread there is nothing to balance.
+  const int num_parts = exec.concurrency();
+  if (handle->algo == SPMV_NNZ_BALANCED && num_parts > 1) {
+    if (!handle->has_nnz_balanced_rows(A.numRows(), num_parts))
+      handle->build_nnz_balanced_rows(exec, A, num_parts);
+    SPMV_NnzBalanced_Functor<execution_space, AMatrix, XVector, YVector,
+                             dobeta, conjugate>
+        func(SPMV_Functor<execution_space, AMatrix, XVector, YVector, dobeta,
+                          conjugate>(alpha, A, x, beta, y, 1),
+             handle->nnz_balanced_row_starts);
+    Kokkos::parallel_for(
+        "KokkosSparse::spmv<NoTranspose,NnzBalanced>",
+        Kokkos::RangePolicy<execution_space, Kokkos::Schedule<Kokkos::Static>>(
+            exec, 0, num_parts),
+        func);
+    return;
+  }
+
 #if defined(KOKKOS_ENABLE_SERIAL)
   if (std::is_same<execution_space, Kokkos::Serial>::value) {
     /// serial impl
     typedef typename AMatrix::non_const_value_type value_type;
     typedef typename AMatrix::non_const_size_type size_type;
     typedef Kokkos::ArithTraits<value_type> ATV;
+    typedef typename YVector::non_const_value_type y_value_type;
+    typedef KokkosKernels::Impl::accumulation_scalar_t<y_value_type>
+        accum_type;
 
     const size_type* KOKKOS_RESTRICT row_map_ptr    = A.graph.row_map.data();
     const ordinal_type* KOKKOS_RESTRICT col_idx_ptr = A.graph.entries.data();
@@ -298,8 +362,7 @@ static void spmv_beta_no_transpose(const execution_space& exec, Handle* handle,
 
         {
           const int jdist = (jend - jbeg) / 4;
-          typename YVector::non_const_value_type tmp1(0), tmp2(0), tmp3(0),
-              tmp4(0);
+          accum_type tmp1(0), tmp2(0), tmp3(0), tmp4(0);
           for (int jj = 0; jj < jdist; ++jj) {
             const value_type value1 =
                 conjugate ? ATV::conj(values_ptr[j]) : values_ptr[j];
@@ -317,25 +380,34 @@ static void spmv_beta_no_transpose(const execution_space& exec, Handle* handle,
             const typename XVector::value_type x_val2 = x_ptr[col_idx2];
             const typename XVector::value_type x_val3 = x_ptr[col_idx3];
             const typename XVector::value_type x_val4 = x_ptr[col_idx4];
-            tmp1 += value1 * x_val1;
-            tmp2 += value2 * x_val2;
-            tmp3 += value3 * x_val3;
-            tmp4 += value4 * x_val4;
+            tmp1 += static_cast<accum_type>(value1) *
+                    static_cast<accum_type>(x_val1);
+            tmp2 += static_cast<accum_type>(value2) *
+                    static_cast<accum_type>(x_val2);
+            tmp3 += static_cast<accum_type>(value3) *
+                    static_cast<accum_type>(x_val3);
+            tmp4 += static_cast<accum_type>(value4) *
+                    static_cast<accum_type>(x_val4);
             j += 4;
           }
           for (; j < jend; ++j) {
             const value_type value =
                 conjugate ? ATV::conj(values_ptr[j]) : values_ptr[j];
             const int col_idx = col_idx_ptr[j];
-            tmp1 += value * x_ptr[col_idx];
+            tmp1 += static_cast<accum_type>(value) *
+                    static_cast<accum_type>(x_ptr[col_idx]);
           }
+          const accum_type sum =
+              static_cast<accum_type>(alpha) * (tmp1 + tmp2 + tmp3 + tmp4);
           if (dobeta == 0) {
-            y_ptr[i] = alpha * (tmp1 + tmp2 + tmp3 + tmp4);
+            y_ptr[i] = static_cast<y_value_type>(sum);
           } else if (dobeta == 1) {
-            y_ptr[i] += alpha * (tmp1 + tmp2 + tmp3 + tmp4);
+            y_ptr[i] = static_cast<y_value_type>(
+                static_cast<accum_type>(y_ptr[i]) + sum);
           } else {
-            const auto y_val = y_ptr[i] * beta;
-            y_ptr[i]         = y_val + alpha * (tmp1 + tmp2 + tmp3 + tmp4);
+            const accum_type y_val = static_cast<accum_type>(y_ptr[i]) *
+                                     static_cast<accum_type>(beta);
+            y_ptr[i]               = static_cast<y_value_type>(y_val + sum);
           }
         }
       }
@@ -470,6 +542,7 @@ static void spmv_beta_transpose(const execution_space& exec,
       /// serial impl
       typedef typename AMatrix::non_const_value_type value_type;
       typedef Kokkos::ArithTraits<value_type> ATV;
+      typedef typename YVector::non_const_value_type y_value_type;
       const size_type* KOKKOS_RESTRICT row_map_ptr    = A.graph.row_map.data();
       const ordinal_type* KOKKOS_RESTRICT col_idx_ptr = A.graph.entries.data();
       const value_type* KOKKOS_RESTRICT values_ptr    = A.values.data();
@@ -502,17 +575,17 @@ static void spmv_beta_transpose(const execution_space& exec,
             const int col_idx2 = col_idx_ptr[j + 1];
             const int col_idx3 = col_idx_ptr[j + 2];
             const int col_idx4 = col_idx_ptr[j + 3];
-            y_ptr[col_idx1] += value1 * x_val;
-            y_ptr[col_idx2] += value2 * x_val;
-            y_ptr[col_idx3] += value3 * x_val;
-            y_ptr[col_idx4] += value4 * x_val;
+            y_ptr[col_idx1] += static_cast<y_value_type>(value1) * x_val;
+            y_ptr[col_idx2] += static_cast<y_value_type>(value2) * x_val;
+            y_ptr[col_idx3] += static_cast<y_value_type>(value3) * x_val;
+            y_ptr[col_idx4] += static_cast<y_value_type>(value4) * x_val;
             j += 4;
           }
           for (; j < jend; ++j) {
             const value_type value =
                 conjugate ? ATV::conj(values_ptr[j]) : values_ptr[j];
             const int col_idx = col_idx_ptr[j];
-            y_ptr[col_idx] += value * x_val;
+            y_ptr[col_idx] += static_cast<y_value_type>(value) * x_val;
           }
         }
       }
@@ -669,9 +742,9 @@ struct SPMV_MV_Transpose_Functor {
     const ordinal_type row_length = row.length;
 
     for (ordinal_type iEntry = 0; iEntry < row_length; iEntry++) {
-      const A_value_type val =
+      const y_value_type val = static_cast<y_value_type>(
           conjugate ? Kokkos::ArithTraits<A_value_type>::conj(row.value(iEntry))
-                    : row.value(iEntry);
+                    : row.value(iEntry));
       const ordinal_type ind = row.colidx(iEntry);
 
       if (doalpha != 1) {
@@ -711,10 +784,10 @@ struct SPMV_MV_Transpose_Functor {
           Kokkos::parallel_for(
               Kokkos::ThreadVectorRange(dev, row_length),
               [&](ordinal_type iEntry) {
-                const A_value_type val =
+                const y_value_type val = static_cast<y_value_type>(
                     conjugate ? Kokkos::ArithTraits<A_value_type>::conj(
                                     row.value(iEntry))
-                              : row.value(iEntry);
+                              : row.value(iEntry));
                 const ordinal_type ind = row.colidx(iEntry);
 
                 if (doalpha != 1) {
@@ -808,7 +881,7 @@ struct SPMV_MV_LayoutLeft_Functor {
 #pragma unroll
 #endif
           for (int k = 0; k < UNROLL; ++k) {
-            sum[k] += val * m_x(ind, kk + k);
+            sum[k] += static_cast<y_value_type>(val) * m_x(ind, kk + k);
           }
         });
 
@@ -897,11 +970,11 @@ struct SPMV_MV_LayoutLeft_Functor {
 #endif
       for (int k = 0; k < UNROLL; ++k) {
         if (doalpha == 1)
-          sum[k] += val * m_x(ind, kk + k);
+          sum[k] += static_cast<y_value_type>(val) * m_x(ind, kk + k);
         else if (doalpha == -1)
-          sum[k] -= val * m_x(ind, kk + k);
+          sum[k] -= static_cast<y_value_type>(val) * m_x(ind, kk + k);
         else
-          sum[k] += alpha * val * m_x(ind, kk + k);
+          sum[k] += alpha * static_cast<y_value_type>(val) * m_x(ind, kk + k);
       }
     }
 
@@ -936,7 +1009,7 @@ struct SPMV_MV_LayoutLeft_Functor {
               conjugate
                   ? Kokkos::ArithTraits<A_value_type>::conj(row.value(iEntry))
                   : row.value(iEntry);
-          lsum += val * m_x(row.colidx(iEntry), 0);
+          lsum += static_cast<y_value_type>(val) * m_x(row.colidx(iEntry), 0);
         },
         sum);
     Kokkos::single(Kokkos::PerThread(dev), [&]() {
@@ -971,7 +1044,7 @@ struct SPMV_MV_LayoutLeft_Functor {
       const A_value_type val =
           conjugate ? Kokkos::ArithTraits<A_value_type>::conj(row.value(iEntry))
                     : row.value(iEntry);
-      sum += val * m_x(row.colidx(iEntry), 0);
+      sum += static_cast<y_value_type>(val) * m_x(row.colidx(iEntry), 0);
     }
     if (doalpha == -1) {
       sum = -sum;
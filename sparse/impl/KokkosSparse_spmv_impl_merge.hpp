@@ -245,7 +245,7 @@ struct SpmvMergeHierarchical {
             val = (CONJ ? KAT::conj(A.values(curNnz)) : A.values(curNnz));
           }
 
-          acc += val * x(col);
+          acc += static_cast<y_value_type>(val) * x(col);
           ++curNnz;
         } else {
           if constexpr (Y_USE_SCRATCH) {
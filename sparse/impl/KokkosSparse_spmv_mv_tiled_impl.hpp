@@ -0,0 +1,220 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_SPMV_MV_TILED_IMPL_HPP
+#define KOKKOSSPARSE_SPMV_MV_TILED_IMPL_HPP
+
+#include <sstream>
+
+#include "Kokkos_ArithTraits.hpp"
+#include "KokkosKernels_ExecSpaceUtils.hpp"
+#include "KokkosBlas1_scal.hpp"
+#include "KokkosSparse_BsrMatrix.hpp"
+
+namespace KokkosSparse::Impl {
+
+/*! \brief Multivector SpMV with a compile-time column tile (SPMV_MV_TILED)
+
+  Each work item computes TILE consecutive columns of one (point) row of Y.
+  The TILE partial sums stay in registers while the row of A is read once,
+  so every entry of A is loaded numVecs / TILE times instead of numVecs
+  times. With LayoutRight X and Y, the TILE entries of X used by one entry
+  of A are contiguous and the inner loop vectorizes.
+
+  Work items are ordered row-major (all tiles of row 0, then row 1, ...), so
+  on CPUs a thread walks the tiles of a row while that row of A is in cache,
+  and on GPUs neighboring threads share the entries of A they read.
+
+  The last tile is masked if the number of columns is not a multiple of
+  TILE. Works for CrsMatrix and BsrMatrix (blocks stored row-major), in
+  modes N and C.
+*/
+template <class ExecutionSpace, class AMatrix, class XVector, class YVector>
+struct SpmvMvTiled {
+  using exec_space     = ExecutionSpace;
+  using y_value_type   = typename YVector::non_const_value_type;
+  using A_value_type   = typename AMatrix::non_const_value_type;
+  using A_ordinal_type = typename AMatrix::non_const_ordinal_type;
+  using A_size_type    = typename AMatrix::non_const_size_type;
+
+  using KAT = Kokkos::ArithTraits<A_value_type>;
+
+  static constexpr bool isBSR =
+      ::KokkosSparse::Experimental::is_bsr_matrix_v<AMatrix>;
+
+  template <int TILE, bool CONJ>
+  struct SpmvMvTiledFunctor {
+    SpmvMvTiledFunctor(const y_value_type& _alpha, const AMatrix& _A,
+                       const XVector& _x, const y_value_type& _beta,
+                       const YVector& _y, const A_ordinal_type _numTiles)
+        : alpha(_alpha),
+          A(_A),
+          x(_x),
+          beta(_beta),
+          y(_y),
+          numTiles(_numTiles) {}
+
+    y_value_type alpha;
+    AMatrix A;
+    XVector x;
+    y_value_type beta;
+    YVector y;
+    A_ordinal_type numTiles;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const int64_t work) const {
+      const A_ordinal_type row   = work / numTiles;
+      const A_ordinal_type c0    = (work % numTiles) * TILE;
+      const A_ordinal_type width = A_ordinal_type(y.extent(1)) - c0;
+      if (width >= TILE)
+        row_tile<true>(row, c0, TILE);
+      else
+        row_tile<false>(row, c0, width);
+    }
+
+    template <bool FULL>
+    KOKKOS_INLINE_FUNCTION void row_tile(const A_ordinal_type row,
+                                         const A_ordinal_type c0,
+                                         const A_ordinal_type width) const {
+      y_value_type sum[TILE];
+#ifdef KOKKOS_ENABLE_PRAGMA_UNROLL
+#pragma unroll
+#endif
+      for (int k = 0; k < TILE; ++k) {
+        sum[k] = Kokkos::ArithTraits<y_value_type>::zero();
+      }
+
+      if constexpr (isBSR) {
+        // row is a point row: ii within block row br
+        const A_ordinal_type blockDim = A.blockDim();
+        const A_size_type blockSize   = A_size_type(blockDim) * blockDim;
+        const A_ordinal_type br       = row / blockDim;
+        const A_ordinal_type ii       = row % blockDim;
+        for (A_size_type e = A.graph.row_map(br);
+             e < A.graph.row_map(br + 1); ++e) {
+          const A_value_type* blockRow =
+              &A.values(e * blockSize + ii * blockDim);
+          const A_ordinal_type xBeg = A.graph.entries(e) * blockDim;
+          for (A_ordinal_type jj = 0; jj < blockDim; ++jj) {
+            accumulate<FULL>(sum, blockRow[jj], xBeg + jj, c0, width);
+          }
+        }
+      } else {
+        for (A_size_type e = A.graph.row_map(row);
+             e < A.graph.row_map(row + 1); ++e) {
+          accumulate<FULL>(sum, A.values(e), A.graph.entries(e), c0, width);
+        }
+      }
+
+      if (beta == Kokkos::ArithTraits<y_value_type>::zero()) {
+#ifdef KOKKOS_ENABLE_PRAGMA_UNROLL
+#pragma unroll
+#endif
+        for (int k = 0; k < TILE; ++k) {
+          if (FULL || k < width) y(row, c0 + k) = alpha * sum[k];
+        }
+      } else {
+#ifdef KOKKOS_ENABLE_PRAGMA_UNROLL
+#pragma unroll
+#endif
+        for (int k = 0; k < TILE; ++k) {
+          if (FULL || k < width)
+            y(row, c0 + k) = beta * y(row, c0 + k) + alpha * sum[k];
+        }
+      }
+    }
+
+    template <bool FULL>
+    KOKKOS_INLINE_FUNCTION void accumulate(y_value_type* sum,
+                                           const A_value_type aij,
+                                           const A_ordinal_type xRow,
+                                           const A_ordinal_type c0,
+                                           const A_ordinal_type width) const {
+      const y_value_type val =
+          static_cast<y_value_type>(CONJ ? KAT::conj(aij) : aij);
+#ifdef KOKKOS_ENABLE_PRAGMA_IVDEP
+#pragma ivdep
+#endif
+#ifdef KOKKOS_ENABLE_PRAGMA_UNROLL
+#pragma unroll
+#endif
+      for (int k = 0; k < TILE; ++k) {
+        if (FULL || k < width) sum[k] += val * x(xRow, c0 + k);
+      }
+    }
+  };  // struct SpmvMvTiledFunctor
+
+  template <int TILE>
+  static void launch(const ExecutionSpace& space, const char mode[],
+                     const y_value_type& alpha, const AMatrix& A,
+                     const XVector& x, const y_value_type& beta,
+                     const YVector& y, const A_ordinal_type numPointRows) {
+    const A_ordinal_type numTiles = (y.extent(1) + TILE - 1) / TILE;
+    Kokkos::RangePolicy<exec_space> policy(
+        space, 0, int64_t(numPointRows) * numTiles);
+    if (KokkosSparse::NoTranspose[0] == mode[0]) {
+      SpmvMvTiledFunctor<TILE, false> op(alpha, A, x, beta, y, numTiles);
+      Kokkos::parallel_for("SpmvMvTiled::spmv", policy, op);
+    } else if (KokkosSparse::Conjugate[0] == mode[0]) {
+      SpmvMvTiledFunctor<TILE, true> op(alpha, A, x, beta, y, numTiles);
+      Kokkos::parallel_for("SpmvMvTiled::spmv", policy, op);
+    } else {
+      std::stringstream ss;
+      ss << __FILE__ << ":" << __LINE__
+         << "SpmvMvTiled::spmv() called with unsupported mode " << mode;
+      throw std::logic_error(ss.str());
+    }
+  }
+
+  static void spmv(const ExecutionSpace& space, const char mode[],
+                   const y_value_type& alpha, const AMatrix& A,
+                   const XVector& x, const y_value_type& beta,
+                   const YVector& y) {
+    static_assert(XVector::rank == 2, "");
+    static_assert(YVector::rank == 2, "");
+
+    A_ordinal_type numPointRows = A.numRows();
+    if constexpr (isBSR) numPointRows *= A.blockDim();
+    if (numPointRows == 0 || y.extent(1) == 0) return;
+    if (alpha == Kokkos::ArithTraits<y_value_type>::zero()) {
+      if (beta != Kokkos::ArithTraits<y_value_type>::one())
+        KokkosBlas::scal(space, y, beta, y);
+      return;
+    }
+
+    /* pick the column tile for the number of vectors
+       GPUs have fewer registers per thread, and get their parallelism from
+       the rows, so use at most 8 columns per thread there.
+    */
+    const size_t numVecs = y.extent(1);
+    if constexpr (KokkosKernels::Impl::kk_is_gpu_exec_space<ExecutionSpace>()) {
+      if (numVecs >= 8)
+        launch<8>(space, mode, alpha, A, x, beta, y, numPointRows);
+      else
+        launch<4>(space, mode, alpha, A, x, beta, y, numPointRows);
+    } else {
+      if (numVecs >= 16)
+        launch<16>(space, mode, alpha, A, x, beta, y, numPointRows);
+      else if (numVecs >= 8)
+        launch<8>(space, mode, alpha, A, x, beta, y, numPointRows);
+      else
+        launch<4>(space, mode, alpha, A, x, beta, y, numPointRows);
+    }
+  }
+};
+
+}  // namespace KokkosSparse::Impl
+
+#endif  // KOKKOSSPARSE_SPMV_MV_TILED_IMPL_HPP
@@ -0,0 +1,145 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_SPMV_PARTITIONED_IMPL_HPP_
+#define KOKKOSSPARSE_SPMV_PARTITIONED_IMPL_HPP_
+
+#include "Kokkos_ArithTraits.hpp"
+#include "KokkosKernels_ExecSpaceUtils.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+namespace Impl {
+
+/// y(r) := beta * y(r) + alpha * op(A)(r, :) * x for each row r in a list,
+/// op(A) = A or conj(A). Each team takes rows_per_team consecutive entries of
+/// the list; each thread one row, whose entries are split over the vector
+/// lanes. Rows which are not in the list are not touched.
+template <class ExecutionSpace, class AMatrix, class RowList, class XVector,
+          class YVector, bool conjugate>
+struct SpmvRowListFunctor {
+  using ordinal_type = typename AMatrix::non_const_ordinal_type;
+  using size_type    = typename AMatrix::non_const_size_type;
+  using value_type   = typename AMatrix::non_const_value_type;
+  using y_value_type = typename YVector::non_const_value_type;
+  using ATV          = Kokkos::ArithTraits<value_type>;
+  using team_policy  = Kokkos::TeamPolicy<ExecutionSpace>;
+  using team_member  = typename team_policy::member_type;
+
+  y_value_type alpha;
+  AMatrix A;
+  RowList rows;
+  XVector x;
+  y_value_type beta;
+  YVector y;
+  ordinal_type rows_per_team;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const team_member& dev) const {
+    const ordinal_type numListed = rows.extent(0);
+    const ordinal_type begin     = dev.league_rank() * rows_per_team;
+    const ordinal_type end =
+        KOKKOSKERNELS_MACRO_MIN(begin + rows_per_team, numListed);
+    int numVecs = 1;
+    if constexpr (XVector::rank == 2) numVecs = x.extent(1);
+
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(dev, begin, end), [&](const ordinal_type l) {
+          const ordinal_type r = rows(l);
+          const size_type rBeg = A.graph.row_map(r);
+          const size_type rEnd = A.graph.row_map(r + 1);
+          for (int col = 0; col < numVecs; col++) {
+            y_value_type sum = Kokkos::ArithTraits<y_value_type>::zero();
+            if (alpha != Kokkos::ArithTraits<y_value_type>::zero()) {
+              Kokkos::parallel_reduce(
+                  Kokkos::ThreadVectorRange(dev, rBeg, rEnd),
+                  [&](const size_type k, y_value_type& lsum) {
+                    value_type a = A.values(k);
+                    if (conjugate) a = ATV::conj(a);
+                    if constexpr (XVector::rank == 1)
+                      lsum += static_cast<y_value_type>(a) *
+                              x(A.graph.entries(k));
+                    else
+                      lsum += static_cast<y_value_type>(a) *
+                              x(A.graph.entries(k), col);
+                  },
+                  sum);
+            }
+            Kokkos::single(Kokkos::PerThread(dev), [&]() {
+              y_value_type* yp;
+              if constexpr (YVector::rank == 1)
+                yp = &y(r);
+              else
+                yp = &y(r, col);
+              if (beta == Kokkos::ArithTraits<y_value_type>::zero())
+                *yp = alpha * sum;
+              else
+                *yp = beta * *yp + alpha * sum;
+            });
+          }
+        });
+  }
+};
+
+/// Native SpMV restricted to a list of rows of the CrsMatrix A, in mode N or
+/// C. The list may be in any order, but must not contain a row twice.
+template <class ExecutionSpace, class AMatrix, class RowList, class XVector,
+          class YVector>
+void spmv_row_list(const ExecutionSpace& space, const bool conjugate,
+                   typename YVector::const_value_type& alpha,
+                   const AMatrix& A, const RowList& rows, const XVector& x,
+                   typename YVector::const_value_type& beta,
+                   const YVector& y) {
+  using ordinal_type = typename AMatrix::non_const_ordinal_type;
+  using policy_type  = Kokkos::TeamPolicy<ExecutionSpace>;
+
+  const ordinal_type numListed = rows.extent(0);
+  if (numListed == 0) return;
+
+  // On GPUs, enough vector lanes for an average row (up to 32) and 128
+  // threads per team; on CPUs one thread walks a chunk of the list
+  int vector_length          = 1;
+  int team_size              = 1;
+  ordinal_type rows_per_team = 64;
+  if constexpr (KokkosKernels::Impl::kk_is_gpu_exec_space<ExecutionSpace>()) {
+    const double avg_nnz =
+        A.numRows() ? double(A.nnz()) / A.numRows() : double(0);
+    while (vector_length < 32 && vector_length < avg_nnz) vector_length *= 2;
+    vector_length = KOKKOSKERNELS_MACRO_MIN(vector_length,
+                                            policy_type::vector_length_max());
+    team_size     = 128 / vector_length;
+    rows_per_team = team_size;
+  }
+  const ordinal_type numTeams =
+      (numListed + rows_per_team - 1) / rows_per_team;
+  policy_type policy(space, numTeams, team_size, vector_length);
+  if (conjugate)
+    Kokkos::parallel_for(
+        "KokkosSparse::spmv<RowList,Conjugate>", policy,
+        SpmvRowListFunctor<ExecutionSpace, AMatrix, RowList, XVector, YVector,
+                           true>{alpha, A, rows, x, beta, y, rows_per_team});
+  else
+    Kokkos::parallel_for(
+        "KokkosSparse::spmv<RowList,NoTranspose>", policy,
+        SpmvRowListFunctor<ExecutionSpace, AMatrix, RowList, XVector, YVector,
+                           false>{alpha, A, rows, x, beta, y, rows_per_team});
+}
+
+}  // namespace Impl
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPMV_PARTITIONED_IMPL_HPP_
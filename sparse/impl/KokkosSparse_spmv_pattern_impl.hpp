@@ -0,0 +1,161 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_SPMV_PATTERN_IMPL_HPP_
+#define KOKKOSSPARSE_SPMV_PATTERN_IMPL_HPP_
+
+#include "Kokkos_ArithTraits.hpp"
+#include "KokkosKernels_ExecSpaceUtils.hpp"
+#include "KokkosSparse_spmv_impl.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+
+/// y(i) := beta * y(i) + alpha * (sum of x(j) over the entries j of row i
+/// of the graph): SPMV_Functor for a matrix of ones, which does not read
+/// any values.
+template <class execution_space, class Graph, class XVector, class YVector,
+          int dobeta>
+struct SPMV_Pattern_Functor {
+  typedef typename Graph::data_type ordinal_type;
+  typedef typename Graph::size_type size_type;
+  typedef typename YVector::non_const_value_type coefficient_type;
+  typedef typename Kokkos::TeamPolicy<execution_space> team_policy;
+  typedef typename team_policy::member_type team_member;
+
+  const coefficient_type alpha;
+  Graph m_G;
+  XVector m_x;
+  const coefficient_type beta;
+  YVector m_y;
+  const ordinal_type numRows;
+  const ordinal_type rows_per_team;
+
+  SPMV_Pattern_Functor(const coefficient_type alpha_, const Graph m_G_,
+                       const XVector m_x_, const coefficient_type beta_,
+                       const YVector m_y_, const ordinal_type numRows_,
+                       const int rows_per_team_)
+      : alpha(alpha_),
+        m_G(m_G_),
+        m_x(m_x_),
+        beta(beta_),
+        m_y(m_y_),
+        numRows(numRows_),
+        rows_per_team(rows_per_team_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void finish_row(const ordinal_type iRow, coefficient_type sum) const {
+    sum *= alpha;
+    if (dobeta == 0) {
+      m_y(iRow) = sum;
+    } else {
+      m_y(iRow) = beta * m_y(iRow) + sum;
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const ordinal_type iRow) const {
+    coefficient_type sum = 0;
+    for (size_type k = m_G.row_map(iRow); k < m_G.row_map(iRow + 1); k++) {
+      sum += m_x(m_G.entries(k));
+    }
+    finish_row(iRow, sum);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const team_member& dev) const {
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(dev, 0, rows_per_team),
+        [&](const ordinal_type& loop) {
+          const ordinal_type iRow =
+              static_cast<ordinal_type>(dev.league_rank()) * rows_per_team +
+              loop;
+          if (iRow >= numRows) {
+            return;
+          }
+          const size_type rowBegin = m_G.row_map(iRow);
+          const ordinal_type row_length =
+              static_cast<ordinal_type>(m_G.row_map(iRow + 1) - rowBegin);
+          coefficient_type sum = 0;
+
+          Kokkos::parallel_reduce(
+              Kokkos::ThreadVectorRange(dev, row_length),
+              [&](const ordinal_type& iEntry, coefficient_type& lsum) {
+                lsum += m_x(m_G.entries(rowBegin + iEntry));
+              },
+              sum);
+
+          Kokkos::single(Kokkos::PerThread(dev),
+                         [&]() { finish_row(iRow, sum); });
+        });
+  }
+};
+
+template <int dobeta, class execution_space, class Graph, class XVector,
+          class YVector>
+void spmv_pattern_launch(const execution_space& exec,
+                         typename YVector::const_value_type& alpha,
+                         const Graph& G, const XVector& x,
+                         typename YVector::const_value_type& beta,
+                         const YVector& y) {
+  using ordinal_type = typename Graph::data_type;
+  using functor_type =
+      SPMV_Pattern_Functor<execution_space, Graph, XVector, YVector, dobeta>;
+
+  const ordinal_type numRows = y.extent(0);
+  if constexpr (KokkosKernels::Impl::kk_is_gpu_exec_space<execution_space>()) {
+    int team_size           = -1;
+    int vector_length       = -1;
+    int64_t rows_per_thread = -1;
+
+    int64_t rows_per_team = spmv_launch_parameters<execution_space>(
+        numRows, G.entries.extent(0), rows_per_thread, team_size,
+        vector_length);
+    int64_t worksets = (numRows + rows_per_team - 1) / rows_per_team;
+
+    Kokkos::parallel_for(
+        "KokkosSparse::spmv_pattern",
+        Kokkos::TeamPolicy<execution_space>(exec, worksets, team_size,
+                                            vector_length),
+        functor_type(alpha, G, x, beta, y, numRows, rows_per_team));
+  } else {
+    Kokkos::parallel_for(
+        "KokkosSparse::spmv_pattern",
+        Kokkos::RangePolicy<execution_space>(exec, 0, numRows),
+        functor_type(alpha, G, x, beta, y, numRows, 1));
+  }
+}
+
+/// Native y := beta * y + alpha * G * x for the matrix of ones with the
+/// pattern of the graph G, with the launch parameters of the native SpMV.
+template <class execution_space, class Graph, class XVector, class YVector>
+void spmv_pattern_native(const execution_space& exec,
+                         typename YVector::const_value_type& alpha,
+                         const Graph& G, const XVector& x,
+                         typename YVector::const_value_type& beta,
+                         const YVector& y) {
+  using KAT = Kokkos::ArithTraits<typename YVector::non_const_value_type>;
+  if (y.extent(0) == 0) return;
+  if (beta == KAT::zero())
+    spmv_pattern_launch<0>(exec, alpha, G, x, beta, y);
+  else
+    spmv_pattern_launch<1>(exec, alpha, G, x, beta, y);
+}
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPMV_PATTERN_IMPL_HPP_
@@ -0,0 +1,255 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_SPMV_SELL_IMPL_HPP_
+#define KOKKOSSPARSE_SPMV_SELL_IMPL_HPP_
+
+#include <sstream>
+
+#include "Kokkos_ArithTraits.hpp"
+#include "KokkosBlas1_scal.hpp"
+#include "KokkosKernels_ExecSpaceUtils.hpp"
+#include "KokkosKernels_Error.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_SellMatrix.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+namespace Impl {
+
+struct SellRowTag {};
+struct SellChunkTag {};
+
+/// y := beta * y + alpha * op(A) * x for a SellMatrix, op(A) = A or conj(A).
+///
+/// With SellRowTag, there is one thread per sorted row. Consecutive threads
+/// handle consecutive lanes of a chunk, so their loads of values and entries
+/// are coalesced. This is used on GPUs.
+///
+/// With SellChunkTag, there is one thread per chunk which sweeps all lanes at
+/// once. The inner loop over lanes is contiguous and vectorizes. This is used
+/// on CPUs.
+template <class AMatrix, class XVector, class YVector, bool conjugate>
+struct SellSpmvFunctor {
+  using ordinal_type = typename AMatrix::non_const_ordinal_type;
+  using size_type    = typename AMatrix::non_const_size_type;
+  using value_type   = typename AMatrix::non_const_value_type;
+  using y_value_type = typename YVector::non_const_value_type;
+  using ATV          = Kokkos::ArithTraits<value_type>;
+
+  y_value_type alpha;
+  AMatrix A;
+  XVector x;
+  y_value_type beta;
+  YVector y;
+  // Index of the column of x/y (0 for single vectors)
+  int col;
+
+  KOKKOS_INLINE_FUNCTION value_type getVal(size_type k) const {
+    return conjugate ? ATV::conj(A.values(k)) : A.values(k);
+  }
+
+  KOKKOS_INLINE_FUNCTION y_value_type getX(ordinal_type c) const {
+    if constexpr (XVector::rank == 1)
+      return x(c);
+    else
+      return x(c, col);
+  }
+
+  KOKKOS_INLINE_FUNCTION void update(ordinal_type row,
+                                     const y_value_type& sum) const {
+    y_value_type* yp;
+    if constexpr (YVector::rank == 1)
+      yp = &y(row);
+    else
+      yp = &y(row, col);
+    if (beta == Kokkos::ArithTraits<y_value_type>::zero())
+      *yp = alpha * sum;
+    else
+      *yp = beta * *yp + alpha * sum;
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(SellRowTag,
+                                         const ordinal_type i) const {
+    const int C              = A.chunkSize();
+    const ordinal_type lane  = i % C;
+    const size_type offset   = A.chunk_offsets(i / C) + lane;
+    const ordinal_type len   = A.row_lengths(i);
+    y_value_type sum         = Kokkos::ArithTraits<y_value_type>::zero();
+    for (ordinal_type j = 0; j < len; j++) {
+      const size_type k = offset + j * C;
+      sum += getVal(k) * getX(A.entries(k));
+    }
+    update(A.row_perm(i), sum);
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(SellChunkTag,
+                                         const ordinal_type chunk) const {
+    const int C               = A.chunkSize();
+    const ordinal_type first  = chunk * C;
+    const ordinal_type nlanes = Kokkos::min<ordinal_type>(C, A.numRows() - first);
+    const size_type offset    = A.chunk_offsets(chunk);
+    const ordinal_type width =
+        (A.chunk_offsets(chunk + 1) - A.chunk_offsets(chunk)) / C;
+    y_value_type sums[AMatrix::max_chunk_size];
+    ordinal_type lens[AMatrix::max_chunk_size];
+    for (ordinal_type l = 0; l < nlanes; l++) {
+      sums[l] = Kokkos::ArithTraits<y_value_type>::zero();
+      lens[l] = A.row_lengths(first + l);
+    }
+    for (ordinal_type j = 0; j < width; j++) {
+      const size_type k0 = offset + j * C;
+      // Padding entries have column 0 and are masked out, so that Inf/NaN in
+      // x(0) can't leak into rows which don't reference it
+#ifdef KOKKOS_ENABLE_PRAGMA_IVDEP
+#pragma ivdep
+#endif
+      for (ordinal_type l = 0; l < nlanes; l++) {
+        const y_value_type prod = getVal(k0 + l) * getX(A.entries(k0 + l));
+        sums[l] += (j < lens[l]) ? prod : y_value_type(0);
+      }
+    }
+    for (ordinal_type l = 0; l < nlanes; l++)
+      update(A.row_perm(first + l), sums[l]);
+  }
+};
+
+/// y := y + alpha * op(A) * x for a SellMatrix, op(A) = A^T or A^H. One
+/// thread per sorted row, scattering into y with atomics (y must have been
+/// scaled by beta already).
+template <class AMatrix, class XVector, class YVector, bool conjugate>
+struct SellSpmvTransposeFunctor {
+  using ordinal_type = typename AMatrix::non_const_ordinal_type;
+  using size_type    = typename AMatrix::non_const_size_type;
+  using value_type   = typename AMatrix::non_const_value_type;
+  using y_value_type = typename YVector::non_const_value_type;
+  using ATV          = Kokkos::ArithTraits<value_type>;
+
+  y_value_type alpha;
+  AMatrix A;
+  XVector x;
+  YVector y;
+  int col;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type i) const {
+    const int C             = A.chunkSize();
+    const size_type offset  = A.chunk_offsets(i / C) + i % C;
+    const ordinal_type len  = A.row_lengths(i);
+    const ordinal_type row  = A.row_perm(i);
+    y_value_type xval;
+    if constexpr (XVector::rank == 1)
+      xval = alpha * x(row);
+    else
+      xval = alpha * x(row, col);
+    for (ordinal_type j = 0; j < len; j++) {
+      const size_type k     = offset + j * C;
+      const value_type val  = conjugate ? ATV::conj(A.values(k)) : A.values(k);
+      const ordinal_type ci = A.entries(k);
+      if constexpr (YVector::rank == 1)
+        Kokkos::atomic_add(&y(ci), static_cast<y_value_type>(val * xval));
+      else
+        Kokkos::atomic_add(&y(ci, col), static_cast<y_value_type>(val * xval));
+    }
+  }
+};
+
+template <class ExecutionSpace, class AMatrix, class XVector, class YVector,
+          bool conjugate>
+void spmv_sell_no_transpose(const ExecutionSpace& space,
+                            typename YVector::const_value_type& alpha,
+                            const AMatrix& A, const XVector& x,
+                            typename YVector::const_value_type& beta,
+                            const YVector& y, int col) {
+  using ordinal_type = typename AMatrix::non_const_ordinal_type;
+  SellSpmvFunctor<AMatrix, XVector, YVector, conjugate> f{alpha, A,    x,
+                                                           beta,  y, col};
+  if constexpr (KokkosKernels::Impl::kk_is_gpu_exec_space<ExecutionSpace>()) {
+    Kokkos::parallel_for(
+        "KokkosSparse::spmv<SELL,NoTranspose>",
+        Kokkos::RangePolicy<ExecutionSpace, SellRowTag>(space, 0,
+                                                        A.numRows()),
+        f);
+  } else {
+    Kokkos::parallel_for("KokkosSparse::spmv<SELL,NoTranspose>",
+                         Kokkos::RangePolicy<ExecutionSpace, SellChunkTag>(
+                             space, 0, ordinal_type(A.numChunks())),
+                         f);
+  }
+}
+
+template <class ExecutionSpace, class AMatrix, class XVector, class YVector,
+          bool conjugate>
+void spmv_sell_transpose(const ExecutionSpace& space,
+                         typename YVector::const_value_type& alpha,
+                         const AMatrix& A, const XVector& x, const YVector& y,
+                         int col) {
+  SellSpmvTransposeFunctor<AMatrix, XVector, YVector, conjugate> f{alpha, A, x,
+                                                                   y, col};
+  Kokkos::parallel_for("KokkosSparse::spmv<SELL,Transpose>",
+                       Kokkos::RangePolicy<ExecutionSpace>(space, 0,
+                                                           A.numRows()),
+                       f);
+}
+
+/// Native SpMV for SellMatrix, for single vectors and multivectors (which are
+/// applied one column at a time).
+template <class ExecutionSpace, class AMatrix, class XVector, class YVector>
+void spmv_sell(const ExecutionSpace& space, const char mode[],
+               typename YVector::const_value_type& alpha, const AMatrix& A,
+               const XVector& x, typename YVector::const_value_type& beta,
+               const YVector& y) {
+  const bool transpose =
+      mode[0] == KokkosSparse::Transpose[0] ||
+      mode[0] == KokkosSparse::ConjugateTranspose[0];
+  const bool conjugate =
+      mode[0] == KokkosSparse::Conjugate[0] ||
+      mode[0] == KokkosSparse::ConjugateTranspose[0];
+  if (!transpose && !conjugate && mode[0] != KokkosSparse::NoTranspose[0]) {
+    std::stringstream ss;
+    ss << __FILE__ << ":" << __LINE__ << " Invalid transpose mode " << mode
+       << " for KokkosSparse::spmv() with a SellMatrix";
+    KokkosKernels::Impl::throw_runtime_exception(ss.str());
+  }
+  int numVecs = 1;
+  if constexpr (XVector::rank == 2) numVecs = x.extent(1);
+  if (transpose) {
+    // The transpose functor adds into y, so scale it first
+    KokkosBlas::scal(space, y, beta, y);
+  }
+  for (int col = 0; col < numVecs; col++) {
+    if (transpose) {
+      if (conjugate)
+        spmv_sell_transpose<ExecutionSpace, AMatrix, XVector, YVector, true>(
+            space, alpha, A, x, y, col);
+      else
+        spmv_sell_transpose<ExecutionSpace, AMatrix, XVector, YVector, false>(
+            space, alpha, A, x, y, col);
+    } else {
+      if (conjugate)
+        spmv_sell_no_transpose<ExecutionSpace, AMatrix, XVector, YVector,
+                               true>(space, alpha, A, x, beta, y, col);
+      else
+        spmv_sell_no_transpose<ExecutionSpace, AMatrix, XVector, YVector,
+                               false>(space, alpha, A, x, beta, y, col);
+    }
+  }
+}
+
+}  // namespace Impl
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPMV_SELL_IMPL_HPP_
@@ -0,0 +1,166 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_SPMV_SEMIRING_IMPL_HPP_
+#define KOKKOSSPARSE_SPMV_SEMIRING_IMPL_HPP_
+
+#include "KokkosKernels_ExecSpaceUtils.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_spmv_impl.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+
+/// Reducer joining with the add of a semiring, for the nested reductions
+/// over the entries of a row.
+template <class Semiring>
+struct SemiringReducer {
+  using reducer          = SemiringReducer;
+  using value_type       = typename Semiring::value_type;
+  using result_view_type = Kokkos::View<value_type, Kokkos::HostSpace,
+                                        Kokkos::MemoryUnmanaged>;
+
+  value_type* value;
+
+  KOKKOS_INLINE_FUNCTION SemiringReducer(value_type& value_) : value(&value_) {}
+
+  KOKKOS_INLINE_FUNCTION void join(value_type& dest,
+                                   const value_type& src) const {
+    dest = Semiring::add(dest, src);
+  }
+  KOKKOS_INLINE_FUNCTION void init(value_type& val) const {
+    val = Semiring::zero();
+  }
+  KOKKOS_INLINE_FUNCTION value_type& reference() const { return *value; }
+  KOKKOS_INLINE_FUNCTION result_view_type view() const {
+    return result_view_type(value);
+  }
+  KOKKOS_INLINE_FUNCTION bool references_scalar() const { return true; }
+};
+
+/// y(i) := add_j multiply(A(i, j), x(j)) over the entries of row i of A, or
+/// y(i) := add(y(i), ...) with accumulate. This is SPMV_Functor with the
+/// operations of a semiring.
+template <class execution_space, class Semiring, class AMatrix, class XVector,
+          class YVector>
+struct SPMV_Semiring_Functor {
+  typedef typename AMatrix::non_const_ordinal_type ordinal_type;
+  typedef typename Semiring::value_type value_type;
+  typedef typename Kokkos::TeamPolicy<execution_space> team_policy;
+  typedef typename team_policy::member_type team_member;
+
+  AMatrix m_A;
+  XVector m_x;
+  YVector m_y;
+  const bool accumulate;
+  const ordinal_type rows_per_team;
+
+  SPMV_Semiring_Functor(const AMatrix m_A_, const XVector m_x_,
+                        const YVector m_y_, const bool accumulate_,
+                        const int rows_per_team_)
+      : m_A(m_A_),
+        m_x(m_x_),
+        m_y(m_y_),
+        accumulate(accumulate_),
+        rows_per_team(rows_per_team_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void finish_row(const ordinal_type iRow, const value_type& sum) const {
+    m_y(iRow) = accumulate ? Semiring::add(value_type(m_y(iRow)), sum) : sum;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const ordinal_type iRow) const {
+    const KokkosSparse::SparseRowViewConst<AMatrix> row = m_A.rowConst(iRow);
+    const ordinal_type row_length = static_cast<ordinal_type>(row.length);
+    value_type sum                = Semiring::zero();
+
+    for (ordinal_type iEntry = 0; iEntry < row_length; iEntry++) {
+      sum = Semiring::add(sum, Semiring::multiply(value_type(row.value(iEntry)),
+                                                  m_x(row.colidx(iEntry))));
+    }
+    finish_row(iRow, sum);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const team_member& dev) const {
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(dev, 0, rows_per_team),
+        [&](const ordinal_type& loop) {
+          const ordinal_type iRow =
+              static_cast<ordinal_type>(dev.league_rank()) * rows_per_team +
+              loop;
+          if (iRow >= m_A.numRows()) {
+            return;
+          }
+          const KokkosSparse::SparseRowViewConst<AMatrix> row =
+              m_A.rowConst(iRow);
+          const ordinal_type row_length = static_cast<ordinal_type>(row.length);
+          value_type sum                = Semiring::zero();
+
+          Kokkos::parallel_reduce(
+              Kokkos::ThreadVectorRange(dev, row_length),
+              [&](const ordinal_type& iEntry, value_type& lsum) {
+                lsum = Semiring::add(
+                    lsum, Semiring::multiply(value_type(row.value(iEntry)),
+                                             m_x(row.colidx(iEntry))));
+              },
+              SemiringReducer<Semiring>(sum));
+
+          Kokkos::single(Kokkos::PerThread(dev),
+                         [&]() { finish_row(iRow, sum); });
+        });
+  }
+};
+
+/// Native y := A * x over a semiring, for a CrsMatrix and rank-1 x and y,
+/// with the launch parameters of the native no-transpose SpMV.
+template <class execution_space, class Semiring, class AMatrix, class XVector,
+          class YVector>
+void spmv_semiring_native(const execution_space& exec, const AMatrix& A,
+                          const XVector& x, const YVector& y,
+                          const bool accumulate) {
+  using functor_type = SPMV_Semiring_Functor<execution_space, Semiring,
+                                             AMatrix, XVector, YVector>;
+
+  if (A.numRows() <= 0) return;
+
+  if constexpr (KokkosKernels::Impl::kk_is_gpu_exec_space<execution_space>()) {
+    int team_size           = -1;
+    int vector_length       = -1;
+    int64_t rows_per_thread = -1;
+
+    int64_t rows_per_team = spmv_launch_parameters<execution_space>(
+        A.numRows(), A.nnz(), rows_per_thread, team_size, vector_length);
+    int64_t worksets = (y.extent(0) + rows_per_team - 1) / rows_per_team;
+
+    Kokkos::parallel_for(
+        "KokkosSparse::spmv_semiring",
+        Kokkos::TeamPolicy<execution_space>(exec, worksets, team_size,
+                                            vector_length),
+        functor_type(A, x, y, accumulate, rows_per_team));
+  } else {
+    Kokkos::parallel_for(
+        "KokkosSparse::spmv_semiring",
+        Kokkos::RangePolicy<execution_space>(exec, 0, A.numRows()),
+        functor_type(A, x, y, accumulate, 1));
+  }
+}
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPMV_SEMIRING_IMPL_HPP_
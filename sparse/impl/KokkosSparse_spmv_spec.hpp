@@ -25,6 +25,7 @@
 // Include the actual functors
 #if !defined(KOKKOSKERNELS_ETI_ONLY) || KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
 #include <KokkosSparse_spmv_impl.hpp>
+#include "KokkosSparse_spmv_mv_tiled_impl.hpp"
 #endif
 
 namespace KokkosSparse {
@@ -92,6 +93,54 @@ struct spmv_mv_eti_spec_avail {
     enum : bool { value = true };                                              \
   };
 
+// Mixed precision: A's values are MATRIX_SCALAR_TYPE (float or half_t), while
+// x, y, alpha and beta are double and the products are accumulated in double.
+#define KOKKOSSPARSE_SPMV_MIXED_ETI_SPEC_AVAIL(                                \
+    MATRIX_SCALAR_TYPE, ORDINAL_TYPE, OFFSET_TYPE, LAYOUT_TYPE,                \
+    EXEC_SPACE_TYPE, MEM_SPACE_TYPE)                                           \
+  template <>                                                                  \
+  struct spmv_eti_spec_avail<                                                  \
+      EXEC_SPACE_TYPE,                                                         \
+      KokkosSparse::Impl::SPMVHandleImpl<EXEC_SPACE_TYPE, MEM_SPACE_TYPE,      \
+                                         MATRIX_SCALAR_TYPE, OFFSET_TYPE,      \
+                                         ORDINAL_TYPE>,                        \
+      KokkosSparse::CrsMatrix<const MATRIX_SCALAR_TYPE, const ORDINAL_TYPE,    \
+                              Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>, \
+                              Kokkos::MemoryTraits<Kokkos::Unmanaged>,         \
+                              const OFFSET_TYPE>,                              \
+      Kokkos::View<                                                            \
+          double const*, LAYOUT_TYPE,                                          \
+          Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>,                     \
+          Kokkos::MemoryTraits<Kokkos::Unmanaged | Kokkos::RandomAccess>>,     \
+      Kokkos::View<double*, LAYOUT_TYPE,                                       \
+                   Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>,            \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>> {                 \
+    enum : bool { value = true };                                              \
+  };
+
+#define KOKKOSSPARSE_SPMV_MV_MIXED_ETI_SPEC_AVAIL(                             \
+    MATRIX_SCALAR_TYPE, ORDINAL_TYPE, OFFSET_TYPE, LAYOUT_TYPE,                \
+    EXEC_SPACE_TYPE, MEM_SPACE_TYPE)                                           \
+  template <>                                                                  \
+  struct spmv_mv_eti_spec_avail<                                               \
+      EXEC_SPACE_TYPE,                                                         \
+      KokkosSparse::Impl::SPMVHandleImpl<EXEC_SPACE_TYPE, MEM_SPACE_TYPE,      \
+                                         MATRIX_SCALAR_TYPE, OFFSET_TYPE,      \
+                                         ORDINAL_TYPE>,                        \
+      KokkosSparse::CrsMatrix<const MATRIX_SCALAR_TYPE, const ORDINAL_TYPE,    \
+                              Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>, \
+                              Kokkos::MemoryTraits<Kokkos::Unmanaged>,         \
+                              const OFFSET_TYPE>,                              \
+      Kokkos::View<                                                            \
+          double const**, LAYOUT_TYPE,                                         \
+          Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>,                     \
+          Kokkos::MemoryTraits<Kokkos::Unmanaged | Kokkos::RandomAccess>>,     \
+      Kokkos::View<double**, LAYOUT_TYPE,                                      \
+                   Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>,            \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>> {                 \
+    enum : bool { value = true };                                              \
+  };
+
 // Include the actual specialization declarations
 #include <KokkosSparse_spmv_tpl_spec_avail.hpp>
 #include <generated_specializations_hpp/KokkosSparse_spmv_eti_spec_avail.hpp>
@@ -99,6 +148,9 @@ struct spmv_mv_eti_spec_avail {
 #include <KokkosSparse_spmv_mv_tpl_spec_avail.hpp>
 #include <generated_specializations_hpp/KokkosSparse_spmv_mv_eti_spec_avail.hpp>
 
+#include <generated_specializations_hpp/KokkosSparse_spmv_mixed_eti_spec_avail.hpp>
+#include <generated_specializations_hpp/KokkosSparse_spmv_mv_mixed_eti_spec_avail.hpp>
+
 namespace KokkosSparse {
 namespace Impl {
 
@@ -237,6 +289,10 @@ struct SPMV_MV<ExecutionSpace, Handle, AMatrix, XVector, YVector, false, false,
         spmv_beta<ExecutionSpace, Handle, AMatrix, decltype(x0), decltype(y0),
                   2>(space, handle, mode, alpha, A, x0, beta, y0);
       }
+    } else if (handle->algo == SPMV_MV_TILED &&
+               (mode[0] == NoTranspose[0] || mode[0] == Conjugate[0])) {
+      SpmvMvTiled<ExecutionSpace, AMatrix, XVector, YVector>::spmv(
+          space, mode, alpha, A, x, beta, y);
     } else {
       if (alpha == KAT::zero()) {
         spmv_alpha_mv<ExecutionSpace, AMatrix, XVector, YVector, 0>(
@@ -374,6 +430,90 @@ struct SPMV_MV<ExecutionSpace, Handle, AMatrix, XVector, YVector, true, false,
                    Kokkos::MemoryTraits<Kokkos::Unmanaged>>,                   \
       std::is_integral_v<SCALAR_TYPE>, false, true>;
 
+#define KOKKOSSPARSE_SPMV_MIXED_ETI_SPEC_DECL(                                 \
+    MATRIX_SCALAR_TYPE, ORDINAL_TYPE, OFFSET_TYPE, LAYOUT_TYPE,                \
+    EXEC_SPACE_TYPE, MEM_SPACE_TYPE)                                           \
+  extern template struct SPMV<                                                 \
+      EXEC_SPACE_TYPE,                                                         \
+      KokkosSparse::Impl::SPMVHandleImpl<EXEC_SPACE_TYPE, MEM_SPACE_TYPE,      \
+                                         MATRIX_SCALAR_TYPE, OFFSET_TYPE,      \
+                                         ORDINAL_TYPE>,                        \
+      KokkosSparse::CrsMatrix<const MATRIX_SCALAR_TYPE, const ORDINAL_TYPE,    \
+                              Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>, \
+                              Kokkos::MemoryTraits<Kokkos::Unmanaged>,         \
+                              const OFFSET_TYPE>,                              \
+      Kokkos::View<                                                            \
+          double const*, LAYOUT_TYPE,                                          \
+          Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>,                     \
+          Kokkos::MemoryTraits<Kokkos::Unmanaged | Kokkos::RandomAccess>>,     \
+      Kokkos::View<double*, LAYOUT_TYPE,                                       \
+                   Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>,            \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,                   \
+      false, true>;
+
+#define KOKKOSSPARSE_SPMV_MIXED_ETI_SPEC_INST(                                 \
+    MATRIX_SCALAR_TYPE, ORDINAL_TYPE, OFFSET_TYPE, LAYOUT_TYPE,                \
+    EXEC_SPACE_TYPE, MEM_SPACE_TYPE)                                           \
+  template struct SPMV<                                                        \
+      EXEC_SPACE_TYPE,                                                         \
+      KokkosSparse::Impl::SPMVHandleImpl<EXEC_SPACE_TYPE, MEM_SPACE_TYPE,      \
+                                         MATRIX_SCALAR_TYPE, OFFSET_TYPE,      \
+                                         ORDINAL_TYPE>,                        \
+      KokkosSparse::CrsMatrix<const MATRIX_SCALAR_TYPE, const ORDINAL_TYPE,    \
+                              Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>, \
+                              Kokkos::MemoryTraits<Kokkos::Unmanaged>,         \
+                              const OFFSET_TYPE>,                              \
+      Kokkos::View<                                                            \
+          double const*, LAYOUT_TYPE,                                          \
+          Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>,                     \
+          Kokkos::MemoryTraits<Kokkos::Unmanaged | Kokkos::RandomAccess>>,     \
+      Kokkos::View<double*, LAYOUT_TYPE,                                       \
+                   Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>,            \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,                   \
+      false, true>;
+
+#define KOKKOSSPARSE_SPMV_MV_MIXED_ETI_SPEC_DECL(                              \
+    MATRIX_SCALAR_TYPE, ORDINAL_TYPE, OFFSET_TYPE, LAYOUT_TYPE,                \
+    EXEC_SPACE_TYPE, MEM_SPACE_TYPE)                                           \
+  extern template struct SPMV_MV<                                              \
+      EXEC_SPACE_TYPE,                                                         \
+      KokkosSparse::Impl::SPMVHandleImpl<EXEC_SPACE_TYPE, MEM_SPACE_TYPE,      \
+                                         MATRIX_SCALAR_TYPE, OFFSET_TYPE,      \
+                                         ORDINAL_TYPE>,                        \
+      KokkosSparse::CrsMatrix<const MATRIX_SCALAR_TYPE, const ORDINAL_TYPE,    \
+                              Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>, \
+                              Kokkos::MemoryTraits<Kokkos::Unmanaged>,         \
+                              const OFFSET_TYPE>,                              \
+      Kokkos::View<                                                            \
+          double const**, LAYOUT_TYPE,                                         \
+          Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>,                     \
+          Kokkos::MemoryTraits<Kokkos::Unmanaged | Kokkos::RandomAccess>>,     \
+      Kokkos::View<double**, LAYOUT_TYPE,                                      \
+                   Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>,            \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,                   \
+      false, false, true>;
+
+#define KOKKOSSPARSE_SPMV_MV_MIXED_ETI_SPEC_INST(                              \
+    MATRIX_SCALAR_TYPE, ORDINAL_TYPE, OFFSET_TYPE, LAYOUT_TYPE,                \
+    EXEC_SPACE_TYPE, MEM_SPACE_TYPE)                                           \
+  template struct SPMV_MV<                                                     \
+      EXEC_SPACE_TYPE,                                                         \
+      KokkosSparse::Impl::SPMVHandleImpl<EXEC_SPACE_TYPE, MEM_SPACE_TYPE,      \
+                                         MATRIX_SCALAR_TYPE, OFFSET_TYPE,      \
+                                         ORDINAL_TYPE>,                        \
+      KokkosSparse::CrsMatrix<const MATRIX_SCALAR_TYPE, const ORDINAL_TYPE,    \
+                              Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>, \
+                              Kokkos::MemoryTraits<Kokkos::Unmanaged>,         \
+                              const OFFSET_TYPE>,                              \
+      Kokkos::View<                                                            \
+          double const**, LAYOUT_TYPE,                                         \
+          Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>,                     \
+          Kokkos::MemoryTraits<Kokkos::Unmanaged | Kokkos::RandomAccess>>,     \
+      Kokkos::View<double**, LAYOUT_TYPE,                                      \
+                   Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>,            \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>,                   \
+      false, false, true>;
+
 #include <KokkosSparse_spmv_tpl_spec_decl.hpp>
 
 #include <KokkosSparse_spmv_mv_tpl_spec_decl.hpp>
@@ -0,0 +1,233 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_SPMV_STENCIL_IMPL_HPP_
+#define KOKKOSSPARSE_SPMV_STENCIL_IMPL_HPP_
+
+#include <sstream>
+
+#include "Kokkos_ArithTraits.hpp"
+#include "KokkosKernels_ExecSpaceUtils.hpp"
+#include "KokkosKernels_Error.hpp"
+#include "KokkosSparse_StencilMatrix.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+namespace Impl {
+
+/// y := beta * y + alpha * op(A) * x for a StencilMatrix.
+///
+/// Each team handles a tile of lines_per_team consecutive grid lines (fixed
+/// j and k) in one k-plane; its threads take the lines and its vector lanes
+/// the points of a line, so consecutive lanes read consecutive entries of x,
+/// y and values. Teams are ordered with k fastest, so on CPUs a thread walks
+/// the tile through consecutive planes and finds the planes k - 1 and k
+/// still in cache. The offsets (and constant coefficients) are kept in team
+/// scratch.
+///
+/// The transpose is a gather as well: row r of A^T takes coefficient p from
+/// row r - offset(p), so no atomics are needed. Points whose whole
+/// neighborhood is inside the grid skip the bounds checks.
+template <class ExecutionSpace, class AMatrix, class XVector, class YVector,
+          bool transpose, bool conjugate>
+struct StencilSpmvFunctor {
+  using ordinal_type  = typename AMatrix::non_const_ordinal_type;
+  using value_type    = typename AMatrix::non_const_value_type;
+  using y_value_type  = typename YVector::non_const_value_type;
+  using ATV           = Kokkos::ArithTraits<value_type>;
+  using team_policy   = Kokkos::TeamPolicy<ExecutionSpace>;
+  using team_member   = typename team_policy::member_type;
+  using scratch_space = typename ExecutionSpace::scratch_memory_space;
+  using shared_ordinal_1d =
+      Kokkos::View<ordinal_type*, scratch_space,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+  using shared_int_2d =
+      Kokkos::View<int* [3], scratch_space,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+  using shared_value_1d =
+      Kokkos::View<value_type*, scratch_space,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+  y_value_type alpha;
+  AMatrix A;
+  XVector x;
+  y_value_type beta;
+  YVector y;
+  // Index of the column of x/y (0 for single vectors)
+  int col;
+  ordinal_type lines_per_team;
+
+  static size_t team_shmem_size(const int numPoints) {
+    return shared_int_2d::shmem_size(numPoints) +
+           shared_ordinal_1d::shmem_size(numPoints) +
+           shared_value_1d::shmem_size(numPoints);
+  }
+
+  // Whether every neighbor of a point at index idx in direction d is inside
+  // the grid
+  KOKKOS_INLINE_FUNCTION bool interior(const int d,
+                                       const ordinal_type idx) const {
+    if (transpose)
+      return idx >= A.offsetMax(d) && idx < A.gridExtent(d) + A.offsetMin(d);
+    else
+      return idx >= -A.offsetMin(d) && idx < A.gridExtent(d) - A.offsetMax(d);
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const team_member& dev) const {
+    const int numPoints   = A.numStencilPoints();
+    const bool constant   = A.isConstantCoefficient();
+    const ordinal_type ni = A.gridExtent(0);
+    const ordinal_type nj = A.gridExtent(1);
+    const ordinal_type nk = A.gridExtent(2);
+
+    shared_int_2d offs(dev.team_scratch(0), numPoints);
+    shared_ordinal_1d linear(dev.team_scratch(0), numPoints);
+    shared_value_1d coefs(dev.team_scratch(0), numPoints);
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(dev, numPoints),
+                         [&](const int p) {
+                           for (int d = 0; d < 3; d++)
+                             offs(p, d) = A.offsets(p, d);
+                           linear(p) = A.offsets(p, 0) +
+                                       ni * (A.offsets(p, 1) +
+                                             nj * A.offsets(p, 2));
+                           if (constant) coefs(p) = A.values(0, p);
+                         });
+    dev.team_barrier();
+
+    const ordinal_type k    = dev.league_rank() % nk;
+    const ordinal_type jBeg = (dev.league_rank() / nk) * lines_per_team;
+    const ordinal_type jEnd =
+        KOKKOSKERNELS_MACRO_MIN(jBeg + lines_per_team, nj);
+    const int sign = transpose ? -1 : 1;
+
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(dev, jBeg, jEnd), [&](const ordinal_type j) {
+          const bool lineInterior   = interior(1, j) && interior(2, k);
+          const ordinal_type rowBeg = ni * (j + nj * k);
+          Kokkos::parallel_for(
+              Kokkos::ThreadVectorRange(dev, ni), [&](const ordinal_type i) {
+                const ordinal_type r = rowBeg + i;
+                const bool inside    = lineInterior && interior(0, i);
+
+                y_value_type sum = Kokkos::ArithTraits<y_value_type>::zero();
+                for (int p = 0; p < numPoints; p++) {
+                  if (!inside) {
+                    const ordinal_type ii = i + sign * offs(p, 0);
+                    const ordinal_type jj = j + sign * offs(p, 1);
+                    const ordinal_type kk = k + sign * offs(p, 2);
+                    if (ii < 0 || ii >= ni || jj < 0 || jj >= nj || kk < 0 ||
+                        kk >= nk)
+                      continue;
+                  }
+                  // The neighbor, and the row whose coefficient p is used
+                  const ordinal_type nbr = r + sign * linear(p);
+                  const ordinal_type src = transpose ? nbr : r;
+                  value_type a = constant ? coefs(p) : A.values(src, p);
+                  if (conjugate) a = ATV::conj(a);
+                  if constexpr (XVector::rank == 1)
+                    sum += static_cast<y_value_type>(a) * x(nbr);
+                  else
+                    sum += static_cast<y_value_type>(a) * x(nbr, col);
+                }
+                y_value_type* yp;
+                if constexpr (YVector::rank == 1)
+                  yp = &y(r);
+                else
+                  yp = &y(r, col);
+                if (beta == Kokkos::ArithTraits<y_value_type>::zero())
+                  *yp = alpha * sum;
+                else
+                  *yp = beta * *yp + alpha * sum;
+              });
+        });
+  }
+};
+
+template <class ExecutionSpace, class AMatrix, class XVector, class YVector,
+          bool transpose, bool conjugate>
+void spmv_stencil_launch(const ExecutionSpace& space,
+                         typename YVector::const_value_type& alpha,
+                         const AMatrix& A, const XVector& x,
+                         typename YVector::const_value_type& beta,
+                         const YVector& y) {
+  using functor_type = StencilSpmvFunctor<ExecutionSpace, AMatrix, XVector,
+                                          YVector, transpose, conjugate>;
+  using ordinal_type = typename AMatrix::non_const_ordinal_type;
+  using policy_type  = typename functor_type::team_policy;
+
+  // On GPUs, a team of 4 lines with up to 32 lanes each; on CPUs one thread
+  // per tile of 8 lines (a few planes of such a tile fit in L2)
+  constexpr bool onGPU =
+      KokkosKernels::Impl::kk_is_gpu_exec_space<ExecutionSpace>();
+  const ordinal_type lines_per_team = onGPU ? 4 : 8;
+  int vector_length                 = 1;
+  if constexpr (onGPU) {
+    const ordinal_type ni = A.gridExtent(0);
+    while (vector_length < 32 && vector_length < ni) vector_length *= 2;
+    vector_length = KOKKOSKERNELS_MACRO_MIN(vector_length,
+                                            policy_type::vector_length_max());
+  }
+  const ordinal_type nj     = A.gridExtent(1);
+  const ordinal_type nk     = A.gridExtent(2);
+  const ordinal_type tilesJ = (nj + lines_per_team - 1) / lines_per_team;
+
+  const size_t shmem = functor_type::team_shmem_size(A.numStencilPoints());
+
+  int numVecs = 1;
+  if constexpr (XVector::rank == 2) numVecs = x.extent(1);
+  for (int col = 0; col < numVecs; col++) {
+    functor_type f{alpha, A, x, beta, y, col, lines_per_team};
+    policy_type policy(space, tilesJ * nk, onGPU ? lines_per_team : 1,
+                       vector_length);
+    Kokkos::parallel_for(
+        transpose ? "KokkosSparse::spmv<Stencil,Transpose>"
+                  : "KokkosSparse::spmv<Stencil,NoTranspose>",
+        policy.set_scratch_size(0, Kokkos::PerTeam(shmem)), f);
+  }
+}
+
+/// Native SpMV for StencilMatrix, for single vectors and multivectors (which
+/// are applied one column at a time).
+template <class ExecutionSpace, class AMatrix, class XVector, class YVector>
+void spmv_stencil(const ExecutionSpace& space, const char mode[],
+                  typename YVector::const_value_type& alpha, const AMatrix& A,
+                  const XVector& x, typename YVector::const_value_type& beta,
+                  const YVector& y) {
+  if (mode[0] == KokkosSparse::NoTranspose[0]) {
+    spmv_stencil_launch<ExecutionSpace, AMatrix, XVector, YVector, false,
+                        false>(space, alpha, A, x, beta, y);
+  } else if (mode[0] == KokkosSparse::Conjugate[0]) {
+    spmv_stencil_launch<ExecutionSpace, AMatrix, XVector, YVector, false,
+                        true>(space, alpha, A, x, beta, y);
+  } else if (mode[0] == KokkosSparse::Transpose[0]) {
+    spmv_stencil_launch<ExecutionSpace, AMatrix, XVector, YVector, true,
+                        false>(space, alpha, A, x, beta, y);
+  } else if (mode[0] == KokkosSparse::ConjugateTranspose[0]) {
+    spmv_stencil_launch<ExecutionSpace, AMatrix, XVector, YVector, true, true>(
+        space, alpha, A, x, beta, y);
+  } else {
+    std::stringstream ss;
+    ss << __FILE__ << ":" << __LINE__ << " Invalid transpose mode " << mode
+       << " for KokkosSparse::spmv() with a StencilMatrix";
+    KokkosKernels::Impl::throw_runtime_exception(ss.str());
+  }
+}
+
+}  // namespace Impl
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPMV_STENCIL_IMPL_HPP_
@@ -179,6 +179,9 @@ struct SPMV_STRUCT<ExecutionSpace, AMatrix, XVector, YVector, false,
       return;
     }
 
+    Kokkos::Profiling::pushRegion(KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+                                      ? "KokkosSparse::spmv_struct[ETI]"
+                                      : "KokkosSparse::spmv_struct[noETI]");
     if (beta == KAT::zero()) {
       spmv_struct_beta<ExecutionSpace, AMatrix, XVector, YVector, 0>(
           space, mode, stencil_type, structure, alpha, A, x, beta, y);
@@ -192,6 +195,7 @@ struct SPMV_STRUCT<ExecutionSpace, AMatrix, XVector, YVector, false,
       spmv_struct_beta<ExecutionSpace, AMatrix, XVector, YVector, 2>(
           space, mode, stencil_type, structure, alpha, A, x, beta, y);
     }
+    Kokkos::Profiling::popRegion();
   }
 };
 
@@ -208,6 +212,9 @@ struct SPMV_MV_STRUCT<ExecutionSpace, AMatrix, XVector, YVector, false, false,
                              const YVector& y) {
     typedef Kokkos::ArithTraits<coefficient_type> KAT;
 
+    Kokkos::Profiling::pushRegion(KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+                                      ? "KokkosSparse::spmv_mv_struct[ETI]"
+                                      : "KokkosSparse::spmv_mv_struct[noETI]");
     if (alpha == KAT::zero()) {
       spmv_alpha_mv_struct<ExecutionSpace, AMatrix, XVector, YVector, 0>(
           space, mode, alpha, A, x, beta, y);
@@ -221,6 +228,7 @@ struct SPMV_MV_STRUCT<ExecutionSpace, AMatrix, XVector, YVector, false, false,
       spmv_alpha_mv_struct<ExecutionSpace, AMatrix, XVector, YVector, 2>(
           space, mode, alpha, A, x, beta, y);
     }
+    Kokkos::Profiling::popRegion();
   }
 };
 
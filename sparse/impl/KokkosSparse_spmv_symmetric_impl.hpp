@@ -0,0 +1,199 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_SPMV_SYMMETRIC_IMPL_HPP_
+#define KOKKOSSPARSE_SPMV_SYMMETRIC_IMPL_HPP_
+
+#include "Kokkos_ArithTraits.hpp"
+#include "KokkosKernels_Handle.hpp"
+#include "KokkosKernels_SimpleUtils.hpp"
+#include "KokkosKernels_Utils.hpp"
+#include "KokkosGraph_Distance2Color.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+namespace Impl {
+
+/// Count the off-diagonal entries of each row of A.
+template <class RowMap, class Entries, class OutRowMap>
+struct SymmetricSpmvCountOffDiag {
+  using ordinal_type = typename Entries::non_const_value_type;
+
+  RowMap rowmap;
+  Entries entries;
+  OutRowMap counts;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type i) const {
+    typename OutRowMap::non_const_value_type count = 0;
+    for (auto k = rowmap(i); k < rowmap(i + 1); k++) {
+      if (entries(k) != i) count++;
+    }
+    counts(i) = count;
+  }
+};
+
+/// Copy the column indices of the off-diagonal entries of each row of A.
+template <class RowMap, class Entries, class OutRowMap, class OutEntries>
+struct SymmetricSpmvFillOffDiag {
+  using ordinal_type = typename Entries::non_const_value_type;
+
+  RowMap rowmap;
+  Entries entries;
+  OutRowMap out_rowmap;
+  OutEntries out_entries;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type i) const {
+    auto out = out_rowmap(i);
+    for (auto k = rowmap(i); k < rowmap(i + 1); k++) {
+      if (entries(k) != i) out_entries(out++) = entries(k);
+    }
+  }
+};
+
+/// The mirrored half of symmetric SpMV: for each row i in one color set and
+/// each off-diagonal entry a_ij, y(j) += alpha * op(a_ij) * x(i), where op is
+/// conj for Hermitian matrices. Rows of the same color have no column in
+/// common, so no two threads update the same y(j).
+template <class AMatrix, class XVector, class YVector, class RowsView,
+          bool conjugate>
+struct SymmetricSpmvScatterFunctor {
+  using ordinal_type = typename AMatrix::non_const_ordinal_type;
+  using value_type   = typename AMatrix::non_const_value_type;
+  using y_value_type = typename YVector::non_const_value_type;
+  using ATV          = Kokkos::ArithTraits<value_type>;
+
+  y_value_type alpha;
+  AMatrix A;
+  XVector x;
+  YVector y;
+  RowsView rows;
+  ordinal_type color_begin;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type k) const {
+    const ordinal_type i    = rows(color_begin + k);
+    const auto row          = A.rowConst(i);
+    const y_value_type xval = alpha * x(i);
+    for (ordinal_type e = 0; e < row.length; e++) {
+      const ordinal_type j = row.colidx(e);
+      if (j == i) continue;
+      const value_type val = conjugate ? ATV::conj(row.value(e)) : row.value(e);
+      y(j) += static_cast<y_value_type>(val) * xval;
+    }
+  }
+};
+
+/// Color the rows of A so that rows sharing a column of an off-diagonal
+/// entry have different colors, and store the rows of each color in handle.
+template <class ExecutionSpace, class Handle, class AMatrix>
+void spmv_symmetric_setup(const ExecutionSpace& space, Handle* handle,
+                          const AMatrix& A) {
+  using ordinal_type = typename AMatrix::non_const_ordinal_type;
+  using size_type    = typename AMatrix::non_const_size_type;
+  using value_type   = typename AMatrix::non_const_value_type;
+  using mem_space    = typename AMatrix::memory_space;
+  using rowmap_t     = Kokkos::View<size_type*, mem_space>;
+  using entries_t    = Kokkos::View<ordinal_type*, mem_space>;
+  using range_policy = Kokkos::RangePolicy<ExecutionSpace>;
+  using KernelHandle = KokkosKernels::Experimental::KokkosKernelsHandle<
+      size_type, ordinal_type, value_type, ExecutionSpace, mem_space,
+      mem_space>;
+
+  const ordinal_type nrows = A.numRows();
+
+  // Graph of the off-diagonal entries of A only: the diagonal is applied by
+  // the row-wise SpMV and must not restrict the coloring
+  rowmap_t offdiag_rowmap("offdiag rowmap", nrows + 1);
+  Kokkos::parallel_for(
+      "KokkosSparse::spmv_symmetric::CountOffDiag",
+      range_policy(space, 0, nrows),
+      SymmetricSpmvCountOffDiag<typename AMatrix::row_map_type,
+                                typename AMatrix::index_type, rowmap_t>{
+          A.graph.row_map, A.graph.entries, offdiag_rowmap});
+  size_type offdiag_nnz = 0;
+  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum<ExecutionSpace>(
+      space, nrows + 1, offdiag_rowmap, offdiag_nnz);
+  entries_t offdiag_entries(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "offdiag entries"),
+      offdiag_nnz);
+  Kokkos::parallel_for(
+      "KokkosSparse::spmv_symmetric::FillOffDiag",
+      range_policy(space, 0, nrows),
+      SymmetricSpmvFillOffDiag<typename AMatrix::row_map_type,
+                               typename AMatrix::index_type, rowmap_t,
+                               entries_t>{A.graph.row_map, A.graph.entries,
+                                          offdiag_rowmap, offdiag_entries});
+  space.fence();
+
+  KernelHandle kh;
+  kh.create_distance2_graph_coloring_handle();
+  KokkosGraph::Experimental::bipartite_color_rows(
+      &kh, nrows, A.numCols(), offdiag_rowmap, offdiag_entries);
+  auto gch_d2        = kh.get_distance2_graph_coloring_handle();
+  auto colors        = gch_d2->get_vertex_colors();
+  handle->num_colors = gch_d2->get_num_colors();
+
+  typename Handle::rows_view_t color_xadj;
+  KokkosKernels::Impl::create_reverse_map<decltype(colors),
+                                          typename Handle::rows_view_t,
+                                          ExecutionSpace>(
+      space, nrows, handle->num_colors, colors, color_xadj,
+      handle->color_rows);
+  handle->color_offsets = Kokkos::create_mirror_view(color_xadj);
+  Kokkos::deep_copy(handle->color_offsets, color_xadj);
+  kh.destroy_distance2_graph_coloring_handle();
+  handle->is_set_up = true;
+}
+
+/// y := y + alpha * op(T)^T * x, where T is the stored triangle of A without
+/// its diagonal, one color set at a time.
+template <class ExecutionSpace, class Handle, class AMatrix, class XVector,
+          class YVector>
+void spmv_symmetric_scatter(const ExecutionSpace& space, Handle* handle,
+                            bool hermitian,
+                            typename YVector::const_value_type& alpha,
+                            const AMatrix& A, const XVector& x,
+                            const YVector& y) {
+  using ordinal_type = typename AMatrix::non_const_ordinal_type;
+  using rows_view_t  = typename Handle::rows_view_t;
+  using range_policy = Kokkos::RangePolicy<ExecutionSpace>;
+  for (ordinal_type c = 0; c < handle->num_colors; c++) {
+    const ordinal_type begin = handle->color_offsets(c);
+    const ordinal_type end   = handle->color_offsets(c + 1);
+    if (begin == end) continue;
+    if (hermitian) {
+      Kokkos::parallel_for(
+          "KokkosSparse::spmv_symmetric::Scatter",
+          range_policy(space, 0, end - begin),
+          SymmetricSpmvScatterFunctor<AMatrix, XVector, YVector, rows_view_t,
+                                      true>{alpha, A, x, y,
+                                            handle->color_rows, begin});
+    } else {
+      Kokkos::parallel_for(
+          "KokkosSparse::spmv_symmetric::Scatter",
+          range_policy(space, 0, end - begin),
+          SymmetricSpmvScatterFunctor<AMatrix, XVector, YVector, rows_view_t,
+                                      false>{alpha, A, x, y,
+                                             handle->color_rows, begin});
+    }
+  }
+}
+
+}  // namespace Impl
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPMV_SYMMETRIC_IMPL_HPP_
@@ -0,0 +1,196 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_SPMV_VBR_IMPL_HPP_
+#define KOKKOSSPARSE_SPMV_VBR_IMPL_HPP_
+
+#include <sstream>
+
+#include "Kokkos_ArithTraits.hpp"
+#include "KokkosBlas1_scal.hpp"
+#include "KokkosKernels_Error.hpp"
+#include "KokkosSparse_VbrMatrix.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+namespace Impl {
+
+/// y := beta * y + alpha * op(A) * x for a VbrMatrix, op(A) = A or conj(A).
+/// One team per block row and one thread per point row of it, which walks the
+/// dense rows of the blocks of its block row.
+template <class ExecutionSpace, class AMatrix, class XVector, class YVector,
+          bool conjugate>
+struct VbrSpmvFunctor {
+  using ordinal_type = typename AMatrix::non_const_ordinal_type;
+  using size_type    = typename AMatrix::non_const_size_type;
+  using value_type   = typename AMatrix::non_const_value_type;
+  using y_value_type = typename YVector::non_const_value_type;
+  using ATV          = Kokkos::ArithTraits<value_type>;
+  using team_member  = typename Kokkos::TeamPolicy<ExecutionSpace>::member_type;
+
+  y_value_type alpha;
+  AMatrix A;
+  XVector x;
+  y_value_type beta;
+  YVector y;
+  // Index of the column of x/y (0 for single vectors)
+  int col;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const team_member& t) const {
+    const ordinal_type I        = t.league_rank();
+    const ordinal_type firstRow = A.row_partition(I);
+    const ordinal_type height   = A.row_partition(I + 1) - firstRow;
+    const size_type kbegin      = A.block_row_map(I);
+    const size_type kend        = A.block_row_map(I + 1);
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(t, height), [&](int i) {
+      y_value_type sum = Kokkos::ArithTraits<y_value_type>::zero();
+      for (size_type K = kbegin; K < kend; K++) {
+        const ordinal_type J        = A.block_entries(K);
+        const ordinal_type firstCol = A.col_partition(J);
+        const ordinal_type width    = A.col_partition(J + 1) - firstCol;
+        const size_type off         = A.block_value_offsets(K) + i * width;
+        for (ordinal_type j = 0; j < width; j++) {
+          const value_type val =
+              conjugate ? ATV::conj(A.values(off + j)) : A.values(off + j);
+          if constexpr (XVector::rank == 1)
+            sum += static_cast<y_value_type>(val) * x(firstCol + j);
+          else
+            sum += static_cast<y_value_type>(val) * x(firstCol + j, col);
+        }
+      }
+      y_value_type* yp;
+      if constexpr (YVector::rank == 1)
+        yp = &y(firstRow + i);
+      else
+        yp = &y(firstRow + i, col);
+      if (beta == Kokkos::ArithTraits<y_value_type>::zero())
+        *yp = alpha * sum;
+      else
+        *yp = beta * *yp + alpha * sum;
+    });
+  }
+};
+
+/// y := y + alpha * op(A) * x for a VbrMatrix, op(A) = A^T or A^H. Same
+/// decomposition as VbrSpmvFunctor, scattering into y with atomics (y must
+/// have been scaled by beta already).
+template <class ExecutionSpace, class AMatrix, class XVector, class YVector,
+          bool conjugate>
+struct VbrSpmvTransposeFunctor {
+  using ordinal_type = typename AMatrix::non_const_ordinal_type;
+  using size_type    = typename AMatrix::non_const_size_type;
+  using value_type   = typename AMatrix::non_const_value_type;
+  using y_value_type = typename YVector::non_const_value_type;
+  using ATV          = Kokkos::ArithTraits<value_type>;
+  using team_member  = typename Kokkos::TeamPolicy<ExecutionSpace>::member_type;
+
+  y_value_type alpha;
+  AMatrix A;
+  XVector x;
+  YVector y;
+  int col;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const team_member& t) const {
+    const ordinal_type I        = t.league_rank();
+    const ordinal_type firstRow = A.row_partition(I);
+    const ordinal_type height   = A.row_partition(I + 1) - firstRow;
+    const size_type kbegin      = A.block_row_map(I);
+    const size_type kend        = A.block_row_map(I + 1);
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(t, height), [&](int i) {
+      y_value_type xval;
+      if constexpr (XVector::rank == 1)
+        xval = alpha * x(firstRow + i);
+      else
+        xval = alpha * x(firstRow + i, col);
+      for (size_type K = kbegin; K < kend; K++) {
+        const ordinal_type J        = A.block_entries(K);
+        const ordinal_type firstCol = A.col_partition(J);
+        const ordinal_type width    = A.col_partition(J + 1) - firstCol;
+        const size_type off         = A.block_value_offsets(K) + i * width;
+        for (ordinal_type j = 0; j < width; j++) {
+          const value_type val =
+              conjugate ? ATV::conj(A.values(off + j)) : A.values(off + j);
+          if constexpr (YVector::rank == 1)
+            Kokkos::atomic_add(&y(firstCol + j),
+                               static_cast<y_value_type>(val * xval));
+          else
+            Kokkos::atomic_add(&y(firstCol + j, col),
+                               static_cast<y_value_type>(val * xval));
+        }
+      }
+    });
+  }
+};
+
+/// Native SpMV for VbrMatrix, for single vectors and multivectors (which are
+/// applied one column at a time).
+template <class ExecutionSpace, class AMatrix, class XVector, class YVector>
+void spmv_vbr(const ExecutionSpace& space, const char mode[],
+              typename YVector::const_value_type& alpha, const AMatrix& A,
+              const XVector& x, typename YVector::const_value_type& beta,
+              const YVector& y) {
+  using policy_type = Kokkos::TeamPolicy<ExecutionSpace>;
+  const bool transpose =
+      mode[0] == KokkosSparse::Transpose[0] ||
+      mode[0] == KokkosSparse::ConjugateTranspose[0];
+  const bool conjugate =
+      mode[0] == KokkosSparse::Conjugate[0] ||
+      mode[0] == KokkosSparse::ConjugateTranspose[0];
+  if (!transpose && !conjugate && mode[0] != KokkosSparse::NoTranspose[0]) {
+    std::stringstream ss;
+    ss << __FILE__ << ":" << __LINE__ << " Invalid transpose mode " << mode
+       << " for KokkosSparse::spmv() with a VbrMatrix";
+    KokkosKernels::Impl::throw_runtime_exception(ss.str());
+  }
+  int numVecs = 1;
+  if constexpr (XVector::rank == 2) numVecs = x.extent(1);
+  if (transpose) {
+    // The transpose functor adds into y, so scale it first
+    KokkosBlas::scal(space, y, beta, y);
+  }
+  const policy_type policy(space, A.numBlockRows(), Kokkos::AUTO);
+  for (int col = 0; col < numVecs; col++) {
+    if (transpose) {
+      if (conjugate)
+        Kokkos::parallel_for("KokkosSparse::spmv<Vbr,Transpose>", policy,
+                             VbrSpmvTransposeFunctor<ExecutionSpace, AMatrix,
+                                                     XVector, YVector, true>{
+                                 alpha, A, x, y, col});
+      else
+        Kokkos::parallel_for("KokkosSparse::spmv<Vbr,Transpose>", policy,
+                             VbrSpmvTransposeFunctor<ExecutionSpace, AMatrix,
+                                                     XVector, YVector, false>{
+                                 alpha, A, x, y, col});
+    } else {
+      if (conjugate)
+        Kokkos::parallel_for(
+            "KokkosSparse::spmv<Vbr,NoTranspose>", policy,
+            VbrSpmvFunctor<ExecutionSpace, AMatrix, XVector, YVector, true>{
+                alpha, A, x, beta, y, col});
+      else
+        Kokkos::parallel_for(
+            "KokkosSparse::spmv<Vbr,NoTranspose>", policy,
+            VbrSpmvFunctor<ExecutionSpace, AMatrix, XVector, YVector, false>{
+                alpha, A, x, beta, y, col});
+    }
+  }
+}
+
+}  // namespace Impl
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPMV_VBR_IMPL_HPP_
@@ -0,0 +1,181 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_SPTRSV_BLOCK_IMPL_HPP_
+#define KOKKOSSPARSE_SPTRSV_BLOCK_IMPL_HPP_
+
+#include <algorithm>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ArithTraits.hpp>
+#include "KokkosKernels_ExecSpaceUtils.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+namespace Experimental {
+
+// Solves D y = r in place for a dense row-major bs x bs block D, by Gaussian
+// elimination with partial pivoting; D is overwritten and y is left in r
+template <class DView, class RView>
+KOKKOS_INLINE_FUNCTION void sptrsv_block_dense_solve(const DView &D,
+                                                     const RView &r,
+                                                     const int bs) {
+  using scalar_t = typename DView::non_const_value_type;
+  using KAT      = Kokkos::ArithTraits<scalar_t>;
+
+  for (int c = 0; c < bs; c++) {
+    int piv   = c;
+    auto best = KAT::abs(D(c * bs + c));
+    for (int p = c + 1; p < bs; p++) {
+      const auto a = KAT::abs(D(p * bs + c));
+      if (a > best) {
+        best = a;
+        piv  = p;
+      }
+    }
+    if (piv != c) {
+      for (int q = c; q < bs; q++) {
+        const scalar_t t = D(c * bs + q);
+        D(c * bs + q)    = D(piv * bs + q);
+        D(piv * bs + q)  = t;
+      }
+      const scalar_t t = r(c);
+      r(c)             = r(piv);
+      r(piv)           = t;
+    }
+    for (int p = c + 1; p < bs; p++) {
+      const scalar_t f = D(p * bs + c) / D(c * bs + c);
+      if (f == KAT::zero()) continue;
+      for (int q = c + 1; q < bs; q++) D(p * bs + q) -= f * D(c * bs + q);
+      r(p) -= f * r(c);
+    }
+  }
+  for (int c = bs - 1; c >= 0; c--) {
+    scalar_t s = r(c);
+    for (int q = c + 1; q < bs; q++) s -= D(c * bs + q) * r(q);
+    r(c) = s / D(c * bs + c);
+  }
+}
+
+// Solve the block rows of one level of a BSR triangular matrix, one team per
+// block row: x_i = A_ii^{-1} (b_i - sum_{j != i} A_ij x_j), with the dense
+// blocks row-major in values
+template <class ExecutionSpace, class RowMapType, class EntriesType,
+          class ValuesType, class BType, class XType, class NGBLType>
+struct TriLvlSchedBlockSolverFunctor {
+  using lno_t       = typename EntriesType::non_const_value_type;
+  using scalar_t    = typename XType::non_const_value_type;
+  using member_type = typename Kokkos::TeamPolicy<ExecutionSpace>::member_type;
+  using scratch_view_t =
+      Kokkos::View<scalar_t *, typename ExecutionSpace::scratch_memory_space,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+  RowMapType row_map;
+  EntriesType entries;
+  ValuesType values;
+  BType b;
+  XType x;
+  NGBLType nodes_grouped_by_level;
+  lno_t node_count;
+  lno_t block_size;
+
+  // Scratch of a team: the diagonal block and the block of the rhs
+  static size_t scratch_size(const lno_t bs) {
+    return scratch_view_t::shmem_size(bs * bs) + scratch_view_t::shmem_size(bs);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const member_type &team) const {
+    const lno_t bs  = block_size;
+    const lno_t bs2 = bs * bs;
+    const lno_t row = nodes_grouped_by_level(node_count + team.league_rank());
+    scratch_view_t D(team.team_scratch(0), bs2);
+    scratch_view_t r(team.team_scratch(0), bs);
+
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, bs2), [&](lno_t p) {
+      D(p) = Kokkos::ArithTraits<scalar_t>::zero();
+    });
+    team.team_barrier();
+
+    // Each thread takes rows p of the block row
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, bs), [&](lno_t p) {
+      scalar_t sum = b(row * bs + p);
+      for (auto k = row_map(row); k < row_map(row + 1); k++) {
+        const lno_t col = entries(k);
+        const auto blk  = k * bs2 + p * bs;
+        if (col == row) {
+          for (lno_t q = 0; q < bs; q++) D(p * bs + q) = values(blk + q);
+        } else {
+          for (lno_t q = 0; q < bs; q++) {
+            sum -= values(blk + q) * x(col * bs + q);
+          }
+        }
+      }
+      r(p) = sum;
+    });
+    team.team_barrier();
+
+    Kokkos::single(Kokkos::PerTeam(team),
+                   [&]() { sptrsv_block_dense_solve(D, r, bs); });
+    team.team_barrier();
+
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, bs),
+                         [&](lno_t p) { x(row * bs + p) = r(p); });
+  }
+};
+
+// Level-scheduled solve with a block triangular BSR matrix, with the level
+// schedule of its block graph
+template <class ExecutionSpace, class TriSolveHandle, class RowMapType,
+          class EntriesType, class ValuesType, class BType, class XType>
+void tri_solve_block(ExecutionSpace &space, TriSolveHandle &thandle,
+                     const RowMapType row_map, const EntriesType entries,
+                     const ValuesType values, const int block_size,
+                     const BType &b, const XType &x) {
+  using size_type = typename TriSolveHandle::size_type;
+  using NGBLType  = typename TriSolveHandle::nnz_lno_view_t;
+  using functor_t =
+      TriLvlSchedBlockSolverFunctor<ExecutionSpace, RowMapType, EntriesType,
+                                    ValuesType, BType, XType, NGBLType>;
+  using lno_t = typename functor_t::lno_t;
+
+  const size_type nlevels     = thandle.get_num_levels();
+  auto hnodes_per_level       = thandle.get_host_nodes_per_level();
+  auto nodes_grouped_by_level = thandle.get_nodes_grouped_by_level();
+  const int team_size =
+      KokkosKernels::Impl::kk_is_gpu_exec_space<ExecutionSpace>()
+          ? std::min(block_size, 128)
+          : 1;
+
+  size_type node_count = 0;
+  for (size_type lvl = 0; lvl < nlevels; ++lvl) {
+    const lno_t lvl_nodes = hnodes_per_level(lvl);
+    if (!lvl_nodes) continue;
+    Kokkos::TeamPolicy<ExecutionSpace> policy(space, lvl_nodes, team_size);
+    policy.set_scratch_size(
+        0, Kokkos::PerTeam(functor_t::scratch_size(block_size)));
+    Kokkos::parallel_for(
+        "KokkosSparse::sptrsv::block_level", policy,
+        functor_t{row_map, entries, values, b, x, nodes_grouped_by_level,
+                  lno_t(node_count), lno_t(block_size)});
+    node_count += lvl_nodes;
+  }
+}
+
+}  // namespace Experimental
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPTRSV_BLOCK_IMPL_HPP_
@@ -0,0 +1,203 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_SPTRSV_ISAI_IMPL_HPP_
+#define KOKKOSSPARSE_SPTRSV_ISAI_IMPL_HPP_
+
+#include <sstream>
+#include <stdexcept>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ArithTraits.hpp>
+#include "KokkosKernels_SimpleUtils.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_spmv.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+namespace Experimental {
+
+// Maximum number of entries in a row of the triangle for the incomplete
+// sparse approximate inverse
+constexpr int sptrsv_isai_max_row_length = 64;
+
+// Incomplete sparse approximate inverse M of a triangular A, with the
+// pattern of A: row i of M is the solution of (M A)(i, j) = delta_ij for
+// all j in the pattern of row i of A. This is a small triangular system in
+// the columns J of the row, which each thread solves for its row.
+template <class RowMapType, class EntriesType, class ValuesType,
+          class IsaiRowMapType, class IsaiEntriesType, class IsaiValuesType>
+struct SptrsvIsaiFunctor {
+  using lno_t     = typename EntriesType::non_const_value_type;
+  using size_type = typename IsaiRowMapType::non_const_value_type;
+  using scalar_t  = typename IsaiValuesType::non_const_value_type;
+  using KAT       = Kokkos::ArithTraits<scalar_t>;
+
+  struct CountTag {};
+  struct FillTag {};
+
+  RowMapType row_map;
+  EntriesType entries;
+  ValuesType values;
+  IsaiRowMapType isai_row_map;
+  IsaiEntriesType isai_entries;
+  IsaiValuesType isai_values;
+  bool is_lower;
+
+  // Distance of column col from the diagonal of row, if col is in the
+  // triangle, else -1
+  KOKKOS_INLINE_FUNCTION lno_t distance(const lno_t row,
+                                        const lno_t col) const {
+    const lno_t d = is_lower ? row - col : col - row;
+    return d < 0 ? -1 : d;
+  }
+
+  KOKKOS_INLINE_FUNCTION scalar_t entry(const lno_t row,
+                                        const lno_t col) const {
+    scalar_t a = KAT::zero();
+    for (auto k = row_map(row); k < row_map(row + 1); k++) {
+      if (entries(k) == col) a += values(k);
+    }
+    return a;
+  }
+
+  // Writes the length of row i of M to isai_row_map(i), and keeps the
+  // longest
+  KOKKOS_INLINE_FUNCTION void operator()(const CountTag &, const lno_t i,
+                                         size_type &max_len) const {
+    size_type len = 0;
+    for (auto k = row_map(i); k < row_map(i + 1); k++) {
+      if (distance(i, entries(k)) >= 0) len++;
+    }
+    isai_row_map(i) = len;
+    if (len > max_len) max_len = len;
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const FillTag &,
+                                         const lno_t i) const {
+    lno_t J[sptrsv_isai_max_row_length];
+    scalar_t m[sptrsv_isai_max_row_length];
+
+    // Columns of the row by distance from the diagonal: J[0] = i, and row
+    // J[q] of A only has entries in the columns J[p] with p >= q
+    int len = 0;
+    for (auto k = row_map(i); k < row_map(i + 1); k++) {
+      const lno_t col = entries(k);
+      const lno_t d   = distance(i, col);
+      if (d < 0) continue;
+      int p = len++;
+      for (; p > 0 && distance(i, J[p - 1]) > d; p--) J[p] = J[p - 1];
+      J[p] = col;
+    }
+
+    // Substitution in this order: sum_{q <= p} m[q] A(J[q], J[p]) = delta_p0
+    for (int p = 0; p < len; p++) {
+      scalar_t s = p == 0 ? KAT::one() : KAT::zero();
+      for (int q = 0; q < p; q++) s -= m[q] * entry(J[q], J[p]);
+      m[p] = s / entry(J[p], J[p]);
+    }
+
+    // Store the row with ascending columns
+    const size_type base = isai_row_map(i);
+    for (int p = 0; p < len; p++) {
+      const size_type pos = is_lower ? base + len - 1 - p : base + p;
+      isai_entries(pos)   = J[p];
+      isai_values(pos)    = m[p];
+    }
+  }
+};
+
+// Computes the incomplete sparse approximate inverse of the triangle of the
+// matrix (row_map, entries, values) selected by the handle, and stores it in
+// the handle
+template <class ExecutionSpace, class TriSolveHandle, class RowMapType,
+          class EntriesType, class ValuesType>
+void sptrsv_isai(const ExecutionSpace &space, TriSolveHandle &thandle,
+                 const RowMapType &row_map, const EntriesType &entries,
+                 const ValuesType &values) {
+  using size_type      = typename TriSolveHandle::size_type;
+  using isai_row_map_t = typename TriSolveHandle::nnz_row_view_t;
+  using isai_entries_t = typename TriSolveHandle::nnz_lno_view_t;
+  using isai_values_t  = typename TriSolveHandle::nnz_scalar_view_t;
+  using functor_t =
+      SptrsvIsaiFunctor<RowMapType, EntriesType, ValuesType, isai_row_map_t,
+                        isai_entries_t, isai_values_t>;
+  using count_policy_t =
+      Kokkos::RangePolicy<ExecutionSpace, typename functor_t::CountTag>;
+  using fill_policy_t =
+      Kokkos::RangePolicy<ExecutionSpace, typename functor_t::FillTag>;
+
+  const size_type nrows = thandle.get_nrows();
+  isai_row_map_t isai_row_map("isai_row_map", nrows + 1);
+  functor_t functor{row_map,      entries,          values,
+                    isai_row_map, isai_entries_t(), isai_values_t(),
+                    thandle.is_lower_tri()};
+
+  size_type max_len = 0;
+  Kokkos::parallel_reduce("KokkosSparse::sptrsv_isai::count",
+                          count_policy_t(space, 0, nrows), functor,
+                          Kokkos::Max<size_type>(max_len));
+  if (max_len > size_type(sptrsv_isai_max_row_length)) {
+    std::ostringstream os;
+    os << "sptrsv_isai: a row of the triangle has " << max_len
+       << " entries, more than the supported " << sptrsv_isai_max_row_length;
+    throw std::invalid_argument(os.str());
+  }
+
+  size_type nnz = 0;
+  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum(space, nrows + 1,
+                                                        isai_row_map, nnz);
+  functor.isai_entries = isai_entries_t(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "isai_entries"), nnz);
+  functor.isai_values = isai_values_t(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "isai_values"), nnz);
+  Kokkos::parallel_for("KokkosSparse::sptrsv_isai::fill",
+                       fill_policy_t(space, 0, nrows), functor);
+
+  thandle.set_isai_matrix(isai_row_map, functor.isai_entries,
+                          functor.isai_values);
+}
+
+// x = M b, with the approximate inverse M stored in the handle
+template <class ExecutionSpace, class TriSolveHandle, class BType,
+          class XType>
+void sptrsv_isai_apply(const ExecutionSpace &space, TriSolveHandle &thandle,
+                       const BType &b, const XType &x) {
+  using scalar_t = typename TriSolveHandle::scalar_t;
+  using device_t = Kokkos::Device<typename TriSolveHandle::execution_space,
+                                  typename TriSolveHandle::memory_space>;
+  using matrix_t =
+      KokkosSparse::CrsMatrix<scalar_t, typename TriSolveHandle::nnz_lno_t,
+                              device_t, void,
+                              typename TriSolveHandle::size_type>;
+  using KAT = Kokkos::ArithTraits<scalar_t>;
+
+  if (!thandle.is_isai_complete()) {
+    throw std::runtime_error(
+        "sptrsv_solve: the handle applies ISAI, but sptrsv_isai was not "
+        "called");
+  }
+  auto values = thandle.get_isai_values();
+  matrix_t M("ISAI", thandle.get_nrows(), thandle.get_nrows(),
+             values.extent(0), values, thandle.get_isai_row_map(),
+             thandle.get_isai_entries());
+  KokkosSparse::spmv(space, "N", KAT::one(), M, b, KAT::zero(), x);
+}
+
+}  // namespace Experimental
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPTRSV_ISAI_IMPL_HPP_
@@ -0,0 +1,102 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_SPTRSV_JACOBI_IMPL_HPP_
+#define KOKKOSSPARSE_SPTRSV_JACOBI_IMPL_HPP_
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ArithTraits.hpp>
+
+namespace KokkosSparse {
+namespace Impl {
+namespace Experimental {
+
+// One Jacobi sweep for the triangular A = D + N, one thread per row:
+// x_new = D^{-1} (b - N x_old). With first, x_old is taken as zero.
+template <class RowMapType, class EntriesType, class ValuesType, class BType,
+          class XOldType, class XNewType>
+struct SptrsvJacobiSweepFunctor {
+  using lno_t    = typename EntriesType::non_const_value_type;
+  using scalar_t = typename XNewType::non_const_value_type;
+
+  RowMapType row_map;
+  EntriesType entries;
+  ValuesType values;
+  BType b;
+  XOldType x_old;
+  XNewType x_new;
+  bool is_lower;
+  bool first;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const lno_t i) const {
+    scalar_t sum  = b(i);
+    scalar_t diag = Kokkos::ArithTraits<scalar_t>::zero();
+    for (auto k = row_map(i); k < row_map(i + 1); k++) {
+      const lno_t col = entries(k);
+      if (col == i) {
+        diag += values(k);
+      } else if (!first && (is_lower ? col < i : col > i)) {
+        sum -= values(k) * x_old(col);
+      }
+    }
+    x_new(i) = sum / diag;
+  }
+};
+
+// Approximate x = A^{-1} b with the given number of Jacobi sweeps from
+// x = 0. Since N is nilpotent, the result is exact once the number of sweeps
+// reaches the number of levels of A.
+template <class ExecutionSpace, class RowMapType, class EntriesType,
+          class ValuesType, class BType, class XType>
+void sptrsv_jacobi(const ExecutionSpace &space, const int sweeps,
+                   const bool is_lower, const RowMapType &row_map,
+                   const EntriesType &entries, const ValuesType &values,
+                   const BType &b, const XType &x) {
+  using vector_t = Kokkos::View<typename XType::non_const_value_type *,
+                                typename XType::device_type>;
+  using to_x_t =
+      SptrsvJacobiSweepFunctor<RowMapType, EntriesType, ValuesType, BType,
+                               vector_t, XType>;
+  using to_tmp_t =
+      SptrsvJacobiSweepFunctor<RowMapType, EntriesType, ValuesType, BType,
+                               XType, vector_t>;
+  using policy_t = Kokkos::RangePolicy<ExecutionSpace>;
+
+  const size_t nrows = x.extent(0);
+  if (sweeps <= 0 || !nrows) return;
+
+  // Ping-pong between x and tmp, arranged so the last sweep writes x
+  vector_t tmp(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "sptrsv_jacobi tmp"),
+      sweeps > 1 ? nrows : 0);
+  for (int s = 0; s < sweeps; s++) {
+    if ((sweeps - 1 - s) % 2 == 0) {
+      Kokkos::parallel_for(
+          "KokkosSparse::sptrsv_jacobi::sweep", policy_t(space, 0, nrows),
+          to_x_t{row_map, entries, values, b, tmp, x, is_lower, s == 0});
+    } else {
+      Kokkos::parallel_for(
+          "KokkosSparse::sptrsv_jacobi::sweep", policy_t(space, 0, nrows),
+          to_tmp_t{row_map, entries, values, b, x, tmp, is_lower, s == 0});
+    }
+  }
+}
+
+}  // namespace Experimental
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPTRSV_JACOBI_IMPL_HPP_
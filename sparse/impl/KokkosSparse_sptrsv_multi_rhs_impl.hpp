@@ -0,0 +1,455 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_SPTRSV_MULTI_RHS_IMPL_HPP_
+#define KOKKOSSPARSE_SPTRSV_MULTI_RHS_IMPL_HPP_
+
+#include <type_traits>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ArithTraits.hpp>
+#include <KokkosKernels_config.h>
+#include "KokkosKernels_Error.hpp"
+#include "KokkosKernels_ExecSpaceUtils.hpp"
+
+#if defined(KOKKOSKERNELS_ENABLE_SUPERNODAL_SPTRSV)
+#include "KokkosKernels_default_types.hpp"
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Trsm_Team_Impl.hpp"
+#include "KokkosBatched_Gemm_Decl.hpp"
+#include "KokkosSparse_spmv.hpp"
+#endif
+
+namespace KokkosSparse {
+namespace Impl {
+namespace Experimental {
+
+// Whether T is a rank-2 Kokkos::View, the (b, x) of the multiple right-hand
+// side sptrsv_solve
+template <class T, class = void>
+struct sptrsv_is_multi_rhs : std::false_type {};
+
+template <class T>
+struct sptrsv_is_multi_rhs<T, std::enable_if_t<Kokkos::is_view_v<T>>>
+    : std::bool_constant<T::rank == 2> {};
+
+// Solve the rows of one level for all the columns of rhs. Each thread of a
+// team takes a row, and its vector lanes the columns, so every entry of the
+// row is loaded once for all the columns.
+template <class ExecutionSpace, class RowMapType, class EntriesType,
+          class ValuesType, class LHSType, class RHSType, class NGBLType>
+struct TriLvlSchedMultiRHSSolverFunctor {
+  using lno_t       = typename EntriesType::non_const_value_type;
+  using scalar_t    = typename LHSType::non_const_value_type;
+  using member_type = typename Kokkos::TeamPolicy<ExecutionSpace>::member_type;
+
+  RowMapType row_map;
+  EntriesType entries;
+  ValuesType values;
+  LHSType lhs;
+  RHSType rhs;
+  NGBLType nodes_grouped_by_level;
+  lno_t node_count;
+  lno_t lvl_nodes;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const member_type &team) const {
+    const lno_t first = team.league_rank() * team.team_size();
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(team, team.team_size()), [&](const lno_t r) {
+          if (first + r >= lvl_nodes) return;
+          const auto rowid = nodes_grouped_by_level(node_count + first + r);
+          const auto soffset = row_map(rowid);
+          const auto eoffset = row_map(rowid + 1);
+          Kokkos::parallel_for(
+              Kokkos::ThreadVectorRange(team, lhs.extent(1)),
+              [&](const size_t j) {
+                scalar_t sum  = rhs(rowid, j);
+                scalar_t diag = Kokkos::ArithTraits<scalar_t>::one();
+                for (auto ptr = soffset; ptr < eoffset; ++ptr) {
+                  const auto colid = entries(ptr);
+                  if (colid != rowid) {
+                    sum -= values(ptr) * lhs(colid, j);
+                  } else {
+                    diag = values(ptr);
+                  }
+                }
+                lhs(rowid, j) = sum / diag;
+              });
+        });
+  }
+};
+
+// Level-scheduled solve of lhs = inv(A) * rhs for all the columns of rhs at
+// once, with the schedule of the symbolic phase
+template <class ExecutionSpace, class TriSolveHandle, class RowMapType,
+          class EntriesType, class ValuesType, class RHSType, class LHSType>
+void tri_solve_multi_rhs(ExecutionSpace &space, TriSolveHandle &thandle,
+                         const RowMapType row_map, const EntriesType entries,
+                         const ValuesType values, const RHSType &rhs,
+                         const LHSType &lhs) {
+  using size_type = typename TriSolveHandle::size_type;
+  using NGBLType  = typename TriSolveHandle::nnz_lno_view_t;
+  using functor_t =
+      TriLvlSchedMultiRHSSolverFunctor<ExecutionSpace, RowMapType, EntriesType,
+                                       ValuesType, LHSType, RHSType, NGBLType>;
+  using lno_t = typename functor_t::lno_t;
+
+  const size_type nlevels     = thandle.get_num_levels();
+  auto hnodes_per_level       = thandle.get_host_nodes_per_level();
+  auto nodes_grouped_by_level = thandle.get_nodes_grouped_by_level();
+  const int nrhs              = lhs.extent(1);
+  if (!nrhs) return;
+
+  // On GPUs, a power of two of vector lanes up to a warp for the columns,
+  // and enough rows per team to fill 128 threads
+  int vector_size = 1, team_size = 1;
+  if (KokkosKernels::Impl::kk_is_gpu_exec_space<ExecutionSpace>()) {
+    while (vector_size < nrhs && vector_size < 32) vector_size *= 2;
+    team_size = 128 / vector_size;
+  }
+
+  size_type node_count = 0;
+  for (size_type lvl = 0; lvl < nlevels; ++lvl) {
+    const lno_t lvl_nodes = hnodes_per_level(lvl);
+    if (!lvl_nodes) continue;
+    const lno_t league = (lvl_nodes + team_size - 1) / team_size;
+    Kokkos::parallel_for(
+        "KokkosSparse::sptrsv::multi_rhs_level",
+        Kokkos::TeamPolicy<ExecutionSpace>(space, league, team_size,
+                                           vector_size),
+        functor_t{row_map, entries, values, lhs, rhs, nodes_grouped_by_level,
+                  lno_t(node_count), lvl_nodes});
+    node_count += lvl_nodes;
+  }
+}
+
+#if defined(KOKKOSKERNELS_ENABLE_SUPERNODAL_SPTRSV)
+// Solve the supernodes of one level for all the columns of X. Each team
+// takes a supernode and works on its panel (the diagonal block on top of the
+// off-diagonal rows) with the batched team kernels: TRSM with the diagonal
+// block (GEMM if it was inverted), and GEMM with the off-diagonal rows, so
+// the panel is read once for all the columns. The workspace of the
+// supernode is nsrow x nrhs, at nrhs times its offset in the level.
+template <class ExecutionSpace, class ColptrType, class RowindType,
+          class ValuesType, class LHSType, class WorkType, class NGBLType,
+          class IntegerViewType>
+struct TriSupernodalMultiRHSFunctor {
+  using scalar_t    = typename ValuesType::non_const_value_type;
+  using member_type = typename Kokkos::TeamPolicy<ExecutionSpace>::member_type;
+  using range_type  = Kokkos::pair<int, int>;
+  // NOTE: the supernodal values are stored with default_layout = LayoutLeft
+  using panel_view_t =
+      Kokkos::View<scalar_t **, default_layout,
+                   typename ValuesType::device_type, Kokkos::MemoryUnmanaged>;
+  using block_view_t =
+      Kokkos::View<scalar_t **, Kokkos::LayoutLeft,
+                   typename WorkType::device_type, Kokkos::MemoryUnmanaged>;
+
+  // The factor the panels hold
+  enum Factor : int {
+    LowerCSC,  // L, by supernodal columns
+    UpperCSC,  // U, by supernodal columns
+    UpperCSR   // U, by supernodal rows (the panels hold U^T)
+  };
+
+  Factor factor;
+  bool unit_diagonal;
+  bool invert_diagonal;
+  bool invert_offdiagonal;
+  const int *supercols;
+  ColptrType colptr;
+  RowindType rowind;
+  ValuesType values;
+  LHSType X;
+  WorkType work;
+  IntegerViewType work_offset;
+  NGBLType nodes_grouped_by_level;
+  long node_count;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const member_type &team) const {
+    using namespace KokkosBatched;
+    const scalar_t zero(0.0);
+    const scalar_t one(1.0);
+
+    const int nrhs = X.extent(1);
+    const auto s   = nodes_grouped_by_level(node_count + team.league_rank());
+
+    const int j1    = supercols[s];
+    const int j2    = supercols[s + 1];
+    const int nscol = j2 - j1;
+    // "total" number of rows in the supernode (diagonal+off-diagonal)
+    const int i1     = colptr(j1);
+    const int nsrow  = colptr(j1 + 1) - i1;
+    const int nsrow2 = nsrow - nscol;
+    // offset into rowind of the off-diagonal rows
+    const int i2 = i1 + nscol;
+
+    scalar_t *dataA = const_cast<scalar_t *>(values.data());
+    panel_view_t panel(&dataA[i1], nsrow, nscol);
+    auto Ajj = Kokkos::subview(panel, range_type(0, nscol), Kokkos::ALL());
+    auto Aij = Kokkos::subview(panel, range_type(nscol, nsrow), Kokkos::ALL());
+
+    auto Xj = Kokkos::subview(X, range_type(j1, j2), Kokkos::ALL());
+    block_view_t W(&work(work_offset(s) * nrhs), nsrow, nrhs);
+    auto Y = Kokkos::subview(W, range_type(0, nscol), Kokkos::ALL());
+    auto Z = Kokkos::subview(W, range_type(nscol, nsrow), Kokkos::ALL());
+
+    if (factor == UpperCSR) {
+      // gather the solution of the later supernodes, and Xj -= Uij^T * Z
+      Kokkos::parallel_for(
+          Kokkos::TeamThreadRange(team, nsrow2 * nrhs), [&](const int k) {
+            const int ii = k % nsrow2, j = k / nsrow2;
+            Z(ii, j)     = X(rowind(i2 + ii), j);
+          });
+      team.team_barrier();
+      TeamGemm<member_type, Trans::Transpose, Trans::NoTranspose,
+               Algo::Gemm::Unblocked>::invoke(team, -one, Aij, Z, one, Xj);
+      team.team_barrier();
+      if (invert_diagonal) {
+        Kokkos::parallel_for(
+            Kokkos::TeamThreadRange(team, nscol * nrhs), [&](const int k) {
+              Y(k % nscol, k / nscol) = Xj(k % nscol, k / nscol);
+            });
+        team.team_barrier();
+        TeamGemm<member_type, Trans::Transpose, Trans::NoTranspose,
+                 Algo::Gemm::Unblocked>::invoke(team, one, Ajj, Y, zero, Xj);
+      } else {
+        TeamTrsm<member_type, Side::Left, Uplo::Lower, Trans::Transpose,
+                 Diag::NonUnit, Algo::Trsm::Unblocked>::invoke(team, one, Ajj,
+                                                               Xj);
+      }
+      team.team_barrier();
+      return;
+    }
+
+    // L or U by columns: solve with the diagonal block, then update the
+    // rows of the later supernodes with the off-diagonal rows
+    if (invert_offdiagonal) {
+      // the off-diagonal rows are multiplied by the inverse of the diagonal
+      // block, so one GEMM with the whole panel does both
+      TeamGemm<member_type, Trans::NoTranspose, Trans::NoTranspose,
+               Algo::Gemm::Unblocked>::invoke(team, one, panel, Xj, zero, W);
+      team.team_barrier();
+      Kokkos::parallel_for(
+          Kokkos::TeamThreadRange(team, nscol * nrhs), [&](const int k) {
+            Xj(k % nscol, k / nscol) = Y(k % nscol, k / nscol);
+          });
+    } else {
+      if (invert_diagonal) {
+        Kokkos::parallel_for(
+            Kokkos::TeamThreadRange(team, nscol * nrhs), [&](const int k) {
+              Y(k % nscol, k / nscol) = Xj(k % nscol, k / nscol);
+            });
+        team.team_barrier();
+        TeamGemm<member_type, Trans::NoTranspose, Trans::NoTranspose,
+                 Algo::Gemm::Unblocked>::invoke(team, one, Ajj, Y, zero, Xj);
+      } else if (factor == UpperCSC) {
+        TeamTrsm<member_type, Side::Left, Uplo::Upper, Trans::NoTranspose,
+                 Diag::NonUnit, Algo::Trsm::Unblocked>::invoke(team, one, Ajj,
+                                                               Xj);
+      } else if (unit_diagonal) {
+        TeamTrsm<member_type, Side::Left, Uplo::Lower, Trans::NoTranspose,
+                 Diag::Unit, Algo::Trsm::Unblocked>::invoke(team, one, Ajj,
+                                                            Xj);
+      } else {
+        TeamTrsm<member_type, Side::Left, Uplo::Lower, Trans::NoTranspose,
+                 Diag::NonUnit, Algo::Trsm::Unblocked>::invoke(team, one, Ajj,
+                                                               Xj);
+      }
+      team.team_barrier();
+      TeamGemm<member_type, Trans::NoTranspose, Trans::NoTranspose,
+               Algo::Gemm::Unblocked>::invoke(team, one, Aij, Xj, zero, Z);
+    }
+    team.team_barrier();
+
+    // scatter the update, other supernodes of the level may share the rows
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(team, nsrow2 * nrhs), [&](const int k) {
+          const int ii = k % nsrow2, j = k / nsrow2;
+          Kokkos::atomic_add(&X(rowind(i2 + ii), j), -Z(ii, j));
+        });
+    team.team_barrier();
+  }
+};
+
+// Copies between X and the (nrows x nrhs) workspace of the supernodal SpMV
+// solve, for the columns of the supernodes of one level. The flags are those
+// of SparseTriSupernodalSpMVFunctor: -1 copies work to X, 1 moves X to work
+// (zeroing X), and 0 zeroes work.
+template <class ExecutionSpace, class LHSType, class WorkType, class NGBLType>
+struct TriSupernodalSpMVMultiRHSFunctor {
+  using scalar_t    = typename LHSType::non_const_value_type;
+  using member_type = typename Kokkos::TeamPolicy<ExecutionSpace>::member_type;
+
+  int flag;
+  long node_count;
+  NGBLType nodes_grouped_by_level;
+  const int *supercols;
+  LHSType X;
+  WorkType work;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const member_type &team) const {
+    const scalar_t zero(0.0);
+    const auto s    = nodes_grouped_by_level(node_count + team.league_rank());
+    const int j1    = supercols[s];
+    const int nscol = supercols[s + 1] - j1;
+    const int nrhs  = X.extent(1);
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(team, nscol * nrhs), [&](const int k) {
+          const int i = j1 + k % nscol, j = k / nscol;
+          if (flag == -1) {
+            X(i, j) = work(i, j);
+          } else if (flag == 1) {
+            work(i, j) = X(i, j);
+            X(i, j)    = zero;
+          } else {
+            work(i, j) = zero;
+          }
+        });
+  }
+};
+
+// Supernodal solve of X = inv(A) * X for all the columns of X at once, with
+// the level schedule and the supernodal factor of sptrsv_symbolic and
+// sptrsv_compute: by levels of supernodes with the batched TRSM/GEMM on the
+// panels (SUPERNODAL_NAIVE, SUPERNODAL_ETREE and SUPERNODAL_DAG), or with
+// the multi-vector SpMV of the per-level submatrices (SUPERNODAL_SPMV and
+// SUPERNODAL_SPMV_DAG). The supernodes that the single right-hand side solve
+// hands to the device-level BLAS are solved by a team as well.
+template <class ExecutionSpace, class TriSolveHandle, class RowMapType,
+          class EntriesType, class ValuesType, class LHSType>
+void tri_solve_supernodal_multi_rhs(ExecutionSpace &space,
+                                    TriSolveHandle &thandle,
+                                    const RowMapType row_map,
+                                    const EntriesType entries,
+                                    const ValuesType values,
+                                    const LHSType &lhs) {
+  using KokkosSparse::Experimental::SPTRSVAlgorithm;
+  using size_type      = typename TriSolveHandle::size_type;
+  using NGBLType       = typename TriSolveHandle::nnz_lno_view_t;
+  using integer_view_t = typename TriSolveHandle::integer_view_t;
+  using scalar_t       = typename ValuesType::non_const_value_type;
+  using work_view_t =
+      Kokkos::View<scalar_t *, typename TriSolveHandle::HandleTempMemorySpace>;
+  using spmv_work_view_t =
+      Kokkos::View<scalar_t **, Kokkos::LayoutLeft,
+                   typename TriSolveHandle::HandleTempMemorySpace>;
+  using team_policy_t = Kokkos::TeamPolicy<ExecutionSpace>;
+
+  const size_type nlevels     = thandle.get_num_levels();
+  auto hnodes_per_level       = thandle.get_host_nodes_per_level();
+  auto nodes_grouped_by_level = thandle.get_nodes_grouped_by_level();
+  const int *supercols        = thandle.get_supercols();
+  const int nrhs              = lhs.extent(1);
+  if (!nrhs) return;
+
+  const bool lower              = thandle.is_lower_tri();
+  const bool invert_diagonal    = thandle.get_invert_diagonal();
+  const bool invert_offdiagonal = thandle.get_invert_offdiagonal();
+  const scalar_t one(1.0);
+
+  const auto algm = thandle.get_algorithm();
+  if (algm == SPTRSVAlgorithm::SUPERNODAL_SPMV ||
+      algm == SPTRSVAlgorithm::SUPERNODAL_SPMV_DAG) {
+    using functor_t =
+        TriSupernodalSpMVMultiRHSFunctor<ExecutionSpace, LHSType,
+                                         spmv_work_view_t, NGBLType>;
+    // U in CSR is applied with the transpose of its CSC blocks
+    const bool transpose_spmv =
+        ((!thandle.transpose_spmv() && thandle.is_column_major()) ||
+         (thandle.transpose_spmv() && !thandle.is_column_major()));
+    const char *tran = (transpose_spmv ? "T" : "N");
+    if (!lower && transpose_spmv && invert_offdiagonal) {
+      KokkosKernels::Impl::throw_runtime_exception(
+          "sptrsv_solve: invert_offdiag with U in CSR not supported");
+    }
+
+    // zero, as the single right-hand side workspace
+    typename TriSolveHandle::arena_t::Scope arena(thandle.get_arena());
+    auto work = arena.template view<spmv_work_view_t>(
+        "sptrsv multi_rhs work", false, lhs.extent(0), nrhs);
+    Kokkos::deep_copy(space, work, scalar_t(0));
+    size_type node_count = 0;
+    for (size_type lvl = 0; lvl < nlevels; ++lvl) {
+      const size_type lvl_nodes = hnodes_per_level(lvl);
+      if (!lvl_nodes) continue;
+      auto copy = [&](int flag) {
+        Kokkos::parallel_for(
+            "KokkosSparse::sptrsv::multi_rhs_supernode_spmv",
+            team_policy_t(space, lvl_nodes, Kokkos::AUTO),
+            functor_t{flag, long(node_count), nodes_grouped_by_level,
+                      supercols, lhs, work});
+      };
+      auto digmat = thandle.get_diagblock(lvl);
+      auto submat = thandle.get_submatrix(lvl);
+      if (lower || !transpose_spmv) {
+        if (!invert_offdiagonal) {
+          // solve with the diagonal blocks
+          KokkosSparse::spmv(space, tran, one, digmat, lhs, one, work);
+          copy(-1);
+        } else {
+          copy(1);
+        }
+        // update with the off-diagonal blocks (with the diagonal solve if
+        // they were inverted)
+        KokkosSparse::spmv(space, tran, one, submat, work, one, lhs);
+      } else {
+        copy(1);
+        KokkosSparse::spmv(space, tran, one, submat, lhs, one, work);
+        KokkosSparse::spmv(space, tran, one, digmat, work, one, lhs);
+      }
+      copy(0);
+      node_count += lvl_nodes;
+    }
+    return;
+  }
+
+  using functor_t =
+      TriSupernodalMultiRHSFunctor<ExecutionSpace, RowMapType, EntriesType,
+                                   ValuesType, LHSType, work_view_t, NGBLType,
+                                   integer_view_t>;
+  const typename functor_t::Factor factor =
+      lower ? functor_t::LowerCSC
+            : (thandle.is_column_major() ? functor_t::UpperCSC
+                                         : functor_t::UpperCSR);
+
+  typename TriSolveHandle::arena_t::Scope arena(thandle.get_arena());
+  auto work = arena.template view<work_view_t>(
+      "sptrsv multi_rhs work", false,
+      size_t(thandle.get_workspace_size()) * nrhs);
+  size_type node_count = 0;
+  for (size_type lvl = 0; lvl < nlevels; ++lvl) {
+    const size_type lvl_nodes = hnodes_per_level(lvl);
+    if (!lvl_nodes) continue;
+    Kokkos::parallel_for(
+        "KokkosSparse::sptrsv::multi_rhs_supernode",
+        team_policy_t(space, lvl_nodes, Kokkos::AUTO),
+        functor_t{factor, thandle.is_unit_diagonal(), invert_diagonal,
+                  invert_offdiagonal, supercols, row_map, entries, values,
+                  lhs, work, thandle.get_work_offset(),
+                  nodes_grouped_by_level, long(node_count)});
+    node_count += lvl_nodes;
+  }
+}
+#endif
+
+}  // namespace Experimental
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPTRSV_MULTI_RHS_IMPL_HPP_
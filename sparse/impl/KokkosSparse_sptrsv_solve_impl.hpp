@@ -90,7 +90,7 @@ struct TriLvlSchedTP1SolverFunctor {
   typedef Kokkos::TeamPolicy<execution_space> policy_type;
   typedef typename policy_type::member_type member_type;
   typedef typename EntriesType::non_const_value_type lno_t;
-  typedef typename ValuesType::non_const_value_type scalar_t;
+  typedef typename LHSType::non_const_value_type scalar_t;
 
   RowMapType row_map;
   EntriesType entries;
@@ -195,7 +195,7 @@ struct TriLvlSchedTP1SolverFunctorDiagValues {
   typedef Kokkos::TeamPolicy<execution_space> policy_type;
   typedef typename policy_type::member_type member_type;
   typedef typename EntriesType::non_const_value_type lno_t;
-  typedef typename ValuesType::non_const_value_type scalar_t;
+  typedef typename LHSType::non_const_value_type scalar_t;
 
   RowMapType row_map;
   EntriesType entries;
@@ -271,7 +271,7 @@ struct TriLvlSchedTP2SolverFunctor {
   typedef Kokkos::TeamPolicy<execution_space> policy_type;
   typedef typename policy_type::member_type member_type;
   typedef typename EntriesType::non_const_value_type lno_t;
-  typedef typename ValuesType::non_const_value_type scalar_t;
+  typedef typename LHSType::non_const_value_type scalar_t;
 
   RowMapType row_map;
   EntriesType entries;
@@ -452,7 +452,7 @@ struct LowerTriLvlSchedTP1SolverFunctor {
   typedef Kokkos::TeamPolicy<execution_space> policy_type;
   typedef typename policy_type::member_type member_type;
   typedef typename EntriesType::non_const_value_type lno_t;
-  typedef typename ValuesType::non_const_value_type scalar_t;
+  typedef typename LHSType::non_const_value_type scalar_t;
 
   RowMapType row_map;
   EntriesType entries;
@@ -557,7 +557,7 @@ struct LowerTriLvlSchedTP2SolverFunctor {
   typedef Kokkos::TeamPolicy<execution_space> policy_type;
   typedef typename policy_type::member_type member_type;
   typedef typename EntriesType::non_const_value_type lno_t;
-  typedef typename ValuesType::non_const_value_type scalar_t;
+  typedef typename LHSType::non_const_value_type scalar_t;
 
   RowMapType row_map;
   EntriesType entries;
@@ -772,6 +772,9 @@ struct LowerTriSupernodalFunctor {
   int level;
   integer_view_t kernel_type;
   integer_view_t diag_kernel_type;
+  // the first num_device_nodes(level) supernodes of the level are solved
+  // with device-level kernels before (or after) this functor
+  integer_view_t num_device_nodes;
 
   LHSType X;
 
@@ -791,7 +794,7 @@ struct LowerTriSupernodalFunctor {
       const ValuesType &values_,
       // options to pick kernel type
       int level_, integer_view_t &kernel_type_,
-      integer_view_t &diag_kernel_type_,
+      integer_view_t &diag_kernel_type_, integer_view_t &num_device_nodes_,
       // right-hand-side (input), solution (output)
       LHSType &X_,
       // workspace
@@ -808,6 +811,7 @@ struct LowerTriSupernodalFunctor {
         level(level_),
         kernel_type(kernel_type_),
         diag_kernel_type(diag_kernel_type_),
+        num_device_nodes(num_device_nodes_),
         X(X_),
         work(work_),
         work_offset(work_offset_),
@@ -852,7 +856,8 @@ struct LowerTriSupernodalFunctor {
     auto Z               = Kokkos::subview(
         work, range_type(workoffset + nscol, workoffset + nsrow));
 
-    if (diag_kernel_type(level) != 3) {  // not a device-level TRSM-solve
+    if (league_rank >= num_device_nodes(level)) {
+      // not a device-level TRSM-solve
       if (invert_offdiagonal) {
         // combined TRSM solve with diagonal + GEMV update with off-diagonal
         auto Y = Kokkos::subview(
@@ -982,6 +987,9 @@ struct UpperTriSupernodalFunctor {
   int level;
   integer_view_t kernel_type;
   integer_view_t diag_kernel_type;
+  // the first num_device_nodes(level) supernodes of the level are solved
+  // with device-level kernels before (or after) this functor
+  integer_view_t num_device_nodes;
 
   LHSType X;
 
@@ -1000,7 +1008,7 @@ struct UpperTriSupernodalFunctor {
       const ValuesType &values_,
       // options to pick kernel type
       int level_, integer_view_t &kernel_type_,
-      integer_view_t &diag_kernel_type_,
+      integer_view_t &diag_kernel_type_, integer_view_t &num_device_nodes_,
       // right-hand-side (input), solution (output)
       LHSType &X_,
       // workspace
@@ -1015,6 +1023,7 @@ struct UpperTriSupernodalFunctor {
         level(level_),
         kernel_type(kernel_type_),
         diag_kernel_type(diag_kernel_type_),
+        num_device_nodes(num_device_nodes_),
         X(X_),
         work(work_),
         work_offset(work_offset_),
@@ -1069,7 +1078,7 @@ struct UpperTriSupernodalFunctor {
     }
     team.team_barrier();
     /* GEMM to update with off diagonal blocks, Xj = -Uij^T * Z */
-    if (diag_kernel_type(level) != 3) {
+    if (league_rank >= num_device_nodes(level)) {
       // not device-level GEMV-udpate
       auto Uij =
           Kokkos::subview(viewU, range_type(nscol, nsrow), Kokkos::ALL());
@@ -1148,6 +1157,9 @@ struct UpperTriTranSupernodalFunctor {
   int level;
   integer_view_t kernel_type;
   integer_view_t diag_kernel_type;
+  // the first num_device_nodes(level) supernodes of the level are solved
+  // with device-level kernels before (or after) this functor
+  integer_view_t num_device_nodes;
 
   LHSType X;
 
@@ -1169,6 +1181,7 @@ struct UpperTriTranSupernodalFunctor {
       // options to pick kernel type
       const int level_, const integer_view_t &kernel_type_,
       const integer_view_t &diag_kernel_type_,
+      const integer_view_t &num_device_nodes_,
       // right-hand-side (input), solution (output)
       const LHSType &X_,
       // workspace
@@ -1184,6 +1197,7 @@ struct UpperTriTranSupernodalFunctor {
         level(level_),
         kernel_type(kernel_type_),
         diag_kernel_type(diag_kernel_type_),
+        num_device_nodes(num_device_nodes_),
         X(X_),
         work(work_),
         work_offset(work_offset_),
@@ -1228,7 +1242,7 @@ struct UpperTriTranSupernodalFunctor {
     int workoffset = work_offset(s);
 
     /* TRSM with diagonal block */
-    if (diag_kernel_type(level) != 3) {
+    if (league_rank >= num_device_nodes(level)) {
       // not device-level TRSM-solve
       if (invert_offdiagonal) {
         // extract diagonal + off-diagonal blocks of U
@@ -1288,7 +1302,7 @@ struct UpperTriTranSupernodalFunctor {
       /* GEMM to update off diagonal blocks, Z = Uij * Xj */
       auto Z = Kokkos::subview(
           work, range_type(workoffset + nscol, workoffset + nsrow));
-      if (!invert_offdiagonal && diag_kernel_type(level) != 3) {
+      if (!invert_offdiagonal && league_rank >= num_device_nodes(level)) {
         // not device-level TRSM-solve
         auto Uij =
             Kokkos::subview(viewU, range_type(nscol, nsrow), Kokkos::ALL());
@@ -1385,7 +1399,7 @@ struct UpperTriLvlSchedTP1SolverFunctor {
   typedef Kokkos::TeamPolicy<execution_space> policy_type;
   typedef typename policy_type::member_type member_type;
   typedef typename EntriesType::non_const_value_type lno_t;
-  typedef typename ValuesType::non_const_value_type scalar_t;
+  typedef typename LHSType::non_const_value_type scalar_t;
 
   RowMapType row_map;
   EntriesType entries;
@@ -1490,7 +1504,7 @@ struct UpperTriLvlSchedTP2SolverFunctor {
   typedef Kokkos::TeamPolicy<execution_space> policy_type;
   typedef typename policy_type::member_type member_type;
   typedef typename EntriesType::non_const_value_type lno_t;
-  typedef typename ValuesType::non_const_value_type scalar_t;
+  typedef typename LHSType::non_const_value_type scalar_t;
 
   RowMapType row_map;
   EntriesType entries;
@@ -1602,7 +1616,7 @@ struct LowerTriLvlSchedTP1SingleBlockFunctor {
   typedef Kokkos::TeamPolicy<execution_space> policy_type;
   typedef typename policy_type::member_type member_type;
   typedef typename EntriesType::non_const_value_type lno_t;
-  typedef typename ValuesType::non_const_value_type scalar_t;
+  typedef typename LHSType::non_const_value_type scalar_t;
 
   RowMapType row_map;
   EntriesType entries;
@@ -1882,7 +1896,7 @@ struct UpperTriLvlSchedTP1SingleBlockFunctor {
   typedef Kokkos::TeamPolicy<execution_space> policy_type;
   typedef typename policy_type::member_type member_type;
   typedef typename EntriesType::non_const_value_type lno_t;
-  typedef typename ValuesType::non_const_value_type scalar_t;
+  typedef typename LHSType::non_const_value_type scalar_t;
 
   RowMapType row_map;
   EntriesType entries;
@@ -2168,7 +2182,7 @@ struct TriLvlSchedTP1SingleBlockFunctor {
   typedef Kokkos::TeamPolicy<execution_space> policy_type;
   typedef typename policy_type::member_type member_type;
   typedef typename EntriesType::non_const_value_type lno_t;
-  typedef typename ValuesType::non_const_value_type scalar_t;
+  typedef typename LHSType::non_const_value_type scalar_t;
 
   RowMapType row_map;
   EntriesType entries;
@@ -2467,7 +2481,7 @@ struct TriLvlSchedTP1SingleBlockFunctorDiagValues {
   typedef Kokkos::TeamPolicy<execution_space> policy_type;
   typedef typename policy_type::member_type member_type;
   typedef typename EntriesType::non_const_value_type lno_t;
-  typedef typename ValuesType::non_const_value_type scalar_t;
+  typedef typename LHSType::non_const_value_type scalar_t;
 
   RowMapType row_map;
   EntriesType entries;
@@ -2953,6 +2967,10 @@ void lower_tri_solve(ExecutionSpace &space, TriSolveHandle &thandle,
   integer_view_host_t kernel_type_host = thandle.get_kernel_type_host();
   integer_view_host_t diag_kernel_type_host =
       thandle.get_diag_kernel_type_host();
+  // > number of supernodes solved with device-level kernels at each level
+  integer_view_t num_device_nodes = thandle.get_num_device_nodes();
+  integer_view_host_t num_device_nodes_host =
+      thandle.get_num_device_nodes_host();
 
   // workspaces
   integer_view_t work_offset           = thandle.get_work_offset();
@@ -3090,12 +3108,14 @@ void lower_tri_solve(ExecutionSpace &space, TriSolveHandle &thandle,
               Kokkos::parallel_for(
                   "parfor_tri_supernode_spmv",
                   Kokkos::Experimental::require(
-                      team_policy_type(space, lvl_nodes, Kokkos::AUTO),
+                      team_policy_type(space, num_device_nodes_host(lvl),
+                                       Kokkos::AUTO),
                       Kokkos::Experimental::WorkItemProperty::HintLightWeight),
                   sptrsv_init_functor);
             }
 
-            for (size_type league_rank = 0; league_rank < lvl_nodes;
+            for (size_type league_rank = 0;
+                 league_rank < size_type(num_device_nodes_host(lvl));
                  league_rank++) {
               auto s = nodes_grouped_by_level_host(node_count + league_rank);
 
@@ -3181,7 +3201,8 @@ void lower_tri_solve(ExecutionSpace &space, TriSolveHandle &thandle,
               Kokkos::parallel_for(
                   "parfor_tri_supernode_spmv",
                   Kokkos::Experimental::require(
-                      team_policy_type(space, lvl_nodes, Kokkos::AUTO),
+                      team_policy_type(space, num_device_nodes_host(lvl),
+                                       Kokkos::AUTO),
                       Kokkos::Experimental::WorkItemProperty::HintLightWeight),
                   sptrsv_init_functor);
             }
@@ -3192,8 +3213,9 @@ void lower_tri_solve(ExecutionSpace &space, TriSolveHandle &thandle,
                                     ValuesType, LHSType, NGBLType>
               sptrsv_functor(unit_diagonal, invert_diagonal, invert_offdiagonal,
                              supercols, row_map, entries, values, lvl,
-                             kernel_type, diag_kernel_type, lhs, work,
-                             work_offset, nodes_grouped_by_level, node_count);
+                             kernel_type, diag_kernel_type, num_device_nodes,
+                             lhs, work, work_offset, nodes_grouped_by_level,
+                             node_count);
           Kokkos::parallel_for(
               "parfor_lsolve_supernode",
               Kokkos::Experimental::require(
@@ -3366,6 +3388,10 @@ void upper_tri_solve(ExecutionSpace &space, TriSolveHandle &thandle,
   integer_view_host_t kernel_type_host = thandle.get_kernel_type_host();
   integer_view_host_t diag_kernel_type_host =
       thandle.get_diag_kernel_type_host();
+  // > number of supernodes solved with device-level kernels at each level
+  integer_view_t num_device_nodes = thandle.get_num_device_nodes();
+  integer_view_host_t num_device_nodes_host =
+      thandle.get_num_device_nodes_host();
 
   // workspace
   integer_view_t work_offset           = thandle.get_work_offset();
@@ -3498,11 +3524,13 @@ tstf); } // end elseif
               Kokkos::parallel_for(
                   "parfor_tri_supernode_spmv",
                   Kokkos::Experimental::require(
-                      team_policy_type(space, lvl_nodes, Kokkos::AUTO),
+                      team_policy_type(space, num_device_nodes_host(lvl),
+                                       Kokkos::AUTO),
                       Kokkos::Experimental::WorkItemProperty::HintLightWeight),
                   sptrsv_init_functor);
             }
-            for (size_type league_rank = 0; league_rank < lvl_nodes;
+            for (size_type league_rank = 0;
+                 league_rank < size_type(num_device_nodes_host(lvl));
                  league_rank++) {
               auto s = nodes_grouped_by_level_host(node_count + league_rank);
 
@@ -3592,7 +3620,8 @@ tstf); } // end elseif
               Kokkos::parallel_for(
                   "parfor_tri_supernode_spmv",
                   Kokkos::Experimental::require(
-                      team_policy_type(space, lvl_nodes, Kokkos::AUTO),
+                      team_policy_type(space, num_device_nodes_host(lvl),
+                                       Kokkos::AUTO),
                       Kokkos::Experimental::WorkItemProperty::HintLightWeight),
                   sptrsv_init_functor);
             }
@@ -3603,8 +3632,8 @@ tstf); } // end elseif
                                         ValuesType, LHSType, NGBLType>
               sptrsv_functor(invert_diagonal, invert_offdiagonal, supercols,
                              row_map, entries, values, lvl, kernel_type,
-                             diag_kernel_type, lhs, work, work_offset,
-                             nodes_grouped_by_level, node_count);
+                             diag_kernel_type, num_device_nodes, lhs, work,
+                             work_offset, nodes_grouped_by_level, node_count);
 
           using team_policy_t = Kokkos::TeamPolicy<ExecutionSpace>;
           Kokkos::parallel_for(
@@ -3618,9 +3647,9 @@ tstf); } // end elseif
           UpperTriSupernodalFunctor<TriSolveHandle, RowMapType, EntriesType,
                                     ValuesType, LHSType, NGBLType>
               sptrsv_functor(invert_diagonal, supercols, row_map, entries,
-                             values, lvl, kernel_type, diag_kernel_type, lhs,
-                             work, work_offset, nodes_grouped_by_level,
-                             node_count);
+                             values, lvl, kernel_type, diag_kernel_type,
+                             num_device_nodes, lhs, work, work_offset,
+                             nodes_grouped_by_level, node_count);
 
           using team_policy_t = Kokkos::TeamPolicy<ExecutionSpace>;
           Kokkos::parallel_for(
@@ -3635,7 +3664,8 @@ tstf); } // end elseif
             // into workspace)
             scalar_t *dataU = const_cast<scalar_t *>(values.data());
 
-            for (size_type league_rank = 0; league_rank < lvl_nodes;
+            for (size_type league_rank = 0;
+                 league_rank < size_type(num_device_nodes_host(lvl));
                  league_rank++) {
               auto s = nodes_grouped_by_level_host(node_count + league_rank);
 
@@ -3710,7 +3740,8 @@ tstf); } // end elseif
               Kokkos::parallel_for(
                   "parfor_tri_supernode_spmv",
                   Kokkos::Experimental::require(
-                      team_policy_type(space, lvl_nodes, Kokkos::AUTO),
+                      team_policy_type(space, num_device_nodes_host(lvl),
+                                       Kokkos::AUTO),
                       Kokkos::Experimental::WorkItemProperty::HintLightWeight),
                   sptrsv_init_functor);
             }
@@ -4118,6 +4149,110 @@ void tri_solve_chain(ExecutionSpace &space, TriSolveHandle &thandle,
 
 }  // end tri_solve_chain
 
+// Sync-free solve: each row is solved by one team as soon as the rows it
+// depends on are, instead of after a barrier at the end of its level, so the
+// whole triangle is one kernel launch. Teams take rows in dependency order
+// (increasing for lower, decreasing for upper triangles) from the counter
+// ready(nrows), which ensures every row a team waits on is already held by a
+// running team. ready(r) is set once lhs(r) is final.
+template <class ExecutionSpace, class RowMapType, class EntriesType,
+          class ValuesType, class LHSType, class RHSType, class ReadyType,
+          bool IsLower>
+struct TriSyncFreeSolverFunctor {
+  using lno_t       = typename EntriesType::non_const_value_type;
+  using ready_t     = typename ReadyType::non_const_value_type;
+  using scalar_t    = typename LHSType::non_const_value_type;
+  using member_type = typename Kokkos::TeamPolicy<ExecutionSpace>::member_type;
+
+  RowMapType row_map;
+  EntriesType entries;
+  ValuesType values;
+  LHSType lhs;
+  RHSType rhs;
+  ReadyType ready;
+  lno_t nrows;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const member_type &team) const {
+    ready_t ticket = 0;
+    Kokkos::single(
+        Kokkos::PerTeam(team),
+        [&](ready_t &t) {
+          t = Kokkos::atomic_fetch_add(&ready(nrows), ready_t(1));
+        },
+        ticket);
+    const lno_t rowid  = IsLower ? ticket : nrows - 1 - ticket;
+    const auto soffset = row_map(rowid);
+    const auto eoffset = row_map(rowid + 1);
+
+    scalar_t sum  = Kokkos::ArithTraits<scalar_t>::zero();
+    scalar_t diag = Kokkos::ArithTraits<scalar_t>::zero();
+    Kokkos::parallel_reduce(
+        Kokkos::TeamThreadRange(team, soffset, eoffset),
+        [&](const auto ptr, scalar_t &tsum) {
+          const lno_t colid = entries(ptr);
+          if (colid != rowid) {
+            while (Kokkos::atomic_load(&ready(colid)) == ready_t(0)) {
+            }
+            Kokkos::memory_fence();
+            tsum += values(ptr) * Kokkos::atomic_load(&lhs(colid));
+          }
+        },
+        sum);
+    Kokkos::parallel_reduce(
+        Kokkos::TeamThreadRange(team, soffset, eoffset),
+        [&](const auto ptr, scalar_t &tdiag) {
+          if (entries(ptr) == rowid) tdiag += values(ptr);
+        },
+        diag);
+    Kokkos::single(Kokkos::PerTeam(team), [&]() {
+      Kokkos::atomic_store(&lhs(rowid), (rhs(rowid) - sum) / diag);
+      Kokkos::memory_fence();
+      Kokkos::atomic_store(&ready(rowid), ready_t(1));
+    });
+  }
+};
+
+template <class ExecutionSpace, class TriSolveHandle, class RowMapType,
+          class EntriesType, class ValuesType, class RHSType, class LHSType>
+void tri_solve_syncfree(ExecutionSpace &space, TriSolveHandle &thandle,
+                        const RowMapType row_map, const EntriesType entries,
+                        const ValuesType values, const RHSType &rhs,
+                        LHSType &lhs, const bool is_lowertri) {
+  using ReadyType = typename TriSolveHandle::nnz_lno_view_t;
+  using lno_t     = typename EntriesType::non_const_value_type;
+
+  const lno_t nrows = row_map.extent(0) ? row_map.extent(0) - 1 : 0;
+  if (!nrows) return;
+  ReadyType ready = thandle.get_syncfree_ready();
+  Kokkos::deep_copy(space, ready, 0);
+
+  // One warp per row on GPUs, so rows waiting on each other never share a
+  // warp
+  int team_size = thandle.get_team_size();
+  if (team_size == -1) {
+    team_size = KokkosKernels::Impl::kk_is_gpu_exec_space<ExecutionSpace>()
+                    ? 32
+                    : 1;
+  }
+  Kokkos::TeamPolicy<ExecutionSpace> policy(space, nrows, team_size);
+  if (is_lowertri) {
+    Kokkos::parallel_for(
+        "KokkosSparse::sptrsv::syncfree_lower", policy,
+        TriSyncFreeSolverFunctor<ExecutionSpace, RowMapType, EntriesType,
+                                 ValuesType, LHSType, RHSType, ReadyType,
+                                 true>{row_map, entries, values, lhs, rhs,
+                                       ready, nrows});
+  } else {
+    Kokkos::parallel_for(
+        "KokkosSparse::sptrsv::syncfree_upper", policy,
+        TriSyncFreeSolverFunctor<ExecutionSpace, RowMapType, EntriesType,
+                                 ValuesType, LHSType, RHSType, ReadyType,
+                                 false>{row_map, entries, values, lhs, rhs,
+                                        ready, nrows});
+  }
+}  // end tri_solve_syncfree
+
 // --------------------------------
 // Stream interfaces
 // --------------------------------
@@ -134,6 +134,10 @@ struct SPTRSV_SOLVE<ExecutionSpace, KernelHandle, RowMapType, EntriesType,
           KokkosSparse::Experimental::SPTRSVAlgorithm::SEQLVLSCHD_TP1CHAIN) {
         Experimental::tri_solve_chain(space, *sptrsv_handle, row_map, entries,
                                       values, b, x, true);
+      } else if (sptrsv_handle->get_algorithm() ==
+                 KokkosSparse::Experimental::SPTRSVAlgorithm::SYNCFREE) {
+        Experimental::tri_solve_syncfree(space, *sptrsv_handle, row_map,
+                                         entries, values, b, x, true);
       } else {
 #ifdef KOKKOSKERNELS_SPTRSV_CUDAGRAPHSUPPORT
         using ExecSpace = typename RowMapType::memory_space::execution_space;
@@ -155,6 +159,10 @@ struct SPTRSV_SOLVE<ExecutionSpace, KernelHandle, RowMapType, EntriesType,
           KokkosSparse::Experimental::SPTRSVAlgorithm::SEQLVLSCHD_TP1CHAIN) {
         Experimental::tri_solve_chain(space, *sptrsv_handle, row_map, entries,
                                       values, b, x, false);
+      } else if (sptrsv_handle->get_algorithm() ==
+                 KokkosSparse::Experimental::SPTRSVAlgorithm::SYNCFREE) {
+        Experimental::tri_solve_syncfree(space, *sptrsv_handle, row_map,
+                                         entries, values, b, x, false);
       } else {
 #ifdef KOKKOSKERNELS_SPTRSV_CUDAGRAPHSUPPORT
         using ExecSpace = typename RowMapType::memory_space::execution_space;
@@ -19,6 +19,7 @@
 /// \file KokkosSparse_impl_sptrsv_symbolic.hpp
 /// \brief Implementation(s) of sparse triangular solve.
 
+#include <algorithm>
 #include <KokkosKernels_config.h>
 #include <Kokkos_ArithTraits.hpp>
 #include <KokkosSparse_sptrsv_handle.hpp>
@@ -147,6 +148,38 @@ void symbolic_chain_phase(TriSolveHandle& thandle,
 #endif
 }  // end symbolic_chain_phase
 
+#ifdef KOKKOSKERNELS_ENABLE_SUPERNODAL_SPTRSV
+// Pick the kernels for the num_nodes supernodes of a level, starting at
+// node_count in nodes_grouped_by_level. The supernodes are ordered by
+// decreasing number of columns, so that those with at least size_unblocked
+// columns come first and are solved one at a time with device-level
+// kernels, and the many small ones are solved together with one launch of
+// the batched team-level kernels (with teams of similar sizes next to each
+// other).
+template <class NGBLHostType, class KernelTypeHostType>
+void supernodal_level_kernel_types(
+    const int* supercols, int size_unblocked,
+    NGBLHostType& nodes_grouped_by_level, size_t node_count, size_t num_nodes,
+    size_t level, KernelTypeHostType& kernel_type_by_level,
+    KernelTypeHostType& diag_kernel_type_by_level,
+    KernelTypeHostType& num_device_nodes) {
+  using node_t = typename NGBLHostType::non_const_value_type;
+
+  auto nscol = [&](node_t s) { return supercols[s + 1] - supercols[s]; };
+  node_t* first = nodes_grouped_by_level.data() + node_count;
+  std::stable_sort(first, first + num_nodes, [&](node_t a, node_t b) {
+    return nscol(a) > nscol(b);
+  });
+  size_t num_device = 0;
+  while (num_device < num_nodes && nscol(first[num_device]) >= size_unblocked)
+    num_device++;
+
+  kernel_type_by_level(level)      = (num_device > 0 ? 3 : 0);
+  diag_kernel_type_by_level(level) = (num_device > 0 ? 3 : 0);
+  num_device_nodes(level)          = num_device;
+}
+#endif
+
 template <class ExecSpaceIn, class TriSolveHandle, class RowMapType,
           class EntriesType>
 void lower_tri_symbolic(ExecSpaceIn& space, TriSolveHandle& thandle,
@@ -157,6 +190,14 @@ void lower_tri_symbolic(ExecSpaceIn& space, TriSolveHandle& thandle,
 #endif
 
   using namespace KokkosSparse::Experimental;
+  if (thandle.get_algorithm() == SPTRSVAlgorithm::SYNCFREE) {
+    // No schedule, only the ready flags of the solve (one per row, and the
+    // row counter)
+    using ReadyType = typename TriSolveHandle::nnz_lno_view_t;
+    thandle.set_syncfree_ready(ReadyType("syncfree_ready", drow_map.extent(0)));
+    thandle.set_symbolic_complete();
+    return;
+  }
   if (thandle.get_algorithm() == SPTRSVAlgorithm::SEQLVLSCHD_RP ||
       thandle.get_algorithm() == SPTRSVAlgorithm::SEQLVLSCHD_TP1 ||
       /*thandle.get_algorithm () == SPTRSVAlgorithm::SEQLVLSCHED_TP2*/
@@ -328,6 +369,7 @@ void lower_tri_symbolic(ExecSpaceIn& space, TriSolveHandle& thandle,
     // int size_blocked = thandle.get_supernode_size_blocked();
     auto kernel_type_by_level      = thandle.get_kernel_type_host();
     auto diag_kernel_type_by_level = thandle.get_diag_kernel_type_host();
+    auto num_device_nodes          = thandle.get_num_device_nodes_host();
 
     // # of supernodal columns
     size_type nsuper     = thandle.get_num_supernodes();
@@ -370,6 +412,7 @@ void lower_tri_symbolic(ExecSpaceIn& space, TriSolveHandle& thandle,
           kernel_type_by_level(s)      = 3;
           diag_kernel_type_by_level(s) = 3;
         }
+        num_device_nodes(s) = (kernel_type_by_level(s) == 3 ? 1 : 0);
         work_offset_host(s) = 0;
       }
     } else {
@@ -420,8 +463,10 @@ void lower_tri_symbolic(ExecSpaceIn& space, TriSolveHandle& thandle,
         // look for ready-tasks
         signed_integral_t lwork     = 0;
         signed_integral_t num_leave = 0;
+#ifdef profile_supernodal_etree
         signed_integral_t avg_nscol = 0;
         signed_integral_t avg_nsrow = 0;
+#endif
         for (size_type s = 0; s < nsuper; s++) {
           if (check(s) == 0) {
             nodes_per_level(level)++;
@@ -441,11 +486,11 @@ void lower_tri_symbolic(ExecSpaceIn& space, TriSolveHandle& thandle,
             // i = supercols[s]; i < supercols[s+1]; i++) printf("%d %d
             // %d\n",i,s,level );  // permute matrix based on scheduling
 
+#ifdef profile_supernodal_etree
             // total supernode size
             avg_nsrow += row_map(row + 1) - row_map(row);
             avg_nscol += supercols[s + 1] - supercols[s];
 
-#ifdef profile_supernodal_etree
             // gather static if requested
             signed_integral_t nscol = supercols[s + 1] - supercols[s];
             if (num_done + num_leave == 0) {
@@ -481,24 +526,15 @@ void lower_tri_symbolic(ExecSpaceIn& space, TriSolveHandle& thandle,
           max_lwork = lwork;
         }
 
+        // kernel types, by supernode size
+        supernodal_level_kernel_types(
+            supercols, size_unblocked, nodes_grouped_by_level, num_done,
+            num_leave, level, kernel_type_by_level, diag_kernel_type_by_level,
+            num_device_nodes);
+#ifdef profile_supernodal_etree
         // average supernode size at this level
         avg_nsrow /= num_leave;
         avg_nscol /= num_leave;
-        // kernel type
-        if (avg_nscol < size_unblocked) {
-          // batched unblocked
-          kernel_type_by_level(level)      = 0;
-          diag_kernel_type_by_level(level) = 0;
-          //} else if (avg_nscol < size_blocked) {
-          //  // batched blocked
-          //  kernel_type_by_level (level) = 1;
-          //  diag_kernel_type_by_level (level) = 1;
-        } else {
-          // device
-          kernel_type_by_level(level)      = 3;
-          diag_kernel_type_by_level(level) = 3;
-        }
-#ifdef profile_supernodal_etree
         std::cout << level << " : num_leave=" << num_leave
                   << ", nsrow=" << min_nsrow << ", " << avg_nsrow << ", "
                   << max_nsrow << ", nscol=" << min_nscol << ", " << avg_nscol
@@ -581,6 +617,8 @@ void lower_tri_symbolic(ExecSpaceIn& space, TriSolveHandle& thandle,
     integer_view_t ddiag_kernel_type_by_level = thandle.get_diag_kernel_type();
     Kokkos::deep_copy(space, ddiag_kernel_type_by_level,
                       diag_kernel_type_by_level);
+    // > number of device-level supernodes
+    Kokkos::deep_copy(space, thandle.get_num_device_nodes(), num_device_nodes);
 
     // deep copy to device (of scheduling info)
     Kokkos::deep_copy(space, dnodes_grouped_by_level, nodes_grouped_by_level);
@@ -612,6 +650,14 @@ void upper_tri_symbolic(ExecutionSpace& space, TriSolveHandle& thandle,
 #endif
 
   using namespace KokkosSparse::Experimental;
+  if (thandle.get_algorithm() == SPTRSVAlgorithm::SYNCFREE) {
+    // No schedule, only the ready flags of the solve (one per row, and the
+    // row counter)
+    using ReadyType = typename TriSolveHandle::nnz_lno_view_t;
+    thandle.set_syncfree_ready(ReadyType("syncfree_ready", drow_map.extent(0)));
+    thandle.set_symbolic_complete();
+    return;
+  }
   if (thandle.get_algorithm() == SPTRSVAlgorithm::SEQLVLSCHD_RP ||
       thandle.get_algorithm() == SPTRSVAlgorithm::SEQLVLSCHD_TP1 ||
       /*thandle.get_algorithm () == SPTRSVAlgorithm::SEQLVLSCHED_TP2*/
@@ -779,6 +825,7 @@ void upper_tri_symbolic(ExecutionSpace& space, TriSolveHandle& thandle,
     int size_unblocked             = thandle.get_supernode_size_unblocked();
     auto kernel_type_by_level      = thandle.get_kernel_type_host();
     auto diag_kernel_type_by_level = thandle.get_diag_kernel_type_host();
+    auto num_device_nodes          = thandle.get_num_device_nodes_host();
 
     // map node id to level that this node belongs to
     auto dlevel_list = thandle.get_level_list();
@@ -821,6 +868,7 @@ void upper_tri_symbolic(ExecutionSpace& space, TriSolveHandle& thandle,
           kernel_type_by_level(s)      = 3;
           diag_kernel_type_by_level(s) = 3;
         }
+        num_device_nodes(s) = (kernel_type_by_level(s) == 3 ? 1 : 0);
       }
     } else {
 /* schduling from bottom to top (as for L-solve) *
@@ -996,8 +1044,6 @@ void upper_tri_symbolic(ExecutionSpace& space, TriSolveHandle& thandle,
         // printf( " -> nodes_per_level(%d -> %d) = %d\n",num_level-level-1,
         // level, num_leave );
 
-        signed_integral_t avg_nscol = 0;
-        signed_integral_t avg_nsrow = 0;
         for (signed_integral_t task = 0; task < num_leave; task++) {
           // signed_integral_t s = inverse_nodes_grouped_by_level (nsuper -
           // (num_done+task) - 1);
@@ -1008,26 +1054,14 @@ void upper_tri_symbolic(ExecutionSpace& space, TriSolveHandle& thandle,
           level_list(s)                           = level;
           // printf( " -> level=%d: %d->%d: s=%d\n",level,
           // nsuper-(num_done+task)-1, num_done+task, s );
-
-          size_type row = supercols[s];
-          avg_nsrow += row_map(row + 1) - row_map(row);
-          avg_nscol += supercols[s + 1] - supercols[s];
         }
-        num_done += num_leave;
 
-        // average supernodal size at this level
-        avg_nscol /= num_leave;
-        avg_nsrow /= num_leave;
-        // kernel type
-        if (avg_nscol < size_unblocked) {
-          // batched unblocked
-          kernel_type_by_level(level)      = 0;
-          diag_kernel_type_by_level(level) = 0;
-        } else {
-          // device
-          kernel_type_by_level(level)      = 3;
-          diag_kernel_type_by_level(level) = 3;
-        }
+        // kernel types, by supernode size
+        supernodal_level_kernel_types(
+            supercols, size_unblocked, nodes_grouped_by_level, num_done,
+            num_leave, level, kernel_type_by_level, diag_kernel_type_by_level,
+            num_device_nodes);
+        num_done += num_leave;
       }
 #ifdef TRISOLVE_SYMB_TIMERS
       std::cout << "   + scheduling time = " << timer.seconds() << std::endl;
@@ -1056,6 +1090,8 @@ void upper_tri_symbolic(ExecutionSpace& space, TriSolveHandle& thandle,
     // > diagonal
     integer_view_t ddiag_kernel_type_by_level = thandle.get_diag_kernel_type();
     Kokkos::deep_copy(ddiag_kernel_type_by_level, diag_kernel_type_by_level);
+    // > number of device-level supernodes
+    Kokkos::deep_copy(thandle.get_num_device_nodes(), num_device_nodes);
 
     // deep copy to device (info about scheduling)
     Kokkos::deep_copy(dnodes_grouped_by_level, nodes_grouped_by_level);
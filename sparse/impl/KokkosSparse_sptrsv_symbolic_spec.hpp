@@ -89,6 +89,9 @@ struct SPTRSV_SYMBOLIC<ExecutionSpace, KernelHandle, RowMapType, EntriesType,
   static void sptrsv_symbolic(const ExecutionSpace &space, KernelHandle *handle,
                               const RowMapType row_map,
                               const EntriesType entries) {
+    Kokkos::Profiling::pushRegion(KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+                                      ? "KokkosSparse::sptrsv_symbolic[ETI]"
+                                      : "KokkosSparse::sptrsv_symbolic[noETI]");
     auto sptrsv_handle = handle->get_sptrsv_handle();
     auto nrows         = row_map.extent(0) - 1;
     sptrsv_handle->new_init_handle(nrows);
@@ -100,6 +103,7 @@ struct SPTRSV_SYMBOLIC<ExecutionSpace, KernelHandle, RowMapType, EntriesType,
       Experimental::upper_tri_symbolic(space, *sptrsv_handle, row_map, entries);
       sptrsv_handle->set_symbolic_complete();
     }
+    Kokkos::Profiling::popRegion();
   }
 };
 #endif
@@ -0,0 +1,314 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_SUPERNODAL_CHOLESKY_IMPL_HPP_
+#define KOKKOSSPARSE_SUPERNODAL_CHOLESKY_IMPL_HPP_
+
+#include <algorithm>
+#include <vector>
+#include <Kokkos_Core.hpp>
+#include "Kokkos_ArithTraits.hpp"
+#include "KokkosSparse_findRelOffset.hpp"
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Potrf_Decl.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+namespace Impl {
+
+/// Symbolic analysis on the host: elimination tree, column structures of L
+/// (each one is the lower structure of A's column merged with the structures
+/// of its children in the tree), fundamental supernodes (a chain of columns
+/// whose structures are nested), and the levels of the supernodal tree.
+template <typename Factor, typename RowmapHost, typename EntriesHost>
+void supernodal_cholesky_symbolic_host(Factor &F, const int n,
+                                       const RowmapHost &rowmap,
+                                       const EntriesHost &entries) {
+  using integer_view_host_t = typename Factor::integer_view_host_t;
+  using integer_view_t      = typename Factor::integer_view_t;
+
+  // elimination tree, with path compression
+  std::vector<int> parent(n, -1), ancestor(n, -1);
+  for (int i = 0; i < n; i++) {
+    for (auto k = rowmap(i); k < rowmap(i + 1); k++) {
+      int r = entries(k);
+      if (r >= i) continue;
+      while (ancestor[r] != -1 && ancestor[r] != i) {
+        int next    = ancestor[r];
+        ancestor[r] = i;
+        r           = next;
+      }
+      if (ancestor[r] == -1) {
+        ancestor[r] = i;
+        parent[r]   = i;
+      }
+    }
+  }
+  std::vector<std::vector<int>> children(n);
+  for (int j = 0; j < n; j++) {
+    if (parent[j] != -1) children[parent[j]].push_back(j);
+  }
+
+  // lower structure of A, by columns
+  std::vector<std::vector<int>> structA(n);
+  for (int i = 0; i < n; i++) {
+    for (auto k = rowmap(i); k < rowmap(i + 1); k++) {
+      if (entries(k) < i) structA[entries(k)].push_back(i);
+    }
+  }
+
+  // structure of each column of L, below the diagonal
+  std::vector<std::vector<int>> structL(n);
+  std::vector<int> mark(n, -1);
+  for (int j = 0; j < n; j++) {
+    std::vector<int> &s = structL[j];
+    mark[j]             = j;
+    for (int i : structA[j]) {
+      if (mark[i] != j) {
+        mark[i] = j;
+        s.push_back(i);
+      }
+    }
+    for (int c : children[j]) {
+      for (int i : structL[c]) {
+        if (mark[i] != j) {
+          mark[i] = j;
+          s.push_back(i);
+        }
+      }
+    }
+    std::sort(s.begin(), s.end());
+  }
+
+  // fundamental supernodes: column j extends the supernode of column j-1 if
+  // j-1 is its only child and the structure of j-1 is j plus that of j
+  std::vector<int> supercols;
+  for (int j = 0; j < n; j++) {
+    const bool extends = j > 0 && parent[j - 1] == j &&
+                         children[j].size() == 1 &&
+                         structL[j - 1].size() == structL[j].size() + 1;
+    if (!extends) supercols.push_back(j);
+  }
+  const int nsuper = supercols.size();
+  supercols.push_back(n);
+
+  F.n         = n;
+  F.nsuper    = nsuper;
+  F.supercols = integer_view_host_t("supercols", nsuper + 1);
+  F.rowptr    = integer_view_host_t("rowptr", nsuper + 1);
+  F.valptr    = integer_view_host_t("valptr", nsuper + 1);
+  F.etree     = integer_view_host_t("etree", nsuper);
+  integer_view_host_t col2super("col2super", n);
+  for (int s = 0; s <= nsuper; s++) F.supercols(s) = supercols[s];
+  for (int s = 0; s < nsuper; s++) {
+    const int j1    = supercols[s];
+    const int j2    = supercols[s + 1];
+    const int nsrow = (j2 - j1) + structL[j2 - 1].size();
+    for (int j = j1; j < j2; j++) col2super(j) = s;
+    F.rowptr(s + 1) = F.rowptr(s) + nsrow;
+    F.valptr(s + 1) = F.valptr(s) + nsrow * (j2 - j1);
+  }
+  F.rowind = integer_view_host_t("rowind", F.rowptr(nsuper));
+  for (int s = 0; s < nsuper; s++) {
+    const int j1 = supercols[s];
+    const int j2 = supercols[s + 1];
+    int k        = F.rowptr(s);
+    for (int j = j1; j < j2; j++) F.rowind(k++) = j;
+    for (int i : structL[j2 - 1]) F.rowind(k++) = i;
+    F.etree(s) = (parent[j2 - 1] == -1 ? -1 : col2super(parent[j2 - 1]));
+  }
+
+  // levels of the supernodal tree (a parent comes after its children)
+  std::vector<int> level(nsuper, 0);
+  int nlevels = 0;
+  for (int s = 0; s < nsuper; s++) {
+    if (F.etree(s) != -1)
+      level[F.etree(s)] = std::max(level[F.etree(s)], level[s] + 1);
+    nlevels = std::max(nlevels, level[s] + 1);
+  }
+  F.level_ptr   = integer_view_host_t("level_ptr", nlevels + 1);
+  F.level_super = integer_view_host_t("level_super", nsuper);
+  for (int s = 0; s < nsuper; s++) F.level_ptr(level[s] + 1)++;
+  for (int l = 0; l < nlevels; l++) F.level_ptr(l + 1) += F.level_ptr(l);
+  std::vector<int> next(F.level_ptr.data(), F.level_ptr.data() + nlevels);
+  for (int s = 0; s < nsuper; s++) F.level_super(next[level[s]]++) = s;
+
+  // copy the structure to device
+  auto to_device = [](const integer_view_host_t &h, const char *label) {
+    integer_view_t d(label, h.extent(0));
+    Kokkos::deep_copy(d, h);
+    return d;
+  };
+  F.supercols_d   = to_device(F.supercols, "supercols");
+  F.rowptr_d      = to_device(F.rowptr, "rowptr");
+  F.rowind_d      = to_device(F.rowind, "rowind");
+  F.valptr_d      = to_device(F.valptr, "valptr");
+  F.level_super_d = to_device(F.level_super, "level_super");
+  F.col2super_d   = to_device(col2super, "col2super");
+  F.values        = typename Factor::values_view_t("values", F.valptr(nsuper));
+
+  F.symbolic_complete = true;
+  F.numeric_complete  = false;
+}
+
+/// Scatter the lower triangle of A into the (zeroed) panels, one row per
+/// thread: entry (i, k) goes to the row of i in the supernode of column k.
+template <typename Factor, typename RowmapView, typename EntriesView,
+          typename ValuesView>
+struct SupernodalCholeskyAssembleFunctor {
+  using integer_view_t = typename Factor::integer_view_t;
+  using values_view_t  = typename Factor::values_view_t;
+
+  RowmapView rowmap;
+  EntriesView entries;
+  ValuesView avalues;
+  integer_view_t supercols, rowptr, rowind, valptr, col2super;
+  values_view_t values;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const int i) const {
+    for (auto k = rowmap(i); k < rowmap(i + 1); k++) {
+      const int j = entries(k);
+      if (j > i) continue;
+      const int s     = col2super(j);
+      const int nsrow = rowptr(s + 1) - rowptr(s);
+      const int pos   = KokkosSparse::findRelOffset(
+          &rowind(rowptr(s)), nsrow, i, 0, true);
+      values(valptr(s) + pos + (j - supercols(s)) * nsrow) += avalues(k);
+    }
+  }
+};
+
+/// Factor the supernodes of one level of the elimination tree, one team per
+/// supernode (they are independent): L11 := chol(A11) with TeamPotrf,
+/// L21 := A21 * L11^{-H}, and the update A22 -= L21 * L21^H scattered into
+/// the ancestors with atomics, since supernodes of a level may share them.
+template <typename Factor, typename ExecutionSpace>
+struct SupernodalCholeskyFactorFunctor {
+  using scalar_t       = typename Factor::scalar_type;
+  using STS            = Kokkos::ArithTraits<scalar_t>;
+  using integer_view_t = typename Factor::integer_view_t;
+  using values_view_t  = typename Factor::values_view_t;
+  using member_t = typename Kokkos::TeamPolicy<ExecutionSpace>::member_type;
+  using panel_t  = Kokkos::View<scalar_t **, Kokkos::LayoutLeft,
+                               typename Factor::device_type,
+                               Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+  integer_view_t supercols, rowptr, rowind, valptr, col2super, level_super;
+  values_view_t values;
+  // a column, plus one, where the factorization failed (0 if none)
+  Kokkos::View<int, typename Factor::device_type> failed;
+  int level_begin;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const member_t &member) const {
+    const int s      = level_super(level_begin + member.league_rank());
+    const int j1     = supercols(s);
+    const int nscol  = supercols(s + 1) - j1;
+    const int nsrow  = rowptr(s + 1) - rowptr(s);
+    const int nsrow2 = nsrow - nscol;
+    const int *rows  = &rowind(rowptr(s));
+    panel_t P(&values(valptr(s)), nsrow, nscol);
+
+    // diagonal block
+    auto L11 = Kokkos::subview(P, Kokkos::make_pair(0, nscol), Kokkos::ALL());
+    const int info =
+        KokkosBatched::TeamPotrf<member_t, KokkosBatched::Uplo::Lower,
+                                 KokkosBatched::Algo::Potrf::Unblocked>::
+            invoke(member, L11);
+    if (info != 0) {
+      Kokkos::single(Kokkos::PerTeam(member), [&]() {
+        Kokkos::atomic_max(&failed(), j1 + info);
+      });
+      return;
+    }
+    member.team_barrier();
+
+    // off-diagonal rows, each one by forward substitution with L11^H
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(member, nsrow2), [&](const int r) {
+          const int i = nscol + r;
+          for (int k = 0; k < nscol; k++) {
+            scalar_t x = P(i, k);
+            for (int m = 0; m < k; m++) x -= P(i, m) * STS::conj(L11(k, m));
+            P(i, k) = x / STS::conj(L11(k, k));
+          }
+        });
+    member.team_barrier();
+
+    // update the ancestors: column b of the update goes to the supernode of
+    // row b, and its rows a >= b to their positions in that supernode
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(member, nsrow2), [&](const int b) {
+          const int col    = rows[nscol + b];
+          const int t      = col2super(col);
+          const int tnsrow = rowptr(t + 1) - rowptr(t);
+          const int *trows = &rowind(rowptr(t));
+          // column col of supernode t
+          scalar_t *tcol = &values(valptr(t) + (col - supercols(t)) * tnsrow);
+          Kokkos::parallel_for(
+              Kokkos::ThreadVectorRange(member, b, nsrow2), [&](const int a) {
+                scalar_t sum = STS::zero();
+                for (int k = 0; k < nscol; k++)
+                  sum += P(nscol + a, k) * STS::conj(P(nscol + b, k));
+                const int pos = KokkosSparse::findRelOffset(
+                    trows, tnsrow, rows[nscol + a], 0, true);
+                Kokkos::atomic_add(&tcol[pos], -sum);
+              });
+        });
+  }
+};
+
+/// Numeric factorization on the device. Returns a column where A was found
+/// not positive definite, or -1.
+template <typename Factor, typename RowmapView, typename EntriesView,
+          typename ValuesView>
+int supernodal_cholesky_numeric_device(Factor &F, const RowmapView &rowmap,
+                                       const EntriesView &entries,
+                                       const ValuesView &avalues) {
+  using execution_space = typename Factor::execution_space;
+  using scalar_t        = typename Factor::scalar_type;
+  using range_policy_t  = Kokkos::RangePolicy<execution_space>;
+  using team_policy_t   = Kokkos::TeamPolicy<execution_space>;
+  using assemble_t = SupernodalCholeskyAssembleFunctor<Factor, RowmapView,
+                                                       EntriesView, ValuesView>;
+  using factor_t = SupernodalCholeskyFactorFunctor<Factor, execution_space>;
+
+  Kokkos::deep_copy(F.values, Kokkos::ArithTraits<scalar_t>::zero());
+  Kokkos::parallel_for(
+      "KokkosSparse::supernodal_cholesky::assemble", range_policy_t(0, F.n),
+      assemble_t{rowmap, entries, avalues, F.supercols_d, F.rowptr_d,
+                 F.rowind_d, F.valptr_d, F.col2super_d, F.values});
+
+  Kokkos::View<int, typename Factor::device_type> failed("failed");
+  const int nlevels = F.level_ptr.extent(0) - 1;
+  for (int l = 0; l < nlevels; l++) {
+    const int begin = F.level_ptr(l);
+    const int count = F.level_ptr(l + 1) - begin;
+    Kokkos::parallel_for(
+        "KokkosSparse::supernodal_cholesky::factor",
+        team_policy_t(count, Kokkos::AUTO, Kokkos::AUTO),
+        factor_t{F.supercols_d, F.rowptr_d, F.rowind_d, F.valptr_d,
+                 F.col2super_d, F.level_super_d, F.values, failed, begin});
+  }
+  int failed_host = 0;
+  Kokkos::deep_copy(failed_host, failed);
+  return failed_host - 1;
+}
+
+}  // namespace Impl
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SUPERNODAL_CHOLESKY_IMPL_HPP_
@@ -110,6 +110,9 @@ struct TRSV<CrsMatrixType, DomainMultiVectorType, RangeMultiVectorType, false,
                    const CrsMatrixType &A, DomainMultiVectorType B,
                    RangeMultiVectorType X)  // X is the output MV
   {
+    Kokkos::Profiling::pushRegion(KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+                                      ? "KokkosSparse::trsv[ETI]"
+                                      : "KokkosSparse::trsv[noETI]");
     using Wrap = Sequential::TrsvWrap<CrsMatrixType, DomainMultiVectorType,
                                       RangeMultiVectorType>;
     if (trans[0] == 'N' || trans[0] == 'n') {    // no transpose
@@ -159,6 +162,7 @@ struct TRSV<CrsMatrixType, DomainMultiVectorType, RangeMultiVectorType, false,
         }
       }
     }
+    Kokkos::Profiling::popRegion();
   }
 };
 
@@ -119,6 +119,10 @@ class TwostageGaussSeidel {
   struct Tag_valuesLU {};
   // tag for computing residual norm
   struct Tag_normR {};
+  // tag for computing norm of the starting vector of inner JR
+  struct Tag_normZ {};
+  // tag for copying new iterate of inner JR, while computing norm of its change
+  struct Tag_updateZ {};
 
   template <typename output_row_map_view_t, typename output_entries_view_t,
             typename output_values_view_t>
@@ -514,6 +518,39 @@ class TwostageGaussSeidel {
       normR += ST::abs(normRi * normRi);
     }
   };
+
+  // functor for the adaptive inner JR sweeps (norms over all the RHSs)
+  struct TwostageJacobiRichardson_functor {
+    internal_vector_view_t localR;
+    internal_vector_view_t localZ;
+
+    TwostageJacobiRichardson_functor(internal_vector_view_t localR_,
+                                     internal_vector_view_t localZ_)
+        : localR(localR_), localZ(localZ_) {}
+
+    // ------------------------------------------------------- //
+    // functor for computing norm of R (with parallel_reduce)
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const Tag_normZ &, const ordinal_t i, mag_t &normZ) const {
+      for (size_t j = 0; j < localR.extent(1); j++) {
+        const mag_t r = ST::abs(localR(i, j));
+        normZ += r * r;
+      }
+    }
+
+    // ------------------------------------------------------- //
+    // functor for computing norm of Z-R, and copying Z into R
+    // (with parallel_reduce)
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const Tag_updateZ &, const ordinal_t i,
+                    mag_t &normDz) const {
+      for (size_t j = 0; j < localR.extent(1); j++) {
+        const mag_t dz = ST::abs(localZ(i, j) - localR(i, j));
+        normDz += dz * dz;
+        localR(i, j) = localZ(i, j);
+      }
+    }
+  };
   // --------------------------------------------------------- //
 
  public:
@@ -915,6 +952,13 @@ class TwostageGaussSeidel {
     if (direction == GS_SYMMETRIC) {
       NumSweeps *= 2;
     }
+    // with a positive inner tolerance, NumInnerSweeps is only the maximum
+    using MT           = Kokkos::ArithTraits<mag_t>;
+    using JR_Functor_t = TwostageJacobiRichardson_functor;
+
+    const mag_t inner_tol       = gsHandle->getInnerTolerance();
+    const bool adaptive         = (inner_tol > MT::zero());
+    int NumInnerSweepsPerformed = 0;
     if (init_zero_x_vector) {
       KokkosKernels::Impl::zero_vector<x_value_array_type, execution_space>(
           nrhs, localX);
@@ -1061,6 +1105,14 @@ class TwostageGaussSeidel {
             KokkosBlas::scal(localR, gamma, localR);
           }
         }
+        // norm of the starting vector, to scale the inner tolerance
+        mag_t normZ0 = MT::zero();
+        if (adaptive && NumInnerSweeps > 0) {
+          using range_policy = Kokkos::RangePolicy<Tag_normZ, execution_space>;
+          Kokkos::parallel_reduce("normZ", range_policy(0, num_rows),
+                                  JR_Functor_t(localR, localZ), normZ0);
+          normZ0 = MT::sqrt(normZ0);
+        }
 #ifdef KOKKOSSPARSE_IMPL_TIME_TWOSTAGE_GS
         {
           // compute residual norm of the starting vector (D^{-1}R)
@@ -1075,6 +1127,7 @@ class TwostageGaussSeidel {
 #endif
         // inner Jacobi-Richardson:
         for (int ii = 0; ii < NumInnerSweeps; ii++) {
+          NumInnerSweepsPerformed++;
           // T = D^{-1}*R, and L = D^{-1}*L and U = D^{-1}*U
           // copy T into Z
           KokkosBlas::scal(localZ, one, localT);
@@ -1095,9 +1148,20 @@ class TwostageGaussSeidel {
             scalar_t gamma2 = one - gamma;
             KokkosBlas::axpy(gamma2, localR, localZ);
           }
+          bool inner_converged = false;
           if (ii + 1 < NumInnerSweeps) {
-            // reinitialize (R to be Z)
-            KokkosBlas::scal(localR, one, localZ);
+            if (adaptive) {
+              // reinitialize (R to be Z), and check the change in the iterate
+              using range_policy =
+                  Kokkos::RangePolicy<Tag_updateZ, execution_space>;
+              mag_t normDz = MT::zero();
+              Kokkos::parallel_reduce("updateZ", range_policy(0, num_rows),
+                                      JR_Functor_t(localR, localZ), normDz);
+              inner_converged = (MT::sqrt(normDz) <= inner_tol * normZ0);
+            } else {
+              // reinitialize (R to be Z)
+              KokkosBlas::scal(localR, one, localZ);
+            }
           }
 #ifdef KOKKOSSPARSE_IMPL_TIME_TWOSTAGE_GS
           {
@@ -1112,6 +1176,7 @@ class TwostageGaussSeidel {
                       << std::endl;
           }
 #endif
+          if (inner_converged) break;
         }  // end of inner Jacobi Richardson
 
         // update solution
@@ -1126,6 +1191,7 @@ class TwostageGaussSeidel {
         }
       }  // end of inner GS sweep
     }    // end of outer GS sweep
+    gsHandle->setNumInnerSweepsPerformed(NumInnerSweepsPerformed);
 #ifdef KOKKOSSPARSE_IMPL_TIME_TWOSTAGE_GS
     {
       // R = B - A*x
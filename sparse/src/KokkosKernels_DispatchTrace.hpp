@@ -0,0 +1,187 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSKERNELS_DISPATCHTRACE_HPP
+#define KOKKOSKERNELS_DISPATCHTRACE_HPP
+
+/// \file KokkosKernels_DispatchTrace.hpp
+/// \brief Opt-in log of the implementation chosen by each kernel call
+///
+/// When enabled, every traced call writes one JSON object per line with the
+/// kernel, the matrix dimensions and nnz, the algorithm, whether a TPL or
+/// the native implementation ran, the team and vector sizes, and the
+/// elapsed time, and for some kernels a "detail" object (e.g. the
+/// statistics behind the SpGEMM algorithm selection). The trace is enabled
+/// by the environment variable KOKKOSKERNELS_DISPATCH_TRACE, or by the
+/// "dispatch_trace" parameter of a Controls object passed to
+/// set_dispatch_trace(). The value is "stderr", "stdout" or the path of a
+/// file to append to; "" or "0" disables it.
+/// Timing a call fences its execution space, so leave the trace off in
+/// production runs that are not being tuned.
+
+#include <atomic>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <Kokkos_Core.hpp>
+#include "KokkosKernels_Controls.hpp"
+
+namespace KokkosKernels {
+namespace Impl {
+
+struct DispatchTraceSink {
+  std::mutex mutex;
+  std::ofstream file;
+  std::ostream *out = nullptr;
+  // Read without the mutex by every traced call
+  std::atomic<bool> active{false};
+
+  void open(const std::string &destination) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (file.is_open()) file.close();
+    out = nullptr;
+    if (destination == "stderr") {
+      out = &std::cerr;
+    } else if (destination == "stdout") {
+      out = &std::cout;
+    } else if (!destination.empty() && destination != "0") {
+      file.open(destination, std::ios::app);
+      if (file) out = &file;
+    }
+    active = out != nullptr;
+  }
+
+  void write(const std::string &line) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (out) (*out) << line << std::endl;
+  }
+};
+
+inline DispatchTraceSink &dispatch_trace_sink() {
+  static DispatchTraceSink sink;
+  static std::once_flag from_environment;
+  std::call_once(from_environment, [] {
+    const char *env = std::getenv("KOKKOSKERNELS_DISPATCH_TRACE");
+    if (env) sink.open(env);
+  });
+  return sink;
+}
+
+inline bool dispatch_trace_enabled() {
+  return dispatch_trace_sink().active.load(std::memory_order_relaxed);
+}
+
+/// \brief Records one dispatch decision, written when it goes out of scope.
+///
+/// Construct it where a kernel chooses its implementation and fill in what
+/// is known there. Does nothing unless the trace is enabled.
+template <class ExecSpace>
+class DispatchTrace {
+ public:
+  DispatchTrace(const char *kernel_, const ExecSpace &space_)
+      : enabled(dispatch_trace_enabled()),
+        uncaught(std::uncaught_exceptions()),
+        kernel(kernel_),
+        space(space_) {
+    if (enabled) {
+      space.fence();
+      timer.reset();
+    }
+  }
+
+  ~DispatchTrace() {
+    // A call that threw did not complete, so it is not logged
+    if (!enabled || std::uncaught_exceptions() > uncaught) return;
+    space.fence();
+    const double seconds = timer.seconds();
+    std::ostringstream os;
+    os << "{\"kernel\":\"" << kernel << "\",\"exec_space\":\""
+       << ExecSpace::name() << "\",\"rows\":" << rows << ",\"cols\":" << cols
+       << ",\"nnz\":" << nnz << ",\"algorithm\":\"" << algorithm
+       << "\",\"impl\":\"" << (tpl ? "tpl" : "native")
+       << "\",\"team_size\":" << team_size
+       << ",\"vector_size\":" << vector_size << ",\"seconds\":" << seconds;
+    if (!detail.empty()) os << ",\"detail\":" << detail;
+    os << "}";
+    dispatch_trace_sink().write(os.str());
+  }
+
+  DispatchTrace(const DispatchTrace &)            = delete;
+  DispatchTrace &operator=(const DispatchTrace &) = delete;
+
+  bool is_enabled() const { return enabled; }
+
+  void set_dims(size_t rows_, size_t cols_, size_t nnz_) {
+    rows = rows_;
+    cols = cols_;
+    nnz  = nnz_;
+  }
+  void set_algorithm(const std::string &algorithm_) {
+    if (enabled) algorithm = algorithm_;
+  }
+  void set_tpl(bool tpl_) { tpl = tpl_; }
+  /// Team and vector sizes of the launch; -1 means chosen by the kernel.
+  void set_launch(int team_size_, int vector_size_) {
+    team_size   = team_size_;
+    vector_size = vector_size_;
+  }
+  /// Kernel specific data, a JSON object (e.g. the statistics of an
+  /// algorithm selection), logged as "detail".
+  void set_detail(const std::string &detail_) {
+    if (enabled) detail = detail_;
+  }
+
+ private:
+  bool enabled;
+  int uncaught;
+  const char *kernel;
+  ExecSpace space;
+  Kokkos::Timer timer;
+  size_t rows = 0, cols = 0, nnz = 0;
+  std::string algorithm;
+  bool tpl        = false;
+  int team_size   = -1;
+  int vector_size = -1;
+  std::string detail;
+};
+
+}  // namespace Impl
+
+namespace Experimental {
+
+/// \brief Enable (or disable) the dispatch trace, overriding the
+/// KOKKOSKERNELS_DISPATCH_TRACE environment variable.
+///
+/// \param destination "stderr", "stdout", a file path, or "" to disable
+inline void set_dispatch_trace(const std::string &destination) {
+  KokkosKernels::Impl::dispatch_trace_sink().open(destination);
+}
+
+/// \brief Set the dispatch trace from the "dispatch_trace" parameter of
+/// \c controls. Does nothing if the parameter is not set.
+inline void set_dispatch_trace(const Controls &controls) {
+  if (controls.isParameter("dispatch_trace"))
+    set_dispatch_trace(controls.getParameter("dispatch_trace"));
+}
+
+}  // namespace Experimental
+}  // namespace KokkosKernels
+
+#endif  // KOKKOSKERNELS_DISPATCHTRACE_HPP
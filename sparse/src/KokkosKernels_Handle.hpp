@@ -23,6 +23,8 @@
 #include "KokkosSparse_spiluk_handle.hpp"
 #include "KokkosSparse_par_ilut_handle.hpp"
 #include "KokkosSparse_gmres_handle.hpp"
+#include "KokkosSparse_cg_handle.hpp"
+#include "KokkosSparse_bicgstab_handle.hpp"
 #include "KokkosKernels_default_types.hpp"
 
 #ifndef _KOKKOSKERNELHANDLE_HPP
@@ -161,6 +163,8 @@ class KokkosKernelsHandle {
     this->spilukHandle   = right_side_handle.get_spiluk_handle();
     this->par_ilutHandle = right_side_handle.get_par_ilut_handle();
     this->gmresHandle    = right_side_handle.get_gmres_handle();
+    this->cgHandle       = right_side_handle.get_cg_handle();
+    this->bicgstabHandle = right_side_handle.get_bicgstab_handle();
 
     this->team_work_size      = right_side_handle.get_set_team_work_size();
     this->shared_memory_size  = right_side_handle.get_shmem_size();
@@ -185,6 +189,8 @@ class KokkosKernelsHandle {
     is_owner_of_the_spiluk_handle   = false;
     is_owner_of_the_par_ilut_handle = false;
     is_owner_of_the_gmres_handle    = false;
+    is_owner_of_the_cg_handle       = false;
+    is_owner_of_the_bicgstab_handle = false;
     // return *this;
   }
 
@@ -289,6 +295,16 @@ class KokkosKernelsHandle {
       HandleTempMemorySpace, HandlePersistentMemorySpace>
       GMRESHandleType;
 
+  typedef typename KokkosSparse::Experimental::CGHandle<
+      const_size_type, const_nnz_lno_t, const_nnz_scalar_t, HandleExecSpace,
+      HandleTempMemorySpace, HandlePersistentMemorySpace>
+      CGHandleType;
+
+  typedef typename KokkosSparse::Experimental::BiCGStabHandle<
+      const_size_type, const_nnz_lno_t, const_nnz_scalar_t, HandleExecSpace,
+      HandleTempMemorySpace, HandlePersistentMemorySpace>
+      BiCGStabHandleType;
+
  private:
   GraphColoringHandleType *gcHandle;
   GraphColorDistance2HandleType *gcHandle_d2;
@@ -306,6 +322,8 @@ class KokkosKernelsHandle {
   SPILUKHandleType *spilukHandle;
   PAR_ILUTHandleType *par_ilutHandle;
   GMRESHandleType *gmresHandle;
+  CGHandleType *cgHandle;
+  BiCGStabHandleType *bicgstabHandle;
 
   int team_work_size;
   size_t shared_memory_size;
@@ -330,6 +348,8 @@ class KokkosKernelsHandle {
   bool is_owner_of_the_spiluk_handle;
   bool is_owner_of_the_par_ilut_handle;
   bool is_owner_of_the_gmres_handle;
+  bool is_owner_of_the_cg_handle;
+  bool is_owner_of_the_bicgstab_handle;
 
  public:
   KokkosKernelsHandle()
@@ -348,6 +368,8 @@ class KokkosKernelsHandle {
         spilukHandle(NULL),
         par_ilutHandle(NULL),
         gmresHandle(NULL),
+        cgHandle(NULL),
+        bicgstabHandle(NULL),
         team_work_size(-1),
         shared_memory_size(16128),
         suggested_team_size(-1),
@@ -370,7 +392,9 @@ class KokkosKernelsHandle {
         is_owner_of_the_sptrsv_handle(true),
         is_owner_of_the_spiluk_handle(true),
         is_owner_of_the_par_ilut_handle(true),
-        is_owner_of_the_gmres_handle(true) {}
+        is_owner_of_the_gmres_handle(true),
+        is_owner_of_the_cg_handle(true),
+        is_owner_of_the_bicgstab_handle(true) {}
 
   ~KokkosKernelsHandle() {
     this->destroy_gs_handle();
@@ -387,6 +411,8 @@ class KokkosKernelsHandle {
     this->destroy_spiluk_handle();
     this->destroy_par_ilut_handle();
     this->destroy_gmres_handle();
+    this->destroy_cg_handle();
+    this->destroy_bicgstab_handle();
   }
 
   void set_verbose(bool verbose_) { this->KKVERBOSE = verbose_; }
@@ -712,6 +738,14 @@ class KokkosKernelsHandle {
     gs2->setInnerDampFactor(damp_factor);
   }
   // ---------------------------------------- //
+  // Specify relative tolerance of inner sweeps for two-stage Gauss-Seidel
+  // (the number of inner sweeps then becomes a maximum)
+  void set_gs_set_inner_tolerance(
+      typename Kokkos::ArithTraits<nnz_scalar_t>::mag_type inner_tol) {
+    auto gs2 = get_twostage_gs_handle();
+    gs2->setInnerTolerance(inner_tol);
+  }
+  // ---------------------------------------- //
   // Specify to use either Two-stage or Classical (i.e., inner Jacobi-Richardson
   // or SpTrsv)
   void set_gs_twostage(bool two_stage, size_type nrows) {
@@ -750,6 +784,8 @@ class KokkosKernelsHandle {
    *                    KokkosSparse::CLUSTER_DEFAULT           ??
    *                    KokkosSparse::CLUSTER_MIS2              ??
    *                    KokkosSparse::CLUSTER_BALLOON           ??
+   *                    KokkosSparse::CLUSTER_HEC               Multilevel heavy edge coarsening
+   *                    KokkosSparse::CLUSTER_MATCH             Multilevel heavy edge matching
    *                    KokkosSparse::NUM_CLUSTERING_ALGORITHMS ??
    * @param hint_verts_per_cluster Hint how many verticies to use per cluster
    * @param coloring_algorithm Specifies which coloring algorithm to color the graph with:
@@ -1002,6 +1038,35 @@ class KokkosKernelsHandle {
     }
   }
 
+  CGHandleType *get_cg_handle() { return this->cgHandle; }
+  void create_cg_handle(const typename CGHandleType::float_t tol = 1e-8,
+                        const int max_iters                      = 1000) {
+    this->destroy_cg_handle();
+    this->is_owner_of_the_cg_handle = true;
+    this->cgHandle                  = new CGHandleType(tol, max_iters);
+  }
+  void destroy_cg_handle() {
+    if (is_owner_of_the_cg_handle && this->cgHandle != nullptr) {
+      delete this->cgHandle;
+      this->cgHandle = nullptr;
+    }
+  }
+
+  BiCGStabHandleType *get_bicgstab_handle() { return this->bicgstabHandle; }
+  void create_bicgstab_handle(
+      const typename BiCGStabHandleType::float_t tol = 1e-8,
+      const int max_iters                            = 1000) {
+    this->destroy_bicgstab_handle();
+    this->is_owner_of_the_bicgstab_handle = true;
+    this->bicgstabHandle = new BiCGStabHandleType(tol, max_iters);
+  }
+  void destroy_bicgstab_handle() {
+    if (is_owner_of_the_bicgstab_handle && this->bicgstabHandle != nullptr) {
+      delete this->bicgstabHandle;
+      this->bicgstabHandle = nullptr;
+    }
+  }
+
 };  // end class KokkosKernelsHandle
 
 }  // namespace Experimental
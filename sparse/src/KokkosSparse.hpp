@@ -29,8 +29,12 @@
 /// It solves Ax=b, where A is either upper or lower triangular.
 #include "KokkosSparse_CrsMatrix.hpp"
 #include "KokkosSparse_spmv.hpp"
+#include "KokkosSparse_spmv_dot.hpp"
 #include "KokkosSparse_trsv.hpp"
 #include "KokkosSparse_spgemm.hpp"
 #include "KokkosSparse_gauss_seidel.hpp"
 #include "KokkosSparse_par_ilut.hpp"
 #include "KokkosSparse_gmres.hpp"
+#include "KokkosSparse_gmres_ir.hpp"
+#include "KokkosSparse_cg.hpp"
+#include "KokkosSparse_bicgstab.hpp"
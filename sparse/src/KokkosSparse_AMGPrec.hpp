@@ -0,0 +1,303 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// @file KokkosSparse_AMGPrec.hpp
+
+#ifndef KK_AMG_PREC_HPP
+#define KK_AMG_PREC_HPP
+
+#include <vector>
+#include <KokkosSparse_Preconditioner.hpp>
+#include <Kokkos_Core.hpp>
+#include <KokkosBlas.hpp>
+#include <KokkosSparse_spmv.hpp>
+#include <KokkosSparse_spgemm.hpp>
+#include <KokkosSparse_spgemm_rap.hpp>
+#include <KokkosSparse_Utils.hpp>
+#include <KokkosSparse_ChebyshevPrec.hpp>
+#include "KokkosGraph_MIS2.hpp"
+#include "KokkosKernels_Error.hpp"
+#include "KokkosSparse_amg_impl.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+
+/// \class AMGPrec
+/// \brief Smoothed aggregation algebraic multigrid preconditioner: apply
+///        does one V-cycle from a zero initial guess.
+/// \tparam CRS the type of compressed matrix
+///
+/// compute() builds the hierarchy on the device. On each level the
+/// vertices are aggregated with graph_mis2_aggregate (so the graph of A
+/// must be symmetric), the tentative prolongator P0 maps each aggregate to
+/// a constant, and it is smoothed with one damped Jacobi step,
+/// P = (I - 4 / (3 lambda_max) D^inv A) P0, through an SpGEMM. The
+/// restriction is R = P^T and the coarse matrix is the Galerkin product
+/// R A P (spgemm_rap). Coarsening stops at max_levels levels, once a level
+/// has at most coarse_size rows, or when the aggregation no longer reduces
+/// the size. Every level but the coarsest is smoothed with a ChebyshevPrec
+/// before and after the coarse correction. The coarsest level is solved
+/// with a dense LU factorization (without pivoting) if it has at most
+/// coarse_size rows, else it is only smoothed.
+///
+/// A must have its diagonal entries.
+///
+/// AMGPrec provides the following methods
+///   - initialize() Does nothing.
+///   - isInitialized() returns true
+///   - compute() Builds the hierarchy.
+///   - isComputed() returns true once compute() has been called
+///
+template <class CRS>
+class AMGPrec : public KokkosSparse::Experimental::Preconditioner<CRS> {
+ public:
+  using ScalarType = typename std::remove_const<typename CRS::value_type>::type;
+  using EXSP       = typename CRS::execution_space;
+  using MEMSP      = typename CRS::memory_space;
+  using DEVICE     = typename Kokkos::Device<EXSP, MEMSP>;
+  using karith     = typename Kokkos::ArithTraits<ScalarType>;
+  using MagType    = typename karith::mag_type;
+  using View1d     = typename Kokkos::View<ScalarType *, DEVICE>;
+  using CView1d    = typename Kokkos::View<const ScalarType *, DEVICE>;
+  using lno_t      = typename CRS::non_const_ordinal_type;
+  using size_type  = typename CRS::non_const_size_type;
+  using matrix_t =
+      KokkosSparse::CrsMatrix<ScalarType, lno_t, DEVICE, void, size_type>;
+  using smoother_t = ChebyshevPrec<matrix_t>;
+  using dense_t    = Kokkos::View<ScalarType **, Kokkos::LayoutRight, DEVICE>;
+
+  static_assert(is_crs_matrix<CRS>::value,
+                "AMGPrec: CRS must be a KokkosSparse::CrsMatrix");
+
+ private:
+  int _max_levels;
+  lno_t _coarse_size;
+  int _smoother_degree;
+  // Level l has the matrix _A[l]; _P[l] and _R[l] map between the levels l
+  // and l + 1
+  std::vector<matrix_t> _A, _P, _R;
+  std::vector<smoother_t> _smoothers;
+  dense_t _coarse_lu;
+  bool _coarse_direct;
+  // Right-hand side (except on level 0), solution and residual of each level
+  std::vector<View1d> _b, _x, _r;
+  bool _is_computed;
+
+ public:
+  //! Constructor: the hierarchy has at most max_levels levels, and the
+  //! Chebyshev smoothers have the degree smoother_degree
+  template <class CRSArg>
+  AMGPrec(const CRSArg &A, const int max_levels = 10,
+          const lno_t coarse_size = 100, const int smoother_degree = 2)
+      : _max_levels(max_levels),
+        _coarse_size(coarse_size),
+        _smoother_degree(smoother_degree),
+        _coarse_direct(false),
+        _is_computed(false) {
+    KK_REQUIRE_MSG(A.numRows() == A.numCols(),
+                   "AMGPrec: the matrix must be square");
+    KK_REQUIRE_MSG(_max_levels >= 1, "AMGPrec: max_levels must be at least 1");
+    KK_REQUIRE_MSG(_smoother_degree >= 1,
+                   "AMGPrec: smoother_degree must be at least 1");
+    _A.emplace_back(A);
+  }
+
+  //! Destructor.
+  virtual ~AMGPrec() {}
+
+  //! Number of levels of the hierarchy, set by compute()
+  int getNumLevels() const { return _is_computed ? int(_A.size()) : 0; }
+
+  //! Matrix of the given level, with level 0 the input matrix
+  matrix_t getLevelMatrix(const int level) const { return _A.at(level); }
+
+  ///// \brief Apply the preconditioner to X, putting the result in Y.
+  /////
+  ///// \param transM [in] Only "N" is supported.
+  ///// \param alpha [in] Input coefficient of M*x
+  ///// \param beta [in] Input coefficient of Y
+  /////
+  ///// Computes Y = beta Y + alpha M X, with M X one V-cycle for A y = X.
+  //
+  virtual void apply(const CView1d &X,
+                     const Kokkos::View<ScalarType *, DEVICE> &Y,
+                     const char transM[] = "N",
+                     ScalarType alpha    = karith::one(),
+                     ScalarType beta     = karith::zero()) const {
+    KK_REQUIRE_MSG(transM[0] == NoTranspose[0],
+                   "AMGPrec::apply only supports 'N' for transM");
+    KK_REQUIRE_MSG(_is_computed, "AMGPrec::apply called before compute()");
+
+    const ScalarType one = karith::one(), zero = karith::zero();
+    const int coarsest   = int(_A.size()) - 1;
+
+    for (int l = 0; l < coarsest; l++) {
+      const CView1d b = l ? CView1d(_b[l]) : X;
+      _smoothers[l].apply(b, _x[l]);
+      residual(l, b);
+      KokkosSparse::spmv("N", one, _R[l], _r[l], zero, _b[l + 1]);
+    }
+    coarse_solve(coarsest ? CView1d(_b[coarsest]) : X);
+    for (int l = coarsest - 1; l >= 0; l--) {
+      const CView1d b = l ? CView1d(_b[l]) : X;
+      KokkosSparse::spmv("N", one, _P[l], _x[l + 1], one, _x[l]);
+      residual(l, b);
+      _smoothers[l].apply(_r[l], _x[l], "N", one, one);
+    }
+
+    KokkosBlas::axpby(alpha, _x[0], beta, Y);
+  }
+  //@}
+
+  //! Set this preconditioner's parameters.
+  void setParameters() {}
+
+  void initialize() {}
+
+  //! True if the preconditioner has been successfully initialized, else false.
+  bool isInitialized() const { return true; }
+
+  //! Builds the hierarchy, the smoothers and the coarsest factorization
+  void compute() {
+    using row_map_t   = typename matrix_t::row_map_type::non_const_type;
+    using values_t    = typename matrix_t::values_type::non_const_type;
+    using tentative_t = KokkosSparse::Impl::AMGTentativeProlongatorFunctor<
+        row_map_t, values_t>;
+
+    _A.resize(1);
+    _P.clear();
+    _R.clear();
+    _smoothers.clear();
+
+    for (;;) {
+      const matrix_t A = _A.back();
+      const lno_t n    = A.numRows();
+      _smoothers.emplace_back(A, _smoother_degree);
+      _smoothers.back().compute();
+      if (n <= _coarse_size || int(_A.size()) >= _max_levels) break;
+
+      lno_t num_aggs = 0;
+      auto labels    = KokkosGraph::graph_mis2_aggregate<DEVICE>(
+          A.graph.row_map, A.graph.entries, num_aggs);
+      if (num_aggs <= 0 || num_aggs >= n) break;
+
+      // Tentative prolongator, with the labels as its entries
+      row_map_t p0_row_map(
+          Kokkos::view_alloc(Kokkos::WithoutInitializing, "AMG P0 row_map"),
+          n + 1);
+      values_t p0_values(
+          Kokkos::view_alloc(Kokkos::WithoutInitializing, "AMG P0 values"), n);
+      Kokkos::parallel_for("KokkosSparse::AMGPrec::tentative_prolongator",
+                           Kokkos::RangePolicy<EXSP>(0, n + 1),
+                           tentative_t{p0_row_map, p0_values, size_type(n)});
+      const matrix_t P0("AMG P0", n, num_aggs, n, p0_values, p0_row_map,
+                        labels);
+
+      // P = (I - omega D^inv A) P0
+      matrix_t P = KokkosSparse::spgemm<matrix_t>(A, false, P0, false);
+      smooth_prolongator(P, labels, _smoothers.back());
+
+      matrix_t R = KokkosSparse::Impl::sorted_transpose_matrix(P);
+      _A.push_back(KokkosSparse::Experimental::spgemm_rap<matrix_t>(R, A, P));
+      _P.push_back(P);
+      _R.push_back(R);
+    }
+
+    factor_coarsest();
+
+    _b.clear();
+    _x.clear();
+    _r.clear();
+    for (const auto &A : _A) {
+      const lno_t n = A.numRows();
+      _b.emplace_back("AMGPrec::_b", _b.empty() ? 0 : n);
+      _x.emplace_back("AMGPrec::_x", n);
+      _r.emplace_back("AMGPrec::_r", n);
+    }
+    _is_computed = true;
+  }
+
+  //! True if the preconditioner has been successfully computed, else false.
+  bool isComputed() const { return _is_computed; }
+
+ private:
+  // Damped Jacobi step on the prolongator A P0, in place, with the inverse
+  // diagonal and the eigenvalue estimate of the level smoother
+  template <class LabelsType>
+  void smooth_prolongator(const matrix_t &P, const LabelsType &labels,
+                          const smoother_t &smoother) {
+    using functor_t = KokkosSparse::Impl::AMGSmoothProlongatorFunctor<
+        typename matrix_t::row_map_type, typename matrix_t::index_type,
+        typename matrix_t::values_type, LabelsType, View1d>;
+
+    const ScalarType omega =
+        ScalarType(MagType(4) / (MagType(3) * smoother.getLambdaMax()));
+    Kokkos::parallel_for(
+        "KokkosSparse::AMGPrec::smooth_prolongator",
+        Kokkos::RangePolicy<EXSP>(0, P.numRows()),
+        functor_t{P.graph.row_map, P.graph.entries, P.values, labels,
+                  smoother.getInverseDiagonal(), omega});
+  }
+
+  // Dense LU factorization of the coarsest matrix, if it is small enough
+  void factor_coarsest() {
+    using fill_t = KokkosSparse::Impl::AMGDenseFillFunctor<
+        typename matrix_t::row_map_type, typename matrix_t::index_type,
+        typename matrix_t::values_type, dense_t>;
+    using lu_t = KokkosSparse::Impl::AMGDenseLUFunctor<dense_t>;
+
+    const matrix_t &A = _A.back();
+    const lno_t n     = A.numRows();
+    _coarse_direct    = n <= _coarse_size;
+    if (!_coarse_direct) {
+      _coarse_lu = dense_t();
+      return;
+    }
+    _coarse_lu = dense_t("AMGPrec::_coarse_lu", n, n);
+    Kokkos::parallel_for(
+        "KokkosSparse::AMGPrec::coarse_fill", Kokkos::RangePolicy<EXSP>(0, n),
+        fill_t{A.graph.row_map, A.graph.entries, A.values, _coarse_lu});
+    Kokkos::parallel_for("KokkosSparse::AMGPrec::coarse_lu",
+                         Kokkos::RangePolicy<EXSP>(0, 1), lu_t{_coarse_lu});
+  }
+
+  // r = b - A x on the given level
+  void residual(const int l, const CView1d &b) const {
+    Kokkos::deep_copy(_r[l], b);
+    KokkosSparse::spmv("N", -karith::one(), _A[l], _x[l], karith::one(),
+                       _r[l]);
+  }
+
+  // x = A^inv b on the coarsest level
+  void coarse_solve(const CView1d &b) const {
+    using solve_t = KokkosSparse::Impl::AMGDenseSolveFunctor<dense_t, View1d>;
+
+    const int c = int(_A.size()) - 1;
+    if (!_coarse_direct) {
+      _smoothers[c].apply(b, _x[c]);
+      return;
+    }
+    Kokkos::deep_copy(_x[c], b);
+    Kokkos::parallel_for("KokkosSparse::AMGPrec::coarse_solve",
+                         Kokkos::RangePolicy<EXSP>(0, 1),
+                         solve_t{_coarse_lu, _x[c]});
+  }
+};
+
+}  // namespace Experimental
+}  // End namespace KokkosSparse
+
+#endif
@@ -0,0 +1,173 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// @file KokkosSparse_BlockJacobiPrec.hpp
+
+#ifndef KK_BLOCK_JACOBI_PREC_HPP
+#define KK_BLOCK_JACOBI_PREC_HPP
+
+#include <KokkosSparse_Preconditioner.hpp>
+#include <Kokkos_Core.hpp>
+#include "KokkosKernels_Error.hpp"
+#include "KokkosSparse_block_jacobi_impl.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+
+/// \class BlockJacobiPrec
+/// \brief Block Jacobi preconditioner: apply returns D^inv x, with D the
+///        block diagonal part of A made of consecutive, block_size x
+///        block_size diagonal blocks (the last one may be smaller).
+/// \tparam CRS the type of compressed matrix
+///
+/// compute() extracts the blocks in parallel and inverts them with the
+/// batched (serial per block) LU factorization and inverse, without
+/// pivoting; so the blocks must have nonzero pivots, e.g. when A is
+/// diagonally dominant or symmetric positive definite. apply is a batched
+/// gemv with the inverted blocks. The values of A are read by compute(), so
+/// it can be called again to refresh the preconditioner after the values
+/// (but not the pattern) of A changed.
+///
+/// BlockJacobiPrec provides the following methods
+///   - initialize() Does nothing.
+///   - isInitialized() returns true
+///   - compute() Extracts and inverts the diagonal blocks.
+///   - isComputed() returns true once compute() has been called
+///
+template <class CRS>
+class BlockJacobiPrec : public KokkosSparse::Experimental::Preconditioner<CRS> {
+ public:
+  using ScalarType = typename std::remove_const<typename CRS::value_type>::type;
+  using EXSP       = typename CRS::execution_space;
+  using MEMSP      = typename CRS::memory_space;
+  using DEVICE     = typename Kokkos::Device<EXSP, MEMSP>;
+  using karith     = typename Kokkos::ArithTraits<ScalarType>;
+  using View2d =
+      typename Kokkos::View<ScalarType **, Kokkos::LayoutRight, DEVICE>;
+  using View3d =
+      typename Kokkos::View<ScalarType ***, Kokkos::LayoutRight, DEVICE>;
+
+  static_assert(is_crs_matrix<CRS>::value,
+                "BlockJacobiPrec: CRS must be a KokkosSparse::CrsMatrix");
+
+ private:
+  CRS _A;
+  int _block_size;
+  int _num_blocks;
+  View3d _blocks;
+  bool _is_computed;
+
+ public:
+  //! Constructor: A is split into diagonal blocks of block_size rows
+  template <class CRSArg>
+  BlockJacobiPrec(const CRSArg &A, const int block_size)
+      : _A(A),
+        _block_size(block_size),
+        _num_blocks(block_size > 0
+                        ? (A.numRows() + block_size - 1) / block_size
+                        : 0),
+        _is_computed(false) {
+    KK_REQUIRE_MSG(A.numRows() == A.numCols(),
+                   "BlockJacobiPrec: the matrix must be square");
+    KK_REQUIRE_MSG(_block_size >= 1,
+                   "BlockJacobiPrec: block_size must be at least 1");
+    _blocks = View3d("BlockJacobiPrec::_blocks", _num_blocks, _block_size,
+                     _block_size);
+  }
+
+  //! Destructor.
+  virtual ~BlockJacobiPrec() {}
+
+  //! The number of rows of the diagonal blocks
+  int getBlockSize() const { return _block_size; }
+
+  //! The inverted diagonal blocks (num_blocks x block_size x block_size), set
+  //! by compute(). The last one is padded with the identity.
+  View3d getInverseBlocks() const { return _blocks; }
+
+  ///// \brief Apply the preconditioner to X, putting the result in Y.
+  /////
+  ///// \param transM [in] Only "N" is supported.
+  ///// \param alpha [in] Input coefficient of M*x
+  ///// \param beta [in] Input coefficient of Y
+  /////
+  ///// Computes Y = beta Y + alpha D^inv X.
+  //
+  virtual void apply(const Kokkos::View<const ScalarType *, DEVICE> &X,
+                     const Kokkos::View<ScalarType *, DEVICE> &Y,
+                     const char transM[] = "N",
+                     ScalarType alpha    = karith::one(),
+                     ScalarType beta     = karith::zero()) const {
+    using functor_t = KokkosSparse::Impl::BlockJacobiApplyFunctor<
+        View3d, Kokkos::View<const ScalarType *, DEVICE>,
+        Kokkos::View<ScalarType *, DEVICE>>;
+
+    KK_REQUIRE_MSG(transM[0] == NoTranspose[0],
+                   "BlockJacobiPrec::apply only supports 'N' for transM");
+    KK_REQUIRE_MSG(_is_computed,
+                   "BlockJacobiPrec::apply called before compute()");
+
+    Kokkos::parallel_for("KokkosSparse::BlockJacobiPrec::apply",
+                         Kokkos::RangePolicy<EXSP>(0, _A.numRows()),
+                         functor_t{_blocks, X, Y, alpha, beta, _block_size});
+  }
+  //@}
+
+  //! Set this preconditioner's parameters.
+  void setParameters() {}
+
+  void initialize() {}
+
+  //! True if the preconditioner has been successfully initialized, else false.
+  bool isInitialized() const { return true; }
+
+  //! Extracts the diagonal blocks from the current values of A and inverts
+  //! them
+  void compute() {
+    using extract_functor_t = KokkosSparse::Impl::BlockJacobiExtractFunctor<
+        typename CRS::row_map_type, typename CRS::index_type,
+        typename CRS::values_type, View3d>;
+    using invert_functor_t =
+        KokkosSparse::Impl::BlockJacobiInvertFunctor<View3d, View2d>;
+
+    const typename CRS::ordinal_type nrows      = _A.numRows();
+    const typename CRS::ordinal_type block_size = _block_size;
+
+    Kokkos::deep_copy(_blocks, karith::zero());
+    Kokkos::parallel_for(
+        "KokkosSparse::BlockJacobiPrec::extract",
+        Kokkos::RangePolicy<EXSP>(0, _num_blocks * block_size),
+        extract_functor_t{_A.graph.row_map, _A.graph.entries, _A.values,
+                          _blocks, block_size, nrows});
+
+    View2d work(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing,
+                           "BlockJacobiPrec::work"),
+        _num_blocks, _block_size * _block_size);
+    Kokkos::parallel_for("KokkosSparse::BlockJacobiPrec::invert",
+                         Kokkos::RangePolicy<EXSP>(0, _num_blocks),
+                         invert_functor_t{_blocks, work});
+    _is_computed = true;
+  }
+
+  //! True if the preconditioner has been successfully computed, else false.
+  bool isComputed() const { return _is_computed; }
+};
+
+}  // namespace Experimental
+}  // End namespace KokkosSparse
+
+#endif
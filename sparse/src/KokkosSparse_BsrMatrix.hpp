@@ -426,6 +426,9 @@ class BsrMatrix {
   /// state mechanism.
   DeviceConfig dev_config;
 
+  //! Type of the offsets of the diagonal blocks returned by diagOffsets().
+  typedef Kokkos::View<size_t*, device_type> diag_offsets_type;
+
   /// \brief Default constructor; constructs an empty sparse matrix.
   ///
   /// mfh: numCols and nnz should be properties of the graph, not the matrix.
@@ -920,6 +923,42 @@ class BsrMatrix {
     return graph.entries.extent(0);
   }
 
+  /// \brief Offsets of the diagonal blocks.
+  ///
+  /// Entry i is the offset of the block (i, i) relative to graph.row_map(i),
+  /// or KokkosSparse::OrdinalTraits<size_t>::invalid() if block row i does
+  /// not store one. Computed by the first call and cached like
+  /// CrsMatrix::diagOffsets(): the cache is valid until graph is replaced,
+  /// and clearDiagOffsets() drops it if the block column indices are modified
+  /// in place.
+  diag_offsets_type diagOffsets(const bool is_sorted = false) const {
+    const ordinal_type nrows = numRows();
+    if (diag_offsets_.extent(0) != static_cast<size_t>(nrows) ||
+        diag_offsets_row_map_ != graph.row_map.data() ||
+        diag_offsets_entries_ != graph.entries.data()) {
+      diag_offsets_ = diag_offsets_type(
+          Kokkos::view_alloc(Kokkos::WithoutInitializing,
+                             "KokkosSparse::BsrMatrix::diag_offsets"),
+          nrows);
+      Kokkos::parallel_for(
+          "KokkosSparse::BsrMatrix::diagOffsets",
+          Kokkos::RangePolicy<execution_space, ordinal_type>(0, nrows),
+          KokkosSparse::Impl::DiagOffsetsFunctor<row_map_type, index_type,
+                                                 diag_offsets_type>{
+              graph.row_map, graph.entries, diag_offsets_, is_sorted});
+      diag_offsets_row_map_ = graph.row_map.data();
+      diag_offsets_entries_ = graph.entries.data();
+    }
+    return diag_offsets_;
+  }
+
+  //! Drop the cache of diagOffsets(); the next call recomputes it.
+  void clearDiagOffsets() const {
+    diag_offsets_         = diag_offsets_type();
+    diag_offsets_row_map_ = nullptr;
+    diag_offsets_entries_ = nullptr;
+  }
+
   friend struct BsrRowView<BsrMatrix>;
 
   /// \brief Return a BsrRowView of block-row i of the matrix.
@@ -1096,6 +1135,10 @@ class BsrMatrix {
  private:
   ordinal_type numCols_  = 0;
   ordinal_type blockDim_ = 1;  // TODO Assuming square blocks for now
+  // Cache of diagOffsets(), and the graph arrays it was computed from
+  mutable diag_offsets_type diag_offsets_;
+  mutable const void* diag_offsets_row_map_ = nullptr;
+  mutable const void* diag_offsets_entries_ = nullptr;
 };
 
 //----------------------------------------------------------------------------
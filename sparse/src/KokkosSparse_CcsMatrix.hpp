@@ -150,10 +150,14 @@ class CcsMatrix {
   /// The "column map" corresponds to the \c ptr array of column offsets in
   /// compressed sparse column (CCS) storage.
   typedef SizeType size_type;
+  typedef typename std::remove_const<SizeType>::type non_const_size_type;
   //! Type of each value in the matrix.
   typedef ScalarType value_type;
+  //! Type of each value in the matrix, without const.
+  typedef typename std::remove_const<ScalarType>::type non_const_value_type;
   //! Type of each (column) index in the matrix.
   typedef OrdinalType ordinal_type;
+  typedef typename std::remove_const<OrdinalType>::type non_const_ordinal_type;
   //! Type of the graph structure of the sparse matrix - consistent with Kokkos.
   typedef Kokkos::StaticCcsGraph<ordinal_type, default_layout, device_type,
                                  memory_traits, size_type>
@@ -260,5 +264,9 @@ struct is_ccs_matrix<CcsMatrix<P...>> : public std::true_type {};
 template <typename... P>
 struct is_ccs_matrix<const CcsMatrix<P...>> : public std::true_type {};
 
+/// \brief Equivalent to is_ccs_matrix<T>::value.
+template <typename T>
+inline constexpr bool is_ccs_matrix_v = is_ccs_matrix<T>::value;
+
 }  // namespace KokkosSparse
 #endif
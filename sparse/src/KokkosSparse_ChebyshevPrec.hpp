@@ -0,0 +1,217 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// @file KokkosSparse_ChebyshevPrec.hpp
+
+#ifndef KK_CHEBYSHEV_PREC_HPP
+#define KK_CHEBYSHEV_PREC_HPP
+
+#include <utility>
+#include <KokkosSparse_Preconditioner.hpp>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+#include <KokkosBlas.hpp>
+#include <KokkosSparse_spmv.hpp>
+#include "KokkosKernels_Error.hpp"
+#include "KokkosSparse_chebyshev_impl.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+
+/// \class ChebyshevPrec
+/// \brief Chebyshev polynomial preconditioner (or smoother): apply returns
+///        p(D^inv A) D^inv x, the result of degree steps of the Chebyshev
+///        iteration for A y = x from y = 0, with D the diagonal of A.
+/// \tparam CRS the type of compressed matrix
+///
+/// The polynomial targets the eigenvalues of D^inv A in
+/// [lambda_max / eig_ratio, lambda_max]; compute() estimates lambda_max
+/// with power iterations (and raises it by 10% to be safe), which assumes
+/// that these eigenvalues are real and positive, e.g. for a symmetric
+/// positive definite A. Each step is a single fused kernel that does the
+/// SpMV, the diagonal scaling and the vector updates, so apply is fully
+/// parallel.
+///
+/// ChebyshevPrec provides the following methods
+///   - initialize() Does nothing.
+///   - isInitialized() returns true
+///   - compute() Computes D^inv and estimates lambda_max.
+///   - isComputed() returns true once compute() has been called
+///
+template <class CRS>
+class ChebyshevPrec : public KokkosSparse::Experimental::Preconditioner<CRS> {
+ public:
+  using ScalarType = typename std::remove_const<typename CRS::value_type>::type;
+  using EXSP       = typename CRS::execution_space;
+  using MEMSP      = typename CRS::memory_space;
+  using DEVICE     = typename Kokkos::Device<EXSP, MEMSP>;
+  using karith     = typename Kokkos::ArithTraits<ScalarType>;
+  using MagType    = typename karith::mag_type;
+  using View1d     = typename Kokkos::View<ScalarType *, DEVICE>;
+
+  static_assert(is_crs_matrix<CRS>::value,
+                "ChebyshevPrec: CRS must be a KokkosSparse::CrsMatrix");
+
+ private:
+  CRS _A;
+  int _degree;
+  MagType _eig_ratio;
+  int _power_iters;
+  MagType _lambda_max;
+  View1d _inv_diag;
+  View1d _x0, _x1, _d;
+  bool _is_computed;
+
+ public:
+  //! Constructor: the polynomial has the given degree (at least 1), and
+  //! compute() runs power_iters power iterations
+  template <class CRSArg>
+  ChebyshevPrec(const CRSArg &A, const int degree = 3,
+                const MagType eig_ratio = 30, const int power_iters = 10)
+      : _A(A),
+        _degree(degree),
+        _eig_ratio(eig_ratio),
+        _power_iters(power_iters),
+        _lambda_max(0),
+        _inv_diag("ChebyshevPrec::_inv_diag", A.numRows()),
+        _x0("ChebyshevPrec::_x0", A.numRows()),
+        _x1("ChebyshevPrec::_x1", A.numRows()),
+        _d("ChebyshevPrec::_d", A.numRows()),
+        _is_computed(false) {
+    KK_REQUIRE_MSG(A.numRows() == A.numCols(),
+                   "ChebyshevPrec: the matrix must be square");
+    KK_REQUIRE_MSG(_degree >= 1, "ChebyshevPrec: degree must be at least 1");
+    KK_REQUIRE_MSG(_eig_ratio > MagType(1),
+                   "ChebyshevPrec: eig_ratio must be larger than 1");
+    KK_REQUIRE_MSG(_power_iters >= 1,
+                   "ChebyshevPrec: power_iters must be at least 1");
+  }
+
+  //! Destructor.
+  virtual ~ChebyshevPrec() {}
+
+  //! The estimate of the largest eigenvalue of D^inv A used by apply
+  MagType getLambdaMax() const { return _lambda_max; }
+
+  //! The inverse of the diagonal of A, set by compute()
+  View1d getInverseDiagonal() const { return _inv_diag; }
+
+  ///// \brief Apply the preconditioner to X, putting the result in Y.
+  /////
+  ///// \param transM [in] Only "N" is supported.
+  ///// \param alpha [in] Input coefficient of M*x
+  ///// \param beta [in] Input coefficient of Y
+  /////
+  ///// Computes Y = beta Y + alpha p(D^inv A) D^inv X.
+  //
+  virtual void apply(const Kokkos::View<const ScalarType *, DEVICE> &X,
+                     const Kokkos::View<ScalarType *, DEVICE> &Y,
+                     const char transM[] = "N",
+                     ScalarType alpha    = karith::one(),
+                     ScalarType beta     = karith::zero()) const {
+    using functor_t = KokkosSparse::Impl::ChebyshevStepFunctor<
+        typename CRS::row_map_type, typename CRS::index_type,
+        typename CRS::values_type, View1d,
+        Kokkos::View<const ScalarType *, DEVICE>, View1d, View1d, View1d>;
+
+    KK_REQUIRE_MSG(transM[0] == NoTranspose[0],
+                   "ChebyshevPrec::apply only supports 'N' for transM");
+    KK_REQUIRE_MSG(_is_computed,
+                   "ChebyshevPrec::apply called before compute()");
+
+    // Chebyshev iteration on [lambda_min, lambda_max] (Saad, Alg. 12.1)
+    const MagType lambda_min = _lambda_max / _eig_ratio;
+    const MagType theta      = (_lambda_max + lambda_min) / 2;
+    const MagType delta      = (_lambda_max - lambda_min) / 2;
+    const MagType sigma      = theta / delta;
+    MagType rho              = 1 / sigma;
+
+    functor_t step{_A.graph.row_map,
+                   _A.graph.entries,
+                   _A.values,
+                   _inv_diag,
+                   X,
+                   _x1,
+                   _x0,
+                   _d,
+                   karith::zero(),
+                   ScalarType(1 / theta),
+                   true};
+    const Kokkos::RangePolicy<EXSP> policy(0, _A.numRows());
+    Kokkos::parallel_for("KokkosSparse::ChebyshevPrec::step", policy, step);
+    for (int k = 1; k < _degree; k++) {
+      const MagType rho_new = 1 / (2 * sigma - rho);
+      step.c_d              = ScalarType(rho_new * rho);
+      step.c_r              = ScalarType(2 * rho_new / delta);
+      step.first            = false;
+      std::swap(step.x_old, step.x_new);
+      Kokkos::parallel_for("KokkosSparse::ChebyshevPrec::step", policy, step);
+      rho = rho_new;
+    }
+
+    KokkosBlas::axpby(alpha, step.x_new, beta, Y);
+  }
+  //@}
+
+  //! Set this preconditioner's parameters.
+  void setParameters() {}
+
+  void initialize() {}
+
+  //! True if the preconditioner has been successfully initialized, else false.
+  bool isInitialized() const { return true; }
+
+  //! Computes the inverse diagonal of A, and estimates the largest
+  //! eigenvalue of D^inv A with power iterations from a random vector
+  void compute() {
+    using diag_functor_t = KokkosSparse::Impl::ChebyshevInvDiagFunctor<
+        typename CRS::row_map_type, typename CRS::index_type,
+        typename CRS::values_type, View1d>;
+
+    const auto n = _A.numRows();
+    Kokkos::parallel_for(
+        "KokkosSparse::ChebyshevPrec::inv_diag",
+        Kokkos::RangePolicy<EXSP>(0, n),
+        diag_functor_t{_A.graph.row_map, _A.graph.entries, _A.values,
+                       _inv_diag});
+
+    // Power iterations on D^inv A, with the Rayleigh quotient of the
+    // normalized v as the estimate
+    View1d v = _x0, w = _x1;
+    Kokkos::Random_XorShift64_Pool<EXSP> pool(13718);
+    Kokkos::fill_random(v, pool, karith::one());
+    MagType lambda = 0;
+    for (int it = 0; it < _power_iters && n > 0; it++) {
+      const MagType nrm = KokkosBlas::nrm2(v);
+      if (nrm == MagType(0)) break;
+      KokkosBlas::scal(v, ScalarType(1 / nrm), v);
+      KokkosSparse::spmv("N", karith::one(), _A, v, karith::zero(), _d);
+      KokkosBlas::mult(karith::zero(), w, karith::one(), _inv_diag, _d);
+      lambda = karith::real(KokkosBlas::dot(v, w));
+      std::swap(v, w);
+    }
+    _lambda_max  = lambda > MagType(0) ? MagType(1.1) * lambda : MagType(1);
+    _is_computed = true;
+  }
+
+  //! True if the preconditioner has been successfully computed, else false.
+  bool isComputed() const { return _is_computed; }
+};
+
+}  // namespace Experimental
+}  // End namespace KokkosSparse
+
+#endif
@@ -30,6 +30,7 @@
 #include <stdexcept>
 #include <type_traits>
 #include "KokkosSparse_findRelOffset.hpp"
+#include "KokkosSparse_OrdinalTraits.hpp"
 #include "KokkosKernels_default_types.hpp"
 #include "KokkosKernels_Macros.hpp"
 
@@ -326,6 +327,38 @@ struct SparseRowViewConst {
   }
 };
 
+namespace Impl {
+
+/// \brief Functor computing, for each row i of a CRS graph, the offset of
+///   the entry in column i relative to row_map(i), or
+///   OrdinalTraits<offset_type>::invalid() if the row has none. This is the
+///   diagonal (block) of CrsMatrix and BsrMatrix.
+template <class RowMapType, class EntriesType, class OffsetsType>
+struct DiagOffsetsFunctor {
+  using ordinal_type = typename EntriesType::non_const_value_type;
+  using offset_type  = typename OffsetsType::non_const_value_type;
+
+  RowMapType row_map;
+  EntriesType entries;
+  OffsetsType offsets;
+  bool is_sorted;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type i) const {
+    const auto start = row_map(i);
+    const ordinal_type length =
+        static_cast<ordinal_type>(row_map(i + 1) - start);
+    const ordinal_type offset =
+        length == 0 ? length
+                    : findRelOffset(&entries(start), length, i,
+                                    ordinal_type(0), is_sorted);
+    offsets(i) = offset == length
+                     ? KokkosSparse::OrdinalTraits<offset_type>::invalid()
+                     : static_cast<offset_type>(offset);
+  }
+};
+
+}  // namespace Impl
+
 /// \class CrsMatrix
 /// \brief Compressed sparse row implementation of a sparse matrix.
 /// \tparam ScalarType The type of entries in the sparse matrix.
@@ -431,6 +464,17 @@ class CrsMatrix {
   /// output of the kernel.
   ordinal_type numCols_;
 
+ public:
+  //! Type of the offsets of the diagonal entries returned by diagOffsets().
+  typedef Kokkos::View<size_t*, device_type> diag_offsets_type;
+
+ private:
+  /// \brief Cache of diagOffsets(), and the graph arrays it was computed
+  ///   from (it is stale if they are no longer those of graph).
+  mutable diag_offsets_type diag_offsets_;
+  mutable const void* diag_offsets_row_map_ = nullptr;
+  mutable const void* diag_offsets_entries_ = nullptr;
+
  public:
   /// \brief Launch configuration that can be used by
   ///   overloads/specializations of MV_multiply().
@@ -735,6 +779,44 @@ class CrsMatrix {
     return graph.entries.extent(0);
   }
 
+  /// \brief Offsets of the diagonal entries, as taken by
+  ///   KokkosSparse::getDiagCopy.
+  ///
+  /// Entry i is the offset of the entry (i, i) relative to graph.row_map(i),
+  /// or KokkosSparse::OrdinalTraits<size_t>::invalid() if row i does not
+  /// store one. The first call searches each row (with a binary search if
+  /// is_sorted is true) and caches the result in this matrix, so that later
+  /// calls, from this matrix or from copies of it made afterwards, return it
+  /// directly for as long as graph is not replaced. If the column indices are
+  /// modified in place, call clearDiagOffsets() first.
+  diag_offsets_type diagOffsets(const bool is_sorted = false) const {
+    const ordinal_type nrows = numRows();
+    if (diag_offsets_.extent(0) != static_cast<size_t>(nrows) ||
+        diag_offsets_row_map_ != graph.row_map.data() ||
+        diag_offsets_entries_ != graph.entries.data()) {
+      diag_offsets_ = diag_offsets_type(
+          Kokkos::view_alloc(Kokkos::WithoutInitializing,
+                             "KokkosSparse::CrsMatrix::diag_offsets"),
+          nrows);
+      Kokkos::parallel_for(
+          "KokkosSparse::CrsMatrix::diagOffsets",
+          Kokkos::RangePolicy<execution_space, ordinal_type>(0, nrows),
+          Impl::DiagOffsetsFunctor<row_map_type, index_type,
+                                   diag_offsets_type>{
+              graph.row_map, graph.entries, diag_offsets_, is_sorted});
+      diag_offsets_row_map_ = graph.row_map.data();
+      diag_offsets_entries_ = graph.entries.data();
+    }
+    return diag_offsets_;
+  }
+
+  //! Drop the cache of diagOffsets(); the next call recomputes it.
+  void clearDiagOffsets() const {
+    diag_offsets_         = diag_offsets_type();
+    diag_offsets_row_map_ = nullptr;
+    diag_offsets_entries_ = nullptr;
+  }
+
   friend struct SparseRowView<CrsMatrix>;
 
   /// \brief Return a view of row i of the matrix.
@@ -0,0 +1,227 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file KokkosSparse_DeltaCrsMatrix.hpp
+/// \brief Local sparse matrix interface
+///
+/// This file provides KokkosSparse::Experimental::DeltaCrsMatrix.  This
+/// implements a local (no MPI) sparse matrix stored in compressed row sparse
+/// format, with column indices stored as 16-bit deltas.
+
+#ifndef KOKKOSSPARSE_DELTACRSMATRIX_HPP_
+#define KOKKOSSPARSE_DELTACRSMATRIX_HPP_
+
+#include "Kokkos_Core.hpp"
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include "KokkosKernels_default_types.hpp"
+#include "KokkosKernels_Macros.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+
+/// \class DeltaCrsMatrix
+/// \brief Compressed row sparse matrix with delta-encoded column indices.
+/// \tparam ScalarType The type of entries in the sparse matrix.
+/// \tparam OrdinalType The type of column indices in the sparse matrix.
+/// \tparam Device The Kokkos Device type.
+/// \tparam MemoryTraits Traits describing how Kokkos manages and
+///   accesses data.  The default parameter suffices for most users.
+/// \tparam SizeType The type of row offsets.
+///
+/// The values and row offsets are the same as in a CrsMatrix. The column
+/// index of each entry is stored as the 16-bit difference from the column of
+/// the previous entry of its row. row_base holds the column that the first
+/// delta of each row is relative to, so the first delta is always 0. For
+/// banded matrices this halves (or better) the size of the index stream.
+///
+/// A row whose columns are not sorted, or in which two consecutive columns
+/// differ by more than max_delta, cannot be delta-encoded. Such a "wide" row
+/// has row_base(i) = -1 - w, and its column indices are stored in full in
+/// wide_entries, starting at wide_row_map(w). Its deltas are unused.
+///
+/// Use KokkosSparse::Experimental::crs2delta to build a DeltaCrsMatrix from a
+/// CrsMatrix.
+template <class ScalarType, class OrdinalType, class Device,
+          class MemoryTraits = void,
+          class SizeType     = typename Kokkos::ViewTraits<OrdinalType*, Device,
+                                                       void, void>::size_type>
+class DeltaCrsMatrix {
+  static_assert(
+      std::is_signed<OrdinalType>::value,
+      "DeltaCrsMatrix requires that OrdinalType is a signed integer type.");
+
+ public:
+  //! Type of the matrix's execution space.
+  typedef typename Device::execution_space execution_space;
+  //! Type of the matrix's memory space.
+  typedef typename Device::memory_space memory_space;
+  //! Canonical device type
+  typedef Kokkos::Device<execution_space, memory_space> device_type;
+  typedef MemoryTraits memory_traits;
+
+  //! Type of each row offset.
+  typedef SizeType size_type;
+  typedef const SizeType const_size_type;
+  typedef typename std::remove_const<SizeType>::type non_const_size_type;
+  //! Type of each value in the matrix.
+  typedef ScalarType value_type;
+  typedef const ScalarType const_value_type;
+  typedef typename std::remove_const<ScalarType>::type non_const_value_type;
+  //! Type of each (column) index in the matrix.
+  typedef OrdinalType ordinal_type;
+  typedef const OrdinalType const_ordinal_type;
+  typedef typename std::remove_const<OrdinalType>::type non_const_ordinal_type;
+  //! Type of each column delta.
+  typedef uint16_t delta_type;
+
+  //! Type of the array of values.
+  typedef Kokkos::View<value_type*, Kokkos::LayoutRight, device_type,
+                       MemoryTraits>
+      values_type;
+  //! Type of the row offsets (numRows() + 1 entries).
+  typedef Kokkos::View<const size_type*, Kokkos::LayoutRight, device_type,
+                       MemoryTraits>
+      row_map_type;
+  //! Type of the array of column deltas.
+  typedef Kokkos::View<const delta_type*, Kokkos::LayoutRight, device_type,
+                       MemoryTraits>
+      deltas_type;
+  //! Type of the arrays of column indices (row_base and wide_entries).
+  typedef Kokkos::View<const ordinal_type*, Kokkos::LayoutRight, device_type,
+                       MemoryTraits>
+      index_type;
+
+  //! Largest difference between consecutive columns of a delta-encoded row.
+  static constexpr ordinal_type max_delta = 65535;
+
+  /// \name Storage of the actual sparsity structure and values.
+  //@{
+  //! Values, row by row.
+  values_type values;
+  //! Offset of the first entry of each row in values and deltas.
+  row_map_type row_map;
+  //! Column deltas, row by row.
+  deltas_type deltas;
+  //! For each row, the base column of its deltas, or -1 - w for wide row w.
+  index_type row_base;
+  //! Offset of the first entry of each wide row in wide_entries.
+  row_map_type wide_row_map;
+  //! Full column indices of the wide rows.
+  index_type wide_entries;
+  //@}
+
+ private:
+  ordinal_type numCols_;
+
+ public:
+  /// \brief Default constructor; constructs an empty sparse matrix.
+  KOKKOS_INLINE_FUNCTION
+  DeltaCrsMatrix() : numCols_(0) {}
+
+  // clang-format off
+  /// \brief Constructor that accepts the arrays directly (by view, not by deep
+  ///   copy). Most users should use crs2delta instead.
+  ///
+  /// \param ncols [in] The number of columns.
+  /// \param vals [in] The values.
+  /// \param rows [in] The row offsets.
+  /// \param dels [in] The column deltas.
+  /// \param base [in] The base column of each row, or -1 - w for wide row w.
+  /// \param wide_rows [in] The offsets of the wide rows in wide_cols.
+  /// \param wide_cols [in] The column indices of the wide rows.
+  // clang-format on
+  DeltaCrsMatrix(const std::string& /* label */, const OrdinalType ncols,
+                 const values_type& vals, const row_map_type& rows,
+                 const deltas_type& dels, const index_type& base,
+                 const row_map_type& wide_rows, const index_type& wide_cols)
+      : values(vals),
+        row_map(rows),
+        deltas(dels),
+        row_base(base),
+        wide_row_map(wide_rows),
+        wide_entries(wide_cols),
+        numCols_(ncols) {
+    if (rows.extent(0) == 0 || base.extent(0) != rows.extent(0) - 1) {
+      std::ostringstream os;
+      os << "DeltaCrsMatrix: row_map must have one more entry than row_base ("
+         << base.extent(0) << ").";
+      throw std::invalid_argument(os.str());
+    }
+    if (vals.extent(0) != dels.extent(0)) {
+      std::ostringstream os;
+      os << "DeltaCrsMatrix: values and deltas must have the same length.";
+      throw std::invalid_argument(os.str());
+    }
+    if (wide_rows.extent(0) == 0) {
+      std::ostringstream os;
+      os << "DeltaCrsMatrix: wide_row_map must have at least one entry.";
+      throw std::invalid_argument(os.str());
+    }
+  }
+
+  //! The number of rows in the sparse matrix.
+  KOKKOS_INLINE_FUNCTION ordinal_type numRows() const {
+    return row_base.extent(0);
+  }
+
+  //! The number of columns in the sparse matrix.
+  KOKKOS_INLINE_FUNCTION ordinal_type numCols() const { return numCols_; }
+
+  //! The number of "point" (non-block) rows in the matrix.
+  KOKKOS_INLINE_FUNCTION ordinal_type numPointRows() const { return numRows(); }
+
+  //! The number of "point" (non-block) columns in the matrix.
+  KOKKOS_INLINE_FUNCTION ordinal_type numPointCols() const { return numCols(); }
+
+  //! The number of entries in the sparse matrix.
+  KOKKOS_INLINE_FUNCTION size_type nnz() const { return values.extent(0); }
+
+  //! The number of rows whose column indices are not delta-encoded.
+  KOKKOS_INLINE_FUNCTION ordinal_type numWideRows() const {
+    return wide_row_map.extent(0) - 1;
+  }
+
+  //! The number of bytes used by the column indices (deltas, row bases and
+  //! wide rows), to compare with nnz() * sizeof(ordinal_type) for a CrsMatrix.
+  size_t indexBytes() const {
+    return deltas.span() * sizeof(delta_type) +
+           row_base.span() * sizeof(ordinal_type) +
+           wide_row_map.span() * sizeof(size_type) +
+           wide_entries.span() * sizeof(ordinal_type);
+  }
+};
+
+/// \class is_delta_crs_matrix
+/// \brief is_delta_crs_matrix<T>::value is true if T is a DeltaCrsMatrix<...>,
+/// false otherwise
+template <typename>
+struct is_delta_crs_matrix : public std::false_type {};
+template <typename... P>
+struct is_delta_crs_matrix<DeltaCrsMatrix<P...>> : public std::true_type {};
+template <typename... P>
+struct is_delta_crs_matrix<const DeltaCrsMatrix<P...>>
+    : public std::true_type {};
+
+/// \brief Equivalent to is_delta_crs_matrix<T>::value.
+template <typename T>
+inline constexpr bool is_delta_crs_matrix_v = is_delta_crs_matrix<T>::value;
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+#endif
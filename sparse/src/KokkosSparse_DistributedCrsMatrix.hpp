@@ -0,0 +1,193 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file
+/// \brief A CrsMatrix split into blocks of consecutive rows, each applied
+///   on its own execution space instance
+///
+
+#ifndef KOKKOSSPARSE_DISTRIBUTEDCRSMATRIX_HPP_
+#define KOKKOSSPARSE_DISTRIBUTEDCRSMATRIX_HPP_
+
+#include <sstream>
+#include <vector>
+#include "KokkosKernels_Error.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_spmv.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+
+/// \class DistributedCrsMatrix
+/// \brief A CrsMatrix partitioned by rows over execution space instances.
+///
+/// The rows of A are split into one block of consecutive rows per instance,
+/// with about the same number of entries plus rows in each block. Each
+/// block has its own (shifted) row map but views the entries and values of
+/// A, so new values in A are seen by the blocks. KokkosSparse::
+/// Experimental::spmv applies each block on its instance: with instances
+/// from Kokkos::Experimental::partition_space, the blocks run concurrently.
+///
+/// All the instances share the memory space of A, so every block reads x
+/// directly and no ghost entries need to be exchanged. Kokkos addresses a
+/// single device per process; spreading a matrix over several GPUs needs
+/// one process (and one DistributedCrsMatrix) per GPU.
+///
+/// \tparam AMatrix A KokkosSparse::CrsMatrix.
+template <class AMatrix>
+class DistributedCrsMatrix {
+  static_assert(is_crs_matrix_v<AMatrix>,
+                "DistributedCrsMatrix: AMatrix must be a CrsMatrix");
+
+ public:
+  using matrix_type     = AMatrix;
+  using execution_space = typename AMatrix::execution_space;
+  using ordinal_type    = typename AMatrix::non_const_ordinal_type;
+  using size_type       = typename AMatrix::non_const_size_type;
+
+  /// Split the rows of A over instances (at least one).
+  DistributedCrsMatrix(const std::vector<execution_space>& instances,
+                       const AMatrix& A)
+      : spaces(instances), num_rows(A.numRows()), num_cols(A.numCols()) {
+    if (spaces.empty())
+      KokkosKernels::Impl::throw_runtime_exception(
+          "DistributedCrsMatrix: at least one execution space instance is "
+          "needed");
+    const int nparts = spaces.size();
+    auto rowmap_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                        A.graph.row_map);
+    // The row map of a matrix without rows may be empty
+    auto offset = [&](ordinal_type i) {
+      return rowmap_h.extent(0) ? size_type(rowmap_h(i)) : size_type(0);
+    };
+    // Cost of rows [0, i): their entries plus one per row
+    auto cost = [&](ordinal_type i) { return double(offset(i)) + i; };
+    const double total = cost(num_rows);
+    first_rows.resize(nparts + 1);
+    first_rows[0]      = 0;
+    first_rows[nparts] = num_rows;
+    ordinal_type row   = 0;
+    for (int p = 1; p < nparts; p++) {
+      const double target = total * p / nparts;
+      while (row < num_rows && cost(row) < target) row++;
+      first_rows[p] = row;
+    }
+
+    using rowmap_t = typename AMatrix::row_map_type::non_const_type;
+    blocks.reserve(nparts);
+    for (int p = 0; p < nparts; p++) {
+      const ordinal_type first = first_rows[p];
+      const ordinal_type nrows = first_rows[p + 1] - first;
+      const size_type begin    = offset(first);
+      const size_type end      = offset(first + nrows);
+      rowmap_t rowmap(Kokkos::view_alloc(Kokkos::WithoutInitializing,
+                                         "DistributedCrsMatrix rowmap"),
+                      nrows + 1);
+      auto block_rowmap_h = Kokkos::create_mirror_view(rowmap);
+      for (ordinal_type i = 0; i <= nrows; i++)
+        block_rowmap_h(i) = offset(first + i) - begin;
+      Kokkos::deep_copy(spaces[p], rowmap, block_rowmap_h);
+      auto range = Kokkos::make_pair(begin, end);
+      blocks.emplace_back("DistributedCrsMatrix block", nrows, num_cols,
+                          end - begin, Kokkos::subview(A.values, range),
+                          rowmap, Kokkos::subview(A.graph.entries, range));
+    }
+    for (auto& space : spaces) space.fence();
+  }
+
+  int num_parts() const { return spaces.size(); }
+  ordinal_type numRows() const { return num_rows; }
+  ordinal_type numCols() const { return num_cols; }
+
+  /// The instance on which part p is applied.
+  const execution_space& get_execution_space(int p) const { return spaces[p]; }
+  /// The rows of part p are [get_first_row(p), get_first_row(p + 1)).
+  ordinal_type get_first_row(int p) const { return first_rows[p]; }
+  /// The block of rows of A in part p.
+  const AMatrix& get_block(int p) const { return blocks[p]; }
+
+  /// Wait for all the kernels launched on the instances.
+  void fence() const {
+    for (auto& space : spaces) space.fence();
+  }
+
+ private:
+  std::vector<execution_space> spaces;
+  ordinal_type num_rows;
+  ordinal_type num_cols;
+  std::vector<ordinal_type> first_rows;
+  std::vector<AMatrix> blocks;
+};
+
+// clang-format off
+/// \brief y := alpha*Op(A)*x + beta*y, with each block of rows of A applied
+///   on its own execution space instance.
+///
+/// Nothing is fenced: call A.fence() before using y.
+///
+/// \param mode [in] "N" for normal or "C" for conjugate. Transposes would
+///   make the parts write the same entries of y and are not supported.
+/// \param alpha [in] Scalar multiplier for the matrix A.
+/// \param A [in] The partitioned matrix.
+/// \param x [in] A rank-1 or rank-2 Kokkos::View.
+/// \param beta [in] Scalar multiplier for the vector y.
+/// \param y [in/out] Result, a Kokkos::View of the same rank as x.
+// clang-format on
+template <class AlphaType, class AMatrix, class XVector, class BetaType,
+          class YVector>
+void spmv(const char mode[], const AlphaType& alpha,
+          const DistributedCrsMatrix<AMatrix>& A, const XVector& x,
+          const BetaType& beta, const YVector& y) {
+  static_assert(Kokkos::is_view<XVector>::value &&
+                    Kokkos::is_view<YVector>::value,
+                "KokkosSparse::Experimental::spmv(DistributedCrsMatrix): x "
+                "and y must be Kokkos::Views");
+  static_assert(XVector::rank() == YVector::rank(),
+                "KokkosSparse::Experimental::spmv(DistributedCrsMatrix): "
+                "Vector ranks do not match.");
+  if (mode[0] != NoTranspose[0] && mode[0] != Conjugate[0]) {
+    std::ostringstream os;
+    os << "KokkosSparse::Experimental::spmv(DistributedCrsMatrix): mode "
+       << mode << " is not supported (use N or C)";
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+  if (x.extent(0) != size_t(A.numCols()) ||
+      y.extent(0) != size_t(A.numRows()) || x.extent(1) != y.extent(1)) {
+    std::ostringstream os;
+    os << "KokkosSparse::Experimental::spmv(DistributedCrsMatrix): "
+       << "Dimensions do not match: A: " << A.numRows() << " x "
+       << A.numCols() << ", x: " << x.extent(0) << " x " << x.extent(1)
+       << ", y: " << y.extent(0) << " x " << y.extent(1);
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+  for (int p = 0; p < A.num_parts(); p++) {
+    const auto range =
+        Kokkos::make_pair(A.get_first_row(p), A.get_first_row(p + 1));
+    if (range.first == range.second) continue;
+    if constexpr (YVector::rank() == 1) {
+      KokkosSparse::spmv(A.get_execution_space(p), mode, alpha, A.get_block(p),
+                         x, beta, Kokkos::subview(y, range));
+    } else {
+      KokkosSparse::spmv(A.get_execution_space(p), mode, alpha, A.get_block(p),
+                         x, beta, Kokkos::subview(y, range, Kokkos::ALL()));
+    }
+  }
+}
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_DISTRIBUTEDCRSMATRIX_HPP_
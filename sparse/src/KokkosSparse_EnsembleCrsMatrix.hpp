@@ -0,0 +1,180 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file KokkosSparse_EnsembleCrsMatrix.hpp
+/// \brief Local sparse matrix interface
+///
+/// This file provides KokkosSparse::Experimental::EnsembleCrsMatrix, an
+/// ensemble of sparse matrices with the same sparsity pattern.
+
+#ifndef KOKKOSSPARSE_ENSEMBLECRSMATRIX_HPP_
+#define KOKKOSSPARSE_ENSEMBLECRSMATRIX_HPP_
+
+#include "Kokkos_Core.hpp"
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include "KokkosSparse_CrsMatrix.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+
+/// \class EnsembleCrsMatrix
+/// \brief An ensemble of k sparse matrices A_0, ..., A_{k-1} stored in
+///   compressed sparse row format over one shared graph.
+/// \tparam ScalarType The type of entries in the sparse matrices.
+/// \tparam OrdinalType The type of column indices in the sparse matrices.
+/// \tparam Device The Kokkos Device type.
+/// \tparam MemoryTraits Traits describing how Kokkos manages and
+///   accesses data.  The default parameter suffices for most users.
+/// \tparam SizeType The type of row offsets.
+///
+/// values is a LayoutRight nnz x k array: the k values of each entry are
+/// interleaved, so that values(e, s) is entry e of sample s. An SpMV over
+/// the whole ensemble (KokkosSparse::Experimental::spmv_ensemble) then reads
+/// each row offset and column index once for all k samples, and the k values
+/// of an entry with consecutive loads.
+template <class ScalarType, class OrdinalType, class Device,
+          class MemoryTraits = void,
+          class SizeType     = typename Kokkos::ViewTraits<OrdinalType*, Device,
+                                                       void, void>::size_type>
+class EnsembleCrsMatrix {
+  static_assert(
+      std::is_signed<OrdinalType>::value,
+      "EnsembleCrsMatrix requires that OrdinalType is a signed integer type.");
+
+ public:
+  //! Type of the matrix's execution space.
+  typedef typename Device::execution_space execution_space;
+  //! Type of the matrix's memory space.
+  typedef typename Device::memory_space memory_space;
+  //! Canonical device type
+  typedef Kokkos::Device<execution_space, memory_space> device_type;
+  typedef MemoryTraits memory_traits;
+
+  //! The CrsMatrix type of a single sample, with the same graph type.
+  typedef CrsMatrix<ScalarType, OrdinalType, Device, MemoryTraits, SizeType>
+      crs_matrix_type;
+
+  //! Type of each row offset.
+  typedef SizeType size_type;
+  typedef const SizeType const_size_type;
+  typedef typename std::remove_const<SizeType>::type non_const_size_type;
+  //! Type of each value in the matrices.
+  typedef ScalarType value_type;
+  typedef const ScalarType const_value_type;
+  typedef typename std::remove_const<ScalarType>::type non_const_value_type;
+  //! Type of each (column) index in the matrices.
+  typedef OrdinalType ordinal_type;
+  typedef const OrdinalType const_ordinal_type;
+  typedef typename std::remove_const<OrdinalType>::type non_const_ordinal_type;
+
+  //! Type of the shared graph.
+  typedef typename crs_matrix_type::staticcrsgraph_type staticcrsgraph_type;
+  typedef typename staticcrsgraph_type::row_map_type row_map_type;
+  typedef typename staticcrsgraph_type::entries_type index_type;
+  //! Type of the nnz x k array of values, with the samples interleaved.
+  typedef Kokkos::View<value_type**, Kokkos::LayoutRight, device_type,
+                       MemoryTraits>
+      values_type;
+
+  /// \name Storage of the shared sparsity structure and the values.
+  //@{
+  //! The graph (sparsity structure) shared by all samples.
+  staticcrsgraph_type graph;
+  //! values(e, s) is entry e of sample s.
+  values_type values;
+  //@}
+
+ private:
+  ordinal_type numCols_;
+
+ public:
+  /// \brief Default constructor; constructs an empty ensemble.
+  KOKKOS_INLINE_FUNCTION
+  EnsembleCrsMatrix() : numCols_(0) {}
+
+  /// \brief Constructor that shares the given graph and values (by view, not
+  ///   by deep copy).
+  ///
+  /// \param ncols [in] The number of columns.
+  /// \param vals [in] The nnz x k values.
+  /// \param graph_ [in] The graph, with nnz entries.
+  EnsembleCrsMatrix(const std::string& /* label */, const OrdinalType ncols,
+                    const values_type& vals, const staticcrsgraph_type& graph_)
+      : graph(graph_), values(vals), numCols_(ncols) {
+    if (vals.extent(0) != graph_.entries.extent(0)) {
+      std::ostringstream os;
+      os << "EnsembleCrsMatrix: values has " << vals.extent(0)
+         << " rows, but the graph has " << graph_.entries.extent(0)
+         << " entries.";
+      throw std::invalid_argument(os.str());
+    }
+  }
+
+  /// \brief Constructor for an ensemble of k samples that all start as a
+  ///   copy of A. The graph of A is shared, and the values are allocated and
+  ///   filled with those of A.
+  EnsembleCrsMatrix(const std::string& label, const crs_matrix_type& A,
+                    const int k)
+      : graph(A.graph),
+        values(Kokkos::view_alloc(Kokkos::WithoutInitializing, label),
+               A.nnz(), k),
+        numCols_(A.numCols()) {
+    for (int s = 0; s < k; s++)
+      Kokkos::deep_copy(Kokkos::subview(values, Kokkos::ALL(), s), A.values);
+  }
+
+  //! The number of rows of each sample.
+  KOKKOS_INLINE_FUNCTION ordinal_type numRows() const {
+    return graph.numRows();
+  }
+
+  //! The number of columns of each sample.
+  KOKKOS_INLINE_FUNCTION ordinal_type numCols() const { return numCols_; }
+
+  //! The number of stored entries of each sample.
+  KOKKOS_INLINE_FUNCTION size_type nnz() const {
+    return graph.entries.extent(0);
+  }
+
+  //! The number of samples (k).
+  KOKKOS_INLINE_FUNCTION int ensembleSize() const {
+    return static_cast<int>(values.extent(1));
+  }
+};
+
+/// \class is_ensemble_crs_matrix
+/// \brief is_ensemble_crs_matrix<T>::value is true if T is an
+/// EnsembleCrsMatrix<...>, false otherwise
+template <typename>
+struct is_ensemble_crs_matrix : public std::false_type {};
+template <typename... P>
+struct is_ensemble_crs_matrix<EnsembleCrsMatrix<P...>>
+    : public std::true_type {};
+template <typename... P>
+struct is_ensemble_crs_matrix<const EnsembleCrsMatrix<P...>>
+    : public std::true_type {};
+
+/// \brief Equivalent to is_ensemble_crs_matrix<T>::value.
+template <typename T>
+inline constexpr bool is_ensemble_crs_matrix_v =
+    is_ensemble_crs_matrix<T>::value;
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+#endif
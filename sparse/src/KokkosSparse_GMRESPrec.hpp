@@ -0,0 +1,146 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// @file KokkosSparse_GMRESPrec.hpp
+
+#ifndef KK_GMRES_PREC_HPP
+#define KK_GMRES_PREC_HPP
+
+#include <KokkosSparse_Preconditioner.hpp>
+#include <Kokkos_Core.hpp>
+#include <KokkosBlas.hpp>
+#include <KokkosKernels_Handle.hpp>
+#include <KokkosSparse_gmres.hpp>
+#include "KokkosKernels_Error.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+
+/// \class GMRESPrec
+/// \brief Inner-outer preconditioner: apply returns an approximate solution
+///        of A y = x from a few iterations of an inner GMRES, from y = 0.
+/// \tparam CRS the type of compressed matrix, which sets the working
+/// precision of apply
+/// \tparam InnerCRS the type of the matrix of the inner solve. Its scalar
+/// type may be a lower precision than that of CRS (e.g. float for a double
+/// matrix); A is copied into it at construction, and x and y are converted.
+///
+/// The inner solve stops at its own tolerance, so this operator changes with
+/// x: the outer GMRES must be flexible (GMRESHandle::set_flexible).
+///
+/// GMRESPrec provides the following methods
+///   - initialize() Does nothing; members initialized upon object construction.
+///   - isInitialized() returns true
+///   - compute() Does nothing; members initialized upon object construction.
+///   - isComputed() returns true
+///
+template <class CRS, class InnerCRS = CRS>
+class GMRESPrec : public KokkosSparse::Experimental::Preconditioner<CRS> {
+ public:
+  using ScalarType = typename std::remove_const<typename CRS::value_type>::type;
+  using EXSP       = typename CRS::execution_space;
+  using MEMSP      = typename CRS::memory_space;
+  using DEVICE     = typename Kokkos::Device<EXSP, MEMSP>;
+  using karith     = typename Kokkos::ArithTraits<ScalarType>;
+  using View1d     = typename Kokkos::View<ScalarType *, DEVICE>;
+
+  using InnerScalarType = typename InnerCRS::non_const_value_type;
+  using InnerView1d     = typename Kokkos::View<InnerScalarType *, DEVICE>;
+  using InnerMagType = typename Kokkos::ArithTraits<InnerScalarType>::mag_type;
+  using InnerKernelHandle = KokkosKernels::Experimental::KokkosKernelsHandle<
+      typename InnerCRS::non_const_size_type,
+      typename InnerCRS::non_const_ordinal_type, InnerScalarType, EXSP, MEMSP,
+      MEMSP>;
+  using InnerGMRESHandle = typename InnerKernelHandle::GMRESHandleType;
+
+  static_assert(is_crs_matrix<CRS>::value && is_crs_matrix<InnerCRS>::value,
+                "GMRESPrec: CRS and InnerCRS must be KokkosSparse::CrsMatrix");
+
+ private:
+  mutable InnerCRS _A;
+  mutable InnerKernelHandle _kh;
+  mutable InnerView1d _b, _x;
+  View1d _y;
+
+ public:
+  //! Constructor: the inner GMRES has the restart size m, the relative
+  //! tolerance tol and at most max_restart restarts
+  template <class CRSArg>
+  GMRESPrec(const CRSArg &A, const int m = 10, const InnerMagType tol = 1e-2,
+            const int max_restart = 0)
+      : _b("GMRESPrec::_b", A.numRows()),
+        _x("GMRESPrec::_x", A.numRows()),
+        _y("GMRESPrec::_y", A.numRows()) {
+    KK_REQUIRE_MSG(A.numRows() == A.numCols(),
+                   "GMRESPrec: the matrix must be square");
+    typename InnerCRS::values_type::non_const_type values(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "GMRESPrec::values"),
+        A.nnz());
+    Kokkos::deep_copy(values, A.values);
+    _A = InnerCRS("GMRESPrec::A", A.numRows(), A.numCols(), A.nnz(), values,
+                  A.graph.row_map, A.graph.entries);
+    _kh.create_gmres_handle(m, tol, max_restart);
+  }
+
+  //! Destructor.
+  virtual ~GMRESPrec() {}
+
+  //! The handle of the inner GMRES, e.g. to choose its orthogonalization
+  //! or to read the statistics of the last inner solve
+  InnerGMRESHandle *getInnerHandle() const { return _kh.get_gmres_handle(); }
+
+  ///// \brief Apply the preconditioner to X, putting the result in Y.
+  /////
+  ///// \param transM [in] Only "N" is supported.
+  ///// \param alpha [in] Input coefficient of M*x
+  ///// \param beta [in] Input coefficient of Y
+  /////
+  ///// Computes Y = beta Y + alpha M X, with M X the inner GMRES solution.
+  //
+  virtual void apply(const Kokkos::View<const ScalarType *, DEVICE> &X,
+                     const Kokkos::View<ScalarType *, DEVICE> &Y,
+                     const char transM[] = "N",
+                     ScalarType alpha    = karith::one(),
+                     ScalarType beta     = karith::zero()) const {
+    KK_REQUIRE_MSG(transM[0] == NoTranspose[0],
+                   "GMRESPrec::apply only supports 'N' for transM");
+
+    Kokkos::deep_copy(_b, X);
+    Kokkos::deep_copy(_x, Kokkos::ArithTraits<InnerScalarType>::zero());
+    KokkosSparse::Experimental::gmres(&_kh, _A, _b, _x);
+    Kokkos::deep_copy(_y, _x);
+    KokkosBlas::axpby(alpha, _y, beta, Y);
+  }
+  //@}
+
+  //! Set this preconditioner's parameters.
+  void setParameters() {}
+
+  void initialize() {}
+
+  //! True if the preconditioner has been successfully initialized, else false.
+  bool isInitialized() const { return true; }
+
+  void compute() {}
+
+  //! True if the preconditioner has been successfully computed, else false.
+  bool isComputed() const { return true; }
+};
+
+}  // namespace Experimental
+}  // End namespace KokkosSparse
+
+#endif
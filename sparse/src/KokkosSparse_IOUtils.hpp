@@ -18,6 +18,14 @@
 
 #include "KokkosKernels_IOUtils.hpp"
 #include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_BsrMatrix.hpp"
+#include <cstdint>
+#include <memory>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 namespace KokkosSparse {
 namespace Impl {
@@ -352,6 +360,8 @@ crsMat_t kk_generate_triangular_sparse_matrix(
   return crsmat;
 }
 
+// Generated on host; for large matrices, the device generators of
+// KokkosSparse_MatrixGenerators.hpp are much faster.
 template <typename crsMat_t>
 crsMat_t kk_generate_sparse_matrix(
     typename crsMat_t::const_ordinal_type nrows,
@@ -533,6 +543,334 @@ void write_graph_bin(lno_t nv, size_type ne, const size_type *xadj,
   myFile.close();
 }
 
+// Header of the binary CRS format written by write_crs_bin: the magic string,
+// the format version, the sizes of the ordinal, offset and scalar types, and
+// the dimensions. It is followed by xadj (nrows + 1 offsets), adj and ew (nnz
+// entries each), like the headerless format of write_graph_bin.
+struct CrsBinHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t lno_size;
+  uint32_t size_type_size;
+  uint32_t scalar_size;
+  int64_t nrows;
+  int64_t ncols;
+  int64_t nnz;
+
+  static constexpr const char *MAGIC = "KKCRSBIN";
+  static constexpr uint32_t VERSION  = 1;
+
+  template <typename lno_t, typename size_type, typename scalar_t>
+  bool matches_types() const {
+    return lno_size == sizeof(lno_t) && size_type_size == sizeof(size_type) &&
+           scalar_size == sizeof(scalar_t);
+  }
+
+  // Read the header at the start of is; returns false if there is none
+  bool read(std::istream &is) {
+    return is.read((char *)this, sizeof(CrsBinHeader)) &&
+           std::equal(magic, magic + 8, MAGIC);
+  }
+};
+
+// Write a (possibly rectangular) CRS matrix in the binary format with a
+// CrsBinHeader, which read_crs_bin and read_graph_bin can load without parsing
+template <typename lno_t, typename size_type, typename scalar_t>
+void write_crs_bin(lno_t nrows, lno_t ncols, size_type ne,
+                   const size_type *xadj, const lno_t *adj, const scalar_t *ew,
+                   const char *filename) {
+  CrsBinHeader header;
+  std::copy(CrsBinHeader::MAGIC, CrsBinHeader::MAGIC + 8, header.magic);
+  header.version        = CrsBinHeader::VERSION;
+  header.lno_size       = sizeof(lno_t);
+  header.size_type_size = sizeof(size_type);
+  header.scalar_size    = sizeof(scalar_t);
+  header.nrows          = nrows;
+  header.ncols          = ncols;
+  header.nnz            = ne;
+  std::ofstream myFile(filename, std::ios::out | std::ios::binary);
+  if (!myFile.is_open())
+    throw std::runtime_error(std::string("write_crs_bin: cannot open ") +
+                             filename);
+  myFile.write((char *)&header, sizeof(CrsBinHeader));
+  myFile.write((char *)xadj, sizeof(size_type) * (nrows + 1));
+  myFile.write((char *)adj, sizeof(lno_t) * (ne));
+  myFile.write((char *)ew, sizeof(scalar_t) * (ne));
+  myFile.close();
+}
+
+// Read a matrix written by write_crs_bin. Returns false, reading nothing, if
+// the file doesn't start with a CrsBinHeader or if its types don't match
+// lno_t, size_type and scalar_t.
+template <typename lno_t, typename size_type, typename scalar_t>
+bool read_crs_bin(lno_t *nrows, lno_t *ncols, size_type *ne, size_type **xadj,
+                  lno_t **adj, scalar_t **ew, const char *filename) {
+  std::ifstream myFile(filename, std::ios::in | std::ios::binary);
+  CrsBinHeader header;
+  if (!header.read(myFile) || header.version != CrsBinHeader::VERSION ||
+      !header.template matches_types<lno_t, size_type, scalar_t>())
+    return false;
+  *nrows = header.nrows;
+  *ncols = header.ncols;
+  *ne    = header.nnz;
+  KokkosKernels::Impl::md_malloc<size_type>(xadj, *nrows + 1);
+  KokkosKernels::Impl::md_malloc<lno_t>(adj, *ne);
+  KokkosKernels::Impl::md_malloc<scalar_t>(ew, *ne);
+  myFile.read((char *)*xadj, sizeof(size_type) * (*nrows + 1));
+  myFile.read((char *)*adj, sizeof(lno_t) * (*ne));
+  myFile.read((char *)*ew, sizeof(scalar_t) * (*ne));
+  if (!myFile)
+    throw std::runtime_error(std::string("read_crs_bin: ") + filename +
+                             " is truncated");
+  myFile.close();
+  return true;
+}
+
+// Header of the memory-mappable CRS/BSR format: like CrsBinHeader, plus the
+// block size (1 for CRS; for BSR, nrows, ncols and nnz count blocks and there
+// are block_dim^2 values per entry) and the byte offsets of the rowmap,
+// entries and values, each aligned to ALIGNMENT so that they can be used in
+// place.
+struct CrsMmapHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t lno_size;
+  uint32_t size_type_size;
+  uint32_t scalar_size;
+  int64_t nrows;
+  int64_t ncols;
+  int64_t nnz;
+  int64_t block_dim;
+  uint64_t rowmap_offset;
+  uint64_t entries_offset;
+  uint64_t values_offset;
+  uint64_t file_size;
+
+  static constexpr const char *MAGIC  = "KKCRSMAP";
+  static constexpr uint32_t VERSION   = 1;
+  static constexpr uint64_t ALIGNMENT = 64;
+
+  static uint64_t align(uint64_t offset) {
+    return (offset + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+  }
+
+  // Set the offsets and file size from the dimensions and type sizes
+  void set_layout() {
+    rowmap_offset  = align(sizeof(CrsMmapHeader));
+    entries_offset = align(rowmap_offset + size_type_size * (nrows + 1));
+    values_offset  = align(entries_offset + lno_size * nnz);
+    file_size      = values_offset + scalar_size * nnz * block_dim * block_dim;
+  }
+};
+
+// Write a CrsMatrix or BsrMatrix in the memory-mappable format, which
+// MappedCrsFile loads without copying
+template <typename matrix_t>
+void write_kokkos_crst_matrix_mmap(const matrix_t &A, const char *filename) {
+  static_assert(
+      is_crs_matrix_v<matrix_t> || Experimental::is_bsr_matrix_v<matrix_t>,
+      "write_kokkos_crst_matrix_mmap: A must be a CrsMatrix or a BsrMatrix");
+  using lno_t     = typename matrix_t::non_const_ordinal_type;
+  using size_type = typename matrix_t::non_const_size_type;
+  using scalar_t  = typename matrix_t::non_const_value_type;
+  auto rowmap =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.row_map);
+  auto entries =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.entries);
+  auto values =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.values);
+  CrsMmapHeader header;
+  std::copy(CrsMmapHeader::MAGIC, CrsMmapHeader::MAGIC + 8, header.magic);
+  header.version        = CrsMmapHeader::VERSION;
+  header.lno_size       = sizeof(lno_t);
+  header.size_type_size = sizeof(size_type);
+  header.scalar_size    = sizeof(scalar_t);
+  header.nrows          = A.numRows();
+  header.ncols          = A.numCols();
+  header.nnz            = A.nnz();
+  header.block_dim      = 1;
+  if constexpr (Experimental::is_bsr_matrix_v<matrix_t>)
+    header.block_dim = A.blockDim();
+  header.set_layout();
+  std::ofstream myFile(filename, std::ios::out | std::ios::binary);
+  if (!myFile.is_open())
+    throw std::runtime_error(
+        std::string("write_kokkos_crst_matrix_mmap: cannot open ") + filename);
+  auto writeAt = [&](uint64_t offset, const void *data, uint64_t bytes) {
+    const char zeros[CrsMmapHeader::ALIGNMENT] = {};
+    myFile.write(zeros, offset - uint64_t(myFile.tellp()));
+    myFile.write((const char *)data, bytes);
+  };
+  writeAt(0, &header, sizeof(CrsMmapHeader));
+  // an empty matrix may have an empty rowmap
+  std::vector<size_type> rowmapData(header.nrows + 1, 0);
+  std::copy(rowmap.data(), rowmap.data() + rowmap.extent(0),
+            rowmapData.begin());
+  writeAt(header.rowmap_offset, rowmapData.data(),
+          sizeof(size_type) * rowmapData.size());
+  writeAt(header.entries_offset, entries.data(), sizeof(lno_t) * header.nnz);
+  writeAt(header.values_offset, values.data(),
+          sizeof(scalar_t) * values.extent(0));
+  myFile.close();
+  if (!myFile)
+    throw std::runtime_error(
+        std::string("write_kokkos_crst_matrix_mmap: cannot write ") + filename);
+}
+
+// A file of the memory-mappable CRS/BSR format, mapped into memory (read into
+// memory on Windows). Its arrays are unmanaged host Views of the mapping,
+// valid as long as the MappedCrsFile. The mapping is private: writing to the
+// Views doesn't modify the file, and processes mapping the same file share
+// its pages in the page cache until they write to them.
+template <typename scalar_t, typename lno_t, typename size_type>
+class MappedCrsFile {
+ public:
+  using unmanaged_t = Kokkos::MemoryTraits<Kokkos::Unmanaged>;
+  using rowmap_t    = Kokkos::View<size_type *, Kokkos::HostSpace, unmanaged_t>;
+  using entries_t   = Kokkos::View<lno_t *, Kokkos::HostSpace, unmanaged_t>;
+  using values_t    = Kokkos::View<scalar_t *, Kokkos::HostSpace, unmanaged_t>;
+
+  explicit MappedCrsFile(const char *filename) {
+    const std::string name(filename);
+    map_file(name);
+    if (bytes < sizeof(CrsMmapHeader))
+      throw std::runtime_error("MappedCrsFile: " + name + " is too short");
+    const CrsMmapHeader &header = *(const CrsMmapHeader *)data;
+    if (!std::equal(header.magic, header.magic + 8, CrsMmapHeader::MAGIC) ||
+        header.version != CrsMmapHeader::VERSION)
+      throw std::runtime_error("MappedCrsFile: " + name +
+                               " is not a memory-mappable CRS file");
+    if (header.lno_size != sizeof(lno_t) ||
+        header.size_type_size != sizeof(size_type) ||
+        header.scalar_size != sizeof(scalar_t))
+      throw std::runtime_error("MappedCrsFile: the types of " + name +
+                               " don't match the requested types");
+    CrsMmapHeader layout = header;
+    layout.set_layout();
+    if (header.nrows < 0 || header.nnz < 0 || header.block_dim < 1 ||
+        layout.rowmap_offset != header.rowmap_offset ||
+        layout.entries_offset != header.entries_offset ||
+        layout.values_offset != header.values_offset ||
+        layout.file_size != header.file_size || bytes < header.file_size)
+      throw std::runtime_error("MappedCrsFile: " + name +
+                               " is truncated or corrupted");
+    numRows_  = header.nrows;
+    numCols_  = header.ncols;
+    blockDim_ = header.block_dim;
+    rowmap_   = rowmap_t((size_type *)(data + header.rowmap_offset),
+                         header.nrows + 1);
+    entries_  = entries_t((lno_t *)(data + header.entries_offset), header.nnz);
+    values_   = values_t((scalar_t *)(data + header.values_offset),
+                         header.nnz * blockDim_ * blockDim_);
+  }
+
+  MappedCrsFile(const MappedCrsFile &) = delete;
+  MappedCrsFile &operator=(const MappedCrsFile &) = delete;
+
+  ~MappedCrsFile() {
+#ifndef _WIN32
+    if (data) munmap(data, bytes);
+#else
+    delete[] data;
+#endif
+  }
+
+  lno_t numRows() const { return numRows_; }
+  lno_t numCols() const { return numCols_; }
+  size_type nnz() const { return entries_.extent(0); }
+  lno_t blockDim() const { return blockDim_; }
+  rowmap_t rowmap() const { return rowmap_; }
+  entries_t entries() const { return entries_; }
+  values_t values() const { return values_; }
+
+  // Copy the arrays into a new matrix_t (a CrsMatrix, or a BsrMatrix for a
+  // file with any block size), directly from the mapping to the memory space
+  // of matrix_t
+  template <typename matrix_t>
+  matrix_t to_matrix() const {
+    static_assert(
+        is_crs_matrix_v<matrix_t> || Experimental::is_bsr_matrix_v<matrix_t>,
+        "MappedCrsFile::to_matrix: matrix_t must be a CrsMatrix or a "
+        "BsrMatrix");
+    using out_rowmap_t  = typename matrix_t::row_map_type::non_const_type;
+    using out_entries_t = typename matrix_t::index_type::non_const_type;
+    using out_values_t  = typename matrix_t::values_type::non_const_type;
+    out_rowmap_t rowmap(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "Mapped rowmap"),
+        rowmap_.extent(0));
+    out_entries_t entries(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "Mapped entries"),
+        entries_.extent(0));
+    out_values_t values(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "Mapped values"),
+        values_.extent(0));
+    Kokkos::deep_copy(rowmap, rowmap_);
+    Kokkos::deep_copy(entries, entries_);
+    Kokkos::deep_copy(values, values_);
+    if constexpr (Experimental::is_bsr_matrix_v<matrix_t>) {
+      return matrix_t("Mapped matrix", numRows_, numCols_, nnz(), values,
+                      rowmap, entries, blockDim_);
+    } else {
+      if (blockDim_ != 1)
+        throw std::invalid_argument(
+            "MappedCrsFile::to_matrix: a file with blocks can only be loaded "
+            "into a BsrMatrix");
+      return matrix_t("Mapped matrix", numRows_, numCols_, nnz(), values,
+                      rowmap, entries);
+    }
+  }
+
+ private:
+  void map_file(const std::string &name) {
+#ifndef _WIN32
+    int fd = open(name.c_str(), O_RDONLY);
+    if (fd < 0) throw std::runtime_error("MappedCrsFile: cannot open " + name);
+    bytes = KokkosKernels::Impl::kk_get_file_size(name.c_str());
+    void *mapping =
+        bytes ? mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0)
+              : MAP_FAILED;
+    close(fd);
+    if (mapping == MAP_FAILED)
+      throw std::runtime_error("MappedCrsFile: cannot map " + name);
+    data = (char *)mapping;
+#else
+    std::ifstream myFile(name, std::ios::in | std::ios::binary);
+    if (!myFile) throw std::runtime_error("MappedCrsFile: cannot open " + name);
+    bytes = KokkosKernels::Impl::kk_get_file_size(name.c_str());
+    data  = new char[bytes];
+    myFile.read(data, bytes);
+#endif
+  }
+
+  char *data   = nullptr;
+  size_t bytes = 0;
+  lno_t numRows_;
+  lno_t numCols_;
+  lno_t blockDim_;
+  rowmap_t rowmap_;
+  entries_t entries_;
+  values_t values_;
+};
+
+// Map a file written by write_kokkos_crst_matrix_mmap, whose arrays are then
+// available in place as unmanaged host Views, or copied directly into a
+// matrix on any device with MappedCrsFile::to_matrix.
+template <typename scalar_t, typename lno_t, typename size_type>
+std::unique_ptr<MappedCrsFile<scalar_t, lno_t, size_type>>
+read_kokkos_crst_matrix_mmap(const char *filename) {
+  return std::make_unique<MappedCrsFile<scalar_t, lno_t, size_type>>(filename);
+}
+
+// Load a file written by write_kokkos_crst_matrix_mmap into a new
+// CrsMatrix or BsrMatrix, copying from the mapping to its device
+template <typename matrix_t>
+matrix_t read_kokkos_crst_matrix_mmap_to(const char *filename) {
+  return MappedCrsFile<typename matrix_t::non_const_value_type,
+                       typename matrix_t::non_const_ordinal_type,
+                       typename matrix_t::non_const_size_type>(filename)
+      .template to_matrix<matrix_t>();
+}
+
 template <typename lno_t, typename size_type, typename scalar_t>
 void write_graph_crs(lno_t nv, size_type ne, const size_type *xadj,
                      const lno_t *adj, const scalar_t *ew,
@@ -664,8 +1002,232 @@ inline Kokkos::complex<double> symmetryFlip(Kokkos::complex<double> val,
     return -val;
   return val;
 }
+
+// Character-level parsing of the entries of an .mtx file held in memory (and
+// followed by a null character), for the parallel reader. The parse functions
+// read one token at p, skipping blanks but not line ends, advance p past it,
+// and set ok to false if there is no number there.
+inline const char *skipBlanks(const char *p) {
+  while (*p == ' ' || *p == '\t' || *p == '\r') p++;
+  return p;
+}
+
+// The start of the line after the one at p, or end
+inline const char *nextLine(const char *p, const char *end) {
+  while (p < end && *p != '\n') p++;
+  return p < end ? p + 1 : end;
+}
+
+// Whether the line at p holds an entry (and is not blank or a comment)
+inline bool isEntryLine(const char *p, const char *end) {
+  p = skipBlanks(p);
+  return p < end && *p != '\n' && *p != '%' && *p != '\0';
+}
+
+template <typename T>
+T parseInteger(const char *&p, bool &ok) {
+  p = skipBlanks(p);
+  char *tokenEnd;
+  long long val = std::strtoll(p, &tokenEnd, 10);
+  if (tokenEnd == p || *p == '\n') ok = false;
+  p = tokenEnd;
+  return T(val);
+}
+
+inline double parseReal(const char *&p, bool &ok) {
+  p = skipBlanks(p);
+  char *tokenEnd;
+  double val = std::strtod(p, &tokenEnd);
+  if (tokenEnd == p || *p == '\n') ok = false;
+  p = tokenEnd;
+  return val;
+}
+
+template <typename scalar_t>
+scalar_t parseScalarChars(const char *&p, bool &ok) {
+  if constexpr (std::is_integral_v<scalar_t>)
+    return parseInteger<scalar_t>(p, ok);
+  else
+    return scalar_t(parseReal(p, ok));
+}
+
+template <>
+inline Kokkos::complex<float> parseScalarChars(const char *&p, bool &ok) {
+  float re = parseReal(p, ok);
+  float im = parseReal(p, ok);
+  return Kokkos::complex<float>(re, im);
+}
+
+template <>
+inline Kokkos::complex<double> parseScalarChars(const char *&p, bool &ok) {
+  double re = parseReal(p, ok);
+  double im = parseReal(p, ok);
+  return Kokkos::complex<double>(re, im);
+}
 }  // namespace MM
 
+// Parse the nnz entries of an .mtx file, the bytes [data, data + len) after
+// its size line (followed by a null character), in parallel on the host: the
+// bytes are split into ranges starting at line starts, each range counts its
+// entry lines, and after a prefix sum over the ranges, parses its entries
+// into their positions in rows, cols and vals (with 0-based indices).
+template <typename lno_t, typename size_type, typename scalar_t>
+void parse_mtx_entries(const char *data, size_t len, size_type nnz, lno_t nr,
+                       lno_t nc, bool isArray, bool isPattern,
+                       std::vector<lno_t> &rows, std::vector<lno_t> &cols,
+                       std::vector<scalar_t> &vals) {
+  using host_exec    = Kokkos::DefaultHostExecutionSpace;
+  using range_policy = Kokkos::RangePolicy<host_exec>;
+  const char *end    = data + len;
+  // at least 64 KB per range
+  const size_t numRanges = std::max<size_t>(
+      1, std::min<size_t>(4 * host_exec().concurrency(), len >> 16));
+  std::vector<const char *> bounds(numRanges + 1);
+  bounds[0] = data;
+  for (size_t r = 1; r <= numRanges; r++) {
+    const char *p = data + len * r / numRanges;
+    if (r < numRanges && p[-1] != '\n') p = MM::nextLine(p, end);
+    bounds[r] = std::max(p, bounds[r - 1]);
+  }
+  std::vector<size_type> offsets(numRanges + 1, 0);
+  Kokkos::parallel_for(
+      "KokkosSparse::read_mtx::CountEntries", range_policy(0, numRanges),
+      [&](size_t r) {
+        size_type count = 0;
+        for (const char *p = bounds[r]; p < bounds[r + 1];
+             p              = MM::nextLine(p, bounds[r + 1])) {
+          if (MM::isEntryLine(p, bounds[r + 1])) count++;
+        }
+        offsets[r + 1] = count;
+      });
+  for (size_t r = 0; r < numRanges; r++) offsets[r + 1] += offsets[r];
+  if (offsets[numRanges] < nnz)
+    throw std::runtime_error(
+        "read_mtx: the file has fewer entries than its size line says");
+  rows.resize(nnz);
+  cols.resize(nnz);
+  vals.resize(nnz);
+  std::vector<int> failed(numRanges, 0);
+  Kokkos::parallel_for(
+      "KokkosSparse::read_mtx::ParseEntries", range_policy(0, numRanges),
+      [&](size_t r) {
+        size_type i = offsets[r];
+        bool ok     = true;
+        for (const char *p = bounds[r]; ok && i < nnz && p < bounds[r + 1];
+             p              = MM::nextLine(p, bounds[r + 1])) {
+          if (!MM::isEntryLine(p, bounds[r + 1])) continue;
+          const char *token = p;
+          lno_t s, d;
+          if (isArray) {
+            // In array format, entries are listed in column major order,
+            // so the row and column can be determined just from the index i
+            s = i % nr;
+            d = i / nr;
+          } else {
+            s = MM::parseInteger<lno_t>(token, ok) - 1;
+            d = MM::parseInteger<lno_t>(token, ok) - 1;
+          }
+          if (isPattern)
+            vals[i] = scalar_t(1);
+          else
+            vals[i] = MM::parseScalarChars<scalar_t>(token, ok);
+          if (s < 0 || s >= nr || d < 0 || d >= nc) ok = false;
+          rows[i] = s;
+          cols[i] = d;
+          i++;
+        }
+        failed[r] = !ok;
+      });
+  if (std::find(failed.begin(), failed.end(), 1) != failed.end())
+    throw std::runtime_error(
+        "read_mtx: an entry can't be parsed or is out of bounds");
+}
+
+// Build the CRS arrays of the nr-row matrix with the entries (rows(i),
+// cols(i), vals(i)), on the host in parallel. Like the serial reader did:
+// diagonal entries are dropped if remove_diagonal; if symmetrize, every
+// off-diagonal entry also gets its mirror, with the value symmetryFlip(val)
+// for symmetry sym, and only the first of duplicate entries is kept; the
+// entries of each row are sorted by column, keeping their order in the file
+// for equal columns.
+template <typename lno_t, typename size_type, typename scalar_t>
+void mtx_entries_to_crs(lno_t nr, const std::vector<lno_t> &rows,
+                        const std::vector<lno_t> &cols,
+                        const std::vector<scalar_t> &vals, bool symmetrize,
+                        bool remove_diagonal, MM::MtxSym sym, size_type *ne,
+                        size_type **xadj, lno_t **adj, scalar_t **ew) {
+  using host_exec    = Kokkos::DefaultHostExecutionSpace;
+  using range_policy = Kokkos::RangePolicy<host_exec>;
+  struct RowEntry {
+    lno_t col;
+    size_type order;
+    scalar_t val;
+    bool operator<(const RowEntry &other) const {
+      return col < other.col || (col == other.col && order < other.order);
+    }
+  };
+  const size_type nnz = rows.size();
+  std::vector<size_type> rowBegins(nr + 1, 0);
+  Kokkos::parallel_for(
+      "KokkosSparse::read_mtx::CountRows", range_policy(0, nnz),
+      [&](size_type i) {
+        if (rows[i] != cols[i] || !remove_diagonal)
+          Kokkos::atomic_inc(&rowBegins[rows[i] + 1]);
+        if (rows[i] != cols[i] && symmetrize)
+          Kokkos::atomic_inc(&rowBegins[cols[i] + 1]);
+      });
+  for (lno_t r = 0; r < nr; r++) rowBegins[r + 1] += rowBegins[r];
+  std::vector<size_type> cursors(rowBegins.begin(), rowBegins.end() - 1);
+  std::vector<RowEntry> entries(rowBegins[nr]);
+  Kokkos::parallel_for(
+      "KokkosSparse::read_mtx::FillRows", range_policy(0, nnz),
+      [&](size_type i) {
+        if (rows[i] != cols[i] || !remove_diagonal) {
+          size_type pos =
+              Kokkos::atomic_fetch_add(&cursors[rows[i]], size_type(1));
+          entries[pos] = RowEntry{cols[i], 2 * i, vals[i]};
+        }
+        if (rows[i] != cols[i] && symmetrize) {
+          size_type pos =
+              Kokkos::atomic_fetch_add(&cursors[cols[i]], size_type(1));
+          entries[pos] =
+              RowEntry{rows[i], 2 * i + 1, MM::symmetryFlip(vals[i], sym)};
+        }
+      });
+  // sort each row, and count its entries without the duplicates
+  std::vector<size_type> rowLengths(nr + 1, 0);
+  Kokkos::parallel_for(
+      "KokkosSparse::read_mtx::SortRows", range_policy(0, nr), [&](lno_t r) {
+        std::sort(entries.begin() + rowBegins[r],
+                  entries.begin() + rowBegins[r + 1]);
+        size_type length = 0;
+        for (size_type j = rowBegins[r]; j < rowBegins[r + 1]; j++) {
+          if (!symmetrize || j == rowBegins[r] ||
+              entries[j - 1].col != entries[j].col)
+            length++;
+        }
+        rowLengths[r + 1] = length;
+      });
+  for (lno_t r = 0; r < nr; r++) rowLengths[r + 1] += rowLengths[r];
+  *ne = rowLengths[nr];
+  KokkosKernels::Impl::md_malloc<size_type>(xadj, nr + 1);
+  KokkosKernels::Impl::md_malloc<lno_t>(adj, *ne);
+  KokkosKernels::Impl::md_malloc<scalar_t>(ew, *ne);
+  std::copy(rowLengths.begin(), rowLengths.end(), *xadj);
+  Kokkos::parallel_for(
+      "KokkosSparse::read_mtx::CopyRows", range_policy(0, nr), [&](lno_t r) {
+        size_type out = rowLengths[r];
+        for (size_type j = rowBegins[r]; j < rowBegins[r + 1]; j++) {
+          if (!symmetrize || j == rowBegins[r] ||
+              entries[j - 1].col != entries[j].col) {
+            (*adj)[out] = entries[j].col;
+            (*ew)[out]  = entries[j].val;
+            out++;
+          }
+        }
+      });
+}
+
 template <typename lno_t, typename size_type, typename scalar_t>
 void write_matrix_mtx(lno_t nrows, lno_t ncols, size_type nentries,
                       const size_type *xadj, const lno_t *adj,
@@ -719,10 +1281,20 @@ void write_graph_mtx(lno_t nv, size_type ne, const size_type *xadj,
   myFile.close();
 }
 
+// Reads both the headerless format of write_graph_bin and the format of
+// write_crs_bin (whose number of columns is discarded)
 template <typename lno_t, typename size_type, typename scalar_t>
 void read_graph_bin(lno_t *nv, size_type *ne, size_type **xadj, lno_t **adj,
                     scalar_t **ew, const char *filename) {
+  lno_t ncols;
+  if (read_crs_bin(nv, &ncols, ne, xadj, adj, ew, filename)) return;
   std::ifstream myFile(filename, std::ios::in | std::ios::binary);
+  if (CrsBinHeader().read(myFile))
+    throw std::runtime_error(
+        std::string("read_graph_bin: the version or the types of ") +
+        filename + " don't match");
+  myFile.clear();
+  myFile.seekg(0);
 
   myFile.read((char *)nv, sizeof(lno_t));
   myFile.read((char *)ne, sizeof(size_type));
@@ -955,8 +1527,7 @@ int read_mtx(const char *fileName, lno_t *nrows, lno_t *ncols, size_type *ne,
     ss >> nnz;
   else
     nnz = nr * nc;
-  size_type numEdges = nnz;
-  symmetrize         = symmetrize || mtx_sym != GENERAL;
+  symmetrize = symmetrize || mtx_sym != GENERAL;
   if (symmetrize && nr != nc) {
     throw std::runtime_error("A non-square matrix cannot be symmetrized.");
   }
@@ -969,97 +1540,33 @@ int read_mtx(const char *fileName, lno_t *nrows, lno_t *ncols, size_type *ne,
       throw std::runtime_error(
           "array format MatrixMarket file can't have \"pattern\" field type.");
   }
-  if (symmetrize) {
-    numEdges = 2 * nnz;
-  }
-  // numEdges is only an upper bound (diagonal entries may be removed)
-  std::vector<struct KokkosKernels::Impl::Edge<lno_t, scalar_t>> edges(
-      numEdges);
-  size_type nE      = 0;
-  lno_t numDiagonal = 0;
-  for (size_type i = 0; i < nnz; ++i) {
-    getline(mmf, fline);
-    std::stringstream ss2(fline);
-    struct KokkosKernels::Impl::Edge<lno_t, scalar_t> tmp;
-    // read source, dest (edge) and weight (value)
-    lno_t s, d;
-    scalar_t w;
-    if (mtx_format == ARRAY) {
-      // In array format, entries are listed in column major order,
-      // so the row and column can be determined just from the index i
-      //(but make them 1-based indices, to match the way coordinate works)
-      s = i % nr + 1;  // row
-      d = i / nr + 1;  // col
-    } else {
-      // In coordinate format, row and col of each entry is read from file
-      ss2 >> s >> d;
-    }
-    if (mtx_field == PATTERN)
-      w = 1;
-    else
-      w = readScalar<scalar_t>(ss2);
-    if (!transpose) {
-      tmp.src = s - 1;
-      tmp.dst = d - 1;
-      tmp.ew  = w;
-    } else {
-      tmp.src = d - 1;
-      tmp.dst = s - 1;
-      tmp.ew  = w;
-    }
-    if (tmp.src == tmp.dst) {
-      numDiagonal++;
-      if (!remove_diagonal) {
-        edges[nE++] = tmp;
-      }
-      continue;
-    }
-    edges[nE++] = tmp;
-    if (symmetrize) {
-      struct KokkosKernels::Impl::Edge<lno_t, scalar_t> tmp2;
-      tmp2.src = tmp.dst;
-      tmp2.dst = tmp.src;
-      // the symmetrized value is w, -w or conj(w) if mtx_sym is
-      // SYMMETRIC, SKEW_SYMMETRIC or HERMITIAN, respectively.
-      tmp2.ew     = symmetryFlip<scalar_t>(tmp.ew, mtx_sym);
-      edges[nE++] = tmp2;
-    }
+  // Read the entries into memory, and parse them in parallel
+  std::vector<char> data;
+  {
+    const std::streampos dataBegin = mmf.tellg();
+    mmf.seekg(0, std::ios::end);
+    const size_t dataSize = size_t(mmf.tellg() - dataBegin);
+    mmf.seekg(dataBegin);
+    data.resize(dataSize + 1);
+    mmf.read(data.data(), dataSize);
+    data[dataSize] = '\0';
   }
   mmf.close();
-  std::sort(edges.begin(), edges.begin() + nE);
+  std::vector<lno_t> rows, cols;
+  std::vector<scalar_t> vals;
+  parse_mtx_entries(data.data(), data.size() - 1, nnz, nr, nc,
+                    mtx_format == ARRAY, mtx_field == PATTERN, rows, cols,
+                    vals);
+  // release the file contents before building the CRS arrays
+  std::vector<char>().swap(data);
   if (transpose) {
-    lno_t tmp = nr;
-    nr        = nc;
-    nc        = tmp;
+    std::swap(rows, cols);
+    std::swap(nr, nc);
   }
-  // idx *nv, idx *ne, idx **xadj, idx **adj, wt **wt
   *nrows = nr;
   *ncols = nc;
-  *ne    = nE;
-  //*xadj = new idx[nr + 1];
-  KokkosKernels::Impl::md_malloc<size_type>(xadj, nr + 1);
-  //*adj = new idx[nE];
-  KokkosKernels::Impl::md_malloc<lno_t>(adj, nE);
-  //*ew = new wt[nE];
-  KokkosKernels::Impl::md_malloc<scalar_t>(ew, nE);
-  size_type eind   = 0;
-  size_type actual = 0;
-  for (lno_t i = 0; i < nr; ++i) {
-    (*xadj)[i]    = actual;
-    bool is_first = true;
-    while (eind < nE && edges[eind].src == i) {
-      if (is_first || !symmetrize || eind == 0 ||
-          (eind > 0 && edges[eind - 1].dst != edges[eind].dst)) {
-        (*adj)[actual] = edges[eind].dst;
-        (*ew)[actual]  = edges[eind].ew;
-        ++actual;
-      }
-      is_first = false;
-      ++eind;
-    }
-  }
-  (*xadj)[nr] = actual;
-  *ne         = actual;
+  mtx_entries_to_crs(nr, rows, cols, vals, symmetrize, remove_diagonal,
+                     mtx_sym, ne, xadj, adj, ew);
   return 0;
 }
 
@@ -1097,8 +1604,14 @@ void read_matrix(lno_t *nv, size_type *ne, size_type **xadj, lno_t **adj,
   }
 }
 
+// Read a CrsMatrix from a MatrixMarket (.mtx, .mm), .bin or .crs file.
+// If useBinaryCache, a MatrixMarket file is loaded instead from its binary
+// sidecar, filename_ + ".crsbin", if it is at least as recent as the file and
+// was written with the same types; otherwise the file is parsed and the
+// sidecar is (re)written for the next time.
 template <typename crsMat_t>
-crsMat_t read_kokkos_crst_matrix(const char *filename_) {
+crsMat_t read_kokkos_crst_matrix(const char *filename_,
+                                 bool useBinaryCache = false) {
   std::string strfilename(filename_);
   bool isMatrixMarket = KokkosKernels::Impl::endswith(strfilename, ".mtx") ||
                         KokkosKernels::Impl::endswith(strfilename, ".mm");
@@ -1117,9 +1630,19 @@ crsMat_t read_kokkos_crst_matrix(const char *filename_) {
   scalar_t *values;
 
   if (isMatrixMarket) {
-    // MatrixMarket file contains the exact number of columns
-    read_mtx<lno_t, size_type, scalar_t>(filename_, &nr, &nc, &nnzA, &xadj,
-                                         &adj, &values, false, false, false);
+    std::string cacheName = strfilename + ".crsbin";
+    bool cached =
+        useBinaryCache &&
+        KokkosKernels::Impl::kk_get_file_mtime(cacheName.c_str()) >=
+            KokkosKernels::Impl::kk_get_file_mtime(filename_) &&
+        read_crs_bin(&nr, &nc, &nnzA, &xadj, &adj, &values, cacheName.c_str());
+    if (!cached) {
+      // MatrixMarket file contains the exact number of columns
+      read_mtx<lno_t, size_type, scalar_t>(filename_, &nr, &nc, &nnzA, &xadj,
+                                           &adj, &values, false, false, false);
+      if (useBinaryCache)
+        write_crs_bin(nr, nc, nnzA, xadj, adj, values, cacheName.c_str());
+    }
   } else {
     //.crs and .bin files don't contain #cols, so will compute it later based on
     // the entries
@@ -32,15 +32,28 @@ namespace Experimental {
 /// \class LUPrec
 /// \brief  This class is for applying LU preconditioning.
 ///         It takes L and U and the apply method returns U^inv L^inv x
-/// \tparam CRS the CRS type of L and U
+/// \tparam CRS the CRS type of the preconditioned matrix, which sets the
+/// working precision of apply
+/// \tparam FactorCRS the CRS type of L and U. Its scalar type may be a lower
+/// precision than that of CRS (e.g. float factors for a double matrix), to
+/// halve the memory traffic of apply; the solves still accumulate in the
+/// working precision.
 ///
 /// Preconditioner provides the following methods
-///   - initialize() Does nothing; members initialized upon object construction.
+///   - initialize() Computes the level schedules of the triangular solves
+///     of CrsMatrix factors, which depend only on the patterns of L and U;
+///     otherwise the first apply() does it.
 ///   - isInitialized() returns true
 ///   - compute() Does nothing; members initialized upon object construction.
 ///   - isComputed() returns true
 ///
-template <class CRS, class KernelHandle>
+/// With use_isai, apply multiplies by incomplete sparse approximate inverses
+/// of L and U (see sptrsv_isai), computed at construction, instead of
+/// solving: two SpMVs, which is only an approximation of U^inv L^inv x.
+/// With jacobi_sweeps > 0, apply approximates each triangular solve with that
+/// many Jacobi sweeps instead (see SPTRSVHandle::set_jacobi_sweeps).
+///
+template <class CRS, class KernelHandle, class FactorCRS = CRS>
 class LUPrec : public KokkosSparse::Experimental::Preconditioner<CRS> {
  public:
   using ScalarType = typename std::remove_const<typename CRS::value_type>::type;
@@ -52,21 +65,26 @@ class LUPrec : public KokkosSparse::Experimental::Preconditioner<CRS> {
 
  private:
   // trsm takes host views
-  CRS _L, _U;
+  FactorCRS _L, _U;
   View1d _tmp, _tmp2;
   mutable KernelHandle _khL;
   mutable KernelHandle _khU;
+  bool _use_isai;
+  int _jacobi_sweeps;
 
  public:
   //! Constructor:
   template <class CRSArg>
-  LUPrec(const CRSArg &L, const CRSArg &U)
+  LUPrec(const CRSArg &L, const CRSArg &U, const bool use_isai = false,
+         const int jacobi_sweeps = 0)
       : _L(L),
         _U(U),
         _tmp("LUPrec::_tmp", L.numPointRows()),
         _tmp2("LUPrec::_tmp", L.numPointRows()),
         _khL(),
-        _khU() {
+        _khU(),
+        _use_isai(use_isai),
+        _jacobi_sweeps(jacobi_sweeps) {
     KK_REQUIRE_MSG(L.numPointRows() == U.numPointRows(),
                    "LUPrec: L.numRows() != U.numRows()");
 
@@ -74,6 +92,32 @@ class LUPrec : public KokkosSparse::Experimental::Preconditioner<CRS> {
                               true);
     _khU.create_sptrsv_handle(SPTRSVAlgorithm::SEQLVLSCHD_TP1, U.numRows(),
                               false);
+    KK_REQUIRE_MSG(_jacobi_sweeps == 0 || is_crs_matrix<FactorCRS>::value,
+                   "LUPrec: jacobi_sweeps requires CrsMatrix L and U");
+    _khL.get_sptrsv_handle()->set_jacobi_sweeps(_jacobi_sweeps);
+    _khU.get_sptrsv_handle()->set_jacobi_sweeps(_jacobi_sweeps);
+
+    if (_use_isai) {
+      if constexpr (is_crs_matrix<FactorCRS>::value) {
+        _khL.get_sptrsv_handle()->set_isai(true);
+        _khU.get_sptrsv_handle()->set_isai(true);
+        sptrsv_isai(&_khL, _L.graph.row_map, _L.graph.entries, _L.values);
+        sptrsv_isai(&_khU, _U.graph.row_map, _U.graph.entries, _U.values);
+      } else {
+        KK_ERROR_MSG("LUPrec: use_isai requires CrsMatrix L and U");
+      }
+    }
+  }
+
+  //! Level schedules of the solves, computed once (CrsMatrix factors only)
+  void symbolic() const {
+    if constexpr (is_crs_matrix<FactorCRS>::value) {
+      if (_use_isai || _jacobi_sweeps != 0) return;
+      if (!_khL.get_sptrsv_handle()->is_symbolic_complete())
+        sptrsv_symbolic(&_khL, _L.graph.row_map, _L.graph.entries);
+      if (!_khU.get_sptrsv_handle()->is_symbolic_complete())
+        sptrsv_symbolic(&_khU, _U.graph.row_map, _U.graph.entries);
+    }
   }
 
   //! Destructor.
@@ -95,10 +139,9 @@ class LUPrec : public KokkosSparse::Experimental::Preconditioner<CRS> {
     KK_REQUIRE_MSG(transM[0] == NoTranspose[0],
                    "LUPrec::apply only supports 'N' for transM");
 
-    sptrsv_symbolic(&_khL, _L.graph.row_map, _L.graph.entries);
-    sptrsv_solve(&_khL, _L.graph.row_map, _L.graph.entries, _L.values, X, _tmp);
+    symbolic();
 
-    sptrsv_symbolic(&_khU, _U.graph.row_map, _U.graph.entries);
+    sptrsv_solve(&_khL, _L.graph.row_map, _L.graph.entries, _L.values, X, _tmp);
     sptrsv_solve(&_khU, _U.graph.row_map, _U.graph.entries, _U.values, _tmp,
                  _tmp2);
 
@@ -118,26 +161,9 @@ class LUPrec : public KokkosSparse::Experimental::Preconditioner<CRS> {
     KK_REQUIRE_MSG(transM[0] == NoTranspose[0],
                    "LUPrec::apply only supports 'N' for transM");
 
-#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT)
-    using Layout = Kokkos::LayoutLeft;
-#else
-    using Layout = Kokkos::LayoutRight;
-#endif
-
-    // trsv is implemented for MV so we need to convert our views
-    using UView2d = typename Kokkos::View<
-        ScalarType **, Layout, DEVICE,
-        Kokkos::MemoryTraits<Kokkos::Unmanaged | Kokkos::RandomAccess> >;
-    using UView2dc = typename Kokkos::View<
-        const ScalarType **, Layout, DEVICE,
-        Kokkos::MemoryTraits<Kokkos::Unmanaged | Kokkos::RandomAccess> >;
-    UView2dc X2d(X.data(), X.extent(0), 1);
-    UView2d Y2d(Y.data(), Y.extent(0), 1),
-        tmp2d(_tmp.data(), _tmp.extent(0), 1),
-        tmp22d(_tmp2.data(), _tmp2.extent(0), 1);
-
-    KokkosSparse::trsv("L", "N", "N", _L, X2d, tmp2d);
-    KokkosSparse::trsv("U", "N", "N", _U, tmp2d, tmp22d);
+    // Block level-scheduled solves, with the dense blocks of L and U
+    sptrsv_solve(&_khL, _L, X, _tmp);
+    sptrsv_solve(&_khU, _U, _tmp, _tmp2);
 
     KokkosBlas::axpby(alpha, _tmp2, beta, Y);
   }
@@ -158,14 +184,14 @@ class LUPrec : public KokkosSparse::Experimental::Preconditioner<CRS> {
                      const char transM[] = "N",
                      ScalarType alpha    = karith::one(),
                      ScalarType beta     = karith::zero()) const {
-    apply_impl<CRS>(X, Y, transM, alpha, beta);
+    apply_impl<FactorCRS>(X, Y, transM, alpha, beta);
   }
   //@}
 
   //! Set this preconditioner's parameters.
   void setParameters() {}
 
-  void initialize() {}
+  void initialize() { symbolic(); }
 
   //! True if the preconditioner has been successfully initialized, else false.
   bool isInitialized() const { return true; }
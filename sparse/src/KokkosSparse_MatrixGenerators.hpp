@@ -0,0 +1,437 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file KokkosSparse_MatrixGenerators.hpp
+/// \brief Parallel, seeded generators of large test matrices.
+///
+/// Unlike the generators of KokkosSparse_IOUtils.hpp, these build the matrix
+/// directly in the matrix's memory space with the matrix's execution space.
+/// Random choices come from a counter-based hash of (seed, row or edge), so
+/// the result depends only on the arguments and not on the backend or on how
+/// the work is scheduled.
+
+#ifndef KOKKOSSPARSE_MATRIXGENERATORS_HPP_
+#define KOKKOSSPARSE_MATRIXGENERATORS_HPP_
+
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+
+#include "Kokkos_Core.hpp"
+#include "KokkosKernels_SimpleUtils.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_SortCrs.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+
+/// splitmix64: advance state and return the next 64 random bits.
+KOKKOS_INLINE_FUNCTION uint64_t kk_splitmix64(uint64_t &state) {
+  uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+  z          = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z          = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+/// Initial splitmix64 state of the independent stream number stream.
+KOKKOS_INLINE_FUNCTION uint64_t kk_stream_state(uint64_t seed,
+                                                uint64_t stream) {
+  uint64_t s = seed ^ (stream * 0xD1B54A32D192ED03ULL);
+  return kk_splitmix64(s);
+}
+
+/// Uniform double in [0, 1) from the top 53 bits of the next draw.
+KOKKOS_INLINE_FUNCTION double kk_uniform01(uint64_t &state) {
+  return (kk_splitmix64(state) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+template <typename Ordinal>
+void kk_check_generated_size(const char *name, int64_t n) {
+  if (n > static_cast<int64_t>(std::numeric_limits<Ordinal>::max())) {
+    std::ostringstream os;
+    os << name << ": " << n
+       << " does not fit in the ordinal or offset type of the matrix.";
+    throw std::invalid_argument(os.str());
+  }
+}
+
+/// Finite-difference Laplacian on an nx x ny x nz grid with Dirichlet
+/// boundaries: 2 * dim on the diagonal and -1 for each neighbor in the grid.
+/// CountTag writes each row's length to rowmap(row), FillTag fills the row
+/// at rowmap(row) with sorted columns.
+template <typename rowmap_t, typename entries_t, typename values_t>
+struct LaplacianGenFunctor {
+  struct CountTag {};
+  struct FillTag {};
+  using size_type = typename rowmap_t::non_const_value_type;
+  using lno_t     = typename entries_t::non_const_value_type;
+  using scalar_t  = typename values_t::non_const_value_type;
+
+  int64_t nx, ny, nz;
+  int dim;
+  rowmap_t rowmap;
+  entries_t entries;
+  values_t values;
+
+  // Offsets of the stencil in increasing column order, and whether row
+  // (ix, iy, iz) has that neighbor.
+  KOKKOS_INLINE_FUNCTION bool has_neighbor(int k, int64_t ix, int64_t iy,
+                                           int64_t iz, int64_t &offset) const {
+    switch (k) {
+      case 0: offset = -nx * ny; return dim == 3 && iz > 0;
+      case 1: offset = -nx; return iy > 0;
+      case 2: offset = -1; return ix > 0;
+      case 3: offset = 0; return true;
+      case 4: offset = 1; return ix < nx - 1;
+      case 5: offset = nx; return iy < ny - 1;
+      default: offset = nx * ny; return dim == 3 && iz < nz - 1;
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const CountTag &,
+                                         const int64_t row) const {
+    const int64_t ix = row % nx, iy = (row / nx) % ny, iz = row / (nx * ny);
+    size_type count  = 0;
+    int64_t offset;
+    for (int k = 0; k < 7; k++)
+      if (has_neighbor(k, ix, iy, iz, offset)) count++;
+    rowmap(row) = count;
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const FillTag &,
+                                         const int64_t row) const {
+    const int64_t ix = row % nx, iy = (row / nx) % ny, iz = row / (nx * ny);
+    size_type pos    = rowmap(row);
+    int64_t offset;
+    for (int k = 0; k < 7; k++) {
+      if (!has_neighbor(k, ix, iy, iz, offset)) continue;
+      entries(pos) = static_cast<lno_t>(row + offset);
+      values(pos)  = static_cast<scalar_t>(offset == 0 ? 2.0 * dim : -1.0);
+      pos++;
+    }
+  }
+};
+
+/// Random banded matrix: row i has min(nnz_per_row, band) entries, where band
+/// is the number of columns in [i - bandwidth, i + bandwidth]. The diagonal
+/// is always present and equal to the row length, and the other entries are
+/// uniform in (-1, 1), so the matrix is strictly diagonally dominant.
+template <typename rowmap_t, typename entries_t, typename values_t>
+struct BandedGenFunctor {
+  struct CountTag {};
+  struct FillTag {};
+  using size_type = typename rowmap_t::non_const_value_type;
+  using lno_t     = typename entries_t::non_const_value_type;
+  using scalar_t  = typename values_t::non_const_value_type;
+
+  int64_t nrows, ncols, bandwidth, nnz_per_row;
+  uint64_t seed;
+  rowmap_t rowmap;
+  entries_t entries;
+  values_t values;
+
+  KOKKOS_INLINE_FUNCTION void band(const int64_t row, int64_t &lo, int64_t &hi,
+                                   int64_t &len) const {
+    lo  = row - bandwidth < 0 ? 0 : row - bandwidth;
+    hi  = row + bandwidth > ncols - 1 ? ncols - 1 : row + bandwidth;
+    len = hi >= lo ? hi - lo + 1 : 0;
+    if (len > nnz_per_row) len = nnz_per_row;
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const CountTag &,
+                                         const int64_t row) const {
+    int64_t lo, hi, len;
+    band(row, lo, hi, len);
+    rowmap(row) = static_cast<size_type>(len);
+  }
+
+  // Selection sampling (Knuth's algorithm S) over the off-diagonal columns
+  // of the band picks exactly the remaining entries, in increasing order.
+  KOKKOS_INLINE_FUNCTION void operator()(const FillTag &,
+                                         const int64_t row) const {
+    int64_t lo, hi, len;
+    band(row, lo, hi, len);
+    if (len == 0) return;
+    const bool has_diag = row >= lo && row <= hi;
+    int64_t avail       = hi - lo + 1 - has_diag;
+    int64_t need        = len - has_diag;
+    uint64_t state      = kk_stream_state(seed, row);
+    size_type pos       = rowmap(row);
+    for (int64_t j = lo; j <= hi; j++) {
+      if (j == row) {
+        entries(pos) = static_cast<lno_t>(j);
+        values(pos)  = static_cast<scalar_t>(static_cast<double>(len));
+        pos++;
+        continue;
+      }
+      if (need == 0) {
+        if (!has_diag || j > row) break;
+        continue;
+      }
+      if (kk_uniform01(state) * avail < need) {
+        entries(pos) = static_cast<lno_t>(j);
+        values(pos)  = static_cast<scalar_t>(2.0 * kk_uniform01(state) - 1.0);
+        pos++;
+        need--;
+      }
+      avail--;
+    }
+  }
+};
+
+/// R-MAT edge generator: each edge descends scale levels of the 2 x 2
+/// initiator [a b; c d], so the adjacency matrix is a sample of the scale-th
+/// Kronecker power of the initiator. Scrambling relabels vertices with the
+/// bijection v -> (mult * v + add) mod 2^scale to spread the high-degree
+/// vertices over the index range.
+template <typename rowmap_t, typename entries_t, typename edges_t>
+struct RmatGenFunctor {
+  using lno_t = typename entries_t::non_const_value_type;
+
+  int scale;
+  double a, ab, abc;
+  uint64_t seed, mult, add;
+  bool scramble;
+  edges_t src, dst;
+  rowmap_t counts;
+
+  KOKKOS_INLINE_FUNCTION uint64_t relabel(uint64_t v) const {
+    const uint64_t mask = (uint64_t(1) << scale) - 1;
+    return scramble ? (mult * v + add) & mask : v;
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const int64_t e) const {
+    uint64_t state = kk_stream_state(seed, e);
+    uint64_t i = 0, j = 0;
+    for (int level = 0; level < scale; level++) {
+      const double r = kk_uniform01(state);
+      i              = 2 * i + (r >= ab);
+      j              = 2 * j + ((r >= a && r < ab) || r >= abc);
+    }
+    src(e) = static_cast<lno_t>(relabel(i));
+    dst(e) = static_cast<lno_t>(relabel(j));
+    Kokkos::atomic_inc(&counts(src(e)));
+  }
+};
+
+template <typename rowmap_t, typename entries_t, typename values_t,
+          typename edges_t>
+struct RmatFillFunctor {
+  using scalar_t = typename values_t::non_const_value_type;
+
+  edges_t src, dst;
+  rowmap_t cursor;
+  entries_t entries;
+  values_t values;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const int64_t e) const {
+    const auto pos = Kokkos::atomic_fetch_add(
+        &cursor(src(e)), typename rowmap_t::non_const_value_type(1));
+    entries(pos) = dst(e);
+    values(pos)  = Kokkos::ArithTraits<scalar_t>::one();
+  }
+};
+
+template <typename crsMat_t, typename functor_t>
+crsMat_t kk_generate_by_rows(const char *name, int64_t nrows, int64_t ncols,
+                             int64_t max_nnz, functor_t f) {
+  using exec_space = typename crsMat_t::execution_space;
+  using size_type  = typename crsMat_t::non_const_size_type;
+  using lno_t      = typename crsMat_t::non_const_ordinal_type;
+  using count_pol  = Kokkos::RangePolicy<exec_space,
+                                        typename functor_t::CountTag, int64_t>;
+  using fill_pol =
+      Kokkos::RangePolicy<exec_space, typename functor_t::FillTag, int64_t>;
+
+  kk_check_generated_size<lno_t>(name, nrows);
+  kk_check_generated_size<lno_t>(name, ncols);
+  kk_check_generated_size<size_type>(name, max_nnz);
+  exec_space exec;
+  f.rowmap = typename crsMat_t::row_map_type::non_const_type(
+      std::string(name) + " rowmap", nrows + 1);
+  Kokkos::parallel_for(name, count_pol(exec, 0, nrows), f);
+  size_type nnz = 0;
+  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum(exec, nrows + 1,
+                                                        f.rowmap, nnz);
+  f.entries = typename crsMat_t::index_type::non_const_type(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing,
+                         std::string(name) + " entries"),
+      nnz);
+  f.values = typename crsMat_t::values_type::non_const_type(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing,
+                         std::string(name) + " values"),
+      nnz);
+  Kokkos::parallel_for(name, fill_pol(exec, 0, nrows), f);
+  exec.fence();
+  return crsMat_t(name, static_cast<lno_t>(nrows), static_cast<lno_t>(ncols),
+                  nnz, f.values, f.rowmap, f.entries);
+}
+
+/// \brief 5-point finite-difference Laplacian on an nx x ny grid, generated
+///   in parallel in the memory space of crsMat_t. Rows are numbered with x
+///   fastest; the columns of each row are sorted.
+template <typename crsMat_t>
+crsMat_t kk_generate_laplacian_2d(int64_t nx, int64_t ny) {
+  if (nx < 0 || ny < 0)
+    throw std::invalid_argument(
+        "kk_generate_laplacian_2d: grid dimensions must be nonnegative.");
+  using functor_t =
+      LaplacianGenFunctor<typename crsMat_t::row_map_type::non_const_type,
+                          typename crsMat_t::index_type::non_const_type,
+                          typename crsMat_t::values_type::non_const_type>;
+  functor_t f;
+  f.nx  = nx;
+  f.ny  = ny;
+  f.nz  = 1;
+  f.dim = 2;
+  return kk_generate_by_rows<crsMat_t>("KokkosSparse::Laplacian2D", nx * ny,
+                                       nx * ny, 5 * nx * ny, f);
+}
+
+/// \brief 7-point finite-difference Laplacian on an nx x ny x nz grid,
+///   generated in parallel in the memory space of crsMat_t. Rows are
+///   numbered with x fastest and z slowest; the columns of each row are
+///   sorted.
+template <typename crsMat_t>
+crsMat_t kk_generate_laplacian_3d(int64_t nx, int64_t ny, int64_t nz) {
+  if (nx < 0 || ny < 0 || nz < 0)
+    throw std::invalid_argument(
+        "kk_generate_laplacian_3d: grid dimensions must be nonnegative.");
+  using functor_t =
+      LaplacianGenFunctor<typename crsMat_t::row_map_type::non_const_type,
+                          typename crsMat_t::index_type::non_const_type,
+                          typename crsMat_t::values_type::non_const_type>;
+  functor_t f;
+  f.nx  = nx;
+  f.ny  = ny;
+  f.nz  = nz;
+  f.dim = 3;
+  return kk_generate_by_rows<crsMat_t>("KokkosSparse::Laplacian3D",
+                                       nx * ny * nz, nx * ny * nz,
+                                       7 * nx * ny * nz, f);
+}
+
+/// \brief Random, strictly diagonally dominant banded matrix, generated in
+///   parallel in the memory space of crsMat_t.
+///
+/// Row i has min(nnz_per_row, number of columns in [i - bandwidth,
+/// i + bandwidth]) entries at sorted, distinct columns of that band,
+/// including the diagonal when it is in range.
+template <typename crsMat_t>
+crsMat_t kk_generate_banded_sparse_matrix(int64_t nrows, int64_t ncols,
+                                          int64_t bandwidth,
+                                          int64_t nnz_per_row,
+                                          uint64_t seed = 13721) {
+  if (nrows < 0 || ncols < 0 || bandwidth < 0 || nnz_per_row < 0)
+    throw std::invalid_argument(
+        "kk_generate_banded_sparse_matrix: arguments must be nonnegative.");
+  using functor_t =
+      BandedGenFunctor<typename crsMat_t::row_map_type::non_const_type,
+                       typename crsMat_t::index_type::non_const_type,
+                       typename crsMat_t::values_type::non_const_type>;
+  functor_t f;
+  f.nrows       = nrows;
+  f.ncols       = ncols;
+  f.bandwidth   = bandwidth;
+  f.nnz_per_row = nnz_per_row;
+  f.seed        = seed;
+  const int64_t row_max =
+      nnz_per_row < 2 * bandwidth + 1 ? nnz_per_row : 2 * bandwidth + 1;
+  return kk_generate_by_rows<crsMat_t>("KokkosSparse::Banded", nrows, ncols,
+                                       nrows * row_max, f);
+}
+
+/// \brief R-MAT (stochastic Kronecker) power-law graph with 2^scale vertices
+///   and edge_factor * 2^scale sampled edges, generated in parallel in the
+///   memory space of crsMat_t.
+///
+/// Duplicate edges are merged, so a value counts how many times its edge was
+/// sampled; the columns of each row are sorted. The default initiator
+/// (a, b, c) = (0.57, 0.19, 0.19) is the Graph500 one.
+template <typename crsMat_t>
+crsMat_t kk_generate_rmat_matrix(int scale, int64_t edge_factor,
+                                 uint64_t seed = 13721, double a = 0.57,
+                                 double b = 0.19, double c = 0.19,
+                                 bool scramble = true) {
+  using exec_space = typename crsMat_t::execution_space;
+  using rowmap_t   = typename crsMat_t::row_map_type::non_const_type;
+  using entries_t  = typename crsMat_t::index_type::non_const_type;
+  using values_t   = typename crsMat_t::values_type::non_const_type;
+  using size_type  = typename crsMat_t::non_const_size_type;
+  using lno_t      = typename crsMat_t::non_const_ordinal_type;
+  using range_t    = Kokkos::RangePolicy<exec_space, int64_t>;
+
+  if (scale < 0 || scale > 62 || edge_factor < 0 || a < 0 || b < 0 ||
+      c < 0 || a + b + c > 1) {
+    throw std::invalid_argument(
+        "kk_generate_rmat_matrix: scale must be in [0, 62], edge_factor "
+        "nonnegative and a, b, c nonnegative with a + b + c <= 1.");
+  }
+  const int64_t n      = int64_t(1) << scale;
+  const int64_t nedges = edge_factor * n;
+  kk_check_generated_size<lno_t>("kk_generate_rmat_matrix", n);
+  kk_check_generated_size<size_type>("kk_generate_rmat_matrix", nedges);
+
+  exec_space exec;
+  RmatGenFunctor<rowmap_t, entries_t, entries_t> gen;
+  gen.scale    = scale;
+  gen.a        = a;
+  gen.ab       = a + b;
+  gen.abc      = a + b + c;
+  gen.seed     = seed;
+  uint64_t s   = seed;
+  gen.mult     = kk_splitmix64(s) | 1;
+  gen.add      = kk_splitmix64(s);
+  gen.scramble = scramble;
+  gen.src      = entries_t(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "RMAT src"), nedges);
+  gen.dst = entries_t(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "RMAT dst"), nedges);
+  gen.counts = rowmap_t("RMAT rowmap", n + 1);
+  Kokkos::parallel_for("KokkosSparse::RMAT::edges", range_t(exec, 0, nedges),
+                       gen);
+  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum(exec, n + 1,
+                                                        gen.counts);
+
+  RmatFillFunctor<rowmap_t, entries_t, values_t, entries_t> fill;
+  fill.src    = gen.src;
+  fill.dst    = gen.dst;
+  fill.cursor = rowmap_t(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "RMAT cursor"), n);
+  Kokkos::deep_copy(
+      exec, fill.cursor,
+      Kokkos::subview(gen.counts, Kokkos::make_pair(int64_t(0), n)));
+  fill.entries = entries_t(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "RMAT entries"),
+      nedges);
+  fill.values = values_t(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "RMAT values"), nedges);
+  Kokkos::parallel_for("KokkosSparse::RMAT::fill", range_t(exec, 0, nedges),
+                       fill);
+
+  crsMat_t unmerged("KokkosSparse::RMAT", static_cast<lno_t>(n),
+                    static_cast<lno_t>(n), static_cast<size_type>(nedges),
+                    fill.values, gen.counts, fill.entries);
+  crsMat_t A = KokkosSparse::sort_and_merge_matrix(exec, unmerged);
+  exec.fence();
+  return A;
+}
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_MATRIXGENERATORS_HPP_
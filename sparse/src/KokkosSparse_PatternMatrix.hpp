@@ -0,0 +1,115 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file KokkosSparse_PatternMatrix.hpp
+/// \brief A sparse matrix whose stored entries are all one, given by its
+///   graph alone (no values array).
+
+#ifndef KOKKOSSPARSE_PATTERNMATRIX_HPP_
+#define KOKKOSSPARSE_PATTERNMATRIX_HPP_
+
+#include <type_traits>
+#include <Kokkos_Core.hpp>
+#include "Kokkos_ArithTraits.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+
+/// \brief Values of a PatternMatrix: every entry is one, and nothing is read
+///   from memory.
+template <typename ScalarType>
+struct UnitValues {
+  KOKKOS_INLINE_FUNCTION ScalarType operator()(const size_t) const {
+    return Kokkos::ArithTraits<ScalarType>::one();
+  }
+};
+
+/// \class PatternMatrix
+/// \brief The matrix of ones with the sparsity pattern of a graph.
+///
+/// Unweighted graphs only need their row map and entries; a PatternMatrix
+/// wraps a Kokkos::StaticCrsGraph (for example the graph of a CrsMatrix)
+/// with the number of columns, and can be passed where the kernels below
+/// take a CrsMatrix, without allocating or reading an array of ones:
+///  - spmv_pattern (KokkosSparse_spmv_pattern.hpp);
+///  - spgemm_masked (KokkosSparse_spgemm_masked.hpp), for M, A and B;
+///  - spgemm_semiring (KokkosSparse_spgemm_semiring.hpp), for A and B.
+///
+/// The values of a product are then counts of paths: the triangles of an
+/// undirected graph are the sum of the values of C<L> = L*L, with L the
+/// strictly lower triangle of its adjacency graph.
+///
+/// \tparam GraphType A Kokkos::StaticCrsGraph.
+/// \tparam ScalarType The type of the (implicit) values.
+template <typename GraphType, typename ScalarType>
+class PatternMatrix {
+ public:
+  using graph_type             = GraphType;
+  using StaticCrsGraphType     = GraphType;
+  using non_const_value_type   = std::remove_const_t<ScalarType>;
+  using const_value_type       = const non_const_value_type;
+  using ordinal_type           = typename GraphType::data_type;
+  using non_const_ordinal_type = std::remove_const_t<ordinal_type>;
+  using size_type              = typename GraphType::size_type;
+  using non_const_size_type    = std::remove_const_t<size_type>;
+  using device_type            = typename GraphType::device_type;
+  using execution_space        = typename device_type::execution_space;
+  using memory_space           = typename device_type::memory_space;
+
+  GraphType graph;
+  UnitValues<non_const_value_type> values;
+
+  PatternMatrix() : numCols_(0) {}
+
+  /// \param graph_ [in] The graph.
+  /// \param ncols [in] The number of columns, larger than every entry.
+  PatternMatrix(const GraphType& graph_, const ordinal_type ncols)
+      : graph(graph_), numCols_(ncols) {}
+
+  KOKKOS_INLINE_FUNCTION ordinal_type numRows() const {
+    return graph.row_map.extent(0) ? graph.row_map.extent(0) - 1 : 0;
+  }
+  KOKKOS_INLINE_FUNCTION ordinal_type numCols() const { return numCols_; }
+  KOKKOS_INLINE_FUNCTION size_type nnz() const {
+    return graph.entries.extent(0);
+  }
+
+ private:
+  ordinal_type numCols_;
+};
+
+/// \brief The PatternMatrix of a graph, with values of type ScalarType.
+template <typename ScalarType, typename GraphType>
+PatternMatrix<GraphType, ScalarType> make_pattern_matrix(
+    const GraphType& graph, const typename GraphType::data_type ncols) {
+  return PatternMatrix<GraphType, ScalarType>(graph, ncols);
+}
+
+/// \brief is_pattern_matrix_v<T> is true if T is a PatternMatrix.
+template <typename>
+struct is_pattern_matrix : public std::false_type {};
+template <typename G, typename S>
+struct is_pattern_matrix<PatternMatrix<G, S>> : public std::true_type {};
+template <typename G, typename S>
+struct is_pattern_matrix<const PatternMatrix<G, S>> : public std::true_type {};
+
+template <typename T>
+inline constexpr bool is_pattern_matrix_v = is_pattern_matrix<T>::value;
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_PATTERNMATRIX_HPP_
@@ -0,0 +1,250 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef _KOKKOSSPARSE_PERMUTECRS_HPP
+#define _KOKKOSSPARSE_PERMUTECRS_HPP
+
+#include "Kokkos_Core.hpp"
+#include "KokkosKernels_Utils.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_BsrMatrix.hpp"
+#include "KokkosSparse_SortCrs.hpp"
+#include <stdexcept>
+
+namespace KokkosSparse {
+namespace Impl {
+
+template <typename perm_t, typename inv_perm_t>
+struct InversePermutationFunctor {
+  using lno_t = typename inv_perm_t::non_const_value_type;
+
+  InversePermutationFunctor(const perm_t& perm_, const inv_perm_t& invPerm_)
+      : perm(perm_), invPerm(invPerm_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(lno_t i) const {
+    invPerm(perm(i)) = i;
+  }
+
+  perm_t perm;
+  inv_perm_t invPerm;
+};
+
+// New row lengths: row rowPerm(i) has the length of row i
+template <typename rowmap_t, typename perm_t, typename out_rowmap_t>
+struct PermutedRowLengthsFunctor {
+  using lno_t = typename perm_t::non_const_value_type;
+
+  PermutedRowLengthsFunctor(const rowmap_t& rowmap_, const perm_t& rowPerm_,
+                            const out_rowmap_t& outRowmap_)
+      : rowmap(rowmap_), rowPerm(rowPerm_), outRowmap(outRowmap_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(lno_t row) const {
+    outRowmap(rowPerm(row)) = rowmap(row + 1) - rowmap(row);
+  }
+
+  rowmap_t rowmap;
+  perm_t rowPerm;
+  out_rowmap_t outRowmap;
+};
+
+// Copy old row rowInvPerm(row) to row, relabeling the columns by colPerm.
+// Each entry has blockSize values (1 for CRS, the squared block size for BSR).
+// values may be empty to permute only a graph.
+template <typename rowmap_t, typename entries_t, typename values_t,
+          typename inv_perm_t, typename perm_t, typename out_rowmap_t,
+          typename out_entries_t, typename out_values_t>
+struct PermutedEntriesFunctor {
+  using size_type = typename rowmap_t::non_const_value_type;
+  using lno_t     = typename inv_perm_t::non_const_value_type;
+
+  PermutedEntriesFunctor(const rowmap_t& rowmap_, const entries_t& entries_,
+                         const values_t& values_, const size_type blockSize_,
+                         const inv_perm_t& rowInvPerm_, const perm_t& colPerm_,
+                         const out_rowmap_t& outRowmap_,
+                         const out_entries_t& outEntries_,
+                         const out_values_t& outValues_)
+      : rowmap(rowmap_),
+        entries(entries_),
+        values(values_),
+        blockSize(blockSize_),
+        rowInvPerm(rowInvPerm_),
+        colPerm(colPerm_),
+        outRowmap(outRowmap_),
+        outEntries(outEntries_),
+        outValues(outValues_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(lno_t row) const {
+    lno_t oldRow       = rowInvPerm(row);
+    size_type rowBegin = rowmap(oldRow);
+    size_type rowEnd   = rowmap(oldRow + 1);
+    size_type outPos   = outRowmap(row);
+    for (size_type j = rowBegin; j < rowEnd; j++, outPos++) {
+      outEntries(outPos) = colPerm(entries(j));
+      if (!values.extent(0)) continue;
+      for (size_type k = 0; k < blockSize; k++)
+        outValues(outPos * blockSize + k) = values(j * blockSize + k);
+    }
+  }
+
+  rowmap_t rowmap;
+  entries_t entries;
+  values_t values;
+  size_type blockSize;
+  inv_perm_t rowInvPerm;
+  perm_t colPerm;
+  out_rowmap_t outRowmap;
+  out_entries_t outEntries;
+  out_values_t outValues;
+};
+
+// Permute the rows and columns of a CRS (or BSR, with blockSize values per
+// entry) matrix or graph: entry (i, j) becomes (rowPerm(i), colPerm(j)).
+// The rows of the output are not sorted.
+template <typename execution_space, typename rowmap_t, typename entries_t,
+          typename values_t, typename row_perm_t, typename row_inv_perm_t,
+          typename col_perm_t, typename out_rowmap_t, typename out_entries_t,
+          typename out_values_t>
+void permute_crs(const rowmap_t& rowmap, const entries_t& entries,
+                 const values_t& values,
+                 typename rowmap_t::non_const_value_type blockSize,
+                 const row_perm_t& rowPerm, const row_inv_perm_t& rowInvPerm,
+                 const col_perm_t& colPerm, out_rowmap_t& outRowmap,
+                 out_entries_t& outEntries, const out_values_t& outValues) {
+  using lno_t     = typename entries_t::non_const_value_type;
+  using range_pol = Kokkos::RangePolicy<execution_space>;
+  lno_t numRows   = rowmap.extent(0) ? rowmap.extent(0) - 1 : 0;
+  if (rowPerm.extent(0) != size_t(numRows) ||
+      rowInvPerm.extent(0) != size_t(numRows))
+    throw std::invalid_argument(
+        "permute_crs: the row permutation and its inverse must have one entry "
+        "per row");
+  outRowmap  = out_rowmap_t("Permuted rowmap", numRows + 1);
+  outEntries = out_entries_t(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "Permuted entries"),
+      entries.extent(0));
+  Kokkos::parallel_for(
+      range_pol(0, numRows),
+      PermutedRowLengthsFunctor<rowmap_t, row_perm_t, out_rowmap_t>(
+          rowmap, rowPerm, outRowmap));
+  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum<execution_space>(
+      numRows + 1, outRowmap);
+  Kokkos::parallel_for(
+      range_pol(0, numRows),
+      PermutedEntriesFunctor<rowmap_t, entries_t, values_t, row_inv_perm_t,
+                             col_perm_t, out_rowmap_t, out_entries_t,
+                             out_values_t>(rowmap, entries, values, blockSize,
+                                           rowInvPerm, colPerm, outRowmap,
+                                           outEntries, outValues));
+}
+
+template <typename execution_space, typename perm_t>
+typename perm_t::non_const_type inverse_permutation(const perm_t& perm) {
+  using inv_perm_t = typename perm_t::non_const_type;
+  inv_perm_t invPerm(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "Inverse permutation"),
+      perm.extent(0));
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<execution_space>(0, perm.extent(0)),
+      InversePermutationFunctor<perm_t, inv_perm_t>(perm, invPerm));
+  return invPerm;
+}
+
+}  // namespace Impl
+
+// Permute the rows and columns of a CrsMatrix or BsrMatrix A: returns B with
+// B(rowPerm(i), colPerm(j)) = A(i, j) (block rows and columns for BSR), and
+// the entries of each row of B sorted. rowInvPerm must be the inverse of
+// rowPerm. perm(i) is the new index of row/column i, like the labels returned
+// by graph reorderings such as KokkosGraph::Experimental::graph_rcm.
+template <typename matrix_t, typename row_perm_t, typename row_inv_perm_t,
+          typename col_perm_t>
+matrix_t permute_matrix(const matrix_t& A, const row_perm_t& rowPerm,
+                        const row_inv_perm_t& rowInvPerm,
+                        const col_perm_t& colPerm) {
+  static_assert(is_crs_matrix_v<matrix_t> ||
+                    Experimental::is_bsr_matrix_v<matrix_t>,
+                "permute_matrix: A must be a CrsMatrix or a BsrMatrix");
+  using exec_space = typename matrix_t::execution_space;
+  using ordinal_t  = typename matrix_t::ordinal_type;
+  using size_type  = typename matrix_t::size_type;
+  using rowmap_t   = typename matrix_t::row_map_type::non_const_type;
+  using entries_t  = typename matrix_t::index_type::non_const_type;
+  using values_t   = typename matrix_t::values_type::non_const_type;
+  if (colPerm.extent(0) != size_t(A.numCols()))
+    throw std::invalid_argument(
+        "permute_matrix: the column permutation must have one entry per "
+        "column");
+  ordinal_t blockDim = 1;
+  if constexpr (Experimental::is_bsr_matrix_v<matrix_t>)
+    blockDim = A.blockDim();
+  rowmap_t rowmap;
+  entries_t entries;
+  values_t values(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "Permuted values"),
+      A.values.extent(0));
+  Impl::permute_crs<exec_space>(A.graph.row_map, A.graph.entries, A.values,
+                                size_type(blockDim) * blockDim, rowPerm,
+                                rowInvPerm, colPerm, rowmap, entries, values);
+  if constexpr (Experimental::is_bsr_matrix_v<matrix_t>) {
+    matrix_t B("Permuted", A.numRows(), A.numCols(), A.nnz(), values, rowmap,
+               entries, blockDim);
+    sort_bsr_matrix(B);
+    return B;
+  } else {
+    matrix_t B("Permuted", A.numRows(), A.numCols(), A.nnz(), values, rowmap,
+               entries);
+    sort_crs_matrix(B);
+    return B;
+  }
+}
+
+// Symmetrically permute a square CrsMatrix or BsrMatrix: returns B = P A P^T,
+// with B(perm(i), perm(j)) = A(i, j). invPerm must be the inverse of perm.
+template <typename matrix_t, typename perm_t, typename inv_perm_t>
+matrix_t permute_matrix(const matrix_t& A, const perm_t& perm,
+                        const inv_perm_t& invPerm) {
+  if (A.numRows() != A.numCols())
+    throw std::invalid_argument("permute_matrix: A must be square");
+  return permute_matrix(A, perm, invPerm, perm);
+}
+
+// Symmetrically permute a square CRS matrix, like permute_matrix, computing
+// the inverse of perm.
+template <typename crsMat_t, typename perm_t>
+crsMat_t permute_crs_matrix(const crsMat_t& A, const perm_t& perm) {
+  using exec_space = typename crsMat_t::execution_space;
+  if (A.numRows() != A.numCols())
+    throw std::invalid_argument("permute_crs_matrix: A must be square");
+  return permute_matrix(A, perm, Impl::inverse_permutation<exec_space>(perm),
+                        perm);
+}
+
+// Symmetrically permute a square CRS graph, like permute_crs_matrix.
+template <typename execution_space, typename rowmap_t, typename entries_t,
+          typename perm_t, typename out_rowmap_t, typename out_entries_t>
+void permute_crs_graph(const rowmap_t& rowmap, const entries_t& entries,
+                       const perm_t& perm, out_rowmap_t& outRowmap,
+                       out_entries_t& outEntries) {
+  using no_values_t = Kokkos::View<int*, typename out_entries_t::device_type>;
+  Impl::permute_crs<execution_space>(
+      rowmap, entries, no_values_t(), 1, perm,
+      Impl::inverse_permutation<execution_space>(perm), perm, outRowmap,
+      outEntries, no_values_t());
+  sort_crs_graph<execution_space>(outRowmap, outEntries);
+}
+
+}  // namespace KokkosSparse
+
+#endif
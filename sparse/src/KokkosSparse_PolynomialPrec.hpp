@@ -0,0 +1,232 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// @file KokkosSparse_PolynomialPrec.hpp
+
+#ifndef KK_POLYNOMIAL_PREC_HPP
+#define KK_POLYNOMIAL_PREC_HPP
+
+#include <algorithm>
+#include <vector>
+#include <KokkosSparse_Preconditioner.hpp>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+#include <KokkosBlas.hpp>
+#include <KokkosSparse_spmv.hpp>
+#include "KokkosKernels_Error.hpp"
+#include "KokkosSparse_polynomial_impl.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+
+/// \class PolynomialPrec
+/// \brief GMRES polynomial preconditioner: apply returns p(A) x, where
+///        1 - lambda p(lambda) is the residual polynomial of degree steps
+///        of GMRES with A.
+/// \tparam CRS the type of compressed matrix
+///
+/// compute() runs degree Arnoldi steps from a random vector and takes the
+/// harmonic Ritz values theta_i (the roots of the GMRES polynomial) from the
+/// small Hessenberg matrix. apply uses the product form
+/// 1 - lambda p(lambda) = prod_i (1 - lambda / theta_i), with the roots in
+/// modified Leja order and complex conjugate pairs combined in real
+/// arithmetic (Loe and Morgan); so it is degree SpMVs and vector updates,
+/// without any reduction or triangular solve. If the Arnoldi run breaks
+/// down early, the degree is lowered accordingly.
+///
+/// Only real scalar types are supported.
+///
+/// PolynomialPrec provides the following methods
+///   - initialize() Does nothing.
+///   - isInitialized() returns true
+///   - compute() Computes the roots of the polynomial.
+///   - isComputed() returns true once compute() has been called
+///
+template <class CRS>
+class PolynomialPrec : public KokkosSparse::Experimental::Preconditioner<CRS> {
+ public:
+  using ScalarType = typename std::remove_const<typename CRS::value_type>::type;
+  using EXSP       = typename CRS::execution_space;
+  using MEMSP      = typename CRS::memory_space;
+  using DEVICE     = typename Kokkos::Device<EXSP, MEMSP>;
+  using karith     = typename Kokkos::ArithTraits<ScalarType>;
+  using MagType    = typename karith::mag_type;
+  using View1d     = typename Kokkos::View<ScalarType *, DEVICE>;
+  using View2d =
+      typename Kokkos::View<ScalarType **, Kokkos::LayoutLeft, DEVICE>;
+
+  static_assert(is_crs_matrix<CRS>::value,
+                "PolynomialPrec: CRS must be a KokkosSparse::CrsMatrix");
+  static_assert(!karith::is_complex,
+                "PolynomialPrec: only real scalar types are supported");
+
+ private:
+  CRS _A;
+  int _degree;
+  std::vector<MagType> _re, _im;
+  View1d _prod, _y, _w;
+  bool _is_computed;
+
+ public:
+  //! Constructor: the polynomial has (at most) the given degree
+  template <class CRSArg>
+  PolynomialPrec(const CRSArg &A, const int degree = 5)
+      : _A(A),
+        _degree(degree),
+        _prod("PolynomialPrec::_prod", A.numRows()),
+        _y("PolynomialPrec::_y", A.numRows()),
+        _w("PolynomialPrec::_w", A.numRows()),
+        _is_computed(false) {
+    KK_REQUIRE_MSG(A.numRows() == A.numCols(),
+                   "PolynomialPrec: the matrix must be square");
+    KK_REQUIRE_MSG(_degree >= 1, "PolynomialPrec: degree must be at least 1");
+  }
+
+  //! Destructor.
+  virtual ~PolynomialPrec() {}
+
+  //! The degree of the polynomial set by compute(), at most the requested
+  //! one
+  int getDegree() const { return _re.size(); }
+
+  //! The roots theta_i of the residual polynomial (real and imaginary
+  //! parts), in the order of apply
+  const std::vector<MagType> &getRootsReal() const { return _re; }
+  const std::vector<MagType> &getRootsImag() const { return _im; }
+
+  ///// \brief Apply the preconditioner to X, putting the result in Y.
+  /////
+  ///// \param transM [in] Only "N" is supported.
+  ///// \param alpha [in] Input coefficient of M*x
+  ///// \param beta [in] Input coefficient of Y
+  /////
+  ///// Computes Y = beta Y + alpha p(A) X.
+  //
+  virtual void apply(const Kokkos::View<const ScalarType *, DEVICE> &X,
+                     const Kokkos::View<ScalarType *, DEVICE> &Y,
+                     const char transM[] = "N",
+                     ScalarType alpha    = karith::one(),
+                     ScalarType beta     = karith::zero()) const {
+    KK_REQUIRE_MSG(transM[0] == NoTranspose[0],
+                   "PolynomialPrec::apply only supports 'N' for transM");
+    KK_REQUIRE_MSG(_is_computed,
+                   "PolynomialPrec::apply called before compute()");
+
+    const ScalarType one  = karith::one();
+    const ScalarType zero = karith::zero();
+
+    // prod = prod_i (I - A / theta_i) x is the residual and y = p(A) x
+    Kokkos::deep_copy(_prod, X);
+    Kokkos::deep_copy(_y, zero);
+    const int d = _re.size();
+    for (int i = 0; i < d; i++) {
+      if (_im[i] == MagType(0)) {
+        const ScalarType c = one / _re[i];
+        KokkosBlas::axpy(c, _prod, _y);  // y += prod / theta
+        KokkosSparse::spmv("N", one, _A, _prod, zero, _w);
+        KokkosBlas::axpy(-c, _w, _prod);  // prod -= A prod / theta
+      } else {
+        // (I - A / theta)(I - A / conj(theta)) = I - A q(A), with
+        // q(A) = (2 Re(theta) I - A) / |theta|^2
+        const MagType mod2 = _re[i] * _re[i] + _im[i] * _im[i];
+        KokkosSparse::spmv("N", one, _A, _prod, zero, _w);  // w = A prod
+        KokkosBlas::axpby(ScalarType(2 * _re[i] / mod2), _prod,
+                          ScalarType(-1 / mod2), _w);  // w = q(A) prod
+        KokkosBlas::axpy(one, _w, _y);
+        KokkosSparse::spmv("N", -one, _A, _w, one, _prod);
+        i++;  // skip the conjugate
+      }
+    }
+
+    KokkosBlas::axpby(alpha, _y, beta, Y);
+  }
+  //@}
+
+  //! Set this preconditioner's parameters.
+  void setParameters() {}
+
+  void initialize() {}
+
+  //! True if the preconditioner has been successfully initialized, else false.
+  bool isInitialized() const { return true; }
+
+  //! Runs the Arnoldi steps from a random vector and computes the harmonic
+  //! Ritz values
+  void compute() {
+    const auto n = _A.numRows();
+    int d        = std::min<int>(_degree, n);
+
+    // Arnoldi with modified Gram-Schmidt; only H is kept on the host
+    View2d V("PolynomialPrec::V", n, d + 1);
+    Kokkos::View<MagType **, Kokkos::LayoutRight, Kokkos::HostSpace> H(
+        "PolynomialPrec::H", d + 1, d);
+    auto v0 = Kokkos::subview(V, Kokkos::ALL, 0);
+    Kokkos::Random_XorShift64_Pool<EXSP> pool(13718);
+    Kokkos::fill_random(v0, pool, karith::one());
+    KokkosBlas::scal(v0, ScalarType(1 / KokkosBlas::nrm2(v0)), v0);
+    const MagType breakdown = 100 * Kokkos::ArithTraits<MagType>::epsilon();
+    for (int j = 0; j < d; j++) {
+      auto vj = Kokkos::subview(V, Kokkos::ALL, j + 1);
+      KokkosSparse::spmv("N", karith::one(), _A,
+                         Kokkos::subview(V, Kokkos::ALL, j), karith::zero(),
+                         vj);
+      const MagType nrm_av = KokkosBlas::nrm2(vj);
+      for (int i = 0; i <= j; i++) {
+        auto vi = Kokkos::subview(V, Kokkos::ALL, i);
+        H(i, j) = KokkosBlas::dot(vi, vj);
+        KokkosBlas::axpy(ScalarType(-H(i, j)), vi, vj);
+      }
+      H(j + 1, j) = KokkosBlas::nrm2(vj);
+      if (H(j + 1, j) <= breakdown * nrm_av) {
+        // Invariant subspace: the degree j + 1 polynomial is exact
+        d = j + 1;
+        break;
+      }
+      KokkosBlas::scal(vj, ScalarType(1 / H(j + 1, j)), vj);
+    }
+
+    _re.clear();
+    _im.clear();
+    if (!KokkosSparse::Impl::polynomial_harmonic_ritz(H, d, _re, _im)) {
+      // The Hessenberg matrix is too singular, so fall back on the
+      // degree 1 polynomial with the Rayleigh quotient as root
+      KK_REQUIRE_MSG(H(0, 0) != MagType(0),
+                     "PolynomialPrec: cannot build a polynomial for A");
+      _re.assign(1, H(0, 0));
+      _im.assign(1, MagType(0));
+    }
+    KokkosSparse::Impl::polynomial_leja_order(_re, _im);
+    // A complex root without its conjugate (it should not happen) is
+    // replaced by its real part
+    for (size_t i = 0; i < _re.size(); i++) {
+      if (_im[i] == MagType(0)) continue;
+      if (i + 1 < _re.size() && _im[i + 1] == -_im[i]) {
+        i++;
+      } else {
+        _im[i] = MagType(0);
+      }
+    }
+    _is_computed = true;
+  }
+
+  //! True if the preconditioner has been successfully computed, else false.
+  bool isComputed() const { return _is_computed; }
+};
+
+}  // namespace Experimental
+}  // End namespace KokkosSparse
+
+#endif
@@ -0,0 +1,351 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// @file KokkosSparse_SchwarzPrec.hpp
+
+#ifndef KK_SCHWARZ_PREC_HPP
+#define KK_SCHWARZ_PREC_HPP
+
+#include <algorithm>
+#include <vector>
+
+#include <KokkosSparse_Preconditioner.hpp>
+#include <Kokkos_Core.hpp>
+#include "KokkosKernels_Error.hpp"
+#include "KokkosKernels_SimpleUtils.hpp"
+#include "KokkosKernels_Sorting.hpp"
+#include "KokkosSparse_Utils.hpp"
+#include "KokkosSparse_block_jacobi_impl.hpp"
+#include "KokkosSparse_schwarz_impl.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+
+/// \class SchwarzPrec
+/// \brief Weighted additive Schwarz preconditioner with overlapping
+///        subdomains: apply returns sum_b W R_b^T A_b^inv R_b x, where R_b
+///        restricts to the rows of subdomain b, A_b = R_b A R_b^T and W
+///        divides each row by the number of subdomains holding it.
+/// \tparam CRS the type of compressed matrix
+///
+/// The subdomains start from a partition of the rows, either contiguous
+/// blocks or given parts (e.g. from KokkosGraph::Experimental::partitioner),
+/// and are grown by overlap levels of the graph of A. With overlap 0 and
+/// contiguous blocks this is block Jacobi.
+///
+/// initialize() builds the subdomains from the pattern of A. compute()
+/// extracts the A_b in parallel into dense blocks padded to the largest
+/// subdomain and inverts them with the batched (serial per block) LU
+/// factorization and inverse, without pivoting; so the A_b must have nonzero
+/// pivots, e.g. when A is diagonally dominant or symmetric positive definite.
+/// The dense blocks take num_subdomains * max_size^2 scalars, which suits
+/// many small subdomains. apply is a gather over the subdomains of each row,
+/// without atomics, so its result is deterministic. The weighting makes the
+/// preconditioner nonsymmetric: use it with GMRES rather than CG.
+///
+/// SchwarzPrec provides the following methods
+///   - initialize() Builds the overlapping subdomains.
+///   - isInitialized() returns true once initialize() has been called
+///   - compute() Extracts and inverts the subdomain matrices, calling
+///     initialize() first if needed.
+///   - isComputed() returns true once compute() has been called
+///
+template <class CRS>
+class SchwarzPrec : public KokkosSparse::Experimental::Preconditioner<CRS> {
+ public:
+  using ScalarType = typename std::remove_const<typename CRS::value_type>::type;
+  using EXSP       = typename CRS::execution_space;
+  using MEMSP      = typename CRS::memory_space;
+  using DEVICE     = typename Kokkos::Device<EXSP, MEMSP>;
+  using karith     = typename Kokkos::ArithTraits<ScalarType>;
+
+  using ordinal_type = typename CRS::non_const_ordinal_type;
+  using size_type    = typename CRS::non_const_size_type;
+  using OrdinalView  = typename CRS::index_type::non_const_type;
+  using OffsetView   = typename CRS::row_map_type::non_const_type;
+  using PartsView    = Kokkos::View<const ordinal_type *, DEVICE>;
+
+  using View2d =
+      typename Kokkos::View<ScalarType **, Kokkos::LayoutRight, DEVICE>;
+  using View3d =
+      typename Kokkos::View<ScalarType ***, Kokkos::LayoutRight, DEVICE>;
+
+  static_assert(is_crs_matrix<CRS>::value,
+                "SchwarzPrec: CRS must be a KokkosSparse::CrsMatrix");
+
+ private:
+  CRS _A;
+  int _num_subdomains;
+  int _overlap;
+  PartsView _parts;
+  ordinal_type _rows_per_block;
+  ordinal_type _max_size;
+  OffsetView _sub_ptr;
+  OrdinalView _sub_rows;
+  OffsetView _mem_ptr;
+  OrdinalView _mem_sub;
+  OrdinalView _mem_local;
+  View3d _blocks;
+  bool _is_initialized;
+  bool _is_computed;
+
+  void check_arguments() const {
+    KK_REQUIRE_MSG(_A.numRows() == _A.numCols(),
+                   "SchwarzPrec: the matrix must be square");
+    KK_REQUIRE_MSG(_num_subdomains >= 1,
+                   "SchwarzPrec: num_subdomains must be at least 1");
+    KK_REQUIRE_MSG(_overlap >= 0, "SchwarzPrec: overlap must be nonnegative");
+  }
+
+ public:
+  //! Constructor: the rows of A are split into num_subdomains contiguous
+  //! blocks, each grown by overlap levels
+  template <class CRSArg>
+  SchwarzPrec(const CRSArg &A, const int num_subdomains, const int overlap = 1)
+      : _A(A),
+        _num_subdomains(num_subdomains),
+        _overlap(overlap),
+        _max_size(0),
+        _is_initialized(false),
+        _is_computed(false) {
+    check_arguments();
+    const ordinal_type nrows = _A.numRows();
+    const ordinal_type nsub  = num_subdomains;
+    _rows_per_block = Kokkos::max(ordinal_type(1), (nrows + nsub - 1) / nsub);
+  }
+
+  //! Constructor: parts(i), in [0, num_subdomains), is the subdomain of row
+  //! i before it is grown by overlap levels
+  template <class CRSArg>
+  SchwarzPrec(const CRSArg &A, const PartsView &parts,
+              const int num_subdomains, const int overlap = 1)
+      : _A(A),
+        _num_subdomains(num_subdomains),
+        _overlap(overlap),
+        _parts(parts),
+        _rows_per_block(0),
+        _max_size(0),
+        _is_initialized(false),
+        _is_computed(false) {
+    check_arguments();
+    KK_REQUIRE_MSG(parts.extent(0) == size_t(_A.numRows()),
+                   "SchwarzPrec: parts must have one entry per row");
+  }
+
+  //! Destructor.
+  virtual ~SchwarzPrec() {}
+
+  //! The number of subdomains
+  int getNumSubdomains() const { return _num_subdomains; }
+
+  //! The number of levels of overlap
+  int getOverlap() const { return _overlap; }
+
+  //! The number of rows of the largest subdomain, set by initialize()
+  ordinal_type getMaxSubdomainSize() const { return _max_size; }
+
+  //! The rows of subdomain b, in ascending order, are
+  //! getSubdomainRows()(getSubdomainOffsets()(b) ... (b + 1)), set by
+  //! initialize()
+  OffsetView getSubdomainOffsets() const { return _sub_ptr; }
+  OrdinalView getSubdomainRows() const { return _sub_rows; }
+
+  ///// \brief Apply the preconditioner to X, putting the result in Y.
+  /////
+  ///// \param transM [in] Only "N" is supported.
+  ///// \param alpha [in] Input coefficient of M*x
+  ///// \param beta [in] Input coefficient of Y
+  /////
+  ///// Computes Y = beta Y + alpha sum_b W R_b^T A_b^inv R_b X.
+  //
+  virtual void apply(const Kokkos::View<const ScalarType *, DEVICE> &X,
+                     const Kokkos::View<ScalarType *, DEVICE> &Y,
+                     const char transM[] = "N",
+                     ScalarType alpha    = karith::one(),
+                     ScalarType beta     = karith::zero()) const {
+    using functor_t = KokkosSparse::Impl::SchwarzApplyFunctor<
+        OffsetView, OrdinalView, View3d,
+        Kokkos::View<const ScalarType *, DEVICE>,
+        Kokkos::View<ScalarType *, DEVICE>>;
+
+    KK_REQUIRE_MSG(transM[0] == NoTranspose[0],
+                   "SchwarzPrec::apply only supports 'N' for transM");
+    KK_REQUIRE_MSG(_is_computed, "SchwarzPrec::apply called before compute()");
+
+    Kokkos::parallel_for("KokkosSparse::SchwarzPrec::apply",
+                         Kokkos::RangePolicy<EXSP>(0, _A.numRows()),
+                         functor_t{_sub_ptr, _sub_rows, _mem_ptr, _mem_sub,
+                                   _mem_local, _blocks, X, Y, alpha, beta});
+  }
+  //@}
+
+  //! Set this preconditioner's parameters.
+  void setParameters() {}
+
+  //! Builds the overlapping subdomains from the pattern of A
+  void initialize() {
+    using range_policy = Kokkos::RangePolicy<EXSP>;
+    using count_functor_t =
+        KokkosSparse::Impl::SchwarzCountFunctor<OffsetView, OrdinalView,
+                                                OffsetView>;
+    using membership_functor_t =
+        KokkosSparse::Impl::SchwarzMembershipFunctor<OffsetView, OrdinalView,
+                                                     OffsetView>;
+    using sort_functor_t =
+        KokkosSparse::Impl::SchwarzSortMembershipFunctor<OffsetView,
+                                                         OrdinalView>;
+
+    EXSP exec;
+    const ordinal_type nrows          = _A.numRows();
+    const ordinal_type nsub           = _num_subdomains;
+    const ordinal_type rows_per_block = _rows_per_block;
+    auto parts                        = _parts;
+
+    if (rows_per_block == 0) {
+      ordinal_type num_bad = 0;
+      Kokkos::parallel_reduce(
+          "KokkosSparse::SchwarzPrec::check_parts",
+          range_policy(exec, 0, nrows),
+          KOKKOS_LAMBDA(const ordinal_type i, ordinal_type &bad) {
+            if (parts(i) < 0 || parts(i) >= nsub) bad++;
+          },
+          num_bad);
+      KK_REQUIRE_MSG(num_bad == 0,
+                     "SchwarzPrec: parts must be in [0, num_subdomains)");
+    }
+
+    // Group the rows by part (contiguous blocks when no parts were given);
+    // the sort is stable, so the rows of a part stay in ascending order
+    OrdinalView keys(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "SchwarzPrec::keys"),
+        nrows);
+    OrdinalView order(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "SchwarzPrec::order"),
+        nrows);
+    OffsetView part_ptr("SchwarzPrec::part_ptr", nsub + 1);
+    Kokkos::parallel_for(
+        "KokkosSparse::SchwarzPrec::group", range_policy(exec, 0, nrows),
+        KOKKOS_LAMBDA(const ordinal_type i) {
+          const ordinal_type p =
+              rows_per_block > 0 ? i / rows_per_block : parts(i);
+          keys(i)  = p;
+          order(i) = i;
+          Kokkos::atomic_inc(&part_ptr(p));
+        });
+    KokkosKernels::radixSort(exec, keys, order);
+    KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum<EXSP>(
+        exec, nsub + 1, part_ptr);
+    auto part_ptr_h =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), part_ptr);
+
+    // Grow each part by overlap levels
+    OrdinalView mark(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "SchwarzPrec::mark"),
+        nrows);
+    Kokkos::deep_copy(exec, mark, ordinal_type(-1));
+    std::vector<OrdinalView> rows_v(nsub);
+    typename OffsetView::HostMirror sub_ptr_h("SchwarzPrec::sub_ptr_h",
+                                              nsub + 1);
+    _max_size = 0;
+    for (ordinal_type b = 0; b < nsub; b++) {
+      auto part = Kokkos::subview(
+          order, Kokkos::make_pair(part_ptr_h(b), part_ptr_h(b + 1)));
+      rows_v[b] = KokkosSparse::Impl::kk_grow_rows_crsmatrix(_A, part,
+                                                             _overlap, mark, b);
+      const ordinal_type size = rows_v[b].extent(0);
+      sub_ptr_h(b + 1)        = sub_ptr_h(b) + size;
+      _max_size               = std::max(_max_size, size);
+    }
+    _sub_ptr = OffsetView("SchwarzPrec::sub_ptr", nsub + 1);
+    Kokkos::deep_copy(exec, _sub_ptr, sub_ptr_h);
+    _sub_rows = OrdinalView(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "SchwarzPrec::rows"),
+        sub_ptr_h(nsub));
+    for (ordinal_type b = 0; b < nsub; b++)
+      Kokkos::deep_copy(exec,
+                        Kokkos::subview(_sub_rows,
+                                        Kokkos::make_pair(sub_ptr_h(b),
+                                                          sub_ptr_h(b + 1))),
+                        rows_v[b]);
+
+    // The subdomains of each row, to apply the preconditioner as a gather
+    _mem_ptr = OffsetView("SchwarzPrec::mem_ptr", nrows + 1);
+    Kokkos::parallel_for(
+        "KokkosSparse::SchwarzPrec::count",
+        range_policy(exec, 0, nsub * _max_size),
+        count_functor_t{_sub_ptr, _sub_rows, _mem_ptr, _max_size});
+    KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum<EXSP>(
+        exec, nrows + 1, _mem_ptr);
+    _mem_sub = OrdinalView(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "SchwarzPrec::mem_sub"),
+        sub_ptr_h(nsub));
+    _mem_local = OrdinalView(Kokkos::view_alloc(Kokkos::WithoutInitializing,
+                                                "SchwarzPrec::mem_local"),
+                             sub_ptr_h(nsub));
+    OffsetView cursor("SchwarzPrec::cursor", nrows);
+    Kokkos::parallel_for(
+        "KokkosSparse::SchwarzPrec::membership",
+        range_policy(exec, 0, nsub * _max_size),
+        membership_functor_t{_sub_ptr, _sub_rows, _mem_ptr, cursor, _mem_sub,
+                             _mem_local, _max_size});
+    Kokkos::parallel_for("KokkosSparse::SchwarzPrec::sort_membership",
+                         range_policy(exec, 0, nrows),
+                         sort_functor_t{_mem_ptr, _mem_sub, _mem_local});
+
+    _blocks = View3d("SchwarzPrec::_blocks", nsub, _max_size, _max_size);
+    exec.fence();
+    _is_initialized = true;
+    _is_computed    = false;
+  }
+
+  //! True if the preconditioner has been successfully initialized, else false.
+  bool isInitialized() const { return _is_initialized; }
+
+  //! Extracts the subdomain matrices from the current values of A and
+  //! inverts them
+  void compute() {
+    using extract_functor_t = KokkosSparse::Impl::SchwarzExtractFunctor<
+        typename CRS::row_map_type, typename CRS::index_type,
+        typename CRS::values_type, OffsetView, OrdinalView, View3d>;
+    using invert_functor_t =
+        KokkosSparse::Impl::BlockJacobiInvertFunctor<View3d, View2d>;
+
+    if (!_is_initialized) initialize();
+
+    Kokkos::deep_copy(_blocks, karith::zero());
+    Kokkos::parallel_for(
+        "KokkosSparse::SchwarzPrec::extract",
+        Kokkos::RangePolicy<EXSP>(0, _num_subdomains * _max_size),
+        extract_functor_t{_A.graph.row_map, _A.graph.entries, _A.values,
+                          _sub_ptr, _sub_rows, _blocks, _max_size});
+
+    View2d work(Kokkos::view_alloc(Kokkos::WithoutInitializing,
+                                   "SchwarzPrec::work"),
+                _num_subdomains, _max_size * _max_size);
+    Kokkos::parallel_for("KokkosSparse::SchwarzPrec::invert",
+                         Kokkos::RangePolicy<EXSP>(0, _num_subdomains),
+                         invert_functor_t{_blocks, work});
+    _is_computed = true;
+  }
+
+  //! True if the preconditioner has been successfully computed, else false.
+  bool isComputed() const { return _is_computed; }
+};
+
+}  // namespace Experimental
+}  // End namespace KokkosSparse
+
+#endif
@@ -0,0 +1,244 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file KokkosSparse_SellMatrix.hpp
+/// \brief Local sparse matrix interface
+///
+/// This file provides KokkosSparse::Experimental::SellMatrix.  This
+/// implements a local (no MPI) sparse matrix stored in sliced ELLPACK
+/// ("SELL-C-sigma") format.
+
+#ifndef KOKKOSSPARSE_SELLMATRIX_HPP_
+#define KOKKOSSPARSE_SELLMATRIX_HPP_
+
+#include "Kokkos_Core.hpp"
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include "KokkosKernels_default_types.hpp"
+#include "KokkosKernels_Macros.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+
+/// \class SellMatrix
+/// \brief Sliced ELLPACK (SELL-C-sigma) implementation of a sparse matrix.
+/// \tparam ScalarType The type of entries in the sparse matrix.
+/// \tparam OrdinalType The type of column indices in the sparse matrix.
+/// \tparam Device The Kokkos Device type.
+/// \tparam MemoryTraits Traits describing how Kokkos manages and
+///   accesses data.  The default parameter suffices for most users.
+/// \tparam SizeType The type of chunk offsets.
+///
+/// Rows are sorted by decreasing length within windows of sigma rows, and
+/// consecutive groups of C (the chunk size) sorted rows form a chunk. Each
+/// chunk is padded to the length of its longest row and stored column-major:
+/// entry j of lane l (0 <= l < C) of chunk c is at
+/// <tt>chunk_offsets(c) + j * C + l</tt>. Consecutive lanes thus read
+/// consecutive memory, which gives coalesced loads on GPUs and full vector
+/// lanes on wide-SIMD CPUs for matrices with short rows.
+///
+/// Padding entries have value zero and column index zero. row_lengths holds
+/// the true length of each sorted row, and row_perm maps each sorted row back
+/// to its row in the original matrix.
+///
+/// Use KokkosSparse::Experimental::crs2sell to build a SellMatrix from a
+/// CrsMatrix.
+template <class ScalarType, class OrdinalType, class Device,
+          class MemoryTraits = void,
+          class SizeType     = typename Kokkos::ViewTraits<OrdinalType*, Device,
+                                                       void, void>::size_type>
+class SellMatrix {
+  static_assert(
+      std::is_signed<OrdinalType>::value,
+      "SellMatrix requires that OrdinalType is a signed integer type.");
+
+ public:
+  //! Type of the matrix's execution space.
+  typedef typename Device::execution_space execution_space;
+  //! Type of the matrix's memory space.
+  typedef typename Device::memory_space memory_space;
+  //! Canonical device type
+  typedef Kokkos::Device<execution_space, memory_space> device_type;
+  typedef MemoryTraits memory_traits;
+
+  //! Type of each chunk offset.
+  typedef SizeType size_type;
+  typedef const SizeType const_size_type;
+  typedef typename std::remove_const<SizeType>::type non_const_size_type;
+  //! Type of each value in the matrix.
+  typedef ScalarType value_type;
+  typedef const ScalarType const_value_type;
+  typedef typename std::remove_const<ScalarType>::type non_const_value_type;
+  //! Type of each (column) index in the matrix.
+  typedef OrdinalType ordinal_type;
+  typedef const OrdinalType const_ordinal_type;
+  typedef typename std::remove_const<OrdinalType>::type non_const_ordinal_type;
+
+  //! Type of the padded, chunk-column-major array of values.
+  typedef Kokkos::View<value_type*, Kokkos::LayoutRight, device_type,
+                       MemoryTraits>
+      values_type;
+  //! Type of the padded, chunk-column-major array of column indices.
+  typedef Kokkos::View<ordinal_type*, Kokkos::LayoutRight, device_type,
+                       MemoryTraits>
+      index_type;
+  //! Type of the array of chunk offsets (numChunks() + 1 entries).
+  typedef Kokkos::View<const size_type*, Kokkos::LayoutRight, device_type,
+                       MemoryTraits>
+      chunk_offsets_type;
+  //! Type of the arrays indexed by sorted row (row_perm and row_lengths).
+  typedef Kokkos::View<const ordinal_type*, Kokkos::LayoutRight, device_type,
+                       MemoryTraits>
+      row_array_type;
+
+  //! Largest supported chunk size. This covers the width of GPU warps and
+  //! wavefronts, and of CPU SIMD registers.
+  static constexpr int max_chunk_size = 64;
+
+  /// \name Storage of the actual sparsity structure and values.
+  //@{
+  //! Padded values, chunk by chunk.
+  values_type values;
+  //! Padded column indices, chunk by chunk.
+  index_type entries;
+  //! Offset of the first entry of each chunk in values and entries.
+  chunk_offsets_type chunk_offsets;
+  //! For each sorted row, the row of the original matrix.
+  row_array_type row_perm;
+  //! For each sorted row, the number of (unpadded) entries.
+  row_array_type row_lengths;
+  //@}
+
+ private:
+  ordinal_type numRows_;
+  ordinal_type numCols_;
+  size_type nnz_;
+  int chunkSize_;
+  ordinal_type sigma_;
+
+ public:
+  /// \brief Default constructor; constructs an empty sparse matrix.
+  KOKKOS_INLINE_FUNCTION
+  SellMatrix()
+      : numRows_(0), numCols_(0), nnz_(0), chunkSize_(1), sigma_(1) {}
+
+  // clang-format off
+  /// \brief Constructor that accepts the SELL arrays directly (by view, not by
+  ///   deep copy). Most users should use crs2sell instead.
+  ///
+  /// \param nrows [in] The number of rows.
+  /// \param ncols [in] The number of columns.
+  /// \param annz [in] The number of (unpadded) entries.
+  /// \param chunk_size [in] The number of rows per chunk (C).
+  /// \param sigma [in] The size of the row sorting window.
+  /// \param vals [in] The padded values.
+  /// \param cols [in] The padded column indices.
+  /// \param offsets [in] The chunk offsets.
+  /// \param perm [in] The original row of each sorted row.
+  /// \param lengths [in] The number of entries of each sorted row.
+  // clang-format on
+  SellMatrix(const std::string& /* label */, const OrdinalType nrows,
+             const OrdinalType ncols, const size_type annz,
+             const int chunk_size, const OrdinalType sigma,
+             const values_type& vals, const index_type& cols,
+             const chunk_offsets_type& offsets, const row_array_type& perm,
+             const row_array_type& lengths)
+      : values(vals),
+        entries(cols),
+        chunk_offsets(offsets),
+        row_perm(perm),
+        row_lengths(lengths),
+        numRows_(nrows),
+        numCols_(ncols),
+        nnz_(annz),
+        chunkSize_(chunk_size),
+        sigma_(sigma) {
+    if (chunk_size < 1 || chunk_size > max_chunk_size) {
+      std::ostringstream os;
+      os << "SellMatrix: chunk size " << chunk_size
+         << " must be between 1 and " << max_chunk_size << ".";
+      throw std::invalid_argument(os.str());
+    }
+    if (offsets.extent(0) != size_t(numChunks() + 1)) {
+      std::ostringstream os;
+      os << "SellMatrix: chunk_offsets has " << offsets.extent(0)
+         << " entries, but " << numChunks() + 1 << " are needed.";
+      throw std::invalid_argument(os.str());
+    }
+    if (perm.extent(0) != size_t(nrows) ||
+        lengths.extent(0) != size_t(nrows)) {
+      std::ostringstream os;
+      os << "SellMatrix: row_perm and row_lengths must have nrows = " << nrows
+         << " entries.";
+      throw std::invalid_argument(os.str());
+    }
+    if (vals.extent(0) != cols.extent(0)) {
+      std::ostringstream os;
+      os << "SellMatrix: values and entries must have the same length.";
+      throw std::invalid_argument(os.str());
+    }
+  }
+
+  //! The number of rows in the sparse matrix.
+  KOKKOS_INLINE_FUNCTION ordinal_type numRows() const { return numRows_; }
+
+  //! The number of columns in the sparse matrix.
+  KOKKOS_INLINE_FUNCTION ordinal_type numCols() const { return numCols_; }
+
+  //! The number of "point" (non-block) rows in the matrix.
+  KOKKOS_INLINE_FUNCTION ordinal_type numPointRows() const { return numRows(); }
+
+  //! The number of "point" (non-block) columns in the matrix.
+  KOKKOS_INLINE_FUNCTION ordinal_type numPointCols() const { return numCols(); }
+
+  //! The number of (unpadded) entries in the sparse matrix.
+  KOKKOS_INLINE_FUNCTION size_type nnz() const { return nnz_; }
+
+  //! The number of stored entries, including padding.
+  KOKKOS_INLINE_FUNCTION size_type storageSize() const {
+    return values.extent(0);
+  }
+
+  //! The number of rows per chunk (C).
+  KOKKOS_INLINE_FUNCTION int chunkSize() const { return chunkSize_; }
+
+  //! The size of the window in which rows were sorted by length (sigma).
+  KOKKOS_INLINE_FUNCTION ordinal_type sigma() const { return sigma_; }
+
+  //! The number of chunks.
+  KOKKOS_INLINE_FUNCTION ordinal_type numChunks() const {
+    return (numRows_ + chunkSize_ - 1) / chunkSize_;
+  }
+};
+
+/// \class is_sell_matrix
+/// \brief is_sell_matrix<T>::value is true if T is a SellMatrix<...>, false
+/// otherwise
+template <typename>
+struct is_sell_matrix : public std::false_type {};
+template <typename... P>
+struct is_sell_matrix<SellMatrix<P...>> : public std::true_type {};
+template <typename... P>
+struct is_sell_matrix<const SellMatrix<P...>> : public std::true_type {};
+
+/// \brief Equivalent to is_sell_matrix<T>::value.
+template <typename T>
+inline constexpr bool is_sell_matrix_v = is_sell_matrix<T>::value;
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+#endif
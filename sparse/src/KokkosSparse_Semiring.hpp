@@ -0,0 +1,119 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file KokkosSparse_Semiring.hpp
+/// \brief Semirings for the semiring sparse kernels (spmv_semiring and the
+///   semiring SpGEMM): the sum of the products becomes the semiring's add
+///   of its multiplies, as in GraphBLAS.
+
+#ifndef KOKKOSSPARSE_SEMIRING_HPP_
+#define KOKKOSSPARSE_SEMIRING_HPP_
+
+#include <Kokkos_Core.hpp>
+#include "Kokkos_ArithTraits.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+
+// A semiring is a class with a value_type and three static functions:
+//  - zero(): the identity of add, the value of an empty sum;
+//  - add(a, b): associative and commutative;
+//  - multiply(a, b).
+// Any class of this form can be passed to the semiring kernels.
+
+/// \brief The usual arithmetic: plus and times.
+template <typename T>
+struct PlusTimesSemiring {
+  using value_type = T;
+  KOKKOS_INLINE_FUNCTION static T zero() {
+    return Kokkos::ArithTraits<T>::zero();
+  }
+  KOKKOS_INLINE_FUNCTION static T add(const T& a, const T& b) { return a + b; }
+  KOKKOS_INLINE_FUNCTION static T multiply(const T& a, const T& b) {
+    return a * b;
+  }
+};
+
+/// \brief Tropical min-plus semiring, for shortest paths: add is min and
+///   multiply is plus. Its zero, the largest value of T, stands for "no
+///   path" and absorbs multiply, so that it does not overflow.
+template <typename T>
+struct MinPlusSemiring {
+  using value_type = T;
+  KOKKOS_INLINE_FUNCTION static T zero() {
+    return Kokkos::reduction_identity<T>::min();
+  }
+  KOKKOS_INLINE_FUNCTION static T add(const T& a, const T& b) {
+    return b < a ? b : a;
+  }
+  KOKKOS_INLINE_FUNCTION static T multiply(const T& a, const T& b) {
+    return (a == zero() || b == zero()) ? zero() : a + b;
+  }
+};
+
+/// \brief Max-plus semiring, for longest (critical) paths: add is max and
+///   multiply is plus. Its zero, the lowest value of T, absorbs multiply.
+template <typename T>
+struct MaxPlusSemiring {
+  using value_type = T;
+  KOKKOS_INLINE_FUNCTION static T zero() {
+    return Kokkos::reduction_identity<T>::max();
+  }
+  KOKKOS_INLINE_FUNCTION static T add(const T& a, const T& b) {
+    return a < b ? b : a;
+  }
+  KOKKOS_INLINE_FUNCTION static T multiply(const T& a, const T& b) {
+    return (a == zero() || b == zero()) ? zero() : a + b;
+  }
+};
+
+/// \brief Max-times semiring over non-negative values, for the most
+///   reliable path: add is max and multiply is times.
+template <typename T>
+struct MaxTimesSemiring {
+  using value_type = T;
+  KOKKOS_INLINE_FUNCTION static T zero() {
+    return Kokkos::ArithTraits<T>::zero();
+  }
+  KOKKOS_INLINE_FUNCTION static T add(const T& a, const T& b) {
+    return a < b ? b : a;
+  }
+  KOKKOS_INLINE_FUNCTION static T multiply(const T& a, const T& b) {
+    return a * b;
+  }
+};
+
+/// \brief Boolean semiring, for reachability (BFS frontiers, connected
+///   components): add is or and multiply is and, where any nonzero value
+///   is true. Results are 0 or 1.
+template <typename T>
+struct OrAndSemiring {
+  using value_type = T;
+  KOKKOS_INLINE_FUNCTION static T zero() {
+    return Kokkos::ArithTraits<T>::zero();
+  }
+  KOKKOS_INLINE_FUNCTION static T add(const T& a, const T& b) {
+    return (a != zero() || b != zero()) ? T(1) : zero();
+  }
+  KOKKOS_INLINE_FUNCTION static T multiply(const T& a, const T& b) {
+    return (a != zero() && b != zero()) ? T(1) : zero();
+  }
+};
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SEMIRING_HPP_
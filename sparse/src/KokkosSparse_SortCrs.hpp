@@ -16,7 +16,9 @@
 #ifndef _KOKKOSSPARSE_SORTCRS_HPP
 #define _KOKKOSSPARSE_SORTCRS_HPP
 
+#include <algorithm>
 #include "Kokkos_Core.hpp"
+#include "Kokkos_Sort.hpp"
 #include "KokkosKernels_Sorting.hpp"
 
 namespace KokkosSparse {
@@ -352,8 +354,252 @@ struct sort_bsr_functor {
   }
 };
 
+// Segmented sort of the rows of a CRS matrix (or graph, if values is empty):
+// the rows are binned by length, and each bin is sorted with the level of
+// parallelism that fits it. Short rows are insertion sorted by one thread
+// each, so a warp sorts 32 of them at once. Medium rows are bitonic sorted by
+// a team. Long rows (with power-law degrees, one of them can hold most of the
+// entries) are sorted one at a time by the whole device, with a bin sort.
+template <typename execution_space, typename rowmap_t, typename entries_t,
+          typename values_t>
+struct SegmentedSortCrs {
+  using size_type = typename rowmap_t::non_const_value_type;
+  using lno_t     = typename entries_t::non_const_value_type;
+  using scalar_t  = typename values_t::non_const_value_type;
+  using range_pol = Kokkos::RangePolicy<execution_space>;
+  using team_pol  = Kokkos::TeamPolicy<execution_space>;
+  using team_mem  = typename team_pol::member_type;
+  using rows_t    = Kokkos::View<lno_t*, typename entries_t::device_type>;
+
+  enum Bin { ShortBin, MediumBin, LongBin };
+
+  // rows of at most shortRowMax entries are sorted by one thread, and rows of
+  // more than longRowMin entries by the whole device
+  static constexpr size_type shortRowMax = 32;
+  static constexpr size_type longRowMin  = 1 << 16;
+
+  KOKKOS_INLINE_FUNCTION static Bin row_bin(size_type len) {
+    if (len <= shortRowMax) return ShortBin;
+    if (len <= longRowMin) return MediumBin;
+    return LongBin;
+  }
+
+  // List the rows of one bin in binRows, from offset
+  struct BinRowsFunctor {
+    BinRowsFunctor(const rowmap_t& rowmap_, const rows_t& binRows_, Bin bin_,
+                   size_type offset_)
+        : rowmap(rowmap_), binRows(binRows_), bin(bin_), offset(offset_) {}
+
+    KOKKOS_INLINE_FUNCTION void operator()(lno_t row, size_type& lcount,
+                                           bool final) const {
+      if (row_bin(rowmap(row + 1) - rowmap(row)) != bin) return;
+      if (final) binRows(offset + lcount) = row;
+      lcount++;
+    }
+
+    rowmap_t rowmap;
+    rows_t binRows;
+    Bin bin;
+    size_type offset;
+  };
+
+  struct RowLengthsFunctor {
+    RowLengthsFunctor(const rowmap_t& rowmap_, const rows_t& binRows_)
+        : rowmap(rowmap_), binRows(binRows_) {}
+
+    KOKKOS_INLINE_FUNCTION void operator()(size_type i,
+                                           size_type& lsum) const {
+      lno_t row = binRows(i);
+      lsum += rowmap(row + 1) - rowmap(row);
+    }
+
+    rowmap_t rowmap;
+    rows_t binRows;
+  };
+
+  struct SortRowsFunctor {
+    SortRowsFunctor(const rowmap_t& rowmap_, const entries_t& entries_,
+                    const values_t& values_, const rows_t& binRows_,
+                    size_type offset_)
+        : rowmap(rowmap_),
+          entries(entries_),
+          values(values_),
+          binRows(binRows_),
+          offset(offset_) {}
+
+    // Short rows: insertion sort by one thread
+    KOKKOS_INLINE_FUNCTION void operator()(const size_type i) const {
+      lno_t row         = binRows(offset + i);
+      size_type begin   = rowmap(row);
+      size_type end     = rowmap(row + 1);
+      const bool useVal = values.extent(0);
+      for (size_type j = begin + 1; j < end; j++) {
+        lno_t col    = entries(j);
+        scalar_t val = useVal ? values(j) : scalar_t();
+        size_type k  = j;
+        for (; k > begin && entries(k - 1) > col; k--) {
+          entries(k) = entries(k - 1);
+          if (useVal) values(k) = values(k - 1);
+        }
+        entries(k) = col;
+        if (useVal) values(k) = val;
+      }
+    }
+
+    // Medium rows: bitonic sort by a team
+    KOKKOS_INLINE_FUNCTION void operator()(const team_mem t) const {
+      lno_t row       = binRows(offset + t.league_rank());
+      size_type begin = rowmap(row);
+      lno_t len       = rowmap(row + 1) - begin;
+      if (values.extent(0)) {
+        KokkosKernels::TeamBitonicSort2<lno_t, lno_t, scalar_t, team_mem>(
+            entries.data() + begin, values.data() + begin, len, t);
+      } else {
+        KokkosKernels::TeamBitonicSort<lno_t, lno_t, team_mem>(
+            entries.data() + begin, len, t);
+      }
+    }
+
+    rowmap_t rowmap;
+    entries_t entries;
+    values_t values;
+    rows_t binRows;
+    size_type offset;
+  };
+
+  template <typename keys_t>
+  struct KeyRangeFunctor {
+    using minmax_t = typename Kokkos::MinMax<lno_t>::value_type;
+
+    KeyRangeFunctor(const keys_t& keys_) : keys(keys_) {}
+
+    KOKKOS_INLINE_FUNCTION void operator()(size_type i,
+                                           minmax_t& lrange) const {
+      if (keys(i) < lrange.min_val) lrange.min_val = keys(i);
+      if (keys(i) > lrange.max_val) lrange.max_val = keys(i);
+    }
+
+    keys_t keys;
+  };
+
+  // Long row: device-wide bin sort, with about one column per bin
+  static void sort_long_row(const execution_space& exec,
+                            const entries_t& entries, const values_t& values,
+                            size_type begin, size_type end) {
+    auto range = Kokkos::make_pair(begin, end);
+    auto keys  = Kokkos::subview(entries, range);
+    using keys_t  = decltype(keys);
+    using binop_t = Kokkos::BinOp1D<keys_t>;
+    typename Kokkos::MinMax<lno_t>::value_type keyRange;
+    Kokkos::parallel_reduce(
+        "KokkosSparse::SegmentedSort::KeyRange",
+        range_pol(exec, 0, end - begin), KeyRangeFunctor<keys_t>(keys),
+        Kokkos::MinMax<lno_t>(keyRange));
+    // all columns are equal: nothing to sort
+    if (keyRange.min_val == keyRange.max_val) return;
+    size_type numBins = std::min<size_type>(
+        end - begin, size_type(keyRange.max_val - keyRange.min_val) + 1);
+    Kokkos::BinSort<keys_t, binop_t> binSort(
+        exec, keys, binop_t(numBins, keyRange.min_val, keyRange.max_val),
+        true);
+    binSort.create_permute_vector(exec);
+    if (values.extent(0)) binSort.sort(exec, Kokkos::subview(values, range));
+    binSort.sort(exec, keys);
+  }
+
+  static void sort(const execution_space& exec, const rowmap_t& rowmap,
+                   const entries_t& entries, const values_t& values) {
+    lno_t numRows = rowmap.extent(0) ? rowmap.extent(0) - 1 : 0;
+    if (numRows == 0) return;
+    rows_t binRows(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing,
+                                      "Segmented sort rows"),
+                   numRows);
+    // bin boundaries in binRows
+    size_type binBegin[4] = {0, 0, 0, 0};
+    for (int bin = ShortBin; bin <= LongBin; bin++) {
+      size_type count = 0;
+      Kokkos::parallel_scan(
+          "KokkosSparse::SegmentedSort::BinRows", range_pol(exec, 0, numRows),
+          BinRowsFunctor(rowmap, binRows, Bin(bin), binBegin[bin]), count);
+      binBegin[bin + 1] = binBegin[bin] + count;
+    }
+    size_type numShort  = binBegin[MediumBin] - binBegin[ShortBin];
+    size_type numMedium = binBegin[LongBin] - binBegin[MediumBin];
+    size_type numLong   = binBegin[LongBin + 1] - binBegin[LongBin];
+    if (numShort) {
+      Kokkos::parallel_for(
+          "KokkosSparse::SegmentedSort::ShortRows",
+          range_pol(exec, 0, numShort),
+          SortRowsFunctor(rowmap, entries, values, binRows, 0));
+    }
+    if (numMedium) {
+      SortRowsFunctor funct(rowmap, entries, values, binRows,
+                            binBegin[MediumBin]);
+      // Largest power of 2 team size not greater than half the average length
+      // of the medium rows, which is the parallelism of bitonic sort
+      size_type mediumEntries = 0;
+      Kokkos::parallel_reduce(
+          "KokkosSparse::SegmentedSort::MediumLengths",
+          range_pol(exec, binBegin[MediumBin], binBegin[LongBin]),
+          RowLengthsFunctor(rowmap, binRows), mediumEntries);
+      lno_t avgLength     = mediumEntries / numMedium;
+      lno_t idealTeamSize = 1;
+      while (idealTeamSize < avgLength / 2) idealTeamSize *= 2;
+      team_pol temp(exec, numMedium, 1);
+      lno_t maxTeamSize = temp.team_size_max(funct, Kokkos::ParallelForTag());
+      Kokkos::parallel_for(
+          "KokkosSparse::SegmentedSort::MediumRows",
+          team_pol(exec, numMedium, std::min(idealTeamSize, maxTeamSize)),
+          funct);
+    }
+    if (numLong) {
+      auto longRows = Kokkos::create_mirror_view_and_copy(
+          Kokkos::HostSpace(),
+          Kokkos::subview(binRows, Kokkos::make_pair(binBegin[LongBin],
+                                                     binBegin[LongBin + 1])));
+      for (size_type i = 0; i < numLong; i++) {
+        size_type begin = 0, end = 0;
+        Kokkos::deep_copy(begin, Kokkos::subview(rowmap, longRows(i)));
+        Kokkos::deep_copy(end, Kokkos::subview(rowmap, longRows(i) + 1));
+        sort_long_row(exec, entries, values, begin, end);
+      }
+    }
+  }
+};
+
 }  // namespace Impl
 
+// Segmented sort of a CRS matrix: like sort_crs_matrix, but the rows are
+// binned by length, and sorted by a thread (up to 32 entries), a team, or the
+// whole device (more than 65536 entries). This is what sort_crs_matrix uses
+// on GPUs.
+template <typename execution_space, typename rowmap_t, typename entries_t,
+          typename values_t>
+void segmented_sort_crs_matrix(const execution_space& exec,
+                               const rowmap_t& rowmap, const entries_t& entries,
+                               const values_t& values) {
+  static_assert(
+      !std::is_const_v<typename entries_t::value_type>,
+      "segmented_sort_crs_matrix: entries_t must not be const-valued");
+  static_assert(!std::is_const_v<typename values_t::value_type>,
+                "segmented_sort_crs_matrix: value_t must not be const-valued");
+  Impl::SegmentedSortCrs<execution_space, rowmap_t, entries_t, values_t>::sort(
+      exec, rowmap, entries, values);
+}
+
+// Segmented sort of a CRS graph, like segmented_sort_crs_matrix.
+template <typename execution_space, typename rowmap_t, typename entries_t>
+void segmented_sort_crs_graph(const execution_space& exec,
+                              const rowmap_t& rowmap,
+                              const entries_t& entries) {
+  static_assert(!std::is_const_v<typename entries_t::value_type>,
+                "segmented_sort_crs_graph: entries_t must not be const-valued");
+  using no_values_t = Kokkos::View<int*, typename entries_t::device_type>;
+  Impl::SegmentedSortCrs<execution_space, rowmap_t, entries_t,
+                         no_values_t>::sort(exec, rowmap, entries,
+                                            no_values_t());
+}
+
 // Sort a CRS matrix: within each row, sort entries ascending by column.
 // At the same time, permute the values.
 template <typename execution_space, typename rowmap_t, typename entries_t,
@@ -379,32 +625,20 @@ void sort_crs_matrix(const execution_space& exec, const rowmap_t& rowmap,
                 "sort_crs_matrix: entries_t must not be const-valued");
   static_assert(!std::is_const_v<typename values_t::value_type>,
                 "sort_crs_matrix: value_t must not be const-valued");
-  using lno_t    = typename entries_t::non_const_value_type;
-  using team_pol = Kokkos::TeamPolicy<execution_space>;
+  using lno_t   = typename entries_t::non_const_value_type;
   bool useRadix = !KokkosKernels::Impl::kk_is_gpu_exec_space<execution_space>();
   lno_t numRows = rowmap.extent(0) ? rowmap.extent(0) - 1 : 0;
   if (numRows == 0) return;
-  Impl::SortCrsMatrixFunctor<execution_space, rowmap_t, entries_t, values_t>
-      funct(useRadix, rowmap, entries, values);
   if (useRadix) {
+    Impl::SortCrsMatrixFunctor<execution_space, rowmap_t, entries_t, values_t>
+        funct(useRadix, rowmap, entries, values);
     Kokkos::parallel_for("sort_crs_matrix",
                          Kokkos::RangePolicy<execution_space>(exec, 0, numRows),
                          funct);
   } else {
-    // Try to get teamsize to be largest power of 2 not greater than avg entries
-    // per row
-    // TODO (probably important for performnce): add thread-level sort also, and
-    // use that for small avg degree. But this works for now.
-    lno_t idealTeamSize = 1;
-    lno_t avgDeg        = (entries.extent(0) + numRows - 1) / numRows;
-    while (idealTeamSize < avgDeg / 2) {
-      idealTeamSize *= 2;
-    }
-    team_pol temp(exec, numRows, 1);
-    lno_t maxTeamSize = temp.team_size_max(funct, Kokkos::ParallelForTag());
-    lno_t teamSize    = std::min(idealTeamSize, maxTeamSize);
-    Kokkos::parallel_for("sort_crs_matrix", team_pol(exec, numRows, teamSize),
-                         funct);
+    // Rows of very different lengths (power-law graphs, SpGEMM outputs) don't
+    // fit a single team size: sort them by bins of row lengths
+    segmented_sort_crs_matrix(exec, rowmap, entries, values);
   }
 }
 
@@ -486,8 +720,7 @@ void sort_bsr_matrix(const bsrMat_t& A) {
 template <typename execution_space, typename rowmap_t, typename entries_t>
 void sort_crs_graph(const execution_space& exec, const rowmap_t& rowmap,
                     const entries_t& entries) {
-  using lno_t    = typename entries_t::non_const_value_type;
-  using team_pol = Kokkos::TeamPolicy<execution_space>;
+  using lno_t = typename entries_t::non_const_value_type;
   static_assert(
       Kokkos::SpaceAccessibility<execution_space,
                                  typename rowmap_t::memory_space>::accessible,
@@ -503,28 +736,14 @@ void sort_crs_graph(const execution_space& exec, const rowmap_t& rowmap,
   bool useRadix = !KokkosKernels::Impl::kk_is_gpu_exec_space<execution_space>();
   lno_t numRows = rowmap.extent(0) ? rowmap.extent(0) - 1 : 0;
   if (numRows == 0) return;
-  Impl::SortCrsGraphFunctor<execution_space, rowmap_t, entries_t> funct(
-      useRadix, rowmap, entries);
   if (useRadix) {
+    Impl::SortCrsGraphFunctor<execution_space, rowmap_t, entries_t> funct(
+        useRadix, rowmap, entries);
     Kokkos::parallel_for("sort_crs_graph",
                          Kokkos::RangePolicy<execution_space>(exec, 0, numRows),
                          funct);
   } else {
-    // Try to get teamsize to be largest power of 2 less than or equal to
-    // half the entries per row. 0.5 * #entries is bitonic's parallelism within
-    // a row.
-    // TODO (probably important for performnce): add thread-level sort also, and
-    // use that for small avg degree. But this works for now.
-    lno_t idealTeamSize = 1;
-    lno_t avgDeg        = (entries.extent(0) + numRows - 1) / numRows;
-    while (idealTeamSize < avgDeg / 2) {
-      idealTeamSize *= 2;
-    }
-    team_pol temp(exec, numRows, 1);
-    lno_t maxTeamSize = temp.team_size_max(funct, Kokkos::ParallelForTag());
-    lno_t teamSize    = std::min(idealTeamSize, maxTeamSize);
-    Kokkos::parallel_for("sort_crs_graph", team_pol(exec, numRows, teamSize),
-                         funct);
+    segmented_sort_crs_graph(exec, rowmap, entries);
   }
 }
 
@@ -0,0 +1,281 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file KokkosSparse_StencilMatrix.hpp
+/// \brief Local sparse matrix interface
+///
+/// This file provides KokkosSparse::Experimental::StencilMatrix.  This
+/// implements a local (no MPI) sparse matrix defined by a stencil on a
+/// structured grid, stored without column indices.
+
+#ifndef KOKKOSSPARSE_STENCILMATRIX_HPP_
+#define KOKKOSSPARSE_STENCILMATRIX_HPP_
+
+#include "Kokkos_Core.hpp"
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include "KokkosKernels_default_types.hpp"
+#include "KokkosKernels_Macros.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+
+/// \class StencilMatrix
+/// \brief Sparse matrix of a stencil operator on a structured grid.
+/// \tparam ScalarType The type of entries in the sparse matrix.
+/// \tparam OrdinalType The type of row (grid point) indices.
+/// \tparam Device The Kokkos Device type.
+/// \tparam MemoryTraits Traits describing how Kokkos manages and
+///   accesses data.  The default parameter suffices for most users.
+/// \tparam SizeType The type used to count entries.
+///
+/// The grid has ni x nj x nk points (nj = nk = 1 for 1D, nk = 1 for 2D),
+/// numbered with i fastest: row r = i + ni * (j + nj * k). Row r couples
+/// point (i, j, k) with the points (i + di, j + dj, k + dk) for each stencil
+/// offset p, where (di, dj, dk) = (offsets(p, 0), offsets(p, 1),
+/// offsets(p, 2)). Neighbors outside the grid are dropped, so the matrix
+/// stores no column indices at all.
+///
+/// values(r, p) is the coefficient of offset p in row r. If values has a
+/// single row, the same coefficients are used for every row (a constant
+/// coefficient operator, e.g. an anisotropic Laplacian), and the matrix
+/// stores only numStencilPoints() values.
+///
+/// Use KokkosSparse::Experimental::stencil_offsets for the standard 3, 5, 9,
+/// 7, 19 and 27 point stencils, or fill offsets with any other pattern.
+template <class ScalarType, class OrdinalType, class Device,
+          class MemoryTraits = void,
+          class SizeType     = typename Kokkos::ViewTraits<OrdinalType*, Device,
+                                                       void, void>::size_type>
+class StencilMatrix {
+  static_assert(
+      std::is_signed<OrdinalType>::value,
+      "StencilMatrix requires that OrdinalType is a signed integer type.");
+
+ public:
+  //! Type of the matrix's execution space.
+  typedef typename Device::execution_space execution_space;
+  //! Type of the matrix's memory space.
+  typedef typename Device::memory_space memory_space;
+  //! Canonical device type
+  typedef Kokkos::Device<execution_space, memory_space> device_type;
+  typedef MemoryTraits memory_traits;
+
+  //! Type used to count entries.
+  typedef SizeType size_type;
+  typedef const SizeType const_size_type;
+  typedef typename std::remove_const<SizeType>::type non_const_size_type;
+  //! Type of each value in the matrix.
+  typedef ScalarType value_type;
+  typedef const ScalarType const_value_type;
+  typedef typename std::remove_const<ScalarType>::type non_const_value_type;
+  //! Type of each row (grid point) index.
+  typedef OrdinalType ordinal_type;
+  typedef const OrdinalType const_ordinal_type;
+  typedef typename std::remove_const<OrdinalType>::type non_const_ordinal_type;
+
+  //! Type of the coefficients (one column per stencil offset).
+  typedef Kokkos::View<value_type**, Kokkos::LayoutLeft, device_type,
+                       MemoryTraits>
+      values_type;
+  //! Type of the stencil offsets (one row of (di, dj, dk) per offset).
+  typedef Kokkos::View<const int**, Kokkos::LayoutRight, device_type>
+      offsets_type;
+
+  /// \name Storage of the stencil and its coefficients.
+  //@{
+  //! Coefficients, numRows() x numStencilPoints() or 1 x numStencilPoints().
+  values_type values;
+  //! Stencil offsets, numStencilPoints() x 3.
+  offsets_type offsets;
+  //@}
+
+ private:
+  ordinal_type extents_[3] = {0, 0, 0};
+  int offsetMin_[3]        = {0, 0, 0};
+  int offsetMax_[3]        = {0, 0, 0};
+  size_type nnz_           = 0;
+
+ public:
+  /// \brief Default constructor; constructs an empty sparse matrix.
+  KOKKOS_INLINE_FUNCTION
+  StencilMatrix() {}
+
+  // clang-format off
+  /// \brief Constructor that accepts the stencil and coefficients directly
+  ///   (by view, not by deep copy).
+  ///
+  /// \param ni [in] Number of grid points in the i (fastest) direction.
+  /// \param nj [in] Number of grid points in the j direction (1 in 1D).
+  /// \param nk [in] Number of grid points in the k direction (1 in 1D and 2D).
+  /// \param offs [in] The stencil offsets, one row of (di, dj, dk) per point.
+  /// \param vals [in] The coefficients, with one column per stencil offset and
+  ///   either ni * nj * nk rows or a single row (constant coefficients).
+  // clang-format on
+  StencilMatrix(const std::string& /* label */, const OrdinalType ni,
+                const OrdinalType nj, const OrdinalType nk,
+                const offsets_type& offs, const values_type& vals)
+      : values(vals), offsets(offs), extents_{ni, nj, nk} {
+    if (ni < 0 || nj < 0 || nk < 0) {
+      std::ostringstream os;
+      os << "StencilMatrix: grid extents must be non-negative (" << ni << " x "
+         << nj << " x " << nk << ").";
+      throw std::invalid_argument(os.str());
+    }
+    if (offs.extent(1) != 3) {
+      std::ostringstream os;
+      os << "StencilMatrix: offsets must have 3 columns (di, dj, dk), not "
+         << offs.extent(1) << ".";
+      throw std::invalid_argument(os.str());
+    }
+    const size_t numRows = size_t(ni) * nj * nk;
+    if (vals.extent(1) != offs.extent(0) ||
+        (vals.extent(0) != numRows && vals.extent(0) != 1)) {
+      std::ostringstream os;
+      os << "StencilMatrix: values must be " << numRows << " x "
+         << offs.extent(0) << " or 1 x " << offs.extent(0) << ", not "
+         << vals.extent(0) << " x " << vals.extent(1) << ".";
+      throw std::invalid_argument(os.str());
+    }
+    // Range of the offsets in each direction, and the number of neighbors
+    // that fall inside the grid
+    auto offs_h =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), offs);
+    for (size_t p = 0; p < offs_h.extent(0); p++) {
+      size_type count = 1;
+      for (int d = 0; d < 3; d++) {
+        const int o   = offs_h(p, d);
+        offsetMin_[d] = o < offsetMin_[d] ? o : offsetMin_[d];
+        offsetMax_[d] = o > offsetMax_[d] ? o : offsetMax_[d];
+        const ordinal_type a = o < 0 ? -o : o;
+        count *= a < extents_[d] ? size_type(extents_[d] - a) : size_type(0);
+      }
+      nnz_ += count;
+    }
+  }
+
+  //! The number of rows in the sparse matrix (grid points).
+  KOKKOS_INLINE_FUNCTION ordinal_type numRows() const {
+    return extents_[0] * extents_[1] * extents_[2];
+  }
+
+  //! The number of columns in the sparse matrix (grid points).
+  KOKKOS_INLINE_FUNCTION ordinal_type numCols() const { return numRows(); }
+
+  //! The number of "point" (non-block) rows in the matrix.
+  KOKKOS_INLINE_FUNCTION ordinal_type numPointRows() const { return numRows(); }
+
+  //! The number of "point" (non-block) columns in the matrix.
+  KOKKOS_INLINE_FUNCTION ordinal_type numPointCols() const { return numCols(); }
+
+  //! The number of entries of the equivalent CrsMatrix (neighbors in the
+  //! grid, including explicit zero coefficients).
+  KOKKOS_INLINE_FUNCTION size_type nnz() const { return nnz_; }
+
+  //! The number of offsets in the stencil.
+  KOKKOS_INLINE_FUNCTION int numStencilPoints() const {
+    return offsets.extent(0);
+  }
+
+  //! Whether all rows share the same coefficients.
+  KOKKOS_INLINE_FUNCTION bool isConstantCoefficient() const {
+    return values.extent(0) == 1 && numRows() != 1;
+  }
+
+  //! The number of grid points in direction d (0, 1 or 2).
+  KOKKOS_INLINE_FUNCTION ordinal_type gridExtent(const int d) const {
+    return extents_[d];
+  }
+
+  //! The smallest offset in direction d (never positive).
+  KOKKOS_INLINE_FUNCTION int offsetMin(const int d) const {
+    return offsetMin_[d];
+  }
+
+  //! The largest offset in direction d (never negative).
+  KOKKOS_INLINE_FUNCTION int offsetMax(const int d) const {
+    return offsetMax_[d];
+  }
+};
+
+/// \brief Offsets of a standard stencil, for use with StencilMatrix.
+///
+/// 3 points: 1D second order. 5 and 9 points: 2D (faces, and faces plus
+/// corners). 7, 19 and 27 points: 3D (faces, faces plus edges, and the full
+/// cube). The offsets are ordered with di fastest, then dj, then dk, so the
+/// center is in the middle.
+///
+/// \tparam DeviceType The device of the returned View.
+/// \param numPoints [in] 3, 5, 7, 9, 19 or 27.
+template <class DeviceType>
+Kokkos::View<int**, Kokkos::LayoutRight, DeviceType> stencil_offsets(
+    const int numPoints) {
+  // Number of dimensions, and the number of nonzero components an offset
+  // can have
+  int dims = 0, maxNonzeros = 0;
+  switch (numPoints) {
+    case 3: dims = 1; maxNonzeros = 1; break;
+    case 5: dims = 2; maxNonzeros = 1; break;
+    case 9: dims = 2; maxNonzeros = 2; break;
+    case 7: dims = 3; maxNonzeros = 1; break;
+    case 19: dims = 3; maxNonzeros = 2; break;
+    case 27: dims = 3; maxNonzeros = 3; break;
+    default: {
+      std::ostringstream os;
+      os << "stencil_offsets: no standard stencil with " << numPoints
+         << " points (use 3, 5, 7, 9, 19 or 27).";
+      throw std::invalid_argument(os.str());
+    }
+  }
+  const int rj = dims > 1 ? 1 : 0;
+  const int rk = dims > 2 ? 1 : 0;
+  Kokkos::View<int**, Kokkos::LayoutRight, DeviceType> offs(
+      "stencil offsets", numPoints, 3);
+  auto offs_h = Kokkos::create_mirror_view(offs);
+  int p       = 0;
+  for (int dk = -rk; dk <= rk; dk++) {
+    for (int dj = -rj; dj <= rj; dj++) {
+      for (int di = -1; di <= 1; di++) {
+        if ((di != 0) + (dj != 0) + (dk != 0) > maxNonzeros) continue;
+        offs_h(p, 0) = di;
+        offs_h(p, 1) = dj;
+        offs_h(p, 2) = dk;
+        p++;
+      }
+    }
+  }
+  Kokkos::deep_copy(offs, offs_h);
+  return offs;
+}
+
+/// \class is_stencil_matrix
+/// \brief is_stencil_matrix<T>::value is true if T is a StencilMatrix<...>,
+/// false otherwise
+template <typename>
+struct is_stencil_matrix : public std::false_type {};
+template <typename... P>
+struct is_stencil_matrix<StencilMatrix<P...>> : public std::true_type {};
+template <typename... P>
+struct is_stencil_matrix<const StencilMatrix<P...>> : public std::true_type {};
+
+/// \brief Equivalent to is_stencil_matrix<T>::value.
+template <typename T>
+inline constexpr bool is_stencil_matrix_v = is_stencil_matrix<T>::value;
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+#endif
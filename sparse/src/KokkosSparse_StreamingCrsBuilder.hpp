@@ -0,0 +1,296 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef _KOKKOSSPARSE_STREAMINGCRSBUILDER_HPP
+#define _KOKKOSSPARSE_STREAMINGCRSBUILDER_HPP
+
+#include "Kokkos_Core.hpp"
+#include "KokkosKernels_Utils.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_SortCrs.hpp"
+#include <stdexcept>
+#include <string>
+
+namespace KokkosSparse {
+namespace Impl {
+
+// Count the entries of a batch per row, in rowCounts(row), and count the
+// entries out of bounds
+template <typename rows_t, typename cols_t, typename counts_t>
+struct StreamingCountFunctor {
+  using size_type = typename counts_t::non_const_value_type;
+
+  StreamingCountFunctor(const rows_t& rows_, const cols_t& cols_,
+                        const counts_t& rowCounts_, int64_t numRows_,
+                        int64_t numCols_)
+      : rows(rows_),
+        cols(cols_),
+        rowCounts(rowCounts_),
+        numRows(numRows_),
+        numCols(numCols_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(size_t i, size_t& lerrors) const {
+    int64_t row = rows(i), col = cols(i);
+    if (row < 0 || row >= numRows || col < 0 || col >= numCols) {
+      lerrors++;
+      return;
+    }
+    Kokkos::atomic_inc(&rowCounts(row));
+  }
+
+  rows_t rows;
+  cols_t cols;
+  counts_t rowCounts;
+  int64_t numRows;
+  int64_t numCols;
+};
+
+// Place the entries of a batch at the cursors of their rows, and count the
+// entries found out of bounds or beyond the counts of their rows
+template <typename rows_t, typename cols_t, typename vals_t,
+          typename rowmap_t, typename entries_t, typename values_t>
+struct StreamingFillFunctor {
+  using size_type = typename rowmap_t::non_const_value_type;
+
+  StreamingFillFunctor(const rows_t& rows_, const cols_t& cols_,
+                       const vals_t& vals_, const rowmap_t& rowmap_,
+                       const rowmap_t& cursors_, const entries_t& entries_,
+                       const values_t& values_, int64_t numCols_)
+      : rows(rows_),
+        cols(cols_),
+        vals(vals_),
+        rowmap(rowmap_),
+        cursors(cursors_),
+        entries(entries_),
+        values(values_),
+        numRows(cursors_.extent(0)),
+        numCols(numCols_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(size_t i, size_t& lerrors) const {
+    int64_t row = rows(i), col = cols(i);
+    if (row < 0 || row >= numRows || col < 0 || col >= numCols) {
+      lerrors++;
+      return;
+    }
+    size_type pos = Kokkos::atomic_fetch_add(&cursors(row), size_type(1));
+    if (pos >= rowmap(row + 1)) {
+      lerrors++;
+      return;
+    }
+    entries(pos) = col;
+    values(pos)  = vals(i);
+  }
+
+  rows_t rows;
+  cols_t cols;
+  vals_t vals;
+  rowmap_t rowmap;
+  rowmap_t cursors;
+  entries_t entries;
+  values_t values;
+  int64_t numRows;
+  int64_t numCols;
+};
+
+// Count the rows whose cursor didn't reach the end of the row
+template <typename rowmap_t>
+struct StreamingIncompleteRowsFunctor {
+  StreamingIncompleteRowsFunctor(const rowmap_t& rowmap_,
+                                 const rowmap_t& cursors_)
+      : rowmap(rowmap_), cursors(cursors_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(size_t row, size_t& lcount) const {
+    if (cursors(row) != rowmap(row + 1)) lcount++;
+  }
+
+  rowmap_t rowmap;
+  rowmap_t cursors;
+};
+
+}  // namespace Impl
+
+namespace Experimental {
+
+/// \brief Builds a CrsMatrix in device memory from COO triplets given in
+/// batches, without ever holding the whole COO: the batches are streamed
+/// twice, first to count the entries of each row, then to place them.
+/// Besides the final matrix, it only allocates one offset per row.
+///
+///   CrsStreamingBuilder<crsMat_t> builder(numRows, numCols);
+///   for (each batch) builder.count(rows, cols);
+///   builder.allocate();
+///   for (each batch, in any order) builder.fill(rows, cols, vals);
+///   crsMat_t A = builder.finish();
+///
+/// The batches are rank-1 Views accessible from crsMat_t's execution space,
+/// and the two passes must give the same triplets, for example by reading the
+/// same files twice or by running a deterministic generator twice. Like
+/// coo2crs, duplicate entries are summed.
+template <typename crsMat_t>
+class CrsStreamingBuilder {
+ public:
+  using execution_space = typename crsMat_t::execution_space;
+  using ordinal_type    = typename crsMat_t::non_const_ordinal_type;
+  using size_type       = typename crsMat_t::non_const_size_type;
+  using rowmap_t        = typename crsMat_t::row_map_type::non_const_type;
+  using entries_t       = typename crsMat_t::index_type::non_const_type;
+  using values_t        = typename crsMat_t::values_type::non_const_type;
+
+  CrsStreamingBuilder(ordinal_type numRows, ordinal_type numCols,
+                      const execution_space& exec = execution_space())
+      : exec_(exec),
+        numRows_(numRows),
+        numCols_(numCols),
+        rowmap_("Streamed rowmap", numRows + 1) {
+    if (numRows < 0 || numCols < 0)
+      throw std::invalid_argument(
+          "CrsStreamingBuilder: the dimensions must be nonnegative");
+  }
+
+  /// \brief First pass: count the triplets (rows(i), cols(i)) of a batch.
+  template <typename rows_t, typename cols_t>
+  void count(const rows_t& rows, const cols_t& cols) {
+    check_phase(COUNTING, "count");
+    check_batch(rows, cols, rows);
+    size_t errors = 0;
+    Kokkos::parallel_reduce(
+        "KokkosSparse::CrsStreamingBuilder::count",
+        Kokkos::RangePolicy<execution_space>(exec_, 0, rows.extent(0)),
+        Impl::StreamingCountFunctor<rows_t, cols_t, rowmap_t>(
+            rows, cols, rowmap_, numRows_, numCols_),
+        errors);
+    if (errors)
+      throw std::invalid_argument(
+          "CrsStreamingBuilder::count: " + std::to_string(errors) +
+          " entries are out of bounds");
+  }
+
+  /// \brief End the first pass: allocate the entries and values of the
+  /// matrix, with the number of triplets counted.
+  void allocate() {
+    check_phase(COUNTING, "allocate");
+    KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum<execution_space>(
+        exec_, numRows_ + 1, rowmap_);
+    size_type nnz = 0;
+    Kokkos::deep_copy(exec_, nnz, Kokkos::subview(rowmap_, numRows_));
+    exec_.fence();
+    cursors_ = rowmap_t(
+        Kokkos::view_alloc(exec_, Kokkos::WithoutInitializing,
+                           "Streamed row cursors"),
+        numRows_);
+    auto rowBegins = Kokkos::subview(
+        rowmap_, Kokkos::make_pair(ordinal_type(0), numRows_));
+    Kokkos::deep_copy(exec_, cursors_, rowBegins);
+    entries_ = entries_t(Kokkos::view_alloc(exec_, Kokkos::WithoutInitializing,
+                                            "Streamed entries"),
+                         nnz);
+    values_  = values_t(Kokkos::view_alloc(exec_, Kokkos::WithoutInitializing,
+                                          "Streamed values"),
+                       nnz);
+    phase_   = FILLING;
+  }
+
+  /// \brief Second pass: place the triplets (rows(i), cols(i), vals(i)) of
+  /// a batch.
+  template <typename rows_t, typename cols_t, typename vals_t>
+  void fill(const rows_t& rows, const cols_t& cols, const vals_t& vals) {
+    check_phase(FILLING, "fill");
+    check_batch(rows, cols, vals);
+    size_t errors = 0;
+    Kokkos::parallel_reduce(
+        "KokkosSparse::CrsStreamingBuilder::fill",
+        Kokkos::RangePolicy<execution_space>(exec_, 0, rows.extent(0)),
+        Impl::StreamingFillFunctor<rows_t, cols_t, vals_t, rowmap_t, entries_t,
+                                   values_t>(rows, cols, vals, rowmap_,
+                                             cursors_, entries_, values_,
+                                             numCols_),
+        errors);
+    if (errors)
+      throw std::invalid_argument(
+          "CrsStreamingBuilder::fill: " + std::to_string(errors) +
+          " entries are out of bounds or were not counted");
+  }
+
+  /// \brief End the second pass: return the matrix, with its rows sorted and
+  /// duplicate entries summed.
+  crsMat_t finish() {
+    check_phase(FILLING, "finish");
+    size_t incompleteRows = 0;
+    Kokkos::parallel_reduce(
+        "KokkosSparse::CrsStreamingBuilder::finish",
+        Kokkos::RangePolicy<execution_space>(exec_, 0, numRows_),
+        Impl::StreamingIncompleteRowsFunctor<rowmap_t>(rowmap_, cursors_),
+        incompleteRows);
+    if (incompleteRows)
+      throw std::runtime_error(
+          "CrsStreamingBuilder::finish: " + std::to_string(incompleteRows) +
+          " rows got fewer entries in the fill pass than in the count pass");
+    cursors_ = rowmap_t();
+    phase_   = FINISHED;
+    crsMat_t A("Streamed", numRows_, numCols_, entries_.extent(0), values_,
+               rowmap_, entries_);
+    rowmap_  = rowmap_t();
+    entries_ = entries_t();
+    values_  = values_t();
+    return sort_and_merge_matrix(exec_, A);
+  }
+
+ private:
+  enum Phase { COUNTING, FILLING, FINISHED };
+
+  void check_phase(Phase expected, const char* method) const {
+    if (phase_ != expected)
+      throw std::runtime_error(std::string("CrsStreamingBuilder::") + method +
+                               ": called out of order (count all batches, "
+                               "allocate, fill all batches, then finish)");
+  }
+
+  template <typename rows_t, typename cols_t, typename vals_t>
+  static void check_batch(const rows_t& rows, const cols_t& cols,
+                          const vals_t& vals) {
+    static_assert(Kokkos::is_view_v<rows_t> && Kokkos::is_view_v<cols_t> &&
+                      Kokkos::is_view_v<vals_t>,
+                  "CrsStreamingBuilder: the batches must be Kokkos::Views");
+    static_assert(rows_t::rank == 1 && cols_t::rank == 1 && vals_t::rank == 1,
+                  "CrsStreamingBuilder: the batches must have rank 1");
+    static_assert(
+        Kokkos::SpaceAccessibility<execution_space,
+                                   typename rows_t::memory_space>::accessible &&
+            Kokkos::SpaceAccessibility<
+                execution_space, typename cols_t::memory_space>::accessible &&
+            Kokkos::SpaceAccessibility<
+                execution_space, typename vals_t::memory_space>::accessible,
+        "CrsStreamingBuilder: the batches must be accessible from the "
+        "execution space of the matrix");
+    if (rows.extent(0) != cols.extent(0) || rows.extent(0) != vals.extent(0))
+      throw std::invalid_argument(
+          "CrsStreamingBuilder: the rows, columns and values of a batch must "
+          "have the same length");
+  }
+
+  execution_space exec_;
+  ordinal_type numRows_;
+  ordinal_type numCols_;
+  Phase phase_ = COUNTING;
+  rowmap_t rowmap_;
+  rowmap_t cursors_;
+  entries_t entries_;
+  values_t values_;
+};
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif
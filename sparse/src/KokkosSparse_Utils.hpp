@@ -22,6 +22,7 @@
 #include "KokkosKernels_IOUtils.hpp"
 #include "KokkosKernels_ExecSpaceUtils.hpp"
 #include "KokkosKernels_PrintUtils.hpp"
+#include "KokkosKernels_Sorting.hpp"
 #include "KokkosSparse_CrsMatrix.hpp"
 #include "KokkosSparse_BsrMatrix.hpp"
 #include "Kokkos_Bitset.hpp"
@@ -510,6 +511,190 @@ void transpose_graph(
   MyExecSpace().fence();
 }
 
+// Functors of the sorted transpose. The entries of A are sorted by column
+// with a stable radix sort, which keeps the entries of each column in the
+// order of the rows: the transpose comes out with sorted rows and without
+// atomics.
+template <typename in_nnz_view_t, typename key_view_t, typename perm_view_t>
+struct SortedTransposeKeysFunctor {
+  using size_type = typename perm_view_t::non_const_value_type;
+
+  in_nnz_view_t adj;
+  key_view_t keys;
+  perm_view_t perm;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const size_type k) const {
+    keys(k) = adj(k);
+    perm(k) = k;
+  }
+};
+
+template <typename in_row_view_t, typename in_scalar_view_t,
+          typename out_row_view_t, typename out_nnz_view_t,
+          typename out_scalar_view_t, typename key_view_t,
+          typename perm_view_t>
+struct SortedTransposeFillFunctor {
+  using nnz_lno_t = typename out_nnz_view_t::non_const_value_type;
+  using size_type = typename perm_view_t::non_const_value_type;
+
+  nnz_lno_t num_rows;
+  nnz_lno_t num_cols;
+  in_row_view_t xadj;
+  in_scalar_view_t vals;
+  out_row_view_t t_xadj;
+  out_nnz_view_t t_adj;
+  out_scalar_view_t t_vals;
+  key_view_t keys;
+  perm_view_t perm;
+  bool transpose_values;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const size_type i) const {
+    const size_type nnz = keys.extent(0);
+    const size_type k   = perm(i);
+
+    // The row of entry k: the last row r with xadj(r) <= k
+    nnz_lno_t lo = 0, hi = num_rows;
+    while (lo < hi) {
+      const nnz_lno_t mid = (lo + hi + 1) / 2;
+      if (size_type(xadj(mid)) <= k)
+        lo = mid;
+      else
+        hi = mid - 1;
+    }
+    t_adj(i) = lo;
+    if (transpose_values) t_vals(i) = vals(k);
+
+    // Each row pointer of the transpose is set by the entry that ends the
+    // previous nonempty row, or by the first entry for the leading empty rows
+    const nnz_lno_t col = keys(i);
+    if (i == 0) {
+      for (nnz_lno_t c = 0; c <= col; c++) t_xadj(c) = 0;
+    }
+    const nnz_lno_t next = i + 1 < nnz ? nnz_lno_t(keys(i + 1)) : num_cols;
+    for (nnz_lno_t c = col + 1; c <= next; c++) t_xadj(c) = i + 1;
+  }
+};
+
+/**
+ * @brief Transpose of the CRS matrix (xadj, adj, vals), with rows sorted by
+ * column index, whether or not the rows of the input are sorted. The
+ * entries are sorted by column with a stable radix sort, instead of the
+ * atomic counting and filling of transpose_matrix(): no atomics, and no
+ * sort_crs_matrix() afterwards. It allocates 2 * nnz integers of workspace.
+ *
+ * @param exec the kernels run on exec, which is fenced before returning.
+ * @param t_xadj [out] pre-allocated to num_cols + 1, no need to initialize.
+ * @param t_adj [out] pre-allocated to nnz, no need to initialize.
+ * @param t_vals [out] pre-allocated to nnz, no need to initialize.
+ */
+template <typename in_row_view_t, typename in_nnz_view_t,
+          typename in_scalar_view_t, typename out_row_view_t,
+          typename out_nnz_view_t, typename out_scalar_view_t,
+          typename MyExecSpace>
+void sorted_transpose_matrix(
+    const MyExecSpace &exec,
+    typename in_nnz_view_t::non_const_value_type num_rows,
+    typename in_nnz_view_t::non_const_value_type num_cols, in_row_view_t xadj,
+    in_nnz_view_t adj, in_scalar_view_t vals, out_row_view_t t_xadj,
+    out_nnz_view_t t_adj, out_scalar_view_t t_vals,
+    bool transpose_values = true) {
+  using nnz_lno_t    = typename in_nnz_view_t::non_const_value_type;
+  using size_type    = typename in_row_view_t::non_const_value_type;
+  using device_t     = typename out_nnz_view_t::device_type;
+  using key_view_t   = Kokkos::View<nnz_lno_t *, device_t>;
+  using perm_view_t  = Kokkos::View<size_type *, device_t>;
+  using range_policy = Kokkos::RangePolicy<MyExecSpace>;
+
+  const size_type nnz = adj.extent(0);
+  if (nnz == 0) {
+    Kokkos::deep_copy(exec, t_xadj, size_type(0));
+    exec.fence();
+    return;
+  }
+
+  key_view_t keys(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "keys"), nnz);
+  perm_view_t perm(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "perm"), nnz);
+  Kokkos::parallel_for(
+      "KokkosSparse::Impl::sorted_transpose_matrix::keys",
+      range_policy(exec, 0, nnz),
+      SortedTransposeKeysFunctor<in_nnz_view_t, key_view_t, perm_view_t>{
+          adj, keys, perm});
+  KokkosKernels::radixSort(exec, keys, perm);
+  Kokkos::parallel_for(
+      "KokkosSparse::Impl::sorted_transpose_matrix::fill",
+      range_policy(exec, 0, nnz),
+      SortedTransposeFillFunctor<in_row_view_t, in_scalar_view_t,
+                                 out_row_view_t, out_nnz_view_t,
+                                 out_scalar_view_t, key_view_t, perm_view_t>{
+          num_rows, num_cols, xadj, vals, t_xadj, t_adj, t_vals, keys, perm,
+          transpose_values});
+  exec.fence();
+}
+
+template <typename in_row_view_t, typename in_nnz_view_t,
+          typename in_scalar_view_t, typename out_row_view_t,
+          typename out_nnz_view_t, typename out_scalar_view_t,
+          typename MyExecSpace>
+void sorted_transpose_matrix(
+    typename in_nnz_view_t::non_const_value_type num_rows,
+    typename in_nnz_view_t::non_const_value_type num_cols, in_row_view_t xadj,
+    in_nnz_view_t adj, in_scalar_view_t vals, out_row_view_t t_xadj,
+    out_nnz_view_t t_adj, out_scalar_view_t t_vals,
+    bool transpose_values = true) {
+  sorted_transpose_matrix<in_row_view_t, in_nnz_view_t, in_scalar_view_t,
+                          out_row_view_t, out_nnz_view_t, out_scalar_view_t,
+                          MyExecSpace>(MyExecSpace(), num_rows, num_cols, xadj,
+                                       adj, vals, t_xadj, t_adj, t_vals,
+                                       transpose_values);
+}
+
+template <typename crsMat_t>
+crsMat_t sorted_transpose_matrix(const crsMat_t &A) {
+  // Allocate views and call the other version of sorted_transpose_matrix
+  using c_rowmap_t  = typename crsMat_t::row_map_type;
+  using c_entries_t = typename crsMat_t::index_type;
+  using c_values_t  = typename crsMat_t::values_type;
+  using rowmap_t    = typename crsMat_t::row_map_type::non_const_type;
+  using entries_t   = typename crsMat_t::index_type::non_const_type;
+  using values_t    = typename crsMat_t::values_type::non_const_type;
+  rowmap_t AT_rowmap(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "Transpose rowmap"),
+      A.numCols() + 1);
+  entries_t AT_entries(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "Transpose entries"),
+      A.nnz());
+  values_t AT_values(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "Transpose values"),
+      A.nnz());
+  sorted_transpose_matrix<c_rowmap_t, c_entries_t, c_values_t, rowmap_t,
+                          entries_t, values_t,
+                          typename crsMat_t::execution_space>(
+      A.numRows(), A.numCols(), A.graph.row_map, A.graph.entries, A.values,
+      AT_rowmap, AT_entries, AT_values);
+  return crsMat_t("Transpose", A.numCols(), A.numRows(), A.nnz(), AT_values,
+                  AT_rowmap, AT_entries);
+}
+
+/**
+ * @brief Transpose of the graph (xadj, adj), with sorted rows; see
+ * sorted_transpose_matrix().
+ */
+template <typename in_row_view_t, typename in_nnz_view_t,
+          typename out_row_view_t, typename out_nnz_view_t,
+          typename MyExecSpace>
+void sorted_transpose_graph(
+    typename in_nnz_view_t::non_const_value_type num_rows,
+    typename in_nnz_view_t::non_const_value_type num_cols, in_row_view_t xadj,
+    in_nnz_view_t adj, out_row_view_t t_xadj, out_nnz_view_t t_adj) {
+  sorted_transpose_matrix<in_row_view_t, in_nnz_view_t, in_nnz_view_t,
+                          out_row_view_t, out_nnz_view_t, out_nnz_view_t,
+                          MyExecSpace>(num_rows, num_cols, xadj, adj,
+                                       in_nnz_view_t(), t_xadj, t_adj,
+                                       out_nnz_view_t(), false);
+}
+
 template <typename in_row_view_t, typename in_nnz_view_t,
           typename in_scalar_view_t, typename out_row_view_t,
           typename out_nnz_view_t, typename out_scalar_view_t>
@@ -2305,6 +2490,181 @@ Matrix removeCrsMatrixZeros(
                 filteredValues, filteredRowmap, filteredEntries);
 }
 
+// Predicates of filter_matrix() and filter_graph(). They are called for each
+// entry a_ij of A with the largest magnitude of row i, and the largest
+// magnitude of the off-diagonal entries of row i, and return true to keep the
+// entry. These ones always keep the diagonal entries.
+
+// Keeps the entries with |a_ij| > tol
+template <typename Mag>
+struct DropTolerance {
+  Mag tol;
+
+  template <typename Ordinal, typename Scalar>
+  KOKKOS_INLINE_FUNCTION bool operator()(const Ordinal i, const Ordinal j,
+                                         const Scalar &a, const Mag,
+                                         const Mag) const {
+    return i == j || Kokkos::ArithTraits<Scalar>::abs(a) > tol;
+  }
+};
+
+// Keeps the entries with |a_ij| > tol * max_k |a_ik|
+template <typename Mag>
+struct RelativeDropTolerance {
+  Mag tol;
+
+  template <typename Ordinal, typename Scalar>
+  KOKKOS_INLINE_FUNCTION bool operator()(const Ordinal i, const Ordinal j,
+                                         const Scalar &a, const Mag rowMax,
+                                         const Mag) const {
+    return i == j || Kokkos::ArithTraits<Scalar>::abs(a) > tol * rowMax;
+  }
+};
+
+// Classical strength of connection: keeps the entries with
+// |a_ij| >= theta * max_{k != i} |a_ik|
+template <typename Mag>
+struct StrengthOfConnection {
+  Mag theta;
+
+  template <typename Ordinal, typename Scalar>
+  KOKKOS_INLINE_FUNCTION bool operator()(const Ordinal i, const Ordinal j,
+                                         const Scalar &a, const Mag,
+                                         const Mag offDiagMax) const {
+    return i == j || Kokkos::ArithTraits<Scalar>::abs(a) >= theta * offDiagMax;
+  }
+};
+
+// Count pass (the number of kept entries of each row, in rowmapOut(i)) and
+// fill pass (after the prefix sum of rowmapOut) of filter_matrix(), one
+// thread per row. Both passes evaluate the predicate the same way, so they
+// agree on the kept entries.
+template <typename Matrix, typename Predicate, typename RowmapOut,
+          typename EntriesOut, typename ValuesOut>
+struct FilterMatrixFunctor {
+  struct CountTag {};
+  struct FillTag {};
+
+  using Ordinal = typename Matrix::non_const_ordinal_type;
+  using Offset  = typename Matrix::non_const_size_type;
+  using Scalar  = typename Matrix::non_const_value_type;
+  using KAT     = Kokkos::ArithTraits<Scalar>;
+  using Mag     = typename KAT::mag_type;
+
+  typename Matrix::row_map_type rowmap;
+  typename Matrix::index_type entries;
+  typename Matrix::values_type values;
+  Predicate pred;
+  RowmapOut rowmapOut;
+  EntriesOut entriesOut;
+  ValuesOut valuesOut;
+  bool fillValues;
+
+  KOKKOS_INLINE_FUNCTION void rowMaxes(const Ordinal i, Mag &rowMax,
+                                       Mag &offDiagMax) const {
+    rowMax     = Kokkos::ArithTraits<Mag>::zero();
+    offDiagMax = Kokkos::ArithTraits<Mag>::zero();
+    for (Offset k = rowmap(i); k < rowmap(i + 1); k++) {
+      const Mag a = KAT::abs(values(k));
+      if (a > rowMax) rowMax = a;
+      if (entries(k) != i && a > offDiagMax) offDiagMax = a;
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const CountTag &,
+                                         const Ordinal i) const {
+    Mag rowMax, offDiagMax;
+    rowMaxes(i, rowMax, offDiagMax);
+    Offset count = 0;
+    for (Offset k = rowmap(i); k < rowmap(i + 1); k++) {
+      if (pred(i, Ordinal(entries(k)), values(k), rowMax, offDiagMax)) count++;
+    }
+    rowmapOut(i) = count;
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const FillTag &,
+                                         const Ordinal i) const {
+    Mag rowMax, offDiagMax;
+    rowMaxes(i, rowMax, offDiagMax);
+    Offset pos = rowmapOut(i);
+    for (Offset k = rowmap(i); k < rowmap(i + 1); k++) {
+      if (pred(i, Ordinal(entries(k)), values(k), rowMax, offDiagMax)) {
+        entriesOut(pos) = entries(k);
+        if (fillValues) valuesOut(pos) = values(k);
+        pos++;
+      }
+    }
+  }
+};
+
+template <typename Matrix, typename Predicate>
+void filter_crs(const Matrix &A, const Predicate &pred,
+                typename Matrix::row_map_type::non_const_type &rowmapOut,
+                typename Matrix::index_type::non_const_type &entriesOut,
+                typename Matrix::values_type::non_const_type &valuesOut,
+                const bool fillValues) {
+  using Offset    = typename Matrix::non_const_size_type;
+  using ExecSpace = typename Matrix::execution_space;
+  using RowmapOut = typename Matrix::row_map_type::non_const_type;
+  using Entries   = typename Matrix::index_type::non_const_type;
+  using Values    = typename Matrix::values_type::non_const_type;
+  using Functor =
+      FilterMatrixFunctor<Matrix, Predicate, RowmapOut, Entries, Values>;
+  using CountPol = Kokkos::RangePolicy<ExecSpace, typename Functor::CountTag>;
+  using FillPol  = Kokkos::RangePolicy<ExecSpace, typename Functor::FillTag>;
+
+  ExecSpace exec;
+  rowmapOut = RowmapOut("Afiltered rowmap", A.numRows() + 1);
+  Functor functor{A.graph.row_map, A.graph.entries, A.values, pred,
+                  rowmapOut, Entries(), Values(), fillValues};
+  Kokkos::parallel_for("KokkosSparse::filter_matrix[count]",
+                       CountPol(exec, 0, A.numRows()), functor);
+  Offset filteredNNZ = 0;
+  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum<ExecSpace>(
+      exec, A.numRows() + 1, rowmapOut, filteredNNZ);
+  functor.entriesOut = entriesOut = Entries(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "Afiltered entries"),
+      filteredNNZ);
+  if (fillValues) {
+    functor.valuesOut = valuesOut = Values(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "Afiltered values"),
+        filteredNNZ);
+  }
+  Kokkos::parallel_for("KokkosSparse::filter_matrix[fill]",
+                       FillPol(exec, 0, A.numRows()), functor);
+  exec.fence();
+}
+
+// Given a CrsMatrix A, returns the matrix of the entries a_ij of A for which
+// pred(i, j, a_ij, max_k |a_ik|, max_{k != i} |a_ik|) is true, in the order of
+// A, with two parallel passes over the rows (count, then fill). The
+// predicate is called on the device; DropTolerance, RelativeDropTolerance
+// and StrengthOfConnection are the usual ones. A new matrix is always
+// returned (unless A has a length-0 rowmap).
+template <typename Matrix, typename Predicate>
+Matrix filter_matrix(const Matrix &A, const Predicate &pred) {
+  if (A.graph.row_map.extent(0) == 0) return A;
+  typename Matrix::row_map_type::non_const_type rowmap;
+  typename Matrix::index_type::non_const_type entries;
+  typename Matrix::values_type::non_const_type values;
+  filter_crs(A, pred, rowmap, entries, values, true);
+  return Matrix("A filtered", A.numRows(), A.numCols(), values.extent(0),
+                values, rowmap, entries);
+}
+
+// Same as filter_matrix(), but only returns the graph of the kept entries,
+// e.g. a strength of connection graph, without copying the values
+template <typename Matrix, typename Predicate>
+typename Matrix::staticcrsgraph_type filter_graph(const Matrix &A,
+                                                  const Predicate &pred) {
+  if (A.graph.row_map.extent(0) == 0) return A.graph;
+  typename Matrix::row_map_type::non_const_type rowmap;
+  typename Matrix::index_type::non_const_type entries;
+  typename Matrix::values_type::non_const_type values;
+  filter_crs(A, pred, rowmap, entries, values, false);
+  return typename Matrix::staticcrsgraph_type(entries, rowmap);
+}
+
 template <typename Rowmap, typename Entries, typename Values>
 void validateCrsMatrix(int m, int n, const Rowmap &rowmapIn,
                        const Entries &entriesIn, const Values &valuesIn) {
@@ -2627,10 +2987,368 @@ kk_extract_diagonal_blocks_crsmatrix_sequential(
   return perm_v;
 }
 
+// Tags of the two passes of SubmatrixFunctor
+struct SubmatrixCountTag {};
+struct SubmatrixFillTag {};
+
+/**
+ * @brief Set colmap(cols(j)) to j, or back to -1 when reset is true.
+ */
+template <typename colmap_type, typename cols_type>
+struct SubmatrixColMapFunctor {
+  using ordinal_type = typename colmap_type::non_const_value_type;
+
+  colmap_type colmap;
+  cols_type cols;
+  bool reset;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type j) const {
+    colmap(cols(j)) = reset ? ordinal_type(-1) : j;
+  }
+};
+
+/**
+ * @brief Rows rows(i) of a CRS matrix restricted to the columns c with
+ * colmap(c) >= 0, which are renumbered as colmap(c). The count pass stores
+ * the length of row i in row_map(i), the fill pass copies the entries once
+ * row_map holds the offsets.
+ */
+template <typename row_map_type, typename entries_type, typename values_type,
+          typename rows_type, typename colmap_type, typename out_row_map_type,
+          typename out_entries_type, typename out_values_type>
+struct SubmatrixFunctor {
+  using ordinal_type = typename entries_type::non_const_value_type;
+  using size_type    = typename row_map_type::non_const_value_type;
+
+  row_map_type A_row_map;
+  entries_type A_entries;
+  values_type A_values;
+  rows_type rows;
+  colmap_type colmap;
+  out_row_map_type row_map;
+  out_entries_type entries;
+  out_values_type values;
+
+  KOKKOS_INLINE_FUNCTION void operator()(SubmatrixCountTag,
+                                         const ordinal_type i) const {
+    const ordinal_type r = rows(i);
+    size_type count      = 0;
+    for (size_type k = A_row_map(r); k < A_row_map(r + 1); k++) {
+      if (colmap(A_entries(k)) >= 0) count++;
+    }
+    row_map(i) = count;
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(SubmatrixFillTag,
+                                         const ordinal_type i) const {
+    const ordinal_type r = rows(i);
+    size_type pos        = row_map(i);
+    for (size_type k = A_row_map(r); k < A_row_map(r + 1); k++) {
+      const ordinal_type c = colmap(A_entries(k));
+      if (c >= 0) {
+        entries(pos) = c;
+        values(pos)  = A_values(k);
+        pos++;
+      }
+    }
+  }
+};
+
+/**
+ * @brief Extract the submatrix A(rows, cols) of a CRS matrix in parallel on
+ * the device of A.
+ *
+ * rows and cols are lists of global indices in any order, the indices in
+ * cols must be distinct. Row i of the result is row rows(i) of A and its
+ * column j is column cols(j) of A. The entries of a row keep their order in
+ * A, so the rows are sorted when those of A are and cols is ascending.
+ *
+ * @param colmap [in/out] workspace of extent A.numCols() filled with -1, and
+ * left so on return. Reusing it over many extractions keeps their cost
+ * proportional to the submatrices instead of A.
+ */
+template <typename crsMat_t, typename rows_type, typename cols_type,
+          typename colmap_type>
+crsMat_t kk_extract_submatrix_crsmatrix(const crsMat_t &A,
+                                        const rows_type &rows,
+                                        const cols_type &cols,
+                                        const colmap_type &colmap) {
+  using exec_space       = typename crsMat_t::execution_space;
+  using ordinal_type     = typename crsMat_t::non_const_ordinal_type;
+  using size_type        = typename crsMat_t::non_const_size_type;
+  using out_row_map_type = typename crsMat_t::row_map_type::non_const_type;
+  using out_entries_type = typename crsMat_t::index_type::non_const_type;
+  using out_values_type  = typename crsMat_t::values_type::non_const_type;
+  using colmap_functor_t = SubmatrixColMapFunctor<colmap_type, cols_type>;
+  using functor_t =
+      SubmatrixFunctor<typename crsMat_t::row_map_type,
+                       typename crsMat_t::index_type,
+                       typename crsMat_t::values_type, rows_type, colmap_type,
+                       out_row_map_type, out_entries_type, out_values_type>;
+
+  const ordinal_type nrows = rows.extent(0);
+  const ordinal_type ncols = cols.extent(0);
+  exec_space exec;
+
+  Kokkos::parallel_for("KokkosSparse::extract_submatrix[colmap]",
+                       Kokkos::RangePolicy<exec_space>(exec, 0, ncols),
+                       colmap_functor_t{colmap, cols, false});
+
+  out_row_map_type row_map("submatrix row_map", nrows + 1);
+  functor_t functor{A.graph.row_map,   A.graph.entries,  A.values,
+                    rows,              colmap,           row_map,
+                    out_entries_type(), out_values_type()};
+  Kokkos::parallel_for(
+      "KokkosSparse::extract_submatrix[count]",
+      Kokkos::RangePolicy<exec_space, SubmatrixCountTag>(exec, 0, nrows),
+      functor);
+  size_type nnz = 0;
+  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum<exec_space>(
+      exec, nrows + 1, row_map, nnz);
+
+  functor.entries = out_entries_type(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "submatrix entries"),
+      nnz);
+  functor.values = out_values_type(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "submatrix values"),
+      nnz);
+  Kokkos::parallel_for(
+      "KokkosSparse::extract_submatrix[fill]",
+      Kokkos::RangePolicy<exec_space, SubmatrixFillTag>(exec, 0, nrows),
+      functor);
+
+  Kokkos::parallel_for("KokkosSparse::extract_submatrix[reset colmap]",
+                       Kokkos::RangePolicy<exec_space>(exec, 0, ncols),
+                       colmap_functor_t{colmap, cols, true});
+  exec.fence();
+  return crsMat_t("submatrix", nrows, ncols, nnz, functor.values, row_map,
+                  functor.entries);
+}
+
+/**
+ * @brief Extract the submatrix A(rows, cols) of a CRS matrix in parallel on
+ * the device of A, see above.
+ */
+template <typename crsMat_t, typename rows_type, typename cols_type>
+crsMat_t kk_extract_submatrix_crsmatrix(const crsMat_t &A,
+                                        const rows_type &rows,
+                                        const cols_type &cols) {
+  typename crsMat_t::index_type::non_const_type colmap(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "colmap"),
+      A.numCols());
+  Kokkos::deep_copy(colmap, -1);
+  return kk_extract_submatrix_crsmatrix(A, rows, cols, colmap);
+}
+
+/**
+ * @brief Add the columns of the frontier rows which are not yet marked with
+ * tag to the next frontier. The exchange makes exactly one thread add each
+ * new column.
+ */
+template <typename row_map_type, typename entries_type, typename mark_type,
+          typename frontier_type, typename count_type>
+struct GrowSubdomainFunctor {
+  using ordinal_type = typename entries_type::non_const_value_type;
+  using size_type    = typename row_map_type::non_const_value_type;
+  using mark_value   = typename mark_type::non_const_value_type;
+
+  row_map_type A_row_map;
+  entries_type A_entries;
+  mark_type mark;
+  frontier_type frontier;
+  frontier_type next;
+  count_type count;
+  mark_value tag;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type i) const {
+    const ordinal_type r = frontier(i);
+    for (size_type k = A_row_map(r); k < A_row_map(r + 1); k++) {
+      const ordinal_type c = A_entries(k);
+      if (Kokkos::atomic_exchange(&mark(c), tag) != tag)
+        next(Kokkos::atomic_fetch_add(&count(), ordinal_type(1))) = c;
+    }
+  }
+};
+
+/**
+ * @brief Sum of the lengths of the rows in frontier, a bound on the size of
+ * the next frontier.
+ */
+template <typename row_map_type, typename frontier_type>
+struct FrontierNnzFunctor {
+  using ordinal_type = typename frontier_type::non_const_value_type;
+  using size_type    = typename row_map_type::non_const_value_type;
+
+  row_map_type A_row_map;
+  frontier_type frontier;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type i,
+                                         size_type &nnz) const {
+    nnz += A_row_map(frontier(i) + 1) - A_row_map(frontier(i));
+  }
+};
+
+/**
+ * @brief Grow a set of rows of the square CRS matrix A by levels levels of
+ * breadth-first search in the graph of A: each level adds the columns of the
+ * rows in the set. This is the overlapping subdomain of an additive Schwarz
+ * method with overlap levels. Runs in parallel on the device of A.
+ *
+ * @param rows [in] distinct row indices.
+ * @param mark [in/out] workspace of extent A.numRows() whose entries are
+ * never equal to tag on entry. The rows of the result are marked with tag on
+ * return, so a workspace can serve many calls, each with a new tag, at a
+ * cost proportional to the subdomains instead of A.
+ * @return the rows of the grown set, in ascending order.
+ */
+template <typename crsMat_t, typename rows_type, typename mark_type>
+typename crsMat_t::index_type::non_const_type kk_grow_rows_crsmatrix(
+    const crsMat_t &A, const rows_type &rows, const int levels,
+    const mark_type &mark, const int tag) {
+  using exec_space    = typename crsMat_t::execution_space;
+  using ordinal_type  = typename crsMat_t::non_const_ordinal_type;
+  using size_type     = typename crsMat_t::non_const_size_type;
+  using rows_out_type = typename crsMat_t::index_type::non_const_type;
+  using count_type    = Kokkos::View<ordinal_type, exec_space>;
+  using mark_value    = typename mark_type::non_const_value_type;
+  using range_policy  = Kokkos::RangePolicy<exec_space>;
+
+  exec_space exec;
+  const mark_value mark_tag = tag;
+  rows_out_type set(Kokkos::view_alloc(Kokkos::WithoutInitializing, "rows"),
+                    rows.extent(0));
+  Kokkos::deep_copy(exec, set, rows);
+  Kokkos::parallel_for(
+      "KokkosSparse::grow_rows[mark]", range_policy(exec, 0, set.extent(0)),
+      KOKKOS_LAMBDA(const ordinal_type i) { mark(set(i)) = mark_tag; });
+
+  count_type count("count");
+  rows_out_type frontier = set;
+  for (int level = 0; level < levels && frontier.extent(0) > 0; level++) {
+    size_type bound = 0;
+    Kokkos::parallel_reduce(
+        "KokkosSparse::grow_rows[bound]",
+        range_policy(exec, 0, frontier.extent(0)),
+        FrontierNnzFunctor<typename crsMat_t::row_map_type, rows_out_type>{
+            A.graph.row_map, frontier},
+        bound);
+    rows_out_type next(Kokkos::view_alloc(Kokkos::WithoutInitializing, "next"),
+                       bound);
+    Kokkos::deep_copy(exec, count, ordinal_type(0));
+    Kokkos::parallel_for(
+        "KokkosSparse::grow_rows[level]",
+        range_policy(exec, 0, frontier.extent(0)),
+        GrowSubdomainFunctor<typename crsMat_t::row_map_type,
+                             typename crsMat_t::index_type, mark_type,
+                             rows_out_type, count_type>{
+            A.graph.row_map, A.graph.entries, mark, frontier, next, count,
+            mark_tag});
+    ordinal_type added = 0;
+    Kokkos::deep_copy(exec, added, count);
+    exec.fence();
+
+    // The set is followed by the new frontier
+    const size_t nset = set.extent(0);
+    frontier =
+        Kokkos::subview(next, Kokkos::make_pair(size_t(0), size_t(added)));
+    rows_out_type grown(Kokkos::view_alloc(Kokkos::WithoutInitializing, "rows"),
+                        nset + added);
+    Kokkos::deep_copy(
+        exec, Kokkos::subview(grown, Kokkos::make_pair(size_t(0), nset)), set);
+    Kokkos::deep_copy(
+        exec, Kokkos::subview(grown, Kokkos::make_pair(nset, nset + added)),
+        frontier);
+    set = grown;
+  }
+  KokkosKernels::radixSort(exec, set);
+  exec.fence();
+  return set;
+}
+
+/**
+ * @brief Extract overlapping subdomains out of a square crs matrix, in
+ * parallel on the device of A.
+ *
+ * The rows are split into Sub_v.size() contiguous blocks as in
+ * kk_extract_diagonal_blocks_crsmatrix_sequential(), and every block is grown
+ * by overlap levels of kk_grow_rows_crsmatrix(). With overlap = 0 the
+ * subdomains are the diagonal blocks.
+ *
+ * @param A [in] The square CrsMatrix.
+ * @param Sub_v [out] The extracted subdomains A(rows_i, rows_i).
+ * @param overlap [in] The number of levels of overlap.
+ * @return the global rows rows_i of each subdomain, in ascending order.
+ */
+template <typename crsMat_t>
+std::vector<typename crsMat_t::index_type::non_const_type>
+kk_extract_overlapping_subdomains_crsmatrix(const crsMat_t &A,
+                                            std::vector<crsMat_t> &Sub_v,
+                                            const int overlap) {
+  using exec_space   = typename crsMat_t::execution_space;
+  using ordinal_type = typename crsMat_t::non_const_ordinal_type;
+  using rows_type    = typename crsMat_t::index_type::non_const_type;
+
+  const ordinal_type A_nrows  = A.numRows();
+  const ordinal_type n_blocks = Sub_v.size();
+
+  if (A_nrows != A.numCols()) {
+    std::ostringstream os;
+    os << "The subdomain extraction only works with square matrices -- "
+          "matrix A: "
+       << A_nrows << " x " << A.numCols();
+    throw std::runtime_error(os.str());
+  }
+  if ((A_nrows > 0) && (A_nrows < n_blocks)) {
+    std::ostringstream os;
+    os << "The number of subdomains (" << n_blocks
+       << ") should be <= the number of rows of the matrix A (" << A_nrows
+       << ")";
+    throw std::runtime_error(os.str());
+  }
+
+  std::vector<rows_type> rows_v(n_blocks);
+  if (A_nrows == 0) {
+    for (ordinal_type i = 0; i < n_blocks; i++) Sub_v[i] = crsMat_t();
+    return rows_v;
+  }
+
+  const ordinal_type rows_per_block = (A_nrows + n_blocks - 1) / n_blocks;
+  rows_type mark(Kokkos::view_alloc(Kokkos::WithoutInitializing, "mark"),
+                 A_nrows);
+  rows_type colmap(Kokkos::view_alloc(Kokkos::WithoutInitializing, "colmap"),
+                   A_nrows);
+  Kokkos::deep_copy(mark, -1);
+  Kokkos::deep_copy(colmap, -1);
+
+  for (ordinal_type i = 0; i < n_blocks; i++) {
+    const ordinal_type blk_row_start = i * rows_per_block;
+    const ordinal_type blk_nrows    = Kokkos::max(
+        ordinal_type(0), Kokkos::min(rows_per_block, A_nrows - blk_row_start));
+    rows_type blk_rows(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "block rows"),
+        blk_nrows);
+    Kokkos::parallel_for(
+        "KokkosSparse::extract_overlapping_subdomains[rows]",
+        Kokkos::RangePolicy<exec_space>(0, blk_nrows),
+        KOKKOS_LAMBDA(const ordinal_type j) {
+          blk_rows(j) = blk_row_start + j;
+        });
+    rows_v[i] = kk_grow_rows_crsmatrix(A, blk_rows, overlap, mark, int(i));
+    Sub_v[i] =
+        kk_extract_submatrix_crsmatrix(A, rows_v[i], rows_v[i], colmap);
+  }
+  return rows_v;
+}
+
 }  // namespace Impl
 
 using Impl::isCrsGraphSorted;
 using Impl::removeCrsMatrixZeros;
+using Impl::filter_matrix;
+using Impl::filter_graph;
+using Impl::DropTolerance;
+using Impl::RelativeDropTolerance;
+using Impl::StrengthOfConnection;
 
 }  // namespace KokkosSparse
 
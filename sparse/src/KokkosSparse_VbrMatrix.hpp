@@ -0,0 +1,220 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file KokkosSparse_VbrMatrix.hpp
+/// \brief Local sparse matrix interface
+///
+/// This file provides KokkosSparse::Experimental::VbrMatrix.  This
+/// implements a local (no MPI) sparse matrix stored in variable block row
+/// format, where each block row and block column has its own size.
+
+#ifndef KOKKOSSPARSE_VBRMATRIX_HPP_
+#define KOKKOSSPARSE_VBRMATRIX_HPP_
+
+#include "Kokkos_Core.hpp"
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include "KokkosKernels_default_types.hpp"
+#include "KokkosKernels_Macros.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+
+/// \class VbrMatrix
+/// \brief Sparse matrix made of dense blocks of variable sizes.
+/// \tparam ScalarType The type of entries in the sparse matrix.
+/// \tparam OrdinalType The type of (block and point) row and column indices.
+/// \tparam Device The Kokkos Device type.
+/// \tparam MemoryTraits Traits describing how Kokkos manages and
+///   accesses data.  The default parameter suffices for most users.
+/// \tparam SizeType The type of block and value offsets.
+///
+/// The rows are split into consecutive block rows: block row I holds the
+/// point rows row_partition(I) to row_partition(I + 1) - 1. The columns are
+/// split the same way by col_partition. For a mesh with several unknowns per
+/// node, a block row (or column) is a node and its size the node's number of
+/// unknowns, which can differ from node to node (3, 4 and 7 for instance).
+///
+/// The block graph is stored as in a BsrMatrix: the blocks of block row I
+/// are block_row_map(I) to block_row_map(I + 1) - 1, and block K is in block
+/// column block_entries(K). Block K is dense and its values are stored row by
+/// row, starting at values(block_value_offsets(K)). Entries of a block that
+/// are not in the original matrix are explicit zeros.
+///
+/// Use KokkosSparse::Experimental::crs2vbr to build a VbrMatrix from a
+/// CrsMatrix, and vbr2crs to go back (for instance to use Gauss-Seidel or
+/// ILU on it).
+template <class ScalarType, class OrdinalType, class Device,
+          class MemoryTraits = void,
+          class SizeType     = typename Kokkos::ViewTraits<OrdinalType*, Device,
+                                                       void, void>::size_type>
+class VbrMatrix {
+ public:
+  //! Type of the matrix's execution space.
+  typedef typename Device::execution_space execution_space;
+  //! Type of the matrix's memory space.
+  typedef typename Device::memory_space memory_space;
+  //! Canonical device type
+  typedef Kokkos::Device<execution_space, memory_space> device_type;
+  typedef MemoryTraits memory_traits;
+
+  //! Type of each block or value offset.
+  typedef SizeType size_type;
+  typedef const SizeType const_size_type;
+  typedef typename std::remove_const<SizeType>::type non_const_size_type;
+  //! Type of each value in the matrix.
+  typedef ScalarType value_type;
+  typedef const ScalarType const_value_type;
+  typedef typename std::remove_const<ScalarType>::type non_const_value_type;
+  //! Type of each (block or point) row and column index in the matrix.
+  typedef OrdinalType ordinal_type;
+  typedef const OrdinalType const_ordinal_type;
+  typedef typename std::remove_const<OrdinalType>::type non_const_ordinal_type;
+
+  //! Type of the array of values.
+  typedef Kokkos::View<value_type*, Kokkos::LayoutRight, device_type,
+                       MemoryTraits>
+      values_type;
+  //! Type of the offsets (block_row_map and block_value_offsets).
+  typedef Kokkos::View<const size_type*, Kokkos::LayoutRight, device_type,
+                       MemoryTraits>
+      row_map_type;
+  //! Type of the arrays of indices (block_entries and the partitions).
+  typedef Kokkos::View<const ordinal_type*, Kokkos::LayoutRight, device_type,
+                       MemoryTraits>
+      index_type;
+
+  /// \name Storage of the actual sparsity structure and values.
+  //@{
+  //! Values, block by block, each block row by row.
+  values_type values;
+  //! Offset of the first block of each block row (numBlockRows() + 1).
+  row_map_type block_row_map;
+  //! Block column of each block.
+  index_type block_entries;
+  //! Offset of the values of each block (numBlocks() + 1).
+  row_map_type block_value_offsets;
+  //! First point row of each block row (numBlockRows() + 1).
+  index_type row_partition;
+  //! First point column of each block column (numBlockCols() + 1).
+  index_type col_partition;
+  //@}
+
+ private:
+  ordinal_type numRows_;
+  ordinal_type numCols_;
+
+ public:
+  /// \brief Default constructor; constructs an empty sparse matrix.
+  KOKKOS_INLINE_FUNCTION
+  VbrMatrix() : numRows_(0), numCols_(0) {}
+
+  // clang-format off
+  /// \brief Constructor that accepts the arrays directly (by view, not by deep
+  ///   copy). Most users should use crs2vbr instead.
+  ///
+  /// \param nrows [in] The number of point rows.
+  /// \param ncols [in] The number of point columns.
+  /// \param vals [in] The values.
+  /// \param brows [in] The offset of the first block of each block row.
+  /// \param bcols [in] The block column of each block.
+  /// \param boffsets [in] The offset of the values of each block.
+  /// \param rpart [in] The first point row of each block row.
+  /// \param cpart [in] The first point column of each block column.
+  // clang-format on
+  VbrMatrix(const std::string& /* label */, const OrdinalType nrows,
+            const OrdinalType ncols, const values_type& vals,
+            const row_map_type& brows, const index_type& bcols,
+            const row_map_type& boffsets, const index_type& rpart,
+            const index_type& cpart)
+      : values(vals),
+        block_row_map(brows),
+        block_entries(bcols),
+        block_value_offsets(boffsets),
+        row_partition(rpart),
+        col_partition(cpart),
+        numRows_(nrows),
+        numCols_(ncols) {
+    if (brows.extent(0) == 0 || rpart.extent(0) != brows.extent(0)) {
+      std::ostringstream os;
+      os << "VbrMatrix: row_partition (" << rpart.extent(0)
+         << ") and block_row_map (" << brows.extent(0)
+         << ") must both have numBlockRows() + 1 entries.";
+      throw std::invalid_argument(os.str());
+    }
+    if (boffsets.extent(0) != bcols.extent(0) + 1) {
+      std::ostringstream os;
+      os << "VbrMatrix: block_value_offsets must have one more entry than "
+            "block_entries.";
+      throw std::invalid_argument(os.str());
+    }
+    if (cpart.extent(0) == 0) {
+      std::ostringstream os;
+      os << "VbrMatrix: col_partition must have at least one entry.";
+      throw std::invalid_argument(os.str());
+    }
+  }
+
+  //! The number of (point) rows in the sparse matrix.
+  KOKKOS_INLINE_FUNCTION ordinal_type numRows() const { return numRows_; }
+
+  //! The number of (point) columns in the sparse matrix.
+  KOKKOS_INLINE_FUNCTION ordinal_type numCols() const { return numCols_; }
+
+  //! The number of "point" (non-block) rows in the matrix.
+  KOKKOS_INLINE_FUNCTION ordinal_type numPointRows() const { return numRows(); }
+
+  //! The number of "point" (non-block) columns in the matrix.
+  KOKKOS_INLINE_FUNCTION ordinal_type numPointCols() const { return numCols(); }
+
+  //! The number of block rows.
+  KOKKOS_INLINE_FUNCTION ordinal_type numBlockRows() const {
+    return row_partition.extent(0) - 1;
+  }
+
+  //! The number of block columns.
+  KOKKOS_INLINE_FUNCTION ordinal_type numBlockCols() const {
+    return col_partition.extent(0) - 1;
+  }
+
+  //! The number of blocks.
+  KOKKOS_INLINE_FUNCTION size_type numBlocks() const {
+    return block_entries.extent(0);
+  }
+
+  //! The number of stored entries, including the explicit zeros of the
+  //! blocks.
+  KOKKOS_INLINE_FUNCTION size_type nnz() const { return values.extent(0); }
+};
+
+/// \class is_vbr_matrix
+/// \brief is_vbr_matrix<T>::value is true if T is a VbrMatrix<...>, false
+/// otherwise
+template <typename>
+struct is_vbr_matrix : public std::false_type {};
+template <typename... P>
+struct is_vbr_matrix<VbrMatrix<P...>> : public std::true_type {};
+template <typename... P>
+struct is_vbr_matrix<const VbrMatrix<P...>> : public std::true_type {};
+
+/// \brief Equivalent to is_vbr_matrix<T>::value.
+template <typename T>
+inline constexpr bool is_vbr_matrix_v = is_vbr_matrix<T>::value;
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+#endif
@@ -0,0 +1,139 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+*/
+
+/// \file KokkosSparse_bicgstab.hpp
+/// \brief BiCGStab Ax = b solver
+///
+/// This file provides KokkosSparse::Experimental::bicgstab. This function
+/// performs a local (no MPI) solve of Ax = b for a sparse, nonsymmetric A, by
+/// the (right preconditioned) stabilized biconjugate gradient method. Vector
+/// updates are fused with the inner products that follow them, and the SpMV
+/// before alpha returns (rhat, A p) itself (KokkosSparse::spmv_dot).
+///
+/// This algorithm is described in the paper:
+/// Bi-CGSTAB: A Fast and Smoothly Converging Variant of Bi-CG for the
+/// Solution of Nonsymmetric Linear Systems - van der Vorst
+
+#ifndef KOKKOSSPARSE_BICGSTAB_HPP_
+#define KOKKOSSPARSE_BICGSTAB_HPP_
+
+#include <sstream>
+#include <type_traits>
+
+#include "KokkosKernels_helpers.hpp"
+#include "KokkosKernels_Error.hpp"
+#include "KokkosSparse_Preconditioner.hpp"
+#include "KokkosSparse_bicgstab_impl.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+
+#define KOKKOSKERNELS_BICGSTAB_SAME_TYPE(A, B)      \
+  std::is_same<typename std::remove_const<A>::type, \
+               typename std::remove_const<B>::type>::value
+
+/// @brief Solve Ax = b with BiCGStab
+/// @tparam KernelHandle
+/// @tparam AMatrix
+/// @tparam BType
+/// @tparam XType
+/// @param handle [in/out] A handle on which create_bicgstab_handle was called;
+///   its BiCGStab handle gives the parameters and receives the results
+/// @param A [in] The matrix (CrsMatrix or BsrMatrix)
+/// @param B [in] The right-hand side
+/// @param X [in/out] The initial guess and the solution
+/// @param precond [in] An optional right preconditioner
+template <typename KernelHandle, typename AMatrix, typename BType,
+          typename XType>
+void bicgstab(KernelHandle* handle, AMatrix& A, BType& B, XType& X,
+              Preconditioner<AMatrix>* precond = nullptr) {
+  using scalar_type  = typename KernelHandle::nnz_scalar_t;
+  using ordinal_type = typename KernelHandle::nnz_lno_t;
+
+  static_assert(
+      KOKKOSKERNELS_BICGSTAB_SAME_TYPE(typename BType::value_type, scalar_type),
+      "bicgstab: B scalar type must match KernelHandle entry "
+      "type (aka nnz_scalar_t, and const doesn't matter)");
+
+  static_assert(
+      KOKKOSKERNELS_BICGSTAB_SAME_TYPE(typename XType::value_type, scalar_type),
+      "bicgstab: X scalar type must match KernelHandle entry "
+      "type (aka nnz_scalar_t, and const doesn't matter)");
+
+  static_assert(KOKKOSKERNELS_BICGSTAB_SAME_TYPE(typename AMatrix::value_type,
+                                                 scalar_type),
+                "bicgstab: A scalar type must match KernelHandle entry "
+                "type (aka nnz_scalar_t, and const doesn't matter)");
+
+  static_assert(KOKKOSKERNELS_BICGSTAB_SAME_TYPE(typename AMatrix::ordinal_type,
+                                                 ordinal_type),
+                "bicgstab: A ordinal type must match KernelHandle entry "
+                "type (aka nnz_lno_t, and const doesn't matter)");
+
+  static_assert(KokkosSparse::is_crs_matrix<AMatrix>::value ||
+                    KokkosSparse::Experimental::is_bsr_matrix<AMatrix>::value,
+                "bicgstab: A is not a CRS or BSR matrix.");
+  static_assert(Kokkos::is_view<BType>::value,
+                "bicgstab: B is not a Kokkos::View.");
+  static_assert(Kokkos::is_view<XType>::value,
+                "bicgstab: X is not a Kokkos::View.");
+
+  static_assert(BType::rank == 1, "bicgstab: B must have rank 1");
+  static_assert(XType::rank == 1, "bicgstab: X must have rank 1");
+
+  static_assert(std::is_same<typename XType::value_type,
+                             typename XType::non_const_value_type>::value,
+                "bicgstab: The output X must be nonconst.");
+
+  static_assert(std::is_same<typename XType::device_type,
+                             typename BType::device_type>::value,
+                "bicgstab: X and B have different device types.");
+
+  static_assert(std::is_same<typename AMatrix::device_type,
+                             typename BType::device_type>::value,
+                "bicgstab: A and B have different device types.");
+
+  if ((X.extent(0) != B.extent(0)) ||
+      (static_cast<size_t>(A.numPointCols()) !=
+       static_cast<size_t>(X.extent(0))) ||
+      (static_cast<size_t>(A.numPointRows()) !=
+       static_cast<size_t>(B.extent(0)))) {
+    std::ostringstream os;
+    os << "KokkosSparse::bicgstab: Dimensions do not match: "
+       << ", A: " << A.numRows() << " x " << A.numCols()
+       << ", x: " << X.extent(0) << ", b: " << B.extent(0);
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  auto bicgstab_handle = handle->get_bicgstab_handle();
+  KK_REQUIRE_MSG(bicgstab_handle != nullptr,
+                 "bicgstab: call create_bicgstab_handle on the handle first");
+
+  using handle_t =
+      typename std::remove_pointer<decltype(bicgstab_handle)>::type;
+
+  KokkosSparse::Impl::BiCGStabWrap<handle_t>::bicgstab(*bicgstab_handle, A, B,
+                                                       X, precond);
+}  // bicgstab
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#undef KOKKOSKERNELS_BICGSTAB_SAME_TYPE
+
+#endif  // KOKKOSSPARSE_BICGSTAB_HPP_
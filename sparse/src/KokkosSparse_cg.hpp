@@ -0,0 +1,143 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+*/
+
+/// \file KokkosSparse_cg.hpp
+/// \brief CG Ax = b solver
+///
+/// This file provides KokkosSparse::Experimental::cg. This function performs
+/// a local (no MPI) solve of Ax = b for a sparse, Hermitian positive definite
+/// A, by the (preconditioned) conjugate gradient method. The iteration is
+/// built from fused kernels: the SpMV returns the inner product it needs
+/// (KokkosSparse::spmv_dot) and the vector updates are fused with the next
+/// reduction. The single-reduction variant (the default, see
+/// CGHandle::Variant) has only one synchronization point per iteration.
+/// Without a preconditioner, its iterations can also be recorded once into a
+/// graph and replayed, to save the kernel launches (see
+/// CGHandle::set_graph_replay).
+///
+/// The algorithms are described in:
+/// Methods of Conjugate Gradients for Solving Linear Systems - Hestenes,
+/// Stiefel
+/// s-Step Iterative Methods for Symmetric Linear Systems - Chronopoulos, Gear
+
+#ifndef KOKKOSSPARSE_CG_HPP_
+#define KOKKOSSPARSE_CG_HPP_
+
+#include <sstream>
+#include <type_traits>
+
+#include "KokkosKernels_helpers.hpp"
+#include "KokkosKernels_Error.hpp"
+#include "KokkosSparse_Preconditioner.hpp"
+#include "KokkosSparse_cg_impl.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+
+#define KOKKOSKERNELS_CG_SAME_TYPE(A, B)            \
+  std::is_same<typename std::remove_const<A>::type, \
+               typename std::remove_const<B>::type>::value
+
+/// @brief Solve Ax = b with CG
+/// @tparam KernelHandle
+/// @tparam AMatrix
+/// @tparam BType
+/// @tparam XType
+/// @param handle [in/out] A handle on which create_cg_handle was called;
+///   its CG handle gives the parameters and receives the results
+/// @param A [in] The matrix (CrsMatrix or BsrMatrix)
+/// @param B [in] The right-hand side
+/// @param X [in/out] The initial guess and the solution
+/// @param precond [in] An optional (Hermitian positive definite) preconditioner
+template <typename KernelHandle, typename AMatrix, typename BType,
+          typename XType>
+void cg(KernelHandle* handle, AMatrix& A, BType& B, XType& X,
+        Preconditioner<AMatrix>* precond = nullptr) {
+  using scalar_type  = typename KernelHandle::nnz_scalar_t;
+  using ordinal_type = typename KernelHandle::nnz_lno_t;
+
+  static_assert(
+      KOKKOSKERNELS_CG_SAME_TYPE(typename BType::value_type, scalar_type),
+      "cg: B scalar type must match KernelHandle entry "
+      "type (aka nnz_scalar_t, and const doesn't matter)");
+
+  static_assert(
+      KOKKOSKERNELS_CG_SAME_TYPE(typename XType::value_type, scalar_type),
+      "cg: X scalar type must match KernelHandle entry "
+      "type (aka nnz_scalar_t, and const doesn't matter)");
+
+  static_assert(
+      KOKKOSKERNELS_CG_SAME_TYPE(typename AMatrix::value_type, scalar_type),
+      "cg: A scalar type must match KernelHandle entry "
+      "type (aka nnz_scalar_t, and const doesn't matter)");
+
+  static_assert(KOKKOSKERNELS_CG_SAME_TYPE(typename AMatrix::ordinal_type,
+                                           ordinal_type),
+                "cg: A ordinal type must match KernelHandle entry "
+                "type (aka nnz_lno_t, and const doesn't matter)");
+
+  static_assert(KokkosSparse::is_crs_matrix<AMatrix>::value ||
+                    KokkosSparse::Experimental::is_bsr_matrix<AMatrix>::value,
+                "cg: A is not a CRS or BSR matrix.");
+  static_assert(Kokkos::is_view<BType>::value,
+                "cg: B is not a Kokkos::View.");
+  static_assert(Kokkos::is_view<XType>::value,
+                "cg: X is not a Kokkos::View.");
+
+  static_assert(BType::rank == 1, "cg: B must have rank 1");
+  static_assert(XType::rank == 1, "cg: X must have rank 1");
+
+  static_assert(std::is_same<typename XType::value_type,
+                             typename XType::non_const_value_type>::value,
+                "cg: The output X must be nonconst.");
+
+  static_assert(std::is_same<typename XType::device_type,
+                             typename BType::device_type>::value,
+                "cg: X and B have different device types.");
+
+  static_assert(std::is_same<typename AMatrix::device_type,
+                             typename BType::device_type>::value,
+                "cg: A and B have different device types.");
+
+  if ((X.extent(0) != B.extent(0)) ||
+      (static_cast<size_t>(A.numPointCols()) !=
+       static_cast<size_t>(X.extent(0))) ||
+      (static_cast<size_t>(A.numPointRows()) !=
+       static_cast<size_t>(B.extent(0)))) {
+    std::ostringstream os;
+    os << "KokkosSparse::cg: Dimensions do not match: "
+       << ", A: " << A.numRows() << " x " << A.numCols()
+       << ", x: " << X.extent(0) << ", b: " << B.extent(0);
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  auto cg_handle = handle->get_cg_handle();
+  KK_REQUIRE_MSG(cg_handle != nullptr,
+                 "cg: call create_cg_handle on the handle first");
+
+  using handle_t = typename std::remove_pointer<decltype(cg_handle)>::type;
+
+  KokkosSparse::Impl::CgWrap<handle_t>::cg(*cg_handle, A, B, X, precond);
+}  // cg
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#undef KOKKOSKERNELS_CG_SAME_TYPE
+
+#endif  // KOKKOSSPARSE_CG_HPP_
@@ -27,6 +27,11 @@ namespace KokkosSparse {
 // clang-format off
 ///
 /// \brief Blocking function that converts a CooMatrix into a CrsMatrix. Values are summed.
+///
+/// The tuples are radix sorted by (row, column) on the device and each run of
+/// duplicates is summed in one pass, so the column indices of each row of the
+/// result are sorted and unique. Tuples with a negative row or column are dropped.
+///
 /// \tparam DimType the dimension type
 /// \tparam RowViewType The row array view type
 /// \tparam ColViewType The column array view type
@@ -90,8 +95,8 @@ template <typename ScalarType, typename OrdinalType, class DeviceType,
           class MemoryTraitsType, typename SizeType>
 auto coo2crs(KokkosSparse::CooMatrix<ScalarType, OrdinalType, DeviceType,
                                      MemoryTraitsType, SizeType> &cooMatrix) {
-  return coo2crs(cooMatrix.numRows(), cooMatrix.numCols(), cooMatrix.row,
-                 cooMatrix.col, cooMatrix.data);
+  return coo2crs(cooMatrix.numRows(), cooMatrix.numCols(), cooMatrix.row(),
+                 cooMatrix.col(), cooMatrix.data());
 }
 }  // namespace KokkosSparse
 #endif  //  _KOKKOSSPARSE_COO2CRS_HPP
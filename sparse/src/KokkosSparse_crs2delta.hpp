@@ -0,0 +1,127 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef _KOKKOSSPARSE_CRS2DELTA_HPP
+#define _KOKKOSSPARSE_CRS2DELTA_HPP
+
+#include <type_traits>
+#include <vector>
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_DeltaCrsMatrix.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+
+// clang-format off
+/// \brief Blocking function that converts a CrsMatrix to a DeltaCrsMatrix
+///   (16-bit delta-encoded column indices).
+///
+/// The column indices are encoded on the host. Rows whose columns are sorted
+/// and at most DeltaCrsMatrix::max_delta apart are delta-encoded; all other
+/// rows keep their full column indices. Sort A first (see
+/// KokkosSparse::sort_crs_matrix) to encode as many rows as possible.
+///
+/// The values and row map of the result are shallow copies of the ones of A.
+///
+/// \param A The KokkosSparse::CrsMatrix.
+/// \return A KokkosSparse::Experimental::DeltaCrsMatrix with the same device,
+///   scalar, ordinal and offset types as A.
+// clang-format on
+template <typename ScalarType, typename OrdinalType, class DeviceType,
+          class MemoryTraitsType, typename SizeType>
+auto crs2delta(const KokkosSparse::CrsMatrix<ScalarType, OrdinalType,
+                                             DeviceType, MemoryTraitsType,
+                                             SizeType>& A) {
+  using CrsType      = std::decay_t<decltype(A)>;
+  using ordinal_type = typename CrsType::non_const_ordinal_type;
+  using size_type    = typename CrsType::non_const_size_type;
+  using value_type   = typename CrsType::non_const_value_type;
+  using device_type  = typename CrsType::device_type;
+  using DeltaType =
+      DeltaCrsMatrix<value_type, ordinal_type, device_type, void, size_type>;
+  using delta_type = typename DeltaType::delta_type;
+  using row_map_t  = typename DeltaType::row_map_type::non_const_type;
+  using deltas_t   = typename DeltaType::deltas_type::non_const_type;
+  using index_t    = typename DeltaType::index_type::non_const_type;
+  using um_host_t  = Kokkos::MemoryTraits<Kokkos::Unmanaged>;
+  using host_row_map_t =
+      Kokkos::View<const size_type*, Kokkos::HostSpace, um_host_t>;
+  using host_index_t =
+      Kokkos::View<const ordinal_type*, Kokkos::HostSpace, um_host_t>;
+
+  const ordinal_type nrows = A.numRows();
+
+  auto rowmap_h  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                      A.graph.row_map);
+  auto entries_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                       A.graph.entries);
+
+  deltas_t deltas("DeltaCrsMatrix deltas", A.nnz());
+  index_t row_base(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "DeltaCrsMatrix base"),
+      nrows);
+  auto deltas_h   = Kokkos::create_mirror_view(deltas);
+  auto row_base_h = Kokkos::create_mirror_view(row_base);
+  std::vector<size_type> wide_row_map(1, 0);
+  std::vector<ordinal_type> wide_entries;
+
+  for (ordinal_type i = 0; i < nrows; i++) {
+    const size_type start = rowmap_h(i);
+    const size_type end   = rowmap_h(i + 1);
+    bool wide             = false;
+    for (size_type k = start + 1; k < end; k++) {
+      const ordinal_type delta = entries_h(k) - entries_h(k - 1);
+      if (delta < 0 || delta > DeltaType::max_delta) {
+        wide = true;
+        break;
+      }
+    }
+    if (wide) {
+      row_base_h(i) = -1 - ordinal_type(wide_row_map.size() - 1);
+      for (size_type k = start; k < end; k++) {
+        deltas_h(k) = 0;
+        wide_entries.push_back(entries_h(k));
+      }
+      wide_row_map.push_back(wide_entries.size());
+    } else {
+      row_base_h(i) = start < end ? entries_h(start) : ordinal_type(0);
+      if (start < end) deltas_h(start) = 0;
+      for (size_type k = start + 1; k < end; k++)
+        deltas_h(k) = static_cast<delta_type>(entries_h(k) - entries_h(k - 1));
+    }
+  }
+  Kokkos::deep_copy(deltas, deltas_h);
+  Kokkos::deep_copy(row_base, row_base_h);
+
+  row_map_t wide_rows(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "DeltaCrsMatrix wide"),
+      wide_row_map.size());
+  index_t wide_cols(Kokkos::view_alloc(Kokkos::WithoutInitializing,
+                                       "DeltaCrsMatrix wide entries"),
+                    wide_entries.size());
+  Kokkos::deep_copy(wide_rows, host_row_map_t(wide_row_map.data(),
+                                              wide_row_map.size()));
+  Kokkos::deep_copy(wide_cols, host_index_t(wide_entries.data(),
+                                            wide_entries.size()));
+
+  return DeltaType("crs2delta", A.numCols(), A.values, A.graph.row_map, deltas,
+                   row_base, wide_rows, wide_cols);
+}
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  //  _KOKKOSSPARSE_CRS2DELTA_HPP
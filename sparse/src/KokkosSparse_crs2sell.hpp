@@ -0,0 +1,199 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef _KOKKOSSPARSE_CRS2SELL_HPP
+#define _KOKKOSSPARSE_CRS2SELL_HPP
+
+#include <algorithm>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include "KokkosKernels_Utils.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_SellMatrix.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+namespace Impl {
+
+/// Scatter the entries of each CRS row into its (padded) lane of the SELL
+/// chunk. One thread per lane of every chunk, so padding lanes of the last
+/// chunk are filled too.
+template <class RowMap, class Entries, class Values, class SellOffsets,
+          class SellRowArray, class SellEntries, class SellValues>
+struct Crs2SellFill {
+  using ordinal_type = typename SellEntries::non_const_value_type;
+  using size_type    = typename SellOffsets::non_const_value_type;
+  using value_type   = typename SellValues::non_const_value_type;
+
+  RowMap rowmap;
+  Entries crs_entries;
+  Values crs_values;
+  SellOffsets chunk_offsets;
+  SellRowArray row_perm;
+  SellRowArray row_lengths;
+  SellEntries sell_entries;
+  SellValues sell_values;
+  ordinal_type nrows;
+  int C;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type i) const {
+    const ordinal_type chunk = i / C;
+    const ordinal_type lane  = i % C;
+    const size_type offset   = chunk_offsets(chunk) + lane;
+    const ordinal_type width =
+        (chunk_offsets(chunk + 1) - chunk_offsets(chunk)) / C;
+    ordinal_type len = 0;
+    size_type rowStart = 0;
+    if (i < nrows) {
+      len      = row_lengths(i);
+      rowStart = rowmap(row_perm(i));
+    }
+    for (ordinal_type j = 0; j < width; j++) {
+      if (j < len) {
+        sell_entries(offset + j * C) = crs_entries(rowStart + j);
+        sell_values(offset + j * C)  = crs_values(rowStart + j);
+      } else {
+        sell_entries(offset + j * C) = 0;
+        sell_values(offset + j * C)  = Kokkos::ArithTraits<value_type>::zero();
+      }
+    }
+  }
+};
+}  // namespace Impl
+
+// clang-format off
+/// \brief Blocking function that converts a CrsMatrix to a SellMatrix
+///   (sliced ELLPACK, SELL-C-sigma).
+///
+/// The row lengths are computed and sorted on the host (this only touches
+/// O(numRows) data), then the entries are scattered into the padded chunks on
+/// the device.
+///
+/// \param chunk_size The number of rows per chunk (C). The natural choices are
+///   the warp/wavefront size on GPUs and the SIMD width on CPUs.
+/// \param sigma The size of the window in which rows are sorted by decreasing
+///   length before forming chunks. sigma = 1 keeps the original row order;
+///   larger values reduce padding at the cost of locality of y. It is usually a
+///   multiple of chunk_size.
+/// \param A The KokkosSparse::CrsMatrix.
+/// \return A KokkosSparse::Experimental::SellMatrix with the same device,
+///   scalar, ordinal and offset types as A.
+// clang-format on
+template <typename ScalarType, typename OrdinalType, class DeviceType,
+          class MemoryTraitsType, typename SizeType>
+auto crs2sell(int chunk_size, int64_t sigma,
+              const KokkosSparse::CrsMatrix<ScalarType, OrdinalType, DeviceType,
+                                            MemoryTraitsType, SizeType>& A) {
+  using CrsType      = KokkosSparse::CrsMatrix<ScalarType, OrdinalType,
+                                          DeviceType, MemoryTraitsType, SizeType>;
+  using ordinal_type = typename CrsType::non_const_ordinal_type;
+  using size_type    = typename CrsType::non_const_size_type;
+  using value_type   = typename CrsType::non_const_value_type;
+  using device_type  = typename CrsType::device_type;
+  using exec_space   = typename device_type::execution_space;
+  using SellType =
+      SellMatrix<value_type, ordinal_type, device_type, void, size_type>;
+
+  if (chunk_size < 1 || chunk_size > SellType::max_chunk_size) {
+    std::ostringstream os;
+    os << "crs2sell: chunk size " << chunk_size << " must be between 1 and "
+       << SellType::max_chunk_size << ".";
+    throw std::invalid_argument(os.str());
+  }
+  if (sigma < 1) sigma = 1;
+
+  const ordinal_type nrows = A.numRows();
+  const int C              = chunk_size;
+  const ordinal_type nchunks = (nrows + C - 1) / C;
+
+  auto rowmap_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                      A.graph.row_map);
+
+  // Sort rows by decreasing length within windows of sigma rows
+  std::vector<ordinal_type> perm(nrows);
+  std::iota(perm.begin(), perm.end(), ordinal_type(0));
+  auto rowLength = [&](ordinal_type r) {
+    return static_cast<ordinal_type>(rowmap_h(r + 1) - rowmap_h(r));
+  };
+  if (sigma > 1) {
+    for (int64_t w = 0; w < nrows; w += sigma) {
+      auto wend = perm.begin() + std::min<int64_t>(w + sigma, nrows);
+      std::stable_sort(perm.begin() + w, wend,
+                       [&](ordinal_type r1, ordinal_type r2) {
+                         return rowLength(r1) > rowLength(r2);
+                       });
+    }
+  }
+
+  typename SellType::chunk_offsets_type::non_const_type chunk_offsets(
+      "SellMatrix chunk offsets", nchunks + 1);
+  typename SellType::row_array_type::non_const_type row_perm(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "SellMatrix row perm"),
+      nrows);
+  typename SellType::row_array_type::non_const_type row_lengths(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "SellMatrix row lengths"),
+      nrows);
+  auto chunk_offsets_h = Kokkos::create_mirror_view(chunk_offsets);
+  auto row_perm_h      = Kokkos::create_mirror_view(row_perm);
+  auto row_lengths_h   = Kokkos::create_mirror_view(row_lengths);
+
+  chunk_offsets_h(0) = 0;
+  for (ordinal_type c = 0; c < nchunks; c++) {
+    ordinal_type width = 0;
+    for (ordinal_type i = c * C; i < std::min<ordinal_type>((c + 1) * C, nrows);
+         i++) {
+      row_perm_h(i)    = perm[i];
+      row_lengths_h(i) = rowLength(perm[i]);
+      width            = std::max(width, row_lengths_h(i));
+    }
+    chunk_offsets_h(c + 1) =
+        chunk_offsets_h(c) + static_cast<size_type>(width) * C;
+  }
+  Kokkos::deep_copy(chunk_offsets, chunk_offsets_h);
+  Kokkos::deep_copy(row_perm, row_perm_h);
+  Kokkos::deep_copy(row_lengths, row_lengths_h);
+
+  const size_type storage = chunk_offsets_h(nchunks);
+  typename SellType::index_type sell_entries(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "SellMatrix entries"),
+      storage);
+  typename SellType::values_type sell_values(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "SellMatrix values"),
+      storage);
+
+  using Fill = Impl::Crs2SellFill<
+      typename CrsType::row_map_type, typename CrsType::index_type,
+      typename CrsType::values_type, typename SellType::chunk_offsets_type,
+      typename SellType::row_array_type, typename SellType::index_type,
+      typename SellType::values_type>;
+  Kokkos::parallel_for(
+      "KokkosSparse::crs2sell",
+      Kokkos::RangePolicy<exec_space>(0, nchunks * C),
+      Fill{A.graph.row_map, A.graph.entries, A.values, chunk_offsets, row_perm,
+           row_lengths, sell_entries, sell_values, nrows, C});
+
+  return SellType("crs2sell", nrows, A.numCols(), A.nnz(), C,
+                  static_cast<ordinal_type>(sigma),
+                  sell_values, sell_entries, chunk_offsets, row_perm,
+                  row_lengths);
+}
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  //  _KOKKOSSPARSE_CRS2SELL_HPP
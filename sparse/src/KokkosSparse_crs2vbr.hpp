@@ -0,0 +1,250 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef _KOKKOSSPARSE_CRS2VBR_HPP
+#define _KOKKOSSPARSE_CRS2VBR_HPP
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_VbrMatrix.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+
+// clang-format off
+/// \brief Blocking function that converts a CrsMatrix to a VbrMatrix
+///   (dense blocks of variable sizes).
+///
+/// The block structure is built on the host. Block row I holds the next
+/// row_block_sizes[I] rows of A, and block column J the next
+/// col_block_sizes[J] columns. A block is stored if any entry of A falls in
+/// it, and its other entries are stored as explicit zeros. Duplicate entries
+/// of A are summed.
+///
+/// \param A The KokkosSparse::CrsMatrix.
+/// \param row_block_sizes The number of rows of each block row. They must add
+///   up to A.numRows().
+/// \param col_block_sizes The number of columns of each block column. They
+///   must add up to A.numCols().
+/// \return A KokkosSparse::Experimental::VbrMatrix with the same device,
+///   scalar, ordinal and offset types as A.
+// clang-format on
+template <typename ScalarType, typename OrdinalType, class DeviceType,
+          class MemoryTraitsType, typename SizeType>
+auto crs2vbr(const KokkosSparse::CrsMatrix<ScalarType, OrdinalType, DeviceType,
+                                           MemoryTraitsType, SizeType>& A,
+             const std::vector<OrdinalType>& row_block_sizes,
+             const std::vector<OrdinalType>& col_block_sizes) {
+  using CrsType      = std::decay_t<decltype(A)>;
+  using ordinal_type = typename CrsType::non_const_ordinal_type;
+  using size_type    = typename CrsType::non_const_size_type;
+  using value_type   = typename CrsType::non_const_value_type;
+  using device_type  = typename CrsType::device_type;
+  using VbrType =
+      VbrMatrix<value_type, ordinal_type, device_type, void, size_type>;
+  using values_t  = typename VbrType::values_type;
+  using row_map_t = typename VbrType::row_map_type::non_const_type;
+  using index_t   = typename VbrType::index_type::non_const_type;
+  using um_host_t = Kokkos::MemoryTraits<Kokkos::Unmanaged>;
+  using host_row_map_t =
+      Kokkos::View<const size_type*, Kokkos::HostSpace, um_host_t>;
+  using host_index_t =
+      Kokkos::View<const ordinal_type*, Kokkos::HostSpace, um_host_t>;
+
+  const ordinal_type nbrows = row_block_sizes.size();
+  const ordinal_type nbcols = col_block_sizes.size();
+  std::vector<ordinal_type> rpart(nbrows + 1, 0), cpart(nbcols + 1, 0);
+  for (ordinal_type I = 0; I < nbrows; I++)
+    rpart[I + 1] = rpart[I] + row_block_sizes[I];
+  for (ordinal_type J = 0; J < nbcols; J++)
+    cpart[J + 1] = cpart[J] + col_block_sizes[J];
+  if (rpart[nbrows] != A.numRows() || cpart[nbcols] != A.numCols()) {
+    std::ostringstream os;
+    os << "crs2vbr: the block sizes add up to " << rpart[nbrows] << " x "
+       << cpart[nbcols] << ", but A is " << A.numRows() << " x "
+       << A.numCols() << ".";
+    throw std::invalid_argument(os.str());
+  }
+  // Block column of each point column
+  std::vector<ordinal_type> col_block(A.numCols());
+  for (ordinal_type J = 0; J < nbcols; J++)
+    for (ordinal_type c = cpart[J]; c < cpart[J + 1]; c++) col_block[c] = J;
+
+  auto rowmap_h  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                      A.graph.row_map);
+  auto entries_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                       A.graph.entries);
+  auto values_h =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.values);
+
+  // Block graph: the sorted block columns of each block row. pos[J] is the
+  // index of block column J in the current block row, or -1.
+  std::vector<size_type> brows(nbrows + 1, 0);
+  std::vector<ordinal_type> bcols;
+  std::vector<size_type> boffsets(1, 0);
+  std::vector<long long> pos(nbcols, -1);
+  for (ordinal_type I = 0; I < nbrows; I++) {
+    const size_type begin = bcols.size();
+    for (size_type k = rowmap_h(rpart[I]); k < rowmap_h(rpart[I + 1]); k++) {
+      const ordinal_type J = col_block[entries_h(k)];
+      if (pos[J] < 0) {
+        pos[J] = 0;
+        bcols.push_back(J);
+      }
+    }
+    std::sort(bcols.begin() + begin, bcols.end());
+    for (size_type K = begin; K < bcols.size(); K++) {
+      pos[bcols[K]] = -1;
+      boffsets.push_back(boffsets.back() +
+                         size_type(row_block_sizes[I]) *
+                             size_type(col_block_sizes[bcols[K]]));
+    }
+    brows[I + 1] = bcols.size();
+  }
+
+  values_t values("VbrMatrix values", boffsets.back());
+  auto vbr_values_h = Kokkos::create_mirror_view(values);
+  Kokkos::deep_copy(vbr_values_h, Kokkos::ArithTraits<value_type>::zero());
+  for (ordinal_type I = 0; I < nbrows; I++) {
+    for (size_type K = brows[I]; K < brows[I + 1]; K++) pos[bcols[K]] = K;
+    for (ordinal_type r = rpart[I]; r < rpart[I + 1]; r++) {
+      for (size_type k = rowmap_h(r); k < rowmap_h(r + 1); k++) {
+        const ordinal_type c = entries_h(k);
+        const ordinal_type J = col_block[c];
+        vbr_values_h(boffsets[pos[J]] + (r - rpart[I]) * col_block_sizes[J] +
+                     (c - cpart[J])) += values_h(k);
+      }
+    }
+    for (size_type K = brows[I]; K < brows[I + 1]; K++) pos[bcols[K]] = -1;
+  }
+  Kokkos::deep_copy(values, vbr_values_h);
+
+  auto copy_offsets = [](const std::vector<size_type>& vec,
+                         const char* label) {
+    row_map_t v(Kokkos::view_alloc(Kokkos::WithoutInitializing, label),
+                vec.size());
+    Kokkos::deep_copy(v, host_row_map_t(vec.data(), vec.size()));
+    return v;
+  };
+  auto copy_indices = [](const std::vector<ordinal_type>& vec,
+                         const char* label) {
+    index_t v(Kokkos::view_alloc(Kokkos::WithoutInitializing, label),
+              vec.size());
+    Kokkos::deep_copy(v, host_index_t(vec.data(), vec.size()));
+    return v;
+  };
+  return VbrType("crs2vbr", A.numRows(), A.numCols(), values,
+                 copy_offsets(brows, "VbrMatrix block row map"),
+                 copy_indices(bcols, "VbrMatrix block entries"),
+                 copy_offsets(boffsets, "VbrMatrix block offsets"),
+                 copy_indices(rpart, "VbrMatrix row partition"),
+                 copy_indices(cpart, "VbrMatrix col partition"));
+}
+
+/// \brief Blocking function that converts a square CrsMatrix to a VbrMatrix
+///   with the same partition of the rows and of the columns (one block per
+///   mesh node, for instance).
+template <typename ScalarType, typename OrdinalType, class DeviceType,
+          class MemoryTraitsType, typename SizeType>
+auto crs2vbr(const KokkosSparse::CrsMatrix<ScalarType, OrdinalType, DeviceType,
+                                           MemoryTraitsType, SizeType>& A,
+             const std::vector<OrdinalType>& block_sizes) {
+  return crs2vbr(A, block_sizes, block_sizes);
+}
+
+// clang-format off
+/// \brief Blocking function that converts a VbrMatrix to a CrsMatrix.
+///
+/// Every stored entry of the blocks, including their explicit zeros, becomes
+/// an entry of the CrsMatrix, with the columns of each row sorted. This is
+/// how kernels that only take a CrsMatrix (Gauss-Seidel, ILU) are applied to
+/// a VbrMatrix.
+///
+/// \param V The KokkosSparse::Experimental::VbrMatrix.
+/// \return A KokkosSparse::CrsMatrix with the same device, scalar, ordinal
+///   and offset types as V.
+// clang-format on
+template <typename ScalarType, typename OrdinalType, class DeviceType,
+          class MemoryTraitsType, typename SizeType>
+auto vbr2crs(const VbrMatrix<ScalarType, OrdinalType, DeviceType,
+                             MemoryTraitsType, SizeType>& V) {
+  using VbrType      = std::decay_t<decltype(V)>;
+  using ordinal_type = typename VbrType::non_const_ordinal_type;
+  using size_type    = typename VbrType::non_const_size_type;
+  using value_type   = typename VbrType::non_const_value_type;
+  using device_type  = typename VbrType::device_type;
+  using CrsType =
+      KokkosSparse::CrsMatrix<value_type, ordinal_type, device_type, void,
+                              size_type>;
+  using values_t  = typename CrsType::values_type;
+  using row_map_t = typename CrsType::row_map_type::non_const_type;
+  using index_t   = typename CrsType::index_type::non_const_type;
+
+  auto brows_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                     V.block_row_map);
+  auto bcols_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                     V.block_entries);
+  auto boffsets_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                        V.block_value_offsets);
+  auto rpart_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                     V.row_partition);
+  auto cpart_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                     V.col_partition);
+  auto vals_h =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), V.values);
+
+  const ordinal_type nbrows = V.numBlockRows();
+  row_map_t rowmap("vbr2crs rowmap", V.numRows() + 1);
+  index_t entries(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "vbr2crs entries"),
+      V.nnz());
+  values_t values(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "vbr2crs values"),
+      V.nnz());
+  auto rowmap_h  = Kokkos::create_mirror_view(rowmap);
+  auto entries_h = Kokkos::create_mirror_view(entries);
+  auto values_h  = Kokkos::create_mirror_view(values);
+  size_type k    = 0;
+  rowmap_h(0)    = 0;
+  for (ordinal_type I = 0; I < nbrows; I++) {
+    for (ordinal_type r = rpart_h(I); r < rpart_h(I + 1); r++) {
+      for (size_type K = brows_h(I); K < brows_h(I + 1); K++) {
+        const ordinal_type J     = bcols_h(K);
+        const ordinal_type width = cpart_h(J + 1) - cpart_h(J);
+        const size_type off      = boffsets_h(K) + (r - rpart_h(I)) * width;
+        for (ordinal_type j = 0; j < width; j++, k++) {
+          entries_h(k) = cpart_h(J) + j;
+          values_h(k)  = vals_h(off + j);
+        }
+      }
+      rowmap_h(r + 1) = k;
+    }
+  }
+  Kokkos::deep_copy(rowmap, rowmap_h);
+  Kokkos::deep_copy(entries, entries_h);
+  Kokkos::deep_copy(values, values_h);
+  return CrsType("vbr2crs", V.numRows(), V.numCols(), V.nnz(), values, rowmap,
+                 entries);
+}
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  //  _KOKKOSSPARSE_CRS2VBR_HPP
@@ -20,6 +20,7 @@
 #include "KokkosKernels_Handle.hpp"
 #include "KokkosKernels_helpers.hpp"
 #include "KokkosKernels_Error.hpp"
+#include "KokkosSparse_BsrMatrix.hpp"
 
 namespace KokkosSparse {
 
@@ -1344,6 +1345,122 @@ void backward_sweep_block_gauss_seidel_apply(
       handle, num_rows, num_cols, row_map, entries, values, x_lhs_output_vec,
       y_rhs_input_vec, init_zero_x_vector, update_y_vector, omega, numIter);
 }
+
+///
+/// @brief Gauss-Seidel preconditioner setup (first phase) for a BsrMatrix:
+/// block_gauss_seidel_symbolic with the block graph and block size of A
+///
+/// With <tt>set_block_inverse_diagonal(true)</tt> on the point GS handle,
+/// the numeric phase precomputes the inverses of the dense diagonal blocks by
+/// LU (without pivoting), and each sweep updates a whole block row with its
+/// inverse instead of point by point within the block. Only the point
+/// (GS_DEFAULT, GS_PERMUTED, GS_TEAM) algorithms support BsrMatrix.
+///
+/// @tparam KernelHandle A specialization of
+/// KokkosKernels::Experimental::KokkosKernelsHandle
+/// @tparam BsrMatrixType A KokkosSparse::Experimental::BsrMatrix
+/// @param handle KernelHandle instance
+/// @param A The matrix
+/// @param is_graph_symmetric Whether the block graph of A is structurally
+/// symmetric
+/// @pre   <tt>handle->create_gs_handle(...)</tt> has been called previously
+///
+template <typename KernelHandle, typename BsrMatrixType,
+          typename std::enable_if_t<is_bsr_matrix_v<BsrMatrixType>> * =
+              nullptr>
+void gauss_seidel_symbolic(KernelHandle *handle, const BsrMatrixType &A,
+                           bool is_graph_symmetric = true) {
+  block_gauss_seidel_symbolic(handle, A.numRows(), A.numCols(), A.blockDim(),
+                              A.graph.row_map, A.graph.entries,
+                              is_graph_symmetric);
+}
+
+///
+/// @brief Gauss-Seidel preconditioner setup (second phase) for a BsrMatrix:
+/// block_gauss_seidel_numeric with the blocks of A
+///
+/// @tparam KernelHandle A specialization of
+/// KokkosKernels::Experimental::KokkosKernelsHandle
+/// @tparam BsrMatrixType A KokkosSparse::Experimental::BsrMatrix
+/// @param handle KernelHandle instance
+/// @param A The matrix
+/// @param is_graph_symmetric Whether the block graph of A is structurally
+/// symmetric
+///
+template <typename KernelHandle, typename BsrMatrixType,
+          typename std::enable_if_t<is_bsr_matrix_v<BsrMatrixType>> * =
+              nullptr>
+void gauss_seidel_numeric(KernelHandle *handle, const BsrMatrixType &A,
+                          bool is_graph_symmetric = true) {
+  block_gauss_seidel_numeric<KokkosSparse::SparseMatrixFormat::BSR>(
+      handle, A.numRows(), A.numCols(), A.blockDim(), A.graph.row_map,
+      A.graph.entries, A.values, is_graph_symmetric);
+}
+
+///
+/// @brief Apply symmetric Gauss-Seidel to AX=Y for a BsrMatrix A, with X and
+/// Y of <tt>A.numCols() * A.blockDim()</tt> and
+/// <tt>A.numRows() * A.blockDim()</tt> rows
+///
+/// See symmetric_block_gauss_seidel_apply for the parameters.
+///
+template <typename KernelHandle, typename BsrMatrixType,
+          typename x_scalar_view_t, typename y_scalar_view_t,
+          typename std::enable_if_t<is_bsr_matrix_v<BsrMatrixType>> * =
+              nullptr>
+void symmetric_gauss_seidel_apply(KernelHandle *handle, const BsrMatrixType &A,
+                                  x_scalar_view_t x_lhs_output_vec,
+                                  y_scalar_view_t y_rhs_input_vec,
+                                  bool init_zero_x_vector, bool update_y_vector,
+                                  typename KernelHandle::nnz_scalar_t omega,
+                                  int numIter) {
+  symmetric_block_gauss_seidel_apply<KokkosSparse::SparseMatrixFormat::BSR>(
+      handle, A.numRows(), A.numCols(), A.blockDim(), A.graph.row_map,
+      A.graph.entries, A.values, x_lhs_output_vec, y_rhs_input_vec,
+      init_zero_x_vector, update_y_vector, omega, numIter);
+}
+
+///
+/// @brief Apply forward Gauss-Seidel to AX=Y for a BsrMatrix A
+///
+/// See forward_sweep_block_gauss_seidel_apply for the parameters.
+///
+template <typename KernelHandle, typename BsrMatrixType,
+          typename x_scalar_view_t, typename y_scalar_view_t,
+          typename std::enable_if_t<is_bsr_matrix_v<BsrMatrixType>> * =
+              nullptr>
+void forward_sweep_gauss_seidel_apply(
+    KernelHandle *handle, const BsrMatrixType &A,
+    x_scalar_view_t x_lhs_output_vec, y_scalar_view_t y_rhs_input_vec,
+    bool init_zero_x_vector, bool update_y_vector,
+    typename KernelHandle::nnz_scalar_t omega, int numIter) {
+  forward_sweep_block_gauss_seidel_apply<KokkosSparse::SparseMatrixFormat::BSR>(
+      handle, A.numRows(), A.numCols(), A.blockDim(), A.graph.row_map,
+      A.graph.entries, A.values, x_lhs_output_vec, y_rhs_input_vec,
+      init_zero_x_vector, update_y_vector, omega, numIter);
+}
+
+///
+/// @brief Apply backward Gauss-Seidel to AX=Y for a BsrMatrix A
+///
+/// See backward_sweep_block_gauss_seidel_apply for the parameters.
+///
+template <typename KernelHandle, typename BsrMatrixType,
+          typename x_scalar_view_t, typename y_scalar_view_t,
+          typename std::enable_if_t<is_bsr_matrix_v<BsrMatrixType>> * =
+              nullptr>
+void backward_sweep_gauss_seidel_apply(
+    KernelHandle *handle, const BsrMatrixType &A,
+    x_scalar_view_t x_lhs_output_vec, y_scalar_view_t y_rhs_input_vec,
+    bool init_zero_x_vector, bool update_y_vector,
+    typename KernelHandle::nnz_scalar_t omega, int numIter) {
+  backward_sweep_block_gauss_seidel_apply<
+      KokkosSparse::SparseMatrixFormat::BSR>(
+      handle, A.numRows(), A.numCols(), A.blockDim(), A.graph.row_map,
+      A.graph.entries, A.values, x_lhs_output_vec, y_rhs_input_vec,
+      init_zero_x_vector, update_y_vector, omega, numIter);
+}
+
 }  // namespace Experimental
 }  // namespace KokkosSparse
 #endif
@@ -16,6 +16,7 @@
 
 #include <Kokkos_Core.hpp>
 #include <KokkosKernels_Utils.hpp>
+#include <KokkosKernels_Workspace.hpp>
 // needed for two-stage/classical GS
 #include <KokkosSparse_CrsMatrix.hpp>
 // needed for the set of available coloring algorithms
@@ -33,6 +34,8 @@ enum struct ClusteringAlgorithm {
   CLUSTER_DEFAULT,
   CLUSTER_MIS2,
   CLUSTER_BALLOON,
+  CLUSTER_HEC,
+  CLUSTER_MATCH,
   NUM_CLUSTERING_ALGORITHMS
 };
 
@@ -42,6 +45,10 @@ static constexpr ClusteringAlgorithm CLUSTER_MIS2 =
     ClusteringAlgorithm::CLUSTER_MIS2;
 static constexpr ClusteringAlgorithm CLUSTER_BALLOON =
     ClusteringAlgorithm::CLUSTER_BALLOON;
+static constexpr ClusteringAlgorithm CLUSTER_HEC =
+    ClusteringAlgorithm::CLUSTER_HEC;
+static constexpr ClusteringAlgorithm CLUSTER_MATCH =
+    ClusteringAlgorithm::CLUSTER_MATCH;
 static constexpr ClusteringAlgorithm NUM_CLUSTERING_ALGORITHMS =
     ClusteringAlgorithm::NUM_CLUSTERING_ALGORITHMS;
 
@@ -49,6 +56,8 @@ inline const char *getClusterAlgoName(ClusteringAlgorithm ca) {
   switch (ca) {
     case CLUSTER_BALLOON: return "Balloon";
     case CLUSTER_MIS2: return "MIS(2)";
+    case CLUSTER_HEC: return "HEC";
+    case CLUSTER_MATCH: return "Matching";
     default:;
   }
   return "INVALID CLUSTERING ALGORITHM";
@@ -92,6 +101,10 @@ class GaussSeidelHandle {
   typedef typename nnz_lno_persistent_work_view_t::HostMirror
       nnz_lno_persistent_work_host_view_t;  // Host view type
 
+  // The temporaries are passed to the functors as persistent views
+  typedef KokkosKernels::Experimental::Workspace<HandlePersistentMemorySpace>
+      workspace_t;
+
  protected:
   HandleExecSpace execution_space;
   int num_streams;
@@ -102,12 +115,19 @@ class GaussSeidelHandle {
   nnz_lno_persistent_work_view_t color_adj;
   nnz_lno_t numColors;
 
+  // Colors of the rows (of the clusters, for GS_CLUSTER) used by the symbolic
+  // phase. If given by the user, the symbolic phase does not color the graph.
+  nnz_lno_persistent_work_view_t vertex_colors;
+  bool given_vertex_colors;
+
   bool called_symbolic;
   bool called_numeric;
 
   int suggested_vector_size;
   int suggested_team_size;
 
+  workspace_t *workspace;  // Where the temporaries come from, if not null
+
  public:
   /**
    * \brief Default constructor.
@@ -119,10 +139,13 @@ class GaussSeidelHandle {
         color_xadj(),
         color_adj(),
         numColors(0),
+        vertex_colors(),
+        given_vertex_colors(false),
         called_symbolic(false),
         called_numeric(false),
         suggested_vector_size(0),
-        suggested_team_size(0) {}
+        suggested_team_size(0),
+        workspace(nullptr) {}
 
   GaussSeidelHandle(HandleExecSpace handle_exec_space, int n_streams,
                     GSAlgorithm gs)
@@ -132,10 +155,13 @@ class GaussSeidelHandle {
         color_xadj(),
         color_adj(),
         numColors(0),
+        vertex_colors(),
+        given_vertex_colors(false),
         called_symbolic(false),
         called_numeric(false),
         suggested_vector_size(0),
-        suggested_team_size(0) {}
+        suggested_team_size(0),
+        workspace(nullptr) {}
 
   virtual ~GaussSeidelHandle() = default;
 
@@ -154,9 +180,23 @@ class GaussSeidelHandle {
   }
   nnz_lno_t get_num_colors() const { return this->numColors; }
 
+  // The colors of the last symbolic phase, which can be passed to
+  // set_vertex_colors of another handle on the same graph
+  nnz_lno_persistent_work_view_t get_vertex_colors() const {
+    return this->vertex_colors;
+  }
+  bool has_given_vertex_colors() const { return this->given_vertex_colors; }
+
   bool is_symbolic_called() const { return this->called_symbolic; }
   bool is_numeric_called() const { return this->called_numeric; }
 
+  // With a workspace, point Gauss-Seidel draws the temporaries of its
+  // long-row symbolic phase, and the residual of the block apply, from its
+  // buffer instead of allocating them at each call. The handle does not own
+  // the workspace, which may be shared with other handles.
+  workspace_t *get_workspace() const { return this->workspace; }
+  void set_workspace(workspace_t *workspace_) { this->workspace = workspace_; }
+
   template <class ExecSpaceIn>
   void set_execution_space(const ExecSpaceIn exec_space_in) {
     static bool is_set = false;
@@ -193,6 +233,23 @@ class GaussSeidelHandle {
     this->numColors = numColors_;
   }
 
+  // Makes the symbolic phase use these colors (1 to num_colors) instead of
+  // coloring the graph, e.g. the colors of a GraphColoringHandle or of
+  // get_vertex_colors of another handle on the same graph. For GS_CLUSTER,
+  // these are colors of the clusters.
+  void set_vertex_colors(const nnz_lno_persistent_work_view_t &colors,
+                         nnz_lno_t num_colors) {
+    this->vertex_colors       = colors;
+    this->numColors           = num_colors;
+    this->given_vertex_colors = true;
+    this->called_symbolic     = false;
+  }
+  // Keeps the colors found by the symbolic phase
+  void set_computed_vertex_colors(
+      const nnz_lno_persistent_work_view_t &colors) {
+    this->vertex_colors = colors;
+  }
+
   void vector_team_size(int max_allowed_team_size,
                         int &suggested_vector_size_,  // output
                         int &suggested_team_size_,    // output
@@ -270,6 +327,12 @@ class PointGaussSeidelHandle
   scalar_persistent_work_view_t permuted_inverse_diagonal;
   nnz_lno_t block_size;  // this is for block sgs
 
+  // Option set by user: with block_size > 1, update each block row with the
+  // inverse of its dense diagonal block instead of point by point
+  bool block_inverse_diagonal;
+  // Inverses of the diagonal blocks, row-major, in the permuted order
+  scalar_persistent_work_view_t permuted_inverse_block_diagonal;
+
   nnz_lno_t num_values_in_l1, num_values_in_l2, num_big_rows;
   size_t level_1_mem, level_2_mem;
 
@@ -304,6 +367,8 @@ class PointGaussSeidelHandle
         permuted_x_vector(),
         permuted_inverse_diagonal(),
         block_size(1),
+        block_inverse_diagonal(false),
+        permuted_inverse_block_diagonal(),
         num_values_in_l1(-1),
         num_values_in_l2(-1),
         num_big_rows(0),
@@ -330,6 +395,13 @@ class PointGaussSeidelHandle
   void set_block_size(nnz_lno_t bs) { this->block_size = bs; }
   nnz_lno_t get_block_size() const { return this->block_size; }
 
+  void set_block_inverse_diagonal(bool use) {
+    this->block_inverse_diagonal = use;
+  }
+  bool get_block_inverse_diagonal() const {
+    return this->block_inverse_diagonal;
+  }
+
   void choose_default_algorithm() {
     if (KokkosKernels::Impl::kk_is_gpu_exec_space<ExecutionSpace>())
       this->algorithm_type = GS_TEAM;
@@ -394,6 +466,15 @@ class PointGaussSeidelHandle
     return this->permuted_inverse_diagonal;
   }
 
+  void set_permuted_inverse_block_diagonal(
+      const scalar_persistent_work_view_t permuted_inverse_block_diagonal_) {
+    this->permuted_inverse_block_diagonal = permuted_inverse_block_diagonal_;
+  }
+
+  scalar_persistent_work_view_t get_permuted_inverse_block_diagonal() const {
+    return this->permuted_inverse_block_diagonal;
+  }
+
   void set_level_1_mem(size_t _level_1_mem) {
     this->level_1_mem = _level_1_mem;
   }
@@ -666,6 +747,7 @@ class TwoStageGaussSeidelHandle
 
   using const_ordinal_t = typename const_entries_view_t::value_type;
   using const_scalar_t  = typename const_values_view_t::value_type;
+  using mag_t           = typename Kokkos::ArithTraits<scalar_t>::mag_type;
 
   using vector_view_t = Kokkos::View<scalar_t **, default_layout, device_t>;
 
@@ -689,7 +771,9 @@ class TwoStageGaussSeidelHandle
         two_stage(true),
         compact_form(false),
         num_inner_sweeps(1),
-        num_outer_sweeps(1) {
+        num_outer_sweeps(1),
+        inner_tol(0),
+        num_inner_sweeps_performed(0) {
     const scalar_t one(1.0);
     inner_omega = one;
   }
@@ -745,6 +829,19 @@ class TwoStageGaussSeidelHandle
   }
   scalar_t getInnerDampFactor() { return this->inner_omega; }
 
+  // Relative tolerance for the inner sweeps: when positive, the inner
+  // Jacobi-Richardson iteration stops as soon as the norm of the change in
+  // its iterate falls under inner_tol times the norm of its starting vector,
+  // so NumInnerSweeps becomes a maximum (zero keeps a fixed sweep count)
+  void setInnerTolerance(mag_t inner_tol_) { this->inner_tol = inner_tol_; }
+  mag_t getInnerTolerance() { return this->inner_tol; }
+
+  // Total number of inner sweeps run by the last apply
+  void setNumInnerSweepsPerformed(int num_inner_sweeps_performed_) {
+    this->num_inner_sweeps_performed = num_inner_sweeps_performed_;
+  }
+  int getNumInnerSweepsPerformed() { return this->num_inner_sweeps_performed; }
+
   // Workspaces
   // > diagonal (inverse)
   void setD(values_view_t D_) { this->D = D_; }
@@ -807,6 +904,8 @@ class TwoStageGaussSeidelHandle
   int num_inner_sweeps;
   int num_outer_sweeps;
   scalar_t inner_omega;
+  mag_t inner_tol;
+  int num_inner_sweeps_performed;
 };
 // -------------------------------------
 }  // namespace KokkosSparse
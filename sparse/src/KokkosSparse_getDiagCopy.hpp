@@ -64,6 +64,14 @@ void getDiagCopy(const DiagType& D, const OffsetsType& offsets,
   impl_type::getDiagCopy(D_internal, offsets_internal, A);
 }
 
+/// \brief Copy the diagonal of A into D, using the diagonal offsets cached
+///   in A (see CrsMatrix::diagOffsets). Only the first call for a given graph
+///   searches the rows; later calls are a single gather.
+template <class DiagType, class CrsMatrixType>
+void getDiagCopy(const DiagType& D, const CrsMatrixType& A) {
+  getDiagCopy(D, A.diagOffsets(), A);
+}
+
 }  // namespace KokkosSparse
 
 #endif  // KOKKOS_SPARSE_GETDIAGCOPY_HPP_
@@ -21,7 +21,8 @@
 ///
 /// This file provides KokkosSparse::gmres.  This function performs a
 /// local (no MPI) solve of Ax = b for sparse A. It is expected that A is in
-/// compressed row sparse ("Crs") format.
+/// compressed row sparse ("Crs") format, or blocked ("Bsr") format, or given
+/// as a matrix-free operator.
 ///
 /// This algorithm is described in the paper:
 /// GMRES - A Generalized Minimal Residual Algorithm for Solving Nonsymmetric
@@ -37,6 +38,8 @@
 #include "KokkosKernels_helpers.hpp"
 #include "KokkosKernels_Error.hpp"
 #include "KokkosSparse_gmres_spec.hpp"
+#include "KokkosSparse_gmres_impl.hpp"
+#include "KokkosSparse_gmres_async_impl.hpp"
 #include "KokkosSparse_Preconditioner.hpp"
 
 namespace KokkosSparse {
@@ -57,7 +60,10 @@ namespace Experimental {
 /// @param X
 /// @param precond
 template <typename KernelHandle, typename AMatrix, typename BType,
-          typename XType>
+          typename XType,
+          typename = std::enable_if_t<
+              KokkosSparse::is_crs_matrix<AMatrix>::value ||
+              KokkosSparse::Experimental::is_bsr_matrix<AMatrix>::value>>
 void gmres(KernelHandle* handle, AMatrix& A, BType& B, XType& X,
            Preconditioner<AMatrix>* precond = nullptr) {
   using scalar_type  = typename KernelHandle::nnz_scalar_t;
@@ -172,6 +178,10 @@ void gmres(KernelHandle* handle, AMatrix& A, BType& B, XType& X,
 
   Precond_Internal* precond_i = reinterpret_cast<Precond_Internal*>(precond);
 
+  KokkosKernels::Experimental::HandleTelemetry::Scope<
+      typename KernelHandle::HandleExecSpace>
+      telemetryScope(&handle->get_gmres_handle()->get_telemetry(), "solve",
+                     typename KernelHandle::HandleExecSpace());
   KokkosSparse::Impl::GMRES<const_handle_type,
                             typename AMatrix_Internal::value_type,
                             typename AMatrix_Internal::ordinal_type,
@@ -183,6 +193,187 @@ void gmres(KernelHandle* handle, AMatrix& A, BType& B, XType& X,
 
 }  // gmres
 
+/// @brief Matrix-free GMRES: A is any operator, rather than a CrsMatrix or
+/// BsrMatrix, with a const member
+///
+///   void apply(const Kokkos::View<const scalar_type*, device_type>& x,
+///              const Kokkos::View<scalar_type*, device_type>& y) const;
+///
+/// that overwrites y with A*x, where scalar_type is the nnz_scalar_t of the
+/// handle and device_type the device of B and X. apply runs on the default
+/// instance of the execution space, and must leave y complete for kernels
+/// enqueued after it there (as a KokkosSparse::spmv on the default instance
+/// would). The preconditioner is any Preconditioner on that device, for
+/// example a MatrixPrec of an assembled approximation of A. The s-step
+/// orthogonalization applies the operator s times instead of running the
+/// matrix powers kernel, and MGS applies it and then computes the first dot
+/// product instead of fusing the two.
+/// @tparam KernelHandle
+/// @tparam Operator
+/// @tparam BType
+/// @tparam XType
+/// @tparam PrecMatrix
+/// @param handle
+/// @param A
+/// @param B
+/// @param X
+/// @param precond
+template <typename KernelHandle, typename Operator, typename BType,
+          typename XType,
+          typename PrecMatrix = KokkosSparse::CrsMatrix<
+              typename KernelHandle::nnz_scalar_t,
+              typename KernelHandle::nnz_lno_t,
+              Kokkos::Device<
+                  typename KernelHandle::HandleExecSpace,
+                  typename KernelHandle::HandlePersistentMemorySpace>,
+              void, typename KernelHandle::size_type>,
+          typename = std::enable_if_t<
+              !KokkosSparse::is_crs_matrix<Operator>::value &&
+              !KokkosSparse::Experimental::is_bsr_matrix<Operator>::value>>
+void gmres(KernelHandle* handle, const Operator& A, BType& B, XType& X,
+           Preconditioner<PrecMatrix>* precond = nullptr) {
+  using scalar_type = typename KernelHandle::nnz_scalar_t;
+
+  static_assert(
+      KOKKOSKERNELS_GMRES_SAME_TYPE(typename BType::value_type, scalar_type),
+      "gmres: B scalar type must match KernelHandle entry "
+      "type (aka nnz_scalar_t, and const doesn't matter)");
+
+  static_assert(
+      KOKKOSKERNELS_GMRES_SAME_TYPE(typename XType::value_type, scalar_type),
+      "gmres: X scalar type must match KernelHandle entry "
+      "type (aka nnz_scalar_t, and const doesn't matter)");
+
+  static_assert(KOKKOSKERNELS_GMRES_SAME_TYPE(
+                    typename PrecMatrix::value_type, scalar_type),
+                "gmres: preconditioner scalar type must match KernelHandle "
+                "entry type (aka nnz_scalar_t, and const doesn't matter)");
+
+  static_assert(Kokkos::is_view<BType>::value,
+                "gmres: B is not a Kokkos::View.");
+  static_assert(Kokkos::is_view<XType>::value,
+                "gmres: X is not a Kokkos::View.");
+
+  static_assert(BType::rank == 1, "gmres: B must have rank 1");
+  static_assert(XType::rank == 1, "gmres: X must have rank 1");
+
+  static_assert(std::is_same<typename XType::value_type,
+                             typename XType::non_const_value_type>::value,
+                "gmres: The output X must be nonconst.");
+
+  static_assert(std::is_same<typename XType::device_type,
+                             typename BType::device_type>::value,
+                "gmres: X and B have different device types.");
+
+  if (X.extent(0) != B.extent(0)) {
+    std::ostringstream os;
+    os << "KokkosSparse::gmres: Dimensions do not match: "
+       << "x: " << X.extent(0) << ", b: " << B.extent(0);
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  auto gmres_handle = handle->get_gmres_handle();
+  using Gmres       = KokkosSparse::Impl::Experimental::GmresWrap<
+      typename std::remove_pointer<decltype(gmres_handle)>::type>;
+
+  KokkosKernels::Experimental::HandleTelemetry::Scope<
+      typename KernelHandle::HandleExecSpace>
+      telemetryScope(&gmres_handle->get_telemetry(), "solve",
+                     typename KernelHandle::HandleExecSpace());
+  Kokkos::Profiling::pushRegion("KokkosSparse::gmres[operator]");
+  Gmres::gmres(*gmres_handle, A, B, X, precond);
+  Kokkos::Profiling::popRegion();
+}  // gmres
+
+/// @brief GMRES with every kernel enqueued on the execution space instance
+/// space, so that independent solves on different instances can overlap.
+/// The Hessenberg matrix and the Givens rotations stay on the device, and
+/// the host only waits for the instance to read the shortcut residual every
+/// get_check_interval() iterations of the GMRES handle, and the true
+/// residual when it decides on convergence or restart. Only the CGS2
+/// orthogonalization (without flexible GMRES) is supported. A preconditioner
+/// is applied on its own execution space, with the instance fenced around
+/// it.
+/// @tparam ExecutionSpace
+/// @tparam KernelHandle
+/// @tparam AMatrix
+/// @tparam BType
+/// @tparam XType
+/// @param space
+/// @param handle
+/// @param A
+/// @param B
+/// @param X
+/// @param precond
+template <typename ExecutionSpace, typename KernelHandle, typename AMatrix,
+          typename BType, typename XType,
+          typename = std::enable_if_t<
+              Kokkos::is_execution_space<ExecutionSpace>::value>>
+void gmres(const ExecutionSpace& space, KernelHandle* handle, AMatrix& A,
+           BType& B, XType& X, Preconditioner<AMatrix>* precond = nullptr) {
+  using scalar_type = typename KernelHandle::nnz_scalar_t;
+
+  static_assert(
+      KOKKOSKERNELS_GMRES_SAME_TYPE(typename BType::value_type, scalar_type),
+      "gmres: B scalar type must match KernelHandle entry "
+      "type (aka nnz_scalar_t, and const doesn't matter)");
+
+  static_assert(
+      KOKKOSKERNELS_GMRES_SAME_TYPE(typename XType::value_type, scalar_type),
+      "gmres: X scalar type must match KernelHandle entry "
+      "type (aka nnz_scalar_t, and const doesn't matter)");
+
+  static_assert(
+      KOKKOSKERNELS_GMRES_SAME_TYPE(typename AMatrix::value_type, scalar_type),
+      "gmres: A scalar type must match KernelHandle entry "
+      "type (aka nnz_scalar_t, and const doesn't matter)");
+
+  static_assert(KokkosSparse::is_crs_matrix<AMatrix>::value ||
+                    KokkosSparse::Experimental::is_bsr_matrix<AMatrix>::value,
+                "gmres: A is not a CRS or BSR matrix.");
+  static_assert(Kokkos::is_view<BType>::value,
+                "gmres: B is not a Kokkos::View.");
+  static_assert(Kokkos::is_view<XType>::value,
+                "gmres: X is not a Kokkos::View.");
+
+  static_assert(BType::rank == 1, "gmres: B must have rank 1");
+  static_assert(XType::rank == 1, "gmres: X must have rank 1");
+
+  static_assert(std::is_same<typename XType::value_type,
+                             typename XType::non_const_value_type>::value,
+                "gmres: The output X must be nonconst.");
+
+  static_assert(std::is_same<typename AMatrix::device_type,
+                             typename BType::device_type>::value,
+                "gmres: A and B have different device types.");
+
+  static_assert(Kokkos::SpaceAccessibility<
+                    ExecutionSpace, typename AMatrix::memory_space>::accessible,
+                "gmres: A is not accessible from the execution space.");
+
+  if ((X.extent(0) != B.extent(0)) ||
+      (static_cast<size_t>(A.numPointCols()) !=
+       static_cast<size_t>(X.extent(0))) ||
+      (static_cast<size_t>(A.numPointRows()) !=
+       static_cast<size_t>(B.extent(0)))) {
+    std::ostringstream os;
+    os << "KokkosSparse::gmres: Dimensions do not match: "
+       << ", A: " << A.numRows() << " x " << A.numCols()
+       << ", x: " << X.extent(0) << ", b: " << B.extent(0);
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  auto gmres_handle = handle->get_gmres_handle();
+  using Gmres       = KokkosSparse::Impl::Experimental::GmresAsyncWrap<
+      typename std::remove_pointer<decltype(gmres_handle)>::type>;
+
+  KokkosKernels::Experimental::HandleTelemetry::Scope<ExecutionSpace>
+      telemetryScope(&gmres_handle->get_telemetry(), "solve", space);
+  Kokkos::Profiling::pushRegion("KokkosSparse::gmres[ASYNC]");
+  Gmres::gmres(space, *gmres_handle, A, B, X, precond);
+  Kokkos::Profiling::popRegion();
+}  // gmres
+
 }  // namespace Experimental
 }  // namespace KokkosSparse
 
@@ -18,6 +18,8 @@
 
 #include <Kokkos_Core.hpp>
 #include <KokkosSparse_Preconditioner.hpp>
+#include <KokkosKernels_HandleTelemetry.hpp>
+#include <KokkosKernels_Workspace.hpp>
 #include <iostream>
 #include <string>
 
@@ -44,6 +46,7 @@ class GMRESHandle {
   using execution_space = ExecutionSpace;
   using memory_space    = HandlePersistentMemorySpace;
   using device_t        = Kokkos::Device<execution_space, memory_space>;
+  using workspace_t     = KokkosKernels::Experimental::Workspace<memory_space>;
 
   using size_type       = typename std::remove_const<size_type_>::type;
   using const_size_type = const size_type;
@@ -77,9 +80,13 @@ class GMRESHandle {
    * The orthogonalization type
    */
   enum Ortho {
-    CGS2,  // Two iterations of Classical Gram-Schmidt
-    MGS
-  };  // One iteration of Modified Gram-Schmidt
+    CGS2,       // Two iterations of Classical Gram-Schmidt
+    MGS,        // One iteration of Modified Gram-Schmidt
+    PIPELINED,  // Pipelined Classical Gram-Schmidt (p(1)-GMRES): the
+                // reductions of an iteration overlap with the next spmv
+    SSTEP       // s-step: blocks of s vectors from the matrix powers kernel,
+                // orthogonalized together by block CGS2 and CholQR2
+  };
 
   /**
    * The result of the run
@@ -98,12 +105,18 @@ class GMRESHandle {
   float_t tol;            /// Relative residual convergence tolerance
   size_type max_restart;  /// Maximum number of times to restart the solver
   Ortho ortho;            /// The orthogonalization type
+  int s_step;             /// Block size of the SSTEP orthogonalization
+  bool flexible;          /// Flexible GMRES: the preconditioner may vary
+  int check_interval;     /// Iterations between residual checks (async)
   bool verbose;           /// Print extra info to stdout
 
   // Outputs
   int num_iters;        /// Number of iterations the sovler took
   float_t end_rel_res;  /// Residual from solver
   Flag conv_flag_val;   /// Denotes end result of the run
+  KokkosKernels::Experimental::HandleTelemetry
+      telemetry;           /// Calls and times of gmres ("solve"), once enabled
+  workspace_t *workspace;  /// Where the temporaries come from, if not null
 
  public:
   // Use set methods to control ortho, and verbose
@@ -113,10 +126,14 @@ class GMRESHandle {
         tol(tol_),
         max_restart(max_restart_),
         ortho(CGS2),
+        s_step(4),
+        flexible(false),
+        check_interval(1),
         verbose(false),
         num_iters(-1),
         end_rel_res(-1),
-        conv_flag_val(NotRun) {
+        conv_flag_val(NotRun),
+        workspace(nullptr) {
     if (m <= 0) {
       throw std::invalid_argument(
           "gmres: Please choose restart size m greater than zero.");
@@ -129,6 +146,9 @@ class GMRESHandle {
     set_tol(tol_);
     set_max_restart(max_restart_);
     set_ortho(CGS2);
+    set_s_step(4);
+    set_flexible(false);
+    set_check_interval(1);
     set_verbose(false);
     num_iters     = -1;
     end_rel_res   = -1;
@@ -164,12 +184,57 @@ class GMRESHandle {
   KOKKOS_INLINE_FUNCTION
   void set_ortho(const Ortho ortho_) { this->ortho = ortho_; }
 
+  /// With the SSTEP orthogonalization, the Krylov basis is built s vectors
+  /// at a time; m must be a multiple of s
+  KOKKOS_INLINE_FUNCTION
+  int get_s_step() const { return s_step; }
+
+  KOKKOS_INLINE_FUNCTION
+  void set_s_step(const int s_step_) { this->s_step = s_step_; }
+
+  /// Flexible GMRES (FGMRES) stores the preconditioned basis vectors M*V
+  /// and updates the solution with them, so the preconditioner may change
+  /// from one iteration to the next (e.g. an inner iterative solve). This
+  /// needs another n x m multivector and is only supported with the CGS2 and
+  /// MGS orthogonalizations.
+  KOKKOS_INLINE_FUNCTION
+  bool get_flexible() const { return flexible; }
+
+  KOKKOS_INLINE_FUNCTION
+  void set_flexible(const bool flexible_) { this->flexible = flexible_; }
+
+  /// The gmres overload taking an execution space instance keeps the
+  /// shortcut residual on the device and only reads it back every
+  /// check_interval iterations (and at the end of each cycle), so that the
+  /// host does not wait for the instance at every iteration. A solve may
+  /// then do up to check_interval - 1 more iterations than needed.
+  KOKKOS_INLINE_FUNCTION
+  int get_check_interval() const { return check_interval; }
+
+  KOKKOS_INLINE_FUNCTION
+  void set_check_interval(const int check_interval_) {
+    this->check_interval = check_interval_;
+  }
+
   KOKKOS_INLINE_FUNCTION
   bool get_verbose() const { return verbose; }
 
   KOKKOS_INLINE_FUNCTION
   void set_verbose(const bool verbose_) { this->verbose = verbose_; }
 
+  KokkosKernels::Experimental::HandleTelemetry &get_telemetry() {
+    return telemetry;
+  }
+
+  /// By default gmres allocates its temporaries (the n x (m + 1) basis and
+  /// a few vectors) at each call. With a workspace, which may be shared with
+  /// other handles, they are drawn from its buffer instead, so that a loop
+  /// of solves does not allocate once the buffer has grown. The handle does
+  /// not own the workspace; set it back to nullptr to allocate again.
+  workspace_t *get_workspace() const { return workspace; }
+
+  void set_workspace(workspace_t *workspace_) { this->workspace = workspace_; }
+
   int get_num_iters() const {
     assert(get_conv_flag_val() != NotRun);
     return num_iters;
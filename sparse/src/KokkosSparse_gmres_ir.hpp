@@ -0,0 +1,154 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+*/
+
+/// \file KokkosSparse_gmres_ir.hpp
+/// \brief Mixed-precision iterative refinement around GMRES
+///
+/// This file provides KokkosSparse::Experimental::gmres_ir, which solves
+/// Ax = b in the precision of A and x, while the correction equations
+/// A d = r are solved by KokkosSparse::Experimental::gmres in the (lower)
+/// precision of a copy of A, e.g. float for a double system. Only the
+/// residuals and solution updates are computed in the working precision, so
+/// the SpMV and orthogonalization traffic of the inner loop is halved. For
+/// a well-conditioned A, the solution still reaches working precision
+/// accuracy.
+
+#ifndef KOKKOSSPARSE_GMRES_IR_HPP_
+#define KOKKOSSPARSE_GMRES_IR_HPP_
+
+#include <iostream>
+#include <type_traits>
+
+#include "KokkosKernels_Error.hpp"
+#include "KokkosBlas1_axpby.hpp"
+#include "KokkosBlas1_nrm2.hpp"
+#include "KokkosSparse_spmv.hpp"
+#include "KokkosSparse_gmres.hpp"
+#include "KokkosSparse_Preconditioner.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+
+/// @brief Solve Ax = b by iterative refinement with a lower precision GMRES.
+///
+/// Each refinement step computes r = b - Ax in the precision of A, solves
+/// A_low d = r with gmres (restart size, inner tolerance, orthogonalization,
+/// ... are those of the GMRES handle of \c handle) and updates x += d. It
+/// stops when |b - Ax| / |b| <= tol, after max_refine steps, or when the
+/// residual stagnates. Afterwards, the GMRES handle holds the total number
+/// of inner iterations, the final relative residual (in the precision of
+/// the handle) and Conv or NoConv.
+///
+/// @tparam KernelHandle the handle type, with the scalar type of A_low
+/// @param handle [in/out] the handle with a GMRES handle for the inner solves
+/// @param A [in] the matrix, in the working precision
+/// @param A_low [in] A with the (lower precision) scalar type of handle,
+///   e.g. a CrsMatrix with the graph of A and its values converted
+/// @param B [in] the right-hand side
+/// @param X [in/out] the initial guess and the solution
+/// @param tol [in] the relative residual tolerance, in the working precision
+/// @param max_refine [in] the maximum number of refinement steps
+/// @param precond [in] an optional right preconditioner for A_low
+template <typename KernelHandle, typename AMatrix, typename ALowMatrix,
+          typename BType, typename XType>
+void gmres_ir(
+    KernelHandle* handle, AMatrix& A, ALowMatrix& A_low, BType& B, XType& X,
+    const typename Kokkos::ArithTraits<
+        typename XType::non_const_value_type>::mag_type tol,
+    const int max_refine = 20, Preconditioner<ALowMatrix>* precond = nullptr) {
+  using scalar_t     = typename XType::non_const_value_type;
+  using low_scalar_t = typename KernelHandle::nnz_scalar_t;
+  using mag_t        = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+  using device_t     = typename XType::device_type;
+  using vector_t     = Kokkos::View<scalar_t*, device_t>;
+  using low_vector_t = Kokkos::View<low_scalar_t*, device_t>;
+  using GMRESHandle  = typename KernelHandle::GMRESHandleType;
+  using low_mag_t    = typename GMRESHandle::float_t;
+
+  static_assert(std::is_same<typename AMatrix::non_const_value_type,
+                             scalar_t>::value,
+                "gmres_ir: A and X must have the same scalar type");
+  static_assert(std::is_same<typename ALowMatrix::non_const_value_type,
+                             low_scalar_t>::value,
+                "gmres_ir: A_low scalar type must match KernelHandle entry "
+                "type (aka nnz_scalar_t)");
+  static_assert(XType::rank == 1 && BType::rank == 1,
+                "gmres_ir: B and X must have rank 1");
+  static_assert(std::is_same<typename XType::value_type, scalar_t>::value,
+                "gmres_ir: The output X must be nonconst.");
+  static_assert(std::is_same<typename AMatrix::device_type, device_t>::value &&
+                    std::is_same<typename BType::device_type, device_t>::value,
+                "gmres_ir: A, B and X have different device types.");
+
+  GMRESHandle* gmres_handle = handle->get_gmres_handle();
+  KK_REQUIRE_MSG(gmres_handle != nullptr,
+                 "gmres_ir: call create_gmres_handle on the handle first");
+  KK_REQUIRE_MSG(A_low.numRows() == A.numRows() &&
+                     A_low.numCols() == A.numCols(),
+                 "gmres_ir: A and A_low have different dimensions");
+
+  const scalar_t one  = Kokkos::ArithTraits<scalar_t>::one();
+  const auto n        = X.extent(0);
+  const bool verbose  = gmres_handle->get_verbose();
+  const mag_t nrmB    = KokkosBlas::nrm2(B);
+  const mag_t nrmBinv = nrmB > mag_t(0) ? mag_t(1) / nrmB : mag_t(1);
+
+  vector_t R(Kokkos::view_alloc(Kokkos::WithoutInitializing, "gmres_ir::R"),
+             n);
+  low_vector_t RLow(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "gmres_ir::RLow"), n);
+  low_vector_t DLow("gmres_ir::DLow", n);
+
+  // r = b - A x
+  Kokkos::deep_copy(R, B);
+  KokkosSparse::spmv("N", -one, A, X, one, R);
+  mag_t res = KokkosBlas::nrm2(R) * nrmBinv;
+
+  int num_iters = 0;
+  for (int k = 0; k < max_refine && res > tol; k++) {
+    // Correction in low precision: A_low d = r
+    Kokkos::deep_copy(RLow, R);
+    Kokkos::deep_copy(DLow, Kokkos::ArithTraits<low_scalar_t>::zero());
+    KokkosSparse::Experimental::gmres(handle, A_low, RLow, DLow, precond);
+    num_iters += gmres_handle->get_num_iters();
+
+    // x += d and r = b - A x in working precision
+    Kokkos::deep_copy(R, DLow);
+    KokkosBlas::axpy(one, R, X);
+    Kokkos::deep_copy(R, B);
+    KokkosSparse::spmv("N", -one, A, X, one, R);
+    const mag_t prev_res = res;
+    res                  = KokkosBlas::nrm2(R) * nrmBinv;
+
+    if (verbose) {
+      std::cout << "gmres_ir: refinement " << k + 1 << ", " << num_iters
+                << " inner iterations, relative residual " << res
+                << std::endl;
+    }
+    if (!(res < prev_res)) break;  // The inner solves no longer help
+  }
+
+  gmres_handle->set_stats(
+      num_iters, static_cast<low_mag_t>(res),
+      res <= tol ? GMRESHandle::Flag::Conv : GMRESHandle::Flag::NoConv);
+}  // gmres_ir
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_GMRES_IR_HPP_
@@ -0,0 +1,288 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file
+/// \brief Kronecker product of two sparse matrices, built explicitly
+///   (KokkosSparse::kron) or applied without forming it
+///   (KokkosSparse::Experimental::KronOperator).
+
+#ifndef KOKKOSSPARSE_KRON_HPP_
+#define KOKKOSSPARSE_KRON_HPP_
+
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "Kokkos_Core.hpp"
+#include "KokkosKernels_Error.hpp"
+#include "KokkosKernels_SimpleUtils.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_spmv.hpp"
+#include "KokkosSparse_kron_impl.hpp"
+
+namespace KokkosSparse {
+
+// clang-format off
+/// \brief Build the Kronecker product C = A (x) B, where
+///   C(i * B.numRows() + k, j * B.numCols() + l) = A(i, j) * B(k, l).
+///
+/// The rows of C are counted, then filled, in parallel on space. The columns
+/// of each row of C are sorted if those of A and B are.
+///
+/// \tparam ExecutionSpace A Kokkos execution space. Must be able to access
+///   the memory spaces of A and B.
+/// \tparam AMatrix A specialization of KokkosSparse::CrsMatrix.
+/// \tparam BMatrix A specialization of KokkosSparse::CrsMatrix, in the same
+///   memory space as AMatrix.
+///
+/// \param space [in] The execution space instance on which to run the
+///   kernels.
+/// \param A [in] The left factor.
+/// \param B [in] The right factor.
+/// \return C, with the value, ordinal, offset and device types of A.
+///   Throws std::invalid_argument if the dimensions or the number of entries
+///   of C do not fit in those types.
+// clang-format on
+template <class ExecutionSpace, class AMatrix, class BMatrix>
+CrsMatrix<typename AMatrix::non_const_value_type,
+          typename AMatrix::non_const_ordinal_type,
+          typename AMatrix::device_type, void,
+          typename AMatrix::non_const_size_type>
+kron(const ExecutionSpace& space, const AMatrix& A, const BMatrix& B) {
+  static_assert(is_crs_matrix_v<AMatrix> && is_crs_matrix_v<BMatrix>,
+                "KokkosSparse::kron: A and B must be CrsMatrix");
+  static_assert(std::is_same_v<typename AMatrix::memory_space,
+                               typename BMatrix::memory_space>,
+                "KokkosSparse::kron: A and B must be in the same memory space");
+  using crsMat_t =
+      CrsMatrix<typename AMatrix::non_const_value_type,
+                typename AMatrix::non_const_ordinal_type,
+                typename AMatrix::device_type, void,
+                typename AMatrix::non_const_size_type>;
+  using size_type = typename crsMat_t::non_const_size_type;
+  using lno_t     = typename crsMat_t::non_const_ordinal_type;
+  using rowmap_t  = typename crsMat_t::row_map_type::non_const_type;
+  using entries_t = typename crsMat_t::index_type::non_const_type;
+  using values_t  = typename crsMat_t::values_type::non_const_type;
+  using functor_t =
+      Impl::KronFunctor<AMatrix, BMatrix, rowmap_t, entries_t, values_t>;
+  using count_pol = Kokkos::RangePolicy<ExecutionSpace,
+                                        typename functor_t::CountTag, int64_t>;
+  using fill_pol =
+      Kokkos::RangePolicy<ExecutionSpace, typename functor_t::FillTag, int64_t>;
+
+  // Each product fits in int64_t since the factors fit in 32-bit or smaller
+  // ordinals, or their product of nonzeros would not fit in memory anyway
+  const int64_t nrows = int64_t(A.numRows()) * int64_t(B.numRows());
+  const int64_t ncols = int64_t(A.numCols()) * int64_t(B.numCols());
+  const int64_t nnz   = int64_t(A.nnz()) * int64_t(B.nnz());
+  if (nrows > int64_t(std::numeric_limits<lno_t>::max()) ||
+      ncols > int64_t(std::numeric_limits<lno_t>::max()) ||
+      uint64_t(nnz) > uint64_t(std::numeric_limits<size_type>::max())) {
+    std::ostringstream os;
+    os << "KokkosSparse::kron: the product (" << nrows << " x " << ncols
+       << " with " << nnz << " entries) does not fit in the ordinal or "
+       << "offset type of the matrix.";
+    throw std::invalid_argument(os.str());
+  }
+
+  functor_t f;
+  f.A      = A;
+  f.B      = B;
+  f.rowmap = rowmap_t("kron rowmap", nrows + 1);
+  Kokkos::parallel_for("KokkosSparse::kron::count", count_pol(space, 0, nrows),
+                       f);
+  size_type total = 0;
+  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum(space, nrows + 1,
+                                                        f.rowmap, total);
+  f.entries = entries_t(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "kron entries"), total);
+  f.values = values_t(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "kron values"), total);
+  Kokkos::parallel_for("KokkosSparse::kron::fill", fill_pol(space, 0, nrows),
+                       f);
+  return crsMat_t("kron", lno_t(nrows), lno_t(ncols), total, f.values,
+                  f.rowmap, f.entries);
+}
+
+/// \brief Build the Kronecker product C = A (x) B on the default instance of
+///   A's execution space. See the overload taking an execution space
+///   instance for details.
+template <class AMatrix, class BMatrix>
+auto kron(const AMatrix& A, const BMatrix& B) {
+  return kron(typename AMatrix::execution_space(), A, B);
+}
+
+namespace Experimental {
+
+// clang-format off
+/// \class KronOperator
+/// \brief The Kronecker product A (x) B of two CrsMatrix, applied to vectors
+///   without forming it.
+///
+/// With x viewed as the row-major matrix X with op(A).numCols() rows and
+/// op(B).numCols() columns, op(A (x) B) x is the row-major vector of
+/// op(A) X op(B)^T. apply() computes it as two SpMM: op(A) times X, then
+/// op(B) times the transpose of the result (or the other way around,
+/// whichever moves fewer entries of A and B). The only storage besides A and
+/// B is one intermediate multivector, of op(A).numRows() * op(B).numCols() or
+/// op(A).numCols() * op(B).numRows() entries, kept in the operator between
+/// calls. This is far smaller than A (x) B, which has A.nnz() * B.nnz()
+/// entries.
+///
+/// \tparam AMatrix A specialization of KokkosSparse::CrsMatrix.
+/// \tparam BMatrix A specialization of KokkosSparse::CrsMatrix, in the same
+///   memory space as AMatrix.
+///
+/// \warning Since the intermediate multivector is shared, calls to apply()
+///   with the same operator must not run concurrently on different execution
+///   space instances.
+// clang-format on
+template <class AMatrix, class BMatrix>
+class KronOperator {
+  static_assert(is_crs_matrix_v<AMatrix> && is_crs_matrix_v<BMatrix>,
+                "KronOperator: A and B must be CrsMatrix");
+  static_assert(std::is_same_v<typename AMatrix::memory_space,
+                               typename BMatrix::memory_space>,
+                "KronOperator: A and B must be in the same memory space");
+
+ public:
+  using value_type   = typename AMatrix::non_const_value_type;
+  using ordinal_type = int64_t;
+  using device_type  = typename AMatrix::device_type;
+  using work_type    = Kokkos::View<value_type*, device_type>;
+
+  KronOperator(const AMatrix& A_, const BMatrix& B_) : A(A_), B(B_) {}
+
+  //! Number of rows of A (x) B
+  ordinal_type numRows() const {
+    return ordinal_type(A.numRows()) * ordinal_type(B.numRows());
+  }
+
+  //! Number of columns of A (x) B
+  ordinal_type numCols() const {
+    return ordinal_type(A.numCols()) * ordinal_type(B.numCols());
+  }
+
+  //! Number of entries of A (x) B, which are never stored
+  ordinal_type nnz() const {
+    return ordinal_type(A.nnz()) * ordinal_type(B.nnz());
+  }
+
+  //! Bytes used by the intermediate multivector kept between calls
+  size_t workspace_bytes() const { return work.span() * sizeof(value_type); }
+
+  // clang-format off
+  /// \brief y := alpha * op(A (x) B) x + beta * y, where op is selected by
+  ///   mode ("N", "C", "T" or "H", as for KokkosSparse::spmv).
+  ///
+  /// \param space [in] The execution space instance on which to run the
+  ///   kernels.
+  /// \param x [in] A contiguous rank-1 View in the memory space of A, with
+  ///   op(A (x) B).numCols() entries.
+  /// \param y [in/out] A contiguous rank-1 View in the memory space of A, with
+  ///   op(A (x) B).numRows() entries.
+  // clang-format on
+  template <class ExecutionSpace, class XVector, class YVector>
+  void apply(const ExecutionSpace& space, const char mode[],
+             const value_type& alpha, const XVector& x,
+             const value_type& beta, const YVector& y) {
+    static_assert(Kokkos::is_view<XVector>::value && XVector::rank() == 1,
+                  "KronOperator::apply: x must be a rank-1 View");
+    static_assert(Kokkos::is_view<YVector>::value && YVector::rank() == 1,
+                  "KronOperator::apply: y must be a rank-1 View");
+    using x_scalar    = typename XVector::const_value_type;
+    using y_scalar    = typename YVector::value_type;
+    using LL          = Kokkos::LayoutLeft;
+    using LR          = Kokkos::LayoutRight;
+    using unmanaged_t = Kokkos::MemoryTraits<Kokkos::Unmanaged>;
+    const bool trans = mode[0] == 'T' || mode[0] == 'H';
+    // Dimensions of op(A) and op(B)
+    const int64_t mA = trans ? A.numCols() : A.numRows();
+    const int64_t nA = trans ? A.numRows() : A.numCols();
+    const int64_t mB = trans ? B.numCols() : B.numRows();
+    const int64_t nB = trans ? B.numRows() : B.numCols();
+    if (int64_t(x.extent(0)) != nA * nB || int64_t(y.extent(0)) != mA * mB ||
+        !x.span_is_contiguous() || !y.span_is_contiguous()) {
+      std::ostringstream os;
+      os << "KronOperator::apply: x (" << x.extent(0) << ") and y ("
+         << y.extent(0) << ") must be contiguous with " << nA * nB << " and "
+         << mA * mB << " entries in mode " << mode;
+      KokkosKernels::Impl::throw_runtime_exception(os.str());
+    }
+    if (mA * mB == 0) return;
+
+    // Apply A first if it touches fewer entries: op(A) reads all of its
+    // entries once per column of X, and op(B) once per row of op(A) X
+    const double a_first = double(A.nnz()) * nB + double(B.nnz()) * mA;
+    const double b_first = double(B.nnz()) * nA + double(A.nnz()) * mB;
+    if (a_first <= b_first) {
+      // W = op(A) X, then Y^T = op(B) W^T
+      if (int64_t(work.extent(0)) < mA * nB)
+        work = work_type(Kokkos::view_alloc(Kokkos::WithoutInitializing,
+                                            "KronOperator work"),
+                         mA * nB);
+      Kokkos::View<x_scalar**, LR, device_type, unmanaged_t> X(x.data(), nA,
+                                                               nB);
+      Kokkos::View<value_type**, LR, device_type, unmanaged_t> W(work.data(),
+                                                                 mA, nB);
+      Kokkos::View<const value_type**, LL, device_type, unmanaged_t> Wt(
+          work.data(), nB, mA);
+      Kokkos::View<y_scalar**, LL, device_type, unmanaged_t> Yt(y.data(), mB,
+                                                                mA);
+      KokkosSparse::spmv(space, mode, value_type(1), A, X, value_type(0), W);
+      KokkosSparse::spmv(space, mode, alpha, B, Wt, beta, Yt);
+    } else {
+      // Wt = op(B) X^T, then Y = op(A) W
+      if (int64_t(work.extent(0)) < mB * nA)
+        work = work_type(Kokkos::view_alloc(Kokkos::WithoutInitializing,
+                                            "KronOperator work"),
+                         mB * nA);
+      Kokkos::View<x_scalar**, LL, device_type, unmanaged_t> Xt(x.data(), nB,
+                                                                nA);
+      Kokkos::View<value_type**, LL, device_type, unmanaged_t> Wt(
+          work.data(), mB, nA);
+      Kokkos::View<const value_type**, LR, device_type, unmanaged_t> W(
+          work.data(), nA, mB);
+      Kokkos::View<y_scalar**, LR, device_type, unmanaged_t> Y(y.data(), mA,
+                                                               mB);
+      KokkosSparse::spmv(space, mode, value_type(1), B, Xt, value_type(0), Wt);
+      KokkosSparse::spmv(space, mode, alpha, A, W, beta, Y);
+    }
+  }
+
+  /// \brief y := alpha * op(A (x) B) x + beta * y on the default instance of
+  ///   A's execution space. See the overload taking an execution space
+  ///   instance for details.
+  template <class XVector, class YVector>
+  void apply(const char mode[], const value_type& alpha, const XVector& x,
+             const value_type& beta, const YVector& y) {
+    apply(typename AMatrix::execution_space(), mode, alpha, x, beta, y);
+  }
+
+ private:
+  AMatrix A;
+  BMatrix B;
+  work_type work;
+};
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_KRON_HPP_
@@ -0,0 +1,139 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file KokkosSparse_lobpcg.hpp
+/// \brief Extremal eigenpairs of a sparse symmetric matrix
+///
+/// This file provides KokkosSparse::Experimental::lobpcg. This function
+/// computes the k smallest or largest eigenvalues of a sparse symmetric
+/// matrix A and their eigenvectors with the locally optimal block
+/// preconditioned conjugate gradient method (Knyazev, 2001). Every
+/// iteration multiplies A by a block of 2k vectors with the multivector
+/// spmv, orthonormalizes a basis of 3k vectors with TSQR and solves a
+/// 3k-by-3k dense symmetric eigenproblem on the device.
+
+#ifndef KOKKOSSPARSE_LOBPCG_HPP_
+#define KOKKOSSPARSE_LOBPCG_HPP_
+
+#include <sstream>
+#include <type_traits>
+
+#include <Kokkos_ArithTraits.hpp>
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_Preconditioner.hpp"
+#include "KokkosSparse_lobpcg_impl.hpp"
+#include "KokkosKernels_Error.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+
+// clang-format off
+/// \brief Compute the k smallest (or largest) eigenpairs A X = X diag(lambda)
+/// of the sparse symmetric matrix A.
+///
+/// \tparam ExecutionSpace the space where the kernel will run.
+/// \tparam AMatrix A specialization of KokkosSparse::CrsMatrix.
+/// \tparam XMatrix (Nxk) matrix as a rank-2 Kokkos::View.
+/// \tparam EVector k vector as a rank-1 Kokkos::View of the magnitude type.
+///
+/// \param space [in] execution space instance used for the kernels.
+/// \param A [in] the N-by-N symmetric matrix, N must be at least 3k.
+/// \param X [in/out] on entry an initial guess of full rank, for instance
+///   random, on exit the orthonormal eigenvectors.
+/// \param lambda [out] the eigenvalues in ascending order.
+/// \param largest [in] whether to compute the largest eigenvalues instead
+///   of the smallest.
+/// \param tol [in] an eigenpair is converged when its residual
+///   ||A x - lambda x|| is at most tol times the largest |lambda|.
+/// \param max_iters [in] maximum number of iterations.
+/// \param precond [in] optional symmetric positive definite preconditioner,
+///   applied to the residuals, for instance an approximate inverse of A
+///   for the smallest eigenvalues.
+///
+/// \return the number of iterations, or -1 if the k eigenpairs did not all
+///   converge in max_iters iterations, X and lambda then hold the current
+///   Ritz pairs.
+///
+/// \note Only real scalar types are supported, as for tsqr.
+///
+// clang-format on
+template <class ExecutionSpace, class AMatrix, class XMatrix, class EVector,
+          typename = std::enable_if_t<
+              Kokkos::is_execution_space<ExecutionSpace>::value>>
+int lobpcg(const ExecutionSpace& space, const AMatrix& A, const XMatrix& X,
+           const EVector& lambda, const bool largest = false,
+           const typename EVector::non_const_value_type tol = 1e-6,
+           const int max_iters = 500,
+           Preconditioner<AMatrix>* precond = nullptr) {
+  static_assert(is_crs_matrix_v<AMatrix>,
+                "KokkosSparse::lobpcg: A must be a KokkosSparse::CrsMatrix.");
+  static_assert(Kokkos::is_view_v<XMatrix> && XMatrix::rank == 2,
+                "KokkosSparse::lobpcg: X must be a rank-2 Kokkos::View.");
+  static_assert(Kokkos::is_view_v<EVector> && EVector::rank == 1,
+                "KokkosSparse::lobpcg: lambda must be a rank-1 Kokkos::View.");
+  static_assert(
+      !Kokkos::ArithTraits<typename XMatrix::non_const_value_type>::is_complex,
+      "KokkosSparse::lobpcg: only real scalar types are supported.");
+  static_assert(std::is_same_v<typename EVector::non_const_value_type,
+                               typename XMatrix::non_const_value_type>,
+                "KokkosSparse::lobpcg: lambda and X have different scalar "
+                "types.");
+  static_assert(
+      Kokkos::SpaceAccessibility<ExecutionSpace,
+                                 typename AMatrix::memory_space>::accessible);
+  static_assert(
+      Kokkos::SpaceAccessibility<ExecutionSpace,
+                                 typename XMatrix::memory_space>::accessible);
+
+  const int n = X.extent_int(0);
+  const int k = X.extent_int(1);
+  if ((A.numRows() != n) || (A.numCols() != n) ||
+      (lambda.extent_int(0) != k) || (k < 1) || (n < 3 * k) ||
+      (max_iters < 0)) {
+    std::ostringstream os;
+    os << "KokkosSparse::lobpcg: expected a square A, an N-by-k X with "
+       << "1 <= k <= N / 3, lambda of extent k and a non-negative max_iters,"
+       << " A: " << A.numRows() << " x " << A.numCols() << ", X: " << n
+       << " x " << k << ", lambda: " << lambda.extent(0)
+       << ", max_iters = " << max_iters;
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  Kokkos::Profiling::pushRegion("KokkosSparse::lobpcg");
+  const int iters = KokkosSparse::Impl::lobpcg_native(
+      space, A, X, lambda, largest, tol, max_iters, precond);
+  Kokkos::Profiling::popRegion();
+  return iters;
+}
+
+// clang-format off
+/// \brief Compute the k smallest (or largest) eigenpairs A X = X diag(lambda)
+/// of the sparse symmetric matrix A.
+// clang-format on
+template <class AMatrix, class XMatrix, class EVector>
+int lobpcg(const AMatrix& A, const XMatrix& X, const EVector& lambda,
+           const bool largest = false,
+           const typename EVector::non_const_value_type tol = 1e-6,
+           const int max_iters = 500,
+           Preconditioner<AMatrix>* precond = nullptr) {
+  typename AMatrix::execution_space space{};
+  return lobpcg(space, A, X, lambda, largest, tol, max_iters, precond);
+}
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_LOBPCG_HPP_
@@ -0,0 +1,189 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file
+/// \brief Matrix powers kernel: compute [x, Ax, A^2 x, ..., A^s x]
+///
+
+#ifndef KOKKOSSPARSE_MATRIX_POWERS_HPP_
+#define KOKKOSSPARSE_MATRIX_POWERS_HPP_
+
+#include <sstream>
+#include <type_traits>
+#include "KokkosKernels_Error.hpp"
+#include "KokkosKernels_ExecSpaceUtils.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_spmv.hpp"
+#include "KokkosSparse_matrix_powers_impl.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+
+// clang-format off
+/// \class MatrixPowersHandle
+/// \brief Handle for KokkosSparse::Experimental::matrix_powers. It stores the
+///   row dependency structure (ghost zones) of each block of rows of A, which
+///   is computed by the first call.
+///
+/// \tparam ExecutionSpace The execution space where matrix_powers will run.
+/// \tparam AMatrix A specialization of KokkosSparse::CrsMatrix.
+///
+/// \warning All calls to matrix_powers with a given handle must use the same
+///   matrix structure (the values may change).
+// clang-format on
+template <class ExecutionSpace, class AMatrix>
+struct MatrixPowersHandle {
+  static_assert(is_crs_matrix_v<AMatrix>,
+                "MatrixPowersHandle: AMatrix must be a CrsMatrix");
+  using ExecutionSpaceType = ExecutionSpace;
+  using AMatrixType        = AMatrix;
+  using ordinal_type       = typename AMatrix::non_const_ordinal_type;
+  using size_type          = typename AMatrix::non_const_size_type;
+  using memory_space       = typename AMatrix::memory_space;
+  using ordinals_t         = Kokkos::View<ordinal_type*, memory_space>;
+  using offsets_t          = Kokkos::View<size_type*, memory_space>;
+  using level_counts_t     = Kokkos::View<ordinal_type**, memory_space>;
+
+  /// \brief Create a handle.
+  /// \param s_ [in] The highest power of A to compute.
+  /// \param rows_per_block_ [in] The number of rows owned by each block. The
+  ///   rows of a block and its ghost zones should fit in cache.
+  MatrixPowersHandle(int s_, ordinal_type rows_per_block_ = 1024)
+      : s(s_), rows_per_block(rows_per_block_) {
+    if (s < 0 || rows_per_block <= 0) {
+      std::ostringstream os;
+      os << "MatrixPowersHandle: s (" << s << ") must be non-negative and "
+         << "rows_per_block (" << rows_per_block << ") must be positive";
+      throw std::invalid_argument(os.str());
+    }
+  }
+
+  //! The highest power of A computed by matrix_powers
+  int get_s() const { return s; }
+
+  //! Whether the row dependency structure has been computed
+  bool is_setup() const { return is_set_up; }
+
+  //! The average number of rows (owned and ghost) of a block per owned row.
+  //! This is the redundant work of the kernel. Only valid once is_setup().
+  double get_ghost_ratio() const {
+    if (!is_set_up || num_blocks == 0) return 1.0;
+    auto last = Kokkos::subview(block_offsets, num_blocks);
+    size_type total;
+    Kokkos::deep_copy(total, last);
+    ordinal_type nrows = 0;
+    auto owned         = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), Kokkos::subview(level_counts, Kokkos::ALL(), s));
+    for (ordinal_type b = 0; b < num_blocks; b++) nrows += owned(b);
+    return double(total) / nrows;
+  }
+
+  int s;
+  ordinal_type rows_per_block;
+  bool is_set_up          = false;
+  ordinal_type num_blocks = 0;
+  //! Number of local rows of each block needed for A^k x, k = 0..s
+  level_counts_t level_counts;
+  //! Offsets of each block in local_rows
+  offsets_t block_offsets;
+  //! Rows of A of each block: owned rows first, then ghost rows by level
+  ordinals_t local_rows;
+  //! Row map of the local rows, with column indices local to the block
+  offsets_t local_rowmap;
+  ordinals_t local_entries;
+  //! Index in A.values of each local entry
+  offsets_t value_index;
+};
+
+// clang-format off
+/// \brief Matrix powers kernel: V(:, k) := A^k x for k = 0, 1, ..., s.
+///
+/// This is the building block of communication-avoiding (s-step) Krylov
+/// methods. The rows of A are split into blocks, and each block computes all
+/// powers for its rows before moving on, so the rows of A it reads stay in
+/// cache across the powers instead of being streamed from memory s times.
+/// To do that without synchronizing between powers, each block redundantly
+/// computes the lower powers on the ghost rows it depends on
+/// (see MatrixPowersHandle::get_ghost_ratio()).
+///
+/// On GPUs, where the rows of A do not stay in cache across kernels anyway,
+/// this is s calls to KokkosSparse::spmv.
+///
+/// \tparam ExecutionSpace A Kokkos execution space. Must be able to access
+///   the memory spaces of A, x, and V.
+/// \tparam Handle Specialization of KokkosSparse::Experimental::MatrixPowersHandle
+/// \tparam AMatrix A square KokkosSparse::CrsMatrix.
+/// \tparam XVector Type of x, must be a rank-1 Kokkos::View.
+/// \tparam VMultiVector Type of V, must be a rank-2 Kokkos::View.
+///
+/// \param space [in] The execution space instance on which to run the
+///   kernels.
+/// \param handle [in/out] a pointer to a MatrixPowersHandle.
+/// \param A [in] The matrix.
+/// \param x [in] The starting vector.
+/// \param V [out] A multivector with A.numRows() rows and s + 1 columns.
+// clang-format on
+template <class ExecutionSpace, class Handle, class AMatrix, class XVector,
+          class VMultiVector>
+void matrix_powers(const ExecutionSpace& space, Handle* handle,
+                   const AMatrix& A, const XVector& x, const VMultiVector& V) {
+  static_assert(is_crs_matrix_v<AMatrix>,
+                "KokkosSparse::matrix_powers: AMatrix must be a CrsMatrix");
+  static_assert(Kokkos::is_view<XVector>::value && XVector::rank() == 1,
+                "KokkosSparse::matrix_powers: x must be a rank-1 View");
+  static_assert(Kokkos::is_view<VMultiVector>::value &&
+                    VMultiVector::rank() == 2,
+                "KokkosSparse::matrix_powers: V must be a rank-2 View");
+  static_assert(!std::is_const_v<typename VMultiVector::value_type>,
+                "KokkosSparse::matrix_powers: V must be non-const.");
+
+  if (A.numRows() != A.numCols() || x.extent(0) != size_t(A.numCols()) ||
+      V.extent(0) != size_t(A.numRows()) ||
+      V.extent(1) != size_t(handle->s + 1)) {
+    std::ostringstream os;
+    os << "KokkosSparse::matrix_powers: Dimensions do not match: "
+       << "A: " << A.numRows() << " x " << A.numCols()
+       << ", x: " << x.extent(0) << ", V: " << V.extent(0) << " x "
+       << V.extent(1) << " (expected " << handle->s + 1 << " columns)";
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  if constexpr (KokkosKernels::Impl::kk_is_gpu_exec_space<ExecutionSpace>()) {
+    using v_value_type = typename VMultiVector::non_const_value_type;
+    Kokkos::deep_copy(space, Kokkos::subview(V, Kokkos::ALL(), 0), x);
+    for (int k = 1; k <= handle->s; k++) {
+      KokkosSparse::spmv(space, "N", v_value_type(1), A,
+                         Kokkos::subview(V, Kokkos::ALL(), k - 1),
+                         v_value_type(0), Kokkos::subview(V, Kokkos::ALL(), k));
+    }
+  } else {
+    if (!handle->is_set_up) Impl::matrix_powers_setup(handle, A);
+    Impl::matrix_powers_blocked(space, handle, A, x, V);
+  }
+}
+
+/// \brief Matrix powers kernel: V(:, k) := A^k x for k = 0, 1, ..., s.
+///   See the overload taking an execution space instance for details.
+template <class Handle, class AMatrix, class XVector, class VMultiVector>
+void matrix_powers(Handle* handle, const AMatrix& A, const XVector& x,
+                   const VMultiVector& V) {
+  matrix_powers(typename Handle::ExecutionSpaceType(), handle, A, x, V);
+}
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_MATRIX_POWERS_HPP_
@@ -96,6 +96,11 @@ void mdf_numeric(const crs_matrix_type& A, MDF_handle& handle) {
   using permutation_set_type =
       Kokkos::UnorderedMap<ordinal_type, void, device_type>;
 
+  if (handle.independent_set) {
+    KokkosSparse::Impl::mdf_numeric_independent_set(A, handle);
+    return;
+  }
+
   // Numerical phase:
   // loop over rows
   //   compute discarded fill of each row
@@ -103,8 +108,8 @@ void mdf_numeric(const crs_matrix_type& A, MDF_handle& handle) {
   //   factorize pivot row of A
   const int verbosity_level = handle.verbosity;
   crs_matrix_type Atmp      = crs_matrix_type("A fill", A);
-  crs_matrix_type At = KokkosSparse::Impl::transpose_matrix<crs_matrix_type>(A);
-  KokkosSparse::sort_crs_matrix<crs_matrix_type>(At);
+  crs_matrix_type At =
+      KokkosSparse::Impl::sorted_transpose_matrix<crs_matrix_type>(A);
   values_mag_type discarded_fill("discarded fill", A.numRows());
   col_ind_type deficiency("deficiency", A.numRows());
   ordinal_type update_list_len = 0;
@@ -222,6 +227,8 @@ void mdf_numeric(const crs_matrix_type& A, MDF_handle& handle) {
 
   handle.L = KokkosSparse::Impl::transpose_matrix<crs_matrix_type>(handle.L);
 
+  handle.num_steps = A.numRows();
+
   return;
 }  // mdf_numeric
 
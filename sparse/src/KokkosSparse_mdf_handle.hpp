@@ -60,6 +60,11 @@ struct MDF_handle {
 
   int verbosity = 0;
 
+  // Eliminate an independent set of rows at each step of mdf_numeric,
+  // instead of a single row, and the number of steps that it took.
+  bool independent_set   = false;
+  ordinal_type num_steps = 0;
+
   crs_matrix_type L, U;
 
   MDF_handle(const crs_matrix_type& A)
@@ -70,6 +75,20 @@ struct MDF_handle {
 
   void set_verbosity(const int verbosity_level) { verbosity = verbosity_level; }
 
+  /// With enable = true, each step of mdf_numeric eliminates all the
+  /// remaining rows whose discarded fill is smaller than that of their
+  /// remaining neighbors, instead of only the row with the smallest discarded
+  /// fill. These rows are independent, so they are eliminated in parallel,
+  /// and the number of steps is typically much smaller than the number of
+  /// rows. The ordering differs from the sequential MDF, but L and U are
+  /// still the incomplete LU(0) factors of A in that ordering.
+  void set_independent_set_elimination(const bool enable) {
+    independent_set = enable;
+  }
+
+  /// Number of elimination steps taken by the last mdf_numeric.
+  ordinal_type get_num_elimination_steps() const { return num_steps; }
+
   void allocate_data(const size_type nnzL, const size_type nnzU) {
     // Allocate L
     row_mapL = row_map_type("row map L", numRows + 1);
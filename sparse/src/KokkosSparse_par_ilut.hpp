@@ -28,6 +28,16 @@
 /// max_iters is hit or the improvement in the residual from iter to iter drops
 /// below a certain threshold.
 ///
+/// For a sequence of matrices with the same sparsity pattern and slowly
+/// changing values, the handle's warm_start flag makes each par_ilut_numeric
+/// after the first continue from the L and U it is given, which must be the
+/// output of the previous call, for at most warm_start_max_iter iterations.
+///
+/// par_ilut_numeric also accepts L and U values of a lower precision than the
+/// handle's scalar type (e.g. float factors of a double matrix): the
+/// iterations run in the working precision, and the factors are rounded at
+/// the end.
+///
 /// This algorithm is described in the paper:
 /// PARILUT - A New Parallel Threshold ILU Factorization - Anzt, Chow, Dongarra
 
@@ -57,11 +67,13 @@ namespace Experimental {
 /// dealing with multiple matrices with the same sparsity pattern. This routine
 /// will set some values on handle for symbolic info (row count, nnz counts).
 ///
+/// @tparam ExecSpace Template for the execution space instance type
 /// @tparam KernelHandle Template for the KernelHandle type
 /// @tparam ARowMapType Template for A_rowmap type
 /// @tparam AEntriesType Template for A_entries type
 /// @tparam LRowMapType Template for L_rowmap type
 /// @tparam URowMapType Template for U_rowmap type
+/// @param space The execution space instance the kernels are run on
 /// @param handle The kernel handle. It is expected that create_par_ilut_handle
 /// has been called on it
 /// @param A_rowmap The row map (row nnz offsets) for the A CSR (Input)
@@ -70,11 +82,11 @@ namespace Experimental {
 /// (numRows+1) (Output)
 /// @param U_rowmap The row map for the U CSR, should already be sized correctly
 /// (numRows+1) (Output)
-template <typename KernelHandle, typename ARowMapType, typename AEntriesType,
-          typename LRowMapType, typename URowMapType>
-void par_ilut_symbolic(KernelHandle* handle, ARowMapType& A_rowmap,
-                       AEntriesType& A_entries, LRowMapType& L_rowmap,
-                       URowMapType& U_rowmap) {
+template <typename ExecSpace, typename KernelHandle, typename ARowMapType,
+          typename AEntriesType, typename LRowMapType, typename URowMapType>
+void par_ilut_symbolic(const ExecSpace& space, KernelHandle* handle,
+                       ARowMapType& A_rowmap, AEntriesType& A_entries,
+                       LRowMapType& L_rowmap, URowMapType& U_rowmap) {
   using size_type    = typename KernelHandle::size_type;
   using ordinal_type = typename KernelHandle::nnz_lno_t;
 
@@ -140,6 +152,11 @@ void par_ilut_symbolic(KernelHandle* handle, ARowMapType& A_rowmap,
       "par_ilut_symbolic: KernelHandle and Views have different execution "
       "spaces.");
 
+  static_assert(
+      std::is_same<ExecSpace, typename KernelHandle::HandleExecSpace>::value,
+      "par_ilut_symbolic: ExecSpace must match the KernelHandle execution "
+      "space.");
+
   if (A_rowmap.extent(0) != 0) {
     KK_REQUIRE_MSG(A_rowmap.extent(0) == L_rowmap.extent(0),
                    "L row map size does not match A row map");
@@ -193,9 +210,20 @@ void par_ilut_symbolic(KernelHandle* handle, ARowMapType& A_rowmap,
 
   KokkosSparse::Impl::PAR_ILUT_SYMBOLIC<
       const_handle_type, ARowMap_Internal, AEntries_Internal, LRowMap_Internal,
-      URowMap_Internal>::par_ilut_symbolic(&tmp_handle, A_rowmap_i, A_entries_i,
-                                           L_rowmap_i, U_rowmap_i);
+      URowMap_Internal>::par_ilut_symbolic(space, &tmp_handle, A_rowmap_i,
+                                           A_entries_i, L_rowmap_i, U_rowmap_i);
+
+}  // par_ilut_symbolic
 
+/// @brief Performs the symbolic phase of par_ilut on the default instance of
+/// the KernelHandle execution space. See the overload above.
+template <typename KernelHandle, typename ARowMapType, typename AEntriesType,
+          typename LRowMapType, typename URowMapType>
+void par_ilut_symbolic(KernelHandle* handle, ARowMapType& A_rowmap,
+                       AEntriesType& A_entries, LRowMapType& L_rowmap,
+                       URowMapType& U_rowmap) {
+  par_ilut_symbolic(typename KernelHandle::HandleExecSpace(), handle, A_rowmap,
+                    A_entries, L_rowmap, U_rowmap);
 }  // par_ilut_symbolic
 
 /// @brief Performs the numeric phase (for specific CSRs, not reusable) of the
@@ -205,6 +233,7 @@ void par_ilut_symbolic(KernelHandle* handle, ARowMapType& A_rowmap,
 ///        called for the
 //         provided KernelHandle.
 ///
+/// @tparam ExecSpace Template for the execution space instance type
 /// @tparam KernelHandle Template for the handle type
 /// @tparam ARowMapType Template for the A_rowmap type
 /// @tparam AEntriesType Template for the A_entries type
@@ -215,6 +244,7 @@ void par_ilut_symbolic(KernelHandle* handle, ARowMapType& A_rowmap,
 /// @tparam URowMapType Template for the U_rowmap type
 /// @tparam UEntriesType Template for the U_entries type
 /// @tparam UValuesType Template for the U_values type
+/// @param space The execution space instance the kernels are run on
 /// @param handle The kernel handle. It is expected that create_par_ilut_handle
 /// has been called on it
 /// @param A_rowmap The row map (row nnz offsets) for the A CSR (Input)
@@ -226,15 +256,16 @@ void par_ilut_symbolic(KernelHandle* handle, ARowMapType& A_rowmap,
 /// @param U_rowmap The row map (row nnz offsets) for the U CSR (Input/Output)
 /// @param U_entries The entries (column ids) for the U CSR (Output)
 /// @param U_values The values (non-zero matrix values) for the U CSR (Output)
-template <typename KernelHandle, typename ARowMapType, typename AEntriesType,
-          typename AValuesType, typename LRowMapType, typename LEntriesType,
-          typename LValuesType, typename URowMapType, typename UEntriesType,
-          typename UValuesType>
-void par_ilut_numeric(KernelHandle* handle, ARowMapType& A_rowmap,
-                      AEntriesType& A_entries, AValuesType& A_values,
-                      LRowMapType& L_rowmap, LEntriesType& L_entries,
-                      LValuesType& L_values, URowMapType& U_rowmap,
-                      UEntriesType& U_entries, UValuesType& U_values) {
+template <typename ExecSpace, typename KernelHandle, typename ARowMapType,
+          typename AEntriesType, typename AValuesType, typename LRowMapType,
+          typename LEntriesType, typename LValuesType, typename URowMapType,
+          typename UEntriesType, typename UValuesType>
+void par_ilut_numeric(const ExecSpace& space, KernelHandle* handle,
+                      ARowMapType& A_rowmap, AEntriesType& A_entries,
+                      AValuesType& A_values, LRowMapType& L_rowmap,
+                      LEntriesType& L_entries, LValuesType& L_values,
+                      URowMapType& U_rowmap, UEntriesType& U_entries,
+                      UValuesType& U_values) {
   using size_type    = typename KernelHandle::size_type;
   using ordinal_type = typename KernelHandle::nnz_lno_t;
   using scalar_type  = typename KernelHandle::nnz_scalar_t;
@@ -262,10 +293,11 @@ void par_ilut_numeric(KernelHandle* handle, ARowMapType& A_rowmap,
                     typename LEntriesType::non_const_value_type, ordinal_type),
                 "par_ilut_numeric: L entry type must match KernelHandle entry "
                 "type (aka nnz_lno_t, and const doesn't matter)");
-  static_assert(KOKKOSKERNELS_PAR_ILUT_SAME_TYPE(
-                    typename LValuesType::value_type, scalar_type),
+  static_assert(KokkosKernels::Impl::is_same_or_lower_precision_v<
+                    typename LValuesType::value_type, scalar_type>,
                 "par_ilut_numeric: L scalar type must match KernelHandle entry "
-                "type (aka nnz_scalar_t, and const doesn't matter)");
+                "type (aka nnz_scalar_t), or be a lower precision of it "
+                "(const doesn't matter)");
 
   static_assert(
       KOKKOSKERNELS_PAR_ILUT_SAME_TYPE(
@@ -276,10 +308,11 @@ void par_ilut_numeric(KernelHandle* handle, ARowMapType& A_rowmap,
                     typename UEntriesType::non_const_value_type, ordinal_type),
                 "par_ilut_numeric: U entry type must match KernelHandle entry "
                 "type (aka nnz_lno_t, and const doesn't matter)");
-  static_assert(KOKKOSKERNELS_PAR_ILUT_SAME_TYPE(
-                    typename UValuesType::value_type, scalar_type),
+  static_assert(KokkosKernels::Impl::is_same_or_lower_precision_v<
+                    typename UValuesType::value_type, scalar_type>,
                 "par_ilut_numeric: U scalar type must match KernelHandle entry "
-                "type (aka nnz_scalar_t, and const doesn't matter)");
+                "type (aka nnz_scalar_t), or be a lower precision of it "
+                "(const doesn't matter)");
 
   static_assert(Kokkos::is_view<ARowMapType>::value,
                 "par_ilut_numeric: A_rowmap is not a Kokkos::View.");
@@ -399,6 +432,11 @@ void par_ilut_numeric(KernelHandle* handle, ARowMapType& A_rowmap,
                    typename LValuesType::device_type>::value,
       "par_ilut_numeric: rowmap and values have different device types.");
 
+  static_assert(
+      std::is_same<ExecSpace, typename KernelHandle::HandleExecSpace>::value,
+      "par_ilut_numeric: ExecSpace must match the KernelHandle execution "
+      "space.");
+
   // Check if symbolic has been called
   if (handle->get_par_ilut_handle()->is_symbolic_complete() == false) {
     std::ostringstream os;
@@ -413,6 +451,31 @@ void par_ilut_numeric(KernelHandle* handle, ARowMapType& A_rowmap,
   KK_REQUIRE_MSG(KokkosSparse::Impl::isCrsGraphSorted(U_rowmap, U_entries),
                  "U is not sorted");
 
+  // L and U stored in a lower precision: iterate in the working precision,
+  // from the given factors for a warm start, then round the factors
+  if constexpr (!KOKKOSKERNELS_PAR_ILUT_SAME_TYPE(
+                    typename LValuesType::value_type, scalar_type) ||
+                !KOKKOSKERNELS_PAR_ILUT_SAME_TYPE(
+                    typename UValuesType::value_type, scalar_type)) {
+    using work_values_t =
+        Kokkos::View<scalar_type*, typename LValuesType::device_type>;
+    work_values_t L_work(Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                                            "par_ilut L_work"),
+                         L_values.extent(0));
+    work_values_t U_work(Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                                            "par_ilut U_work"),
+                         U_values.extent(0));
+    Kokkos::deep_copy(space, L_work, L_values);
+    Kokkos::deep_copy(space, U_work, U_values);
+    par_ilut_numeric(space, handle, A_rowmap, A_entries, A_values, L_rowmap,
+                     L_entries, L_work, U_rowmap, U_entries, U_work);
+    Kokkos::resize(space, L_values, L_work.extent(0));
+    Kokkos::resize(space, U_values, U_work.extent(0));
+    Kokkos::deep_copy(space, L_values, L_work);
+    Kokkos::deep_copy(space, U_values, U_work);
+    return;
+  }
+
   using c_size_t   = typename KernelHandle::const_size_type;
   using c_lno_t    = typename KernelHandle::const_nnz_lno_t;
   using c_scalar_t = typename KernelHandle::const_nnz_scalar_t;
@@ -497,7 +560,8 @@ void par_ilut_numeric(KernelHandle* handle, ARowMapType& A_rowmap,
   KokkosSparse::Impl::PAR_ILUT_NUMERIC<
       const_handle_type, ARowMap_Internal, AEntries_Internal, AValues_Internal,
       LRowMap_Internal, LEntries_Internal, LValues_Internal, URowMap_Internal,
-      UEntries_Internal, UValues_Internal>::par_ilut_numeric(&tmp_handle,
+      UEntries_Internal, UValues_Internal>::par_ilut_numeric(space,
+                                                             &tmp_handle,
                                                              A_rowmap_i,
                                                              A_entries_i,
                                                              A_values_i,
@@ -516,6 +580,22 @@ void par_ilut_numeric(KernelHandle* handle, ARowMapType& A_rowmap,
 
 }  // par_ilut_numeric
 
+/// @brief Performs the numeric phase of par_ilut on the default instance of
+/// the KernelHandle execution space. See the overload above.
+template <typename KernelHandle, typename ARowMapType, typename AEntriesType,
+          typename AValuesType, typename LRowMapType, typename LEntriesType,
+          typename LValuesType, typename URowMapType, typename UEntriesType,
+          typename UValuesType>
+void par_ilut_numeric(KernelHandle* handle, ARowMapType& A_rowmap,
+                      AEntriesType& A_entries, AValuesType& A_values,
+                      LRowMapType& L_rowmap, LEntriesType& L_entries,
+                      LValuesType& L_values, URowMapType& U_rowmap,
+                      UEntriesType& U_entries, UValuesType& U_values) {
+  par_ilut_numeric(typename KernelHandle::HandleExecSpace(), handle, A_rowmap,
+                   A_entries, A_values, L_rowmap, L_entries, L_values,
+                   U_rowmap, U_entries, U_values);
+}  // par_ilut_numeric
+
 }  // namespace Experimental
 }  // namespace KokkosSparse
 
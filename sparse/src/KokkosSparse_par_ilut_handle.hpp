@@ -16,7 +16,9 @@
 
 #include <Kokkos_Core.hpp>
 #include <iostream>
+#include <stdexcept>
 #include <string>
+#include "KokkosKernels_PlanIO.hpp"
 
 #ifndef _PAR_ILUTHANDLE_HPP
 #define _PAR_ILUTHANDLE_HPP
@@ -89,6 +91,13 @@ class PAR_ILUTHandle {
                       /// updates. When ON, the algorithm will usually converge
                       /// faster but it makes the algorithm non-deterministic.
   bool verbose;       /// Print information while executing par_ilut
+  bool warm_start;    /// Whether numeric starts from the L and U passed in,
+                      /// the factors of the previous numeric call, instead of
+                      /// from the L and U parts of A. For a sequence of
+                      /// matrices with the same pattern and slowly changing
+                      /// values, a few iterations are then enough.
+  size_type warm_start_max_iter;  /// Cap on the number of iterations of a
+                                  /// warm-started numeric
 
   // Stored by parent KokkosKernelsHandle
   int team_size;    /// Kokkos team size. Set by the parent handle. -1 implies
@@ -104,6 +113,10 @@ class PAR_ILUTHandle {
                    /// given to the symbolic par_ilut
   bool symbolic_complete;  /// Whether symbolic par_ilut has been called
 
+  // Stored by numeric phase
+  bool numeric_complete;  /// Whether numeric par_ilut has been called since
+                          /// the last symbolic, so L and U hold factors
+
   // Outputs
   int num_iters;  /// The number of iterations par_ilut took to finish
   nnz_scalar_t end_rel_res;  /// The A - LU residual norm at the time the
@@ -121,12 +134,15 @@ class PAR_ILUTHandle {
         fill_in_limit(fill_in_limit_),
         async_update(async_update_),
         verbose(verbose_),
+        warm_start(false),
+        warm_start_max_iter(2),
         team_size(-1),
         vector_size(-1),
         nrows(0),
         nnzL(0),
         nnzU(0),
         symbolic_complete(false),
+        numeric_complete(false),
         num_iters(-1),
         end_rel_res(-1) {}
 
@@ -156,6 +172,11 @@ class PAR_ILUTHandle {
   void set_symbolic_complete() { this->symbolic_complete = true; }
   void reset_symbolic_complete() { this->symbolic_complete = false; }
 
+  bool is_numeric_complete() const { return numeric_complete; }
+
+  void set_numeric_complete() { this->numeric_complete = true; }
+  void reset_numeric_complete() { this->numeric_complete = false; }
+
   void set_team_size(const int ts) { this->team_size = ts; }
   int get_team_size() const { return this->team_size; }
 
@@ -187,11 +208,63 @@ class PAR_ILUTHandle {
     this->async_update = async_update_;
   }
 
+  bool get_warm_start() const { return warm_start; }
+
+  void set_warm_start(const bool warm_start_) {
+    this->warm_start = warm_start_;
+  }
+
+  size_type get_warm_start_max_iter() const { return warm_start_max_iter; }
+
+  void set_warm_start_max_iter(const size_type warm_start_max_iter_) {
+    this->warm_start_max_iter = warm_start_max_iter_;
+  }
+
+  /// \brief Save the data computed by par_ilut_symbolic, for load() to
+  /// restore later instead of calling par_ilut_symbolic again.
+  ///
+  /// L_row_map and U_row_map are the row maps computed by
+  /// par_ilut_symbolic.
+  template <class LRowMapType, class URowMapType>
+  void save(std::ostream &os, const LRowMapType &L_row_map,
+            const URowMapType &U_row_map) const {
+    if (!symbolic_complete)
+      throw std::runtime_error(
+          "PAR_ILUTHandle::save: par_ilut_symbolic has not been called");
+    using namespace KokkosKernels::Impl;
+    write_plan_header(os, "PAR_ILUTHandle");
+    write_plan_value(os, nrows);
+    write_plan_value(os, nnzL);
+    write_plan_value(os, nnzU);
+    write_plan_view(os, L_row_map);
+    write_plan_view(os, U_row_map);
+  }
+
+  /// \brief Restore the data written by save() into this handle and into
+  /// L_row_map and U_row_map. par_ilut_numeric can then be called directly.
+  template <class LRowMapType, class URowMapType>
+  void load(std::istream &is, LRowMapType &L_row_map,
+            URowMapType &U_row_map) {
+    using namespace KokkosKernels::Impl;
+    read_plan_header(is, "PAR_ILUTHandle");
+    nrows = read_plan_value<size_type>(is);
+    nnzL  = read_plan_value<size_type>(is);
+    nnzU  = read_plan_value<size_type>(is);
+    read_plan_view(is, L_row_map);
+    read_plan_view(is, U_row_map);
+    set_symbolic_complete();
+    reset_numeric_complete();
+  }
+
   TeamPolicy get_default_team_policy() const {
+    return get_default_team_policy(execution_space());
+  }
+
+  TeamPolicy get_default_team_policy(const execution_space &exec) const {
     if (team_size == -1) {
-      return TeamPolicy(nrows, Kokkos::AUTO);
+      return TeamPolicy(exec, nrows, Kokkos::AUTO);
     } else {
-      return TeamPolicy(nrows, team_size);
+      return TeamPolicy(exec, nrows, team_size);
     }
   }
 
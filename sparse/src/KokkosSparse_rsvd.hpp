@@ -0,0 +1,121 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file
+/// \brief Randomized truncated SVD of a sparse matrix
+///
+
+#ifndef KOKKOSSPARSE_RSVD_HPP_
+#define KOKKOSSPARSE_RSVD_HPP_
+
+#include <type_traits>
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_spmv.hpp"
+#include "KokkosLapack_rsvd.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+
+namespace Impl {
+// Operator applying a CrsMatrix with KokkosSparse::spmv. The products with
+// A^T are as frequent as the ones with A, so the handle caches an explicit
+// transpose which is applied with the faster non-transposed kernels.
+template <class ExecutionSpace, class AMatrix, class MultiVector>
+struct RsvdCrsOperator {
+  using const_vector =
+      Kokkos::View<typename MultiVector::const_value_type**,
+                   typename MultiVector::array_layout,
+                   typename MultiVector::device_type,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+  using vector = Kokkos::View<typename MultiVector::non_const_value_type**,
+                              typename MultiVector::array_layout,
+                              typename MultiVector::device_type,
+                              Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+  using handle_type =
+      KokkosSparse::SPMVHandle<ExecutionSpace, AMatrix, const_vector, vector>;
+
+  AMatrix A;
+  mutable handle_type handle;
+
+  RsvdCrsOperator(const AMatrix& A_) : A(A_) { handle.cache_transpose = true; }
+
+  int num_rows() const { return A.numRows(); }
+  int num_cols() const { return A.numCols(); }
+
+  template <class XMatrix, class YMatrix>
+  void apply(const ExecutionSpace& space, const char trans[],
+             const XMatrix& X, const YMatrix& Y) const {
+    using scalar_type = typename YMatrix::non_const_value_type;
+    const_vector X_i = X;
+    vector Y_i       = Y;
+    KokkosSparse::spmv(space, &handle, trans, scalar_type(1), A, X_i,
+                       scalar_type(0), Y_i);
+  }
+};
+}  // namespace Impl
+
+// clang-format off
+/// \brief Estimate the k leading singular triplets A ~ U * diag(S) * Vt of
+/// the sparse matrix A.
+///
+/// This is KokkosLapack::Experimental::rsvd with the products by A and A^T
+/// computed by KokkosSparse::spmv, see KokkosLapack_rsvd.hpp for the
+/// description of the algorithm and of its parameters.
+///
+/// \tparam ExecutionSpace the space where the kernel will run.
+/// \tparam AMatrix A specialization of KokkosSparse::CrsMatrix.
+/// \tparam SVector k vector as a rank-1 Kokkos::View.
+/// \tparam UMatrix (Mxk) matrix as a rank-2 Kokkos::View.
+/// \tparam VMatrix (kxN) matrix as a rank-2 Kokkos::View.
+///
+/// \note Only real scalar types are supported.
+///
+// clang-format on
+template <class ExecutionSpace, class AMatrix, class SVector, class UMatrix,
+          class VMatrix>
+void rsvd(const ExecutionSpace& space, const AMatrix& A, const int k,
+          const int oversample, const int power_iters, const SVector& S,
+          const UMatrix& U, const VMatrix& Vt, const uint64_t seed = 12371) {
+  static_assert(is_crs_matrix_v<AMatrix>,
+                "KokkosSparse::rsvd: A must be a KokkosSparse::CrsMatrix.");
+  static_assert(
+      Kokkos::SpaceAccessibility<ExecutionSpace,
+                                 typename AMatrix::memory_space>::accessible);
+
+  using multivector_type =
+      Kokkos::View<typename UMatrix::non_const_value_type**,
+                   Kokkos::LayoutLeft, typename UMatrix::device_type>;
+  Impl::RsvdCrsOperator<ExecutionSpace, AMatrix, multivector_type> op(A);
+  KokkosLapack::Experimental::Impl::rsvd_operator(space, op, k, oversample,
+                                                  power_iters, S, U, Vt, seed);
+}
+
+// clang-format off
+/// \brief Estimate the k leading singular triplets A ~ U * diag(S) * Vt of
+/// the sparse matrix A.
+// clang-format on
+template <class AMatrix, class SVector, class UMatrix, class VMatrix>
+void rsvd(const AMatrix& A, const int k, const int oversample,
+          const int power_iters, const SVector& S, const UMatrix& U,
+          const VMatrix& Vt, const uint64_t seed = 12371) {
+  typename AMatrix::execution_space space{};
+  rsvd(space, A, k, oversample, power_iters, S, U, Vt, seed);
+}
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_RSVD_HPP_
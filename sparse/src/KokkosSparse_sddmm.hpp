@@ -0,0 +1,142 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file
+/// \brief Sampled dense-dense matrix multiply (SDDMM)
+///
+
+#ifndef KOKKOSSPARSE_SDDMM_HPP_
+#define KOKKOSSPARSE_SDDMM_HPP_
+
+#include <sstream>
+#include <type_traits>
+#include "KokkosKernels_Error.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_sddmm_impl.hpp"
+#include "KokkosSparse_sddmm_tpl_spec_avail.hpp"
+#include "KokkosSparse_sddmm_tpl_spec_decl.hpp"
+
+namespace KokkosSparse {
+
+// clang-format off
+/// \brief Sampled dense-dense matrix multiply: C := S .* (A * B^T), computed
+///   only at the entries of the sparse matrix S:
+///   C(i, j) = S(i, j) * sum over l of A(i, l) * B(j, l).
+///
+/// The dense product A * B^T is never formed. This is the gradient and
+/// attention kernel of graph neural networks, and the residual of low-rank
+/// factorizations at the observed entries; it pairs with spmv on a
+/// multivector (SpMM). B^T is a plain transpose, also for complex values.
+///
+/// With cuSPARSE 11.3.1 or newer enabled, float, double and complex values
+/// with int ordinals and offsets, and LayoutLeft or LayoutRight A and B of
+/// the value type of S, go to cusparseSDDMM; other cases use the native
+/// kernel, in which each thread takes a row of S and the vector lanes
+/// split the dot products.
+///
+/// \tparam ExecutionSpace A Kokkos execution space, which can access S, A,
+///   B and C.
+/// \tparam SMatrix A KokkosSparse::CrsMatrix.
+/// \tparam AView A rank-2 Kokkos::View.
+/// \tparam BView A rank-2 Kokkos::View.
+/// \tparam CMatrix A KokkosSparse::CrsMatrix with non-const values.
+///
+/// \param space [in] The execution space instance on which to run.
+/// \param S [in] The sampling matrix, m x n.
+/// \param A [in] The left dense matrix, m x k.
+/// \param B [in] The right dense matrix, n x k.
+/// \param C [in/out] A matrix with the pattern of S (for example, built from
+///   the row map and entries of S), whose values are overwritten. C may
+///   share the values of S.
+// clang-format on
+template <class ExecutionSpace, class SMatrix, class AView, class BView,
+          class CMatrix,
+          typename = std::enable_if_t<
+              Kokkos::is_execution_space<ExecutionSpace>::value>>
+void sddmm(const ExecutionSpace& space, const SMatrix& S, const AView& A,
+           const BView& B, const CMatrix& C) {
+  static_assert(is_crs_matrix_v<SMatrix> && is_crs_matrix_v<CMatrix>,
+                "KokkosSparse::sddmm: S and C must be CrsMatrix");
+  static_assert(Kokkos::is_view<AView>::value && Kokkos::is_view<BView>::value,
+                "KokkosSparse::sddmm: A and B must be Kokkos::Views");
+  static_assert(AView::rank() == 2 && BView::rank() == 2,
+                "KokkosSparse::sddmm: A and B must have rank 2");
+  static_assert(
+      std::is_same_v<typename CMatrix::value_type,
+                     typename CMatrix::non_const_value_type>,
+      "KokkosSparse::sddmm: C must have non-const values");
+
+  if ((size_t)S.numRows() != A.extent(0) ||
+      (size_t)S.numCols() != B.extent(0) || A.extent(1) != B.extent(1) ||
+      C.numRows() != S.numRows() || C.numCols() != S.numCols() ||
+      (size_t)C.nnz() != (size_t)S.nnz()) {
+    std::ostringstream os;
+    os << "KokkosSparse::sddmm: Dimensions do not match: "
+       << "S: " << S.numRows() << " x " << S.numCols() << " (" << S.nnz()
+       << " entries), A: " << A.extent(0) << " x " << A.extent(1)
+       << ", B: " << B.extent(0) << " x " << B.extent(1)
+       << ", C: " << C.numRows() << " x " << C.numCols() << " (" << C.nnz()
+       << " entries)";
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  using scalar_type      = typename CMatrix::non_const_value_type;
+  using SMatrix_Internal = CrsMatrix<
+      typename SMatrix::const_value_type, typename SMatrix::const_ordinal_type,
+      typename SMatrix::device_type, Kokkos::MemoryTraits<Kokkos::Unmanaged>,
+      typename SMatrix::const_size_type>;
+  using CValues_Internal =
+      Kokkos::View<scalar_type*, typename CMatrix::device_type,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+  SMatrix_Internal S_i(S);
+  CValues_Internal C_i(C.values);
+  if (S.nnz() == 0) return;
+
+#ifdef KOKKOSSPARSE_SDDMM_CUSPARSE
+  constexpr bool tpl_avail =
+      Impl::sddmm_tpl_spec_avail<
+          ExecutionSpace, scalar_type, typename SMatrix::non_const_ordinal_type,
+          typename SMatrix::non_const_size_type,
+          typename CMatrix::memory_space>::value &&
+      std::is_same_v<typename SMatrix::non_const_value_type, scalar_type> &&
+      std::is_same_v<typename AView::non_const_value_type, scalar_type> &&
+      std::is_same_v<typename BView::non_const_value_type, scalar_type> &&
+      (std::is_same_v<typename AView::array_layout, Kokkos::LayoutLeft> ||
+       std::is_same_v<typename AView::array_layout, Kokkos::LayoutRight>) &&
+      (std::is_same_v<typename BView::array_layout, Kokkos::LayoutLeft> ||
+       std::is_same_v<typename BView::array_layout, Kokkos::LayoutRight>);
+  if constexpr (tpl_avail) {
+    if (A.extent(1) != 0) {
+      Impl::sddmm_cusparse(space, S_i, A, B, C_i);
+      return;
+    }
+  }
+#endif
+  Impl::sddmm_native(space, S_i, A, B, C_i);
+}
+
+/// \brief C := S .* (A * B^T) at the entries of S, on the default instance
+///   of the execution space of S.
+template <class SMatrix, class AView, class BView, class CMatrix>
+void sddmm(const SMatrix& S, const AView& A, const BView& B,
+           const CMatrix& C) {
+  sddmm(typename SMatrix::execution_space(), S, A, B, C);
+}
+
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SDDMM_HPP_
@@ -17,11 +17,15 @@
 #ifndef _KOKKOS_SPADD_HPP
 #define _KOKKOS_SPADD_HPP
 
+#include <stdexcept>
+#include <vector>
 #include "KokkosKernels_Handle.hpp"
 #include "KokkosKernels_helpers.hpp"
+#include "KokkosKernels_SimpleUtils.hpp"
 #include "KokkosBlas1_scal.hpp"
 #include "KokkosSparse_spadd_numeric_spec.hpp"
 #include "KokkosSparse_spadd_symbolic_spec.hpp"
+#include "KokkosSparse_spadd_multi_impl.hpp"
 
 namespace KokkosSparse {
 namespace Experimental {
@@ -319,6 +323,174 @@ void spadd_numeric(KernelHandle *handle, const AScalar alpha, const AMatrix &A,
                 C);
 }
 
+namespace Experimental {
+
+/// \brief Symbolic phase of the k-way sparse addition C = sum_j alpha_j A_j.
+///
+/// The rows of all the A_j are merged at once, so C is built in one pass
+/// over the inputs instead of k-1 pairwise spadd calls and their
+/// temporaries. The rows of the A_j must be sorted (the spadd handle must be
+/// created with input_sorted = true); duplicate entries are merged. The
+/// handle keeps the position in C of each entry of each A_j, so that
+/// spadd_multi_numeric can be called any number of times with new values of
+/// the A_j (but the same graphs) and new coefficients.
+///
+/// \param exec The execution space instance to run the kernels on
+/// \param handle A KokkosKernelsHandle with a spadd handle
+/// \param As The matrices A_j, between 1 and 16 of them, with the same
+///   dimensions
+/// \param C Output: the sum, with its row map and entries computed and its
+///   values allocated
+template <typename ExecSpace, typename KernelHandle, typename AMatrix,
+          typename CMatrix>
+void spadd_multi_symbolic(const ExecSpace &exec, KernelHandle *handle,
+                          const std::vector<AMatrix> &As, CMatrix &C) {
+  using ordinal_type = typename AMatrix::non_const_ordinal_type;
+  using size_type    = typename CMatrix::non_const_size_type;
+  using row_map_type = typename CMatrix::row_map_type::non_const_type;
+  using entries_type = typename CMatrix::index_type::non_const_type;
+  using values_type  = typename CMatrix::values_type::non_const_type;
+  using pos_type     = typename KernelHandle::SPADDHandleType::nnz_lno_view_t;
+  using functor_t    = KokkosSparse::Impl::SpaddMultiSymbolicFunctor<
+      typename AMatrix::row_map_type, typename AMatrix::index_type,
+      row_map_type, entries_type, pos_type>;
+
+  const int k = As.size();
+  if (k < 1 || k > KokkosSparse::Impl::spadd_multi_max_terms) {
+    throw std::invalid_argument(
+        "KokkosSparse::spadd_multi_symbolic: the number of matrices must be "
+        "between 1 and 16");
+  }
+  const ordinal_type m = As[0].numRows();
+  const ordinal_type n = As[0].numCols();
+  for (const AMatrix &A : As) {
+    if (A.numRows() != m || A.numCols() != n) {
+      throw std::invalid_argument(
+          "KokkosSparse::spadd_multi_symbolic: the matrices must have the "
+          "same dimensions");
+    }
+  }
+  auto addHandle = handle->get_spadd_handle();
+  if (!addHandle->is_input_sorted()) {
+    throw std::invalid_argument(
+        "KokkosSparse::spadd_multi_symbolic: the rows of the matrices must be "
+        "sorted");
+  }
+
+  row_map_type row_mapC(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "row map"),
+      m + 1);
+  std::vector<pos_type> pos(k);
+  functor_t functor;
+  functor.k = k;
+  for (int j = 0; j < k; j++) {
+    pos[j] = pos_type(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing,
+                                         "spadd_multi positions"),
+                      As[j].nnz());
+    functor.rowmaps[j] = As[j].graph.row_map;
+    functor.entries[j] = As[j].graph.entries;
+    functor.pos[j]     = pos[j];
+  }
+  functor.c_rowmap = row_mapC;
+
+  // Row lengths, then row map
+  Kokkos::parallel_for(
+      "KokkosSparse::spadd_multi_symbolic::count",
+      Kokkos::RangePolicy<ExecSpace, typename functor_t::CountTag>(exec, 0, m),
+      functor);
+  Kokkos::deep_copy(exec, Kokkos::subview(row_mapC, m), size_type(0));
+  size_type c_nnz = 0;
+  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum(exec, m + 1, row_mapC,
+                                                        c_nnz);
+
+  entries_type entriesC(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "entries"), c_nnz);
+  values_type valuesC(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "values"), c_nnz);
+  functor.c_entries = entriesC;
+  Kokkos::parallel_for(
+      "KokkosSparse::spadd_multi_symbolic::fill",
+      Kokkos::RangePolicy<ExecSpace, typename functor_t::FillTag>(exec, 0, m),
+      functor);
+
+  addHandle->set_multi_pos(pos);
+  addHandle->set_c_nnz(c_nnz);
+  addHandle->set_call_symbolic();
+  C = CMatrix("matrix", m, n, c_nnz, valuesC, row_mapC, entriesC);
+}
+
+/// \brief Numeric phase of the k-way sparse addition C = sum_j alpha_j A_j,
+/// after spadd_multi_symbolic with the same handle and the graphs of the
+/// same matrices.
+///
+/// Each row of C is computed by one thread, which reads the row of each A_j
+/// once.
+///
+/// \param exec The execution space instance to run the kernel on
+/// \param handle The KokkosKernelsHandle given to spadd_multi_symbolic
+/// \param alphas The coefficients alpha_j, one per matrix
+/// \param As The matrices A_j
+/// \param C The sum computed by spadd_multi_symbolic; its values are
+///   overwritten
+template <typename ExecSpace, typename KernelHandle, typename AScalar,
+          typename AMatrix, typename CMatrix>
+void spadd_multi_numeric(const ExecSpace &exec, KernelHandle *handle,
+                         const std::vector<AScalar> &alphas,
+                         const std::vector<AMatrix> &As, CMatrix &C) {
+  using ordinal_type = typename AMatrix::non_const_ordinal_type;
+  using pos_type     = typename KernelHandle::SPADDHandleType::nnz_lno_view_t;
+  using functor_t    = KokkosSparse::Impl::SpaddMultiNumericFunctor<
+      typename AMatrix::row_map_type, typename AMatrix::values_type,
+      typename CMatrix::row_map_type, typename CMatrix::values_type,
+      pos_type>;
+  using scalar_t = typename functor_t::scalar_t;
+
+  auto addHandle = handle->get_spadd_handle();
+  const std::vector<pos_type> &pos = addHandle->get_multi_pos();
+  if (alphas.size() != As.size()) {
+    throw std::invalid_argument(
+        "KokkosSparse::spadd_multi_numeric: need one coefficient per matrix");
+  }
+  if (!addHandle->is_symbolic_called() || pos.size() != As.size()) {
+    throw std::runtime_error(
+        "KokkosSparse::spadd_multi_numeric: spadd_multi_symbolic must be "
+        "called first, with the same matrices");
+  }
+
+  functor_t functor;
+  functor.k = As.size();
+  for (int j = 0; j < functor.k; j++) {
+    functor.rowmaps[j] = As[j].graph.row_map;
+    functor.values[j]  = As[j].values;
+    functor.alphas[j]  = scalar_t(alphas[j]);
+    functor.pos[j]     = pos[j];
+  }
+  functor.c_rowmap = C.graph.row_map;
+  functor.c_values = C.values;
+  Kokkos::parallel_for("KokkosSparse::spadd_multi_numeric",
+                       Kokkos::RangePolicy<ExecSpace>(
+                           exec, 0, ordinal_type(C.numRows())),
+                       functor);
+  addHandle->set_call_numeric();
+}
+
+// One without an explicit execution space argument
+template <typename KernelHandle, typename AMatrix, typename CMatrix>
+void spadd_multi_symbolic(KernelHandle *handle, const std::vector<AMatrix> &As,
+                          CMatrix &C) {
+  spadd_multi_symbolic(typename AMatrix::execution_space{}, handle, As, C);
+}
+
+template <typename KernelHandle, typename AScalar, typename AMatrix,
+          typename CMatrix>
+void spadd_multi_numeric(KernelHandle *handle,
+                         const std::vector<AScalar> &alphas,
+                         const std::vector<AMatrix> &As, CMatrix &C) {
+  spadd_multi_numeric(typename AMatrix::execution_space{}, handle, alphas, As,
+                      C);
+}
+
+}  // namespace Experimental
 }  // namespace KokkosSparse
 
 #undef SAME_TYPE
@@ -15,8 +15,10 @@
 //@HEADER
 
 #include <Kokkos_Core.hpp>
+#include <KokkosKernels_Workspace.hpp>
 #include <iostream>
 #include <string>
+#include <vector>
 
 #ifndef _SPADDHANDLE_HPP
 #define _SPADDHANDLE_HPP
@@ -31,6 +33,16 @@ class SPADDHandle {
   typedef typename lno_row_view_t_::non_const_type nnz_row_view_t;
   typedef typename lno_row_view_t_::non_const_value_type size_type;
   typedef ExecutionSpace execution_space;
+  typedef KokkosKernels::Experimental::Workspace<MemorySpace> workspace_t;
+
+  // How the sparsity pattern of B relates to that of A, as detected by the
+  // native symbolic phase. In the two non-general cases A's rows are sorted
+  // and merged and C has exactly A's pattern, so numeric skips the row merge.
+  enum PatternKind {
+    GENERAL_PATTERN,        // C is the merged union of A and B
+    IDENTICAL_PATTERN,      // B has the same rowmap and entries as A
+    B_SUBSET_OF_A_PATTERN,  // every entry of B is in A; see get_b_pos()
+  };
 
 #ifdef KOKKOSKERNELS_ENABLE_TPL_CUSPARSE
   struct SpaddCusparseData {
@@ -78,13 +90,21 @@ class SPADDHandle {
   bool called_symbolic;
   bool called_numeric;
 
+  PatternKind pattern_kind;
+
   // a_pos and b_pos are used by the unsorted version of the kernel
   // both have same length as a_entries and b_entries
   // each entry provides the index in C row where the corresponding entry is
-  // added
+  // added. b_pos alone is also used by the B_SUBSET_OF_A_PATTERN fast path.
   nnz_lno_view_t a_pos;
   nnz_lno_view_t b_pos;
 
+  // Used by spadd_multi: for each input matrix, the position in its row of C
+  // of each of its entries
+  std::vector<nnz_lno_view_t> multi_pos;
+
+  workspace_t* workspace;  // where the temporaries come from, if not null
+
  public:
   /// \brief sets the result nnz size.
   /// \param a_pos_in The offset into a.
@@ -99,6 +119,14 @@ class SPADDHandle {
 
   nnz_lno_view_t get_b_pos() { return b_pos; }
 
+  /// \brief sets the positions in C of the entries of the spadd_multi inputs.
+  /// \param multi_pos_in One view per input matrix.
+  void set_multi_pos(const std::vector<nnz_lno_view_t>& multi_pos_in) {
+    multi_pos = multi_pos_in;
+  }
+
+  const std::vector<nnz_lno_view_t>& get_multi_pos() { return multi_pos; }
+
   /// \brief sets the result nnz size.
   /// \param result_nnz_size_ size of the output matrix.
   void set_c_nnz(size_type result_nnz_size_) {
@@ -114,6 +142,24 @@ class SPADDHandle {
 
   int get_sort_option() { return this->sort_option; }
 
+  /// \brief sets the pattern relationship of A and B found by symbolic.
+  void set_pattern_kind(PatternKind kind) { this->pattern_kind = kind; }
+
+  /**
+   * \brief returns the pattern relationship of A and B found by symbolic.
+   */
+  PatternKind get_pattern_kind() { return this->pattern_kind; }
+
+  /// \brief sets the workspace that the symbolic phase of unsorted inputs
+  /// draws its temporaries (the unmerged sum of A and B) from. The handle
+  /// does not own it; nullptr, the default, allocates them at each call.
+  void set_workspace(workspace_t* workspace_) { this->workspace = workspace_; }
+
+  /**
+   * \brief returns the workspace of the handle, or nullptr.
+   */
+  workspace_t* get_workspace() { return this->workspace; }
+
 #ifdef KOKKOSKERNELS_ENABLE_TPL_CUSPARSE
   SpaddCusparseData cusparseData;
 #endif
@@ -130,7 +176,9 @@ class SPADDHandle {
         input_merged(input_is_merged),
         result_nnz_size(0),
         called_symbolic(false),
-        called_numeric(false) {}
+        called_numeric(false),
+        pattern_kind(GENERAL_PATTERN),
+        workspace(nullptr) {}
 
   virtual ~SPADDHandle(){};
 
@@ -20,54 +20,82 @@
 #include "KokkosSparse_spgemm_symbolic.hpp"
 #include "KokkosSparse_spgemm_jacobi.hpp"
 #include "KokkosSparse_spgemm_noreuse_spec.hpp"
+#include "KokkosSparse_spgemm_transpose_impl.hpp"
 
 namespace KokkosSparse {
 
 ///
-/// @brief
+/// @brief Symbolic phase of C = A*B on the given execution space instance:
+/// the kernels and the allocations of C are issued on space.
 ///
+/// @tparam ExecSpace
 /// @tparam KernelHandle
 /// @tparam AMatrix
 /// @tparam BMatrix
 /// @tparam CMatrix
+/// @param space
 /// @param kh
 /// @param A
 /// @param Amode
 /// @param B
 /// @param Bmode
 /// @param C
-////
-template <class KernelHandle, class AMatrix, class BMatrix, class CMatrix>
-void spgemm_symbolic(KernelHandle& kh, const AMatrix& A, const bool Amode,
-                     const BMatrix& B, const bool Bmode, CMatrix& C) {
+///
+template <class ExecSpace, class KernelHandle, class AMatrix, class BMatrix,
+          class CMatrix>
+void spgemm_symbolic(const ExecSpace& space, KernelHandle& kh,
+                     const AMatrix& A, const bool Amode, const BMatrix& B,
+                     const bool Bmode, CMatrix& C) {
   using row_map_type = typename CMatrix::row_map_type::non_const_type;
   using entries_type = typename CMatrix::index_type::non_const_type;
   using values_type  = typename CMatrix::values_type::non_const_type;
 
-  row_map_type row_mapC(
-      Kokkos::view_alloc(Kokkos::WithoutInitializing, "non_const_lnow_row"),
-      A.numRows() + 1);
+  row_map_type row_mapC(Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                                           "non_const_lnow_row"),
+                        A.numRows() + 1);
   entries_type entriesC;
   values_type valuesC;
 
   KokkosSparse::Experimental::spgemm_symbolic(
-      &kh, A.numRows(), B.numRows(), B.numCols(), A.graph.row_map,
+      space, &kh, A.numRows(), B.numRows(), B.numCols(), A.graph.row_map,
       A.graph.entries, Amode, B.graph.row_map, B.graph.entries, Bmode,
       row_mapC);
 
   const size_t c_nnz_size = kh.get_spgemm_handle()->get_c_nnz();
   if (c_nnz_size) {
     entriesC = entries_type(
-        Kokkos::view_alloc(Kokkos::WithoutInitializing, "entriesC"),
+        Kokkos::view_alloc(space, Kokkos::WithoutInitializing, "entriesC"),
         c_nnz_size);
     valuesC = values_type(
-        Kokkos::view_alloc(Kokkos::WithoutInitializing, "valuesC"), c_nnz_size);
+        Kokkos::view_alloc(space, Kokkos::WithoutInitializing, "valuesC"),
+        c_nnz_size);
   }
 
   C = CMatrix("C=AB", A.numRows(), B.numCols(), c_nnz_size, valuesC, row_mapC,
               entriesC);
 }
 
+///
+/// @brief
+///
+/// @tparam KernelHandle
+/// @tparam AMatrix
+/// @tparam BMatrix
+/// @tparam CMatrix
+/// @param kh
+/// @param A
+/// @param Amode
+/// @param B
+/// @param Bmode
+/// @param C
+////
+template <class KernelHandle, class AMatrix, class BMatrix, class CMatrix>
+void spgemm_symbolic(KernelHandle& kh, const AMatrix& A, const bool Amode,
+                     const BMatrix& B, const bool Bmode, CMatrix& C) {
+  spgemm_symbolic(typename KernelHandle::HandleExecSpace(), kh, A, Amode, B,
+                  Bmode, C);
+}
+
 ///
 /// @brief Symbolic phase for block SpGEMM (BSR matrices)
 ///
@@ -149,6 +177,33 @@ void spgemm_numeric(KernelHandle& kh, const AMatrix& A, const bool Amode,
       B.values, Bmode, C.graph.row_map, C.graph.entries, C.values);
 }
 
+///
+/// @brief Numeric phase of C = A*B on the given execution space instance.
+///
+/// @tparam ExecSpace
+/// @tparam KernelHandle
+/// @tparam AMatrix
+/// @tparam BMatrix
+/// @tparam CMatrix
+/// @param space
+/// @param kh
+/// @param A
+/// @param Amode
+/// @param B
+/// @param Bmode
+/// @param C
+///
+template <class ExecSpace, class KernelHandle, class AMatrix, class BMatrix,
+          class CMatrix>
+void spgemm_numeric(const ExecSpace& space, KernelHandle& kh, const AMatrix& A,
+                    const bool Amode, const BMatrix& B, const bool Bmode,
+                    CMatrix& C) {
+  KokkosSparse::Experimental::spgemm_numeric(
+      space, &kh, A.numRows(), B.numRows(), B.numCols(), A.graph.row_map,
+      A.graph.entries, A.values, Amode, B.graph.row_map, B.graph.entries,
+      B.values, Bmode, C.graph.row_map, C.graph.entries, C.values);
+}
+
 ///
 /// @brief
 ///
@@ -179,7 +234,15 @@ void block_spgemm_numeric(KernelHandle& kh, const AMatrix& A, const bool Amode,
 }
 
 ///
-/// @brief
+/// @brief C = op(A) * op(B), where op(X) is X^T if its mode is true.
+///
+/// At most one of A and B may be transposed. A^T * B and A * B^T are computed
+/// from the CRS arrays of A and B without transposing their values: the
+/// transposed operand is only indexed by columns (one ordinal and one offset
+/// per indexed entry), and the rows of C are accumulated in place by a
+/// symbolic and a numeric pass, with dense per-thread arrays of the columns
+/// of C bounded to 256 MiB in total. The temporary memory does not grow with
+/// the flop count of the product.
 ///
 /// @tparam CMatrix
 /// @tparam AMatrix
@@ -214,9 +277,10 @@ CMatrix spgemm(const AMatrix& A, const bool Amode, const BMatrix& B,
   // Check now that A, B dimensions are compatible to multiply
   auto opACols = Amode ? A.numRows() : A.numCols();
   auto opBRows = Bmode ? B.numCols() : B.numRows();
-  if (Amode || Bmode)
+  if (Amode && Bmode)
     throw std::invalid_argument(
-        "KokkosSparse::spgemm: transposing A and/or B is not yet supported");
+        "KokkosSparse::spgemm: transposing both A and B is not supported "
+        "(compute B * A and transpose it)");
   if (opACols != opBRows)
     throw std::invalid_argument(
         "KokkosSparse::spgemm: op(A) and op(B) have incompatible dimensions "
@@ -241,6 +305,11 @@ CMatrix spgemm(const AMatrix& A, const bool Amode, const BMatrix& B,
     typename CMatrix::values_type valuesC;
     return CMatrix("C", Crows, Ccols, 0, valuesC, row_mapC, entriesC);
   }
+  // A^T * B and A * B^T: row by row from the CRS arrays of A and B, with
+  // the transposed operand indexed by columns
+  if (Amode || Bmode)
+    return CMatrix(KokkosSparse::Impl::spgemm_transpose<CMatrix_Internal>(
+        A_internal, Amode, B_internal, Bmode));
   return CMatrix(KokkosSparse::Impl::SPGEMM_NOREUSE<
                  CMatrix_Internal, AMatrix_Internal,
                  BMatrix_Internal>::spgemm_noreuse(A_internal, Amode,
@@ -0,0 +1,228 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file
+/// \brief Sparse matrix-matrix multiply C = A*B computed over chunks of the
+///   rows of A, for products whose work memory does not fit on the device
+///   at once.
+///
+
+#ifndef KOKKOSSPARSE_SPGEMM_CHUNKED_HPP_
+#define KOKKOSSPARSE_SPGEMM_CHUNKED_HPP_
+
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "KokkosKernels_Handle.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_spgemm_symbolic.hpp"
+#include "KokkosSparse_spgemm_numeric.hpp"
+#include "KokkosSparse_spgemm_chunked_impl.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+
+///
+/// @brief C = A*B, computed in chunks of consecutive rows of A.
+///
+/// The rows of A are split into chunks whose estimated SpGEMM memory
+/// (entries, values and work memory of the chunk's product) fits within
+/// max_chunk_bytes, or, if max_chunk_bytes is 0, within half of the free
+/// memory of A's memory space (a single chunk on host spaces). The product
+/// is computed in two passes over the chunks: the first counts the entries
+/// of each row of C so that C is allocated once, the second computes the
+/// entries and values of each chunk and writes them into C.
+///
+/// CMatrix may live in a different memory space than A and B, e.g. a
+/// HostSpace CrsMatrix when C itself does not fit on the device. The chunks
+/// are then computed in A's execution space and copied into C one at a
+/// time.
+///
+/// This is slower than KokkosSparse::spgemm, since the symbolic phase runs
+/// twice and B is reread for each chunk; use it when that runs out of
+/// memory.
+///
+/// @tparam CMatrix A KokkosSparse::CrsMatrix with non-const, managed views,
+///   with the ordinal, offset and scalar types of A
+/// @tparam AMatrix A KokkosSparse::CrsMatrix
+/// @tparam BMatrix A KokkosSparse::CrsMatrix in the memory space of A
+/// @param A The left matrix
+/// @param B The right matrix
+/// @param max_chunk_bytes The memory budget of a chunk, or 0 to use the
+///   free device memory
+/// @return CMatrix The product. Like KokkosSparse::spgemm, its rows are
+///   not necessarily sorted.
+///
+template <class CMatrix, class AMatrix, class BMatrix>
+CMatrix spgemm_chunked(const AMatrix& A, const BMatrix& B,
+                       const size_t max_chunk_bytes = 0) {
+  static_assert(is_crs_matrix_v<AMatrix> && is_crs_matrix_v<BMatrix> &&
+                    is_crs_matrix_v<CMatrix>,
+                "KokkosSparse::spgemm_chunked: A, B and C must be CrsMatrix");
+  using ExecSpace    = typename AMatrix::execution_space;
+  using MemSpace     = typename AMatrix::memory_space;
+  using device_type  = Kokkos::Device<ExecSpace, MemSpace>;
+  using size_type    = typename AMatrix::non_const_size_type;
+  using ordinal_type = typename AMatrix::non_const_ordinal_type;
+  using scalar_type  = typename AMatrix::non_const_value_type;
+  using row_map_type = typename CMatrix::row_map_type::non_const_type;
+  using entries_type = typename CMatrix::index_type::non_const_type;
+  using values_type  = typename CMatrix::values_type::non_const_type;
+  using chunk_row_map_type =
+      Kokkos::View<size_type*, typename row_map_type::array_layout,
+                   device_type>;
+  using chunk_entries_type =
+      Kokkos::View<ordinal_type*, typename entries_type::array_layout,
+                   device_type>;
+  using chunk_values_type =
+      Kokkos::View<scalar_type*, typename values_type::array_layout,
+                   device_type>;
+  using KernelHandle = KokkosKernels::Experimental::KokkosKernelsHandle<
+      size_type, ordinal_type, scalar_type, ExecSpace, MemSpace, MemSpace>;
+  static_assert(
+      std::is_same_v<size_type, typename CMatrix::non_const_size_type> &&
+          std::is_same_v<ordinal_type,
+                         typename CMatrix::non_const_ordinal_type> &&
+          std::is_same_v<scalar_type, typename CMatrix::non_const_value_type>,
+      "KokkosSparse::spgemm_chunked: C must have the offset, ordinal and "
+      "scalar types of A");
+  constexpr bool c_accessible =
+      Kokkos::SpaceAccessibility<ExecSpace,
+                                 typename CMatrix::memory_space>::accessible;
+
+  if (A.numCols() != B.numRows()) {
+    throw std::invalid_argument(
+        "KokkosSparse::spgemm_chunked: A and B have incompatible dimensions "
+        "for multiplication");
+  }
+  const ordinal_type m = A.numRows();
+  const ordinal_type k = B.numRows();
+  const ordinal_type n = B.numCols();
+  row_map_type row_mapC("C rowmap", m + 1);
+  if (!m || !k || !n || !A.nnz() || !B.nnz()) {
+    return CMatrix("C", m, n, 0, values_type(), row_mapC, entries_type());
+  }
+
+  // The chunk's entries and values, and about as much work memory
+  const size_t bytes_per_flop =
+      2 * (sizeof(ordinal_type) + sizeof(scalar_type));
+  auto row_mapA_h =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.row_map);
+  auto row_mapC_h = Kokkos::create_mirror_view(row_mapC);
+
+  // Symbolic phase of rows [r0, r1) with a fresh SpGEMM handle in kh.
+  // Returns the row map of A and of C for these rows; the row map of C is
+  // empty if the rows have no entries.
+  auto chunk_symbolic = [&](KernelHandle& kh, const ordinal_type r0,
+                            const ordinal_type r1) {
+    auto row_mapA_c = KokkosSparse::Impl::spgemm_chunk_rowmap<ExecSpace>(
+        A.graph.row_map, row_mapA_h, r0, r1);
+    chunk_row_map_type row_mapC_c;
+    if (row_mapA_h(r0) == row_mapA_h(r1)) {
+      return std::make_pair(row_mapA_c, row_mapC_c);
+    }
+    row_mapC_c = chunk_row_map_type(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "C chunk rowmap"),
+        r1 - r0 + 1);
+    auto entriesA_c = Kokkos::subview(
+        A.graph.entries, Kokkos::make_pair(row_mapA_h(r0), row_mapA_h(r1)));
+    kh.create_spgemm_handle();
+    spgemm_symbolic(&kh, r1 - r0, k, n, row_mapA_c, entriesA_c, false,
+                    B.graph.row_map, B.graph.entries, false, row_mapC_c);
+    return std::make_pair(row_mapA_c, row_mapC_c);
+  };
+
+  // Pass 1: the row map of C
+  auto first = KokkosSparse::Impl::spgemm_chunk_rows<ExecSpace>(
+      A, B, bytes_per_flop,
+      KokkosSparse::Impl::spgemm_chunk_budget<ExecSpace, MemSpace>(
+          max_chunk_bytes));
+  size_type c_nnz = 0;
+  row_mapC_h(0)   = 0;
+  for (size_t c = 0; c + 1 < first.size(); c++) {
+    const ordinal_type r0 = first[c], r1 = first[c + 1];
+    KernelHandle kh;
+    auto row_mapC_c = chunk_symbolic(kh, r0, r1).second;
+    kh.destroy_spgemm_handle();
+    if (!row_mapC_c.extent(0)) {
+      for (ordinal_type i = r0; i < r1; i++) row_mapC_h(i + 1) = c_nnz;
+      continue;
+    }
+    auto row_mapC_c_h =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), row_mapC_c);
+    for (ordinal_type i = r0; i < r1; i++) {
+      row_mapC_h(i + 1) = c_nnz + row_mapC_c_h(i - r0 + 1);
+    }
+    c_nnz += row_mapC_c_h(r1 - r0);
+  }
+  Kokkos::deep_copy(row_mapC, row_mapC_h);
+
+  entries_type entriesC;
+  values_type valuesC;
+  if (c_nnz) {
+    entriesC = entries_type(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "entriesC"), c_nnz);
+    valuesC = values_type(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "valuesC"), c_nnz);
+  }
+
+  // Pass 2: the entries and values of C. If C is on the device it now takes
+  // part of the memory, so the chunks are sized again.
+  if constexpr (c_accessible) {
+    first = KokkosSparse::Impl::spgemm_chunk_rows<ExecSpace>(
+        A, B, bytes_per_flop,
+        KokkosSparse::Impl::spgemm_chunk_budget<ExecSpace, MemSpace>(
+            max_chunk_bytes));
+  }
+  for (size_t c = 0; c + 1 < first.size(); c++) {
+    const ordinal_type r0 = first[c], r1 = first[c + 1];
+    const size_type begin = row_mapC_h(r0), end = row_mapC_h(r1);
+    if (begin == end) continue;
+    KernelHandle kh;
+    auto row_maps   = chunk_symbolic(kh, r0, r1);
+    auto entriesA_c = Kokkos::subview(
+        A.graph.entries, Kokkos::make_pair(row_mapA_h(r0), row_mapA_h(r1)));
+    auto valuesA_c = Kokkos::subview(
+        A.values, Kokkos::make_pair(row_mapA_h(r0), row_mapA_h(r1)));
+    auto entriesC_c = Kokkos::subview(entriesC, Kokkos::make_pair(begin, end));
+    auto valuesC_c  = Kokkos::subview(valuesC, Kokkos::make_pair(begin, end));
+    if constexpr (c_accessible) {
+      spgemm_numeric(&kh, r1 - r0, k, n, row_maps.first, entriesA_c,
+                     valuesA_c, false, B.graph.row_map, B.graph.entries,
+                     B.values, false, row_maps.second, entriesC_c, valuesC_c);
+    } else {
+      // Stage the chunk on the device, then copy it into C
+      chunk_entries_type entries_c(
+          Kokkos::view_alloc(Kokkos::WithoutInitializing, "C chunk entries"),
+          end - begin);
+      chunk_values_type values_c(
+          Kokkos::view_alloc(Kokkos::WithoutInitializing, "C chunk values"),
+          end - begin);
+      spgemm_numeric(&kh, r1 - r0, k, n, row_maps.first, entriesA_c,
+                     valuesA_c, false, B.graph.row_map, B.graph.entries,
+                     B.values, false, row_maps.second, entries_c, values_c);
+      Kokkos::deep_copy(entriesC_c, entries_c);
+      Kokkos::deep_copy(valuesC_c, values_c);
+    }
+    kh.destroy_spgemm_handle();
+  }
+  return CMatrix("C=AB", m, n, c_nnz, valuesC, row_mapC, entriesC);
+}
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPGEMM_CHUNKED_HPP_
@@ -18,8 +18,13 @@
 
 #include <KokkosKernels_config.h>
 #include <KokkosKernels_Controls.hpp>
+#include <KokkosKernels_HandleTelemetry.hpp>
+#include <KokkosKernels_PlanIO.hpp>
+#include <KokkosKernels_Workspace.hpp>
 #include <KokkosSparse_Utils.hpp>
+#include <KokkosSparse_spgemm_memory_estimate_impl.hpp>
 #include <Kokkos_Core.hpp>
+#include <algorithm>
 #include <iostream>
 #include <string>
 //#define VERBOSE
@@ -90,6 +95,75 @@ enum SPGEMMAccumulator {
   SPGEMM_ACC_DEFAULT,
   SPGEMM_ACC_DENSE,
   SPGEMM_ACC_SPARSE,
+  // Numeric phase of the KK algorithms only: rows of C with few entries use
+  // a small list in registers, the other rows a dense accumulator
+  SPGEMM_ACC_ADAPTIVE,
+};
+
+// Tensor core numeric phase of block SpGEMM (BsrMatrix with real scalars,
+// CUDA on Ampere or Hopper). Ignored where unavailable.
+enum SPGEMMTensorCores {
+  SPGEMM_TC_NONE,    // scalar block products
+  SPGEMM_TC_DOUBLE,  // fp64 += fp64 * fp64
+  SPGEMM_TC_HALF,    // fp32 += fp16 * fp16, with A and B rounded to fp16
+  SPGEMM_TC_BF16,    // fp32 += bf16 * bf16, with A and B rounded to bf16
+};
+
+// Estimated memory of a planned SpGEMM, see SPGEMMHandle::estimate_memory()
+struct SPGEMMMemoryEstimate {
+  // Peak work memory of the symbolic and numeric calls
+  size_t temporary_bytes = 0;
+  // C, and what the handle keeps between and after the calls
+  size_t persistent_bytes = 0;
+};
+
+// Coefficients of the cost model of the SpGEMM algorithm selection, see
+// SPGEMMHandle::set_algorithm_selection(). Costs are relative to one
+// multiplication through a dense accumulator on one thread. The defaults
+// are conservative; calibrate them for a machine with set_cost_model().
+struct SPGEMMCostModel {
+  // Per multiplication with SPGEMM_SERIAL, a dense accumulator, a hash map
+  double serial_flop = 0.7;
+  double dense_flop  = 1.0;
+  double hash_flop   = 2.0;
+  // Per column of B, to set up the dense accumulators
+  double dense_column = 0.1;
+  // Factor on the multiplications of an accumulator with more than
+  // cache_entries entries (a dense row of B's columns, or the hash map of a
+  // row of C)
+  double cache_miss    = 2.5;
+  size_t cache_entries = 32768;
+  // Per product, for the parallel launches of the SPGEMM_KK* algorithms
+  double launch = 2.0e4;
+  // Rows are skewed when the longest has more than skew times the average
+  // multiplications. Skewed products with short average rows use
+  // SPGEMM_ACC_ADAPTIVE for the numeric phase.
+  double skew = 16.0;
+};
+
+// Statistics and choice of the algorithm selection, see
+// SPGEMMHandle::get_algorithm_selection_result()
+struct SPGEMMSelection {
+  // Whether the selection ran
+  bool done = false;
+  // Multiplications of the product and of its longest row, their average
+  // per row, and the fraction of the entries of B left after compression
+  size_t flops         = 0;
+  size_t max_row_flops = 0;
+  double avg_row_flops = 0;
+  double compression   = 1;
+  // Shared memory per team (bytes) and concurrency of the execution space
+  size_t shmem_bytes = 0;
+  size_t concurrency = 1;
+  // Estimated costs of the candidates, 0 for those that were not
+  double serial_cost = 0;
+  double dense_cost  = 0;
+  double hash_cost   = 0;
+  // The choice; -1 sizes are left to the kernels
+  SPGEMMAlgorithm algorithm     = SPGEMM_KK;
+  SPGEMMAccumulator accumulator = SPGEMM_ACC_DEFAULT;
+  int team_size                 = -1;
+  int vector_size               = -1;
 };
 template <class size_type_, class lno_t_, class scalar_t_, class ExecutionSpace,
           class TemporaryMemorySpace, class PersistentMemorySpace>
@@ -127,6 +201,9 @@ class SPGEMMHandle {
   typedef typename nnz_lno_persistent_work_view_t::HostMirror
       nnz_lno_persistent_work_host_view_t;  // Host view type
 
+  typedef KokkosKernels::Experimental::Workspace<HandleTempMemorySpace>
+      workspace_t;
+
 #ifdef KOKKOSKERNELS_ENABLE_TPL_ROCSPARSE
   struct rocSparseSpgemmHandleType {
     KokkosKernels::Experimental::Controls
@@ -247,7 +324,13 @@ class SPGEMMHandle {
 
  private:
   SPGEMMAlgorithm algorithm_type;
+  // The algorithm given by the caller, before any default or selection
+  SPGEMMAlgorithm requested_algorithm;
+  // Calls and times of spgemm_symbolic ("symbolic") and spgemm_numeric
+  // ("numeric"), recorded only once enabled
+  KokkosKernels::Experimental::HandleTelemetry telemetry;
   SPGEMMAccumulator accumulator_type;
+  SPGEMMTensorCores tensor_cores;
   size_type result_nnz_size;
 
   bool called_symbolic;
@@ -297,6 +380,8 @@ class SPGEMMHandle {
   double multi_color_scale;
   int mkl_sort_option;
   bool calculate_read_write_cost;
+  // Where the temporaries of numeric come from, if not null
+  workspace_t *workspace;
 
  public:
   std::string coloring_input_file;
@@ -479,7 +564,9 @@ class SPGEMMHandle {
    */
   SPGEMMHandle(SPGEMMAlgorithm gs = SPGEMM_DEFAULT)
       : algorithm_type(gs),
+        requested_algorithm(gs),
         accumulator_type(SPGEMM_ACC_DEFAULT),
+        tensor_cores(SPGEMM_TC_NONE),
         result_nnz_size(0),
         called_symbolic(false),
         computed_rowptrs(false),
@@ -520,6 +607,7 @@ class SPGEMMHandle {
         multi_color_scale(1),
         mkl_sort_option(7),
         calculate_read_write_cost(false),
+        workspace(nullptr),
         coloring_input_file(""),
         coloring_output_file(""),
         min_hash_size_scale(1),
@@ -694,8 +782,24 @@ class SPGEMMHandle {
     this->accumulator_type = acc_type;
   }
 
+  SPGEMMTensorCores get_tensor_cores() const { return this->tensor_cores; }
+  void set_tensor_cores(const SPGEMMTensorCores &tc) {
+    this->tensor_cores = tc;
+  }
+
   // getters
   SPGEMMAlgorithm get_algorithm_type() const { return this->algorithm_type; }
+  // Team and vector sizes chosen by the last kernel launch (0 until then)
+  int get_suggested_vector_size() const { return this->suggested_vector_size; }
+  int get_suggested_team_size() const { return this->suggested_team_size; }
+  KokkosKernels::Experimental::HandleTelemetry &get_telemetry() {
+    return this->telemetry;
+  }
+  // With a workspace, the hashmap of the SPGEMM_KK_SPEED numeric on GPUs is
+  // drawn from its buffer instead of being allocated at each call. The
+  // handle does not own it; nullptr (the default) allocates again.
+  workspace_t *get_workspace() const { return this->workspace; }
+  void set_workspace(workspace_t *workspace_) { this->workspace = workspace_; }
 
   bool is_symbolic_called() { return this->called_symbolic; }
   bool are_rowptrs_computed() { return this->computed_rowptrs; }
@@ -720,7 +824,8 @@ class SPGEMMHandle {
 
   // setters
   void set_algorithm_type(const SPGEMMAlgorithm &sgs_algo) {
-    this->algorithm_type = sgs_algo;
+    this->algorithm_type      = sgs_algo;
+    this->requested_algorithm = sgs_algo;
   }
   void set_call_symbolic(bool call = true) { this->called_symbolic = call; }
   void set_computed_rowptrs() { this->computed_rowptrs = true; }
@@ -777,6 +882,299 @@ class SPGEMMHandle {
 
   bool get_compression_step() { return is_compression_single_step; }
 
+ private:
+  bool algorithm_selection = true;
+  SPGEMMCostModel cost_model;
+  SPGEMMSelection selection;
+
+ public:
+  /// \brief Enable or disable the algorithm selection (enabled by default).
+  ///
+  /// If the handle was created with SPGEMM_DEFAULT or SPGEMM_KK, the first
+  /// spgemm_symbolic call that runs the native implementation computes a few
+  /// statistics of A and B (multiplications per row, how much B compresses,
+  /// shared memory) and picks the algorithm, the accumulator and the team
+  /// and vector sizes with a cost model (see SPGEMMCostModel). Setting an
+  /// algorithm, or disabling the selection, keeps the choice of the caller.
+  /// Team and vector sizes set in the KernelHandle are always kept.
+  void set_algorithm_selection(bool select) {
+    this->algorithm_selection = select;
+  }
+  bool get_algorithm_selection() const { return this->algorithm_selection; }
+
+  /// Whether the next spgemm_symbolic call will run the selection.
+  bool is_algorithm_selection_pending() const {
+    return this->algorithm_selection && !this->selection.done &&
+           (this->requested_algorithm == SPGEMM_DEFAULT ||
+            this->requested_algorithm == SPGEMM_KK);
+  }
+
+  /// The algorithm given at construction or to set_algorithm_type().
+  SPGEMMAlgorithm get_requested_algorithm() const {
+    return this->requested_algorithm;
+  }
+
+  void set_cost_model(const SPGEMMCostModel &model) {
+    this->cost_model = model;
+  }
+  const SPGEMMCostModel &get_cost_model() const { return this->cost_model; }
+
+  /// The statistics and choice of the selection (done is false if it did
+  /// not run). They are also written to the dispatch trace.
+  const SPGEMMSelection &get_algorithm_selection_result() const {
+    return this->selection;
+  }
+
+  /// Record the selection and apply its algorithm and accumulator.
+  void set_algorithm_selection_result(const SPGEMMSelection &selection_) {
+    this->selection        = selection_;
+    this->algorithm_type   = selection_.algorithm;
+    this->accumulator_type = selection_.accumulator;
+  }
+
+ private:
+  // Numeric reuse: for each row of C the offset of its product terms, and
+  // for each product term its position in the entries of C
+  bool numeric_reuse       = false;
+  bool numeric_reuse_ready = false;
+  // Set by load(): the symbolic data was not computed by this process
+  bool plan_loaded = false;
+  row_lno_persistent_work_view_t reuse_term_offsets;
+  row_lno_persistent_work_view_t reuse_positions;
+
+ public:
+  /// \brief Enable or disable numeric reuse (native SpGEMM only).
+  ///
+  /// With numeric reuse, the first numeric call also stores, for every
+  /// product term a_ik * b_kj, the position of (i, j) in C. All later
+  /// numeric calls with this handle then compute C by scatter-adding the
+  /// terms at those positions, without any accumulator. The entries of C
+  /// passed to those calls must be the ones computed by the first call
+  /// (they are not written again), and the values of A and B may change but
+  /// their sparsity may not. The positions take one size_type per flop of
+  /// the product (see get_numeric_reuse_bytes()).
+  void set_numeric_reuse(bool reuse) {
+    this->numeric_reuse = reuse;
+    if (!reuse) clear_numeric_reuse_data();
+  }
+  bool get_numeric_reuse() const { return this->numeric_reuse; }
+
+  /// Whether the term positions have been stored by a numeric call.
+  bool is_numeric_reuse_ready() const { return this->numeric_reuse_ready; }
+
+  void set_numeric_reuse_data(row_lno_persistent_work_view_t term_offsets,
+                              row_lno_persistent_work_view_t positions) {
+    this->reuse_term_offsets  = term_offsets;
+    this->reuse_positions     = positions;
+    this->numeric_reuse_ready = true;
+  }
+  row_lno_persistent_work_view_t get_numeric_reuse_term_offsets() const {
+    return this->reuse_term_offsets;
+  }
+  row_lno_persistent_work_view_t get_numeric_reuse_positions() const {
+    return this->reuse_positions;
+  }
+
+  /// Number of bytes used by the stored term positions.
+  size_t get_numeric_reuse_bytes() const {
+    return (reuse_term_offsets.span() + reuse_positions.span()) *
+           sizeof(size_type);
+  }
+
+  /// Whether the symbolic data of this handle was restored by load().
+  /// spgemm_numeric then always uses the native implementation.
+  bool is_plan_loaded() const { return this->plan_loaded; }
+
+  /// Whether save() can be called, i.e. spgemm_symbolic did not run a TPL.
+  bool can_save_plan() const {
+#ifdef KOKKOSKERNELS_ENABLE_TPL_ROCSPARSE
+    if (this->rocsparse_spgemm_handle) return false;
+#endif
+#ifdef KOKKOSKERNELS_ENABLE_TPL_CUSPARSE
+    if (this->cusparse_spgemm_handle) return false;
+#endif
+#ifdef KOKKOSKERNELS_ENABLE_TPL_MKL
+    if (this->mkl_spgemm_handle) return false;
+#endif
+    return true;
+  }
+
+  /// \brief Save the symbolic data of this handle and the row map of C
+  /// computed by spgemm_symbolic, for load() to restore later (for
+  /// instance after a restart) instead of calling spgemm_symbolic again.
+  ///
+  /// Only a plan computed by the native implementation can be saved, since
+  /// the TPLs keep their symbolic data in opaque structures. Use
+  /// SPGEMM_SERIAL or a native SPGEMM_KK* algorithm on spaces with a TPL.
+  template <typename c_row_view_t>
+  void save(std::ostream &os, const c_row_view_t &row_mapC) const {
+    if (!this->called_symbolic || !this->computed_rowptrs)
+      throw std::runtime_error(
+          "SPGEMMHandle::save: spgemm_symbolic has not been called");
+    if (!can_save_plan())
+      throw std::runtime_error(
+          "SPGEMMHandle::save: plans computed by a TPL cannot be saved");
+    using namespace KokkosKernels::Impl;
+    write_plan_header(os, "SPGEMMHandle");
+    write_plan_value(os, static_cast<int32_t>(this->algorithm_type));
+    write_plan_value(os, static_cast<int32_t>(this->accumulator_type));
+    write_plan_value(os, this->result_nnz_size);
+    write_plan_value(os, this->max_nnz_inresult);
+    write_plan_value(os, this->computed_max_nnz_inresult);
+    write_plan_value(os, this->max_nnz_compressed_result);
+    write_plan_value(os, this->suggested_vector_size);
+    write_plan_value(os, this->suggested_team_size);
+    write_plan_value(os, this->is_compression_single_step);
+    write_plan_value(os, this->computed_rowflops);
+    write_plan_value(os, this->original_max_row_flops);
+    write_plan_value(os, this->original_overall_flops);
+    write_plan_value(os, this->compressed_max_row_flops);
+    write_plan_value(os, this->compressed_overall_flops);
+    write_plan_view(os, this->row_flops);
+    write_plan_value(os, this->compressed_b_size);
+    write_plan_view(os, this->compressed_b_rowmap);
+    write_plan_view(os, this->compressed_b_set_indices);
+    write_plan_view(os, this->compressed_b_sets);
+    write_plan_value(os, this->computedInputHashes);
+    write_plan_value(os, this->a_graph_hash);
+    write_plan_value(os, this->b_graph_hash);
+    write_plan_view(os, row_mapC);
+  }
+
+  /// \brief Restore the symbolic data written by save() into this handle
+  /// and into row_mapC, as spgemm_symbolic would have computed them.
+  ///
+  /// The handle must have been created with the same algorithm, and A and B
+  /// must have the same sparsity patterns as when the plan was saved. The
+  /// next spgemm_numeric can then be called directly.
+  template <typename c_row_view_t>
+  void load(std::istream &is, c_row_view_t &row_mapC) {
+    using namespace KokkosKernels::Impl;
+    read_plan_header(is, "SPGEMMHandle");
+    const auto plan_algorithm =
+        static_cast<SPGEMMAlgorithm>(read_plan_value<int32_t>(is));
+    if (plan_algorithm != this->algorithm_type) {
+      // A plan of a selected algorithm is loaded into a handle that would
+      // have run the same selection
+      if (!is_algorithm_selection_pending())
+        throw std::runtime_error(
+            "SPGEMMHandle::load: plan was saved with another algorithm");
+      this->algorithm_type = plan_algorithm;
+    }
+    // The plan replaces the selection, which would run on the next symbolic
+    // call otherwise
+    if (is_algorithm_selection_pending()) {
+      this->selection.done      = true;
+      this->selection.algorithm = plan_algorithm;
+    }
+    this->accumulator_type =
+        static_cast<SPGEMMAccumulator>(read_plan_value<int32_t>(is));
+    this->result_nnz_size            = read_plan_value<size_type>(is);
+    this->max_nnz_inresult           = read_plan_value<nnz_lno_t>(is);
+    this->computed_max_nnz_inresult  = read_plan_value<bool>(is);
+    this->max_nnz_compressed_result  = read_plan_value<nnz_lno_t>(is);
+    this->suggested_vector_size      = read_plan_value<int>(is);
+    this->suggested_team_size        = read_plan_value<int>(is);
+    this->is_compression_single_step = read_plan_value<bool>(is);
+    this->computed_rowflops          = read_plan_value<bool>(is);
+    this->original_max_row_flops     = read_plan_value<size_t>(is);
+    this->original_overall_flops     = read_plan_value<size_t>(is);
+    this->compressed_max_row_flops   = read_plan_value<size_t>(is);
+    this->compressed_overall_flops   = read_plan_value<size_t>(is);
+    read_plan_view(is, this->row_flops);
+    this->compressed_b_size = read_plan_value<size_type>(is);
+    read_plan_view(is, this->compressed_b_rowmap);
+    read_plan_view(is, this->compressed_b_set_indices);
+    read_plan_view(is, this->compressed_b_sets);
+    this->computedInputHashes = read_plan_value<bool>(is);
+    this->a_graph_hash        = read_plan_value<uint32_t>(is);
+    this->b_graph_hash        = read_plan_value<uint32_t>(is);
+    read_plan_view(is, row_mapC);
+    this->called_symbolic  = true;
+    this->computed_rowptrs = true;
+    this->computed_entries = false;
+    this->called_numeric   = false;
+    this->plan_loaded      = true;
+    clear_numeric_reuse_data();
+  }
+
+  /// \brief Estimate the memory of spgemm_symbolic followed by
+  /// spgemm_numeric for C = A*B (A is m x k, B is k x n) with this handle,
+  /// before anything is allocated.
+  ///
+  /// Only the graphs of A and B are read, with one pass over the rows of A.
+  /// Both numbers are upper bounds: C is counted with at most
+  /// min(multiplications, n) entries per row, the work memory with one
+  /// accumulator per thread (per warp on GPUs) sized for the largest row.
+  /// The estimate covers the algorithm set in the handle, and also the
+  /// buffers of a TPL (cuSPARSE, rocSPARSE, MKL) where spgemm may use one,
+  /// so it holds whichever path performs the product.
+  template <typename a_rowmap_t, typename a_entries_t, typename b_rowmap_t>
+  SPGEMMMemoryEstimate estimate_memory(const nnz_lno_t m, const nnz_lno_t n,
+                                       const nnz_lno_t k,
+                                       const a_rowmap_t &a_rowmap,
+                                       const a_entries_t &a_entries,
+                                       const b_rowmap_t &b_rowmap) const {
+    SPGEMMMemoryEstimate estimate;
+    const size_t row_map_bytes = (size_t(m) + 1) * sizeof(size_type);
+    estimate.persistent_bytes  = row_map_bytes;
+    if (!m || !n || !k || !b_rowmap.extent(0)) return estimate;
+
+    const auto bounds =
+        KokkosSparse::Impl::spgemm_product_bounds(
+            HandleExecSpace(), m, n, a_rowmap, a_entries, b_rowmap);
+    size_type b_nnz = 0;
+    Kokkos::deep_copy(b_nnz, Kokkos::subview(b_rowmap, k));
+    const size_t entry_bytes = sizeof(nnz_lno_t) + sizeof(nnz_scalar_t);
+    const size_t accumulators =
+        KokkosSparse::Impl::spgemm_concurrent_accumulators<HandleExecSpace>();
+
+    // C, and the compressed B (row map, and a set index and set bits per
+    // entry) kept by the symbolic phase
+    const size_t compressed_b_bytes = (size_t(k) + 1) * sizeof(size_type) +
+                                      2 * size_t(b_nnz) * sizeof(nnz_lno_t);
+    estimate.persistent_bytes +=
+        bounds.c_nnz * entry_bytes + compressed_b_bytes;
+    if (this->numeric_reuse) {
+      estimate.persistent_bytes +=
+          row_map_bytes + bounds.flops * sizeof(size_type);
+    }
+
+    // Per accumulator: a dense row of n values and markers, or a hash map
+    // (begins, nexts, keys and values) for the largest row
+    size_t accumulator_bytes;
+    if (this->algorithm_type == SPGEMM_KK_DENSE ||
+        this->algorithm_type == SPGEMM_KK_SPEED ||
+        this->accumulator_type == SPGEMM_ACC_DENSE ||
+        this->accumulator_type == SPGEMM_ACC_ADAPTIVE) {
+      accumulator_bytes = size_t(n) * entry_bytes;
+    } else {
+      size_t hash_size = 1;
+      while (hash_size < bounds.max_row_flops) hash_size *= 2;
+      accumulator_bytes =
+          hash_size * sizeof(nnz_lno_t) +
+          bounds.max_row_flops * (entry_bytes + sizeof(nnz_lno_t));
+    }
+    // The row flops and the compression temporaries of the symbolic phase
+    estimate.temporary_bytes = size_t(m) * sizeof(size_type) +
+                               compressed_b_bytes +
+                               accumulators * accumulator_bytes;
+    if (KokkosSparse::Impl::spgemm_tpl_may_be_used<HandleExecSpace>()) {
+      // TPL work buffers grow with the multiplications of the product
+      estimate.temporary_bytes =
+          std::max(estimate.temporary_bytes, bounds.flops * entry_bytes);
+    }
+    return estimate;
+  }
+
+  /// Release the stored term positions. If numeric reuse is still enabled,
+  /// the next numeric call stores them again.
+  void clear_numeric_reuse_data() {
+    this->reuse_term_offsets  = row_lno_persistent_work_view_t();
+    this->reuse_positions     = row_lno_persistent_work_view_t();
+    this->numeric_reuse_ready = false;
+  }
+
  private:
   // An SpGEMM handle can be reused for multiple products C = A*B, but only if
   // the sparsity patterns of A and B do not change. Enforce this (in debug
@@ -842,6 +1240,40 @@ class SPGEMMHandle {
   }
 };
 
+/// Get the name of an SPGEMMAlgorithm, e.g. for logging. The deprecated TPL
+/// values are reported by number.
+inline std::string get_spgemm_algorithm_name(SPGEMMAlgorithm algo) {
+  switch (algo) {
+    case SPGEMM_KK: return "SPGEMM_KK";
+    case SPGEMM_KK_DENSE: return "SPGEMM_KK_DENSE";
+    case SPGEMM_KK_MEMORY: return "SPGEMM_KK_MEMORY";
+    case SPGEMM_KK_LP: return "SPGEMM_KK_LP";
+    case SPGEMM_KK_TRIANGLE_AI: return "SPGEMM_KK_TRIANGLE_AI";
+    case SPGEMM_KK_TRIANGLE_IA_UNION: return "SPGEMM_KK_TRIANGLE_IA_UNION";
+    case SPGEMM_KK_TRIANGLE_IA: return "SPGEMM_KK_TRIANGLE_IA";
+    case SPGEMM_KK_TRIANGLE_LL: return "SPGEMM_KK_TRIANGLE_LL";
+    case SPGEMM_KK_TRIANGLE_LU: return "SPGEMM_KK_TRIANGLE_LU";
+    case SPGEMM_KK_MULTIMEM: return "SPGEMM_KK_MULTIMEM";
+    case SPGEMM_KK_OUTERMULTIMEM: return "SPGEMM_KK_OUTERMULTIMEM";
+    case SPGEMM_DEFAULT: return "SPGEMM_DEFAULT";
+    case SPGEMM_DEBUG: return "SPGEMM_DEBUG";
+    case SPGEMM_SERIAL: return "SPGEMM_SERIAL";
+    case SPGEMM_KK_CUCKOO: return "SPGEMM_KK_CUCKOO";
+    case SPGEMM_KK_TRACKED_CUCKOO: return "SPGEMM_KK_TRACKED_CUCKOO";
+    case SPGEMM_KK_TRACKED_CUCKOO_F: return "SPGEMM_KK_TRACKED_CUCKOO_F";
+    case SPGEMM_KK_SPEED: return "SPGEMM_KK_SPEED";
+    case SPGEMM_KK_MEMORY_SORTED: return "SPGEMM_KK_MEMORY_SORTED";
+    case SPGEMM_KK_MEMORY_TEAM: return "SPGEMM_KK_MEMORY_TEAM";
+    case SPGEMM_KK_MEMORY_BIGTEAM: return "SPGEMM_KK_MEMORY_BIGTEAM";
+    case SPGEMM_KK_MEMORY_SPREADTEAM: return "SPGEMM_KK_MEMORY_SPREADTEAM";
+    case SPGEMM_KK_MEMORY_BIGSPREADTEAM:
+      return "SPGEMM_KK_MEMORY_BIGSPREADTEAM";
+    case SPGEMM_KK_MEMORY2: return "SPGEMM_KK_MEMORY2";
+    case SPGEMM_KK_MEMSPEED: return "SPGEMM_KK_MEMSPEED";
+    default: return "SPGEMM_" + std::to_string(static_cast<int>(algo));
+  }
+}
+
 inline SPGEMMAlgorithm StringToSPGEMMAlgorithm(std::string &name) {
   if (name == "SPGEMM_DEFAULT")
     return SPGEMM_KK;
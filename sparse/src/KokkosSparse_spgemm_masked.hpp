@@ -0,0 +1,236 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file
+/// \brief Masked sparse matrix-matrix multiply C<M> = A*B, which computes
+///   only the entries of A*B in (or, with the complement, not in) the
+///   sparsity pattern of a mask matrix M.
+///
+
+#ifndef KOKKOSSPARSE_SPGEMM_MASKED_HPP_
+#define KOKKOSSPARSE_SPGEMM_MASKED_HPP_
+
+#include <stdexcept>
+#include <string>
+#include "KokkosKernels_Handle.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_PatternMatrix.hpp"
+#include "KokkosSparse_Semiring.hpp"
+#include "KokkosSparse_SortCrs.hpp"
+#include "KokkosSparse_spgemm_masked_impl.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+namespace Impl {
+
+template <class MMatrix, class AMatrix, class BMatrix>
+void spgemm_masked_check_dimensions(const char* name, const MMatrix& M,
+                                    const AMatrix& A, const BMatrix& B) {
+  static_assert((is_crs_matrix_v<MMatrix> || is_pattern_matrix_v<MMatrix>) &&
+                    (is_crs_matrix_v<AMatrix> ||
+                     is_pattern_matrix_v<AMatrix>) &&
+                    (is_crs_matrix_v<BMatrix> || is_pattern_matrix_v<BMatrix>),
+                "KokkosSparse::spgemm_masked: M, A and B must be CrsMatrix or "
+                "PatternMatrix");
+  if (A.numCols() != B.numRows()) {
+    throw std::invalid_argument(
+        std::string("KokkosSparse::") + name +
+        ": A and B have incompatible dimensions for multiplication");
+  }
+  if (M.numRows() != A.numRows() || M.numCols() != B.numCols()) {
+    throw std::invalid_argument(std::string("KokkosSparse::") + name +
+                                ": the mask M must have the dimensions of A*B");
+  }
+}
+
+}  // namespace Impl
+
+///
+/// @brief Symbolic phase of the masked product C<M> = A*B.
+///
+/// Computes the row map of C, and allocates C (A.numRows() x B.numCols())
+/// with its entries and values uninitialized. Row i of C holds the columns
+/// j of row i of A*B for which (i, j) is an entry of M, or, if complement
+/// is true, is not an entry of M. Only the sparsity pattern of M is used.
+///
+/// The SpGEMM handle of kh (kh.create_spgemm_handle()) records that
+/// symbolic was called; spgemm_masked_numeric can then be called any number
+/// of times with new values of A and B, as long as the sparsity of M, A and
+/// B does not change.
+///
+/// Triangle counting, for example, is C<L> = L*L with L the strictly lower
+/// triangle of the adjacency matrix, and k-truss support counts are C<A> =
+/// A*A. For unweighted graphs, M, A and B can be PatternMatrix, which have
+/// no values array.
+///
+/// @tparam KernelHandle A KokkosKernels::Experimental::KokkosKernelsHandle
+/// @tparam MMatrix A KokkosSparse::CrsMatrix
+/// @tparam AMatrix A KokkosSparse::CrsMatrix
+/// @tparam BMatrix A KokkosSparse::CrsMatrix
+/// @tparam CMatrix A KokkosSparse::CrsMatrix with non-const, managed views
+/// @param kh The kernel handle, with an SpGEMM handle
+/// @param M The mask
+/// @param complement Whether to keep the entries outside of M instead
+/// @param A The left matrix
+/// @param B The right matrix
+/// @param C [out] The product, with its row map computed
+///
+template <class KernelHandle, class MMatrix, class AMatrix, class BMatrix,
+          class CMatrix>
+void spgemm_masked_symbolic(KernelHandle& kh, const MMatrix& M,
+                            const bool complement, const AMatrix& A,
+                            const BMatrix& B, CMatrix& C) {
+  using ExecSpace    = typename KernelHandle::HandleExecSpace;
+  using TempMemSpace = typename KernelHandle::HandleTempMemorySpace;
+  using row_map_type = typename CMatrix::row_map_type::non_const_type;
+  using entries_type = typename CMatrix::index_type::non_const_type;
+  using values_type  = typename CMatrix::values_type::non_const_type;
+
+  Impl::spgemm_masked_check_dimensions("spgemm_masked_symbolic", M, A, B);
+  auto sh = kh.get_spgemm_handle();
+  if (!sh) {
+    throw std::invalid_argument(
+        "KokkosSparse::spgemm_masked_symbolic: call create_spgemm_handle on "
+        "the kernel handle first");
+  }
+
+  // Zero-initialized: the last entry must be 0 for the prefix sum
+  row_map_type row_mapC("non_const_lnow_row", A.numRows() + 1);
+  entries_type entriesC;
+  values_type valuesC;
+  // The pattern of C does not depend on the semiring
+  using semiring_t =
+      PlusTimesSemiring<typename CMatrix::non_const_value_type>;
+  const size_t c_nnz_size =
+      KokkosSparse::Impl::spgemm_masked_impl<false, ExecSpace, TempMemSpace,
+                                             semiring_t>(
+          M, complement, A, B, row_mapC, entriesC, valuesC);
+  sh->set_c_nnz(c_nnz_size);
+  sh->set_computed_rowptrs();
+  sh->set_call_symbolic();
+
+  if (c_nnz_size) {
+    entriesC = entries_type(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "entriesC"),
+        c_nnz_size);
+    valuesC = values_type(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "valuesC"), c_nnz_size);
+  }
+  C = CMatrix("C<M>=AB", A.numRows(), B.numCols(), c_nnz_size, valuesC,
+              row_mapC, entriesC);
+}
+
+///
+/// @brief Numeric phase of the masked product C<M> = A*B.
+///
+/// Computes the entries (sorted within each row) and values of C, which
+/// must come from spgemm_masked_symbolic with the same handle, mask and
+/// complement flag.
+///
+/// The values are computed over a semiring (KokkosSparse_Semiring.hpp):
+/// C(i, j) = add over k of multiply(A(i, k), B(k, j)). The default,
+/// PlusTimesSemiring, is the usual product; MinPlusSemiring, for example,
+/// relaxes two-hop paths of a graph.
+///
+/// @tparam KernelHandle A KokkosKernels::Experimental::KokkosKernelsHandle
+/// @tparam MMatrix A KokkosSparse::CrsMatrix
+/// @tparam AMatrix A KokkosSparse::CrsMatrix
+/// @tparam BMatrix A KokkosSparse::CrsMatrix
+/// @tparam CMatrix A KokkosSparse::CrsMatrix with non-const views
+/// @tparam Semiring A semiring over the values of C
+/// @param kh The kernel handle used for spgemm_masked_symbolic
+/// @param M The mask
+/// @param complement Whether to keep the entries outside of M instead
+/// @param A The left matrix
+/// @param B The right matrix
+/// @param C [in/out] The product from spgemm_masked_symbolic
+/// @param sr The semiring (only its type is used)
+///
+template <class KernelHandle, class MMatrix, class AMatrix, class BMatrix,
+          class CMatrix,
+          class Semiring =
+              PlusTimesSemiring<typename CMatrix::non_const_value_type>>
+void spgemm_masked_numeric(KernelHandle& kh, const MMatrix& M,
+                           const bool complement, const AMatrix& A,
+                           const BMatrix& B, CMatrix& C,
+                           const Semiring& /* sr */ = Semiring()) {
+  using ExecSpace    = typename KernelHandle::HandleExecSpace;
+  using TempMemSpace = typename KernelHandle::HandleTempMemorySpace;
+
+  Impl::spgemm_masked_check_dimensions("spgemm_masked_numeric", M, A, B);
+  auto sh = kh.get_spgemm_handle();
+  if (!sh || !sh->is_symbolic_called()) {
+    throw std::runtime_error(
+        "Call spgemm_masked_symbolic before calling spgemm_masked_numeric");
+  }
+  if (C.numRows() != A.numRows() || C.numCols() != B.numCols() ||
+      size_t(C.nnz()) != size_t(sh->get_c_nnz())) {
+    throw std::invalid_argument(
+        "KokkosSparse::spgemm_masked_numeric: C does not match the product "
+        "computed by spgemm_masked_symbolic");
+  }
+
+  KokkosSparse::Impl::spgemm_masked_impl<true, ExecSpace, TempMemSpace,
+                                         Semiring>(
+      M, complement, A, B, C.graph.row_map, C.graph.entries, C.values);
+  KokkosSparse::sort_crs_matrix(ExecSpace(), C.graph.row_map, C.graph.entries,
+                                C.values);
+  sh->set_call_numeric();
+  sh->set_computed_entries();
+}
+
+///
+/// @brief Masked product C<M> = A*B, without symbolic reuse.
+///
+/// @tparam CMatrix A KokkosSparse::CrsMatrix with non-const, managed views
+/// @tparam MMatrix A KokkosSparse::CrsMatrix
+/// @tparam AMatrix A KokkosSparse::CrsMatrix
+/// @tparam BMatrix A KokkosSparse::CrsMatrix
+/// @tparam Semiring A semiring over the values of C
+/// @param M The mask
+/// @param complement Whether to keep the entries outside of M instead
+/// @param A The left matrix
+/// @param B The right matrix
+/// @param sr The semiring (only its type is used)
+/// @return CMatrix The product, with sorted rows
+///
+template <class CMatrix, class MMatrix, class AMatrix, class BMatrix,
+          class Semiring =
+              PlusTimesSemiring<typename CMatrix::non_const_value_type>>
+CMatrix spgemm_masked(const MMatrix& M, const bool complement,
+                      const AMatrix& A, const BMatrix& B,
+                      const Semiring& sr = Semiring()) {
+  using device_type  = typename CMatrix::device_type;
+  using KernelHandle = KokkosKernels::Experimental::KokkosKernelsHandle<
+      typename CMatrix::non_const_size_type,
+      typename CMatrix::non_const_ordinal_type,
+      typename CMatrix::non_const_value_type,
+      typename device_type::execution_space, typename device_type::memory_space,
+      typename device_type::memory_space>;
+
+  KernelHandle kh;
+  kh.create_spgemm_handle();
+  CMatrix C;
+  spgemm_masked_symbolic(kh, M, complement, A, B, C);
+  spgemm_masked_numeric(kh, M, complement, A, B, C, sr);
+  kh.destroy_spgemm_handle();
+  return C;
+}
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPGEMM_MASKED_HPP_
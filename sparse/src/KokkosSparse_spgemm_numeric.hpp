@@ -17,7 +17,9 @@
 #define _KOKKOS_SPGEMM_NUMERIC_HPP
 
 #include "KokkosKernels_helpers.hpp"
+#include "KokkosKernels_DispatchTrace.hpp"
 #include "KokkosSparse_spgemm_numeric_spec.hpp"
+#include "KokkosSparse_spgemm_select_impl.hpp"
 #include "KokkosSparse_bspgemm_numeric_spec.hpp"
 
 namespace KokkosSparse {
@@ -30,12 +32,15 @@ namespace Experimental {
 //
 // NOTE: Block CRS format is not yet supported !
 //
-template <typename KernelHandle, typename alno_row_view_t_,
+/// \brief spgemm_numeric on the given execution space instance: the
+/// kernels, temporary allocations and TPL calls of the numeric phase are
+/// issued on space. Block (BSR) products still run on the default instance.
+template <typename ExecSpace, typename KernelHandle, typename alno_row_view_t_,
           typename alno_nnz_view_t_, typename ascalar_nnz_view_t_,
           typename blno_row_view_t_, typename blno_nnz_view_t_,
           typename bscalar_nnz_view_t_, typename clno_row_view_t_,
           typename clno_nnz_view_t_, typename cscalar_nnz_view_t_>
-void spgemm_numeric(KernelHandle *handle,
+void spgemm_numeric(const ExecSpace &space, KernelHandle *handle,
                     typename KernelHandle::const_nnz_lno_t m,
                     typename KernelHandle::const_nnz_lno_t n,
                     typename KernelHandle::const_nnz_lno_t k,
@@ -48,6 +53,11 @@ void spgemm_numeric(KernelHandle *handle,
                     clno_nnz_view_t_ &entriesC, cscalar_nnz_view_t_ &valuesC,
 
                     typename KernelHandle::const_nnz_lno_t block_dim = 1) {
+  static_assert(
+      std::is_same<ExecSpace, typename KernelHandle::HandleExecSpace>::value,
+      "KokkosSparse::spgemm_numeric: ExecSpace must be the execution space "
+      "of the KernelHandle.");
+
   static_assert(
       std::is_same<typename clno_nnz_view_t_::value_type,
                    typename clno_nnz_view_t_::non_const_value_type>::value,
@@ -253,11 +263,33 @@ void spgemm_numeric(KernelHandle *handle,
         "passed to the first spgemm_symbolic and spgemm_numeric calls.");
   }
 
+  // Same team and vector sizes as the symbolic phase
+  KokkosSparse::Impl::spgemm_apply_selected_launch(tmp_handle);
   auto algo = spgemmHandle->get_algorithm_type();
+  KokkosKernels::Experimental::HandleTelemetry::Scope<ExecSpace>
+      telemetryScope(&spgemmHandle->get_telemetry(), "numeric", space);
+  KokkosKernels::Impl::DispatchTrace<ExecSpace> trace("spgemm_numeric",
+                                                      space);
+  if (trace.is_enabled()) {
+    trace.set_dims(m, k, entriesA.extent(0));
+    trace.set_algorithm(get_spgemm_algorithm_name(algo));
+    trace.set_tpl(
+        algo != SPGEMM_DEBUG && algo != SPGEMM_SERIAL &&
+        !spgemmHandle->get_numeric_reuse() &&
+        !spgemmHandle->is_plan_loaded() &&
+        KokkosSparse::Impl::spgemm_numeric_tpl_spec_avail<
+            const_handle_type, Internal_alno_row_view_t_,
+            Internal_alno_nnz_view_t_, Internal_ascalar_nnz_view_t_,
+            Internal_blno_row_view_t_, Internal_blno_nnz_view_t_,
+            Internal_bscalar_nnz_view_t_, Internal_clno_row_view_t_,
+            Internal_clno_nnz_view_t_, Internal_cscalar_nnz_view_t_>::value);
+  }
 
-  if (algo == SPGEMM_DEBUG || algo == SPGEMM_SERIAL) {
+  if (algo == SPGEMM_DEBUG || algo == SPGEMM_SERIAL ||
+      spgemmHandle->get_numeric_reuse() || spgemmHandle->is_plan_loaded()) {
     // Never call a TPL if serial/debug is requested (this is needed for
-    // testing)
+    // testing), with numeric reuse which is only implemented natively, or
+    // with a loaded plan since the TPL symbolic data is not restored
     KokkosSparse::Impl::SPGEMM_NUMERIC<
         const_handle_type,  // KernelHandle,
         Internal_alno_row_view_t_, Internal_alno_nnz_view_t_,
@@ -265,7 +297,7 @@ void spgemm_numeric(KernelHandle *handle,
         Internal_blno_nnz_view_t_, Internal_bscalar_nnz_view_t_,
         Internal_clno_row_view_t_, Internal_clno_nnz_view_t_,
         Internal_cscalar_nnz_view_t_,
-        false>::spgemm_numeric(&tmp_handle,  // handle,
+        false>::spgemm_numeric(space, &tmp_handle,  // handle,
                                m, n, k, const_a_r, const_a_l, const_a_s,
                                transposeA, const_b_r, const_b_l, const_b_s,
                                transposeB, const_c_r, nonconst_c_l,
@@ -277,7 +309,8 @@ void spgemm_numeric(KernelHandle *handle,
         Internal_ascalar_nnz_view_t_, Internal_blno_row_view_t_,
         Internal_blno_nnz_view_t_, Internal_bscalar_nnz_view_t_,
         Internal_clno_row_view_t_, Internal_clno_nnz_view_t_,
-        Internal_cscalar_nnz_view_t_>::spgemm_numeric(&tmp_handle,  // handle,
+        Internal_cscalar_nnz_view_t_>::spgemm_numeric(space,
+                                                      &tmp_handle,  // handle,
                                                       m, n, k, const_a_r,
                                                       const_a_l, const_a_s,
                                                       transposeA, const_b_r,
@@ -286,6 +319,29 @@ void spgemm_numeric(KernelHandle *handle,
                                                       nonconst_c_l,
                                                       nonconst_c_s);
   }
+  trace.set_launch(spgemmHandle->get_suggested_team_size(),
+                   spgemmHandle->get_suggested_vector_size());
+}
+
+template <typename KernelHandle, typename alno_row_view_t_,
+          typename alno_nnz_view_t_, typename ascalar_nnz_view_t_,
+          typename blno_row_view_t_, typename blno_nnz_view_t_,
+          typename bscalar_nnz_view_t_, typename clno_row_view_t_,
+          typename clno_nnz_view_t_, typename cscalar_nnz_view_t_>
+void spgemm_numeric(KernelHandle *handle,
+                    typename KernelHandle::const_nnz_lno_t m,
+                    typename KernelHandle::const_nnz_lno_t n,
+                    typename KernelHandle::const_nnz_lno_t k,
+                    alno_row_view_t_ row_mapA, alno_nnz_view_t_ entriesA,
+                    ascalar_nnz_view_t_ valuesA, bool transposeA,
+                    blno_row_view_t_ row_mapB, blno_nnz_view_t_ entriesB,
+                    bscalar_nnz_view_t_ valuesB, bool transposeB,
+                    clno_row_view_t_ row_mapC, clno_nnz_view_t_ &entriesC,
+                    cscalar_nnz_view_t_ &valuesC,
+                    typename KernelHandle::const_nnz_lno_t block_dim = 1) {
+  spgemm_numeric(typename KernelHandle::HandleExecSpace(), handle, m, n, k,
+                 row_mapA, entriesA, valuesA, transposeA, row_mapB, entriesB,
+                 valuesB, transposeB, row_mapC, entriesC, valuesC, block_dim);
 }
 
 }  // namespace Experimental
@@ -0,0 +1,194 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file
+/// \brief Fused triple product C = R*A*P (e.g. the Galerkin coarse operator
+///   P^T*A*P of algebraic multigrid), without forming R*A or A*P.
+///
+
+#ifndef KOKKOSSPARSE_SPGEMM_RAP_HPP_
+#define KOKKOSSPARSE_SPGEMM_RAP_HPP_
+
+#include <stdexcept>
+#include <string>
+#include "KokkosKernels_Handle.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_SortCrs.hpp"
+#include "KokkosSparse_spgemm_rap_impl.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+namespace Impl {
+
+template <class RMatrix, class AMatrix, class PMatrix>
+void spgemm_rap_check_dimensions(const char* name, const RMatrix& R,
+                                 const AMatrix& A, const PMatrix& P) {
+  static_assert(is_crs_matrix_v<RMatrix> && is_crs_matrix_v<AMatrix> &&
+                    is_crs_matrix_v<PMatrix>,
+                "KokkosSparse::spgemm_rap: R, A and P must be CrsMatrix");
+  if (R.numCols() != A.numRows() || A.numCols() != P.numRows()) {
+    throw std::invalid_argument(
+        std::string("KokkosSparse::") + name +
+        ": R, A and P have incompatible dimensions for multiplication");
+  }
+}
+
+}  // namespace Impl
+
+///
+/// @brief Symbolic phase of the triple product C = R*A*P.
+///
+/// Computes the row map of C, and allocates C (R.numRows() x P.numCols())
+/// with its entries and values uninitialized. The SpGEMM handle of kh
+/// (kh.create_spgemm_handle()) records that symbolic was called and the
+/// number of entries of C; spgemm_rap_numeric can then be called any number
+/// of times with new values of R, A and P, as long as their sparsity does
+/// not change.
+///
+/// For a Galerkin product pass R = P^T, e.g. from
+/// KokkosSparse::Impl::transpose_matrix.
+///
+/// @tparam KernelHandle A KokkosKernels::Experimental::KokkosKernelsHandle
+/// @tparam RMatrix A KokkosSparse::CrsMatrix
+/// @tparam AMatrix A KokkosSparse::CrsMatrix
+/// @tparam PMatrix A KokkosSparse::CrsMatrix
+/// @tparam CMatrix A KokkosSparse::CrsMatrix with non-const, managed views
+/// @param kh The kernel handle, with an SpGEMM handle
+/// @param R The left matrix
+/// @param A The middle matrix
+/// @param P The right matrix
+/// @param C [out] The product, with its row map computed
+///
+template <class KernelHandle, class RMatrix, class AMatrix, class PMatrix,
+          class CMatrix>
+void spgemm_rap_symbolic(KernelHandle& kh, const RMatrix& R, const AMatrix& A,
+                         const PMatrix& P, CMatrix& C) {
+  using ExecSpace    = typename KernelHandle::HandleExecSpace;
+  using TempMemSpace = typename KernelHandle::HandleTempMemorySpace;
+  using row_map_type = typename CMatrix::row_map_type::non_const_type;
+  using entries_type = typename CMatrix::index_type::non_const_type;
+  using values_type  = typename CMatrix::values_type::non_const_type;
+
+  Impl::spgemm_rap_check_dimensions("spgemm_rap_symbolic", R, A, P);
+  auto sh = kh.get_spgemm_handle();
+  if (!sh) {
+    throw std::invalid_argument(
+        "KokkosSparse::spgemm_rap_symbolic: call create_spgemm_handle on the "
+        "kernel handle first");
+  }
+
+  // Zero-initialized: the last entry must be 0 for the prefix sum
+  row_map_type row_mapC("non_const_lnow_row", R.numRows() + 1);
+  entries_type entriesC;
+  values_type valuesC;
+  const size_t c_nnz_size =
+      KokkosSparse::Impl::spgemm_rap_impl<false, ExecSpace, TempMemSpace>(
+          R, A, P, row_mapC, entriesC, valuesC);
+  sh->set_c_nnz(c_nnz_size);
+  sh->set_computed_rowptrs();
+  sh->set_call_symbolic();
+
+  if (c_nnz_size) {
+    entriesC = entries_type(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "entriesC"),
+        c_nnz_size);
+    valuesC = values_type(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "valuesC"), c_nnz_size);
+  }
+  C = CMatrix("C=RAP", R.numRows(), P.numCols(), c_nnz_size, valuesC,
+              row_mapC, entriesC);
+}
+
+///
+/// @brief Numeric phase of the triple product C = R*A*P.
+///
+/// Computes the entries (sorted within each row) and values of C, which
+/// must come from spgemm_rap_symbolic with the same handle.
+///
+/// @tparam KernelHandle A KokkosKernels::Experimental::KokkosKernelsHandle
+/// @tparam RMatrix A KokkosSparse::CrsMatrix
+/// @tparam AMatrix A KokkosSparse::CrsMatrix
+/// @tparam PMatrix A KokkosSparse::CrsMatrix
+/// @tparam CMatrix A KokkosSparse::CrsMatrix with non-const views
+/// @param kh The kernel handle used for spgemm_rap_symbolic
+/// @param R The left matrix
+/// @param A The middle matrix
+/// @param P The right matrix
+/// @param C [in/out] The product from spgemm_rap_symbolic
+///
+template <class KernelHandle, class RMatrix, class AMatrix, class PMatrix,
+          class CMatrix>
+void spgemm_rap_numeric(KernelHandle& kh, const RMatrix& R, const AMatrix& A,
+                        const PMatrix& P, CMatrix& C) {
+  using ExecSpace    = typename KernelHandle::HandleExecSpace;
+  using TempMemSpace = typename KernelHandle::HandleTempMemorySpace;
+
+  Impl::spgemm_rap_check_dimensions("spgemm_rap_numeric", R, A, P);
+  auto sh = kh.get_spgemm_handle();
+  if (!sh || !sh->is_symbolic_called()) {
+    throw std::runtime_error(
+        "Call spgemm_rap_symbolic before calling spgemm_rap_numeric");
+  }
+  if (C.numRows() != R.numRows() || C.numCols() != P.numCols() ||
+      size_t(C.nnz()) != size_t(sh->get_c_nnz())) {
+    throw std::invalid_argument(
+        "KokkosSparse::spgemm_rap_numeric: C does not match the product "
+        "computed by spgemm_rap_symbolic");
+  }
+
+  KokkosSparse::Impl::spgemm_rap_impl<true, ExecSpace, TempMemSpace>(
+      R, A, P, C.graph.row_map, C.graph.entries, C.values);
+  KokkosSparse::sort_crs_matrix(ExecSpace(), C.graph.row_map, C.graph.entries,
+                                C.values);
+  sh->set_call_numeric();
+  sh->set_computed_entries();
+}
+
+///
+/// @brief Triple product C = R*A*P, without symbolic reuse.
+///
+/// @tparam CMatrix A KokkosSparse::CrsMatrix with non-const, managed views
+/// @tparam RMatrix A KokkosSparse::CrsMatrix
+/// @tparam AMatrix A KokkosSparse::CrsMatrix
+/// @tparam PMatrix A KokkosSparse::CrsMatrix
+/// @param R The left matrix
+/// @param A The middle matrix
+/// @param P The right matrix
+/// @return CMatrix The product, with sorted rows
+///
+template <class CMatrix, class RMatrix, class AMatrix, class PMatrix>
+CMatrix spgemm_rap(const RMatrix& R, const AMatrix& A, const PMatrix& P) {
+  using device_type  = typename CMatrix::device_type;
+  using KernelHandle = KokkosKernels::Experimental::KokkosKernelsHandle<
+      typename CMatrix::non_const_size_type,
+      typename CMatrix::non_const_ordinal_type,
+      typename CMatrix::non_const_value_type,
+      typename device_type::execution_space, typename device_type::memory_space,
+      typename device_type::memory_space>;
+
+  KernelHandle kh;
+  kh.create_spgemm_handle();
+  CMatrix C;
+  spgemm_rap_symbolic(kh, R, A, P, C);
+  spgemm_rap_numeric(kh, R, A, P, C);
+  kh.destroy_spgemm_handle();
+  return C;
+}
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPGEMM_RAP_HPP_
@@ -0,0 +1,124 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file
+/// \brief Sparse matrix-matrix multiply C = A*B over a semiring
+///
+
+#ifndef KOKKOSSPARSE_SPGEMM_SEMIRING_HPP_
+#define KOKKOSSPARSE_SPGEMM_SEMIRING_HPP_
+
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_Semiring.hpp"
+#include "KokkosSparse_spgemm_masked.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+namespace Impl {
+
+/// A mask without entries, with the dimensions of A*B: its complement
+/// keeps every entry of the product.
+template <class CMatrix, class AMatrix, class BMatrix>
+CMatrix spgemm_semiring_empty_mask(const AMatrix& A, const BMatrix& B) {
+  using row_map_type = typename CMatrix::row_map_type::non_const_type;
+  using entries_type = typename CMatrix::index_type::non_const_type;
+  using values_type  = typename CMatrix::values_type::non_const_type;
+  return CMatrix("empty mask", A.numRows(), B.numCols(), 0, values_type(),
+                 row_map_type("empty mask row map", A.numRows() + 1),
+                 entries_type());
+}
+
+}  // namespace Impl
+
+///
+/// @brief Symbolic phase of C = A*B over a semiring.
+///
+/// Computes the row map of C and allocates it. The pattern of C is the
+/// pattern of A*B, whatever the semiring.
+///
+/// @tparam KernelHandle A KokkosKernels::Experimental::KokkosKernelsHandle
+/// @tparam AMatrix A KokkosSparse::CrsMatrix
+/// @tparam BMatrix A KokkosSparse::CrsMatrix
+/// @tparam CMatrix A KokkosSparse::CrsMatrix with non-const, managed views
+/// @param kh The kernel handle, with an SpGEMM handle
+/// @param A The left matrix
+/// @param B The right matrix
+/// @param C [out] The product, with its row map computed
+///
+template <class KernelHandle, class AMatrix, class BMatrix, class CMatrix>
+void spgemm_semiring_symbolic(KernelHandle& kh, const AMatrix& A,
+                              const BMatrix& B, CMatrix& C) {
+  spgemm_masked_symbolic(
+      kh, Impl::spgemm_semiring_empty_mask<CMatrix>(A, B), true, A, B, C);
+}
+
+///
+/// @brief Numeric phase of C = A*B over a semiring.
+///
+/// Computes the entries (sorted within each row) and values
+/// C(i, j) = add over k of multiply(A(i, k), B(k, j)), over the stored
+/// entries of A and B only. With MinPlusSemiring and the weighted
+/// adjacency matrix A of a graph, for example, A*A holds the lengths of
+/// the shortest paths of two edges.
+///
+/// The kernel is the dense-accumulator kernel of the masked product, with
+/// an empty complemented mask; it is not instantiated ahead of time (ETI).
+/// A and B can be PatternMatrix (KokkosSparse_PatternMatrix.hpp), whose
+/// entries are all one.
+///
+/// @tparam KernelHandle A KokkosKernels::Experimental::KokkosKernelsHandle
+/// @tparam AMatrix A KokkosSparse::CrsMatrix
+/// @tparam BMatrix A KokkosSparse::CrsMatrix
+/// @tparam CMatrix A KokkosSparse::CrsMatrix with non-const views
+/// @tparam Semiring A semiring over the values of C
+/// @param kh The kernel handle used for spgemm_semiring_symbolic
+/// @param A The left matrix
+/// @param B The right matrix
+/// @param C [in/out] The product from spgemm_semiring_symbolic
+/// @param sr The semiring (only its type is used)
+///
+template <class KernelHandle, class AMatrix, class BMatrix, class CMatrix,
+          class Semiring>
+void spgemm_semiring_numeric(KernelHandle& kh, const AMatrix& A,
+                             const BMatrix& B, CMatrix& C,
+                             const Semiring& sr) {
+  spgemm_masked_numeric(kh, Impl::spgemm_semiring_empty_mask<CMatrix>(A, B),
+                        true, A, B, C, sr);
+}
+
+///
+/// @brief C = A*B over a semiring, without symbolic reuse.
+///
+/// @tparam CMatrix A KokkosSparse::CrsMatrix with non-const, managed views
+/// @tparam AMatrix A KokkosSparse::CrsMatrix
+/// @tparam BMatrix A KokkosSparse::CrsMatrix
+/// @tparam Semiring A semiring over the values of C
+/// @param A The left matrix
+/// @param B The right matrix
+/// @param sr The semiring (only its type is used)
+/// @return CMatrix The product, with sorted rows
+///
+template <class CMatrix, class AMatrix, class BMatrix, class Semiring>
+CMatrix spgemm_semiring(const AMatrix& A, const BMatrix& B,
+                        const Semiring& sr) {
+  return spgemm_masked<CMatrix>(
+      Impl::spgemm_semiring_empty_mask<CMatrix>(A, B), true, A, B, sr);
+}
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPGEMM_SEMIRING_HPP_
@@ -17,17 +17,23 @@
 #define _KOKKOS_SPGEMM_SYMBOLIC_HPP
 
 #include "KokkosKernels_helpers.hpp"
+#include "KokkosKernels_DispatchTrace.hpp"
 #include "KokkosSparse_spgemm_symbolic_spec.hpp"
+#include "KokkosSparse_spgemm_select_impl.hpp"
 #include "KokkosSparse_Utils.hpp"
 
 namespace KokkosSparse {
 
 namespace Experimental {
 
-template <typename KernelHandle, typename alno_row_view_t_,
+/// \brief spgemm_symbolic on the given execution space instance: the
+/// kernels, temporary allocations and TPL calls of the symbolic phase are
+/// issued on space, which is only fenced where the number of entries of C
+/// has to be read back on the host.
+template <typename ExecSpace, typename KernelHandle, typename alno_row_view_t_,
           typename alno_nnz_view_t_, typename blno_row_view_t_,
           typename blno_nnz_view_t_, typename clno_row_view_t_>
-void spgemm_symbolic(KernelHandle *handle,
+void spgemm_symbolic(const ExecSpace &space, KernelHandle *handle,
                      typename KernelHandle::const_nnz_lno_t m,
                      typename KernelHandle::const_nnz_lno_t n,
                      typename KernelHandle::const_nnz_lno_t k,
@@ -35,6 +41,11 @@ void spgemm_symbolic(KernelHandle *handle,
                      bool transposeA, blno_row_view_t_ row_mapB,
                      blno_nnz_view_t_ entriesB, bool transposeB,
                      clno_row_view_t_ row_mapC, bool computeRowptrs = false) {
+  static_assert(
+      std::is_same<ExecSpace, typename KernelHandle::HandleExecSpace>::value,
+      "KokkosSparse::spgemm_symbolic: ExecSpace must be the execution space "
+      "of the KernelHandle.");
+
   static_assert(
       std::is_same<typename clno_row_view_t_::value_type,
                    typename clno_row_view_t_::non_const_value_type>::value,
@@ -179,7 +190,37 @@ void spgemm_symbolic(KernelHandle *handle,
         "passed to the first spgemm_symbolic call.");
   }
 
+  KokkosKernels::Experimental::HandleTelemetry::Scope<ExecSpace>
+      telemetryScope(&spgemmHandle->get_telemetry(), "symbolic", space);
+  KokkosKernels::Impl::DispatchTrace<ExecSpace> trace("spgemm_symbolic",
+                                                      space);
+  // Pick the algorithm with the cost model if none was requested, where the
+  // native implementation runs (a TPL chooses its own)
+  const bool selecting = spgemmHandle->is_algorithm_selection_pending() &&
+                         !transposeA && !transposeB &&
+                         !spgemmHandle->is_symbolic_called();
+  if (selecting &&
+      !KokkosSparse::Impl::spgemm_symbolic_tpl_spec_avail<
+          const_handle_type, Internal_alno_row_view_t_,
+          Internal_alno_nnz_view_t_, Internal_blno_row_view_t_,
+          Internal_blno_nnz_view_t_, Internal_clno_row_view_t_>::value) {
+    KokkosSparse::Impl::spgemm_select(space, tmp_handle, m, n, k, const_a_r,
+                                      const_a_l, const_b_r, const_b_l);
+    trace.set_detail(KokkosSparse::Impl::spgemm_selection_json(
+        spgemmHandle->get_algorithm_selection_result()));
+  }
+  KokkosSparse::Impl::spgemm_apply_selected_launch(tmp_handle);
   auto algo = spgemmHandle->get_algorithm_type();
+  if (trace.is_enabled()) {
+    trace.set_dims(m, k, entriesA.extent(0));
+    trace.set_algorithm(get_spgemm_algorithm_name(algo));
+    trace.set_tpl(algo != SPGEMM_DEBUG && algo != SPGEMM_SERIAL &&
+                  KokkosSparse::Impl::spgemm_symbolic_tpl_spec_avail<
+                      const_handle_type, Internal_alno_row_view_t_,
+                      Internal_alno_nnz_view_t_, Internal_blno_row_view_t_,
+                      Internal_blno_nnz_view_t_,
+                      Internal_clno_row_view_t_>::value);
+  }
 
   if (algo == SPGEMM_DEBUG || algo == SPGEMM_SERIAL) {
     // Never call a TPL if serial/debug is requested (this is needed for
@@ -189,7 +230,7 @@ void spgemm_symbolic(KernelHandle *handle,
         Internal_alno_row_view_t_, Internal_alno_nnz_view_t_,
         Internal_blno_row_view_t_, Internal_blno_nnz_view_t_,
         Internal_clno_row_view_t_,
-        false>::spgemm_symbolic(&tmp_handle,  // handle,
+        false>::spgemm_symbolic(space, &tmp_handle,  // handle,
                                 m, n, k, const_a_r, const_a_l, transposeA,
                                 const_b_r, const_b_l, transposeB, c_r,
                                 computeRowptrs);
@@ -198,13 +239,32 @@ void spgemm_symbolic(KernelHandle *handle,
         const_handle_type,  // KernelHandle,
         Internal_alno_row_view_t_, Internal_alno_nnz_view_t_,
         Internal_blno_row_view_t_, Internal_blno_nnz_view_t_,
-        Internal_clno_row_view_t_>::spgemm_symbolic(&tmp_handle,  // handle,
+        Internal_clno_row_view_t_>::spgemm_symbolic(space,
+                                                    &tmp_handle,  // handle,
                                                     m, n, k, const_a_r,
                                                     const_a_l, transposeA,
                                                     const_b_r, const_b_l,
                                                     transposeB, c_r,
                                                     computeRowptrs);
   }
+  trace.set_launch(spgemmHandle->get_suggested_team_size(),
+                   spgemmHandle->get_suggested_vector_size());
+}
+
+template <typename KernelHandle, typename alno_row_view_t_,
+          typename alno_nnz_view_t_, typename blno_row_view_t_,
+          typename blno_nnz_view_t_, typename clno_row_view_t_>
+void spgemm_symbolic(KernelHandle *handle,
+                     typename KernelHandle::const_nnz_lno_t m,
+                     typename KernelHandle::const_nnz_lno_t n,
+                     typename KernelHandle::const_nnz_lno_t k,
+                     alno_row_view_t_ row_mapA, alno_nnz_view_t_ entriesA,
+                     bool transposeA, blno_row_view_t_ row_mapB,
+                     blno_nnz_view_t_ entriesB, bool transposeB,
+                     clno_row_view_t_ row_mapC, bool computeRowptrs = false) {
+  spgemm_symbolic(typename KernelHandle::HandleExecSpace(), handle, m, n, k,
+                  row_mapA, entriesA, transposeA, row_mapB, entriesB,
+                  transposeB, row_mapC, computeRowptrs);
 }
 
 }  // namespace Experimental
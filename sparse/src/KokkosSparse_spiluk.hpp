@@ -20,11 +20,17 @@
 /// This file provides KokkosSparse::spiluk.  This function performs a
 /// local (no MPI) sparse ILU(k) on matrices stored in
 /// compressed row sparse ("Crs") format.
+///
+/// spiluk_numeric also accepts L and U values of a lower precision than the
+/// handle's scalar type (e.g. float factors of a double matrix), to halve the
+/// memory traffic of applying the factors: the factorization runs in the
+/// working precision, and the factors are rounded at the end.
 
 #ifndef KOKKOSSPARSE_SPILUK_HPP_
 #define KOKKOSSPARSE_SPILUK_HPP_
 
 #include <type_traits>
+#include <vector>
 
 //#include "KokkosSparse_spiluk_handle.hpp"
 #include "KokkosKernels_helpers.hpp"
@@ -281,10 +287,11 @@ void spiluk_numeric(KernelHandle* handle,
                     typename LEntriesType::non_const_value_type, ordinal_type),
                 "spiluk_numeric: L entry type must match KernelHandle entry "
                 "type (aka nnz_lno_t, and const doesn't matter)");
-  static_assert(KOKKOSKERNELS_SPILUK_SAME_TYPE(typename LValuesType::value_type,
-                                               scalar_type),
+  static_assert(KokkosKernels::Impl::is_same_or_lower_precision_v<
+                    typename LValuesType::value_type, scalar_type>,
                 "spiluk_numeric: L scalar type must match KernelHandle entry "
-                "type (aka nnz_lno_t, and const doesn't matter)");
+                "type (aka nnz_scalar_t), or be a lower precision of it "
+                "(const doesn't matter)");
 
   static_assert(KOKKOSKERNELS_SPILUK_SAME_TYPE(
                     typename URowMapType::non_const_value_type, size_type),
@@ -294,10 +301,11 @@ void spiluk_numeric(KernelHandle* handle,
                     typename UEntriesType::non_const_value_type, ordinal_type),
                 "spiluk_numeric: U entry type must match KernelHandle entry "
                 "type (aka nnz_lno_t, and const doesn't matter)");
-  static_assert(KOKKOSKERNELS_SPILUK_SAME_TYPE(typename UValuesType::value_type,
-                                               scalar_type),
+  static_assert(KokkosKernels::Impl::is_same_or_lower_precision_v<
+                    typename UValuesType::value_type, scalar_type>,
                 "spiluk_numeric: U scalar type must match KernelHandle entry "
-                "type (aka nnz_lno_t, and const doesn't matter)");
+                "type (aka nnz_scalar_t), or be a lower precision of it "
+                "(const doesn't matter)");
 
   static_assert(Kokkos::is_view<ARowMapType>::value,
                 "spiluk_numeric: A_rowmap is not a Kokkos::View.");
@@ -433,6 +441,27 @@ void spiluk_numeric(KernelHandle* handle,
     KokkosKernels::Impl::throw_runtime_exception(os.str());
   }
 
+  // L and U stored in a lower precision: factor in the working precision,
+  // then round the factors
+  if constexpr (!KOKKOSKERNELS_SPILUK_SAME_TYPE(
+                    typename LValuesType::value_type, scalar_type) ||
+                !KOKKOSKERNELS_SPILUK_SAME_TYPE(
+                    typename UValuesType::value_type, scalar_type)) {
+    using work_values_t =
+        Kokkos::View<scalar_type*, typename LValuesType::device_type>;
+    work_values_t L_work(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "spiluk L_work"),
+        L_values.extent(0));
+    work_values_t U_work(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "spiluk U_work"),
+        U_values.extent(0));
+    spiluk_numeric(handle, fill_lev, A_rowmap, A_entries, A_values, L_rowmap,
+                   L_entries, L_work, U_rowmap, U_entries, U_work);
+    Kokkos::deep_copy(L_values, L_work);
+    Kokkos::deep_copy(U_values, U_work);
+    return;
+  }
+
   typedef typename KernelHandle::const_size_type c_size_t;
   typedef typename KernelHandle::const_nnz_lno_t c_lno_t;
   typedef typename KernelHandle::const_nnz_scalar_t c_scalar_t;
@@ -992,6 +1021,33 @@ void spiluk_numeric_streams(const std::vector<ExecutionSpace>& execspace_v,
 
 }  // spiluk_numeric_streams
 
+/// \brief spiluk_numeric on the given execution space instance: all the
+/// kernels of the factorization are launched on space, and nothing is
+/// fenced, so factorizations on different instances can overlap.
+///
+/// L and U must be stored in the working precision of the handle.
+template <class ExecutionSpace, typename KernelHandle, typename ARowMapType,
+          typename AEntriesType, typename AValuesType, typename LRowMapType,
+          typename LEntriesType, typename LValuesType, typename URowMapType,
+          typename UEntriesType, typename UValuesType>
+void spiluk_numeric(const ExecutionSpace& space, KernelHandle* handle,
+                    typename KernelHandle::const_nnz_lno_t fill_lev,
+                    ARowMapType& A_rowmap, AEntriesType& A_entries,
+                    AValuesType& A_values, LRowMapType& L_rowmap,
+                    LEntriesType& L_entries, LValuesType& L_values,
+                    URowMapType& U_rowmap, UEntriesType& U_entries,
+                    UValuesType& U_values) {
+  std::vector<LValuesType> L_values_v{L_values};
+  std::vector<UValuesType> U_values_v{U_values};
+  spiluk_numeric_streams(
+      std::vector<ExecutionSpace>{space}, std::vector<KernelHandle*>{handle},
+      fill_lev, std::vector<ARowMapType>{A_rowmap},
+      std::vector<AEntriesType>{A_entries}, std::vector<AValuesType>{A_values},
+      std::vector<LRowMapType>{L_rowmap}, std::vector<LEntriesType>{L_entries},
+      L_values_v, std::vector<URowMapType>{U_rowmap},
+      std::vector<UEntriesType>{U_entries}, U_values_v);
+}  // spiluk_numeric
+
 }  // namespace Experimental
 }  // namespace KokkosSparse
 
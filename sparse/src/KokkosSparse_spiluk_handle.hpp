@@ -16,8 +16,10 @@
 
 #include <Kokkos_Core.hpp>
 #include <iostream>
+#include <stdexcept>
 #include <string>
 #include <KokkosKernels_HashmapAccumulator.hpp>
+#include <KokkosKernels_PlanIO.hpp>
 
 #ifndef _SPILUKHANDLE_HPP
 #define _SPILUKHANDLE_HPP
@@ -28,8 +30,11 @@ namespace KokkosSparse {
 namespace Experimental {
 
 // TP2 algorithm has issues with some offset-ordinal combo to be addressed
+// SEQLVLSCHD_TP1_DEVICE_SYMBOLIC: SEQLVLSCHD_TP1 with the symbolic phase
+// (fill pattern and level sets) computed on the device
 enum class SPILUKAlgorithm {
-  SEQLVLSCHD_TP1 /*, SEQLVLSCHED_TP2*/
+  SEQLVLSCHD_TP1 /*, SEQLVLSCHED_TP2*/,
+  SEQLVLSCHD_TP1_DEVICE_SYMBOLIC
 };
 
 template <class size_type_, class lno_t_, class scalar_t_, class ExecutionSpace,
@@ -254,9 +259,84 @@ class SPILUKHandle {
   void set_vector_size(const int vs) { this->vector_size = vs; }
   int get_vector_size() const { return this->vector_size; }
 
+  /// \brief Save the fill pattern and level schedule computed by
+  /// spiluk_symbolic, for load() to restore later instead of calling
+  /// spiluk_symbolic again.
+  ///
+  /// L and U are the graphs of the factors computed by spiluk_symbolic.
+  template <class LRowMapType, class LEntriesType, class URowMapType,
+            class UEntriesType>
+  void save(std::ostream &os, const LRowMapType &L_row_map,
+            const LEntriesType &L_entries, const URowMapType &U_row_map,
+            const UEntriesType &U_entries) const {
+    if (!symbolic_complete)
+      throw std::runtime_error(
+          "SPILUKHandle::save: spiluk_symbolic has not been called");
+    using namespace KokkosKernels::Impl;
+    write_plan_header(os, "SPILUKHandle");
+    write_plan_value(os, static_cast<int32_t>(algm));
+    write_plan_value(os, nrows);
+    write_plan_value(os, nlevels);
+    write_plan_value(os, nnzL);
+    write_plan_value(os, nnzU);
+    write_plan_value(os, block_size);
+    write_plan_value(os, level_maxrows);
+    write_plan_value(os, level_maxrowsperchunk);
+    write_plan_value(os, static_cast<uint64_t>(iw.extent(0)));
+    write_plan_value(os, static_cast<uint64_t>(iw.extent(1)));
+    write_plan_view(os, level_list);
+    write_plan_view(os, level_idx);
+    write_plan_view(os, level_ptr);
+    write_plan_view(os, hlevel_ptr);
+    write_plan_view(os, level_nchunks);
+    write_plan_view(os, level_nrowsperchunk);
+    write_plan_view(os, L_row_map);
+    write_plan_view(os, L_entries);
+    write_plan_view(os, U_row_map);
+    write_plan_view(os, U_entries);
+  }
+
+  /// \brief Restore a plan written by save() into this handle and into the
+  /// graphs of L and U, which are reallocated if their sizes differ.
+  /// spiluk_numeric can then be called directly.
+  template <class LRowMapType, class LEntriesType, class URowMapType,
+            class UEntriesType>
+  void load(std::istream &is, LRowMapType &L_row_map, LEntriesType &L_entries,
+            URowMapType &U_row_map, UEntriesType &U_entries) {
+    using namespace KokkosKernels::Impl;
+    read_plan_header(is, "SPILUKHandle");
+    if (read_plan_value<int32_t>(is) != static_cast<int32_t>(algm))
+      throw std::runtime_error(
+          "SPILUKHandle::load: plan was saved with another algorithm");
+    nrows                  = read_plan_value<size_type>(is);
+    nlevels                = read_plan_value<size_type>(is);
+    nnzL                   = read_plan_value<size_type>(is);
+    nnzU                   = read_plan_value<size_type>(is);
+    block_size             = read_plan_value<size_type>(is);
+    level_maxrows          = read_plan_value<size_type>(is);
+    level_maxrowsperchunk  = read_plan_value<size_type>(is);
+    const uint64_t iw_rows = read_plan_value<uint64_t>(is);
+    const uint64_t iw_cols = read_plan_value<uint64_t>(is);
+    read_plan_view(is, level_list);
+    read_plan_view(is, level_idx);
+    read_plan_view(is, level_ptr);
+    read_plan_view(is, hlevel_ptr);
+    read_plan_view(is, level_nchunks);
+    read_plan_view(is, level_nrowsperchunk);
+    read_plan_view(is, L_row_map);
+    read_plan_view(is, L_entries);
+    read_plan_view(is, U_row_map);
+    read_plan_view(is, U_entries);
+    // The workspace holds no symbolic data, only its size
+    alloc_iw(iw_rows, iw_cols);
+    set_symbolic_complete();
+  }
+
   void print_algorithm() {
     if (algm == SPILUKAlgorithm::SEQLVLSCHD_TP1)
       std::cout << "SEQLVLSCHD_TP1" << std::endl;
+    if (algm == SPILUKAlgorithm::SEQLVLSCHD_TP1_DEVICE_SYMBOLIC)
+      std::cout << "SEQLVLSCHD_TP1_DEVICE_SYMBOLIC" << std::endl;
 
     /*if ( algm == SPILUKAlgorithm::SEQLVLSCHED_TP2 ) {
       std::cout << "SEQLVLSCHED_TP2" << std::endl;;
@@ -26,12 +26,23 @@
 #include "KokkosSparse_spmv_spec.hpp"
 #include "KokkosSparse_spmv_struct_spec.hpp"
 #include "KokkosSparse_spmv_bsrmatrix_spec.hpp"
+#include "KokkosSparse_spmv_ccs_impl.hpp"
+#include "KokkosSparse_spmv_sell_impl.hpp"
+#include "KokkosSparse_spmv_delta_impl.hpp"
+#include "KokkosSparse_spmv_stencil_impl.hpp"
+#include "KokkosSparse_spmv_vbr_impl.hpp"
 #include <type_traits>
 #include "KokkosSparse_BsrMatrix.hpp"
 #include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_CcsMatrix.hpp"
+#include "KokkosSparse_SellMatrix.hpp"
+#include "KokkosSparse_DeltaCrsMatrix.hpp"
+#include "KokkosSparse_StencilMatrix.hpp"
+#include "KokkosSparse_VbrMatrix.hpp"
 #include "KokkosBlas1_scal.hpp"
 #include "KokkosKernels_Utils.hpp"
 #include "KokkosKernels_Error.hpp"
+#include "KokkosKernels_DispatchTrace.hpp"
 
 namespace KokkosSparse {
 
@@ -40,6 +51,18 @@ struct RANK_ONE {};
 struct RANK_TWO {};
 }  // namespace
 
+namespace Impl {
+// Profiling region label of a native spmv: the matrix kind, the algorithm
+// selected in the handle and the scalar type
+template <class AMatrix, class Handle>
+std::string spmv_native_label(const char* kind, const Handle* handle) {
+  return std::string("KokkosSparse::spmv[NATIVE,") + kind +
+         get_spmv_algorithm_name(handle->get_algorithm()) + "," +
+         Kokkos::ArithTraits<typename AMatrix::non_const_value_type>::name() +
+         "]";
+}
+}  // namespace Impl
+
 // clang-format off
 /// \brief Kokkos sparse matrix-vector multiply.
 /// Computes y := alpha*Op(A)*x + beta*y, where Op(A) is
@@ -73,7 +96,9 @@ struct RANK_TWO {};
 /// \param y [in/out] Result vector.
 // clang-format on
 template <class ExecutionSpace, class Handle, class AlphaType, class AMatrix,
-          class XVector, class BetaType, class YVector>
+          class XVector, class BetaType, class YVector,
+          std::enable_if_t<!Impl::is_native_only_spmv_matrix_v<AMatrix>,
+                           int> = 0>
 void spmv(const ExecutionSpace& space, Handle* handle, const char mode[],
           const AlphaType& alpha, const AMatrix& A, const XVector& x,
           const BetaType& beta, const YVector& y) {
@@ -175,6 +200,97 @@ void spmv(const ExecutionSpace& space, Handle* handle, const char mode[],
   // Get the "impl" parent class of Handle, if it's not already the impl
   using HandleImpl = typename Handle::ImplType;
 
+  // Telemetry is recorded once, on the user-facing handle, so that the
+  // internal calls made below on candidate or transpose handles do not count
+  // twice
+  HandleImpl* telemetryHandle = nullptr;
+  if constexpr (KokkosSparse::Impl::is_spmv_handle_v<Handle>)
+    telemetryHandle = handle->get_impl();
+  KokkosKernels::Experimental::HandleTelemetry::Scope<ExecutionSpace>
+      telemetryScope(telemetryHandle ? &telemetryHandle->telemetry : nullptr,
+                     "spmv", space);
+
+  // With cache_transpose, A^T is stored explicitly in the handle and
+  // transposed modes use the (atomic-free) non-transposed kernels on it:
+  // A^T x = (A^T) x and A^H x = conj(A^T) x.
+  if constexpr (!isBSR) {
+    if (handle->cache_transpose && (mode[0] == Transpose[0] ||
+                                    mode[0] == ConjugateTranspose[0])) {
+      if (!handle->has_cached_transpose()) handle->build_cached_transpose(A);
+      spmv(space, handle->transpose_handle,
+           mode[0] == Transpose[0] ? NoTranspose : Conjugate, alpha,
+           handle->transpose, x, beta, y);
+      return;
+    }
+  }
+
+  // With auto_block, the first call checks whether A is cheaper to apply as a
+  // BsrMatrix and if so, all calls use the BSR kernels on the copy of A kept
+  // in the handle.
+  if constexpr (!isBSR) {
+    if (handle->auto_block) {
+      if (!handle->is_auto_block_detected()) handle->build_auto_block(A);
+      if (handle->has_auto_block()) {
+        spmv(space, handle->block_handle, mode, alpha, handle->block, x, beta,
+             y);
+        return;
+      }
+    }
+  }
+
+  // SPMV_AUTOTUNE: forward to one of the candidate handles, timing the
+  // non-transposed calls until the fastest candidate has been found.
+  if (handle->get_algorithm() == SPMV_AUTOTUNE) {
+    if (handle->autotune_candidates.empty()) {
+      if constexpr (isBSR) {
+        handle->add_autotune_candidate(SPMV_BSR_V41);
+        handle->add_autotune_candidate(SPMV_BSR_V42);
+        handle->add_autotune_candidate(SPMV_MERGE_PATH);
+        if constexpr (XVector::rank() == 2)
+          handle->add_autotune_candidate(SPMV_MV_TILED);
+      } else {
+        handle->add_autotune_candidate(SPMV_NATIVE);
+        // For multivectors, merge path is only used when x has one column
+        if constexpr (XVector::rank() == 1)
+          handle->add_autotune_candidate(SPMV_MERGE_PATH);
+        else
+          handle->add_autotune_candidate(SPMV_MV_TILED);
+        if constexpr (KokkosKernels::Impl::kk_is_gpu_exec_space<
+                          ExecutionSpace>()) {
+          for (int vector_length : {2, 8, 32})
+            handle->add_autotune_candidate(SPMV_NATIVE, vector_length);
+        } else {
+          handle->add_autotune_candidate(SPMV_NATIVE, -1, true);
+          if constexpr (XVector::rank() == 1)
+            handle->add_autotune_candidate(SPMV_NNZ_BALANCED);
+        }
+      }
+#if defined(KOKKOSKERNELS_ENABLE_TPL_CUSPARSE) ||  \
+    defined(KOKKOSKERNELS_ENABLE_TPL_ROCSPARSE) || \
+    defined(KOKKOSKERNELS_ENABLE_TPL_MKL)
+      handle->add_autotune_candidate(SPMV_DEFAULT);
+#endif
+    }
+    bool timed = false;
+    int c      = handle->autotune_next_candidate(timed);
+    HandleImpl* candidate = handle->autotune_candidates[c].handle;
+    // Transposed modes use a different kernel, so they do not count towards
+    // the timing of the non-transposed kernels
+    if (mode[0] != NoTranspose[0] && !handle->is_autotuning_done()) {
+      spmv(space, handle->autotune_candidates[0].handle, mode, alpha, A, x,
+           beta, y);
+      return;
+    }
+    if (timed) space.fence();
+    Kokkos::Timer timer;
+    spmv(space, candidate, mode, alpha, A, x, beta, y);
+    if (!handle->is_autotuning_done()) {
+      if (timed) space.fence();
+      handle->autotune_record(c, timed, timer.seconds());
+    }
+    return;
+  }
+
   using ACrs_Internal = CrsMatrix<
       typename AMatrix::const_value_type, typename AMatrix::const_ordinal_type,
       typename AMatrix::device_type, Kokkos::MemoryTraits<Kokkos::Unmanaged>,
@@ -225,6 +341,11 @@ void spmv(const ExecutionSpace& space, Handle* handle, const char mode[],
   YVector_Internal y_i(y);
 
   bool useNative = is_spmv_algorithm_native(handle->get_algorithm());
+  // Mixed precision (A's values less precise than x and y) is only supported
+  // by the native implementation
+  if constexpr (!std::is_same_v<typename AMatrix::non_const_value_type,
+                                typename YVector::non_const_value_type>)
+    useNative = true;
   // Also use the native algorithm if SPMV_FAST_SETUP was selected and
   // rocSPARSE is the possible TPL to use. Native is faster in this case.
 #ifdef KOKKOSKERNELS_ENABLE_TPL_ROCSPARSE
@@ -233,6 +354,18 @@ void spmv(const ExecutionSpace& space, Handle* handle, const char mode[],
     useNative = true;
 #endif
 
+  KokkosKernels::Impl::DispatchTrace<ExecutionSpace> trace("spmv", space);
+  if (trace.is_enabled()) {
+    trace.set_dims(m, n, A.nnz());
+    trace.set_algorithm(get_spmv_algorithm_name(handle->get_algorithm()));
+    int vector_length = handle->vector_length;
+    if (vector_length <= 0)
+      vector_length = KokkosKernels::Impl::kk_get_suggested_vector_size(
+          m, A.nnz(),
+          KokkosKernels::Impl::kk_get_exec_space_type<ExecutionSpace>());
+    trace.set_launch(handle->team_size, vector_length);
+  }
+
   // Now call the proper implementation depending on isBSR and the rank of X/Y
   if constexpr (!isBSR) {
     if constexpr (XVector::rank() == 1) {
@@ -274,14 +407,17 @@ void spmv(const ExecutionSpace& space, Handle* handle, const char mode[],
       }
 #endif
 #endif
-      if (useNative) {
+      // Without a TPL for these types the default path is native too; name it
+      // as such so a trace shows which implementation ran
+      constexpr bool tplAvail =
+          Impl::spmv_tpl_spec_avail<ExecutionSpace, HandleImpl,
+                                    AMatrix_Internal, XVector_Internal,
+                                    YVector_Internal>::value;
+      trace.set_tpl(!useNative && tplAvail);
+      if (useNative || !tplAvail) {
         // Explicitly call the non-TPL SPMV implementation
-        std::string label =
-            "KokkosSparse::spmv[NATIVE," +
-            Kokkos::ArithTraits<
-                typename AMatrix_Internal::non_const_value_type>::name() +
-            "]";
-        Kokkos::Profiling::pushRegion(label);
+        Kokkos::Profiling::pushRegion(
+            Impl::spmv_native_label<AMatrix_Internal>("", handle));
         Impl::SPMV<ExecutionSpace, HandleImpl, AMatrix_Internal,
                    XVector_Internal, YVector_Internal, false>::spmv(space,
                                                                     handle,
@@ -305,14 +441,15 @@ void spmv(const ExecutionSpace& space, Handle* handle, const char mode[],
       useNative = useNative || (Conjugate[0] == mode[0]);
 #endif
 
-      if (useNative) {
-        std::string label =
-            "KokkosSparse::spmv[NATIVE,MV," +
-            Kokkos::ArithTraits<
-                typename AMatrix_Internal::non_const_value_type>::name() +
-            "]";
-        Kokkos::Profiling::pushRegion(label);
-        return Impl::SPMV_MV<
+      constexpr bool tplAvail =
+          Impl::spmv_mv_tpl_spec_avail<ExecutionSpace, HandleImpl,
+                                       AMatrix_Internal, XVector_Internal,
+                                       YVector_Internal>::value;
+      trace.set_tpl(!useNative && tplAvail);
+      if (useNative || !tplAvail) {
+        Kokkos::Profiling::pushRegion(
+            Impl::spmv_native_label<AMatrix_Internal>("MV,", handle));
+        Impl::SPMV_MV<
             ExecutionSpace, HandleImpl, AMatrix_Internal, XVector_Internal,
             YVector_Internal,
             std::is_integral<typename AMatrix_Internal::value_type>::value,
@@ -355,14 +492,16 @@ void spmv(const ExecutionSpace& space, Handle* handle, const char mode[],
         useNative = useNative || (mode[0] != NoTranspose[0]);
       }
 #endif
-      if (useNative) {
+      constexpr bool tplAvail =
+          Impl::spmv_bsrmatrix_tpl_spec_avail<ExecutionSpace, HandleImpl,
+                                              AMatrix_Internal,
+                                              XVector_Internal,
+                                              YVector_Internal>::value;
+      trace.set_tpl(!useNative && tplAvail);
+      if (useNative || !tplAvail) {
         // Explicitly call the non-TPL SPMV_BSRMATRIX implementation
-        std::string label =
-            "KokkosSparse::spmv[NATIVE,BSRMATRIX," +
-            Kokkos::ArithTraits<
-                typename AMatrix_Internal::non_const_value_type>::name() +
-            "]";
-        Kokkos::Profiling::pushRegion(label);
+        Kokkos::Profiling::pushRegion(
+            Impl::spmv_native_label<AMatrix_Internal>("BSRMATRIX,", handle));
         Impl::SPMV_BSRMATRIX<ExecutionSpace, HandleImpl, AMatrix_Internal,
                              XVector_Internal, YVector_Internal,
                              false>::spmv_bsrmatrix(space, handle, mode, alpha,
@@ -395,14 +534,16 @@ void spmv(const ExecutionSpace& space, Handle* handle, const char mode[],
         useNative = useNative || (mode[0] == Conjugate[0]);
       }
 #endif
-      if (useNative) {
+      constexpr bool tplAvail =
+          Impl::spmv_mv_bsrmatrix_tpl_spec_avail<ExecutionSpace, HandleImpl,
+                                                 AMatrix_Internal,
+                                                 XVector_Internal,
+                                                 YVector_Internal>::value;
+      trace.set_tpl(!useNative && tplAvail);
+      if (useNative || !tplAvail) {
         // Explicitly call the non-TPL SPMV_BSRMATRIX implementation
-        std::string label =
-            "KokkosSparse::spmv[NATIVE,MV,BSMATRIX," +
-            Kokkos::ArithTraits<
-                typename AMatrix_Internal::non_const_value_type>::name() +
-            "]";
-        Kokkos::Profiling::pushRegion(label);
+        Kokkos::Profiling::pushRegion(Impl::spmv_native_label<AMatrix_Internal>(
+            "MV,BSRMATRIX,", handle));
         Impl::SPMV_MV_BSRMATRIX<
             ExecutionSpace, HandleImpl, AMatrix_Internal, XVector_Internal,
             YVector_Internal,
@@ -423,6 +564,129 @@ void spmv(const ExecutionSpace& space, Handle* handle, const char mode[],
   }
 }
 
+// clang-format off
+/// \brief Kokkos sparse matrix-vector multiply for a compressed sparse column
+/// matrix, a sliced ELLPACK matrix, a CRS matrix with delta-encoded column
+/// indices, a structured-grid stencil or a variable block row matrix.
+/// Computes y := alpha*Op(A)*x + beta*y, where Op(A) is
+/// controlled by mode (see below).
+///
+/// This overload has the same interface as the CrsMatrix/BsrMatrix version above.
+/// CcsMatrix, SellMatrix, DeltaCrsMatrix, StencilMatrix and VbrMatrix each have a single native implementation,
+/// which is not ETI'd, so the handle only carries the (validated) algorithm choice. Multivectors
+/// are applied one column at a time.
+///
+/// For a CcsMatrix, the transposed modes ("T", "H") are a row-parallel gather over the columns of A,
+/// as fast as the non-transposed CRS kernel, and the others scatter each column into y with atomics.
+///
+/// \param space [in] The execution space instance on which to run the
+///   kernel.
+/// \param handle [in/out] a pointer to a KokkosSparse::SPMVHandle.
+/// \param mode [in] Select A's operator mode: "N" for normal, "T" for
+///   transpose, "C" for conjugate or "H" for conjugate transpose.
+/// \param alpha [in] Scalar multiplier for the matrix A.
+/// \param A [in] The sparse matrix A, a KokkosSparse::CcsMatrix,
+///   KokkosSparse::Experimental::SellMatrix,
+///   KokkosSparse::Experimental::DeltaCrsMatrix, KokkosSparse::Experimental::StencilMatrix or
+///   KokkosSparse::Experimental::VbrMatrix.
+/// \param x [in] A vector to multiply on the left by A.
+/// \param beta [in] Scalar multiplier for the vector y.
+/// \param y [in/out] Result vector.
+// clang-format on
+template <class ExecutionSpace, class Handle, class AlphaType, class AMatrix,
+          class XVector, class BetaType, class YVector,
+          std::enable_if_t<Impl::is_native_only_spmv_matrix_v<AMatrix>, int> =
+              0>
+void spmv(const ExecutionSpace& space, Handle* handle, const char mode[],
+          const AlphaType& alpha, const AMatrix& A, const XVector& x,
+          const BetaType& beta, const YVector& y) {
+  static_assert(Kokkos::is_view<XVector>::value,
+                "KokkosSparse::spmv: XVector must be a Kokkos::View.");
+  static_assert(Kokkos::is_view<YVector>::value,
+                "KokkosSparse::spmv: YVector must be a Kokkos::View.");
+  static_assert(
+      Kokkos::SpaceAccessibility<ExecutionSpace,
+                                 typename AMatrix::memory_space>::accessible,
+      "KokkosSparse::spmv: AMatrix must be accessible from ExecutionSpace");
+  static_assert(
+      Kokkos::SpaceAccessibility<ExecutionSpace,
+                                 typename XVector::memory_space>::accessible,
+      "KokkosSparse::spmv: XVector must be accessible from ExecutionSpace");
+  static_assert(
+      Kokkos::SpaceAccessibility<ExecutionSpace,
+                                 typename YVector::memory_space>::accessible,
+      "KokkosSparse::spmv: YVector must be accessible from ExecutionSpace");
+  static_assert(XVector::rank() == YVector::rank(),
+                "KokkosSparse::spmv: Vector ranks do not match.");
+  static_assert(XVector::rank() == size_t(1) || XVector::rank() == size_t(2),
+                "KokkosSparse::spmv: Both Vector inputs must have rank 1 or 2");
+  static_assert(!std::is_const_v<typename YVector::value_type>,
+                "KokkosSparse::spmv: Output Vector must be non-const.");
+  if constexpr (KokkosSparse::Impl::is_spmv_handle_v<Handle>) {
+    static_assert(
+        std::is_same_v<AMatrix, typename Handle::AMatrixType>,
+        "KokkosSparse::spmv: AMatrix must be identical to Handle::AMatrixType");
+  }
+  (void)handle;
+
+  const size_t m = A.numRows();
+  const size_t n = A.numCols();
+  const bool transposed =
+      (mode[0] != NoTranspose[0]) && (mode[0] != Conjugate[0]);
+  if ((x.extent(1) != y.extent(1)) || ((transposed ? m : n) != x.extent(0)) ||
+      ((transposed ? n : m) != y.extent(0))) {
+    std::ostringstream os;
+    os << "KokkosSparse::spmv: Dimensions do not match ("
+       << Impl::spmv_matrix_format_name<AMatrix>() << "): "
+       << "A: " << m << " x " << n << ", mode: " << mode
+       << ", x: " << x.extent(0) << " x " << x.extent(1)
+       << ", y: " << y.extent(0) << " x " << y.extent(1);
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  if (alpha == Kokkos::ArithTraits<AlphaType>::zero() || m == 0 || n == 0 ||
+      A.nnz() == 0) {
+    if (beta == Kokkos::ArithTraits<BetaType>::zero())
+      Kokkos::deep_copy(space, y, Kokkos::ArithTraits<BetaType>::zero());
+    else
+      KokkosBlas::scal(space, y, beta, y);
+    return;
+  }
+
+  if constexpr (is_ccs_matrix_v<AMatrix>) {
+    Kokkos::Profiling::pushRegion(
+        "KokkosSparse::spmv[NATIVE,CCS," +
+        Kokkos::ArithTraits<typename AMatrix::non_const_value_type>::name() +
+        "]");
+    Impl::spmv_ccs(space, mode, alpha, A, x, beta, y);
+  } else if constexpr (Experimental::is_sell_matrix_v<AMatrix>) {
+    Kokkos::Profiling::pushRegion(
+        "KokkosSparse::spmv[NATIVE,SELL," +
+        Kokkos::ArithTraits<typename AMatrix::non_const_value_type>::name() +
+        "]");
+    Experimental::Impl::spmv_sell(space, mode, alpha, A, x, beta, y);
+  } else if constexpr (Experimental::is_delta_crs_matrix_v<AMatrix>) {
+    Kokkos::Profiling::pushRegion(
+        "KokkosSparse::spmv[NATIVE,DELTACRS," +
+        Kokkos::ArithTraits<typename AMatrix::non_const_value_type>::name() +
+        "]");
+    Experimental::Impl::spmv_delta_crs(space, mode, alpha, A, x, beta, y);
+  } else if constexpr (Experimental::is_stencil_matrix_v<AMatrix>) {
+    Kokkos::Profiling::pushRegion(
+        "KokkosSparse::spmv[NATIVE,STENCIL," +
+        Kokkos::ArithTraits<typename AMatrix::non_const_value_type>::name() +
+        "]");
+    Experimental::Impl::spmv_stencil(space, mode, alpha, A, x, beta, y);
+  } else {
+    Kokkos::Profiling::pushRegion(
+        "KokkosSparse::spmv[NATIVE,VBR," +
+        Kokkos::ArithTraits<typename AMatrix::non_const_value_type>::name() +
+        "]");
+    Experimental::Impl::spmv_vbr(space, mode, alpha, A, x, beta, y);
+  }
+  Kokkos::Profiling::popRegion();
+}
+
 // clang-format off
 /// \brief Kokkos sparse matrix-vector multiply.
 ///   Computes y := alpha*Op(A)*x + beta*y, where Op(A) is controlled by mode
@@ -432,7 +696,9 @@ void spmv(const ExecutionSpace& space, Handle* handle, const char mode[],
 ///   the memory spaces of A, x, and y.
 /// \tparam AlphaType Type of coefficient alpha. Must be convertible to
 ///   YVector::value_type.
-/// \tparam AMatrix A KokkosSparse::CrsMatrix, or KokkosSparse::Experimental::BsrMatrix
+/// \tparam AMatrix A KokkosSparse::CrsMatrix, or KokkosSparse::Experimental::BsrMatrix.
+///   A CrsMatrix may have float or Kokkos::Experimental::half_t values with double x and y;
+///   the products are then accumulated in double (mixed precision SpMV).
 /// \tparam XVector Type of x, must be a rank-1 or rank-2 Kokkos::View
 /// \tparam BetaType Type of coefficient beta. Must be convertible to YVector::value_type.
 /// \tparam YVector Type of y, must be a Kokkos::View and its rank must match that of XVector
@@ -506,7 +772,9 @@ void spmv(Handle* handle, const char mode[], const AlphaType& alpha,
 ///   (see below).
 ///
 /// \tparam AlphaType Type of coefficient alpha. Must be convertible to YVector::value_type.
-/// \tparam AMatrix A KokkosSparse::CrsMatrix, or KokkosSparse::Experimental::BsrMatrix
+/// \tparam AMatrix A KokkosSparse::CrsMatrix, or KokkosSparse::Experimental::BsrMatrix.
+///   A CrsMatrix may have float or Kokkos::Experimental::half_t values with double x and y;
+///   the products are then accumulated in double (mixed precision SpMV).
 /// \tparam XVector Type of x, must be a rank-1 or rank-2 Kokkos::View
 /// \tparam BetaType Type of coefficient beta. Must be convertible to YVector::value_type.
 /// \tparam YVector Type of y, must be a Kokkos::View and its rank must match that of XVector
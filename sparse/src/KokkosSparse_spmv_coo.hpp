@@ -0,0 +1,119 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+/// \file
+/// \brief Sparse matrix-vector multiply directly on a
+///   KokkosSparse::CooMatrix, for operators applied too few times to be worth
+///   converting to CRS.
+
+#ifndef KOKKOSSPARSE_SPMV_COO_HPP_
+#define KOKKOSSPARSE_SPMV_COO_HPP_
+
+#include <sstream>
+#include <type_traits>
+
+#include "Kokkos_Core.hpp"
+#include "KokkosKernels_Error.hpp"
+#include "KokkosBlas1_scal.hpp"
+#include "KokkosSparse_CooMatrix.hpp"
+#include "KokkosSparse_spmv_coo_impl.hpp"
+
+namespace KokkosSparse {
+
+// clang-format off
+/// \brief y = beta * y + alpha * op(A) * x, where A is in coordinate format.
+///
+/// y is scaled by beta first, then each thread walks a contiguous chunk of
+/// the tuples of A and adds the sum of each run of tuples with the same
+/// output index to y with one atomic add. Any tuple order gives the right
+/// answer; tuples sorted by row (by column for the transposed modes) only
+/// need atomics where a row spans two chunks. Duplicated tuples are summed.
+/// Tuples with a negative row or column are skipped, as in coo2crs.
+///
+/// \tparam ExecutionSpace A Kokkos execution space. Must be able to access
+///   the memory spaces of A, x and y.
+/// \tparam AMatrix A specialization of KokkosSparse::CooMatrix.
+/// \tparam XVector A rank-1 Kokkos::View.
+/// \tparam YVector A rank-1 Kokkos::View of non-const values.
+///
+/// \param space [in] The execution space instance on which to run.
+/// \param mode [in] "N" for no transpose, "T" for transpose, "C" for
+///   conjugate or "H" for conjugate transpose.
+/// \param alpha [in] Scalar multiplier for the matrix A.
+/// \param A [in] The sparse matrix.
+/// \param x [in] The input vector.
+/// \param beta [in] Scalar multiplier for y. If zero, y is overwritten.
+/// \param y [in/out] The output vector.
+// clang-format on
+template <class ExecutionSpace, class AlphaType, class AMatrix, class XVector,
+          class BetaType, class YVector>
+void spmv_coo(const ExecutionSpace& space, const char mode[],
+              const AlphaType& alpha, const AMatrix& A, const XVector& x,
+              const BetaType& beta, const YVector& y) {
+  static_assert(is_coo_matrix<AMatrix>::value,
+                "KokkosSparse::spmv_coo: A must be a CooMatrix");
+  static_assert(Kokkos::is_view<XVector>::value && XVector::rank == 1,
+                "KokkosSparse::spmv_coo: x must be a rank-1 Kokkos::View");
+  static_assert(Kokkos::is_view<YVector>::value && YVector::rank == 1,
+                "KokkosSparse::spmv_coo: y must be a rank-1 Kokkos::View");
+  static_assert(std::is_same_v<typename YVector::value_type,
+                               typename YVector::non_const_value_type>,
+                "KokkosSparse::spmv_coo: y must be non-const");
+  using y_value_type = typename YVector::non_const_value_type;
+
+  const char m       = mode[0];
+  const bool trans   = m == 'T' || m == 't' || m == 'H' || m == 'h';
+  const bool conjug  = m == 'C' || m == 'c' || m == 'H' || m == 'h';
+  const bool nontran = m == 'N' || m == 'n';
+  if (!(trans || conjug || nontran) || mode[1] != '\0') {
+    std::ostringstream os;
+    os << "KokkosSparse::spmv_coo: invalid mode \"" << mode << "\".";
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+  const size_t xlen = trans ? A.numRows() : A.numCols();
+  const size_t ylen = trans ? A.numCols() : A.numRows();
+  if (x.extent(0) != xlen || y.extent(0) != ylen) {
+    std::ostringstream os;
+    os << "KokkosSparse::spmv_coo: dimension mismatch: op(A) is " << ylen
+       << " x " << xlen << ", x has " << x.extent(0) << " entries and y has "
+       << y.extent(0) << ".";
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  KokkosBlas::scal(space, y, beta, y);
+  if (alpha == Kokkos::ArithTraits<AlphaType>::zero()) return;
+  const y_value_type a = alpha;
+  if (trans && conjug)
+    Impl::spmv_coo_apply<true>(space, a, A.col(), A.row(), A.data(), x, y);
+  else if (trans)
+    Impl::spmv_coo_apply<false>(space, a, A.col(), A.row(), A.data(), x, y);
+  else if (conjug)
+    Impl::spmv_coo_apply<true>(space, a, A.row(), A.col(), A.data(), x, y);
+  else
+    Impl::spmv_coo_apply<false>(space, a, A.row(), A.col(), A.data(), x, y);
+}
+
+/// \brief y = beta * y + alpha * op(A) * x on the default instance of A's
+///   execution space. See the overload taking an execution space instance.
+template <class AlphaType, class AMatrix, class XVector, class BetaType,
+          class YVector>
+void spmv_coo(const char mode[], const AlphaType& alpha, const AMatrix& A,
+              const XVector& x, const BetaType& beta, const YVector& y) {
+  spmv_coo(typename AMatrix::execution_space(), mode, alpha, A, x, beta, y);
+}
+
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPMV_COO_HPP_
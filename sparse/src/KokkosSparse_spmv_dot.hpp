@@ -0,0 +1,196 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file
+/// \brief Fused sparse matrix-vector multiply and dot product
+///
+
+#ifndef KOKKOSSPARSE_SPMV_DOT_HPP_
+#define KOKKOSSPARSE_SPMV_DOT_HPP_
+
+#include <sstream>
+#include <type_traits>
+#include "Kokkos_InnerProductSpaceTraits.hpp"
+#include "KokkosBlas1_dot.hpp"
+#include "KokkosKernels_Error.hpp"
+#include "KokkosSparse_BsrMatrix.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_spmv.hpp"
+#include "KokkosSparse_spmv_dot_impl.hpp"
+
+namespace KokkosSparse {
+
+// clang-format off
+/// \brief Fused sparse matrix-vector multiply and dot product.
+///   Computes y := alpha*A*x + beta*y and returns dot(y, z) for the new y,
+///   i.e. \f$\sum_i \overline{y_i} z_i\f$.
+///
+/// Krylov solvers almost always follow an SpMV with a dot product involving
+/// the result. For a CrsMatrix, both are computed in a single pass over the
+/// rows, so y is not read back from memory for the dot product. Other matrix
+/// types fall back to KokkosSparse::spmv followed by KokkosBlas::dot.
+///
+/// The fused kernel is always the native one: the handle's team_size,
+/// vector_length, rows_per_thread and schedule options are respected, but its
+/// algorithm is not.
+///
+/// \tparam ExecutionSpace A Kokkos execution space. Must be able to access
+///   the memory spaces of A, x, y and z. Must match Handle::ExecutionSpaceType.
+/// \tparam Handle Specialization of KokkosSparse::SPMVHandle
+/// \tparam AMatrix A KokkosSparse::CrsMatrix, or
+///   KokkosSparse::Experimental::BsrMatrix. Must be identical to Handle::AMatrixType.
+/// \tparam XVector Type of x, must be a rank-1 Kokkos::View.
+/// \tparam YVector Type of y, must be a rank-1 Kokkos::View.
+/// \tparam ZVector Type of z, must be a rank-1 Kokkos::View.
+///
+/// \param space [in] The execution space instance on which to run the
+///   kernel.
+/// \param handle [in/out] a pointer to a KokkosSparse::SPMVHandle.
+/// \param alpha [in] Scalar multiplier for the matrix A.
+/// \param A [in] The sparse matrix A.
+/// \param x [in] A vector to multiply on the left by A.
+/// \param beta [in] Scalar multiplier for the vector y.
+/// \param y [in/out] Result vector.
+/// \param z [in] The vector to take the dot product of y with. It may alias x,
+///   but not y.
+///
+/// \return dot(y, z); a single value.
+// clang-format on
+template <class ExecutionSpace, class Handle, class AlphaType, class AMatrix,
+          class XVector, class BetaType, class YVector, class ZVector>
+typename Kokkos::Details::InnerProductSpaceTraits<
+    typename YVector::non_const_value_type>::dot_type
+spmv_dot(const ExecutionSpace& space, Handle* handle, const AlphaType& alpha,
+         const AMatrix& A, const XVector& x, const BetaType& beta,
+         const YVector& y, const ZVector& z) {
+  static_assert(
+      is_crs_matrix_v<AMatrix> || Experimental::is_bsr_matrix_v<AMatrix>,
+      "KokkosSparse::spmv_dot: AMatrix must be a CrsMatrix or BsrMatrix");
+  static_assert(Kokkos::is_view<ZVector>::value,
+                "KokkosSparse::spmv_dot: ZVector must be a Kokkos::View.");
+  static_assert(
+      Kokkos::SpaceAccessibility<ExecutionSpace,
+                                 typename ZVector::memory_space>::accessible,
+      "KokkosSparse::spmv_dot: ZVector must be accessible from "
+      "ExecutionSpace");
+  static_assert(XVector::rank() == 1 && YVector::rank() == 1 &&
+                    ZVector::rank() == 1,
+                "KokkosSparse::spmv_dot: x, y and z must have rank 1");
+
+  if (z.extent(0) != y.extent(0)) {
+    std::ostringstream os;
+    os << "KokkosSparse::spmv_dot: Dimensions do not match: "
+       << "y: " << y.extent(0) << " x 1, z: " << z.extent(0) << " x 1";
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  if constexpr (is_crs_matrix_v<AMatrix>) {
+    if ((size_t)A.numCols() != x.extent(0) ||
+        (size_t)A.numRows() != y.extent(0)) {
+      std::ostringstream os;
+      os << "KokkosSparse::spmv_dot: Dimensions do not match: "
+         << "A: " << A.numRows() << " x " << A.numCols()
+         << ", x: " << x.extent(0) << " x 1, y: " << y.extent(0) << " x 1";
+      KokkosKernels::Impl::throw_runtime_exception(os.str());
+    }
+    using AMatrix_Internal = CrsMatrix<
+        typename AMatrix::const_value_type,
+        typename AMatrix::const_ordinal_type, typename AMatrix::device_type,
+        Kokkos::MemoryTraits<Kokkos::Unmanaged>,
+        typename AMatrix::const_size_type>;
+    using XVector_Internal = Kokkos::View<
+        typename XVector::const_value_type*,
+        typename KokkosKernels::Impl::GetUnifiedLayout<XVector>::array_layout,
+        typename XVector::device_type,
+        Kokkos::MemoryTraits<Kokkos::Unmanaged | Kokkos::RandomAccess>>;
+    using YVector_Internal = Kokkos::View<
+        typename YVector::non_const_value_type*,
+        typename KokkosKernels::Impl::GetUnifiedLayout<YVector>::array_layout,
+        typename YVector::device_type, Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+    using ZVector_Internal = Kokkos::View<
+        typename ZVector::const_value_type*,
+        typename KokkosKernels::Impl::GetUnifiedLayout<ZVector>::array_layout,
+        typename ZVector::device_type, Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+    AMatrix_Internal A_i(A);
+    XVector_Internal x_i(x);
+    YVector_Internal y_i(y);
+    ZVector_Internal z_i(z);
+    return Impl::spmv_dot_native(space, handle, alpha, A_i, x_i, beta, y_i,
+                                 z_i);
+  } else {
+    spmv(space, handle, NoTranspose, alpha, A, x, beta, y);
+    return KokkosBlas::dot(space, y, z);
+  }
+}
+
+// clang-format off
+/// \brief Fused sparse matrix-vector multiply and dot product.
+///   Computes y := alpha*A*x + beta*y and returns dot(y, z), using the
+///   default instance of Handle::ExecutionSpaceType.
+///
+/// See the overload taking an execution space instance for details.
+// clang-format on
+template <
+    class Handle, class AlphaType, class AMatrix, class XVector, class BetaType,
+    class YVector, class ZVector,
+    typename = std::enable_if_t<!Kokkos::is_execution_space<Handle>::value>>
+typename Kokkos::Details::InnerProductSpaceTraits<
+    typename YVector::non_const_value_type>::dot_type
+spmv_dot(Handle* handle, const AlphaType& alpha, const AMatrix& A,
+         const XVector& x, const BetaType& beta, const YVector& y,
+         const ZVector& z) {
+  return spmv_dot(typename Handle::ExecutionSpaceType(), handle, alpha, A, x,
+                  beta, y, z);
+}
+
+// clang-format off
+/// \brief Fused sparse matrix-vector multiply and dot product.
+///   Computes y := alpha*A*x + beta*y and returns dot(y, z), without a handle.
+///
+/// See the overload taking a handle for details.
+// clang-format on
+template <class ExecutionSpace, class AlphaType, class AMatrix, class XVector,
+          class BetaType, class YVector, class ZVector,
+          typename = std::enable_if_t<
+              Kokkos::is_execution_space<ExecutionSpace>::value>>
+typename Kokkos::Details::InnerProductSpaceTraits<
+    typename YVector::non_const_value_type>::dot_type
+spmv_dot(const ExecutionSpace& space, const AlphaType& alpha, const AMatrix& A,
+         const XVector& x, const BetaType& beta, const YVector& y,
+         const ZVector& z) {
+  SPMVHandle<ExecutionSpace, AMatrix, XVector, YVector> handle(SPMV_NATIVE);
+  return spmv_dot(space, &handle, alpha, A, x, beta, y, z);
+}
+
+// clang-format off
+/// \brief Fused sparse matrix-vector multiply and dot product.
+///   Computes y := alpha*A*x + beta*y and returns dot(y, z), without a handle,
+///   in the default instance of AMatrix::execution_space.
+// clang-format on
+template <class AlphaType, class AMatrix, class XVector, class BetaType,
+          class YVector, class ZVector>
+typename Kokkos::Details::InnerProductSpaceTraits<
+    typename YVector::non_const_value_type>::dot_type
+spmv_dot(const AlphaType& alpha, const AMatrix& A, const XVector& x,
+         const BetaType& beta, const YVector& y, const ZVector& z) {
+  return spmv_dot(typename AMatrix::execution_space(), alpha, A, x, beta, y,
+                  z);
+}
+
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPMV_DOT_HPP_
@@ -0,0 +1,110 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file KokkosSparse_spmv_ensemble.hpp
+/// \brief Sparse matrix-vector multiply over an EnsembleCrsMatrix
+
+#ifndef KOKKOSSPARSE_SPMV_ENSEMBLE_HPP_
+#define KOKKOSSPARSE_SPMV_ENSEMBLE_HPP_
+
+#include <sstream>
+#include <type_traits>
+
+#include "KokkosKernels_Error.hpp"
+#include "KokkosBlas1_scal.hpp"
+#include "KokkosSparse_EnsembleCrsMatrix.hpp"
+#include "KokkosSparse_spmv_ensemble_impl.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+
+/// \brief Apply every sample of an ensemble to its own vector:
+///   y(:, s) := beta * y(:, s) + alpha * op(A_s) * x(:, s), s = 0..k-1
+///
+/// \tparam ExecutionSpace A Kokkos execution space
+/// \tparam AMatrix A KokkosSparse::Experimental::EnsembleCrsMatrix
+/// \tparam XVector Rank-2 Kokkos::View, one column per sample
+/// \tparam YVector Rank-2 nonconst Kokkos::View, one column per sample
+///
+/// \param space [in] The execution space instance on which to run
+/// \param mode [in] "N" for no transpose, "C" for conjugate; the transposed
+///   modes are not supported
+/// \param alpha [in] Scalar multiplier for the matrix A_s
+/// \param A [in] The ensemble of k matrices
+/// \param x [in] numCols x k input vectors
+/// \param beta [in] Scalar multiplier for y
+/// \param y [in/out] numRows x k output vectors
+///
+/// LayoutRight x and y make the k values loaded for a column index adjacent,
+/// matching the interleaved values of A.
+template <class ExecutionSpace, class AMatrix, class XVector, class YVector>
+void spmv_ensemble(const ExecutionSpace& space, const char mode[],
+                   typename YVector::const_value_type& alpha, const AMatrix& A,
+                   const XVector& x, typename YVector::const_value_type& beta,
+                   const YVector& y) {
+  static_assert(is_ensemble_crs_matrix_v<AMatrix>,
+                "KokkosSparse::Experimental::spmv_ensemble: A must be an "
+                "EnsembleCrsMatrix.");
+  static_assert(Kokkos::is_view<XVector>::value && XVector::rank == 2,
+                "KokkosSparse::Experimental::spmv_ensemble: x must be a "
+                "rank-2 Kokkos::View.");
+  static_assert(Kokkos::is_view<YVector>::value && YVector::rank == 2,
+                "KokkosSparse::Experimental::spmv_ensemble: y must be a "
+                "rank-2 Kokkos::View.");
+  static_assert(std::is_same<typename YVector::value_type,
+                             typename YVector::non_const_value_type>::value,
+                "KokkosSparse::Experimental::spmv_ensemble: y must be "
+                "nonconst.");
+
+  if (static_cast<size_t>(A.numCols()) != x.extent(0) ||
+      static_cast<size_t>(A.numRows()) != y.extent(0) ||
+      static_cast<size_t>(A.ensembleSize()) != x.extent(1) ||
+      static_cast<size_t>(A.ensembleSize()) != y.extent(1)) {
+    std::stringstream ss;
+    ss << "KokkosSparse::Experimental::spmv_ensemble: Dimensions do not "
+          "match: A: "
+       << A.numRows() << " x " << A.numCols() << " x " << A.ensembleSize()
+       << ", x: " << x.extent(0) << " x " << x.extent(1)
+       << ", y: " << y.extent(0) << " x " << y.extent(1);
+    KokkosKernels::Impl::throw_runtime_exception(ss.str());
+  }
+
+  using y_value_type = typename YVector::non_const_value_type;
+  if (A.numRows() == 0) return;
+  if (alpha == Kokkos::ArithTraits<y_value_type>::zero() || A.nnz() == 0) {
+    KokkosBlas::scal(space, y, beta, y);
+    return;
+  }
+
+  Kokkos::Profiling::pushRegion("KokkosSparse::spmv_ensemble");
+  Impl::spmv_ensemble(space, mode, alpha, A, x, beta, y);
+  Kokkos::Profiling::popRegion();
+}
+
+/// \brief spmv_ensemble on the default instance of A's execution space
+template <class AMatrix, class XVector, class YVector>
+void spmv_ensemble(const char mode[],
+                   typename YVector::const_value_type& alpha, const AMatrix& A,
+                   const XVector& x, typename YVector::const_value_type& beta,
+                   const YVector& y) {
+  spmv_ensemble(typename AMatrix::execution_space{}, mode, alpha, A, x, beta,
+                y);
+}
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPMV_ENSEMBLE_HPP_
@@ -17,9 +17,21 @@
 #ifndef KOKKOSSPARSE_SPMV_HANDLE_HPP_
 #define KOKKOSSPARSE_SPMV_HANDLE_HPP_
 
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <vector>
 #include <Kokkos_Core.hpp>
 #include "KokkosSparse_CrsMatrix.hpp"
 #include "KokkosSparse_BsrMatrix.hpp"
+#include "KokkosSparse_CcsMatrix.hpp"
+#include "KokkosSparse_SellMatrix.hpp"
+#include "KokkosSparse_DeltaCrsMatrix.hpp"
+#include "KokkosSparse_StencilMatrix.hpp"
+#include "KokkosSparse_VbrMatrix.hpp"
+#include "KokkosSparse_Utils.hpp"
+#include "KokkosSparse_crs_detect_block_size.hpp"
+#include "KokkosKernels_HandleTelemetry.hpp"
 // Use TPL utilities for safely finalizing matrix descriptors, etc.
 #include "KokkosSparse_Utils_cusparse.hpp"
 #include "KokkosSparse_Utils_rocsparse.hpp"
@@ -37,10 +49,19 @@ enum SPMVAlgorithm {
   SPMV_NATIVE,      /// Use the best KokkosKernels implementation, even if a TPL
                     /// implementation is available.
   SPMV_MERGE_PATH,  /// Use load-balancing merge path algorithm (for CrsMatrix
-                    /// only)
+                    /// and BsrMatrix)
+  SPMV_MV_TILED,    /// Keep a tile of columns of X and Y in registers (for
+                    /// multivector CrsMatrix and BsrMatrix SpMV with 4 or
+                    /// more vectors, ideally LayoutRight)
+  SPMV_NNZ_BALANCED,  /// Give each thread a contiguous range of rows with
+                      /// about the same number of entries, computed by the
+                      /// first call and kept in the handle (for CrsMatrix
+                      /// on host execution spaces)
   SPMV_BSR_V41,  /// Use experimental version 4.1 algorithm (for BsrMatrix only)
   SPMV_BSR_V42,  /// Use experimental version 4.2 algorithm (for BsrMatrix only)
-  SPMV_BSR_TC    /// Use experimental tensor core algorithm (for BsrMatrix only)
+  SPMV_BSR_TC,   /// Use experimental tensor core algorithm (for BsrMatrix only)
+  SPMV_AUTOTUNE  /// Time the applicable algorithms over the first few calls,
+                 /// then use the fastest one for all later calls
 };
 
 namespace Experimental {
@@ -59,9 +80,12 @@ inline const char* get_spmv_algorithm_name(SPMVAlgorithm a) {
     case SPMV_FAST_SETUP: return "SPMV_FAST_SETUP";
     case SPMV_NATIVE: return "SPMV_NATIVE";
     case SPMV_MERGE_PATH: return "SPMV_MERGE_PATH";
+    case SPMV_MV_TILED: return "SPMV_MV_TILED";
+    case SPMV_NNZ_BALANCED: return "SPMV_NNZ_BALANCED";
     case SPMV_BSR_V41: return "SPMV_BSR_V41";
     case SPMV_BSR_V42: return "SPMV_BSR_V42";
     case SPMV_BSR_TC: return "SPMV_BSR_TC";
+    case SPMV_AUTOTUNE: return "SPMV_AUTOTUNE";
   }
   throw std::invalid_argument(
       "SPMVHandle::get_algorithm_name: unknown algorithm");
@@ -74,6 +98,8 @@ inline bool is_spmv_algorithm_native(SPMVAlgorithm a) {
   switch (a) {
     case SPMV_NATIVE:
     case SPMV_MERGE_PATH:
+    case SPMV_MV_TILED:
+    case SPMV_NNZ_BALANCED:
     case SPMV_BSR_V41:
     case SPMV_BSR_V42:
     case SPMV_BSR_TC: return true;
@@ -83,6 +109,34 @@ inline bool is_spmv_algorithm_native(SPMVAlgorithm a) {
 
 namespace Impl {
 
+/// True for the matrix formats that have a single native SpMV implementation
+/// (CcsMatrix, SellMatrix, DeltaCrsMatrix, StencilMatrix and VbrMatrix)
+template <class AMatrix>
+inline constexpr bool is_native_only_spmv_matrix_v =
+    is_ccs_matrix_v<AMatrix> || Experimental::is_sell_matrix_v<AMatrix> ||
+    Experimental::is_delta_crs_matrix_v<AMatrix> ||
+    Experimental::is_stencil_matrix_v<AMatrix> ||
+    Experimental::is_vbr_matrix_v<AMatrix>;
+
+/// Name of the format of AMatrix, for error messages
+template <class AMatrix>
+constexpr const char* spmv_matrix_format_name() {
+  if constexpr (is_crs_matrix_v<AMatrix>)
+    return "CrsMatrix";
+  else if constexpr (Experimental::is_bsr_matrix_v<AMatrix>)
+    return "BsrMatrix";
+  else if constexpr (is_ccs_matrix_v<AMatrix>)
+    return "CcsMatrix";
+  else if constexpr (Experimental::is_sell_matrix_v<AMatrix>)
+    return "SellMatrix";
+  else if constexpr (Experimental::is_delta_crs_matrix_v<AMatrix>)
+    return "DeltaCrsMatrix";
+  else if constexpr (Experimental::is_stencil_matrix_v<AMatrix>)
+    return "StencilMatrix";
+  else
+    return "VbrMatrix";
+}
+
 template <typename ExecutionSpace>
 struct TPL_SpMV_Data {
   // Disallow default construction: must provide the initial execution space
@@ -233,17 +287,425 @@ struct SPMVHandleImpl {
                 "SPMVHandleImpl: Offset must not be a const type");
   static_assert(!std::is_const_v<Ordinal>,
                 "SPMVHandleImpl: Ordinal must not be a const type");
+  //! Type of the explicit transpose kept with cache_transpose
+  using TransposeMatrixType =
+      KokkosSparse::CrsMatrix<Scalar, Ordinal,
+                              Kokkos::Device<ExecutionSpace, MemorySpace>,
+                              void, Offset>;
+  //! Type of the BsrMatrix copy of A kept with auto_block
+  using BlockMatrixType = KokkosSparse::Experimental::BsrMatrix<
+      Scalar, Ordinal, Kokkos::Device<ExecutionSpace, MemorySpace>, void,
+      Offset>;
+  //! Type of the row lists of a row partition (set_row_partition)
+  using RowListType =
+      Kokkos::View<const Ordinal*, Kokkos::Device<ExecutionSpace, MemorySpace>>;
+  //! Type of the row ranges of SPMV_NNZ_BALANCED
+  using RowStartsType =
+      Kokkos::View<Ordinal*, Kokkos::Device<ExecutionSpace, MemorySpace>>;
+  //! Type of the block of rows of A kept for a contiguous part of a row
+  //! partition. It shares the entries and values of A.
+  using RowBlockMatrixType =
+      KokkosSparse::CrsMatrix<const Scalar, const Ordinal,
+                              Kokkos::Device<ExecutionSpace, MemorySpace>,
+                              void, const Offset>;
   SPMVHandleImpl(SPMVAlgorithm algo_) : algo(algo_) {}
   ~SPMVHandleImpl() {
     if (tpl) delete tpl;
+    for (auto& c : autotune_candidates) delete c.handle;
+    delete transpose_handle;
+    delete block_handle;
+    for (auto h : partition_handles) delete h;
   }
   void set_exec_space(const ExecutionSpace& exec) {
     if (tpl) tpl->set_exec_space(exec);
+    for (auto& c : autotune_candidates) c.handle->set_exec_space(exec);
+    if (transpose_handle) transpose_handle->set_exec_space(exec);
+    if (block_handle) block_handle->set_exec_space(exec);
+    for (auto h : partition_handles)
+      if (h) h->set_exec_space(exec);
+  }
+
+  /// Set the partition of the rows of A used by spmv_interior and
+  /// spmv_boundary. Typically, the interior rows only reference locally owned
+  /// entries of x, and the boundary rows also reference the halo. Rows in
+  /// neither list are never touched by spmv_interior or spmv_boundary.
+  ///
+  /// A part whose rows are consecutive (r0, r0 + 1, ...) is applied with the
+  /// regular spmv on that block of rows of A, so it can use the TPL; any
+  /// other part uses a native kernel that reads its list of rows.
+  void set_row_partition(const RowListType& interior_rows,
+                         const RowListType& boundary_rows) {
+    clear_row_partition();
+    partition_rows[0] = interior_rows;
+    partition_rows[1] = boundary_rows;
+    for (int part = 0; part < 2; part++) {
+      auto rows_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                        partition_rows[part]);
+      bool contiguous = true;
+      for (size_t i = 1; i < rows_h.extent(0) && contiguous; i++)
+        contiguous = rows_h(i) == rows_h(0) + Ordinal(i);
+      partition_first_row[part] =
+          contiguous ? (rows_h.extent(0) ? rows_h(0) : 0) : Ordinal(-1);
+    }
+    has_partition = true;
+  }
+
+  /// Whether set_row_partition has been called.
+  bool has_row_partition() const { return has_partition; }
+
+  /// Number of rows in the interior part of the row partition.
+  Ordinal get_num_interior_rows() const { return partition_rows[0].extent(0); }
+
+  /// Number of rows in the boundary part of the row partition.
+  Ordinal get_num_boundary_rows() const { return partition_rows[1].extent(0); }
+
+  /// Remove the row partition, and the data kept to apply it.
+  void clear_row_partition() {
+    for (int part = 0; part < 2; part++) {
+      delete partition_handles[part];
+      partition_handles[part]   = nullptr;
+      partition_blocks[part]    = RowBlockMatrixType();
+      partition_rows[part]      = RowListType();
+      partition_first_row[part] = -1;
+    }
+    has_partition = false;
+  }
+
+  /// Build the block of rows of the CrsMatrix A for a contiguous part of the
+  /// row partition, and the handle used to apply it. The block has its own
+  /// (shifted) row map but views the entries and values of A.
+  template <class AMatrix>
+  void build_row_block(const AMatrix& A, const int part) {
+    using rowmap_t = typename RowBlockMatrixType::row_map_type::non_const_type;
+    const Ordinal first = partition_first_row[part];
+    const Ordinal nrows = partition_rows[part].extent(0);
+    auto begin_h        = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), Kokkos::subview(A.graph.row_map, first));
+    auto end_h = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), Kokkos::subview(A.graph.row_map, first + nrows));
+    const Offset begin = begin_h();
+    const Offset end   = end_h();
+    rowmap_t rowmap(Kokkos::view_alloc(Kokkos::WithoutInitializing,
+                                       "SPMVHandle row block rowmap"),
+                    nrows + 1);
+    auto A_rowmap = A.graph.row_map;
+    Kokkos::parallel_for(
+        "SPMVHandle::build_row_block",
+        Kokkos::RangePolicy<ExecutionSpace>(0, nrows + 1),
+        KOKKOS_LAMBDA(const Ordinal i) {
+          rowmap(i) = A_rowmap(first + i) - begin;
+        });
+    auto range             = Kokkos::make_pair(begin, end);
+    partition_blocks[part] = RowBlockMatrixType(
+        "SPMVHandle row block", nrows, A.numCols(), end - begin,
+        Kokkos::subview(A.values, range), rowmap,
+        Kokkos::subview(A.graph.entries, range));
+    partition_handles[part]                         = new ImplType(algo);
+    partition_handles[part]->team_size              = team_size;
+    partition_handles[part]->vector_length          = vector_length;
+    partition_handles[part]->rows_per_thread        = rows_per_thread;
+    partition_handles[part]->force_static_schedule  = force_static_schedule;
+    partition_handles[part]->force_dynamic_schedule = force_dynamic_schedule;
+  }
+
+  /// Whether the row ranges of SPMV_NNZ_BALANCED are set up for a matrix
+  /// with nrows rows, split into num_parts ranges.
+  bool has_nnz_balanced_rows(const Ordinal nrows, const int num_parts) const {
+    return nnz_balanced_nrows == nrows &&
+           Ordinal(nnz_balanced_row_starts.extent(0)) == Ordinal(num_parts + 1);
+  }
+
+  /// Split the rows of the CrsMatrix A into num_parts contiguous ranges with
+  /// about the same number of entries (SPMV_NNZ_BALANCED). Range p is
+  /// [nnz_balanced_row_starts(p), nnz_balanced_row_starts(p + 1)). Each
+  /// boundary is found by a binary search of the row map, so this costs
+  /// O(num_parts * log(numRows)).
+  template <class AMatrix>
+  void build_nnz_balanced_rows(const ExecutionSpace& exec, const AMatrix& A,
+                               const int num_parts) {
+    nnz_balanced_row_starts = RowStartsType(
+        Kokkos::view_alloc(exec, Kokkos::WithoutInitializing,
+                           "SPMVHandle nnz balanced row starts"),
+        num_parts + 1);
+    auto row_starts     = nnz_balanced_row_starts;
+    auto rowmap         = A.graph.row_map;
+    const Ordinal nrows = A.numRows();
+    Kokkos::parallel_for(
+        "SPMVHandle::build_nnz_balanced_rows",
+        Kokkos::RangePolicy<ExecutionSpace>(exec, 0, num_parts + 1),
+        KOKKOS_LAMBDA(const int p) {
+          const int64_t first = rowmap(0);
+          const int64_t nnz   = int64_t(rowmap(nrows)) - first;
+          const int64_t goal  = first + nnz * p / num_parts;
+          // First row whose entries begin at or after goal
+          Ordinal lo = 0, hi = nrows;
+          while (lo < hi) {
+            const Ordinal mid = lo + (hi - lo) / 2;
+            if (int64_t(rowmap(mid)) < goal)
+              lo = mid + 1;
+            else
+              hi = mid;
+          }
+          row_starts(p) = p == num_parts ? nrows : lo;
+        });
+    nnz_balanced_nrows = nrows;
+  }
+
+  /// Release the row ranges of SPMV_NNZ_BALANCED. They are recomputed by the
+  /// next spmv, e.g. after the sparsity pattern of A has changed.
+  void clear_nnz_balanced_rows() {
+    nnz_balanced_row_starts = RowStartsType();
+    nnz_balanced_nrows      = -1;
+  }
+
+  /// Build the explicit transpose of the CrsMatrix A, and the handle used to
+  /// apply it (cache_transpose only). The new handle uses the same algorithm
+  /// and tuning parameters as this one.
+  template <class AMatrix>
+  void build_cached_transpose(const AMatrix& A) {
+    using rowmap_t =
+        typename TransposeMatrixType::row_map_type::non_const_type;
+    using entries_t = typename TransposeMatrixType::index_type;
+    using values_t  = typename TransposeMatrixType::values_type;
+    rowmap_t rowmap("SPMVHandle transpose rowmap", A.numCols() + 1);
+    entries_t entries(Kokkos::view_alloc(Kokkos::WithoutInitializing,
+                                         "SPMVHandle transpose entries"),
+                      A.nnz());
+    values_t values(Kokkos::view_alloc(Kokkos::WithoutInitializing,
+                                       "SPMVHandle transpose values"),
+                    A.nnz());
+    KokkosSparse::Impl::transpose_matrix<
+        typename AMatrix::row_map_type, typename AMatrix::index_type,
+        typename AMatrix::values_type, rowmap_t, entries_t, values_t, rowmap_t,
+        ExecutionSpace>(A.numRows(), A.numCols(), A.graph.row_map,
+                        A.graph.entries, A.values, rowmap, entries, values);
+    transpose = TransposeMatrixType("SPMVHandle transpose", A.numCols(),
+                                    A.numRows(), A.nnz(), values, rowmap,
+                                    entries);
+    delete transpose_handle;
+    transpose_handle                         = new ImplType(algo);
+    transpose_handle->team_size              = team_size;
+    transpose_handle->vector_length          = vector_length;
+    transpose_handle->rows_per_thread        = rows_per_thread;
+    transpose_handle->force_static_schedule  = force_static_schedule;
+    transpose_handle->force_dynamic_schedule = force_dynamic_schedule;
+  }
+
+  /// Whether the explicit transpose has been built (cache_transpose only).
+  bool has_cached_transpose() const { return transpose_handle != nullptr; }
+
+  /// Number of bytes used by the explicit transpose, or 0 if it has not been
+  /// built. This does not include any TPL data of the transpose's handle.
+  size_t get_cached_transpose_bytes() const {
+    if (!transpose_handle) return 0;
+    return transpose.graph.row_map.span() * sizeof(Offset) +
+           transpose.graph.entries.span() * sizeof(Ordinal) +
+           transpose.values.span() * sizeof(Scalar);
+  }
+
+  /// Release the explicit transpose. It is built again by the next
+  /// transposed spmv if cache_transpose is still set.
+  void clear_cached_transpose() {
+    delete transpose_handle;
+    transpose_handle = nullptr;
+    transpose        = TransposeMatrixType();
+  }
+
+  /// Check whether the CrsMatrix A is cheaper to apply as a BsrMatrix (see
+  /// detect_profitable_block_size) and if so, build that copy of A and the
+  /// handle used to apply it (auto_block only). Blocks that are only partially
+  /// populated in A are padded with explicit zeros. The new handle uses the
+  /// same algorithm and tuning parameters as this one.
+  template <class AMatrix>
+  void build_auto_block(const AMatrix& A) {
+    using rowmap_t  = typename BlockMatrixType::row_map_type::non_const_type;
+    using entries_t = typename BlockMatrixType::index_type;
+    using values_t  = typename BlockMatrixType::values_type;
+    auto_block_size = KokkosSparse::Impl::detect_profitable_block_size(A);
+    if (auto_block_size <= 1) return;
+    const Ordinal bs     = auto_block_size;
+    const Ordinal nbrows = A.numRows() / bs;
+    const Ordinal nbcols = A.numCols() / bs;
+
+    auto rs = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                  A.graph.row_map);
+    auto cs = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                  A.graph.entries);
+    auto vs =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.values);
+    // Block graph: the sorted block columns of each block row. pos(bc) is
+    // the position of block column bc in the current block row (or invalid).
+    const Offset invalid = Kokkos::ArithTraits<Offset>::max();
+    std::vector<Offset> pos(nbcols, invalid);
+    std::vector<Offset> blockRowmap(nbrows + 1, 0);
+    std::vector<Ordinal> blockEntries;
+    for (Ordinal br = 0; br < nbrows; ++br) {
+      const Offset begin = blockEntries.size();
+      for (Offset ci = rs(br * bs); ci < Offset(rs((br + 1) * bs)); ++ci) {
+        const Ordinal bc = cs(ci) / bs;
+        if (pos[bc] == invalid) {
+          pos[bc] = 0;
+          blockEntries.push_back(bc);
+        }
+      }
+      std::sort(blockEntries.begin() + begin, blockEntries.end());
+      for (Offset k = begin; k < Offset(blockEntries.size()); ++k)
+        pos[blockEntries[k]] = invalid;
+      blockRowmap[br + 1] = blockEntries.size();
+    }
+    const Offset nblocks = blockEntries.size();
+    rowmap_t rowmap("SPMVHandle block rowmap", nbrows + 1);
+    entries_t entries("SPMVHandle block entries", nblocks);
+    values_t values("SPMVHandle block values", size_t(nblocks) * bs * bs);
+    auto hRowmap  = Kokkos::create_mirror_view(rowmap);
+    auto hEntries = Kokkos::create_mirror_view(entries);
+    auto hValues  = Kokkos::create_mirror_view(values);
+    Kokkos::deep_copy(hValues, Kokkos::ArithTraits<Scalar>::zero());
+    for (Ordinal br = 0; br <= nbrows; ++br) hRowmap(br) = blockRowmap[br];
+    for (Offset k = 0; k < nblocks; ++k) hEntries(k) = blockEntries[k];
+    for (Ordinal br = 0; br < nbrows; ++br) {
+      for (Offset k = blockRowmap[br]; k < blockRowmap[br + 1]; ++k)
+        pos[blockEntries[k]] = k;
+      for (Ordinal r = br * bs; r < (br + 1) * bs; ++r) {
+        for (Offset ci = rs(r); ci < Offset(rs(r + 1)); ++ci) {
+          const Ordinal c = cs(ci);
+          // Duplicate entries of A are summed, as spmv on A would
+          hValues(size_t(pos[c / bs]) * bs * bs + (r % bs) * bs + c % bs) +=
+              vs(ci);
+        }
+      }
+      for (Offset k = blockRowmap[br]; k < blockRowmap[br + 1]; ++k)
+        pos[blockEntries[k]] = invalid;
+    }
+    Kokkos::deep_copy(rowmap, hRowmap);
+    Kokkos::deep_copy(entries, hEntries);
+    Kokkos::deep_copy(values, hValues);
+    block = BlockMatrixType("SPMVHandle block matrix", nbrows, nbcols, nblocks,
+                            values, rowmap, entries, bs);
+    delete block_handle;
+    block_handle                         = new ImplType(algo);
+    block_handle->team_size              = team_size;
+    block_handle->vector_length          = vector_length;
+    block_handle->rows_per_thread        = rows_per_thread;
+    block_handle->force_static_schedule  = force_static_schedule;
+    block_handle->force_dynamic_schedule = force_dynamic_schedule;
+  }
+
+  /// Whether build_auto_block has already checked A (auto_block only).
+  bool is_auto_block_detected() const { return auto_block_size != 0; }
+
+  /// Whether A is applied through its BsrMatrix copy (auto_block only).
+  bool has_auto_block() const { return block_handle != nullptr; }
+
+  /// Block size chosen by auto_block: 0 until the first spmv, 1 if a
+  /// BsrMatrix would not be profitable.
+  int get_auto_block_size() const { return auto_block_size; }
+
+  /// Number of bytes used by the BsrMatrix copy of A, or 0 if it has not been
+  /// built. This does not include any TPL data of its handle.
+  size_t get_auto_block_bytes() const {
+    if (!block_handle) return 0;
+    return block.graph.row_map.span() * sizeof(Offset) +
+           block.graph.entries.span() * sizeof(Ordinal) +
+           block.values.span() * sizeof(Scalar);
+  }
+
+  /// Release the BsrMatrix copy of A and forget the detected block size. Both
+  /// are computed again by the next spmv if auto_block is still set.
+  void clear_auto_block() {
+    delete block_handle;
+    block_handle    = nullptr;
+    block           = BlockMatrixType();
+    auto_block_size = 0;
   }
 
   /// Get the SPMVAlgorithm used by this handle
   SPMVAlgorithm get_algorithm() const { return this->algo; }
 
+  /// One configuration tried by SPMV_AUTOTUNE. Each candidate owns a
+  /// complete handle, so that TPL candidates keep their own analysis data.
+  struct AutotuneCandidate {
+    ImplType* handle = nullptr;
+    double best_time = std::numeric_limits<double>::max();
+  };
+
+  /// Add a candidate configuration to try (SPMV_AUTOTUNE only).
+  /// vector_length_ and dynamic_schedule are forwarded to the native kernels.
+  void add_autotune_candidate(SPMVAlgorithm candidate_algo,
+                              int vector_length_    = -1,
+                              bool dynamic_schedule = false) {
+    AutotuneCandidate c;
+    c.handle                         = new ImplType(candidate_algo);
+    c.handle->team_size              = team_size;
+    c.handle->vector_length          = vector_length_;
+    c.handle->rows_per_thread        = rows_per_thread;
+    c.handle->force_dynamic_schedule = dynamic_schedule;
+    c.handle->bsr_tc_precision       = bsr_tc_precision;
+    autotune_candidates.push_back(c);
+  }
+
+  /// Get the candidate to run for the next spmv call (SPMV_AUTOTUNE only).
+  /// \param timed [out] true if the call should be timed and reported with
+  ///   autotune_record(). The first call of each candidate is never timed, so
+  ///   that one-time setup (e.g. TPL analysis) does not bias the choice.
+  int autotune_next_candidate(bool& timed) const {
+    if (autotune_choice >= 0) {
+      timed = false;
+      return autotune_choice;
+    }
+    int num_candidates = autotune_candidates.size();
+    timed              = autotune_calls >= num_candidates;
+    return autotune_calls % num_candidates;
+  }
+
+  /// Record the time taken by candidate c for one spmv call. Once every
+  /// candidate has been timed autotune_trials times, the fastest is kept and
+  /// the resources of all others are released.
+  void autotune_record(int c, bool timed, double seconds) {
+    if (timed && seconds < autotune_candidates[c].best_time)
+      autotune_candidates[c].best_time = seconds;
+    autotune_calls++;
+    int num_candidates = autotune_candidates.size();
+    if (autotune_calls < num_candidates * (1 + autotune_trials)) return;
+    autotune_choice = 0;
+    for (int i = 1; i < num_candidates; i++) {
+      if (autotune_candidates[i].best_time <
+          autotune_candidates[autotune_choice].best_time)
+        autotune_choice = i;
+    }
+    // Release the TPL data of the candidates that lost
+    for (int i = 0; i < num_candidates; i++) {
+      if (i == autotune_choice) continue;
+      delete autotune_candidates[i].handle->tpl;
+      autotune_candidates[i].handle->tpl = nullptr;
+    }
+  }
+
+  /// Whether SPMV_AUTOTUNE has finished timing and locked in an algorithm.
+  bool is_autotuning_done() const { return autotune_choice >= 0; }
+
+  /// Get the algorithm chosen by SPMV_AUTOTUNE. Returns SPMV_AUTOTUNE if
+  /// autotuning is still in progress. For all other algorithms, this is the
+  /// same as get_algorithm().
+  SPMVAlgorithm get_autotuned_algorithm() const {
+    if (algo != SPMV_AUTOTUNE) return algo;
+    if (autotune_choice < 0) return SPMV_AUTOTUNE;
+    return autotune_candidates[autotune_choice].handle->algo;
+  }
+
+  /// Get a short human-readable description of the configuration chosen by
+  /// SPMV_AUTOTUNE (algorithm, vector length and schedule), e.g. for logging.
+  std::string get_autotuned_description() const {
+    if (algo != SPMV_AUTOTUNE || autotune_choice < 0)
+      return get_spmv_algorithm_name(get_autotuned_algorithm());
+    const ImplType* h = autotune_candidates[autotune_choice].handle;
+    std::string desc  = get_spmv_algorithm_name(h->algo);
+    if (h->vector_length > 0)
+      desc += ",vector_length=" + std::to_string(h->vector_length);
+    if (h->force_dynamic_schedule) desc += ",dynamic";
+    return desc;
+  }
+
   bool is_set_up                     = false;
   const SPMVAlgorithm algo           = SPMV_DEFAULT;
   TPL_SpMV_Data<ExecutionSpace>* tpl = nullptr;
@@ -257,6 +719,48 @@ struct SPMVHandleImpl {
   bool force_dynamic_schedule = false;
   KokkosSparse::Experimental::Bsr_TC_Precision bsr_tc_precision =
       KokkosSparse::Experimental::Bsr_TC_Precision::Automatic;
+  // SPMV_AUTOTUNE state: number of timed calls per candidate, the candidates,
+  // the number of calls made so far and the index of the winner (-1 until
+  // autotuning is done)
+  int autotune_trials = 2;
+  std::vector<AutotuneCandidate> autotune_candidates;
+  int autotune_calls  = 0;
+  int autotune_choice = -1;
+  // Opt-in: on the first transposed spmv ("T" or "H") with a CrsMatrix,
+  // build and keep an explicit transpose of A, and apply it with the
+  // non-transposed kernels from then on. This avoids the atomics of the
+  // native transpose kernel, at the cost of storing a second copy of A.
+  bool cache_transpose = false;
+  TransposeMatrixType transpose;
+  ImplType* transpose_handle = nullptr;
+  // Opt-in: on the first spmv with a CrsMatrix, check whether A has a
+  // (possibly partial) block structure that makes it cheaper to apply as a
+  // BsrMatrix. If so, keep that copy of A and use the BSR kernels on it.
+  bool auto_block     = false;
+  int auto_block_size = 0;
+  BlockMatrixType block;
+  ImplType* block_handle = nullptr;
+  // Row partition for spmv_interior (part 0) and spmv_boundary (part 1): the
+  // rows of each part, the first row if they are consecutive (-1 otherwise),
+  // and for consecutive parts the block of rows of A and its handle (built by
+  // the first call)
+  bool has_partition = false;
+  RowListType partition_rows[2];
+  Ordinal partition_first_row[2] = {-1, -1};
+  RowBlockMatrixType partition_blocks[2];
+  ImplType* partition_handles[2] = {nullptr, nullptr};
+  // SPMV_NNZ_BALANCED: first row of each thread's range (plus numRows at the
+  // end), and the number of rows of A they were computed for (-1 if unset)
+  RowStartsType nnz_balanced_row_starts;
+  Ordinal nnz_balanced_nrows = -1;
+  // Call count and cumulative time of spmv with this handle ("spmv" phase),
+  // recorded only once enabled with get_telemetry().enable()
+  KokkosKernels::Experimental::HandleTelemetry telemetry;
+
+  /// Get the telemetry of this handle.
+  KokkosKernels::Experimental::HandleTelemetry& get_telemetry() {
+    return telemetry;
+  }
 };
 }  // namespace Impl
 
@@ -268,8 +772,12 @@ struct SPMVHandleImpl {
 /// \tparam DeviceType A Kokkos::Device or execution space where the spmv computation will be run.
 ///    Does not necessarily need to match AMatrix's device type, but its execution space needs to be able
 ///    to access the memory spaces of AMatrix, XVector and YVector.
-/// \tparam AMatrix A specialization of KokkosSparse::CrsMatrix or
-/// KokkosSparse::BsrMatrix.
+/// \tparam AMatrix A specialization of KokkosSparse::CrsMatrix,
+/// KokkosSparse::BsrMatrix, KokkosSparse::CcsMatrix,
+/// KokkosSparse::Experimental::SellMatrix,
+/// KokkosSparse::Experimental::DeltaCrsMatrix,
+/// KokkosSparse::Experimental::StencilMatrix or
+/// KokkosSparse::Experimental::VbrMatrix.
 ///
 /// SPMVHandle's internal resources are lazily allocated and initialized by the first
 /// spmv call.
@@ -282,6 +790,32 @@ struct SPMVHandleImpl {
 ///
 /// \warning However, all calls to spmv with a given instance of SPMVHandle must use the
 /// same matrix.
+///
+/// With SPMV_AUTOTUNE, the first few non-transposed spmv calls each run one of the applicable
+/// algorithms and launch configurations (native, merge path, nnz-balanced, TPL and vector length variants).
+/// After each has been timed autotune_trials times, the fastest is used for all later calls.
+/// The choice can be queried with get_autotuned_algorithm() and get_autotuned_description().
+///
+/// If cache_transpose is set to true (CrsMatrix only), the first spmv in mode "T" or "H" builds an explicit
+/// transpose of A which is kept in the handle, and all later transposed modes apply it with the faster
+/// non-transposed kernels. The memory it uses is reported by get_cached_transpose_bytes(), and it can be
+/// released with clear_cached_transpose(). If the values of A change, call clear_cached_transpose().
+///
+/// If auto_block is set to true (CrsMatrix only), the first spmv looks for a block size with which A,
+/// padded with explicit zeros where its blocks are only partially populated, would move fewer bytes
+/// as a BsrMatrix. If there is one, that BsrMatrix is kept in the handle and all later calls use the
+/// BSR kernels on it. The block size is reported by get_auto_block_size() and the memory by
+/// get_auto_block_bytes(). If the values of A change, call clear_auto_block().
+///
+/// With SPMV_NNZ_BALANCED (CrsMatrix only), the first non-transposed spmv on a host execution space
+/// splits the rows of A into one contiguous range per thread, each with about the same number of
+/// entries. The ranges are kept in the handle and reused by later calls; they are recomputed if the
+/// number of threads changes, and can be released with clear_nnz_balanced_rows(). Other modes,
+/// single-threaded execution spaces and GPU execution spaces use the native kernels.
+///
+/// set_row_partition(interior_rows, boundary_rows) (CrsMatrix only) splits the rows of A into two
+/// parts, which KokkosSparse::Experimental::spmv_interior and spmv_boundary apply on any execution
+/// space instance. This lets the interior rows run while the halo of x is being exchanged.
 // clang-format on
 
 template <class DeviceType, class AMatrix, class XVector, class YVector>
@@ -307,9 +841,11 @@ struct SPMVHandle
   // AMatrix::execution_space. For example, if the matrix's device is <Cuda,
   // CudaHostPinnedSpace> it is allowed to run spmv on Serial.
   static_assert(is_crs_matrix_v<AMatrix> ||
-                    Experimental::is_bsr_matrix_v<AMatrix>,
-                "SPMVHandle: AMatrix must be a specialization of CrsMatrix or "
-                "BsrMatrix.");
+                    Experimental::is_bsr_matrix_v<AMatrix> ||
+                    Impl::is_native_only_spmv_matrix_v<AMatrix>,
+                "SPMVHandle: AMatrix must be a specialization of CrsMatrix, "
+                "BsrMatrix, CcsMatrix, SellMatrix, DeltaCrsMatrix, "
+                "StencilMatrix or VbrMatrix.");
   static_assert(Kokkos::is_view<XVector>::value,
                 "SPMVHandle: XVector must be a Kokkos::View.");
   static_assert(Kokkos::is_view<YVector>::value,
@@ -349,13 +885,25 @@ struct SPMVHandle
                                       " cannot be used if A is a CrsMatrix");
         default:;
       }
+    } else if constexpr (Experimental::is_bsr_matrix_v<AMatrixType>) {
+      // All other algorithms can be used with a BsrMatrix
+      if (get_algorithm() == SPMV_NNZ_BALANCED)
+        throw std::invalid_argument(
+            "SPMVHandle: algorithm SPMV_NNZ_BALANCED cannot be used if A is "
+            "a BsrMatrix");
     } else {
+      // CcsMatrix, SellMatrix, DeltaCrsMatrix, StencilMatrix and VbrMatrix
+      // have a single native implementation
       switch (get_algorithm()) {
-        case SPMV_MERGE_PATH:
-          throw std::invalid_argument(std::string("SPMVHandle: algorithm ") +
-                                      get_spmv_algorithm_name(get_algorithm()) +
-                                      " cannot be used if A is a BsrMatrix");
-        default:;
+        case SPMV_DEFAULT:
+        case SPMV_FAST_SETUP:
+        case SPMV_NATIVE: break;
+        default:
+          throw std::invalid_argument(
+              std::string("SPMVHandle: algorithm ") +
+              get_spmv_algorithm_name(get_algorithm()) +
+              " cannot be used if A is a " +
+              Impl::spmv_matrix_format_name<AMatrixType>());
       }
     }
   }
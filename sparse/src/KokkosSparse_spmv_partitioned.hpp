@@ -0,0 +1,182 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file
+/// \brief Sparse matrix-vector multiply split into interior and boundary
+///   rows, so that the two parts can run on different execution space
+///   instances (e.g. overlapping the interior with a halo exchange)
+///
+
+#ifndef KOKKOSSPARSE_SPMV_PARTITIONED_HPP_
+#define KOKKOSSPARSE_SPMV_PARTITIONED_HPP_
+
+#include <sstream>
+#include <type_traits>
+#include "KokkosKernels_Error.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_spmv.hpp"
+#include "KokkosSparse_spmv_partitioned_impl.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+namespace Impl {
+
+/// Apply one part (0: interior, 1: boundary) of the row partition of handle.
+template <class ExecutionSpace, class Handle, class AlphaType, class AMatrix,
+          class XVector, class BetaType, class YVector>
+void spmv_row_partition(const ExecutionSpace& space, Handle* handle,
+                        const int part, const char mode[],
+                        const AlphaType& alpha, const AMatrix& A,
+                        const XVector& x, const BetaType& beta,
+                        const YVector& y) {
+  static_assert(is_crs_matrix_v<AMatrix>,
+                "KokkosSparse::spmv_interior/spmv_boundary: AMatrix must be a "
+                "CrsMatrix");
+  static_assert(KokkosSparse::Impl::is_spmv_handle_v<Handle>,
+                "KokkosSparse::spmv_interior/spmv_boundary: Handle must be a "
+                "KokkosSparse::SPMVHandle");
+  static_assert(
+      std::is_same_v<AMatrix, typename Handle::AMatrixType>,
+      "KokkosSparse::spmv_interior/spmv_boundary: AMatrix must be identical "
+      "to Handle::AMatrixType");
+  static_assert(Kokkos::is_view<XVector>::value,
+                "KokkosSparse::spmv_interior/spmv_boundary: XVector must be a "
+                "Kokkos::View.");
+  static_assert(Kokkos::is_view<YVector>::value,
+                "KokkosSparse::spmv_interior/spmv_boundary: YVector must be a "
+                "Kokkos::View.");
+  static_assert(XVector::rank() == YVector::rank(),
+                "KokkosSparse::spmv_interior/spmv_boundary: Vector ranks do "
+                "not match.");
+  static_assert(XVector::rank() == size_t(1) || XVector::rank() == size_t(2),
+                "KokkosSparse::spmv_interior/spmv_boundary: x and y must have "
+                "rank 1 or 2");
+  static_assert(!std::is_const_v<typename YVector::value_type>,
+                "KokkosSparse::spmv_interior/spmv_boundary: Output Vector "
+                "must be non-const.");
+
+  const char* name = part == 0 ? "spmv_interior" : "spmv_boundary";
+  if (mode[0] != NoTranspose[0] && mode[0] != Conjugate[0]) {
+    std::ostringstream os;
+    os << "KokkosSparse::" << name << ": mode " << mode
+       << " is not supported (use N or C)";
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+  if (!handle->has_row_partition()) {
+    std::ostringstream os;
+    os << "KokkosSparse::" << name
+       << ": set_row_partition must be called on the handle first";
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+  if (x.extent(0) != size_t(A.numCols()) ||
+      y.extent(0) != size_t(A.numRows()) || x.extent(1) != y.extent(1)) {
+    std::ostringstream os;
+    os << "KokkosSparse::" << name << ": Dimensions do not match: "
+       << "A: " << A.numRows() << " x " << A.numCols() << ", x: " << x.extent(0)
+       << " x " << x.extent(1) << ", y: " << y.extent(0) << " x "
+       << y.extent(1);
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  using ordinal_type       = typename AMatrix::non_const_ordinal_type;
+  using y_value_type       = typename YVector::non_const_value_type;
+  const auto& rows         = handle->partition_rows[part];
+  const ordinal_type first = handle->partition_first_row[part];
+  if (first < 0) {
+    spmv_row_list(space, mode[0] == Conjugate[0], y_value_type(alpha), A,
+                  rows, x, y_value_type(beta), y);
+    return;
+  }
+  // Consecutive rows: the regular spmv (possibly a TPL) on that block of A
+  if (!handle->partition_handles[part]) handle->build_row_block(A, part);
+  const auto range =
+      Kokkos::make_pair(first, ordinal_type(first + rows.extent(0)));
+  if constexpr (YVector::rank() == 1) {
+    KokkosSparse::spmv(space, handle->partition_handles[part], mode, alpha,
+                       handle->partition_blocks[part], x, beta,
+                       Kokkos::subview(y, range));
+  } else {
+    KokkosSparse::spmv(space, handle->partition_handles[part], mode, alpha,
+                       handle->partition_blocks[part], x, beta,
+                       Kokkos::subview(y, range, Kokkos::ALL()));
+  }
+}
+
+}  // namespace Impl
+
+// clang-format off
+/// \brief Kokkos sparse matrix-vector multiply restricted to the interior
+///   rows of the row partition of handle.
+///   Computes y(r) := alpha*Op(A)(r,:)*x + beta*y(r) for each interior row r.
+///
+/// Together with spmv_boundary, this computes the same y as KokkosSparse::spmv
+/// for the rows in the partition; entries of y in neither part are not touched.
+/// Call handle->set_row_partition(interior_rows, boundary_rows) first.
+///
+/// A typical distributed SpMV starts the halo exchange of x, calls
+/// spmv_interior on one execution space instance, waits for the halo, and
+/// calls spmv_boundary on another instance. The interior rows must not
+/// reference the halo entries of x.
+///
+/// If the rows of a part are consecutive, that part is applied with
+/// KokkosSparse::spmv on a view of that block of rows of A, using the
+/// handle's algorithm (including TPLs); its row map is built by the first
+/// call. Otherwise a native kernel walks the list of rows.
+///
+/// \tparam ExecutionSpace A Kokkos execution space. Must be able to access
+///   the memory spaces of A, x, and y.
+/// \tparam Handle A specialization of KokkosSparse::SPMVHandle.
+/// \tparam AMatrix A KokkosSparse::CrsMatrix. Must be identical to Handle::AMatrixType.
+/// \tparam XVector Type of x, must be a rank-1 or rank-2 Kokkos::View.
+/// \tparam YVector Type of y, must be a Kokkos::View of the same rank as x.
+///
+/// \param space [in] The execution space instance on which to run the
+///   kernel.
+/// \param handle [in/out] a pointer to a KokkosSparse::SPMVHandle with a row partition.
+/// \param mode [in] "N" for normal or "C" for conjugate.
+/// \param alpha [in] Scalar multiplier for the matrix A.
+/// \param A [in] The sparse matrix A.
+/// \param x [in] A vector to multiply on the left by A.
+/// \param beta [in] Scalar multiplier for the vector y.
+/// \param y [in/out] Result vector.
+// clang-format on
+template <class ExecutionSpace, class Handle, class AlphaType, class AMatrix,
+          class XVector, class BetaType, class YVector>
+void spmv_interior(const ExecutionSpace& space, Handle* handle,
+                   const char mode[], const AlphaType& alpha, const AMatrix& A,
+                   const XVector& x, const BetaType& beta, const YVector& y) {
+  Impl::spmv_row_partition(space, handle, 0, mode, alpha, A, x, beta, y);
+}
+
+// clang-format off
+/// \brief Kokkos sparse matrix-vector multiply restricted to the boundary
+///   rows of the row partition of handle.
+///   Computes y(r) := alpha*Op(A)(r,:)*x + beta*y(r) for each boundary row r.
+///
+/// See spmv_interior for details.
+// clang-format on
+template <class ExecutionSpace, class Handle, class AlphaType, class AMatrix,
+          class XVector, class BetaType, class YVector>
+void spmv_boundary(const ExecutionSpace& space, Handle* handle,
+                   const char mode[], const AlphaType& alpha, const AMatrix& A,
+                   const XVector& x, const BetaType& beta, const YVector& y) {
+  Impl::spmv_row_partition(space, handle, 1, mode, alpha, A, x, beta, y);
+}
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPMV_PARTITIONED_HPP_
@@ -0,0 +1,110 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file
+/// \brief Sparse matrix-vector multiply with a pattern-only matrix
+///
+
+#ifndef KOKKOSSPARSE_SPMV_PATTERN_HPP_
+#define KOKKOSSPARSE_SPMV_PATTERN_HPP_
+
+#include <sstream>
+#include <type_traits>
+#include "KokkosKernels_Error.hpp"
+#include "KokkosKernels_helpers.hpp"
+#include "KokkosSparse_PatternMatrix.hpp"
+#include "KokkosSparse_spmv_pattern_impl.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+
+/// \brief y := beta * y + alpha * A * x, where A is a PatternMatrix: row i
+///   of A * x is the sum of x(j) over the entries j of row i of the graph.
+///
+/// This is the SpMV of an unweighted graph (degree counts, PageRank-style
+/// propagation, neighbor sums) without the array of ones a CrsMatrix would
+/// need: the kernel reads only the row map and entries. It has the
+/// schedule of the native SpMV and is not instantiated ahead of time (ETI).
+/// If beta is zero, y is overwritten, even where it holds NaN or Inf.
+///
+/// \tparam ExecutionSpace A Kokkos execution space, which can access A, x
+///   and y.
+/// \tparam AMatrix A KokkosSparse::Experimental::PatternMatrix.
+/// \tparam XVector A rank-1 Kokkos::View.
+/// \tparam YVector A rank-1 Kokkos::View of non-const values.
+///
+/// \param space [in] The execution space instance on which to run.
+/// \param alpha [in] Scaling of A * x.
+/// \param A [in] The pattern-only matrix, with numCols() == x.extent(0).
+/// \param x [in] The input vector.
+/// \param beta [in] Scaling of y.
+/// \param y [in/out] The output vector, with y.extent(0) == A.numRows().
+template <class ExecutionSpace, class AMatrix, class XVector, class YVector,
+          typename = std::enable_if_t<
+              Kokkos::is_execution_space<ExecutionSpace>::value>>
+void spmv_pattern(const ExecutionSpace& space,
+                  typename YVector::const_value_type& alpha, const AMatrix& A,
+                  const XVector& x, typename YVector::const_value_type& beta,
+                  const YVector& y) {
+  static_assert(is_pattern_matrix_v<AMatrix>,
+                "KokkosSparse::spmv_pattern: AMatrix must be a PatternMatrix");
+  static_assert(Kokkos::is_view<XVector>::value &&
+                    Kokkos::is_view<YVector>::value,
+                "KokkosSparse::spmv_pattern: x and y must be Kokkos::Views");
+  static_assert(XVector::rank() == 1 && YVector::rank() == 1,
+                "KokkosSparse::spmv_pattern: x and y must have rank 1");
+  static_assert(std::is_same_v<typename YVector::value_type,
+                               typename YVector::non_const_value_type>,
+                "KokkosSparse::spmv_pattern: y must be non-const");
+
+  if ((size_t)A.numCols() != x.extent(0) ||
+      (size_t)A.numRows() != y.extent(0)) {
+    std::ostringstream os;
+    os << "KokkosSparse::spmv_pattern: Dimensions do not match: "
+       << "A: " << A.numRows() << " x " << A.numCols()
+       << ", x: " << x.extent(0) << " x 1, y: " << y.extent(0) << " x 1";
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  using XVector_Internal = Kokkos::View<
+      typename XVector::const_value_type*,
+      typename KokkosKernels::Impl::GetUnifiedLayout<XVector>::array_layout,
+      typename XVector::device_type,
+      Kokkos::MemoryTraits<Kokkos::Unmanaged | Kokkos::RandomAccess>>;
+  using YVector_Internal = Kokkos::View<
+      typename YVector::non_const_value_type*,
+      typename KokkosKernels::Impl::GetUnifiedLayout<YVector>::array_layout,
+      typename YVector::device_type, Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+  XVector_Internal x_i(x);
+  YVector_Internal y_i(y);
+  KokkosSparse::Impl::spmv_pattern_native(space, alpha, A.graph, x_i, beta,
+                                          y_i);
+}
+
+/// \brief y := beta * y + alpha * A * x for a PatternMatrix A, on the
+///   default instance of the execution space of A.
+template <class AMatrix, class XVector, class YVector>
+void spmv_pattern(typename YVector::const_value_type& alpha, const AMatrix& A,
+                  const XVector& x, typename YVector::const_value_type& beta,
+                  const YVector& y) {
+  spmv_pattern(typename AMatrix::execution_space(), alpha, A, x, beta, y);
+}
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPMV_PATTERN_HPP_
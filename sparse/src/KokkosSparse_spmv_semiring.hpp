@@ -0,0 +1,122 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file
+/// \brief Sparse matrix-vector multiply over a semiring
+///
+
+#ifndef KOKKOSSPARSE_SPMV_SEMIRING_HPP_
+#define KOKKOSSPARSE_SPMV_SEMIRING_HPP_
+
+#include <sstream>
+#include <type_traits>
+#include "KokkosKernels_Error.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_Semiring.hpp"
+#include "KokkosSparse_spmv_semiring_impl.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+
+// clang-format off
+/// \brief Sparse matrix-vector multiply over a semiring:
+///   y(i) := add over the entries A(i, j) of row i of multiply(A(i, j), x(j)),
+///   or y(i) := add(y(i), ...) with accumulate.
+///
+/// With MinPlusSemiring, one call relaxes all the edges of a graph for
+/// single-source shortest paths; with OrAndSemiring, it expands a BFS
+/// frontier. Only the stored entries of A take part, so a row without
+/// entries gives Semiring::zero(). The kernel uses the schedule of the
+/// native SpMV; it is not instantiated ahead of time (ETI) for any semiring.
+///
+/// \tparam ExecutionSpace A Kokkos execution space, which can access A, x
+///   and y.
+/// \tparam Semiring A semiring (see KokkosSparse_Semiring.hpp).
+/// \tparam AMatrix A KokkosSparse::CrsMatrix.
+/// \tparam XVector A rank-1 Kokkos::View.
+/// \tparam YVector A rank-1 Kokkos::View of non-const values.
+///
+/// \param space [in] The execution space instance on which to run.
+/// \param sr [in] The semiring; its operations are static, so only its type
+///   matters.
+/// \param A [in] The sparse matrix, with numCols() == x.extent(0).
+/// \param x [in] The input vector.
+/// \param y [in/out] The output vector, with y.extent(0) == A.numRows().
+/// \param accumulate [in] Whether to add the product to y, rather than to
+///   overwrite it.
+// clang-format on
+template <class ExecutionSpace, class Semiring, class AMatrix, class XVector,
+          class YVector,
+          typename = std::enable_if_t<
+              Kokkos::is_execution_space<ExecutionSpace>::value>>
+void spmv_semiring(const ExecutionSpace& space, const Semiring& /* sr */,
+                   const AMatrix& A, const XVector& x, const YVector& y,
+                   const bool accumulate = false) {
+  static_assert(is_crs_matrix_v<AMatrix>,
+                "KokkosSparse::spmv_semiring: AMatrix must be a CrsMatrix");
+  static_assert(Kokkos::is_view<XVector>::value &&
+                    Kokkos::is_view<YVector>::value,
+                "KokkosSparse::spmv_semiring: x and y must be Kokkos::Views");
+  static_assert(XVector::rank() == 1 && YVector::rank() == 1,
+                "KokkosSparse::spmv_semiring: x and y must have rank 1");
+  static_assert(std::is_same_v<typename YVector::value_type,
+                               typename YVector::non_const_value_type>,
+                "KokkosSparse::spmv_semiring: y must be non-const");
+
+  if ((size_t)A.numCols() != x.extent(0) ||
+      (size_t)A.numRows() != y.extent(0)) {
+    std::ostringstream os;
+    os << "KokkosSparse::spmv_semiring: Dimensions do not match: "
+       << "A: " << A.numRows() << " x " << A.numCols()
+       << ", x: " << x.extent(0) << " x 1, y: " << y.extent(0) << " x 1";
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  using AMatrix_Internal = CrsMatrix<
+      typename AMatrix::const_value_type, typename AMatrix::const_ordinal_type,
+      typename AMatrix::device_type, Kokkos::MemoryTraits<Kokkos::Unmanaged>,
+      typename AMatrix::const_size_type>;
+  using XVector_Internal = Kokkos::View<
+      typename XVector::const_value_type*,
+      typename KokkosKernels::Impl::GetUnifiedLayout<XVector>::array_layout,
+      typename XVector::device_type,
+      Kokkos::MemoryTraits<Kokkos::Unmanaged | Kokkos::RandomAccess>>;
+  using YVector_Internal = Kokkos::View<
+      typename YVector::non_const_value_type*,
+      typename KokkosKernels::Impl::GetUnifiedLayout<YVector>::array_layout,
+      typename YVector::device_type, Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+  AMatrix_Internal A_i(A);
+  XVector_Internal x_i(x);
+  YVector_Internal y_i(y);
+  KokkosSparse::Impl::spmv_semiring_native<ExecutionSpace, Semiring>(
+      space, A_i, x_i, y_i, accumulate);
+}
+
+/// \brief Sparse matrix-vector multiply over a semiring, on the default
+///   instance of the execution space of A.
+template <class Semiring, class AMatrix, class XVector, class YVector,
+          typename = std::enable_if_t<
+              !Kokkos::is_execution_space<Semiring>::value>>
+void spmv_semiring(const Semiring& sr, const AMatrix& A, const XVector& x,
+                   const YVector& y, const bool accumulate = false) {
+  spmv_semiring(typename AMatrix::execution_space(), sr, A, x, y, accumulate);
+}
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPMV_SEMIRING_HPP_
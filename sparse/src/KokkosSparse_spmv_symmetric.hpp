@@ -0,0 +1,188 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file
+/// \brief Sparse matrix-vector multiply with a symmetric or Hermitian matrix
+///   of which only one triangle is stored
+///
+
+#ifndef KOKKOSSPARSE_SPMV_SYMMETRIC_HPP_
+#define KOKKOSSPARSE_SPMV_SYMMETRIC_HPP_
+
+#include <sstream>
+#include <type_traits>
+#include "KokkosKernels_Error.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_spmv.hpp"
+#include "KokkosSparse_spmv_symmetric_impl.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+
+// clang-format off
+/// \class SPMVSymmetricHandle
+/// \brief Handle for KokkosSparse::Experimental::spmv_symmetric. It stores a
+///   coloring of the rows of the matrix, which is computed by the first call.
+///
+/// \tparam ExecutionSpace The execution space where spmv_symmetric will run.
+/// \tparam AMatrix A specialization of KokkosSparse::CrsMatrix.
+///
+/// \warning All calls to spmv_symmetric with a given handle must use the same
+///   matrix structure (the values may change).
+// clang-format on
+template <class ExecutionSpace, class AMatrix>
+struct SPMVSymmetricHandle {
+  static_assert(is_crs_matrix_v<AMatrix>,
+                "SPMVSymmetricHandle: AMatrix must be a CrsMatrix");
+  using ExecutionSpaceType = ExecutionSpace;
+  using AMatrixType        = AMatrix;
+  using ordinal_type       = typename AMatrix::non_const_ordinal_type;
+  using rows_view_t =
+      Kokkos::View<ordinal_type*, typename AMatrix::memory_space>;
+  using color_offsets_t = typename rows_view_t::HostMirror;
+
+  /// \brief Create a handle.
+  /// \param hermitian_ [in] If true, the matrix is Hermitian: the entry of the
+  ///   triangle which is not stored is the conjugate of the stored one.
+  ///   Otherwise, the matrix is symmetric.
+  SPMVSymmetricHandle(bool hermitian_ = false) : hermitian(hermitian_) {}
+
+  //! Whether the matrix is Hermitian (true) or symmetric (false)
+  bool is_hermitian() const { return hermitian; }
+
+  //! Whether the coloring has been computed
+  bool is_setup() const { return is_set_up; }
+
+  //! The number of colors, i.e. the number of kernel launches per spmv for
+  //! the mirrored triangle. Only valid once is_setup() is true.
+  ordinal_type get_num_colors() const { return num_colors; }
+
+  bool hermitian;
+  bool is_set_up          = false;
+  ordinal_type num_colors = 0;
+  //! Rows of A, grouped by color
+  rows_view_t color_rows;
+  //! Offsets in color_rows of each color (host)
+  color_offsets_t color_offsets;
+};
+
+// clang-format off
+/// \brief Kokkos sparse matrix-vector multiply with a symmetric or Hermitian
+///   matrix which is stored as a single triangle.
+///   Computes y := alpha*S*x + beta*y, where S = A + op(A)^T - diag(A), and op
+///   is the identity if the handle is symmetric and conj if it is Hermitian.
+///
+/// A must store each off-diagonal pair (i, j), (j, i) of S only once, e.g. as
+/// its lower or upper triangle, plus the diagonal of S. Each stored
+/// off-diagonal entry is used for both y(i) and y(j), which roughly halves the
+/// memory traffic for A. Note that kk_get_lower_crs_matrix (in
+/// KokkosSparse_Utils.hpp) returns the strictly lower triangle; add the
+/// diagonal entries to it if they are nonzero.
+///
+/// The stored triangle is applied with the regular row-parallel SpMV. The
+/// mirrored triangle is applied one color set of rows at a time, where rows
+/// in a set share no column, so no atomics are needed. The coloring is
+/// computed by the first call with a given handle.
+///
+/// \tparam ExecutionSpace A Kokkos execution space. Must be able to access
+///   the memory spaces of A, x, and y.
+/// \tparam Handle Specialization of KokkosSparse::Experimental::SPMVSymmetricHandle
+/// \tparam AMatrix A square KokkosSparse::CrsMatrix.
+/// \tparam XVector Type of x, must be a rank-1 or rank-2 Kokkos::View.
+/// \tparam YVector Type of y, must be a Kokkos::View of the same rank as x.
+///
+/// \param space [in] The execution space instance on which to run the
+///   kernels.
+/// \param handle [in/out] a pointer to a SPMVSymmetricHandle.
+/// \param alpha [in] Scalar multiplier for the matrix S.
+/// \param A [in] The stored triangle (and diagonal) of S.
+/// \param x [in] A vector to multiply on the left by S.
+/// \param beta [in] Scalar multiplier for the vector y.
+/// \param y [in/out] Result vector.
+// clang-format on
+template <class ExecutionSpace, class Handle, class AlphaType, class AMatrix,
+          class XVector, class BetaType, class YVector>
+void spmv_symmetric(const ExecutionSpace& space, Handle* handle,
+                    const AlphaType& alpha, const AMatrix& A, const XVector& x,
+                    const BetaType& beta, const YVector& y) {
+  static_assert(is_crs_matrix_v<AMatrix>,
+                "KokkosSparse::spmv_symmetric: AMatrix must be a CrsMatrix");
+  static_assert(
+      Kokkos::is_view<XVector>::value,
+      "KokkosSparse::spmv_symmetric: XVector must be a Kokkos::View.");
+  static_assert(
+      Kokkos::is_view<YVector>::value,
+      "KokkosSparse::spmv_symmetric: YVector must be a Kokkos::View.");
+  static_assert(XVector::rank() == YVector::rank(),
+                "KokkosSparse::spmv_symmetric: Vector ranks do not match.");
+  static_assert(XVector::rank() == size_t(1) || XVector::rank() == size_t(2),
+                "KokkosSparse::spmv_symmetric: x and y must have rank 1 or 2");
+  static_assert(!std::is_const_v<typename YVector::value_type>,
+                "KokkosSparse::spmv_symmetric: Output Vector must be "
+                "non-const.");
+
+  if (A.numRows() != A.numCols() || x.extent(0) != size_t(A.numCols()) ||
+      y.extent(0) != size_t(A.numRows()) || x.extent(1) != y.extent(1)) {
+    std::ostringstream os;
+    os << "KokkosSparse::spmv_symmetric: Dimensions do not match: "
+       << "A: " << A.numRows() << " x " << A.numCols() << ", x: " << x.extent(0)
+       << " x " << x.extent(1) << ", y: " << y.extent(0) << " x "
+       << y.extent(1);
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  // The stored triangle and the diagonal: y := beta*y + alpha*A*x
+  KokkosSparse::spmv(space, NoTranspose, alpha, A, x, beta, y);
+  if (alpha == Kokkos::ArithTraits<AlphaType>::zero() || A.nnz() == 0) return;
+
+  if (!handle->is_set_up) Impl::spmv_symmetric_setup(space, handle, A);
+
+  using y_value_type = typename YVector::non_const_value_type;
+  if constexpr (XVector::rank() == 1) {
+    Impl::spmv_symmetric_scatter(space, handle, handle->hermitian,
+                                 y_value_type(alpha), A, x, y);
+  } else {
+    for (size_t j = 0; j < x.extent(1); j++) {
+      Impl::spmv_symmetric_scatter(space, handle, handle->hermitian,
+                                   y_value_type(alpha), A,
+                                   Kokkos::subview(x, Kokkos::ALL(), j),
+                                   Kokkos::subview(y, Kokkos::ALL(), j));
+    }
+  }
+}
+
+// clang-format off
+/// \brief Kokkos sparse matrix-vector multiply with a symmetric matrix which
+///   is stored as a single triangle. See the overload taking a handle for details.
+///
+/// This computes the coloring of A on every call; use a SPMVSymmetricHandle
+/// when A is applied more than once.
+// clang-format on
+template <class ExecutionSpace, class AlphaType, class AMatrix, class XVector,
+          class BetaType, class YVector,
+          typename = std::enable_if_t<
+              Kokkos::is_execution_space<ExecutionSpace>::value>>
+void spmv_symmetric(const ExecutionSpace& space, const AlphaType& alpha,
+                    const AMatrix& A, const XVector& x, const BetaType& beta,
+                    const YVector& y) {
+  SPMVSymmetricHandle<ExecutionSpace, AMatrix> handle;
+  spmv_symmetric(space, &handle, alpha, A, x, beta, y);
+}
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPMV_SYMMETRIC_HPP_
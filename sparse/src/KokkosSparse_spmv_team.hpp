@@ -163,6 +163,107 @@ int KOKKOS_INLINE_FUNCTION team_vector_spmv(
         team, alpha, values, row_ptr, colIndices, x, beta, y);
 }
 
+/// \brief Bytes of team scratch memory used by team_spmv_scratch and
+///   team_vector_spmv_scratch for a numRows x numRows matrix with nnz entries:
+///   the copy of x, plus the CRS arrays if stage_matrix is true.
+///
+/// Pass the result to TeamPolicy::set_scratch_size. Stage the matrix only
+/// when this (plus the caller's own scratch) is at most
+/// TeamPolicy::scratch_size_max(level); otherwise stage x alone.
+template <class ExecutionSpace, class ValueType, class OrdinalType>
+size_t team_spmv_scratch_size(const OrdinalType numRows, const OrdinalType nnz,
+                              const bool stage_matrix) {
+  using scratch_space = typename ExecutionSpace::scratch_memory_space;
+  using unmanaged     = Kokkos::MemoryTraits<Kokkos::Unmanaged>;
+  using value_view    = Kokkos::View<ValueType *, scratch_space, unmanaged>;
+  using ordinal_view  = Kokkos::View<OrdinalType *, scratch_space, unmanaged>;
+  size_t bytes = value_view::shmem_size(numRows);
+  if (stage_matrix) {
+    bytes += value_view::shmem_size(nnz) + ordinal_view::shmem_size(nnz) +
+             ordinal_view::shmem_size(numRows + 1);
+  }
+  return bytes;
+}
+
+/// \brief Copy the CRS arrays of a matrix into views in team scratch memory,
+///   typically once before many calls to team_spmv_scratch or
+///   team_vector_spmv_scratch with the same matrix. Ends with a team barrier.
+template <class TeamType, class ValuesViewType, class IntView,
+          class ValuesScratchViewType, class IntScratchViewType>
+KOKKOS_INLINE_FUNCTION void team_stage_crs(
+    const TeamType &team, const ValuesViewType &values, const IntView &row_ptr,
+    const IntView &colIndices, const ValuesScratchViewType &values_scratch,
+    const IntScratchViewType &row_ptr_scratch,
+    const IntScratchViewType &colIndices_scratch) {
+  Kokkos::parallel_for(Kokkos::TeamVectorRange(team, values.extent(0)),
+                       [&](const int k) {
+                         values_scratch(k)     = values(k);
+                         colIndices_scratch(k) = colIndices(k);
+                       });
+  Kokkos::parallel_for(Kokkos::TeamVectorRange(team, row_ptr.extent(0)),
+                       [&](const int i) { row_ptr_scratch(i) = row_ptr(i); });
+  team.team_barrier();
+}
+
+namespace Impl {
+// Copy x into the first x.extent(0) entries of x_scratch and return that
+// subview, once the whole team can read it
+template <class TeamType, class xViewType, class xScratchViewType>
+KOKKOS_INLINE_FUNCTION auto team_stage_vector(
+    const TeamType &team, const xViewType &x,
+    const xScratchViewType &x_scratch) {
+  auto xs =
+      Kokkos::subview(x_scratch, Kokkos::make_pair(size_t(0), x.extent(0)));
+  Kokkos::parallel_for(Kokkos::TeamVectorRange(team, x.extent(0)),
+                       [&](const int i) { xs(i) = x(i); });
+  team.team_barrier();
+  return xs;
+}
+}  // namespace Impl
+
+/// \brief Sparse matrix-vector multiply y = beta*y + alpha*A*x, like
+///   team_spmv, with x read from team scratch memory.
+///
+/// x is first copied into x_scratch, so each entry of x is read from global
+/// memory once instead of once per entry of A in its column. values, row_ptr
+/// and colIndices may be global views or the scratch views filled by
+/// team_stage_crs; for a small matrix applied many times by the same team,
+/// staging it as well removes all global reads but those of x and y.
+///
+/// x_scratch is a team scratch view with the value type of values and at
+/// least x.extent(0) entries (see team_spmv_scratch_size). The call ends
+/// with a team barrier, so y is complete and x_scratch may be reused.
+template <class TeamType, class ScalarType, class ValuesViewType, class IntView,
+          class xViewType, class yViewType, class xScratchViewType>
+int KOKKOS_INLINE_FUNCTION team_spmv_scratch(
+    const TeamType &team, const ScalarType &alpha, const ValuesViewType &values,
+    const IntView &row_ptr, const IntView &colIndices, const xViewType &x,
+    const ScalarType &beta, const yViewType &y, const int dobeta,
+    const xScratchViewType &x_scratch) {
+  const auto xs = Impl::team_stage_vector(team, x, x_scratch);
+  const int r =
+      team_spmv(team, alpha, values, row_ptr, colIndices, xs, beta, y, dobeta);
+  team.team_barrier();
+  return r;
+}
+
+/// \brief Sparse matrix-vector multiply y = beta*y + alpha*A*x, like
+///   team_vector_spmv, with x read from team scratch memory. See
+///   team_spmv_scratch.
+template <class TeamType, class ScalarType, class ValuesViewType, class IntView,
+          class xViewType, class yViewType, class xScratchViewType>
+int KOKKOS_INLINE_FUNCTION team_vector_spmv_scratch(
+    const TeamType &team, const ScalarType &alpha, const ValuesViewType &values,
+    const IntView &row_ptr, const IntView &colIndices, const xViewType &x,
+    const ScalarType &beta, const yViewType &y, const int dobeta,
+    const xScratchViewType &x_scratch) {
+  const auto xs = Impl::team_stage_vector(team, x, x_scratch);
+  const int r   = team_vector_spmv(team, alpha, values, row_ptr, colIndices, xs,
+                                   beta, y, dobeta);
+  team.team_barrier();
+  return r;
+}
+
 }  // namespace Experimental
 }  // namespace KokkosSparse
 
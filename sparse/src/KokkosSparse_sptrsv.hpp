@@ -24,12 +24,20 @@
 #ifndef KOKKOSSPARSE_SPTRSV_HPP_
 #define KOKKOSSPARSE_SPTRSV_HPP_
 
+#include <sstream>
+#include <stdexcept>
 #include <type_traits>
 
 //#include "KokkosSparse_sptrsv_handle.hpp"
 #include "KokkosKernels_helpers.hpp"
+#include "KokkosKernels_DispatchTrace.hpp"
 #include "KokkosSparse_sptrsv_symbolic_spec.hpp"
 #include "KokkosSparse_sptrsv_solve_spec.hpp"
+#include "KokkosSparse_sptrsv_multi_rhs_impl.hpp"
+#include "KokkosSparse_sptrsv_isai_impl.hpp"
+#include "KokkosSparse_sptrsv_jacobi_impl.hpp"
+#include "KokkosSparse_sptrsv_block_impl.hpp"
+#include "KokkosSparse_BsrMatrix.hpp"
 
 #include "KokkosSparse_sptrsv_cuSPARSE_impl.hpp"
 
@@ -103,6 +111,9 @@ void sptrsv_symbolic(const ExecutionSpace &space, KernelHandle *handle,
 #ifdef KK_TRISOLVE_TIMERS
   Kokkos::Timer timer_sptrsv;
 #endif
+  KokkosKernels::Experimental::HandleTelemetry::Scope<ExecutionSpace>
+      telemetryScope(&handle->get_sptrsv_handle()->get_telemetry(),
+                     "symbolic", space);
   RowMap_Internal rowmap_i   = rowmap;
   Entries_Internal entries_i = entries;
 
@@ -277,6 +288,78 @@ void sptrsv_symbolic(KernelHandle *handle, lno_row_view_t_ rowmap,
   sptrsv_symbolic(my_exec_space, handle, rowmap, entries, values);
 }
 
+/**
+ * @brief Incomplete sparse approximate inverse (ISAI) of the triangular
+ * matrix A, for handles with use_isai()
+ *
+ * Computes M with the pattern of the triangle of A, such that
+ * (M A)(i, j) = delta_ij for every (i, j) in that pattern, and stores it in
+ * the handle. sptrsv_solve then applies x = M b with an SpMV instead of
+ * solving, which is an approximation suited to preconditioners. Call it
+ * again when the values of A change. Rows of the triangle are limited to 64
+ * entries.
+ *
+ * @tparam ExecutionSpace This kernels execution space
+ * @tparam KernelHandle A specialization of
+ * KokkosKernels::Experimental::KokkosKernelsHandle
+ * @tparam lno_row_view_t_ The CRS matrix's (A) rowmap type
+ * @tparam lno_nnz_view_t_ The CRS matrix's (A) entries type
+ * @tparam scalar_nnz_view_t_ The CRS matrix's (A) values type
+ * @param space The execution space instance this kernel will be run on
+ * @param handle KernelHandle instance
+ * @param rowmap The CRS matrix's (A) rowmap
+ * @param entries The CRS matrix's (A) entries
+ * @param values The CRS matrix's (A) values
+ */
+template <typename ExecutionSpace, typename KernelHandle,
+          typename lno_row_view_t_, typename lno_nnz_view_t_,
+          typename scalar_nnz_view_t_>
+void sptrsv_isai(const ExecutionSpace &space, KernelHandle *handle,
+                 lno_row_view_t_ rowmap, lno_nnz_view_t_ entries,
+                 scalar_nnz_view_t_ values) {
+  static_assert(
+      std::is_same_v<ExecutionSpace, typename KernelHandle::HandleExecSpace>,
+      "sptrsv_isai: ExecutionSpace and HandleExecSpace need to match");
+  static_assert(KokkosKernels::Impl::is_same_or_lower_precision_v<
+                    typename scalar_nnz_view_t_::value_type,
+                    typename KernelHandle::nnz_scalar_t>,
+                "sptrsv_isai: A scalar type must match KernelHandle entry "
+                "type, or be a lower precision of it (const doesn't matter)");
+
+  auto sptrsv_handle = handle->get_sptrsv_handle();
+  if (rowmap.extent(0) != size_t(sptrsv_handle->get_nrows() + 1)) {
+    throw std::invalid_argument(
+        "sptrsv_isai: rowmap does not match the number of rows of the "
+        "handle");
+  }
+  KokkosSparse::Impl::Experimental::sptrsv_isai(space, *sptrsv_handle, rowmap,
+                                                entries, values);
+}
+
+/**
+ * @brief Incomplete sparse approximate inverse (ISAI) of the triangular
+ * matrix A, for handles with use_isai()
+ *
+ * @tparam KernelHandle A specialization of
+ * KokkosKernels::Experimental::KokkosKernelsHandle
+ * @tparam lno_row_view_t_ The CRS matrix's (A) rowmap type
+ * @tparam lno_nnz_view_t_ The CRS matrix's (A) entries type
+ * @tparam scalar_nnz_view_t_ The CRS matrix's (A) values type
+ * @param handle KernelHandle instance
+ * @param rowmap The CRS matrix's (A) rowmap
+ * @param entries The CRS matrix's (A) entries
+ * @param values The CRS matrix's (A) values
+ */
+template <typename KernelHandle, typename lno_row_view_t_,
+          typename lno_nnz_view_t_, typename scalar_nnz_view_t_>
+void sptrsv_isai(KernelHandle *handle, lno_row_view_t_ rowmap,
+                 lno_nnz_view_t_ entries, scalar_nnz_view_t_ values) {
+  using ExecutionSpace = typename KernelHandle::HandleExecSpace;
+  auto my_exec_space   = ExecutionSpace();
+
+  sptrsv_isai(my_exec_space, handle, rowmap, entries, values);
+}
+
 /**
  * @brief sptrsv solve phase of x for linear system Ax=b
  *
@@ -298,7 +381,10 @@ void sptrsv_symbolic(KernelHandle *handle, lno_row_view_t_ rowmap,
  */
 template <typename ExecutionSpace, typename KernelHandle,
           typename lno_row_view_t_, typename lno_nnz_view_t_,
-          typename scalar_nnz_view_t_, class BType, class XType>
+          typename scalar_nnz_view_t_, class BType, class XType,
+          std::enable_if_t<!KokkosSparse::Impl::Experimental::
+                               sptrsv_is_multi_rhs<BType>::value,
+                           int> = 0>
 void sptrsv_solve(ExecutionSpace &space, KernelHandle *handle,
                   lno_row_view_t_ rowmap, lno_nnz_view_t_ entries,
                   scalar_nnz_view_t_ values, BType b, XType x) {
@@ -319,10 +405,11 @@ void sptrsv_solve(ExecutionSpace &space, KernelHandle *handle,
           typename lno_nnz_view_t_::non_const_value_type, ordinal_type),
       "sptrsv_solve: A entry type must match KernelHandle entry type (aka "
       "nnz_lno_t, and const doesn't matter)");
-  static_assert(KOKKOSKERNELS_SPTRSV_SAME_TYPE(
-                    typename scalar_nnz_view_t_::value_type, scalar_type),
+  static_assert(KokkosKernels::Impl::is_same_or_lower_precision_v<
+                    typename scalar_nnz_view_t_::value_type, scalar_type>,
                 "sptrsv_solve: A scalar type must match KernelHandle entry "
-                "type (aka nnz_lno_t, and const doesn't matter)");
+                "type (aka nnz_scalar_t), or be a lower precision of it "
+                "(const doesn't matter)");
 
   static_assert(Kokkos::is_view<BType>::value,
                 "sptrsv: b is not a Kokkos::View.");
@@ -350,6 +437,37 @@ void sptrsv_solve(ExecutionSpace &space, KernelHandle *handle,
                              typename scalar_nnz_view_t_::device_type>::value,
                 "sptrsv: rowmap and values have different device types.");
 
+  KokkosKernels::Experimental::HandleTelemetry::Scope<ExecutionSpace>
+      telemetryScope(&handle->get_sptrsv_handle()->get_telemetry(), "solve",
+                     space);
+  KokkosKernels::Impl::DispatchTrace<ExecutionSpace> trace("sptrsv_solve",
+                                                           space);
+  if (trace.is_enabled()) {
+    auto sh = handle->get_sptrsv_handle();
+    trace.set_dims(sh->get_nrows(), sh->get_nrows(), entries.extent(0));
+    if (sh->use_isai())
+      trace.set_algorithm("ISAI");
+    else if (sh->get_jacobi_sweeps() > 0)
+      trace.set_algorithm("JACOBI");
+    else
+      trace.set_algorithm(sh->return_algorithm_string());
+    trace.set_tpl(sh->get_algorithm() ==
+                  KokkosSparse::Experimental::SPTRSVAlgorithm::SPTRSV_CUSPARSE);
+    trace.set_launch(sh->get_team_size(), sh->get_vector_size());
+  }
+
+  if (handle->get_sptrsv_handle()->use_isai()) {
+    KokkosSparse::Impl::Experimental::sptrsv_isai_apply(
+        space, *handle->get_sptrsv_handle(), b, x);
+    return;
+  }
+  if (handle->get_sptrsv_handle()->get_jacobi_sweeps() > 0) {
+    KokkosSparse::Impl::Experimental::sptrsv_jacobi(
+        space, handle->get_sptrsv_handle()->get_jacobi_sweeps(),
+        handle->is_sptrsv_lower_tri(), rowmap, entries, values, b, x);
+    return;
+  }
+
   typedef typename KernelHandle::const_size_type c_size_t;
   typedef typename KernelHandle::const_nnz_lno_t c_lno_t;
   typedef typename KernelHandle::const_nnz_scalar_t c_scalar_t;
@@ -411,7 +529,10 @@ void sptrsv_solve(ExecutionSpace &space, KernelHandle *handle,
   if (sptrsv_handle->get_algorithm() ==
       KokkosSparse::Experimental::SPTRSVAlgorithm::SPTRSV_CUSPARSE) {
 #ifdef KOKKOSKERNELS_ENABLE_TPL_CUSPARSE
-    if constexpr (std::is_same_v<ExecutionSpace, Kokkos::Cuda>) {
+    // cuSPARSE needs the values in the working precision
+    if constexpr (std::is_same_v<ExecutionSpace, Kokkos::Cuda> &&
+                  KOKKOSKERNELS_SPTRSV_SAME_TYPE(
+                      typename scalar_nnz_view_t_::value_type, scalar_type)) {
       typedef typename KernelHandle::SPTRSVHandleType sptrsvHandleType;
       sptrsvHandleType *sh = handle->get_sptrsv_handle();
       auto nrows           = sh->get_nrows();
@@ -444,6 +565,117 @@ void sptrsv_solve(ExecutionSpace &space, KernelHandle *handle,
 
 }  // sptrsv_solve
 
+/**
+ * @brief sptrsv solve phase of X for linear system AX=B with multiple
+ * right-hand sides
+ *
+ * With the level-scheduled algorithms (SEQLVLSCHD_RP, SEQLVLSCHD_TP1 and
+ * SEQLVLSCHD_TP1CHAIN), all the columns of B are solved together: each
+ * level of the schedule is one kernel, and each row of A is loaded once for
+ * all the columns. The supernodal algorithms solve the supernodes of a level
+ * for all the columns with the batched TRSM and GEMM on the supernode
+ * panels (or with multi-vector SpMV for SUPERNODAL_SPMV and
+ * SUPERNODAL_SPMV_DAG); like the single right-hand side solve, they work in
+ * place on X, which is set to B first. SYNCFREE and cuSPARSE solve one
+ * column at a time, as do the Jacobi sweeps of set_jacobi_sweeps. Handles
+ * with use_isai() apply the approximate inverse to all the columns with one
+ * SpMV.
+ *
+ * @tparam ExecutionSpace This kernels execution space
+ * @tparam KernelHandle A specialization of
+ * KokkosKernels::Experimental::KokkosKernelsHandle
+ * @tparam lno_row_view_t_ The CRS matrix's (A) rowmap type
+ * @tparam lno_nnz_view_t_ The CRS matrix's (A) entries type
+ * @tparam scalar_nnz_view_t_ The CRS matrix's (A) values type
+ * @tparam BType The B multivector type (rank 2)
+ * @tparam XType The X multivector type (rank 2)
+ * @param space The execution space instance this kernel will be run on
+ * @param handle KernelHandle instance
+ * @param rowmap The CRS matrix's (A) rowmap
+ * @param entries The CRS matrix's (A) entries
+ * @param values The CRS matrix's (A) values
+ * @param b The B multivector
+ * @param x The X multivector
+ */
+template <typename ExecutionSpace, typename KernelHandle,
+          typename lno_row_view_t_, typename lno_nnz_view_t_,
+          typename scalar_nnz_view_t_, class BType, class XType,
+          std::enable_if_t<KokkosSparse::Impl::Experimental::
+                               sptrsv_is_multi_rhs<BType>::value,
+                           int> = 0>
+void sptrsv_solve(ExecutionSpace &space, KernelHandle *handle,
+                  lno_row_view_t_ rowmap, lno_nnz_view_t_ entries,
+                  scalar_nnz_view_t_ values, BType b, XType x) {
+  static_assert(
+      std::is_same_v<ExecutionSpace, typename KernelHandle::HandleExecSpace>,
+      "sptrsv solve: ExecutionSpace and HandleExecSpace need to match");
+  static_assert(Kokkos::is_view<XType>::value,
+                "sptrsv: x is not a Kokkos::View.");
+  static_assert((int)BType::rank == (int)XType::rank,
+                "sptrsv: The ranks of b and x do not match.");
+  static_assert(std::is_same<typename XType::value_type,
+                             typename XType::non_const_value_type>::value,
+                "sptrsv: The output x must be nonconst.");
+  static_assert(std::is_same<typename BType::device_type,
+                             typename XType::device_type>::value,
+                "sptrsv: Views BType and XType have different device_types.");
+
+  if (b.extent(0) != x.extent(0) || b.extent(1) != x.extent(1)) {
+    std::ostringstream os;
+    os << "sptrsv_solve: B is " << b.extent(0) << "x" << b.extent(1)
+       << " but X is " << x.extent(0) << "x" << x.extent(1);
+    throw std::invalid_argument(os.str());
+  }
+
+  auto sptrsv_handle = handle->get_sptrsv_handle();
+  if (sptrsv_handle->use_isai()) {
+    KokkosSparse::Impl::Experimental::sptrsv_isai_apply(space, *sptrsv_handle,
+                                                        b, x);
+    return;
+  }
+
+  const auto algm = sptrsv_handle->get_algorithm();
+  if (sptrsv_handle->get_jacobi_sweeps() == 0 &&
+      (algm == SPTRSVAlgorithm::SEQLVLSCHD_RP ||
+       algm == SPTRSVAlgorithm::SEQLVLSCHD_TP1 ||
+       algm == SPTRSVAlgorithm::SEQLVLSCHD_TP1CHAIN)) {
+    if (!sptrsv_handle->is_symbolic_complete()) {
+      sptrsv_symbolic(space, handle, rowmap, entries);
+    }
+    KokkosSparse::Impl::Experimental::tri_solve_multi_rhs(
+        space, *sptrsv_handle, rowmap, entries, values, b, x);
+    return;
+  }
+#if defined(KOKKOSKERNELS_ENABLE_SUPERNODAL_SPTRSV)
+  if (sptrsv_handle->get_jacobi_sweeps() == 0 &&
+      (algm == SPTRSVAlgorithm::SUPERNODAL_NAIVE ||
+       algm == SPTRSVAlgorithm::SUPERNODAL_ETREE ||
+       algm == SPTRSVAlgorithm::SUPERNODAL_DAG ||
+       algm == SPTRSVAlgorithm::SUPERNODAL_SPMV ||
+       algm == SPTRSVAlgorithm::SUPERNODAL_SPMV_DAG)) {
+    if (b.data() != x.data()) Kokkos::deep_copy(space, x, b);
+    KokkosSparse::Impl::Experimental::tri_solve_supernodal_multi_rhs(
+        space, *sptrsv_handle, rowmap, entries, values, x);
+    return;
+  }
+#endif
+
+  // One column at a time, through contiguous copies of the columns
+  using vector_t = Kokkos::View<typename XType::non_const_value_type *,
+                                Kokkos::LayoutLeft,
+                                typename XType::device_type>;
+  vector_t bj(Kokkos::view_alloc(Kokkos::WithoutInitializing, "sptrsv b_j"),
+              b.extent(0));
+  vector_t xj(Kokkos::view_alloc(Kokkos::WithoutInitializing, "sptrsv x_j"),
+              x.extent(0));
+  for (size_t j = 0; j < x.extent(1); j++) {
+    Kokkos::deep_copy(space, bj, Kokkos::subview(b, Kokkos::ALL(), j));
+    Kokkos::deep_copy(space, xj, Kokkos::subview(x, Kokkos::ALL(), j));
+    sptrsv_solve(space, handle, rowmap, entries, values, bj, xj);
+    Kokkos::deep_copy(space, Kokkos::subview(x, Kokkos::ALL(), j), xj);
+  }
+}  // sptrsv_solve
+
 /**
  * @brief sptrsv solve phase of x for linear system Ax=b
  *
@@ -472,6 +704,141 @@ void sptrsv_solve(KernelHandle *handle, lno_row_view_t_ rowmap,
   sptrsv_solve(my_exec_space, handle, rowmap, entries, values, b, x);
 }
 
+/**
+ * @brief sptrsv symbolic phase for the block triangular BSR matrix A
+ *
+ * The handle is created with the number of block rows of A and one of the
+ * level-scheduled algorithms (SEQLVLSCHD_RP, SEQLVLSCHD_TP1 or
+ * SEQLVLSCHD_TP1CHAIN); the level schedule is that of the block graph.
+ *
+ * @tparam ExecutionSpace This kernels execution space
+ * @tparam KernelHandle A specialization of
+ * KokkosKernels::Experimental::KokkosKernelsHandle
+ * @tparam BsrMatrixType A specialization of KokkosSparse::BsrMatrix
+ * @param space The execution space instance this kernel will be run on
+ * @param handle KernelHandle instance
+ * @param A The BSR matrix
+ */
+template <typename ExecutionSpace, typename KernelHandle,
+          typename BsrMatrixType,
+          std::enable_if_t<is_bsr_matrix_v<BsrMatrixType>, int> = 0>
+void sptrsv_symbolic(const ExecutionSpace &space, KernelHandle *handle,
+                     const BsrMatrixType &A) {
+  auto sptrsv_handle = handle->get_sptrsv_handle();
+  const auto algm    = sptrsv_handle->get_algorithm();
+  if (algm != SPTRSVAlgorithm::SEQLVLSCHD_RP &&
+      algm != SPTRSVAlgorithm::SEQLVLSCHD_TP1 &&
+      algm != SPTRSVAlgorithm::SEQLVLSCHD_TP1CHAIN) {
+    throw std::invalid_argument(
+        "sptrsv_symbolic: BsrMatrix requires a level-scheduled algorithm");
+  }
+  if (size_t(sptrsv_handle->get_nrows()) != size_t(A.numRows())) {
+    throw std::invalid_argument(
+        "sptrsv_symbolic: the handle must have the number of block rows of A");
+  }
+  sptrsv_symbolic(space, handle, A.graph.row_map, A.graph.entries);
+}
+
+/**
+ * @brief sptrsv symbolic phase for the block triangular BSR matrix A
+ *
+ * @tparam KernelHandle A specialization of
+ * KokkosKernels::Experimental::KokkosKernelsHandle
+ * @tparam BsrMatrixType A specialization of KokkosSparse::BsrMatrix
+ * @param handle KernelHandle instance
+ * @param A The BSR matrix
+ */
+template <typename KernelHandle, typename BsrMatrixType,
+          std::enable_if_t<is_bsr_matrix_v<BsrMatrixType>, int> = 0>
+void sptrsv_symbolic(KernelHandle *handle, const BsrMatrixType &A) {
+  using ExecutionSpace = typename KernelHandle::HandleExecSpace;
+  auto my_exec_space   = ExecutionSpace();
+  sptrsv_symbolic(my_exec_space, handle, A);
+}
+
+/**
+ * @brief sptrsv solve phase of x for linear system Ax=b, with the block
+ * triangular BSR matrix A
+ *
+ * Each level of the schedule is one kernel with a team per block row: the
+ * off-diagonal blocks update the block of b with dense block-vector
+ * products, and the dense diagonal block is solved by Gaussian elimination
+ * with partial pivoting. b and x are point vectors of length
+ * A.numRows() * A.blockDim().
+ *
+ * @tparam ExecutionSpace This kernels execution space
+ * @tparam KernelHandle A specialization of
+ * KokkosKernels::Experimental::KokkosKernelsHandle
+ * @tparam BsrMatrixType A specialization of KokkosSparse::BsrMatrix
+ * @tparam BType The b vector type
+ * @tparam XType The x vector type
+ * @param space The execution space instance this kernel will be run on
+ * @param handle KernelHandle instance
+ * @param A The BSR matrix
+ * @param b The b vector
+ * @param x The x vector
+ */
+template <typename ExecutionSpace, typename KernelHandle,
+          typename BsrMatrixType, class BType, class XType,
+          std::enable_if_t<is_bsr_matrix_v<BsrMatrixType>, int> = 0>
+void sptrsv_solve(ExecutionSpace &space, KernelHandle *handle,
+                  const BsrMatrixType &A, BType b, XType x) {
+  static_assert(Kokkos::is_view<BType>::value,
+                "sptrsv: b is not a Kokkos::View.");
+  static_assert(Kokkos::is_view<XType>::value,
+                "sptrsv: x is not a Kokkos::View.");
+  static_assert(BType::rank == 1 && XType::rank == 1,
+                "sptrsv: with a BsrMatrix, b and x must have rank 1.");
+  static_assert(std::is_same<typename XType::value_type,
+                             typename XType::non_const_value_type>::value,
+                "sptrsv: The output x must be nonconst.");
+
+  auto sptrsv_handle = handle->get_sptrsv_handle();
+  if (sptrsv_handle->use_isai() || sptrsv_handle->get_jacobi_sweeps() > 0) {
+    throw std::invalid_argument(
+        "sptrsv_solve: ISAI and Jacobi sweeps are not supported with a "
+        "BsrMatrix");
+  }
+  const size_t n = size_t(A.numRows()) * A.blockDim();
+  if (b.extent(0) != n || x.extent(0) != n) {
+    std::ostringstream os;
+    os << "sptrsv_solve: b and x must have " << n << " entries, got "
+       << b.extent(0) << " and " << x.extent(0);
+    throw std::invalid_argument(os.str());
+  }
+
+  if (!sptrsv_handle->is_symbolic_complete()) {
+    sptrsv_symbolic(space, handle, A);
+  }
+  KokkosSparse::Impl::Experimental::tri_solve_block(
+      space, *sptrsv_handle, A.graph.row_map, A.graph.entries, A.values,
+      A.blockDim(), b, x);
+}
+
+/**
+ * @brief sptrsv solve phase of x for linear system Ax=b, with the block
+ * triangular BSR matrix A
+ *
+ * @tparam KernelHandle A specialization of
+ * KokkosKernels::Experimental::KokkosKernelsHandle
+ * @tparam BsrMatrixType A specialization of KokkosSparse::BsrMatrix
+ * @tparam BType The b vector type
+ * @tparam XType The x vector type
+ * @param handle KernelHandle instance
+ * @param A The BSR matrix
+ * @param b The b vector
+ * @param x The x vector
+ */
+template <typename KernelHandle, typename BsrMatrixType, class BType,
+          class XType,
+          std::enable_if_t<is_bsr_matrix_v<BsrMatrixType>, int> = 0>
+void sptrsv_solve(KernelHandle *handle, const BsrMatrixType &A, BType b,
+                  XType x) {
+  using ExecutionSpace = typename KernelHandle::HandleExecSpace;
+  auto my_exec_space   = ExecutionSpace();
+  sptrsv_solve(my_exec_space, handle, A, b, x);
+}
+
 #if defined(KOKKOSKERNELS_ENABLE_SUPERNODAL_SPTRSV) || defined(DOXY)
 /**
  * @brief Supernodal sptrsv solve phase of x for linear system Ax=b
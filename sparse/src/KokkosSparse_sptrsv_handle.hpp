@@ -16,7 +16,11 @@
 
 #include <Kokkos_Core.hpp>
 #include <iostream>
+#include <stdexcept>
 #include <string>
+#include "KokkosKernels_HandleTelemetry.hpp"
+#include "KokkosKernels_PlanIO.hpp"
+#include "KokkosKernels_Workspace.hpp"
 
 #ifndef KOKKOSSPARSE_SPTRSVHANDLE_HPP
 #define KOKKOSSPARSE_SPTRSVHANDLE_HPP
@@ -44,6 +48,7 @@ enum class SPTRSVAlgorithm {
   SEQLVLSCHD_RP,
   SEQLVLSCHD_TP1 /*, SEQLVLSCHED_TP2*/,
   SEQLVLSCHD_TP1CHAIN,
+  SYNCFREE,  // no level schedule: rows wait on per-row ready flags
   SPTRSV_CUSPARSE,
   SUPERNODAL_NAIVE,
   SUPERNODAL_ETREE,
@@ -261,6 +266,10 @@ class SPTRSVHandle {
 
   using workspace_t = typename Kokkos::View<
       scalar_t *, Kokkos::Device<execution_space, supercols_memory_space>>;
+  // workspace_t already names the per-supernode work view, so the shared
+  // KokkosKernels workspace is called the arena here
+  using arena_t =
+      KokkosKernels::Experimental::Workspace<supercols_memory_space>;
 
   //
   using host_crsmat_t =
@@ -279,6 +288,10 @@ class SPTRSVHandle {
 #endif
 
  private:
+  // Calls and times of sptrsv_symbolic ("symbolic") and sptrsv_solve
+  // ("solve"), recorded only once enabled
+  KokkosKernels::Experimental::HandleTelemetry telemetry;
+
 #ifdef KOKKOSKERNELS_SPTRSV_CUDAGRAPHSUPPORT
   SPTRSVcudaGraphWrapperType *sptrsvCudaGraph;
 #endif
@@ -297,6 +310,20 @@ class SPTRSVHandle {
   hostspace_nnz_lno_view_t hnodes_grouped_by_level;  // NEW
   size_type nlevel;
 
+  // SYNCFREE: ready flag of each row, then the counter of started rows
+  nnz_lno_view_t syncfree_ready;
+
+  // ISAI: whether solves apply the incomplete sparse approximate inverse,
+  // and its CRS once computed by sptrsv_isai
+  bool isai;
+  bool isai_complete;
+  nnz_row_view_t isai_row_map;
+  nnz_lno_view_t isai_entries;
+  nnz_scalar_view_t isai_values;
+
+  // Jacobi sweeps applied by sptrsv_solve instead of solving, if positive
+  int jacobi_sweeps;
+
   int team_size;
   int vector_size;
 
@@ -393,6 +420,11 @@ class SPTRSVHandle {
   integer_view_t diag_kernel_type;
   integer_view_host_t kernel_type_host;
   integer_view_t kernel_type;
+  // number of supernodes, at the start of each level, solved one at a time
+  // with device-level kernels (the others are solved with one launch of the
+  // batched team-level kernels)
+  integer_view_host_t num_device_nodes_host;
+  integer_view_t num_device_nodes;
 
   // permutation
   bool perm_avail;
@@ -417,6 +449,9 @@ class SPTRSVHandle {
   cudaStream_t *cuda_streams;
 #endif
 
+  // where the multi-vector solve draws its temporaries from, if not null
+  arena_t *arena;
+
   // verbose
   bool verbose;
 #endif
@@ -438,6 +473,9 @@ class SPTRSVHandle {
         nodes_grouped_by_level(),
         hnodes_grouped_by_level(),
         nlevel(0),
+        isai(false),
+        isai_complete(false),
+        jacobi_sweeps(0),
         team_size(-1),
         vector_size(-1),
         stored_diagonal(false),
@@ -470,6 +508,7 @@ class SPTRSVHandle {
         sup_size_blocked(200),
         perm_avail(false),
         spmv_trans(true),
+        arena(nullptr),
         verbose(false)
 #endif
   {
@@ -551,6 +590,9 @@ class SPTRSVHandle {
     this->diag_kernel_type = integer_view_t("diag_kernel_type", nsuper_);
     this->kernel_type_host = integer_view_host_t("kernel_type_host", nsuper_);
     this->kernel_type      = integer_view_t("kernel_type", nsuper_);
+    this->num_device_nodes_host =
+        integer_view_host_t("num_device_nodes_host", nsuper_);
+    this->num_device_nodes = integer_view_t("num_device_nodes", nsuper_);
 
     // number of streams
     this->num_streams = 0;
@@ -595,6 +637,13 @@ class SPTRSVHandle {
     return this->work_offset_host;
   }
 
+  // With an arena, the solve of a multivector draws its work views (nrhs
+  // times the workspace size) from it instead of allocating them at each
+  // call; the arena fences when the solve returns. The handle does not own
+  // it, and nullptr (the default) allocates again.
+  void set_arena(arena_t *arena_) { this->arena = arena_; }
+  arena_t *get_arena() const { return this->arena; }
+
   // specify whether too run KokkosKernels::trmm on device or not
   void set_trmm_on_device(bool flag) { this->trmm_on_device = flag; }
 
@@ -649,6 +698,13 @@ class SPTRSVHandle {
   KOKKOS_INLINE_FUNCTION
   integer_view_t get_diag_kernel_type() { return this->diag_kernel_type; }
 
+  integer_view_host_t get_num_device_nodes_host() {
+    return this->num_device_nodes_host;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  integer_view_t get_num_device_nodes() { return this->num_device_nodes; }
+
   // permutation vector
   void set_perm(int *perm_) {
     this->perm     = integer_view_t("PermView", nrows);
@@ -911,6 +967,10 @@ class SPTRSVHandle {
   KOKKOS_INLINE_FUNCTION
   SPTRSVAlgorithm get_algorithm() { return algm; }
 
+  KokkosKernels::Experimental::HandleTelemetry &get_telemetry() {
+    return telemetry;
+  }
+
   KOKKOS_INLINE_FUNCTION
   signed_nnz_lno_view_t get_level_list() const { return level_list; }
 
@@ -956,6 +1016,40 @@ class SPTRSVHandle {
     return nodes_grouped_by_level;
   }
 
+  nnz_lno_view_t get_syncfree_ready() const { return syncfree_ready; }
+  void set_syncfree_ready(const nnz_lno_view_t &ready) {
+    syncfree_ready = ready;
+  }
+
+  // Apply the incomplete sparse approximate inverse of the triangle instead
+  // of solving, once it is computed by sptrsv_isai
+  void set_isai(const bool use) { isai = use; }
+  bool use_isai() const { return isai; }
+  bool is_isai_complete() const { return isai_complete; }
+
+  void set_isai_matrix(const nnz_row_view_t &row_map,
+                       const nnz_lno_view_t &entries,
+                       const nnz_scalar_view_t &values) {
+    isai_row_map  = row_map;
+    isai_entries  = entries;
+    isai_values   = values;
+    isai_complete = true;
+  }
+  nnz_row_view_t get_isai_row_map() const { return isai_row_map; }
+  nnz_lno_view_t get_isai_entries() const { return isai_entries; }
+  nnz_scalar_view_t get_isai_values() const { return isai_values; }
+
+  // Approximate the solve with this many Jacobi sweeps from x = 0, each a
+  // fully parallel pass over the rows; 0 (the default) solves exactly
+  void set_jacobi_sweeps(const int sweeps) {
+    if (sweeps < 0) {
+      throw std::invalid_argument(
+          "SPTRSVHandle::set_jacobi_sweeps: sweeps must be nonnegative");
+    }
+    jacobi_sweeps = sweeps;
+  }
+  int get_jacobi_sweeps() const { return jacobi_sweeps; }
+
   inline hostspace_nnz_lno_view_t get_host_nodes_grouped_by_level() const {
     return hnodes_grouped_by_level;
   }
@@ -1027,6 +1121,66 @@ class SPTRSVHandle {
   int get_num_chain_entries() const { return this->num_chain_entries; }
   void set_num_chain_entries(const int nce) { this->num_chain_entries = nce; }
 
+  /// \brief Save the level schedule computed by sptrsv_symbolic, for
+  /// load() to restore later instead of calling sptrsv_symbolic again.
+  ///
+  /// Only SEQLVLSCHD_RP, SEQLVLSCHD_TP1, SEQLVLSCHD_TP1CHAIN and SYNCFREE
+  /// plans can be saved; the cuSPARSE and supernodal ones keep their data
+  /// in TPL or factor-specific structures.
+  void save(std::ostream &os) const {
+    if (!this->symbolic_complete)
+      throw std::runtime_error(
+          "SPTRSVHandle::save: sptrsv_symbolic has not been called");
+    if (!this->require_symbolic_lvlsched_phase &&
+        algm != SPTRSVAlgorithm::SYNCFREE)
+      throw std::runtime_error(
+          "SPTRSVHandle::save: plans of this algorithm cannot be saved");
+    using namespace KokkosKernels::Impl;
+    write_plan_header(os, "SPTRSVHandle");
+    write_plan_value(os, static_cast<int32_t>(algm));
+    write_plan_value(os, static_cast<uint64_t>(nrows));
+    write_plan_value(os, lower_tri);
+    write_plan_value(os, static_cast<uint64_t>(nlevel));
+    write_plan_value(os, static_cast<uint64_t>(num_chain_entries));
+    write_plan_value(os, chain_threshold);
+    write_plan_view(os, level_list);
+    write_plan_view(os, hnodes_per_level);
+    write_plan_view(os, hnodes_grouped_by_level);
+    write_plan_view(os, h_chain_ptr);
+  }
+
+  /// \brief Restore a schedule written by save() into this handle, which
+  /// must have been created with the same algorithm, number of rows and
+  /// triangle. sptrsv_solve can then be called directly.
+  void load(std::istream &is) {
+    using namespace KokkosKernels::Impl;
+    read_plan_header(is, "SPTRSVHandle");
+    if (read_plan_value<int32_t>(is) != static_cast<int32_t>(algm) ||
+        read_plan_value<uint64_t>(is) != static_cast<uint64_t>(nrows) ||
+        read_plan_value<bool>(is) != lower_tri)
+      throw std::runtime_error(
+          "SPTRSVHandle::load: plan was saved for another algorithm, number "
+          "of rows or triangle");
+    nlevel            = read_plan_value<uint64_t>(is);
+    num_chain_entries = read_plan_value<uint64_t>(is);
+    chain_threshold   = read_plan_value<signed_integral_t>(is);
+    read_plan_view(is, level_list);
+    read_plan_view(is, hnodes_per_level);
+    read_plan_view(is, hnodes_grouped_by_level);
+    read_plan_view(is, h_chain_ptr);
+    if (require_symbolic_lvlsched_phase) {
+      Kokkos::resize(Kokkos::WithoutInitializing, nodes_per_level,
+                     hnodes_per_level.extent(0));
+      Kokkos::resize(Kokkos::WithoutInitializing, nodes_grouped_by_level,
+                     hnodes_grouped_by_level.extent(0));
+      Kokkos::deep_copy(nodes_per_level, hnodes_per_level);
+      Kokkos::deep_copy(nodes_grouped_by_level, hnodes_grouped_by_level);
+    }
+    if (algm == SPTRSVAlgorithm::SYNCFREE)
+      syncfree_ready = nnz_lno_view_t("syncfree_ready", nrows + 1);
+    symbolic_complete = true;
+  }
+
   void print_algorithm() {
     if (algm == SPTRSVAlgorithm::SEQLVLSCHD_RP)
       std::cout << "SEQLVLSCHD_RP" << std::endl;
@@ -1046,6 +1200,8 @@ class SPTRSVHandle {
       std::cout << "SEQLVLSCHD_TP1CHAIN" << std::endl;
     ;
 
+    if (algm == SPTRSVAlgorithm::SYNCFREE) std::cout << "SYNCFREE" << std::endl;
+
     if (algm == SPTRSVAlgorithm::SPTRSV_CUSPARSE)
       std::cout << "SPTRSV_CUSPARSE" << std::endl;
     ;
@@ -1079,6 +1235,8 @@ class SPTRSVHandle {
     if (algm == SPTRSVAlgorithm::SEQLVLSCHD_TP1CHAIN)
       ret_string = "SEQLVLSCHD_TP1CHAIN";
 
+    if (algm == SPTRSVAlgorithm::SYNCFREE) ret_string = "SYNCFREE";
+
     if (algm == SPTRSVAlgorithm::SPTRSV_CUSPARSE)
       ret_string = "SPTRSV_CUSPARSE";
 
@@ -1096,6 +1254,8 @@ class SPTRSVHandle {
      * SPTRSVAlgorithm::SEQLVLSCHED_TP2;*/
     else if (name == "SPTRSV_TEAMPOLICY1CHAIN")
       return SPTRSVAlgorithm::SEQLVLSCHD_TP1CHAIN;
+    else if (name == "SPTRSV_SYNCFREE")
+      return SPTRSVAlgorithm::SYNCFREE;
     else if (name == "SPTRSV_CUSPARSE")
       return SPTRSVAlgorithm::SPTRSV_CUSPARSE;
     else
@@ -0,0 +1,238 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file KokkosSparse_sptrsv_supernodal_cholesky.hpp
+/// \brief Supernodal sparse triangular solves with the factor of
+///   KokkosSparse_supernodal_cholesky.hpp (in place of a CHOLMOD factor)
+
+#ifndef KOKKOSSPARSE_SPTRSV_SUPERNODAL_CHOLESKY_HPP_
+#define KOKKOSSPARSE_SPTRSV_SUPERNODAL_CHOLESKY_HPP_
+
+#if defined(KOKKOSKERNELS_ENABLE_SUPERNODAL_SPTRSV)
+
+#include "KokkosSparse_supernodal_cholesky.hpp"
+#include "KokkosSparse_sptrsv_supernode.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+/* Auxiliary functions for symbolic analysis */
+
+/* =========================================================================================
+ */
+template <typename graph_t, typename KernelHandle, typename ScalarType,
+          class DeviceType>
+graph_t read_supernodal_cholesky_graphL(
+    KernelHandle *kernelHandle,
+    SupernodalCholeskyFactor<ScalarType, DeviceType> &F) {
+  int *mb     = F.rowptr.data();
+  int *nb     = F.supercols.data();
+  int *rowind = F.rowind.data();
+
+  bool ptr_by_column = false;
+  if (kernelHandle->is_sptrsv_column_major()) {
+    int nnzA = F.valptr(F.nsuper);
+    return read_supernodal_graphL<graph_t>(kernelHandle, F.n, F.nsuper, nnzA,
+                                           ptr_by_column, mb, nb, rowind);
+  } else {
+    return read_supernodal_graphLt<graph_t>(kernelHandle, F.n, F.nsuper,
+                                            ptr_by_column, mb, nb, rowind);
+  }
+}
+
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+/* For symbolic analysis */
+// The handles keep a pointer to the supernodal etree of F (and update it if
+// supernodes are merged), so F must outlive them.
+template <typename KernelHandle, typename ScalarType, class DeviceType>
+void sptrsv_symbolic(KernelHandle *kernelHandleL, KernelHandle *kernelHandleU,
+                     SupernodalCholeskyFactor<ScalarType, DeviceType> &F) {
+  if (!F.symbolic_complete) {
+    throw std::runtime_error(
+        "sptrsv_symbolic: supernodal_cholesky_symbolic must be called first");
+  }
+  // ===================================================================
+  // load sptrsv-handles
+  auto *handleU = kernelHandleU->get_sptrsv_handle();
+
+  // ==============================================
+  // load supernodes
+  int nsuper = F.nsuper;
+  using integer_view_host_t =
+      typename KernelHandle::SPTRSVHandleType::integer_view_host_t;
+  integer_view_host_t supercols_view =
+      integer_view_host_t("supercols", 1 + nsuper);
+  for (int i = 0; i <= nsuper; i++) {
+    supercols_view(i) = F.supercols(i);
+  }
+
+  // ==============================================
+  // load etree of the supernodes
+  int *etree = F.etree.data();
+
+  // ==============================================
+  // extract CrsGraph for L
+  using host_graph_t = typename KernelHandle::SPTRSVHandleType::host_graph_t;
+  auto graphL = read_supernodal_cholesky_graphL<host_graph_t>(kernelHandleL, F);
+
+  if (handleU->is_column_major()) {
+    // ==============================================
+    // extract CrsGraph for U
+    handleU->set_column_major(false);
+    auto graphU =
+        read_supernodal_cholesky_graphL<host_graph_t>(kernelHandleU, F);
+    handleU->set_column_major(true);
+
+    // ==============================================
+    // call supnodal symbolic
+    sptrsv_supernodal_symbolic(nsuper, supercols_view.data(), etree, graphL,
+                               kernelHandleL, graphU, kernelHandleU);
+  } else {
+    // ==============================================
+    // call supnodal symbolic
+    sptrsv_supernodal_symbolic(nsuper, supercols_view.data(), etree, graphL,
+                               kernelHandleL, graphL, kernelHandleU);
+  }
+}
+
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+/* Auxiliary functions for numeric computation */
+
+/* =========================================================================================
+ */
+template <typename crsmat_t, typename graph_t, typename KernelHandle,
+          typename ScalarType, class DeviceType>
+crsmat_t read_supernodal_cholesky_factor(
+    KernelHandle *kernelHandle,
+    SupernodalCholeskyFactor<ScalarType, DeviceType> &F,
+    graph_t &static_graph) {
+  int *mb     = F.rowptr.data();
+  int *nb     = F.supercols.data();
+  int *colptr = F.valptr.data();
+  int *rowind = F.rowind.data();
+  // the blocks are inverted on the host
+  auto Lx_view =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), F.values);
+  ScalarType *Lx = Lx_view.data();
+
+  bool ptr_by_column = false;
+  if (kernelHandle->is_sptrsv_column_major()) {
+    return read_supernodal_values<crsmat_t>(kernelHandle, F.n, F.nsuper,
+                                            ptr_by_column, mb, nb, colptr,
+                                            rowind, Lx, static_graph);
+  } else {
+    return read_supernodal_valuesLt<crsmat_t>(kernelHandle, F.n, F.nsuper,
+                                              ptr_by_column, mb, nb, colptr,
+                                              rowind, Lx, static_graph);
+  }
+}
+
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+/* For numeric computation */
+template <typename KernelHandle, typename ScalarType, class DeviceType>
+void sptrsv_compute(KernelHandle *kernelHandleL, KernelHandle *kernelHandleU,
+                    SupernodalCholeskyFactor<ScalarType, DeviceType> &F) {
+  // ==============================================
+  // load sptrsv-handles
+  auto *handleL = kernelHandleL->get_sptrsv_handle();
+  auto *handleU = kernelHandleU->get_sptrsv_handle();
+
+  if (!(handleL->is_symbolic_complete()) ||
+      !(handleU->is_symbolic_complete())) {
+    throw std::runtime_error(
+        "sptrsv_compute: sptrsv_symbolic must be called first");
+  }
+  if (!F.numeric_complete) {
+    throw std::runtime_error(
+        "sptrsv_compute: supernodal_cholesky_numeric must be called first");
+  }
+
+  // ==============================================
+  // load options
+  bool useSpMV =
+      (handleL->get_algorithm() == SPTRSVAlgorithm::SUPERNODAL_SPMV ||
+       handleL->get_algorithm() == SPTRSVAlgorithm::SUPERNODAL_SPMV_DAG);
+
+  // ==============================================
+  // load crsGraph
+  auto graph = handleL->get_graph();
+
+  // ==============================================
+  // read numerical values of L
+  using crsmat_t = typename KernelHandle::SPTRSVHandleType::crsmat_t;
+  auto factorL =
+      read_supernodal_cholesky_factor<crsmat_t>(kernelHandleL, F, graph);
+
+  // ==============================================
+  // split the matrix into submatrices for spmv at each level
+  if (useSpMV) {
+    split_crsmat<crsmat_t>(kernelHandleL, factorL);
+  }
+
+  // ==============================================
+  // save crsmat
+  handleL->set_crsmat(factorL);
+  if (handleU->is_column_major()) {
+    auto graphU = handleU->get_graph();
+
+    handleU->set_lower_tri(true);
+    handleU->set_column_major(false);
+    auto factorU =
+        read_supernodal_cholesky_factor<crsmat_t>(kernelHandleU, F, graphU);
+
+    handleU->set_lower_tri(false);
+    handleU->set_column_major(true);
+    // ==============================================
+    // split the matrix into submatrices for spmv at each level
+    if (useSpMV) {
+      split_crsmat<crsmat_t>(kernelHandleU, factorU);
+    }
+    handleU->set_crsmat(factorU);
+  } else {
+    handleU->set_crsmat(factorL);
+    if (useSpMV) {
+      if (!handleL->get_invert_offdiagonal()) {
+        // copy submatrices to U for SpMV at each level
+        auto nlevels = handleL->get_num_levels();
+        std::vector<crsmat_t> sub_crsmats(nlevels);
+        std::vector<crsmat_t> diag_blocks(nlevels);
+        for (int lvl = 0; lvl < nlevels; lvl++) {
+          sub_crsmats[lvl] = handleL->get_submatrix(nlevels - lvl - 1);
+          diag_blocks[lvl] = handleL->get_diagblock(nlevels - lvl - 1);
+        }
+        handleU->set_submatrices(sub_crsmats);
+        handleU->set_diagblocks(diag_blocks);
+      } else {
+        // not supported
+      }
+    }
+  }
+
+  // ==============================================
+  handleL->set_numeric_complete();
+  handleU->set_numeric_complete();
+}
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSKERNELS_ENABLE_SUPERNODAL_SPTRSV
+#endif  // KOKKOSSPARSE_SPTRSV_SUPERNODAL_CHOLESKY_HPP_
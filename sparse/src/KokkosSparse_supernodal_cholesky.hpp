@@ -0,0 +1,163 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file KokkosSparse_supernodal_cholesky.hpp
+/// \brief Native supernodal Cholesky factorization
+///
+/// The symbolic phase (elimination tree, fundamental supernodes and their
+/// row structures) runs on the host. The numeric phase runs on the device,
+/// one level of the supernodal elimination tree at a time, with a team per
+/// supernode: KokkosBatched::TeamPotrf on its diagonal block, a triangular
+/// solve for its off-diagonal rows, and the update of its ancestors.
+/// The factor is stored like CHOLMOD's supernodal factor, so that it can be
+/// handed to the supernodal sparse triangular solves
+/// (KokkosSparse_sptrsv_supernodal_cholesky.hpp).
+
+#ifndef KOKKOSSPARSE_SUPERNODAL_CHOLESKY_HPP_
+#define KOKKOSSPARSE_SUPERNODAL_CHOLESKY_HPP_
+
+#include <sstream>
+#include <stdexcept>
+#include <Kokkos_Core.hpp>
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_supernodal_cholesky_impl.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+
+/// \brief Supernodal Cholesky factor A = L * L^H of a Hermitian positive
+///   definite matrix A.
+///
+/// Supernode s holds the columns supercols(s) to supercols(s + 1) - 1 of L,
+/// which share the row structure rowind(rowptr(s)) to
+/// rowind(rowptr(s + 1) - 1): the columns of the supernode first, then its
+/// off-diagonal rows, in ascending order. Its values are a dense column-major
+/// panel with one row per entry of this structure, starting at
+/// values(valptr(s)) (the strictly upper part of the diagonal block is not
+/// referenced). These match L->super, L->pi, L->s, L->px and L->x of a
+/// CHOLMOD supernodal factor.
+template <typename ScalarType, class DeviceType>
+struct SupernodalCholeskyFactor {
+  using scalar_type         = ScalarType;
+  using device_type         = DeviceType;
+  using execution_space     = typename DeviceType::execution_space;
+  using memory_space        = typename DeviceType::memory_space;
+  using integer_view_host_t = Kokkos::View<int *, Kokkos::HostSpace>;
+  using integer_view_t      = Kokkos::View<int *, DeviceType>;
+  using values_view_t       = Kokkos::View<ScalarType *, DeviceType>;
+
+  int n      = 0;
+  int nsuper = 0;
+  // supernodal structure, on host
+  integer_view_host_t supercols;
+  integer_view_host_t rowptr;
+  integer_view_host_t rowind;
+  integer_view_host_t valptr;
+  // parent supernode in the elimination tree (-1 for a root)
+  integer_view_host_t etree;
+  // supernodes of each level of the elimination tree, leaves first:
+  // level l holds level_super(level_ptr(l)) to level_super(level_ptr(l+1)-1)
+  integer_view_host_t level_ptr;
+  integer_view_host_t level_super;
+
+  // the same on device, and the supernode of each column
+  integer_view_t supercols_d;
+  integer_view_t rowptr_d;
+  integer_view_t rowind_d;
+  integer_view_t valptr_d;
+  integer_view_t level_super_d;
+  integer_view_t col2super_d;
+
+  // the panels of L
+  values_view_t values;
+
+  bool symbolic_complete = false;
+  bool numeric_complete  = false;
+};
+
+// clang-format off
+/// \brief Symbolic phase of the supernodal Cholesky factorization, on the
+///   host: elimination tree, fundamental supernodes, and the structure and
+///   storage of the factor.
+///
+/// \param A The KokkosSparse::CrsMatrix, with a symmetric sparsity pattern
+///   and both of its triangles stored. Only the lower one is read. No fill
+///   reducing ordering is applied, so A should already be ordered.
+/// \param F The factor, with A's scalar type and device.
+// clang-format on
+template <typename ScalarType, typename OrdinalType, class DeviceType,
+          class MemoryTraitsType, typename SizeType>
+void supernodal_cholesky_symbolic(
+    const KokkosSparse::CrsMatrix<ScalarType, OrdinalType, DeviceType,
+                                  MemoryTraitsType, SizeType> &A,
+    SupernodalCholeskyFactor<ScalarType, DeviceType> &F) {
+  if (A.numRows() != A.numCols()) {
+    std::ostringstream os;
+    os << "supernodal_cholesky_symbolic: A is " << A.numRows() << " x "
+       << A.numCols() << ", not square";
+    throw std::invalid_argument(os.str());
+  }
+  auto rowmap = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                    A.graph.row_map);
+  auto entries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                     A.graph.entries);
+  Impl::supernodal_cholesky_symbolic_host(F, A.numRows(), rowmap, entries);
+}
+
+// clang-format off
+/// \brief Numeric phase of the supernodal Cholesky factorization, on the
+///   device. It can be called again for new values of A with the same
+///   sparsity pattern.
+///
+/// \param A The KokkosSparse::CrsMatrix given to
+///   supernodal_cholesky_symbolic, with possibly new values.
+/// \param F The factor, after supernodal_cholesky_symbolic.
+/// \throw std::runtime_error if A is not positive definite.
+// clang-format on
+template <typename ScalarType, typename OrdinalType, class DeviceType,
+          class MemoryTraitsType, typename SizeType>
+void supernodal_cholesky_numeric(
+    const KokkosSparse::CrsMatrix<ScalarType, OrdinalType, DeviceType,
+                                  MemoryTraitsType, SizeType> &A,
+    SupernodalCholeskyFactor<ScalarType, DeviceType> &F) {
+  if (!F.symbolic_complete) {
+    throw std::runtime_error(
+        "supernodal_cholesky_numeric: supernodal_cholesky_symbolic must be "
+        "called first");
+  }
+  if (A.numRows() != F.n) {
+    std::ostringstream os;
+    os << "supernodal_cholesky_numeric: A has " << A.numRows()
+       << " rows, but the symbolic phase was done for " << F.n;
+    throw std::invalid_argument(os.str());
+  }
+  F.numeric_complete = false;
+  const int failed_column = Impl::supernodal_cholesky_numeric_device(
+      F, A.graph.row_map, A.graph.entries, A.values);
+  if (failed_column >= 0) {
+    std::ostringstream os;
+    os << "supernodal_cholesky_numeric: A is not positive definite (at "
+          "column "
+       << failed_column << ")";
+    throw std::runtime_error(os.str());
+  }
+  F.numeric_complete = true;
+}
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SUPERNODAL_CHOLESKY_HPP_
@@ -31,6 +31,10 @@ struct CusparseSingleton {
   CusparseSingleton();
 
   static CusparseSingleton& singleton();
+
+  /// A cuSPARSE handle bound to stream, shared by every call on that stream.
+  /// Unlike cusparseHandle, its stream never needs to be set or reset.
+  static cusparseHandle_t stream_handle(cudaStream_t stream);
 };
 
 }  // namespace Impl
@@ -49,6 +53,10 @@ struct RocsparseSingleton {
   RocsparseSingleton();
 
   static RocsparseSingleton& singleton();
+
+  /// A rocSPARSE handle bound to stream, shared by every call on that stream.
+  /// Unlike rocsparseHandle, its stream never needs to be set or reset.
+  static rocsparse_handle stream_handle(hipStream_t stream);
 };
 
 }  // namespace Impl
@@ -18,6 +18,7 @@
 #define KOKKOSKERNELS_TPL_HANDLES_DEF_HPP_
 
 #include "KokkosKernels_tpl_handles_decl.hpp"
+#include "KokkosKernels_TplHandleCache.hpp"
 
 #ifdef KOKKOSKERNELS_ENABLE_TPL_CUSPARSE
 #include "cusparse.h"
@@ -36,6 +37,16 @@ CusparseSingleton& CusparseSingleton::singleton() {
   return s;
 }
 
+cusparseHandle_t CusparseSingleton::stream_handle(cudaStream_t stream) {
+  static TplHandleCache<cudaStream_t, cusparseHandle_t> cache(
+      [](cusparseHandle_t* h) { KOKKOS_CUSPARSE_SAFE_CALL(cusparseCreate(h)); },
+      [](cusparseHandle_t h, cudaStream_t st) {
+        KOKKOS_CUSPARSE_SAFE_CALL(cusparseSetStream(h, st));
+      },
+      [](cusparseHandle_t h) { cusparseDestroy(h); });
+  return cache.get(stream);
+}
+
 }  // namespace Impl
 }  // namespace KokkosKernels
 #endif
@@ -59,6 +70,20 @@ RocsparseSingleton& RocsparseSingleton::singleton() {
   return s;
 }
 
+rocsparse_handle RocsparseSingleton::stream_handle(hipStream_t stream) {
+  static TplHandleCache<hipStream_t, rocsparse_handle> cache(
+      [](rocsparse_handle* h) {
+        KOKKOS_ROCSPARSE_SAFE_CALL_IMPL(rocsparse_create_handle(h));
+      },
+      [](rocsparse_handle h, hipStream_t st) {
+        KOKKOS_ROCSPARSE_SAFE_CALL_IMPL(rocsparse_set_stream(h, st));
+      },
+      [](rocsparse_handle h) {
+        KOKKOS_ROCSPARSE_SAFE_CALL_IMPL(rocsparse_destroy_handle(h));
+      });
+  return cache.get(stream);
+}
+
 }  // namespace Impl
 }  // namespace KokkosKernels
 #endif  // KOKKOSKERNELS_ENABLE_TPL_ROCSPARSE
@@ -0,0 +1,70 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_SDDMM_TPL_SPEC_AVAIL_HPP_
+#define KOKKOSSPARSE_SDDMM_TPL_SPEC_AVAIL_HPP_
+
+#ifdef KOKKOSKERNELS_ENABLE_TPL_CUSPARSE
+#include "cusparse.h"
+#endif
+
+namespace KokkosSparse {
+namespace Impl {
+
+// Specialization struct which defines whether a TPL SDDMM exists for the
+// values, ordinals and offsets of S and C, on the given execution and
+// memory spaces. The dense A and B must also be LayoutLeft or LayoutRight,
+// which sddmm checks separately.
+template <class ExecutionSpace, class Scalar, class Ordinal, class Offset,
+          class MemorySpace>
+struct sddmm_tpl_spec_avail {
+  enum : bool { value = false };
+};
+
+#define KOKKOSSPARSE_SDDMM_TPL_SPEC_AVAIL_CUSPARSE(SCALAR, ORDINAL, OFFSET, \
+                                                   MEMSPACE)                \
+  template <>                                                               \
+  struct sddmm_tpl_spec_avail<Kokkos::Cuda, SCALAR, ORDINAL, OFFSET,        \
+                              MEMSPACE> {                                   \
+    enum : bool { value = true };                                           \
+  };
+
+// cusparseSDDMM first shipped with CUDA 11.2 (cuSPARSE 11.3.1)
+#if defined(KOKKOSKERNELS_ENABLE_TPL_CUSPARSE) && \
+    defined(CUSPARSE_VERSION) && (11301 <= CUSPARSE_VERSION)
+#define KOKKOSSPARSE_SDDMM_CUSPARSE
+KOKKOSSPARSE_SDDMM_TPL_SPEC_AVAIL_CUSPARSE(float, int, int, Kokkos::CudaSpace)
+KOKKOSSPARSE_SDDMM_TPL_SPEC_AVAIL_CUSPARSE(double, int, int, Kokkos::CudaSpace)
+KOKKOSSPARSE_SDDMM_TPL_SPEC_AVAIL_CUSPARSE(Kokkos::complex<float>, int, int,
+                                           Kokkos::CudaSpace)
+KOKKOSSPARSE_SDDMM_TPL_SPEC_AVAIL_CUSPARSE(Kokkos::complex<double>, int, int,
+                                           Kokkos::CudaSpace)
+KOKKOSSPARSE_SDDMM_TPL_SPEC_AVAIL_CUSPARSE(float, int, int,
+                                           Kokkos::CudaUVMSpace)
+KOKKOSSPARSE_SDDMM_TPL_SPEC_AVAIL_CUSPARSE(double, int, int,
+                                           Kokkos::CudaUVMSpace)
+KOKKOSSPARSE_SDDMM_TPL_SPEC_AVAIL_CUSPARSE(Kokkos::complex<float>, int, int,
+                                           Kokkos::CudaUVMSpace)
+KOKKOSSPARSE_SDDMM_TPL_SPEC_AVAIL_CUSPARSE(Kokkos::complex<double>, int, int,
+                                           Kokkos::CudaUVMSpace)
+#endif
+
+#undef KOKKOSSPARSE_SDDMM_TPL_SPEC_AVAIL_CUSPARSE
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SDDMM_TPL_SPEC_AVAIL_HPP_
@@ -0,0 +1,129 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_SDDMM_TPL_SPEC_DECL_HPP_
+#define KOKKOSSPARSE_SDDMM_TPL_SPEC_DECL_HPP_
+
+#include "KokkosSparse_sddmm_tpl_spec_avail.hpp"
+
+#ifdef KOKKOSSPARSE_SDDMM_CUSPARSE
+#include "KokkosKernels_tpl_handles_decl.hpp"
+#include "KokkosSparse_Utils_cusparse.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+
+/// Column-major cuSPARSE descriptor of the rank-2 view X, and whether it
+/// describes X (false) or its transpose (true, for LayoutRight).
+template <class XView>
+cusparseDnMatDescr_t sddmm_cusparse_dn_mat(const XView& X, bool& transposed) {
+  transposed =
+      std::is_same_v<typename XView::array_layout, Kokkos::LayoutRight>;
+  const int64_t rows = transposed ? X.extent(1) : X.extent(0);
+  const int64_t cols = transposed ? X.extent(0) : X.extent(1);
+  int64_t ld         = transposed ? X.stride(0) : X.stride(1);
+  if (ld < rows) ld = rows;
+  cusparseDnMatDescr_t descr;
+  KOKKOS_CUSPARSE_SAFE_CALL(cusparseCreateDnMat(
+      &descr, rows, cols, ld,
+      const_cast<typename XView::non_const_value_type*>(X.data()),
+      cuda_data_type_from<typename XView::non_const_value_type>(),
+      CUSPARSE_ORDER_COL));
+  return descr;
+}
+
+/// C := S .* (A * B^T) with cusparseSDDMM, which computes A * B^T at the
+/// pattern of S; the values of S are applied afterwards. The product goes
+/// to a temporary when C shares the values of S.
+template <class SMatrix, class AView, class BView, class CValues>
+void sddmm_cusparse(const Kokkos::Cuda& exec, const SMatrix& S,
+                    const AView& A, const BView& B, const CValues& Cvalues) {
+  using value_type   = typename CValues::non_const_value_type;
+  using offset_type  = typename SMatrix::non_const_size_type;
+  using entry_type   = typename SMatrix::non_const_ordinal_type;
+  using memory_space = typename CValues::memory_space;
+  static_assert(
+      std::is_same_v<value_type, typename SMatrix::non_const_value_type>,
+      "sddmm_cusparse: S and C must have the same value type");
+
+  /* cuSPARSE handle bound to the stream of exec */
+  cusparseHandle_t cusparseHandle =
+      KokkosKernels::Impl::CusparseSingleton::stream_handle(
+          exec.cuda_stream());
+
+  Kokkos::View<value_type*, memory_space> product;
+  value_type* productData = Cvalues.data();
+  if (Cvalues.data() == S.values.data()) {
+    product = Kokkos::View<value_type*, memory_space>(
+        Kokkos::view_alloc(exec, Kokkos::WithoutInitializing,
+                           "sddmm product"),
+        S.nnz());
+    productData = product.data();
+  }
+
+  const cudaDataType valueType = cuda_data_type_from<value_type>();
+  cusparseSpMatDescr_t matC;
+  KOKKOS_CUSPARSE_SAFE_CALL(cusparseCreateCsr(
+      &matC, S.numRows(), S.numCols(), S.nnz(),
+      const_cast<offset_type*>(S.graph.row_map.data()),
+      const_cast<entry_type*>(S.graph.entries.data()), productData,
+      cusparse_index_type_t_from<offset_type>(),
+      cusparse_index_type_t_from<entry_type>(), CUSPARSE_INDEX_BASE_ZERO,
+      valueType));
+
+  // op(A) must be A and op(B) must be B^T. A LayoutRight view is described
+  // as its transpose, which the operation undoes.
+  bool aTransposed, bTransposed;
+  cusparseDnMatDescr_t matA = sddmm_cusparse_dn_mat(A, aTransposed);
+  cusparseDnMatDescr_t matB = sddmm_cusparse_dn_mat(B, bTransposed);
+  const cusparseOperation_t opA = aTransposed
+                                      ? CUSPARSE_OPERATION_TRANSPOSE
+                                      : CUSPARSE_OPERATION_NON_TRANSPOSE;
+  const cusparseOperation_t opB = bTransposed
+                                      ? CUSPARSE_OPERATION_NON_TRANSPOSE
+                                      : CUSPARSE_OPERATION_TRANSPOSE;
+
+  const value_type alpha = Kokkos::ArithTraits<value_type>::one();
+  const value_type beta  = Kokkos::ArithTraits<value_type>::zero();
+  size_t bufferSize      = 0;
+  KOKKOS_CUSPARSE_SAFE_CALL(cusparseSDDMM_bufferSize(
+      cusparseHandle, opA, opB, &alpha, matA, matB, &beta, matC, valueType,
+      CUSPARSE_SDDMM_ALG_DEFAULT, &bufferSize));
+  Kokkos::View<char*, memory_space> buffer(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "sddmm buffer"),
+      bufferSize);
+  KOKKOS_CUSPARSE_SAFE_CALL(cusparseSDDMM(
+      cusparseHandle, opA, opB, &alpha, matA, matB, &beta, matC, valueType,
+      CUSPARSE_SDDMM_ALG_DEFAULT, buffer.data()));
+
+  KOKKOS_CUSPARSE_SAFE_CALL(cusparseDestroyDnMat(matA));
+  KOKKOS_CUSPARSE_SAFE_CALL(cusparseDestroyDnMat(matB));
+  KOKKOS_CUSPARSE_SAFE_CALL(cusparseDestroySpMat(matC));
+
+  auto Svalues = S.values;
+  Kokkos::parallel_for(
+      "KokkosSparse::sddmm::scale",
+      Kokkos::RangePolicy<Kokkos::Cuda>(exec, 0, S.nnz()),
+      KOKKOS_LAMBDA(const offset_type k) {
+        Cvalues(k) = Svalues(k) * productData[k];
+      });
+}
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif
+#endif  // KOKKOSSPARSE_SDDMM_TPL_SPEC_DECL_HPP_
@@ -41,16 +41,16 @@ namespace Impl {
 #if (CUDA_VERSION >= 11040)
 
 // 11.4+ supports generic API with reuse (full symbolic/numeric separation)
-template <typename KernelHandle, typename lno_t, typename ConstRowMapType,
-          typename ConstEntriesType, typename ConstValuesType,
-          typename EntriesType, typename ValuesType>
+template <typename ExecSpace, typename KernelHandle, typename lno_t,
+          typename ConstRowMapType, typename ConstEntriesType,
+          typename ConstValuesType, typename EntriesType, typename ValuesType>
 void spgemm_numeric_cusparse(
-    KernelHandle *handle, lno_t /*m*/, lno_t /*n*/, lno_t /*k*/,
-    const ConstRowMapType &row_mapA, const ConstEntriesType &entriesA,
-    const ConstValuesType &valuesA, const ConstRowMapType &row_mapB,
-    const ConstEntriesType &entriesB, const ConstValuesType &valuesB,
-    const ConstRowMapType &row_mapC, const EntriesType &entriesC,
-    const ValuesType &valuesC) {
+    const ExecSpace &exec, KernelHandle *handle, lno_t /*m*/, lno_t /*n*/,
+    lno_t /*k*/, const ConstRowMapType &row_mapA,
+    const ConstEntriesType &entriesA, const ConstValuesType &valuesA,
+    const ConstRowMapType &row_mapB, const ConstEntriesType &entriesB,
+    const ConstValuesType &valuesB, const ConstRowMapType &row_mapC,
+    const EntriesType &entriesC, const ValuesType &valuesC) {
   using scalar_type = typename KernelHandle::nnz_scalar_t;
   using size_type   = typename KernelHandle::size_type;
   auto h            = handle->get_cusparse_spgemm_handle();
@@ -64,8 +64,7 @@ void spgemm_numeric_cusparse(
                    Kokkos::MemoryTraits<Kokkos::Unmanaged>>
       row_mapC_nonconst(const_cast<size_type *>(row_mapC.data()),
                         row_mapC.extent(0));
-      Kokkos::deep_copy(typename KernelHandle::HandleExecSpace(),
-                        row_mapC_nonconst, size_type(0));
+      Kokkos::deep_copy(exec, row_mapC_nonconst, size_type(0));
       handle->set_computed_rowptrs();
     }
     handle->set_computed_entries();
@@ -125,16 +124,16 @@ void spgemm_numeric_cusparse(
 
 #elif (CUDA_VERSION >= 11000)
 // 11.0-11.3 supports only the generic API, but not reuse.
-template <typename KernelHandle, typename lno_t, typename ConstRowMapType,
-          typename ConstEntriesType, typename ConstValuesType,
-          typename EntriesType, typename ValuesType>
+template <typename ExecSpace, typename KernelHandle, typename lno_t,
+          typename ConstRowMapType, typename ConstEntriesType,
+          typename ConstValuesType, typename EntriesType, typename ValuesType>
 void spgemm_numeric_cusparse(
-    KernelHandle *handle, lno_t /*m*/, lno_t /*n*/, lno_t /*k*/,
-    const ConstRowMapType &row_mapA, const ConstEntriesType &entriesA,
-    const ConstValuesType &valuesA, const ConstRowMapType &row_mapB,
-    const ConstEntriesType &entriesB, const ConstValuesType &valuesB,
-    const ConstRowMapType &row_mapC, const EntriesType &entriesC,
-    const ValuesType &valuesC) {
+    const ExecSpace & /* exec */, KernelHandle *handle, lno_t /*m*/,
+    lno_t /*n*/, lno_t /*k*/, const ConstRowMapType &row_mapA,
+    const ConstEntriesType &entriesA, const ConstValuesType &valuesA,
+    const ConstRowMapType &row_mapB, const ConstEntriesType &entriesB,
+    const ConstValuesType &valuesB, const ConstRowMapType &row_mapC,
+    const EntriesType &entriesC, const ValuesType &valuesC) {
   using scalar_type = typename KernelHandle::nnz_scalar_t;
   auto h            = handle->get_cusparse_spgemm_handle();
   KOKKOS_CUSPARSE_SAFE_CALL(
@@ -194,16 +193,16 @@ CUSPARSE_XCSRGEMM_SPEC(Kokkos::complex<double>, cuDoubleComplex, Z)
 #undef CUSPARSE_XCSRGEMM_SPEC
 
 // 10.x supports the pre-generic interface.
-template <typename KernelHandle, typename lno_t, typename ConstRowMapType,
-          typename ConstEntriesType, typename ConstValuesType,
-          typename EntriesType, typename ValuesType>
+template <typename ExecSpace, typename KernelHandle, typename lno_t,
+          typename ConstRowMapType, typename ConstEntriesType,
+          typename ConstValuesType, typename EntriesType, typename ValuesType>
 void spgemm_numeric_cusparse(
-    KernelHandle *handle, lno_t m, lno_t n, lno_t k,
-    const ConstRowMapType &row_mapA, const ConstEntriesType &entriesA,
-    const ConstValuesType &valuesA, const ConstRowMapType &row_mapB,
-    const ConstEntriesType &entriesB, const ConstValuesType &valuesB,
-    const ConstRowMapType &row_mapC, const EntriesType &entriesC,
-    const ValuesType &valuesC) {
+    const ExecSpace & /* exec */, KernelHandle *handle, lno_t m, lno_t n,
+    lno_t k, const ConstRowMapType &row_mapA,
+    const ConstEntriesType &entriesA, const ConstValuesType &valuesA,
+    const ConstRowMapType &row_mapB, const ConstEntriesType &entriesB,
+    const ConstValuesType &valuesB, const ConstRowMapType &row_mapC,
+    const EntriesType &entriesC, const ValuesType &valuesC) {
   auto h = handle->get_cusparse_spgemm_handle();
 
   int nnzA = entriesA.extent(0);
@@ -274,22 +273,26 @@ void spgemm_numeric_cusparse(
         Kokkos::View<SCALAR *, default_layout,                                 \
                      Kokkos::Device<Kokkos::Cuda, MEMSPACE>,                   \
                      Kokkos::MemoryTraits<Kokkos::Unmanaged>>;                 \
-    static void spgemm_numeric(KernelHandle *handle,                           \
-                               typename KernelHandle::nnz_lno_t m,             \
-                               typename KernelHandle::nnz_lno_t n,             \
-                               typename KernelHandle::nnz_lno_t k,             \
-                               c_int_view_t row_mapA, c_int_view_t entriesA,   \
-                               c_scalar_view_t valuesA, bool,                  \
-                               c_int_view_t row_mapB, c_int_view_t entriesB,   \
-                               c_scalar_view_t valuesB, bool,                  \
-                               c_int_view_t row_mapC, int_view_t entriesC,     \
-                               scalar_view_t valuesC) {                        \
+    static void spgemm_numeric(                                                \
+        const Kokkos::Cuda &space, KernelHandle *handle,                       \
+        typename KernelHandle::nnz_lno_t m,                                    \
+        typename KernelHandle::nnz_lno_t n,                                    \
+        typename KernelHandle::nnz_lno_t k, c_int_view_t row_mapA,             \
+        c_int_view_t entriesA, c_scalar_view_t valuesA, bool,                  \
+        c_int_view_t row_mapB, c_int_view_t entriesB,                          \
+        c_scalar_view_t valuesB, bool, c_int_view_t row_mapC,                  \
+        int_view_t entriesC, scalar_view_t valuesC) {                          \
       std::string label = "KokkosSparse::spgemm_numeric[TPL_CUSPARSE," +       \
                           Kokkos::ArithTraits<SCALAR>::name() + "]";           \
       Kokkos::Profiling::pushRegion(label);                                    \
-      spgemm_numeric_cusparse(handle->get_spgemm_handle(), m, n, k, row_mapA,  \
-                              entriesA, valuesA, row_mapB, entriesB, valuesB,  \
-                              row_mapC, entriesC, valuesC);                    \
+      auto &cuspHandle =                                                       \
+          KokkosKernels::Impl::CusparseSingleton::singleton().cusparseHandle;  \
+      KOKKOS_CUSPARSE_SAFE_CALL(                                               \
+          cusparseSetStream(cuspHandle, space.cuda_stream()));                 \
+      spgemm_numeric_cusparse(space, handle->get_spgemm_handle(), m, n, k,     \
+                              row_mapA, entriesA, valuesA, row_mapB, entriesB, \
+                              valuesB, row_mapC, entriesC, valuesC);           \
+      KOKKOS_CUSPARSE_SAFE_CALL(cusparseSetStream(cuspHandle, NULL));          \
       Kokkos::Profiling::popRegion();                                          \
     }                                                                          \
   };
@@ -343,19 +346,19 @@ ROCSPARSE_XCSRGEMM_NUMERIC_SPEC(rocsparse_float_complex, c)
 ROCSPARSE_XCSRGEMM_NUMERIC_SPEC(rocsparse_double_complex, z)
 
 template <
-    typename KernelHandle, typename ain_row_index_view_type,
+    typename ExecSpace, typename KernelHandle, typename ain_row_index_view_type,
     typename ain_nonzero_index_view_type, typename ain_nonzero_value_view_type,
     typename bin_row_index_view_type, typename bin_nonzero_index_view_type,
     typename bin_nonzero_value_view_type, typename cin_row_index_view_type,
     typename cin_nonzero_index_view_type, typename cin_nonzero_value_view_type>
 void spgemm_numeric_rocsparse(
-    KernelHandle *handle, typename KernelHandle::nnz_lno_t m,
-    typename KernelHandle::nnz_lno_t n, typename KernelHandle::nnz_lno_t k,
-    ain_row_index_view_type rowptrA, ain_nonzero_index_view_type colidxA,
-    ain_nonzero_value_view_type valuesA, bin_row_index_view_type rowptrB,
-    bin_nonzero_index_view_type colidxB, bin_nonzero_value_view_type valuesB,
-    cin_row_index_view_type rowptrC, cin_nonzero_index_view_type colidxC,
-    cin_nonzero_value_view_type valuesC) {
+    const ExecSpace &exec, KernelHandle *handle,
+    typename KernelHandle::nnz_lno_t m, typename KernelHandle::nnz_lno_t n,
+    typename KernelHandle::nnz_lno_t k, ain_row_index_view_type rowptrA,
+    ain_nonzero_index_view_type colidxA, ain_nonzero_value_view_type valuesA,
+    bin_row_index_view_type rowptrB, bin_nonzero_index_view_type colidxB,
+    bin_nonzero_value_view_type valuesB, cin_row_index_view_type rowptrC,
+    cin_nonzero_index_view_type colidxC, cin_nonzero_value_view_type valuesC) {
   using scalar_type = typename KernelHandle::nnz_scalar_t;
   using rocsparse_scalar_type =
       typename kokkos_to_rocsparse_type<scalar_type>::type;
@@ -371,6 +374,8 @@ void spgemm_numeric_rocsparse(
   auto nnz_B = colidxB.extent(0);
   auto nnz_C = colidxC.extent(0);
 
+  KOKKOS_ROCSPARSE_SAFE_CALL_IMPL(
+      rocsparse_set_stream(h->rocsparseHandle, exec.hip_stream()));
   KOKKOS_ROCSPARSE_SAFE_CALL_IMPL(
       rocsparse_get_pointer_mode(h->rocsparseHandle, &oldPtrMode));
   KOKKOS_ROCSPARSE_SAFE_CALL_IMPL(rocsparse_set_pointer_mode(
@@ -396,9 +401,11 @@ void spgemm_numeric_rocsparse(
       nullptr, nullptr, nullptr, h->descr_C, nnz_C,
       reinterpret_cast<rocsparse_scalar_type *>(valuesC.data()), rowptrC.data(),
       colidxC.data(), h->info_C, h->buffer));
-  // Restore old pointer mode
+  // Restore old pointer mode and the default stream
   KOKKOS_ROCSPARSE_SAFE_CALL_IMPL(
       rocsparse_set_pointer_mode(h->rocsparseHandle, oldPtrMode));
+  KOKKOS_ROCSPARSE_SAFE_CALL_IMPL(
+      rocsparse_set_stream(h->rocsparseHandle, NULL));
   handle->set_call_numeric();
 }
 
@@ -455,22 +462,22 @@ void spgemm_numeric_rocsparse(
         Kokkos::View<SCALAR *, default_layout,                                 \
                      Kokkos::Device<Kokkos::HIP, Kokkos::HIPSpace>,            \
                      Kokkos::MemoryTraits<Kokkos::Unmanaged>>;                 \
-    static void spgemm_numeric(KernelHandle *handle,                           \
-                               typename KernelHandle::nnz_lno_t m,             \
-                               typename KernelHandle::nnz_lno_t n,             \
-                               typename KernelHandle::nnz_lno_t k,             \
-                               c_int_view_t row_mapA, c_int_view_t entriesA,   \
-                               c_scalar_view_t valuesA, bool,                  \
-                               c_int_view_t row_mapB, c_int_view_t entriesB,   \
-                               c_scalar_view_t valuesB, bool,                  \
-                               c_int_view_t row_mapC, int_view_t entriesC,     \
-                               scalar_view_t valuesC) {                        \
+    static void spgemm_numeric(                                                \
+        const Kokkos::HIP &space, KernelHandle *handle,                        \
+        typename KernelHandle::nnz_lno_t m,                                    \
+        typename KernelHandle::nnz_lno_t n,                                    \
+        typename KernelHandle::nnz_lno_t k, c_int_view_t row_mapA,             \
+        c_int_view_t entriesA, c_scalar_view_t valuesA, bool,                  \
+        c_int_view_t row_mapB, c_int_view_t entriesB,                          \
+        c_scalar_view_t valuesB, bool, c_int_view_t row_mapC,                  \
+        int_view_t entriesC, scalar_view_t valuesC) {                          \
       std::string label = "KokkosSparse::spgemm_numeric[TPL_ROCSPARSE," +      \
                           Kokkos::ArithTraits<SCALAR>::name() + "]";           \
       Kokkos::Profiling::pushRegion(label);                                    \
-      spgemm_numeric_rocsparse(handle->get_spgemm_handle(), m, n, k, row_mapA, \
-                               entriesA, valuesA, row_mapB, entriesB, valuesB, \
-                               row_mapC, entriesC, valuesC);                   \
+      spgemm_numeric_rocsparse(space, handle->get_spgemm_handle(), m, n, k,    \
+                               row_mapA, entriesA, valuesA, row_mapB,          \
+                               entriesB, valuesB, row_mapC, entriesC,          \
+                               valuesC);                                       \
       Kokkos::Profiling::popRegion();                                          \
     }                                                                          \
   };
@@ -488,20 +495,19 @@ SPGEMM_NUMERIC_DECL_ROCSPARSE(Kokkos::complex<double>, false)
 
 #ifdef KOKKOSKERNELS_ENABLE_TPL_MKL
 template <
-    typename KernelHandle, typename ain_row_index_view_type,
+    typename ExecSpace, typename KernelHandle, typename ain_row_index_view_type,
     typename ain_nonzero_index_view_type, typename ain_nonzero_value_view_type,
     typename bin_row_index_view_type, typename bin_nonzero_index_view_type,
     typename bin_nonzero_value_view_type, typename cin_row_index_view_type,
     typename cin_nonzero_index_view_type, typename cin_nonzero_value_view_type>
 void spgemm_numeric_mkl(
-    KernelHandle *handle, typename KernelHandle::nnz_lno_t m,
-    typename KernelHandle::nnz_lno_t n, typename KernelHandle::nnz_lno_t k,
-    ain_row_index_view_type rowptrA, ain_nonzero_index_view_type colidxA,
-    ain_nonzero_value_view_type valuesA, bin_row_index_view_type rowptrB,
-    bin_nonzero_index_view_type colidxB, bin_nonzero_value_view_type valuesB,
-    cin_row_index_view_type rowptrC, cin_nonzero_index_view_type colidxC,
-    cin_nonzero_value_view_type valuesC) {
-  using ExecSpace   = typename KernelHandle::HandleExecSpace;
+    const ExecSpace &exec, KernelHandle *handle,
+    typename KernelHandle::nnz_lno_t m, typename KernelHandle::nnz_lno_t n,
+    typename KernelHandle::nnz_lno_t k, ain_row_index_view_type rowptrA,
+    ain_nonzero_index_view_type colidxA, ain_nonzero_value_view_type valuesA,
+    bin_row_index_view_type rowptrB, bin_nonzero_index_view_type colidxB,
+    bin_nonzero_value_view_type valuesB, cin_row_index_view_type rowptrC,
+    cin_nonzero_index_view_type colidxC, cin_nonzero_value_view_type valuesC) {
   using index_type  = typename KernelHandle::nnz_lno_t;
   using size_type   = typename KernelHandle::size_type;
   using scalar_type = typename KernelHandle::nnz_scalar_t;
@@ -544,8 +550,8 @@ void spgemm_numeric_mkl(
   Kokkos::View<scalar_type *, Kokkos::HostSpace,
                Kokkos::MemoryTraits<Kokkos::Unmanaged>>
       valuesRawView(valuesRaw, c_nnz);
-  Kokkos::deep_copy(ExecSpace(), colidxC, colidxRawView);
-  Kokkos::deep_copy(ExecSpace(), valuesC, valuesRawView);
+  Kokkos::deep_copy(exec, colidxC, colidxRawView);
+  Kokkos::deep_copy(exec, valuesC, valuesRawView);
   handle->set_call_numeric();
   handle->set_computed_entries();
 }
@@ -601,22 +607,21 @@ void spgemm_numeric_mkl(
         Kokkos::View<SCALAR *, default_layout,                                 \
                      Kokkos::Device<EXEC, Kokkos::HostSpace>,                  \
                      Kokkos::MemoryTraits<Kokkos::Unmanaged>>;                 \
-    static void spgemm_numeric(KernelHandle *handle,                           \
-                               typename KernelHandle::nnz_lno_t m,             \
-                               typename KernelHandle::nnz_lno_t n,             \
-                               typename KernelHandle::nnz_lno_t k,             \
-                               c_int_view_t row_mapA, c_int_view_t entriesA,   \
-                               c_scalar_view_t valuesA, bool,                  \
-                               c_int_view_t row_mapB, c_int_view_t entriesB,   \
-                               c_scalar_view_t valuesB, bool,                  \
-                               c_int_view_t row_mapC, int_view_t entriesC,     \
-                               scalar_view_t valuesC) {                        \
+    static void spgemm_numeric(                                                \
+        const EXEC &space, KernelHandle *handle,                               \
+        typename KernelHandle::nnz_lno_t m,                                    \
+        typename KernelHandle::nnz_lno_t n,                                    \
+        typename KernelHandle::nnz_lno_t k, c_int_view_t row_mapA,             \
+        c_int_view_t entriesA, c_scalar_view_t valuesA, bool,                  \
+        c_int_view_t row_mapB, c_int_view_t entriesB,                          \
+        c_scalar_view_t valuesB, bool, c_int_view_t row_mapC,                  \
+        int_view_t entriesC, scalar_view_t valuesC) {                          \
       std::string label = "KokkosSparse::spgemm_numeric[TPL_MKL," +            \
                           Kokkos::ArithTraits<SCALAR>::name() + "]";           \
       Kokkos::Profiling::pushRegion(label);                                    \
-      spgemm_numeric_mkl(handle->get_spgemm_handle(), m, n, k, row_mapA,       \
-                         entriesA, valuesA, row_mapB, entriesB, valuesB,       \
-                         row_mapC, entriesC, valuesC);                         \
+      spgemm_numeric_mkl(space, handle->get_spgemm_handle(), m, n, k,          \
+                         row_mapA, entriesA, valuesA, row_mapB, entriesB,      \
+                         valuesB, row_mapC, entriesC, valuesC);                \
       Kokkos::Profiling::popRegion();                                          \
     }                                                                          \
   };
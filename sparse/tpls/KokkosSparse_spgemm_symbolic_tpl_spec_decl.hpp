@@ -48,9 +48,11 @@ namespace Impl {
 // 11.4+ supports generic API with reuse (full symbolic/numeric separation)
 // However, its "symbolic" (cusparseSpGEMMreuse_nnz) does not populate C's
 // rowptrs.
-template <typename KernelHandle, typename lno_t, typename ConstRowMapType,
-          typename ConstEntriesType, typename RowMapType>
-void spgemm_symbolic_cusparse(KernelHandle *handle, lno_t m, lno_t n, lno_t k,
+template <typename ExecSpace, typename KernelHandle, typename lno_t,
+          typename ConstRowMapType, typename ConstEntriesType,
+          typename RowMapType>
+void spgemm_symbolic_cusparse(const ExecSpace &exec, KernelHandle *handle,
+                              lno_t m, lno_t n, lno_t k,
                               const ConstRowMapType &row_mapA,
                               const ConstEntriesType &entriesA,
                               const ConstRowMapType &row_mapB,
@@ -162,8 +164,7 @@ void spgemm_symbolic_cusparse(KernelHandle *handle, lno_t m, lno_t n, lno_t k,
         h->alg, h->spgemmDescr, &h->bufferSize5, h->buffer5));
     if (!handle->get_c_nnz()) {
       // cuSPARSE does not populate C rowptrs if C has no entries
-      Kokkos::deep_copy(typename KernelHandle::HandleExecSpace(), row_mapC,
-                        Offset(0));
+      Kokkos::deep_copy(exec, row_mapC, Offset(0));
     }
     KOKKOS_IMPL_CUDA_SAFE_CALL(cudaFree(dummyValues));
     KOKKOS_IMPL_CUDA_SAFE_CALL(cudaFree(dummyEntries));
@@ -173,9 +174,11 @@ void spgemm_symbolic_cusparse(KernelHandle *handle, lno_t m, lno_t n, lno_t k,
 
 #elif (CUDA_VERSION >= 11000)
 // 11.0-11.3 supports only the generic API, but not reuse.
-template <typename KernelHandle, typename lno_t, typename ConstRowMapType,
-          typename ConstEntriesType, typename RowMapType>
-void spgemm_symbolic_cusparse(KernelHandle *handle, lno_t m, lno_t n, lno_t k,
+template <typename ExecSpace, typename KernelHandle, typename lno_t,
+          typename ConstRowMapType, typename ConstEntriesType,
+          typename RowMapType>
+void spgemm_symbolic_cusparse(const ExecSpace &exec, KernelHandle *handle,
+                              lno_t m, lno_t n, lno_t k,
                               const ConstRowMapType &row_mapA,
                               const ConstEntriesType &entriesA,
                               const ConstRowMapType &row_mapB,
@@ -297,9 +300,11 @@ void spgemm_symbolic_cusparse(KernelHandle *handle, lno_t m, lno_t n, lno_t k,
 #else
 // 10.x supports the pre-generic interface (cusparseXcsrgemmNnz). It always
 // populates C rowptrs.
-template <typename KernelHandle, typename lno_t, typename ConstRowMapType,
-          typename ConstEntriesType, typename RowMapType>
-void spgemm_symbolic_cusparse(KernelHandle *handle, lno_t m, lno_t n, lno_t k,
+template <typename ExecSpace, typename KernelHandle, typename lno_t,
+          typename ConstRowMapType, typename ConstEntriesType,
+          typename RowMapType>
+void spgemm_symbolic_cusparse(const ExecSpace &exec, KernelHandle *handle,
+                              lno_t m, lno_t n, lno_t k,
                               const ConstRowMapType &row_mapA,
                               const ConstEntriesType &entriesA,
                               const ConstRowMapType &row_mapB,
@@ -321,8 +326,7 @@ void spgemm_symbolic_cusparse(KernelHandle *handle, lno_t m, lno_t n, lno_t k,
   // zeros
   if (m == 0 || n == 0 || k == 0 || entriesA.extent(0) == size_type(0) ||
       entriesB.extent(0) == size_type(0)) {
-    Kokkos::deep_copy(typename KernelHandle::HandleExecSpace(), row_mapC,
-                      size_type(0));
+    Kokkos::deep_copy(exec, row_mapC, size_type(0));
     nnzC = 0;
   } else {
     KOKKOS_CUSPARSE_SAFE_CALL(cusparseXcsrgemmNnz(
@@ -379,20 +383,25 @@ void spgemm_symbolic_cusparse(KernelHandle *handle, lno_t m, lno_t n, lno_t k,
     using int_view_t = Kokkos::View<int *, default_layout,                     \
                                     Kokkos::Device<Kokkos::Cuda, MEMSPACE>,    \
                                     Kokkos::MemoryTraits<Kokkos::Unmanaged>>;  \
-    static void spgemm_symbolic(KernelHandle *handle,                          \
-                                typename KernelHandle::nnz_lno_t m,            \
-                                typename KernelHandle::nnz_lno_t n,            \
-                                typename KernelHandle::nnz_lno_t k,            \
-                                c_int_view_t row_mapA, c_int_view_t entriesA,  \
-                                bool, c_int_view_t row_mapB,                   \
-                                c_int_view_t entriesB, bool,                   \
-                                int_view_t row_mapC, bool computeRowptrs) {    \
+    static void spgemm_symbolic(                                               \
+        const Kokkos::Cuda &space, KernelHandle *handle,                       \
+        typename KernelHandle::nnz_lno_t m,                                    \
+        typename KernelHandle::nnz_lno_t n,                                    \
+        typename KernelHandle::nnz_lno_t k, c_int_view_t row_mapA,             \
+        c_int_view_t entriesA, bool, c_int_view_t row_mapB,                    \
+        c_int_view_t entriesB, bool, int_view_t row_mapC,                      \
+        bool computeRowptrs) {                                                 \
       std::string label = "KokkosSparse::spgemm[TPL_CUSPARSE," +               \
                           Kokkos::ArithTraits<SCALAR>::name() + "]";           \
       Kokkos::Profiling::pushRegion(label);                                    \
-      spgemm_symbolic_cusparse(handle->get_spgemm_handle(), m, n, k, row_mapA, \
-                               entriesA, row_mapB, entriesB, row_mapC,         \
-                               computeRowptrs);                                \
+      auto &cuspHandle =                                                       \
+          KokkosKernels::Impl::CusparseSingleton::singleton().cusparseHandle;  \
+      KOKKOS_CUSPARSE_SAFE_CALL(                                               \
+          cusparseSetStream(cuspHandle, space.cuda_stream()));                 \
+      spgemm_symbolic_cusparse(space, handle->get_spgemm_handle(), m, n, k,    \
+                               row_mapA, entriesA, row_mapB, entriesB,         \
+                               row_mapC, computeRowptrs);                      \
+      KOKKOS_CUSPARSE_SAFE_CALL(cusparseSetStream(cuspHandle, NULL));          \
       Kokkos::Profiling::popRegion();                                          \
     }                                                                          \
   };
@@ -442,11 +451,12 @@ ROCSPARSE_XCSRGEMM_BUFFER_SIZE_SPEC(rocsparse_float_complex, c)
 ROCSPARSE_XCSRGEMM_BUFFER_SIZE_SPEC(rocsparse_double_complex, z)
 
 template <
-    typename KernelHandle, typename ain_row_index_view_type,
+    typename ExecSpace, typename KernelHandle, typename ain_row_index_view_type,
     typename ain_nonzero_index_view_type, typename bin_row_index_view_type,
     typename bin_nonzero_index_view_type, typename cin_row_index_view_type>
 void spgemm_symbolic_rocsparse(
-    KernelHandle *handle, typename KernelHandle::nnz_lno_t m,
+    const ExecSpace &exec, KernelHandle *handle,
+    typename KernelHandle::nnz_lno_t m,
     typename KernelHandle::nnz_lno_t n, typename KernelHandle::nnz_lno_t k,
     ain_row_index_view_type rowptrA, ain_nonzero_index_view_type colidxA,
     bin_row_index_view_type rowptrB, bin_nonzero_index_view_type colidxB,
@@ -473,6 +483,8 @@ void spgemm_symbolic_rocsparse(
   const auto beta  = Kokkos::ArithTraits<scalar_type>::zero();
   rocsparse_pointer_mode oldPtrMode;
 
+  KOKKOS_ROCSPARSE_SAFE_CALL_IMPL(
+      rocsparse_set_stream(h->rocsparseHandle, exec.hip_stream()));
   KOKKOS_ROCSPARSE_SAFE_CALL_IMPL(
       rocsparse_get_pointer_mode(h->rocsparseHandle, &oldPtrMode));
   KOKKOS_ROCSPARSE_SAFE_CALL_IMPL(rocsparse_set_pointer_mode(
@@ -497,11 +509,15 @@ void spgemm_symbolic_rocsparse(
   // If C has zero rows, its rowptrs are not populated
   if (m == 0) {
     KOKKOS_IMPL_HIP_SAFE_CALL(
-        hipMemset(rowptrC.data(), 0, rowptrC.extent(0) * sizeof(index_type)));
+        hipMemsetAsync(rowptrC.data(), 0,
+                       rowptrC.extent(0) * sizeof(index_type),
+                       exec.hip_stream()));
   }
-  // Restore previous pointer mode
+  // Restore previous pointer mode and the default stream
   KOKKOS_ROCSPARSE_SAFE_CALL_IMPL(
       rocsparse_set_pointer_mode(h->rocsparseHandle, oldPtrMode));
+  KOKKOS_ROCSPARSE_SAFE_CALL_IMPL(
+      rocsparse_set_stream(h->rocsparseHandle, NULL));
 
   handle->set_c_nnz(nnz_C);
   handle->set_call_symbolic();
@@ -541,18 +557,17 @@ void spgemm_symbolic_rocsparse(
         Kokkos::View<int *, default_layout,                                   \
                      Kokkos::Device<Kokkos::HIP, Kokkos::HIPSpace>,           \
                      Kokkos::MemoryTraits<Kokkos::Unmanaged>>;                \
-    static void spgemm_symbolic(KernelHandle *handle,                         \
-                                typename KernelHandle::nnz_lno_t m,           \
-                                typename KernelHandle::nnz_lno_t n,           \
-                                typename KernelHandle::nnz_lno_t k,           \
-                                c_int_view_t row_mapA, c_int_view_t entriesA, \
-                                bool, c_int_view_t row_mapB,                  \
-                                c_int_view_t entriesB, bool,                  \
-                                int_view_t row_mapC, bool) {                  \
+    static void spgemm_symbolic(                                              \
+        const Kokkos::HIP &space, KernelHandle *handle,                       \
+        typename KernelHandle::nnz_lno_t m,                                   \
+        typename KernelHandle::nnz_lno_t n,                                   \
+        typename KernelHandle::nnz_lno_t k, c_int_view_t row_mapA,            \
+        c_int_view_t entriesA, bool, c_int_view_t row_mapB,                   \
+        c_int_view_t entriesB, bool, int_view_t row_mapC, bool) {             \
       std::string label = "KokkosSparse::spgemm[TPL_ROCSPARSE," +             \
                           Kokkos::ArithTraits<SCALAR>::name() + "]";          \
       Kokkos::Profiling::pushRegion(label);                                   \
-      spgemm_symbolic_rocsparse(handle->get_spgemm_handle(), m, n, k,         \
+      spgemm_symbolic_rocsparse(space, handle->get_spgemm_handle(), m, n, k,  \
                                 row_mapA, entriesA, row_mapB, entriesB,       \
                                 row_mapC);                                    \
       Kokkos::Profiling::popRegion();                                         \
@@ -572,23 +587,23 @@ SPGEMM_SYMBOLIC_DECL_ROCSPARSE(Kokkos::complex<double>, true)
 
 #ifdef KOKKOSKERNELS_ENABLE_TPL_MKL
 template <
-    typename KernelHandle, typename ain_row_index_view_type,
+    typename ExecSpace, typename KernelHandle, typename ain_row_index_view_type,
     typename ain_nonzero_index_view_type, typename bin_row_index_view_type,
     typename bin_nonzero_index_view_type, typename cin_row_index_view_type>
 void spgemm_symbolic_mkl(
-    KernelHandle *handle, typename KernelHandle::nnz_lno_t m,
+    const ExecSpace &exec, KernelHandle *handle,
+    typename KernelHandle::nnz_lno_t m,
     typename KernelHandle::nnz_lno_t n, typename KernelHandle::nnz_lno_t k,
     ain_row_index_view_type rowptrA, ain_nonzero_index_view_type colidxA,
     bin_row_index_view_type rowptrB, bin_nonzero_index_view_type colidxB,
     cin_row_index_view_type rowptrC) {
-  using ExecSpace   = typename KernelHandle::HandleExecSpace;
   using index_type  = typename KernelHandle::nnz_lno_t;
   using size_type   = typename KernelHandle::size_type;
   using scalar_type = typename KernelHandle::nnz_scalar_t;
   using MKLMatrix   = MKLSparseMatrix<scalar_type>;
   if (m == 0 || n == 0 || k == 0 || colidxA.extent(0) == size_type(0) ||
       colidxB.extent(0) == size_type(0)) {
-    Kokkos::deep_copy(ExecSpace(), rowptrC, size_type(0));
+    Kokkos::deep_copy(exec, rowptrC, size_type(0));
     handle->set_call_symbolic();
     handle->set_computed_rowptrs();
     handle->set_c_nnz(0);
@@ -616,7 +631,8 @@ void spgemm_symbolic_mkl(
   Kokkos::View<index_type *, Kokkos::HostSpace,
                Kokkos::MemoryTraits<Kokkos::Unmanaged>>
       rowptrRawView(rowptrRaw, nrows + 1);
-  Kokkos::deep_copy(ExecSpace(), rowptrC, rowptrRawView);
+  Kokkos::deep_copy(exec, rowptrC, rowptrRawView);
+  exec.fence();
   handle->create_mkl_spgemm_handle(C);
   handle->set_call_symbolic();
   handle->set_computed_rowptrs();
@@ -655,19 +671,18 @@ void spgemm_symbolic_mkl(
     using int_view_t = Kokkos::View<MKL_INT *, default_layout,                 \
                                     Kokkos::Device<EXEC, Kokkos::HostSpace>,   \
                                     Kokkos::MemoryTraits<Kokkos::Unmanaged>>;  \
-    static void spgemm_symbolic(KernelHandle *handle,                          \
-                                typename KernelHandle::nnz_lno_t m,            \
-                                typename KernelHandle::nnz_lno_t n,            \
-                                typename KernelHandle::nnz_lno_t k,            \
-                                c_int_view_t row_mapA, c_int_view_t entriesA,  \
-                                bool, c_int_view_t row_mapB,                   \
-                                c_int_view_t entriesB, bool,                   \
-                                int_view_t row_mapC, bool) {                   \
+    static void spgemm_symbolic(                                               \
+        const EXEC &space, KernelHandle *handle,                               \
+        typename KernelHandle::nnz_lno_t m,                                    \
+        typename KernelHandle::nnz_lno_t n,                                    \
+        typename KernelHandle::nnz_lno_t k, c_int_view_t row_mapA,             \
+        c_int_view_t entriesA, bool, c_int_view_t row_mapB,                    \
+        c_int_view_t entriesB, bool, int_view_t row_mapC, bool) {              \
       std::string label = "KokkosSparse::spgemm_symbolic[TPL_MKL," +           \
                           Kokkos::ArithTraits<SCALAR>::name() + "]";           \
       Kokkos::Profiling::pushRegion(label);                                    \
-      spgemm_symbolic_mkl(handle->get_spgemm_handle(), m, n, k, row_mapA,      \
-                          entriesA, row_mapB, entriesB, row_mapC);             \
+      spgemm_symbolic_mkl(space, handle->get_spgemm_handle(), m, n, k,         \
+                          row_mapA, entriesA, row_mapB, entriesB, row_mapC);   \
       Kokkos::Profiling::popRegion();                                          \
     }                                                                          \
   };
@@ -368,11 +368,10 @@ void spmv_bsr_cusparse(const Kokkos::Cuda& exec, Handle* handle,
   using entry_type  = typename AMatrix::non_const_ordinal_type;
   using value_type  = typename AMatrix::non_const_value_type;
 
-  /* initialize cusparse library */
+  /* cuSPARSE handle bound to the stream of exec */
   cusparseHandle_t cusparseHandle =
-      KokkosKernels::Impl::CusparseSingleton::singleton().cusparseHandle;
-  /* Set cuSPARSE to use the given stream until this function exits */
-  KokkosSparse::Impl::TemporarySetCusparseStream tscs(cusparseHandle, exec);
+      KokkosKernels::Impl::CusparseSingleton::stream_handle(
+          exec.cuda_stream());
 
   /* Set the operation mode */
   cusparseOperation_t myCusparseOperation;
@@ -483,11 +482,10 @@ void spmv_mv_bsr_cusparse(const Kokkos::Cuda& exec, Handle* handle,
   using entry_type  = typename AMatrix::non_const_ordinal_type;
   using value_type  = typename AMatrix::non_const_value_type;
 
-  /* initialize cusparse library */
+  /* cuSPARSE handle bound to the stream of exec */
   cusparseHandle_t cusparseHandle =
-      KokkosKernels::Impl::CusparseSingleton::singleton().cusparseHandle;
-  /* Set cuSPARSE to use the given stream until this function exits */
-  KokkosSparse::Impl::TemporarySetCusparseStream tscs(cusparseHandle, exec);
+      KokkosKernels::Impl::CusparseSingleton::stream_handle(
+          exec.cuda_stream());
 
   /* Set the operation mode */
   cusparseOperation_t myCusparseOperation;
@@ -832,10 +830,10 @@ void spmv_bsr_rocsparse(const Kokkos::HIP& exec, Handle* handle,
                                 Kokkos::LayoutStride>,
                 "A entries must be contiguous");
 
+  /* rocSPARSE handle bound to the stream of exec */
   rocsparse_handle rocsparseHandle =
-      KokkosKernels::Impl::RocsparseSingleton::singleton().rocsparseHandle;
-  // resets handle stream to NULL when out of scope
-  KokkosSparse::Impl::TemporarySetRocsparseStream tsrs(rocsparseHandle, exec);
+      KokkosKernels::Impl::RocsparseSingleton::stream_handle(
+          exec.hip_stream());
 
   // set the mode
   rocsparse_operation trans;
@@ -117,11 +117,10 @@ void spmv_mv_cusparse(const Kokkos::Cuda &exec, Handle *handle,
   using x_value_type = typename XVector::non_const_value_type;
   using y_value_type = typename YVector::non_const_value_type;
 
-  /* initialize cusparse library */
+  /* cuSPARSE handle bound to the stream of exec */
   cusparseHandle_t cusparseHandle =
-      KokkosKernels::Impl::CusparseSingleton::singleton().cusparseHandle;
-  /* Set cuSPARSE to use the given stream until this function exits */
-  TemporarySetCusparseStream tscs(cusparseHandle, exec);
+      KokkosKernels::Impl::CusparseSingleton::stream_handle(
+          exec.cuda_stream());
 
   /* Check that cusparse can handle the types of the input Kokkos::CrsMatrix */
   const cusparseIndexType_t myCusparseOffsetType =
@@ -37,11 +37,10 @@ void spmv_cusparse(const Kokkos::Cuda& exec, Handle* handle, const char mode[],
   using offset_type = typename AMatrix::non_const_size_type;
   using value_type  = typename AMatrix::non_const_value_type;
 
-  /* initialize cusparse library */
+  /* cuSPARSE handle bound to the stream of exec */
   cusparseHandle_t cusparseHandle =
-      KokkosKernels::Impl::CusparseSingleton::singleton().cusparseHandle;
-  /* Set cuSPARSE to use the given stream until this function exits */
-  TemporarySetCusparseStream tscs(cusparseHandle, exec);
+      KokkosKernels::Impl::CusparseSingleton::stream_handle(
+          exec.cuda_stream());
 
   /* Set the operation mode */
   cusparseOperation_t myCusparseOperation;
@@ -385,11 +384,10 @@ void spmv_rocsparse(const Kokkos::HIP& exec, Handle* handle, const char mode[],
   using entry_type  = typename AMatrix::non_const_ordinal_type;
   using value_type  = typename AMatrix::non_const_value_type;
 
-  /* initialize rocsparse library */
+  /* rocSPARSE handle bound to the stream of exec */
   rocsparse_handle rocsparseHandle =
-      KokkosKernels::Impl::RocsparseSingleton::singleton().rocsparseHandle;
-  /* Set rocsparse to use the given stream until this function exits */
-  TemporarySetRocsparseStream tsrs(rocsparseHandle, exec);
+      KokkosKernels::Impl::RocsparseSingleton::stream_handle(
+          exec.hip_stream());
 
   /* Set the operation mode */
   rocsparse_operation myRocsparseOperation = mode_kk_to_rocsparse(mode);
@@ -18,6 +18,7 @@
 
 #include "Test_Sparse_coo2crs.hpp"
 #include "Test_Sparse_crs2coo.hpp"
+#include "Test_Sparse_spmv_coo.hpp"
 #include "Test_Sparse_Controls.hpp"
 #include "Test_Sparse_CrsMatrix.hpp"
 #include "Test_Sparse_mdf.hpp"
@@ -29,18 +30,45 @@
 #include "Test_Sparse_spadd.hpp"
 #include "Test_Sparse_spgemm_jacobi.hpp"
 #include "Test_Sparse_spgemm.hpp"
+#include "Test_Sparse_spgemm_rap.hpp"
+#include "Test_Sparse_spgemm_masked.hpp"
+#include "Test_Sparse_semiring.hpp"
+#include "Test_Sparse_PatternMatrix.hpp"
+#include "Test_Sparse_sddmm.hpp"
+#include "Test_Sparse_spgemm_chunked.hpp"
 #include "Test_Sparse_SortCrs.hpp"
+#include "Test_Sparse_PermuteCrs.hpp"
 #include "Test_Sparse_spiluk.hpp"
 #include "Test_Sparse_spmv.hpp"
+#include "Test_Sparse_spmv_ccs.hpp"
+#include "Test_Sparse_spmv_ensemble.hpp"
+#include "Test_Sparse_spmv_sell.hpp"
+#include "Test_Sparse_spmv_delta.hpp"
+#include "Test_Sparse_spmv_stencil.hpp"
+#include "Test_Sparse_spmv_vbr.hpp"
+#include "Test_Sparse_spmv_dot.hpp"
+#include "Test_Sparse_spmv_symmetric.hpp"
+#include "Test_Sparse_spmv_partitioned.hpp"
+#include "Test_Sparse_spmv_team.hpp"
+#include "Test_Sparse_matrix_powers.hpp"
+#include "Test_Sparse_kron.hpp"
+#include "Test_Sparse_rsvd.hpp"
+#include "Test_Sparse_lobpcg.hpp"
 #include "Test_Sparse_sptrsv.hpp"
+#include "Test_Sparse_supernodal_cholesky.hpp"
 #include "Test_Sparse_trsv.hpp"
 #include "Test_Sparse_par_ilut.hpp"
 #include "Test_Sparse_gmres.hpp"
+#include "Test_Sparse_cg.hpp"
+#include "Test_Sparse_bicgstab.hpp"
 #include "Test_Sparse_Transpose.hpp"
 #include "Test_Sparse_TestUtils_RandCsMat.hpp"
 #include "Test_Sparse_ccs2crs.hpp"
 #include "Test_Sparse_crs2ccs.hpp"
 #include "Test_Sparse_removeCrsMatrixZeros.hpp"
+#include "Test_Sparse_IOUtils.hpp"
+#include "Test_Sparse_MatrixGenerators.hpp"
+#include "Test_Sparse_StreamingCrsBuilder.hpp"
 #include "Test_Sparse_extractCrsDiagonalBlocks.hpp"
 
 // TPL specific tests, these require
@@ -19,6 +19,7 @@
 #include <Kokkos_Core.hpp>
 #include <stdexcept>
 #include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_getDiagCopy.hpp"
 #include "Kokkos_ArithTraits.hpp"
 
 // #ifndef kokkos_complex_double
@@ -217,11 +218,66 @@ void testCrsMatrixHostMirror() {
   EXPECT_EQ(zeroHost.graph.row_map.extent(0), 0);
 }
 
+// Check the diagonal offsets cached by CrsMatrix::diagOffsets, including rows
+// without a diagonal entry, and getDiagCopy with them.
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void testCrsMatrixDiagOffsets() {
+  using crs_matrix =
+      KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  const int nrows = 5;
+  const int nnz   = 9;
+  // Rows 0 (empty), 1 and 3 have no diagonal entry
+  std::vector<lno_t> rowmap  = {0, 0, 2, 5, 6, 9};
+  std::vector<lno_t> entries = {3, 4, 0, 1, 2, 2, 0, 3, 4};
+  std::vector<scalar_t> values;
+  for (int i = 0; i < nnz; i++) values.push_back(scalar_t(i + 1));
+  crs_matrix A("A", nrows, nrows, nnz, values.data(), rowmap.data(),
+               entries.data());
+
+  const size_t INV = KokkosSparse::OrdinalTraits<size_t>::invalid();
+
+  const std::vector<size_t> expected = {INV, INV, 2, INV, 2};
+
+  auto offsets = A.diagOffsets();
+  auto offsets_h =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), offsets);
+  for (int i = 0; i < nrows; i++) EXPECT_EQ(offsets_h(i), expected[i]);
+
+  // Later calls, also from copies, reuse the cached offsets
+  EXPECT_EQ(A.diagOffsets().data(), offsets.data());
+  crs_matrix B = A;
+  EXPECT_EQ(B.diagOffsets().data(), offsets.data());
+
+  Kokkos::View<scalar_t*, device> D("D", nrows);
+  KokkosSparse::getDiagCopy(D, A);
+  auto D_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), D);
+  const scalar_t zero = Kokkos::ArithTraits<scalar_t>::zero();
+  EXPECT_EQ(D_h(0), zero);
+  EXPECT_EQ(D_h(1), zero);
+  EXPECT_EQ(D_h(2), values[4]);
+  EXPECT_EQ(D_h(3), zero);
+  EXPECT_EQ(D_h(4), values[8]);
+
+  // Replacing the graph or clearing the cache recomputes the offsets
+  crs_matrix C("C", nrows, nrows, nnz, values.data(), rowmap.data(),
+               entries.data());
+  B.graph = C.graph;
+  EXPECT_NE(B.diagOffsets().data(), offsets.data());
+  A.clearDiagOffsets();
+  auto recomputed = A.diagOffsets();
+  EXPECT_NE(recomputed.data(), offsets.data());
+  auto recomputed_h =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), recomputed);
+  for (int i = 0; i < nrows; i++) EXPECT_EQ(recomputed_h(i), expected[i]);
+}
+
 #define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)                    \
   TEST_F(TestCategory,                                                                 \
          sparse##_##crsmatrix##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) {          \
     testCrsMatrix<SCALAR, ORDINAL, OFFSET, DEVICE>();                                  \
     testCrsMatrixRawConstructor<SCALAR, ORDINAL, OFFSET, DEVICE>();                    \
+    testCrsMatrixDiagOffsets<SCALAR, ORDINAL, OFFSET, DEVICE>();                       \
   }                                                                                    \
   TEST_F(                                                                              \
       TestCategory,                                                                    \
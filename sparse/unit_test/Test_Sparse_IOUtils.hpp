@@ -0,0 +1,267 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file Test_Sparse_IOUtils.hpp
+/// \brief Tests for the parallel MatrixMarket reader, the binary sidecar and
+/// the memory-mapped CRS format in KokkosSparse_IOUtils.hpp
+
+#ifndef TEST_SPARSE_IOUTILS_HPP
+#define TEST_SPARSE_IOUTILS_HPP
+
+#include <Kokkos_Core.hpp>
+#include <KokkosSparse_CrsMatrix.hpp>
+#include <KokkosSparse_BsrMatrix.hpp>
+#include <KokkosSparse_IOUtils.hpp>
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <set>
+#include <string>
+
+namespace TestIOUtils {
+
+// Random numRows x numCols matrix with sorted rows of distinct columns
+template <typename crsMat_t>
+crsMat_t randomSortedMatrix(int numRows, int numCols, int maxRowLength) {
+  using rowmap_t  = typename crsMat_t::row_map_type::non_const_type;
+  using entries_t = typename crsMat_t::index_type::non_const_type;
+  using values_t  = typename crsMat_t::values_type::non_const_type;
+  using lno_t     = typename crsMat_t::ordinal_type;
+  std::mt19937 gen(numRows);
+  std::uniform_int_distribution<int> lengthDist(0, maxRowLength);
+  std::uniform_int_distribution<int> colDist(0, numCols - 1);
+  std::uniform_real_distribution<double> valDist(-10.0, 10.0);
+  std::vector<std::set<lno_t>> rows(numRows);
+  size_t nnz = 0;
+  for (auto& row : rows) {
+    int length = lengthDist(gen);
+    for (int k = 0; k < length; k++) row.insert(colDist(gen));
+    nnz += row.size();
+  }
+  rowmap_t rowmap("Rowmap", numRows + 1);
+  entries_t entries("Entries", nnz);
+  values_t values("Values", nnz);
+  auto rowmapHost  = Kokkos::create_mirror_view(rowmap);
+  auto entriesHost = Kokkos::create_mirror_view(entries);
+  auto valuesHost  = Kokkos::create_mirror_view(values);
+  size_t pos       = 0;
+  for (int i = 0; i < numRows; i++) {
+    rowmapHost(i) = pos;
+    for (lno_t j : rows[i]) {
+      entriesHost(pos) = j;
+      valuesHost(pos)  = valDist(gen);
+      pos++;
+    }
+  }
+  rowmapHost(numRows) = pos;
+  Kokkos::deep_copy(rowmap, rowmapHost);
+  Kokkos::deep_copy(entries, entriesHost);
+  Kokkos::deep_copy(values, valuesHost);
+  return crsMat_t("A", numRows, numCols, nnz, values, rowmap, entries);
+}
+
+template <typename crsMat_t>
+void expectSameMatrix(const crsMat_t& A, const crsMat_t& B) {
+  ASSERT_EQ(A.numRows(), B.numRows());
+  ASSERT_EQ(A.numCols(), B.numCols());
+  ASSERT_EQ(A.nnz(), B.nnz());
+  auto aRowmap =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.row_map);
+  auto aEntries =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.entries);
+  auto aValues =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.values);
+  auto bRowmap =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), B.graph.row_map);
+  auto bEntries =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), B.graph.entries);
+  auto bValues =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), B.values);
+  for (int i = 0; i <= A.numRows(); i++) ASSERT_EQ(aRowmap(i), bRowmap(i));
+  for (size_t j = 0; j < size_t(A.nnz()); j++) {
+    ASSERT_EQ(aEntries(j), bEntries(j));
+    ASSERT_EQ(aValues(j), bValues(j));
+  }
+}
+
+}  // namespace TestIOUtils
+
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void testReadMtxRoundTrip(int numRows, int numCols, int maxRowLength) {
+  using crsMat_t =
+      KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  const std::string filename = "kk_test_io_round_trip.mtx";
+  const std::string sidecar  = filename + ".crsbin";
+  crsMat_t A =
+      TestIOUtils::randomSortedMatrix<crsMat_t>(numRows, numCols, maxRowLength);
+  KokkosSparse::Impl::write_kokkos_crst_matrix(A, filename.c_str());
+  std::remove(sidecar.c_str());
+  crsMat_t B =
+      KokkosSparse::Impl::read_kokkos_crst_matrix<crsMat_t>(filename.c_str());
+  TestIOUtils::expectSameMatrix(A, B);
+  // the first cached read writes the sidecar, the second loads it
+  B = KokkosSparse::Impl::read_kokkos_crst_matrix<crsMat_t>(filename.c_str(),
+                                                            true);
+  TestIOUtils::expectSameMatrix(A, B);
+  ASSERT_TRUE(std::ifstream(sidecar).good());
+  lno_t nr, nc, *adj;
+  size_type nnz, *xadj;
+  scalar_t *values;
+  ASSERT_TRUE(KokkosSparse::Impl::read_crs_bin(&nr, &nc, &nnz, &xadj, &adj,
+                                               &values, sidecar.c_str()));
+  EXPECT_EQ(nr, numRows);
+  EXPECT_EQ(nc, numCols);
+  EXPECT_EQ(nnz, size_type(A.nnz()));
+  delete[] xadj;
+  delete[] adj;
+  delete[] values;
+  B = KokkosSparse::Impl::read_kokkos_crst_matrix<crsMat_t>(filename.c_str(),
+                                                            true);
+  TestIOUtils::expectSameMatrix(A, B);
+  // a sidecar of other types is ignored
+  float *floatValues;
+  EXPECT_FALSE(KokkosSparse::Impl::read_crs_bin(
+      &nr, &nc, &nnz, &xadj, &adj, &floatValues, sidecar.c_str()));
+  std::remove(filename.c_str());
+  std::remove(sidecar.c_str());
+}
+
+// Comments, blank lines, CRLF line ends and a symmetric pattern matrix
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void testReadMtxSymmetricPattern() {
+  using crsMat_t =
+      KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  const std::string filename = "kk_test_io_pattern.mtx";
+  {
+    std::ofstream f(filename);
+    f << "%%MatrixMarket matrix coordinate pattern symmetric\r\n"
+      << "% a comment\r\n"
+      << "4 4 4\r\n"
+      << "2 1\r\n"
+      << "\r\n"
+      << "% another comment\r\n"
+      << "3 3\r\n"
+      << "  4   2  \r\n"
+      << "4 1";
+  }
+  crsMat_t A =
+      KokkosSparse::Impl::read_kokkos_crst_matrix<crsMat_t>(filename.c_str());
+  std::remove(filename.c_str());
+  ASSERT_EQ(A.numRows(), 4);
+  ASSERT_EQ(A.numCols(), 4);
+  ASSERT_EQ(A.nnz(), 7);
+  auto rowmap =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.row_map);
+  auto entries =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.entries);
+  const size_type expectedRowmap[] = {0, 2, 4, 5, 7};
+  const lno_t expectedEntries[]    = {1, 3, 0, 3, 2, 0, 1};
+  for (int i = 0; i < 5; i++) ASSERT_EQ(rowmap(i), expectedRowmap[i]);
+  for (int j = 0; j < 7; j++) ASSERT_EQ(entries(j), expectedEntries[j]);
+}
+
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void testMmapCrsFile(int numRows, int numCols, int maxRowLength) {
+  using crsMat_t =
+      KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using bsrMat_t =
+      KokkosSparse::Experimental::BsrMatrix<scalar_t, lno_t, device, void,
+                                            size_type>;
+  const std::string filename = "kk_test_io_mmap.kkcrs";
+  crsMat_t A =
+      TestIOUtils::randomSortedMatrix<crsMat_t>(numRows, numCols, maxRowLength);
+  KokkosSparse::Impl::write_kokkos_crst_matrix_mmap(A, filename.c_str());
+  {
+    auto mapped = KokkosSparse::Impl::read_kokkos_crst_matrix_mmap<
+        scalar_t, lno_t, size_type>(filename.c_str());
+    ASSERT_EQ(mapped->numRows(), numRows);
+    ASSERT_EQ(mapped->numCols(), numCols);
+    ASSERT_EQ(mapped->blockDim(), 1);
+    // the host Views point into the mapping
+    auto values = mapped->values();
+    ASSERT_EQ(size_t(values.data()) % 64, 0u);
+    auto valuesHost =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.values);
+    for (size_t j = 0; j < values.extent(0); j++)
+      ASSERT_EQ(values(j), valuesHost(j));
+    TestIOUtils::expectSameMatrix(A, mapped->template to_matrix<crsMat_t>());
+  }
+  TestIOUtils::expectSameMatrix(
+      A, KokkosSparse::Impl::read_kokkos_crst_matrix_mmap_to<crsMat_t>(
+             filename.c_str()));
+  // a file of other types is rejected
+  using wrong_t = KokkosSparse::Impl::MappedCrsFile<float, lno_t, size_type>;
+  EXPECT_THROW(wrong_t(filename.c_str()), std::runtime_error);
+  // BSR: the entries of A become 2x2 blocks
+  Kokkos::View<scalar_t*, device> blockValues("Block values", 4 * A.nnz());
+  auto blockValuesHost = Kokkos::create_mirror_view(blockValues);
+  for (size_t j = 0; j < blockValuesHost.extent(0); j++)
+    blockValuesHost(j) = scalar_t(j);
+  Kokkos::deep_copy(blockValues, blockValuesHost);
+  bsrMat_t B("B", numRows, numCols, A.nnz(), blockValues, A.graph.row_map,
+             A.graph.entries, 2);
+  KokkosSparse::Impl::write_kokkos_crst_matrix_mmap(B, filename.c_str());
+  bsrMat_t C = KokkosSparse::Impl::read_kokkos_crst_matrix_mmap_to<bsrMat_t>(
+      filename.c_str());
+  ASSERT_EQ(C.blockDim(), 2);
+  ASSERT_EQ(C.numRows(), numRows);
+  ASSERT_EQ(C.numCols(), numCols);
+  auto cValues =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), C.values);
+  ASSERT_EQ(cValues.extent(0), blockValuesHost.extent(0));
+  for (size_t j = 0; j < cValues.extent(0); j++)
+    ASSERT_EQ(cValues(j), blockValuesHost(j));
+  EXPECT_THROW(KokkosSparse::Impl::read_kokkos_crst_matrix_mmap_to<crsMat_t>(
+                   filename.c_str()),
+               std::invalid_argument);
+  std::remove(filename.c_str());
+}
+
+#define EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)                         \
+  TEST_F(TestCategory,                                                        \
+         sparse##_##read_mtx##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) {  \
+    testReadMtxRoundTrip<SCALAR, ORDINAL, OFFSET, DEVICE>(10, 7, 5);          \
+    testReadMtxRoundTrip<SCALAR, ORDINAL, OFFSET, DEVICE>(5000, 6000, 16);    \
+    testReadMtxSymmetricPattern<SCALAR, ORDINAL, OFFSET, DEVICE>();           \
+  }                                                                           \
+  TEST_F(TestCategory,                                                        \
+         sparse##_##mmap_crs##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) {  \
+    testMmapCrsFile<SCALAR, ORDINAL, OFFSET, DEVICE>(1, 1, 1);                \
+    testMmapCrsFile<SCALAR, ORDINAL, OFFSET, DEVICE>(500, 300, 10);           \
+  }
+
+#if (defined(KOKKOSKERNELS_INST_DOUBLE) &&      \
+     defined(KOKKOSKERNELS_INST_ORDINAL_INT) && \
+     defined(KOKKOSKERNELS_INST_OFFSET_INT)) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&        \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int, int, TestDevice)
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_DOUBLE) &&         \
+     defined(KOKKOSKERNELS_INST_ORDINAL_INT64_T) && \
+     defined(KOKKOSKERNELS_INST_OFFSET_SIZE_T)) ||  \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) &&            \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int64_t, size_t, TestDevice)
+#endif
+
+#undef EXECUTE_TEST
+
+#endif  // TEST_SPARSE_IOUTILS_HPP
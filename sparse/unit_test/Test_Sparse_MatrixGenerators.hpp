@@ -0,0 +1,212 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file Test_Sparse_MatrixGenerators.hpp
+/// \brief Tests for the device matrix generators of
+/// KokkosSparse_MatrixGenerators.hpp
+
+#ifndef TEST_SPARSE_MATRIXGENERATORS_HPP
+#define TEST_SPARSE_MATRIXGENERATORS_HPP
+
+#include <Kokkos_Core.hpp>
+#include <KokkosSparse_CrsMatrix.hpp>
+#include <KokkosSparse_MatrixGenerators.hpp>
+#include <algorithm>
+#include <set>
+#include <utility>
+
+namespace TestMatrixGenerators {
+
+template <typename crsMat_t>
+struct HostCrs {
+  typename crsMat_t::row_map_type::HostMirror rowmap;
+  typename crsMat_t::index_type::HostMirror entries;
+  typename crsMat_t::values_type::HostMirror values;
+
+  explicit HostCrs(const crsMat_t& A)
+      : rowmap(Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                   A.graph.row_map)),
+        entries(Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                    A.graph.entries)),
+        values(Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                   A.values)) {}
+};
+
+// Every row has strictly increasing columns in [0, numCols)
+template <typename crsMat_t>
+void expectSortedRows(const crsMat_t& A, const HostCrs<crsMat_t>& h) {
+  ASSERT_EQ(size_t(h.rowmap(A.numRows())), size_t(A.nnz()));
+  for (int i = 0; i < A.numRows(); i++) {
+    for (auto k = h.rowmap(i); k < h.rowmap(i + 1); k++) {
+      ASSERT_GE(h.entries(k), 0);
+      ASSERT_LT(h.entries(k), A.numCols());
+      if (k > h.rowmap(i)) ASSERT_LT(h.entries(k - 1), h.entries(k));
+    }
+  }
+}
+
+template <typename crsMat_t>
+void expectSameMatrix(const crsMat_t& A, const crsMat_t& B) {
+  HostCrs<crsMat_t> a(A), b(B);
+  ASSERT_EQ(A.nnz(), B.nnz());
+  for (int i = 0; i <= A.numRows(); i++) ASSERT_EQ(a.rowmap(i), b.rowmap(i));
+  for (size_t k = 0; k < size_t(A.nnz()); k++) {
+    ASSERT_EQ(a.entries(k), b.entries(k));
+    ASSERT_EQ(a.values(k), b.values(k));
+  }
+}
+
+template <typename crsMat_t>
+bool sameEntries(const crsMat_t& A, const crsMat_t& B) {
+  if (A.nnz() != B.nnz()) return false;
+  HostCrs<crsMat_t> a(A), b(B);
+  for (size_t k = 0; k < size_t(A.nnz()); k++)
+    if (a.entries(k) != b.entries(k)) return false;
+  return true;
+}
+
+// A Laplacian has 2 * dim on the diagonal, -1 elsewhere, and is symmetric
+template <typename crsMat_t>
+void checkLaplacian(const crsMat_t& A, int dim, size_t expectedNnz) {
+  using scalar_t = typename crsMat_t::non_const_value_type;
+  using lno_t    = typename crsMat_t::non_const_ordinal_type;
+  ASSERT_EQ(size_t(A.nnz()), expectedNnz);
+  HostCrs<crsMat_t> h(A);
+  expectSortedRows(A, h);
+  std::set<std::pair<lno_t, lno_t>> pattern;
+  for (lno_t i = 0; i < A.numRows(); i++) {
+    for (auto k = h.rowmap(i); k < h.rowmap(i + 1); k++) {
+      const lno_t j = h.entries(k);
+      EXPECT_EQ(h.values(k), scalar_t(i == j ? 2 * dim : -1));
+      pattern.insert(std::make_pair(i, j));
+    }
+  }
+  for (const auto& ij : pattern)
+    EXPECT_TRUE(pattern.count(std::make_pair(ij.second, ij.first)));
+}
+
+}  // namespace TestMatrixGenerators
+
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void testGenerateLaplacian() {
+  using crsMat_t =
+      KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  crsMat_t A = KokkosSparse::Impl::kk_generate_laplacian_2d<crsMat_t>(7, 5);
+  ASSERT_EQ(A.numRows(), 35);
+  ASSERT_EQ(A.numCols(), 35);
+  TestMatrixGenerators::checkLaplacian(A, 2, 5 * 35 - 2 * 5 - 2 * 7);
+  crsMat_t B = KokkosSparse::Impl::kk_generate_laplacian_3d<crsMat_t>(4, 3, 5);
+  ASSERT_EQ(B.numRows(), 60);
+  TestMatrixGenerators::checkLaplacian(B, 3,
+                                       7 * 60 - 2 * (3 * 5 + 4 * 5 + 4 * 3));
+  crsMat_t empty = KokkosSparse::Impl::kk_generate_laplacian_2d<crsMat_t>(0, 4);
+  EXPECT_EQ(empty.numRows(), 0);
+  EXPECT_EQ(empty.nnz(), 0);
+}
+
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void testGenerateBanded() {
+  using crsMat_t =
+      KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using AT = Kokkos::ArithTraits<scalar_t>;
+  const lno_t numRows = 200, numCols = 150, bandwidth = 6, rowLength = 5;
+  crsMat_t A = KokkosSparse::Impl::kk_generate_banded_sparse_matrix<crsMat_t>(
+      numRows, numCols, bandwidth, rowLength, 42);
+  ASSERT_EQ(A.numRows(), numRows);
+  ASSERT_EQ(A.numCols(), numCols);
+  TestMatrixGenerators::HostCrs<crsMat_t> h(A);
+  TestMatrixGenerators::expectSortedRows(A, h);
+  for (lno_t i = 0; i < numRows; i++) {
+    const lno_t lo   = std::max<lno_t>(i - bandwidth, 0);
+    const lno_t hi   = std::min<lno_t>(i + bandwidth, numCols - 1);
+    const lno_t band = hi >= lo ? hi - lo + 1 : 0;
+    const lno_t len  = std::min<lno_t>(band, rowLength);
+    ASSERT_EQ(lno_t(h.rowmap(i + 1) - h.rowmap(i)), len);
+    bool foundDiag = false;
+    for (auto k = h.rowmap(i); k < h.rowmap(i + 1); k++) {
+      EXPECT_GE(h.entries(k), lo);
+      EXPECT_LE(h.entries(k), hi);
+      if (h.entries(k) == i) {
+        foundDiag = true;
+        EXPECT_EQ(h.values(k), scalar_t(len));
+      } else {
+        EXPECT_LT(AT::abs(h.values(k)), AT::abs(AT::one()));
+      }
+    }
+    EXPECT_EQ(foundDiag, i < numCols);
+  }
+  // Same seed, same matrix; another seed picks other columns
+  crsMat_t B = KokkosSparse::Impl::kk_generate_banded_sparse_matrix<crsMat_t>(
+      numRows, numCols, bandwidth, rowLength, 42);
+  TestMatrixGenerators::expectSameMatrix(A, B);
+  crsMat_t C = KokkosSparse::Impl::kk_generate_banded_sparse_matrix<crsMat_t>(
+      numRows, numCols, bandwidth, rowLength, 43);
+  EXPECT_FALSE(TestMatrixGenerators::sameEntries(A, C));
+}
+
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void testGenerateRmat() {
+  using crsMat_t =
+      KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using AT             = Kokkos::ArithTraits<scalar_t>;
+  const int scale      = 10;
+  const int edgeFactor = 8;
+  const lno_t n        = lno_t(1) << scale;
+  crsMat_t A =
+      KokkosSparse::Impl::kk_generate_rmat_matrix<crsMat_t>(scale, edgeFactor);
+  ASSERT_EQ(A.numRows(), n);
+  ASSERT_EQ(A.numCols(), n);
+  TestMatrixGenerators::HostCrs<crsMat_t> h(A);
+  TestMatrixGenerators::expectSortedRows(A, h);
+  // Values count the merged duplicates, so they add up to the sampled edges
+  double edges = 0;
+  for (size_t k = 0; k < size_t(A.nnz()); k++) edges += AT::abs(h.values(k));
+  EXPECT_EQ(edges, double(edgeFactor) * n);
+  // The degree distribution is skewed
+  size_type maxDegree = 0;
+  for (lno_t i = 0; i < n; i++)
+    maxDegree = std::max<size_type>(maxDegree, h.rowmap(i + 1) - h.rowmap(i));
+  EXPECT_GT(maxDegree, size_type(4 * edgeFactor));
+  crsMat_t B =
+      KokkosSparse::Impl::kk_generate_rmat_matrix<crsMat_t>(scale, edgeFactor);
+  TestMatrixGenerators::expectSameMatrix(A, B);
+  crsMat_t C = KokkosSparse::Impl::kk_generate_rmat_matrix<crsMat_t>(
+      scale, edgeFactor, 7);
+  EXPECT_FALSE(TestMatrixGenerators::sameEntries(A, C));
+}
+
+#define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)          \
+  TEST_F(TestCategory,                                                       \
+         sparse##_##gen_lap##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) {  \
+    testGenerateLaplacian<SCALAR, ORDINAL, OFFSET, DEVICE>();                \
+  }                                                                          \
+  TEST_F(TestCategory,                                                       \
+         sparse##_##gen_band##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    testGenerateBanded<SCALAR, ORDINAL, OFFSET, DEVICE>();                   \
+  }                                                                          \
+  TEST_F(TestCategory,                                                       \
+         sparse##_##gen_rmat##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    testGenerateRmat<SCALAR, ORDINAL, OFFSET, DEVICE>();                     \
+  }
+
+#include <Test_Common_Test_All_Type_Combos.hpp>
+
+#undef KOKKOSKERNELS_EXECUTE_TEST
+
+#endif  // TEST_SPARSE_MATRIXGENERATORS_HPP
@@ -0,0 +1,172 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <set>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+
+#include "KokkosSparse_Utils.hpp"
+#include "KokkosSparse_SortCrs.hpp"
+#include "KokkosSparse_spgemm_masked.hpp"
+#include "KokkosSparse_spgemm_semiring.hpp"
+#include "KokkosSparse_spmv.hpp"
+#include "KokkosSparse_spmv_pattern.hpp"
+#include "KokkosKernels_TestUtils.hpp"
+// For Test::is_same_matrix
+#include "Test_Sparse_Utils.hpp"
+
+namespace Test {
+
+// A copy of A with every value set to one: the CrsMatrix that a
+// PatternMatrix of A.graph stands for
+template <typename crsMat_t>
+crsMat_t pattern_ones_matrix(const crsMat_t& A) {
+  using values_t = typename crsMat_t::values_type::non_const_type;
+  using scalar_t = typename crsMat_t::non_const_value_type;
+  values_t ones("ones", A.nnz());
+  Kokkos::deep_copy(ones, Kokkos::ArithTraits<scalar_t>::one());
+  return crsMat_t("ones", A.numRows(), A.numCols(), A.nnz(), ones,
+                  A.graph.row_map, A.graph.entries);
+}
+
+// spmv_pattern against spmv with the matrix of ones
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void run_test_spmv_pattern(lno_t numRows, lno_t numCols, size_type nnz,
+                           lno_t row_size_variance) {
+  using crsMat_t =
+      KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using vec_t      = Kokkos::View<scalar_t*, device>;
+  using exec_space = typename device::execution_space;
+  using mag_t      = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+
+  crsMat_t A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      numRows, numCols, nnz, row_size_variance, numCols / 2);
+  crsMat_t ones = pattern_ones_matrix(A);
+  auto P =
+      KokkosSparse::Experimental::make_pattern_matrix<scalar_t>(A.graph,
+                                                                numCols);
+  EXPECT_EQ(P.numRows(), numRows);
+  EXPECT_EQ(size_t(P.nnz()), size_t(A.nnz()));
+
+  const mag_t eps = 1e3 * Kokkos::ArithTraits<mag_t>::eps();
+  Kokkos::Random_XorShift64_Pool<exec_space> rand_pool(9753);
+  vec_t x("x", numCols);
+  Kokkos::fill_random(x, rand_pool, scalar_t(1));
+
+  for (scalar_t beta : {scalar_t(0), scalar_t(1), scalar_t(-1.5)}) {
+    const scalar_t alpha = 2.5;
+    vec_t y("y", numRows), y_ref("y_ref", numRows);
+    Kokkos::fill_random(y, rand_pool, scalar_t(1));
+    Kokkos::deep_copy(y_ref, y);
+    KokkosSparse::spmv("N", alpha, ones, x, beta, y_ref);
+    KokkosSparse::Experimental::spmv_pattern(alpha, P, x, beta, y);
+    EXPECT_NEAR_KK_1DVIEW(y, y_ref, eps * numCols);
+  }
+
+  // beta = 0 overwrites NaN
+  vec_t y("y", numRows), y_ref("y_ref", numRows);
+  Kokkos::deep_copy(y, Kokkos::ArithTraits<scalar_t>::nan());
+  KokkosSparse::spmv("N", scalar_t(1), ones, x, scalar_t(0), y_ref);
+  KokkosSparse::Experimental::spmv_pattern(exec_space(), scalar_t(1), P, x,
+                                           scalar_t(0), y);
+  EXPECT_NEAR_KK_1DVIEW(y, y_ref, eps * numCols);
+
+  vec_t x_short("x_short", numCols + 1);
+  EXPECT_THROW(KokkosSparse::Experimental::spmv_pattern(
+                   scalar_t(1), P, x_short, scalar_t(0), y),
+               std::runtime_error);
+}
+
+// Products of PatternMatrix against products of the matrices of ones, and
+// triangle counting with C<L> = L*L
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void run_test_spgemm_pattern(lno_t n, size_type nnz) {
+  using crsMat_t =
+      KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using namespace KokkosSparse::Experimental;
+
+  crsMat_t A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      n, n, nnz, 5, n / 2 + 1);
+  KokkosSparse::sort_crs_matrix(A);
+  crsMat_t ones = pattern_ones_matrix(A);
+  auto P        = make_pattern_matrix<scalar_t>(A.graph, n);
+
+  crsMat_t C = spgemm_semiring<crsMat_t>(P, P, PlusTimesSemiring<scalar_t>());
+  crsMat_t C_ref =
+      spgemm_semiring<crsMat_t>(ones, ones, PlusTimesSemiring<scalar_t>());
+  EXPECT_TRUE((is_same_matrix<crsMat_t, device>(C, C_ref)));
+
+  crsMat_t L      = KokkosSparse::Impl::kk_get_lower_triangle(A);
+  crsMat_t L_ones = pattern_ones_matrix(L);
+  auto PL         = make_pattern_matrix<scalar_t>(L.graph, n);
+  crsMat_t T      = spgemm_masked<crsMat_t>(PL, false, PL, PL);
+  crsMat_t T_ref  = spgemm_masked<crsMat_t>(L_ones, false, L_ones, L_ones);
+  EXPECT_TRUE((is_same_matrix<crsMat_t, device>(T, T_ref)));
+
+  // The values of T sum to the number of triangles i > k > j of L
+  auto row_map = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                     L.graph.row_map);
+  auto entries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                     L.graph.entries);
+  auto T_values =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), T.values);
+  size_t triangles = 0;
+  for (lno_t i = 0; i < n; i++) {
+    std::set<lno_t> row_i(entries.data() + row_map(i),
+                          entries.data() + row_map(i + 1));
+    for (size_type q = row_map(i); q < row_map(i + 1); q++) {
+      const lno_t k = entries(q);
+      for (size_type r = row_map(k); r < row_map(k + 1); r++)
+        triangles += row_i.count(entries(r));
+    }
+  }
+  double sum = 0;
+  for (size_t q = 0; q < T_values.extent(0); q++)
+    sum += Kokkos::ArithTraits<scalar_t>::real(T_values(q));
+  EXPECT_EQ(size_t(sum), triangles);
+}
+
+}  // namespace Test
+
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void test_pattern_matrix() {
+  Test::run_test_spmv_pattern<scalar_t, lno_t, size_type, device>(1, 1, 1,
+                                                                  0);
+  Test::run_test_spmv_pattern<scalar_t, lno_t, size_type, device>(
+      1000, 1000, 5000, 20);
+  Test::run_test_spmv_pattern<scalar_t, lno_t, size_type, device>(
+      503, 311, 3000, 40);
+  Test::run_test_spgemm_pattern<scalar_t, lno_t, size_type, device>(
+      200, 200 * 8);
+  Test::run_test_spgemm_pattern<scalar_t, lno_t, size_type, device>(10, 0);
+}
+
+#define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)           \
+  TEST_F(                                                                     \
+      TestCategory,                                                           \
+      sparse##_##pattern_matrix##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    test_pattern_matrix<SCALAR, ORDINAL, OFFSET, DEVICE>();                   \
+  }
+
+#include <Test_Common_Test_All_Type_Combos.hpp>
+
+#undef KOKKOSKERNELS_EXECUTE_TEST
@@ -0,0 +1,217 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file Test_Sparse_PermuteCrs.hpp
+/// \brief Tests for permute_crs_matrix and permute_crs_graph in
+/// KokkosSparse_PermuteCrs.hpp
+
+#ifndef KOKKOSSPARSE_PERMUTECRSTEST_HPP
+#define KOKKOSSPARSE_PERMUTECRSTEST_HPP
+
+#include <Kokkos_Core.hpp>
+#include "KokkosSparse_IOUtils.hpp"
+#include <KokkosSparse_PermuteCrs.hpp>
+#include <KokkosKernels_default_types.hpp>
+#include <KokkosSparse_CrsMatrix.hpp>
+#include <KokkosSparse_BsrMatrix.hpp>
+#include <algorithm>
+#include <map>
+#include <numeric>
+#include <random>
+#include <vector>
+
+// Random permutation of size n, on device and in permVec
+template <typename perm_t>
+perm_t randomPermutation(
+    typename perm_t::non_const_value_type n, unsigned seed,
+    std::vector<typename perm_t::non_const_value_type>& permVec) {
+  permVec.resize(n);
+  std::iota(permVec.begin(), permVec.end(), 0);
+  std::shuffle(permVec.begin(), permVec.end(), std::mt19937(seed));
+  perm_t perm("Permutation", n);
+  auto permHost = Kokkos::create_mirror_view(perm);
+  for (size_t i = 0; i < permVec.size(); i++) permHost(i) = permVec[i];
+  Kokkos::deep_copy(perm, permHost);
+  return perm;
+}
+
+template <typename device_t>
+void testPermuteCRS(default_lno_t numRows, default_size_type nnz,
+                    bool doValues) {
+  using scalar_t   = default_scalar;
+  using lno_t      = default_lno_t;
+  using size_type  = default_size_type;
+  using exec_space = typename device_t::execution_space;
+  using crsMat_t =
+      KokkosSparse::CrsMatrix<scalar_t, lno_t, device_t, void, size_type>;
+  using rowmap_t  = typename crsMat_t::row_map_type::non_const_type;
+  using entries_t = typename crsMat_t::index_type::non_const_type;
+  crsMat_t A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      numRows, numRows, nnz, 2, numRows / 2);
+  std::vector<lno_t> permVec;
+  entries_t perm = randomPermutation<entries_t>(numRows, 17, permVec);
+  // The permuted entries (and values) of each row, in column order
+  std::vector<std::map<lno_t, scalar_t>> expected(numRows);
+  auto rowmapHost =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.row_map);
+  auto entriesHost =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.entries);
+  auto valuesHost =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.values);
+  for (lno_t i = 0; i < numRows; i++) {
+    for (size_type j = rowmapHost(i); j < rowmapHost(i + 1); j++)
+      expected[permVec[i]][permVec[entriesHost(j)]] += valuesHost(j);
+  }
+  rowmap_t outRowmap;
+  entries_t outEntries;
+  Kokkos::View<scalar_t*, Kokkos::HostSpace> outValuesHost;
+  if (doValues) {
+    crsMat_t B    = KokkosSparse::permute_crs_matrix(A, perm);
+    outRowmap     = B.graph.row_map;
+    outEntries    = B.graph.entries;
+    outValuesHost =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), B.values);
+  } else {
+    KokkosSparse::permute_crs_graph<exec_space>(
+        A.graph.row_map, A.graph.entries, perm, outRowmap, outEntries);
+  }
+  auto outRowmapHost =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), outRowmap);
+  auto outEntriesHost =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), outEntries);
+  ASSERT_EQ(outRowmapHost.extent(0), size_t(numRows + 1));
+  ASSERT_EQ(outEntriesHost.extent(0), size_t(A.nnz()));
+  for (lno_t i = 0; i < numRows; i++) {
+    // kk_generate_sparse_matrix doesn't produce duplicate entries
+    ASSERT_EQ(size_t(outRowmapHost(i + 1) - outRowmapHost(i)),
+              expected[i].size());
+    size_type j = outRowmapHost(i);
+    for (const auto& entry : expected[i]) {
+      EXPECT_EQ(outEntriesHost(j), entry.first);
+      if (doValues) EXPECT_EQ(outValuesHost(j), entry.second);
+      j++;
+    }
+  }
+}
+
+// permute_matrix on a CrsMatrix (blockDim = 0) or a BsrMatrix, with separate
+// row and column permutations, or symmetric if numCols == 0
+template <typename device_t>
+void testPermuteMatrix(default_lno_t numRows, default_lno_t numCols,
+                       default_size_type nnz, default_lno_t blockDim) {
+  using scalar_t  = default_scalar;
+  using lno_t     = default_lno_t;
+  using size_type = default_size_type;
+  using crsMat_t =
+      KokkosSparse::CrsMatrix<scalar_t, lno_t, device_t, void, size_type>;
+  using bsrMat_t =
+      KokkosSparse::Experimental::BsrMatrix<scalar_t, lno_t, device_t, void,
+                                            size_type>;
+  using entries_t      = typename crsMat_t::index_type::non_const_type;
+  const bool symmetric = numCols == 0;
+  if (symmetric) numCols = numRows;
+  std::vector<lno_t> rowPermVec, colPermVec;
+  entries_t rowPerm = randomPermutation<entries_t>(numRows, 5, rowPermVec);
+  entries_t colPerm = rowPerm;
+  if (symmetric)
+    colPermVec = rowPermVec;
+  else
+    colPerm = randomPermutation<entries_t>(numCols, 6, colPermVec);
+  entries_t rowInvPerm("Inverse permutation", numRows);
+  {
+    auto invHost = Kokkos::create_mirror_view(rowInvPerm);
+    for (lno_t i = 0; i < numRows; i++) invHost(rowPermVec[i]) = i;
+    Kokkos::deep_copy(rowInvPerm, invHost);
+  }
+  // A and B = permute_matrix(A, ...), as host rowmap/entries/values
+  auto check = [&](const auto& A, const auto& B, size_type blockSize) {
+    Kokkos::HostSpace host;
+    auto rowmapHost =
+        Kokkos::create_mirror_view_and_copy(host, A.graph.row_map);
+    auto entriesHost =
+        Kokkos::create_mirror_view_and_copy(host, A.graph.entries);
+    auto valuesHost = Kokkos::create_mirror_view_and_copy(host, A.values);
+    auto outRowmapHost =
+        Kokkos::create_mirror_view_and_copy(host, B.graph.row_map);
+    auto outEntriesHost =
+        Kokkos::create_mirror_view_and_copy(host, B.graph.entries);
+    auto outValuesHost = Kokkos::create_mirror_view_and_copy(host, B.values);
+    ASSERT_EQ(B.numRows(), A.numRows());
+    ASSERT_EQ(B.numCols(), A.numCols());
+    ASSERT_EQ(outEntriesHost.extent(0), entriesHost.extent(0));
+    std::vector<std::map<lno_t, size_type>> expected(numRows);
+    for (lno_t i = 0; i < numRows; i++) {
+      for (size_type j = rowmapHost(i); j < rowmapHost(i + 1); j++)
+        expected[rowPermVec[i]][colPermVec[entriesHost(j)]] = j;
+    }
+    for (lno_t i = 0; i < numRows; i++) {
+      ASSERT_EQ(size_t(outRowmapHost(i + 1) - outRowmapHost(i)),
+                expected[i].size());
+      size_type j = outRowmapHost(i);
+      for (const auto& entry : expected[i]) {
+        EXPECT_EQ(outEntriesHost(j), entry.first);
+        for (size_type k = 0; k < blockSize; k++) {
+          EXPECT_EQ(outValuesHost(j * blockSize + k),
+                    valuesHost(entry.second * blockSize + k));
+        }
+        j++;
+      }
+    }
+  };
+  if (blockDim) {
+    bsrMat_t Ab = KokkosSparse::Impl::kk_generate_sparse_matrix<bsrMat_t>(
+        blockDim, numRows, numCols, nnz, 2, numCols / 2);
+    bsrMat_t Bb =
+        symmetric
+            ? KokkosSparse::permute_matrix(Ab, rowPerm, rowInvPerm)
+            : KokkosSparse::permute_matrix(Ab, rowPerm, rowInvPerm, colPerm);
+    ASSERT_EQ(Bb.blockDim(), blockDim);
+    check(Ab, Bb, size_type(blockDim) * blockDim);
+  } else {
+    crsMat_t A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+        numRows, numCols, nnz, 2, numCols / 2);
+    crsMat_t B =
+        symmetric
+            ? KokkosSparse::permute_matrix(A, rowPerm, rowInvPerm)
+            : KokkosSparse::permute_matrix(A, rowPerm, rowInvPerm, colPerm);
+    check(A, B, 1);
+  }
+}
+
+TEST_F(TestCategory, common_permute_crsmatrix) {
+  testPermuteCRS<TestDevice>(10, 10 * 3, true);
+  testPermuteCRS<TestDevice>(1000, 1000 * 8, true);
+  testPermuteCRS<TestDevice>(0, 0, true);
+}
+
+TEST_F(TestCategory, common_permute_crsgraph) {
+  testPermuteCRS<TestDevice>(10, 10 * 3, false);
+  testPermuteCRS<TestDevice>(1000, 1000 * 8, false);
+}
+
+TEST_F(TestCategory, common_permute_matrix) {
+  testPermuteMatrix<TestDevice>(100, 0, 100 * 5, 0);
+  testPermuteMatrix<TestDevice>(100, 70, 100 * 5, 0);
+  testPermuteMatrix<TestDevice>(70, 100, 70 * 5, 0);
+  testPermuteMatrix<TestDevice>(0, 0, 0, 0);
+}
+
+TEST_F(TestCategory, common_permute_bsrmatrix) {
+  testPermuteMatrix<TestDevice>(50, 0, 50 * 4, 2);
+  testPermuteMatrix<TestDevice>(60, 40, 60 * 4, 3);
+}
+
+#endif  // KOKKOSSPARSE_PERMUTECRSTEST_HPP
@@ -30,7 +30,11 @@
 #include <KokkosSparse_CrsMatrix.hpp>
 #include <Kokkos_ArithTraits.hpp>
 #include <Kokkos_Complex.hpp>
+#include <algorithm>
 #include <cstdlib>
+#include <numeric>
+#include <random>
+#include <vector>
 
 namespace SortCrsTest {
 enum : int {
@@ -499,6 +503,70 @@ void testSortAndMerge(bool justGraph, int howExecSpecified,
   }
 }
 
+template <typename device_t>
+void testSegmentedSortCRS(bool doValues) {
+  using scalar_t   = default_scalar;
+  using lno_t      = default_lno_t;
+  using size_type  = default_size_type;
+  using exec_space = typename device_t::execution_space;
+  using rowmap_t   = Kokkos::View<size_type*, device_t>;
+  using entries_t  = Kokkos::View<lno_t*, device_t>;
+  using values_t   = Kokkos::View<scalar_t*, device_t>;
+  // Rows in all three bins of the segmented sort: short (<= 32 entries),
+  // medium and long (> 65536 entries), with distinct columns in each row
+  const lno_t numCols = 100000;
+  std::vector<lno_t> rowLengths;
+  for (int i = 0; i < 500; i++) rowLengths.push_back(i % 33);
+  for (int i = 0; i < 20; i++) rowLengths.push_back(33 + 100 * i);
+  rowLengths.push_back(numCols);
+  rowLengths.push_back(70000);
+  for (int i = 0; i < 100; i++) rowLengths.push_back(i % 3);
+  lno_t numRows = rowLengths.size();
+  std::mt19937 gen(321);
+  std::vector<lno_t> allCols(numCols);
+  std::iota(allCols.begin(), allCols.end(), 0);
+  rowmap_t rowmap("Rowmap", numRows + 1);
+  auto rowmapHost = Kokkos::create_mirror_view(rowmap);
+  rowmapHost(0)   = 0;
+  for (lno_t i = 0; i < numRows; i++)
+    rowmapHost(i + 1) = rowmapHost(i) + rowLengths[i];
+  size_type nnz = rowmapHost(numRows);
+  entries_t entries("Entries", nnz);
+  values_t values("Values", doValues ? nnz : 0);
+  auto entriesHost = Kokkos::create_mirror_view(entries);
+  auto valuesHost  = Kokkos::create_mirror_view(values);
+  std::vector<std::vector<lno_t>> goldRows(numRows);
+  for (lno_t i = 0; i < numRows; i++) {
+    // partial shuffle, enough to pick rowLengths[i] random columns
+    for (lno_t j = 0; j < rowLengths[i]; j++)
+      std::swap(allCols[j], allCols[j + gen() % (numCols - j)]);
+    goldRows[i].assign(allCols.begin(), allCols.begin() + rowLengths[i]);
+    for (lno_t j = 0; j < rowLengths[i]; j++) {
+      entriesHost(rowmapHost(i) + j) = goldRows[i][j];
+      // the value of an entry is its column, to check them after sorting
+      if (doValues) valuesHost(rowmapHost(i) + j) = scalar_t(goldRows[i][j]);
+    }
+    std::sort(goldRows[i].begin(), goldRows[i].end());
+  }
+  Kokkos::deep_copy(rowmap, rowmapHost);
+  Kokkos::deep_copy(entries, entriesHost);
+  Kokkos::deep_copy(values, valuesHost);
+  if (doValues)
+    KokkosSparse::segmented_sort_crs_matrix(exec_space(), rowmap, entries,
+                                            values);
+  else
+    KokkosSparse::segmented_sort_crs_graph(exec_space(), rowmap, entries);
+  Kokkos::deep_copy(entriesHost, entries);
+  Kokkos::deep_copy(valuesHost, values);
+  for (lno_t i = 0; i < numRows; i++) {
+    for (lno_t j = 0; j < rowLengths[i]; j++) {
+      size_type pos = rowmapHost(i) + j;
+      ASSERT_EQ(entriesHost(pos), goldRows[i][j]) << "row " << i;
+      if (doValues) ASSERT_EQ(valuesHost(pos), scalar_t(goldRows[i][j]));
+    }
+  }
+}
+
 TEST_F(TestCategory, common_sort_crsgraph) {
   for (int doStructInterface = 0; doStructInterface < 2; doStructInterface++) {
     for (int howExecSpecified = 0; howExecSpecified < 3; howExecSpecified++) {
@@ -545,6 +613,11 @@ TEST_F(TestCategory, common_sort_crs_longrows) {
                           SortCrsTest::ImplicitType);
 }
 
+TEST_F(TestCategory, common_sort_crs_segmented) {
+  testSegmentedSortCRS<TestDevice>(false);
+  testSegmentedSortCRS<TestDevice>(true);
+}
+
 TEST_F(TestCategory, common_sort_merge_crsmatrix) {
   for (int testCase = 0; testCase < 5; testCase++) {
     for (int doStructInterface = 0; doStructInterface < 2;
@@ -0,0 +1,167 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file Test_Sparse_StreamingCrsBuilder.hpp
+/// \brief Tests for CrsStreamingBuilder
+
+#ifndef TEST_SPARSE_STREAMINGCRSBUILDER_HPP
+#define TEST_SPARSE_STREAMINGCRSBUILDER_HPP
+
+#include <Kokkos_Core.hpp>
+#include <KokkosSparse_CrsMatrix.hpp>
+#include <KokkosSparse_StreamingCrsBuilder.hpp>
+#include <map>
+#include <random>
+#include <utility>
+
+namespace TestStreamingCrsBuilder {
+
+// Batch b of a deterministic generator of triplets, with repeated entries;
+// the values are small integers so that their sums are exact
+template <typename lno_t, typename scalar_t, typename device>
+void generateBatch(int b, int batchSize, lno_t numRows, lno_t numCols,
+                   Kokkos::View<lno_t*, device>& rows,
+                   Kokkos::View<lno_t*, device>& cols,
+                   Kokkos::View<scalar_t*, device>& vals) {
+  std::mt19937 gen(b);
+  std::uniform_int_distribution<lno_t> rowDist(0, numRows - 1);
+  std::uniform_int_distribution<lno_t> colDist(0, numCols - 1);
+  std::uniform_int_distribution<int> valDist(-5, 5);
+  rows       = Kokkos::View<lno_t*, device>("Batch rows", batchSize);
+  cols       = Kokkos::View<lno_t*, device>("Batch cols", batchSize);
+  vals       = Kokkos::View<scalar_t*, device>("Batch vals", batchSize);
+  auto rowsH = Kokkos::create_mirror_view(rows);
+  auto colsH = Kokkos::create_mirror_view(cols);
+  auto valsH = Kokkos::create_mirror_view(vals);
+  for (int i = 0; i < batchSize; i++) {
+    rowsH(i) = rowDist(gen);
+    colsH(i) = colDist(gen);
+    valsH(i) = scalar_t(valDist(gen));
+  }
+  Kokkos::deep_copy(rows, rowsH);
+  Kokkos::deep_copy(cols, colsH);
+  Kokkos::deep_copy(vals, valsH);
+}
+
+}  // namespace TestStreamingCrsBuilder
+
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void testStreamingCrsBuilder(lno_t numRows, lno_t numCols, int numBatches,
+                             int batchSize) {
+  using crsMat_t =
+      KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using builder_t =
+      KokkosSparse::Experimental::CrsStreamingBuilder<crsMat_t>;
+  using lno_view_t    = Kokkos::View<lno_t*, device>;
+  using scalar_view_t = Kokkos::View<scalar_t*, device>;
+  builder_t builder(numRows, numCols);
+  std::map<std::pair<lno_t, lno_t>, scalar_t> expected;
+  for (int b = 0; b < numBatches; b++) {
+    lno_view_t rows, cols;
+    scalar_view_t vals;
+    TestStreamingCrsBuilder::generateBatch(b, batchSize, numRows, numCols, rows,
+                                           cols, vals);
+    builder.count(rows, cols);
+    auto rowsH = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), rows);
+    auto colsH = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), cols);
+    auto valsH = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), vals);
+    for (int i = 0; i < batchSize; i++)
+      expected[std::make_pair(rowsH(i), colsH(i))] += valsH(i);
+  }
+  EXPECT_THROW(builder.finish(), std::runtime_error);
+  builder.allocate();
+  // the second pass may see the batches in another order
+  for (int b = numBatches - 1; b >= 0; b--) {
+    lno_view_t rows, cols;
+    scalar_view_t vals;
+    TestStreamingCrsBuilder::generateBatch(b, batchSize, numRows, numCols, rows,
+                                           cols, vals);
+    builder.fill(rows, cols, vals);
+  }
+  crsMat_t A = builder.finish();
+  ASSERT_EQ(A.numRows(), numRows);
+  ASSERT_EQ(A.numCols(), numCols);
+  ASSERT_EQ(size_t(A.nnz()), expected.size());
+  auto rowmap =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.row_map);
+  auto entries =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.entries);
+  auto values =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.values);
+  auto it = expected.begin();
+  for (lno_t i = 0; i < numRows; i++) {
+    for (size_type j = rowmap(i); j < rowmap(i + 1); j++, it++) {
+      ASSERT_EQ(it->first.first, i);
+      ASSERT_EQ(it->first.second, entries(j));
+      ASSERT_EQ(it->second, values(j));
+    }
+  }
+}
+
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void testStreamingCrsBuilderErrors() {
+  using crsMat_t =
+      KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using builder_t =
+      KokkosSparse::Experimental::CrsStreamingBuilder<crsMat_t>;
+  using lno_view_t    = Kokkos::View<lno_t*, device>;
+  using scalar_view_t = Kokkos::View<scalar_t*, device>;
+  lno_view_t rows, cols;
+  scalar_view_t vals;
+  TestStreamingCrsBuilder::generateBatch(0, 100, lno_t(10), lno_t(10), rows,
+                                         cols, vals);
+  // out of bounds
+  builder_t small(5, 10);
+  EXPECT_THROW(small.count(rows, cols), std::invalid_argument);
+  // a fill pass with fewer entries than counted
+  builder_t builder(10, 10);
+  builder.count(rows, cols);
+  EXPECT_THROW(builder.fill(rows, cols, vals), std::runtime_error);
+  builder.allocate();
+  EXPECT_THROW(builder.count(rows, cols), std::runtime_error);
+  auto half = std::make_pair(0, 50);
+  builder.fill(Kokkos::subview(rows, half), Kokkos::subview(cols, half),
+               Kokkos::subview(vals, half));
+  EXPECT_THROW(builder.finish(), std::runtime_error);
+  // a fill pass with more entries than counted
+  builder_t builder2(10, 10);
+  builder2.count(Kokkos::subview(rows, half), Kokkos::subview(cols, half));
+  builder2.allocate();
+  EXPECT_THROW(builder2.fill(rows, cols, vals), std::invalid_argument);
+}
+
+#define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)          \
+  TEST_F(                                                                    \
+      TestCategory,                                                          \
+      sparse##_##streaming_crs##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    testStreamingCrsBuilder<SCALAR, ORDINAL, OFFSET, DEVICE>(1, 1, 1, 10);   \
+    testStreamingCrsBuilder<SCALAR, ORDINAL, OFFSET, DEVICE>(100, 50, 4,     \
+                                                             500);           \
+    testStreamingCrsBuilder<SCALAR, ORDINAL, OFFSET, DEVICE>(5000, 8000, 10, \
+                                                             20000);         \
+    testStreamingCrsBuilderErrors<SCALAR, ORDINAL, OFFSET, DEVICE>();        \
+  }
+
+#define NO_TEST_COMPLEX
+
+#include <Test_Common_Test_All_Type_Combos.hpp>
+
+#undef KOKKOSKERNELS_EXECUTE_TEST
+#undef NO_TEST_COMPLEX
+
+#endif  // TEST_SPARSE_STREAMINGCRSBUILDER_HPP
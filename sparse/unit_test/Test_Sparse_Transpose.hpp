@@ -123,6 +123,91 @@ void testTranspose(int numRows, int numCols, bool doValues) {
   }
 }
 
+template <typename device_t>
+void testSortedTranspose(int numRows, int numCols, bool doValues) {
+  using exec_space  = typename device_t::execution_space;
+  using range_pol   = Kokkos::RangePolicy<exec_space>;
+  using scalar_t    = default_scalar;
+  using lno_t       = default_lno_t;
+  using size_type   = default_size_type;
+  using crsMat_t =
+      KokkosSparse::CrsMatrix<scalar_t, lno_t, device_t, void, size_type>;
+  using c_rowmap_t  = typename crsMat_t::row_map_type;
+  using c_entries_t = typename crsMat_t::index_type;
+  using c_values_t  = typename crsMat_t::values_type;
+  using rowmap_t    = typename crsMat_t::row_map_type::non_const_type;
+  using entries_t   = typename crsMat_t::index_type::non_const_type;
+  using values_t    = typename crsMat_t::values_type::non_const_type;
+  size_type nnz     = 10 * numRows;
+  // Generate an unsorted matrix that has 0 entries in some rows
+  crsMat_t input_mat = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      numRows, numCols, nnz, 3 * 10, numRows / 2);
+  // The reference: atomic transpose, then sort
+  rowmap_t ref_rowmap("Rowmap^T", numCols + 1);
+  entries_t ref_entries("Entries^T", input_mat.nnz());
+  values_t ref_values("Values^T", input_mat.nnz());
+  KokkosSparse::Impl::transpose_matrix<c_rowmap_t, c_entries_t, c_values_t,
+                                       rowmap_t, entries_t, values_t, rowmap_t,
+                                       exec_space>(
+      numRows, numCols, input_mat.graph.row_map, input_mat.graph.entries,
+      input_mat.values, ref_rowmap, ref_entries, ref_values);
+  KokkosSparse::sort_crs_matrix<exec_space, rowmap_t, entries_t, values_t>(
+      ref_rowmap, ref_entries, ref_values);
+  // The output views are not initialized: fill them with garbage
+  rowmap_t t_rowmap("Rowmap^T", numCols + 1);
+  entries_t t_entries("Entries^T", input_mat.nnz());
+  values_t t_values("Values^T", input_mat.nnz());
+  Kokkos::deep_copy(t_rowmap, size_type(7));
+  Kokkos::deep_copy(t_entries, lno_t(-1));
+  if (doValues) {
+    KokkosSparse::Impl::sorted_transpose_matrix<c_rowmap_t, c_entries_t,
+                                                c_values_t, rowmap_t, entries_t,
+                                                values_t, exec_space>(
+        numRows, numCols, input_mat.graph.row_map, input_mat.graph.entries,
+        input_mat.values, t_rowmap, t_entries, t_values);
+  } else {
+    KokkosSparse::Impl::sorted_transpose_graph<c_rowmap_t, c_entries_t,
+                                               rowmap_t, entries_t, exec_space>(
+        numRows, numCols, input_mat.graph.row_map, input_mat.graph.entries,
+        t_rowmap, t_entries);
+  }
+  // Sorted without sort_crs_matrix, so identical to the reference
+  EXPECT_TRUE(KokkosSparse::isCrsGraphSorted(t_rowmap, t_entries));
+  size_type rowmapDiffs;
+  Kokkos::parallel_reduce(
+      range_pol(0, numCols + 1),
+      ExactCompare<size_type, rowmap_t>(ref_rowmap, t_rowmap), rowmapDiffs);
+  size_type entriesDiffs;
+  Kokkos::parallel_reduce(
+      range_pol(0, input_mat.nnz()),
+      ExactCompare<size_type, entries_t>(ref_entries, t_entries), entriesDiffs);
+  EXPECT_EQ(size_type(0), rowmapDiffs);
+  EXPECT_EQ(size_type(0), entriesDiffs);
+  if (doValues) {
+    size_type valuesDiffs;
+    Kokkos::parallel_reduce(
+        range_pol(0, input_mat.nnz()),
+        ExactCompare<size_type, values_t>(ref_values, t_values), valuesDiffs);
+    EXPECT_EQ(size_type(0), valuesDiffs);
+
+    // The CrsMatrix overload, and the transpose back
+    crsMat_t At  = KokkosSparse::Impl::sorted_transpose_matrix(input_mat);
+    crsMat_t Att = KokkosSparse::Impl::sorted_transpose_matrix(At);
+    KokkosSparse::sort_crs_matrix(input_mat);
+    Kokkos::parallel_reduce(
+        range_pol(0, input_mat.nnz()),
+        ExactCompare<size_type, c_entries_t>(input_mat.graph.entries,
+                                             Att.graph.entries),
+        entriesDiffs);
+    Kokkos::parallel_reduce(
+        range_pol(0, input_mat.nnz()),
+        ExactCompare<size_type, c_values_t>(input_mat.values, Att.values),
+        valuesDiffs);
+    EXPECT_EQ(size_type(0), entriesDiffs);
+    EXPECT_EQ(size_type(0), valuesDiffs);
+  }
+}
+
 template <class bsrMat_t>
 void CompareBsrMatrices(bsrMat_t& A, bsrMat_t& B) {
   using exec_space  = typename bsrMat_t::execution_space;
@@ -311,6 +396,16 @@ TEST_F(TestCategory, sparse_transpose_graph) {
   testTranspose<TestDevice>(2000, 2000, false);
 }
 
+TEST_F(TestCategory, sparse_sorted_transpose) {
+  testSortedTranspose<TestDevice>(100, 100, true);
+  testSortedTranspose<TestDevice>(500, 50, true);
+  testSortedTranspose<TestDevice>(50, 500, true);
+  testSortedTranspose<TestDevice>(2000, 4000, true);
+  testSortedTranspose<TestDevice>(500, 50, false);
+  testSortedTranspose<TestDevice>(50, 500, false);
+  testSortedTranspose<TestDevice>(2000, 2000, false);
+}
+
 TEST_F(TestCategory, sparse_transpose_bsr_matrix) {
   testTransposeBsrRef<TestDevice>();
   // Test bsrMatrix transpose with various sizes
@@ -23,6 +23,7 @@
 #include <Kokkos_Core.hpp>
 
 #include "KokkosSparse_Utils_cusparse.hpp"
+#include "KokkosKernels_tpl_handles_decl.hpp"
 
 void test_cusparse_safe_call() {
   bool caught_exception = false;
@@ -40,6 +41,30 @@ void test_cusparse_safe_call() {
   EXPECT_TRUE(caught_exception == true);
 }
 
+// Check that the handle cache gives each stream its own handle, bound to
+// that stream, and returns the same handle on every lookup
+void test_cusparse_stream_handle() {
+  using Singleton = KokkosKernels::Impl::CusparseSingleton;
+  auto instances  = Kokkos::Experimental::partition_space(Kokkos::Cuda(), 1, 1);
+  cudaStream_t s0 = instances[0].cuda_stream();
+  cudaStream_t s1 = instances[1].cuda_stream();
+
+  cusparseHandle_t h0 = Singleton::stream_handle(s0);
+  cusparseHandle_t h1 = Singleton::stream_handle(s1);
+  EXPECT_NE(h0, h1);
+  EXPECT_EQ(h0, Singleton::stream_handle(s0));
+  EXPECT_EQ(h1, Singleton::stream_handle(s1));
+
+  cudaStream_t bound;
+  KOKKOS_CUSPARSE_SAFE_CALL(cusparseGetStream(h0, &bound));
+  EXPECT_EQ(bound, s0);
+  KOKKOS_CUSPARSE_SAFE_CALL(cusparseGetStream(h1, &bound));
+  EXPECT_EQ(bound, s1);
+}
+
 TEST_F(TestCategory, sparse_cusparse_safe_call) { test_cusparse_safe_call(); }
+TEST_F(TestCategory, sparse_cusparse_stream_handle) {
+  test_cusparse_stream_handle();
+}
 
 #endif  // check for CUDA and cuSPARSE
@@ -0,0 +1,106 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+
+#include "KokkosBlas1_nrm2.hpp"
+#include "KokkosBlas1_axpby.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_IOUtils.hpp"
+#include "KokkosSparse_SortCrs.hpp"
+#include "KokkosSparse_spmv.hpp"
+#include "KokkosSparse_bicgstab.hpp"
+#include "KokkosSparse_ChebyshevPrec.hpp"
+#include "KokkosKernels_Handle.hpp"
+
+namespace Test {
+
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void run_test_bicgstab(const bool use_precond) {
+  using Crs = KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+
+  using exe_space      = typename device::execution_space;
+  using mem_space      = typename device::memory_space;
+  using mag_t          = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+  using ViewVectorType = Kokkos::View<scalar_t*, device>;
+  using KernelHandle   = KokkosKernels::Experimental::KokkosKernelsHandle<
+      size_type, lno_t, scalar_t, exe_space, mem_space, mem_space>;
+
+  const mag_t tol = std::is_same_v<mag_t, float> ? 1e-5 : 1e-8;
+
+  // A nonsymmetric, diagonally dominant matrix
+  constexpr lno_t n = 2000;
+  auto A = KokkosSparse::Impl::kk_generate_diagonally_dominant_sparse_matrix<
+      Crs>(n, n, size_type(10) * n, 0, lno_t(0.01 * n), 1);
+  KokkosSparse::sort_crs_matrix(A);
+
+  KernelHandle kh;
+  kh.create_bicgstab_handle(tol);
+  auto bicgstab_handle = kh.get_bicgstab_handle();
+  using BiCGStabHandle =
+      typename std::remove_reference<decltype(*bicgstab_handle)>::type;
+
+  ViewVectorType X("X", n);
+  ViewVectorType Wj("Wj", n);
+  ViewVectorType B(Kokkos::view_alloc(Kokkos::WithoutInitializing, "B"), n);
+  Kokkos::deep_copy(B, 1.0);
+
+  if (use_precond) {
+    KokkosSparse::Experimental::ChebyshevPrec<Crs> myPrec(A);
+    myPrec.compute();
+    KokkosSparse::Experimental::bicgstab(&kh, A, B, X, &myPrec);
+  } else {
+    KokkosSparse::Experimental::bicgstab(&kh, A, B, X);
+  }
+
+  // Double check residuals at end of solve:
+  mag_t nrmB = KokkosBlas::nrm2(B);
+  KokkosSparse::spmv("N", 1.0, A, X, 0.0, Wj);  // wj = Ax
+  KokkosBlas::axpy(-1.0, Wj, B);                // b = b-Ax.
+  mag_t endRes = KokkosBlas::nrm2(B) / nrmB;
+
+  EXPECT_EQ(bicgstab_handle->get_conv_flag_val(),
+            BiCGStabHandle::Flag::Conv);
+  EXPECT_LT(endRes, 10 * tol);
+
+  // The zero right-hand side has the zero solution
+  Kokkos::deep_copy(B, 0.0);
+  Kokkos::deep_copy(X, 1.0);
+  KokkosSparse::Experimental::bicgstab(&kh, A, B, X);
+  EXPECT_EQ(bicgstab_handle->get_num_iters(), 0);
+  EXPECT_EQ(KokkosBlas::nrm2(X), mag_t(0));
+}
+
+}  // namespace Test
+
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void test_bicgstab() {
+  Test::run_test_bicgstab<scalar_t, lno_t, size_type, device>(false);
+  Test::run_test_bicgstab<scalar_t, lno_t, size_type, device>(true);
+}
+
+#define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)          \
+  TEST_F(TestCategory,                                                       \
+         sparse##_##bicgstab##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    test_bicgstab<SCALAR, ORDINAL, OFFSET, DEVICE>();                        \
+  }
+
+#include <Test_Common_Test_All_Type_Combos.hpp>
+
+#undef KOKKOSKERNELS_EXECUTE_TEST
@@ -377,26 +377,114 @@ void test_block_gauss_seidel_empty() {
   }
 }
 
-#define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)               \
-  TEST_F(                                                                         \
-      TestCategory,                                                               \
-      sparse_bsr_gauss_seidel_rank1_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
-    test_block_gauss_seidel_rank1<KokkosSparse::SparseMatrixFormat::BSR,          \
-                                  SCALAR, ORDINAL, OFFSET, DEVICE>(               \
-        500, 500 * 10, 70, 3);                                                    \
-  }                                                                               \
-  TEST_F(                                                                         \
-      TestCategory,                                                               \
-      sparse_bsr_gauss_seidel_rank2_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
-    test_block_gauss_seidel_rank2<KokkosSparse::SparseMatrixFormat::BSR,          \
-                                  SCALAR, ORDINAL, OFFSET, DEVICE>(               \
-        500, 500 * 10, 70, 3);                                                    \
-  }                                                                               \
-  TEST_F(                                                                         \
-      TestCategory,                                                               \
-      sparse_bsr_gauss_seidel_empty_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
-    test_block_gauss_seidel_empty<KokkosSparse::SparseMatrixFormat::BSR,          \
-                                  SCALAR, ORDINAL, OFFSET, DEVICE>();             \
+// Gauss-Seidel through the BsrMatrix interface, with the inverses of the
+// dense 5x5 diagonal blocks
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void test_block_gauss_seidel_block_inverse(lno_t numRows, size_type nnz,
+                                           lno_t bandwidth,
+                                           lno_t row_size_variance) {
+  using namespace Test;
+  srand(245);
+  using crsMat_t = typename KokkosSparse::CrsMatrix<scalar_t, lno_t, device,
+                                                    void, size_type>;
+  using MatrixConverter = KokkosSparse::Impl::MatrixConverter<
+      KokkosSparse::SparseMatrixFormat::BSR>;
+  using graph_t        = typename crsMat_t::StaticCrsGraphType;
+  using scalar_view_t  = typename crsMat_t::values_type::non_const_type;
+  using lno_view_t     = typename graph_t::row_map_type::non_const_type;
+  using lno_nnz_view_t = typename graph_t::entries_type::non_const_type;
+  using mag_t          = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+  using KernelHandle   = KokkosKernels::Experimental::KokkosKernelsHandle<
+      size_type, lno_t, scalar_t, typename device::execution_space,
+      typename device::memory_space, typename device::memory_space>;
+
+  const GSTestParams<lno_t, scalar_t, mag_t> params;
+  const lno_t block_size = 5;
+
+  crsMat_t crsmat =
+      KokkosSparse::Impl::kk_generate_diagonally_dominant_sparse_matrix<
+          crsMat_t>(numRows, numRows, nnz, row_size_variance, bandwidth);
+  lno_view_t pf_rm;
+  lno_nnz_view_t pf_e;
+  scalar_view_t pf_v;
+  size_t out_r, out_c;
+  KokkosSparse::Impl::kk_create_bsr_formated_point_crsmatrix(
+      block_size, crsmat.numRows(), crsmat.numCols(), crsmat.graph.row_map,
+      crsmat.graph.entries, crsmat.values, out_r, out_c, pf_rm, pf_e, pf_v);
+  graph_t static_graph2(pf_e, pf_rm);
+  crsMat_t crsmat2("CrsMatrix2", out_c, pf_v, static_graph2);
+  auto input_mat =
+      MatrixConverter::from_bsr_formated_point_crsmatrix(crsmat2, block_size);
+
+  const lno_t nv =
+      ((crsmat2.numRows() + block_size - 1) / block_size) * block_size;
+  const scalar_view_t solution_x(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "X"), nv);
+  create_random_x_vector(solution_x);
+  typename device::execution_space().fence();
+  scalar_view_t y_vector = create_random_y_vector(crsmat2, solution_x);
+  const mag_t initial_norm_res = KokkosBlas::nrm2(solution_x);
+
+  for (const auto apply_type : params.apply_types) {
+    KernelHandle kh;
+    kh.create_gs_handle(KokkosSparse::GS_DEFAULT);
+    kh.get_point_gs_handle()->set_block_inverse_diagonal(true);
+    KSExp::gauss_seidel_symbolic(&kh, input_mat);
+    KSExp::gauss_seidel_numeric(&kh, input_mat);
+
+    scalar_view_t x_vector("x vector", nv);
+    switch (apply_type) {
+      case Test::forward_sweep:
+        KSExp::forward_sweep_gauss_seidel_apply(&kh, input_mat, x_vector,
+                                                y_vector, true, true,
+                                                params.omega, 100);
+        break;
+      case Test::backward_sweep:
+        KSExp::backward_sweep_gauss_seidel_apply(&kh, input_mat, x_vector,
+                                                 y_vector, true, true,
+                                                 params.omega, 100);
+        break;
+      case Test::symmetric:
+      default:
+        KSExp::symmetric_gauss_seidel_apply(&kh, input_mat, x_vector,
+                                            y_vector, true, true,
+                                            params.omega, 100);
+        break;
+    }
+    kh.destroy_gs_handle();
+
+    KokkosBlas::axpby(scalar_t(1), solution_x, scalar_t(-1), x_vector);
+    EXPECT_LT(KokkosBlas::nrm2(x_vector), params.tolerance * initial_norm_res);
+  }
+}
+
+#define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)                       \
+  TEST_F(                                                                                 \
+      TestCategory,                                                                       \
+      sparse_bsr_gauss_seidel_rank1_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) {         \
+    test_block_gauss_seidel_rank1<KokkosSparse::SparseMatrixFormat::BSR,                  \
+                                  SCALAR, ORDINAL, OFFSET, DEVICE>(                       \
+        500, 500 * 10, 70, 3);                                                            \
+  }                                                                                       \
+  TEST_F(                                                                                 \
+      TestCategory,                                                                       \
+      sparse_bsr_gauss_seidel_rank2_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) {         \
+    test_block_gauss_seidel_rank2<KokkosSparse::SparseMatrixFormat::BSR,                  \
+                                  SCALAR, ORDINAL, OFFSET, DEVICE>(                       \
+        500, 500 * 10, 70, 3);                                                            \
+  }                                                                                       \
+  TEST_F(                                                                                 \
+      TestCategory,                                                                       \
+      sparse_bsr_gauss_seidel_empty_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) {         \
+    test_block_gauss_seidel_empty<KokkosSparse::SparseMatrixFormat::BSR,                  \
+                                  SCALAR, ORDINAL, OFFSET, DEVICE>();                     \
+  }                                                                                       \
+  TEST_F(                                                                                 \
+      TestCategory,                                                                       \
+      sparse_bsr_gauss_seidel_block_inverse_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    test_block_gauss_seidel_block_inverse<SCALAR, ORDINAL, OFFSET, DEVICE>(               \
+        500, 500 * 10, 70, 3);                                                            \
   }
 
 #include <Test_Common_Test_All_Type_Combos.hpp>
@@ -31,8 +31,9 @@ template <typename bsrMat_t>
 int run_block_spgemm(const bsrMat_t A, const bsrMat_t B, bsrMat_t &C,
                      // parameters
                      KokkosSparse::SPGEMMAlgorithm spgemm_algorithm,
-                     bool use_dynamic_scheduling = true,
-                     size_t shmem_size           = 0) {
+                     bool use_dynamic_scheduling    = true,
+                     size_t shmem_size              = 0,
+                     SPGEMMTensorCores tensor_cores = SPGEMM_TC_NONE) {
   typedef typename bsrMat_t::size_type size_type;
   typedef typename bsrMat_t::ordinal_type lno_t;
   typedef typename bsrMat_t::value_type scalar_t;
@@ -49,6 +50,7 @@ int run_block_spgemm(const bsrMat_t A, const bsrMat_t B, bsrMat_t &C,
   kh.set_dynamic_scheduling(use_dynamic_scheduling);
 
   kh.create_spgemm_handle(spgemm_algorithm);
+  kh.get_spgemm_handle()->set_tensor_cores(tensor_cores);
 
   if (shmem_size > 0) {
     kh.set_shmem_size(shmem_size);
@@ -238,6 +240,15 @@ void test_bspgemm(lno_t blkDim, lno_t m, lno_t k, lno_t n, size_type nnz,
     // std::cout << "algo:" << algo << " spgemm_time:" << spgemm_time << "
     // output_check_time:" << timer1.seconds() << std::endl;
   }
+
+  // fp64 tensor cores where available, the default numeric phase elsewhere
+  {
+    bsrMat_t output_mat;
+    run_block_spgemm(A, B, output_mat, SPGEMM_KK, use_dynamic_scheduling,
+                     shared_memory_size, SPGEMM_TC_DOUBLE);
+    EXPECT_TRUE(is_same_block_matrix(output_mat, output_mat2))
+        << "SPGEMM_TC_DOUBLE";
+  }
   // device::execution_space::finalize();
 }
 
@@ -256,6 +267,9 @@ void test_bspgemm(lno_t blkDim, lno_t m, lno_t k, lno_t n, size_type nnz,
     test_case(2, 500, 500, 500, 32000, 500, 500, true, 16 * 1024);         \
     /* trigger dense dispatch in hash method */                            \
     test_case(2, 2, 3, 4, 2, 2, 0, true, 16 * 1024);                       \
+    /* blocks of one and several tensor core fragments */                  \
+    test_case(8, 50, 50, 50, 500, 50, 5, true, SHMEM_AUTO);                \
+    test_case(13, 30, 30, 30, 200, 30, 5, true, SHMEM_AUTO);               \
     /* zero-size handling */                                               \
     test_case(2, 0, 0, 0, 0, 10, 10, true, SHMEM_AUTO);                    \
     test_case(2, 0, 12, 5, 0, 10, 0, true, SHMEM_AUTO);                    \
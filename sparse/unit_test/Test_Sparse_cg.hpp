@@ -0,0 +1,131 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+
+#include "KokkosBlas1_nrm2.hpp"
+#include "KokkosBlas1_axpby.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_spmv.hpp"
+#include "KokkosSparse_cg.hpp"
+#include "KokkosSparse_ChebyshevPrec.hpp"
+#include "KokkosKernels_Handle.hpp"
+#include "KokkosKernels_Test_Structured_Matrix.hpp"
+
+namespace Test {
+
+// 2D Laplacian with Neumann boundaries, shifted by the identity so that it
+// is symmetric positive definite
+template <typename Crs>
+Crs cg_test_matrix(const typename Crs::ordinal_type nx) {
+  using lno_t    = typename Crs::ordinal_type;
+  using scalar_t = typename Crs::non_const_value_type;
+
+  Kokkos::View<lno_t * [3], Kokkos::HostSpace> mat_structure(
+      "Matrix Structure", 2);
+  mat_structure(0, 0) = nx;
+  mat_structure(1, 0) = nx;
+  auto A = Test::generate_structured_matrix2D<Crs>("FD", mat_structure);
+
+  auto rowmap    = A.graph.row_map;
+  auto entries   = A.graph.entries;
+  auto values    = A.values;
+  const auto one = Kokkos::ArithTraits<scalar_t>::one();
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<typename Crs::execution_space>(0, A.numRows()),
+      KOKKOS_LAMBDA(const lno_t i) {
+        for (auto k = rowmap(i); k < rowmap(i + 1); k++) {
+          if (entries(k) == i) values(k) += one;
+        }
+      });
+  return A;
+}
+
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void run_test_cg(const bool single_reduction, const bool use_precond,
+                 const bool graph_replay = false) {
+  using Crs = KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+
+  using exe_space      = typename device::execution_space;
+  using mem_space      = typename device::memory_space;
+  using mag_t          = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+  using ViewVectorType = Kokkos::View<scalar_t*, device>;
+  using KernelHandle   = KokkosKernels::Experimental::KokkosKernelsHandle<
+      size_type, lno_t, scalar_t, exe_space, mem_space, mem_space>;
+
+  const mag_t tol = std::is_same_v<mag_t, float> ? 1e-5 : 1e-8;
+
+  auto A        = cg_test_matrix<Crs>(40);
+  const lno_t n = A.numRows();
+
+  KernelHandle kh;
+  kh.create_cg_handle(tol);
+  auto cg_handle = kh.get_cg_handle();
+  using CGHandle = typename std::remove_reference<decltype(*cg_handle)>::type;
+  cg_handle->set_variant(single_reduction ? CGHandle::SingleReduction
+                                          : CGHandle::Standard);
+  cg_handle->set_graph_replay(graph_replay);
+
+  ViewVectorType X("X", n);
+  ViewVectorType Wj("Wj", n);
+  ViewVectorType B(Kokkos::view_alloc(Kokkos::WithoutInitializing, "B"), n);
+  Kokkos::deep_copy(B, 1.0);
+
+  if (use_precond) {
+    KokkosSparse::Experimental::ChebyshevPrec<Crs> myPrec(A);
+    myPrec.compute();
+    KokkosSparse::Experimental::cg(&kh, A, B, X, &myPrec);
+  } else {
+    KokkosSparse::Experimental::cg(&kh, A, B, X);
+  }
+
+  // Double check residuals at end of solve:
+  mag_t nrmB = KokkosBlas::nrm2(B);
+  KokkosSparse::spmv("N", 1.0, A, X, 0.0, Wj);  // wj = Ax
+  KokkosBlas::axpy(-1.0, Wj, B);                // b = b-Ax.
+  mag_t endRes = KokkosBlas::nrm2(B) / nrmB;
+
+  EXPECT_EQ(cg_handle->get_conv_flag_val(), CGHandle::Flag::Conv);
+  EXPECT_LT(endRes, 10 * tol);
+  EXPECT_LT(cg_handle->get_num_iters(), n);
+}
+
+}  // namespace Test
+
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void test_cg() {
+  for (bool single_reduction : {false, true}) {
+    for (bool use_precond : {false, true}) {
+      Test::run_test_cg<scalar_t, lno_t, size_type, device>(single_reduction,
+                                                            use_precond);
+    }
+  }
+  // Graph replay of the unpreconditioned single-reduction iteration
+  Test::run_test_cg<scalar_t, lno_t, size_type, device>(true, false, true);
+}
+
+#define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)    \
+  TEST_F(TestCategory,                                                 \
+         sparse##_##cg##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    test_cg<SCALAR, ORDINAL, OFFSET, DEVICE>();                        \
+  }
+
+#include <Test_Common_Test_All_Type_Combos.hpp>
+
+#undef KOKKOSKERNELS_EXECUTE_TEST
@@ -14,6 +14,10 @@
 //
 //@HEADER
 
+#include <random>
+#include <unordered_map>
+#include <vector>
+
 #include "KokkosSparse_coo2crs.hpp"
 #include "KokkosSparse_crs2coo.hpp"
 #include "KokkosKernels_TestUtils.hpp"
@@ -329,4 +333,72 @@ TEST_F(TestCategory, sparse_coo2crs_staticMatrix_edgeCases) {
   auto crsMatFsTs1 = KokkosSparse::coo2crs(m, n, row, col, data);
   check_crs_matrix(crsMatFsTs1, row_h, col_h, data);
 }
+
+// FE-assembly-like input: every entry of a banded pattern appears dups times,
+// in shuffled order, along with tuples with negative indices. Converted
+// through the CooMatrix overload; the result must have sorted, unique
+// columns in each row and match the reference.
+template <class ScalarType>
+void doCoo2CrsDuplicates(int64_t m, int64_t n, int dups) {
+  using CooType = KokkosSparse::CooMatrix<ScalarType, int64_t, TestDevice>;
+  using ats     = Kokkos::ArithTraits<ScalarType>;
+  std::vector<int64_t> rows, cols;
+  std::vector<ScalarType> vals;
+  std::mt19937 gen(m * 7 + n);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  for (int64_t i = 0; i < m; i++) {
+    const int64_t center = i * n / m;
+    for (int64_t j = center - 2; j <= center + 2; j++) {
+      if (j < 0 || j >= n) continue;
+      for (int d = 0; d < dups; d++) {
+        rows.push_back(i);
+        cols.push_back(j);
+        vals.push_back(ScalarType(dist(gen)));
+      }
+    }
+    rows.push_back(-i - 1);
+    cols.push_back(center);
+    vals.push_back(ats::one());
+  }
+  std::vector<size_t> perm(rows.size());
+  for (size_t k = 0; k < perm.size(); k++) perm[k] = k;
+  std::shuffle(perm.begin(), perm.end(), gen);
+
+  const size_t nt = rows.size();
+  typename CooType::row_view row("coo row", nt);
+  typename CooType::column_view col("coo col", nt);
+  typename CooType::scalar_view data("coo data", nt);
+  auto row_h  = Kokkos::create_mirror_view(row);
+  auto col_h  = Kokkos::create_mirror_view(col);
+  auto data_h = Kokkos::create_mirror_view(data);
+  for (size_t k = 0; k < nt; k++) {
+    row_h(k)  = rows[perm[k]];
+    col_h(k)  = cols[perm[k]];
+    data_h(k) = vals[perm[k]];
+  }
+  Kokkos::deep_copy(row, row_h);
+  Kokkos::deep_copy(col, col_h);
+  Kokkos::deep_copy(data, data_h);
+
+  CooType cooMat(m, n, row, col, data);
+  auto crsMat = KokkosSparse::coo2crs(cooMat);
+  check_crs_matrix(crsMat, row_h, col_h, data_h);
+
+  auto row_map = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                     crsMat.graph.row_map);
+  auto entries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                     crsMat.graph.entries);
+  for (int64_t i = 0; i < m; i++) {
+    for (auto k = row_map(i) + 1; k < row_map(i + 1); k++) {
+      ASSERT_LT(entries(k - 1), entries(k)) << "row " << i;
+    }
+  }
+}
+
+TEST_F(TestCategory, sparse_coo2crs_duplicates) {
+  doCoo2CrsDuplicates<float>(100, 100, 27);
+  doCoo2CrsDuplicates<double>(300, 200, 27);
+  doCoo2CrsDuplicates<Kokkos::complex<float>>(50, 80, 27);
+  doCoo2CrsDuplicates<Kokkos::complex<double>>(200, 300, 1);
+}
 }  // namespace Test
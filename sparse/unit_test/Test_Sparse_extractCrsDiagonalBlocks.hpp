@@ -18,8 +18,94 @@
 #include "KokkosSparse_spmv.hpp"
 #include "KokkosBlas1_nrm2.hpp"
 #include "KokkosKernels_TestUtils.hpp"
+// For Test::is_same_matrix
+#include "Test_Sparse_Utils.hpp"
 
 namespace Test {
+// A is the tridiagonal matrix of run_test_extract_diagonal_blocks, whose
+// values are their global column indices
+template <typename crsMat_t>
+void check_extract_subdomains(const crsMat_t &A,
+                              const std::vector<crsMat_t> &DiagBlks) {
+  using lno_t     = typename crsMat_t::non_const_ordinal_type;
+  using size_type = typename crsMat_t::non_const_size_type;
+  using scalar_t  = typename crsMat_t::non_const_value_type;
+  using rows_t    = typename crsMat_t::index_type::non_const_type;
+
+  const lno_t nrows = A.numRows();
+  const int nblocks = DiagBlks.size();
+
+  // Without overlap, the subdomains are the diagonal blocks
+  std::vector<crsMat_t> Subs(nblocks);
+  KokkosSparse::Impl::kk_extract_overlapping_subdomains_crsmatrix(A, Subs, 0);
+  for (int i = 0; i < nblocks; i++) {
+    bool same = Test::is_same_matrix<crsMat_t, typename crsMat_t::device_type>(
+        Subs[i], DiagBlks[i]);
+    EXPECT_TRUE(same) << "block " << i;
+  }
+  if (nrows == 0) return;
+
+  // With 2 levels of overlap, each block gains 2 rows on each side
+  constexpr lno_t overlap = 2;
+  auto rows_v = KokkosSparse::Impl::kk_extract_overlapping_subdomains_crsmatrix(
+      A, Subs, overlap);
+  lno_t blk_start = 0;
+  for (int i = 0; i < nblocks; i++) {
+    const lno_t first = Kokkos::max(blk_start - overlap, lno_t(0));
+    const lno_t last =
+        Kokkos::min(blk_start + DiagBlks[i].numRows() + overlap, nrows) - 1;
+    blk_start += DiagBlks[i].numRows();
+    auto rows_h =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), rows_v[i]);
+    ASSERT_EQ(lno_t(rows_h.extent(0)), last - first + 1);
+    for (lno_t j = 0; j <= last - first; j++) EXPECT_EQ(rows_h(j), first + j);
+
+    auto rowmap_h = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), Subs[i].graph.row_map);
+    auto entries_h = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), Subs[i].graph.entries);
+    auto values_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                        Subs[i].values);
+    for (lno_t j = 0; j <= last - first; j++) {
+      const lno_t len = rowmap_h(j + 1) - rowmap_h(j);
+      EXPECT_EQ(len, 3 - lno_t(j == 0) - lno_t(j == last - first));
+      for (size_type k = rowmap_h(j); k < rowmap_h(j + 1); k++)
+        EXPECT_EQ(values_h(k), scalar_t(rows_h(entries_h(k))));
+    }
+  }
+
+  // Rows in reverse order and the even columns in descending order
+  const lno_t ncols = (nrows + 1) / 2;
+  rows_t rows("rows", nrows), cols("cols", ncols);
+  auto rows_h = Kokkos::create_mirror_view(rows);
+  auto cols_h = Kokkos::create_mirror_view(cols);
+  for (lno_t j = 0; j < nrows; j++) rows_h(j) = nrows - 1 - j;
+  for (lno_t j = 0; j < ncols; j++) cols_h(j) = 2 * (ncols - 1 - j);
+  Kokkos::deep_copy(rows, rows_h);
+  Kokkos::deep_copy(cols, cols_h);
+  crsMat_t S =
+      KokkosSparse::Impl::kk_extract_submatrix_crsmatrix(A, rows, cols);
+  EXPECT_EQ(S.numRows(), nrows);
+  EXPECT_EQ(S.numCols(), ncols);
+  auto rowmap_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                      S.graph.row_map);
+  auto entries_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                       S.graph.entries);
+  auto values_h =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), S.values);
+  for (lno_t j = 0; j < nrows; j++) {
+    // An odd row keeps its two even neighbors, an even row its diagonal
+    const lno_t r   = rows_h(j);
+    const lno_t len = rowmap_h(j + 1) - rowmap_h(j);
+    EXPECT_EQ(len, (r % 2) ? 1 + lno_t(r + 1 < nrows) : 1);
+    for (size_type k = rowmap_h(j); k < rowmap_h(j + 1); k++) {
+      const lno_t c = cols_h(entries_h(k));
+      EXPECT_LE(Kokkos::abs(c - r), 1);
+      EXPECT_EQ(values_h(k), scalar_t(c));
+    }
+  }
+}
+
 template <typename scalar_t, typename lno_t, typename size_type,
           typename device>
 void run_test_extract_diagonal_blocks(int nrows, int nblocks) {
@@ -167,6 +253,8 @@ void run_test_extract_diagonal_blocks(int nrows, int nblocks) {
       }
     }
   }
+
+  check_extract_subdomains(A, DiagBlks);
 }
 }  // namespace Test
 
@@ -248,6 +248,10 @@ void test_gauss_seidel_rank1(lno_t numRows, size_type nnz, lno_t bandwidth,
   int clusterSizes[3]                              = {2, 5, 34};
   std::vector<ClusteringAlgorithm> clusteringAlgos = {CLUSTER_MIS2,
                                                       CLUSTER_BALLOON};
+#if !defined(KOKKOS_ENABLE_CUDA) || defined(KOKKOS_ENABLE_CUDA_LAMBDA)
+  clusteringAlgos.push_back(CLUSTER_HEC);
+  clusteringAlgos.push_back(CLUSTER_MATCH);
+#endif
   for (int csize = 0; csize < 3; csize++) {
     for (auto clusterAlgo : clusteringAlgos) {
       for (int apply_type = 0; apply_type < apply_count; ++apply_type) {
@@ -660,14 +664,19 @@ void test_gauss_seidel_long_rows(lno_t numRows, lno_t numLongRows,
         typename device::memory_space, typename device::memory_space>
         KernelHandle;
 
+    // The long-row symbolic phase draws its temporaries from the workspace
+    typename KernelHandle::GaussSeidelHandleType::workspace_t workspace;
     KernelHandle kh;
     kh.create_gs_handle(GS_DEFAULT);
     auto gsHandle = kh.get_point_gs_handle();
     gsHandle->set_long_row_threshold(3 * nnzPerShortRow);
+    gsHandle->set_workspace(&workspace);
     // Reset x vector to 0
     Kokkos::deep_copy(x_vector, scalar_t());
     run_gauss_seidel(kh, input_mat, x_vector, y_vector, symmetric, 0.9,
                      apply_type);
+    EXPECT_GT(workspace.high_water_mark(), size_t(0));
+    EXPECT_EQ(workspace.bytes_in_use(), size_t(0));
     KokkosBlas::axpby(one, solution_x, -one, x_vector);
     mag_t result_norm_res = KokkosBlas::nrm2(x_vector);
     EXPECT_LT(result_norm_res, 0.25 * initial_norm_res);
@@ -715,6 +724,113 @@ void test_gauss_seidel_custom_coloring(lno_t numRows, lno_t nnzPerRow) {
   EXPECT_LT(result_norm_res, 0.25 * initial_norm_res);
 }
 
+// A second handle given the colors of a first one on the same graph skips
+// the coloring and gives the same result
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void test_gauss_seidel_reuse_coloring(lno_t numRows, lno_t nnzPerRow) {
+  using namespace Test;
+  typedef
+      typename KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>
+          crsMat_t;
+  typedef typename crsMat_t::values_type::non_const_type scalar_view_t;
+  typedef typename Kokkos::ArithTraits<scalar_t>::mag_type mag_t;
+  typedef KokkosKernelsHandle<
+      size_type, lno_t, scalar_t, typename device::execution_space,
+      typename device::memory_space, typename device::memory_space>
+      KernelHandle;
+  const scalar_t one = Kokkos::ArithTraits<scalar_t>::one();
+  size_type nnz      = nnzPerRow * numRows;
+  crsMat_t input_mat =
+      KokkosSparse::Impl::kk_generate_diagonally_dominant_sparse_matrix<
+          crsMat_t>(numRows, numRows, nnz, 0, numRows / 10, 2.0 * one);
+  input_mat =
+      Test::symmetrize<scalar_t, lno_t, size_type, device, crsMat_t>(input_mat);
+  input_mat = KokkosSparse::sort_and_merge_matrix(input_mat);
+  scalar_view_t solution_x(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "X (correct)"), numRows);
+  create_random_x_vector(solution_x);
+  scalar_view_t y_vector = create_random_y_vector(input_mat, solution_x);
+  const mag_t tol        = 10 * Kokkos::ArithTraits<mag_t>::epsilon();
+
+  for (const bool cluster : {false, true}) {
+    KernelHandle kh1, kh2;
+    for (KernelHandle *kh : {&kh1, &kh2}) {
+      if (cluster)
+        kh->create_gs_handle(CLUSTER_DEFAULT, 10);
+      else
+        kh->create_gs_handle(GS_DEFAULT);
+    }
+    scalar_view_t x1("x1", numRows), x2("x2", numRows);
+    run_gauss_seidel(kh1, input_mat, x1, y_vector, true, 0.9, 0);
+    auto colors         = kh1.get_gs_handle()->get_vertex_colors();
+    const lno_t nColors  = kh1.get_gs_handle()->get_num_colors();
+    kh2.get_gs_handle()->set_vertex_colors(colors, nColors);
+    run_gauss_seidel(kh2, input_mat, x2, y_vector, true, 0.9, 0);
+    EXPECT_EQ(kh2.get_gs_handle()->get_vertex_colors().data(), colors.data());
+    EXPECT_EQ(kh2.get_gs_handle()->get_num_colors(), nColors);
+    EXPECT_NEAR_KK_1DVIEW(x1, x2, tol);
+    kh1.destroy_gs_handle();
+    kh2.destroy_gs_handle();
+  }
+}
+
+// Two-stage GS with an inner tolerance stops the inner sweeps early, while
+// a zero tolerance runs the fixed number of inner sweeps
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void test_gauss_seidel_twostage_inner_tolerance(lno_t numRows,
+                                                lno_t nnzPerRow) {
+  using namespace Test;
+  typedef
+      typename KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>
+          crsMat_t;
+  typedef typename crsMat_t::values_type::non_const_type scalar_view_t;
+  typedef typename Kokkos::ArithTraits<scalar_t>::mag_type mag_t;
+  typedef KokkosKernelsHandle<
+      size_type, lno_t, scalar_t, typename device::execution_space,
+      typename device::memory_space, typename device::memory_space>
+      KernelHandle;
+  const scalar_t one = Kokkos::ArithTraits<scalar_t>::one();
+  size_type nnz      = nnzPerRow * numRows;
+  crsMat_t input_mat =
+      KokkosSparse::Impl::kk_generate_diagonally_dominant_sparse_matrix<
+          crsMat_t>(numRows, numRows, nnz, 0, numRows / 10, 2.0 * one);
+  input_mat =
+      Test::symmetrize<scalar_t, lno_t, size_type, device, crsMat_t>(input_mat);
+  input_mat = KokkosSparse::sort_and_merge_matrix(input_mat);
+  scalar_view_t solution_x(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "X (correct)"), numRows);
+  create_random_x_vector(solution_x);
+  mag_t initial_norm_res = KokkosBlas::nrm2(solution_x);
+  scalar_view_t y_vector = create_random_y_vector(input_mat, solution_x);
+
+  // symmetric apply with two iterations, i.e., four outer sweeps
+  const int maxInnerSweeps = 30;
+  const int numOuterSweeps = 4;
+  for (const mag_t inner_tol : {mag_t(0), mag_t(1e-3)}) {
+    KernelHandle kh;
+    kh.create_gs_handle(GS_TWOSTAGE);
+    kh.set_gs_twostage(true, input_mat.numRows());
+    kh.set_gs_set_num_inner_sweeps(maxInnerSweeps);
+    kh.set_gs_set_inner_tolerance(inner_tol);
+    scalar_view_t x_vector("x vector", numRows);
+    run_gauss_seidel(kh, input_mat, x_vector, y_vector, true, one, 0);
+    const int performed =
+        kh.get_twostage_gs_handle()->getNumInnerSweepsPerformed();
+    if (inner_tol == mag_t(0)) {
+      EXPECT_EQ(performed, numOuterSweeps * maxInnerSweeps);
+    } else {
+      EXPECT_GE(performed, numOuterSweeps);
+      EXPECT_LT(performed, numOuterSweeps * maxInnerSweeps);
+    }
+    KokkosBlas::axpby(one, solution_x, -one, x_vector);
+    mag_t result_norm_res = KokkosBlas::nrm2(x_vector);
+    EXPECT_LT(result_norm_res, initial_norm_res);
+    kh.destroy_gs_handle();
+  }
+}
+
 template <typename scalar_t, typename lno_t, typename size_type,
           typename device>
 void test_gauss_seidel_streams_rank1(
@@ -901,6 +1017,17 @@ void test_gauss_seidel_streams_rank1(
       sparse##_##gauss_seidel_custom_coloring##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) {          \
     test_gauss_seidel_custom_coloring<SCALAR, ORDINAL, OFFSET, DEVICE>(500,                            \
                                                                        10);                            \
+  }                                                                                                    \
+  TEST_F(                                                                                              \
+      TestCategory,                                                                                    \
+      sparse##_##gauss_seidel_reuse_coloring##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) {           \
+    test_gauss_seidel_reuse_coloring<SCALAR, ORDINAL, OFFSET, DEVICE>(500, 10);                        \
+  }                                                                                                    \
+  TEST_F(                                                                                              \
+      TestCategory,                                                                                    \
+      sparse##_##gauss_seidel_twostage_inner_tolerance##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    test_gauss_seidel_twostage_inner_tolerance<SCALAR, ORDINAL, OFFSET,                                \
+                                               DEVICE>(500, 10);                                       \
   }
 
 #include <Test_Common_Test_All_Type_Combos.hpp>
@@ -27,7 +27,15 @@
 #include "KokkosBlas1_nrm2.hpp"
 #include "KokkosSparse_spmv.hpp"
 #include "KokkosSparse_gmres.hpp"
+#include "KokkosSparse_gmres_ir.hpp"
 #include "KokkosSparse_MatrixPrec.hpp"
+#include "KokkosSparse_ChebyshevPrec.hpp"
+#include "KokkosSparse_AMGPrec.hpp"
+#include "KokkosSparse_BlockJacobiPrec.hpp"
+#include "KokkosSparse_SchwarzPrec.hpp"
+#include "KokkosSparse_PolynomialPrec.hpp"
+#include "KokkosSparse_GMRESPrec.hpp"
+#include "KokkosKernels_Test_Structured_Matrix.hpp"
 
 #include <gtest/gtest.h>
 
@@ -77,6 +85,63 @@ AType get_A(int n, int diagDominance, int block_size) {
   return A;
 }
 
+// Matrix-free nonsymmetric tridiagonal stencil
+// y_i = 4 x_i - x_{i-1} - 2 x_{i+1}, for the operator overload of gmres
+template <typename scalar_t, typename device>
+struct StencilOperator {
+  using exe_space = typename device::execution_space;
+
+  int n;
+
+  void apply(const Kokkos::View<const scalar_t*, device>& x,
+             const Kokkos::View<scalar_t*, device>& y) const {
+    const int nrows = n;
+    Kokkos::parallel_for(
+        "StencilOperator::apply", Kokkos::RangePolicy<exe_space>(0, nrows),
+        KOKKOS_LAMBDA(const int i) {
+          scalar_t sum = scalar_t(4) * x(i);
+          if (i > 0) sum -= x(i - 1);
+          if (i + 1 < nrows) sum -= scalar_t(2) * x(i + 1);
+          y(i) = sum;
+        });
+  }
+
+  // The same stencil assembled as a CrsMatrix
+  template <typename Crs>
+  Crs assemble() const {
+    using size_type = typename Crs::non_const_size_type;
+    using lno_t     = typename Crs::non_const_ordinal_type;
+    typename Crs::row_map_type::non_const_type rowmap("rowmap", n + 1);
+    typename Crs::index_type::non_const_type entries("entries", 3 * n - 2);
+    typename Crs::values_type::non_const_type values("values", 3 * n - 2);
+    auto rowmap_h  = Kokkos::create_mirror_view(rowmap);
+    auto entries_h = Kokkos::create_mirror_view(entries);
+    auto values_h  = Kokkos::create_mirror_view(values);
+    size_type k    = 0;
+    for (int i = 0; i < n; i++) {
+      rowmap_h(i) = k;
+      if (i > 0) {
+        entries_h(k) = lno_t(i - 1);
+        values_h(k)  = scalar_t(-1);
+        k++;
+      }
+      entries_h(k) = lno_t(i);
+      values_h(k)  = scalar_t(4);
+      k++;
+      if (i + 1 < n) {
+        entries_h(k) = lno_t(i + 1);
+        values_h(k)  = scalar_t(-2);
+        k++;
+      }
+    }
+    rowmap_h(n) = k;
+    Kokkos::deep_copy(rowmap, rowmap_h);
+    Kokkos::deep_copy(entries, entries_h);
+    Kokkos::deep_copy(values, values_h);
+    return Crs("stencil", n, n, k, values, rowmap, entries);
+  }
+};
+
 template <typename scalar_t, typename lno_t, typename size_type,
           typename device>
 struct GmresTest {
@@ -170,6 +235,88 @@ struct GmresTest {
       EXPECT_EQ(conv_flag, GMRESHandle::Flag::Conv);
     }
 
+    // Test pipelined GMRES
+    {
+      gmres_handle->reset_handle(m, tol);
+      gmres_handle->set_ortho(GMRESHandle::Ortho::PIPELINED);
+      gmres_handle->set_verbose(verbose);
+
+      // reset X for next gmres call
+      Kokkos::deep_copy(X, 0.0);
+
+      gmres(&kh, A, B, X);
+
+      // Double check residuals at end of solve:
+      float_t nrmB = KokkosBlas::nrm2(B);
+      KokkosSparse::spmv("N", 1.0, A, X, 0.0, Wj);  // wj = Ax
+      KokkosBlas::axpy(-1.0, Wj, B);                // b = b-Ax.
+      float_t endRes = KokkosBlas::nrm2(B) / nrmB;
+
+      const auto conv_flag = gmres_handle->get_conv_flag_val();
+
+      EXPECT_LT(endRes, gmres_handle->get_tol());
+      EXPECT_EQ(conv_flag, GMRESHandle::Flag::Conv);
+    }
+
+    // Test s-step GMRES
+    {
+      gmres_handle->reset_handle(m, tol);
+      gmres_handle->set_ortho(GMRESHandle::Ortho::SSTEP);
+      gmres_handle->set_s_step(3);
+      gmres_handle->set_verbose(verbose);
+
+      // reset X for next gmres call
+      Kokkos::deep_copy(X, 0.0);
+
+      gmres(&kh, A, B, X);
+
+      // Double check residuals at end of solve:
+      float_t nrmB = KokkosBlas::nrm2(B);
+      KokkosSparse::spmv("N", 1.0, A, X, 0.0, Wj);  // wj = Ax
+      KokkosBlas::axpy(-1.0, Wj, B);                // b = b-Ax.
+      float_t endRes = KokkosBlas::nrm2(B) / nrmB;
+
+      const auto conv_flag = gmres_handle->get_conv_flag_val();
+
+      EXPECT_LT(endRes, gmres_handle->get_tol());
+      EXPECT_EQ(conv_flag, GMRESHandle::Flag::Conv);
+
+      // m must be a multiple of s
+      gmres_handle->set_s_step(4);
+      EXPECT_THROW(gmres(&kh, A, B, X), std::invalid_argument);
+    }
+
+    // Test GMRES on an execution space instance, with the residual checked
+    // every 4 iterations
+    {
+      gmres_handle->reset_handle(m, tol);
+      gmres_handle->set_check_interval(4);
+      gmres_handle->set_verbose(verbose);
+
+      auto instances =
+          Kokkos::Experimental::partition_space(exe_space(), 1, 1);
+
+      // reset X for next gmres call
+      Kokkos::deep_copy(X, 0.0);
+
+      gmres(instances[1], &kh, A, B, X);
+
+      // Double check residuals at end of solve:
+      float_t nrmB = KokkosBlas::nrm2(B);
+      KokkosSparse::spmv("N", 1.0, A, X, 0.0, Wj);  // wj = Ax
+      KokkosBlas::axpy(-1.0, Wj, B);                // b = b-Ax.
+      float_t endRes = KokkosBlas::nrm2(B) / nrmB;
+
+      const auto conv_flag = gmres_handle->get_conv_flag_val();
+
+      EXPECT_LT(endRes, gmres_handle->get_tol());
+      EXPECT_EQ(conv_flag, GMRESHandle::Flag::Conv);
+
+      // Only CGS2 is supported there
+      gmres_handle->set_ortho(GMRESHandle::Ortho::MGS);
+      EXPECT_THROW(gmres(instances[1], &kh, A, B, X), std::invalid_argument);
+    }
+
     // Test GSS2 with simple preconditioner
     {
       gmres_handle->reset_handle(m, tol);
@@ -194,6 +341,400 @@ struct GmresTest {
       EXPECT_LT(endRes, gmres_handle->get_tol());
       EXPECT_EQ(conv_flag, GMRESHandle::Flag::Conv);
     }
+
+    // Test CGS2 with Chebyshev preconditioner
+    if constexpr (!UseBlocks) {
+      gmres_handle->reset_handle(m, tol);
+      gmres_handle->set_verbose(verbose);
+
+      // Make precond
+      KokkosSparse::Experimental::ChebyshevPrec<sp_matrix_type> myPrec(A);
+      myPrec.compute();
+      EXPECT_TRUE(myPrec.isComputed());
+      EXPECT_GT(myPrec.getLambdaMax(), float_t(0));
+
+      // reset X for next gmres call
+      Kokkos::deep_copy(X, 0.0);
+
+      gmres(&kh, A, B, X, &myPrec);
+
+      // Double check residuals at end of solve:
+      float_t nrmB = KokkosBlas::nrm2(B);
+      KokkosSparse::spmv("N", 1.0, A, X, 0.0, Wj);  // wj = Ax
+      KokkosBlas::axpy(-1.0, Wj, B);                // b = b-Ax.
+      float_t endRes = KokkosBlas::nrm2(B) / nrmB;
+
+      const auto conv_flag = gmres_handle->get_conv_flag_val();
+
+      EXPECT_LT(endRes, gmres_handle->get_tol());
+      EXPECT_EQ(conv_flag, GMRESHandle::Flag::Conv);
+    }
+
+    // Test CGS2 with block Jacobi preconditioner
+    if constexpr (!UseBlocks) {
+      gmres_handle->reset_handle(m, tol);
+      gmres_handle->set_verbose(verbose);
+
+      // Make precond, with a smaller last block
+      KokkosSparse::Experimental::BlockJacobiPrec<sp_matrix_type> myPrec(A, 7);
+      myPrec.compute();
+      EXPECT_TRUE(myPrec.isComputed());
+
+      // reset X for next gmres call
+      Kokkos::deep_copy(X, 0.0);
+
+      gmres(&kh, A, B, X, &myPrec);
+
+      // Double check residuals at end of solve:
+      float_t nrmB = KokkosBlas::nrm2(B);
+      KokkosSparse::spmv("N", 1.0, A, X, 0.0, Wj);  // wj = Ax
+      KokkosBlas::axpy(-1.0, Wj, B);                // b = b-Ax.
+      float_t endRes = KokkosBlas::nrm2(B) / nrmB;
+
+      const auto conv_flag = gmres_handle->get_conv_flag_val();
+
+      EXPECT_LT(endRes, gmres_handle->get_tol());
+      EXPECT_EQ(conv_flag, GMRESHandle::Flag::Conv);
+
+      // Refresh after the values of A changed: (2 A)^-1 blocks are halved
+      ViewVectorType Y1("Y1", n), Y2("Y2", n);
+      Kokkos::deep_copy(B, 1.0);
+      myPrec.apply(B, Y1);
+      KokkosBlas::scal(A.values, 2.0, A.values);
+      myPrec.compute();
+      myPrec.apply(B, Y2);
+      KokkosBlas::scal(A.values, 0.5, A.values);
+      KokkosBlas::axpy(-2.0, Y2, Y1);
+      EXPECT_LT(KokkosBlas::nrm2(Y1), 10 * tol * KokkosBlas::nrm2(Y2));
+    }
+
+    // Test CGS2 with additive Schwarz preconditioner
+    if constexpr (!UseBlocks) {
+      gmres_handle->reset_handle(m, tol);
+      gmres_handle->set_verbose(verbose);
+
+      // Make precond: 50 blocks grown by one level of overlap
+      KokkosSparse::Experimental::SchwarzPrec<sp_matrix_type> myPrec(A, 50, 1);
+      myPrec.compute();
+      EXPECT_TRUE(myPrec.isInitialized());
+      EXPECT_TRUE(myPrec.isComputed());
+      EXPECT_GT(myPrec.getMaxSubdomainSize(), n / 50);
+
+      // reset X for next gmres call
+      Kokkos::deep_copy(X, 0.0);
+
+      gmres(&kh, A, B, X, &myPrec);
+
+      // Double check residuals at end of solve:
+      float_t nrmB = KokkosBlas::nrm2(B);
+      KokkosSparse::spmv("N", 1.0, A, X, 0.0, Wj);  // wj = Ax
+      KokkosBlas::axpy(-1.0, Wj, B);                // b = b-Ax.
+      float_t endRes = KokkosBlas::nrm2(B) / nrmB;
+
+      const auto conv_flag = gmres_handle->get_conv_flag_val();
+
+      EXPECT_LT(endRes, gmres_handle->get_tol());
+      EXPECT_EQ(conv_flag, GMRESHandle::Flag::Conv);
+
+      // The same blocks given as parts, numbered backwards
+      using parts_t = Kokkos::View<lno_t*, device>;
+      parts_t parts("parts", n);
+      Kokkos::parallel_for(
+          Kokkos::RangePolicy<exe_space>(0, n),
+          KOKKOS_LAMBDA(const lno_t i) { parts(i) = 49 - i / 100; });
+      KokkosSparse::Experimental::SchwarzPrec<sp_matrix_type> partsPrec(
+          A, parts, 50, 1);
+      partsPrec.compute();
+      EXPECT_EQ(partsPrec.getMaxSubdomainSize(), myPrec.getMaxSubdomainSize());
+      ViewVectorType Y1("Y1", n), Y2("Y2", n);
+      Kokkos::deep_copy(B, 1.0);
+      myPrec.apply(B, Y1);
+      partsPrec.apply(B, Y2);
+      KokkosBlas::axpy(-1.0, Y2, Y1);
+      EXPECT_LT(KokkosBlas::nrm2(Y1), 10 * tol * KokkosBlas::nrm2(Y2));
+
+      // Without overlap, contiguous subdomains of 7 rows are block Jacobi
+      KokkosSparse::Experimental::SchwarzPrec<sp_matrix_type> noOverlap(
+          A, (n + 6) / 7, 0);
+      noOverlap.compute();
+      KokkosSparse::Experimental::BlockJacobiPrec<sp_matrix_type> jacobi(A, 7);
+      jacobi.compute();
+      noOverlap.apply(B, Y1);
+      jacobi.apply(B, Y2);
+      KokkosBlas::axpy(-1.0, Y2, Y1);
+      EXPECT_LT(KokkosBlas::nrm2(Y1), 10 * tol * KokkosBlas::nrm2(Y2));
+    }
+
+    // Test CGS2 with GMRES polynomial preconditioner
+    if constexpr (!UseBlocks && !AT::is_complex) {
+      gmres_handle->reset_handle(m, tol);
+      gmres_handle->set_verbose(verbose);
+
+      // Make precond
+      KokkosSparse::Experimental::PolynomialPrec<sp_matrix_type> myPrec(A, 6);
+      myPrec.compute();
+      EXPECT_TRUE(myPrec.isComputed());
+      EXPECT_GE(myPrec.getDegree(), 1);
+      EXPECT_LE(myPrec.getDegree(), 6);
+
+      // reset X for next gmres call
+      Kokkos::deep_copy(X, 0.0);
+
+      gmres(&kh, A, B, X, &myPrec);
+
+      // Double check residuals at end of solve:
+      float_t nrmB = KokkosBlas::nrm2(B);
+      KokkosSparse::spmv("N", 1.0, A, X, 0.0, Wj);  // wj = Ax
+      KokkosBlas::axpy(-1.0, Wj, B);                // b = b-Ax.
+      float_t endRes = KokkosBlas::nrm2(B) / nrmB;
+
+      const auto conv_flag = gmres_handle->get_conv_flag_val();
+
+      EXPECT_LT(endRes, gmres_handle->get_tol());
+      EXPECT_EQ(conv_flag, GMRESHandle::Flag::Conv);
+    }
+
+    // Test flexible GMRES with an inner GMRES preconditioner
+    if constexpr (!UseBlocks) {
+      gmres_handle->reset_handle(m, tol);
+      gmres_handle->set_flexible(true);
+      gmres_handle->set_verbose(verbose);
+
+      // Make precond: a few loose inner iterations
+      KokkosSparse::Experimental::GMRESPrec<sp_matrix_type> myPrec(A, 5);
+      myPrec.getInnerHandle()->set_verbose(verbose);
+
+      // reset X for next gmres call
+      Kokkos::deep_copy(X, 0.0);
+
+      gmres(&kh, A, B, X, &myPrec);
+
+      // Double check residuals at end of solve:
+      float_t nrmB = KokkosBlas::nrm2(B);
+      KokkosSparse::spmv("N", 1.0, A, X, 0.0, Wj);  // wj = Ax
+      KokkosBlas::axpy(-1.0, Wj, B);                // b = b-Ax.
+      float_t endRes = KokkosBlas::nrm2(B) / nrmB;
+
+      const auto conv_flag = gmres_handle->get_conv_flag_val();
+
+      EXPECT_LT(endRes, gmres_handle->get_tol());
+      EXPECT_EQ(conv_flag, GMRESHandle::Flag::Conv);
+
+      // Flexible GMRES only supports CGS2 and MGS
+      gmres_handle->set_ortho(GMRESHandle::Ortho::PIPELINED);
+      EXPECT_THROW(gmres(&kh, A, B, X, &myPrec), std::invalid_argument);
+    }
+
+    // Test CGS2 drawing its temporaries from a workspace: only the first
+    // solve allocates
+    if constexpr (!UseBlocks) {
+      gmres_handle->reset_handle(m, tol);
+      gmres_handle->set_verbose(verbose);
+      typename GMRESHandle::workspace_t workspace;
+      gmres_handle->set_workspace(&workspace);
+
+      size_t num_allocations = 0;
+      for (int solve = 0; solve < 3; solve++) {
+        Kokkos::deep_copy(B, 1.0);
+        Kokkos::deep_copy(X, 0.0);
+        gmres(&kh, A, B, X);
+
+        // Double check residuals at end of solve:
+        float_t nrmB = KokkosBlas::nrm2(B);
+        KokkosSparse::spmv("N", 1.0, A, X, 0.0, Wj);  // wj = Ax
+        KokkosBlas::axpy(-1.0, Wj, B);                // b = b-Ax.
+        float_t endRes = KokkosBlas::nrm2(B) / nrmB;
+
+        EXPECT_LT(endRes, gmres_handle->get_tol());
+        EXPECT_EQ(gmres_handle->get_conv_flag_val(), GMRESHandle::Flag::Conv);
+        if (solve == 0) num_allocations = workspace.num_allocations();
+        EXPECT_EQ(workspace.num_allocations(), num_allocations);
+      }
+      EXPECT_EQ(workspace.bytes_in_use(), size_t(0));
+      EXPECT_GE(workspace.capacity(), n * (m + 1) * sizeof(scalar_t));
+
+      // And so does GMRES on an execution space instance, with its own
+      // temporaries
+      auto instances =
+          Kokkos::Experimental::partition_space(exe_space(), 1, 1);
+      for (int solve = 0; solve < 3; solve++) {
+        Kokkos::deep_copy(B, 1.0);
+        Kokkos::deep_copy(X, 0.0);
+        gmres(instances[1], &kh, A, B, X);
+
+        float_t nrmB = KokkosBlas::nrm2(B);
+        KokkosSparse::spmv("N", 1.0, A, X, 0.0, Wj);  // wj = Ax
+        KokkosBlas::axpy(-1.0, Wj, B);                // b = b-Ax.
+        float_t endRes = KokkosBlas::nrm2(B) / nrmB;
+
+        EXPECT_LT(endRes, gmres_handle->get_tol());
+        EXPECT_EQ(gmres_handle->get_conv_flag_val(), GMRESHandle::Flag::Conv);
+        if (solve == 0) num_allocations = workspace.num_allocations();
+        EXPECT_EQ(workspace.num_allocations(), num_allocations);
+      }
+      EXPECT_EQ(workspace.bytes_in_use(), size_t(0));
+      gmres_handle->set_workspace(nullptr);
+    }
+  }
+
+  static void run_test_gmres_amg() {
+    // 2D Laplacian with Dirichlet rows, whose graph is symmetric as the
+    // aggregation needs
+    constexpr lno_t nx     = 60;
+    constexpr auto m       = 30;
+    constexpr auto tol     = TolMeta<float_t>::value;
+    constexpr bool verbose = false;
+
+    Kokkos::View<lno_t * [3], Kokkos::HostSpace> mat_structure(
+        "Matrix Structure", 2);
+    mat_structure(0, 0) = nx;
+    mat_structure(0, 1) = 1;
+    mat_structure(0, 2) = 1;
+    mat_structure(1, 0) = nx;
+    mat_structure(1, 1) = 1;
+    mat_structure(1, 2) = 1;
+    auto A = Test::generate_structured_matrix2D<Crs>("FD", mat_structure);
+    const lno_t n = A.numRows();
+
+    KernelHandle kh;
+    kh.create_gmres_handle(m, tol);
+    auto gmres_handle = kh.get_gmres_handle();
+    using GMRESHandle =
+        typename std::remove_reference<decltype(*gmres_handle)>::type;
+    using ViewVectorType = typename GMRESHandle::nnz_value_view_t;
+    gmres_handle->set_verbose(verbose);
+
+    ViewVectorType X("X", n);
+    ViewVectorType Wj("Wj", n);
+    ViewVectorType B(Kokkos::view_alloc(Kokkos::WithoutInitializing, "B"), n);
+    Kokkos::deep_copy(B, 1.0);
+
+    KokkosSparse::Experimental::AMGPrec<Crs> myPrec(A);
+    myPrec.compute();
+    EXPECT_TRUE(myPrec.isComputed());
+    EXPECT_GT(myPrec.getNumLevels(), 1);
+    for (int l = 1; l < myPrec.getNumLevels(); l++) {
+      EXPECT_LT(myPrec.getLevelMatrix(l).numRows(),
+                myPrec.getLevelMatrix(l - 1).numRows());
+    }
+
+    gmres(&kh, A, B, X, &myPrec);
+
+    float_t nrmB = KokkosBlas::nrm2(B);
+    KokkosSparse::spmv("N", 1.0, A, X, 0.0, Wj);  // wj = Ax
+    KokkosBlas::axpy(-1.0, Wj, B);                // b = b-Ax.
+    float_t endRes = KokkosBlas::nrm2(B) / nrmB;
+
+    EXPECT_LT(endRes, gmres_handle->get_tol());
+    EXPECT_EQ(gmres_handle->get_conv_flag_val(), GMRESHandle::Flag::Conv);
+    // A multigrid preconditioner should only need a few iterations
+    EXPECT_LT(gmres_handle->get_num_iters(), 50);
+  }
+
+  static void run_test_gmres_ir() {
+#if defined(KOKKOSKERNELS_INST_FLOAT) || !defined(KOKKOSKERNELS_ETI_ONLY)
+    // Refinement of a double system with float inner solves
+    if constexpr (std::is_same_v<scalar_t, double>) {
+      using LowCrs = CrsMatrix<float, lno_t, device, void, size_type>;
+      using LowKernelHandle = KokkosKernels::Experimental::KokkosKernelsHandle<
+          size_type, lno_t, float, exe_space, mem_space, mem_space>;
+
+      constexpr auto n             = 5000;
+      constexpr auto m             = 15;
+      constexpr auto diagDominance = 1;
+      constexpr bool verbose       = false;
+
+      auto A = get_A<Crs, Crs>(n, diagDominance, 1);
+      typename LowCrs::values_type::non_const_type lowValues("lowValues",
+                                                             A.nnz());
+      Kokkos::deep_copy(lowValues, A.values);
+      LowCrs A_low("A_low", n, n, A.nnz(), lowValues, A.graph.row_map,
+                   A.graph.entries);
+
+      LowKernelHandle kh;
+      kh.create_gmres_handle(m, 1e-4);
+      auto gmres_handle = kh.get_gmres_handle();
+      using GMRESHandle =
+          typename std::remove_reference<decltype(*gmres_handle)>::type;
+      gmres_handle->set_verbose(verbose);
+
+      ValuesType X("X", n);
+      ValuesType Wj("Wj", n);
+      ValuesType B(Kokkos::view_alloc(Kokkos::WithoutInitializing, "B"), n);
+      Kokkos::deep_copy(B, 1.0);
+
+      gmres_ir(&kh, A, A_low, B, X, TolMeta<double>::value);
+
+      // The residual is in double precision, below what float could reach
+      float_t nrmB = KokkosBlas::nrm2(B);
+      KokkosSparse::spmv("N", 1.0, A, X, 0.0, Wj);  // wj = Ax
+      KokkosBlas::axpy(-1.0, Wj, B);                // b = b-Ax.
+      float_t endRes = KokkosBlas::nrm2(B) / nrmB;
+
+      EXPECT_LT(endRes, TolMeta<double>::value);
+      EXPECT_EQ(gmres_handle->get_conv_flag_val(), GMRESHandle::Flag::Conv);
+    }
+#endif
+  }
+
+  static void run_test_gmres_operator() {
+    using Operator = StencilOperator<scalar_t, device>;
+
+    constexpr auto n       = 2000;
+    constexpr auto m       = 15;
+    constexpr auto tol     = TolMeta<float_t>::value;
+    constexpr bool verbose = false;
+
+    Operator op{n};
+    Crs A = op.template assemble<Crs>();
+
+    KernelHandle kh;
+    kh.create_gmres_handle(m, tol);
+    auto gmres_handle = kh.get_gmres_handle();
+    using GMRESHandle =
+        typename std::remove_reference<decltype(*gmres_handle)>::type;
+    gmres_handle->set_verbose(verbose);
+
+    ValuesType X("X", n);
+    ValuesType Xcrs("Xcrs", n);
+    ValuesType Wj("Wj", n);
+    ValuesType B(Kokkos::view_alloc(Kokkos::WithoutInitializing, "B"), n);
+    Kokkos::deep_copy(B, 1.0);
+    const float_t nrmB = KokkosBlas::nrm2(B);
+
+    // Reference solve with the assembled matrix
+    gmres(&kh, A, B, Xcrs);
+    EXPECT_EQ(gmres_handle->get_conv_flag_val(), GMRESHandle::Flag::Conv);
+
+    KokkosSparse::Experimental::MatrixPrec<Crs> myPrec(A);
+    const typename GMRESHandle::Ortho orthos[] = {
+        GMRESHandle::Ortho::CGS2, GMRESHandle::Ortho::MGS,
+        GMRESHandle::Ortho::PIPELINED, GMRESHandle::Ortho::SSTEP};
+    for (const auto ortho : orthos) {
+      for (const bool usePrec : {false, true}) {
+        gmres_handle->reset_handle(m, tol);
+        gmres_handle->set_ortho(ortho);
+        gmres_handle->set_s_step(3);
+        gmres_handle->set_verbose(verbose);
+
+        Kokkos::deep_copy(X, 0.0);
+        if (usePrec)
+          gmres(&kh, op, B, X, &myPrec);
+        else
+          gmres(&kh, op, B, X);
+
+        // Double check residuals at end of solve:
+        op.apply(X, Wj);                      // wj = Ax
+        KokkosBlas::axpby(1.0, B, -1.0, Wj);  // wj = b-Ax
+        EXPECT_LT(KokkosBlas::nrm2(Wj) / nrmB, gmres_handle->get_tol());
+        EXPECT_EQ(gmres_handle->get_conv_flag_val(), GMRESHandle::Flag::Conv);
+
+        // Both solutions are within cond(A) * tol <= 7 tol of the exact one
+        // (the stencil is diagonally dominant by 1 in rows and columns)
+        KokkosBlas::axpy(-1.0, Xcrs, X);
+        EXPECT_LT(KokkosBlas::nrm2(X), 15 * tol * KokkosBlas::nrm2(Xcrs));
+      }
+    }
   }
 };
 
@@ -205,6 +746,9 @@ void test_gmres() {
   using TestStruct = Test::GmresTest<scalar_t, lno_t, size_type, device>;
   TestStruct::template run_test_gmres<false>();
   TestStruct::template run_test_gmres<true>();
+  TestStruct::run_test_gmres_amg();
+  TestStruct::run_test_gmres_ir();
+  TestStruct::run_test_gmres_operator();
 }
 
 #define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)       \
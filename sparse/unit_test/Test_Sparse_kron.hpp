@@ -0,0 +1,144 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <algorithm>
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+
+#include "KokkosSparse_spmv.hpp"
+#include "KokkosSparse_kron.hpp"
+#include "KokkosSparse_IOUtils.hpp"
+#include "KokkosKernels_TestUtils.hpp"
+
+namespace Test {
+
+// Compare kron(A, B) against the Kronecker product of the dense A and B, and
+// KronOperator::apply against spmv with kron(A, B) in every mode. The shapes
+// are chosen so that one call applies op(A) first and the other op(B) first.
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void run_test_kron(lno_t mA, lno_t nA, size_type nnzA, lno_t mB, lno_t nB,
+                   size_type nnzB) {
+  using crsMat_t =
+      KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using vec_t      = Kokkos::View<scalar_t*, device>;
+  using mag_t      = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+  using KAT        = Kokkos::ArithTraits<scalar_t>;
+  using exec_space = typename device::execution_space;
+  using dense_t    = Kokkos::View<scalar_t**, Kokkos::HostSpace>;
+
+  crsMat_t A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      mA, nA, nnzA, 2, nA);
+  crsMat_t B = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      mB, nB, nnzB, 2, nB);
+  crsMat_t C = KokkosSparse::kron(A, B);
+  ASSERT_EQ(C.numRows(), mA * mB);
+  ASSERT_EQ(C.numCols(), nA * nB);
+  ASSERT_EQ(C.nnz(), A.nnz() * B.nnz());
+
+  // Dense A, B and C (summing any duplicate entries)
+  auto to_dense = [](const crsMat_t& M) {
+    dense_t D("dense", M.numRows(), M.numCols());
+    auto rowmap = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                      M.graph.row_map);
+    auto entries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                       M.graph.entries);
+    auto values =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), M.values);
+    for (lno_t i = 0; i < M.numRows(); i++)
+      for (size_type k = rowmap(i); k < rowmap(i + 1); k++)
+        D(i, entries(k)) += values(k);
+    return D;
+  };
+  dense_t Ad = to_dense(A), Bd = to_dense(B), Cd = to_dense(C);
+  mag_t max_a = 0, max_b = 0;
+  for (lno_t i = 0; i < mA; i++)
+    for (lno_t j = 0; j < nA; j++) max_a = std::max(max_a, KAT::abs(Ad(i, j)));
+  for (lno_t k = 0; k < mB; k++)
+    for (lno_t l = 0; l < nB; l++) max_b = std::max(max_b, KAT::abs(Bd(k, l)));
+  const mag_t eps = Kokkos::ArithTraits<mag_t>::eps();
+  for (lno_t i = 0; i < mA; i++)
+    for (lno_t j = 0; j < nA; j++)
+      for (lno_t k = 0; k < mB; k++)
+        for (lno_t l = 0; l < nB; l++)
+          EXPECT_NEAR_KK(Cd(i * mB + k, j * nB + l), Ad(i, j) * Bd(k, l),
+                         10 * eps * max_a * max_b);
+
+  // Any entry of op(C) x is a sum of at most max_len products, of magnitude
+  // at most 2 * max_a * max_b (x and y have entries in [0, 1) or, for complex
+  // types, [0, 1) + [0, 1)i)
+  mag_t max_len = 0;
+  for (lno_t i = 0; i < C.numRows(); i++) {
+    mag_t len = 0;
+    for (lno_t j = 0; j < C.numCols(); j++) len += Cd(i, j) != scalar_t(0);
+    max_len = std::max(max_len, len);
+  }
+  for (lno_t j = 0; j < C.numCols(); j++) {
+    mag_t len = 0;
+    for (lno_t i = 0; i < C.numRows(); i++) len += Cd(i, j) != scalar_t(0);
+    max_len = std::max(max_len, len);
+  }
+  const scalar_t alpha(1.5), beta(-0.5);
+  const mag_t tol =
+      10 * eps * (max_len + 2) * (1.5 * 2 * max_a * max_b * max_len + 1);
+
+  KokkosSparse::Experimental::KronOperator<crsMat_t, crsMat_t> op(A, B);
+  EXPECT_EQ(op.numRows(), int64_t(C.numRows()));
+  EXPECT_EQ(op.numCols(), int64_t(C.numCols()));
+  EXPECT_EQ(op.nnz(), int64_t(C.nnz()));
+  Kokkos::Random_XorShift64_Pool<exec_space> rand_pool(13579);
+  for (const char* mode : {"N", "C", "T", "H"}) {
+    const bool trans = mode[0] == 'T' || mode[0] == 'H';
+    const lno_t nx   = trans ? C.numRows() : C.numCols();
+    const lno_t ny   = trans ? C.numCols() : C.numRows();
+    vec_t x("x", nx), y("y", ny), y_ref("y_ref", ny);
+    Kokkos::fill_random(x, rand_pool, scalar_t(1));
+    Kokkos::fill_random(y, rand_pool, scalar_t(1));
+    Kokkos::deep_copy(y_ref, y);
+    KokkosSparse::spmv(mode, alpha, C, x, beta, y_ref);
+    op.apply(mode, alpha, x, beta, y);
+    EXPECT_NEAR_KK_1DVIEW(y, y_ref, tol);
+  }
+  EXPECT_GT(op.workspace_bytes(), size_t(0));
+
+  // Wrong vector sizes are rejected
+  vec_t x_bad("x_bad", C.numCols() + 1), y_ok("y_ok", C.numRows());
+  EXPECT_THROW(op.apply("N", alpha, x_bad, beta, y_ok), std::runtime_error);
+}
+
+}  // namespace Test
+
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void test_kron() {
+  Test::run_test_kron<scalar_t, lno_t, size_type, device>(1, 1, 1, 1, 1, 1);
+  Test::run_test_kron<scalar_t, lno_t, size_type, device>(40, 30, 200, 5, 7,
+                                                          15);
+  Test::run_test_kron<scalar_t, lno_t, size_type, device>(5, 7, 15, 40, 30,
+                                                          200);
+}
+
+#define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)   \
+  TEST_F(TestCategory,                                                \
+         sparse##_##kron##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    test_kron<SCALAR, ORDINAL, OFFSET, DEVICE>();                     \
+  }
+
+#include <Test_Common_Test_All_Type_Combos.hpp>
+
+#undef KOKKOSKERNELS_EXECUTE_TEST
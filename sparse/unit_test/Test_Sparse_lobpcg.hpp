@@ -0,0 +1,165 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_MatrixPrec.hpp"
+#include "KokkosSparse_lobpcg.hpp"
+#include "KokkosBlas3_gemm.hpp"
+#include "KokkosKernels_TestUtils.hpp"
+
+namespace Test {
+
+// A = tridiag(-1, 4, -1) of size n, with eigenvalues
+// 4 - 2 cos(j pi / (n + 1)), j = 1, ..., n
+template <typename crsMat_t>
+crsMat_t lobpcg_tridiag(const int n) {
+  using rowmap_t  = typename crsMat_t::row_map_type::non_const_type;
+  using entries_t = typename crsMat_t::index_type::non_const_type;
+  using values_t  = typename crsMat_t::values_type::non_const_type;
+  using scalar_t  = typename crsMat_t::non_const_value_type;
+  using lno_t     = typename crsMat_t::non_const_ordinal_type;
+
+  rowmap_t rowmap("rowmap", n + 1);
+  entries_t entries("entries", 3 * n - 2);
+  values_t values("values", 3 * n - 2);
+  auto rowmap_h  = Kokkos::create_mirror_view(rowmap);
+  auto entries_h = Kokkos::create_mirror_view(entries);
+  auto values_h  = Kokkos::create_mirror_view(values);
+  int nnz        = 0;
+  for (int i = 0; i < n; i++) {
+    rowmap_h(i) = nnz;
+    for (int j = Kokkos::max(i - 1, 0); j <= Kokkos::min(i + 1, n - 1); j++) {
+      entries_h(nnz) = lno_t(j);
+      values_h(nnz)  = scalar_t(i == j ? 4 : -1);
+      nnz++;
+    }
+  }
+  rowmap_h(n) = nnz;
+  Kokkos::deep_copy(rowmap, rowmap_h);
+  Kokkos::deep_copy(entries, entries_h);
+  Kokkos::deep_copy(values, values_h);
+  return crsMat_t("A", n, n, nnz, values, rowmap, entries);
+}
+
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void run_test_lobpcg(const int n, const int k, const bool largest,
+                     const bool use_prec) {
+  using crsMat_t =
+      KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using mv_t       = Kokkos::View<scalar_t**, Kokkos::LayoutLeft, device>;
+  using vec_t      = Kokkos::View<scalar_t*, device>;
+  using exec_space = typename device::execution_space;
+  using KAT        = Kokkos::ArithTraits<scalar_t>;
+
+  crsMat_t A = lobpcg_tridiag<crsMat_t>(n);
+
+  // Jacobi preconditioner D^{-1} = I / 4
+  crsMat_t Dinv = lobpcg_tridiag<crsMat_t>(n);
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<exec_space>(0, n), KOKKOS_LAMBDA(const int i) {
+        for (size_type jj = Dinv.graph.row_map(i);
+             jj < Dinv.graph.row_map(i + 1); jj++)
+          Dinv.values(jj) = (Dinv.graph.entries(jj) == i) ? scalar_t(0.25)
+                                                          : scalar_t(0);
+      });
+  KokkosSparse::Experimental::MatrixPrec<crsMat_t> prec(Dinv);
+
+  mv_t X("X", n, k);
+  vec_t lambda("lambda", k);
+  Kokkos::Random_XorShift64_Pool<exec_space> rand_pool(13718);
+  Kokkos::fill_random(X, rand_pool, scalar_t(-1), scalar_t(1));
+
+  const scalar_t tol = 10 * KAT::sqrt(KAT::eps());
+  const int iters    = KokkosSparse::Experimental::lobpcg(
+      exec_space(), A, X, lambda, largest, tol, 500,
+      use_prec ? &prec : nullptr);
+  EXPECT_GE(iters, 0);
+
+  auto lambda_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                      lambda);
+  scalar_t scale = 0;
+  for (int j = 0; j < k; j++)
+    scale = Kokkos::max(scale, Kokkos::abs(lambda_h(j)));
+
+  // Each Ritz value is within its residual norm of an eigenvalue, which is
+  // the expected one once all of them converged. The residuals are checked
+  // against 2 tol as A X is updated along the iterations, not recomputed.
+  for (int j = 0; j < k; j++) {
+    const int idx   = largest ? n - k + j : j;
+    const double ev = 4 - 2 * Kokkos::cos((idx + 1) * Kokkos::numbers::pi /
+                                          (n + 1));
+    EXPECT_NEAR(lambda_h(j), scalar_t(ev), 2 * tol * scale);
+  }
+  for (int j = 0; j + 1 < k; j++) EXPECT_LE(lambda_h(j), lambda_h(j + 1));
+
+  // X is orthonormal and A X = X diag(lambda)
+  mv_t XtX("XtX", k, k), R("R", n, k);
+  KokkosBlas::gemm("T", "N", scalar_t(1), X, X, scalar_t(0), XtX);
+  auto XtX_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), XtX);
+  for (int i = 0; i < k; i++)
+    for (int j = 0; j < k; j++)
+      EXPECT_NEAR(XtX_h(i, j), scalar_t(i == j ? 1 : 0), tol);
+
+  KokkosSparse::spmv("N", scalar_t(1), A, X, scalar_t(0), R);
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<exec_space>(0, n), KOKKOS_LAMBDA(const int i) {
+        for (int j = 0; j < k; j++) R(i, j) -= lambda(j) * X(i, j);
+      });
+  for (int j = 0; j < k; j++) {
+    EXPECT_LE(KokkosBlas::nrm2(Kokkos::subview(R, Kokkos::ALL, j)),
+              2 * tol * scale);
+  }
+
+  // Not converged in a single iteration
+  if (n >= 10 * k) {
+    Kokkos::fill_random(X, rand_pool, scalar_t(-1), scalar_t(1));
+    EXPECT_EQ(
+        KokkosSparse::Experimental::lobpcg(A, X, lambda, largest, tol, 1), -1);
+  }
+}
+
+}  // namespace Test
+
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void test_lobpcg() {
+  // lobpcg is only available for real scalars
+  if constexpr (!Kokkos::ArithTraits<scalar_t>::is_complex) {
+    Test::run_test_lobpcg<scalar_t, lno_t, size_type, device>(60, 4, false,
+                                                              false);
+    Test::run_test_lobpcg<scalar_t, lno_t, size_type, device>(60, 4, true,
+                                                              false);
+    Test::run_test_lobpcg<scalar_t, lno_t, size_type, device>(60, 4, false,
+                                                              true);
+    Test::run_test_lobpcg<scalar_t, lno_t, size_type, device>(9, 3, false,
+                                                              false);
+  }
+}
+
+#define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)        \
+  TEST_F(TestCategory,                                                     \
+         sparse##_##lobpcg##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    test_lobpcg<SCALAR, ORDINAL, OFFSET, DEVICE>();                        \
+  }
+
+#include <Test_Common_Test_All_Type_Combos.hpp>
+
+#undef KOKKOSKERNELS_EXECUTE_TEST
@@ -0,0 +1,107 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+
+#include "KokkosBlas1_scal.hpp"
+#include "KokkosSparse_spmv.hpp"
+#include "KokkosSparse_matrix_powers.hpp"
+#include "KokkosSparse_IOUtils.hpp"
+#include "KokkosKernels_TestUtils.hpp"
+
+namespace Test {
+
+// Compare matrix_powers against s calls to spmv.
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void run_test_matrix_powers(lno_t numRows, size_type nnz,
+                            lno_t row_size_variance, int s,
+                            lno_t rows_per_block) {
+  using crsMat_t =
+      KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using vec_t      = Kokkos::View<scalar_t*, device>;
+  using mv_t       = Kokkos::View<scalar_t**, Kokkos::LayoutLeft, device>;
+  using mag_t      = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+  using exec_space = typename device::execution_space;
+  using handle_t =
+      KokkosSparse::Experimental::MatrixPowersHandle<exec_space, crsMat_t>;
+
+  crsMat_t A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      numRows, numRows, nnz, row_size_variance, numRows / 4);
+
+  const mag_t eps = 1e3 * Kokkos::ArithTraits<mag_t>::eps();
+  Kokkos::Random_XorShift64_Pool<exec_space> rand_pool(2468);
+  vec_t x("x", numRows);
+  Kokkos::fill_random(x, rand_pool, scalar_t(1));
+
+  mv_t V_ref("V_ref", numRows, s + 1);
+  Kokkos::deep_copy(Kokkos::subview(V_ref, Kokkos::ALL(), 0), x);
+  for (int k = 1; k <= s; k++) {
+    KokkosSparse::spmv("N", scalar_t(1), A,
+                       Kokkos::subview(V_ref, Kokkos::ALL(), k - 1),
+                       scalar_t(0), Kokkos::subview(V_ref, Kokkos::ALL(), k));
+  }
+
+  handle_t handle(s, rows_per_block);
+  // The second call reuses the dependency structure, with new values
+  for (int rep = 0; rep < 2; rep++) {
+    mv_t V("V", numRows, s + 1);
+    KokkosSparse::Experimental::matrix_powers(&handle, A, x, V);
+    auto V_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), V);
+    auto V_ref_h =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), V_ref);
+    for (int k = 0; k <= s; k++) {
+      EXPECT_NEAR_KK_REL_1DVIEW(Kokkos::subview(V_h, Kokkos::ALL(), k),
+                                Kokkos::subview(V_ref_h, Kokkos::ALL(), k),
+                                eps);
+    }
+    if (rep == 0) {
+      KokkosBlas::scal(A.values, scalar_t(0.5), A.values);
+      for (int k = 1; k <= s; k++) {
+        auto V_k = Kokkos::subview(V_ref, Kokkos::ALL(), k);
+        // (A/2)^k x = A^k x / 2^k
+        KokkosBlas::scal(V_k, scalar_t(1.0 / (1 << k)), V_k);
+      }
+    }
+  }
+}
+
+}  // namespace Test
+
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void test_matrix_powers() {
+  Test::run_test_matrix_powers<scalar_t, lno_t, size_type, device>(1, 1, 0, 3,
+                                                                   16);
+  for (int s : {0, 1, 4}) {
+    Test::run_test_matrix_powers<scalar_t, lno_t, size_type, device>(
+        1000, 5000, 10, s, 64);
+    Test::run_test_matrix_powers<scalar_t, lno_t, size_type, device>(
+        511, 3000, 20, s, 1024);
+  }
+}
+
+#define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)          \
+  TEST_F(TestCategory,                                                       \
+         sparse##_##matrix_powers##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    test_matrix_powers<SCALAR, ORDINAL, OFFSET, DEVICE>();                   \
+  }
+
+#include <Test_Common_Test_All_Type_Combos.hpp>
+
+#undef KOKKOSKERNELS_EXECUTE_TEST
@@ -15,6 +15,7 @@
 //@HEADER
 
 #include <gtest/gtest.h>
+#include <vector>
 #include <Kokkos_Core.hpp>
 #include "KokkosSparse_mdf.hpp"
 #include "KokkosSparse_CrsMatrix.hpp"
@@ -178,12 +179,133 @@ void run_test_mdf() {
   }
 }
 
+// Factor the 5-point Laplacian of an n x n grid with the independent set
+// variant of MDF, and compare L and U with the incomplete LU(0) of the
+// permuted matrix, computed densely on the host in the same ordering.
+template <typename scalar_type, typename ordinal_type, typename size_type,
+          typename device>
+void run_test_mdf_independent_set(const ordinal_type n) {
+  using crs_matrix_type = KokkosSparse::CrsMatrix<scalar_type, ordinal_type,
+                                                  device, void, size_type>;
+  using crs_graph_type  = typename crs_matrix_type::StaticCrsGraphType;
+  using row_map_type    = typename crs_graph_type::row_map_type::non_const_type;
+  using col_ind_type    = typename crs_graph_type::entries_type::non_const_type;
+  using values_type     = typename crs_matrix_type::values_type::non_const_type;
+  using mag_type        = typename Kokkos::ArithTraits<scalar_type>::mag_type;
+
+  const ordinal_type numRows = n * n;
+  std::vector<size_type> row_map_vec(numRows + 1, 0);
+  std::vector<ordinal_type> col_ind_vec;
+  std::vector<scalar_type> values_vec;
+  for (ordinal_type i = 0; i < n; ++i) {
+    for (ordinal_type j = 0; j < n; ++j) {
+      const ordinal_type row = i * n + j;
+      for (ordinal_type col : {row - n, row - 1, row, row + 1, row + n}) {
+        if (col < 0 || col >= numRows) continue;
+        if ((col == row - 1 && j == 0) || (col == row + 1 && j == n - 1))
+          continue;
+        col_ind_vec.push_back(col);
+        values_vec.push_back(scalar_type(col == row ? 4 : -1));
+      }
+      row_map_vec[row + 1] = col_ind_vec.size();
+    }
+  }
+  const size_type nnz = col_ind_vec.size();
+  row_map_type row_map("row map", numRows + 1);
+  col_ind_type col_ind("column indices", nnz);
+  values_type values("values", nnz);
+  Kokkos::deep_copy(row_map, typename row_map_type::HostMirror::const_type(
+                                 row_map_vec.data(), numRows + 1));
+  Kokkos::deep_copy(col_ind, typename col_ind_type::HostMirror::const_type(
+                                 col_ind_vec.data(), nnz));
+  Kokkos::deep_copy(values, typename values_type::HostMirror::const_type(
+                                values_vec.data(), nnz));
+  crs_matrix_type A("A", numRows, numRows, nnz, values, row_map, col_ind);
+
+  KokkosSparse::Experimental::MDF_handle<crs_matrix_type> handle(A);
+  handle.set_independent_set_elimination(true);
+  KokkosSparse::Experimental::mdf_symbolic(A, handle);
+  KokkosSparse::Experimental::mdf_numeric(A, handle);
+
+  // Several rows are eliminated at each step
+  EXPECT_GT(handle.get_num_elimination_steps(), 0);
+  if (numRows > 1) EXPECT_LT(handle.get_num_elimination_steps(), numRows);
+
+  auto perm = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                  handle.get_permutation());
+  auto perm_inv = Kokkos::create_mirror_view_and_copy(
+      Kokkos::HostSpace(), handle.get_permutation_inv());
+  for (ordinal_type k = 0; k < numRows; ++k) {
+    ASSERT_GE(perm(k), 0);
+    ASSERT_LT(perm(k), numRows);
+    ASSERT_EQ(perm_inv(perm(k)), k);
+  }
+
+  // Dense ILU(0) of P A P^T, restricted to the pattern of A
+  std::vector<scalar_type> B(numRows * numRows, scalar_type(0));
+  std::vector<char> pattern(numRows * numRows, 0);
+  for (ordinal_type row = 0; row < numRows; ++row) {
+    for (size_type e = row_map_vec[row]; e < row_map_vec[row + 1]; ++e) {
+      const ordinal_type pi = perm_inv(row), pj = perm_inv(col_ind_vec[e]);
+      B[pi * numRows + pj]       = values_vec[e];
+      pattern[pi * numRows + pj] = 1;
+    }
+  }
+  for (ordinal_type k = 0; k < numRows; ++k) {
+    for (ordinal_type i = k + 1; i < numRows; ++i) {
+      if (!pattern[i * numRows + k]) continue;
+      B[i * numRows + k] /= B[k * numRows + k];
+      for (ordinal_type j = k + 1; j < numRows; ++j) {
+        if (pattern[k * numRows + j] && pattern[i * numRows + j])
+          B[i * numRows + j] -= B[i * numRows + k] * B[k * numRows + j];
+      }
+    }
+  }
+
+  const mag_type tol = 100 * Kokkos::ArithTraits<scalar_type>::eps();
+  auto check_factor = [&](const crs_matrix_type& F, bool lower) {
+    auto F_row_map = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                         F.graph.row_map);
+    auto F_entries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                         F.graph.entries);
+    auto F_values =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), F.values);
+    size_type count = 0;
+    for (ordinal_type i = 0; i < numRows; ++i) {
+      for (size_type e = F_row_map(i); e < F_row_map(i + 1); ++e) {
+        const ordinal_type j = F_entries(e);
+        if (lower) {
+          ASSERT_LE(j, i);
+          const scalar_type ref =
+              (i == j) ? scalar_type(1) : B[i * numRows + j];
+          EXPECT_NEAR_KK(F_values(e), ref, tol);
+        } else {
+          ASSERT_GE(j, i);
+          EXPECT_NEAR_KK(F_values(e), B[i * numRows + j], tol);
+        }
+        ++count;
+      }
+    }
+    // Every entry of the pattern on the triangle (and the diagonal) is there
+    size_type expected = 0;
+    for (ordinal_type i = 0; i < numRows; ++i)
+      for (ordinal_type j = 0; j < numRows; ++j)
+        if ((lower ? j <= i : j >= i) && pattern[i * numRows + j]) ++expected;
+    EXPECT_EQ(count, expected);
+  };
+  check_factor(handle.getL(), true);
+  check_factor(handle.getU(), false);
+}
+
 }  // namespace Test
 
 template <typename scalar_t, typename lno_t, typename size_type,
           typename device>
 void test_mdf() {
   Test::run_test_mdf<scalar_t, lno_t, size_type, device>();
+  Test::run_test_mdf_independent_set<scalar_t, lno_t, size_type, device>(1);
+  Test::run_test_mdf_independent_set<scalar_t, lno_t, size_type, device>(4);
+  Test::run_test_mdf_independent_set<scalar_t, lno_t, size_type, device>(20);
 }
 
 #define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)     \
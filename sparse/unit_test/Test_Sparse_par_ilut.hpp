@@ -19,10 +19,12 @@
 
 #include <string>
 #include <stdexcept>
+#include <vector>
 
 #include "KokkosSparse_CrsMatrix.hpp"
 #include "KokkosKernels_IOUtils.hpp"
 #include "KokkosBlas1_nrm2.hpp"
+#include "KokkosBlas1_scal.hpp"
 #include "KokkosSparse_spmv.hpp"
 #include "KokkosSparse_par_ilut.hpp"
 #include "KokkosSparse_gmres.hpp"
@@ -316,6 +318,85 @@ void run_test_par_ilut_precond() {
   }
 }
 
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void run_test_par_ilut_warm_start() {
+  // Refactor a slightly changed matrix starting from the previous factors
+  using exe_space   = typename device::execution_space;
+  using mem_space   = typename device::memory_space;
+  using RowMapType  = Kokkos::View<size_type*, device>;
+  using EntriesType = Kokkos::View<lno_t*, device>;
+  using ValuesType  = Kokkos::View<scalar_t*, device>;
+  using sp_matrix_type =
+      KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using KernelHandle = KokkosKernels::Experimental::KokkosKernelsHandle<
+      size_type, lno_t, scalar_t, exe_space, mem_space, mem_space>;
+
+  constexpr auto numRows        = 1000;
+  constexpr auto diagDominance  = 1;
+  constexpr size_type warm_itrs = 2;
+
+  size_type nnz = 10 * numRows;
+  auto A = KokkosSparse::Impl::kk_generate_diagonally_dominant_sparse_matrix<
+      sp_matrix_type>(numRows, numRows, nnz, 0, lno_t(0.01 * numRows),
+                      diagDominance);
+
+  KokkosSparse::sort_crs_matrix(A);
+
+  auto row_map = A.graph.row_map;
+  auto entries = A.graph.entries;
+  auto values  = A.values;
+
+  KernelHandle kh;
+  kh.create_par_ilut_handle();
+  auto par_ilut_handle = kh.get_par_ilut_handle();
+  par_ilut_handle->set_async_update(false);
+  par_ilut_handle->set_warm_start(true);
+  par_ilut_handle->set_warm_start_max_iter(warm_itrs);
+
+  RowMapType L_row_map("L_row_map", numRows + 1);
+  RowMapType U_row_map("U_row_map", numRows + 1);
+  EntriesType L_entries, U_entries;
+  ValuesType L_values, U_values;
+
+  // Runs the symbolic phase and sizes L and U for a cold start
+  auto symbolic = [&]() {
+    par_ilut_symbolic(&kh, row_map, entries, L_row_map, U_row_map);
+    const size_type nnzL = par_ilut_handle->get_nnzL();
+    const size_type nnzU = par_ilut_handle->get_nnzU();
+    L_entries            = EntriesType("L_entries", nnzL);
+    L_values             = ValuesType("L_values", nnzL);
+    U_entries            = EntriesType("U_entries", nnzU);
+    U_values             = ValuesType("U_values", nnzU);
+  };
+
+  // The first numeric call after symbolic is a cold start
+  symbolic();
+  par_ilut_numeric(&kh, row_map, entries, values, L_row_map, L_entries,
+                   L_values, U_row_map, U_entries, U_values);
+  EXPECT_TRUE(par_ilut_handle->is_numeric_complete());
+
+  // Perturb A, then continue from the factors of the previous call
+  KokkosBlas::scal(values, scalar_t(1.01), values);
+  par_ilut_numeric(&kh, row_map, entries, values, L_row_map, L_entries,
+                   L_values, U_row_map, U_entries, U_values);
+  const auto warm_itrs_done = par_ilut_handle->get_num_iters();
+  const auto warm_res       = par_ilut_handle->get_end_rel_res();
+  EXPECT_GT(warm_itrs_done, 0);
+  EXPECT_LE(size_type(warm_itrs_done), warm_itrs);
+
+  // A cold start with the same number of iterations does no better
+  symbolic();
+  EXPECT_FALSE(par_ilut_handle->is_numeric_complete());
+  par_ilut_handle->set_max_iter(warm_itrs);
+  par_ilut_numeric(&kh, row_map, entries, values, L_row_map, L_entries,
+                   L_values, U_row_map, U_entries, U_values);
+  const auto cold_res = par_ilut_handle->get_end_rel_res();
+  EXPECT_LE(warm_res, cold_res);
+
+  kh.destroy_par_ilut_handle();
+}
+
 template <typename scalar_t, typename lno_t, typename size_type,
           typename device>
 void run_test_par_ilut_zerorow_A() {
@@ -375,12 +456,102 @@ void run_test_par_ilut_zerorow_A() {
   kh.destroy_par_ilut_handle();
 }
 
+// par_ilut on execution space instances, one factorization each
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void run_test_par_ilut_exec_space() {
+  using exec_space   = typename device::execution_space;
+  using RowMapType   = Kokkos::View<size_type*, device>;
+  using EntriesType  = Kokkos::View<lno_t*, device>;
+  using ValuesType   = Kokkos::View<scalar_t*, device>;
+  using KernelHandle = KokkosKernels::Experimental::KokkosKernelsHandle<
+      size_type, lno_t, scalar_t, exec_space, typename device::memory_space,
+      typename device::memory_space>;
+
+  // Same fixture as run_test_par_ilut
+  std::vector<std::vector<scalar_t>> A = {{1., 6., 4., 7.},
+                                          {2., -5., 0., 8.},
+                                          {0.5, -3., 6., 0.},
+                                          {0.2, -0.5, -9., 0.}};
+
+  RowMapType row_map("row_map", 0);
+  EntriesType entries("entries", 0);
+  ValuesType values("values", 0);
+
+  compress_matrix(row_map, entries, values, A);
+
+  const size_type nrows = A.size();
+  const int ninstances  = 2;
+
+  // Copies of the default instance if OpenMP cannot be partitioned
+  std::vector<exec_space> instances(ninstances);
+  bool partition = true;
+#ifdef KOKKOS_ENABLE_OPENMP
+  if (std::is_same<exec_space, Kokkos::OpenMP>::value)
+    partition = exec_space().concurrency() >= ninstances;
+#endif
+  if (partition) {
+    std::vector<int> weights(ninstances, 1);
+    instances = Kokkos::Experimental::partition_space(exec_space(), weights);
+  }
+
+  std::vector<KernelHandle> kh_v(ninstances);
+  std::vector<RowMapType> L_row_map_v(ninstances), U_row_map_v(ninstances);
+  std::vector<EntriesType> L_entries_v(ninstances), U_entries_v(ninstances);
+  std::vector<ValuesType> L_values_v(ninstances), U_values_v(ninstances);
+  for (int i = 0; i < ninstances; i++) {
+    kh_v[i].create_par_ilut_handle();
+    auto par_ilut_handle = kh_v[i].get_par_ilut_handle();
+    par_ilut_handle->set_async_update(false);
+    L_row_map_v[i] = RowMapType("L_row_map", nrows + 1);
+    U_row_map_v[i] = RowMapType("U_row_map", nrows + 1);
+    par_ilut_symbolic(instances[i], &kh_v[i], row_map, entries,
+                      L_row_map_v[i], U_row_map_v[i]);
+  }
+  for (int i = 0; i < ninstances; i++) instances[i].fence();
+
+  for (int i = 0; i < ninstances; i++) {
+    auto par_ilut_handle = kh_v[i].get_par_ilut_handle();
+    const size_type nnzL = par_ilut_handle->get_nnzL();
+    const size_type nnzU = par_ilut_handle->get_nnzU();
+    L_entries_v[i]       = EntriesType("L_entries", nnzL);
+    L_values_v[i]        = ValuesType("L_values", nnzL);
+    U_entries_v[i]       = EntriesType("U_entries", nnzU);
+    U_values_v[i]        = ValuesType("U_values", nnzU);
+    par_ilut_numeric(instances[i], &kh_v[i], row_map, entries, values,
+                     L_row_map_v[i], L_entries_v[i], L_values_v[i],
+                     U_row_map_v[i], U_entries_v[i], U_values_v[i]);
+  }
+  for (int i = 0; i < ninstances; i++) instances[i].fence();
+
+  std::vector<std::vector<scalar_t>> expected_L_candidates = {
+      {1., 0., 0., 0.},
+      {2., 1., 0., 0.},
+      {0.50, 0.35, 1., 0.},
+      {0., 0., -1.32, 1.}};
+  std::vector<std::vector<scalar_t>> expected_U_candidates = {
+      {1., 6., 4., 7.},
+      {0., -17., -8., -6.},
+      {0., 0., 6.82, 0.},
+      {0., 0., 0., 0.}};
+
+  for (int i = 0; i < ninstances; i++) {
+    check_matrix("L numeric", L_row_map_v[i], L_entries_v[i], L_values_v[i],
+                 expected_L_candidates);
+    check_matrix("U numeric", U_row_map_v[i], U_entries_v[i], U_values_v[i],
+                 expected_U_candidates);
+    kh_v[i].destroy_par_ilut_handle();
+  }
+}
+
 }  // namespace Test
 
 template <typename scalar_t, typename lno_t, typename size_type,
           typename device>
 void test_par_ilut() {
   Test::run_test_par_ilut<scalar_t, lno_t, size_type, device>();
+  Test::run_test_par_ilut_warm_start<scalar_t, lno_t, size_type, device>();
+  Test::run_test_par_ilut_exec_space<scalar_t, lno_t, size_type, device>();
 }
 
 template <typename scalar_t, typename lno_t, typename size_type,
@@ -231,6 +231,16 @@ void getTestInput(int test, Matrix& A, Matrix& Afiltered_ref) {
   }
 }
 
+// Keeps the nonzero values, like removeCrsMatrixZeros
+struct KeepNonzeros {
+  template <typename Ordinal, typename Scalar, typename Mag>
+  KOKKOS_INLINE_FUNCTION bool operator()(const Ordinal, const Ordinal,
+                                         const Scalar& a, const Mag,
+                                         const Mag) const {
+    return a != Kokkos::ArithTraits<Scalar>::zero();
+  }
+};
+
 }  // namespace TestRemoveCrsMatrixZeros
 
 void testRemoveCrsMatrixZeros(int testCase) {
@@ -252,4 +262,68 @@ TEST_F(TestCategory, sparse_remove_crs_zeros) {
     testRemoveCrsMatrixZeros(testCase);
 }
 
+void testFilterMatrixPredicate(int testCase) {
+  using namespace TestRemoveCrsMatrixZeros;
+  using Matrix = KokkosSparse::CrsMatrix<default_scalar, default_lno_t,
+                                         TestDevice, void, default_size_type>;
+  Matrix A, Afiltered_ref;
+  getTestInput<Matrix>(testCase, A, Afiltered_ref);
+  Matrix Afiltered_actual = KokkosSparse::filter_matrix(A, KeepNonzeros());
+  bool matches =
+      Test::is_same_matrix<Matrix, TestDevice>(Afiltered_actual, Afiltered_ref);
+  EXPECT_TRUE(matches) << "Test case " << testCase
+                       << ": filter_matrix does not match reference.";
+}
+
+void testFilterMatrixThresholds() {
+  using namespace TestRemoveCrsMatrixZeros;
+  using Matrix = KokkosSparse::CrsMatrix<default_scalar, default_lno_t,
+                                         TestDevice, void, default_size_type>;
+  using Mag = typename Kokkos::ArithTraits<default_scalar>::mag_type;
+  // Row 2 has small entries on both sides of the diagonal, row 3 has only
+  // a small off-diagonal entry
+  std::vector<int> rowmap    = {0, 3, 6, 10, 12};
+  std::vector<int> entries   = {0, 1, 2, 0, 1, 2, 0, 1, 2, 3, 2, 3};
+  std::vector<double> values = {4,    -1, -0.1, -1,  4, -2,
+                                -0.1, -2, 4,    0.4, 0.4, 5};
+  Matrix A = loadMatrixFromVectors<Matrix>(4, 4, rowmap, entries, values);
+
+  // |a_ij| >= 0.25 max_{k != i} |a_ik|
+  std::vector<int> rowmapSoC    = {0, 2, 5, 7, 9};
+  std::vector<int> entriesSoC   = {0, 1, 0, 1, 2, 1, 2, 2, 3};
+  std::vector<double> valuesSoC = {4, -1, -1, 4, -2, -2, 4, 0.4, 5};
+  Matrix Asoc_ref =
+      loadMatrixFromVectors<Matrix>(4, 4, rowmapSoC, entriesSoC, valuesSoC);
+  Matrix Asoc = KokkosSparse::filter_matrix(
+      A, KokkosSparse::StrengthOfConnection<Mag>{Mag(0.25)});
+  EXPECT_TRUE((Test::is_same_matrix<Matrix, TestDevice>(Asoc, Asoc_ref)));
+
+  // The graph only variant
+  auto Gsoc = KokkosSparse::filter_graph(
+      A, KokkosSparse::StrengthOfConnection<Mag>{Mag(0.25)});
+  Matrix AsocFromGraph("A", 4, Asoc_ref.values, Gsoc);
+  EXPECT_TRUE(
+      (Test::is_same_matrix<Matrix, TestDevice>(AsocFromGraph, Asoc_ref)));
+
+  // |a_ij| > 0.5, and |a_ij| > 0.2 max_k |a_ik| select the same entries,
+  // the diagonal being always kept
+  std::vector<int> rowmapTol    = {0, 2, 5, 7, 8};
+  std::vector<int> entriesTol   = {0, 1, 0, 1, 2, 1, 2, 3};
+  std::vector<double> valuesTol = {4, -1, -1, 4, -2, -2, 4, 5};
+  Matrix Atol_ref =
+      loadMatrixFromVectors<Matrix>(4, 4, rowmapTol, entriesTol, valuesTol);
+  Matrix Aabs = KokkosSparse::filter_matrix(
+      A, KokkosSparse::DropTolerance<Mag>{Mag(0.5)});
+  Matrix Arel = KokkosSparse::filter_matrix(
+      A, KokkosSparse::RelativeDropTolerance<Mag>{Mag(0.2)});
+  EXPECT_TRUE((Test::is_same_matrix<Matrix, TestDevice>(Aabs, Atol_ref)));
+  EXPECT_TRUE((Test::is_same_matrix<Matrix, TestDevice>(Arel, Atol_ref)));
+}
+
+TEST_F(TestCategory, sparse_filter_matrix) {
+  for (int testCase = 0; testCase < 10; testCase++)
+    testFilterMatrixPredicate(testCase);
+  testFilterMatrixThresholds();
+}
+
 #endif  // KOKKOSSPARSE_REMOVECRSZEROS_HPP
@@ -69,8 +69,32 @@ void test_rocsparse_singleton() {
   (void)s;
 }
 
+// Check that the handle cache gives each stream its own handle, bound to
+// that stream, and returns the same handle on every lookup
+void test_rocsparse_stream_handle() {
+  using Singleton = KokkosKernels::Impl::RocsparseSingleton;
+  auto instances  = Kokkos::Experimental::partition_space(Kokkos::HIP(), 1, 1);
+  hipStream_t s0  = instances[0].hip_stream();
+  hipStream_t s1  = instances[1].hip_stream();
+
+  rocsparse_handle h0 = Singleton::stream_handle(s0);
+  rocsparse_handle h1 = Singleton::stream_handle(s1);
+  EXPECT_NE(h0, h1);
+  EXPECT_EQ(h0, Singleton::stream_handle(s0));
+  EXPECT_EQ(h1, Singleton::stream_handle(s1));
+
+  hipStream_t bound;
+  KOKKOS_ROCSPARSE_SAFE_CALL_IMPL(rocsparse_get_stream(h0, &bound));
+  EXPECT_EQ(bound, s0);
+  KOKKOS_ROCSPARSE_SAFE_CALL_IMPL(rocsparse_get_stream(h1, &bound));
+  EXPECT_EQ(bound, s1);
+}
+
 TEST_F(TestCategory, sparse_rocsparse_version) { test_rocsparse_version(); }
 TEST_F(TestCategory, sparse_rocsparse_safe_call) { test_rocsparse_safe_call(); }
 TEST_F(TestCategory, sparse_rocsparse_singleton) { test_rocsparse_singleton(); }
+TEST_F(TestCategory, sparse_rocsparse_stream_handle) {
+  test_rocsparse_stream_handle();
+}
 
 #endif  // check for HIP and rocSPARSE
@@ -0,0 +1,109 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_rsvd.hpp"
+#include "KokkosKernels_TestUtils.hpp"
+
+namespace Test {
+
+// A is m-by-n with a single entry 2^-i in row i < min(m, n), at column
+// n - 1 - i, so its singular values are 2^-i and its singular vectors are
+// unit vectors.
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void run_test_rsvd(lno_t m, lno_t n, int k, int oversample,
+                   int power_iters) {
+  using crsMat_t =
+      KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using rowmap_t   = typename crsMat_t::StaticCrsGraphType::row_map_type::
+      non_const_type;
+  using entries_t  = typename crsMat_t::StaticCrsGraphType::entries_type::
+      non_const_type;
+  using values_t   = typename crsMat_t::values_type::non_const_type;
+  using vec_t      = Kokkos::View<scalar_t*, device>;
+  using mv_t       = Kokkos::View<scalar_t**, Kokkos::LayoutLeft, device>;
+  using mag_t      = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+  using exec_space = typename device::execution_space;
+
+  const lno_t r = Kokkos::min(m, n);
+  rowmap_t rowmap("rowmap", m + 1);
+  entries_t entries("entries", r);
+  values_t values("values", r);
+  auto rowmap_h  = Kokkos::create_mirror_view(rowmap);
+  auto entries_h = Kokkos::create_mirror_view(entries);
+  auto values_h  = Kokkos::create_mirror_view(values);
+  for (lno_t i = 0; i <= m; i++) rowmap_h(i) = Kokkos::min(i, r);
+  for (lno_t i = 0; i < r; i++) {
+    entries_h(i) = n - 1 - i;
+    values_h(i)  = scalar_t(Kokkos::pow(0.5, i));
+  }
+  Kokkos::deep_copy(rowmap, rowmap_h);
+  Kokkos::deep_copy(entries, entries_h);
+  Kokkos::deep_copy(values, values_h);
+  crsMat_t A("A", m, n, r, values, rowmap, entries);
+
+  vec_t S("S", k);
+  mv_t U("U", m, k), Vt("Vt", k, n);
+  KokkosSparse::Experimental::rsvd(exec_space(), A, k, oversample,
+                                   power_iters, S, U, Vt);
+
+  auto S_h  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), S);
+  auto U_h  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), U);
+  auto Vt_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), Vt);
+
+  const mag_t tol = 100 * (k + oversample) * Kokkos::ArithTraits<mag_t>::eps();
+  for (int i = 0; i < k; i++) {
+    EXPECT_NEAR(S_h(i), Kokkos::pow(0.5, i), tol);
+    // The i-th singular vectors are e_i and e_{n-1-i} up to a common sign
+    for (lno_t row = 0; row < m; row++) {
+      const mag_t ref = (row == i) ? 1 : 0;
+      EXPECT_NEAR(Kokkos::abs(U_h(row, i)), ref, tol);
+    }
+    for (lno_t col = 0; col < n; col++) {
+      const mag_t ref = (col == n - 1 - i) ? 1 : 0;
+      EXPECT_NEAR(Kokkos::abs(Vt_h(i, col)), ref, tol);
+    }
+    const scalar_t sign = U_h(i, i) * Vt_h(i, n - 1 - i);
+    EXPECT_NEAR(sign, 1, tol);
+  }
+}
+
+}  // namespace Test
+
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void test_rsvd() {
+  // rsvd is only available for real scalars
+  if constexpr (!Kokkos::ArithTraits<scalar_t>::is_complex) {
+    Test::run_test_rsvd<scalar_t, lno_t, size_type, device>(1, 1, 1, 0, 0);
+    Test::run_test_rsvd<scalar_t, lno_t, size_type, device>(500, 60, 6, 6, 2);
+    Test::run_test_rsvd<scalar_t, lno_t, size_type, device>(60, 500, 6, 6, 2);
+    Test::run_test_rsvd<scalar_t, lno_t, size_type, device>(40, 8, 8, 4, 1);
+  }
+}
+
+#define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)      \
+  TEST_F(TestCategory,                                                   \
+         sparse##_##rsvd##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    test_rsvd<SCALAR, ORDINAL, OFFSET, DEVICE>();                        \
+  }
+
+#include <Test_Common_Test_All_Type_Combos.hpp>
+
+#undef KOKKOSKERNELS_EXECUTE_TEST
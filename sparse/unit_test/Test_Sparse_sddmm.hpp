@@ -0,0 +1,128 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+
+#include "KokkosSparse_Utils.hpp"
+#include "KokkosSparse_sddmm.hpp"
+#include "KokkosKernels_TestUtils.hpp"
+
+namespace Test {
+
+// Compare sddmm against dot products on the host, with the tolerance of
+// each entry scaled by |S(i, j)| (|A(i, :)| . |B(j, :)|)
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device, typename ALayout, typename BLayout>
+void run_test_sddmm(lno_t m, lno_t n, lno_t k, size_type nnz) {
+  using crsMat_t =
+      KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using values_t   = typename crsMat_t::values_type::non_const_type;
+  using a_t        = Kokkos::View<scalar_t**, ALayout, device>;
+  using b_t        = Kokkos::View<scalar_t**, BLayout, device>;
+  using exec_space = typename device::execution_space;
+  using AT         = Kokkos::ArithTraits<scalar_t>;
+  using mag_t      = typename AT::mag_type;
+
+  crsMat_t S = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      m, n, nnz, 5, n / 2 + 1);
+  a_t A("A", m, k);
+  b_t B("B", n, k);
+  Kokkos::Random_XorShift64_Pool<exec_space> rand_pool(4242);
+  Kokkos::fill_random(A, rand_pool, scalar_t(1));
+  Kokkos::fill_random(B, rand_pool, scalar_t(1));
+
+  crsMat_t C("C", S.numRows(), S.numCols(), S.nnz(),
+             values_t("C values", S.nnz()), S.graph.row_map,
+             S.graph.entries);
+  KokkosSparse::sddmm(S, A, B, C);
+
+  auto row_map = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                     S.graph.row_map);
+  auto entries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                     S.graph.entries);
+  auto S_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), S.values);
+  auto A_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A);
+  auto B_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), B);
+  auto C_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), C.values);
+  const mag_t eps = 1e3 * Kokkos::ArithTraits<mag_t>::eps();
+  std::vector<scalar_t> expected(S.nnz());
+  std::vector<mag_t> scale(S.nnz());
+  for (lno_t i = 0; i < m; i++) {
+    for (size_type q = row_map(i); q < row_map(i + 1); q++) {
+      const lno_t j = entries(q);
+      scalar_t dot  = AT::zero();
+      mag_t abs_dot = 0;
+      for (lno_t l = 0; l < k; l++) {
+        dot += A_h(i, l) * B_h(j, l);
+        abs_dot += AT::abs(A_h(i, l)) * AT::abs(B_h(j, l));
+      }
+      expected[q] = S_h(q) * dot;
+      scale[q]    = AT::abs(S_h(q)) * abs_dot;
+      EXPECT_LE(AT::abs(C_h(q) - expected[q]), eps * scale[q]) << q;
+    }
+  }
+
+  // C may share the values of S
+  values_t S_values("S values", S.nnz());
+  Kokkos::deep_copy(S_values, S.values);
+  crsMat_t S2("S2", S.numRows(), S.numCols(), S.nnz(), S_values,
+              S.graph.row_map, S.graph.entries);
+  KokkosSparse::sddmm(exec_space(), S2, A, B, S2);
+  auto S2_h =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), S2.values);
+  for (size_type q = 0; q < S.nnz(); q++)
+    EXPECT_LE(AT::abs(S2_h(q) - expected[q]), eps * scale[q]) << q;
+
+  a_t A_wide("A_wide", m, k + 1);
+  EXPECT_THROW(KokkosSparse::sddmm(S, A_wide, B, C), std::runtime_error);
+}
+
+}  // namespace Test
+
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void test_sddmm() {
+  using LL = Kokkos::LayoutLeft;
+  using LR = Kokkos::LayoutRight;
+  Test::run_test_sddmm<scalar_t, lno_t, size_type, device, LL, LL>(1, 1, 1,
+                                                                    1);
+  Test::run_test_sddmm<scalar_t, lno_t, size_type, device, LL, LL>(
+      500, 300, 16, 500 * 8);
+  Test::run_test_sddmm<scalar_t, lno_t, size_type, device, LR, LR>(
+      500, 300, 16, 500 * 8);
+  Test::run_test_sddmm<scalar_t, lno_t, size_type, device, LR, LL>(
+      300, 400, 65, 300 * 10);
+  Test::run_test_sddmm<scalar_t, lno_t, size_type, device, LL, LR>(
+      200, 200, 3, 200 * 20);
+  Test::run_test_sddmm<scalar_t, lno_t, size_type, device, LL, LL>(
+      100, 100, 0, 100 * 5);
+  Test::run_test_sddmm<scalar_t, lno_t, size_type, device, LL, LL>(10, 10, 8,
+                                                                    0);
+}
+
+#define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)   \
+  TEST_F(TestCategory,                                                \
+         sparse##_##sddmm##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    test_sddmm<SCALAR, ORDINAL, OFFSET, DEVICE>();                    \
+  }
+
+#include <Test_Common_Test_All_Type_Combos.hpp>
+
+#undef KOKKOSKERNELS_EXECUTE_TEST
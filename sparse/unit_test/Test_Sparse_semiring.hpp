@@ -0,0 +1,279 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <map>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+
+#include "KokkosSparse_Utils.hpp"
+#include "KokkosSparse_SortCrs.hpp"
+#include "KokkosSparse_spgemm.hpp"
+#include "KokkosSparse_spgemm_semiring.hpp"
+#include "KokkosSparse_spmv.hpp"
+#include "KokkosSparse_spmv_semiring.hpp"
+#include "KokkosKernels_TestUtils.hpp"
+// For Test::is_same_matrix
+#include "Test_Sparse_Utils.hpp"
+
+namespace Test {
+
+// Compare spmv_semiring, with and without accumulate, against a host loop
+// over the same semiring. Only plus-times rounds differently in another
+// order; min, max, or and the single products are exact.
+template <typename Semiring, typename crsMat_t, typename vec_t>
+void check_spmv_semiring(const crsMat_t& A, const vec_t& x,
+                         const vec_t& y0, bool exact) {
+  using size_type = typename crsMat_t::non_const_size_type;
+  using lno_t     = typename crsMat_t::non_const_ordinal_type;
+  using scalar_t  = typename crsMat_t::non_const_value_type;
+  using AT        = Kokkos::ArithTraits<scalar_t>;
+  using mag_t     = typename AT::mag_type;
+
+  const lno_t numRows = A.numRows();
+  const mag_t eps     = 1e3 * Kokkos::ArithTraits<mag_t>::eps();
+  auto row_map = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                     A.graph.row_map);
+  auto entries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                     A.graph.entries);
+  auto values =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.values);
+  auto x_h  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), x);
+  auto y0_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y0);
+
+  for (bool accumulate : {false, true}) {
+    vec_t y("y", numRows);
+    Kokkos::deep_copy(y, y0);
+    KokkosSparse::Experimental::spmv_semiring(Semiring(), A, x, y,
+                                              accumulate);
+    auto y_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y);
+    for (lno_t i = 0; i < numRows; ++i) {
+      scalar_t sum = Semiring::zero();
+      mag_t scale  = 0;
+      for (size_type k = row_map(i); k < row_map(i + 1); ++k) {
+        sum = Semiring::add(sum,
+                            Semiring::multiply(values(k), x_h(entries(k))));
+        scale += AT::abs(values(k)) * AT::abs(x_h(entries(k)));
+      }
+      if (accumulate) {
+        sum = Semiring::add(y0_h(i), sum);
+        scale += AT::abs(y0_h(i));
+      }
+      if (exact)
+        EXPECT_TRUE(y_h(i) == sum) << "row " << i;
+      else
+        EXPECT_LE(AT::abs(y_h(i) - sum), eps * scale) << "row " << i;
+    }
+  }
+}
+
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void run_test_spmv_semiring(lno_t numRows, lno_t numCols, size_type nnz,
+                            lno_t row_size_variance) {
+  using crsMat_t =
+      KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using vec_t      = Kokkos::View<scalar_t*, device>;
+  using exec_space = typename device::execution_space;
+  using namespace KokkosSparse::Experimental;
+
+  crsMat_t A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      numRows, numCols, nnz, row_size_variance, numCols / 2);
+  Kokkos::Random_XorShift64_Pool<exec_space> rand_pool(2468);
+  vec_t x("x", numCols), y0("y0", numRows);
+  Kokkos::fill_random(x, rand_pool, scalar_t(1));
+  Kokkos::fill_random(y0, rand_pool, scalar_t(1));
+
+  check_spmv_semiring<PlusTimesSemiring<scalar_t>>(A, x, y0, false);
+  if constexpr (!Kokkos::ArithTraits<scalar_t>::is_complex) {
+    check_spmv_semiring<MinPlusSemiring<scalar_t>>(A, x, y0, true);
+    check_spmv_semiring<MaxPlusSemiring<scalar_t>>(A, x, y0, true);
+    check_spmv_semiring<MaxTimesSemiring<scalar_t>>(A, x, y0, true);
+    check_spmv_semiring<OrAndSemiring<scalar_t>>(A, x, y0, true);
+  }
+
+  // The plus-times semiring is the usual spmv
+  vec_t y("y", numRows), y_ref("y_ref", numRows);
+  spmv_semiring(PlusTimesSemiring<scalar_t>(), A, x, y);
+  KokkosSparse::spmv("N", scalar_t(1), A, x, scalar_t(0), y_ref);
+  using mag_t = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+  EXPECT_NEAR_KK_REL_1DVIEW(y, y_ref,
+                            mag_t(1e3) * Kokkos::ArithTraits<mag_t>::eps());
+
+  vec_t y_short("y_short", numRows + 1);
+  EXPECT_THROW(spmv_semiring(PlusTimesSemiring<scalar_t>(), A, x, y_short),
+               std::runtime_error);
+}
+
+// C = A*B over Semiring on the host, with the entries of each row sorted
+template <typename Semiring, typename crsMat_t>
+crsMat_t spgemm_semiring_reference(const crsMat_t& A, const crsMat_t& B) {
+  using size_type = typename crsMat_t::non_const_size_type;
+  using lno_t     = typename crsMat_t::non_const_ordinal_type;
+  using scalar_t  = typename crsMat_t::non_const_value_type;
+  using rowmap_t  = typename crsMat_t::row_map_type::non_const_type;
+  using entries_t = typename crsMat_t::index_type::non_const_type;
+  using values_t  = typename crsMat_t::values_type::non_const_type;
+
+  auto Arowmap = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                     A.graph.row_map);
+  auto Aentries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                      A.graph.entries);
+  auto Avalues =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.values);
+  auto Browmap = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                     B.graph.row_map);
+  auto Bentries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                      B.graph.entries);
+  auto Bvalues =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), B.values);
+
+  const lno_t numRows = A.numRows();
+  rowmap_t rowmap("C rowmap", numRows + 1);
+  auto rowmap_h = Kokkos::create_mirror_view(rowmap);
+  std::vector<lno_t> entries;
+  std::vector<scalar_t> values;
+  for (lno_t i = 0; i < numRows; i++) {
+    std::map<lno_t, scalar_t> row;
+    for (size_type ka = Arowmap(i); ka < Arowmap(i + 1); ka++) {
+      const lno_t k = Aentries(ka);
+      for (size_type kb = Browmap(k); kb < Browmap(k + 1); kb++) {
+        auto it = row.emplace(Bentries(kb), Semiring::zero()).first;
+        it->second = Semiring::add(
+            it->second, Semiring::multiply(Avalues(ka), Bvalues(kb)));
+      }
+    }
+    for (const auto& [j, v] : row) {
+      entries.push_back(j);
+      values.push_back(v);
+    }
+    rowmap_h(i + 1) = entries.size();
+  }
+  Kokkos::deep_copy(rowmap, rowmap_h);
+  entries_t entriesC("C entries", entries.size());
+  values_t valuesC("C values", values.size());
+  auto entries_h = Kokkos::create_mirror_view(entriesC);
+  auto values_h  = Kokkos::create_mirror_view(valuesC);
+  for (size_t q = 0; q < entries.size(); q++) {
+    entries_h(q) = entries[q];
+    values_h(q)  = values[q];
+  }
+  Kokkos::deep_copy(entriesC, entries_h);
+  Kokkos::deep_copy(valuesC, values_h);
+  return crsMat_t("C ref", numRows, B.numCols(), entries.size(), valuesC,
+                  rowmap, entriesC);
+}
+
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void run_test_spgemm_semiring(lno_t m, lno_t k, lno_t n, size_type nnz) {
+  using crsMat_t =
+      KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using KernelHandle = KokkosKernels::Experimental::KokkosKernelsHandle<
+      size_type, lno_t, scalar_t, typename device::execution_space,
+      typename device::memory_space, typename device::memory_space>;
+  using namespace KokkosSparse::Experimental;
+
+  crsMat_t A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      m, k, nnz, 5, k / 2 + 1);
+  crsMat_t B = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      k, n, nnz, 5, n / 2 + 1);
+  KokkosSparse::sort_crs_matrix(A);
+  KokkosSparse::sort_crs_matrix(B);
+
+  // The plus-times semiring is the usual product
+  crsMat_t C = spgemm_semiring<crsMat_t>(A, B, PlusTimesSemiring<scalar_t>());
+  crsMat_t C_ref = KokkosSparse::spgemm<crsMat_t>(A, false, B, false);
+  KokkosSparse::sort_crs_matrix(C_ref);
+  EXPECT_TRUE((is_same_matrix<crsMat_t, device>(C, C_ref)));
+
+  if constexpr (!Kokkos::ArithTraits<scalar_t>::is_complex) {
+    // Symbolic once, then numeric over two semirings of the same pattern
+    KernelHandle kh;
+    kh.create_spgemm_handle();
+    crsMat_t D;
+    spgemm_semiring_symbolic(kh, A, B, D);
+    spgemm_semiring_numeric(kh, A, B, D, MinPlusSemiring<scalar_t>());
+    crsMat_t D_ref =
+        spgemm_semiring_reference<MinPlusSemiring<scalar_t>>(A, B);
+    EXPECT_TRUE((is_same_matrix<crsMat_t, device>(D, D_ref)));
+    spgemm_semiring_numeric(kh, A, B, D, MaxTimesSemiring<scalar_t>());
+    D_ref = spgemm_semiring_reference<MaxTimesSemiring<scalar_t>>(A, B);
+    EXPECT_TRUE((is_same_matrix<crsMat_t, device>(D, D_ref)));
+    kh.destroy_spgemm_handle();
+
+    // A semiring under a mask: the diagonal of the Boolean A*A
+    if (m == k && k == n) {
+      crsMat_t I = KokkosSparse::Impl::kk_generate_diag_matrix<crsMat_t>(m);
+      crsMat_t E =
+          spgemm_masked<crsMat_t>(I, false, A, A, OrAndSemiring<scalar_t>());
+      crsMat_t E_full =
+          spgemm_semiring_reference<OrAndSemiring<scalar_t>>(A, A);
+      auto E_row_map = Kokkos::create_mirror_view_and_copy(
+          Kokkos::HostSpace(), E.graph.row_map);
+      auto E_entries = Kokkos::create_mirror_view_and_copy(
+          Kokkos::HostSpace(), E.graph.entries);
+      auto E_values =
+          Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), E.values);
+      auto F_row_map = Kokkos::create_mirror_view_and_copy(
+          Kokkos::HostSpace(), E_full.graph.row_map);
+      auto F_entries = Kokkos::create_mirror_view_and_copy(
+          Kokkos::HostSpace(), E_full.graph.entries);
+      for (lno_t i = 0; i < m; i++) {
+        bool has_diag = false;
+        for (size_type q = F_row_map(i); q < F_row_map(i + 1); q++)
+          has_diag = has_diag || F_entries(q) == i;
+        ASSERT_EQ(size_type(E_row_map(i + 1) - E_row_map(i)),
+                  size_type(has_diag ? 1 : 0));
+        if (has_diag) {
+          EXPECT_EQ(E_entries(E_row_map(i)), i);
+          EXPECT_TRUE(E_values(E_row_map(i)) == scalar_t(1));
+        }
+      }
+    }
+  }
+}
+
+}  // namespace Test
+
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void test_semiring() {
+  Test::run_test_spmv_semiring<scalar_t, lno_t, size_type, device>(1, 1, 1,
+                                                                   0);
+  Test::run_test_spmv_semiring<scalar_t, lno_t, size_type, device>(
+      1000, 1000, 5000, 20);
+  Test::run_test_spmv_semiring<scalar_t, lno_t, size_type, device>(
+      503, 311, 3000, 40);
+  Test::run_test_spgemm_semiring<scalar_t, lno_t, size_type, device>(
+      500, 500, 500, 500 * 10);
+  Test::run_test_spgemm_semiring<scalar_t, lno_t, size_type, device>(
+      300, 200, 100, 300 * 5);
+  Test::run_test_spgemm_semiring<scalar_t, lno_t, size_type, device>(10, 10,
+                                                                     10, 0);
+}
+
+#define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)      \
+  TEST_F(TestCategory,                                                   \
+         sparse##_##semiring##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    test_semiring<SCALAR, ORDINAL, OFFSET, DEVICE>();                    \
+  }
+
+#include <Test_Common_Test_All_Type_Combos.hpp>
+
+#undef KOKKOSKERNELS_EXECUTE_TEST
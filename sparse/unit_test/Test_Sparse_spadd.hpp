@@ -101,7 +101,7 @@ crsMat_t randomMatrix(ordinal_type nrows, ordinal_type ncols,
 
 template <typename scalar_t, typename lno_t, typename size_type, class Device>
 void test_spadd(lno_t numRows, lno_t numCols, size_type minNNZ,
-                size_type maxNNZ, bool sortRows) {
+                size_type maxNNZ, bool sortRows, bool useWorkspace = false) {
   typedef
       typename KokkosSparse::CrsMatrix<scalar_t, lno_t, Device, void, size_type>
           crsMat_t;
@@ -135,10 +135,22 @@ void test_spadd(lno_t numRows, lno_t numCols, size_type minNNZ,
   // initialized
   Kokkos::deep_copy(c_row_map, (size_type)5);
   auto addHandle = handle.get_spadd_handle();
+  typename KernelHandle::SPADDHandleType::workspace_t workspace;
+  if (useWorkspace) addHandle->set_workspace(&workspace);
   typename Device::execution_space exec{};
   KokkosSparse::Experimental::spadd_symbolic(
       exec, &handle, numRows, numCols, A.graph.row_map, A.graph.entries,
       B.graph.row_map, B.graph.entries, c_row_map);
+  if (useWorkspace) {
+    // The temporaries of symbolic come from the workspace: only the first
+    // call allocates
+    const size_t num_allocations = workspace.num_allocations();
+    KokkosSparse::Experimental::spadd_symbolic(
+        exec, &handle, numRows, numCols, A.graph.row_map, A.graph.entries,
+        B.graph.row_map, B.graph.entries, c_row_map);
+    EXPECT_EQ(workspace.num_allocations(), num_allocations);
+    EXPECT_EQ(workspace.bytes_in_use(), size_t(0));
+  }
   size_type c_nnz = addHandle->get_c_nnz();
   // Fill values, entries with incorrect incorret
   values_type c_values(
@@ -264,6 +276,195 @@ void test_spadd_known_columns() {
   ASSERT_EQ(A.nnz(), C.nnz());
 }
 
+// k-way addition C = sum_j alpha_j A_j of sorted matrices, checked against
+// a dense host sum. The numeric phase is called twice with the same handle
+// and different coefficients.
+template <typename scalar_t, typename lno_t, typename size_type, class Device>
+void test_spadd_multi(int k, lno_t numRows, lno_t numCols, size_type minNNZ,
+                      size_type maxNNZ) {
+  using crsMat_t =
+      KokkosSparse::CrsMatrix<scalar_t, lno_t, Device, void, size_type>;
+  using KAT          = Kokkos::ArithTraits<scalar_t>;
+  using KernelHandle = KokkosKernels::Experimental::KokkosKernelsHandle<
+      size_type, lno_t, scalar_t, typename Device::execution_space,
+      typename Device::memory_space, typename Device::memory_space>;
+
+  srand((numRows << 1) ^ numCols ^ k);
+  std::vector<crsMat_t> As;
+  for (int j = 0; j < k; j++) {
+    As.push_back(
+        randomMatrix<crsMat_t, lno_t>(numRows, numCols, minNNZ, maxNNZ, true));
+  }
+
+  KernelHandle handle;
+  handle.create_spadd_handle(true, static_cast<lno_t>(maxNNZ) <= numCols);
+  crsMat_t C;
+  KokkosSparse::Experimental::spadd_multi_symbolic(&handle, As, C);
+  ASSERT_EQ(numRows, C.numRows());
+  ASSERT_EQ(numCols, C.numCols());
+
+  for (int trial = 0; trial < 2; trial++) {
+    std::vector<scalar_t> alphas;
+    for (int j = 0; j < k; j++) {
+      alphas.push_back(scalar_t(trial ? 0.5 * (j + 1) : 1.0 - j));
+    }
+    KokkosSparse::Experimental::spadd_multi_numeric(&handle, alphas, As, C);
+
+    auto Crowmap = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                       C.graph.row_map);
+    auto Centries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                        C.graph.entries);
+    auto Cvalues =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), C.values);
+    std::vector<std::vector<scalar_t>> correct(
+        numRows, std::vector<scalar_t>(numCols, KAT::zero()));
+    std::vector<std::vector<bool>> nonzeros(numRows,
+                                            std::vector<bool>(numCols, false));
+    for (int j = 0; j < k; j++) {
+      auto rowmap = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                        As[j].graph.row_map);
+      auto entries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                         As[j].graph.entries);
+      auto values = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                        As[j].values);
+      for (lno_t row = 0; row < numRows; row++) {
+        for (size_type i = rowmap(row); i < rowmap(row + 1); i++) {
+          correct[row][entries(i)] += alphas[j] * values(i);
+          nonzeros[row][entries(i)] = true;
+        }
+      }
+    }
+    for (lno_t row = 0; row < numRows; row++) {
+      size_type nz = 0;
+      for (lno_t i = 0; i < numCols; i++) {
+        if (nonzeros[row][i]) nz++;
+      }
+      ASSERT_EQ(Crowmap(row + 1) - Crowmap(row), nz) << "row " << row;
+      for (size_type i = Crowmap(row); i < Crowmap(row + 1); i++) {
+        if (i > Crowmap(row)) {
+          ASSERT_LT(Centries(i - 1), Centries(i)) << "row " << row;
+        }
+        const lno_t col = Centries(i);
+        ASSERT_TRUE(nonzeros[row][col]);
+        const auto mag = KAT::abs(correct[row][col]);
+        const auto tol = KAT::abs(KAT::epsilon()) * 4 * k * (mag + 1);
+        ASSERT_LE(KAT::abs(correct[row][col] - Cvalues(i)), tol)
+            << "row " << row << ", column " << col;
+      }
+    }
+  }
+  handle.destroy_spadd_handle();
+}
+
+// Pattern reuse: when B has the same pattern as A, or a subset of it, and A's
+// rows are sorted, symbolic records that and numeric skips the merge. Checks
+// the detected pattern kind and the values of two numeric calls against a
+// dense host sum. subset = false gives B exactly A's pattern; subset = true
+// keeps only every other entry of each row of A.
+template <typename scalar_t, typename lno_t, typename size_type, class Device>
+void test_spadd_pattern_reuse(lno_t numRows, lno_t numCols, size_type minNNZ,
+                              size_type maxNNZ, bool sortRows, bool subset) {
+  using crsMat_t =
+      KokkosSparse::CrsMatrix<scalar_t, lno_t, Device, void, size_type>;
+  using row_map_type = typename crsMat_t::row_map_type::non_const_type;
+  using entries_type = typename crsMat_t::index_type::non_const_type;
+  using values_type  = typename crsMat_t::values_type::non_const_type;
+  using KAT          = Kokkos::ArithTraits<scalar_t>;
+  using KernelHandle = KokkosKernels::Experimental::KokkosKernelsHandle<
+      size_type, lno_t, scalar_t, typename Device::execution_space,
+      typename Device::memory_space, typename Device::memory_space>;
+  using spadd_handle_t = typename KernelHandle::SPADDHandleType;
+
+  srand((numRows << 1) ^ numCols ^ (subset ? 7 : 3));
+  crsMat_t A =
+      randomMatrix<crsMat_t, lno_t>(numRows, numCols, minNNZ, maxNNZ, sortRows);
+  auto Arowmap =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.row_map);
+  auto Aentries =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.entries);
+  auto Avalues =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.values);
+
+  // B: A's pattern (or every other entry of it) with new values
+  typename row_map_type::HostMirror Browmap("B rowmap host", numRows + 1);
+  for (lno_t row = 0; row < numRows; row++) {
+    size_type len    = Arowmap(row + 1) - Arowmap(row);
+    Browmap(row + 1) = Browmap(row) + (subset ? (len + 1) / 2 : len);
+  }
+  const size_type Bnnz = Browmap(numRows);
+  typename entries_type::HostMirror Bentries("B entries host", Bnnz);
+  typename values_type::HostMirror Bvalues("B values host", Bnnz);
+  for (lno_t row = 0; row < numRows; row++) {
+    size_type k = Browmap(row);
+    for (size_type i = Arowmap(row); i < Arowmap(row + 1); i++) {
+      if (subset && (i - Arowmap(row)) % 2) continue;
+      Bentries(k) = Aentries(i);
+      Bvalues(k)  = KAT::one() * (((typename KAT::mag_type)rand()) /
+                                 static_cast<typename KAT::mag_type>(RAND_MAX));
+      k++;
+    }
+  }
+  row_map_type d_Browmap("B rowmap", numRows + 1);
+  entries_type d_Bentries("B entries", Bnnz);
+  values_type d_Bvalues("B values", Bnnz);
+  Kokkos::deep_copy(d_Browmap, Browmap);
+  Kokkos::deep_copy(d_Bentries, Bentries);
+  Kokkos::deep_copy(d_Bvalues, Bvalues);
+  crsMat_t B("B", numRows, numCols, Bnnz, d_Bvalues, d_Browmap, d_Bentries);
+
+  // input_merged = false keeps symbolic and numeric on the native kernels
+  KernelHandle handle;
+  handle.create_spadd_handle(sortRows, false);
+  crsMat_t C;
+  KokkosSparse::spadd_symbolic(&handle, A, B, C);
+  // unsorted rows of A disable the fast path
+  auto expected = spadd_handle_t::GENERAL_PATTERN;
+  if (sortRows && A.nnz() && B.nnz()) {
+    expected = subset ? spadd_handle_t::B_SUBSET_OF_A_PATTERN
+                      : spadd_handle_t::IDENTICAL_PATTERN;
+  }
+  ASSERT_EQ(handle.get_spadd_handle()->get_pattern_kind(), expected);
+  ASSERT_EQ(C.nnz(), A.nnz());
+
+  for (int trial = 0; trial < 2; trial++) {
+    const scalar_t alpha = scalar_t(trial ? 1.0 : 0.5);
+    const scalar_t beta  = scalar_t(trial ? -0.25 : 2.0);
+    KokkosSparse::spadd_numeric(&handle, alpha, A, beta, B, C);
+    auto Crowmap = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                       C.graph.row_map);
+    auto Centries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                        C.graph.entries);
+    auto Cvalues =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), C.values);
+    for (lno_t row = 0; row < numRows; row++) {
+      std::vector<scalar_t> correct(numCols, KAT::zero());
+      std::vector<bool> nonzeros(numCols, false);
+      for (size_type i = Arowmap(row); i < Arowmap(row + 1); i++) {
+        correct[Aentries(i)] += alpha * Avalues(i);
+        nonzeros[Aentries(i)] = true;
+      }
+      for (size_type i = Browmap(row); i < Browmap(row + 1); i++) {
+        correct[Bentries(i)] += beta * Bvalues(i);
+      }
+      ASSERT_EQ(Crowmap(row + 1) - Crowmap(row),
+                Arowmap(row + 1) - Arowmap(row))
+          << "row " << row;
+      for (size_type i = Crowmap(row); i < Crowmap(row + 1); i++) {
+        if (i > Crowmap(row)) {
+          ASSERT_LT(Centries(i - 1), Centries(i)) << "row " << row;
+        }
+        const lno_t col = Centries(i);
+        ASSERT_TRUE(nonzeros[col]);
+        const auto mag = KAT::abs(correct[col]);
+        const auto tol = KAT::abs(KAT::epsilon()) * 4 * (mag + 1);
+        ASSERT_LE(KAT::abs(correct[col] - Cvalues(i)), tol)
+            << "row " << row << ", column " << col;
+      }
+    }
+  }
+  handle.destroy_spadd_handle();
+}
+
 #define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)                   \
   TEST_F(                                                                             \
       TestCategory,                                                                   \
@@ -273,6 +474,15 @@ void test_spadd_known_columns() {
     test_spadd<SCALAR, ORDINAL, OFFSET, DEVICE>(100, 100, 50, 100, true);             \
     test_spadd<SCALAR, ORDINAL, OFFSET, DEVICE>(50, 50, 75, 100, true);               \
     test_spadd_known_columns<SCALAR, ORDINAL, OFFSET, DEVICE>();                      \
+    test_spadd_multi<SCALAR, ORDINAL, OFFSET, DEVICE>(1, 10, 10, 0, 2);               \
+    test_spadd_multi<SCALAR, ORDINAL, OFFSET, DEVICE>(4, 100, 100, 0, 20);            \
+    test_spadd_multi<SCALAR, ORDINAL, OFFSET, DEVICE>(8, 50, 50, 75, 100);            \
+    test_spadd_pattern_reuse<SCALAR, ORDINAL, OFFSET, DEVICE>(                        \
+        10, 10, 0, 2, true, false);                                                   \
+    test_spadd_pattern_reuse<SCALAR, ORDINAL, OFFSET, DEVICE>(                        \
+        100, 100, 5, 50, true, false);                                                \
+    test_spadd_pattern_reuse<SCALAR, ORDINAL, OFFSET, DEVICE>(                        \
+        100, 100, 5, 50, true, true);                                                 \
   }                                                                                   \
   TEST_F(                                                                             \
       TestCategory,                                                                   \
@@ -281,6 +491,9 @@ void test_spadd_known_columns() {
     test_spadd<SCALAR, ORDINAL, OFFSET, DEVICE>(10, 10, 0, 2, false);                 \
     test_spadd<SCALAR, ORDINAL, OFFSET, DEVICE>(100, 100, 50, 100, false);            \
     test_spadd<SCALAR, ORDINAL, OFFSET, DEVICE>(50, 50, 75, 100, false);              \
+    test_spadd<SCALAR, ORDINAL, OFFSET, DEVICE>(100, 100, 50, 100, false, true);      \
+    test_spadd_pattern_reuse<SCALAR, ORDINAL, OFFSET, DEVICE>(                        \
+        100, 100, 5, 50, false, false);                                               \
   }
 
 #include <Test_Common_Test_All_Type_Combos.hpp>
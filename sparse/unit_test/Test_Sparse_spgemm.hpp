@@ -21,8 +21,12 @@
 #include "KokkosSparse_SortCrs.hpp"
 // For Test::is_same_matrix
 #include "Test_Sparse_Utils.hpp"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
 #include <string>
 #include <stdexcept>
+#include <vector>
 
 #include "KokkosSparse_spgemm.hpp"
 #include "KokkosSparse_CrsMatrix.hpp"
@@ -525,6 +529,483 @@ void test_issue1738() {
 #endif
 }
 
+// With numeric reuse enabled, the first numeric records where each product
+// term goes in C, and later numerics (with new values of A and B) scatter
+// the terms directly. C must match a fresh product every time.
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void test_spgemm_numeric_reuse(lno_t m, lno_t k, lno_t n, size_type nnz,
+                               lno_t bandwidth, lno_t row_size_variance) {
+  using namespace Test;
+  using crsMat_t      = CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using scalar_view_t = typename crsMat_t::values_type::non_const_type;
+  using KernelHandle  = KokkosKernels::Experimental::KokkosKernelsHandle<
+      size_type, lno_t, scalar_t, typename device::execution_space,
+      typename device::memory_space, typename device::memory_space>;
+
+  crsMat_t A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      m, k, nnz, row_size_variance, bandwidth);
+  crsMat_t B = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      k, n, nnz, row_size_variance, bandwidth);
+  KokkosSparse::sort_crs_matrix(A);
+  KokkosSparse::sort_crs_matrix(B);
+
+  KernelHandle kh;
+  kh.create_spgemm_handle(SPGEMM_KK);
+  auto sh = kh.get_spgemm_handle();
+  EXPECT_FALSE(sh->get_numeric_reuse());
+  sh->set_numeric_reuse(true);
+  EXPECT_TRUE(sh->get_numeric_reuse());
+  EXPECT_FALSE(sh->is_numeric_reuse_ready());
+
+  crsMat_t C, C_ref;
+  KokkosSparse::spgemm_symbolic(kh, A, false, B, false, C);
+  KokkosSparse::spgemm_numeric(kh, A, false, B, false, C);
+  // An empty product has nothing to record
+  const bool empty = !A.nnz() || !B.nnz() || !m || !k || !n;
+  EXPECT_EQ(sh->is_numeric_reuse_ready(), !empty);
+  if (C.nnz()) EXPECT_GT(sh->get_numeric_reuse_bytes(), size_t(0));
+  run_spgemm_noreuse(A, B, C_ref);
+  EXPECT_TRUE((is_same_matrix<crsMat_t, device>(C, C_ref)));
+
+  for (int rep = 0; rep < 2; rep++) {
+    // New values (and new allocations) for A and B, same structure
+    A.values = scalar_view_t(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "new A values"),
+        A.nnz());
+    B.values = scalar_view_t(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "new B values"),
+        B.nnz());
+    randomize_matrix_values(A.values);
+    randomize_matrix_values(B.values);
+    KokkosSparse::spgemm_numeric(kh, A, false, B, false, C);
+    run_spgemm_noreuse(A, B, C_ref);
+    EXPECT_TRUE((is_same_matrix<crsMat_t, device>(C, C_ref))) << rep;
+  }
+
+  // Without the recorded positions, numeric rebuilds them
+  sh->clear_numeric_reuse_data();
+  EXPECT_FALSE(sh->is_numeric_reuse_ready());
+  KokkosSparse::spgemm_numeric(kh, A, false, B, false, C);
+  EXPECT_EQ(sh->is_numeric_reuse_ready(), !empty);
+  EXPECT_TRUE((is_same_matrix<crsMat_t, device>(C, C_ref)));
+
+  sh->set_numeric_reuse(false);
+  EXPECT_FALSE(sh->is_numeric_reuse_ready());
+  EXPECT_EQ(sh->get_numeric_reuse_bytes(), size_t(0));
+  kh.destroy_spgemm_handle();
+}
+
+// With the adaptive accumulator, the numeric phase picks the accumulator
+// per row. C must match the product with the default accumulator, and
+// again after new values of A and B.
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void test_spgemm_adaptive_accumulator(lno_t m, lno_t k, lno_t n,
+                                      size_type nnz, lno_t bandwidth,
+                                      lno_t row_size_variance) {
+  using namespace Test;
+  using crsMat_t      = CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using scalar_view_t = typename crsMat_t::values_type::non_const_type;
+  using KernelHandle  = KokkosKernels::Experimental::KokkosKernelsHandle<
+      size_type, lno_t, scalar_t, typename device::execution_space,
+      typename device::memory_space, typename device::memory_space>;
+
+  crsMat_t A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      m, k, nnz, row_size_variance, bandwidth);
+  crsMat_t B = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      k, n, nnz, row_size_variance, bandwidth);
+  KokkosSparse::sort_crs_matrix(A);
+  KokkosSparse::sort_crs_matrix(B);
+
+  KernelHandle kh;
+  kh.create_spgemm_handle(SPGEMM_KK);
+  kh.get_spgemm_handle()->set_accumulator_type(SPGEMM_ACC_ADAPTIVE);
+  crsMat_t C, C_ref;
+  KokkosSparse::spgemm_symbolic(kh, A, false, B, false, C);
+  KokkosSparse::spgemm_numeric(kh, A, false, B, false, C);
+  run_spgemm_noreuse(A, B, C_ref);
+  EXPECT_TRUE((is_same_matrix<crsMat_t, device>(C, C_ref)));
+
+  A.values = scalar_view_t(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "new A values"),
+      A.nnz());
+  B.values = scalar_view_t(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "new B values"),
+      B.nnz());
+  randomize_matrix_values(A.values);
+  randomize_matrix_values(B.values);
+  KokkosSparse::spgemm_numeric(kh, A, false, B, false, C);
+  run_spgemm_noreuse(A, B, C_ref);
+  EXPECT_TRUE((is_same_matrix<crsMat_t, device>(C, C_ref)));
+  kh.destroy_spgemm_handle();
+}
+
+// A^T * B and A * B^T must match the product with an explicit transpose.
+// A is k*m and B is k*n for A^T * B; A is m*k and B is n*k for A * B^T.
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void test_spgemm_transpose(lno_t m, lno_t k, lno_t n, size_type nnz,
+                           lno_t bandwidth, lno_t row_size_variance) {
+  using namespace Test;
+  using crsMat_t = CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+
+  size_type nnzA = nnz, nnzB = nnz;
+  crsMat_t A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      k, m, nnzA, row_size_variance, bandwidth);
+  crsMat_t B = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      k, n, nnzB, row_size_variance, bandwidth);
+  crsMat_t C = KokkosSparse::spgemm<crsMat_t>(A, true, B, false);
+  crsMat_t C_ref;
+  run_spgemm_noreuse(KokkosSparse::Impl::transpose_matrix(A), B, C_ref);
+  KokkosSparse::sort_crs_matrix(C_ref);
+  EXPECT_TRUE((is_same_matrix<crsMat_t, device>(C, C_ref)));
+
+  nnzA = nnz;
+  nnzB = nnz;
+  A    = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      m, k, nnzA, row_size_variance, bandwidth);
+  B    = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      n, k, nnzB, row_size_variance, bandwidth);
+  C    = KokkosSparse::spgemm<crsMat_t>(A, false, B, true);
+  run_spgemm_noreuse(A, KokkosSparse::Impl::transpose_matrix(B), C_ref);
+  KokkosSparse::sort_crs_matrix(C_ref);
+  EXPECT_TRUE((is_same_matrix<crsMat_t, device>(C, C_ref)));
+
+  EXPECT_THROW(KokkosSparse::spgemm<crsMat_t>(A, true, B, true),
+               std::invalid_argument);
+}
+
+// The memory estimate of each algorithm must bound the memory of C and of
+// the numeric reuse data, which are known after the product.
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void test_spgemm_memory_estimate(lno_t m, lno_t k, lno_t n, size_type nnz,
+                                 lno_t bandwidth, lno_t row_size_variance) {
+  using crsMat_t     = CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using KernelHandle = KokkosKernels::Experimental::KokkosKernelsHandle<
+      size_type, lno_t, scalar_t, typename device::execution_space,
+      typename device::memory_space, typename device::memory_space>;
+
+  crsMat_t A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      m, k, nnz, row_size_variance, bandwidth);
+  crsMat_t B = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      k, n, nnz, row_size_variance, bandwidth);
+
+  for (auto algo : {SPGEMM_KK, SPGEMM_KK_MEMORY, SPGEMM_KK_DENSE}) {
+    KernelHandle kh;
+    kh.create_spgemm_handle(algo);
+    auto sh = kh.get_spgemm_handle();
+    sh->set_numeric_reuse(true);
+    const SPGEMMMemoryEstimate estimate = sh->estimate_memory(
+        m, n, k, A.graph.row_map, A.graph.entries, B.graph.row_map);
+
+    crsMat_t C;
+    KokkosSparse::spgemm_symbolic(kh, A, false, B, false, C);
+    KokkosSparse::spgemm_numeric(kh, A, false, B, false, C);
+    const size_t c_bytes = C.graph.row_map.span() * sizeof(size_type) +
+                           C.nnz() * (sizeof(lno_t) + sizeof(scalar_t));
+    EXPECT_LE(c_bytes + sh->get_numeric_reuse_bytes(),
+              estimate.persistent_bytes)
+        << algo;
+    if (C.nnz()) EXPECT_GT(estimate.temporary_bytes, size_t(0)) << algo;
+    kh.destroy_spgemm_handle();
+  }
+}
+
+// A plan saved after spgemm_symbolic and loaded into a new handle must
+// give the same C as the original handle, without calling spgemm_symbolic.
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void test_spgemm_plan_io(lno_t m, lno_t k, lno_t n, size_type nnz,
+                         lno_t bandwidth, lno_t row_size_variance) {
+  using crsMat_t     = CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using graph_t      = typename crsMat_t::StaticCrsGraphType;
+  using rowmap_t     = typename graph_t::row_map_type::non_const_type;
+  using entries_t    = typename graph_t::entries_type::non_const_type;
+  using values_t     = typename crsMat_t::values_type::non_const_type;
+  using KernelHandle = KokkosKernels::Experimental::KokkosKernelsHandle<
+      size_type, lno_t, scalar_t, typename device::execution_space,
+      typename device::memory_space, typename device::memory_space>;
+
+  crsMat_t A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      m, k, nnz, row_size_variance, bandwidth);
+  crsMat_t B = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      k, n, nnz, row_size_variance, bandwidth);
+  KokkosSparse::sort_crs_matrix(A);
+  KokkosSparse::sort_crs_matrix(B);
+
+  for (auto algo : {SPGEMM_SERIAL, SPGEMM_KK, SPGEMM_KK_DENSE}) {
+    KernelHandle kh;
+    kh.create_spgemm_handle(algo);
+    crsMat_t C;
+    KokkosSparse::spgemm_symbolic(kh, A, false, B, false, C);
+    std::stringstream plan;
+    if (!kh.get_spgemm_handle()->can_save_plan()) {
+      // The symbolic phase ran a TPL
+      EXPECT_THROW(kh.get_spgemm_handle()->save(plan, C.graph.row_map),
+                   std::runtime_error);
+      kh.destroy_spgemm_handle();
+      continue;
+    }
+    kh.get_spgemm_handle()->save(plan, C.graph.row_map);
+    KokkosSparse::spgemm_numeric(kh, A, false, B, false, C);
+    kh.destroy_spgemm_handle();
+
+    KernelHandle kh2;
+    kh2.create_spgemm_handle(algo);
+    rowmap_t row_mapC;
+    kh2.get_spgemm_handle()->load(plan, row_mapC);
+    EXPECT_TRUE(kh2.get_spgemm_handle()->is_plan_loaded());
+    ASSERT_EQ(row_mapC.extent(0), C.graph.row_map.extent(0)) << algo;
+    const size_type c_nnz = kh2.get_spgemm_handle()->get_c_nnz();
+    EXPECT_EQ(c_nnz, C.nnz()) << algo;
+    entries_t entriesC("entriesC", c_nnz);
+    values_t valuesC("valuesC", c_nnz);
+    KokkosSparse::Experimental::spgemm_numeric(
+        &kh2, m, k, n, A.graph.row_map, A.graph.entries, A.values, false,
+        B.graph.row_map, B.graph.entries, B.values, false, row_mapC, entriesC,
+        valuesC);
+    kh2.destroy_spgemm_handle();
+    crsMat_t C2("C2", m, n, c_nnz, valuesC, row_mapC, entriesC);
+    EXPECT_TRUE((is_same_matrix<crsMat_t, device>(C, C2))) << algo;
+  }
+
+  // A plan is only valid for the algorithm it was computed with
+  KernelHandle kh;
+  kh.create_spgemm_handle(SPGEMM_SERIAL);
+  crsMat_t C;
+  KokkosSparse::spgemm_symbolic(kh, A, false, B, false, C);
+  std::stringstream plan;
+  kh.get_spgemm_handle()->save(plan, C.graph.row_map);
+  kh.destroy_spgemm_handle();
+  kh.create_spgemm_handle(SPGEMM_KK_DENSE);
+  rowmap_t row_mapC;
+  EXPECT_THROW(kh.get_spgemm_handle()->load(plan, row_mapC),
+               std::runtime_error);
+  kh.destroy_spgemm_handle();
+}
+
+// With no algorithm requested, the selection picks one from the statistics
+// of A and B, records them and writes them to the dispatch trace. C must
+// match the serial product. A requested algorithm, or a disabled selection,
+// is kept.
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void test_spgemm_algorithm_selection(lno_t m, lno_t k, lno_t n,
+                                     size_type nnz, lno_t bandwidth,
+                                     lno_t row_size_variance) {
+  using crsMat_t     = CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using exec_space   = typename device::execution_space;
+  using KernelHandle = KokkosKernels::Experimental::KokkosKernelsHandle<
+      size_type, lno_t, scalar_t, exec_space, typename device::memory_space,
+      typename device::memory_space>;
+
+  crsMat_t A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      m, k, nnz, row_size_variance, bandwidth);
+  crsMat_t B = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      k, n, nnz, row_size_variance, bandwidth);
+  KokkosSparse::sort_crs_matrix(A);
+  KokkosSparse::sort_crs_matrix(B);
+  crsMat_t C_ref;
+  run_spgemm<crsMat_t, device>(A, B, SPGEMM_DEBUG, C_ref, false);
+
+  // Multiplications of the product, counted on the host
+  auto rowmapA  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                      A.graph.row_map);
+  auto entriesA = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                      A.graph.entries);
+  auto rowmapB  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                      B.graph.row_map);
+  size_t flops = 0, max_row_flops = 0;
+  for (lno_t i = 0; i < m; i++) {
+    size_t f = 0;
+    for (size_type q = rowmapA(i); q < rowmapA(i + 1); q++)
+      f += rowmapB(entriesA(q) + 1) - rowmapB(entriesA(q));
+    flops += f;
+    max_row_flops = std::max(max_row_flops, f);
+  }
+
+  const std::string path = "kokkoskernels_spgemm_selection_trace.json";
+  for (auto algo : {SPGEMM_DEFAULT, SPGEMM_KK}) {
+    KernelHandle kh;
+    kh.create_spgemm_handle(algo);
+    auto sh = kh.get_spgemm_handle();
+    EXPECT_TRUE(sh->is_algorithm_selection_pending());
+    std::remove(path.c_str());
+    KokkosKernels::Experimental::set_dispatch_trace(path);
+    crsMat_t C;
+    KokkosSparse::spgemm_symbolic(kh, A, false, B, false, C);
+    KokkosSparse::spgemm_numeric(kh, A, false, B, false, C);
+    KokkosKernels::Experimental::set_dispatch_trace("");
+    EXPECT_TRUE((is_same_matrix<crsMat_t, device>(C, C_ref))) << algo;
+
+    // Not run where a TPL performs the product
+    const SPGEMMSelection sel = sh->get_algorithm_selection_result();
+    std::ifstream trace(path);
+    std::string symbolic_line;
+    std::getline(trace, symbolic_line);
+    trace.close();
+    std::remove(path.c_str());
+    if (!sel.done) {
+      EXPECT_TRUE(
+          KokkosSparse::Impl::spgemm_tpl_may_be_used<exec_space>());
+      continue;
+    }
+    EXPECT_FALSE(sh->is_algorithm_selection_pending());
+    EXPECT_EQ(sel.flops, flops) << algo;
+    EXPECT_EQ(sel.max_row_flops, max_row_flops) << algo;
+    EXPECT_GT(sel.compression, 0.0) << algo;
+    EXPECT_LE(sel.compression, 1.0) << algo;
+    EXPECT_EQ(sh->get_algorithm_type(), sel.algorithm) << algo;
+    EXPECT_TRUE(sel.algorithm == SPGEMM_KK_DENSE ||
+                sel.algorithm == SPGEMM_KK_MEMORY ||
+                sel.algorithm == SPGEMM_KK_LP ||
+                (algo == SPGEMM_DEFAULT && sel.algorithm == SPGEMM_SERIAL))
+        << algo << " " << get_spgemm_algorithm_name(sel.algorithm);
+    EXPECT_NE(symbolic_line.find("\"kernel\":\"spgemm_symbolic\""),
+              std::string::npos)
+        << symbolic_line;
+    EXPECT_NE(symbolic_line.find("\"algorithm\":\"" +
+                                 get_spgemm_algorithm_name(sel.algorithm)),
+              std::string::npos)
+        << symbolic_line;
+    EXPECT_NE(symbolic_line.find("\"detail\":{\"flops\":" +
+                                 std::to_string(flops)),
+              std::string::npos)
+        << symbolic_line;
+  }
+
+  // Overrides: an algorithm set by the caller, a disabled selection
+  for (bool disable : {false, true}) {
+    KernelHandle kh;
+    kh.create_spgemm_handle(disable ? SPGEMM_KK : SPGEMM_DEFAULT);
+    auto sh = kh.get_spgemm_handle();
+    if (disable)
+      sh->set_algorithm_selection(false);
+    else
+      sh->set_algorithm_type(SPGEMM_KK_MEMORY);
+    EXPECT_FALSE(sh->is_algorithm_selection_pending());
+    const SPGEMMAlgorithm expected = sh->get_algorithm_type();
+    crsMat_t C;
+    KokkosSparse::spgemm_symbolic(kh, A, false, B, false, C);
+    KokkosSparse::spgemm_numeric(kh, A, false, B, false, C);
+    EXPECT_TRUE((is_same_matrix<crsMat_t, device>(C, C_ref)));
+    EXPECT_FALSE(sh->get_algorithm_selection_result().done);
+    EXPECT_EQ(sh->get_algorithm_type(), expected);
+  }
+
+  // The cost model on given statistics
+  SPGEMMCostModel model;
+  SPGEMMSelection stats;
+  stats.flops         = 1000000;
+  stats.max_row_flops = 200;
+  stats.avg_row_flops = 100;
+  stats.compression   = 0.5;
+  stats.shmem_bytes   = 16128;
+  stats.concurrency   = 1;
+  const size_t maxDense = 250001;
+  SPGEMMSelection sel   = stats;
+  if (KokkosKernels::Impl::kk_is_gpu_exec_space<exec_space>()) {
+    // Rows of C that fit in the shared memory of a thread, or do not
+    sel.avg_row_flops = 5;
+    KokkosSparse::Impl::spgemm_select_algorithm<exec_space, lno_t, scalar_t>(
+        sel, model, 1000, 100000, maxDense, 0.85, true);
+    EXPECT_EQ(sel.algorithm, SPGEMM_KK_MEMORY);
+    EXPECT_GE(sel.vector_size, 4);
+    EXPECT_GT(sel.team_size, 0);
+    sel.avg_row_flops = 1e6;
+    KokkosSparse::Impl::spgemm_select_algorithm<exec_space, lno_t, scalar_t>(
+        sel, model, 10000000, 100000, maxDense, 0.85, true);
+    EXPECT_EQ(sel.algorithm, SPGEMM_KK_LP);
+    EXPECT_EQ(sel.vector_size, -1);
+    return;
+  }
+  // One thread: the serial algorithm, if allowed
+  KokkosSparse::Impl::spgemm_select_algorithm<exec_space, lno_t, scalar_t>(
+      sel, model, 1000, 100000, maxDense, 0.85, true);
+  EXPECT_EQ(sel.algorithm, SPGEMM_SERIAL);
+  KokkosSparse::Impl::spgemm_select_algorithm<exec_space, lno_t, scalar_t>(
+      sel, model, 1000, 100000, maxDense, 0.85, false);
+  EXPECT_EQ(sel.algorithm, SPGEMM_KK_DENSE);
+  EXPECT_EQ(sel.accumulator, SPGEMM_ACC_DEFAULT);
+  EXPECT_EQ(sel.vector_size, 1);
+  // Many threads; too many columns for a dense accumulator, or cheap hashing
+  sel.concurrency = 64;
+  KokkosSparse::Impl::spgemm_select_algorithm<exec_space, lno_t, scalar_t>(
+      sel, model, maxDense, 100000, maxDense, 0.85, true);
+  EXPECT_EQ(sel.algorithm, SPGEMM_KK_MEMORY);
+  EXPECT_EQ(sel.dense_cost, 0.0);
+  model.hash_flop = 0.5;
+  KokkosSparse::Impl::spgemm_select_algorithm<exec_space, lno_t, scalar_t>(
+      sel, model, 1000, 100000, maxDense, 0.85, true);
+  EXPECT_EQ(sel.algorithm, SPGEMM_KK_MEMORY);
+  EXPECT_GT(sel.dense_cost, sel.hash_cost);
+  // Skewed rows
+  model             = SPGEMMCostModel();
+  sel.max_row_flops = 100000;
+  sel.avg_row_flops = 10;
+  KokkosSparse::Impl::spgemm_select_algorithm<exec_space, lno_t, scalar_t>(
+      sel, model, 1000, 100000, maxDense, 0.85, false);
+  EXPECT_EQ(sel.accumulator, SPGEMM_ACC_ADAPTIVE);
+}
+
+// SpGEMM on execution space instances, one product each. Every C must match
+// the product computed on the default instance.
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void test_spgemm_exec_space(lno_t m, lno_t k, lno_t n, size_type nnz,
+                            lno_t bandwidth, lno_t row_size_variance) {
+  using namespace Test;
+  using crsMat_t     = CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using exec_space   = typename device::execution_space;
+  using KernelHandle = KokkosKernels::Experimental::KokkosKernelsHandle<
+      size_type, lno_t, scalar_t, exec_space, typename device::memory_space,
+      typename device::memory_space>;
+
+  crsMat_t A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      m, k, nnz, row_size_variance, bandwidth);
+  crsMat_t B = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      k, n, nnz, row_size_variance, bandwidth);
+  KokkosSparse::sort_crs_matrix(A);
+  KokkosSparse::sort_crs_matrix(B);
+
+  crsMat_t C_ref;
+  run_spgemm_noreuse(A, B, C_ref);
+
+  const int ninstances = 2;
+
+  // Copies of the default instance if OpenMP cannot be partitioned
+  std::vector<exec_space> instances(ninstances);
+  bool partition = true;
+#ifdef KOKKOS_ENABLE_OPENMP
+  if (std::is_same<exec_space, Kokkos::OpenMP>::value)
+    partition = exec_space().concurrency() >= ninstances;
+#endif
+  if (partition) {
+    std::vector<int> weights(ninstances, 1);
+    instances = Kokkos::Experimental::partition_space(exec_space(), weights);
+  }
+
+  std::vector<KernelHandle> kh_v(ninstances);
+  std::vector<crsMat_t> C_v(ninstances);
+  for (int i = 0; i < ninstances; i++) {
+    kh_v[i].create_spgemm_handle(SPGEMM_KK);
+    KokkosSparse::spgemm_symbolic(instances[i], kh_v[i], A, false, B, false,
+                                  C_v[i]);
+  }
+  for (int i = 0; i < ninstances; i++) {
+    KokkosSparse::spgemm_numeric(instances[i], kh_v[i], A, false, B, false,
+                                 C_v[i]);
+  }
+  for (int i = 0; i < ninstances; i++) instances[i].fence();
+
+  for (int i = 0; i < ninstances; i++) {
+    EXPECT_TRUE((is_same_matrix<crsMat_t, device>(C_v[i], C_ref))) << i;
+    kh_v[i].destroy_spgemm_handle();
+  }
+}
+
 #define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)            \
   TEST_F(TestCategory,                                                         \
          sparse##_##spgemm##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) {     \
@@ -571,6 +1052,36 @@ void test_issue1738() {
     test_spgemm_symbolic<SCALAR, ORDINAL, OFFSET, DEVICE>(false, false);       \
     test_issue402<SCALAR, ORDINAL, OFFSET, DEVICE>();                          \
     test_issue1738<SCALAR, ORDINAL, OFFSET, DEVICE>();                         \
+    test_spgemm_numeric_reuse<SCALAR, ORDINAL, OFFSET, DEVICE>(                \
+        1000, 500, 1600, 1000 * 20, 500, 10);                                  \
+    test_spgemm_numeric_reuse<SCALAR, ORDINAL, OFFSET, DEVICE>(10, 10, 0, 0,   \
+                                                               10, 10);        \
+    test_spgemm_adaptive_accumulator<SCALAR, ORDINAL, OFFSET, DEVICE>(         \
+        2000, 1000, 1500, 2000 * 3, 1000, 40);                                 \
+    test_spgemm_adaptive_accumulator<SCALAR, ORDINAL, OFFSET, DEVICE>(         \
+        1000, 500, 1600, 1000 * 20, 500, 10);                                  \
+    test_spgemm_adaptive_accumulator<SCALAR, ORDINAL, OFFSET, DEVICE>(         \
+        10, 10, 0, 0, 10, 10);                                                 \
+    test_spgemm_transpose<SCALAR, ORDINAL, OFFSET, DEVICE>(                    \
+        1000, 500, 1600, 1000 * 20, 500, 10);                                  \
+    test_spgemm_transpose<SCALAR, ORDINAL, OFFSET, DEVICE>(10, 10, 0, 0, 10,   \
+                                                           10);                \
+    test_spgemm_memory_estimate<SCALAR, ORDINAL, OFFSET, DEVICE>(              \
+        1000, 500, 1600, 1000 * 20, 500, 10);                                  \
+    test_spgemm_memory_estimate<SCALAR, ORDINAL, OFFSET, DEVICE>(10, 10, 0, 0, \
+                                                                 10, 10);      \
+    test_spgemm_plan_io<SCALAR, ORDINAL, OFFSET, DEVICE>(                      \
+        1000, 500, 1600, 1000 * 20, 500, 10);                                  \
+    test_spgemm_plan_io<SCALAR, ORDINAL, OFFSET, DEVICE>(10, 10, 0, 0, 10,     \
+                                                         10);                  \
+    test_spgemm_algorithm_selection<SCALAR, ORDINAL, OFFSET, DEVICE>(          \
+        1000, 500, 1600, 1000 * 20, 500, 10);                                  \
+    test_spgemm_algorithm_selection<SCALAR, ORDINAL, OFFSET, DEVICE>(          \
+        10, 10, 0, 0, 10, 10);                                                 \
+    test_spgemm_exec_space<SCALAR, ORDINAL, OFFSET, DEVICE>(                   \
+        1000, 500, 1600, 1000 * 20, 500, 10);                                  \
+    test_spgemm_exec_space<SCALAR, ORDINAL, OFFSET, DEVICE>(10, 10, 0, 0, 10,  \
+                                                            10);               \
   }
 
 // test_spgemm<SCALAR,ORDINAL,OFFSET,DEVICE>(50000, 50000 * 30, 100, 10);
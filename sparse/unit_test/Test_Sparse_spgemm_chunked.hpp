@@ -0,0 +1,95 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+
+#include "KokkosSparse_Utils.hpp"
+#include "KokkosSparse_SortCrs.hpp"
+#include "KokkosSparse_spgemm.hpp"
+#include "KokkosSparse_spgemm_chunked.hpp"
+// For Test::is_same_matrix
+#include "Test_Sparse_Utils.hpp"
+
+namespace Test {
+
+// Compare the chunked product with KokkosSparse::spgemm, for an output on
+// the device and for an output staged to the host. A small max_chunk_bytes
+// forces many chunks.
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void run_test_spgemm_chunked(lno_t m, lno_t k, lno_t n, size_type nnz,
+                             size_t max_chunk_bytes) {
+  using crsMat_t =
+      KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using hostMat_t = KokkosSparse::CrsMatrix<scalar_t, lno_t, Kokkos::HostSpace,
+                                            void, size_type>;
+
+  crsMat_t A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      m, k, nnz, 5, k / 2 + 1);
+  crsMat_t B = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      k, n, nnz, 5, n / 2 + 1);
+
+  crsMat_t C_ref = KokkosSparse::spgemm<crsMat_t>(A, false, B, false);
+  KokkosSparse::sort_crs_matrix(C_ref);
+
+  crsMat_t C = KokkosSparse::Experimental::spgemm_chunked<crsMat_t>(
+      A, B, max_chunk_bytes);
+  KokkosSparse::sort_crs_matrix(C);
+  EXPECT_TRUE((is_same_matrix<crsMat_t, device>(C, C_ref)));
+
+  hostMat_t C_h = KokkosSparse::Experimental::spgemm_chunked<hostMat_t>(
+      A, B, max_chunk_bytes);
+  KokkosSparse::sort_crs_matrix(C_h);
+  hostMat_t C_ref_h(
+      "C ref host", C_ref.numRows(), C_ref.numCols(), C_ref.nnz(),
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), C_ref.values),
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                          C_ref.graph.row_map),
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                          C_ref.graph.entries));
+  EXPECT_TRUE((is_same_matrix<hostMat_t, Kokkos::HostSpace>(C_h, C_ref_h)));
+}
+
+}  // namespace Test
+
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void test_spgemm_chunked() {
+  // One chunk
+  Test::run_test_spgemm_chunked<scalar_t, lno_t, size_type, device>(
+      1000, 800, 600, 1000 * 10, 0);
+  // Many chunks, and single rows over the budget
+  for (size_t bytes : {size_t(1) << 16, size_t(1) << 10, size_t(1)}) {
+    Test::run_test_spgemm_chunked<scalar_t, lno_t, size_type, device>(
+        1000, 800, 600, 1000 * 10, bytes);
+  }
+  Test::run_test_spgemm_chunked<scalar_t, lno_t, size_type, device>(
+      300, 300, 300, 300 * 2, size_t(1) << 10);
+  Test::run_test_spgemm_chunked<scalar_t, lno_t, size_type, device>(
+      10, 10, 10, 0, size_t(1) << 10);
+}
+
+#define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE) \
+  TEST_F(                                                           \
+      TestCategory,                                                 \
+      sparse##_##spgemm_chunked##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    test_spgemm_chunked<SCALAR, ORDINAL, OFFSET, DEVICE>();         \
+  }
+
+#include <Test_Common_Test_All_Type_Combos.hpp>
+
+#undef KOKKOSKERNELS_EXECUTE_TEST
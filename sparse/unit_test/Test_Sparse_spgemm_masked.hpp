@@ -0,0 +1,197 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <set>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+
+#include "KokkosSparse_Utils.hpp"
+#include "KokkosSparse_SortCrs.hpp"
+#include "KokkosSparse_spgemm.hpp"
+#include "KokkosSparse_spgemm_masked.hpp"
+// For Test::is_same_matrix
+#include "Test_Sparse_Utils.hpp"
+
+namespace Test {
+
+// C<M> = A*B computed as the full (sorted) A*B, filtered by M on the host
+template <typename crsMat_t>
+crsMat_t spgemm_masked_reference(const crsMat_t& M, bool complement,
+                                 const crsMat_t& A, const crsMat_t& B) {
+  using size_type = typename crsMat_t::non_const_size_type;
+  using lno_t     = typename crsMat_t::non_const_ordinal_type;
+  using scalar_t  = typename crsMat_t::non_const_value_type;
+  using rowmap_t  = typename crsMat_t::row_map_type::non_const_type;
+  using entries_t = typename crsMat_t::index_type::non_const_type;
+  using values_t  = typename crsMat_t::values_type::non_const_type;
+
+  const lno_t numRows = A.numRows();
+
+  crsMat_t AB = KokkosSparse::spgemm<crsMat_t>(A, false, B, false);
+  KokkosSparse::sort_crs_matrix(AB);
+  auto ABrowmap  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                       AB.graph.row_map);
+  auto ABentries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                       AB.graph.entries);
+  auto ABvalues =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), AB.values);
+  auto Mrowmap  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                      M.graph.row_map);
+  auto Mentries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                      M.graph.entries);
+
+  rowmap_t rowmap("C rowmap", numRows + 1);
+  auto rowmap_h = Kokkos::create_mirror_view(rowmap);
+  std::vector<lno_t> entries;
+  std::vector<scalar_t> values;
+  for (lno_t i = 0; i < numRows; i++) {
+    std::set<lno_t> mask;
+    if (M.graph.row_map.extent(0))
+      for (size_type q = Mrowmap(i); q < Mrowmap(i + 1); q++)
+        mask.insert(Mentries(q));
+    if (AB.graph.row_map.extent(0)) {
+      for (size_type q = ABrowmap(i); q < ABrowmap(i + 1); q++) {
+        if ((mask.count(ABentries(q)) > 0) == complement) continue;
+        entries.push_back(ABentries(q));
+        values.push_back(ABvalues(q));
+      }
+    }
+    rowmap_h(i + 1) = entries.size();
+  }
+  Kokkos::deep_copy(rowmap, rowmap_h);
+  entries_t entriesC("C entries", entries.size());
+  values_t valuesC("C values", values.size());
+  auto entries_h = Kokkos::create_mirror_view(entriesC);
+  auto values_h  = Kokkos::create_mirror_view(valuesC);
+  for (size_t q = 0; q < entries.size(); q++) {
+    entries_h(q) = entries[q];
+    values_h(q)  = values[q];
+  }
+  Kokkos::deep_copy(entriesC, entries_h);
+  Kokkos::deep_copy(valuesC, values_h);
+  return crsMat_t("C ref", numRows, B.numCols(), entries.size(), valuesC,
+                  rowmap, entriesC);
+}
+
+// Compare the masked product with the filtered full product, with and
+// without the complement, then change the values of A and B and compare
+// again, calling only the numeric phase.
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void run_test_spgemm_masked(lno_t m, lno_t k, lno_t n, size_type nnz,
+                            size_type nnzM, bool complement) {
+  using crsMat_t =
+      KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using scalar_view_t = typename crsMat_t::values_type::non_const_type;
+  using exec_space    = typename device::execution_space;
+  using KernelHandle  = KokkosKernels::Experimental::KokkosKernelsHandle<
+      size_type, lno_t, scalar_t, exec_space, typename device::memory_space,
+      typename device::memory_space>;
+
+  crsMat_t A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      m, k, nnz, 5, k / 2 + 1);
+  crsMat_t B = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      k, n, nnz, 5, n / 2 + 1);
+  crsMat_t M = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      m, n, nnzM, 5, n / 2 + 1);
+  KokkosSparse::sort_crs_matrix(A);
+  KokkosSparse::sort_crs_matrix(B);
+
+  KernelHandle kh;
+  kh.create_spgemm_handle();
+  crsMat_t C;
+  KokkosSparse::Experimental::spgemm_masked_symbolic(kh, M, complement, A, B,
+                                                     C);
+  KokkosSparse::Experimental::spgemm_masked_numeric(kh, M, complement, A, B,
+                                                    C);
+  crsMat_t C_ref = spgemm_masked_reference(M, complement, A, B);
+  EXPECT_TRUE((is_same_matrix<crsMat_t, device>(C, C_ref)));
+
+  // Same sparsity, new values: numeric only
+  Kokkos::Random_XorShift64_Pool<exec_space> rand_pool(13718);
+  for (crsMat_t* X : {&A, &B}) {
+    X->values = scalar_view_t("new values", X->nnz());
+    Kokkos::fill_random(X->values, rand_pool, scalar_t(10));
+  }
+  KokkosSparse::Experimental::spgemm_masked_numeric(kh, M, complement, A, B,
+                                                    C);
+  C_ref = spgemm_masked_reference(M, complement, A, B);
+  EXPECT_TRUE((is_same_matrix<crsMat_t, device>(C, C_ref)));
+
+  // The interface without reuse
+  crsMat_t C2 =
+      KokkosSparse::Experimental::spgemm_masked<crsMat_t>(M, complement, A, B);
+  EXPECT_TRUE((is_same_matrix<crsMat_t, device>(C2, C_ref)));
+  kh.destroy_spgemm_handle();
+}
+
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void test_spgemm_masked_errors() {
+  using crsMat_t =
+      KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using KernelHandle = KokkosKernels::Experimental::KokkosKernelsHandle<
+      size_type, lno_t, scalar_t, typename device::execution_space,
+      typename device::memory_space, typename device::memory_space>;
+
+  crsMat_t A = KokkosSparse::Impl::kk_generate_diag_matrix<crsMat_t>(10);
+  crsMat_t M = KokkosSparse::Impl::kk_generate_diag_matrix<crsMat_t>(8);
+  crsMat_t C;
+  KernelHandle kh;
+  EXPECT_THROW(KokkosSparse::Experimental::spgemm_masked_symbolic(
+                   kh, A, false, A, A, C),
+               std::invalid_argument);
+  kh.create_spgemm_handle();
+  EXPECT_THROW(KokkosSparse::Experimental::spgemm_masked_numeric(
+                   kh, A, false, A, A, C),
+               std::runtime_error);
+  EXPECT_THROW(KokkosSparse::Experimental::spgemm_masked_symbolic(
+                   kh, M, false, A, A, C),
+               std::invalid_argument);
+  kh.destroy_spgemm_handle();
+}
+
+}  // namespace Test
+
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void test_spgemm_masked() {
+  for (bool complement : {false, true}) {
+    Test::run_test_spgemm_masked<scalar_t, lno_t, size_type, device>(
+        1000, 800, 600, 1000 * 10, 1000 * 5, complement);
+    Test::run_test_spgemm_masked<scalar_t, lno_t, size_type, device>(
+        500, 500, 500, 500 * 20, 500 * 2, complement);
+    Test::run_test_spgemm_masked<scalar_t, lno_t, size_type, device>(
+        300, 200, 100, 300 * 5, 0, complement);
+    Test::run_test_spgemm_masked<scalar_t, lno_t, size_type, device>(
+        10, 10, 10, 0, 20, complement);
+  }
+  Test::test_spgemm_masked_errors<scalar_t, lno_t, size_type, device>();
+}
+
+#define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)          \
+  TEST_F(                                                                    \
+      TestCategory,                                                          \
+      sparse##_##spgemm_masked##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    test_spgemm_masked<SCALAR, ORDINAL, OFFSET, DEVICE>();                   \
+  }
+
+#include <Test_Common_Test_All_Type_Combos.hpp>
+
+#undef KOKKOSKERNELS_EXECUTE_TEST
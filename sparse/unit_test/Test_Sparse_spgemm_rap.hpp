@@ -0,0 +1,145 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+
+#include "KokkosSparse_Utils.hpp"
+#include "KokkosSparse_SortCrs.hpp"
+#include "KokkosSparse_spgemm.hpp"
+#include "KokkosSparse_spgemm_rap.hpp"
+// For Test::is_same_matrix
+#include "Test_Sparse_Utils.hpp"
+
+namespace Test {
+
+// C = R*A*P computed as two SpGEMMs
+template <typename crsMat_t>
+crsMat_t spgemm_rap_reference(const crsMat_t& R, const crsMat_t& A,
+                              const crsMat_t& P) {
+  crsMat_t AP = KokkosSparse::spgemm<crsMat_t>(A, false, P, false);
+  return KokkosSparse::spgemm<crsMat_t>(R, false, AP, false);
+}
+
+// Compare the fused RAP with two SpGEMMs, for the Galerkin product
+// (R = P^T) and for a general R. Then change the values of A, P and R and
+// compare again, calling only the numeric phase.
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void run_test_spgemm_rap(lno_t numFine, lno_t numCoarse, size_type nnzA,
+                         size_type nnzP, bool galerkin) {
+  using crsMat_t =
+      KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using scalar_view_t = typename crsMat_t::values_type::non_const_type;
+  using exec_space    = typename device::execution_space;
+  using KernelHandle  = KokkosKernels::Experimental::KokkosKernelsHandle<
+      size_type, lno_t, scalar_t, exec_space, typename device::memory_space,
+      typename device::memory_space>;
+
+  crsMat_t A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      numFine, numFine, nnzA, 5, numFine / 4 + 1);
+  crsMat_t P = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      numFine, numCoarse, nnzP, 2, numCoarse / 2 + 1);
+  crsMat_t R;
+  if (galerkin)
+    R = KokkosSparse::Impl::transpose_matrix(P);
+  else
+    R = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+        numCoarse, numFine, nnzP, 2, numFine / 2 + 1);
+  KokkosSparse::sort_crs_matrix(A);
+  KokkosSparse::sort_crs_matrix(P);
+  KokkosSparse::sort_crs_matrix(R);
+
+  KernelHandle kh;
+  kh.create_spgemm_handle();
+  crsMat_t C;
+  KokkosSparse::Experimental::spgemm_rap_symbolic(kh, R, A, P, C);
+  EXPECT_TRUE(kh.get_spgemm_handle()->is_symbolic_called());
+  KokkosSparse::Experimental::spgemm_rap_numeric(kh, R, A, P, C);
+  EXPECT_TRUE(kh.get_spgemm_handle()->is_numeric_called());
+  crsMat_t C_ref = spgemm_rap_reference(R, A, P);
+  EXPECT_TRUE((is_same_matrix<crsMat_t, device>(C, C_ref)));
+
+  // Same sparsity, new values: numeric only
+  Kokkos::Random_XorShift64_Pool<exec_space> rand_pool(13718);
+  for (crsMat_t* M : {&A, &P}) {
+    M->values = scalar_view_t("new values", M->nnz());
+    Kokkos::fill_random(M->values, rand_pool, scalar_t(10));
+  }
+  if (galerkin)
+    R = KokkosSparse::Impl::transpose_matrix(P);
+  else
+    Kokkos::fill_random(R.values, rand_pool, scalar_t(10));
+  KokkosSparse::sort_crs_matrix(R);
+  KokkosSparse::Experimental::spgemm_rap_numeric(kh, R, A, P, C);
+  C_ref = spgemm_rap_reference(R, A, P);
+  EXPECT_TRUE((is_same_matrix<crsMat_t, device>(C, C_ref)));
+
+  // The interface without reuse
+  crsMat_t C2 = KokkosSparse::Experimental::spgemm_rap<crsMat_t>(R, A, P);
+  EXPECT_TRUE((is_same_matrix<crsMat_t, device>(C2, C_ref)));
+  kh.destroy_spgemm_handle();
+}
+
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void test_spgemm_rap_errors() {
+  using crsMat_t =
+      KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using KernelHandle = KokkosKernels::Experimental::KokkosKernelsHandle<
+      size_type, lno_t, scalar_t, typename device::execution_space,
+      typename device::memory_space, typename device::memory_space>;
+
+  crsMat_t A = KokkosSparse::Impl::kk_generate_diag_matrix<crsMat_t>(10);
+  crsMat_t P = KokkosSparse::Impl::kk_generate_diag_matrix<crsMat_t>(8);
+  crsMat_t C;
+  KernelHandle kh;
+  EXPECT_THROW(KokkosSparse::Experimental::spgemm_rap_symbolic(kh, A, A, A, C),
+               std::invalid_argument);
+  kh.create_spgemm_handle();
+  EXPECT_THROW(KokkosSparse::Experimental::spgemm_rap_numeric(kh, A, A, A, C),
+               std::runtime_error);
+  EXPECT_THROW(KokkosSparse::Experimental::spgemm_rap_symbolic(kh, A, A, P, C),
+               std::invalid_argument);
+  kh.destroy_spgemm_handle();
+}
+
+}  // namespace Test
+
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void test_spgemm_rap() {
+  for (bool galerkin : {true, false}) {
+    Test::run_test_spgemm_rap<scalar_t, lno_t, size_type, device>(
+        2000, 300, 2000 * 10, 2000 * 2, galerkin);
+    Test::run_test_spgemm_rap<scalar_t, lno_t, size_type, device>(
+        500, 500, 500 * 20, 500 * 5, galerkin);
+    Test::run_test_spgemm_rap<scalar_t, lno_t, size_type, device>(
+        10, 3, 0, 0, galerkin);
+  }
+  Test::test_spgemm_rap_errors<scalar_t, lno_t, size_type, device>();
+}
+
+#define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)            \
+  TEST_F(TestCategory,                                                         \
+         sparse##_##spgemm_rap##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    test_spgemm_rap<SCALAR, ORDINAL, OFFSET, DEVICE>();                        \
+  }
+
+#include <Test_Common_Test_All_Type_Combos.hpp>
+
+#undef KOKKOSKERNELS_EXECUTE_TEST
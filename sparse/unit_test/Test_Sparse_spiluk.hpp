@@ -23,6 +23,7 @@
 #include "KokkosSparse_Utils.hpp"
 #include "KokkosSparse_CrsMatrix.hpp"
 #include <KokkosKernels_IOUtils.hpp>
+#include "KokkosBlas1_axpby.hpp"
 #include "KokkosBlas1_nrm2.hpp"
 #include "KokkosSparse_spmv.hpp"
 #include "KokkosSparse_spiluk.hpp"
@@ -355,6 +356,119 @@ struct SpilukTest {
                                 SPILUKAlgorithm::SEQLVLSCHD_TP1, fill_lev);
   }
 
+  // Factor with a plan saved after spiluk_symbolic and loaded into a new
+  // handle, without calling spiluk_symbolic again
+  static void run_test_spiluk_plan_io() {
+    std::vector<std::vector<scalar_t>> A = get_fixture<scalar_t>();
+
+    RowMapType row_map;
+    EntriesType entries;
+    ValuesType values;
+
+    compress_matrix(row_map, entries, values, A);
+
+    const lno_t fill_lev  = 2;
+    const size_type nrows = row_map.extent(0) - 1;
+
+    std::stringstream plan;
+    {
+      KernelHandle kh;
+      kh.create_spiluk_handle(SPILUKAlgorithm::SEQLVLSCHD_TP1, nrows,
+                              40 * nrows, 40 * nrows);
+      auto spiluk_handle = kh.get_spiluk_handle();
+      RowMapType L_row_map("L_row_map", nrows + 1);
+      EntriesType L_entries("L_entries", spiluk_handle->get_nnzL());
+      RowMapType U_row_map("U_row_map", nrows + 1);
+      EntriesType U_entries("U_entries", spiluk_handle->get_nnzU());
+      spiluk_symbolic(&kh, fill_lev, row_map, entries, L_row_map, L_entries,
+                      U_row_map, U_entries);
+      Kokkos::resize(L_entries, spiluk_handle->get_nnzL());
+      Kokkos::resize(U_entries, spiluk_handle->get_nnzU());
+      spiluk_handle->save(plan, L_row_map, L_entries, U_row_map, U_entries);
+      kh.destroy_spiluk_handle();
+    }
+
+    KernelHandle kh;
+    kh.create_spiluk_handle(SPILUKAlgorithm::SEQLVLSCHD_TP1, nrows, 0, 0);
+    auto spiluk_handle = kh.get_spiluk_handle();
+    RowMapType L_row_map, U_row_map;
+    EntriesType L_entries, U_entries;
+    spiluk_handle->load(plan, L_row_map, L_entries, U_row_map, U_entries);
+    EXPECT_TRUE(spiluk_handle->is_symbolic_complete());
+    EXPECT_EQ(L_entries.extent(0), spiluk_handle->get_nnzL());
+    EXPECT_EQ(U_entries.extent(0), spiluk_handle->get_nnzU());
+    ValuesType L_values("L_values", spiluk_handle->get_nnzL());
+    ValuesType U_values("U_values", spiluk_handle->get_nnzU());
+    spiluk_numeric(&kh, fill_lev, row_map, entries, values, L_row_map,
+                   L_entries, L_values, U_row_map, U_entries, U_values);
+    Kokkos::fence();
+    check_result<false>(row_map, entries, values, L_row_map, L_entries,
+                        L_values, U_row_map, U_entries, U_values, fill_lev);
+    kh.destroy_spiluk_handle();
+  }
+
+  // spiluk_numeric on execution space instances, one factorization each
+  static void run_test_spiluk_exec_space() {
+    std::vector<std::vector<scalar_t>> A = get_fixture<scalar_t>();
+
+    RowMapType row_map;
+    EntriesType entries;
+    ValuesType values;
+
+    compress_matrix(row_map, entries, values, A);
+
+    const lno_t fill_lev  = 2;
+    const size_type nrows = row_map.extent(0) - 1;
+    const int ninstances  = 2;
+
+    // Copies of the default instance if OpenMP cannot be partitioned
+    std::vector<execution_space> instances(ninstances);
+    bool partition = true;
+#ifdef KOKKOS_ENABLE_OPENMP
+    if (std::is_same<typename device::execution_space, Kokkos::OpenMP>::value)
+      partition = execution_space().concurrency() >= ninstances;
+#endif
+    if (partition) {
+      std::vector<int> weights(ninstances, 1);
+      instances =
+          Kokkos::Experimental::partition_space(execution_space(), weights);
+    }
+
+    std::vector<KernelHandle> kh_v(ninstances);
+    std::vector<RowMapType> L_row_map_v(ninstances), U_row_map_v(ninstances);
+    std::vector<EntriesType> L_entries_v(ninstances), U_entries_v(ninstances);
+    std::vector<ValuesType> L_values_v(ninstances), U_values_v(ninstances);
+    for (int i = 0; i < ninstances; i++) {
+      kh_v[i].create_spiluk_handle(SPILUKAlgorithm::SEQLVLSCHD_TP1, nrows,
+                                   40 * nrows, 40 * nrows);
+      auto spiluk_handle = kh_v[i].get_spiluk_handle();
+      L_row_map_v[i]     = RowMapType("L_row_map", nrows + 1);
+      L_entries_v[i]     = EntriesType("L_entries", spiluk_handle->get_nnzL());
+      U_row_map_v[i]     = RowMapType("U_row_map", nrows + 1);
+      U_entries_v[i]     = EntriesType("U_entries", spiluk_handle->get_nnzU());
+      spiluk_symbolic(&kh_v[i], fill_lev, row_map, entries, L_row_map_v[i],
+                      L_entries_v[i], U_row_map_v[i], U_entries_v[i]);
+      Kokkos::resize(L_entries_v[i], spiluk_handle->get_nnzL());
+      Kokkos::resize(U_entries_v[i], spiluk_handle->get_nnzU());
+      L_values_v[i] = ValuesType("L_values", spiluk_handle->get_nnzL());
+      U_values_v[i] = ValuesType("U_values", spiluk_handle->get_nnzU());
+    }
+
+    for (int i = 0; i < ninstances; i++) {
+      spiluk_numeric(instances[i], &kh_v[i], fill_lev, row_map, entries,
+                     values, L_row_map_v[i], L_entries_v[i], L_values_v[i],
+                     U_row_map_v[i], U_entries_v[i], U_values_v[i]);
+    }
+    for (int i = 0; i < ninstances; i++) instances[i].fence();
+
+    for (int i = 0; i < ninstances; i++) {
+      check_result<false>(row_map, entries, values, L_row_map_v[i],
+                          L_entries_v[i], L_values_v[i], U_row_map_v[i],
+                          U_entries_v[i], U_values_v[i], fill_lev);
+      kh_v[i].destroy_spiluk_handle();
+    }
+  }
+
   static void run_test_spiluk_blocks() {
     std::vector<std::vector<scalar_t>> A = get_fixture<scalar_t>();
 
@@ -427,6 +541,83 @@ struct SpilukTest {
     }
   }
 
+  static void run_test_spiluk_device_symbolic() {
+    // Create a diagonally dominant sparse matrix to test:
+    constexpr auto nrows         = 1000;
+    constexpr auto diagDominance = 2;
+
+    size_type nnz = 10 * nrows;
+    auto A =
+        KokkosSparse::Impl::kk_generate_diagonally_dominant_sparse_matrix<Crs>(
+            nrows, nrows, nnz, 0, lno_t(0.01 * nrows), diagDominance);
+
+    KokkosSparse::sort_crs_matrix(A);
+
+    RowMapType row_map("row_map", A.graph.row_map.extent(0));
+    EntriesType entries("entries", A.graph.entries.extent(0));
+    ValuesType values("values", A.values.extent(0));
+    Kokkos::deep_copy(row_map, A.graph.row_map);
+    Kokkos::deep_copy(entries, A.graph.entries);
+    Kokkos::deep_copy(values, A.values);
+
+    // The device symbolic phase must find the same factors as the host one
+    for (lno_t fill_lev = 0; fill_lev < 4; ++fill_lev) {
+      KernelHandle kh;
+
+      const auto [L_row_map, L_entries, L_values, U_row_map, U_entries,
+                  U_values] =
+          run_and_check_spiluk<false>(kh, row_map, entries, values,
+                                      SPILUKAlgorithm::SEQLVLSCHD_TP1,
+                                      fill_lev);
+      const auto [L_row_map_d, L_entries_d, L_values_d, U_row_map_d,
+                  U_entries_d, U_values_d] =
+          run_and_check_spiluk<false>(
+              kh, row_map, entries, values,
+              SPILUKAlgorithm::SEQLVLSCHD_TP1_DEVICE_SYMBOLIC, fill_lev);
+
+      EXPECT_NEAR_KK_1DVIEW(L_row_map, L_row_map_d, EPS);
+      EXPECT_NEAR_KK_1DVIEW(L_entries, L_entries_d, EPS);
+      EXPECT_NEAR_KK_1DVIEW(L_values, L_values_d, EPS);
+      EXPECT_NEAR_KK_1DVIEW(U_row_map, U_row_map_d, EPS);
+      EXPECT_NEAR_KK_1DVIEW(U_entries, U_entries_d, EPS);
+      EXPECT_NEAR_KK_1DVIEW(U_values, U_values_d, EPS);
+    }
+
+    // The fill path 5 -> 3 -> 1 -> 4 does not visit its interior vertices in
+    // increasing order, but gives (5, 4) level 2
+    const scalar_t ZERO = scalar_t(0);
+    const scalar_t FOUR = scalar_t(4);
+    const scalar_t MONE = scalar_t(-1);
+    std::vector<std::vector<scalar_t>> P = {
+        {FOUR, ZERO, ZERO, ZERO, ZERO, ZERO},
+        {ZERO, FOUR, ZERO, ZERO, MONE, ZERO},
+        {ZERO, ZERO, FOUR, ZERO, ZERO, ZERO},
+        {ZERO, MONE, ZERO, FOUR, ZERO, ZERO},
+        {ZERO, ZERO, ZERO, ZERO, FOUR, ZERO},
+        {ZERO, ZERO, ZERO, MONE, ZERO, FOUR}};
+    RowMapType P_row_map;
+    EntriesType P_entries;
+    ValuesType P_values;
+    compress_matrix(P_row_map, P_entries, P_values, P);
+
+    KernelHandle kh;
+    const auto [L_row_map, L_entries, L_values, U_row_map, U_entries,
+                U_values] =
+        run_and_check_spiluk<false>(
+            kh, P_row_map, P_entries, P_values,
+            SPILUKAlgorithm::SEQLVLSCHD_TP1_DEVICE_SYMBOLIC, 2);
+
+    auto hL_row_map = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), L_row_map);
+    auto hL_entries = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), L_entries);
+    bool has_fill = false;
+    for (size_type k = hL_row_map(5); k < hL_row_map(6); ++k) {
+      if (hL_entries(k) == 4) has_fill = true;
+    }
+    EXPECT_TRUE(has_fill);
+  }
+
   static void run_test_spiluk_scale_blocks() {
     // Create a diagonally dominant sparse matrix to test:
     constexpr auto nrows         = 5000;
@@ -851,6 +1042,180 @@ struct SpilukTest {
       }
     }
   }
+
+  static void run_test_spiluk_precond_refactor() {
+    // LUPrec computes its solve schedules once; a values-only refactor of
+    // the same pattern must still be applied with the new values
+    using mag_t = typename AT::mag_type;
+
+    constexpr auto nrows         = 1000;
+    constexpr auto diagDominance = 2;
+    constexpr lno_t fill_lev     = 1;
+
+    size_type nnz = 10 * nrows;
+    auto A =
+        KokkosSparse::Impl::kk_generate_diagonally_dominant_sparse_matrix<Crs>(
+            nrows, nrows, nnz, 0, lno_t(0.01 * nrows), diagDominance);
+
+    KokkosSparse::sort_crs_matrix(A);
+
+    RowMapType row_map("row_map", A.graph.row_map.extent(0));
+    EntriesType entries("entries", A.graph.entries.extent(0));
+    ValuesType values("values", A.values.extent(0));
+    Kokkos::deep_copy(row_map, A.graph.row_map);
+    Kokkos::deep_copy(entries, A.graph.entries);
+    Kokkos::deep_copy(values, A.values);
+
+    KernelHandle kh;
+    kh.create_spiluk_handle(SPILUKAlgorithm::SEQLVLSCHD_TP1, nrows,
+                            40 * nrows, 40 * nrows);
+    auto spiluk_handle = kh.get_spiluk_handle();
+
+    RowMapType L_row_map("L_row_map", nrows + 1);
+    EntriesType L_entries("L_entries", spiluk_handle->get_nnzL());
+    RowMapType U_row_map("U_row_map", nrows + 1);
+    EntriesType U_entries("U_entries", spiluk_handle->get_nnzU());
+
+    spiluk_symbolic(&kh, fill_lev, row_map, entries, L_row_map, L_entries,
+                    U_row_map, U_entries);
+    Kokkos::resize(L_entries, spiluk_handle->get_nnzL());
+    Kokkos::resize(U_entries, spiluk_handle->get_nnzU());
+    ValuesType L_values("L_values", spiluk_handle->get_nnzL());
+    ValuesType U_values("U_values", spiluk_handle->get_nnzU());
+
+    Crs L("L_Mtx", nrows, nrows, L_values.extent(0), L_values, L_row_map,
+          L_entries);
+    Crs U("U_Mtx", nrows, nrows, U_values.extent(0), U_values, U_row_map,
+          U_entries);
+    KokkosSparse::Experimental::LUPrec<Crs, KernelHandle> myPrec(L, U);
+
+    ValuesType x("x", nrows);
+    ValuesType b("b", nrows);
+    ValuesType tmp("tmp", nrows);
+    ValuesType z("z", nrows);
+    Kokkos::parallel_for(
+        range_policy(0, nrows),
+        KOKKOS_LAMBDA(const lno_t i) { x(i) = scalar_t(mag_t(1 + i % 7)); });
+
+    const scalar_t ZERO = scalar_t(0);
+    const scalar_t ONE  = scalar_t(1);
+    const mag_t tol     = 1000 * AT::epsilon();
+
+    // The factors of the original values, then of A with its off-diagonal
+    // entries halved. The preconditioner sees both through L and U.
+    for (int refactor = 0; refactor < 2; ++refactor) {
+      if (refactor == 1) {
+        Kokkos::parallel_for(
+            range_policy(0, nrows), KOKKOS_LAMBDA(const lno_t row) {
+              for (size_type k = row_map(row); k < row_map(row + 1); ++k) {
+                if (entries(k) != row) values(k) *= scalar_t(0.5);
+              }
+            });
+      }
+
+      spiluk_numeric(&kh, fill_lev, row_map, entries, values, L_row_map,
+                     L_entries, L_values, U_row_map, U_entries, U_values);
+      if (refactor == 0) myPrec.initialize();
+
+      // b = L U x, so applying the preconditioner must recover x
+      KokkosSparse::spmv("N", ONE, U, x, ZERO, tmp);
+      KokkosSparse::spmv("N", ONE, L, tmp, ZERO, b);
+      myPrec.apply(b, z);
+
+      KokkosBlas::axpy(-ONE, x, z);
+      EXPECT_LE(KokkosBlas::nrm2(z), tol * KokkosBlas::nrm2(x))
+          << "after refactor " << refactor;
+    }
+
+    kh.destroy_spiluk_handle();
+  }
+
+  static void run_test_spiluk_mixed_precision() {
+    // Factors stored in float for a double matrix
+    if constexpr (std::is_same_v<scalar_t, double>) {
+      using FloatValuesType = Kokkos::View<float*, device>;
+      using CrsFloat = CrsMatrix<float, lno_t, device, void, size_type>;
+
+      constexpr auto nrows         = 1000;
+      constexpr auto m             = 15;
+      constexpr auto diagDominance = 2;
+      constexpr auto tol           = 1e-5;
+      constexpr lno_t fill_lev     = 1;
+
+      size_type nnz = 10 * nrows;
+      auto A =
+          KokkosSparse::Impl::kk_generate_diagonally_dominant_sparse_matrix<
+              Crs>(nrows, nrows, nnz, 0, lno_t(0.01 * nrows), diagDominance);
+
+      KokkosSparse::sort_crs_matrix(A);
+
+      RowMapType row_map("row_map", A.graph.row_map.extent(0));
+      EntriesType entries("entries", A.graph.entries.extent(0));
+      ValuesType values("values", A.values.extent(0));
+      Kokkos::deep_copy(row_map, A.graph.row_map);
+      Kokkos::deep_copy(entries, A.graph.entries);
+      Kokkos::deep_copy(values, A.values);
+
+      KernelHandle kh;
+      const auto [L_row_map, L_entries, L_values, U_row_map, U_entries,
+                  U_values] =
+          run_and_check_spiluk<false>(kh, row_map, entries, values,
+                                      SPILUKAlgorithm::SEQLVLSCHD_TP1,
+                                      fill_lev);
+
+      kh.create_spiluk_handle(SPILUKAlgorithm::SEQLVLSCHD_TP1, nrows,
+                              40 * nrows, 40 * nrows);
+      auto spiluk_handle = kh.get_spiluk_handle();
+
+      RowMapType Lf_row_map("Lf_row_map", nrows + 1);
+      EntriesType Lf_entries("Lf_entries", spiluk_handle->get_nnzL());
+      RowMapType Uf_row_map("Uf_row_map", nrows + 1);
+      EntriesType Uf_entries("Uf_entries", spiluk_handle->get_nnzU());
+
+      spiluk_symbolic(&kh, fill_lev, row_map, entries, Lf_row_map, Lf_entries,
+                      Uf_row_map, Uf_entries);
+      Kokkos::resize(Lf_entries, spiluk_handle->get_nnzL());
+      Kokkos::resize(Uf_entries, spiluk_handle->get_nnzU());
+      FloatValuesType Lf_values("Lf_values", spiluk_handle->get_nnzL());
+      FloatValuesType Uf_values("Uf_values", spiluk_handle->get_nnzU());
+
+      spiluk_numeric(&kh, fill_lev, row_map, entries, values, Lf_row_map,
+                     Lf_entries, Lf_values, Uf_row_map, Uf_entries, Uf_values);
+      kh.destroy_spiluk_handle();
+
+      // The float factors are the rounded double factors
+      ValuesType Lf_rounded("Lf_rounded", Lf_values.extent(0));
+      ValuesType Uf_rounded("Uf_rounded", Uf_values.extent(0));
+      Kokkos::deep_copy(Lf_rounded, Lf_values);
+      Kokkos::deep_copy(Uf_rounded, Uf_values);
+      EXPECT_NEAR_KK_1DVIEW(L_entries, Lf_entries, EPS);
+      EXPECT_NEAR_KK_1DVIEW(U_entries, Uf_entries, EPS);
+      EXPECT_NEAR_KK_REL_1DVIEW(L_values, Lf_rounded, 1e-6);
+      EXPECT_NEAR_KK_REL_1DVIEW(U_values, Uf_rounded, 1e-6);
+
+      // GMRES with the float factors, applied in double, still converges
+      CrsFloat L("L_Mtx", nrows, nrows, Lf_values.extent(0), Lf_values,
+                 Lf_row_map, Lf_entries);
+      CrsFloat U("U_Mtx", nrows, nrows, Uf_values.extent(0), Uf_values,
+                 Uf_row_map, Uf_entries);
+      KokkosSparse::Experimental::LUPrec<Crs, KernelHandle, CrsFloat> myPrec(
+          L, U);
+
+      kh.create_gmres_handle(m, tol);
+      auto gmres_handle = kh.get_gmres_handle();
+      using GMRESHandle =
+          typename std::remove_reference<decltype(*gmres_handle)>::type;
+
+      ValuesType X("X", nrows);
+      ValuesType B(Kokkos::view_alloc(Kokkos::WithoutInitializing, "B"),
+                   nrows);
+      Kokkos::deep_copy(B, 1.0);
+      gmres(&kh, A, B, X, &myPrec);
+
+      EXPECT_EQ(gmres_handle->get_conv_flag_val(), GMRESHandle::Flag::Conv);
+      kh.destroy_gmres_handle();
+    }
+  }
 };
 
 }  // namespace Test
@@ -862,9 +1227,14 @@ void test_spiluk() {
   TestStruct::run_test_spiluk();
   TestStruct::run_test_spiluk_blocks();
   TestStruct::run_test_spiluk_scale();
+  TestStruct::run_test_spiluk_device_symbolic();
   TestStruct::run_test_spiluk_scale_blocks();
   TestStruct::template run_test_spiluk_precond<false>();
   TestStruct::template run_test_spiluk_precond<true>();
+  TestStruct::run_test_spiluk_precond_refactor();
+  TestStruct::run_test_spiluk_mixed_precision();
+  TestStruct::run_test_spiluk_plan_io();
+  TestStruct::run_test_spiluk_exec_space();
 }
 
 template <typename scalar_t, typename lno_t, typename size_type,
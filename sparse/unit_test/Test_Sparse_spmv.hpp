@@ -14,6 +14,8 @@
 //
 //@HEADER
 #include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
 #include <Kokkos_Core.hpp>
 #include <Kokkos_Random.hpp>
 
@@ -493,16 +495,386 @@ template <typename scalar_t, typename lno_t, typename size_type,
 void test_spmv_algorithms(lno_t numRows, size_type nnz, lno_t bandwidth,
                           lno_t row_size_variance, bool heavy) {
   using namespace KokkosSparse;
-  for (SPMVAlgorithm algo : {SPMV_DEFAULT, SPMV_NATIVE, SPMV_MERGE_PATH}) {
+  for (SPMVAlgorithm algo :
+       {SPMV_DEFAULT, SPMV_NATIVE, SPMV_MERGE_PATH, SPMV_NNZ_BALANCED,
+        SPMV_AUTOTUNE}) {
     test_spmv<scalar_t, lno_t, size_type, Device>(algo, numRows, nnz, bandwidth,
                                                   row_size_variance, heavy);
   }
 }
 
+// Check that SPMV_AUTOTUNE gives correct results while it is timing the
+// candidates, and that it eventually locks in one of them.
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename Device>
+void test_spmv_autotune(lno_t numRows, size_type nnz, lno_t bandwidth,
+                        lno_t row_size_variance) {
+  using crsMat_t = typename KokkosSparse::CrsMatrix<scalar_t, lno_t, Device,
+                                                    void, size_type>;
+  using scalar_view_t = typename crsMat_t::values_type::non_const_type;
+  using mag_t         = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+  using handle_t =
+      KokkosSparse::SPMVHandle<Device, crsMat_t, scalar_view_t, scalar_view_t>;
+
+  crsMat_t A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      numRows, numRows, nnz, row_size_variance, bandwidth);
+  const lno_t max_nnz_per_row =
+      numRows ? (nnz / numRows + row_size_variance) : 0;
+
+  scalar_view_t x("x", numRows);
+  scalar_view_t y("y", numRows);
+  Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(
+      13718);
+  Kokkos::fill_random(x, rand_pool, randomUpperBound<scalar_t>(1));
+  Kokkos::fill_random(y, rand_pool, randomUpperBound<scalar_t>(1));
+  Kokkos::fill_random(A.values, rand_pool, randomUpperBound<scalar_t>(1));
+
+  handle_t handle(KokkosSparse::SPMV_AUTOTUNE);
+  EXPECT_EQ(handle.get_autotuned_algorithm(), KokkosSparse::SPMV_AUTOTUNE);
+  // Enough calls for any number of candidates used by spmv
+  const int numCalls = 10 * (1 + handle.autotune_trials);
+  for (int i = 0; i < numCalls; i++) {
+    mag_t max_error = max_nnz_per_row;
+    Test::check_spmv(&handle, A, x, y, scalar_t(1), scalar_t(0), "N",
+                     max_error);
+  }
+  EXPECT_TRUE(handle.is_autotuning_done());
+  EXPECT_NE(handle.get_autotuned_algorithm(), KokkosSparse::SPMV_AUTOTUNE);
+  EXPECT_FALSE(handle.get_autotuned_description().empty());
+}
+
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename Device>
+void test_spmv_telemetry(lno_t numRows, size_type nnz, lno_t bandwidth,
+                         lno_t row_size_variance) {
+  using crsMat_t = typename KokkosSparse::CrsMatrix<scalar_t, lno_t, Device,
+                                                    void, size_type>;
+  using scalar_view_t = typename crsMat_t::values_type::non_const_type;
+  using mag_t         = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+  using handle_t =
+      KokkosSparse::SPMVHandle<Device, crsMat_t, scalar_view_t, scalar_view_t>;
+
+  crsMat_t A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      numRows, numRows, nnz, row_size_variance, bandwidth);
+  const lno_t max_nnz_per_row =
+      numRows ? (nnz / numRows + row_size_variance) : 0;
+
+  scalar_view_t x("x", numRows);
+  scalar_view_t y("y", numRows);
+  Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(
+      13718);
+  Kokkos::fill_random(x, rand_pool, randomUpperBound<scalar_t>(1));
+  Kokkos::fill_random(y, rand_pool, randomUpperBound<scalar_t>(1));
+  Kokkos::fill_random(A.values, rand_pool, randomUpperBound<scalar_t>(1));
+
+  // Calls made through autotune candidates or the cached transpose are
+  // counted once, on the handle passed by the user
+  for (auto algo : {KokkosSparse::SPMV_DEFAULT, KokkosSparse::SPMV_AUTOTUNE}) {
+    handle_t handle(algo);
+    handle.cache_transpose = true;
+    mag_t max_error        = max_nnz_per_row;
+    auto &telemetry        = handle.get_telemetry();
+    // Nothing is recorded until telemetry is enabled
+    Test::check_spmv(&handle, A, x, y, scalar_t(1), scalar_t(0), "N",
+                     max_error);
+    EXPECT_EQ(telemetry.get_call_count("spmv"), size_t(0));
+    telemetry.enable();
+    const int numCalls = 5;
+    for (int i = 0; i < numCalls; i++)
+      Test::check_spmv(&handle, A, x, y, scalar_t(1), scalar_t(0), "N",
+                       max_error);
+    Test::check_spmv(&handle, A, x, y, scalar_t(1), scalar_t(0), "T",
+                     max_error);
+    EXPECT_EQ(telemetry.get_call_count("spmv"), size_t(numCalls + 1));
+    EXPECT_GE(telemetry.get_total_seconds("spmv"), 0.0);
+    telemetry.reset();
+    EXPECT_EQ(telemetry.get_call_count("spmv"), size_t(0));
+  }
+}
+
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename Device>
+void test_spmv_dispatch_trace(lno_t numRows, size_type nnz, lno_t bandwidth,
+                              lno_t row_size_variance) {
+  using crsMat_t = typename KokkosSparse::CrsMatrix<scalar_t, lno_t, Device,
+                                                    void, size_type>;
+  using scalar_view_t = typename crsMat_t::values_type::non_const_type;
+  using mag_t         = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+  using handle_t =
+      KokkosSparse::SPMVHandle<Device, crsMat_t, scalar_view_t, scalar_view_t>;
+
+  crsMat_t A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      numRows, numRows, nnz, row_size_variance, bandwidth);
+  const lno_t max_nnz_per_row =
+      numRows ? (nnz / numRows + row_size_variance) : 0;
+
+  scalar_view_t x("x", numRows);
+  scalar_view_t y("y", numRows);
+  Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(
+      13718);
+  Kokkos::fill_random(x, rand_pool, randomUpperBound<scalar_t>(1));
+  Kokkos::fill_random(y, rand_pool, randomUpperBound<scalar_t>(1));
+  Kokkos::fill_random(A.values, rand_pool, randomUpperBound<scalar_t>(1));
+
+  const std::string path = "kokkoskernels_spmv_dispatch_trace.json";
+  std::remove(path.c_str());
+  KokkosKernels::Experimental::Controls controls;
+  controls.setParameter("dispatch_trace", path);
+  KokkosKernels::Experimental::set_dispatch_trace(controls);
+  handle_t handle(KokkosSparse::SPMV_NATIVE);
+  mag_t max_error    = max_nnz_per_row;
+  const int numCalls = 3;
+  for (int i = 0; i < numCalls; i++)
+    Test::check_spmv(&handle, A, x, y, scalar_t(1), scalar_t(0), "N",
+                     max_error);
+  KokkosKernels::Experimental::set_dispatch_trace("");
+
+  // One line per call, naming the kernel, the algorithm and the native path
+  std::ifstream trace(path);
+  std::string line;
+  int numLines = 0;
+  while (std::getline(trace, line)) {
+    numLines++;
+    EXPECT_NE(line.find("\"kernel\":\"spmv\""), std::string::npos) << line;
+    EXPECT_NE(line.find("\"algorithm\":\"SPMV_NATIVE\""), std::string::npos)
+        << line;
+    EXPECT_NE(line.find("\"impl\":\"native\""), std::string::npos) << line;
+    EXPECT_NE(line.find("\"nnz\":" + std::to_string(A.nnz())),
+              std::string::npos)
+        << line;
+  }
+  EXPECT_EQ(numLines, numCalls);
+  trace.close();
+  std::remove(path.c_str());
+}
+
+// Check that SPMV_NNZ_BALANCED gives each thread a contiguous range of rows
+// with about the same number of entries, and that the ranges are kept and
+// reused until cleared.
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename Device>
+void test_spmv_nnz_balanced(lno_t numRows, size_type nnz, lno_t bandwidth,
+                            lno_t row_size_variance) {
+  using crsMat_t = typename KokkosSparse::CrsMatrix<scalar_t, lno_t, Device,
+                                                    void, size_type>;
+  using scalar_view_t = typename crsMat_t::values_type::non_const_type;
+  using mag_t         = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+  using handle_t =
+      KokkosSparse::SPMVHandle<Device, crsMat_t, scalar_view_t, scalar_view_t>;
+  using execution_space = typename Device::execution_space;
+
+  crsMat_t A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      numRows, numRows, nnz, row_size_variance, bandwidth);
+  const lno_t max_nnz_per_row =
+      numRows ? (nnz / numRows + row_size_variance) : 0;
+
+  scalar_view_t x("x", numRows);
+  scalar_view_t y("y", numRows);
+  Kokkos::Random_XorShift64_Pool<execution_space> rand_pool(13718);
+  Kokkos::fill_random(x, rand_pool, randomUpperBound<scalar_t>(1));
+  Kokkos::fill_random(y, rand_pool, randomUpperBound<scalar_t>(1));
+  Kokkos::fill_random(A.values, rand_pool, randomUpperBound<scalar_t>(1));
+
+  handle_t handle(KokkosSparse::SPMV_NNZ_BALANCED);
+  mag_t max_error = max_nnz_per_row;
+  for (int i = 0; i < 2; i++)
+    Test::check_spmv(&handle, A, x, y, scalar_t(2.5), scalar_t(-1.5), "N",
+                     max_error);
+  // GPU execution spaces, and hosts with a single thread, use the native
+  // kernels instead
+  if constexpr (KokkosKernels::Impl::kk_is_gpu_exec_space<execution_space>())
+    return;
+  const int num_parts = execution_space().concurrency();
+  if (numRows == 0 || num_parts == 1) return;
+
+  ASSERT_TRUE(handle.has_nnz_balanced_rows(numRows, num_parts));
+  auto starts = Kokkos::create_mirror_view_and_copy(
+      Kokkos::HostSpace(), handle.nnz_balanced_row_starts);
+  auto rowmap = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                    A.graph.row_map);
+  EXPECT_EQ(starts(0), lno_t(0));
+  EXPECT_EQ(starts(num_parts), numRows);
+  // A range can only exceed its share of the entries by its last row
+  const size_type share = (A.nnz() + num_parts - 1) / num_parts;
+  size_type longest_row = 0;
+  for (lno_t i = 0; i < numRows; i++)
+    longest_row = std::max<size_type>(longest_row, rowmap(i + 1) - rowmap(i));
+  for (int p = 0; p < num_parts; p++) {
+    EXPECT_LE(starts(p), starts(p + 1));
+    EXPECT_LE(rowmap(starts(p + 1)) - rowmap(starts(p)),
+              share + longest_row);
+  }
+
+  handle.clear_nnz_balanced_rows();
+  EXPECT_FALSE(handle.has_nnz_balanced_rows(numRows, num_parts));
+  Test::check_spmv(&handle, A, x, y, scalar_t(1), scalar_t(0), "N",
+                   max_error);
+  EXPECT_TRUE(handle.has_nnz_balanced_rows(numRows, num_parts));
+}
+
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename Device>
+void test_spmv_cached_transpose(lno_t numRows, size_type nnz, lno_t bandwidth,
+                                lno_t row_size_variance) {
+  using crsMat_t = typename KokkosSparse::CrsMatrix<scalar_t, lno_t, Device,
+                                                    void, size_type>;
+  using scalar_view_t = typename crsMat_t::values_type::non_const_type;
+  using mag_t         = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+  using handle_t =
+      KokkosSparse::SPMVHandle<Device, crsMat_t, scalar_view_t, scalar_view_t>;
+
+  crsMat_t A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      numRows, numRows, nnz, row_size_variance, bandwidth);
+  const lno_t max_nnz_per_row =
+      numRows ? (nnz / numRows + row_size_variance) : 0;
+
+  scalar_view_t x("x", numRows);
+  scalar_view_t y("y", numRows);
+  Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(
+      13718);
+  Kokkos::fill_random(x, rand_pool, randomUpperBound<scalar_t>(1));
+  Kokkos::fill_random(y, rand_pool, randomUpperBound<scalar_t>(1));
+  Kokkos::fill_random(A.values, rand_pool, randomUpperBound<scalar_t>(1));
+
+  for (auto algo : {KokkosSparse::SPMV_DEFAULT, KokkosSparse::SPMV_NATIVE}) {
+    handle_t handle(algo);
+    handle.cache_transpose = true;
+    mag_t max_error        = max_nnz_per_row;
+    // Non-transposed modes do not build the transpose
+    Test::check_spmv(&handle, A, x, y, scalar_t(1), scalar_t(0), "N",
+                     max_error);
+    EXPECT_FALSE(handle.has_cached_transpose());
+    EXPECT_EQ(handle.get_cached_transpose_bytes(), size_t(0));
+    for (int i = 0; i < 2; i++) {
+      for (const char *mode : {"T", "H"}) {
+        Test::check_spmv(&handle, A, x, y, scalar_t(1), scalar_t(0), mode,
+                         max_error);
+        Test::check_spmv(&handle, A, x, y, scalar_t(2.5), scalar_t(-1.5),
+                         mode, max_error);
+      }
+    }
+    EXPECT_EQ(handle.has_cached_transpose(), A.nnz() > 0);
+    if (A.nnz() > 0) EXPECT_GT(handle.get_cached_transpose_bytes(), size_t(0));
+    handle.clear_cached_transpose();
+    EXPECT_EQ(handle.get_cached_transpose_bytes(), size_t(0));
+    Test::check_spmv(&handle, A, x, y, scalar_t(1), scalar_t(0), "T",
+                     max_error);
+  }
+}
+
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename Device>
+void test_spmv_auto_block(lno_t numBlockRows, lno_t blockSize,
+                          bool partialBlocks) {
+  using crsMat_t = typename KokkosSparse::CrsMatrix<scalar_t, lno_t, Device,
+                                                    void, size_type>;
+  using scalar_view_t = typename crsMat_t::values_type::non_const_type;
+  using rowmap_t      = typename crsMat_t::row_map_type::non_const_type;
+  using entries_t     = typename crsMat_t::index_type::non_const_type;
+  using mag_t         = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+  using handle_t =
+      KokkosSparse::SPMVHandle<Device, crsMat_t, scalar_view_t, scalar_view_t>;
+
+  // Expand a random graph into blocks of blockSize x blockSize entries. With
+  // partialBlocks, the top right entry of each block is left out.
+  crsMat_t G = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      numBlockRows, numBlockRows, numBlockRows * 4, 2, numBlockRows);
+  auto hGRowmap = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                      G.graph.row_map);
+  auto hGEntries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                       G.graph.entries);
+  const lno_t numRows = numBlockRows * blockSize;
+  std::vector<size_type> rowmapVec(numRows + 1, 0);
+  std::vector<lno_t> entriesVec;
+  for (lno_t r = 0; r < numRows; r++) {
+    const lno_t br = r / blockSize;
+    for (size_type k = hGRowmap(br); k < hGRowmap(br + 1); k++) {
+      for (lno_t c = 0; c < blockSize; c++) {
+        if (partialBlocks && r % blockSize == 0 && c == blockSize - 1)
+          continue;
+        entriesVec.push_back(hGEntries(k) * blockSize + c);
+      }
+    }
+    rowmapVec[r + 1] = entriesVec.size();
+  }
+  const size_type nnz = entriesVec.size();
+  rowmap_t rowmap("rowmap", numRows + 1);
+  entries_t entries("entries", nnz);
+  scalar_view_t values("values", nnz);
+  auto hRowmap  = Kokkos::create_mirror_view(rowmap);
+  auto hEntries = Kokkos::create_mirror_view(entries);
+  for (lno_t r = 0; r <= numRows; r++) hRowmap(r) = rowmapVec[r];
+  for (size_type k = 0; k < nnz; k++) hEntries(k) = entriesVec[k];
+  Kokkos::deep_copy(rowmap, hRowmap);
+  Kokkos::deep_copy(entries, hEntries);
+  crsMat_t A("A", numRows, numRows, nnz, values, rowmap, entries);
+
+  scalar_view_t x("x", numRows);
+  scalar_view_t y("y", numRows);
+  Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(
+      13718);
+  Kokkos::fill_random(x, rand_pool, randomUpperBound<scalar_t>(1));
+  Kokkos::fill_random(y, rand_pool, randomUpperBound<scalar_t>(1));
+  Kokkos::fill_random(A.values, rand_pool, randomUpperBound<scalar_t>(1));
+  lno_t max_nnz_per_row = 0;
+  for (lno_t r = 0; r < numRows; r++)
+    max_nnz_per_row =
+        std::max(max_nnz_per_row, lno_t(rowmapVec[r + 1] - rowmapVec[r]));
+
+  // Dense blocks always pay off. Whether zero padded blocks do depends on the
+  // sizes of the scalar and ordinal types.
+  const size_t expectedSize =
+      KokkosSparse::Impl::detect_profitable_block_size(A);
+  if (!partialBlocks) EXPECT_EQ(expectedSize, size_t(blockSize));
+
+  for (auto algo : {KokkosSparse::SPMV_DEFAULT, KokkosSparse::SPMV_NATIVE}) {
+    handle_t handle(algo);
+    handle.auto_block = true;
+    mag_t max_error   = max_nnz_per_row;
+    EXPECT_FALSE(handle.is_auto_block_detected());
+    for (int i = 0; i < 2; i++) {
+      for (const char *mode : {"N", "C", "T", "H"}) {
+        Test::check_spmv(&handle, A, x, y, scalar_t(1), scalar_t(0), mode,
+                         max_error);
+        Test::check_spmv(&handle, A, x, y, scalar_t(2.5), scalar_t(-1.5),
+                         mode, max_error);
+      }
+    }
+    EXPECT_EQ(size_t(handle.get_auto_block_size()), expectedSize);
+    EXPECT_EQ(handle.has_auto_block(), expectedSize > 1);
+    if (expectedSize > 1)
+      EXPECT_GT(handle.get_auto_block_bytes(), size_t(0));
+    else
+      EXPECT_EQ(handle.get_auto_block_bytes(), size_t(0));
+
+    // New values of A are picked up after clear_auto_block
+    Kokkos::fill_random(A.values, rand_pool, randomUpperBound<scalar_t>(2));
+    handle.clear_auto_block();
+    EXPECT_FALSE(handle.is_auto_block_detected());
+    EXPECT_EQ(handle.get_auto_block_bytes(), size_t(0));
+    Test::check_spmv(&handle, A, x, y, scalar_t(1), scalar_t(0), "N",
+                     max_error);
+    EXPECT_EQ(size_t(handle.get_auto_block_size()), expectedSize);
+  }
+
+  // A matrix without block structure is left as is
+  crsMat_t B = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      numRows, numRows, numRows * 5, 10, 100);
+  Kokkos::fill_random(B.values, rand_pool, randomUpperBound<scalar_t>(1));
+  handle_t handle(KokkosSparse::SPMV_DEFAULT);
+  handle.auto_block = true;
+  Test::check_spmv(&handle, B, x, y, scalar_t(1), scalar_t(0), "N",
+                   mag_t(15));
+  EXPECT_EQ(handle.get_auto_block_size(), 1);
+  EXPECT_FALSE(handle.has_auto_block());
+}
+
 template <typename scalar_t, typename lno_t, typename size_type,
           typename layout, class Device>
-void test_spmv_mv(lno_t numRows, size_type nnz, lno_t bandwidth,
-                  lno_t row_size_variance, bool heavy, int numMV) {
+void test_spmv_mv(
+    lno_t numRows, size_type nnz, lno_t bandwidth, lno_t row_size_variance,
+    bool heavy, int numMV,
+    KokkosSparse::SPMVAlgorithm algo = KokkosSparse::SPMV_DEFAULT) {
   using mag_t = typename Kokkos::ArithTraits<scalar_t>::mag_type;
 
   constexpr mag_t max_x   = static_cast<mag_t>(1);
@@ -557,7 +929,7 @@ void test_spmv_mv(lno_t numRows, size_type nnz, lno_t bandwidth,
     testAlphaBeta.push_back(-1.0);
     testAlphaBeta.push_back(2.5);
   }
-  handle_t handle;
+  handle_t handle(algo);
   for (auto mode : nonTransModes) {
     for (double alpha : testAlphaBeta) {
       for (double beta : testAlphaBeta) {
@@ -1062,6 +1434,69 @@ void test_github_issue_101() {
   }
 }
 
+// Mixed precision SpMV: A has (lower precision) matrix_scalar_t values, while
+// x and y are double. The result must match a double SpMV with A's values
+// rounded to matrix_scalar_t, up to double rounding: alpha and beta must not be
+// rounded and the products must be accumulated in double.
+template <typename matrix_scalar_t, typename lno_t, typename size_type,
+          typename Device>
+void test_spmv_mixed_precision(lno_t numRows, size_type nnz, lno_t bandwidth,
+                               lno_t row_size_variance) {
+  using crsMat_d_t =
+      KokkosSparse::CrsMatrix<double, lno_t, Device, void, size_type>;
+  using crsMat_t =
+      KokkosSparse::CrsMatrix<matrix_scalar_t, lno_t, Device, void, size_type>;
+  using vec_t = Kokkos::View<double *, Device>;
+  using mv_t  = Kokkos::View<double **, Kokkos::LayoutLeft, Device>;
+
+  crsMat_d_t A_d = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_d_t>(
+      numRows, numRows, nnz, row_size_variance, bandwidth);
+  // Round A_d's values to matrix_scalar_t, so A_d and A hold the same matrix
+  typename crsMat_t::values_type::non_const_type values(
+      "values", A_d.values.extent(0));
+  {
+    auto values_d_h =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A_d.values);
+    auto values_h = Kokkos::create_mirror_view(values);
+    for (size_t i = 0; i < values_h.extent(0); i++) {
+      values_h(i)   = static_cast<matrix_scalar_t>(values_d_h(i));
+      values_d_h(i) = static_cast<double>(values_h(i));
+    }
+    Kokkos::deep_copy(values, values_h);
+    Kokkos::deep_copy(A_d.values, values_d_h);
+  }
+  crsMat_t A("A", A_d.numCols(), values, A_d.graph);
+
+  Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(
+      13718);
+  // alpha and beta are not representable in float or half precision
+  const double alpha = 1.0 / 3.0;
+  const double beta  = -0.7;
+  const double tol   = 1e-10;
+  for (const char *mode : {"N", "C", "T", "H"}) {
+    vec_t x("x", numRows), y("y", numRows), y_ref("y_ref", numRows);
+    Kokkos::fill_random(x, rand_pool, 1.0);
+    Kokkos::fill_random(y, rand_pool, 1.0);
+    Kokkos::deep_copy(y_ref, y);
+    KokkosSparse::spmv(mode, alpha, A_d, x, beta, y_ref);
+    KokkosSparse::spmv(mode, alpha, A, x, beta, y);
+    EXPECT_NEAR_KK_1DVIEW(y, y_ref, tol);
+
+    constexpr int numVecs = 3;
+    mv_t X("X", numRows, numVecs), Y("Y", numRows, numVecs),
+        Y_ref("Y_ref", numRows, numVecs);
+    Kokkos::fill_random(X, rand_pool, 1.0);
+    Kokkos::fill_random(Y, rand_pool, 1.0);
+    Kokkos::deep_copy(Y_ref, Y);
+    KokkosSparse::spmv(mode, alpha, A_d, X, beta, Y_ref);
+    KokkosSparse::spmv(mode, alpha, A, X, beta, Y);
+    for (int j = 0; j < numVecs; j++) {
+      EXPECT_NEAR_KK_1DVIEW(Kokkos::subview(Y, Kokkos::ALL(), j),
+                            Kokkos::subview(Y_ref, Kokkos::ALL(), j), tol);
+    }
+  }
+}
+
 template <class scalar_t, class lno_t, class size_type, class layout_t,
           class DeviceType>
 void test_spmv_all_interfaces_light() {
@@ -1186,6 +1621,18 @@ void test_spmv_all_interfaces_light() {
                                                           100, 10, false);     \
     test_spmv_algorithms<SCALAR, ORDINAL, OFFSET, DEVICE>(10000, 10000 * 2,    \
                                                           100, 5, false);      \
+    test_spmv_autotune<SCALAR, ORDINAL, OFFSET, DEVICE>(1000, 1000 * 5, 100,   \
+                                                        10);                   \
+    test_spmv_cached_transpose<SCALAR, ORDINAL, OFFSET, DEVICE>(               \
+        1000, 1000 * 5, 100, 10);                                              \
+    test_spmv_nnz_balanced<SCALAR, ORDINAL, OFFSET, DEVICE>(1000, 1000 * 5,    \
+                                                            100, 50);          \
+    test_spmv_auto_block<SCALAR, ORDINAL, OFFSET, DEVICE>(101, 3, false);      \
+    test_spmv_auto_block<SCALAR, ORDINAL, OFFSET, DEVICE>(101, 3, true);       \
+    test_spmv_telemetry<SCALAR, ORDINAL, OFFSET, DEVICE>(1000, 1000 * 5, 100,  \
+                                                         10);                  \
+    test_spmv_dispatch_trace<SCALAR, ORDINAL, OFFSET, DEVICE>(1000, 1000 * 5,  \
+                                                              100, 10);        \
   }
 
 #define EXECUTE_TEST_INTERFACES(SCALAR, ORDINAL, OFFSET, LAYOUT, DEVICE)              \
@@ -1212,6 +1659,10 @@ void test_spmv_all_interfaces_light() {
         50002, 50002 * 3, 100, 10, false, 1);                                       \
     test_spmv_mv<SCALAR, ORDINAL, OFFSET, Kokkos::LAYOUT, DEVICE>(                  \
         10000, 10000 * 2, 100, 5, false, 5);                                        \
+    test_spmv_mv<SCALAR, ORDINAL, OFFSET, Kokkos::LAYOUT, DEVICE>(                  \
+        1003, 1003 * 2, 100, 5, true, 10, KokkosSparse::SPMV_MV_TILED);             \
+    test_spmv_mv<SCALAR, ORDINAL, OFFSET, Kokkos::LAYOUT, DEVICE>(                  \
+        999, 999 * 3, 100, 10, true, 19, KokkosSparse::SPMV_MV_TILED);              \
     test_spmv_mv_heavy<SCALAR, ORDINAL, OFFSET, Kokkos::LAYOUT,                     \
                        Kokkos::LAYOUT, DEVICE>(204, 201, 204 * 10, 60, 4, 30);      \
     test_spmv_mv_heavy<SCALAR, ORDINAL, OFFSET, Kokkos::LAYOUT,                     \
@@ -1257,6 +1708,34 @@ void test_spmv_all_interfaces_light() {
 EXECUTE_TEST_ISSUE_101(TestDevice)
 #endif
 
+#if (!defined(KOKKOSKERNELS_ETI_ONLY) &&            \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS)) || \
+    (defined(KOKKOSKERNELS_INST_DOUBLE) &&           \
+     defined(KOKKOSKERNELS_INST_FLOAT) &&            \
+     defined(KOKKOSKERNELS_INST_ORDINAL_INT) &&      \
+     defined(KOKKOSKERNELS_INST_OFFSET_INT) &&       \
+     defined(KOKKOSKERNELS_INST_LAYOUTLEFT))
+TEST_F(TestCategory, sparse_spmv_mixed_precision_float) {
+  test_spmv_mixed_precision<float, int, int, TestDevice>(1000, 1000 * 5, 100,
+                                                         10);
+  test_spmv_mixed_precision<float, int, int, TestDevice>(10000, 10000 * 20,
+                                                         500, 20);
+}
+#endif
+
+#if (!defined(KOKKOSKERNELS_ETI_ONLY) &&            \
+     !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS)) || \
+    (defined(KOKKOSKERNELS_INST_DOUBLE) &&           \
+     defined(KOKKOSKERNELS_INST_HALF) &&             \
+     defined(KOKKOSKERNELS_INST_ORDINAL_INT) &&      \
+     defined(KOKKOSKERNELS_INST_OFFSET_INT) &&       \
+     defined(KOKKOSKERNELS_INST_LAYOUTLEFT))
+TEST_F(TestCategory, sparse_spmv_mixed_precision_half) {
+  test_spmv_mixed_precision<kokkos_half, int, int, TestDevice>(1000, 1000 * 5,
+                                                               100, 10);
+}
+#endif
+
 #define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE) \
   EXECUTE_TEST_FN(SCALAR, ORDINAL, OFFSET, TestDevice)              \
   EXECUTE_TEST_STRUCT(SCALAR, ORDINAL, OFFSET, TestDevice)
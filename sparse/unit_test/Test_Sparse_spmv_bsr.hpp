@@ -362,7 +362,9 @@ void test_spmv_combos(const char *mode, const Bsr &a, const Crs &acrs,
 
   // cover a variety of algorithms
   std::vector<handle_t *> handles;
-  for (SPMVAlgorithm algo : {SPMV_DEFAULT, SPMV_NATIVE, SPMV_BSR_V41})
+  for (SPMVAlgorithm algo :
+       {SPMV_DEFAULT, SPMV_NATIVE, SPMV_BSR_V41, SPMV_MERGE_PATH,
+        SPMV_AUTOTUNE})
     handles.push_back(new handle_t(algo));
 
   // Tensor core algorithm temporarily disabled, fails on V100
@@ -595,7 +597,9 @@ void test_spm_mv_combos(const char *mode, const Bsr &a, const Crs &acrs,
 
   // cover a variety of algorithms
   std::vector<handle_t *> handles;
-  for (SPMVAlgorithm algo : {SPMV_DEFAULT, SPMV_NATIVE, SPMV_BSR_V41})
+  for (SPMVAlgorithm algo :
+       {SPMV_DEFAULT, SPMV_NATIVE, SPMV_BSR_V41, SPMV_MERGE_PATH,
+        SPMV_MV_TILED, SPMV_AUTOTUNE})
     handles.push_back(new handle_t(algo));
 
   // Tensor core algorithm temporarily disabled, fails on V100
@@ -616,7 +620,8 @@ void test_spm_mv_combos(const char *mode, const Bsr &a, const Crs &acrs,
   }
   */
 
-  for (size_t numVecs : {1, 7}) {  // num multivecs
+  // 18 vectors cover a full and a partial tile of SPMV_MV_TILED
+  for (size_t numVecs : {1, 7, 18}) {  // num multivecs
     auto [x, y] = random_multivecs_for_spm_mv<Layout>(mode, a, numVecs);
     for (handle_t *handle : handles) {
       for (scalar_type alpha : {scalar_type(0), scalar_type(1), scalar_type(-1),
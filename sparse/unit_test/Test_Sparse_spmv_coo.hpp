@@ -0,0 +1,145 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <random>
+#include <vector>
+
+#include "KokkosSparse_spmv_coo.hpp"
+#include "KokkosKernels_TestUtils.hpp"
+
+namespace Test {
+
+// Compares spmv_coo in all modes against a host reference. A has a band of
+// dups-times duplicated entries per row plus a tuple with a negative index
+// per row, either sorted by row or shuffled.
+template <class ScalarType, class OrdinalType>
+void doSpmvCoo(OrdinalType m, OrdinalType n, int dups, bool sorted) {
+  using CooType  = KokkosSparse::CooMatrix<ScalarType, OrdinalType, TestDevice>;
+  using ats      = Kokkos::ArithTraits<ScalarType>;
+  using mag_type = typename ats::mag_type;
+  using vector_t = Kokkos::View<ScalarType *, TestDevice>;
+
+  std::vector<OrdinalType> rows, cols;
+  std::vector<ScalarType> vals;
+  std::mt19937 gen(m * 5 + n + dups);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  auto rand_scalar = [&]() {
+    if constexpr (ats::is_complex)
+      return ScalarType(dist(gen), dist(gen));
+    else
+      return ScalarType(dist(gen));
+  };
+  for (OrdinalType i = 0; i < m; i++) {
+    const OrdinalType center = OrdinalType(int64_t(i) * n / m);
+    for (OrdinalType j = center - 2; j <= center + 2; j++) {
+      if (j < 0 || j >= n) continue;
+      for (int d = 0; d < dups; d++) {
+        rows.push_back(i);
+        cols.push_back(j);
+        vals.push_back(rand_scalar());
+      }
+    }
+    rows.push_back(i);
+    cols.push_back(-1);
+    vals.push_back(ats::one());
+  }
+  const size_t nt = rows.size();
+  std::vector<size_t> perm(nt);
+  for (size_t k = 0; k < nt; k++) perm[k] = k;
+  if (!sorted) std::shuffle(perm.begin(), perm.end(), gen);
+
+  typename CooType::row_view row("coo row", nt);
+  typename CooType::column_view col("coo col", nt);
+  typename CooType::scalar_view data("coo data", nt);
+  auto row_h  = Kokkos::create_mirror_view(row);
+  auto col_h  = Kokkos::create_mirror_view(col);
+  auto data_h = Kokkos::create_mirror_view(data);
+  for (size_t k = 0; k < nt; k++) {
+    row_h(k)  = rows[perm[k]];
+    col_h(k)  = cols[perm[k]];
+    data_h(k) = vals[perm[k]];
+  }
+  Kokkos::deep_copy(row, row_h);
+  Kokkos::deep_copy(col, col_h);
+  Kokkos::deep_copy(data, data_h);
+  CooType A(m, n, row, col, data);
+
+  const ScalarType alpha = ScalarType(1.5);
+  for (const char *mode : {"N", "T", "C", "H"}) {
+    const bool trans  = mode[0] == 'T' || mode[0] == 'H';
+    const bool conjug = mode[0] == 'C' || mode[0] == 'H';
+    const OrdinalType xlen = trans ? m : n;
+    const OrdinalType ylen = trans ? n : m;
+    for (const ScalarType beta : {ats::zero(), ScalarType(-0.5)}) {
+      vector_t x("x", xlen);
+      vector_t y("y", ylen);
+      auto x_h = Kokkos::create_mirror_view(x);
+      auto y_h = Kokkos::create_mirror_view(y);
+      for (OrdinalType i = 0; i < xlen; i++) x_h(i) = rand_scalar();
+      for (OrdinalType i = 0; i < ylen; i++) y_h(i) = rand_scalar();
+      Kokkos::deep_copy(x, x_h);
+      Kokkos::deep_copy(y, y_h);
+
+      // reference, and a bound on the sum of the magnitudes of the terms
+      std::vector<ScalarType> ref(ylen);
+      std::vector<mag_type> absum(ylen);
+      std::vector<int> nterms(ylen, 1);
+      for (OrdinalType i = 0; i < ylen; i++) {
+        ref[i]   = beta * y_h(i);
+        absum[i] = ats::abs(beta * y_h(i));
+      }
+      for (size_t k = 0; k < nt; k++) {
+        if (rows[k] < 0 || cols[k] < 0) continue;
+        const OrdinalType out = trans ? cols[k] : rows[k];
+        const OrdinalType in  = trans ? rows[k] : cols[k];
+        const ScalarType a    = conjug ? ats::conj(vals[k]) : vals[k];
+        ref[out] += alpha * a * x_h(in);
+        absum[out] += ats::abs(alpha * a * x_h(in));
+        nterms[out]++;
+      }
+
+      KokkosSparse::spmv_coo(mode, alpha, A, x, beta, y);
+      Kokkos::deep_copy(y_h, y);
+      for (OrdinalType i = 0; i < ylen; i++) {
+        const mag_type tol =
+            4 * ats::abs(ats::epsilon()) * (nterms[i] + 2) * absum[i];
+        ASSERT_LE(ats::abs(ref[i] - y_h(i)), tol)
+            << "mode " << mode << ", beta " << beta << ", entry " << i;
+      }
+    }
+  }
+
+  // dimension mismatch
+  vector_t x_bad("x", n + 1);
+  vector_t y_ok("y", m);
+  EXPECT_THROW(KokkosSparse::spmv_coo("N", alpha, A, x_bad, ats::zero(), y_ok),
+               std::runtime_error);
+}
+
+template <class ScalarType>
+void doAllSpmvCoo() {
+  doSpmvCoo<ScalarType, int>(200, 150, 27, true);
+  doSpmvCoo<ScalarType, int>(200, 150, 27, false);
+  doSpmvCoo<ScalarType, int64_t>(1000, 1300, 3, false);
+  doSpmvCoo<ScalarType, int>(1, 1, 1, true);
+}
+
+TEST_F(TestCategory, sparse_spmv_coo) {
+  doAllSpmvCoo<float>();
+  doAllSpmvCoo<double>();
+  doAllSpmvCoo<Kokkos::complex<float>>();
+  doAllSpmvCoo<Kokkos::complex<double>>();
+}
+}  // namespace Test
@@ -0,0 +1,133 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+
+#include "KokkosBlas1_dot.hpp"
+#include "KokkosSparse_spmv.hpp"
+#include "KokkosSparse_spmv_dot.hpp"
+#include "KokkosSparse_IOUtils.hpp"
+#include "KokkosKernels_TestUtils.hpp"
+
+namespace Test {
+
+// Compare the fused spmv_dot against spmv followed by KokkosBlas::dot.
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void run_test_spmv_dot(lno_t numRows, lno_t numCols, size_type nnz,
+                       lno_t row_size_variance) {
+  using crsMat_t =
+      KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using vec_t      = Kokkos::View<scalar_t*, device>;
+  using AT         = Kokkos::ArithTraits<scalar_t>;
+  using mag_t      = typename AT::mag_type;
+  using exec_space = typename device::execution_space;
+  using handle_t =
+      KokkosSparse::SPMVHandle<exec_space, crsMat_t, vec_t, vec_t>;
+
+  crsMat_t A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      numRows, numCols, nnz, row_size_variance, numCols / 2);
+
+  const mag_t eps = 1e3 * Kokkos::ArithTraits<mag_t>::eps();
+  Kokkos::Random_XorShift64_Pool<exec_space> rand_pool(1234);
+
+  vec_t x("x", numCols), z("z", numRows);
+  Kokkos::fill_random(x, rand_pool, scalar_t(1));
+  Kokkos::fill_random(z, rand_pool, scalar_t(1));
+
+  // Entries of |A| |x| on the host, used to scale the tolerances below.
+  auto row_map = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                     A.graph.row_map);
+  auto entries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                     A.graph.entries);
+  auto values =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.values);
+  auto x_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), x);
+  auto z_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), z);
+  std::vector<mag_t> abs_Ax(numRows, 0);
+  for (lno_t i = 0; i < numRows; ++i) {
+    for (size_type k = row_map(i); k < row_map(i + 1); ++k) {
+      abs_Ax[i] += AT::abs(values(k)) * AT::abs(x_h(entries(k)));
+    }
+  }
+
+  for (scalar_t beta : {scalar_t(0), scalar_t(1), scalar_t(-1.5)}) {
+    // vector_length and team_size are only used on GPUs
+    for (int vector_length : {-1, 4}) {
+      const scalar_t alpha = 2.5;
+      vec_t y("y", numRows), y_ref("y_ref", numRows);
+      Kokkos::fill_random(y, rand_pool, scalar_t(1));
+      Kokkos::deep_copy(y_ref, y);
+      auto y0_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y);
+
+      KokkosSparse::spmv("N", alpha, A, x, beta, y_ref);
+      auto expected = KokkosBlas::dot(y_ref, z);
+
+      handle_t handle(KokkosSparse::SPMV_NATIVE);
+      handle.vector_length = vector_length;
+      auto result = KokkosSparse::spmv_dot(&handle, alpha, A, x, beta, y, z);
+
+      // A negative beta makes entries of y cancel, so compare against
+      // |beta| |y| + |alpha| |A| |x| rather than against y itself.
+      auto y_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y);
+      auto y_ref_h =
+          Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y_ref);
+      mag_t dot_scale = 0;
+      for (lno_t i = 0; i < numRows; ++i) {
+        const mag_t scale =
+            AT::abs(beta) * AT::abs(y0_h(i)) + AT::abs(alpha) * abs_Ax[i];
+        EXPECT_LE(AT::abs(y_h(i) - y_ref_h(i)), eps * scale);
+        dot_scale += AT::abs(z_h(i)) * scale;
+      }
+      EXPECT_LE(AT::abs(result - expected), eps * dot_scale);
+    }
+  }
+
+  // z may alias x
+  if (numRows == numCols) {
+    vec_t y("y", numRows), y_ref("y_ref", numRows);
+    KokkosSparse::spmv("N", scalar_t(1), A, x, scalar_t(0), y_ref);
+    auto expected = KokkosBlas::dot(y_ref, x);
+    auto result =
+        KokkosSparse::spmv_dot(scalar_t(1), A, x, scalar_t(0), y, x);
+    EXPECT_NEAR_KK_REL_1DVIEW(y, y_ref, eps);
+    EXPECT_NEAR_KK_REL(result, expected, eps);
+  }
+}
+
+}  // namespace Test
+
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void test_spmv_dot() {
+  Test::run_test_spmv_dot<scalar_t, lno_t, size_type, device>(1, 1, 1, 0);
+  Test::run_test_spmv_dot<scalar_t, lno_t, size_type, device>(1000, 1000,
+                                                              5000, 20);
+  Test::run_test_spmv_dot<scalar_t, lno_t, size_type, device>(503, 311, 3000,
+                                                              40);
+}
+
+#define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)      \
+  TEST_F(TestCategory,                                                   \
+         sparse##_##spmv_dot##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    test_spmv_dot<SCALAR, ORDINAL, OFFSET, DEVICE>();                    \
+  }
+
+#include <Test_Common_Test_All_Type_Combos.hpp>
+
+#undef KOKKOSKERNELS_EXECUTE_TEST
@@ -0,0 +1,106 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+
+#include "KokkosSparse_spmv.hpp"
+#include "KokkosSparse_spmv_ensemble.hpp"
+#include "KokkosSparse_IOUtils.hpp"
+#include "KokkosKernels_TestUtils.hpp"
+
+namespace Test {
+
+// Compare the ensemble SpMV against one CrsMatrix SpMV per sample, where
+// sample s is a CrsMatrix over the same graph holding column s of the values.
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void run_test_spmv_ensemble(lno_t numRows, lno_t numCols, int k) {
+  using crsMat_t =
+      KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using ensemble_t = KokkosSparse::Experimental::EnsembleCrsMatrix<
+      scalar_t, lno_t, device, void, size_type>;
+  using vec_t      = Kokkos::View<scalar_t*, device>;
+  using mv_t       = Kokkos::View<scalar_t**, Kokkos::LayoutRight, device>;
+  using mag_t      = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+  using exec_space = typename device::execution_space;
+
+  size_type nnz = 5 * numRows;
+  crsMat_t A    = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      numRows, numCols, nnz, 5, numCols);
+  Kokkos::Random_XorShift64_Pool<exec_space> rand_pool(1357);
+
+  ensemble_t E("E", A, k);
+  EXPECT_EQ(E.numRows(), A.numRows());
+  EXPECT_EQ(E.numCols(), A.numCols());
+  EXPECT_EQ(E.nnz(), A.nnz());
+  EXPECT_EQ(E.ensembleSize(), k);
+  Kokkos::fill_random(E.values, rand_pool, scalar_t(1));
+
+  const mag_t eps      = 1e3 * Kokkos::ArithTraits<mag_t>::eps();
+  const scalar_t alpha = 2.5;
+  for (const char* mode : {"N", "C"}) {
+    for (scalar_t beta : {scalar_t(0), scalar_t(1.5)}) {
+      mv_t X("X", numCols, k), Y("Y", numRows, k), Y0("Y0", numRows, k);
+      Kokkos::fill_random(X, rand_pool, scalar_t(1));
+      Kokkos::fill_random(Y, rand_pool, scalar_t(1));
+      Kokkos::deep_copy(Y0, Y);
+      KokkosSparse::Experimental::spmv_ensemble(mode, alpha, E, X, beta, Y);
+
+      for (int s = 0; s < k; s++) {
+        crsMat_t As("As", numCols,
+                    typename crsMat_t::values_type("As values", E.nnz()),
+                    A.graph);
+        Kokkos::deep_copy(As.values,
+                          Kokkos::subview(E.values, Kokkos::ALL(), s));
+        vec_t x("x", numCols), y_ref("y_ref", numRows);
+        Kokkos::deep_copy(x, Kokkos::subview(X, Kokkos::ALL(), s));
+        Kokkos::deep_copy(y_ref, Kokkos::subview(Y0, Kokkos::ALL(), s));
+        KokkosSparse::spmv(mode, alpha, As, x, beta, y_ref);
+        auto Ys = Kokkos::subview(Y, Kokkos::ALL(), s);
+        EXPECT_NEAR_KK_REL_1DVIEW(Ys, y_ref, eps);
+      }
+    }
+  }
+
+  // Transposed modes are not supported
+  mv_t X("X", numCols, k), Y("Y", numRows, k);
+  EXPECT_ANY_THROW(KokkosSparse::Experimental::spmv_ensemble(
+      "T", alpha, E, X, scalar_t(0), Y));
+}
+
+}  // namespace Test
+
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void test_spmv_ensemble() {
+  Test::run_test_spmv_ensemble<scalar_t, lno_t, size_type, device>(10, 10, 1);
+  Test::run_test_spmv_ensemble<scalar_t, lno_t, size_type, device>(1000, 1000,
+                                                                   5);
+  Test::run_test_spmv_ensemble<scalar_t, lno_t, size_type, device>(800, 1200,
+                                                                   16);
+}
+
+#define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)          \
+  TEST_F(TestCategory,                                                       \
+         sparse##_##spmv_ens##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    test_spmv_ensemble<SCALAR, ORDINAL, OFFSET, DEVICE>();                   \
+  }
+
+#include <Test_Common_Test_All_Type_Combos.hpp>
+
+#undef KOKKOSKERNELS_EXECUTE_TEST
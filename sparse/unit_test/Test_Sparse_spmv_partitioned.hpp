@@ -0,0 +1,263 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+
+#include "KokkosSparse_spmv_partitioned.hpp"
+#include "KokkosSparse_DistributedCrsMatrix.hpp"
+#include "KokkosKernels_TestUtils.hpp"
+
+namespace Test {
+
+// How the rows of A are split into interior and boundary rows
+enum class RowSplit {
+  Contiguous,  // [0, n/2) and [n/2, n)
+  Permuted,    // a random permutation, split in half
+  Mixed        // [0, n/3) and every second row of the rest
+};
+
+// Compare spmv_interior followed by spmv_boundary (on two execution space
+// instances) with a full spmv, in modes N and C.
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device, typename vector_t>
+void run_test_spmv_partitioned(lno_t numRows, size_type nnz,
+                               lno_t row_size_variance, RowSplit split,
+                               int numVecs) {
+  using crsMat_t =
+      KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using mag_t      = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+  using exec_space = typename device::execution_space;
+  using handle_t =
+      KokkosSparse::SPMVHandle<device, crsMat_t, vector_t, vector_t>;
+  using rows_t = Kokkos::View<lno_t*, device>;
+
+  crsMat_t A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      numRows, numRows, nnz, row_size_variance, numRows / 4);
+
+  std::vector<lno_t> order(numRows);
+  std::iota(order.begin(), order.end(), lno_t(0));
+  lno_t numInterior = numRows / 2;
+  std::vector<lno_t> untouched;
+  if (split == RowSplit::Permuted) {
+    std::shuffle(order.begin(), order.end(), std::mt19937(1234));
+  } else if (split == RowSplit::Mixed) {
+    numInterior = numRows / 3;
+    std::vector<lno_t> boundary;
+    for (lno_t r = numInterior; r < numRows; r++)
+      (((r - numInterior) % 2) ? untouched : boundary).push_back(r);
+    order.resize(numInterior);
+    order.insert(order.end(), boundary.begin(), boundary.end());
+  }
+  rows_t interior("interior", numInterior);
+  rows_t boundary("boundary", order.size() - numInterior);
+  auto interior_h = Kokkos::create_mirror_view(interior);
+  auto boundary_h = Kokkos::create_mirror_view(boundary);
+  for (lno_t i = 0; i < numInterior; i++) interior_h(i) = order[i];
+  for (size_t i = 0; i < boundary.extent(0); i++)
+    boundary_h(i) = order[numInterior + i];
+  Kokkos::deep_copy(interior, interior_h);
+  Kokkos::deep_copy(boundary, boundary_h);
+
+  handle_t handle;
+  EXPECT_FALSE(handle.has_row_partition());
+  handle.set_row_partition(interior, boundary);
+  EXPECT_TRUE(handle.has_row_partition());
+  EXPECT_EQ(handle.get_num_interior_rows(), numInterior);
+  EXPECT_EQ(handle.get_num_boundary_rows(), lno_t(boundary.extent(0)));
+
+  exec_space space;
+  std::vector<exec_space> instances{space, space};
+  if (space.concurrency() > 1)
+    instances = Kokkos::Experimental::partition_space(space, 1, 1);
+
+  const mag_t eps = 1e3 * Kokkos::ArithTraits<mag_t>::eps();
+  Kokkos::Random_XorShift64_Pool<exec_space> rand_pool(5678);
+  vector_t x, y, y_ref;
+  if constexpr (vector_t::rank == 1) {
+    x     = vector_t("x", numRows);
+    y     = vector_t("y", numRows);
+    y_ref = vector_t("y_ref", numRows);
+  } else {
+    x     = vector_t("x", numRows, numVecs);
+    y     = vector_t("y", numRows, numVecs);
+    y_ref = vector_t("y_ref", numRows, numVecs);
+  }
+  Kokkos::fill_random(x, rand_pool, scalar_t(1));
+
+  for (const char* mode : {"N", "C"}) {
+    for (scalar_t beta : {scalar_t(0), scalar_t(1.5)}) {
+      const scalar_t alpha = 2.5;
+      Kokkos::fill_random(y, rand_pool, scalar_t(1));
+      auto y_orig = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y);
+      Kokkos::deep_copy(y_ref, y);
+      KokkosSparse::spmv(mode, alpha, A, x, beta, y_ref);
+      // Run each part twice: the first call of a contiguous part builds its
+      // block of rows
+      for (int rep = 0; rep < 2; rep++) {
+        Kokkos::deep_copy(y, y_orig);
+        KokkosSparse::Experimental::spmv_interior(instances[0], &handle, mode,
+                                                  alpha, A, x, beta, y);
+        KokkosSparse::Experimental::spmv_boundary(instances[1], &handle, mode,
+                                                  alpha, A, x, beta, y);
+        instances[0].fence();
+        instances[1].fence();
+        // Rows in neither part keep their value
+        auto y_ref_h =
+            Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y_ref);
+        for (lno_t r : untouched) {
+          if constexpr (vector_t::rank == 1)
+            y_ref_h(r) = y_orig(r);
+          else
+            for (int j = 0; j < numVecs; j++) y_ref_h(r, j) = y_orig(r, j);
+        }
+        auto y_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y);
+        if constexpr (vector_t::rank == 1) {
+          EXPECT_NEAR_KK_REL_1DVIEW(y_h, y_ref_h, eps);
+        } else {
+          for (int j = 0; j < numVecs; j++) {
+            EXPECT_NEAR_KK_REL_1DVIEW(
+                Kokkos::subview(y_h, Kokkos::ALL(), j),
+                Kokkos::subview(y_ref_h, Kokkos::ALL(), j), eps);
+          }
+        }
+      }
+    }
+  }
+  EXPECT_THROW(KokkosSparse::Experimental::spmv_interior(
+                   space, &handle, "T", scalar_t(1), A, x, scalar_t(0), y),
+               std::runtime_error);
+  handle.clear_row_partition();
+  EXPECT_FALSE(handle.has_row_partition());
+  EXPECT_THROW(KokkosSparse::Experimental::spmv_boundary(
+                   space, &handle, "N", scalar_t(1), A, x, scalar_t(0), y),
+               std::runtime_error);
+}
+
+// spmv with a DistributedCrsMatrix over nparts instances must match a full
+// spmv, also after new values in A.
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device, typename vector_t>
+void run_test_distributed_crs_matrix(lno_t numRows, size_type nnz,
+                                     lno_t row_size_variance, int nparts,
+                                     int numVecs) {
+  using crsMat_t =
+      KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using mag_t      = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+  using exec_space = typename device::execution_space;
+
+  crsMat_t A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      numRows, numRows, nnz, row_size_variance, numRows / 4);
+
+  exec_space space;
+  std::vector<exec_space> instances(nparts, space);
+  if (space.concurrency() >= nparts) {
+    std::vector<int> weights(nparts, 1);
+    instances = Kokkos::Experimental::partition_space(space, weights);
+  }
+  KokkosSparse::Experimental::DistributedCrsMatrix<crsMat_t> dA(instances, A);
+  EXPECT_EQ(dA.num_parts(), nparts);
+  EXPECT_EQ(dA.get_first_row(0), lno_t(0));
+  EXPECT_EQ(dA.get_first_row(nparts), numRows);
+  for (int p = 0; p < nparts; p++) {
+    EXPECT_LE(dA.get_first_row(p), dA.get_first_row(p + 1));
+    EXPECT_EQ(dA.get_block(p).numRows(),
+              dA.get_first_row(p + 1) - dA.get_first_row(p));
+  }
+
+  const mag_t eps = 1e3 * Kokkos::ArithTraits<mag_t>::eps();
+  Kokkos::Random_XorShift64_Pool<exec_space> rand_pool(4321);
+  vector_t x, y, y_ref;
+  if constexpr (vector_t::rank == 1) {
+    x     = vector_t("x", numRows);
+    y     = vector_t("y", numRows);
+    y_ref = vector_t("y_ref", numRows);
+  } else {
+    x     = vector_t("x", numRows, numVecs);
+    y     = vector_t("y", numRows, numVecs);
+    y_ref = vector_t("y_ref", numRows, numVecs);
+  }
+  Kokkos::fill_random(x, rand_pool, scalar_t(1));
+
+  for (int rep = 0; rep < 2; rep++) {
+    // The blocks view the values of A
+    if (rep) Kokkos::fill_random(A.values, rand_pool, scalar_t(1));
+    const scalar_t alpha = 2.5, beta = 1.5;
+    Kokkos::fill_random(y, rand_pool, scalar_t(1));
+    Kokkos::deep_copy(y_ref, y);
+    KokkosSparse::spmv("N", alpha, A, x, beta, y_ref);
+    KokkosSparse::Experimental::spmv("N", alpha, dA, x, beta, y);
+    dA.fence();
+    auto y_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y);
+    auto y_ref_h =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y_ref);
+    if constexpr (vector_t::rank == 1) {
+      EXPECT_NEAR_KK_REL_1DVIEW(y_h, y_ref_h, eps);
+    } else {
+      for (int j = 0; j < numVecs; j++) {
+        EXPECT_NEAR_KK_REL_1DVIEW(Kokkos::subview(y_h, Kokkos::ALL(), j),
+                                  Kokkos::subview(y_ref_h, Kokkos::ALL(), j),
+                                  eps);
+      }
+    }
+  }
+  EXPECT_THROW(KokkosSparse::Experimental::spmv("T", scalar_t(1), dA, x,
+                                                scalar_t(0), y),
+               std::runtime_error);
+}
+
+}  // namespace Test
+
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void test_spmv_partitioned() {
+  using vec_t = Kokkos::View<scalar_t*, device>;
+  using mv_t  = Kokkos::View<scalar_t**, Kokkos::LayoutLeft, device>;
+  for (auto split : {Test::RowSplit::Contiguous, Test::RowSplit::Permuted,
+                     Test::RowSplit::Mixed}) {
+    Test::run_test_spmv_partitioned<scalar_t, lno_t, size_type, device, vec_t>(
+        1000, 10000, 20, split, 1);
+    Test::run_test_spmv_partitioned<scalar_t, lno_t, size_type, device, mv_t>(
+        777, 5000, 10, split, 3);
+    Test::run_test_spmv_partitioned<scalar_t, lno_t, size_type, device, vec_t>(
+        1, 1, 0, split, 1);
+  }
+  for (int nparts : {1, 3}) {
+    Test::run_test_distributed_crs_matrix<scalar_t, lno_t, size_type, device,
+                                          vec_t>(1000, 10000, 20, nparts, 1);
+    Test::run_test_distributed_crs_matrix<scalar_t, lno_t, size_type, device,
+                                          mv_t>(777, 5000, 10, nparts, 3);
+    Test::run_test_distributed_crs_matrix<scalar_t, lno_t, size_type, device,
+                                          vec_t>(2, 2, 0, nparts, 1);
+  }
+}
+
+#define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)          \
+  TEST_F(                                                                    \
+      TestCategory,                                                          \
+      sparse##_##spmv_partitioned##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    test_spmv_partitioned<SCALAR, ORDINAL, OFFSET, DEVICE>();                \
+  }
+
+#include <Test_Common_Test_All_Type_Combos.hpp>
+
+#undef KOKKOSKERNELS_EXECUTE_TEST
@@ -0,0 +1,108 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+
+#include "KokkosSparse_crs2sell.hpp"
+#include "KokkosSparse_spmv.hpp"
+#include "KokkosSparse_IOUtils.hpp"
+#include "KokkosKernels_TestUtils.hpp"
+
+namespace Test {
+
+// Compare SpMV with a SellMatrix against SpMV with the CrsMatrix it was
+// converted from, for all modes and for single vectors and multivectors.
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void run_test_spmv_sell(lno_t numRows, lno_t numCols, size_type nnz,
+                        lno_t row_size_variance, int chunk_size,
+                        int64_t sigma) {
+  using crsMat_t =
+      KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using vec_t    = Kokkos::View<scalar_t*, device>;
+  using mv_t     = Kokkos::View<scalar_t**, Kokkos::LayoutLeft, device>;
+  using mag_t    = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+  using exec_space = typename device::execution_space;
+
+  crsMat_t A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      numRows, numCols, nnz, row_size_variance, numCols / 2);
+  auto S = KokkosSparse::Experimental::crs2sell(chunk_size, sigma, A);
+
+  EXPECT_EQ(S.numRows(), A.numRows());
+  EXPECT_EQ(S.numCols(), A.numCols());
+  EXPECT_EQ(S.nnz(), A.nnz());
+  EXPECT_GE(S.storageSize(), S.nnz());
+
+  const mag_t eps = 1e3 * Kokkos::ArithTraits<mag_t>::eps();
+  Kokkos::Random_XorShift64_Pool<exec_space> rand_pool(2345);
+
+  for (const char* mode : {"N", "C", "T", "H"}) {
+    const bool transposed = mode[0] == 'T' || mode[0] == 'H';
+    const lno_t xlen      = transposed ? numRows : numCols;
+    const lno_t ylen      = transposed ? numCols : numRows;
+    for (scalar_t beta : {scalar_t(0), scalar_t(-1.5)}) {
+      const scalar_t alpha = 2.5;
+      vec_t x("x", xlen), y("y", ylen), y_ref("y_ref", ylen);
+      Kokkos::fill_random(x, rand_pool, scalar_t(1));
+      Kokkos::fill_random(y, rand_pool, scalar_t(1));
+      Kokkos::deep_copy(y_ref, y);
+      KokkosSparse::spmv(mode, alpha, A, x, beta, y_ref);
+      KokkosSparse::spmv(mode, alpha, S, x, beta, y);
+      EXPECT_NEAR_KK_REL_1DVIEW(y, y_ref, eps);
+
+      mv_t X("X", xlen, 3), Y("Y", ylen, 3), Y_ref("Y_ref", ylen, 3);
+      Kokkos::fill_random(X, rand_pool, scalar_t(1));
+      Kokkos::fill_random(Y, rand_pool, scalar_t(1));
+      Kokkos::deep_copy(Y_ref, Y);
+      KokkosSparse::spmv(mode, alpha, A, X, beta, Y_ref);
+      KokkosSparse::spmv(mode, alpha, S, X, beta, Y);
+      for (int j = 0; j < 3; j++) {
+        auto Yj     = Kokkos::subview(Y, Kokkos::ALL(), j);
+        auto Y_refj = Kokkos::subview(Y_ref, Kokkos::ALL(), j);
+        EXPECT_NEAR_KK_REL_1DVIEW(Yj, Y_refj, eps);
+      }
+    }
+  }
+}
+
+}  // namespace Test
+
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void test_spmv_sell() {
+  for (int chunk_size : {1, 4, 32}) {
+    for (int64_t sigma : {1, 32, 256}) {
+      Test::run_test_spmv_sell<scalar_t, lno_t, size_type, device>(
+          1, 1, 1, 0, chunk_size, sigma);
+      Test::run_test_spmv_sell<scalar_t, lno_t, size_type, device>(
+          1000, 1000, 5000, 20, chunk_size, sigma);
+      Test::run_test_spmv_sell<scalar_t, lno_t, size_type, device>(
+          503, 311, 3000, 40, chunk_size, sigma);
+    }
+  }
+}
+
+#define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)       \
+  TEST_F(TestCategory,                                                    \
+         sparse##_##spmv_sell##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    test_spmv_sell<SCALAR, ORDINAL, OFFSET, DEVICE>();                    \
+  }
+
+#include <Test_Common_Test_All_Type_Combos.hpp>
+
+#undef KOKKOSKERNELS_EXECUTE_TEST
@@ -0,0 +1,175 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+
+#include "KokkosSparse_StencilMatrix.hpp"
+#include "KokkosSparse_spmv.hpp"
+#include "KokkosKernels_TestUtils.hpp"
+
+namespace Test {
+
+// Assemble the CrsMatrix equivalent to a StencilMatrix on the host
+template <typename crsMat_t, typename stencil_t>
+crsMat_t stencil_to_crs(const stencil_t& S) {
+  using lno_t       = typename crsMat_t::ordinal_type;
+  using size_type   = typename crsMat_t::size_type;
+  using scalar_t    = typename crsMat_t::value_type;
+  using row_map_t   = typename crsMat_t::row_map_type::non_const_type;
+  using entries_t   = typename crsMat_t::index_type::non_const_type;
+  using values_t    = typename crsMat_t::values_type::non_const_type;
+  const lno_t ni    = S.gridExtent(0);
+  const lno_t nj    = S.gridExtent(1);
+  const lno_t nk    = S.gridExtent(2);
+  const int P       = S.numStencilPoints();
+  const lno_t nrows = S.numRows();
+
+  auto offs = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                  S.offsets);
+  auto vals = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                  S.values);
+  row_map_t row_map("row_map", nrows + 1);
+  entries_t entries("entries", S.nnz());
+  values_t values("values", S.nnz());
+  auto row_map_h = Kokkos::create_mirror_view(row_map);
+  auto entries_h = Kokkos::create_mirror_view(entries);
+  auto values_h  = Kokkos::create_mirror_view(values);
+  size_type nnz  = 0;
+  for (lno_t k = 0; k < nk; k++) {
+    for (lno_t j = 0; j < nj; j++) {
+      for (lno_t i = 0; i < ni; i++) {
+        const lno_t r = i + ni * (j + nj * k);
+        row_map_h(r)  = nnz;
+        for (int p = 0; p < P; p++) {
+          const lno_t ii = i + offs(p, 0);
+          const lno_t jj = j + offs(p, 1);
+          const lno_t kk = k + offs(p, 2);
+          if (ii < 0 || ii >= ni || jj < 0 || jj >= nj || kk < 0 || kk >= nk)
+            continue;
+          entries_h(nnz) = ii + ni * (jj + nj * kk);
+          values_h(nnz)  = S.isConstantCoefficient() ? vals(0, p) : vals(r, p);
+          nnz++;
+        }
+      }
+    }
+  }
+  row_map_h(nrows) = nnz;
+  EXPECT_EQ(nnz, S.nnz());
+  Kokkos::deep_copy(row_map, row_map_h);
+  Kokkos::deep_copy(entries, entries_h);
+  Kokkos::deep_copy(values, values_h);
+  return crsMat_t("A", nrows, nrows, S.nnz(), values, row_map, entries);
+}
+
+// Compare SpMV with a StencilMatrix against SpMV with the equivalent
+// CrsMatrix, for all modes and for single vectors and multivectors.
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device, typename offsets_t>
+void run_test_spmv_stencil(lno_t ni, lno_t nj, lno_t nk,
+                           const offsets_t& offsets, bool constant) {
+  using crsMat_t =
+      KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using stencil_t = KokkosSparse::Experimental::StencilMatrix<scalar_t, lno_t,
+                                                              device, void,
+                                                              size_type>;
+  using vec_t      = Kokkos::View<scalar_t*, device>;
+  using mv_t       = Kokkos::View<scalar_t**, Kokkos::LayoutLeft, device>;
+  using mag_t      = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+  using exec_space = typename device::execution_space;
+
+  Kokkos::Random_XorShift64_Pool<exec_space> rand_pool(4567);
+  const lno_t numRows = ni * nj * nk;
+  typename stencil_t::values_type coefs("coefs", constant ? 1 : numRows,
+                                        offsets.extent(0));
+  Kokkos::fill_random(coefs, rand_pool, scalar_t(1));
+  stencil_t S("S", ni, nj, nk, offsets, coefs);
+  EXPECT_EQ(S.numRows(), numRows);
+  EXPECT_EQ(S.isConstantCoefficient(), constant && numRows != 1);
+  crsMat_t A = stencil_to_crs<crsMat_t>(S);
+
+  const mag_t eps = 1e3 * Kokkos::ArithTraits<mag_t>::eps();
+
+  for (const char* mode : {"N", "C", "T", "H"}) {
+    for (scalar_t beta : {scalar_t(0), scalar_t(1.5)}) {
+      const scalar_t alpha = 2.5;
+      vec_t x("x", numRows), y("y", numRows), y_ref("y_ref", numRows);
+      Kokkos::fill_random(x, rand_pool, scalar_t(1));
+      Kokkos::fill_random(y, rand_pool, scalar_t(1));
+      Kokkos::deep_copy(y_ref, y);
+      KokkosSparse::spmv(mode, alpha, A, x, beta, y_ref);
+      KokkosSparse::spmv(mode, alpha, S, x, beta, y);
+      EXPECT_NEAR_KK_REL_1DVIEW(y, y_ref, eps);
+
+      mv_t X("X", numRows, 2), Y("Y", numRows, 2), Y_ref("Y_ref", numRows, 2);
+      Kokkos::fill_random(X, rand_pool, scalar_t(1));
+      Kokkos::fill_random(Y, rand_pool, scalar_t(1));
+      Kokkos::deep_copy(Y_ref, Y);
+      KokkosSparse::spmv(mode, alpha, A, X, beta, Y_ref);
+      KokkosSparse::spmv(mode, alpha, S, X, beta, Y);
+      for (int j = 0; j < 2; j++) {
+        auto Yj     = Kokkos::subview(Y, Kokkos::ALL(), j);
+        auto Y_refj = Kokkos::subview(Y_ref, Kokkos::ALL(), j);
+        EXPECT_NEAR_KK_REL_1DVIEW(Yj, Y_refj, eps);
+      }
+    }
+  }
+}
+
+}  // namespace Test
+
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void test_spmv_stencil() {
+  using offsets_t = Kokkos::View<int**, Kokkos::LayoutRight, device>;
+  for (bool constant : {false, true}) {
+    for (int points : {7, 19, 27}) {
+      auto offs = KokkosSparse::Experimental::stencil_offsets<device>(points);
+      Test::run_test_spmv_stencil<scalar_t, lno_t, size_type, device>(
+          9, 7, 5, offs, constant);
+      // Grid thinner than the stencil in one direction
+      Test::run_test_spmv_stencil<scalar_t, lno_t, size_type, device>(
+          37, 1, 3, offs, constant);
+    }
+    for (int points : {3, 5, 9}) {
+      auto offs = KokkosSparse::Experimental::stencil_offsets<device>(points);
+      Test::run_test_spmv_stencil<scalar_t, lno_t, size_type, device>(
+          41, points == 3 ? 1 : 13, 1, offs, constant);
+    }
+    // Anisotropic user-defined stencil, reaching further in some directions
+    const int custom[4][3] = {{0, 0, 0}, {2, 0, 0}, {-1, 1, 0}, {0, 0, -3}};
+    offsets_t offs("offsets", 4, 3);
+    auto offs_h = Kokkos::create_mirror_view(offs);
+    for (int p = 0; p < 4; p++)
+      for (int d = 0; d < 3; d++) offs_h(p, d) = custom[p][d];
+    Kokkos::deep_copy(offs, offs_h);
+    Test::run_test_spmv_stencil<scalar_t, lno_t, size_type, device>(
+        11, 6, 8, offs, constant);
+    Test::run_test_spmv_stencil<scalar_t, lno_t, size_type, device>(
+        1, 1, 1, offs, constant);
+  }
+}
+
+#define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)          \
+  TEST_F(TestCategory,                                                       \
+         sparse##_##spmv_stencil##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    test_spmv_stencil<SCALAR, ORDINAL, OFFSET, DEVICE>();                    \
+  }
+
+#include <Test_Common_Test_All_Type_Combos.hpp>
+
+#undef KOKKOSKERNELS_EXECUTE_TEST
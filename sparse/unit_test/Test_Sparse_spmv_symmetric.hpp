@@ -0,0 +1,177 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+
+#include "KokkosSparse_spmv_symmetric.hpp"
+#include "KokkosSparse_IOUtils.hpp"
+#include "KokkosKernels_TestUtils.hpp"
+
+namespace Test {
+
+// Keep the lower (or upper) triangle of A, including the diagonal.
+template <typename crsMat_t>
+crsMat_t get_triangle_with_diagonal(const crsMat_t& A, bool lower) {
+  using lno_t       = typename crsMat_t::non_const_ordinal_type;
+  using size_type   = typename crsMat_t::non_const_size_type;
+  using rowmap_t    = typename crsMat_t::row_map_type::non_const_type;
+  using entries_t   = typename crsMat_t::index_type::non_const_type;
+  using values_t    = typename crsMat_t::values_type::non_const_type;
+  auto rowmap_h     = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                          A.graph.row_map);
+  auto entries_h    = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                          A.graph.entries);
+  auto values_h     = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                          A.values);
+  const lno_t nrows = A.numRows();
+  rowmap_t T_rowmap("T rowmap", nrows + 1);
+  auto T_rowmap_h = Kokkos::create_mirror_view(T_rowmap);
+  size_type nnz   = 0;
+  for (lno_t i = 0; i < nrows; i++) {
+    T_rowmap_h(i) = nnz;
+    for (size_type k = rowmap_h(i); k < rowmap_h(i + 1); k++) {
+      if (lower ? entries_h(k) <= i : entries_h(k) >= i) nnz++;
+    }
+  }
+  T_rowmap_h(nrows) = nnz;
+  entries_t T_entries("T entries", nnz);
+  values_t T_values("T values", nnz);
+  auto T_entries_h = Kokkos::create_mirror_view(T_entries);
+  auto T_values_h  = Kokkos::create_mirror_view(T_values);
+  nnz              = 0;
+  for (lno_t i = 0; i < nrows; i++) {
+    for (size_type k = rowmap_h(i); k < rowmap_h(i + 1); k++) {
+      if (lower ? entries_h(k) <= i : entries_h(k) >= i) {
+        T_entries_h(nnz) = entries_h(k);
+        T_values_h(nnz)  = values_h(k);
+        nnz++;
+      }
+    }
+  }
+  Kokkos::deep_copy(T_rowmap, T_rowmap_h);
+  Kokkos::deep_copy(T_entries, T_entries_h);
+  Kokkos::deep_copy(T_values, T_values_h);
+  return crsMat_t("T", nrows, nrows, nnz, T_values, T_rowmap, T_entries);
+}
+
+// Compare spmv_symmetric with a sequential reference which applies each
+// stored off-diagonal entry twice.
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void run_test_spmv_symmetric(lno_t numRows, size_type nnz,
+                             lno_t row_size_variance, bool lower,
+                             bool hermitian) {
+  using crsMat_t =
+      KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using vec_t      = Kokkos::View<scalar_t*, device>;
+  using mv_t       = Kokkos::View<scalar_t**, Kokkos::LayoutLeft, device>;
+  using mag_t      = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+  using KAT        = Kokkos::ArithTraits<scalar_t>;
+  using exec_space = typename device::execution_space;
+  using handle_t =
+      KokkosSparse::Experimental::SPMVSymmetricHandle<exec_space, crsMat_t>;
+
+  crsMat_t B = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      numRows, numRows, nnz, row_size_variance, numRows / 2);
+  crsMat_t A = get_triangle_with_diagonal(B, lower);
+
+  const mag_t eps = 1e3 * KAT::eps();
+  Kokkos::Random_XorShift64_Pool<exec_space> rand_pool(4321);
+  const int numVecs = 3;
+  mv_t X("X", numRows, numVecs), Y("Y", numRows, numVecs);
+  Kokkos::fill_random(X, rand_pool, scalar_t(1));
+
+  auto rowmap_h  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                      A.graph.row_map);
+  auto entries_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                       A.graph.entries);
+  auto values_h =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.values);
+  auto X_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), X);
+
+  handle_t handle(hermitian);
+  // The data is non-negative, so a positive beta avoids cancellation
+  for (scalar_t beta : {scalar_t(0), scalar_t(1.5)}) {
+    const scalar_t alpha = 2.5;
+    Kokkos::fill_random(Y, rand_pool, scalar_t(1));
+    auto Y_ref = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), Y);
+    for (int v = 0; v < numVecs; v++) {
+      std::vector<scalar_t> Sx(numRows, KAT::zero());
+      for (lno_t i = 0; i < numRows; i++) {
+        for (size_type k = rowmap_h(i); k < rowmap_h(i + 1); k++) {
+          const lno_t j = entries_h(k);
+          Sx[i] += values_h(k) * X_h(j, v);
+          if (j != i)
+            Sx[j] += (hermitian ? KAT::conj(values_h(k)) : values_h(k)) *
+                     X_h(i, v);
+        }
+      }
+      for (lno_t i = 0; i < numRows; i++) {
+        Y_ref(i, v) = (beta == KAT::zero() ? KAT::zero() : beta * Y_ref(i, v)) +
+                      alpha * Sx[i];
+      }
+    }
+
+    vec_t y("y", numRows);
+    Kokkos::deep_copy(y, Kokkos::subview(Y, Kokkos::ALL(), 0));
+    KokkosSparse::Experimental::spmv_symmetric(
+        exec_space(), &handle, alpha, A, Kokkos::subview(X, Kokkos::ALL(), 0),
+        beta, y);
+    EXPECT_NEAR_KK_REL_1DVIEW(y, Kokkos::subview(Y_ref, Kokkos::ALL(), 0),
+                              eps);
+
+    KokkosSparse::Experimental::spmv_symmetric(exec_space(), &handle, alpha, A,
+                                               X, beta, Y);
+    auto Y_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), Y);
+    for (int v = 0; v < numVecs; v++) {
+      EXPECT_NEAR_KK_REL_1DVIEW(Kokkos::subview(Y_h, Kokkos::ALL(), v),
+                                Kokkos::subview(Y_ref, Kokkos::ALL(), v), eps);
+    }
+  }
+  if (A.nnz() > 0) {
+    EXPECT_TRUE(handle.is_setup());
+  }
+}
+
+}  // namespace Test
+
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void test_spmv_symmetric() {
+  for (bool lower : {true, false}) {
+    for (bool hermitian : {false, true}) {
+      Test::run_test_spmv_symmetric<scalar_t, lno_t, size_type, device>(
+          1, 1, 0, lower, hermitian);
+      Test::run_test_spmv_symmetric<scalar_t, lno_t, size_type, device>(
+          1000, 8000, 20, lower, hermitian);
+      Test::run_test_spmv_symmetric<scalar_t, lno_t, size_type, device>(
+          511, 5000, 40, lower, hermitian);
+    }
+  }
+}
+
+#define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)        \
+  TEST_F(                                                                  \
+      TestCategory,                                                        \
+      sparse##_##spmv_symmetric##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    test_spmv_symmetric<SCALAR, ORDINAL, OFFSET, DEVICE>();                \
+  }
+
+#include <Test_Common_Test_All_Type_Combos.hpp>
+
+#undef KOKKOSKERNELS_EXECUTE_TEST
@@ -0,0 +1,144 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+
+#include "KokkosSparse_spmv.hpp"
+#include "KokkosSparse_spmv_team.hpp"
+#include "KokkosSparse_IOUtils.hpp"
+#include "KokkosKernels_TestUtils.hpp"
+
+namespace Test {
+
+// Each team applies y := beta*y + alpha*A*x to its own column of X and Y
+// num_applies times with team_spmv_scratch or team_vector_spmv_scratch,
+// staging A into scratch once first if stage_matrix is true. Compare with
+// the same sequence of KokkosSparse::spmv calls.
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void run_test_spmv_team_scratch(lno_t n, bool vector, bool stage_matrix) {
+  using crsMat_t =
+      KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using exec_space    = typename device::execution_space;
+  using policy_t      = Kokkos::TeamPolicy<exec_space>;
+  using member_t      = typename policy_t::member_type;
+  using scratch_space = typename exec_space::scratch_memory_space;
+  using unmanaged     = Kokkos::MemoryTraits<Kokkos::Unmanaged>;
+  using scratch_vals  = Kokkos::View<scalar_t*, scratch_space, unmanaged>;
+  using scratch_ints  = Kokkos::View<lno_t*, scratch_space, unmanaged>;
+  using ints_t        = Kokkos::View<lno_t*, device>;
+  using mv_t          = Kokkos::View<scalar_t**, Kokkos::LayoutLeft, device>;
+  using mag_t         = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+
+  const int num_teams   = 4;
+  const int num_applies = 3;
+
+  size_type nnz_gen = 10 * n;
+  crsMat_t A        = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      n, n, nnz_gen, 4, n);
+  Kokkos::Random_XorShift64_Pool<exec_space> rand_pool(1357);
+  Kokkos::fill_random(A.values, rand_pool, scalar_t(1));
+  const lno_t nnz = A.nnz();
+
+  // team_spmv takes the row offsets and column indices as the same view type
+  ints_t row_ptr("row_ptr", n + 1), colIndices("colIndices", nnz);
+  Kokkos::deep_copy(colIndices, A.graph.entries);
+  auto row_map = A.graph.row_map;
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<exec_space>(0, n + 1),
+      KOKKOS_LAMBDA(const lno_t i) { row_ptr(i) = row_map(i); });
+  auto values = A.values;
+
+  mv_t X("X", n, num_teams), Y("Y", n, num_teams), Y_ref("Y_ref", n, num_teams);
+  Kokkos::fill_random(X, rand_pool, scalar_t(1));
+  Kokkos::fill_random(Y, rand_pool, scalar_t(1));
+  Kokkos::deep_copy(Y_ref, Y);
+
+  const scalar_t alpha = 0.5;
+  const scalar_t beta  = 1.5;
+  policy_t policy(num_teams, Kokkos::AUTO);
+  policy.set_scratch_size(
+      0, Kokkos::PerTeam(
+             KokkosSparse::Experimental::team_spmv_scratch_size<
+                 exec_space, scalar_t, lno_t>(n, nnz, stage_matrix)));
+  Kokkos::parallel_for(
+      policy, KOKKOS_LAMBDA(const member_t& team) {
+        const int t = team.league_rank();
+        auto x      = Kokkos::subview(X, Kokkos::ALL(), t);
+        auto y      = Kokkos::subview(Y, Kokkos::ALL(), t);
+        scratch_vals x_scratch(team.team_scratch(0), n);
+        auto apply = [&](const auto& vals, const auto& rows,
+                         const auto& cols) {
+          for (int k = 0; k < num_applies; k++) {
+            if (vector)
+              KokkosSparse::Experimental::team_vector_spmv_scratch(
+                  team, alpha, vals, rows, cols, x, beta, y, 1, x_scratch);
+            else
+              KokkosSparse::Experimental::team_spmv_scratch(
+                  team, alpha, vals, rows, cols, x, beta, y, 1, x_scratch);
+          }
+        };
+        if (stage_matrix) {
+          scratch_vals values_scratch(team.team_scratch(0), nnz);
+          scratch_ints row_ptr_scratch(team.team_scratch(0), n + 1);
+          scratch_ints colIndices_scratch(team.team_scratch(0), nnz);
+          KokkosSparse::Experimental::team_stage_crs(
+              team, values, row_ptr, colIndices, values_scratch,
+              row_ptr_scratch, colIndices_scratch);
+          apply(values_scratch, row_ptr_scratch, colIndices_scratch);
+        } else {
+          apply(values, row_ptr, colIndices);
+        }
+      });
+
+  for (int t = 0; t < num_teams; t++) {
+    auto x = Kokkos::subview(X, Kokkos::ALL(), t);
+    auto y = Kokkos::subview(Y_ref, Kokkos::ALL(), t);
+    for (int k = 0; k < num_applies; k++)
+      KokkosSparse::spmv("N", alpha, A, x, beta, y);
+  }
+  const mag_t eps = 1e3 * Kokkos::ArithTraits<mag_t>::eps();
+  for (int t = 0; t < num_teams; t++) {
+    auto y     = Kokkos::subview(Y, Kokkos::ALL(), t);
+    auto y_ref = Kokkos::subview(Y_ref, Kokkos::ALL(), t);
+    EXPECT_NEAR_KK_REL_1DVIEW(y, y_ref, eps);
+  }
+}
+
+}  // namespace Test
+
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void test_spmv_team_scratch() {
+  for (bool vector : {false, true}) {
+    for (bool stage_matrix : {false, true}) {
+      Test::run_test_spmv_team_scratch<scalar_t, lno_t, size_type, device>(
+          100, vector, stage_matrix);
+    }
+  }
+}
+
+#define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)        \
+  TEST_F(TestCategory, sparse##_##spmv_team_scratch##_##SCALAR##_##ORDINAL## \
+                           _##OFFSET##_##DEVICE) {                         \
+    test_spmv_team_scratch<SCALAR, ORDINAL, OFFSET, DEVICE>();             \
+  }
+
+#include <Test_Common_Test_All_Type_Combos.hpp>
+
+#undef KOKKOSKERNELS_EXECUTE_TEST
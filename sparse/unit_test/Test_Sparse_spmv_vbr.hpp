@@ -0,0 +1,166 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+
+#include "KokkosSparse_crs2vbr.hpp"
+#include "KokkosSparse_spmv.hpp"
+#include "KokkosSparse_IOUtils.hpp"
+#include "KokkosKernels_TestUtils.hpp"
+
+namespace Test {
+
+// Build the point CrsMatrix of a random graph of numNodes nodes, where node
+// i has block_sizes[i] unknowns and each pair of connected nodes is a dense
+// block. With partial, the first entry of each block is left out, so
+// that crs2vbr has to pad blocks with zeros.
+template <typename crsMat_t, typename lno_t>
+crsMat_t make_vbr_test_matrix(lno_t numNodes,
+                              const std::vector<lno_t>& block_sizes,
+                              bool partial) {
+  using size_type = typename crsMat_t::non_const_size_type;
+  using rowmap_t  = typename crsMat_t::row_map_type::non_const_type;
+  using entries_t = typename crsMat_t::index_type::non_const_type;
+  using values_t  = typename crsMat_t::values_type::non_const_type;
+
+  crsMat_t G = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      numNodes, numNodes, numNodes * 4, 2, numNodes);
+  auto G_rowmap = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                      G.graph.row_map);
+  auto G_entries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                       G.graph.entries);
+  std::vector<lno_t> first(numNodes + 1, 0);
+  for (lno_t i = 0; i < numNodes; i++) first[i + 1] = first[i] + block_sizes[i];
+
+  std::vector<size_type> rowmap(first[numNodes] + 1, 0);
+  std::vector<lno_t> entries;
+  for (lno_t i = 0; i < numNodes; i++) {
+    for (lno_t r = first[i]; r < first[i + 1]; r++) {
+      for (size_type k = G_rowmap(i); k < G_rowmap(i + 1); k++) {
+        const lno_t j = G_entries(k);
+        for (lno_t c = first[j]; c < first[j + 1]; c++) {
+          if (partial && r == first[i] && c == first[j]) continue;
+          entries.push_back(c);
+        }
+      }
+      rowmap[r + 1] = entries.size();
+    }
+  }
+  rowmap_t rowmap_d("rowmap", rowmap.size());
+  entries_t entries_d("entries", entries.size());
+  values_t values_d("values", entries.size());
+  auto rowmap_h  = Kokkos::create_mirror_view(rowmap_d);
+  auto entries_h = Kokkos::create_mirror_view(entries_d);
+  for (size_t r = 0; r < rowmap.size(); r++) rowmap_h(r) = rowmap[r];
+  for (size_t k = 0; k < entries.size(); k++) entries_h(k) = entries[k];
+  Kokkos::deep_copy(rowmap_d, rowmap_h);
+  Kokkos::deep_copy(entries_d, entries_h);
+  return crsMat_t("A", first[numNodes], first[numNodes], entries.size(),
+                  values_d, rowmap_d, entries_d);
+}
+
+// Compare SpMV with a VbrMatrix against SpMV with the CrsMatrix it was
+// converted from, for all modes and for single vectors and multivectors.
+// Also check that vbr2crs gives back the same operator.
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void run_test_spmv_vbr(lno_t numNodes, bool partial) {
+  using crsMat_t =
+      KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using vec_t      = Kokkos::View<scalar_t*, device>;
+  using mv_t       = Kokkos::View<scalar_t**, Kokkos::LayoutLeft, device>;
+  using mag_t      = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+  using exec_space = typename device::execution_space;
+
+  // Mixed elements with 3, 4 and 7 unknowns per node
+  const lno_t node_sizes[3] = {3, 4, 7};
+  std::vector<lno_t> block_sizes(numNodes);
+  for (lno_t i = 0; i < numNodes; i++) block_sizes[i] = node_sizes[i % 3];
+  crsMat_t A = make_vbr_test_matrix<crsMat_t>(numNodes, block_sizes, partial);
+  Kokkos::Random_XorShift64_Pool<exec_space> rand_pool(3456);
+  Kokkos::fill_random(A.values, rand_pool, scalar_t(1));
+
+  auto V = KokkosSparse::Experimental::crs2vbr(A, block_sizes);
+  EXPECT_EQ(V.numRows(), A.numRows());
+  EXPECT_EQ(V.numCols(), A.numCols());
+  EXPECT_EQ(V.numBlockRows(), numNodes);
+  EXPECT_EQ(V.numBlockCols(), numNodes);
+  if (partial)
+    EXPECT_EQ(V.nnz(), A.nnz() + V.numBlocks());
+  else
+    EXPECT_EQ(V.nnz(), A.nnz());
+
+  auto B = KokkosSparse::Experimental::vbr2crs(V);
+  EXPECT_EQ(B.nnz(), V.nnz());
+
+  const mag_t eps = 1e3 * Kokkos::ArithTraits<mag_t>::eps();
+  const lno_t n   = A.numRows();
+  for (const char* mode : {"N", "C", "T", "H"}) {
+    for (scalar_t beta : {scalar_t(0), scalar_t(1.5)}) {
+      const scalar_t alpha = 2.5;
+      vec_t x("x", n), y("y", n), y_ref("y_ref", n), y_crs("y_crs", n);
+      Kokkos::fill_random(x, rand_pool, scalar_t(1));
+      Kokkos::fill_random(y, rand_pool, scalar_t(1));
+      Kokkos::deep_copy(y_ref, y);
+      Kokkos::deep_copy(y_crs, y);
+      KokkosSparse::spmv(mode, alpha, A, x, beta, y_ref);
+      KokkosSparse::spmv(mode, alpha, V, x, beta, y);
+      KokkosSparse::spmv(mode, alpha, B, x, beta, y_crs);
+      EXPECT_NEAR_KK_REL_1DVIEW(y, y_ref, eps);
+      EXPECT_NEAR_KK_REL_1DVIEW(y_crs, y_ref, eps);
+
+      mv_t X("X", n, 3), Y("Y", n, 3), Y_ref("Y_ref", n, 3);
+      Kokkos::fill_random(X, rand_pool, scalar_t(1));
+      Kokkos::fill_random(Y, rand_pool, scalar_t(1));
+      Kokkos::deep_copy(Y_ref, Y);
+      KokkosSparse::spmv(mode, alpha, A, X, beta, Y_ref);
+      KokkosSparse::spmv(mode, alpha, V, X, beta, Y);
+      for (int j = 0; j < 3; j++) {
+        auto Yj     = Kokkos::subview(Y, Kokkos::ALL(), j);
+        auto Y_refj = Kokkos::subview(Y_ref, Kokkos::ALL(), j);
+        EXPECT_NEAR_KK_REL_1DVIEW(Yj, Y_refj, eps);
+      }
+    }
+  }
+
+  // The block sizes must cover A exactly
+  std::vector<lno_t> bad_sizes(block_sizes);
+  bad_sizes.back()++;
+  EXPECT_THROW(KokkosSparse::Experimental::crs2vbr(A, bad_sizes),
+               std::invalid_argument);
+}
+
+}  // namespace Test
+
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void test_spmv_vbr() {
+  Test::run_test_spmv_vbr<scalar_t, lno_t, size_type, device>(1, false);
+  Test::run_test_spmv_vbr<scalar_t, lno_t, size_type, device>(300, false);
+  Test::run_test_spmv_vbr<scalar_t, lno_t, size_type, device>(300, true);
+}
+
+#define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)          \
+  TEST_F(TestCategory,                                                       \
+         sparse##_##spmv_vbr##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    test_spmv_vbr<SCALAR, ORDINAL, OFFSET, DEVICE>();                        \
+  }
+
+#include <Test_Common_Test_All_Type_Combos.hpp>
+
+#undef KOKKOSKERNELS_EXECUTE_TEST
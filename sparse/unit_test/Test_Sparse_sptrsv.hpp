@@ -17,6 +17,7 @@
 #include <gtest/gtest.h>
 #include <Kokkos_Core.hpp>
 
+#include <sstream>
 #include <string>
 #include <stdexcept>
 
@@ -232,6 +233,36 @@ struct SptrsvTest {
         kh.destroy_sptrsv_handle();
       }
 
+      {
+        Kokkos::deep_copy(lhs, ZERO);
+        KernelHandle kh;
+        bool is_lower_tri = false;
+        kh.create_sptrsv_handle(SPTRSVAlgorithm::SYNCFREE, nrows, is_lower_tri);
+
+        sptrsv_symbolic(&kh, row_map, entries);
+        Kokkos::fence();
+
+        sptrsv_solve(&kh, row_map, entries, values, rhs, lhs);
+        Kokkos::fence();
+
+        scalar_t sum = 0.0;
+        Kokkos::parallel_reduce(range_policy_t(0, lhs.extent(0)),
+                                ReductionCheck(lhs), sum);
+        EXPECT_EQ(sum, lhs.extent(0));
+
+        // Solve again with the same flags
+        Kokkos::deep_copy(lhs, ZERO);
+        sptrsv_solve(&kh, row_map, entries, values, rhs, lhs);
+        Kokkos::fence();
+
+        sum = 0.0;
+        Kokkos::parallel_reduce(range_policy_t(0, lhs.extent(0)),
+                                ReductionCheck(lhs), sum);
+        EXPECT_EQ(sum, lhs.extent(0));
+
+        kh.destroy_sptrsv_handle();
+      }
+
 #ifdef KOKKOSKERNELS_ENABLE_TPL_CUSPARSE
       if (std::is_same<size_type, int>::value &&
           std::is_same<lno_t, int>::value &&
@@ -456,6 +487,36 @@ struct SptrsvTest {
         kh.destroy_sptrsv_handle();
       }
 
+      {
+        Kokkos::deep_copy(lhs, ZERO);
+        KernelHandle kh;
+        bool is_lower_tri = true;
+        kh.create_sptrsv_handle(SPTRSVAlgorithm::SYNCFREE, nrows, is_lower_tri);
+
+        sptrsv_symbolic(&kh, row_map, entries);
+        Kokkos::fence();
+
+        sptrsv_solve(&kh, row_map, entries, values, rhs, lhs);
+        Kokkos::fence();
+
+        scalar_t sum = 0.0;
+        Kokkos::parallel_reduce(range_policy_t(0, lhs.extent(0)),
+                                ReductionCheck(lhs), sum);
+        EXPECT_EQ(sum, lhs.extent(0));
+
+        // Solve again with the same flags
+        Kokkos::deep_copy(lhs, ZERO);
+        sptrsv_solve(&kh, row_map, entries, values, rhs, lhs);
+        Kokkos::fence();
+
+        sum = 0.0;
+        Kokkos::parallel_reduce(range_policy_t(0, lhs.extent(0)),
+                                ReductionCheck(lhs), sum);
+        EXPECT_EQ(sum, lhs.extent(0));
+
+        kh.destroy_sptrsv_handle();
+      }
+
 #ifdef KOKKOSKERNELS_ENABLE_TPL_CUSPARSE
       if (std::is_same<size_type, int>::value &&
           std::is_same<lno_t, int>::value &&
@@ -629,6 +690,327 @@ struct SptrsvTest {
     }
   }
 
+  static void run_test_sptrsv_multi_rhs() {
+    using MultiVectorType = Kokkos::View<scalar_t **, device>;
+    using mag_t           = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+
+    const scalar_t ZERO   = scalar_t(0);
+    const scalar_t ONE    = scalar_t(1);
+    const size_type nrows = 5;
+    const int nrhs        = 3;
+    const mag_t eps       = 1e3 * Kokkos::ArithTraits<scalar_t>::epsilon();
+
+    for (bool is_lower_tri : {false, true}) {
+      RowMapType row_map;
+      EntriesType entries;
+      ValuesType values;
+
+      auto fixture = is_lower_tri ? get_5x5_lt_ones_fixture()
+                                  : get_5x5_ut_ones_fixture();
+      compress_matrix(row_map, entries, values, fixture);
+      Crs triMtx("triMtx", nrows, nrows, values.extent(0), values, row_map,
+                 entries);
+
+      // Known solution with a different column each, X(i, j) = i + j + 1
+      MultiVectorType known_lhs("known_lhs", nrows, nrhs);
+      auto h_known_lhs = Kokkos::create_mirror_view(known_lhs);
+      for (size_type i = 0; i < nrows; i++) {
+        for (int j = 0; j < nrhs; j++) {
+          h_known_lhs(i, j) = scalar_t(i + j + 1);
+        }
+      }
+      Kokkos::deep_copy(known_lhs, h_known_lhs);
+
+      MultiVectorType rhs("rhs", nrows, nrhs);
+      MultiVectorType lhs("lhs", nrows, nrhs);
+      KokkosSparse::spmv("N", ONE, triMtx, known_lhs, ZERO, rhs);
+
+      for (auto algo :
+           {SPTRSVAlgorithm::SEQLVLSCHD_RP, SPTRSVAlgorithm::SEQLVLSCHD_TP1,
+            SPTRSVAlgorithm::SYNCFREE}) {
+        KernelHandle kh;
+        kh.create_sptrsv_handle(algo, nrows, is_lower_tri);
+        sptrsv_symbolic(&kh, row_map, entries);
+
+        // Solve twice with the same handle
+        for (int rep = 0; rep < 2; rep++) {
+          Kokkos::deep_copy(lhs, ZERO);
+          sptrsv_solve(&kh, row_map, entries, values, rhs, lhs);
+          Kokkos::fence();
+
+          auto h_lhs = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                           lhs);
+          for (size_type i = 0; i < nrows; i++) {
+            for (int j = 0; j < nrhs; j++) {
+              EXPECT_NEAR_KK(h_lhs(i, j), h_known_lhs(i, j), eps);
+            }
+          }
+        }
+
+        kh.destroy_sptrsv_handle();
+      }
+    }
+  }
+
+  static void run_test_sptrsv_isai() {
+    using mag_t = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+
+    const scalar_t ZERO   = scalar_t(0);
+    const scalar_t ONE    = scalar_t(1);
+    const size_type nrows = 5;
+    const mag_t eps       = 1e3 * Kokkos::ArithTraits<scalar_t>::epsilon();
+
+    for (bool is_lower_tri : {false, true}) {
+      RowMapType row_map;
+      EntriesType entries;
+      ValuesType values;
+
+      auto fixture = is_lower_tri ? get_5x5_lt_ones_fixture()
+                                  : get_5x5_ut_ones_fixture();
+      // Make the diagonal not one so that M differs from the pattern of A
+      for (size_type i = 0; i < nrows; i++) fixture[i][i] = scalar_t(4);
+      compress_matrix(row_map, entries, values, fixture);
+
+      KernelHandle kh;
+      kh.create_sptrsv_handle(SPTRSVAlgorithm::SEQLVLSCHD_TP1, nrows,
+                              is_lower_tri);
+      auto sh = kh.get_sptrsv_handle();
+      sh->set_isai(true);
+      sptrsv_isai(&kh, row_map, entries, values);
+      EXPECT_TRUE(sh->is_isai_complete());
+
+      auto h_row_map = Kokkos::create_mirror_view_and_copy(
+          Kokkos::HostSpace(), sh->get_isai_row_map());
+      auto h_entries = Kokkos::create_mirror_view_and_copy(
+          Kokkos::HostSpace(), sh->get_isai_entries());
+      auto h_values = Kokkos::create_mirror_view_and_copy(
+          Kokkos::HostSpace(), sh->get_isai_values());
+
+      // (M A)(i, j) = delta_ij for all (i, j) in the pattern of A
+      for (size_type i = 0; i < nrows; i++) {
+        for (size_type j = 0; j < nrows; j++) {
+          if (fixture[i][j] == ZERO) continue;
+          scalar_t ma = ZERO;
+          for (auto k = h_row_map(i); k < h_row_map(i + 1); k++) {
+            ma += h_values(k) * fixture[h_entries(k)][j];
+          }
+          EXPECT_NEAR_KK(ma, i == j ? ONE : ZERO, eps);
+        }
+      }
+
+      // sptrsv_solve now applies M
+      ValuesType rhs("rhs", nrows);
+      ValuesType lhs("lhs", nrows);
+      Kokkos::deep_copy(rhs, ONE);
+      sptrsv_solve(&kh, row_map, entries, values, rhs, lhs);
+      auto h_lhs =
+          Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), lhs);
+      for (size_type i = 0; i < nrows; i++) {
+        scalar_t mb = ZERO;
+        for (auto k = h_row_map(i); k < h_row_map(i + 1); k++) {
+          mb += h_values(k);
+        }
+        EXPECT_NEAR_KK(h_lhs(i), mb, eps);
+      }
+
+      kh.destroy_sptrsv_handle();
+    }
+  }
+
+  static void run_test_sptrsv_jacobi() {
+    using mag_t = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+
+    const scalar_t ZERO   = scalar_t(0);
+    const scalar_t ONE    = scalar_t(1);
+    const size_type nrows = 5;
+    const mag_t eps       = 1e3 * Kokkos::ArithTraits<scalar_t>::epsilon();
+
+    for (bool is_lower_tri : {false, true}) {
+      RowMapType row_map;
+      EntriesType entries;
+      ValuesType values;
+
+      auto fixture = is_lower_tri ? get_5x5_lt_ones_fixture()
+                                  : get_5x5_ut_ones_fixture();
+      compress_matrix(row_map, entries, values, fixture);
+      Crs triMtx("triMtx", nrows, nrows, values.extent(0), values, row_map,
+                 entries);
+
+      ValuesType known_lhs("known_lhs", nrows);
+      ValuesType rhs("rhs", nrows);
+      ValuesType lhs("lhs", nrows);
+      Kokkos::deep_copy(known_lhs, ONE);
+      KokkosSparse::spmv("N", ONE, triMtx, known_lhs, ZERO, rhs);
+      auto h_rhs =
+          Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), rhs);
+
+      KernelHandle kh;
+      kh.create_sptrsv_handle(SPTRSVAlgorithm::SEQLVLSCHD_TP1, nrows,
+                              is_lower_tri);
+
+      // One sweep from zero is the diagonal scaling, which is b here
+      kh.get_sptrsv_handle()->set_jacobi_sweeps(1);
+      sptrsv_solve(&kh, row_map, entries, values, rhs, lhs);
+      auto h_lhs =
+          Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), lhs);
+      for (size_type i = 0; i < nrows; i++) {
+        EXPECT_NEAR_KK(h_lhs(i), h_rhs(i), eps);
+      }
+
+      // As many sweeps as rows are at least as many as levels: exact
+      for (int sweeps : {int(nrows), int(nrows) + 1}) {
+        Kokkos::deep_copy(lhs, ZERO);
+        kh.get_sptrsv_handle()->set_jacobi_sweeps(sweeps);
+        sptrsv_solve(&kh, row_map, entries, values, rhs, lhs);
+        Kokkos::deep_copy(h_lhs, lhs);
+        for (size_type i = 0; i < nrows; i++) {
+          EXPECT_NEAR_KK(h_lhs(i), ONE, eps);
+        }
+      }
+
+      kh.destroy_sptrsv_handle();
+    }
+  }
+
+  // A schedule saved after sptrsv_symbolic and loaded into a new handle
+  // must solve like the original handle
+  static void run_test_sptrsv_plan_io() {
+    using mag_t = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+
+    const scalar_t ZERO   = scalar_t(0);
+    const scalar_t ONE    = scalar_t(1);
+    const size_type nrows = 5;
+    const mag_t eps       = 1e3 * Kokkos::ArithTraits<scalar_t>::epsilon();
+
+    for (bool is_lower_tri : {false, true}) {
+      RowMapType row_map;
+      EntriesType entries;
+      ValuesType values;
+
+      auto fixture = is_lower_tri ? get_5x5_lt_ones_fixture()
+                                  : get_5x5_ut_ones_fixture();
+      compress_matrix(row_map, entries, values, fixture);
+      Crs triMtx("triMtx", nrows, nrows, values.extent(0), values, row_map,
+                 entries);
+
+      ValuesType known_lhs("known_lhs", nrows);
+      ValuesType rhs("rhs", nrows);
+      ValuesType lhs("lhs", nrows);
+      Kokkos::deep_copy(known_lhs, ONE);
+      KokkosSparse::spmv("N", ONE, triMtx, known_lhs, ZERO, rhs);
+
+      for (auto algo :
+           {SPTRSVAlgorithm::SEQLVLSCHD_RP, SPTRSVAlgorithm::SEQLVLSCHD_TP1,
+            SPTRSVAlgorithm::SEQLVLSCHD_TP1CHAIN, SPTRSVAlgorithm::SYNCFREE}) {
+        std::stringstream plan;
+        {
+          KernelHandle kh;
+          kh.create_sptrsv_handle(algo, nrows, is_lower_tri);
+          EXPECT_THROW(kh.get_sptrsv_handle()->save(plan), std::runtime_error);
+          sptrsv_symbolic(&kh, row_map, entries);
+          kh.get_sptrsv_handle()->save(plan);
+          kh.destroy_sptrsv_handle();
+        }
+
+        KernelHandle kh;
+        kh.create_sptrsv_handle(algo, nrows, is_lower_tri);
+        kh.get_sptrsv_handle()->load(plan);
+        EXPECT_TRUE(kh.get_sptrsv_handle()->is_symbolic_complete());
+        Kokkos::deep_copy(lhs, ZERO);
+        sptrsv_solve(&kh, row_map, entries, values, rhs, lhs);
+        auto h_lhs =
+            Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), lhs);
+        for (size_type i = 0; i < nrows; i++) {
+          EXPECT_NEAR_KK(h_lhs(i), ONE, eps);
+        }
+        kh.destroy_sptrsv_handle();
+
+        // The other triangle has another schedule
+        plan.seekg(0);
+        kh.create_sptrsv_handle(algo, nrows, !is_lower_tri);
+        EXPECT_THROW(kh.get_sptrsv_handle()->load(plan), std::runtime_error);
+        kh.destroy_sptrsv_handle();
+      }
+    }
+  }
+
+  static void run_test_sptrsv_bsr(const lno_t block_size) {
+    using mag_t = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+
+    const scalar_t ZERO    = scalar_t(0);
+    const scalar_t ONE     = scalar_t(1);
+    const lno_t nrows      = 5;
+    const lno_t bs         = block_size;
+    const lno_t bs2        = bs * bs;
+    const lno_t point_rows = nrows * bs;
+    const mag_t eps        = 1e3 * Kokkos::ArithTraits<scalar_t>::epsilon();
+
+    for (bool is_lower_tri : {false, true}) {
+      // Block graph of the fixture
+      RowMapType row_map;
+      EntriesType entries;
+      ValuesType point_values;
+      auto fixture = is_lower_tri ? get_5x5_lt_ones_fixture()
+                                  : get_5x5_ut_ones_fixture();
+      compress_matrix(row_map, entries, point_values, fixture);
+
+      // Diagonal blocks that need pivoting, small off-diagonal blocks
+      auto h_row_map = Kokkos::create_mirror_view_and_copy(
+          Kokkos::HostSpace(), row_map);
+      auto h_entries = Kokkos::create_mirror_view_and_copy(
+          Kokkos::HostSpace(), entries);
+      ValuesType values("values", entries.extent(0) * bs2);
+      auto h_values = Kokkos::create_mirror_view(values);
+      for (lno_t i = 0; i < nrows; i++) {
+        for (auto k = h_row_map(i); k < h_row_map(i + 1); k++) {
+          for (lno_t p = 0; p < bs; p++) {
+            for (lno_t q = 0; q < bs; q++) {
+              scalar_t &a = h_values(k * bs2 + p * bs + q);
+              if (h_entries(k) == i) {
+                a = q == (p + 1) % bs ? scalar_t(4) : scalar_t(0.25);
+              } else {
+                a = scalar_t(0.1 * (p + 1) - 0.05 * q);
+              }
+            }
+          }
+        }
+      }
+      Kokkos::deep_copy(values, h_values);
+      Bsr A("A", nrows, nrows, entries.extent(0), values, row_map, entries,
+            bs);
+
+      ValuesType known_lhs("known_lhs", point_rows);
+      auto h_known_lhs = Kokkos::create_mirror_view(known_lhs);
+      for (lno_t i = 0; i < point_rows; i++) {
+        h_known_lhs(i) = scalar_t(1 + i % 3);
+      }
+      Kokkos::deep_copy(known_lhs, h_known_lhs);
+      ValuesType rhs("rhs", point_rows);
+      ValuesType lhs("lhs", point_rows);
+      KokkosSparse::spmv("N", ONE, A, known_lhs, ZERO, rhs);
+
+      for (auto algo :
+           {SPTRSVAlgorithm::SEQLVLSCHD_RP, SPTRSVAlgorithm::SEQLVLSCHD_TP1}) {
+        KernelHandle kh;
+        kh.create_sptrsv_handle(algo, nrows, is_lower_tri);
+        sptrsv_symbolic(&kh, A);
+
+        // Solve twice with the same handle
+        for (int rep = 0; rep < 2; rep++) {
+          Kokkos::deep_copy(lhs, ZERO);
+          sptrsv_solve(&kh, A, rhs, lhs);
+          auto h_lhs = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                           lhs);
+          for (lno_t i = 0; i < point_rows; i++) {
+            EXPECT_NEAR_KK(h_lhs(i), h_known_lhs(i), eps);
+          }
+        }
+
+        kh.destroy_sptrsv_handle();
+      }
+    }
+  }
+
   static void run_test_sptrsv_streams(int test_algo, int nstreams) {
     // Workaround for OpenMP: skip tests if concurrency < nstreams because of
     // not enough resource to partition
@@ -817,6 +1199,12 @@ template <typename scalar_t, typename lno_t, typename size_type,
 void test_sptrsv() {
   using TestStruct = Test::SptrsvTest<scalar_t, lno_t, size_type, device>;
   TestStruct::run_test_sptrsv();
+  TestStruct::run_test_sptrsv_multi_rhs();
+  TestStruct::run_test_sptrsv_isai();
+  TestStruct::run_test_sptrsv_jacobi();
+  TestStruct::run_test_sptrsv_plan_io();
+  TestStruct::run_test_sptrsv_bsr(1);
+  TestStruct::run_test_sptrsv_bsr(3);
 }
 
 template <typename scalar_t, typename lno_t, typename size_type,
@@ -0,0 +1,296 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+
+#include <cstdlib>
+#include <map>
+#include <vector>
+
+#include "KokkosBlas1_scal.hpp"
+#include "KokkosSparse_supernodal_cholesky.hpp"
+#include "KokkosKernels_TestUtils.hpp"
+#if defined(KOKKOSKERNELS_ENABLE_SUPERNODAL_SPTRSV)
+#include <Kokkos_Random.hpp>
+#include "KokkosSparse_spmv.hpp"
+#include "KokkosSparse_sptrsv_supernodal_cholesky.hpp"
+#endif
+
+namespace Test {
+
+// Build a Hermitian positive definite CrsMatrix, with both triangles stored,
+// from the strictly lower entries given for each row. The diagonal is made
+// strictly dominant.
+template <typename crsMat_t, typename lno_t, typename scalar_t>
+crsMat_t make_spd_test_matrix(
+    lno_t n, const std::vector<std::map<lno_t, scalar_t>>& lower) {
+  using size_type = typename crsMat_t::non_const_size_type;
+  using rowmap_t  = typename crsMat_t::row_map_type::non_const_type;
+  using entries_t = typename crsMat_t::index_type::non_const_type;
+  using values_t  = typename crsMat_t::values_type::non_const_type;
+  using KAT       = Kokkos::ArithTraits<scalar_t>;
+
+  std::vector<std::map<lno_t, scalar_t>> rows(n);
+  for (lno_t i = 0; i < n; i++) {
+    for (const auto& e : lower[i]) {
+      rows[i][e.first] = e.second;
+      rows[e.first][i] = KAT::conj(e.second);
+    }
+  }
+  size_type nnz = 0;
+  for (lno_t i = 0; i < n; i++) {
+    typename KAT::mag_type rowsum = 1;
+    for (const auto& e : rows[i]) rowsum += KAT::abs(e.second);
+    rows[i][i] = scalar_t(rowsum);
+    nnz += rows[i].size();
+  }
+  rowmap_t rowmap("rowmap", n + 1);
+  entries_t entries("entries", nnz);
+  values_t values("values", nnz);
+  auto rowmap_h  = Kokkos::create_mirror_view(rowmap);
+  auto entries_h = Kokkos::create_mirror_view(entries);
+  auto values_h  = Kokkos::create_mirror_view(values);
+  size_type k    = 0;
+  rowmap_h(0)    = 0;
+  for (lno_t i = 0; i < n; i++) {
+    for (const auto& e : rows[i]) {
+      entries_h(k) = e.first;
+      values_h(k)  = e.second;
+      k++;
+    }
+    rowmap_h(i + 1) = k;
+  }
+  Kokkos::deep_copy(rowmap, rowmap_h);
+  Kokkos::deep_copy(entries, entries_h);
+  Kokkos::deep_copy(values, values_h);
+  return crsMat_t("A", n, n, nnz, values, rowmap, entries);
+}
+
+// Multiply out the supernodal factor F and compare L * L^H with A.
+template <typename crsMat_t, typename factor_t>
+void check_supernodal_cholesky(const crsMat_t& A, const factor_t& F) {
+  using scalar_t = typename crsMat_t::non_const_value_type;
+  using KAT      = Kokkos::ArithTraits<scalar_t>;
+  using mag_t    = typename KAT::mag_type;
+
+  const int n = F.n;
+  std::vector<scalar_t> L(size_t(n) * n, KAT::zero());
+  auto values = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                    F.values);
+  for (int s = 0; s < F.nsuper; s++) {
+    const int j1    = F.supercols(s);
+    const int nsrow = F.rowptr(s + 1) - F.rowptr(s);
+    for (int j = j1; j < F.supercols(s + 1); j++) {
+      for (int p = j - j1; p < nsrow; p++) {
+        const int i = F.rowind(F.rowptr(s) + p);
+        L[size_t(i) * n + j] = values(F.valptr(s) + p + (j - j1) * nsrow);
+      }
+    }
+  }
+  std::vector<scalar_t> Ad(size_t(n) * n, KAT::zero());
+  auto rowmap = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                    A.graph.row_map);
+  auto entries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                     A.graph.entries);
+  auto Avals =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.values);
+  mag_t maxdiag = 0;
+  for (int i = 0; i < n; i++) {
+    for (auto k = rowmap(i); k < rowmap(i + 1); k++) {
+      Ad[size_t(i) * n + entries(k)] = Avals(k);
+      if (int(entries(k)) == i) maxdiag = std::max(maxdiag, KAT::abs(Avals(k)));
+    }
+  }
+  const mag_t tol = 1e3 * Kokkos::ArithTraits<mag_t>::eps() * maxdiag;
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j <= i; j++) {
+      scalar_t sum = KAT::zero();
+      for (int k = 0; k <= j; k++)
+        sum += L[size_t(i) * n + k] * KAT::conj(L[size_t(j) * n + k]);
+      EXPECT_NEAR_KK(sum, Ad[size_t(i) * n + j], tol);
+    }
+  }
+}
+
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void run_test_supernodal_cholesky(
+    lno_t n, const std::vector<std::map<lno_t, scalar_t>>& lower) {
+  using crsMat_t =
+      KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using factor_t =
+      KokkosSparse::Experimental::SupernodalCholeskyFactor<scalar_t, device>;
+
+  crsMat_t A = make_spd_test_matrix<crsMat_t>(n, lower);
+  factor_t F;
+  KokkosSparse::Experimental::supernodal_cholesky_symbolic(A, F);
+  EXPECT_TRUE(F.symbolic_complete);
+  EXPECT_EQ(F.n, int(n));
+  EXPECT_EQ(F.supercols(F.nsuper), int(n));
+  KokkosSparse::Experimental::supernodal_cholesky_numeric(A, F);
+  EXPECT_TRUE(F.numeric_complete);
+  check_supernodal_cholesky(A, F);
+
+  // Refactor new values with the same pattern
+  crsMat_t A2("A2", A);
+  KokkosBlas::scal(A2.values, scalar_t(2), A.values);
+  KokkosSparse::Experimental::supernodal_cholesky_numeric(A2, F);
+  EXPECT_TRUE(F.numeric_complete);
+  check_supernodal_cholesky(A2, F);
+
+  // A negative definite matrix has to be rejected
+  KokkosBlas::scal(A2.values, scalar_t(-1), A.values);
+  EXPECT_THROW(KokkosSparse::Experimental::supernodal_cholesky_numeric(A2, F),
+               std::runtime_error);
+  EXPECT_FALSE(F.numeric_complete);
+}
+
+#if defined(KOKKOSKERNELS_ENABLE_SUPERNODAL_SPTRSV)
+// Solve with the factor through the supernodal sptrsv. The supernodes with
+// at least three columns are solved with device-level kernels and the
+// others with the batched team-level kernels, so that most levels mix both.
+// The multivector solve does every supernode with the batched kernels.
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void run_test_supernodal_cholesky_sptrsv(
+    lno_t n, const std::vector<std::map<lno_t, scalar_t>>& lower,
+    KokkosSparse::Experimental::SPTRSVAlgorithm algo, bool u_in_csr) {
+  using crsMat_t =
+      KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using factor_t =
+      KokkosSparse::Experimental::SupernodalCholeskyFactor<scalar_t, device>;
+  using execution_space = typename device::execution_space;
+  using memory_space    = typename device::memory_space;
+  using KernelHandle    = KokkosKernels::Experimental::KokkosKernelsHandle<
+      size_type, lno_t, scalar_t, execution_space, memory_space, memory_space>;
+  using vec_t = Kokkos::View<scalar_t*, device>;
+  using mag_t = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+
+  crsMat_t A = make_spd_test_matrix<crsMat_t>(n, lower);
+  factor_t F;
+  KokkosSparse::Experimental::supernodal_cholesky_symbolic(A, F);
+  KokkosSparse::Experimental::supernodal_cholesky_numeric(A, F);
+
+  KernelHandle khL, khU;
+  khL.create_sptrsv_handle(algo, n, true);
+  khU.create_sptrsv_handle(algo, n, false);
+  khU.set_sptrsv_column_major(!u_in_csr);
+  khL.set_sptrsv_diag_supernode_sizes(3, 3);
+  khU.set_sptrsv_diag_supernode_sizes(3, 3);
+  KokkosSparse::Experimental::sptrsv_symbolic(&khL, &khU, F);
+  KokkosSparse::Experimental::sptrsv_compute(&khL, &khU, F);
+
+  vec_t x_ref("x_ref", n), x("x", n), b("b", n);
+  Kokkos::Random_XorShift64_Pool<execution_space> rand_pool(13718);
+  Kokkos::fill_random(x_ref, rand_pool, scalar_t(1));
+  KokkosSparse::spmv("N", scalar_t(1), A, x_ref, scalar_t(0), b);
+  KokkosSparse::Experimental::sptrsv_solve(&khL, &khU, x, b);
+  Kokkos::fence();
+
+  const mag_t eps = 1e3 * Kokkos::ArithTraits<mag_t>::eps();
+  EXPECT_NEAR_KK_REL_1DVIEW(x, x_ref, eps);
+
+  // All the columns of a multivector at once
+  using mv_t     = Kokkos::View<scalar_t**, Kokkos::LayoutLeft, device>;
+  const int nrhs = 3;
+  mv_t X_ref("X_ref", n, nrhs), X("X", n, nrhs), B("B", n, nrhs);
+  Kokkos::fill_random(X_ref, rand_pool, scalar_t(1));
+  KokkosSparse::spmv("N", scalar_t(1), A, X_ref, scalar_t(0), B);
+  // whose work views come from an arena shared by both solves
+  typename KernelHandle::SPTRSVHandleType::arena_t arena;
+  khL.get_sptrsv_handle()->set_arena(&arena);
+  khU.get_sptrsv_handle()->set_arena(&arena);
+  KokkosSparse::Experimental::sptrsv_solve(&khL, &khU, X, B);
+  Kokkos::fence();
+  EXPECT_GT(arena.high_water_mark(), size_t(0));
+  EXPECT_EQ(arena.bytes_in_use(), size_t(0));
+  for (int j = 0; j < nrhs; j++) {
+    auto xj     = Kokkos::subview(X, Kokkos::ALL(), j);
+    auto xj_ref = Kokkos::subview(X_ref, Kokkos::ALL(), j);
+    EXPECT_NEAR_KK_REL_1DVIEW(xj, xj_ref, eps);
+  }
+
+  khL.destroy_sptrsv_handle();
+  khU.destroy_sptrsv_handle();
+}
+#endif
+
+}  // namespace Test
+
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void test_supernodal_cholesky() {
+  using lower_t = std::vector<std::map<lno_t, scalar_t>>;
+
+  // 2D Laplacian on a 12 x 12 grid, with a natural ordering
+  const lno_t nx = 12;
+  lower_t lap(nx * nx);
+  for (lno_t y = 0; y < nx; y++) {
+    for (lno_t x = 0; x < nx; x++) {
+      const lno_t i = y * nx + x;
+      if (x > 0) lap[i][i - 1] = scalar_t(-1);
+      if (y > 0) lap[i][i - nx] = scalar_t(-1);
+    }
+  }
+  Test::run_test_supernodal_cholesky<scalar_t, lno_t, size_type, device>(
+      nx * nx, lap);
+
+  // Random pattern with a dense trailing block, so that there are both small
+  // and large supernodes
+  const lno_t n = 200;
+  lower_t rnd(n);
+  std::srand(4321);
+  for (lno_t i = 1; i < n; i++) {
+    const int count = (i >= n - 20) ? int(i) : 3;
+    for (int c = 0; c < count; c++) {
+      const lno_t j = (i >= n - 20) ? lno_t(c) : lno_t(std::rand() % i);
+      rnd[i][j] = scalar_t(-0.5 + double(std::rand()) / RAND_MAX);
+    }
+  }
+  Test::run_test_supernodal_cholesky<scalar_t, lno_t, size_type, device>(n,
+                                                                         rnd);
+
+#if defined(KOKKOSKERNELS_ENABLE_SUPERNODAL_SPTRSV)
+  using KokkosSparse::Experimental::SPTRSVAlgorithm;
+  for (bool u_in_csr : {true, false}) {
+    Test::run_test_supernodal_cholesky_sptrsv<scalar_t, lno_t, size_type,
+                                              device>(
+        n, rnd, SPTRSVAlgorithm::SUPERNODAL_ETREE, u_in_csr);
+    Test::run_test_supernodal_cholesky_sptrsv<scalar_t, lno_t, size_type,
+                                              device>(
+        nx * nx, lap, SPTRSVAlgorithm::SUPERNODAL_ETREE, u_in_csr);
+  }
+  Test::run_test_supernodal_cholesky_sptrsv<scalar_t, lno_t, size_type,
+                                            device>(
+      n, rnd, SPTRSVAlgorithm::SUPERNODAL_DAG, false);
+#endif
+
+  // A single diagonal entry
+  Test::run_test_supernodal_cholesky<scalar_t, lno_t, size_type, device>(
+      1, lower_t(1));
+}
+
+#define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE) \
+  TEST_F(TestCategory,                                              \
+         sparse##_##supernodal_cholesky##_##SCALAR##_##ORDINAL##_## \
+             OFFSET##_##DEVICE) {                                   \
+    test_supernodal_cholesky<SCALAR, ORDINAL, OFFSET, DEVICE>();    \
+  }
+
+#include <Test_Common_Test_All_Type_Combos.hpp>
+
+#undef KOKKOSKERNELS_EXECUTE_TEST